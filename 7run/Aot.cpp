@@ -0,0 +1,43 @@
+#include "Aot.h"
+#include "VMBase.h"
+#include "Profile.h"
+#include <stdio.h>
+
+bool aotmode = true;
+
+static AotImage *images;
+
+AotImage::AotImage(const char *name, uint16_t base, size_t size, uint32_t hash,
+        void (*run)(VMBase *vm))
+: name(name), base(base), size(size), hash(hash), run(run), next(images) {
+    images = this;
+}
+
+// 7run-aot
+bool aotlinked() {
+    return images != NULL;
+}
+
+// FNV-1a
+uint32_t aothash(const uint8_t *text, size_t size) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        h = (h ^ text[i]) * 16777619u;
+    }
+    return h;
+}
+
+// the translated code skips the per-instruction work of -v -v, -G, -P
+// and --budget, these keep interpreting
+const AotImage *aotfind(const uint8_t *text, uint16_t base, size_t size) {
+    if (!images || !aotmode || ctx->trace >= 2 || callgraph || profcount
+            || ctx->insnbudget != ~uint64_t(0)) return NULL;
+    uint32_t hash = aothash(text + base, size);
+    for (AotImage *img = images; img; img = img->next) {
+        if (img->base == base && img->size == size && img->hash == hash) {
+            if (ctx->trace) fprintf(stderr, "<aot: %s>\n", img->name);
+            return img;
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+struct VMBase;
+
+// a text image translated to C++ by 7aot, linked into 7run-aot and
+// selected at load by the hash of the text
+
+struct AotImage {
+    const char *name;
+    uint16_t base;
+    size_t size;
+    uint32_t hash;
+    void (*run)(VMBase *vm); // returns at exit or exec
+    AotImage *next;
+
+    AotImage(const char *name, uint16_t base, size_t size, uint32_t hash,
+            void (*run)(VMBase *vm));
+};
+
+extern bool aotmode; // false: --no-aot
+
+bool aotlinked();
+uint32_t aothash(const uint8_t *text, size_t size);
+const AotImage *aotfind(const uint8_t *text, uint16_t base, size_t size);
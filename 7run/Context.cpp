@@ -0,0 +1,11 @@
+#include "Context.h"
+
+static Context defctx;
+
+// the host threads start in the default context
+__thread Context *ctx = &defctx;
+
+Context::Context()
+: trace(0), insnbudget(~uint64_t(0)), current(NULL), lastpid(0), lastbuf(NULL),
+statgen(0), hits(0), lookups(0) {
+}
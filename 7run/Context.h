@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+#include <string>
+#include <list>
+#include <map>
+#include <time.h>
+#include <sys/stat.h>
+
+class UnixBase;
+struct FileBase;
+struct BufFile;
+
+struct StatEntry {
+    time_t time;
+    int gen, result, err;
+    struct stat st;
+};
+
+// the state of one guest process tree (see Guest). a host thread runs the
+// tree that ctx points to; the options of the tools (profiles, traces,
+// --memo) stay global to the host process.
+struct Context {
+    int trace;
+    std::string rootpath;
+    uint64_t insnbudget; // --budget, all ones: none
+    UnixBase *current; // the running process
+    std::list<UnixBase *> forks; // NO_FORK: children to run at wait()
+    int lastpid; // NO_FORK
+    std::list<std::string> unlinks; // WIN32: removed at the last close
+    std::list<BufFile *> buffiles;
+    BufFile *lastbuf; // the last of buffiles that did I/O
+    std::map<std::string, StatEntry> statcache;
+    int statgen, hits, lookups;
+    std::map<std::string, FileBase *> streams; // guest paths (see MemStream.h)
+
+    Context();
+};
+
+extern __thread Context *ctx;
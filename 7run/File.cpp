@@ -1,13 +1,30 @@
 #include "File.h"
+#include "utils.h"
+#include <string.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <unistd.h>
 
+#define RBUF_MIN 0x400
+#define RBUF_MAX 0x8000
+#define WBUF_MAX 0x2000
+
+bool buffered = true;
+
 FileBase::FileBase(int fd, const std::string &path) : fd(fd), count(1), path(path) {
 }
 
 FileBase::~FileBase() {
 }
 
+int FileBase::flush() {
+    return 0;
+}
+
+FileBase *FileBase::reopen() {
+    return dup();
+}
+
 File::File(int fd, const std::string &path) : FileBase(fd, path) {
 }
 
@@ -34,3 +51,191 @@ off_t File::lseek(off_t o, int w) {
 FileBase *File::dup() {
     return new File(::dup(fd), path);
 }
+
+int File::fstat(struct stat *st) {
+    return ::fstat(fd, st);
+}
+
+BufFile::BufFile(int fd, const std::string &path) : File(fd, path) {
+    init();
+}
+
+BufFile::BufFile(const std::string &path, int flag, int mode)
+: File(path, flag, mode) {
+    init();
+}
+
+BufFile::~BufFile() {
+    flush();
+    ctx->buffiles.remove(this);
+    if (ctx->lastbuf == this) ctx->lastbuf = NULL;
+}
+
+void BufFile::init() {
+    reg = tty = false;
+    dev = ino = 0;
+    rpos = 0;
+    ra = RBUF_MIN;
+    err = 0;
+    struct stat st;
+    if (fd == -1 || ::fstat(fd, &st)) return;
+    reg = S_ISREG(st.st_mode);
+    tty = isatty(fd);
+    dev = st.st_dev;
+    ino = st.st_ino;
+    ctx->buffiles.push_back(this);
+}
+
+// keep the order between descriptors that share the same host file
+void BufFile::select() {
+    if (ctx->lastbuf == this) return;
+    std::list<BufFile *> &files = ctx->buffiles;
+    std::list<BufFile *>::iterator it;
+    for (it = files.begin(); it != files.end(); ++it) {
+        BufFile *f = *it;
+        if (f != this && f->dev == dev && f->ino == ino) f->flush();
+    }
+    ctx->lastbuf = this;
+}
+
+void BufFile::flushw() {
+    size_t p = 0, len = wbuf.size();
+    while (p < len) {
+        int ret = ::write(fd, &wbuf[p], len - p);
+        if (ret <= 0) {
+            if (!err) err = ret < 0 ? errno : ENOSPC;
+            break;
+        }
+        p += ret;
+    }
+    wbuf.clear();
+    clearstat();
+}
+
+void BufFile::dropr() {
+    if (rpos < rbuf.size()) ::lseek(fd, -off_t(rbuf.size() - rpos), SEEK_CUR);
+    rbuf.clear();
+    rpos = 0;
+}
+
+// the error stays for the next write
+int BufFile::flush() {
+    if (!wbuf.empty()) flushw();
+    if (!rbuf.empty()) dropr();
+    if (!err) return 0;
+    errno = err;
+    return -1;
+}
+
+void BufFile::flushall() {
+    std::list<BufFile *> &files = ctx->buffiles;
+    std::list<BufFile *>::iterator it;
+    for (it = files.begin(); it != files.end(); ++it) {
+        (*it)->flush();
+    }
+}
+
+// a stat by path sees the writes that are still in the buffers
+void BufFile::flushpath(const std::string &path) {
+    std::list<BufFile *> &files = ctx->buffiles;
+    std::list<BufFile *>::iterator it;
+    struct stat st;
+    bool found = false;
+    for (it = files.begin(); it != files.end(); ++it) {
+        BufFile *f = *it;
+        if (f->wbuf.empty()) continue;
+        if (!found) {
+            if (::stat(path.c_str(), &st)) return;
+            found = true;
+        }
+        if (f->dev == st.st_dev && f->ino == st.st_ino) f->flushw();
+    }
+}
+
+int BufFile::read(void *buf, int len) {
+    if (!reg) {
+        if (tty) flushall();
+        return ::read(fd, buf, len);
+    }
+    select();
+    if (!wbuf.empty()) flushw();
+    uint8_t *p = (uint8_t *) buf;
+    int ret = 0;
+    size_t avail = rbuf.size() - rpos;
+    if (avail) {
+        int n = avail < size_t(len) ? avail : len;
+        memcpy(p, &rbuf[rpos], n);
+        rpos += n;
+        if (n == len) return n;
+        p += n;
+        len -= n;
+        ret = n;
+        if (ra < RBUF_MAX) ra += ra;
+    }
+    rbuf.clear();
+    rpos = 0;
+    if (size_t(len) >= ra) {
+        int n = ::read(fd, p, len);
+        return n < 0 && !ret ? n : ret + (n > 0 ? n : 0);
+    }
+    rbuf.resize(ra);
+    int n = ::read(fd, &rbuf[0], ra);
+    if (n <= 0) {
+        rbuf.clear();
+        return n < 0 && !ret ? n : ret;
+    }
+    rbuf.resize(n);
+    rpos = n < len ? n : len;
+    memcpy(p, &rbuf[0], rpos);
+    return ret + rpos;
+}
+
+int BufFile::write(void *buf, int len) {
+    if (!reg && !tty) return ::write(fd, buf, len);
+    select();
+    if (!rbuf.empty()) dropr();
+    if (wbuf.size() + len > WBUF_MAX) flushw();
+    if (err) {
+        errno = err;
+        err = 0;
+        return -1;
+    }
+    if (len >= WBUF_MAX) return ::write(fd, buf, len);
+    uint8_t *p = (uint8_t *) buf;
+    wbuf.insert(wbuf.end(), p, p + len);
+    if (tty && memchr(p, '\n', len)) flushw();
+    return len;
+}
+
+off_t BufFile::lseek(off_t o, int w) {
+    flush();
+    ra = RBUF_MIN;
+    return ::lseek(fd, o, w);
+}
+
+FileBase *BufFile::dup() {
+    ++count;
+    return this;
+}
+
+int BufFile::fstat(struct stat *st) {
+    if (!wbuf.empty()) flushw();
+    return ::fstat(fd, st);
+}
+
+FileBase *openfile(int fd, const std::string &path) {
+    if (buffered) return new BufFile(fd, path);
+    return new File(fd, path);
+}
+
+FileBase *openfile(const std::string &path, int flag, int mode) {
+    File *f;
+    if (buffered) {
+        f = new BufFile(path, flag, mode);
+    } else {
+        f = new File(path, flag, mode);
+    }
+    if (f->fd != -1) return f;
+    delete f;
+    return NULL;
+}
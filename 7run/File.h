@@ -2,6 +2,11 @@
 #include <stdint.h>
 #include <string>
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <vector>
+#include <list>
+
+extern bool buffered;
 
 struct FileBase {
     int fd;
@@ -15,6 +20,9 @@ struct FileBase {
     virtual int write(void *buf, int len) = 0;
     virtual off_t lseek(off_t o, int w) = 0;
     virtual FileBase *dup() = 0;
+    virtual int fstat(struct stat *st) = 0;
+    virtual int flush(); // -1: a delayed write failed (errno)
+    virtual FileBase *reopen(); // opened again at its path (see MemStream.h)
 };
 
 struct File : public FileBase {
@@ -26,4 +34,39 @@ struct File : public FileBase {
     virtual int write(void *buf, int len);
     virtual off_t lseek(off_t o, int w);
     virtual FileBase *dup();
+    virtual int fstat(struct stat *st);
 };
+
+// write-behind and read-ahead buffer for regular files and terminals
+
+struct BufFile : public File {
+    bool reg, tty;
+    dev_t dev;
+    ino_t ino;
+    std::vector<uint8_t> wbuf, rbuf;
+    size_t rpos, ra;
+    int err; // errno of a failed write-behind, for the next write or close
+
+    BufFile(int fd, const std::string &path);
+    BufFile(const std::string &path, int flag, int mode);
+    virtual ~BufFile();
+
+    virtual int read(void *buf, int len);
+    virtual int write(void *buf, int len);
+    virtual off_t lseek(off_t o, int w);
+    virtual FileBase *dup();
+    virtual int fstat(struct stat *st);
+    virtual int flush();
+
+    static void flushall();
+    static void flushpath(const std::string &path);
+
+private:
+    void init();
+    void select();
+    void flushw();
+    void dropr();
+};
+
+FileBase *openfile(int fd, const std::string &path);
+FileBase *openfile(const std::string &path, int flag, int mode);
@@ -0,0 +1,188 @@
+#include "Guest.h"
+#include "Minix2/OS.h"
+#include "UnixV6/OSPDP11.h"
+#include "UnixV6/OSi8086.h"
+#include "MemFS.h"
+#include "MemStream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// the methods switch to the context of the guest
+class Enter {
+    Context *saved;
+public:
+    Enter(Context *c) : saved(ctx) {
+        ctx = c;
+    }
+
+    ~Enter() {
+        ctx = saved;
+    }
+};
+
+Guest::Guest(Context *c)
+: context(c ? c : new Context), owned(!c), ub(NULL), ver(6), pdp11(false), i8086(false),
+exitcode(0) {
+    for (int i = 0; i < 3; i++) stdio[i] = NULL;
+    envs.push_back("PATH=/bin:/usr/bin");
+}
+
+Guest::~Guest() {
+    Enter e(context);
+    delete ub;
+    for (int i = 0; i < 3; i++) {
+        if (stdio[i] && !--stdio[i]->count) delete stdio[i];
+    }
+    stream_release();
+    if (owned) delete context;
+}
+
+void Guest::setroot(const std::string &root) {
+    Enter e(context);
+    ::setroot(root);
+}
+
+void Guest::settrace(int level) {
+    context->trace = level;
+}
+
+void Guest::setbudget(uint64_t insns) {
+    context->insnbudget = insns;
+}
+
+void Guest::setmode(int ver, bool pdp11, bool i8086) {
+    this->ver = ver;
+    this->pdp11 = pdp11;
+    this->i8086 = i8086;
+}
+
+void Guest::setargs(const std::vector<std::string> &args) {
+    this->args = args;
+}
+
+void Guest::setenvs(const std::vector<std::string> &envs) {
+    this->envs = envs;
+}
+
+static const char *stdnames[] = {"stdin", "stdout", "stderr"};
+
+// the guest gets its own copy of hostfd
+void Guest::attach(int fd, int hostfd) {
+    if (fd < 0 || fd > 2) return;
+    Enter e(context);
+    int fd2 = dup(hostfd);
+    if (fd2 != -1) attach(fd, openfile(fd2, stdnames[fd]));
+}
+
+// the guest owns f
+void Guest::attach(int fd, FileBase *f) {
+    if (fd < 0 || fd > 2) return;
+    Enter e(context);
+    if (stdio[fd] && !--stdio[fd]->count) delete stdio[fd];
+    stdio[fd] = f;
+}
+
+// the processes open f at path, which replaces the file there
+void Guest::attach(const std::string &path, FileBase *f) {
+    Enter e(context);
+    stream_attach(path, f);
+}
+
+bool Guest::load(const std::string &path) {
+    Enter e(context);
+    uint8_t magic[2];
+    FILE *f = fopen(convpath(path).c_str(), "rb");
+    if (!f) {
+        fprintf(stderr, "can not open: %s\n", path.c_str());
+        return false;
+    }
+    bool ok = fread(magic, 1, 2, f) == 2;
+    fclose(f);
+    if (!ok) {
+        fprintf(stderr, "can not read: %s\n", path.c_str());
+        return false;
+    }
+    create(magic);
+    if (args.empty()) args.push_back(path);
+    if (ub->load(path)) return true;
+    delete ub;
+    ub = NULL;
+    return false;
+}
+
+bool Guest::load(const std::string &name, const void *image, size_t size) {
+    Enter e(context);
+    if (size < 2) {
+        fprintf(stderr, "can not read: %s\n", name.c_str());
+        return false;
+    }
+#ifdef WIN32
+    FILE *f = tmpfile();
+    if (f && fwrite(image, 1, size, f) != size) {
+        fclose(f);
+        f = NULL;
+    }
+#else
+    FILE *f = fmemopen(const_cast<void *> (image), size, "rb");
+#endif
+    if (!f) {
+        fprintf(stderr, "can not open: %s\n", name.c_str());
+        return false;
+    }
+    create((const uint8_t *) image);
+    if (args.empty()) args.push_back(name);
+    if (ub->load(name, f)) return true;
+    delete ub;
+    ub = NULL;
+    return false;
+}
+
+// the OS is chosen by the magic of the image unless setmode() forced it
+void Guest::create(const uint8_t *magic) {
+    uint8_t h[2] = {magic[0], magic[1]};
+    delete ub;
+    if (pdp11 || UnixV6::OSPDP11::check(h)) {
+        ub = new UnixV6::OSPDP11(ver);
+    } else if (i8086 || UnixV6::OSi8086::check(h)) {
+        ub = new UnixV6::OSi8086();
+    } else {
+        ub = new Minix2::OS();
+    }
+    for (int i = 0; i < 3; i++) {
+        if (!stdio[i]) continue;
+        ub->close(i);
+        ++stdio[i]->count;
+        ub->open(stdio[i]);
+    }
+}
+
+void Guest::disasm() {
+    Enter e(context);
+    if (ub) ub->disasm();
+}
+
+int Guest::hletest() {
+    Enter e(context);
+    return ub ? ub->hletest() : 1;
+}
+
+// a child of the host-fork build returns from the guest here and exits
+// without the embedding program's atexit handlers and stdio buffers
+int Guest::run() {
+    Enter e(context);
+    if (!ub) return exitcode = 1;
+    int hostpid = getpid();
+    exitcode = ub->run(args, envs);
+    delete ub;
+    ub = NULL;
+    memfs_sync();
+    if (systrace) systrace_flush();
+    if (context->trace) showcache();
+    if (getpid() != hostpid) {
+        BufFile::flushall();
+        if (timeline) timeline_close(false);
+        _exit(exitcode);
+    }
+    return exitcode;
+}
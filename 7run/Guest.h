@@ -0,0 +1,62 @@
+#pragma once
+#include "Context.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+class UnixBase;
+struct FileBase;
+
+// lib7run: a guest process tree with its own Context. the host program sets
+// up the guest, loads an image from a path or a buffer, runs it to the exit
+// and reads the status. guests may run one after another or on separate
+// threads (with the NO_FORK build: the host-fork build forks the host
+// process for each guest fork, and the children exit in run()).
+// stdio and guest paths may be streams in memory (see MemStream.h).
+//
+//     Guest g;
+//     std::vector<uint8_t> out;
+//     g.setroot("distrib/v6root");
+//     g.setargs(args);
+//     g.attach("hello.c", new MemInput(src.data(), src.size(), "hello.c"));
+//     g.attach(1, new MemOutput(&out));
+//     if (g.load(args[0])) status = g.run();
+class Guest {
+    Context *context;
+    bool owned;
+    UnixBase *ub;
+    int ver; // 2, 6 or 7
+    bool pdp11, i8086; // the OS of the image, otherwise from its magic
+    std::vector<std::string> args, envs;
+    FileBase *stdio[3]; // NULL: the host descriptor
+    int exitcode;
+
+    Guest(const Guest &);
+    void operator=(const Guest &);
+    void create(const uint8_t *magic);
+
+public:
+    Guest(Context *c = NULL); // NULL: a new context
+    ~Guest();
+
+    void setroot(const std::string &root);
+    void settrace(int level);
+    void setbudget(uint64_t insns); // per process, before load()
+    void setmode(int ver, bool pdp11 = false, bool i8086 = false);
+    void setargs(const std::vector<std::string> &args);
+    void setenvs(const std::vector<std::string> &envs);
+    void attach(int fd, int hostfd);
+    void attach(int fd, FileBase *f);
+    void attach(const std::string &path, FileBase *f);
+
+    bool load(const std::string &path);
+    bool load(const std::string &name, const void *image, size_t size);
+    void disasm();
+    int hletest();
+    int run();
+
+    inline int status() const {
+        return exitcode;
+    }
+};
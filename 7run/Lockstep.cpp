@@ -0,0 +1,88 @@
+#include "Lockstep.h"
+#include "VMBase.h"
+#include "XTrace.h"
+#include <stdio.h>
+#include <string.h>
+
+bool lockstep;
+
+// names: of the XT_STATE registers of getstate(), NULL if unused
+Lockstep::Lockstep(const char * const *names)
+: names(names), start(0), full(false) {
+}
+
+// a word at a written address
+bool Lockstep::same(VMBase *ref, VMBase *alt, int addr) {
+    uint16_t next = addr + 1;
+    return ref->data[addr] == alt->data[addr]
+            && ref->data[next] == alt->data[next];
+}
+
+// ends the block: false if the shadow diverged
+bool Lockstep::check(VMBase *ref, VMBase *alt,
+        const uint16_t *st1, const uint16_t *st2) {
+    bool ok = ref->hasExited == alt->hasExited
+            && !memcmp(st1, st2, XT_STATE * sizeof (uint16_t));
+    if (ok && full) {
+        ok = !memcmp(ref->data, alt->data, 0x10000);
+    } else {
+        for (size_t i = 0; ok && i < addrs.size(); i++) {
+            ok = same(ref, alt, addrs[i]);
+        }
+    }
+    if (!ok) {
+        report(ref, alt, st1, st2);
+        return false;
+    }
+    addrs.clear();
+    full = false;
+    start = ref->insns;
+    return true;
+}
+
+void Lockstep::report(VMBase *ref, VMBase *alt,
+        const uint16_t *st1, const uint16_t *st2) {
+    uint64_t n = ref->insns - start;
+    if (n > FLIGHT_PCS) n = FLIGHT_PCS;
+    fprintf(stderr, "lockstep: divergence after %llu instructions\n",
+            (unsigned long long) (ref->insns - ref->execinsns));
+    fprintf(stderr, "--- block ---\n");
+    for (uint64_t i = ref->insns - n; i != ref->insns; i++) {
+        fprintf(stderr, "%s\n", ref->disline(ref->recent[i % FLIGHT_PCS]).c_str());
+    }
+    fprintf(stderr, "--- reference / shadow ---\n");
+    if (ref->hasExited != alt->hasExited) {
+        fprintf(stderr, "exited: %d %d\n", ref->hasExited, alt->hasExited);
+    }
+    for (int i = 0; i < XT_STATE; i++) {
+        if (names[i] && st1[i] != st2[i]) {
+            fprintf(stderr, "%-5s: %04x %04x\n", names[i], st1[i], st2[i]);
+        }
+    }
+    int shown = 0;
+    for (int i = 0; i < 0x10000 && shown < 16; i++) {
+        if (ref->data[i] != alt->data[i]) {
+            fprintf(stderr, "[%04x]: %02x %02x\n", i, ref->data[i], alt->data[i]);
+            shown++;
+        }
+    }
+}
+
+// copies the results of a system call or a signal to the shadow
+void Lockstep::sync(VMBase *ref, VMBase *alt) {
+    bool split = ref->data != ref->text;
+    if (split != (alt->data != alt->text)) {
+        alt->release();
+        alt->text = new uint8_t[0x10000];
+        alt->data = split ? new uint8_t[0x10000] : alt->text;
+    }
+    memcpy(alt->text, ref->text, 0x10000);
+    if (split) memcpy(alt->data, ref->data, 0x10000);
+    alt->tsize = ref->tsize;
+    alt->dsize = ref->dsize;
+    alt->brksize = ref->brksize;
+    alt->hasExited = ref->hasExited;
+    addrs.clear();
+    full = false;
+    start = ref->insns;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+
+// lockstep (--lockstep): a shadow VM runs the same guest on another engine
+// tier next to the reference VM. only the reference makes system calls and
+// takes signals; the shadow is then resynchronized from it. registers and
+// flags are compared at every block boundary (a control transfer), the
+// memory written by the block at its end and all memory before each system
+// call. the first divergence stops the guest with the disassembled block.
+
+extern bool lockstep;
+
+struct VMBase;
+
+class Lockstep {
+    const char * const *names;
+    std::vector<int> addrs;
+    uint64_t start;
+    bool full;
+
+    bool same(VMBase *ref, VMBase *alt, int addr);
+    void report(VMBase *ref, VMBase *alt,
+            const uint16_t *st1, const uint16_t *st2);
+
+public:
+    Lockstep(const char * const *names);
+
+    inline void touch(int addr) {
+        if (addr >= 0) addrs.push_back(addr);
+    }
+
+    inline void touchall() {
+        full = true;
+    }
+
+    bool check(VMBase *ref, VMBase *alt,
+            const uint16_t *st1, const uint16_t *st2);
+    void sync(VMBase *ref, VMBase *alt);
+};
@@ -0,0 +1,339 @@
+#include "MemFS.h"
+#include "VMBase.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <list>
+#include <map>
+
+size_t memfs_limit = 16 << 20;
+
+static std::list<std::string> mounts;
+static std::map<std::string, MemNode *> nodes;
+static size_t used;
+static ino_t lastino = 0x7000;
+
+MemNode::MemNode(mode_t mode)
+: count(0), nlink(0), spill(-1), mode(mode), ino(++lastino), mtime(time(NULL)) {
+}
+
+MemNode::~MemNode() {
+    used -= data.size();
+    if (spill >= 0) close(spill);
+}
+
+// the absolute guest path: mounts and names are compared in this form
+static std::string normpath(const std::string &path) {
+    std::string p = path;
+    if (!startsWith(p, "/")) {
+        char buf[4096];
+        if (!getcwd(buf, sizeof (buf))) return path;
+        std::string cwd = buf;
+        const std::string &root = ctx->rootpath;
+        if (startsWith(root, "/") && (cwd == root || startsWith(cwd, root + "/"))) {
+            cwd = cwd.substr(root.size());
+        }
+        p = cwd + "/" + p;
+    }
+    std::vector<std::string> names;
+    size_t i = 0;
+    while (i < p.size()) {
+        size_t j = p.find('/', i);
+        if (j == std::string::npos) j = p.size();
+        std::string name = p.substr(i, j - i);
+        if (name == "..") {
+            if (!names.empty()) names.pop_back();
+        } else if (!name.empty() && name != ".") {
+            names.push_back(name);
+        }
+        i = j + 1;
+    }
+    std::string ret;
+    for (i = 0; i < names.size(); i++) ret += "/" + names[i];
+    return ret.empty() ? "/" : ret;
+}
+
+static void release(MemNode *node) {
+    if (!--node->count) delete node;
+}
+
+static void addname(const std::string &path, MemNode *node) {
+    nodes[path] = node;
+    ++node->nlink;
+    ++node->count;
+}
+
+static bool spill(MemNode *node, const std::string &path) {
+    int flag = O_RDWR | O_CREAT | O_TRUNC;
+#ifdef WIN32
+    flag |= O_BINARY;
+#endif
+    int fd = open(path.c_str(), flag, node->mode);
+    if (fd == -1) return false;
+    int len = node->data.size();
+    if (len && write(fd, &node->data[0], len) != len) {
+        close(fd);
+        return false;
+    }
+    used -= len;
+    std::vector<uint8_t>().swap(node->data);
+    node->spill = fd;
+    node->path = path;
+    clearcache();
+    return true;
+}
+
+// move all names of the node to the host file system
+static bool spillnode(MemNode *node) {
+    std::map<std::string, MemNode *>::iterator it = nodes.begin();
+    while (it != nodes.end()) {
+        if (it->second != node) {
+            ++it;
+            continue;
+        }
+        std::string path = convpath(it->first);
+        if (node->spill < 0) {
+            if (!spill(node, path)) return false;
+            if (ctx->trace) fprintf(stderr, "<spill: %s>\n", path.c_str());
+        } else {
+#ifndef WIN32
+            link(node->path.c_str(), path.c_str());
+#endif
+        }
+        nodes.erase(it++);
+        --node->nlink;
+        release(node);
+    }
+    return true;
+}
+
+static void setstat(MemNode *node, struct stat *st) {
+    memset(st, 0, sizeof (*st));
+    st->st_ino = node->ino;
+    st->st_mode = S_IFREG | node->mode;
+    st->st_nlink = node->nlink;
+#ifndef WIN32
+    st->st_uid = getuid();
+    st->st_gid = getgid();
+#endif
+    st->st_size = node->data.size();
+    st->st_atime = st->st_mtime = st->st_ctime = node->mtime;
+}
+
+MemFile::MemFile(MemNode *node, const std::string &path, int flag)
+: FileBase(-1, path), node(node), pos(0), flag(flag) {
+    ++node->count;
+}
+
+MemFile::~MemFile() {
+    release(node);
+}
+
+int MemFile::read(void *buf, int len) {
+    if ((flag & O_ACCMODE) == O_WRONLY) {
+        errno = EBADF;
+        return -1;
+    }
+    if (node->spill >= 0) {
+        ::lseek(node->spill, pos, SEEK_SET);
+        int ret = ::read(node->spill, buf, len);
+        if (ret > 0) pos += ret;
+        return ret;
+    }
+    off_t size = node->data.size();
+    if (pos >= size) return 0;
+    if (len > size - pos) len = size - pos;
+    memcpy(buf, &node->data[pos], len);
+    pos += len;
+    return len;
+}
+
+int MemFile::write(void *buf, int len) {
+    if ((flag & O_ACCMODE) == O_RDONLY) {
+        errno = EBADF;
+        return -1;
+    }
+    if (node->spill < 0) {
+        size_t size = node->data.size(), end = pos + len;
+        if (flag & O_APPEND) end = (pos = size) + len;
+        if (end > size && used + (end - size) > memfs_limit) spillnode(node);
+    }
+    if (node->spill >= 0) {
+        if (flag & O_APPEND) {
+            pos = ::lseek(node->spill, 0, SEEK_END);
+        } else {
+            ::lseek(node->spill, pos, SEEK_SET);
+        }
+        int ret = ::write(node->spill, buf, len);
+        if (ret > 0) pos += ret;
+        return ret;
+    }
+    size_t end = pos + len;
+    if (end > node->data.size()) {
+        used += end - node->data.size();
+        node->data.resize(end);
+    }
+    if (len > 0) memcpy(&node->data[pos], buf, len);
+    pos = end;
+    node->mtime = time(NULL);
+    return len;
+}
+
+off_t MemFile::lseek(off_t o, int w) {
+    off_t size;
+    if (node->spill >= 0) {
+        size = ::lseek(node->spill, 0, SEEK_END);
+    } else {
+        size = node->data.size();
+    }
+    off_t p;
+    switch (w) {
+        case SEEK_SET: p = o;
+            break;
+        case SEEK_CUR: p = pos + o;
+            break;
+        case SEEK_END: p = size + o;
+            break;
+        default:
+            errno = EINVAL;
+            return -1;
+    }
+    if (p < 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return pos = p;
+}
+
+FileBase *MemFile::dup() {
+    ++count;
+    return this;
+}
+
+int MemFile::fstat(struct stat *st) {
+    if (node->spill >= 0) return ::fstat(node->spill, st);
+    setstat(node, st);
+    return 0;
+}
+
+void memfs_mount(const std::string &prefix) {
+    std::string p = startsWith(prefix, "/") ? normpath(prefix) : prefix;
+    if (endsWith(p, "/")) {
+        mounts.push_back(p);
+    } else {
+        mounts.push_back(p + "/");
+    }
+}
+
+bool memfs_mounted(const std::string &path) {
+    if (mounts.empty()) return false;
+    std::string p = normpath(path);
+    std::list<std::string>::iterator it;
+    for (it = mounts.begin(); it != mounts.end(); ++it) {
+        if (startsWith(p, *it)) return true;
+    }
+    return false;
+}
+
+FileBase *memfs_open(const std::string &path, int flag, int mode) {
+    std::string key = normpath(path);
+    std::map<std::string, MemNode *>::iterator it = nodes.find(key);
+    if (it != nodes.end()) {
+        if ((flag & O_CREAT) && (flag & O_EXCL)) {
+            errno = EEXIST;
+            return NULL;
+        }
+        MemNode *node = it->second;
+        if ((flag & O_TRUNC) && (flag & O_ACCMODE) != O_RDONLY) {
+            used -= node->data.size();
+            node->data.clear();
+            node->mtime = time(NULL);
+        }
+        return new MemFile(node, key, flag);
+    }
+    std::string path2 = convpath(path);
+    struct stat st;
+    if (!(flag & O_CREAT) || used >= memfs_limit || !stat(path2.c_str(), &st)) {
+#ifdef WIN32
+        flag |= O_BINARY;
+#endif
+        return openfile(path2, flag, mode);
+    }
+    MemNode *node = new MemNode(mode & 07777);
+    addname(key, node);
+    return new MemFile(node, key, flag);
+}
+
+bool memfs_stat(const std::string &path, struct stat *st) {
+    if (nodes.empty()) return false;
+    std::map<std::string, MemNode *>::iterator it = nodes.find(normpath(path));
+    if (it == nodes.end()) return false;
+    setstat(it->second, st);
+    return true;
+}
+
+// mode: R_OK, W_OK and X_OK against the owner bits of the node
+bool memfs_access(const std::string &path, int mode, int *result) {
+    if (nodes.empty()) return false;
+    std::map<std::string, MemNode *>::iterator it = nodes.find(normpath(path));
+    if (it == nodes.end()) return false;
+    mode_t m = it->second->mode;
+    if (((mode & R_OK) && !(m & 0400)) || ((mode & W_OK) && !(m & 0200))
+            || ((mode & X_OK) && !(m & 0100))) {
+        errno = EACCES;
+        *result = -1;
+    } else {
+        *result = 0;
+    }
+    return true;
+}
+
+bool memfs_chmod(const std::string &path, mode_t mode) {
+    if (nodes.empty()) return false;
+    std::map<std::string, MemNode *>::iterator it = nodes.find(normpath(path));
+    if (it == nodes.end()) return false;
+    it->second->mode = mode & 07777;
+    return true;
+}
+
+bool memfs_unlink(const std::string &path) {
+    if (nodes.empty()) return false;
+    std::map<std::string, MemNode *>::iterator it = nodes.find(normpath(path));
+    if (it == nodes.end()) return false;
+    MemNode *node = it->second;
+    nodes.erase(it);
+    --node->nlink;
+    release(node);
+    return true;
+}
+
+bool memfs_link(const std::string &src, const std::string &dst, int *result) {
+    if (nodes.empty()) return false;
+    std::string key = normpath(dst);
+    if (nodes.find(key) != nodes.end()) {
+        errno = EEXIST;
+        *result = -1;
+        return true;
+    }
+    std::map<std::string, MemNode *>::iterator it = nodes.find(normpath(src));
+    if (it == nodes.end()) return false;
+    if (!memfs_mounted(dst)) {
+        // the link leaves the mount: let the host link the spilled file
+        spillnode(it->second);
+        return false;
+    }
+    addname(key, it->second);
+    *result = 0;
+    return true;
+}
+
+void memfs_sync() {
+    std::map<std::string, MemNode *> tmp = nodes;
+    std::map<std::string, MemNode *>::iterator it;
+    for (it = tmp.begin(); it != tmp.end(); ++it) {
+        if (nodes.find(it->first) != nodes.end()) spillnode(it->second);
+    }
+}
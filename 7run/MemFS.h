@@ -0,0 +1,44 @@
+#pragma once
+#include "File.h"
+#include <vector>
+
+// in-memory file system mounted over guest path prefixes (ex. /tmp/)
+
+struct MemNode {
+    std::vector<uint8_t> data;
+    int count, nlink, spill;
+    mode_t mode;
+    ino_t ino;
+    time_t mtime;
+    std::string path;
+
+    MemNode(mode_t mode);
+    ~MemNode();
+};
+
+struct MemFile : public FileBase {
+    MemNode *node;
+    off_t pos;
+    int flag;
+
+    MemFile(MemNode *node, const std::string &path, int flag);
+    virtual ~MemFile();
+
+    virtual int read(void *buf, int len);
+    virtual int write(void *buf, int len);
+    virtual off_t lseek(off_t o, int w);
+    virtual FileBase *dup();
+    virtual int fstat(struct stat *st);
+};
+
+extern size_t memfs_limit;
+
+void memfs_mount(const std::string &prefix);
+bool memfs_mounted(const std::string &path);
+FileBase *memfs_open(const std::string &path, int flag, int mode);
+bool memfs_stat(const std::string &path, struct stat *st);
+bool memfs_access(const std::string &path, int mode, int *result);
+bool memfs_chmod(const std::string &path, mode_t mode);
+bool memfs_unlink(const std::string &path);
+bool memfs_link(const std::string &src, const std::string &dst, int *result);
+void memfs_sync();
@@ -0,0 +1,140 @@
+#include "MemStream.h"
+#include "Context.h"
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+static void setstat(struct stat *st, mode_t mode, off_t size) {
+    memset(st, 0, sizeof (*st));
+    st->st_mode = S_IFREG | mode;
+    st->st_nlink = 1;
+#ifndef WIN32
+    st->st_uid = getuid();
+    st->st_gid = getgid();
+#endif
+    st->st_size = size;
+}
+
+MemInput::MemInput(const void *data, size_t size, const std::string &path)
+: FileBase(-1, path), data((const uint8_t *) data), size(size), pos(0) {
+}
+
+int MemInput::read(void *buf, int len) {
+    if (pos >= off_t(size)) return 0;
+    if (len > off_t(size) - pos) len = size - pos;
+    memcpy(buf, data + pos, len);
+    pos += len;
+    return len;
+}
+
+int MemInput::write(void *, int) {
+    errno = EBADF;
+    return -1;
+}
+
+off_t MemInput::lseek(off_t o, int w) {
+    off_t p;
+    switch (w) {
+        case SEEK_SET: p = o;
+            break;
+        case SEEK_CUR: p = pos + o;
+            break;
+        case SEEK_END: p = size + o;
+            break;
+        default:
+            errno = EINVAL;
+            return -1;
+    }
+    if (p < 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return pos = p;
+}
+
+FileBase *MemInput::dup() {
+    ++count;
+    return this;
+}
+
+int MemInput::fstat(struct stat *st) {
+    setstat(st, 0444, size);
+    return 0;
+}
+
+FileBase *MemInput::reopen() {
+    return new MemInput(data, size, path);
+}
+
+MemOutput::MemOutput(std::vector<uint8_t> *out, const std::string &path)
+: FileBase(-1, path), out(out), sink(NULL), arg(NULL), size(0) {
+}
+
+MemOutput::MemOutput(MemSink sink, void *arg, const std::string &path)
+: FileBase(-1, path), out(NULL), sink(sink), arg(arg), size(0) {
+}
+
+int MemOutput::read(void *, int) {
+    errno = EBADF;
+    return -1;
+}
+
+int MemOutput::write(void *buf, int len) {
+    if (len <= 0) return 0;
+    if (out) {
+        const uint8_t *p = (const uint8_t *) buf;
+        out->insert(out->end(), p, p + len);
+    } else {
+        sink(arg, buf, len);
+    }
+    size += len;
+    return len;
+}
+
+// a pipe: the written bytes can not be rewritten
+off_t MemOutput::lseek(off_t, int) {
+    errno = ESPIPE;
+    return -1;
+}
+
+FileBase *MemOutput::dup() {
+    ++count;
+    return this;
+}
+
+int MemOutput::fstat(struct stat *st) {
+    setstat(st, 0222, size);
+    return 0;
+}
+
+// the stream replaces the previous one at path
+void stream_attach(const std::string &path, FileBase *f) {
+    FileBase *&s = ctx->streams[path];
+    if (s && !--s->count) delete s;
+    s = f;
+}
+
+bool stream_attached(const std::string &path) {
+    return !ctx->streams.empty() && ctx->streams.find(path) != ctx->streams.end();
+}
+
+FileBase *stream_open(const std::string &path) {
+    std::map<std::string, FileBase *>::iterator it = ctx->streams.find(path);
+    if (it == ctx->streams.end()) return NULL;
+    return it->second->reopen();
+}
+
+bool stream_stat(const std::string &path, struct stat *st) {
+    if (ctx->streams.empty()) return false;
+    std::map<std::string, FileBase *>::iterator it = ctx->streams.find(path);
+    return it != ctx->streams.end() && !it->second->fstat(st);
+}
+
+// drops the references of ctx: open descriptors keep their streams
+void stream_release() {
+    std::map<std::string, FileBase *>::iterator it;
+    for (it = ctx->streams.begin(); it != ctx->streams.end(); ++it) {
+        if (!--it->second->count) delete it->second;
+    }
+    ctx->streams.clear();
+}
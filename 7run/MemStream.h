@@ -0,0 +1,50 @@
+#pragma once
+#include "File.h"
+#include <stddef.h>
+
+// stdio of an embedded guest in the memory of the host program (see Guest).
+// the guest reads and writes the buffers of the caller, which must outlive
+// the guest. with the host-fork build a forked child writes into its own
+// copy of the process: collect the output of children with NO_FORK.
+
+struct MemInput : public FileBase {
+    const uint8_t *data;
+    size_t size;
+    off_t pos;
+
+    MemInput(const void *data, size_t size, const std::string &path = "stdin");
+
+    virtual int read(void *buf, int len);
+    virtual int write(void *buf, int len);
+    virtual off_t lseek(off_t o, int w);
+    virtual FileBase *dup();
+    virtual int fstat(struct stat *st);
+    virtual FileBase *reopen();
+};
+
+typedef void (*MemSink)(void *arg, const void *data, size_t len);
+
+// appends to a vector or passes each write to a sink
+struct MemOutput : public FileBase {
+    std::vector<uint8_t> *out;
+    MemSink sink;
+    void *arg;
+    off_t size;
+
+    MemOutput(std::vector<uint8_t> *out, const std::string &path = "stdout");
+    MemOutput(MemSink sink, void *arg, const std::string &path = "stdout");
+
+    virtual int read(void *buf, int len);
+    virtual int write(void *buf, int len);
+    virtual off_t lseek(off_t o, int w);
+    virtual FileBase *dup();
+    virtual int fstat(struct stat *st);
+};
+
+// guest paths of the streams in ctx: every open of an input starts at its
+// beginning, the outputs are shared
+void stream_attach(const std::string &path, FileBase *f);
+bool stream_attached(const std::string &path);
+FileBase *stream_open(const std::string &path);
+bool stream_stat(const std::string &path, struct stat *st);
+void stream_release();
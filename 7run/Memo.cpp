@@ -0,0 +1,528 @@
+#include "Memo.h"
+#include "utils.h"
+#include "VMBase.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <map>
+#include <set>
+
+std::string memodir, depspath;
+bool memo, memolog;
+
+static uint64_t memokey;
+static int logfd = -1;
+static std::string logpath;
+
+uint64_t memohash(const void *p, size_t len, uint64_t h) {
+    const uint8_t *s = (const uint8_t *) p;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ s[i]) * 1099511628211ull;
+    }
+    return h;
+}
+
+static std::string hex64(uint64_t v) {
+    char buf[20];
+    snprintf(buf, sizeof (buf), "%016llx", (unsigned long long) v);
+    return buf;
+}
+
+static bool readfile(const std::string &path, std::string *s) {
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    s->clear();
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof (buf), f)) > 0) s->append(buf, n);
+    bool ok = !ferror(f);
+    fclose(f);
+    return ok;
+}
+
+// written to a temporary file and renamed: concurrent runs see the whole
+// file or none
+static bool writefile(const std::string &path, const std::string &s) {
+    char buf[16];
+    snprintf(buf, sizeof (buf), ".%d", getpid());
+    std::string tmp = path + buf;
+    FILE *f = fopen(tmp.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(s.data(), 1, s.size(), f) == s.size();
+    if (fclose(f) || !ok || rename(tmp.c_str(), path.c_str())) {
+        unlink(tmp.c_str());
+        return false;
+    }
+    return true;
+}
+
+static bool filehash(const std::string &path, uint64_t *h) {
+    std::string s;
+    if (!readfile(path, &s)) return false;
+    *h = memohash(s.data(), s.size());
+    return true;
+}
+
+static std::string blobpath(uint64_t h) {
+    return memodir + "/" + hex64(h) + ".blob";
+}
+
+static bool putblob(const std::string &s, uint64_t *h) {
+    *h = memohash(s.data(), s.size());
+    std::string path = blobpath(*h);
+    struct stat st;
+    return !stat(path.c_str(), &st) || writefile(path, s);
+}
+
+static void logrec(const std::string &rec) {
+    if (write(logfd, rec.data(), rec.size()) != (int) rec.size()) {
+        fprintf(stderr, "can not write: %s\n", logpath.c_str());
+    }
+}
+
+static std::string abspath(const std::string &path) {
+    if (startsWith(path, "/")) return path;
+    char buf[4096];
+    if (!getcwd(buf, sizeof (buf))) return path;
+    return std::string(buf) + "/" + path;
+}
+
+// the host path that convpath() resolves: a rooted path that falls back to
+// the host also depends on the root missing it
+static std::string resolve(const std::string &path) {
+    if (path.empty()) return path;
+    std::string p = convpath(path);
+    const std::string &root = ctx->rootpath;
+    if (!root.empty() && startsWith(path, "/") && p != root + path) {
+        logrec("M " + abspath(root + path) + "\n");
+    }
+    return abspath(p);
+}
+
+uint64_t memo_key(const std::string &image, const std::vector<std::string> &args,
+        const std::vector<std::string> &envs, const std::string &mode) {
+    std::string s = "7run memo 1\n" + mode + "\n";
+    uint64_t h = 0;
+    filehash(convpath(image), &h);
+    s += hex64(h) + "\n" + abspath(".") + "\n" + ctx->rootpath + "\n";
+    for (int fd = 0; fd < 3; fd++) s += isatty(fd) ? "t" : "-";
+    for (int i = 0; i < (int) args.size(); i++) s += "\n" + args[i];
+    s += "\n";
+    for (int i = 0; i < (int) envs.size(); i++) s += "\n" + envs[i];
+    return memohash(s.data(), s.size());
+}
+
+int memo_pid(int ppid, int n) {
+    uint64_t h = memohash(&ppid, sizeof (ppid), memokey);
+    return memohash(&n, sizeof (n), h) % 30000 + 1;
+}
+
+int memo_time() {
+    const char *epoch = getenv("SOURCE_DATE_EPOCH");
+    if (epoch) return strtol(epoch, NULL, 10);
+    memo_taint("time");
+    return time(NULL);
+}
+
+void memo_read(const std::string &path, bool ok) {
+    std::string p = resolve(path);
+    uint64_t h = 0;
+    if (!ok) {
+        logrec("M " + p + "\n");
+    } else {
+        filehash(p, &h);
+        logrec("R " + hex64(h) + " " + p + "\n");
+    }
+}
+
+// directory sizes depend on the host file system
+void memo_stat(const std::string &path, bool ok) {
+    std::string p = resolve(path);
+    struct stat st;
+    if (!ok) {
+        logrec("M " + p + "\n");
+    } else if (!stat(p.c_str(), &st)) {
+        char buf[64];
+        snprintf(buf, sizeof (buf), "S %o %lld ", unsigned(st.st_mode),
+                S_ISDIR(st.st_mode) ? 0ll : (long long) st.st_size);
+        logrec(buf + p + "\n");
+    }
+}
+
+void memo_write(const std::string &path) {
+    logrec("W " + resolve(path) + "\n");
+}
+
+void memo_link(const std::string &src, const std::string &dst, bool ok) {
+    memo_read(src, ok);
+    if (ok) memo_write(dst);
+}
+
+void memo_unlink(const std::string &path) {
+    logrec("U " + resolve(path) + "\n");
+}
+
+void memo_output(int fd, const void *buf, int len) {
+    if (len <= 0) return;
+    char head[32];
+    snprintf(head, sizeof (head), "O %d %d\n", fd, len);
+    logrec(head + std::string((const char *) buf, len));
+}
+
+void memo_taint(const char *why) {
+    logrec(std::string("X ") + why + "\n");
+}
+
+// the log is kept in the memo directory, or next to the dependency file.
+// the paths are absolute: chdir() of the guest moves the host
+bool memo_begin(uint64_t key) {
+    if (!memodir.empty()) {
+        memodir = abspath(memodir);
+#ifdef WIN32
+        mkdir(memodir.c_str());
+#else
+        mkdir(memodir.c_str(), 0777); // EEXIST: fine
+#endif
+    }
+    if (!depspath.empty()) depspath = abspath(depspath);
+    memokey = key;
+    char buf[16];
+    snprintf(buf, sizeof (buf), ".%d.log", getpid());
+    logpath = (memodir.empty() ? depspath : memodir + "/" + hex64(key)) + buf;
+    int flag = O_WRONLY | O_CREAT | O_TRUNC | O_APPEND;
+#ifdef WIN32
+    flag |= O_BINARY;
+#endif
+    logfd = open(logpath.c_str(), flag, 0666);
+    if (logfd == -1) {
+        fprintf(stderr, "can not open: %s\n", logpath.c_str());
+        return false;
+    }
+    memolog = true;
+    memo = !memodir.empty();
+    return true;
+}
+
+// the state of a path before the run first wrote it
+struct MemoInput {
+    char type; // R, S or M
+    std::string value;
+};
+
+struct MemoLog {
+    std::vector<std::string> inorder, outorder;
+    std::map<std::string, MemoInput> inputs;
+    std::vector<std::pair<int, std::string> > streams;
+    std::string taint;
+};
+
+static void parselog(const std::string &log, MemoLog *ml) {
+    std::set<std::string> outputs;
+    size_t pos = 0;
+    while (pos < log.size()) {
+        size_t nl = log.find('\n', pos);
+        if (nl == std::string::npos) break;
+        std::string line = log.substr(pos, nl - pos);
+        pos = nl + 1;
+        char type = line[0];
+        if (type == 'X') {
+            if (ml->taint.empty()) ml->taint = line.substr(2);
+            continue;
+        }
+        if (type == 'O') {
+            int fd = 0, len = 0;
+            sscanf(line.c_str(), "O %d %d", &fd, &len);
+            std::vector<std::pair<int, std::string> > &ss = ml->streams;
+            if (!ss.empty() && ss.back().first == fd) {
+                ss.back().second += log.substr(pos, len);
+            } else {
+                ss.push_back(std::make_pair(fd, log.substr(pos, len)));
+            }
+            pos += len;
+            continue;
+        }
+        // R hash path, S mode size path, M path, W path, U path
+        size_t sp = type == 'R' ? line.find(' ', 2) : type == 'S'
+                ? line.find(' ', line.find(' ', 2) + 1) : 1;
+        std::string path = line.substr(sp + 1);
+        std::string value = sp > 1 ? line.substr(2, sp - 2) : "";
+        if (outputs.count(path)) continue;
+        if (type == 'W' || type == 'U') {
+            outputs.insert(path);
+            ml->outorder.push_back(path);
+            continue;
+        }
+        std::map<std::string, MemoInput>::iterator it = ml->inputs.find(path);
+        if (it == ml->inputs.end()) {
+            MemoInput in = {type, value};
+            ml->inputs[path] = in;
+            ml->inorder.push_back(path);
+        } else if (it->second.type == type ? it->second.value != value
+                : it->second.type == 'M' || type == 'M') {
+            if (ml->taint.empty()) ml->taint = "changed " + path;
+        } else if (type == 'R') {
+            // stat, then read
+            it->second.type = type;
+            it->second.value = value;
+        }
+    }
+}
+
+static std::string makeescape(const std::string &path) {
+    std::string ret;
+    for (int i = 0; i < (int) path.size(); i++) {
+        char ch = path[i];
+        if (ch == '$') {
+            ret += '$';
+        } else if (ch == ' ' || ch == '#' || ch == '\\') {
+            ret += '\\';
+        }
+        ret += ch;
+    }
+    return ret;
+}
+
+static std::string jsonstr(const std::string &s) {
+    std::string ret = "\"";
+    for (int i = 0; i < (int) s.size(); i++) {
+        unsigned char ch = s[i];
+        if (ch == '"' || ch == '\\') {
+            ret += '\\';
+            ret += ch;
+        } else if (ch < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof (buf), "\\u%04x", ch);
+            ret += buf;
+        } else {
+            ret += ch;
+        }
+    }
+    return ret + "\"";
+}
+
+static void jsonlist(std::string *json, const char *name,
+        const std::vector<std::string> &paths, bool last) {
+    *json += std::string("  \"") + name + "\": [";
+    for (int i = 0; i < (int) paths.size(); i++) {
+        *json += (i ? ",\n    " : "\n    ") + jsonstr(paths[i]);
+    }
+    *json += paths.empty() ? "]" : "\n  ]";
+    *json += last ? "\n" : ",\n";
+}
+
+// --deps file: a make rule from the written files that remain to the files
+// read, with empty rules for the prerequisites like gcc -MP; file.json lists
+// every class of access
+static void deps_write(const MemoLog &ml) {
+    std::vector<std::string> cls[5]; // read, stat, missing, written, removed
+    std::set<std::string> targets;
+    for (int i = 0; i < (int) ml.outorder.size(); i++) {
+        const std::string &path = ml.outorder[i];
+        struct stat st;
+        bool exists = !stat(path.c_str(), &st);
+        cls[exists ? 3 : 4].push_back(path);
+        if (exists) targets.insert(path);
+    }
+    for (int i = 0; i < (int) ml.inorder.size(); i++) {
+        const std::string &path = ml.inorder[i];
+        char type = ml.inputs.find(path)->second.type;
+        cls[type == 'R' ? 0 : type == 'S' ? 1 : 2].push_back(path);
+    }
+    std::string d, prereqs;
+    for (int i = 0; i < (int) cls[3].size(); i++) {
+        d += (i ? " " : "") + makeescape(cls[3][i]);
+    }
+    if (cls[3].empty()) d = makeescape(depspath);
+    d += ":";
+    for (int i = 0; i < (int) cls[0].size(); i++) {
+        if (targets.count(cls[0][i])) continue;
+        std::string p = makeescape(cls[0][i]);
+        d += " \\\n " + p;
+        prereqs += "\n" + p + ":\n";
+    }
+    d += "\n" + prereqs;
+    std::string json = "{\n";
+    jsonlist(&json, "read", cls[0], false);
+    jsonlist(&json, "stat", cls[1], false);
+    jsonlist(&json, "missing", cls[2], false);
+    jsonlist(&json, "written", cls[3], false);
+    jsonlist(&json, "removed", cls[4], true);
+    json += "}\n";
+    if (!writefile(depspath, d) || !writefile(depspath + ".json", json)) {
+        fprintf(stderr, "can not write: %s\n", depspath.c_str());
+    }
+}
+
+void memo_end(int exitcode) {
+    if (logfd == -1) return;
+    close(logfd);
+    logfd = -1;
+    std::string log;
+    bool ok = readfile(logpath, &log);
+    unlink(logpath.c_str());
+    if (!ok) return;
+    MemoLog ml;
+    parselog(log, &ml);
+    if (!depspath.empty()) deps_write(ml);
+    if (!memo) return;
+    if (!ml.taint.empty()) {
+        if (ctx->trace) fprintf(stderr, "<memo: not stored: %s>\n", ml.taint.c_str());
+        return;
+    }
+    std::string in = "7RUNMEMO1\n", out;
+    for (int i = 0; i < (int) ml.inorder.size(); i++) {
+        const MemoInput &mi = ml.inputs[ml.inorder[i]];
+        in += std::string("I ") + mi.type + " ";
+        if (mi.type != 'M') in += mi.value + " ";
+        in += ml.inorder[i] + "\n";
+    }
+    for (int i = 0; i < (int) ml.outorder.size(); i++) {
+        const std::string &path = ml.outorder[i];
+        struct stat st;
+        std::string s;
+        uint64_t h;
+        if (stat(path.c_str(), &st)) {
+            out += "D " + path + "\n";
+        } else if (S_ISREG(st.st_mode)) {
+            if (!readfile(path, &s) || !putblob(s, &h)) return;
+            char buf[16];
+            snprintf(buf, sizeof (buf), " %o ", unsigned(st.st_mode & 07777));
+            out += "F " + hex64(h) + buf + path + "\n";
+        }
+    }
+    for (int i = 0; i < (int) ml.streams.size(); i++) {
+        uint64_t h;
+        if (!putblob(ml.streams[i].second, &h)) return;
+        char buf[16];
+        snprintf(buf, sizeof (buf), "O %d ", ml.streams[i].first);
+        out += buf + hex64(h) + "\n";
+    }
+    char buf[16];
+    snprintf(buf, sizeof (buf), "E %d\n", exitcode);
+    out += buf;
+    std::string id = hex64(memohash(in.data(), in.size()));
+    std::string path = memodir + "/" + hex64(memokey) + "-" + id + ".memo";
+    struct stat st;
+    bool found = !stat(path.c_str(), &st);
+    if (!writefile(path, in + out)) return;
+    if (ctx->trace) fprintf(stderr, "<memo: stored %s>\n", path.c_str());
+    if (found) return;
+    FILE *f = fopen((memodir + "/" + hex64(memokey) + ".idx").c_str(), "a");
+    if (f) {
+        fprintf(f, "%s\n", id.c_str());
+        fclose(f);
+    }
+}
+
+static bool splitline(const std::string &s, size_t *pos, std::string *line) {
+    if (*pos >= s.size()) return false;
+    size_t nl = s.find('\n', *pos);
+    if (nl == std::string::npos) nl = s.size();
+    *line = s.substr(*pos, nl - *pos);
+    *pos = nl + 1;
+    return true;
+}
+
+static bool checkinput(const std::string &line) {
+    char type = line[2];
+    struct stat st;
+    if (type == 'M') return stat(line.c_str() + 4, &st) != 0;
+    size_t sp = line.find(' ', 4);
+    if (type == 'S') sp = line.find(' ', sp + 1);
+    if (sp == std::string::npos) return false;
+    std::string path = line.substr(sp + 1), value = line.substr(4, sp - 4);
+    if (type == 'R') {
+        uint64_t h;
+        return filehash(path, &h) && hex64(h) == value;
+    }
+    if (stat(path.c_str(), &st)) return false;
+    char buf[64];
+    snprintf(buf, sizeof (buf), "%o %lld", unsigned(st.st_mode),
+            S_ISDIR(st.st_mode) ? 0ll : (long long) st.st_size);
+    return value == buf;
+}
+
+// the outputs are read before any is written
+static bool replay(const std::string &entry, int *exitcode) {
+    std::string s, line;
+    size_t pos = 0;
+    if (!readfile(entry, &s) || !splitline(s, &pos, &line) || line != "7RUNMEMO1") {
+        return false;
+    }
+    std::vector<std::string> lines, blobs;
+    std::string log; // the entry as log records for --deps
+    while (splitline(s, &pos, &line)) {
+        if (line.size() < 3) return false;
+        if (line[0] == 'I') {
+            if (!checkinput(line)) return false;
+            log += line.substr(2) + "\n";
+            continue;
+        }
+        if (line[0] == 'F') {
+            log += "W " + line.substr(line.find(' ', 19) + 1) + "\n";
+        } else if (line[0] == 'D') {
+            log += "U " + line.substr(2) + "\n";
+        }
+        std::string blob;
+        if (line[0] == 'F' || line[0] == 'O') {
+            size_t sp = line.find(' ', 2);
+            std::string h = line.substr(line[0] == 'F' ? 2 : sp + 1, 16);
+            if (!readfile(memodir + "/" + h + ".blob", &blob)) return false;
+        }
+        lines.push_back(line);
+        blobs.push_back(blob);
+    }
+    for (int i = 0; i < (int) lines.size(); i++) {
+        const std::string &l = lines[i], &b = blobs[i];
+        if (l[0] == 'F') {
+            size_t sp = l.find(' ', 19);
+            std::string path = l.substr(sp + 1);
+            int mode = strtol(l.c_str() + 19, NULL, 8);
+            int flag = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef WIN32
+            flag |= O_BINARY;
+#endif
+            int fd = open(path.c_str(), flag, mode);
+            if (fd == -1 || write(fd, b.data(), b.size()) != (int) b.size()) {
+                fprintf(stderr, "can not write: %s\n", path.c_str());
+            }
+            if (fd != -1) close(fd);
+            chmod(path.c_str(), mode);
+        } else if (l[0] == 'D') {
+            unlink(l.c_str() + 2);
+        } else if (l[0] == 'O') {
+            int fd = atoi(l.c_str() + 2);
+            if (write(fd, b.data(), b.size()) != (int) b.size()) break;
+        } else if (l[0] == 'E') {
+            *exitcode = atoi(l.c_str() + 2);
+        }
+    }
+    if (!depspath.empty()) {
+        MemoLog ml;
+        parselog(log, &ml);
+        deps_write(ml);
+    }
+    clearcache();
+    return true;
+}
+
+// the latest entries are tried first
+bool memo_replay(uint64_t key, int *exitcode) {
+    std::string idx, line;
+    if (!readfile(memodir + "/" + hex64(key) + ".idx", &idx)) return false;
+    std::vector<std::string> ids;
+    size_t pos = 0;
+    while (splitline(idx, &pos, &line)) ids.push_back(line);
+    for (int i = ids.size() - 1; i >= 0; i--) {
+        std::string entry = memodir + "/" + hex64(key) + "-" + ids[i] + ".memo";
+        if (replay(entry, exitcode)) {
+            if (ctx->trace) fprintf(stderr, "<memo: replayed %s>\n", entry.c_str());
+            return true;
+        }
+    }
+    return false;
+}
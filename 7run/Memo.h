@@ -0,0 +1,41 @@
+#pragma once
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// build output cache (--memo dir): a run is keyed by the image, arguments
+// and host directory; every process of the run appends the host paths it
+// reads, stats, misses, writes and removes and its stdout/stderr to a log
+// shared across fork and exec. at the exit of the first process the log
+// becomes an entry in dir: the inputs (content hashes, stat results and
+// misses) and the outputs (files as content-addressed blobs, removals,
+// streams and the exit code). a later run with the same key replays the
+// first entry whose inputs still match without running the image.
+//
+// guest pids are derived from the key, time() returns $SOURCE_DATE_EPOCH.
+// a run that reads the clock without it, reads stdin or is killed is not
+// stored.
+//
+// --deps file uses the same log without storing anything: at exit (or
+// replay) the host paths are written as a make rule to file and classified
+// as read, stat, missing, written and removed in file.json.
+
+extern std::string memodir, depspath;
+extern bool memo, memolog; // outputs stored, accesses logged
+
+uint64_t memohash(const void *p, size_t len, uint64_t h = 14695981039346656037ull);
+uint64_t memo_key(const std::string &image, const std::vector<std::string> &args,
+        const std::vector<std::string> &envs, const std::string &mode);
+bool memo_replay(uint64_t key, int *exitcode);
+bool memo_begin(uint64_t key); // false: no log
+void memo_end(int exitcode);
+int memo_pid(int ppid, int n);
+int memo_time();
+
+void memo_read(const std::string &path, bool ok);
+void memo_stat(const std::string &path, bool ok);
+void memo_write(const std::string &path);
+void memo_link(const std::string &src, const std::string &dst, bool ok);
+void memo_unlink(const std::string &path);
+void memo_output(int fd, const void *buf, int len);
+void memo_taint(const char *why);
@@ -1,5 +1,6 @@
 #include "OS.h"
 #include "../i8086/regs.h"
+#include "../Aot.h"
 #include <string.h>
 
 using namespace Minix2;
@@ -23,6 +24,15 @@ void OS::disasm() {
     vm->disasm();
 }
 
+int OS::hletest() {
+    return cpu.hletest();
+}
+
+int OS::aotgen(FILE *f, const std::string &name) {
+    cpu.aotgen(f, name, 0, vm->tsize);
+    return 0;
+}
+
 void OS::setArgs(
         const std::vector<std::string> &args,
         const std::vector<std::string> &envs) {
@@ -52,6 +62,24 @@ void OS::setArgs(
     vm->write16(ad2 += 2, 0); // envp (last)
 }
 
+std::string OS::snapname() {
+    return "minix2";
+}
+
+void OS::getsnap(SnapHeader *h) {
+    cpu.getstate(h->state);
+    h->sp = 4;
+    h->pc = 8;
+    h->start_sp = cpu.start_sp;
+    memcpy(h->sigs, sigacts, sizeof (sigacts));
+}
+
+void OS::setsnap(const SnapHeader *h) {
+    cpu.setstate(h->state);
+    cpu.start_sp = h->start_sp;
+    memcpy(sigacts, h->sigs, sizeof (sigacts));
+}
+
 bool OS::load2(const std::string &fn, FILE *f, size_t size) {
     uint8_t h[0x20];
     if (!fread(h, sizeof (h), 1, f) || !(h[0] == 1 && h[1] == 3)) {
@@ -80,6 +108,8 @@ bool OS::load2(const std::string &fn, FILE *f, size_t size) {
         fread(vm->text, 1, vm->tsize + vm->dsize, f);
         vm->brksize = vm->tsize + vm->dsize + bss;
     }
+    cpu.hlescan();
+    vm->aot = aotfind(vm->text, 0, vm->tsize);
     return true;
 }
 
@@ -14,6 +14,8 @@ namespace Minix2 {
         virtual ~OS();
 
         virtual void disasm();
+        virtual int hletest();
+        virtual int aotgen(FILE *f, const std::string &name);
         virtual bool syscall(int n);
 
     protected:
@@ -21,6 +23,9 @@ namespace Minix2 {
                 const std::vector<std::string> &args,
                 const std::vector<std::string> &envs);
         virtual bool load2(const std::string &fn, FILE *f, size_t size);
+        virtual std::string snapname();
+        virtual void getsnap(SnapHeader *h);
+        virtual void setsnap(const SnapHeader *h);
         virtual void setsig(int sig, int h);
         virtual void setstat(uint16_t addr, struct stat *st);
         virtual void swtch(bool reset = false);
@@ -33,8 +38,8 @@ namespace Minix2 {
         int minix_exec(const char *path, int frame, int fsize); // 59
         int minix_sigaction(int sig, int act, int oact); // 71
 
-        static void sighandler(int sig);
-        void sighandler2(int sig);
+        virtual void sighandler2(int sig);
+        virtual void sigreturn();
         virtual int convsig(int sig);
         void resetsig();
 
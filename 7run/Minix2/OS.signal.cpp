@@ -15,30 +15,25 @@
 
 using namespace Minix2;
 
-void OS::sighandler(int sig) {
-    OS *cur = dynamic_cast<OS *> (current);
-    if (cur) cur->sighandler2(sig);
-}
-
+// the handler returns with ret to the interrupted instruction
 void OS::sighandler2(int sig) {
-    uint16_t ip = cpu.IP, r[8];
-    memcpy(r, cpu.r, sizeof (r));
-    bool OF = cpu.OF, DF = cpu.DF, SF = cpu.SF;
-    bool ZF = cpu.ZF, AF = cpu.AF, PF = cpu.PF, CF = cpu.CF;
-    cpu.write16((cpu.SP -= 2), ip);
+    if (sig >= nsig || sigacts[sig].handler <= MX_SIG_IGN) return;
+    SigFrame f;
+    f.pc = cpu.IP;
+    f.sp = cpu.SP;
+    cpu.getstate(f.st);
+    sigframes.push_back(f);
+    cpu.write16((cpu.SP -= 2), cpu.IP);
     cpu.IP = sigacts[sig].handler;
-    while (!cpu.hasExited && !(cpu.IP == ip && cpu.SP == SP)) {
-        cpu.run1();
-    }
-    if (!cpu.hasExited) {
-        memcpy(cpu.r, r, sizeof (r));
-        cpu.OF = OF;
-        cpu.DF = DF;
-        cpu.SF = SF;
-        cpu.ZF = ZF;
-        cpu.AF = AF;
-        cpu.PF = PF;
-        cpu.CF = CF;
+}
+
+// a handler has ended when the stack pointer is back at its frame: at the
+// interrupted instruction it has returned, anywhere else it was a longjmp
+void OS::sigreturn() {
+    while (!sigframes.empty() && cpu.SP >= sigframes.back().sp) {
+        const SigFrame &f = sigframes.back();
+        if (cpu.IP == f.pc && cpu.SP == f.sp) cpu.setstate(f.st);
+        sigframes.pop_back();
     }
 }
 
@@ -53,7 +48,7 @@ int OS::convsig(int sig) {
 }
 
 int OS::minix_signal(int sig, int h) { // 48
-    if (trace) fprintf(stderr, "<signal(%d, 0x%04x)>\n", sig, h);
+    if (ctx->trace) fprintf(stderr, "<signal(%d, 0x%04x)>\n", sig, h);
     int s = convsig(sig);
     if (s < 0) {
         errno = EINVAL;
@@ -67,7 +62,7 @@ int OS::minix_signal(int sig, int h) { // 48
 }
 
 int OS::minix_sigaction(int sig, int act, int oact) { // 71
-    if (trace) fprintf(stderr, "<sigaction(%d, 0x%04x, 0x%04x)>\n", sig, act, oact);
+    if (ctx->trace) fprintf(stderr, "<sigaction(%d, 0x%04x, 0x%04x)>\n", sig, act, oact);
     int s = convsig(sig);
     if (s < 0) {
         errno = EINVAL;
@@ -94,6 +89,7 @@ void OS::setsig(int sig, int h) {
 }
 
 void OS::resetsig() {
+    sigframes.clear();
     for (int i = 0; i < nsig; i++) {
         switch (sigacts[i].handler) {
             case MX_SIG_DFL:
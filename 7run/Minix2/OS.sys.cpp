@@ -1,5 +1,6 @@
 #include "OS.h"
 #include "../i8086/regs.h"
+#include "../MemFS.h"
 #include <string.h>
 #include <errno.h>
 #include <unistd.h>
@@ -8,17 +9,31 @@ using namespace Minix2;
 
 bool OS::syscall(int n) {
     if (n != 0x20) return false;
+#ifdef NO_FORK
+    if (vforked && !vforksafe(vm->read16(cpu.BX + 2))) {
+        cpu.IP -= 2;
+        return vforkstop();
+    }
+#endif
     int result;
-    if (syscall(&result, vm->data + cpu.BX)) {
+    bool ret = syscall(&result, vm->data + cpu.BX);
+    sysend(result);
+    if (ret) {
         vm->write16(cpu.BX + 2, result == -1 ? -errno : result);
         cpu.AX = 0;
     }
+#ifdef NO_FORK
+    if (vforked && !vm->shared) vforkstop();
+#endif
     return true;
 }
 
 bool OS::syscall(int *result, uint8_t *m) {
     *result = 0;
     int n = read16(m + 2);
+    if (statsmode) ++vm->stats.syscalls[n];
+    int a[] = {read16(m + 4), read16(m + 6), read16(m + 8), read16(m + 10)};
+    sysbegin(SYSTRACE_MINIX, n, a);
     switch (n) {
         case 1:
             sys_exit((int16_t) read16(m + 4));
@@ -237,13 +252,16 @@ int OS::minix_fork() { // 2
     OS *ub = new OS(*this);
     ub->cpu.write16(cpu.BX + 2, 0);
     ub->cpu.AX = 0;
-    forks.push_back(ub);
+    vfork(ub, cpu.SP);
     int result = ub->pid;
 #else
+    memfs_sync();
+    BufFile::flushall();
     int result = fork();
-    if (result > 0) result = (result % 30000) + 1;
+    if (result > 0) result = childpid(result);
+    if (result == 0) forkchild();
 #endif
-    if (trace) fprintf(stderr, "<fork() => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, "<fork() => %d>\n", result);
     return result;
 }
 
@@ -260,7 +278,7 @@ int OS::minix_exec(const char *path, int frame, int fsize) { // 59
     std::vector<uint8_t> f(fsize);
     memcpy(&f[0], vm->data + frame, fsize);
     int argc = read16(&f[0]);
-    if (trace) {
+    if (ctx->trace) {
         fprintf(stderr, "<exec(\"%s\"", path);
         for (int i = 2; i <= argc; i++) {
             fprintf(stderr, ", \"%s\"", &f[read16(&f[i * 2])]);
@@ -280,5 +298,6 @@ int OS::minix_exec(const char *path, int frame, int fsize) { // 59
             vm->write16(ad, cpu.start_sp + p);
         }
     }
+    snaprestore();
     return 0;
 }
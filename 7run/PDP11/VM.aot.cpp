@@ -0,0 +1,840 @@
+#include "VM.h"
+#include "../Aot.h"
+#include "disasm.h"
+#include "regs.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <set>
+
+using namespace PDP11;
+
+// 7aot: the text as C++ on the state of PDP11::VM (see aot.h) with a label
+// for each basic block found by recursive disassembly. the instructions
+// run1() does not implement, the system calls and the code not found at
+// translation are left to the interpreter. the generated code mirrors
+// run1() statement by statement, flags that are overwritten in the same
+// block are not computed.
+
+namespace {
+    enum Flow {
+        CONT, // to the next instruction
+        GOTO, // to target
+        COND, // to target if cond, else to the next instruction
+        JUMP, // to the address in jump
+        INTERP // run1()
+    };
+
+    enum {
+        FZ = 1, FN = 2, FC = 4, FV = 8, FALL = 15
+    };
+
+    enum {
+        OREG, OPC, OCONST, OMEM
+    };
+
+    struct Insn {
+        Flow flow;
+        int count, reads, kills, target, ret;
+        std::string code, flags[4], cond, jump;
+
+        Insn() : flow(CONT), count(1), reads(0), kills(0), target(-1), ret(-1) {
+        }
+
+        int writes() const {
+            int ret = 0;
+            for (int i = 0; i < 4; i++) {
+                if (!flags[i].empty()) ret |= 1 << i;
+            }
+            return ret;
+        }
+    };
+}
+
+static std::string fmt(const char *f, ...) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, f);
+    vsnprintf(buf, sizeof (buf), f, ap);
+    va_end(ap);
+    return buf;
+}
+
+// emits the address of o with the side effects of addr() into var
+static int opr(std::string &s, const Operand &o, const char *var) {
+    if (o.reg == 7) {
+        switch (o.mode) {
+            case 0: return OPC;
+            case 3:
+            case 6:
+                s += fmt("%s = 0x%04x;\n", var, o.value & 0xffff);
+                return OMEM;
+            case 7:
+                s += fmt("%s = RD16(0x%04x);\n", var, o.value & 0xffff);
+                return OMEM;
+        }
+        return OCONST;
+    }
+    int n = o.reg, d = o.diff();
+    switch (o.mode) {
+        case 0: return OREG;
+        case 1: s += fmt("%s = r[%d];\n", var, n);
+            break;
+        case 2: s += fmt("%s = r[%d];\nr[%d] += %d;\n", var, n, n, d);
+            break;
+        case 3: s += fmt("%s = RD16(r[%d]);\nr[%d] += 2;\n", var, n, n);
+            break;
+        case 4: s += fmt("r[%d] -= %d;\n%s = r[%d];\n", n, d, var, n);
+            break;
+        case 5: s += fmt("r[%d] -= 2;\n%s = RD16(r[%d]);\n", n, var, n);
+            break;
+        case 6: s += fmt("%s = uint16_t(r[%d] + %d);\n", var, n, o.value);
+            break;
+        case 7: s += fmt("%s = RD16(r[%d] + %d);\n", var, n, o.value);
+            break;
+    }
+    return OMEM;
+}
+
+// get16() or get8() of an operand after opr()
+static std::string get(int k, const Operand &o, bool byte, const char *var) {
+    switch (k) {
+        case OREG: return fmt(byte ? "uint8_t(r[%d])" : "r[%d]", o.reg);
+        case OMEM: return fmt(byte ? "RD8(%s)" : "RD16(%s)", var);
+    }
+    return byte ? fmt("uint8_t(0x%02x)", o.value & 0xff)
+            : fmt("uint16_t(0x%04x)", o.value & 0xffff);
+}
+
+// set16() or set8() after opr(), false: a write to pc
+static bool set(std::string &s, int k, const Operand &o, bool byte,
+        const char *var, const char *v, bool sx = false) {
+    switch (k) {
+        case OPC: return false;
+        case OREG:
+            if (!byte) {
+                s += fmt("r[%d] = %s;\n", o.reg, v);
+            } else if (sx) {
+                s += fmt("r[%d] = int16_t(int8_t(%s));\n", o.reg, v);
+            } else {
+                s += fmt("r[%d] = (r[%d] & 0xff00) | uint8_t(%s);\n", o.reg, o.reg, v);
+            }
+            break;
+        case OMEM:
+            s += fmt(byte ? "WR8(%s, %s);\n" : "WR16(%s, %s);\n", var, v);
+            break;
+    }
+    return true;
+}
+
+static void flags(Insn &in, const char *z, const char *n, const char *c, const char *v) {
+    const char *fs[] = {z, n, c, v};
+    for (int i = 0; i < 4; i++) {
+        if (fs[i]) in.flags[i] = fs[i];
+    }
+}
+
+static void branch(Insn &in, const OpCode &op, const char *cond, int reads) {
+    in.flow = cond ? COND : GOTO;
+    if (cond) in.cond = cond;
+    in.target = op.opr1.value & 0xffff;
+    in.reads = reads;
+}
+
+// single operand: the read-modify-write of run1() on one address
+static bool rmw(Insn &in, const OpCode &op, bool byte, const char *calc, const char *v) {
+    std::string &s = in.code;
+    int k = opr(s, op.opr1, "a");
+    s += fmt(calc, get(k, op.opr1, byte, "a").c_str());
+    return set(s, k, op.opr1, byte, "a", v);
+}
+
+// double operand: src from opr1, the address of opr2 in b, its kind
+static int srcdst(Insn &in, const OpCode &op, bool byte, bool dst) {
+    std::string &s = in.code;
+    int k1 = opr(s, op.opr1, "a");
+    s += "src = " + get(k1, op.opr1, byte, "a") + ";\n";
+    int k2 = opr(s, op.opr2, "b");
+    if (dst) s += "dst = " + get(k2, op.opr2, byte, "b") + ";\n";
+    return k2;
+}
+
+static void csvcode(VM *vm, std::string &s, int &kills) {
+    s += "r[0] = r[5];\nr[5] = r[6];\n";
+    s += "r[6] -= 2;\nWR16(r[6], r[4]);\n";
+    s += "r[6] -= 2;\nWR16(r[6], r[3]);\n";
+    s += "r[6] -= 2;\nWR16(r[6], r[2]);\n";
+    if (vm->csvver == 6) {
+        s += "r[6] -= 2;\nval = RD16(r[6]);\n";
+        s += "Z = val == 0;\nN = int16_t(val) < 0;\nC = false;\nV = false;\n";
+        kills = FALL;
+    } else {
+        s += "Z = r[2] == 0;\nN = int16_t(r[2]) < 0;\nV = false;\n";
+        s += fmt("r[6] -= 2;\nWR16(r[6], 0x%04x);\n", vm->csv + 12);
+        kills = FZ | FN | FV;
+    }
+}
+
+// leaves the return address in b
+static void cretcode(VM *vm, std::string &s, int &kills) {
+    s += fmt("r[%d] = r[5] - 6;\n", vm->cretver == 6 ? 1 : 2);
+    s += "r[4] = RD16(r[5] - 2);\nr[3] = RD16(r[5] - 4);\nr[2] = RD16(r[5] - 6);\n";
+    s += "r[6] = r[5];\nr[5] = RD16(r[6]);\nr[6] += 2;\n";
+    s += "Z = r[5] == 0;\nN = int16_t(r[5]) < 0;\nV = false;\n";
+    s += "b = RD16(r[6]);\nr[6] += 2;\n";
+    kills = FZ | FN | FV;
+}
+
+static bool direct(const Operand &o) {
+    return o.reg == 7 && (o.mode == 3 || o.mode == 6);
+}
+
+// one instruction of run1(), false: left to the interpreter
+static bool insn(VM *vm, Insn &in, const OpCode &op, uint16_t pc) {
+    uint16_t w = ::read16(vm->text + pc), next = pc + op.len;
+    std::string &s = in.code;
+    const Operand &o1 = op.opr1, &o2 = op.opr2;
+    int k;
+    switch (w >> 12) {
+        case 000:
+            switch ((w >> 6) & 077) {
+                case 001: // jmp
+                    if (o1.mode == 0 || opr(s, o1, "a") != OMEM) return false;
+                    if (!direct(o1)) {
+                        in.flow = JUMP;
+                        in.jump = "a";
+                    } else if ((o1.value & 0xffff) == vm->cret) {
+                        cretcode(vm, s, in.kills);
+                        in.count = 2;
+                        in.flow = JUMP;
+                        in.jump = "b";
+                    } else {
+                        in.flow = GOTO;
+                        in.target = o1.value & 0xffff;
+                    }
+                    return true;
+                case 002:
+                    switch ((w >> 3) & 7) {
+                        case 0: // rts
+                            if ((w & 7) == 7) {
+                                s += "b = RD16(r[6]);\nr[6] += 2;\n";
+                            } else {
+                                s += fmt("b = r[%d];\nr[%d] = RD16(r[6]);\nr[6] += 2;\n",
+                                        w & 7, w & 7);
+                            }
+                            in.flow = JUMP;
+                            in.jump = "b";
+                            return true;
+                        case 4:
+                        case 5:
+                        case 6:
+                        case 7:
+                        {
+                            // nop/cl*/se*/ccc/scc
+                            const char *f = w & 16 ? "true" : "false";
+                            flags(in, w & 4 ? f : NULL, w & 8 ? f : NULL,
+                                    w & 1 ? f : NULL, w & 2 ? f : NULL);
+                            return true;
+                        }
+                    }
+                    return false;
+                case 003: // swab
+                    if (!rmw(in, op, false,
+                            "src = %s;\nval = ((src & 0xff) << 8) | ((src >> 8) & 0xff);\n",
+                            "val")) return false;
+                    flags(in, "val == 0", "(val & 0x8000) != 0", "false", "false");
+                    return true;
+                case 004: case 005: case 006: case 007: // br
+                    branch(in, op, NULL, 0);
+                    return true;
+                case 010: case 011: case 012: case 013: // bne
+                    branch(in, op, "!Z", FZ);
+                    return true;
+                case 014: case 015: case 016: case 017: // beq
+                    branch(in, op, "Z", FZ);
+                    return true;
+                case 020: case 021: case 022: case 023: // bge
+                    branch(in, op, "!(N ^ V)", FN | FV);
+                    return true;
+                case 024: case 025: case 026: case 027: // blt
+                    branch(in, op, "N ^ V", FN | FV);
+                    return true;
+                case 030: case 031: case 032: case 033: // bgt
+                    branch(in, op, "!(Z || (N ^ V))", FZ | FN | FV);
+                    return true;
+                case 034: case 035: case 036: case 037: // ble
+                    branch(in, op, "Z || (N ^ V)", FZ | FN | FV);
+                    return true;
+                case 040: case 041: case 042: case 043:
+                case 044: case 045: case 046: case 047: // jsr
+                {
+                    int n = o1.reg;
+                    if (n == 6 || o2.mode == 0 || opr(s, o2, "a") != OMEM) return false;
+                    if (n == 7) {
+                        s += fmt("r[6] -= 2;\nWR16(r[6], 0x%04x);\n", next);
+                    } else {
+                        s += fmt("r[6] -= 2;\nWR16(r[6], r[%d]);\nr[%d] = 0x%04x;\n",
+                                n, n, next);
+                    }
+                    if (!direct(o2)) {
+                        in.flow = JUMP;
+                        in.jump = "a";
+                    } else if ((o2.value & 0xffff) == vm->csv && n == 5) {
+                        // the prologue returns to the next instruction
+                        csvcode(vm, s, in.kills);
+                        in.count = 2;
+                        return true;
+                    } else {
+                        in.flow = GOTO;
+                        in.target = o2.value & 0xffff;
+                    }
+                    in.ret = next;
+                    return true;
+                }
+                case 050: // clr
+                    k = opr(s, o1, "a");
+                    if (!set(s, k, o1, false, "a", "0")) return false;
+                    flags(in, "true", "false", "false", "false");
+                    return true;
+                case 051: // com
+                    if (!rmw(in, op, false, "val = ~int(%s);\n", "val")) return false;
+                    flags(in, "val == 0", "(val & 0x8000) != 0", "true", "false");
+                    return true;
+                case 052: // inc
+                    if (!rmw(in, op, false, "val = int(int16_t(%s)) + 1;\n", "val")) return false;
+                    flags(in, "val == 0", "val < 0", NULL, "val == 0x8000");
+                    return true;
+                case 053: // dec
+                    if (!rmw(in, op, false, "val = int(int16_t(%s)) - 1;\n", "val")) return false;
+                    flags(in, "val == 0", "val < 0", NULL, "val == -0x8001");
+                    return true;
+                case 054: // neg
+                    if (!rmw(in, op, false, "val = -int16_t(%s);\n", "val")) return false;
+                    flags(in, "val == 0", "val < 0", "val != 0", "val == 0x8000");
+                    return true;
+                case 055: // adc
+                    if (!rmw(in, op, false, "val = int(int16_t(%s)) + int(C);\n", "val")) {
+                        return false;
+                    }
+                    flags(in, "val == 0", "val < 0", "C && val == 0", "val == 0x8000");
+                    in.reads = FC;
+                    return true;
+                case 056: // sbc
+                    if (!rmw(in, op, false, "val = int(int16_t(%s)) - int(C);\n", "val")) {
+                        return false;
+                    }
+                    flags(in, "val == 0", "val < 0", "C && val == -1", "val == -0x8001");
+                    in.reads = FC;
+                    return true;
+                case 057: // tst
+                    k = opr(s, o1, "a");
+                    s += "val = int16_t(" + get(k, o1, false, "a") + ");\n";
+                    flags(in, "val == 0", "val < 0", "false", "false");
+                    return true;
+                case 060: // ror
+                    if (!rmw(in, op, false,
+                            "src = %s;\nval = (src >> 1) | (C ? 0x8000 : 0);\ndst = C;\n",
+                            "val")) return false;
+                    flags(in, "val == 0", "dst", "(src & 1) != 0",
+                            "dst != ((src & 1) != 0)");
+                    in.reads = FC;
+                    return true;
+                case 061: // rol
+                    if (!rmw(in, op, false,
+                            "src = %s;\nval = uint16_t(src << 1) | (C ? 1 : 0);\n",
+                            "val")) return false;
+                    flags(in, "val == 0", "(val & 0x8000) != 0", "(src & 0x8000) != 0",
+                            "((val & 0x8000) != 0) != ((src & 0x8000) != 0)");
+                    in.reads = FC;
+                    return true;
+                case 062: // asr
+                    if (!rmw(in, op, false, "src = %s;\nval = int16_t(src) >> 1;\n", "val")) {
+                        return false;
+                    }
+                    flags(in, "val == 0", "val < 0", "(src & 1) != 0",
+                            "(val < 0) != ((src & 1) != 0)");
+                    return true;
+                case 063: // asl
+                    if (!rmw(in, op, false,
+                            "src = %s;\nval = uint16_t((uint32_t(src) << 1) & 0xffff);\n",
+                            "val")) return false;
+                    flags(in, "val == 0", "val < 0", "(src & 0x8000) != 0",
+                            "(val < 0) != ((src & 0x8000) != 0)");
+                    return true;
+                case 067: // sxt
+                    k = opr(s, o1, "a");
+                    if (!set(s, k, o1, false, "a", "-int(N)")) return false;
+                    flags(in, "!N", NULL, NULL, NULL);
+                    in.reads = FN;
+                    return true;
+            }
+            return false;
+        case 001: // mov
+            k = srcdst(in, op, false, false);
+            if (!set(s, k, o2, false, "b", "src")) return false;
+            flags(in, "src == 0", "int16_t(src) < 0", NULL, "false");
+            return true;
+        case 002: // cmp
+            srcdst(in, op, false, true);
+            s += "val16 = val = int16_t(src) - int16_t(dst);\n";
+            flags(in, "val16 == 0", "val16 < 0", "src < dst", "val != val16");
+            return true;
+        case 003: // bit
+            srcdst(in, op, false, true);
+            s += "val = src & dst;\n";
+            flags(in, "val == 0", "(val & 0x8000) != 0", NULL, "false");
+            return true;
+        case 004: // bic
+            k = srcdst(in, op, false, true);
+            s += "val = (~src) & dst;\n";
+            if (!set(s, k, o2, false, "b", "val")) return false;
+            flags(in, "val == 0", "(val & 0x8000) != 0", NULL, "false");
+            return true;
+        case 005: // bis
+            k = srcdst(in, op, false, true);
+            s += "val = src | dst;\n";
+            if (!set(s, k, o2, false, "b", "val")) return false;
+            flags(in, "val == 0", "(val & 0x8000) != 0", NULL, "false");
+            return true;
+        case 006: // add
+            k = srcdst(in, op, false, true);
+            s += "val16 = val = int16_t(src) + int16_t(dst);\n";
+            if (!set(s, k, o2, false, "b", "val16")) return false;
+            flags(in, "val16 == 0", "val16 < 0", "src + dst >= 0x10000", "val != val16");
+            return true;
+        case 007:
+        {
+            int n = o2.reg, n1 = (n + 1) & 7;
+            switch ((w >> 9) & 7) {
+                case 0: // mul
+                    if (n >= 6) return false;
+                    k = opr(s, o1, "a");
+                    s += "src = int16_t(" + get(k, o1, false, "a") + ");\n";
+                    s += fmt("val = int(r[%d]) * src;\n", n);
+                    if ((n & 1) == 0) {
+                        s += fmt("r[%d] = uint32_t(val) >> 16;\nr[%d] = val;\n", n, n1);
+                    } else {
+                        s += fmt("r[%d] = val;\n", n);
+                    }
+                    flags(in, "val == 0", "val < 0", "val < -0x8000 || val >= 0x8000", "false");
+                    return true;
+                case 1: // div
+                    if (n >= 6) return false;
+                    k = opr(s, o1, "a");
+                    s += "src = int16_t(" + get(k, o1, false, "a") + ");\n";
+                    s += fmt("if (src == 0 || abs(int16_t(r[%d])) > abs(src)) {\n", n);
+                    s += "Z = false;\nN = false;\nC = src == 0;\nV = true;\n";
+                    s += "} else {\n";
+                    s += fmt("val = (uint32_t(r[%d]) << 16) | r[%d];\n", n, n1);
+                    s += fmt("dst = val / src;\nr[%d] = dst;\nr[%d] = val %% src;\n", n, n1);
+                    s += "Z = dst == 0;\nN = dst < 0;\nC = false;\nV = false;\n}\n";
+                    in.kills = FALL;
+                    return true;
+                case 2: // ash
+                    if (n == 7) return false;
+                    k = opr(s, o1, "a");
+                    s += "src = " + get(k, o1, false, "a") + " & 077;\n";
+                    s += fmt("val16 = r[%d];\n", n);
+                    s += "if (src == 0) {\n";
+                    s += "Z = val16 == 0;\nN = val16 < 0;\nV = false;\n";
+                    s += "} else if ((src & 040) == 0) {\n";
+                    s += "int16_t val1 = val16 << (src - 1), val2 = val1 << 1;\n";
+                    s += fmt("r[%d] = val2;\n", n);
+                    s += "Z = val2 == 0;\nN = val2 < 0;\nC = val1 < 0;\n";
+                    s += "V = (val16 < 0) != (val2 < 0);\n";
+                    s += "} else {\n";
+                    s += "int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;\n";
+                    s += fmt("r[%d] = val2;\n", n);
+                    s += "Z = val2 == 0;\nN = val2 < 0;\nC = (val1 & 1) != 0;\n";
+                    s += "V = (val16 < 0) != (val2 < 0);\n}\n";
+                    in.kills = FZ | FN | FV;
+                    in.reads = FC;
+                    return true;
+                case 3: // ashc
+                    if (n >= 6) return false;
+                    k = opr(s, o1, "a");
+                    s += "src = " + get(k, o1, false, "a") + " & 077;\n";
+                    s += fmt("val = int32_t((uint32_t(r[%d]) << 16) | r[%d]);\n", n, n1);
+                    s += "if (src == 0) {\n";
+                    s += "Z = val == 0;\nN = val < 0;\nV = false;\n";
+                    s += "} else if ((src & 040) == 0) {\n";
+                    s += "int32_t val1 = val << (src - 1), val2 = val1 << 1;\n";
+                    s += fmt("r[%d] = uint32_t(val2) >> 16;\nr[%d] = val2;\n", n, n1);
+                    s += "Z = val2 == 0;\nN = val2 < 0;\nC = val1 < 0;\n";
+                    s += "V = (val < 0) != (val2 < 0);\n";
+                    s += "} else {\n";
+                    s += "int32_t val1 = val >> (63 - src), val2 = val1 >> 1;\n";
+                    s += fmt("r[%d] = uint32_t(val2) >> 16;\nr[%d] = val2;\n", n, n1);
+                    s += "Z = val2 == 0;\nN = val2 < 0;\nC = (val1 & 1) != 0;\n";
+                    s += "V = (val < 0) != (val2 < 0);\n}\n";
+                    in.kills = FZ | FN | FV;
+                    in.reads = FC;
+                    return true;
+                case 4: // xor
+                    if (o1.reg == 7) return false;
+                    s += fmt("src = r[%d];\n", o1.reg);
+                    k = opr(s, o2, "b");
+                    s += "val = src ^ " + get(k, o2, false, "b") + ";\n";
+                    if (!set(s, k, o2, false, "b", "val")) return false;
+                    flags(in, "val == 0", "(val & 0x8000) != 0", NULL, "false");
+                    return true;
+                case 7: // sob
+                    if (o1.reg == 7) return false;
+                    s += fmt("r[%d]--;\n", o1.reg);
+                    in.flow = COND;
+                    in.cond = fmt("r[%d] != 0", o1.reg);
+                    in.target = uint16_t(next - o2.value * 2);
+                    return true;
+            }
+            return false;
+        }
+        case 010:
+            switch ((w >> 6) & 077) {
+                case 000: case 001: case 002: case 003: // bpl
+                    branch(in, op, "!N", FN);
+                    return true;
+                case 004: case 005: case 006: case 007: // bmi
+                    branch(in, op, "N", FN);
+                    return true;
+                case 010: case 011: case 012: case 013: // bhi
+                    branch(in, op, "!(C | Z)", FC | FZ);
+                    return true;
+                case 014: case 015: case 016: case 017: // blos
+                    branch(in, op, "C | Z", FC | FZ);
+                    return true;
+                case 020: case 021: case 022: case 023: // bvc
+                    branch(in, op, "!V", FV);
+                    return true;
+                case 024: case 025: case 026: case 027: // bvs
+                    branch(in, op, "V", FV);
+                    return true;
+                case 030: case 031: case 032: case 033: // bcc
+                    branch(in, op, "!C", FC);
+                    return true;
+                case 034: case 035: case 036: case 037: // bcs
+                    branch(in, op, "C", FC);
+                    return true;
+                case 050: // clrb
+                    k = opr(s, o1, "a");
+                    if (!set(s, k, o1, true, "a", "0")) return false;
+                    flags(in, "true", "false", "false", "false");
+                    return true;
+                case 051: // comb
+                    if (!rmw(in, op, true, "val = ~int(%s);\n", "val")) return false;
+                    flags(in, "val == 0", "(val & 0x80) != 0", "true", "false");
+                    return true;
+                case 052: // incb
+                    if (!rmw(in, op, true, "val = int(int8_t(%s)) + 1;\n", "val")) return false;
+                    flags(in, "val == 0", "val < 0", NULL, "val == 0x80");
+                    return true;
+                case 053: // decb
+                    if (!rmw(in, op, true, "val = int(int8_t(%s)) - 1;\n", "val")) return false;
+                    flags(in, "val == 0", "val < 0", NULL, "val == -0x81");
+                    return true;
+                case 054: // negb
+                    if (!rmw(in, op, true, "src = %s;\nval = -int8_t(src);\n", "val")) {
+                        return false;
+                    }
+                    flags(in, "val == 0", "val < 0", "val != 0", "val == 0x80");
+                    return true;
+                case 055: // adcb
+                    if (!rmw(in, op, true, "val = int(int8_t(%s)) + (C ? 1 : 0);\n", "val")) {
+                        return false;
+                    }
+                    flags(in, "val == 0", "val < 0", "C && val == 0", "val == 0x80");
+                    in.reads = FC;
+                    return true;
+                case 056: // sbcb
+                    if (!rmw(in, op, true, "val = int(int8_t(%s)) - (C ? 1 : 0);\n", "val")) {
+                        return false;
+                    }
+                    flags(in, "val == 0", "val < 0", "C && val == -1", "val == -0x81");
+                    in.reads = FC;
+                    return true;
+                case 057: // tstb
+                    k = opr(s, o1, "a");
+                    s += "val = int8_t(" + get(k, o1, true, "a") + ");\n";
+                    flags(in, "val == 0", "val < 0", "false", "false");
+                    return true;
+                case 060: // rorb
+                    if (!rmw(in, op, true,
+                            "src = %s;\nval = src >> 1;\nif (C) val = uint8_t(val + 0x80);\n"
+                            "dst = C;\n", "val")) return false;
+                    flags(in, "val == 0", "dst", "(src & 1) != 0",
+                            "dst != ((src & 1) != 0)");
+                    in.reads = FC;
+                    return true;
+                case 061: // rolb
+                    if (!rmw(in, op, true,
+                            "src = %s;\nval = uint8_t(((uint32_t(src) << 1) + (C ? 1 : 0)) & 0xff);\n",
+                            "val")) return false;
+                    flags(in, "val == 0", "(val & 0x80) != 0", "(src & 0x80) != 0",
+                            "((val & 0x80) != 0) != ((src & 0x80) != 0)");
+                    in.reads = FC;
+                    return true;
+                case 062: // asrb
+                    if (!rmw(in, op, true, "src = %s;\nval = int8_t(src) >> 1;\n", "val")) {
+                        return false;
+                    }
+                    flags(in, "val == 0", "val < 0", "(src & 1) != 0",
+                            "(val < 0) != ((src & 1) != 0)");
+                    return true;
+                case 063: // aslb
+                    if (!rmw(in, op, true,
+                            "src = %s;\nval = uint8_t((uint32_t(src) << 1) & 0xff);\n",
+                            "val")) return false;
+                    flags(in, "val == 0", "val < 0", "(src & 0x80) != 0",
+                            "(val < 0) != ((src & 0x80) != 0)");
+                    return true;
+            }
+            return false; // emt, sys: the interpreter
+        case 011: // movb
+            k = srcdst(in, op, true, false);
+            if (!set(s, k, o2, true, "b", "src", true)) return false;
+            flags(in, "src == 0", "int8_t(src) < 0", NULL, "false");
+            return true;
+        case 012: // cmpb
+            srcdst(in, op, true, true);
+            s += "val8 = val = int8_t(src) - int8_t(dst);\n";
+            flags(in, "val8 == 0", "val8 < 0", "src < dst", "val != val8");
+            return true;
+        case 013: // bitb
+            srcdst(in, op, true, true);
+            s += "val = src & dst;\n";
+            flags(in, "val == 0", "(val & 0x80) != 0", NULL, "false");
+            return true;
+        case 014: // bicb
+            k = srcdst(in, op, true, true);
+            s += "val = (~src) & dst;\n";
+            if (!set(s, k, o2, true, "b", "val")) return false;
+            flags(in, "val == 0", "(val & 0x80) != 0", NULL, "false");
+            return true;
+        case 015: // bisb
+            k = srcdst(in, op, true, true);
+            s += "val = src | dst;\n";
+            if (!set(s, k, o2, true, "b", "val")) return false;
+            flags(in, "val == 0", "(val & 0x80) != 0", NULL, "false");
+            return true;
+        case 016: // sub: run1() takes the side effects of opr2 twice
+            srcdst(in, op, false, true);
+            s += "val16 = val = int16_t(dst) - int16_t(src);\n";
+            k = opr(s, o2, "b");
+            if (!set(s, k, o2, false, "b", "val16")) return false;
+            flags(in, "val16 == 0", "val16 < 0", "dst < src", "val != val16");
+            return true;
+        case 017:
+            return w == 0170011; // setd
+    }
+    return false;
+}
+
+namespace {
+    class Gen {
+        VM *vm;
+        int start, end;
+        std::set<int> seeds, visited;
+        std::vector<int> work;
+
+    public:
+        Gen(VM *vm, int start, int end) : vm(vm), start(start), end(end) {
+        }
+
+        bool code(int pc) {
+            return start <= pc && pc < end && !(pc & 1);
+        }
+
+        void seed(int pc) {
+            if (code(pc) && seeds.insert(pc).second) work.push_back(pc);
+        }
+
+        // recursive disassembly from the seeds
+        void walk() {
+            while (!work.empty()) {
+                int pc = work.back();
+                work.pop_back();
+                while (code(pc) && visited.insert(pc).second
+                        && pc != vm->csv && pc != vm->cret) {
+                    OpCode op = disasm1(vm->text, pc);
+                    int next = pc + op.len;
+                    if (next > end) break;
+                    Insn in;
+                    if (!insn(vm, in, op, pc)) {
+                        // after sys: the arguments of the known system calls
+                        int n = (::read16(vm->text + pc) & 0177400) == 0104400 ? 5 : 1;
+                        for (int i = 0; i < n; i++) seed(next + i * 2);
+                        break;
+                    }
+                    if (in.ret >= 0) seed(in.ret);
+                    if (in.flow == CONT) {
+                        pc = next;
+                        continue;
+                    }
+                    if (in.flow == GOTO || in.flow == COND) seed(in.target);
+                    if (in.flow == COND) seed(next);
+                    if (in.flow == JUMP) table(op);
+                    break;
+                }
+            }
+        }
+
+        // the targets of a switch: jmp *table(rn)
+        void table(const OpCode &op) {
+            const Operand &o = op.opr1;
+            if (o.mode != 7 || o.reg == 7) return;
+            for (int i = 0; i < 256; i++) {
+                int t = vm->read16(uint16_t(o.value + i * 2));
+                if (!code(t)) break;
+                seed(t);
+            }
+        }
+
+        // code addresses stored in the data: function pointers and the
+        // tables of the hashed switches, where a linear sweep of the text
+        // has an instruction
+        void pointers() {
+            std::set<int> insns;
+            int tend = start + vm->tsize;
+            for (int pc = start; pc < tend; pc += disasm1(vm->text, pc).len) {
+                insns.insert(pc);
+            }
+            int doff = 0;
+            if (vm->data == vm->text) {
+                doff = end > tend ? tend : (vm->tsize + 0x1fff) & ~0x1fff;
+            }
+            for (int i = doff; i < doff + int(vm->dsize) && i < 0xffff; i += 2) {
+                int t = ::read16(vm->data + i);
+                if (insns.count(t)) seed(t);
+            }
+        }
+
+        void flow(FILE *f, int target) {
+            if (seeds.count(target)) {
+                fprintf(f, "    AOT_GOTO(0x%04x, L%04x);\n", target, target);
+            } else {
+                fprintf(f, "    AOT_JUMP(0x%04x);\n", target & 0xffff);
+            }
+        }
+
+        void block(FILE *f, int addr) {
+            std::vector<Insn> ins;
+            std::vector<std::string> dis;
+            std::string jump;
+            int pc = addr, count = 0;
+            if (pc == vm->csv || pc == vm->cret) {
+                Insn in;
+                if (pc == vm->csv) {
+                    csvcode(vm, in.code, in.kills);
+                    in.jump = "r[0]";
+                } else {
+                    cretcode(vm, in.code, in.kills);
+                    in.jump = "b";
+                }
+                in.flow = JUMP;
+                ins.push_back(in);
+                dis.push_back(pc == vm->csv ? "csv" : "cret");
+                pc += 2;
+            }
+            while (ins.empty() || (ins.back().flow == CONT && code(pc) && !seeds.count(pc))) {
+                OpCode op = disasm1(vm->text, pc);
+                Insn in;
+                if (pc + int(op.len) > end || !insn(vm, in, op, pc)) {
+                    in = Insn();
+                    in.flow = INTERP;
+                    in.count = 0;
+                    in.reads = FALL;
+                    in.target = pc;
+                }
+                ins.push_back(in);
+                dis.push_back(fmt("%04x: ", pc) + vm->disstr(op));
+                pc += op.len;
+            }
+            // the flags read before they are overwritten
+            int live = FALL;
+            std::vector<int> emit(ins.size());
+            for (int i = ins.size() - 1; i >= 0; i--) {
+                emit[i] = ins[i].writes() & live;
+                live = (live & ~(ins[i].writes() | ins[i].kills)) | ins[i].reads;
+                count += ins[i].count;
+            }
+            fprintf(f, "L%04x:\n", addr);
+            if (count) fprintf(f, "    AOT_BLOCK(0x%04x, %d);\n", addr, count);
+            static const char *fn[] = {"Z", "N", "C", "V"};
+            for (size_t i = 0; i < ins.size(); i++) {
+                const Insn &in = ins[i];
+                fprintf(f, "    // %s\n", dis[i].c_str());
+                if (in.code.empty() && !emit[i]) continue;
+                fprintf(f, "    {\n");
+                std::string::size_type p = 0, q;
+                while ((q = in.code.find('\n', p)) != std::string::npos) {
+                    fprintf(f, "        %s\n", in.code.substr(p, q - p).c_str());
+                    p = q + 1;
+                }
+                for (int j = 0; j < 4; j++) {
+                    if (emit[i] & (1 << j)) {
+                        fprintf(f, "        %s = %s;\n", fn[j], in.flags[j].c_str());
+                    }
+                }
+                fprintf(f, "    }\n");
+            }
+            const Insn &last = ins.back();
+            switch (last.flow) {
+                case CONT:
+                    flow(f, pc);
+                    break;
+                case GOTO:
+                    flow(f, last.target);
+                    break;
+                case COND:
+                    fprintf(f, "    if (%s)\n    ", last.cond.c_str());
+                    flow(f, last.target);
+                    flow(f, pc);
+                    break;
+                case JUMP:
+                    fprintf(f, "    AOT_JUMP(%s);\n", last.jump.c_str());
+                    break;
+                case INTERP:
+                    fprintf(f, "    AOT_INTERP(0x%04x);\n", last.target);
+                    break;
+            }
+        }
+
+        int gen(FILE *f, const std::string &name, int entry) {
+            seed(entry);
+            seed(vm->csv);
+            seed(vm->cret);
+            std::map<int, Symbol>::iterator it;
+            for (it = vm->syms[1].begin(); it != vm->syms[1].end(); ++it) {
+                seed(it->first);
+            }
+            pointers();
+            walk();
+            uint32_t hash = aothash(vm->text + start, end - start);
+            fprintf(f, "// %s translated by 7aot: %d blocks, do not edit\n",
+                    name.c_str(), int(seeds.size()));
+            fprintf(f, "#include \"../PDP11/aot.h\"\n\n");
+            fprintf(f, "namespace {\n\n");
+            fprintf(f, "void run(VMBase *base) {\n");
+            fprintf(f, "    AOT_ENTER;\n");
+            fprintf(f, "    goto poll;\n");
+            fprintf(f, "    AOT_RUNTIME\n");
+            fprintf(f, "    switch (vm.r[7]) {\n");
+            std::set<int>::iterator s;
+            for (s = seeds.begin(); s != seeds.end(); ++s) {
+                fprintf(f, "        case 0x%04x: goto L%04x;\n", *s, *s);
+            }
+            fprintf(f, "    }\n");
+            fprintf(f, "    goto interp;\n");
+            for (s = seeds.begin(); s != seeds.end(); ++s) block(f, *s);
+            fprintf(f, "}\n\n");
+            fprintf(f, "AotImage image(\"%s\", 0x%04x, %d, 0x%08xu, run);\n",
+                    name.c_str(), start, end - start, hash);
+            fprintf(f, "}\n");
+            return seeds.size();
+        }
+    };
+}
+
+// 7aot: the translation of the loaded text [start, end) to f
+int VM::aotgen(FILE *f, const std::string &name, int start, int end) {
+    Gen gen(this, start, end);
+    return gen.gen(f, name, PC);
+}
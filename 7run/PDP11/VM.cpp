@@ -1,4 +1,7 @@
 #include "VM.h"
+#include "../UnixBase.h"
+#include "../Lockstep.h"
+#include "../Aot.h"
 #include "disasm.h"
 #include "regs.h"
 #include <stdio.h>
@@ -20,7 +23,7 @@ void VM::debug(uint16_t pc, const OpCode &op) {
             r[0], r[1], r[2], r[3], r[4], r[5], r[6],
             "-Z"[Z], "-N"[N], "-C"[C], "-V"[V],
             pc, hexdump2(text + pc, op.len).c_str(), op.str().c_str());
-    if (trace >= 3) {
+    if (ctx->trace >= 3) {
         uint16_t r[8];
         memcpy(r, this->r, sizeof (r));
         int ad1 = addr(op.opr1);
@@ -42,7 +45,7 @@ void VM::debug(uint16_t pc, const OpCode &op) {
     fprintf(stderr, "\n");
 }
 
-VM::VM() : start_sp(0) {
+VM::VM() : start_sp(0), csv(-1), cret(-1), csvver(0), cretver(0) {
     memset(r, 0, sizeof (r));
     Z = N = C = V = false;
 }
@@ -54,6 +57,10 @@ VM::VM(const VM &vm) : VMBase(vm) {
     C = vm.C;
     V = vm.V;
     start_sp = vm.start_sp;
+    csv = vm.csv;
+    cret = vm.cret;
+    csvver = vm.csvver;
+    cretver = vm.cretver;
 }
 
 VM::~VM() {
@@ -63,6 +70,7 @@ bool VM::load(const std::string& fn, FILE* f, size_t size) {
     if (!VMBase::load(fn, f, size)) return false;
     PC = 0;
     cache.clear();
+    csv = cret = -1;
     return true;
 }
 
@@ -99,7 +107,93 @@ int VM::addr(const Operand &opr, bool nomove) {
 }
 
 void VM::run2() {
-    while (!hasExited) run1();
+    if (lockstep) {
+        run2lockstep();
+        return;
+    }
+    if (!xtracepath.empty()) {
+        run2trace();
+        return;
+    }
+    if (statsmode || cyclemodel) {
+        run2stats();
+        return;
+    }
+    if (profcount || ctx->insnbudget != ~uint64_t(0)) {
+        run2prof();
+        return;
+    }
+    // an exec into translated code or up to --snap-at raises sigpending
+    while (!hasExited) {
+        if (aot) {
+            aot->run(this);
+            continue;
+        }
+        if (snappending) {
+            run2snap();
+            continue;
+        }
+        do {
+            run1();
+        } while (!hasExited && !UnixBase::sigpending);
+        if (UnixBase::sigpending) unix->sigcheck();
+    }
+}
+
+// run2() with -P, -G or --budget
+void VM::run2prof() {
+    while (!hasExited) {
+        if (snappending) {
+            run2snap();
+            continue;
+        }
+        run1();
+        if (UnixBase::sigpending) unix->sigcheck();
+        if (profcount && !--profcount) unix->profsample();
+        if (insns == ctx->insnbudget) unix->overbudget();
+    }
+}
+
+uint16_t VM::getpc() {
+    return PC;
+}
+
+// --snap-at: run1() up to the point, then write the snapshot
+void VM::run2snap() {
+    while (!hasExited && snappending) {
+        if (PC == snappc || insns - execinsns == snapinsns) {
+            snappending = false;
+            unix->snapshot();
+            return;
+        }
+        run1();
+        if (UnixBase::sigpending) unix->sigcheck();
+        if (insns == ctx->insnbudget) unix->overbudget();
+    }
+}
+
+// the target of the first call from the entry: main() after crt0
+int VM::findmain() {
+    uint16_t pc = PC;
+    for (int i = 0; i < 64; i++) {
+        // jsr pc, addr
+        uint16_t w = ::read16(text + pc);
+        if (w == 004767) return uint16_t(pc + 4 + ::read16(text + pc + 2));
+        // not a C start-up: jmp, rts or sys first
+        if ((w & ~077) == 000100 || (w & ~7) == 000200 || (w & ~0377) == 0104400) {
+            return -1;
+        }
+        pc += disasm1(text, pc).len;
+    }
+    return -1;
+}
+
+std::string VM::disline(uint16_t pc) {
+    OpCode op = disasm1(text, pc);
+    char buf[128];
+    snprintf(buf, sizeof (buf), "%04x:%-14s %s",
+            pc, hexdump2(text + pc, op.len).c_str(), disstr(op).c_str());
+    return buf;
 }
 
 void VM::disasm() {
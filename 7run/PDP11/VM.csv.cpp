@@ -0,0 +1,150 @@
+#include "VM.h"
+#include "../UnixBase.h"
+#include "../XTrace.h"
+#include "regs.h"
+#include <stdio.h>
+
+using namespace PDP11;
+
+// the function prologue and epilogue of the V6/V7 C compiler (csv.s)
+
+static const uint16_t v6csv[] = {
+    010500, // mov r5,r0
+    010605, // mov sp,r5
+    010446, // mov r4,-(sp)
+    010346, // mov r3,-(sp)
+    010246, // mov r2,-(sp)
+    005746, // tst -(sp)
+    000110, // jmp (r0)
+};
+
+static const uint16_t v7csv[] = {
+    010500, // mov r5,r0
+    010605, // mov sp,r5
+    010446, // mov r4,-(sp)
+    010346, // mov r3,-(sp)
+    010246, // mov r2,-(sp)
+    004710, // jsr pc,(r0)
+};
+
+static const uint16_t v6cret[] = {
+    010501, // mov r5,r1
+    014104, // mov -(r1),r4
+    014103, // mov -(r1),r3
+    014102, // mov -(r1),r2
+    010506, // mov r5,sp
+    012605, // mov (sp)+,r5
+    000207, // rts pc
+};
+
+static const uint16_t v7cret[] = {
+    010502, // mov r5,r2
+    014204, // mov -(r2),r4
+    014203, // mov -(r2),r3
+    014202, // mov -(r2),r2
+    010506, // mov r5,sp
+    012605, // mov (sp)+,r5
+    000207, // rts pc
+};
+
+#define LEN(a) int(sizeof (a) / sizeof (a[0]))
+
+static bool match(uint8_t *text, int addr, int end, const uint16_t *code, int len) {
+    if (addr < 0 || (addr & 1) || addr + len * 2 > end) return false;
+    for (int i = 0; i < len; i++) {
+        if (::read16(text + addr + i * 2) != code[i]) return false;
+    }
+    return true;
+}
+
+static int find(uint8_t *text, int start, int end, const uint16_t *code, int len) {
+    for (int a = (start + 1) & ~1; a + len * 2 <= end; a += 2) {
+        if (match(text, a, end, code, len)) return a;
+    }
+    return -1;
+}
+
+static int symaddr(const std::map<int, Symbol> &syms, const char *name) {
+    std::map<int, Symbol>::const_iterator it;
+    for (it = syms.begin(); it != syms.end(); ++it) {
+        if (it->second.name == name) return it->first;
+    }
+    return -1;
+}
+
+// after loading an image: find csv and cret by symbol or by their code,
+// a csv or cret with unknown code is left to the interpreter
+void VM::csvscan(int start, int end) {
+    csv = cret = -1;
+    csvver = cretver = 0;
+    // --stats and --cycles count the guest instructions, -v, -m and -X
+    // show them, -G follows the calls and returns in them
+    if (statsmode || cyclemodel || callgraph || ctx->trace
+            || !xtracepath.empty()) return;
+    int a = symaddr(syms[1], "csv");
+    if (a < 0) {
+        if ((a = find(text, start, end, v6csv, LEN(v6csv))) < 0) {
+            a = find(text, start, end, v7csv, LEN(v7csv));
+        }
+    }
+    if (match(text, a, end, v6csv, LEN(v6csv))) {
+        csv = a;
+        csvver = 6;
+    } else if (match(text, a, end, v7csv, LEN(v7csv))) {
+        csv = a;
+        csvver = 7;
+    } else if (ctx->trace && a >= 0) {
+        fprintf(stderr, "<csv: unknown code at %04x>\n", a);
+    }
+    a = symaddr(syms[1], "cret");
+    if (a < 0) {
+        if ((a = find(text, start, end, v6cret, LEN(v6cret))) < 0) {
+            a = find(text, start, end, v7cret, LEN(v7cret));
+        }
+    }
+    if (match(text, a, end, v6cret, LEN(v6cret))) {
+        cret = a;
+        cretver = 6;
+    } else if (match(text, a, end, v7cret, LEN(v7cret))) {
+        cret = a;
+        cretver = 7;
+    } else if (ctx->trace && a >= 0) {
+        fprintf(stderr, "<cret: unknown code at %04x>\n", a);
+    }
+    if (ctx->trace && csv >= 0) fprintf(stderr, "<csv: V%d at %04x>\n", csvver, csv);
+    if (ctx->trace && cret >= 0) fprintf(stderr, "<cret: V%d at %04x>\n", cretver, cret);
+}
+
+// csv as one operation, entered by jsr r5,csv
+void VM::runcsv() {
+    r[0] = r[5];
+    r[5] = SP;
+    write16(SP -= 2, r[4]);
+    write16(SP -= 2, r[3]);
+    write16(SP -= 2, r[2]);
+    if (csvver == 6) {
+        SP -= 2;
+        uint16_t v = read16(SP);
+        setZNCV(v == 0, int16_t(v) < 0, false, false);
+        PC = r[0];
+    } else {
+        setZNCV(r[2] == 0, int16_t(r[2]) < 0, C, false);
+        write16(SP -= 2, csv + LEN(v7csv) * 2);
+        PC = r[0];
+    }
+}
+
+// cret as one operation, entered by jmp cret
+void VM::runcret() {
+    int tmp = cretver == 6 ? 1 : 2;
+    r[tmp] = r[5] - 6;
+    r[4] = read16(r[5] - 2);
+    r[3] = read16(r[5] - 4);
+    r[2] = read16(r[5] - 6);
+    SP = r[5];
+    r[5] = read16(SP);
+    SP += 2;
+    setZNCV(r[5] == 0, int16_t(r[5]) < 0, C, false);
+    PC = read16(SP);
+    SP += 2;
+}
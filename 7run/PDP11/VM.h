@@ -10,6 +10,8 @@ namespace PDP11 {
         bool Z, N, C, V;
         uint16_t start_sp;
         std::vector<OpCode> cache;
+        int csv, cret; // native csv/cret entries, -1: interpreted
+        int csvver, cretver; // 6 or 7
 
         VM();
         VM(const VM &vm);
@@ -19,6 +21,21 @@ namespace PDP11 {
         virtual void disasm();
         virtual void showHeader();
         virtual void run2();
+        virtual uint16_t getpc();
+        virtual std::string disline(uint16_t pc);
+        virtual int findmain();
+        void run2stats();
+        Stats::Inst *statinst(uint16_t pc);
+        void run2trace();
+        void run2lockstep();
+        void run2snap();
+        void run2prof();
+        void getstate(uint16_t *st);
+        void setstate(const uint16_t *st);
+        void csvscan(int start, int end);
+        void runcsv();
+        void runcret();
+        int aotgen(FILE *f, const std::string &name, int start, int end);
 
         std::string disstr(const OpCode &op);
         void run1();
@@ -8,6 +8,7 @@
 using namespace PDP11;
 
 void VM::run1() {
+    recent[insns++ % FLIGHT_PCS] = PC;
     OpCode *op, op1;
     if (cache.empty()) {
         op = &(op1 = disasm1(text, PC));
@@ -17,15 +18,17 @@ void VM::run1() {
     }
     if (PC + op->len > 0x10000) {
         fprintf(stderr, "overrun: %04x\n", PC);
+        unix->flightdump();
         hasExited = true;
         return;
     }
     if (SP < brksize) {
         fprintf(stderr, "stack overflow: %04x\n", SP);
+        unix->flightdump();
         hasExited = true;
         return;
     }
-    if (trace >= 2) debug(PC, *op);
+    if (ctx->trace >= 2) debug(PC, *op);
     uint16_t w = ::read16(text + PC);
     uint16_t oldpc = PC;
     int dst, src, val;
@@ -56,6 +59,7 @@ void VM::run1() {
                             r[7] = r[op->opr1.reg];
                             r[op->opr1.reg] = read16(SP);
                             SP += 2;
+                            if (callgraph && op->opr1.reg == 7) ret(SP);
                             return;
                         case 3: // spl
                             break;
@@ -136,6 +140,8 @@ void VM::run1() {
                     write16(SP -= 2, r[op->opr1.reg]);
                     r[op->opr1.reg] = PC;
                     PC = val;
+                    // jsr r5,csv is the prologue, not a call
+                    if (callgraph && op->opr1.reg == 7) call(PC, SP);
                     return;
                 case 050: // clr: CLeaR
                     set16(op->opr1, 0);
@@ -232,6 +238,8 @@ void VM::run1() {
             }
             break;
         case 001: // mov: MOVe
+            if (oldpc == csv) return runcsv();
+            if (oldpc == cret) return runcret();
             src = get16(op->opr1);
             set16(op->opr2, src);
             setZNCV(src == 0, int16_t(src) < 0, C, false);
@@ -533,10 +541,11 @@ void VM::run1() {
             }
             break;
     }
-    if (trace < 2) {
+    if (ctx->trace < 2) {
         fprintf(stderr, header);
         debug(oldpc, *op);
     }
     fprintf(stderr, "not implemented\n");
+    unix->flightdump();
     unix->sys_exit(-1);
 }
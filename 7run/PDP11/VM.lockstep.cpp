@@ -0,0 +1,85 @@
+#include "VM.h"
+#include "../UnixBase.h"
+#include "../Lockstep.h"
+#include "disasm.h"
+#include "regs.h"
+
+using namespace PDP11;
+
+static const char *names[XT_STATE] = {
+    "r0", "r1", "r2", "r3", "r4", "r5", "sp", "pc", NULL, "flags"
+};
+
+// run2() against a shadow VM (--lockstep): the reference decodes every
+// instruction, the shadow runs from the decoded instruction cache and
+// calls the native csv and cret
+void VM::run2lockstep() {
+    VM alt(*this);
+    alt.unix = unix;
+    alt.materialize();
+    Lockstep ls(names);
+    uint16_t st1[XT_STATE], st2[XT_STATE];
+    while (!hasExited) {
+        if (!cache.empty()) { // loaded
+            alt.cache.swap(cache);
+            std::vector<OpCode>().swap(cache);
+        }
+        if ((::read16(text + PC) & 0177400) == 0104400) { // sys
+            ls.touchall();
+            getstate(st1);
+            alt.getstate(st2);
+            if (!ls.check(this, &alt, st1, st2)) break;
+            run1();
+            getstate(st1);
+            ls.sync(this, &alt);
+            alt.setstate(st1);
+            alt.csv = csv;
+            alt.cret = cret;
+            alt.csvver = csvver;
+            alt.cretver = cretver;
+        } else if (PC == csv || PC == cret) {
+            for (int i = 2; i <= 8; i += 2) ls.touch(uint16_t(SP - i));
+            int t = ctx->trace;
+            ctx->trace = 0;
+            alt.run1();
+            ctx->trace = t;
+            // the reference runs the guest code up to the same point
+            int c1 = csv, c2 = cret;
+            csv = cret = -1;
+            for (int n = 0; n < 16 && !hasExited
+                    && (PC != alt.PC || SP != alt.SP); n++) {
+                run1();
+            }
+            csv = c1;
+            cret = c2;
+            getstate(st1);
+            alt.getstate(st2);
+            if (!ls.check(this, &alt, st1, st2)) break;
+        } else {
+            OpCode op = disasm1(text, PC);
+            ls.touch(addr(op.opr1, true));
+            ls.touch(addr(op.opr2, true));
+            uint16_t seqpc = PC + op.len;
+            run1();
+            int t = ctx->trace;
+            ctx->trace = 0;
+            alt.run1();
+            ctx->trace = t;
+            ls.touch(SP);
+            if (PC != seqpc || hasExited || alt.hasExited) {
+                getstate(st1);
+                alt.getstate(st2);
+                if (!ls.check(this, &alt, st1, st2)) break;
+            }
+        }
+        if (UnixBase::sigpending) {
+            unix->sigcheck();
+            getstate(st1);
+            ls.sync(this, &alt);
+            alt.setstate(st1);
+        }
+        if (profcount && !--profcount) unix->profsample();
+        if (insns == ctx->insnbudget) unix->overbudget();
+    }
+    if (!hasExited) unix->kill("lockstep divergence", 6);
+}
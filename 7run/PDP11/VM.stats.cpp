@@ -0,0 +1,161 @@
+#include "VM.h"
+#include "../UnixBase.h"
+#include "disasm.h"
+#include "regs.h"
+#include <stdio.h>
+
+using namespace PDP11;
+
+// run2() with the counters of --stats and --cycles
+void VM::run2stats() {
+    while (!hasExited) {
+        Stats::Inst *in = stats.inst(PC);
+        if (!in) in = statinst(PC);
+        stats.count(in);
+        // exec may free the Inst
+        uint16_t next = PC + in->len, extra = in->extra;
+        run1();
+        if (PC != next) stats.cycles += extra;
+        if (UnixBase::sigpending) unix->sigcheck();
+        if (profcount && !--profcount) unix->profsample();
+        if (insns == ctx->insnbudget) unix->overbudget();
+    }
+}
+
+// approximate instruction times in ns after the PDP-11/40 (core memory)
+// and PDP-11/45 (MOS memory) processor handbooks
+struct Timing {
+    int src[8], dst[8], movdst[8]; // operand times by mode, dst: modify
+    int mov, dop, sop, bnt, bt, jmp, jsr, rts, mul, div, ash, sys, rti, cc, misc;
+};
+
+static const Timing timings[] = {
+    { // 11/40
+        {0, 780, 840, 1740, 840, 1740, 1460, 2360},
+        {0, 1440, 1500, 2400, 1500, 2400, 2120, 3020},
+        {0, 860, 860, 1760, 860, 1760, 1480, 2380},
+        900, 990, 990, 760, 880, 400, 1800, 1740,
+        8880, 11300, 2600, 4400, 2600, 900, 1500,
+    },
+    { // 11/45
+        {0, 450, 450, 900, 600, 1050, 900, 1350},
+        {0, 750, 750, 1200, 900, 1350, 1200, 1650},
+        {0, 450, 450, 900, 600, 1050, 900, 1350},
+        300, 300, 300, 300, 600, 300, 1200, 900,
+        3300, 7080, 1500, 2400, 1350, 300, 900,
+    },
+};
+
+static bool in(const std::string &mne, const char *list) {
+    return (" " + std::string(list) + " ").find(" " + mne + " ") != std::string::npos;
+}
+
+static int mode(const Operand &opr) {
+    return opr.empty() || opr.mode > 7 ? 0 : opr.mode;
+}
+
+// extra: the additional time of a taken branch
+static int cost(const OpCode &op, int *extra) {
+    const Timing &t = timings[cyclemodel == 45];
+    std::string m = op.mne;
+    int m1 = mode(op.opr1), m2 = mode(op.opr2);
+    *extra = 0;
+    if (in(m, "mov movb")) return t.mov + t.src[m1] + t.movdst[m2];
+    if (in(m, "cmp cmpb bit bitb")) return t.dop + t.src[m1] + t.src[m2];
+    if (in(m, "add sub bic bicb bis bisb")) return t.dop + t.src[m1] + t.dst[m2];
+    if (m == "xor") return t.dop + t.dst[m2];
+    if (m == "mul") return t.mul + t.src[m1];
+    if (m == "div") return t.div + t.src[m1];
+    if (in(m, "ash ashc")) return t.ash + t.src[m1];
+    if (in(m, "clr clrb sxt")) return t.sop + t.movdst[m1];
+    if (in(m, "tst tstb")) return t.sop + t.src[m1];
+    if (in(m, "com comb inc incb dec decb neg negb adc adcb sbc sbcb"
+            " ror rorb rol rolb asr asrb asl aslb swab")) return t.sop + t.dst[m1];
+    if (m == "jmp") return t.jmp + t.src[m1];
+    if (m == "jsr") return t.jsr + t.src[m2];
+    if (m == "rts") return t.rts;
+    if (m == "br") return t.bt;
+    if (in(m, "bne beq bge blt bgt ble bpl bmi bhi blos bvc bvs bcc bcs sob")) {
+        *extra = t.bt - t.bnt;
+        return t.bnt;
+    }
+    if (in(m, "sys emt bpt iot")) return t.sys;
+    if (in(m, "rti rtt")) return t.rti;
+    if (m == "nop" || m == "ccc" || m == "scc" || startsWith(m, "cl") || startsWith(m, "se")) {
+        return t.cc;
+    }
+    return t.misc;
+}
+
+static int modecode(const Operand &opr) {
+    if (opr.empty()) return 0;
+    if (opr.reg == 7) return 21 + opr.mode;
+    if (opr.reg == 6) return 11 + opr.mode;
+    return 1 + opr.mode;
+}
+
+static std::string modestr(const Operand &opr) {
+    if (opr.reg == 7) {
+        switch (opr.mode) {
+            case 2: return "$n";
+            case 3: return "*$n";
+            case 6: return "rel";
+            case 7: return "*rel";
+            case 8: return "n";
+            case 9: return "addr";
+        }
+    }
+    std::string r = opr.reg == 6 ? "sp" : opr.reg == 7 ? "pc" : "r";
+    switch (opr.mode) {
+        case 0: return r;
+        case 1: return "(" + r + ")";
+        case 2: return "(" + r + ")+";
+        case 3: return "*(" + r + ")+";
+        case 4: return "-(" + r + ")";
+        case 5: return "*-(" + r + ")";
+        case 6: return "x(" + r + ")";
+        case 7: return "*x(" + r + ")";
+    }
+    return "?";
+}
+
+// data memory operand: 1, or 2 with the deferred pointer
+static int memory(const Operand &opr) {
+    if (opr.empty()) return 0;
+    if (opr.reg == 7) return opr.mode == 3 || opr.mode == 6 ? 1 : opr.mode == 7 ? 2 : 0;
+    if (opr.mode == 0 || opr.mode > 7) return 0;
+    return opr.mode & 1 && opr.mode != 1 ? 2 : 1;
+}
+
+// decode once per address: the key is the mnemonic and addressing modes
+Stats::Inst *VM::statinst(uint16_t pc) {
+    OpCode op = disasm1(text, pc);
+    std::string name = op.mne;
+    if (!op.opr1.empty()) name += " " + modestr(op.opr1);
+    if (!op.opr2.empty()) name += "," + modestr(op.opr2);
+    Stats::Inst *in = &stats.insts[pc];
+    in->id = stats.id(op.mne, modecode(op.opr1) << 8 | modecode(op.opr2), name);
+    in->reads = in->writes = 0;
+    in->len = op.len;
+    int extra = 0;
+    in->cycles = cyclemodel ? cost(op, &extra) : 0;
+    in->extra = extra;
+    std::string mne = op.mne;
+    if (mne == "jmp" || mne == "jsr") return in;
+    const Operand &dst = op.opr2.empty() ? op.opr1 : op.opr2;
+    int m = memory(dst);
+    if (m) {
+        in->reads = m - 1;
+        if (mne == "mov" || mne == "movb" || mne == "clr" || mne == "clrb") {
+            in->writes = 1;
+        } else if (mne == "cmp" || mne == "cmpb" || mne == "bit"
+                || mne == "bitb" || mne == "tst" || mne == "tstb") {
+            ++in->reads;
+        } else {
+            ++in->reads;
+            in->writes = 1;
+        }
+    }
+    if (!op.opr2.empty()) in->reads += memory(op.opr1);
+    return in;
+}
@@ -0,0 +1,53 @@
+#include "VM.h"
+#include "../UnixBase.h"
+#include "disasm.h"
+#include "regs.h"
+#include <string.h>
+
+using namespace PDP11;
+
+// run2() writing the execution trace (-X)
+void VM::run2trace() {
+    uint16_t st[XT_STATE];
+    while (!hasExited) {
+        if (!xtrace.active()) {
+            getstate(st);
+            xtrace.image(this, XT_PDP11, unix->guestpid(), st);
+        }
+        OpCode *op, op1;
+        if (cache.empty()) {
+            op = &(op1 = disasm1(text, PC));
+        } else {
+            op = &cache[PC];
+            if (op->empty()) *op = disasm1(text, PC);
+        }
+        int addrs[] = {addr(op->opr1, true), addr(op->opr2, true), -1};
+        bool full = (::read16(text + PC) & 0177400) == 0104400; // sys
+        uint16_t seqpc = PC + op->len;
+        run1();
+        addrs[2] = SP;
+        getstate(st);
+        xtrace.step(this, st, seqpc, addrs, 3, full);
+        if (UnixBase::sigpending) {
+            unix->sigcheck();
+            getstate(st);
+            xtrace.async(this, st);
+        }
+        if (profcount && !--profcount) unix->profsample();
+        if (insns == ctx->insnbudget) unix->overbudget();
+    }
+}
+
+void VM::getstate(uint16_t *st) {
+    memcpy(st, r, sizeof (r));
+    st[8] = 0;
+    st[XT_FLAGREG] = N << 3 | Z << 2 | V << 1 | C;
+}
+
+void VM::setstate(const uint16_t *st) {
+    memcpy(r, st, sizeof (r));
+    N = st[XT_FLAGREG] & 8;
+    Z = st[XT_FLAGREG] & 4;
+    V = st[XT_FLAGREG] & 2;
+    C = st[XT_FLAGREG] & 1;
+}
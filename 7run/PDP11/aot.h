@@ -0,0 +1,80 @@
+#pragma once
+#include "../Aot.h"
+#include "../UnixBase.h"
+#include "VM.h"
+
+// runtime of the C++ that 7aot translates from PDP-11 text: registers and
+// flags live in locals, saved to the VM around the interpreter and signals
+
+#define RD8(a) mem[uint16_t(a)]
+#define RD16(a) ::read16(mem + uint16_t(a))
+#define WR8(a, v) (mem[uint16_t(a)] = uint8_t(v))
+#define WR16(a, v) ::write16(mem + uint16_t(a), uint16_t(v))
+
+#define AOT_ENTER \
+    PDP11::VM &vm = *static_cast<PDP11::VM *>(base); \
+    const AotImage *self = vm.aot; \
+    uint8_t *mem = vm.data; \
+    uint16_t r[7]; \
+    bool Z, N, C, V; \
+    int a, b, src, dst, val; \
+    int16_t val16; \
+    int8_t val8; \
+    (void) mem; (void) a; (void) b; (void) src; (void) dst; (void) val; \
+    (void) val16; (void) val8
+
+#define AOT_LOAD \
+    r[0] = vm.r[0]; r[1] = vm.r[1]; r[2] = vm.r[2]; r[3] = vm.r[3]; \
+    r[4] = vm.r[4]; r[5] = vm.r[5]; r[6] = vm.r[6]; \
+    Z = vm.Z; N = vm.N; C = vm.C; V = vm.V
+
+#define AOT_SAVE \
+    vm.r[0] = r[0]; vm.r[1] = r[1]; vm.r[2] = r[2]; vm.r[3] = r[3]; \
+    vm.r[4] = r[4]; vm.r[5] = r[5]; vm.r[6] = r[6]; \
+    vm.Z = Z; vm.N = N; vm.C = C; vm.V = V
+
+// the checks of run1() per block: the stack and the flight recorder
+#define AOT_BLOCK(pc, n) \
+    if (r[6] < vm.brksize) { \
+        vm.r[7] = pc; \
+        goto interp; \
+    } \
+    vm.recent[vm.insns % FLIGHT_PCS] = pc; \
+    vm.insns += n
+
+#define AOT_GOTO(pc, label) \
+    do { \
+        if (UnixBase::sigpending) { \
+            vm.r[7] = pc; \
+            goto save; \
+        } \
+        goto label; \
+    } while (0)
+
+#define AOT_JUMP(pc) \
+    do { \
+        vm.r[7] = pc; \
+        if (UnixBase::sigpending) goto save; \
+        goto dispatch; \
+    } while (0)
+
+#define AOT_INTERP(pc) \
+    do { \
+        vm.r[7] = pc; \
+        goto interp; \
+    } while (0)
+
+// the interpreter runs vm.r[7] until it reaches a translated block
+#define AOT_RUNTIME \
+save: \
+    AOT_SAVE; \
+    goto poll; \
+interp: \
+    AOT_SAVE; \
+    vm.run1(); \
+poll: \
+    if (UnixBase::sigpending) vm.unix->sigcheck(); \
+    if (vm.hasExited || vm.aot != self) return; \
+    mem = vm.data; \
+    AOT_LOAD; \
+dispatch:
@@ -0,0 +1,143 @@
+#include "Profile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+
+std::string profpath, graphpath;
+int profstep = 1000, profcount;
+
+Profile::Profile() : total(0) {
+}
+
+void Profile::clear() {
+    counts.clear();
+    stacks.clear();
+    total = 0;
+}
+
+static std::string symname(VMBase *vm, int addr) {
+    char buf[16];
+    std::map<int, Symbol>::iterator it = vm->syms[1].upper_bound(addr);
+    if (it == vm->syms[1].begin()) {
+        snprintf(buf, sizeof (buf), "?%04x", addr);
+        return buf;
+    }
+    --it;
+    return it->second.name;
+}
+
+void Profile::sample(VMBase *vm) {
+    uint16_t pc = vm->getpc();
+    ++counts[pc];
+    ++total;
+    if (!callgraph) return;
+    size_t p = name.rfind('/');
+    std::string key = p == std::string::npos ? name : name.substr(p + 1);
+    std::string leaf = symname(vm, pc), last;
+    for (int i = 0; i < (int) vm->calls.size(); i++) {
+        key += ";" + (last = symname(vm, vm->calls[i].addr));
+    }
+    // without symbols the innermost call target stands for the function
+    if (leaf != last && (!vm->syms[1].empty() || vm->calls.empty())) {
+        key += ";" + leaf;
+    }
+    ++stacks[key];
+}
+
+static void append(const std::string &path, const std::string &out) {
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0666);
+    if (fd >= 0) {
+        write(fd, out.data(), out.size());
+        close(fd);
+    }
+}
+
+static bool bycount(const std::pair<int, std::string> &a,
+        const std::pair<int, std::string> &b) {
+    return a.first != b.first ? a.first > b.first : a.second < b.second;
+}
+
+// append the flat profile and per-address counts to profpath,
+// and the collapsed stacks ("a;b;c count") to graphpath
+void Profile::report(VMBase *vm) {
+    if (!total) return;
+    if (!graphpath.empty()) {
+        std::string out;
+        char buf[16];
+        std::map<std::string, int>::iterator it;
+        for (it = stacks.begin(); it != stacks.end(); ++it) {
+            snprintf(buf, sizeof (buf), " %d\n", it->second);
+            out += it->first + buf;
+        }
+        append(graphpath, out);
+    }
+    if (profpath.empty()) {
+        clear();
+        return;
+    }
+    std::map<std::string, int> self;
+    std::map<int, int>::iterator it;
+    for (it = counts.begin(); it != counts.end(); ++it) {
+        self[symname(vm, it->first)] += it->second;
+    }
+    std::vector<std::pair<int, std::string> > flat;
+    std::map<std::string, int>::iterator it2;
+    for (it2 = self.begin(); it2 != self.end(); ++it2) {
+        flat.push_back(std::make_pair(it2->second, it2->first));
+    }
+    std::sort(flat.begin(), flat.end(), bycount);
+
+    std::string out;
+    char buf[256];
+    snprintf(buf, sizeof (buf), "# %s (pid %d): %d samples, %llu instructions\n",
+            name.c_str(), getpid(), total,
+            (unsigned long long) (vm->insns - vm->execinsns));
+    out += buf;
+    out += "#    self      %  symbol\n";
+    for (int i = 0; i < (int) flat.size(); i++) {
+        snprintf(buf, sizeof (buf), "%9d %5.1f%%  %s\n", flat[i].first,
+                flat[i].first * 100.0 / total, flat[i].second.c_str());
+        out += buf;
+    }
+    out += "#   addr  count  symbol\n";
+    for (it = counts.begin(); it != counts.end(); ++it) {
+        int addr = it->first, off = 0;
+        std::map<int, Symbol>::iterator s = vm->syms[1].upper_bound(addr);
+        if (s != vm->syms[1].begin()) off = addr - (--s)->first;
+        snprintf(buf, sizeof (buf), "   %04x %6d  %s+0x%x\n",
+                addr, it->second, symname(vm, addr).c_str(), off);
+        out += buf;
+    }
+    out += "\n";
+    append(profpath, out);
+    clear();
+}
+
+// sum the stacks appended by every process and image
+void graphmerge() {
+    FILE *f = fopen(graphpath.c_str(), "r");
+    if (!f) return;
+    std::map<std::string, int> stacks;
+    std::string line; // stacks have no length limit
+    for (int c; (c = getc(f)) != EOF;) {
+        if (c != '\n') {
+            line += char(c);
+            continue;
+        }
+        size_t p = line.rfind(' ');
+        if (p != std::string::npos) {
+            stacks[line.substr(0, p)] += atoi(line.c_str() + p + 1);
+        }
+        line.clear();
+    }
+    fclose(f);
+    if (!(f = fopen(graphpath.c_str(), "w"))) return;
+    std::map<std::string, int>::iterator it;
+    for (it = stacks.begin(); it != stacks.end(); ++it) {
+        fprintf(f, "%s %d\n", it->first.c_str(), it->second);
+    }
+    fclose(f);
+}
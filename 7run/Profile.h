@@ -0,0 +1,25 @@
+#pragma once
+#include "VMBase.h"
+#include <map>
+
+// guest PC sampling profiler (-P): the PC is sampled every profstep
+// instructions and attributed to the enclosing text symbol.
+// with -G, the shadow call stack is sampled as well (collapsed stacks)
+
+extern std::string profpath, graphpath;
+extern int profstep, profcount;
+
+struct Profile {
+    std::string name;
+    std::map<int, int> counts;
+    std::map<std::string, int> stacks;
+    int total;
+
+    Profile();
+
+    void sample(VMBase *vm);
+    void clear();
+    void report(VMBase *vm);
+};
+
+void graphmerge();
@@ -0,0 +1,98 @@
+#include "Snapshot.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#ifndef WIN32
+#include <sys/mman.h>
+#endif
+
+std::string snapdir, snapat;
+
+static const char magic[8] = {'7', 'R', 'U', 'N', 'S', 'N', 'P', '1'};
+
+std::string snappath(const std::string &os, uint32_t hash) {
+    char buf[16];
+    snprintf(buf, sizeof (buf), "/%08x-", hash);
+    return snapdir + buf + os + ".snap";
+}
+
+// written to a temporary file and renamed: concurrent runs see the whole
+// snapshot or none
+bool snapwrite(const std::string &path, Snapshot *s) {
+    char buf[16];
+    snprintf(buf, sizeof (buf), ".%d", getpid());
+    std::string tmp = path + buf;
+    FILE *f = fopen(tmp.c_str(), "wb");
+    if (!f) return false;
+    memcpy(s->h.magic, magic, sizeof (magic));
+    s->h.nfiles = s->files.size();
+    bool ok = fwrite(&s->h, sizeof (s->h), 1, f) == 1;
+    for (int i = 0; ok && i < (int) s->files.size(); i++) {
+        SnapFile &sf = s->files[i];
+        sf.len = s->paths[i].size();
+        ok = fwrite(&sf, sizeof (sf), 1, f) == 1
+                && fwrite(s->paths[i].data(), 1, sf.len, f) == sf.len;
+    }
+    ok = ok && ftell(f) <= SNAP_ALIGN && !fseek(f, SNAP_ALIGN, SEEK_SET)
+            && fwrite(s->text, 1, 0x10000, f) == 0x10000
+            && (s->h.shared || fwrite(s->data, 1, 0x10000, f) == 0x10000);
+    if (fclose(f) || !ok || rename(tmp.c_str(), path.c_str())) {
+        unlink(tmp.c_str());
+        return false;
+    }
+    return true;
+}
+
+#ifdef WIN32
+static uint8_t *mapimage(FILE *f, int n) {
+    uint8_t *p = new uint8_t[0x10000];
+    if (!fseek(f, SNAP_ALIGN * (n + 1), SEEK_SET)
+            && fread(p, 1, 0x10000, f) == 0x10000) return p;
+    delete[] p;
+    return NULL;
+}
+
+void snapunmap(uint8_t *text, uint8_t *data) {
+    if (data && data != text) delete[] data;
+    if (text) delete[] text;
+}
+#else
+// private: the pages are shared with the other runs until written
+static uint8_t *mapimage(FILE *f, int n) {
+    void *p = mmap(NULL, 0x10000, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+            fileno(f), off_t(SNAP_ALIGN) * (n + 1));
+    return p == MAP_FAILED ? NULL : (uint8_t *) p;
+}
+
+void snapunmap(uint8_t *text, uint8_t *data) {
+    if (data && data != text) munmap(data, 0x10000);
+    if (text) munmap(text, 0x10000);
+}
+#endif
+
+bool snapread(const std::string &path, Snapshot *s) {
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    bool ok = fread(&s->h, sizeof (s->h), 1, f) == 1
+            && !memcmp(s->h.magic, magic, sizeof (magic));
+    for (int i = 0; ok && i < s->h.nfiles; i++) {
+        SnapFile sf;
+        ok = fread(&sf, sizeof (sf), 1, f) == 1;
+        std::string p(ok ? sf.len : 0, '\0');
+        if (ok && sf.len) ok = fread(&p[0], 1, sf.len, f) == sf.len;
+        s->files.push_back(sf);
+        s->paths.push_back(p);
+    }
+    // a short file would fault at the mapped pages
+    int n = s->h.shared ? 1 : 2;
+    ok = ok && !fseek(f, 0, SEEK_END) && ftell(f) >= long(SNAP_ALIGN) * (n + 1);
+    s->text = s->data = NULL;
+    if (ok) {
+        s->text = mapimage(f, 0);
+        s->data = n == 1 ? s->text : mapimage(f, 1);
+        ok = s->text && s->data;
+        if (!ok) snapunmap(s->text, s->data);
+    }
+    fclose(f);
+    return ok;
+}
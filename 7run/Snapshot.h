@@ -0,0 +1,58 @@
+#pragma once
+#include "XTrace.h"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// snapshots of initialized processes (--snap-dir, --snap-at): an image
+// that reaches the point (a symbol such as _main, or a number of
+// instructions after exec) is written to dir/<hash>-<os>.snap with its
+// registers, memory, brk, signal dispositions and the descriptors the
+// start-up code opened. the next load of the same image maps the snapshot
+// copy-on-write instead of running the start-up code, and the arguments
+// placed by setArgs() or exec are patched into the stack frame of the
+// point. the point should come before the program reads its arguments.
+
+extern std::string snapdir; // --snap-dir, empty: off
+extern std::string snapat; // --snap-at, empty: restore only
+
+static const int SNAP_SIGS = 36;
+static const int SNAP_ALIGN = 0x10000; // text and data in the file
+
+struct SnapHeader {
+    char magic[8], os[8];
+    uint32_t hash; // of the image at load
+    uint64_t insns; // retired since exec
+    uint16_t state[XT_STATE]; // getstate()
+    uint16_t sp, pc; // indices in state
+    uint16_t start_sp, argc, brksize, umask;
+    uint16_t sigs[SNAP_SIGS];
+    uint16_t shared; // data is text
+    uint16_t nfiles;
+};
+
+// a descriptor that the start-up code closed or opened, the others are
+// inherited from the process that loads the image
+struct SnapFile {
+    enum {
+        Closed, Opened
+    };
+    int16_t type, fd;
+    int32_t flag;
+    int64_t offset;
+    uint16_t len; // of the path that follows
+};
+
+struct Snapshot {
+    SnapHeader h;
+    std::vector<SnapFile> files;
+    std::vector<std::string> paths;
+    uint8_t *text, *data;
+    std::vector<uint8_t> stack; // [brksize, start_sp] of the snapshot
+    std::vector<uint16_t> ptrs; // data words set to the stack by start-up
+};
+
+std::string snappath(const std::string &os, uint32_t hash);
+bool snapwrite(const std::string &path, Snapshot *s);
+bool snapread(const std::string &path, Snapshot *s);
+void snapunmap(uint8_t *text, uint8_t *data);
@@ -0,0 +1,149 @@
+#include "Stats.h"
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+
+std::string statspath;
+int statsmode, cyclemodel;
+
+static const int PAIRS_MAX = 32;
+
+Stats::Stats() {
+    clear();
+}
+
+// ids start from 1 so that 0 marks an unknown PC
+int Stats::id(const char *mne, int sub, const std::string &name) {
+    std::pair<const char *, int> key(mne, sub);
+    std::map<std::pair<const char *, int>, int>::iterator it = ids.find(key);
+    if (it != ids.end()) return it->second;
+    int ret = names.size();
+    ids[key] = ret;
+    names.push_back(name);
+    counts.push_back(0);
+    return ret;
+}
+
+void Stats::clear() {
+    std::vector<Inst>().swap(insts);
+    names.clear();
+    counts.clear();
+    ids.clear();
+    pairs.clear();
+    syscalls.clear();
+    names.push_back("");
+    counts.push_back(0);
+    total = reps = reads = writes = cycles = 0;
+    last = 0;
+}
+
+template <typename T>
+static bool bycount(const std::pair<uint64_t, T> &a,
+        const std::pair<uint64_t, T> &b) {
+    return a.first != b.first ? a.first > b.first : a.second < b.second;
+}
+
+static std::string u64(uint64_t v) {
+    char buf[24];
+    snprintf(buf, sizeof (buf), "%llu", (unsigned long long) v);
+    return buf;
+}
+
+static std::string quote(const std::string &s) {
+    std::string ret = "\"";
+    for (int i = 0; i < (int) s.size(); i++) {
+        if (s[i] == '"' || s[i] == '\\') ret += '\\';
+        ret += s[i];
+    }
+    return ret + "\"";
+}
+
+// append the counters of the image to statspath as a table or a JSON line
+void Stats::report() {
+    if (statspath.empty() || !total) {
+        clear();
+        return;
+    }
+    std::vector<std::pair<uint64_t, int> > ops;
+    for (int i = 1; i < (int) counts.size(); i++) {
+        if (counts[i]) ops.push_back(std::make_pair(counts[i], i));
+    }
+    std::sort(ops.begin(), ops.end(), bycount<int>);
+    std::vector<std::pair<uint64_t, uint32_t> > prs;
+    std::map<uint32_t, uint64_t>::iterator it;
+    for (it = pairs.begin(); it != pairs.end(); ++it) {
+        prs.push_back(std::make_pair(it->second, it->first));
+    }
+    std::sort(prs.begin(), prs.end(), bycount<uint32_t>);
+    if (prs.size() > (size_t) PAIRS_MAX) prs.resize(PAIRS_MAX);
+    std::map<int, uint64_t>::iterator it2;
+
+    std::string out;
+    char buf[256];
+    if (statsmode == 2) {
+        snprintf(buf, sizeof (buf), "{\"image\": %s, \"pid\": %d",
+                quote(name).c_str(), getpid());
+        out += buf;
+        out += ", \"instructions\": " + u64(total);
+        out += ", \"reps\": " + u64(reps);
+        out += ", \"reads\": " + u64(reads);
+        out += ", \"writes\": " + u64(writes);
+        if (cyclemodel) out += ", \"cycles\": " + u64(cycles);
+        out += ", \"ops\": {";
+        for (int i = 0; i < (int) ops.size(); i++) {
+            if (i) out += ", ";
+            out += quote(names[ops[i].second]) + ": " + u64(ops[i].first);
+        }
+        out += "}, \"pairs\": {";
+        for (int i = 0; i < (int) prs.size(); i++) {
+            if (i) out += ", ";
+            std::string p = names[prs[i].second >> 16] + " > "
+                    + names[prs[i].second & 0xffff];
+            out += quote(p) + ": " + u64(prs[i].first);
+        }
+        out += "}, \"syscalls\": {";
+        for (it2 = syscalls.begin(); it2 != syscalls.end(); ++it2) {
+            if (it2 != syscalls.begin()) out += ", ";
+            snprintf(buf, sizeof (buf), "\"%d\": ", it2->first);
+            out += buf + u64(it2->second);
+        }
+        out += "}}\n";
+    } else {
+        snprintf(buf, sizeof (buf), "# %s (pid %d): %s instructions\n",
+                name.c_str(), getpid(), u64(total).c_str());
+        out += buf;
+        out += "#        count      %  instruction\n";
+        for (int i = 0; i < (int) ops.size(); i++) {
+            snprintf(buf, sizeof (buf), "%14s %5.1f%%  %s\n",
+                    u64(ops[i].first).c_str(), ops[i].first * 100.0 / total,
+                    names[ops[i].second].c_str());
+            out += buf;
+        }
+        out += "#        count      %  pair\n";
+        for (int i = 0; i < (int) prs.size(); i++) {
+            snprintf(buf, sizeof (buf), "%14s %5.1f%%  %s > %s\n",
+                    u64(prs[i].first).c_str(), prs[i].first * 100.0 / total,
+                    names[prs[i].second >> 16].c_str(),
+                    names[prs[i].second & 0xffff].c_str());
+            out += buf;
+        }
+        out += "#        count  syscall\n";
+        for (it2 = syscalls.begin(); it2 != syscalls.end(); ++it2) {
+            snprintf(buf, sizeof (buf), "%14s  %d\n",
+                    u64(it2->second).c_str(), it2->first);
+            out += buf;
+        }
+        out += "# rep iterations: " + u64(reps);
+        out += ", memory operand reads: " + u64(reads);
+        out += ", writes: " + u64(writes);
+        if (cyclemodel) out += ", cycles: " + u64(cycles);
+        out += "\n\n";
+    }
+    int fd = ::open(statspath.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0666);
+    if (fd >= 0) {
+        write(fd, out.data(), out.size());
+        close(fd);
+    }
+    clear();
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <map>
+
+// instruction statistics (--stats): counted by VM::run2stats(), a separate
+// loop used only in this mode so that run2() pays nothing
+
+extern std::string statspath;
+extern int statsmode; // 0: off, 1: table, 2: JSON
+extern int cyclemodel; // --cycles: 0: off, 40 or 45 (PDP-11/40, 11/45)
+
+struct Stats {
+    // per PC: instruction id, explicit memory operand reads/writes, and
+    // cycles with extra cycles for a taken branch or per rep iteration
+    // (8086: clocks, PDP-11: ns of the modelled processor)
+    struct Inst {
+        int id;
+        uint8_t reads, writes, len;
+        uint16_t cycles, extra;
+    };
+
+    std::string name;
+    std::vector<Inst> insts;
+    std::vector<std::string> names;
+    std::vector<uint64_t> counts;
+    std::map<std::pair<const char *, int>, int> ids;
+    std::map<uint32_t, uint64_t> pairs;
+    std::map<int, uint64_t> syscalls;
+    uint64_t total, reps, reads, writes, cycles;
+    int last;
+
+    Stats();
+
+    int id(const char *mne, int sub, const std::string &name);
+    void clear();
+    void report();
+
+    inline Inst *inst(uint16_t pc) {
+        if (insts.empty()) insts.resize(0x10000);
+        Inst *in = &insts[pc];
+        return in->id ? in : NULL;
+    }
+
+    inline void count(const Inst *in) {
+        int id = in->id;
+        ++counts[id];
+        if (last) ++pairs[uint32_t(last) << 16 | id];
+        last = id;
+        ++total;
+        reads += in->reads;
+        writes += in->writes;
+        cycles += in->cycles;
+    }
+};
@@ -0,0 +1,94 @@
+#include "SysTrace.h"
+#include "utils.h"
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+#include <map>
+
+std::string systracepath;
+bool systrace;
+
+static const int RECORDS_MAX = 4096;
+
+static std::vector<SysRecord> records, pending;
+static std::map<std::string, uint32_t> strids;
+static std::string strs;
+
+// records nest when a vforked child runs inside the parent's fork
+void systrace_begin(int os, int pid, int n, int a0, int a1, int a2, int a3) {
+    SysRecord r;
+    memset(&r, 0, sizeof (r));
+    r.pid = pid;
+    r.num = n;
+    r.os = os;
+    r.args[0] = a0;
+    r.args[1] = a1;
+    r.args[2] = a2;
+    r.args[3] = a3;
+    pending.push_back(r);
+    pending.back().start = nanotime();
+}
+
+// the first path of the current system call is recorded
+void systrace_path(const std::string &path) {
+    if (pending.empty() || pending.back().path) return;
+    std::map<std::string, uint32_t>::iterator it = strids.find(path);
+    if (it != strids.end()) {
+        pending.back().path = it->second;
+        return;
+    }
+    uint32_t id = strids.size() + 1;
+    strids[path] = id;
+    strs.append((const char *) &id, sizeof (id));
+    strs.append(path.c_str(), path.size() + 1);
+    pending.back().path = id;
+}
+
+void systrace_end(int result) {
+    if (pending.empty()) return;
+    int err = errno;
+    SysRecord r = pending.back();
+    pending.pop_back();
+    r.time = nanotime() - r.start;
+    r.result = result;
+    if (result == -1) r.err = err;
+    records.push_back(r);
+    if (records.size() >= (size_t) RECORDS_MAX) systrace_flush();
+    errno = err;
+}
+
+// a forked host process starts its own records and string ids, the fork
+// in progress is the parent's record
+void systrace_fork() {
+    records.clear();
+    pending.clear();
+    strids.clear();
+    strs.clear();
+}
+
+void systrace_flush() {
+    if (records.empty() && strs.empty()) return;
+    SysChunk ch;
+    memcpy(ch.magic, "7SYS", 4);
+    ch.hostpid = getpid();
+    ch.nrec = records.size();
+    ch.strsize = strs.size();
+    std::string out((const char *) &ch, sizeof (ch));
+    out += strs;
+    if (!records.empty()) {
+        out.append((const char *) &records[0], records.size() * sizeof (SysRecord));
+    }
+    int flag = O_WRONLY | O_CREAT | O_APPEND;
+#ifdef WIN32
+    flag |= O_BINARY;
+#endif
+    int fd = ::open(systracepath.c_str(), flag, 0666);
+    if (fd >= 0) {
+        write(fd, out.data(), out.size());
+        close(fd);
+    }
+    records.clear();
+    strs.clear();
+}
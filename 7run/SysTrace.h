@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+#include <string>
+
+// binary system call recorder (-S): fixed-size records are kept in memory
+// and appended to systracepath in chunks. decoded by 7sysdump.
+//
+// chunk: SysChunk, strsize bytes of interned strings ({uint32_t id, char[]}
+// NUL terminated), nrec SysRecords. string ids are local to the host pid.
+
+extern std::string systracepath;
+extern bool systrace;
+
+enum {
+    SYSTRACE_V6 = 0, // UNIX V6/V7 numbering (PDP-11, 8086)
+    SYSTRACE_MINIX = 1,
+};
+
+struct SysChunk {
+    char magic[4]; // "7SYS"
+    uint32_t hostpid, nrec, strsize;
+};
+
+struct SysRecord {
+    uint32_t pid; // guest pid
+    uint16_t num;
+    uint8_t os, pad1;
+    uint16_t args[4];
+    int32_t result, err;
+    uint32_t path; // interned string id, 0: none
+    uint32_t pad2;
+    uint64_t start, time; // host ns
+};
+
+void systrace_begin(int os, int pid, int n, int a0, int a1, int a2, int a3);
+void systrace_path(const std::string &path);
+void systrace_end(int result);
+void systrace_fork();
+void systrace_flush();
@@ -0,0 +1,173 @@
+#include "Timeline.h"
+#include "utils.h"
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+std::string timelinepath;
+bool timeline;
+
+static const size_t BUFFER_MAX = 1 << 20;
+static const uint64_t SYSCALL_MIN = 100000; // ns: shorter calls are only summed
+
+static uint64_t epoch;
+static std::string events;
+
+static std::string quote(const std::string &s) {
+    std::string ret = "\"";
+    for (size_t i = 0; i < s.size(); i++) {
+        unsigned char ch = s[i];
+        if (ch == '"' || ch == '\\') {
+            ret += '\\';
+            ret += ch;
+        } else if (ch < 0x20 || ch >= 0x7f) {
+            char buf[8];
+            snprintf(buf, sizeof (buf), "\\u%04x", ch);
+            ret += buf;
+        } else {
+            ret += ch;
+        }
+    }
+    return ret + "\"";
+}
+
+// the common fields; the caller appends the rest and closes the brace
+static std::string head(const std::string &name, const char *cat,
+        const char *ph, int pid, uint64_t t) {
+    char buf[128];
+    snprintf(buf, sizeof (buf),
+            ", \"cat\": \"%s\", \"ph\": \"%s\", \"pid\": %d, \"tid\": %d, \"ts\": %.3f",
+            cat, ph, pid, pid, (t - epoch) / 1000.0);
+    return "{\"name\": " + quote(name) + buf;
+}
+
+static std::string imagename(const std::string &path) {
+    size_t p = path.rfind('/');
+    return p == std::string::npos ? path : path.substr(p + 1);
+}
+
+static void add(const std::string &ev) {
+    events += ev;
+    events += ",\n";
+    if (events.size() >= BUFFER_MAX) timeline_flush();
+}
+
+static void flow(const char *name, const char *ph, int pid, int id) {
+    char buf[64];
+    snprintf(buf, sizeof (buf), ", \"id\": %d%s}", id,
+            *ph == 'f' ? ", \"bp\": \"e\"" : "");
+    add(head(name, "flow", ph, pid, nanotime()) + buf);
+}
+
+TimeSpan::TimeSpan()
+: start(0), sysstart(0), systime(0), insns(0), syscalls(0), forked(false) {
+}
+
+void TimeSpan::begin(int pid, const std::string &name, uint64_t insns) {
+    this->name = name;
+    this->insns = insns;
+    start = nanotime();
+    // a span begins inside exec or fork: the call is counted from here
+    if (sysstart) sysstart = start;
+    systime = 0;
+    syscalls = 0;
+    char buf[128];
+    snprintf(buf, sizeof (buf), "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, \"tid\": %d, \"args\": {\"name\": ",
+            pid, pid);
+    add(buf + quote(imagename(name)) + "}}");
+}
+
+void TimeSpan::end(int pid, uint64_t insns) {
+    if (!start) return;
+    uint64_t dur = nanotime() - start;
+    uint64_t interp = dur > systime ? dur - systime : 0;
+    char buf[256];
+    snprintf(buf, sizeof (buf),
+            ", \"dur\": %.3f, \"args\": {\"instructions\": %llu, \"syscalls\": %d, \"syscall_us\": %.3f, \"interp_us\": %.3f, \"path\": ",
+            dur / 1000.0, (unsigned long long) (insns - this->insns), syscalls, systime / 1000.0, interp / 1000.0);
+    add(head(imagename(name), "image", "X", pid, start) + buf + quote(name) + "}}");
+    start = 0;
+}
+
+// flow ids: fork 2 * child pid, exit/wait 2 * child pid + 1
+void TimeSpan::fork(int ppid, int pid, const std::string &name, uint64_t insns) {
+    begin(pid, name, insns);
+    forked = true;
+    flow("fork", "s", ppid, pid * 2);
+    flow("fork", "f", pid, pid * 2);
+}
+
+void TimeSpan::exit(int pid, uint64_t insns) {
+    if (forked) flow("exit", "s", pid, pid * 2 + 1);
+    end(pid, insns);
+}
+
+void TimeSpan::sysbegin() {
+    sysstart = nanotime();
+}
+
+void TimeSpan::sysend(int pid, const std::string &name) {
+    if (!sysstart) return;
+    uint64_t dur = nanotime() - sysstart;
+    systime += dur;
+    ++syscalls;
+    if (dur >= SYSCALL_MIN) {
+        char buf[64];
+        snprintf(buf, sizeof (buf), ", \"dur\": %.3f}", dur / 1000.0);
+        add(head(name, "syscall", "X", pid, sysstart) + buf);
+    }
+    sysstart = 0;
+}
+
+void timeline_open() {
+    epoch = nanotime();
+    FILE *f = fopen(timelinepath.c_str(), "wb");
+    if (!f) return;
+    fputs("[\n", f);
+    fclose(f);
+}
+
+void timeline_wait(int pid, int child) {
+    flow("exit", "f", pid, child * 2 + 1);
+}
+
+// a forked host process leaves the parent's buffered events to the parent
+void timeline_forkchild() {
+    events.clear();
+}
+
+void timeline_flush() {
+    if (events.empty()) return;
+    int flag = O_WRONLY | O_CREAT | O_APPEND;
+#ifdef WIN32
+    flag |= O_BINARY;
+#endif
+    int fd = ::open(timelinepath.c_str(), flag, 0666);
+    if (fd >= 0) {
+        write(fd, events.data(), events.size());
+        close(fd);
+    }
+    events.clear();
+}
+
+// the top-level process drops the last separator and closes the array
+void timeline_close(bool top) {
+    timeline_flush();
+    if (!top) return;
+    int flag = O_RDWR;
+#ifdef WIN32
+    flag |= O_BINARY;
+#endif
+    int fd = ::open(timelinepath.c_str(), flag);
+    if (fd < 0) return;
+    off_t size = lseek(fd, 0, SEEK_END);
+    char buf[2];
+    if (size > 2 && lseek(fd, size - 2, SEEK_SET) == size - 2
+            && read(fd, buf, 2) == 2 && buf[0] == ',') {
+        ftruncate(fd, size - 2);
+        lseek(fd, size - 2, SEEK_SET);
+        write(fd, "\n", 1);
+    }
+    write(fd, "]\n", 2);
+    close(fd);
+}
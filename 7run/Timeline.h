@@ -0,0 +1,36 @@
+#pragma once
+#include <stdint.h>
+#include <string>
+
+// Chrome trace event timeline (--timeline): one track per guest pid with a
+// span for each executed image, spans of slow system calls and flow arrows
+// for fork and exit/wait. every host process appends its events to
+// timelinepath in the JSON array format; the top-level process writes the
+// brackets. load in chrome://tracing or ui.perfetto.dev.
+
+extern std::string timelinepath;
+extern bool timeline;
+
+// the image a guest process is running
+struct TimeSpan {
+    std::string name;
+    uint64_t start, sysstart, systime; // host ns
+    uint64_t insns;
+    int syscalls;
+    bool forked;
+
+    TimeSpan();
+
+    void begin(int pid, const std::string &name, uint64_t insns);
+    void end(int pid, uint64_t insns);
+    void fork(int ppid, int pid, const std::string &name, uint64_t insns);
+    void exit(int pid, uint64_t insns);
+    void sysbegin();
+    void sysend(int pid, const std::string &name);
+};
+
+void timeline_open();
+void timeline_wait(int pid, int child);
+void timeline_forkchild();
+void timeline_flush();
+void timeline_close(bool top);
@@ -1,35 +1,47 @@
 #include "UnixBase.h"
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include <errno.h>
 #include <signal.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/stat.h>
 
-UnixBase *UnixBase::current;
+volatile sig_atomic_t UnixBase::sigpending, UnixBase::flightpending;
+volatile sig_atomic_t UnixBase::sigpend[32];
 
 static int createpid() {
+    if (memo) return memo_pid(0, 0); // children: childpid(), vfork()
 #ifdef NO_FORK
-    static int pid_max;
-    return ((getpid() << 4) % 30000) + (++pid_max);
+    return ((getpid() << 4) % 30000) + (++ctx->lastpid);
 #else
     return (getpid() % 30000) + 1;
 #endif
 }
 
-UnixBase::UnixBase() : umask(0) {
+UnixBase::UnixBase()
+: umask(0), recentsyspos(0), killed(false), snap(NULL), nforks(0) {
+#ifdef NO_FORK
+    vforked = false;
+#endif
     exitcode = 0;
     pid = createpid();
-    files.push_back(new File(0, "stdin"));
-    files.push_back(new File(1, "stdout"));
-    files.push_back(new File(2, "stderr"));
+    files.push_back(openfile(0, "stdin"));
+    files.push_back(openfile(1, "stdout"));
+    files.push_back(openfile(2, "stderr"));
 }
 
-UnixBase::UnixBase(const UnixBase &os) {
+UnixBase::UnixBase(const UnixBase &os)
+: recentsyspos(0), killed(false), snap(NULL), nforks(0) {
+#ifdef NO_FORK
+    vforked = false;
+#endif
     exitcode = 0;
     pid = createpid();
     umask = os.umask;
+    prof.name = os.prof.name;
+    sigframes = os.sigframes;
     files = os.files;
     for (int i = 0; i < (int) files.size(); i++) {
         FileBase *f = files[i];
@@ -41,36 +53,84 @@ UnixBase::~UnixBase() {
     for (int i = 0; i <= (int) files.size(); i++) {
         close(i);
     }
+    delete snap;
 }
 
 bool UnixBase::load(const std::string &fn) {
+    BufFile::flushall();
+    if (systrace) systrace_path(fn);
     std::string fn2 = convpath(fn);
     const char *file = fn2.c_str();
     FILE *f = fopen(file, "rb");
+    if (memolog) memo_read(fn, f != NULL);
     if (!f) {
         fprintf(stderr, "can not open: %s\n", file);
         return false;
     }
-    struct stat st;
-    fstat(fileno(f), &st);
-    bool ret = load2(fn, f, st.st_size);
+    return load(fn, f);
+}
+
+// the image is read from f (a host file or a buffer), which is closed
+bool UnixBase::load(const std::string &fn, FILE *f) {
+    fseek(f, 0, SEEK_END);
+    size_t size = ftell(f);
+    rewind(f);
+    prof.report(vm);
+    prof.name = fn;
+    vm->cycles += vm->stats.cycles;
+    vm->stats.report();
+    vm->stats.name = fn;
+    vm->xtrace.exec();
+    vm->syms[0].clear();
+    vm->syms[1].clear();
+    vm->calls.clear();
+    vm->aot = NULL;
+    if (timeline) span.end(pid, vm->insns);
+    vm->execinsns = vm->insns;
+    if (timeline) span.begin(pid, fn, vm->insns);
+    bool ret = load2(fn, f, size);
     fclose(f);
+    if (ret && !snapdir.empty()) snapload();
+    if (vm->aot || vm->snappending) sigpending = 1; // to the run2() dispatch
     return ret;
 }
 
 int UnixBase::run(
         const std::vector<std::string> &args,
         const std::vector<std::string> &envs) {
-    if (trace >= 2) vm->showHeader();
+    if (ctx->trace >= 2) vm->showHeader();
     setArgs(args, envs);
+    snaprestore();
     return run();
 }
 
 int UnixBase::run() {
-    UnixBase *from = current;
+    UnixBase *from = ctx->current;
     swtch(this);
-    vm->hasExited = false;
+    vm->hasExited = killed;
     vm->run2();
+#ifdef NO_FORK
+    if (!vforked)
+#endif
+    {
+        prof.report(vm);
+        vm->cycles += vm->stats.cycles;
+        vm->stats.report();
+        if (timeline) span.exit(pid, vm->insns);
+        if (insncount) {
+            char buf[64];
+            std::string s = prof.name;
+            snprintf(buf, sizeof (buf), " (pid %d): %llu instructions",
+                    pid, (unsigned long long) vm->insns);
+            s += buf;
+            if (cyclemodel) {
+                snprintf(buf, sizeof (buf), ", %llu cycles",
+                        (unsigned long long) vm->cycles);
+                s += buf;
+            }
+            fprintf(stderr, "%s\n", s.c_str());
+        }
+    }
     swtch(from);
     return exitcode;
 }
@@ -88,11 +148,11 @@ int UnixBase::open(const std::string &path, int flag, int mode) {
 #ifdef WIN32
     flag |= O_BINARY;
 #endif
-    File *f = new File(path, flag, mode);
-    if (f->fd == -1) {
-        delete f;
-        return -1;
-    }
+    return open(openfile(path, flag, mode));
+}
+
+int UnixBase::open(FileBase *f) {
+    if (!f) return -1;
     int fd = getfd();
     files[fd] = f;
     return fd;
@@ -119,5 +179,199 @@ FileBase *UnixBase::file(int fd) {
 void UnixBase::swtch(UnixBase *to) {
     if (to) to->swtch();
     else swtch(true);
-    current = to;
+    if (to && !to->sigframes.empty()) sigpending = 1;
+    ctx->current = to;
+}
+
+// Host signals are only recorded here. sigcheck() enters the guest handler
+// between instructions and returns to the run loop, which then runs the
+// handler like any other code. While a handler has not returned,
+// sigpending stays set so that sigcheck() sees it return.
+void UnixBase::sighandler(int sig) {
+    if (sig < 32) {
+        sigpend[sig] = 1;
+        sigpending = 1;
+    }
+}
+
+void UnixBase::sigcheck() {
+    sigpending = 0;
+    if (!sigframes.empty()) sigreturn();
+    if (flightpending) {
+        flightpending = 0;
+        flightdump();
+    }
+    for (int i = 1; i < 32; i++) {
+        if (sigpend[i]) {
+            sigpend[i] = 0;
+            if (memo) memo_taint("signal");
+            sighandler2(i);
+        }
+    }
+    if (!sigframes.empty()) sigpending = 1;
+}
+
+// the interval is randomized so that samples do not alias with loops
+void UnixBase::profsample() {
+    profcount = profstep / 2 + rand() % profstep + 1;
+    prof.sample(vm);
+}
+
+// SIGUSR1: dump the flight recorder at the next instruction boundary
+void UnixBase::flighthandler(int) {
+    flightpending = 1;
+    sigpending = 1;
+}
+
+int UnixBase::hletest() {
+    fprintf(stderr, "no high-level emulation for this CPU\n");
+    return 1;
+}
+
+int UnixBase::aotgen(FILE *, const std::string &) {
+    fprintf(stderr, "no ahead-of-time translation for this CPU\n");
+    return 1;
+}
+
+std::string UnixBase::sysname(int) {
+    return "";
 }
+
+std::string UnixBase::syslabel(int n) {
+    std::string name = sysname(n);
+    if (name.empty()) {
+        char buf[16];
+        snprintf(buf, sizeof (buf), "sys%d", n);
+        name = buf;
+    }
+    return name;
+}
+
+void UnixBase::sysbegin(int os, int n, const int *args) {
+    RecentSys &rs = recentsys[recentsyspos++ % FLIGHT_SYSCALLS];
+    rs.n = n;
+    memcpy(rs.args, args, sizeof (rs.args));
+    rs.done = false;
+    if (systrace) systrace_begin(os, pid, n, args[0], args[1], args[2], args[3]);
+    if (timeline) span.sysbegin();
+}
+
+void UnixBase::sysend(int result) {
+    RecentSys &rs = recentsys[(recentsyspos - 1) % FLIGHT_SYSCALLS];
+    rs.result = result;
+    rs.err = result == -1 ? errno : 0;
+    rs.done = true;
+    if (systrace) systrace_end(result);
+    if (timeline) span.sysend(pid, syslabel(rs.n));
+}
+
+// --budget: a runaway process is killed as with SIGKILL (exit status 137)
+void UnixBase::overbudget() {
+    char buf[64];
+    snprintf(buf, sizeof (buf), "instruction budget exceeded: %llu",
+            (unsigned long long) ctx->insnbudget);
+    kill(buf, 9);
+}
+
+// stops the process at an instruction boundary as if killed by sig
+void UnixBase::kill(const char *why, int sig) {
+    fprintf(stderr, "%s (pid %d): %s\n", prof.name.c_str(), pid, why);
+    flightdump();
+    BufFile::flushall();
+    exitcode = 128 + sig;
+    killed = true;
+    if (memo) memo_taint(why);
+    vm->hasExited = true;
+}
+
+void UnixBase::flightdump() {
+    fprintf(stderr, "=== flight recorder: pid %d, %s ===\n", pid, prof.name.c_str());
+    vm->flightdump();
+    unsigned n = recentsyspos < FLIGHT_SYSCALLS ? recentsyspos : FLIGHT_SYSCALLS;
+    fprintf(stderr, "--- last %u system calls ---\n", n);
+    for (unsigned i = recentsyspos - n; i != recentsyspos; i++) {
+        const RecentSys &rs = recentsys[i % FLIGHT_SYSCALLS];
+        fprintf(stderr, "%s(0x%04x, 0x%04x, 0x%04x, 0x%04x)", syslabel(rs.n).c_str(),
+                rs.args[0], rs.args[1], rs.args[2], rs.args[3]);
+        if (!rs.done) {
+            fprintf(stderr, " ...\n");
+        } else if (rs.result == -1) {
+            fprintf(stderr, " => -1 (%s)\n", strerror(rs.err));
+        } else {
+            fprintf(stderr, " => %d\n", rs.result);
+        }
+    }
+}
+
+#ifndef NO_FORK
+// the guest pid of a forked host process, derived from the parent's for --memo
+int UnixBase::childpid(int hostpid) {
+    if (!memo) return (hostpid % 30000) + 1;
+    std::map<int, int>::iterator it = children.find(hostpid);
+    if (it != children.end()) return it->second;
+    return children[hostpid] = memo_pid(pid, ++nforks);
+}
+
+// the child of a host fork: counters and records of the parent stay there
+void UnixBase::forkchild() {
+    int ppid = pid;
+    pid = memo ? memo_pid(ppid, nforks + 1) : createpid();
+    nforks = 0;
+    children.clear();
+    prof.clear();
+    vm->stats.clear();
+    vm->insns = vm->execinsns = vm->cycles = 0;
+    vm->snappending = false;
+    vm->xtrace.fork();
+    if (systrace) systrace_fork();
+    if (timeline) {
+        timeline_forkchild();
+        span.fork(ppid, pid, prof.name, vm->insns);
+    }
+}
+#endif
+
+#ifdef NO_FORK
+// Run a forked child on its parent's memory until it execs. The child
+// never needs a copy of the parent's memory unless it makes a system call
+// other than vforksafe() before exec; the memory is copied at that point.
+// Either way the parent's data and stack are restored (below sp is free).
+void UnixBase::vfork(UnixBase *ub, uint16_t sp) {
+    if (memo) ub->pid = memo_pid(pid, ++nforks);
+    uint8_t *data = vm->data;
+    int brk = vm->brksize, slen = 0x10000 - sp;
+    std::vector<uint8_t> save(brk + slen);
+    if (brk) memcpy(&save[0], data, brk);
+    memcpy(&save[brk], data + sp, slen);
+    if (timeline) ub->span.fork(pid, ub->pid, prof.name, ub->vm->insns);
+    ub->vforked = true;
+    ub->run();
+    ub->vforked = false;
+    bool exec = !ub->vm->shared;
+    ub->vm->materialize();
+    if (brk) memcpy(data, &save[0], brk);
+    memcpy(data + sp, &save[brk], slen);
+    if (ctx->trace) fprintf(stderr, "<vfork: %s>\n", exec ? "exec" : "copy");
+    ctx->forks.push_back(ub);
+}
+
+bool UnixBase::vforkstop() {
+    vm->hasExited = true;
+    return true;
+}
+
+// system calls that only change the child's own state, or exec
+bool UnixBase::vforksafe(int n) {
+    switch (n) {
+        case 5: // open
+        case 6: // close
+        case 8: // creat
+        case 11: // exec
+        case 17: // brk
+        case 41: // dup
+        case 59: // exece
+            return true;
+    }
+    return false;
+}
+#endif
@@ -2,24 +2,54 @@
 #include "utils.h"
 #include "File.h"
 #include "VMBase.h"
+#include "Profile.h"
+#include "SysTrace.h"
+#include "Timeline.h"
+#include "Snapshot.h"
+#include "Memo.h"
 #include <stdio.h>
+#include <signal.h>
 #include <sys/stat.h>
 #include <vector>
 #include <list>
+#include <map>
 #ifdef WIN32
 #define NO_FORK
 #endif
 
+// flight recorder: the last system calls, dumped with the last PCs
+static const unsigned FLIGHT_SYSCALLS = 16;
+
 class UnixBase {
 protected:
-    static UnixBase *current;
+    struct RecentSys {
+        int n, args[4], result, err;
+        bool done;
+    };
+
+    static volatile sig_atomic_t sigpend[32];
 #ifdef NO_FORK
-    static std::list<UnixBase *> forks;
+    bool vforked;
 #endif
     VMBase *vm;
     int exitcode, pid;
     uint16_t umask;
     std::vector<FileBase *> files;
+    Profile prof;
+    TimeSpan span;
+    RecentSys recentsys[FLIGHT_SYSCALLS];
+    unsigned recentsyspos;
+    bool killed;
+    uint32_t snaphash; // of the image at load
+    Snapshot *snap; // restored at load until the arguments are placed
+    std::vector<FileBase *> snapfiles; // at load, for --snap-at
+    uint16_t snapargc; // placed after load, for --snap-at
+    int nforks; // for --memo pids
+    std::map<int, int> children; // host pid to guest pid
+    struct SigFrame {
+        uint16_t pc, sp, st[XT_STATE]; // the interrupted instruction
+    };
+    std::vector<SigFrame> sigframes; // guest handlers that have not returned
 
 public:
     UnixBase();
@@ -28,15 +58,41 @@ public:
 
     virtual void disasm() = 0;
     virtual bool syscall(int n) = 0;
+    virtual int hletest();
+    virtual int aotgen(FILE *f, const std::string &name);
     bool load(const std::string &fn);
+    bool load(const std::string &fn, FILE *f);
     int run(
             const std::vector<std::string> &args,
             const std::vector<std::string> &envs);
     int run();
     void swtch(UnixBase *to);
+    void sigcheck();
+    void profsample();
+    void flightdump();
+    void overbudget();
+    void kill(const char *why, int sig);
+    void snapshot();
+    void snaprestore();
+
+    inline int guestpid() {
+        return pid;
+    }
+
+    static volatile sig_atomic_t sigpending, flightpending;
+    static void flighthandler(int sig);
+#ifdef NO_FORK
+    void vfork(UnixBase *ub, uint16_t sp);
+    bool vforkstop();
+    static bool vforksafe(int n);
+#endif
 
 protected:
     virtual bool load2(const std::string &fn, FILE *f, size_t size) = 0;
+    virtual std::string snapname();
+    virtual void getsnap(SnapHeader *h);
+    virtual void setsnap(const SnapHeader *h);
+    void snapload();
     virtual void setArgs(
             const std::vector<std::string> &args,
             const std::vector<std::string> &envs) = 0;
@@ -44,10 +100,22 @@ protected:
     virtual int convsig(int sig) = 0;
     virtual void setsig(int sig, int h) = 0;
     virtual void swtch(bool reset = false) = 0;
+    static void sighandler(int sig);
+    virtual void sighandler2(int sig) = 0;
+    virtual void sigreturn() = 0;
+    virtual std::string sysname(int n);
+    std::string syslabel(int n);
+    void sysbegin(int os, int n, const int *args);
+    void sysend(int result);
+#ifndef NO_FORK
+    int childpid(int hostpid);
+    void forkchild();
+#endif
 
 public:
     int getfd();
     int open(const std::string &path, int flag, int mode);
+    int open(FileBase *f);
     int close(int fd);
     int dup(int fd);
     FileBase *file(int fd);
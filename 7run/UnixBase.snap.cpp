@@ -0,0 +1,203 @@
+#include "UnixBase.h"
+#include "Aot.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+std::string UnixBase::snapname() {
+    return "";
+}
+
+void UnixBase::getsnap(SnapHeader *) {
+}
+
+void UnixBase::setsnap(const SnapHeader *) {
+}
+
+static int symaddr(const std::map<int, Symbol> &syms, const std::string &name) {
+    std::map<int, Symbol>::const_iterator it;
+    for (it = syms.begin(); it != syms.end(); ++it) {
+        if (it->second.name == name) return it->first;
+    }
+    return -1;
+}
+
+// after load2() with --snap-dir: map the snapshot of the image, or set the
+// point of --snap-at for the interpreter
+void UnixBase::snapload() {
+    delete snap;
+    snap = NULL;
+    vm->snappending = false;
+    std::string os = snapname();
+    if (os.empty()) return;
+    snaphash = aothash(vm->data, vm->brksize);
+    if (vm->text != vm->data) {
+        snaphash = (snaphash * 16777619u) ^ aothash(vm->text, vm->tsize);
+    }
+    std::string path = snappath(os, snaphash);
+    Snapshot *s = new Snapshot;
+    if (snapread(path, s)) {
+        SnapHeader &h = s->h;
+        int brk = h.brksize, sp = h.state[h.sp], sp0 = h.start_sp;
+        if (ctx->trace) fprintf(stderr, "<snapshot: %s>\n", path.c_str());
+        // the words that the start-up code set to its stack or arguments
+        for (int a = 0; a + 1 < brk; a += 2) {
+            uint16_t v = ::read16(s->data + a);
+            if (v >= sp && v != vm->read16(a)) s->ptrs.push_back(a);
+        }
+        s->stack.assign(s->data + brk, s->data + sp0 + 2);
+        vm->release();
+        vm->text = s->text;
+        vm->data = s->data;
+        vm->mapped = true;
+        vm->brksize = brk;
+        // the arguments are placed on a clear stack as after load2()
+        memset(vm->data + brk, 0, 0x10000 - brk);
+        snap = s;
+        return;
+    }
+    delete s;
+    if (snapat.empty()) return;
+    int pc = -1;
+    uint64_t n = ~uint64_t(0);
+    if (isdigit(snapat[0])) {
+        n = strtoull(snapat.c_str(), NULL, 0);
+    } else if ((pc = symaddr(vm->syms[1], snapat)) < 0 && snapat == "_main") {
+        // stripped: the call from crt0
+        pc = vm->findmain();
+    }
+    if (pc < 0 && n == ~uint64_t(0)) {
+        if (ctx->trace) fprintf(stderr, "<snapshot: %s not found>\n", snapat.c_str());
+        return;
+    }
+    vm->snappc = pc;
+    vm->snapinsns = n;
+    vm->snappending = true;
+    vm->aot = NULL; // the interpreter checks the point
+    snapfiles = files;
+}
+
+// --snap-at reached: write the process for the next loads of the image
+void UnixBase::snapshot() {
+    Snapshot s;
+    memset(&s.h, 0, sizeof (s.h));
+    std::string os = snapname();
+    strncpy(s.h.os, os.c_str(), sizeof (s.h.os) - 1);
+    s.h.hash = snaphash;
+    s.h.insns = vm->insns - vm->execinsns;
+    getsnap(&s.h);
+    s.h.argc = snapargc;
+    s.h.brksize = vm->brksize;
+    s.h.umask = umask;
+    s.h.shared = vm->text == vm->data;
+    int nfiles = files.size() > snapfiles.size() ? files.size() : snapfiles.size();
+    for (int fd = 0; fd < nfiles; fd++) {
+        FileBase *f = fd < (int) files.size() ? files[fd] : NULL;
+        if (f == (fd < (int) snapfiles.size() ? snapfiles[fd] : NULL)) continue;
+        SnapFile sf = {SnapFile::Closed, int16_t(fd), 0, 0, 0};
+        std::string path;
+        if (f) {
+            if (f->fd < 0) {
+                if (ctx->trace) fprintf(stderr, "<snapshot: %s in memory>\n", f->path.c_str());
+                return;
+            }
+            sf.type = SnapFile::Opened;
+#ifdef WIN32
+            sf.flag = O_RDONLY;
+#else
+            sf.flag = fcntl(f->fd, F_GETFL) & (O_ACCMODE | O_APPEND);
+#endif
+            sf.offset = f->lseek(0, SEEK_CUR);
+            path = f->path;
+        }
+        s.files.push_back(sf);
+        s.paths.push_back(path);
+    }
+    snapfiles.clear();
+    s.text = vm->text;
+    s.data = vm->data;
+    std::string path = snappath(os, snaphash);
+    bool ok = snapwrite(path, &s);
+    if (ctx->trace) {
+        fprintf(stderr, "<snapshot: %s %s>\n",
+                ok ? "write" : "can not write", path.c_str());
+    }
+}
+
+// the stack frame of the snapshot at sp..sp0 moves by delta with the new
+// arguments at nsp0, pointers to &argv[argc] and envp follow argc
+struct Reloc {
+    int sp, sp0, argc, nsp0, nargc;
+
+    uint16_t operator()(uint16_t v) const {
+        if (sp <= v && v <= sp0 + 2) return v + nsp0 - sp0;
+        if (v == sp0 + 2 * (argc + 1)) return nsp0 + 2 * (nargc + 1);
+        if (v == sp0 + 2 * (argc + 2)) return nsp0 + 2 * (nargc + 2);
+        return v;
+    }
+};
+
+// after setArgs() or exec placed the arguments of a restored image, or of
+// an image for --snap-at
+void UnixBase::snaprestore() {
+    if (vm->snappending) {
+        // start-up code may pop argc
+        SnapHeader cur;
+        getsnap(&cur);
+        snapargc = vm->read16(cur.start_sp);
+    }
+    if (!snap) return;
+    Snapshot *s = snap;
+    snap = NULL;
+    SnapHeader h = s->h, cur;
+    getsnap(&cur);
+    int brk = h.brksize, sp = h.state[h.sp], sp0 = h.start_sp;
+    Reloc r = {sp, sp0, h.argc, cur.start_sp, vm->read16(cur.start_sp)};
+    int delta = r.nsp0 - sp0, lo = delta < 0 ? brk - delta : brk;
+    // below sp as it was left by the start-up code
+    if (lo < sp0) memcpy(vm->data + lo + delta, &s->stack[lo - brk], sp0 - lo);
+    // the frame, and argc that start-up code may have reused
+    for (int a = sp; a <= sp0; a += 2) {
+        uint16_t v = ::read16(&s->stack[a - brk]);
+        if (v != h.argc) {
+            vm->write16(a + delta, r(v));
+        } else if (a < sp0 && ::read16(&s->stack[a + 2 - brk]) == sp0 + 2) {
+            vm->write16(a + delta, r.nargc);
+        } else if (a < sp0) {
+            vm->write16(a + delta, v);
+        }
+    }
+    for (int i = 0; i < (int) s->ptrs.size(); i++) {
+        vm->write16(s->ptrs[i], r(vm->read16(s->ptrs[i])));
+    }
+    for (int i = 0; i < 8; i++) {
+        if (i != h.sp && i != h.pc) h.state[i] = r(h.state[i]);
+    }
+    h.state[h.sp] = sp + delta;
+    h.start_sp = r.nsp0;
+    setsnap(&h);
+    swtch();
+    umask = h.umask;
+    vm->insns += h.insns;
+    for (int i = 0; i < (int) s->files.size(); i++) {
+        const SnapFile &sf = s->files[i];
+        close(sf.fd);
+        if (sf.type != SnapFile::Opened) continue;
+        int flag = sf.flag;
+#ifdef WIN32
+        flag |= O_BINARY;
+#endif
+        FileBase *f = openfile(s->paths[i], flag, 0);
+        if (!f) {
+            fprintf(stderr, "can not open: %s\n", s->paths[i].c_str());
+            continue;
+        }
+        f->lseek(sf.offset, SEEK_SET);
+        if (sf.fd >= (int) files.size()) files.resize(sf.fd + 1);
+        files[sf.fd] = f;
+    }
+    delete s;
+}
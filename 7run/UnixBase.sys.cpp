@@ -1,4 +1,6 @@
 #include "UnixBase.h"
+#include "MemFS.h"
+#include "MemStream.h"
 #include <stdio.h>
 #include <errno.h>
 #include <unistd.h>
@@ -14,13 +16,7 @@
 #include <map>
 #include <algorithm>
 
-#ifdef NO_FORK
-std::list<UnixBase *> UnixBase::forks;
-#endif
-
 #ifdef WIN32
-std::list<std::string> unlinks;
-
 static void showError(int err) {
     fprintf(stderr, "%s", getErrorMessage(err).c_str());
 }
@@ -33,266 +29,350 @@ int UnixBase::close(int fd) {
     files[fd] = NULL;
     if (--f->count) return 0;
 
+    int result = f->flush();
     std::string path = f->path;
     delete f;
 
 #ifdef WIN32
+    std::list<std::string> &unlinks = ctx->unlinks;
     std::list<std::string>::iterator it2 =
             std::find(unlinks.begin(), unlinks.end(), path);
     if (it2 != unlinks.end()) {
-        if (trace)
+        if (ctx->trace)
             fprintf(stderr, "delayed unlink: %s\n", path.c_str());
         if (DeleteFileA(path.c_str()))
             unlinks.erase(it2);
-        else if (trace)
+        else if (ctx->trace)
             showError(GetLastError());
     }
 #endif
-    return 0;
+    return result;
 }
 
 void UnixBase::sys_exit(int code) {
-    if (trace) fprintf(stderr, "<exit(%d)>\n", code);
+    if (ctx->trace) fprintf(stderr, "<exit(%d)>\n", code);
+    BufFile::flushall();
     exitcode = code;
     vm->hasExited = true;
 }
 
 int UnixBase::sys_read(int fd, int buf, int len) {
-    if (trace) fprintf(stderr, "<read(%d, 0x%04x, %d)", fd, buf, len);
+    if (ctx->trace) fprintf(stderr, "<read(%d, 0x%04x, %d)", fd, buf, len);
     int max = 0x10000 - buf;
     if (len > max) len = max;
     FileBase *f = file(fd);
     int result = f ? f->read(vm->data + buf, len) : -1;
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (memo && f && f->fd == 0) memo_taint("stdin");
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_write(int fd, int buf, int len) {
-    if (trace) fprintf(stderr, "<write(%d, 0x%04x, %d)", fd, buf, len);
+    if (ctx->trace) fprintf(stderr, "<write(%d, 0x%04x, %d)", fd, buf, len);
     int max = 0x10000 - buf;
     if (len > max) len = max;
     FileBase *f = file(fd);
     int result = -1;
     if (f) {
-        if (trace && f->fd < 3) {
+        if (ctx->trace && f->fd < 3) {
             fflush(stdout);
             fflush(stderr);
         }
         result = f->write(vm->data + buf, len);
+        clearstat();
+        if (memo && (f->fd == 1 || f->fd == 2)) memo_output(f->fd, vm->data + buf, result);
+        if (ctx->trace && f->fd < 3) f->flush();
     }
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_open(const char *path, int flag, mode_t mode) {
+    if (systrace) systrace_path(path);
     if (flag & 64 /*O_CREAT*/) {
-        if (trace) fprintf(stderr, "<open(\"%s\", %d, 0%03o)", path, flag, mode);
+        if (ctx->trace) fprintf(stderr, "<open(\"%s\", %d, 0%03o)", path, flag, mode);
     } else {
-        if (trace) fprintf(stderr, "<open(\"%s\", %d)", path, flag);
+        if (ctx->trace) fprintf(stderr, "<open(\"%s\", %d)", path, flag);
     }
-    std::string path2 = convpath(path);
-    int result = open(path2, flag, mode & ~umask);
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    int result;
+    bool stream = stream_attached(path);
+    if (flag & (O_CREAT | O_TRUNC)) clearcache();
+    if (stream) {
+        result = open(stream_open(path));
+    } else if (memfs_mounted(path)) {
+        result = open(memfs_open(path, flag, mode & ~umask));
+    } else {
+        result = open(convpath(path), flag, mode & ~umask);
+    }
+    if (memolog && !stream) {
+        if ((flag & O_ACCMODE) != O_WRONLY) memo_read(path, result >= 0);
+        if (result >= 0 && ((flag & O_ACCMODE) != O_RDONLY || (flag & (O_CREAT | O_TRUNC)))) {
+            memo_write(path);
+        }
+    }
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_close(int fd) {
-    if (trace) fprintf(stderr, "<close(%d)", fd);
+    if (ctx->trace) fprintf(stderr, "<close(%d)", fd);
     int result = close(fd);
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_wait(int *status) {
-    if (trace) fprintf(stderr, "<wait()>\n");
+    if (ctx->trace) fprintf(stderr, "<wait()>\n");
 #ifdef NO_FORK
-    if (forks.empty()) {
-        if (trace) fprintf(stderr, "<wait() => EINVAL>\n");
+    if (ctx->forks.empty()) {
+        if (ctx->trace) fprintf(stderr, "<wait() => EINVAL>\n");
         errno = EINVAL;
         return -1;
     }
-    UnixBase *ub = forks.front();
-    forks.pop_front();
+    UnixBase *ub = ctx->forks.front();
+    ctx->forks.pop_front();
     *status = ub->run() << 8;
     int result = ub->pid;
     delete ub;
 #else
     int result = wait(status);
-    if (result > 0) result = (result % 30000) + 1;
+    if (result > 0) result = childpid(result);
+    clearcache();
 #endif
-    if (trace) fprintf(stderr, "<wait() => %d, 0x%x>\n", result, *status);
+    if (timeline && result > 0) timeline_wait(pid, result);
+    if (ctx->trace) fprintf(stderr, "<wait() => %d, 0x%x>\n", result, *status);
     return result;
 }
 
 int UnixBase::sys_creat(const char *path, mode_t mode) {
-    if (trace) fprintf(stderr, "<creat(\"%s\", 0%03o)", path, mode);
+    if (ctx->trace) fprintf(stderr, "<creat(\"%s\", 0%03o)", path, mode);
+    if (systrace) systrace_path(path);
+    clearcache();
+    if (stream_attached(path)) {
+        int result = open(stream_open(path));
+        if (ctx->trace) fprintf(stderr, " => %d>\n", result);
+        return result;
+    }
+    if (memfs_mounted(path)) {
+        int result = open(memfs_open(path, O_CREAT | O_TRUNC | O_WRONLY, mode & ~umask));
+        if (memolog && result >= 0) memo_write(path);
+        if (ctx->trace) fprintf(stderr, " => %d>\n", result);
+        return result;
+    }
     std::string path2 = convpath(path);
 #ifdef WIN32
     int result = open(path2, O_CREAT | O_TRUNC | O_WRONLY | O_BINARY, 0777);
 #else
     int result = open(path2, O_CREAT | O_TRUNC | O_WRONLY, mode & ~umask);
 #endif
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (memolog && result >= 0) memo_write(path);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_link(const char *src, const char *dst) {
-    if (trace) fprintf(stderr, "<link(\"%s\", \"%s\")", src, dst);
+    if (ctx->trace) fprintf(stderr, "<link(\"%s\", \"%s\")", src, dst);
+    if (systrace) systrace_path(src);
+    clearcache();
+    int result;
+    if (memfs_link(src, dst, &result)) {
+        if (memolog) memo_link(src, dst, result == 0);
+        if (ctx->trace) fprintf(stderr, " => %d>\n", result);
+        return result;
+    }
     std::string src2 = convpath(src), dst2 = convpath(dst);
 #ifdef WIN32
-    int result = CopyFileA(src2.c_str(), dst2.c_str(), TRUE) ? 0 : -1;
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    result = CopyFileA(src2.c_str(), dst2.c_str(), TRUE) ? 0 : -1;
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     if (result) {
         errno = EINVAL;
-        if (trace) showError(GetLastError());
+        if (ctx->trace) showError(GetLastError());
     }
 #else
-    int result = link(src2.c_str(), dst2.c_str());
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    result = link(src2.c_str(), dst2.c_str());
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
 #endif
+    if (memolog) memo_link(src, dst, result == 0);
     return result;
 }
 
 int UnixBase::sys_unlink(const char *path) {
-    if (trace) fprintf(stderr, "<unlink(\"%s\")", path);
+    if (ctx->trace) fprintf(stderr, "<unlink(\"%s\")", path);
+    if (systrace) systrace_path(path);
+    clearcache();
+    if (memfs_unlink(path)) {
+        if (memolog) memo_unlink(path);
+        if (ctx->trace) fprintf(stderr, " => 0>\n");
+        return 0;
+    }
     std::string path2 = convpath(path);
 #ifdef WIN32
     int result = DeleteFileA(path2.c_str()) ? 0 : -1;
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     if (result) {
         errno = EINVAL;
-        if (trace) showError(GetLastError());
+        if (ctx->trace) showError(GetLastError());
         struct stat st;
         if (stat(path2.c_str(), &st) != -1) {
-            if (trace) {
+            if (ctx->trace) {
                 fprintf(stderr, "<register delayed: %s>\n", path2.c_str());
             }
-            unlinks.push_back(path2);
+            ctx->unlinks.push_back(path2);
         }
     }
 #else
     int result = unlink(path2.c_str());
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
 #endif
+    if (memolog) {
+        if (result) memo_stat(path, false);
+        else memo_unlink(path);
+    }
     return result;
 }
 
 int UnixBase::sys_chdir(const char *path) {
-    if (trace) fprintf(stderr, "<chdir(\"%s\")", path);
+    if (ctx->trace) fprintf(stderr, "<chdir(\"%s\")", path);
+    if (systrace) systrace_path(path);
+    clearcache();
     std::string path2 = convpath(path);
     int result = chdir(path2.c_str());
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (memolog) memo_stat(path, result == 0);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_time() {
-    if (trace) fprintf(stderr, "<time()");
-    int result = time(NULL);
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, "<time()");
+    int result = memo ? memo_time() : time(NULL);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_chmod(const char *path, mode_t mode) {
-    if (trace) fprintf(stderr, "<chmod(\"%s\", 0%03o)", path, mode);
-    int result = chmod(convpath(path).c_str(), mode);
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, "<chmod(\"%s\", 0%03o)", path, mode);
+    if (systrace) systrace_path(path);
+    clearcache();
+    int result = 0;
+    if (!memfs_chmod(path, mode)) {
+        result = chmod(convpath(path).c_str(), mode);
+    }
+    if (memolog) {
+        if (result) memo_stat(path, false);
+        else memo_write(path);
+    }
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_brk(int nd, int sp) {
-    if (trace) fprintf(stderr, "<brk(0x%04x)", nd);
+    if (ctx->trace) fprintf(stderr, "<brk(0x%04x)", nd);
     if (nd < (int) vm->dsize || nd >= ((sp - 0x400) & ~0x3ff)) {
         errno = ENOMEM;
-        if (trace) fprintf(stderr, " => ENOMEM>\n");
+        if (ctx->trace) fprintf(stderr, " => ENOMEM>\n");
         return -1;
     }
     vm->brksize = nd;
-    if (trace) fprintf(stderr, " => 0>\n");
+    if (ctx->trace) fprintf(stderr, " => 0>\n");
     return 0;
 }
 
 int UnixBase::sys_stat(const char *path, int p) {
-    if (trace) fprintf(stderr, "<stat(\"%s\", 0x%04x)", path, p);
+    if (ctx->trace) fprintf(stderr, "<stat(\"%s\", 0x%04x)", path, p);
+    if (systrace) systrace_path(path);
     struct stat st;
-    int result;
-    if (!(result = stat(path, &st))) {
+    int result = 0;
+    BufFile::flushpath(path);
+    if (stream_stat(path, &st) || memfs_stat(path, &st) || !(result = cachedstat(path, &st))) {
         setstat(p, &st);
     }
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (memolog) memo_stat(path, result == 0);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 off_t UnixBase::sys_lseek(int fd, off_t o, int w) {
-    if (trace) fprintf(stderr, "<lseek(%d, %ld, %d)", fd, long(o), w);
+    if (ctx->trace) fprintf(stderr, "<lseek(%d, %ld, %d)", fd, long(o), w);
     FileBase *f = file(fd);
     off_t result = -1;
     if (f) result = f->lseek(o, w);
-    if (trace) fprintf(stderr, " => %ld>\n", long(result));
+    if (ctx->trace) fprintf(stderr, " => %ld>\n", long(result));
     return result;
 }
 
 int UnixBase::sys_getpid() {
-    if (trace) fprintf(stderr, "<getpid()");
+    if (ctx->trace) fprintf(stderr, "<getpid()");
     int result = pid;
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_getuid() {
-    if (trace) fprintf(stderr, "<getuid()");
+    if (ctx->trace) fprintf(stderr, "<getuid()");
 #ifdef WIN32
     int result = 0;
 #else
     int result = getuid();
 #endif
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_fstat(int fd, int p) {
-    if (trace) fprintf(stderr, "<fstat(%d, 0x%04x)", fd, p);
+    if (ctx->trace) fprintf(stderr, "<fstat(%d, 0x%04x)", fd, p);
     struct stat st;
     FileBase *f = file(fd);
     int result = -1;
     if (f) {
-        if (f->fd <= 2) {
+        if (0 <= f->fd && f->fd <= 2) {
             errno = EBADF;
-        } else if (!(result = fstat(f->fd, &st))) {
+        } else if (!(result = f->fstat(&st))) {
             setstat(p, &st);
         }
     }
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_access(const char *path, mode_t mode) {
-    if (trace) fprintf(stderr, "<access(\"%s\", 0%03o)", path, mode);
-    std::string path2 = convpath(path);
-    int result = access(path2.c_str(), mode);
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, "<access(\"%s\", 0%03o)", path, mode);
+    if (systrace) systrace_path(path);
+    int result = 0;
+    if (!stream_attached(path) && !memfs_access(path, mode, &result)) {
+        std::string path2 = convpath(path);
+        BufFile::flushpath(path2);
+        if (mode) {
+            result = access(path2.c_str(), mode);
+        } else {
+            struct stat st;
+            result = cachedstat(path2, &st);
+        }
+    }
+    if (memolog) memo_stat(path, result == 0);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_dup(int fd) {
-    if (trace) fprintf(stderr, "<dup(%d)", fd);
+    if (ctx->trace) fprintf(stderr, "<dup(%d)", fd);
     int result = dup(fd);
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_getgid() {
-    if (trace) fprintf(stderr, "<getgid()");
+    if (ctx->trace) fprintf(stderr, "<getgid()");
 #ifdef WIN32
     int result = 0;
 #else
     int result = getgid();
 #endif
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_ioctl(int fd, int rq, int d) {
-    if (trace) fprintf(stderr, "<ioctl(%d, 0x%04x, 0x%04x)", fd, rq, d);
+    if (ctx->trace) fprintf(stderr, "<ioctl(%d, 0x%04x, 0x%04x)", fd, rq, d);
     int result = -1;
     switch (rq) {
         case 0x7408: // TIOCGETP
@@ -302,13 +382,13 @@ int UnixBase::sys_ioctl(int fd, int rq, int d) {
             errno = EINVAL;
             break;
     }
-    if (trace) fprintf(stderr, " => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, " => %d>\n", result);
     return result;
 }
 
 int UnixBase::sys_umask(mode_t mask) {
     int result = umask;
     umask = mask;
-    if (trace) fprintf(stderr, "<umask(0%03o) => 0%03o\n", umask, result);
+    if (ctx->trace) fprintf(stderr, "<umask(0%03o) => 0%03o\n", umask, result);
     return result;
 }
@@ -82,11 +82,6 @@ void OS::setstat(uint16_t addr, struct stat * st) {
     }
 }
 
-void OS::sighandler(int sig) {
-    OS *cur = dynamic_cast<OS *> (current);
-    if (cur) cur->sighandler2(sig);
-}
-
 int OS::convsig(int sig) {
     switch (sig) {
         case V6_SIGINT: return SIGINT;
@@ -108,6 +103,7 @@ void OS::setsig(int sig, int h) {
 }
 
 void OS::resetsig() {
+    sigframes.clear();
     for (int i = 0; i < nsig; i++) {
         uint16_t &sgh = sighandlers[i];
         if (sgh && !(sgh & 1)) {
@@ -17,6 +17,7 @@ namespace UnixV6 {
     protected:
         virtual void setstat(uint16_t addr, struct stat *st);
         virtual int convsig(int sig);
+        virtual std::string sysname(int n);
         virtual void setsig(int sig, int h);
         virtual void swtch(bool reset = false);
 
@@ -37,8 +38,6 @@ namespace UnixV6 {
         void coredump(const char *path);
 
     protected:
-        static void sighandler(int sig);
-        virtual void sighandler2(int sig) = 0;
         void resetsig();
 
         static const int nsig = 20;
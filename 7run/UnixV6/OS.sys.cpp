@@ -68,8 +68,15 @@ sysarg OS::sysargs[] = {
     {/*60*/ 1, "umask"}, // for UNIX V7
 };
 
+std::string OS::sysname(int n) {
+    return n < nsys ? sysargs[n].name : "";
+}
+
 int OS::syscall(int *result, int n, int arg0, uint8_t *args) {
     *result = 0;
+    if (statsmode) ++vm->stats.syscalls[n];
+    int a[] = {arg0, read16(args), read16(args + 2), read16(args + 4)};
+    sysbegin(SYSTRACE_V6, n, a);
     switch (n) {
         case 1:
             sys_exit((int16_t) arg0);
@@ -150,7 +157,7 @@ int OS::syscall(int *result, int n, int arg0, uint8_t *args) {
             *result = sys_fstat(arg0, read16(args));
             return 2;
         case 33:
-            *result = sys_access(vm->str16(args), read16(args + 6));
+            *result = sys_access(vm->str16(args), read16(args + 2));
             return 4;
         case 41:
             *result = sys_dup(arg0);
@@ -182,7 +189,7 @@ int OS::syscall(int *result, int n, int arg0, uint8_t *args) {
 }
 
 int OS::v6_seek(int fd, off_t o, int w) { // 19
-    if (trace) fprintf(stderr, "<seek(%d, %ld, %d)", fd, long(o), w);
+    if (ctx->trace) fprintf(stderr, "<seek(%d, %ld, %d)", fd, long(o), w);
     FileBase *f = file(fd);
     off_t result = -1;
     switch (w) {
@@ -208,12 +215,12 @@ int OS::v6_seek(int fd, off_t o, int w) { // 19
             errno = EINVAL;
             break;
     }
-    if (trace) fprintf(stderr, " => %ld>\n", long(result));
+    if (ctx->trace) fprintf(stderr, " => %ld>\n", long(result));
     return result;
 }
 
 int OS::v6_signal(int sig, int h) {
-    if (trace) fprintf(stderr, "<signal(%d, 0x%04x)>\n", sig, h);
+    if (ctx->trace) fprintf(stderr, "<signal(%d, 0x%04x)>\n", sig, h);
     int s = convsig(sig);
     if (s < 0) {
         errno = EINVAL;
@@ -1,6 +1,8 @@
 #include "OSPDP11.h"
 #include "../PDP11/regs.h"
 #include "../PDP11/disasm.h"
+#include "../MemFS.h"
+#include "../Aot.h"
 #include <string.h>
 #include <errno.h>
 #include <unistd.h>
@@ -13,12 +15,13 @@ bool OSPDP11::check(uint8_t h[2]) {
     return magic == 0407 || magic == 0410 || magic == 0411;
 }
 
-OSPDP11::OSPDP11(int ver) : OS(ver) {
+OSPDP11::OSPDP11(int ver) : OS(ver), codeend(0) {
     vm = &cpu;
     cpu.unix = this;
 }
 
-OSPDP11::OSPDP11(const OSPDP11 &os) : OS(os), cpu(os.cpu) {
+OSPDP11::OSPDP11(const OSPDP11 &os)
+: OS(os), cpu(os.cpu), codeend(os.codeend) {
     vm = &cpu;
     cpu.unix = this;
 }
@@ -55,6 +58,11 @@ void OSPDP11::disasm() {
     if (undef) printf("undefined: %d\n", undef);
 }
 
+int OSPDP11::aotgen(FILE *f, const std::string &name) {
+    cpu.aotgen(f, name, textbase, codeend);
+    return 0;
+}
+
 void OSPDP11::setArgs(
         const std::vector<std::string> &args,
         const std::vector<std::string> &) {
@@ -74,6 +82,24 @@ void OSPDP11::setArgs(
     }
 }
 
+std::string OSPDP11::snapname() {
+    return ver == 7 ? "v7" : ver == 2 ? "v2" : "v6";
+}
+
+void OSPDP11::getsnap(SnapHeader *h) {
+    cpu.getstate(h->state);
+    h->sp = 6;
+    h->pc = 7;
+    h->start_sp = cpu.start_sp;
+    memcpy(h->sigs, sighandlers, sizeof (sighandlers));
+}
+
+void OSPDP11::setsnap(const SnapHeader *h) {
+    cpu.setstate(h->state);
+    cpu.start_sp = h->start_sp;
+    memcpy(sighandlers, h->sigs, sizeof (sighandlers));
+}
+
 bool OSPDP11::load2(const std::string &fn, FILE *f, size_t size) {
     uint8_t h[0x10];
     if (!fread(h, sizeof (h), 1, f) || !check(h)) {
@@ -88,6 +114,7 @@ bool OSPDP11::load2(const std::string &fn, FILE *f, size_t size) {
     uint16_t bss = ::read16(h + 6);
     memset(cpu.r, 0, sizeof (cpu.r));
     cpu.PC = ::read16(h + 10);
+    codeend = textbase + vm->tsize;
     cpu.cache.clear();
     cpu.cache.resize(0x10000);
     uint16_t magic = read16(h);
@@ -111,6 +138,7 @@ bool OSPDP11::load2(const std::string &fn, FILE *f, size_t size) {
         }
         fread(vm->text + textbase, 1, len, f);
         vm->brksize = textbase + len + bss;
+        codeend = textbase + len;
         if (textbase) cpu.PC = textbase;
     }
 
@@ -124,11 +152,22 @@ bool OSPDP11::load2(const std::string &fn, FILE *f, size_t size) {
     if (read16(vm->text + 2) == 0x1d80) {
         ver = 7;
     }
+    cpu.csvscan(textbase, textbase + vm->tsize);
+    vm->aot = aotfind(vm->text, textbase, codeend - textbase);
     return true;
 }
 
 bool OSPDP11::syscall(int n) {
     int result, ret;
+#ifdef NO_FORK
+    if (vforked) {
+        int nn = n ? n : vm->read8(read16(vm->text + cpu.PC));
+        if (!vforksafe(nn)) {
+            cpu.PC -= 2;
+            return vforkstop();
+        }
+    }
+#endif
     if (n == 0) {
         int p = read16(vm->text + cpu.PC);
         int nn = vm->read8(p);
@@ -137,6 +176,7 @@ bool OSPDP11::syscall(int n) {
     } else {
         ret = OS::syscall(&result, n, cpu.r[0], vm->text + cpu.PC);
     }
+    sysend(result);
     if (ret >= 0) {
         cpu.PC += ret;
         cpu.r[0] = (cpu.C = (result == -1)) ? errno : result;
@@ -144,6 +184,9 @@ bool OSPDP11::syscall(int n) {
             cpu.r[1] = result >> 16;
         }
     }
+#ifdef NO_FORK
+    if (vforked && !vm->shared) vforkstop();
+#endif
     return true;
 }
 
@@ -151,13 +194,16 @@ int OSPDP11::v6_fork() { // 2
 #ifdef NO_FORK
     OSPDP11 *ub = new OSPDP11(*this);
     ub->cpu.r[0] = pid;
-    forks.push_back(ub);
+    vfork(ub, cpu.SP);
     int result = ub->pid;
 #else
+    memfs_sync();
+    BufFile::flushall();
     int result = fork();
-    if (result > 0) result = (result % 30000) + 1;
+    if (result > 0) result = childpid(result);
+    if (result == 0) forkchild();
 #endif
-    if (trace) fprintf(stderr, "<fork() => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, "<fork() => %d>\n", result);
     return result;
 }
 
@@ -168,23 +214,24 @@ int OSPDP11::v6_wait() { // 7
 }
 
 int OSPDP11::v6_exec(const char *path, int argp) { // 11
-    if (trace) fprintf(stderr, "<exec(\"%s\"", path);
+    if (ctx->trace) fprintf(stderr, "<exec(\"%s\"", path);
     std::vector<std::string> args, envs;
     int slen = 0, p;
     while ((p = vm->read16(argp + args.size() * 2))) {
         std::string arg = vm->str(p);
-        if (trace && !args.empty()) fprintf(stderr, ", \"%s\"", arg.c_str());
+        if (ctx->trace && !args.empty()) fprintf(stderr, ", \"%s\"", arg.c_str());
         slen += arg.size() + 1;
         args.push_back(arg);
     }
     if (!load(path)) {
-        if (trace) fprintf(stderr, ") => EINVAL>\n");
+        if (ctx->trace) fprintf(stderr, ") => EINVAL>\n");
         errno = EINVAL;
         return -1;
     }
     resetsig();
     setArgs(args, envs);
-    if (trace) fprintf(stderr, ") => 0>\n");
+    snaprestore();
+    if (ctx->trace) fprintf(stderr, ") => 0>\n");
     return 0;
 }
 
@@ -192,20 +239,24 @@ int OSPDP11::v6_brk(int nd) { // 17
     return sys_brk(nd, cpu.SP);
 }
 
+// the handler returns with rts pc to the interrupted instruction
 void OSPDP11::sighandler2(int sig) {
-    uint16_t r[8];
-    memcpy(r, cpu.r, sizeof (r));
-    bool Z = cpu.Z, N = cpu.N, C = cpu.C, V = cpu.V;
+    if (sig >= nsig || !sighandlers[sig] || (sighandlers[sig] & 1)) return;
+    SigFrame f;
+    f.pc = cpu.PC;
+    f.sp = cpu.SP;
+    cpu.getstate(f.st);
+    sigframes.push_back(f);
     cpu.write16((cpu.SP -= 2), cpu.PC);
     cpu.PC = sighandlers[sig];
-    while (!cpu.hasExited && !(cpu.PC == PC && cpu.SP == SP)) {
-        cpu.run1();
-    }
-    if (!cpu.hasExited) {
-        memcpy(cpu.r, r, sizeof (r));
-        cpu.Z = Z;
-        cpu.N = N;
-        cpu.C = C;
-        cpu.V = V;
+}
+
+// a handler has ended when the stack pointer is back at its frame: at the
+// interrupted instruction it has returned, anywhere else it was a longjmp
+void OSPDP11::sigreturn() {
+    while (!sigframes.empty() && cpu.SP >= sigframes.back().sp) {
+        const SigFrame &f = sigframes.back();
+        if (cpu.PC == f.pc && cpu.SP == f.sp) cpu.setstate(f.st);
+        sigframes.pop_back();
     }
 }
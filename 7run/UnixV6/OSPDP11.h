@@ -10,6 +10,7 @@ namespace UnixV6 {
 
     private:
         PDP11::VM cpu;
+        int codeend; // end of code: text, or text+data for 0407
 
     public:
         OSPDP11(int ver);
@@ -18,12 +19,16 @@ namespace UnixV6 {
 
         virtual void disasm();
         virtual bool syscall(int n);
+        virtual int aotgen(FILE *f, const std::string &name);
 
     protected:
         virtual void setArgs(
                 const std::vector<std::string> &args,
                 const std::vector<std::string> &envs);
         virtual bool load2(const std::string &fn, FILE *f, size_t size);
+        virtual std::string snapname();
+        virtual void getsnap(SnapHeader *h);
+        virtual void setsnap(const SnapHeader *h);
 
     public:
         virtual int v6_fork(); //  2
@@ -33,5 +38,6 @@ namespace UnixV6 {
 
     protected:
         virtual void sighandler2(int sig);
+        virtual void sigreturn();
     };
 }
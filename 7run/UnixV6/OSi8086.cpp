@@ -1,6 +1,7 @@
 #include "OSi8086.h"
 #include "../i8086/regs.h"
 #include "../i8086/disasm.h"
+#include "../MemFS.h"
 #include <string.h>
 #include <errno.h>
 #include <unistd.h>
@@ -25,6 +26,10 @@ OSi8086::OSi8086(const OSi8086 &os) : OS(os), cpu(os.cpu) {
 OSi8086::~OSi8086() {
 }
 
+int OSi8086::hletest() {
+    return cpu.hletest();
+}
+
 void OSi8086::disasm() {
     int addr = 0, undef = 0;
     while (addr < (int) vm->tsize) {
@@ -73,6 +78,24 @@ void OSi8086::setArgs(
     }
 }
 
+std::string OSi8086::snapname() {
+    return "i86v6";
+}
+
+void OSi8086::getsnap(SnapHeader *h) {
+    cpu.getstate(h->state);
+    h->sp = 4;
+    h->pc = 8;
+    h->start_sp = cpu.start_sp;
+    memcpy(h->sigs, sighandlers, sizeof (sighandlers));
+}
+
+void OSi8086::setsnap(const SnapHeader *h) {
+    cpu.setstate(h->state);
+    cpu.start_sp = h->start_sp;
+    memcpy(sighandlers, h->sigs, sizeof (sighandlers));
+}
+
 bool OSi8086::load2(const std::string &fn, FILE *f, size_t size) {
     uint8_t h[0x10];
     if (!fread(h, sizeof (h), 1, f) || !check(h)) {
@@ -113,11 +136,22 @@ bool OSi8086::load2(const std::string &fn, FILE *f, size_t size) {
         }
         readsym(f, ssize);
     }
+    cpu.hlescan();
     return true;
 }
 
 bool OSi8086::syscall(int n) {
     if (n != 7) return false;
+#ifdef NO_FORK
+    if (vforked) {
+        int nn = vm->text[cpu.IP];
+        if (nn == 0) nn = vm->read8(read16(vm->text + cpu.IP + 1) + 2);
+        if (!vforksafe(nn)) {
+            cpu.IP -= 2;
+            return vforkstop();
+        }
+    }
+#endif
     int result, nn = vm->text[cpu.IP++], ret;
     if (nn == 0) {
         int p = read16(vm->text + cpu.IP);
@@ -127,6 +161,7 @@ bool OSi8086::syscall(int n) {
     } else {
         ret = OS::syscall(&result, nn, cpu.AX, vm->text + cpu.IP);
     }
+    sysend(result);
     if (ret >= 0) {
         cpu.IP += ret;
         cpu.AX = (cpu.CF = (result == -1)) ? errno : result;
@@ -134,6 +169,9 @@ bool OSi8086::syscall(int n) {
             cpu.DX = result >> 16;
         }
     }
+#ifdef NO_FORK
+    if (vforked && !vm->shared) vforkstop();
+#endif
     return true;
 }
 
@@ -141,13 +179,16 @@ int OSi8086::v6_fork() { // 2
 #ifdef NO_FORK
     OSi8086 *ub = new OSi8086(*this);
     ub->cpu.AX = pid;
-    forks.push_back(ub);
+    vfork(ub, cpu.SP);
     int result = ub->pid;
 #else
+    memfs_sync();
+    BufFile::flushall();
     int result = fork();
-    if (result > 0) result = (result % 30000) + 1;
+    if (result > 0) result = childpid(result);
+    if (result == 0) forkchild();
 #endif
-    if (trace) fprintf(stderr, "<fork() => %d>\n", result);
+    if (ctx->trace) fprintf(stderr, "<fork() => %d>\n", result);
     return result;
 }
 
@@ -158,23 +199,24 @@ int OSi8086::v6_wait() { // 7
 }
 
 int OSi8086::v6_exec(const char *path, int argp) { // 11
-    if (trace) fprintf(stderr, "<exec(\"%s\"", path);
+    if (ctx->trace) fprintf(stderr, "<exec(\"%s\"", path);
     std::vector<std::string> args, envs;
     int slen = 0, p;
     while ((p = vm->read16(argp + args.size() * 2))) {
         std::string arg = vm->str(p);
-        if (trace && !args.empty()) fprintf(stderr, ", \"%s\"", arg.c_str());
+        if (ctx->trace && !args.empty()) fprintf(stderr, ", \"%s\"", arg.c_str());
         slen += arg.size() + 1;
         args.push_back(arg);
     }
     if (!load(path)) {
-        if (trace) fprintf(stderr, ") => EINVAL>\n");
+        if (ctx->trace) fprintf(stderr, ") => EINVAL>\n");
         errno = EINVAL;
         return -1;
     }
     resetsig();
     setArgs(args, envs);
-    if (trace) fprintf(stderr, ") => 0>\n");
+    snaprestore();
+    if (ctx->trace) fprintf(stderr, ") => 0>\n");
     return 0;
 }
 
@@ -182,25 +224,24 @@ int OSi8086::v6_brk(int nd) { // 17
     return sys_brk(nd, cpu.SP);
 }
 
+// the handler returns with ret to the interrupted instruction
 void OSi8086::sighandler2(int sig) {
-    uint16_t r[8];
-    memcpy(r, cpu.r, sizeof (r));
-    uint16_t ip = cpu.IP;
-    bool OF = cpu.OF, DF = cpu.DF, SF = cpu.SF;
-    bool ZF = cpu.ZF, AF = cpu.AF, PF = cpu.PF, CF = cpu.CF;
+    if (sig >= nsig || !sighandlers[sig] || (sighandlers[sig] & 1)) return;
+    SigFrame f;
+    f.pc = cpu.IP;
+    f.sp = cpu.SP;
+    cpu.getstate(f.st);
+    sigframes.push_back(f);
     cpu.write16((cpu.SP -= 2), cpu.IP);
     cpu.IP = sighandlers[sig];
-    while (!cpu.hasExited && !(cpu.IP == ip && cpu.SP == SP)) {
-        cpu.run1();
-    }
-    if (!cpu.hasExited) {
-        memcpy(cpu.r, r, sizeof (r));
-        cpu.OF = OF;
-        cpu.DF = DF;
-        cpu.SF = SF;
-        cpu.ZF = ZF;
-        cpu.AF = AF;
-        cpu.PF = PF;
-        cpu.CF = CF;
+}
+
+// a handler has ended when the stack pointer is back at its frame: at the
+// interrupted instruction it has returned, anywhere else it was a longjmp
+void OSi8086::sigreturn() {
+    while (!sigframes.empty() && cpu.SP >= sigframes.back().sp) {
+        const SigFrame &f = sigframes.back();
+        if (cpu.IP == f.pc && cpu.SP == f.sp) cpu.setstate(f.st);
+        sigframes.pop_back();
     }
 }
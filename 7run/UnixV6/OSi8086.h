@@ -17,6 +17,7 @@ namespace UnixV6 {
         virtual ~OSi8086();
 
         virtual void disasm();
+        virtual int hletest();
         virtual bool syscall(int n);
 
     protected:
@@ -24,6 +25,9 @@ namespace UnixV6 {
                 const std::vector<std::string> &args,
                 const std::vector<std::string> &envs);
         virtual bool load2(const std::string &fn, FILE *f, size_t size);
+        virtual std::string snapname();
+        virtual void getsnap(SnapHeader *h);
+        virtual void setsnap(const SnapHeader *h);
 
     public:
         virtual int v6_fork(); //  2
@@ -33,5 +37,6 @@ namespace UnixV6 {
 
     protected:
         virtual void sighandler2(int sig);
+        virtual void sigreturn();
     };
 }
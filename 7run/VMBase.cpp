@@ -1,5 +1,6 @@
 #include "VMBase.h"
 #include "UnixBase.h"
+#include "Snapshot.h"
 #include <stdio.h>
 #include <string.h>
 #include <errno.h>
@@ -8,24 +9,25 @@
 #include <unistd.h>
 #include <sys/stat.h>
 
-int trace;
+bool callgraph;
+bool insncount;
 
 VMBase::VMBase()
-: text(NULL), data(NULL), tsize(0), brksize(0), hasExited(false) {
+: text(NULL), data(NULL), tsize(0), brksize(0), hasExited(false), shared(false),
+mapped(false), insns(0), execinsns(0), cycles(0), aot(NULL), snappending(false) {
 }
 
-VMBase::VMBase(const VMBase &vm) : hasExited(false) {
-    text = new uint8_t[0x10000];
-    memcpy(text, vm.text, 0x10000);
-    if (vm.data == vm.text) {
-        data = text;
-    } else {
-        data = new uint8_t[0x10000];
-        memcpy(data, vm.data, 0x10000);
-    }
+// the memory is borrowed from vm until materialize() or release()
+VMBase::VMBase(const VMBase &vm)
+: hasExited(false), shared(true), mapped(false), insns(0), execinsns(0),
+cycles(0), aot(vm.aot), snappending(false) {
+    text = vm.text;
+    data = vm.data;
     tsize = vm.tsize;
     dsize = vm.dsize;
     brksize = vm.brksize;
+    calls = vm.calls;
+    stats.name = vm.stats.name;
 }
 
 VMBase::~VMBase() {
@@ -33,9 +35,29 @@ VMBase::~VMBase() {
 }
 
 void VMBase::release() {
-    if (data && data != text) delete[] data;
-    if (text) delete[] text;
+    if (mapped) {
+        snapunmap(text, data);
+    } else if (!shared) {
+        if (data && data != text) delete[] data;
+        if (text) delete[] text;
+    }
     text = data = NULL;
+    shared = mapped = false;
+}
+
+void VMBase::materialize() {
+    if (!shared) return;
+    uint8_t *t = new uint8_t[0x10000];
+    memcpy(t, text, 0x10000);
+    if (data == text) {
+        data = t;
+    } else {
+        uint8_t *d = new uint8_t[0x10000];
+        memcpy(d, data, 0x10000);
+        data = d;
+    }
+    text = t;
+    shared = false;
 }
 
 void VMBase::showsym(uint16_t addr) {
@@ -57,6 +79,24 @@ void VMBase::debugsym(uint16_t pc) {
     }
 }
 
+void VMBase::flightdump() {
+    unsigned n = insns - execinsns < FLIGHT_PCS ? insns - execinsns : FLIGHT_PCS;
+    fprintf(stderr, "--- last %u instructions ---\n", n);
+    for (uint64_t i = insns - n; i != insns; i++) {
+        uint16_t pc = recent[i % FLIGHT_PCS];
+        std::string sym;
+        std::map<int, Symbol>::iterator it = syms[1].upper_bound(pc);
+        if (it != syms[1].begin()) {
+            --it;
+            char buf[16];
+            snprintf(buf, sizeof (buf), "+%x", pc - it->first);
+            sym = it->second.name + buf;
+        }
+        if (!syms[1].empty()) fprintf(stderr, "%-16s ", sym.c_str());
+        fprintf(stderr, "%s\n", disline(pc).c_str());
+    }
+}
+
 bool VMBase::load(const std::string& fn, FILE* f, size_t size) {
     if (size > 0xffff) {
         fprintf(stderr, "too long raw binary: %s\n", fn.c_str());
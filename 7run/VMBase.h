@@ -1,6 +1,8 @@
 #pragma once
 #include "utils.h"
 #include "File.h"
+#include "Stats.h"
+#include "XTrace.h"
 #include <stdio.h>
 #include <vector>
 #include <list>
@@ -12,21 +14,45 @@
 #undef unix
 #endif
 
-extern int trace;
+extern bool callgraph;
+extern bool insncount; // --count
 
 class UnixBase;
+struct AotImage;
 
 struct Symbol {
     std::string name;
     int type, addr;
 };
 
+// shadow call stack entry: sp is the stack pointer after the call
+struct CallFrame {
+    uint16_t addr, sp;
+};
+
+// flight recorder: the last executed PCs, dumped on fatal errors
+static const unsigned FLIGHT_PCS = 256;
+
 struct VMBase {
     uint8_t *text, *data;
     size_t tsize, dsize;
     uint16_t brksize;
-    bool hasExited;
+    bool hasExited, shared;
+    bool mapped; // text and data are mapped from a snapshot
     std::map<int, Symbol> syms[2];
+    std::vector<CallFrame> calls;
+    Stats stats;
+    XTrace xtrace;
+    uint16_t recent[FLIGHT_PCS];
+    // retired instructions of the process (a repeated string instruction
+    // counts once) and at the last exec, cycles of finished images
+    uint64_t insns, execinsns, cycles;
+    const AotImage *aot; // translated text, NULL: interpreted
+    // --snap-at: the snapshot is written at snappc (or -1) or after
+    // snapinsns instructions since exec (or all ones)
+    bool snappending;
+    int snappc;
+    uint64_t snapinsns;
     UnixBase *unix;
 
     VMBase();
@@ -34,13 +60,28 @@ struct VMBase {
     virtual ~VMBase();
 
     void release();
+    void materialize();
     void showsym(uint16_t addr);
     void debugsym(uint16_t pc);
+    void flightdump();
 
     virtual bool load(const std::string &fn, FILE *f, size_t size);
     virtual void disasm() = 0;
     virtual void showHeader() = 0;
     virtual void run2() = 0;
+    virtual uint16_t getpc() = 0;
+    virtual std::string disline(uint16_t pc) = 0;
+    virtual int findmain() = 0;
+
+    inline void call(uint16_t addr, uint16_t sp) {
+        CallFrame f = {addr, sp};
+        calls.push_back(f);
+    }
+
+    // also unwinds frames left by longjmp
+    inline void ret(uint16_t sp) {
+        while (!calls.empty() && calls.back().sp < sp) calls.pop_back();
+    }
 
     inline uint8_t read8(uint16_t addr) {
         return data[addr];
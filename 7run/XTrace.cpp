@@ -0,0 +1,200 @@
+#include "XTrace.h"
+#include "VMBase.h"
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+std::string xtracepath;
+
+static const size_t BUFSIZE = 1 << 20;
+
+// the first process writes xtracepath, the others xtracepath.pid
+static bool opened;
+
+XTrace::XTrace()
+: fd(-1), pcreg(0), needimage(true), pos(0), flushed(0), insn(0), nruns(0) {
+}
+
+// a copy (fork) writes its own file
+XTrace::XTrace(const XTrace &)
+: fd(-1), pcreg(0), needimage(true), pos(0), flushed(0), insn(0), nruns(0) {
+}
+
+XTrace::~XTrace() {
+    close();
+}
+
+void XTrace::put(const void *p, size_t len) {
+    if (pos + len > buf.size()) flush();
+    memcpy(&buf[pos], p, len);
+    pos += len;
+}
+
+void XTrace::put16(uint16_t v) {
+    put(&v, sizeof (v));
+}
+
+void XTrace::putstate(const uint16_t *st) {
+    put(st, XT_STATE * sizeof (uint16_t));
+    memcpy(last, st, sizeof (last));
+}
+
+// append the changed bytes in [addr, addr + len) to mem as runs
+void XTrace::diff(VMBase *vm, int addr, int len) {
+    const uint8_t *d = vm->data;
+    uint8_t *s = &shadow[0];
+    int end = addr + len > 0x10000 ? 0x10000 : addr + len;
+    for (int i = addr; i < end;) {
+        if (!(i & 63) && i + 64 <= end && !memcmp(d + i, s + i, 64)) {
+            i += 64;
+            continue;
+        }
+        if (d[i] == s[i]) {
+            ++i;
+            continue;
+        }
+        int j = i + 1;
+        while (j < end && j - i < 0xffff && d[j] != s[j]) ++j;
+        uint16_t hdr[2] = {uint16_t(i), uint16_t(j - i)};
+        mem.insert(mem.end(), (uint8_t *) hdr, (uint8_t *) (hdr + 2));
+        mem.insert(mem.end(), d + i, d + j);
+        memcpy(s + i, d + i, j - i);
+        ++nruns;
+        i = j;
+    }
+}
+
+void XTrace::putmem() {
+    put16(nruns);
+    if (!mem.empty()) put(&mem[0], mem.size());
+}
+
+void XTrace::entry(int type) {
+    uint64_t offset = flushed + pos;
+    index.push_back(type);
+    index.insert(index.end(), (uint8_t *) &insn, (uint8_t *) (&insn + 1));
+    index.insert(index.end(), (uint8_t *) &offset, (uint8_t *) (&offset + 1));
+}
+
+void XTrace::flush() {
+    if (fd >= 0 && pos) write(fd, &buf[0], pos);
+    flushed += pos;
+    pos = 0;
+}
+
+// the next step() starts with an image record
+void XTrace::exec() {
+    needimage = true;
+}
+
+// in the child of a host fork: the parent writes what it has buffered
+void XTrace::fork() {
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+    needimage = true;
+    pos = 0;
+    flushed = insn = 0;
+    index.clear();
+}
+
+void XTrace::image(VMBase *vm, int arch, int pid, const uint16_t *st) {
+    if (fd < 0) {
+        std::string path = xtracepath;
+        if (opened) {
+            char sfx[16];
+            snprintf(sfx, sizeof (sfx), ".%d", pid);
+            path += sfx;
+        }
+        opened = true;
+        int flag = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef WIN32
+        flag |= O_BINARY;
+#endif
+        fd = ::open(path.c_str(), flag, 0666);
+        if (fd < 0) fprintf(stderr, "can not open: %s\n", path.c_str());
+        buf.resize(BUFSIZE);
+        put("7TRC", 4);
+    }
+    needimage = false;
+    pcreg = arch == XT_PDP11 ? 7 : 8;
+    entry(XT_IMAGE);
+    put16(XT_SPECIAL | XT_IMAGE);
+    uint8_t hdr[2] = {uint8_t(arch), vm->data == vm->text};
+    put(hdr, sizeof (hdr));
+    put(&insn, sizeof (insn));
+    put16(vm->stats.name.size());
+    put(vm->stats.name.data(), vm->stats.name.size());
+    uint32_t tsize = vm->tsize;
+    put(&tsize, sizeof (tsize));
+    if (vm->data != vm->text) put(vm->text, tsize);
+    put(vm->data, 0x10000);
+    uint32_t nsyms = vm->syms[1].size();
+    put(&nsyms, sizeof (nsyms));
+    std::map<int, Symbol>::iterator it;
+    for (it = vm->syms[1].begin(); it != vm->syms[1].end(); ++it) {
+        put16(it->first);
+        put16(it->second.name.size());
+        put(it->second.name.data(), it->second.name.size());
+    }
+    putstate(st);
+    shadow.assign(vm->data, vm->data + 0x10000);
+}
+
+// addrs: memory that the instruction may have written (4 bytes each),
+// full: compare all of the memory (system calls, string instructions)
+void XTrace::step(VMBase *vm, const uint16_t *st, uint16_t seqpc,
+        const int *addrs, int naddr, bool full) {
+    if (needimage && fd < 0) return; // fork() in the child
+    uint16_t mask = 0;
+    for (int i = 0; i < XT_STATE; i++) {
+        if (i == pcreg ? st[i] != seqpc : st[i] != last[i]) mask |= XT_REG(i);
+    }
+    mem.clear();
+    nruns = 0;
+    if (full) {
+        diff(vm, 0, 0x10000);
+    } else {
+        for (int i = 0; i < naddr; i++) {
+            if (addrs[i] >= 0) diff(vm, addrs[i], 4);
+        }
+    }
+    if (nruns) mask |= XT_MEM;
+    put16(mask);
+    for (int i = 0; i < XT_STATE; i++) {
+        if (mask & XT_REG(i)) put16(st[i]);
+    }
+    if (nruns) putmem();
+    memcpy(last, st, sizeof (last));
+    if (++insn % XT_MARKSTEP) return;
+    entry(XT_MARK);
+    put16(XT_SPECIAL | XT_MARK);
+    put(&insn, sizeof (insn));
+    putstate(st);
+    put(vm->data, 0x10000);
+}
+
+// changes made outside of instructions (signal delivery)
+void XTrace::async(VMBase *vm, const uint16_t *st) {
+    if (needimage && fd < 0) return;
+    mem.clear();
+    nruns = 0;
+    diff(vm, 0, 0x10000);
+    if (!nruns && !memcmp(st, last, sizeof (last))) return;
+    put16(XT_SPECIAL | XT_ASYNC);
+    putstate(st);
+    putmem();
+}
+
+void XTrace::close() {
+    if (fd < 0) return;
+    put16(XT_SPECIAL | XT_END);
+    flush();
+    uint32_t n = index.size() / 17;
+    index.insert(index.end(), (uint8_t *) &n, (uint8_t *) (&n + 1));
+    index.insert(index.end(), (const uint8_t *) "7IDX", (const uint8_t *) "7IDX" + 4);
+    write(fd, &index[0], index.size());
+    ::close(fd);
+    fd = -1;
+    needimage = true;
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// binary execution trace (-X): per instruction, only what changed is
+// written (PC if not sequential, registers, flags, memory bytes).
+// decoded by 7trace, which replays it through VM::debug().
+//
+// file: "7TRC", then records starting with a uint16_t mask:
+//   XT_REG(n): changed registers follow (uint16_t each, in order)
+//   XT_FLAGS: flags follow, XT_MEM: memory runs follow
+//     (uint16_t count, {uint16_t addr, uint16_t len, bytes} * count)
+//   XT_SPECIAL: the low byte is one of XT_IMAGE, XT_MARK, XT_ASYNC, XT_END
+// state: 8 registers, IP (i8086 only) and flags as uint16_t[XT_STATE].
+// the index trailer ({uint8_t type, uint64_t insn, offset} * n,
+// uint32_t n, "7IDX") lists images and marks for seeking.
+
+extern std::string xtracepath;
+
+enum {
+    XT_STATE = 10,
+    XT_FLAGREG = 9,
+    XT_FLAGS = 1 << XT_FLAGREG,
+    XT_MEM = 1 << 10,
+    XT_SPECIAL = 1 << 15,
+
+    XT_IMAGE = 1, // arch, shared, name, text, data, syms, state
+    XT_MARK = 2, // insn, state, data: every XT_MARKSTEP instructions
+    XT_ASYNC = 3, // state, memory runs: changes between instructions
+    XT_END = 4,
+
+    XT_PDP11 = 0,
+    XT_I8086 = 1,
+};
+
+#define XT_REG(n) (1 << (n))
+
+static const uint64_t XT_MARKSTEP = 1 << 20;
+
+struct VMBase;
+
+class XTrace {
+    int fd, pcreg;
+    bool needimage;
+    std::vector<uint8_t> buf, shadow, mem;
+    size_t pos;
+    uint64_t flushed, insn;
+    uint16_t last[XT_STATE];
+    int nruns;
+    std::vector<uint8_t> index;
+
+    void put(const void *p, size_t len);
+    void put16(uint16_t v);
+    void putstate(const uint16_t *st);
+    void diff(VMBase *vm, int addr, int len);
+    void putmem();
+    void entry(int type);
+    void flush();
+
+public:
+    XTrace();
+    XTrace(const XTrace &xt);
+    ~XTrace();
+
+    inline bool active() {
+        return !needimage;
+    }
+
+    void exec();
+    void fork();
+    void image(VMBase *vm, int arch, int pid, const uint16_t *st);
+    void step(VMBase *vm, const uint16_t *st, uint16_t seqpc,
+            const int *addrs, int naddr, bool full);
+    void async(VMBase *vm, const uint16_t *st);
+    void close();
+};
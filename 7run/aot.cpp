@@ -0,0 +1,55 @@
+#include "UnixV6/OSPDP11.h"
+#include "Minix2/OS.h"
+#include <stdio.h>
+#include <string.h>
+
+// 7aot: translate a PDP-11 a.out or a MINIX 2 i86 executable to C++ that
+// 7run-aot links and selects by the hash of the text (see make aot)
+
+int main(int argc, char *argv[]) {
+    int ver = 6;
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-7") {
+            ver = 7;
+        } else {
+            args.push_back(arg);
+        }
+    }
+    if (args.size() < 2 || args.size() > 3) {
+        printf("usage: %s [-7] a.out name [out.cpp]\n", argv[0]);
+        printf("    -7: UNIX V7 binary\n");
+        printf("    name: shown by 7run-aot -s when it runs the translation\n");
+        return 1;
+    }
+
+    uint8_t buf[2];
+    FILE *f = fopen(args[0].c_str(), "rb");
+    if (!f || fread(buf, 1, 2, f) != 2) {
+        fprintf(stderr, "can not read: %s\n", args[0].c_str());
+        if (f) fclose(f);
+        return 1;
+    }
+    fclose(f);
+    UnixBase *ub;
+    if (UnixV6::OSPDP11::check(buf)) {
+        ub = new UnixV6::OSPDP11(ver);
+    } else {
+        ub = new Minix2::OS();
+    }
+    if (!ub->load(args[0])) {
+        delete ub;
+        return 1;
+    }
+    f = stdout;
+    if (args.size() == 3 && !(f = fopen(args[2].c_str(), "w"))) {
+        fprintf(stderr, "can not open: %s\n", args[2].c_str());
+        delete ub;
+        return 1;
+    }
+    int ret = ub->aotgen(f, args[1]);
+    if (f != stdout) fclose(f);
+    delete ub;
+    return ret;
+}
@@ -0,0 +1,20043 @@
+// m2/bin/cc translated by 7aot: 919 blocks, do not edit
+#include "../i8086/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.IP) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x0004: goto L0004;
+        case 0x0006: goto L0006;
+        case 0x0010: goto L0010;
+        case 0x0019: goto L0019;
+        case 0x001e: goto L001e;
+        case 0x0024: goto L0024;
+        case 0x0028: goto L0028;
+        case 0x002e: goto L002e;
+        case 0x002f: goto L002f;
+        case 0x0034: goto L0034;
+        case 0x0038: goto L0038;
+        case 0x0039: goto L0039;
+        case 0x0040: goto L0040;
+        case 0x0046: goto L0046;
+        case 0x004a: goto L004a;
+        case 0x0050: goto L0050;
+        case 0x005c: goto L005c;
+        case 0x005f: goto L005f;
+        case 0x0063: goto L0063;
+        case 0x0066: goto L0066;
+        case 0x006a: goto L006a;
+        case 0x006b: goto L006b;
+        case 0x006c: goto L006c;
+        case 0x006f: goto L006f;
+        case 0x0073: goto L0073;
+        case 0x0076: goto L0076;
+        case 0x007c: goto L007c;
+        case 0x007f: goto L007f;
+        case 0x0083: goto L0083;
+        case 0x0088: goto L0088;
+        case 0x0094: goto L0094;
+        case 0x009c: goto L009c;
+        case 0x00a2: goto L00a2;
+        case 0x00a7: goto L00a7;
+        case 0x00aa: goto L00aa;
+        case 0x00b4: goto L00b4;
+        case 0x00bc: goto L00bc;
+        case 0x00ca: goto L00ca;
+        case 0x00ce: goto L00ce;
+        case 0x00d6: goto L00d6;
+        case 0x00da: goto L00da;
+        case 0x00dc: goto L00dc;
+        case 0x00e3: goto L00e3;
+        case 0x00e4: goto L00e4;
+        case 0x00f8: goto L00f8;
+        case 0x00fa: goto L00fa;
+        case 0x00fc: goto L00fc;
+        case 0x00fe: goto L00fe;
+        case 0x0103: goto L0103;
+        case 0x0106: goto L0106;
+        case 0x0109: goto L0109;
+        case 0x0116: goto L0116;
+        case 0x011f: goto L011f;
+        case 0x0129: goto L0129;
+        case 0x012b: goto L012b;
+        case 0x012e: goto L012e;
+        case 0x0132: goto L0132;
+        case 0x0136: goto L0136;
+        case 0x0139: goto L0139;
+        case 0x013a: goto L013a;
+        case 0x0141: goto L0141;
+        case 0x0148: goto L0148;
+        case 0x0149: goto L0149;
+        case 0x014c: goto L014c;
+        case 0x0150: goto L0150;
+        case 0x0154: goto L0154;
+        case 0x0163: goto L0163;
+        case 0x0174: goto L0174;
+        case 0x0177: goto L0177;
+        case 0x017f: goto L017f;
+        case 0x0186: goto L0186;
+        case 0x018a: goto L018a;
+        case 0x0191: goto L0191;
+        case 0x0193: goto L0193;
+        case 0x019e: goto L019e;
+        case 0x01a5: goto L01a5;
+        case 0x01b0: goto L01b0;
+        case 0x01b2: goto L01b2;
+        case 0x01b6: goto L01b6;
+        case 0x01bd: goto L01bd;
+        case 0x01be: goto L01be;
+        case 0x01c2: goto L01c2;
+        case 0x01c4: goto L01c4;
+        case 0x01cf: goto L01cf;
+        case 0x01d1: goto L01d1;
+        case 0x01d6: goto L01d6;
+        case 0x01d9: goto L01d9;
+        case 0x01eb: goto L01eb;
+        case 0x01f1: goto L01f1;
+        case 0x01f9: goto L01f9;
+        case 0x01fd: goto L01fd;
+        case 0x0200: goto L0200;
+        case 0x0205: goto L0205;
+        case 0x020b: goto L020b;
+        case 0x0213: goto L0213;
+        case 0x021b: goto L021b;
+        case 0x0221: goto L0221;
+        case 0x0224: goto L0224;
+        case 0x022c: goto L022c;
+        case 0x0238: goto L0238;
+        case 0x0241: goto L0241;
+        case 0x024c: goto L024c;
+        case 0x0254: goto L0254;
+        case 0x0255: goto L0255;
+        case 0x025c: goto L025c;
+        case 0x0267: goto L0267;
+        case 0x0268: goto L0268;
+        case 0x0270: goto L0270;
+        case 0x027a: goto L027a;
+        case 0x027d: goto L027d;
+        case 0x0283: goto L0283;
+        case 0x028a: goto L028a;
+        case 0x0293: goto L0293;
+        case 0x0298: goto L0298;
+        case 0x029e: goto L029e;
+        case 0x02a1: goto L02a1;
+        case 0x02a9: goto L02a9;
+        case 0x02ae: goto L02ae;
+        case 0x02bb: goto L02bb;
+        case 0x02be: goto L02be;
+        case 0x02ce: goto L02ce;
+        case 0x02d7: goto L02d7;
+        case 0x02e6: goto L02e6;
+        case 0x02f4: goto L02f4;
+        case 0x02f9: goto L02f9;
+        case 0x0303: goto L0303;
+        case 0x0306: goto L0306;
+        case 0x030f: goto L030f;
+        case 0x0316: goto L0316;
+        case 0x031c: goto L031c;
+        case 0x031f: goto L031f;
+        case 0x032b: goto L032b;
+        case 0x0332: goto L0332;
+        case 0x0339: goto L0339;
+        case 0x0341: goto L0341;
+        case 0x0346: goto L0346;
+        case 0x0350: goto L0350;
+        case 0x0357: goto L0357;
+        case 0x0362: goto L0362;
+        case 0x0364: goto L0364;
+        case 0x036b: goto L036b;
+        case 0x0378: goto L0378;
+        case 0x0385: goto L0385;
+        case 0x039f: goto L039f;
+        case 0x03a8: goto L03a8;
+        case 0x03af: goto L03af;
+        case 0x03b9: goto L03b9;
+        case 0x03bd: goto L03bd;
+        case 0x03c4: goto L03c4;
+        case 0x03cc: goto L03cc;
+        case 0x03cf: goto L03cf;
+        case 0x03d6: goto L03d6;
+        case 0x03d9: goto L03d9;
+        case 0x03dc: goto L03dc;
+        case 0x03e2: goto L03e2;
+        case 0x03e7: goto L03e7;
+        case 0x03f9: goto L03f9;
+        case 0x0407: goto L0407;
+        case 0x040c: goto L040c;
+        case 0x040f: goto L040f;
+        case 0x0417: goto L0417;
+        case 0x0421: goto L0421;
+        case 0x0428: goto L0428;
+        case 0x0435: goto L0435;
+        case 0x0441: goto L0441;
+        case 0x044e: goto L044e;
+        case 0x0451: goto L0451;
+        case 0x0459: goto L0459;
+        case 0x0463: goto L0463;
+        case 0x0465: goto L0465;
+        case 0x046c: goto L046c;
+        case 0x0470: goto L0470;
+        case 0x047a: goto L047a;
+        case 0x0481: goto L0481;
+        case 0x0488: goto L0488;
+        case 0x048f: goto L048f;
+        case 0x0497: goto L0497;
+        case 0x0498: goto L0498;
+        case 0x049f: goto L049f;
+        case 0x04a5: goto L04a5;
+        case 0x04a6: goto L04a6;
+        case 0x04a9: goto L04a9;
+        case 0x04b3: goto L04b3;
+        case 0x04ba: goto L04ba;
+        case 0x04c1: goto L04c1;
+        case 0x04c2: goto L04c2;
+        case 0x04c7: goto L04c7;
+        case 0x04d5: goto L04d5;
+        case 0x04db: goto L04db;
+        case 0x04e5: goto L04e5;
+        case 0x04ed: goto L04ed;
+        case 0x04f4: goto L04f4;
+        case 0x04f5: goto L04f5;
+        case 0x0505: goto L0505;
+        case 0x053f: goto L053f;
+        case 0x0546: goto L0546;
+        case 0x0547: goto L0547;
+        case 0x0554: goto L0554;
+        case 0x0560: goto L0560;
+        case 0x0563: goto L0563;
+        case 0x056e: goto L056e;
+        case 0x057a: goto L057a;
+        case 0x057e: goto L057e;
+        case 0x058a: goto L058a;
+        case 0x058e: goto L058e;
+        case 0x059a: goto L059a;
+        case 0x05a1: goto L05a1;
+        case 0x05ab: goto L05ab;
+        case 0x05b0: goto L05b0;
+        case 0x05b7: goto L05b7;
+        case 0x05bb: goto L05bb;
+        case 0x05bc: goto L05bc;
+        case 0x05c1: goto L05c1;
+        case 0x05c5: goto L05c5;
+        case 0x05c8: goto L05c8;
+        case 0x05cd: goto L05cd;
+        case 0x05d0: goto L05d0;
+        case 0x05e1: goto L05e1;
+        case 0x05e6: goto L05e6;
+        case 0x05f7: goto L05f7;
+        case 0x05fa: goto L05fa;
+        case 0x0601: goto L0601;
+        case 0x0606: goto L0606;
+        case 0x0609: goto L0609;
+        case 0x060e: goto L060e;
+        case 0x0613: goto L0613;
+        case 0x0616: goto L0616;
+        case 0x061b: goto L061b;
+        case 0x0620: goto L0620;
+        case 0x0622: goto L0622;
+        case 0x0625: goto L0625;
+        case 0x0643: goto L0643;
+        case 0x064a: goto L064a;
+        case 0x0658: goto L0658;
+        case 0x065e: goto L065e;
+        case 0x066f: goto L066f;
+        case 0x0676: goto L0676;
+        case 0x067a: goto L067a;
+        case 0x0684: goto L0684;
+        case 0x068b: goto L068b;
+        case 0x0692: goto L0692;
+        case 0x0693: goto L0693;
+        case 0x069c: goto L069c;
+        case 0x06a3: goto L06a3;
+        case 0x06aa: goto L06aa;
+        case 0x06b1: goto L06b1;
+        case 0x06b2: goto L06b2;
+        case 0x06b9: goto L06b9;
+        case 0x06ba: goto L06ba;
+        case 0x06c1: goto L06c1;
+        case 0x06c7: goto L06c7;
+        case 0x06d3: goto L06d3;
+        case 0x06d7: goto L06d7;
+        case 0x06de: goto L06de;
+        case 0x06e1: goto L06e1;
+        case 0x06e8: goto L06e8;
+        case 0x06f1: goto L06f1;
+        case 0x06fb: goto L06fb;
+        case 0x0701: goto L0701;
+        case 0x0707: goto L0707;
+        case 0x0711: goto L0711;
+        case 0x0717: goto L0717;
+        case 0x071e: goto L071e;
+        case 0x071f: goto L071f;
+        case 0x0728: goto L0728;
+        case 0x072f: goto L072f;
+        case 0x0736: goto L0736;
+        case 0x0741: goto L0741;
+        case 0x0748: goto L0748;
+        case 0x074f: goto L074f;
+        case 0x0750: goto L0750;
+        case 0x0754: goto L0754;
+        case 0x0755: goto L0755;
+        case 0x075b: goto L075b;
+        case 0x0762: goto L0762;
+        case 0x0763: goto L0763;
+        case 0x0771: goto L0771;
+        case 0x0778: goto L0778;
+        case 0x077a: goto L077a;
+        case 0x0781: goto L0781;
+        case 0x078c: goto L078c;
+        case 0x0792: goto L0792;
+        case 0x079a: goto L079a;
+        case 0x07a5: goto L07a5;
+        case 0x07ad: goto L07ad;
+        case 0x07b0: goto L07b0;
+        case 0x07be: goto L07be;
+        case 0x07c4: goto L07c4;
+        case 0x07d0: goto L07d0;
+        case 0x07d4: goto L07d4;
+        case 0x07e1: goto L07e1;
+        case 0x07eb: goto L07eb;
+        case 0x07ee: goto L07ee;
+        case 0x07f1: goto L07f1;
+        case 0x07ff: goto L07ff;
+        case 0x0804: goto L0804;
+        case 0x0820: goto L0820;
+        case 0x082b: goto L082b;
+        case 0x082f: goto L082f;
+        case 0x083a: goto L083a;
+        case 0x083f: goto L083f;
+        case 0x0843: goto L0843;
+        case 0x084d: goto L084d;
+        case 0x0850: goto L0850;
+        case 0x0853: goto L0853;
+        case 0x085c: goto L085c;
+        case 0x0864: goto L0864;
+        case 0x0868: goto L0868;
+        case 0x0887: goto L0887;
+        case 0x0888: goto L0888;
+        case 0x0890: goto L0890;
+        case 0x0897: goto L0897;
+        case 0x089d: goto L089d;
+        case 0x08a2: goto L08a2;
+        case 0x08a7: goto L08a7;
+        case 0x08aa: goto L08aa;
+        case 0x08b1: goto L08b1;
+        case 0x08b4: goto L08b4;
+        case 0x08b7: goto L08b7;
+        case 0x08d5: goto L08d5;
+        case 0x08de: goto L08de;
+        case 0x08ee: goto L08ee;
+        case 0x08f0: goto L08f0;
+        case 0x08fa: goto L08fa;
+        case 0x0900: goto L0900;
+        case 0x0907: goto L0907;
+        case 0x090e: goto L090e;
+        case 0x0916: goto L0916;
+        case 0x091e: goto L091e;
+        case 0x0921: goto L0921;
+        case 0x0927: goto L0927;
+        case 0x092f: goto L092f;
+        case 0x0930: goto L0930;
+        case 0x0937: goto L0937;
+        case 0x093b: goto L093b;
+        case 0x0947: goto L0947;
+        case 0x095c: goto L095c;
+        case 0x095f: goto L095f;
+        case 0x0964: goto L0964;
+        case 0x0967: goto L0967;
+        case 0x096c: goto L096c;
+        case 0x0972: goto L0972;
+        case 0x098c: goto L098c;
+        case 0x0997: goto L0997;
+        case 0x09ad: goto L09ad;
+        case 0x09b6: goto L09b6;
+        case 0x09b9: goto L09b9;
+        case 0x09be: goto L09be;
+        case 0x09c8: goto L09c8;
+        case 0x09cc: goto L09cc;
+        case 0x09d5: goto L09d5;
+        case 0x09db: goto L09db;
+        case 0x09e2: goto L09e2;
+        case 0x09e4: goto L09e4;
+        case 0x09e8: goto L09e8;
+        case 0x09ea: goto L09ea;
+        case 0x09f1: goto L09f1;
+        case 0x09f2: goto L09f2;
+        case 0x09f5: goto L09f5;
+        case 0x09f6: goto L09f6;
+        case 0x09fd: goto L09fd;
+        case 0x0a03: goto L0a03;
+        case 0x0a08: goto L0a08;
+        case 0x0a13: goto L0a13;
+        case 0x0a1a: goto L0a1a;
+        case 0x0a1e: goto L0a1e;
+        case 0x0a20: goto L0a20;
+        case 0x0a25: goto L0a25;
+        case 0x0a2c: goto L0a2c;
+        case 0x0a3b: goto L0a3b;
+        case 0x0a3c: goto L0a3c;
+        case 0x0a43: goto L0a43;
+        case 0x0a47: goto L0a47;
+        case 0x0a4e: goto L0a4e;
+        case 0x0a53: goto L0a53;
+        case 0x0a5b: goto L0a5b;
+        case 0x0a5f: goto L0a5f;
+        case 0x0a60: goto L0a60;
+        case 0x0a63: goto L0a63;
+        case 0x0a68: goto L0a68;
+        case 0x0a6f: goto L0a6f;
+        case 0x0a70: goto L0a70;
+        case 0x0a72: goto L0a72;
+        case 0x0a75: goto L0a75;
+        case 0x0a76: goto L0a76;
+        case 0x0a7c: goto L0a7c;
+        case 0x0a81: goto L0a81;
+        case 0x0a86: goto L0a86;
+        case 0x0a89: goto L0a89;
+        case 0x0a8e: goto L0a8e;
+        case 0x0a92: goto L0a92;
+        case 0x0a96: goto L0a96;
+        case 0x0a98: goto L0a98;
+        case 0x0a9e: goto L0a9e;
+        case 0x0aa3: goto L0aa3;
+        case 0x0aa5: goto L0aa5;
+        case 0x0aa8: goto L0aa8;
+        case 0x0ace: goto L0ace;
+        case 0x0ad2: goto L0ad2;
+        case 0x0ad4: goto L0ad4;
+        case 0x0ad7: goto L0ad7;
+        case 0x0add: goto L0add;
+        case 0x0ae4: goto L0ae4;
+        case 0x0ae7: goto L0ae7;
+        case 0x0aeb: goto L0aeb;
+        case 0x0aee: goto L0aee;
+        case 0x0af0: goto L0af0;
+        case 0x0af3: goto L0af3;
+        case 0x0af6: goto L0af6;
+        case 0x0afe: goto L0afe;
+        case 0x0b06: goto L0b06;
+        case 0x0b14: goto L0b14;
+        case 0x0b19: goto L0b19;
+        case 0x0b1c: goto L0b1c;
+        case 0x0b20: goto L0b20;
+        case 0x0b28: goto L0b28;
+        case 0x0b30: goto L0b30;
+        case 0x0b3a: goto L0b3a;
+        case 0x0b41: goto L0b41;
+        case 0x0b48: goto L0b48;
+        case 0x0b4f: goto L0b4f;
+        case 0x0b50: goto L0b50;
+        case 0x0b52: goto L0b52;
+        case 0x0b55: goto L0b55;
+        case 0x0b56: goto L0b56;
+        case 0x0b59: goto L0b59;
+        case 0x0b5c: goto L0b5c;
+        case 0x0b5e: goto L0b5e;
+        case 0x0b6e: goto L0b6e;
+        case 0x0b71: goto L0b71;
+        case 0x0b83: goto L0b83;
+        case 0x0b8a: goto L0b8a;
+        case 0x0b91: goto L0b91;
+        case 0x0b98: goto L0b98;
+        case 0x0b99: goto L0b99;
+        case 0x0b9e: goto L0b9e;
+        case 0x0ba9: goto L0ba9;
+        case 0x0bb0: goto L0bb0;
+        case 0x0bb8: goto L0bb8;
+        case 0x0bbe: goto L0bbe;
+        case 0x0bcf: goto L0bcf;
+        case 0x0bd2: goto L0bd2;
+        case 0x0bd7: goto L0bd7;
+        case 0x0bde: goto L0bde;
+        case 0x0be2: goto L0be2;
+        case 0x0bec: goto L0bec;
+        case 0x0bfa: goto L0bfa;
+        case 0x0c01: goto L0c01;
+        case 0x0c07: goto L0c07;
+        case 0x0c0d: goto L0c0d;
+        case 0x0c13: goto L0c13;
+        case 0x0c14: goto L0c14;
+        case 0x0c1a: goto L0c1a;
+        case 0x0c1e: goto L0c1e;
+        case 0x0c22: goto L0c22;
+        case 0x0c23: goto L0c23;
+        case 0x0c27: goto L0c27;
+        case 0x0c2d: goto L0c2d;
+        case 0x0c31: goto L0c31;
+        case 0x0c35: goto L0c35;
+        case 0x0c36: goto L0c36;
+        case 0x0c3a: goto L0c3a;
+        case 0x0c41: goto L0c41;
+        case 0x0c4b: goto L0c4b;
+        case 0x0c4e: goto L0c4e;
+        case 0x0c54: goto L0c54;
+        case 0x0c61: goto L0c61;
+        case 0x0c65: goto L0c65;
+        case 0x0c6b: goto L0c6b;
+        case 0x0c6f: goto L0c6f;
+        case 0x0c74: goto L0c74;
+        case 0x0c76: goto L0c76;
+        case 0x0c7b: goto L0c7b;
+        case 0x0c80: goto L0c80;
+        case 0x0c83: goto L0c83;
+        case 0x0c8c: goto L0c8c;
+        case 0x0c96: goto L0c96;
+        case 0x0c9d: goto L0c9d;
+        case 0x0ca2: goto L0ca2;
+        case 0x0ca7: goto L0ca7;
+        case 0x0cac: goto L0cac;
+        case 0x0cb0: goto L0cb0;
+        case 0x0cb2: goto L0cb2;
+        case 0x0cb5: goto L0cb5;
+        case 0x0cbc: goto L0cbc;
+        case 0x0cc6: goto L0cc6;
+        case 0x0cd1: goto L0cd1;
+        case 0x0cd6: goto L0cd6;
+        case 0x0cdc: goto L0cdc;
+        case 0x0ce2: goto L0ce2;
+        case 0x0ce6: goto L0ce6;
+        case 0x0cec: goto L0cec;
+        case 0x0cee: goto L0cee;
+        case 0x0cf3: goto L0cf3;
+        case 0x0cfa: goto L0cfa;
+        case 0x0d02: goto L0d02;
+        case 0x0d08: goto L0d08;
+        case 0x0d0e: goto L0d0e;
+        case 0x0d13: goto L0d13;
+        case 0x0d17: goto L0d17;
+        case 0x0d1a: goto L0d1a;
+        case 0x0d1d: goto L0d1d;
+        case 0x0d25: goto L0d25;
+        case 0x0d28: goto L0d28;
+        case 0x0d30: goto L0d30;
+        case 0x0d3a: goto L0d3a;
+        case 0x0d40: goto L0d40;
+        case 0x0d45: goto L0d45;
+        case 0x0d4b: goto L0d4b;
+        case 0x0d4e: goto L0d4e;
+        case 0x0d55: goto L0d55;
+        case 0x0d5b: goto L0d5b;
+        case 0x0d5e: goto L0d5e;
+        case 0x0d65: goto L0d65;
+        case 0x0d6b: goto L0d6b;
+        case 0x0d75: goto L0d75;
+        case 0x0d7b: goto L0d7b;
+        case 0x0d7e: goto L0d7e;
+        case 0x0d80: goto L0d80;
+        case 0x0d82: goto L0d82;
+        case 0x0d8f: goto L0d8f;
+        case 0x0d95: goto L0d95;
+        case 0x0d9b: goto L0d9b;
+        case 0x0da6: goto L0da6;
+        case 0x0daa: goto L0daa;
+        case 0x0dad: goto L0dad;
+        case 0x0dc8: goto L0dc8;
+        case 0x0dca: goto L0dca;
+        case 0x0dcd: goto L0dcd;
+        case 0x0dd0: goto L0dd0;
+        case 0x0de7: goto L0de7;
+        case 0x0ded: goto L0ded;
+        case 0x0df4: goto L0df4;
+        case 0x0dfa: goto L0dfa;
+        case 0x0e00: goto L0e00;
+        case 0x0e0a: goto L0e0a;
+        case 0x0e0c: goto L0e0c;
+        case 0x0e0f: goto L0e0f;
+        case 0x0e12: goto L0e12;
+        case 0x0e2a: goto L0e2a;
+        case 0x0e33: goto L0e33;
+        case 0x0e3b: goto L0e3b;
+        case 0x0e3d: goto L0e3d;
+        case 0x0e40: goto L0e40;
+        case 0x0e42: goto L0e42;
+        case 0x0e53: goto L0e53;
+        case 0x0e67: goto L0e67;
+        case 0x0e6c: goto L0e6c;
+        case 0x0e72: goto L0e72;
+        case 0x0e7c: goto L0e7c;
+        case 0x0e82: goto L0e82;
+        case 0x0e85: goto L0e85;
+        case 0x0e8b: goto L0e8b;
+        case 0x0e8d: goto L0e8d;
+        case 0x0e93: goto L0e93;
+        case 0x0e9c: goto L0e9c;
+        case 0x0e9e: goto L0e9e;
+        case 0x0ea4: goto L0ea4;
+        case 0x0eae: goto L0eae;
+        case 0x0eb3: goto L0eb3;
+        case 0x0eb9: goto L0eb9;
+        case 0x0ebb: goto L0ebb;
+        case 0x0ec1: goto L0ec1;
+        case 0x0ec3: goto L0ec3;
+        case 0x0ec8: goto L0ec8;
+        case 0x0ed9: goto L0ed9;
+        case 0x0eed: goto L0eed;
+        case 0x0ef2: goto L0ef2;
+        case 0x0ef5: goto L0ef5;
+        case 0x0f13: goto L0f13;
+        case 0x0f1c: goto L0f1c;
+        case 0x0f28: goto L0f28;
+        case 0x0f33: goto L0f33;
+        case 0x0f37: goto L0f37;
+        case 0x0f3c: goto L0f3c;
+        case 0x0f4d: goto L0f4d;
+        case 0x0f61: goto L0f61;
+        case 0x0f66: goto L0f66;
+        case 0x0f6c: goto L0f6c;
+        case 0x0f75: goto L0f75;
+        case 0x0f77: goto L0f77;
+        case 0x0f7d: goto L0f7d;
+        case 0x0f86: goto L0f86;
+        case 0x0f88: goto L0f88;
+        case 0x0f8a: goto L0f8a;
+        case 0x0f8f: goto L0f8f;
+        case 0x0f92: goto L0f92;
+        case 0x0fa3: goto L0fa3;
+        case 0x0fa6: goto L0fa6;
+        case 0x0fb9: goto L0fb9;
+        case 0x0fcd: goto L0fcd;
+        case 0x0fe2: goto L0fe2;
+        case 0x0fea: goto L0fea;
+        case 0x0fee: goto L0fee;
+        case 0x1001: goto L1001;
+        case 0x1015: goto L1015;
+        case 0x1019: goto L1019;
+        case 0x1020: goto L1020;
+        case 0x1027: goto L1027;
+        case 0x102f: goto L102f;
+        case 0x1031: goto L1031;
+        case 0x1035: goto L1035;
+        case 0x1042: goto L1042;
+        case 0x1049: goto L1049;
+        case 0x104f: goto L104f;
+        case 0x1055: goto L1055;
+        case 0x1056: goto L1056;
+        case 0x105c: goto L105c;
+        case 0x105f: goto L105f;
+        case 0x106a: goto L106a;
+        case 0x106e: goto L106e;
+        case 0x107c: goto L107c;
+        case 0x108d: goto L108d;
+        case 0x1094: goto L1094;
+        case 0x10a1: goto L10a1;
+        case 0x10aa: goto L10aa;
+        case 0x10ad: goto L10ad;
+        case 0x10b3: goto L10b3;
+        case 0x10b8: goto L10b8;
+        case 0x10bb: goto L10bb;
+        case 0x10ca: goto L10ca;
+        case 0x10cf: goto L10cf;
+        case 0x10de: goto L10de;
+        case 0x10e4: goto L10e4;
+        case 0x10e9: goto L10e9;
+        case 0x10ee: goto L10ee;
+        case 0x10f6: goto L10f6;
+        case 0x10f9: goto L10f9;
+        case 0x1108: goto L1108;
+        case 0x110d: goto L110d;
+        case 0x1110: goto L1110;
+        case 0x1112: goto L1112;
+        case 0x111b: goto L111b;
+        case 0x112a: goto L112a;
+        case 0x112f: goto L112f;
+        case 0x1138: goto L1138;
+        case 0x1139: goto L1139;
+        case 0x113e: goto L113e;
+        case 0x1143: goto L1143;
+        case 0x1148: goto L1148;
+        case 0x1150: goto L1150;
+        case 0x1155: goto L1155;
+        case 0x115d: goto L115d;
+        case 0x1167: goto L1167;
+        case 0x1174: goto L1174;
+        case 0x1178: goto L1178;
+        case 0x117d: goto L117d;
+        case 0x1185: goto L1185;
+        case 0x118a: goto L118a;
+        case 0x118f: goto L118f;
+        case 0x1197: goto L1197;
+        case 0x11a4: goto L11a4;
+        case 0x11a8: goto L11a8;
+        case 0x11ad: goto L11ad;
+        case 0x11b0: goto L11b0;
+        case 0x11b7: goto L11b7;
+        case 0x11ba: goto L11ba;
+        case 0x11bc: goto L11bc;
+        case 0x11c2: goto L11c2;
+        case 0x11c5: goto L11c5;
+        case 0x11cd: goto L11cd;
+        case 0x11d0: goto L11d0;
+        case 0x11da: goto L11da;
+        case 0x11dc: goto L11dc;
+        case 0x11df: goto L11df;
+        case 0x11e5: goto L11e5;
+        case 0x11ec: goto L11ec;
+        case 0x11f2: goto L11f2;
+        case 0x11f8: goto L11f8;
+        case 0x11fc: goto L11fc;
+        case 0x120d: goto L120d;
+        case 0x1224: goto L1224;
+        case 0x122e: goto L122e;
+        case 0x1232: goto L1232;
+        case 0x1237: goto L1237;
+        case 0x123b: goto L123b;
+        case 0x1242: goto L1242;
+        case 0x124e: goto L124e;
+        case 0x1256: goto L1256;
+        case 0x1259: goto L1259;
+        case 0x1267: goto L1267;
+        case 0x126c: goto L126c;
+        case 0x1271: goto L1271;
+        case 0x1277: goto L1277;
+        case 0x127a: goto L127a;
+        case 0x1282: goto L1282;
+        case 0x128d: goto L128d;
+        case 0x1298: goto L1298;
+        case 0x129f: goto L129f;
+        case 0x12a6: goto L12a6;
+        case 0x12ae: goto L12ae;
+        case 0x12b3: goto L12b3;
+        case 0x12cc: goto L12cc;
+        case 0x12d5: goto L12d5;
+        case 0x12d9: goto L12d9;
+        case 0x12eb: goto L12eb;
+        case 0x12ef: goto L12ef;
+        case 0x12f7: goto L12f7;
+        case 0x1306: goto L1306;
+        case 0x130c: goto L130c;
+        case 0x1315: goto L1315;
+        case 0x131b: goto L131b;
+        case 0x131f: goto L131f;
+        case 0x1326: goto L1326;
+        case 0x132c: goto L132c;
+        case 0x1331: goto L1331;
+        case 0x1337: goto L1337;
+        case 0x1339: goto L1339;
+        case 0x1428: goto L1428;
+        case 0x143a: goto L143a;
+        case 0x1440: goto L1440;
+        case 0x1444: goto L1444;
+        case 0x1449: goto L1449;
+        case 0x144f: goto L144f;
+        case 0x1458: goto L1458;
+        case 0x145f: goto L145f;
+        case 0x1466: goto L1466;
+        case 0x146a: goto L146a;
+        case 0x1472: goto L1472;
+        case 0x147f: goto L147f;
+        case 0x1483: goto L1483;
+        case 0x148b: goto L148b;
+        case 0x149b: goto L149b;
+        case 0x149e: goto L149e;
+        case 0x14ac: goto L14ac;
+        case 0x14b1: goto L14b1;
+        case 0x14b6: goto L14b6;
+        case 0x14c1: goto L14c1;
+        case 0x14c8: goto L14c8;
+        case 0x14e0: goto L14e0;
+        case 0x14e7: goto L14e7;
+        case 0x14ec: goto L14ec;
+        case 0x14ef: goto L14ef;
+        case 0x14f2: goto L14f2;
+        case 0x1501: goto L1501;
+        case 0x1515: goto L1515;
+        case 0x151c: goto L151c;
+        case 0x1521: goto L1521;
+        case 0x1528: goto L1528;
+        case 0x152a: goto L152a;
+        case 0x152d: goto L152d;
+        case 0x1545: goto L1545;
+        case 0x1549: goto L1549;
+        case 0x154f: goto L154f;
+        case 0x1553: goto L1553;
+        case 0x1558: goto L1558;
+        case 0x155c: goto L155c;
+        case 0x1561: goto L1561;
+        case 0x1565: goto L1565;
+        case 0x1568: goto L1568;
+        case 0x156b: goto L156b;
+        case 0x1580: goto L1580;
+        case 0x1588: goto L1588;
+        case 0x158b: goto L158b;
+        case 0x1591: goto L1591;
+        case 0x159f: goto L159f;
+        case 0x15a2: goto L15a2;
+        case 0x15a5: goto L15a5;
+        case 0x15d0: goto L15d0;
+        case 0x1644: goto L1644;
+        case 0x164c: goto L164c;
+        case 0x16a9: goto L16a9;
+        case 0x16ad: goto L16ad;
+        case 0x16b1: goto L16b1;
+        case 0x16b5: goto L16b5;
+        case 0x16b9: goto L16b9;
+        case 0x16bd: goto L16bd;
+        case 0x16c1: goto L16c1;
+        case 0x16c5: goto L16c5;
+        case 0x16c9: goto L16c9;
+        case 0x16cd: goto L16cd;
+        case 0x16d1: goto L16d1;
+        case 0x16d5: goto L16d5;
+        case 0x16d9: goto L16d9;
+        case 0x16ed: goto L16ed;
+        case 0x16f2: goto L16f2;
+        case 0x16fd: goto L16fd;
+        case 0x16ff: goto L16ff;
+        case 0x1710: goto L1710;
+        case 0x1716: goto L1716;
+        case 0x171c: goto L171c;
+        case 0x1727: goto L1727;
+        case 0x172e: goto L172e;
+        case 0x1734: goto L1734;
+        case 0x173c: goto L173c;
+        case 0x1756: goto L1756;
+        case 0x175c: goto L175c;
+        case 0x1772: goto L1772;
+        case 0x1783: goto L1783;
+        case 0x1789: goto L1789;
+        case 0x17a4: goto L17a4;
+        case 0x17aa: goto L17aa;
+        case 0x17c0: goto L17c0;
+        case 0x17d1: goto L17d1;
+        case 0x17d7: goto L17d7;
+        case 0x17e9: goto L17e9;
+        case 0x17ef: goto L17ef;
+        case 0x180e: goto L180e;
+        case 0x1816: goto L1816;
+        case 0x181b: goto L181b;
+        case 0x1829: goto L1829;
+        case 0x182e: goto L182e;
+        case 0x183b: goto L183b;
+        case 0x1841: goto L1841;
+        case 0x1849: goto L1849;
+        case 0x184e: goto L184e;
+        case 0x185c: goto L185c;
+        case 0x1861: goto L1861;
+        case 0x186b: goto L186b;
+        case 0x1881: goto L1881;
+        case 0x1886: goto L1886;
+        case 0x1892: goto L1892;
+        case 0x1896: goto L1896;
+        case 0x189f: goto L189f;
+        case 0x18a8: goto L18a8;
+        case 0x18ab: goto L18ab;
+        case 0x18ca: goto L18ca;
+        case 0x18d2: goto L18d2;
+        case 0x18e8: goto L18e8;
+        case 0x18f7: goto L18f7;
+        case 0x1907: goto L1907;
+        case 0x1918: goto L1918;
+        case 0x1920: goto L1920;
+        case 0x1936: goto L1936;
+        case 0x1945: goto L1945;
+        case 0x1955: goto L1955;
+        case 0x1960: goto L1960;
+        case 0x1969: goto L1969;
+        case 0x196f: goto L196f;
+        case 0x1975: goto L1975;
+        case 0x19a1: goto L19a1;
+        case 0x19ac: goto L19ac;
+        case 0x19b0: goto L19b0;
+        case 0x19b3: goto L19b3;
+        case 0x19c7: goto L19c7;
+        case 0x19cd: goto L19cd;
+        case 0x19e1: goto L19e1;
+        case 0x19e7: goto L19e7;
+        case 0x1a07: goto L1a07;
+        case 0x1a0d: goto L1a0d;
+        case 0x1a1d: goto L1a1d;
+        case 0x1a23: goto L1a23;
+        case 0x1a41: goto L1a41;
+        case 0x1a4b: goto L1a4b;
+        case 0x1a53: goto L1a53;
+        case 0x1a62: goto L1a62;
+        case 0x1a68: goto L1a68;
+        case 0x1a8f: goto L1a8f;
+        case 0x1b21: goto L1b21;
+        case 0x1b31: goto L1b31;
+        case 0x1b42: goto L1b42;
+        case 0x1b48: goto L1b48;
+        case 0x1b5c: goto L1b5c;
+        case 0x1b63: goto L1b63;
+        case 0x1b68: goto L1b68;
+        case 0x1b6e: goto L1b6e;
+        case 0x1b76: goto L1b76;
+        case 0x1b79: goto L1b79;
+        case 0x1b7c: goto L1b7c;
+        case 0x1ba3: goto L1ba3;
+        case 0x1bbf: goto L1bbf;
+        case 0x1bc5: goto L1bc5;
+        case 0x1bcd: goto L1bcd;
+        case 0x1bd3: goto L1bd3;
+        case 0x1be8: goto L1be8;
+        case 0x1c03: goto L1c03;
+        case 0x1c04: goto L1c04;
+        case 0x1c0f: goto L1c0f;
+        case 0x1c16: goto L1c16;
+        case 0x1c21: goto L1c21;
+        case 0x1c28: goto L1c28;
+        case 0x1c29: goto L1c29;
+        case 0x1c2b: goto L1c2b;
+        case 0x1c31: goto L1c31;
+        case 0x1c34: goto L1c34;
+        case 0x1c36: goto L1c36;
+        case 0x1c38: goto L1c38;
+        case 0x1c3b: goto L1c3b;
+        case 0x1c3c: goto L1c3c;
+        case 0x1c40: goto L1c40;
+        case 0x1c57: goto L1c57;
+        case 0x1c6a: goto L1c6a;
+        case 0x1c6b: goto L1c6b;
+        case 0x1c72: goto L1c72;
+        case 0x1c7c: goto L1c7c;
+        case 0x1c94: goto L1c94;
+        case 0x1ca1: goto L1ca1;
+        case 0x1ca3: goto L1ca3;
+        case 0x1d09: goto L1d09;
+        case 0x1d0e: goto L1d0e;
+        case 0x1d14: goto L1d14;
+        case 0x1d18: goto L1d18;
+        case 0x1d1b: goto L1d1b;
+        case 0x1d1f: goto L1d1f;
+        case 0x1d26: goto L1d26;
+        case 0x1d28: goto L1d28;
+        case 0x1d2c: goto L1d2c;
+        case 0x1d2f: goto L1d2f;
+        case 0x1d32: goto L1d32;
+        case 0x1d33: goto L1d33;
+        case 0x1d34: goto L1d34;
+        case 0x1d3c: goto L1d3c;
+        case 0x1d3f: goto L1d3f;
+        case 0x1d77: goto L1d77;
+        case 0x1d81: goto L1d81;
+        case 0x1d84: goto L1d84;
+        case 0x1d86: goto L1d86;
+        case 0x1d92: goto L1d92;
+        case 0x1d95: goto L1d95;
+        case 0x1d9c: goto L1d9c;
+        case 0x1da9: goto L1da9;
+        case 0x1dad: goto L1dad;
+        case 0x1db5: goto L1db5;
+        case 0x1dc8: goto L1dc8;
+        case 0x1dcb: goto L1dcb;
+        case 0x1dcd: goto L1dcd;
+        case 0x1dfe: goto L1dfe;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: xor bp, bp
+    {
+        val = int16_t(r[5]) ^ int16_t(r[5]);
+        r[5] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0002, L0002);
+L0002:
+    AOT_BLOCK(0x0002, 1);
+    // 0002: mov bx, sp
+    {
+        r[3] = r[4];
+    }
+    AOT_GOTO(0x0004, L0004);
+L0004:
+    AOT_BLOCK(0x0004, 1);
+    // 0004: mov ax, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x0006, L0006);
+L0006:
+    AOT_BLOCK(0x0006, 4);
+    // 0006: lea dx, [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        r[2] = a;
+    }
+    // 0009: lea cx, [bx+4]
+    {
+        a = uint16_t(r[3] + 4);
+        r[1] = a;
+    }
+    // 000c: add cx, ax
+    {
+        val = (dst = int16_t(r[1])) + (src = int16_t(r[0]));
+        r[1] = val;
+    }
+    // 000e: add cx, ax
+    {
+        val = (dst = int16_t(r[1])) + (src = int16_t(r[0]));
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x0010, L0010);
+L0010:
+    AOT_BLOCK(0x0010, 3);
+    // 0010: mov bx, 0de2
+    {
+        r[3] = 0x0de2;
+    }
+    // 0013: cmp bx, 0ed2
+    {
+        val = (dst = int16_t(r[3])) - (src = 3794);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0017: jnb 0028
+    if (!CF)
+        AOT_GOTO(0x0028, L0028);
+    AOT_GOTO(0x0019, L0019);
+L0019:
+    AOT_BLOCK(0x0019, 2);
+    // 0019: test bl, 1
+    {
+        val = int8_t(r[3]) & 1;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 001c: jne 0028
+    if (!ZF)
+        AOT_GOTO(0x0028, L0028);
+    AOT_GOTO(0x001e, L001e);
+L001e:
+    AOT_BLOCK(0x001e, 2);
+    // 001e: cmp [bx], 5353
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 21331);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0022: jne 0028
+    if (!ZF)
+        AOT_GOTO(0x0028, L0028);
+    AOT_GOTO(0x0024, L0024);
+L0024:
+    AOT_BLOCK(0x0024, 1);
+    // 0024: mov [0002], bx
+    {
+        a = 0x0002;
+        WR16(a, r[3]);
+    }
+    AOT_GOTO(0x0028, L0028);
+L0028:
+    AOT_BLOCK(0x0028, 2);
+    // 0028: mov bx, [0002]
+    {
+        a = 0x0002;
+        r[3] = RD16(a);
+    }
+    // 002c: mov [bx], cx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[1]);
+    }
+    AOT_GOTO(0x002e, L002e);
+L002e:
+    AOT_BLOCK(0x002e, 1);
+    // 002e: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    AOT_GOTO(0x002f, L002f);
+L002f:
+    AOT_BLOCK(0x002f, 3);
+    // 002f: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 0030: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0031: call 0154
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0034);
+    }
+    AOT_GOTO(0x0154, L0154);
+L0034:
+    AOT_BLOCK(0x0034, 2);
+    // 0034: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0035: call 11df
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0038);
+    }
+    AOT_GOTO(0x11df, L11df);
+L0038:
+    // 0038: hlt
+    AOT_INTERP(0x0038);
+L0039:
+    AOT_BLOCK(0x0039, 5);
+    // 0039: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 003a: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 003c: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 003d: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 003e: xor si, si
+    {
+        val = int16_t(r[6]) ^ int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0040, L0040);
+L0040:
+    AOT_BLOCK(0x0040, 2);
+    // 0040: cmp [13f0], si
+    {
+        a = 0x13f0;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0044: jle 00aa
+    if (ZF || SF != OF)
+        AOT_GOTO(0x00aa, L00aa);
+    AOT_GOTO(0x0046, L0046);
+L0046:
+    AOT_BLOCK(0x0046, 2);
+    // 0046: mov bx, si
+    {
+        r[3] = r[6];
+    }
+    // 0048: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    AOT_GOTO(0x004a, L004a);
+L004a:
+    AOT_BLOCK(0x004a, 2);
+    // 004a: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 004d: mov ax, 0bf0
+    {
+        r[0] = 0x0bf0;
+    }
+    AOT_GOTO(0x0050, L0050);
+L0050:
+    AOT_BLOCK(0x0050, 5);
+    // 0050: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0051: push [bx+13f2]
+    {
+        a = uint16_t(r[3] + 5106);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0055: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    // 0058: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0059: call 0563
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x005c);
+    }
+    AOT_GOTO(0x0563, L0563);
+L005c:
+    AOT_BLOCK(0x005c, 1);
+    // 005c: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x005f, L005f);
+L005f:
+    AOT_BLOCK(0x005f, 2);
+    // 005f: mov ax, 0bec
+    {
+        r[0] = 0x0bec;
+    }
+    // 0062: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x0063, L0063);
+L0063:
+    AOT_BLOCK(0x0063, 1);
+    // 0063: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    AOT_GOTO(0x0066, L0066);
+L0066:
+    AOT_BLOCK(0x0066, 2);
+    // 0066: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0067: call 1710
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x006a);
+    }
+    AOT_GOTO(0x1710, L1710);
+L006a:
+    AOT_BLOCK(0x006a, 1);
+    // 006a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x006b, L006b);
+L006b:
+    AOT_BLOCK(0x006b, 1);
+    // 006b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x006c, L006c);
+L006c:
+    AOT_BLOCK(0x006c, 2);
+    // 006c: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 006e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x006f, L006f);
+L006f:
+    AOT_BLOCK(0x006f, 2);
+    // 006f: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    // 0072: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x0073, L0073);
+L0073:
+    AOT_BLOCK(0x0073, 1);
+    // 0073: call 16ad
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0076);
+    }
+    AOT_GOTO(0x16ad, L16ad);
+L0076:
+    AOT_BLOCK(0x0076, 4);
+    // 0076: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0077: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0078: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 007a: je 00a2
+    if (ZF)
+        AOT_GOTO(0x00a2, L00a2);
+    AOT_GOTO(0x007c, L007c);
+L007c:
+    AOT_BLOCK(0x007c, 1);
+    // 007c: mov ax, 0061
+    {
+        r[0] = 0x0061;
+    }
+    AOT_GOTO(0x007f, L007f);
+L007f:
+    AOT_BLOCK(0x007f, 2);
+    // 007f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0080: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    AOT_GOTO(0x0083, L0083);
+L0083:
+    AOT_BLOCK(0x0083, 3);
+    // 0083: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0084: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0085: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0088);
+    }
+    AOT_GOTO(0x172e, L172e);
+L0088:
+    AOT_BLOCK(0x0088, 7);
+    // 0088: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0089: sub ax, 0001
+    {
+        val = (dst = int16_t(r[0])) - (src = 1);
+        r[0] = val;
+    }
+    // 008c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 008d: add bx, ax
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[0]));
+        r[3] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 008f: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 0090: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 0092: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0094, L0094);
+L0094:
+    AOT_BLOCK(0x0094, 4);
+    // 0094: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0095: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    // 0098: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0099: call 16ad
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x009c);
+    }
+    AOT_GOTO(0x16ad, L16ad);
+L009c:
+    AOT_BLOCK(0x009c, 4);
+    // 009c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 009d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 009e: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 00a0: jne 00a7
+    if (!ZF)
+        AOT_GOTO(0x00a7, L00a7);
+    AOT_GOTO(0x00a2, L00a2);
+L00a2:
+    AOT_BLOCK(0x00a2, 2);
+    // 00a2: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    // 00a5: jmp short 0106
+    AOT_GOTO(0x0106, L0106);
+L00a7:
+    AOT_BLOCK(0x00a7, 2);
+    // 00a7: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 00a8: jmp short 0040
+    AOT_GOTO(0x0040, L0040);
+L00aa:
+    AOT_BLOCK(0x00aa, 4);
+    // 00aa: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 00ad: mov ax, 0bdc
+    {
+        r[0] = 0x0bdc;
+    }
+    // 00b0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00b1: mov ax, 0be2
+    {
+        r[0] = 0x0be2;
+    }
+    AOT_GOTO(0x00b4, L00b4);
+L00b4:
+    AOT_BLOCK(0x00b4, 4);
+    // 00b4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00b5: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    // 00b8: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00b9: call 0563
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00bc);
+    }
+    AOT_GOTO(0x0563, L0563);
+L00bc:
+    AOT_BLOCK(0x00bc, 6);
+    // 00bc: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 00bf: mov ax, 0bd8
+    {
+        r[0] = 0x0bd8;
+    }
+    // 00c2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00c3: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    // 00c6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00c7: call 1710
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00ca);
+    }
+    AOT_GOTO(0x1710, L1710);
+L00ca:
+    AOT_BLOCK(0x00ca, 3);
+    // 00ca: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00cb: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00cc: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x00ce, L00ce);
+L00ce:
+    AOT_BLOCK(0x00ce, 4);
+    // 00ce: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00cf: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    // 00d2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00d3: call 16ad
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00d6);
+    }
+    AOT_GOTO(0x16ad, L16ad);
+L00d6:
+    AOT_BLOCK(0x00d6, 3);
+    // 00d6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00d7: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00d8: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x00da, L00da);
+L00da:
+    AOT_BLOCK(0x00da, 1);
+    // 00da: je 0103
+    if (ZF)
+        AOT_GOTO(0x0103, L0103);
+    AOT_GOTO(0x00dc, L00dc);
+L00dc:
+    AOT_BLOCK(0x00dc, 3);
+    // 00dc: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    // 00df: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00e0: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00e3);
+    }
+    AOT_GOTO(0x172e, L172e);
+L00e3:
+    AOT_BLOCK(0x00e3, 1);
+    // 00e3: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x00e4, L00e4);
+L00e4:
+    AOT_BLOCK(0x00e4, 8);
+    // 00e4: sub ax, 0001
+    {
+        val = (dst = int16_t(r[0])) - (src = 1);
+        r[0] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 00e7: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 00e9: mov byte [di+eda], 61
+    {
+        a = uint16_t(r[7] + 3802);
+        WR8(a, 97);
+    }
+    // 00ee: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 00f0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00f1: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    // 00f4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00f5: call 16ad
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00f8);
+    }
+    AOT_GOTO(0x16ad, L16ad);
+L00f8:
+    AOT_BLOCK(0x00f8, 2);
+    // 00f8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00f9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x00fa, L00fa);
+L00fa:
+    AOT_BLOCK(0x00fa, 1);
+    // 00fa: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x00fc, L00fc);
+L00fc:
+    AOT_BLOCK(0x00fc, 1);
+    // 00fc: je 0103
+    if (ZF)
+        AOT_GOTO(0x0103, L0103);
+    AOT_GOTO(0x00fe, L00fe);
+L00fe:
+    AOT_BLOCK(0x00fe, 1);
+    // 00fe: mov byte [di+eda], 41
+    {
+        a = uint16_t(r[7] + 3802);
+        WR8(a, 65);
+    }
+    AOT_GOTO(0x0103, L0103);
+L0103:
+    AOT_BLOCK(0x0103, 1);
+    // 0103: mov ax, 0eda
+    {
+        r[0] = 0x0eda;
+    }
+    AOT_GOTO(0x0106, L0106);
+L0106:
+    AOT_BLOCK(0x0106, 1);
+    // 0106: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L0109:
+    AOT_BLOCK(0x0109, 6);
+    // 0109: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 010a: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 010c: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 010f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0110: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0113: call 149e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0116);
+    }
+    AOT_GOTO(0x149e, L149e);
+L0116:
+    AOT_BLOCK(0x0116, 4);
+    // 0116: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0117: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0118: cmp [0bb6], -1
+    {
+        a = 0x0bb6;
+        val = (dst = int16_t(RD16(a))) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 011d: je 012b
+    if (ZF)
+        AOT_GOTO(0x012b, L012b);
+    AOT_GOTO(0x011f, L011f);
+L011f:
+    AOT_BLOCK(0x011f, 3);
+    // 011f: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0122: push [0bb6]
+    {
+        a = 0x0bb6;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0126: call 16c5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0129);
+    }
+    AOT_GOTO(0x16c5, L16c5);
+L0129:
+    AOT_BLOCK(0x0129, 2);
+    // 0129: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 012a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x012b, L012b);
+L012b:
+    AOT_BLOCK(0x012b, 1);
+    // 012b: mov dx, 1282
+    {
+        r[2] = 0x1282;
+    }
+    AOT_GOTO(0x012e, L012e);
+L012e:
+    AOT_BLOCK(0x012e, 2);
+    // 012e: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0130: je 013a
+    if (ZF)
+        AOT_GOTO(0x013a, L013a);
+    AOT_GOTO(0x0132, L0132);
+L0132:
+    AOT_BLOCK(0x0132, 2);
+    // 0132: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 0135: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x0136, L0136);
+L0136:
+    AOT_BLOCK(0x0136, 1);
+    // 0136: call 0470
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0139);
+    }
+    AOT_GOTO(0x0470, L0470);
+L0139:
+    AOT_BLOCK(0x0139, 1);
+    // 0139: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x013a, L013a);
+L013a:
+    AOT_BLOCK(0x013a, 3);
+    // 013a: mov dx, 1242
+    {
+        r[2] = 0x1242;
+    }
+    // 013d: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 013f: je 0149
+    if (ZF)
+        AOT_GOTO(0x0149, L0149);
+    AOT_GOTO(0x0141, L0141);
+L0141:
+    AOT_BLOCK(0x0141, 3);
+    // 0141: mov ax, 1242
+    {
+        r[0] = 0x1242;
+    }
+    // 0144: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0145: call 0470
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0148);
+    }
+    AOT_GOTO(0x0470, L0470);
+L0148:
+    AOT_BLOCK(0x0148, 1);
+    // 0148: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0149, L0149);
+L0149:
+    AOT_BLOCK(0x0149, 1);
+    // 0149: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    AOT_GOTO(0x014c, L014c);
+L014c:
+    AOT_BLOCK(0x014c, 2);
+    // 014c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 014d: call 11df
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0150);
+    }
+    AOT_GOTO(0x11df, L11df);
+L0150:
+    AOT_BLOCK(0x0150, 2);
+    // 0150: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0151: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L0154:
+    AOT_BLOCK(0x0154, 8);
+    // 0154: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0155: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0157: sub sp, c
+    {
+        val = (dst = int16_t(r[4])) - (src = 12);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 015a: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 015b: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 015c: mov ax, 0c5a
+    {
+        r[0] = 0x0c5a;
+    }
+    // 015f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0160: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0163);
+    }
+    AOT_GOTO(0x172e, L172e);
+L0163:
+    AOT_BLOCK(0x0163, 6);
+    // 0163: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0164: mov [18f0], ax
+    {
+        WR16(0x18f0, r[0]);
+    }
+    // 0167: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 016a: add [bp+6], 2
+    {
+        a = uint16_t(r[5] + 6);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 016e: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 0170: mov [0bc0], dx
+    {
+        a = 0x0bc0;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x0174, L0174);
+L0174:
+    AOT_BLOCK(0x0174, 1);
+    // 0174: call 0997
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0177);
+    }
+    AOT_GOTO(0x0997, L0997);
+L0177:
+    AOT_BLOCK(0x0177, 4);
+    // 0177: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 017a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 017b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 017c: call 149e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x017f);
+    }
+    AOT_GOTO(0x149e, L149e);
+L017f:
+    AOT_BLOCK(0x017f, 4);
+    // 017f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0180: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0181: cmp ax, 0001
+    {
+        val = (dst = int16_t(r[0])) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0184: je 0193
+    if (ZF)
+        AOT_GOTO(0x0193, L0193);
+    AOT_GOTO(0x0186, L0186);
+L0186:
+    AOT_BLOCK(0x0186, 2);
+    // 0186: mov ax, 0109
+    {
+        r[0] = 0x0109;
+    }
+    // 0189: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x018a, L018a);
+L018a:
+    AOT_BLOCK(0x018a, 3);
+    // 018a: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 018d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 018e: call 149e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0191);
+    }
+    AOT_GOTO(0x149e, L149e);
+L0191:
+    AOT_BLOCK(0x0191, 2);
+    // 0191: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0192: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0193, L0193);
+L0193:
+    AOT_BLOCK(0x0193, 5);
+    // 0193: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0196: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0197: mov ax, 0002
+    {
+        r[0] = 0x0002;
+    }
+    // 019a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 019b: call 149e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x019e);
+    }
+    AOT_GOTO(0x149e, L149e);
+L019e:
+    AOT_BLOCK(0x019e, 4);
+    // 019e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 019f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 01a0: cmp ax, 0001
+    {
+        val = (dst = int16_t(r[0])) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 01a3: je 01b2
+    if (ZF)
+        AOT_GOTO(0x01b2, L01b2);
+    AOT_GOTO(0x01a5, L01a5);
+L01a5:
+    AOT_BLOCK(0x01a5, 5);
+    // 01a5: mov ax, 0109
+    {
+        r[0] = 0x0109;
+    }
+    // 01a8: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 01a9: mov ax, 0002
+    {
+        r[0] = 0x0002;
+    }
+    // 01ac: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 01ad: call 149e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x01b0);
+    }
+    AOT_GOTO(0x149e, L149e);
+L01b0:
+    AOT_BLOCK(0x01b0, 2);
+    // 01b0: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 01b1: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x01b2, L01b2);
+L01b2:
+    AOT_BLOCK(0x01b2, 2);
+    // 01b2: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 01b5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x01b6, L01b6);
+L01b6:
+    AOT_BLOCK(0x01b6, 3);
+    // 01b6: mov ax, 0003
+    {
+        r[0] = 0x0003;
+    }
+    // 01b9: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 01ba: call 149e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x01bd);
+    }
+    AOT_GOTO(0x149e, L149e);
+L01bd:
+    AOT_BLOCK(0x01bd, 1);
+    // 01bd: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x01be, L01be);
+L01be:
+    AOT_BLOCK(0x01be, 2);
+    // 01be: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 01bf: cmp ax, 0001
+    {
+        val = (dst = int16_t(r[0])) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    AOT_GOTO(0x01c2, L01c2);
+L01c2:
+    AOT_BLOCK(0x01c2, 1);
+    // 01c2: je 01d1
+    if (ZF)
+        AOT_GOTO(0x01d1, L01d1);
+    AOT_GOTO(0x01c4, L01c4);
+L01c4:
+    AOT_BLOCK(0x01c4, 5);
+    // 01c4: mov ax, 0109
+    {
+        r[0] = 0x0109;
+    }
+    // 01c7: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 01c8: mov ax, 0003
+    {
+        r[0] = 0x0003;
+    }
+    // 01cb: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 01cc: call 149e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x01cf);
+    }
+    AOT_GOTO(0x149e, L149e);
+L01cf:
+    AOT_BLOCK(0x01cf, 2);
+    // 01cf: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 01d0: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x01d1, L01d1);
+L01d1:
+    AOT_BLOCK(0x01d1, 2);
+    // 01d1: dec [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 01d4: jnle 01d9
+    if (!(ZF || SF != OF))
+        AOT_GOTO(0x01d9, L01d9);
+    AOT_GOTO(0x01d6, L01d6);
+L01d6:
+    AOT_BLOCK(0x01d6, 1);
+    // 01d6: jmp 0350
+    AOT_GOTO(0x0350, L0350);
+L01d9:
+    AOT_BLOCK(0x01d9, 7);
+    // 01d9: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 01dc: add [bp+6], 2
+    {
+        a = uint16_t(r[5] + 6);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+    }
+    // 01e0: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 01e2: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 01e4: mov bx, dx
+    {
+        r[3] = r[2];
+    }
+    // 01e6: cmp byte [bx], 2d
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 45);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 01e9: jne 01f1
+    if (!ZF)
+        AOT_GOTO(0x01f1, L01f1);
+    AOT_GOTO(0x01eb, L01eb);
+L01eb:
+    AOT_BLOCK(0x01eb, 2);
+    // 01eb: cmp byte [di+1], 0
+    {
+        a = uint16_t(r[7] + 1);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 01ef: jne 01fd
+    if (!ZF)
+        AOT_GOTO(0x01fd, L01fd);
+    AOT_GOTO(0x01f1, L01f1);
+L01f1:
+    AOT_BLOCK(0x01f1, 4);
+    // 01f1: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 01f2: mov ax, 12c2
+    {
+        r[0] = 0x12c2;
+    }
+    // 01f5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 01f6: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x01f9);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L01f9:
+    AOT_BLOCK(0x01f9, 3);
+    // 01f9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 01fa: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 01fb: jmp short 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L01fd:
+    AOT_BLOCK(0x01fd, 1);
+    // 01fd: mov ax, 0c54
+    {
+        r[0] = 0x0c54;
+    }
+    AOT_GOTO(0x0200, L0200);
+L0200:
+    AOT_BLOCK(0x0200, 3);
+    // 0200: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0201: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0202: call 1716
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0205);
+    }
+    AOT_GOTO(0x1716, L1716);
+L0205:
+    AOT_BLOCK(0x0205, 4);
+    // 0205: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0206: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0207: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0209: jne 0213
+    if (!ZF)
+        AOT_GOTO(0x0213, L0213);
+    AOT_GOTO(0x020b, L020b);
+L020b:
+    AOT_BLOCK(0x020b, 2);
+    // 020b: mov [0bce], 0000
+    {
+        a = 0x0bce;
+        WR16(a, 0x0000);
+    }
+    // 0211: jmp short 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L0213:
+    AOT_BLOCK(0x0213, 4);
+    // 0213: mov ax, 0c4e
+    {
+        r[0] = 0x0c4e;
+    }
+    // 0216: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0217: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0218: call 1716
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x021b);
+    }
+    AOT_GOTO(0x1716, L1716);
+L021b:
+    AOT_BLOCK(0x021b, 4);
+    // 021b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 021c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 021d: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 021f: je 0224
+    if (ZF)
+        AOT_GOTO(0x0224, L0224);
+    AOT_GOTO(0x0221, L0221);
+L0221:
+    AOT_BLOCK(0x0221, 1);
+    // 0221: jmp 0346
+    AOT_GOTO(0x0346, L0346);
+L0224:
+    AOT_BLOCK(0x0224, 2);
+    // 0224: mov [0bce], 0001
+    {
+        a = 0x0bce;
+        WR16(a, 0x0001);
+    }
+    // 022a: jmp short 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L022c:
+    AOT_BLOCK(0x022c, 3);
+    // 022c: mov [1240], 0c4c
+    {
+        a = 0x1240;
+        WR16(a, 0x0c4c);
+    }
+    // 0232: cmp byte [di+2], 2e
+    {
+        a = uint16_t(r[7] + 2);
+        val = (dst = int8_t(RD8(a))) - (src = 46);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0236: jne 01d1
+    if (!ZF)
+        AOT_GOTO(0x01d1, L01d1);
+    AOT_GOTO(0x0238, L0238);
+L0238:
+    AOT_BLOCK(0x0238, 3);
+    // 0238: lea bx, [di+3]
+    {
+        a = uint16_t(r[7] + 3);
+        r[3] = a;
+    }
+    // 023b: mov [1240], bx
+    {
+        a = 0x1240;
+        WR16(a, r[3]);
+    }
+    // 023f: jmp short 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L0241:
+    AOT_BLOCK(0x0241, 5);
+    // 0241: mov ax, 0c46
+    {
+        r[0] = 0x0c46;
+    }
+    // 0244: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0245: lea ax, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[0] = a;
+    }
+    // 0248: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0249: call 1716
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x024c);
+    }
+    AOT_GOTO(0x1716, L1716);
+L024c:
+    AOT_BLOCK(0x024c, 5);
+    // 024c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 024d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 024e: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+    }
+    // 0250: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0252: je 0255
+    if (ZF)
+        AOT_GOTO(0x0255, L0255);
+    AOT_GOTO(0x0254, L0254);
+L0254:
+    AOT_BLOCK(0x0254, 1);
+    // 0254: inc bx
+    {
+        val = int16_t(r[3]) + 1;
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x0255, L0255);
+L0255:
+    AOT_BLOCK(0x0255, 2);
+    // 0255: mov [0bca], bx
+    {
+        a = 0x0bca;
+        WR16(a, r[3]);
+    }
+    // 0259: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L025c:
+    AOT_BLOCK(0x025c, 5);
+    // 025c: lea ax, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[0] = a;
+    }
+    // 025f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0260: mov ax, 13f0
+    {
+        r[0] = 0x13f0;
+    }
+    // 0263: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0264: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0267);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0267:
+    AOT_BLOCK(0x0267, 1);
+    // 0267: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0268, L0268);
+L0268:
+    AOT_BLOCK(0x0268, 4);
+    // 0268: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0269: lea ax, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[0] = a;
+    }
+    // 026c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 026d: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0270);
+    }
+    AOT_GOTO(0x172e, L172e);
+L0270:
+    AOT_BLOCK(0x0270, 4);
+    // 0270: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0271: mov [bp-6], ax
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[0]);
+    }
+    // 0274: cmp [18f0], ax
+    {
+        a = 0x18f0;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0278: jl 027d
+    if (SF != OF)
+        AOT_GOTO(0x027d, L027d);
+    AOT_GOTO(0x027a, L027a);
+L027a:
+    AOT_BLOCK(0x027a, 1);
+    // 027a: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L027d:
+    AOT_BLOCK(0x027d, 2);
+    // 027d: mov [18f0], ax
+    {
+        WR16(0x18f0, r[0]);
+    }
+    // 0280: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L0283:
+    AOT_BLOCK(0x0283, 3);
+    // 0283: lea ax, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[0] = a;
+    }
+    // 0286: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0287: call 0039
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x028a);
+    }
+    AOT_GOTO(0x0039, L0039);
+L028a:
+    AOT_BLOCK(0x028a, 5);
+    // 028a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 028b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 028c: mov ax, 12c2
+    {
+        r[0] = 0x12c2;
+    }
+    // 028f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0290: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0293);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0293:
+    AOT_BLOCK(0x0293, 3);
+    // 0293: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0294: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0295: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L0298:
+    AOT_BLOCK(0x0298, 2);
+    // 0298: cmp byte [di+2], 0
+    {
+        a = uint16_t(r[7] + 2);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 029c: je 02a1
+    if (ZF)
+        AOT_GOTO(0x02a1, L02a1);
+    AOT_GOTO(0x029e, L029e);
+L029e:
+    AOT_BLOCK(0x029e, 1);
+    // 029e: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L02a1:
+    AOT_BLOCK(0x02a1, 4);
+    // 02a1: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 02a2: mov ax, 177a
+    {
+        r[0] = 0x177a;
+    }
+    // 02a5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 02a6: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x02a9);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L02a9:
+    AOT_BLOCK(0x02a9, 3);
+    // 02a9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 02aa: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 02ab: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L02ae:
+    AOT_BLOCK(0x02ae, 6);
+    // 02ae: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 02b1: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 02b3: dec cx
+    {
+        val = int16_t(r[1]) - 1;
+        r[1] = val;
+        AF = (val & 15) == 15;
+    }
+    // 02b4: mov [bp+4], cx
+    {
+        a = uint16_t(r[5] + 4);
+        WR16(a, r[1]);
+    }
+    // 02b7: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 02b9: jnl 02be
+    if (SF == OF)
+        AOT_GOTO(0x02be, L02be);
+    AOT_GOTO(0x02bb, L02bb);
+L02bb:
+    AOT_BLOCK(0x02bb, 1);
+    // 02bb: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L02be:
+    AOT_BLOCK(0x02be, 5);
+    // 02be: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 02c1: add [bp+6], 2
+    {
+        a = uint16_t(r[5] + 6);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 02c5: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 02c7: mov [0bb8], dx
+    {
+        a = 0x0bb8;
+        WR16(a, r[2]);
+    }
+    // 02cb: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L02ce:
+    AOT_BLOCK(0x02ce, 2);
+    // 02ce: mov [1240], 0c44
+    {
+        a = 0x1240;
+        WR16(a, 0x0c44);
+    }
+    // 02d4: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L02d7:
+    AOT_BLOCK(0x02d7, 3);
+    // 02d7: mov [0bcc], 0001
+    {
+        a = 0x0bcc;
+        WR16(a, 0x0001);
+    }
+    // 02dd: mov [1240], 0c42
+    {
+        a = 0x1240;
+        WR16(a, 0x0c42);
+    }
+    // 02e3: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L02e6:
+    AOT_BLOCK(0x02e6, 5);
+    // 02e6: mov [1240], 0c40
+    {
+        a = 0x1240;
+        WR16(a, 0x0c40);
+    }
+    // 02ec: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 02ed: mov ax, 177a
+    {
+        r[0] = 0x177a;
+    }
+    // 02f0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 02f1: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x02f4);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L02f4:
+    AOT_BLOCK(0x02f4, 3);
+    // 02f4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 02f5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 02f6: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L02f9:
+    AOT_BLOCK(0x02f9, 3);
+    // 02f9: inc [0bc4]
+    {
+        a = 0x0bc4;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 02fd: cmp byte [di+2], 6e
+    {
+        a = uint16_t(r[7] + 2);
+        val = (dst = int8_t(RD8(a))) - (src = 110);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0301: je 0306
+    if (ZF)
+        AOT_GOTO(0x0306, L0306);
+    AOT_GOTO(0x0303, L0303);
+L0303:
+    AOT_BLOCK(0x0303, 1);
+    // 0303: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L0306:
+    AOT_BLOCK(0x0306, 2);
+    // 0306: mov [0bc8], 0001
+    {
+        a = 0x0bc8;
+        WR16(a, 0x0001);
+    }
+    // 030c: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L030f:
+    AOT_BLOCK(0x030f, 2);
+    // 030f: inc [0bc6]
+    {
+        a = 0x0bc6;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0313: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L0316:
+    AOT_BLOCK(0x0316, 2);
+    // 0316: cmp byte [di+2], 6f
+    {
+        a = uint16_t(r[7] + 2);
+        val = (dst = int8_t(RD8(a))) - (src = 111);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 031a: je 031f
+    if (ZF)
+        AOT_GOTO(0x031f, L031f);
+    AOT_GOTO(0x031c, L031c);
+L031c:
+    AOT_BLOCK(0x031c, 1);
+    // 031c: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L031f:
+    AOT_BLOCK(0x031f, 3);
+    // 031f: mov bx, [18ea]
+    {
+        a = 0x18ea;
+        r[3] = RD16(a);
+    }
+    // 0323: mov [bx+2], 0000
+    {
+        a = uint16_t(r[3] + 2);
+        WR16(a, 0x0000);
+    }
+    // 0328: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L032b:
+    AOT_BLOCK(0x032b, 2);
+    // 032b: inc [0bce]
+    {
+        a = 0x0bce;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 032f: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L0332:
+    AOT_BLOCK(0x0332, 2);
+    // 0332: lea bx, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[3] = a;
+    }
+    // 0335: mov [0bd0], bx
+    {
+        a = 0x0bd0;
+        WR16(a, r[3]);
+    }
+    AOT_GOTO(0x0339, L0339);
+L0339:
+    AOT_BLOCK(0x0339, 4);
+    // 0339: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 033a: mov ax, 177a
+    {
+        r[0] = 0x177a;
+    }
+    // 033d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 033e: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0341);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0341:
+    AOT_BLOCK(0x0341, 3);
+    // 0341: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0342: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0343: jmp 01d1
+    AOT_GOTO(0x01d1, L01d1);
+L0346:
+    AOT_BLOCK(0x0346, 4);
+    // 0346: mov al, [di+1]
+    {
+        a = uint16_t(r[7] + 1);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0349: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 034a: mov bx, 0bf6
+    {
+        r[3] = 0x0bf6;
+    }
+    // 034d: jmp 1d09
+    AOT_GOTO(0x1d09, L1d09);
+L0350:
+    AOT_BLOCK(0x0350, 2);
+    // 0350: cmp [0bce], 0
+    {
+        a = 0x0bce;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0355: je 0364
+    if (ZF)
+        AOT_GOTO(0x0364, L0364);
+    AOT_GOTO(0x0357, L0357);
+L0357:
+    AOT_BLOCK(0x0357, 5);
+    // 0357: mov ax, 0c3c
+    {
+        r[0] = 0x0c3c;
+    }
+    // 035a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 035b: mov ax, 177a
+    {
+        r[0] = 0x177a;
+    }
+    // 035e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 035f: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0362);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0362:
+    AOT_BLOCK(0x0362, 2);
+    // 0362: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0363: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0364, L0364);
+L0364:
+    AOT_BLOCK(0x0364, 3);
+    // 0364: mov ax, 18a8
+    {
+        r[0] = 0x18a8;
+    }
+    // 0367: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0368: call 093b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x036b);
+    }
+    AOT_GOTO(0x093b, L093b);
+L036b:
+    AOT_BLOCK(0x036b, 4);
+    // 036b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 036c: mov dx, [12c2]
+    {
+        a = 0x12c2;
+        r[2] = RD16(a);
+    }
+    // 0370: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 0373: mov [bp-4], 12c4
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, 0x12c4);
+    }
+    AOT_GOTO(0x0378, L0378);
+L0378:
+    AOT_BLOCK(0x0378, 6);
+    // 0378: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 037b: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 037d: dec cx
+    {
+        val = int16_t(r[1]) - 1;
+        r[1] = val;
+        AF = (val & 15) == 15;
+    }
+    // 037e: mov [bp-6], cx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[1]);
+    }
+    // 0381: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0383: jle 03bd
+    if (ZF || SF != OF)
+        AOT_GOTO(0x03bd, L03bd);
+    AOT_GOTO(0x0385, L0385);
+L0385:
+    AOT_BLOCK(0x0385, 9);
+    // 0385: mov bx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[3] = RD16(a);
+    }
+    // 0388: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 038a: mov [bp-8], dx
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[2]);
+    }
+    // 038d: add [bp-4], 2
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0391: mov [18ee], dx
+    {
+        a = 0x18ee;
+        WR16(a, r[2]);
+    }
+    // 0395: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0398: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0399: push [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 039c: call 0cb5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x039f);
+    }
+    AOT_GOTO(0x0cb5, L0cb5);
+L039f:
+    AOT_BLOCK(0x039f, 5);
+    // 039f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03a0: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03a1: mov [bp-8], ax
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[0]);
+    }
+    // 03a4: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 03a6: je 0378
+    if (ZF)
+        AOT_GOTO(0x0378, L0378);
+    AOT_GOTO(0x03a8, L03a8);
+L03a8:
+    AOT_BLOCK(0x03a8, 2);
+    // 03a8: cmp [1240], 0
+    {
+        a = 0x1240;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 03ad: jne 0378
+    if (!ZF)
+        AOT_GOTO(0x0378, L0378);
+    AOT_GOTO(0x03af, L03af);
+L03af:
+    AOT_BLOCK(0x03af, 4);
+    // 03af: push [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 03b2: mov ax, 151e
+    {
+        r[0] = 0x151e;
+    }
+    // 03b5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03b6: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03b9);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L03b9:
+    AOT_BLOCK(0x03b9, 3);
+    // 03b9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03ba: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03bb: jmp short 0378
+    AOT_GOTO(0x0378, L0378);
+L03bd:
+    AOT_BLOCK(0x03bd, 3);
+    // 03bd: mov ax, 12c2
+    {
+        r[0] = 0x12c2;
+    }
+    // 03c0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03c1: call 105f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03c4);
+    }
+    AOT_GOTO(0x105f, L105f);
+L03c4:
+    AOT_BLOCK(0x03c4, 3);
+    // 03c4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03c5: cmp [0bc2], 0
+    {
+        a = 0x0bc2;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 03ca: je 03cf
+    if (ZF)
+        AOT_GOTO(0x03cf, L03cf);
+    AOT_GOTO(0x03cc, L03cc);
+L03cc:
+    AOT_BLOCK(0x03cc, 1);
+    // 03cc: jmp 0465
+    AOT_GOTO(0x0465, L0465);
+L03cf:
+    AOT_BLOCK(0x03cf, 2);
+    // 03cf: cmp [151e], 0
+    {
+        a = 0x151e;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 03d4: jnle 03d9
+    if (!(ZF || SF != OF))
+        AOT_GOTO(0x03d9, L03d9);
+    AOT_GOTO(0x03d6, L03d6);
+L03d6:
+    AOT_BLOCK(0x03d6, 1);
+    // 03d6: jmp 0465
+    AOT_GOTO(0x0465, L0465);
+L03d9:
+    AOT_BLOCK(0x03d9, 1);
+    // 03d9: mov si, 0004
+    {
+        r[6] = 0x0004;
+    }
+    AOT_GOTO(0x03dc, L03dc);
+L03dc:
+    AOT_BLOCK(0x03dc, 2);
+    // 03dc: test byte [si+a], 4
+    {
+        a = uint16_t(r[6] + 10);
+        val = int8_t(RD8(a)) & 4;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 03e0: jne 03e7
+    if (!ZF)
+        AOT_GOTO(0x03e7, L03e7);
+    AOT_GOTO(0x03e2, L03e2);
+L03e2:
+    AOT_BLOCK(0x03e2, 2);
+    // 03e2: add si, c
+    {
+        val = (dst = int16_t(r[6])) + (src = 12);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 03e5: jmp short 03dc
+    AOT_GOTO(0x03dc, L03dc);
+L03e7:
+    AOT_BLOCK(0x03e7, 8);
+    // 03e7: mov ax, 0c3a
+    {
+        r[0] = 0x0c3a;
+    }
+    // 03ea: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03eb: push [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 03ee: mov ax, 18a8
+    {
+        r[0] = 0x18a8;
+    }
+    // 03f1: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03f2: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 03f5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03f6: call 0563
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03f9);
+    }
+    AOT_GOTO(0x0563, L0563);
+L03f9:
+    AOT_BLOCK(0x03f9, 5);
+    // 03f9: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 03fc: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 03fd: push [18ea]
+    {
+        a = 0x18ea;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0401: cmp [si+c], 0
+    {
+        a = uint16_t(r[6] + 12);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0405: jne 040c
+    if (!ZF)
+        AOT_GOTO(0x040c, L040c);
+    AOT_GOTO(0x0407, L0407);
+L0407:
+    AOT_BLOCK(0x0407, 2);
+    // 0407: mov ax, [0bb8]
+    {
+        r[0] = RD16(0x0bb8);
+    }
+    // 040a: jmp short 040f
+    AOT_GOTO(0x040f, L040f);
+L040c:
+    AOT_BLOCK(0x040c, 1);
+    // 040c: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    AOT_GOTO(0x040f, L040f);
+L040f:
+    AOT_BLOCK(0x040f, 4);
+    // 040f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0410: mov ax, 151e
+    {
+        r[0] = 0x151e;
+    }
+    // 0413: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0414: call 0ef5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0417);
+    }
+    AOT_GOTO(0x0ef5, L0ef5);
+L0417:
+    AOT_BLOCK(0x0417, 3);
+    // 0417: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 041a: cmp [0bc2], 0
+    {
+        a = 0x0bc2;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 041f: jne 0465
+    if (!ZF)
+        AOT_GOTO(0x0465, L0465);
+    AOT_GOTO(0x0421, L0421);
+L0421:
+    AOT_BLOCK(0x0421, 2);
+    // 0421: mov dx, [164c]
+    {
+        a = 0x164c;
+        r[2] = RD16(a);
+    }
+    // 0425: mov [bp-c], dx
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x0428, L0428);
+L0428:
+    AOT_BLOCK(0x0428, 6);
+    // 0428: mov dx, [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        r[2] = RD16(a);
+    }
+    // 042b: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 042d: dec cx
+    {
+        val = int16_t(r[1]) - 1;
+        r[1] = val;
+        AF = (val & 15) == 15;
+    }
+    // 042e: mov [bp-c], cx
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, r[1]);
+    }
+    // 0431: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0433: jle 0451
+    if (ZF || SF != OF)
+        AOT_GOTO(0x0451, L0451);
+    AOT_GOTO(0x0435, L0435);
+L0435:
+    AOT_BLOCK(0x0435, 4);
+    // 0435: mov bx, [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        r[3] = RD16(a);
+    }
+    // 0438: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 043a: push [bx+164e]
+    {
+        a = uint16_t(r[3] + 5710);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 043e: call 0470
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0441);
+    }
+    AOT_GOTO(0x0470, L0470);
+L0441:
+    AOT_BLOCK(0x0441, 5);
+    // 0441: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0442: mov bx, [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        r[3] = RD16(a);
+    }
+    // 0445: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0447: push [bx+164e]
+    {
+        a = uint16_t(r[3] + 5710);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 044b: call 1428
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x044e);
+    }
+    AOT_GOTO(0x1428, L1428);
+L044e:
+    AOT_BLOCK(0x044e, 2);
+    // 044e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 044f: jmp short 0428
+    AOT_GOTO(0x0428, L0428);
+L0451:
+    AOT_BLOCK(0x0451, 3);
+    // 0451: add si, c
+    {
+        val = (dst = int16_t(r[6])) + (src = 12);
+        r[6] = val;
+    }
+    // 0454: cmp [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0457: je 0465
+    if (ZF)
+        AOT_GOTO(0x0465, L0465);
+    AOT_GOTO(0x0459, L0459);
+L0459:
+    AOT_BLOCK(0x0459, 5);
+    // 0459: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 045b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 045c: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 045f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0460: call 0cb5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0463);
+    }
+    AOT_GOTO(0x0cb5, L0cb5);
+L0463:
+    AOT_BLOCK(0x0463, 2);
+    // 0463: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0464: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0465, L0465);
+L0465:
+    AOT_BLOCK(0x0465, 2);
+    // 0465: push [0bc2]
+    {
+        a = 0x0bc2;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0469: call 11df
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x046c);
+    }
+    AOT_GOTO(0x11df, L11df);
+L046c:
+    AOT_BLOCK(0x046c, 2);
+    // 046c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 046d: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L0470:
+    AOT_BLOCK(0x0470, 4);
+    // 0470: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0471: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0473: cmp [0bc6], 0
+    {
+        a = 0x0bc6;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0478: jne 04a6
+    if (!ZF)
+        AOT_GOTO(0x04a6, L04a6);
+    AOT_GOTO(0x047a, L047a);
+L047a:
+    AOT_BLOCK(0x047a, 2);
+    // 047a: cmp [0bc4], 0
+    {
+        a = 0x0bc4;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 047f: je 0498
+    if (ZF)
+        AOT_GOTO(0x0498, L0498);
+    AOT_GOTO(0x0481, L0481);
+L0481:
+    AOT_BLOCK(0x0481, 3);
+    // 0481: mov ax, 0c66
+    {
+        r[0] = 0x0c66;
+    }
+    // 0484: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0485: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0488);
+    }
+    AOT_GOTO(0x082f, L082f);
+L0488:
+    AOT_BLOCK(0x0488, 3);
+    // 0488: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0489: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 048c: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x048f);
+    }
+    AOT_GOTO(0x082f, L082f);
+L048f:
+    AOT_BLOCK(0x048f, 4);
+    // 048f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0490: mov ax, 0c64
+    {
+        r[0] = 0x0c64;
+    }
+    // 0493: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0494: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0497);
+    }
+    AOT_GOTO(0x082f, L082f);
+L0497:
+    AOT_BLOCK(0x0497, 1);
+    // 0497: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0498, L0498);
+L0498:
+    AOT_BLOCK(0x0498, 2);
+    // 0498: cmp [0bc8], 0
+    {
+        a = 0x0bc8;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 049d: jne 04a6
+    if (!ZF)
+        AOT_GOTO(0x04a6, L04a6);
+    AOT_GOTO(0x049f, L049f);
+L049f:
+    AOT_BLOCK(0x049f, 2);
+    // 049f: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 04a2: call 16d1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04a5);
+    }
+    AOT_GOTO(0x16d1, L16d1);
+L04a5:
+    AOT_BLOCK(0x04a5, 1);
+    // 04a5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x04a6, L04a6);
+L04a6:
+    AOT_BLOCK(0x04a6, 1);
+    // 04a6: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L04a9:
+    AOT_BLOCK(0x04a9, 5);
+    // 04a9: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 04aa: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 04ac: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 04ad: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 04b0: call 1259
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04b3);
+    }
+    AOT_GOTO(0x1259, L1259);
+L04b3:
+    AOT_BLOCK(0x04b3, 4);
+    // 04b3: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 04b4: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 04b6: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 04b8: jne 04c2
+    if (!ZF)
+        AOT_GOTO(0x04c2, L04c2);
+    AOT_GOTO(0x04ba, L04ba);
+L04ba:
+    AOT_BLOCK(0x04ba, 3);
+    // 04ba: mov ax, 0c6a
+    {
+        r[0] = 0x0c6a;
+    }
+    // 04bd: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 04be: call 0853
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04c1);
+    }
+    AOT_GOTO(0x0853, L0853);
+L04c1:
+    AOT_BLOCK(0x04c1, 1);
+    // 04c1: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x04c2, L04c2);
+L04c2:
+    AOT_BLOCK(0x04c2, 2);
+    // 04c2: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 04c4: jmp 1d33
+    AOT_GOTO(0x1d33, L1d33);
+L04c7:
+    AOT_BLOCK(0x04c7, 7);
+    // 04c7: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 04c8: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 04ca: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 04cb: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 04cc: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 04cf: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 04d2: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04d5);
+    }
+    AOT_GOTO(0x172e, L172e);
+L04d5:
+    AOT_BLOCK(0x04d5, 4);
+    // 04d5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 04d6: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 04d7: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 04d8: call 04a9
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04db);
+    }
+    AOT_GOTO(0x04a9, L04a9);
+L04db:
+    AOT_BLOCK(0x04db, 5);
+    // 04db: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 04dc: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 04de: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 04e1: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 04e2: call 171c
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04e5);
+    }
+    AOT_GOTO(0x171c, L171c);
+L04e5:
+    AOT_BLOCK(0x04e5, 4);
+    // 04e5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 04e6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 04e7: cmp [di], 0096
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) - (src = 150);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 04eb: jl 04f5
+    if (SF != OF)
+        AOT_GOTO(0x04f5, L04f5);
+    AOT_GOTO(0x04ed, L04ed);
+L04ed:
+    AOT_BLOCK(0x04ed, 3);
+    // 04ed: mov ax, 0c74
+    {
+        r[0] = 0x0c74;
+    }
+    // 04f0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 04f1: call 0853
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04f4);
+    }
+    AOT_GOTO(0x0853, L0853);
+L04f4:
+    AOT_BLOCK(0x04f4, 1);
+    // 04f4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x04f5, L04f5);
+L04f5:
+    AOT_BLOCK(0x04f5, 7);
+    // 04f5: mov ax, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = RD16(a);
+    }
+    // 04f7: inc [di]
+    {
+        a = uint16_t(r[7]);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 04f9: lea bx, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[3] = a;
+    }
+    // 04fc: shl ax, 1
+    {
+        val = r[0] << 1;
+        r[0] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 04fe: add bx, ax
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[0]));
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0500: mov [bx], si
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[6]);
+    }
+    // 0502: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L0505:
+    AOT_BLOCK(0x0505, 26);
+    // 0505: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0506: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0508: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0509: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 050a: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 050b: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 050e: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 0510: mov [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[2]);
+    }
+    // 0513: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 0516: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+    }
+    // 0519: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 051a: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 051d: mov bx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[3] = RD16(a);
+    }
+    // 051f: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 0520: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0522: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+    }
+    // 0524: mov di, bx
+    {
+        r[7] = r[3];
+    }
+    // 0526: mov si, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[6] = RD16(a);
+    }
+    // 0529: add si, 2
+    {
+        val = (dst = int16_t(r[6])) + (src = 2);
+        r[6] = val;
+    }
+    // 052c: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 052f: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 0531: add dx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 0534: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 0537: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 0539: cmp dx, 0096
+    {
+        val = (dst = int16_t(r[2])) - (src = 150);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 053d: jl 0547
+    if (SF != OF)
+        AOT_GOTO(0x0547, L0547);
+    AOT_GOTO(0x053f, L053f);
+L053f:
+    AOT_BLOCK(0x053f, 3);
+    // 053f: mov ax, 0c8c
+    {
+        r[0] = 0x0c8c;
+    }
+    // 0542: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0543: call 0853
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0546);
+    }
+    AOT_GOTO(0x0853, L0853);
+L0546:
+    AOT_BLOCK(0x0546, 1);
+    // 0546: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0547, L0547);
+L0547:
+    AOT_BLOCK(0x0547, 6);
+    // 0547: mov dx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[2] = RD16(a);
+    }
+    // 054a: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 054c: dec cx
+    {
+        val = int16_t(r[1]) - 1;
+        r[1] = val;
+        AF = (val & 15) == 15;
+    }
+    // 054d: mov [bp-2], cx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[1]);
+    }
+    // 0550: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0552: jle 0560
+    if (ZF || SF != OF)
+        AOT_GOTO(0x0560, L0560);
+    AOT_GOTO(0x0554, L0554);
+L0554:
+    AOT_BLOCK(0x0554, 5);
+    // 0554: mov ax, [si]
+    {
+        a = uint16_t(r[6]);
+        r[0] = RD16(a);
+    }
+    // 0556: add si, 2
+    {
+        val = (dst = int16_t(r[6])) + (src = 2);
+        r[6] = val;
+    }
+    // 0559: mov [di], ax
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[0]);
+    }
+    // 055b: add di, 2
+    {
+        val = (dst = int16_t(r[7])) + (src = 2);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 055e: jmp short 0547
+    AOT_GOTO(0x0547, L0547);
+L0560:
+    AOT_BLOCK(0x0560, 1);
+    // 0560: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L0563:
+    AOT_BLOCK(0x0563, 6);
+    // 0563: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0564: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0566: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0567: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0568: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 056b: mov di, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[7] = RD16(a);
+    }
+    AOT_GOTO(0x056e, L056e);
+L056e:
+    AOT_BLOCK(0x056e, 7);
+    // 056e: mov al, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0570: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+    }
+    // 0571: mov [si], al
+    {
+        a = uint16_t(r[6]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 0573: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        AF = !(val & 15);
+    }
+    // 0574: xor ah, ah
+    {
+        val = int8_t(r[0] >> 8) ^ int8_t(r[0] >> 8);
+        r[0] = (r[0] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0576: or al, al
+    {
+        val = int8_t(r[0]) | int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0578: jne 056e
+    if (!ZF)
+        AOT_GOTO(0x056e, L056e);
+    AOT_GOTO(0x057a, L057a);
+L057a:
+    AOT_BLOCK(0x057a, 2);
+    // 057a: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 057b: mov di, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[7] = RD16(a);
+    }
+    AOT_GOTO(0x057e, L057e);
+L057e:
+    AOT_BLOCK(0x057e, 7);
+    // 057e: mov al, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0580: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+    }
+    // 0581: mov [si], al
+    {
+        a = uint16_t(r[6]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 0583: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        AF = !(val & 15);
+    }
+    // 0584: xor ah, ah
+    {
+        val = int8_t(r[0] >> 8) ^ int8_t(r[0] >> 8);
+        r[0] = (r[0] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0586: or al, al
+    {
+        val = int8_t(r[0]) | int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0588: jne 057e
+    if (!ZF)
+        AOT_GOTO(0x057e, L057e);
+    AOT_GOTO(0x058a, L058a);
+L058a:
+    AOT_BLOCK(0x058a, 2);
+    // 058a: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 058b: mov di, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[7] = RD16(a);
+    }
+    AOT_GOTO(0x058e, L058e);
+L058e:
+    AOT_BLOCK(0x058e, 7);
+    // 058e: mov al, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0590: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+    }
+    // 0591: mov [si], al
+    {
+        a = uint16_t(r[6]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 0593: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        AF = !(val & 15);
+    }
+    // 0594: xor ah, ah
+    {
+        val = int8_t(r[0] >> 8) ^ int8_t(r[0] >> 8);
+        r[0] = (r[0] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0596: or al, al
+    {
+        val = int8_t(r[0]) | int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0598: jne 058e
+    if (!ZF)
+        AOT_GOTO(0x058e, L058e);
+    AOT_GOTO(0x059a, L059a);
+L059a:
+    AOT_BLOCK(0x059a, 3);
+    // 059a: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 059b: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 059e: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L05a1:
+    AOT_BLOCK(0x05a1, 6);
+    // 05a1: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 05a2: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 05a4: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 05a5: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 05a6: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 05a9: mov di, si
+    {
+        r[7] = r[6];
+    }
+    AOT_GOTO(0x05ab, L05ab);
+L05ab:
+    AOT_BLOCK(0x05ab, 2);
+    // 05ab: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 05ae: je 05bb
+    if (ZF)
+        AOT_GOTO(0x05bb, L05bb);
+    AOT_GOTO(0x05b0, L05b0);
+L05b0:
+    AOT_BLOCK(0x05b0, 4);
+    // 05b0: mov al, [si]
+    {
+        a = uint16_t(r[6]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 05b2: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 05b3: cmp al, 2f
+    {
+        val = (dst = int8_t(r[0])) - (src = 47);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 05b5: jne 05ab
+    if (!ZF)
+        AOT_GOTO(0x05ab, L05ab);
+    AOT_GOTO(0x05b7, L05b7);
+L05b7:
+    AOT_BLOCK(0x05b7, 2);
+    // 05b7: mov di, si
+    {
+        r[7] = r[6];
+    }
+    // 05b9: jmp short 05ab
+    AOT_GOTO(0x05ab, L05ab);
+L05bb:
+    AOT_BLOCK(0x05bb, 1);
+    // 05bb: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x05bc, L05bc);
+L05bc:
+    AOT_BLOCK(0x05bc, 2);
+    // 05bc: cmp byte [si], 2e
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 46);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 05bf: je 05c8
+    if (ZF)
+        AOT_GOTO(0x05c8, L05c8);
+    AOT_GOTO(0x05c1, L05c1);
+L05c1:
+    AOT_BLOCK(0x05c1, 2);
+    // 05c1: cmp si, di
+    {
+        val = (dst = int16_t(r[6])) - (src = int16_t(r[7]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 05c3: jbe 05c8
+    if (CF || ZF)
+        AOT_GOTO(0x05c8, L05c8);
+    AOT_GOTO(0x05c5, L05c5);
+L05c5:
+    AOT_BLOCK(0x05c5, 2);
+    // 05c5: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 05c6: jmp short 05bc
+    AOT_GOTO(0x05bc, L05bc);
+L05c8:
+    AOT_BLOCK(0x05c8, 2);
+    // 05c8: cmp byte [si], 2e
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 46);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 05cb: jne 05e6
+    if (!ZF)
+        AOT_GOTO(0x05e6, L05e6);
+    AOT_GOTO(0x05cd, L05cd);
+L05cd:
+    AOT_BLOCK(0x05cd, 1);
+    // 05cd: mov byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 0);
+    }
+    AOT_GOTO(0x05d0, L05d0);
+L05d0:
+    AOT_BLOCK(0x05d0, 8);
+    // 05d0: mov al, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 05d2: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+    }
+    // 05d3: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 05d6: mov [bx], al
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 05d8: inc [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        AF = !(val & 15);
+    }
+    // 05db: xor ah, ah
+    {
+        val = int8_t(r[0] >> 8) ^ int8_t(r[0] >> 8);
+        r[0] = (r[0] & 0xff) | uint8_t(val) << 8;
+    }
+    // 05dd: or al, al
+    {
+        val = int8_t(r[0]) | int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 05df: jne 05d0
+    if (!ZF)
+        AOT_GOTO(0x05d0, L05d0);
+    AOT_GOTO(0x05e1, L05e1);
+L05e1:
+    AOT_BLOCK(0x05e1, 2);
+    // 05e1: mov byte [si], 2e
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 46);
+    }
+    // 05e4: jmp short 05f7
+    AOT_GOTO(0x05f7, L05f7);
+L05e6:
+    AOT_BLOCK(0x05e6, 8);
+    // 05e6: mov al, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 05e8: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+    }
+    // 05e9: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 05ec: mov [bx], al
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 05ee: inc [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        AF = !(val & 15);
+    }
+    // 05f1: xor ah, ah
+    {
+        val = int8_t(r[0] >> 8) ^ int8_t(r[0] >> 8);
+        r[0] = (r[0] & 0xff) | uint8_t(val) << 8;
+    }
+    // 05f3: or al, al
+    {
+        val = int8_t(r[0]) | int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 05f5: jne 05e6
+    if (!ZF)
+        AOT_GOTO(0x05e6, L05e6);
+    AOT_GOTO(0x05f7, L05f7);
+L05f7:
+    AOT_BLOCK(0x05f7, 1);
+    // 05f7: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L05fa:
+    AOT_BLOCK(0x05fa, 4);
+    // 05fa: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 05fb: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 05fd: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 05fe: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x0601, L0601);
+L0601:
+    AOT_BLOCK(0x0601, 2);
+    // 0601: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0604: je 0609
+    if (ZF)
+        AOT_GOTO(0x0609, L0609);
+    AOT_GOTO(0x0606, L0606);
+L0606:
+    AOT_BLOCK(0x0606, 2);
+    // 0606: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0607: jmp short 0601
+    AOT_GOTO(0x0601, L0601);
+L0609:
+    AOT_BLOCK(0x0609, 2);
+    // 0609: cmp [bp+4], si
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 060c: jnb 0616
+    if (!CF)
+        AOT_GOTO(0x0616, L0616);
+    AOT_GOTO(0x060e, L060e);
+L060e:
+    AOT_BLOCK(0x060e, 2);
+    // 060e: cmp byte [si], 2e
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 46);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0611: je 0616
+    if (ZF)
+        AOT_GOTO(0x0616, L0616);
+    AOT_GOTO(0x0613, L0613);
+L0613:
+    AOT_BLOCK(0x0613, 2);
+    // 0613: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 0614: jmp short 0609
+    AOT_GOTO(0x0609, L0609);
+L0616:
+    AOT_BLOCK(0x0616, 2);
+    // 0616: cmp [bp+4], si
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0619: je 0620
+    if (ZF)
+        AOT_GOTO(0x0620, L0620);
+    AOT_GOTO(0x061b, L061b);
+L061b:
+    AOT_BLOCK(0x061b, 2);
+    // 061b: lea ax, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[0] = a;
+    }
+    // 061e: jmp short 0622
+    AOT_GOTO(0x0622, L0622);
+L0620:
+    AOT_BLOCK(0x0620, 1);
+    // 0620: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0622, L0622);
+L0622:
+    AOT_BLOCK(0x0622, 1);
+    // 0622: jmp 1d33
+    AOT_GOTO(0x1d33, L1d33);
+L0625:
+    AOT_BLOCK(0x0625, 13);
+    // 0625: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0626: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0628: sub sp, 6
+    {
+        val = (dst = int16_t(r[4])) - (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 062b: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 062c: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 062d: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 0630: mov [bp-6], 0000
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, 0x0000);
+    }
+    // 0635: mov ax, 0005
+    {
+        r[0] = 0x0005;
+    }
+    // 0638: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0639: mov ax, 0d26
+    {
+        r[0] = 0x0d26;
+    }
+    // 063c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 063d: push [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0640: call 1734
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0643);
+    }
+    AOT_GOTO(0x1734, L1734);
+L0643:
+    AOT_BLOCK(0x0643, 3);
+    // 0643: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0646: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0648: jne 066f
+    if (!ZF)
+        AOT_GOTO(0x066f, L066f);
+    AOT_GOTO(0x064a, L064a);
+L064a:
+    AOT_BLOCK(0x064a, 6);
+    // 064a: mov bx, [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        r[3] = RD16(a);
+    }
+    // 064d: mov ax, 0004
+    {
+        r[0] = 0x0004;
+    }
+    // 0650: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0651: add bx, 4
+    {
+        val = (dst = int16_t(r[3])) + (src = 4);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0654: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 0655: call 16ad
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0658);
+    }
+    AOT_GOTO(0x16ad, L16ad);
+L0658:
+    AOT_BLOCK(0x0658, 4);
+    // 0658: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0659: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 065a: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 065c: jne 066f
+    if (!ZF)
+        AOT_GOTO(0x066f, L066f);
+    AOT_GOTO(0x065e, L065e);
+L065e:
+    AOT_BLOCK(0x065e, 6);
+    // 065e: lea bx, [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        r[3] = a;
+    }
+    // 0661: mov si, bx
+    {
+        r[6] = r[3];
+    }
+    // 0663: mov bx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[3] = RD16(a);
+    }
+    // 0665: add bx, 4
+    {
+        val = (dst = int16_t(r[3])) + (src = 4);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0668: mov [si], bx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[3]);
+    }
+    // 066a: mov [bp-6], 0001
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, 0x0001);
+    }
+    AOT_GOTO(0x066f, L066f);
+L066f:
+    AOT_BLOCK(0x066f, 2);
+    // 066f: cmp [0bc4], 0
+    {
+        a = 0x0bc4;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0674: je 06ba
+    if (ZF)
+        AOT_GOTO(0x06ba, L06ba);
+    AOT_GOTO(0x0676, L0676);
+L0676:
+    AOT_BLOCK(0x0676, 2);
+    // 0676: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0677: call 0868
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x067a);
+    }
+    AOT_GOTO(0x0868, L0868);
+L067a:
+    AOT_BLOCK(0x067a, 4);
+    // 067a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 067b: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 067e: test byte [bx+a], 8
+    {
+        a = uint16_t(r[3] + 10);
+        val = int8_t(RD8(a)) & 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0682: je 0693
+    if (ZF)
+        AOT_GOTO(0x0693, L0693);
+    AOT_GOTO(0x0684, L0684);
+L0684:
+    AOT_BLOCK(0x0684, 3);
+    // 0684: mov ax, 0d22
+    {
+        r[0] = 0x0d22;
+    }
+    // 0687: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0688: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x068b);
+    }
+    AOT_GOTO(0x082f, L082f);
+L068b:
+    AOT_BLOCK(0x068b, 3);
+    // 068b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 068c: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 068f: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0692);
+    }
+    AOT_GOTO(0x082f, L082f);
+L0692:
+    AOT_BLOCK(0x0692, 1);
+    // 0692: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0693, L0693);
+L0693:
+    AOT_BLOCK(0x0693, 3);
+    // 0693: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 0696: test byte [bx+a], 10
+    {
+        a = uint16_t(r[3] + 10);
+        val = int8_t(RD8(a)) & 16;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 069a: je 06b2
+    if (ZF)
+        AOT_GOTO(0x06b2, L06b2);
+    AOT_GOTO(0x069c, L069c);
+L069c:
+    AOT_BLOCK(0x069c, 2);
+    // 069c: cmp [0bcc], 0
+    {
+        a = 0x0bcc;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 06a1: jne 06b2
+    if (!ZF)
+        AOT_GOTO(0x06b2, L06b2);
+    AOT_GOTO(0x06a3, L06a3);
+L06a3:
+    AOT_BLOCK(0x06a3, 3);
+    // 06a3: mov ax, 0d1e
+    {
+        r[0] = 0x0d1e;
+    }
+    // 06a6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 06a7: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06aa);
+    }
+    AOT_GOTO(0x082f, L082f);
+L06aa:
+    AOT_BLOCK(0x06aa, 3);
+    // 06aa: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 06ab: push [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 06ae: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06b1);
+    }
+    AOT_GOTO(0x082f, L082f);
+L06b1:
+    AOT_BLOCK(0x06b1, 1);
+    // 06b1: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x06b2, L06b2);
+L06b2:
+    AOT_BLOCK(0x06b2, 3);
+    // 06b2: mov ax, 0d1c
+    {
+        r[0] = 0x0d1c;
+    }
+    // 06b5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 06b6: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06b9);
+    }
+    AOT_GOTO(0x082f, L082f);
+L06b9:
+    AOT_BLOCK(0x06b9, 1);
+    // 06b9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x06ba, L06ba);
+L06ba:
+    AOT_BLOCK(0x06ba, 2);
+    // 06ba: cmp [0bc8], 0
+    {
+        a = 0x0bc8;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 06bf: je 06de
+    if (ZF)
+        AOT_GOTO(0x06de, L06de);
+    AOT_GOTO(0x06c1, L06c1);
+L06c1:
+    AOT_BLOCK(0x06c1, 2);
+    // 06c1: cmp [bp-6], 0
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 06c5: je 06d3
+    if (ZF)
+        AOT_GOTO(0x06d3, L06d3);
+    AOT_GOTO(0x06c7, L06c7);
+L06c7:
+    AOT_BLOCK(0x06c7, 5);
+    // 06c7: lea bx, [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        r[3] = a;
+    }
+    // 06ca: mov si, bx
+    {
+        r[6] = r[3];
+    }
+    // 06cc: mov bx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[3] = RD16(a);
+    }
+    // 06ce: add bx, -4
+    {
+        val = (dst = int16_t(r[3])) + (src = -4);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 06d1: mov [si], bx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[3]);
+    }
+    AOT_GOTO(0x06d3, L06d3);
+L06d3:
+    AOT_BLOCK(0x06d3, 2);
+    // 06d3: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 06d4: call 105f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06d7);
+    }
+    AOT_GOTO(0x105f, L105f);
+L06d7:
+    AOT_BLOCK(0x06d7, 3);
+    // 06d7: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 06d8: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 06db: jmp 07ee
+    AOT_GOTO(0x07ee, L07ee);
+L06de:
+    AOT_BLOCK(0x06de, 1);
+    // 06de: call 16bd
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06e1);
+    }
+    AOT_GOTO(0x16bd, L16bd);
+L06e1:
+    AOT_BLOCK(0x06e1, 3);
+    // 06e1: mov [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[0]);
+    }
+    // 06e4: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 06e6: jne 0755
+    if (!ZF)
+        AOT_GOTO(0x0755, L0755);
+    AOT_GOTO(0x06e8, L06e8);
+L06e8:
+    AOT_BLOCK(0x06e8, 3);
+    // 06e8: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 06eb: test byte [bx+a], 8
+    {
+        a = uint16_t(r[3] + 10);
+        val = int8_t(RD8(a)) & 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 06ef: je 071f
+    if (ZF)
+        AOT_GOTO(0x071f, L071f);
+    AOT_GOTO(0x06f1, L06f1);
+L06f1:
+    AOT_BLOCK(0x06f1, 4);
+    // 06f1: mov ax, 0d1a
+    {
+        r[0] = 0x0d1a;
+    }
+    // 06f4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 06f5: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 06f8: call 1716
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06fb);
+    }
+    AOT_GOTO(0x1716, L1716);
+L06fb:
+    AOT_BLOCK(0x06fb, 4);
+    // 06fb: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 06fc: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 06fd: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 06ff: je 071f
+    if (ZF)
+        AOT_GOTO(0x071f, L071f);
+    AOT_GOTO(0x0701, L0701);
+L0701:
+    AOT_BLOCK(0x0701, 3);
+    // 0701: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0703: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0704: call 16b1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0707);
+    }
+    AOT_GOTO(0x16b1, L16b1);
+L0707:
+    AOT_BLOCK(0x0707, 5);
+    // 0707: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0708: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 070a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 070b: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 070e: call 16c9
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0711);
+    }
+    AOT_GOTO(0x16c9, L16c9);
+L0711:
+    AOT_BLOCK(0x0711, 4);
+    // 0711: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0712: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0713: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0715: je 071f
+    if (ZF)
+        AOT_GOTO(0x071f, L071f);
+    AOT_GOTO(0x0717, L0717);
+L0717:
+    AOT_BLOCK(0x0717, 3);
+    // 0717: mov ax, 0d02
+    {
+        r[0] = 0x0d02;
+    }
+    // 071a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 071b: call 0853
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x071e);
+    }
+    AOT_GOTO(0x0853, L0853);
+L071e:
+    AOT_BLOCK(0x071e, 1);
+    // 071e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x071f, L071f);
+L071f:
+    AOT_BLOCK(0x071f, 3);
+    // 071f: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 0722: test byte [bx+a], 10
+    {
+        a = uint16_t(r[3] + 10);
+        val = int8_t(RD8(a)) & 16;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0726: je 0750
+    if (ZF)
+        AOT_GOTO(0x0750, L0750);
+    AOT_GOTO(0x0728, L0728);
+L0728:
+    AOT_BLOCK(0x0728, 2);
+    // 0728: cmp [0bcc], 0
+    {
+        a = 0x0bcc;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 072d: jne 0750
+    if (!ZF)
+        AOT_GOTO(0x0750, L0750);
+    AOT_GOTO(0x072f, L072f);
+L072f:
+    AOT_BLOCK(0x072f, 3);
+    // 072f: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0732: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0733: call 16b1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0736);
+    }
+    AOT_GOTO(0x16b1, L16b1);
+L0736:
+    AOT_BLOCK(0x0736, 5);
+    // 0736: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0737: mov ax, 01b6
+    {
+        r[0] = 0x01b6;
+    }
+    // 073a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 073b: push [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 073e: call 16b5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0741);
+    }
+    AOT_GOTO(0x16b5, L16b5);
+L0741:
+    AOT_BLOCK(0x0741, 4);
+    // 0741: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0742: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0743: cmp ax, 0001
+    {
+        val = (dst = int16_t(r[0])) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0746: je 0750
+    if (ZF)
+        AOT_GOTO(0x0750, L0750);
+    AOT_GOTO(0x0748, L0748);
+L0748:
+    AOT_BLOCK(0x0748, 3);
+    // 0748: mov ax, 0ce6
+    {
+        r[0] = 0x0ce6;
+    }
+    // 074b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 074c: call 0853
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x074f);
+    }
+    AOT_GOTO(0x0853, L0853);
+L074f:
+    AOT_BLOCK(0x074f, 1);
+    // 074f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0750, L0750);
+L0750:
+    AOT_BLOCK(0x0750, 2);
+    // 0750: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0751: call 08b7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0754);
+    }
+    AOT_GOTO(0x08b7, L08b7);
+L0754:
+    AOT_BLOCK(0x0754, 1);
+    // 0754: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0755, L0755);
+L0755:
+    AOT_BLOCK(0x0755, 2);
+    // 0755: cmp [bp-2], -1
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0759: jne 0763
+    if (!ZF)
+        AOT_GOTO(0x0763, L0763);
+    AOT_GOTO(0x075b, L075b);
+L075b:
+    AOT_BLOCK(0x075b, 3);
+    // 075b: mov ax, 0cd2
+    {
+        r[0] = 0x0cd2;
+    }
+    // 075e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 075f: call 0853
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0762);
+    }
+    AOT_GOTO(0x0853, L0853);
+L0762:
+    AOT_BLOCK(0x0762, 1);
+    // 0762: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0763, L0763);
+L0763:
+    AOT_BLOCK(0x0763, 5);
+    // 0763: mov dx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[2] = RD16(a);
+    }
+    // 0766: mov [0bb6], dx
+    {
+        a = 0x0bb6;
+        WR16(a, r[2]);
+    }
+    // 076a: lea ax, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[0] = a;
+    }
+    // 076d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 076e: call 16d5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0771);
+    }
+    AOT_GOTO(0x16d5, L16d5);
+L0771:
+    AOT_BLOCK(0x0771, 3);
+    // 0771: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0772: cmp [bp-4], 0
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0776: je 07be
+    if (ZF)
+        AOT_GOTO(0x07be, L07be);
+    AOT_GOTO(0x0778, L0778);
+L0778:
+    AOT_BLOCK(0x0778, 1);
+    // 0778: jmp short 07b0
+    AOT_GOTO(0x07b0, L07b0);
+L077a:
+    AOT_BLOCK(0x077a, 2);
+    // 077a: cmp [0bcc], 0
+    {
+        a = 0x0bcc;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 077f: je 078c
+    if (ZF)
+        AOT_GOTO(0x078c, L078c);
+    AOT_GOTO(0x0781, L0781);
+L0781:
+    AOT_BLOCK(0x0781, 4);
+    // 0781: mov dx, 007f
+    {
+        r[2] = 0x007f;
+    }
+    // 0784: and dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = int16_t(r[2]) & int16_t(RD16(a));
+        r[2] = val;
+    }
+    // 0787: cmp dx, d
+    {
+        val = (dst = int16_t(r[2])) - (src = 13);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 078a: je 07be
+    if (ZF)
+        AOT_GOTO(0x07be, L07be);
+    AOT_GOTO(0x078c, L078c);
+L078c:
+    AOT_BLOCK(0x078c, 2);
+    // 078c: push [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 078f: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0792);
+    }
+    AOT_GOTO(0x082f, L082f);
+L0792:
+    AOT_BLOCK(0x0792, 4);
+    // 0792: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0793: mov ax, 0cbe
+    {
+        r[0] = 0x0cbe;
+    }
+    // 0796: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0797: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x079a);
+    }
+    AOT_GOTO(0x082f, L082f);
+L079a:
+    AOT_BLOCK(0x079a, 5);
+    // 079a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 079b: mov dx, 007f
+    {
+        r[2] = 0x007f;
+    }
+    // 079e: and dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = int16_t(r[2]) & int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 07a1: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 07a2: call 07f1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x07a5);
+    }
+    AOT_GOTO(0x07f1, L07f1);
+L07a5:
+    AOT_BLOCK(0x07a5, 4);
+    // 07a5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 07a6: mov ax, 0cbc
+    {
+        r[0] = 0x0cbc;
+    }
+    // 07a9: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 07aa: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x07ad);
+    }
+    AOT_GOTO(0x082f, L082f);
+L07ad:
+    AOT_BLOCK(0x07ad, 2);
+    // 07ad: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 07ae: jmp short 07be
+    AOT_GOTO(0x07be, L07be);
+L07b0:
+    AOT_BLOCK(0x07b0, 5);
+    // 07b0: mov dx, 007f
+    {
+        r[2] = 0x007f;
+    }
+    // 07b3: and dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = int16_t(r[2]) & int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 07b6: mov bx, 0ca4
+    {
+        r[3] = 0x0ca4;
+    }
+    // 07b9: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 07bb: jmp 1d09
+    AOT_GOTO(0x1d09, L1d09);
+L07be:
+    AOT_BLOCK(0x07be, 2);
+    // 07be: cmp [bp-6], 0
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 07c2: je 07d0
+    if (ZF)
+        AOT_GOTO(0x07d0, L07d0);
+    AOT_GOTO(0x07c4, L07c4);
+L07c4:
+    AOT_BLOCK(0x07c4, 5);
+    // 07c4: lea bx, [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        r[3] = a;
+    }
+    // 07c7: mov si, bx
+    {
+        r[6] = r[3];
+    }
+    // 07c9: mov bx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[3] = RD16(a);
+    }
+    // 07cb: add bx, -4
+    {
+        val = (dst = int16_t(r[3])) + (src = -4);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 07ce: mov [si], bx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[3]);
+    }
+    AOT_GOTO(0x07d0, L07d0);
+L07d0:
+    AOT_BLOCK(0x07d0, 2);
+    // 07d0: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 07d1: call 105f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x07d4);
+    }
+    AOT_GOTO(0x105f, L105f);
+L07d4:
+    AOT_BLOCK(0x07d4, 4);
+    // 07d4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 07d5: mov [0bb6], ffff
+    {
+        a = 0x0bb6;
+        WR16(a, 0xffff);
+    }
+    // 07db: cmp [bp-4], 0
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 07df: je 07eb
+    if (ZF)
+        AOT_GOTO(0x07eb, L07eb);
+    AOT_GOTO(0x07e1, L07e1);
+L07e1:
+    AOT_BLOCK(0x07e1, 3);
+    // 07e1: mov [0bc2], 0001
+    {
+        a = 0x0bc2;
+        WR16(a, 0x0001);
+    }
+    // 07e7: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 07e9: jmp short 07ee
+    AOT_GOTO(0x07ee, L07ee);
+L07eb:
+    AOT_BLOCK(0x07eb, 1);
+    // 07eb: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    AOT_GOTO(0x07ee, L07ee);
+L07ee:
+    AOT_BLOCK(0x07ee, 1);
+    // 07ee: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L07f1:
+    AOT_BLOCK(0x07f1, 7);
+    // 07f1: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 07f2: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 07f4: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 07f5: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 07f6: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 07f9: mov si, 0ed9
+    {
+        r[6] = 0x0ed9;
+    }
+    // 07fc: mov byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 0);
+    }
+    AOT_GOTO(0x07ff, L07ff);
+L07ff:
+    AOT_BLOCK(0x07ff, 2);
+    // 07ff: cmp di, a
+    {
+        val = (dst = int16_t(r[7])) - (src = 10);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0802: jb 0820
+    if (CF)
+        AOT_GOTO(0x0820, L0820);
+    AOT_GOTO(0x0804, L0804);
+L0804:
+    AOT_BLOCK(0x0804, 14);
+    // 0804: mov cx, 000a
+    {
+        r[1] = 0x000a;
+    }
+    // 0807: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 0809: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 080b: div cx
+    {
+        u32 = uint32_t(r[2]) << 16 | r[0];
+        src = r[1];
+        r[0] = u32 / src;
+        r[2] = u32 % src;
+    }
+    // 080d: add dx, 30
+    {
+        val = (dst = int16_t(r[2])) + (src = 48);
+        r[2] = val;
+    }
+    // 0810: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 0812: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0813: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        AF = (val & 15) == 15;
+    }
+    // 0814: mov [si], al
+    {
+        a = uint16_t(r[6]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 0816: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 0818: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 081a: div cx
+    {
+        u32 = uint32_t(r[2]) << 16 | r[0];
+        src = r[1];
+        r[0] = u32 / src;
+        r[2] = u32 % src;
+    }
+    // 081c: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 081e: jmp short 07ff
+    AOT_GOTO(0x07ff, L07ff);
+L0820:
+    AOT_BLOCK(0x0820, 6);
+    // 0820: lea ax, [di+30]
+    {
+        a = uint16_t(r[7] + 48);
+        r[0] = a;
+    }
+    // 0823: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0824: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 0825: mov [si], al
+    {
+        a = uint16_t(r[6]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 0827: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0828: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x082b);
+    }
+    AOT_GOTO(0x082f, L082f);
+L082b:
+    AOT_BLOCK(0x082b, 2);
+    // 082b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 082c: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L082f:
+    AOT_BLOCK(0x082f, 6);
+    // 082f: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0830: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0832: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0833: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 0836: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0838: je 0850
+    if (ZF)
+        AOT_GOTO(0x0850, L0850);
+    AOT_GOTO(0x083a, L083a);
+L083a:
+    AOT_BLOCK(0x083a, 2);
+    // 083a: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 083d: je 0850
+    if (ZF)
+        AOT_GOTO(0x0850, L0850);
+    AOT_GOTO(0x083f, L083f);
+L083f:
+    AOT_BLOCK(0x083f, 2);
+    // 083f: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0840: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0843);
+    }
+    AOT_GOTO(0x172e, L172e);
+L0843:
+    AOT_BLOCK(0x0843, 6);
+    // 0843: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0844: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0845: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0846: mov ax, 0002
+    {
+        r[0] = 0x0002;
+    }
+    // 0849: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 084a: call 16d9
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x084d);
+    }
+    AOT_GOTO(0x16d9, L16d9);
+L084d:
+    AOT_BLOCK(0x084d, 1);
+    // 084d: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x0850, L0850);
+L0850:
+    AOT_BLOCK(0x0850, 1);
+    // 0850: jmp 1d33
+    AOT_GOTO(0x1d33, L1d33);
+L0853:
+    AOT_BLOCK(0x0853, 4);
+    // 0853: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0854: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0856: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0859: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x085c);
+    }
+    AOT_GOTO(0x082f, L082f);
+L085c:
+    AOT_BLOCK(0x085c, 4);
+    // 085c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 085d: mov ax, 0002
+    {
+        r[0] = 0x0002;
+    }
+    // 0860: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0861: call 0109
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0864);
+    }
+    AOT_GOTO(0x0109, L0109);
+L0864:
+    AOT_BLOCK(0x0864, 2);
+    // 0864: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0865: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L0868:
+    AOT_BLOCK(0x0868, 14);
+    // 0868: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0869: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 086b: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 086c: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 086d: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 0870: mov si, di
+    {
+        r[6] = r[7];
+    }
+    // 0872: add si, 4
+    {
+        val = (dst = int16_t(r[6])) + (src = 4);
+        r[6] = val;
+    }
+    // 0875: mov dx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[2] = RD16(a);
+    }
+    // 0877: lea bx, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[3] = a;
+    }
+    // 087a: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 087c: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 087e: mov [bx], 0000
+    {
+        a = uint16_t(r[3]);
+        WR16(a, 0x0000);
+    }
+    // 0882: push [si]
+    {
+        a = uint16_t(r[6]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0884: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0887);
+    }
+    AOT_GOTO(0x082f, L082f);
+L0887:
+    AOT_BLOCK(0x0887, 1);
+    // 0887: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0888, L0888);
+L0888:
+    AOT_BLOCK(0x0888, 3);
+    // 0888: add si, 2
+    {
+        val = (dst = int16_t(r[6])) + (src = 2);
+        r[6] = val;
+    }
+    // 088b: cmp [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 088e: je 08b4
+    if (ZF)
+        AOT_GOTO(0x08b4, L08b4);
+    AOT_GOTO(0x0890, L0890);
+L0890:
+    AOT_BLOCK(0x0890, 3);
+    // 0890: mov ax, 0d34
+    {
+        r[0] = 0x0d34;
+    }
+    // 0893: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0894: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0897);
+    }
+    AOT_GOTO(0x082f, L082f);
+L0897:
+    AOT_BLOCK(0x0897, 3);
+    // 0897: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0898: push [si]
+    {
+        a = uint16_t(r[6]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 089a: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x089d);
+    }
+    AOT_GOTO(0x172e, L172e);
+L089d:
+    AOT_BLOCK(0x089d, 3);
+    // 089d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 089e: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 08a0: je 08aa
+    if (ZF)
+        AOT_GOTO(0x08aa, L08aa);
+    AOT_GOTO(0x08a2, L08a2);
+L08a2:
+    AOT_BLOCK(0x08a2, 2);
+    // 08a2: push [si]
+    {
+        a = uint16_t(r[6]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 08a4: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x08a7);
+    }
+    AOT_GOTO(0x082f, L082f);
+L08a7:
+    AOT_BLOCK(0x08a7, 2);
+    // 08a7: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 08a8: jmp short 0888
+    AOT_GOTO(0x0888, L0888);
+L08aa:
+    AOT_BLOCK(0x08aa, 3);
+    // 08aa: mov ax, 0d2c
+    {
+        r[0] = 0x0d2c;
+    }
+    // 08ad: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 08ae: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x08b1);
+    }
+    AOT_GOTO(0x082f, L082f);
+L08b1:
+    AOT_BLOCK(0x08b1, 2);
+    // 08b1: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 08b2: jmp short 0888
+    AOT_GOTO(0x0888, L0888);
+L08b4:
+    AOT_BLOCK(0x08b4, 1);
+    // 08b4: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L08b7:
+    AOT_BLOCK(0x08b7, 13);
+    // 08b7: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 08b8: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 08ba: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 08bb: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 08be: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 08c0: lea bx, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[3] = a;
+    }
+    // 08c3: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 08c5: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 08c7: mov [bx], 0000
+    {
+        a = uint16_t(r[3]);
+        WR16(a, 0x0000);
+    }
+    // 08cb: lea ax, [si+4]
+    {
+        a = uint16_t(r[6] + 4);
+        r[0] = a;
+    }
+    // 08ce: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 08cf: push [si+4]
+    {
+        a = uint16_t(r[6] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 08d2: call 16b9
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x08d5);
+    }
+    AOT_GOTO(0x16b9, L16b9);
+L08d5:
+    AOT_BLOCK(0x08d5, 4);
+    // 08d5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 08d6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 08d7: cmp [0de4], 8
+    {
+        a = 0x0de4;
+        val = (dst = int16_t(RD16(a))) - (src = 8);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 08dc: jne 08f0
+    if (!ZF)
+        AOT_GOTO(0x08f0, L08f0);
+    AOT_GOTO(0x08de, L08de);
+L08de:
+    AOT_BLOCK(0x08de, 6);
+    // 08de: mov [si+2], 0dac
+    {
+        a = uint16_t(r[6] + 2);
+        WR16(a, 0x0dac);
+    }
+    // 08e3: lea ax, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[0] = a;
+    }
+    // 08e6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 08e7: mov ax, 0da4
+    {
+        r[0] = 0x0da4;
+    }
+    // 08ea: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 08eb: call 16b9
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x08ee);
+    }
+    AOT_GOTO(0x16b9, L16b9);
+L08ee:
+    AOT_BLOCK(0x08ee, 2);
+    // 08ee: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 08ef: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x08f0, L08f0);
+L08f0:
+    AOT_BLOCK(0x08f0, 4);
+    // 08f0: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 08f3: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 08f4: push [si+4]
+    {
+        a = uint16_t(r[6] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 08f7: call 16ad
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x08fa);
+    }
+    AOT_GOTO(0x16ad, L16ad);
+L08fa:
+    AOT_BLOCK(0x08fa, 4);
+    // 08fa: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 08fb: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 08fc: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 08fe: jne 0921
+    if (!ZF)
+        AOT_GOTO(0x0921, L0921);
+    AOT_GOTO(0x0900, L0900);
+L0900:
+    AOT_BLOCK(0x0900, 3);
+    // 0900: mov ax, 0d94
+    {
+        r[0] = 0x0d94;
+    }
+    // 0903: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0904: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0907);
+    }
+    AOT_GOTO(0x082f, L082f);
+L0907:
+    AOT_BLOCK(0x0907, 3);
+    // 0907: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0908: push [si+4]
+    {
+        a = uint16_t(r[6] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 090b: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x090e);
+    }
+    AOT_GOTO(0x082f, L082f);
+L090e:
+    AOT_BLOCK(0x090e, 4);
+    // 090e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 090f: mov ax, 0d7e
+    {
+        r[0] = 0x0d7e;
+    }
+    // 0912: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0913: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0916);
+    }
+    AOT_GOTO(0x082f, L082f);
+L0916:
+    AOT_BLOCK(0x0916, 4);
+    // 0916: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0917: mov ax, 0d4a
+    {
+        r[0] = 0x0d4a;
+    }
+    // 091a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 091b: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x091e);
+    }
+    AOT_GOTO(0x082f, L082f);
+L091e:
+    AOT_BLOCK(0x091e, 2);
+    // 091e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 091f: jmp short 0930
+    AOT_GOTO(0x0930, L0930);
+L0921:
+    AOT_BLOCK(0x0921, 2);
+    // 0921: push [si+4]
+    {
+        a = uint16_t(r[6] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0924: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0927);
+    }
+    AOT_GOTO(0x082f, L082f);
+L0927:
+    AOT_BLOCK(0x0927, 4);
+    // 0927: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0928: mov ax, 0d36
+    {
+        r[0] = 0x0d36;
+    }
+    // 092b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 092c: call 082f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x092f);
+    }
+    AOT_GOTO(0x082f, L082f);
+L092f:
+    AOT_BLOCK(0x092f, 1);
+    // 092f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0930, L0930);
+L0930:
+    AOT_BLOCK(0x0930, 3);
+    // 0930: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0933: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0934: call 11df
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0937);
+    }
+    AOT_GOTO(0x11df, L11df);
+L0937:
+    AOT_BLOCK(0x0937, 2);
+    // 0937: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0938: jmp 1d33
+    AOT_GOTO(0x1d33, L1d33);
+L093b:
+    AOT_BLOCK(0x093b, 7);
+    // 093b: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 093c: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 093e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 093f: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0940: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0941: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 0944: call 16c1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0947);
+    }
+    AOT_GOTO(0x16c1, L16c1);
+L0947:
+    AOT_BLOCK(0x0947, 8);
+    // 0947: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 0949: mov bx, [18e8]
+    {
+        a = 0x18e8;
+        r[3] = RD16(a);
+    }
+    // 094d: push [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0950: mov ax, 0db4
+    {
+        r[0] = 0x0db4;
+    }
+    // 0953: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0954: push [0bd0]
+    {
+        a = 0x0bd0;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0958: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0959: call 0563
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x095c);
+    }
+    AOT_GOTO(0x0563, L0563);
+L095c:
+    AOT_BLOCK(0x095c, 1);
+    // 095c: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x095f, L095f);
+L095f:
+    AOT_BLOCK(0x095f, 2);
+    // 095f: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0962: je 0967
+    if (ZF)
+        AOT_GOTO(0x0967, L0967);
+    AOT_GOTO(0x0964, L0964);
+L0964:
+    AOT_BLOCK(0x0964, 2);
+    // 0964: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0965: jmp short 095f
+    AOT_GOTO(0x095f, L095f);
+L0967:
+    AOT_BLOCK(0x0967, 1);
+    // 0967: mov [bp-2], 0009
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, 0x0009);
+    }
+    AOT_GOTO(0x096c, L096c);
+L096c:
+    AOT_BLOCK(0x096c, 2);
+    // 096c: cmp [bp-2], 3
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 3);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0970: jle 098c
+    if (ZF || SF != OF)
+        AOT_GOTO(0x098c, L098c);
+    AOT_GOTO(0x0972, L0972);
+L0972:
+    AOT_BLOCK(0x0972, 13);
+    // 0972: mov cx, 000a
+    {
+        r[1] = 0x000a;
+    }
+    // 0975: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 0977: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 0978: idiv cx
+    {
+        i32 = int32_t(uint32_t(r[2]) << 16 | r[0]);
+        src = int16_t(r[1]);
+        r[0] = i32 / src;
+        r[2] = i32 % src;
+    }
+    // 097a: add dx, 30
+    {
+        val = (dst = int16_t(r[2])) + (src = 48);
+        r[2] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 097d: mov [si], dl
+    {
+        a = uint16_t(r[6]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 097f: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 0980: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 0982: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 0983: idiv cx
+    {
+        i32 = int32_t(uint32_t(r[2]) << 16 | r[0]);
+        src = int16_t(r[1]);
+        r[0] = i32 / src;
+        r[2] = i32 % src;
+    }
+    // 0985: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 0987: dec [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 098a: jmp short 096c
+    AOT_GOTO(0x096c, L096c);
+L098c:
+    AOT_BLOCK(0x098c, 5);
+    // 098c: mov byte [si], 2e
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 46);
+    }
+    // 098f: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 0990: mov byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 0);
+    }
+    // 0993: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0994: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L0997:
+    AOT_BLOCK(0x0997, 10);
+    // 0997: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0998: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 099a: sub sp, 42
+    {
+        val = (dst = int16_t(r[4])) - (src = 66);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 099d: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 099e: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 099f: mov si, 0356
+    {
+        r[6] = 0x0356;
+    }
+    // 09a2: lea ax, [bp-42]
+    {
+        a = uint16_t(r[5] - 66);
+        r[0] = a;
+    }
+    // 09a5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 09a6: push [0bc0]
+    {
+        a = 0x0bc0;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 09aa: call 05a1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x09ad);
+    }
+    AOT_GOTO(0x05a1, L05a1);
+L09ad:
+    AOT_BLOCK(0x09ad, 5);
+    // 09ad: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 09ae: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 09af: lea ax, [bp-42]
+    {
+        a = uint16_t(r[5] - 66);
+        r[0] = a;
+    }
+    // 09b2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 09b3: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x09b6);
+    }
+    AOT_GOTO(0x172e, L172e);
+L09b6:
+    AOT_BLOCK(0x09b6, 2);
+    // 09b6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 09b7: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    AOT_GOTO(0x09b9, L09b9);
+L09b9:
+    AOT_BLOCK(0x09b9, 2);
+    // 09b9: cmp [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 09bc: je 09ea
+    if (ZF)
+        AOT_GOTO(0x09ea, L09ea);
+    AOT_GOTO(0x09be, L09be);
+L09be:
+    AOT_BLOCK(0x09be, 4);
+    // 09be: lea ax, [bp+di-42]
+    {
+        a = uint16_t(r[5] + r[7] - 66);
+        r[0] = a;
+    }
+    // 09c1: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 09c2: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 09c5: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x09c8);
+    }
+    AOT_GOTO(0x172e, L172e);
+L09c8:
+    AOT_BLOCK(0x09c8, 3);
+    // 09c8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 09c9: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 09cb: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x09cc, L09cc);
+L09cc:
+    AOT_BLOCK(0x09cc, 4);
+    // 09cc: add bx, ax
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[0]));
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 09ce: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 09cf: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 09d2: call 1716
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x09d5);
+    }
+    AOT_GOTO(0x1716, L1716);
+L09d5:
+    AOT_BLOCK(0x09d5, 4);
+    // 09d5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 09d6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 09d7: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 09d9: jne 09e4
+    if (!ZF)
+        AOT_GOTO(0x09e4, L09e4);
+    AOT_GOTO(0x09db, L09db);
+L09db:
+    AOT_BLOCK(0x09db, 2);
+    // 09db: mov [18e8], si
+    {
+        a = 0x18e8;
+        WR16(a, r[6]);
+    }
+    // 09df: call 09f5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x09e2);
+    }
+    AOT_GOTO(0x09f5, L09f5);
+L09e2:
+    AOT_BLOCK(0x09e2, 1);
+    // 09e2: jmp short 09f2
+    AOT_GOTO(0x09f2, L09f2);
+L09e4:
+    AOT_BLOCK(0x09e4, 1);
+    // 09e4: add si, 00e6
+    {
+        val = (dst = int16_t(r[6])) + (src = 230);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x09e8, L09e8);
+L09e8:
+    AOT_BLOCK(0x09e8, 1);
+    // 09e8: jmp short 09b9
+    AOT_GOTO(0x09b9, L09b9);
+L09ea:
+    AOT_BLOCK(0x09ea, 3);
+    // 09ea: mov ax, 0db6
+    {
+        r[0] = 0x0db6;
+    }
+    // 09ed: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 09ee: call 0853
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x09f1);
+    }
+    AOT_GOTO(0x0853, L0853);
+L09f1:
+    AOT_BLOCK(0x09f1, 1);
+    // 09f1: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x09f2, L09f2);
+L09f2:
+    AOT_BLOCK(0x09f2, 1);
+    // 09f2: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L09f5:
+    AOT_BLOCK(0x09f5, 1);
+    // 09f5: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    AOT_GOTO(0x09f6, L09f6);
+L09f6:
+    AOT_BLOCK(0x09f6, 4);
+    // 09f6: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 09f8: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 09f9: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 09fa: mov si, 0004
+    {
+        r[6] = 0x0004;
+    }
+    AOT_GOTO(0x09fd, L09fd);
+L09fd:
+    AOT_BLOCK(0x09fd, 2);
+    // 09fd: test byte [si+a], 4
+    {
+        a = uint16_t(r[6] + 10);
+        val = int8_t(RD8(a)) & 4;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0a01: jne 0a08
+    if (!ZF)
+        AOT_GOTO(0x0a08, L0a08);
+    AOT_GOTO(0x0a03, L0a03);
+L0a03:
+    AOT_BLOCK(0x0a03, 2);
+    // 0a03: add si, c
+    {
+        val = (dst = int16_t(r[6])) + (src = 12);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0a06: jmp short 09fd
+    AOT_GOTO(0x09fd, L09fd);
+L0a08:
+    AOT_BLOCK(0x0a08, 3);
+    // 0a08: mov [18ec], si
+    {
+        a = 0x18ec;
+        WR16(a, r[6]);
+    }
+    // 0a0c: mov di, [18e8]
+    {
+        a = 0x18e8;
+        r[7] = RD16(a);
+    }
+    // 0a10: add di, 4
+    {
+        val = (dst = int16_t(r[7])) + (src = 4);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x0a13, L0a13);
+L0a13:
+    AOT_BLOCK(0x0a13, 3);
+    // 0a13: push [si]
+    {
+        a = uint16_t(r[6]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0a15: push [di]
+    {
+        a = uint16_t(r[7]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0a17: call 1716
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0a1a);
+    }
+    AOT_GOTO(0x1716, L1716);
+L0a1a:
+    AOT_BLOCK(0x0a1a, 3);
+    // 0a1a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0a1b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0a1c: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0a1e, L0a1e);
+L0a1e:
+    AOT_BLOCK(0x0a1e, 1);
+    // 0a1e: je 0a25
+    if (ZF)
+        AOT_GOTO(0x0a25, L0a25);
+    AOT_GOTO(0x0a20, L0a20);
+L0a20:
+    AOT_BLOCK(0x0a20, 2);
+    // 0a20: add di, 20
+    {
+        val = (dst = int16_t(r[7])) + (src = 32);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0a23: jmp short 0a13
+    AOT_GOTO(0x0a13, L0a13);
+L0a25:
+    AOT_BLOCK(0x0a25, 2);
+    // 0a25: mov [18ea], di
+    {
+        a = 0x18ea;
+        WR16(a, r[7]);
+    }
+    // 0a29: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L0a2c:
+    AOT_BLOCK(0x0a2c, 9);
+    // 0a2c: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0a2d: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0a2f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a30: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a31: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0a32: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0a34: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a35: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0a38: call 16c9
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0a3b);
+    }
+    AOT_GOTO(0x16c9, L16c9);
+L0a3b:
+    AOT_BLOCK(0x0a3b, 1);
+    // 0a3b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0a3c, L0a3c);
+L0a3c:
+    AOT_BLOCK(0x0a3c, 4);
+    // 0a3c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0a3d: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 0a3f: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0a41: jnl 0a47
+    if (SF == OF)
+        AOT_GOTO(0x0a47, L0a47);
+    AOT_GOTO(0x0a43, L0a43);
+L0a43:
+    AOT_BLOCK(0x0a43, 2);
+    // 0a43: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0a45: jmp short 0a72
+    AOT_GOTO(0x0a72, L0a72);
+L0a47:
+    AOT_BLOCK(0x0a47, 3);
+    // 0a47: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0a4a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a4b: lea ax, [bp-3]
+    {
+        a = uint16_t(r[5] - 3);
+        r[0] = a;
+    }
+    AOT_GOTO(0x0a4e, L0a4e);
+L0a4e:
+    AOT_BLOCK(0x0a4e, 3);
+    // 0a4e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a4f: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0a50: call 16cd
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0a53);
+    }
+    AOT_GOTO(0x16cd, L16cd);
+L0a53:
+    AOT_BLOCK(0x0a53, 3);
+    // 0a53: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 0a56: cmp ax, 0001
+    {
+        val = (dst = int16_t(r[0])) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0a59: je 0a5f
+    if (ZF)
+        AOT_GOTO(0x0a5f, L0a5f);
+    AOT_GOTO(0x0a5b, L0a5b);
+L0a5b:
+    AOT_BLOCK(0x0a5b, 1);
+    // 0a5b: mov byte [bp-3], 0
+    {
+        a = uint16_t(r[5] - 3);
+        WR8(a, 0);
+    }
+    AOT_GOTO(0x0a5f, L0a5f);
+L0a5f:
+    AOT_BLOCK(0x0a5f, 1);
+    // 0a5f: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    AOT_GOTO(0x0a60, L0a60);
+L0a60:
+    AOT_BLOCK(0x0a60, 1);
+    // 0a60: call 16b1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0a63);
+    }
+    AOT_GOTO(0x16b1, L16b1);
+L0a63:
+    AOT_BLOCK(0x0a63, 3);
+    // 0a63: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0a64: mov al, [bp-3]
+    {
+        a = uint16_t(r[5] - 3);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0a67: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    AOT_GOTO(0x0a68, L0a68);
+L0a68:
+    AOT_BLOCK(0x0a68, 3);
+    // 0a68: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+    }
+    // 0a6a: cmp ax, 0023
+    {
+        val = (dst = int16_t(r[0])) - (src = 35);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0a6d: jne 0a70
+    if (!ZF)
+        AOT_GOTO(0x0a70, L0a70);
+    AOT_GOTO(0x0a6f, L0a6f);
+L0a6f:
+    AOT_BLOCK(0x0a6f, 1);
+    // 0a6f: inc bx
+    {
+        val = int16_t(r[3]) + 1;
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x0a70, L0a70);
+L0a70:
+    AOT_BLOCK(0x0a70, 1);
+    // 0a70: mov ax, bx
+    {
+        r[0] = r[3];
+    }
+    AOT_GOTO(0x0a72, L0a72);
+L0a72:
+    AOT_BLOCK(0x0a72, 1);
+    // 0a72: jmp 1d33
+    AOT_GOTO(0x1d33, L1d33);
+L0a75:
+    AOT_BLOCK(0x0a75, 1);
+    // 0a75: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    AOT_GOTO(0x0a76, L0a76);
+L0a76:
+    AOT_BLOCK(0x0a76, 3);
+    // 0a76: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0a78: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0a79: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x0a7c, L0a7c);
+L0a7c:
+    AOT_BLOCK(0x0a7c, 2);
+    // 0a7c: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0a7f: je 0a89
+    if (ZF)
+        AOT_GOTO(0x0a89, L0a89);
+    AOT_GOTO(0x0a81, L0a81);
+L0a81:
+    AOT_BLOCK(0x0a81, 2);
+    // 0a81: cmp byte [si], 2e
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 46);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0a84: je 0a89
+    if (ZF)
+        AOT_GOTO(0x0a89, L0a89);
+    AOT_GOTO(0x0a86, L0a86);
+L0a86:
+    AOT_BLOCK(0x0a86, 2);
+    // 0a86: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0a87: jmp short 0a7c
+    AOT_GOTO(0x0a7c, L0a7c);
+L0a89:
+    AOT_BLOCK(0x0a89, 2);
+    // 0a89: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0a8c: jne 0a92
+    if (!ZF)
+        AOT_GOTO(0x0a92, L0a92);
+    AOT_GOTO(0x0a8e, L0a8e);
+L0a8e:
+    AOT_BLOCK(0x0a8e, 2);
+    // 0a8e: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0a90: jmp short 0aa5
+    AOT_GOTO(0x0aa5, L0aa5);
+L0a92:
+    AOT_BLOCK(0x0a92, 2);
+    // 0a92: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 0a93: cmp byte [si], 63
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 99);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    AOT_GOTO(0x0a96, L0a96);
+L0a96:
+    AOT_BLOCK(0x0a96, 1);
+    // 0a96: jne 0aa3
+    if (!ZF)
+        AOT_GOTO(0x0aa3, L0aa3);
+    AOT_GOTO(0x0a98, L0a98);
+L0a98:
+    AOT_BLOCK(0x0a98, 3);
+    // 0a98: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 0a99: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0a9c: jne 0aa3
+    if (!ZF)
+        AOT_GOTO(0x0aa3, L0aa3);
+    AOT_GOTO(0x0a9e, L0a9e);
+L0a9e:
+    AOT_BLOCK(0x0a9e, 2);
+    // 0a9e: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0aa1: jmp short 0aa5
+    AOT_GOTO(0x0aa5, L0aa5);
+L0aa3:
+    AOT_BLOCK(0x0aa3, 1);
+    // 0aa3: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0aa5, L0aa5);
+L0aa5:
+    AOT_BLOCK(0x0aa5, 1);
+    // 0aa5: jmp 1d33
+    AOT_GOTO(0x1d33, L1d33);
+L0aa8:
+    AOT_BLOCK(0x0aa8, 15);
+    // 0aa8: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0aa9: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0aab: sub sp, 6
+    {
+        val = (dst = int16_t(r[4])) - (src = 6);
+        r[4] = val;
+    }
+    // 0aae: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0aaf: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0ab0: mov di, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[7] = RD16(a);
+    }
+    // 0ab3: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 0ab6: mov [bp-2], 1112
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, 0x1112);
+    }
+    // 0abb: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 0abe: add bx, 4
+    {
+        val = (dst = int16_t(r[3])) + (src = 4);
+        r[3] = val;
+    }
+    // 0ac1: mov dx, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[2] = RD16(a);
+    }
+    // 0ac4: mov cx, 0005
+    {
+        r[1] = 0x0005;
+    }
+    // 0ac7: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0ac9: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0acb: mov [bp-4], bx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[3]);
+    }
+    AOT_GOTO(0x0ace, L0ace);
+L0ace:
+    AOT_BLOCK(0x0ace, 1);
+    // 0ace: cmp [bp+e], 0
+    {
+        a = uint16_t(r[5] + 14);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    AOT_GOTO(0x0ad2, L0ad2);
+L0ad2:
+    AOT_BLOCK(0x0ad2, 1);
+    // 0ad2: jne 0ad7
+    if (!ZF)
+        AOT_GOTO(0x0ad7, L0ad7);
+    AOT_GOTO(0x0ad4, L0ad4);
+L0ad4:
+    AOT_BLOCK(0x0ad4, 1);
+    // 0ad4: jmp 0bb8
+    AOT_GOTO(0x0bb8, L0bb8);
+L0ad7:
+    AOT_BLOCK(0x0ad7, 2);
+    // 0ad7: test byte [si+a], 80
+    {
+        a = uint16_t(r[6] + 10);
+        val = int8_t(RD8(a)) & -128;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0adb: jne 0af3
+    if (!ZF)
+        AOT_GOTO(0x0af3, L0af3);
+    AOT_GOTO(0x0add, L0add);
+L0add:
+    AOT_BLOCK(0x0add, 2);
+    // 0add: test [si+a], 0100
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) & 256;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0ae2: jne 0ae7
+    if (!ZF)
+        AOT_GOTO(0x0ae7, L0ae7);
+    AOT_GOTO(0x0ae4, L0ae4);
+L0ae4:
+    AOT_BLOCK(0x0ae4, 1);
+    // 0ae4: jmp 0bb8
+    AOT_GOTO(0x0bb8, L0bb8);
+L0ae7:
+    AOT_BLOCK(0x0ae7, 2);
+    // 0ae7: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0ae8: call 0a2c
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0aeb);
+    }
+    AOT_GOTO(0x0a2c, L0a2c);
+L0aeb:
+    AOT_BLOCK(0x0aeb, 2);
+    // 0aeb: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0aec: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0aee, L0aee);
+L0aee:
+    AOT_BLOCK(0x0aee, 1);
+    // 0aee: jne 0af3
+    if (!ZF)
+        AOT_GOTO(0x0af3, L0af3);
+    AOT_GOTO(0x0af0, L0af0);
+L0af0:
+    AOT_BLOCK(0x0af0, 1);
+    // 0af0: jmp 0bb8
+    AOT_GOTO(0x0bb8, L0bb8);
+L0af3:
+    AOT_BLOCK(0x0af3, 1);
+    // 0af3: mov ax, 0dc8
+    {
+        r[0] = 0x0dc8;
+    }
+    AOT_GOTO(0x0af6, L0af6);
+L0af6:
+    AOT_BLOCK(0x0af6, 3);
+    // 0af6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0af7: push [000a]
+    {
+        a = 0x000a;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0afb: mov ax, 18a8
+    {
+        r[0] = 0x18a8;
+    }
+    AOT_GOTO(0x0afe, L0afe);
+L0afe:
+    AOT_BLOCK(0x0afe, 4);
+    // 0afe: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0aff: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 0b02: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b03: call 0563
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0b06);
+    }
+    AOT_GOTO(0x0563, L0563);
+L0b06:
+    AOT_BLOCK(0x0b06, 5);
+    // 0b06: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0b09: mov ax, 0004
+    {
+        r[0] = 0x0004;
+    }
+    // 0b0c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b0d: test [si+a], 0200
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0b12: je 0b19
+    if (ZF)
+        AOT_GOTO(0x0b19, L0b19);
+    AOT_GOTO(0x0b14, L0b14);
+L0b14:
+    AOT_BLOCK(0x0b14, 2);
+    // 0b14: mov ax, 0296
+    {
+        r[0] = 0x0296;
+    }
+    // 0b17: jmp short 0b1c
+    AOT_GOTO(0x0b1c, L0b1c);
+L0b19:
+    AOT_BLOCK(0x0b19, 1);
+    // 0b19: mov ax, 0200
+    {
+        r[0] = 0x0200;
+    }
+    AOT_GOTO(0x0b1c, L0b1c);
+L0b1c:
+    AOT_BLOCK(0x0b1c, 2);
+    // 0b1c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b1d: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    AOT_GOTO(0x0b20, L0b20);
+L0b20:
+    AOT_BLOCK(0x0b20, 4);
+    // 0b20: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b21: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0b22: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0b25: call 0e12
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0b28);
+    }
+    AOT_GOTO(0x0e12, L0e12);
+L0b28:
+    AOT_BLOCK(0x0b28, 4);
+    // 0b28: add sp, a
+    {
+        val = (dst = int16_t(r[4])) + (src = 10);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0b2b: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 0b2e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b2f: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    AOT_GOTO(0x0b30, L0b30);
+L0b30:
+    AOT_BLOCK(0x0b30, 4);
+    // 0b30: mov ax, 0004
+    {
+        r[0] = 0x0004;
+    }
+    // 0b33: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b34: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0b37: call 0625
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0b3a);
+    }
+    AOT_GOTO(0x0625, L0625);
+L0b3a:
+    AOT_BLOCK(0x0b3a, 3);
+    // 0b3a: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0b3d: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0b3f: jne 0b55
+    if (!ZF)
+        AOT_GOTO(0x0b55, L0b55);
+    AOT_GOTO(0x0b41, L0b41);
+L0b41:
+    AOT_BLOCK(0x0b41, 3);
+    // 0b41: mov dx, 1282
+    {
+        r[2] = 0x1282;
+    }
+    // 0b44: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0b46: je 0b50
+    if (ZF)
+        AOT_GOTO(0x0b50, L0b50);
+    AOT_GOTO(0x0b48, L0b48);
+L0b48:
+    AOT_BLOCK(0x0b48, 3);
+    // 0b48: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 0b4b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b4c: call 0470
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0b4f);
+    }
+    AOT_GOTO(0x0470, L0470);
+L0b4f:
+    AOT_BLOCK(0x0b4f, 1);
+    // 0b4f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0b50, L0b50);
+L0b50:
+    AOT_BLOCK(0x0b50, 1);
+    // 0b50: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0b52, L0b52);
+L0b52:
+    AOT_BLOCK(0x0b52, 1);
+    // 0b52: jmp 0c4b
+    AOT_GOTO(0x0c4b, L0c4b);
+L0b55:
+    AOT_BLOCK(0x0b55, 1);
+    // 0b55: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    AOT_GOTO(0x0b56, L0b56);
+L0b56:
+    AOT_BLOCK(0x0b56, 1);
+    // 0b56: call 0a75
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0b59);
+    }
+    AOT_GOTO(0x0a75, L0a75);
+L0b59:
+    AOT_BLOCK(0x0b59, 2);
+    // 0b59: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0b5a: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0b5c, L0b5c);
+L0b5c:
+    AOT_BLOCK(0x0b5c, 1);
+    // 0b5c: je 0b9e
+    if (ZF)
+        AOT_GOTO(0x0b9e, L0b9e);
+    AOT_GOTO(0x0b5e, L0b5e);
+L0b5e:
+    AOT_BLOCK(0x0b5e, 8);
+    // 0b5e: mov ax, 0010
+    {
+        r[0] = 0x0010;
+    }
+    // 0b61: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b62: mov ax, 0330
+    {
+        r[0] = 0x0330;
+    }
+    // 0b65: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b66: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 0b69: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b6a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b6b: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x0b6e, L0b6e);
+L0b6e:
+    AOT_BLOCK(0x0b6e, 1);
+    // 0b6e: call 0e12
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0b71);
+    }
+    AOT_GOTO(0x0e12, L0e12);
+L0b71:
+    AOT_BLOCK(0x0b71, 8);
+    // 0b71: add sp, a
+    {
+        val = (dst = int16_t(r[4])) + (src = 10);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0b74: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 0b77: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b78: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b79: mov ax, 0010
+    {
+        r[0] = 0x0010;
+    }
+    // 0b7c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b7d: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0b80: call 0625
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0b83);
+    }
+    AOT_GOTO(0x0625, L0625);
+L0b83:
+    AOT_BLOCK(0x0b83, 3);
+    // 0b83: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0b86: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0b88: jne 0b9e
+    if (!ZF)
+        AOT_GOTO(0x0b9e, L0b9e);
+    AOT_GOTO(0x0b8a, L0b8a);
+L0b8a:
+    AOT_BLOCK(0x0b8a, 3);
+    // 0b8a: mov dx, 1282
+    {
+        r[2] = 0x1282;
+    }
+    // 0b8d: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0b8f: je 0b99
+    if (ZF)
+        AOT_GOTO(0x0b99, L0b99);
+    AOT_GOTO(0x0b91, L0b91);
+L0b91:
+    AOT_BLOCK(0x0b91, 3);
+    // 0b91: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 0b94: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0b95: call 0470
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0b98);
+    }
+    AOT_GOTO(0x0470, L0470);
+L0b98:
+    AOT_BLOCK(0x0b98, 1);
+    // 0b98: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0b99, L0b99);
+L0b99:
+    AOT_BLOCK(0x0b99, 2);
+    // 0b99: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0b9b: jmp 0c4b
+    AOT_GOTO(0x0c4b, L0c4b);
+L0b9e:
+    AOT_BLOCK(0x0b9e, 5);
+    // 0b9e: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 0ba1: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0ba2: mov ax, 1242
+    {
+        r[0] = 0x1242;
+    }
+    // 0ba5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0ba6: call 171c
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0ba9);
+    }
+    AOT_GOTO(0x171c, L171c);
+L0ba9:
+    AOT_BLOCK(0x0ba9, 3);
+    // 0ba9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0baa: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0bab: mov byte [1282], 0
+    {
+        a = 0x1282;
+        WR8(a, 0);
+    }
+    AOT_GOTO(0x0bb0, L0bb0);
+L0bb0:
+    AOT_BLOCK(0x0bb0, 2);
+    // 0bb0: mov di, 1242
+    {
+        r[7] = 0x1242;
+    }
+    // 0bb3: mov [bp+c], 0000
+    {
+        a = uint16_t(r[5] + 12);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x0bb8, L0bb8);
+L0bb8:
+    AOT_BLOCK(0x0bb8, 2);
+    // 0bb8: cmp [si+6], 0
+    {
+        a = uint16_t(r[6] + 6);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0bbc: je 0bd7
+    if (ZF)
+        AOT_GOTO(0x0bd7, L0bd7);
+    AOT_GOTO(0x0bbe, L0bbe);
+L0bbe:
+    AOT_BLOCK(0x0bbe, 7);
+    // 0bbe: mov ax, 0dc6
+    {
+        r[0] = 0x0dc6;
+    }
+    // 0bc1: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0bc2: push [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0bc5: push [bp+10]
+    {
+        a = uint16_t(r[5] + 16);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0bc8: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 0bcb: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0bcc: call 0563
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0bcf);
+    }
+    AOT_GOTO(0x0563, L0563);
+L0bcf:
+    AOT_BLOCK(0x0bcf, 1);
+    // 0bcf: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x0bd2, L0bd2);
+L0bd2:
+    AOT_BLOCK(0x0bd2, 2);
+    // 0bd2: mov [bp-6], ax
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[0]);
+    }
+    // 0bd5: jmp short 0bde
+    AOT_GOTO(0x0bde, L0bde);
+L0bd7:
+    AOT_BLOCK(0x0bd7, 2);
+    // 0bd7: mov dx, [0bb8]
+    {
+        a = 0x0bb8;
+        r[2] = RD16(a);
+    }
+    // 0bdb: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x0bde, L0bde);
+L0bde:
+    AOT_BLOCK(0x0bde, 2);
+    // 0bde: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0bdf: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x0be2, L0be2);
+L0be2:
+    AOT_BLOCK(0x0be2, 4);
+    // 0be2: push [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0be5: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0be6: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0be9: call 0e12
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0bec);
+    }
+    AOT_GOTO(0x0e12, L0e12);
+L0bec:
+    AOT_BLOCK(0x0bec, 6);
+    // 0bec: add sp, a
+    {
+        val = (dst = int16_t(r[4])) + (src = 10);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0bef: push [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0bf2: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0bf3: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0bf4: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0bf7: call 0625
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0bfa);
+    }
+    AOT_GOTO(0x0625, L0625);
+L0bfa:
+    AOT_BLOCK(0x0bfa, 3);
+    // 0bfa: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0bfd: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0bff: jne 0c27
+    if (!ZF)
+        AOT_GOTO(0x0c27, L0c27);
+    AOT_GOTO(0x0c01, L0c01);
+L0c01:
+    AOT_BLOCK(0x0c01, 2);
+    // 0c01: test byte [si+a], 20
+    {
+        a = uint16_t(r[6] + 10);
+        val = int8_t(RD8(a)) & 32;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0c05: jne 0c14
+    if (!ZF)
+        AOT_GOTO(0x0c14, L0c14);
+    AOT_GOTO(0x0c07, L0c07);
+L0c07:
+    AOT_BLOCK(0x0c07, 2);
+    // 0c07: cmp [bp-6], 0
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0c0b: je 0c14
+    if (ZF)
+        AOT_GOTO(0x0c14, L0c14);
+    AOT_GOTO(0x0c0d, L0c0d);
+L0c0d:
+    AOT_BLOCK(0x0c0d, 2);
+    // 0c0d: push [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0c10: call 0470
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0c13);
+    }
+    AOT_GOTO(0x0470, L0470);
+L0c13:
+    AOT_BLOCK(0x0c13, 1);
+    // 0c13: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0c14, L0c14);
+L0c14:
+    AOT_BLOCK(0x0c14, 2);
+    // 0c14: cmp [bp+c], 0
+    {
+        a = uint16_t(r[5] + 12);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0c18: jne 0c23
+    if (!ZF)
+        AOT_GOTO(0x0c23, L0c23);
+    AOT_GOTO(0x0c1a, L0c1a);
+L0c1a:
+    AOT_BLOCK(0x0c1a, 2);
+    // 0c1a: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0c1c: je 0c23
+    if (ZF)
+        AOT_GOTO(0x0c23, L0c23);
+    AOT_GOTO(0x0c1e, L0c1e);
+L0c1e:
+    AOT_BLOCK(0x0c1e, 2);
+    // 0c1e: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0c1f: call 0470
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0c22);
+    }
+    AOT_GOTO(0x0470, L0470);
+L0c22:
+    AOT_BLOCK(0x0c22, 1);
+    // 0c22: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0c23, L0c23);
+L0c23:
+    AOT_BLOCK(0x0c23, 2);
+    // 0c23: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0c25: jmp short 0c4b
+    AOT_GOTO(0x0c4b, L0c4b);
+L0c27:
+    AOT_BLOCK(0x0c27, 2);
+    // 0c27: cmp [bp+c], 0
+    {
+        a = uint16_t(r[5] + 12);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0c2b: jne 0c36
+    if (!ZF)
+        AOT_GOTO(0x0c36, L0c36);
+    AOT_GOTO(0x0c2d, L0c2d);
+L0c2d:
+    AOT_BLOCK(0x0c2d, 2);
+    // 0c2d: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0c2f: je 0c36
+    if (ZF)
+        AOT_GOTO(0x0c36, L0c36);
+    AOT_GOTO(0x0c31, L0c31);
+L0c31:
+    AOT_BLOCK(0x0c31, 2);
+    // 0c31: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0c32: call 0470
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0c35);
+    }
+    AOT_GOTO(0x0470, L0470);
+L0c35:
+    AOT_BLOCK(0x0c35, 1);
+    // 0c35: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0c36, L0c36);
+L0c36:
+    AOT_BLOCK(0x0c36, 2);
+    // 0c36: mov ax, 1282
+    {
+        r[0] = 0x1282;
+    }
+    // 0c39: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x0c3a, L0c3a);
+L0c3a:
+    AOT_BLOCK(0x0c3a, 3);
+    // 0c3a: mov ax, 1242
+    {
+        r[0] = 0x1242;
+    }
+    // 0c3d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0c3e: call 171c
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0c41);
+    }
+    AOT_GOTO(0x171c, L171c);
+L0c41:
+    AOT_BLOCK(0x0c41, 4);
+    // 0c41: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0c42: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0c43: mov byte [1282], 0
+    {
+        a = 0x1282;
+        WR8(a, 0);
+    }
+    // 0c48: mov ax, 1242
+    {
+        r[0] = 0x1242;
+    }
+    AOT_GOTO(0x0c4b, L0c4b);
+L0c4b:
+    AOT_BLOCK(0x0c4b, 1);
+    // 0c4b: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L0c4e:
+    AOT_BLOCK(0x0c4e, 5);
+    // 0c4e: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0c4f: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0c51: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0c52: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0c53: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    AOT_GOTO(0x0c54, L0c54);
+L0c54:
+    AOT_BLOCK(0x0c54, 5);
+    // 0c54: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0c55: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 0c58: mov di, [bx+4]
+    {
+        a = uint16_t(r[3] + 4);
+        r[7] = RD16(a);
+    }
+    // 0c5b: cmp [bp+6], 0
+    {
+        a = uint16_t(r[5] + 6);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0c5f: jne 0c65
+    if (!ZF)
+        AOT_GOTO(0x0c65, L0c65);
+    AOT_GOTO(0x0c61, L0c61);
+L0c61:
+    AOT_BLOCK(0x0c61, 2);
+    // 0c61: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0c63: jmp short 0cb2
+    AOT_GOTO(0x0cb2, L0cb2);
+L0c65:
+    AOT_BLOCK(0x0c65, 2);
+    // 0c65: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0c68: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0c6b);
+    }
+    AOT_GOTO(0x172e, L172e);
+L0c6b:
+    AOT_BLOCK(0x0c6b, 2);
+    // 0c6b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0c6c: mov [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[0]);
+    }
+    AOT_GOTO(0x0c6f, L0c6f);
+L0c6f:
+    AOT_BLOCK(0x0c6f, 2);
+    // 0c6f: cmp byte [di], 0
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0c72: je 0cb0
+    if (ZF)
+        AOT_GOTO(0x0cb0, L0cb0);
+    AOT_GOTO(0x0c74, L0c74);
+L0c74:
+    AOT_BLOCK(0x0c74, 1);
+    // 0c74: mov si, di
+    {
+        r[6] = r[7];
+    }
+    AOT_GOTO(0x0c76, L0c76);
+L0c76:
+    AOT_BLOCK(0x0c76, 2);
+    // 0c76: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0c79: je 0c83
+    if (ZF)
+        AOT_GOTO(0x0c83, L0c83);
+    AOT_GOTO(0x0c7b, L0c7b);
+L0c7b:
+    AOT_BLOCK(0x0c7b, 2);
+    // 0c7b: cmp byte [si], 2c
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 44);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0c7e: je 0c83
+    if (ZF)
+        AOT_GOTO(0x0c83, L0c83);
+    AOT_GOTO(0x0c80, L0c80);
+L0c80:
+    AOT_BLOCK(0x0c80, 2);
+    // 0c80: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0c81: jmp short 0c76
+    AOT_GOTO(0x0c76, L0c76);
+L0c83:
+    AOT_BLOCK(0x0c83, 4);
+    // 0c83: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0c85: sub dx, di
+    {
+        val = (dst = int16_t(r[2])) - (src = int16_t(r[7]));
+        r[2] = val;
+    }
+    // 0c87: cmp [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0c8a: jne 0ca2
+    if (!ZF)
+        AOT_GOTO(0x0ca2, L0ca2);
+    AOT_GOTO(0x0c8c, L0c8c);
+L0c8c:
+    AOT_BLOCK(0x0c8c, 4);
+    // 0c8c: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0c8f: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0c92: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0c93: call 1734
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0c96);
+    }
+    AOT_GOTO(0x1734, L1734);
+L0c96:
+    AOT_BLOCK(0x0c96, 3);
+    // 0c96: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0c99: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0c9b: jne 0ca2
+    if (!ZF)
+        AOT_GOTO(0x0ca2, L0ca2);
+    AOT_GOTO(0x0c9d, L0c9d);
+L0c9d:
+    AOT_BLOCK(0x0c9d, 2);
+    // 0c9d: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0ca0: jmp short 0cb2
+    AOT_GOTO(0x0cb2, L0cb2);
+L0ca2:
+    AOT_BLOCK(0x0ca2, 2);
+    // 0ca2: cmp byte [si], 2c
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 44);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0ca5: jne 0cac
+    if (!ZF)
+        AOT_GOTO(0x0cac, L0cac);
+    AOT_GOTO(0x0ca7, L0ca7);
+L0ca7:
+    AOT_BLOCK(0x0ca7, 3);
+    // 0ca7: mov di, si
+    {
+        r[7] = r[6];
+    }
+    // 0ca9: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0caa: jmp short 0c6f
+    AOT_GOTO(0x0c6f, L0c6f);
+L0cac:
+    AOT_BLOCK(0x0cac, 2);
+    // 0cac: mov di, si
+    {
+        r[7] = r[6];
+    }
+    // 0cae: jmp short 0c6f
+    AOT_GOTO(0x0c6f, L0c6f);
+L0cb0:
+    AOT_BLOCK(0x0cb0, 1);
+    // 0cb0: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0cb2, L0cb2);
+L0cb2:
+    AOT_BLOCK(0x0cb2, 1);
+    // 0cb2: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L0cb5:
+    AOT_BLOCK(0x0cb5, 4);
+    // 0cb5: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0cb6: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0cb8: sub sp, 4c
+    {
+        val = (dst = int16_t(r[4])) - (src = 76);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0cbb: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    AOT_GOTO(0x0cbc, L0cbc);
+L0cbc:
+    AOT_BLOCK(0x0cbc, 4);
+    // 0cbc: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0cbd: mov di, 0356
+    {
+        r[7] = 0x0356;
+    }
+    // 0cc0: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0cc3: call 05fa
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0cc6);
+    }
+    AOT_GOTO(0x05fa, L05fa);
+L0cc6:
+    AOT_BLOCK(0x0cc6, 4);
+    // 0cc6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0cc7: mov [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[0]);
+    }
+    // 0cca: cmp [0bcc], 0
+    {
+        a = 0x0bcc;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0ccf: je 0cd6
+    if (ZF)
+        AOT_GOTO(0x0cd6, L0cd6);
+    AOT_GOTO(0x0cd1, L0cd1);
+L0cd1:
+    AOT_BLOCK(0x0cd1, 1);
+    // 0cd1: mov [bp-4], 0dcc
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, 0x0dcc);
+    }
+    AOT_GOTO(0x0cd6, L0cd6);
+L0cd6:
+    AOT_BLOCK(0x0cd6, 2);
+    // 0cd6: cmp [bp-4], 0
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0cda: jne 0ce2
+    if (!ZF)
+        AOT_GOTO(0x0ce2, L0ce2);
+    AOT_GOTO(0x0cdc, L0cdc);
+L0cdc:
+    AOT_BLOCK(0x0cdc, 2);
+    // 0cdc: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 0cdf: jmp 0e0f
+    AOT_GOTO(0x0e0f, L0e0f);
+L0ce2:
+    AOT_BLOCK(0x0ce2, 2);
+    // 0ce2: lea ax, [bp-44]
+    {
+        a = uint16_t(r[5] - 68);
+        r[0] = a;
+    }
+    // 0ce5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x0ce6, L0ce6);
+L0ce6:
+    AOT_BLOCK(0x0ce6, 2);
+    // 0ce6: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0ce9: call 05a1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0cec);
+    }
+    AOT_GOTO(0x05a1, L05a1);
+L0cec:
+    AOT_BLOCK(0x0cec, 2);
+    // 0cec: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0ced: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0cee, L0cee);
+L0cee:
+    AOT_BLOCK(0x0cee, 2);
+    // 0cee: cmp [di], 0
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0cf1: je 0d0e
+    if (ZF)
+        AOT_GOTO(0x0d0e, L0d0e);
+    AOT_GOTO(0x0cf3, L0cf3);
+L0cf3:
+    AOT_BLOCK(0x0cf3, 2);
+    // 0cf3: test byte [di+e4], 8
+    {
+        a = uint16_t(r[7] + 228);
+        val = int8_t(RD8(a)) & 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0cf8: je 0d08
+    if (ZF)
+        AOT_GOTO(0x0d08, L0d08);
+    AOT_GOTO(0x0cfa, L0cfa);
+L0cfa:
+    AOT_BLOCK(0x0cfa, 3);
+    // 0cfa: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0cfd: push [di]
+    {
+        a = uint16_t(r[7]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0cff: call 1716
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0d02);
+    }
+    AOT_GOTO(0x1716, L1716);
+L0d02:
+    AOT_BLOCK(0x0d02, 4);
+    // 0d02: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0d03: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0d04: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0d06: je 0d0e
+    if (ZF)
+        AOT_GOTO(0x0d0e, L0d0e);
+    AOT_GOTO(0x0d08, L0d08);
+L0d08:
+    AOT_BLOCK(0x0d08, 2);
+    // 0d08: add di, 00e6
+    {
+        val = (dst = int16_t(r[7])) + (src = 230);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0d0c: jmp short 0cee
+    AOT_GOTO(0x0cee, L0cee);
+L0d0e:
+    AOT_BLOCK(0x0d0e, 2);
+    // 0d0e: cmp [di], 0
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0d11: jne 0d17
+    if (!ZF)
+        AOT_GOTO(0x0d17, L0d17);
+    AOT_GOTO(0x0d13, L0d13);
+L0d13:
+    AOT_BLOCK(0x0d13, 1);
+    // 0d13: mov di, [18e8]
+    {
+        a = 0x18e8;
+        r[7] = RD16(a);
+    }
+    AOT_GOTO(0x0d17, L0d17);
+L0d17:
+    AOT_BLOCK(0x0d17, 1);
+    // 0d17: lea bx, [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        r[3] = a;
+    }
+    AOT_GOTO(0x0d1a, L0d1a);
+L0d1a:
+    AOT_BLOCK(0x0d1a, 1);
+    // 0d1a: mov [bp-46], bx
+    {
+        a = uint16_t(r[5] - 70);
+        WR16(a, r[3]);
+    }
+    AOT_GOTO(0x0d1d, L0d1d);
+L0d1d:
+    AOT_BLOCK(0x0d1d, 3);
+    // 0d1d: mov bx, [bp-46]
+    {
+        a = uint16_t(r[5] - 70);
+        r[3] = RD16(a);
+    }
+    // 0d20: cmp [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0d23: jne 0d28
+    if (!ZF)
+        AOT_GOTO(0x0d28, L0d28);
+    AOT_GOTO(0x0d25, L0d25);
+L0d25:
+    AOT_BLOCK(0x0d25, 1);
+    // 0d25: jmp 0df4
+    AOT_GOTO(0x0df4, L0df4);
+L0d28:
+    AOT_BLOCK(0x0d28, 2);
+    // 0d28: mov [bp-4a], 0001
+    {
+        a = uint16_t(r[5] - 74);
+        WR16(a, 0x0001);
+    }
+    // 0d2d: mov si, 0004
+    {
+        r[6] = 0x0004;
+    }
+    AOT_GOTO(0x0d30, L0d30);
+L0d30:
+    AOT_BLOCK(0x0d30, 4);
+    // 0d30: mov bx, [bp-46]
+    {
+        a = uint16_t(r[5] - 70);
+        r[3] = RD16(a);
+    }
+    // 0d33: push [si]
+    {
+        a = uint16_t(r[6]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0d35: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0d37: call 1716
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0d3a);
+    }
+    AOT_GOTO(0x1716, L1716);
+L0d3a:
+    AOT_BLOCK(0x0d3a, 4);
+    // 0d3a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0d3b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0d3c: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0d3e: je 0d45
+    if (ZF)
+        AOT_GOTO(0x0d45, L0d45);
+    AOT_GOTO(0x0d40, L0d40);
+L0d40:
+    AOT_BLOCK(0x0d40, 2);
+    // 0d40: add si, c
+    {
+        val = (dst = int16_t(r[6])) + (src = 12);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0d43: jmp short 0d30
+    AOT_GOTO(0x0d30, L0d30);
+L0d45:
+    AOT_BLOCK(0x0d45, 2);
+    // 0d45: test byte [si+a], 4
+    {
+        a = uint16_t(r[6] + 10);
+        val = int8_t(RD8(a)) & 4;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0d49: je 0d4e
+    if (ZF)
+        AOT_GOTO(0x0d4e, L0d4e);
+    AOT_GOTO(0x0d4b, L0d4b);
+L0d4b:
+    AOT_BLOCK(0x0d4b, 1);
+    // 0d4b: jmp 0ded
+    AOT_GOTO(0x0ded, L0ded);
+L0d4e:
+    AOT_BLOCK(0x0d4e, 3);
+    // 0d4e: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0d51: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0d52: call 0c4e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0d55);
+    }
+    AOT_GOTO(0x0c4e, L0c4e);
+L0d55:
+    AOT_BLOCK(0x0d55, 4);
+    // 0d55: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0d56: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0d57: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0d59: jne 0d5e
+    if (!ZF)
+        AOT_GOTO(0x0d5e, L0d5e);
+    AOT_GOTO(0x0d5b, L0d5b);
+L0d5b:
+    AOT_BLOCK(0x0d5b, 1);
+    // 0d5b: jmp 0ded
+    AOT_GOTO(0x0ded, L0ded);
+L0d5e:
+    AOT_BLOCK(0x0d5e, 2);
+    // 0d5e: cmp [1240], 0
+    {
+        a = 0x1240;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0d63: je 0d7b
+    if (ZF)
+        AOT_GOTO(0x0d7b, L0d7b);
+    AOT_GOTO(0x0d65, L0d65);
+L0d65:
+    AOT_BLOCK(0x0d65, 2);
+    // 0d65: cmp [si+6], 0
+    {
+        a = uint16_t(r[6] + 6);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0d69: je 0d7b
+    if (ZF)
+        AOT_GOTO(0x0d7b, L0d7b);
+    AOT_GOTO(0x0d6b, L0d6b);
+L0d6b:
+    AOT_BLOCK(0x0d6b, 3);
+    // 0d6b: push [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0d6e: push [1240]
+    {
+        a = 0x1240;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0d72: call 1716
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0d75);
+    }
+    AOT_GOTO(0x1716, L1716);
+L0d75:
+    AOT_BLOCK(0x0d75, 4);
+    // 0d75: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0d76: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0d77: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0d79: je 0d80
+    if (ZF)
+        AOT_GOTO(0x0d80, L0d80);
+    AOT_GOTO(0x0d7b, L0d7b);
+L0d7b:
+    AOT_BLOCK(0x0d7b, 1);
+    // 0d7b: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    AOT_GOTO(0x0d7e, L0d7e);
+L0d7e:
+    AOT_BLOCK(0x0d7e, 1);
+    // 0d7e: jmp short 0d82
+    AOT_GOTO(0x0d82, L0d82);
+L0d80:
+    AOT_BLOCK(0x0d80, 1);
+    // 0d80: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0d82, L0d82);
+L0d82:
+    AOT_BLOCK(0x0d82, 4);
+    // 0d82: mov [bp-4c], ax
+    {
+        a = uint16_t(r[5] - 76);
+        WR16(a, r[0]);
+    }
+    // 0d85: push [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0d88: push [18ec]
+    {
+        a = 0x18ec;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0d8c: call 0c4e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0d8f);
+    }
+    AOT_GOTO(0x0c4e, L0c4e);
+L0d8f:
+    AOT_BLOCK(0x0d8f, 4);
+    // 0d8f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0d90: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0d91: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0d93: jne 0d9b
+    if (!ZF)
+        AOT_GOTO(0x0d9b, L0d9b);
+    AOT_GOTO(0x0d95, L0d95);
+L0d95:
+    AOT_BLOCK(0x0d95, 2);
+    // 0d95: cmp [bp-4c], 0
+    {
+        a = uint16_t(r[5] - 76);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0d99: jne 0daa
+    if (!ZF)
+        AOT_GOTO(0x0daa, L0daa);
+    AOT_GOTO(0x0d9b, L0d9b);
+L0d9b:
+    AOT_BLOCK(0x0d9b, 5);
+    // 0d9b: mov ax, 0dca
+    {
+        r[0] = 0x0dca;
+    }
+    // 0d9e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0d9f: lea ax, [bp-44]
+    {
+        a = uint16_t(r[5] - 68);
+        r[0] = a;
+    }
+    // 0da2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0da3: call 1710
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0da6);
+    }
+    AOT_GOTO(0x1710, L1710);
+L0da6:
+    AOT_BLOCK(0x0da6, 3);
+    // 0da6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0da7: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0da8: jmp short 0dad
+    AOT_GOTO(0x0dad, L0dad);
+L0daa:
+    AOT_BLOCK(0x0daa, 1);
+    // 0daa: mov ax, 18a8
+    {
+        r[0] = 0x18a8;
+    }
+    AOT_GOTO(0x0dad, L0dad);
+L0dad:
+    AOT_BLOCK(0x0dad, 12);
+    // 0dad: lea bx, [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        r[3] = a;
+    }
+    // 0db0: mov dx, [bp-46]
+    {
+        a = uint16_t(r[5] - 70);
+        r[2] = RD16(a);
+    }
+    // 0db3: sub dx, bx
+    {
+        val = (dst = int16_t(r[2])) - (src = int16_t(r[3]));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0db5: mov cx, 0020
+    {
+        r[1] = 0x0020;
+    }
+    // 0db8: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0db9: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 0dbb: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 0dbc: idiv cx
+    {
+        i32 = int32_t(uint32_t(r[2]) << 16 | r[0]);
+        src = int16_t(r[1]);
+        r[0] = i32 / src;
+        r[2] = i32 % src;
+    }
+    // 0dbe: push [bp-4a]
+    {
+        a = uint16_t(r[5] - 74);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0dc1: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0dc4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0dc5: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x0dc8, L0dc8);
+L0dc8:
+    AOT_BLOCK(0x0dc8, 2);
+    // 0dc8: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0dc9: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    AOT_GOTO(0x0dca, L0dca);
+L0dca:
+    AOT_BLOCK(0x0dca, 1);
+    // 0dca: call 0aa8
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0dcd);
+    }
+    AOT_GOTO(0x0aa8, L0aa8);
+L0dcd:
+    AOT_BLOCK(0x0dcd, 1);
+    // 0dcd: add sp, e
+    {
+        val = (dst = int16_t(r[4])) + (src = 14);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x0dd0, L0dd0);
+L0dd0:
+    AOT_BLOCK(0x0dd0, 8);
+    // 0dd0: mov [bp+4], ax
+    {
+        a = uint16_t(r[5] + 4);
+        WR16(a, r[0]);
+    }
+    // 0dd3: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 0dd5: mov [bp+6], dx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[2]);
+    }
+    // 0dd8: mov [bp-4a], dx
+    {
+        a = uint16_t(r[5] - 74);
+        WR16(a, r[2]);
+    }
+    // 0ddb: mov dx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        r[2] = RD16(a);
+    }
+    // 0dde: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 0de1: cmp [bp-4c], 0
+    {
+        a = uint16_t(r[5] - 76);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0de5: je 0df4
+    if (ZF)
+        AOT_GOTO(0x0df4, L0df4);
+    AOT_GOTO(0x0de7, L0de7);
+L0de7:
+    AOT_BLOCK(0x0de7, 2);
+    // 0de7: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0deb: je 0df4
+    if (ZF)
+        AOT_GOTO(0x0df4, L0df4);
+    AOT_GOTO(0x0ded, L0ded);
+L0ded:
+    AOT_BLOCK(0x0ded, 2);
+    // 0ded: add [bp-46], 20
+    {
+        a = uint16_t(r[5] - 70);
+        val = (dst = int16_t(RD16(a))) + (src = 32);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0df1: jmp 0d1d
+    AOT_GOTO(0x0d1d, L0d1d);
+L0df4:
+    AOT_BLOCK(0x0df4, 2);
+    // 0df4: cmp [bp+6], 0
+    {
+        a = uint16_t(r[5] + 6);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0df8: jne 0e0c
+    if (!ZF)
+        AOT_GOTO(0x0e0c, L0e0c);
+    AOT_GOTO(0x0dfa, L0dfa);
+L0dfa:
+    AOT_BLOCK(0x0dfa, 2);
+    // 0dfa: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0dfe: je 0e0c
+    if (ZF)
+        AOT_GOTO(0x0e0c, L0e0c);
+    AOT_GOTO(0x0e00, L0e00);
+L0e00:
+    AOT_BLOCK(0x0e00, 4);
+    // 0e00: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e03: mov ax, 164c
+    {
+        r[0] = 0x164c;
+    }
+    // 0e06: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0e07: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e0a);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0e0a:
+    AOT_BLOCK(0x0e0a, 2);
+    // 0e0a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e0b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0e0c, L0e0c);
+L0e0c:
+    AOT_BLOCK(0x0e0c, 1);
+    // 0e0c: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x0e0f, L0e0f);
+L0e0f:
+    AOT_BLOCK(0x0e0f, 1);
+    // 0e0f: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L0e12:
+    AOT_BLOCK(0x0e12, 10);
+    // 0e12: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0e13: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0e15: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0e16: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0e17: mov di, [bp+c]
+    {
+        a = uint16_t(r[5] + 12);
+        r[7] = RD16(a);
+    }
+    // 0e1a: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 0e1d: mov [bx], 0001
+    {
+        a = uint16_t(r[3]);
+        WR16(a, 0x0001);
+    }
+    // 0e21: push [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e24: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e27: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e2a);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0e2a:
+    AOT_BLOCK(0x0e2a, 5);
+    // 0e2a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e2b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e2c: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0e2d: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e30: call 1094
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e33);
+    }
+    AOT_GOTO(0x1094, L1094);
+L0e33:
+    AOT_BLOCK(0x0e33, 4);
+    // 0e33: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e34: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e35: cmp [bp+a], 0
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0e39: je 0e6c
+    if (ZF)
+        AOT_GOTO(0x0e6c, L0e6c);
+    AOT_GOTO(0x0e3b, L0e3b);
+L0e3b:
+    AOT_BLOCK(0x0e3b, 1);
+    // 0e3b: xor si, si
+    {
+        val = int16_t(r[6]) ^ int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0e3d, L0e3d);
+L0e3d:
+    AOT_BLOCK(0x0e3d, 1);
+    // 0e3d: cmp si, a
+    {
+        val = (dst = int16_t(r[6])) - (src = 10);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    AOT_GOTO(0x0e40, L0e40);
+L0e40:
+    AOT_BLOCK(0x0e40, 1);
+    // 0e40: jnl 0e6c
+    if (SF == OF)
+        AOT_GOTO(0x0e6c, L0e6c);
+    AOT_GOTO(0x0e42, L0e42);
+L0e42:
+    AOT_BLOCK(0x0e42, 7);
+    // 0e42: mov bx, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[3] = RD16(a);
+    }
+    // 0e45: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+    }
+    // 0e48: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0e4a: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0e4c: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+    }
+    // 0e4e: cmp [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0e51: je 0e6c
+    if (ZF)
+        AOT_GOTO(0x0e6c, L0e6c);
+    AOT_GOTO(0x0e53, L0e53);
+L0e53:
+    AOT_BLOCK(0x0e53, 8);
+    // 0e53: mov bx, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[3] = RD16(a);
+    }
+    // 0e56: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+    }
+    // 0e59: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0e5b: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0e5d: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0e5f: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e61: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e64: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e67);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0e67:
+    AOT_BLOCK(0x0e67, 4);
+    // 0e67: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e68: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e69: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0e6a: jmp short 0e3d
+    AOT_GOTO(0x0e3d, L0e3d);
+L0e6c:
+    AOT_BLOCK(0x0e6c, 2);
+    // 0e6c: test byte [di+a], 1
+    {
+        a = uint16_t(r[7] + 10);
+        val = int8_t(RD8(a)) & 1;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0e70: je 0e8d
+    if (ZF)
+        AOT_GOTO(0x0e8d, L0e8d);
+    AOT_GOTO(0x0e72, L0e72);
+L0e72:
+    AOT_BLOCK(0x0e72, 4);
+    // 0e72: mov ax, 0dd4
+    {
+        r[0] = 0x0dd4;
+    }
+    // 0e75: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0e76: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e79: call 1716
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e7c);
+    }
+    AOT_GOTO(0x1716, L1716);
+L0e7c:
+    AOT_BLOCK(0x0e7c, 4);
+    // 0e7c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e7d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e7e: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0e80: je 0e8d
+    if (ZF)
+        AOT_GOTO(0x0e8d, L0e8d);
+    AOT_GOTO(0x0e82, L0e82);
+L0e82:
+    AOT_BLOCK(0x0e82, 1);
+    // 0e82: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x0e85, L0e85);
+L0e85:
+    AOT_BLOCK(0x0e85, 2);
+    // 0e85: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e88: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e8b);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0e8b:
+    AOT_BLOCK(0x0e8b, 2);
+    // 0e8b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e8c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0e8d, L0e8d);
+L0e8d:
+    AOT_BLOCK(0x0e8d, 2);
+    // 0e8d: test byte [di+a], 2
+    {
+        a = uint16_t(r[7] + 10);
+        val = int8_t(RD8(a)) & 2;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0e91: je 0e9e
+    if (ZF)
+        AOT_GOTO(0x0e9e, L0e9e);
+    AOT_GOTO(0x0e93, L0e93);
+L0e93:
+    AOT_BLOCK(0x0e93, 3);
+    // 0e93: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e96: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e99: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e9c);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0e9c:
+    AOT_BLOCK(0x0e9c, 2);
+    // 0e9c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e9d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0e9e, L0e9e);
+L0e9e:
+    AOT_BLOCK(0x0e9e, 2);
+    // 0e9e: test byte [di+a], 40
+    {
+        a = uint16_t(r[7] + 10);
+        val = int8_t(RD8(a)) & 64;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0ea2: je 0ebb
+    if (ZF)
+        AOT_GOTO(0x0ebb, L0ebb);
+    AOT_GOTO(0x0ea4, L0ea4);
+L0ea4:
+    AOT_BLOCK(0x0ea4, 4);
+    // 0ea4: mov ax, 0dd0
+    {
+        r[0] = 0x0dd0;
+    }
+    // 0ea7: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0ea8: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0eab: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0eae);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0eae:
+    AOT_BLOCK(0x0eae, 3);
+    // 0eae: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0eaf: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0eb0: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x0eb3, L0eb3);
+L0eb3:
+    AOT_BLOCK(0x0eb3, 2);
+    // 0eb3: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0eb6: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0eb9);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0eb9:
+    AOT_BLOCK(0x0eb9, 2);
+    // 0eb9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0eba: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0ebb, L0ebb);
+L0ebb:
+    AOT_BLOCK(0x0ebb, 2);
+    // 0ebb: cmp [bp+a], 0
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0ebf: je 0ef2
+    if (ZF)
+        AOT_GOTO(0x0ef2, L0ef2);
+    AOT_GOTO(0x0ec1, L0ec1);
+L0ec1:
+    AOT_BLOCK(0x0ec1, 1);
+    // 0ec1: xor si, si
+    {
+        val = int16_t(r[6]) ^ int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0ec3, L0ec3);
+L0ec3:
+    AOT_BLOCK(0x0ec3, 2);
+    // 0ec3: cmp si, 5
+    {
+        val = (dst = int16_t(r[6])) - (src = 5);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0ec6: jnl 0ef2
+    if (SF == OF)
+        AOT_GOTO(0x0ef2, L0ef2);
+    AOT_GOTO(0x0ec8, L0ec8);
+L0ec8:
+    AOT_BLOCK(0x0ec8, 7);
+    // 0ec8: mov bx, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[3] = RD16(a);
+    }
+    // 0ecb: add bx, 16
+    {
+        val = (dst = int16_t(r[3])) + (src = 22);
+        r[3] = val;
+    }
+    // 0ece: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0ed0: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0ed2: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+    }
+    // 0ed4: cmp [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0ed7: je 0ef2
+    if (ZF)
+        AOT_GOTO(0x0ef2, L0ef2);
+    AOT_GOTO(0x0ed9, L0ed9);
+L0ed9:
+    AOT_BLOCK(0x0ed9, 8);
+    // 0ed9: mov bx, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[3] = RD16(a);
+    }
+    // 0edc: add bx, 16
+    {
+        val = (dst = int16_t(r[3])) + (src = 22);
+        r[3] = val;
+    }
+    // 0edf: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0ee1: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0ee3: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0ee5: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0ee7: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0eea: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0eed);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0eed:
+    AOT_BLOCK(0x0eed, 4);
+    // 0eed: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0eee: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0eef: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0ef0: jmp short 0ec3
+    AOT_GOTO(0x0ec3, L0ec3);
+L0ef2:
+    AOT_BLOCK(0x0ef2, 1);
+    // 0ef2: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L0ef5:
+    AOT_BLOCK(0x0ef5, 12);
+    // 0ef5: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0ef6: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0ef8: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0ef9: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0efa: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0efb: mov di, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[7] = RD16(a);
+    }
+    // 0efe: mov [bp-2], 1112
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, 0x1112);
+    }
+    // 0f03: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 0f06: mov [bx], 0001
+    {
+        a = uint16_t(r[3]);
+        WR16(a, 0x0001);
+    }
+    // 0f0a: push [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f0d: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f10: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0f13);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0f13:
+    AOT_BLOCK(0x0f13, 5);
+    // 0f13: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f14: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f15: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0f16: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f19: call 1094
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0f1c);
+    }
+    AOT_GOTO(0x1094, L1094);
+L0f1c:
+    AOT_BLOCK(0x0f1c, 6);
+    // 0f1c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f1d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f1e: mov ax, 0dda
+    {
+        r[0] = 0x0dda;
+    }
+    // 0f21: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0f22: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f25: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0f28);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0f28:
+    AOT_BLOCK(0x0f28, 5);
+    // 0f28: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f29: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f2a: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f2d: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f30: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0f33);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0f33:
+    AOT_BLOCK(0x0f33, 3);
+    // 0f33: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f34: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f35: xor si, si
+    {
+        val = int16_t(r[6]) ^ int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0f37, L0f37);
+L0f37:
+    AOT_BLOCK(0x0f37, 2);
+    // 0f37: cmp si, a
+    {
+        val = (dst = int16_t(r[6])) - (src = 10);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f3a: jnl 0f66
+    if (SF == OF)
+        AOT_GOTO(0x0f66, L0f66);
+    AOT_GOTO(0x0f3c, L0f3c);
+L0f3c:
+    AOT_BLOCK(0x0f3c, 7);
+    // 0f3c: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 0f3f: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+    }
+    // 0f42: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0f44: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0f46: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+    }
+    // 0f48: cmp [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f4b: je 0f66
+    if (ZF)
+        AOT_GOTO(0x0f66, L0f66);
+    AOT_GOTO(0x0f4d, L0f4d);
+L0f4d:
+    AOT_BLOCK(0x0f4d, 8);
+    // 0f4d: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 0f50: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+    }
+    // 0f53: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0f55: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0f57: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0f59: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f5b: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f5e: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0f61);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0f61:
+    AOT_BLOCK(0x0f61, 4);
+    // 0f61: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f62: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f63: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0f64: jmp short 0f37
+    AOT_GOTO(0x0f37, L0f37);
+L0f66:
+    AOT_BLOCK(0x0f66, 2);
+    // 0f66: test byte [di+a], 1
+    {
+        a = uint16_t(r[7] + 10);
+        val = int8_t(RD8(a)) & 1;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0f6a: je 0f77
+    if (ZF)
+        AOT_GOTO(0x0f77, L0f77);
+    AOT_GOTO(0x0f6c, L0f6c);
+L0f6c:
+    AOT_BLOCK(0x0f6c, 3);
+    // 0f6c: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f6f: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f72: call 0505
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0f75);
+    }
+    AOT_GOTO(0x0505, L0505);
+L0f75:
+    AOT_BLOCK(0x0f75, 2);
+    // 0f75: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f76: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0f77, L0f77);
+L0f77:
+    AOT_BLOCK(0x0f77, 2);
+    // 0f77: test byte [di+a], 2
+    {
+        a = uint16_t(r[7] + 10);
+        val = int8_t(RD8(a)) & 2;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0f7b: je 0f88
+    if (ZF)
+        AOT_GOTO(0x0f88, L0f88);
+    AOT_GOTO(0x0f7d, L0f7d);
+L0f7d:
+    AOT_BLOCK(0x0f7d, 3);
+    // 0f7d: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f80: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f83: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0f86);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0f86:
+    AOT_BLOCK(0x0f86, 2);
+    // 0f86: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f87: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0f88, L0f88);
+L0f88:
+    AOT_BLOCK(0x0f88, 1);
+    // 0f88: xor si, si
+    {
+        val = int16_t(r[6]) ^ int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0f8a, L0f8a);
+L0f8a:
+    AOT_BLOCK(0x0f8a, 2);
+    // 0f8a: cmp si, 5
+    {
+        val = (dst = int16_t(r[6])) - (src = 5);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f8d: jl 0f92
+    if (SF != OF)
+        AOT_GOTO(0x0f92, L0f92);
+    AOT_GOTO(0x0f8f, L0f8f);
+L0f8f:
+    AOT_BLOCK(0x0f8f, 1);
+    // 0f8f: jmp 1035
+    AOT_GOTO(0x1035, L1035);
+L0f92:
+    AOT_BLOCK(0x0f92, 7);
+    // 0f92: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 0f95: add bx, 16
+    {
+        val = (dst = int16_t(r[3])) + (src = 22);
+        r[3] = val;
+    }
+    // 0f98: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0f9a: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0f9c: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+    }
+    // 0f9e: cmp [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0fa1: jne 0fa6
+    if (!ZF)
+        AOT_GOTO(0x0fa6, L0fa6);
+    AOT_GOTO(0x0fa3, L0fa3);
+L0fa3:
+    AOT_BLOCK(0x0fa3, 1);
+    // 0fa3: jmp 1035
+    AOT_GOTO(0x1035, L1035);
+L0fa6:
+    AOT_BLOCK(0x0fa6, 8);
+    // 0fa6: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 0fa9: add bx, 16
+    {
+        val = (dst = int16_t(r[3])) + (src = 22);
+        r[3] = val;
+    }
+    // 0fac: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0fae: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0fb0: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+    }
+    // 0fb2: mov bx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[3] = RD16(a);
+    }
+    // 0fb4: cmp byte [bx], 2d
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 45);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0fb7: jne 0fee
+    if (!ZF)
+        AOT_GOTO(0x0fee, L0fee);
+    AOT_GOTO(0x0fb9, L0fb9);
+L0fb9:
+    AOT_BLOCK(0x0fb9, 8);
+    // 0fb9: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 0fbc: add bx, 16
+    {
+        val = (dst = int16_t(r[3])) + (src = 22);
+        r[3] = val;
+    }
+    // 0fbf: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0fc1: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0fc3: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+    }
+    // 0fc5: mov bx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[3] = RD16(a);
+    }
+    // 0fc7: cmp byte [bx+1], 6c
+    {
+        a = uint16_t(r[3] + 1);
+        val = (dst = int8_t(RD8(a))) - (src = 108);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0fcb: jne 0fee
+    if (!ZF)
+        AOT_GOTO(0x0fee, L0fee);
+    AOT_GOTO(0x0fcd, L0fcd);
+L0fcd:
+    AOT_BLOCK(0x0fcd, 9);
+    // 0fcd: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 0fd0: add bx, 16
+    {
+        val = (dst = int16_t(r[3])) + (src = 22);
+        r[3] = val;
+    }
+    // 0fd3: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0fd5: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0fd7: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+    }
+    // 0fd9: mov bx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[3] = RD16(a);
+    }
+    // 0fdb: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0fde: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 0fdf: call 0039
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0fe2);
+    }
+    AOT_GOTO(0x0039, L0039);
+L0fe2:
+    AOT_BLOCK(0x0fe2, 4);
+    // 0fe2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0fe3: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0fe4: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0fe7: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0fea);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L0fea:
+    AOT_BLOCK(0x0fea, 3);
+    // 0fea: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0feb: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0fec: jmp short 1031
+    AOT_GOTO(0x1031, L1031);
+L0fee:
+    AOT_BLOCK(0x0fee, 8);
+    // 0fee: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 0ff1: add bx, 16
+    {
+        val = (dst = int16_t(r[3])) + (src = 22);
+        r[3] = val;
+    }
+    // 0ff4: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0ff6: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0ff8: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+    }
+    // 0ffa: mov bx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[3] = RD16(a);
+    }
+    // 0ffc: cmp byte [bx], 2a
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 42);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0fff: je 1019
+    if (ZF)
+        AOT_GOTO(0x1019, L1019);
+    AOT_GOTO(0x1001, L1001);
+L1001:
+    AOT_BLOCK(0x1001, 8);
+    // 1001: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 1004: add bx, 16
+    {
+        val = (dst = int16_t(r[3])) + (src = 22);
+        r[3] = val;
+    }
+    // 1007: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 1009: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 100b: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 100d: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 100f: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1012: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1015);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L1015:
+    AOT_BLOCK(0x1015, 3);
+    // 1015: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1016: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1017: jmp short 1031
+    AOT_GOTO(0x1031, L1031);
+L1019:
+    AOT_BLOCK(0x1019, 2);
+    // 1019: cmp [0bca], 0
+    {
+        a = 0x0bca;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 101e: je 1031
+    if (ZF)
+        AOT_GOTO(0x1031, L1031);
+    AOT_GOTO(0x1020, L1020);
+L1020:
+    AOT_BLOCK(0x1020, 3);
+    // 1020: mov ax, 0dd6
+    {
+        r[0] = 0x0dd6;
+    }
+    // 1023: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1024: call 0039
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1027);
+    }
+    AOT_GOTO(0x0039, L0039);
+L1027:
+    AOT_BLOCK(0x1027, 4);
+    // 1027: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1028: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1029: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 102c: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x102f);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L102f:
+    AOT_BLOCK(0x102f, 2);
+    // 102f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1030: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x1031, L1031);
+L1031:
+    AOT_BLOCK(0x1031, 2);
+    // 1031: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1032: jmp 0f8a
+    AOT_GOTO(0x0f8a, L0f8a);
+L1035:
+    AOT_BLOCK(0x1035, 6);
+    // 1035: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1038: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 103a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 103b: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 103c: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 103f: call 0625
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1042);
+    }
+    AOT_GOTO(0x0625, L0625);
+L1042:
+    AOT_BLOCK(0x1042, 3);
+    // 1042: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 1045: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1047: jne 105c
+    if (!ZF)
+        AOT_GOTO(0x105c, L105c);
+    AOT_GOTO(0x1049, L1049);
+L1049:
+    AOT_BLOCK(0x1049, 2);
+    // 1049: cmp [bp+6], 0
+    {
+        a = uint16_t(r[5] + 6);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 104d: je 1056
+    if (ZF)
+        AOT_GOTO(0x1056, L1056);
+    AOT_GOTO(0x104f, L104f);
+L104f:
+    AOT_BLOCK(0x104f, 2);
+    // 104f: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1052: call 0470
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1055);
+    }
+    AOT_GOTO(0x0470, L0470);
+L1055:
+    AOT_BLOCK(0x1055, 1);
+    // 1055: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x1056, L1056);
+L1056:
+    AOT_BLOCK(0x1056, 1);
+    // 1056: mov [0bc2], 0001
+    {
+        a = 0x0bc2;
+        WR16(a, 0x0001);
+    }
+    AOT_GOTO(0x105c, L105c);
+L105c:
+    AOT_BLOCK(0x105c, 1);
+    // 105c: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L105f:
+    AOT_BLOCK(0x105f, 6);
+    // 105f: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1060: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1062: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1063: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1064: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 1067: mov si, 0001
+    {
+        r[6] = 0x0001;
+    }
+    AOT_GOTO(0x106a, L106a);
+L106a:
+    AOT_BLOCK(0x106a, 2);
+    // 106a: cmp [di], si
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 106c: jle 108d
+    if (ZF || SF != OF)
+        AOT_GOTO(0x108d, L108d);
+    AOT_GOTO(0x106e, L106e);
+L106e:
+    AOT_BLOCK(0x106e, 6);
+    // 106e: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 1070: lea bx, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[3] = a;
+    }
+    // 1073: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 1075: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1077: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1079: call 1428
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x107c);
+    }
+    AOT_GOTO(0x1428, L1428);
+L107c:
+    AOT_BLOCK(0x107c, 8);
+    // 107c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 107d: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 107f: lea bx, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[3] = a;
+    }
+    // 1082: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 1084: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1086: mov [bx], 0000
+    {
+        a = uint16_t(r[3]);
+        WR16(a, 0x0000);
+    }
+    // 108a: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 108b: jmp short 106a
+    AOT_GOTO(0x106a, L106a);
+L108d:
+    AOT_BLOCK(0x108d, 2);
+    // 108d: mov [di], 0000
+    {
+        a = uint16_t(r[7]);
+        WR16(a, 0x0000);
+    }
+    // 1091: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L1094:
+    AOT_BLOCK(0x1094, 6);
+    // 1094: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1095: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1097: sub sp, 46
+    {
+        val = (dst = int16_t(r[4])) - (src = 70);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 109a: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 109b: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 109c: mov [bp-2], 0000
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x10a1, L10a1);
+L10a1:
+    AOT_BLOCK(0x10a1, 3);
+    // 10a1: mov dx, [177a]
+    {
+        a = 0x177a;
+        r[2] = RD16(a);
+    }
+    // 10a5: cmp [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 10a8: jl 10ad
+    if (SF != OF)
+        AOT_GOTO(0x10ad, L10ad);
+    AOT_GOTO(0x10aa, L10aa);
+L10aa:
+    AOT_BLOCK(0x10aa, 1);
+    // 10aa: jmp 11c2
+    AOT_GOTO(0x11c2, L11c2);
+L10ad:
+    AOT_BLOCK(0x10ad, 2);
+    // 10ad: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 10b0: mov si, [bx+8]
+    {
+        a = uint16_t(r[3] + 8);
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x10b3, L10b3);
+L10b3:
+    AOT_BLOCK(0x10b3, 2);
+    // 10b3: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 10b6: jne 10bb
+    if (!ZF)
+        AOT_GOTO(0x10bb, L10bb);
+    AOT_GOTO(0x10b8, L10b8);
+L10b8:
+    AOT_BLOCK(0x10b8, 1);
+    // 10b8: jmp 11bc
+    AOT_GOTO(0x11bc, L11bc);
+L10bb:
+    AOT_BLOCK(0x10bb, 5);
+    // 10bb: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 10be: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 10c0: mov bx, [bx+177c]
+    {
+        a = uint16_t(r[3] + 6012);
+        r[3] = RD16(a);
+    }
+    // 10c4: add bx, 1
+    {
+        val = (dst = int16_t(r[3])) + (src = 1);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 10c7: mov [bp-46], bx
+    {
+        a = uint16_t(r[5] - 70);
+        WR16(a, r[3]);
+    }
+    AOT_GOTO(0x10ca, L10ca);
+L10ca:
+    AOT_BLOCK(0x10ca, 2);
+    // 10ca: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 10cd: je 10e4
+    if (ZF)
+        AOT_GOTO(0x10e4, L10e4);
+    AOT_GOTO(0x10cf, L10cf);
+L10cf:
+    AOT_BLOCK(0x10cf, 8);
+    // 10cf: mov al, [si]
+    {
+        a = uint16_t(r[6]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 10d1: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 10d2: mov bx, [bp-46]
+    {
+        a = uint16_t(r[5] - 70);
+        r[3] = RD16(a);
+    }
+    // 10d5: mov cx, ax
+    {
+        r[1] = r[0];
+    }
+    // 10d7: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 10d9: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 10da: cmp cx, ax
+    {
+        val = (dst = int16_t(r[1])) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 10dc: jne 10e4
+    if (!ZF)
+        AOT_GOTO(0x10e4, L10e4);
+    AOT_GOTO(0x10de, L10de);
+L10de:
+    AOT_BLOCK(0x10de, 3);
+    // 10de: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 10df: inc [bp-46]
+    {
+        a = uint16_t(r[5] - 70);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 10e2: jmp short 10ca
+    AOT_GOTO(0x10ca, L10ca);
+L10e4:
+    AOT_BLOCK(0x10e4, 2);
+    // 10e4: cmp byte [si], 2c
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 44);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 10e7: je 10ee
+    if (ZF)
+        AOT_GOTO(0x10ee, L10ee);
+    AOT_GOTO(0x10e9, L10e9);
+L10e9:
+    AOT_BLOCK(0x10e9, 2);
+    // 10e9: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 10ec: jne 110d
+    if (!ZF)
+        AOT_GOTO(0x110d, L110d);
+    AOT_GOTO(0x10ee, L10ee);
+L10ee:
+    AOT_BLOCK(0x10ee, 3);
+    // 10ee: mov bx, [bp-46]
+    {
+        a = uint16_t(r[5] - 70);
+        r[3] = RD16(a);
+    }
+    // 10f1: cmp byte [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 10f4: je 10f9
+    if (ZF)
+        AOT_GOTO(0x10f9, L10f9);
+    AOT_GOTO(0x10f6, L10f6);
+L10f6:
+    AOT_BLOCK(0x10f6, 1);
+    // 10f6: jmp 11bc
+    AOT_GOTO(0x11bc, L11bc);
+L10f9:
+    AOT_BLOCK(0x10f9, 5);
+    // 10f9: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 10fc: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 10fe: push [bx+177c]
+    {
+        a = uint16_t(r[3] + 6012);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1102: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1105: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1108);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L1108:
+    AOT_BLOCK(0x1108, 3);
+    // 1108: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1109: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 110a: jmp 11bc
+    AOT_GOTO(0x11bc, L11bc);
+L110d:
+    AOT_BLOCK(0x110d, 1);
+    // 110d: cmp byte [si], 2a
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 42);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    AOT_GOTO(0x1110, L1110);
+L1110:
+    AOT_BLOCK(0x1110, 1);
+    // 1110: jne 1178
+    if (!ZF)
+        AOT_GOTO(0x1178, L1178);
+    AOT_GOTO(0x1112, L1112);
+L1112:
+    AOT_BLOCK(0x1112, 4);
+    // 1112: lea di, [bp-42]
+    {
+        a = uint16_t(r[5] - 66);
+        r[7] = a;
+    }
+    // 1115: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 1116: cmp byte [si], 3d
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 61);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1119: je 112f
+    if (ZF)
+        AOT_GOTO(0x112f, L112f);
+    AOT_GOTO(0x111b, L111b);
+L111b:
+    AOT_BLOCK(0x111b, 5);
+    // 111b: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 111e: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 1120: push [bx+177c]
+    {
+        a = uint16_t(r[3] + 6012);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1124: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1127: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x112a);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L112a:
+    AOT_BLOCK(0x112a, 3);
+    // 112a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 112b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 112c: jmp 11bc
+    AOT_GOTO(0x11bc, L11bc);
+L112f:
+    AOT_BLOCK(0x112f, 4);
+    // 112f: mov byte [di], 2d
+    {
+        a = uint16_t(r[7]);
+        WR8(a, 45);
+    }
+    // 1132: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+    }
+    // 1133: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1136: je 1139
+    if (ZF)
+        AOT_GOTO(0x1139, L1139);
+    AOT_GOTO(0x1138, L1138);
+L1138:
+    AOT_BLOCK(0x1138, 1);
+    // 1138: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1139, L1139);
+L1139:
+    AOT_BLOCK(0x1139, 2);
+    // 1139: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 113c: je 1150
+    if (ZF)
+        AOT_GOTO(0x1150, L1150);
+    AOT_GOTO(0x113e, L113e);
+L113e:
+    AOT_BLOCK(0x113e, 2);
+    // 113e: cmp byte [si], 2c
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 44);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1141: je 1150
+    if (ZF)
+        AOT_GOTO(0x1150, L1150);
+    AOT_GOTO(0x1143, L1143);
+L1143:
+    AOT_BLOCK(0x1143, 2);
+    // 1143: cmp byte [si], 2a
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 42);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1146: je 1150
+    if (ZF)
+        AOT_GOTO(0x1150, L1150);
+    AOT_GOTO(0x1148, L1148);
+L1148:
+    AOT_BLOCK(0x1148, 5);
+    // 1148: mov al, [si]
+    {
+        a = uint16_t(r[6]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 114a: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 114b: mov [di], al
+    {
+        a = uint16_t(r[7]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 114d: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 114e: jmp short 1139
+    AOT_GOTO(0x1139, L1139);
+L1150:
+    AOT_BLOCK(0x1150, 2);
+    // 1150: cmp byte [si], 2a
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 42);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1153: jne 1167
+    if (!ZF)
+        AOT_GOTO(0x1167, L1167);
+    AOT_GOTO(0x1155, L1155);
+L1155:
+    AOT_BLOCK(0x1155, 3);
+    // 1155: mov bx, [bp-46]
+    {
+        a = uint16_t(r[5] - 70);
+        r[3] = RD16(a);
+    }
+    // 1158: cmp byte [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 115b: je 1167
+    if (ZF)
+        AOT_GOTO(0x1167, L1167);
+    AOT_GOTO(0x115d, L115d);
+L115d:
+    AOT_BLOCK(0x115d, 5);
+    // 115d: inc [bp-46]
+    {
+        a = uint16_t(r[5] - 70);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1160: mov cl, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1162: mov [di], cl
+    {
+        a = uint16_t(r[7]);
+        WR8(a, uint8_t(r[1]));
+    }
+    // 1164: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1165: jmp short 1155
+    AOT_GOTO(0x1155, L1155);
+L1167:
+    AOT_BLOCK(0x1167, 5);
+    // 1167: mov byte [di], 0
+    {
+        a = uint16_t(r[7]);
+        WR8(a, 0);
+    }
+    // 116a: lea ax, [bp-42]
+    {
+        a = uint16_t(r[5] - 66);
+        r[0] = a;
+    }
+    // 116d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 116e: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1171: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1174);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L1174:
+    AOT_BLOCK(0x1174, 3);
+    // 1174: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1175: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1176: jmp short 11bc
+    AOT_GOTO(0x11bc, L11bc);
+L1178:
+    AOT_BLOCK(0x1178, 2);
+    // 1178: cmp byte [si], 3d
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 61);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 117b: jne 11a8
+    if (!ZF)
+        AOT_GOTO(0x11a8, L11a8);
+    AOT_GOTO(0x117d, L117d);
+L117d:
+    AOT_BLOCK(0x117d, 4);
+    // 117d: lea di, [bp-42]
+    {
+        a = uint16_t(r[5] - 66);
+        r[7] = a;
+    }
+    // 1180: mov byte [di], 2d
+    {
+        a = uint16_t(r[7]);
+        WR8(a, 45);
+    }
+    // 1183: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+    }
+    // 1184: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1185, L1185);
+L1185:
+    AOT_BLOCK(0x1185, 2);
+    // 1185: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1188: je 1197
+    if (ZF)
+        AOT_GOTO(0x1197, L1197);
+    AOT_GOTO(0x118a, L118a);
+L118a:
+    AOT_BLOCK(0x118a, 2);
+    // 118a: cmp byte [si], 2c
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 44);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 118d: je 1197
+    if (ZF)
+        AOT_GOTO(0x1197, L1197);
+    AOT_GOTO(0x118f, L118f);
+L118f:
+    AOT_BLOCK(0x118f, 5);
+    // 118f: mov al, [si]
+    {
+        a = uint16_t(r[6]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1191: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 1192: mov [di], al
+    {
+        a = uint16_t(r[7]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 1194: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1195: jmp short 1185
+    AOT_GOTO(0x1185, L1185);
+L1197:
+    AOT_BLOCK(0x1197, 5);
+    // 1197: mov byte [di], 0
+    {
+        a = uint16_t(r[7]);
+        WR8(a, 0);
+    }
+    // 119a: lea ax, [bp-42]
+    {
+        a = uint16_t(r[5] - 66);
+        r[0] = a;
+    }
+    // 119d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 119e: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 11a1: call 04c7
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x11a4);
+    }
+    AOT_GOTO(0x04c7, L04c7);
+L11a4:
+    AOT_BLOCK(0x11a4, 3);
+    // 11a4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 11a5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 11a6: jmp short 11bc
+    AOT_GOTO(0x11bc, L11bc);
+L11a8:
+    AOT_BLOCK(0x11a8, 2);
+    // 11a8: cmp byte [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 11ab: jne 11b0
+    if (!ZF)
+        AOT_GOTO(0x11b0, L11b0);
+    AOT_GOTO(0x11ad, L11ad);
+L11ad:
+    AOT_BLOCK(0x11ad, 1);
+    // 11ad: jmp 10b3
+    AOT_GOTO(0x10b3, L10b3);
+L11b0:
+    AOT_BLOCK(0x11b0, 4);
+    // 11b0: mov al, [si]
+    {
+        a = uint16_t(r[6]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 11b2: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 11b3: cmp al, 2c
+    {
+        val = (dst = int8_t(r[0])) - (src = 44);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 11b5: jne 11ba
+    if (!ZF)
+        AOT_GOTO(0x11ba, L11ba);
+    AOT_GOTO(0x11b7, L11b7);
+L11b7:
+    AOT_BLOCK(0x11b7, 1);
+    // 11b7: jmp 10b3
+    AOT_GOTO(0x10b3, L10b3);
+L11ba:
+    AOT_BLOCK(0x11ba, 1);
+    // 11ba: jmp short 11a8
+    AOT_GOTO(0x11a8, L11a8);
+L11bc:
+    AOT_BLOCK(0x11bc, 2);
+    // 11bc: inc [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 11bf: jmp 10a1
+    AOT_GOTO(0x10a1, L10a1);
+L11c2:
+    AOT_BLOCK(0x11c2, 1);
+    // 11c2: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L11c5:
+    AOT_BLOCK(0x11c5, 4);
+    // 11c5: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 11c6: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 11c8: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 11c9: mov si, [0dde]
+    {
+        a = 0x0dde;
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x11cd, L11cd);
+L11cd:
+    AOT_BLOCK(0x11cd, 2);
+    // 11cd: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 11ce: jl 11dc
+    if (SF != OF)
+        AOT_GOTO(0x11dc, L11dc);
+    AOT_GOTO(0x11d0, L11d0);
+L11d0:
+    AOT_BLOCK(0x11d0, 4);
+    // 11d0: mov bx, si
+    {
+        r[3] = r[6];
+    }
+    // 11d2: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 11d4: mov bx, [bx+18f2]
+    {
+        a = uint16_t(r[3] + 6386);
+        r[3] = RD16(a);
+    }
+    // 11d8: call bx
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x11da);
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L11da:
+    AOT_BLOCK(0x11da, 1);
+    // 11da: jmp short 11cd
+    AOT_GOTO(0x11cd, L11cd);
+L11dc:
+    AOT_BLOCK(0x11dc, 1);
+    // 11dc: jmp 1d33
+    AOT_GOTO(0x1d33, L1d33);
+L11df:
+    AOT_BLOCK(0x11df, 3);
+    // 11df: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 11e0: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 11e2: call 11c5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x11e5);
+    }
+    AOT_GOTO(0x11c5, L11c5);
+L11e5:
+    AOT_BLOCK(0x11e5, 2);
+    // 11e5: cmp [0de0], 0
+    {
+        a = 0x0de0;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 11ea: je 11f2
+    if (ZF)
+        AOT_GOTO(0x11f2, L11f2);
+    AOT_GOTO(0x11ec, L11ec);
+L11ec:
+    AOT_BLOCK(0x11ec, 2);
+    // 11ec: mov bx, [0de0]
+    {
+        a = 0x0de0;
+        r[3] = RD16(a);
+    }
+    // 11f0: call bx
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x11f2);
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L11f2:
+    AOT_BLOCK(0x11f2, 2);
+    // 11f2: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 11f5: call 16a9
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x11f8);
+    }
+    AOT_GOTO(0x16a9, L16a9);
+L11f8:
+    AOT_BLOCK(0x11f8, 2);
+    // 11f8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 11f9: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L11fc:
+    AOT_BLOCK(0x11fc, 7);
+    // 11fc: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 11fd: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 11ff: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1200: mov bx, [10dc]
+    {
+        a = 0x10dc;
+        r[3] = RD16(a);
+    }
+    // 1204: add bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(r[3])) + (src = int16_t(RD16(a)));
+        r[3] = val;
+    }
+    // 1207: cmp [10dc], bx
+    {
+        a = 0x10dc;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[3]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 120b: jnbe 1224
+    if (!(CF || ZF))
+        AOT_GOTO(0x1224, L1224);
+    AOT_GOTO(0x120d, L120d);
+L120d:
+    AOT_BLOCK(0x120d, 7);
+    // 120d: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1210: add dx, [10dc]
+    {
+        a = 0x10dc;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 1214: add dx, 03ff
+    {
+        val = (dst = int16_t(r[2])) + (src = 1023);
+        r[2] = val;
+    }
+    // 1218: and dx, fc00
+    {
+        val = int16_t(r[2]) & -1024;
+        r[2] = val;
+    }
+    // 121c: mov si, dx
+    {
+        r[6] = r[2];
+    }
+    // 121e: cmp [10dc], dx
+    {
+        a = 0x10dc;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1222: jbe 122e
+    if (CF || ZF)
+        AOT_GOTO(0x122e, L122e);
+    AOT_GOTO(0x1224, L1224);
+L1224:
+    AOT_BLOCK(0x1224, 3);
+    // 1224: mov [0de4], 000c
+    {
+        a = 0x0de4;
+        WR16(a, 0x000c);
+    }
+    // 122a: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 122c: jmp short 1256
+    AOT_GOTO(0x1256, L1256);
+L122e:
+    AOT_BLOCK(0x122e, 2);
+    // 122e: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 122f: call 14f2
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1232);
+    }
+    AOT_GOTO(0x14f2, L14f2);
+L1232:
+    AOT_BLOCK(0x1232, 3);
+    // 1232: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1233: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1235: je 123b
+    if (ZF)
+        AOT_GOTO(0x123b, L123b);
+    AOT_GOTO(0x1237, L1237);
+L1237:
+    AOT_BLOCK(0x1237, 2);
+    // 1237: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1239: jmp short 1256
+    AOT_GOTO(0x1256, L1256);
+L123b:
+    AOT_BLOCK(0x123b, 2);
+    // 123b: mov bx, [10dc]
+    {
+        a = 0x10dc;
+        r[3] = RD16(a);
+    }
+    // 123f: mov [bx-2], si
+    {
+        a = uint16_t(r[3] - 2);
+        WR16(a, r[6]);
+    }
+    AOT_GOTO(0x1242, L1242);
+L1242:
+    AOT_BLOCK(0x1242, 3);
+    // 1242: mov [si-2], 0000
+    {
+        a = uint16_t(r[6] - 2);
+        WR16(a, 0x0000);
+    }
+    // 1247: push [10dc]
+    {
+        a = 0x10dc;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 124b: call 1428
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x124e);
+    }
+    AOT_GOTO(0x1428, L1428);
+L124e:
+    AOT_BLOCK(0x124e, 3);
+    // 124e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 124f: mov [10dc], si
+    {
+        a = 0x10dc;
+        WR16(a, r[6]);
+    }
+    // 1253: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    AOT_GOTO(0x1256, L1256);
+L1256:
+    AOT_BLOCK(0x1256, 1);
+    // 1256: jmp 1d33
+    AOT_GOTO(0x1d33, L1d33);
+L1259:
+    AOT_BLOCK(0x1259, 7);
+    // 1259: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 125a: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 125c: sub sp, c
+    {
+        val = (dst = int16_t(r[4])) - (src = 12);
+        r[4] = val;
+    }
+    // 125f: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1260: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1261: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1265: jne 126c
+    if (!ZF)
+        AOT_GOTO(0x126c, L126c);
+    AOT_GOTO(0x1267, L1267);
+L1267:
+    AOT_BLOCK(0x1267, 2);
+    // 1267: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1269: jmp 1339
+    AOT_GOTO(0x1339, L1339);
+L126c:
+    AOT_BLOCK(0x126c, 1);
+    // 126c: mov [bp-c], 0000
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x1271, L1271);
+L1271:
+    AOT_BLOCK(0x1271, 2);
+    // 1271: cmp [bp-c], 2
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) - (src = 2);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1275: jb 127a
+    if (CF)
+        AOT_GOTO(0x127a, L127a);
+    AOT_GOTO(0x1277, L1277);
+L1277:
+    AOT_BLOCK(0x1277, 1);
+    // 1277: jmp 1337
+    AOT_GOTO(0x1337, L1337);
+L127a:
+    AOT_BLOCK(0x127a, 3);
+    // 127a: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 127d: inc dx
+    {
+        val = int16_t(r[2]) + 1;
+        r[2] = val;
+        AF = !(val & 15);
+    }
+    // 127e: and dx, fffe
+    {
+        val = int16_t(r[2]) & -2;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1282, L1282);
+L1282:
+    AOT_BLOCK(0x1282, 4);
+    // 1282: add dx, 2
+    {
+        val = (dst = int16_t(r[2])) + (src = 2);
+        r[2] = val;
+    }
+    // 1285: mov [bp-a], dx
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, r[2]);
+    }
+    // 1288: cmp dx, 4
+    {
+        val = (dst = int16_t(r[2])) - (src = 4);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 128b: jnb 1298
+    if (!CF)
+        AOT_GOTO(0x1298, L1298);
+    AOT_GOTO(0x128d, L128d);
+L128d:
+    AOT_BLOCK(0x128d, 3);
+    // 128d: mov [0de4], 000c
+    {
+        a = 0x0de4;
+        WR16(a, 0x000c);
+    }
+    // 1293: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1295: jmp 1339
+    AOT_GOTO(0x1339, L1339);
+L1298:
+    AOT_BLOCK(0x1298, 2);
+    // 1298: cmp [10da], 0
+    {
+        a = 0x10da;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 129d: jne 12cc
+    if (!ZF)
+        AOT_GOTO(0x12cc, L12cc);
+    AOT_GOTO(0x129f, L129f);
+L129f:
+    AOT_BLOCK(0x129f, 3);
+    // 129f: mov ax, 0004
+    {
+        r[0] = 0x0004;
+    }
+    // 12a2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 12a3: call 152d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x12a6);
+    }
+    AOT_GOTO(0x152d, L152d);
+L12a6:
+    AOT_BLOCK(0x12a6, 4);
+    // 12a6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 12a7: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 12a9: cmp ax, ffff
+    {
+        val = (dst = int16_t(r[0])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 12ac: jne 12b3
+    if (!ZF)
+        AOT_GOTO(0x12b3, L12b3);
+    AOT_GOTO(0x12ae, L12ae);
+L12ae:
+    AOT_BLOCK(0x12ae, 2);
+    // 12ae: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12b0: jmp 1339
+    AOT_GOTO(0x1339, L1339);
+L12b3:
+    AOT_BLOCK(0x12b3, 8);
+    // 12b3: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 12b5: inc dx
+    {
+        val = int16_t(r[2]) + 1;
+        r[2] = val;
+    }
+    // 12b6: and dx, fffe
+    {
+        val = int16_t(r[2]) & -2;
+        r[2] = val;
+    }
+    // 12ba: mov si, dx
+    {
+        r[6] = r[2];
+    }
+    // 12bc: add si, 2
+    {
+        val = (dst = int16_t(r[6])) + (src = 2);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 12bf: mov [10da], si
+    {
+        a = 0x10da;
+        WR16(a, r[6]);
+    }
+    // 12c3: mov [10dc], si
+    {
+        a = 0x10dc;
+        WR16(a, r[6]);
+    }
+    // 12c7: mov [si-2], 0000
+    {
+        a = uint16_t(r[6] - 2);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x12cc, L12cc);
+L12cc:
+    AOT_BLOCK(0x12cc, 2);
+    // 12cc: mov [bp-2], 0000
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, 0x0000);
+    }
+    // 12d1: mov si, [10de]
+    {
+        a = 0x10de;
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x12d5, L12d5);
+L12d5:
+    AOT_BLOCK(0x12d5, 2);
+    // 12d5: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12d7: je 1326
+    if (ZF)
+        AOT_GOTO(0x1326, L1326);
+    AOT_GOTO(0x12d9, L12d9);
+L12d9:
+    AOT_BLOCK(0x12d9, 7);
+    // 12d9: mov dx, [si-2]
+    {
+        a = uint16_t(r[6] - 2);
+        r[2] = RD16(a);
+    }
+    // 12dc: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 12df: mov dx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[2] = RD16(a);
+    }
+    // 12e2: add dx, si
+    {
+        val = (dst = int16_t(r[2])) + (src = int16_t(r[6]));
+        r[2] = val;
+    }
+    // 12e4: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 12e6: cmp [bp-6], di
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[7]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 12e9: jb 131f
+    if (CF)
+        AOT_GOTO(0x131f, L131f);
+    AOT_GOTO(0x12eb, L12eb);
+L12eb:
+    AOT_BLOCK(0x12eb, 2);
+    // 12eb: cmp di, si
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 12ed: jbe 131f
+    if (CF || ZF)
+        AOT_GOTO(0x131f, L131f);
+    AOT_GOTO(0x12ef, L12ef);
+L12ef:
+    AOT_BLOCK(0x12ef, 3);
+    // 12ef: lea bx, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[3] = a;
+    }
+    // 12f2: cmp [bp-6], bx
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[3]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 12f5: jbe 1306
+    if (CF || ZF)
+        AOT_GOTO(0x1306, L1306);
+    AOT_GOTO(0x12f7, L12f7);
+L12f7:
+    AOT_BLOCK(0x12f7, 6);
+    // 12f7: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 12fa: mov [di-2], dx
+    {
+        a = uint16_t(r[7] - 2);
+        WR16(a, r[2]);
+    }
+    // 12fd: mov [si-2], di
+    {
+        a = uint16_t(r[6] - 2);
+        WR16(a, r[7]);
+    }
+    // 1300: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1302: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    // 1304: mov [si], di
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[7]);
+    }
+    AOT_GOTO(0x1306, L1306);
+L1306:
+    AOT_BLOCK(0x1306, 2);
+    // 1306: cmp [bp-2], 0
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 130a: je 1315
+    if (ZF)
+        AOT_GOTO(0x1315, L1315);
+    AOT_GOTO(0x130c, L130c);
+L130c:
+    AOT_BLOCK(0x130c, 4);
+    // 130c: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 130e: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 1311: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 1313: jmp short 131b
+    AOT_GOTO(0x131b, L131b);
+L1315:
+    AOT_BLOCK(0x1315, 2);
+    // 1315: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1317: mov [10de], dx
+    {
+        a = 0x10de;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x131b, L131b);
+L131b:
+    AOT_BLOCK(0x131b, 2);
+    // 131b: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 131d: jmp short 1339
+    AOT_GOTO(0x1339, L1339);
+L131f:
+    AOT_BLOCK(0x131f, 3);
+    // 131f: mov [bp-2], si
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[6]);
+    }
+    // 1322: mov si, [si]
+    {
+        a = uint16_t(r[6]);
+        r[6] = RD16(a);
+    }
+    // 1324: jmp short 12d5
+    AOT_GOTO(0x12d5, L12d5);
+L1326:
+    AOT_BLOCK(0x1326, 2);
+    // 1326: push [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1329: call 11fc
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x132c);
+    }
+    AOT_GOTO(0x11fc, L11fc);
+L132c:
+    AOT_BLOCK(0x132c, 3);
+    // 132c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 132d: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 132f: je 1337
+    if (ZF)
+        AOT_GOTO(0x1337, L1337);
+    AOT_GOTO(0x1331, L1331);
+L1331:
+    AOT_BLOCK(0x1331, 2);
+    // 1331: inc [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1334: jmp 1271
+    AOT_GOTO(0x1271, L1271);
+L1337:
+    AOT_BLOCK(0x1337, 1);
+    // 1337: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1339, L1339);
+L1339:
+    AOT_BLOCK(0x1339, 1);
+    // 1339: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L1428:
+    AOT_BLOCK(0x1428, 9);
+    // 1428: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1429: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 142b: sub sp, 6
+    {
+        val = (dst = int16_t(r[4])) - (src = 6);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 142e: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 142f: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1430: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1433: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 1436: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1438: je 149b
+    if (ZF)
+        AOT_GOTO(0x149b, L149b);
+    AOT_GOTO(0x143a, L143a);
+L143a:
+    AOT_BLOCK(0x143a, 2);
+    // 143a: xor di, di
+    {
+        val = int16_t(r[7]) ^ int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 143c: mov si, [10de]
+    {
+        a = 0x10de;
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x1440, L1440);
+L1440:
+    AOT_BLOCK(0x1440, 2);
+    // 1440: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1442: je 144f
+    if (ZF)
+        AOT_GOTO(0x144f, L144f);
+    AOT_GOTO(0x1444, L1444);
+L1444:
+    AOT_BLOCK(0x1444, 2);
+    // 1444: cmp [bp-6], si
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1447: jb 144f
+    if (CF)
+        AOT_GOTO(0x144f, L144f);
+    AOT_GOTO(0x1449, L1449);
+L1449:
+    AOT_BLOCK(0x1449, 3);
+    // 1449: mov di, si
+    {
+        r[7] = r[6];
+    }
+    // 144b: mov si, [si]
+    {
+        a = uint16_t(r[6]);
+        r[6] = RD16(a);
+    }
+    // 144d: jmp short 1440
+    AOT_GOTO(0x1440, L1440);
+L144f:
+    AOT_BLOCK(0x144f, 4);
+    // 144f: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 1452: mov [bx], si
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[6]);
+    }
+    // 1454: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1456: je 145f
+    if (ZF)
+        AOT_GOTO(0x145f, L145f);
+    AOT_GOTO(0x1458, L1458);
+L1458:
+    AOT_BLOCK(0x1458, 3);
+    // 1458: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 145b: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    // 145d: jmp short 1466
+    AOT_GOTO(0x1466, L1466);
+L145f:
+    AOT_BLOCK(0x145f, 2);
+    // 145f: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1462: mov [10de], dx
+    {
+        a = 0x10de;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1466, L1466);
+L1466:
+    AOT_BLOCK(0x1466, 2);
+    // 1466: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1468: je 147f
+    if (ZF)
+        AOT_GOTO(0x147f, L147f);
+    AOT_GOTO(0x146a, L146a);
+L146a:
+    AOT_BLOCK(0x146a, 3);
+    // 146a: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 146d: cmp [bx-2], si
+    {
+        a = uint16_t(r[3] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1470: jne 147f
+    if (!ZF)
+        AOT_GOTO(0x147f, L147f);
+    AOT_GOTO(0x1472, L1472);
+L1472:
+    AOT_BLOCK(0x1472, 5);
+    // 1472: mov dx, [si-2]
+    {
+        a = uint16_t(r[6] - 2);
+        r[2] = RD16(a);
+    }
+    // 1475: mov [bx-2], dx
+    {
+        a = uint16_t(r[3] - 2);
+        WR16(a, r[2]);
+    }
+    // 1478: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 147a: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 147d: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x147f, L147f);
+L147f:
+    AOT_BLOCK(0x147f, 2);
+    // 147f: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1481: je 149b
+    if (ZF)
+        AOT_GOTO(0x149b, L149b);
+    AOT_GOTO(0x1483, L1483);
+L1483:
+    AOT_BLOCK(0x1483, 3);
+    // 1483: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1486: cmp [di-2], dx
+    {
+        a = uint16_t(r[7] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1489: jne 149b
+    if (!ZF)
+        AOT_GOTO(0x149b, L149b);
+    AOT_GOTO(0x148b, L148b);
+L148b:
+    AOT_BLOCK(0x148b, 6);
+    // 148b: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 148e: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 1491: mov [di-2], dx
+    {
+        a = uint16_t(r[7] - 2);
+        WR16(a, r[2]);
+    }
+    // 1494: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 1497: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 1499: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x149b, L149b);
+L149b:
+    AOT_BLOCK(0x149b, 1);
+    // 149b: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L149e:
+    AOT_BLOCK(0x149e, 7);
+    // 149e: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 149f: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 14a1: sub sp, 10
+    {
+        val = (dst = int16_t(r[4])) - (src = 16);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 14a4: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 14a5: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 14a8: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 14aa: jle 14b6
+    if (ZF || SF != OF)
+        AOT_GOTO(0x14b6, L14b6);
+    AOT_GOTO(0x14ac, L14ac);
+L14ac:
+    AOT_BLOCK(0x14ac, 2);
+    // 14ac: cmp si, 11
+    {
+        val = (dst = int16_t(r[6])) - (src = 17);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 14af: jnle 14b6
+    if (!(ZF || SF != OF))
+        AOT_GOTO(0x14b6, L14b6);
+    AOT_GOTO(0x14b1, L14b1);
+L14b1:
+    AOT_BLOCK(0x14b1, 2);
+    // 14b1: cmp si, 9
+    {
+        val = (dst = int16_t(r[6])) - (src = 9);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 14b4: jne 14c1
+    if (!ZF)
+        AOT_GOTO(0x14c1, L14c1);
+    AOT_GOTO(0x14b6, L14b6);
+L14b6:
+    AOT_BLOCK(0x14b6, 3);
+    // 14b6: mov [0de4], 0016
+    {
+        a = 0x0de4;
+        WR16(a, 0x0016);
+    }
+    // 14bc: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 14bf: jmp short 14ef
+    AOT_GOTO(0x14ef, L14ef);
+L14c1:
+    AOT_BLOCK(0x14c1, 3);
+    // 14c1: lea ax, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[0] = a;
+    }
+    // 14c4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 14c5: call 1644
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x14c8);
+    }
+    AOT_GOTO(0x1644, L1644);
+L14c8:
+    AOT_BLOCK(0x14c8, 10);
+    // 14c8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 14c9: mov [bp-2], 0000
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, 0x0000);
+    }
+    // 14ce: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 14d1: mov [bp-8], dx
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[2]);
+    }
+    // 14d4: lea ax, [bp-10]
+    {
+        a = uint16_t(r[5] - 16);
+        r[0] = a;
+    }
+    // 14d7: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 14d8: lea ax, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[0] = a;
+    }
+    // 14db: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 14dc: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 14dd: call 15a5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x14e0);
+    }
+    AOT_GOTO(0x15a5, L15a5);
+L14e0:
+    AOT_BLOCK(0x14e0, 3);
+    // 14e0: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 14e3: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 14e5: jnl 14ec
+    if (SF == OF)
+        AOT_GOTO(0x14ec, L14ec);
+    AOT_GOTO(0x14e7, L14e7);
+L14e7:
+    AOT_BLOCK(0x14e7, 2);
+    // 14e7: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 14ea: jmp short 14ef
+    AOT_GOTO(0x14ef, L14ef);
+L14ec:
+    AOT_BLOCK(0x14ec, 1);
+    // 14ec: mov ax, [bp-10]
+    {
+        a = uint16_t(r[5] - 16);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x14ef, L14ef);
+L14ef:
+    AOT_BLOCK(0x14ef, 1);
+    // 14ef: jmp 1d33
+    AOT_GOTO(0x1d33, L1d33);
+L14f2:
+    AOT_BLOCK(0x14f2, 6);
+    // 14f2: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 14f3: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 14f5: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+    }
+    // 14f8: mov dx, [0de6]
+    {
+        a = 0x0de6;
+        r[2] = RD16(a);
+    }
+    // 14fc: cmp [bp+4], dx
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 14ff: je 1528
+    if (ZF)
+        AOT_GOTO(0x1528, L1528);
+    AOT_GOTO(0x1501, L1501);
+L1501:
+    AOT_BLOCK(0x1501, 9);
+    // 1501: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1504: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 1507: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 150a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 150b: mov ax, 0011
+    {
+        r[0] = 0x0011;
+    }
+    // 150e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 150f: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1511: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1512: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1515);
+    }
+    AOT_GOTO(0x156b, L156b);
+L1515:
+    AOT_BLOCK(0x1515, 3);
+    // 1515: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 1518: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 151a: jnl 1521
+    if (SF == OF)
+        AOT_GOTO(0x1521, L1521);
+    AOT_GOTO(0x151c, L151c);
+L151c:
+    AOT_BLOCK(0x151c, 2);
+    // 151c: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 151f: jmp short 152a
+    AOT_GOTO(0x152a, L152a);
+L1521:
+    AOT_BLOCK(0x1521, 2);
+    // 1521: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1524: mov [0de6], dx
+    {
+        a = 0x0de6;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1528, L1528);
+L1528:
+    AOT_BLOCK(0x1528, 1);
+    // 1528: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x152a, L152a);
+L152a:
+    AOT_BLOCK(0x152a, 1);
+    // 152a: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L152d:
+    AOT_BLOCK(0x152d, 10);
+    // 152d: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 152e: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1530: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1531: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1532: mov si, [0de6]
+    {
+        a = 0x0de6;
+        r[6] = RD16(a);
+    }
+    // 1536: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1539: add dx, [0de6]
+    {
+        a = 0x0de6;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 153d: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 153f: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1543: jle 1549
+    if (ZF || SF != OF)
+        AOT_GOTO(0x1549, L1549);
+    AOT_GOTO(0x1545, L1545);
+L1545:
+    AOT_BLOCK(0x1545, 2);
+    // 1545: cmp di, si
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1547: jb 1553
+    if (CF)
+        AOT_GOTO(0x1553, L1553);
+    AOT_GOTO(0x1549, L1549);
+L1549:
+    AOT_BLOCK(0x1549, 2);
+    // 1549: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 154d: jnl 1558
+    if (SF == OF)
+        AOT_GOTO(0x1558, L1558);
+    AOT_GOTO(0x154f, L154f);
+L154f:
+    AOT_BLOCK(0x154f, 2);
+    // 154f: cmp di, si
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1551: jbe 1558
+    if (CF || ZF)
+        AOT_GOTO(0x1558, L1558);
+    AOT_GOTO(0x1553, L1553);
+L1553:
+    AOT_BLOCK(0x1553, 2);
+    // 1553: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1556: jmp short 1568
+    AOT_GOTO(0x1568, L1568);
+L1558:
+    AOT_BLOCK(0x1558, 2);
+    // 1558: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1559: call 14f2
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x155c);
+    }
+    AOT_GOTO(0x14f2, L14f2);
+L155c:
+    AOT_BLOCK(0x155c, 3);
+    // 155c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 155d: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 155f: jne 1565
+    if (!ZF)
+        AOT_GOTO(0x1565, L1565);
+    AOT_GOTO(0x1561, L1561);
+L1561:
+    AOT_BLOCK(0x1561, 2);
+    // 1561: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 1563: jmp short 1568
+    AOT_GOTO(0x1568, L1568);
+L1565:
+    AOT_BLOCK(0x1565, 1);
+    // 1565: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    AOT_GOTO(0x1568, L1568);
+L1568:
+    AOT_BLOCK(0x1568, 1);
+    // 1568: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L156b:
+    AOT_BLOCK(0x156b, 10);
+    // 156b: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 156c: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 156e: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 156f: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1570: mov si, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[6] = RD16(a);
+    }
+    // 1573: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 1576: mov [si+2], dx
+    {
+        a = uint16_t(r[6] + 2);
+        WR16(a, r[2]);
+    }
+    // 1579: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 157a: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 157d: call 16ed
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1580);
+    }
+    AOT_GOTO(0x16ed, L16ed);
+L1580:
+    AOT_BLOCK(0x1580, 5);
+    // 1580: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1581: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1582: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 1584: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1586: je 158b
+    if (ZF)
+        AOT_GOTO(0x158b, L158b);
+    AOT_GOTO(0x1588, L1588);
+L1588:
+    AOT_BLOCK(0x1588, 1);
+    // 1588: mov [si+2], di
+    {
+        a = uint16_t(r[6] + 2);
+        WR16(a, r[7]);
+    }
+    AOT_GOTO(0x158b, L158b);
+L158b:
+    AOT_BLOCK(0x158b, 2);
+    // 158b: cmp [si+2], 0
+    {
+        a = uint16_t(r[6] + 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 158f: jnl 159f
+    if (SF == OF)
+        AOT_GOTO(0x159f, L159f);
+    AOT_GOTO(0x1591, L1591);
+L1591:
+    AOT_BLOCK(0x1591, 5);
+    // 1591: mov dx, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[2] = RD16(a);
+    }
+    // 1594: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1596: mov [0de4], dx
+    {
+        a = 0x0de4;
+        WR16(a, r[2]);
+    }
+    // 159a: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 159d: jmp short 15a2
+    AOT_GOTO(0x15a2, L15a2);
+L159f:
+    AOT_BLOCK(0x159f, 1);
+    // 159f: mov ax, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x15a2, L15a2);
+L15a2:
+    AOT_BLOCK(0x15a2, 1);
+    // 15a2: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L15a5:
+    AOT_BLOCK(0x15a5, 17);
+    // 15a5: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 15a6: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 15a8: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 15ab: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 15ae: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 15b1: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 15b4: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 15b7: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 15ba: mov [bp-c], dx
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, r[2]);
+    }
+    // 15bd: mov [bp-a], 16dd
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, 0x16dd);
+    }
+    // 15c2: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 15c5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 15c6: mov ax, 0047
+    {
+        r[0] = 0x0047;
+    }
+    // 15c9: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 15ca: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 15cc: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 15cd: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x15d0);
+    }
+    AOT_GOTO(0x156b, L156b);
+L15d0:
+    AOT_BLOCK(0x15d0, 2);
+    // 15d0: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 15d3: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L1644:
+    AOT_BLOCK(0x1644, 4);
+    // 1644: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1645: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1647: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1649: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    AOT_GOTO(0x164c, L164c);
+L164c:
+    AOT_BLOCK(0x164c, 4);
+    // 164c: mov [bx], ax
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[0]);
+    }
+    // 164e: mov [bx+2], ax
+    {
+        a = uint16_t(r[3] + 2);
+        WR16(a, r[0]);
+    }
+    // 1651: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1653: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L16a9:
+    AOT_BLOCK(0x16a9, 1);
+    // 16a9: jmp 173c
+    AOT_GOTO(0x173c, L173c);
+L16ad:
+    AOT_BLOCK(0x16ad, 1);
+    // 16ad: jmp 175c
+    AOT_GOTO(0x175c, L175c);
+L16b1:
+    AOT_BLOCK(0x16b1, 1);
+    // 16b1: jmp 1789
+    AOT_GOTO(0x1789, L1789);
+L16b5:
+    AOT_BLOCK(0x16b5, 1);
+    // 16b5: jmp 17aa
+    AOT_GOTO(0x17aa, L17aa);
+L16b9:
+    AOT_BLOCK(0x16b9, 1);
+    // 16b9: jmp 17d7
+    AOT_GOTO(0x17d7, L17d7);
+L16bd:
+    AOT_BLOCK(0x16bd, 1);
+    // 16bd: jmp 19b3
+    AOT_GOTO(0x19b3, L19b3);
+L16c1:
+    AOT_BLOCK(0x16c1, 1);
+    // 16c1: jmp 19cd
+    AOT_GOTO(0x19cd, L19cd);
+L16c5:
+    AOT_BLOCK(0x16c5, 1);
+    // 16c5: jmp 19e7
+    AOT_GOTO(0x19e7, L19e7);
+L16c9:
+    AOT_BLOCK(0x16c9, 1);
+    // 16c9: jmp 1a0d
+    AOT_GOTO(0x1a0d, L1a0d);
+L16cd:
+    AOT_BLOCK(0x16cd, 1);
+    // 16cd: jmp 1a68
+    AOT_GOTO(0x1a68, L1a68);
+L16d1:
+    AOT_BLOCK(0x16d1, 1);
+    // 16d1: jmp 1b21
+    AOT_GOTO(0x1b21, L1b21);
+L16d5:
+    AOT_BLOCK(0x16d5, 1);
+    // 16d5: jmp 1b48
+    AOT_GOTO(0x1b48, L1b48);
+L16d9:
+    AOT_BLOCK(0x16d9, 1);
+    // 16d9: jmp 1b7c
+    AOT_GOTO(0x1b7c, L1b7c);
+L16ed:
+    AOT_BLOCK(0x16ed, 2);
+    // 16ed: mov cx, 0003
+    {
+        r[1] = 0x0003;
+    }
+    // 16f0: jmp short 16f2
+    AOT_GOTO(0x16f2, L16f2);
+L16f2:
+    AOT_BLOCK(0x16f2, 4);
+    // 16f2: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 16f3: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 16f5: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 16f8: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 16fb: int 20
+    AOT_INTERP(0x16fb);
+L16fd:
+    AOT_BLOCK(0x16fd, 2);
+    // 16fd: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 16fe: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x16fe);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L16ff:
+    AOT_BLOCK(0x16ff, 8);
+    // 16ff: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1700: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1702: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1703: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1704: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 1707: mov si, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[6] = RD16(a);
+    }
+    // 170a: mov cx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[1] = RD16(a);
+    }
+    // 170d: jmp 1bbf
+    AOT_GOTO(0x1bbf, L1bbf);
+L1710:
+    AOT_BLOCK(0x1710, 2);
+    // 1710: mov dx, ffff
+    {
+        r[2] = 0xffff;
+    }
+    // 1713: jmp 1be8
+    AOT_GOTO(0x1be8, L1be8);
+L1716:
+    AOT_BLOCK(0x1716, 2);
+    // 1716: mov cx, ffff
+    {
+        r[1] = 0xffff;
+    }
+    // 1719: jmp 1c16
+    AOT_GOTO(0x1c16, L1c16);
+L171c:
+    AOT_BLOCK(0x171c, 6);
+    // 171c: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 171d: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 171f: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1720: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1721: mov cx, ffff
+    {
+        r[1] = 0xffff;
+    }
+    // 1724: call 1c40
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1727);
+    }
+    AOT_GOTO(0x1c40, L1c40);
+L1727:
+    AOT_BLOCK(0x1727, 5);
+    // 1727: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 172a: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 172b: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 172c: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 172d: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x172d);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L172e:
+    AOT_BLOCK(0x172e, 2);
+    // 172e: mov cx, ffff
+    {
+        r[1] = 0xffff;
+    }
+    // 1731: jmp 1c57
+    AOT_GOTO(0x1c57, L1c57);
+L1734:
+    AOT_BLOCK(0x1734, 3);
+    // 1734: mov bx, sp
+    {
+        r[3] = r[4];
+    }
+    // 1736: mov cx, [bx+6]
+    {
+        a = uint16_t(r[3] + 6);
+        r[1] = RD16(a);
+    }
+    // 1739: jmp 1c16
+    AOT_GOTO(0x1c16, L1c16);
+L173c:
+    AOT_BLOCK(0x173c, 12);
+    // 173c: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 173d: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 173f: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 1742: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1745: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 1748: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 174b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 174c: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 174f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1750: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1752: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1753: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1756);
+    }
+    AOT_GOTO(0x156b, L156b);
+L1756:
+    AOT_BLOCK(0x1756, 2);
+    // 1756: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1759: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L175c:
+    AOT_BLOCK(0x175c, 9);
+    // 175c: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 175d: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 175f: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1762: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 1765: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 1768: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 176b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 176c: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 176f: call 1c72
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1772);
+    }
+    AOT_GOTO(0x1c72, L1c72);
+L1772:
+    AOT_BLOCK(0x1772, 9);
+    // 1772: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1773: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1774: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1777: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1778: mov ax, 0021
+    {
+        r[0] = 0x0021;
+    }
+    // 177b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 177c: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 177f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1780: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1783);
+    }
+    AOT_GOTO(0x156b, L156b);
+L1783:
+    AOT_BLOCK(0x1783, 2);
+    // 1783: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1786: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L1789:
+    AOT_BLOCK(0x1789, 12);
+    // 1789: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 178a: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 178c: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 178f: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1792: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 1795: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1798: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1799: mov ax, 0006
+    {
+        r[0] = 0x0006;
+    }
+    // 179c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 179d: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 17a0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17a1: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x17a4);
+    }
+    AOT_GOTO(0x156b, L156b);
+L17a4:
+    AOT_BLOCK(0x17a4, 2);
+    // 17a4: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 17a7: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L17aa:
+    AOT_BLOCK(0x17aa, 9);
+    // 17aa: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 17ab: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 17ad: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 17b0: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 17b3: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 17b6: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 17b9: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17ba: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 17bd: call 1c72
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x17c0);
+    }
+    AOT_GOTO(0x1c72, L1c72);
+L17c0:
+    AOT_BLOCK(0x17c0, 9);
+    // 17c0: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 17c1: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 17c2: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 17c5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17c6: mov ax, 0008
+    {
+        r[0] = 0x0008;
+    }
+    // 17c9: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17ca: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 17cd: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17ce: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x17d1);
+    }
+    AOT_GOTO(0x156b, L156b);
+L17d1:
+    AOT_BLOCK(0x17d1, 2);
+    // 17d1: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 17d4: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L17d7:
+    AOT_BLOCK(0x17d7, 7);
+    // 17d7: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 17d8: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 17da: mov bx, [0002]
+    {
+        a = 0x0002;
+        r[3] = RD16(a);
+    }
+    // 17de: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 17e0: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 17e3: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 17e6: call 17ef
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x17e9);
+    }
+    AOT_GOTO(0x17ef, L17ef);
+L17e9:
+    AOT_BLOCK(0x17e9, 2);
+    // 17e9: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 17ec: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L17ef:
+    AOT_BLOCK(0x17ef, 11);
+    // 17ef: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 17f0: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 17f2: sub sp, 2c
+    {
+        val = (dst = int16_t(r[4])) - (src = 44);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 17f5: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 17f6: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 17f7: mov [bp-14], 0000
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, 0x0000);
+    }
+    // 17fc: xor si, si
+    {
+        val = int16_t(r[6]) ^ int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 17fe: mov [bp-10], 0000
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, 0x0000);
+    }
+    // 1803: mov [bp-c], 0000
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0000);
+    }
+    // 1808: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 180b: mov [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x180e, L180e);
+L180e:
+    AOT_BLOCK(0x180e, 3);
+    // 180e: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 1811: cmp [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1814: je 183b
+    if (ZF)
+        AOT_GOTO(0x183b, L183b);
+    AOT_GOTO(0x1816, L1816);
+L1816:
+    AOT_BLOCK(0x1816, 2);
+    // 1816: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1818: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x181b);
+    }
+    AOT_GOTO(0x172e, L172e);
+L181b:
+    AOT_BLOCK(0x181b, 6);
+    // 181b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 181c: add ax, 0003
+    {
+        val = (dst = int16_t(r[0])) + (src = 3);
+        r[0] = val;
+    }
+    // 181f: mov [bp-12], ax
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[0]);
+    }
+    // 1822: add si, ax
+    {
+        val = (dst = int16_t(r[6])) + (src = int16_t(r[0]));
+        r[6] = val;
+    }
+    // 1824: cmp [bp-12], si
+    {
+        a = uint16_t(r[5] - 18);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1827: jbe 182e
+    if (CF || ZF)
+        AOT_GOTO(0x182e, L182e);
+    AOT_GOTO(0x1829, L1829);
+L1829:
+    AOT_BLOCK(0x1829, 1);
+    // 1829: mov [bp-14], 0001
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, 0x0001);
+    }
+    AOT_GOTO(0x182e, L182e);
+L182e:
+    AOT_BLOCK(0x182e, 4);
+    // 182e: add [bp-10], 2
+    {
+        a = uint16_t(r[5] - 16);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+    }
+    // 1832: inc [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1835: add [bp-2], 2
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1839: jmp short 180e
+    AOT_GOTO(0x180e, L180e);
+L183b:
+    AOT_BLOCK(0x183b, 2);
+    // 183b: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 183e: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1841, L1841);
+L1841:
+    AOT_BLOCK(0x1841, 3);
+    // 1841: mov bx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[3] = RD16(a);
+    }
+    // 1844: cmp [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1847: je 186b
+    if (ZF)
+        AOT_GOTO(0x186b, L186b);
+    AOT_GOTO(0x1849, L1849);
+L1849:
+    AOT_BLOCK(0x1849, 2);
+    // 1849: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 184b: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x184e);
+    }
+    AOT_GOTO(0x172e, L172e);
+L184e:
+    AOT_BLOCK(0x184e, 6);
+    // 184e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 184f: add ax, 0003
+    {
+        val = (dst = int16_t(r[0])) + (src = 3);
+        r[0] = val;
+    }
+    // 1852: mov [bp-12], ax
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[0]);
+    }
+    // 1855: add si, ax
+    {
+        val = (dst = int16_t(r[6])) + (src = int16_t(r[0]));
+        r[6] = val;
+    }
+    // 1857: cmp [bp-12], si
+    {
+        a = uint16_t(r[5] - 18);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 185a: jbe 1861
+    if (CF || ZF)
+        AOT_GOTO(0x1861, L1861);
+    AOT_GOTO(0x185c, L185c);
+L185c:
+    AOT_BLOCK(0x185c, 1);
+    // 185c: mov [bp-14], 0001
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, 0x0001);
+    }
+    AOT_GOTO(0x1861, L1861);
+L1861:
+    AOT_BLOCK(0x1861, 3);
+    // 1861: add [bp-10], 2
+    {
+        a = uint16_t(r[5] - 16);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+    }
+    // 1865: add [bp-4], 2
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1869: jmp short 1841
+    AOT_GOTO(0x1841, L1841);
+L186b:
+    AOT_BLOCK(0x186b, 8);
+    // 186b: add si, 6
+    {
+        val = (dst = int16_t(r[6])) + (src = 6);
+        r[6] = val;
+    }
+    // 186e: add [bp-10], 6
+    {
+        a = uint16_t(r[5] - 16);
+        val = (dst = int16_t(RD16(a))) + (src = 6);
+        WR16(a, val);
+    }
+    // 1872: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 1874: inc dx
+    {
+        val = int16_t(r[2]) + 1;
+        r[2] = val;
+    }
+    // 1875: and dx, fffe
+    {
+        val = int16_t(r[2]) & -2;
+        r[2] = val;
+    }
+    // 1879: mov si, dx
+    {
+        r[6] = r[2];
+    }
+    // 187b: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 187f: jne 1886
+    if (!ZF)
+        AOT_GOTO(0x1886, L1886);
+    AOT_GOTO(0x1881, L1881);
+L1881:
+    AOT_BLOCK(0x1881, 2);
+    // 1881: cmp si, 6
+    {
+        val = (dst = int16_t(r[6])) - (src = 6);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1884: jnb 1892
+    if (!CF)
+        AOT_GOTO(0x1892, L1892);
+    AOT_GOTO(0x1886, L1886);
+L1886:
+    AOT_BLOCK(0x1886, 3);
+    // 1886: mov [0de4], 0007
+    {
+        a = 0x0de4;
+        WR16(a, 0x0007);
+    }
+    // 188c: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 188f: jmp 19b0
+    AOT_GOTO(0x19b0, L19b0);
+L1892:
+    AOT_BLOCK(0x1892, 2);
+    // 1892: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1893: call 152d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1896);
+    }
+    AOT_GOTO(0x152d, L152d);
+L1896:
+    AOT_BLOCK(0x1896, 4);
+    // 1896: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1897: mov [bp-6], ax
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[0]);
+    }
+    // 189a: cmp ax, ffff
+    {
+        val = (dst = int16_t(r[0])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 189d: jne 18ab
+    if (!ZF)
+        AOT_GOTO(0x18ab, L18ab);
+    AOT_GOTO(0x189f, L189f);
+L189f:
+    AOT_BLOCK(0x189f, 2);
+    // 189f: mov [0de4], 0007
+    {
+        a = 0x0de4;
+        WR16(a, 0x0007);
+    }
+    // 18a5: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    AOT_GOTO(0x18a8, L18a8);
+L18a8:
+    AOT_BLOCK(0x18a8, 1);
+    // 18a8: jmp 19b0
+    AOT_GOTO(0x19b0, L19b0);
+L18ab:
+    AOT_BLOCK(0x18ab, 11);
+    // 18ab: mov dx, [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        r[2] = RD16(a);
+    }
+    // 18ae: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 18b1: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 18b3: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 18b6: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+    }
+    // 18b9: mov [bp-8], bx
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[3]);
+    }
+    // 18bc: mov dx, [bp-10]
+    {
+        a = uint16_t(r[5] - 16);
+        r[2] = RD16(a);
+    }
+    // 18bf: add dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 18c2: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 18c4: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 18c7: mov [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x18ca, L18ca);
+L18ca:
+    AOT_BLOCK(0x18ca, 3);
+    // 18ca: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 18cd: cmp [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 18d0: je 1907
+    if (ZF)
+        AOT_GOTO(0x1907, L1907);
+    AOT_GOTO(0x18d2, L18d2);
+L18d2:
+    AOT_BLOCK(0x18d2, 8);
+    // 18d2: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 18d4: sub dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 18d7: mov bx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[3] = RD16(a);
+    }
+    // 18da: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 18dc: add [bp-8], 2
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 18e0: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 18e3: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 18e5: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x18e8);
+    }
+    AOT_GOTO(0x172e, L172e);
+L18e8:
+    AOT_BLOCK(0x18e8, 8);
+    // 18e8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 18e9: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 18ea: mov [bp-12], ax
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[0]);
+    }
+    // 18ed: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 18f0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 18f1: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 18f3: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 18f4: call 16ff
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x18f7);
+    }
+    AOT_GOTO(0x16ff, L16ff);
+L18f7:
+    AOT_BLOCK(0x18f7, 6);
+    // 18f7: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 18fa: mov dx, [bp-12]
+    {
+        a = uint16_t(r[5] - 18);
+        r[2] = RD16(a);
+    }
+    // 18fd: add dx, di
+    {
+        val = (dst = int16_t(r[2])) + (src = int16_t(r[7]));
+        r[2] = val;
+    }
+    // 18ff: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 1901: add [bp-2], 2
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1905: jmp short 18ca
+    AOT_GOTO(0x18ca, L18ca);
+L1907:
+    AOT_BLOCK(0x1907, 5);
+    // 1907: mov bx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[3] = RD16(a);
+    }
+    // 190a: mov [bx], 0000
+    {
+        a = uint16_t(r[3]);
+        WR16(a, 0x0000);
+    }
+    // 190e: add [bp-8], 2
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1912: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 1915: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1918, L1918);
+L1918:
+    AOT_BLOCK(0x1918, 3);
+    // 1918: mov bx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[3] = RD16(a);
+    }
+    // 191b: cmp [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 191e: je 1955
+    if (ZF)
+        AOT_GOTO(0x1955, L1955);
+    AOT_GOTO(0x1920, L1920);
+L1920:
+    AOT_BLOCK(0x1920, 8);
+    // 1920: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 1922: sub dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 1925: mov bx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[3] = RD16(a);
+    }
+    // 1928: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 192a: add [bp-8], 2
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 192e: mov bx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[3] = RD16(a);
+    }
+    // 1931: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1933: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1936);
+    }
+    AOT_GOTO(0x172e, L172e);
+L1936:
+    AOT_BLOCK(0x1936, 8);
+    // 1936: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1937: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1938: mov [bp-12], ax
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[0]);
+    }
+    // 193b: mov bx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[3] = RD16(a);
+    }
+    // 193e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 193f: push [bx]
+    {
+        a = uint16_t(r[3]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1941: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1942: call 16ff
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1945);
+    }
+    AOT_GOTO(0x16ff, L16ff);
+L1945:
+    AOT_BLOCK(0x1945, 6);
+    // 1945: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 1948: mov dx, [bp-12]
+    {
+        a = uint16_t(r[5] - 18);
+        r[2] = RD16(a);
+    }
+    // 194b: add dx, di
+    {
+        val = (dst = int16_t(r[2])) + (src = int16_t(r[7]));
+        r[2] = val;
+    }
+    // 194d: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 194f: add [bp-4], 2
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1953: jmp short 1918
+    AOT_GOTO(0x1918, L1918);
+L1955:
+    AOT_BLOCK(0x1955, 3);
+    // 1955: mov bx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[3] = RD16(a);
+    }
+    // 1958: mov [bx], 0000
+    {
+        a = uint16_t(r[3]);
+        WR16(a, 0x0000);
+    }
+    // 195c: add [bp-8], 2
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x1960, L1960);
+L1960:
+    AOT_BLOCK(0x1960, 4);
+    // 1960: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 1963: add bx, si
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[6]));
+        r[3] = val;
+    }
+    // 1965: cmp bx, di
+    {
+        val = (dst = int16_t(r[3])) - (src = int16_t(r[7]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1967: jbe 196f
+    if (CF || ZF)
+        AOT_GOTO(0x196f, L196f);
+    AOT_GOTO(0x1969, L1969);
+L1969:
+    AOT_BLOCK(0x1969, 3);
+    // 1969: mov byte [di], 0
+    {
+        a = uint16_t(r[7]);
+        WR8(a, 0);
+    }
+    // 196c: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 196d: jmp short 1960
+    AOT_GOTO(0x1960, L1960);
+L196f:
+    AOT_BLOCK(0x196f, 2);
+    // 196f: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1972: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1975);
+    }
+    AOT_GOTO(0x172e, L172e);
+L1975:
+    AOT_BLOCK(0x1975, 17);
+    // 1975: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1976: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        AF = !(val & 15);
+    }
+    // 1977: mov [bp-28], ax
+    {
+        a = uint16_t(r[5] - 40);
+        WR16(a, r[0]);
+    }
+    // 197a: mov [bp-26], si
+    {
+        a = uint16_t(r[5] - 38);
+        WR16(a, r[6]);
+    }
+    // 197d: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1980: mov [bp-22], dx
+    {
+        a = uint16_t(r[5] - 34);
+        WR16(a, r[2]);
+    }
+    // 1983: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1986: mov [bp-20], dx
+    {
+        a = uint16_t(r[5] - 32);
+        WR16(a, r[2]);
+    }
+    // 1989: mov [bp-24], 0000
+    {
+        a = uint16_t(r[5] - 36);
+        WR16(a, 0x0000);
+    }
+    // 198e: mov [bp-1e], 0000
+    {
+        a = uint16_t(r[5] - 30);
+        WR16(a, 0x0000);
+    }
+    // 1993: lea ax, [bp-2c]
+    {
+        a = uint16_t(r[5] - 44);
+        r[0] = a;
+    }
+    // 1996: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1997: mov ax, 003b
+    {
+        r[0] = 0x003b;
+    }
+    // 199a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 199b: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 199d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 199e: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x19a1);
+    }
+    AOT_GOTO(0x156b, L156b);
+L19a1:
+    AOT_BLOCK(0x19a1, 5);
+    // 19a1: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 19a4: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 19a6: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 19a8: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 19a9: call 152d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x19ac);
+    }
+    AOT_GOTO(0x152d, L152d);
+L19ac:
+    AOT_BLOCK(0x19ac, 2);
+    // 19ac: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 19ad: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    AOT_GOTO(0x19b0, L19b0);
+L19b0:
+    AOT_BLOCK(0x19b0, 1);
+    // 19b0: jmp 1d32
+    AOT_GOTO(0x1d32, L1d32);
+L19b3:
+    AOT_BLOCK(0x19b3, 10);
+    // 19b3: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 19b4: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 19b6: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 19b9: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 19bc: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 19bd: mov ax, 0002
+    {
+        r[0] = 0x0002;
+    }
+    // 19c0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 19c1: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 19c3: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 19c4: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x19c7);
+    }
+    AOT_GOTO(0x156b, L156b);
+L19c7:
+    AOT_BLOCK(0x19c7, 2);
+    // 19c7: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 19ca: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L19cd:
+    AOT_BLOCK(0x19cd, 10);
+    // 19cd: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 19ce: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 19d0: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 19d3: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 19d6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 19d7: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 19da: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 19db: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 19dd: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 19de: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x19e1);
+    }
+    AOT_GOTO(0x156b, L156b);
+L19e1:
+    AOT_BLOCK(0x19e1, 2);
+    // 19e1: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 19e4: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L19e7:
+    AOT_BLOCK(0x19e7, 14);
+    // 19e7: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 19e8: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 19ea: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 19ed: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 19f0: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 19f3: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 19f6: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 19f9: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 19fc: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 19fd: mov ax, 0025
+    {
+        r[0] = 0x0025;
+    }
+    // 1a00: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a01: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1a03: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a04: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1a07);
+    }
+    AOT_GOTO(0x156b, L156b);
+L1a07:
+    AOT_BLOCK(0x1a07, 2);
+    // 1a07: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1a0a: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L1a0d:
+    AOT_BLOCK(0x1a0d, 7);
+    // 1a0d: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1a0e: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1a10: sub sp, 1a
+    {
+        val = (dst = int16_t(r[4])) - (src = 26);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 1a13: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1a14: lea si, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[6] = a;
+    }
+    // 1a17: test byte [bp+6], 40
+    {
+        a = uint16_t(r[5] + 6);
+        val = int8_t(RD8(a)) & 64;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1a1b: je 1a41
+    if (ZF)
+        AOT_GOTO(0x1a41, L1a41);
+    AOT_GOTO(0x1a1d, L1a1d);
+L1a1d:
+    AOT_BLOCK(0x1a1d, 2);
+    // 1a1d: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1a20: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1a23);
+    }
+    AOT_GOTO(0x172e, L172e);
+L1a23:
+    AOT_BLOCK(0x1a23, 12);
+    // 1a23: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1a24: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1a25: mov [bp-16], ax
+    {
+        a = uint16_t(r[5] - 22);
+        WR16(a, r[0]);
+    }
+    // 1a28: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 1a2b: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 1a2e: lea bx, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[3] = a;
+    }
+    // 1a31: mov si, bx
+    {
+        r[6] = r[3];
+    }
+    // 1a33: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 1a36: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 1a39: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1a3c: mov [bp-10], dx
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, r[2]);
+    }
+    // 1a3f: jmp short 1a53
+    AOT_GOTO(0x1a53, L1a53);
+L1a41:
+    AOT_BLOCK(0x1a41, 4);
+    // 1a41: lea ax, [bp-1a]
+    {
+        a = uint16_t(r[5] - 26);
+        r[0] = a;
+    }
+    // 1a44: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a45: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1a48: call 1c72
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1a4b);
+    }
+    AOT_GOTO(0x1c72, L1c72);
+L1a4b:
+    AOT_BLOCK(0x1a4b, 4);
+    // 1a4b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1a4c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1a4d: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 1a50: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1a53, L1a53);
+L1a53:
+    AOT_BLOCK(0x1a53, 7);
+    // 1a53: lea ax, [bp-1a]
+    {
+        a = uint16_t(r[5] - 26);
+        r[0] = a;
+    }
+    // 1a56: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a57: mov ax, 0005
+    {
+        r[0] = 0x0005;
+    }
+    // 1a5a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a5b: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1a5e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a5f: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1a62);
+    }
+    AOT_GOTO(0x156b, L156b);
+L1a62:
+    AOT_BLOCK(0x1a62, 2);
+    // 1a62: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1a65: jmp 1d33
+    AOT_GOTO(0x1d33, L1d33);
+L1a68:
+    AOT_BLOCK(0x1a68, 16);
+    // 1a68: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1a69: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1a6b: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1a6e: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1a71: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 1a74: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 1a77: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 1a7a: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 1a7d: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 1a80: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1a83: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a84: mov ax, 0003
+    {
+        r[0] = 0x0003;
+    }
+    // 1a87: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a88: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1a8b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a8c: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1a8f);
+    }
+    AOT_GOTO(0x156b, L156b);
+L1a8f:
+    AOT_BLOCK(0x1a8f, 2);
+    // 1a8f: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1a92: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L1b21:
+    AOT_BLOCK(0x1b21, 7);
+    // 1b21: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1b22: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1b24: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1b27: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1b2a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b2b: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1b2e: call 1c72
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1b31);
+    }
+    AOT_GOTO(0x1c72, L1c72);
+L1b31:
+    AOT_BLOCK(0x1b31, 9);
+    // 1b31: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1b32: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1b33: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1b36: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b37: mov ax, 000a
+    {
+        r[0] = 0x000a;
+    }
+    // 1b3a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b3b: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1b3e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b3f: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1b42);
+    }
+    AOT_GOTO(0x156b, L156b);
+L1b42:
+    AOT_BLOCK(0x1b42, 2);
+    // 1b42: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1b45: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L1b48:
+    AOT_BLOCK(0x1b48, 10);
+    // 1b48: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1b49: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1b4b: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 1b4e: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1b51: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b52: mov ax, 0007
+    {
+        r[0] = 0x0007;
+    }
+    // 1b55: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b56: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1b58: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b59: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1b5c);
+    }
+    AOT_GOTO(0x156b, L156b);
+L1b5c:
+    AOT_BLOCK(0x1b5c, 3);
+    // 1b5c: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 1b5f: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1b61: jnl 1b68
+    if (SF == OF)
+        AOT_GOTO(0x1b68, L1b68);
+    AOT_GOTO(0x1b63, L1b63);
+L1b63:
+    AOT_BLOCK(0x1b63, 2);
+    // 1b63: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1b66: jmp short 1b79
+    AOT_GOTO(0x1b79, L1b79);
+L1b68:
+    AOT_BLOCK(0x1b68, 2);
+    // 1b68: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1b6c: je 1b76
+    if (ZF)
+        AOT_GOTO(0x1b76, L1b76);
+    AOT_GOTO(0x1b6e, L1b6e);
+L1b6e:
+    AOT_BLOCK(0x1b6e, 3);
+    // 1b6e: mov dx, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[2] = RD16(a);
+    }
+    // 1b71: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 1b74: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1b76, L1b76);
+L1b76:
+    AOT_BLOCK(0x1b76, 1);
+    // 1b76: mov ax, [bp-16]
+    {
+        a = uint16_t(r[5] - 22);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x1b79, L1b79);
+L1b79:
+    AOT_BLOCK(0x1b79, 1);
+    // 1b79: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L1b7c:
+    AOT_BLOCK(0x1b7c, 16);
+    // 1b7c: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1b7d: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1b7f: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1b82: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1b85: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 1b88: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 1b8b: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 1b8e: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 1b91: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 1b94: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1b97: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b98: mov ax, 0004
+    {
+        r[0] = 0x0004;
+    }
+    // 1b9b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b9c: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1b9f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1ba0: call 156b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1ba3);
+    }
+    AOT_GOTO(0x156b, L156b);
+L1ba3:
+    AOT_BLOCK(0x1ba3, 2);
+    // 1ba3: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1ba6: jmp 1d34
+    AOT_GOTO(0x1d34, L1d34);
+L1bbf:
+    AOT_BLOCK(0x1bbf, 3);
+    // 1bbf: cld
+    {
+        DF = false;
+    }
+    // 1bc0: cmp cx, 10
+    {
+        val = (dst = int16_t(r[1])) - (src = 16);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1bc3: jb 1bd3
+    if (CF)
+        AOT_GOTO(0x1bd3, L1bd3);
+    AOT_GOTO(0x1bc5, L1bc5);
+L1bc5:
+    AOT_BLOCK(0x1bc5, 4);
+    // 1bc5: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 1bc7: or ax, di
+    {
+        val = int16_t(r[0]) | int16_t(r[7]);
+        r[0] = val;
+    }
+    // 1bc9: test al, 1
+    {
+        val = int8_t(r[0]) & 1;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1bcb: jne 1bd3
+    if (!ZF)
+        AOT_GOTO(0x1bd3, L1bd3);
+    AOT_GOTO(0x1bcd, L1bcd);
+L1bcd:
+    AOT_BLOCK(0x1bcd, 3);
+    // 1bcd: shr cx, 1
+    {
+        val = r[1] >> (1 - 1);
+        r[1] = val >> 1;
+        SF = int16_t((val >> 1)) < 0;
+        ZF = int16_t((val >> 1)) == 0;
+        PF = ptable[uint8_t((val >> 1))];
+        CF = val & 1;
+        OF = val & 0x8000;
+    }
+    // 1bcf: rep movsw
+    {
+        if (r[1]) {
+            do {
+                WR16(r[7], RD16(r[6]));
+                if (DF) {
+                    r[6] -= 2;
+                    r[7] -= 2;
+                } else {
+                    r[6] += 2;
+                    r[7] += 2;
+                }
+            } while (--r[1]);
+        }
+    }
+    // 1bd1: adc cx, cx
+    {
+        val = (dst = int16_t(r[1])) + (src = int16_t(r[1])) + CF;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val) || (CF && !(src + 1));
+    }
+    AOT_GOTO(0x1bd3, L1bd3);
+L1bd3:
+    AOT_BLOCK(0x1bd3, 6);
+    // 1bd3: rep movsb
+    {
+        if (r[1]) {
+            do {
+                WR8(r[7], RD8(r[6]));
+                if (DF) {
+                    r[6] -= 1;
+                    r[7] -= 1;
+                } else {
+                    r[6] += 1;
+                    r[7] += 1;
+                }
+            } while (--r[1]);
+        }
+    }
+    // 1bd5: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 1bd8: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 1bd9: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 1bda: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1bdb: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1bdb);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1be8:
+    AOT_BLOCK(0x1be8, 15);
+    // 1be8: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1be9: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1beb: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1bec: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1bed: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 1bf0: mov cx, ffff
+    {
+        r[1] = 0xffff;
+    }
+    // 1bf3: xor al, al
+    {
+        val = int8_t(r[0]) ^ int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        CF = false;
+    }
+    // 1bf5: cld
+    {
+        DF = false;
+    }
+    // 1bf6: rep scasb
+    {
+        if (r[1]) {
+            do {
+                val = int8_t(dst = uint8_t(r[0])) - int8_t(src = RD8(r[7]));
+                AF = (dst & 15) - (src & 15) < 0;
+                CF = dst < src;
+                OF = val != int8_t(val);
+                SF = int8_t(val) < 0;
+                ZF = int8_t(val) == 0;
+                PF = ptable[uint8_t(val)];
+                if (DF) r[7] -= 1;
+                else r[7] += 1;
+            } while (--r[1] && !ZF);
+        }
+    }
+    // 1bf8: dec di
+    {
+        val = int16_t(r[7]) - 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1bf9: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1bfa: mov di, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[7] = RD16(a);
+    }
+    // 1bfd: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 1bff: rep scasb
+    {
+        if (r[1]) {
+            do {
+                val = int8_t(dst = uint8_t(r[0])) - int8_t(src = RD8(r[7]));
+                AF = (dst & 15) - (src & 15) < 0;
+                CF = dst < src;
+                OF = val != int8_t(val);
+                SF = int8_t(val) < 0;
+                ZF = int8_t(val) == 0;
+                PF = ptable[uint8_t(val)];
+                if (DF) r[7] -= 1;
+                else r[7] += 1;
+            } while (--r[1] && !ZF);
+        }
+    }
+    // 1c01: jne 1c04
+    if (!ZF)
+        AOT_GOTO(0x1c04, L1c04);
+    AOT_GOTO(0x1c03, L1c03);
+L1c03:
+    AOT_BLOCK(0x1c03, 1);
+    // 1c03: inc cx
+    {
+        val = int16_t(r[1]) + 1;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1c04, L1c04);
+L1c04:
+    AOT_BLOCK(0x1c04, 5);
+    // 1c04: sub dx, cx
+    {
+        val = (dst = int16_t(r[2])) - (src = int16_t(r[1]));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1c06: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 1c08: mov si, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[6] = RD16(a);
+    }
+    // 1c0b: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 1c0c: rep movsb
+    {
+        if (r[1]) {
+            do {
+                WR8(r[7], RD8(r[6]));
+                if (DF) {
+                    r[6] -= 1;
+                    r[7] -= 1;
+                } else {
+                    r[6] += 1;
+                    r[7] += 1;
+                }
+            } while (--r[1]);
+        }
+    }
+    // 1c0e: stosb
+    AOT_INTERP(0x1c0e);
+L1c0f:
+    AOT_BLOCK(0x1c0f, 5);
+    // 1c0f: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 1c12: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 1c13: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 1c14: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1c15: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1c15);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1c16:
+    AOT_BLOCK(0x1c16, 7);
+    // 1c16: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1c17: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1c19: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1c1a: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1c1b: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+    }
+    // 1c1d: test cx, cx
+    {
+        val = int16_t(r[1]) & int16_t(r[1]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1c1f: je 1c3c
+    if (ZF)
+        AOT_GOTO(0x1c3c, L1c3c);
+    AOT_GOTO(0x1c21, L1c21);
+L1c21:
+    AOT_BLOCK(0x1c21, 3);
+    // 1c21: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 1c24: mov di, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[7] = RD16(a);
+    }
+    // 1c27: cld
+    {
+        DF = false;
+    }
+    AOT_GOTO(0x1c28, L1c28);
+L1c28:
+    // 1c28: cmpsb
+    AOT_INTERP(0x1c28);
+L1c29:
+    AOT_BLOCK(0x1c29, 1);
+    // 1c29: jne 1c36
+    if (!ZF)
+        AOT_GOTO(0x1c36, L1c36);
+    AOT_GOTO(0x1c2b, L1c2b);
+L1c2b:
+    AOT_BLOCK(0x1c2b, 2);
+    // 1c2b: cmp byte [si-1], 0
+    {
+        a = uint16_t(r[6] - 1);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1c2f: je 1c3c
+    if (ZF)
+        AOT_GOTO(0x1c3c, L1c3c);
+    AOT_GOTO(0x1c31, L1c31);
+L1c31:
+    AOT_BLOCK(0x1c31, 2);
+    // 1c31: dec cx
+    {
+        val = int16_t(r[1]) - 1;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1c32: jne 1c28
+    if (!ZF)
+        AOT_GOTO(0x1c28, L1c28);
+    AOT_GOTO(0x1c34, L1c34);
+L1c34:
+    AOT_BLOCK(0x1c34, 1);
+    // 1c34: jmp short 1c3c
+    AOT_GOTO(0x1c3c, L1c3c);
+L1c36:
+    AOT_BLOCK(0x1c36, 1);
+    // 1c36: jnbe 1c3b
+    if (!(CF || ZF))
+        AOT_GOTO(0x1c3b, L1c3b);
+    AOT_GOTO(0x1c38, L1c38);
+L1c38:
+    AOT_BLOCK(0x1c38, 1);
+    // 1c38: sub ax, 0002
+    {
+        val = (dst = int16_t(r[0])) - (src = 2);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    AOT_GOTO(0x1c3b, L1c3b);
+L1c3b:
+    AOT_BLOCK(0x1c3b, 1);
+    // 1c3b: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1c3c, L1c3c);
+L1c3c:
+    AOT_BLOCK(0x1c3c, 4);
+    // 1c3c: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 1c3d: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 1c3e: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1c3f: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1c3f);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1c40:
+    AOT_BLOCK(0x1c40, 11);
+    // 1c40: mov di, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[7] = RD16(a);
+    }
+    // 1c43: xor al, al
+    {
+        val = int8_t(r[0]) ^ int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+    }
+    // 1c45: mov dx, cx
+    {
+        r[2] = r[1];
+    }
+    // 1c47: cld
+    {
+        DF = false;
+    }
+    // 1c48: rep scasb
+    {
+        if (r[1]) {
+            do {
+                val = int8_t(dst = uint8_t(r[0])) - int8_t(src = RD8(r[7]));
+                AF = (dst & 15) - (src & 15) < 0;
+                CF = dst < src;
+                OF = val != int8_t(val);
+                SF = int8_t(val) < 0;
+                ZF = int8_t(val) == 0;
+                PF = ptable[uint8_t(val)];
+                if (DF) r[7] -= 1;
+                else r[7] += 1;
+            } while (--r[1] && !ZF);
+        }
+    }
+    // 1c4a: sub dx, cx
+    {
+        val = (dst = int16_t(r[2])) - (src = int16_t(r[1]));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1c4c: xchg dx, cx
+    {
+        val = int16_t(r[1]);
+        r[1] = int16_t(r[2]);
+        r[2] = val;
+    }
+    // 1c4e: mov si, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[6] = RD16(a);
+    }
+    // 1c51: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 1c54: rep movsb
+    {
+        if (r[1]) {
+            do {
+                WR8(r[7], RD8(r[6]));
+                if (DF) {
+                    r[6] -= 1;
+                    r[7] -= 1;
+                } else {
+                    r[6] += 1;
+                    r[7] += 1;
+                }
+            } while (--r[1]);
+        }
+    }
+    // 1c56: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1c56);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1c57:
+    AOT_BLOCK(0x1c57, 10);
+    // 1c57: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1c58: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1c5a: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1c5b: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 1c5e: xor al, al
+    {
+        val = int8_t(r[0]) ^ int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+    }
+    // 1c60: mov dx, cx
+    {
+        r[2] = r[1];
+    }
+    // 1c62: cmp cl, 1
+    {
+        val = (dst = int8_t(r[1])) - (src = 1);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1c65: cld
+    {
+        DF = false;
+    }
+    // 1c66: rep scasb
+    {
+        if (r[1]) {
+            do {
+                val = int8_t(dst = uint8_t(r[0])) - int8_t(src = RD8(r[7]));
+                AF = (dst & 15) - (src & 15) < 0;
+                CF = dst < src;
+                OF = val != int8_t(val);
+                SF = int8_t(val) < 0;
+                ZF = int8_t(val) == 0;
+                PF = ptable[uint8_t(val)];
+                if (DF) r[7] -= 1;
+                else r[7] += 1;
+            } while (--r[1] && !ZF);
+        }
+    }
+    // 1c68: jne 1c6b
+    if (!ZF)
+        AOT_GOTO(0x1c6b, L1c6b);
+    AOT_GOTO(0x1c6a, L1c6a);
+L1c6a:
+    AOT_BLOCK(0x1c6a, 1);
+    // 1c6a: inc cx
+    {
+        val = int16_t(r[1]) + 1;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1c6b, L1c6b);
+L1c6b:
+    AOT_BLOCK(0x1c6b, 5);
+    // 1c6b: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 1c6d: sub ax, cx
+    {
+        val = (dst = int16_t(r[0])) - (src = int16_t(r[1]));
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1c6f: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 1c70: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1c71: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1c71);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1c72:
+    AOT_BLOCK(0x1c72, 5);
+    // 1c72: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1c73: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1c75: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1c76: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1c79: call 172e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1c7c);
+    }
+    AOT_GOTO(0x172e, L172e);
+L1c7c:
+    AOT_BLOCK(0x1c7c, 10);
+    // 1c7c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1c7d: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+    }
+    // 1c7e: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 1c80: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1c83: mov [bx+4], si
+    {
+        a = uint16_t(r[3] + 4);
+        WR16(a, r[6]);
+    }
+    // 1c86: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1c89: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1c8c: mov [bx+8], dx
+    {
+        a = uint16_t(r[3] + 8);
+        WR16(a, r[2]);
+    }
+    // 1c8f: cmp si, e
+    {
+        val = (dst = int16_t(r[6])) - (src = 14);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1c92: jnbe 1ca3
+    if (!(CF || ZF))
+        AOT_GOTO(0x1ca3, L1ca3);
+    AOT_GOTO(0x1c94, L1c94);
+L1c94:
+    AOT_BLOCK(0x1c94, 5);
+    // 1c94: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1c97: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1c9a: add bx, a
+    {
+        val = (dst = int16_t(r[3])) + (src = 10);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1c9d: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 1c9e: call 171c
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1ca1);
+    }
+    AOT_GOTO(0x171c, L171c);
+L1ca1:
+    AOT_BLOCK(0x1ca1, 2);
+    // 1ca1: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1ca2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x1ca3, L1ca3);
+L1ca3:
+    AOT_BLOCK(0x1ca3, 1);
+    // 1ca3: jmp 1d33
+    AOT_GOTO(0x1d33, L1d33);
+L1d09:
+    AOT_BLOCK(0x1d09, 2);
+    // 1d09: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 1d0b: mov cx, [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        r[1] = RD16(a);
+    }
+    AOT_GOTO(0x1d0e, L1d0e);
+L1d0e:
+    AOT_BLOCK(0x1d0e, 3);
+    // 1d0e: add bx, 4
+    {
+        val = (dst = int16_t(r[3])) + (src = 4);
+        r[3] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1d11: dec cx
+    {
+        val = int16_t(r[1]) - 1;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1d12: jl 1d28
+    if (SF != OF)
+        AOT_GOTO(0x1d28, L1d28);
+    AOT_GOTO(0x1d14, L1d14);
+L1d14:
+    AOT_BLOCK(0x1d14, 2);
+    // 1d14: cmp ax, [bx]
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(r[0])) - (src = int16_t(RD16(a)));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1d16: jne 1d0e
+    if (!ZF)
+        AOT_GOTO(0x1d0e, L1d0e);
+    AOT_GOTO(0x1d18, L1d18);
+L1d18:
+    AOT_BLOCK(0x1d18, 1);
+    // 1d18: mov bx, [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        r[3] = RD16(a);
+    }
+    AOT_GOTO(0x1d1b, L1d1b);
+L1d1b:
+    AOT_BLOCK(0x1d1b, 2);
+    // 1d1b: test bx, bx
+    {
+        val = int16_t(r[3]) & int16_t(r[3]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1d1d: jne 1d26
+    if (!ZF)
+        AOT_GOTO(0x1d26, L1d26);
+    AOT_GOTO(0x1d1f, L1d1f);
+L1d1f:
+    AOT_BLOCK(0x1d1f, 3);
+    // 1d1f: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 1d22: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1d23: jmp 1d2c
+    AOT_GOTO(0x1d2c, L1d2c);
+L1d26:
+    AOT_BLOCK(0x1d26, 1);
+    // 1d26: jmp bx
+    {
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L1d28:
+    AOT_BLOCK(0x1d28, 2);
+    // 1d28: mov bx, dx
+    {
+        r[3] = r[2];
+    }
+    // 1d2a: jmp short 1d1b
+    AOT_GOTO(0x1d1b, L1d1b);
+L1d2c:
+    AOT_BLOCK(0x1d2c, 1);
+    // 1d2c: call 1d95
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1d2f);
+    }
+    AOT_GOTO(0x1d95, L1d95);
+L1d2f:
+    AOT_BLOCK(0x1d2f, 1);
+    // 1d2f: call 1d3c
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1d32);
+    }
+    AOT_GOTO(0x1d3c, L1d3c);
+L1d32:
+    AOT_BLOCK(0x1d32, 1);
+    // 1d32: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    AOT_GOTO(0x1d33, L1d33);
+L1d33:
+    AOT_BLOCK(0x1d33, 1);
+    // 1d33: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    AOT_GOTO(0x1d34, L1d34);
+L1d34:
+    AOT_BLOCK(0x1d34, 3);
+    // 1d34: mov sp, bp
+    {
+        r[4] = r[5];
+    }
+    // 1d36: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1d37: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1d37);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1d3c:
+    AOT_BLOCK(0x1d3c, 1);
+    // 1d3c: call 16a9
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1d3f);
+    }
+    AOT_GOTO(0x16a9, L16a9);
+L1d3f:
+    AOT_BLOCK(0x1d3f, 3);
+    // 1d3f: mov ax, 0006
+    {
+        r[0] = 0x0006;
+    }
+    // 1d42: mov dx, 0e12
+    {
+        r[2] = 0x0e12;
+    }
+    // 1d45: jmp short 1d77
+    AOT_GOTO(0x1d77, L1d77);
+L1d77:
+    AOT_BLOCK(0x1d77, 4);
+    // 1d77: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+    }
+    // 1d79: xchg [0ed0], bx
+    {
+        a = 0x0ed0;
+        val = int16_t(r[3]);
+        r[3] = int16_t(RD16(a));
+        WR16(a, val);
+    }
+    // 1d7d: test bx, bx
+    {
+        val = int16_t(r[3]) & int16_t(r[3]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1d7f: je 1d86
+    if (ZF)
+        AOT_GOTO(0x1d86, L1d86);
+    AOT_GOTO(0x1d81, L1d81);
+L1d81:
+    AOT_BLOCK(0x1d81, 2);
+    // 1d81: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1d82: call bx
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1d84);
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L1d84:
+    AOT_BLOCK(0x1d84, 2);
+    // 1d84: pop ax
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[0] = val;
+    }
+    // 1d85: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1d85);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1d86:
+    AOT_BLOCK(0x1d86, 6);
+    // 1d86: mov bx, 0016
+    {
+        r[3] = 0x0016;
+    }
+    // 1d89: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 1d8a: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1d8b: mov ax, 0002
+    {
+        r[0] = 0x0002;
+    }
+    // 1d8e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1d8f: call 1dcd
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1d92);
+    }
+    AOT_GOTO(0x1dcd, L1dcd);
+L1d92:
+    AOT_BLOCK(0x1d92, 1);
+    // 1d92: call 16a9
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1d95);
+    }
+    AOT_GOTO(0x16a9, L16a9);
+L1d95:
+    AOT_BLOCK(0x1d95, 3);
+    // 1d95: mov dx, ax
+    {
+        r[2] = r[0];
+    }
+    // 1d97: cmp dx, 15
+    {
+        val = (dst = int16_t(r[2])) - (src = 21);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1d9a: jnb 1dad
+    if (!CF)
+        AOT_GOTO(0x1dad, L1dad);
+    AOT_GOTO(0x1d9c, L1d9c);
+L1d9c:
+    AOT_BLOCK(0x1d9c, 6);
+    // 1d9c: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 1d9e: mov bx, 0de8
+    {
+        r[3] = 0x0de8;
+    }
+    // 1da1: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 1da3: mov bx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[3] = RD16(a);
+    }
+    // 1da5: test bx, bx
+    {
+        val = int16_t(r[3]) & int16_t(r[3]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1da7: je 1dad
+    if (ZF)
+        AOT_GOTO(0x1dad, L1dad);
+    AOT_GOTO(0x1da9, L1da9);
+L1da9:
+    AOT_BLOCK(0x1da9, 2);
+    // 1da9: mov dx, bx
+    {
+        r[2] = r[3];
+    }
+    // 1dab: jmp short 1dcb
+    AOT_GOTO(0x1dcb, L1dcb);
+L1dad:
+    AOT_BLOCK(0x1dad, 3);
+    // 1dad: mov bx, 0ec1
+    {
+        r[3] = 0x0ec1;
+    }
+    // 1db0: mov cx, 0006
+    {
+        r[1] = 0x0006;
+    }
+    // 1db3: mov dx, ax
+    {
+        r[2] = r[0];
+    }
+    AOT_GOTO(0x1db5, L1db5);
+L1db5:
+    AOT_BLOCK(0x1db5, 8);
+    // 1db5: and dx, 0007
+    {
+        val = int16_t(r[2]) & 7;
+        r[2] = val;
+    }
+    // 1db9: add dx, [0030]
+    {
+        a = 0x0030;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 1dbd: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1dbf: dec bx
+    {
+        val = int16_t(r[3]) - 1;
+        r[3] = val;
+        AF = (val & 15) == 15;
+    }
+    // 1dc0: sar dx, 1
+    {
+        val = int16_t(r[2]) >> (1 - 1);
+        r[2] = val >> 1;
+        SF = int16_t((val >> 1)) < 0;
+        ZF = int16_t((val >> 1)) == 0;
+        PF = ptable[uint8_t((val >> 1))];
+        CF = val & 1;
+        OF = false;
+    }
+    // 1dc2: sar dx, 1
+    {
+        val = int16_t(r[2]) >> (1 - 1);
+        r[2] = val >> 1;
+        SF = int16_t((val >> 1)) < 0;
+        ZF = int16_t((val >> 1)) == 0;
+        PF = ptable[uint8_t((val >> 1))];
+        CF = val & 1;
+        OF = false;
+    }
+    // 1dc4: sar dx, 1
+    {
+        val = int16_t(r[2]) >> (1 - 1);
+        r[2] = val >> 1;
+        SF = int16_t((val >> 1)) < 0;
+        ZF = int16_t((val >> 1)) == 0;
+        PF = ptable[uint8_t((val >> 1))];
+        CF = val & 1;
+        OF = false;
+    }
+    // 1dc6: loop 1db5
+    {
+        r[1]--;
+    }
+    if (r[1] > 0)
+        AOT_GOTO(0x1db5, L1db5);
+    AOT_GOTO(0x1dc8, L1dc8);
+L1dc8:
+    AOT_BLOCK(0x1dc8, 1);
+    // 1dc8: mov dx, 0eb3
+    {
+        r[2] = 0x0eb3;
+    }
+    AOT_GOTO(0x1dcb, L1dcb);
+L1dcb:
+    AOT_BLOCK(0x1dcb, 1);
+    // 1dcb: jmp short 1d77
+    AOT_GOTO(0x1d77, L1d77);
+L1dcd:
+    AOT_BLOCK(0x1dcd, 16);
+    // 1dcd: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1dce: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1dd0: mov [10fa], 0004
+    {
+        a = 0x10fa;
+        WR16(a, 0x0004);
+    }
+    // 1dd6: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 1dd9: mov [10fc], bx
+    {
+        a = 0x10fc;
+        WR16(a, r[3]);
+    }
+    // 1ddd: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 1de0: mov [10fe], bx
+    {
+        a = 0x10fe;
+        WR16(a, r[3]);
+    }
+    // 1de4: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1de7: mov [1102], bx
+    {
+        a = 0x1102;
+        WR16(a, r[3]);
+    }
+    // 1deb: mov ax, 10f8
+    {
+        r[0] = 0x10f8;
+    }
+    // 1dee: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1def: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1df2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1df3: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1df6: mov bx, 10f8
+    {
+        r[3] = 0x10f8;
+    }
+    // 1df9: mov cx, 0003
+    {
+        r[1] = 0x0003;
+    }
+    // 1dfc: int 20
+    AOT_INTERP(0x1dfc);
+L1dfe:
+    AOT_BLOCK(0x1dfe, 3);
+    // 1dfe: mov sp, bp
+    {
+        r[4] = r[5];
+    }
+    // 1e00: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1e01: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1e01);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("m2/bin/cc", 0x0000, 7696, 0xb75a9e75u, run);
+}
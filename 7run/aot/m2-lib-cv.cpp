@@ -0,0 +1,22040 @@
+// m2/lib/cv translated by 7aot: 846 blocks, do not edit
+#include "../i8086/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.IP) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x0004: goto L0004;
+        case 0x0006: goto L0006;
+        case 0x000c: goto L000c;
+        case 0x0010: goto L0010;
+        case 0x0013: goto L0013;
+        case 0x0019: goto L0019;
+        case 0x001e: goto L001e;
+        case 0x0024: goto L0024;
+        case 0x0028: goto L0028;
+        case 0x0030: goto L0030;
+        case 0x0034: goto L0034;
+        case 0x0038: goto L0038;
+        case 0x0039: goto L0039;
+        case 0x004c: goto L004c;
+        case 0x0056: goto L0056;
+        case 0x005e: goto L005e;
+        case 0x0061: goto L0061;
+        case 0x0065: goto L0065;
+        case 0x0068: goto L0068;
+        case 0x006d: goto L006d;
+        case 0x006f: goto L006f;
+        case 0x0070: goto L0070;
+        case 0x0073: goto L0073;
+        case 0x0076: goto L0076;
+        case 0x0080: goto L0080;
+        case 0x0089: goto L0089;
+        case 0x0093: goto L0093;
+        case 0x0095: goto L0095;
+        case 0x00a2: goto L00a2;
+        case 0x00a8: goto L00a8;
+        case 0x00ad: goto L00ad;
+        case 0x00b7: goto L00b7;
+        case 0x00b8: goto L00b8;
+        case 0x00bb: goto L00bb;
+        case 0x00c4: goto L00c4;
+        case 0x00c8: goto L00c8;
+        case 0x00d1: goto L00d1;
+        case 0x00d8: goto L00d8;
+        case 0x00e1: goto L00e1;
+        case 0x00e8: goto L00e8;
+        case 0x00e9: goto L00e9;
+        case 0x00f0: goto L00f0;
+        case 0x00f4: goto L00f4;
+        case 0x00f7: goto L00f7;
+        case 0x00f8: goto L00f8;
+        case 0x00ff: goto L00ff;
+        case 0x010a: goto L010a;
+        case 0x010c: goto L010c;
+        case 0x0113: goto L0113;
+        case 0x011a: goto L011a;
+        case 0x0129: goto L0129;
+        case 0x012c: goto L012c;
+        case 0x0137: goto L0137;
+        case 0x0138: goto L0138;
+        case 0x0147: goto L0147;
+        case 0x0151: goto L0151;
+        case 0x015f: goto L015f;
+        case 0x0169: goto L0169;
+        case 0x0177: goto L0177;
+        case 0x0181: goto L0181;
+        case 0x018f: goto L018f;
+        case 0x0199: goto L0199;
+        case 0x01a3: goto L01a3;
+        case 0x01ae: goto L01ae;
+        case 0x01b5: goto L01b5;
+        case 0x01b8: goto L01b8;
+        case 0x01c2: goto L01c2;
+        case 0x01c9: goto L01c9;
+        case 0x01ca: goto L01ca;
+        case 0x01e0: goto L01e0;
+        case 0x01e6: goto L01e6;
+        case 0x01ed: goto L01ed;
+        case 0x01ee: goto L01ee;
+        case 0x0233: goto L0233;
+        case 0x024d: goto L024d;
+        case 0x0253: goto L0253;
+        case 0x0256: goto L0256;
+        case 0x025a: goto L025a;
+        case 0x025d: goto L025d;
+        case 0x025e: goto L025e;
+        case 0x0261: goto L0261;
+        case 0x0269: goto L0269;
+        case 0x0270: goto L0270;
+        case 0x0284: goto L0284;
+        case 0x0288: goto L0288;
+        case 0x028a: goto L028a;
+        case 0x0290: goto L0290;
+        case 0x0293: goto L0293;
+        case 0x029a: goto L029a;
+        case 0x029e: goto L029e;
+        case 0x02a6: goto L02a6;
+        case 0x02ad: goto L02ad;
+        case 0x02ce: goto L02ce;
+        case 0x02eb: goto L02eb;
+        case 0x02f1: goto L02f1;
+        case 0x02f8: goto L02f8;
+        case 0x02fb: goto L02fb;
+        case 0x0311: goto L0311;
+        case 0x0317: goto L0317;
+        case 0x031e: goto L031e;
+        case 0x031f: goto L031f;
+        case 0x0335: goto L0335;
+        case 0x033b: goto L033b;
+        case 0x0342: goto L0342;
+        case 0x0343: goto L0343;
+        case 0x034a: goto L034a;
+        case 0x0360: goto L0360;
+        case 0x0366: goto L0366;
+        case 0x036d: goto L036d;
+        case 0x036e: goto L036e;
+        case 0x0378: goto L0378;
+        case 0x037f: goto L037f;
+        case 0x0380: goto L0380;
+        case 0x0385: goto L0385;
+        case 0x038c: goto L038c;
+        case 0x0393: goto L0393;
+        case 0x039a: goto L039a;
+        case 0x03a1: goto L03a1;
+        case 0x03a8: goto L03a8;
+        case 0x03af: goto L03af;
+        case 0x03b6: goto L03b6;
+        case 0x03be: goto L03be;
+        case 0x03c6: goto L03c6;
+        case 0x03ce: goto L03ce;
+        case 0x03d2: goto L03d2;
+        case 0x03d9: goto L03d9;
+        case 0x03e3: goto L03e3;
+        case 0x03e5: goto L03e5;
+        case 0x03ea: goto L03ea;
+        case 0x0400: goto L0400;
+        case 0x0412: goto L0412;
+        case 0x041a: goto L041a;
+        case 0x041c: goto L041c;
+        case 0x042b: goto L042b;
+        case 0x0442: goto L0442;
+        case 0x0451: goto L0451;
+        case 0x0453: goto L0453;
+        case 0x0456: goto L0456;
+        case 0x047a: goto L047a;
+        case 0x047d: goto L047d;
+        case 0x047e: goto L047e;
+        case 0x0485: goto L0485;
+        case 0x0487: goto L0487;
+        case 0x048c: goto L048c;
+        case 0x0492: goto L0492;
+        case 0x0494: goto L0494;
+        case 0x049b: goto L049b;
+        case 0x04a2: goto L04a2;
+        case 0x04a8: goto L04a8;
+        case 0x04b9: goto L04b9;
+        case 0x04cd: goto L04cd;
+        case 0x04e5: goto L04e5;
+        case 0x04fd: goto L04fd;
+        case 0x0500: goto L0500;
+        case 0x0502: goto L0502;
+        case 0x0506: goto L0506;
+        case 0x0509: goto L0509;
+        case 0x050d: goto L050d;
+        case 0x0515: goto L0515;
+        case 0x051c: goto L051c;
+        case 0x051e: goto L051e;
+        case 0x0523: goto L0523;
+        case 0x0529: goto L0529;
+        case 0x052b: goto L052b;
+        case 0x0532: goto L0532;
+        case 0x0539: goto L0539;
+        case 0x053f: goto L053f;
+        case 0x0554: goto L0554;
+        case 0x056c: goto L056c;
+        case 0x056f: goto L056f;
+        case 0x0586: goto L0586;
+        case 0x05bb: goto L05bb;
+        case 0x05ce: goto L05ce;
+        case 0x05e0: goto L05e0;
+        case 0x05e8: goto L05e8;
+        case 0x05f1: goto L05f1;
+        case 0x05f4: goto L05f4;
+        case 0x05ff: goto L05ff;
+        case 0x0603: goto L0603;
+        case 0x060a: goto L060a;
+        case 0x0611: goto L0611;
+        case 0x0618: goto L0618;
+        case 0x061f: goto L061f;
+        case 0x0626: goto L0626;
+        case 0x062d: goto L062d;
+        case 0x0634: goto L0634;
+        case 0x0646: goto L0646;
+        case 0x064b: goto L064b;
+        case 0x0654: goto L0654;
+        case 0x0659: goto L0659;
+        case 0x065f: goto L065f;
+        case 0x0664: goto L0664;
+        case 0x0672: goto L0672;
+        case 0x0677: goto L0677;
+        case 0x068b: goto L068b;
+        case 0x0691: goto L0691;
+        case 0x0693: goto L0693;
+        case 0x0699: goto L0699;
+        case 0x06a6: goto L06a6;
+        case 0x06a9: goto L06a9;
+        case 0x06b1: goto L06b1;
+        case 0x06b3: goto L06b3;
+        case 0x06b8: goto L06b8;
+        case 0x06c3: goto L06c3;
+        case 0x06c6: goto L06c6;
+        case 0x06c7: goto L06c7;
+        case 0x06cc: goto L06cc;
+        case 0x06d3: goto L06d3;
+        case 0x06e6: goto L06e6;
+        case 0x06ef: goto L06ef;
+        case 0x06f6: goto L06f6;
+        case 0x06fd: goto L06fd;
+        case 0x0700: goto L0700;
+        case 0x0712: goto L0712;
+        case 0x0725: goto L0725;
+        case 0x072f: goto L072f;
+        case 0x0736: goto L0736;
+        case 0x0737: goto L0737;
+        case 0x073e: goto L073e;
+        case 0x0742: goto L0742;
+        case 0x074c: goto L074c;
+        case 0x0750: goto L0750;
+        case 0x0770: goto L0770;
+        case 0x0776: goto L0776;
+        case 0x0786: goto L0786;
+        case 0x0789: goto L0789;
+        case 0x0799: goto L0799;
+        case 0x07ce: goto L07ce;
+        case 0x07da: goto L07da;
+        case 0x07e3: goto L07e3;
+        case 0x07e7: goto L07e7;
+        case 0x07ee: goto L07ee;
+        case 0x07ef: goto L07ef;
+        case 0x07f2: goto L07f2;
+        case 0x07f8: goto L07f8;
+        case 0x07fd: goto L07fd;
+        case 0x0810: goto L0810;
+        case 0x0824: goto L0824;
+        case 0x0832: goto L0832;
+        case 0x0836: goto L0836;
+        case 0x085e: goto L085e;
+        case 0x087e: goto L087e;
+        case 0x0896: goto L0896;
+        case 0x0994: goto L0994;
+        case 0x09e8: goto L09e8;
+        case 0x0a3a: goto L0a3a;
+        case 0x0a5a: goto L0a5a;
+        case 0x0a63: goto L0a63;
+        case 0x0a73: goto L0a73;
+        case 0x0a77: goto L0a77;
+        case 0x0a86: goto L0a86;
+        case 0x0a89: goto L0a89;
+        case 0x0bb5: goto L0bb5;
+        case 0x0bb8: goto L0bb8;
+        case 0x0bdc: goto L0bdc;
+        case 0x0bef: goto L0bef;
+        case 0x0cc6: goto L0cc6;
+        case 0x0cdc: goto L0cdc;
+        case 0x0ce6: goto L0ce6;
+        case 0x0cf8: goto L0cf8;
+        case 0x0d07: goto L0d07;
+        case 0x0d16: goto L0d16;
+        case 0x0d19: goto L0d19;
+        case 0x0db2: goto L0db2;
+        case 0x0db5: goto L0db5;
+        case 0x0dc8: goto L0dc8;
+        case 0x0dce: goto L0dce;
+        case 0x0dd6: goto L0dd6;
+        case 0x0dde: goto L0dde;
+        case 0x0de7: goto L0de7;
+        case 0x0de9: goto L0de9;
+        case 0x0dee: goto L0dee;
+        case 0x0df3: goto L0df3;
+        case 0x0df9: goto L0df9;
+        case 0x0e05: goto L0e05;
+        case 0x0e0c: goto L0e0c;
+        case 0x0e0f: goto L0e0f;
+        case 0x0e2a: goto L0e2a;
+        case 0x0e2d: goto L0e2d;
+        case 0x0e3d: goto L0e3d;
+        case 0x0e46: goto L0e46;
+        case 0x0e5a: goto L0e5a;
+        case 0x0e61: goto L0e61;
+        case 0x0e69: goto L0e69;
+        case 0x0e6c: goto L0e6c;
+        case 0x0e76: goto L0e76;
+        case 0x0e78: goto L0e78;
+        case 0x0e7b: goto L0e7b;
+        case 0x0e81: goto L0e81;
+        case 0x0e88: goto L0e88;
+        case 0x0e8e: goto L0e8e;
+        case 0x0e94: goto L0e94;
+        case 0x0e98: goto L0e98;
+        case 0x0ea9: goto L0ea9;
+        case 0x0ec0: goto L0ec0;
+        case 0x0eca: goto L0eca;
+        case 0x0ece: goto L0ece;
+        case 0x0ed3: goto L0ed3;
+        case 0x0ed7: goto L0ed7;
+        case 0x0eea: goto L0eea;
+        case 0x0ef2: goto L0ef2;
+        case 0x0ef5: goto L0ef5;
+        case 0x0f03: goto L0f03;
+        case 0x0f08: goto L0f08;
+        case 0x0f0d: goto L0f0d;
+        case 0x0f13: goto L0f13;
+        case 0x0f16: goto L0f16;
+        case 0x0f29: goto L0f29;
+        case 0x0f34: goto L0f34;
+        case 0x0f3b: goto L0f3b;
+        case 0x0f42: goto L0f42;
+        case 0x0f4a: goto L0f4a;
+        case 0x0f4f: goto L0f4f;
+        case 0x0f68: goto L0f68;
+        case 0x0f71: goto L0f71;
+        case 0x0f75: goto L0f75;
+        case 0x0f87: goto L0f87;
+        case 0x0f8b: goto L0f8b;
+        case 0x0f93: goto L0f93;
+        case 0x0fa2: goto L0fa2;
+        case 0x0fa8: goto L0fa8;
+        case 0x0fb1: goto L0fb1;
+        case 0x0fb7: goto L0fb7;
+        case 0x0fbb: goto L0fbb;
+        case 0x0fc2: goto L0fc2;
+        case 0x0fc8: goto L0fc8;
+        case 0x0fcd: goto L0fcd;
+        case 0x0fd3: goto L0fd3;
+        case 0x0fd5: goto L0fd5;
+        case 0x10c4: goto L10c4;
+        case 0x10d6: goto L10d6;
+        case 0x10dc: goto L10dc;
+        case 0x10e0: goto L10e0;
+        case 0x10e5: goto L10e5;
+        case 0x10eb: goto L10eb;
+        case 0x10f4: goto L10f4;
+        case 0x10fb: goto L10fb;
+        case 0x1102: goto L1102;
+        case 0x1106: goto L1106;
+        case 0x110e: goto L110e;
+        case 0x111b: goto L111b;
+        case 0x111f: goto L111f;
+        case 0x1127: goto L1127;
+        case 0x1137: goto L1137;
+        case 0x113a: goto L113a;
+        case 0x1149: goto L1149;
+        case 0x115d: goto L115d;
+        case 0x1164: goto L1164;
+        case 0x1169: goto L1169;
+        case 0x1170: goto L1170;
+        case 0x1172: goto L1172;
+        case 0x1175: goto L1175;
+        case 0x118d: goto L118d;
+        case 0x1191: goto L1191;
+        case 0x1197: goto L1197;
+        case 0x119b: goto L119b;
+        case 0x11a0: goto L11a0;
+        case 0x11a4: goto L11a4;
+        case 0x11a9: goto L11a9;
+        case 0x11ad: goto L11ad;
+        case 0x11b0: goto L11b0;
+        case 0x11b3: goto L11b3;
+        case 0x11c8: goto L11c8;
+        case 0x11d0: goto L11d0;
+        case 0x11d3: goto L11d3;
+        case 0x11d9: goto L11d9;
+        case 0x11e7: goto L11e7;
+        case 0x11ea: goto L11ea;
+        case 0x11ed: goto L11ed;
+        case 0x11f5: goto L11f5;
+        case 0x11ff: goto L11ff;
+        case 0x1208: goto L1208;
+        case 0x120c: goto L120c;
+        case 0x121c: goto L121c;
+        case 0x1222: goto L1222;
+        case 0x1223: goto L1223;
+        case 0x1226: goto L1226;
+        case 0x123f: goto L123f;
+        case 0x1246: goto L1246;
+        case 0x124c: goto L124c;
+        case 0x1252: goto L1252;
+        case 0x1258: goto L1258;
+        case 0x125e: goto L125e;
+        case 0x1264: goto L1264;
+        case 0x1274: goto L1274;
+        case 0x1277: goto L1277;
+        case 0x127d: goto L127d;
+        case 0x1280: goto L1280;
+        case 0x1286: goto L1286;
+        case 0x128d: goto L128d;
+        case 0x1292: goto L1292;
+        case 0x1299: goto L1299;
+        case 0x12a1: goto L12a1;
+        case 0x12a8: goto L12a8;
+        case 0x12b8: goto L12b8;
+        case 0x12bf: goto L12bf;
+        case 0x12c7: goto L12c7;
+        case 0x12ce: goto L12ce;
+        case 0x12de: goto L12de;
+        case 0x12e4: goto L12e4;
+        case 0x12e8: goto L12e8;
+        case 0x12ee: goto L12ee;
+        case 0x12f4: goto L12f4;
+        case 0x1304: goto L1304;
+        case 0x1312: goto L1312;
+        case 0x131c: goto L131c;
+        case 0x1327: goto L1327;
+        case 0x1335: goto L1335;
+        case 0x133d: goto L133d;
+        case 0x1348: goto L1348;
+        case 0x134f: goto L134f;
+        case 0x1355: goto L1355;
+        case 0x1358: goto L1358;
+        case 0x1367: goto L1367;
+        case 0x1370: goto L1370;
+        case 0x1373: goto L1373;
+        case 0x138b: goto L138b;
+        case 0x1399: goto L1399;
+        case 0x13a3: goto L13a3;
+        case 0x13ae: goto L13ae;
+        case 0x13ba: goto L13ba;
+        case 0x13c1: goto L13c1;
+        case 0x13c4: goto L13c4;
+        case 0x13cf: goto L13cf;
+        case 0x13ed: goto L13ed;
+        case 0x13f4: goto L13f4;
+        case 0x1402: goto L1402;
+        case 0x140c: goto L140c;
+        case 0x1416: goto L1416;
+        case 0x1422: goto L1422;
+        case 0x1429: goto L1429;
+        case 0x143a: goto L143a;
+        case 0x1441: goto L1441;
+        case 0x1445: goto L1445;
+        case 0x1448: goto L1448;
+        case 0x145e: goto L145e;
+        case 0x1469: goto L1469;
+        case 0x146e: goto L146e;
+        case 0x1473: goto L1473;
+        case 0x1476: goto L1476;
+        case 0x1481: goto L1481;
+        case 0x1491: goto L1491;
+        case 0x14a1: goto L14a1;
+        case 0x14a6: goto L14a6;
+        case 0x14b5: goto L14b5;
+        case 0x14bd: goto L14bd;
+        case 0x14bf: goto L14bf;
+        case 0x14ca: goto L14ca;
+        case 0x14d9: goto L14d9;
+        case 0x14df: goto L14df;
+        case 0x14e8: goto L14e8;
+        case 0x14f1: goto L14f1;
+        case 0x14f7: goto L14f7;
+        case 0x1501: goto L1501;
+        case 0x150a: goto L150a;
+        case 0x1511: goto L1511;
+        case 0x1517: goto L1517;
+        case 0x1521: goto L1521;
+        case 0x1526: goto L1526;
+        case 0x152c: goto L152c;
+        case 0x1530: goto L1530;
+        case 0x1537: goto L1537;
+        case 0x153f: goto L153f;
+        case 0x1545: goto L1545;
+        case 0x154a: goto L154a;
+        case 0x1554: goto L1554;
+        case 0x1558: goto L1558;
+        case 0x1584: goto L1584;
+        case 0x1587: goto L1587;
+        case 0x159e: goto L159e;
+        case 0x15a4: goto L15a4;
+        case 0x15bd: goto L15bd;
+        case 0x15c5: goto L15c5;
+        case 0x15cb: goto L15cb;
+        case 0x15d2: goto L15d2;
+        case 0x15e1: goto L15e1;
+        case 0x15ea: goto L15ea;
+        case 0x15ed: goto L15ed;
+        case 0x15f3: goto L15f3;
+        case 0x15f8: goto L15f8;
+        case 0x15fe: goto L15fe;
+        case 0x1603: goto L1603;
+        case 0x1606: goto L1606;
+        case 0x1609: goto L1609;
+        case 0x160d: goto L160d;
+        case 0x1615: goto L1615;
+        case 0x1619: goto L1619;
+        case 0x161d: goto L161d;
+        case 0x1621: goto L1621;
+        case 0x162f: goto L162f;
+        case 0x1634: goto L1634;
+        case 0x163f: goto L163f;
+        case 0x1652: goto L1652;
+        case 0x166c: goto L166c;
+        case 0x1672: goto L1672;
+        case 0x1688: goto L1688;
+        case 0x1699: goto L1699;
+        case 0x169f: goto L169f;
+        case 0x16ba: goto L16ba;
+        case 0x16c0: goto L16c0;
+        case 0x16d6: goto L16d6;
+        case 0x16e7: goto L16e7;
+        case 0x16ed: goto L16ed;
+        case 0x16fd: goto L16fd;
+        case 0x1705: goto L1705;
+        case 0x1706: goto L1706;
+        case 0x170b: goto L170b;
+        case 0x1738: goto L1738;
+        case 0x173f: goto L173f;
+        case 0x1749: goto L1749;
+        case 0x174f: goto L174f;
+        case 0x1754: goto L1754;
+        case 0x1764: goto L1764;
+        case 0x176a: goto L176a;
+        case 0x1788: goto L1788;
+        case 0x1792: goto L1792;
+        case 0x179a: goto L179a;
+        case 0x17a9: goto L17a9;
+        case 0x17af: goto L17af;
+        case 0x17d6: goto L17d6;
+        case 0x17dc: goto L17dc;
+        case 0x17ec: goto L17ec;
+        case 0x17f2: goto L17f2;
+        case 0x1802: goto L1802;
+        case 0x1813: goto L1813;
+        case 0x1819: goto L1819;
+        case 0x1840: goto L1840;
+        case 0x1846: goto L1846;
+        case 0x1855: goto L1855;
+        case 0x1870: goto L1870;
+        case 0x1872: goto L1872;
+        case 0x187d: goto L187d;
+        case 0x1883: goto L1883;
+        case 0x1890: goto L1890;
+        case 0x1895: goto L1895;
+        case 0x189a: goto L189a;
+        case 0x18ae: goto L18ae;
+        case 0x18b4: goto L18b4;
+        case 0x18c4: goto L18c4;
+        case 0x18d5: goto L18d5;
+        case 0x18db: goto L18db;
+        case 0x18ee: goto L18ee;
+        case 0x1901: goto L1901;
+        case 0x1907: goto L1907;
+        case 0x1917: goto L1917;
+        case 0x1928: goto L1928;
+        case 0x1936: goto L1936;
+        case 0x193c: goto L193c;
+        case 0x1942: goto L1942;
+        case 0x1952: goto L1952;
+        case 0x1958: goto L1958;
+        case 0x195e: goto L195e;
+        case 0x1964: goto L1964;
+        case 0x1968: goto L1968;
+        case 0x1974: goto L1974;
+        case 0x197a: goto L197a;
+        case 0x1980: goto L1980;
+        case 0x1984: goto L1984;
+        case 0x198c: goto L198c;
+        case 0x1992: goto L1992;
+        case 0x1997: goto L1997;
+        case 0x199d: goto L199d;
+        case 0x19a3: goto L19a3;
+        case 0x19a9: goto L19a9;
+        case 0x19af: goto L19af;
+        case 0x19b9: goto L19b9;
+        case 0x19be: goto L19be;
+        case 0x19c1: goto L19c1;
+        case 0x19c6: goto L19c6;
+        case 0x19cd: goto L19cd;
+        case 0x19d4: goto L19d4;
+        case 0x19db: goto L19db;
+        case 0x19e2: goto L19e2;
+        case 0x19ec: goto L19ec;
+        case 0x19fc: goto L19fc;
+        case 0x1a07: goto L1a07;
+        case 0x1a0c: goto L1a0c;
+        case 0x1a16: goto L1a16;
+        case 0x1a21: goto L1a21;
+        case 0x1a23: goto L1a23;
+        case 0x1a26: goto L1a26;
+        case 0x1a37: goto L1a37;
+        case 0x1a47: goto L1a47;
+        case 0x1a4a: goto L1a4a;
+        case 0x1a50: goto L1a50;
+        case 0x1a57: goto L1a57;
+        case 0x1a67: goto L1a67;
+        case 0x1a6e: goto L1a6e;
+        case 0x1a71: goto L1a71;
+        case 0x1a77: goto L1a77;
+        case 0x1a7d: goto L1a7d;
+        case 0x1a85: goto L1a85;
+        case 0x1a8b: goto L1a8b;
+        case 0x1a90: goto L1a90;
+        case 0x1a94: goto L1a94;
+        case 0x1a9a: goto L1a9a;
+        case 0x1aa0: goto L1aa0;
+        case 0x1aa6: goto L1aa6;
+        case 0x1aac: goto L1aac;
+        case 0x1ab2: goto L1ab2;
+        case 0x1ab8: goto L1ab8;
+        case 0x1ac4: goto L1ac4;
+        case 0x1ac7: goto L1ac7;
+        case 0x1acd: goto L1acd;
+        case 0x1ae1: goto L1ae1;
+        case 0x1aec: goto L1aec;
+        case 0x1af0: goto L1af0;
+        case 0x1af8: goto L1af8;
+        case 0x1b0f: goto L1b0f;
+        case 0x1b1b: goto L1b1b;
+        case 0x1b1f: goto L1b1f;
+        case 0x1b25: goto L1b25;
+        case 0x1b2b: goto L1b2b;
+        case 0x1b32: goto L1b32;
+        case 0x1b38: goto L1b38;
+        case 0x1b3d: goto L1b3d;
+        case 0x1b43: goto L1b43;
+        case 0x1b47: goto L1b47;
+        case 0x1b4d: goto L1b4d;
+        case 0x1b51: goto L1b51;
+        case 0x1b5d: goto L1b5d;
+        case 0x1b67: goto L1b67;
+        case 0x1b71: goto L1b71;
+        case 0x1b7b: goto L1b7b;
+        case 0x1b87: goto L1b87;
+        case 0x1b8e: goto L1b8e;
+        case 0x1b9e: goto L1b9e;
+        case 0x1ba5: goto L1ba5;
+        case 0x1ba8: goto L1ba8;
+        case 0x1bae: goto L1bae;
+        case 0x1bb4: goto L1bb4;
+        case 0x1bbc: goto L1bbc;
+        case 0x1bc2: goto L1bc2;
+        case 0x1bc8: goto L1bc8;
+        case 0x1bce: goto L1bce;
+        case 0x1be2: goto L1be2;
+        case 0x1be8: goto L1be8;
+        case 0x1c00: goto L1c00;
+        case 0x1c14: goto L1c14;
+        case 0x1c27: goto L1c27;
+        case 0x1c2c: goto L1c2c;
+        case 0x1c32: goto L1c32;
+        case 0x1c38: goto L1c38;
+        case 0x1c3e: goto L1c3e;
+        case 0x1c41: goto L1c41;
+        case 0x1c49: goto L1c49;
+        case 0x1c4c: goto L1c4c;
+        case 0x1c54: goto L1c54;
+        case 0x1c5a: goto L1c5a;
+        case 0x1c61: goto L1c61;
+        case 0x1c67: goto L1c67;
+        case 0x1c6b: goto L1c6b;
+        case 0x1c81: goto L1c81;
+        case 0x1c8a: goto L1c8a;
+        case 0x1c94: goto L1c94;
+        case 0x1c9b: goto L1c9b;
+        case 0x1c9f: goto L1c9f;
+        case 0x1cb6: goto L1cb6;
+        case 0x1cbf: goto L1cbf;
+        case 0x1cd7: goto L1cd7;
+        case 0x1cdd: goto L1cdd;
+        case 0x1ce3: goto L1ce3;
+        case 0x1ce8: goto L1ce8;
+        case 0x1cee: goto L1cee;
+        case 0x1cf3: goto L1cf3;
+        case 0x1cfa: goto L1cfa;
+        case 0x1cff: goto L1cff;
+        case 0x1d16: goto L1d16;
+        case 0x1d1e: goto L1d1e;
+        case 0x1d3e: goto L1d3e;
+        case 0x1d50: goto L1d50;
+        case 0x1d5b: goto L1d5b;
+        case 0x1d60: goto L1d60;
+        case 0x1d74: goto L1d74;
+        case 0x1d7a: goto L1d7a;
+        case 0x1d80: goto L1d80;
+        case 0x1d86: goto L1d86;
+        case 0x1d8c: goto L1d8c;
+        case 0x1d92: goto L1d92;
+        case 0x1d9a: goto L1d9a;
+        case 0x1d9f: goto L1d9f;
+        case 0x1da4: goto L1da4;
+        case 0x1da7: goto L1da7;
+        case 0x1db2: goto L1db2;
+        case 0x1db5: goto L1db5;
+        case 0x1dbb: goto L1dbb;
+        case 0x1dbe: goto L1dbe;
+        case 0x1dca: goto L1dca;
+        case 0x1dcd: goto L1dcd;
+        case 0x1dd3: goto L1dd3;
+        case 0x1de0: goto L1de0;
+        case 0x1df5: goto L1df5;
+        case 0x1e03: goto L1e03;
+        case 0x1e06: goto L1e06;
+        case 0x1e0c: goto L1e0c;
+        case 0x1e0f: goto L1e0f;
+        case 0x1e15: goto L1e15;
+        case 0x1e1d: goto L1e1d;
+        case 0x1e23: goto L1e23;
+        case 0x1e32: goto L1e32;
+        case 0x1e47: goto L1e47;
+        case 0x1e55: goto L1e55;
+        case 0x1e58: goto L1e58;
+        case 0x1e5e: goto L1e5e;
+        case 0x1e65: goto L1e65;
+        case 0x1e7a: goto L1e7a;
+        case 0x1e88: goto L1e88;
+        case 0x1e8b: goto L1e8b;
+        case 0x1e91: goto L1e91;
+        case 0x1e97: goto L1e97;
+        case 0x1e9f: goto L1e9f;
+        case 0x1ea5: goto L1ea5;
+        case 0x1eac: goto L1eac;
+        case 0x1ebc: goto L1ebc;
+        case 0x1ec3: goto L1ec3;
+        case 0x1ec6: goto L1ec6;
+        case 0x1ecc: goto L1ecc;
+        case 0x1ed2: goto L1ed2;
+        case 0x1eda: goto L1eda;
+        case 0x1ee0: goto L1ee0;
+        case 0x1ee5: goto L1ee5;
+        case 0x1eeb: goto L1eeb;
+        case 0x1ef0: goto L1ef0;
+        case 0x1ef7: goto L1ef7;
+        case 0x1f0c: goto L1f0c;
+        case 0x1f1a: goto L1f1a;
+        case 0x1f1d: goto L1f1d;
+        case 0x1f23: goto L1f23;
+        case 0x1f29: goto L1f29;
+        case 0x1f30: goto L1f30;
+        case 0x1f35: goto L1f35;
+        case 0x1f3b: goto L1f3b;
+        case 0x1f41: goto L1f41;
+        case 0x1f46: goto L1f46;
+        case 0x1f49: goto L1f49;
+        case 0x1f50: goto L1f50;
+        case 0x1f60: goto L1f60;
+        case 0x1f67: goto L1f67;
+        case 0x1f6a: goto L1f6a;
+        case 0x1f70: goto L1f70;
+        case 0x1f76: goto L1f76;
+        case 0x1f7d: goto L1f7d;
+        case 0x1f82: goto L1f82;
+        case 0x1f85: goto L1f85;
+        case 0x2020: goto L2020;
+        case 0x203e: goto L203e;
+        case 0x206c: goto L206c;
+        case 0x206e: goto L206e;
+        case 0x2077: goto L2077;
+        case 0x2085: goto L2085;
+        case 0x208f: goto L208f;
+        case 0x2099: goto L2099;
+        case 0x20a5: goto L20a5;
+        case 0x20b7: goto L20b7;
+        case 0x20bb: goto L20bb;
+        case 0x20c3: goto L20c3;
+        case 0x20fd: goto L20fd;
+        case 0x2114: goto L2114;
+        case 0x2125: goto L2125;
+        case 0x212f: goto L212f;
+        case 0x2135: goto L2135;
+        case 0x2147: goto L2147;
+        case 0x214c: goto L214c;
+        case 0x2151: goto L2151;
+        case 0x2158: goto L2158;
+        case 0x215b: goto L215b;
+        case 0x21a2: goto L21a2;
+        case 0x21a8: goto L21a8;
+        case 0x21b6: goto L21b6;
+        case 0x21be: goto L21be;
+        case 0x21c1: goto L21c1;
+        case 0x21c4: goto L21c4;
+        case 0x21d2: goto L21d2;
+        case 0x21db: goto L21db;
+        case 0x21df: goto L21df;
+        case 0x21e9: goto L21e9;
+        case 0x2201: goto L2201;
+        case 0x220e: goto L220e;
+        case 0x2210: goto L2210;
+        case 0x2213: goto L2213;
+        case 0x223a: goto L223a;
+        case 0x2240: goto L2240;
+        case 0x2253: goto L2253;
+        case 0x2254: goto L2254;
+        case 0x225b: goto L225b;
+        case 0x2266: goto L2266;
+        case 0x226d: goto L226d;
+        case 0x2284: goto L2284;
+        case 0x228e: goto L228e;
+        case 0x2299: goto L2299;
+        case 0x229f: goto L229f;
+        case 0x22a6: goto L22a6;
+        case 0x22a8: goto L22a8;
+        case 0x22ad: goto L22ad;
+        case 0x22b3: goto L22b3;
+        case 0x22b7: goto L22b7;
+        case 0x22ba: goto L22ba;
+        case 0x22be: goto L22be;
+        case 0x22c5: goto L22c5;
+        case 0x22c7: goto L22c7;
+        case 0x22cb: goto L22cb;
+        case 0x22d9: goto L22d9;
+        case 0x22e6: goto L22e6;
+        case 0x22ed: goto L22ed;
+        case 0x22fa: goto L22fa;
+        case 0x2304: goto L2304;
+        case 0x2306: goto L2306;
+        case 0x230b: goto L230b;
+        case 0x230d: goto L230d;
+        case 0x230f: goto L230f;
+        case 0x2317: goto L2317;
+        case 0x2319: goto L2319;
+        case 0x231c: goto L231c;
+        case 0x231f: goto L231f;
+        case 0x233d: goto L233d;
+        case 0x233e: goto L233e;
+        case 0x233f: goto L233f;
+        case 0x2347: goto L2347;
+        case 0x2355: goto L2355;
+        case 0x2364: goto L2364;
+        case 0x236d: goto L236d;
+        case 0x237a: goto L237a;
+        case 0x2384: goto L2384;
+        case 0x2386: goto L2386;
+        case 0x238b: goto L238b;
+        case 0x238d: goto L238d;
+        case 0x238f: goto L238f;
+        case 0x2397: goto L2397;
+        case 0x2399: goto L2399;
+        case 0x239c: goto L239c;
+        case 0x23d4: goto L23d4;
+        case 0x23de: goto L23de;
+        case 0x23e1: goto L23e1;
+        case 0x23e3: goto L23e3;
+        case 0x23ef: goto L23ef;
+        case 0x23f2: goto L23f2;
+        case 0x23f9: goto L23f9;
+        case 0x2406: goto L2406;
+        case 0x240a: goto L240a;
+        case 0x2412: goto L2412;
+        case 0x2425: goto L2425;
+        case 0x2428: goto L2428;
+        case 0x242a: goto L242a;
+        case 0x245b: goto L245b;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: xor bp, bp
+    {
+        val = int16_t(r[5]) ^ int16_t(r[5]);
+        r[5] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0002, L0002);
+L0002:
+    AOT_BLOCK(0x0002, 1);
+    // 0002: mov bx, sp
+    {
+        r[3] = r[4];
+    }
+    AOT_GOTO(0x0004, L0004);
+L0004:
+    AOT_BLOCK(0x0004, 1);
+    // 0004: mov ax, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x0006, L0006);
+L0006:
+    AOT_BLOCK(0x0006, 2);
+    // 0006: lea dx, [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        r[2] = a;
+    }
+    // 0009: lea cx, [bx+4]
+    {
+        a = uint16_t(r[3] + 4);
+        r[1] = a;
+    }
+    AOT_GOTO(0x000c, L000c);
+L000c:
+    AOT_BLOCK(0x000c, 2);
+    // 000c: add cx, ax
+    {
+        val = (dst = int16_t(r[1])) + (src = int16_t(r[0]));
+        r[1] = val;
+    }
+    // 000e: add cx, ax
+    {
+        val = (dst = int16_t(r[1])) + (src = int16_t(r[0]));
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x0010, L0010);
+L0010:
+    AOT_BLOCK(0x0010, 1);
+    // 0010: mov bx, 02be
+    {
+        r[3] = 0x02be;
+    }
+    AOT_GOTO(0x0013, L0013);
+L0013:
+    AOT_BLOCK(0x0013, 2);
+    // 0013: cmp bx, 04de
+    {
+        val = (dst = int16_t(r[3])) - (src = 1246);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0017: jnb 0028
+    if (!CF)
+        AOT_GOTO(0x0028, L0028);
+    AOT_GOTO(0x0019, L0019);
+L0019:
+    AOT_BLOCK(0x0019, 2);
+    // 0019: test bl, 1
+    {
+        val = int8_t(r[3]) & 1;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 001c: jne 0028
+    if (!ZF)
+        AOT_GOTO(0x0028, L0028);
+    AOT_GOTO(0x001e, L001e);
+L001e:
+    AOT_BLOCK(0x001e, 2);
+    // 001e: cmp [bx], 5353
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 21331);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0022: jne 0028
+    if (!ZF)
+        AOT_GOTO(0x0028, L0028);
+    AOT_GOTO(0x0024, L0024);
+L0024:
+    AOT_BLOCK(0x0024, 1);
+    // 0024: mov [0002], bx
+    {
+        a = 0x0002;
+        WR16(a, r[3]);
+    }
+    AOT_GOTO(0x0028, L0028);
+L0028:
+    AOT_BLOCK(0x0028, 4);
+    // 0028: mov bx, [0002]
+    {
+        a = 0x0002;
+        r[3] = RD16(a);
+    }
+    // 002c: mov [bx], cx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[1]);
+    }
+    // 002e: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 002f: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    AOT_GOTO(0x0030, L0030);
+L0030:
+    AOT_BLOCK(0x0030, 2);
+    // 0030: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0031: call 0039
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0034);
+    }
+    AOT_GOTO(0x0039, L0039);
+L0034:
+    AOT_BLOCK(0x0034, 2);
+    // 0034: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0035: call 0e7b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0038);
+    }
+    AOT_GOTO(0x0e7b, L0e7b);
+L0038:
+    // 0038: hlt
+    AOT_INTERP(0x0038);
+L0039:
+    AOT_BLOCK(0x0039, 8);
+    // 0039: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 003a: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 003c: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 003d: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 003e: mov di, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[7] = RD16(a);
+    }
+    // 0041: mov si, 061c
+    {
+        r[6] = 0x061c;
+    }
+    // 0044: mov [101c], 02ce
+    {
+        a = 0x101c;
+        WR16(a, 0x02ce);
+    }
+    // 004a: mov dx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[2] = RD16(a);
+    }
+    AOT_GOTO(0x004c, L004c);
+L004c:
+    AOT_BLOCK(0x004c, 3);
+    // 004c: mov [1020], dx
+    {
+        a = 0x1020;
+        WR16(a, r[2]);
+    }
+    // 0050: cmp [bp+4], 1
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0054: jle 00c8
+    if (ZF || SF != OF)
+        AOT_GOTO(0x00c8, L00c8);
+    AOT_GOTO(0x0056, L0056);
+L0056:
+    AOT_BLOCK(0x0056, 3);
+    // 0056: mov bx, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[3] = RD16(a);
+    }
+    // 0059: cmp byte [bx], 2d
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 45);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 005c: jne 00c8
+    if (!ZF)
+        AOT_GOTO(0x00c8, L00c8);
+    AOT_GOTO(0x005e, L005e);
+L005e:
+    AOT_BLOCK(0x005e, 1);
+    // 005e: mov cl, [bx+1]
+    {
+        a = uint16_t(r[3] + 1);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    AOT_GOTO(0x0061, L0061);
+L0061:
+    AOT_BLOCK(0x0061, 1);
+    // 0061: mov [1022], cl
+    {
+        a = 0x1022;
+        WR8(a, uint8_t(r[1]));
+    }
+    AOT_GOTO(0x0065, L0065);
+L0065:
+    AOT_BLOCK(0x0065, 1);
+    // 0065: dec [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x0068, L0068);
+L0068:
+    AOT_BLOCK(0x0068, 2);
+    // 0068: add di, 2
+    {
+        val = (dst = int16_t(r[7])) + (src = 2);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 006b: jmp short 00c8
+    AOT_GOTO(0x00c8, L00c8);
+L006d:
+    AOT_BLOCK(0x006d, 1);
+    // 006d: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x006f, L006f);
+L006f:
+    AOT_BLOCK(0x006f, 1);
+    // 006f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x0070, L0070);
+L0070:
+    AOT_BLOCK(0x0070, 1);
+    // 0070: call 07f2
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0073);
+    }
+    AOT_GOTO(0x07f2, L07f2);
+L0073:
+    AOT_BLOCK(0x0073, 2);
+    // 0073: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0074: jmp short 00d1
+    AOT_GOTO(0x00d1, L00d1);
+L0076:
+    AOT_BLOCK(0x0076, 4);
+    // 0076: mov ax, 025a
+    {
+        r[0] = 0x025a;
+    }
+    // 0079: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 007a: push [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 007d: call 1448
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0080);
+    }
+    AOT_GOTO(0x1448, L1448);
+L0080:
+    AOT_BLOCK(0x0080, 5);
+    // 0080: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0081: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0082: mov [101c], ax
+    {
+        WR16(0x101c, r[0]);
+    }
+    // 0085: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0087: jne 0095
+    if (!ZF)
+        AOT_GOTO(0x0095, L0095);
+    AOT_GOTO(0x0089, L0089);
+L0089:
+    AOT_BLOCK(0x0089, 4);
+    // 0089: push [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 008c: mov ax, 0248
+    {
+        r[0] = 0x0248;
+    }
+    // 008f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0090: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0093);
+    }
+    AOT_GOTO(0x0700, L0700);
+L0093:
+    AOT_BLOCK(0x0093, 2);
+    // 0093: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0094: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0095, L0095);
+L0095:
+    AOT_BLOCK(0x0095, 3);
+    // 0095: mov dx, [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        r[2] = RD16(a);
+    }
+    // 0098: mov [1018], dx
+    {
+        a = 0x1018;
+        WR16(a, r[2]);
+    }
+    // 009c: mov [101a], 0001
+    {
+        a = 0x101a;
+        WR16(a, 0x0001);
+    }
+    AOT_GOTO(0x00a2, L00a2);
+L00a2:
+    AOT_BLOCK(0x00a2, 2);
+    // 00a2: push [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 00a5: call 07ce
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00a8);
+    }
+    AOT_GOTO(0x07ce, L07ce);
+L00a8:
+    AOT_BLOCK(0x00a8, 3);
+    // 00a8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00a9: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 00ab: jne 00d1
+    if (!ZF)
+        AOT_GOTO(0x00d1, L00d1);
+    AOT_GOTO(0x00ad, L00ad);
+L00ad:
+    AOT_BLOCK(0x00ad, 4);
+    // 00ad: push [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 00b0: mov ax, 0238
+    {
+        r[0] = 0x0238;
+    }
+    // 00b3: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00b4: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00b7);
+    }
+    AOT_GOTO(0x0700, L0700);
+L00b7:
+    AOT_BLOCK(0x00b7, 1);
+    // 00b7: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x00b8, L00b8);
+L00b8:
+    AOT_BLOCK(0x00b8, 2);
+    // 00b8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00b9: jmp short 00d1
+    AOT_GOTO(0x00d1, L00d1);
+L00bb:
+    AOT_BLOCK(0x00bb, 4);
+    // 00bb: push [di]
+    {
+        a = uint16_t(r[7]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 00bd: mov ax, 0214
+    {
+        r[0] = 0x0214;
+    }
+    // 00c0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00c1: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00c4);
+    }
+    AOT_GOTO(0x0700, L0700);
+L00c4:
+    AOT_BLOCK(0x00c4, 3);
+    // 00c4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00c5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00c6: jmp short 00d1
+    AOT_GOTO(0x00d1, L00d1);
+L00c8:
+    AOT_BLOCK(0x00c8, 3);
+    // 00c8: mov bx, 0036
+    {
+        r[3] = 0x0036;
+    }
+    // 00cb: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 00ce: jmp 2284
+    AOT_GOTO(0x2284, L2284);
+L00d1:
+    AOT_BLOCK(0x00d1, 3);
+    // 00d1: mov ax, 062c
+    {
+        r[0] = 0x062c;
+    }
+    // 00d4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00d5: call 087e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00d8);
+    }
+    AOT_GOTO(0x087e, L087e);
+L00d8:
+    AOT_BLOCK(0x00d8, 3);
+    // 00d8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00d9: cmp [062c], 0201
+    {
+        a = 0x062c;
+        val = (dst = int16_t(RD16(a))) - (src = 513);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 00df: je 00e9
+    if (ZF)
+        AOT_GOTO(0x00e9, L00e9);
+    AOT_GOTO(0x00e1, L00e1);
+L00e1:
+    AOT_BLOCK(0x00e1, 3);
+    // 00e1: mov ax, 01fa
+    {
+        r[0] = 0x01fa;
+    }
+    // 00e4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00e5: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00e8);
+    }
+    AOT_GOTO(0x0700, L0700);
+L00e8:
+    AOT_BLOCK(0x00e8, 1);
+    // 00e8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x00e9, L00e9);
+L00e9:
+    AOT_BLOCK(0x00e9, 2);
+    // 00e9: test byte [0630], 4
+    {
+        a = 0x0630;
+        val = int8_t(RD8(a)) & 4;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 00ee: je 00f8
+    if (ZF)
+        AOT_GOTO(0x00f8, L00f8);
+    AOT_GOTO(0x00f0, L00f0);
+L00f0:
+    AOT_BLOCK(0x00f0, 2);
+    // 00f0: mov ax, 01d8
+    {
+        r[0] = 0x01d8;
+    }
+    // 00f3: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x00f4, L00f4);
+L00f4:
+    AOT_BLOCK(0x00f4, 1);
+    // 00f4: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00f7);
+    }
+    AOT_GOTO(0x0700, L0700);
+L00f7:
+    AOT_BLOCK(0x00f7, 1);
+    // 00f7: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x00f8, L00f8);
+L00f8:
+    AOT_BLOCK(0x00f8, 2);
+    // 00f8: cmp [0634], 0
+    {
+        a = 0x0634;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 00fd: je 010c
+    if (ZF)
+        AOT_GOTO(0x010c, L010c);
+    AOT_GOTO(0x00ff, L00ff);
+L00ff:
+    AOT_BLOCK(0x00ff, 5);
+    // 00ff: mov ax, 01ae
+    {
+        r[0] = 0x01ae;
+    }
+    // 0102: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0103: mov ax, 02da
+    {
+        r[0] = 0x02da;
+    }
+    // 0106: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0107: call 1587
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x010a);
+    }
+    AOT_GOTO(0x1587, L1587);
+L010a:
+    AOT_BLOCK(0x010a, 2);
+    // 010a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 010b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x010c, L010c);
+L010c:
+    AOT_BLOCK(0x010c, 2);
+    // 010c: cmp [0632], 4
+    {
+        a = 0x0632;
+        val = (dst = int16_t(RD16(a))) - (src = 4);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0111: je 012c
+    if (ZF)
+        AOT_GOTO(0x012c, L012c);
+    AOT_GOTO(0x0113, L0113);
+L0113:
+    AOT_BLOCK(0x0113, 2);
+    // 0113: cmp [0632], 5
+    {
+        a = 0x0632;
+        val = (dst = int16_t(RD16(a))) - (src = 5);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0118: je 012c
+    if (ZF)
+        AOT_GOTO(0x012c, L012c);
+    AOT_GOTO(0x011a, L011a);
+L011a:
+    AOT_BLOCK(0x011a, 6);
+    // 011a: push [0632]
+    {
+        a = 0x0632;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 011e: mov ax, 0005
+    {
+        r[0] = 0x0005;
+    }
+    // 0121: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0122: mov ax, 0182
+    {
+        r[0] = 0x0182;
+    }
+    // 0125: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0126: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0129);
+    }
+    AOT_GOTO(0x0700, L0700);
+L0129:
+    AOT_BLOCK(0x0129, 1);
+    // 0129: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x012c, L012c);
+L012c:
+    AOT_BLOCK(0x012c, 4);
+    // 012c: push [0632]
+    {
+        a = 0x0632;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0130: mov ax, 0640
+    {
+        r[0] = 0x0640;
+    }
+    // 0133: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0134: call 0a3a
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0137);
+    }
+    AOT_GOTO(0x0a3a, L0a3a);
+L0137:
+    AOT_BLOCK(0x0137, 1);
+    // 0137: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0138, L0138);
+L0138:
+    AOT_BLOCK(0x0138, 5);
+    // 0138: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0139: mov dx, [0644]
+    {
+        a = 0x0644;
+        r[2] = RD16(a);
+    }
+    // 013d: and dx, 0001
+    {
+        val = int16_t(r[2]) & 1;
+        r[2] = val;
+    }
+    // 0141: or dx, 0000
+    {
+        val = int16_t(r[2]) | 0;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0145: je 0151
+    if (ZF)
+        AOT_GOTO(0x0151, L0151);
+    AOT_GOTO(0x0147, L0147);
+L0147:
+    AOT_BLOCK(0x0147, 2);
+    // 0147: add [0644], 1
+    {
+        a = 0x0644;
+        val = (dst = int16_t(RD16(a))) + (src = 1);
+        WR16(a, val);
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 014c: adc [0646], 0
+    {
+        a = 0x0646;
+        val = (dst = int16_t(RD16(a))) + (src = 0) + CF;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val) || (CF && !(src + 1));
+    }
+    AOT_GOTO(0x0151, L0151);
+L0151:
+    AOT_BLOCK(0x0151, 4);
+    // 0151: mov dx, [0658]
+    {
+        a = 0x0658;
+        r[2] = RD16(a);
+    }
+    // 0155: and dx, 0001
+    {
+        val = int16_t(r[2]) & 1;
+        r[2] = val;
+    }
+    // 0159: or dx, 0000
+    {
+        val = int16_t(r[2]) | 0;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 015d: je 0169
+    if (ZF)
+        AOT_GOTO(0x0169, L0169);
+    AOT_GOTO(0x015f, L015f);
+L015f:
+    AOT_BLOCK(0x015f, 2);
+    // 015f: add [0658], 1
+    {
+        a = 0x0658;
+        val = (dst = int16_t(RD16(a))) + (src = 1);
+        WR16(a, val);
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0164: adc [065a], 0
+    {
+        a = 0x065a;
+        val = (dst = int16_t(RD16(a))) + (src = 0) + CF;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val) || (CF && !(src + 1));
+    }
+    AOT_GOTO(0x0169, L0169);
+L0169:
+    AOT_BLOCK(0x0169, 4);
+    // 0169: mov dx, [066c]
+    {
+        a = 0x066c;
+        r[2] = RD16(a);
+    }
+    // 016d: and dx, 0001
+    {
+        val = int16_t(r[2]) & 1;
+        r[2] = val;
+    }
+    // 0171: or dx, 0000
+    {
+        val = int16_t(r[2]) | 0;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0175: je 0181
+    if (ZF)
+        AOT_GOTO(0x0181, L0181);
+    AOT_GOTO(0x0177, L0177);
+L0177:
+    AOT_BLOCK(0x0177, 2);
+    // 0177: add [066c], 1
+    {
+        a = 0x066c;
+        val = (dst = int16_t(RD16(a))) + (src = 1);
+        WR16(a, val);
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 017c: adc [066e], 0
+    {
+        a = 0x066e;
+        val = (dst = int16_t(RD16(a))) + (src = 0) + CF;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val) || (CF && !(src + 1));
+    }
+    AOT_GOTO(0x0181, L0181);
+L0181:
+    AOT_BLOCK(0x0181, 4);
+    // 0181: mov dx, [0680]
+    {
+        a = 0x0680;
+        r[2] = RD16(a);
+    }
+    // 0185: and dx, 0001
+    {
+        val = int16_t(r[2]) & 1;
+        r[2] = val;
+    }
+    // 0189: or dx, 0000
+    {
+        val = int16_t(r[2]) | 0;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 018d: je 0199
+    if (ZF)
+        AOT_GOTO(0x0199, L0199);
+    AOT_GOTO(0x018f, L018f);
+L018f:
+    AOT_BLOCK(0x018f, 2);
+    // 018f: add [0680], 1
+    {
+        a = 0x0680;
+        val = (dst = int16_t(RD16(a))) + (src = 1);
+        WR16(a, val);
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0194: adc [0682], 0
+    {
+        a = 0x0682;
+        val = (dst = int16_t(RD16(a))) + (src = 0) + CF;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val) || (CF && !(src + 1));
+    }
+    AOT_GOTO(0x0199, L0199);
+L0199:
+    AOT_BLOCK(0x0199, 3);
+    // 0199: mov dx, [0642]
+    {
+        a = 0x0642;
+        r[2] = RD16(a);
+    }
+    // 019d: or dx, [0640]
+    {
+        a = 0x0640;
+        val = int16_t(r[2]) | int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 01a1: je 01b8
+    if (ZF)
+        AOT_GOTO(0x01b8, L01b8);
+    AOT_GOTO(0x01a3, L01a3);
+L01a3:
+    AOT_BLOCK(0x01a3, 4);
+    // 01a3: push [0642]
+    {
+        a = 0x0642;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 01a7: push [0640]
+    {
+        a = 0x0640;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 01ab: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 01ad: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x01ae, L01ae);
+L01ae:
+    AOT_BLOCK(0x01ae, 3);
+    // 01ae: mov ax, 015e
+    {
+        r[0] = 0x015e;
+    }
+    // 01b1: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 01b2: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x01b5);
+    }
+    AOT_GOTO(0x0700, L0700);
+L01b5:
+    AOT_BLOCK(0x01b5, 1);
+    // 01b5: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x01b8, L01b8);
+L01b8:
+    AOT_BLOCK(0x01b8, 3);
+    // 01b8: mov dx, [068a]
+    {
+        a = 0x068a;
+        r[2] = RD16(a);
+    }
+    // 01bc: or dx, [0688]
+    {
+        a = 0x0688;
+        val = int16_t(r[2]) | int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 01c0: je 01ca
+    if (ZF)
+        AOT_GOTO(0x01ca, L01ca);
+    AOT_GOTO(0x01c2, L01c2);
+L01c2:
+    AOT_BLOCK(0x01c2, 3);
+    // 01c2: mov ax, 0138
+    {
+        r[0] = 0x0138;
+    }
+    // 01c5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 01c6: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x01c9);
+    }
+    AOT_GOTO(0x0700, L0700);
+L01c9:
+    AOT_BLOCK(0x01c9, 1);
+    // 01c9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x01ca, L01ca);
+L01ca:
+    AOT_BLOCK(0x01ca, 6);
+    // 01ca: mov dx, [0668]
+    {
+        a = 0x0668;
+        r[2] = RD16(a);
+    }
+    // 01ce: mov cx, [066a]
+    {
+        a = 0x066a;
+        r[1] = RD16(a);
+    }
+    // 01d2: add dx, [066c]
+    {
+        a = 0x066c;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 01d6: adc cx, [066e]
+    {
+        a = 0x066e;
+        val = (dst = int16_t(r[1])) + (src = int16_t(RD16(a))) + CF;
+        r[1] = val;
+    }
+    // 01da: cmp [067c], dx
+    {
+        a = 0x067c;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 01de: jne 01e6
+    if (!ZF)
+        AOT_GOTO(0x01e6, L01e6);
+    AOT_GOTO(0x01e0, L01e0);
+L01e0:
+    AOT_BLOCK(0x01e0, 2);
+    // 01e0: cmp [067e], cx
+    {
+        a = 0x067e;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[1]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 01e4: je 01ee
+    if (ZF)
+        AOT_GOTO(0x01ee, L01ee);
+    AOT_GOTO(0x01e6, L01e6);
+L01e6:
+    AOT_BLOCK(0x01e6, 3);
+    // 01e6: mov ax, 0112
+    {
+        r[0] = 0x0112;
+    }
+    // 01e9: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 01ea: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x01ed);
+    }
+    AOT_GOTO(0x0700, L0700);
+L01ed:
+    AOT_BLOCK(0x01ed, 1);
+    // 01ed: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x01ee, L01ee);
+L01ee:
+    AOT_BLOCK(0x01ee, 19);
+    // 01ee: mov [si], 0eeb
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0x0eeb);
+    }
+    // 01f2: mov dx, [0644]
+    {
+        a = 0x0644;
+        r[2] = RD16(a);
+    }
+    // 01f6: mov [si+2], dx
+    {
+        a = uint16_t(r[6] + 2);
+        WR16(a, r[2]);
+    }
+    // 01f9: mov dx, [0658]
+    {
+        a = 0x0658;
+        r[2] = RD16(a);
+    }
+    // 01fd: mov cx, [065a]
+    {
+        a = 0x065a;
+        r[1] = RD16(a);
+    }
+    // 0201: add dx, [066c]
+    {
+        a = 0x066c;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0205: adc cx, [066e]
+    {
+        a = 0x066e;
+        val = (dst = int16_t(r[1])) + (src = int16_t(RD16(a))) + CF;
+        r[1] = val;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+    }
+    // 0209: mov [si+4], dx
+    {
+        a = uint16_t(r[6] + 4);
+        WR16(a, r[2]);
+    }
+    // 020c: mov dx, [0680]
+    {
+        a = 0x0680;
+        r[2] = RD16(a);
+    }
+    // 0210: mov [si+6], dx
+    {
+        a = uint16_t(r[6] + 6);
+        WR16(a, r[2]);
+    }
+    // 0213: mov dx, [0640]
+    {
+        a = 0x0640;
+        r[2] = RD16(a);
+    }
+    // 0217: mov [si+a], dx
+    {
+        a = uint16_t(r[6] + 10);
+        WR16(a, r[2]);
+    }
+    // 021a: mov ax, 000c
+    {
+        r[0] = 0x000c;
+    }
+    // 021d: mul [0636]
+    {
+        a = 0x0636;
+        u32 = uint32_t(r[0]) * RD16(a);
+        r[2] = u32 >> 16;
+        r[0] = u32;
+    }
+    // 0221: mov [si+8], ax
+    {
+        a = uint16_t(r[6] + 8);
+        WR16(a, r[0]);
+    }
+    // 0224: mov [si+e], 0001
+    {
+        a = uint16_t(r[6] + 14);
+        WR16(a, 0x0001);
+    }
+    // 0229: mov dx, [0656]
+    {
+        a = 0x0656;
+        r[2] = RD16(a);
+    }
+    // 022d: or dx, [0654]
+    {
+        a = 0x0654;
+        val = int16_t(r[2]) | int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0231: jne 0261
+    if (!ZF)
+        AOT_GOTO(0x0261, L0261);
+    AOT_GOTO(0x0233, L0233);
+L0233:
+    AOT_BLOCK(0x0233, 7);
+    // 0233: mov [si], 12eb
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0x12eb);
+    }
+    // 0237: mov dx, [0654]
+    {
+        a = 0x0654;
+        r[2] = RD16(a);
+    }
+    // 023b: mov cx, [0656]
+    {
+        a = 0x0656;
+        r[1] = RD16(a);
+    }
+    // 023f: add dx, [0658]
+    {
+        a = 0x0658;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0243: adc cx, [065a]
+    {
+        a = 0x065a;
+        val = (dst = int16_t(r[1])) + (src = int16_t(RD16(a))) + CF;
+        r[1] = val;
+    }
+    // 0247: cmp [0668], dx
+    {
+        a = 0x0668;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 024b: jne 0256
+    if (!ZF)
+        AOT_GOTO(0x0256, L0256);
+    AOT_GOTO(0x024d, L024d);
+L024d:
+    AOT_BLOCK(0x024d, 2);
+    // 024d: cmp [066a], cx
+    {
+        a = 0x066a;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[1]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0251: jne 0256
+    if (!ZF)
+        AOT_GOTO(0x0256, L0256);
+    AOT_GOTO(0x0253, L0253);
+L0253:
+    AOT_BLOCK(0x0253, 1);
+    // 0253: jmp 0343
+    AOT_GOTO(0x0343, L0343);
+L0256:
+    AOT_BLOCK(0x0256, 2);
+    // 0256: mov ax, 00f4
+    {
+        r[0] = 0x00f4;
+    }
+    // 0259: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x025a, L025a);
+L025a:
+    AOT_BLOCK(0x025a, 1);
+    // 025a: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x025d);
+    }
+    AOT_GOTO(0x0700, L0700);
+L025d:
+    AOT_BLOCK(0x025d, 1);
+    // 025d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x025e, L025e);
+L025e:
+    AOT_BLOCK(0x025e, 1);
+    // 025e: jmp 0343
+    AOT_GOTO(0x0343, L0343);
+L0261:
+    AOT_BLOCK(0x0261, 2);
+    // 0261: cmp [0664], 2000
+    {
+        a = 0x0664;
+        val = (dst = int16_t(RD16(a))) - (src = 8192);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0267: jne 029e
+    if (!ZF)
+        AOT_GOTO(0x029e, L029e);
+    AOT_GOTO(0x0269, L0269);
+L0269:
+    AOT_BLOCK(0x0269, 2);
+    // 0269: cmp [0666], 0
+    {
+        a = 0x0666;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 026e: jne 029e
+    if (!ZF)
+        AOT_GOTO(0x029e, L029e);
+    AOT_GOTO(0x0270, L0270);
+L0270:
+    AOT_BLOCK(0x0270, 5);
+    // 0270: mov [si], 10eb
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0x10eb);
+    }
+    // 0274: mov dx, [0654]
+    {
+        a = 0x0654;
+        r[2] = RD16(a);
+    }
+    // 0278: mov cx, [0656]
+    {
+        a = 0x0656;
+        r[1] = RD16(a);
+    }
+    // 027c: add dx, [0658]
+    {
+        a = 0x0658;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0280: adc cx, [065a]
+    {
+        a = 0x065a;
+        val = (dst = int16_t(r[1])) + (src = int16_t(RD16(a))) + CF;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val) || (CF && !(src + 1));
+    }
+    AOT_GOTO(0x0284, L0284);
+L0284:
+    AOT_BLOCK(0x0284, 1);
+    // 0284: cmp [0668], dx
+    {
+        a = 0x0668;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    AOT_GOTO(0x0288, L0288);
+L0288:
+    AOT_BLOCK(0x0288, 1);
+    // 0288: jne 0293
+    if (!ZF)
+        AOT_GOTO(0x0293, L0293);
+    AOT_GOTO(0x028a, L028a);
+L028a:
+    AOT_BLOCK(0x028a, 2);
+    // 028a: cmp [066a], cx
+    {
+        a = 0x066a;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[1]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 028e: jne 0293
+    if (!ZF)
+        AOT_GOTO(0x0293, L0293);
+    AOT_GOTO(0x0290, L0290);
+L0290:
+    AOT_BLOCK(0x0290, 1);
+    // 0290: jmp 0343
+    AOT_GOTO(0x0343, L0343);
+L0293:
+    AOT_BLOCK(0x0293, 3);
+    // 0293: mov ax, 00d6
+    {
+        r[0] = 0x00d6;
+    }
+    // 0296: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0297: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x029a);
+    }
+    AOT_GOTO(0x0700, L0700);
+L029a:
+    AOT_BLOCK(0x029a, 2);
+    // 029a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 029b: jmp 0343
+    AOT_GOTO(0x0343, L0343);
+L029e:
+    AOT_BLOCK(0x029e, 2);
+    // 029e: cmp [0678], 2000
+    {
+        a = 0x0678;
+        val = (dst = int16_t(RD16(a))) - (src = 8192);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 02a4: jne 02fb
+    if (!ZF)
+        AOT_GOTO(0x02fb, L02fb);
+    AOT_GOTO(0x02a6, L02a6);
+L02a6:
+    AOT_BLOCK(0x02a6, 2);
+    // 02a6: cmp [067a], 0
+    {
+        a = 0x067a;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 02ab: jne 02fb
+    if (!ZF)
+        AOT_GOTO(0x02fb, L02fb);
+    AOT_GOTO(0x02ad, L02ad);
+L02ad:
+    AOT_BLOCK(0x02ad, 10);
+    // 02ad: mov [101e], 0001
+    {
+        a = 0x101e;
+        WR16(a, 0x0001);
+    }
+    // 02b3: mov [si], 10eb
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0x10eb);
+    }
+    // 02b7: mov ax, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[0] = RD16(a);
+    }
+    // 02ba: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 02bb: add ax, [0658]
+    {
+        a = 0x0658;
+        val = (dst = int16_t(r[0])) + (src = int16_t(RD16(a)));
+        r[0] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 02bf: adc dx, [065a]
+    {
+        a = 0x065a;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a))) + CF;
+        r[2] = val;
+    }
+    // 02c3: mov [si+2], ax
+    {
+        a = uint16_t(r[6] + 2);
+        WR16(a, r[0]);
+    }
+    // 02c6: mov ax, [si+4]
+    {
+        a = uint16_t(r[6] + 4);
+        r[0] = RD16(a);
+    }
+    // 02c9: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 02ca: sub ax, [0658]
+    {
+        a = 0x0658;
+        val = (dst = int16_t(r[0])) - (src = int16_t(RD16(a)));
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    AOT_GOTO(0x02ce, L02ce);
+L02ce:
+    AOT_BLOCK(0x02ce, 8);
+    // 02ce: sbb dx, [065a]
+    {
+        a = 0x065a;
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a))) - CF;
+        r[2] = val;
+    }
+    // 02d2: mov [si+4], ax
+    {
+        a = uint16_t(r[6] + 4);
+        WR16(a, r[0]);
+    }
+    // 02d5: mov dx, [0640]
+    {
+        a = 0x0640;
+        r[2] = RD16(a);
+    }
+    // 02d9: mov cx, [0642]
+    {
+        a = 0x0642;
+        r[1] = RD16(a);
+    }
+    // 02dd: add dx, [0644]
+    {
+        a = 0x0644;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 02e1: adc cx, [0646]
+    {
+        a = 0x0646;
+        val = (dst = int16_t(r[1])) + (src = int16_t(RD16(a))) + CF;
+        r[1] = val;
+    }
+    // 02e5: cmp [0654], dx
+    {
+        a = 0x0654;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 02e9: jne 02f1
+    if (!ZF)
+        AOT_GOTO(0x02f1, L02f1);
+    AOT_GOTO(0x02eb, L02eb);
+L02eb:
+    AOT_BLOCK(0x02eb, 2);
+    // 02eb: cmp [0656], cx
+    {
+        a = 0x0656;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[1]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 02ef: je 0343
+    if (ZF)
+        AOT_GOTO(0x0343, L0343);
+    AOT_GOTO(0x02f1, L02f1);
+L02f1:
+    AOT_BLOCK(0x02f1, 3);
+    // 02f1: mov ax, 00b8
+    {
+        r[0] = 0x00b8;
+    }
+    // 02f4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 02f5: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x02f8);
+    }
+    AOT_GOTO(0x0700, L0700);
+L02f8:
+    AOT_BLOCK(0x02f8, 2);
+    // 02f8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 02f9: jmp short 0343
+    AOT_GOTO(0x0343, L0343);
+L02fb:
+    AOT_BLOCK(0x02fb, 6);
+    // 02fb: mov dx, [0640]
+    {
+        a = 0x0640;
+        r[2] = RD16(a);
+    }
+    // 02ff: mov cx, [0642]
+    {
+        a = 0x0642;
+        r[1] = RD16(a);
+    }
+    // 0303: add dx, [0644]
+    {
+        a = 0x0644;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0307: adc cx, [0646]
+    {
+        a = 0x0646;
+        val = (dst = int16_t(r[1])) + (src = int16_t(RD16(a))) + CF;
+        r[1] = val;
+    }
+    // 030b: cmp [0654], dx
+    {
+        a = 0x0654;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 030f: jne 0317
+    if (!ZF)
+        AOT_GOTO(0x0317, L0317);
+    AOT_GOTO(0x0311, L0311);
+L0311:
+    AOT_BLOCK(0x0311, 2);
+    // 0311: cmp [0656], cx
+    {
+        a = 0x0656;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[1]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0315: je 031f
+    if (ZF)
+        AOT_GOTO(0x031f, L031f);
+    AOT_GOTO(0x0317, L0317);
+L0317:
+    AOT_BLOCK(0x0317, 3);
+    // 0317: mov ax, 009a
+    {
+        r[0] = 0x009a;
+    }
+    // 031a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 031b: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x031e);
+    }
+    AOT_GOTO(0x0700, L0700);
+L031e:
+    AOT_BLOCK(0x031e, 1);
+    // 031e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x031f, L031f);
+L031f:
+    AOT_BLOCK(0x031f, 6);
+    // 031f: mov dx, [0654]
+    {
+        a = 0x0654;
+        r[2] = RD16(a);
+    }
+    // 0323: mov cx, [0656]
+    {
+        a = 0x0656;
+        r[1] = RD16(a);
+    }
+    // 0327: add dx, [0658]
+    {
+        a = 0x0658;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 032b: adc cx, [065a]
+    {
+        a = 0x065a;
+        val = (dst = int16_t(r[1])) + (src = int16_t(RD16(a))) + CF;
+        r[1] = val;
+    }
+    // 032f: cmp [0668], dx
+    {
+        a = 0x0668;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0333: jne 033b
+    if (!ZF)
+        AOT_GOTO(0x033b, L033b);
+    AOT_GOTO(0x0335, L0335);
+L0335:
+    AOT_BLOCK(0x0335, 2);
+    // 0335: cmp [066a], cx
+    {
+        a = 0x066a;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[1]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0339: je 0343
+    if (ZF)
+        AOT_GOTO(0x0343, L0343);
+    AOT_GOTO(0x033b, L033b);
+L033b:
+    AOT_BLOCK(0x033b, 3);
+    // 033b: mov ax, 007c
+    {
+        r[0] = 0x007c;
+    }
+    // 033e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 033f: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0342);
+    }
+    AOT_GOTO(0x0700, L0700);
+L0342:
+    AOT_BLOCK(0x0342, 1);
+    // 0342: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0343, L0343);
+L0343:
+    AOT_BLOCK(0x0343, 2);
+    // 0343: cmp [0632], 5
+    {
+        a = 0x0632;
+        val = (dst = int16_t(RD16(a))) - (src = 5);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0348: jne 0380
+    if (!ZF)
+        AOT_GOTO(0x0380, L0380);
+    AOT_GOTO(0x034a, L034a);
+L034a:
+    AOT_BLOCK(0x034a, 6);
+    // 034a: mov dx, [067c]
+    {
+        a = 0x067c;
+        r[2] = RD16(a);
+    }
+    // 034e: mov cx, [067e]
+    {
+        a = 0x067e;
+        r[1] = RD16(a);
+    }
+    // 0352: add dx, [0680]
+    {
+        a = 0x0680;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0356: adc cx, [0682]
+    {
+        a = 0x0682;
+        val = (dst = int16_t(r[1])) + (src = int16_t(RD16(a))) + CF;
+        r[1] = val;
+    }
+    // 035a: cmp [0690], dx
+    {
+        a = 0x0690;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 035e: jne 0366
+    if (!ZF)
+        AOT_GOTO(0x0366, L0366);
+    AOT_GOTO(0x0360, L0360);
+L0360:
+    AOT_BLOCK(0x0360, 2);
+    // 0360: cmp [0692], cx
+    {
+        a = 0x0692;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[1]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0364: je 036e
+    if (ZF)
+        AOT_GOTO(0x036e, L036e);
+    AOT_GOTO(0x0366, L0366);
+L0366:
+    AOT_BLOCK(0x0366, 3);
+    // 0366: mov ax, 005e
+    {
+        r[0] = 0x005e;
+    }
+    // 0369: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 036a: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x036d);
+    }
+    AOT_GOTO(0x0700, L0700);
+L036d:
+    AOT_BLOCK(0x036d, 1);
+    // 036d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x036e, L036e);
+L036e:
+    AOT_BLOCK(0x036e, 3);
+    // 036e: mov dx, [0696]
+    {
+        a = 0x0696;
+        r[2] = RD16(a);
+    }
+    // 0372: or dx, [0694]
+    {
+        a = 0x0694;
+        val = int16_t(r[2]) | int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0376: je 0380
+    if (ZF)
+        AOT_GOTO(0x0380, L0380);
+    AOT_GOTO(0x0378, L0378);
+L0378:
+    AOT_BLOCK(0x0378, 3);
+    // 0378: mov ax, 0042
+    {
+        r[0] = 0x0042;
+    }
+    // 037b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 037c: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x037f);
+    }
+    AOT_GOTO(0x0700, L0700);
+L037f:
+    AOT_BLOCK(0x037f, 1);
+    // 037f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0380, L0380);
+L0380:
+    AOT_BLOCK(0x0380, 2);
+    // 0380: push [si]
+    {
+        a = uint16_t(r[6]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0382: call 03ea
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0385);
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L0385:
+    AOT_BLOCK(0x0385, 3);
+    // 0385: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0386: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0389: call 03ea
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x038c);
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L038c:
+    AOT_BLOCK(0x038c, 3);
+    // 038c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 038d: push [si+4]
+    {
+        a = uint16_t(r[6] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0390: call 03ea
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0393);
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L0393:
+    AOT_BLOCK(0x0393, 3);
+    // 0393: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0394: push [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0397: call 03ea
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x039a);
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L039a:
+    AOT_BLOCK(0x039a, 3);
+    // 039a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 039b: push [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 039e: call 03ea
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03a1);
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L03a1:
+    AOT_BLOCK(0x03a1, 3);
+    // 03a1: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03a2: push [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 03a5: call 03ea
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03a8);
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L03a8:
+    AOT_BLOCK(0x03a8, 3);
+    // 03a8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03a9: push [si+c]
+    {
+        a = uint16_t(r[6] + 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 03ac: call 03ea
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03af);
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L03af:
+    AOT_BLOCK(0x03af, 3);
+    // 03af: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03b0: push [si+e]
+    {
+        a = uint16_t(r[6] + 14);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 03b3: call 03ea
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03b6);
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L03b6:
+    AOT_BLOCK(0x03b6, 4);
+    // 03b6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03b7: mov ax, 0640
+    {
+        r[0] = 0x0640;
+    }
+    // 03ba: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03bb: call 0456
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03be);
+    }
+    AOT_GOTO(0x0456, L0456);
+L03be:
+    AOT_BLOCK(0x03be, 4);
+    // 03be: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03bf: mov ax, 0654
+    {
+        r[0] = 0x0654;
+    }
+    // 03c2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03c3: call 0456
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03c6);
+    }
+    AOT_GOTO(0x0456, L0456);
+L03c6:
+    AOT_BLOCK(0x03c6, 4);
+    // 03c6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03c7: mov ax, 0668
+    {
+        r[0] = 0x0668;
+    }
+    // 03ca: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03cb: call 0456
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03ce);
+    }
+    AOT_GOTO(0x0456, L0456);
+L03ce:
+    AOT_BLOCK(0x03ce, 2);
+    // 03ce: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03cf: call 056f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03d2);
+    }
+    AOT_GOTO(0x056f, L056f);
+L03d2:
+    AOT_BLOCK(0x03d2, 2);
+    // 03d2: cmp [101a], 0
+    {
+        a = 0x101a;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 03d7: je 03e5
+    if (ZF)
+        AOT_GOTO(0x03e5, L03e5);
+    AOT_GOTO(0x03d9, L03d9);
+L03d9:
+    AOT_BLOCK(0x03d9, 4);
+    // 03d9: mov ax, 01ed
+    {
+        r[0] = 0x01ed;
+    }
+    // 03dc: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03dd: push [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 03e0: call 160d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03e3);
+    }
+    AOT_GOTO(0x160d, L160d);
+L03e3:
+    AOT_BLOCK(0x03e3, 2);
+    // 03e3: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03e4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x03e5, L03e5);
+L03e5:
+    AOT_BLOCK(0x03e5, 2);
+    // 03e5: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 03e7: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L03ea:
+    AOT_BLOCK(0x03ea, 9);
+    // 03ea: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 03eb: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 03ed: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 03ee: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 03f1: mov bx, [101c]
+    {
+        a = 0x101c;
+        r[3] = RD16(a);
+    }
+    // 03f5: dec [bx]
+    {
+        a = uint16_t(r[3]);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+    }
+    // 03f7: mov bx, [101c]
+    {
+        a = 0x101c;
+        r[3] = RD16(a);
+    }
+    // 03fb: cmp [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 03fe: jl 0412
+    if (SF != OF)
+        AOT_GOTO(0x0412, L0412);
+    AOT_GOTO(0x0400, L0400);
+L0400:
+    AOT_BLOCK(0x0400, 7);
+    // 0400: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0402: mov bx, [101c]
+    {
+        a = 0x101c;
+        r[3] = RD16(a);
+    }
+    // 0406: mov ax, [bx+a]
+    {
+        a = uint16_t(r[3] + 10);
+        r[0] = RD16(a);
+    }
+    // 0409: inc [bx+a]
+    {
+        a = uint16_t(r[3] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 040c: mov bx, ax
+    {
+        r[3] = r[0];
+    }
+    // 040e: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 0410: jmp short 041c
+    AOT_GOTO(0x041c, L041c);
+L0412:
+    AOT_BLOCK(0x0412, 3);
+    // 0412: push [101c]
+    {
+        a = 0x101c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0416: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0417: call 1226
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x041a);
+    }
+    AOT_GOTO(0x1226, L1226);
+L041a:
+    AOT_BLOCK(0x041a, 2);
+    // 041a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 041b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x041c, L041c);
+L041c:
+    AOT_BLOCK(0x041c, 5);
+    // 041c: mov bx, [101c]
+    {
+        a = 0x101c;
+        r[3] = RD16(a);
+    }
+    // 0420: dec [bx]
+    {
+        a = uint16_t(r[3]);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+    }
+    // 0422: mov bx, [101c]
+    {
+        a = 0x101c;
+        r[3] = RD16(a);
+    }
+    // 0426: cmp [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0429: jl 0442
+    if (SF != OF)
+        AOT_GOTO(0x0442, L0442);
+    AOT_GOTO(0x042b, L042b);
+L042b:
+    AOT_BLOCK(0x042b, 9);
+    // 042b: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 042e: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0430: sar dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = int16_t(r[2]) >> (uint8_t(r[1]) - 1);
+            r[2] = val >> 1;
+            SF = int16_t((val >> 1)) < 0;
+            ZF = int16_t((val >> 1)) == 0;
+            PF = ptable[uint8_t((val >> 1))];
+            CF = val & 1;
+            OF = false;
+        }
+    }
+    // 0432: mov bx, [101c]
+    {
+        a = 0x101c;
+        r[3] = RD16(a);
+    }
+    // 0436: mov ax, [bx+a]
+    {
+        a = uint16_t(r[3] + 10);
+        r[0] = RD16(a);
+    }
+    // 0439: inc [bx+a]
+    {
+        a = uint16_t(r[3] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 043c: mov bx, ax
+    {
+        r[3] = r[0];
+    }
+    // 043e: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 0440: jmp short 0453
+    AOT_GOTO(0x0453, L0453);
+L0442:
+    AOT_BLOCK(0x0442, 6);
+    // 0442: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0445: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0447: sar dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = int16_t(r[2]) >> (uint8_t(r[1]) - 1);
+            r[2] = val >> 1;
+            SF = int16_t((val >> 1)) < 0;
+            ZF = int16_t((val >> 1)) == 0;
+            PF = ptable[uint8_t((val >> 1))];
+            CF = val & 1;
+            OF = false;
+        }
+    }
+    // 0449: push [101c]
+    {
+        a = 0x101c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 044d: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 044e: call 1226
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0451);
+    }
+    AOT_GOTO(0x1226, L1226);
+L0451:
+    AOT_BLOCK(0x0451, 2);
+    // 0451: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0452: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0453, L0453);
+L0453:
+    AOT_BLOCK(0x0453, 1);
+    // 0453: jmp 233e
+    AOT_GOTO(0x233e, L233e);
+L0456:
+    AOT_BLOCK(0x0456, 16);
+    // 0456: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0457: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0459: sub sp, 0406
+    {
+        val = (dst = int16_t(r[4])) - (src = 1030);
+        r[4] = val;
+    }
+    // 045d: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 045e: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 045f: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 0462: mov dx, [di+c]
+    {
+        a = uint16_t(r[7] + 12);
+        r[2] = RD16(a);
+    }
+    // 0465: mov cx, [di+e]
+    {
+        a = uint16_t(r[7] + 14);
+        r[1] = RD16(a);
+    }
+    // 0468: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 046b: mov [bp-2], cx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[1]);
+    }
+    // 046e: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 0470: sub ax, 0640
+    {
+        val = (dst = int16_t(r[0])) - (src = 1600);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0473: mov cx, 0014
+    {
+        r[1] = 0x0014;
+    }
+    // 0476: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 0477: idiv cx
+    {
+        i32 = int32_t(uint32_t(r[2]) << 16 | r[0]);
+        src = int16_t(r[1]);
+        r[0] = i32 / src;
+        r[2] = i32 % src;
+    }
+    // 0479: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x047a, L047a);
+L047a:
+    AOT_BLOCK(0x047a, 1);
+    // 047a: call 0bb8
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x047d);
+    }
+    AOT_GOTO(0x0bb8, L0bb8);
+L047d:
+    AOT_BLOCK(0x047d, 1);
+    // 047d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x047e, L047e);
+L047e:
+    AOT_BLOCK(0x047e, 3);
+    // 047e: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+    }
+    // 0480: cmp [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0483: jl 04e5
+    if (SF != OF)
+        AOT_GOTO(0x04e5, L04e5);
+    AOT_GOTO(0x0485, L0485);
+L0485:
+    AOT_BLOCK(0x0485, 1);
+    // 0485: jne 048c
+    if (!ZF)
+        AOT_GOTO(0x048c, L048c);
+    AOT_GOTO(0x0487, L0487);
+L0487:
+    AOT_BLOCK(0x0487, 2);
+    // 0487: cmp [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 048a: jbe 04e5
+    if (CF || ZF)
+        AOT_GOTO(0x04e5, L04e5);
+    AOT_GOTO(0x048c, L048c);
+L048c:
+    AOT_BLOCK(0x048c, 2);
+    // 048c: cmp [bp-2], 0
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0490: jl 04a2
+    if (SF != OF)
+        AOT_GOTO(0x04a2, L04a2);
+    AOT_GOTO(0x0492, L0492);
+L0492:
+    AOT_BLOCK(0x0492, 1);
+    // 0492: jne 049b
+    if (!ZF)
+        AOT_GOTO(0x049b, L049b);
+    AOT_GOTO(0x0494, L0494);
+L0494:
+    AOT_BLOCK(0x0494, 2);
+    // 0494: cmp [bp-4], 0400
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 1024);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0499: jbe 04a2
+    if (CF || ZF)
+        AOT_GOTO(0x04a2, L04a2);
+    AOT_GOTO(0x049b, L049b);
+L049b:
+    AOT_BLOCK(0x049b, 4);
+    // 049b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 049c: mov ax, 0400
+    {
+        r[0] = 0x0400;
+    }
+    // 049f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 04a0: jmp short 04a8
+    AOT_GOTO(0x04a8, L04a8);
+L04a2:
+    AOT_BLOCK(0x04a2, 2);
+    // 04a2: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 04a5: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x04a8, L04a8);
+L04a8:
+    AOT_BLOCK(0x04a8, 10);
+    // 04a8: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 04a9: pop cx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[1] = val;
+    }
+    // 04aa: mov si, dx
+    {
+        r[6] = r[2];
+    }
+    // 04ac: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 04ae: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 04af: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 04b0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 04b1: lea ax, [bp-406]
+    {
+        a = uint16_t(r[5] - 1030);
+        r[0] = a;
+    }
+    // 04b5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 04b6: call 0bdc
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04b9);
+    }
+    AOT_GOTO(0x0bdc, L0bdc);
+L04b9:
+    AOT_BLOCK(0x04b9, 8);
+    // 04b9: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 04bc: push [101c]
+    {
+        a = 0x101c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 04c0: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 04c1: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 04c4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 04c5: lea ax, [bp-406]
+    {
+        a = uint16_t(r[5] - 1030);
+        r[0] = a;
+    }
+    // 04c9: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 04ca: call 15a4
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04cd);
+    }
+    AOT_GOTO(0x15a4, L15a4);
+L04cd:
+    AOT_BLOCK(0x04cd, 10);
+    // 04cd: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 04d0: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 04d2: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 04d3: mov cx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[1] = RD16(a);
+    }
+    // 04d6: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 04d9: sub cx, ax
+    {
+        val = (dst = int16_t(r[1])) - (src = int16_t(r[0]));
+        r[1] = val;
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 04db: sbb bx, dx
+    {
+        val = (dst = int16_t(r[3])) - (src = int16_t(r[2])) - CF;
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) - CF < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src + CF) || (CF && !(src + 1));
+    }
+    // 04dd: mov [bp-4], cx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[1]);
+    }
+    // 04e0: mov [bp-2], bx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[3]);
+    }
+    // 04e3: jmp short 047e
+    AOT_GOTO(0x047e, L047e);
+L04e5:
+    AOT_BLOCK(0x04e5, 9);
+    // 04e5: mov dx, [di+4]
+    {
+        a = uint16_t(r[7] + 4);
+        r[2] = RD16(a);
+    }
+    // 04e8: mov cx, [di+6]
+    {
+        a = uint16_t(r[7] + 6);
+        r[1] = RD16(a);
+    }
+    // 04eb: sub dx, [di+c]
+    {
+        a = uint16_t(r[7] + 12);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 04ee: sbb cx, [di+e]
+    {
+        a = uint16_t(r[7] + 14);
+        val = (dst = int16_t(r[1])) - (src = int16_t(RD16(a))) - CF;
+        r[1] = val;
+    }
+    // 04f1: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 04f4: mov [bp-2], cx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[1]);
+    }
+    // 04f7: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+    }
+    // 04f9: cmp cx, ax
+    {
+        val = (dst = int16_t(r[1])) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 04fb: jnl 0500
+    if (SF == OF)
+        AOT_GOTO(0x0500, L0500);
+    AOT_GOTO(0x04fd, L04fd);
+L04fd:
+    AOT_BLOCK(0x04fd, 1);
+    // 04fd: jmp 056c
+    AOT_GOTO(0x056c, L056c);
+L0500:
+    AOT_BLOCK(0x0500, 1);
+    // 0500: jne 0506
+    if (!ZF)
+        AOT_GOTO(0x0506, L0506);
+    AOT_GOTO(0x0502, L0502);
+L0502:
+    AOT_BLOCK(0x0502, 2);
+    // 0502: cmp dx, ax
+    {
+        val = (dst = int16_t(r[2])) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0504: jbe 056c
+    if (CF || ZF)
+        AOT_GOTO(0x056c, L056c);
+    AOT_GOTO(0x0506, L0506);
+L0506:
+    AOT_BLOCK(0x0506, 1);
+    // 0506: mov si, 03ff
+    {
+        r[6] = 0x03ff;
+    }
+    AOT_GOTO(0x0509, L0509);
+L0509:
+    AOT_BLOCK(0x0509, 2);
+    // 0509: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 050b: jl 0515
+    if (SF != OF)
+        AOT_GOTO(0x0515, L0515);
+    AOT_GOTO(0x050d, L050d);
+L050d:
+    AOT_BLOCK(0x050d, 3);
+    // 050d: mov byte [bp+si-406], 0
+    {
+        a = uint16_t(r[5] + r[6] - 1030);
+        WR8(a, 0);
+    }
+    // 0512: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 0513: jmp short 0509
+    AOT_GOTO(0x0509, L0509);
+L0515:
+    AOT_BLOCK(0x0515, 3);
+    // 0515: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+    }
+    // 0517: cmp [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 051a: jl 056c
+    if (SF != OF)
+        AOT_GOTO(0x056c, L056c);
+    AOT_GOTO(0x051c, L051c);
+L051c:
+    AOT_BLOCK(0x051c, 1);
+    // 051c: jne 0523
+    if (!ZF)
+        AOT_GOTO(0x0523, L0523);
+    AOT_GOTO(0x051e, L051e);
+L051e:
+    AOT_BLOCK(0x051e, 2);
+    // 051e: cmp [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0521: jbe 056c
+    if (CF || ZF)
+        AOT_GOTO(0x056c, L056c);
+    AOT_GOTO(0x0523, L0523);
+L0523:
+    AOT_BLOCK(0x0523, 2);
+    // 0523: cmp [bp-2], 0
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0527: jl 0539
+    if (SF != OF)
+        AOT_GOTO(0x0539, L0539);
+    AOT_GOTO(0x0529, L0529);
+L0529:
+    AOT_BLOCK(0x0529, 1);
+    // 0529: jne 0532
+    if (!ZF)
+        AOT_GOTO(0x0532, L0532);
+    AOT_GOTO(0x052b, L052b);
+L052b:
+    AOT_BLOCK(0x052b, 2);
+    // 052b: cmp [bp-4], 0400
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 1024);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0530: jbe 0539
+    if (CF || ZF)
+        AOT_GOTO(0x0539, L0539);
+    AOT_GOTO(0x0532, L0532);
+L0532:
+    AOT_BLOCK(0x0532, 4);
+    // 0532: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0533: mov ax, 0400
+    {
+        r[0] = 0x0400;
+    }
+    // 0536: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0537: jmp short 053f
+    AOT_GOTO(0x053f, L053f);
+L0539:
+    AOT_BLOCK(0x0539, 2);
+    // 0539: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 053c: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x053f, L053f);
+L053f:
+    AOT_BLOCK(0x053f, 10);
+    // 053f: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 0540: pop cx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[1] = val;
+    }
+    // 0541: mov si, dx
+    {
+        r[6] = r[2];
+    }
+    // 0543: push [101c]
+    {
+        a = 0x101c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0547: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0548: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 054b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 054c: lea ax, [bp-406]
+    {
+        a = uint16_t(r[5] - 1030);
+        r[0] = a;
+    }
+    // 0550: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0551: call 15a4
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0554);
+    }
+    AOT_GOTO(0x15a4, L15a4);
+L0554:
+    AOT_BLOCK(0x0554, 10);
+    // 0554: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 0557: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 0559: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 055a: mov cx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[1] = RD16(a);
+    }
+    // 055d: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 0560: sub cx, ax
+    {
+        val = (dst = int16_t(r[1])) - (src = int16_t(r[0]));
+        r[1] = val;
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0562: sbb bx, dx
+    {
+        val = (dst = int16_t(r[3])) - (src = int16_t(r[2])) - CF;
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) - CF < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src + CF) || (CF && !(src + 1));
+    }
+    // 0564: mov [bp-4], cx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[1]);
+    }
+    // 0567: mov [bp-2], bx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[3]);
+    }
+    // 056a: jmp short 0515
+    AOT_GOTO(0x0515, L0515);
+L056c:
+    AOT_BLOCK(0x056c, 1);
+    // 056c: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L056f:
+    AOT_BLOCK(0x056f, 11);
+    // 056f: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0570: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0572: sub sp, 24
+    {
+        val = (dst = int16_t(r[4])) - (src = 36);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 0575: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0576: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0577: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 057a: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 057c: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 057e: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 057f: push [0632]
+    {
+        a = 0x0632;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0583: call 231f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0586);
+    }
+    AOT_GOTO(0x231f, L231f);
+L0586:
+    AOT_BLOCK(0x0586, 22);
+    // 0586: add ax, 0014
+    {
+        val = (dst = int16_t(r[0])) + (src = 20);
+        r[0] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0589: adc dx, 0
+    {
+        val = (dst = int16_t(r[2])) + (src = 0) + CF;
+        r[2] = val;
+    }
+    // 058c: add ax, [0638]
+    {
+        a = 0x0638;
+        val = (dst = int16_t(r[0])) + (src = int16_t(RD16(a)));
+        r[0] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0590: adc dx, [063a]
+    {
+        a = 0x063a;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a))) + CF;
+        r[2] = val;
+    }
+    // 0594: mov cx, [0634]
+    {
+        a = 0x0634;
+        r[1] = RD16(a);
+    }
+    // 0598: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+    }
+    // 059a: shl cx, 1
+    {
+        val = r[1] << 1;
+        r[1] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 059c: rcl bx, 1
+    {
+        val = r[3];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[3] = val;
+    }
+    // 059e: shl cx, 1
+    {
+        val = r[1] << 1;
+        r[1] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 05a0: rcl bx, 1
+    {
+        val = r[3];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[3] = val;
+    }
+    // 05a2: shl cx, 1
+    {
+        val = r[1] << 1;
+        r[1] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 05a4: rcl bx, 1
+    {
+        val = r[3];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[3] = val;
+    }
+    // 05a6: add cx, ax
+    {
+        val = (dst = int16_t(r[1])) + (src = int16_t(r[0]));
+        r[1] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 05a8: adc bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2])) + CF;
+        r[3] = val;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+    }
+    // 05aa: mov ax, 000c
+    {
+        r[0] = 0x000c;
+    }
+    // 05ad: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 05af: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 05b0: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 05b1: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 05b3: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 05b4: push [0636]
+    {
+        a = 0x0636;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 05b8: call 231f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x05bb);
+    }
+    AOT_GOTO(0x231f, L231f);
+L05bb:
+    AOT_BLOCK(0x05bb, 8);
+    // 05bb: pop cx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[1] = val;
+    }
+    // 05bc: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 05bd: add cx, ax
+    {
+        val = (dst = int16_t(r[1])) + (src = int16_t(r[0]));
+        r[1] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 05bf: adc bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2])) + CF;
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val) || (CF && !(src + 1));
+    }
+    // 05c1: mov [bp-24], cx
+    {
+        a = uint16_t(r[5] - 36);
+        WR16(a, r[1]);
+    }
+    // 05c4: mov [bp-22], bx
+    {
+        a = uint16_t(r[5] - 34);
+        WR16(a, r[3]);
+    }
+    // 05c7: push [063c]
+    {
+        a = 0x063c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 05cb: call 0ef5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x05ce);
+    }
+    AOT_GOTO(0x0ef5, L0ef5);
+L05ce:
+    AOT_BLOCK(0x05ce, 6);
+    // 05ce: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 05cf: mov [bp-1c], ax
+    {
+        a = uint16_t(r[5] - 28);
+        WR16(a, r[0]);
+    }
+    // 05d2: push [063e]
+    {
+        a = 0x063e;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 05d6: push [063c]
+    {
+        a = 0x063c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 05da: push [bp-1c]
+    {
+        a = uint16_t(r[5] - 28);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 05dd: call 0db5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x05e0);
+    }
+    AOT_GOTO(0x0db5, L0db5);
+L05e0:
+    AOT_BLOCK(0x05e0, 2);
+    // 05e0: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 05e3: mov [bp-1a], 0000
+    {
+        a = uint16_t(r[5] - 26);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x05e8, L05e8);
+L05e8:
+    AOT_BLOCK(0x05e8, 3);
+    // 05e8: mov dx, [0636]
+    {
+        a = 0x0636;
+        r[2] = RD16(a);
+    }
+    // 05ec: cmp [bp-1a], dx
+    {
+        a = uint16_t(r[5] - 26);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 05ef: jb 05f4
+    if (CF)
+        AOT_GOTO(0x05f4, L05f4);
+    AOT_GOTO(0x05f1, L05f1);
+L05f1:
+    AOT_BLOCK(0x05f1, 1);
+    // 05f1: jmp 06fd
+    AOT_GOTO(0x06fd, L06fd);
+L05f4:
+    AOT_BLOCK(0x05f4, 5);
+    // 05f4: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 05f7: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 05f8: lea ax, [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        r[0] = a;
+    }
+    // 05fb: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 05fc: call 0cc6
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x05ff);
+    }
+    AOT_GOTO(0x0cc6, L0cc6);
+L05ff:
+    AOT_BLOCK(0x05ff, 3);
+    // 05ff: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0600: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0601: jmp short 064b
+    AOT_GOTO(0x064b, L064b);
+L0603:
+    AOT_BLOCK(0x0603, 2);
+    // 0603: mov [bp-10], 0000
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, 0x0000);
+    }
+    // 0608: jmp short 0659
+    AOT_GOTO(0x0659, L0659);
+L060a:
+    AOT_BLOCK(0x060a, 2);
+    // 060a: mov [bp-10], 0001
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, 0x0001);
+    }
+    // 060f: jmp short 0659
+    AOT_GOTO(0x0659, L0659);
+L0611:
+    AOT_BLOCK(0x0611, 2);
+    // 0611: mov [bp-10], 0002
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, 0x0002);
+    }
+    // 0616: jmp short 0659
+    AOT_GOTO(0x0659, L0659);
+L0618:
+    AOT_BLOCK(0x0618, 2);
+    // 0618: cmp [101e], 0
+    {
+        a = 0x101e;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 061d: je 0626
+    if (ZF)
+        AOT_GOTO(0x0626, L0626);
+    AOT_GOTO(0x061f, L061f);
+L061f:
+    AOT_BLOCK(0x061f, 2);
+    // 061f: mov [bp-10], 0002
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, 0x0002);
+    }
+    // 0624: jmp short 0659
+    AOT_GOTO(0x0659, L0659);
+L0626:
+    AOT_BLOCK(0x0626, 2);
+    // 0626: mov [bp-10], 0003
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, 0x0003);
+    }
+    // 062b: jmp short 0659
+    AOT_GOTO(0x0659, L0659);
+L062d:
+    AOT_BLOCK(0x062d, 2);
+    // 062d: mov [bp-10], 0004
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, 0x0004);
+    }
+    // 0632: jmp short 0659
+    AOT_GOTO(0x0659, L0659);
+L0634:
+    AOT_BLOCK(0x0634, 8);
+    // 0634: mov dx, 007f
+    {
+        r[2] = 0x007f;
+    }
+    // 0637: and dx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = int16_t(r[2]) & int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 063a: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 063b: mov ax, 0288
+    {
+        r[0] = 0x0288;
+    }
+    // 063e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 063f: mov ax, 02da
+    {
+        r[0] = 0x02da;
+    }
+    // 0642: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0643: call 1587
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0646);
+    }
+    AOT_GOTO(0x1587, L1587);
+L0646:
+    AOT_BLOCK(0x0646, 2);
+    // 0646: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0649: jmp short 0659
+    AOT_GOTO(0x0659, L0659);
+L064b:
+    AOT_BLOCK(0x064b, 3);
+    // 064b: mov dx, 007f
+    {
+        r[2] = 0x007f;
+    }
+    // 064e: and dx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = int16_t(r[2]) & int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0651: mov bx, 025e
+    {
+        r[3] = 0x025e;
+    }
+    AOT_GOTO(0x0654, L0654);
+L0654:
+    AOT_BLOCK(0x0654, 2);
+    // 0654: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 0656: jmp 2284
+    AOT_GOTO(0x2284, L2284);
+L0659:
+    AOT_BLOCK(0x0659, 2);
+    // 0659: test byte [bp-8], 80
+    {
+        a = uint16_t(r[5] - 8);
+        val = int8_t(RD8(a)) & -128;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 065d: je 0664
+    if (ZF)
+        AOT_GOTO(0x0664, L0664);
+    AOT_GOTO(0x065f, L065f);
+L065f:
+    AOT_BLOCK(0x065f, 1);
+    // 065f: or [bp-10], 0020
+    {
+        a = uint16_t(r[5] - 16);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0664, L0664);
+L0664:
+    AOT_BLOCK(0x0664, 5);
+    // 0664: mov dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[2] = RD16(a);
+    }
+    // 0667: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 066a: mov dx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[2] = RD16(a);
+    }
+    // 066d: or dx, [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = int16_t(r[2]) | int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0670: jne 0677
+    if (!ZF)
+        AOT_GOTO(0x0677, L0677);
+    AOT_GOTO(0x0672, L0672);
+L0672:
+    AOT_BLOCK(0x0672, 2);
+    // 0672: mov di, 0284
+    {
+        r[7] = 0x0284;
+    }
+    // 0675: jmp short 06b1
+    AOT_GOTO(0x06b1, L06b1);
+L0677:
+    AOT_BLOCK(0x0677, 7);
+    // 0677: mov dx, [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        r[2] = RD16(a);
+    }
+    // 067a: mov cx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[1] = RD16(a);
+    }
+    // 067d: sub dx, [bp-24]
+    {
+        a = uint16_t(r[5] - 36);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0680: sbb cx, [bp-22]
+    {
+        a = uint16_t(r[5] - 34);
+        val = (dst = int16_t(r[1])) - (src = int16_t(RD16(a))) - CF;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) - CF < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src + CF) || (CF && !(src + 1));
+    }
+    // 0683: mov [bp-20], dx
+    {
+        a = uint16_t(r[5] - 32);
+        WR16(a, r[2]);
+    }
+    // 0686: mov [bp-1e], cx
+    {
+        a = uint16_t(r[5] - 30);
+        WR16(a, r[1]);
+    }
+    // 0689: jl 0699
+    if (SF != OF)
+        AOT_GOTO(0x0699, L0699);
+    AOT_GOTO(0x068b, L068b);
+L068b:
+    AOT_BLOCK(0x068b, 2);
+    // 068b: cmp [063e], cx
+    {
+        a = 0x063e;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[1]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 068f: jnle 06a9
+    if (!(ZF || SF != OF))
+        AOT_GOTO(0x06a9, L06a9);
+    AOT_GOTO(0x0691, L0691);
+L0691:
+    AOT_BLOCK(0x0691, 1);
+    // 0691: jne 0699
+    if (!ZF)
+        AOT_GOTO(0x0699, L0699);
+    AOT_GOTO(0x0693, L0693);
+L0693:
+    AOT_BLOCK(0x0693, 2);
+    // 0693: cmp [063c], dx
+    {
+        a = 0x063c;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0697: jnbe 06a9
+    if (!(CF || ZF))
+        AOT_GOTO(0x06a9, L06a9);
+    AOT_GOTO(0x0699, L0699);
+L0699:
+    AOT_BLOCK(0x0699, 5);
+    // 0699: push [bp-1e]
+    {
+        a = uint16_t(r[5] - 30);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 069c: push [bp-20]
+    {
+        a = uint16_t(r[5] - 32);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 069f: mov ax, 0272
+    {
+        r[0] = 0x0272;
+    }
+    // 06a2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 06a3: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06a6);
+    }
+    AOT_GOTO(0x0700, L0700);
+L06a6:
+    AOT_BLOCK(0x06a6, 1);
+    // 06a6: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x06a9, L06a9);
+L06a9:
+    AOT_BLOCK(0x06a9, 3);
+    // 06a9: mov dx, [bp-20]
+    {
+        a = uint16_t(r[5] - 32);
+        r[2] = RD16(a);
+    }
+    // 06ac: add dx, [bp-1c]
+    {
+        a = uint16_t(r[5] - 28);
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 06af: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    AOT_GOTO(0x06b1, L06b1);
+L06b1:
+    AOT_BLOCK(0x06b1, 1);
+    // 06b1: xor si, si
+    {
+        val = int16_t(r[6]) ^ int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x06b3, L06b3);
+L06b3:
+    AOT_BLOCK(0x06b3, 2);
+    // 06b3: cmp si, 8
+    {
+        val = (dst = int16_t(r[6])) - (src = 8);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 06b6: jnl 06c6
+    if (SF == OF)
+        AOT_GOTO(0x06c6, L06c6);
+    AOT_GOTO(0x06b8, L06b8);
+L06b8:
+    AOT_BLOCK(0x06b8, 5);
+    // 06b8: mov al, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 06ba: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+    }
+    // 06bb: mov [bp+si-18], al
+    {
+        a = uint16_t(r[5] + r[6] - 24);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 06be: cmp byte [di], 0
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 06c1: je 06c6
+    if (ZF)
+        AOT_GOTO(0x06c6, L06c6);
+    AOT_GOTO(0x06c3, L06c3);
+L06c3:
+    AOT_BLOCK(0x06c3, 2);
+    // 06c3: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 06c4: jmp short 06b3
+    AOT_GOTO(0x06b3, L06b3);
+L06c6:
+    AOT_BLOCK(0x06c6, 1);
+    // 06c6: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x06c7, L06c7);
+L06c7:
+    AOT_BLOCK(0x06c7, 2);
+    // 06c7: cmp si, 8
+    {
+        val = (dst = int16_t(r[6])) - (src = 8);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 06ca: jnl 06d3
+    if (SF == OF)
+        AOT_GOTO(0x06d3, L06d3);
+    AOT_GOTO(0x06cc, L06cc);
+L06cc:
+    AOT_BLOCK(0x06cc, 3);
+    // 06cc: mov byte [bp+si-18], 0
+    {
+        a = uint16_t(r[5] + r[6] - 24);
+        WR8(a, 0);
+    }
+    // 06d0: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 06d1: jmp short 06c7
+    AOT_GOTO(0x06c7, L06c7);
+L06d3:
+    AOT_BLOCK(0x06d3, 8);
+    // 06d3: push [101c]
+    {
+        a = 0x101c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 06d7: mov ax, 0008
+    {
+        r[0] = 0x0008;
+    }
+    // 06da: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 06db: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 06de: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 06df: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 06e2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 06e3: call 15a4
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06e6);
+    }
+    AOT_GOTO(0x15a4, L15a4);
+L06e6:
+    AOT_BLOCK(0x06e6, 3);
+    // 06e6: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 06e9: push [bp-10]
+    {
+        a = uint16_t(r[5] - 16);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 06ec: call 03ea
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06ef);
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L06ef:
+    AOT_BLOCK(0x06ef, 3);
+    // 06ef: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 06f0: push [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 06f3: call 03ea
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06f6);
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L06f6:
+    AOT_BLOCK(0x06f6, 3);
+    // 06f6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 06f7: inc [bp-1a]
+    {
+        a = uint16_t(r[5] - 26);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 06fa: jmp 05e8
+    AOT_GOTO(0x05e8, L05e8);
+L06fd:
+    AOT_BLOCK(0x06fd, 1);
+    // 06fd: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L0700:
+    AOT_BLOCK(0x0700, 8);
+    // 0700: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0701: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0703: push [1020]
+    {
+        a = 0x1020;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0707: mov ax, 02a6
+    {
+        r[0] = 0x02a6;
+    }
+    // 070a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 070b: mov ax, 02da
+    {
+        r[0] = 0x02da;
+    }
+    // 070e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 070f: call 1587
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0712);
+    }
+    AOT_GOTO(0x1587, L1587);
+L0712:
+    AOT_BLOCK(0x0712, 7);
+    // 0712: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0715: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0718: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 071b: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 071e: mov ax, 02da
+    {
+        r[0] = 0x02da;
+    }
+    // 0721: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0722: call 1587
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0725);
+    }
+    AOT_GOTO(0x1587, L1587);
+L0725:
+    AOT_BLOCK(0x0725, 3);
+    // 0725: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 0728: cmp [101a], 0
+    {
+        a = 0x101a;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 072d: je 0737
+    if (ZF)
+        AOT_GOTO(0x0737, L0737);
+    AOT_GOTO(0x072f, L072f);
+L072f:
+    AOT_BLOCK(0x072f, 2);
+    // 072f: push [1018]
+    {
+        a = 0x1018;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0733: call 1621
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0736);
+    }
+    AOT_GOTO(0x1621, L1621);
+L0736:
+    AOT_BLOCK(0x0736, 1);
+    // 0736: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0737, L0737);
+L0737:
+    AOT_BLOCK(0x0737, 3);
+    // 0737: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 073a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 073b: call 0e7b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x073e);
+    }
+    AOT_GOTO(0x0e7b, L0e7b);
+L073e:
+    AOT_BLOCK(0x073e, 2);
+    // 073e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 073f: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L0742:
+    AOT_BLOCK(0x0742, 5);
+    // 0742: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0743: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0745: mov ax, 02ac
+    {
+        r[0] = 0x02ac;
+    }
+    // 0748: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0749: call 0700
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x074c);
+    }
+    AOT_GOTO(0x0700, L0700);
+L074c:
+    AOT_BLOCK(0x074c, 2);
+    // 074c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 074d: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L0750:
+    AOT_BLOCK(0x0750, 13);
+    // 0750: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0751: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0753: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0754: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0755: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 0758: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 075a: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 075c: mov dx, [bx+5e4]
+    {
+        a = uint16_t(r[3] + 1508);
+        r[2] = RD16(a);
+    }
+    // 0760: mov cx, [bx+5e6]
+    {
+        a = uint16_t(r[3] + 1510);
+        r[1] = RD16(a);
+    }
+    // 0764: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 0767: mov [bp-2], cx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[1]);
+    }
+    // 076a: cmp [04de], dx
+    {
+        a = 0x04de;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 076e: jne 0776
+    if (!ZF)
+        AOT_GOTO(0x0776, L0776);
+    AOT_GOTO(0x0770, L0770);
+L0770:
+    AOT_BLOCK(0x0770, 2);
+    // 0770: cmp [04e0], cx
+    {
+        a = 0x04e0;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[1]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0774: je 0789
+    if (ZF)
+        AOT_GOTO(0x0789, L0789);
+    AOT_GOTO(0x0776, L0776);
+L0776:
+    AOT_BLOCK(0x0776, 6);
+    // 0776: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0778: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0779: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 077c: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 077f: push [05e2]
+    {
+        a = 0x05e2;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0783: call 0e46
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0786);
+    }
+    AOT_GOTO(0x0e46, L0e46);
+L0786:
+    AOT_BLOCK(0x0786, 1);
+    // 0786: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x0789, L0789);
+L0789:
+    AOT_BLOCK(0x0789, 5);
+    // 0789: push [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 078c: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 078f: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0792: push [05e2]
+    {
+        a = 0x05e2;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0796: call 0dce
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0799);
+    }
+    AOT_GOTO(0x0dce, L0dce);
+L0799:
+    AOT_BLOCK(0x0799, 17);
+    // 0799: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 079c: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 079f: mov cx, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[1] = RD16(a);
+    }
+    // 07a2: add [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2]));
+        WR16(a, val);
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 07a5: adc [bp-2], cx
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[1])) + CF;
+        WR16(a, val);
+        AF = (dst & 15) + (src & 15) + CF > 15;
+    }
+    // 07a8: mov dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[2] = RD16(a);
+    }
+    // 07ab: mov cx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[1] = RD16(a);
+    }
+    // 07ae: mov [04de], dx
+    {
+        a = 0x04de;
+        WR16(a, r[2]);
+    }
+    // 07b2: mov [04e0], cx
+    {
+        a = 0x04e0;
+        WR16(a, r[1]);
+    }
+    // 07b6: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 07b9: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 07bb: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 07bd: mov dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[2] = RD16(a);
+    }
+    // 07c0: mov cx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[1] = RD16(a);
+    }
+    // 07c3: mov [bx+5e4], dx
+    {
+        a = uint16_t(r[3] + 1508);
+        WR16(a, r[2]);
+    }
+    // 07c7: mov [bx+5e6], cx
+    {
+        a = uint16_t(r[3] + 1510);
+        WR16(a, r[1]);
+    }
+    // 07cb: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L07ce:
+    AOT_BLOCK(0x07ce, 6);
+    // 07ce: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 07cf: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 07d1: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 07d3: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 07d4: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 07d7: call 0e2d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x07da);
+    }
+    AOT_GOTO(0x0e2d, L0e2d);
+L07da:
+    AOT_BLOCK(0x07da, 5);
+    // 07da: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 07db: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 07dc: mov [05e2], ax
+    {
+        WR16(0x05e2, r[0]);
+    }
+    // 07df: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 07e1: jnl 07e7
+    if (SF == OF)
+        AOT_GOTO(0x07e7, L07e7);
+    AOT_GOTO(0x07e3, L07e3);
+L07e3:
+    AOT_BLOCK(0x07e3, 2);
+    // 07e3: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 07e5: jmp short 07ef
+    AOT_GOTO(0x07ef, L07ef);
+L07e7:
+    AOT_BLOCK(0x07e7, 2);
+    // 07e7: push [05e2]
+    {
+        a = 0x05e2;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 07eb: call 07f2
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x07ee);
+    }
+    AOT_GOTO(0x07f2, L07f2);
+L07ee:
+    AOT_BLOCK(0x07ee, 1);
+    // 07ee: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x07ef, L07ef);
+L07ef:
+    AOT_BLOCK(0x07ef, 1);
+    // 07ef: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L07f2:
+    AOT_BLOCK(0x07f2, 4);
+    // 07f2: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 07f3: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 07f5: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 07f6: xor si, si
+    {
+        val = int16_t(r[6]) ^ int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x07f8, L07f8);
+L07f8:
+    AOT_BLOCK(0x07f8, 2);
+    // 07f8: cmp si, 4
+    {
+        val = (dst = int16_t(r[6])) - (src = 4);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 07fb: jnl 0810
+    if (SF == OF)
+        AOT_GOTO(0x0810, L0810);
+    AOT_GOTO(0x07fd, L07fd);
+L07fd:
+    AOT_BLOCK(0x07fd, 8);
+    // 07fd: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+    }
+    // 07ff: mov bx, si
+    {
+        r[3] = r[6];
+    }
+    // 0801: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0803: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0805: mov [bx+5e4], ax
+    {
+        a = uint16_t(r[3] + 1508);
+        WR16(a, r[0]);
+    }
+    // 0809: mov [bx+5e6], ax
+    {
+        a = uint16_t(r[3] + 1510);
+        WR16(a, r[0]);
+    }
+    // 080d: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 080e: jmp short 07f8
+    AOT_GOTO(0x07f8, L07f8);
+L0810:
+    AOT_BLOCK(0x0810, 8);
+    // 0810: mov [05fa], 0000
+    {
+        a = 0x05fa;
+        WR16(a, 0x0000);
+    }
+    // 0816: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0818: mov bx, 0001
+    {
+        r[3] = 0x0001;
+    }
+    // 081b: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 081c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 081d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 081e: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0821: call 0e46
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0824);
+    }
+    AOT_GOTO(0x0e46, L0e46);
+L0824:
+    AOT_BLOCK(0x0824, 5);
+    // 0824: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0827: mov [05f4], ax
+    {
+        WR16(0x05f4, r[0]);
+    }
+    // 082a: mov [05f6], dx
+    {
+        a = 0x05f6;
+        WR16(a, r[2]);
+    }
+    // 082e: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0830: jnl 0836
+    if (SF == OF)
+        AOT_GOTO(0x0836, L0836);
+    AOT_GOTO(0x0832, L0832);
+L0832:
+    AOT_BLOCK(0x0832, 2);
+    // 0832: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0834: jmp short 085e
+    AOT_GOTO(0x085e, L085e);
+L0836:
+    AOT_BLOCK(0x0836, 10);
+    // 0836: mov dx, [05f4]
+    {
+        a = 0x05f4;
+        r[2] = RD16(a);
+    }
+    // 083a: mov cx, [05f6]
+    {
+        a = 0x05f6;
+        r[1] = RD16(a);
+    }
+    // 083e: mov [04de], dx
+    {
+        a = 0x04de;
+        WR16(a, r[2]);
+    }
+    // 0842: mov [04e0], cx
+    {
+        a = 0x04e0;
+        WR16(a, r[1]);
+    }
+    // 0846: mov [05e4], dx
+    {
+        a = 0x05e4;
+        WR16(a, r[2]);
+    }
+    // 084a: mov [05e6], cx
+    {
+        a = 0x05e6;
+        WR16(a, r[1]);
+    }
+    // 084e: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 0851: mov [05e2], dx
+    {
+        a = 0x05e2;
+        WR16(a, r[2]);
+    }
+    // 0855: mov [05f8], 0000
+    {
+        a = 0x05f8;
+        WR16(a, 0x0000);
+    }
+    // 085b: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    AOT_GOTO(0x085e, L085e);
+L085e:
+    AOT_BLOCK(0x085e, 1);
+    // 085e: jmp 233e
+    AOT_GOTO(0x233e, L233e);
+L087e:
+    AOT_BLOCK(0x087e, 15);
+    // 087e: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 087f: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0881: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0882: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0883: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0884: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0885: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 0888: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+    }
+    // 088a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 088b: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 088e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 088f: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0890: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0892: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0893: call 0750
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0896);
+    }
+    AOT_GOTO(0x0750, L0750);
+L0896:
+    AOT_BLOCK(0x0896, 106);
+    // 0896: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 0899: mov si, di
+    {
+        r[6] = r[7];
+    }
+    // 089b: add si, 10
+    {
+        val = (dst = int16_t(r[6])) + (src = 16);
+        r[6] = val;
+    }
+    // 089e: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 08a1: mov dl, [si+3]
+    {
+        a = uint16_t(r[6] + 3);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 08a4: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 08a6: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 08a8: mov cl, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 08ab: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 08ad: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 08af: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 08b0: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 08b3: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 08b6: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 08b8: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 08ba: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 08bc: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 08be: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 08c0: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 08c2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 08c3: or dx, cx
+    {
+        val = int16_t(r[2]) | int16_t(r[1]);
+        r[2] = val;
+    }
+    // 08c5: or bx, 0000
+    {
+        val = int16_t(r[3]) | 0;
+        r[3] = val;
+    }
+    // 08c9: mov [di+10], dx
+    {
+        a = uint16_t(r[7] + 16);
+        WR16(a, r[2]);
+    }
+    // 08cc: mov [di+12], bx
+    {
+        a = uint16_t(r[7] + 18);
+        WR16(a, r[3]);
+    }
+    // 08cf: add si, -4
+    {
+        val = (dst = int16_t(r[6])) + (src = -4);
+        r[6] = val;
+    }
+    // 08d2: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 08d5: mov dl, [si+3]
+    {
+        a = uint16_t(r[6] + 3);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 08d8: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 08da: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 08dc: mov cl, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 08df: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 08e1: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 08e3: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 08e4: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 08e7: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 08ea: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 08ec: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 08ee: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 08f0: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 08f2: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 08f4: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 08f6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 08f7: or dx, cx
+    {
+        val = int16_t(r[2]) | int16_t(r[1]);
+        r[2] = val;
+    }
+    // 08f9: or bx, 0000
+    {
+        val = int16_t(r[3]) | 0;
+        r[3] = val;
+    }
+    // 08fd: mov [di+c], dx
+    {
+        a = uint16_t(r[7] + 12);
+        WR16(a, r[2]);
+    }
+    // 0900: mov [di+e], bx
+    {
+        a = uint16_t(r[7] + 14);
+        WR16(a, r[3]);
+    }
+    // 0903: add si, -2
+    {
+        val = (dst = int16_t(r[6])) + (src = -2);
+        r[6] = val;
+    }
+    // 0906: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0909: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 090c: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 090e: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0910: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0912: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0914: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0916: mov [di+a], cx
+    {
+        a = uint16_t(r[7] + 10);
+        WR16(a, r[1]);
+    }
+    // 0919: add si, -2
+    {
+        val = (dst = int16_t(r[6])) + (src = -2);
+        r[6] = val;
+    }
+    // 091c: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 091f: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0922: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0924: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0926: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0928: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 092a: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 092c: mov [di+8], cx
+    {
+        a = uint16_t(r[7] + 8);
+        WR16(a, r[1]);
+    }
+    // 092f: add si, -2
+    {
+        val = (dst = int16_t(r[6])) + (src = -2);
+        r[6] = val;
+    }
+    // 0932: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0935: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0938: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 093a: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 093c: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 093e: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0940: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0942: mov [di+6], cx
+    {
+        a = uint16_t(r[7] + 6);
+        WR16(a, r[1]);
+    }
+    // 0945: add si, -2
+    {
+        val = (dst = int16_t(r[6])) + (src = -2);
+        r[6] = val;
+    }
+    // 0948: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 094b: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 094e: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0950: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0952: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0954: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0956: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0958: mov [di+4], cx
+    {
+        a = uint16_t(r[7] + 4);
+        WR16(a, r[1]);
+    }
+    // 095b: add si, -2
+    {
+        val = (dst = int16_t(r[6])) + (src = -2);
+        r[6] = val;
+    }
+    // 095e: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0961: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0964: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0966: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0968: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 096a: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 096c: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 096e: mov [di+2], cx
+    {
+        a = uint16_t(r[7] + 2);
+        WR16(a, r[1]);
+    }
+    // 0971: add si, -2
+    {
+        val = (dst = int16_t(r[6])) + (src = -2);
+        r[6] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0974: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0977: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 097a: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 097c: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 097e: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0980: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0982: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0984: mov [di], cx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[1]);
+    }
+    // 0986: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 0989: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 098b: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 098d: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 098e: push [di+6]
+    {
+        a = uint16_t(r[7] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0991: call 231f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0994);
+    }
+    AOT_GOTO(0x231f, L231f);
+L0994:
+    AOT_BLOCK(0x0994, 30);
+    // 0994: add ax, 0014
+    {
+        val = (dst = int16_t(r[0])) + (src = 20);
+        r[0] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0997: adc dx, 0
+    {
+        val = (dst = int16_t(r[2])) + (src = 0) + CF;
+        r[2] = val;
+    }
+    // 099a: add ax, [di+c]
+    {
+        a = uint16_t(r[7] + 12);
+        val = (dst = int16_t(r[0])) + (src = int16_t(RD16(a)));
+        r[0] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 099d: adc dx, [di+e]
+    {
+        a = uint16_t(r[7] + 14);
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a))) + CF;
+        r[2] = val;
+    }
+    // 09a0: add ax, [05f4]
+    {
+        a = 0x05f4;
+        val = (dst = int16_t(r[0])) + (src = int16_t(RD16(a)));
+        r[0] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 09a4: adc dx, [05f6]
+    {
+        a = 0x05f6;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a))) + CF;
+        r[2] = val;
+    }
+    // 09a8: mov [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[0]);
+    }
+    // 09ab: mov [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[2]);
+    }
+    // 09ae: mov [05e8], ax
+    {
+        WR16(0x05e8, r[0]);
+    }
+    // 09b1: mov [05ea], dx
+    {
+        a = 0x05ea;
+        WR16(a, r[2]);
+    }
+    // 09b5: mov dx, [di+8]
+    {
+        a = uint16_t(r[7] + 8);
+        r[2] = RD16(a);
+    }
+    // 09b8: xor cx, cx
+    {
+        val = int16_t(r[1]) ^ int16_t(r[1]);
+        r[1] = val;
+    }
+    // 09ba: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 09bc: rcl cx, 1
+    {
+        val = r[1];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[1] = val;
+    }
+    // 09be: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 09c0: rcl cx, 1
+    {
+        val = r[1];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[1] = val;
+    }
+    // 09c2: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 09c4: rcl cx, 1
+    {
+        val = r[1];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[1] = val;
+    }
+    // 09c6: add [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2]));
+        WR16(a, val);
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 09c9: adc [bp-2], cx
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[1])) + CF;
+        WR16(a, val);
+        AF = (dst & 15) + (src & 15) + CF > 15;
+    }
+    // 09cc: mov dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[2] = RD16(a);
+    }
+    // 09cf: mov cx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[1] = RD16(a);
+    }
+    // 09d2: mov [05ec], dx
+    {
+        a = 0x05ec;
+        WR16(a, r[2]);
+    }
+    // 09d6: mov [05ee], cx
+    {
+        a = 0x05ee;
+        WR16(a, r[1]);
+    }
+    // 09da: mov ax, 000c
+    {
+        r[0] = 0x000c;
+    }
+    // 09dd: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 09df: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 09e1: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 09e2: push [di+a]
+    {
+        a = uint16_t(r[7] + 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 09e5: call 231f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x09e8);
+    }
+    AOT_GOTO(0x231f, L231f);
+L09e8:
+    AOT_BLOCK(0x09e8, 7);
+    // 09e8: add [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[0]));
+        WR16(a, val);
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 09eb: adc [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2])) + CF;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val) || (CF && !(src + 1));
+    }
+    // 09ee: mov dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[2] = RD16(a);
+    }
+    // 09f1: mov cx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[1] = RD16(a);
+    }
+    // 09f4: mov [05f0], dx
+    {
+        a = 0x05f0;
+        WR16(a, r[2]);
+    }
+    // 09f8: mov [05f2], cx
+    {
+        a = 0x05f2;
+        WR16(a, r[1]);
+    }
+    // 09fc: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L0a3a:
+    AOT_BLOCK(0x0a3a, 15);
+    // 0a3a: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0a3b: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0a3d: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0a3e: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0a3f: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 0a42: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 0a45: mul [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        u32 = uint32_t(r[0]) * RD16(a);
+        r[2] = u32 >> 16;
+        r[0] = u32;
+    }
+    // 0a48: add ax, di
+    {
+        val = (dst = int16_t(r[0])) + (src = int16_t(r[7]));
+        r[0] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0a4a: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 0a4c: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 0a4f: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 0a51: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0a53: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 0a54: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0a57: call 231f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0a5a);
+    }
+    AOT_GOTO(0x231f, L231f);
+L0a5a:
+    AOT_BLOCK(0x0a5a, 6);
+    // 0a5a: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 0a5b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a5c: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0a5d: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0a5f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a60: call 0750
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0a63);
+    }
+    AOT_GOTO(0x0750, L0750);
+L0a63:
+    AOT_BLOCK(0x0a63, 6);
+    // 0a63: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 0a66: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 0a69: mul [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        u32 = uint32_t(r[0]) * RD16(a);
+        r[2] = u32 >> 16;
+        r[0] = u32;
+    }
+    // 0a6c: add ax, di
+    {
+        val = (dst = int16_t(r[0])) + (src = int16_t(r[7]));
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0a6e: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 0a70: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    AOT_GOTO(0x0a73, L0a73);
+L0a73:
+    AOT_BLOCK(0x0a73, 1);
+    // 0a73: add [05fa], dx
+    {
+        a = 0x05fa;
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2]));
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x0a77, L0a77);
+L0a77:
+    AOT_BLOCK(0x0a77, 6);
+    // 0a77: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 0a7a: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 0a7c: sub cx, 1
+    {
+        val = (dst = int16_t(r[1])) - (src = 1);
+        r[1] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 0a7f: mov [bp+6], cx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[1]);
+    }
+    // 0a82: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0a84: jne 0a89
+    if (!ZF)
+        AOT_GOTO(0x0a89, L0a89);
+    AOT_GOTO(0x0a86, L0a86);
+L0a86:
+    AOT_BLOCK(0x0a86, 1);
+    // 0a86: jmp 0bb5
+    AOT_GOTO(0x0bb5, L0bb5);
+L0a89:
+    AOT_BLOCK(0x0a89, 123);
+    // 0a89: add di, -14
+    {
+        val = (dst = int16_t(r[7])) + (src = -20);
+        r[7] = val;
+    }
+    // 0a8c: add si, -4
+    {
+        val = (dst = int16_t(r[6])) + (src = -4);
+        r[6] = val;
+    }
+    // 0a8f: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0a92: mov dl, [si+3]
+    {
+        a = uint16_t(r[6] + 3);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0a95: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0a97: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0a99: mov cl, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0a9c: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0a9e: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0aa0: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 0aa1: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0aa4: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0aa7: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0aa9: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0aab: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0aad: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0aaf: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0ab1: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 0ab3: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0ab4: or dx, cx
+    {
+        val = int16_t(r[2]) | int16_t(r[1]);
+        r[2] = val;
+    }
+    // 0ab6: or bx, 0000
+    {
+        val = int16_t(r[3]) | 0;
+        r[3] = val;
+    }
+    // 0aba: mov [di+10], dx
+    {
+        a = uint16_t(r[7] + 16);
+        WR16(a, r[2]);
+    }
+    // 0abd: mov [di+12], bx
+    {
+        a = uint16_t(r[7] + 18);
+        WR16(a, r[3]);
+    }
+    // 0ac0: add si, -4
+    {
+        val = (dst = int16_t(r[6])) + (src = -4);
+        r[6] = val;
+    }
+    // 0ac3: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0ac6: mov dl, [si+3]
+    {
+        a = uint16_t(r[6] + 3);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0ac9: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0acb: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0acd: mov cl, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0ad0: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0ad2: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0ad4: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 0ad5: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0ad8: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0adb: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0add: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0adf: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0ae1: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0ae3: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0ae5: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 0ae7: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0ae8: or dx, cx
+    {
+        val = int16_t(r[2]) | int16_t(r[1]);
+        r[2] = val;
+    }
+    // 0aea: or bx, 0000
+    {
+        val = int16_t(r[3]) | 0;
+        r[3] = val;
+    }
+    // 0aee: mov [di+c], dx
+    {
+        a = uint16_t(r[7] + 12);
+        WR16(a, r[2]);
+    }
+    // 0af1: mov [di+e], bx
+    {
+        a = uint16_t(r[7] + 14);
+        WR16(a, r[3]);
+    }
+    // 0af4: add si, -4
+    {
+        val = (dst = int16_t(r[6])) + (src = -4);
+        r[6] = val;
+    }
+    // 0af7: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0afa: mov dl, [si+3]
+    {
+        a = uint16_t(r[6] + 3);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0afd: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0aff: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0b01: mov cl, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0b04: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0b06: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0b08: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 0b09: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0b0c: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0b0f: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0b11: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0b13: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0b15: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0b17: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0b19: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 0b1b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0b1c: or dx, cx
+    {
+        val = int16_t(r[2]) | int16_t(r[1]);
+        r[2] = val;
+    }
+    // 0b1e: or bx, 0000
+    {
+        val = int16_t(r[3]) | 0;
+        r[3] = val;
+    }
+    // 0b22: mov [di+8], dx
+    {
+        a = uint16_t(r[7] + 8);
+        WR16(a, r[2]);
+    }
+    // 0b25: mov [di+a], bx
+    {
+        a = uint16_t(r[7] + 10);
+        WR16(a, r[3]);
+    }
+    // 0b28: add si, -4
+    {
+        val = (dst = int16_t(r[6])) + (src = -4);
+        r[6] = val;
+    }
+    // 0b2b: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0b2e: mov dl, [si+3]
+    {
+        a = uint16_t(r[6] + 3);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0b31: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0b33: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0b35: mov cl, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0b38: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0b3a: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0b3c: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 0b3d: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0b40: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0b43: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0b45: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0b47: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0b49: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0b4b: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0b4d: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 0b4f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0b50: or dx, cx
+    {
+        val = int16_t(r[2]) | int16_t(r[1]);
+        r[2] = val;
+    }
+    // 0b52: or bx, 0000
+    {
+        val = int16_t(r[3]) | 0;
+        r[3] = val;
+    }
+    // 0b56: mov [di+4], dx
+    {
+        a = uint16_t(r[7] + 4);
+        WR16(a, r[2]);
+    }
+    // 0b59: mov [di+6], bx
+    {
+        a = uint16_t(r[7] + 6);
+        WR16(a, r[3]);
+    }
+    // 0b5c: add si, -4
+    {
+        val = (dst = int16_t(r[6])) + (src = -4);
+        r[6] = val;
+    }
+    // 0b5f: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0b62: mov dl, [si+3]
+    {
+        a = uint16_t(r[6] + 3);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0b65: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0b67: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0b69: mov cl, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0b6c: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0b6e: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0b70: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 0b71: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0b74: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0b77: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0b79: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0b7b: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0b7d: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0b7f: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0b81: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 0b83: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0b84: or dx, cx
+    {
+        val = int16_t(r[2]) | int16_t(r[1]);
+        r[2] = val;
+    }
+    // 0b86: or bx, 0000
+    {
+        val = int16_t(r[3]) | 0;
+        r[3] = val;
+    }
+    // 0b8a: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    // 0b8c: mov [di+2], bx
+    {
+        a = uint16_t(r[7] + 2);
+        WR16(a, r[3]);
+    }
+    // 0b8f: mov dx, [di+8]
+    {
+        a = uint16_t(r[7] + 8);
+        r[2] = RD16(a);
+    }
+    // 0b92: mov cx, [di+a]
+    {
+        a = uint16_t(r[7] + 10);
+        r[1] = RD16(a);
+    }
+    // 0b95: add dx, [05f4]
+    {
+        a = 0x05f4;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0b99: adc cx, [05f6]
+    {
+        a = 0x05f6;
+        val = (dst = int16_t(r[1])) + (src = int16_t(RD16(a))) + CF;
+        r[1] = val;
+    }
+    // 0b9d: mov bx, [05fa]
+    {
+        a = 0x05fa;
+        r[3] = RD16(a);
+    }
+    // 0ba1: dec bx
+    {
+        val = int16_t(r[3]) - 1;
+        r[3] = val;
+        AF = (val & 15) == 15;
+    }
+    // 0ba2: mov [05fa], bx
+    {
+        a = 0x05fa;
+        WR16(a, r[3]);
+    }
+    // 0ba6: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0ba8: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0baa: mov [bx+4e2], dx
+    {
+        a = uint16_t(r[3] + 1250);
+        WR16(a, r[2]);
+    }
+    // 0bae: mov [bx+4e4], cx
+    {
+        a = uint16_t(r[3] + 1252);
+        WR16(a, r[1]);
+    }
+    // 0bb2: jmp 0a77
+    AOT_GOTO(0x0a77, L0a77);
+L0bb5:
+    AOT_BLOCK(0x0bb5, 1);
+    // 0bb5: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L0bb8:
+    AOT_BLOCK(0x0bb8, 12);
+    // 0bb8: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0bb9: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0bbb: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 0bbe: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0bc0: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0bc2: mov dx, [bx+4e2]
+    {
+        a = uint16_t(r[3] + 1250);
+        r[2] = RD16(a);
+    }
+    // 0bc6: mov cx, [bx+4e4]
+    {
+        a = uint16_t(r[3] + 1252);
+        r[1] = RD16(a);
+    }
+    // 0bca: mov [05e4], dx
+    {
+        a = 0x05e4;
+        WR16(a, r[2]);
+    }
+    // 0bce: mov [05e6], cx
+    {
+        a = 0x05e6;
+        WR16(a, r[1]);
+    }
+    // 0bd2: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 0bd5: mov [05f8], dx
+    {
+        a = 0x05f8;
+        WR16(a, r[2]);
+    }
+    // 0bd9: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L0bdc:
+    AOT_BLOCK(0x0bdc, 9);
+    // 0bdc: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0bdd: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0bdf: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0be0: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0be3: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0be6: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0be9: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0beb: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0bec: call 0750
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0bef);
+    }
+    AOT_GOTO(0x0750, L0750);
+L0bef:
+    AOT_BLOCK(0x0bef, 13);
+    // 0bef: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 0bf2: mov bx, [05f8]
+    {
+        a = 0x05f8;
+        r[3] = RD16(a);
+    }
+    // 0bf6: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0bf8: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0bfa: add bx, 04e2
+    {
+        val = (dst = int16_t(r[3])) + (src = 1250);
+        r[3] = val;
+    }
+    // 0bfe: mov si, bx
+    {
+        r[6] = r[3];
+    }
+    // 0c00: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 0c02: mov cx, [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        r[1] = RD16(a);
+    }
+    // 0c05: add dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0c08: adc cx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = (dst = int16_t(r[1])) + (src = int16_t(RD16(a))) + CF;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val) || (CF && !(src + 1));
+    }
+    // 0c0b: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 0c0d: mov [si+2], cx
+    {
+        a = uint16_t(r[6] + 2);
+        WR16(a, r[1]);
+    }
+    // 0c10: jmp 233e
+    AOT_GOTO(0x233e, L233e);
+L0cc6:
+    AOT_BLOCK(0x0cc6, 11);
+    // 0cc6: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0cc7: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0cc9: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0cca: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0ccb: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 0cce: mov ax, 000c
+    {
+        r[0] = 0x000c;
+    }
+    // 0cd1: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 0cd3: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0cd5: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 0cd6: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0cd9: call 231f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0cdc);
+    }
+    AOT_GOTO(0x231f, L231f);
+L0cdc:
+    AOT_BLOCK(0x0cdc, 6);
+    // 0cdc: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 0cdd: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0cde: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0cdf: mov ax, 0002
+    {
+        r[0] = 0x0002;
+    }
+    // 0ce2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0ce3: call 0750
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0ce6);
+    }
+    AOT_GOTO(0x0750, L0750);
+L0ce6:
+    AOT_BLOCK(0x0ce6, 8);
+    // 0ce6: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0ce9: mov ax, 000c
+    {
+        r[0] = 0x000c;
+    }
+    // 0cec: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 0cee: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0cef: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0cf1: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 0cf2: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0cf5: call 231f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0cf8);
+    }
+    AOT_GOTO(0x231f, L231f);
+L0cf8:
+    AOT_BLOCK(0x0cf8, 7);
+    // 0cf8: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 0cf9: add ax, dx
+    {
+        val = (dst = int16_t(r[0])) + (src = int16_t(r[2]));
+        r[0] = val;
+    }
+    // 0cfb: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 0cfd: mov ax, 000c
+    {
+        r[0] = 0x000c;
+    }
+    // 0d00: mul [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        u32 = uint32_t(r[0]) * RD16(a);
+        r[2] = u32 >> 16;
+        r[0] = u32;
+    }
+    // 0d03: add ax, di
+    {
+        val = (dst = int16_t(r[0])) + (src = int16_t(r[7]));
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0d05: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    AOT_GOTO(0x0d07, L0d07);
+L0d07:
+    AOT_BLOCK(0x0d07, 6);
+    // 0d07: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 0d0a: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 0d0c: sub cx, 1
+    {
+        val = (dst = int16_t(r[1])) - (src = 1);
+        r[1] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 0d0f: mov [bp+6], cx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[1]);
+    }
+    // 0d12: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0d14: jne 0d19
+    if (!ZF)
+        AOT_GOTO(0x0d19, L0d19);
+    AOT_GOTO(0x0d16, L0d16);
+L0d16:
+    AOT_BLOCK(0x0d16, 1);
+    // 0d16: jmp 0db2
+    AOT_GOTO(0x0db2, L0db2);
+L0d19:
+    AOT_BLOCK(0x0d19, 64);
+    // 0d19: add di, -c
+    {
+        val = (dst = int16_t(r[7])) + (src = -12);
+        r[7] = val;
+    }
+    // 0d1c: add si, -4
+    {
+        val = (dst = int16_t(r[6])) + (src = -4);
+        r[6] = val;
+    }
+    // 0d1f: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0d22: mov dl, [si+3]
+    {
+        a = uint16_t(r[6] + 3);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d25: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d27: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0d29: mov cl, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d2c: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d2e: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0d30: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 0d31: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0d34: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d37: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d39: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0d3b: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d3d: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d3f: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0d41: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 0d43: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0d44: or dx, cx
+    {
+        val = int16_t(r[2]) | int16_t(r[1]);
+        r[2] = val;
+    }
+    // 0d46: or bx, 0000
+    {
+        val = int16_t(r[3]) | 0;
+        r[3] = val;
+    }
+    // 0d4a: mov [di+8], dx
+    {
+        a = uint16_t(r[7] + 8);
+        WR16(a, r[2]);
+    }
+    // 0d4d: mov [di+a], bx
+    {
+        a = uint16_t(r[7] + 10);
+        WR16(a, r[3]);
+    }
+    // 0d50: add si, -2
+    {
+        val = (dst = int16_t(r[6])) + (src = -2);
+        r[6] = val;
+    }
+    // 0d53: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0d56: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d59: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d5b: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0d5d: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d5f: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d61: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0d63: mov [di+6], cx
+    {
+        a = uint16_t(r[7] + 6);
+        WR16(a, r[1]);
+    }
+    // 0d66: add si, -2
+    {
+        val = (dst = int16_t(r[6])) + (src = -2);
+        r[6] = val;
+    }
+    // 0d69: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0d6c: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d6f: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d71: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0d73: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d75: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d77: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0d79: mov [di+4], cx
+    {
+        a = uint16_t(r[7] + 4);
+        WR16(a, r[1]);
+    }
+    // 0d7c: add si, -4
+    {
+        val = (dst = int16_t(r[6])) + (src = -4);
+        r[6] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0d7f: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0d82: mov dl, [si+3]
+    {
+        a = uint16_t(r[6] + 3);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d85: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d87: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0d89: mov cl, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d8c: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d8e: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0d90: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 0d91: mov cx, 0008
+    {
+        r[1] = 0x0008;
+    }
+    // 0d94: mov dl, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d97: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d99: shl dx, cl
+    {
+        if (uint8_t(r[1]) > 0) {
+            val = r[2] << uint8_t(r[1]);
+            r[2] = val;
+            SF = int16_t(val) < 0;
+            ZF = int16_t(val) == 0;
+            PF = ptable[uint8_t(val)];
+            CF = val & 0x10000;
+            OF = CF != bool(val & 0x8000);
+        }
+    }
+    // 0d9b: mov cl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0d9d: xor ch, ch
+    {
+        val = int8_t(r[1] >> 8) ^ int8_t(r[1] >> 8);
+        r[1] = (r[1] & 0xff) | uint8_t(val) << 8;
+    }
+    // 0d9f: or cx, dx
+    {
+        val = int16_t(r[1]) | int16_t(r[2]);
+        r[1] = val;
+    }
+    // 0da1: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 0da3: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0da4: or dx, cx
+    {
+        val = int16_t(r[2]) | int16_t(r[1]);
+        r[2] = val;
+    }
+    // 0da6: or bx, 0000
+    {
+        val = int16_t(r[3]) | 0;
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0daa: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    // 0dac: mov [di+2], bx
+    {
+        a = uint16_t(r[7] + 2);
+        WR16(a, r[3]);
+    }
+    // 0daf: jmp 0d07
+    AOT_GOTO(0x0d07, L0d07);
+L0db2:
+    AOT_BLOCK(0x0db2, 1);
+    // 0db2: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L0db5:
+    AOT_BLOCK(0x0db5, 8);
+    // 0db5: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0db6: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0db8: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0dbb: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0dbe: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0dc1: mov ax, 0003
+    {
+        r[0] = 0x0003;
+    }
+    // 0dc4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0dc5: call 0750
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0dc8);
+    }
+    AOT_GOTO(0x0750, L0750);
+L0dc8:
+    AOT_BLOCK(0x0dc8, 2);
+    // 0dc8: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0dcb: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L0dce:
+    AOT_BLOCK(0x0dce, 5);
+    // 0dce: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0dcf: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0dd1: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0dd2: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0dd3: mov di, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[7] = RD16(a);
+    }
+    AOT_GOTO(0x0dd6, L0dd6);
+L0dd6:
+    AOT_BLOCK(0x0dd6, 3);
+    // 0dd6: mov dx, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[2] = RD16(a);
+    }
+    // 0dd9: or dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(r[2]) | int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0ddc: je 0e2a
+    if (ZF)
+        AOT_GOTO(0x0e2a, L0e2a);
+    AOT_GOTO(0x0dde, L0dde);
+L0dde:
+    AOT_BLOCK(0x0dde, 4);
+    // 0dde: mov ax, [02b8]
+    {
+        r[0] = RD16(0x02b8);
+    }
+    // 0de1: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 0de2: cmp [bp+a], dx
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0de5: jl 0df3
+    if (SF != OF)
+        AOT_GOTO(0x0df3, L0df3);
+    AOT_GOTO(0x0de7, L0de7);
+L0de7:
+    AOT_BLOCK(0x0de7, 1);
+    // 0de7: jne 0dee
+    if (!ZF)
+        AOT_GOTO(0x0dee, L0dee);
+    AOT_GOTO(0x0de9, L0de9);
+L0de9:
+    AOT_BLOCK(0x0de9, 2);
+    // 0de9: cmp [bp+8], ax
+    {
+        a = uint16_t(r[5] + 8);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0dec: jb 0df3
+    if (CF)
+        AOT_GOTO(0x0df3, L0df3);
+    AOT_GOTO(0x0dee, L0dee);
+L0dee:
+    AOT_BLOCK(0x0dee, 4);
+    // 0dee: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 0def: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 0df0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0df1: jmp short 0df9
+    AOT_GOTO(0x0df9, L0df9);
+L0df3:
+    AOT_BLOCK(0x0df3, 2);
+    // 0df3: push [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0df6: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x0df9, L0df9);
+L0df9:
+    AOT_BLOCK(0x0df9, 7);
+    // 0df9: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 0dfa: pop cx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[1] = val;
+    }
+    // 0dfb: mov si, dx
+    {
+        r[6] = r[2];
+    }
+    // 0dfd: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0dfe: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0dff: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e02: call 161d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e05);
+    }
+    AOT_GOTO(0x161d, L161d);
+L0e05:
+    AOT_BLOCK(0x0e05, 3);
+    // 0e05: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 0e08: cmp ax, si
+    {
+        val = (dst = int16_t(r[0])) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0e0a: je 0e0f
+    if (ZF)
+        AOT_GOTO(0x0e0f, L0e0f);
+    AOT_GOTO(0x0e0c, L0e0c);
+L0e0c:
+    AOT_BLOCK(0x0e0c, 1);
+    // 0e0c: call 0742
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e0f);
+    }
+    AOT_GOTO(0x0742, L0742);
+L0e0f:
+    AOT_BLOCK(0x0e0f, 12);
+    // 0e0f: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0e11: add dx, di
+    {
+        val = (dst = int16_t(r[2])) + (src = int16_t(r[7]));
+        r[2] = val;
+    }
+    // 0e13: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 0e15: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 0e17: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 0e18: mov cx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[1] = RD16(a);
+    }
+    // 0e1b: mov bx, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[3] = RD16(a);
+    }
+    // 0e1e: sub cx, ax
+    {
+        val = (dst = int16_t(r[1])) - (src = int16_t(r[0]));
+        r[1] = val;
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0e20: sbb bx, dx
+    {
+        val = (dst = int16_t(r[3])) - (src = int16_t(r[2])) - CF;
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) - CF < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src + CF) || (CF && !(src + 1));
+    }
+    // 0e22: mov [bp+8], cx
+    {
+        a = uint16_t(r[5] + 8);
+        WR16(a, r[1]);
+    }
+    // 0e25: mov [bp+a], bx
+    {
+        a = uint16_t(r[5] + 10);
+        WR16(a, r[3]);
+    }
+    // 0e28: jmp short 0dd6
+    AOT_GOTO(0x0dd6, L0dd6);
+L0e2a:
+    AOT_BLOCK(0x0e2a, 1);
+    // 0e2a: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L0e2d:
+    AOT_BLOCK(0x0e2d, 7);
+    // 0e2d: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0e2e: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0e30: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0e31: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e34: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e37: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e3a: call 1619
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e3d);
+    }
+    AOT_GOTO(0x1619, L1619);
+L0e3d:
+    AOT_BLOCK(0x0e3d, 3);
+    // 0e3d: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0e40: mov [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[0]);
+    }
+    // 0e43: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L0e46:
+    AOT_BLOCK(0x0e46, 9);
+    // 0e46: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0e47: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0e49: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0e4a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0e4b: push [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e4e: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e51: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e54: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e57: call 1615
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e5a);
+    }
+    AOT_GOTO(0x1615, L1615);
+L0e5a:
+    AOT_BLOCK(0x0e5a, 3);
+    // 0e5a: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0e5d: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 0e5e: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L0e61:
+    AOT_BLOCK(0x0e61, 4);
+    // 0e61: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0e62: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0e64: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0e65: mov si, [02ba]
+    {
+        a = 0x02ba;
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x0e69, L0e69);
+L0e69:
+    AOT_BLOCK(0x0e69, 2);
+    // 0e69: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 0e6a: jl 0e78
+    if (SF != OF)
+        AOT_GOTO(0x0e78, L0e78);
+    AOT_GOTO(0x0e6c, L0e6c);
+L0e6c:
+    AOT_BLOCK(0x0e6c, 4);
+    // 0e6c: mov bx, si
+    {
+        r[3] = r[6];
+    }
+    // 0e6e: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0e70: mov bx, [bx+1024]
+    {
+        a = uint16_t(r[3] + 4132);
+        r[3] = RD16(a);
+    }
+    // 0e74: call bx
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e76);
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L0e76:
+    AOT_BLOCK(0x0e76, 1);
+    // 0e76: jmp short 0e69
+    AOT_GOTO(0x0e69, L0e69);
+L0e78:
+    AOT_BLOCK(0x0e78, 1);
+    // 0e78: jmp 233e
+    AOT_GOTO(0x233e, L233e);
+L0e7b:
+    AOT_BLOCK(0x0e7b, 3);
+    // 0e7b: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0e7c: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0e7e: call 0e61
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e81);
+    }
+    AOT_GOTO(0x0e61, L0e61);
+L0e81:
+    AOT_BLOCK(0x0e81, 2);
+    // 0e81: cmp [02bc], 0
+    {
+        a = 0x02bc;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0e86: je 0e8e
+    if (ZF)
+        AOT_GOTO(0x0e8e, L0e8e);
+    AOT_GOTO(0x0e88, L0e88);
+L0e88:
+    AOT_BLOCK(0x0e88, 2);
+    // 0e88: mov bx, [02bc]
+    {
+        a = 0x02bc;
+        r[3] = RD16(a);
+    }
+    // 0e8c: call bx
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e8e);
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L0e8e:
+    AOT_BLOCK(0x0e8e, 2);
+    // 0e8e: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0e91: call 1609
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0e94);
+    }
+    AOT_GOTO(0x1609, L1609);
+L0e94:
+    AOT_BLOCK(0x0e94, 2);
+    // 0e94: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0e95: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L0e98:
+    AOT_BLOCK(0x0e98, 7);
+    // 0e98: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0e99: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0e9b: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0e9c: mov bx, [05fe]
+    {
+        a = 0x05fe;
+        r[3] = RD16(a);
+    }
+    // 0ea0: add bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(r[3])) + (src = int16_t(RD16(a)));
+        r[3] = val;
+    }
+    // 0ea3: cmp [05fe], bx
+    {
+        a = 0x05fe;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[3]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0ea7: jnbe 0ec0
+    if (!(CF || ZF))
+        AOT_GOTO(0x0ec0, L0ec0);
+    AOT_GOTO(0x0ea9, L0ea9);
+L0ea9:
+    AOT_BLOCK(0x0ea9, 7);
+    // 0ea9: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 0eac: add dx, [05fe]
+    {
+        a = 0x05fe;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 0eb0: add dx, 03ff
+    {
+        val = (dst = int16_t(r[2])) + (src = 1023);
+        r[2] = val;
+    }
+    // 0eb4: and dx, fc00
+    {
+        val = int16_t(r[2]) & -1024;
+        r[2] = val;
+    }
+    // 0eb8: mov si, dx
+    {
+        r[6] = r[2];
+    }
+    // 0eba: cmp [05fe], dx
+    {
+        a = 0x05fe;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0ebe: jbe 0eca
+    if (CF || ZF)
+        AOT_GOTO(0x0eca, L0eca);
+    AOT_GOTO(0x0ec0, L0ec0);
+L0ec0:
+    AOT_BLOCK(0x0ec0, 3);
+    // 0ec0: mov [02c0], 000c
+    {
+        a = 0x02c0;
+        WR16(a, 0x000c);
+    }
+    // 0ec6: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0ec8: jmp short 0ef2
+    AOT_GOTO(0x0ef2, L0ef2);
+L0eca:
+    AOT_BLOCK(0x0eca, 2);
+    // 0eca: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0ecb: call 113a
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0ece);
+    }
+    AOT_GOTO(0x113a, L113a);
+L0ece:
+    AOT_BLOCK(0x0ece, 3);
+    // 0ece: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0ecf: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0ed1: je 0ed7
+    if (ZF)
+        AOT_GOTO(0x0ed7, L0ed7);
+    AOT_GOTO(0x0ed3, L0ed3);
+L0ed3:
+    AOT_BLOCK(0x0ed3, 2);
+    // 0ed3: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0ed5: jmp short 0ef2
+    AOT_GOTO(0x0ef2, L0ef2);
+L0ed7:
+    AOT_BLOCK(0x0ed7, 5);
+    // 0ed7: mov bx, [05fe]
+    {
+        a = 0x05fe;
+        r[3] = RD16(a);
+    }
+    // 0edb: mov [bx-2], si
+    {
+        a = uint16_t(r[3] - 2);
+        WR16(a, r[6]);
+    }
+    // 0ede: mov [si-2], 0000
+    {
+        a = uint16_t(r[6] - 2);
+        WR16(a, 0x0000);
+    }
+    // 0ee3: push [05fe]
+    {
+        a = 0x05fe;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0ee7: call 10c4
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0eea);
+    }
+    AOT_GOTO(0x10c4, L10c4);
+L0eea:
+    AOT_BLOCK(0x0eea, 3);
+    // 0eea: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0eeb: mov [05fe], si
+    {
+        a = 0x05fe;
+        WR16(a, r[6]);
+    }
+    // 0eef: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    AOT_GOTO(0x0ef2, L0ef2);
+L0ef2:
+    AOT_BLOCK(0x0ef2, 1);
+    // 0ef2: jmp 233e
+    AOT_GOTO(0x233e, L233e);
+L0ef5:
+    AOT_BLOCK(0x0ef5, 7);
+    // 0ef5: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0ef6: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0ef8: sub sp, c
+    {
+        val = (dst = int16_t(r[4])) - (src = 12);
+        r[4] = val;
+    }
+    // 0efb: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0efc: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0efd: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f01: jne 0f08
+    if (!ZF)
+        AOT_GOTO(0x0f08, L0f08);
+    AOT_GOTO(0x0f03, L0f03);
+L0f03:
+    AOT_BLOCK(0x0f03, 2);
+    // 0f03: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0f05: jmp 0fd5
+    AOT_GOTO(0x0fd5, L0fd5);
+L0f08:
+    AOT_BLOCK(0x0f08, 1);
+    // 0f08: mov [bp-c], 0000
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x0f0d, L0f0d);
+L0f0d:
+    AOT_BLOCK(0x0f0d, 2);
+    // 0f0d: cmp [bp-c], 2
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) - (src = 2);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f11: jb 0f16
+    if (CF)
+        AOT_GOTO(0x0f16, L0f16);
+    AOT_GOTO(0x0f13, L0f13);
+L0f13:
+    AOT_BLOCK(0x0f13, 1);
+    // 0f13: jmp 0fd3
+    AOT_GOTO(0x0fd3, L0fd3);
+L0f16:
+    AOT_BLOCK(0x0f16, 7);
+    // 0f16: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 0f19: inc dx
+    {
+        val = int16_t(r[2]) + 1;
+        r[2] = val;
+    }
+    // 0f1a: and dx, fffe
+    {
+        val = int16_t(r[2]) & -2;
+        r[2] = val;
+    }
+    // 0f1e: add dx, 2
+    {
+        val = (dst = int16_t(r[2])) + (src = 2);
+        r[2] = val;
+    }
+    // 0f21: mov [bp-a], dx
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, r[2]);
+    }
+    // 0f24: cmp dx, 4
+    {
+        val = (dst = int16_t(r[2])) - (src = 4);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f27: jnb 0f34
+    if (!CF)
+        AOT_GOTO(0x0f34, L0f34);
+    AOT_GOTO(0x0f29, L0f29);
+L0f29:
+    AOT_BLOCK(0x0f29, 3);
+    // 0f29: mov [02c0], 000c
+    {
+        a = 0x02c0;
+        WR16(a, 0x000c);
+    }
+    // 0f2f: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0f31: jmp 0fd5
+    AOT_GOTO(0x0fd5, L0fd5);
+L0f34:
+    AOT_BLOCK(0x0f34, 2);
+    // 0f34: cmp [05fc], 0
+    {
+        a = 0x05fc;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f39: jne 0f68
+    if (!ZF)
+        AOT_GOTO(0x0f68, L0f68);
+    AOT_GOTO(0x0f3b, L0f3b);
+L0f3b:
+    AOT_BLOCK(0x0f3b, 3);
+    // 0f3b: mov ax, 0004
+    {
+        r[0] = 0x0004;
+    }
+    // 0f3e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0f3f: call 1175
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0f42);
+    }
+    AOT_GOTO(0x1175, L1175);
+L0f42:
+    AOT_BLOCK(0x0f42, 4);
+    // 0f42: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0f43: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 0f45: cmp ax, ffff
+    {
+        val = (dst = int16_t(r[0])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f48: jne 0f4f
+    if (!ZF)
+        AOT_GOTO(0x0f4f, L0f4f);
+    AOT_GOTO(0x0f4a, L0f4a);
+L0f4a:
+    AOT_BLOCK(0x0f4a, 2);
+    // 0f4a: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0f4c: jmp 0fd5
+    AOT_GOTO(0x0fd5, L0fd5);
+L0f4f:
+    AOT_BLOCK(0x0f4f, 8);
+    // 0f4f: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 0f51: inc dx
+    {
+        val = int16_t(r[2]) + 1;
+        r[2] = val;
+    }
+    // 0f52: and dx, fffe
+    {
+        val = int16_t(r[2]) & -2;
+        r[2] = val;
+    }
+    // 0f56: mov si, dx
+    {
+        r[6] = r[2];
+    }
+    // 0f58: add si, 2
+    {
+        val = (dst = int16_t(r[6])) + (src = 2);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0f5b: mov [05fc], si
+    {
+        a = 0x05fc;
+        WR16(a, r[6]);
+    }
+    // 0f5f: mov [05fe], si
+    {
+        a = 0x05fe;
+        WR16(a, r[6]);
+    }
+    // 0f63: mov [si-2], 0000
+    {
+        a = uint16_t(r[6] - 2);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x0f68, L0f68);
+L0f68:
+    AOT_BLOCK(0x0f68, 2);
+    // 0f68: mov [bp-2], 0000
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, 0x0000);
+    }
+    // 0f6d: mov si, [0600]
+    {
+        a = 0x0600;
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x0f71, L0f71);
+L0f71:
+    AOT_BLOCK(0x0f71, 2);
+    // 0f71: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0f73: je 0fc2
+    if (ZF)
+        AOT_GOTO(0x0fc2, L0fc2);
+    AOT_GOTO(0x0f75, L0f75);
+L0f75:
+    AOT_BLOCK(0x0f75, 7);
+    // 0f75: mov dx, [si-2]
+    {
+        a = uint16_t(r[6] - 2);
+        r[2] = RD16(a);
+    }
+    // 0f78: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 0f7b: mov dx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[2] = RD16(a);
+    }
+    // 0f7e: add dx, si
+    {
+        val = (dst = int16_t(r[2])) + (src = int16_t(r[6]));
+        r[2] = val;
+    }
+    // 0f80: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 0f82: cmp [bp-6], di
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[7]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f85: jb 0fbb
+    if (CF)
+        AOT_GOTO(0x0fbb, L0fbb);
+    AOT_GOTO(0x0f87, L0f87);
+L0f87:
+    AOT_BLOCK(0x0f87, 2);
+    // 0f87: cmp di, si
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f89: jbe 0fbb
+    if (CF || ZF)
+        AOT_GOTO(0x0fbb, L0fbb);
+    AOT_GOTO(0x0f8b, L0f8b);
+L0f8b:
+    AOT_BLOCK(0x0f8b, 3);
+    // 0f8b: lea bx, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[3] = a;
+    }
+    // 0f8e: cmp [bp-6], bx
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[3]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f91: jbe 0fa2
+    if (CF || ZF)
+        AOT_GOTO(0x0fa2, L0fa2);
+    AOT_GOTO(0x0f93, L0f93);
+L0f93:
+    AOT_BLOCK(0x0f93, 6);
+    // 0f93: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 0f96: mov [di-2], dx
+    {
+        a = uint16_t(r[7] - 2);
+        WR16(a, r[2]);
+    }
+    // 0f99: mov [si-2], di
+    {
+        a = uint16_t(r[6] - 2);
+        WR16(a, r[7]);
+    }
+    // 0f9c: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 0f9e: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    // 0fa0: mov [si], di
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[7]);
+    }
+    AOT_GOTO(0x0fa2, L0fa2);
+L0fa2:
+    AOT_BLOCK(0x0fa2, 2);
+    // 0fa2: cmp [bp-2], 0
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0fa6: je 0fb1
+    if (ZF)
+        AOT_GOTO(0x0fb1, L0fb1);
+    AOT_GOTO(0x0fa8, L0fa8);
+L0fa8:
+    AOT_BLOCK(0x0fa8, 4);
+    // 0fa8: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 0faa: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 0fad: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 0faf: jmp short 0fb7
+    AOT_GOTO(0x0fb7, L0fb7);
+L0fb1:
+    AOT_BLOCK(0x0fb1, 2);
+    // 0fb1: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 0fb3: mov [0600], dx
+    {
+        a = 0x0600;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x0fb7, L0fb7);
+L0fb7:
+    AOT_BLOCK(0x0fb7, 2);
+    // 0fb7: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 0fb9: jmp short 0fd5
+    AOT_GOTO(0x0fd5, L0fd5);
+L0fbb:
+    AOT_BLOCK(0x0fbb, 3);
+    // 0fbb: mov [bp-2], si
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[6]);
+    }
+    // 0fbe: mov si, [si]
+    {
+        a = uint16_t(r[6]);
+        r[6] = RD16(a);
+    }
+    // 0fc0: jmp short 0f71
+    AOT_GOTO(0x0f71, L0f71);
+L0fc2:
+    AOT_BLOCK(0x0fc2, 2);
+    // 0fc2: push [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0fc5: call 0e98
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0fc8);
+    }
+    AOT_GOTO(0x0e98, L0e98);
+L0fc8:
+    AOT_BLOCK(0x0fc8, 3);
+    // 0fc8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0fc9: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0fcb: je 0fd3
+    if (ZF)
+        AOT_GOTO(0x0fd3, L0fd3);
+    AOT_GOTO(0x0fcd, L0fcd);
+L0fcd:
+    AOT_BLOCK(0x0fcd, 2);
+    // 0fcd: inc [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0fd0: jmp 0f0d
+    AOT_GOTO(0x0f0d, L0f0d);
+L0fd3:
+    AOT_BLOCK(0x0fd3, 1);
+    // 0fd3: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0fd5, L0fd5);
+L0fd5:
+    AOT_BLOCK(0x0fd5, 1);
+    // 0fd5: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L10c4:
+    AOT_BLOCK(0x10c4, 9);
+    // 10c4: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 10c5: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 10c7: sub sp, 6
+    {
+        val = (dst = int16_t(r[4])) - (src = 6);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 10ca: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 10cb: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 10cc: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 10cf: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 10d2: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 10d4: je 1137
+    if (ZF)
+        AOT_GOTO(0x1137, L1137);
+    AOT_GOTO(0x10d6, L10d6);
+L10d6:
+    AOT_BLOCK(0x10d6, 2);
+    // 10d6: xor di, di
+    {
+        val = int16_t(r[7]) ^ int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 10d8: mov si, [0600]
+    {
+        a = 0x0600;
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x10dc, L10dc);
+L10dc:
+    AOT_BLOCK(0x10dc, 2);
+    // 10dc: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 10de: je 10eb
+    if (ZF)
+        AOT_GOTO(0x10eb, L10eb);
+    AOT_GOTO(0x10e0, L10e0);
+L10e0:
+    AOT_BLOCK(0x10e0, 2);
+    // 10e0: cmp [bp-6], si
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 10e3: jb 10eb
+    if (CF)
+        AOT_GOTO(0x10eb, L10eb);
+    AOT_GOTO(0x10e5, L10e5);
+L10e5:
+    AOT_BLOCK(0x10e5, 3);
+    // 10e5: mov di, si
+    {
+        r[7] = r[6];
+    }
+    // 10e7: mov si, [si]
+    {
+        a = uint16_t(r[6]);
+        r[6] = RD16(a);
+    }
+    // 10e9: jmp short 10dc
+    AOT_GOTO(0x10dc, L10dc);
+L10eb:
+    AOT_BLOCK(0x10eb, 4);
+    // 10eb: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 10ee: mov [bx], si
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[6]);
+    }
+    // 10f0: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 10f2: je 10fb
+    if (ZF)
+        AOT_GOTO(0x10fb, L10fb);
+    AOT_GOTO(0x10f4, L10f4);
+L10f4:
+    AOT_BLOCK(0x10f4, 3);
+    // 10f4: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 10f7: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    // 10f9: jmp short 1102
+    AOT_GOTO(0x1102, L1102);
+L10fb:
+    AOT_BLOCK(0x10fb, 2);
+    // 10fb: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 10fe: mov [0600], dx
+    {
+        a = 0x0600;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1102, L1102);
+L1102:
+    AOT_BLOCK(0x1102, 2);
+    // 1102: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1104: je 111b
+    if (ZF)
+        AOT_GOTO(0x111b, L111b);
+    AOT_GOTO(0x1106, L1106);
+L1106:
+    AOT_BLOCK(0x1106, 3);
+    // 1106: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 1109: cmp [bx-2], si
+    {
+        a = uint16_t(r[3] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 110c: jne 111b
+    if (!ZF)
+        AOT_GOTO(0x111b, L111b);
+    AOT_GOTO(0x110e, L110e);
+L110e:
+    AOT_BLOCK(0x110e, 5);
+    // 110e: mov dx, [si-2]
+    {
+        a = uint16_t(r[6] - 2);
+        r[2] = RD16(a);
+    }
+    // 1111: mov [bx-2], dx
+    {
+        a = uint16_t(r[3] - 2);
+        WR16(a, r[2]);
+    }
+    // 1114: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1116: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 1119: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x111b, L111b);
+L111b:
+    AOT_BLOCK(0x111b, 2);
+    // 111b: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 111d: je 1137
+    if (ZF)
+        AOT_GOTO(0x1137, L1137);
+    AOT_GOTO(0x111f, L111f);
+L111f:
+    AOT_BLOCK(0x111f, 3);
+    // 111f: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1122: cmp [di-2], dx
+    {
+        a = uint16_t(r[7] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1125: jne 1137
+    if (!ZF)
+        AOT_GOTO(0x1137, L1137);
+    AOT_GOTO(0x1127, L1127);
+L1127:
+    AOT_BLOCK(0x1127, 6);
+    // 1127: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 112a: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 112d: mov [di-2], dx
+    {
+        a = uint16_t(r[7] - 2);
+        WR16(a, r[2]);
+    }
+    // 1130: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 1133: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 1135: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1137, L1137);
+L1137:
+    AOT_BLOCK(0x1137, 1);
+    // 1137: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L113a:
+    AOT_BLOCK(0x113a, 6);
+    // 113a: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 113b: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 113d: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+    }
+    // 1140: mov dx, [032a]
+    {
+        a = 0x032a;
+        r[2] = RD16(a);
+    }
+    // 1144: cmp [bp+4], dx
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1147: je 1170
+    if (ZF)
+        AOT_GOTO(0x1170, L1170);
+    AOT_GOTO(0x1149, L1149);
+L1149:
+    AOT_BLOCK(0x1149, 9);
+    // 1149: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 114c: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 114f: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1152: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1153: mov ax, 0011
+    {
+        r[0] = 0x0011;
+    }
+    // 1156: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1157: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1159: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 115a: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x115d);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L115d:
+    AOT_BLOCK(0x115d, 3);
+    // 115d: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 1160: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1162: jnl 1169
+    if (SF == OF)
+        AOT_GOTO(0x1169, L1169);
+    AOT_GOTO(0x1164, L1164);
+L1164:
+    AOT_BLOCK(0x1164, 2);
+    // 1164: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1167: jmp short 1172
+    AOT_GOTO(0x1172, L1172);
+L1169:
+    AOT_BLOCK(0x1169, 2);
+    // 1169: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 116c: mov [032a], dx
+    {
+        a = 0x032a;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1170, L1170);
+L1170:
+    AOT_BLOCK(0x1170, 1);
+    // 1170: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1172, L1172);
+L1172:
+    AOT_BLOCK(0x1172, 1);
+    // 1172: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L1175:
+    AOT_BLOCK(0x1175, 10);
+    // 1175: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1176: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1178: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1179: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 117a: mov si, [032a]
+    {
+        a = 0x032a;
+        r[6] = RD16(a);
+    }
+    // 117e: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1181: add dx, [032a]
+    {
+        a = 0x032a;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 1185: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 1187: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 118b: jle 1191
+    if (ZF || SF != OF)
+        AOT_GOTO(0x1191, L1191);
+    AOT_GOTO(0x118d, L118d);
+L118d:
+    AOT_BLOCK(0x118d, 2);
+    // 118d: cmp di, si
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 118f: jb 119b
+    if (CF)
+        AOT_GOTO(0x119b, L119b);
+    AOT_GOTO(0x1191, L1191);
+L1191:
+    AOT_BLOCK(0x1191, 2);
+    // 1191: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1195: jnl 11a0
+    if (SF == OF)
+        AOT_GOTO(0x11a0, L11a0);
+    AOT_GOTO(0x1197, L1197);
+L1197:
+    AOT_BLOCK(0x1197, 2);
+    // 1197: cmp di, si
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1199: jbe 11a0
+    if (CF || ZF)
+        AOT_GOTO(0x11a0, L11a0);
+    AOT_GOTO(0x119b, L119b);
+L119b:
+    AOT_BLOCK(0x119b, 2);
+    // 119b: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 119e: jmp short 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L11a0:
+    AOT_BLOCK(0x11a0, 2);
+    // 11a0: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 11a1: call 113a
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x11a4);
+    }
+    AOT_GOTO(0x113a, L113a);
+L11a4:
+    AOT_BLOCK(0x11a4, 3);
+    // 11a4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 11a5: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 11a7: jne 11ad
+    if (!ZF)
+        AOT_GOTO(0x11ad, L11ad);
+    AOT_GOTO(0x11a9, L11a9);
+L11a9:
+    AOT_BLOCK(0x11a9, 2);
+    // 11a9: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 11ab: jmp short 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L11ad:
+    AOT_BLOCK(0x11ad, 1);
+    // 11ad: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    AOT_GOTO(0x11b0, L11b0);
+L11b0:
+    AOT_BLOCK(0x11b0, 1);
+    // 11b0: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L11b3:
+    AOT_BLOCK(0x11b3, 10);
+    // 11b3: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 11b4: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 11b6: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 11b7: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 11b8: mov si, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[6] = RD16(a);
+    }
+    // 11bb: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 11be: mov [si+2], dx
+    {
+        a = uint16_t(r[6] + 2);
+        WR16(a, r[2]);
+    }
+    // 11c1: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 11c2: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 11c5: call 162f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x11c8);
+    }
+    AOT_GOTO(0x162f, L162f);
+L11c8:
+    AOT_BLOCK(0x11c8, 5);
+    // 11c8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 11c9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 11ca: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 11cc: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 11ce: je 11d3
+    if (ZF)
+        AOT_GOTO(0x11d3, L11d3);
+    AOT_GOTO(0x11d0, L11d0);
+L11d0:
+    AOT_BLOCK(0x11d0, 1);
+    // 11d0: mov [si+2], di
+    {
+        a = uint16_t(r[6] + 2);
+        WR16(a, r[7]);
+    }
+    AOT_GOTO(0x11d3, L11d3);
+L11d3:
+    AOT_BLOCK(0x11d3, 2);
+    // 11d3: cmp [si+2], 0
+    {
+        a = uint16_t(r[6] + 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 11d7: jnl 11e7
+    if (SF == OF)
+        AOT_GOTO(0x11e7, L11e7);
+    AOT_GOTO(0x11d9, L11d9);
+L11d9:
+    AOT_BLOCK(0x11d9, 5);
+    // 11d9: mov dx, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[2] = RD16(a);
+    }
+    // 11dc: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 11de: mov [02c0], dx
+    {
+        a = 0x02c0;
+        WR16(a, r[2]);
+    }
+    // 11e2: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 11e5: jmp short 11ea
+    AOT_GOTO(0x11ea, L11ea);
+L11e7:
+    AOT_BLOCK(0x11e7, 1);
+    // 11e7: mov ax, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x11ea, L11ea);
+L11ea:
+    AOT_BLOCK(0x11ea, 1);
+    // 11ea: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L11ed:
+    AOT_BLOCK(0x11ed, 5);
+    // 11ed: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 11ee: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 11f0: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 11f1: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 11f2: mov di, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[7] = RD16(a);
+    }
+    AOT_GOTO(0x11f5, L11f5);
+L11f5:
+    AOT_BLOCK(0x11f5, 4);
+    // 11f5: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 11f6: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 11f9: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 11fc: call 1819
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x11ff);
+    }
+    AOT_GOTO(0x1819, L1819);
+L11ff:
+    AOT_BLOCK(0x11ff, 4);
+    // 11ff: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 1202: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 1204: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1206: jle 121c
+    if (ZF || SF != OF)
+        AOT_GOTO(0x121c, L121c);
+    AOT_GOTO(0x1208, L1208);
+L1208:
+    AOT_BLOCK(0x1208, 2);
+    // 1208: cmp si, di
+    {
+        val = (dst = int16_t(r[6])) - (src = int16_t(r[7]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 120a: jnl 121c
+    if (SF == OF)
+        AOT_GOTO(0x121c, L121c);
+    AOT_GOTO(0x120c, L120c);
+L120c:
+    AOT_BLOCK(0x120c, 7);
+    // 120c: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 120e: sub dx, si
+    {
+        val = (dst = int16_t(r[2])) - (src = int16_t(r[6]));
+        r[2] = val;
+    }
+    // 1210: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 1212: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 1214: add dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1217: mov [bp+6], dx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[2]);
+    }
+    // 121a: jmp short 11f5
+    AOT_GOTO(0x11f5, L11f5);
+L121c:
+    AOT_BLOCK(0x121c, 3);
+    // 121c: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+    }
+    // 121e: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1220: jle 1223
+    if (ZF || SF != OF)
+        AOT_GOTO(0x1223, L1223);
+    AOT_GOTO(0x1222, L1222);
+L1222:
+    AOT_BLOCK(0x1222, 1);
+    // 1222: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1223, L1223);
+L1223:
+    AOT_BLOCK(0x1223, 1);
+    // 1223: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L1226:
+    AOT_BLOCK(0x1226, 11);
+    // 1226: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1227: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1229: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 122a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 122b: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 122c: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 122d: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 1230: mov si, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[6] = RD16(a);
+    }
+    // 1233: mov [02bc], 20c6
+    {
+        a = 0x02bc;
+        WR16(a, 0x20c6);
+    }
+    // 1239: cmp [si+2], 0
+    {
+        a = uint16_t(r[6] + 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 123d: jnl 1246
+    if (SF == OF)
+        AOT_GOTO(0x1246, L1246);
+    AOT_GOTO(0x123f, L123f);
+L123f:
+    AOT_BLOCK(0x123f, 3);
+    // 123f: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 1241: xor ah, ah
+    {
+        val = int8_t(r[0] >> 8) ^ int8_t(r[0] >> 8);
+        r[0] = (r[0] & 0xff) | uint8_t(val) << 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1243: jmp 1445
+    AOT_GOTO(0x1445, L1445);
+L1246:
+    AOT_BLOCK(0x1246, 2);
+    // 1246: test byte [si+4], 2
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 2;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 124a: jne 1252
+    if (!ZF)
+        AOT_GOTO(0x1252, L1252);
+    AOT_GOTO(0x124c, L124c);
+L124c:
+    AOT_BLOCK(0x124c, 2);
+    // 124c: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 124f: jmp 1445
+    AOT_GOTO(0x1445, L1445);
+L1252:
+    AOT_BLOCK(0x1252, 2);
+    // 1252: test byte [si+4], 80
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & -128;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1256: je 1264
+    if (ZF)
+        AOT_GOTO(0x1264, L1264);
+    AOT_GOTO(0x1258, L1258);
+L1258:
+    AOT_BLOCK(0x1258, 2);
+    // 1258: test byte [si+4], 10
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 16;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 125c: jne 1264
+    if (!ZF)
+        AOT_GOTO(0x1264, L1264);
+    AOT_GOTO(0x125e, L125e);
+L125e:
+    AOT_BLOCK(0x125e, 2);
+    // 125e: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1261: jmp 1445
+    AOT_GOTO(0x1445, L1445);
+L1264:
+    AOT_BLOCK(0x1264, 4);
+    // 1264: and [si+4], ff7f
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) & -129;
+        WR16(a, val);
+    }
+    // 1269: or [si+4], 0100
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 256;
+        WR16(a, val);
+    }
+    // 126e: test byte [si+4], 4
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 4;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1272: je 1277
+    if (ZF)
+        AOT_GOTO(0x1277, L1277);
+    AOT_GOTO(0x1274, L1274);
+L1274:
+    AOT_BLOCK(0x1274, 1);
+    // 1274: jmp 12ee
+    AOT_GOTO(0x12ee, L12ee);
+L1277:
+    AOT_BLOCK(0x1277, 2);
+    // 1277: cmp [si+8], 0
+    {
+        a = uint16_t(r[6] + 8);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 127b: je 1280
+    if (ZF)
+        AOT_GOTO(0x1280, L1280);
+    AOT_GOTO(0x127d, L127d);
+L127d:
+    AOT_BLOCK(0x127d, 1);
+    // 127d: jmp 12ee
+    AOT_GOTO(0x12ee, L12ee);
+L1280:
+    AOT_BLOCK(0x1280, 2);
+    // 1280: cmp si, 02ce
+    {
+        val = (dst = int16_t(r[6])) - (src = 718);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1284: jne 12b8
+    if (!ZF)
+        AOT_GOTO(0x12b8, L12b8);
+    AOT_GOTO(0x1286, L1286);
+L1286:
+    AOT_BLOCK(0x1286, 2);
+    // 1286: push [02d0]
+    {
+        a = 0x02d0;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 128a: call 16ed
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x128d);
+    }
+    AOT_GOTO(0x16ed, L16ed);
+L128d:
+    AOT_BLOCK(0x128d, 3);
+    // 128d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 128e: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1290: je 12b8
+    if (ZF)
+        AOT_GOTO(0x12b8, L12b8);
+    AOT_GOTO(0x1292, L1292);
+L1292:
+    AOT_BLOCK(0x1292, 3);
+    // 1292: mov ax, 0400
+    {
+        r[0] = 0x0400;
+    }
+    // 1295: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1296: call 0ef5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1299);
+    }
+    AOT_GOTO(0x0ef5, L0ef5);
+L1299:
+    AOT_BLOCK(0x1299, 4);
+    // 1299: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 129a: mov [si+8], ax
+    {
+        a = uint16_t(r[6] + 8);
+        WR16(a, r[0]);
+    }
+    // 129d: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 129f: jne 12a8
+    if (!ZF)
+        AOT_GOTO(0x12a8, L12a8);
+    AOT_GOTO(0x12a1, L12a1);
+L12a1:
+    AOT_BLOCK(0x12a1, 2);
+    // 12a1: or [si+4], 0004
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 4;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12a6: jmp short 12e8
+    AOT_GOTO(0x12e8, L12e8);
+L12a8:
+    AOT_BLOCK(0x12a8, 4);
+    // 12a8: or [si+4], 0048
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 72;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12ad: mov [si+6], 0400
+    {
+        a = uint16_t(r[6] + 6);
+        WR16(a, 0x0400);
+    }
+    // 12b2: mov [si], ffff
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0xffff);
+    }
+    // 12b6: jmp short 12e8
+    AOT_GOTO(0x12e8, L12e8);
+L12b8:
+    AOT_BLOCK(0x12b8, 3);
+    // 12b8: mov ax, 0400
+    {
+        r[0] = 0x0400;
+    }
+    // 12bb: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 12bc: call 0ef5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x12bf);
+    }
+    AOT_GOTO(0x0ef5, L0ef5);
+L12bf:
+    AOT_BLOCK(0x12bf, 4);
+    // 12bf: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 12c0: mov [si+8], ax
+    {
+        a = uint16_t(r[6] + 8);
+        WR16(a, r[0]);
+    }
+    // 12c3: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12c5: jne 12ce
+    if (!ZF)
+        AOT_GOTO(0x12ce, L12ce);
+    AOT_GOTO(0x12c7, L12c7);
+L12c7:
+    AOT_BLOCK(0x12c7, 2);
+    // 12c7: or [si+4], 0004
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 4;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12cc: jmp short 12e8
+    AOT_GOTO(0x12e8, L12e8);
+L12ce:
+    AOT_BLOCK(0x12ce, 4);
+    // 12ce: or [si+4], 0008
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 8;
+        WR16(a, val);
+    }
+    // 12d3: mov [si+6], 0400
+    {
+        a = uint16_t(r[6] + 6);
+        WR16(a, 0x0400);
+    }
+    // 12d8: test byte [si+4], 40
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 64;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12dc: jne 12e4
+    if (!ZF)
+        AOT_GOTO(0x12e4, L12e4);
+    AOT_GOTO(0x12de, L12de);
+L12de:
+    AOT_BLOCK(0x12de, 2);
+    // 12de: mov [si], 03ff
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0x03ff);
+    }
+    // 12e2: jmp short 12e8
+    AOT_GOTO(0x12e8, L12e8);
+L12e4:
+    AOT_BLOCK(0x12e4, 1);
+    // 12e4: mov [si], ffff
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0xffff);
+    }
+    AOT_GOTO(0x12e8, L12e8);
+L12e8:
+    AOT_BLOCK(0x12e8, 2);
+    // 12e8: mov dx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[2] = RD16(a);
+    }
+    // 12eb: mov [si+a], dx
+    {
+        a = uint16_t(r[6] + 10);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x12ee, L12ee);
+L12ee:
+    AOT_BLOCK(0x12ee, 2);
+    // 12ee: test byte [si+4], 4
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 4;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12f2: je 134f
+    if (ZF)
+        AOT_GOTO(0x134f, L134f);
+    AOT_GOTO(0x12f4, L12f4);
+L12f4:
+    AOT_BLOCK(0x12f4, 5);
+    // 12f4: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 12f6: mov [bp-1], dl
+    {
+        a = uint16_t(r[5] - 1);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 12f9: mov [si], 0000
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0x0000);
+    }
+    // 12fd: test [si+4], 0200
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1302: je 1327
+    if (ZF)
+        AOT_GOTO(0x1327, L1327);
+    AOT_GOTO(0x1304, L1304);
+L1304:
+    AOT_BLOCK(0x1304, 7);
+    // 1304: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1306: mov bx, 0002
+    {
+        r[3] = 0x0002;
+    }
+    // 1309: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 130a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 130b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 130c: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 130f: call 170b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1312);
+    }
+    AOT_GOTO(0x170b, L170b);
+L1312:
+    AOT_BLOCK(0x1312, 4);
+    // 1312: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 1315: and dx, ax
+    {
+        val = int16_t(r[2]) & int16_t(r[0]);
+        r[2] = val;
+    }
+    // 1317: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 131a: jne 1327
+    if (!ZF)
+        AOT_GOTO(0x1327, L1327);
+    AOT_GOTO(0x131c, L131c);
+L131c:
+    AOT_BLOCK(0x131c, 3);
+    // 131c: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1321: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1324: jmp 1445
+    AOT_GOTO(0x1445, L1445);
+L1327:
+    AOT_BLOCK(0x1327, 6);
+    // 1327: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 132a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 132b: lea ax, [bp-1]
+    {
+        a = uint16_t(r[5] - 1);
+        r[0] = a;
+    }
+    // 132e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 132f: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1332: call 1819
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1335);
+    }
+    AOT_GOTO(0x1819, L1819);
+L1335:
+    AOT_BLOCK(0x1335, 3);
+    // 1335: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 1338: cmp ax, 0001
+    {
+        val = (dst = int16_t(r[0])) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 133b: je 1348
+    if (ZF)
+        AOT_GOTO(0x1348, L1348);
+    AOT_GOTO(0x133d, L133d);
+L133d:
+    AOT_BLOCK(0x133d, 3);
+    // 133d: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1342: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1345: jmp 1445
+    AOT_GOTO(0x1445, L1445);
+L1348:
+    AOT_BLOCK(0x1348, 3);
+    // 1348: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 134a: xor ah, ah
+    {
+        val = int8_t(r[0] >> 8) ^ int8_t(r[0] >> 8);
+        r[0] = (r[0] & 0xff) | uint8_t(val) << 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 134c: jmp 1445
+    AOT_GOTO(0x1445, L1445);
+L134f:
+    AOT_BLOCK(0x134f, 2);
+    // 134f: test byte [si+4], 40
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 64;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1353: jne 1358
+    if (!ZF)
+        AOT_GOTO(0x1358, L1358);
+    AOT_GOTO(0x1355, L1355);
+L1355:
+    AOT_BLOCK(0x1355, 1);
+    // 1355: jmp 13cf
+    AOT_GOTO(0x13cf, L13cf);
+L1358:
+    AOT_BLOCK(0x1358, 6);
+    // 1358: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 135a: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 135d: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1360: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1362: cmp di, a
+    {
+        val = (dst = int16_t(r[7])) - (src = 10);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1365: je 1373
+    if (ZF)
+        AOT_GOTO(0x1373, L1373);
+    AOT_GOTO(0x1367, L1367);
+L1367:
+    AOT_BLOCK(0x1367, 4);
+    // 1367: mov dx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        r[2] = RD16(a);
+    }
+    // 136a: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+    }
+    // 136c: cmp [si], dx
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 136e: je 1373
+    if (ZF)
+        AOT_GOTO(0x1373, L1373);
+    AOT_GOTO(0x1370, L1370);
+L1370:
+    AOT_BLOCK(0x1370, 1);
+    // 1370: jmp 1441
+    AOT_GOTO(0x1441, L1441);
+L1373:
+    AOT_BLOCK(0x1373, 8);
+    // 1373: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1375: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+        AF = (src & 15) != 0;
+    }
+    // 1377: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 137a: mov dx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[2] = RD16(a);
+    }
+    // 137d: mov [si+a], dx
+    {
+        a = uint16_t(r[6] + 10);
+        WR16(a, r[2]);
+    }
+    // 1380: mov [si], 0000
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0x0000);
+    }
+    // 1384: test [si+4], 0200
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1389: je 13ae
+    if (ZF)
+        AOT_GOTO(0x13ae, L13ae);
+    AOT_GOTO(0x138b, L138b);
+L138b:
+    AOT_BLOCK(0x138b, 7);
+    // 138b: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 138d: mov bx, 0002
+    {
+        r[3] = 0x0002;
+    }
+    // 1390: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 1391: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1392: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1393: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1396: call 170b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1399);
+    }
+    AOT_GOTO(0x170b, L170b);
+L1399:
+    AOT_BLOCK(0x1399, 4);
+    // 1399: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 139c: and dx, ax
+    {
+        val = int16_t(r[2]) & int16_t(r[0]);
+        r[2] = val;
+    }
+    // 139e: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 13a1: jne 13ae
+    if (!ZF)
+        AOT_GOTO(0x13ae, L13ae);
+    AOT_GOTO(0x13a3, L13a3);
+L13a3:
+    AOT_BLOCK(0x13a3, 3);
+    // 13a3: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 13a8: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 13ab: jmp 1445
+    AOT_GOTO(0x1445, L1445);
+L13ae:
+    AOT_BLOCK(0x13ae, 4);
+    // 13ae: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 13b1: push [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 13b4: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 13b7: call 11ed
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x13ba);
+    }
+    AOT_GOTO(0x11ed, L11ed);
+L13ba:
+    AOT_BLOCK(0x13ba, 3);
+    // 13ba: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 13bd: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 13bf: je 13c4
+    if (ZF)
+        AOT_GOTO(0x13c4, L13c4);
+    AOT_GOTO(0x13c1, L13c1);
+L13c1:
+    AOT_BLOCK(0x13c1, 1);
+    // 13c1: jmp 1441
+    AOT_GOTO(0x1441, L1441);
+L13c4:
+    AOT_BLOCK(0x13c4, 3);
+    // 13c4: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 13c9: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 13cc: jmp 1445
+    AOT_GOTO(0x1445, L1445);
+L13cf:
+    AOT_BLOCK(0x13cf, 11);
+    // 13cf: mov dx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[2] = RD16(a);
+    }
+    // 13d2: sub dx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 13d5: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 13d8: mov dx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        r[2] = RD16(a);
+    }
+    // 13db: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+    }
+    // 13dc: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 13de: mov bx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[3] = RD16(a);
+    }
+    // 13e1: add bx, 1
+    {
+        val = (dst = int16_t(r[3])) + (src = 1);
+        r[3] = val;
+    }
+    // 13e4: mov [si+a], bx
+    {
+        a = uint16_t(r[6] + 10);
+        WR16(a, r[3]);
+    }
+    // 13e7: cmp [bp-4], 0
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 13eb: jle 143a
+    if (ZF || SF != OF)
+        AOT_GOTO(0x143a, L143a);
+    AOT_GOTO(0x13ed, L13ed);
+L13ed:
+    AOT_BLOCK(0x13ed, 2);
+    // 13ed: test [si+4], 0200
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 13f2: je 1416
+    if (ZF)
+        AOT_GOTO(0x1416, L1416);
+    AOT_GOTO(0x13f4, L13f4);
+L13f4:
+    AOT_BLOCK(0x13f4, 7);
+    // 13f4: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 13f6: mov bx, 0002
+    {
+        r[3] = 0x0002;
+    }
+    // 13f9: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 13fa: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 13fb: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 13fc: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 13ff: call 170b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1402);
+    }
+    AOT_GOTO(0x170b, L170b);
+L1402:
+    AOT_BLOCK(0x1402, 4);
+    // 1402: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 1405: and dx, ax
+    {
+        val = int16_t(r[2]) & int16_t(r[0]);
+        r[2] = val;
+    }
+    // 1407: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 140a: jne 1416
+    if (!ZF)
+        AOT_GOTO(0x1416, L1416);
+    AOT_GOTO(0x140c, L140c);
+L140c:
+    AOT_BLOCK(0x140c, 3);
+    // 140c: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1411: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1414: jmp short 1445
+    AOT_GOTO(0x1445, L1445);
+L1416:
+    AOT_BLOCK(0x1416, 4);
+    // 1416: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1419: push [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 141c: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 141f: call 11ed
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1422);
+    }
+    AOT_GOTO(0x11ed, L11ed);
+L1422:
+    AOT_BLOCK(0x1422, 3);
+    // 1422: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 1425: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1427: jne 143a
+    if (!ZF)
+        AOT_GOTO(0x143a, L143a);
+    AOT_GOTO(0x1429, L1429);
+L1429:
+    AOT_BLOCK(0x1429, 6);
+    // 1429: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 142b: mov bx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[3] = RD16(a);
+    }
+    // 142e: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1430: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1435: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1438: jmp short 1445
+    AOT_GOTO(0x1445, L1445);
+L143a:
+    AOT_BLOCK(0x143a, 3);
+    // 143a: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 143c: mov bx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[3] = RD16(a);
+    }
+    // 143f: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    AOT_GOTO(0x1441, L1441);
+L1441:
+    AOT_BLOCK(0x1441, 2);
+    // 1441: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 1443: xor ah, ah
+    {
+        val = int8_t(r[0] >> 8) ^ int8_t(r[0] >> 8);
+        r[0] = (r[0] & 0xff) | uint8_t(val) << 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1445, L1445);
+L1445:
+    AOT_BLOCK(0x1445, 1);
+    // 1445: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L1448:
+    AOT_BLOCK(0x1448, 9);
+    // 1448: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1449: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 144b: sub sp, a
+    {
+        val = (dst = int16_t(r[4])) - (src = 10);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 144e: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 144f: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1450: mov [bp-4], 0000
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, 0x0000);
+    }
+    // 1455: mov [bp-6], 0000
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, 0x0000);
+    }
+    // 145a: xor di, di
+    {
+        val = int16_t(r[7]) ^ int16_t(r[7]);
+        r[7] = val;
+    }
+    // 145c: xor si, si
+    {
+        val = int16_t(r[6]) ^ int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x145e, L145e);
+L145e:
+    AOT_BLOCK(0x145e, 4);
+    // 145e: mov bx, si
+    {
+        r[3] = r[6];
+    }
+    // 1460: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 1462: cmp [bx+2e6], 0
+    {
+        a = uint16_t(r[3] + 742);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1467: je 14a6
+    if (ZF)
+        AOT_GOTO(0x14a6, L14a6);
+    AOT_GOTO(0x1469, L1469);
+L1469:
+    AOT_BLOCK(0x1469, 2);
+    // 1469: cmp si, 13
+    {
+        val = (dst = int16_t(r[6])) - (src = 19);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 146c: jl 1473
+    if (SF != OF)
+        AOT_GOTO(0x1473, L1473);
+    AOT_GOTO(0x146e, L146e);
+L146e:
+    AOT_BLOCK(0x146e, 2);
+    // 146e: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1470: jmp 1584
+    AOT_GOTO(0x1584, L1584);
+L1473:
+    AOT_BLOCK(0x1473, 2);
+    // 1473: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1474: jmp short 145e
+    AOT_GOTO(0x145e, L145e);
+L1476:
+    AOT_BLOCK(0x1476, 3);
+    // 1476: or di, 0081
+    {
+        val = int16_t(r[7]) | 129;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 147a: mov [bp-4], 0000
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, 0x0000);
+    }
+    // 147f: jmp short 14b5
+    AOT_GOTO(0x14b5, L14b5);
+L1481:
+    AOT_BLOCK(0x1481, 4);
+    // 1481: or di, 0102
+    {
+        val = int16_t(r[7]) | 258;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1485: mov [bp-4], 0001
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, 0x0001);
+    }
+    // 148a: mov [bp-6], 0030
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, 0x0030);
+    }
+    // 148f: jmp short 14b5
+    AOT_GOTO(0x14b5, L14b5);
+L1491:
+    AOT_BLOCK(0x1491, 4);
+    // 1491: or di, 0302
+    {
+        val = int16_t(r[7]) | 770;
+        r[7] = val;
+    }
+    // 1495: mov [bp-4], 0001
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, 0x0001);
+    }
+    // 149a: or [bp-6], 0050
+    {
+        a = uint16_t(r[5] - 6);
+        val = int16_t(RD16(a)) | 80;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 149f: jmp short 14b5
+    AOT_GOTO(0x14b5, L14b5);
+L14a1:
+    AOT_BLOCK(0x14a1, 2);
+    // 14a1: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 14a3: jmp 1584
+    AOT_GOTO(0x1584, L1584);
+L14a6:
+    AOT_BLOCK(0x14a6, 6);
+    // 14a6: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 14a9: inc [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 14ac: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 14ae: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 14af: mov bx, 030e
+    {
+        r[3] = 0x030e;
+    }
+    // 14b2: jmp 22a8
+    AOT_GOTO(0x22a8, L22a8);
+L14b5:
+    AOT_BLOCK(0x14b5, 3);
+    // 14b5: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 14b8: cmp byte [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 14bb: je 14d9
+    if (ZF)
+        AOT_GOTO(0x14d9, L14d9);
+    AOT_GOTO(0x14bd, L14bd);
+L14bd:
+    AOT_BLOCK(0x14bd, 1);
+    // 14bd: jmp short 14ca
+    AOT_GOTO(0x14ca, L14ca);
+L14bf:
+    AOT_BLOCK(0x14bf, 3);
+    // 14bf: mov [bp-4], 0002
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, 0x0002);
+    }
+    // 14c4: or di, 0003
+    {
+        val = int16_t(r[7]) | 3;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 14c8: jmp short 14b5
+    AOT_GOTO(0x14b5, L14b5);
+L14ca:
+    AOT_BLOCK(0x14ca, 6);
+    // 14ca: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 14cd: inc [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 14d0: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 14d2: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 14d3: mov bx, 031e
+    {
+        r[3] = 0x031e;
+    }
+    // 14d6: jmp 22a8
+    AOT_GOTO(0x22a8, L22a8);
+L14d9:
+    AOT_BLOCK(0x14d9, 2);
+    // 14d9: test byte [bp-6], 20
+    {
+        a = uint16_t(r[5] - 6);
+        val = int8_t(RD8(a)) & 32;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 14dd: jne 14f7
+    if (!ZF)
+        AOT_GOTO(0x14f7, L14f7);
+    AOT_GOTO(0x14df, L14df);
+L14df:
+    AOT_BLOCK(0x14df, 3);
+    // 14df: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 14e2: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 14e5: call 1754
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x14e8);
+    }
+    AOT_GOTO(0x1754, L1754);
+L14e8:
+    AOT_BLOCK(0x14e8, 5);
+    // 14e8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 14e9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 14ea: mov [bp-a], ax
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, r[0]);
+    }
+    // 14ed: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 14ef: jnl 1526
+    if (SF == OF)
+        AOT_GOTO(0x1526, L1526);
+    AOT_GOTO(0x14f1, L14f1);
+L14f1:
+    AOT_BLOCK(0x14f1, 2);
+    // 14f1: test byte [bp-6], 10
+    {
+        a = uint16_t(r[5] - 6);
+        val = int8_t(RD8(a)) & 16;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 14f5: je 1526
+    if (ZF)
+        AOT_GOTO(0x1526, L1526);
+    AOT_GOTO(0x14f7, L14f7);
+L14f7:
+    AOT_BLOCK(0x14f7, 4);
+    // 14f7: mov ax, 01b6
+    {
+        r[0] = 0x01b6;
+    }
+    // 14fa: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 14fb: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 14fe: call 16c0
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1501);
+    }
+    AOT_GOTO(0x16c0, L16c0);
+L1501:
+    AOT_BLOCK(0x1501, 5);
+    // 1501: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1502: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1503: mov [bp-a], ax
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, r[0]);
+    }
+    // 1506: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1508: jle 1526
+    if (ZF || SF != OF)
+        AOT_GOTO(0x1526, L1526);
+    AOT_GOTO(0x150a, L150a);
+L150a:
+    AOT_BLOCK(0x150a, 3);
+    // 150a: mov dx, 0001
+    {
+        r[2] = 0x0001;
+    }
+    // 150d: or dx, di
+    {
+        val = int16_t(r[2]) | int16_t(r[7]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 150f: je 1526
+    if (ZF)
+        AOT_GOTO(0x1526, L1526);
+    AOT_GOTO(0x1511, L1511);
+L1511:
+    AOT_BLOCK(0x1511, 2);
+    // 1511: push [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1514: call 169f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1517);
+    }
+    AOT_GOTO(0x169f, L169f);
+L1517:
+    AOT_BLOCK(0x1517, 4);
+    // 1517: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1518: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 151b: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 151e: call 1754
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1521);
+    }
+    AOT_GOTO(0x1754, L1754);
+L1521:
+    AOT_BLOCK(0x1521, 3);
+    // 1521: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1522: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1523: mov [bp-a], ax
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, r[0]);
+    }
+    AOT_GOTO(0x1526, L1526);
+L1526:
+    AOT_BLOCK(0x1526, 2);
+    // 1526: cmp [bp-a], 0
+    {
+        a = uint16_t(r[5] - 10);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 152a: jnl 1530
+    if (SF == OF)
+        AOT_GOTO(0x1530, L1530);
+    AOT_GOTO(0x152c, L152c);
+L152c:
+    AOT_BLOCK(0x152c, 2);
+    // 152c: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 152e: jmp short 1584
+    AOT_GOTO(0x1584, L1584);
+L1530:
+    AOT_BLOCK(0x1530, 3);
+    // 1530: mov ax, 000c
+    {
+        r[0] = 0x000c;
+    }
+    // 1533: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1534: call 0ef5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1537);
+    }
+    AOT_GOTO(0x0ef5, L0ef5);
+L1537:
+    AOT_BLOCK(0x1537, 4);
+    // 1537: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1538: mov [bp-8], ax
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[0]);
+    }
+    // 153b: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 153d: jne 154a
+    if (!ZF)
+        AOT_GOTO(0x154a, L154a);
+    AOT_GOTO(0x153f, L153f);
+L153f:
+    AOT_BLOCK(0x153f, 2);
+    // 153f: push [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1542: call 169f
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1545);
+    }
+    AOT_GOTO(0x169f, L169f);
+L1545:
+    AOT_BLOCK(0x1545, 3);
+    // 1545: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1546: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1548: jmp short 1584
+    AOT_GOTO(0x1584, L1584);
+L154a:
+    AOT_BLOCK(0x154a, 4);
+    // 154a: mov dx, 0003
+    {
+        r[2] = 0x0003;
+    }
+    // 154d: and dx, di
+    {
+        val = int16_t(r[2]) & int16_t(r[7]);
+        r[2] = val;
+    }
+    // 154f: cmp dx, 3
+    {
+        val = (dst = int16_t(r[2])) - (src = 3);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1552: jne 1558
+    if (!ZF)
+        AOT_GOTO(0x1558, L1558);
+    AOT_GOTO(0x1554, L1554);
+L1554:
+    AOT_BLOCK(0x1554, 1);
+    // 1554: and di, fe7f
+    {
+        val = int16_t(r[7]) & -385;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1558, L1558);
+L1558:
+    AOT_BLOCK(0x1558, 14);
+    // 1558: mov bx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[3] = RD16(a);
+    }
+    // 155b: mov [bx], 0000
+    {
+        a = uint16_t(r[3]);
+        WR16(a, 0x0000);
+    }
+    // 155f: mov bx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[3] = RD16(a);
+    }
+    // 1562: mov dx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[2] = RD16(a);
+    }
+    // 1565: mov [bx+2], dx
+    {
+        a = uint16_t(r[3] + 2);
+        WR16(a, r[2]);
+    }
+    // 1568: mov bx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[3] = RD16(a);
+    }
+    // 156b: mov [bx+4], di
+    {
+        a = uint16_t(r[3] + 4);
+        WR16(a, r[7]);
+    }
+    // 156e: mov bx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[3] = RD16(a);
+    }
+    // 1571: mov [bx+8], 0000
+    {
+        a = uint16_t(r[3] + 8);
+        WR16(a, 0x0000);
+    }
+    // 1576: mov bx, si
+    {
+        r[3] = r[6];
+    }
+    // 1578: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 157a: mov dx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[2] = RD16(a);
+    }
+    // 157d: mov [bx+2e6], dx
+    {
+        a = uint16_t(r[3] + 742);
+        WR16(a, r[2]);
+    }
+    // 1581: mov ax, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x1584, L1584);
+L1584:
+    AOT_BLOCK(0x1584, 1);
+    // 1584: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L1587:
+    AOT_BLOCK(0x1587, 10);
+    // 1587: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1588: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 158a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 158b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 158c: lea bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = a;
+    }
+    // 158f: mov [bp-2], bx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[3]);
+    }
+    // 1592: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1595: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1598: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 159b: call 1a26
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x159e);
+    }
+    AOT_GOTO(0x1a26, L1a26);
+L159e:
+    AOT_BLOCK(0x159e, 2);
+    // 159e: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 15a1: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L15a4:
+    AOT_BLOCK(0x15a4, 10);
+    // 15a4: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 15a5: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 15a7: sub sp, 6
+    {
+        val = (dst = int16_t(r[4])) - (src = 6);
+        r[4] = val;
+    }
+    // 15aa: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 15ab: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 15ac: mov di, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[7] = RD16(a);
+    }
+    // 15af: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 15b2: mov [bp-6], 0000
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, 0x0000);
+    }
+    // 15b7: cmp [bp+6], 0
+    {
+        a = uint16_t(r[5] + 6);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 15bb: je 1603
+    if (ZF)
+        AOT_GOTO(0x1603, L1603);
+    AOT_GOTO(0x15bd, L15bd);
+L15bd:
+    AOT_BLOCK(0x15bd, 3);
+    // 15bd: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 15c0: cmp [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 15c3: jnb 1603
+    if (!CF)
+        AOT_GOTO(0x1603, L1603);
+    AOT_GOTO(0x15c5, L15c5);
+L15c5:
+    AOT_BLOCK(0x15c5, 2);
+    // 15c5: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 15c8: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x15cb, L15cb);
+L15cb:
+    AOT_BLOCK(0x15cb, 4);
+    // 15cb: mov dx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[2] = RD16(a);
+    }
+    // 15cd: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 15ce: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    // 15d0: jl 15e1
+    if (SF != OF)
+        AOT_GOTO(0x15e1, L15e1);
+    AOT_GOTO(0x15d2, L15d2);
+L15d2:
+    AOT_BLOCK(0x15d2, 7);
+    // 15d2: mov dl, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 15d4: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 15d6: mov bx, [di+a]
+    {
+        a = uint16_t(r[7] + 10);
+        r[3] = RD16(a);
+    }
+    // 15d9: inc [di+a]
+    {
+        a = uint16_t(r[7] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 15dc: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 15de: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 15df: jmp short 15ed
+    AOT_GOTO(0x15ed, L15ed);
+L15e1:
+    AOT_BLOCK(0x15e1, 5);
+    // 15e1: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 15e2: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 15e4: mov al, [si]
+    {
+        a = uint16_t(r[6]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 15e6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 15e7: call 1226
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x15ea);
+    }
+    AOT_GOTO(0x1226, L1226);
+L15ea:
+    AOT_BLOCK(0x15ea, 3);
+    // 15ea: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 15eb: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 15ec: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x15ed, L15ed);
+L15ed:
+    AOT_BLOCK(0x15ed, 3);
+    // 15ed: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 15ee: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 15f1: jne 15f8
+    if (!ZF)
+        AOT_GOTO(0x15f8, L15f8);
+    AOT_GOTO(0x15f3, L15f3);
+L15f3:
+    AOT_BLOCK(0x15f3, 2);
+    // 15f3: mov ax, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[0] = RD16(a);
+    }
+    // 15f6: jmp short 1606
+    AOT_GOTO(0x1606, L1606);
+L15f8:
+    AOT_BLOCK(0x15f8, 3);
+    // 15f8: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 15f9: dec [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 15fc: jne 15cb
+    if (!ZF)
+        AOT_GOTO(0x15cb, L15cb);
+    AOT_GOTO(0x15fe, L15fe);
+L15fe:
+    AOT_BLOCK(0x15fe, 2);
+    // 15fe: inc [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1601: jmp short 15bd
+    AOT_GOTO(0x15bd, L15bd);
+L1603:
+    AOT_BLOCK(0x1603, 1);
+    // 1603: mov ax, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x1606, L1606);
+L1606:
+    AOT_BLOCK(0x1606, 1);
+    // 1606: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L1609:
+    AOT_BLOCK(0x1609, 1);
+    // 1609: jmp 1652
+    AOT_GOTO(0x1652, L1652);
+L160d:
+    AOT_BLOCK(0x160d, 1);
+    // 160d: jmp 1672
+    AOT_GOTO(0x1672, L1672);
+L1615:
+    AOT_BLOCK(0x1615, 1);
+    // 1615: jmp 170b
+    AOT_GOTO(0x170b, L170b);
+L1619:
+    AOT_BLOCK(0x1619, 1);
+    // 1619: jmp 1754
+    AOT_GOTO(0x1754, L1754);
+L161d:
+    AOT_BLOCK(0x161d, 1);
+    // 161d: jmp 17af
+    AOT_GOTO(0x17af, L17af);
+L1621:
+    AOT_BLOCK(0x1621, 1);
+    // 1621: jmp 17f2
+    AOT_GOTO(0x17f2, L17f2);
+L162f:
+    AOT_BLOCK(0x162f, 2);
+    // 162f: mov cx, 0003
+    {
+        r[1] = 0x0003;
+    }
+    // 1632: jmp short 1634
+    AOT_GOTO(0x1634, L1634);
+L1634:
+    AOT_BLOCK(0x1634, 4);
+    // 1634: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1635: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1637: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 163a: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 163d: int 20
+    AOT_INTERP(0x163d);
+L163f:
+    AOT_BLOCK(0x163f, 2);
+    // 163f: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1640: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1640);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1652:
+    AOT_BLOCK(0x1652, 12);
+    // 1652: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1653: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1655: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 1658: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 165b: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 165e: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1661: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1662: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1665: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1666: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1668: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1669: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x166c);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L166c:
+    AOT_BLOCK(0x166c, 2);
+    // 166c: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 166f: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L1672:
+    AOT_BLOCK(0x1672, 9);
+    // 1672: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1673: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1675: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1678: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 167b: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 167e: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1681: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1682: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1685: call 21df
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1688);
+    }
+    AOT_GOTO(0x21df, L21df);
+L1688:
+    AOT_BLOCK(0x1688, 9);
+    // 1688: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1689: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 168a: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 168d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 168e: mov ax, 000f
+    {
+        r[0] = 0x000f;
+    }
+    // 1691: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1692: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1695: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1696: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1699);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L1699:
+    AOT_BLOCK(0x1699, 2);
+    // 1699: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 169c: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L169f:
+    AOT_BLOCK(0x169f, 12);
+    // 169f: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 16a0: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 16a2: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 16a5: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 16a8: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 16ab: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 16ae: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 16af: mov ax, 0006
+    {
+        r[0] = 0x0006;
+    }
+    // 16b2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 16b3: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 16b6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 16b7: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x16ba);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L16ba:
+    AOT_BLOCK(0x16ba, 2);
+    // 16ba: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 16bd: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L16c0:
+    AOT_BLOCK(0x16c0, 9);
+    // 16c0: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 16c1: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 16c3: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 16c6: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 16c9: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 16cc: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 16cf: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 16d0: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 16d3: call 21df
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x16d6);
+    }
+    AOT_GOTO(0x21df, L21df);
+L16d6:
+    AOT_BLOCK(0x16d6, 9);
+    // 16d6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 16d7: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 16d8: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 16db: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 16dc: mov ax, 0008
+    {
+        r[0] = 0x0008;
+    }
+    // 16df: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 16e0: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 16e3: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 16e4: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x16e7);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L16e7:
+    AOT_BLOCK(0x16e7, 2);
+    // 16e7: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 16ea: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L16ed:
+    AOT_BLOCK(0x16ed, 7);
+    // 16ed: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 16ee: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 16f0: sub sp, 20
+    {
+        val = (dst = int16_t(r[4])) - (src = 32);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 16f3: lea ax, [bp-20]
+    {
+        a = uint16_t(r[5] - 32);
+        r[0] = a;
+    }
+    // 16f6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 16f7: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 16fa: call 17dc
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x16fd);
+    }
+    AOT_GOTO(0x17dc, L17dc);
+L16fd:
+    AOT_BLOCK(0x16fd, 5);
+    // 16fd: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 16fe: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 16ff: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+    }
+    // 1701: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1703: jne 1706
+    if (!ZF)
+        AOT_GOTO(0x1706, L1706);
+    AOT_GOTO(0x1705, L1705);
+L1705:
+    AOT_BLOCK(0x1705, 1);
+    // 1705: inc bx
+    {
+        val = int16_t(r[3]) + 1;
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1706, L1706);
+L1706:
+    AOT_BLOCK(0x1706, 2);
+    // 1706: mov ax, bx
+    {
+        r[0] = r[3];
+    }
+    // 1708: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L170b:
+    AOT_BLOCK(0x170b, 18);
+    // 170b: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 170c: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 170e: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1711: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1714: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 1717: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 171a: mov cx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[1] = RD16(a);
+    }
+    // 171d: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 1720: mov [bp-c], cx
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, r[1]);
+    }
+    // 1723: mov dx, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[2] = RD16(a);
+    }
+    // 1726: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 1729: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 172c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 172d: mov ax, 0013
+    {
+        r[0] = 0x0013;
+    }
+    // 1730: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1731: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1734: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1735: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1738);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L1738:
+    AOT_BLOCK(0x1738, 3);
+    // 1738: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 173b: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 173d: jnl 1749
+    if (SF == OF)
+        AOT_GOTO(0x1749, L1749);
+    AOT_GOTO(0x173f, L173f);
+L173f:
+    AOT_BLOCK(0x173f, 5);
+    // 173f: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1742: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1743: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1746: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1747: jmp short 174f
+    AOT_GOTO(0x174f, L174f);
+L1749:
+    AOT_BLOCK(0x1749, 2);
+    // 1749: push [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 174c: push [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x174f, L174f);
+L174f:
+    AOT_BLOCK(0x174f, 3);
+    // 174f: pop ax
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[0] = val;
+    }
+    // 1750: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1751: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L1754:
+    AOT_BLOCK(0x1754, 7);
+    // 1754: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1755: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1757: sub sp, 1a
+    {
+        val = (dst = int16_t(r[4])) - (src = 26);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 175a: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 175b: lea si, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[6] = a;
+    }
+    // 175e: test byte [bp+6], 40
+    {
+        a = uint16_t(r[5] + 6);
+        val = int8_t(RD8(a)) & 64;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1762: je 1788
+    if (ZF)
+        AOT_GOTO(0x1788, L1788);
+    AOT_GOTO(0x1764, L1764);
+L1764:
+    AOT_BLOCK(0x1764, 2);
+    // 1764: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1767: call 21a2
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x176a);
+    }
+    AOT_GOTO(0x21a2, L21a2);
+L176a:
+    AOT_BLOCK(0x176a, 12);
+    // 176a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 176b: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 176c: mov [bp-16], ax
+    {
+        a = uint16_t(r[5] - 22);
+        WR16(a, r[0]);
+    }
+    // 176f: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 1772: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 1775: lea bx, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[3] = a;
+    }
+    // 1778: mov si, bx
+    {
+        r[6] = r[3];
+    }
+    // 177a: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 177d: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 1780: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1783: mov [bp-10], dx
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, r[2]);
+    }
+    // 1786: jmp short 179a
+    AOT_GOTO(0x179a, L179a);
+L1788:
+    AOT_BLOCK(0x1788, 4);
+    // 1788: lea ax, [bp-1a]
+    {
+        a = uint16_t(r[5] - 26);
+        r[0] = a;
+    }
+    // 178b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 178c: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 178f: call 21df
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1792);
+    }
+    AOT_GOTO(0x21df, L21df);
+L1792:
+    AOT_BLOCK(0x1792, 4);
+    // 1792: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1793: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1794: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 1797: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x179a, L179a);
+L179a:
+    AOT_BLOCK(0x179a, 7);
+    // 179a: lea ax, [bp-1a]
+    {
+        a = uint16_t(r[5] - 26);
+        r[0] = a;
+    }
+    // 179d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 179e: mov ax, 0005
+    {
+        r[0] = 0x0005;
+    }
+    // 17a1: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17a2: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 17a5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17a6: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x17a9);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L17a9:
+    AOT_BLOCK(0x17a9, 2);
+    // 17a9: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 17ac: jmp 233e
+    AOT_GOTO(0x233e, L233e);
+L17af:
+    AOT_BLOCK(0x17af, 16);
+    // 17af: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 17b0: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 17b2: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 17b5: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 17b8: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 17bb: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 17be: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 17c1: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 17c4: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 17c7: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 17ca: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17cb: mov ax, 0003
+    {
+        r[0] = 0x0003;
+    }
+    // 17ce: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17cf: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 17d2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17d3: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x17d6);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L17d6:
+    AOT_BLOCK(0x17d6, 2);
+    // 17d6: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 17d9: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L17dc:
+    AOT_BLOCK(0x17dc, 7);
+    // 17dc: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 17dd: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 17df: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 17e2: mov ax, 5408
+    {
+        r[0] = 0x5408;
+    }
+    // 17e5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17e6: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 17e9: call 2213
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x17ec);
+    }
+    AOT_GOTO(0x2213, L2213);
+L17ec:
+    AOT_BLOCK(0x17ec, 2);
+    // 17ec: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 17ef: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L17f2:
+    AOT_BLOCK(0x17f2, 7);
+    // 17f2: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 17f3: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 17f5: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 17f8: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 17fb: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17fc: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 17ff: call 21df
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1802);
+    }
+    AOT_GOTO(0x21df, L21df);
+L1802:
+    AOT_BLOCK(0x1802, 9);
+    // 1802: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1803: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1804: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1807: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1808: mov ax, 000a
+    {
+        r[0] = 0x000a;
+    }
+    // 180b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 180c: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 180f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1810: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1813);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L1813:
+    AOT_BLOCK(0x1813, 2);
+    // 1813: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1816: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L1819:
+    AOT_BLOCK(0x1819, 16);
+    // 1819: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 181a: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 181c: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 181f: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1822: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 1825: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 1828: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 182b: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 182e: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 1831: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1834: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1835: mov ax, 0004
+    {
+        r[0] = 0x0004;
+    }
+    // 1838: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1839: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 183c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 183d: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1840);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L1840:
+    AOT_BLOCK(0x1840, 2);
+    // 1840: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1843: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L1846:
+    AOT_BLOCK(0x1846, 9);
+    // 1846: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1847: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1849: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 184a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 184b: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 184c: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 184d: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 1850: cmp byte [si], 2a
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 42);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1853: jne 1870
+    if (!ZF)
+        AOT_GOTO(0x1870, L1870);
+    AOT_GOTO(0x1855, L1855);
+L1855:
+    AOT_BLOCK(0x1855, 12);
+    // 1855: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 1858: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 185a: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 185c: add cx, 2
+    {
+        val = (dst = int16_t(r[1])) + (src = 2);
+        r[1] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 185f: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 1862: mov [bx], cx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[1]);
+    }
+    // 1864: mov bx, dx
+    {
+        r[3] = r[2];
+    }
+    // 1866: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 1868: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 186b: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 186d: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 186e: jmp short 1895
+    AOT_GOTO(0x1895, L1895);
+L1870:
+    AOT_BLOCK(0x1870, 1);
+    // 1870: xor di, di
+    {
+        val = int16_t(r[7]) ^ int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1872, L1872);
+L1872:
+    AOT_BLOCK(0x1872, 5);
+    // 1872: mov al, [si]
+    {
+        a = uint16_t(r[6]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1874: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1875: sub ax, 0030
+    {
+        val = (dst = int16_t(r[0])) - (src = 48);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1878: mov [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[0]);
+    }
+    // 187b: jl 1890
+    if (SF != OF)
+        AOT_GOTO(0x1890, L1890);
+    AOT_GOTO(0x187d, L187d);
+L187d:
+    AOT_BLOCK(0x187d, 2);
+    // 187d: cmp [bp-4], 9
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 9);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1881: jnle 1890
+    if (!(ZF || SF != OF))
+        AOT_GOTO(0x1890, L1890);
+    AOT_GOTO(0x1883, L1883);
+L1883:
+    AOT_BLOCK(0x1883, 6);
+    // 1883: mov ax, 000a
+    {
+        r[0] = 0x000a;
+    }
+    // 1886: mul di
+    {
+        u32 = uint32_t(r[0]) * r[7];
+        r[2] = u32 >> 16;
+        r[0] = u32;
+    }
+    // 1888: add ax, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(r[0])) + (src = int16_t(RD16(a)));
+        r[0] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 188b: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 188d: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 188e: jmp short 1872
+    AOT_GOTO(0x1872, L1872);
+L1890:
+    AOT_BLOCK(0x1890, 2);
+    // 1890: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1893: mov [bx], di
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[7]);
+    }
+    AOT_GOTO(0x1895, L1895);
+L1895:
+    AOT_BLOCK(0x1895, 2);
+    // 1895: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 1897: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L189a:
+    AOT_BLOCK(0x189a, 9);
+    // 189a: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 189b: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 189d: sub sp, c
+    {
+        val = (dst = int16_t(r[4])) - (src = 12);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 18a0: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 18a1: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 18a2: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 18a5: mov si, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[6] = RD16(a);
+    }
+    // 18a8: mov [bp-a], si
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, r[6]);
+    }
+    // 18ab: jmp 1928
+    AOT_GOTO(0x1928, L1928);
+L18ae:
+    AOT_BLOCK(0x18ae, 2);
+    // 18ae: cmp [bp+e], 0
+    {
+        a = uint16_t(r[5] + 14);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 18b2: je 18c4
+    if (ZF)
+        AOT_GOTO(0x18c4, L18c4);
+    AOT_GOTO(0x18b4, L18b4);
+L18b4:
+    AOT_BLOCK(0x18b4, 7);
+    // 18b4: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 18b6: add [di], 2
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 18b9: mov ax, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = RD16(a);
+    }
+    // 18bb: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 18bc: mov [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[0]);
+    }
+    // 18bf: mov [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[2]);
+    }
+    // 18c2: jmp short 1936
+    AOT_GOTO(0x1936, L1936);
+L18c4:
+    AOT_BLOCK(0x18c4, 6);
+    // 18c4: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 18c6: add [di], 2
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 18c9: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 18cb: mov [bp-8], dx
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[2]);
+    }
+    // 18ce: mov [bp-6], 0000
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, 0x0000);
+    }
+    // 18d3: jmp short 1936
+    AOT_GOTO(0x1936, L1936);
+L18d5:
+    AOT_BLOCK(0x18d5, 2);
+    // 18d5: cmp [bp+e], 0
+    {
+        a = uint16_t(r[5] + 14);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 18d9: je 18ee
+    if (ZF)
+        AOT_GOTO(0x18ee, L18ee);
+    AOT_GOTO(0x18db, L18db);
+L18db:
+    AOT_BLOCK(0x18db, 7);
+    // 18db: add [di], 4
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 4);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 18de: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 18e0: mov dx, [bx-4]
+    {
+        a = uint16_t(r[3] - 4);
+        r[2] = RD16(a);
+    }
+    // 18e3: mov cx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[1] = RD16(a);
+    }
+    // 18e6: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 18e9: mov [bp-2], cx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[1]);
+    }
+    // 18ec: jmp short 1936
+    AOT_GOTO(0x1936, L1936);
+L18ee:
+    AOT_BLOCK(0x18ee, 7);
+    // 18ee: add [di], 4
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 4);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 18f1: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 18f3: mov dx, [bx-4]
+    {
+        a = uint16_t(r[3] - 4);
+        r[2] = RD16(a);
+    }
+    // 18f6: mov cx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[1] = RD16(a);
+    }
+    // 18f9: mov [bp-8], dx
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[2]);
+    }
+    // 18fc: mov [bp-6], cx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[1]);
+    }
+    // 18ff: jmp short 1936
+    AOT_GOTO(0x1936, L1936);
+L1901:
+    AOT_BLOCK(0x1901, 2);
+    // 1901: cmp [bp+e], 0
+    {
+        a = uint16_t(r[5] + 14);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1905: je 1917
+    if (ZF)
+        AOT_GOTO(0x1917, L1917);
+    AOT_GOTO(0x1907, L1907);
+L1907:
+    AOT_BLOCK(0x1907, 7);
+    // 1907: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 1909: add [di], 2
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 190c: mov ax, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = RD16(a);
+    }
+    // 190e: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 190f: mov [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[0]);
+    }
+    // 1912: mov [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[2]);
+    }
+    // 1915: jmp short 1936
+    AOT_GOTO(0x1936, L1936);
+L1917:
+    AOT_BLOCK(0x1917, 6);
+    // 1917: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 1919: add [di], 2
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 191c: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 191e: mov [bp-8], dx
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[2]);
+    }
+    // 1921: mov [bp-6], 0000
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, 0x0000);
+    }
+    // 1926: jmp short 1936
+    AOT_GOTO(0x1936, L1936);
+L1928:
+    AOT_BLOCK(0x1928, 5);
+    // 1928: mov dx, 0060
+    {
+        r[2] = 0x0060;
+    }
+    // 192b: and dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(r[2]) & int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 192e: mov bx, 032c
+    {
+        r[3] = 0x032c;
+    }
+    // 1931: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 1933: jmp 22a8
+    AOT_GOTO(0x22a8, L22a8);
+L1936:
+    AOT_BLOCK(0x1936, 2);
+    // 1936: cmp [bp+e], 0
+    {
+        a = uint16_t(r[5] + 14);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 193a: je 1974
+    if (ZF)
+        AOT_GOTO(0x1974, L1974);
+    AOT_GOTO(0x193c, L193c);
+L193c:
+    AOT_BLOCK(0x193c, 2);
+    // 193c: cmp [bp-2], 0
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1940: jnl 1952
+    if (SF == OF)
+        AOT_GOTO(0x1952, L1952);
+    AOT_GOTO(0x1942, L1942);
+L1942:
+    AOT_BLOCK(0x1942, 6);
+    // 1942: mov byte [si], 2d
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 45);
+    }
+    // 1945: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 1946: neg [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        src = int16_t(RD16(a));
+        val = -src;
+        WR16(a, val);
+    }
+    // 1949: neg [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        src = int16_t(RD16(a));
+        val = -src;
+        WR16(a, val);
+        CF = src != 0;
+    }
+    // 194c: sbb [bp-2], 0
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0) - CF;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) - CF < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src + CF) || (CF && !(src + 1));
+    }
+    // 1950: jmp short 1968
+    AOT_GOTO(0x1968, L1968);
+L1952:
+    AOT_BLOCK(0x1952, 2);
+    // 1952: test byte [bp+6], 2
+    {
+        a = uint16_t(r[5] + 6);
+        val = int8_t(RD8(a)) & 2;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1956: je 195e
+    if (ZF)
+        AOT_GOTO(0x195e, L195e);
+    AOT_GOTO(0x1958, L1958);
+L1958:
+    AOT_BLOCK(0x1958, 3);
+    // 1958: mov byte [si], 2b
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 43);
+    }
+    // 195b: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 195c: jmp short 1968
+    AOT_GOTO(0x1968, L1968);
+L195e:
+    AOT_BLOCK(0x195e, 2);
+    // 195e: test byte [bp+6], 4
+    {
+        a = uint16_t(r[5] + 6);
+        val = int8_t(RD8(a)) & 4;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1962: je 1968
+    if (ZF)
+        AOT_GOTO(0x1968, L1968);
+    AOT_GOTO(0x1964, L1964);
+L1964:
+    AOT_BLOCK(0x1964, 2);
+    // 1964: mov byte [si], 20
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 32);
+    }
+    // 1967: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1968, L1968);
+L1968:
+    AOT_BLOCK(0x1968, 4);
+    // 1968: mov dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[2] = RD16(a);
+    }
+    // 196b: mov cx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[1] = RD16(a);
+    }
+    // 196e: mov [bp-8], dx
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[2]);
+    }
+    // 1971: mov [bp-6], cx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[1]);
+    }
+    AOT_GOTO(0x1974, L1974);
+L1974:
+    AOT_BLOCK(0x1974, 2);
+    // 1974: test byte [bp+6], 8
+    {
+        a = uint16_t(r[5] + 6);
+        val = int8_t(RD8(a)) & 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1978: je 1984
+    if (ZF)
+        AOT_GOTO(0x1984, L1984);
+    AOT_GOTO(0x197a, L197a);
+L197a:
+    AOT_BLOCK(0x197a, 2);
+    // 197a: cmp byte [bp+a], 6f
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 111);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 197e: jne 1984
+    if (!ZF)
+        AOT_GOTO(0x1984, L1984);
+    AOT_GOTO(0x1980, L1980);
+L1980:
+    AOT_BLOCK(0x1980, 2);
+    // 1980: mov byte [si], 30
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 48);
+    }
+    // 1983: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1984, L1984);
+L1984:
+    AOT_BLOCK(0x1984, 3);
+    // 1984: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1987: or dx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = int16_t(r[2]) | int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 198a: jne 1997
+    if (!ZF)
+        AOT_GOTO(0x1997, L1997);
+    AOT_GOTO(0x198c, L198c);
+L198c:
+    AOT_BLOCK(0x198c, 2);
+    // 198c: cmp [bp+c], 0
+    {
+        a = uint16_t(r[5] + 12);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1990: jne 19e2
+    if (!ZF)
+        AOT_GOTO(0x19e2, L19e2);
+    AOT_GOTO(0x1992, L1992);
+L1992:
+    AOT_BLOCK(0x1992, 2);
+    // 1992: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 1994: jmp 1a23
+    AOT_GOTO(0x1a23, L1a23);
+L1997:
+    AOT_BLOCK(0x1997, 2);
+    // 1997: test byte [bp+6], 8
+    {
+        a = uint16_t(r[5] + 6);
+        val = int8_t(RD8(a)) & 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 199b: je 19a9
+    if (ZF)
+        AOT_GOTO(0x19a9, L19a9);
+    AOT_GOTO(0x199d, L199d);
+L199d:
+    AOT_BLOCK(0x199d, 2);
+    // 199d: cmp byte [bp+a], 78
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 120);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 19a1: je 19af
+    if (ZF)
+        AOT_GOTO(0x19af, L19af);
+    AOT_GOTO(0x19a3, L19a3);
+L19a3:
+    AOT_BLOCK(0x19a3, 2);
+    // 19a3: cmp byte [bp+a], 58
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 88);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 19a7: je 19af
+    if (ZF)
+        AOT_GOTO(0x19af, L19af);
+    AOT_GOTO(0x19a9, L19a9);
+L19a9:
+    AOT_BLOCK(0x19a9, 2);
+    // 19a9: cmp byte [bp+a], 70
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 112);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 19ad: jne 19e2
+    if (!ZF)
+        AOT_GOTO(0x19e2, L19e2);
+    AOT_GOTO(0x19af, L19af);
+L19af:
+    AOT_BLOCK(0x19af, 4);
+    // 19af: mov byte [si], 30
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 48);
+    }
+    // 19b2: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 19b3: cmp byte [bp+a], 58
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 88);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 19b7: jne 19be
+    if (!ZF)
+        AOT_GOTO(0x19be, L19be);
+    AOT_GOTO(0x19b9, L19b9);
+L19b9:
+    AOT_BLOCK(0x19b9, 2);
+    // 19b9: mov ax, 0058
+    {
+        r[0] = 0x0058;
+    }
+    // 19bc: jmp short 19c1
+    AOT_GOTO(0x19c1, L19c1);
+L19be:
+    AOT_BLOCK(0x19be, 1);
+    // 19be: mov ax, 0078
+    {
+        r[0] = 0x0078;
+    }
+    AOT_GOTO(0x19c1, L19c1);
+L19c1:
+    AOT_BLOCK(0x19c1, 3);
+    // 19c1: mov [si], al
+    {
+        a = uint16_t(r[6]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 19c3: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 19c4: jmp short 19e2
+    AOT_GOTO(0x19e2, L19e2);
+L19c6:
+    AOT_BLOCK(0x19c6, 2);
+    // 19c6: mov [bp-c], 0002
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0002);
+    }
+    // 19cb: jmp short 19ec
+    AOT_GOTO(0x19ec, L19ec);
+L19cd:
+    AOT_BLOCK(0x19cd, 2);
+    // 19cd: mov [bp-c], 0008
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0008);
+    }
+    // 19d2: jmp short 19ec
+    AOT_GOTO(0x19ec, L19ec);
+L19d4:
+    AOT_BLOCK(0x19d4, 2);
+    // 19d4: mov [bp-c], 000a
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x000a);
+    }
+    // 19d9: jmp short 19ec
+    AOT_GOTO(0x19ec, L19ec);
+L19db:
+    AOT_BLOCK(0x19db, 2);
+    // 19db: mov [bp-c], 0010
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0010);
+    }
+    // 19e0: jmp short 19ec
+    AOT_GOTO(0x19ec, L19ec);
+L19e2:
+    AOT_BLOCK(0x19e2, 4);
+    // 19e2: mov al, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 19e5: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 19e6: mov bx, 0338
+    {
+        r[3] = 0x0338;
+    }
+    // 19e9: jmp 22a8
+    AOT_GOTO(0x22a8, L22a8);
+L19ec:
+    AOT_BLOCK(0x19ec, 6);
+    // 19ec: push [bp+c]
+    {
+        a = uint16_t(r[5] + 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 19ef: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 19f0: push [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 19f3: push [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 19f6: push [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 19f9: call 20fd
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x19fc);
+    }
+    AOT_GOTO(0x20fd, L20fd);
+L19fc:
+    AOT_BLOCK(0x19fc, 4);
+    // 19fc: add sp, a
+    {
+        val = (dst = int16_t(r[4])) + (src = 10);
+        r[4] = val;
+    }
+    // 19ff: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 1a01: cmp byte [bp+a], 58
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 88);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1a05: jne 1a21
+    if (!ZF)
+        AOT_GOTO(0x1a21, L1a21);
+    AOT_GOTO(0x1a07, L1a07);
+L1a07:
+    AOT_BLOCK(0x1a07, 2);
+    // 1a07: cmp [bp-a], si
+    {
+        a = uint16_t(r[5] - 10);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1a0a: je 1a21
+    if (ZF)
+        AOT_GOTO(0x1a21, L1a21);
+    AOT_GOTO(0x1a0c, L1a0c);
+L1a0c:
+    AOT_BLOCK(0x1a0c, 5);
+    // 1a0c: mov bx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[3] = RD16(a);
+    }
+    // 1a0f: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1a11: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1a12: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a13: call 21a8
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1a16);
+    }
+    AOT_GOTO(0x21a8, L21a8);
+L1a16:
+    AOT_BLOCK(0x1a16, 5);
+    // 1a16: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1a17: mov bx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[3] = RD16(a);
+    }
+    // 1a1a: mov [bx], al
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 1a1c: inc [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1a1f: jmp short 1a07
+    AOT_GOTO(0x1a07, L1a07);
+L1a21:
+    AOT_BLOCK(0x1a21, 1);
+    // 1a21: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    AOT_GOTO(0x1a23, L1a23);
+L1a23:
+    AOT_BLOCK(0x1a23, 1);
+    // 1a23: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L1a26:
+    AOT_BLOCK(0x1a26, 7);
+    // 1a26: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1a27: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1a29: sub sp, 041a
+    {
+        val = (dst = int16_t(r[4])) - (src = 1050);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1a2d: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1a2e: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1a2f: mov si, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[6] = RD16(a);
+    }
+    // 1a32: mov [bp-14], 0000
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x1a37, L1a37);
+L1a37:
+    AOT_BLOCK(0x1a37, 7);
+    // 1a37: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 1a3a: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        AF = !(val & 15);
+    }
+    // 1a3d: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1a3f: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1a40: mov [bp-8], ax
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[0]);
+    }
+    // 1a43: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1a45: jne 1a4a
+    if (!ZF)
+        AOT_GOTO(0x1a4a, L1a4a);
+    AOT_GOTO(0x1a47, L1a47);
+L1a47:
+    AOT_BLOCK(0x1a47, 1);
+    // 1a47: jmp 1f82
+    AOT_GOTO(0x1f82, L1f82);
+L1a4a:
+    AOT_BLOCK(0x1a4a, 2);
+    // 1a4a: cmp [bp-8], 25
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) - (src = 37);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1a4e: je 1a90
+    if (ZF)
+        AOT_GOTO(0x1a90, L1a90);
+    AOT_GOTO(0x1a50, L1a50);
+L1a50:
+    AOT_BLOCK(0x1a50, 4);
+    // 1a50: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1a52: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1a53: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1a55: jl 1a67
+    if (SF != OF)
+        AOT_GOTO(0x1a67, L1a67);
+    AOT_GOTO(0x1a57, L1a57);
+L1a57:
+    AOT_BLOCK(0x1a57, 7);
+    // 1a57: mov dx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[2] = RD16(a);
+    }
+    // 1a5a: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 1a5c: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 1a5f: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1a62: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1a64: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1a65: jmp short 1a71
+    AOT_GOTO(0x1a71, L1a71);
+L1a67:
+    AOT_BLOCK(0x1a67, 3);
+    // 1a67: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1a68: push [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1a6b: call 1226
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1a6e);
+    }
+    AOT_GOTO(0x1226, L1226);
+L1a6e:
+    AOT_BLOCK(0x1a6e, 3);
+    // 1a6e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1a6f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1a70: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1a71, L1a71);
+L1a71:
+    AOT_BLOCK(0x1a71, 3);
+    // 1a71: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1a72: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1a75: jne 1a8b
+    if (!ZF)
+        AOT_GOTO(0x1a8b, L1a8b);
+    AOT_GOTO(0x1a77, L1a77);
+L1a77:
+    AOT_BLOCK(0x1a77, 2);
+    // 1a77: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1a7b: je 1a85
+    if (ZF)
+        AOT_GOTO(0x1a85, L1a85);
+    AOT_GOTO(0x1a7d, L1a7d);
+L1a7d:
+    AOT_BLOCK(0x1a7d, 3);
+    // 1a7d: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 1a80: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1a82: jmp 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1a85:
+    AOT_BLOCK(0x1a85, 2);
+    // 1a85: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1a88: jmp 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1a8b:
+    AOT_BLOCK(0x1a8b, 2);
+    // 1a8b: inc [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1a8e: jmp short 1a37
+    AOT_GOTO(0x1a37, L1a37);
+L1a90:
+    AOT_BLOCK(0x1a90, 2);
+    // 1a90: xor di, di
+    {
+        val = int16_t(r[7]) ^ int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1a92: jmp short 1ab8
+    AOT_GOTO(0x1ab8, L1ab8);
+L1a94:
+    AOT_BLOCK(0x1a94, 2);
+    // 1a94: or di, 0001
+    {
+        val = int16_t(r[7]) | 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1a98: jmp short 1ac4
+    AOT_GOTO(0x1ac4, L1ac4);
+L1a9a:
+    AOT_BLOCK(0x1a9a, 2);
+    // 1a9a: or di, 0002
+    {
+        val = int16_t(r[7]) | 2;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1a9e: jmp short 1ac4
+    AOT_GOTO(0x1ac4, L1ac4);
+L1aa0:
+    AOT_BLOCK(0x1aa0, 2);
+    // 1aa0: or di, 0004
+    {
+        val = int16_t(r[7]) | 4;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1aa4: jmp short 1ac4
+    AOT_GOTO(0x1ac4, L1ac4);
+L1aa6:
+    AOT_BLOCK(0x1aa6, 2);
+    // 1aa6: or di, 0008
+    {
+        val = int16_t(r[7]) | 8;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1aaa: jmp short 1ac4
+    AOT_GOTO(0x1ac4, L1ac4);
+L1aac:
+    AOT_BLOCK(0x1aac, 2);
+    // 1aac: or di, 0010
+    {
+        val = int16_t(r[7]) | 16;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1ab0: jmp short 1ac4
+    AOT_GOTO(0x1ac4, L1ac4);
+L1ab2:
+    AOT_BLOCK(0x1ab2, 2);
+    // 1ab2: or di, 1000
+    {
+        val = int16_t(r[7]) | 4096;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1ab6: jmp short 1ac7
+    AOT_GOTO(0x1ac7, L1ac7);
+L1ab8:
+    AOT_BLOCK(0x1ab8, 5);
+    // 1ab8: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 1abb: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1abd: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1abe: mov bx, 035c
+    {
+        r[3] = 0x035c;
+    }
+    // 1ac1: jmp 22a8
+    AOT_GOTO(0x22a8, L22a8);
+L1ac4:
+    AOT_BLOCK(0x1ac4, 1);
+    // 1ac4: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1ac7, L1ac7);
+L1ac7:
+    AOT_BLOCK(0x1ac7, 2);
+    // 1ac7: test di, 1000
+    {
+        val = int16_t(r[7]) & 4096;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1acb: je 1ab8
+    if (ZF)
+        AOT_GOTO(0x1ab8, L1ab8);
+    AOT_GOTO(0x1acd, L1acd);
+L1acd:
+    AOT_BLOCK(0x1acd, 8);
+    // 1acd: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1ad0: mov [bp-16], dx
+    {
+        a = uint16_t(r[5] - 22);
+        WR16(a, r[2]);
+    }
+    // 1ad3: lea ax, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[0] = a;
+    }
+    // 1ad6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1ad7: lea ax, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[0] = a;
+    }
+    // 1ada: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1adb: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1ade: call 1846
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1ae1);
+    }
+    AOT_GOTO(0x1846, L1846);
+L1ae1:
+    AOT_BLOCK(0x1ae1, 4);
+    // 1ae1: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 1ae4: mov [bp+4], ax
+    {
+        a = uint16_t(r[5] + 4);
+        WR16(a, r[0]);
+    }
+    // 1ae7: cmp [bp-16], ax
+    {
+        a = uint16_t(r[5] - 22);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1aea: je 1af0
+    if (ZF)
+        AOT_GOTO(0x1af0, L1af0);
+    AOT_GOTO(0x1aec, L1aec);
+L1aec:
+    AOT_BLOCK(0x1aec, 1);
+    // 1aec: or di, 0100
+    {
+        val = int16_t(r[7]) | 256;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1af0, L1af0);
+L1af0:
+    AOT_BLOCK(0x1af0, 3);
+    // 1af0: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 1af3: cmp byte [bx], 2e
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 46);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1af6: jne 1b1f
+    if (!ZF)
+        AOT_GOTO(0x1b1f, L1b1f);
+    AOT_GOTO(0x1af8, L1af8);
+L1af8:
+    AOT_BLOCK(0x1af8, 9);
+    // 1af8: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1afb: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1afe: mov [bp-16], dx
+    {
+        a = uint16_t(r[5] - 22);
+        WR16(a, r[2]);
+    }
+    // 1b01: lea ax, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[0] = a;
+    }
+    // 1b04: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b05: lea ax, [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        r[0] = a;
+    }
+    // 1b08: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b09: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1b0c: call 1846
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1b0f);
+    }
+    AOT_GOTO(0x1846, L1846);
+L1b0f:
+    AOT_BLOCK(0x1b0f, 4);
+    // 1b0f: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 1b12: mov [bp+4], ax
+    {
+        a = uint16_t(r[5] + 4);
+        WR16(a, r[0]);
+    }
+    // 1b15: cmp [bp-c], 0
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1b19: jl 1b1f
+    if (SF != OF)
+        AOT_GOTO(0x1b1f, L1b1f);
+    AOT_GOTO(0x1b1b, L1b1b);
+L1b1b:
+    AOT_BLOCK(0x1b1b, 1);
+    // 1b1b: or di, 0200
+    {
+        val = int16_t(r[7]) | 512;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1b1f, L1b1f);
+L1b1f:
+    AOT_BLOCK(0x1b1f, 2);
+    // 1b1f: test di, 0100
+    {
+        val = int16_t(r[7]) & 256;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1b23: je 1b32
+    if (ZF)
+        AOT_GOTO(0x1b32, L1b32);
+    AOT_GOTO(0x1b25, L1b25);
+L1b25:
+    AOT_BLOCK(0x1b25, 2);
+    // 1b25: cmp [bp-a], 0
+    {
+        a = uint16_t(r[5] - 10);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1b29: jnl 1b32
+    if (SF == OF)
+        AOT_GOTO(0x1b32, L1b32);
+    AOT_GOTO(0x1b2b, L1b2b);
+L1b2b:
+    AOT_BLOCK(0x1b2b, 2);
+    // 1b2b: neg [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        src = int16_t(RD16(a));
+        val = -src;
+        WR16(a, val);
+        AF = (src & 15) != 0;
+    }
+    // 1b2e: or di, 0001
+    {
+        val = int16_t(r[7]) | 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1b32, L1b32);
+L1b32:
+    AOT_BLOCK(0x1b32, 2);
+    // 1b32: test di, 0100
+    {
+        val = int16_t(r[7]) & 256;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1b36: jne 1b3d
+    if (!ZF)
+        AOT_GOTO(0x1b3d, L1b3d);
+    AOT_GOTO(0x1b38, L1b38);
+L1b38:
+    AOT_BLOCK(0x1b38, 1);
+    // 1b38: mov [bp-a], 0000
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x1b3d, L1b3d);
+L1b3d:
+    AOT_BLOCK(0x1b3d, 2);
+    // 1b3d: test di, 0002
+    {
+        val = int16_t(r[7]) & 2;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1b41: je 1b47
+    if (ZF)
+        AOT_GOTO(0x1b47, L1b47);
+    AOT_GOTO(0x1b43, L1b43);
+L1b43:
+    AOT_BLOCK(0x1b43, 1);
+    // 1b43: and di, fffb
+    {
+        val = int16_t(r[7]) & -5;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1b47, L1b47);
+L1b47:
+    AOT_BLOCK(0x1b47, 2);
+    // 1b47: test di, 0001
+    {
+        val = int16_t(r[7]) & 1;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1b4b: je 1b51
+    if (ZF)
+        AOT_GOTO(0x1b51, L1b51);
+    AOT_GOTO(0x1b4d, L1b4d);
+L1b4d:
+    AOT_BLOCK(0x1b4d, 1);
+    // 1b4d: and di, ffef
+    {
+        val = int16_t(r[7]) & -17;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1b51, L1b51);
+L1b51:
+    AOT_BLOCK(0x1b51, 4);
+    // 1b51: lea bx, [bp-419]
+    {
+        a = uint16_t(r[5] - 1049);
+        r[3] = a;
+    }
+    // 1b55: mov [bp-18], bx
+    {
+        a = uint16_t(r[5] - 24);
+        WR16(a, r[3]);
+    }
+    // 1b58: mov [bp-2], bx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[3]);
+    }
+    // 1b5b: jmp short 1b7b
+    AOT_GOTO(0x1b7b, L1b7b);
+L1b5d:
+    AOT_BLOCK(0x1b5d, 3);
+    // 1b5d: or di, 0020
+    {
+        val = int16_t(r[7]) | 32;
+        r[7] = val;
+        CF = false;
+    }
+    // 1b61: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1b64: jmp 1d3e
+    AOT_GOTO(0x1d3e, L1d3e);
+L1b67:
+    AOT_BLOCK(0x1b67, 3);
+    // 1b67: or di, 0040
+    {
+        val = int16_t(r[7]) | 64;
+        r[7] = val;
+        CF = false;
+    }
+    // 1b6b: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1b6e: jmp 1d3e
+    AOT_GOTO(0x1d3e, L1d3e);
+L1b71:
+    AOT_BLOCK(0x1b71, 3);
+    // 1b71: or di, 0080
+    {
+        val = int16_t(r[7]) | 128;
+        r[7] = val;
+        CF = false;
+    }
+    // 1b75: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1b78: jmp 1d3e
+    AOT_GOTO(0x1d3e, L1d3e);
+L1b7b:
+    AOT_BLOCK(0x1b7b, 5);
+    // 1b7b: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 1b7e: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1b80: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1b81: mov bx, 0374
+    {
+        r[3] = 0x0374;
+    }
+    // 1b84: jmp 22a8
+    AOT_GOTO(0x22a8, L22a8);
+L1b87:
+    AOT_BLOCK(0x1b87, 4);
+    // 1b87: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1b89: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1b8a: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1b8c: jl 1b9e
+    if (SF != OF)
+        AOT_GOTO(0x1b9e, L1b9e);
+    AOT_GOTO(0x1b8e, L1b8e);
+L1b8e:
+    AOT_BLOCK(0x1b8e, 7);
+    // 1b8e: mov dx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[2] = RD16(a);
+    }
+    // 1b91: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 1b93: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 1b96: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1b99: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1b9b: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1b9c: jmp short 1ba8
+    AOT_GOTO(0x1ba8, L1ba8);
+L1b9e:
+    AOT_BLOCK(0x1b9e, 3);
+    // 1b9e: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1b9f: push [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1ba2: call 1226
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1ba5);
+    }
+    AOT_GOTO(0x1226, L1226);
+L1ba5:
+    AOT_BLOCK(0x1ba5, 3);
+    // 1ba5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1ba6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1ba7: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1ba8, L1ba8);
+L1ba8:
+    AOT_BLOCK(0x1ba8, 3);
+    // 1ba8: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1ba9: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1bac: jne 1bc2
+    if (!ZF)
+        AOT_GOTO(0x1bc2, L1bc2);
+    AOT_GOTO(0x1bae, L1bae);
+L1bae:
+    AOT_BLOCK(0x1bae, 2);
+    // 1bae: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1bb2: je 1bbc
+    if (ZF)
+        AOT_GOTO(0x1bbc, L1bbc);
+    AOT_GOTO(0x1bb4, L1bb4);
+L1bb4:
+    AOT_BLOCK(0x1bb4, 3);
+    // 1bb4: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 1bb7: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1bb9: jmp 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1bbc:
+    AOT_BLOCK(0x1bbc, 2);
+    // 1bbc: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1bbf: jmp 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1bc2:
+    AOT_BLOCK(0x1bc2, 2);
+    // 1bc2: inc [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1bc5: jmp 1a37
+    AOT_GOTO(0x1a37, L1a37);
+L1bc8:
+    AOT_BLOCK(0x1bc8, 2);
+    // 1bc8: test di, 0020
+    {
+        val = int16_t(r[7]) & 32;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1bcc: je 1be2
+    if (ZF)
+        AOT_GOTO(0x1be2, L1be2);
+    AOT_GOTO(0x1bce, L1bce);
+L1bce:
+    AOT_BLOCK(0x1bce, 7);
+    // 1bce: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1bd1: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1bd4: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 1bd7: mov bx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[3] = RD16(a);
+    }
+    // 1bda: mov dx, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[2] = RD16(a);
+    }
+    // 1bdd: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 1bdf: jmp 1a37
+    AOT_GOTO(0x1a37, L1a37);
+L1be2:
+    AOT_BLOCK(0x1be2, 2);
+    // 1be2: test di, 0040
+    {
+        val = int16_t(r[7]) & 64;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1be6: je 1c00
+    if (ZF)
+        AOT_GOTO(0x1c00, L1c00);
+    AOT_GOTO(0x1be8, L1be8);
+L1be8:
+    AOT_BLOCK(0x1be8, 9);
+    // 1be8: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 1beb: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 1bec: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1bef: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1bf2: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 1bf5: mov bx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[3] = RD16(a);
+    }
+    // 1bf8: mov [bx], ax
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[0]);
+    }
+    // 1bfa: mov [bx+2], dx
+    {
+        a = uint16_t(r[3] + 2);
+        WR16(a, r[2]);
+    }
+    // 1bfd: jmp 1a37
+    AOT_GOTO(0x1a37, L1a37);
+L1c00:
+    AOT_BLOCK(0x1c00, 7);
+    // 1c00: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1c03: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1c06: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 1c09: mov bx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[3] = RD16(a);
+    }
+    // 1c0c: mov dx, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[2] = RD16(a);
+    }
+    // 1c0f: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 1c11: jmp 1a37
+    AOT_GOTO(0x1a37, L1a37);
+L1c14:
+    AOT_BLOCK(0x1c14, 7);
+    // 1c14: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1c17: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 1c1a: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 1c1d: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 1c20: mov [bp-18], dx
+    {
+        a = uint16_t(r[5] - 24);
+        WR16(a, r[2]);
+    }
+    // 1c23: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1c25: jne 1c2c
+    if (!ZF)
+        AOT_GOTO(0x1c2c, L1c2c);
+    AOT_GOTO(0x1c27, L1c27);
+L1c27:
+    AOT_BLOCK(0x1c27, 1);
+    // 1c27: mov [bp-18], 03cc
+    {
+        a = uint16_t(r[5] - 24);
+        WR16(a, 0x03cc);
+    }
+    AOT_GOTO(0x1c2c, L1c2c);
+L1c2c:
+    AOT_BLOCK(0x1c2c, 2);
+    // 1c2c: mov dx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[2] = RD16(a);
+    }
+    // 1c2f: mov [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1c32, L1c32);
+L1c32:
+    AOT_BLOCK(0x1c32, 2);
+    // 1c32: cmp [bp-c], 0
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1c36: jne 1c41
+    if (!ZF)
+        AOT_GOTO(0x1c41, L1c41);
+    AOT_GOTO(0x1c38, L1c38);
+L1c38:
+    AOT_BLOCK(0x1c38, 2);
+    // 1c38: test di, 0200
+    {
+        val = int16_t(r[7]) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1c3c: je 1c41
+    if (ZF)
+        AOT_GOTO(0x1c41, L1c41);
+    AOT_GOTO(0x1c3e, L1c3e);
+L1c3e:
+    AOT_BLOCK(0x1c3e, 1);
+    // 1c3e: jmp 1d50
+    AOT_GOTO(0x1d50, L1d50);
+L1c41:
+    AOT_BLOCK(0x1c41, 3);
+    // 1c41: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 1c44: cmp byte [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1c47: jne 1c4c
+    if (!ZF)
+        AOT_GOTO(0x1c4c, L1c4c);
+    AOT_GOTO(0x1c49, L1c49);
+L1c49:
+    AOT_BLOCK(0x1c49, 1);
+    // 1c49: jmp 1d50
+    AOT_GOTO(0x1d50, L1d50);
+L1c4c:
+    AOT_BLOCK(0x1c4c, 3);
+    // 1c4c: inc [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1c4f: dec [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1c52: jmp short 1c32
+    AOT_GOTO(0x1c32, L1c32);
+L1c54:
+    AOT_BLOCK(0x1c54, 2);
+    // 1c54: test di, 0200
+    {
+        val = int16_t(r[7]) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1c58: jne 1c61
+    if (!ZF)
+        AOT_GOTO(0x1c61, L1c61);
+    AOT_GOTO(0x1c5a, L1c5a);
+L1c5a:
+    AOT_BLOCK(0x1c5a, 2);
+    // 1c5a: mov [bp-c], 0001
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0001);
+    }
+    // 1c5f: jmp short 1c6b
+    AOT_GOTO(0x1c6b, L1c6b);
+L1c61:
+    AOT_BLOCK(0x1c61, 2);
+    // 1c61: cmp [bp-8], 70
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) - (src = 112);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1c65: je 1c6b
+    if (ZF)
+        AOT_GOTO(0x1c6b, L1c6b);
+    AOT_GOTO(0x1c67, L1c67);
+L1c67:
+    AOT_BLOCK(0x1c67, 1);
+    // 1c67: and di, ffef
+    {
+        val = int16_t(r[7]) & -17;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1c6b, L1c6b);
+L1c6b:
+    AOT_BLOCK(0x1c6b, 11);
+    // 1c6b: mov ax, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[0] = RD16(a);
+    }
+    // 1c6e: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1c6f: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1c71: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 1c72: push [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1c75: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1c76: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1c79: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1c7a: lea ax, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[0] = a;
+    }
+    // 1c7d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1c7e: call 189a
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1c81);
+    }
+    AOT_GOTO(0x189a, L189a);
+L1c81:
+    AOT_BLOCK(0x1c81, 3);
+    // 1c81: add sp, c
+    {
+        val = (dst = int16_t(r[4])) + (src = 12);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1c84: mov [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[0]);
+    }
+    // 1c87: jmp 1d50
+    AOT_GOTO(0x1d50, L1d50);
+L1c8a:
+    AOT_BLOCK(0x1c8a, 3);
+    // 1c8a: or di, 0400
+    {
+        val = int16_t(r[7]) | 1024;
+        r[7] = val;
+    }
+    // 1c8e: test di, 0200
+    {
+        val = int16_t(r[7]) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1c92: jne 1c9b
+    if (!ZF)
+        AOT_GOTO(0x1c9b, L1c9b);
+    AOT_GOTO(0x1c94, L1c94);
+L1c94:
+    AOT_BLOCK(0x1c94, 2);
+    // 1c94: mov [bp-c], 0001
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0001);
+    }
+    // 1c99: jmp short 1c9f
+    AOT_GOTO(0x1c9f, L1c9f);
+L1c9b:
+    AOT_BLOCK(0x1c9b, 1);
+    // 1c9b: and di, ffef
+    {
+        val = int16_t(r[7]) & -17;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1c9f, L1c9f);
+L1c9f:
+    AOT_BLOCK(0x1c9f, 11);
+    // 1c9f: mov ax, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[0] = RD16(a);
+    }
+    // 1ca2: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1ca3: mov bx, 0001
+    {
+        r[3] = 0x0001;
+    }
+    // 1ca6: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 1ca7: push [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1caa: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1cab: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1cae: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1caf: lea ax, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[0] = a;
+    }
+    // 1cb2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1cb3: call 189a
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1cb6);
+    }
+    AOT_GOTO(0x189a, L189a);
+L1cb6:
+    AOT_BLOCK(0x1cb6, 3);
+    // 1cb6: add sp, c
+    {
+        val = (dst = int16_t(r[4])) + (src = 12);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1cb9: mov [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[0]);
+    }
+    // 1cbc: jmp 1d50
+    AOT_GOTO(0x1d50, L1d50);
+L1cbf:
+    AOT_BLOCK(0x1cbf, 9);
+    // 1cbf: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1cc2: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1cc5: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 1cc8: push [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1ccb: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 1cce: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1ccf: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1cd1: inc [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1cd4: jmp 1d50
+    AOT_GOTO(0x1d50, L1d50);
+L1cd7:
+    AOT_BLOCK(0x1cd7, 2);
+    // 1cd7: test di, 0200
+    {
+        val = int16_t(r[7]) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1cdb: je 1ce8
+    if (ZF)
+        AOT_GOTO(0x1ce8, L1ce8);
+    AOT_GOTO(0x1cdd, L1cdd);
+L1cdd:
+    AOT_BLOCK(0x1cdd, 2);
+    // 1cdd: cmp [bp-c], 0
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1ce1: jne 1ce8
+    if (!ZF)
+        AOT_GOTO(0x1ce8, L1ce8);
+    AOT_GOTO(0x1ce3, L1ce3);
+L1ce3:
+    AOT_BLOCK(0x1ce3, 1);
+    // 1ce3: mov [bp-c], 0001
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0001);
+    }
+    AOT_GOTO(0x1ce8, L1ce8);
+L1ce8:
+    AOT_BLOCK(0x1ce8, 2);
+    // 1ce8: test di, 0200
+    {
+        val = int16_t(r[7]) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1cec: jne 1cf3
+    if (!ZF)
+        AOT_GOTO(0x1cf3, L1cf3);
+    AOT_GOTO(0x1cee, L1cee);
+L1cee:
+    AOT_BLOCK(0x1cee, 1);
+    // 1cee: mov [bp-c], 0006
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0006);
+    }
+    AOT_GOTO(0x1cf3, L1cf3);
+L1cf3:
+    AOT_BLOCK(0x1cf3, 2);
+    // 1cf3: cmp [bp-c], 0401
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) - (src = 1025);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1cf8: jb 1cff
+    if (CF)
+        AOT_GOTO(0x1cff, L1cff);
+    AOT_GOTO(0x1cfa, L1cfa);
+L1cfa:
+    AOT_BLOCK(0x1cfa, 1);
+    // 1cfa: mov [bp-c], 0400
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0400);
+    }
+    AOT_GOTO(0x1cff, L1cff);
+L1cff:
+    AOT_BLOCK(0x1cff, 10);
+    // 1cff: or di, 0400
+    {
+        val = int16_t(r[7]) | 1024;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1d03: mov ax, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[0] = RD16(a);
+    }
+    // 1d06: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1d07: push [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1d0a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1d0b: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1d0e: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1d0f: lea ax, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[0] = a;
+    }
+    // 1d12: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1d13: call 21c4
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1d16);
+    }
+    AOT_GOTO(0x21c4, L21c4);
+L1d16:
+    AOT_BLOCK(0x1d16, 3);
+    // 1d16: add sp, a
+    {
+        val = (dst = int16_t(r[4])) + (src = 10);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1d19: mov [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[0]);
+    }
+    // 1d1c: jmp short 1d50
+    AOT_GOTO(0x1d50, L1d50);
+L1d1e:
+    AOT_BLOCK(0x1d1e, 11);
+    // 1d1e: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1d21: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+    }
+    // 1d24: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 1d27: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 1d2a: mov [bp+6], dx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[2]);
+    }
+    // 1d2d: add dx, 2
+    {
+        val = (dst = int16_t(r[2])) + (src = 2);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1d30: mov [bp+6], dx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[2]);
+    }
+    // 1d33: mov bx, dx
+    {
+        r[3] = r[2];
+    }
+    // 1d35: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 1d38: mov [bp+4], dx
+    {
+        a = uint16_t(r[5] + 4);
+        WR16(a, r[2]);
+    }
+    // 1d3b: jmp 1a37
+    AOT_GOTO(0x1a37, L1a37);
+L1d3e:
+    AOT_BLOCK(0x1d3e, 7);
+    // 1d3e: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 1d41: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1d44: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1d46: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1d47: mov [bp-8], ax
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[0]);
+    }
+    // 1d4a: mov bx, 0384
+    {
+        r[3] = 0x0384;
+    }
+    // 1d4d: jmp 22a8
+    AOT_GOTO(0x22a8, L22a8);
+L1d50:
+    AOT_BLOCK(0x1d50, 3);
+    // 1d50: mov [bp-e], 0020
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, 0x0020);
+    }
+    // 1d55: test di, 0010
+    {
+        val = int16_t(r[7]) & 16;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1d59: je 1d60
+    if (ZF)
+        AOT_GOTO(0x1d60, L1d60);
+    AOT_GOTO(0x1d5b, L1d5b);
+L1d5b:
+    AOT_BLOCK(0x1d5b, 1);
+    // 1d5b: mov [bp-e], 0030
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, 0x0030);
+    }
+    AOT_GOTO(0x1d60, L1d60);
+L1d60:
+    AOT_BLOCK(0x1d60, 6);
+    // 1d60: mov dx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[2] = RD16(a);
+    }
+    // 1d63: sub dx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 1d66: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 1d69: mov [bp-12], 0000
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, 0x0000);
+    }
+    // 1d6e: test di, 0010
+    {
+        val = int16_t(r[7]) & 16;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1d72: je 1da7
+    if (ZF)
+        AOT_GOTO(0x1da7, L1da7);
+    AOT_GOTO(0x1d74, L1d74);
+L1d74:
+    AOT_BLOCK(0x1d74, 2);
+    // 1d74: cmp [bp-8], 78
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) - (src = 120);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1d78: je 1d80
+    if (ZF)
+        AOT_GOTO(0x1d80, L1d80);
+    AOT_GOTO(0x1d7a, L1d7a);
+L1d7a:
+    AOT_BLOCK(0x1d7a, 2);
+    // 1d7a: cmp [bp-8], 58
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) - (src = 88);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1d7e: jne 1d86
+    if (!ZF)
+        AOT_GOTO(0x1d86, L1d86);
+    AOT_GOTO(0x1d80, L1d80);
+L1d80:
+    AOT_BLOCK(0x1d80, 2);
+    // 1d80: test di, 0008
+    {
+        val = int16_t(r[7]) & 8;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1d84: jne 1da4
+    if (!ZF)
+        AOT_GOTO(0x1da4, L1da4);
+    AOT_GOTO(0x1d86, L1d86);
+L1d86:
+    AOT_BLOCK(0x1d86, 2);
+    // 1d86: cmp [bp-8], 70
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) - (src = 112);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1d8a: je 1da4
+    if (ZF)
+        AOT_GOTO(0x1da4, L1da4);
+    AOT_GOTO(0x1d8c, L1d8c);
+L1d8c:
+    AOT_BLOCK(0x1d8c, 2);
+    // 1d8c: test di, 0400
+    {
+        val = int16_t(r[7]) & 1024;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1d90: je 1da7
+    if (ZF)
+        AOT_GOTO(0x1da7, L1da7);
+    AOT_GOTO(0x1d92, L1d92);
+L1d92:
+    AOT_BLOCK(0x1d92, 3);
+    // 1d92: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1d95: cmp byte [bx], 2b
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 43);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1d98: je 1da4
+    if (ZF)
+        AOT_GOTO(0x1da4, L1da4);
+    AOT_GOTO(0x1d9a, L1d9a);
+L1d9a:
+    AOT_BLOCK(0x1d9a, 2);
+    // 1d9a: cmp byte [bx], 2d
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 45);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1d9d: je 1da4
+    if (ZF)
+        AOT_GOTO(0x1da4, L1da4);
+    AOT_GOTO(0x1d9f, L1d9f);
+L1d9f:
+    AOT_BLOCK(0x1d9f, 2);
+    // 1d9f: cmp byte [bx], 20
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 32);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 1da2: jne 1da7
+    if (!ZF)
+        AOT_GOTO(0x1da7, L1da7);
+    AOT_GOTO(0x1da4, L1da4);
+L1da4:
+    AOT_BLOCK(0x1da4, 1);
+    // 1da4: inc [bp-12]
+    {
+        a = uint16_t(r[5] - 18);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1da7, L1da7);
+L1da7:
+    AOT_BLOCK(0x1da7, 4);
+    // 1da7: mov dx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[2] = RD16(a);
+    }
+    // 1daa: sub dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1dad: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 1db0: jnle 1db5
+    if (!(ZF || SF != OF))
+        AOT_GOTO(0x1db5, L1db5);
+    AOT_GOTO(0x1db2, L1db2);
+L1db2:
+    AOT_BLOCK(0x1db2, 1);
+    // 1db2: jmp 1ee5
+    AOT_GOTO(0x1ee5, L1ee5);
+L1db5:
+    AOT_BLOCK(0x1db5, 2);
+    // 1db5: test di, 0001
+    {
+        val = int16_t(r[7]) & 1;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1db9: je 1dbe
+    if (ZF)
+        AOT_GOTO(0x1dbe, L1dbe);
+    AOT_GOTO(0x1dbb, L1dbb);
+L1dbb:
+    AOT_BLOCK(0x1dbb, 1);
+    // 1dbb: jmp 1ee5
+    AOT_GOTO(0x1ee5, L1ee5);
+L1dbe:
+    AOT_BLOCK(0x1dbe, 4);
+    // 1dbe: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1dc1: add [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2]));
+        WR16(a, val);
+    }
+    // 1dc4: cmp [bp-12], 0
+    {
+        a = uint16_t(r[5] - 18);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1dc8: jne 1dcd
+    if (!ZF)
+        AOT_GOTO(0x1dcd, L1dcd);
+    AOT_GOTO(0x1dca, L1dca);
+L1dca:
+    AOT_BLOCK(0x1dca, 1);
+    // 1dca: jmp 1ea5
+    AOT_GOTO(0x1ea5, L1ea5);
+L1dcd:
+    AOT_BLOCK(0x1dcd, 2);
+    // 1dcd: test di, 0400
+    {
+        val = int16_t(r[7]) & 1024;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1dd1: je 1e23
+    if (ZF)
+        AOT_GOTO(0x1e23, L1e23);
+    AOT_GOTO(0x1dd3, L1dd3);
+L1dd3:
+    AOT_BLOCK(0x1dd3, 6);
+    // 1dd3: dec [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+    }
+    // 1dd6: inc [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1dd9: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1ddb: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1ddc: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1dde: jl 1df5
+    if (SF != OF)
+        AOT_GOTO(0x1df5, L1df5);
+    AOT_GOTO(0x1de0, L1de0);
+L1de0:
+    AOT_BLOCK(0x1de0, 9);
+    // 1de0: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1de3: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1de6: mov dl, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1de8: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 1dea: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 1ded: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1df0: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1df2: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1df3: jmp short 1e06
+    AOT_GOTO(0x1e06, L1e06);
+L1df5:
+    AOT_BLOCK(0x1df5, 7);
+    // 1df5: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1df8: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1dfb: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1dfd: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1dfe: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1dff: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1e00: call 1226
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1e03);
+    }
+    AOT_GOTO(0x1226, L1226);
+L1e03:
+    AOT_BLOCK(0x1e03, 3);
+    // 1e03: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1e04: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1e05: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1e06, L1e06);
+L1e06:
+    AOT_BLOCK(0x1e06, 3);
+    // 1e06: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1e07: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1e0a: je 1e0f
+    if (ZF)
+        AOT_GOTO(0x1e0f, L1e0f);
+    AOT_GOTO(0x1e0c, L1e0c);
+L1e0c:
+    AOT_BLOCK(0x1e0c, 1);
+    // 1e0c: jmp 1ea5
+    AOT_GOTO(0x1ea5, L1ea5);
+L1e0f:
+    AOT_BLOCK(0x1e0f, 2);
+    // 1e0f: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1e13: je 1e1d
+    if (ZF)
+        AOT_GOTO(0x1e1d, L1e1d);
+    AOT_GOTO(0x1e15, L1e15);
+L1e15:
+    AOT_BLOCK(0x1e15, 3);
+    // 1e15: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 1e18: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1e1a: jmp 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1e1d:
+    AOT_BLOCK(0x1e1d, 2);
+    // 1e1d: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1e20: jmp 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1e23:
+    AOT_BLOCK(0x1e23, 6);
+    // 1e23: sub [bp-4], 2
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 2);
+        WR16(a, val);
+    }
+    // 1e27: add [bp-14], 2
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1e2b: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1e2d: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1e2e: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1e30: jl 1e47
+    if (SF != OF)
+        AOT_GOTO(0x1e47, L1e47);
+    AOT_GOTO(0x1e32, L1e32);
+L1e32:
+    AOT_BLOCK(0x1e32, 9);
+    // 1e32: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1e35: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1e38: mov dl, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1e3a: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 1e3c: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 1e3f: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1e42: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1e44: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1e45: jmp short 1e58
+    AOT_GOTO(0x1e58, L1e58);
+L1e47:
+    AOT_BLOCK(0x1e47, 7);
+    // 1e47: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1e4a: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1e4d: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1e4f: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1e50: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1e51: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1e52: call 1226
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1e55);
+    }
+    AOT_GOTO(0x1226, L1226);
+L1e55:
+    AOT_BLOCK(0x1e55, 3);
+    // 1e55: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1e56: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1e57: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1e58, L1e58);
+L1e58:
+    AOT_BLOCK(0x1e58, 3);
+    // 1e58: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1e59: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1e5c: je 1e91
+    if (ZF)
+        AOT_GOTO(0x1e91, L1e91);
+    AOT_GOTO(0x1e5e, L1e5e);
+L1e5e:
+    AOT_BLOCK(0x1e5e, 4);
+    // 1e5e: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1e60: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1e61: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1e63: jl 1e7a
+    if (SF != OF)
+        AOT_GOTO(0x1e7a, L1e7a);
+    AOT_GOTO(0x1e65, L1e65);
+L1e65:
+    AOT_BLOCK(0x1e65, 9);
+    // 1e65: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1e68: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1e6b: mov dl, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1e6d: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 1e6f: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 1e72: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1e75: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1e77: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1e78: jmp short 1e8b
+    AOT_GOTO(0x1e8b, L1e8b);
+L1e7a:
+    AOT_BLOCK(0x1e7a, 7);
+    // 1e7a: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1e7d: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1e80: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1e82: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1e83: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1e84: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1e85: call 1226
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1e88);
+    }
+    AOT_GOTO(0x1226, L1226);
+L1e88:
+    AOT_BLOCK(0x1e88, 3);
+    // 1e88: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1e89: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1e8a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1e8b, L1e8b);
+L1e8b:
+    AOT_BLOCK(0x1e8b, 3);
+    // 1e8b: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1e8c: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1e8f: jne 1ea5
+    if (!ZF)
+        AOT_GOTO(0x1ea5, L1ea5);
+    AOT_GOTO(0x1e91, L1e91);
+L1e91:
+    AOT_BLOCK(0x1e91, 2);
+    // 1e91: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1e95: je 1e9f
+    if (ZF)
+        AOT_GOTO(0x1e9f, L1e9f);
+    AOT_GOTO(0x1e97, L1e97);
+L1e97:
+    AOT_BLOCK(0x1e97, 3);
+    // 1e97: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 1e9a: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1e9c: jmp 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1e9f:
+    AOT_BLOCK(0x1e9f, 2);
+    // 1e9f: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1ea2: jmp 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1ea5:
+    AOT_BLOCK(0x1ea5, 4);
+    // 1ea5: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1ea7: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1ea8: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1eaa: jl 1ebc
+    if (SF != OF)
+        AOT_GOTO(0x1ebc, L1ebc);
+    AOT_GOTO(0x1eac, L1eac);
+L1eac:
+    AOT_BLOCK(0x1eac, 7);
+    // 1eac: mov dx, [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        r[2] = RD16(a);
+    }
+    // 1eaf: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 1eb1: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 1eb4: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1eb7: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1eb9: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1eba: jmp short 1ec6
+    AOT_GOTO(0x1ec6, L1ec6);
+L1ebc:
+    AOT_BLOCK(0x1ebc, 3);
+    // 1ebc: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1ebd: push [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1ec0: call 1226
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1ec3);
+    }
+    AOT_GOTO(0x1226, L1226);
+L1ec3:
+    AOT_BLOCK(0x1ec3, 3);
+    // 1ec3: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1ec4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1ec5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1ec6, L1ec6);
+L1ec6:
+    AOT_BLOCK(0x1ec6, 3);
+    // 1ec6: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1ec7: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1eca: jne 1ee0
+    if (!ZF)
+        AOT_GOTO(0x1ee0, L1ee0);
+    AOT_GOTO(0x1ecc, L1ecc);
+L1ecc:
+    AOT_BLOCK(0x1ecc, 2);
+    // 1ecc: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1ed0: je 1eda
+    if (ZF)
+        AOT_GOTO(0x1eda, L1eda);
+    AOT_GOTO(0x1ed2, L1ed2);
+L1ed2:
+    AOT_BLOCK(0x1ed2, 3);
+    // 1ed2: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 1ed5: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1ed7: jmp 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1eda:
+    AOT_BLOCK(0x1eda, 2);
+    // 1eda: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1edd: jmp 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1ee0:
+    AOT_BLOCK(0x1ee0, 2);
+    // 1ee0: dec [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1ee3: jne 1ea5
+    if (!ZF)
+        AOT_GOTO(0x1ea5, L1ea5);
+    AOT_GOTO(0x1ee5, L1ee5);
+L1ee5:
+    AOT_BLOCK(0x1ee5, 2);
+    // 1ee5: mov dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[2] = RD16(a);
+    }
+    // 1ee8: add [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2]));
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x1eeb, L1eeb);
+L1eeb:
+    AOT_BLOCK(0x1eeb, 2);
+    // 1eeb: dec [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1eee: jl 1f35
+    if (SF != OF)
+        AOT_GOTO(0x1f35, L1f35);
+    AOT_GOTO(0x1ef0, L1ef0);
+L1ef0:
+    AOT_BLOCK(0x1ef0, 4);
+    // 1ef0: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1ef2: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1ef3: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1ef5: jl 1f0c
+    if (SF != OF)
+        AOT_GOTO(0x1f0c, L1f0c);
+    AOT_GOTO(0x1ef7, L1ef7);
+L1ef7:
+    AOT_BLOCK(0x1ef7, 9);
+    // 1ef7: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1efa: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1efd: mov dl, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1eff: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 1f01: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 1f04: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1f07: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1f09: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1f0a: jmp short 1f1d
+    AOT_GOTO(0x1f1d, L1f1d);
+L1f0c:
+    AOT_BLOCK(0x1f0c, 7);
+    // 1f0c: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1f0f: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1f12: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1f14: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1f15: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1f16: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1f17: call 1226
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1f1a);
+    }
+    AOT_GOTO(0x1226, L1226);
+L1f1a:
+    AOT_BLOCK(0x1f1a, 3);
+    // 1f1a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1f1b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1f1c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1f1d, L1f1d);
+L1f1d:
+    AOT_BLOCK(0x1f1d, 3);
+    // 1f1d: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1f1e: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1f21: jne 1eeb
+    if (!ZF)
+        AOT_GOTO(0x1eeb, L1eeb);
+    AOT_GOTO(0x1f23, L1f23);
+L1f23:
+    AOT_BLOCK(0x1f23, 2);
+    // 1f23: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1f27: je 1f30
+    if (ZF)
+        AOT_GOTO(0x1f30, L1f30);
+    AOT_GOTO(0x1f29, L1f29);
+L1f29:
+    AOT_BLOCK(0x1f29, 3);
+    // 1f29: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 1f2c: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1f2e: jmp short 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1f30:
+    AOT_BLOCK(0x1f30, 2);
+    // 1f30: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1f33: jmp short 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1f35:
+    AOT_BLOCK(0x1f35, 2);
+    // 1f35: cmp [bp-6], 0
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1f39: jle 1f41
+    if (ZF || SF != OF)
+        AOT_GOTO(0x1f41, L1f41);
+    AOT_GOTO(0x1f3b, L1f3b);
+L1f3b:
+    AOT_BLOCK(0x1f3b, 2);
+    // 1f3b: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1f3e: add [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2]));
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x1f41, L1f41);
+L1f41:
+    AOT_BLOCK(0x1f41, 2);
+    // 1f41: dec [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1f44: jnl 1f49
+    if (SF == OF)
+        AOT_GOTO(0x1f49, L1f49);
+    AOT_GOTO(0x1f46, L1f46);
+L1f46:
+    AOT_BLOCK(0x1f46, 1);
+    // 1f46: jmp 1a37
+    AOT_GOTO(0x1a37, L1a37);
+L1f49:
+    AOT_BLOCK(0x1f49, 4);
+    // 1f49: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1f4b: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1f4c: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1f4e: jl 1f60
+    if (SF != OF)
+        AOT_GOTO(0x1f60, L1f60);
+    AOT_GOTO(0x1f50, L1f50);
+L1f50:
+    AOT_BLOCK(0x1f50, 7);
+    // 1f50: mov dx, [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        r[2] = RD16(a);
+    }
+    // 1f53: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 1f55: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 1f58: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1f5b: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1f5d: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1f5e: jmp short 1f6a
+    AOT_GOTO(0x1f6a, L1f6a);
+L1f60:
+    AOT_BLOCK(0x1f60, 3);
+    // 1f60: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1f61: push [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1f64: call 1226
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1f67);
+    }
+    AOT_GOTO(0x1226, L1226);
+L1f67:
+    AOT_BLOCK(0x1f67, 3);
+    // 1f67: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1f68: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1f69: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1f6a, L1f6a);
+L1f6a:
+    AOT_BLOCK(0x1f6a, 3);
+    // 1f6a: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1f6b: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1f6e: jne 1f41
+    if (!ZF)
+        AOT_GOTO(0x1f41, L1f41);
+    AOT_GOTO(0x1f70, L1f70);
+L1f70:
+    AOT_BLOCK(0x1f70, 2);
+    // 1f70: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1f74: je 1f7d
+    if (ZF)
+        AOT_GOTO(0x1f7d, L1f7d);
+    AOT_GOTO(0x1f76, L1f76);
+L1f76:
+    AOT_BLOCK(0x1f76, 3);
+    // 1f76: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 1f79: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1f7b: jmp short 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1f7d:
+    AOT_BLOCK(0x1f7d, 2);
+    // 1f7d: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1f80: jmp short 1f85
+    AOT_GOTO(0x1f85, L1f85);
+L1f82:
+    AOT_BLOCK(0x1f82, 1);
+    // 1f82: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x1f85, L1f85);
+L1f85:
+    AOT_BLOCK(0x1f85, 1);
+    // 1f85: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L2020:
+    AOT_BLOCK(0x2020, 3);
+    // 2020: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 2025: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 2028: jmp 20c3
+    AOT_GOTO(0x20c3, L20c3);
+L203e:
+    AOT_BLOCK(0x203e, 1);
+    // 203e: jmp 20c3
+    AOT_GOTO(0x20c3, L20c3);
+L206c:
+    AOT_BLOCK(0x206c, 1);
+    // 206c: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x206e, L206e);
+L206e:
+    AOT_BLOCK(0x206e, 1);
+    // 206e: jmp short 20c3
+    AOT_GOTO(0x20c3, L20c3);
+L2077:
+    AOT_BLOCK(0x2077, 7);
+    // 2077: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 2079: mov bx, 0002
+    {
+        r[3] = 0x0002;
+    }
+    // 207c: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 207d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 207e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 207f: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 2082: call 170b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x2085);
+    }
+    AOT_GOTO(0x170b, L170b);
+L2085:
+    AOT_BLOCK(0x2085, 4);
+    // 2085: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 2088: and dx, ax
+    {
+        val = int16_t(r[2]) & int16_t(r[0]);
+        r[2] = val;
+    }
+    // 208a: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 208d: jne 2099
+    if (!ZF)
+        AOT_GOTO(0x2099, L2099);
+    AOT_GOTO(0x208f, L208f);
+L208f:
+    AOT_BLOCK(0x208f, 3);
+    // 208f: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 2094: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 2097: jmp short 20c3
+    AOT_GOTO(0x20c3, L20c3);
+L2099:
+    AOT_BLOCK(0x2099, 4);
+    // 2099: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 209c: push [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 209f: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 20a2: call 1819
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x20a5);
+    }
+    AOT_GOTO(0x1819, L1819);
+L20a5:
+    AOT_BLOCK(0x20a5, 6);
+    // 20a5: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 20a8: mov [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[0]);
+    }
+    // 20ab: mov [si], 0000
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0x0000);
+    }
+    // 20af: mov dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[2] = RD16(a);
+    }
+    // 20b2: cmp [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 20b5: jne 20bb
+    if (!ZF)
+        AOT_GOTO(0x20bb, L20bb);
+    AOT_GOTO(0x20b7, L20b7);
+L20b7:
+    AOT_BLOCK(0x20b7, 2);
+    // 20b7: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 20b9: jmp short 20c3
+    AOT_GOTO(0x20c3, L20c3);
+L20bb:
+    AOT_BLOCK(0x20bb, 2);
+    // 20bb: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 20c0: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    AOT_GOTO(0x20c3, L20c3);
+L20c3:
+    AOT_BLOCK(0x20c3, 1);
+    // 20c3: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L20fd:
+    AOT_BLOCK(0x20fd, 12);
+    // 20fd: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 20fe: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 2100: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 2101: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 2102: mov si, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[6] = RD16(a);
+    }
+    // 2105: mov ax, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[0] = RD16(a);
+    }
+    // 2108: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 2109: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 210c: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 210f: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 2110: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 2111: call 2347
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x2114);
+    }
+    AOT_GOTO(0x2347, L2347);
+L2114:
+    AOT_BLOCK(0x2114, 8);
+    // 2114: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 2116: mov ax, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[0] = RD16(a);
+    }
+    // 2119: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 211a: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 211d: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 2120: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 2121: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 2122: call 22cb
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x2125);
+    }
+    AOT_GOTO(0x22cb, L22cb);
+L2125:
+    AOT_BLOCK(0x2125, 4);
+    // 2125: mov [bp+4], ax
+    {
+        a = uint16_t(r[5] + 4);
+        WR16(a, r[0]);
+    }
+    // 2128: mov [bp+6], dx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[2]);
+    }
+    // 212b: or dx, ax
+    {
+        val = int16_t(r[2]) | int16_t(r[0]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 212d: jne 2135
+    if (!ZF)
+        AOT_GOTO(0x2135, L2135);
+    AOT_GOTO(0x212f, L212f);
+L212f:
+    AOT_BLOCK(0x212f, 2);
+    // 212f: cmp [bp+c], 1
+    {
+        a = uint16_t(r[5] + 12);
+        val = (dst = int16_t(RD16(a))) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 2133: jle 214c
+    if (ZF || SF != OF)
+        AOT_GOTO(0x214c, L214c);
+    AOT_GOTO(0x2135, L2135);
+L2135:
+    AOT_BLOCK(0x2135, 8);
+    // 2135: mov dx, [bp+c]
+    {
+        a = uint16_t(r[5] + 12);
+        r[2] = RD16(a);
+    }
+    // 2138: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 2139: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 213a: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 213b: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 213e: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 2141: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 2144: call 20fd
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x2147);
+    }
+    AOT_GOTO(0x20fd, L20fd);
+L2147:
+    AOT_BLOCK(0x2147, 2);
+    // 2147: add sp, a
+    {
+        val = (dst = int16_t(r[4])) + (src = 10);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 214a: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    AOT_GOTO(0x214c, L214c);
+L214c:
+    AOT_BLOCK(0x214c, 2);
+    // 214c: cmp di, 9
+    {
+        val = (dst = int16_t(r[7])) - (src = 9);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 214f: jle 2158
+    if (ZF || SF != OF)
+        AOT_GOTO(0x2158, L2158);
+    AOT_GOTO(0x2151, L2151);
+L2151:
+    AOT_BLOCK(0x2151, 3);
+    // 2151: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 2153: sub ax, ffa9
+    {
+        val = (dst = int16_t(r[0])) - (src = -87);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 2156: jmp short 215b
+    AOT_GOTO(0x215b, L215b);
+L2158:
+    AOT_BLOCK(0x2158, 1);
+    // 2158: lea ax, [di+30]
+    {
+        a = uint16_t(r[7] + 48);
+        r[0] = a;
+    }
+    AOT_GOTO(0x215b, L215b);
+L215b:
+    AOT_BLOCK(0x215b, 3);
+    // 215b: mov [si], al
+    {
+        a = uint16_t(r[6]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 215d: lea ax, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[0] = a;
+    }
+    // 2160: jmp 233d
+    AOT_GOTO(0x233d, L233d);
+L21a2:
+    AOT_BLOCK(0x21a2, 2);
+    // 21a2: mov cx, ffff
+    {
+        r[1] = 0xffff;
+    }
+    // 21a5: jmp 2240
+    AOT_GOTO(0x2240, L2240);
+L21a8:
+    AOT_BLOCK(0x21a8, 6);
+    // 21a8: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 21a9: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 21ab: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 21ae: sub dx, 61
+    {
+        val = (dst = int16_t(r[2])) - (src = 97);
+        r[2] = val;
+    }
+    // 21b1: cmp dx, 1a
+    {
+        val = (dst = int16_t(r[2])) - (src = 26);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 21b4: jnb 21be
+    if (!CF)
+        AOT_GOTO(0x21be, L21be);
+    AOT_GOTO(0x21b6, L21b6);
+L21b6:
+    AOT_BLOCK(0x21b6, 3);
+    // 21b6: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 21b9: sub ax, 0020
+    {
+        val = (dst = int16_t(r[0])) - (src = 32);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 21bc: jmp short 21c1
+    AOT_GOTO(0x21c1, L21c1);
+L21be:
+    AOT_BLOCK(0x21be, 1);
+    // 21be: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x21c1, L21c1);
+L21c1:
+    AOT_BLOCK(0x21c1, 1);
+    // 21c1: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L21c4:
+    AOT_BLOCK(0x21c4, 7);
+    // 21c4: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 21c5: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 21c7: mov ax, 03d6
+    {
+        r[0] = 0x03d6;
+    }
+    // 21ca: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 21cb: mov ax, 02da
+    {
+        r[0] = 0x02da;
+    }
+    // 21ce: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 21cf: call 1587
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x21d2);
+    }
+    AOT_GOTO(0x1587, L1587);
+L21d2:
+    AOT_BLOCK(0x21d2, 5);
+    // 21d2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 21d3: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 21d4: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 21d7: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 21d8: call 0e7b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x21db);
+    }
+    AOT_GOTO(0x0e7b, L0e7b);
+L21db:
+    AOT_BLOCK(0x21db, 2);
+    // 21db: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 21dc: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L21df:
+    AOT_BLOCK(0x21df, 5);
+    // 21df: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 21e0: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 21e2: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 21e3: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 21e6: call 21a2
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x21e9);
+    }
+    AOT_GOTO(0x21a2, L21a2);
+L21e9:
+    AOT_BLOCK(0x21e9, 10);
+    // 21e9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 21ea: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+    }
+    // 21eb: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 21ed: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 21f0: mov [bx+4], si
+    {
+        a = uint16_t(r[3] + 4);
+        WR16(a, r[6]);
+    }
+    // 21f3: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 21f6: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 21f9: mov [bx+8], dx
+    {
+        a = uint16_t(r[3] + 8);
+        WR16(a, r[2]);
+    }
+    // 21fc: cmp si, e
+    {
+        val = (dst = int16_t(r[6])) - (src = 14);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 21ff: jnbe 2210
+    if (!(CF || ZF))
+        AOT_GOTO(0x2210, L2210);
+    AOT_GOTO(0x2201, L2201);
+L2201:
+    AOT_BLOCK(0x2201, 5);
+    // 2201: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 2204: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 2207: add bx, a
+    {
+        val = (dst = int16_t(r[3])) + (src = 10);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 220a: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 220b: call 225b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x220e);
+    }
+    AOT_GOTO(0x225b, L225b);
+L220e:
+    AOT_BLOCK(0x220e, 2);
+    // 220e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 220f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x2210, L2210);
+L2210:
+    AOT_BLOCK(0x2210, 1);
+    // 2210: jmp 233e
+    AOT_GOTO(0x233e, L233e);
+L2213:
+    AOT_BLOCK(0x2213, 16);
+    // 2213: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 2214: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 2216: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 2219: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 221c: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 221f: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 2222: mov [bp-10], dx
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, r[2]);
+    }
+    // 2225: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 2228: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 222b: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 222e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 222f: mov ax, 0036
+    {
+        r[0] = 0x0036;
+    }
+    // 2232: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 2233: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 2236: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 2237: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x223a);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L223a:
+    AOT_BLOCK(0x223a, 2);
+    // 223a: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 223d: jmp 233f
+    AOT_GOTO(0x233f, L233f);
+L2240:
+    AOT_BLOCK(0x2240, 10);
+    // 2240: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 2241: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 2243: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 2244: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 2247: xor al, al
+    {
+        val = int8_t(r[0]) ^ int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+    }
+    // 2249: mov dx, cx
+    {
+        r[2] = r[1];
+    }
+    // 224b: cmp cl, 1
+    {
+        val = (dst = int8_t(r[1])) - (src = 1);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 224e: cld
+    {
+        DF = false;
+    }
+    // 224f: rep scasb
+    {
+        if (r[1]) {
+            do {
+                val = int8_t(dst = uint8_t(r[0])) - int8_t(src = RD8(r[7]));
+                AF = (dst & 15) - (src & 15) < 0;
+                CF = dst < src;
+                OF = val != int8_t(val);
+                SF = int8_t(val) < 0;
+                ZF = int8_t(val) == 0;
+                PF = ptable[uint8_t(val)];
+                if (DF) r[7] -= 1;
+                else r[7] += 1;
+            } while (--r[1] && !ZF);
+        }
+    }
+    // 2251: jne 2254
+    if (!ZF)
+        AOT_GOTO(0x2254, L2254);
+    AOT_GOTO(0x2253, L2253);
+L2253:
+    AOT_BLOCK(0x2253, 1);
+    // 2253: inc cx
+    {
+        val = int16_t(r[1]) + 1;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x2254, L2254);
+L2254:
+    AOT_BLOCK(0x2254, 5);
+    // 2254: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 2256: sub ax, cx
+    {
+        val = (dst = int16_t(r[0])) - (src = int16_t(r[1]));
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 2258: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 2259: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 225a: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x225a);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L225b:
+    AOT_BLOCK(0x225b, 6);
+    // 225b: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 225c: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 225e: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 225f: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 2260: mov cx, ffff
+    {
+        r[1] = 0xffff;
+    }
+    // 2263: call 226d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x2266);
+    }
+    AOT_GOTO(0x226d, L226d);
+L2266:
+    AOT_BLOCK(0x2266, 5);
+    // 2266: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 2269: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 226a: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 226b: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 226c: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x226c);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L226d:
+    AOT_BLOCK(0x226d, 11);
+    // 226d: mov di, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[7] = RD16(a);
+    }
+    // 2270: xor al, al
+    {
+        val = int8_t(r[0]) ^ int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+    }
+    // 2272: mov dx, cx
+    {
+        r[2] = r[1];
+    }
+    // 2274: cld
+    {
+        DF = false;
+    }
+    // 2275: rep scasb
+    {
+        if (r[1]) {
+            do {
+                val = int8_t(dst = uint8_t(r[0])) - int8_t(src = RD8(r[7]));
+                AF = (dst & 15) - (src & 15) < 0;
+                CF = dst < src;
+                OF = val != int8_t(val);
+                SF = int8_t(val) < 0;
+                ZF = int8_t(val) == 0;
+                PF = ptable[uint8_t(val)];
+                if (DF) r[7] -= 1;
+                else r[7] += 1;
+            } while (--r[1] && !ZF);
+        }
+    }
+    // 2277: sub dx, cx
+    {
+        val = (dst = int16_t(r[2])) - (src = int16_t(r[1]));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 2279: xchg dx, cx
+    {
+        val = int16_t(r[1]);
+        r[1] = int16_t(r[2]);
+        r[2] = val;
+    }
+    // 227b: mov si, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[6] = RD16(a);
+    }
+    // 227e: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 2281: rep movsb
+    {
+        if (r[1]) {
+            do {
+                WR8(r[7], RD8(r[6]));
+                if (DF) {
+                    r[6] -= 1;
+                    r[7] -= 1;
+                } else {
+                    r[6] += 1;
+                    r[7] += 1;
+                }
+            } while (--r[1]);
+        }
+    }
+    // 2283: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x2283);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L2284:
+    AOT_BLOCK(0x2284, 4);
+    // 2284: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 2286: sub ax, [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        val = (dst = int16_t(r[0])) - (src = int16_t(RD16(a)));
+        r[0] = val;
+    }
+    // 2289: cmp ax, [bx+4]
+    {
+        a = uint16_t(r[3] + 4);
+        val = (dst = int16_t(r[0])) - (src = int16_t(RD16(a)));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 228c: jnbe 2299
+    if (!(CF || ZF))
+        AOT_GOTO(0x2299, L2299);
+    AOT_GOTO(0x228e, L228e);
+L228e:
+    AOT_BLOCK(0x228e, 5);
+    // 228e: shl ax, 1
+    {
+        val = r[0] << 1;
+        r[0] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 2290: add bx, ax
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[0]));
+        r[3] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 2292: mov bx, [bx+6]
+    {
+        a = uint16_t(r[3] + 6);
+        r[3] = RD16(a);
+    }
+    // 2295: test bx, bx
+    {
+        val = int16_t(r[3]) & int16_t(r[3]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 2297: jne 22a6
+    if (!ZF)
+        AOT_GOTO(0x22a6, L22a6);
+    AOT_GOTO(0x2299, L2299);
+L2299:
+    AOT_BLOCK(0x2299, 3);
+    // 2299: mov bx, dx
+    {
+        r[3] = r[2];
+    }
+    // 229b: test bx, bx
+    {
+        val = int16_t(r[3]) & int16_t(r[3]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 229d: jne 22a6
+    if (!ZF)
+        AOT_GOTO(0x22a6, L22a6);
+    AOT_GOTO(0x229f, L229f);
+L229f:
+    AOT_BLOCK(0x229f, 3);
+    // 229f: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 22a2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 22a3: jmp 2319
+    AOT_GOTO(0x2319, L2319);
+L22a6:
+    AOT_BLOCK(0x22a6, 1);
+    // 22a6: jmp bx
+    {
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L22a8:
+    AOT_BLOCK(0x22a8, 2);
+    // 22a8: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 22aa: mov cx, [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        r[1] = RD16(a);
+    }
+    AOT_GOTO(0x22ad, L22ad);
+L22ad:
+    AOT_BLOCK(0x22ad, 3);
+    // 22ad: add bx, 4
+    {
+        val = (dst = int16_t(r[3])) + (src = 4);
+        r[3] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 22b0: dec cx
+    {
+        val = int16_t(r[1]) - 1;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 22b1: jl 22c7
+    if (SF != OF)
+        AOT_GOTO(0x22c7, L22c7);
+    AOT_GOTO(0x22b3, L22b3);
+L22b3:
+    AOT_BLOCK(0x22b3, 2);
+    // 22b3: cmp ax, [bx]
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(r[0])) - (src = int16_t(RD16(a)));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 22b5: jne 22ad
+    if (!ZF)
+        AOT_GOTO(0x22ad, L22ad);
+    AOT_GOTO(0x22b7, L22b7);
+L22b7:
+    AOT_BLOCK(0x22b7, 1);
+    // 22b7: mov bx, [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        r[3] = RD16(a);
+    }
+    AOT_GOTO(0x22ba, L22ba);
+L22ba:
+    AOT_BLOCK(0x22ba, 2);
+    // 22ba: test bx, bx
+    {
+        val = int16_t(r[3]) & int16_t(r[3]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 22bc: jne 22c5
+    if (!ZF)
+        AOT_GOTO(0x22c5, L22c5);
+    AOT_GOTO(0x22be, L22be);
+L22be:
+    AOT_BLOCK(0x22be, 3);
+    // 22be: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 22c1: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 22c2: jmp 2319
+    AOT_GOTO(0x2319, L2319);
+L22c5:
+    AOT_BLOCK(0x22c5, 1);
+    // 22c5: jmp bx
+    {
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L22c7:
+    AOT_BLOCK(0x22c7, 2);
+    // 22c7: mov bx, dx
+    {
+        r[3] = r[2];
+    }
+    // 22c9: jmp short 22ba
+    AOT_GOTO(0x22ba, L22ba);
+L22cb:
+    AOT_BLOCK(0x22cb, 7);
+    // 22cb: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 22cc: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 22cd: mov si, sp
+    {
+        r[6] = r[4];
+    }
+    // 22cf: mov bx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        r[3] = RD16(a);
+    }
+    // 22d2: mov ax, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[0] = RD16(a);
+    }
+    // 22d5: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 22d7: jne 22ed
+    if (!ZF)
+        AOT_GOTO(0x22ed, L22ed);
+    AOT_GOTO(0x22d9, L22d9);
+L22d9:
+    AOT_BLOCK(0x22d9, 6);
+    // 22d9: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 22db: mov cx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[1] = RD16(a);
+    }
+    // 22de: mov ax, [si+c]
+    {
+        a = uint16_t(r[6] + 12);
+        r[0] = RD16(a);
+    }
+    // 22e1: div bx
+    {
+        u32 = uint32_t(r[2]) << 16 | r[0];
+        src = r[3];
+        r[0] = u32 / src;
+        r[2] = u32 % src;
+    }
+    // 22e3: xchg cx, ax
+    {
+        val = r[0];
+        r[0] = r[1];
+        r[1] = val;
+    }
+    // 22e4: div bx
+    {
+        u32 = uint32_t(r[2]) << 16 | r[0];
+        src = r[3];
+        r[0] = u32 / src;
+        r[2] = u32 % src;
+    }
+    AOT_GOTO(0x22e6, L22e6);
+L22e6:
+    AOT_BLOCK(0x22e6, 4);
+    // 22e6: mov dx, cx
+    {
+        r[2] = r[1];
+    }
+    // 22e8: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 22e9: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 22ea: ret 0008
+    {
+        b = RD16(r[4]);
+        r[4] += 2;
+        r[4] += 8;
+    }
+    AOT_JUMP(b);
+L22ed:
+    AOT_BLOCK(0x22ed, 5);
+    // 22ed: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 22ef: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 22f1: mov ax, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[0] = RD16(a);
+    }
+    // 22f4: mov dx, [si+c]
+    {
+        a = uint16_t(r[6] + 12);
+        r[2] = RD16(a);
+    }
+    // 22f7: mov cx, 0010
+    {
+        r[1] = 0x0010;
+    }
+    AOT_GOTO(0x22fa, L22fa);
+L22fa:
+    AOT_BLOCK(0x22fa, 5);
+    // 22fa: shl ax, 1
+    {
+        val = r[0] << 1;
+        r[0] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 22fc: rcl dx, 1
+    {
+        val = r[2];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[2] = val;
+    }
+    // 22fe: rcl bx, 1
+    {
+        val = r[3];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[3] = val;
+    }
+    // 2300: cmp di, bx
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[3]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 2302: jnbe 230b
+    if (!(CF || ZF))
+        AOT_GOTO(0x230b, L230b);
+    AOT_GOTO(0x2304, L2304);
+L2304:
+    AOT_BLOCK(0x2304, 1);
+    // 2304: jb 230f
+    if (CF)
+        AOT_GOTO(0x230f, L230f);
+    AOT_GOTO(0x2306, L2306);
+L2306:
+    AOT_BLOCK(0x2306, 2);
+    // 2306: cmp [si+6], dx
+    {
+        a = uint16_t(r[6] + 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 2309: jbe 230f
+    if (CF || ZF)
+        AOT_GOTO(0x230f, L230f);
+    AOT_GOTO(0x230b, L230b);
+L230b:
+    AOT_BLOCK(0x230b, 1);
+    // 230b: loop 22fa
+    {
+        r[1]--;
+    }
+    if (r[1] > 0)
+        AOT_GOTO(0x22fa, L22fa);
+    AOT_GOTO(0x230d, L230d);
+L230d:
+    AOT_BLOCK(0x230d, 1);
+    // 230d: jmp short 22e6
+    AOT_GOTO(0x22e6, L22e6);
+L230f:
+    AOT_BLOCK(0x230f, 4);
+    // 230f: sub dx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 2312: sbb bx, di
+    {
+        val = (dst = int16_t(r[3])) - (src = int16_t(r[7])) - CF;
+        r[3] = val;
+        CF = uint16_t(dst) < uint16_t(src + CF) || (CF && !(src + 1));
+    }
+    // 2314: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 2315: loop 22fa
+    {
+        r[1]--;
+    }
+    if (r[1] > 0)
+        AOT_GOTO(0x22fa, L22fa);
+    AOT_GOTO(0x2317, L2317);
+L2317:
+    AOT_BLOCK(0x2317, 1);
+    // 2317: jmp short 22e6
+    AOT_GOTO(0x22e6, L22e6);
+L2319:
+    AOT_BLOCK(0x2319, 1);
+    // 2319: call 23f2
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x231c);
+    }
+    AOT_GOTO(0x23f2, L23f2);
+L231c:
+    AOT_BLOCK(0x231c, 1);
+    // 231c: call 2399
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x231f);
+    }
+    AOT_GOTO(0x2399, L2399);
+L231f:
+    AOT_BLOCK(0x231f, 15);
+    // 231f: mov bx, sp
+    {
+        r[3] = r[4];
+    }
+    // 2321: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 2322: mov cx, ax
+    {
+        r[1] = r[0];
+    }
+    // 2324: mul [bx+4]
+    {
+        a = uint16_t(r[3] + 4);
+        u32 = uint32_t(r[0]) * RD16(a);
+        r[2] = u32 >> 16;
+        r[0] = u32;
+    }
+    // 2327: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 2328: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 2329: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 232b: mul [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        u32 = uint32_t(r[0]) * RD16(a);
+        r[2] = u32 >> 16;
+        r[0] = u32;
+    }
+    // 232e: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 232f: add dx, ax
+    {
+        val = (dst = int16_t(r[2])) + (src = int16_t(r[0]));
+        r[2] = val;
+    }
+    // 2331: mov ax, cx
+    {
+        r[0] = r[1];
+    }
+    // 2333: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 2335: mul [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        u32 = uint32_t(r[0]) * RD16(a);
+        r[2] = u32 >> 16;
+        r[0] = u32;
+    }
+    // 2338: add dx, cx
+    {
+        val = (dst = int16_t(r[2])) + (src = int16_t(r[1]));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 233a: ret 0004
+    {
+        b = RD16(r[4]);
+        r[4] += 2;
+        r[4] += 4;
+    }
+    AOT_JUMP(b);
+L233d:
+    AOT_BLOCK(0x233d, 1);
+    // 233d: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    AOT_GOTO(0x233e, L233e);
+L233e:
+    AOT_BLOCK(0x233e, 1);
+    // 233e: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    AOT_GOTO(0x233f, L233f);
+L233f:
+    AOT_BLOCK(0x233f, 3);
+    // 233f: mov sp, bp
+    {
+        r[4] = r[5];
+    }
+    // 2341: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 2342: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x2342);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L2347:
+    AOT_BLOCK(0x2347, 7);
+    // 2347: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 2348: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 2349: mov si, sp
+    {
+        r[6] = r[4];
+    }
+    // 234b: mov bx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        r[3] = RD16(a);
+    }
+    // 234e: mov ax, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[0] = RD16(a);
+    }
+    // 2351: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 2353: jne 236d
+    if (!ZF)
+        AOT_GOTO(0x236d, L236d);
+    AOT_GOTO(0x2355, L2355);
+L2355:
+    AOT_BLOCK(0x2355, 7);
+    // 2355: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 2357: mov cx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[1] = RD16(a);
+    }
+    // 235a: mov ax, [si+c]
+    {
+        a = uint16_t(r[6] + 12);
+        r[0] = RD16(a);
+    }
+    // 235d: div bx
+    {
+        u32 = uint32_t(r[2]) << 16 | r[0];
+        src = r[3];
+        r[0] = u32 / src;
+        r[2] = u32 % src;
+    }
+    // 235f: xchg cx, ax
+    {
+        val = r[0];
+        r[0] = r[1];
+        r[1] = val;
+    }
+    // 2360: div bx
+    {
+        u32 = uint32_t(r[2]) << 16 | r[0];
+        src = r[3];
+        r[0] = u32 / src;
+        r[2] = u32 % src;
+    }
+    // 2362: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x2364, L2364);
+L2364:
+    AOT_BLOCK(0x2364, 5);
+    // 2364: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 2366: mov dx, bx
+    {
+        r[2] = r[3];
+    }
+    // 2368: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 2369: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 236a: ret 0008
+    {
+        b = RD16(r[4]);
+        r[4] += 2;
+        r[4] += 8;
+    }
+    AOT_JUMP(b);
+L236d:
+    AOT_BLOCK(0x236d, 5);
+    // 236d: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 236f: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 2371: mov ax, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[0] = RD16(a);
+    }
+    // 2374: mov dx, [si+c]
+    {
+        a = uint16_t(r[6] + 12);
+        r[2] = RD16(a);
+    }
+    // 2377: mov cx, 0010
+    {
+        r[1] = 0x0010;
+    }
+    AOT_GOTO(0x237a, L237a);
+L237a:
+    AOT_BLOCK(0x237a, 5);
+    // 237a: shl ax, 1
+    {
+        val = r[0] << 1;
+        r[0] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 237c: rcl dx, 1
+    {
+        val = r[2];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[2] = val;
+    }
+    // 237e: rcl bx, 1
+    {
+        val = r[3];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[3] = val;
+    }
+    // 2380: cmp di, bx
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[3]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 2382: jnbe 238b
+    if (!(CF || ZF))
+        AOT_GOTO(0x238b, L238b);
+    AOT_GOTO(0x2384, L2384);
+L2384:
+    AOT_BLOCK(0x2384, 1);
+    // 2384: jb 238f
+    if (CF)
+        AOT_GOTO(0x238f, L238f);
+    AOT_GOTO(0x2386, L2386);
+L2386:
+    AOT_BLOCK(0x2386, 2);
+    // 2386: cmp [si+6], dx
+    {
+        a = uint16_t(r[6] + 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 2389: jbe 238f
+    if (CF || ZF)
+        AOT_GOTO(0x238f, L238f);
+    AOT_GOTO(0x238b, L238b);
+L238b:
+    AOT_BLOCK(0x238b, 1);
+    // 238b: loop 237a
+    {
+        r[1]--;
+    }
+    if (r[1] > 0)
+        AOT_GOTO(0x237a, L237a);
+    AOT_GOTO(0x238d, L238d);
+L238d:
+    AOT_BLOCK(0x238d, 1);
+    // 238d: jmp short 2364
+    AOT_GOTO(0x2364, L2364);
+L238f:
+    AOT_BLOCK(0x238f, 4);
+    // 238f: sub dx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 2392: sbb bx, di
+    {
+        val = (dst = int16_t(r[3])) - (src = int16_t(r[7])) - CF;
+        r[3] = val;
+        CF = uint16_t(dst) < uint16_t(src + CF) || (CF && !(src + 1));
+    }
+    // 2394: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 2395: loop 237a
+    {
+        r[1]--;
+    }
+    if (r[1] > 0)
+        AOT_GOTO(0x237a, L237a);
+    AOT_GOTO(0x2397, L2397);
+L2397:
+    AOT_BLOCK(0x2397, 1);
+    // 2397: jmp short 2364
+    AOT_GOTO(0x2364, L2364);
+L2399:
+    AOT_BLOCK(0x2399, 1);
+    // 2399: call 1609
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x239c);
+    }
+    AOT_GOTO(0x1609, L1609);
+L239c:
+    AOT_BLOCK(0x239c, 3);
+    // 239c: mov ax, 0006
+    {
+        r[0] = 0x0006;
+    }
+    // 239f: mov dx, 041e
+    {
+        r[2] = 0x041e;
+    }
+    // 23a2: jmp short 23d4
+    AOT_GOTO(0x23d4, L23d4);
+L23d4:
+    AOT_BLOCK(0x23d4, 4);
+    // 23d4: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+    }
+    // 23d6: xchg [04dc], bx
+    {
+        a = 0x04dc;
+        val = int16_t(r[3]);
+        r[3] = int16_t(RD16(a));
+        WR16(a, val);
+    }
+    // 23da: test bx, bx
+    {
+        val = int16_t(r[3]) & int16_t(r[3]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 23dc: je 23e3
+    if (ZF)
+        AOT_GOTO(0x23e3, L23e3);
+    AOT_GOTO(0x23de, L23de);
+L23de:
+    AOT_BLOCK(0x23de, 2);
+    // 23de: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 23df: call bx
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x23e1);
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L23e1:
+    AOT_BLOCK(0x23e1, 2);
+    // 23e1: pop ax
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[0] = val;
+    }
+    // 23e2: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x23e2);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L23e3:
+    AOT_BLOCK(0x23e3, 6);
+    // 23e3: mov bx, 0016
+    {
+        r[3] = 0x0016;
+    }
+    // 23e6: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 23e7: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 23e8: mov ax, 0002
+    {
+        r[0] = 0x0002;
+    }
+    // 23eb: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 23ec: call 242a
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x23ef);
+    }
+    AOT_GOTO(0x242a, L242a);
+L23ef:
+    AOT_BLOCK(0x23ef, 1);
+    // 23ef: call 1609
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x23f2);
+    }
+    AOT_GOTO(0x1609, L1609);
+L23f2:
+    AOT_BLOCK(0x23f2, 3);
+    // 23f2: mov dx, ax
+    {
+        r[2] = r[0];
+    }
+    // 23f4: cmp dx, 15
+    {
+        val = (dst = int16_t(r[2])) - (src = 21);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 23f7: jnb 240a
+    if (!CF)
+        AOT_GOTO(0x240a, L240a);
+    AOT_GOTO(0x23f9, L23f9);
+L23f9:
+    AOT_BLOCK(0x23f9, 6);
+    // 23f9: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 23fb: mov bx, 03f4
+    {
+        r[3] = 0x03f4;
+    }
+    // 23fe: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 2400: mov bx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[3] = RD16(a);
+    }
+    // 2402: test bx, bx
+    {
+        val = int16_t(r[3]) & int16_t(r[3]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 2404: je 240a
+    if (ZF)
+        AOT_GOTO(0x240a, L240a);
+    AOT_GOTO(0x2406, L2406);
+L2406:
+    AOT_BLOCK(0x2406, 2);
+    // 2406: mov dx, bx
+    {
+        r[2] = r[3];
+    }
+    // 2408: jmp short 2428
+    AOT_GOTO(0x2428, L2428);
+L240a:
+    AOT_BLOCK(0x240a, 3);
+    // 240a: mov bx, 04cd
+    {
+        r[3] = 0x04cd;
+    }
+    // 240d: mov cx, 0006
+    {
+        r[1] = 0x0006;
+    }
+    // 2410: mov dx, ax
+    {
+        r[2] = r[0];
+    }
+    AOT_GOTO(0x2412, L2412);
+L2412:
+    AOT_BLOCK(0x2412, 8);
+    // 2412: and dx, 0007
+    {
+        val = int16_t(r[2]) & 7;
+        r[2] = val;
+    }
+    // 2416: add dx, [0030]
+    {
+        a = 0x0030;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 241a: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 241c: dec bx
+    {
+        val = int16_t(r[3]) - 1;
+        r[3] = val;
+        AF = (val & 15) == 15;
+    }
+    // 241d: sar dx, 1
+    {
+        val = int16_t(r[2]) >> (1 - 1);
+        r[2] = val >> 1;
+        SF = int16_t((val >> 1)) < 0;
+        ZF = int16_t((val >> 1)) == 0;
+        PF = ptable[uint8_t((val >> 1))];
+        CF = val & 1;
+        OF = false;
+    }
+    // 241f: sar dx, 1
+    {
+        val = int16_t(r[2]) >> (1 - 1);
+        r[2] = val >> 1;
+        SF = int16_t((val >> 1)) < 0;
+        ZF = int16_t((val >> 1)) == 0;
+        PF = ptable[uint8_t((val >> 1))];
+        CF = val & 1;
+        OF = false;
+    }
+    // 2421: sar dx, 1
+    {
+        val = int16_t(r[2]) >> (1 - 1);
+        r[2] = val >> 1;
+        SF = int16_t((val >> 1)) < 0;
+        ZF = int16_t((val >> 1)) == 0;
+        PF = ptable[uint8_t((val >> 1))];
+        CF = val & 1;
+        OF = false;
+    }
+    // 2423: loop 2412
+    {
+        r[1]--;
+    }
+    if (r[1] > 0)
+        AOT_GOTO(0x2412, L2412);
+    AOT_GOTO(0x2425, L2425);
+L2425:
+    AOT_BLOCK(0x2425, 1);
+    // 2425: mov dx, 04bf
+    {
+        r[2] = 0x04bf;
+    }
+    AOT_GOTO(0x2428, L2428);
+L2428:
+    AOT_BLOCK(0x2428, 1);
+    // 2428: jmp short 23d4
+    AOT_GOTO(0x23d4, L23d4);
+L242a:
+    AOT_BLOCK(0x242a, 16);
+    // 242a: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 242b: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 242d: mov [0604], 0004
+    {
+        a = 0x0604;
+        WR16(a, 0x0004);
+    }
+    // 2433: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 2436: mov [0606], bx
+    {
+        a = 0x0606;
+        WR16(a, r[3]);
+    }
+    // 243a: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 243d: mov [0608], bx
+    {
+        a = 0x0608;
+        WR16(a, r[3]);
+    }
+    // 2441: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 2444: mov [060c], bx
+    {
+        a = 0x060c;
+        WR16(a, r[3]);
+    }
+    // 2448: mov ax, 0602
+    {
+        r[0] = 0x0602;
+    }
+    // 244b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 244c: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 244f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 2450: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 2453: mov bx, 0602
+    {
+        r[3] = 0x0602;
+    }
+    // 2456: mov cx, 0003
+    {
+        r[1] = 0x0003;
+    }
+    // 2459: int 20
+    AOT_INTERP(0x2459);
+L245b:
+    AOT_BLOCK(0x245b, 3);
+    // 245b: mov sp, bp
+    {
+        r[4] = r[5];
+    }
+    // 245d: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 245e: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x245e);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("m2/lib/cv", 0x0000, 9312, 0x94e05c2cu, run);
+}
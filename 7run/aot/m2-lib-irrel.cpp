@@ -0,0 +1,17766 @@
+// m2/lib/irrel translated by 7aot: 793 blocks, do not edit
+#include "../i8086/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.IP) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x0004: goto L0004;
+        case 0x0006: goto L0006;
+        case 0x000c: goto L000c;
+        case 0x0010: goto L0010;
+        case 0x0013: goto L0013;
+        case 0x0019: goto L0019;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0024: goto L0024;
+        case 0x0028: goto L0028;
+        case 0x002c: goto L002c;
+        case 0x0030: goto L0030;
+        case 0x0034: goto L0034;
+        case 0x0038: goto L0038;
+        case 0x0039: goto L0039;
+        case 0x003c: goto L003c;
+        case 0x0040: goto L0040;
+        case 0x004b: goto L004b;
+        case 0x0052: goto L0052;
+        case 0x0055: goto L0055;
+        case 0x005b: goto L005b;
+        case 0x0062: goto L0062;
+        case 0x0065: goto L0065;
+        case 0x0068: goto L0068;
+        case 0x006a: goto L006a;
+        case 0x006e: goto L006e;
+        case 0x0072: goto L0072;
+        case 0x0075: goto L0075;
+        case 0x007a: goto L007a;
+        case 0x007e: goto L007e;
+        case 0x007f: goto L007f;
+        case 0x0082: goto L0082;
+        case 0x0088: goto L0088;
+        case 0x0094: goto L0094;
+        case 0x0097: goto L0097;
+        case 0x00a3: goto L00a3;
+        case 0x00aa: goto L00aa;
+        case 0x00b8: goto L00b8;
+        case 0x00be: goto L00be;
+        case 0x00c2: goto L00c2;
+        case 0x00c3: goto L00c3;
+        case 0x00ca: goto L00ca;
+        case 0x00d2: goto L00d2;
+        case 0x00da: goto L00da;
+        case 0x00e2: goto L00e2;
+        case 0x00ea: goto L00ea;
+        case 0x00f2: goto L00f2;
+        case 0x00fa: goto L00fa;
+        case 0x0102: goto L0102;
+        case 0x010a: goto L010a;
+        case 0x0112: goto L0112;
+        case 0x011a: goto L011a;
+        case 0x0122: goto L0122;
+        case 0x012a: goto L012a;
+        case 0x0132: goto L0132;
+        case 0x013a: goto L013a;
+        case 0x0142: goto L0142;
+        case 0x014a: goto L014a;
+        case 0x0152: goto L0152;
+        case 0x015a: goto L015a;
+        case 0x0162: goto L0162;
+        case 0x016a: goto L016a;
+        case 0x0171: goto L0171;
+        case 0x0175: goto L0175;
+        case 0x0193: goto L0193;
+        case 0x0196: goto L0196;
+        case 0x019b: goto L019b;
+        case 0x01a2: goto L01a2;
+        case 0x01a6: goto L01a6;
+        case 0x01af: goto L01af;
+        case 0x01b6: goto L01b6;
+        case 0x01ba: goto L01ba;
+        case 0x01c1: goto L01c1;
+        case 0x01c9: goto L01c9;
+        case 0x01d3: goto L01d3;
+        case 0x01d7: goto L01d7;
+        case 0x01e4: goto L01e4;
+        case 0x01ea: goto L01ea;
+        case 0x01fa: goto L01fa;
+        case 0x0203: goto L0203;
+        case 0x0209: goto L0209;
+        case 0x020f: goto L020f;
+        case 0x0215: goto L0215;
+        case 0x021f: goto L021f;
+        case 0x0228: goto L0228;
+        case 0x0235: goto L0235;
+        case 0x023e: goto L023e;
+        case 0x0244: goto L0244;
+        case 0x024a: goto L024a;
+        case 0x024e: goto L024e;
+        case 0x025e: goto L025e;
+        case 0x0264: goto L0264;
+        case 0x026e: goto L026e;
+        case 0x0279: goto L0279;
+        case 0x0282: goto L0282;
+        case 0x0283: goto L0283;
+        case 0x028e: goto L028e;
+        case 0x0294: goto L0294;
+        case 0x0297: goto L0297;
+        case 0x029e: goto L029e;
+        case 0x02a1: goto L02a1;
+        case 0x02ab: goto L02ab;
+        case 0x02af: goto L02af;
+        case 0x02b5: goto L02b5;
+        case 0x02b9: goto L02b9;
+        case 0x02bf: goto L02bf;
+        case 0x02ca: goto L02ca;
+        case 0x02cf: goto L02cf;
+        case 0x02d6: goto L02d6;
+        case 0x02d7: goto L02d7;
+        case 0x02fd: goto L02fd;
+        case 0x031b: goto L031b;
+        case 0x032c: goto L032c;
+        case 0x0332: goto L0332;
+        case 0x0338: goto L0338;
+        case 0x0343: goto L0343;
+        case 0x037a: goto L037a;
+        case 0x037d: goto L037d;
+        case 0x0384: goto L0384;
+        case 0x038b: goto L038b;
+        case 0x0392: goto L0392;
+        case 0x039b: goto L039b;
+        case 0x039e: goto L039e;
+        case 0x03a7: goto L03a7;
+        case 0x03af: goto L03af;
+        case 0x03b7: goto L03b7;
+        case 0x03c2: goto L03c2;
+        case 0x03cb: goto L03cb;
+        case 0x03cc: goto L03cc;
+        case 0x03d2: goto L03d2;
+        case 0x03e1: goto L03e1;
+        case 0x03e6: goto L03e6;
+        case 0x03ef: goto L03ef;
+        case 0x03f4: goto L03f4;
+        case 0x03fe: goto L03fe;
+        case 0x0409: goto L0409;
+        case 0x0415: goto L0415;
+        case 0x041a: goto L041a;
+        case 0x0429: goto L0429;
+        case 0x0434: goto L0434;
+        case 0x0437: goto L0437;
+        case 0x0443: goto L0443;
+        case 0x044c: goto L044c;
+        case 0x045a: goto L045a;
+        case 0x047f: goto L047f;
+        case 0x048e: goto L048e;
+        case 0x0499: goto L0499;
+        case 0x049f: goto L049f;
+        case 0x04a5: goto L04a5;
+        case 0x04b0: goto L04b0;
+        case 0x04b9: goto L04b9;
+        case 0x04ba: goto L04ba;
+        case 0x04ca: goto L04ca;
+        case 0x04d3: goto L04d3;
+        case 0x04d6: goto L04d6;
+        case 0x04dc: goto L04dc;
+        case 0x04e8: goto L04e8;
+        case 0x04f1: goto L04f1;
+        case 0x04f8: goto L04f8;
+        case 0x04f9: goto L04f9;
+        case 0x0502: goto L0502;
+        case 0x0509: goto L0509;
+        case 0x0512: goto L0512;
+        case 0x0517: goto L0517;
+        case 0x051d: goto L051d;
+        case 0x0524: goto L0524;
+        case 0x0526: goto L0526;
+        case 0x052f: goto L052f;
+        case 0x0538: goto L0538;
+        case 0x053a: goto L053a;
+        case 0x0540: goto L0540;
+        case 0x0543: goto L0543;
+        case 0x0545: goto L0545;
+        case 0x054e: goto L054e;
+        case 0x0555: goto L0555;
+        case 0x055d: goto L055d;
+        case 0x0560: goto L0560;
+        case 0x0563: goto L0563;
+        case 0x0569: goto L0569;
+        case 0x0572: goto L0572;
+        case 0x057b: goto L057b;
+        case 0x0582: goto L0582;
+        case 0x0592: goto L0592;
+        case 0x059b: goto L059b;
+        case 0x05a2: goto L05a2;
+        case 0x05a9: goto L05a9;
+        case 0x05b4: goto L05b4;
+        case 0x05bd: goto L05bd;
+        case 0x05be: goto L05be;
+        case 0x05c2: goto L05c2;
+        case 0x05c8: goto L05c8;
+        case 0x05cb: goto L05cb;
+        case 0x05d4: goto L05d4;
+        case 0x05d7: goto L05d7;
+        case 0x05e0: goto L05e0;
+        case 0x05e3: goto L05e3;
+        case 0x05ea: goto L05ea;
+        case 0x05ed: goto L05ed;
+        case 0x05fd: goto L05fd;
+        case 0x0606: goto L0606;
+        case 0x0609: goto L0609;
+        case 0x0610: goto L0610;
+        case 0x0617: goto L0617;
+        case 0x0622: goto L0622;
+        case 0x062b: goto L062b;
+        case 0x062c: goto L062c;
+        case 0x0631: goto L0631;
+        case 0x063d: goto L063d;
+        case 0x0640: goto L0640;
+        case 0x0652: goto L0652;
+        case 0x0655: goto L0655;
+        case 0x065e: goto L065e;
+        case 0x0668: goto L0668;
+        case 0x066d: goto L066d;
+        case 0x0674: goto L0674;
+        case 0x067a: goto L067a;
+        case 0x0685: goto L0685;
+        case 0x0688: goto L0688;
+        case 0x068b: goto L068b;
+        case 0x068e: goto L068e;
+        case 0x0691: goto L0691;
+        case 0x069c: goto L069c;
+        case 0x06ab: goto L06ab;
+        case 0x06b0: goto L06b0;
+        case 0x06b5: goto L06b5;
+        case 0x06bf: goto L06bf;
+        case 0x06c6: goto L06c6;
+        case 0x06ca: goto L06ca;
+        case 0x06d3: goto L06d3;
+        case 0x06d8: goto L06d8;
+        case 0x06da: goto L06da;
+        case 0x06dd: goto L06dd;
+        case 0x06e7: goto L06e7;
+        case 0x06f3: goto L06f3;
+        case 0x06f8: goto L06f8;
+        case 0x0706: goto L0706;
+        case 0x0713: goto L0713;
+        case 0x0732: goto L0732;
+        case 0x0737: goto L0737;
+        case 0x073c: goto L073c;
+        case 0x0749: goto L0749;
+        case 0x074c: goto L074c;
+        case 0x0751: goto L0751;
+        case 0x0756: goto L0756;
+        case 0x0759: goto L0759;
+        case 0x075e: goto L075e;
+        case 0x0761: goto L0761;
+        case 0x0766: goto L0766;
+        case 0x076c: goto L076c;
+        case 0x076f: goto L076f;
+        case 0x0774: goto L0774;
+        case 0x0777: goto L0777;
+        case 0x077a: goto L077a;
+        case 0x0780: goto L0780;
+        case 0x0788: goto L0788;
+        case 0x078b: goto L078b;
+        case 0x0798: goto L0798;
+        case 0x07b2: goto L07b2;
+        case 0x07b8: goto L07b8;
+        case 0x07bd: goto L07bd;
+        case 0x07c1: goto L07c1;
+        case 0x07d1: goto L07d1;
+        case 0x07e1: goto L07e1;
+        case 0x07ef: goto L07ef;
+        case 0x07f4: goto L07f4;
+        case 0x07fb: goto L07fb;
+        case 0x0800: goto L0800;
+        case 0x0803: goto L0803;
+        case 0x0819: goto L0819;
+        case 0x081c: goto L081c;
+        case 0x0826: goto L0826;
+        case 0x082c: goto L082c;
+        case 0x0833: goto L0833;
+        case 0x0837: goto L0837;
+        case 0x083f: goto L083f;
+        case 0x0842: goto L0842;
+        case 0x084c: goto L084c;
+        case 0x084e: goto L084e;
+        case 0x0851: goto L0851;
+        case 0x0857: goto L0857;
+        case 0x085e: goto L085e;
+        case 0x0864: goto L0864;
+        case 0x086a: goto L086a;
+        case 0x086e: goto L086e;
+        case 0x0877: goto L0877;
+        case 0x087d: goto L087d;
+        case 0x0882: goto L0882;
+        case 0x0888: goto L0888;
+        case 0x088c: goto L088c;
+        case 0x088e: goto L088e;
+        case 0x0891: goto L0891;
+        case 0x08a5: goto L08a5;
+        case 0x08ab: goto L08ab;
+        case 0x08cb: goto L08cb;
+        case 0x08d1: goto L08d1;
+        case 0x08e8: goto L08e8;
+        case 0x08ee: goto L08ee;
+        case 0x08f2: goto L08f2;
+        case 0x08f6: goto L08f6;
+        case 0x08fa: goto L08fa;
+        case 0x08fe: goto L08fe;
+        case 0x0902: goto L0902;
+        case 0x0905: goto L0905;
+        case 0x090b: goto L090b;
+        case 0x0911: goto L0911;
+        case 0x0919: goto L0919;
+        case 0x092e: goto L092e;
+        case 0x0936: goto L0936;
+        case 0x0939: goto L0939;
+        case 0x093f: goto L093f;
+        case 0x094d: goto L094d;
+        case 0x0950: goto L0950;
+        case 0x0953: goto L0953;
+        case 0x096d: goto L096d;
+        case 0x0973: goto L0973;
+        case 0x09a0: goto L09a0;
+        case 0x09a7: goto L09a7;
+        case 0x09b1: goto L09b1;
+        case 0x09b7: goto L09b7;
+        case 0x09bc: goto L09bc;
+        case 0x09cc: goto L09cc;
+        case 0x09d2: goto L09d2;
+        case 0x09f0: goto L09f0;
+        case 0x09fa: goto L09fa;
+        case 0x0a02: goto L0a02;
+        case 0x0a11: goto L0a11;
+        case 0x0a17: goto L0a17;
+        case 0x0a20: goto L0a20;
+        case 0x0a3e: goto L0a3e;
+        case 0x0a44: goto L0a44;
+        case 0x0a6b: goto L0a6b;
+        case 0x0a71: goto L0a71;
+        case 0x0a74: goto L0a74;
+        case 0x0a77: goto L0a77;
+        case 0x0a80: goto L0a80;
+        case 0x0a9b: goto L0a9b;
+        case 0x0a9d: goto L0a9d;
+        case 0x0aa8: goto L0aa8;
+        case 0x0aae: goto L0aae;
+        case 0x0abb: goto L0abb;
+        case 0x0ac0: goto L0ac0;
+        case 0x0ac5: goto L0ac5;
+        case 0x0ad9: goto L0ad9;
+        case 0x0adf: goto L0adf;
+        case 0x0aef: goto L0aef;
+        case 0x0b00: goto L0b00;
+        case 0x0b06: goto L0b06;
+        case 0x0b19: goto L0b19;
+        case 0x0b2c: goto L0b2c;
+        case 0x0b32: goto L0b32;
+        case 0x0b42: goto L0b42;
+        case 0x0b53: goto L0b53;
+        case 0x0b61: goto L0b61;
+        case 0x0b67: goto L0b67;
+        case 0x0b6d: goto L0b6d;
+        case 0x0b7d: goto L0b7d;
+        case 0x0b83: goto L0b83;
+        case 0x0b89: goto L0b89;
+        case 0x0b8f: goto L0b8f;
+        case 0x0b93: goto L0b93;
+        case 0x0b9f: goto L0b9f;
+        case 0x0ba5: goto L0ba5;
+        case 0x0bab: goto L0bab;
+        case 0x0baf: goto L0baf;
+        case 0x0bb7: goto L0bb7;
+        case 0x0bbd: goto L0bbd;
+        case 0x0bc2: goto L0bc2;
+        case 0x0bc8: goto L0bc8;
+        case 0x0bce: goto L0bce;
+        case 0x0bd4: goto L0bd4;
+        case 0x0bda: goto L0bda;
+        case 0x0be4: goto L0be4;
+        case 0x0be9: goto L0be9;
+        case 0x0bec: goto L0bec;
+        case 0x0bf1: goto L0bf1;
+        case 0x0bf8: goto L0bf8;
+        case 0x0bff: goto L0bff;
+        case 0x0c06: goto L0c06;
+        case 0x0c0d: goto L0c0d;
+        case 0x0c17: goto L0c17;
+        case 0x0c27: goto L0c27;
+        case 0x0c32: goto L0c32;
+        case 0x0c37: goto L0c37;
+        case 0x0c41: goto L0c41;
+        case 0x0c4c: goto L0c4c;
+        case 0x0c4e: goto L0c4e;
+        case 0x0c51: goto L0c51;
+        case 0x0c62: goto L0c62;
+        case 0x0c72: goto L0c72;
+        case 0x0c75: goto L0c75;
+        case 0x0c7b: goto L0c7b;
+        case 0x0c82: goto L0c82;
+        case 0x0c92: goto L0c92;
+        case 0x0c99: goto L0c99;
+        case 0x0c9c: goto L0c9c;
+        case 0x0ca2: goto L0ca2;
+        case 0x0ca8: goto L0ca8;
+        case 0x0cb0: goto L0cb0;
+        case 0x0cb6: goto L0cb6;
+        case 0x0cbb: goto L0cbb;
+        case 0x0cbf: goto L0cbf;
+        case 0x0cc5: goto L0cc5;
+        case 0x0ccb: goto L0ccb;
+        case 0x0cd1: goto L0cd1;
+        case 0x0cd7: goto L0cd7;
+        case 0x0cdd: goto L0cdd;
+        case 0x0ce3: goto L0ce3;
+        case 0x0cef: goto L0cef;
+        case 0x0cf2: goto L0cf2;
+        case 0x0cf8: goto L0cf8;
+        case 0x0d0c: goto L0d0c;
+        case 0x0d17: goto L0d17;
+        case 0x0d1b: goto L0d1b;
+        case 0x0d23: goto L0d23;
+        case 0x0d3a: goto L0d3a;
+        case 0x0d46: goto L0d46;
+        case 0x0d4a: goto L0d4a;
+        case 0x0d50: goto L0d50;
+        case 0x0d56: goto L0d56;
+        case 0x0d5d: goto L0d5d;
+        case 0x0d63: goto L0d63;
+        case 0x0d68: goto L0d68;
+        case 0x0d6e: goto L0d6e;
+        case 0x0d72: goto L0d72;
+        case 0x0d78: goto L0d78;
+        case 0x0d7c: goto L0d7c;
+        case 0x0d88: goto L0d88;
+        case 0x0d92: goto L0d92;
+        case 0x0d9c: goto L0d9c;
+        case 0x0da6: goto L0da6;
+        case 0x0db2: goto L0db2;
+        case 0x0db9: goto L0db9;
+        case 0x0dc9: goto L0dc9;
+        case 0x0dd0: goto L0dd0;
+        case 0x0dd3: goto L0dd3;
+        case 0x0dd9: goto L0dd9;
+        case 0x0ddf: goto L0ddf;
+        case 0x0de7: goto L0de7;
+        case 0x0ded: goto L0ded;
+        case 0x0df3: goto L0df3;
+        case 0x0df9: goto L0df9;
+        case 0x0e0d: goto L0e0d;
+        case 0x0e13: goto L0e13;
+        case 0x0e2b: goto L0e2b;
+        case 0x0e3f: goto L0e3f;
+        case 0x0e52: goto L0e52;
+        case 0x0e57: goto L0e57;
+        case 0x0e5d: goto L0e5d;
+        case 0x0e63: goto L0e63;
+        case 0x0e69: goto L0e69;
+        case 0x0e6c: goto L0e6c;
+        case 0x0e74: goto L0e74;
+        case 0x0e77: goto L0e77;
+        case 0x0e7f: goto L0e7f;
+        case 0x0e85: goto L0e85;
+        case 0x0e8c: goto L0e8c;
+        case 0x0e92: goto L0e92;
+        case 0x0e96: goto L0e96;
+        case 0x0eac: goto L0eac;
+        case 0x0eb5: goto L0eb5;
+        case 0x0ebf: goto L0ebf;
+        case 0x0ec6: goto L0ec6;
+        case 0x0eca: goto L0eca;
+        case 0x0ee1: goto L0ee1;
+        case 0x0eea: goto L0eea;
+        case 0x0f02: goto L0f02;
+        case 0x0f08: goto L0f08;
+        case 0x0f0e: goto L0f0e;
+        case 0x0f13: goto L0f13;
+        case 0x0f19: goto L0f19;
+        case 0x0f1e: goto L0f1e;
+        case 0x0f25: goto L0f25;
+        case 0x0f2a: goto L0f2a;
+        case 0x0f41: goto L0f41;
+        case 0x0f49: goto L0f49;
+        case 0x0f69: goto L0f69;
+        case 0x0f7b: goto L0f7b;
+        case 0x0f86: goto L0f86;
+        case 0x0f8b: goto L0f8b;
+        case 0x0f9f: goto L0f9f;
+        case 0x0fa5: goto L0fa5;
+        case 0x0fab: goto L0fab;
+        case 0x0fb1: goto L0fb1;
+        case 0x0fb7: goto L0fb7;
+        case 0x0fbd: goto L0fbd;
+        case 0x0fc5: goto L0fc5;
+        case 0x0fca: goto L0fca;
+        case 0x0fcf: goto L0fcf;
+        case 0x0fd2: goto L0fd2;
+        case 0x0fdd: goto L0fdd;
+        case 0x0fe0: goto L0fe0;
+        case 0x0fe6: goto L0fe6;
+        case 0x0fe9: goto L0fe9;
+        case 0x0ff5: goto L0ff5;
+        case 0x0ff8: goto L0ff8;
+        case 0x0ffe: goto L0ffe;
+        case 0x1004: goto L1004;
+        case 0x100b: goto L100b;
+        case 0x1020: goto L1020;
+        case 0x102e: goto L102e;
+        case 0x1031: goto L1031;
+        case 0x1037: goto L1037;
+        case 0x103a: goto L103a;
+        case 0x1040: goto L1040;
+        case 0x1048: goto L1048;
+        case 0x104e: goto L104e;
+        case 0x105d: goto L105d;
+        case 0x1072: goto L1072;
+        case 0x1080: goto L1080;
+        case 0x1083: goto L1083;
+        case 0x1089: goto L1089;
+        case 0x1090: goto L1090;
+        case 0x10a5: goto L10a5;
+        case 0x10b3: goto L10b3;
+        case 0x10b6: goto L10b6;
+        case 0x10bc: goto L10bc;
+        case 0x10c2: goto L10c2;
+        case 0x10ca: goto L10ca;
+        case 0x10d0: goto L10d0;
+        case 0x10d7: goto L10d7;
+        case 0x10e7: goto L10e7;
+        case 0x10ee: goto L10ee;
+        case 0x10f1: goto L10f1;
+        case 0x10f7: goto L10f7;
+        case 0x10fd: goto L10fd;
+        case 0x1105: goto L1105;
+        case 0x110b: goto L110b;
+        case 0x1110: goto L1110;
+        case 0x1116: goto L1116;
+        case 0x111b: goto L111b;
+        case 0x1122: goto L1122;
+        case 0x1137: goto L1137;
+        case 0x1145: goto L1145;
+        case 0x1148: goto L1148;
+        case 0x114e: goto L114e;
+        case 0x1154: goto L1154;
+        case 0x115b: goto L115b;
+        case 0x1160: goto L1160;
+        case 0x1166: goto L1166;
+        case 0x116c: goto L116c;
+        case 0x1171: goto L1171;
+        case 0x1174: goto L1174;
+        case 0x117b: goto L117b;
+        case 0x118b: goto L118b;
+        case 0x1192: goto L1192;
+        case 0x1195: goto L1195;
+        case 0x119b: goto L119b;
+        case 0x11a1: goto L11a1;
+        case 0x11a8: goto L11a8;
+        case 0x11ad: goto L11ad;
+        case 0x11b0: goto L11b0;
+        case 0x11b3: goto L11b3;
+        case 0x11bb: goto L11bb;
+        case 0x11c5: goto L11c5;
+        case 0x11ce: goto L11ce;
+        case 0x11d2: goto L11d2;
+        case 0x11e2: goto L11e2;
+        case 0x11e8: goto L11e8;
+        case 0x11e9: goto L11e9;
+        case 0x11ec: goto L11ec;
+        case 0x1205: goto L1205;
+        case 0x120b: goto L120b;
+        case 0x1211: goto L1211;
+        case 0x1217: goto L1217;
+        case 0x121d: goto L121d;
+        case 0x1223: goto L1223;
+        case 0x1229: goto L1229;
+        case 0x1239: goto L1239;
+        case 0x123c: goto L123c;
+        case 0x1242: goto L1242;
+        case 0x1245: goto L1245;
+        case 0x124b: goto L124b;
+        case 0x1252: goto L1252;
+        case 0x1257: goto L1257;
+        case 0x125e: goto L125e;
+        case 0x1266: goto L1266;
+        case 0x126d: goto L126d;
+        case 0x127d: goto L127d;
+        case 0x1284: goto L1284;
+        case 0x128c: goto L128c;
+        case 0x1293: goto L1293;
+        case 0x12a3: goto L12a3;
+        case 0x12a9: goto L12a9;
+        case 0x12ad: goto L12ad;
+        case 0x12b3: goto L12b3;
+        case 0x12b9: goto L12b9;
+        case 0x12c9: goto L12c9;
+        case 0x12d7: goto L12d7;
+        case 0x12e1: goto L12e1;
+        case 0x12ec: goto L12ec;
+        case 0x12fa: goto L12fa;
+        case 0x1302: goto L1302;
+        case 0x130d: goto L130d;
+        case 0x1312: goto L1312;
+        case 0x1318: goto L1318;
+        case 0x1327: goto L1327;
+        case 0x1330: goto L1330;
+        case 0x1333: goto L1333;
+        case 0x133a: goto L133a;
+        case 0x1348: goto L1348;
+        case 0x1352: goto L1352;
+        case 0x135d: goto L135d;
+        case 0x136b: goto L136b;
+        case 0x1372: goto L1372;
+        case 0x137d: goto L137d;
+        case 0x138a: goto L138a;
+        case 0x13a8: goto L13a8;
+        case 0x13af: goto L13af;
+        case 0x13bd: goto L13bd;
+        case 0x13c7: goto L13c7;
+        case 0x13d1: goto L13d1;
+        case 0x13dd: goto L13dd;
+        case 0x13e4: goto L13e4;
+        case 0x13f5: goto L13f5;
+        case 0x13fc: goto L13fc;
+        case 0x13fe: goto L13fe;
+        case 0x1401: goto L1401;
+        case 0x1418: goto L1418;
+        case 0x1429: goto L1429;
+        case 0x1433: goto L1433;
+        case 0x1439: goto L1439;
+        case 0x144b: goto L144b;
+        case 0x1450: goto L1450;
+        case 0x1455: goto L1455;
+        case 0x145c: goto L145c;
+        case 0x145f: goto L145f;
+        case 0x1471: goto L1471;
+        case 0x1476: goto L1476;
+        case 0x1481: goto L1481;
+        case 0x1483: goto L1483;
+        case 0x1499: goto L1499;
+        case 0x149f: goto L149f;
+        case 0x14a7: goto L14a7;
+        case 0x14ad: goto L14ad;
+        case 0x14af: goto L14af;
+        case 0x14b6: goto L14b6;
+        case 0x14c2: goto L14c2;
+        case 0x14cd: goto L14cd;
+        case 0x14d4: goto L14d4;
+        case 0x14d5: goto L14d5;
+        case 0x14d7: goto L14d7;
+        case 0x14dd: goto L14dd;
+        case 0x14e0: goto L14e0;
+        case 0x14e2: goto L14e2;
+        case 0x14e4: goto L14e4;
+        case 0x14e7: goto L14e7;
+        case 0x14e8: goto L14e8;
+        case 0x14ec: goto L14ec;
+        case 0x14ff: goto L14ff;
+        case 0x1500: goto L1500;
+        case 0x1507: goto L1507;
+        case 0x1518: goto L1518;
+        case 0x152f: goto L152f;
+        case 0x1539: goto L1539;
+        case 0x153d: goto L153d;
+        case 0x1542: goto L1542;
+        case 0x1546: goto L1546;
+        case 0x1559: goto L1559;
+        case 0x1561: goto L1561;
+        case 0x1564: goto L1564;
+        case 0x1572: goto L1572;
+        case 0x1577: goto L1577;
+        case 0x157c: goto L157c;
+        case 0x1582: goto L1582;
+        case 0x1585: goto L1585;
+        case 0x1598: goto L1598;
+        case 0x15a3: goto L15a3;
+        case 0x15aa: goto L15aa;
+        case 0x15b1: goto L15b1;
+        case 0x15b9: goto L15b9;
+        case 0x15be: goto L15be;
+        case 0x15d7: goto L15d7;
+        case 0x15e0: goto L15e0;
+        case 0x15e4: goto L15e4;
+        case 0x15f6: goto L15f6;
+        case 0x15fa: goto L15fa;
+        case 0x1602: goto L1602;
+        case 0x1611: goto L1611;
+        case 0x1617: goto L1617;
+        case 0x1620: goto L1620;
+        case 0x1626: goto L1626;
+        case 0x162a: goto L162a;
+        case 0x1631: goto L1631;
+        case 0x1637: goto L1637;
+        case 0x163c: goto L163c;
+        case 0x1642: goto L1642;
+        case 0x1644: goto L1644;
+        case 0x1733: goto L1733;
+        case 0x1745: goto L1745;
+        case 0x174b: goto L174b;
+        case 0x174f: goto L174f;
+        case 0x1754: goto L1754;
+        case 0x175a: goto L175a;
+        case 0x1763: goto L1763;
+        case 0x176a: goto L176a;
+        case 0x1771: goto L1771;
+        case 0x1775: goto L1775;
+        case 0x177d: goto L177d;
+        case 0x178a: goto L178a;
+        case 0x178e: goto L178e;
+        case 0x1796: goto L1796;
+        case 0x17a6: goto L17a6;
+        case 0x17a9: goto L17a9;
+        case 0x17b7: goto L17b7;
+        case 0x17bf: goto L17bf;
+        case 0x17c2: goto L17c2;
+        case 0x17c5: goto L17c5;
+        case 0x17d3: goto L17d3;
+        case 0x17dc: goto L17dc;
+        case 0x17e0: goto L17e0;
+        case 0x17fa: goto L17fa;
+        case 0x1801: goto L1801;
+        case 0x1806: goto L1806;
+        case 0x180f: goto L180f;
+        case 0x1812: goto L1812;
+        case 0x182a: goto L182a;
+        case 0x182e: goto L182e;
+        case 0x1834: goto L1834;
+        case 0x1838: goto L1838;
+        case 0x183d: goto L183d;
+        case 0x1841: goto L1841;
+        case 0x1846: goto L1846;
+        case 0x184a: goto L184a;
+        case 0x184d: goto L184d;
+        case 0x1850: goto L1850;
+        case 0x185a: goto L185a;
+        case 0x1872: goto L1872;
+        case 0x187f: goto L187f;
+        case 0x1881: goto L1881;
+        case 0x1884: goto L1884;
+        case 0x1894: goto L1894;
+        case 0x189c: goto L189c;
+        case 0x189d: goto L189d;
+        case 0x18a2: goto L18a2;
+        case 0x18b2: goto L18b2;
+        case 0x1a2a: goto L1a2a;
+        case 0x1a35: goto L1a35;
+        case 0x1a3c: goto L1a3c;
+        case 0x1a63: goto L1a63;
+        case 0x1a69: goto L1a69;
+        case 0x1a80: goto L1a80;
+        case 0x1a85: goto L1a85;
+        case 0x1a8b: goto L1a8b;
+        case 0x1a8f: goto L1a8f;
+        case 0x1a92: goto L1a92;
+        case 0x1a96: goto L1a96;
+        case 0x1a9d: goto L1a9d;
+        case 0x1a9f: goto L1a9f;
+        case 0x1aa3: goto L1aa3;
+        case 0x1ab1: goto L1ab1;
+        case 0x1abe: goto L1abe;
+        case 0x1ac5: goto L1ac5;
+        case 0x1ad2: goto L1ad2;
+        case 0x1adc: goto L1adc;
+        case 0x1ade: goto L1ade;
+        case 0x1ae3: goto L1ae3;
+        case 0x1ae5: goto L1ae5;
+        case 0x1ae7: goto L1ae7;
+        case 0x1aef: goto L1aef;
+        case 0x1af1: goto L1af1;
+        case 0x1af4: goto L1af4;
+        case 0x1af7: goto L1af7;
+        case 0x1af8: goto L1af8;
+        case 0x1af9: goto L1af9;
+        case 0x1b01: goto L1b01;
+        case 0x1b0f: goto L1b0f;
+        case 0x1b1e: goto L1b1e;
+        case 0x1b27: goto L1b27;
+        case 0x1b34: goto L1b34;
+        case 0x1b3e: goto L1b3e;
+        case 0x1b40: goto L1b40;
+        case 0x1b45: goto L1b45;
+        case 0x1b47: goto L1b47;
+        case 0x1b49: goto L1b49;
+        case 0x1b51: goto L1b51;
+        case 0x1b53: goto L1b53;
+        case 0x1b56: goto L1b56;
+        case 0x1b8e: goto L1b8e;
+        case 0x1b98: goto L1b98;
+        case 0x1b9b: goto L1b9b;
+        case 0x1b9d: goto L1b9d;
+        case 0x1ba9: goto L1ba9;
+        case 0x1bac: goto L1bac;
+        case 0x1bb3: goto L1bb3;
+        case 0x1bc0: goto L1bc0;
+        case 0x1bc4: goto L1bc4;
+        case 0x1bcc: goto L1bcc;
+        case 0x1bdf: goto L1bdf;
+        case 0x1be2: goto L1be2;
+        case 0x1be4: goto L1be4;
+        case 0x1c15: goto L1c15;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: xor bp, bp
+    {
+        val = int16_t(r[5]) ^ int16_t(r[5]);
+        r[5] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0002, L0002);
+L0002:
+    AOT_BLOCK(0x0002, 1);
+    // 0002: mov bx, sp
+    {
+        r[3] = r[4];
+    }
+    AOT_GOTO(0x0004, L0004);
+L0004:
+    AOT_BLOCK(0x0004, 1);
+    // 0004: mov ax, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x0006, L0006);
+L0006:
+    AOT_BLOCK(0x0006, 2);
+    // 0006: lea dx, [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        r[2] = a;
+    }
+    // 0009: lea cx, [bx+4]
+    {
+        a = uint16_t(r[3] + 4);
+        r[1] = a;
+    }
+    AOT_GOTO(0x000c, L000c);
+L000c:
+    AOT_BLOCK(0x000c, 2);
+    // 000c: add cx, ax
+    {
+        val = (dst = int16_t(r[1])) + (src = int16_t(r[0]));
+        r[1] = val;
+    }
+    // 000e: add cx, ax
+    {
+        val = (dst = int16_t(r[1])) + (src = int16_t(r[0]));
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x0010, L0010);
+L0010:
+    AOT_BLOCK(0x0010, 1);
+    // 0010: mov bx, 028c
+    {
+        r[3] = 0x028c;
+    }
+    AOT_GOTO(0x0013, L0013);
+L0013:
+    AOT_BLOCK(0x0013, 2);
+    // 0013: cmp bx, 0490
+    {
+        val = (dst = int16_t(r[3])) - (src = 1168);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0017: jnb 0028
+    if (!CF)
+        AOT_GOTO(0x0028, L0028);
+    AOT_GOTO(0x0019, L0019);
+L0019:
+    AOT_BLOCK(0x0019, 1);
+    // 0019: test bl, 1
+    {
+        val = int8_t(r[3]) & 1;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x001c, L001c);
+L001c:
+    AOT_BLOCK(0x001c, 1);
+    // 001c: jne 0028
+    if (!ZF)
+        AOT_GOTO(0x0028, L0028);
+    AOT_GOTO(0x001e, L001e);
+L001e:
+    AOT_BLOCK(0x001e, 2);
+    // 001e: cmp [bx], 5353
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(RD16(a))) - (src = 21331);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0022: jne 0028
+    if (!ZF)
+        AOT_GOTO(0x0028, L0028);
+    AOT_GOTO(0x0024, L0024);
+L0024:
+    AOT_BLOCK(0x0024, 1);
+    // 0024: mov [0002], bx
+    {
+        a = 0x0002;
+        WR16(a, r[3]);
+    }
+    AOT_GOTO(0x0028, L0028);
+L0028:
+    AOT_BLOCK(0x0028, 1);
+    // 0028: mov bx, [0002]
+    {
+        a = 0x0002;
+        r[3] = RD16(a);
+    }
+    AOT_GOTO(0x002c, L002c);
+L002c:
+    AOT_BLOCK(0x002c, 3);
+    // 002c: mov [bx], cx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[1]);
+    }
+    // 002e: push cx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[1]);
+    }
+    // 002f: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    AOT_GOTO(0x0030, L0030);
+L0030:
+    AOT_BLOCK(0x0030, 2);
+    // 0030: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0031: call 0039
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0034);
+    }
+    AOT_GOTO(0x0039, L0039);
+L0034:
+    AOT_BLOCK(0x0034, 2);
+    // 0034: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0035: call 0851
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0038);
+    }
+    AOT_GOTO(0x0851, L0851);
+L0038:
+    // 0038: hlt
+    AOT_INTERP(0x0038);
+L0039:
+    AOT_BLOCK(0x0039, 2);
+    // 0039: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 003a: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    AOT_GOTO(0x003c, L003c);
+L003c:
+    AOT_BLOCK(0x003c, 4);
+    // 003c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 003d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 003e: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 003f: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    AOT_GOTO(0x0040, L0040);
+L0040:
+    AOT_BLOCK(0x0040, 4);
+    // 0040: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 0043: mov si, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[6] = RD16(a);
+    }
+    // 0046: cmp di, 3
+    {
+        val = (dst = int16_t(r[7])) - (src = 3);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0049: jne 0065
+    if (!ZF)
+        AOT_GOTO(0x0065, L0065);
+    AOT_GOTO(0x004b, L004b);
+L004b:
+    AOT_BLOCK(0x004b, 3);
+    // 004b: mov ax, 00be
+    {
+        r[0] = 0x00be;
+    }
+    // 004e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 004f: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x0052, L0052);
+L0052:
+    AOT_BLOCK(0x0052, 1);
+    // 0052: call 0905
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0055);
+    }
+    AOT_GOTO(0x0905, L0905);
+L0055:
+    AOT_BLOCK(0x0055, 4);
+    // 0055: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0056: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0057: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0059: jne 0065
+    if (!ZF)
+        AOT_GOTO(0x0065, L0065);
+    AOT_GOTO(0x005b, L005b);
+L005b:
+    AOT_BLOCK(0x005b, 2);
+    // 005b: mov [e35e], 0001
+    {
+        a = 0xe35e;
+        WR16(a, 0x0001);
+    }
+    // 0061: dec di
+    {
+        val = int16_t(r[7]) - 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x0062, L0062);
+L0062:
+    AOT_BLOCK(0x0062, 1);
+    // 0062: add si, 2
+    {
+        val = (dst = int16_t(r[6])) + (src = 2);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x0065, L0065);
+L0065:
+    AOT_BLOCK(0x0065, 1);
+    // 0065: cmp di, 2
+    {
+        val = (dst = int16_t(r[7])) - (src = 2);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    AOT_GOTO(0x0068, L0068);
+L0068:
+    AOT_BLOCK(0x0068, 1);
+    // 0068: je 007f
+    if (ZF)
+        AOT_GOTO(0x007f, L007f);
+    AOT_GOTO(0x006a, L006a);
+L006a:
+    AOT_BLOCK(0x006a, 2);
+    // 006a: mov ax, 00ac
+    {
+        r[0] = 0x00ac;
+    }
+    // 006d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x006e, L006e);
+L006e:
+    AOT_BLOCK(0x006e, 2);
+    // 006e: mov ax, 02a6
+    {
+        r[0] = 0x02a6;
+    }
+    // 0071: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x0072, L0072);
+L0072:
+    AOT_BLOCK(0x0072, 1);
+    // 0072: call 08d1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0075);
+    }
+    AOT_GOTO(0x08d1, L08d1);
+L0075:
+    AOT_BLOCK(0x0075, 3);
+    // 0075: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0076: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0077: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    AOT_GOTO(0x007a, L007a);
+L007a:
+    AOT_BLOCK(0x007a, 2);
+    // 007a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 007b: call 0851
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x007e);
+    }
+    AOT_GOTO(0x0851, L0851);
+L007e:
+    AOT_BLOCK(0x007e, 1);
+    // 007e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x007f, L007f);
+L007f:
+    AOT_BLOCK(0x007f, 2);
+    // 007f: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0081: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x0082, L0082);
+L0082:
+    AOT_BLOCK(0x0082, 2);
+    // 0082: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0085: call 08f6
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0088);
+    }
+    AOT_GOTO(0x08f6, L08f6);
+L0088:
+    AOT_BLOCK(0x0088, 6);
+    // 0088: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0089: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 008a: mov [e35a], ax
+    {
+        WR16(0xe35a, r[0]);
+    }
+    // 008d: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0090: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0091: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x0094, L0094);
+L0094:
+    AOT_BLOCK(0x0094, 1);
+    // 0094: call 08f6
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0097);
+    }
+    AOT_GOTO(0x08f6, L08f6);
+L0097:
+    AOT_BLOCK(0x0097, 5);
+    // 0097: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0098: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0099: mov [e35c], ax
+    {
+        WR16(0xe35c, r[0]);
+    }
+    // 009c: cmp [e35a], 0
+    {
+        a = 0xe35a;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 00a1: jl 00aa
+    if (SF != OF)
+        AOT_GOTO(0x00aa, L00aa);
+    AOT_GOTO(0x00a3, L00a3);
+L00a3:
+    AOT_BLOCK(0x00a3, 2);
+    // 00a3: cmp [e35c], 0
+    {
+        a = 0xe35c;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 00a8: jnl 00c3
+    if (SF == OF)
+        AOT_GOTO(0x00c3, L00c3);
+    AOT_GOTO(0x00aa, L00aa);
+L00aa:
+    AOT_BLOCK(0x00aa, 6);
+    // 00aa: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 00ad: mov ax, 0094
+    {
+        r[0] = 0x0094;
+    }
+    // 00b0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00b1: mov ax, 02a6
+    {
+        r[0] = 0x02a6;
+    }
+    // 00b4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00b5: call 08d1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00b8);
+    }
+    AOT_GOTO(0x08d1, L08d1);
+L00b8:
+    AOT_BLOCK(0x00b8, 2);
+    // 00b8: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 00bb: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    AOT_GOTO(0x00be, L00be);
+L00be:
+    AOT_BLOCK(0x00be, 2);
+    // 00be: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00bf: call 0851
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00c2);
+    }
+    AOT_GOTO(0x0851, L0851);
+L00c2:
+    AOT_BLOCK(0x00c2, 1);
+    // 00c2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x00c3, L00c3);
+L00c3:
+    AOT_BLOCK(0x00c3, 3);
+    // 00c3: mov ax, 008e
+    {
+        r[0] = 0x008e;
+    }
+    // 00c6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00c7: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00ca);
+    }
+    AOT_GOTO(0x037d, L037d);
+L00ca:
+    AOT_BLOCK(0x00ca, 4);
+    // 00ca: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00cb: mov ax, 0088
+    {
+        r[0] = 0x0088;
+    }
+    // 00ce: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00cf: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00d2);
+    }
+    AOT_GOTO(0x037d, L037d);
+L00d2:
+    AOT_BLOCK(0x00d2, 4);
+    // 00d2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00d3: mov ax, 0082
+    {
+        r[0] = 0x0082;
+    }
+    // 00d6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00d7: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00da);
+    }
+    AOT_GOTO(0x037d, L037d);
+L00da:
+    AOT_BLOCK(0x00da, 4);
+    // 00da: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00db: mov ax, 007a
+    {
+        r[0] = 0x007a;
+    }
+    // 00de: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00df: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00e2);
+    }
+    AOT_GOTO(0x037d, L037d);
+L00e2:
+    AOT_BLOCK(0x00e2, 4);
+    // 00e2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00e3: mov ax, 0074
+    {
+        r[0] = 0x0074;
+    }
+    // 00e6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00e7: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00ea);
+    }
+    AOT_GOTO(0x037d, L037d);
+L00ea:
+    AOT_BLOCK(0x00ea, 4);
+    // 00ea: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00eb: mov ax, 006c
+    {
+        r[0] = 0x006c;
+    }
+    // 00ee: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00ef: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00f2);
+    }
+    AOT_GOTO(0x037d, L037d);
+L00f2:
+    AOT_BLOCK(0x00f2, 4);
+    // 00f2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00f3: mov ax, 0066
+    {
+        r[0] = 0x0066;
+    }
+    // 00f6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00f7: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x00fa);
+    }
+    AOT_GOTO(0x037d, L037d);
+L00fa:
+    AOT_BLOCK(0x00fa, 4);
+    // 00fa: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 00fb: mov ax, 0062
+    {
+        r[0] = 0x0062;
+    }
+    // 00fe: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 00ff: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0102);
+    }
+    AOT_GOTO(0x037d, L037d);
+L0102:
+    AOT_BLOCK(0x0102, 4);
+    // 0102: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0103: mov ax, 005c
+    {
+        r[0] = 0x005c;
+    }
+    // 0106: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0107: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x010a);
+    }
+    AOT_GOTO(0x037d, L037d);
+L010a:
+    AOT_BLOCK(0x010a, 4);
+    // 010a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 010b: mov ax, 0052
+    {
+        r[0] = 0x0052;
+    }
+    // 010e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 010f: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0112);
+    }
+    AOT_GOTO(0x037d, L037d);
+L0112:
+    AOT_BLOCK(0x0112, 4);
+    // 0112: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0113: mov ax, 004c
+    {
+        r[0] = 0x004c;
+    }
+    // 0116: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0117: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x011a);
+    }
+    AOT_GOTO(0x037d, L037d);
+L011a:
+    AOT_BLOCK(0x011a, 4);
+    // 011a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 011b: mov ax, 0044
+    {
+        r[0] = 0x0044;
+    }
+    // 011e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 011f: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0122);
+    }
+    AOT_GOTO(0x037d, L037d);
+L0122:
+    AOT_BLOCK(0x0122, 4);
+    // 0122: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0123: mov ax, 003c
+    {
+        r[0] = 0x003c;
+    }
+    // 0126: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0127: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x012a);
+    }
+    AOT_GOTO(0x037d, L037d);
+L012a:
+    AOT_BLOCK(0x012a, 4);
+    // 012a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 012b: mov ax, 0034
+    {
+        r[0] = 0x0034;
+    }
+    // 012e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 012f: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0132);
+    }
+    AOT_GOTO(0x037d, L037d);
+L0132:
+    AOT_BLOCK(0x0132, 4);
+    // 0132: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0133: mov ax, 002c
+    {
+        r[0] = 0x002c;
+    }
+    // 0136: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0137: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x013a);
+    }
+    AOT_GOTO(0x037d, L037d);
+L013a:
+    AOT_BLOCK(0x013a, 4);
+    // 013a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 013b: mov ax, 0026
+    {
+        r[0] = 0x0026;
+    }
+    // 013e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 013f: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0142);
+    }
+    AOT_GOTO(0x037d, L037d);
+L0142:
+    AOT_BLOCK(0x0142, 4);
+    // 0142: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0143: mov ax, 001c
+    {
+        r[0] = 0x001c;
+    }
+    // 0146: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0147: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x014a);
+    }
+    AOT_GOTO(0x037d, L037d);
+L014a:
+    AOT_BLOCK(0x014a, 4);
+    // 014a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 014b: mov ax, 0016
+    {
+        r[0] = 0x0016;
+    }
+    // 014e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 014f: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0152);
+    }
+    AOT_GOTO(0x037d, L037d);
+L0152:
+    AOT_BLOCK(0x0152, 4);
+    // 0152: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0153: mov ax, 000c
+    {
+        r[0] = 0x000c;
+    }
+    // 0156: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0157: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x015a);
+    }
+    AOT_GOTO(0x037d, L037d);
+L015a:
+    AOT_BLOCK(0x015a, 4);
+    // 015a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 015b: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 015e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 015f: call 0437
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0162);
+    }
+    AOT_GOTO(0x0437, L0437);
+L0162:
+    AOT_BLOCK(0x0162, 4);
+    // 0162: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0163: mov ax, 0002
+    {
+        r[0] = 0x0002;
+    }
+    // 0166: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0167: call 0437
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x016a);
+    }
+    AOT_GOTO(0x0437, L0437);
+L016a:
+    AOT_BLOCK(0x016a, 4);
+    // 016a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 016b: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 016d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 016e: call 0851
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0171);
+    }
+    AOT_GOTO(0x0851, L0851);
+L0171:
+    AOT_BLOCK(0x0171, 2);
+    // 0171: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0172: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L0175:
+    AOT_BLOCK(0x0175, 12);
+    // 0175: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0176: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0178: sub sp, e
+    {
+        val = (dst = int16_t(r[4])) - (src = 14);
+        r[4] = val;
+    }
+    // 017b: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 017c: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 017d: mov dx, [0006]
+    {
+        a = 0x0006;
+        r[2] = RD16(a);
+    }
+    // 0181: mov [e34a], dx
+    {
+        a = 0xe34a;
+        WR16(a, r[2]);
+    }
+    // 0185: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 0189: mov cl, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 018b: mov [bp-9], cl
+    {
+        a = uint16_t(r[5] - 9);
+        WR8(a, uint8_t(r[1]));
+    }
+    // 018e: cmp byte [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0191: jne 0196
+    if (!ZF)
+        AOT_GOTO(0x0196, L0196);
+    AOT_GOTO(0x0193, L0193);
+L0193:
+    AOT_BLOCK(0x0193, 1);
+    // 0193: jmp 037a
+    AOT_GOTO(0x037a, L037a);
+L0196:
+    AOT_BLOCK(0x0196, 2);
+    // 0196: cmp byte [bx], 3b
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 59);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0199: jne 01a6
+    if (!ZF)
+        AOT_GOTO(0x01a6, L01a6);
+    AOT_GOTO(0x019b, L019b);
+L019b:
+    AOT_BLOCK(0x019b, 2);
+    // 019b: cmp [0008], 0
+    {
+        a = 0x0008;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 01a0: jne 01a6
+    if (!ZF)
+        AOT_GOTO(0x01a6, L01a6);
+    AOT_GOTO(0x01a2, L01a2);
+L01a2:
+    AOT_BLOCK(0x01a2, 1);
+    // 01a2: mov [e34e], bx
+    {
+        a = 0xe34e;
+        WR16(a, r[3]);
+    }
+    AOT_GOTO(0x01a6, L01a6);
+L01a6:
+    AOT_BLOCK(0x01a6, 3);
+    // 01a6: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 01aa: cmp byte [bx], 7d
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 125);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 01ad: jne 01ba
+    if (!ZF)
+        AOT_GOTO(0x01ba, L01ba);
+    AOT_GOTO(0x01af, L01af);
+L01af:
+    AOT_BLOCK(0x01af, 2);
+    // 01af: cmp [0008], 0
+    {
+        a = 0x0008;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 01b4: jne 01ba
+    if (!ZF)
+        AOT_GOTO(0x01ba, L01ba);
+    AOT_GOTO(0x01b6, L01b6);
+L01b6:
+    AOT_BLOCK(0x01b6, 1);
+    // 01b6: mov [e34e], bx
+    {
+        a = 0xe34e;
+        WR16(a, r[3]);
+    }
+    AOT_GOTO(0x01ba, L01ba);
+L01ba:
+    AOT_BLOCK(0x01ba, 2);
+    // 01ba: cmp [000a], 0
+    {
+        a = 0x000a;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 01bf: je 01c9
+    if (ZF)
+        AOT_GOTO(0x01c9, L01c9);
+    AOT_GOTO(0x01c1, L01c1);
+L01c1:
+    AOT_BLOCK(0x01c1, 2);
+    // 01c1: mov dx, [0006]
+    {
+        a = 0x0006;
+        r[2] = RD16(a);
+    }
+    // 01c5: mov [e34e], dx
+    {
+        a = 0xe34e;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x01c9, L01c9);
+L01c9:
+    AOT_BLOCK(0x01c9, 3);
+    // 01c9: mov dx, [e34e]
+    {
+        a = 0xe34e;
+        r[2] = RD16(a);
+    }
+    // 01cd: cmp [e34c], dx
+    {
+        a = 0xe34c;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 01d1: jnb 01d7
+    if (!CF)
+        AOT_GOTO(0x01d7, L01d7);
+    AOT_GOTO(0x01d3, L01d3);
+L01d3:
+    AOT_BLOCK(0x01d3, 1);
+    // 01d3: mov [e34c], dx
+    {
+        a = 0xe34c;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x01d7, L01d7);
+L01d7:
+    AOT_BLOCK(0x01d7, 5);
+    // 01d7: mov al, [bp-9]
+    {
+        a = uint16_t(r[5] - 9);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 01da: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 01db: mov bx, ax
+    {
+        r[3] = r[0];
+    }
+    // 01dd: test byte [bx+187], 7
+    {
+        a = uint16_t(r[3] + 391);
+        val = int8_t(RD8(a)) & 7;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 01e2: jne 01ea
+    if (!ZF)
+        AOT_GOTO(0x01ea, L01ea);
+    AOT_GOTO(0x01e4, L01e4);
+L01e4:
+    AOT_BLOCK(0x01e4, 2);
+    // 01e4: cmp byte [bp-9], 5f
+    {
+        a = uint16_t(r[5] - 9);
+        val = (dst = int8_t(RD8(a))) - (src = 95);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 01e8: jne 0209
+    if (!ZF)
+        AOT_GOTO(0x0209, L0209);
+    AOT_GOTO(0x01ea, L01ea);
+L01ea:
+    AOT_BLOCK(0x01ea, 6);
+    // 01ea: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 01ee: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 01f0: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 01f1: mov bx, ax
+    {
+        r[3] = r[0];
+    }
+    // 01f3: test byte [bx+187], 7
+    {
+        a = uint16_t(r[3] + 391);
+        val = int8_t(RD8(a)) & 7;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 01f8: jne 0203
+    if (!ZF)
+        AOT_GOTO(0x0203, L0203);
+    AOT_GOTO(0x01fa, L01fa);
+L01fa:
+    AOT_BLOCK(0x01fa, 3);
+    // 01fa: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 01fe: cmp byte [bx], 5f
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 95);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0201: jne 024e
+    if (!ZF)
+        AOT_GOTO(0x024e, L024e);
+    AOT_GOTO(0x0203, L0203);
+L0203:
+    AOT_BLOCK(0x0203, 2);
+    // 0203: inc [0006]
+    {
+        a = 0x0006;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0207: jmp short 01ea
+    AOT_GOTO(0x01ea, L01ea);
+L0209:
+    AOT_BLOCK(0x0209, 2);
+    // 0209: cmp byte [bp-9], 22
+    {
+        a = uint16_t(r[5] - 9);
+        val = (dst = int8_t(RD8(a))) - (src = 34);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 020d: je 0215
+    if (ZF)
+        AOT_GOTO(0x0215, L0215);
+    AOT_GOTO(0x020f, L020f);
+L020f:
+    AOT_BLOCK(0x020f, 2);
+    // 020f: cmp byte [bp-9], 27
+    {
+        a = uint16_t(r[5] - 9);
+        val = (dst = int8_t(RD8(a))) - (src = 39);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0213: jne 024a
+    if (!ZF)
+        AOT_GOTO(0x024a, L024a);
+    AOT_GOTO(0x0215, L0215);
+L0215:
+    AOT_BLOCK(0x0215, 3);
+    // 0215: mov cl, [bp-9]
+    {
+        a = uint16_t(r[5] - 9);
+        r[1] = (r[1] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0218: mov [bp-d], cl
+    {
+        a = uint16_t(r[5] - 13);
+        WR8(a, uint8_t(r[1]));
+    }
+    // 021b: inc [0006]
+    {
+        a = 0x0006;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x021f, L021f);
+L021f:
+    AOT_BLOCK(0x021f, 3);
+    // 021f: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 0223: cmp byte [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0226: je 0244
+    if (ZF)
+        AOT_GOTO(0x0244, L0244);
+    AOT_GOTO(0x0228, L0228);
+L0228:
+    AOT_BLOCK(0x0228, 7);
+    // 0228: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 022a: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 022b: mov cx, ax
+    {
+        r[1] = r[0];
+    }
+    // 022d: mov al, [bp-d]
+    {
+        a = uint16_t(r[5] - 13);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0230: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0231: cmp cx, ax
+    {
+        val = (dst = int16_t(r[1])) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0233: je 0244
+    if (ZF)
+        AOT_GOTO(0x0244, L0244);
+    AOT_GOTO(0x0235, L0235);
+L0235:
+    AOT_BLOCK(0x0235, 3);
+    // 0235: inc [0006]
+    {
+        a = 0x0006;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 0239: cmp byte [bx], 5c
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 92);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 023c: jne 021f
+    if (!ZF)
+        AOT_GOTO(0x021f, L021f);
+    AOT_GOTO(0x023e, L023e);
+L023e:
+    AOT_BLOCK(0x023e, 2);
+    // 023e: inc [0006]
+    {
+        a = 0x0006;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0242: jmp short 021f
+    AOT_GOTO(0x021f, L021f);
+L0244:
+    AOT_BLOCK(0x0244, 2);
+    // 0244: inc [0006]
+    {
+        a = 0x0006;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0248: jmp short 024e
+    AOT_GOTO(0x024e, L024e);
+L024a:
+    AOT_BLOCK(0x024a, 1);
+    // 024a: inc [0006]
+    {
+        a = 0x0006;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x024e, L024e);
+L024e:
+    AOT_BLOCK(0x024e, 6);
+    // 024e: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 0252: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0254: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0255: mov bx, ax
+    {
+        r[3] = r[0];
+    }
+    // 0257: test byte [bx+187], 8
+    {
+        a = uint16_t(r[3] + 391);
+        val = int8_t(RD8(a)) & 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 025c: je 0264
+    if (ZF)
+        AOT_GOTO(0x0264, L0264);
+    AOT_GOTO(0x025e, L025e);
+L025e:
+    AOT_BLOCK(0x025e, 2);
+    // 025e: inc [0006]
+    {
+        a = 0x0006;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0262: jmp short 024e
+    AOT_GOTO(0x024e, L024e);
+L0264:
+    AOT_BLOCK(0x0264, 3);
+    // 0264: mov dx, [e350]
+    {
+        a = 0xe350;
+        r[2] = RD16(a);
+    }
+    // 0268: cmp [0006], dx
+    {
+        a = 0x0006;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 026c: jbe 0283
+    if (CF || ZF)
+        AOT_GOTO(0x0283, L0283);
+    AOT_GOTO(0x026e, L026e);
+L026e:
+    AOT_BLOCK(0x026e, 5);
+    // 026e: mov ax, 00ea
+    {
+        r[0] = 0x00ea;
+    }
+    // 0271: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0272: mov ax, 02a6
+    {
+        r[0] = 0x02a6;
+    }
+    // 0275: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0276: call 08d1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0279);
+    }
+    AOT_GOTO(0x08d1, L08d1);
+L0279:
+    AOT_BLOCK(0x0279, 5);
+    // 0279: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 027a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 027b: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 027e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 027f: call 0851
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0282);
+    }
+    AOT_GOTO(0x0851, L0851);
+L0282:
+    AOT_BLOCK(0x0282, 1);
+    // 0282: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x0283, L0283);
+L0283:
+    AOT_BLOCK(0x0283, 3);
+    // 0283: mov dx, [e350]
+    {
+        a = 0xe350;
+        r[2] = RD16(a);
+    }
+    // 0287: sub dx, [0006]
+    {
+        a = 0x0006;
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 028b: mov [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x028e, L028e);
+L028e:
+    AOT_BLOCK(0x028e, 2);
+    // 028e: cmp dx, 00c8
+    {
+        val = (dst = int16_t(r[2])) - (src = 200);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0292: jle 0297
+    if (ZF || SF != OF)
+        AOT_GOTO(0x0297, L0297);
+    AOT_GOTO(0x0294, L0294);
+L0294:
+    AOT_BLOCK(0x0294, 1);
+    // 0294: jmp 037a
+    AOT_GOTO(0x037a, L037a);
+L0297:
+    AOT_BLOCK(0x0297, 2);
+    // 0297: cmp [e358], 0
+    {
+        a = 0xe358;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 029c: je 02a1
+    if (ZF)
+        AOT_GOTO(0x02a1, L02a1);
+    AOT_GOTO(0x029e, L029e);
+L029e:
+    AOT_BLOCK(0x029e, 1);
+    // 029e: jmp 037a
+    AOT_GOTO(0x037a, L037a);
+L02a1:
+    AOT_BLOCK(0x02a1, 3);
+    // 02a1: mov si, [0006]
+    {
+        a = 0x0006;
+        r[6] = RD16(a);
+    }
+    // 02a5: cmp [e34a], si
+    {
+        a = 0xe34a;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 02a9: jnb 02af
+    if (!CF)
+        AOT_GOTO(0x02af, L02af);
+    AOT_GOTO(0x02ab, L02ab);
+L02ab:
+    AOT_BLOCK(0x02ab, 1);
+    // 02ab: mov si, [e34a]
+    {
+        a = 0xe34a;
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x02af, L02af);
+L02af:
+    AOT_BLOCK(0x02af, 2);
+    // 02af: cmp [e34e], si
+    {
+        a = 0xe34e;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 02b3: jnb 02b9
+    if (!CF)
+        AOT_GOTO(0x02b9, L02b9);
+    AOT_GOTO(0x02b5, L02b5);
+L02b5:
+    AOT_BLOCK(0x02b5, 1);
+    // 02b5: mov si, [e34e]
+    {
+        a = 0xe34e;
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x02b9, L02b9);
+L02b9:
+    AOT_BLOCK(0x02b9, 2);
+    // 02b9: cmp si, 04b0
+    {
+        val = (dst = int16_t(r[6])) - (src = 1200);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 02bd: jne 02d7
+    if (!ZF)
+        AOT_GOTO(0x02d7, L02d7);
+    AOT_GOTO(0x02bf, L02bf);
+L02bf:
+    AOT_BLOCK(0x02bf, 5);
+    // 02bf: mov ax, 00c2
+    {
+        r[0] = 0x00c2;
+    }
+    // 02c2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 02c3: mov ax, 02a6
+    {
+        r[0] = 0x02a6;
+    }
+    // 02c6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 02c7: call 08d1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x02ca);
+    }
+    AOT_GOTO(0x08d1, L08d1);
+L02ca:
+    AOT_BLOCK(0x02ca, 3);
+    // 02ca: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 02cb: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 02cc: call 081c
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x02cf);
+    }
+    AOT_GOTO(0x081c, L081c);
+L02cf:
+    AOT_BLOCK(0x02cf, 3);
+    // 02cf: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 02d2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 02d3: call 0851
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x02d6);
+    }
+    AOT_GOTO(0x0851, L0851);
+L02d6:
+    AOT_BLOCK(0x02d6, 1);
+    // 02d6: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x02d7, L02d7);
+L02d7:
+    AOT_BLOCK(0x02d7, 15);
+    // 02d7: mov dx, [e350]
+    {
+        a = 0xe350;
+        r[2] = RD16(a);
+    }
+    // 02db: sub dx, si
+    {
+        val = (dst = int16_t(r[2])) - (src = int16_t(r[6]));
+        r[2] = val;
+    }
+    // 02dd: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 02e0: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 02e2: sub ax, 04b0
+    {
+        val = (dst = int16_t(r[0])) - (src = 1200);
+        r[0] = val;
+    }
+    // 02e5: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 02e7: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 02e9: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 02ea: add [e354], ax
+    {
+        a = 0xe354;
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[0]));
+        WR16(a, val);
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 02ee: adc [e356], dx
+    {
+        a = 0xe356;
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2])) + CF;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val) || (CF && !(src + 1));
+    }
+    // 02f2: push [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 02f5: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 02f6: mov ax, 04b0
+    {
+        r[0] = 0x04b0;
+    }
+    // 02f9: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 02fa: call 0902
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x02fd);
+    }
+    AOT_GOTO(0x0902, L0902);
+L02fd:
+    AOT_BLOCK(0x02fd, 10);
+    // 02fd: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 0300: mov ax, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[0] = RD16(a);
+    }
+    // 0303: add ax, 04b0
+    {
+        val = (dst = int16_t(r[0])) + (src = 1200);
+        r[0] = val;
+    }
+    // 0306: mov [e350], ax
+    {
+        WR16(0xe350, r[0]);
+    }
+    // 0309: mov dx, 6400
+    {
+        r[2] = 0x6400;
+    }
+    // 030c: sub dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 030f: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 0310: push [e350]
+    {
+        a = 0xe350;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0314: push [e35a]
+    {
+        a = 0xe35a;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0318: call 08fa
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x031b);
+    }
+    AOT_GOTO(0x08fa, L08fa);
+L031b:
+    AOT_BLOCK(0x031b, 6);
+    // 031b: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 031e: mov [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[0]);
+    }
+    // 0321: mov dx, 6400
+    {
+        r[2] = 0x6400;
+    }
+    // 0324: sub dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 0327: cmp [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 032a: jnl 0332
+    if (SF == OF)
+        AOT_GOTO(0x0332, L0332);
+    AOT_GOTO(0x032c, L032c);
+L032c:
+    AOT_BLOCK(0x032c, 1);
+    // 032c: mov [e358], 0001
+    {
+        a = 0xe358;
+        WR16(a, 0x0001);
+    }
+    AOT_GOTO(0x0332, L0332);
+L0332:
+    AOT_BLOCK(0x0332, 2);
+    // 0332: cmp [bp-4], 0
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0336: jle 0343
+    if (ZF || SF != OF)
+        AOT_GOTO(0x0343, L0343);
+    AOT_GOTO(0x0338, L0338);
+L0338:
+    AOT_BLOCK(0x0338, 3);
+    // 0338: mov dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[2] = RD16(a);
+    }
+    // 033b: add dx, [e350]
+    {
+        a = 0xe350;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 033f: mov [e350], dx
+    {
+        a = 0xe350;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x0343, L0343);
+L0343:
+    AOT_BLOCK(0x0343, 18);
+    // 0343: mov bx, [e350]
+    {
+        a = 0xe350;
+        r[3] = RD16(a);
+    }
+    // 0347: mov byte [bx], 0
+    {
+        a = uint16_t(r[3]);
+        WR8(a, 0);
+    }
+    // 034a: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 034c: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+    }
+    // 034e: add dx, [0006]
+    {
+        a = 0x0006;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 0352: mov [0006], dx
+    {
+        a = 0x0006;
+        WR16(a, r[2]);
+    }
+    // 0356: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 0358: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+    }
+    // 035a: add dx, [e34a]
+    {
+        a = 0xe34a;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 035e: mov [e34a], dx
+    {
+        a = 0xe34a;
+        WR16(a, r[2]);
+    }
+    // 0362: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 0364: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+    }
+    // 0366: add dx, [e34c]
+    {
+        a = 0xe34c;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 036a: mov [e34c], dx
+    {
+        a = 0xe34c;
+        WR16(a, r[2]);
+    }
+    // 036e: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 0370: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+    }
+    // 0372: add dx, [e34e]
+    {
+        a = 0xe34e;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0376: mov [e34e], dx
+    {
+        a = 0xe34e;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x037a, L037a);
+L037a:
+    AOT_BLOCK(0x037a, 1);
+    // 037a: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L037d:
+    AOT_BLOCK(0x037d, 4);
+    // 037d: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 037e: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0380: sub sp, 6
+    {
+        val = (dst = int16_t(r[4])) - (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0383: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    AOT_GOTO(0x0384, L0384);
+L0384:
+    AOT_BLOCK(0x0384, 3);
+    // 0384: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0385: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0388: call 0691
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x038b);
+    }
+    AOT_GOTO(0x0691, L0691);
+L038b:
+    AOT_BLOCK(0x038b, 4);
+    // 038b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 038c: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 038e: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0390: je 03a7
+    if (ZF)
+        AOT_GOTO(0x03a7, L03a7);
+    AOT_GOTO(0x0392, L0392);
+L0392:
+    AOT_BLOCK(0x0392, 4);
+    // 0392: mov al, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0395: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0396: cmp ax, 0002
+    {
+        val = (dst = int16_t(r[0])) - (src = 2);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0399: jl 039e
+    if (SF != OF)
+        AOT_GOTO(0x039e, L039e);
+    AOT_GOTO(0x039b, L039b);
+L039b:
+    AOT_BLOCK(0x039b, 1);
+    // 039b: jmp 0434
+    AOT_GOTO(0x0434, L0434);
+L039e:
+    AOT_BLOCK(0x039e, 5);
+    // 039e: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 039f: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 03a0: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 03a1: mov [si+2], al
+    {
+        a = uint16_t(r[6] + 2);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 03a4: jmp 0434
+    AOT_GOTO(0x0434, L0434);
+L03a7:
+    AOT_BLOCK(0x03a7, 2);
+    // 03a7: cmp [e352], 1000
+    {
+        a = 0xe352;
+        val = (dst = int16_t(RD16(a))) - (src = 4096);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 03ad: je 03b7
+    if (ZF)
+        AOT_GOTO(0x03b7, L03b7);
+    AOT_GOTO(0x03af, L03af);
+L03af:
+    AOT_BLOCK(0x03af, 2);
+    // 03af: cmp [0004], e30a
+    {
+        a = 0x0004;
+        val = (dst = int16_t(RD16(a))) - (src = -7414);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 03b5: jbe 03cc
+    if (CF || ZF)
+        AOT_GOTO(0x03cc, L03cc);
+    AOT_GOTO(0x03b7, L03b7);
+L03b7:
+    AOT_BLOCK(0x03b7, 5);
+    // 03b7: mov ax, 0114
+    {
+        r[0] = 0x0114;
+    }
+    // 03ba: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03bb: mov ax, 02a6
+    {
+        r[0] = 0x02a6;
+    }
+    // 03be: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03bf: call 08d1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03c2);
+    }
+    AOT_GOTO(0x08d1, L08d1);
+L03c2:
+    AOT_BLOCK(0x03c2, 5);
+    // 03c2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03c3: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03c4: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 03c7: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 03c8: call 0851
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03cb);
+    }
+    AOT_GOTO(0x0851, L0851);
+L03cb:
+    AOT_BLOCK(0x03cb, 1);
+    // 03cb: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x03cc, L03cc);
+L03cc:
+    AOT_BLOCK(0x03cc, 2);
+    // 03cc: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 03cf: call 06dd
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x03d2);
+    }
+    AOT_GOTO(0x06dd, L06dd);
+L03d2:
+    AOT_BLOCK(0x03d2, 6);
+    // 03d2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 03d3: mov [bp-6], ax
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[0]);
+    }
+    // 03d6: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 03d9: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 03db: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 03dd: lea si, [bx+68b2]
+    {
+        a = uint16_t(r[3] + 26802);
+        r[6] = a;
+    }
+    AOT_GOTO(0x03e1, L03e1);
+L03e1:
+    AOT_BLOCK(0x03e1, 2);
+    // 03e1: cmp [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 03e4: je 03f4
+    if (ZF)
+        AOT_GOTO(0x03f4, L03f4);
+    AOT_GOTO(0x03e6, L03e6);
+L03e6:
+    AOT_BLOCK(0x03e6, 3);
+    // 03e6: add si, 4
+    {
+        val = (dst = int16_t(r[6])) + (src = 4);
+        r[6] = val;
+    }
+    // 03e9: cmp si, a8b2
+    {
+        val = (dst = int16_t(r[6])) - (src = -22350);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 03ed: jne 03e1
+    if (!ZF)
+        AOT_GOTO(0x03e1, L03e1);
+    AOT_GOTO(0x03ef, L03ef);
+L03ef:
+    AOT_BLOCK(0x03ef, 2);
+    // 03ef: mov si, 68b2
+    {
+        r[6] = 0x68b2;
+    }
+    // 03f2: jmp short 03e1
+    AOT_GOTO(0x03e1, L03e1);
+L03f4:
+    AOT_BLOCK(0x03f4, 3);
+    // 03f4: mov dx, [0004]
+    {
+        a = 0x0004;
+        r[2] = RD16(a);
+    }
+    // 03f8: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 03fa: mov byte [si+2], 1
+    {
+        a = uint16_t(r[6] + 2);
+        WR8(a, 1);
+    }
+    AOT_GOTO(0x03fe, L03fe);
+L03fe:
+    AOT_BLOCK(0x03fe, 3);
+    // 03fe: mov byte [si+3], 0
+    {
+        a = uint16_t(r[6] + 3);
+        WR8(a, 0);
+    }
+    // 0402: inc [e352]
+    {
+        a = 0xe352;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0406: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    AOT_GOTO(0x0409, L0409);
+L0409:
+    AOT_BLOCK(0x0409, 5);
+    // 0409: mov al, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 040b: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 040c: mov bx, ax
+    {
+        r[3] = r[0];
+    }
+    // 040e: test byte [bx+187], 7
+    {
+        a = uint16_t(r[3] + 391);
+        val = int8_t(RD8(a)) & 7;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0413: jne 041a
+    if (!ZF)
+        AOT_GOTO(0x041a, L041a);
+    AOT_GOTO(0x0415, L0415);
+L0415:
+    AOT_BLOCK(0x0415, 2);
+    // 0415: cmp byte [di], 5f
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int8_t(RD8(a))) - (src = 95);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0418: jne 0429
+    if (!ZF)
+        AOT_GOTO(0x0429, L0429);
+    AOT_GOTO(0x041a, L041a);
+L041a:
+    AOT_BLOCK(0x041a, 6);
+    // 041a: mov al, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 041c: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+    }
+    // 041d: mov bx, [0004]
+    {
+        a = 0x0004;
+        r[3] = RD16(a);
+    }
+    // 0421: inc [0004]
+    {
+        a = 0x0004;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0425: mov [bx], al
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 0427: jmp short 0409
+    AOT_GOTO(0x0409, L0409);
+L0429:
+    AOT_BLOCK(0x0429, 3);
+    // 0429: mov bx, [0004]
+    {
+        a = 0x0004;
+        r[3] = RD16(a);
+    }
+    // 042d: inc [0004]
+    {
+        a = 0x0004;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0431: mov byte [bx], 0
+    {
+        a = uint16_t(r[3]);
+        WR8(a, 0);
+    }
+    AOT_GOTO(0x0434, L0434);
+L0434:
+    AOT_BLOCK(0x0434, 1);
+    // 0434: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L0437:
+    AOT_BLOCK(0x0437, 9);
+    // 0437: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0438: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 043a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 043b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 043c: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 043d: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 043e: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+    }
+    // 0440: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0442: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    AOT_GOTO(0x0443, L0443);
+L0443:
+    AOT_BLOCK(0x0443, 4);
+    // 0443: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0444: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0445: push [e35a]
+    {
+        a = 0xe35a;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0449: call 08f2
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x044c);
+    }
+    AOT_GOTO(0x08f2, L08f2);
+L044c:
+    AOT_BLOCK(0x044c, 4);
+    // 044c: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 044f: mov [0008], 0000
+    {
+        a = 0x0008;
+        WR16(a, 0x0000);
+    }
+    // 0455: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0457: mov [e354], ax
+    {
+        WR16(0xe354, r[0]);
+    }
+    AOT_GOTO(0x045a, L045a);
+L045a:
+    AOT_BLOCK(0x045a, 10);
+    // 045a: mov [e356], ax
+    {
+        WR16(0xe356, r[0]);
+    }
+    // 045d: mov dx, 04b0
+    {
+        r[2] = 0x04b0;
+    }
+    // 0460: mov [0006], dx
+    {
+        a = 0x0006;
+        WR16(a, r[2]);
+    }
+    // 0464: mov [e34a], dx
+    {
+        a = 0xe34a;
+        WR16(a, r[2]);
+    }
+    // 0468: mov dx, [0006]
+    {
+        a = 0x0006;
+        r[2] = RD16(a);
+    }
+    // 046c: mov [e34c], dx
+    {
+        a = 0xe34c;
+        WR16(a, r[2]);
+    }
+    // 0470: mov dx, [0006]
+    {
+        a = 0x0006;
+        r[2] = RD16(a);
+    }
+    // 0474: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 0475: mov [e34e], dx
+    {
+        a = 0xe34e;
+        WR16(a, r[2]);
+    }
+    // 0479: mov [e358], 0000
+    {
+        a = 0xe358;
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x047f, L047f);
+L047f:
+    AOT_BLOCK(0x047f, 6);
+    // 047f: mov ax, 6400
+    {
+        r[0] = 0x6400;
+    }
+    // 0482: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0483: mov ax, 04b0
+    {
+        r[0] = 0x04b0;
+    }
+    // 0486: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0487: push [e35a]
+    {
+        a = 0xe35a;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 048b: call 08fa
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x048e);
+    }
+    AOT_GOTO(0x08fa, L08fa);
+L048e:
+    AOT_BLOCK(0x048e, 4);
+    // 048e: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 0491: mov [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[0]);
+    }
+    // 0494: cmp ax, 6400
+    {
+        val = (dst = int16_t(r[0])) - (src = 25600);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0497: je 049f
+    if (ZF)
+        AOT_GOTO(0x049f, L049f);
+    AOT_GOTO(0x0499, L0499);
+L0499:
+    AOT_BLOCK(0x0499, 1);
+    // 0499: mov [e358], 0001
+    {
+        a = 0xe358;
+        WR16(a, 0x0001);
+    }
+    AOT_GOTO(0x049f, L049f);
+L049f:
+    AOT_BLOCK(0x049f, 2);
+    // 049f: cmp [bp-2], 0
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 04a3: jnl 04ba
+    if (SF == OF)
+        AOT_GOTO(0x04ba, L04ba);
+    AOT_GOTO(0x04a5, L04a5);
+L04a5:
+    AOT_BLOCK(0x04a5, 5);
+    // 04a5: mov ax, 015a
+    {
+        r[0] = 0x015a;
+    }
+    // 04a8: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 04a9: mov ax, 02a6
+    {
+        r[0] = 0x02a6;
+    }
+    // 04ac: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 04ad: call 08d1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04b0);
+    }
+    AOT_GOTO(0x08d1, L08d1);
+L04b0:
+    AOT_BLOCK(0x04b0, 5);
+    // 04b0: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 04b1: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 04b2: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 04b5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 04b6: call 0851
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04b9);
+    }
+    AOT_GOTO(0x0851, L0851);
+L04b9:
+    AOT_BLOCK(0x04b9, 1);
+    // 04b9: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x04ba, L04ba);
+L04ba:
+    AOT_BLOCK(0x04ba, 5);
+    // 04ba: mov ax, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[0] = RD16(a);
+    }
+    // 04bd: add ax, 04b0
+    {
+        val = (dst = int16_t(r[0])) + (src = 1200);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 04c0: mov [e350], ax
+    {
+        WR16(0xe350, r[0]);
+    }
+    // 04c3: mov bx, [e350]
+    {
+        a = 0xe350;
+        r[3] = RD16(a);
+    }
+    // 04c7: mov byte [bx], 0
+    {
+        a = uint16_t(r[3]);
+        WR8(a, 0);
+    }
+    AOT_GOTO(0x04ca, L04ca);
+L04ca:
+    AOT_BLOCK(0x04ca, 3);
+    // 04ca: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 04ce: cmp byte [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 04d1: jne 04d6
+    if (!ZF)
+        AOT_GOTO(0x04d6, L04d6);
+    AOT_GOTO(0x04d3, L04d3);
+L04d3:
+    AOT_BLOCK(0x04d3, 1);
+    // 04d3: jmp 068e
+    AOT_GOTO(0x068e, L068e);
+L04d6:
+    AOT_BLOCK(0x04d6, 2);
+    // 04d6: cmp [bp+4], 1
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 04da: jne 04f9
+    if (!ZF)
+        AOT_GOTO(0x04f9, L04f9);
+    AOT_GOTO(0x04dc, L04dc);
+L04dc:
+    AOT_BLOCK(0x04dc, 5);
+    // 04dc: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 04de: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 04df: mov bx, ax
+    {
+        r[3] = r[0];
+    }
+    // 04e1: test byte [bx+187], 7
+    {
+        a = uint16_t(r[3] + 391);
+        val = int8_t(RD8(a)) & 7;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 04e6: jne 04f1
+    if (!ZF)
+        AOT_GOTO(0x04f1, L04f1);
+    AOT_GOTO(0x04e8, L04e8);
+L04e8:
+    AOT_BLOCK(0x04e8, 3);
+    // 04e8: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 04ec: cmp byte [bx], 5f
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 95);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 04ef: jne 04f9
+    if (!ZF)
+        AOT_GOTO(0x04f9, L04f9);
+    AOT_GOTO(0x04f1, L04f1);
+L04f1:
+    AOT_BLOCK(0x04f1, 2);
+    // 04f1: push [0006]
+    {
+        a = 0x0006;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 04f5: call 037d
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x04f8);
+    }
+    AOT_GOTO(0x037d, L037d);
+L04f8:
+    AOT_BLOCK(0x04f8, 1);
+    // 04f8: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x04f9, L04f9);
+L04f9:
+    AOT_BLOCK(0x04f9, 3);
+    // 04f9: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 04fd: cmp byte [bx], 7b
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 123);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0500: jne 0526
+    if (!ZF)
+        AOT_GOTO(0x0526, L0526);
+    AOT_GOTO(0x0502, L0502);
+L0502:
+    AOT_BLOCK(0x0502, 2);
+    // 0502: cmp [0008], 0
+    {
+        a = 0x0008;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0507: jne 051d
+    if (!ZF)
+        AOT_GOTO(0x051d, L051d);
+    AOT_GOTO(0x0509, L0509);
+L0509:
+    AOT_BLOCK(0x0509, 3);
+    // 0509: mov bx, [e34a]
+    {
+        a = 0xe34a;
+        r[3] = RD16(a);
+    }
+    // 050d: cmp byte [bx], 29
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 41);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0510: je 0517
+    if (ZF)
+        AOT_GOTO(0x0517, L0517);
+    AOT_GOTO(0x0512, L0512);
+L0512:
+    AOT_BLOCK(0x0512, 2);
+    // 0512: cmp byte [bx], 3d
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 61);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0515: jne 051d
+    if (!ZF)
+        AOT_GOTO(0x051d, L051d);
+    AOT_GOTO(0x0517, L0517);
+L0517:
+    AOT_BLOCK(0x0517, 1);
+    // 0517: mov [000a], 0001
+    {
+        a = 0x000a;
+        WR16(a, 0x0001);
+    }
+    AOT_GOTO(0x051d, L051d);
+L051d:
+    AOT_BLOCK(0x051d, 2);
+    // 051d: inc [0008]
+    {
+        a = 0x0008;
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0521: call 0175
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0524);
+    }
+    AOT_GOTO(0x0175, L0175);
+L0524:
+    AOT_BLOCK(0x0524, 1);
+    // 0524: jmp short 04ca
+    AOT_GOTO(0x04ca, L04ca);
+L0526:
+    AOT_BLOCK(0x0526, 3);
+    // 0526: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 052a: cmp byte [bx], 7d
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 125);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 052d: jne 0545
+    if (!ZF)
+        AOT_GOTO(0x0545, L0545);
+    AOT_GOTO(0x052f, L052f);
+L052f:
+    AOT_BLOCK(0x052f, 3);
+    // 052f: mov dx, [0008]
+    {
+        a = 0x0008;
+        r[2] = RD16(a);
+    }
+    // 0533: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 0534: mov [0008], dx
+    {
+        a = 0x0008;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x0538, L0538);
+L0538:
+    AOT_BLOCK(0x0538, 1);
+    // 0538: jne 0540
+    if (!ZF)
+        AOT_GOTO(0x0540, L0540);
+    AOT_GOTO(0x053a, L053a);
+L053a:
+    AOT_BLOCK(0x053a, 1);
+    // 053a: mov [000a], 0000
+    {
+        a = 0x000a;
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x0540, L0540);
+L0540:
+    AOT_BLOCK(0x0540, 1);
+    // 0540: call 0175
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0543);
+    }
+    AOT_GOTO(0x0175, L0175);
+L0543:
+    AOT_BLOCK(0x0543, 1);
+    // 0543: jmp short 04ca
+    AOT_GOTO(0x04ca, L04ca);
+L0545:
+    AOT_BLOCK(0x0545, 3);
+    // 0545: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 0549: cmp byte [bx], 28
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 40);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 054c: jne 0563
+    if (!ZF)
+        AOT_GOTO(0x0563, L0563);
+    AOT_GOTO(0x054e, L054e);
+L054e:
+    AOT_BLOCK(0x054e, 2);
+    // 054e: cmp [0008], 0
+    {
+        a = 0x0008;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0553: jne 055d
+    if (!ZF)
+        AOT_GOTO(0x055d, L055d);
+    AOT_GOTO(0x0555, L0555);
+L0555:
+    AOT_BLOCK(0x0555, 2);
+    // 0555: mov dx, [e34a]
+    {
+        a = 0xe34a;
+        r[2] = RD16(a);
+    }
+    // 0559: mov [e34c], dx
+    {
+        a = 0xe34c;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x055d, L055d);
+L055d:
+    AOT_BLOCK(0x055d, 1);
+    // 055d: call 0175
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0560);
+    }
+    AOT_GOTO(0x0175, L0175);
+L0560:
+    AOT_BLOCK(0x0560, 1);
+    // 0560: jmp 04ca
+    AOT_GOTO(0x04ca, L04ca);
+L0563:
+    AOT_BLOCK(0x0563, 2);
+    // 0563: cmp [bp+4], 1
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0567: jne 05c2
+    if (!ZF)
+        AOT_GOTO(0x05c2, L05c2);
+    AOT_GOTO(0x0569, L0569);
+L0569:
+    AOT_BLOCK(0x0569, 3);
+    // 0569: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 056d: cmp byte [bx], 3b
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 59);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0570: je 05c2
+    if (ZF)
+        AOT_GOTO(0x05c2, L05c2);
+    AOT_GOTO(0x0572, L0572);
+L0572:
+    AOT_BLOCK(0x0572, 3);
+    // 0572: mov bx, [e34a]
+    {
+        a = 0xe34a;
+        r[3] = RD16(a);
+    }
+    // 0576: cmp byte [bx], 29
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 41);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0579: jne 05c2
+    if (!ZF)
+        AOT_GOTO(0x05c2, L05c2);
+    AOT_GOTO(0x057b, L057b);
+L057b:
+    AOT_BLOCK(0x057b, 2);
+    // 057b: cmp [0008], 0
+    {
+        a = 0x0008;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0580: jne 05c2
+    if (!ZF)
+        AOT_GOTO(0x05c2, L05c2);
+    AOT_GOTO(0x0582, L0582);
+L0582:
+    AOT_BLOCK(0x0582, 6);
+    // 0582: mov bx, [e34c]
+    {
+        a = 0xe34c;
+        r[3] = RD16(a);
+    }
+    // 0586: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0588: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0589: mov bx, ax
+    {
+        r[3] = r[0];
+    }
+    // 058b: test byte [bx+187], 7
+    {
+        a = uint16_t(r[3] + 391);
+        val = int8_t(RD8(a)) & 7;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0590: jne 059b
+    if (!ZF)
+        AOT_GOTO(0x059b, L059b);
+    AOT_GOTO(0x0592, L0592);
+L0592:
+    AOT_BLOCK(0x0592, 3);
+    // 0592: mov bx, [e34c]
+    {
+        a = 0xe34c;
+        r[3] = RD16(a);
+    }
+    // 0596: cmp byte [bx], 5f
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 95);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0599: jne 05c2
+    if (!ZF)
+        AOT_GOTO(0x05c2, L05c2);
+    AOT_GOTO(0x059b, L059b);
+L059b:
+    AOT_BLOCK(0x059b, 2);
+    // 059b: push [e34c]
+    {
+        a = 0xe34c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 059f: call 0691
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x05a2);
+    }
+    AOT_GOTO(0x0691, L0691);
+L05a2:
+    AOT_BLOCK(0x05a2, 4);
+    // 05a2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 05a3: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 05a5: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 05a7: jne 05be
+    if (!ZF)
+        AOT_GOTO(0x05be, L05be);
+    AOT_GOTO(0x05a9, L05a9);
+L05a9:
+    AOT_BLOCK(0x05a9, 5);
+    // 05a9: mov ax, 0142
+    {
+        r[0] = 0x0142;
+    }
+    // 05ac: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 05ad: mov ax, 02a6
+    {
+        r[0] = 0x02a6;
+    }
+    // 05b0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 05b1: call 08d1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x05b4);
+    }
+    AOT_GOTO(0x08d1, L08d1);
+L05b4:
+    AOT_BLOCK(0x05b4, 5);
+    // 05b4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 05b5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 05b6: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 05b9: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 05ba: call 0851
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x05bd);
+    }
+    AOT_GOTO(0x0851, L0851);
+L05bd:
+    AOT_BLOCK(0x05bd, 1);
+    // 05bd: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x05be, L05be);
+L05be:
+    AOT_BLOCK(0x05be, 1);
+    // 05be: mov byte [si+3], 1
+    {
+        a = uint16_t(r[6] + 3);
+        WR8(a, 1);
+    }
+    AOT_GOTO(0x05c2, L05c2);
+L05c2:
+    AOT_BLOCK(0x05c2, 2);
+    // 05c2: cmp [bp+4], 2
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 2);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 05c6: je 05cb
+    if (ZF)
+        AOT_GOTO(0x05cb, L05cb);
+    AOT_GOTO(0x05c8, L05c8);
+L05c8:
+    AOT_BLOCK(0x05c8, 1);
+    // 05c8: jmp 0688
+    AOT_GOTO(0x0688, L0688);
+L05cb:
+    AOT_BLOCK(0x05cb, 3);
+    // 05cb: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 05cf: cmp byte [bx], 3b
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 59);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 05d2: je 05d7
+    if (ZF)
+        AOT_GOTO(0x05d7, L05d7);
+    AOT_GOTO(0x05d4, L05d4);
+L05d4:
+    AOT_BLOCK(0x05d4, 1);
+    // 05d4: jmp 0688
+    AOT_GOTO(0x0688, L0688);
+L05d7:
+    AOT_BLOCK(0x05d7, 3);
+    // 05d7: mov bx, [e34a]
+    {
+        a = 0xe34a;
+        r[3] = RD16(a);
+    }
+    // 05db: cmp byte [bx], 29
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 41);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 05de: je 05e3
+    if (ZF)
+        AOT_GOTO(0x05e3, L05e3);
+    AOT_GOTO(0x05e0, L05e0);
+L05e0:
+    AOT_BLOCK(0x05e0, 1);
+    // 05e0: jmp 0688
+    AOT_GOTO(0x0688, L0688);
+L05e3:
+    AOT_BLOCK(0x05e3, 2);
+    // 05e3: cmp [0008], 0
+    {
+        a = 0x0008;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 05e8: je 05ed
+    if (ZF)
+        AOT_GOTO(0x05ed, L05ed);
+    AOT_GOTO(0x05ea, L05ea);
+L05ea:
+    AOT_BLOCK(0x05ea, 1);
+    // 05ea: jmp 0688
+    AOT_GOTO(0x0688, L0688);
+L05ed:
+    AOT_BLOCK(0x05ed, 6);
+    // 05ed: mov bx, [e34c]
+    {
+        a = 0xe34c;
+        r[3] = RD16(a);
+    }
+    // 05f1: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 05f3: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 05f4: mov bx, ax
+    {
+        r[3] = r[0];
+    }
+    // 05f6: test byte [bx+187], 7
+    {
+        a = uint16_t(r[3] + 391);
+        val = int8_t(RD8(a)) & 7;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 05fb: jne 0609
+    if (!ZF)
+        AOT_GOTO(0x0609, L0609);
+    AOT_GOTO(0x05fd, L05fd);
+L05fd:
+    AOT_BLOCK(0x05fd, 3);
+    // 05fd: mov bx, [e34c]
+    {
+        a = 0xe34c;
+        r[3] = RD16(a);
+    }
+    // 0601: cmp byte [bx], 5f
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 95);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0604: je 0609
+    if (ZF)
+        AOT_GOTO(0x0609, L0609);
+    AOT_GOTO(0x0606, L0606);
+L0606:
+    AOT_BLOCK(0x0606, 1);
+    // 0606: jmp 0688
+    AOT_GOTO(0x0688, L0688);
+L0609:
+    AOT_BLOCK(0x0609, 2);
+    // 0609: push [e34c]
+    {
+        a = 0xe34c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 060d: call 0691
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0610);
+    }
+    AOT_GOTO(0x0691, L0691);
+L0610:
+    AOT_BLOCK(0x0610, 4);
+    // 0610: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0611: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 0613: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0615: jne 062c
+    if (!ZF)
+        AOT_GOTO(0x062c, L062c);
+    AOT_GOTO(0x0617, L0617);
+L0617:
+    AOT_BLOCK(0x0617, 5);
+    // 0617: mov ax, 012a
+    {
+        r[0] = 0x012a;
+    }
+    // 061a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 061b: mov ax, 02a6
+    {
+        r[0] = 0x02a6;
+    }
+    // 061e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 061f: call 08d1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0622);
+    }
+    AOT_GOTO(0x08d1, L08d1);
+L0622:
+    AOT_BLOCK(0x0622, 5);
+    // 0622: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0623: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0624: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0627: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0628: call 0851
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x062b);
+    }
+    AOT_GOTO(0x0851, L0851);
+L062b:
+    AOT_BLOCK(0x062b, 1);
+    // 062b: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x062c, L062c);
+L062c:
+    AOT_BLOCK(0x062c, 2);
+    // 062c: mov di, [e34e]
+    {
+        a = 0xe34e;
+        r[7] = RD16(a);
+    }
+    // 0630: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x0631, L0631);
+L0631:
+    AOT_BLOCK(0x0631, 5);
+    // 0631: mov al, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0633: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0634: mov bx, ax
+    {
+        r[3] = r[0];
+    }
+    // 0636: test byte [bx+187], 8
+    {
+        a = uint16_t(r[3] + 391);
+        val = int8_t(RD8(a)) & 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 063b: je 0640
+    if (ZF)
+        AOT_GOTO(0x0640, L0640);
+    AOT_GOTO(0x063d, L063d);
+L063d:
+    AOT_BLOCK(0x063d, 2);
+    // 063d: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 063e: jmp short 0631
+    AOT_GOTO(0x0631, L0631);
+L0640:
+    AOT_BLOCK(0x0640, 6);
+    // 0640: mov dx, [0006]
+    {
+        a = 0x0006;
+        r[2] = RD16(a);
+    }
+    // 0644: sub dx, di
+    {
+        val = (dst = int16_t(r[2])) - (src = int16_t(r[7]));
+        r[2] = val;
+    }
+    // 0646: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 0649: mov bx, [0006]
+    {
+        a = 0x0006;
+        r[3] = RD16(a);
+    }
+    // 064d: cmp byte [bx], 3b
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 59);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0650: jne 0655
+    if (!ZF)
+        AOT_GOTO(0x0655, L0655);
+    AOT_GOTO(0x0652, L0652);
+L0652:
+    AOT_BLOCK(0x0652, 1);
+    // 0652: inc [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x0655, L0655);
+L0655:
+    AOT_BLOCK(0x0655, 4);
+    // 0655: mov al, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0658: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0659: cmp ax, 0002
+    {
+        val = (dst = int16_t(r[0])) - (src = 2);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 065c: jnl 066d
+    if (SF == OF)
+        AOT_GOTO(0x066d, L066d);
+    AOT_GOTO(0x065e, L065e);
+L065e:
+    AOT_BLOCK(0x065e, 5);
+    // 065e: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0660: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0661: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0664: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0665: call 0713
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0668);
+    }
+    AOT_GOTO(0x0713, L0713);
+L0668:
+    AOT_BLOCK(0x0668, 2);
+    // 0668: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 066b: jmp short 0688
+    AOT_GOTO(0x0688, L0688);
+L066d:
+    AOT_BLOCK(0x066d, 2);
+    // 066d: cmp [e35e], 0
+    {
+        a = 0xe35e;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0672: je 0688
+    if (ZF)
+        AOT_GOTO(0x0688, L0688);
+    AOT_GOTO(0x0674, L0674);
+L0674:
+    AOT_BLOCK(0x0674, 2);
+    // 0674: cmp byte [si+3], 0
+    {
+        a = uint16_t(r[6] + 3);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0678: jne 0688
+    if (!ZF)
+        AOT_GOTO(0x0688, L0688);
+    AOT_GOTO(0x067a, L067a);
+L067a:
+    AOT_BLOCK(0x067a, 5);
+    // 067a: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 067d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 067e: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0681: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0682: call 0713
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0685);
+    }
+    AOT_GOTO(0x0713, L0713);
+L0685:
+    AOT_BLOCK(0x0685, 1);
+    // 0685: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x0688, L0688);
+L0688:
+    AOT_BLOCK(0x0688, 1);
+    // 0688: call 0175
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x068b);
+    }
+    AOT_GOTO(0x0175, L0175);
+L068b:
+    AOT_BLOCK(0x068b, 1);
+    // 068b: jmp 04ca
+    AOT_GOTO(0x04ca, L04ca);
+L068e:
+    AOT_BLOCK(0x068e, 1);
+    // 068e: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L0691:
+    AOT_BLOCK(0x0691, 6);
+    // 0691: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0692: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0694: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0695: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0696: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0699: call 06dd
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x069c);
+    }
+    AOT_GOTO(0x06dd, L06dd);
+L069c:
+    AOT_BLOCK(0x069c, 6);
+    // 069c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 069d: mov [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[0]);
+    }
+    // 06a0: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 06a3: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 06a5: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 06a7: lea si, [bx+68b2]
+    {
+        a = uint16_t(r[3] + 26802);
+        r[6] = a;
+    }
+    AOT_GOTO(0x06ab, L06ab);
+L06ab:
+    AOT_BLOCK(0x06ab, 2);
+    // 06ab: cmp [si], 0
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 06ae: je 06d8
+    if (ZF)
+        AOT_GOTO(0x06d8, L06d8);
+    AOT_GOTO(0x06b0, L06b0);
+L06b0:
+    AOT_BLOCK(0x06b0, 2);
+    // 06b0: push [si]
+    {
+        a = uint16_t(r[6]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 06b2: call 090b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06b5);
+    }
+    AOT_GOTO(0x090b, L090b);
+L06b5:
+    AOT_BLOCK(0x06b5, 5);
+    // 06b5: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 06b6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 06b7: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 06ba: push [si]
+    {
+        a = uint16_t(r[6]);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 06bc: call 0911
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x06bf);
+    }
+    AOT_GOTO(0x0911, L0911);
+L06bf:
+    AOT_BLOCK(0x06bf, 3);
+    // 06bf: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 06c2: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 06c4: jne 06ca
+    if (!ZF)
+        AOT_GOTO(0x06ca, L06ca);
+    AOT_GOTO(0x06c6, L06c6);
+L06c6:
+    AOT_BLOCK(0x06c6, 2);
+    // 06c6: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 06c8: jmp short 06da
+    AOT_GOTO(0x06da, L06da);
+L06ca:
+    AOT_BLOCK(0x06ca, 3);
+    // 06ca: add si, 4
+    {
+        val = (dst = int16_t(r[6])) + (src = 4);
+        r[6] = val;
+    }
+    // 06cd: cmp si, a8b2
+    {
+        val = (dst = int16_t(r[6])) - (src = -22350);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 06d1: jne 06ab
+    if (!ZF)
+        AOT_GOTO(0x06ab, L06ab);
+    AOT_GOTO(0x06d3, L06d3);
+L06d3:
+    AOT_BLOCK(0x06d3, 2);
+    // 06d3: mov si, 68b2
+    {
+        r[6] = 0x68b2;
+    }
+    // 06d6: jmp short 06ab
+    AOT_GOTO(0x06ab, L06ab);
+L06d8:
+    AOT_BLOCK(0x06d8, 1);
+    // 06d8: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x06da, L06da);
+L06da:
+    AOT_BLOCK(0x06da, 1);
+    // 06da: jmp 1af8
+    AOT_GOTO(0x1af8, L1af8);
+L06dd:
+    AOT_BLOCK(0x06dd, 6);
+    // 06dd: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 06de: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 06e0: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 06e1: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 06e2: xor si, si
+    {
+        val = int16_t(r[6]) ^ int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 06e4: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    AOT_GOTO(0x06e7, L06e7);
+L06e7:
+    AOT_BLOCK(0x06e7, 5);
+    // 06e7: mov al, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 06e9: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 06ea: mov bx, ax
+    {
+        r[3] = r[0];
+    }
+    // 06ec: test byte [bx+187], 7
+    {
+        a = uint16_t(r[3] + 391);
+        val = int8_t(RD8(a)) & 7;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 06f1: jne 06f8
+    if (!ZF)
+        AOT_GOTO(0x06f8, L06f8);
+    AOT_GOTO(0x06f3, L06f3);
+L06f3:
+    AOT_BLOCK(0x06f3, 2);
+    // 06f3: cmp byte [di], 5f
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int8_t(RD8(a))) - (src = 95);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 06f6: jne 0706
+    if (!ZF)
+        AOT_GOTO(0x0706, L0706);
+    AOT_GOTO(0x06f8, L06f8);
+L06f8:
+    AOT_BLOCK(0x06f8, 7);
+    // 06f8: mov al, [di]
+    {
+        a = uint16_t(r[7]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 06fa: inc di
+    {
+        val = int16_t(r[7]) + 1;
+        r[7] = val;
+    }
+    // 06fb: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 06fc: add si, ax
+    {
+        val = (dst = int16_t(r[6])) + (src = int16_t(r[0]));
+        r[6] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 06fe: shl si, 1
+    {
+        val = r[6] << 1;
+        r[6] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0700: and si, 7fff
+    {
+        val = int16_t(r[6]) & 32767;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0704: jmp short 06e7
+    AOT_GOTO(0x06e7, L06e7);
+L0706:
+    AOT_BLOCK(0x0706, 6);
+    // 0706: mov cx, 1000
+    {
+        r[1] = 0x1000;
+    }
+    // 0709: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 070b: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 070c: idiv cx
+    {
+        i32 = int32_t(uint32_t(r[2]) << 16 | r[0]);
+        src = int16_t(r[1]);
+        r[0] = i32 / src;
+        r[2] = i32 % src;
+    }
+    // 070e: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 0710: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L0713:
+    AOT_BLOCK(0x0713, 11);
+    // 0713: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0714: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0716: sub sp, 0092
+    {
+        val = (dst = int16_t(r[4])) - (src = 146);
+        r[4] = val;
+    }
+    // 071a: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 071b: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 071c: mov [bp-10], 0000
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, 0x0000);
+    }
+    // 0721: mov [bp-2], 0000
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, 0x0000);
+    }
+    // 0726: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 0729: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 072c: add dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 072f: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x0732, L0732);
+L0732:
+    AOT_BLOCK(0x0732, 2);
+    // 0732: cmp [bp-6], si
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0735: jbe 077a
+    if (CF || ZF)
+        AOT_GOTO(0x077a, L077a);
+    AOT_GOTO(0x0737, L0737);
+L0737:
+    AOT_BLOCK(0x0737, 2);
+    // 0737: cmp byte [si], 28
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 40);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 073a: jne 074c
+    if (!ZF)
+        AOT_GOTO(0x074c, L074c);
+    AOT_GOTO(0x073c, L073c);
+L073c:
+    AOT_BLOCK(0x073c, 6);
+    // 073c: mov dx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[2] = RD16(a);
+    }
+    // 073f: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 0741: inc cx
+    {
+        val = int16_t(r[1]) + 1;
+        r[1] = val;
+        AF = !(val & 15);
+    }
+    // 0742: mov [bp-2], cx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[1]);
+    }
+    // 0745: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0747: jne 074c
+    if (!ZF)
+        AOT_GOTO(0x074c, L074c);
+    AOT_GOTO(0x0749, L0749);
+L0749:
+    AOT_BLOCK(0x0749, 1);
+    // 0749: mov [bp-8], si
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[6]);
+    }
+    AOT_GOTO(0x074c, L074c);
+L074c:
+    AOT_BLOCK(0x074c, 2);
+    // 074c: cmp byte [si], 29
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 41);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 074f: jne 0759
+    if (!ZF)
+        AOT_GOTO(0x0759, L0759);
+    AOT_GOTO(0x0751, L0751);
+L0751:
+    AOT_BLOCK(0x0751, 2);
+    // 0751: dec [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 0754: jne 0759
+    if (!ZF)
+        AOT_GOTO(0x0759, L0759);
+    AOT_GOTO(0x0756, L0756);
+L0756:
+    AOT_BLOCK(0x0756, 1);
+    // 0756: mov [bp-a], si
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, r[6]);
+    }
+    AOT_GOTO(0x0759, L0759);
+L0759:
+    AOT_BLOCK(0x0759, 2);
+    // 0759: cmp byte [si], a
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 10);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 075c: jne 0761
+    if (!ZF)
+        AOT_GOTO(0x0761, L0761);
+    AOT_GOTO(0x075e, L075e);
+L075e:
+    AOT_BLOCK(0x075e, 1);
+    // 075e: inc [bp-10]
+    {
+        a = uint16_t(r[5] - 16);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x0761, L0761);
+L0761:
+    AOT_BLOCK(0x0761, 2);
+    // 0761: cmp byte [si], 2c
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 44);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0764: jne 076f
+    if (!ZF)
+        AOT_GOTO(0x076f, L076f);
+    AOT_GOTO(0x0766, L0766);
+L0766:
+    AOT_BLOCK(0x0766, 2);
+    // 0766: cmp [bp-2], 0
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 076a: jne 076f
+    if (!ZF)
+        AOT_GOTO(0x076f, L076f);
+    AOT_GOTO(0x076c, L076c);
+L076c:
+    AOT_BLOCK(0x076c, 1);
+    // 076c: jmp 0819
+    AOT_GOTO(0x0819, L0819);
+L076f:
+    AOT_BLOCK(0x076f, 2);
+    // 076f: cmp byte [si], 3d
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 61);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0772: jne 0777
+    if (!ZF)
+        AOT_GOTO(0x0777, L0777);
+    AOT_GOTO(0x0774, L0774);
+L0774:
+    AOT_BLOCK(0x0774, 1);
+    // 0774: jmp 0819
+    AOT_GOTO(0x0819, L0819);
+L0777:
+    AOT_BLOCK(0x0777, 2);
+    // 0777: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0778: jmp short 0732
+    AOT_GOTO(0x0732, L0732);
+L077a:
+    AOT_BLOCK(0x077a, 2);
+    // 077a: cmp [bp+8], 0
+    {
+        a = uint16_t(r[5] + 8);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 077e: je 0798
+    if (ZF)
+        AOT_GOTO(0x0798, L0798);
+    AOT_GOTO(0x0780, L0780);
+L0780:
+    AOT_BLOCK(0x0780, 3);
+    // 0780: mov dx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[2] = RD16(a);
+    }
+    // 0783: cmp [bp-8], dx
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0786: jb 078b
+    if (CF)
+        AOT_GOTO(0x078b, L078b);
+    AOT_GOTO(0x0788, L0788);
+L0788:
+    AOT_BLOCK(0x0788, 1);
+    // 0788: jmp 0819
+    AOT_GOTO(0x0819, L0819);
+L078b:
+    AOT_BLOCK(0x078b, 5);
+    // 078b: mov dx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[2] = RD16(a);
+    }
+    // 078e: inc dx
+    {
+        val = int16_t(r[2]) + 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 078f: mov [bp+4], dx
+    {
+        a = uint16_t(r[5] + 4);
+        WR16(a, r[2]);
+    }
+    // 0792: mov dx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[2] = RD16(a);
+    }
+    // 0795: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x0798, L0798);
+L0798:
+    AOT_BLOCK(0x0798, 9);
+    // 0798: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 079b: sub ax, 04b0
+    {
+        val = (dst = int16_t(r[0])) - (src = 1200);
+        r[0] = val;
+    }
+    // 079e: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 079f: add ax, [e354]
+    {
+        a = 0xe354;
+        val = (dst = int16_t(r[0])) + (src = int16_t(RD16(a)));
+        r[0] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 07a3: adc dx, [e356]
+    {
+        a = 0xe356;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a))) + CF;
+        r[2] = val;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+    }
+    // 07a7: mov [bp-e], ax
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[0]);
+    }
+    // 07aa: mov [bp-c], dx
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, r[2]);
+    }
+    // 07ad: xor di, di
+    {
+        val = int16_t(r[7]) ^ int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 07af: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x07b2, L07b2);
+L07b2:
+    AOT_BLOCK(0x07b2, 2);
+    // 07b2: cmp di, 0080
+    {
+        val = (dst = int16_t(r[7])) - (src = 128);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 07b6: je 07bd
+    if (ZF)
+        AOT_GOTO(0x07bd, L07bd);
+    AOT_GOTO(0x07b8, L07b8);
+L07b8:
+    AOT_BLOCK(0x07b8, 2);
+    // 07b8: cmp [bp-6], si
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 07bb: jne 07f4
+    if (!ZF)
+        AOT_GOTO(0x07f4, L07f4);
+    AOT_GOTO(0x07bd, L07bd);
+L07bd:
+    AOT_BLOCK(0x07bd, 2);
+    // 07bd: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 07bf: jle 07ef
+    if (ZF || SF != OF)
+        AOT_GOTO(0x07ef, L07ef);
+    AOT_GOTO(0x07c1, L07c1);
+L07c1:
+    AOT_BLOCK(0x07c1, 6);
+    // 07c1: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 07c3: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 07c4: push [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 07c7: push [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 07ca: push [e35c]
+    {
+        a = 0xe35c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 07ce: call 08f2
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x07d1);
+    }
+    AOT_GOTO(0x08f2, L08f2);
+L07d1:
+    AOT_BLOCK(0x07d1, 6);
+    // 07d1: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 07d4: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 07d5: lea ax, [bp-92]
+    {
+        a = uint16_t(r[5] - 146);
+        r[0] = a;
+    }
+    // 07d9: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 07da: push [e35c]
+    {
+        a = 0xe35c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 07de: call 08fe
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x07e1);
+    }
+    AOT_GOTO(0x08fe, L08fe);
+L07e1:
+    AOT_BLOCK(0x07e1, 6);
+    // 07e1: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 07e4: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 07e6: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 07e7: add [bp-e], ax
+    {
+        a = uint16_t(r[5] - 14);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[0]));
+        WR16(a, val);
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 07ea: adc [bp-c], dx
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2])) + CF;
+        WR16(a, val);
+        AF = (dst & 15) + (src & 15) + CF > 15;
+    }
+    // 07ed: xor di, di
+    {
+        val = int16_t(r[7]) ^ int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x07ef, L07ef);
+L07ef:
+    AOT_BLOCK(0x07ef, 2);
+    // 07ef: cmp [bp-6], si
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 07f2: je 0819
+    if (ZF)
+        AOT_GOTO(0x0819, L0819);
+    AOT_GOTO(0x07f4, L07f4);
+L07f4:
+    AOT_BLOCK(0x07f4, 4);
+    // 07f4: mov al, [si]
+    {
+        a = uint16_t(r[6]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 07f6: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 07f7: cmp al, a
+    {
+        val = (dst = int8_t(r[0])) - (src = 10);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 07f9: jne 0800
+    if (!ZF)
+        AOT_GOTO(0x0800, L0800);
+    AOT_GOTO(0x07fb, L07fb);
+L07fb:
+    AOT_BLOCK(0x07fb, 2);
+    // 07fb: mov ax, 000a
+    {
+        r[0] = 0x000a;
+    }
+    // 07fe: jmp short 0803
+    AOT_GOTO(0x0803, L0803);
+L0800:
+    AOT_BLOCK(0x0800, 1);
+    // 0800: mov ax, 0020
+    {
+        r[0] = 0x0020;
+    }
+    AOT_GOTO(0x0803, L0803);
+L0803:
+    AOT_BLOCK(0x0803, 14);
+    // 0803: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0804: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 0806: inc dx
+    {
+        val = int16_t(r[2]) + 1;
+        r[2] = val;
+    }
+    // 0807: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0808: lea ax, [bp-92]
+    {
+        a = uint16_t(r[5] - 146);
+        r[0] = a;
+    }
+    // 080c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 080d: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 080e: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 0810: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 0811: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0812: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0814: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 0815: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 0817: jmp short 07b2
+    AOT_GOTO(0x07b2, L07b2);
+L0819:
+    AOT_BLOCK(0x0819, 1);
+    // 0819: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L081c:
+    AOT_BLOCK(0x081c, 4);
+    // 081c: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 081d: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 081f: cmp [028a], 0
+    {
+        a = 0x028a;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0824: je 082c
+    if (ZF)
+        AOT_GOTO(0x082c, L082c);
+    AOT_GOTO(0x0826, L0826);
+L0826:
+    AOT_BLOCK(0x0826, 2);
+    // 0826: mov bx, [028a]
+    {
+        a = 0x028a;
+        r[3] = RD16(a);
+    }
+    // 082a: call bx
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x082c);
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L082c:
+    AOT_BLOCK(0x082c, 3);
+    // 082c: mov ax, 0006
+    {
+        r[0] = 0x0006;
+    }
+    // 082f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0830: call 086e
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0833);
+    }
+    AOT_GOTO(0x086e, L086e);
+L0833:
+    AOT_BLOCK(0x0833, 2);
+    // 0833: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0834: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L0837:
+    AOT_BLOCK(0x0837, 4);
+    // 0837: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0838: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 083a: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 083b: mov si, [0288]
+    {
+        a = 0x0288;
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x083f, L083f);
+L083f:
+    AOT_BLOCK(0x083f, 2);
+    // 083f: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 0840: jl 084e
+    if (SF != OF)
+        AOT_GOTO(0x084e, L084e);
+    AOT_GOTO(0x0842, L0842);
+L0842:
+    AOT_BLOCK(0x0842, 4);
+    // 0842: mov bx, si
+    {
+        r[3] = r[6];
+    }
+    // 0844: shl bx, 1
+    {
+        val = r[3] << 1;
+        r[3] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 0846: mov bx, [bx-1ca0]
+    {
+        a = uint16_t(r[3] - 7328);
+        r[3] = RD16(a);
+    }
+    // 084a: call bx
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x084c);
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L084c:
+    AOT_BLOCK(0x084c, 1);
+    // 084c: jmp short 083f
+    AOT_GOTO(0x083f, L083f);
+L084e:
+    AOT_BLOCK(0x084e, 1);
+    // 084e: jmp 1af8
+    AOT_GOTO(0x1af8, L1af8);
+L0851:
+    AOT_BLOCK(0x0851, 3);
+    // 0851: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0852: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0854: call 0837
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0857);
+    }
+    AOT_GOTO(0x0837, L0837);
+L0857:
+    AOT_BLOCK(0x0857, 2);
+    // 0857: cmp [028a], 0
+    {
+        a = 0x028a;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 085c: je 0864
+    if (ZF)
+        AOT_GOTO(0x0864, L0864);
+    AOT_GOTO(0x085e, L085e);
+L085e:
+    AOT_BLOCK(0x085e, 2);
+    // 085e: mov bx, [028a]
+    {
+        a = 0x028a;
+        r[3] = RD16(a);
+    }
+    // 0862: call bx
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0864);
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L0864:
+    AOT_BLOCK(0x0864, 2);
+    // 0864: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0867: call 08ee
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x086a);
+    }
+    AOT_GOTO(0x08ee, L08ee);
+L086a:
+    AOT_BLOCK(0x086a, 2);
+    // 086a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 086b: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L086e:
+    AOT_BLOCK(0x086e, 4);
+    // 086e: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 086f: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0871: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0875: jl 087d
+    if (SF != OF)
+        AOT_GOTO(0x087d, L087d);
+    AOT_GOTO(0x0877, L0877);
+L0877:
+    AOT_BLOCK(0x0877, 2);
+    // 0877: cmp [bp+4], 11
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 17);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 087b: jle 0882
+    if (ZF || SF != OF)
+        AOT_GOTO(0x0882, L0882);
+    AOT_GOTO(0x087d, L087d);
+L087d:
+    AOT_BLOCK(0x087d, 2);
+    // 087d: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 0880: jmp short 088e
+    AOT_GOTO(0x088e, L088e);
+L0882:
+    AOT_BLOCK(0x0882, 2);
+    // 0882: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0885: call 0891
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0888);
+    }
+    AOT_GOTO(0x0891, L0891);
+L0888:
+    AOT_BLOCK(0x0888, 2);
+    // 0888: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0889: call 08ab
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x088c);
+    }
+    AOT_GOTO(0x08ab, L08ab);
+L088c:
+    AOT_BLOCK(0x088c, 2);
+    // 088c: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 088d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x088e, L088e);
+L088e:
+    AOT_BLOCK(0x088e, 1);
+    // 088e: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L0891:
+    AOT_BLOCK(0x0891, 10);
+    // 0891: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0892: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0894: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 0897: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 089a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 089b: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 089e: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 089f: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 08a1: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 08a2: call 0919
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x08a5);
+    }
+    AOT_GOTO(0x0919, L0919);
+L08a5:
+    AOT_BLOCK(0x08a5, 2);
+    // 08a5: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 08a8: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L08ab:
+    AOT_BLOCK(0x08ab, 14);
+    // 08ab: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 08ac: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 08ae: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 08b1: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 08b4: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 08b7: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 08ba: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 08bd: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 08c0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 08c1: mov ax, 0025
+    {
+        r[0] = 0x0025;
+    }
+    // 08c4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 08c5: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 08c7: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 08c8: call 0919
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x08cb);
+    }
+    AOT_GOTO(0x0919, L0919);
+L08cb:
+    AOT_BLOCK(0x08cb, 2);
+    // 08cb: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 08ce: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L08d1:
+    AOT_BLOCK(0x08d1, 10);
+    // 08d1: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 08d2: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 08d4: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 08d5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 08d6: lea bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = a;
+    }
+    // 08d9: mov [bp-2], bx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[3]);
+    }
+    // 08dc: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 08df: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 08e2: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 08e5: call 0c51
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x08e8);
+    }
+    AOT_GOTO(0x0c51, L0c51);
+L08e8:
+    AOT_BLOCK(0x08e8, 2);
+    // 08e8: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 08eb: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L08ee:
+    AOT_BLOCK(0x08ee, 1);
+    // 08ee: jmp 0953
+    AOT_GOTO(0x0953, L0953);
+L08f2:
+    AOT_BLOCK(0x08f2, 1);
+    // 08f2: jmp 0973
+    AOT_GOTO(0x0973, L0973);
+L08f6:
+    AOT_BLOCK(0x08f6, 1);
+    // 08f6: jmp 09bc
+    AOT_GOTO(0x09bc, L09bc);
+L08fa:
+    AOT_BLOCK(0x08fa, 1);
+    // 08fa: jmp 0a17
+    AOT_GOTO(0x0a17, L0a17);
+L08fe:
+    AOT_BLOCK(0x08fe, 1);
+    // 08fe: jmp 0a44
+    AOT_GOTO(0x0a44, L0a44);
+L0902:
+    AOT_BLOCK(0x0902, 1);
+    // 0902: jmp 1483
+    AOT_GOTO(0x1483, L1483);
+L0905:
+    AOT_BLOCK(0x0905, 2);
+    // 0905: mov cx, ffff
+    {
+        r[1] = 0xffff;
+    }
+    // 0908: jmp 14c2
+    AOT_GOTO(0x14c2, L14c2);
+L090b:
+    AOT_BLOCK(0x090b, 2);
+    // 090b: mov cx, ffff
+    {
+        r[1] = 0xffff;
+    }
+    // 090e: jmp 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L0911:
+    AOT_BLOCK(0x0911, 3);
+    // 0911: mov bx, sp
+    {
+        r[3] = r[4];
+    }
+    // 0913: mov cx, [bx+6]
+    {
+        a = uint16_t(r[3] + 6);
+        r[1] = RD16(a);
+    }
+    // 0916: jmp 14c2
+    AOT_GOTO(0x14c2, L14c2);
+L0919:
+    AOT_BLOCK(0x0919, 10);
+    // 0919: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 091a: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 091c: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 091d: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 091e: mov si, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[6] = RD16(a);
+    }
+    // 0921: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 0924: mov [si+2], dx
+    {
+        a = uint16_t(r[6] + 2);
+        WR16(a, r[2]);
+    }
+    // 0927: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0928: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 092b: call 1471
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x092e);
+    }
+    AOT_GOTO(0x1471, L1471);
+L092e:
+    AOT_BLOCK(0x092e, 5);
+    // 092e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 092f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0930: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 0932: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0934: je 0939
+    if (ZF)
+        AOT_GOTO(0x0939, L0939);
+    AOT_GOTO(0x0936, L0936);
+L0936:
+    AOT_BLOCK(0x0936, 1);
+    // 0936: mov [si+2], di
+    {
+        a = uint16_t(r[6] + 2);
+        WR16(a, r[7]);
+    }
+    AOT_GOTO(0x0939, L0939);
+L0939:
+    AOT_BLOCK(0x0939, 2);
+    // 0939: cmp [si+2], 0
+    {
+        a = uint16_t(r[6] + 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 093d: jnl 094d
+    if (SF == OF)
+        AOT_GOTO(0x094d, L094d);
+    AOT_GOTO(0x093f, L093f);
+L093f:
+    AOT_BLOCK(0x093f, 5);
+    // 093f: mov dx, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[2] = RD16(a);
+    }
+    // 0942: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 0944: mov [03a2], dx
+    {
+        a = 0x03a2;
+        WR16(a, r[2]);
+    }
+    // 0948: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 094b: jmp short 0950
+    AOT_GOTO(0x0950, L0950);
+L094d:
+    AOT_BLOCK(0x094d, 1);
+    // 094d: mov ax, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x0950, L0950);
+L0950:
+    AOT_BLOCK(0x0950, 1);
+    // 0950: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L0953:
+    AOT_BLOCK(0x0953, 12);
+    // 0953: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0954: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0956: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 0959: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 095c: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 095f: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 0962: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0963: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0966: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0967: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0969: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 096a: call 0919
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x096d);
+    }
+    AOT_GOTO(0x0919, L0919);
+L096d:
+    AOT_BLOCK(0x096d, 2);
+    // 096d: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0970: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L0973:
+    AOT_BLOCK(0x0973, 18);
+    // 0973: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0974: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0976: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0979: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 097c: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 097f: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 0982: mov cx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[1] = RD16(a);
+    }
+    // 0985: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 0988: mov [bp-c], cx
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, r[1]);
+    }
+    // 098b: mov dx, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[2] = RD16(a);
+    }
+    // 098e: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 0991: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 0994: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0995: mov ax, 0013
+    {
+        r[0] = 0x0013;
+    }
+    // 0998: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0999: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 099c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 099d: call 0919
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x09a0);
+    }
+    AOT_GOTO(0x0919, L0919);
+L09a0:
+    AOT_BLOCK(0x09a0, 3);
+    // 09a0: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 09a3: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 09a5: jnl 09b1
+    if (SF == OF)
+        AOT_GOTO(0x09b1, L09b1);
+    AOT_GOTO(0x09a7, L09a7);
+L09a7:
+    AOT_BLOCK(0x09a7, 5);
+    // 09a7: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 09aa: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 09ab: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 09ae: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 09af: jmp short 09b7
+    AOT_GOTO(0x09b7, L09b7);
+L09b1:
+    AOT_BLOCK(0x09b1, 2);
+    // 09b1: push [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 09b4: push [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    AOT_GOTO(0x09b7, L09b7);
+L09b7:
+    AOT_BLOCK(0x09b7, 3);
+    // 09b7: pop ax
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[0] = val;
+    }
+    // 09b8: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 09b9: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L09bc:
+    AOT_BLOCK(0x09bc, 7);
+    // 09bc: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 09bd: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 09bf: sub sp, 1a
+    {
+        val = (dst = int16_t(r[4])) - (src = 26);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 09c2: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 09c3: lea si, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[6] = a;
+    }
+    // 09c6: test byte [bp+6], 40
+    {
+        a = uint16_t(r[5] + 6);
+        val = int8_t(RD8(a)) & 64;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 09ca: je 09f0
+    if (ZF)
+        AOT_GOTO(0x09f0, L09f0);
+    AOT_GOTO(0x09cc, L09cc);
+L09cc:
+    AOT_BLOCK(0x09cc, 2);
+    // 09cc: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 09cf: call 090b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x09d2);
+    }
+    AOT_GOTO(0x090b, L090b);
+L09d2:
+    AOT_BLOCK(0x09d2, 12);
+    // 09d2: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 09d3: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 09d4: mov [bp-16], ax
+    {
+        a = uint16_t(r[5] - 22);
+        WR16(a, r[0]);
+    }
+    // 09d7: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 09da: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 09dd: lea bx, [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        r[3] = a;
+    }
+    // 09e0: mov si, bx
+    {
+        r[6] = r[3];
+    }
+    // 09e2: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 09e5: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 09e8: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 09eb: mov [bp-10], dx
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, r[2]);
+    }
+    // 09ee: jmp short 0a02
+    AOT_GOTO(0x0a02, L0a02);
+L09f0:
+    AOT_BLOCK(0x09f0, 4);
+    // 09f0: lea ax, [bp-1a]
+    {
+        a = uint16_t(r[5] - 26);
+        r[0] = a;
+    }
+    // 09f3: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 09f4: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 09f7: call 1850
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x09fa);
+    }
+    AOT_GOTO(0x1850, L1850);
+L09fa:
+    AOT_BLOCK(0x09fa, 4);
+    // 09fa: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 09fb: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 09fc: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 09ff: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x0a02, L0a02);
+L0a02:
+    AOT_BLOCK(0x0a02, 7);
+    // 0a02: lea ax, [bp-1a]
+    {
+        a = uint16_t(r[5] - 26);
+        r[0] = a;
+    }
+    // 0a05: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a06: mov ax, 0005
+    {
+        r[0] = 0x0005;
+    }
+    // 0a09: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a0a: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0a0d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a0e: call 0919
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0a11);
+    }
+    AOT_GOTO(0x0919, L0919);
+L0a11:
+    AOT_BLOCK(0x0a11, 2);
+    // 0a11: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0a14: jmp 1af8
+    AOT_GOTO(0x1af8, L1af8);
+L0a17:
+    AOT_BLOCK(0x0a17, 4);
+    // 0a17: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0a18: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0a1a: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0a1d: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    AOT_GOTO(0x0a20, L0a20);
+L0a20:
+    AOT_BLOCK(0x0a20, 12);
+    // 0a20: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 0a23: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 0a26: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 0a29: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 0a2c: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 0a2f: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 0a32: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a33: mov ax, 0003
+    {
+        r[0] = 0x0003;
+    }
+    // 0a36: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a37: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0a3a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a3b: call 0919
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0a3e);
+    }
+    AOT_GOTO(0x0919, L0919);
+L0a3e:
+    AOT_BLOCK(0x0a3e, 2);
+    // 0a3e: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0a41: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L0a44:
+    AOT_BLOCK(0x0a44, 16);
+    // 0a44: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0a45: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0a47: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0a4a: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 0a4d: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 0a50: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 0a53: mov [bp-12], dx
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, r[2]);
+    }
+    // 0a56: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 0a59: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 0a5c: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 0a5f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a60: mov ax, 0004
+    {
+        r[0] = 0x0004;
+    }
+    // 0a63: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a64: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 0a67: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a68: call 0919
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0a6b);
+    }
+    AOT_GOTO(0x0919, L0919);
+L0a6b:
+    AOT_BLOCK(0x0a6b, 2);
+    // 0a6b: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0a6e: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L0a71:
+    AOT_BLOCK(0x0a71, 2);
+    // 0a71: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0a72: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    AOT_GOTO(0x0a74, L0a74);
+L0a74:
+    AOT_BLOCK(0x0a74, 3);
+    // 0a74: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a75: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0a76: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    AOT_GOTO(0x0a77, L0a77);
+L0a77:
+    AOT_BLOCK(0x0a77, 4);
+    // 0a77: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0a78: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 0a7b: cmp byte [si], 2a
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int8_t(RD8(a))) - (src = 42);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0a7e: jne 0a9b
+    if (!ZF)
+        AOT_GOTO(0x0a9b, L0a9b);
+    AOT_GOTO(0x0a80, L0a80);
+L0a80:
+    AOT_BLOCK(0x0a80, 12);
+    // 0a80: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 0a83: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 0a85: mov cx, dx
+    {
+        r[1] = r[2];
+    }
+    // 0a87: add cx, 2
+    {
+        val = (dst = int16_t(r[1])) + (src = 2);
+        r[1] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0a8a: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 0a8d: mov [bx], cx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[1]);
+    }
+    // 0a8f: mov bx, dx
+    {
+        r[3] = r[2];
+    }
+    // 0a91: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 0a93: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 0a96: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 0a98: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0a99: jmp short 0ac0
+    AOT_GOTO(0x0ac0, L0ac0);
+L0a9b:
+    AOT_BLOCK(0x0a9b, 1);
+    // 0a9b: xor di, di
+    {
+        val = int16_t(r[7]) ^ int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0a9d, L0a9d);
+L0a9d:
+    AOT_BLOCK(0x0a9d, 5);
+    // 0a9d: mov al, [si]
+    {
+        a = uint16_t(r[6]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0a9f: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0aa0: sub ax, 0030
+    {
+        val = (dst = int16_t(r[0])) - (src = 48);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0aa3: mov [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[0]);
+    }
+    // 0aa6: jl 0abb
+    if (SF != OF)
+        AOT_GOTO(0x0abb, L0abb);
+    AOT_GOTO(0x0aa8, L0aa8);
+L0aa8:
+    AOT_BLOCK(0x0aa8, 2);
+    // 0aa8: cmp [bp-4], 9
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 9);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0aac: jnle 0abb
+    if (!(ZF || SF != OF))
+        AOT_GOTO(0x0abb, L0abb);
+    AOT_GOTO(0x0aae, L0aae);
+L0aae:
+    AOT_BLOCK(0x0aae, 6);
+    // 0aae: mov ax, 000a
+    {
+        r[0] = 0x000a;
+    }
+    // 0ab1: mul di
+    {
+        u32 = uint32_t(r[0]) * r[7];
+        r[2] = u32 >> 16;
+        r[0] = u32;
+    }
+    // 0ab3: add ax, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(r[0])) + (src = int16_t(RD16(a)));
+        r[0] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0ab6: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 0ab8: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0ab9: jmp short 0a9d
+    AOT_GOTO(0x0a9d, L0a9d);
+L0abb:
+    AOT_BLOCK(0x0abb, 2);
+    // 0abb: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 0abe: mov [bx], di
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[7]);
+    }
+    AOT_GOTO(0x0ac0, L0ac0);
+L0ac0:
+    AOT_BLOCK(0x0ac0, 2);
+    // 0ac0: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 0ac2: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L0ac5:
+    AOT_BLOCK(0x0ac5, 9);
+    // 0ac5: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0ac6: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0ac8: sub sp, c
+    {
+        val = (dst = int16_t(r[4])) - (src = 12);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0acb: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0acc: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0acd: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 0ad0: mov si, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[6] = RD16(a);
+    }
+    // 0ad3: mov [bp-a], si
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, r[6]);
+    }
+    // 0ad6: jmp 0b53
+    AOT_GOTO(0x0b53, L0b53);
+L0ad9:
+    AOT_BLOCK(0x0ad9, 2);
+    // 0ad9: cmp [bp+e], 0
+    {
+        a = uint16_t(r[5] + 14);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0add: je 0aef
+    if (ZF)
+        AOT_GOTO(0x0aef, L0aef);
+    AOT_GOTO(0x0adf, L0adf);
+L0adf:
+    AOT_BLOCK(0x0adf, 7);
+    // 0adf: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 0ae1: add [di], 2
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0ae4: mov ax, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = RD16(a);
+    }
+    // 0ae6: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 0ae7: mov [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[0]);
+    }
+    // 0aea: mov [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[2]);
+    }
+    // 0aed: jmp short 0b61
+    AOT_GOTO(0x0b61, L0b61);
+L0aef:
+    AOT_BLOCK(0x0aef, 6);
+    // 0aef: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 0af1: add [di], 2
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0af4: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 0af6: mov [bp-8], dx
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[2]);
+    }
+    // 0af9: mov [bp-6], 0000
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, 0x0000);
+    }
+    // 0afe: jmp short 0b61
+    AOT_GOTO(0x0b61, L0b61);
+L0b00:
+    AOT_BLOCK(0x0b00, 2);
+    // 0b00: cmp [bp+e], 0
+    {
+        a = uint16_t(r[5] + 14);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0b04: je 0b19
+    if (ZF)
+        AOT_GOTO(0x0b19, L0b19);
+    AOT_GOTO(0x0b06, L0b06);
+L0b06:
+    AOT_BLOCK(0x0b06, 7);
+    // 0b06: add [di], 4
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 4);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0b09: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 0b0b: mov dx, [bx-4]
+    {
+        a = uint16_t(r[3] - 4);
+        r[2] = RD16(a);
+    }
+    // 0b0e: mov cx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[1] = RD16(a);
+    }
+    // 0b11: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 0b14: mov [bp-2], cx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[1]);
+    }
+    // 0b17: jmp short 0b61
+    AOT_GOTO(0x0b61, L0b61);
+L0b19:
+    AOT_BLOCK(0x0b19, 7);
+    // 0b19: add [di], 4
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 4);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0b1c: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 0b1e: mov dx, [bx-4]
+    {
+        a = uint16_t(r[3] - 4);
+        r[2] = RD16(a);
+    }
+    // 0b21: mov cx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[1] = RD16(a);
+    }
+    // 0b24: mov [bp-8], dx
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[2]);
+    }
+    // 0b27: mov [bp-6], cx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[1]);
+    }
+    // 0b2a: jmp short 0b61
+    AOT_GOTO(0x0b61, L0b61);
+L0b2c:
+    AOT_BLOCK(0x0b2c, 2);
+    // 0b2c: cmp [bp+e], 0
+    {
+        a = uint16_t(r[5] + 14);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0b30: je 0b42
+    if (ZF)
+        AOT_GOTO(0x0b42, L0b42);
+    AOT_GOTO(0x0b32, L0b32);
+L0b32:
+    AOT_BLOCK(0x0b32, 7);
+    // 0b32: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 0b34: add [di], 2
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0b37: mov ax, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = RD16(a);
+    }
+    // 0b39: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 0b3a: mov [bp-4], ax
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[0]);
+    }
+    // 0b3d: mov [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[2]);
+    }
+    // 0b40: jmp short 0b61
+    AOT_GOTO(0x0b61, L0b61);
+L0b42:
+    AOT_BLOCK(0x0b42, 6);
+    // 0b42: mov bx, [di]
+    {
+        a = uint16_t(r[7]);
+        r[3] = RD16(a);
+    }
+    // 0b44: add [di], 2
+    {
+        a = uint16_t(r[7]);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0b47: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 0b49: mov [bp-8], dx
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[2]);
+    }
+    // 0b4c: mov [bp-6], 0000
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, 0x0000);
+    }
+    // 0b51: jmp short 0b61
+    AOT_GOTO(0x0b61, L0b61);
+L0b53:
+    AOT_BLOCK(0x0b53, 5);
+    // 0b53: mov dx, 0060
+    {
+        r[2] = 0x0060;
+    }
+    // 0b56: and dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(r[2]) & int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0b59: mov bx, 02da
+    {
+        r[3] = 0x02da;
+    }
+    // 0b5c: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 0b5e: jmp 1a80
+    AOT_GOTO(0x1a80, L1a80);
+L0b61:
+    AOT_BLOCK(0x0b61, 2);
+    // 0b61: cmp [bp+e], 0
+    {
+        a = uint16_t(r[5] + 14);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0b65: je 0b9f
+    if (ZF)
+        AOT_GOTO(0x0b9f, L0b9f);
+    AOT_GOTO(0x0b67, L0b67);
+L0b67:
+    AOT_BLOCK(0x0b67, 2);
+    // 0b67: cmp [bp-2], 0
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0b6b: jnl 0b7d
+    if (SF == OF)
+        AOT_GOTO(0x0b7d, L0b7d);
+    AOT_GOTO(0x0b6d, L0b6d);
+L0b6d:
+    AOT_BLOCK(0x0b6d, 6);
+    // 0b6d: mov byte [si], 2d
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 45);
+    }
+    // 0b70: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 0b71: neg [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        src = int16_t(RD16(a));
+        val = -src;
+        WR16(a, val);
+    }
+    // 0b74: neg [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        src = int16_t(RD16(a));
+        val = -src;
+        WR16(a, val);
+        CF = src != 0;
+    }
+    // 0b77: sbb [bp-2], 0
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0) - CF;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) - CF < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src + CF) || (CF && !(src + 1));
+    }
+    // 0b7b: jmp short 0b93
+    AOT_GOTO(0x0b93, L0b93);
+L0b7d:
+    AOT_BLOCK(0x0b7d, 2);
+    // 0b7d: test byte [bp+6], 2
+    {
+        a = uint16_t(r[5] + 6);
+        val = int8_t(RD8(a)) & 2;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0b81: je 0b89
+    if (ZF)
+        AOT_GOTO(0x0b89, L0b89);
+    AOT_GOTO(0x0b83, L0b83);
+L0b83:
+    AOT_BLOCK(0x0b83, 3);
+    // 0b83: mov byte [si], 2b
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 43);
+    }
+    // 0b86: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0b87: jmp short 0b93
+    AOT_GOTO(0x0b93, L0b93);
+L0b89:
+    AOT_BLOCK(0x0b89, 2);
+    // 0b89: test byte [bp+6], 4
+    {
+        a = uint16_t(r[5] + 6);
+        val = int8_t(RD8(a)) & 4;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0b8d: je 0b93
+    if (ZF)
+        AOT_GOTO(0x0b93, L0b93);
+    AOT_GOTO(0x0b8f, L0b8f);
+L0b8f:
+    AOT_BLOCK(0x0b8f, 2);
+    // 0b8f: mov byte [si], 20
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 32);
+    }
+    // 0b92: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x0b93, L0b93);
+L0b93:
+    AOT_BLOCK(0x0b93, 4);
+    // 0b93: mov dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[2] = RD16(a);
+    }
+    // 0b96: mov cx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[1] = RD16(a);
+    }
+    // 0b99: mov [bp-8], dx
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[2]);
+    }
+    // 0b9c: mov [bp-6], cx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[1]);
+    }
+    AOT_GOTO(0x0b9f, L0b9f);
+L0b9f:
+    AOT_BLOCK(0x0b9f, 2);
+    // 0b9f: test byte [bp+6], 8
+    {
+        a = uint16_t(r[5] + 6);
+        val = int8_t(RD8(a)) & 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0ba3: je 0baf
+    if (ZF)
+        AOT_GOTO(0x0baf, L0baf);
+    AOT_GOTO(0x0ba5, L0ba5);
+L0ba5:
+    AOT_BLOCK(0x0ba5, 2);
+    // 0ba5: cmp byte [bp+a], 6f
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 111);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0ba9: jne 0baf
+    if (!ZF)
+        AOT_GOTO(0x0baf, L0baf);
+    AOT_GOTO(0x0bab, L0bab);
+L0bab:
+    AOT_BLOCK(0x0bab, 2);
+    // 0bab: mov byte [si], 30
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 48);
+    }
+    // 0bae: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x0baf, L0baf);
+L0baf:
+    AOT_BLOCK(0x0baf, 3);
+    // 0baf: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 0bb2: or dx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = int16_t(r[2]) | int16_t(RD16(a));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0bb5: jne 0bc2
+    if (!ZF)
+        AOT_GOTO(0x0bc2, L0bc2);
+    AOT_GOTO(0x0bb7, L0bb7);
+L0bb7:
+    AOT_BLOCK(0x0bb7, 2);
+    // 0bb7: cmp [bp+c], 0
+    {
+        a = uint16_t(r[5] + 12);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0bbb: jne 0c0d
+    if (!ZF)
+        AOT_GOTO(0x0c0d, L0c0d);
+    AOT_GOTO(0x0bbd, L0bbd);
+L0bbd:
+    AOT_BLOCK(0x0bbd, 2);
+    // 0bbd: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 0bbf: jmp 0c4e
+    AOT_GOTO(0x0c4e, L0c4e);
+L0bc2:
+    AOT_BLOCK(0x0bc2, 2);
+    // 0bc2: test byte [bp+6], 8
+    {
+        a = uint16_t(r[5] + 6);
+        val = int8_t(RD8(a)) & 8;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0bc6: je 0bd4
+    if (ZF)
+        AOT_GOTO(0x0bd4, L0bd4);
+    AOT_GOTO(0x0bc8, L0bc8);
+L0bc8:
+    AOT_BLOCK(0x0bc8, 2);
+    // 0bc8: cmp byte [bp+a], 78
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 120);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0bcc: je 0bda
+    if (ZF)
+        AOT_GOTO(0x0bda, L0bda);
+    AOT_GOTO(0x0bce, L0bce);
+L0bce:
+    AOT_BLOCK(0x0bce, 2);
+    // 0bce: cmp byte [bp+a], 58
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 88);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0bd2: je 0bda
+    if (ZF)
+        AOT_GOTO(0x0bda, L0bda);
+    AOT_GOTO(0x0bd4, L0bd4);
+L0bd4:
+    AOT_BLOCK(0x0bd4, 2);
+    // 0bd4: cmp byte [bp+a], 70
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 112);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0bd8: jne 0c0d
+    if (!ZF)
+        AOT_GOTO(0x0c0d, L0c0d);
+    AOT_GOTO(0x0bda, L0bda);
+L0bda:
+    AOT_BLOCK(0x0bda, 4);
+    // 0bda: mov byte [si], 30
+    {
+        a = uint16_t(r[6]);
+        WR8(a, 48);
+    }
+    // 0bdd: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+    }
+    // 0bde: cmp byte [bp+a], 58
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 88);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0be2: jne 0be9
+    if (!ZF)
+        AOT_GOTO(0x0be9, L0be9);
+    AOT_GOTO(0x0be4, L0be4);
+L0be4:
+    AOT_BLOCK(0x0be4, 2);
+    // 0be4: mov ax, 0058
+    {
+        r[0] = 0x0058;
+    }
+    // 0be7: jmp short 0bec
+    AOT_GOTO(0x0bec, L0bec);
+L0be9:
+    AOT_BLOCK(0x0be9, 1);
+    // 0be9: mov ax, 0078
+    {
+        r[0] = 0x0078;
+    }
+    AOT_GOTO(0x0bec, L0bec);
+L0bec:
+    AOT_BLOCK(0x0bec, 3);
+    // 0bec: mov [si], al
+    {
+        a = uint16_t(r[6]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 0bee: inc si
+    {
+        val = int16_t(r[6]) + 1;
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0bef: jmp short 0c0d
+    AOT_GOTO(0x0c0d, L0c0d);
+L0bf1:
+    AOT_BLOCK(0x0bf1, 2);
+    // 0bf1: mov [bp-c], 0002
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0002);
+    }
+    // 0bf6: jmp short 0c17
+    AOT_GOTO(0x0c17, L0c17);
+L0bf8:
+    AOT_BLOCK(0x0bf8, 2);
+    // 0bf8: mov [bp-c], 0008
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0008);
+    }
+    // 0bfd: jmp short 0c17
+    AOT_GOTO(0x0c17, L0c17);
+L0bff:
+    AOT_BLOCK(0x0bff, 2);
+    // 0bff: mov [bp-c], 000a
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x000a);
+    }
+    // 0c04: jmp short 0c17
+    AOT_GOTO(0x0c17, L0c17);
+L0c06:
+    AOT_BLOCK(0x0c06, 2);
+    // 0c06: mov [bp-c], 0010
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0010);
+    }
+    // 0c0b: jmp short 0c17
+    AOT_GOTO(0x0c17, L0c17);
+L0c0d:
+    AOT_BLOCK(0x0c0d, 4);
+    // 0c0d: mov al, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0c10: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0c11: mov bx, 02e6
+    {
+        r[3] = 0x02e6;
+    }
+    // 0c14: jmp 1a80
+    AOT_GOTO(0x1a80, L1a80);
+L0c17:
+    AOT_BLOCK(0x0c17, 6);
+    // 0c17: push [bp+c]
+    {
+        a = uint16_t(r[5] + 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0c1a: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0c1b: push [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0c1e: push [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0c21: push [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0c24: call 1401
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0c27);
+    }
+    AOT_GOTO(0x1401, L1401);
+L0c27:
+    AOT_BLOCK(0x0c27, 4);
+    // 0c27: add sp, a
+    {
+        val = (dst = int16_t(r[4])) + (src = 10);
+        r[4] = val;
+    }
+    // 0c2a: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 0c2c: cmp byte [bp+a], 58
+    {
+        a = uint16_t(r[5] + 10);
+        val = (dst = int8_t(RD8(a))) - (src = 88);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0c30: jne 0c4c
+    if (!ZF)
+        AOT_GOTO(0x0c4c, L0c4c);
+    AOT_GOTO(0x0c32, L0c32);
+L0c32:
+    AOT_BLOCK(0x0c32, 2);
+    // 0c32: cmp [bp-a], si
+    {
+        a = uint16_t(r[5] - 10);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0c35: je 0c4c
+    if (ZF)
+        AOT_GOTO(0x0c4c, L0c4c);
+    AOT_GOTO(0x0c37, L0c37);
+L0c37:
+    AOT_BLOCK(0x0c37, 5);
+    // 0c37: mov bx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[3] = RD16(a);
+    }
+    // 0c3a: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0c3c: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0c3d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0c3e: call 17a9
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0c41);
+    }
+    AOT_GOTO(0x17a9, L17a9);
+L0c41:
+    AOT_BLOCK(0x0c41, 5);
+    // 0c41: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0c42: mov bx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[3] = RD16(a);
+    }
+    // 0c45: mov [bx], al
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 0c47: inc [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0c4a: jmp short 0c32
+    AOT_GOTO(0x0c32, L0c32);
+L0c4c:
+    AOT_BLOCK(0x0c4c, 1);
+    // 0c4c: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    AOT_GOTO(0x0c4e, L0c4e);
+L0c4e:
+    AOT_BLOCK(0x0c4e, 1);
+    // 0c4e: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L0c51:
+    AOT_BLOCK(0x0c51, 7);
+    // 0c51: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 0c52: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 0c54: sub sp, 041a
+    {
+        val = (dst = int16_t(r[4])) - (src = 1050);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0c58: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0c59: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0c5a: mov si, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[6] = RD16(a);
+    }
+    // 0c5d: mov [bp-14], 0000
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x0c62, L0c62);
+L0c62:
+    AOT_BLOCK(0x0c62, 7);
+    // 0c62: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 0c65: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        AF = !(val & 15);
+    }
+    // 0c68: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0c6a: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0c6b: mov [bp-8], ax
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[0]);
+    }
+    // 0c6e: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0c70: jne 0c75
+    if (!ZF)
+        AOT_GOTO(0x0c75, L0c75);
+    AOT_GOTO(0x0c72, L0c72);
+L0c72:
+    AOT_BLOCK(0x0c72, 1);
+    // 0c72: jmp 11ad
+    AOT_GOTO(0x11ad, L11ad);
+L0c75:
+    AOT_BLOCK(0x0c75, 2);
+    // 0c75: cmp [bp-8], 25
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) - (src = 37);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0c79: je 0cbb
+    if (ZF)
+        AOT_GOTO(0x0cbb, L0cbb);
+    AOT_GOTO(0x0c7b, L0c7b);
+L0c7b:
+    AOT_BLOCK(0x0c7b, 4);
+    // 0c7b: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 0c7d: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 0c7e: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 0c80: jl 0c92
+    if (SF != OF)
+        AOT_GOTO(0x0c92, L0c92);
+    AOT_GOTO(0x0c82, L0c82);
+L0c82:
+    AOT_BLOCK(0x0c82, 7);
+    // 0c82: mov dx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[2] = RD16(a);
+    }
+    // 0c85: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 0c87: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 0c8a: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0c8d: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 0c8f: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 0c90: jmp short 0c9c
+    AOT_GOTO(0x0c9c, L0c9c);
+L0c92:
+    AOT_BLOCK(0x0c92, 3);
+    // 0c92: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0c93: push [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0c96: call 11ec
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0c99);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L0c99:
+    AOT_BLOCK(0x0c99, 3);
+    // 0c99: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0c9a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0c9b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x0c9c, L0c9c);
+L0c9c:
+    AOT_BLOCK(0x0c9c, 3);
+    // 0c9c: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 0c9d: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0ca0: jne 0cb6
+    if (!ZF)
+        AOT_GOTO(0x0cb6, L0cb6);
+    AOT_GOTO(0x0ca2, L0ca2);
+L0ca2:
+    AOT_BLOCK(0x0ca2, 2);
+    // 0ca2: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0ca6: je 0cb0
+    if (ZF)
+        AOT_GOTO(0x0cb0, L0cb0);
+    AOT_GOTO(0x0ca8, L0ca8);
+L0ca8:
+    AOT_BLOCK(0x0ca8, 3);
+    // 0ca8: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 0cab: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 0cad: jmp 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L0cb0:
+    AOT_BLOCK(0x0cb0, 2);
+    // 0cb0: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 0cb3: jmp 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L0cb6:
+    AOT_BLOCK(0x0cb6, 2);
+    // 0cb6: inc [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0cb9: jmp short 0c62
+    AOT_GOTO(0x0c62, L0c62);
+L0cbb:
+    AOT_BLOCK(0x0cbb, 2);
+    // 0cbb: xor di, di
+    {
+        val = int16_t(r[7]) ^ int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0cbd: jmp short 0ce3
+    AOT_GOTO(0x0ce3, L0ce3);
+L0cbf:
+    AOT_BLOCK(0x0cbf, 2);
+    // 0cbf: or di, 0001
+    {
+        val = int16_t(r[7]) | 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0cc3: jmp short 0cef
+    AOT_GOTO(0x0cef, L0cef);
+L0cc5:
+    AOT_BLOCK(0x0cc5, 2);
+    // 0cc5: or di, 0002
+    {
+        val = int16_t(r[7]) | 2;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0cc9: jmp short 0cef
+    AOT_GOTO(0x0cef, L0cef);
+L0ccb:
+    AOT_BLOCK(0x0ccb, 2);
+    // 0ccb: or di, 0004
+    {
+        val = int16_t(r[7]) | 4;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0ccf: jmp short 0cef
+    AOT_GOTO(0x0cef, L0cef);
+L0cd1:
+    AOT_BLOCK(0x0cd1, 2);
+    // 0cd1: or di, 0008
+    {
+        val = int16_t(r[7]) | 8;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0cd5: jmp short 0cef
+    AOT_GOTO(0x0cef, L0cef);
+L0cd7:
+    AOT_BLOCK(0x0cd7, 2);
+    // 0cd7: or di, 0010
+    {
+        val = int16_t(r[7]) | 16;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0cdb: jmp short 0cef
+    AOT_GOTO(0x0cef, L0cef);
+L0cdd:
+    AOT_BLOCK(0x0cdd, 2);
+    // 0cdd: or di, 1000
+    {
+        val = int16_t(r[7]) | 4096;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0ce1: jmp short 0cf2
+    AOT_GOTO(0x0cf2, L0cf2);
+L0ce3:
+    AOT_BLOCK(0x0ce3, 5);
+    // 0ce3: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 0ce6: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0ce8: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0ce9: mov bx, 030a
+    {
+        r[3] = 0x030a;
+    }
+    // 0cec: jmp 1a80
+    AOT_GOTO(0x1a80, L1a80);
+L0cef:
+    AOT_BLOCK(0x0cef, 1);
+    // 0cef: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x0cf2, L0cf2);
+L0cf2:
+    AOT_BLOCK(0x0cf2, 2);
+    // 0cf2: test di, 1000
+    {
+        val = int16_t(r[7]) & 4096;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0cf6: je 0ce3
+    if (ZF)
+        AOT_GOTO(0x0ce3, L0ce3);
+    AOT_GOTO(0x0cf8, L0cf8);
+L0cf8:
+    AOT_BLOCK(0x0cf8, 8);
+    // 0cf8: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 0cfb: mov [bp-16], dx
+    {
+        a = uint16_t(r[5] - 22);
+        WR16(a, r[2]);
+    }
+    // 0cfe: lea ax, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[0] = a;
+    }
+    // 0d01: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0d02: lea ax, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[0] = a;
+    }
+    // 0d05: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0d06: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0d09: call 0a71
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0d0c);
+    }
+    AOT_GOTO(0x0a71, L0a71);
+L0d0c:
+    AOT_BLOCK(0x0d0c, 4);
+    // 0d0c: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 0d0f: mov [bp+4], ax
+    {
+        a = uint16_t(r[5] + 4);
+        WR16(a, r[0]);
+    }
+    // 0d12: cmp [bp-16], ax
+    {
+        a = uint16_t(r[5] - 22);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[0]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0d15: je 0d1b
+    if (ZF)
+        AOT_GOTO(0x0d1b, L0d1b);
+    AOT_GOTO(0x0d17, L0d17);
+L0d17:
+    AOT_BLOCK(0x0d17, 1);
+    // 0d17: or di, 0100
+    {
+        val = int16_t(r[7]) | 256;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0d1b, L0d1b);
+L0d1b:
+    AOT_BLOCK(0x0d1b, 3);
+    // 0d1b: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 0d1e: cmp byte [bx], 2e
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 46);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0d21: jne 0d4a
+    if (!ZF)
+        AOT_GOTO(0x0d4a, L0d4a);
+    AOT_GOTO(0x0d23, L0d23);
+L0d23:
+    AOT_BLOCK(0x0d23, 9);
+    // 0d23: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0d26: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 0d29: mov [bp-16], dx
+    {
+        a = uint16_t(r[5] - 22);
+        WR16(a, r[2]);
+    }
+    // 0d2c: lea ax, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[0] = a;
+    }
+    // 0d2f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0d30: lea ax, [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        r[0] = a;
+    }
+    // 0d33: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0d34: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0d37: call 0a71
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0d3a);
+    }
+    AOT_GOTO(0x0a71, L0a71);
+L0d3a:
+    AOT_BLOCK(0x0d3a, 4);
+    // 0d3a: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 0d3d: mov [bp+4], ax
+    {
+        a = uint16_t(r[5] + 4);
+        WR16(a, r[0]);
+    }
+    // 0d40: cmp [bp-c], 0
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0d44: jl 0d4a
+    if (SF != OF)
+        AOT_GOTO(0x0d4a, L0d4a);
+    AOT_GOTO(0x0d46, L0d46);
+L0d46:
+    AOT_BLOCK(0x0d46, 1);
+    // 0d46: or di, 0200
+    {
+        val = int16_t(r[7]) | 512;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0d4a, L0d4a);
+L0d4a:
+    AOT_BLOCK(0x0d4a, 2);
+    // 0d4a: test di, 0100
+    {
+        val = int16_t(r[7]) & 256;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0d4e: je 0d5d
+    if (ZF)
+        AOT_GOTO(0x0d5d, L0d5d);
+    AOT_GOTO(0x0d50, L0d50);
+L0d50:
+    AOT_BLOCK(0x0d50, 2);
+    // 0d50: cmp [bp-a], 0
+    {
+        a = uint16_t(r[5] - 10);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0d54: jnl 0d5d
+    if (SF == OF)
+        AOT_GOTO(0x0d5d, L0d5d);
+    AOT_GOTO(0x0d56, L0d56);
+L0d56:
+    AOT_BLOCK(0x0d56, 2);
+    // 0d56: neg [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        src = int16_t(RD16(a));
+        val = -src;
+        WR16(a, val);
+        AF = (src & 15) != 0;
+    }
+    // 0d59: or di, 0001
+    {
+        val = int16_t(r[7]) | 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0d5d, L0d5d);
+L0d5d:
+    AOT_BLOCK(0x0d5d, 2);
+    // 0d5d: test di, 0100
+    {
+        val = int16_t(r[7]) & 256;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0d61: jne 0d68
+    if (!ZF)
+        AOT_GOTO(0x0d68, L0d68);
+    AOT_GOTO(0x0d63, L0d63);
+L0d63:
+    AOT_BLOCK(0x0d63, 1);
+    // 0d63: mov [bp-a], 0000
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x0d68, L0d68);
+L0d68:
+    AOT_BLOCK(0x0d68, 2);
+    // 0d68: test di, 0002
+    {
+        val = int16_t(r[7]) & 2;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0d6c: je 0d72
+    if (ZF)
+        AOT_GOTO(0x0d72, L0d72);
+    AOT_GOTO(0x0d6e, L0d6e);
+L0d6e:
+    AOT_BLOCK(0x0d6e, 1);
+    // 0d6e: and di, fffb
+    {
+        val = int16_t(r[7]) & -5;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0d72, L0d72);
+L0d72:
+    AOT_BLOCK(0x0d72, 2);
+    // 0d72: test di, 0001
+    {
+        val = int16_t(r[7]) & 1;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0d76: je 0d7c
+    if (ZF)
+        AOT_GOTO(0x0d7c, L0d7c);
+    AOT_GOTO(0x0d78, L0d78);
+L0d78:
+    AOT_BLOCK(0x0d78, 1);
+    // 0d78: and di, ffef
+    {
+        val = int16_t(r[7]) & -17;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0d7c, L0d7c);
+L0d7c:
+    AOT_BLOCK(0x0d7c, 4);
+    // 0d7c: lea bx, [bp-419]
+    {
+        a = uint16_t(r[5] - 1049);
+        r[3] = a;
+    }
+    // 0d80: mov [bp-18], bx
+    {
+        a = uint16_t(r[5] - 24);
+        WR16(a, r[3]);
+    }
+    // 0d83: mov [bp-2], bx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[3]);
+    }
+    // 0d86: jmp short 0da6
+    AOT_GOTO(0x0da6, L0da6);
+L0d88:
+    AOT_BLOCK(0x0d88, 3);
+    // 0d88: or di, 0020
+    {
+        val = int16_t(r[7]) | 32;
+        r[7] = val;
+        CF = false;
+    }
+    // 0d8c: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0d8f: jmp 0f69
+    AOT_GOTO(0x0f69, L0f69);
+L0d92:
+    AOT_BLOCK(0x0d92, 3);
+    // 0d92: or di, 0040
+    {
+        val = int16_t(r[7]) | 64;
+        r[7] = val;
+        CF = false;
+    }
+    // 0d96: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0d99: jmp 0f69
+    AOT_GOTO(0x0f69, L0f69);
+L0d9c:
+    AOT_BLOCK(0x0d9c, 3);
+    // 0d9c: or di, 0080
+    {
+        val = int16_t(r[7]) | 128;
+        r[7] = val;
+        CF = false;
+    }
+    // 0da0: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0da3: jmp 0f69
+    AOT_GOTO(0x0f69, L0f69);
+L0da6:
+    AOT_BLOCK(0x0da6, 5);
+    // 0da6: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 0da9: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0dab: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0dac: mov bx, 0322
+    {
+        r[3] = 0x0322;
+    }
+    // 0daf: jmp 1a80
+    AOT_GOTO(0x1a80, L1a80);
+L0db2:
+    AOT_BLOCK(0x0db2, 4);
+    // 0db2: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 0db4: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 0db5: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 0db7: jl 0dc9
+    if (SF != OF)
+        AOT_GOTO(0x0dc9, L0dc9);
+    AOT_GOTO(0x0db9, L0db9);
+L0db9:
+    AOT_BLOCK(0x0db9, 7);
+    // 0db9: mov dx, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[2] = RD16(a);
+    }
+    // 0dbc: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 0dbe: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 0dc1: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0dc4: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 0dc6: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 0dc7: jmp short 0dd3
+    AOT_GOTO(0x0dd3, L0dd3);
+L0dc9:
+    AOT_BLOCK(0x0dc9, 3);
+    // 0dc9: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 0dca: push [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0dcd: call 11ec
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0dd0);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L0dd0:
+    AOT_BLOCK(0x0dd0, 3);
+    // 0dd0: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0dd1: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 0dd2: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x0dd3, L0dd3);
+L0dd3:
+    AOT_BLOCK(0x0dd3, 3);
+    // 0dd3: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 0dd4: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0dd7: jne 0ded
+    if (!ZF)
+        AOT_GOTO(0x0ded, L0ded);
+    AOT_GOTO(0x0dd9, L0dd9);
+L0dd9:
+    AOT_BLOCK(0x0dd9, 2);
+    // 0dd9: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0ddd: je 0de7
+    if (ZF)
+        AOT_GOTO(0x0de7, L0de7);
+    AOT_GOTO(0x0ddf, L0ddf);
+L0ddf:
+    AOT_BLOCK(0x0ddf, 3);
+    // 0ddf: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 0de2: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 0de4: jmp 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L0de7:
+    AOT_BLOCK(0x0de7, 2);
+    // 0de7: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 0dea: jmp 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L0ded:
+    AOT_BLOCK(0x0ded, 2);
+    // 0ded: inc [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0df0: jmp 0c62
+    AOT_GOTO(0x0c62, L0c62);
+L0df3:
+    AOT_BLOCK(0x0df3, 2);
+    // 0df3: test di, 0020
+    {
+        val = int16_t(r[7]) & 32;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0df7: je 0e0d
+    if (ZF)
+        AOT_GOTO(0x0e0d, L0e0d);
+    AOT_GOTO(0x0df9, L0df9);
+L0df9:
+    AOT_BLOCK(0x0df9, 7);
+    // 0df9: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 0dfc: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0dff: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 0e02: mov bx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[3] = RD16(a);
+    }
+    // 0e05: mov dx, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[2] = RD16(a);
+    }
+    // 0e08: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 0e0a: jmp 0c62
+    AOT_GOTO(0x0c62, L0c62);
+L0e0d:
+    AOT_BLOCK(0x0e0d, 2);
+    // 0e0d: test di, 0040
+    {
+        val = int16_t(r[7]) & 64;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0e11: je 0e2b
+    if (ZF)
+        AOT_GOTO(0x0e2b, L0e2b);
+    AOT_GOTO(0x0e13, L0e13);
+L0e13:
+    AOT_BLOCK(0x0e13, 9);
+    // 0e13: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 0e16: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 0e17: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 0e1a: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0e1d: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 0e20: mov bx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[3] = RD16(a);
+    }
+    // 0e23: mov [bx], ax
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[0]);
+    }
+    // 0e25: mov [bx+2], dx
+    {
+        a = uint16_t(r[3] + 2);
+        WR16(a, r[2]);
+    }
+    // 0e28: jmp 0c62
+    AOT_GOTO(0x0c62, L0c62);
+L0e2b:
+    AOT_BLOCK(0x0e2b, 7);
+    // 0e2b: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 0e2e: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0e31: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 0e34: mov bx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[3] = RD16(a);
+    }
+    // 0e37: mov dx, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[2] = RD16(a);
+    }
+    // 0e3a: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 0e3c: jmp 0c62
+    AOT_GOTO(0x0c62, L0c62);
+L0e3f:
+    AOT_BLOCK(0x0e3f, 7);
+    // 0e3f: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 0e42: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 0e45: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 0e48: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 0e4b: mov [bp-18], dx
+    {
+        a = uint16_t(r[5] - 24);
+        WR16(a, r[2]);
+    }
+    // 0e4e: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0e50: jne 0e57
+    if (!ZF)
+        AOT_GOTO(0x0e57, L0e57);
+    AOT_GOTO(0x0e52, L0e52);
+L0e52:
+    AOT_BLOCK(0x0e52, 1);
+    // 0e52: mov [bp-18], 037a
+    {
+        a = uint16_t(r[5] - 24);
+        WR16(a, 0x037a);
+    }
+    AOT_GOTO(0x0e57, L0e57);
+L0e57:
+    AOT_BLOCK(0x0e57, 2);
+    // 0e57: mov dx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[2] = RD16(a);
+    }
+    // 0e5a: mov [bp-2], dx
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x0e5d, L0e5d);
+L0e5d:
+    AOT_BLOCK(0x0e5d, 2);
+    // 0e5d: cmp [bp-c], 0
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0e61: jne 0e6c
+    if (!ZF)
+        AOT_GOTO(0x0e6c, L0e6c);
+    AOT_GOTO(0x0e63, L0e63);
+L0e63:
+    AOT_BLOCK(0x0e63, 2);
+    // 0e63: test di, 0200
+    {
+        val = int16_t(r[7]) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0e67: je 0e6c
+    if (ZF)
+        AOT_GOTO(0x0e6c, L0e6c);
+    AOT_GOTO(0x0e69, L0e69);
+L0e69:
+    AOT_BLOCK(0x0e69, 1);
+    // 0e69: jmp 0f7b
+    AOT_GOTO(0x0f7b, L0f7b);
+L0e6c:
+    AOT_BLOCK(0x0e6c, 3);
+    // 0e6c: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 0e6f: cmp byte [bx], 0
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0e72: jne 0e77
+    if (!ZF)
+        AOT_GOTO(0x0e77, L0e77);
+    AOT_GOTO(0x0e74, L0e74);
+L0e74:
+    AOT_BLOCK(0x0e74, 1);
+    // 0e74: jmp 0f7b
+    AOT_GOTO(0x0f7b, L0f7b);
+L0e77:
+    AOT_BLOCK(0x0e77, 3);
+    // 0e77: inc [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 0e7a: dec [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 0e7d: jmp short 0e5d
+    AOT_GOTO(0x0e5d, L0e5d);
+L0e7f:
+    AOT_BLOCK(0x0e7f, 2);
+    // 0e7f: test di, 0200
+    {
+        val = int16_t(r[7]) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0e83: jne 0e8c
+    if (!ZF)
+        AOT_GOTO(0x0e8c, L0e8c);
+    AOT_GOTO(0x0e85, L0e85);
+L0e85:
+    AOT_BLOCK(0x0e85, 2);
+    // 0e85: mov [bp-c], 0001
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0001);
+    }
+    // 0e8a: jmp short 0e96
+    AOT_GOTO(0x0e96, L0e96);
+L0e8c:
+    AOT_BLOCK(0x0e8c, 2);
+    // 0e8c: cmp [bp-8], 70
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) - (src = 112);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0e90: je 0e96
+    if (ZF)
+        AOT_GOTO(0x0e96, L0e96);
+    AOT_GOTO(0x0e92, L0e92);
+L0e92:
+    AOT_BLOCK(0x0e92, 1);
+    // 0e92: and di, ffef
+    {
+        val = int16_t(r[7]) & -17;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0e96, L0e96);
+L0e96:
+    AOT_BLOCK(0x0e96, 11);
+    // 0e96: mov ax, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[0] = RD16(a);
+    }
+    // 0e99: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0e9a: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0e9c: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 0e9d: push [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0ea0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0ea1: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0ea4: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0ea5: lea ax, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[0] = a;
+    }
+    // 0ea8: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0ea9: call 0ac5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0eac);
+    }
+    AOT_GOTO(0x0ac5, L0ac5);
+L0eac:
+    AOT_BLOCK(0x0eac, 3);
+    // 0eac: add sp, c
+    {
+        val = (dst = int16_t(r[4])) + (src = 12);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0eaf: mov [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[0]);
+    }
+    // 0eb2: jmp 0f7b
+    AOT_GOTO(0x0f7b, L0f7b);
+L0eb5:
+    AOT_BLOCK(0x0eb5, 3);
+    // 0eb5: or di, 0400
+    {
+        val = int16_t(r[7]) | 1024;
+        r[7] = val;
+    }
+    // 0eb9: test di, 0200
+    {
+        val = int16_t(r[7]) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0ebd: jne 0ec6
+    if (!ZF)
+        AOT_GOTO(0x0ec6, L0ec6);
+    AOT_GOTO(0x0ebf, L0ebf);
+L0ebf:
+    AOT_BLOCK(0x0ebf, 2);
+    // 0ebf: mov [bp-c], 0001
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0001);
+    }
+    // 0ec4: jmp short 0eca
+    AOT_GOTO(0x0eca, L0eca);
+L0ec6:
+    AOT_BLOCK(0x0ec6, 1);
+    // 0ec6: and di, ffef
+    {
+        val = int16_t(r[7]) & -17;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x0eca, L0eca);
+L0eca:
+    AOT_BLOCK(0x0eca, 11);
+    // 0eca: mov ax, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[0] = RD16(a);
+    }
+    // 0ecd: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0ece: mov bx, 0001
+    {
+        r[3] = 0x0001;
+    }
+    // 0ed1: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 0ed2: push [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0ed5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0ed6: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0ed9: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0eda: lea ax, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[0] = a;
+    }
+    // 0edd: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0ede: call 0ac5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0ee1);
+    }
+    AOT_GOTO(0x0ac5, L0ac5);
+L0ee1:
+    AOT_BLOCK(0x0ee1, 3);
+    // 0ee1: add sp, c
+    {
+        val = (dst = int16_t(r[4])) + (src = 12);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0ee4: mov [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[0]);
+    }
+    // 0ee7: jmp 0f7b
+    AOT_GOTO(0x0f7b, L0f7b);
+L0eea:
+    AOT_BLOCK(0x0eea, 9);
+    // 0eea: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 0eed: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0ef0: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 0ef3: push [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0ef6: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 0ef9: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 0efa: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 0efc: inc [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0eff: jmp 0f7b
+    AOT_GOTO(0x0f7b, L0f7b);
+L0f02:
+    AOT_BLOCK(0x0f02, 2);
+    // 0f02: test di, 0200
+    {
+        val = int16_t(r[7]) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0f06: je 0f13
+    if (ZF)
+        AOT_GOTO(0x0f13, L0f13);
+    AOT_GOTO(0x0f08, L0f08);
+L0f08:
+    AOT_BLOCK(0x0f08, 2);
+    // 0f08: cmp [bp-c], 0
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f0c: jne 0f13
+    if (!ZF)
+        AOT_GOTO(0x0f13, L0f13);
+    AOT_GOTO(0x0f0e, L0f0e);
+L0f0e:
+    AOT_BLOCK(0x0f0e, 1);
+    // 0f0e: mov [bp-c], 0001
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0001);
+    }
+    AOT_GOTO(0x0f13, L0f13);
+L0f13:
+    AOT_BLOCK(0x0f13, 2);
+    // 0f13: test di, 0200
+    {
+        val = int16_t(r[7]) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0f17: jne 0f1e
+    if (!ZF)
+        AOT_GOTO(0x0f1e, L0f1e);
+    AOT_GOTO(0x0f19, L0f19);
+L0f19:
+    AOT_BLOCK(0x0f19, 1);
+    // 0f19: mov [bp-c], 0006
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0006);
+    }
+    AOT_GOTO(0x0f1e, L0f1e);
+L0f1e:
+    AOT_BLOCK(0x0f1e, 2);
+    // 0f1e: cmp [bp-c], 0401
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) - (src = 1025);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0f23: jb 0f2a
+    if (CF)
+        AOT_GOTO(0x0f2a, L0f2a);
+    AOT_GOTO(0x0f25, L0f25);
+L0f25:
+    AOT_BLOCK(0x0f25, 1);
+    // 0f25: mov [bp-c], 0400
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0400);
+    }
+    AOT_GOTO(0x0f2a, L0f2a);
+L0f2a:
+    AOT_BLOCK(0x0f2a, 10);
+    // 0f2a: or di, 0400
+    {
+        val = int16_t(r[7]) | 1024;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0f2e: mov ax, [bp-8]
+    {
+        a = uint16_t(r[5] - 8);
+        r[0] = RD16(a);
+    }
+    // 0f31: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0f32: push [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f35: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0f36: push [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 0f39: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 0f3a: lea ax, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[0] = a;
+    }
+    // 0f3d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 0f3e: call 17c5
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x0f41);
+    }
+    AOT_GOTO(0x17c5, L17c5);
+L0f41:
+    AOT_BLOCK(0x0f41, 3);
+    // 0f41: add sp, a
+    {
+        val = (dst = int16_t(r[4])) + (src = 10);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0f44: mov [bp-2], ax
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[0]);
+    }
+    // 0f47: jmp short 0f7b
+    AOT_GOTO(0x0f7b, L0f7b);
+L0f49:
+    AOT_BLOCK(0x0f49, 11);
+    // 0f49: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 0f4c: add bx, 2
+    {
+        val = (dst = int16_t(r[3])) + (src = 2);
+        r[3] = val;
+    }
+    // 0f4f: mov [bp+6], bx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[3]);
+    }
+    // 0f52: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 0f55: mov [bp+6], dx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[2]);
+    }
+    // 0f58: add dx, 2
+    {
+        val = (dst = int16_t(r[2])) + (src = 2);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 0f5b: mov [bp+6], dx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[2]);
+    }
+    // 0f5e: mov bx, dx
+    {
+        r[3] = r[2];
+    }
+    // 0f60: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 0f63: mov [bp+4], dx
+    {
+        a = uint16_t(r[5] + 4);
+        WR16(a, r[2]);
+    }
+    // 0f66: jmp 0c62
+    AOT_GOTO(0x0c62, L0c62);
+L0f69:
+    AOT_BLOCK(0x0f69, 7);
+    // 0f69: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 0f6c: inc [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 0f6f: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 0f71: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 0f72: mov [bp-8], ax
+    {
+        a = uint16_t(r[5] - 8);
+        WR16(a, r[0]);
+    }
+    // 0f75: mov bx, 0332
+    {
+        r[3] = 0x0332;
+    }
+    // 0f78: jmp 1a80
+    AOT_GOTO(0x1a80, L1a80);
+L0f7b:
+    AOT_BLOCK(0x0f7b, 3);
+    // 0f7b: mov [bp-e], 0020
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, 0x0020);
+    }
+    // 0f80: test di, 0010
+    {
+        val = int16_t(r[7]) & 16;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0f84: je 0f8b
+    if (ZF)
+        AOT_GOTO(0x0f8b, L0f8b);
+    AOT_GOTO(0x0f86, L0f86);
+L0f86:
+    AOT_BLOCK(0x0f86, 1);
+    // 0f86: mov [bp-e], 0030
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, 0x0030);
+    }
+    AOT_GOTO(0x0f8b, L0f8b);
+L0f8b:
+    AOT_BLOCK(0x0f8b, 6);
+    // 0f8b: mov dx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[2] = RD16(a);
+    }
+    // 0f8e: sub dx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 0f91: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 0f94: mov [bp-12], 0000
+    {
+        a = uint16_t(r[5] - 18);
+        WR16(a, 0x0000);
+    }
+    // 0f99: test di, 0010
+    {
+        val = int16_t(r[7]) & 16;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0f9d: je 0fd2
+    if (ZF)
+        AOT_GOTO(0x0fd2, L0fd2);
+    AOT_GOTO(0x0f9f, L0f9f);
+L0f9f:
+    AOT_BLOCK(0x0f9f, 2);
+    // 0f9f: cmp [bp-8], 78
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) - (src = 120);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0fa3: je 0fab
+    if (ZF)
+        AOT_GOTO(0x0fab, L0fab);
+    AOT_GOTO(0x0fa5, L0fa5);
+L0fa5:
+    AOT_BLOCK(0x0fa5, 2);
+    // 0fa5: cmp [bp-8], 58
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) - (src = 88);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0fa9: jne 0fb1
+    if (!ZF)
+        AOT_GOTO(0x0fb1, L0fb1);
+    AOT_GOTO(0x0fab, L0fab);
+L0fab:
+    AOT_BLOCK(0x0fab, 2);
+    // 0fab: test di, 0008
+    {
+        val = int16_t(r[7]) & 8;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0faf: jne 0fcf
+    if (!ZF)
+        AOT_GOTO(0x0fcf, L0fcf);
+    AOT_GOTO(0x0fb1, L0fb1);
+L0fb1:
+    AOT_BLOCK(0x0fb1, 2);
+    // 0fb1: cmp [bp-8], 70
+    {
+        a = uint16_t(r[5] - 8);
+        val = (dst = int16_t(RD16(a))) - (src = 112);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0fb5: je 0fcf
+    if (ZF)
+        AOT_GOTO(0x0fcf, L0fcf);
+    AOT_GOTO(0x0fb7, L0fb7);
+L0fb7:
+    AOT_BLOCK(0x0fb7, 2);
+    // 0fb7: test di, 0400
+    {
+        val = int16_t(r[7]) & 1024;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0fbb: je 0fd2
+    if (ZF)
+        AOT_GOTO(0x0fd2, L0fd2);
+    AOT_GOTO(0x0fbd, L0fbd);
+L0fbd:
+    AOT_BLOCK(0x0fbd, 3);
+    // 0fbd: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 0fc0: cmp byte [bx], 2b
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 43);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0fc3: je 0fcf
+    if (ZF)
+        AOT_GOTO(0x0fcf, L0fcf);
+    AOT_GOTO(0x0fc5, L0fc5);
+L0fc5:
+    AOT_BLOCK(0x0fc5, 2);
+    // 0fc5: cmp byte [bx], 2d
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 45);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0fc8: je 0fcf
+    if (ZF)
+        AOT_GOTO(0x0fcf, L0fcf);
+    AOT_GOTO(0x0fca, L0fca);
+L0fca:
+    AOT_BLOCK(0x0fca, 2);
+    // 0fca: cmp byte [bx], 20
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int8_t(RD8(a))) - (src = 32);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 0fcd: jne 0fd2
+    if (!ZF)
+        AOT_GOTO(0x0fd2, L0fd2);
+    AOT_GOTO(0x0fcf, L0fcf);
+L0fcf:
+    AOT_BLOCK(0x0fcf, 1);
+    // 0fcf: inc [bp-12]
+    {
+        a = uint16_t(r[5] - 18);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x0fd2, L0fd2);
+L0fd2:
+    AOT_BLOCK(0x0fd2, 4);
+    // 0fd2: mov dx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[2] = RD16(a);
+    }
+    // 0fd5: sub dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0fd8: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 0fdb: jnle 0fe0
+    if (!(ZF || SF != OF))
+        AOT_GOTO(0x0fe0, L0fe0);
+    AOT_GOTO(0x0fdd, L0fdd);
+L0fdd:
+    AOT_BLOCK(0x0fdd, 1);
+    // 0fdd: jmp 1110
+    AOT_GOTO(0x1110, L1110);
+L0fe0:
+    AOT_BLOCK(0x0fe0, 2);
+    // 0fe0: test di, 0001
+    {
+        val = int16_t(r[7]) & 1;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0fe4: je 0fe9
+    if (ZF)
+        AOT_GOTO(0x0fe9, L0fe9);
+    AOT_GOTO(0x0fe6, L0fe6);
+L0fe6:
+    AOT_BLOCK(0x0fe6, 1);
+    // 0fe6: jmp 1110
+    AOT_GOTO(0x1110, L1110);
+L0fe9:
+    AOT_BLOCK(0x0fe9, 4);
+    // 0fe9: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 0fec: add [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2]));
+        WR16(a, val);
+    }
+    // 0fef: cmp [bp-12], 0
+    {
+        a = uint16_t(r[5] - 18);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 0ff3: jne 0ff8
+    if (!ZF)
+        AOT_GOTO(0x0ff8, L0ff8);
+    AOT_GOTO(0x0ff5, L0ff5);
+L0ff5:
+    AOT_BLOCK(0x0ff5, 1);
+    // 0ff5: jmp 10d0
+    AOT_GOTO(0x10d0, L10d0);
+L0ff8:
+    AOT_BLOCK(0x0ff8, 2);
+    // 0ff8: test di, 0400
+    {
+        val = int16_t(r[7]) & 1024;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 0ffc: je 104e
+    if (ZF)
+        AOT_GOTO(0x104e, L104e);
+    AOT_GOTO(0x0ffe, L0ffe);
+L0ffe:
+    AOT_BLOCK(0x0ffe, 2);
+    // 0ffe: dec [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+    }
+    // 1001: inc [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1004, L1004);
+L1004:
+    AOT_BLOCK(0x1004, 4);
+    // 1004: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1006: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1007: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1009: jl 1020
+    if (SF != OF)
+        AOT_GOTO(0x1020, L1020);
+    AOT_GOTO(0x100b, L100b);
+L100b:
+    AOT_BLOCK(0x100b, 9);
+    // 100b: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 100e: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1011: mov dl, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1013: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 1015: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 1018: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 101b: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 101d: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 101e: jmp short 1031
+    AOT_GOTO(0x1031, L1031);
+L1020:
+    AOT_BLOCK(0x1020, 7);
+    // 1020: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1023: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1026: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1028: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1029: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 102a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 102b: call 11ec
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x102e);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L102e:
+    AOT_BLOCK(0x102e, 3);
+    // 102e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 102f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1030: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1031, L1031);
+L1031:
+    AOT_BLOCK(0x1031, 3);
+    // 1031: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1032: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1035: je 103a
+    if (ZF)
+        AOT_GOTO(0x103a, L103a);
+    AOT_GOTO(0x1037, L1037);
+L1037:
+    AOT_BLOCK(0x1037, 1);
+    // 1037: jmp 10d0
+    AOT_GOTO(0x10d0, L10d0);
+L103a:
+    AOT_BLOCK(0x103a, 2);
+    // 103a: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 103e: je 1048
+    if (ZF)
+        AOT_GOTO(0x1048, L1048);
+    AOT_GOTO(0x1040, L1040);
+L1040:
+    AOT_BLOCK(0x1040, 3);
+    // 1040: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 1043: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1045: jmp 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L1048:
+    AOT_BLOCK(0x1048, 2);
+    // 1048: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 104b: jmp 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L104e:
+    AOT_BLOCK(0x104e, 6);
+    // 104e: sub [bp-4], 2
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 2);
+        WR16(a, val);
+    }
+    // 1052: add [bp-14], 2
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) + (src = 2);
+        WR16(a, val);
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1056: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1058: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1059: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 105b: jl 1072
+    if (SF != OF)
+        AOT_GOTO(0x1072, L1072);
+    AOT_GOTO(0x105d, L105d);
+L105d:
+    AOT_BLOCK(0x105d, 9);
+    // 105d: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1060: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1063: mov dl, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1065: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 1067: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 106a: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 106d: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 106f: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1070: jmp short 1083
+    AOT_GOTO(0x1083, L1083);
+L1072:
+    AOT_BLOCK(0x1072, 7);
+    // 1072: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1075: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1078: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 107a: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 107b: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 107c: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 107d: call 11ec
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1080);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L1080:
+    AOT_BLOCK(0x1080, 3);
+    // 1080: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1081: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1082: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1083, L1083);
+L1083:
+    AOT_BLOCK(0x1083, 3);
+    // 1083: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1084: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1087: je 10bc
+    if (ZF)
+        AOT_GOTO(0x10bc, L10bc);
+    AOT_GOTO(0x1089, L1089);
+L1089:
+    AOT_BLOCK(0x1089, 4);
+    // 1089: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 108b: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 108c: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 108e: jl 10a5
+    if (SF != OF)
+        AOT_GOTO(0x10a5, L10a5);
+    AOT_GOTO(0x1090, L1090);
+L1090:
+    AOT_BLOCK(0x1090, 9);
+    // 1090: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1093: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1096: mov dl, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 1098: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 109a: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 109d: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 10a0: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 10a2: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 10a3: jmp short 10b6
+    AOT_GOTO(0x10b6, L10b6);
+L10a5:
+    AOT_BLOCK(0x10a5, 7);
+    // 10a5: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 10a8: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 10ab: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 10ad: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 10ae: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 10af: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 10b0: call 11ec
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x10b3);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L10b3:
+    AOT_BLOCK(0x10b3, 3);
+    // 10b3: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 10b4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 10b5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x10b6, L10b6);
+L10b6:
+    AOT_BLOCK(0x10b6, 3);
+    // 10b6: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 10b7: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 10ba: jne 10d0
+    if (!ZF)
+        AOT_GOTO(0x10d0, L10d0);
+    AOT_GOTO(0x10bc, L10bc);
+L10bc:
+    AOT_BLOCK(0x10bc, 2);
+    // 10bc: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 10c0: je 10ca
+    if (ZF)
+        AOT_GOTO(0x10ca, L10ca);
+    AOT_GOTO(0x10c2, L10c2);
+L10c2:
+    AOT_BLOCK(0x10c2, 3);
+    // 10c2: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 10c5: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 10c7: jmp 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L10ca:
+    AOT_BLOCK(0x10ca, 2);
+    // 10ca: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 10cd: jmp 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L10d0:
+    AOT_BLOCK(0x10d0, 4);
+    // 10d0: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 10d2: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 10d3: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 10d5: jl 10e7
+    if (SF != OF)
+        AOT_GOTO(0x10e7, L10e7);
+    AOT_GOTO(0x10d7, L10d7);
+L10d7:
+    AOT_BLOCK(0x10d7, 7);
+    // 10d7: mov dx, [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        r[2] = RD16(a);
+    }
+    // 10da: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 10dc: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 10df: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 10e2: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 10e4: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 10e5: jmp short 10f1
+    AOT_GOTO(0x10f1, L10f1);
+L10e7:
+    AOT_BLOCK(0x10e7, 3);
+    // 10e7: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 10e8: push [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 10eb: call 11ec
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x10ee);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L10ee:
+    AOT_BLOCK(0x10ee, 3);
+    // 10ee: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 10ef: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 10f0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x10f1, L10f1);
+L10f1:
+    AOT_BLOCK(0x10f1, 3);
+    // 10f1: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 10f2: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 10f5: jne 110b
+    if (!ZF)
+        AOT_GOTO(0x110b, L110b);
+    AOT_GOTO(0x10f7, L10f7);
+L10f7:
+    AOT_BLOCK(0x10f7, 2);
+    // 10f7: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 10fb: je 1105
+    if (ZF)
+        AOT_GOTO(0x1105, L1105);
+    AOT_GOTO(0x10fd, L10fd);
+L10fd:
+    AOT_BLOCK(0x10fd, 3);
+    // 10fd: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 1100: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1102: jmp 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L1105:
+    AOT_BLOCK(0x1105, 2);
+    // 1105: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1108: jmp 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L110b:
+    AOT_BLOCK(0x110b, 2);
+    // 110b: dec [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 110e: jne 10d0
+    if (!ZF)
+        AOT_GOTO(0x10d0, L10d0);
+    AOT_GOTO(0x1110, L1110);
+L1110:
+    AOT_BLOCK(0x1110, 2);
+    // 1110: mov dx, [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        r[2] = RD16(a);
+    }
+    // 1113: add [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2]));
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x1116, L1116);
+L1116:
+    AOT_BLOCK(0x1116, 2);
+    // 1116: dec [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1119: jl 1160
+    if (SF != OF)
+        AOT_GOTO(0x1160, L1160);
+    AOT_GOTO(0x111b, L111b);
+L111b:
+    AOT_BLOCK(0x111b, 4);
+    // 111b: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 111d: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 111e: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1120: jl 1137
+    if (SF != OF)
+        AOT_GOTO(0x1137, L1137);
+    AOT_GOTO(0x1122, L1122);
+L1122:
+    AOT_BLOCK(0x1122, 9);
+    // 1122: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 1125: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1128: mov dl, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = (r[2] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 112a: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 112c: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 112f: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1132: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1134: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1135: jmp short 1148
+    AOT_GOTO(0x1148, L1148);
+L1137:
+    AOT_BLOCK(0x1137, 7);
+    // 1137: mov bx, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[3] = RD16(a);
+    }
+    // 113a: inc [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 113d: mov al, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[0] = (r[0] & 0xff00) | uint8_t(RD8(a));
+    }
+    // 113f: cbw
+    {
+        r[0] = int16_t(int8_t(r[0]));
+    }
+    // 1140: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1141: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1142: call 11ec
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1145);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L1145:
+    AOT_BLOCK(0x1145, 3);
+    // 1145: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1146: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1147: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1148, L1148);
+L1148:
+    AOT_BLOCK(0x1148, 3);
+    // 1148: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1149: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 114c: jne 1116
+    if (!ZF)
+        AOT_GOTO(0x1116, L1116);
+    AOT_GOTO(0x114e, L114e);
+L114e:
+    AOT_BLOCK(0x114e, 2);
+    // 114e: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1152: je 115b
+    if (ZF)
+        AOT_GOTO(0x115b, L115b);
+    AOT_GOTO(0x1154, L1154);
+L1154:
+    AOT_BLOCK(0x1154, 3);
+    // 1154: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 1157: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1159: jmp short 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L115b:
+    AOT_BLOCK(0x115b, 2);
+    // 115b: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 115e: jmp short 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L1160:
+    AOT_BLOCK(0x1160, 2);
+    // 1160: cmp [bp-6], 0
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1164: jle 116c
+    if (ZF || SF != OF)
+        AOT_GOTO(0x116c, L116c);
+    AOT_GOTO(0x1166, L1166);
+L1166:
+    AOT_BLOCK(0x1166, 2);
+    // 1166: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1169: add [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) + (src = int16_t(r[2]));
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    AOT_GOTO(0x116c, L116c);
+L116c:
+    AOT_BLOCK(0x116c, 2);
+    // 116c: dec [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        val = int16_t(RD16(a)) - 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 116f: jnl 1174
+    if (SF == OF)
+        AOT_GOTO(0x1174, L1174);
+    AOT_GOTO(0x1171, L1171);
+L1171:
+    AOT_BLOCK(0x1171, 1);
+    // 1171: jmp 0c62
+    AOT_GOTO(0x0c62, L0c62);
+L1174:
+    AOT_BLOCK(0x1174, 4);
+    // 1174: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1176: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1177: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1179: jl 118b
+    if (SF != OF)
+        AOT_GOTO(0x118b, L118b);
+    AOT_GOTO(0x117b, L117b);
+L117b:
+    AOT_BLOCK(0x117b, 7);
+    // 117b: mov dx, [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        r[2] = RD16(a);
+    }
+    // 117e: xor dh, dh
+    {
+        val = int8_t(r[2] >> 8) ^ int8_t(r[2] >> 8);
+        r[2] = (r[2] & 0xff) | uint8_t(val) << 8;
+        CF = false;
+    }
+    // 1180: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 1183: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1186: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1188: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1189: jmp short 1195
+    AOT_GOTO(0x1195, L1195);
+L118b:
+    AOT_BLOCK(0x118b, 3);
+    // 118b: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 118c: push [bp-e]
+    {
+        a = uint16_t(r[5] - 14);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 118f: call 11ec
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1192);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L1192:
+    AOT_BLOCK(0x1192, 3);
+    // 1192: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1193: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1194: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    AOT_GOTO(0x1195, L1195);
+L1195:
+    AOT_BLOCK(0x1195, 3);
+    // 1195: pop dx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[2] = val;
+    }
+    // 1196: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1199: jne 116c
+    if (!ZF)
+        AOT_GOTO(0x116c, L116c);
+    AOT_GOTO(0x119b, L119b);
+L119b:
+    AOT_BLOCK(0x119b, 2);
+    // 119b: cmp [bp-14], 0
+    {
+        a = uint16_t(r[5] - 20);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 119f: je 11a8
+    if (ZF)
+        AOT_GOTO(0x11a8, L11a8);
+    AOT_GOTO(0x11a1, L11a1);
+L11a1:
+    AOT_BLOCK(0x11a1, 3);
+    // 11a1: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    // 11a4: neg ax
+    {
+        src = int16_t(r[0]);
+        val = -src;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 11a6: jmp short 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L11a8:
+    AOT_BLOCK(0x11a8, 2);
+    // 11a8: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 11ab: jmp short 11b0
+    AOT_GOTO(0x11b0, L11b0);
+L11ad:
+    AOT_BLOCK(0x11ad, 1);
+    // 11ad: mov ax, [bp-14]
+    {
+        a = uint16_t(r[5] - 20);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x11b0, L11b0);
+L11b0:
+    AOT_BLOCK(0x11b0, 1);
+    // 11b0: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L11b3:
+    AOT_BLOCK(0x11b3, 5);
+    // 11b3: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 11b4: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 11b6: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 11b7: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 11b8: mov di, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[7] = RD16(a);
+    }
+    AOT_GOTO(0x11bb, L11bb);
+L11bb:
+    AOT_BLOCK(0x11bb, 4);
+    // 11bb: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 11bc: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 11bf: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 11c2: call 0a44
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x11c5);
+    }
+    AOT_GOTO(0x0a44, L0a44);
+L11c5:
+    AOT_BLOCK(0x11c5, 4);
+    // 11c5: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 11c8: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 11ca: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 11cc: jle 11e2
+    if (ZF || SF != OF)
+        AOT_GOTO(0x11e2, L11e2);
+    AOT_GOTO(0x11ce, L11ce);
+L11ce:
+    AOT_BLOCK(0x11ce, 2);
+    // 11ce: cmp si, di
+    {
+        val = (dst = int16_t(r[6])) - (src = int16_t(r[7]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 11d0: jnl 11e2
+    if (SF == OF)
+        AOT_GOTO(0x11e2, L11e2);
+    AOT_GOTO(0x11d2, L11d2);
+L11d2:
+    AOT_BLOCK(0x11d2, 7);
+    // 11d2: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 11d4: sub dx, si
+    {
+        val = (dst = int16_t(r[2])) - (src = int16_t(r[6]));
+        r[2] = val;
+    }
+    // 11d6: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 11d8: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 11da: add dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 11dd: mov [bp+6], dx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[2]);
+    }
+    // 11e0: jmp short 11bb
+    AOT_GOTO(0x11bb, L11bb);
+L11e2:
+    AOT_BLOCK(0x11e2, 3);
+    // 11e2: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+    }
+    // 11e4: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 11e6: jle 11e9
+    if (ZF || SF != OF)
+        AOT_GOTO(0x11e9, L11e9);
+    AOT_GOTO(0x11e8, L11e8);
+L11e8:
+    AOT_BLOCK(0x11e8, 1);
+    // 11e8: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x11e9, L11e9);
+L11e9:
+    AOT_BLOCK(0x11e9, 1);
+    // 11e9: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L11ec:
+    AOT_BLOCK(0x11ec, 11);
+    // 11ec: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 11ed: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 11ef: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 11f0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 11f1: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 11f2: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 11f3: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 11f6: mov si, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[6] = RD16(a);
+    }
+    // 11f9: mov [028a], 19e2
+    {
+        a = 0x028a;
+        WR16(a, 0x19e2);
+    }
+    // 11ff: cmp [si+2], 0
+    {
+        a = uint16_t(r[6] + 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1203: jnl 120b
+    if (SF == OF)
+        AOT_GOTO(0x120b, L120b);
+    AOT_GOTO(0x1205, L1205);
+L1205:
+    AOT_BLOCK(0x1205, 2);
+    // 1205: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1208: jmp 13fe
+    AOT_GOTO(0x13fe, L13fe);
+L120b:
+    AOT_BLOCK(0x120b, 2);
+    // 120b: test byte [si+4], 2
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 2;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 120f: jne 1217
+    if (!ZF)
+        AOT_GOTO(0x1217, L1217);
+    AOT_GOTO(0x1211, L1211);
+L1211:
+    AOT_BLOCK(0x1211, 2);
+    // 1211: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1214: jmp 13fe
+    AOT_GOTO(0x13fe, L13fe);
+L1217:
+    AOT_BLOCK(0x1217, 2);
+    // 1217: test byte [si+4], 80
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & -128;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 121b: je 1229
+    if (ZF)
+        AOT_GOTO(0x1229, L1229);
+    AOT_GOTO(0x121d, L121d);
+L121d:
+    AOT_BLOCK(0x121d, 2);
+    // 121d: test byte [si+4], 10
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 16;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1221: jne 1229
+    if (!ZF)
+        AOT_GOTO(0x1229, L1229);
+    AOT_GOTO(0x1223, L1223);
+L1223:
+    AOT_BLOCK(0x1223, 2);
+    // 1223: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1226: jmp 13fe
+    AOT_GOTO(0x13fe, L13fe);
+L1229:
+    AOT_BLOCK(0x1229, 4);
+    // 1229: and [si+4], ff7f
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) & -129;
+        WR16(a, val);
+    }
+    // 122e: or [si+4], 0100
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 256;
+        WR16(a, val);
+    }
+    // 1233: test byte [si+4], 4
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 4;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1237: je 123c
+    if (ZF)
+        AOT_GOTO(0x123c, L123c);
+    AOT_GOTO(0x1239, L1239);
+L1239:
+    AOT_BLOCK(0x1239, 1);
+    // 1239: jmp 12b3
+    AOT_GOTO(0x12b3, L12b3);
+L123c:
+    AOT_BLOCK(0x123c, 2);
+    // 123c: cmp [si+8], 0
+    {
+        a = uint16_t(r[6] + 8);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1240: je 1245
+    if (ZF)
+        AOT_GOTO(0x1245, L1245);
+    AOT_GOTO(0x1242, L1242);
+L1242:
+    AOT_BLOCK(0x1242, 1);
+    // 1242: jmp 12b3
+    AOT_GOTO(0x12b3, L12b3);
+L1245:
+    AOT_BLOCK(0x1245, 2);
+    // 1245: cmp si, 029a
+    {
+        val = (dst = int16_t(r[6])) - (src = 666);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1249: jne 127d
+    if (!ZF)
+        AOT_GOTO(0x127d, L127d);
+    AOT_GOTO(0x124b, L124b);
+L124b:
+    AOT_BLOCK(0x124b, 2);
+    // 124b: push [029c]
+    {
+        a = 0x029c;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 124f: call 1884
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1252);
+    }
+    AOT_GOTO(0x1884, L1884);
+L1252:
+    AOT_BLOCK(0x1252, 3);
+    // 1252: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1253: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1255: je 127d
+    if (ZF)
+        AOT_GOTO(0x127d, L127d);
+    AOT_GOTO(0x1257, L1257);
+L1257:
+    AOT_BLOCK(0x1257, 3);
+    // 1257: mov ax, 0400
+    {
+        r[0] = 0x0400;
+    }
+    // 125a: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 125b: call 1564
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x125e);
+    }
+    AOT_GOTO(0x1564, L1564);
+L125e:
+    AOT_BLOCK(0x125e, 4);
+    // 125e: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 125f: mov [si+8], ax
+    {
+        a = uint16_t(r[6] + 8);
+        WR16(a, r[0]);
+    }
+    // 1262: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1264: jne 126d
+    if (!ZF)
+        AOT_GOTO(0x126d, L126d);
+    AOT_GOTO(0x1266, L1266);
+L1266:
+    AOT_BLOCK(0x1266, 2);
+    // 1266: or [si+4], 0004
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 4;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 126b: jmp short 12ad
+    AOT_GOTO(0x12ad, L12ad);
+L126d:
+    AOT_BLOCK(0x126d, 4);
+    // 126d: or [si+4], 0048
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 72;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1272: mov [si+6], 0400
+    {
+        a = uint16_t(r[6] + 6);
+        WR16(a, 0x0400);
+    }
+    // 1277: mov [si], ffff
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0xffff);
+    }
+    // 127b: jmp short 12ad
+    AOT_GOTO(0x12ad, L12ad);
+L127d:
+    AOT_BLOCK(0x127d, 3);
+    // 127d: mov ax, 0400
+    {
+        r[0] = 0x0400;
+    }
+    // 1280: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1281: call 1564
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1284);
+    }
+    AOT_GOTO(0x1564, L1564);
+L1284:
+    AOT_BLOCK(0x1284, 4);
+    // 1284: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1285: mov [si+8], ax
+    {
+        a = uint16_t(r[6] + 8);
+        WR16(a, r[0]);
+    }
+    // 1288: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 128a: jne 1293
+    if (!ZF)
+        AOT_GOTO(0x1293, L1293);
+    AOT_GOTO(0x128c, L128c);
+L128c:
+    AOT_BLOCK(0x128c, 2);
+    // 128c: or [si+4], 0004
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 4;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1291: jmp short 12ad
+    AOT_GOTO(0x12ad, L12ad);
+L1293:
+    AOT_BLOCK(0x1293, 4);
+    // 1293: or [si+4], 0008
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 8;
+        WR16(a, val);
+    }
+    // 1298: mov [si+6], 0400
+    {
+        a = uint16_t(r[6] + 6);
+        WR16(a, 0x0400);
+    }
+    // 129d: test byte [si+4], 40
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 64;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12a1: jne 12a9
+    if (!ZF)
+        AOT_GOTO(0x12a9, L12a9);
+    AOT_GOTO(0x12a3, L12a3);
+L12a3:
+    AOT_BLOCK(0x12a3, 2);
+    // 12a3: mov [si], 03ff
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0x03ff);
+    }
+    // 12a7: jmp short 12ad
+    AOT_GOTO(0x12ad, L12ad);
+L12a9:
+    AOT_BLOCK(0x12a9, 1);
+    // 12a9: mov [si], ffff
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0xffff);
+    }
+    AOT_GOTO(0x12ad, L12ad);
+L12ad:
+    AOT_BLOCK(0x12ad, 2);
+    // 12ad: mov dx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[2] = RD16(a);
+    }
+    // 12b0: mov [si+a], dx
+    {
+        a = uint16_t(r[6] + 10);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x12b3, L12b3);
+L12b3:
+    AOT_BLOCK(0x12b3, 2);
+    // 12b3: test byte [si+4], 4
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 4;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12b7: je 1312
+    if (ZF)
+        AOT_GOTO(0x1312, L1312);
+    AOT_GOTO(0x12b9, L12b9);
+L12b9:
+    AOT_BLOCK(0x12b9, 5);
+    // 12b9: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 12bb: mov [bp-1], dl
+    {
+        a = uint16_t(r[5] - 1);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 12be: mov [si], 0000
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0x0000);
+    }
+    // 12c2: test [si+4], 0200
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12c7: je 12ec
+    if (ZF)
+        AOT_GOTO(0x12ec, L12ec);
+    AOT_GOTO(0x12c9, L12c9);
+L12c9:
+    AOT_BLOCK(0x12c9, 7);
+    // 12c9: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12cb: mov bx, 0002
+    {
+        r[3] = 0x0002;
+    }
+    // 12ce: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 12cf: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 12d0: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 12d1: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 12d4: call 0973
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x12d7);
+    }
+    AOT_GOTO(0x0973, L0973);
+L12d7:
+    AOT_BLOCK(0x12d7, 4);
+    // 12d7: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 12da: and dx, ax
+    {
+        val = int16_t(r[2]) & int16_t(r[0]);
+        r[2] = val;
+    }
+    // 12dc: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 12df: jne 12ec
+    if (!ZF)
+        AOT_GOTO(0x12ec, L12ec);
+    AOT_GOTO(0x12e1, L12e1);
+L12e1:
+    AOT_BLOCK(0x12e1, 3);
+    // 12e1: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 12e6: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 12e9: jmp 13fe
+    AOT_GOTO(0x13fe, L13fe);
+L12ec:
+    AOT_BLOCK(0x12ec, 6);
+    // 12ec: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 12ef: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 12f0: lea ax, [bp-1]
+    {
+        a = uint16_t(r[5] - 1);
+        r[0] = a;
+    }
+    // 12f3: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 12f4: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 12f7: call 0a44
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x12fa);
+    }
+    AOT_GOTO(0x0a44, L0a44);
+L12fa:
+    AOT_BLOCK(0x12fa, 3);
+    // 12fa: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+    }
+    // 12fd: cmp ax, 0001
+    {
+        val = (dst = int16_t(r[0])) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1300: je 130d
+    if (ZF)
+        AOT_GOTO(0x130d, L130d);
+    AOT_GOTO(0x1302, L1302);
+L1302:
+    AOT_BLOCK(0x1302, 3);
+    // 1302: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1307: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 130a: jmp 13fe
+    AOT_GOTO(0x13fe, L13fe);
+L130d:
+    AOT_BLOCK(0x130d, 2);
+    // 130d: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 130f: jmp 13fe
+    AOT_GOTO(0x13fe, L13fe);
+L1312:
+    AOT_BLOCK(0x1312, 2);
+    // 1312: test byte [si+4], 40
+    {
+        a = uint16_t(r[6] + 4);
+        val = int8_t(RD8(a)) & 64;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1316: je 138a
+    if (ZF)
+        AOT_GOTO(0x138a, L138a);
+    AOT_GOTO(0x1318, L1318);
+L1318:
+    AOT_BLOCK(0x1318, 6);
+    // 1318: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 131a: mov bx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[3] = RD16(a);
+    }
+    // 131d: inc [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+    }
+    // 1320: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1322: cmp di, a
+    {
+        val = (dst = int16_t(r[7])) - (src = 10);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1325: je 1333
+    if (ZF)
+        AOT_GOTO(0x1333, L1333);
+    AOT_GOTO(0x1327, L1327);
+L1327:
+    AOT_BLOCK(0x1327, 4);
+    // 1327: mov dx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        r[2] = RD16(a);
+    }
+    // 132a: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+    }
+    // 132c: cmp [si], dx
+    {
+        a = uint16_t(r[6]);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 132e: je 1333
+    if (ZF)
+        AOT_GOTO(0x1333, L1333);
+    AOT_GOTO(0x1330, L1330);
+L1330:
+    AOT_BLOCK(0x1330, 1);
+    // 1330: jmp 13fc
+    AOT_GOTO(0x13fc, L13fc);
+L1333:
+    AOT_BLOCK(0x1333, 2);
+    // 1333: test [si+4], 0200
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1338: je 135d
+    if (ZF)
+        AOT_GOTO(0x135d, L135d);
+    AOT_GOTO(0x133a, L133a);
+L133a:
+    AOT_BLOCK(0x133a, 7);
+    // 133a: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 133c: mov bx, 0002
+    {
+        r[3] = 0x0002;
+    }
+    // 133f: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 1340: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1341: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1342: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1345: call 0973
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1348);
+    }
+    AOT_GOTO(0x0973, L0973);
+L1348:
+    AOT_BLOCK(0x1348, 4);
+    // 1348: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 134b: and dx, ax
+    {
+        val = int16_t(r[2]) & int16_t(r[0]);
+        r[2] = val;
+    }
+    // 134d: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1350: jne 135d
+    if (!ZF)
+        AOT_GOTO(0x135d, L135d);
+    AOT_GOTO(0x1352, L1352);
+L1352:
+    AOT_BLOCK(0x1352, 3);
+    // 1352: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1357: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 135a: jmp 13fe
+    AOT_GOTO(0x13fe, L13fe);
+L135d:
+    AOT_BLOCK(0x135d, 6);
+    // 135d: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 135f: neg dx
+    {
+        src = int16_t(r[2]);
+        val = -src;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (src & 15) != 0;
+        PF = ptable[uint8_t(val)];
+        CF = src != 0;
+    }
+    // 1361: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1362: push [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1365: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1368: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x136b);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L136b:
+    AOT_BLOCK(0x136b, 3);
+    // 136b: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 136e: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1370: jne 137d
+    if (!ZF)
+        AOT_GOTO(0x137d, L137d);
+    AOT_GOTO(0x1372, L1372);
+L1372:
+    AOT_BLOCK(0x1372, 3);
+    // 1372: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1377: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 137a: jmp 13fe
+    AOT_GOTO(0x13fe, L13fe);
+L137d:
+    AOT_BLOCK(0x137d, 4);
+    // 137d: mov dx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[2] = RD16(a);
+    }
+    // 1380: mov [si+a], dx
+    {
+        a = uint16_t(r[6] + 10);
+        WR16(a, r[2]);
+    }
+    // 1383: mov [si], 0000
+    {
+        a = uint16_t(r[6]);
+        WR16(a, 0x0000);
+    }
+    // 1387: jmp 13fc
+    AOT_GOTO(0x13fc, L13fc);
+L138a:
+    AOT_BLOCK(0x138a, 11);
+    // 138a: mov dx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[2] = RD16(a);
+    }
+    // 138d: sub dx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 1390: mov [bp-4], dx
+    {
+        a = uint16_t(r[5] - 4);
+        WR16(a, r[2]);
+    }
+    // 1393: mov dx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        r[2] = RD16(a);
+    }
+    // 1396: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+    }
+    // 1397: mov [si], dx
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[2]);
+    }
+    // 1399: mov bx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[3] = RD16(a);
+    }
+    // 139c: add bx, 1
+    {
+        val = (dst = int16_t(r[3])) + (src = 1);
+        r[3] = val;
+    }
+    // 139f: mov [si+a], bx
+    {
+        a = uint16_t(r[6] + 10);
+        WR16(a, r[3]);
+    }
+    // 13a2: cmp [bp-4], 0
+    {
+        a = uint16_t(r[5] - 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 13a6: jle 13f5
+    if (ZF || SF != OF)
+        AOT_GOTO(0x13f5, L13f5);
+    AOT_GOTO(0x13a8, L13a8);
+L13a8:
+    AOT_BLOCK(0x13a8, 2);
+    // 13a8: test [si+4], 0200
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) & 512;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 13ad: je 13d1
+    if (ZF)
+        AOT_GOTO(0x13d1, L13d1);
+    AOT_GOTO(0x13af, L13af);
+L13af:
+    AOT_BLOCK(0x13af, 7);
+    // 13af: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 13b1: mov bx, 0002
+    {
+        r[3] = 0x0002;
+    }
+    // 13b4: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 13b5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 13b6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 13b7: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 13ba: call 0973
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x13bd);
+    }
+    AOT_GOTO(0x0973, L0973);
+L13bd:
+    AOT_BLOCK(0x13bd, 4);
+    // 13bd: add sp, 8
+    {
+        val = (dst = int16_t(r[4])) + (src = 8);
+        r[4] = val;
+    }
+    // 13c0: and dx, ax
+    {
+        val = int16_t(r[2]) & int16_t(r[0]);
+        r[2] = val;
+    }
+    // 13c2: cmp dx, -1
+    {
+        val = (dst = int16_t(r[2])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 13c5: jne 13d1
+    if (!ZF)
+        AOT_GOTO(0x13d1, L13d1);
+    AOT_GOTO(0x13c7, L13c7);
+L13c7:
+    AOT_BLOCK(0x13c7, 3);
+    // 13c7: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 13cc: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 13cf: jmp short 13fe
+    AOT_GOTO(0x13fe, L13fe);
+L13d1:
+    AOT_BLOCK(0x13d1, 4);
+    // 13d1: push [bp-4]
+    {
+        a = uint16_t(r[5] - 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 13d4: push [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 13d7: push [si+2]
+    {
+        a = uint16_t(r[6] + 2);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 13da: call 11b3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x13dd);
+    }
+    AOT_GOTO(0x11b3, L11b3);
+L13dd:
+    AOT_BLOCK(0x13dd, 3);
+    // 13dd: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 13e0: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 13e2: jne 13f5
+    if (!ZF)
+        AOT_GOTO(0x13f5, L13f5);
+    AOT_GOTO(0x13e4, L13e4);
+L13e4:
+    AOT_BLOCK(0x13e4, 6);
+    // 13e4: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 13e6: mov bx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[3] = RD16(a);
+    }
+    // 13e9: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 13eb: or [si+4], 0020
+    {
+        a = uint16_t(r[6] + 4);
+        val = int16_t(RD16(a)) | 32;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 13f0: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 13f3: jmp short 13fe
+    AOT_GOTO(0x13fe, L13fe);
+L13f5:
+    AOT_BLOCK(0x13f5, 3);
+    // 13f5: mov dx, di
+    {
+        r[2] = r[7];
+    }
+    // 13f7: mov bx, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[3] = RD16(a);
+    }
+    // 13fa: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    AOT_GOTO(0x13fc, L13fc);
+L13fc:
+    AOT_BLOCK(0x13fc, 1);
+    // 13fc: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    AOT_GOTO(0x13fe, L13fe);
+L13fe:
+    AOT_BLOCK(0x13fe, 1);
+    // 13fe: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L1401:
+    AOT_BLOCK(0x1401, 12);
+    // 1401: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1402: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1404: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1405: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1406: mov si, [bp+a]
+    {
+        a = uint16_t(r[5] + 10);
+        r[6] = RD16(a);
+    }
+    // 1409: mov ax, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[0] = RD16(a);
+    }
+    // 140c: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 140d: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1410: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1413: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1414: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1415: call 1b01
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1418);
+    }
+    AOT_GOTO(0x1b01, L1b01);
+L1418:
+    AOT_BLOCK(0x1418, 8);
+    // 1418: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 141a: mov ax, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[0] = RD16(a);
+    }
+    // 141d: cwd
+    {
+        r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;
+    }
+    // 141e: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1421: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1424: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1425: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1426: call 1aa3
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1429);
+    }
+    AOT_GOTO(0x1aa3, L1aa3);
+L1429:
+    AOT_BLOCK(0x1429, 4);
+    // 1429: mov [bp+4], ax
+    {
+        a = uint16_t(r[5] + 4);
+        WR16(a, r[0]);
+    }
+    // 142c: mov [bp+6], dx
+    {
+        a = uint16_t(r[5] + 6);
+        WR16(a, r[2]);
+    }
+    // 142f: or dx, ax
+    {
+        val = int16_t(r[2]) | int16_t(r[0]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1431: jne 1439
+    if (!ZF)
+        AOT_GOTO(0x1439, L1439);
+    AOT_GOTO(0x1433, L1433);
+L1433:
+    AOT_BLOCK(0x1433, 2);
+    // 1433: cmp [bp+c], 1
+    {
+        a = uint16_t(r[5] + 12);
+        val = (dst = int16_t(RD16(a))) - (src = 1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1437: jle 1450
+    if (ZF || SF != OF)
+        AOT_GOTO(0x1450, L1450);
+    AOT_GOTO(0x1439, L1439);
+L1439:
+    AOT_BLOCK(0x1439, 8);
+    // 1439: mov dx, [bp+c]
+    {
+        a = uint16_t(r[5] + 12);
+        r[2] = RD16(a);
+    }
+    // 143c: dec dx
+    {
+        val = int16_t(r[2]) - 1;
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 143d: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 143e: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 143f: push [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1442: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1445: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1448: call 1401
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x144b);
+    }
+    AOT_GOTO(0x1401, L1401);
+L144b:
+    AOT_BLOCK(0x144b, 2);
+    // 144b: add sp, a
+    {
+        val = (dst = int16_t(r[4])) + (src = 10);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 144e: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    AOT_GOTO(0x1450, L1450);
+L1450:
+    AOT_BLOCK(0x1450, 2);
+    // 1450: cmp di, 9
+    {
+        val = (dst = int16_t(r[7])) - (src = 9);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1453: jle 145c
+    if (ZF || SF != OF)
+        AOT_GOTO(0x145c, L145c);
+    AOT_GOTO(0x1455, L1455);
+L1455:
+    AOT_BLOCK(0x1455, 3);
+    // 1455: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 1457: sub ax, ffa9
+    {
+        val = (dst = int16_t(r[0])) - (src = -87);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 145a: jmp short 145f
+    AOT_GOTO(0x145f, L145f);
+L145c:
+    AOT_BLOCK(0x145c, 1);
+    // 145c: lea ax, [di+30]
+    {
+        a = uint16_t(r[7] + 48);
+        r[0] = a;
+    }
+    AOT_GOTO(0x145f, L145f);
+L145f:
+    AOT_BLOCK(0x145f, 3);
+    // 145f: mov [si], al
+    {
+        a = uint16_t(r[6]);
+        WR8(a, uint8_t(r[0]));
+    }
+    // 1461: lea ax, [si+1]
+    {
+        a = uint16_t(r[6] + 1);
+        r[0] = a;
+    }
+    // 1464: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L1471:
+    AOT_BLOCK(0x1471, 2);
+    // 1471: mov cx, 0003
+    {
+        r[1] = 0x0003;
+    }
+    // 1474: jmp short 1476
+    AOT_GOTO(0x1476, L1476);
+L1476:
+    AOT_BLOCK(0x1476, 4);
+    // 1476: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1477: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1479: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 147c: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 147f: int 20
+    AOT_INTERP(0x147f);
+L1481:
+    AOT_BLOCK(0x1481, 2);
+    // 1481: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1482: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1482);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1483:
+    AOT_BLOCK(0x1483, 11);
+    // 1483: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1484: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1486: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1487: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1488: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 148b: mov si, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[6] = RD16(a);
+    }
+    // 148e: mov cx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[1] = RD16(a);
+    }
+    // 1491: mov ax, di
+    {
+        r[0] = r[7];
+    }
+    // 1493: sub ax, si
+    {
+        val = (dst = int16_t(r[0])) - (src = int16_t(r[6]));
+        r[0] = val;
+    }
+    // 1495: cmp ax, cx
+    {
+        val = (dst = int16_t(r[0])) - (src = int16_t(r[1]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1497: jb 14b6
+    if (CF)
+        AOT_GOTO(0x14b6, L14b6);
+    AOT_GOTO(0x1499, L1499);
+L1499:
+    AOT_BLOCK(0x1499, 3);
+    // 1499: cld
+    {
+        DF = false;
+    }
+    // 149a: cmp cx, 10
+    {
+        val = (dst = int16_t(r[1])) - (src = 16);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 149d: jb 14ad
+    if (CF)
+        AOT_GOTO(0x14ad, L14ad);
+    AOT_GOTO(0x149f, L149f);
+L149f:
+    AOT_BLOCK(0x149f, 4);
+    // 149f: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 14a1: or ax, di
+    {
+        val = int16_t(r[0]) | int16_t(r[7]);
+        r[0] = val;
+    }
+    // 14a3: test al, 1
+    {
+        val = int8_t(r[0]) & 1;
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 14a5: jne 14ad
+    if (!ZF)
+        AOT_GOTO(0x14ad, L14ad);
+    AOT_GOTO(0x14a7, L14a7);
+L14a7:
+    AOT_BLOCK(0x14a7, 3);
+    // 14a7: shr cx, 1
+    {
+        val = r[1] >> (1 - 1);
+        r[1] = val >> 1;
+        SF = int16_t((val >> 1)) < 0;
+        ZF = int16_t((val >> 1)) == 0;
+        PF = ptable[uint8_t((val >> 1))];
+        CF = val & 1;
+        OF = val & 0x8000;
+    }
+    // 14a9: rep movsw
+    {
+        if (r[1]) {
+            do {
+                WR16(r[7], RD16(r[6]));
+                if (DF) {
+                    r[6] -= 2;
+                    r[7] -= 2;
+                } else {
+                    r[6] += 2;
+                    r[7] += 2;
+                }
+            } while (--r[1]);
+        }
+    }
+    // 14ab: adc cx, cx
+    {
+        val = (dst = int16_t(r[1])) + (src = int16_t(r[1])) + CF;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) + CF > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val) || (CF && !(src + 1));
+    }
+    AOT_GOTO(0x14ad, L14ad);
+L14ad:
+    AOT_BLOCK(0x14ad, 1);
+    // 14ad: rep movsb
+    {
+        if (r[1]) {
+            do {
+                WR8(r[7], RD8(r[6]));
+                if (DF) {
+                    r[6] -= 1;
+                    r[7] -= 1;
+                } else {
+                    r[6] += 1;
+                    r[7] += 1;
+                }
+            } while (--r[1]);
+        }
+    }
+    AOT_GOTO(0x14af, L14af);
+L14af:
+    AOT_BLOCK(0x14af, 5);
+    // 14af: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 14b2: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 14b3: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 14b4: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 14b5: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x14b5);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L14b6:
+    AOT_BLOCK(0x14b6, 8);
+    // 14b6: std
+    {
+        DF = true;
+    }
+    // 14b7: add si, cx
+    {
+        val = (dst = int16_t(r[6])) + (src = int16_t(r[1]));
+        r[6] = val;
+    }
+    // 14b9: dec si
+    {
+        val = int16_t(r[6]) - 1;
+        r[6] = val;
+    }
+    // 14ba: add di, cx
+    {
+        val = (dst = int16_t(r[7])) + (src = int16_t(r[1]));
+        r[7] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 14bc: dec di
+    {
+        val = int16_t(r[7]) - 1;
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 14bd: rep movsb
+    {
+        if (r[1]) {
+            do {
+                WR8(r[7], RD8(r[6]));
+                if (DF) {
+                    r[6] -= 1;
+                    r[7] -= 1;
+                } else {
+                    r[6] += 1;
+                    r[7] += 1;
+                }
+            } while (--r[1]);
+        }
+    }
+    // 14bf: cld
+    {
+        DF = false;
+    }
+    // 14c0: jmp short 14af
+    AOT_GOTO(0x14af, L14af);
+L14c2:
+    AOT_BLOCK(0x14c2, 7);
+    // 14c2: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 14c3: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 14c5: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 14c6: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 14c7: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+    }
+    // 14c9: test cx, cx
+    {
+        val = int16_t(r[1]) & int16_t(r[1]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 14cb: je 14e8
+    if (ZF)
+        AOT_GOTO(0x14e8, L14e8);
+    AOT_GOTO(0x14cd, L14cd);
+L14cd:
+    AOT_BLOCK(0x14cd, 3);
+    // 14cd: mov si, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[6] = RD16(a);
+    }
+    // 14d0: mov di, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[7] = RD16(a);
+    }
+    // 14d3: cld
+    {
+        DF = false;
+    }
+    AOT_GOTO(0x14d4, L14d4);
+L14d4:
+    // 14d4: cmpsb
+    AOT_INTERP(0x14d4);
+L14d5:
+    AOT_BLOCK(0x14d5, 1);
+    // 14d5: jne 14e2
+    if (!ZF)
+        AOT_GOTO(0x14e2, L14e2);
+    AOT_GOTO(0x14d7, L14d7);
+L14d7:
+    AOT_BLOCK(0x14d7, 2);
+    // 14d7: cmp byte [si-1], 0
+    {
+        a = uint16_t(r[6] - 1);
+        val = (dst = int8_t(RD8(a))) - (src = 0);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 14db: je 14e8
+    if (ZF)
+        AOT_GOTO(0x14e8, L14e8);
+    AOT_GOTO(0x14dd, L14dd);
+L14dd:
+    AOT_BLOCK(0x14dd, 2);
+    // 14dd: dec cx
+    {
+        val = int16_t(r[1]) - 1;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 14de: jne 14d4
+    if (!ZF)
+        AOT_GOTO(0x14d4, L14d4);
+    AOT_GOTO(0x14e0, L14e0);
+L14e0:
+    AOT_BLOCK(0x14e0, 1);
+    // 14e0: jmp short 14e8
+    AOT_GOTO(0x14e8, L14e8);
+L14e2:
+    AOT_BLOCK(0x14e2, 1);
+    // 14e2: jnbe 14e7
+    if (!(CF || ZF))
+        AOT_GOTO(0x14e7, L14e7);
+    AOT_GOTO(0x14e4, L14e4);
+L14e4:
+    AOT_BLOCK(0x14e4, 1);
+    // 14e4: sub ax, 0002
+    {
+        val = (dst = int16_t(r[0])) - (src = 2);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    AOT_GOTO(0x14e7, L14e7);
+L14e7:
+    AOT_BLOCK(0x14e7, 1);
+    // 14e7: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x14e8, L14e8);
+L14e8:
+    AOT_BLOCK(0x14e8, 4);
+    // 14e8: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 14e9: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 14ea: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 14eb: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x14eb);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L14ec:
+    AOT_BLOCK(0x14ec, 10);
+    // 14ec: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 14ed: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 14ef: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 14f0: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 14f3: xor al, al
+    {
+        val = int8_t(r[0]) ^ int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+    }
+    // 14f5: mov dx, cx
+    {
+        r[2] = r[1];
+    }
+    // 14f7: cmp cl, 1
+    {
+        val = (dst = int8_t(r[1])) - (src = 1);
+        OF = val != int8_t(val);
+        SF = int8_t(val) < 0;
+        ZF = int8_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint8_t(dst) < uint8_t(src);
+    }
+    // 14fa: cld
+    {
+        DF = false;
+    }
+    // 14fb: rep scasb
+    {
+        if (r[1]) {
+            do {
+                val = int8_t(dst = uint8_t(r[0])) - int8_t(src = RD8(r[7]));
+                AF = (dst & 15) - (src & 15) < 0;
+                CF = dst < src;
+                OF = val != int8_t(val);
+                SF = int8_t(val) < 0;
+                ZF = int8_t(val) == 0;
+                PF = ptable[uint8_t(val)];
+                if (DF) r[7] -= 1;
+                else r[7] += 1;
+            } while (--r[1] && !ZF);
+        }
+    }
+    // 14fd: jne 1500
+    if (!ZF)
+        AOT_GOTO(0x1500, L1500);
+    AOT_GOTO(0x14ff, L14ff);
+L14ff:
+    AOT_BLOCK(0x14ff, 1);
+    // 14ff: inc cx
+    {
+        val = int16_t(r[1]) + 1;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x1500, L1500);
+L1500:
+    AOT_BLOCK(0x1500, 5);
+    // 1500: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 1502: sub ax, cx
+    {
+        val = (dst = int16_t(r[0])) - (src = int16_t(r[1]));
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1504: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 1505: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1506: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1506);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1507:
+    AOT_BLOCK(0x1507, 7);
+    // 1507: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1508: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 150a: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 150b: mov bx, [0492]
+    {
+        a = 0x0492;
+        r[3] = RD16(a);
+    }
+    // 150f: add bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(r[3])) + (src = int16_t(RD16(a)));
+        r[3] = val;
+    }
+    // 1512: cmp [0492], bx
+    {
+        a = 0x0492;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[3]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1516: jnbe 152f
+    if (!(CF || ZF))
+        AOT_GOTO(0x152f, L152f);
+    AOT_GOTO(0x1518, L1518);
+L1518:
+    AOT_BLOCK(0x1518, 7);
+    // 1518: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 151b: add dx, [0492]
+    {
+        a = 0x0492;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 151f: add dx, 03ff
+    {
+        val = (dst = int16_t(r[2])) + (src = 1023);
+        r[2] = val;
+    }
+    // 1523: and dx, fc00
+    {
+        val = int16_t(r[2]) & -1024;
+        r[2] = val;
+    }
+    // 1527: mov si, dx
+    {
+        r[6] = r[2];
+    }
+    // 1529: cmp [0492], dx
+    {
+        a = 0x0492;
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 152d: jbe 1539
+    if (CF || ZF)
+        AOT_GOTO(0x1539, L1539);
+    AOT_GOTO(0x152f, L152f);
+L152f:
+    AOT_BLOCK(0x152f, 3);
+    // 152f: mov [03a2], 000c
+    {
+        a = 0x03a2;
+        WR16(a, 0x000c);
+    }
+    // 1535: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1537: jmp short 1561
+    AOT_GOTO(0x1561, L1561);
+L1539:
+    AOT_BLOCK(0x1539, 2);
+    // 1539: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 153a: call 17e0
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x153d);
+    }
+    AOT_GOTO(0x17e0, L17e0);
+L153d:
+    AOT_BLOCK(0x153d, 3);
+    // 153d: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 153e: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1540: je 1546
+    if (ZF)
+        AOT_GOTO(0x1546, L1546);
+    AOT_GOTO(0x1542, L1542);
+L1542:
+    AOT_BLOCK(0x1542, 2);
+    // 1542: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1544: jmp short 1561
+    AOT_GOTO(0x1561, L1561);
+L1546:
+    AOT_BLOCK(0x1546, 5);
+    // 1546: mov bx, [0492]
+    {
+        a = 0x0492;
+        r[3] = RD16(a);
+    }
+    // 154a: mov [bx-2], si
+    {
+        a = uint16_t(r[3] - 2);
+        WR16(a, r[6]);
+    }
+    // 154d: mov [si-2], 0000
+    {
+        a = uint16_t(r[6] - 2);
+        WR16(a, 0x0000);
+    }
+    // 1552: push [0492]
+    {
+        a = 0x0492;
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1556: call 1733
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1559);
+    }
+    AOT_GOTO(0x1733, L1733);
+L1559:
+    AOT_BLOCK(0x1559, 3);
+    // 1559: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 155a: mov [0492], si
+    {
+        a = 0x0492;
+        WR16(a, r[6]);
+    }
+    // 155e: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    AOT_GOTO(0x1561, L1561);
+L1561:
+    AOT_BLOCK(0x1561, 1);
+    // 1561: jmp 1af8
+    AOT_GOTO(0x1af8, L1af8);
+L1564:
+    AOT_BLOCK(0x1564, 7);
+    // 1564: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1565: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1567: sub sp, c
+    {
+        val = (dst = int16_t(r[4])) - (src = 12);
+        r[4] = val;
+    }
+    // 156a: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 156b: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 156c: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1570: jne 1577
+    if (!ZF)
+        AOT_GOTO(0x1577, L1577);
+    AOT_GOTO(0x1572, L1572);
+L1572:
+    AOT_BLOCK(0x1572, 2);
+    // 1572: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1574: jmp 1644
+    AOT_GOTO(0x1644, L1644);
+L1577:
+    AOT_BLOCK(0x1577, 1);
+    // 1577: mov [bp-c], 0000
+    {
+        a = uint16_t(r[5] - 12);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x157c, L157c);
+L157c:
+    AOT_BLOCK(0x157c, 2);
+    // 157c: cmp [bp-c], 2
+    {
+        a = uint16_t(r[5] - 12);
+        val = (dst = int16_t(RD16(a))) - (src = 2);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1580: jb 1585
+    if (CF)
+        AOT_GOTO(0x1585, L1585);
+    AOT_GOTO(0x1582, L1582);
+L1582:
+    AOT_BLOCK(0x1582, 1);
+    // 1582: jmp 1642
+    AOT_GOTO(0x1642, L1642);
+L1585:
+    AOT_BLOCK(0x1585, 7);
+    // 1585: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1588: inc dx
+    {
+        val = int16_t(r[2]) + 1;
+        r[2] = val;
+    }
+    // 1589: and dx, fffe
+    {
+        val = int16_t(r[2]) & -2;
+        r[2] = val;
+    }
+    // 158d: add dx, 2
+    {
+        val = (dst = int16_t(r[2])) + (src = 2);
+        r[2] = val;
+    }
+    // 1590: mov [bp-a], dx
+    {
+        a = uint16_t(r[5] - 10);
+        WR16(a, r[2]);
+    }
+    // 1593: cmp dx, 4
+    {
+        val = (dst = int16_t(r[2])) - (src = 4);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1596: jnb 15a3
+    if (!CF)
+        AOT_GOTO(0x15a3, L15a3);
+    AOT_GOTO(0x1598, L1598);
+L1598:
+    AOT_BLOCK(0x1598, 3);
+    // 1598: mov [03a2], 000c
+    {
+        a = 0x03a2;
+        WR16(a, 0x000c);
+    }
+    // 159e: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 15a0: jmp 1644
+    AOT_GOTO(0x1644, L1644);
+L15a3:
+    AOT_BLOCK(0x15a3, 2);
+    // 15a3: cmp [0490], 0
+    {
+        a = 0x0490;
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 15a8: jne 15d7
+    if (!ZF)
+        AOT_GOTO(0x15d7, L15d7);
+    AOT_GOTO(0x15aa, L15aa);
+L15aa:
+    AOT_BLOCK(0x15aa, 3);
+    // 15aa: mov ax, 0004
+    {
+        r[0] = 0x0004;
+    }
+    // 15ad: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 15ae: call 1812
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x15b1);
+    }
+    AOT_GOTO(0x1812, L1812);
+L15b1:
+    AOT_BLOCK(0x15b1, 4);
+    // 15b1: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 15b2: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 15b4: cmp ax, ffff
+    {
+        val = (dst = int16_t(r[0])) - (src = -1);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 15b7: jne 15be
+    if (!ZF)
+        AOT_GOTO(0x15be, L15be);
+    AOT_GOTO(0x15b9, L15b9);
+L15b9:
+    AOT_BLOCK(0x15b9, 2);
+    // 15b9: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 15bb: jmp 1644
+    AOT_GOTO(0x1644, L1644);
+L15be:
+    AOT_BLOCK(0x15be, 8);
+    // 15be: mov dx, si
+    {
+        r[2] = r[6];
+    }
+    // 15c0: inc dx
+    {
+        val = int16_t(r[2]) + 1;
+        r[2] = val;
+    }
+    // 15c1: and dx, fffe
+    {
+        val = int16_t(r[2]) & -2;
+        r[2] = val;
+    }
+    // 15c5: mov si, dx
+    {
+        r[6] = r[2];
+    }
+    // 15c7: add si, 2
+    {
+        val = (dst = int16_t(r[6])) + (src = 2);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 15ca: mov [0490], si
+    {
+        a = 0x0490;
+        WR16(a, r[6]);
+    }
+    // 15ce: mov [0492], si
+    {
+        a = 0x0492;
+        WR16(a, r[6]);
+    }
+    // 15d2: mov [si-2], 0000
+    {
+        a = uint16_t(r[6] - 2);
+        WR16(a, 0x0000);
+    }
+    AOT_GOTO(0x15d7, L15d7);
+L15d7:
+    AOT_BLOCK(0x15d7, 2);
+    // 15d7: mov [bp-2], 0000
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, 0x0000);
+    }
+    // 15dc: mov si, [0494]
+    {
+        a = 0x0494;
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x15e0, L15e0);
+L15e0:
+    AOT_BLOCK(0x15e0, 2);
+    // 15e0: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 15e2: je 1631
+    if (ZF)
+        AOT_GOTO(0x1631, L1631);
+    AOT_GOTO(0x15e4, L15e4);
+L15e4:
+    AOT_BLOCK(0x15e4, 7);
+    // 15e4: mov dx, [si-2]
+    {
+        a = uint16_t(r[6] - 2);
+        r[2] = RD16(a);
+    }
+    // 15e7: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 15ea: mov dx, [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        r[2] = RD16(a);
+    }
+    // 15ed: add dx, si
+    {
+        val = (dst = int16_t(r[2])) + (src = int16_t(r[6]));
+        r[2] = val;
+    }
+    // 15ef: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 15f1: cmp [bp-6], di
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[7]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 15f4: jb 162a
+    if (CF)
+        AOT_GOTO(0x162a, L162a);
+    AOT_GOTO(0x15f6, L15f6);
+L15f6:
+    AOT_BLOCK(0x15f6, 2);
+    // 15f6: cmp di, si
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 15f8: jbe 162a
+    if (CF || ZF)
+        AOT_GOTO(0x162a, L162a);
+    AOT_GOTO(0x15fa, L15fa);
+L15fa:
+    AOT_BLOCK(0x15fa, 3);
+    // 15fa: lea bx, [di+2]
+    {
+        a = uint16_t(r[7] + 2);
+        r[3] = a;
+    }
+    // 15fd: cmp [bp-6], bx
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[3]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1600: jbe 1611
+    if (CF || ZF)
+        AOT_GOTO(0x1611, L1611);
+    AOT_GOTO(0x1602, L1602);
+L1602:
+    AOT_BLOCK(0x1602, 6);
+    // 1602: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1605: mov [di-2], dx
+    {
+        a = uint16_t(r[7] - 2);
+        WR16(a, r[2]);
+    }
+    // 1608: mov [si-2], di
+    {
+        a = uint16_t(r[6] - 2);
+        WR16(a, r[7]);
+    }
+    // 160b: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 160d: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    // 160f: mov [si], di
+    {
+        a = uint16_t(r[6]);
+        WR16(a, r[7]);
+    }
+    AOT_GOTO(0x1611, L1611);
+L1611:
+    AOT_BLOCK(0x1611, 2);
+    // 1611: cmp [bp-2], 0
+    {
+        a = uint16_t(r[5] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1615: je 1620
+    if (ZF)
+        AOT_GOTO(0x1620, L1620);
+    AOT_GOTO(0x1617, L1617);
+L1617:
+    AOT_BLOCK(0x1617, 4);
+    // 1617: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1619: mov bx, [bp-2]
+    {
+        a = uint16_t(r[5] - 2);
+        r[3] = RD16(a);
+    }
+    // 161c: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    // 161e: jmp short 1626
+    AOT_GOTO(0x1626, L1626);
+L1620:
+    AOT_BLOCK(0x1620, 2);
+    // 1620: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1622: mov [0494], dx
+    {
+        a = 0x0494;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1626, L1626);
+L1626:
+    AOT_BLOCK(0x1626, 2);
+    // 1626: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 1628: jmp short 1644
+    AOT_GOTO(0x1644, L1644);
+L162a:
+    AOT_BLOCK(0x162a, 3);
+    // 162a: mov [bp-2], si
+    {
+        a = uint16_t(r[5] - 2);
+        WR16(a, r[6]);
+    }
+    // 162d: mov si, [si]
+    {
+        a = uint16_t(r[6]);
+        r[6] = RD16(a);
+    }
+    // 162f: jmp short 15e0
+    AOT_GOTO(0x15e0, L15e0);
+L1631:
+    AOT_BLOCK(0x1631, 2);
+    // 1631: push [bp-a]
+    {
+        a = uint16_t(r[5] - 10);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1634: call 1507
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1637);
+    }
+    AOT_GOTO(0x1507, L1507);
+L1637:
+    AOT_BLOCK(0x1637, 3);
+    // 1637: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1638: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 163a: je 1642
+    if (ZF)
+        AOT_GOTO(0x1642, L1642);
+    AOT_GOTO(0x163c, L163c);
+L163c:
+    AOT_BLOCK(0x163c, 2);
+    // 163c: inc [bp-c]
+    {
+        a = uint16_t(r[5] - 12);
+        val = int16_t(RD16(a)) + 1;
+        WR16(a, val);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 163f: jmp 157c
+    AOT_GOTO(0x157c, L157c);
+L1642:
+    AOT_BLOCK(0x1642, 1);
+    // 1642: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1644, L1644);
+L1644:
+    AOT_BLOCK(0x1644, 1);
+    // 1644: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L1733:
+    AOT_BLOCK(0x1733, 9);
+    // 1733: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1734: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1736: sub sp, 6
+    {
+        val = (dst = int16_t(r[4])) - (src = 6);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 1739: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 173a: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 173b: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 173e: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 1741: or dx, dx
+    {
+        val = int16_t(r[2]) | int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1743: je 17a6
+    if (ZF)
+        AOT_GOTO(0x17a6, L17a6);
+    AOT_GOTO(0x1745, L1745);
+L1745:
+    AOT_BLOCK(0x1745, 2);
+    // 1745: xor di, di
+    {
+        val = int16_t(r[7]) ^ int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1747: mov si, [0494]
+    {
+        a = 0x0494;
+        r[6] = RD16(a);
+    }
+    AOT_GOTO(0x174b, L174b);
+L174b:
+    AOT_BLOCK(0x174b, 2);
+    // 174b: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 174d: je 175a
+    if (ZF)
+        AOT_GOTO(0x175a, L175a);
+    AOT_GOTO(0x174f, L174f);
+L174f:
+    AOT_BLOCK(0x174f, 2);
+    // 174f: cmp [bp-6], si
+    {
+        a = uint16_t(r[5] - 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1752: jb 175a
+    if (CF)
+        AOT_GOTO(0x175a, L175a);
+    AOT_GOTO(0x1754, L1754);
+L1754:
+    AOT_BLOCK(0x1754, 3);
+    // 1754: mov di, si
+    {
+        r[7] = r[6];
+    }
+    // 1756: mov si, [si]
+    {
+        a = uint16_t(r[6]);
+        r[6] = RD16(a);
+    }
+    // 1758: jmp short 174b
+    AOT_GOTO(0x174b, L174b);
+L175a:
+    AOT_BLOCK(0x175a, 4);
+    // 175a: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 175d: mov [bx], si
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[6]);
+    }
+    // 175f: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1761: je 176a
+    if (ZF)
+        AOT_GOTO(0x176a, L176a);
+    AOT_GOTO(0x1763, L1763);
+L1763:
+    AOT_BLOCK(0x1763, 3);
+    // 1763: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1766: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    // 1768: jmp short 1771
+    AOT_GOTO(0x1771, L1771);
+L176a:
+    AOT_BLOCK(0x176a, 2);
+    // 176a: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 176d: mov [0494], dx
+    {
+        a = 0x0494;
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x1771, L1771);
+L1771:
+    AOT_BLOCK(0x1771, 2);
+    // 1771: or si, si
+    {
+        val = int16_t(r[6]) | int16_t(r[6]);
+        r[6] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1773: je 178a
+    if (ZF)
+        AOT_GOTO(0x178a, L178a);
+    AOT_GOTO(0x1775, L1775);
+L1775:
+    AOT_BLOCK(0x1775, 3);
+    // 1775: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 1778: cmp [bx-2], si
+    {
+        a = uint16_t(r[3] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 177b: jne 178a
+    if (!ZF)
+        AOT_GOTO(0x178a, L178a);
+    AOT_GOTO(0x177d, L177d);
+L177d:
+    AOT_BLOCK(0x177d, 5);
+    // 177d: mov dx, [si-2]
+    {
+        a = uint16_t(r[6] - 2);
+        r[2] = RD16(a);
+    }
+    // 1780: mov [bx-2], dx
+    {
+        a = uint16_t(r[3] - 2);
+        WR16(a, r[2]);
+    }
+    // 1783: mov dx, [si]
+    {
+        a = uint16_t(r[6]);
+        r[2] = RD16(a);
+    }
+    // 1785: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 1788: mov [bx], dx
+    {
+        a = uint16_t(r[3]);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x178a, L178a);
+L178a:
+    AOT_BLOCK(0x178a, 2);
+    // 178a: or di, di
+    {
+        val = int16_t(r[7]) | int16_t(r[7]);
+        r[7] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 178c: je 17a6
+    if (ZF)
+        AOT_GOTO(0x17a6, L17a6);
+    AOT_GOTO(0x178e, L178e);
+L178e:
+    AOT_BLOCK(0x178e, 3);
+    // 178e: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1791: cmp [di-2], dx
+    {
+        a = uint16_t(r[7] - 2);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1794: jne 17a6
+    if (!ZF)
+        AOT_GOTO(0x17a6, L17a6);
+    AOT_GOTO(0x1796, L1796);
+L1796:
+    AOT_BLOCK(0x1796, 6);
+    // 1796: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 1799: mov dx, [bx-2]
+    {
+        a = uint16_t(r[3] - 2);
+        r[2] = RD16(a);
+    }
+    // 179c: mov [di-2], dx
+    {
+        a = uint16_t(r[7] - 2);
+        WR16(a, r[2]);
+    }
+    // 179f: mov bx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[3] = RD16(a);
+    }
+    // 17a2: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 17a4: mov [di], dx
+    {
+        a = uint16_t(r[7]);
+        WR16(a, r[2]);
+    }
+    AOT_GOTO(0x17a6, L17a6);
+L17a6:
+    AOT_BLOCK(0x17a6, 1);
+    // 17a6: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L17a9:
+    AOT_BLOCK(0x17a9, 6);
+    // 17a9: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 17aa: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 17ac: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 17af: sub dx, 61
+    {
+        val = (dst = int16_t(r[2])) - (src = 97);
+        r[2] = val;
+    }
+    // 17b2: cmp dx, 1a
+    {
+        val = (dst = int16_t(r[2])) - (src = 26);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 17b5: jnb 17bf
+    if (!CF)
+        AOT_GOTO(0x17bf, L17bf);
+    AOT_GOTO(0x17b7, L17b7);
+L17b7:
+    AOT_BLOCK(0x17b7, 3);
+    // 17b7: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 17ba: sub ax, 0020
+    {
+        val = (dst = int16_t(r[0])) - (src = 32);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 17bd: jmp short 17c2
+    AOT_GOTO(0x17c2, L17c2);
+L17bf:
+    AOT_BLOCK(0x17bf, 1);
+    // 17bf: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    AOT_GOTO(0x17c2, L17c2);
+L17c2:
+    AOT_BLOCK(0x17c2, 1);
+    // 17c2: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L17c5:
+    AOT_BLOCK(0x17c5, 7);
+    // 17c5: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 17c6: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 17c8: mov ax, 0384
+    {
+        r[0] = 0x0384;
+    }
+    // 17cb: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17cc: mov ax, 02a6
+    {
+        r[0] = 0x02a6;
+    }
+    // 17cf: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17d0: call 08d1
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x17d3);
+    }
+    AOT_GOTO(0x08d1, L08d1);
+L17d3:
+    AOT_BLOCK(0x17d3, 5);
+    // 17d3: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 17d4: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 17d5: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 17d8: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17d9: call 0851
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x17dc);
+    }
+    AOT_GOTO(0x0851, L0851);
+L17dc:
+    AOT_BLOCK(0x17dc, 2);
+    // 17dc: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 17dd: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L17e0:
+    AOT_BLOCK(0x17e0, 12);
+    // 17e0: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 17e1: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 17e3: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        AF = (dst & 15) - (src & 15) < 0;
+    }
+    // 17e6: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 17e9: mov [bp-e], dx
+    {
+        a = uint16_t(r[5] - 14);
+        WR16(a, r[2]);
+    }
+    // 17ec: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 17ef: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17f0: mov ax, 0011
+    {
+        r[0] = 0x0011;
+    }
+    // 17f3: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17f4: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 17f6: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 17f7: call 0919
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x17fa);
+    }
+    AOT_GOTO(0x0919, L0919);
+L17fa:
+    AOT_BLOCK(0x17fa, 3);
+    // 17fa: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 17fd: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 17ff: jnl 1806
+    if (SF == OF)
+        AOT_GOTO(0x1806, L1806);
+    AOT_GOTO(0x1801, L1801);
+L1801:
+    AOT_BLOCK(0x1801, 2);
+    // 1801: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 1804: jmp short 180f
+    AOT_GOTO(0x180f, L180f);
+L1806:
+    AOT_BLOCK(0x1806, 3);
+    // 1806: mov dx, [bp-6]
+    {
+        a = uint16_t(r[5] - 6);
+        r[2] = RD16(a);
+    }
+    // 1809: mov [03a4], dx
+    {
+        a = 0x03a4;
+        WR16(a, r[2]);
+    }
+    // 180d: xor ax, ax
+    {
+        val = int16_t(r[0]) ^ int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x180f, L180f);
+L180f:
+    AOT_BLOCK(0x180f, 1);
+    // 180f: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L1812:
+    AOT_BLOCK(0x1812, 10);
+    // 1812: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1813: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1815: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1816: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1817: mov si, [03a4]
+    {
+        a = 0x03a4;
+        r[6] = RD16(a);
+    }
+    // 181b: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 181e: add dx, [03a4]
+    {
+        a = 0x03a4;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 1822: mov di, dx
+    {
+        r[7] = r[2];
+    }
+    // 1824: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1828: jle 182e
+    if (ZF || SF != OF)
+        AOT_GOTO(0x182e, L182e);
+    AOT_GOTO(0x182a, L182a);
+L182a:
+    AOT_BLOCK(0x182a, 2);
+    // 182a: cmp di, si
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 182c: jb 1838
+    if (CF)
+        AOT_GOTO(0x1838, L1838);
+    AOT_GOTO(0x182e, L182e);
+L182e:
+    AOT_BLOCK(0x182e, 2);
+    // 182e: cmp [bp+4], 0
+    {
+        a = uint16_t(r[5] + 4);
+        val = (dst = int16_t(RD16(a))) - (src = 0);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1832: jnl 183d
+    if (SF == OF)
+        AOT_GOTO(0x183d, L183d);
+    AOT_GOTO(0x1834, L1834);
+L1834:
+    AOT_BLOCK(0x1834, 2);
+    // 1834: cmp di, si
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[6]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1836: jbe 183d
+    if (CF || ZF)
+        AOT_GOTO(0x183d, L183d);
+    AOT_GOTO(0x1838, L1838);
+L1838:
+    AOT_BLOCK(0x1838, 2);
+    // 1838: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    // 183b: jmp short 184d
+    AOT_GOTO(0x184d, L184d);
+L183d:
+    AOT_BLOCK(0x183d, 2);
+    // 183d: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 183e: call 17e0
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1841);
+    }
+    AOT_GOTO(0x17e0, L17e0);
+L1841:
+    AOT_BLOCK(0x1841, 3);
+    // 1841: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1842: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1844: jne 184a
+    if (!ZF)
+        AOT_GOTO(0x184a, L184a);
+    AOT_GOTO(0x1846, L1846);
+L1846:
+    AOT_BLOCK(0x1846, 2);
+    // 1846: mov ax, si
+    {
+        r[0] = r[6];
+    }
+    // 1848: jmp short 184d
+    AOT_GOTO(0x184d, L184d);
+L184a:
+    AOT_BLOCK(0x184a, 1);
+    // 184a: mov ax, ffff
+    {
+        r[0] = 0xffff;
+    }
+    AOT_GOTO(0x184d, L184d);
+L184d:
+    AOT_BLOCK(0x184d, 1);
+    // 184d: jmp 1af7
+    AOT_GOTO(0x1af7, L1af7);
+L1850:
+    AOT_BLOCK(0x1850, 5);
+    // 1850: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1851: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1853: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1854: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1857: call 090b
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x185a);
+    }
+    AOT_GOTO(0x090b, L090b);
+L185a:
+    AOT_BLOCK(0x185a, 10);
+    // 185a: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 185b: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+    }
+    // 185c: mov si, ax
+    {
+        r[6] = r[0];
+    }
+    // 185e: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1861: mov [bx+4], si
+    {
+        a = uint16_t(r[3] + 4);
+        WR16(a, r[6]);
+    }
+    // 1864: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1867: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 186a: mov [bx+8], dx
+    {
+        a = uint16_t(r[3] + 8);
+        WR16(a, r[2]);
+    }
+    // 186d: cmp si, e
+    {
+        val = (dst = int16_t(r[6])) - (src = 14);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1870: jnbe 1881
+    if (!(CF || ZF))
+        AOT_GOTO(0x1881, L1881);
+    AOT_GOTO(0x1872, L1872);
+L1872:
+    AOT_BLOCK(0x1872, 5);
+    // 1872: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1875: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1878: add bx, a
+    {
+        val = (dst = int16_t(r[3])) + (src = 10);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 187b: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 187c: call 1a2a
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x187f);
+    }
+    AOT_GOTO(0x1a2a, L1a2a);
+L187f:
+    AOT_BLOCK(0x187f, 2);
+    // 187f: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1880: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    AOT_GOTO(0x1881, L1881);
+L1881:
+    AOT_BLOCK(0x1881, 1);
+    // 1881: jmp 1af8
+    AOT_GOTO(0x1af8, L1af8);
+L1884:
+    AOT_BLOCK(0x1884, 7);
+    // 1884: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1885: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1887: sub sp, 20
+    {
+        val = (dst = int16_t(r[4])) - (src = 32);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 188a: lea ax, [bp-20]
+    {
+        a = uint16_t(r[5] - 32);
+        r[0] = a;
+    }
+    // 188d: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 188e: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 1891: call 18a2
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1894);
+    }
+    AOT_GOTO(0x18a2, L18a2);
+L1894:
+    AOT_BLOCK(0x1894, 5);
+    // 1894: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1895: pop bx
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[3] = val;
+    }
+    // 1896: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+    }
+    // 1898: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 189a: jne 189d
+    if (!ZF)
+        AOT_GOTO(0x189d, L189d);
+    AOT_GOTO(0x189c, L189c);
+L189c:
+    AOT_BLOCK(0x189c, 1);
+    // 189c: inc bx
+    {
+        val = int16_t(r[3]) + 1;
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    AOT_GOTO(0x189d, L189d);
+L189d:
+    AOT_BLOCK(0x189d, 2);
+    // 189d: mov ax, bx
+    {
+        r[0] = r[3];
+    }
+    // 189f: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L18a2:
+    AOT_BLOCK(0x18a2, 7);
+    // 18a2: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 18a3: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 18a5: push [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 18a8: mov ax, 5408
+    {
+        r[0] = 0x5408;
+    }
+    // 18ab: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 18ac: push [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        val = RD16(a);
+        r[4] -= 2;
+        WR16(r[4], val);
+    }
+    // 18af: call 1a3c
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x18b2);
+    }
+    AOT_GOTO(0x1a3c, L1a3c);
+L18b2:
+    AOT_BLOCK(0x18b2, 2);
+    // 18b2: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 18b5: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L1a2a:
+    AOT_BLOCK(0x1a2a, 6);
+    // 1a2a: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1a2b: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1a2d: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1a2e: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1a2f: mov cx, ffff
+    {
+        r[1] = 0xffff;
+    }
+    // 1a32: call 1a69
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1a35);
+    }
+    AOT_GOTO(0x1a69, L1a69);
+L1a35:
+    AOT_BLOCK(0x1a35, 5);
+    // 1a35: mov ax, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[0] = RD16(a);
+    }
+    // 1a38: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 1a39: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 1a3a: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1a3b: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1a3b);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1a3c:
+    AOT_BLOCK(0x1a3c, 16);
+    // 1a3c: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1a3d: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1a3f: sub sp, 18
+    {
+        val = (dst = int16_t(r[4])) - (src = 24);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1a42: mov dx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[2] = RD16(a);
+    }
+    // 1a45: mov [bp-14], dx
+    {
+        a = uint16_t(r[5] - 20);
+        WR16(a, r[2]);
+    }
+    // 1a48: mov dx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[2] = RD16(a);
+    }
+    // 1a4b: mov [bp-10], dx
+    {
+        a = uint16_t(r[5] - 16);
+        WR16(a, r[2]);
+    }
+    // 1a4e: mov dx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[2] = RD16(a);
+    }
+    // 1a51: mov [bp-6], dx
+    {
+        a = uint16_t(r[5] - 6);
+        WR16(a, r[2]);
+    }
+    // 1a54: lea ax, [bp-18]
+    {
+        a = uint16_t(r[5] - 24);
+        r[0] = a;
+    }
+    // 1a57: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a58: mov ax, 0036
+    {
+        r[0] = 0x0036;
+    }
+    // 1a5b: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a5c: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1a5f: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a60: call 0919
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1a63);
+    }
+    AOT_GOTO(0x0919, L0919);
+L1a63:
+    AOT_BLOCK(0x1a63, 2);
+    // 1a63: add sp, 6
+    {
+        val = (dst = int16_t(r[4])) + (src = 6);
+        r[4] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) + (src & 15) > 15;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1a66: jmp 1af9
+    AOT_GOTO(0x1af9, L1af9);
+L1a69:
+    AOT_BLOCK(0x1a69, 11);
+    // 1a69: mov di, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[7] = RD16(a);
+    }
+    // 1a6c: xor al, al
+    {
+        val = int8_t(r[0]) ^ int8_t(r[0]);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+    }
+    // 1a6e: mov dx, cx
+    {
+        r[2] = r[1];
+    }
+    // 1a70: cld
+    {
+        DF = false;
+    }
+    // 1a71: rep scasb
+    {
+        if (r[1]) {
+            do {
+                val = int8_t(dst = uint8_t(r[0])) - int8_t(src = RD8(r[7]));
+                AF = (dst & 15) - (src & 15) < 0;
+                CF = dst < src;
+                OF = val != int8_t(val);
+                SF = int8_t(val) < 0;
+                ZF = int8_t(val) == 0;
+                PF = ptable[uint8_t(val)];
+                if (DF) r[7] -= 1;
+                else r[7] += 1;
+            } while (--r[1] && !ZF);
+        }
+    }
+    // 1a73: sub dx, cx
+    {
+        val = (dst = int16_t(r[2])) - (src = int16_t(r[1]));
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1a75: xchg dx, cx
+    {
+        val = int16_t(r[1]);
+        r[1] = int16_t(r[2]);
+        r[2] = val;
+    }
+    // 1a77: mov si, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[6] = RD16(a);
+    }
+    // 1a7a: mov di, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[7] = RD16(a);
+    }
+    // 1a7d: rep movsb
+    {
+        if (r[1]) {
+            do {
+                WR8(r[7], RD8(r[6]));
+                if (DF) {
+                    r[6] -= 1;
+                    r[7] -= 1;
+                } else {
+                    r[6] += 1;
+                    r[7] += 1;
+                }
+            } while (--r[1]);
+        }
+    }
+    // 1a7f: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1a7f);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1a80:
+    AOT_BLOCK(0x1a80, 2);
+    // 1a80: mov dx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[2] = RD16(a);
+    }
+    // 1a82: mov cx, [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        r[1] = RD16(a);
+    }
+    AOT_GOTO(0x1a85, L1a85);
+L1a85:
+    AOT_BLOCK(0x1a85, 3);
+    // 1a85: add bx, 4
+    {
+        val = (dst = int16_t(r[3])) + (src = 4);
+        r[3] = val;
+        CF = uint16_t(dst) > uint16_t(val);
+    }
+    // 1a88: dec cx
+    {
+        val = int16_t(r[1]) - 1;
+        r[1] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (val & 15) == 15;
+        PF = ptable[uint8_t(val)];
+    }
+    // 1a89: jl 1a9f
+    if (SF != OF)
+        AOT_GOTO(0x1a9f, L1a9f);
+    AOT_GOTO(0x1a8b, L1a8b);
+L1a8b:
+    AOT_BLOCK(0x1a8b, 2);
+    // 1a8b: cmp ax, [bx]
+    {
+        a = uint16_t(r[3]);
+        val = (dst = int16_t(r[0])) - (src = int16_t(RD16(a)));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1a8d: jne 1a85
+    if (!ZF)
+        AOT_GOTO(0x1a85, L1a85);
+    AOT_GOTO(0x1a8f, L1a8f);
+L1a8f:
+    AOT_BLOCK(0x1a8f, 1);
+    // 1a8f: mov bx, [bx+2]
+    {
+        a = uint16_t(r[3] + 2);
+        r[3] = RD16(a);
+    }
+    AOT_GOTO(0x1a92, L1a92);
+L1a92:
+    AOT_BLOCK(0x1a92, 2);
+    // 1a92: test bx, bx
+    {
+        val = int16_t(r[3]) & int16_t(r[3]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1a94: jne 1a9d
+    if (!ZF)
+        AOT_GOTO(0x1a9d, L1a9d);
+    AOT_GOTO(0x1a96, L1a96);
+L1a96:
+    AOT_BLOCK(0x1a96, 3);
+    // 1a96: mov ax, 0014
+    {
+        r[0] = 0x0014;
+    }
+    // 1a99: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1a9a: jmp 1af1
+    AOT_GOTO(0x1af1, L1af1);
+L1a9d:
+    AOT_BLOCK(0x1a9d, 1);
+    // 1a9d: jmp bx
+    {
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L1a9f:
+    AOT_BLOCK(0x1a9f, 2);
+    // 1a9f: mov bx, dx
+    {
+        r[3] = r[2];
+    }
+    // 1aa1: jmp short 1a92
+    AOT_GOTO(0x1a92, L1a92);
+L1aa3:
+    AOT_BLOCK(0x1aa3, 7);
+    // 1aa3: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1aa4: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1aa5: mov si, sp
+    {
+        r[6] = r[4];
+    }
+    // 1aa7: mov bx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        r[3] = RD16(a);
+    }
+    // 1aaa: mov ax, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[0] = RD16(a);
+    }
+    // 1aad: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1aaf: jne 1ac5
+    if (!ZF)
+        AOT_GOTO(0x1ac5, L1ac5);
+    AOT_GOTO(0x1ab1, L1ab1);
+L1ab1:
+    AOT_BLOCK(0x1ab1, 6);
+    // 1ab1: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1ab3: mov cx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[1] = RD16(a);
+    }
+    // 1ab6: mov ax, [si+c]
+    {
+        a = uint16_t(r[6] + 12);
+        r[0] = RD16(a);
+    }
+    // 1ab9: div bx
+    {
+        u32 = uint32_t(r[2]) << 16 | r[0];
+        src = r[3];
+        r[0] = u32 / src;
+        r[2] = u32 % src;
+    }
+    // 1abb: xchg cx, ax
+    {
+        val = r[0];
+        r[0] = r[1];
+        r[1] = val;
+    }
+    // 1abc: div bx
+    {
+        u32 = uint32_t(r[2]) << 16 | r[0];
+        src = r[3];
+        r[0] = u32 / src;
+        r[2] = u32 % src;
+    }
+    AOT_GOTO(0x1abe, L1abe);
+L1abe:
+    AOT_BLOCK(0x1abe, 4);
+    // 1abe: mov dx, cx
+    {
+        r[2] = r[1];
+    }
+    // 1ac0: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 1ac1: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 1ac2: ret 0008
+    {
+        b = RD16(r[4]);
+        r[4] += 2;
+        r[4] += 8;
+    }
+    AOT_JUMP(b);
+L1ac5:
+    AOT_BLOCK(0x1ac5, 5);
+    // 1ac5: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 1ac7: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1ac9: mov ax, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[0] = RD16(a);
+    }
+    // 1acc: mov dx, [si+c]
+    {
+        a = uint16_t(r[6] + 12);
+        r[2] = RD16(a);
+    }
+    // 1acf: mov cx, 0010
+    {
+        r[1] = 0x0010;
+    }
+    AOT_GOTO(0x1ad2, L1ad2);
+L1ad2:
+    AOT_BLOCK(0x1ad2, 5);
+    // 1ad2: shl ax, 1
+    {
+        val = r[0] << 1;
+        r[0] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 1ad4: rcl dx, 1
+    {
+        val = r[2];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[2] = val;
+    }
+    // 1ad6: rcl bx, 1
+    {
+        val = r[3];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[3] = val;
+    }
+    // 1ad8: cmp di, bx
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[3]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1ada: jnbe 1ae3
+    if (!(CF || ZF))
+        AOT_GOTO(0x1ae3, L1ae3);
+    AOT_GOTO(0x1adc, L1adc);
+L1adc:
+    AOT_BLOCK(0x1adc, 1);
+    // 1adc: jb 1ae7
+    if (CF)
+        AOT_GOTO(0x1ae7, L1ae7);
+    AOT_GOTO(0x1ade, L1ade);
+L1ade:
+    AOT_BLOCK(0x1ade, 2);
+    // 1ade: cmp [si+6], dx
+    {
+        a = uint16_t(r[6] + 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1ae1: jbe 1ae7
+    if (CF || ZF)
+        AOT_GOTO(0x1ae7, L1ae7);
+    AOT_GOTO(0x1ae3, L1ae3);
+L1ae3:
+    AOT_BLOCK(0x1ae3, 1);
+    // 1ae3: loop 1ad2
+    {
+        r[1]--;
+    }
+    if (r[1] > 0)
+        AOT_GOTO(0x1ad2, L1ad2);
+    AOT_GOTO(0x1ae5, L1ae5);
+L1ae5:
+    AOT_BLOCK(0x1ae5, 1);
+    // 1ae5: jmp short 1abe
+    AOT_GOTO(0x1abe, L1abe);
+L1ae7:
+    AOT_BLOCK(0x1ae7, 4);
+    // 1ae7: sub dx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1aea: sbb bx, di
+    {
+        val = (dst = int16_t(r[3])) - (src = int16_t(r[7])) - CF;
+        r[3] = val;
+        CF = uint16_t(dst) < uint16_t(src + CF) || (CF && !(src + 1));
+    }
+    // 1aec: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1aed: loop 1ad2
+    {
+        r[1]--;
+    }
+    if (r[1] > 0)
+        AOT_GOTO(0x1ad2, L1ad2);
+    AOT_GOTO(0x1aef, L1aef);
+L1aef:
+    AOT_BLOCK(0x1aef, 1);
+    // 1aef: jmp short 1abe
+    AOT_GOTO(0x1abe, L1abe);
+L1af1:
+    AOT_BLOCK(0x1af1, 1);
+    // 1af1: call 1bac
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1af4);
+    }
+    AOT_GOTO(0x1bac, L1bac);
+L1af4:
+    AOT_BLOCK(0x1af4, 1);
+    // 1af4: call 1b53
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1af7);
+    }
+    AOT_GOTO(0x1b53, L1b53);
+L1af7:
+    AOT_BLOCK(0x1af7, 1);
+    // 1af7: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    AOT_GOTO(0x1af8, L1af8);
+L1af8:
+    AOT_BLOCK(0x1af8, 1);
+    // 1af8: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    AOT_GOTO(0x1af9, L1af9);
+L1af9:
+    AOT_BLOCK(0x1af9, 3);
+    // 1af9: mov sp, bp
+    {
+        r[4] = r[5];
+    }
+    // 1afb: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1afc: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1afc);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1b01:
+    AOT_BLOCK(0x1b01, 7);
+    // 1b01: push si
+    {
+        r[4] -= 2;
+        WR16(r[4], r[6]);
+    }
+    // 1b02: push di
+    {
+        r[4] -= 2;
+        WR16(r[4], r[7]);
+    }
+    // 1b03: mov si, sp
+    {
+        r[6] = r[4];
+    }
+    // 1b05: mov bx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        r[3] = RD16(a);
+    }
+    // 1b08: mov ax, [si+8]
+    {
+        a = uint16_t(r[6] + 8);
+        r[0] = RD16(a);
+    }
+    // 1b0b: or ax, ax
+    {
+        val = int16_t(r[0]) | int16_t(r[0]);
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1b0d: jne 1b27
+    if (!ZF)
+        AOT_GOTO(0x1b27, L1b27);
+    AOT_GOTO(0x1b0f, L1b0f);
+L1b0f:
+    AOT_BLOCK(0x1b0f, 7);
+    // 1b0f: xor dx, dx
+    {
+        val = int16_t(r[2]) ^ int16_t(r[2]);
+        r[2] = val;
+    }
+    // 1b11: mov cx, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[1] = RD16(a);
+    }
+    // 1b14: mov ax, [si+c]
+    {
+        a = uint16_t(r[6] + 12);
+        r[0] = RD16(a);
+    }
+    // 1b17: div bx
+    {
+        u32 = uint32_t(r[2]) << 16 | r[0];
+        src = r[3];
+        r[0] = u32 / src;
+        r[2] = u32 % src;
+    }
+    // 1b19: xchg cx, ax
+    {
+        val = r[0];
+        r[0] = r[1];
+        r[1] = val;
+    }
+    // 1b1a: div bx
+    {
+        u32 = uint32_t(r[2]) << 16 | r[0];
+        src = r[3];
+        r[0] = u32 / src;
+        r[2] = u32 % src;
+    }
+    // 1b1c: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    AOT_GOTO(0x1b1e, L1b1e);
+L1b1e:
+    AOT_BLOCK(0x1b1e, 5);
+    // 1b1e: mov ax, dx
+    {
+        r[0] = r[2];
+    }
+    // 1b20: mov dx, bx
+    {
+        r[2] = r[3];
+    }
+    // 1b22: pop di
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[7] = val;
+    }
+    // 1b23: pop si
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[6] = val;
+    }
+    // 1b24: ret 0008
+    {
+        b = RD16(r[4]);
+        r[4] += 2;
+        r[4] += 8;
+    }
+    AOT_JUMP(b);
+L1b27:
+    AOT_BLOCK(0x1b27, 5);
+    // 1b27: mov di, ax
+    {
+        r[7] = r[0];
+    }
+    // 1b29: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1b2b: mov ax, [si+a]
+    {
+        a = uint16_t(r[6] + 10);
+        r[0] = RD16(a);
+    }
+    // 1b2e: mov dx, [si+c]
+    {
+        a = uint16_t(r[6] + 12);
+        r[2] = RD16(a);
+    }
+    // 1b31: mov cx, 0010
+    {
+        r[1] = 0x0010;
+    }
+    AOT_GOTO(0x1b34, L1b34);
+L1b34:
+    AOT_BLOCK(0x1b34, 5);
+    // 1b34: shl ax, 1
+    {
+        val = r[0] << 1;
+        r[0] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 1b36: rcl dx, 1
+    {
+        val = r[2];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[2] = val;
+    }
+    // 1b38: rcl bx, 1
+    {
+        val = r[3];
+        for (int i = 0; i < 1; ++i) {
+            val = (val << 1) | CF;
+            CF = val & 0x10000;
+        }
+        OF = CF ^ bool(val & 0x8000);
+        r[3] = val;
+    }
+    // 1b3a: cmp di, bx
+    {
+        val = (dst = int16_t(r[7])) - (src = int16_t(r[3]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1b3c: jnbe 1b45
+    if (!(CF || ZF))
+        AOT_GOTO(0x1b45, L1b45);
+    AOT_GOTO(0x1b3e, L1b3e);
+L1b3e:
+    AOT_BLOCK(0x1b3e, 1);
+    // 1b3e: jb 1b49
+    if (CF)
+        AOT_GOTO(0x1b49, L1b49);
+    AOT_GOTO(0x1b40, L1b40);
+L1b40:
+    AOT_BLOCK(0x1b40, 2);
+    // 1b40: cmp [si+6], dx
+    {
+        a = uint16_t(r[6] + 6);
+        val = (dst = int16_t(RD16(a))) - (src = int16_t(r[2]));
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1b43: jbe 1b49
+    if (CF || ZF)
+        AOT_GOTO(0x1b49, L1b49);
+    AOT_GOTO(0x1b45, L1b45);
+L1b45:
+    AOT_BLOCK(0x1b45, 1);
+    // 1b45: loop 1b34
+    {
+        r[1]--;
+    }
+    if (r[1] > 0)
+        AOT_GOTO(0x1b34, L1b34);
+    AOT_GOTO(0x1b47, L1b47);
+L1b47:
+    AOT_BLOCK(0x1b47, 1);
+    // 1b47: jmp short 1b1e
+    AOT_GOTO(0x1b1e, L1b1e);
+L1b49:
+    AOT_BLOCK(0x1b49, 4);
+    // 1b49: sub dx, [si+6]
+    {
+        a = uint16_t(r[6] + 6);
+        val = (dst = int16_t(r[2])) - (src = int16_t(RD16(a)));
+        r[2] = val;
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1b4c: sbb bx, di
+    {
+        val = (dst = int16_t(r[3])) - (src = int16_t(r[7])) - CF;
+        r[3] = val;
+        CF = uint16_t(dst) < uint16_t(src + CF) || (CF && !(src + 1));
+    }
+    // 1b4e: inc ax
+    {
+        val = int16_t(r[0]) + 1;
+        r[0] = val;
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = !(val & 15);
+        PF = ptable[uint8_t(val)];
+    }
+    // 1b4f: loop 1b34
+    {
+        r[1]--;
+    }
+    if (r[1] > 0)
+        AOT_GOTO(0x1b34, L1b34);
+    AOT_GOTO(0x1b51, L1b51);
+L1b51:
+    AOT_BLOCK(0x1b51, 1);
+    // 1b51: jmp short 1b1e
+    AOT_GOTO(0x1b1e, L1b1e);
+L1b53:
+    AOT_BLOCK(0x1b53, 1);
+    // 1b53: call 08ee
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1b56);
+    }
+    AOT_GOTO(0x08ee, L08ee);
+L1b56:
+    AOT_BLOCK(0x1b56, 3);
+    // 1b56: mov ax, 0006
+    {
+        r[0] = 0x0006;
+    }
+    // 1b59: mov dx, 03d0
+    {
+        r[2] = 0x03d0;
+    }
+    // 1b5c: jmp short 1b8e
+    AOT_GOTO(0x1b8e, L1b8e);
+L1b8e:
+    AOT_BLOCK(0x1b8e, 4);
+    // 1b8e: xor bx, bx
+    {
+        val = int16_t(r[3]) ^ int16_t(r[3]);
+        r[3] = val;
+    }
+    // 1b90: xchg [048e], bx
+    {
+        a = 0x048e;
+        val = int16_t(r[3]);
+        r[3] = int16_t(RD16(a));
+        WR16(a, val);
+    }
+    // 1b94: test bx, bx
+    {
+        val = int16_t(r[3]) & int16_t(r[3]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1b96: je 1b9d
+    if (ZF)
+        AOT_GOTO(0x1b9d, L1b9d);
+    AOT_GOTO(0x1b98, L1b98);
+L1b98:
+    AOT_BLOCK(0x1b98, 2);
+    // 1b98: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1b99: call bx
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1b9b);
+        b = r[3];
+    }
+    AOT_JUMP(b);
+L1b9b:
+    AOT_BLOCK(0x1b9b, 2);
+    // 1b9b: pop ax
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[0] = val;
+    }
+    // 1b9c: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1b9c);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+L1b9d:
+    AOT_BLOCK(0x1b9d, 6);
+    // 1b9d: mov bx, 0016
+    {
+        r[3] = 0x0016;
+    }
+    // 1ba0: push bx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[3]);
+    }
+    // 1ba1: push dx
+    {
+        r[4] -= 2;
+        WR16(r[4], r[2]);
+    }
+    // 1ba2: mov ax, 0002
+    {
+        r[0] = 0x0002;
+    }
+    // 1ba5: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1ba6: call 1be4
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1ba9);
+    }
+    AOT_GOTO(0x1be4, L1be4);
+L1ba9:
+    AOT_BLOCK(0x1ba9, 1);
+    // 1ba9: call 08ee
+    {
+        r[4] -= 2;
+        WR16(r[4], 0x1bac);
+    }
+    AOT_GOTO(0x08ee, L08ee);
+L1bac:
+    AOT_BLOCK(0x1bac, 3);
+    // 1bac: mov dx, ax
+    {
+        r[2] = r[0];
+    }
+    // 1bae: cmp dx, 15
+    {
+        val = (dst = int16_t(r[2])) - (src = 21);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        AF = (dst & 15) - (src & 15) < 0;
+        PF = ptable[uint8_t(val)];
+        CF = uint16_t(dst) < uint16_t(src);
+    }
+    // 1bb1: jnb 1bc4
+    if (!CF)
+        AOT_GOTO(0x1bc4, L1bc4);
+    AOT_GOTO(0x1bb3, L1bb3);
+L1bb3:
+    AOT_BLOCK(0x1bb3, 6);
+    // 1bb3: shl dx, 1
+    {
+        val = r[2] << 1;
+        r[2] = val;
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = val & 0x10000;
+        OF = CF != bool(val & 0x8000);
+    }
+    // 1bb5: mov bx, 03a6
+    {
+        r[3] = 0x03a6;
+    }
+    // 1bb8: add bx, dx
+    {
+        val = (dst = int16_t(r[3])) + (src = int16_t(r[2]));
+        r[3] = val;
+        AF = (dst & 15) + (src & 15) > 15;
+    }
+    // 1bba: mov bx, [bx]
+    {
+        a = uint16_t(r[3]);
+        r[3] = RD16(a);
+    }
+    // 1bbc: test bx, bx
+    {
+        val = int16_t(r[3]) & int16_t(r[3]);
+        OF = val != int16_t(val);
+        SF = int16_t(val) < 0;
+        ZF = int16_t(val) == 0;
+        PF = ptable[uint8_t(val)];
+        CF = false;
+    }
+    // 1bbe: je 1bc4
+    if (ZF)
+        AOT_GOTO(0x1bc4, L1bc4);
+    AOT_GOTO(0x1bc0, L1bc0);
+L1bc0:
+    AOT_BLOCK(0x1bc0, 2);
+    // 1bc0: mov dx, bx
+    {
+        r[2] = r[3];
+    }
+    // 1bc2: jmp short 1be2
+    AOT_GOTO(0x1be2, L1be2);
+L1bc4:
+    AOT_BLOCK(0x1bc4, 3);
+    // 1bc4: mov bx, 047f
+    {
+        r[3] = 0x047f;
+    }
+    // 1bc7: mov cx, 0006
+    {
+        r[1] = 0x0006;
+    }
+    // 1bca: mov dx, ax
+    {
+        r[2] = r[0];
+    }
+    AOT_GOTO(0x1bcc, L1bcc);
+L1bcc:
+    AOT_BLOCK(0x1bcc, 8);
+    // 1bcc: and dx, 0007
+    {
+        val = int16_t(r[2]) & 7;
+        r[2] = val;
+    }
+    // 1bd0: add dx, [0030]
+    {
+        a = 0x0030;
+        val = (dst = int16_t(r[2])) + (src = int16_t(RD16(a)));
+        r[2] = val;
+    }
+    // 1bd4: mov [bx], dl
+    {
+        a = uint16_t(r[3]);
+        WR8(a, uint8_t(r[2]));
+    }
+    // 1bd6: dec bx
+    {
+        val = int16_t(r[3]) - 1;
+        r[3] = val;
+        AF = (val & 15) == 15;
+    }
+    // 1bd7: sar dx, 1
+    {
+        val = int16_t(r[2]) >> (1 - 1);
+        r[2] = val >> 1;
+        SF = int16_t((val >> 1)) < 0;
+        ZF = int16_t((val >> 1)) == 0;
+        PF = ptable[uint8_t((val >> 1))];
+        CF = val & 1;
+        OF = false;
+    }
+    // 1bd9: sar dx, 1
+    {
+        val = int16_t(r[2]) >> (1 - 1);
+        r[2] = val >> 1;
+        SF = int16_t((val >> 1)) < 0;
+        ZF = int16_t((val >> 1)) == 0;
+        PF = ptable[uint8_t((val >> 1))];
+        CF = val & 1;
+        OF = false;
+    }
+    // 1bdb: sar dx, 1
+    {
+        val = int16_t(r[2]) >> (1 - 1);
+        r[2] = val >> 1;
+        SF = int16_t((val >> 1)) < 0;
+        ZF = int16_t((val >> 1)) == 0;
+        PF = ptable[uint8_t((val >> 1))];
+        CF = val & 1;
+        OF = false;
+    }
+    // 1bdd: loop 1bcc
+    {
+        r[1]--;
+    }
+    if (r[1] > 0)
+        AOT_GOTO(0x1bcc, L1bcc);
+    AOT_GOTO(0x1bdf, L1bdf);
+L1bdf:
+    AOT_BLOCK(0x1bdf, 1);
+    // 1bdf: mov dx, 0471
+    {
+        r[2] = 0x0471;
+    }
+    AOT_GOTO(0x1be2, L1be2);
+L1be2:
+    AOT_BLOCK(0x1be2, 1);
+    // 1be2: jmp short 1b8e
+    AOT_GOTO(0x1b8e, L1b8e);
+L1be4:
+    AOT_BLOCK(0x1be4, 16);
+    // 1be4: push bp
+    {
+        r[4] -= 2;
+        WR16(r[4], r[5]);
+    }
+    // 1be5: mov bp, sp
+    {
+        r[5] = r[4];
+    }
+    // 1be7: mov [0498], 0004
+    {
+        a = 0x0498;
+        WR16(a, 0x0004);
+    }
+    // 1bed: mov bx, [bp+4]
+    {
+        a = uint16_t(r[5] + 4);
+        r[3] = RD16(a);
+    }
+    // 1bf0: mov [049a], bx
+    {
+        a = 0x049a;
+        WR16(a, r[3]);
+    }
+    // 1bf4: mov bx, [bp+8]
+    {
+        a = uint16_t(r[5] + 8);
+        r[3] = RD16(a);
+    }
+    // 1bf7: mov [049c], bx
+    {
+        a = 0x049c;
+        WR16(a, r[3]);
+    }
+    // 1bfb: mov bx, [bp+6]
+    {
+        a = uint16_t(r[5] + 6);
+        r[3] = RD16(a);
+    }
+    // 1bfe: mov [04a0], bx
+    {
+        a = 0x04a0;
+        WR16(a, r[3]);
+    }
+    // 1c02: mov ax, 0496
+    {
+        r[0] = 0x0496;
+    }
+    // 1c05: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1c06: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1c09: push ax
+    {
+        r[4] -= 2;
+        WR16(r[4], r[0]);
+    }
+    // 1c0a: mov ax, 0001
+    {
+        r[0] = 0x0001;
+    }
+    // 1c0d: mov bx, 0496
+    {
+        r[3] = 0x0496;
+    }
+    // 1c10: mov cx, 0003
+    {
+        r[1] = 0x0003;
+    }
+    // 1c13: int 20
+    AOT_INTERP(0x1c13);
+L1c15:
+    AOT_BLOCK(0x1c15, 3);
+    // 1c15: mov sp, bp
+    {
+        r[4] = r[5];
+    }
+    // 1c17: pop bp
+    {
+        val = RD16(r[4]);
+        r[4] += 2;
+        r[5] = val;
+    }
+    // 1c18: ret
+    {
+        if (r[4] == vm.start_sp) AOT_EXIT(0x1c18);
+        b = RD16(r[4]);
+        r[4] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("m2/lib/irrel", 0x0000, 7200, 0x4da41941u, run);
+}
@@ -0,0 +1,6229 @@
+// v6/bin/as translated by 7aot: 430 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x0004: goto L0004;
+        case 0x0008: goto L0008;
+        case 0x000c: goto L000c;
+        case 0x000e: goto L000e;
+        case 0x0010: goto L0010;
+        case 0x0012: goto L0012;
+        case 0x0014: goto L0014;
+        case 0x0016: goto L0016;
+        case 0x0018: goto L0018;
+        case 0x001a: goto L001a;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0020: goto L0020;
+        case 0x0022: goto L0022;
+        case 0x0024: goto L0024;
+        case 0x0026: goto L0026;
+        case 0x0028: goto L0028;
+        case 0x0032: goto L0032;
+        case 0x003a: goto L003a;
+        case 0x003c: goto L003c;
+        case 0x003e: goto L003e;
+        case 0x0040: goto L0040;
+        case 0x0042: goto L0042;
+        case 0x0044: goto L0044;
+        case 0x0046: goto L0046;
+        case 0x0048: goto L0048;
+        case 0x004a: goto L004a;
+        case 0x004e: goto L004e;
+        case 0x0050: goto L0050;
+        case 0x0052: goto L0052;
+        case 0x0054: goto L0054;
+        case 0x0056: goto L0056;
+        case 0x0058: goto L0058;
+        case 0x005a: goto L005a;
+        case 0x005c: goto L005c;
+        case 0x005e: goto L005e;
+        case 0x0060: goto L0060;
+        case 0x0062: goto L0062;
+        case 0x0064: goto L0064;
+        case 0x0066: goto L0066;
+        case 0x0068: goto L0068;
+        case 0x006a: goto L006a;
+        case 0x006c: goto L006c;
+        case 0x006e: goto L006e;
+        case 0x0072: goto L0072;
+        case 0x0074: goto L0074;
+        case 0x0076: goto L0076;
+        case 0x0078: goto L0078;
+        case 0x007a: goto L007a;
+        case 0x007c: goto L007c;
+        case 0x0080: goto L0080;
+        case 0x0086: goto L0086;
+        case 0x0088: goto L0088;
+        case 0x008a: goto L008a;
+        case 0x008c: goto L008c;
+        case 0x008e: goto L008e;
+        case 0x0090: goto L0090;
+        case 0x0092: goto L0092;
+        case 0x0094: goto L0094;
+        case 0x0096: goto L0096;
+        case 0x0098: goto L0098;
+        case 0x009a: goto L009a;
+        case 0x00a2: goto L00a2;
+        case 0x00a4: goto L00a4;
+        case 0x00a6: goto L00a6;
+        case 0x00a8: goto L00a8;
+        case 0x00aa: goto L00aa;
+        case 0x00ac: goto L00ac;
+        case 0x00ae: goto L00ae;
+        case 0x00b0: goto L00b0;
+        case 0x00b2: goto L00b2;
+        case 0x00b4: goto L00b4;
+        case 0x00b6: goto L00b6;
+        case 0x00c0: goto L00c0;
+        case 0x00c2: goto L00c2;
+        case 0x00c8: goto L00c8;
+        case 0x00cc: goto L00cc;
+        case 0x00dc: goto L00dc;
+        case 0x00ea: goto L00ea;
+        case 0x00ec: goto L00ec;
+        case 0x00ee: goto L00ee;
+        case 0x0102: goto L0102;
+        case 0x0112: goto L0112;
+        case 0x0118: goto L0118;
+        case 0x011a: goto L011a;
+        case 0x011c: goto L011c;
+        case 0x011e: goto L011e;
+        case 0x0120: goto L0120;
+        case 0x0124: goto L0124;
+        case 0x0126: goto L0126;
+        case 0x012a: goto L012a;
+        case 0x012e: goto L012e;
+        case 0x0130: goto L0130;
+        case 0x0132: goto L0132;
+        case 0x0138: goto L0138;
+        case 0x013e: goto L013e;
+        case 0x0150: goto L0150;
+        case 0x015c: goto L015c;
+        case 0x015e: goto L015e;
+        case 0x0160: goto L0160;
+        case 0x0162: goto L0162;
+        case 0x0164: goto L0164;
+        case 0x0166: goto L0166;
+        case 0x016a: goto L016a;
+        case 0x01b4: goto L01b4;
+        case 0x01ba: goto L01ba;
+        case 0x01be: goto L01be;
+        case 0x01da: goto L01da;
+        case 0x01e2: goto L01e2;
+        case 0x0200: goto L0200;
+        case 0x0206: goto L0206;
+        case 0x0208: goto L0208;
+        case 0x020a: goto L020a;
+        case 0x020c: goto L020c;
+        case 0x020e: goto L020e;
+        case 0x0210: goto L0210;
+        case 0x0214: goto L0214;
+        case 0x021c: goto L021c;
+        case 0x0220: goto L0220;
+        case 0x0224: goto L0224;
+        case 0x022a: goto L022a;
+        case 0x0234: goto L0234;
+        case 0x023e: goto L023e;
+        case 0x0240: goto L0240;
+        case 0x0248: goto L0248;
+        case 0x024c: goto L024c;
+        case 0x024e: goto L024e;
+        case 0x0254: goto L0254;
+        case 0x025a: goto L025a;
+        case 0x025e: goto L025e;
+        case 0x0260: goto L0260;
+        case 0x0266: goto L0266;
+        case 0x026c: goto L026c;
+        case 0x0272: goto L0272;
+        case 0x0276: goto L0276;
+        case 0x0278: goto L0278;
+        case 0x027a: goto L027a;
+        case 0x027e: goto L027e;
+        case 0x028c: goto L028c;
+        case 0x0290: goto L0290;
+        case 0x0296: goto L0296;
+        case 0x0298: goto L0298;
+        case 0x029c: goto L029c;
+        case 0x02a2: goto L02a2;
+        case 0x02a8: goto L02a8;
+        case 0x02ae: goto L02ae;
+        case 0x02b4: goto L02b4;
+        case 0x02b8: goto L02b8;
+        case 0x02ba: goto L02ba;
+        case 0x02da: goto L02da;
+        case 0x02e2: goto L02e2;
+        case 0x02e6: goto L02e6;
+        case 0x02ec: goto L02ec;
+        case 0x02f4: goto L02f4;
+        case 0x02f8: goto L02f8;
+        case 0x0300: goto L0300;
+        case 0x0304: goto L0304;
+        case 0x030a: goto L030a;
+        case 0x0316: goto L0316;
+        case 0x031e: goto L031e;
+        case 0x0322: goto L0322;
+        case 0x032a: goto L032a;
+        case 0x032e: goto L032e;
+        case 0x0332: goto L0332;
+        case 0x0336: goto L0336;
+        case 0x033a: goto L033a;
+        case 0x033c: goto L033c;
+        case 0x0342: goto L0342;
+        case 0x0352: goto L0352;
+        case 0x035a: goto L035a;
+        case 0x035c: goto L035c;
+        case 0x035e: goto L035e;
+        case 0x0360: goto L0360;
+        case 0x0362: goto L0362;
+        case 0x0372: goto L0372;
+        case 0x0380: goto L0380;
+        case 0x0392: goto L0392;
+        case 0x03a2: goto L03a2;
+        case 0x03a6: goto L03a6;
+        case 0x03b2: goto L03b2;
+        case 0x03c0: goto L03c0;
+        case 0x03c4: goto L03c4;
+        case 0x03c6: goto L03c6;
+        case 0x03c8: goto L03c8;
+        case 0x03dc: goto L03dc;
+        case 0x03e2: goto L03e2;
+        case 0x03e8: goto L03e8;
+        case 0x03ee: goto L03ee;
+        case 0x03f2: goto L03f2;
+        case 0x0400: goto L0400;
+        case 0x0408: goto L0408;
+        case 0x0412: goto L0412;
+        case 0x0416: goto L0416;
+        case 0x0424: goto L0424;
+        case 0x042a: goto L042a;
+        case 0x0430: goto L0430;
+        case 0x0436: goto L0436;
+        case 0x0444: goto L0444;
+        case 0x0446: goto L0446;
+        case 0x044c: goto L044c;
+        case 0x044e: goto L044e;
+        case 0x0450: goto L0450;
+        case 0x0452: goto L0452;
+        case 0x0454: goto L0454;
+        case 0x0456: goto L0456;
+        case 0x0458: goto L0458;
+        case 0x0464: goto L0464;
+        case 0x046e: goto L046e;
+        case 0x0470: goto L0470;
+        case 0x0472: goto L0472;
+        case 0x0474: goto L0474;
+        case 0x0476: goto L0476;
+        case 0x0478: goto L0478;
+        case 0x047a: goto L047a;
+        case 0x0480: goto L0480;
+        case 0x0484: goto L0484;
+        case 0x048a: goto L048a;
+        case 0x049e: goto L049e;
+        case 0x04a0: goto L04a0;
+        case 0x04a2: goto L04a2;
+        case 0x04a4: goto L04a4;
+        case 0x04a6: goto L04a6;
+        case 0x04aa: goto L04aa;
+        case 0x04b0: goto L04b0;
+        case 0x04c6: goto L04c6;
+        case 0x04ca: goto L04ca;
+        case 0x04ce: goto L04ce;
+        case 0x04d2: goto L04d2;
+        case 0x04d4: goto L04d4;
+        case 0x04dc: goto L04dc;
+        case 0x04e2: goto L04e2;
+        case 0x04e8: goto L04e8;
+        case 0x04ee: goto L04ee;
+        case 0x04f2: goto L04f2;
+        case 0x04f6: goto L04f6;
+        case 0x04f8: goto L04f8;
+        case 0x04fc: goto L04fc;
+        case 0x0504: goto L0504;
+        case 0x0546: goto L0546;
+        case 0x0550: goto L0550;
+        case 0x0556: goto L0556;
+        case 0x055a: goto L055a;
+        case 0x055e: goto L055e;
+        case 0x0576: goto L0576;
+        case 0x0582: goto L0582;
+        case 0x058a: goto L058a;
+        case 0x05ae: goto L05ae;
+        case 0x05b6: goto L05b6;
+        case 0x05ba: goto L05ba;
+        case 0x05be: goto L05be;
+        case 0x05c2: goto L05c2;
+        case 0x05cc: goto L05cc;
+        case 0x05d2: goto L05d2;
+        case 0x05da: goto L05da;
+        case 0x05e2: goto L05e2;
+        case 0x05e6: goto L05e6;
+        case 0x05ec: goto L05ec;
+        case 0x05f2: goto L05f2;
+        case 0x05fa: goto L05fa;
+        case 0x05fe: goto L05fe;
+        case 0x0602: goto L0602;
+        case 0x0606: goto L0606;
+        case 0x060a: goto L060a;
+        case 0x060c: goto L060c;
+        case 0x0612: goto L0612;
+        case 0x0618: goto L0618;
+        case 0x061a: goto L061a;
+        case 0x061c: goto L061c;
+        case 0x0620: goto L0620;
+        case 0x0622: goto L0622;
+        case 0x0700: goto L0700;
+        case 0x0704: goto L0704;
+        case 0x0708: goto L0708;
+        case 0x070c: goto L070c;
+        case 0x0800: goto L0800;
+        case 0x0886: goto L0886;
+        case 0x088a: goto L088a;
+        case 0x08c2: goto L08c2;
+        case 0x08d4: goto L08d4;
+        case 0x08d8: goto L08d8;
+        case 0x08de: goto L08de;
+        case 0x08e0: goto L08e0;
+        case 0x09d0: goto L09d0;
+        case 0x09d4: goto L09d4;
+        case 0x09d8: goto L09d8;
+        case 0x09da: goto L09da;
+        case 0x09dc: goto L09dc;
+        case 0x09e0: goto L09e0;
+        case 0x0a00: goto L0a00;
+        case 0x0a02: goto L0a02;
+        case 0x0a06: goto L0a06;
+        case 0x0a08: goto L0a08;
+        case 0x0a68: goto L0a68;
+        case 0x0a70: goto L0a70;
+        case 0x0a80: goto L0a80;
+        case 0x0a84: goto L0a84;
+        case 0x0a8a: goto L0a8a;
+        case 0x0a8e: goto L0a8e;
+        case 0x0a92: goto L0a92;
+        case 0x0a96: goto L0a96;
+        case 0x0a9c: goto L0a9c;
+        case 0x0aa0: goto L0aa0;
+        case 0x0ac0: goto L0ac0;
+        case 0x0ac2: goto L0ac2;
+        case 0x0ac4: goto L0ac4;
+        case 0x0ac6: goto L0ac6;
+        case 0x0ac8: goto L0ac8;
+        case 0x0aca: goto L0aca;
+        case 0x0acc: goto L0acc;
+        case 0x0ace: goto L0ace;
+        case 0x0ad0: goto L0ad0;
+        case 0x0ad2: goto L0ad2;
+        case 0x0ad4: goto L0ad4;
+        case 0x0ae2: goto L0ae2;
+        case 0x0ae4: goto L0ae4;
+        case 0x0b00: goto L0b00;
+        case 0x0b02: goto L0b02;
+        case 0x0b22: goto L0b22;
+        case 0x0b24: goto L0b24;
+        case 0x0b26: goto L0b26;
+        case 0x0b28: goto L0b28;
+        case 0x0b2a: goto L0b2a;
+        case 0x0b2c: goto L0b2c;
+        case 0x0b2e: goto L0b2e;
+        case 0x0b36: goto L0b36;
+        case 0x0b38: goto L0b38;
+        case 0x0b3a: goto L0b3a;
+        case 0x0b3c: goto L0b3c;
+        case 0x0b3e: goto L0b3e;
+        case 0x0b40: goto L0b40;
+        case 0x0b42: goto L0b42;
+        case 0x0b44: goto L0b44;
+        case 0x0b46: goto L0b46;
+        case 0x0b48: goto L0b48;
+        case 0x0b4a: goto L0b4a;
+        case 0x0b4c: goto L0b4c;
+        case 0x0b4e: goto L0b4e;
+        case 0x0b50: goto L0b50;
+        case 0x0b52: goto L0b52;
+        case 0x0b56: goto L0b56;
+        case 0x0b58: goto L0b58;
+        case 0x0b5a: goto L0b5a;
+        case 0x0b5c: goto L0b5c;
+        case 0x0b5e: goto L0b5e;
+        case 0x0b60: goto L0b60;
+        case 0x0b62: goto L0b62;
+        case 0x0b64: goto L0b64;
+        case 0x0b96: goto L0b96;
+        case 0x0b9c: goto L0b9c;
+        case 0x0b9e: goto L0b9e;
+        case 0x0ba0: goto L0ba0;
+        case 0x0ba2: goto L0ba2;
+        case 0x0ba4: goto L0ba4;
+        case 0x0ba6: goto L0ba6;
+        case 0x0bac: goto L0bac;
+        case 0x0bae: goto L0bae;
+        case 0x0bb0: goto L0bb0;
+        case 0x0bb2: goto L0bb2;
+        case 0x0bb8: goto L0bb8;
+        case 0x0bba: goto L0bba;
+        case 0x0bbc: goto L0bbc;
+        case 0x0bbe: goto L0bbe;
+        case 0x0bc4: goto L0bc4;
+        case 0x0bc6: goto L0bc6;
+        case 0x0bc8: goto L0bc8;
+        case 0x0bca: goto L0bca;
+        case 0x0bd0: goto L0bd0;
+        case 0x0bd2: goto L0bd2;
+        case 0x0bd4: goto L0bd4;
+        case 0x0bd6: goto L0bd6;
+        case 0x0bdc: goto L0bdc;
+        case 0x0bde: goto L0bde;
+        case 0x0be0: goto L0be0;
+        case 0x0be2: goto L0be2;
+        case 0x0be8: goto L0be8;
+        case 0x0bea: goto L0bea;
+        case 0x0bec: goto L0bec;
+        case 0x0bee: goto L0bee;
+        case 0x0bf4: goto L0bf4;
+        case 0x0bf6: goto L0bf6;
+        case 0x0bf8: goto L0bf8;
+        case 0x0bfa: goto L0bfa;
+        case 0x0c00: goto L0c00;
+        case 0x0c02: goto L0c02;
+        case 0x0c04: goto L0c04;
+        case 0x0c06: goto L0c06;
+        case 0x0c0c: goto L0c0c;
+        case 0x0c0e: goto L0c0e;
+        case 0x0c10: goto L0c10;
+        case 0x0c12: goto L0c12;
+        case 0x0c18: goto L0c18;
+        case 0x0c1a: goto L0c1a;
+        case 0x0c1c: goto L0c1c;
+        case 0x0c1e: goto L0c1e;
+        case 0x0c24: goto L0c24;
+        case 0x0c26: goto L0c26;
+        case 0x0c28: goto L0c28;
+        case 0x0c2a: goto L0c2a;
+        case 0x0c30: goto L0c30;
+        case 0x0c32: goto L0c32;
+        case 0x0c34: goto L0c34;
+        case 0x0c36: goto L0c36;
+        case 0x13fe: goto L13fe;
+        case 0x1400: goto L1400;
+        case 0x1402: goto L1402;
+        case 0x1404: goto L1404;
+        case 0x1406: goto L1406;
+        case 0x1408: goto L1408;
+        case 0x140a: goto L140a;
+        case 0x140c: goto L140c;
+        case 0x140e: goto L140e;
+        case 0x1410: goto L1410;
+        case 0x1412: goto L1412;
+        case 0x141a: goto L141a;
+        case 0x1420: goto L1420;
+        case 0x1424: goto L1424;
+        case 0x1430: goto L1430;
+        case 0x143a: goto L143a;
+        case 0x1444: goto L1444;
+        case 0x1448: goto L1448;
+        case 0x144c: goto L144c;
+        case 0x1454: goto L1454;
+        case 0x1458: goto L1458;
+        case 0x145e: goto L145e;
+        case 0x146c: goto L146c;
+        case 0x1474: goto L1474;
+        case 0x1478: goto L1478;
+        case 0x147c: goto L147c;
+        case 0x148a: goto L148a;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: jmp 13fe
+    {
+        a = 0x13fe;
+    }
+    AOT_GOTO(0x13fe, L13fe);
+L0004:
+    AOT_BLOCK(0x0004, 1);
+    // 0004: jsr pc, 0162
+    {
+        a = 0x0162;
+        r[6] -= 2;
+        WR16(r[6], 0x0008);
+    }
+    AOT_GOTO(0x0162, L0162);
+L0008:
+    AOT_BLOCK(0x0008, 1);
+    // 0008: movb 227c, r0
+    {
+        a = 0x227c;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x000c, L000c);
+L000c:
+    // 000c: sys 4
+    AOT_INTERP(0x000c);
+L000e:
+    AOT_BLOCK(0x000e, 1);
+    // 000e: cmp (r2), (sp)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0010, L0010);
+L0010:
+    AOT_BLOCK(0x0010, 1);
+    // 0010: bne 0012
+    if (!Z)
+        AOT_GOTO(0x0012, L0012);
+    AOT_GOTO(0x0012, L0012);
+L0012:
+    AOT_BLOCK(0x0012, 1);
+    // 0012: movb 227c, r0
+    {
+        a = 0x227c;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0016, L0016);
+L0014:
+    AOT_BLOCK(0x0014, 1);
+    // 0014: cmp (r1), -(sp)
+    {
+        a = r[1];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0016, L0016);
+L0016:
+    // 0016: sys 6
+    AOT_INTERP(0x0016);
+L0018:
+    AOT_BLOCK(0x0018, 1);
+    // 0018: movb 227f, r0
+    {
+        a = 0x227f;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x001c, L001c);
+L001a:
+    AOT_BLOCK(0x001a, 1);
+    // 001a: cmp (r1), -(r3)
+    {
+        a = r[1];
+        src = RD16(a);
+        r[3] -= 2;
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x001c, L001c);
+L001c:
+    // 001c: sys 6
+    AOT_INTERP(0x001c);
+L001e:
+    AOT_BLOCK(0x001e, 1);
+    // 001e: tstb 2281
+    {
+        a = 0x2281;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0022, L0022);
+L0020:
+    AOT_BLOCK(0x0020, 1);
+    // 0020: cmp (r1), *$0216
+    {
+        a = r[1];
+        src = RD16(a);
+        b = 0x0216;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0024, L0024);
+L0022:
+    AOT_BLOCK(0x0022, 1);
+    // 0022: bne 0050
+    if (!Z)
+        AOT_GOTO(0x0050, L0050);
+    AOT_GOTO(0x0024, L0024);
+L0024:
+    AOT_BLOCK(0x0024, 1);
+    // 0024: jsr r5, 009a
+    {
+        a = 0x009a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0028;
+    }
+    AOT_GOTO(0x009a, L009a);
+L0026:
+    AOT_BLOCK(0x0026, 1);
+    // 0026: jmp b77(r2)
+    {
+        a = uint16_t(r[2] + 2935);
+    }
+    AOT_JUMP(a);
+L0028:
+    AOT_BLOCK(0x0028, 2);
+    // 0028: adc 102d
+    {
+        a = 0x102d;
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        C = C && val == 0;
+    }
+    // 002c: mov 0b98, 0b28
+    {
+        a = 0x0b98;
+        src = RD16(a);
+        b = 0x0b28;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0032, L0032);
+L0032:
+    AOT_BLOCK(0x0032, 1);
+    // 0032: sub $24a4, 0b28
+    {
+        src = uint16_t(0x24a4);
+        b = 0x0b28;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x0b28;
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 0038: sys 0
+    AOT_INTERP(0x0038);
+L003a:
+    AOT_BLOCK(0x003a, 1);
+    // 003a: neg -(r4)
+    {
+        r[4] -= 2;
+        a = r[4];
+        val = -int16_t(RD16(a));
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x003c, L003c);
+L003c:
+    AOT_BLOCK(0x003c, 1);
+    // 003c: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x003e, L003e);
+L003e:
+    // 003e: sys 6
+    AOT_INTERP(0x003e);
+L0040:
+    // 0040: sys b
+    AOT_INTERP(0x0040);
+L0042:
+    AOT_BLOCK(0x0042, 1);
+    // 0042: jmp *(sp)+
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(a);
+L0044:
+    AOT_BLOCK(0x0044, 1);
+    // 0044: neg *-(r2)
+    {
+        r[2] -= 2;
+        a = RD16(r[2]);
+        val = -int16_t(RD16(a));
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0046, L0046);
+L0046:
+    AOT_BLOCK(0x0046, 1);
+    // 0046: mov $5e, r0
+    {
+        src = uint16_t(0x005e);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x004a, L004a);
+L0048:
+    AOT_BLOCK(0x0048, 1);
+    // 0048: jmp *(sp)+
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(a);
+L004a:
+    AOT_BLOCK(0x004a, 1);
+    // 004a: jsr r5, 006a
+    {
+        a = 0x006a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x004e;
+    }
+    AOT_GOTO(0x006a, L006a);
+L004e:
+    AOT_BLOCK(0x004e, 1);
+    // 004e: clr *895c
+    {
+        a = RD16(0x895c);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0052, L0052);
+L0050:
+    // 0050: sys a
+    AOT_INTERP(0x0050);
+L0052:
+    AOT_BLOCK(0x0052, 1);
+    // 0052: adc -(r1)
+    {
+        r[1] -= 2;
+        a = r[1];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0054, L0054);
+L0054:
+    // 0054: sys a
+    AOT_INTERP(0x0054);
+L0056:
+    AOT_BLOCK(0x0056, 1);
+    // 0056: adc *-(r4)
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0058, L0058);
+L0058:
+    // 0058: sys a
+    AOT_INTERP(0x0058);
+L005a:
+    AOT_BLOCK(0x005a, 1);
+    // 005a: adc 895f
+    {
+        a = 0x895f;
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x005e, L005e);
+L005c:
+    // 005c: sys 1
+    AOT_INTERP(0x005c);
+L005e:
+    AOT_BLOCK(0x005e, 1);
+    // 005e: add 6269(r0), *-(pc)
+    {
+        a = uint16_t(r[0] + 25193);
+        src = RD16(a);
+        dst = uint16_t(0x0000);
+        val16 = val = int16_t(src) + int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0062, L0062);
+L0060:
+    AOT_BLOCK(0x0060, 1);
+    // 0060: add (r1), *-(r1)
+    {
+        a = r[1];
+        src = RD16(a);
+        r[1] -= 2;
+        b = RD16(r[1]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0062, L0062);
+L0062:
+    AOT_BLOCK(0x0062, 1);
+    // 0062: add r4, *-(pc)
+    {
+        src = r[4];
+        dst = uint16_t(0x0000);
+        val16 = val = int16_t(src) + int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0064, L0064);
+L0064:
+    AOT_BLOCK(0x0064, 1);
+    // 0064: bit (r1), 2d00(r3)
+    {
+        a = r[1];
+        src = RD16(a);
+        b = uint16_t(r[3] + 11520);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0068, L0068);
+L0066:
+    AOT_BLOCK(0x0066, 1);
+    // 0066: cmp 67(r4), r0
+    {
+        a = uint16_t(r[4] + 103);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x006a, L006a);
+L0068:
+    // 0068: jmp -(pc)
+    AOT_INTERP(0x0068);
+L006a:
+    AOT_BLOCK(0x006a, 1);
+    // 006a: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x006c, L006c);
+L006c:
+    AOT_BLOCK(0x006c, 1);
+    // 006c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x006e, L006e);
+L006e:
+    AOT_BLOCK(0x006e, 1);
+    // 006e: mov r4, 0b38
+    {
+        src = r[4];
+        b = 0x0b38;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0072, L0072);
+L0072:
+    AOT_BLOCK(0x0072, 1);
+    // 0072: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0074, L0074);
+L0074:
+    AOT_BLOCK(0x0074, 1);
+    // 0074: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0076, L0076);
+L0076:
+    AOT_BLOCK(0x0076, 1);
+    // 0076: beq 007c
+    if (Z)
+        AOT_GOTO(0x007c, L007c);
+    AOT_GOTO(0x0078, L0078);
+L0078:
+    AOT_BLOCK(0x0078, 1);
+    // 0078: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x007a, L007a);
+L007a:
+    AOT_BLOCK(0x007a, 1);
+    // 007a: br 0074
+    AOT_GOTO(0x0074, L0074);
+L007c:
+    AOT_BLOCK(0x007c, 1);
+    // 007c: mov r0, 0b3a
+    {
+        src = r[0];
+        b = 0x0b3a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0080, L0080);
+L0080:
+    AOT_BLOCK(0x0080, 1);
+    // 0080: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0084: sys 0
+    AOT_INTERP(0x0084);
+L0086:
+    AOT_BLOCK(0x0086, 1);
+    // 0086: neg 1177(sp)
+    {
+        a = uint16_t(r[6] + 4471);
+        val = -int16_t(RD16(a));
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x008a, L008a);
+L0088:
+    AOT_BLOCK(0x0088, 1);
+    // 0088: mov r5, 0b3e
+    {
+        src = r[5];
+        b = 0x0b3e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x008c, L008c);
+L008a:
+    AOT_BLOCK(0x008a, 1);
+    // 008a: inc 15c0(r2)
+    {
+        a = uint16_t(r[2] + 5568);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x008e, L008e);
+L008c:
+    AOT_BLOCK(0x008c, 1);
+    // 008c: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0090, L0090);
+L008e:
+    // 008e: wait
+    AOT_INTERP(0x008e);
+L0090:
+    // 0090: sys 0
+    AOT_INTERP(0x0090);
+L0092:
+    AOT_BLOCK(0x0092, 1);
+    // 0092: neg *bd5(r4)
+    {
+        a = RD16(r[4] + 3029);
+        val = -int16_t(RD16(a));
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0096, L0096);
+L0094:
+    AOT_BLOCK(0x0094, 1);
+    // 0094: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0096, L0096);
+L0096:
+    AOT_BLOCK(0x0096, 1);
+    // 0096: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0098, L0098);
+L0098:
+    AOT_BLOCK(0x0098, 1);
+    // 0098: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L009a:
+    AOT_BLOCK(0x009a, 3);
+    // 009a: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 009c: mov (r5)+, r4
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 009e: mov r4, 0b44
+    {
+        src = r[4];
+        b = 0x0b44;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00a2, L00a2);
+L00a2:
+    // 00a2: sys 0
+    AOT_INTERP(0x00a2);
+L00a4:
+    AOT_BLOCK(0x00a4, 1);
+    // 00a4: adc r2
+    {
+        val = int(int16_t(r[2])) + int(C);
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x00a6, L00a6);
+L00a6:
+    AOT_BLOCK(0x00a6, 1);
+    // 00a6: bcc 00b6
+    if (!C)
+        AOT_GOTO(0x00b6, L00b6);
+    AOT_GOTO(0x00a8, L00a8);
+L00a8:
+    AOT_BLOCK(0x00a8, 1);
+    // 00a8: mov r4, 0b4a
+    {
+        src = r[4];
+        b = 0x0b4a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00ac, L00ac);
+L00aa:
+    AOT_BLOCK(0x00aa, 1);
+    // 00aa: inc *(sp)+
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x00ac, L00ac);
+L00ac:
+    // 00ac: sys 0
+    AOT_INTERP(0x00ac);
+L00ae:
+    AOT_BLOCK(0x00ae, 1);
+    // 00ae: adc (r0)
+    {
+        a = r[0];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x00b0, L00b0);
+L00b0:
+    AOT_BLOCK(0x00b0, 1);
+    // 00b0: bcs 00b6
+    if (C)
+        AOT_GOTO(0x00b6, L00b6);
+    AOT_GOTO(0x00b2, L00b2);
+L00b2:
+    AOT_BLOCK(0x00b2, 1);
+    // 00b2: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00b4, L00b4);
+L00b4:
+    AOT_BLOCK(0x00b4, 1);
+    // 00b4: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L00b6:
+    AOT_BLOCK(0x00b6, 2);
+    // 00b6: incb 9(r4)
+    {
+        a = uint16_t(r[4] + 9);
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+    }
+    // 00ba: cmpb 9(r4), $7a
+    {
+        a = uint16_t(r[4] + 9);
+        src = RD8(a);
+        dst = uint8_t(0x7a);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    AOT_GOTO(0x00c0, L00c0);
+L00c0:
+    AOT_BLOCK(0x00c0, 1);
+    // 00c0: blos 00a2
+    if (C | Z)
+        AOT_GOTO(0x00a2, L00a2);
+    AOT_GOTO(0x00c2, L00c2);
+L00c2:
+    AOT_BLOCK(0x00c2, 2);
+    // 00c2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00c4: jsr r5, 006a
+    {
+        a = 0x006a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x00c8;
+    }
+    AOT_GOTO(0x006a, L006a);
+L00c8:
+    AOT_BLOCK(0x00c8, 1);
+    // 00c8: clr *89cd
+    {
+        a = RD16(0x89cd);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x00cc, L00cc);
+L00cc:
+    AOT_BLOCK(0x00cc, 6);
+    // 00cc: incb 2281
+    {
+        a = 0x2281;
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+    }
+    // 00d0: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00d2: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00d4: mov (r5)+, r0
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00d6: tst *2498
+    {
+        a = RD16(0x2498);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 00da: beq 00ee
+    if (Z)
+        AOT_GOTO(0x00ee, L00ee);
+    AOT_GOTO(0x00dc, L00dc);
+L00dc:
+    AOT_BLOCK(0x00dc, 4);
+    // 00dc: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00de: mov *2498, r0
+    {
+        a = RD16(0x2498);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00e2: clr *2498
+    {
+        a = RD16(0x2498);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 00e6: jsr r5, 006a
+    {
+        a = 0x006a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x00ea;
+    }
+    AOT_GOTO(0x006a, L006a);
+L00ea:
+    // 00ea: (undefined)
+    AOT_INTERP(0x00ea);
+L00ec:
+    AOT_BLOCK(0x00ec, 1);
+    // 00ec: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00ee, L00ee);
+L00ee:
+    AOT_BLOCK(0x00ee, 6);
+    // 00ee: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00f0: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00f2: mov 248e, r3
+    {
+        a = 0x248e;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 00f6: movb r0, 0b4e
+    {
+        src = uint8_t(r[0]);
+        b = 0x0b4e;
+        WR8(b, src);
+    }
+    // 00fa: mov $b54, r0
+    {
+        src = uint16_t(0x0b54);
+        r[0] = src;
+    }
+    // 00fe: mov $4, r1
+    {
+        src = uint16_t(0x0004);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0102, L0102);
+L0102:
+    AOT_BLOCK(0x0102, 6);
+    // 0102: clr r2
+    {
+        r[2] = 0;
+    }
+    // 0104: div $a, r2
+    {
+        src = int16_t(uint16_t(0x000a));
+        if (src == 0 || abs(int16_t(r[2])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[2]) << 16) | r[3];
+        dst = val / src;
+        r[2] = dst;
+        r[3] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0108: add $30, r3
+    {
+        src = uint16_t(0x0030);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 010c: movb r3, -(r0)
+    {
+        src = uint8_t(r[3]);
+        r[0] -= 1;
+        b = r[0];
+        WR8(b, src);
+    }
+    // 010e: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0110: sob r1, 8
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x0102, L0102);
+    AOT_GOTO(0x0112, L0112);
+L0112:
+    AOT_BLOCK(0x0112, 1);
+    // 0112: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0116: sys 4
+    AOT_INTERP(0x0116);
+L0118:
+    AOT_BLOCK(0x0118, 1);
+    // 0118: adc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x011a, L011a);
+L011a:
+    // 011a: (undefined)
+    AOT_INTERP(0x011a);
+L011c:
+    AOT_BLOCK(0x011c, 1);
+    // 011c: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x011e, L011e);
+L011e:
+    AOT_BLOCK(0x011e, 1);
+    // 011e: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0120, L0120);
+L0120:
+    AOT_BLOCK(0x0120, 2);
+    // 0120: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0122: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0124, L0124);
+L0124:
+    AOT_BLOCK(0x0124, 1);
+    // 0124: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0126:
+    AOT_BLOCK(0x0126, 2);
+    // 0126: cmp r0, (r5)+
+    {
+        src = r[0];
+        b = r[5];
+        r[5] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0128: blt 012e
+    if (N ^ V)
+        AOT_GOTO(0x012e, L012e);
+    AOT_GOTO(0x012a, L012a);
+L012a:
+    AOT_BLOCK(0x012a, 2);
+    // 012a: cmp (r5)+, r0
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 012c: blt 0130
+    if (N ^ V)
+        AOT_GOTO(0x0130, L0130);
+    AOT_GOTO(0x012e, L012e);
+L012e:
+    AOT_BLOCK(0x012e, 1);
+    // 012e: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0130, L0130);
+L0130:
+    AOT_BLOCK(0x0130, 1);
+    // 0130: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0132:
+    AOT_BLOCK(0x0132, 2);
+    // 0132: tst 2492
+    {
+        a = 0x2492;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0136: beq 013e
+    if (Z)
+        AOT_GOTO(0x013e, L013e);
+    AOT_GOTO(0x0138, L0138);
+L0138:
+    AOT_BLOCK(0x0138, 2);
+    // 0138: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 013c: bne 0160
+    if (!Z)
+        AOT_GOTO(0x0160, L0160);
+    AOT_GOTO(0x013e, L013e);
+L013e:
+    AOT_BLOCK(0x013e, 4);
+    // 013e: mov r4, *0b96
+    {
+        src = r[4];
+        b = RD16(0x0b96);
+        WR16(b, src);
+    }
+    // 0142: add $2, 0b96
+    {
+        src = uint16_t(0x0002);
+        b = 0x0b96;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0148: cmp 0b96, $248e
+    {
+        a = 0x0b96;
+        src = RD16(a);
+        dst = uint16_t(0x248e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 014e: bcs 0160
+    if (C)
+        AOT_GOTO(0x0160, L0160);
+    AOT_GOTO(0x0150, L0150);
+L0150:
+    AOT_BLOCK(0x0150, 2);
+    // 0150: mov $228e, 0b96
+    {
+        src = uint16_t(0x228e);
+        b = 0x0b96;
+        WR16(b, src);
+    }
+    // 0156: movb 227c, r0
+    {
+        a = 0x227c;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 015a: sys 4
+    AOT_INTERP(0x015a);
+L015c:
+    AOT_BLOCK(0x015c, 1);
+    // 015c: cmp (r2), (sp)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x015e, L015e);
+L015e:
+    AOT_BLOCK(0x015e, 1);
+    // 015e: bne 0160
+    if (!Z)
+        AOT_GOTO(0x0160, L0160);
+    AOT_GOTO(0x0160, L0160);
+L0160:
+    AOT_BLOCK(0x0160, 1);
+    // 0160: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0162:
+    AOT_BLOCK(0x0162, 1);
+    // 0162: jsr pc, 04e2
+    {
+        a = 0x04e2;
+        r[6] -= 2;
+        WR16(r[6], 0x0166);
+    }
+    AOT_GOTO(0x04e2, L04e2);
+L0164:
+    AOT_BLOCK(0x0164, 1);
+    // 0164: beq 025e
+    if (Z)
+        AOT_GOTO(0x025e, L025e);
+    AOT_GOTO(0x0166, L0166);
+L0166:
+    AOT_BLOCK(0x0166, 1);
+    // 0166: jsr pc, 02a2
+    {
+        a = 0x02a2;
+        r[6] -= 2;
+        WR16(r[6], 0x016a);
+    }
+    AOT_GOTO(0x02a2, L02a2);
+L016a:
+    AOT_BLOCK(0x016a, 1);
+    // 016a: br 0254
+    AOT_GOTO(0x0254, L0254);
+L01b4:
+    AOT_BLOCK(0x01b4, 2);
+    // 01b4: cmp r4, $1
+    {
+        src = r[4];
+        dst = uint16_t(0x0001);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01b8: beq 01da
+    if (Z)
+        AOT_GOTO(0x01da, L01da);
+    AOT_GOTO(0x01ba, L01ba);
+L01ba:
+    AOT_BLOCK(0x01ba, 1);
+    // 01ba: jsr r5, 00cc
+    {
+        a = 0x00cc;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01be;
+    }
+    AOT_GOTO(0x00cc, L00cc);
+L01be:
+    AOT_BLOCK(0x01be, 1);
+    // 01be: jmp *1d0(r0)
+    {
+        a = RD16(r[0] + 464);
+    }
+    AOT_JUMP(a);
+L01da:
+    AOT_BLOCK(0x01da, 2);
+    // 01da: mov 249e, r0
+    {
+        a = 0x249e;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01de: jsr pc, 0290
+    {
+        a = 0x0290;
+        r[6] -= 2;
+        WR16(r[6], 0x01e2);
+    }
+    AOT_GOTO(0x0290, L0290);
+L01e2:
+    AOT_BLOCK(0x01e2, 6);
+    // 01e2: movb 0ba2, 1648(r0)
+    {
+        a = 0x0ba2;
+        src = RD8(a);
+        b = uint16_t(r[0] + 5704);
+        WR8(b, src);
+    }
+    // 01e8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 01ea: movb 0ba2, 24a0
+    {
+        a = 0x0ba2;
+        src = RD8(a);
+        b = 0x24a0;
+        WR8(b, src);
+    }
+    // 01f0: mov 0ba4, 24a2
+    {
+        a = 0x0ba4;
+        src = RD16(a);
+        b = 0x24a2;
+        WR16(b, src);
+    }
+    // 01f6: movb r0, 24a1
+    {
+        src = uint8_t(r[0]);
+        b = 0x24a1;
+        WR8(b, src);
+    }
+    // 01fa: mov 0ba4, b82(r0)
+    {
+        a = 0x0ba4;
+        src = RD16(a);
+        b = uint16_t(r[0] + 2946);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0200, L0200);
+L0200:
+    AOT_BLOCK(0x0200, 1);
+    // 0200: movb 227f, r0
+    {
+        a = 0x227f;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0204: sys 4
+    AOT_INTERP(0x0204);
+L0206:
+    AOT_BLOCK(0x0206, 1);
+    // 0206: cmp (r2)+, -(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0208, L0208);
+L0208:
+    // 0208: iot
+    AOT_INTERP(0x0208);
+L020a:
+    AOT_BLOCK(0x020a, 1);
+    // 020a: br 0162
+    AOT_GOTO(0x0162, L0162);
+L020c:
+    AOT_BLOCK(0x020c, 1);
+    // 020c: jsr pc, 04e2
+    {
+        a = 0x04e2;
+        r[6] -= 2;
+        WR16(r[6], 0x0210);
+    }
+    AOT_GOTO(0x04e2, L04e2);
+L020e:
+    AOT_BLOCK(0x020e, 1);
+    // 020e: bne 01b4
+    if (!Z)
+        AOT_GOTO(0x01b4, L01b4);
+    AOT_GOTO(0x0210, L0210);
+L0210:
+    AOT_BLOCK(0x0210, 1);
+    // 0210: jsr pc, 08c2
+    {
+        a = 0x08c2;
+        r[6] -= 2;
+        WR16(r[6], 0x0214);
+    }
+    AOT_GOTO(0x08c2, L08c2);
+L0214:
+    AOT_BLOCK(0x0214, 3);
+    // 0214: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0216: cmp r1, $80
+    {
+        src = r[1];
+        dst = uint16_t(0x0080);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 021a: bcc 0224
+    if (!C)
+        AOT_GOTO(0x0224, L0224);
+    AOT_GOTO(0x021c, L021c);
+L021c:
+    AOT_BLOCK(0x021c, 1);
+    // 021c: jsr r5, 00cc
+    {
+        a = 0x00cc;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0220;
+    }
+    AOT_GOTO(0x00cc, L00cc);
+L0220:
+    AOT_BLOCK(0x0220, 1);
+    // 0220: jmp *118(r0)
+    {
+        a = RD16(r[0] + 280);
+    }
+    AOT_JUMP(a);
+L0224:
+    AOT_BLOCK(0x0224, 2);
+    // 0224: cmp r1, $ba2
+    {
+        src = r[1];
+        dst = uint16_t(0x0ba2);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0228: bne 0234
+    if (!Z)
+        AOT_GOTO(0x0234, L0234);
+    AOT_GOTO(0x022a, L022a);
+L022a:
+    AOT_BLOCK(0x022a, 3);
+    // 022a: bic $20, r3
+    {
+        src = uint16_t(0x0020);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+    }
+    // 022e: cmp r3, 0ba2
+    {
+        src = r[3];
+        b = 0x0ba2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0232: bne 0248
+    if (!Z)
+        AOT_GOTO(0x0248, L0248);
+    AOT_GOTO(0x0234, L0234);
+L0234:
+    AOT_BLOCK(0x0234, 3);
+    // 0234: bicb $1f, (r1)
+    {
+        src = uint8_t(0x1f);
+        b = r[1];
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+    }
+    // 0238: bic $ffe0, r3
+    {
+        src = uint16_t(0xffe0);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 023c: bne 0240
+    if (!Z)
+        AOT_GOTO(0x0240, L0240);
+    AOT_GOTO(0x023e, L023e);
+L023e:
+    AOT_BLOCK(0x023e, 1);
+    // 023e: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0240, L0240);
+L0240:
+    AOT_BLOCK(0x0240, 3);
+    // 0240: bisb r3, (r1)
+    {
+        src = uint8_t(r[3]);
+        b = r[1];
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 0242: mov r2, 2(r1)
+    {
+        src = r[2];
+        b = uint16_t(r[1] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0246: br 0254
+    AOT_GOTO(0x0254, L0254);
+L0248:
+    AOT_BLOCK(0x0248, 1);
+    // 0248: jsr r5, 00cc
+    {
+        a = 0x00cc;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x024c;
+    }
+    AOT_GOTO(0x00cc, L00cc);
+L024c:
+    // 024c: (undefined)
+    AOT_INTERP(0x024c);
+L024e:
+    AOT_BLOCK(0x024e, 1);
+    // 024e: movb $2, 0ba2
+    {
+        src = uint8_t(0x02);
+        b = 0x0ba2;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0254, L0254);
+L0254:
+    AOT_BLOCK(0x0254, 2);
+    // 0254: cmp r4, $3b
+    {
+        src = r[4];
+        dst = uint16_t(0x003b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0258: beq 028c
+    if (Z)
+        AOT_GOTO(0x028c, L028c);
+    AOT_GOTO(0x025a, L025a);
+L025a:
+    AOT_BLOCK(0x025a, 1);
+    // 025a: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x025e, L025e);
+L025e:
+    AOT_BLOCK(0x025e, 1);
+    // 025e: bne 0266
+    if (!Z)
+        AOT_GOTO(0x0266, L0266);
+    AOT_GOTO(0x0260, L0260);
+L0260:
+    AOT_BLOCK(0x0260, 2);
+    // 0260: inc 248e
+    {
+        a = 0x248e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0264: br 028c
+    AOT_GOTO(0x028c, L028c);
+L0266:
+    AOT_BLOCK(0x0266, 2);
+    // 0266: cmp r4, $4
+    {
+        src = r[4];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 026a: bne 027a
+    if (!Z)
+        AOT_GOTO(0x027a, L027a);
+    AOT_GOTO(0x026c, L026c);
+L026c:
+    AOT_BLOCK(0x026c, 2);
+    // 026c: tst 2492
+    {
+        a = 0x2492;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0270: beq 0278
+    if (Z)
+        AOT_GOTO(0x0278, L0278);
+    AOT_GOTO(0x0272, L0272);
+L0272:
+    AOT_BLOCK(0x0272, 1);
+    // 0272: jsr r5, 00cc
+    {
+        a = 0x00cc;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0276;
+    }
+    AOT_GOTO(0x00cc, L00cc);
+L0276:
+    AOT_BLOCK(0x0276, 1);
+    // 0276: jmp *87(r0)
+    {
+        a = RD16(r[0] + 135);
+    }
+    AOT_JUMP(a);
+L0278:
+    AOT_BLOCK(0x0278, 1);
+    // 0278: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L027a:
+    AOT_BLOCK(0x027a, 1);
+    // 027a: jsr r5, 00cc
+    {
+        a = 0x00cc;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x027e;
+    }
+    AOT_GOTO(0x00cc, L00cc);
+L027e:
+    AOT_BLOCK(0x027e, 1);
+    // 027e: jmp *9f7(r0)
+    {
+        a = RD16(r[0] + 2551);
+    }
+    AOT_JUMP(a);
+L028c:
+    AOT_BLOCK(0x028c, 1);
+    // 028c: jmp 0162
+    {
+        a = 0x0162;
+    }
+    AOT_GOTO(0x0162, L0162);
+L0290:
+    AOT_BLOCK(0x0290, 2);
+    // 0290: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0294: bhi 0298
+    if (!(C | Z))
+        AOT_GOTO(0x0298, L0298);
+    AOT_GOTO(0x0296, L0296);
+L0296:
+    AOT_BLOCK(0x0296, 1);
+    // 0296: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0298:
+    AOT_BLOCK(0x0298, 1);
+    // 0298: jsr r5, 00cc
+    {
+        a = 0x00cc;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x029c;
+    }
+    AOT_GOTO(0x00cc, L00cc);
+L029c:
+    AOT_BLOCK(0x029c, 1);
+    // 029c: jmp -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+    }
+    AOT_JUMP(a);
+L02a2:
+    AOT_BLOCK(0x02a2, 2);
+    // 02a2: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02a6: beq 02b8
+    if (Z)
+        AOT_GOTO(0x02b8, L02b8);
+    AOT_GOTO(0x02a8, L02a8);
+L02a8:
+    AOT_BLOCK(0x02a8, 2);
+    // 02a8: cmp r4, $3b
+    {
+        src = r[4];
+        dst = uint16_t(0x003b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02ac: beq 02b8
+    if (Z)
+        AOT_GOTO(0x02b8, L02b8);
+    AOT_GOTO(0x02ae, L02ae);
+L02ae:
+    AOT_BLOCK(0x02ae, 2);
+    // 02ae: cmp r4, $4
+    {
+        src = r[4];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02b2: beq 02b8
+    if (Z)
+        AOT_GOTO(0x02b8, L02b8);
+    AOT_GOTO(0x02b4, L02b4);
+L02b4:
+    AOT_BLOCK(0x02b4, 1);
+    // 02b4: add $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x02b8, L02b8);
+L02b8:
+    AOT_BLOCK(0x02b8, 1);
+    // 02b8: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L02ba:
+    AOT_BLOCK(0x02ba, 13);
+    // 02ba: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02bc: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02be: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02c0: mov $8, r5
+    {
+        src = uint16_t(0x0008);
+        r[5] = src;
+    }
+    // 02c4: mov $228c, r2
+    {
+        src = uint16_t(0x228c);
+        r[2] = src;
+    }
+    // 02c8: clr -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        WR16(a, 0);
+    }
+    // 02ca: clr -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        WR16(a, 0);
+    }
+    // 02cc: clr -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        WR16(a, 0);
+    }
+    // 02ce: clr -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        WR16(a, 0);
+    }
+    // 02d0: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 02d2: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 02d4: cmp r0, $7e
+    {
+        src = r[0];
+        dst = uint16_t(0x007e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02d8: bne 02e2
+    if (!Z)
+        AOT_GOTO(0x02e2, L02e2);
+    AOT_GOTO(0x02da, L02da);
+L02da:
+    AOT_BLOCK(0x02da, 2);
+    // 02da: inc 2(sp)
+    {
+        a = uint16_t(r[6] + 2);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 02de: clr 2282
+    {
+        a = 0x2282;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x02e2, L02e2);
+L02e2:
+    AOT_BLOCK(0x02e2, 1);
+    // 02e2: jsr pc, 0424
+    {
+        a = 0x0424;
+        r[6] -= 2;
+        WR16(r[6], 0x02e6);
+    }
+    AOT_GOTO(0x0424, L0424);
+L02e6:
+    AOT_BLOCK(0x02e6, 2);
+    // 02e6: movb aa4(r0), r3
+    {
+        a = uint16_t(r[0] + 2724);
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 02ea: ble 02f8
+    if (Z || (N ^ V))
+        AOT_GOTO(0x02f8, L02f8);
+    AOT_GOTO(0x02ec, L02ec);
+L02ec:
+    AOT_BLOCK(0x02ec, 4);
+    // 02ec: add r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 02ee: swab (sp)
+    {
+        a = r[6];
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+        C = false;
+    }
+    // 02f0: dec r5
+    {
+        val = int(int16_t(r[5])) - 1;
+        r[5] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 02f2: blt 02e2
+    if (N ^ V)
+        AOT_GOTO(0x02e2, L02e2);
+    AOT_GOTO(0x02f4, L02f4);
+L02f4:
+    AOT_BLOCK(0x02f4, 2);
+    // 02f4: movb r3, (r2)+
+    {
+        src = uint8_t(r[3]);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 02f6: br 02e2
+    AOT_GOTO(0x02e2, L02e2);
+L02f8:
+    AOT_BLOCK(0x02f8, 3);
+    // 02f8: mov r0, 2282
+    {
+        src = r[0];
+        b = 0x2282;
+        WR16(b, src);
+    }
+    // 02fc: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 02fe: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0300, L0300);
+L0300:
+    AOT_BLOCK(0x0300, 2);
+    // 0300: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0302: beq 030a
+    if (Z)
+        AOT_GOTO(0x030a, L030a);
+    AOT_GOTO(0x0304, L0304);
+L0304:
+    AOT_BLOCK(0x0304, 2);
+    // 0304: mov 0b98, r4
+    {
+        a = 0x0b98;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0308: br 0342
+    AOT_GOTO(0x0342, L0342);
+L030a:
+    AOT_BLOCK(0x030a, 3);
+    // 030a: div $611, r0
+    {
+        src = int16_t(uint16_t(0x0611));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 030e: ashc $1, r0
+    {
+        src = uint16_t(0x0001) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 0312: add $165a, r1
+    {
+        src = uint16_t(0x165a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0316, L0316);
+L0316:
+    AOT_BLOCK(0x0316, 3);
+    // 0316: sub r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+    }
+    // 0318: cmp r1, $165a
+    {
+        src = r[1];
+        dst = uint16_t(0x165a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 031c: bhi 0322
+    if (!(C | Z))
+        AOT_GOTO(0x0322, L0322);
+    AOT_GOTO(0x031e, L031e);
+L031e:
+    AOT_BLOCK(0x031e, 1);
+    // 031e: add $c22, r1
+    {
+        src = uint16_t(0x0c22);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0322, L0322);
+L0322:
+    AOT_BLOCK(0x0322, 3);
+    // 0322: mov $2284, r2
+    {
+        src = uint16_t(0x2284);
+        r[2] = src;
+    }
+    // 0326: mov -(r1), r4
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0328: beq 033c
+    if (Z)
+        AOT_GOTO(0x033c, L033c);
+    AOT_GOTO(0x032a, L032a);
+L032a:
+    AOT_BLOCK(0x032a, 2);
+    // 032a: cmp (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 032c: bne 0316
+    if (!Z)
+        AOT_GOTO(0x0316, L0316);
+    AOT_GOTO(0x032e, L032e);
+L032e:
+    AOT_BLOCK(0x032e, 2);
+    // 032e: cmp (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0330: bne 0316
+    if (!Z)
+        AOT_GOTO(0x0316, L0316);
+    AOT_GOTO(0x0332, L0332);
+L0332:
+    AOT_BLOCK(0x0332, 2);
+    // 0332: cmp (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0334: bne 0316
+    if (!Z)
+        AOT_GOTO(0x0316, L0316);
+    AOT_GOTO(0x0336, L0336);
+L0336:
+    AOT_BLOCK(0x0336, 2);
+    // 0336: cmp (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0338: bne 0316
+    if (!Z)
+        AOT_GOTO(0x0316, L0316);
+    AOT_GOTO(0x033a, L033a);
+L033a:
+    AOT_BLOCK(0x033a, 1);
+    // 033a: br 0372
+    AOT_GOTO(0x0372, L0372);
+L033c:
+    AOT_BLOCK(0x033c, 2);
+    // 033c: mov 0b98, r4
+    {
+        a = 0x0b98;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0340: mov r4, (r1)
+    {
+        src = r[4];
+        b = r[1];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0342, L0342);
+L0342:
+    AOT_BLOCK(0x0342, 5);
+    // 0342: mov $2284, r2
+    {
+        src = uint16_t(0x2284);
+        r[2] = src;
+    }
+    // 0346: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0348: add $10, r4
+    {
+        src = uint16_t(0x0010);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+    }
+    // 034c: cmp r4, 0b58
+    {
+        src = r[4];
+        b = 0x0b58;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0350: blos 035c
+    if (C | Z)
+        AOT_GOTO(0x035c, L035c);
+    AOT_GOTO(0x0352, L0352);
+L0352:
+    AOT_BLOCK(0x0352, 1);
+    // 0352: add $200, 0b58
+    {
+        src = uint16_t(0x0200);
+        b = 0x0b58;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0358: sys 0
+    AOT_INTERP(0x0358);
+L035a:
+    AOT_BLOCK(0x035a, 1);
+    // 035a: adc (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x035c, L035c);
+L035c:
+    AOT_BLOCK(0x035c, 1);
+    // 035c: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x035e, L035e);
+L035e:
+    AOT_BLOCK(0x035e, 1);
+    // 035e: mov (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0360, L0360);
+L0360:
+    AOT_BLOCK(0x0360, 1);
+    // 0360: mov (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0362, L0362);
+L0362:
+    AOT_BLOCK(0x0362, 6);
+    // 0362: mov (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+    }
+    // 0364: mov (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+    }
+    // 0366: clr (r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+        WR16(a, 0);
+    }
+    // 0368: clr (r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+        WR16(a, 0);
+    }
+    // 036a: mov r4, 0b98
+    {
+        src = r[4];
+        b = 0x0b98;
+        WR16(b, src);
+    }
+    // 036e: sub $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0372, L0372);
+L0372:
+    AOT_BLOCK(0x0372, 5);
+    // 0372: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0374: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 0376: sub $8, r3
+    {
+        src = uint16_t(0x0008);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 037a: cmp r3, $24a4
+    {
+        src = r[3];
+        dst = uint16_t(0x24a4);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 037e: bcs 0392
+    if (C)
+        AOT_GOTO(0x0392, L0392);
+    AOT_GOTO(0x0380, L0380);
+L0380:
+    AOT_BLOCK(0x0380, 6);
+    // 0380: sub $24a4, r3
+    {
+        src = uint16_t(0x24a4);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 0384: clr r2
+    {
+        r[2] = 0;
+    }
+    // 0386: div $3, r2
+    {
+        src = int16_t(uint16_t(0x0003));
+        if (src == 0 || abs(int16_t(r[2])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[2]) << 16) | r[3];
+        dst = val / src;
+        r[2] = dst;
+        r[3] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 038a: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+    }
+    // 038c: add $800, r4
+    {
+        src = uint16_t(0x0800);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0390: br 03a2
+    AOT_GOTO(0x03a2, L03a2);
+L0392:
+    AOT_BLOCK(0x0392, 5);
+    // 0392: sub $b9a, r3
+    {
+        src = uint16_t(0x0b9a);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 0396: clr r2
+    {
+        r[2] = 0;
+    }
+    // 0398: div $3, r2
+    {
+        src = int16_t(uint16_t(0x0003));
+        if (src == 0 || abs(int16_t(r[2])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[2]) << 16) | r[3];
+        dst = val / src;
+        r[2] = dst;
+        r[3] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 039c: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+    }
+    // 039e: add $200, r4
+    {
+        src = uint16_t(0x0200);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x03a2, L03a2);
+L03a2:
+    AOT_BLOCK(0x03a2, 1);
+    // 03a2: jsr pc, 0132
+    {
+        a = 0x0132;
+        r[6] -= 2;
+        WR16(r[6], 0x03a6);
+    }
+    AOT_GOTO(0x0132, L0132);
+L03a6:
+    AOT_BLOCK(0x03a6, 6);
+    // 03a6: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 03a8: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 03aa: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 03ac: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 03ae: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03b0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L03b2:
+    AOT_BLOCK(0x03b2, 6);
+    // 03b2: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03b4: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03b6: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03b8: clr r1
+    {
+        r[1] = 0;
+    }
+    // 03ba: clr r5
+    {
+        r[5] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 03bc: jsr pc, 0424
+    {
+        a = 0x0424;
+        r[6] -= 2;
+        WR16(r[6], 0x03c0);
+    }
+    AOT_GOTO(0x0424, L0424);
+L03c0:
+    AOT_BLOCK(0x03c0, 1);
+    // 03c0: jsr r5, 0126
+    {
+        a = 0x0126;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x03c4;
+    }
+    AOT_GOTO(0x0126, L0126);
+L03c4:
+    // 03c4: (undefined)
+    AOT_INTERP(0x03c4);
+L03c6:
+    // 03c6: (undefined)
+    AOT_INTERP(0x03c6);
+L03c8:
+    AOT_BLOCK(0x03c8, 1);
+    // 03c8: br 03dc
+    AOT_GOTO(0x03dc, L03dc);
+L03dc:
+    AOT_BLOCK(0x03dc, 2);
+    // 03dc: cmp r0, $62
+    {
+        src = r[0];
+        dst = uint16_t(0x0062);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03e0: beq 0400
+    if (Z)
+        AOT_GOTO(0x0400, L0400);
+    AOT_GOTO(0x03e2, L03e2);
+L03e2:
+    AOT_BLOCK(0x03e2, 2);
+    // 03e2: cmp r0, $66
+    {
+        src = r[0];
+        dst = uint16_t(0x0066);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03e6: beq 0400
+    if (Z)
+        AOT_GOTO(0x0400, L0400);
+    AOT_GOTO(0x03e8, L03e8);
+L03e8:
+    AOT_BLOCK(0x03e8, 2);
+    // 03e8: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03ec: bne 03f2
+    if (!Z)
+        AOT_GOTO(0x03f2, L03f2);
+    AOT_GOTO(0x03ee, L03ee);
+L03ee:
+    AOT_BLOCK(0x03ee, 2);
+    // 03ee: mov r5, r1
+    {
+        src = r[5];
+        r[1] = src;
+    }
+    // 03f0: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x03f2, L03f2);
+L03f2:
+    AOT_BLOCK(0x03f2, 6);
+    // 03f2: movb r0, 2282
+    {
+        src = uint8_t(r[0]);
+        b = 0x2282;
+        WR8(b, src);
+    }
+    // 03f6: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 03f8: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+    }
+    // 03fa: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 03fc: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03fe: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0400:
+    AOT_BLOCK(0x0400, 3);
+    // 0400: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0402: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0404: jsr pc, 0290
+    {
+        a = 0x0290;
+        r[6] -= 2;
+        WR16(r[6], 0x0408);
+    }
+    AOT_GOTO(0x0290, L0290);
+L0408:
+    AOT_BLOCK(0x0408, 3);
+    // 0408: add $61, r0
+    {
+        src = uint16_t(0x0061);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 040c: cmp r3, $62
+    {
+        src = r[3];
+        dst = uint16_t(0x0062);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0410: beq 0416
+    if (Z)
+        AOT_GOTO(0x0416, L0416);
+    AOT_GOTO(0x0412, L0412);
+L0412:
+    AOT_BLOCK(0x0412, 1);
+    // 0412: add $a, r0
+    {
+        src = uint16_t(0x000a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0416, L0416);
+L0416:
+    AOT_BLOCK(0x0416, 6);
+    // 0416: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0418: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+    }
+    // 041a: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 041c: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 041e: add $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0422: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0424:
+    AOT_BLOCK(0x0424, 2);
+    // 0424: movb 2282, r0
+    {
+        a = 0x2282;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0428: beq 0430
+    if (Z)
+        AOT_GOTO(0x0430, L0430);
+    AOT_GOTO(0x042a, L042a);
+L042a:
+    AOT_BLOCK(0x042a, 2);
+    // 042a: clrb 2282
+    {
+        a = 0x2282;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 042e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0430:
+    AOT_BLOCK(0x0430, 2);
+    // 0430: dec 2490
+    {
+        a = 0x2490;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0434: blt 0446
+    if (N ^ V)
+        AOT_GOTO(0x0446, L0446);
+    AOT_GOTO(0x0436, L0436);
+L0436:
+    AOT_BLOCK(0x0436, 4);
+    // 0436: movb *2494, r0
+    {
+        a = RD16(0x2494);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 043a: inc 2494
+    {
+        a = 0x2494;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 043e: bic $ff80, r0
+    {
+        src = uint16_t(0xff80);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0442: beq 0430
+    if (Z)
+        AOT_GOTO(0x0430, L0430);
+    AOT_GOTO(0x0444, L0444);
+L0444:
+    AOT_BLOCK(0x0444, 1);
+    // 0444: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0446:
+    AOT_BLOCK(0x0446, 2);
+    // 0446: movb 227e, r0
+    {
+        a = 0x227e;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 044a: beq 046e
+    if (Z)
+        AOT_GOTO(0x046e, L046e);
+    AOT_GOTO(0x044c, L044c);
+L044c:
+    // 044c: sys 3
+    AOT_INTERP(0x044c);
+L044e:
+    AOT_BLOCK(0x044e, 1);
+    // 044e: mov (r1)+, (r0)
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        b = r[0];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0450, L0450);
+L0450:
+    AOT_BLOCK(0x0450, 1);
+    // 0450: bne 0452
+    if (!Z)
+        AOT_GOTO(0x0452, L0452);
+    AOT_GOTO(0x0452, L0452);
+L0452:
+    AOT_BLOCK(0x0452, 1);
+    // 0452: bcs 0464
+    if (C)
+        AOT_GOTO(0x0464, L0464);
+    AOT_GOTO(0x0454, L0454);
+L0454:
+    AOT_BLOCK(0x0454, 1);
+    // 0454: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0456, L0456);
+L0456:
+    AOT_BLOCK(0x0456, 1);
+    // 0456: beq 0464
+    if (Z)
+        AOT_GOTO(0x0464, L0464);
+    AOT_GOTO(0x0458, L0458);
+L0458:
+    AOT_BLOCK(0x0458, 3);
+    // 0458: mov r0, 2490
+    {
+        src = r[0];
+        b = 0x2490;
+        WR16(b, src);
+    }
+    // 045c: mov $1448, 2494
+    {
+        src = uint16_t(0x1448);
+        b = 0x2494;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0462: br 0430
+    AOT_GOTO(0x0430, L0430);
+L0464:
+    AOT_BLOCK(0x0464, 2);
+    // 0464: movb 227e, r0
+    {
+        a = 0x227e;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0468: clrb 227e
+    {
+        a = 0x227e;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 046c: sys 6
+    AOT_INTERP(0x046c);
+L046e:
+    AOT_BLOCK(0x046e, 1);
+    // 046e: decb 2496
+    {
+        a = 0x2496;
+        val = int(int8_t(RD8(a))) - 1;
+        WR8(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x81;
+    }
+    AOT_GOTO(0x0472, L0472);
+L0470:
+    AOT_BLOCK(0x0470, 1);
+    // 0470: cmp r0, -(r4)
+    {
+        src = r[0];
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0472, L0472);
+L0472:
+    AOT_BLOCK(0x0472, 1);
+    // 0472: bgt 047a
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x047a, L047a);
+    AOT_GOTO(0x0474, L0474);
+L0474:
+    AOT_BLOCK(0x0474, 1);
+    // 0474: mov $4, r0
+    {
+        src = uint16_t(0x0004);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0478, L0478);
+L0476:
+    // 0476: iot
+    AOT_INTERP(0x0476);
+L0478:
+    AOT_BLOCK(0x0478, 1);
+    // 0478: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L047a:
+    AOT_BLOCK(0x047a, 2);
+    // 047a: tst 2492
+    {
+        a = 0x2492;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 047e: beq 048a
+    if (Z)
+        AOT_GOTO(0x048a, L048a);
+    AOT_GOTO(0x0480, L0480);
+L0480:
+    AOT_BLOCK(0x0480, 1);
+    // 0480: jsr r5, 00cc
+    {
+        a = 0x00cc;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0484;
+    }
+    AOT_GOTO(0x00cc, L00cc);
+L0484:
+    AOT_BLOCK(0x0484, 1);
+    // 0484: jmp *-(r1)
+    {
+        r[1] -= 2;
+        a = RD16(r[1]);
+    }
+    AOT_JUMP(a);
+L048a:
+    AOT_BLOCK(0x048a, 5);
+    // 048a: mov 2498, r0
+    {
+        a = 0x2498;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 048e: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0490: mov (r0), 0b5c
+    {
+        a = r[0];
+        src = RD16(a);
+        b = 0x0b5c;
+        WR16(b, src);
+    }
+    // 0494: mov r0, 2498
+    {
+        src = r[0];
+        b = 0x2498;
+        WR16(b, src);
+    }
+    // 0498: incb 2280
+    {
+        a = 0x2280;
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x80;
+    }
+    // 049c: sys 0
+    AOT_INTERP(0x049c);
+L049e:
+    AOT_BLOCK(0x049e, 1);
+    // 049e: adc *(r2)+
+    {
+        a = RD16(r[2]);
+        r[2] += 2;
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x04a0, L04a0);
+L04a0:
+    AOT_BLOCK(0x04a0, 1);
+    // 04a0: bcc 04b0
+    if (!C)
+        AOT_GOTO(0x04b0, L04b0);
+    AOT_GOTO(0x04a2, L04a2);
+L04a2:
+    AOT_BLOCK(0x04a2, 1);
+    // 04a2: mov 0b5c, r0
+    {
+        a = 0x0b5c;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04a6, L04a6);
+L04a4:
+    AOT_BLOCK(0x04a4, 1);
+    // 04a4: bgt 0412
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0412, L0412);
+    AOT_GOTO(0x04a6, L04a6);
+L04a6:
+    AOT_BLOCK(0x04a6, 1);
+    // 04a6: jsr r5, 006a
+    {
+        a = 0x006a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x04aa;
+    }
+    AOT_GOTO(0x006a, L006a);
+L04aa:
+    AOT_BLOCK(0x04aa, 1);
+    // 04aa: clr *0525
+    {
+        a = RD16(0x0525);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 04ae: (undefined)
+    AOT_INTERP(0x04ae);
+L04b0:
+    AOT_BLOCK(0x04b0, 6);
+    // 04b0: movb r0, 227e
+    {
+        src = uint8_t(r[0]);
+        b = 0x227e;
+        WR8(b, src);
+    }
+    // 04b4: mov $1, 248e
+    {
+        src = uint16_t(0x0001);
+        b = 0x248e;
+        WR16(b, src);
+    }
+    // 04ba: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04bc: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04be: mov $5, r4
+    {
+        src = uint16_t(0x0005);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04c2: jsr pc, 0132
+    {
+        a = 0x0132;
+        r[6] -= 2;
+        WR16(r[6], 0x04c6);
+    }
+    AOT_GOTO(0x0132, L0132);
+L04c6:
+    AOT_BLOCK(0x04c6, 1);
+    // 04c6: mov *2498, r1
+    {
+        a = RD16(0x2498);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04ca, L04ca);
+L04ca:
+    AOT_BLOCK(0x04ca, 2);
+    // 04ca: movb (r1)+, r4
+    {
+        a = r[1];
+        r[1] += 1;
+        src = RD8(a);
+        r[4] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 04cc: beq 04d4
+    if (Z)
+        AOT_GOTO(0x04d4, L04d4);
+    AOT_GOTO(0x04ce, L04ce);
+L04ce:
+    AOT_BLOCK(0x04ce, 1);
+    // 04ce: jsr pc, 0132
+    {
+        a = 0x0132;
+        r[6] -= 2;
+        WR16(r[6], 0x04d2);
+    }
+    AOT_GOTO(0x0132, L0132);
+L04d2:
+    AOT_BLOCK(0x04d2, 1);
+    // 04d2: br 04ca
+    AOT_GOTO(0x04ca, L04ca);
+L04d4:
+    AOT_BLOCK(0x04d4, 2);
+    // 04d4: mov $ffff, r4
+    {
+        src = uint16_t(0xffff);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04d8: jsr pc, 0132
+    {
+        a = 0x0132;
+        r[6] -= 2;
+        WR16(r[6], 0x04dc);
+    }
+    AOT_GOTO(0x0132, L0132);
+L04dc:
+    AOT_BLOCK(0x04dc, 3);
+    // 04dc: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 04de: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04e0: br 0430
+    AOT_GOTO(0x0430, L0430);
+L04e2:
+    AOT_BLOCK(0x04e2, 2);
+    // 04e2: mov 249c, r4
+    {
+        a = 0x249c;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04e6: beq 04ee
+    if (Z)
+        AOT_GOTO(0x04ee, L04ee);
+    AOT_GOTO(0x04e8, L04e8);
+L04e8:
+    AOT_BLOCK(0x04e8, 2);
+    // 04e8: clr 249c
+    {
+        a = 0x249c;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 04ec: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L04ee:
+    AOT_BLOCK(0x04ee, 1);
+    // 04ee: jsr pc, 04f8
+    {
+        a = 0x04f8;
+        r[6] -= 2;
+        WR16(r[6], 0x04f2);
+    }
+    AOT_GOTO(0x04f8, L04f8);
+L04f2:
+    AOT_BLOCK(0x04f2, 1);
+    // 04f2: jsr pc, 0132
+    {
+        a = 0x0132;
+        r[6] -= 2;
+        WR16(r[6], 0x04f6);
+    }
+    AOT_GOTO(0x0132, L0132);
+L04f6:
+    AOT_BLOCK(0x04f6, 1);
+    // 04f6: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L04f8:
+    AOT_BLOCK(0x04f8, 1);
+    // 04f8: jsr pc, 0424
+    {
+        a = 0x0424;
+        r[6] -= 2;
+        WR16(r[6], 0x04fc);
+    }
+    AOT_GOTO(0x0424, L0424);
+L04fc:
+    AOT_BLOCK(0x04fc, 3);
+    // 04fc: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 04fe: movb aa4(r0), r1
+    {
+        a = uint16_t(r[0] + 2724);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0502: bgt 0546
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0546, L0546);
+    AOT_GOTO(0x0504, L0504);
+L0504:
+    AOT_BLOCK(0x0504, 1);
+    // 0504: jmp *51e(r1)
+    {
+        a = RD16(r[1] + 1310);
+    }
+    AOT_JUMP(a);
+L0546:
+    AOT_BLOCK(0x0546, 3);
+    // 0546: movb r0, 2282
+    {
+        src = uint8_t(r[0]);
+        b = 0x2282;
+        WR8(b, src);
+    }
+    // 054a: cmp r1, $30
+    {
+        src = r[1];
+        dst = uint16_t(0x0030);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 054e: bcs 0556
+    if (C)
+        AOT_GOTO(0x0556, L0556);
+    AOT_GOTO(0x0550, L0550);
+L0550:
+    AOT_BLOCK(0x0550, 2);
+    // 0550: cmp r1, $39
+    {
+        src = r[1];
+        dst = uint16_t(0x0039);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0554: blos 055a
+    if (C | Z)
+        AOT_GOTO(0x055a, L055a);
+    AOT_GOTO(0x0556, L0556);
+L0556:
+    AOT_BLOCK(0x0556, 1);
+    // 0556: jmp 02ba
+    {
+        a = 0x02ba;
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L055a:
+    AOT_BLOCK(0x055a, 1);
+    // 055a: jsr pc, 03b2
+    {
+        a = 0x03b2;
+        r[6] -= 2;
+        WR16(r[6], 0x055e);
+    }
+    AOT_GOTO(0x03b2, L03b2);
+L055e:
+    AOT_BLOCK(0x055e, 1);
+    // 055e: br 0576
+    AOT_GOTO(0x0576, L0576);
+L0576:
+    AOT_BLOCK(0x0576, 3);
+    // 0576: mov r0, 249e
+    {
+        src = r[0];
+        b = 0x249e;
+        WR16(b, src);
+    }
+    // 057a: mov $1, r4
+    {
+        src = uint16_t(0x0001);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 057e: jsr pc, 0132
+    {
+        a = 0x0132;
+        r[6] -= 2;
+        WR16(r[6], 0x0582);
+    }
+    AOT_GOTO(0x0132, L0132);
+L0582:
+    AOT_BLOCK(0x0582, 2);
+    // 0582: mov 249e, r4
+    {
+        a = 0x249e;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0586: jsr pc, 0132
+    {
+        a = 0x0132;
+        r[6] -= 2;
+        WR16(r[6], 0x058a);
+    }
+    AOT_GOTO(0x0132, L0132);
+L058a:
+    AOT_BLOCK(0x058a, 3);
+    // 058a: mov $1, r4
+    {
+        src = uint16_t(0x0001);
+        r[4] = src;
+    }
+    // 058e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0590: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L05ae:
+    AOT_BLOCK(0x05ae, 2);
+    // 05ae: mov $3c, r4
+    {
+        src = uint16_t(0x003c);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05b2: jsr pc, 0132
+    {
+        a = 0x0132;
+        r[6] -= 2;
+        WR16(r[6], 0x05b6);
+    }
+    AOT_GOTO(0x0132, L0132);
+L05b6:
+    AOT_BLOCK(0x05b6, 1);
+    // 05b6: clr 249e
+    {
+        a = 0x249e;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x05ba, L05ba);
+L05ba:
+    AOT_BLOCK(0x05ba, 1);
+    // 05ba: jsr pc, 05e2
+    {
+        a = 0x05e2;
+        r[6] -= 2;
+        WR16(r[6], 0x05be);
+    }
+    AOT_GOTO(0x05e2, L05e2);
+L05be:
+    AOT_BLOCK(0x05be, 2);
+    // 05be: tst r1
+    {
+        val = int16_t(r[1]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05c0: bne 05d2
+    if (!Z)
+        AOT_GOTO(0x05d2, L05d2);
+    AOT_GOTO(0x05c2, L05c2);
+L05c2:
+    AOT_BLOCK(0x05c2, 3);
+    // 05c2: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 05c4: bis $100, r4
+    {
+        src = uint16_t(0x0100);
+        dst = r[4];
+        val = src | dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 05c8: jsr pc, 0132
+    {
+        a = 0x0132;
+        r[6] -= 2;
+        WR16(r[6], 0x05cc);
+    }
+    AOT_GOTO(0x0132, L0132);
+L05cc:
+    AOT_BLOCK(0x05cc, 2);
+    // 05cc: inc 249e
+    {
+        a = 0x249e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 05d0: br 05ba
+    AOT_GOTO(0x05ba, L05ba);
+L05d2:
+    AOT_BLOCK(0x05d2, 2);
+    // 05d2: mov $ffff, r4
+    {
+        src = uint16_t(0xffff);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05d6: jsr pc, 0132
+    {
+        a = 0x0132;
+        r[6] -= 2;
+        WR16(r[6], 0x05da);
+    }
+    AOT_GOTO(0x0132, L0132);
+L05da:
+    AOT_BLOCK(0x05da, 3);
+    // 05da: mov $3c, r4
+    {
+        src = uint16_t(0x003c);
+        r[4] = src;
+    }
+    // 05de: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05e0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L05e2:
+    AOT_BLOCK(0x05e2, 1);
+    // 05e2: jsr pc, 0424
+    {
+        a = 0x0424;
+        r[6] -= 2;
+        WR16(r[6], 0x05e6);
+    }
+    AOT_GOTO(0x0424, L0424);
+L05e6:
+    AOT_BLOCK(0x05e6, 2);
+    // 05e6: cmp r0, $4
+    {
+        src = r[0];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05ea: beq 061c
+    if (Z)
+        AOT_GOTO(0x061c, L061c);
+    AOT_GOTO(0x05ec, L05ec);
+L05ec:
+    AOT_BLOCK(0x05ec, 2);
+    // 05ec: cmp r0, $a
+    {
+        src = r[0];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05f0: beq 061c
+    if (Z)
+        AOT_GOTO(0x061c, L061c);
+    AOT_GOTO(0x05f2, L05f2);
+L05f2:
+    AOT_BLOCK(0x05f2, 3);
+    // 05f2: clr r1
+    {
+        r[1] = 0;
+    }
+    // 05f4: cmp r0, $5c
+    {
+        src = r[0];
+        dst = uint16_t(0x005c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05f8: bne 0612
+    if (!Z)
+        AOT_GOTO(0x0612, L0612);
+    AOT_GOTO(0x05fa, L05fa);
+L05fa:
+    AOT_BLOCK(0x05fa, 1);
+    // 05fa: jsr pc, 0424
+    {
+        a = 0x0424;
+        r[6] -= 2;
+        WR16(r[6], 0x05fe);
+    }
+    AOT_GOTO(0x0424, L0424);
+L05fe:
+    AOT_BLOCK(0x05fe, 1);
+    // 05fe: mov $626, r2
+    {
+        src = uint16_t(0x0626);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0602, L0602);
+L0602:
+    AOT_BLOCK(0x0602, 2);
+    // 0602: cmpb (r2)+, r0
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        dst = uint8_t(r[0]);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0604: beq 060c
+    if (Z)
+        AOT_GOTO(0x060c, L060c);
+    AOT_GOTO(0x0606, L0606);
+L0606:
+    AOT_BLOCK(0x0606, 2);
+    // 0606: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0608: bpl 0602
+    if (!N)
+        AOT_GOTO(0x0602, L0602);
+    AOT_GOTO(0x060a, L060a);
+L060a:
+    AOT_BLOCK(0x060a, 1);
+    // 060a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L060c:
+    AOT_BLOCK(0x060c, 3);
+    // 060c: movb (r2)+, r0
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 060e: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0610: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0612:
+    AOT_BLOCK(0x0612, 2);
+    // 0612: cmp r0, $3e
+    {
+        src = r[0];
+        dst = uint16_t(0x003e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0616: bne 061a
+    if (!Z)
+        AOT_GOTO(0x061a, L061a);
+    AOT_GOTO(0x0618, L0618);
+L0618:
+    AOT_BLOCK(0x0618, 1);
+    // 0618: inc r1
+    {
+        val = int(int16_t(r[1])) + 1;
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x061a, L061a);
+L061a:
+    AOT_BLOCK(0x061a, 1);
+    // 061a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L061c:
+    AOT_BLOCK(0x061c, 1);
+    // 061c: jsr r5, 00cc
+    {
+        a = 0x00cc;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0620;
+    }
+    AOT_GOTO(0x00cc, L00cc);
+L0620:
+    // 0620: (undefined)
+    AOT_INTERP(0x0620);
+L0622:
+    AOT_BLOCK(0x0622, 1);
+    // 0622: jmp 0050
+    {
+        a = 0x0050;
+    }
+    AOT_GOTO(0x0050, L0050);
+L0700:
+    AOT_BLOCK(0x0700, 1);
+    // 0700: jsr pc, 0886
+    {
+        a = 0x0886;
+        r[6] -= 2;
+        WR16(r[6], 0x0704);
+    }
+    AOT_GOTO(0x0886, L0886);
+L0704:
+    AOT_BLOCK(0x0704, 1);
+    // 0704: jsr pc, 04e2
+    {
+        a = 0x04e2;
+        r[6] -= 2;
+        WR16(r[6], 0x0708);
+    }
+    AOT_GOTO(0x04e2, L04e2);
+L0708:
+    AOT_BLOCK(0x0708, 1);
+    // 0708: jsr pc, 08c2
+    {
+        a = 0x08c2;
+        r[6] -= 2;
+        WR16(r[6], 0x070c);
+    }
+    AOT_GOTO(0x08c2, L08c2);
+L070c:
+    AOT_BLOCK(0x070c, 2);
+    // 070c: add $2, 0ba4
+    {
+        src = uint16_t(0x0002);
+        b = 0x0ba4;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0712: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0800:
+    AOT_BLOCK(0x0800, 2);
+    // 0800: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0802: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0886:
+    AOT_BLOCK(0x0886, 1);
+    // 0886: jsr r5, 00cc
+    {
+        a = 0x00cc;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x088a;
+    }
+    AOT_GOTO(0x00cc, L00cc);
+L088a:
+    AOT_BLOCK(0x088a, 1);
+    // 088a: jmp -(r1)
+    {
+        r[1] -= 2;
+        a = r[1];
+    }
+    AOT_JUMP(a);
+L08c2:
+    AOT_BLOCK(0x08c2, 6);
+    // 08c2: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08c4: mov $2b, -(sp)
+    {
+        src = uint16_t(0x002b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08c8: clr 249a
+    {
+        a = 0x249a;
+        WR16(a, 0);
+    }
+    // 08cc: clr r2
+    {
+        r[2] = 0;
+        C = false;
+    }
+    // 08ce: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08d2: br 08d8
+    AOT_GOTO(0x08d8, L08d8);
+L08d4:
+    AOT_BLOCK(0x08d4, 1);
+    // 08d4: jsr pc, 04e2
+    {
+        a = 0x04e2;
+        r[6] -= 2;
+        WR16(r[6], 0x08d8);
+    }
+    AOT_GOTO(0x04e2, L04e2);
+L08d8:
+    AOT_BLOCK(0x08d8, 2);
+    // 08d8: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08da: jsr r5, 0126
+    {
+        a = 0x0126;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x08de;
+    }
+    AOT_GOTO(0x0126, L0126);
+L08de:
+    // 08de: halt
+    AOT_INTERP(0x08de);
+L08e0:
+    AOT_BLOCK(0x08e0, 1);
+    // 08e0: jmp *09e5
+    {
+        a = RD16(0x09e5);
+    }
+    AOT_JUMP(a);
+L09d0:
+    AOT_BLOCK(0x09d0, 1);
+    // 09d0: clr *-(r0)
+    {
+        r[0] -= 2;
+        a = RD16(r[0]);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 09d2: (undefined)
+    AOT_INTERP(0x09d2);
+L09d4:
+    AOT_BLOCK(0x09d4, 1);
+    // 09d4: jsr pc, *1e(r0)
+    {
+        a = RD16(r[0] + 30);
+        r[6] -= 2;
+        WR16(r[6], 0x09d8);
+    }
+    AOT_JUMP(a);
+L09d8:
+    AOT_BLOCK(0x09d8, 1);
+    // 09d8: jsr pc, *-(sp)
+    {
+        r[6] -= 2;
+        a = RD16(r[6]);
+        r[6] -= 2;
+        WR16(r[6], 0x09da);
+    }
+    AOT_JUMP(a);
+L09da:
+    // 09da: (undefined)
+    AOT_INTERP(0x09da);
+L09dc:
+    AOT_BLOCK(0x09dc, 1);
+    // 09dc: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 09de: (undefined)
+    AOT_INTERP(0x09de);
+L09e0:
+    AOT_BLOCK(0x09e0, 2);
+    // 09e0: com *(r4)+
+    {
+        a = RD16(r[4]);
+        r[4] += 2;
+        val = ~int(RD16(a));
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = true;
+        V = false;
+    }
+    // 09e2: jmp *(sp)+
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(a);
+L0a00:
+    AOT_BLOCK(0x0a00, 1);
+    // 0a00: br 0a68
+    AOT_GOTO(0x0a68, L0a68);
+L0a02:
+    AOT_BLOCK(0x0a02, 1);
+    // 0a02: jsr r5, 0a70
+    {
+        a = 0x0a70;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a06;
+    }
+    AOT_GOTO(0x0a70, L0a70);
+L0a06:
+    // 0a06: halt
+    AOT_INTERP(0x0a06);
+L0a08:
+    AOT_BLOCK(0x0a08, 6);
+    // 0a08: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a0a: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 0a0c: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0a0e: div (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0a10: mov r1, r2
+    {
+        src = r[1];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a12: br 0a68
+    AOT_GOTO(0x0a68, L0a68);
+L0a68:
+    AOT_BLOCK(0x0a68, 2);
+    // 0a68: mov $2b, (sp)
+    {
+        src = uint16_t(0x002b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a6c: jmp 08d4
+    {
+        a = 0x08d4;
+    }
+    AOT_GOTO(0x08d4, L08d4);
+L0a70:
+    AOT_BLOCK(0x0a70, 5);
+    // 0a70: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a72: bis r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0a74: bic $ffdf, (sp)
+    {
+        src = uint16_t(0xffdf);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0a78: bic $ffe0, r0
+    {
+        src = uint16_t(0xffe0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0a7c: bic $ffe0, r3
+    {
+        src = uint16_t(0xffe0);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a80, L0a80);
+L0a80:
+    AOT_BLOCK(0x0a80, 2);
+    // 0a80: cmp r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a82: ble 0a8a
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0a8a, L0a8a);
+    AOT_GOTO(0x0a84, L0a84);
+L0a84:
+    AOT_BLOCK(0x0a84, 3);
+    // 0a84: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a86: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 0a88: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a8a, L0a8a);
+L0a8a:
+    AOT_BLOCK(0x0a8a, 2);
+    // 0a8a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a8c: beq 0a9c
+    if (Z)
+        AOT_GOTO(0x0a9c, L0a9c);
+    AOT_GOTO(0x0a8e, L0a8e);
+L0a8e:
+    AOT_BLOCK(0x0a8e, 2);
+    // 0a8e: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a90: beq 0aa0
+    if (Z)
+        AOT_GOTO(0x0aa0, L0aa0);
+    AOT_GOTO(0x0a92, L0a92);
+L0a92:
+    AOT_BLOCK(0x0a92, 2);
+    // 0a92: cmp r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a94: bne 0aa0
+    if (!Z)
+        AOT_GOTO(0x0aa0, L0aa0);
+    AOT_GOTO(0x0a96, L0a96);
+L0a96:
+    AOT_BLOCK(0x0a96, 2);
+    // 0a96: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a9a: br 0aa0
+    AOT_GOTO(0x0aa0, L0aa0);
+L0a9c:
+    AOT_BLOCK(0x0a9c, 2);
+    // 0a9c: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0a9e: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0aa0, L0aa0);
+L0aa0:
+    AOT_BLOCK(0x0aa0, 2);
+    // 0aa0: bis (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0aa2: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ac0:
+    // 0ac0: (undefined)
+    AOT_INTERP(0x0ac0);
+L0ac2:
+    // 0ac2: (undefined)
+    AOT_INTERP(0x0ac2);
+L0ac4:
+    // 0ac4: (undefined)
+    AOT_INTERP(0x0ac4);
+L0ac6:
+    // 0ac6: (undefined)
+    AOT_INTERP(0x0ac6);
+L0ac8:
+    // 0ac8: (undefined)
+    AOT_INTERP(0x0ac8);
+L0aca:
+    // 0aca: (undefined)
+    AOT_INTERP(0x0aca);
+L0acc:
+    // 0acc: (undefined)
+    AOT_INTERP(0x0acc);
+L0ace:
+    // 0ace: (undefined)
+    AOT_INTERP(0x0ace);
+L0ad0:
+    // 0ad0: (undefined)
+    AOT_INTERP(0x0ad0);
+L0ad2:
+    // 0ad2: (undefined)
+    AOT_INTERP(0x0ad2);
+L0ad4:
+    AOT_BLOCK(0x0ad4, 3);
+    // 0ad4: bit r4, 3332(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 13106);
+        dst = RD16(b);
+        val = src & dst;
+    }
+    // 0ad8: bit (r4)+, 3736(r4)
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = uint16_t(r[4] + 14134);
+        dst = RD16(b);
+        val = src & dst;
+    }
+    // 0adc: bit -(r4), *-110(r0)
+    {
+        r[4] -= 2;
+        a = r[4];
+        src = RD16(a);
+        b = RD16(r[0] + -272);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0ae0: (undefined)
+    AOT_INTERP(0x0ae0);
+L0ae2:
+    // 0ae2: (undefined)
+    AOT_INTERP(0x0ae2);
+L0ae4:
+    AOT_BLOCK(0x0ae4, 11);
+    // 0ae4: bic pc, 4342(r4)
+    {
+        src = uint16_t(0x0ae6);
+        b = uint16_t(r[4] + 17218);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0ae8: bic (r5)+, r4
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 0aea: bic *(r5)+, sp
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        dst = r[6];
+        val = (~src) & dst;
+        r[6] = val;
+    }
+    // 0aec: bic -(r5), (r0)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0aee: bic *-(r5), (r2)
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        b = r[2];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0af0: bic 4f4e(r5), (r4)
+    {
+        a = uint16_t(r[5] + 20302);
+        src = RD16(a);
+        b = r[4];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0af4: bis r5, (r0)+
+    {
+        src = r[5];
+        b = r[0];
+        r[0] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0af6: bis (r5), (r2)+
+    {
+        a = r[5];
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0af8: bis (r5)+, (r4)+
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0afa: bis *(r5)+, (sp)+
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0afc: bis -(r5), *(r0)+
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0afe: (undefined)
+    AOT_INTERP(0x0afe);
+L0b00:
+    // 0b00: (undefined)
+    AOT_INTERP(0x0b00);
+L0b02:
+    AOT_BLOCK(0x0b02, 9);
+    // 0b02: bis *6cfa, 6362(r0)
+    {
+        a = RD16(0x6cfa);
+        src = RD16(a);
+        b = uint16_t(r[0] + 25442);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0b08: add (r5)+, -(r4)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0b0a: add *(r5)+, -(sp)
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0b0c: add -(r5), *-(r0)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0b0e: add *-(r5), *-(r2)
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0b10: add 6f6e(r5), *-(r4)
+    {
+        a = uint16_t(r[5] + 28526);
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0b14: mul 7372(r0), r5
+    {
+        a = uint16_t(r[0] + 29554);
+        src = int16_t(RD16(a));
+        val = int(r[5]) * src;
+        r[5] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 0b18: ash 7776(r4), r5
+    {
+        a = uint16_t(r[4] + 30582);
+        src = RD16(a) & 077;
+        val16 = r[5];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0b1c: xor r5, *-b86(r0)
+    {
+        src = r[5];
+        b = RD16(r[0] + -2950);
+        val = src ^ RD16(b);
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b20: (undefined)
+    AOT_INTERP(0x0b20);
+L0b22:
+    // 0b22: (undefined)
+    AOT_INTERP(0x0b22);
+L0b24:
+    // 0b24: sys 4
+    AOT_INTERP(0x0b24);
+L0b26:
+    AOT_BLOCK(0x0b26, 1);
+    // 0b26: cmp (r2)+, -(r4)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0b28, L0b28);
+L0b28:
+    // 0b28: halt
+    AOT_INTERP(0x0b28);
+L0b2a:
+    AOT_BLOCK(0x0b2a, 1);
+    // 0b2a: jmp *(sp)+
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(a);
+L0b2c:
+    AOT_BLOCK(0x0b2c, 1);
+    // 0b2c: adc -(r1)
+    {
+        r[1] -= 2;
+        a = r[1];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0b2e, L0b2e);
+L0b2e:
+    AOT_BLOCK(0x0b2e, 2);
+    // 0b2e: adc *-(r4)
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        C = C && val == 0;
+    }
+    // 0b30: adc 0b9b
+    {
+        a = 0x0b9b;
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    // 0b34: halt
+    AOT_INTERP(0x0b34);
+L0b36:
+    // 0b36: sys 4
+    AOT_INTERP(0x0b36);
+L0b38:
+    // 0b38: halt
+    AOT_INTERP(0x0b38);
+L0b3a:
+    // 0b3a: halt
+    AOT_INTERP(0x0b3a);
+L0b3c:
+    // 0b3c: sys 4
+    AOT_INTERP(0x0b3c);
+L0b3e:
+    // 0b3e: halt
+    AOT_INTERP(0x0b3e);
+L0b40:
+    // 0b40: rti
+    AOT_INTERP(0x0b40);
+L0b42:
+    // 0b42: sys 12
+    AOT_INTERP(0x0b42);
+L0b44:
+    // 0b44: halt
+    AOT_INTERP(0x0b44);
+L0b46:
+    AOT_BLOCK(0x0b46, 1);
+    // 0b46: cmp (r2), (sp)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0b48, L0b48);
+L0b48:
+    // 0b48: sys 8
+    AOT_INTERP(0x0b48);
+L0b4a:
+    // 0b4a: halt
+    AOT_INTERP(0x0b4a);
+L0b4c:
+    AOT_BLOCK(0x0b4c, 1);
+    // 0b4c: br 0b96
+    AOT_GOTO(0x0b96, L0b96);
+L0b4e:
+    AOT_BLOCK(0x0b4e, 1);
+    // 0b4e: cmp r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0b50, L0b50);
+L0b50:
+    AOT_BLOCK(0x0b50, 1);
+    // 0b50: xor r1, *7878(r0)
+    {
+        src = r[1];
+        b = RD16(r[0] + 30840);
+        val = src ^ RD16(b);
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b54: (undefined)
+    AOT_INTERP(0x0b54);
+L0b52:
+    AOT_BLOCK(0x0b52, 1);
+    // 0b52: xor r1, *a(r0)
+    {
+        src = r[1];
+        b = RD16(r[0] + 10);
+        val = src ^ RD16(b);
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b56, L0b56);
+L0b56:
+    // 0b56: sys 11
+    AOT_INTERP(0x0b56);
+L0b58:
+    AOT_BLOCK(0x0b58, 1);
+    // 0b58: cmp (r3)+, (r0)
+    {
+        a = r[3];
+        r[3] += 2;
+        src = RD16(a);
+        b = r[0];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0b5a, L0b5a);
+L0b5a:
+    // 0b5a: sys 5
+    AOT_INTERP(0x0b5a);
+L0b5c:
+    // 0b5c: halt
+    AOT_INTERP(0x0b5c);
+L0b5e:
+    // 0b5e: halt
+    AOT_INTERP(0x0b5e);
+L0b60:
+    AOT_BLOCK(0x0b60, 1);
+    // 0b60: cmp *6d74(r4), r0
+    {
+        a = RD16(r[4] + 28020);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0b64, L0b64);
+L0b62:
+    AOT_BLOCK(0x0b62, 3);
+    // 0b62: add 2f70(r5), 7461(r4)
+    {
+        a = uint16_t(r[5] + 12144);
+        src = RD16(a);
+        b = uint16_t(r[4] + 29793);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0b68: bit r5, *-(r5)
+    {
+        src = r[5];
+        r[5] -= 2;
+        b = RD16(r[5]);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b6a: jmp -(r1)
+    {
+        r[1] -= 2;
+        a = r[1];
+    }
+    AOT_JUMP(a);
+L0b64:
+    AOT_BLOCK(0x0b64, 2);
+    // 0b64: cmp *7461(r5), 316d(r0)
+    {
+        a = RD16(r[5] + 29793);
+        src = RD16(a);
+        b = uint16_t(r[0] + 12653);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b6a: jmp -(r1)
+    {
+        r[1] -= 2;
+        a = r[1];
+    }
+    AOT_JUMP(a);
+L0b96:
+    AOT_BLOCK(0x0b96, 2);
+    // 0b96: cmp (r2), (sp)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0b98: cmp (r2)+, -(r4)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b9a: (undefined)
+    AOT_INTERP(0x0b9a);
+L0b9c:
+    // 0b9c: halt
+    AOT_INTERP(0x0b9c);
+L0b9e:
+    // 0b9e: halt
+    AOT_INTERP(0x0b9e);
+L0ba0:
+    // 0ba0: halt
+    AOT_INTERP(0x0ba0);
+L0ba2:
+    // 0ba2: rti
+    AOT_INTERP(0x0ba2);
+L0ba4:
+    // 0ba4: halt
+    AOT_INTERP(0x0ba4);
+L0ba6:
+    AOT_BLOCK(0x0ba6, 1);
+    // 0ba6: cmp *0(r0), *-(sp)
+    {
+        a = RD16(r[0] + 0);
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0baa: halt
+    AOT_INTERP(0x0baa);
+L0bac:
+    // 0bac: halt
+    AOT_INTERP(0x0bac);
+L0bae:
+    // 0bae: wait
+    AOT_INTERP(0x0bae);
+L0bb0:
+    // 0bb0: halt
+    AOT_INTERP(0x0bb0);
+L0bb2:
+    AOT_BLOCK(0x0bb2, 1);
+    // 0bb2: bit r1, 0(r2)
+    {
+        src = r[1];
+        b = uint16_t(r[2] + 0);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0bb6: halt
+    AOT_INTERP(0x0bb6);
+L0bb8:
+    // 0bb8: halt
+    AOT_INTERP(0x0bb8);
+L0bba:
+    // 0bba: (undefined)
+    AOT_INTERP(0x0bba);
+L0bbc:
+    // 0bbc: halt
+    AOT_INTERP(0x0bbc);
+L0bbe:
+    AOT_BLOCK(0x0bbe, 1);
+    // 0bbe: bit r5, 0(r2)
+    {
+        src = r[5];
+        b = uint16_t(r[2] + 0);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0bc2: halt
+    AOT_INTERP(0x0bc2);
+L0bc4:
+    // 0bc4: halt
+    AOT_INTERP(0x0bc4);
+L0bc6:
+    // 0bc6: (undefined)
+    AOT_INTERP(0x0bc6);
+L0bc8:
+    // 0bc8: wait
+    AOT_INTERP(0x0bc8);
+L0bca:
+    AOT_BLOCK(0x0bca, 1);
+    // 0bca: bit (r1), 0(r2)
+    {
+        a = r[1];
+        src = RD16(a);
+        b = uint16_t(r[2] + 0);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0bce: halt
+    AOT_INTERP(0x0bce);
+L0bd0:
+    // 0bd0: halt
+    AOT_INTERP(0x0bd0);
+L0bd2:
+    // 0bd2: (undefined)
+    AOT_INTERP(0x0bd2);
+L0bd4:
+    // 0bd4: rti
+    AOT_INTERP(0x0bd4);
+L0bd6:
+    AOT_BLOCK(0x0bd6, 1);
+    // 0bd6: bit (r5), 0(r2)
+    {
+        a = r[5];
+        src = RD16(a);
+        b = uint16_t(r[2] + 0);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0bda: halt
+    AOT_INTERP(0x0bda);
+L0bdc:
+    // 0bdc: halt
+    AOT_INTERP(0x0bdc);
+L0bde:
+    // 0bde: (undefined)
+    AOT_INTERP(0x0bde);
+L0be0:
+    // 0be0: bpt
+    AOT_INTERP(0x0be0);
+L0be2:
+    AOT_BLOCK(0x0be2, 1);
+    // 0be2: bit (r1)+, 0(r2)
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        b = uint16_t(r[2] + 0);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0be6: halt
+    AOT_INTERP(0x0be6);
+L0be8:
+    // 0be8: halt
+    AOT_INTERP(0x0be8);
+L0bea:
+    // 0bea: (undefined)
+    AOT_INTERP(0x0bea);
+L0bec:
+    // 0bec: iot
+    AOT_INTERP(0x0bec);
+L0bee:
+    AOT_BLOCK(0x0bee, 1);
+    // 0bee: bit (r5)+, 0(r2)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        b = uint16_t(r[2] + 0);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0bf2: halt
+    AOT_INTERP(0x0bf2);
+L0bf4:
+    // 0bf4: halt
+    AOT_INTERP(0x0bf4);
+L0bf6:
+    // 0bf6: (undefined)
+    AOT_INTERP(0x0bf6);
+L0bf8:
+    // 0bf8: reset
+    AOT_INTERP(0x0bf8);
+L0bfa:
+    AOT_BLOCK(0x0bfa, 1);
+    // 0bfa: mul 0(r3), r1
+    {
+        a = uint16_t(r[3] + 0);
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val < -0x8000 || val >= 0x8000;
+        V = false;
+    }
+    // 0bfe: halt
+    AOT_INTERP(0x0bfe);
+L0c00:
+    // 0c00: halt
+    AOT_INTERP(0x0c00);
+L0c02:
+    // 0c02: (undefined)
+    AOT_INTERP(0x0c02);
+L0c04:
+    // 0c04: rtt
+    AOT_INTERP(0x0c04);
+L0c06:
+    AOT_BLOCK(0x0c06, 1);
+    // 0c06: add (r5), 0(r0)
+    {
+        a = r[5];
+        src = RD16(a);
+        b = uint16_t(r[0] + 0);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0c0a: halt
+    AOT_INTERP(0x0c0a);
+L0c0c:
+    // 0c0c: halt
+    AOT_INTERP(0x0c0c);
+L0c0e:
+    // 0c0e: (undefined)
+    AOT_INTERP(0x0c0e);
+L0c10:
+    // 0c10: (undefined)
+    AOT_INTERP(0x0c10);
+L0c12:
+    AOT_BLOCK(0x0c12, 2);
+    // 0c12: xor r1, -(r5)
+    {
+        src = r[1];
+        r[5] -= 2;
+        b = r[5];
+        val = src ^ RD16(b);
+        WR16(b, val);
+    }
+    // 0c14: ash *-(r1), r1
+    {
+        r[1] -= 2;
+        a = RD16(r[1]);
+        src = RD16(a) & 077;
+        val16 = r[1];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0c16: halt
+    AOT_INTERP(0x0c16);
+L0c18:
+    // 0c18: halt
+    AOT_INTERP(0x0c18);
+L0c1a:
+    // 0c1a: wait
+    AOT_INTERP(0x0c1a);
+L0c1c:
+    // 0c1c: wait
+    AOT_INTERP(0x0c1c);
+L0c1e:
+    AOT_BLOCK(0x0c1e, 1);
+    // 0c1e: add *6b72(r5), -(sp)
+    {
+        a = RD16(r[5] + 27506);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0c22: halt
+    AOT_INTERP(0x0c22);
+L0c24:
+    // 0c24: halt
+    AOT_INTERP(0x0c24);
+L0c26:
+    // 0c26: wait
+    AOT_INTERP(0x0c26);
+L0c28:
+    // 0c28: rti
+    AOT_INTERP(0x0c28);
+L0c2a:
+    AOT_BLOCK(0x0c2a, 1);
+    // 0c2a: add (r5)+, 6461(r2)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        b = uint16_t(r[2] + 25697);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0c2e: halt
+    AOT_INTERP(0x0c2e);
+L0c30:
+    // 0c30: halt
+    AOT_INTERP(0x0c30);
+L0c32:
+    // 0c32: wait
+    AOT_INTERP(0x0c32);
+L0c34:
+    // 0c34: bpt
+    AOT_INTERP(0x0c34);
+L0c36:
+    AOT_BLOCK(0x0c36, 2);
+    // 0c36: div 80a3, r1
+    {
+        a = 0x80a3;
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[1])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[1]) << 16) | r[2];
+        dst = val / src;
+        r[1] = dst;
+        r[2] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0c3a: jmp -(r5)
+    {
+        r[5] -= 2;
+        a = r[5];
+    }
+    AOT_JUMP(a);
+L13fe:
+    // 13fe: sys 30
+    AOT_INTERP(0x13fe);
+L1400:
+    // 1400: rti
+    AOT_INTERP(0x1400);
+L1402:
+    // 1402: wait
+    AOT_INTERP(0x1402);
+L1404:
+    AOT_BLOCK(0x1404, 1);
+    // 1404: ror r0
+    {
+        src = r[0];
+        val = (src >> 1) | (C ? 0x8000 : 0);
+        dst = C;
+        r[0] = val;
+        Z = val == 0;
+        N = dst;
+        C = (src & 1) != 0;
+        V = dst != ((src & 1) != 0);
+    }
+    AOT_GOTO(0x1406, L1406);
+L1406:
+    AOT_BLOCK(0x1406, 1);
+    // 1406: bcs 140e
+    if (C)
+        AOT_GOTO(0x140e, L140e);
+    AOT_GOTO(0x1408, L1408);
+L1408:
+    // 1408: sys 30
+    AOT_INTERP(0x1408);
+L140a:
+    // 140a: rti
+    AOT_INTERP(0x140a);
+L140c:
+    AOT_BLOCK(0x140c, 1);
+    // 140c: jmp (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+    }
+    AOT_JUMP(a);
+L140e:
+    AOT_BLOCK(0x140e, 1);
+    // 140e: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1410, L1410);
+L1410:
+    AOT_BLOCK(0x1410, 1);
+    // 1410: mov (r5)+, r0
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1412, L1412);
+L1412:
+    AOT_BLOCK(0x1412, 2);
+    // 1412: cmpb *2(r5), $2d
+    {
+        a = RD16(r[5] + 2);
+        src = RD8(a);
+        dst = uint8_t(0x2d);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1418: bne 1420
+    if (!Z)
+        AOT_GOTO(0x1420, L1420);
+    AOT_GOTO(0x141a, L141a);
+L141a:
+    AOT_BLOCK(0x141a, 3);
+    // 141a: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 141c: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 141e: br 1424
+    AOT_GOTO(0x1424, L1424);
+L1420:
+    AOT_BLOCK(0x1420, 1);
+    // 1420: clr 0b32
+    {
+        a = 0x0b32;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1424, L1424);
+L1424:
+    AOT_BLOCK(0x1424, 3);
+    // 1424: movb r0, 2496
+    {
+        src = uint8_t(r[0]);
+        b = 0x2496;
+        WR8(b, src);
+    }
+    // 1428: mov r5, 2498
+    {
+        src = r[5];
+        b = 0x2498;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 142c: jsr r5, 009a
+    {
+        a = 0x009a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1430;
+    }
+    AOT_GOTO(0x009a, L009a);
+L1430:
+    AOT_BLOCK(0x1430, 3);
+    // 1430: adc -(r1)
+    {
+        r[1] -= 2;
+        a = r[1];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        C = C && val == 0;
+    }
+    // 1432: movb r0, 227c
+    {
+        src = uint8_t(r[0]);
+        b = 0x227c;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1436: jsr r5, 009a
+    {
+        a = 0x009a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x143a;
+    }
+    AOT_GOTO(0x009a, L009a);
+L143a:
+    AOT_BLOCK(0x143a, 3);
+    // 143a: adc *-(r4)
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        C = C && val == 0;
+    }
+    // 143c: movb r0, 227f
+    {
+        src = uint8_t(r[0]);
+        b = 0x227f;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1440: jsr pc, 1448
+    {
+        a = 0x1448;
+        r[6] -= 2;
+        WR16(r[6], 0x1444);
+    }
+    AOT_GOTO(0x1448, L1448);
+L1444:
+    AOT_BLOCK(0x1444, 1);
+    // 1444: jmp 0004
+    {
+        a = 0x0004;
+    }
+    AOT_GOTO(0x0004, L0004);
+L1448:
+    AOT_BLOCK(0x1448, 1);
+    // 1448: mov $b9a, r1
+    {
+        src = uint16_t(0x0b9a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x144c, L144c);
+L144c:
+    AOT_BLOCK(0x144c, 3);
+    // 144c: clr r3
+    {
+        r[3] = 0;
+        C = false;
+    }
+    // 144e: mov $8, r2
+    {
+        src = uint16_t(0x0008);
+        r[2] = src;
+    }
+    // 1452: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1454, L1454);
+L1454:
+    AOT_BLOCK(0x1454, 2);
+    // 1454: movb (r1)+, r4
+    {
+        a = r[1];
+        r[1] += 1;
+        src = RD8(a);
+        r[4] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1456: beq 145e
+    if (Z)
+        AOT_GOTO(0x145e, L145e);
+    AOT_GOTO(0x1458, L1458);
+L1458:
+    AOT_BLOCK(0x1458, 3);
+    // 1458: add r4, r3
+    {
+        src = r[4];
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 145a: swab r3
+    {
+        src = r[3];
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = false;
+        V = false;
+    }
+    // 145c: sob r2, 5
+    {
+        r[2]--;
+    }
+    if (r[2] != 0)
+        AOT_GOTO(0x1454, L1454);
+    AOT_GOTO(0x145e, L145e);
+L145e:
+    AOT_BLOCK(0x145e, 4);
+    // 145e: clr r2
+    {
+        r[2] = 0;
+    }
+    // 1460: div $611, r2
+    {
+        src = int16_t(uint16_t(0x0611));
+        if (src == 0 || abs(int16_t(r[2])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[2]) << 16) | r[3];
+        dst = val / src;
+        r[2] = dst;
+        r[3] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1464: ashc $1, r2
+    {
+        src = uint16_t(0x0001) & 077;
+        val = int32_t((uint32_t(r[2]) << 16) | r[3]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[2] = uint32_t(val2) >> 16;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[2] = uint32_t(val2) >> 16;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 1468: add $165a, r3
+    {
+        src = uint16_t(0x165a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x146c, L146c);
+L146c:
+    AOT_BLOCK(0x146c, 3);
+    // 146c: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 146e: cmp r3, $165a
+    {
+        src = r[3];
+        dst = uint16_t(0x165a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1472: bhi 1478
+    if (!(C | Z))
+        AOT_GOTO(0x1478, L1478);
+    AOT_GOTO(0x1474, L1474);
+L1474:
+    AOT_BLOCK(0x1474, 1);
+    // 1474: add $c22, r3
+    {
+        src = uint16_t(0x0c22);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1478, L1478);
+L1478:
+    AOT_BLOCK(0x1478, 2);
+    // 1478: tst -(r3)
+    {
+        r[3] -= 2;
+        a = r[3];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 147a: bne 146c
+    if (!Z)
+        AOT_GOTO(0x146c, L146c);
+    AOT_GOTO(0x147c, L147c);
+L147c:
+    AOT_BLOCK(0x147c, 5);
+    // 147c: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 147e: mov r1, (r3)
+    {
+        src = r[1];
+        b = r[3];
+        WR16(b, src);
+    }
+    // 1480: add $c, r1
+    {
+        src = uint16_t(0x000c);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 1484: cmp r1, $13fe
+    {
+        src = r[1];
+        dst = uint16_t(0x13fe);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1488: bcs 144c
+    if (C)
+        AOT_GOTO(0x144c, L144c);
+    AOT_GOTO(0x148a, L148a);
+L148a:
+    AOT_BLOCK(0x148a, 1);
+    // 148a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("v6/bin/as", 0x0000, 5704, 0xce09035bu, run);
+}
@@ -0,0 +1,16525 @@
+// v6/bin/cc translated by 7aot: 838 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x0010: goto L0010;
+        case 0x0016: goto L0016;
+        case 0x0018: goto L0018;
+        case 0x001a: goto L001a;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0020: goto L0020;
+        case 0x002a: goto L002a;
+        case 0x0032: goto L0032;
+        case 0x0036: goto L0036;
+        case 0x003a: goto L003a;
+        case 0x0042: goto L0042;
+        case 0x0046: goto L0046;
+        case 0x0058: goto L0058;
+        case 0x005c: goto L005c;
+        case 0x0066: goto L0066;
+        case 0x006c: goto L006c;
+        case 0x006e: goto L006e;
+        case 0x0070: goto L0070;
+        case 0x0074: goto L0074;
+        case 0x0078: goto L0078;
+        case 0x007a: goto L007a;
+        case 0x0080: goto L0080;
+        case 0x008c: goto L008c;
+        case 0x0090: goto L0090;
+        case 0x0096: goto L0096;
+        case 0x00aa: goto L00aa;
+        case 0x00bc: goto L00bc;
+        case 0x00c4: goto L00c4;
+        case 0x00d0: goto L00d0;
+        case 0x00d2: goto L00d2;
+        case 0x00e6: goto L00e6;
+        case 0x00ec: goto L00ec;
+        case 0x0100: goto L0100;
+        case 0x0106: goto L0106;
+        case 0x011a: goto L011a;
+        case 0x0120: goto L0120;
+        case 0x0124: goto L0124;
+        case 0x0136: goto L0136;
+        case 0x013a: goto L013a;
+        case 0x013e: goto L013e;
+        case 0x0140: goto L0140;
+        case 0x0156: goto L0156;
+        case 0x015c: goto L015c;
+        case 0x0178: goto L0178;
+        case 0x017e: goto L017e;
+        case 0x018a: goto L018a;
+        case 0x0190: goto L0190;
+        case 0x01a8: goto L01a8;
+        case 0x01ae: goto L01ae;
+        case 0x01b2: goto L01b2;
+        case 0x01b6: goto L01b6;
+        case 0x01bc: goto L01bc;
+        case 0x01c0: goto L01c0;
+        case 0x01c6: goto L01c6;
+        case 0x01ce: goto L01ce;
+        case 0x01d2: goto L01d2;
+        case 0x01dc: goto L01dc;
+        case 0x01e4: goto L01e4;
+        case 0x01ec: goto L01ec;
+        case 0x01f6: goto L01f6;
+        case 0x0202: goto L0202;
+        case 0x0208: goto L0208;
+        case 0x0212: goto L0212;
+        case 0x021e: goto L021e;
+        case 0x0226: goto L0226;
+        case 0x0232: goto L0232;
+        case 0x0234: goto L0234;
+        case 0x023c: goto L023c;
+        case 0x024e: goto L024e;
+        case 0x0260: goto L0260;
+        case 0x0270: goto L0270;
+        case 0x0278: goto L0278;
+        case 0x0282: goto L0282;
+        case 0x0288: goto L0288;
+        case 0x0290: goto L0290;
+        case 0x029a: goto L029a;
+        case 0x029e: goto L029e;
+        case 0x02a6: goto L02a6;
+        case 0x02aa: goto L02aa;
+        case 0x02b2: goto L02b2;
+        case 0x02c4: goto L02c4;
+        case 0x02c6: goto L02c6;
+        case 0x02d2: goto L02d2;
+        case 0x02e4: goto L02e4;
+        case 0x02ea: goto L02ea;
+        case 0x02f8: goto L02f8;
+        case 0x0302: goto L0302;
+        case 0x0306: goto L0306;
+        case 0x030c: goto L030c;
+        case 0x0310: goto L0310;
+        case 0x0316: goto L0316;
+        case 0x031e: goto L031e;
+        case 0x0330: goto L0330;
+        case 0x033c: goto L033c;
+        case 0x0340: goto L0340;
+        case 0x034c: goto L034c;
+        case 0x0352: goto L0352;
+        case 0x035a: goto L035a;
+        case 0x0372: goto L0372;
+        case 0x0384: goto L0384;
+        case 0x038a: goto L038a;
+        case 0x0396: goto L0396;
+        case 0x039c: goto L039c;
+        case 0x03ac: goto L03ac;
+        case 0x03b2: goto L03b2;
+        case 0x03b8: goto L03b8;
+        case 0x03be: goto L03be;
+        case 0x03e0: goto L03e0;
+        case 0x03ea: goto L03ea;
+        case 0x03f0: goto L03f0;
+        case 0x040e: goto L040e;
+        case 0x0416: goto L0416;
+        case 0x041e: goto L041e;
+        case 0x042a: goto L042a;
+        case 0x043e: goto L043e;
+        case 0x044c: goto L044c;
+        case 0x0458: goto L0458;
+        case 0x045e: goto L045e;
+        case 0x0466: goto L0466;
+        case 0x046a: goto L046a;
+        case 0x0476: goto L0476;
+        case 0x047c: goto L047c;
+        case 0x0484: goto L0484;
+        case 0x048a: goto L048a;
+        case 0x0490: goto L0490;
+        case 0x04ac: goto L04ac;
+        case 0x04b4: goto L04b4;
+        case 0x04d0: goto L04d0;
+        case 0x04d6: goto L04d6;
+        case 0x04e8: goto L04e8;
+        case 0x0508: goto L0508;
+        case 0x0522: goto L0522;
+        case 0x052c: goto L052c;
+        case 0x0534: goto L0534;
+        case 0x0540: goto L0540;
+        case 0x0548: goto L0548;
+        case 0x054c: goto L054c;
+        case 0x0550: goto L0550;
+        case 0x055a: goto L055a;
+        case 0x0562: goto L0562;
+        case 0x056a: goto L056a;
+        case 0x0570: goto L0570;
+        case 0x0578: goto L0578;
+        case 0x0580: goto L0580;
+        case 0x0588: goto L0588;
+        case 0x0590: goto L0590;
+        case 0x0594: goto L0594;
+        case 0x0598: goto L0598;
+        case 0x05c8: goto L05c8;
+        case 0x05ce: goto L05ce;
+        case 0x05d6: goto L05d6;
+        case 0x05de: goto L05de;
+        case 0x05e4: goto L05e4;
+        case 0x05ec: goto L05ec;
+        case 0x05f4: goto L05f4;
+        case 0x061a: goto L061a;
+        case 0x0620: goto L0620;
+        case 0x063c: goto L063c;
+        case 0x0648: goto L0648;
+        case 0x0656: goto L0656;
+        case 0x0664: goto L0664;
+        case 0x0672: goto L0672;
+        case 0x0680: goto L0680;
+        case 0x068e: goto L068e;
+        case 0x06b8: goto L06b8;
+        case 0x06be: goto L06be;
+        case 0x06ca: goto L06ca;
+        case 0x06d0: goto L06d0;
+        case 0x06d4: goto L06d4;
+        case 0x06d8: goto L06d8;
+        case 0x06e0: goto L06e0;
+        case 0x06e6: goto L06e6;
+        case 0x06f2: goto L06f2;
+        case 0x06f4: goto L06f4;
+        case 0x06fc: goto L06fc;
+        case 0x0702: goto L0702;
+        case 0x0706: goto L0706;
+        case 0x070a: goto L070a;
+        case 0x0714: goto L0714;
+        case 0x0718: goto L0718;
+        case 0x0724: goto L0724;
+        case 0x0728: goto L0728;
+        case 0x072c: goto L072c;
+        case 0x0730: goto L0730;
+        case 0x073a: goto L073a;
+        case 0x073e: goto L073e;
+        case 0x0746: goto L0746;
+        case 0x074e: goto L074e;
+        case 0x0756: goto L0756;
+        case 0x075c: goto L075c;
+        case 0x0760: goto L0760;
+        case 0x0770: goto L0770;
+        case 0x0774: goto L0774;
+        case 0x0784: goto L0784;
+        case 0x078c: goto L078c;
+        case 0x0790: goto L0790;
+        case 0x0796: goto L0796;
+        case 0x079a: goto L079a;
+        case 0x079e: goto L079e;
+        case 0x07a2: goto L07a2;
+        case 0x07a8: goto L07a8;
+        case 0x07ae: goto L07ae;
+        case 0x07b4: goto L07b4;
+        case 0x07ba: goto L07ba;
+        case 0x07c0: goto L07c0;
+        case 0x07c4: goto L07c4;
+        case 0x07d0: goto L07d0;
+        case 0x07d4: goto L07d4;
+        case 0x07dc: goto L07dc;
+        case 0x07e2: goto L07e2;
+        case 0x07e8: goto L07e8;
+        case 0x07ee: goto L07ee;
+        case 0x07f4: goto L07f4;
+        case 0x07fa: goto L07fa;
+        case 0x0800: goto L0800;
+        case 0x0806: goto L0806;
+        case 0x0808: goto L0808;
+        case 0x080e: goto L080e;
+        case 0x0818: goto L0818;
+        case 0x081e: goto L081e;
+        case 0x082a: goto L082a;
+        case 0x0830: goto L0830;
+        case 0x0834: goto L0834;
+        case 0x0838: goto L0838;
+        case 0x0840: goto L0840;
+        case 0x0846: goto L0846;
+        case 0x084a: goto L084a;
+        case 0x0850: goto L0850;
+        case 0x0854: goto L0854;
+        case 0x0858: goto L0858;
+        case 0x085c: goto L085c;
+        case 0x0862: goto L0862;
+        case 0x0868: goto L0868;
+        case 0x086e: goto L086e;
+        case 0x0874: goto L0874;
+        case 0x087e: goto L087e;
+        case 0x0888: goto L0888;
+        case 0x088a: goto L088a;
+        case 0x0890: goto L0890;
+        case 0x0898: goto L0898;
+        case 0x089e: goto L089e;
+        case 0x08a6: goto L08a6;
+        case 0x08ac: goto L08ac;
+        case 0x08b4: goto L08b4;
+        case 0x08ba: goto L08ba;
+        case 0x08c2: goto L08c2;
+        case 0x08c8: goto L08c8;
+        case 0x08d0: goto L08d0;
+        case 0x08d6: goto L08d6;
+        case 0x08dc: goto L08dc;
+        case 0x08e2: goto L08e2;
+        case 0x08e8: goto L08e8;
+        case 0x08f0: goto L08f0;
+        case 0x08f4: goto L08f4;
+        case 0x08fc: goto L08fc;
+        case 0x0902: goto L0902;
+        case 0x0906: goto L0906;
+        case 0x090a: goto L090a;
+        case 0x090e: goto L090e;
+        case 0x0914: goto L0914;
+        case 0x0916: goto L0916;
+        case 0x091c: goto L091c;
+        case 0x0922: goto L0922;
+        case 0x0932: goto L0932;
+        case 0x0936: goto L0936;
+        case 0x093e: goto L093e;
+        case 0x0942: goto L0942;
+        case 0x0948: goto L0948;
+        case 0x094a: goto L094a;
+        case 0x0950: goto L0950;
+        case 0x0958: goto L0958;
+        case 0x095e: goto L095e;
+        case 0x0966: goto L0966;
+        case 0x096c: goto L096c;
+        case 0x0972: goto L0972;
+        case 0x097c: goto L097c;
+        case 0x0980: goto L0980;
+        case 0x0986: goto L0986;
+        case 0x098c: goto L098c;
+        case 0x0990: goto L0990;
+        case 0x0996: goto L0996;
+        case 0x099c: goto L099c;
+        case 0x09a0: goto L09a0;
+        case 0x09a6: goto L09a6;
+        case 0x09a8: goto L09a8;
+        case 0x09b2: goto L09b2;
+        case 0x09b6: goto L09b6;
+        case 0x09bc: goto L09bc;
+        case 0x09c2: goto L09c2;
+        case 0x09c6: goto L09c6;
+        case 0x09ca: goto L09ca;
+        case 0x09ce: goto L09ce;
+        case 0x09d6: goto L09d6;
+        case 0x09da: goto L09da;
+        case 0x09dc: goto L09dc;
+        case 0x09e4: goto L09e4;
+        case 0x09ec: goto L09ec;
+        case 0x09f8: goto L09f8;
+        case 0x09fe: goto L09fe;
+        case 0x0a0a: goto L0a0a;
+        case 0x0a0e: goto L0a0e;
+        case 0x0a14: goto L0a14;
+        case 0x0a18: goto L0a18;
+        case 0x0a1e: goto L0a1e;
+        case 0x0a22: goto L0a22;
+        case 0x0a28: goto L0a28;
+        case 0x0a2e: goto L0a2e;
+        case 0x0a34: goto L0a34;
+        case 0x0a3c: goto L0a3c;
+        case 0x0a40: goto L0a40;
+        case 0x0a44: goto L0a44;
+        case 0x0a54: goto L0a54;
+        case 0x0a64: goto L0a64;
+        case 0x0a70: goto L0a70;
+        case 0x0a74: goto L0a74;
+        case 0x0a82: goto L0a82;
+        case 0x0a8c: goto L0a8c;
+        case 0x0a98: goto L0a98;
+        case 0x0aac: goto L0aac;
+        case 0x0ab4: goto L0ab4;
+        case 0x0ac4: goto L0ac4;
+        case 0x0acc: goto L0acc;
+        case 0x0ad4: goto L0ad4;
+        case 0x0af0: goto L0af0;
+        case 0x0af8: goto L0af8;
+        case 0x0afc: goto L0afc;
+        case 0x0b00: goto L0b00;
+        case 0x0b04: goto L0b04;
+        case 0x0b08: goto L0b08;
+        case 0x0b10: goto L0b10;
+        case 0x0b16: goto L0b16;
+        case 0x0b1a: goto L0b1a;
+        case 0x0b22: goto L0b22;
+        case 0x0b28: goto L0b28;
+        case 0x0b2e: goto L0b2e;
+        case 0x0b32: goto L0b32;
+        case 0x0b34: goto L0b34;
+        case 0x0b38: goto L0b38;
+        case 0x0b3c: goto L0b3c;
+        case 0x0b40: goto L0b40;
+        case 0x0b48: goto L0b48;
+        case 0x0b4a: goto L0b4a;
+        case 0x0b52: goto L0b52;
+        case 0x0b5e: goto L0b5e;
+        case 0x0b64: goto L0b64;
+        case 0x0b68: goto L0b68;
+        case 0x0b70: goto L0b70;
+        case 0x0b74: goto L0b74;
+        case 0x0b78: goto L0b78;
+        case 0x0b7a: goto L0b7a;
+        case 0x0b7e: goto L0b7e;
+        case 0x0b82: goto L0b82;
+        case 0x0b94: goto L0b94;
+        case 0x0b9e: goto L0b9e;
+        case 0x0ba8: goto L0ba8;
+        case 0x0bb4: goto L0bb4;
+        case 0x0bba: goto L0bba;
+        case 0x0bc2: goto L0bc2;
+        case 0x0bca: goto L0bca;
+        case 0x0bd0: goto L0bd0;
+        case 0x0bdc: goto L0bdc;
+        case 0x0be6: goto L0be6;
+        case 0x0be8: goto L0be8;
+        case 0x0bec: goto L0bec;
+        case 0x0bf0: goto L0bf0;
+        case 0x0bf4: goto L0bf4;
+        case 0x0bf8: goto L0bf8;
+        case 0x0c0e: goto L0c0e;
+        case 0x0c16: goto L0c16;
+        case 0x0c1e: goto L0c1e;
+        case 0x0c3a: goto L0c3a;
+        case 0x0c3e: goto L0c3e;
+        case 0x0c44: goto L0c44;
+        case 0x0c48: goto L0c48;
+        case 0x0c4c: goto L0c4c;
+        case 0x0c58: goto L0c58;
+        case 0x0c5e: goto L0c5e;
+        case 0x0c68: goto L0c68;
+        case 0x0c6a: goto L0c6a;
+        case 0x0c6e: goto L0c6e;
+        case 0x0c70: goto L0c70;
+        case 0x0c84: goto L0c84;
+        case 0x0c90: goto L0c90;
+        case 0x0c98: goto L0c98;
+        case 0x0c9c: goto L0c9c;
+        case 0x0c9e: goto L0c9e;
+        case 0x0ca2: goto L0ca2;
+        case 0x0ca4: goto L0ca4;
+        case 0x0caa: goto L0caa;
+        case 0x0cb0: goto L0cb0;
+        case 0x0cba: goto L0cba;
+        case 0x0cbe: goto L0cbe;
+        case 0x0cc0: goto L0cc0;
+        case 0x0cc2: goto L0cc2;
+        case 0x0cc6: goto L0cc6;
+        case 0x0cca: goto L0cca;
+        case 0x0cdc: goto L0cdc;
+        case 0x0cec: goto L0cec;
+        case 0x0cee: goto L0cee;
+        case 0x0cfc: goto L0cfc;
+        case 0x0d1a: goto L0d1a;
+        case 0x0d22: goto L0d22;
+        case 0x0d24: goto L0d24;
+        case 0x0d30: goto L0d30;
+        case 0x0d40: goto L0d40;
+        case 0x0d46: goto L0d46;
+        case 0x0d4a: goto L0d4a;
+        case 0x0d52: goto L0d52;
+        case 0x0d54: goto L0d54;
+        case 0x0d56: goto L0d56;
+        case 0x0d5e: goto L0d5e;
+        case 0x0d64: goto L0d64;
+        case 0x0d6a: goto L0d6a;
+        case 0x0d6c: goto L0d6c;
+        case 0x0d70: goto L0d70;
+        case 0x0d78: goto L0d78;
+        case 0x0d7a: goto L0d7a;
+        case 0x0d82: goto L0d82;
+        case 0x0d8a: goto L0d8a;
+        case 0x0d98: goto L0d98;
+        case 0x0d9a: goto L0d9a;
+        case 0x0d9e: goto L0d9e;
+        case 0x0da8: goto L0da8;
+        case 0x0dac: goto L0dac;
+        case 0x0db2: goto L0db2;
+        case 0x0db6: goto L0db6;
+        case 0x0db8: goto L0db8;
+        case 0x0dba: goto L0dba;
+        case 0x0dc4: goto L0dc4;
+        case 0x0dca: goto L0dca;
+        case 0x0dd0: goto L0dd0;
+        case 0x0dd4: goto L0dd4;
+        case 0x0dd8: goto L0dd8;
+        case 0x0ddc: goto L0ddc;
+        case 0x0de8: goto L0de8;
+        case 0x0dec: goto L0dec;
+        case 0x0df0: goto L0df0;
+        case 0x0df6: goto L0df6;
+        case 0x0df8: goto L0df8;
+        case 0x0dfa: goto L0dfa;
+        case 0x0e04: goto L0e04;
+        case 0x0e08: goto L0e08;
+        case 0x0e14: goto L0e14;
+        case 0x0e1a: goto L0e1a;
+        case 0x0e26: goto L0e26;
+        case 0x0e34: goto L0e34;
+        case 0x0e3e: goto L0e3e;
+        case 0x0e40: goto L0e40;
+        case 0x0e48: goto L0e48;
+        case 0x0e50: goto L0e50;
+        case 0x0e56: goto L0e56;
+        case 0x0e60: goto L0e60;
+        case 0x0e66: goto L0e66;
+        case 0x0e68: goto L0e68;
+        case 0x0e76: goto L0e76;
+        case 0x0e7e: goto L0e7e;
+        case 0x0e86: goto L0e86;
+        case 0x0e92: goto L0e92;
+        case 0x0e94: goto L0e94;
+        case 0x0e98: goto L0e98;
+        case 0x0ea6: goto L0ea6;
+        case 0x0eaa: goto L0eaa;
+        case 0x0eb6: goto L0eb6;
+        case 0x0ec2: goto L0ec2;
+        case 0x0ec4: goto L0ec4;
+        case 0x0ec8: goto L0ec8;
+        case 0x0ecc: goto L0ecc;
+        case 0x0eda: goto L0eda;
+        case 0x0ee0: goto L0ee0;
+        case 0x0ee6: goto L0ee6;
+        case 0x0ef4: goto L0ef4;
+        case 0x0ef8: goto L0ef8;
+        case 0x0efe: goto L0efe;
+        case 0x0f00: goto L0f00;
+        case 0x0f04: goto L0f04;
+        case 0x0f08: goto L0f08;
+        case 0x0f0c: goto L0f0c;
+        case 0x0f12: goto L0f12;
+        case 0x0f18: goto L0f18;
+        case 0x0f1c: goto L0f1c;
+        case 0x0f26: goto L0f26;
+        case 0x0f2a: goto L0f2a;
+        case 0x0f32: goto L0f32;
+        case 0x0f34: goto L0f34;
+        case 0x0f38: goto L0f38;
+        case 0x0f4a: goto L0f4a;
+        case 0x0f5e: goto L0f5e;
+        case 0x0f60: goto L0f60;
+        case 0x0f6e: goto L0f6e;
+        case 0x0f78: goto L0f78;
+        case 0x0f86: goto L0f86;
+        case 0x0f8c: goto L0f8c;
+        case 0x0f96: goto L0f96;
+        case 0x0f9a: goto L0f9a;
+        case 0x0fa4: goto L0fa4;
+        case 0x0fa6: goto L0fa6;
+        case 0x0fae: goto L0fae;
+        case 0x0fb6: goto L0fb6;
+        case 0x0fba: goto L0fba;
+        case 0x0fc2: goto L0fc2;
+        case 0x0fc6: goto L0fc6;
+        case 0x0fd0: goto L0fd0;
+        case 0x0fde: goto L0fde;
+        case 0x0fe4: goto L0fe4;
+        case 0x0fec: goto L0fec;
+        case 0x0ff4: goto L0ff4;
+        case 0x0ff6: goto L0ff6;
+        case 0x1004: goto L1004;
+        case 0x100c: goto L100c;
+        case 0x1010: goto L1010;
+        case 0x1018: goto L1018;
+        case 0x101a: goto L101a;
+        case 0x102e: goto L102e;
+        case 0x1036: goto L1036;
+        case 0x1038: goto L1038;
+        case 0x103c: goto L103c;
+        case 0x104c: goto L104c;
+        case 0x1054: goto L1054;
+        case 0x105c: goto L105c;
+        case 0x1072: goto L1072;
+        case 0x1078: goto L1078;
+        case 0x107e: goto L107e;
+        case 0x1086: goto L1086;
+        case 0x1094: goto L1094;
+        case 0x109a: goto L109a;
+        case 0x109e: goto L109e;
+        case 0x10a4: goto L10a4;
+        case 0x10b2: goto L10b2;
+        case 0x10b4: goto L10b4;
+        case 0x10b6: goto L10b6;
+        case 0x10ba: goto L10ba;
+        case 0x10de: goto L10de;
+        case 0x10e2: goto L10e2;
+        case 0x10ec: goto L10ec;
+        case 0x10f2: goto L10f2;
+        case 0x10f8: goto L10f8;
+        case 0x1108: goto L1108;
+        case 0x1110: goto L1110;
+        case 0x1118: goto L1118;
+        case 0x111c: goto L111c;
+        case 0x1124: goto L1124;
+        case 0x112c: goto L112c;
+        case 0x1130: goto L1130;
+        case 0x1138: goto L1138;
+        case 0x113a: goto L113a;
+        case 0x1140: goto L1140;
+        case 0x1146: goto L1146;
+        case 0x114a: goto L114a;
+        case 0x1160: goto L1160;
+        case 0x1166: goto L1166;
+        case 0x116c: goto L116c;
+        case 0x1170: goto L1170;
+        case 0x117a: goto L117a;
+        case 0x1182: goto L1182;
+        case 0x1188: goto L1188;
+        case 0x118c: goto L118c;
+        case 0x1194: goto L1194;
+        case 0x119c: goto L119c;
+        case 0x11aa: goto L11aa;
+        case 0x11b6: goto L11b6;
+        case 0x11ba: goto L11ba;
+        case 0x11c4: goto L11c4;
+        case 0x11cc: goto L11cc;
+        case 0x11d4: goto L11d4;
+        case 0x11d6: goto L11d6;
+        case 0x11de: goto L11de;
+        case 0x11e2: goto L11e2;
+        case 0x11ec: goto L11ec;
+        case 0x11f4: goto L11f4;
+        case 0x1200: goto L1200;
+        case 0x120e: goto L120e;
+        case 0x1216: goto L1216;
+        case 0x1222: goto L1222;
+        case 0x1224: goto L1224;
+        case 0x122c: goto L122c;
+        case 0x1230: goto L1230;
+        case 0x123c: goto L123c;
+        case 0x1244: goto L1244;
+        case 0x1250: goto L1250;
+        case 0x125e: goto L125e;
+        case 0x1272: goto L1272;
+        case 0x1276: goto L1276;
+        case 0x127e: goto L127e;
+        case 0x1282: goto L1282;
+        case 0x1286: goto L1286;
+        case 0x1298: goto L1298;
+        case 0x129e: goto L129e;
+        case 0x12a2: goto L12a2;
+        case 0x12ae: goto L12ae;
+        case 0x12b6: goto L12b6;
+        case 0x12be: goto L12be;
+        case 0x12c6: goto L12c6;
+        case 0x12ce: goto L12ce;
+        case 0x12d4: goto L12d4;
+        case 0x12d8: goto L12d8;
+        case 0x12dc: goto L12dc;
+        case 0x12e8: goto L12e8;
+        case 0x12ec: goto L12ec;
+        case 0x12f4: goto L12f4;
+        case 0x12fc: goto L12fc;
+        case 0x1302: goto L1302;
+        case 0x1306: goto L1306;
+        case 0x130a: goto L130a;
+        case 0x1310: goto L1310;
+        case 0x1328: goto L1328;
+        case 0x132e: goto L132e;
+        case 0x1334: goto L1334;
+        case 0x1336: goto L1336;
+        case 0x133a: goto L133a;
+        case 0x133e: goto L133e;
+        case 0x1352: goto L1352;
+        case 0x1358: goto L1358;
+        case 0x1362: goto L1362;
+        case 0x1368: goto L1368;
+        case 0x136a: goto L136a;
+        case 0x136e: goto L136e;
+        case 0x137e: goto L137e;
+        case 0x1386: goto L1386;
+        case 0x138a: goto L138a;
+        case 0x1398: goto L1398;
+        case 0x139c: goto L139c;
+        case 0x13a0: goto L13a0;
+        case 0x13aa: goto L13aa;
+        case 0x13ae: goto L13ae;
+        case 0x13b2: goto L13b2;
+        case 0x13b4: goto L13b4;
+        case 0x13b8: goto L13b8;
+        case 0x13c0: goto L13c0;
+        case 0x13c2: goto L13c2;
+        case 0x13c6: goto L13c6;
+        case 0x13c8: goto L13c8;
+        case 0x13d4: goto L13d4;
+        case 0x13d8: goto L13d8;
+        case 0x13e2: goto L13e2;
+        case 0x13e6: goto L13e6;
+        case 0x13e8: goto L13e8;
+        case 0x13ec: goto L13ec;
+        case 0x13f0: goto L13f0;
+        case 0x13f8: goto L13f8;
+        case 0x13fc: goto L13fc;
+        case 0x1400: goto L1400;
+        case 0x1404: goto L1404;
+        case 0x140a: goto L140a;
+        case 0x140e: goto L140e;
+        case 0x1412: goto L1412;
+        case 0x1418: goto L1418;
+        case 0x141c: goto L141c;
+        case 0x1422: goto L1422;
+        case 0x1424: goto L1424;
+        case 0x142a: goto L142a;
+        case 0x142e: goto L142e;
+        case 0x143e: goto L143e;
+        case 0x1442: goto L1442;
+        case 0x1446: goto L1446;
+        case 0x1452: goto L1452;
+        case 0x1454: goto L1454;
+        case 0x1460: goto L1460;
+        case 0x1462: goto L1462;
+        case 0x146c: goto L146c;
+        case 0x1474: goto L1474;
+        case 0x1484: goto L1484;
+        case 0x148a: goto L148a;
+        case 0x148e: goto L148e;
+        case 0x1490: goto L1490;
+        case 0x1494: goto L1494;
+        case 0x149a: goto L149a;
+        case 0x149c: goto L149c;
+        case 0x14a0: goto L14a0;
+        case 0x14a4: goto L14a4;
+        case 0x14a8: goto L14a8;
+        case 0x14aa: goto L14aa;
+        case 0x14b2: goto L14b2;
+        case 0x14b8: goto L14b8;
+        case 0x14ca: goto L14ca;
+        case 0x14ce: goto L14ce;
+        case 0x14d4: goto L14d4;
+        case 0x14e0: goto L14e0;
+        case 0x14e6: goto L14e6;
+        case 0x14f0: goto L14f0;
+        case 0x14f4: goto L14f4;
+        case 0x14fa: goto L14fa;
+        case 0x14fe: goto L14fe;
+        case 0x1502: goto L1502;
+        case 0x1508: goto L1508;
+        case 0x1512: goto L1512;
+        case 0x1516: goto L1516;
+        case 0x1520: goto L1520;
+        case 0x1526: goto L1526;
+        case 0x152a: goto L152a;
+        case 0x1530: goto L1530;
+        case 0x153e: goto L153e;
+        case 0x1540: goto L1540;
+        case 0x1542: goto L1542;
+        case 0x1544: goto L1544;
+        case 0x1546: goto L1546;
+        case 0x1548: goto L1548;
+        case 0x154a: goto L154a;
+        case 0x1558: goto L1558;
+        case 0x155e: goto L155e;
+        case 0x1560: goto L1560;
+        case 0x156a: goto L156a;
+        case 0x156c: goto L156c;
+        case 0x156e: goto L156e;
+        case 0x1570: goto L1570;
+        case 0x1572: goto L1572;
+        case 0x1576: goto L1576;
+        case 0x1588: goto L1588;
+        case 0x158a: goto L158a;
+        case 0x158c: goto L158c;
+        case 0x158e: goto L158e;
+        case 0x1590: goto L1590;
+        case 0x1594: goto L1594;
+        case 0x15aa: goto L15aa;
+        case 0x15b4: goto L15b4;
+        case 0x15b6: goto L15b6;
+        case 0x15b8: goto L15b8;
+        case 0x15ba: goto L15ba;
+        case 0x15bc: goto L15bc;
+        case 0x15be: goto L15be;
+        case 0x15c2: goto L15c2;
+        case 0x15c4: goto L15c4;
+        case 0x15c6: goto L15c6;
+        case 0x15c8: goto L15c8;
+        case 0x15ca: goto L15ca;
+        case 0x15d0: goto L15d0;
+        case 0x15d4: goto L15d4;
+        case 0x15e0: goto L15e0;
+        case 0x15e2: goto L15e2;
+        case 0x15e4: goto L15e4;
+        case 0x15e6: goto L15e6;
+        case 0x15e8: goto L15e8;
+        case 0x15fa: goto L15fa;
+        case 0x1606: goto L1606;
+        case 0x160e: goto L160e;
+        case 0x1616: goto L1616;
+        case 0x161a: goto L161a;
+        case 0x161c: goto L161c;
+        case 0x1620: goto L1620;
+        case 0x1624: goto L1624;
+        case 0x162a: goto L162a;
+        case 0x1638: goto L1638;
+        case 0x1646: goto L1646;
+        case 0x164a: goto L164a;
+        case 0x1658: goto L1658;
+        case 0x166a: goto L166a;
+        case 0x166c: goto L166c;
+        case 0x166e: goto L166e;
+        case 0x1670: goto L1670;
+        case 0x1672: goto L1672;
+        case 0x1678: goto L1678;
+        case 0x167c: goto L167c;
+        case 0x168e: goto L168e;
+        case 0x1690: goto L1690;
+        case 0x1692: goto L1692;
+        case 0x1694: goto L1694;
+        case 0x1696: goto L1696;
+        case 0x169c: goto L169c;
+        case 0x16ae: goto L16ae;
+        case 0x16b0: goto L16b0;
+        case 0x16b2: goto L16b2;
+        case 0x16b4: goto L16b4;
+        case 0x16b6: goto L16b6;
+        case 0x16ba: goto L16ba;
+        case 0x16cc: goto L16cc;
+        case 0x16ce: goto L16ce;
+        case 0x16d0: goto L16d0;
+        case 0x16d2: goto L16d2;
+        case 0x16d4: goto L16d4;
+        case 0x1716: goto L1716;
+        case 0x1724: goto L1724;
+        case 0x1728: goto L1728;
+        case 0x172c: goto L172c;
+        case 0x173a: goto L173a;
+        case 0x1746: goto L1746;
+        case 0x1748: goto L1748;
+        case 0x175c: goto L175c;
+        case 0x1764: goto L1764;
+        case 0x1766: goto L1766;
+        case 0x1768: goto L1768;
+        case 0x176a: goto L176a;
+        case 0x176c: goto L176c;
+        case 0x176e: goto L176e;
+        case 0x1770: goto L1770;
+        case 0x1772: goto L1772;
+        case 0x1776: goto L1776;
+        case 0x177e: goto L177e;
+        case 0x178c: goto L178c;
+        case 0x17a4: goto L17a4;
+        case 0x17aa: goto L17aa;
+        case 0x17b6: goto L17b6;
+        case 0x17b8: goto L17b8;
+        case 0x17ba: goto L17ba;
+        case 0x17bc: goto L17bc;
+        case 0x17be: goto L17be;
+        case 0x17c0: goto L17c0;
+        case 0x17c2: goto L17c2;
+        case 0x17c4: goto L17c4;
+        case 0x17ca: goto L17ca;
+        case 0x17d0: goto L17d0;
+        case 0x188c: goto L188c;
+        case 0x1898: goto L1898;
+        case 0x189a: goto L189a;
+        case 0x189c: goto L189c;
+        case 0x189e: goto L189e;
+        case 0x18a0: goto L18a0;
+        case 0x18a6: goto L18a6;
+        case 0x18ae: goto L18ae;
+        case 0x18b2: goto L18b2;
+        case 0x18b4: goto L18b4;
+        case 0x18b6: goto L18b6;
+        case 0x18b8: goto L18b8;
+        case 0x18ba: goto L18ba;
+        case 0x18be: goto L18be;
+        case 0x18c2: goto L18c2;
+        case 0x18c6: goto L18c6;
+        case 0x18d0: goto L18d0;
+        case 0x18d2: goto L18d2;
+        case 0x18d4: goto L18d4;
+        case 0x18d6: goto L18d6;
+        case 0x18d8: goto L18d8;
+        case 0x18e2: goto L18e2;
+        case 0x18e6: goto L18e6;
+        case 0x18ec: goto L18ec;
+        case 0x18f2: goto L18f2;
+        case 0x18f8: goto L18f8;
+        case 0x18fe: goto L18fe;
+        case 0x1904: goto L1904;
+        case 0x190a: goto L190a;
+        case 0x1910: goto L1910;
+        case 0x191a: goto L191a;
+        case 0x1922: goto L1922;
+        case 0x1936: goto L1936;
+        case 0x193c: goto L193c;
+        case 0x194a: goto L194a;
+        case 0x1958: goto L1958;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: setd
+    AOT_GOTO(0x0002, L0002);
+L0002:
+    AOT_BLOCK(0x0002, 5);
+    // 0002: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+    }
+    // 0004: mov (r0), -(sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0006: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0008: mov r0, 2(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 000c: jsr pc, 0018
+    {
+        a = 0x0018;
+        r[6] -= 2;
+        WR16(r[6], 0x0010);
+    }
+    AOT_GOTO(0x0018, L0018);
+L0010:
+    AOT_BLOCK(0x0010, 2);
+    // 0010: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0012: jsr pc, *$18c6
+    {
+        a = 0x18c6;
+        r[6] -= 2;
+        WR16(r[6], 0x0016);
+    }
+    AOT_GOTO(0x18c6, L18c6);
+L0016:
+    // 0016: sys 1
+    AOT_INTERP(0x0016);
+L0018:
+    AOT_BLOCK(0x0018, 2);
+    // 0018: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x001c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x001c, L001c);
+L001a:
+    AOT_BLOCK(0x001a, 1);
+    // 001a: mov -(r4), -(r0)
+    {
+        r[4] -= 2;
+        a = r[4];
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x001c, L001c);
+L001c:
+    AOT_BLOCK(0x001c, 1);
+    // 001c: sub $10, sp
+    {
+        src = uint16_t(0x0010);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0020, L0020);
+L001e:
+    // 001e: (undefined)
+    AOT_INTERP(0x001e);
+L0020:
+    AOT_BLOCK(0x0020, 3);
+    // 0020: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 0022: mov r0, -16(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -22);
+        WR16(b, src);
+    }
+    // 0026: mov r0, -14(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x002a, L002a);
+L002a:
+    AOT_BLOCK(0x002a, 2);
+    // 002a: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 002e: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0032, L0032);
+L0032:
+    AOT_BLOCK(0x0032, 1);
+    // 0032: mov r0, -e(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0036, L0036);
+L0036:
+    AOT_BLOCK(0x0036, 1);
+    // 0036: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x003a, L003a);
+L003a:
+    AOT_BLOCK(0x003a, 2);
+    // 003a: cmp 4(r5), -e(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0040: bgt 0046
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0046, L0046);
+    AOT_GOTO(0x0042, L0042);
+L0042:
+    AOT_BLOCK(0x0042, 1);
+    // 0042: jmp *$01b6
+    {
+        a = 0x01b6;
+    }
+    AOT_GOTO(0x01b6, L01b6);
+L0046:
+    AOT_BLOCK(0x0046, 6);
+    // 0046: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 004a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 004c: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0050: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0052: cmpb $2d, (r0)
+    {
+        src = uint8_t(0x2d);
+        b = r[0];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0056: beq 005c
+    if (Z)
+        AOT_GOTO(0x005c, L005c);
+    AOT_GOTO(0x0058, L0058);
+L0058:
+    AOT_BLOCK(0x0058, 1);
+    // 0058: jmp *$0140
+    {
+        a = 0x0140;
+    }
+    AOT_GOTO(0x0140, L0140);
+L005c:
+    AOT_BLOCK(0x005c, 3);
+    // 005c: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0060: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0062: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0066, L0066);
+L0066:
+    AOT_BLOCK(0x0066, 2);
+    // 0066: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0068: movb 1(r0), r0
+    {
+        a = uint16_t(r[0] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x006c, L006c);
+L006c:
+    AOT_BLOCK(0x006c, 1);
+    // 006c: br 0124
+    AOT_GOTO(0x0124, L0124);
+L006e:
+    AOT_BLOCK(0x006e, 1);
+    // 006e: br 0140
+    AOT_GOTO(0x0140, L0140);
+L0070:
+    AOT_BLOCK(0x0070, 1);
+    // 0070: inc 299c
+    {
+        a = 0x299c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0074, L0074);
+L0074:
+    AOT_BLOCK(0x0074, 1);
+    // 0074: inc 299e
+    {
+        a = 0x299e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0078, L0078);
+L0078:
+    AOT_BLOCK(0x0078, 1);
+    // 0078: br 013e
+    AOT_GOTO(0x013e, L013e);
+L007a:
+    AOT_BLOCK(0x007a, 2);
+    // 007a: inc 29a0
+    {
+        a = 0x29a0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 007e: br 013e
+    AOT_GOTO(0x013e, L013e);
+L0080:
+    AOT_BLOCK(0x0080, 3);
+    // 0080: inc 29a2
+    {
+        a = 0x29a2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0084: mov $19d6, 1970
+    {
+        src = uint16_t(0x19d6);
+        b = 0x1970;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 008a: br 013e
+    AOT_GOTO(0x013e, L013e);
+L008c:
+    AOT_BLOCK(0x008c, 1);
+    // 008c: inc 299a
+    {
+        a = 0x299a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0090, L0090);
+L0090:
+    AOT_BLOCK(0x0090, 2);
+    // 0090: inc 299e
+    {
+        a = 0x299e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0094: br 013e
+    AOT_GOTO(0x013e, L013e);
+L0096:
+    AOT_BLOCK(0x0096, 4);
+    // 0096: mov $19e3, 1970
+    {
+        src = uint16_t(0x19e3);
+        b = 0x1970;
+        WR16(b, src);
+    }
+    // 009c: mov $19f0, 196a
+    {
+        src = uint16_t(0x19f0);
+        b = 0x196a;
+        WR16(b, src);
+    }
+    // 00a2: mov $19f9, 196c
+    {
+        src = uint16_t(0x19f9);
+        b = 0x196c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00a8: br 013e
+    AOT_GOTO(0x013e, L013e);
+L00aa:
+    AOT_BLOCK(0x00aa, 6);
+    // 00aa: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00ae: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 00b0: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 00b4: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00b6: tstb 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 00ba: bne 00c4
+    if (!Z)
+        AOT_GOTO(0x00c4, L00c4);
+    AOT_GOTO(0x00bc, L00bc);
+L00bc:
+    AOT_BLOCK(0x00bc, 2);
+    // 00bc: mov $1a02, 1970
+    {
+        src = uint16_t(0x1a02);
+        b = 0x1970;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00c2: br 00d0
+    AOT_GOTO(0x00d0, L00d0);
+L00c4:
+    AOT_BLOCK(0x00c4, 2);
+    // 00c4: mov $1a0e, 1970
+    {
+        src = uint16_t(0x1a0e);
+        b = 0x1970;
+        WR16(b, src);
+    }
+    // 00ca: mov $1, -14(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00d0, L00d0);
+L00d0:
+    AOT_BLOCK(0x00d0, 1);
+    // 00d0: br 013e
+    AOT_GOTO(0x013e, L013e);
+L00d2:
+    AOT_BLOCK(0x00d2, 6);
+    // 00d2: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00d6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 00d8: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 00dc: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00de: cmpb $30, 2(r0)
+    {
+        src = uint8_t(0x30);
+        b = uint16_t(r[0] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 00e4: bne 00ec
+    if (!Z)
+        AOT_GOTO(0x00ec, L00ec);
+    AOT_GOTO(0x00e6, L00e6);
+L00e6:
+    AOT_BLOCK(0x00e6, 1);
+    // 00e6: mov $1a1b, 196a
+    {
+        src = uint16_t(0x1a1b);
+        b = 0x196a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00ec, L00ec);
+L00ec:
+    AOT_BLOCK(0x00ec, 6);
+    // 00ec: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00f0: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 00f2: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 00f6: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00f8: cmpb $31, 2(r0)
+    {
+        src = uint8_t(0x31);
+        b = uint16_t(r[0] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 00fe: bne 0106
+    if (!Z)
+        AOT_GOTO(0x0106, L0106);
+    AOT_GOTO(0x0100, L0100);
+L0100:
+    AOT_BLOCK(0x0100, 1);
+    // 0100: mov $1a25, 196c
+    {
+        src = uint16_t(0x1a25);
+        b = 0x196c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0106, L0106);
+L0106:
+    AOT_BLOCK(0x0106, 6);
+    // 0106: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 010a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 010c: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0110: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0112: cmpb $32, 2(r0)
+    {
+        src = uint8_t(0x32);
+        b = uint16_t(r[0] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0118: bne 0120
+    if (!Z)
+        AOT_GOTO(0x0120, L0120);
+    AOT_GOTO(0x011a, L011a);
+L011a:
+    AOT_BLOCK(0x011a, 1);
+    // 011a: mov $1a2f, 196e
+    {
+        src = uint16_t(0x1a2f);
+        b = 0x196e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0120, L0120);
+L0120:
+    AOT_BLOCK(0x0120, 1);
+    // 0120: br 013e
+    AOT_GOTO(0x013e, L013e);
+L0124:
+    AOT_BLOCK(0x0124, 7);
+    // 0124: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0126: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0128: div $2, r0
+    {
+        src = int16_t(uint16_t(0x0002));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 012c: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 012e: add $1972, r1
+    {
+        src = uint16_t(0x1972);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0132: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 0134: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0136, L0136);
+L0136:
+    AOT_BLOCK(0x0136, 2);
+    // 0136: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0138: bne 0136
+    if (!Z)
+        AOT_GOTO(0x0136, L0136);
+    AOT_GOTO(0x013a, L013a);
+L013a:
+    AOT_BLOCK(0x013a, 1);
+    // 013a: jmp *14(r1)
+    {
+        a = RD16(r[1] + 20);
+    }
+    AOT_JUMP(a);
+L013e:
+    AOT_BLOCK(0x013e, 1);
+    // 013e: br 01b2
+    AOT_GOTO(0x01b2, L01b2);
+L0140:
+    AOT_BLOCK(0x0140, 6);
+    // 0140: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0144: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0146: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 014a: mov (r0), -8(r5)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 014e: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0152: jsr pc, *$0d9e
+    {
+        a = 0x0d9e;
+        r[6] -= 2;
+        WR16(r[6], 0x0156);
+    }
+    AOT_GOTO(0x0d9e, L0d9e);
+L0156:
+    AOT_BLOCK(0x0156, 2);
+    // 0156: cmp $63, r0
+    {
+        src = uint16_t(0x0063);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 015a: bne 017e
+    if (!Z)
+        AOT_GOTO(0x017e, L017e);
+    AOT_GOTO(0x015c, L015c);
+L015c:
+    AOT_BLOCK(0x015c, 7);
+    // 015c: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0160: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0162: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0166: mov -8(r5), 28d0(r0)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[0] + 10448);
+        WR16(b, src);
+    }
+    // 016c: mov $6f, (sp)
+    {
+        src = uint16_t(0x006f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0170: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0174: jsr pc, *$0ddc
+    {
+        a = 0x0ddc;
+        r[6] -= 2;
+        WR16(r[6], 0x0178);
+    }
+    AOT_GOTO(0x0ddc, L0ddc);
+L0178:
+    AOT_BLOCK(0x0178, 2);
+    // 0178: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 017a: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x017e, L017e);
+L017e:
+    AOT_BLOCK(0x017e, 3);
+    // 017e: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0182: mov $2934, -(sp)
+    {
+        src = uint16_t(0x2934);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0186: jsr pc, *$0ecc
+    {
+        a = 0x0ecc;
+        r[6] -= 2;
+        WR16(r[6], 0x018a);
+    }
+    AOT_GOTO(0x0ecc, L0ecc);
+L018a:
+    AOT_BLOCK(0x018a, 3);
+    // 018a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 018c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 018e: beq 01b2
+    if (Z)
+        AOT_GOTO(0x01b2, L01b2);
+    AOT_GOTO(0x0190, L0190);
+L0190:
+    AOT_BLOCK(0x0190, 6);
+    // 0190: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0194: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0196: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 019a: mov -8(r5), 2934(r0)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[0] + 10548);
+        WR16(b, src);
+    }
+    // 01a0: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01a4: jsr pc, *$0d9e
+    {
+        a = 0x0d9e;
+        r[6] -= 2;
+        WR16(r[6], 0x01a8);
+    }
+    AOT_GOTO(0x0d9e, L0d9e);
+L01a8:
+    AOT_BLOCK(0x01a8, 2);
+    // 01a8: cmp $6f, r0
+    {
+        src = uint16_t(0x006f);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01ac: bne 01b2
+    if (!Z)
+        AOT_GOTO(0x01b2, L01b2);
+    AOT_GOTO(0x01ae, L01ae);
+L01ae:
+    AOT_BLOCK(0x01ae, 1);
+    // 01ae: inc -16(r5)
+    {
+        a = uint16_t(r[5] + -22);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x01b2, L01b2);
+L01b2:
+    AOT_BLOCK(0x01b2, 1);
+    // 01b2: jmp *$0036
+    {
+        a = 0x0036;
+    }
+    AOT_GOTO(0x0036, L0036);
+L01b6:
+    AOT_BLOCK(0x01b6, 2);
+    // 01b6: tst -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 01ba: bne 01c0
+    if (!Z)
+        AOT_GOTO(0x01c0, L01c0);
+    AOT_GOTO(0x01bc, L01bc);
+L01bc:
+    AOT_BLOCK(0x01bc, 1);
+    // 01bc: jmp *$0484
+    {
+        a = 0x0484;
+    }
+    AOT_GOTO(0x0484, L0484);
+L01c0:
+    AOT_BLOCK(0x01c0, 2);
+    // 01c0: tst 299a
+    {
+        a = 0x299a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 01c4: bne 0212
+    if (!Z)
+        AOT_GOTO(0x0212, L0212);
+    AOT_GOTO(0x01c6, L01c6);
+L01c6:
+    AOT_BLOCK(0x01c6, 2);
+    // 01c6: mov $1a39, (sp)
+    {
+        src = uint16_t(0x1a39);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01ca: jsr pc, *$0eaa
+    {
+        a = 0x0eaa;
+        r[6] -= 2;
+        WR16(r[6], 0x01ce);
+    }
+    AOT_GOTO(0x0eaa, L0eaa);
+L01ce:
+    AOT_BLOCK(0x01ce, 1);
+    // 01ce: mov r0, 2478
+    {
+        src = r[0];
+        b = 0x2478;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x01d2, L01d2);
+L01d2:
+    AOT_BLOCK(0x01d2, 3);
+    // 01d2: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 01d4: mov 2478, -(sp)
+    {
+        a = 0x2478;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01d8: jsr pc, *$169c
+    {
+        a = 0x169c;
+        r[6] -= 2;
+        WR16(r[6], 0x01dc);
+    }
+    AOT_GOTO(0x169c, L169c);
+L01dc:
+    AOT_BLOCK(0x01dc, 3);
+    // 01dc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 01de: mov r0, -12(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01e2: blt 01f6
+    if (N ^ V)
+        AOT_GOTO(0x01f6, L01f6);
+    AOT_GOTO(0x01e4, L01e4);
+L01e4:
+    AOT_BLOCK(0x01e4, 2);
+    // 01e4: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01e8: jsr pc, *$1560
+    {
+        a = 0x1560;
+        r[6] -= 2;
+        WR16(r[6], 0x01ec);
+    }
+    AOT_GOTO(0x1560, L1560);
+L01ec:
+    AOT_BLOCK(0x01ec, 3);
+    // 01ec: mov 2478, r0
+    {
+        a = 0x2478;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01f0: incb 9(r0)
+    {
+        a = uint16_t(r[0] + 9);
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x80;
+    }
+    // 01f4: br 01d2
+    AOT_GOTO(0x01d2, L01d2);
+L01f6:
+    AOT_BLOCK(0x01f6, 3);
+    // 01f6: mov $100, (sp)
+    {
+        src = uint16_t(0x0100);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01fa: mov 2478, -(sp)
+    {
+        a = 0x2478;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01fe: jsr pc, *$1576
+    {
+        a = 0x1576;
+        r[6] -= 2;
+        WR16(r[6], 0x0202);
+    }
+    AOT_GOTO(0x1576, L1576);
+L0202:
+    AOT_BLOCK(0x0202, 3);
+    // 0202: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0204: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0206: bge 0212
+    if (!(N ^ V))
+        AOT_GOTO(0x0212, L0212);
+    AOT_GOTO(0x0208, L0208);
+L0208:
+    AOT_BLOCK(0x0208, 3);
+    // 0208: mov 2478, r0
+    {
+        a = 0x2478;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 020c: incb 9(r0)
+    {
+        a = uint16_t(r[0] + 9);
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x80;
+    }
+    // 0210: br 01f6
+    AOT_GOTO(0x01f6, L01f6);
+L0212:
+    AOT_BLOCK(0x0212, 3);
+    // 0212: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0216: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 021a: jsr pc, *$177e
+    {
+        a = 0x177e;
+        r[6] -= 2;
+        WR16(r[6], 0x021e);
+    }
+    AOT_GOTO(0x177e, L177e);
+L021e:
+    AOT_BLOCK(0x021e, 3);
+    // 021e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0220: bit $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0224: bne 0234
+    if (!Z)
+        AOT_GOTO(0x0234, L0234);
+    AOT_GOTO(0x0226, L0226);
+L0226:
+    AOT_BLOCK(0x0226, 3);
+    // 0226: mov $550, (sp)
+    {
+        src = uint16_t(0x0550);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 022a: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 022e: jsr pc, *$177e
+    {
+        a = 0x177e;
+        r[6] -= 2;
+        WR16(r[6], 0x0232);
+    }
+    AOT_GOTO(0x177e, L177e);
+L0232:
+    AOT_BLOCK(0x0232, 1);
+    // 0232: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0234, L0234);
+L0234:
+    AOT_BLOCK(0x0234, 2);
+    // 0234: mov 2478, (sp)
+    {
+        a = 0x2478;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0238: jsr pc, *$0eaa
+    {
+        a = 0x0eaa;
+        r[6] -= 2;
+        WR16(r[6], 0x023c);
+    }
+    AOT_GOTO(0x0eaa, L0eaa);
+L023c:
+    AOT_BLOCK(0x023c, 4);
+    // 023c: mov r0, 247a
+    {
+        src = r[0];
+        b = 0x247a;
+        WR16(b, src);
+    }
+    // 0240: movb $31, 8(r0)
+    {
+        src = uint8_t(0x31);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+    }
+    // 0246: mov 2478, (sp)
+    {
+        a = 0x2478;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 024a: jsr pc, *$0eaa
+    {
+        a = 0x0eaa;
+        r[6] -= 2;
+        WR16(r[6], 0x024e);
+    }
+    AOT_GOTO(0x0eaa, L0eaa);
+L024e:
+    AOT_BLOCK(0x024e, 4);
+    // 024e: mov r0, 247c
+    {
+        src = r[0];
+        b = 0x247c;
+        WR16(b, src);
+    }
+    // 0252: movb $32, 8(r0)
+    {
+        src = uint8_t(0x32);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+    }
+    // 0258: mov 2478, (sp)
+    {
+        a = 0x2478;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 025c: jsr pc, *$0eaa
+    {
+        a = 0x0eaa;
+        r[6] -= 2;
+        WR16(r[6], 0x0260);
+    }
+    AOT_GOTO(0x0eaa, L0eaa);
+L0260:
+    AOT_BLOCK(0x0260, 4);
+    // 0260: mov r0, 247e
+    {
+        src = r[0];
+        b = 0x247e;
+        WR16(b, src);
+    }
+    // 0264: movb $33, 8(r0)
+    {
+        src = uint8_t(0x33);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+    }
+    // 026a: tst 29a0
+    {
+        a = 0x29a0;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 026e: beq 0282
+    if (Z)
+        AOT_GOTO(0x0282, L0282);
+    AOT_GOTO(0x0270, L0270);
+L0270:
+    AOT_BLOCK(0x0270, 2);
+    // 0270: mov 2478, (sp)
+    {
+        a = 0x2478;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0274: jsr pc, *$0eaa
+    {
+        a = 0x0eaa;
+        r[6] -= 2;
+        WR16(r[6], 0x0278);
+    }
+    AOT_GOTO(0x0eaa, L0eaa);
+L0278:
+    AOT_BLOCK(0x0278, 2);
+    // 0278: mov r0, 2482
+    {
+        src = r[0];
+        b = 0x2482;
+        WR16(b, src);
+    }
+    // 027c: movb $35, 8(r0)
+    {
+        src = uint8_t(0x35);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0282, L0282);
+L0282:
+    AOT_BLOCK(0x0282, 2);
+    // 0282: tst 299a
+    {
+        a = 0x299a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0286: bne 029a
+    if (!Z)
+        AOT_GOTO(0x029a, L029a);
+    AOT_GOTO(0x0288, L0288);
+L0288:
+    AOT_BLOCK(0x0288, 2);
+    // 0288: mov 2478, (sp)
+    {
+        a = 0x2478;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 028c: jsr pc, *$0eaa
+    {
+        a = 0x0eaa;
+        r[6] -= 2;
+        WR16(r[6], 0x0290);
+    }
+    AOT_GOTO(0x0eaa, L0eaa);
+L0290:
+    AOT_BLOCK(0x0290, 2);
+    // 0290: mov r0, 2480
+    {
+        src = r[0];
+        b = 0x2480;
+        WR16(b, src);
+    }
+    // 0294: movb $34, 8(r0)
+    {
+        src = uint8_t(0x34);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x029a, L029a);
+L029a:
+    AOT_BLOCK(0x029a, 1);
+    // 029a: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x029e, L029e);
+L029e:
+    AOT_BLOCK(0x029e, 2);
+    // 029e: cmp -a(r5), -e(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02a4: bgt 02aa
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x02aa, L02aa);
+    AOT_GOTO(0x02a6, L02a6);
+L02a6:
+    AOT_BLOCK(0x02a6, 1);
+    // 02a6: jmp *$0484
+    {
+        a = 0x0484;
+    }
+    AOT_GOTO(0x0484, L0484);
+L02aa:
+    AOT_BLOCK(0x02aa, 2);
+    // 02aa: cmp $1, -a(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02b0: bge 02c6
+    if (!(N ^ V))
+        AOT_GOTO(0x02c6, L02c6);
+    AOT_GOTO(0x02b2, L02b2);
+L02b2:
+    AOT_BLOCK(0x02b2, 5);
+    // 02b2: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 02b6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 02b8: mov 28d0(r0), (sp)
+    {
+        a = uint16_t(r[0] + 10448);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02bc: mov $1a44, -(sp)
+    {
+        src = uint16_t(0x1a44);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02c0: jsr pc, *$133e
+    {
+        a = 0x133e;
+        r[6] -= 2;
+        WR16(r[6], 0x02c4);
+    }
+    AOT_GOTO(0x133e, L133e);
+L02c4:
+    AOT_BLOCK(0x02c4, 1);
+    // 02c4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x02c6, L02c6);
+L02c6:
+    AOT_BLOCK(0x02c6, 3);
+    // 02c6: mov $1a49, 286c
+    {
+        src = uint16_t(0x1a49);
+        b = 0x286c;
+        WR16(b, src);
+    }
+    // 02cc: tst 299a
+    {
+        a = 0x299a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 02d0: beq 02ea
+    if (Z)
+        AOT_GOTO(0x02ea, L02ea);
+    AOT_GOTO(0x02d2, L02d2);
+L02d2:
+    AOT_BLOCK(0x02d2, 5);
+    // 02d2: mov $69, (sp)
+    {
+        src = uint16_t(0x0069);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02d6: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 02da: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 02dc: mov 28d0(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 10448);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02e0: jsr pc, *$0ddc
+    {
+        a = 0x0ddc;
+        r[6] -= 2;
+        WR16(r[6], 0x02e4);
+    }
+    AOT_GOTO(0x0ddc, L0ddc);
+L02e4:
+    AOT_BLOCK(0x02e4, 2);
+    // 02e4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 02e6: mov r0, 2480
+    {
+        src = r[0];
+        b = 0x2480;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x02ea, L02ea);
+L02ea:
+    AOT_BLOCK(0x02ea, 4);
+    // 02ea: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 02ee: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 02f0: mov 28d0(r0), (sp)
+    {
+        a = uint16_t(r[0] + 10448);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02f4: jsr pc, *$0598
+    {
+        a = 0x0598;
+        r[6] -= 2;
+        WR16(r[6], 0x02f8);
+    }
+    AOT_GOTO(0x0598, L0598);
+L02f8:
+    AOT_BLOCK(0x02f8, 3);
+    // 02f8: mov r0, 286e
+    {
+        src = r[0];
+        b = 0x286e;
+        WR16(b, src);
+    }
+    // 02fc: tst 299a
+    {
+        a = 0x299a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0300: beq 0306
+    if (Z)
+        AOT_GOTO(0x0306, L0306);
+    AOT_GOTO(0x0302, L0302);
+L0302:
+    AOT_BLOCK(0x0302, 1);
+    // 0302: jmp *$047c
+    {
+        a = 0x047c;
+    }
+    AOT_GOTO(0x047c, L047c);
+L0306:
+    AOT_BLOCK(0x0306, 2);
+    // 0306: tst 29b4
+    {
+        a = 0x29b4;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 030a: beq 0310
+    if (Z)
+        AOT_GOTO(0x0310, L0310);
+    AOT_GOTO(0x030c, L030c);
+L030c:
+    AOT_BLOCK(0x030c, 1);
+    // 030c: jmp *$047c
+    {
+        a = 0x047c;
+    }
+    AOT_GOTO(0x047c, L047c);
+L0310:
+    AOT_BLOCK(0x0310, 2);
+    // 0310: tst 286e
+    {
+        a = 0x286e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0314: bne 031e
+    if (!Z)
+        AOT_GOTO(0x031e, L031e);
+    AOT_GOTO(0x0316, L0316);
+L0316:
+    AOT_BLOCK(0x0316, 2);
+    // 0316: inc 299e
+    {
+        a = 0x299e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 031a: jmp *$047c
+    {
+        a = 0x047c;
+    }
+    AOT_GOTO(0x047c, L047c);
+L031e:
+    AOT_BLOCK(0x031e, 4);
+    // 031e: mov 247a, 2870
+    {
+        a = 0x247a;
+        src = RD16(a);
+        b = 0x2870;
+        WR16(b, src);
+    }
+    // 0324: mov 247c, 2872
+    {
+        a = 0x247c;
+        src = RD16(a);
+        b = 0x2872;
+        WR16(b, src);
+    }
+    // 032a: tst 29a2
+    {
+        a = 0x29a2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 032e: beq 033c
+    if (Z)
+        AOT_GOTO(0x033c, L033c);
+    AOT_GOTO(0x0330, L0330);
+L0330:
+    AOT_BLOCK(0x0330, 3);
+    // 0330: mov $1a4c, 2874
+    {
+        src = uint16_t(0x1a4c);
+        b = 0x2874;
+        WR16(b, src);
+    }
+    // 0336: clr 2876
+    {
+        a = 0x2876;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 033a: br 0340
+    AOT_GOTO(0x0340, L0340);
+L033c:
+    AOT_BLOCK(0x033c, 1);
+    // 033c: clr 2874
+    {
+        a = 0x2874;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0340, L0340);
+L0340:
+    AOT_BLOCK(0x0340, 3);
+    // 0340: mov $286c, (sp)
+    {
+        src = uint16_t(0x286c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0344: mov 196a, -(sp)
+    {
+        a = 0x196a;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0348: jsr pc, *$0e08
+    {
+        a = 0x0e08;
+        r[6] -= 2;
+        WR16(r[6], 0x034c);
+    }
+    AOT_GOTO(0x0e08, L0e08);
+L034c:
+    AOT_BLOCK(0x034c, 3);
+    // 034c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 034e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0350: beq 035a
+    if (Z)
+        AOT_GOTO(0x035a, L035a);
+    AOT_GOTO(0x0352, L0352);
+L0352:
+    AOT_BLOCK(0x0352, 2);
+    // 0352: inc 299e
+    {
+        a = 0x299e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0356: jmp *$047c
+    {
+        a = 0x047c;
+    }
+    AOT_GOTO(0x047c, L047c);
+L035a:
+    AOT_BLOCK(0x035a, 5);
+    // 035a: mov $1a4f, 286c
+    {
+        src = uint16_t(0x1a4f);
+        b = 0x286c;
+        WR16(b, src);
+    }
+    // 0360: mov 247a, 286e
+    {
+        a = 0x247a;
+        src = RD16(a);
+        b = 0x286e;
+        WR16(b, src);
+    }
+    // 0366: mov 247c, 2870
+    {
+        a = 0x247c;
+        src = RD16(a);
+        b = 0x2870;
+        WR16(b, src);
+    }
+    // 036c: tst 299c
+    {
+        a = 0x299c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0370: beq 038a
+    if (Z)
+        AOT_GOTO(0x038a, L038a);
+    AOT_GOTO(0x0372, L0372);
+L0372:
+    AOT_BLOCK(0x0372, 5);
+    // 0372: mov $73, (sp)
+    {
+        src = uint16_t(0x0073);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0376: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 037a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 037c: mov 28d0(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 10448);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0380: jsr pc, *$0ddc
+    {
+        a = 0x0ddc;
+        r[6] -= 2;
+        WR16(r[6], 0x0384);
+    }
+    AOT_GOTO(0x0ddc, L0ddc);
+L0384:
+    AOT_BLOCK(0x0384, 2);
+    // 0384: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0386: mov r0, 247e
+    {
+        src = r[0];
+        b = 0x247e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x038a, L038a);
+L038a:
+    AOT_BLOCK(0x038a, 3);
+    // 038a: mov 247e, 2872
+    {
+        a = 0x247e;
+        src = RD16(a);
+        b = 0x2872;
+        WR16(b, src);
+    }
+    // 0390: tst 29a0
+    {
+        a = 0x29a0;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0394: beq 039c
+    if (Z)
+        AOT_GOTO(0x039c, L039c);
+    AOT_GOTO(0x0396, L0396);
+L0396:
+    AOT_BLOCK(0x0396, 1);
+    // 0396: mov 2482, 2872
+    {
+        a = 0x2482;
+        src = RD16(a);
+        b = 0x2872;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x039c, L039c);
+L039c:
+    AOT_BLOCK(0x039c, 4);
+    // 039c: clr 2874
+    {
+        a = 0x2874;
+        WR16(a, 0);
+        C = false;
+    }
+    // 03a0: mov $286c, (sp)
+    {
+        src = uint16_t(0x286c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03a4: mov 196c, -(sp)
+    {
+        a = 0x196c;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03a8: jsr pc, *$0e08
+    {
+        a = 0x0e08;
+        r[6] -= 2;
+        WR16(r[6], 0x03ac);
+    }
+    AOT_GOTO(0x0e08, L0e08);
+L03ac:
+    AOT_BLOCK(0x03ac, 3);
+    // 03ac: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 03ae: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03b0: beq 03b8
+    if (Z)
+        AOT_GOTO(0x03b8, L03b8);
+    AOT_GOTO(0x03b2, L03b2);
+L03b2:
+    AOT_BLOCK(0x03b2, 2);
+    // 03b2: inc 299e
+    {
+        a = 0x299e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 03b6: br 047c
+    AOT_GOTO(0x047c, L047c);
+L03b8:
+    AOT_BLOCK(0x03b8, 2);
+    // 03b8: tst 29a0
+    {
+        a = 0x29a0;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03bc: beq 03ea
+    if (Z)
+        AOT_GOTO(0x03ea, L03ea);
+    AOT_GOTO(0x03be, L03be);
+L03be:
+    AOT_BLOCK(0x03be, 7);
+    // 03be: mov $1a52, 286c
+    {
+        src = uint16_t(0x1a52);
+        b = 0x286c;
+        WR16(b, src);
+    }
+    // 03c4: mov 2482, 286e
+    {
+        a = 0x2482;
+        src = RD16(a);
+        b = 0x286e;
+        WR16(b, src);
+    }
+    // 03ca: mov 247e, 2870
+    {
+        a = 0x247e;
+        src = RD16(a);
+        b = 0x2870;
+        WR16(b, src);
+    }
+    // 03d0: clr 2872
+    {
+        a = 0x2872;
+        WR16(a, 0);
+        C = false;
+    }
+    // 03d4: mov $286c, (sp)
+    {
+        src = uint16_t(0x286c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03d8: mov 196e, -(sp)
+    {
+        a = 0x196e;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03dc: jsr pc, *$0e08
+    {
+        a = 0x0e08;
+        r[6] -= 2;
+        WR16(r[6], 0x03e0);
+    }
+    AOT_GOTO(0x0e08, L0e08);
+L03e0:
+    AOT_BLOCK(0x03e0, 3);
+    // 03e0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 03e2: mov 2482, (sp)
+    {
+        a = 0x2482;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03e6: jsr pc, *$188c
+    {
+        a = 0x188c;
+        r[6] -= 2;
+        WR16(r[6], 0x03ea);
+    }
+    AOT_GOTO(0x188c, L188c);
+L03ea:
+    AOT_BLOCK(0x03ea, 2);
+    // 03ea: tst 299c
+    {
+        a = 0x299c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03ee: bne 047c
+    if (!Z)
+        AOT_GOTO(0x047c, L047c);
+    AOT_GOTO(0x03f0, L03f0);
+L03f0:
+    AOT_BLOCK(0x03f0, 6);
+    // 03f0: mov $1a55, 286c
+    {
+        src = uint16_t(0x1a55);
+        b = 0x286c;
+        WR16(b, src);
+    }
+    // 03f6: mov $1a58, 286e
+    {
+        src = uint16_t(0x1a58);
+        b = 0x286e;
+        WR16(b, src);
+    }
+    // 03fc: mov 247e, 2870
+    {
+        a = 0x247e;
+        src = RD16(a);
+        b = 0x2870;
+        WR16(b, src);
+    }
+    // 0402: clr 2872
+    {
+        a = 0x2872;
+        WR16(a, 0);
+        C = false;
+    }
+    // 0406: mov 247a, (sp)
+    {
+        a = 0x247a;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 040a: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x040e);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L040e:
+    AOT_BLOCK(0x040e, 2);
+    // 040e: mov 247c, (sp)
+    {
+        a = 0x247c;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0412: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0416);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L0416:
+    AOT_BLOCK(0x0416, 2);
+    // 0416: mov 2480, (sp)
+    {
+        a = 0x2480;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 041a: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x041e);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L041e:
+    AOT_BLOCK(0x041e, 3);
+    // 041e: mov $286c, (sp)
+    {
+        src = uint16_t(0x286c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0422: mov $1a5a, -(sp)
+    {
+        src = uint16_t(0x1a5a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0426: jsr pc, *$0e08
+    {
+        a = 0x0e08;
+        r[6] -= 2;
+        WR16(r[6], 0x042a);
+    }
+    AOT_GOTO(0x0e08, L0e08);
+L042a:
+    AOT_BLOCK(0x042a, 6);
+    // 042a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 042c: mov $6f, (sp)
+    {
+        src = uint16_t(0x006f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0430: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0434: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0436: mov 28d0(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 10448);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 043a: jsr pc, *$0ddc
+    {
+        a = 0x0ddc;
+        r[6] -= 2;
+        WR16(r[6], 0x043e);
+    }
+    AOT_GOTO(0x0ddc, L0ddc);
+L043e:
+    AOT_BLOCK(0x043e, 4);
+    // 043e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0440: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0444: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0448: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x044c);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L044c:
+    AOT_BLOCK(0x044c, 3);
+    // 044c: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0450: mov $1a62, -(sp)
+    {
+        src = uint16_t(0x1a62);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0454: jsr pc, *$167c
+    {
+        a = 0x167c;
+        r[6] -= 2;
+        WR16(r[6], 0x0458);
+    }
+    AOT_GOTO(0x167c, L167c);
+L0458:
+    AOT_BLOCK(0x0458, 3);
+    // 0458: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 045a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 045c: bne 046a
+    if (!Z)
+        AOT_GOTO(0x046a, L046a);
+    AOT_GOTO(0x045e, L045e);
+L045e:
+    AOT_BLOCK(0x045e, 2);
+    // 045e: mov $1a68, (sp)
+    {
+        src = uint16_t(0x1a68);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0462: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0466);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L0466:
+    AOT_BLOCK(0x0466, 2);
+    // 0466: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0468: beq 047c
+    if (Z)
+        AOT_GOTO(0x047c, L047c);
+    AOT_GOTO(0x046a, L046a);
+L046a:
+    AOT_BLOCK(0x046a, 3);
+    // 046a: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 046e: mov $1a6e, -(sp)
+    {
+        src = uint16_t(0x1a6e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0472: jsr pc, *$133e
+    {
+        a = 0x133e;
+        r[6] -= 2;
+        WR16(r[6], 0x0476);
+    }
+    AOT_GOTO(0x133e, L133e);
+L0476:
+    AOT_BLOCK(0x0476, 2);
+    // 0476: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0478: inc 299e
+    {
+        a = 0x299e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x047c, L047c);
+L047c:
+    AOT_BLOCK(0x047c, 2);
+    // 047c: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0480: jmp *$029e
+    {
+        a = 0x029e;
+    }
+    AOT_GOTO(0x029e, L029e);
+L0484:
+    AOT_BLOCK(0x0484, 2);
+    // 0484: tst 299e
+    {
+        a = 0x299e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0488: bne 0548
+    if (!Z)
+        AOT_GOTO(0x0548, L0548);
+    AOT_GOTO(0x048a, L048a);
+L048a:
+    AOT_BLOCK(0x048a, 2);
+    // 048a: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 048e: beq 0548
+    if (Z)
+        AOT_GOTO(0x0548, L0548);
+    AOT_GOTO(0x0490, L0490);
+L0490:
+    AOT_BLOCK(0x0490, 5);
+    // 0490: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0494: mov $1a7f, 286c
+    {
+        src = uint16_t(0x1a7f);
+        b = 0x286c;
+        WR16(b, src);
+    }
+    // 049a: mov $1a82, 286e
+    {
+        src = uint16_t(0x1a82);
+        b = 0x286e;
+        WR16(b, src);
+    }
+    // 04a0: mov 1970, 2870
+    {
+        a = 0x1970;
+        src = RD16(a);
+        b = 0x2870;
+        WR16(b, src);
+    }
+    // 04a6: mov $3, -10(r5)
+    {
+        src = uint16_t(0x0003);
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04ac, L04ac);
+L04ac:
+    AOT_BLOCK(0x04ac, 2);
+    // 04ac: cmp -c(r5), -e(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04b2: ble 04d0
+    if (Z || (N ^ V))
+        AOT_GOTO(0x04d0, L04d0);
+    AOT_GOTO(0x04b4, L04b4);
+L04b4:
+    AOT_BLOCK(0x04b4, 8);
+    // 04b4: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04b8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 04ba: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 04be: mov -e(r5), r1
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 04c2: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 04c4: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 04c8: mov 2934(r1), 286c(r0)
+    {
+        a = uint16_t(r[1] + 10548);
+        src = RD16(a);
+        b = uint16_t(r[0] + 10348);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04ce: br 04ac
+    AOT_GOTO(0x04ac, L04ac);
+L04d0:
+    AOT_BLOCK(0x04d0, 2);
+    // 04d0: tst -14(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04d4: beq 04e8
+    if (Z)
+        AOT_GOTO(0x04e8, L04e8);
+    AOT_GOTO(0x04d6, L04d6);
+L04d6:
+    AOT_BLOCK(0x04d6, 5);
+    // 04d6: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04da: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 04dc: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 04e0: mov $1a85, 286c(r0)
+    {
+        src = uint16_t(0x1a85);
+        b = uint16_t(r[0] + 10348);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04e6: br 0508
+    AOT_GOTO(0x0508, L0508);
+L04e8:
+    AOT_BLOCK(0x04e8, 8);
+    // 04e8: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04ec: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 04ee: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 04f2: mov $1a89, 286c(r0)
+    {
+        src = uint16_t(0x1a89);
+        b = uint16_t(r[0] + 10348);
+        WR16(b, src);
+    }
+    // 04f8: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04fc: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 04fe: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0502: mov $1a8d, 286c(r0)
+    {
+        src = uint16_t(0x1a8d);
+        b = uint16_t(r[0] + 10348);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0508, L0508);
+L0508:
+    AOT_BLOCK(0x0508, 7);
+    // 0508: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 050c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 050e: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0512: clr 286c(r0)
+    {
+        a = uint16_t(r[0] + 10348);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0516: mov $286c, (sp)
+    {
+        src = uint16_t(0x286c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 051a: mov $1a90, -(sp)
+    {
+        src = uint16_t(0x1a90);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 051e: jsr pc, *$0e08
+    {
+        a = 0x0e08;
+        r[6] -= 2;
+        WR16(r[6], 0x0522);
+    }
+    AOT_GOTO(0x0e08, L0e08);
+L0522:
+    AOT_BLOCK(0x0522, 3);
+    // 0522: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0524: cmp $1, -a(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 052a: bne 0548
+    if (!Z)
+        AOT_GOTO(0x0548, L0548);
+    AOT_GOTO(0x052c, L052c);
+L052c:
+    AOT_BLOCK(0x052c, 2);
+    // 052c: cmp $1, -16(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -22);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0532: bne 0548
+    if (!Z)
+        AOT_GOTO(0x0548, L0548);
+    AOT_GOTO(0x0534, L0534);
+L0534:
+    AOT_BLOCK(0x0534, 3);
+    // 0534: mov $6f, (sp)
+    {
+        src = uint16_t(0x006f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0538: mov 28d0, -(sp)
+    {
+        a = 0x28d0;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 053c: jsr pc, *$0ddc
+    {
+        a = 0x0ddc;
+        r[6] -= 2;
+        WR16(r[6], 0x0540);
+    }
+    AOT_GOTO(0x0ddc, L0ddc);
+L0540:
+    AOT_BLOCK(0x0540, 3);
+    // 0540: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0542: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0544: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0548);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L0548:
+    AOT_BLOCK(0x0548, 1);
+    // 0548: jsr pc, 0550
+    {
+        a = 0x0550;
+        r[6] -= 2;
+        WR16(r[6], 0x054c);
+    }
+    AOT_GOTO(0x0550, L0550);
+L054c:
+    AOT_BLOCK(0x054c, 2);
+    // 054c: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0550:
+    AOT_BLOCK(0x0550, 4);
+    // 0550: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0554;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0554: tst 299a
+    {
+        a = 0x299a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0558: bne 0590
+    if (!Z)
+        AOT_GOTO(0x0590, L0590);
+    AOT_GOTO(0x055a, L055a);
+L055a:
+    AOT_BLOCK(0x055a, 2);
+    // 055a: mov 247a, (sp)
+    {
+        a = 0x247a;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 055e: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0562);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L0562:
+    AOT_BLOCK(0x0562, 2);
+    // 0562: mov 247c, (sp)
+    {
+        a = 0x247c;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0566: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x056a);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L056a:
+    AOT_BLOCK(0x056a, 2);
+    // 056a: tst 299c
+    {
+        a = 0x299c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 056e: bne 0578
+    if (!Z)
+        AOT_GOTO(0x0578, L0578);
+    AOT_GOTO(0x0570, L0570);
+L0570:
+    AOT_BLOCK(0x0570, 2);
+    // 0570: mov 247e, (sp)
+    {
+        a = 0x247e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0574: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0578);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L0578:
+    AOT_BLOCK(0x0578, 2);
+    // 0578: mov 2480, (sp)
+    {
+        a = 0x2480;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 057c: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0580);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L0580:
+    AOT_BLOCK(0x0580, 2);
+    // 0580: mov 2482, (sp)
+    {
+        a = 0x2482;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0584: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0588);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L0588:
+    AOT_BLOCK(0x0588, 2);
+    // 0588: mov 2478, (sp)
+    {
+        a = 0x2478;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 058c: jsr pc, *$0f1c
+    {
+        a = 0x0f1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0590);
+    }
+    AOT_GOTO(0x0f1c, L0f1c);
+L0590:
+    AOT_BLOCK(0x0590, 1);
+    // 0590: jsr pc, 18c6
+    {
+        a = 0x18c6;
+        r[6] -= 2;
+        WR16(r[6], 0x0594);
+    }
+    AOT_GOTO(0x18c6, L18c6);
+L0594:
+    AOT_BLOCK(0x0594, 2);
+    // 0594: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0598:
+    AOT_BLOCK(0x0598, 14);
+    // 0598: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x059c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 059c: sub $ea6, sp
+    {
+        src = uint16_t(0x0ea6);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 05a0: clr 29b4
+    {
+        a = 0x29b4;
+        WR16(a, 0);
+    }
+    // 05a4: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 05a6: add $fdf4, r0
+    {
+        src = uint16_t(0xfdf4);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 05aa: mov r0, 29a8
+    {
+        src = r[0];
+        b = 0x29a8;
+        WR16(b, src);
+    }
+    // 05ae: mov r0, 29a6
+    {
+        src = r[0];
+        b = 0x29a6;
+        WR16(b, src);
+    }
+    // 05b2: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 05b4: add $fbee, r0
+    {
+        src = uint16_t(0xfbee);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 05b8: mov r0, 29aa
+    {
+        src = r[0];
+        b = 0x29aa;
+        WR16(b, src);
+    }
+    // 05bc: mov 29a8, (sp)
+    {
+        a = 0x29a8;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05c0: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05c4: jsr pc, *$15d4
+    {
+        a = 0x15d4;
+        r[6] -= 2;
+        WR16(r[6], 0x05c8);
+    }
+    AOT_GOTO(0x15d4, L15d4);
+L05c8:
+    AOT_BLOCK(0x05c8, 3);
+    // 05c8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 05ca: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05cc: bge 05d6
+    if (!(N ^ V))
+        AOT_GOTO(0x05d6, L05d6);
+    AOT_GOTO(0x05ce, L05ce);
+L05ce:
+    AOT_BLOCK(0x05ce, 2);
+    // 05ce: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05d2: jmp *$075c
+    {
+        a = 0x075c;
+    }
+    AOT_GOTO(0x075c, L075c);
+L05d6:
+    AOT_BLOCK(0x05d6, 2);
+    // 05d6: mov 29a8, (sp)
+    {
+        a = 0x29a8;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05da: jsr pc, *$1638
+    {
+        a = 0x1638;
+        r[6] -= 2;
+        WR16(r[6], 0x05de);
+    }
+    AOT_GOTO(0x1638, L1638);
+L05de:
+    AOT_BLOCK(0x05de, 2);
+    // 05de: cmp $23, r0
+    {
+        src = uint16_t(0x0023);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05e2: beq 05f4
+    if (Z)
+        AOT_GOTO(0x05f4, L05f4);
+    AOT_GOTO(0x05e4, L05e4);
+L05e4:
+    AOT_BLOCK(0x05e4, 2);
+    // 05e4: mov *29a8, (sp)
+    {
+        a = RD16(0x29a8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05e8: jsr pc, *$1560
+    {
+        a = 0x1560;
+        r[6] -= 2;
+        WR16(r[6], 0x05ec);
+    }
+    AOT_GOTO(0x1560, L1560);
+L05ec:
+    AOT_BLOCK(0x05ec, 2);
+    // 05ec: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05f0: jmp *$075c
+    {
+        a = 0x075c;
+    }
+    AOT_GOTO(0x075c, L075c);
+L05f4:
+    AOT_BLOCK(0x05f4, 11);
+    // 05f4: mov 29a8, r0
+    {
+        a = 0x29a8;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 05f8: inc 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 05fc: mov 29a8, r0
+    {
+        a = 0x29a8;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0600: dec 4(r0)
+    {
+        a = uint16_t(r[0] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0604: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0606: add $f9e8, r0
+    {
+        src = uint16_t(0xf9e8);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 060a: mov r0, 29ac
+    {
+        src = r[0];
+        b = 0x29ac;
+        WR16(b, src);
+    }
+    // 060e: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0610: add $f218, r0
+    {
+        src = uint16_t(0xf218);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0614: mov r0, 29b6
+    {
+        src = r[0];
+        b = 0x29b6;
+        WR16(b, src);
+    }
+    // 0618: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x061a, L061a);
+L061a:
+    AOT_BLOCK(0x061a, 2);
+    // 061a: cmp $c8, r4
+    {
+        src = uint16_t(0x00c8);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 061e: ble 063c
+    if (Z || (N ^ V))
+        AOT_GOTO(0x063c, L063c);
+    AOT_GOTO(0x0620, L0620);
+L0620:
+    AOT_BLOCK(0x0620, 10);
+    // 0620: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 0622: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0626: add r5, r1
+    {
+        src = r[5];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0628: clrb -de8(r1)
+    {
+        a = uint16_t(r[1] + -3560);
+        WR8(a, 0);
+    }
+    // 062c: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 062e: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0632: add r5, r1
+    {
+        src = r[5];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0634: clr -de0(r1)
+    {
+        a = uint16_t(r[1] + -3552);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0638: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 063a: br 061a
+    AOT_GOTO(0x061a, L061a);
+L063c:
+    AOT_BLOCK(0x063c, 3);
+    // 063c: mov $1a98, (sp)
+    {
+        src = uint16_t(0x1a98);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0640: mov $29b8, -(sp)
+    {
+        src = uint16_t(0x29b8);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0644: jsr pc, *$0a44
+    {
+        a = 0x0a44;
+        r[6] -= 2;
+        WR16(r[6], 0x0648);
+    }
+    AOT_GOTO(0x0a44, L0a44);
+L0648:
+    AOT_BLOCK(0x0648, 4);
+    // 0648: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 064a: mov $1a9f, (sp)
+    {
+        src = uint16_t(0x1a9f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 064e: mov $29ba, -(sp)
+    {
+        src = uint16_t(0x29ba);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0652: jsr pc, *$0a44
+    {
+        a = 0x0a44;
+        r[6] -= 2;
+        WR16(r[6], 0x0656);
+    }
+    AOT_GOTO(0x0a44, L0a44);
+L0656:
+    AOT_BLOCK(0x0656, 4);
+    // 0656: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0658: mov $1aa7, (sp)
+    {
+        src = uint16_t(0x1aa7);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 065c: mov $29bc, -(sp)
+    {
+        src = uint16_t(0x29bc);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0660: jsr pc, *$0a44
+    {
+        a = 0x0a44;
+        r[6] -= 2;
+        WR16(r[6], 0x0664);
+    }
+    AOT_GOTO(0x0a44, L0a44);
+L0664:
+    AOT_BLOCK(0x0664, 4);
+    // 0664: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0666: mov $1aad, (sp)
+    {
+        src = uint16_t(0x1aad);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 066a: mov $29be, -(sp)
+    {
+        src = uint16_t(0x29be);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 066e: jsr pc, *$0a44
+    {
+        a = 0x0a44;
+        r[6] -= 2;
+        WR16(r[6], 0x0672);
+    }
+    AOT_GOTO(0x0a44, L0a44);
+L0672:
+    AOT_BLOCK(0x0672, 4);
+    // 0672: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0674: mov $1ab3, (sp)
+    {
+        src = uint16_t(0x1ab3);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0678: mov $29c0, -(sp)
+    {
+        src = uint16_t(0x29c0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 067c: jsr pc, *$0a44
+    {
+        a = 0x0a44;
+        r[6] -= 2;
+        WR16(r[6], 0x0680);
+    }
+    AOT_GOTO(0x0a44, L0a44);
+L0680:
+    AOT_BLOCK(0x0680, 4);
+    // 0680: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0682: mov $1aba, (sp)
+    {
+        src = uint16_t(0x1aba);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0686: mov $29c2, -(sp)
+    {
+        src = uint16_t(0x29c2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 068a: jsr pc, *$0a44
+    {
+        a = 0x0a44;
+        r[6] -= 2;
+        WR16(r[6], 0x068e);
+    }
+    AOT_GOTO(0x0a44, L0a44);
+L068e:
+    AOT_BLOCK(0x068e, 11);
+    // 068e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0690: mov $1ca8, 29c8
+    {
+        src = uint16_t(0x1ca8);
+        b = 0x29c8;
+        WR16(b, src);
+    }
+    // 0696: clr 29c4
+    {
+        a = 0x29c4;
+        WR16(a, 0);
+    }
+    // 069a: clr 29c6
+    {
+        a = 0x29c6;
+        WR16(a, 0);
+    }
+    // 069e: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 06a0: add $f154, r0
+    {
+        src = uint16_t(0xf154);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 06a4: mov r0, 29b0
+    {
+        src = r[0];
+        b = 0x29b0;
+        WR16(b, src);
+    }
+    // 06a8: clr 29b2
+    {
+        a = 0x29b2;
+        WR16(a, 0);
+        C = false;
+    }
+    // 06ac: mov 29ac, (sp)
+    {
+        a = 0x29ac;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06b0: mov 2480, -(sp)
+    {
+        a = 0x2480;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06b4: jsr pc, *$16ba
+    {
+        a = 0x16ba;
+        r[6] -= 2;
+        WR16(r[6], 0x06b8);
+    }
+    AOT_GOTO(0x16ba, L16ba);
+L06b8:
+    AOT_BLOCK(0x06b8, 3);
+    // 06b8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 06ba: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06bc: bge 06d0
+    if (!(N ^ V))
+        AOT_GOTO(0x06d0, L06d0);
+    AOT_GOTO(0x06be, L06be);
+L06be:
+    AOT_BLOCK(0x06be, 3);
+    // 06be: mov 2480, (sp)
+    {
+        a = 0x2480;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06c2: mov $1abf, -(sp)
+    {
+        src = uint16_t(0x1abf);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06c6: jsr pc, *$133e
+    {
+        a = 0x133e;
+        r[6] -= 2;
+        WR16(r[6], 0x06ca);
+    }
+    AOT_GOTO(0x133e, L133e);
+L06ca:
+    AOT_BLOCK(0x06ca, 2);
+    // 06ca: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06cc: jsr pc, 0550
+    {
+        a = 0x0550;
+        r[6] -= 2;
+        WR16(r[6], 0x06d0);
+    }
+    AOT_GOTO(0x0550, L0550);
+L06d0:
+    AOT_BLOCK(0x06d0, 1);
+    // 06d0: jsr pc, 0760
+    {
+        a = 0x0760;
+        r[6] -= 2;
+        WR16(r[6], 0x06d4);
+    }
+    AOT_GOTO(0x0760, L0760);
+L06d4:
+    AOT_BLOCK(0x06d4, 2);
+    // 06d4: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06d6: beq 0728
+    if (Z)
+        AOT_GOTO(0x0728, L0728);
+    AOT_GOTO(0x06d8, L06d8);
+L06d8:
+    AOT_BLOCK(0x06d8, 2);
+    // 06d8: cmp 29aa, 29a6
+    {
+        a = 0x29aa;
+        src = RD16(a);
+        b = 0x29a6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06de: bne 06f4
+    if (!Z)
+        AOT_GOTO(0x06f4, L06f4);
+    AOT_GOTO(0x06e0, L06e0);
+L06e0:
+    AOT_BLOCK(0x06e0, 2);
+    // 06e0: tst 299a
+    {
+        a = 0x299a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06e4: bne 06f4
+    if (!Z)
+        AOT_GOTO(0x06f4, L06f4);
+    AOT_GOTO(0x06e6, L06e6);
+L06e6:
+    AOT_BLOCK(0x06e6, 3);
+    // 06e6: mov 29ac, (sp)
+    {
+        a = 0x29ac;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06ea: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06ee: jsr pc, *$1716
+    {
+        a = 0x1716;
+        r[6] -= 2;
+        WR16(r[6], 0x06f2);
+    }
+    AOT_GOTO(0x1716, L1716);
+L06f2:
+    AOT_BLOCK(0x06f2, 1);
+    // 06f2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x06f4, L06f4);
+L06f4:
+    AOT_BLOCK(0x06f4, 2);
+    // 06f4: cmpb $23, -eac(r5)
+    {
+        src = uint8_t(0x23);
+        b = uint16_t(r[5] + -3756);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 06fa: beq 0718
+    if (Z)
+        AOT_GOTO(0x0718, L0718);
+    AOT_GOTO(0x06fc, L06fc);
+L06fc:
+    AOT_BLOCK(0x06fc, 2);
+    // 06fc: tst 29c6
+    {
+        a = 0x29c6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0700: bne 0718
+    if (!Z)
+        AOT_GOTO(0x0718, L0718);
+    AOT_GOTO(0x0702, L0702);
+L0702:
+    AOT_BLOCK(0x0702, 1);
+    // 0702: mov 29b0, r3
+    {
+        a = 0x29b0;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0706, L0706);
+L0706:
+    AOT_BLOCK(0x0706, 2);
+    // 0706: movb (r3)+, r4
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[4] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0708: beq 0718
+    if (Z)
+        AOT_GOTO(0x0718, L0718);
+    AOT_GOTO(0x070a, L070a);
+L070a:
+    AOT_BLOCK(0x070a, 3);
+    // 070a: mov 29ac, (sp)
+    {
+        a = 0x29ac;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 070e: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0710: jsr pc, *$1716
+    {
+        a = 0x1716;
+        r[6] -= 2;
+        WR16(r[6], 0x0714);
+    }
+    AOT_GOTO(0x1716, L1716);
+L0714:
+    AOT_BLOCK(0x0714, 2);
+    // 0714: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0716: br 0706
+    AOT_GOTO(0x0706, L0706);
+L0718:
+    AOT_BLOCK(0x0718, 3);
+    // 0718: mov 29ac, (sp)
+    {
+        a = 0x29ac;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 071c: mov $a, -(sp)
+    {
+        src = uint16_t(0x000a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0720: jsr pc, *$1716
+    {
+        a = 0x1716;
+        r[6] -= 2;
+        WR16(r[6], 0x0724);
+    }
+    AOT_GOTO(0x1716, L1716);
+L0724:
+    AOT_BLOCK(0x0724, 2);
+    // 0724: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0726: br 06d0
+    AOT_GOTO(0x06d0, L06d0);
+L0728:
+    AOT_BLOCK(0x0728, 1);
+    // 0728: mov 29b0, r3
+    {
+        a = 0x29b0;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x072c, L072c);
+L072c:
+    AOT_BLOCK(0x072c, 2);
+    // 072c: movb (r3)+, r4
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[4] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 072e: beq 073e
+    if (Z)
+        AOT_GOTO(0x073e, L073e);
+    AOT_GOTO(0x0730, L0730);
+L0730:
+    AOT_BLOCK(0x0730, 3);
+    // 0730: mov 29ac, (sp)
+    {
+        a = 0x29ac;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0734: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0736: jsr pc, *$1716
+    {
+        a = 0x1716;
+        r[6] -= 2;
+        WR16(r[6], 0x073a);
+    }
+    AOT_GOTO(0x1716, L1716);
+L073a:
+    AOT_BLOCK(0x073a, 2);
+    // 073a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 073c: br 072c
+    AOT_GOTO(0x072c, L072c);
+L073e:
+    AOT_BLOCK(0x073e, 2);
+    // 073e: mov 29ac, (sp)
+    {
+        a = 0x29ac;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0742: jsr pc, *$173a
+    {
+        a = 0x173a;
+        r[6] -= 2;
+        WR16(r[6], 0x0746);
+    }
+    AOT_GOTO(0x173a, L173a);
+L0746:
+    AOT_BLOCK(0x0746, 2);
+    // 0746: mov *29ac, (sp)
+    {
+        a = RD16(0x29ac);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 074a: jsr pc, *$1560
+    {
+        a = 0x1560;
+        r[6] -= 2;
+        WR16(r[6], 0x074e);
+    }
+    AOT_GOTO(0x1560, L1560);
+L074e:
+    AOT_BLOCK(0x074e, 2);
+    // 074e: mov *29a8, (sp)
+    {
+        a = RD16(0x29a8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0752: jsr pc, *$1560
+    {
+        a = 0x1560;
+        r[6] -= 2;
+        WR16(r[6], 0x0756);
+    }
+    AOT_GOTO(0x1560, L1560);
+L0756:
+    AOT_BLOCK(0x0756, 2);
+    // 0756: mov 2480, r0
+    {
+        a = 0x2480;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 075a: br 075c
+    AOT_GOTO(0x075c, L075c);
+L075c:
+    AOT_BLOCK(0x075c, 2);
+    // 075c: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0760:
+    AOT_BLOCK(0x0760, 5);
+    // 0760: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0764;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0764: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0768: cmp 29a8, 29a6
+    {
+        a = 0x29a8;
+        src = RD16(a);
+        b = 0x29a6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 076e: bne 0774
+    if (!Z)
+        AOT_GOTO(0x0774, L0774);
+    AOT_GOTO(0x0770, L0770);
+L0770:
+    AOT_BLOCK(0x0770, 1);
+    // 0770: inc 29b2
+    {
+        a = 0x29b2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0774, L0774);
+L0774:
+    AOT_BLOCK(0x0774, 4);
+    // 0774: mov 29b0, 29ae
+    {
+        a = 0x29b0;
+        src = RD16(a);
+        b = 0x29ae;
+        WR16(b, src);
+    }
+    // 077a: clrb *29ae
+    {
+        a = RD16(0x29ae);
+        WR8(a, 0);
+    }
+    // 077e: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0780: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x0784);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L0784:
+    AOT_BLOCK(0x0784, 3);
+    // 0784: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0786: cmp $23, r4
+    {
+        src = uint16_t(0x0023);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 078a: bne 0790
+    if (!Z)
+        AOT_GOTO(0x0790, L0790);
+    AOT_GOTO(0x078c, L078c);
+L078c:
+    AOT_BLOCK(0x078c, 1);
+    // 078c: mov $1, r2
+    {
+        src = uint16_t(0x0001);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0790, L0790);
+L0790:
+    AOT_BLOCK(0x0790, 2);
+    // 0790: cmp $a, r4
+    {
+        src = uint16_t(0x000a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0794: bne 079a
+    if (!Z)
+        AOT_GOTO(0x079a, L079a);
+    AOT_GOTO(0x0796, L0796);
+L0796:
+    AOT_BLOCK(0x0796, 1);
+    // 0796: jmp *$0a28
+    {
+        a = 0x0a28;
+    }
+    AOT_GOTO(0x0a28, L0a28);
+L079a:
+    AOT_BLOCK(0x079a, 2);
+    // 079a: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 079c: bne 07a2
+    if (!Z)
+        AOT_GOTO(0x07a2, L07a2);
+    AOT_GOTO(0x079e, L079e);
+L079e:
+    AOT_BLOCK(0x079e, 1);
+    // 079e: jmp *$0a28
+    {
+        a = 0x0a28;
+    }
+    AOT_GOTO(0x0a28, L0a28);
+L07a2:
+    AOT_BLOCK(0x07a2, 2);
+    // 07a2: cmp $61, r4
+    {
+        src = uint16_t(0x0061);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07a6: bgt 07ae
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x07ae, L07ae);
+    AOT_GOTO(0x07a8, L07a8);
+L07a8:
+    AOT_BLOCK(0x07a8, 2);
+    // 07a8: cmp $7a, r4
+    {
+        src = uint16_t(0x007a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07ac: bge 07c4
+    if (!(N ^ V))
+        AOT_GOTO(0x07c4, L07c4);
+    AOT_GOTO(0x07ae, L07ae);
+L07ae:
+    AOT_BLOCK(0x07ae, 2);
+    // 07ae: cmp $41, r4
+    {
+        src = uint16_t(0x0041);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07b2: bgt 07ba
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x07ba, L07ba);
+    AOT_GOTO(0x07b4, L07b4);
+L07b4:
+    AOT_BLOCK(0x07b4, 2);
+    // 07b4: cmp $5a, r4
+    {
+        src = uint16_t(0x005a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07b8: bge 07c4
+    if (!(N ^ V))
+        AOT_GOTO(0x07c4, L07c4);
+    AOT_GOTO(0x07ba, L07ba);
+L07ba:
+    AOT_BLOCK(0x07ba, 2);
+    // 07ba: cmp $5f, r4
+    {
+        src = uint16_t(0x005f);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07be: beq 07c4
+    if (Z)
+        AOT_GOTO(0x07c4, L07c4);
+    AOT_GOTO(0x07c0, L07c0);
+L07c0:
+    AOT_BLOCK(0x07c0, 1);
+    // 07c0: jmp *$095e
+    {
+        a = 0x095e;
+    }
+    AOT_GOTO(0x095e, L095e);
+L07c4:
+    AOT_BLOCK(0x07c4, 3);
+    // 07c4: mov 29ae, -a(r5)
+    {
+        a = 0x29ae;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 07ca: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07cc: jsr pc, *$0a98
+    {
+        a = 0x0a98;
+        r[6] -= 2;
+        WR16(r[6], 0x07d0);
+    }
+    AOT_GOTO(0x0a98, L0a98);
+L07d0:
+    AOT_BLOCK(0x07d0, 1);
+    // 07d0: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x07d4);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L07d4:
+    AOT_BLOCK(0x07d4, 3);
+    // 07d4: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 07d6: cmp $61, r4
+    {
+        src = uint16_t(0x0061);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07da: bgt 07e2
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x07e2, L07e2);
+    AOT_GOTO(0x07dc, L07dc);
+L07dc:
+    AOT_BLOCK(0x07dc, 2);
+    // 07dc: cmp $7a, r4
+    {
+        src = uint16_t(0x007a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07e0: bge 0800
+    if (!(N ^ V))
+        AOT_GOTO(0x0800, L0800);
+    AOT_GOTO(0x07e2, L07e2);
+L07e2:
+    AOT_BLOCK(0x07e2, 2);
+    // 07e2: cmp $41, r4
+    {
+        src = uint16_t(0x0041);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07e6: bgt 07ee
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x07ee, L07ee);
+    AOT_GOTO(0x07e8, L07e8);
+L07e8:
+    AOT_BLOCK(0x07e8, 2);
+    // 07e8: cmp $5a, r4
+    {
+        src = uint16_t(0x005a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07ec: bge 0800
+    if (!(N ^ V))
+        AOT_GOTO(0x0800, L0800);
+    AOT_GOTO(0x07ee, L07ee);
+L07ee:
+    AOT_BLOCK(0x07ee, 2);
+    // 07ee: cmp $30, r4
+    {
+        src = uint16_t(0x0030);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07f2: bgt 07fa
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x07fa, L07fa);
+    AOT_GOTO(0x07f4, L07f4);
+L07f4:
+    AOT_BLOCK(0x07f4, 2);
+    // 07f4: cmp $39, r4
+    {
+        src = uint16_t(0x0039);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07f8: bge 0800
+    if (!(N ^ V))
+        AOT_GOTO(0x0800, L0800);
+    AOT_GOTO(0x07fa, L07fa);
+L07fa:
+    AOT_BLOCK(0x07fa, 2);
+    // 07fa: cmp $5f, r4
+    {
+        src = uint16_t(0x005f);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07fe: bne 0808
+    if (!Z)
+        AOT_GOTO(0x0808, L0808);
+    AOT_GOTO(0x0800, L0800);
+L0800:
+    AOT_BLOCK(0x0800, 2);
+    // 0800: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0802: jsr pc, *$0a98
+    {
+        a = 0x0a98;
+        r[6] -= 2;
+        WR16(r[6], 0x0806);
+    }
+    AOT_GOTO(0x0a98, L0a98);
+L0806:
+    AOT_BLOCK(0x0806, 1);
+    // 0806: br 07d0
+    AOT_GOTO(0x07d0, L07d0);
+L0808:
+    AOT_BLOCK(0x0808, 2);
+    // 0808: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 080a: jsr pc, *$0a98
+    {
+        a = 0x0a98;
+        r[6] -= 2;
+        WR16(r[6], 0x080e);
+    }
+    AOT_GOTO(0x0a98, L0a98);
+L080e:
+    AOT_BLOCK(0x080e, 3);
+    // 080e: dec 29ae
+    {
+        a = 0x29ae;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0812: cmp $3, r2
+    {
+        src = uint16_t(0x0003);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0816: bge 0862
+    if (!(N ^ V))
+        AOT_GOTO(0x0862, L0862);
+    AOT_GOTO(0x0818, L0818);
+L0818:
+    AOT_BLOCK(0x0818, 2);
+    // 0818: tst 29c6
+    {
+        a = 0x29c6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 081c: bne 0846
+    if (!Z)
+        AOT_GOTO(0x0846, L0846);
+    AOT_GOTO(0x081e, L081e);
+L081e:
+    AOT_BLOCK(0x081e, 3);
+    // 081e: mov $ffff, (sp)
+    {
+        src = uint16_t(0xffff);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0822: mov -a(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0826: jsr pc, *$0bf8
+    {
+        a = 0x0bf8;
+        r[6] -= 2;
+        WR16(r[6], 0x082a);
+    }
+    AOT_GOTO(0x0bf8, L0bf8);
+L082a:
+    AOT_BLOCK(0x082a, 3);
+    // 082a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 082c: tstb (r0)
+    {
+        a = r[0];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 082e: beq 0834
+    if (Z)
+        AOT_GOTO(0x0834, L0834);
+    AOT_GOTO(0x0830, L0830);
+L0830:
+    AOT_BLOCK(0x0830, 2);
+    // 0830: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0832: br 0838
+    AOT_GOTO(0x0838, L0838);
+L0834:
+    AOT_BLOCK(0x0834, 1);
+    // 0834: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0838, L0838);
+L0838:
+    AOT_BLOCK(0x0838, 3);
+    // 0838: add r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 083a: cmp $5, r0
+    {
+        src = uint16_t(0x0005);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 083e: bne 0846
+    if (!Z)
+        AOT_GOTO(0x0846, L0846);
+    AOT_GOTO(0x0840, L0840);
+L0840:
+    AOT_BLOCK(0x0840, 2);
+    // 0840: inc 29c4
+    {
+        a = 0x29c4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0844: br 084a
+    AOT_GOTO(0x084a, L084a);
+L0846:
+    AOT_BLOCK(0x0846, 1);
+    // 0846: inc 29c6
+    {
+        a = 0x29c6;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x084a, L084a);
+L084a:
+    AOT_BLOCK(0x084a, 2);
+    // 084a: cmp $a, r4
+    {
+        src = uint16_t(0x000a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 084e: beq 085c
+    if (Z)
+        AOT_GOTO(0x085c, L085c);
+    AOT_GOTO(0x0850, L0850);
+L0850:
+    AOT_BLOCK(0x0850, 2);
+    // 0850: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0852: beq 085c
+    if (Z)
+        AOT_GOTO(0x085c, L085c);
+    AOT_GOTO(0x0854, L0854);
+L0854:
+    AOT_BLOCK(0x0854, 1);
+    // 0854: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x0858);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L0858:
+    AOT_BLOCK(0x0858, 2);
+    // 0858: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 085a: br 084a
+    AOT_GOTO(0x084a, L084a);
+L085c:
+    AOT_BLOCK(0x085c, 2);
+    // 085c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 085e: jmp *$0a40
+    {
+        a = 0x0a40;
+    }
+    AOT_GOTO(0x0a40, L0a40);
+L0862:
+    AOT_BLOCK(0x0862, 2);
+    // 0862: cmp $2, r2
+    {
+        src = uint16_t(0x0002);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0866: bne 086e
+    if (!Z)
+        AOT_GOTO(0x086e, L086e);
+    AOT_GOTO(0x0868, L0868);
+L0868:
+    AOT_BLOCK(0x0868, 2);
+    // 0868: tst 29c6
+    {
+        a = 0x29c6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 086c: bne 088a
+    if (!Z)
+        AOT_GOTO(0x088a, L088a);
+    AOT_GOTO(0x086e, L086e);
+L086e:
+    AOT_BLOCK(0x086e, 2);
+    // 086e: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0870: jsr pc, *$0b82
+    {
+        a = 0x0b82;
+        r[6] -= 2;
+        WR16(r[6], 0x0874);
+    }
+    AOT_GOTO(0x0b82, L0b82);
+L0874:
+    AOT_BLOCK(0x0874, 3);
+    // 0874: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0876: mov -a(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 087a: jsr pc, *$0bf8
+    {
+        a = 0x0bf8;
+        r[6] -= 2;
+        WR16(r[6], 0x087e);
+    }
+    AOT_GOTO(0x0bf8, L0bf8);
+L087e:
+    AOT_BLOCK(0x087e, 3);
+    // 087e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0880: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0884: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x0888);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L0888:
+    AOT_BLOCK(0x0888, 1);
+    // 0888: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x088a, L088a);
+L088a:
+    AOT_BLOCK(0x088a, 2);
+    // 088a: cmp $1, r2
+    {
+        src = uint16_t(0x0001);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 088e: bne 0916
+    if (!Z)
+        AOT_GOTO(0x0916, L0916);
+    AOT_GOTO(0x0890, L0890);
+L0890:
+    AOT_BLOCK(0x0890, 2);
+    // 0890: cmp 29b8, -8(r5)
+    {
+        a = 0x29b8;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0896: bne 089e
+    if (!Z)
+        AOT_GOTO(0x089e, L089e);
+    AOT_GOTO(0x0898, L0898);
+L0898:
+    AOT_BLOCK(0x0898, 2);
+    // 0898: mov $2, r2
+    {
+        src = uint16_t(0x0002);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 089c: br 0914
+    AOT_GOTO(0x0914, L0914);
+L089e:
+    AOT_BLOCK(0x089e, 2);
+    // 089e: cmp 29ba, -8(r5)
+    {
+        a = 0x29ba;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08a4: bne 08ac
+    if (!Z)
+        AOT_GOTO(0x08ac, L08ac);
+    AOT_GOTO(0x08a6, L08a6);
+L08a6:
+    AOT_BLOCK(0x08a6, 2);
+    // 08a6: mov $3, r2
+    {
+        src = uint16_t(0x0003);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08aa: br 0914
+    AOT_GOTO(0x0914, L0914);
+L08ac:
+    AOT_BLOCK(0x08ac, 2);
+    // 08ac: cmp 29c0, -8(r5)
+    {
+        a = 0x29c0;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08b2: bne 08ba
+    if (!Z)
+        AOT_GOTO(0x08ba, L08ba);
+    AOT_GOTO(0x08b4, L08b4);
+L08b4:
+    AOT_BLOCK(0x08b4, 2);
+    // 08b4: mov $4, r2
+    {
+        src = uint16_t(0x0004);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08b8: br 0914
+    AOT_GOTO(0x0914, L0914);
+L08ba:
+    AOT_BLOCK(0x08ba, 2);
+    // 08ba: cmp 29be, -8(r5)
+    {
+        a = 0x29be;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08c0: bne 08c8
+    if (!Z)
+        AOT_GOTO(0x08c8, L08c8);
+    AOT_GOTO(0x08c2, L08c2);
+L08c2:
+    AOT_BLOCK(0x08c2, 2);
+    // 08c2: mov $5, r2
+    {
+        src = uint16_t(0x0005);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08c6: br 0914
+    AOT_GOTO(0x0914, L0914);
+L08c8:
+    AOT_BLOCK(0x08c8, 2);
+    // 08c8: cmp 29bc, -8(r5)
+    {
+        a = 0x29bc;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08ce: bne 08f4
+    if (!Z)
+        AOT_GOTO(0x08f4, L08f4);
+    AOT_GOTO(0x08d0, L08d0);
+L08d0:
+    AOT_BLOCK(0x08d0, 2);
+    // 08d0: tst 29c6
+    {
+        a = 0x29c6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08d4: beq 08dc
+    if (Z)
+        AOT_GOTO(0x08dc, L08dc);
+    AOT_GOTO(0x08d6, L08d6);
+L08d6:
+    AOT_BLOCK(0x08d6, 2);
+    // 08d6: dec 29c6
+    {
+        a = 0x29c6;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 08da: br 08f0
+    AOT_GOTO(0x08f0, L08f0);
+L08dc:
+    AOT_BLOCK(0x08dc, 2);
+    // 08dc: tst 29c4
+    {
+        a = 0x29c4;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08e0: beq 08e8
+    if (Z)
+        AOT_GOTO(0x08e8, L08e8);
+    AOT_GOTO(0x08e2, L08e2);
+L08e2:
+    AOT_BLOCK(0x08e2, 2);
+    // 08e2: dec 29c4
+    {
+        a = 0x29c4;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 08e6: br 08f0
+    AOT_GOTO(0x08f0, L08f0);
+L08e8:
+    AOT_BLOCK(0x08e8, 2);
+    // 08e8: mov $1acf, (sp)
+    {
+        src = uint16_t(0x1acf);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08ec: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x08f0);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L08f0:
+    AOT_BLOCK(0x08f0, 1);
+    // 08f0: br 084a
+    AOT_GOTO(0x084a, L084a);
+L08f4:
+    AOT_BLOCK(0x08f4, 2);
+    // 08f4: mov $1add, (sp)
+    {
+        src = uint16_t(0x1add);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08f8: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x08fc);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L08fc:
+    AOT_BLOCK(0x08fc, 2);
+    // 08fc: cmp $a, r4
+    {
+        src = uint16_t(0x000a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0900: beq 090e
+    if (Z)
+        AOT_GOTO(0x090e, L090e);
+    AOT_GOTO(0x0902, L0902);
+L0902:
+    AOT_BLOCK(0x0902, 2);
+    // 0902: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0904: beq 090e
+    if (Z)
+        AOT_GOTO(0x090e, L090e);
+    AOT_GOTO(0x0906, L0906);
+L0906:
+    AOT_BLOCK(0x0906, 1);
+    // 0906: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x090a);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L090a:
+    AOT_BLOCK(0x090a, 2);
+    // 090a: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 090c: br 08fc
+    AOT_GOTO(0x08fc, L08fc);
+L090e:
+    AOT_BLOCK(0x090e, 2);
+    // 090e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0910: jmp *$0a40
+    {
+        a = 0x0a40;
+    }
+    AOT_GOTO(0x0a40, L0a40);
+L0914:
+    AOT_BLOCK(0x0914, 1);
+    // 0914: br 0958
+    AOT_GOTO(0x0958, L0958);
+L0916:
+    AOT_BLOCK(0x0916, 2);
+    // 0916: cmp $2, r2
+    {
+        src = uint16_t(0x0002);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 091a: bne 0958
+    if (!Z)
+        AOT_GOTO(0x0958, L0958);
+    AOT_GOTO(0x091c, L091c);
+L091c:
+    AOT_BLOCK(0x091c, 2);
+    // 091c: tst 29c6
+    {
+        a = 0x29c6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0920: bne 084a
+    if (!Z)
+        AOT_GOTO(0x084a, L084a);
+    AOT_GOTO(0x0922, L0922);
+L0922:
+    AOT_BLOCK(0x0922, 4);
+    // 0922: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0926: mov 29c8, 8(r0)
+    {
+        a = 0x29c8;
+        src = RD16(a);
+        b = uint16_t(r[0] + 8);
+        WR16(b, src);
+    }
+    // 092c: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 092e: jsr pc, *$0ad4
+    {
+        a = 0x0ad4;
+        r[6] -= 2;
+        WR16(r[6], 0x0932);
+    }
+    AOT_GOTO(0x0ad4, L0ad4);
+L0932:
+    AOT_BLOCK(0x0932, 1);
+    // 0932: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x0936);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L0936:
+    AOT_BLOCK(0x0936, 3);
+    // 0936: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0938: cmp $a, r4
+    {
+        src = uint16_t(0x000a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 093c: beq 094a
+    if (Z)
+        AOT_GOTO(0x094a, L094a);
+    AOT_GOTO(0x093e, L093e);
+L093e:
+    AOT_BLOCK(0x093e, 2);
+    // 093e: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0940: beq 094a
+    if (Z)
+        AOT_GOTO(0x094a, L094a);
+    AOT_GOTO(0x0942, L0942);
+L0942:
+    AOT_BLOCK(0x0942, 2);
+    // 0942: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0944: jsr pc, *$0ad4
+    {
+        a = 0x0ad4;
+        r[6] -= 2;
+        WR16(r[6], 0x0948);
+    }
+    AOT_GOTO(0x0ad4, L0ad4);
+L0948:
+    AOT_BLOCK(0x0948, 1);
+    // 0948: br 0932
+    AOT_GOTO(0x0932, L0932);
+L094a:
+    AOT_BLOCK(0x094a, 2);
+    // 094a: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 094c: jsr pc, *$0ad4
+    {
+        a = 0x0ad4;
+        r[6] -= 2;
+        WR16(r[6], 0x0950);
+    }
+    AOT_GOTO(0x0ad4, L0ad4);
+L0950:
+    AOT_BLOCK(0x0950, 2);
+    // 0950: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0954: jmp *$0a40
+    {
+        a = 0x0a40;
+    }
+    AOT_GOTO(0x0a40, L0a40);
+L0958:
+    AOT_BLOCK(0x0958, 1);
+    // 0958: jmp *$0790
+    {
+        a = 0x0790;
+    }
+    AOT_GOTO(0x0790, L0790);
+L095e:
+    AOT_BLOCK(0x095e, 3);
+    // 095e: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 0960: cmp $27, r3
+    {
+        src = uint16_t(0x0027);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0964: beq 096c
+    if (Z)
+        AOT_GOTO(0x096c, L096c);
+    AOT_GOTO(0x0966, L0966);
+L0966:
+    AOT_BLOCK(0x0966, 2);
+    // 0966: cmp $22, r3
+    {
+        src = uint16_t(0x0022);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 096a: bne 0a18
+    if (!Z)
+        AOT_GOTO(0x0a18, L0a18);
+    AOT_GOTO(0x096c, L096c);
+L096c:
+    AOT_BLOCK(0x096c, 2);
+    // 096c: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 096e: jsr pc, *$0a98
+    {
+        a = 0x0a98;
+        r[6] -= 2;
+        WR16(r[6], 0x0972);
+    }
+    AOT_GOTO(0x0a98, L0a98);
+L0972:
+    AOT_BLOCK(0x0972, 2);
+    // 0972: mov 29ae, -c(r5)
+    {
+        a = 0x29ae;
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0978: inc 2998
+    {
+        a = 0x2998;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x097c, L097c);
+L097c:
+    AOT_BLOCK(0x097c, 1);
+    // 097c: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x0980);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L0980:
+    AOT_BLOCK(0x0980, 3);
+    // 0980: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0982: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0984: beq 09a8
+    if (Z)
+        AOT_GOTO(0x09a8, L09a8);
+    AOT_GOTO(0x0986, L0986);
+L0986:
+    AOT_BLOCK(0x0986, 2);
+    // 0986: cmp $a, r4
+    {
+        src = uint16_t(0x000a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 098a: beq 09a8
+    if (Z)
+        AOT_GOTO(0x09a8, L09a8);
+    AOT_GOTO(0x098c, L098c);
+L098c:
+    AOT_BLOCK(0x098c, 2);
+    // 098c: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 098e: beq 09a8
+    if (Z)
+        AOT_GOTO(0x09a8, L09a8);
+    AOT_GOTO(0x0990, L0990);
+L0990:
+    AOT_BLOCK(0x0990, 2);
+    // 0990: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0992: jsr pc, *$0a98
+    {
+        a = 0x0a98;
+        r[6] -= 2;
+        WR16(r[6], 0x0996);
+    }
+    AOT_GOTO(0x0a98, L0a98);
+L0996:
+    AOT_BLOCK(0x0996, 2);
+    // 0996: cmp $5c, r4
+    {
+        src = uint16_t(0x005c);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 099a: bne 09a6
+    if (!Z)
+        AOT_GOTO(0x09a6, L09a6);
+    AOT_GOTO(0x099c, L099c);
+L099c:
+    AOT_BLOCK(0x099c, 1);
+    // 099c: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x09a0);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L09a0:
+    AOT_BLOCK(0x09a0, 2);
+    // 09a0: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09a2: jsr pc, *$0a98
+    {
+        a = 0x0a98;
+        r[6] -= 2;
+        WR16(r[6], 0x09a6);
+    }
+    AOT_GOTO(0x0a98, L0a98);
+L09a6:
+    AOT_BLOCK(0x09a6, 1);
+    // 09a6: br 097c
+    AOT_GOTO(0x097c, L097c);
+L09a8:
+    AOT_BLOCK(0x09a8, 3);
+    // 09a8: clr 2998
+    {
+        a = 0x2998;
+        WR16(a, 0);
+    }
+    // 09ac: tst 29c6
+    {
+        a = 0x29c6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09b0: beq 09b6
+    if (Z)
+        AOT_GOTO(0x09b6, L09b6);
+    AOT_GOTO(0x09b2, L09b2);
+L09b2:
+    AOT_BLOCK(0x09b2, 1);
+    // 09b2: jmp *$084a
+    {
+        a = 0x084a;
+    }
+    AOT_GOTO(0x084a, L084a);
+L09b6:
+    AOT_BLOCK(0x09b6, 2);
+    // 09b6: cmp $3, r2
+    {
+        src = uint16_t(0x0003);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09ba: bne 0a18
+    if (!Z)
+        AOT_GOTO(0x0a18, L0a18);
+    AOT_GOTO(0x09bc, L09bc);
+L09bc:
+    AOT_BLOCK(0x09bc, 2);
+    // 09bc: tst 29c6
+    {
+        a = 0x29c6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09c0: beq 09c6
+    if (Z)
+        AOT_GOTO(0x09c6, L09c6);
+    AOT_GOTO(0x09c2, L09c2);
+L09c2:
+    AOT_BLOCK(0x09c2, 1);
+    // 09c2: jmp *$084a
+    {
+        a = 0x084a;
+    }
+    AOT_GOTO(0x084a, L084a);
+L09c6:
+    AOT_BLOCK(0x09c6, 1);
+    // 09c6: clrb *29ae
+    {
+        a = RD16(0x29ae);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x09ca, L09ca);
+L09ca:
+    AOT_BLOCK(0x09ca, 1);
+    // 09ca: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x09ce);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L09ce:
+    AOT_BLOCK(0x09ce, 3);
+    // 09ce: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 09d0: cmp $a, r4
+    {
+        src = uint16_t(0x000a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09d4: beq 09dc
+    if (Z)
+        AOT_GOTO(0x09dc, L09dc);
+    AOT_GOTO(0x09d6, L09d6);
+L09d6:
+    AOT_BLOCK(0x09d6, 2);
+    // 09d6: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09d8: beq 09dc
+    if (Z)
+        AOT_GOTO(0x09dc, L09dc);
+    AOT_GOTO(0x09da, L09da);
+L09da:
+    AOT_BLOCK(0x09da, 1);
+    // 09da: br 09ca
+    AOT_GOTO(0x09ca, L09ca);
+L09dc:
+    AOT_BLOCK(0x09dc, 2);
+    // 09dc: cmp 29aa, 29a6
+    {
+        a = 0x29aa;
+        src = RD16(a);
+        b = 0x29a6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09e2: bne 09ec
+    if (!Z)
+        AOT_GOTO(0x09ec, L09ec);
+    AOT_GOTO(0x09e4, L09e4);
+L09e4:
+    AOT_BLOCK(0x09e4, 2);
+    // 09e4: mov $1aef, (sp)
+    {
+        src = uint16_t(0x1aef);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09e8: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x09ec);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L09ec:
+    AOT_BLOCK(0x09ec, 3);
+    // 09ec: mov 29aa, (sp)
+    {
+        a = 0x29aa;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 09f0: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09f4: jsr pc, *$15d4
+    {
+        a = 0x15d4;
+        r[6] -= 2;
+        WR16(r[6], 0x09f8);
+    }
+    AOT_GOTO(0x15d4, L15d4);
+L09f8:
+    AOT_BLOCK(0x09f8, 3);
+    // 09f8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 09fa: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09fc: bge 0a0e
+    if (!(N ^ V))
+        AOT_GOTO(0x0a0e, L0a0e);
+    AOT_GOTO(0x09fe, L09fe);
+L09fe:
+    AOT_BLOCK(0x09fe, 3);
+    // 09fe: mov -c(r5), (sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a02: mov $1b00, -(sp)
+    {
+        src = uint16_t(0x1b00);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a06: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x0a0a);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L0a0a:
+    AOT_BLOCK(0x0a0a, 2);
+    // 0a0a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a0c: br 0a14
+    AOT_GOTO(0x0a14, L0a14);
+L0a0e:
+    AOT_BLOCK(0x0a0e, 1);
+    // 0a0e: mov 29aa, 29a6
+    {
+        a = 0x29aa;
+        src = RD16(a);
+        b = 0x29a6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a14, L0a14);
+L0a14:
+    AOT_BLOCK(0x0a14, 2);
+    // 0a14: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a16: br 0a40
+    AOT_GOTO(0x0a40, L0a40);
+L0a18:
+    AOT_BLOCK(0x0a18, 2);
+    // 0a18: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a1a: jsr pc, *$0a98
+    {
+        a = 0x0a98;
+        r[6] -= 2;
+        WR16(r[6], 0x0a1e);
+    }
+    AOT_GOTO(0x0a98, L0a98);
+L0a1e:
+    AOT_BLOCK(0x0a1e, 1);
+    // 0a1e: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x0a22);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L0a22:
+    AOT_BLOCK(0x0a22, 2);
+    // 0a22: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a24: jmp *$0790
+    {
+        a = 0x0790;
+    }
+    AOT_GOTO(0x0790, L0790);
+L0a28:
+    AOT_BLOCK(0x0a28, 2);
+    // 0a28: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0a2a: jsr pc, *$0a98
+    {
+        a = 0x0a98;
+        r[6] -= 2;
+        WR16(r[6], 0x0a2e);
+    }
+    AOT_GOTO(0x0a98, L0a98);
+L0a2e:
+    AOT_BLOCK(0x0a2e, 2);
+    // 0a2e: cmp $1, r2
+    {
+        src = uint16_t(0x0001);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a32: bge 0a3c
+    if (!(N ^ V))
+        AOT_GOTO(0x0a3c, L0a3c);
+    AOT_GOTO(0x0a34, L0a34);
+L0a34:
+    AOT_BLOCK(0x0a34, 2);
+    // 0a34: mov $1b10, (sp)
+    {
+        src = uint16_t(0x1b10);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a38: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x0a3c);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L0a3c:
+    AOT_BLOCK(0x0a3c, 2);
+    // 0a3c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a3e: br 0a40
+    AOT_GOTO(0x0a40, L0a40);
+L0a40:
+    AOT_BLOCK(0x0a40, 2);
+    // 0a40: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a44:
+    AOT_BLOCK(0x0a44, 5);
+    // 0a44: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a48;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0a48: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a4c: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a50: jsr pc, *$0bf8
+    {
+        a = 0x0bf8;
+        r[6] -= 2;
+        WR16(r[6], 0x0a54);
+    }
+    AOT_GOTO(0x0bf8, L0bf8);
+L0a54:
+    AOT_BLOCK(0x0a54, 6);
+    // 0a54: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0a56: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0a58: mov r4, *4(r5)
+    {
+        src = r[4];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+    }
+    // 0a5c: mov r4, 8(r4)
+    {
+        src = r[4];
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 0a60: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a64:
+    AOT_BLOCK(0x0a64, 4);
+    // 0a64: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a68;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0a68: mov 29b2, (sp)
+    {
+        a = 0x29b2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a6c: mov $1b1f, -(sp)
+    {
+        src = uint16_t(0x1b1f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a70, L0a70);
+L0a70:
+    AOT_BLOCK(0x0a70, 1);
+    // 0a70: jsr pc, *$133e
+    {
+        a = 0x133e;
+        r[6] -= 2;
+        WR16(r[6], 0x0a74);
+    }
+    AOT_GOTO(0x133e, L133e);
+L0a74:
+    AOT_BLOCK(0x0a74, 4);
+    // 0a74: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0a76: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a7a: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a7e: jsr pc, *$133e
+    {
+        a = 0x133e;
+        r[6] -= 2;
+        WR16(r[6], 0x0a82);
+    }
+    AOT_GOTO(0x133e, L133e);
+L0a82:
+    AOT_BLOCK(0x0a82, 3);
+    // 0a82: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0a84: mov $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a88: jsr pc, *$14f0
+    {
+        a = 0x14f0;
+        r[6] -= 2;
+        WR16(r[6], 0x0a8c);
+    }
+    AOT_GOTO(0x14f0, L14f0);
+L0a8c:
+    AOT_BLOCK(0x0a8c, 4);
+    // 0a8c: inc 29b4
+    {
+        a = 0x29b4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0a90: inc 299e
+    {
+        a = 0x299e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0a94: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a98:
+    AOT_BLOCK(0x0a98, 7);
+    // 0a98: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a9c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0a9c: mov 29ae, r4
+    {
+        a = 0x29ae;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0aa0: mov 29b0, r0
+    {
+        a = 0x29b0;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0aa4: add $c2, r0
+    {
+        src = uint16_t(0x00c2);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0aa8: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0aaa: bne 0ab4
+    if (!Z)
+        AOT_GOTO(0x0ab4, L0ab4);
+    AOT_GOTO(0x0aac, L0aac);
+L0aac:
+    AOT_BLOCK(0x0aac, 2);
+    // 0aac: mov $1b24, (sp)
+    {
+        src = uint16_t(0x1b24);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ab0: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x0ab4);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L0ab4:
+    AOT_BLOCK(0x0ab4, 5);
+    // 0ab4: movb 4(r5), (r4)+
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+    }
+    // 0ab8: mov 29b0, r0
+    {
+        a = 0x29b0;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0abc: add $c3, r0
+    {
+        src = uint16_t(0x00c3);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0ac0: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ac2: blos 0acc
+    if (C | Z)
+        AOT_GOTO(0x0acc, L0acc);
+    AOT_GOTO(0x0ac4, L0ac4);
+L0ac4:
+    AOT_BLOCK(0x0ac4, 2);
+    // 0ac4: mov 29b0, r4
+    {
+        a = 0x29b0;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0ac8: add $c3, r4
+    {
+        src = uint16_t(0x00c3);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0acc, L0acc);
+L0acc:
+    AOT_BLOCK(0x0acc, 3);
+    // 0acc: mov r4, 29ae
+    {
+        src = r[4];
+        b = 0x29ae;
+        WR16(b, src);
+    }
+    // 0ad0: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ad4:
+    AOT_BLOCK(0x0ad4, 8);
+    // 0ad4: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0ad8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0ad8: movb 4(r5), *29c8
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = RD16(0x29c8);
+        WR8(b, src);
+    }
+    // 0ade: inc 29c8
+    {
+        a = 0x29c8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0ae2: mov 29c8, r0
+    {
+        a = 0x29c8;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0ae6: sub $1ca8, r0
+    {
+        src = uint16_t(0x1ca8);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0aea: cmp $7d0, r0
+    {
+        src = uint16_t(0x07d0);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0aee: bgt 0afc
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0afc, L0afc);
+    AOT_GOTO(0x0af0, L0af0);
+L0af0:
+    AOT_BLOCK(0x0af0, 2);
+    // 0af0: mov $1b32, (sp)
+    {
+        src = uint16_t(0x1b32);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0af4: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x0af8);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L0af8:
+    AOT_BLOCK(0x0af8, 1);
+    // 0af8: jsr pc, 0550
+    {
+        a = 0x0550;
+        r[6] -= 2;
+        WR16(r[6], 0x0afc);
+    }
+    AOT_GOTO(0x0550, L0550);
+L0afc:
+    AOT_BLOCK(0x0afc, 2);
+    // 0afc: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b00:
+    AOT_BLOCK(0x0b00, 2);
+    // 0b00: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b04;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0b04, L0b04);
+L0b04:
+    AOT_BLOCK(0x0b04, 1);
+    // 0b04: jsr pc, 0b94
+    {
+        a = 0x0b94;
+        r[6] -= 2;
+        WR16(r[6], 0x0b08);
+    }
+    AOT_GOTO(0x0b94, L0b94);
+L0b08:
+    AOT_BLOCK(0x0b08, 3);
+    // 0b08: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0b0a: cmp $2f, r4
+    {
+        src = uint16_t(0x002f);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b0e: bne 0b7a
+    if (!Z)
+        AOT_GOTO(0x0b7a, L0b7a);
+    AOT_GOTO(0x0b10, L0b10);
+L0b10:
+    AOT_BLOCK(0x0b10, 2);
+    // 0b10: tst 2998
+    {
+        a = 0x2998;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b14: bne 0b7a
+    if (!Z)
+        AOT_GOTO(0x0b7a, L0b7a);
+    AOT_GOTO(0x0b16, L0b16);
+L0b16:
+    AOT_BLOCK(0x0b16, 1);
+    // 0b16: jsr pc, 0b94
+    {
+        a = 0x0b94;
+        r[6] -= 2;
+        WR16(r[6], 0x0b1a);
+    }
+    AOT_GOTO(0x0b94, L0b94);
+L0b1a:
+    AOT_BLOCK(0x0b1a, 3);
+    // 0b1a: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0b1c: cmp $2a, r4
+    {
+        src = uint16_t(0x002a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b20: beq 0b2e
+    if (Z)
+        AOT_GOTO(0x0b2e, L0b2e);
+    AOT_GOTO(0x0b22, L0b22);
+L0b22:
+    AOT_BLOCK(0x0b22, 2);
+    // 0b22: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b24: jsr pc, *$0b82
+    {
+        a = 0x0b82;
+        r[6] -= 2;
+        WR16(r[6], 0x0b28);
+    }
+    AOT_GOTO(0x0b82, L0b82);
+L0b28:
+    AOT_BLOCK(0x0b28, 2);
+    // 0b28: mov $2f, r0
+    {
+        src = uint16_t(0x002f);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b2c: br 0b7e
+    AOT_GOTO(0x0b7e, L0b7e);
+L0b2e:
+    AOT_BLOCK(0x0b2e, 1);
+    // 0b2e: jsr pc, 0b94
+    {
+        a = 0x0b94;
+        r[6] -= 2;
+        WR16(r[6], 0x0b32);
+    }
+    AOT_GOTO(0x0b94, L0b94);
+L0b32:
+    AOT_BLOCK(0x0b32, 1);
+    // 0b32: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b34, L0b34);
+L0b34:
+    AOT_BLOCK(0x0b34, 2);
+    // 0b34: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b36: br 0b68
+    AOT_GOTO(0x0b68, L0b68);
+L0b38:
+    AOT_BLOCK(0x0b38, 2);
+    // 0b38: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0b3a: br 0b7e
+    AOT_GOTO(0x0b7e, L0b7e);
+L0b3c:
+    AOT_BLOCK(0x0b3c, 1);
+    // 0b3c: jsr pc, 0b94
+    {
+        a = 0x0b94;
+        r[6] -= 2;
+        WR16(r[6], 0x0b40);
+    }
+    AOT_GOTO(0x0b94, L0b94);
+L0b40:
+    AOT_BLOCK(0x0b40, 3);
+    // 0b40: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0b42: cmp $2f, r4
+    {
+        src = uint16_t(0x002f);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b46: beq 0b04
+    if (Z)
+        AOT_GOTO(0x0b04, L0b04);
+    AOT_GOTO(0x0b48, L0b48);
+L0b48:
+    AOT_BLOCK(0x0b48, 1);
+    // 0b48: br 0b34
+    AOT_GOTO(0x0b34, L0b34);
+L0b4a:
+    AOT_BLOCK(0x0b4a, 2);
+    // 0b4a: cmp 29a8, 29a6
+    {
+        a = 0x29a8;
+        src = RD16(a);
+        b = 0x29a6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b50: bne 0b64
+    if (!Z)
+        AOT_GOTO(0x0b64, L0b64);
+    AOT_GOTO(0x0b52, L0b52);
+L0b52:
+    AOT_BLOCK(0x0b52, 3);
+    // 0b52: mov 29ac, (sp)
+    {
+        a = 0x29ac;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b56: mov $a, -(sp)
+    {
+        src = uint16_t(0x000a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b5a: jsr pc, *$1716
+    {
+        a = 0x1716;
+        r[6] -= 2;
+        WR16(r[6], 0x0b5e);
+    }
+    AOT_GOTO(0x1716, L1716);
+L0b5e:
+    AOT_BLOCK(0x0b5e, 2);
+    // 0b5e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0b60: inc 29b2
+    {
+        a = 0x29b2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0b64, L0b64);
+L0b64:
+    AOT_BLOCK(0x0b64, 1);
+    // 0b64: br 0b2e
+    AOT_GOTO(0x0b2e, L0b2e);
+L0b68:
+    AOT_BLOCK(0x0b68, 2);
+    // 0b68: mov $19a0, r1
+    {
+        src = uint16_t(0x19a0);
+        r[1] = src;
+    }
+    // 0b6c: mov r0, 19a6
+    {
+        src = r[0];
+        b = 0x19a6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b70, L0b70);
+L0b70:
+    AOT_BLOCK(0x0b70, 2);
+    // 0b70: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b72: bne 0b70
+    if (!Z)
+        AOT_GOTO(0x0b70, L0b70);
+    AOT_GOTO(0x0b74, L0b74);
+L0b74:
+    AOT_BLOCK(0x0b74, 1);
+    // 0b74: jmp *6(r1)
+    {
+        a = RD16(r[1] + 6);
+    }
+    AOT_JUMP(a);
+L0b78:
+    AOT_BLOCK(0x0b78, 1);
+    // 0b78: br 0b2e
+    AOT_GOTO(0x0b2e, L0b2e);
+L0b7a:
+    AOT_BLOCK(0x0b7a, 2);
+    // 0b7a: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b7c: br 0b7e
+    AOT_GOTO(0x0b7e, L0b7e);
+L0b7e:
+    AOT_BLOCK(0x0b7e, 2);
+    // 0b7e: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b82:
+    AOT_BLOCK(0x0b82, 6);
+    // 0b82: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b86;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0b86: inc 19b0
+    {
+        a = 0x19b0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0b8a: movb 4(r5), *19b0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = RD16(0x19b0);
+        WR8(b, src);
+    }
+    // 0b90: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b94:
+    AOT_BLOCK(0x0b94, 4);
+    // 0b94: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b98;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0b98: tstb *19b0
+    {
+        a = RD16(0x19b0);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b9c: beq 0ba8
+    if (Z)
+        AOT_GOTO(0x0ba8, L0ba8);
+    AOT_GOTO(0x0b9e, L0b9e);
+L0b9e:
+    AOT_BLOCK(0x0b9e, 3);
+    // 0b9e: movb *19b0, r0
+    {
+        a = RD16(0x19b0);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0ba2: dec 19b0
+    {
+        a = 0x19b0;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0ba6: br 0bf4
+    AOT_GOTO(0x0bf4, L0bf4);
+L0ba8:
+    AOT_BLOCK(0x0ba8, 3);
+    // 0ba8: clr 29a4
+    {
+        a = 0x29a4;
+        WR16(a, 0);
+        C = false;
+    }
+    // 0bac: mov 29a6, (sp)
+    {
+        a = 0x29a6;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bb0: jsr pc, *$1638
+    {
+        a = 0x1638;
+        r[6] -= 2;
+        WR16(r[6], 0x0bb4);
+    }
+    AOT_GOTO(0x1638, L1638);
+L0bb4:
+    AOT_BLOCK(0x0bb4, 3);
+    // 0bb4: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0bb6: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0bb8: bge 0be8
+    if (!(N ^ V))
+        AOT_GOTO(0x0be8, L0be8);
+    AOT_GOTO(0x0bba, L0bba);
+L0bba:
+    AOT_BLOCK(0x0bba, 2);
+    // 0bba: cmp 29aa, 29a6
+    {
+        a = 0x29aa;
+        src = RD16(a);
+        b = 0x29a6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bc0: bne 0be8
+    if (!Z)
+        AOT_GOTO(0x0be8, L0be8);
+    AOT_GOTO(0x0bc2, L0bc2);
+L0bc2:
+    AOT_BLOCK(0x0bc2, 2);
+    // 0bc2: mov *29aa, (sp)
+    {
+        a = RD16(0x29aa);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bc6: jsr pc, *$1560
+    {
+        a = 0x1560;
+        r[6] -= 2;
+        WR16(r[6], 0x0bca);
+    }
+    AOT_GOTO(0x1560, L1560);
+L0bca:
+    AOT_BLOCK(0x0bca, 1);
+    // 0bca: mov 29a8, 29a6
+    {
+        a = 0x29a8;
+        src = RD16(a);
+        b = 0x29a6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bd0, L0bd0);
+L0bd0:
+    AOT_BLOCK(0x0bd0, 3);
+    // 0bd0: mov 29ac, (sp)
+    {
+        a = 0x29ac;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bd4: mov $a, -(sp)
+    {
+        src = uint16_t(0x000a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bd8: jsr pc, *$1716
+    {
+        a = 0x1716;
+        r[6] -= 2;
+        WR16(r[6], 0x0bdc);
+    }
+    AOT_GOTO(0x1716, L1716);
+L0bdc:
+    AOT_BLOCK(0x0bdc, 3);
+    // 0bdc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0bde: inc 29b2
+    {
+        a = 0x29b2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0be2: jsr pc, 0b94
+    {
+        a = 0x0b94;
+        r[6] -= 2;
+        WR16(r[6], 0x0be6);
+    }
+    AOT_GOTO(0x0b94, L0b94);
+L0be6:
+    AOT_BLOCK(0x0be6, 1);
+    // 0be6: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0be8, L0be8);
+L0be8:
+    AOT_BLOCK(0x0be8, 2);
+    // 0be8: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0bea: bge 0bf0
+    if (!(N ^ V))
+        AOT_GOTO(0x0bf0, L0bf0);
+    AOT_GOTO(0x0bec, L0bec);
+L0bec:
+    AOT_BLOCK(0x0bec, 2);
+    // 0bec: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0bee: br 0bf4
+    AOT_GOTO(0x0bf4, L0bf4);
+L0bf0:
+    AOT_BLOCK(0x0bf0, 2);
+    // 0bf0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bf2: br 0bf4
+    AOT_GOTO(0x0bf4, L0bf4);
+L0bf4:
+    AOT_BLOCK(0x0bf4, 2);
+    // 0bf4: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0bf8:
+    AOT_BLOCK(0x0bf8, 7);
+    // 0bf8: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0bfc;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0bfc: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0c00: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0c04: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 0c06: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0c0a: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c0e, L0c0e);
+L0c0e:
+    AOT_BLOCK(0x0c0e, 3);
+    // 0c0e: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0c10: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c14: beq 0c1e
+    if (Z)
+        AOT_GOTO(0x0c1e, L0c1e);
+    AOT_GOTO(0x0c16, L0c16);
+L0c16:
+    AOT_BLOCK(0x0c16, 2);
+    // 0c16: add -a(r5), -8(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0c1c: br 0c0e
+    AOT_GOTO(0x0c0e, L0c0e);
+L0c1e:
+    AOT_BLOCK(0x0c1e, 8);
+    // 0c1e: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 0c22: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0c24: div 1968, r0
+    {
+        a = 0x1968;
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0c28: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0c2c: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0c30: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0c34: mov r1, r2
+    {
+        src = r[1];
+        r[2] = src;
+    }
+    // 0c36: add 29b6, r2
+    {
+        a = 0x29b6;
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0c3a, L0c3a);
+L0c3a:
+    AOT_BLOCK(0x0c3a, 2);
+    // 0c3a: tstb (r2)
+    {
+        a = r[2];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c3c: beq 0ca4
+    if (Z)
+        AOT_GOTO(0x0ca4, L0ca4);
+    AOT_GOTO(0x0c3e, L0c3e);
+L0c3e:
+    AOT_BLOCK(0x0c3e, 2);
+    // 0c3e: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+    }
+    // 0c40: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c44, L0c44);
+L0c44:
+    AOT_BLOCK(0x0c44, 2);
+    // 0c44: cmpb (r4), (r3)+
+    {
+        a = r[4];
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c46: bne 0c70
+    if (!Z)
+        AOT_GOTO(0x0c70, L0c70);
+    AOT_GOTO(0x0c48, L0c48);
+L0c48:
+    AOT_BLOCK(0x0c48, 2);
+    // 0c48: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c4a: beq 0c58
+    if (Z)
+        AOT_GOTO(0x0c58, L0c58);
+    AOT_GOTO(0x0c4c, L0c4c);
+L0c4c:
+    AOT_BLOCK(0x0c4c, 4);
+    // 0c4c: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c50: add $8, r0
+    {
+        src = uint16_t(0x0008);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0c54: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c56: bne 0c6e
+    if (!Z)
+        AOT_GOTO(0x0c6e, L0c6e);
+    AOT_GOTO(0x0c58, L0c58);
+L0c58:
+    AOT_BLOCK(0x0c58, 2);
+    // 0c58: tst 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c5c: bne 0c6a
+    if (!Z)
+        AOT_GOTO(0x0c6a, L0c6a);
+    AOT_GOTO(0x0c5e, L0c5e);
+L0c5e:
+    AOT_BLOCK(0x0c5e, 3);
+    // 0c5e: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c60: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c64: jsr pc, *$0cfc
+    {
+        a = 0x0cfc;
+        r[6] -= 2;
+        WR16(r[6], 0x0c68);
+    }
+    AOT_GOTO(0x0cfc, L0cfc);
+L0c68:
+    AOT_BLOCK(0x0c68, 1);
+    // 0c68: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0c6a, L0c6a);
+L0c6a:
+    AOT_BLOCK(0x0c6a, 2);
+    // 0c6a: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c6c: br 0cc6
+    AOT_GOTO(0x0cc6, L0cc6);
+L0c6e:
+    AOT_BLOCK(0x0c6e, 1);
+    // 0c6e: br 0c44
+    AOT_GOTO(0x0c44, L0c44);
+L0c70:
+    AOT_BLOCK(0x0c70, 6);
+    // 0c70: add $a, r2
+    {
+        src = uint16_t(0x000a);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 0c74: mov 1968, r1
+    {
+        a = 0x1968;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0c78: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0c7c: add 29b6, r1
+    {
+        a = 0x29b6;
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0c80: cmp r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c82: bcs 0ca2
+    if (C)
+        AOT_GOTO(0x0ca2, L0ca2);
+    AOT_GOTO(0x0c84, L0c84);
+L0c84:
+    AOT_BLOCK(0x0c84, 4);
+    // 0c84: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c88: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0c8c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c8e: beq 0c9e
+    if (Z)
+        AOT_GOTO(0x0c9e, L0c9e);
+    AOT_GOTO(0x0c90, L0c90);
+L0c90:
+    AOT_BLOCK(0x0c90, 2);
+    // 0c90: mov $1b44, (sp)
+    {
+        src = uint16_t(0x1b44);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c94: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x0c98);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L0c98:
+    AOT_BLOCK(0x0c98, 1);
+    // 0c98: jsr pc, 0550
+    {
+        a = 0x0550;
+        r[6] -= 2;
+        WR16(r[6], 0x0c9c);
+    }
+    AOT_GOTO(0x0550, L0550);
+L0c9c:
+    AOT_BLOCK(0x0c9c, 1);
+    // 0c9c: br 0ca2
+    AOT_GOTO(0x0ca2, L0ca2);
+L0c9e:
+    AOT_BLOCK(0x0c9e, 1);
+    // 0c9e: mov 29b6, r2
+    {
+        a = 0x29b6;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ca2, L0ca2);
+L0ca2:
+    AOT_BLOCK(0x0ca2, 1);
+    // 0ca2: br 0c3a
+    AOT_GOTO(0x0c3a, L0c3a);
+L0ca4:
+    AOT_BLOCK(0x0ca4, 2);
+    // 0ca4: tst 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ca8: ble 0cc2
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0cc2, L0cc2);
+    AOT_GOTO(0x0caa, L0caa);
+L0caa:
+    AOT_BLOCK(0x0caa, 2);
+    // 0caa: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0cae: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cb0, L0cb0);
+L0cb0:
+    AOT_BLOCK(0x0cb0, 4);
+    // 0cb0: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 0cb2: add $8, r0
+    {
+        src = uint16_t(0x0008);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0cb6: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cb8: bcc 0cc2
+    if (!C)
+        AOT_GOTO(0x0cc2, L0cc2);
+    AOT_GOTO(0x0cba, L0cba);
+L0cba:
+    AOT_BLOCK(0x0cba, 2);
+    // 0cba: movb (r3), (r4)+
+    {
+        a = r[3];
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0cbc: beq 0cc0
+    if (Z)
+        AOT_GOTO(0x0cc0, L0cc0);
+    AOT_GOTO(0x0cbe, L0cbe);
+L0cbe:
+    AOT_BLOCK(0x0cbe, 1);
+    // 0cbe: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0cc0, L0cc0);
+L0cc0:
+    AOT_BLOCK(0x0cc0, 1);
+    // 0cc0: br 0cb0
+    AOT_GOTO(0x0cb0, L0cb0);
+L0cc2:
+    AOT_BLOCK(0x0cc2, 2);
+    // 0cc2: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cc4: br 0cc6
+    AOT_GOTO(0x0cc6, L0cc6);
+L0cc6:
+    AOT_BLOCK(0x0cc6, 2);
+    // 0cc6: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0cca:
+    AOT_BLOCK(0x0cca, 6);
+    // 0cca: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0cce;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0cce: mov 2bbe, r0
+    {
+        a = 0x2bbe;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0cd2: sub $2af6, r0
+    {
+        src = uint16_t(0x2af6);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0cd6: cmp $c8, r0
+    {
+        src = uint16_t(0x00c8);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cda: bge 0cee
+    if (!(N ^ V))
+        AOT_GOTO(0x0cee, L0cee);
+    AOT_GOTO(0x0cdc, L0cdc);
+L0cdc:
+    AOT_BLOCK(0x0cdc, 4);
+    // 0cdc: mov 2bbe, (sp)
+    {
+        a = 0x2bbe;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ce0: dec 2bbe
+    {
+        a = 0x2bbe;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0ce4: mov $1b55, -(sp)
+    {
+        src = uint16_t(0x1b55);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ce8: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x0cec);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L0cec:
+    AOT_BLOCK(0x0cec, 1);
+    // 0cec: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0cee, L0cee);
+L0cee:
+    AOT_BLOCK(0x0cee, 4);
+    // 0cee: movb 4(r5), *2bbe
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = RD16(0x2bbe);
+        WR8(b, src);
+    }
+    // 0cf4: inc 2bbe
+    {
+        a = 0x2bbe;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0cf8: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0cfc:
+    AOT_BLOCK(0x0cfc, 8);
+    // 0cfc: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0d00;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0d00: mov 4(r5), 29ae
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x29ae;
+        WR16(b, src);
+    }
+    // 0d06: mov $2af6, 2bbe
+    {
+        src = uint16_t(0x2af6);
+        b = 0x2bbe;
+        WR16(b, src);
+    }
+    // 0d0c: mov 29a4, r0
+    {
+        a = 0x29a4;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d10: inc 29a4
+    {
+        a = 0x29a4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0d14: cmp $64, r0
+    {
+        src = uint16_t(0x0064);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d18: bge 0d24
+    if (!(N ^ V))
+        AOT_GOTO(0x0d24, L0d24);
+    AOT_GOTO(0x0d1a, L0d1a);
+L0d1a:
+    AOT_BLOCK(0x0d1a, 2);
+    // 0d1a: mov $1b6e, (sp)
+    {
+        src = uint16_t(0x1b6e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d1e: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x0d22);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L0d22:
+    AOT_BLOCK(0x0d22, 1);
+    // 0d22: br 0d9a
+    AOT_GOTO(0x0d9a, L0d9a);
+L0d24:
+    AOT_BLOCK(0x0d24, 4);
+    // 0d24: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d28: mov 8(r0), r4
+    {
+        a = uint16_t(r[0] + 8);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0d2c: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d2e: beq 0d9a
+    if (Z)
+        AOT_GOTO(0x0d9a, L0d9a);
+    AOT_GOTO(0x0d30, L0d30);
+L0d30:
+    AOT_BLOCK(0x0d30, 4);
+    // 0d30: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d34: mov 8(r0), (sp)
+    {
+        a = uint16_t(r[0] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d38: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d3c: jsr pc, *$130a
+    {
+        a = 0x130a;
+        r[6] -= 2;
+        WR16(r[6], 0x0d40);
+    }
+    AOT_GOTO(0x130a, L130a);
+L0d40:
+    AOT_BLOCK(0x0d40, 3);
+    // 0d40: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0d42: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d44: beq 0d56
+    if (Z)
+        AOT_GOTO(0x0d56, L0d56);
+    AOT_GOTO(0x0d46, L0d46);
+L0d46:
+    AOT_BLOCK(0x0d46, 2);
+    // 0d46: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d48: beq 0d54
+    if (Z)
+        AOT_GOTO(0x0d54, L0d54);
+    AOT_GOTO(0x0d4a, L0d4a);
+L0d4a:
+    AOT_BLOCK(0x0d4a, 3);
+    // 0d4a: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0d4c: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d4e: jsr pc, *$0a98
+    {
+        a = 0x0a98;
+        r[6] -= 2;
+        WR16(r[6], 0x0d52);
+    }
+    AOT_GOTO(0x0a98, L0a98);
+L0d52:
+    AOT_BLOCK(0x0d52, 1);
+    // 0d52: br 0d46
+    AOT_GOTO(0x0d46, L0d46);
+L0d54:
+    AOT_BLOCK(0x0d54, 1);
+    // 0d54: br 0d9a
+    AOT_GOTO(0x0d9a, L0d9a);
+L0d56:
+    AOT_BLOCK(0x0d56, 2);
+    // 0d56: mov $20, (sp)
+    {
+        src = uint16_t(0x0020);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d5a: jsr pc, *$0cca
+    {
+        a = 0x0cca;
+        r[6] -= 2;
+        WR16(r[6], 0x0d5e);
+    }
+    AOT_GOTO(0x0cca, L0cca);
+L0d5e:
+    AOT_BLOCK(0x0d5e, 2);
+    // 0d5e: cmpb $28, (r4)
+    {
+        src = uint8_t(0x28);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0d62: bne 0d6c
+    if (!Z)
+        AOT_GOTO(0x0d6c, L0d6c);
+    AOT_GOTO(0x0d64, L0d64);
+L0d64:
+    AOT_BLOCK(0x0d64, 2);
+    // 0d64: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d66: jsr pc, *$0f38
+    {
+        a = 0x0f38;
+        r[6] -= 2;
+        WR16(r[6], 0x0d6a);
+    }
+    AOT_GOTO(0x0f38, L0f38);
+L0d6a:
+    AOT_BLOCK(0x0d6a, 1);
+    // 0d6a: br 0d7a
+    AOT_GOTO(0x0d7a, L0d7a);
+L0d6c:
+    AOT_BLOCK(0x0d6c, 2);
+    // 0d6c: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d6e: beq 0d7a
+    if (Z)
+        AOT_GOTO(0x0d7a, L0d7a);
+    AOT_GOTO(0x0d70, L0d70);
+L0d70:
+    AOT_BLOCK(0x0d70, 3);
+    // 0d70: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0d72: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d74: jsr pc, *$0cca
+    {
+        a = 0x0cca;
+        r[6] -= 2;
+        WR16(r[6], 0x0d78);
+    }
+    AOT_GOTO(0x0cca, L0cca);
+L0d78:
+    AOT_BLOCK(0x0d78, 1);
+    // 0d78: br 0d6c
+    AOT_GOTO(0x0d6c, L0d6c);
+L0d7a:
+    AOT_BLOCK(0x0d7a, 2);
+    // 0d7a: mov $20, (sp)
+    {
+        src = uint16_t(0x0020);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d7e: jsr pc, *$0cca
+    {
+        a = 0x0cca;
+        r[6] -= 2;
+        WR16(r[6], 0x0d82);
+    }
+    AOT_GOTO(0x0cca, L0cca);
+L0d82:
+    AOT_BLOCK(0x0d82, 2);
+    // 0d82: cmp $2af6, 2bbe
+    {
+        src = uint16_t(0x2af6);
+        b = 0x2bbe;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d88: bcc 0d9a
+    if (!C)
+        AOT_GOTO(0x0d9a, L0d9a);
+    AOT_GOTO(0x0d8a, L0d8a);
+L0d8a:
+    AOT_BLOCK(0x0d8a, 4);
+    // 0d8a: dec 2bbe
+    {
+        a = 0x2bbe;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0d8e: movb *2bbe, r0
+    {
+        a = RD16(0x2bbe);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0d92: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d94: jsr pc, *$0b82
+    {
+        a = 0x0b82;
+        r[6] -= 2;
+        WR16(r[6], 0x0d98);
+    }
+    AOT_GOTO(0x0b82, L0b82);
+L0d98:
+    AOT_BLOCK(0x0d98, 1);
+    // 0d98: br 0d82
+    AOT_GOTO(0x0d82, L0d82);
+L0d9a:
+    AOT_BLOCK(0x0d9a, 2);
+    // 0d9a: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0d9e:
+    AOT_BLOCK(0x0d9e, 4);
+    // 0d9e: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0da2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0da2: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0da6: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0da8, L0da8);
+L0da8:
+    AOT_BLOCK(0x0da8, 2);
+    // 0da8: movb (r3)+, r2
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0daa: beq 0dba
+    if (Z)
+        AOT_GOTO(0x0dba, L0dba);
+    AOT_GOTO(0x0dac, L0dac);
+L0dac:
+    AOT_BLOCK(0x0dac, 2);
+    // 0dac: cmp $2f, r2
+    {
+        src = uint16_t(0x002f);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0db0: bne 0db6
+    if (!Z)
+        AOT_GOTO(0x0db6, L0db6);
+    AOT_GOTO(0x0db2, L0db2);
+L0db2:
+    AOT_BLOCK(0x0db2, 2);
+    // 0db2: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0db4: br 0db8
+    AOT_GOTO(0x0db8, L0db8);
+L0db6:
+    AOT_BLOCK(0x0db6, 1);
+    // 0db6: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0db8, L0db8);
+L0db8:
+    AOT_BLOCK(0x0db8, 1);
+    // 0db8: br 0da8
+    AOT_GOTO(0x0da8, L0da8);
+L0dba:
+    AOT_BLOCK(0x0dba, 3);
+    // 0dba: sub $3, r3
+    {
+        src = uint16_t(0x0003);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 0dbe: cmp $e, r4
+    {
+        src = uint16_t(0x000e);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0dc2: blt 0dd4
+    if (N ^ V)
+        AOT_GOTO(0x0dd4, L0dd4);
+    AOT_GOTO(0x0dc4, L0dc4);
+L0dc4:
+    AOT_BLOCK(0x0dc4, 2);
+    // 0dc4: cmp $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0dc8: bge 0dd4
+    if (!(N ^ V))
+        AOT_GOTO(0x0dd4, L0dd4);
+    AOT_GOTO(0x0dca, L0dca);
+L0dca:
+    AOT_BLOCK(0x0dca, 2);
+    // 0dca: cmpb $2e, (r3)+
+    {
+        src = uint8_t(0x2e);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0dce: bne 0dd4
+    if (!Z)
+        AOT_GOTO(0x0dd4, L0dd4);
+    AOT_GOTO(0x0dd0, L0dd0);
+L0dd0:
+    AOT_BLOCK(0x0dd0, 2);
+    // 0dd0: movb (r3), r0
+    {
+        a = r[3];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0dd2: br 0dd8
+    AOT_GOTO(0x0dd8, L0dd8);
+L0dd4:
+    AOT_BLOCK(0x0dd4, 2);
+    // 0dd4: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0dd6: br 0dd8
+    AOT_GOTO(0x0dd8, L0dd8);
+L0dd8:
+    AOT_BLOCK(0x0dd8, 2);
+    // 0dd8: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ddc:
+    AOT_BLOCK(0x0ddc, 4);
+    // 0ddc: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0de0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0de0: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0de4: jsr pc, *$0eaa
+    {
+        a = 0x0eaa;
+        r[6] -= 2;
+        WR16(r[6], 0x0de8);
+    }
+    AOT_GOTO(0x0eaa, L0eaa);
+L0de8:
+    AOT_BLOCK(0x0de8, 2);
+    // 0de8: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0dea: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0dec, L0dec);
+L0dec:
+    AOT_BLOCK(0x0dec, 2);
+    // 0dec: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0dee: beq 0dfa
+    if (Z)
+        AOT_GOTO(0x0dfa, L0dfa);
+    AOT_GOTO(0x0df0, L0df0);
+L0df0:
+    AOT_BLOCK(0x0df0, 2);
+    // 0df0: cmpb $2f, (r4)+
+    {
+        src = uint8_t(0x2f);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0df4: bne 0df8
+    if (!Z)
+        AOT_GOTO(0x0df8, L0df8);
+    AOT_GOTO(0x0df6, L0df6);
+L0df6:
+    AOT_BLOCK(0x0df6, 1);
+    // 0df6: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0df8, L0df8);
+L0df8:
+    AOT_BLOCK(0x0df8, 1);
+    // 0df8: br 0dec
+    AOT_GOTO(0x0dec, L0dec);
+L0dfa:
+    AOT_BLOCK(0x0dfa, 3);
+    // 0dfa: movb 6(r5), -1(r4)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD8(a);
+        b = uint16_t(r[4] + -1);
+        WR8(b, src);
+    }
+    // 0e00: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e02: br 0e04
+    AOT_GOTO(0x0e04, L0e04);
+L0e04:
+    AOT_BLOCK(0x0e04, 2);
+    // 0e04: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0e08:
+    AOT_BLOCK(0x0e08, 4);
+    // 0e08: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0e0c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0e0c: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 0e10: jsr pc, 15bc
+    {
+        a = 0x15bc;
+        r[6] -= 2;
+        WR16(r[6], 0x0e14);
+    }
+    AOT_GOTO(0x15bc, L15bc);
+L0e14:
+    AOT_BLOCK(0x0e14, 2);
+    // 0e14: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e18: bne 0e40
+    if (!Z)
+        AOT_GOTO(0x0e40, L0e40);
+    AOT_GOTO(0x0e1a, L0e1a);
+L0e1a:
+    AOT_BLOCK(0x0e1a, 3);
+    // 0e1a: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e1e: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e22: jsr pc, *$1594
+    {
+        a = 0x1594;
+        r[6] -= 2;
+        WR16(r[6], 0x0e26);
+    }
+    AOT_GOTO(0x1594, L1594);
+L0e26:
+    AOT_BLOCK(0x0e26, 4);
+    // 0e26: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0e28: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e2c: mov $1b85, -(sp)
+    {
+        src = uint16_t(0x1b85);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e30: jsr pc, *$133e
+    {
+        a = 0x133e;
+        r[6] -= 2;
+        WR16(r[6], 0x0e34);
+    }
+    AOT_GOTO(0x133e, L133e);
+L0e34:
+    AOT_BLOCK(0x0e34, 3);
+    // 0e34: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0e36: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e3a: jsr pc, *$18c6
+    {
+        a = 0x18c6;
+        r[6] -= 2;
+        WR16(r[6], 0x0e3e);
+    }
+    AOT_GOTO(0x18c6, L18c6);
+L0e3e:
+    AOT_BLOCK(0x0e3e, 1);
+    // 0e3e: br 0e56
+    AOT_GOTO(0x0e56, L0e56);
+L0e40:
+    AOT_BLOCK(0x0e40, 2);
+    // 0e40: cmp $ffff, -8(r5)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e46: bne 0e56
+    if (!Z)
+        AOT_GOTO(0x0e56, L0e56);
+    AOT_GOTO(0x0e48, L0e48);
+L0e48:
+    AOT_BLOCK(0x0e48, 2);
+    // 0e48: mov $1b94, (sp)
+    {
+        src = uint16_t(0x1b94);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e4c: jsr pc, *$133e
+    {
+        a = 0x133e;
+        r[6] -= 2;
+        WR16(r[6], 0x0e50);
+    }
+    AOT_GOTO(0x133e, L133e);
+L0e50:
+    AOT_BLOCK(0x0e50, 2);
+    // 0e50: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e54: br 0ea6
+    AOT_GOTO(0x0ea6, L0ea6);
+L0e56:
+    AOT_BLOCK(0x0e56, 3);
+    // 0e56: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e58: add $fff6, (sp)
+    {
+        src = uint16_t(0xfff6);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0e5c: jsr pc, *$18a6
+    {
+        a = 0x18a6;
+        r[6] -= 2;
+        WR16(r[6], 0x0e60);
+    }
+    AOT_GOTO(0x18a6, L18a6);
+L0e60:
+    AOT_BLOCK(0x0e60, 2);
+    // 0e60: cmp -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e64: beq 0e68
+    if (Z)
+        AOT_GOTO(0x0e68, L0e68);
+    AOT_GOTO(0x0e66, L0e66);
+L0e66:
+    AOT_BLOCK(0x0e66, 1);
+    // 0e66: br 0e56
+    AOT_GOTO(0x0e56, L0e56);
+L0e68:
+    AOT_BLOCK(0x0e68, 4);
+    // 0e68: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0e6c: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0e70: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e74: beq 0e98
+    if (Z)
+        AOT_GOTO(0x0e98, L0e98);
+    AOT_GOTO(0x0e76, L0e76);
+L0e76:
+    AOT_BLOCK(0x0e76, 2);
+    // 0e76: cmp $e, -8(r5)
+    {
+        src = uint16_t(0x000e);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e7c: beq 0e98
+    if (Z)
+        AOT_GOTO(0x0e98, L0e98);
+    AOT_GOTO(0x0e7e, L0e7e);
+L0e7e:
+    AOT_BLOCK(0x0e7e, 2);
+    // 0e7e: cmp $2, -8(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e84: beq 0e94
+    if (Z)
+        AOT_GOTO(0x0e94, L0e94);
+    AOT_GOTO(0x0e86, L0e86);
+L0e86:
+    AOT_BLOCK(0x0e86, 3);
+    // 0e86: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e8a: mov $1b9f, -(sp)
+    {
+        src = uint16_t(0x1b9f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e8e: jsr pc, *$133e
+    {
+        a = 0x133e;
+        r[6] -= 2;
+        WR16(r[6], 0x0e92);
+    }
+    AOT_GOTO(0x133e, L133e);
+L0e92:
+    AOT_BLOCK(0x0e92, 1);
+    // 0e92: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0e94, L0e94);
+L0e94:
+    AOT_BLOCK(0x0e94, 1);
+    // 0e94: jsr pc, 0550
+    {
+        a = 0x0550;
+        r[6] -= 2;
+        WR16(r[6], 0x0e98);
+    }
+    AOT_GOTO(0x0550, L0550);
+L0e98:
+    AOT_BLOCK(0x0e98, 4);
+    // 0e98: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0e9c: ash $fff8, r0
+    {
+        src = uint16_t(0xfff8) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0ea0: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0ea4: br 0ea6
+    AOT_GOTO(0x0ea6, L0ea6);
+L0ea6:
+    AOT_BLOCK(0x0ea6, 2);
+    // 0ea6: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0eaa:
+    AOT_BLOCK(0x0eaa, 4);
+    // 0eaa: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0eae;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0eae: mov 1966, r4
+    {
+        a = 0x1966;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0eb2: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0eb6, L0eb6);
+L0eb6:
+    AOT_BLOCK(0x0eb6, 4);
+    // 0eb6: mov 1966, r0
+    {
+        a = 0x1966;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0eba: inc 1966
+    {
+        a = 0x1966;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0ebe: movb (r3)+, (r0)
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0ec0: beq 0ec4
+    if (Z)
+        AOT_GOTO(0x0ec4, L0ec4);
+    AOT_GOTO(0x0ec2, L0ec2);
+L0ec2:
+    AOT_BLOCK(0x0ec2, 1);
+    // 0ec2: br 0eb6
+    AOT_GOTO(0x0eb6, L0eb6);
+L0ec4:
+    AOT_BLOCK(0x0ec4, 2);
+    // 0ec4: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ec6: br 0ec8
+    AOT_GOTO(0x0ec8, L0ec8);
+L0ec8:
+    AOT_BLOCK(0x0ec8, 2);
+    // 0ec8: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ecc:
+    AOT_BLOCK(0x0ecc, 5);
+    // 0ecc: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0ed0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0ed0: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0ed4: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ed6: jsr pc, *$0d9e
+    {
+        a = 0x0d9e;
+        r[6] -= 2;
+        WR16(r[6], 0x0eda);
+    }
+    AOT_GOTO(0x0d9e, L0d9e);
+L0eda:
+    AOT_BLOCK(0x0eda, 2);
+    // 0eda: cmp $6f, r0
+    {
+        src = uint16_t(0x006f);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ede: beq 0ee6
+    if (Z)
+        AOT_GOTO(0x0ee6, L0ee6);
+    AOT_GOTO(0x0ee0, L0ee0);
+L0ee0:
+    AOT_BLOCK(0x0ee0, 2);
+    // 0ee0: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ee4: br 0f18
+    AOT_GOTO(0x0f18, L0f18);
+L0ee6:
+    AOT_BLOCK(0x0ee6, 4);
+    // 0ee6: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0eea: add $2, 4(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0ef0: mov (r0), r4
+    {
+        a = r[0];
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ef2: beq 0f12
+    if (Z)
+        AOT_GOTO(0x0f12, L0f12);
+    AOT_GOTO(0x0ef4, L0ef4);
+L0ef4:
+    AOT_BLOCK(0x0ef4, 2);
+    // 0ef4: movb (r3)+, r2
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0ef6: beq 0f00
+    if (Z)
+        AOT_GOTO(0x0f00, L0f00);
+    AOT_GOTO(0x0ef8, L0ef8);
+L0ef8:
+    AOT_BLOCK(0x0ef8, 3);
+    // 0ef8: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0efa: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0efc: bne 0f00
+    if (!Z)
+        AOT_GOTO(0x0f00, L0f00);
+    AOT_GOTO(0x0efe, L0efe);
+L0efe:
+    AOT_BLOCK(0x0efe, 1);
+    // 0efe: br 0ef4
+    AOT_GOTO(0x0ef4, L0ef4);
+L0f00:
+    AOT_BLOCK(0x0f00, 2);
+    // 0f00: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f02: bne 0f0c
+    if (!Z)
+        AOT_GOTO(0x0f0c, L0f0c);
+    AOT_GOTO(0x0f04, L0f04);
+L0f04:
+    AOT_BLOCK(0x0f04, 2);
+    // 0f04: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f06: bne 0f0c
+    if (!Z)
+        AOT_GOTO(0x0f0c, L0f0c);
+    AOT_GOTO(0x0f08, L0f08);
+L0f08:
+    AOT_BLOCK(0x0f08, 2);
+    // 0f08: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0f0a: br 0f18
+    AOT_GOTO(0x0f18, L0f18);
+L0f0c:
+    AOT_BLOCK(0x0f0c, 2);
+    // 0f0c: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f10: br 0ee6
+    AOT_GOTO(0x0ee6, L0ee6);
+L0f12:
+    AOT_BLOCK(0x0f12, 2);
+    // 0f12: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f16: br 0f18
+    AOT_GOTO(0x0f18, L0f18);
+L0f18:
+    AOT_BLOCK(0x0f18, 2);
+    // 0f18: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0f1c:
+    AOT_BLOCK(0x0f1c, 4);
+    // 0f1c: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0f20;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0f20: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f24: bne 0f2a
+    if (!Z)
+        AOT_GOTO(0x0f2a, L0f2a);
+    AOT_GOTO(0x0f26, L0f26);
+L0f26:
+    AOT_BLOCK(0x0f26, 2);
+    // 0f26: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0f28: br 0f34
+    AOT_GOTO(0x0f34, L0f34);
+L0f2a:
+    AOT_BLOCK(0x0f2a, 2);
+    // 0f2a: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f2e: jsr pc, *$188c
+    {
+        a = 0x188c;
+        r[6] -= 2;
+        WR16(r[6], 0x0f32);
+    }
+    AOT_GOTO(0x188c, L188c);
+L0f32:
+    AOT_BLOCK(0x0f32, 1);
+    // 0f32: br 0f34
+    AOT_GOTO(0x0f34, L0f34);
+L0f34:
+    AOT_BLOCK(0x0f34, 2);
+    // 0f34: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0f38:
+    AOT_BLOCK(0x0f38, 6);
+    // 0f38: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0f3c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0f3c: sub $13a, sp
+    {
+        src = uint16_t(0x013a);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0f40: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0f42: add $feca, r0
+    {
+        src = uint16_t(0xfeca);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0f46: mov r0, -138(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -312);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f4a, L0f4a);
+L0f4a:
+    AOT_BLOCK(0x0f4a, 6);
+    // 0f4a: mov -138(r5), r0
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f4e: inc -138(r5)
+    {
+        a = uint16_t(r[5] + -312);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0f52: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0f56: inc 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0f5a: movb (r1), (r0)
+    {
+        a = r[1];
+        src = RD8(a);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0f5c: beq 0f60
+    if (Z)
+        AOT_GOTO(0x0f60, L0f60);
+    AOT_GOTO(0x0f5e, L0f5e);
+L0f5e:
+    AOT_BLOCK(0x0f5e, 1);
+    // 0f5e: br 0f4a
+    AOT_GOTO(0x0f4a, L0f4a);
+L0f60:
+    AOT_BLOCK(0x0f60, 4);
+    // 0f60: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0f62: add $feca, r0
+    {
+        src = uint16_t(0xfeca);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0f66: mov r0, 4(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 4);
+        WR16(b, src);
+    }
+    // 0f6a: clr -13a(r5)
+    {
+        a = uint16_t(r[5] + -314);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0f6e, L0f6e);
+L0f6e:
+    AOT_BLOCK(0x0f6e, 3);
+    // 0f6e: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f70: add $4, (sp)
+    {
+        src = uint16_t(0x0004);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0f74: jsr pc, *$10ba
+    {
+        a = 0x10ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0f78);
+    }
+    AOT_GOTO(0x10ba, L10ba);
+L0f78:
+    AOT_BLOCK(0x0f78, 5);
+    // 0f78: mov -13a(r5), r1
+    {
+        a = uint16_t(r[5] + -314);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0f7c: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0f7e: add r5, r1
+    {
+        src = r[5];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0f80: mov r0, -92(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + -146);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f84: beq 0f8c
+    if (Z)
+        AOT_GOTO(0x0f8c, L0f8c);
+    AOT_GOTO(0x0f86, L0f86);
+L0f86:
+    AOT_BLOCK(0x0f86, 2);
+    // 0f86: inc -13a(r5)
+    {
+        a = uint16_t(r[5] + -314);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0f8a: br 0f6e
+    AOT_GOTO(0x0f6e, L0f6e);
+L0f8c:
+    AOT_BLOCK(0x0f8c, 3);
+    // 0f8c: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0f8e: add $ff96, r0
+    {
+        src = uint16_t(0xff96);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0f92: mov r0, -d0(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -208);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f96, L0f96);
+L0f96:
+    AOT_BLOCK(0x0f96, 1);
+    // 0f96: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x0f9a);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L0f9a:
+    AOT_BLOCK(0x0f9a, 3);
+    // 0f9a: mov r0, -140(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -320);
+        WR16(b, src);
+    }
+    // 0f9e: cmp $20, r0
+    {
+        src = uint16_t(0x0020);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0fa2: bne 0fa6
+    if (!Z)
+        AOT_GOTO(0x0fa6, L0fa6);
+    AOT_GOTO(0x0fa4, L0fa4);
+L0fa4:
+    AOT_BLOCK(0x0fa4, 1);
+    // 0fa4: br 0f96
+    AOT_GOTO(0x0f96, L0f96);
+L0fa6:
+    AOT_BLOCK(0x0fa6, 2);
+    // 0fa6: cmp $28, -140(r5)
+    {
+        src = uint16_t(0x0028);
+        b = uint16_t(r[5] + -320);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0fac: beq 0fba
+    if (Z)
+        AOT_GOTO(0x0fba, L0fba);
+    AOT_GOTO(0x0fae, L0fae);
+L0fae:
+    AOT_BLOCK(0x0fae, 2);
+    // 0fae: mov $1bb2, (sp)
+    {
+        src = uint16_t(0x1bb2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fb2: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x0fb6);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L0fb6:
+    AOT_BLOCK(0x0fb6, 1);
+    // 0fb6: jmp *$10b6
+    {
+        a = 0x10b6;
+    }
+    AOT_GOTO(0x10b6, L10b6);
+L0fba:
+    AOT_BLOCK(0x0fba, 2);
+    // 0fba: mov -140(r5), (sp)
+    {
+        a = uint16_t(r[5] + -320);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fbe: jsr pc, *$0b82
+    {
+        a = 0x0b82;
+        r[6] -= 2;
+        WR16(r[6], 0x0fc2);
+    }
+    AOT_GOTO(0x0b82, L0b82);
+L0fc2:
+    AOT_BLOCK(0x0fc2, 1);
+    // 0fc2: clr -13c(r5)
+    {
+        a = uint16_t(r[5] + -316);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0fc6, L0fc6);
+L0fc6:
+    AOT_BLOCK(0x0fc6, 3);
+    // 0fc6: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fc8: add $ff30, (sp)
+    {
+        src = uint16_t(0xff30);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0fcc: jsr pc, *$114a
+    {
+        a = 0x114a;
+        r[6] -= 2;
+        WR16(r[6], 0x0fd0);
+    }
+    AOT_GOTO(0x114a, L114a);
+L0fd0:
+    AOT_BLOCK(0x0fd0, 5);
+    // 0fd0: mov -13c(r5), r1
+    {
+        a = uint16_t(r[5] + -316);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0fd4: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0fd6: add r5, r1
+    {
+        src = r[5];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0fd8: mov r0, -ba(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + -186);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fdc: beq 0fe4
+    if (Z)
+        AOT_GOTO(0x0fe4, L0fe4);
+    AOT_GOTO(0x0fde, L0fde);
+L0fde:
+    AOT_BLOCK(0x0fde, 2);
+    // 0fde: inc -13c(r5)
+    {
+        a = uint16_t(r[5] + -316);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0fe2: br 0fc6
+    AOT_GOTO(0x0fc6, L0fc6);
+L0fe4:
+    AOT_BLOCK(0x0fe4, 2);
+    // 0fe4: cmp -13a(r5), -13c(r5)
+    {
+        a = uint16_t(r[5] + -314);
+        src = RD16(a);
+        b = uint16_t(r[5] + -316);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0fea: beq 0ff6
+    if (Z)
+        AOT_GOTO(0x0ff6, L0ff6);
+    AOT_GOTO(0x0fec, L0fec);
+L0fec:
+    AOT_BLOCK(0x0fec, 2);
+    // 0fec: mov $1bd6, (sp)
+    {
+        src = uint16_t(0x1bd6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ff0: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x0ff4);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L0ff4:
+    AOT_BLOCK(0x0ff4, 1);
+    // 0ff4: br 10b6
+    AOT_GOTO(0x10b6, L10b6);
+L0ff6:
+    AOT_BLOCK(0x0ff6, 4);
+    // 0ff6: movb *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0ffa: inc 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0ffe: mov r0, -140(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -320);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1002: beq 10b6
+    if (Z)
+        AOT_GOTO(0x10b6, L10b6);
+    AOT_GOTO(0x1004, L1004);
+L1004:
+    AOT_BLOCK(0x1004, 2);
+    // 1004: mov -140(r5), (sp)
+    {
+        a = uint16_t(r[5] + -320);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1008: jsr pc, *$12a2
+    {
+        a = 0x12a2;
+        r[6] -= 2;
+        WR16(r[6], 0x100c);
+    }
+    AOT_GOTO(0x12a2, L12a2);
+L100c:
+    AOT_BLOCK(0x100c, 2);
+    // 100c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 100e: bne 101a
+    if (!Z)
+        AOT_GOTO(0x101a, L101a);
+    AOT_GOTO(0x1010, L1010);
+L1010:
+    AOT_BLOCK(0x1010, 2);
+    // 1010: mov -140(r5), (sp)
+    {
+        a = uint16_t(r[5] + -320);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1014: jsr pc, *$0cca
+    {
+        a = 0x0cca;
+        r[6] -= 2;
+        WR16(r[6], 0x1018);
+    }
+    AOT_GOTO(0x0cca, L0cca);
+L1018:
+    AOT_BLOCK(0x1018, 1);
+    // 1018: br 10b4
+    AOT_GOTO(0x10b4, L10b4);
+L101a:
+    AOT_BLOCK(0x101a, 5);
+    // 101a: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 101c: add $ff32, r0
+    {
+        src = uint16_t(0xff32);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1020: mov r0, -d2(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -210);
+        WR16(b, src);
+    }
+    // 1024: movb -140(r5), *-d2(r5)
+    {
+        a = uint16_t(r[5] + -320);
+        src = RD8(a);
+        b = RD16(r[5] + -210);
+        WR8(b, src);
+    }
+    // 102a: inc -d2(r5)
+    {
+        a = uint16_t(r[5] + -210);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x102e, L102e);
+L102e:
+    AOT_BLOCK(0x102e, 3);
+    // 102e: movb *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1032: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1034: jsr pc, *$12dc
+    {
+        a = 0x12dc;
+        r[6] -= 2;
+        WR16(r[6], 0x1038);
+    }
+    AOT_GOTO(0x12dc, L12dc);
+L1036:
+    AOT_BLOCK(0x1036, 1);
+    // 1036: mov (r3), *(r4)+
+    {
+        a = r[3];
+        src = RD16(a);
+        b = RD16(r[4]);
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1038, L1038);
+L1038:
+    AOT_BLOCK(0x1038, 2);
+    // 1038: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 103a: beq 104c
+    if (Z)
+        AOT_GOTO(0x104c, L104c);
+    AOT_GOTO(0x103c, L103c);
+L103c:
+    AOT_BLOCK(0x103c, 4);
+    // 103c: movb *4(r5), *-d2(r5)
+    {
+        a = RD16(r[5] + 4);
+        src = RD8(a);
+        b = RD16(r[5] + -210);
+        WR8(b, src);
+    }
+    // 1042: inc -d2(r5)
+    {
+        a = uint16_t(r[5] + -210);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1046: inc 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 104a: br 102e
+    AOT_GOTO(0x102e, L102e);
+L104c:
+    AOT_BLOCK(0x104c, 2);
+    // 104c: clrb *-d2(r5)
+    {
+        a = RD16(r[5] + -210);
+        WR8(a, 0);
+    }
+    // 1050: clr -13c(r5)
+    {
+        a = uint16_t(r[5] + -316);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1054, L1054);
+L1054:
+    AOT_BLOCK(0x1054, 2);
+    // 1054: cmp -13a(r5), -13c(r5)
+    {
+        a = uint16_t(r[5] + -314);
+        src = RD16(a);
+        b = uint16_t(r[5] + -316);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 105a: ble 107e
+    if (Z || (N ^ V))
+        AOT_GOTO(0x107e, L107e);
+    AOT_GOTO(0x105c, L105c);
+L105c:
+    AOT_BLOCK(0x105c, 7);
+    // 105c: mov -13c(r5), r0
+    {
+        a = uint16_t(r[5] + -316);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1060: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1062: add r5, r0
+    {
+        src = r[5];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1064: mov -92(r0), (sp)
+    {
+        a = uint16_t(r[0] + -146);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1068: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 106a: add $ff32, (sp)
+    {
+        src = uint16_t(0xff32);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 106e: jsr pc, *$130a
+    {
+        a = 0x130a;
+        r[6] -= 2;
+        WR16(r[6], 0x1072);
+    }
+    AOT_GOTO(0x130a, L130a);
+L1072:
+    AOT_BLOCK(0x1072, 3);
+    // 1072: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1074: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1076: bne 107e
+    if (!Z)
+        AOT_GOTO(0x107e, L107e);
+    AOT_GOTO(0x1078, L1078);
+L1078:
+    AOT_BLOCK(0x1078, 2);
+    // 1078: inc -13c(r5)
+    {
+        a = uint16_t(r[5] + -316);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 107c: br 1054
+    AOT_GOTO(0x1054, L1054);
+L107e:
+    AOT_BLOCK(0x107e, 2);
+    // 107e: cmp -13a(r5), -13c(r5)
+    {
+        a = uint16_t(r[5] + -314);
+        src = RD16(a);
+        b = uint16_t(r[5] + -316);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1084: ble 1094
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1094, L1094);
+    AOT_GOTO(0x1086, L1086);
+L1086:
+    AOT_BLOCK(0x1086, 5);
+    // 1086: mov -13c(r5), r0
+    {
+        a = uint16_t(r[5] + -316);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 108a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 108c: add r5, r0
+    {
+        src = r[5];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 108e: mov -ba(r0), r0
+    {
+        a = uint16_t(r[0] + -186);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1092: br 109a
+    AOT_GOTO(0x109a, L109a);
+L1094:
+    AOT_BLOCK(0x1094, 2);
+    // 1094: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 1096: add $ff32, r0
+    {
+        src = uint16_t(0xff32);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x109a, L109a);
+L109a:
+    AOT_BLOCK(0x109a, 1);
+    // 109a: mov r0, -d2(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -210);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x109e, L109e);
+L109e:
+    AOT_BLOCK(0x109e, 2);
+    // 109e: tstb *-d2(r5)
+    {
+        a = RD16(r[5] + -210);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10a2: beq 10b4
+    if (Z)
+        AOT_GOTO(0x10b4, L10b4);
+    AOT_GOTO(0x10a4, L10a4);
+L10a4:
+    AOT_BLOCK(0x10a4, 4);
+    // 10a4: movb *-d2(r5), r0
+    {
+        a = RD16(r[5] + -210);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 10a8: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10aa: inc -d2(r5)
+    {
+        a = uint16_t(r[5] + -210);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 10ae: jsr pc, *$0cca
+    {
+        a = 0x0cca;
+        r[6] -= 2;
+        WR16(r[6], 0x10b2);
+    }
+    AOT_GOTO(0x0cca, L0cca);
+L10b2:
+    AOT_BLOCK(0x10b2, 1);
+    // 10b2: br 109e
+    AOT_GOTO(0x109e, L109e);
+L10b4:
+    AOT_BLOCK(0x10b4, 1);
+    // 10b4: br 0ff6
+    AOT_GOTO(0x0ff6, L0ff6);
+L10b6:
+    AOT_BLOCK(0x10b6, 2);
+    // 10b6: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L10ba:
+    AOT_BLOCK(0x10ba, 11);
+    // 10ba: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x10be;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 10be: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 10c2: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 10c6: movb (r0), r0
+    {
+        a = r[0];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 10c8: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 10cc: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 10d0: inc *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 10d4: clrb (r0)
+    {
+        a = r[0];
+        WR8(a, 0);
+    }
+    // 10d6: cmp $29, -a(r5)
+    {
+        src = uint16_t(0x0029);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 10dc: bne 10e2
+    if (!Z)
+        AOT_GOTO(0x10e2, L10e2);
+    AOT_GOTO(0x10de, L10de);
+L10de:
+    AOT_BLOCK(0x10de, 2);
+    // 10de: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 10e0: br 1146
+    AOT_GOTO(0x1146, L1146);
+L10e2:
+    AOT_BLOCK(0x10e2, 3);
+    // 10e2: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 10e6: cmpb $20, (r0)
+    {
+        src = uint8_t(0x20);
+        b = r[0];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 10ea: bne 10f2
+    if (!Z)
+        AOT_GOTO(0x10f2, L10f2);
+    AOT_GOTO(0x10ec, L10ec);
+L10ec:
+    AOT_BLOCK(0x10ec, 2);
+    // 10ec: inc *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 10f0: br 10e2
+    AOT_GOTO(0x10e2, L10e2);
+L10f2:
+    AOT_BLOCK(0x10f2, 1);
+    // 10f2: mov *4(r5), -8(r5)
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x10f8, L10f8);
+L10f8:
+    AOT_BLOCK(0x10f8, 5);
+    // 10f8: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 10fc: movb (r0), r0
+    {
+        a = r[0];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 10fe: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1102: cmp $2c, r0
+    {
+        src = uint16_t(0x002c);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1106: beq 1140
+    if (Z)
+        AOT_GOTO(0x1140, L1140);
+    AOT_GOTO(0x1108, L1108);
+L1108:
+    AOT_BLOCK(0x1108, 2);
+    // 1108: cmp $29, -a(r5)
+    {
+        src = uint16_t(0x0029);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 110e: beq 1140
+    if (Z)
+        AOT_GOTO(0x1140, L1140);
+    AOT_GOTO(0x1110, L1110);
+L1110:
+    AOT_BLOCK(0x1110, 2);
+    // 1110: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1114: jsr pc, *$12dc
+    {
+        a = 0x12dc;
+        r[6] -= 2;
+        WR16(r[6], 0x1118);
+    }
+    AOT_GOTO(0x12dc, L12dc);
+L1118:
+    AOT_BLOCK(0x1118, 2);
+    // 1118: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 111a: beq 1130
+    if (Z)
+        AOT_GOTO(0x1130, L1130);
+    AOT_GOTO(0x111c, L111c);
+L111c:
+    AOT_BLOCK(0x111c, 2);
+    // 111c: cmp -8(r5), *4(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = RD16(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1122: bne 113a
+    if (!Z)
+        AOT_GOTO(0x113a, L113a);
+    AOT_GOTO(0x1124, L1124);
+L1124:
+    AOT_BLOCK(0x1124, 2);
+    // 1124: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1128: jsr pc, *$12a2
+    {
+        a = 0x12a2;
+        r[6] -= 2;
+        WR16(r[6], 0x112c);
+    }
+    AOT_GOTO(0x12a2, L12a2);
+L112c:
+    AOT_BLOCK(0x112c, 2);
+    // 112c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 112e: bne 113a
+    if (!Z)
+        AOT_GOTO(0x113a, L113a);
+    AOT_GOTO(0x1130, L1130);
+L1130:
+    AOT_BLOCK(0x1130, 2);
+    // 1130: mov $1bef, (sp)
+    {
+        src = uint16_t(0x1bef);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1134: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x1138);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L1138:
+    AOT_BLOCK(0x1138, 1);
+    // 1138: br 1140
+    AOT_GOTO(0x1140, L1140);
+L113a:
+    AOT_BLOCK(0x113a, 2);
+    // 113a: inc *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 113e: br 10f8
+    AOT_GOTO(0x10f8, L10f8);
+L1140:
+    AOT_BLOCK(0x1140, 2);
+    // 1140: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1144: br 1146
+    AOT_GOTO(0x1146, L1146);
+L1146:
+    AOT_BLOCK(0x1146, 2);
+    // 1146: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L114a:
+    AOT_BLOCK(0x114a, 6);
+    // 114a: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x114e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 114e: sub $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1152: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+        C = false;
+    }
+    // 1156: mov *4(r5), -8(r5)
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 115c: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x1160);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L1160:
+    AOT_BLOCK(0x1160, 2);
+    // 1160: cmp $29, r0
+    {
+        src = uint16_t(0x0029);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1164: bne 116c
+    if (!Z)
+        AOT_GOTO(0x116c, L116c);
+    AOT_GOTO(0x1166, L1166);
+L1166:
+    AOT_BLOCK(0x1166, 2);
+    // 1166: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1168: jmp *$129e
+    {
+        a = 0x129e;
+    }
+    AOT_GOTO(0x129e, L129e);
+L116c:
+    AOT_BLOCK(0x116c, 1);
+    // 116c: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x1170);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L1170:
+    AOT_BLOCK(0x1170, 3);
+    // 1170: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1174: cmp $2c, r0
+    {
+        src = uint16_t(0x002c);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1178: beq 1182
+    if (Z)
+        AOT_GOTO(0x1182, L1182);
+    AOT_GOTO(0x117a, L117a);
+L117a:
+    AOT_BLOCK(0x117a, 2);
+    // 117a: cmp $29, -a(r5)
+    {
+        src = uint16_t(0x0029);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1180: bne 118c
+    if (!Z)
+        AOT_GOTO(0x118c, L118c);
+    AOT_GOTO(0x1182, L1182);
+L1182:
+    AOT_BLOCK(0x1182, 2);
+    // 1182: tst -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1186: bgt 118c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x118c, L118c);
+    AOT_GOTO(0x1188, L1188);
+L1188:
+    AOT_BLOCK(0x1188, 1);
+    // 1188: jmp *$1286
+    {
+        a = 0x1286;
+    }
+    AOT_GOTO(0x1286, L1286);
+L118c:
+    AOT_BLOCK(0x118c, 2);
+    // 118c: cmp $22, -a(r5)
+    {
+        src = uint16_t(0x0022);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1192: beq 119c
+    if (Z)
+        AOT_GOTO(0x119c, L119c);
+    AOT_GOTO(0x1194, L1194);
+L1194:
+    AOT_BLOCK(0x1194, 2);
+    // 1194: cmp $27, -a(r5)
+    {
+        src = uint16_t(0x0027);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 119a: bne 1224
+    if (!Z)
+        AOT_GOTO(0x1224, L1224);
+    AOT_GOTO(0x119c, L119c);
+L119c:
+    AOT_BLOCK(0x119c, 3);
+    // 119c: mov -a(r5), -c(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 11a2: cmp $27, -c(r5)
+    {
+        src = uint16_t(0x0027);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11a8: bne 11b6
+    if (!Z)
+        AOT_GOTO(0x11b6, L11b6);
+    AOT_GOTO(0x11aa, L11aa);
+L11aa:
+    AOT_BLOCK(0x11aa, 3);
+    // 11aa: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11ae: inc *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 11b2: movb $27, (r0)
+    {
+        src = uint8_t(0x27);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x11b6, L11b6);
+L11b6:
+    AOT_BLOCK(0x11b6, 1);
+    // 11b6: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x11ba);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L11ba:
+    AOT_BLOCK(0x11ba, 3);
+    // 11ba: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 11be: cmp -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11c2: beq 120e
+    if (Z)
+        AOT_GOTO(0x120e, L120e);
+    AOT_GOTO(0x11c4, L11c4);
+L11c4:
+    AOT_BLOCK(0x11c4, 2);
+    // 11c4: cmp $a, -a(r5)
+    {
+        src = uint16_t(0x000a);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11ca: bne 11d6
+    if (!Z)
+        AOT_GOTO(0x11d6, L11d6);
+    AOT_GOTO(0x11cc, L11cc);
+L11cc:
+    AOT_BLOCK(0x11cc, 2);
+    // 11cc: mov $1c0f, (sp)
+    {
+        src = uint16_t(0x1c0f);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11d0: jsr pc, *$0a64
+    {
+        a = 0x0a64;
+        r[6] -= 2;
+        WR16(r[6], 0x11d4);
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L11d4:
+    AOT_BLOCK(0x11d4, 1);
+    // 11d4: br 120e
+    AOT_GOTO(0x120e, L120e);
+L11d6:
+    AOT_BLOCK(0x11d6, 2);
+    // 11d6: cmp $5c, -a(r5)
+    {
+        src = uint16_t(0x005c);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11dc: bne 1200
+    if (!Z)
+        AOT_GOTO(0x1200, L1200);
+    AOT_GOTO(0x11de, L11de);
+L11de:
+    AOT_BLOCK(0x11de, 1);
+    // 11de: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x11e2);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L11e2:
+    AOT_BLOCK(0x11e2, 3);
+    // 11e2: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 11e6: cmp -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11ea: beq 1200
+    if (Z)
+        AOT_GOTO(0x1200, L1200);
+    AOT_GOTO(0x11ec, L11ec);
+L11ec:
+    AOT_BLOCK(0x11ec, 2);
+    // 11ec: cmp $5c, -a(r5)
+    {
+        src = uint16_t(0x005c);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11f2: beq 1200
+    if (Z)
+        AOT_GOTO(0x1200, L1200);
+    AOT_GOTO(0x11f4, L11f4);
+L11f4:
+    AOT_BLOCK(0x11f4, 3);
+    // 11f4: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11f8: inc *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 11fc: movb $5c, (r0)
+    {
+        src = uint8_t(0x5c);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1200, L1200);
+L1200:
+    AOT_BLOCK(0x1200, 4);
+    // 1200: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1204: inc *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1208: movb -a(r5), (r0)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD8(a);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 120c: br 11b6
+    AOT_GOTO(0x11b6, L11b6);
+L120e:
+    AOT_BLOCK(0x120e, 2);
+    // 120e: cmp $27, -c(r5)
+    {
+        src = uint16_t(0x0027);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1214: bne 1222
+    if (!Z)
+        AOT_GOTO(0x1222, L1222);
+    AOT_GOTO(0x1216, L1216);
+L1216:
+    AOT_BLOCK(0x1216, 3);
+    // 1216: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 121a: inc *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 121e: movb $27, (r0)
+    {
+        src = uint8_t(0x27);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1222, L1222);
+L1222:
+    AOT_BLOCK(0x1222, 1);
+    // 1222: br 1282
+    AOT_GOTO(0x1282, L1282);
+L1224:
+    AOT_BLOCK(0x1224, 2);
+    // 1224: cmp $5c, -a(r5)
+    {
+        src = uint16_t(0x005c);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 122a: bne 125e
+    if (!Z)
+        AOT_GOTO(0x125e, L125e);
+    AOT_GOTO(0x122c, L122c);
+L122c:
+    AOT_BLOCK(0x122c, 1);
+    // 122c: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x1230);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L1230:
+    AOT_BLOCK(0x1230, 3);
+    // 1230: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1234: cmp $22, -a(r5)
+    {
+        src = uint16_t(0x0022);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 123a: beq 1250
+    if (Z)
+        AOT_GOTO(0x1250, L1250);
+    AOT_GOTO(0x123c, L123c);
+L123c:
+    AOT_BLOCK(0x123c, 2);
+    // 123c: cmp $5c, -a(r5)
+    {
+        src = uint16_t(0x005c);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1242: beq 1250
+    if (Z)
+        AOT_GOTO(0x1250, L1250);
+    AOT_GOTO(0x1244, L1244);
+L1244:
+    AOT_BLOCK(0x1244, 3);
+    // 1244: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1248: inc *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 124c: movb $5c, (r0)
+    {
+        src = uint8_t(0x5c);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1250, L1250);
+L1250:
+    AOT_BLOCK(0x1250, 4);
+    // 1250: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1254: inc *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1258: movb -a(r5), (r0)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD8(a);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 125c: br 1282
+    AOT_GOTO(0x1282, L1282);
+L125e:
+    AOT_BLOCK(0x125e, 5);
+    // 125e: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1262: inc *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1266: movb -a(r5), (r0)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD8(a);
+        b = r[0];
+        WR8(b, src);
+    }
+    // 126a: cmp $28, -a(r5)
+    {
+        src = uint16_t(0x0028);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1270: bne 1276
+    if (!Z)
+        AOT_GOTO(0x1276, L1276);
+    AOT_GOTO(0x1272, L1272);
+L1272:
+    AOT_BLOCK(0x1272, 1);
+    // 1272: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1276, L1276);
+L1276:
+    AOT_BLOCK(0x1276, 2);
+    // 1276: cmp $29, -a(r5)
+    {
+        src = uint16_t(0x0029);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 127c: bne 1282
+    if (!Z)
+        AOT_GOTO(0x1282, L1282);
+    AOT_GOTO(0x127e, L127e);
+L127e:
+    AOT_BLOCK(0x127e, 1);
+    // 127e: dec -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x1282, L1282);
+L1282:
+    AOT_BLOCK(0x1282, 1);
+    // 1282: jmp *$116c
+    {
+        a = 0x116c;
+    }
+    AOT_GOTO(0x116c, L116c);
+L1286:
+    AOT_BLOCK(0x1286, 5);
+    // 1286: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 128a: inc *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 128e: clrb (r0)
+    {
+        a = r[0];
+        WR8(a, 0);
+        C = false;
+    }
+    // 1290: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1294: jsr pc, *$0b82
+    {
+        a = 0x0b82;
+        r[6] -= 2;
+        WR16(r[6], 0x1298);
+    }
+    AOT_GOTO(0x0b82, L0b82);
+L1298:
+    AOT_BLOCK(0x1298, 2);
+    // 1298: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 129c: br 129e
+    AOT_GOTO(0x129e, L129e);
+L129e:
+    AOT_BLOCK(0x129e, 2);
+    // 129e: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12a2:
+    AOT_BLOCK(0x12a2, 4);
+    // 12a2: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x12a6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 12a6: cmp $61, 4(r5)
+    {
+        src = uint16_t(0x0061);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12ac: bgt 12b6
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x12b6, L12b6);
+    AOT_GOTO(0x12ae, L12ae);
+L12ae:
+    AOT_BLOCK(0x12ae, 2);
+    // 12ae: cmp $7a, 4(r5)
+    {
+        src = uint16_t(0x007a);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12b4: bge 12ce
+    if (!(N ^ V))
+        AOT_GOTO(0x12ce, L12ce);
+    AOT_GOTO(0x12b6, L12b6);
+L12b6:
+    AOT_BLOCK(0x12b6, 2);
+    // 12b6: cmp $41, 4(r5)
+    {
+        src = uint16_t(0x0041);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12bc: bgt 12c6
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x12c6, L12c6);
+    AOT_GOTO(0x12be, L12be);
+L12be:
+    AOT_BLOCK(0x12be, 2);
+    // 12be: cmp $5a, 4(r5)
+    {
+        src = uint16_t(0x005a);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12c4: bge 12ce
+    if (!(N ^ V))
+        AOT_GOTO(0x12ce, L12ce);
+    AOT_GOTO(0x12c6, L12c6);
+L12c6:
+    AOT_BLOCK(0x12c6, 2);
+    // 12c6: cmp $5f, 4(r5)
+    {
+        src = uint16_t(0x005f);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12cc: bne 12d4
+    if (!Z)
+        AOT_GOTO(0x12d4, L12d4);
+    AOT_GOTO(0x12ce, L12ce);
+L12ce:
+    AOT_BLOCK(0x12ce, 2);
+    // 12ce: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12d2: br 12d8
+    AOT_GOTO(0x12d8, L12d8);
+L12d4:
+    AOT_BLOCK(0x12d4, 2);
+    // 12d4: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 12d6: br 12d8
+    AOT_GOTO(0x12d8, L12d8);
+L12d8:
+    AOT_BLOCK(0x12d8, 2);
+    // 12d8: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12dc:
+    AOT_BLOCK(0x12dc, 4);
+    // 12dc: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x12e0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 12e0: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12e4: jsr pc, *$12a2
+    {
+        a = 0x12a2;
+        r[6] -= 2;
+        WR16(r[6], 0x12e8);
+    }
+    AOT_GOTO(0x12a2, L12a2);
+L12e8:
+    AOT_BLOCK(0x12e8, 2);
+    // 12e8: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 12ea: bne 12fc
+    if (!Z)
+        AOT_GOTO(0x12fc, L12fc);
+    AOT_GOTO(0x12ec, L12ec);
+L12ec:
+    AOT_BLOCK(0x12ec, 2);
+    // 12ec: cmp $30, 4(r5)
+    {
+        src = uint16_t(0x0030);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12f2: bgt 1302
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1302, L1302);
+    AOT_GOTO(0x12f4, L12f4);
+L12f4:
+    AOT_BLOCK(0x12f4, 2);
+    // 12f4: cmp $39, 4(r5)
+    {
+        src = uint16_t(0x0039);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12fa: blt 1302
+    if (N ^ V)
+        AOT_GOTO(0x1302, L1302);
+    AOT_GOTO(0x12fc, L12fc);
+L12fc:
+    AOT_BLOCK(0x12fc, 2);
+    // 12fc: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1300: br 1306
+    AOT_GOTO(0x1306, L1306);
+L1302:
+    AOT_BLOCK(0x1302, 2);
+    // 1302: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1304: br 1306
+    AOT_GOTO(0x1306, L1306);
+L1306:
+    AOT_BLOCK(0x1306, 2);
+    // 1306: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L130a:
+    AOT_BLOCK(0x130a, 3);
+    // 130a: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x130e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 130e: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1310, L1310);
+L1310:
+    AOT_BLOCK(0x1310, 7);
+    // 1310: movb *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1314: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1318: inc 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 131c: movb *6(r5), r1
+    {
+        a = RD16(r[5] + 6);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 1320: inc 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1324: cmp r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1326: bne 1336
+    if (!Z)
+        AOT_GOTO(0x1336, L1336);
+    AOT_GOTO(0x1328, L1328);
+L1328:
+    AOT_BLOCK(0x1328, 2);
+    // 1328: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 132c: bne 1334
+    if (!Z)
+        AOT_GOTO(0x1334, L1334);
+    AOT_GOTO(0x132e, L132e);
+L132e:
+    AOT_BLOCK(0x132e, 2);
+    // 132e: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1332: br 133a
+    AOT_GOTO(0x133a, L133a);
+L1334:
+    AOT_BLOCK(0x1334, 1);
+    // 1334: br 1310
+    AOT_GOTO(0x1310, L1310);
+L1336:
+    AOT_BLOCK(0x1336, 2);
+    // 1336: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1338: br 133a
+    AOT_GOTO(0x133a, L133a);
+L133a:
+    AOT_BLOCK(0x133a, 2);
+    // 133a: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L133e:
+    AOT_BLOCK(0x133e, 6);
+    // 133e: jsr r5, 193c
+    {
+        a = 0x193c;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1342;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1342: sub $7e, sp
+    {
+        src = uint16_t(0x007e);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1346: mov 4(r5), 2bc8
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x2bc8;
+        WR16(b, src);
+    }
+    // 134c: mov r5, r4
+    {
+        src = r[5];
+        r[4] = src;
+    }
+    // 134e: add $6, r4
+    {
+        src = uint16_t(0x0006);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1352, L1352);
+L1352:
+    AOT_BLOCK(0x1352, 2);
+    // 1352: movb *2bc8, r0
+    {
+        a = RD16(0x2bc8);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1356: beq 136a
+    if (Z)
+        AOT_GOTO(0x136a, L136a);
+    AOT_GOTO(0x1358, L1358);
+L1358:
+    AOT_BLOCK(0x1358, 3);
+    // 1358: inc 2bc8
+    {
+        a = 0x2bc8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 135c: cmp r0, $25
+    {
+        src = r[0];
+        dst = uint16_t(0x0025);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1360: beq 136e
+    if (Z)
+        AOT_GOTO(0x136e, L136e);
+    AOT_GOTO(0x1362, L1362);
+L1362:
+    AOT_BLOCK(0x1362, 2);
+    // 1362: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1364: jsr pc, *$14f0
+    {
+        a = 0x14f0;
+        r[6] -= 2;
+        WR16(r[6], 0x1368);
+    }
+    AOT_GOTO(0x14f0, L14f0);
+L1368:
+    AOT_BLOCK(0x1368, 1);
+    // 1368: br 1352
+    AOT_GOTO(0x1352, L1352);
+L136a:
+    AOT_BLOCK(0x136a, 2);
+    // 136a: jmp 194a
+    {
+        a = 0x194a;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L136e:
+    AOT_BLOCK(0x136e, 4);
+    // 136e: clr 2bca
+    {
+        a = 0x2bca;
+        WR16(a, 0);
+    }
+    // 1372: clr 2bce
+    {
+        a = 0x2bce;
+        WR16(a, 0);
+    }
+    // 1376: cmpb *2bc8, $2d
+    {
+        a = RD16(0x2bc8);
+        src = RD8(a);
+        dst = uint8_t(0x2d);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 137c: bne 1386
+    if (!Z)
+        AOT_GOTO(0x1386, L1386);
+    AOT_GOTO(0x137e, L137e);
+L137e:
+    AOT_BLOCK(0x137e, 2);
+    // 137e: inc 2bc8
+    {
+        a = 0x2bc8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1382: inc 2bca
+    {
+        a = 0x2bca;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1386, L1386);
+L1386:
+    AOT_BLOCK(0x1386, 1);
+    // 1386: jsr r3, 14b2
+    {
+        a = 0x14b2;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x138a;
+    }
+    AOT_GOTO(0x14b2, L14b2);
+L138a:
+    AOT_BLOCK(0x138a, 4);
+    // 138a: mov r1, 2bc6
+    {
+        src = r[1];
+        b = 0x2bc6;
+        WR16(b, src);
+    }
+    // 138e: clr 2bcc
+    {
+        a = 0x2bcc;
+        WR16(a, 0);
+    }
+    // 1392: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1396: bne 13a0
+    if (!Z)
+        AOT_GOTO(0x13a0, L13a0);
+    AOT_GOTO(0x1398, L1398);
+L1398:
+    AOT_BLOCK(0x1398, 1);
+    // 1398: jsr r3, 14b2
+    {
+        a = 0x14b2;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x139c;
+    }
+    AOT_GOTO(0x14b2, L14b2);
+L139c:
+    AOT_BLOCK(0x139c, 1);
+    // 139c: mov r1, 2bce
+    {
+        src = r[1];
+        b = 0x2bce;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x13a0, L13a0);
+L13a0:
+    AOT_BLOCK(0x13a0, 3);
+    // 13a0: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 13a2: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 13a6: mov $1c26, r1
+    {
+        src = uint16_t(0x1c26);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x13aa, L13aa);
+L13aa:
+    AOT_BLOCK(0x13aa, 2);
+    // 13aa: mov (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13ac: beq 1362
+    if (Z)
+        AOT_GOTO(0x1362, L1362);
+    AOT_GOTO(0x13ae, L13ae);
+L13ae:
+    AOT_BLOCK(0x13ae, 2);
+    // 13ae: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13b0: bne 13aa
+    if (!Z)
+        AOT_GOTO(0x13aa, L13aa);
+    AOT_GOTO(0x13b2, L13b2);
+L13b2:
+    AOT_BLOCK(0x13b2, 1);
+    // 13b2: jmp (r2)
+    {
+        a = r[2];
+    }
+    AOT_JUMP(a);
+L13b4:
+    AOT_BLOCK(0x13b4, 2);
+    // 13b4: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13b6: bge 13c2
+    if (!(N ^ V))
+        AOT_GOTO(0x13c2, L13c2);
+    AOT_GOTO(0x13b8, L13b8);
+L13b8:
+    AOT_BLOCK(0x13b8, 3);
+    // 13b8: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 13ba: movb $2d, (r3)+
+    {
+        src = uint8_t(0x2d);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 13be: br 13c2
+    AOT_GOTO(0x13c2, L13c2);
+L13c0:
+    AOT_BLOCK(0x13c0, 1);
+    // 13c0: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x13c2, L13c2);
+L13c2:
+    AOT_BLOCK(0x13c2, 1);
+    // 13c2: jsr pc, 13c8
+    {
+        a = 0x13c8;
+        r[6] -= 2;
+        WR16(r[6], 0x13c6);
+    }
+    AOT_GOTO(0x13c8, L13c8);
+L13c6:
+    AOT_BLOCK(0x13c6, 1);
+    // 13c6: br 146c
+    AOT_GOTO(0x146c, L146c);
+L13c8:
+    AOT_BLOCK(0x13c8, 5);
+    // 13c8: clr r0
+    {
+        r[0] = 0;
+    }
+    // 13ca: div $a, r0
+    {
+        src = int16_t(uint16_t(0x000a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 13ce: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13d0: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13d2: beq 13d8
+    if (Z)
+        AOT_GOTO(0x13d8, L13d8);
+    AOT_GOTO(0x13d4, L13d4);
+L13d4:
+    AOT_BLOCK(0x13d4, 1);
+    // 13d4: jsr pc, 13c8
+    {
+        a = 0x13c8;
+        r[6] -= 2;
+        WR16(r[6], 0x13d8);
+    }
+    AOT_GOTO(0x13c8, L13c8);
+L13d8:
+    AOT_BLOCK(0x13d8, 4);
+    // 13d8: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 13da: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 13de: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 13e0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13e2:
+    AOT_BLOCK(0x13e2, 2);
+    // 13e2: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 13e4: bne 13e8
+    if (!Z)
+        AOT_GOTO(0x13e8, L13e8);
+    AOT_GOTO(0x13e6, L13e6);
+L13e6:
+    AOT_BLOCK(0x13e6, 1);
+    // 13e6: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x13e8, L13e8);
+L13e8:
+    AOT_BLOCK(0x13e8, 2);
+    // 13e8: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 13ea: bne 146c
+    if (!Z)
+        AOT_GOTO(0x146c, L146c);
+    AOT_GOTO(0x13ec, L13ec);
+L13ec:
+    AOT_BLOCK(0x13ec, 2);
+    // 13ec: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 13ee: br 146c
+    AOT_GOTO(0x146c, L146c);
+L13f0:
+    AOT_BLOCK(0x13f0, 3);
+    // 13f0: mov 2bce, r1
+    {
+        a = 0x2bce;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 13f4: clr r3
+    {
+        r[3] = 0;
+        C = false;
+    }
+    // 13f6: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x13f8, L13f8);
+L13f8:
+    AOT_BLOCK(0x13f8, 2);
+    // 13f8: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 13fa: beq 1400
+    if (Z)
+        AOT_GOTO(0x1400, L1400);
+    AOT_GOTO(0x13fc, L13fc);
+L13fc:
+    AOT_BLOCK(0x13fc, 2);
+    // 13fc: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 13fe: sob r1, 4
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x13f8, L13f8);
+    AOT_GOTO(0x1400, L1400);
+L1400:
+    AOT_BLOCK(0x1400, 2);
+    // 1400: mov (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1402: br 1474
+    AOT_GOTO(0x1474, L1474);
+L1404:
+    AOT_BLOCK(0x1404, 2);
+    // 1404: mov $1c4e, r2
+    {
+        src = uint16_t(0x1c4e);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1408: br 140e
+    AOT_GOTO(0x140e, L140e);
+L140a:
+    AOT_BLOCK(0x140a, 1);
+    // 140a: mov $1c52, r2
+    {
+        src = uint16_t(0x1c52);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x140e, L140e);
+L140e:
+    AOT_BLOCK(0x140e, 2);
+    // 140e: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1410: beq 141c
+    if (Z)
+        AOT_GOTO(0x141c, L141c);
+    AOT_GOTO(0x1412, L1412);
+L1412:
+    AOT_BLOCK(0x1412, 2);
+    // 1412: tst 2bce
+    {
+        a = 0x2bce;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1416: beq 141c
+    if (Z)
+        AOT_GOTO(0x141c, L141c);
+    AOT_GOTO(0x1418, L1418);
+L1418:
+    AOT_BLOCK(0x1418, 1);
+    // 1418: movb $30, (r3)+
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x141c, L141c);
+L141c:
+    AOT_BLOCK(0x141c, 2);
+    // 141c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 141e: jsr pc, 1424
+    {
+        a = 0x1424;
+        r[6] -= 2;
+        WR16(r[6], 0x1422);
+    }
+    AOT_GOTO(0x1424, L1424);
+L1422:
+    AOT_BLOCK(0x1422, 1);
+    // 1422: br 146c
+    AOT_GOTO(0x146c, L146c);
+L1424:
+    AOT_BLOCK(0x1424, 3);
+    // 1424: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1426: ashc (r2), r0
+    {
+        a = r[2];
+        src = RD16(a) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 1428: beq 142e
+    if (Z)
+        AOT_GOTO(0x142e, L142e);
+    AOT_GOTO(0x142a, L142a);
+L142a:
+    AOT_BLOCK(0x142a, 1);
+    // 142a: jsr pc, 1424
+    {
+        a = 0x1424;
+        r[6] -= 2;
+        WR16(r[6], 0x142e);
+    }
+    AOT_GOTO(0x1424, L1424);
+L142e:
+    AOT_BLOCK(0x142e, 5);
+    // 142e: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1430: bic 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1434: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1438: cmp r0, $39
+    {
+        src = r[0];
+        dst = uint16_t(0x0039);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 143c: ble 1442
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1442, L1442);
+    AOT_GOTO(0x143e, L143e);
+L143e:
+    AOT_BLOCK(0x143e, 1);
+    // 143e: add $7, r0
+    {
+        src = uint16_t(0x0007);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1442, L1442);
+L1442:
+    AOT_BLOCK(0x1442, 2);
+    // 1442: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1444: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1446:
+    AOT_BLOCK(0x1446, 3);
+    // 1446: mov 2bce, r0
+    {
+        a = 0x2bce;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 144a: mov 2bcc, r2
+    {
+        a = 0x2bcc;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 144e: jsr pc, 14e6
+    {
+        a = 0x14e6;
+        r[6] -= 2;
+        WR16(r[6], 0x1452);
+    }
+    AOT_GOTO(0x14e6, L14e6);
+L1452:
+    AOT_BLOCK(0x1452, 1);
+    // 1452: br 146c
+    AOT_GOTO(0x146c, L146c);
+L1454:
+    AOT_BLOCK(0x1454, 3);
+    // 1454: mov 2bce, r0
+    {
+        a = 0x2bce;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1458: mov 2bcc, r2
+    {
+        a = 0x2bcc;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 145c: jsr pc, 14e6
+    {
+        a = 0x14e6;
+        r[6] -= 2;
+        WR16(r[6], 0x1460);
+    }
+    AOT_GOTO(0x14e6, L14e6);
+L1460:
+    AOT_BLOCK(0x1460, 1);
+    // 1460: br 146c
+    AOT_GOTO(0x146c, L146c);
+L1462:
+    AOT_BLOCK(0x1462, 3);
+    // 1462: mov (r4)+, r4
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1464: mov (r4)+, 2bc8
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = 0x2bc8;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1468: jmp 1352
+    {
+        a = 0x1352;
+    }
+    AOT_GOTO(0x1352, L1352);
+L146c:
+    AOT_BLOCK(0x146c, 3);
+    // 146c: mov sp, r2
+    {
+        src = r[6];
+        r[2] = src;
+    }
+    // 146e: add $4, r2
+    {
+        src = uint16_t(0x0004);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 1472: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1474, L1474);
+L1474:
+    AOT_BLOCK(0x1474, 6);
+    // 1474: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1476: mov $20, -(sp)
+    {
+        src = uint16_t(0x0020);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 147a: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+    }
+    // 147c: neg r3
+    {
+        val = -int16_t(r[3]);
+        r[3] = val;
+    }
+    // 147e: add 2bc6, r3
+    {
+        a = 0x2bc6;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1482: ble 1490
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1490, L1490);
+    AOT_GOTO(0x1484, L1484);
+L1484:
+    AOT_BLOCK(0x1484, 2);
+    // 1484: tst 2bca
+    {
+        a = 0x2bca;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1488: bne 1490
+    if (!Z)
+        AOT_GOTO(0x1490, L1490);
+    AOT_GOTO(0x148a, L148a);
+L148a:
+    AOT_BLOCK(0x148a, 1);
+    // 148a: jsr pc, *$14f0
+    {
+        a = 0x14f0;
+        r[6] -= 2;
+        WR16(r[6], 0x148e);
+    }
+    AOT_GOTO(0x14f0, L14f0);
+L148e:
+    AOT_BLOCK(0x148e, 1);
+    // 148e: sob r3, 3
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x148a, L148a);
+    AOT_GOTO(0x1490, L1490);
+L1490:
+    AOT_BLOCK(0x1490, 2);
+    // 1490: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1492: beq 149c
+    if (Z)
+        AOT_GOTO(0x149c, L149c);
+    AOT_GOTO(0x1494, L1494);
+L1494:
+    AOT_BLOCK(0x1494, 2);
+    // 1494: movb (r2)+, (sp)
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[6];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1496: jsr pc, *$14f0
+    {
+        a = 0x14f0;
+        r[6] -= 2;
+        WR16(r[6], 0x149a);
+    }
+    AOT_GOTO(0x14f0, L14f0);
+L149a:
+    AOT_BLOCK(0x149a, 1);
+    // 149a: sob r4, 4
+    {
+        r[4]--;
+    }
+    if (r[4] != 0)
+        AOT_GOTO(0x1494, L1494);
+    AOT_GOTO(0x149c, L149c);
+L149c:
+    AOT_BLOCK(0x149c, 2);
+    // 149c: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 149e: ble 14aa
+    if (Z || (N ^ V))
+        AOT_GOTO(0x14aa, L14aa);
+    AOT_GOTO(0x14a0, L14a0);
+L14a0:
+    AOT_BLOCK(0x14a0, 1);
+    // 14a0: mov $20, (sp)
+    {
+        src = uint16_t(0x0020);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14a4, L14a4);
+L14a4:
+    AOT_BLOCK(0x14a4, 1);
+    // 14a4: jsr pc, *$14f0
+    {
+        a = 0x14f0;
+        r[6] -= 2;
+        WR16(r[6], 0x14a8);
+    }
+    AOT_GOTO(0x14f0, L14f0);
+L14a8:
+    AOT_BLOCK(0x14a8, 1);
+    // 14a8: sob r3, 3
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x14a4, L14a4);
+    AOT_GOTO(0x14aa, L14aa);
+L14aa:
+    AOT_BLOCK(0x14aa, 3);
+    // 14aa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 14ac: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14ae: jmp 1352
+    {
+        a = 0x1352;
+    }
+    AOT_GOTO(0x1352, L1352);
+L14b2:
+    AOT_BLOCK(0x14b2, 2);
+    // 14b2: clr 2bcc
+    {
+        a = 0x2bcc;
+        WR16(a, 0);
+    }
+    // 14b6: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x14b8, L14b8);
+L14b8:
+    AOT_BLOCK(0x14b8, 5);
+    // 14b8: movb *2bc8, r0
+    {
+        a = RD16(0x2bc8);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 14bc: inc 2bc8
+    {
+        a = 0x2bc8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 14c0: sub $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 14c4: cmp r0, $fffa
+    {
+        src = r[0];
+        dst = uint16_t(0xfffa);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14c8: bne 14ce
+    if (!Z)
+        AOT_GOTO(0x14ce, L14ce);
+    AOT_GOTO(0x14ca, L14ca);
+L14ca:
+    AOT_BLOCK(0x14ca, 2);
+    // 14ca: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14cc: br 14d4
+    AOT_GOTO(0x14d4, L14d4);
+L14ce:
+    AOT_BLOCK(0x14ce, 2);
+    // 14ce: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14d2: bhi 14e0
+    if (!(C | Z))
+        AOT_GOTO(0x14e0, L14e0);
+    AOT_GOTO(0x14d4, L14d4);
+L14d4:
+    AOT_BLOCK(0x14d4, 4);
+    // 14d4: inc 2bcc
+    {
+        a = 0x2bcc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 14d8: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 14dc: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 14de: br 14b8
+    AOT_GOTO(0x14b8, L14b8);
+L14e0:
+    AOT_BLOCK(0x14e0, 2);
+    // 14e0: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 14e4: rts r3
+    {
+        b = r[3];
+        r[3] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L14e6:
+    AOT_BLOCK(0x14e6, 3);
+    // 14e6: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 14ea: movb $3f, (r3)+
+    {
+        src = uint8_t(0x3f);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 14ee: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L14f0:
+    AOT_BLOCK(0x14f0, 2);
+    // 14f0: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 14f2: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14f4, L14f4);
+L14f4:
+    AOT_BLOCK(0x14f4, 2);
+    // 14f4: mov 2bd4, r0
+    {
+        a = 0x2bd4;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14f8: bne 1502
+    if (!Z)
+        AOT_GOTO(0x1502, L1502);
+    AOT_GOTO(0x14fa, L14fa);
+L14fa:
+    AOT_BLOCK(0x14fa, 1);
+    // 14fa: jsr pc, 152a
+    {
+        a = 0x152a;
+        r[6] -= 2;
+        WR16(r[6], 0x14fe);
+    }
+    AOT_GOTO(0x152a, L152a);
+L14fe:
+    AOT_BLOCK(0x14fe, 1);
+    // 14fe: mov 2bd4, r0
+    {
+        a = 0x2bd4;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1502, L1502);
+L1502:
+    AOT_BLOCK(0x1502, 2);
+    // 1502: movb 4(r5), (r0)+
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = r[0];
+        r[0] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1506: beq 1516
+    if (Z)
+        AOT_GOTO(0x1516, L1516);
+    AOT_GOTO(0x1508, L1508);
+L1508:
+    AOT_BLOCK(0x1508, 3);
+    // 1508: inc 2bd4
+    {
+        a = 0x2bd4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 150c: dec 2bd2
+    {
+        a = 0x2bd2;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1510: bgt 1516
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1516, L1516);
+    AOT_GOTO(0x1512, L1512);
+L1512:
+    AOT_BLOCK(0x1512, 1);
+    // 1512: jsr pc, 152a
+    {
+        a = 0x152a;
+        r[6] -= 2;
+        WR16(r[6], 0x1516);
+    }
+    AOT_GOTO(0x152a, L152a);
+L1516:
+    AOT_BLOCK(0x1516, 3);
+    // 1516: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 151a: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 151c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1520:
+    AOT_BLOCK(0x1520, 2);
+    // 1520: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1522: jsr pc, 152a
+    {
+        a = 0x152a;
+        r[6] -= 2;
+        WR16(r[6], 0x1526);
+    }
+    AOT_GOTO(0x152a, L152a);
+L1526:
+    AOT_BLOCK(0x1526, 2);
+    // 1526: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1528: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L152a:
+    AOT_BLOCK(0x152a, 2);
+    // 152a: mov 2bd4, r0
+    {
+        a = 0x2bd4;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 152e: beq 1544
+    if (Z)
+        AOT_GOTO(0x1544, L1544);
+    AOT_GOTO(0x1530, L1530);
+L1530:
+    AOT_BLOCK(0x1530, 4);
+    // 1530: sub $2bd6, r0
+    {
+        src = uint16_t(0x2bd6);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 1534: mov r0, 1c5a
+    {
+        src = r[0];
+        b = 0x1c5a;
+        WR16(b, src);
+    }
+    // 1538: mov 2bd0, r0
+    {
+        a = 0x2bd0;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 153c: bne 1540
+    if (!Z)
+        AOT_GOTO(0x1540, L1540);
+    AOT_GOTO(0x153e, L153e);
+L153e:
+    AOT_BLOCK(0x153e, 1);
+    // 153e: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1540, L1540);
+L1540:
+    // 1540: sys 0
+    AOT_INTERP(0x1540);
+L1542:
+    AOT_BLOCK(0x1542, 1);
+    // 1542: mov 15f7(r1), (sp)+
+    {
+        a = uint16_t(r[1] + 5623);
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1546, L1546);
+L1544:
+    AOT_BLOCK(0x1544, 1);
+    // 1544: mov $2bd6, 2bd4
+    {
+        src = uint16_t(0x2bd6);
+        b = 0x2bd4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x154a, L154a);
+L1546:
+    AOT_BLOCK(0x1546, 1);
+    // 1546: cmp *-(pc), (sp)+
+    {
+        src = uint16_t(0x0000);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1548, L1548);
+L1548:
+    AOT_BLOCK(0x1548, 1);
+    // 1548: mov *(r2)+, (r2)
+    {
+        a = RD16(r[2]);
+        r[2] += 2;
+        src = RD16(a);
+        b = r[2];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x154a, L154a);
+L154a:
+    AOT_BLOCK(0x154a, 3);
+    // 154a: mov $200, 2bd2
+    {
+        src = uint16_t(0x0200);
+        b = 0x2bd2;
+        WR16(b, src);
+    }
+    // 1550: cmp 2bd0, $2
+    {
+        a = 0x2bd0;
+        src = RD16(a);
+        dst = uint16_t(0x0002);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1556: bhi 155e
+    if (!(C | Z))
+        AOT_GOTO(0x155e, L155e);
+    AOT_GOTO(0x1558, L1558);
+L1558:
+    AOT_BLOCK(0x1558, 1);
+    // 1558: mov $1, 2bd2
+    {
+        src = uint16_t(0x0001);
+        b = 0x2bd2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x155e, L155e);
+L155e:
+    AOT_BLOCK(0x155e, 1);
+    // 155e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1560:
+    AOT_BLOCK(0x1560, 3);
+    // 1560: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1562: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1564: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1568: sys 6
+    AOT_INTERP(0x1568);
+L156a:
+    AOT_BLOCK(0x156a, 1);
+    // 156a: bcc 1570
+    if (!C)
+        AOT_GOTO(0x1570, L1570);
+    AOT_GOTO(0x156c, L156c);
+L156c:
+    AOT_BLOCK(0x156c, 1);
+    // 156c: jmp 1958
+    {
+        a = 0x1958;
+    }
+    AOT_GOTO(0x1958, L1958);
+L156e:
+    AOT_BLOCK(0x156e, 1);
+    // 156e: beq 1540
+    if (Z)
+        AOT_GOTO(0x1540, L1540);
+    AOT_GOTO(0x1570, L1570);
+L1570:
+    AOT_BLOCK(0x1570, 1);
+    // 1570: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1572, L1572);
+L1572:
+    AOT_BLOCK(0x1572, 2);
+    // 1572: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1574: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1576:
+    AOT_BLOCK(0x1576, 4);
+    // 1576: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1578: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 157a: mov 4(r5), 1c5e
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x1c5e;
+        WR16(b, src);
+    }
+    // 1580: mov 6(r5), 1c60
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x1c60;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1586: sys 0
+    AOT_INTERP(0x1586);
+L1588:
+    AOT_BLOCK(0x1588, 1);
+    // 1588: mov -79fe(r1), *(r4)+
+    {
+        a = uint16_t(r[1] + -31230);
+        src = RD16(a);
+        b = RD16(r[4]);
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x158c, L158c);
+L158a:
+    AOT_BLOCK(0x158a, 1);
+    // 158a: bcc 1590
+    if (!C)
+        AOT_GOTO(0x1590, L1590);
+    AOT_GOTO(0x158c, L158c);
+L158c:
+    AOT_BLOCK(0x158c, 1);
+    // 158c: jmp 1958
+    {
+        a = 0x1958;
+    }
+    AOT_GOTO(0x1958, L1958);
+L158e:
+    AOT_BLOCK(0x158e, 1);
+    // 158e: beq 1520
+    if (Z)
+        AOT_GOTO(0x1520, L1520);
+    AOT_GOTO(0x1590, L1590);
+L1590:
+    AOT_BLOCK(0x1590, 2);
+    // 1590: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1592: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1594:
+    AOT_BLOCK(0x1594, 6);
+    // 1594: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1596: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1598: mov 4(r5), 1c64
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x1c64;
+        WR16(b, src);
+    }
+    // 159e: mov 6(r5), 1c66
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x1c66;
+        WR16(b, src);
+    }
+    // 15a4: tst 2bc0
+    {
+        a = 0x2bc0;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 15a8: beq 15b4
+    if (Z)
+        AOT_GOTO(0x15b4, L15b4);
+    AOT_GOTO(0x15aa, L15aa);
+L15aa:
+    AOT_BLOCK(0x15aa, 2);
+    // 15aa: mov $f010, -(sp)
+    {
+        src = uint16_t(0xf010);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15ae: mov $15b4, -(sp)
+    {
+        src = uint16_t(0x15b4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15b2: rtt
+    AOT_INTERP(0x15b2);
+L15b4:
+    // 15b4: sys 0
+    AOT_INTERP(0x15b4);
+L15b6:
+    AOT_BLOCK(0x15b6, 1);
+    // 15b6: mov 77(r1), -(r2)
+    {
+        a = uint16_t(r[1] + 119);
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15ba, L15ba);
+L15b8:
+    AOT_BLOCK(0x15b8, 1);
+    // 15b8: jmp 1958
+    {
+        a = 0x1958;
+    }
+    AOT_GOTO(0x1958, L1958);
+L15ba:
+    AOT_BLOCK(0x15ba, 1);
+    // 15ba: beq 14f4
+    if (Z)
+        AOT_GOTO(0x14f4, L14f4);
+    AOT_GOTO(0x15bc, L15bc);
+L15bc:
+    AOT_BLOCK(0x15bc, 1);
+    // 15bc: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15be, L15be);
+L15be:
+    AOT_BLOCK(0x15be, 1);
+    // 15be: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15c0: sys 2
+    AOT_INTERP(0x15c0);
+L15c2:
+    AOT_BLOCK(0x15c2, 1);
+    // 15c2: br 15ca
+    AOT_GOTO(0x15ca, L15ca);
+L15c4:
+    AOT_BLOCK(0x15c4, 1);
+    // 15c4: bcc 15d0
+    if (!C)
+        AOT_GOTO(0x15d0, L15d0);
+    AOT_GOTO(0x15c6, L15c6);
+L15c6:
+    AOT_BLOCK(0x15c6, 1);
+    // 15c6: jmp 1958
+    {
+        a = 0x1958;
+    }
+    AOT_GOTO(0x1958, L1958);
+L15c8:
+    AOT_BLOCK(0x15c8, 1);
+    // 15c8: beq 14e6
+    if (Z)
+        AOT_GOTO(0x14e6, L14e6);
+    AOT_GOTO(0x15ca, L15ca);
+L15ca:
+    AOT_BLOCK(0x15ca, 2);
+    // 15ca: mov r0, 2dd6
+    {
+        src = r[0];
+        b = 0x2dd6;
+        WR16(b, src);
+    }
+    // 15ce: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x15d0, L15d0);
+L15d0:
+    AOT_BLOCK(0x15d0, 2);
+    // 15d0: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15d2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L15d4:
+    AOT_BLOCK(0x15d4, 3);
+    // 15d4: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15d6: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 15d8: mov 4(r5), 1c6a
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x1c6a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15de: sys 0
+    AOT_INTERP(0x15de);
+L15e0:
+    AOT_BLOCK(0x15e0, 1);
+    // 15e0: mov -78b6(r1), *-(r0)
+    {
+        a = uint16_t(r[1] + -30902);
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15e4, L15e4);
+L15e2:
+    AOT_BLOCK(0x15e2, 1);
+    // 15e2: bcs 1678
+    if (C)
+        AOT_GOTO(0x1678, L1678);
+    AOT_GOTO(0x15e4, L15e4);
+L15e4:
+    AOT_BLOCK(0x15e4, 1);
+    // 15e4: mov 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15e8, L15e8);
+L15e6:
+    // 15e6: rtt
+    AOT_INTERP(0x15e6);
+L15e8:
+    AOT_BLOCK(0x15e8, 5);
+    // 15e8: mov r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 15ea: clr (r1)+
+    {
+        a = r[1];
+        r[1] += 2;
+        WR16(a, 0);
+    }
+    // 15ec: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 15ee: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15f0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L15fa:
+    AOT_BLOCK(0x15fa, 3);
+    // 15fa: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 15fe: sub $2, 2(r1)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[1] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[1] + 2);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 1604: bge 1624
+    if (!(N ^ V))
+        AOT_GOTO(0x1624, L1624);
+    AOT_GOTO(0x1606, L1606);
+L1606:
+    AOT_BLOCK(0x1606, 2);
+    // 1606: cmp 2(r1), $ffff
+    {
+        a = uint16_t(r[1] + 2);
+        src = RD16(a);
+        dst = uint16_t(0xffff);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 160c: blt 161c
+    if (N ^ V)
+        AOT_GOTO(0x161c, L161c);
+    AOT_GOTO(0x160e, L160e);
+L160e:
+    AOT_BLOCK(0x160e, 2);
+    // 160e: movb *4(r1), -(sp)
+    {
+        a = RD16(r[1] + 4);
+        src = RD8(a);
+        r[6] -= 2;
+        b = r[6];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1612: jsr pc, 1658
+    {
+        a = 0x1658;
+        r[6] -= 2;
+        WR16(r[6], 0x1616);
+    }
+    AOT_GOTO(0x1658, L1658);
+L1616:
+    AOT_BLOCK(0x1616, 1);
+    // 1616: mov 4(r1), r0
+    {
+        a = uint16_t(r[1] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x161a, L161a);
+L161a:
+    AOT_BLOCK(0x161a, 1);
+    // 161a: br 162a
+    AOT_GOTO(0x162a, L162a);
+L161c:
+    AOT_BLOCK(0x161c, 1);
+    // 161c: jsr pc, 1658
+    {
+        a = 0x1658;
+        r[6] -= 2;
+        WR16(r[6], 0x1620);
+    }
+    AOT_GOTO(0x1658, L1658);
+L1620:
+    AOT_BLOCK(0x1620, 1);
+    // 1620: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x1624, L1624);
+L1624:
+    AOT_BLOCK(0x1624, 2);
+    // 1624: mov 4(r1), r0
+    {
+        a = uint16_t(r[1] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1628: movb (r0)+, -(sp)
+    {
+        a = r[0];
+        r[0] += 1;
+        src = RD8(a);
+        r[6] -= 2;
+        b = r[6];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x162a, L162a);
+L162a:
+    AOT_BLOCK(0x162a, 5);
+    // 162a: movb (r0)+, 1(sp)
+    {
+        a = r[0];
+        r[0] += 1;
+        src = RD8(a);
+        b = uint16_t(r[6] + 1);
+        WR8(b, src);
+    }
+    // 162e: mov r0, 4(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 4);
+        WR16(b, src);
+    }
+    // 1632: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1634: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1636: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1638:
+    AOT_BLOCK(0x1638, 5);
+    // 1638: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 163a: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 163c: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1640: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1644: bge 164a
+    if (!(N ^ V))
+        AOT_GOTO(0x164a, L164a);
+    AOT_GOTO(0x1646, L1646);
+L1646:
+    AOT_BLOCK(0x1646, 1);
+    // 1646: jsr pc, 1658
+    {
+        a = 0x1658;
+        r[6] -= 2;
+        WR16(r[6], 0x164a);
+    }
+    AOT_GOTO(0x1658, L1658);
+L164a:
+    AOT_BLOCK(0x164a, 5);
+    // 164a: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 164c: bisb *4(r1), r0
+    {
+        a = RD16(r[1] + 4);
+        src = RD8(a);
+        dst = uint8_t(r[0]);
+        val = src | dst;
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+    }
+    // 1650: inc 4(r1)
+    {
+        a = uint16_t(r[1] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1654: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1656: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1658:
+    AOT_BLOCK(0x1658, 5);
+    // 1658: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 165a: add $6, r0
+    {
+        src = uint16_t(0x0006);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 165e: mov r0, 1c70
+    {
+        src = r[0];
+        b = 0x1c70;
+        WR16(b, src);
+    }
+    // 1662: mov r0, 4(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 4);
+        WR16(b, src);
+    }
+    // 1666: mov (r1), r0
+    {
+        a = r[1];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1668: sys 0
+    AOT_INTERP(0x1668);
+L166a:
+    AOT_BLOCK(0x166a, 1);
+    // 166a: mov -78fb(r1), *-(sp)
+    {
+        a = uint16_t(r[1] + -30971);
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x166e, L166e);
+L166c:
+    AOT_BLOCK(0x166c, 1);
+    // 166c: bcs 1678
+    if (C)
+        AOT_GOTO(0x1678, L1678);
+    AOT_GOTO(0x166e, L166e);
+L166e:
+    AOT_BLOCK(0x166e, 1);
+    // 166e: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x1670, L1670);
+L1670:
+    AOT_BLOCK(0x1670, 1);
+    // 1670: bmi 1678
+    if (N)
+        AOT_GOTO(0x1678, L1678);
+    AOT_GOTO(0x1672, L1672);
+L1672:
+    AOT_BLOCK(0x1672, 2);
+    // 1672: mov r0, 2(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1676: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1678:
+    AOT_BLOCK(0x1678, 1);
+    // 1678: jmp 1958
+    {
+        a = 0x1958;
+    }
+    AOT_GOTO(0x1958, L1958);
+L167c:
+    AOT_BLOCK(0x167c, 4);
+    // 167c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 167e: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1680: mov 4(r5), 1c76
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x1c76;
+        WR16(b, src);
+    }
+    // 1686: mov 6(r5), 1c78
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x1c78;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 168c: sys 0
+    AOT_INTERP(0x168c);
+L168e:
+    AOT_BLOCK(0x168e, 1);
+    // 168e: mov -79fe(r1), 77(r4)
+    {
+        a = uint16_t(r[1] + -31230);
+        src = RD16(a);
+        b = uint16_t(r[4] + 119);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1694, L1694);
+L1690:
+    AOT_BLOCK(0x1690, 1);
+    // 1690: bcc 1696
+    if (!C)
+        AOT_GOTO(0x1696, L1696);
+    AOT_GOTO(0x1692, L1692);
+L1692:
+    AOT_BLOCK(0x1692, 1);
+    // 1692: jmp 1958
+    {
+        a = 0x1958;
+    }
+    AOT_GOTO(0x1958, L1958);
+L1694:
+    AOT_BLOCK(0x1694, 1);
+    // 1694: bne 161a
+    if (!Z)
+        AOT_GOTO(0x161a, L161a);
+    AOT_GOTO(0x1696, L1696);
+L1696:
+    AOT_BLOCK(0x1696, 3);
+    // 1696: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 1698: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 169a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L169c:
+    AOT_BLOCK(0x169c, 4);
+    // 169c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 169e: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 16a0: mov 4(r5), 1c7c
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x1c7c;
+        WR16(b, src);
+    }
+    // 16a6: mov 6(r5), 1c7e
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x1c7e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16ac: sys 0
+    AOT_INTERP(0x16ac);
+L16ae:
+    AOT_BLOCK(0x16ae, 1);
+    // 16ae: mov -79fe(r1), *77(r2)
+    {
+        a = uint16_t(r[1] + -31230);
+        src = RD16(a);
+        b = RD16(r[2] + 119);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x16b4, L16b4);
+L16b0:
+    AOT_BLOCK(0x16b0, 1);
+    // 16b0: bcc 16b6
+    if (!C)
+        AOT_GOTO(0x16b6, L16b6);
+    AOT_GOTO(0x16b2, L16b2);
+L16b2:
+    AOT_BLOCK(0x16b2, 1);
+    // 16b2: jmp 1958
+    {
+        a = 0x1958;
+    }
+    AOT_GOTO(0x1958, L1958);
+L16b4:
+    AOT_BLOCK(0x16b4, 1);
+    // 16b4: bne 15fa
+    if (!Z)
+        AOT_GOTO(0x15fa, L15fa);
+    AOT_GOTO(0x16b6, L16b6);
+L16b6:
+    AOT_BLOCK(0x16b6, 2);
+    // 16b6: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16b8: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L16ba:
+    AOT_BLOCK(0x16ba, 5);
+    // 16ba: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 16bc: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 16be: mov 4(r5), 1c82
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x1c82;
+        WR16(b, src);
+    }
+    // 16c4: mov 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 16c8: mov pc, (r1)
+    {
+        src = uint16_t(0x16ca);
+        b = r[1];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16ca: sys 0
+    AOT_INTERP(0x16ca);
+L16cc:
+    AOT_BLOCK(0x16cc, 1);
+    // 16cc: mov -78af(r2), r0
+    {
+        a = uint16_t(r[2] + -30895);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x16d0, L16d0);
+L16ce:
+    AOT_BLOCK(0x16ce, 1);
+    // 16ce: bcs 1772
+    if (C)
+        AOT_GOTO(0x1772, L1772);
+    AOT_GOTO(0x16d0, L16d0);
+L16d0:
+    AOT_BLOCK(0x16d0, 1);
+    // 16d0: mov r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x16d2, L16d2);
+L16d2:
+    AOT_BLOCK(0x16d2, 1);
+    // 16d2: clr (r1)+
+    {
+        a = r[1];
+        r[1] += 2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x16d4, L16d4);
+L16d4:
+    AOT_BLOCK(0x16d4, 2);
+    // 16d4: clr (r1)+
+    {
+        a = r[1];
+        r[1] += 2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 16d6: br 1776
+    AOT_GOTO(0x1776, L1776);
+L1716:
+    AOT_BLOCK(0x1716, 5);
+    // 1716: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1718: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 171a: mov 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 171e: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1722: bge 172c
+    if (!(N ^ V))
+        AOT_GOTO(0x172c, L172c);
+    AOT_GOTO(0x1724, L1724);
+L1724:
+    AOT_BLOCK(0x1724, 1);
+    // 1724: jsr pc, 1748
+    {
+        a = 0x1748;
+        r[6] -= 2;
+        WR16(r[6], 0x1728);
+    }
+    AOT_GOTO(0x1748, L1748);
+L1728:
+    AOT_BLOCK(0x1728, 1);
+    // 1728: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x172c, L172c);
+L172c:
+    AOT_BLOCK(0x172c, 4);
+    // 172c: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1730: movb r0, *4(r1)
+    {
+        src = uint8_t(r[0]);
+        b = RD16(r[1] + 4);
+        WR8(b, src);
+    }
+    // 1734: inc 4(r1)
+    {
+        a = uint16_t(r[1] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1738: br 1776
+    AOT_GOTO(0x1776, L1776);
+L173a:
+    AOT_BLOCK(0x173a, 4);
+    // 173a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 173c: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 173e: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1742: jsr pc, 1748
+    {
+        a = 0x1748;
+        r[6] -= 2;
+        WR16(r[6], 0x1746);
+    }
+    AOT_GOTO(0x1748, L1748);
+L1746:
+    AOT_BLOCK(0x1746, 1);
+    // 1746: br 1776
+    AOT_GOTO(0x1776, L1776);
+L1748:
+    AOT_BLOCK(0x1748, 6);
+    // 1748: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 174a: add $6, r0
+    {
+        src = uint16_t(0x0006);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 174e: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1750: mov r0, 1c88
+    {
+        src = r[0];
+        b = 0x1c88;
+        WR16(b, src);
+    }
+    // 1754: mov 4(r1), 1c8a
+    {
+        a = uint16_t(r[1] + 4);
+        src = RD16(a);
+        b = 0x1c8a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 175a: beq 1766
+    if (Z)
+        AOT_GOTO(0x1766, L1766);
+    AOT_GOTO(0x175c, L175c);
+L175c:
+    AOT_BLOCK(0x175c, 2);
+    // 175c: sub r0, 1c8a
+    {
+        src = r[0];
+        b = 0x1c8a;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x1c8a;
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 1760: mov (r1), r0
+    {
+        a = r[1];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1762: sys 0
+    AOT_INTERP(0x1762);
+L1764:
+    AOT_BLOCK(0x1764, 1);
+    // 1764: mov 15b1(r2), sp
+    {
+        a = uint16_t(r[2] + 5553);
+        src = RD16(a);
+        r[6] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1768, L1768);
+L1766:
+    AOT_BLOCK(0x1766, 1);
+    // 1766: mov (sp)+, 4(r1)
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = uint16_t(r[1] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x176a, L176a);
+L1768:
+    // 1768: iot
+    AOT_INTERP(0x1768);
+L176a:
+    AOT_BLOCK(0x176a, 1);
+    // 176a: mov $200, 2(r1)
+    {
+        src = uint16_t(0x0200);
+        b = uint16_t(r[1] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1770, L1770);
+L176c:
+    AOT_BLOCK(0x176c, 1);
+    // 176c: bne 176e
+    if (!Z)
+        AOT_GOTO(0x176e, L176e);
+    AOT_GOTO(0x176e, L176e);
+L176e:
+    // 176e: rti
+    AOT_INTERP(0x176e);
+L1770:
+    AOT_BLOCK(0x1770, 1);
+    // 1770: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1772:
+    AOT_BLOCK(0x1772, 1);
+    // 1772: jmp 1958
+    {
+        a = 0x1958;
+    }
+    AOT_GOTO(0x1958, L1958);
+L1776:
+    AOT_BLOCK(0x1776, 3);
+    // 1776: clr 2bc2
+    {
+        a = 0x2bc2;
+        WR16(a, 0);
+        C = false;
+    }
+    // 177a: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 177c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L177e:
+    AOT_BLOCK(0x177e, 5);
+    // 177e: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1780: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1782: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1786: cmp r1, $14
+    {
+        src = r[1];
+        dst = uint16_t(0x0014);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 178a: bcc 17ca
+    if (!C)
+        AOT_GOTO(0x17ca, L17ca);
+    AOT_GOTO(0x178c, L178c);
+L178c:
+    AOT_BLOCK(0x178c, 7);
+    // 178c: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1790: mov r1, 1c8e
+    {
+        src = r[1];
+        b = 0x1c8e;
+        WR16(b, src);
+    }
+    // 1794: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1796: mov 2dd8(r1), -(sp)
+    {
+        a = uint16_t(r[1] + 11736);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 179a: mov r0, 2dd8(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 11736);
+        WR16(b, src);
+    }
+    // 179e: mov r0, 1c90
+    {
+        src = r[0];
+        b = 0x1c90;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17a2: beq 17b6
+    if (Z)
+        AOT_GOTO(0x17b6, L17b6);
+    AOT_GOTO(0x17a4, L17a4);
+L17a4:
+    AOT_BLOCK(0x17a4, 2);
+    // 17a4: bit $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 17a8: bne 17b6
+    if (!Z)
+        AOT_GOTO(0x17b6, L17b6);
+    AOT_GOTO(0x17aa, L17aa);
+L17aa:
+    AOT_BLOCK(0x17aa, 4);
+    // 17aa: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 17ac: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 17ae: add $17d6, r1
+    {
+        src = uint16_t(0x17d6);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 17b2: mov r1, 1c90
+    {
+        src = r[1];
+        b = 0x1c90;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17b6, L17b6);
+L17b6:
+    // 17b6: sys 0
+    AOT_INTERP(0x17b6);
+L17b8:
+    AOT_BLOCK(0x17b8, 1);
+    // 17b8: mov -78f6(r2), (r4)
+    {
+        a = uint16_t(r[2] + -30966);
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17bc, L17bc);
+L17ba:
+    AOT_BLOCK(0x17ba, 1);
+    // 17ba: bcs 17d0
+    if (C)
+        AOT_GOTO(0x17d0, L17d0);
+    AOT_GOTO(0x17bc, L17bc);
+L17bc:
+    AOT_BLOCK(0x17bc, 1);
+    // 17bc: bit $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x17c0, L17c0);
+L17be:
+    // 17be: wait
+    AOT_INTERP(0x17be);
+L17c0:
+    AOT_BLOCK(0x17c0, 1);
+    // 17c0: beq 17c4
+    if (Z)
+        AOT_GOTO(0x17c4, L17c4);
+    AOT_GOTO(0x17c2, L17c2);
+L17c2:
+    AOT_BLOCK(0x17c2, 1);
+    // 17c2: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17c4, L17c4);
+L17c4:
+    AOT_BLOCK(0x17c4, 3);
+    // 17c4: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 17c6: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17c8: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L17ca:
+    AOT_BLOCK(0x17ca, 2);
+    // 17ca: mov $16, r0
+    {
+        src = uint16_t(0x0016);
+        r[0] = src;
+    }
+    // 17ce: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x17d0, L17d0);
+L17d0:
+    AOT_BLOCK(0x17d0, 2);
+    // 17d0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 17d2: jmp 1958
+    {
+        a = 0x1958;
+    }
+    AOT_GOTO(0x1958, L1958);
+L188c:
+    AOT_BLOCK(0x188c, 3);
+    // 188c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 188e: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1890: mov 4(r5), 1c94
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x1c94;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1896: sys 0
+    AOT_INTERP(0x1896);
+L1898:
+    AOT_BLOCK(0x1898, 1);
+    // 1898: mov -79fe(r2), (r2)+
+    {
+        a = uint16_t(r[2] + -31230);
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x189c, L189c);
+L189a:
+    AOT_BLOCK(0x189a, 1);
+    // 189a: bcc 18a0
+    if (!C)
+        AOT_GOTO(0x18a0, L18a0);
+    AOT_GOTO(0x189c, L189c);
+L189c:
+    AOT_BLOCK(0x189c, 1);
+    // 189c: jmp 1958
+    {
+        a = 0x1958;
+    }
+    AOT_GOTO(0x1958, L1958);
+L189e:
+    AOT_BLOCK(0x189e, 1);
+    // 189e: sen
+    {
+        N = true;
+    }
+    AOT_GOTO(0x18a0, L18a0);
+L18a0:
+    AOT_BLOCK(0x18a0, 3);
+    // 18a0: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 18a2: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18a4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L18a6:
+    AOT_BLOCK(0x18a6, 3);
+    // 18a6: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 18a8: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18aa: jsr pc, 18d0
+    {
+        a = 0x18d0;
+        r[6] -= 2;
+        WR16(r[6], 0x18ae);
+    }
+    AOT_GOTO(0x18d0, L18d0);
+L18ae:
+    AOT_BLOCK(0x18ae, 1);
+    // 18ae: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18b0: sys 7
+    AOT_INTERP(0x18b0);
+L18b2:
+    AOT_BLOCK(0x18b2, 1);
+    // 18b2: bcc 18ba
+    if (!C)
+        AOT_GOTO(0x18ba, L18ba);
+    AOT_GOTO(0x18b4, L18b4);
+L18b4:
+    AOT_BLOCK(0x18b4, 1);
+    // 18b4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x18b6, L18b6);
+L18b6:
+    AOT_BLOCK(0x18b6, 1);
+    // 18b6: jmp 1958
+    {
+        a = 0x1958;
+    }
+    AOT_GOTO(0x1958, L1958);
+L18b8:
+    // 18b8: spl 6
+    AOT_INTERP(0x18b8);
+L18ba:
+    AOT_BLOCK(0x18ba, 2);
+    // 18ba: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 18bc: beq 18c2
+    if (Z)
+        AOT_GOTO(0x18c2, L18c2);
+    AOT_GOTO(0x18be, L18be);
+L18be:
+    AOT_BLOCK(0x18be, 1);
+    // 18be: mov r1, *4(r5)
+    {
+        src = r[1];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x18c2, L18c2);
+L18c2:
+    AOT_BLOCK(0x18c2, 2);
+    // 18c2: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18c4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L18c6:
+    AOT_BLOCK(0x18c6, 3);
+    // 18c6: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 18c8: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 18ca: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18ce: sys 1
+    AOT_INTERP(0x18ce);
+L18d0:
+    AOT_BLOCK(0x18d0, 1);
+    // 18d0: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x18d2, L18d2);
+L18d2:
+    AOT_BLOCK(0x18d2, 1);
+    // 18d2: mov 2(r5), r1
+    {
+        a = uint16_t(r[5] + 2);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x18d6, L18d6);
+L18d4:
+    // 18d4: rti
+    AOT_INTERP(0x18d4);
+L18d6:
+    AOT_BLOCK(0x18d6, 1);
+    // 18d6: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x18d8, L18d8);
+L18d8:
+    AOT_BLOCK(0x18d8, 3);
+    // 18d8: clr r0
+    {
+        r[0] = 0;
+    }
+    // 18da: cmp -4(r1), 1c96
+    {
+        a = uint16_t(r[1] + -4);
+        src = RD16(a);
+        b = 0x1c96;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18e0: bne 18e6
+    if (!Z)
+        AOT_GOTO(0x18e6, L18e6);
+    AOT_GOTO(0x18e2, L18e2);
+L18e2:
+    AOT_BLOCK(0x18e2, 1);
+    // 18e2: mov $2, r0
+    {
+        src = uint16_t(0x0002);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x18e6, L18e6);
+L18e6:
+    AOT_BLOCK(0x18e6, 2);
+    // 18e6: cmp (r1), 1c9a
+    {
+        a = r[1];
+        src = RD16(a);
+        b = 0x1c9a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18ea: bne 18f2
+    if (!Z)
+        AOT_GOTO(0x18f2, L18f2);
+    AOT_GOTO(0x18ec, L18ec);
+L18ec:
+    AOT_BLOCK(0x18ec, 2);
+    // 18ec: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 18f0: br 1936
+    AOT_GOTO(0x1936, L1936);
+L18f2:
+    AOT_BLOCK(0x18f2, 2);
+    // 18f2: cmp (r1), 1c9c
+    {
+        a = r[1];
+        src = RD16(a);
+        b = 0x1c9c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18f6: bne 18fe
+    if (!Z)
+        AOT_GOTO(0x18fe, L18fe);
+    AOT_GOTO(0x18f8, L18f8);
+L18f8:
+    AOT_BLOCK(0x18f8, 2);
+    // 18f8: add $4, r0
+    {
+        src = uint16_t(0x0004);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 18fc: br 1936
+    AOT_GOTO(0x1936, L1936);
+L18fe:
+    AOT_BLOCK(0x18fe, 2);
+    // 18fe: cmp (r1), 1c9e
+    {
+        a = r[1];
+        src = RD16(a);
+        b = 0x1c9e;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1902: bne 190a
+    if (!Z)
+        AOT_GOTO(0x190a, L190a);
+    AOT_GOTO(0x1904, L1904);
+L1904:
+    AOT_BLOCK(0x1904, 2);
+    // 1904: add 2(r1), r0
+    {
+        a = uint16_t(r[1] + 2);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1908: br 1936
+    AOT_GOTO(0x1936, L1936);
+L190a:
+    AOT_BLOCK(0x190a, 2);
+    // 190a: cmp (r1), 1ca2
+    {
+        a = r[1];
+        src = RD16(a);
+        b = 0x1ca2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 190e: bne 191a
+    if (!Z)
+        AOT_GOTO(0x191a, L191a);
+    AOT_GOTO(0x1910, L1910);
+L1910:
+    AOT_BLOCK(0x1910, 3);
+    // 1910: add 2(r1), r1
+    {
+        a = uint16_t(r[1] + 2);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 1914: add $4, r1
+    {
+        src = uint16_t(0x0004);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1918: br 18e6
+    AOT_GOTO(0x18e6, L18e6);
+L191a:
+    AOT_BLOCK(0x191a, 2);
+    // 191a: cmpb 1(r1), 1ca7
+    {
+        a = uint16_t(r[1] + 1);
+        src = RD8(a);
+        b = 0x1ca7;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1920: bne 1936
+    if (!Z)
+        AOT_GOTO(0x1936, L1936);
+    AOT_GOTO(0x1922, L1922);
+L1922:
+    AOT_BLOCK(0x1922, 8);
+    // 1922: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1924: mov (r1), r0
+    {
+        a = r[1];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1926: swab r0
+    {
+        src = r[0];
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        r[0] = val;
+        C = false;
+    }
+    // 1928: ash $fff9, r0
+    {
+        src = uint16_t(0xfff9) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 192c: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 192e: add $2, r1
+    {
+        src = uint16_t(0x0002);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1932: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1934: br 18e6
+    AOT_GOTO(0x18e6, L18e6);
+L1936:
+    AOT_BLOCK(0x1936, 3);
+    // 1936: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+        C = (src & 1) != 0;
+    }
+    // 1938: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 193a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L193c:
+    AOT_BLOCK(0x193c, 1);
+    // csv
+    {
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_JUMP(r[0]);
+L194a:
+    AOT_BLOCK(0x194a, 1);
+    // cret
+    {
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1958:
+    AOT_BLOCK(0x1958, 5);
+    // 1958: mov r0, 2bc2
+    {
+        src = r[0];
+        b = 0x2bc2;
+        WR16(b, src);
+    }
+    // 195c: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+    }
+    // 1960: mov r5, sp
+    {
+        src = r[5];
+        r[6] = src;
+    }
+    // 1962: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1964: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("v6/bin/cc", 0x0000, 7336, 0x232c8041u, run);
+}
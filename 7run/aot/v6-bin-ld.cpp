@@ -0,0 +1,14732 @@
+// v6/bin/ld translated by 7aot: 682 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x0004: goto L0004;
+        case 0x0008: goto L0008;
+        case 0x0010: goto L0010;
+        case 0x0016: goto L0016;
+        case 0x0018: goto L0018;
+        case 0x001a: goto L001a;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0020: goto L0020;
+        case 0x0022: goto L0022;
+        case 0x002a: goto L002a;
+        case 0x002c: goto L002c;
+        case 0x0032: goto L0032;
+        case 0x0036: goto L0036;
+        case 0x003a: goto L003a;
+        case 0x003e: goto L003e;
+        case 0x0040: goto L0040;
+        case 0x0048: goto L0048;
+        case 0x0050: goto L0050;
+        case 0x005c: goto L005c;
+        case 0x0062: goto L0062;
+        case 0x0066: goto L0066;
+        case 0x0068: goto L0068;
+        case 0x006c: goto L006c;
+        case 0x006e: goto L006e;
+        case 0x0072: goto L0072;
+        case 0x0074: goto L0074;
+        case 0x007c: goto L007c;
+        case 0x0088: goto L0088;
+        case 0x008a: goto L008a;
+        case 0x0090: goto L0090;
+        case 0x0098: goto L0098;
+        case 0x00a2: goto L00a2;
+        case 0x00a4: goto L00a4;
+        case 0x00a6: goto L00a6;
+        case 0x00ac: goto L00ac;
+        case 0x00b2: goto L00b2;
+        case 0x00bc: goto L00bc;
+        case 0x00c6: goto L00c6;
+        case 0x00cc: goto L00cc;
+        case 0x00d2: goto L00d2;
+        case 0x00da: goto L00da;
+        case 0x00ec: goto L00ec;
+        case 0x00f0: goto L00f0;
+        case 0x00f4: goto L00f4;
+        case 0x00fa: goto L00fa;
+        case 0x0102: goto L0102;
+        case 0x0106: goto L0106;
+        case 0x010a: goto L010a;
+        case 0x010e: goto L010e;
+        case 0x0120: goto L0120;
+        case 0x0126: goto L0126;
+        case 0x012e: goto L012e;
+        case 0x0134: goto L0134;
+        case 0x013a: goto L013a;
+        case 0x013c: goto L013c;
+        case 0x0140: goto L0140;
+        case 0x0148: goto L0148;
+        case 0x014c: goto L014c;
+        case 0x0150: goto L0150;
+        case 0x0156: goto L0156;
+        case 0x015e: goto L015e;
+        case 0x0162: goto L0162;
+        case 0x0166: goto L0166;
+        case 0x016a: goto L016a;
+        case 0x0178: goto L0178;
+        case 0x017c: goto L017c;
+        case 0x0186: goto L0186;
+        case 0x018a: goto L018a;
+        case 0x0190: goto L0190;
+        case 0x01a0: goto L01a0;
+        case 0x01aa: goto L01aa;
+        case 0x01bc: goto L01bc;
+        case 0x01c8: goto L01c8;
+        case 0x01da: goto L01da;
+        case 0x01e0: goto L01e0;
+        case 0x01f2: goto L01f2;
+        case 0x0210: goto L0210;
+        case 0x0214: goto L0214;
+        case 0x0228: goto L0228;
+        case 0x025e: goto L025e;
+        case 0x0268: goto L0268;
+        case 0x0270: goto L0270;
+        case 0x0294: goto L0294;
+        case 0x0298: goto L0298;
+        case 0x029e: goto L029e;
+        case 0x02aa: goto L02aa;
+        case 0x02b4: goto L02b4;
+        case 0x02ba: goto L02ba;
+        case 0x02c2: goto L02c2;
+        case 0x02c8: goto L02c8;
+        case 0x02ca: goto L02ca;
+        case 0x02ce: goto L02ce;
+        case 0x02d2: goto L02d2;
+        case 0x02da: goto L02da;
+        case 0x02de: goto L02de;
+        case 0x02e4: goto L02e4;
+        case 0x02ec: goto L02ec;
+        case 0x02f4: goto L02f4;
+        case 0x02fc: goto L02fc;
+        case 0x0302: goto L0302;
+        case 0x0304: goto L0304;
+        case 0x030a: goto L030a;
+        case 0x0312: goto L0312;
+        case 0x0324: goto L0324;
+        case 0x032a: goto L032a;
+        case 0x0330: goto L0330;
+        case 0x034e: goto L034e;
+        case 0x0354: goto L0354;
+        case 0x035a: goto L035a;
+        case 0x035e: goto L035e;
+        case 0x0362: goto L0362;
+        case 0x0366: goto L0366;
+        case 0x0376: goto L0376;
+        case 0x0382: goto L0382;
+        case 0x038e: goto L038e;
+        case 0x0398: goto L0398;
+        case 0x039c: goto L039c;
+        case 0x03a2: goto L03a2;
+        case 0x03aa: goto L03aa;
+        case 0x03b0: goto L03b0;
+        case 0x03b6: goto L03b6;
+        case 0x03bc: goto L03bc;
+        case 0x03c2: goto L03c2;
+        case 0x03d8: goto L03d8;
+        case 0x03de: goto L03de;
+        case 0x03e6: goto L03e6;
+        case 0x03ec: goto L03ec;
+        case 0x03f0: goto L03f0;
+        case 0x03f6: goto L03f6;
+        case 0x03fe: goto L03fe;
+        case 0x0406: goto L0406;
+        case 0x0418: goto L0418;
+        case 0x041e: goto L041e;
+        case 0x0424: goto L0424;
+        case 0x0430: goto L0430;
+        case 0x0444: goto L0444;
+        case 0x044a: goto L044a;
+        case 0x0456: goto L0456;
+        case 0x046a: goto L046a;
+        case 0x0470: goto L0470;
+        case 0x047c: goto L047c;
+        case 0x0490: goto L0490;
+        case 0x0496: goto L0496;
+        case 0x049c: goto L049c;
+        case 0x04ac: goto L04ac;
+        case 0x04b8: goto L04b8;
+        case 0x04c8: goto L04c8;
+        case 0x04ce: goto L04ce;
+        case 0x04d2: goto L04d2;
+        case 0x04f0: goto L04f0;
+        case 0x04f6: goto L04f6;
+        case 0x04fc: goto L04fc;
+        case 0x0508: goto L0508;
+        case 0x050e: goto L050e;
+        case 0x0514: goto L0514;
+        case 0x051c: goto L051c;
+        case 0x052a: goto L052a;
+        case 0x052c: goto L052c;
+        case 0x052e: goto L052e;
+        case 0x0530: goto L0530;
+        case 0x0538: goto L0538;
+        case 0x0540: goto L0540;
+        case 0x0548: goto L0548;
+        case 0x0558: goto L0558;
+        case 0x0562: goto L0562;
+        case 0x0568: goto L0568;
+        case 0x056e: goto L056e;
+        case 0x0574: goto L0574;
+        case 0x057a: goto L057a;
+        case 0x057e: goto L057e;
+        case 0x0594: goto L0594;
+        case 0x05a4: goto L05a4;
+        case 0x05ac: goto L05ac;
+        case 0x05b8: goto L05b8;
+        case 0x05ba: goto L05ba;
+        case 0x05be: goto L05be;
+        case 0x05c4: goto L05c4;
+        case 0x05ca: goto L05ca;
+        case 0x05dc: goto L05dc;
+        case 0x05e8: goto L05e8;
+        case 0x05f0: goto L05f0;
+        case 0x05f6: goto L05f6;
+        case 0x0602: goto L0602;
+        case 0x0604: goto L0604;
+        case 0x060a: goto L060a;
+        case 0x0616: goto L0616;
+        case 0x0624: goto L0624;
+        case 0x0626: goto L0626;
+        case 0x0632: goto L0632;
+        case 0x0638: goto L0638;
+        case 0x063e: goto L063e;
+        case 0x0644: goto L0644;
+        case 0x065c: goto L065c;
+        case 0x0660: goto L0660;
+        case 0x067a: goto L067a;
+        case 0x068c: goto L068c;
+        case 0x0690: goto L0690;
+        case 0x0694: goto L0694;
+        case 0x06a8: goto L06a8;
+        case 0x06ac: goto L06ac;
+        case 0x06b0: goto L06b0;
+        case 0x06c6: goto L06c6;
+        case 0x06ce: goto L06ce;
+        case 0x06da: goto L06da;
+        case 0x06dc: goto L06dc;
+        case 0x06e0: goto L06e0;
+        case 0x06ee: goto L06ee;
+        case 0x06f2: goto L06f2;
+        case 0x06f6: goto L06f6;
+        case 0x06fa: goto L06fa;
+        case 0x0700: goto L0700;
+        case 0x0706: goto L0706;
+        case 0x0708: goto L0708;
+        case 0x0710: goto L0710;
+        case 0x0718: goto L0718;
+        case 0x071c: goto L071c;
+        case 0x0720: goto L0720;
+        case 0x0728: goto L0728;
+        case 0x073a: goto L073a;
+        case 0x074a: goto L074a;
+        case 0x0754: goto L0754;
+        case 0x0762: goto L0762;
+        case 0x076a: goto L076a;
+        case 0x0772: goto L0772;
+        case 0x0776: goto L0776;
+        case 0x0786: goto L0786;
+        case 0x07c4: goto L07c4;
+        case 0x07c8: goto L07c8;
+        case 0x07ce: goto L07ce;
+        case 0x07dc: goto L07dc;
+        case 0x07e2: goto L07e2;
+        case 0x07ea: goto L07ea;
+        case 0x07f0: goto L07f0;
+        case 0x07f6: goto L07f6;
+        case 0x07fc: goto L07fc;
+        case 0x0804: goto L0804;
+        case 0x0814: goto L0814;
+        case 0x0816: goto L0816;
+        case 0x0818: goto L0818;
+        case 0x081c: goto L081c;
+        case 0x0822: goto L0822;
+        case 0x082e: goto L082e;
+        case 0x0830: goto L0830;
+        case 0x0838: goto L0838;
+        case 0x083e: goto L083e;
+        case 0x084a: goto L084a;
+        case 0x084c: goto L084c;
+        case 0x0852: goto L0852;
+        case 0x085a: goto L085a;
+        case 0x0862: goto L0862;
+        case 0x086e: goto L086e;
+        case 0x087a: goto L087a;
+        case 0x087c: goto L087c;
+        case 0x087e: goto L087e;
+        case 0x0892: goto L0892;
+        case 0x08b6: goto L08b6;
+        case 0x08cc: goto L08cc;
+        case 0x08ec: goto L08ec;
+        case 0x0910: goto L0910;
+        case 0x0926: goto L0926;
+        case 0x0940: goto L0940;
+        case 0x0944: goto L0944;
+        case 0x094e: goto L094e;
+        case 0x0954: goto L0954;
+        case 0x0958: goto L0958;
+        case 0x0964: goto L0964;
+        case 0x0968: goto L0968;
+        case 0x0972: goto L0972;
+        case 0x0982: goto L0982;
+        case 0x0986: goto L0986;
+        case 0x0990: goto L0990;
+        case 0x099a: goto L099a;
+        case 0x09a0: goto L09a0;
+        case 0x09ac: goto L09ac;
+        case 0x09ae: goto L09ae;
+        case 0x09ba: goto L09ba;
+        case 0x09be: goto L09be;
+        case 0x09c8: goto L09c8;
+        case 0x09d8: goto L09d8;
+        case 0x09dc: goto L09dc;
+        case 0x09e6: goto L09e6;
+        case 0x09ee: goto L09ee;
+        case 0x09f4: goto L09f4;
+        case 0x09fa: goto L09fa;
+        case 0x0a00: goto L0a00;
+        case 0x0a0a: goto L0a0a;
+        case 0x0a16: goto L0a16;
+        case 0x0a3a: goto L0a3a;
+        case 0x0a56: goto L0a56;
+        case 0x0a60: goto L0a60;
+        case 0x0a66: goto L0a66;
+        case 0x0a6c: goto L0a6c;
+        case 0x0a70: goto L0a70;
+        case 0x0a7a: goto L0a7a;
+        case 0x0a82: goto L0a82;
+        case 0x0a8c: goto L0a8c;
+        case 0x0a8e: goto L0a8e;
+        case 0x0a92: goto L0a92;
+        case 0x0a96: goto L0a96;
+        case 0x0aa0: goto L0aa0;
+        case 0x0aa6: goto L0aa6;
+        case 0x0aaa: goto L0aaa;
+        case 0x0ab0: goto L0ab0;
+        case 0x0abe: goto L0abe;
+        case 0x0ac6: goto L0ac6;
+        case 0x0ad0: goto L0ad0;
+        case 0x0ad2: goto L0ad2;
+        case 0x0ad4: goto L0ad4;
+        case 0x0ae0: goto L0ae0;
+        case 0x0ae8: goto L0ae8;
+        case 0x0af4: goto L0af4;
+        case 0x0b02: goto L0b02;
+        case 0x0b04: goto L0b04;
+        case 0x0b0a: goto L0b0a;
+        case 0x0b10: goto L0b10;
+        case 0x0b1c: goto L0b1c;
+        case 0x0b1e: goto L0b1e;
+        case 0x0b22: goto L0b22;
+        case 0x0b28: goto L0b28;
+        case 0x0b32: goto L0b32;
+        case 0x0b36: goto L0b36;
+        case 0x0b3e: goto L0b3e;
+        case 0x0b46: goto L0b46;
+        case 0x0b4e: goto L0b4e;
+        case 0x0b5a: goto L0b5a;
+        case 0x0b66: goto L0b66;
+        case 0x0b6a: goto L0b6a;
+        case 0x0b76: goto L0b76;
+        case 0x0b7a: goto L0b7a;
+        case 0x0b80: goto L0b80;
+        case 0x0b8c: goto L0b8c;
+        case 0x0b90: goto L0b90;
+        case 0x0b96: goto L0b96;
+        case 0x0ba2: goto L0ba2;
+        case 0x0ba4: goto L0ba4;
+        case 0x0bac: goto L0bac;
+        case 0x0bb0: goto L0bb0;
+        case 0x0bbc: goto L0bbc;
+        case 0x0bc4: goto L0bc4;
+        case 0x0bd0: goto L0bd0;
+        case 0x0bd4: goto L0bd4;
+        case 0x0bd8: goto L0bd8;
+        case 0x0be6: goto L0be6;
+        case 0x0bf0: goto L0bf0;
+        case 0x0bf6: goto L0bf6;
+        case 0x0c00: goto L0c00;
+        case 0x0c06: goto L0c06;
+        case 0x0c08: goto L0c08;
+        case 0x0c0e: goto L0c0e;
+        case 0x0c12: goto L0c12;
+        case 0x0c1c: goto L0c1c;
+        case 0x0c22: goto L0c22;
+        case 0x0c2e: goto L0c2e;
+        case 0x0c4c: goto L0c4c;
+        case 0x0c4e: goto L0c4e;
+        case 0x0c52: goto L0c52;
+        case 0x0c6a: goto L0c6a;
+        case 0x0c74: goto L0c74;
+        case 0x0c78: goto L0c78;
+        case 0x0c7e: goto L0c7e;
+        case 0x0c86: goto L0c86;
+        case 0x0c8a: goto L0c8a;
+        case 0x0c8e: goto L0c8e;
+        case 0x0c96: goto L0c96;
+        case 0x0c9c: goto L0c9c;
+        case 0x0ca0: goto L0ca0;
+        case 0x0cae: goto L0cae;
+        case 0x0cb8: goto L0cb8;
+        case 0x0cbe: goto L0cbe;
+        case 0x0cc2: goto L0cc2;
+        case 0x0cf0: goto L0cf0;
+        case 0x0cfa: goto L0cfa;
+        case 0x0cfe: goto L0cfe;
+        case 0x0d06: goto L0d06;
+        case 0x0d0c: goto L0d0c;
+        case 0x0d12: goto L0d12;
+        case 0x0d1a: goto L0d1a;
+        case 0x0d1e: goto L0d1e;
+        case 0x0d30: goto L0d30;
+        case 0x0d44: goto L0d44;
+        case 0x0d4e: goto L0d4e;
+        case 0x0d52: goto L0d52;
+        case 0x0d5a: goto L0d5a;
+        case 0x0d66: goto L0d66;
+        case 0x0d68: goto L0d68;
+        case 0x0d88: goto L0d88;
+        case 0x0d96: goto L0d96;
+        case 0x0da4: goto L0da4;
+        case 0x0da8: goto L0da8;
+        case 0x0dac: goto L0dac;
+        case 0x0dbe: goto L0dbe;
+        case 0x0dd0: goto L0dd0;
+        case 0x0dd8: goto L0dd8;
+        case 0x0de2: goto L0de2;
+        case 0x0de8: goto L0de8;
+        case 0x0df4: goto L0df4;
+        case 0x0df6: goto L0df6;
+        case 0x0e04: goto L0e04;
+        case 0x0e0e: goto L0e0e;
+        case 0x0e12: goto L0e12;
+        case 0x0e24: goto L0e24;
+        case 0x0e2c: goto L0e2c;
+        case 0x0e34: goto L0e34;
+        case 0x0e38: goto L0e38;
+        case 0x0e40: goto L0e40;
+        case 0x0e4c: goto L0e4c;
+        case 0x0e54: goto L0e54;
+        case 0x0e60: goto L0e60;
+        case 0x0e62: goto L0e62;
+        case 0x0e9a: goto L0e9a;
+        case 0x0ea4: goto L0ea4;
+        case 0x0eb0: goto L0eb0;
+        case 0x0eb2: goto L0eb2;
+        case 0x0eba: goto L0eba;
+        case 0x0ec0: goto L0ec0;
+        case 0x0ec4: goto L0ec4;
+        case 0x0ec8: goto L0ec8;
+        case 0x0eca: goto L0eca;
+        case 0x0ece: goto L0ece;
+        case 0x0edc: goto L0edc;
+        case 0x0ee2: goto L0ee2;
+        case 0x0ef2: goto L0ef2;
+        case 0x0f08: goto L0f08;
+        case 0x0f0c: goto L0f0c;
+        case 0x0f12: goto L0f12;
+        case 0x0f18: goto L0f18;
+        case 0x0f1c: goto L0f1c;
+        case 0x0f1e: goto L0f1e;
+        case 0x0f20: goto L0f20;
+        case 0x0f2a: goto L0f2a;
+        case 0x0f2e: goto L0f2e;
+        case 0x0f30: goto L0f30;
+        case 0x0f34: goto L0f34;
+        case 0x0f38: goto L0f38;
+        case 0x0f48: goto L0f48;
+        case 0x0f58: goto L0f58;
+        case 0x0f5a: goto L0f5a;
+        case 0x0f5e: goto L0f5e;
+        case 0x0f6c: goto L0f6c;
+        case 0x0f78: goto L0f78;
+        case 0x0f7a: goto L0f7a;
+        case 0x0f84: goto L0f84;
+        case 0x0f9c: goto L0f9c;
+        case 0x0fa0: goto L0fa0;
+        case 0x0faa: goto L0faa;
+        case 0x0fb2: goto L0fb2;
+        case 0x0fba: goto L0fba;
+        case 0x0fc2: goto L0fc2;
+        case 0x0fc6: goto L0fc6;
+        case 0x0fce: goto L0fce;
+        case 0x0fd2: goto L0fd2;
+        case 0x0fd6: goto L0fd6;
+        case 0x0fde: goto L0fde;
+        case 0x0fe4: goto L0fe4;
+        case 0x0fe8: goto L0fe8;
+        case 0x0ff2: goto L0ff2;
+        case 0x0ffe: goto L0ffe;
+        case 0x1006: goto L1006;
+        case 0x100e: goto L100e;
+        case 0x1012: goto L1012;
+        case 0x1014: goto L1014;
+        case 0x101c: goto L101c;
+        case 0x1028: goto L1028;
+        case 0x1030: goto L1030;
+        case 0x1034: goto L1034;
+        case 0x1036: goto L1036;
+        case 0x1038: goto L1038;
+        case 0x103e: goto L103e;
+        case 0x1056: goto L1056;
+        case 0x105a: goto L105a;
+        case 0x105e: goto L105e;
+        case 0x1064: goto L1064;
+        case 0x106a: goto L106a;
+        case 0x1076: goto L1076;
+        case 0x1078: goto L1078;
+        case 0x107c: goto L107c;
+        case 0x1094: goto L1094;
+        case 0x10a4: goto L10a4;
+        case 0x10ae: goto L10ae;
+        case 0x10ba: goto L10ba;
+        case 0x10bc: goto L10bc;
+        case 0x10f8: goto L10f8;
+        case 0x110a: goto L110a;
+        case 0x110e: goto L110e;
+        case 0x1112: goto L1112;
+        case 0x1114: goto L1114;
+        case 0x1118: goto L1118;
+        case 0x111c: goto L111c;
+        case 0x1120: goto L1120;
+        case 0x1134: goto L1134;
+        case 0x113a: goto L113a;
+        case 0x1144: goto L1144;
+        case 0x114a: goto L114a;
+        case 0x114c: goto L114c;
+        case 0x1150: goto L1150;
+        case 0x1160: goto L1160;
+        case 0x1168: goto L1168;
+        case 0x116c: goto L116c;
+        case 0x117a: goto L117a;
+        case 0x117e: goto L117e;
+        case 0x1182: goto L1182;
+        case 0x118c: goto L118c;
+        case 0x1190: goto L1190;
+        case 0x1194: goto L1194;
+        case 0x1196: goto L1196;
+        case 0x119a: goto L119a;
+        case 0x11a2: goto L11a2;
+        case 0x11a4: goto L11a4;
+        case 0x11a8: goto L11a8;
+        case 0x11aa: goto L11aa;
+        case 0x11b6: goto L11b6;
+        case 0x11ba: goto L11ba;
+        case 0x11c4: goto L11c4;
+        case 0x11c8: goto L11c8;
+        case 0x11ca: goto L11ca;
+        case 0x11ce: goto L11ce;
+        case 0x11d2: goto L11d2;
+        case 0x11da: goto L11da;
+        case 0x11de: goto L11de;
+        case 0x11e2: goto L11e2;
+        case 0x11e6: goto L11e6;
+        case 0x11ec: goto L11ec;
+        case 0x11f0: goto L11f0;
+        case 0x11f4: goto L11f4;
+        case 0x11fa: goto L11fa;
+        case 0x11fe: goto L11fe;
+        case 0x1204: goto L1204;
+        case 0x1206: goto L1206;
+        case 0x120c: goto L120c;
+        case 0x1210: goto L1210;
+        case 0x1220: goto L1220;
+        case 0x1224: goto L1224;
+        case 0x1226: goto L1226;
+        case 0x1228: goto L1228;
+        case 0x1234: goto L1234;
+        case 0x1236: goto L1236;
+        case 0x1242: goto L1242;
+        case 0x1244: goto L1244;
+        case 0x124e: goto L124e;
+        case 0x1256: goto L1256;
+        case 0x1266: goto L1266;
+        case 0x126c: goto L126c;
+        case 0x1270: goto L1270;
+        case 0x1272: goto L1272;
+        case 0x1276: goto L1276;
+        case 0x127c: goto L127c;
+        case 0x127e: goto L127e;
+        case 0x1282: goto L1282;
+        case 0x1286: goto L1286;
+        case 0x128a: goto L128a;
+        case 0x128c: goto L128c;
+        case 0x1294: goto L1294;
+        case 0x129a: goto L129a;
+        case 0x12ac: goto L12ac;
+        case 0x12b0: goto L12b0;
+        case 0x12b6: goto L12b6;
+        case 0x12bc: goto L12bc;
+        case 0x12be: goto L12be;
+        case 0x12c2: goto L12c2;
+        case 0x12c8: goto L12c8;
+        case 0x12d2: goto L12d2;
+        case 0x12da: goto L12da;
+        case 0x12dc: goto L12dc;
+        case 0x12e0: goto L12e0;
+        case 0x12e4: goto L12e4;
+        case 0x12ea: goto L12ea;
+        case 0x12f4: goto L12f4;
+        case 0x12f8: goto L12f8;
+        case 0x12fa: goto L12fa;
+        case 0x12fc: goto L12fc;
+        case 0x130c: goto L130c;
+        case 0x1310: goto L1310;
+        case 0x1312: goto L1312;
+        case 0x1320: goto L1320;
+        case 0x1322: goto L1322;
+        case 0x1324: goto L1324;
+        case 0x1326: goto L1326;
+        case 0x1328: goto L1328;
+        case 0x132a: goto L132a;
+        case 0x132c: goto L132c;
+        case 0x1330: goto L1330;
+        case 0x133a: goto L133a;
+        case 0x1340: goto L1340;
+        case 0x1342: goto L1342;
+        case 0x1354: goto L1354;
+        case 0x1356: goto L1356;
+        case 0x1358: goto L1358;
+        case 0x135a: goto L135a;
+        case 0x135c: goto L135c;
+        case 0x1362: goto L1362;
+        case 0x136c: goto L136c;
+        case 0x136e: goto L136e;
+        case 0x1370: goto L1370;
+        case 0x1372: goto L1372;
+        case 0x1374: goto L1374;
+        case 0x1378: goto L1378;
+        case 0x138a: goto L138a;
+        case 0x138c: goto L138c;
+        case 0x138e: goto L138e;
+        case 0x1390: goto L1390;
+        case 0x1392: goto L1392;
+        case 0x1396: goto L1396;
+        case 0x13a8: goto L13a8;
+        case 0x13aa: goto L13aa;
+        case 0x13ac: goto L13ac;
+        case 0x13ae: goto L13ae;
+        case 0x13b0: goto L13b0;
+        case 0x13b6: goto L13b6;
+        case 0x13c8: goto L13c8;
+        case 0x13ca: goto L13ca;
+        case 0x13cc: goto L13cc;
+        case 0x13ce: goto L13ce;
+        case 0x13d0: goto L13d0;
+        case 0x13f2: goto L13f2;
+        case 0x1400: goto L1400;
+        case 0x1404: goto L1404;
+        case 0x1408: goto L1408;
+        case 0x1418: goto L1418;
+        case 0x141c: goto L141c;
+        case 0x1420: goto L1420;
+        case 0x1454: goto L1454;
+        case 0x1460: goto L1460;
+        case 0x1462: goto L1462;
+        case 0x1476: goto L1476;
+        case 0x147e: goto L147e;
+        case 0x1480: goto L1480;
+        case 0x1482: goto L1482;
+        case 0x1484: goto L1484;
+        case 0x1486: goto L1486;
+        case 0x1488: goto L1488;
+        case 0x148a: goto L148a;
+        case 0x1490: goto L1490;
+        case 0x1498: goto L1498;
+        case 0x149c: goto L149c;
+        case 0x14ae: goto L14ae;
+        case 0x14b0: goto L14b0;
+        case 0x14b2: goto L14b2;
+        case 0x14b4: goto L14b4;
+        case 0x14b6: goto L14b6;
+        case 0x14ba: goto L14ba;
+        case 0x14d0: goto L14d0;
+        case 0x14d2: goto L14d2;
+        case 0x14d4: goto L14d4;
+        case 0x14d6: goto L14d6;
+        case 0x14d8: goto L14d8;
+        case 0x14de: goto L14de;
+        case 0x14ec: goto L14ec;
+        case 0x1504: goto L1504;
+        case 0x150a: goto L150a;
+        case 0x1516: goto L1516;
+        case 0x1518: goto L1518;
+        case 0x151a: goto L151a;
+        case 0x151c: goto L151c;
+        case 0x151e: goto L151e;
+        case 0x1520: goto L1520;
+        case 0x1522: goto L1522;
+        case 0x1524: goto L1524;
+        case 0x152a: goto L152a;
+        case 0x1530: goto L1530;
+        case 0x1594: goto L1594;
+        case 0x15d6: goto L15d6;
+        case 0x15e0: goto L15e0;
+        case 0x15ec: goto L15ec;
+        case 0x15f8: goto L15f8;
+        case 0x15fa: goto L15fa;
+        case 0x15fc: goto L15fc;
+        case 0x15fe: goto L15fe;
+        case 0x1600: goto L1600;
+        case 0x1606: goto L1606;
+        case 0x1610: goto L1610;
+        case 0x1612: goto L1612;
+        case 0x1614: goto L1614;
+        case 0x1616: goto L1616;
+        case 0x1618: goto L1618;
+        case 0x161a: goto L161a;
+        case 0x161c: goto L161c;
+        case 0x161e: goto L161e;
+        case 0x1628: goto L1628;
+        case 0x1636: goto L1636;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: setd
+    AOT_GOTO(0x0002, L0002);
+L0002:
+    AOT_BLOCK(0x0002, 1);
+    // 0002: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0004, L0004);
+L0004:
+    AOT_BLOCK(0x0004, 2);
+    // 0004: mov (r0), -(sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0006: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0008, L0008);
+L0008:
+    AOT_BLOCK(0x0008, 2);
+    // 0008: mov r0, 2(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 000c: jsr pc, 0018
+    {
+        a = 0x0018;
+        r[6] -= 2;
+        WR16(r[6], 0x0010);
+    }
+    AOT_GOTO(0x0018, L0018);
+L0010:
+    AOT_BLOCK(0x0010, 2);
+    // 0010: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0012: jsr pc, *$1606
+    {
+        a = 0x1606;
+        r[6] -= 2;
+        WR16(r[6], 0x0016);
+    }
+    AOT_GOTO(0x1606, L1606);
+L0016:
+    // 0016: sys 1
+    AOT_INTERP(0x0016);
+L0018:
+    AOT_BLOCK(0x0018, 2);
+    // 0018: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x001c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x001c, L001c);
+L001a:
+    AOT_BLOCK(0x001a, 1);
+    // 001a: mov $be6, *15ce(sp)
+    {
+        src = uint16_t(0x0be6);
+        b = RD16(r[6] + 5582);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0020, L0020);
+L001c:
+    AOT_BLOCK(0x001c, 1);
+    // 001c: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x001e, L001e);
+L001e:
+    AOT_BLOCK(0x001e, 1);
+    // 001e: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0022, L0022);
+L0020:
+    // 0020: wait
+    AOT_INTERP(0x0020);
+L0022:
+    AOT_BLOCK(0x0022, 2);
+    // 0022: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0026: jsr pc, *$14de
+    {
+        a = 0x14de;
+        r[6] -= 2;
+        WR16(r[6], 0x002a);
+    }
+    AOT_GOTO(0x14de, L14de);
+L002a:
+    AOT_BLOCK(0x002a, 1);
+    // 002a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x002c, L002c);
+L002c:
+    AOT_BLOCK(0x002c, 2);
+    // 002c: bit $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0030: bne 0040
+    if (!Z)
+        AOT_GOTO(0x0040, L0040);
+    AOT_GOTO(0x0032, L0032);
+L0032:
+    AOT_BLOCK(0x0032, 1);
+    // 0032: mov $b6a, (sp)
+    {
+        src = uint16_t(0x0b6a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0036, L0036);
+L0036:
+    AOT_BLOCK(0x0036, 1);
+    // 0036: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x003a, L003a);
+L003a:
+    AOT_BLOCK(0x003a, 1);
+    // 003a: jsr pc, *$14de
+    {
+        a = 0x14de;
+        r[6] -= 2;
+        WR16(r[6], 0x003e);
+    }
+    AOT_GOTO(0x14de, L14de);
+L003e:
+    AOT_BLOCK(0x003e, 1);
+    // 003e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0040, L0040);
+L0040:
+    AOT_BLOCK(0x0040, 2);
+    // 0040: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0046: bne 0050
+    if (!Z)
+        AOT_GOTO(0x0050, L0050);
+    AOT_GOTO(0x0048, L0048);
+L0048:
+    AOT_BLOCK(0x0048, 2);
+    // 0048: mov $4, (sp)
+    {
+        src = uint16_t(0x0004);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 004c: jsr pc, *$1606
+    {
+        a = 0x1606;
+        r[6] -= 2;
+        WR16(r[6], 0x0050);
+    }
+    AOT_GOTO(0x1606, L1606);
+L0050:
+    AOT_BLOCK(0x0050, 3);
+    // 0050: mov 6(r5), r2
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0054: add $2, r2
+    {
+        src = uint16_t(0x0002);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0058: mov $1, r4
+    {
+        src = uint16_t(0x0001);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x005c, L005c);
+L005c:
+    AOT_BLOCK(0x005c, 2);
+    // 005c: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0060: ble 0106
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0106, L0106);
+    AOT_GOTO(0x0062, L0062);
+L0062:
+    AOT_BLOCK(0x0062, 1);
+    // 0062: clr 4060
+    {
+        a = 0x4060;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0066, L0066);
+L0066:
+    AOT_BLOCK(0x0066, 1);
+    // 0066: mov (r2)+, r3
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0068, L0068);
+L0068:
+    AOT_BLOCK(0x0068, 1);
+    // 0068: cmpb $2d, (r3)
+    {
+        src = uint8_t(0x2d);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    AOT_GOTO(0x006c, L006c);
+L006c:
+    AOT_BLOCK(0x006c, 1);
+    // 006c: bne 00f4
+    if (!Z)
+        AOT_GOTO(0x00f4, L00f4);
+    AOT_GOTO(0x006e, L006e);
+L006e:
+    AOT_BLOCK(0x006e, 1);
+    // 006e: movb 1(r3), r0
+    {
+        a = uint16_t(r[3] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0072, L0072);
+L0072:
+    AOT_BLOCK(0x0072, 1);
+    // 0072: br 00da
+    AOT_GOTO(0x00da, L00da);
+L0074:
+    AOT_BLOCK(0x0074, 3);
+    // 0074: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 0076: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 007a: bgt 008a
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x008a, L008a);
+    AOT_GOTO(0x007c, L007c);
+L007c:
+    AOT_BLOCK(0x007c, 3);
+    // 007c: mov $16e4, (sp)
+    {
+        src = uint16_t(0x16e4);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0080: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0084: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x0088);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L0088:
+    AOT_BLOCK(0x0088, 1);
+    // 0088: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x008a, L008a);
+L008a:
+    AOT_BLOCK(0x008a, 2);
+    // 008a: mov (r2)+, (sp)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 008c: jsr pc, *$0f38
+    {
+        a = 0x0f38;
+        r[6] -= 2;
+        WR16(r[6], 0x0090);
+    }
+    AOT_GOTO(0x0f38, L0f38);
+L0090:
+    AOT_BLOCK(0x0090, 3);
+    // 0090: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0094: tst (r0)
+    {
+        a = r[0];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0096: bne 00a2
+    if (!Z)
+        AOT_GOTO(0x00a2, L00a2);
+    AOT_GOTO(0x0098, L0098);
+L0098:
+    AOT_BLOCK(0x0098, 2);
+    // 0098: mov 165a, *-8(r5)
+    {
+        a = 0x165a;
+        src = RD16(a);
+        b = RD16(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 009e: jsr pc, 0f5e
+    {
+        a = 0x0f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x00a2);
+    }
+    AOT_GOTO(0x0f5e, L0f5e);
+L00a2:
+    AOT_BLOCK(0x00a2, 1);
+    // 00a2: br 0102
+    AOT_GOTO(0x0102, L0102);
+L00a4:
+    AOT_BLOCK(0x00a4, 1);
+    // 00a4: br 00f4
+    AOT_GOTO(0x00f4, L00f4);
+L00a6:
+    AOT_BLOCK(0x00a6, 2);
+    // 00a6: inc 404e
+    {
+        a = 0x404e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 00aa: br 0102
+    AOT_GOTO(0x0102, L0102);
+L00ac:
+    AOT_BLOCK(0x00ac, 2);
+    // 00ac: inc 4050
+    {
+        a = 0x4050;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 00b0: br 0102
+    AOT_GOTO(0x0102, L0102);
+L00b2:
+    AOT_BLOCK(0x00b2, 3);
+    // 00b2: inc 4052
+    {
+        a = 0x4052;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 00b6: inc 4054
+    {
+        a = 0x4054;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 00ba: br 0102
+    AOT_GOTO(0x0102, L0102);
+L00bc:
+    AOT_BLOCK(0x00bc, 3);
+    // 00bc: inc 4056
+    {
+        a = 0x4056;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 00c0: inc 404e
+    {
+        a = 0x404e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 00c4: br 0102
+    AOT_GOTO(0x0102, L0102);
+L00c6:
+    AOT_BLOCK(0x00c6, 2);
+    // 00c6: inc 4058
+    {
+        a = 0x4058;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 00ca: br 0102
+    AOT_GOTO(0x0102, L0102);
+L00cc:
+    AOT_BLOCK(0x00cc, 2);
+    // 00cc: inc 405a
+    {
+        a = 0x405a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 00d0: br 0102
+    AOT_GOTO(0x0102, L0102);
+L00d2:
+    AOT_BLOCK(0x00d2, 2);
+    // 00d2: inc 405c
+    {
+        a = 0x405c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 00d6: br 0102
+    AOT_GOTO(0x0102, L0102);
+L00da:
+    AOT_BLOCK(0x00da, 7);
+    // 00da: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 00dc: clr r0
+    {
+        r[0] = 0;
+    }
+    // 00de: div $2, r0
+    {
+        src = int16_t(uint16_t(0x0002));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 00e2: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 00e4: add $166c, r1
+    {
+        src = uint16_t(0x166c);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 00e8: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 00ea: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00ec, L00ec);
+L00ec:
+    AOT_BLOCK(0x00ec, 2);
+    // 00ec: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00ee: bne 00ec
+    if (!Z)
+        AOT_GOTO(0x00ec, L00ec);
+    AOT_GOTO(0x00f0, L00f0);
+L00f0:
+    AOT_BLOCK(0x00f0, 1);
+    // 00f0: jmp *16(r1)
+    {
+        a = RD16(r[1] + 22);
+    }
+    AOT_JUMP(a);
+L00f4:
+    AOT_BLOCK(0x00f4, 2);
+    // 00f4: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00f6: jsr pc, *$016a
+    {
+        a = 0x016a;
+        r[6] -= 2;
+        WR16(r[6], 0x00fa);
+    }
+    AOT_GOTO(0x016a, L016a);
+L00fa:
+    AOT_BLOCK(0x00fa, 2);
+    // 00fa: mov 405e, (sp)
+    {
+        a = 0x405e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00fe: jsr pc, *$1362
+    {
+        a = 0x1362;
+        r[6] -= 2;
+        WR16(r[6], 0x0102);
+    }
+    AOT_GOTO(0x1362, L1362);
+L0102:
+    AOT_BLOCK(0x0102, 2);
+    // 0102: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0104: br 005c
+    AOT_GOTO(0x005c, L005c);
+L0106:
+    AOT_BLOCK(0x0106, 1);
+    // 0106: jsr pc, 0366
+    {
+        a = 0x0366;
+        r[6] -= 2;
+        WR16(r[6], 0x010a);
+    }
+    AOT_GOTO(0x0366, L0366);
+L010a:
+    AOT_BLOCK(0x010a, 1);
+    // 010a: jsr pc, 0594
+    {
+        a = 0x0594;
+        r[6] -= 2;
+        WR16(r[6], 0x010e);
+    }
+    AOT_GOTO(0x0594, L0594);
+L010e:
+    AOT_BLOCK(0x010e, 4);
+    // 010e: mov 6(r5), r2
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0112: add $2, r2
+    {
+        src = uint16_t(0x0002);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0116: mov $1cea, 1658
+    {
+        src = uint16_t(0x1cea);
+        b = 0x1658;
+        WR16(b, src);
+    }
+    // 011c: mov $1, r4
+    {
+        src = uint16_t(0x0001);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0120, L0120);
+L0120:
+    AOT_BLOCK(0x0120, 2);
+    // 0120: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0124: ble 0162
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0162, L0162);
+    AOT_GOTO(0x0126, L0126);
+L0126:
+    AOT_BLOCK(0x0126, 3);
+    // 0126: mov (r2)+, r3
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0128: cmpb $2d, (r3)
+    {
+        src = uint8_t(0x2d);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 012c: bne 0150
+    if (!Z)
+        AOT_GOTO(0x0150, L0150);
+    AOT_GOTO(0x012e, L012e);
+L012e:
+    AOT_BLOCK(0x012e, 2);
+    // 012e: movb 1(r3), r0
+    {
+        a = uint16_t(r[3] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0132: br 0140
+    AOT_GOTO(0x0140, L0140);
+L0134:
+    AOT_BLOCK(0x0134, 2);
+    // 0134: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 0136: add $2, r2
+    {
+        src = uint16_t(0x0002);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x013a, L013a);
+L013a:
+    AOT_BLOCK(0x013a, 1);
+    // 013a: br 015e
+    AOT_GOTO(0x015e, L015e);
+L013c:
+    AOT_BLOCK(0x013c, 1);
+    // 013c: br 0150
+    AOT_GOTO(0x0150, L0150);
+L0140:
+    AOT_BLOCK(0x0140, 2);
+    // 0140: mov $169e, r1
+    {
+        src = uint16_t(0x169e);
+        r[1] = src;
+    }
+    // 0144: mov r0, 16a2
+    {
+        src = r[0];
+        b = 0x16a2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0148, L0148);
+L0148:
+    AOT_BLOCK(0x0148, 2);
+    // 0148: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 014a: bne 0148
+    if (!Z)
+        AOT_GOTO(0x0148, L0148);
+    AOT_GOTO(0x014c, L014c);
+L014c:
+    AOT_BLOCK(0x014c, 1);
+    // 014c: jmp *4(r1)
+    {
+        a = RD16(r[1] + 4);
+    }
+    AOT_JUMP(a);
+L0150:
+    AOT_BLOCK(0x0150, 2);
+    // 0150: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0152: jsr pc, *$06e0
+    {
+        a = 0x06e0;
+        r[6] -= 2;
+        WR16(r[6], 0x0156);
+    }
+    AOT_GOTO(0x06e0, L06e0);
+L0156:
+    AOT_BLOCK(0x0156, 2);
+    // 0156: mov 405e, (sp)
+    {
+        a = 0x405e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 015a: jsr pc, *$1362
+    {
+        a = 0x1362;
+        r[6] -= 2;
+        WR16(r[6], 0x015e);
+    }
+    AOT_GOTO(0x1362, L1362);
+L015e:
+    AOT_BLOCK(0x015e, 2);
+    // 015e: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0160: br 0120
+    AOT_GOTO(0x0120, L0120);
+L0162:
+    AOT_BLOCK(0x0162, 1);
+    // 0162: jsr pc, 0a96
+    {
+        a = 0x0a96;
+        r[6] -= 2;
+        WR16(r[6], 0x0166);
+    }
+    AOT_GOTO(0x0a96, L0a96);
+L0166:
+    AOT_BLOCK(0x0166, 2);
+    // 0166: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L016a:
+    AOT_BLOCK(0x016a, 5);
+    // 016a: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x016e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 016e: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0172: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0174: jsr pc, *$0e12
+    {
+        a = 0x0e12;
+        r[6] -= 2;
+        WR16(r[6], 0x0178);
+    }
+    AOT_GOTO(0x0e12, L0e12);
+L0178:
+    AOT_BLOCK(0x0178, 2);
+    // 0178: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 017a: bne 018a
+    if (!Z)
+        AOT_GOTO(0x018a, L018a);
+    AOT_GOTO(0x017c, L017c);
+L017c:
+    AOT_BLOCK(0x017c, 4);
+    // 017c: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 017e: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 0180: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0182: jsr pc, *$0214
+    {
+        a = 0x0214;
+        r[6] -= 2;
+        WR16(r[6], 0x0186);
+    }
+    AOT_GOTO(0x0214, L0214);
+L0186:
+    AOT_BLOCK(0x0186, 2);
+    // 0186: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0188: br 0210
+    AOT_GOTO(0x0210, L0210);
+L018a:
+    AOT_BLOCK(0x018a, 2);
+    // 018a: clr r2
+    {
+        r[2] = 0;
+        C = false;
+    }
+    // 018c: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0190, L0190);
+L0190:
+    AOT_BLOCK(0x0190, 5);
+    // 0190: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0194: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0196: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0198: mov $1cb6, -(sp)
+    {
+        src = uint16_t(0x1cb6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 019c: jsr pc, *$0cc2
+    {
+        a = 0x0cc2;
+        r[6] -= 2;
+        WR16(r[6], 0x01a0);
+    }
+    AOT_GOTO(0x0cc2, L0cc2);
+L01a0:
+    AOT_BLOCK(0x01a0, 3);
+    // 01a0: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 01a4: tst 1cbc
+    {
+        a = 0x1cbc;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 01a8: bgt 01bc
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x01bc, L01bc);
+    AOT_GOTO(0x01aa, L01aa);
+L01aa:
+    AOT_BLOCK(0x01aa, 4);
+    // 01aa: mov 1658, r0
+    {
+        a = 0x1658;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01ae: mov $ffff, 2(r0)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 01b4: add $4, 1658
+    {
+        src = uint16_t(0x0004);
+        b = 0x1658;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 01ba: br 0210
+    AOT_GOTO(0x0210, L0210);
+L01bc:
+    AOT_BLOCK(0x01bc, 3);
+    // 01bc: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01c0: mov $1cca, -(sp)
+    {
+        src = uint16_t(0x1cca);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01c4: jsr pc, *$0c52
+    {
+        a = 0x0c52;
+        r[6] -= 2;
+        WR16(r[6], 0x01c8);
+    }
+    AOT_GOTO(0x0c52, L0c52);
+L01c8:
+    AOT_BLOCK(0x01c8, 6);
+    // 01c8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 01ca: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01cc: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 01d0: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01d2: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01d6: jsr pc, *$0214
+    {
+        a = 0x0214;
+        r[6] -= 2;
+        WR16(r[6], 0x01da);
+    }
+    AOT_GOTO(0x0214, L0214);
+L01da:
+    AOT_BLOCK(0x01da, 3);
+    // 01da: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 01dc: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 01de: beq 01f2
+    if (Z)
+        AOT_GOTO(0x01f2, L01f2);
+    AOT_GOTO(0x01e0, L01e0);
+L01e0:
+    AOT_BLOCK(0x01e0, 4);
+    // 01e0: mov 1658, r0
+    {
+        a = 0x1658;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01e4: mov r2, 2(r0)
+    {
+        src = r[2];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 01e8: mov r3, *1658
+    {
+        src = r[3];
+        b = RD16(0x1658);
+        WR16(b, src);
+    }
+    // 01ec: add $4, 1658
+    {
+        src = uint16_t(0x0004);
+        b = 0x1658;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x01f2, L01f2);
+L01f2:
+    AOT_BLOCK(0x01f2, 10);
+    // 01f2: mov 1cd8, r0
+    {
+        a = 0x1cd8;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01f6: add $10, r0
+    {
+        src = uint16_t(0x0010);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 01fa: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+    }
+    // 01fc: add r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 01fe: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 0200: ash $fff8, r0
+    {
+        src = uint16_t(0xfff8) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0204: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0208: add r0, r2
+    {
+        src = r[0];
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 020a: bic $ff00, r3
+    {
+        src = uint16_t(0xff00);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 020e: br 0190
+    AOT_GOTO(0x0190, L0190);
+L0210:
+    AOT_BLOCK(0x0210, 2);
+    // 0210: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0214:
+    AOT_BLOCK(0x0214, 6);
+    // 0214: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0218;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0218: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 021c: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0220: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0224: jsr pc, *$107c
+    {
+        a = 0x107c;
+        r[6] -= 2;
+        WR16(r[6], 0x0228);
+    }
+    AOT_GOTO(0x107c, L107c);
+L0228:
+    AOT_BLOCK(0x0228, 12);
+    // 0228: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 022a: mov 4062, 4072
+    {
+        a = 0x4062;
+        src = RD16(a);
+        b = 0x4072;
+        WR16(b, src);
+    }
+    // 0230: add 4064, 4074
+    {
+        a = 0x4064;
+        src = RD16(a);
+        b = 0x4074;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0236: add 4066, 4076
+    {
+        a = 0x4066;
+        src = RD16(a);
+        b = 0x4076;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 023c: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+    }
+    // 0240: mov $c, -c(r5)
+    {
+        src = uint16_t(0x000c);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0246: mov $3c60, r2
+    {
+        src = uint16_t(0x3c60);
+        r[2] = src;
+    }
+    // 024a: mov 165a, -8(r5)
+    {
+        a = 0x165a;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0250: mov 1ce8, r0
+    {
+        a = 0x1ce8;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0254: bic $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0258: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 025c: bne 0270
+    if (!Z)
+        AOT_GOTO(0x0270, L0270);
+    AOT_GOTO(0x025e, L025e);
+L025e:
+    AOT_BLOCK(0x025e, 3);
+    // 025e: mov $16ee, (sp)
+    {
+        src = uint16_t(0x16ee);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0262: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0264: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x0268);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L0268:
+    AOT_BLOCK(0x0268, 3);
+    // 0268: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 026a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 026c: jmp *$0362
+    {
+        a = 0x0362;
+    }
+    AOT_GOTO(0x0362, L0362);
+L0270:
+    AOT_BLOCK(0x0270, 9);
+    // 0270: mov 1cdc, r0
+    {
+        a = 0x1cdc;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0274: add 1cde, r0
+    {
+        a = 0x1cde;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0278: add $8, r0
+    {
+        src = uint16_t(0x0008);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 027c: add r0, 8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0280: mov 1ce2, (sp)
+    {
+        a = 0x1ce2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0284: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0288: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 028c: mov $1cb6, -(sp)
+    {
+        src = uint16_t(0x1cb6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0290: jsr pc, *$0cc2
+    {
+        a = 0x0cc2;
+        r[6] -= 2;
+        WR16(r[6], 0x0294);
+    }
+    AOT_GOTO(0x0cc2, L0cc2);
+L0294:
+    AOT_BLOCK(0x0294, 1);
+    // 0294: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0298, L0298);
+L0298:
+    AOT_BLOCK(0x0298, 2);
+    // 0298: tst 1cbc
+    {
+        a = 0x1cbc;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 029c: ble 0324
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0324, L0324);
+    AOT_GOTO(0x029e, L029e);
+L029e:
+    AOT_BLOCK(0x029e, 3);
+    // 029e: mov $c, (sp)
+    {
+        src = uint16_t(0x000c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02a2: mov $20ea, -(sp)
+    {
+        src = uint16_t(0x20ea);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02a6: jsr pc, *$0c52
+    {
+        a = 0x0c52;
+        r[6] -= 2;
+        WR16(r[6], 0x02aa);
+    }
+    AOT_GOTO(0x0c52, L0c52);
+L02aa:
+    AOT_BLOCK(0x02aa, 3);
+    // 02aa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 02ac: bitb $20, 20f2
+    {
+        src = uint8_t(0x20);
+        b = 0x20f2;
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 02b2: bne 02ca
+    if (!Z)
+        AOT_GOTO(0x02ca, L02ca);
+    AOT_GOTO(0x02b4, L02b4);
+L02b4:
+    AOT_BLOCK(0x02b4, 2);
+    // 02b4: tst 4050
+    {
+        a = 0x4050;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 02b8: beq 02c2
+    if (Z)
+        AOT_GOTO(0x02c2, L02c2);
+    AOT_GOTO(0x02ba, L02ba);
+L02ba:
+    AOT_BLOCK(0x02ba, 2);
+    // 02ba: cmpb $4c, 20ea
+    {
+        src = uint8_t(0x4c);
+        b = 0x20ea;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 02c0: beq 02c8
+    if (Z)
+        AOT_GOTO(0x02c8, L02c8);
+    AOT_GOTO(0x02c2, L02c2);
+L02c2:
+    AOT_BLOCK(0x02c2, 1);
+    // 02c2: add $c, -c(r5)
+    {
+        src = uint16_t(0x000c);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x02c8, L02c8);
+L02c8:
+    AOT_BLOCK(0x02c8, 1);
+    // 02c8: br 0298
+    AOT_GOTO(0x0298, L0298);
+L02ca:
+    AOT_BLOCK(0x02ca, 1);
+    // 02ca: jsr pc, 0fa0
+    {
+        a = 0x0fa0;
+        r[6] -= 2;
+        WR16(r[6], 0x02ce);
+    }
+    AOT_GOTO(0x0fa0, L0fa0);
+L02ce:
+    AOT_BLOCK(0x02ce, 1);
+    // 02ce: jsr pc, 0ece
+    {
+        a = 0x0ece;
+        r[6] -= 2;
+        WR16(r[6], 0x02d2);
+    }
+    AOT_GOTO(0x0ece, L0ece);
+L02d2:
+    AOT_BLOCK(0x02d2, 4);
+    // 02d2: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 02d4: mov (r3), r4
+    {
+        a = r[3];
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 02d6: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 02d8: bne 02e4
+    if (!Z)
+        AOT_GOTO(0x02e4, L02e4);
+    AOT_GOTO(0x02da, L02da);
+L02da:
+    AOT_BLOCK(0x02da, 1);
+    // 02da: jsr pc, 0f5e
+    {
+        a = 0x0f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x02de);
+    }
+    AOT_GOTO(0x0f5e, L0f5e);
+L02de:
+    AOT_BLOCK(0x02de, 3);
+    // 02de: mov r0, (r3)
+    {
+        src = r[0];
+        b = r[3];
+        WR16(b, src);
+    }
+    // 02e0: mov r3, (r2)+
+    {
+        src = r[3];
+        b = r[2];
+        r[2] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02e2: br 0298
+    AOT_GOTO(0x0298, L0298);
+L02e4:
+    AOT_BLOCK(0x02e4, 2);
+    // 02e4: cmpb $20, 8(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 02ea: bne 0298
+    if (!Z)
+        AOT_GOTO(0x0298, L0298);
+    AOT_GOTO(0x02ec, L02ec);
+L02ec:
+    AOT_BLOCK(0x02ec, 2);
+    // 02ec: cmpb $20, 20f2
+    {
+        src = uint8_t(0x20);
+        b = 0x20f2;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 02f2: bne 0304
+    if (!Z)
+        AOT_GOTO(0x0304, L0304);
+    AOT_GOTO(0x02f4, L02f4);
+L02f4:
+    AOT_BLOCK(0x02f4, 2);
+    // 02f4: cmp a(r4), 20f4
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = 0x20f4;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02fa: bge 0302
+    if (!(N ^ V))
+        AOT_GOTO(0x0302, L0302);
+    AOT_GOTO(0x02fc, L02fc);
+L02fc:
+    AOT_BLOCK(0x02fc, 1);
+    // 02fc: mov 20f4, a(r4)
+    {
+        a = 0x20f4;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0302, L0302);
+L0302:
+    AOT_BLOCK(0x0302, 1);
+    // 0302: br 0298
+    AOT_GOTO(0x0298, L0298);
+L0304:
+    AOT_BLOCK(0x0304, 2);
+    // 0304: tst a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0308: beq 0312
+    if (Z)
+        AOT_GOTO(0x0312, L0312);
+    AOT_GOTO(0x030a, L030a);
+L030a:
+    AOT_BLOCK(0x030a, 2);
+    // 030a: cmpb $22, 20f2
+    {
+        src = uint8_t(0x22);
+        b = 0x20f2;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0310: beq 0298
+    if (Z)
+        AOT_GOTO(0x0298, L0298);
+    AOT_GOTO(0x0312, L0312);
+L0312:
+    AOT_BLOCK(0x0312, 4);
+    // 0312: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0316: movb 20f2, 8(r4)
+    {
+        a = 0x20f2;
+        src = RD8(a);
+        b = uint16_t(r[4] + 8);
+        WR8(b, src);
+    }
+    // 031c: mov 20f4, a(r4)
+    {
+        a = 0x20f4;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0322: br 0298
+    AOT_GOTO(0x0298, L0298);
+L0324:
+    AOT_BLOCK(0x0324, 2);
+    // 0324: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0328: beq 0330
+    if (Z)
+        AOT_GOTO(0x0330, L0330);
+    AOT_GOTO(0x032a, L032a);
+L032a:
+    AOT_BLOCK(0x032a, 2);
+    // 032a: tst -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 032e: beq 034e
+    if (Z)
+        AOT_GOTO(0x034e, L034e);
+    AOT_GOTO(0x0330, L0330);
+L0330:
+    AOT_BLOCK(0x0330, 6);
+    // 0330: add 1cdc, 4062
+    {
+        a = 0x1cdc;
+        src = RD16(a);
+        b = 0x4062;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0336: add 1cde, 4064
+    {
+        a = 0x1cde;
+        src = RD16(a);
+        b = 0x4064;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 033c: add 1ce0, 4066
+    {
+        a = 0x1ce0;
+        src = RD16(a);
+        b = 0x4066;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0342: add -c(r5), 4068
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = 0x4068;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0348: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 034c: br 0362
+    AOT_GOTO(0x0362, L0362);
+L034e:
+    AOT_BLOCK(0x034e, 1);
+    // 034e: mov -8(r5), 165a
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0x165a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0354, L0354);
+L0354:
+    AOT_BLOCK(0x0354, 2);
+    // 0354: cmp $3c60, r2
+    {
+        src = uint16_t(0x3c60);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0358: bcc 035e
+    if (!C)
+        AOT_GOTO(0x035e, L035e);
+    AOT_GOTO(0x035a, L035a);
+L035a:
+    AOT_BLOCK(0x035a, 2);
+    // 035a: clr *-(r2)
+    {
+        r[2] -= 2;
+        a = RD16(r[2]);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 035c: br 0354
+    AOT_GOTO(0x0354, L0354);
+L035e:
+    AOT_BLOCK(0x035e, 2);
+    // 035e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0360: br 0362
+    AOT_GOTO(0x0362, L0362);
+L0362:
+    AOT_BLOCK(0x0362, 2);
+    // 0362: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0366:
+    AOT_BLOCK(0x0366, 5);
+    // 0366: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x036a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 036a: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 036e: mov $1701, (sp)
+    {
+        src = uint16_t(0x1701);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0372: jsr pc, *$0f38
+    {
+        a = 0x0f38;
+        r[6] -= 2;
+        WR16(r[6], 0x0376);
+    }
+    AOT_GOTO(0x0f38, L0f38);
+L0376:
+    AOT_BLOCK(0x0376, 3);
+    // 0376: mov (r0), 4048
+    {
+        a = r[0];
+        src = RD16(a);
+        b = 0x4048;
+        WR16(b, src);
+    }
+    // 037a: mov $1708, (sp)
+    {
+        src = uint16_t(0x1708);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 037e: jsr pc, *$0f38
+    {
+        a = 0x0f38;
+        r[6] -= 2;
+        WR16(r[6], 0x0382);
+    }
+    AOT_GOTO(0x0f38, L0f38);
+L0382:
+    AOT_BLOCK(0x0382, 3);
+    // 0382: mov (r0), 404a
+    {
+        a = r[0];
+        src = RD16(a);
+        b = 0x404a;
+        WR16(b, src);
+    }
+    // 0386: mov $170f, (sp)
+    {
+        src = uint16_t(0x170f);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 038a: jsr pc, *$0f38
+    {
+        a = 0x0f38;
+        r[6] -= 2;
+        WR16(r[6], 0x038e);
+    }
+    AOT_GOTO(0x0f38, L0f38);
+L038e:
+    AOT_BLOCK(0x038e, 3);
+    // 038e: mov (r0), 404c
+    {
+        a = r[0];
+        src = RD16(a);
+        b = 0x404c;
+        WR16(b, src);
+    }
+    // 0392: tst 4052
+    {
+        a = 0x4052;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0396: bne 03de
+    if (!Z)
+        AOT_GOTO(0x03de, L03de);
+    AOT_GOTO(0x0398, L0398);
+L0398:
+    AOT_BLOCK(0x0398, 1);
+    // 0398: mov $20f6, r4
+    {
+        src = uint16_t(0x20f6);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x039c, L039c);
+L039c:
+    AOT_BLOCK(0x039c, 2);
+    // 039c: cmp 165a, r4
+    {
+        a = 0x165a;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03a0: blos 03de
+    if (C | Z)
+        AOT_GOTO(0x03de, L03de);
+    AOT_GOTO(0x03a2, L03a2);
+L03a2:
+    AOT_BLOCK(0x03a2, 2);
+    // 03a2: cmpb $20, 8(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 03a8: bne 03d8
+    if (!Z)
+        AOT_GOTO(0x03d8, L03d8);
+    AOT_GOTO(0x03aa, L03aa);
+L03aa:
+    AOT_BLOCK(0x03aa, 2);
+    // 03aa: tst a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03ae: bne 03d8
+    if (!Z)
+        AOT_GOTO(0x03d8, L03d8);
+    AOT_GOTO(0x03b0, L03b0);
+L03b0:
+    AOT_BLOCK(0x03b0, 2);
+    // 03b0: cmp 404c, r4
+    {
+        a = 0x404c;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03b4: beq 03d8
+    if (Z)
+        AOT_GOTO(0x03d8, L03d8);
+    AOT_GOTO(0x03b6, L03b6);
+L03b6:
+    AOT_BLOCK(0x03b6, 2);
+    // 03b6: cmp 404a, r4
+    {
+        a = 0x404a;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03ba: beq 03d8
+    if (Z)
+        AOT_GOTO(0x03d8, L03d8);
+    AOT_GOTO(0x03bc, L03bc);
+L03bc:
+    AOT_BLOCK(0x03bc, 2);
+    // 03bc: cmp 4048, r4
+    {
+        a = 0x4048;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03c0: beq 03d8
+    if (Z)
+        AOT_GOTO(0x03d8, L03d8);
+    AOT_GOTO(0x03c2, L03c2);
+L03c2:
+    AOT_BLOCK(0x03c2, 6);
+    // 03c2: inc 4052
+    {
+        a = 0x4052;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 03c6: clr 405a
+    {
+        a = 0x405a;
+        WR16(a, 0);
+    }
+    // 03ca: clr 4058
+    {
+        a = 0x4058;
+        WR16(a, 0);
+    }
+    // 03ce: clr 405c
+    {
+        a = 0x405c;
+        WR16(a, 0);
+    }
+    // 03d2: clr 4056
+    {
+        a = 0x4056;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 03d6: br 03de
+    AOT_GOTO(0x03de, L03de);
+L03d8:
+    AOT_BLOCK(0x03d8, 2);
+    // 03d8: add $c, r4
+    {
+        src = uint16_t(0x000c);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 03dc: br 039c
+    AOT_GOTO(0x039c, L039c);
+L03de:
+    AOT_BLOCK(0x03de, 3);
+    // 03de: clr r2
+    {
+        r[2] = 0;
+    }
+    // 03e0: tst 405a
+    {
+        a = 0x405a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03e4: bne 03ec
+    if (!Z)
+        AOT_GOTO(0x03ec, L03ec);
+    AOT_GOTO(0x03e6, L03e6);
+L03e6:
+    AOT_BLOCK(0x03e6, 2);
+    // 03e6: tst 4052
+    {
+        a = 0x4052;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03ea: bne 0490
+    if (!Z)
+        AOT_GOTO(0x0490, L0490);
+    AOT_GOTO(0x03ec, L03ec);
+L03ec:
+    AOT_BLOCK(0x03ec, 1);
+    // 03ec: mov $20f6, r4
+    {
+        src = uint16_t(0x20f6);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03f0, L03f0);
+L03f0:
+    AOT_BLOCK(0x03f0, 2);
+    // 03f0: cmp 165a, r4
+    {
+        a = 0x165a;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03f4: blos 041e
+    if (C | Z)
+        AOT_GOTO(0x041e, L041e);
+    AOT_GOTO(0x03f6, L03f6);
+L03f6:
+    AOT_BLOCK(0x03f6, 2);
+    // 03f6: cmpb $20, 8(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 03fc: bne 0418
+    if (!Z)
+        AOT_GOTO(0x0418, L0418);
+    AOT_GOTO(0x03fe, L03fe);
+L03fe:
+    AOT_BLOCK(0x03fe, 3);
+    // 03fe: mov a(r4), r3
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0402: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0404: beq 0418
+    if (Z)
+        AOT_GOTO(0x0418, L0418);
+    AOT_GOTO(0x0406, L0406);
+L0406:
+    AOT_BLOCK(0x0406, 5);
+    // 0406: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+    }
+    // 0408: bic $1, r3
+    {
+        src = uint16_t(0x0001);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+    }
+    // 040c: mov r2, a(r4)
+    {
+        src = r[2];
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+    }
+    // 0410: movb $25, 8(r4)
+    {
+        src = uint8_t(0x25);
+        b = uint16_t(r[4] + 8);
+        WR8(b, src);
+    }
+    // 0416: add r3, r2
+    {
+        src = r[3];
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0418, L0418);
+L0418:
+    AOT_BLOCK(0x0418, 2);
+    // 0418: add $c, r4
+    {
+        src = uint16_t(0x000c);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 041c: br 03f0
+    AOT_GOTO(0x03f0, L03f0);
+L041e:
+    AOT_BLOCK(0x041e, 2);
+    // 041e: tst 4048
+    {
+        a = 0x4048;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0422: beq 0444
+    if (Z)
+        AOT_GOTO(0x0444, L0444);
+    AOT_GOTO(0x0424, L0424);
+L0424:
+    AOT_BLOCK(0x0424, 3);
+    // 0424: mov 4048, r0
+    {
+        a = 0x4048;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0428: cmpb $20, 8(r0)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[0] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 042e: bne 0444
+    if (!Z)
+        AOT_GOTO(0x0444, L0444);
+    AOT_GOTO(0x0430, L0430);
+L0430:
+    AOT_BLOCK(0x0430, 4);
+    // 0430: mov 4048, r0
+    {
+        a = 0x4048;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0434: movb $22, 8(r0)
+    {
+        src = uint8_t(0x22);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+    }
+    // 043a: mov 4048, r0
+    {
+        a = 0x4048;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 043e: mov 4062, a(r0)
+    {
+        a = 0x4062;
+        src = RD16(a);
+        b = uint16_t(r[0] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0444, L0444);
+L0444:
+    AOT_BLOCK(0x0444, 2);
+    // 0444: tst 404a
+    {
+        a = 0x404a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0448: beq 046a
+    if (Z)
+        AOT_GOTO(0x046a, L046a);
+    AOT_GOTO(0x044a, L044a);
+L044a:
+    AOT_BLOCK(0x044a, 3);
+    // 044a: mov 404a, r0
+    {
+        a = 0x404a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 044e: cmpb $20, 8(r0)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[0] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0454: bne 046a
+    if (!Z)
+        AOT_GOTO(0x046a, L046a);
+    AOT_GOTO(0x0456, L0456);
+L0456:
+    AOT_BLOCK(0x0456, 4);
+    // 0456: mov 404a, r0
+    {
+        a = 0x404a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 045a: movb $23, 8(r0)
+    {
+        src = uint8_t(0x23);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+    }
+    // 0460: mov 404a, r0
+    {
+        a = 0x404a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0464: mov 4064, a(r0)
+    {
+        a = 0x4064;
+        src = RD16(a);
+        b = uint16_t(r[0] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x046a, L046a);
+L046a:
+    AOT_BLOCK(0x046a, 2);
+    // 046a: tst 404c
+    {
+        a = 0x404c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 046e: beq 0490
+    if (Z)
+        AOT_GOTO(0x0490, L0490);
+    AOT_GOTO(0x0470, L0470);
+L0470:
+    AOT_BLOCK(0x0470, 3);
+    // 0470: mov 404c, r0
+    {
+        a = 0x404c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0474: cmpb $20, 8(r0)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[0] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 047a: bne 0490
+    if (!Z)
+        AOT_GOTO(0x0490, L0490);
+    AOT_GOTO(0x047c, L047c);
+L047c:
+    AOT_BLOCK(0x047c, 4);
+    // 047c: mov 404c, r0
+    {
+        a = 0x404c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0480: movb $24, 8(r0)
+    {
+        src = uint8_t(0x24);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+    }
+    // 0486: mov 404c, r0
+    {
+        a = 0x404c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 048a: mov 4066, a(r0)
+    {
+        a = 0x4066;
+        src = RD16(a);
+        b = uint16_t(r[0] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0490, L0490);
+L0490:
+    AOT_BLOCK(0x0490, 2);
+    // 0490: tst 4058
+    {
+        a = 0x4058;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0494: bne 049c
+    if (!Z)
+        AOT_GOTO(0x049c, L049c);
+    AOT_GOTO(0x0496, L0496);
+L0496:
+    AOT_BLOCK(0x0496, 2);
+    // 0496: tst 405c
+    {
+        a = 0x405c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 049a: beq 04ac
+    if (Z)
+        AOT_GOTO(0x04ac, L04ac);
+    AOT_GOTO(0x049c, L049c);
+L049c:
+    AOT_BLOCK(0x049c, 4);
+    // 049c: mov 4062, r0
+    {
+        a = 0x4062;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04a0: add $3f, r0
+    {
+        src = uint16_t(0x003f);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 04a4: bic $3f, r0
+    {
+        src = uint16_t(0x003f);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 04a8: mov r0, 4062
+    {
+        src = r[0];
+        b = 0x4062;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04ac, L04ac);
+L04ac:
+    AOT_BLOCK(0x04ac, 3);
+    // 04ac: mov 4062, 406e
+    {
+        a = 0x4062;
+        src = RD16(a);
+        b = 0x406e;
+        WR16(b, src);
+    }
+    // 04b2: tst 4058
+    {
+        a = 0x4058;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04b6: beq 04c8
+    if (Z)
+        AOT_GOTO(0x04c8, L04c8);
+    AOT_GOTO(0x04b8, L04b8);
+L04b8:
+    AOT_BLOCK(0x04b8, 4);
+    // 04b8: mov 4062, r0
+    {
+        a = 0x4062;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04bc: add $1fff, r0
+    {
+        src = uint16_t(0x1fff);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 04c0: bic $1fff, r0
+    {
+        src = uint16_t(0x1fff);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 04c4: mov r0, 406e
+    {
+        src = r[0];
+        b = 0x406e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04c8, L04c8);
+L04c8:
+    AOT_BLOCK(0x04c8, 2);
+    // 04c8: tst 405c
+    {
+        a = 0x405c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04cc: beq 04d2
+    if (Z)
+        AOT_GOTO(0x04d2, L04d2);
+    AOT_GOTO(0x04ce, L04ce);
+L04ce:
+    AOT_BLOCK(0x04ce, 1);
+    // 04ce: clr 406e
+    {
+        a = 0x406e;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x04d2, L04d2);
+L04d2:
+    AOT_BLOCK(0x04d2, 8);
+    // 04d2: mov 406e, r0
+    {
+        a = 0x406e;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04d6: add 4064, r0
+    {
+        a = 0x4064;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 04da: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 04de: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04e2: add r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 04e4: mov r0, 4070
+    {
+        src = r[0];
+        b = 0x4070;
+        WR16(b, src);
+    }
+    // 04e8: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 04ec: mov $20f6, r4
+    {
+        src = uint16_t(0x20f6);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04f0, L04f0);
+L04f0:
+    AOT_BLOCK(0x04f0, 2);
+    // 04f0: cmp 165a, r4
+    {
+        a = 0x165a;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04f4: blos 056e
+    if (C | Z)
+        AOT_GOTO(0x056e, L056e);
+    AOT_GOTO(0x04f6, L04f6);
+L04f6:
+    AOT_BLOCK(0x04f6, 2);
+    // 04f6: movb 8(r4), r0
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 04fa: br 0558
+    AOT_GOTO(0x0558, L0558);
+L04fc:
+    AOT_BLOCK(0x04fc, 3);
+    // 04fc: bis $1, 4078
+    {
+        src = uint16_t(0x0001);
+        b = 0x4078;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0502: tst 4054
+    {
+        a = 0x4054;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0506: bne 052c
+    if (!Z)
+        AOT_GOTO(0x052c, L052c);
+    AOT_GOTO(0x0508, L0508);
+L0508:
+    AOT_BLOCK(0x0508, 2);
+    // 0508: tst a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 050c: bne 052c
+    if (!Z)
+        AOT_GOTO(0x052c, L052c);
+    AOT_GOTO(0x050e, L050e);
+L050e:
+    AOT_BLOCK(0x050e, 2);
+    // 050e: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0512: bne 051c
+    if (!Z)
+        AOT_GOTO(0x051c, L051c);
+    AOT_GOTO(0x0514, L0514);
+L0514:
+    AOT_BLOCK(0x0514, 2);
+    // 0514: mov $1714, (sp)
+    {
+        src = uint16_t(0x1714);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0518: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x051c);
+    }
+    AOT_GOTO(0x1120, L1120);
+L051c:
+    AOT_BLOCK(0x051c, 4);
+    // 051c: inc -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0520: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0522: mov $1720, -(sp)
+    {
+        src = uint16_t(0x1720);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0526: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x052a);
+    }
+    AOT_GOTO(0x1120, L1120);
+L052a:
+    AOT_BLOCK(0x052a, 1);
+    // 052a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x052c, L052c);
+L052c:
+    AOT_BLOCK(0x052c, 1);
+    // 052c: br 0568
+    AOT_GOTO(0x0568, L0568);
+L052e:
+    AOT_BLOCK(0x052e, 1);
+    // 052e: br 0568
+    AOT_GOTO(0x0568, L0568);
+L0530:
+    AOT_BLOCK(0x0530, 2);
+    // 0530: add 406c, a(r4)
+    {
+        a = 0x406c;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0536: br 0568
+    AOT_GOTO(0x0568, L0568);
+L0538:
+    AOT_BLOCK(0x0538, 2);
+    // 0538: add 406e, a(r4)
+    {
+        a = 0x406e;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 053e: br 0568
+    AOT_GOTO(0x0568, L0568);
+L0540:
+    AOT_BLOCK(0x0540, 2);
+    // 0540: add 4070, a(r4)
+    {
+        a = 0x4070;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0546: br 0568
+    AOT_GOTO(0x0568, L0568);
+L0548:
+    AOT_BLOCK(0x0548, 3);
+    // 0548: movb $24, 8(r4)
+    {
+        src = uint8_t(0x24);
+        b = uint16_t(r[4] + 8);
+        WR8(b, src);
+    }
+    // 054e: add -a(r5), a(r4)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0554: br 0568
+    AOT_GOTO(0x0568, L0568);
+L0558:
+    AOT_BLOCK(0x0558, 3);
+    // 0558: sub $20, r0
+    {
+        src = uint16_t(0x0020);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 055c: cmp r0, $5
+    {
+        src = r[0];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0560: bhi 052e
+    if (!(C | Z))
+        AOT_GOTO(0x052e, L052e);
+    AOT_GOTO(0x0562, L0562);
+L0562:
+    AOT_BLOCK(0x0562, 2);
+    // 0562: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0564: jmp *16aa(r0)
+    {
+        a = RD16(r[0] + 5802);
+    }
+    AOT_JUMP(a);
+L0568:
+    AOT_BLOCK(0x0568, 2);
+    // 0568: add $c, r4
+    {
+        src = uint16_t(0x000c);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 056c: br 04f0
+    AOT_GOTO(0x04f0, L04f0);
+L056e:
+    AOT_BLOCK(0x056e, 2);
+    // 056e: tst 4056
+    {
+        a = 0x4056;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0572: bne 057a
+    if (!Z)
+        AOT_GOTO(0x057a, L057a);
+    AOT_GOTO(0x0574, L0574);
+L0574:
+    AOT_BLOCK(0x0574, 2);
+    // 0574: tst 404e
+    {
+        a = 0x404e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0578: beq 057e
+    if (Z)
+        AOT_GOTO(0x057e, L057e);
+    AOT_GOTO(0x057a, L057a);
+L057a:
+    AOT_BLOCK(0x057a, 1);
+    // 057a: clr 4068
+    {
+        a = 0x4068;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x057e, L057e);
+L057e:
+    AOT_BLOCK(0x057e, 7);
+    // 057e: add r2, 4066
+    {
+        src = r[2];
+        b = 0x4066;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0582: mov 4068, r1
+    {
+        a = 0x4068;
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 0586: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0588: div $c, r0
+    {
+        src = int16_t(uint16_t(0x000c));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 058c: mov r0, 406a
+    {
+        src = r[0];
+        b = 0x406a;
+        WR16(b, src);
+    }
+    // 0590: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0594:
+    AOT_BLOCK(0x0594, 5);
+    // 0594: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0598;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0598: mov $1b6, (sp)
+    {
+        src = uint16_t(0x01b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 059c: mov $1726, -(sp)
+    {
+        src = uint16_t(0x1726);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05a0: jsr pc, *$1378
+    {
+        a = 0x1378;
+        r[6] -= 2;
+        WR16(r[6], 0x05a4);
+    }
+    AOT_GOTO(0x1378, L1378);
+L05a4:
+    AOT_BLOCK(0x05a4, 3);
+    // 05a4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 05a6: mov r0, 407a
+    {
+        src = r[0];
+        b = 0x407a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05aa: bge 05ba
+    if (!(N ^ V))
+        AOT_GOTO(0x05ba, L05ba);
+    AOT_GOTO(0x05ac, L05ac);
+L05ac:
+    AOT_BLOCK(0x05ac, 3);
+    // 05ac: mov $172c, (sp)
+    {
+        src = uint16_t(0x172c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05b0: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05b4: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x05b8);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L05b8:
+    AOT_BLOCK(0x05b8, 1);
+    // 05b8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x05ba, L05ba);
+L05ba:
+    AOT_BLOCK(0x05ba, 1);
+    // 05ba: jsr pc, 1610
+    {
+        a = 0x1610;
+        r[6] -= 2;
+        WR16(r[6], 0x05be);
+    }
+    AOT_GOTO(0x1610, L1610);
+L05be:
+    AOT_BLOCK(0x05be, 2);
+    // 05be: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 05c0: mov $166a, r4
+    {
+        src = uint16_t(0x166a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L05c4:
+    AOT_BLOCK(0x05c4, 2);
+    // 05c4: cmp $1665, r4
+    {
+        src = uint16_t(0x1665);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05c8: bcc 05dc
+    if (!C)
+        AOT_GOTO(0x05dc, L05dc);
+    AOT_GOTO(0x05ca, L05ca);
+L05ca:
+    AOT_BLOCK(0x05ca, 6);
+    // 05ca: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 05cc: bic $fff8, r0
+    {
+        src = uint16_t(0xfff8);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 05d0: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 05d4: movb r0, -(r4)
+    {
+        src = uint8_t(r[0]);
+        r[4] -= 1;
+        b = r[4];
+        WR8(b, src);
+    }
+    // 05d6: ash $fffd, r3
+    {
+        src = uint16_t(0xfffd) & 077;
+        val16 = r[3];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 05da: br 05c4
+    AOT_GOTO(0x05c4, L05c4);
+L05dc:
+    AOT_BLOCK(0x05dc, 3);
+    // 05dc: mov $61, (sp)
+    {
+        src = uint16_t(0x0061);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05e0: mov $4280, -(sp)
+    {
+        src = uint16_t(0x4280);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05e4: jsr pc, *$06b0
+    {
+        a = 0x06b0;
+        r[6] -= 2;
+        WR16(r[6], 0x05e8);
+    }
+    AOT_GOTO(0x06b0, L06b0);
+L05e8:
+    AOT_BLOCK(0x05e8, 3);
+    // 05e8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 05ea: tst 4056
+    {
+        a = 0x4056;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05ee: beq 05f6
+    if (Z)
+        AOT_GOTO(0x05f6, L05f6);
+    AOT_GOTO(0x05f0, L05f0);
+L05f0:
+    AOT_BLOCK(0x05f0, 2);
+    // 05f0: tst 404e
+    {
+        a = 0x404e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05f4: bne 0604
+    if (!Z)
+        AOT_GOTO(0x0604, L0604);
+    AOT_GOTO(0x05f6, L05f6);
+L05f6:
+    AOT_BLOCK(0x05f6, 3);
+    // 05f6: mov $62, (sp)
+    {
+        src = uint16_t(0x0062);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05fa: mov $4892, -(sp)
+    {
+        src = uint16_t(0x4892);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05fe: jsr pc, *$06b0
+    {
+        a = 0x06b0;
+        r[6] -= 2;
+        WR16(r[6], 0x0602);
+    }
+    AOT_GOTO(0x06b0, L06b0);
+L0602:
+    AOT_BLOCK(0x0602, 1);
+    // 0602: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0604, L0604);
+L0604:
+    AOT_BLOCK(0x0604, 2);
+    // 0604: tst 4052
+    {
+        a = 0x4052;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0608: beq 0626
+    if (Z)
+        AOT_GOTO(0x0626, L0626);
+    AOT_GOTO(0x060a, L060a);
+L060a:
+    AOT_BLOCK(0x060a, 3);
+    // 060a: mov $63, (sp)
+    {
+        src = uint16_t(0x0063);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 060e: mov $4486, -(sp)
+    {
+        src = uint16_t(0x4486);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0612: jsr pc, *$06b0
+    {
+        a = 0x06b0;
+        r[6] -= 2;
+        WR16(r[6], 0x0616);
+    }
+    AOT_GOTO(0x06b0, L06b0);
+L0616:
+    AOT_BLOCK(0x0616, 4);
+    // 0616: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0618: mov $64, (sp)
+    {
+        src = uint16_t(0x0064);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 061c: mov $468c, -(sp)
+    {
+        src = uint16_t(0x468c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0620: jsr pc, *$06b0
+    {
+        a = 0x06b0;
+        r[6] -= 2;
+        WR16(r[6], 0x0624);
+    }
+    AOT_GOTO(0x06b0, L06b0);
+L0624:
+    AOT_BLOCK(0x0624, 1);
+    // 0624: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0626, L0626);
+L0626:
+    AOT_BLOCK(0x0626, 3);
+    // 0626: mov $107, 1cda
+    {
+        src = uint16_t(0x0107);
+        b = 0x1cda;
+        WR16(b, src);
+    }
+    // 062c: tst 4058
+    {
+        a = 0x4058;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0630: beq 0638
+    if (Z)
+        AOT_GOTO(0x0638, L0638);
+    AOT_GOTO(0x0632, L0632);
+L0632:
+    AOT_BLOCK(0x0632, 1);
+    // 0632: mov $108, 1cda
+    {
+        src = uint16_t(0x0108);
+        b = 0x1cda;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0638, L0638);
+L0638:
+    AOT_BLOCK(0x0638, 2);
+    // 0638: tst 405c
+    {
+        a = 0x405c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 063c: beq 0644
+    if (Z)
+        AOT_GOTO(0x0644, L0644);
+    AOT_GOTO(0x063e, L063e);
+L063e:
+    AOT_BLOCK(0x063e, 1);
+    // 063e: mov $109, 1cda
+    {
+        src = uint16_t(0x0109);
+        b = 0x1cda;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0644, L0644);
+L0644:
+    AOT_BLOCK(0x0644, 5);
+    // 0644: mov 4062, 1cdc
+    {
+        a = 0x4062;
+        src = RD16(a);
+        b = 0x1cdc;
+        WR16(b, src);
+    }
+    // 064a: mov 4064, 1cde
+    {
+        a = 0x4064;
+        src = RD16(a);
+        b = 0x1cde;
+        WR16(b, src);
+    }
+    // 0650: mov 4066, 1ce0
+    {
+        a = 0x4066;
+        src = RD16(a);
+        b = 0x1ce0;
+        WR16(b, src);
+    }
+    // 0656: tst 4056
+    {
+        a = 0x4056;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 065a: beq 0660
+    if (Z)
+        AOT_GOTO(0x0660, L0660);
+    AOT_GOTO(0x065c, L065c);
+L065c:
+    AOT_BLOCK(0x065c, 2);
+    // 065c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 065e: br 067a
+    AOT_GOTO(0x067a, L067a);
+L0660:
+    AOT_BLOCK(0x0660, 8);
+    // 0660: mov 165a, r1
+    {
+        a = 0x165a;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0664: sub $20f6, r1
+    {
+        src = uint16_t(0x20f6);
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        N = val16 < 0;
+    }
+    // 0668: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 066a: div $c, r0
+    {
+        src = int16_t(uint16_t(0x000c));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 066e: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0670: mul $c, r1
+    {
+        src = int16_t(uint16_t(0x000c));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0674: add 4068, r1
+    {
+        a = 0x4068;
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0678: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x067a, L067a);
+L067a:
+    AOT_BLOCK(0x067a, 5);
+    // 067a: mov r0, 1ce2
+    {
+        src = r[0];
+        b = 0x1ce2;
+        WR16(b, src);
+    }
+    // 067e: clr 1ce4
+    {
+        a = 0x1ce4;
+        WR16(a, 0);
+    }
+    // 0682: clr 1ce6
+    {
+        a = 0x1ce6;
+        WR16(a, 0);
+    }
+    // 0686: tst 4052
+    {
+        a = 0x4052;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 068a: beq 0690
+    if (Z)
+        AOT_GOTO(0x0690, L0690);
+    AOT_GOTO(0x068c, L068c);
+L068c:
+    AOT_BLOCK(0x068c, 2);
+    // 068c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 068e: br 0694
+    AOT_GOTO(0x0694, L0694);
+L0690:
+    AOT_BLOCK(0x0690, 1);
+    // 0690: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0694, L0694);
+L0694:
+    AOT_BLOCK(0x0694, 5);
+    // 0694: mov r0, 1ce8
+    {
+        src = r[0];
+        b = 0x1ce8;
+        WR16(b, src);
+    }
+    // 0698: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 069c: mov $1cda, -(sp)
+    {
+        src = uint16_t(0x1cda);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06a0: mov $407a, -(sp)
+    {
+        src = uint16_t(0x407a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06a4: jsr pc, *$0ca0
+    {
+        a = 0x0ca0;
+        r[6] -= 2;
+        WR16(r[6], 0x06a8);
+    }
+    AOT_GOTO(0x0ca0, L0ca0);
+L06a8:
+    AOT_BLOCK(0x06a8, 2);
+    // 06a8: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06aa: br 06ac
+    AOT_GOTO(0x06ac, L06ac);
+L06ac:
+    AOT_BLOCK(0x06ac, 2);
+    // 06ac: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06b0:
+    AOT_BLOCK(0x06b0, 6);
+    // 06b0: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x06b4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 06b4: movb 6(r5), 1664
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD8(a);
+        b = 0x1664;
+        WR8(b, src);
+    }
+    // 06ba: mov $100, (sp)
+    {
+        src = uint16_t(0x0100);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06be: mov $165e, -(sp)
+    {
+        src = uint16_t(0x165e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06c2: jsr pc, *$1378
+    {
+        a = 0x1378;
+        r[6] -= 2;
+        WR16(r[6], 0x06c6);
+    }
+    AOT_GOTO(0x1378, L1378);
+L06c6:
+    AOT_BLOCK(0x06c6, 3);
+    // 06c6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 06c8: mov r0, *4(r5)
+    {
+        src = r[0];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06cc: bge 06dc
+    if (!(N ^ V))
+        AOT_GOTO(0x06dc, L06dc);
+    AOT_GOTO(0x06ce, L06ce);
+L06ce:
+    AOT_BLOCK(0x06ce, 3);
+    // 06ce: mov $173f, (sp)
+    {
+        src = uint16_t(0x173f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06d2: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06d6: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x06da);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L06da:
+    AOT_BLOCK(0x06da, 1);
+    // 06da: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x06dc, L06dc);
+L06dc:
+    AOT_BLOCK(0x06dc, 2);
+    // 06dc: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06e0:
+    AOT_BLOCK(0x06e0, 5);
+    // 06e0: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x06e4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 06e4: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 06e8: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06ea: jsr pc, *$0e12
+    {
+        a = 0x0e12;
+        r[6] -= 2;
+        WR16(r[6], 0x06ee);
+    }
+    AOT_GOTO(0x0e12, L0e12);
+L06ee:
+    AOT_BLOCK(0x06ee, 2);
+    // 06ee: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06f0: bne 071c
+    if (!Z)
+        AOT_GOTO(0x071c, L071c);
+    AOT_GOTO(0x06f2, L06f2);
+L06f2:
+    AOT_BLOCK(0x06f2, 2);
+    // 06f2: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06f4: beq 06fa
+    if (Z)
+        AOT_GOTO(0x06fa, L06fa);
+    AOT_GOTO(0x06f6, L06f6);
+L06f6:
+    AOT_BLOCK(0x06f6, 2);
+    // 06f6: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 06f8: br 06f2
+    AOT_GOTO(0x06f2, L06f2);
+L06fa:
+    AOT_BLOCK(0x06fa, 2);
+    // 06fa: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06fe: bhi 0708
+    if (!(C | Z))
+        AOT_GOTO(0x0708, L0708);
+    AOT_GOTO(0x0700, L0700);
+L0700:
+    AOT_BLOCK(0x0700, 2);
+    // 0700: cmpb $2f, -(r4)
+    {
+        src = uint8_t(0x2f);
+        r[4] -= 1;
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0704: beq 0708
+    if (Z)
+        AOT_GOTO(0x0708, L0708);
+    AOT_GOTO(0x0706, L0706);
+L0706:
+    AOT_BLOCK(0x0706, 1);
+    // 0706: br 06fa
+    AOT_GOTO(0x06fa, L06fa);
+L0708:
+    AOT_BLOCK(0x0708, 3);
+    // 0708: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 070a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 070c: jsr pc, *$0c12
+    {
+        a = 0x0c12;
+        r[6] -= 2;
+        WR16(r[6], 0x0710);
+    }
+    AOT_GOTO(0x0c12, L0c12);
+L0710:
+    AOT_BLOCK(0x0710, 3);
+    // 0710: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 0712: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0714: jsr pc, *$0776
+    {
+        a = 0x0776;
+        r[6] -= 2;
+        WR16(r[6], 0x0718);
+    }
+    AOT_GOTO(0x0776, L0776);
+L0718:
+    AOT_BLOCK(0x0718, 2);
+    // 0718: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 071a: br 0772
+    AOT_GOTO(0x0772, L0772);
+L071c:
+    AOT_BLOCK(0x071c, 1);
+    // 071c: mov 1658, r3
+    {
+        a = 0x1658;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0720, L0720);
+L0720:
+    AOT_BLOCK(0x0720, 2);
+    // 0720: cmp $ffff, 2(r3)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0726: beq 076a
+    if (Z)
+        AOT_GOTO(0x076a, L076a);
+    AOT_GOTO(0x0728, L0728);
+L0728:
+    AOT_BLOCK(0x0728, 5);
+    // 0728: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 072c: mov (r3), -(sp)
+    {
+        a = r[3];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 072e: mov 2(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0732: mov $1cb6, -(sp)
+    {
+        src = uint16_t(0x1cb6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0736: jsr pc, *$0cc2
+    {
+        a = 0x0cc2;
+        r[6] -= 2;
+        WR16(r[6], 0x073a);
+    }
+    AOT_GOTO(0x0cc2, L0cc2);
+L073a:
+    AOT_BLOCK(0x073a, 4);
+    // 073a: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 073e: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0742: mov $1cca, -(sp)
+    {
+        src = uint16_t(0x1cca);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0746: jsr pc, *$0c52
+    {
+        a = 0x0c52;
+        r[6] -= 2;
+        WR16(r[6], 0x074a);
+    }
+    AOT_GOTO(0x0c52, L0c52);
+L074a:
+    AOT_BLOCK(0x074a, 3);
+    // 074a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 074c: mov $1cca, (sp)
+    {
+        src = uint16_t(0x1cca);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0750: jsr pc, *$0c12
+    {
+        a = 0x0c12;
+        r[6] -= 2;
+        WR16(r[6], 0x0754);
+    }
+    AOT_GOTO(0x0c12, L0c12);
+L0754:
+    AOT_BLOCK(0x0754, 4);
+    // 0754: mov (r3), (sp)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0756: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 075a: mov 2(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 075e: jsr pc, *$0776
+    {
+        a = 0x0776;
+        r[6] -= 2;
+        WR16(r[6], 0x0762);
+    }
+    AOT_GOTO(0x0776, L0776);
+L0762:
+    AOT_BLOCK(0x0762, 3);
+    // 0762: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0764: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0768: br 0720
+    AOT_GOTO(0x0720, L0720);
+L076a:
+    AOT_BLOCK(0x076a, 2);
+    // 076a: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 076e: mov r3, 1658
+    {
+        src = r[3];
+        b = 0x1658;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0772, L0772);
+L0772:
+    AOT_BLOCK(0x0772, 2);
+    // 0772: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0776:
+    AOT_BLOCK(0x0776, 5);
+    // 0776: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x077a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 077a: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 077e: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0782: jsr pc, *$107c
+    {
+        a = 0x107c;
+        r[6] -= 2;
+        WR16(r[6], 0x0786);
+    }
+    AOT_GOTO(0x107c, L107c);
+L0786:
+    AOT_BLOCK(0x0786, 14);
+    // 0786: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0788: mov 406c, 4072
+    {
+        a = 0x406c;
+        src = RD16(a);
+        b = 0x4072;
+        WR16(b, src);
+    }
+    // 078e: add 406e, 4074
+    {
+        a = 0x406e;
+        src = RD16(a);
+        b = 0x4074;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0794: add 4070, 4076
+    {
+        a = 0x4070;
+        src = RD16(a);
+        b = 0x4076;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 079a: mov $3c60, r3
+    {
+        src = uint16_t(0x3c60);
+        r[3] = src;
+    }
+    // 079e: mov $ffff, r2
+    {
+        src = uint16_t(0xffff);
+        r[2] = src;
+    }
+    // 07a2: add $8, 6(r5)
+    {
+        src = uint16_t(0x0008);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 07a8: mov 1ce2, (sp)
+    {
+        a = 0x1ce2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07ac: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07b0: add 1cdc, (sp)
+    {
+        a = 0x1cdc;
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 07b4: add 1cde, (sp)
+    {
+        a = 0x1cde;
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 07b8: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07bc: mov $1cb6, -(sp)
+    {
+        src = uint16_t(0x1cb6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07c0: jsr pc, *$0cc2
+    {
+        a = 0x0cc2;
+        r[6] -= 2;
+        WR16(r[6], 0x07c4);
+    }
+    AOT_GOTO(0x0cc2, L0cc2);
+L07c4:
+    AOT_BLOCK(0x07c4, 1);
+    // 07c4: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x07c8, L07c8);
+L07c8:
+    AOT_BLOCK(0x07c8, 2);
+    // 07c8: tst 1cbc
+    {
+        a = 0x1cbc;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07cc: ble 087e
+    if (Z || (N ^ V))
+        AOT_GOTO(0x087e, L087e);
+    AOT_GOTO(0x07ce, L07ce);
+L07ce:
+    AOT_BLOCK(0x07ce, 4);
+    // 07ce: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 07d0: mov $c, (sp)
+    {
+        src = uint16_t(0x000c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07d4: mov $20ea, -(sp)
+    {
+        src = uint16_t(0x20ea);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07d8: jsr pc, *$0c52
+    {
+        a = 0x0c52;
+        r[6] -= 2;
+        WR16(r[6], 0x07dc);
+    }
+    AOT_GOTO(0x0c52, L0c52);
+L07dc:
+    AOT_BLOCK(0x07dc, 2);
+    // 07dc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07de: jsr pc, 0fa0
+    {
+        a = 0x0fa0;
+        r[6] -= 2;
+        WR16(r[6], 0x07e2);
+    }
+    AOT_GOTO(0x0fa0, L0fa0);
+L07e2:
+    AOT_BLOCK(0x07e2, 2);
+    // 07e2: bitb $20, 20f2
+    {
+        src = uint8_t(0x20);
+        b = 0x20f2;
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 07e8: bne 0818
+    if (!Z)
+        AOT_GOTO(0x0818, L0818);
+    AOT_GOTO(0x07ea, L07ea);
+L07ea:
+    AOT_BLOCK(0x07ea, 2);
+    // 07ea: tst 4056
+    {
+        a = 0x4056;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07ee: bne 0816
+    if (!Z)
+        AOT_GOTO(0x0816, L0816);
+    AOT_GOTO(0x07f0, L07f0);
+L07f0:
+    AOT_BLOCK(0x07f0, 2);
+    // 07f0: tst 404e
+    {
+        a = 0x404e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07f4: bne 0816
+    if (!Z)
+        AOT_GOTO(0x0816, L0816);
+    AOT_GOTO(0x07f6, L07f6);
+L07f6:
+    AOT_BLOCK(0x07f6, 2);
+    // 07f6: tst 4050
+    {
+        a = 0x4050;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07fa: beq 0804
+    if (Z)
+        AOT_GOTO(0x0804, L0804);
+    AOT_GOTO(0x07fc, L07fc);
+L07fc:
+    AOT_BLOCK(0x07fc, 2);
+    // 07fc: cmpb $4c, 20ea
+    {
+        src = uint8_t(0x4c);
+        b = 0x20ea;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0802: beq 0816
+    if (Z)
+        AOT_GOTO(0x0816, L0816);
+    AOT_GOTO(0x0804, L0804);
+L0804:
+    AOT_BLOCK(0x0804, 4);
+    // 0804: mov $c, (sp)
+    {
+        src = uint16_t(0x000c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0808: mov $20ea, -(sp)
+    {
+        src = uint16_t(0x20ea);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 080c: mov $4892, -(sp)
+    {
+        src = uint16_t(0x4892);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0810: jsr pc, *$0ca0
+    {
+        a = 0x0ca0;
+        r[6] -= 2;
+        WR16(r[6], 0x0814);
+    }
+    AOT_GOTO(0x0ca0, L0ca0);
+L0814:
+    AOT_BLOCK(0x0814, 1);
+    // 0814: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0816, L0816);
+L0816:
+    AOT_BLOCK(0x0816, 1);
+    // 0816: br 07c8
+    AOT_GOTO(0x07c8, L07c8);
+L0818:
+    AOT_BLOCK(0x0818, 1);
+    // 0818: jsr pc, 0ece
+    {
+        a = 0x0ece;
+        r[6] -= 2;
+        WR16(r[6], 0x081c);
+    }
+    AOT_GOTO(0x0ece, L0ece);
+L081c:
+    AOT_BLOCK(0x081c, 3);
+    // 081c: mov (r0), r4
+    {
+        a = r[0];
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 081e: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0820: bne 0830
+    if (!Z)
+        AOT_GOTO(0x0830, L0830);
+    AOT_GOTO(0x0822, L0822);
+L0822:
+    AOT_BLOCK(0x0822, 3);
+    // 0822: mov $1751, (sp)
+    {
+        src = uint16_t(0x1751);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0826: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 082a: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x082e);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L082e:
+    AOT_BLOCK(0x082e, 1);
+    // 082e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0830, L0830);
+L0830:
+    AOT_BLOCK(0x0830, 2);
+    // 0830: cmpb $20, 20f2
+    {
+        src = uint8_t(0x20);
+        b = 0x20f2;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0836: bne 0852
+    if (!Z)
+        AOT_GOTO(0x0852, L0852);
+    AOT_GOTO(0x0838, L0838);
+L0838:
+    AOT_BLOCK(0x0838, 2);
+    // 0838: cmp $4048, r3
+    {
+        src = uint16_t(0x4048);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 083c: bhi 084c
+    if (!(C | Z))
+        AOT_GOTO(0x084c, L084c);
+    AOT_GOTO(0x083e, L083e);
+L083e:
+    AOT_BLOCK(0x083e, 3);
+    // 083e: mov $1772, (sp)
+    {
+        src = uint16_t(0x1772);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0842: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0846: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x084a);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L084a:
+    AOT_BLOCK(0x084a, 1);
+    // 084a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x084c, L084c);
+L084c:
+    AOT_BLOCK(0x084c, 3);
+    // 084c: mov r2, (r3)+
+    {
+        src = r[2];
+        b = r[3];
+        r[3] += 2;
+        WR16(b, src);
+    }
+    // 084e: mov r4, (r3)+
+    {
+        src = r[4];
+        b = r[3];
+        r[3] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0850: br 07c8
+    AOT_GOTO(0x07c8, L07c8);
+L0852:
+    AOT_BLOCK(0x0852, 2);
+    // 0852: cmpb 8(r4), 20f2
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD8(a);
+        b = 0x20f2;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0858: bne 0862
+    if (!Z)
+        AOT_GOTO(0x0862, L0862);
+    AOT_GOTO(0x085a, L085a);
+L085a:
+    AOT_BLOCK(0x085a, 2);
+    // 085a: cmp a(r4), 20f4
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = 0x20f4;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0860: beq 087c
+    if (Z)
+        AOT_GOTO(0x087c, L087c);
+    AOT_GOTO(0x0862, L0862);
+L0862:
+    AOT_BLOCK(0x0862, 3);
+    // 0862: mov $20ea, (sp)
+    {
+        src = uint16_t(0x20ea);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0866: mov $1788, -(sp)
+    {
+        src = uint16_t(0x1788);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 086a: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x086e);
+    }
+    AOT_GOTO(0x1120, L1120);
+L086e:
+    AOT_BLOCK(0x086e, 4);
+    // 086e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0870: mov $178f, (sp)
+    {
+        src = uint16_t(0x178f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0874: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0876: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x087a);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L087a:
+    AOT_BLOCK(0x087a, 1);
+    // 087a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x087c, L087c);
+L087c:
+    AOT_BLOCK(0x087c, 1);
+    // 087c: br 07c8
+    AOT_GOTO(0x07c8, L07c8);
+L087e:
+    AOT_BLOCK(0x087e, 5);
+    // 087e: mov 1cdc, (sp)
+    {
+        a = 0x1cdc;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0882: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0886: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 088a: mov $1cb6, -(sp)
+    {
+        src = uint16_t(0x1cb6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 088e: jsr pc, *$0cc2
+    {
+        a = 0x0cc2;
+        r[6] -= 2;
+        WR16(r[6], 0x0892);
+    }
+    AOT_GOTO(0x0cc2, L0cc2);
+L0892:
+    AOT_BLOCK(0x0892, 10);
+    // 0892: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0896: mov 1cdc, (sp)
+    {
+        a = 0x1cdc;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 089a: mov 1cdc, r0
+    {
+        a = 0x1cdc;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 089e: add 1cde, r0
+    {
+        a = 0x1cde;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 08a2: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+    }
+    // 08a4: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08a6: add 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 08aa: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08ae: mov $1cc0, -(sp)
+    {
+        src = uint16_t(0x1cc0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08b2: jsr pc, *$0cc2
+    {
+        a = 0x0cc2;
+        r[6] -= 2;
+        WR16(r[6], 0x08b6);
+    }
+    AOT_GOTO(0x0cc2, L0cc2);
+L08b6:
+    AOT_BLOCK(0x08b6, 6);
+    // 08b6: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 08ba: mov $4486, (sp)
+    {
+        src = uint16_t(0x4486);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08be: mov $407a, -(sp)
+    {
+        src = uint16_t(0x407a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08c2: mov 4072, -(sp)
+    {
+        a = 0x4072;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08c6: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08c8: jsr pc, *$0940
+    {
+        a = 0x0940;
+        r[6] -= 2;
+        WR16(r[6], 0x08cc);
+    }
+    AOT_GOTO(0x0940, L0940);
+L08cc:
+    AOT_BLOCK(0x08cc, 9);
+    // 08cc: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 08d0: mov 1cde, (sp)
+    {
+        a = 0x1cde;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08d4: mov 1cdc, r0
+    {
+        a = 0x1cdc;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 08d8: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+    }
+    // 08da: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08dc: add 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 08e0: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08e4: mov $1cb6, -(sp)
+    {
+        src = uint16_t(0x1cb6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08e8: jsr pc, *$0cc2
+    {
+        a = 0x0cc2;
+        r[6] -= 2;
+        WR16(r[6], 0x08ec);
+    }
+    AOT_GOTO(0x0cc2, L0cc2);
+L08ec:
+    AOT_BLOCK(0x08ec, 10);
+    // 08ec: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 08f0: mov 1cde, (sp)
+    {
+        a = 0x1cde;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08f4: mov 1cde, r0
+    {
+        a = 0x1cde;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 08f8: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+    }
+    // 08fa: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08fc: add 1cdc, (sp)
+    {
+        a = 0x1cdc;
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0900: add 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0904: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0908: mov $1cc0, -(sp)
+    {
+        src = uint16_t(0x1cc0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 090c: jsr pc, *$0cc2
+    {
+        a = 0x0cc2;
+        r[6] -= 2;
+        WR16(r[6], 0x0910);
+    }
+    AOT_GOTO(0x0cc2, L0cc2);
+L0910:
+    AOT_BLOCK(0x0910, 6);
+    // 0910: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0914: mov $468c, (sp)
+    {
+        src = uint16_t(0x468c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0918: mov $4280, -(sp)
+    {
+        src = uint16_t(0x4280);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 091c: mov 4074, -(sp)
+    {
+        a = 0x4074;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0920: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0922: jsr pc, *$0940
+    {
+        a = 0x0940;
+        r[6] -= 2;
+        WR16(r[6], 0x0926);
+    }
+    AOT_GOTO(0x0940, L0940);
+L0926:
+    AOT_BLOCK(0x0926, 6);
+    // 0926: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 092a: add 1cdc, 406c
+    {
+        a = 0x1cdc;
+        src = RD16(a);
+        b = 0x406c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0930: add 1cde, 406e
+    {
+        a = 0x1cde;
+        src = RD16(a);
+        b = 0x406e;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0936: add 1ce0, 4070
+    {
+        a = 0x1ce0;
+        src = RD16(a);
+        b = 0x4070;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 093c: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0940:
+    AOT_BLOCK(0x0940, 2);
+    // 0940: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0944;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0944, L0944);
+L0944:
+    AOT_BLOCK(0x0944, 3);
+    // 0944: dec 1cbc
+    {
+        a = 0x1cbc;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0948: tst 1cbc
+    {
+        a = 0x1cbc;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 094c: bgt 0968
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0968, L0968);
+    AOT_GOTO(0x094e, L094e);
+L094e:
+    AOT_BLOCK(0x094e, 2);
+    // 094e: tst 1cbc
+    {
+        a = 0x1cbc;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0952: bge 0958
+    if (!(N ^ V))
+        AOT_GOTO(0x0958, L0958);
+    AOT_GOTO(0x0954, L0954);
+L0954:
+    AOT_BLOCK(0x0954, 1);
+    // 0954: jmp *$0a92
+    {
+        a = 0x0a92;
+    }
+    AOT_GOTO(0x0a92, L0a92);
+L0958:
+    AOT_BLOCK(0x0958, 3);
+    // 0958: inc 1cbc
+    {
+        a = 0x1cbc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 095c: mov $1cb6, (sp)
+    {
+        src = uint16_t(0x1cb6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0960: jsr pc, *$0dac
+    {
+        a = 0x0dac;
+        r[6] -= 2;
+        WR16(r[6], 0x0964);
+    }
+    AOT_GOTO(0x0dac, L0dac);
+L0964:
+    AOT_BLOCK(0x0964, 2);
+    // 0964: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0966: br 0990
+    AOT_GOTO(0x0990, L0990);
+L0968:
+    AOT_BLOCK(0x0968, 3);
+    // 0968: dec 1cba
+    {
+        a = 0x1cba;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 096c: tst 1cba
+    {
+        a = 0x1cba;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0970: bge 0986
+    if (!(N ^ V))
+        AOT_GOTO(0x0986, L0986);
+    AOT_GOTO(0x0972, L0972);
+L0972:
+    AOT_BLOCK(0x0972, 4);
+    // 0972: inc 1cba
+    {
+        a = 0x1cba;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0976: inc 1cbc
+    {
+        a = 0x1cbc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 097a: mov $1cb6, (sp)
+    {
+        src = uint16_t(0x1cb6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 097e: jsr pc, *$0dac
+    {
+        a = 0x0dac;
+        r[6] -= 2;
+        WR16(r[6], 0x0982);
+    }
+    AOT_GOTO(0x0dac, L0dac);
+L0982:
+    AOT_BLOCK(0x0982, 2);
+    // 0982: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0984: br 0990
+    AOT_GOTO(0x0990, L0990);
+L0986:
+    AOT_BLOCK(0x0986, 2);
+    // 0986: mov *1cb6, r3
+    {
+        a = RD16(0x1cb6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 098a: add $2, 1cb6
+    {
+        src = uint16_t(0x0002);
+        b = 0x1cb6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0990, L0990);
+L0990:
+    AOT_BLOCK(0x0990, 3);
+    // 0990: dec 1cc6
+    {
+        a = 0x1cc6;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0994: tst 1cc6
+    {
+        a = 0x1cc6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0998: bgt 09be
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x09be, L09be);
+    AOT_GOTO(0x099a, L099a);
+L099a:
+    AOT_BLOCK(0x099a, 2);
+    // 099a: tst 1cc6
+    {
+        a = 0x1cc6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 099e: bge 09ae
+    if (!(N ^ V))
+        AOT_GOTO(0x09ae, L09ae);
+    AOT_GOTO(0x09a0, L09a0);
+L09a0:
+    AOT_BLOCK(0x09a0, 3);
+    // 09a0: mov $17a0, (sp)
+    {
+        src = uint16_t(0x17a0);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 09a4: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09a8: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x09ac);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L09ac:
+    AOT_BLOCK(0x09ac, 1);
+    // 09ac: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x09ae, L09ae);
+L09ae:
+    AOT_BLOCK(0x09ae, 3);
+    // 09ae: inc 1cc6
+    {
+        a = 0x1cc6;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09b2: mov $1cc0, (sp)
+    {
+        src = uint16_t(0x1cc0);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09b6: jsr pc, *$0dac
+    {
+        a = 0x0dac;
+        r[6] -= 2;
+        WR16(r[6], 0x09ba);
+    }
+    AOT_GOTO(0x0dac, L0dac);
+L09ba:
+    AOT_BLOCK(0x09ba, 2);
+    // 09ba: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09bc: br 09e6
+    AOT_GOTO(0x09e6, L09e6);
+L09be:
+    AOT_BLOCK(0x09be, 3);
+    // 09be: dec 1cc4
+    {
+        a = 0x1cc4;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 09c2: tst 1cc4
+    {
+        a = 0x1cc4;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09c6: bge 09dc
+    if (!(N ^ V))
+        AOT_GOTO(0x09dc, L09dc);
+    AOT_GOTO(0x09c8, L09c8);
+L09c8:
+    AOT_BLOCK(0x09c8, 4);
+    // 09c8: inc 1cc4
+    {
+        a = 0x1cc4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09cc: inc 1cc6
+    {
+        a = 0x1cc6;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09d0: mov $1cc0, (sp)
+    {
+        src = uint16_t(0x1cc0);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09d4: jsr pc, *$0dac
+    {
+        a = 0x0dac;
+        r[6] -= 2;
+        WR16(r[6], 0x09d8);
+    }
+    AOT_GOTO(0x0dac, L0dac);
+L09d8:
+    AOT_BLOCK(0x09d8, 2);
+    // 09d8: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09da: br 09e6
+    AOT_GOTO(0x09e6, L09e6);
+L09dc:
+    AOT_BLOCK(0x09dc, 2);
+    // 09dc: mov *1cc0, r4
+    {
+        a = RD16(0x1cc0);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 09e0: add $2, 1cc0
+    {
+        src = uint16_t(0x0002);
+        b = 0x1cc0;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x09e6, L09e6);
+L09e6:
+    AOT_BLOCK(0x09e6, 3);
+    // 09e6: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 09e8: bic $fff1, r0
+    {
+        src = uint16_t(0xfff1);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 09ec: br 0a56
+    AOT_GOTO(0x0a56, L0a56);
+L09ee:
+    AOT_BLOCK(0x09ee, 2);
+    // 09ee: add 4072, r3
+    {
+        a = 0x4072;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 09f2: br 0a66
+    AOT_GOTO(0x0a66, L0a66);
+L09f4:
+    AOT_BLOCK(0x09f4, 2);
+    // 09f4: add 4074, r3
+    {
+        a = 0x4074;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 09f8: br 0a66
+    AOT_GOTO(0x0a66, L0a66);
+L09fa:
+    AOT_BLOCK(0x09fa, 2);
+    // 09fa: add 4076, r3
+    {
+        a = 0x4076;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 09fe: br 0a66
+    AOT_GOTO(0x0a66, L0a66);
+L0a00:
+    AOT_BLOCK(0x0a00, 3);
+    // 0a00: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a02: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a06: jsr pc, *$103e
+    {
+        a = 0x103e;
+        r[6] -= 2;
+        WR16(r[6], 0x0a0a);
+    }
+    AOT_GOTO(0x103e, L103e);
+L0a0a:
+    AOT_BLOCK(0x0a0a, 4);
+    // 0a0a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0a0c: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0a0e: cmpb $20, 8(r2)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[2] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a14: bne 0a3a
+    if (!Z)
+        AOT_GOTO(0x0a3a, L0a3a);
+    AOT_GOTO(0x0a16, L0a16);
+L0a16:
+    AOT_BLOCK(0x0a16, 12);
+    // 0a16: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 0a18: sub $20f6, r1
+    {
+        src = uint16_t(0x20f6);
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        N = val16 < 0;
+    }
+    // 0a1c: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0a1e: div $c, r0
+    {
+        src = int16_t(uint16_t(0x000c));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0a22: add 406a, r0
+    {
+        a = 0x406a;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0a26: ash $4, r0
+    {
+        src = uint16_t(0x0004) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0a2a: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 0a2c: bic $fffe, r1
+    {
+        src = uint16_t(0xfffe);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 0a30: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0a32: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0a34: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0a38: br 0a66
+    AOT_GOTO(0x0a66, L0a66);
+L0a3a:
+    AOT_BLOCK(0x0a3a, 9);
+    // 0a3a: add a(r2), r3
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 0a3e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0a40: bic $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0a44: movb 8(r2), r1
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 0a48: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0a4a: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0a4c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0a4e: add $ffbe, r4
+    {
+        src = uint16_t(0xffbe);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0a52: br 0a66
+    AOT_GOTO(0x0a66, L0a66);
+L0a56:
+    AOT_BLOCK(0x0a56, 3);
+    // 0a56: sub $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0a5a: cmp r0, $6
+    {
+        src = r[0];
+        dst = uint16_t(0x0006);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a5e: bhi 0a66
+    if (!(C | Z))
+        AOT_GOTO(0x0a66, L0a66);
+    AOT_GOTO(0x0a60, L0a60);
+L0a60:
+    AOT_BLOCK(0x0a60, 2);
+    // 0a60: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0a62: jmp *16b6(r0)
+    {
+        a = RD16(r[0] + 5814);
+    }
+    AOT_JUMP(a);
+L0a66:
+    AOT_BLOCK(0x0a66, 2);
+    // 0a66: bit $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0a6a: beq 0a70
+    if (Z)
+        AOT_GOTO(0x0a70, L0a70);
+    AOT_GOTO(0x0a6c, L0a6c);
+L0a6c:
+    AOT_BLOCK(0x0a6c, 1);
+    // 0a6c: sub 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0a70, L0a70);
+L0a70:
+    AOT_BLOCK(0x0a70, 3);
+    // 0a70: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a74: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a76: jsr pc, *$13f2
+    {
+        a = 0x13f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0a7a);
+    }
+    AOT_GOTO(0x13f2, L13f2);
+L0a7a:
+    AOT_BLOCK(0x0a7a, 3);
+    // 0a7a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0a7c: tst 4052
+    {
+        a = 0x4052;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a80: beq 0a8e
+    if (Z)
+        AOT_GOTO(0x0a8e, L0a8e);
+    AOT_GOTO(0x0a82, L0a82);
+L0a82:
+    AOT_BLOCK(0x0a82, 3);
+    // 0a82: mov a(r5), (sp)
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a86: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a88: jsr pc, *$13f2
+    {
+        a = 0x13f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0a8c);
+    }
+    AOT_GOTO(0x13f2, L13f2);
+L0a8c:
+    AOT_BLOCK(0x0a8c, 1);
+    // 0a8c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0a8e, L0a8e);
+L0a8e:
+    AOT_BLOCK(0x0a8e, 1);
+    // 0a8e: jmp *$0944
+    {
+        a = 0x0944;
+    }
+    AOT_GOTO(0x0944, L0944);
+L0a92:
+    AOT_BLOCK(0x0a92, 2);
+    // 0a92: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a96:
+    AOT_BLOCK(0x0a96, 4);
+    // 0a96: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a9a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0a9a: tst 4058
+    {
+        a = 0x4058;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a9e: bne 0aa6
+    if (!Z)
+        AOT_GOTO(0x0aa6, L0aa6);
+    AOT_GOTO(0x0aa0, L0aa0);
+L0aa0:
+    AOT_BLOCK(0x0aa0, 2);
+    // 0aa0: tst 405c
+    {
+        a = 0x405c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0aa4: beq 0ad4
+    if (Z)
+        AOT_GOTO(0x0ad4, L0ad4);
+    AOT_GOTO(0x0aa6, L0aa6);
+L0aa6:
+    AOT_BLOCK(0x0aa6, 1);
+    // 0aa6: mov 406c, r4
+    {
+        a = 0x406c;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0aaa, L0aaa);
+L0aaa:
+    AOT_BLOCK(0x0aaa, 2);
+    // 0aaa: bit $3f, r4
+    {
+        src = uint16_t(0x003f);
+        dst = r[4];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0aae: beq 0ad4
+    if (Z)
+        AOT_GOTO(0x0ad4, L0ad4);
+    AOT_GOTO(0x0ab0, L0ab0);
+L0ab0:
+    AOT_BLOCK(0x0ab0, 4);
+    // 0ab0: add $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+    }
+    // 0ab4: mov $407a, (sp)
+    {
+        src = uint16_t(0x407a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ab8: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0aba: jsr pc, *$13f2
+    {
+        a = 0x13f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0abe);
+    }
+    AOT_GOTO(0x13f2, L13f2);
+L0abe:
+    AOT_BLOCK(0x0abe, 3);
+    // 0abe: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0ac0: tst 4052
+    {
+        a = 0x4052;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ac4: beq 0ad2
+    if (Z)
+        AOT_GOTO(0x0ad2, L0ad2);
+    AOT_GOTO(0x0ac6, L0ac6);
+L0ac6:
+    AOT_BLOCK(0x0ac6, 3);
+    // 0ac6: mov $4486, (sp)
+    {
+        src = uint16_t(0x4486);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0aca: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0acc: jsr pc, *$13f2
+    {
+        a = 0x13f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0ad0);
+    }
+    AOT_GOTO(0x13f2, L13f2);
+L0ad0:
+    AOT_BLOCK(0x0ad0, 1);
+    // 0ad0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0ad2, L0ad2);
+L0ad2:
+    AOT_BLOCK(0x0ad2, 1);
+    // 0ad2: br 0aaa
+    AOT_GOTO(0x0aaa, L0aaa);
+L0ad4:
+    AOT_BLOCK(0x0ad4, 3);
+    // 0ad4: mov $61, (sp)
+    {
+        src = uint16_t(0x0061);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ad8: mov $4280, -(sp)
+    {
+        src = uint16_t(0x4280);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0adc: jsr pc, *$0bb0
+    {
+        a = 0x0bb0;
+        r[6] -= 2;
+        WR16(r[6], 0x0ae0);
+    }
+    AOT_GOTO(0x0bb0, L0bb0);
+L0ae0:
+    AOT_BLOCK(0x0ae0, 3);
+    // 0ae0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0ae2: tst 4052
+    {
+        a = 0x4052;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ae6: beq 0b04
+    if (Z)
+        AOT_GOTO(0x0b04, L0b04);
+    AOT_GOTO(0x0ae8, L0ae8);
+L0ae8:
+    AOT_BLOCK(0x0ae8, 3);
+    // 0ae8: mov $63, (sp)
+    {
+        src = uint16_t(0x0063);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0aec: mov $4486, -(sp)
+    {
+        src = uint16_t(0x4486);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0af0: jsr pc, *$0bb0
+    {
+        a = 0x0bb0;
+        r[6] -= 2;
+        WR16(r[6], 0x0af4);
+    }
+    AOT_GOTO(0x0bb0, L0bb0);
+L0af4:
+    AOT_BLOCK(0x0af4, 4);
+    // 0af4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0af6: mov $64, (sp)
+    {
+        src = uint16_t(0x0064);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0afa: mov $468c, -(sp)
+    {
+        src = uint16_t(0x468c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0afe: jsr pc, *$0bb0
+    {
+        a = 0x0bb0;
+        r[6] -= 2;
+        WR16(r[6], 0x0b02);
+    }
+    AOT_GOTO(0x0bb0, L0bb0);
+L0b02:
+    AOT_BLOCK(0x0b02, 1);
+    // 0b02: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0b04, L0b04);
+L0b04:
+    AOT_BLOCK(0x0b04, 2);
+    // 0b04: tst 4056
+    {
+        a = 0x4056;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b08: bne 0b36
+    if (!Z)
+        AOT_GOTO(0x0b36, L0b36);
+    AOT_GOTO(0x0b0a, L0b0a);
+L0b0a:
+    AOT_BLOCK(0x0b0a, 2);
+    // 0b0a: tst 404e
+    {
+        a = 0x404e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b0e: bne 0b1e
+    if (!Z)
+        AOT_GOTO(0x0b1e, L0b1e);
+    AOT_GOTO(0x0b10, L0b10);
+L0b10:
+    AOT_BLOCK(0x0b10, 3);
+    // 0b10: mov $62, (sp)
+    {
+        src = uint16_t(0x0062);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b14: mov $4892, -(sp)
+    {
+        src = uint16_t(0x4892);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b18: jsr pc, *$0bb0
+    {
+        a = 0x0bb0;
+        r[6] -= 2;
+        WR16(r[6], 0x0b1c);
+    }
+    AOT_GOTO(0x0bb0, L0bb0);
+L0b1c:
+    AOT_BLOCK(0x0b1c, 1);
+    // 0b1c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0b1e, L0b1e);
+L0b1e:
+    AOT_BLOCK(0x0b1e, 1);
+    // 0b1e: mov $20f6, r3
+    {
+        src = uint16_t(0x20f6);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b22, L0b22);
+L0b22:
+    AOT_BLOCK(0x0b22, 2);
+    // 0b22: cmp 165a, r3
+    {
+        a = 0x165a;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b26: blos 0b36
+    if (C | Z)
+        AOT_GOTO(0x0b36, L0b36);
+    AOT_GOTO(0x0b28, L0b28);
+L0b28:
+    AOT_BLOCK(0x0b28, 3);
+    // 0b28: mov $407a, (sp)
+    {
+        src = uint16_t(0x407a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b2c: mov (r3)+, -(sp)
+    {
+        a = r[3];
+        r[3] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b2e: jsr pc, *$13f2
+    {
+        a = 0x13f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0b32);
+    }
+    AOT_GOTO(0x13f2, L13f2);
+L0b32:
+    AOT_BLOCK(0x0b32, 2);
+    // 0b32: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b34: br 0b22
+    AOT_GOTO(0x0b22, L0b22);
+L0b36:
+    AOT_BLOCK(0x0b36, 2);
+    // 0b36: mov $407a, (sp)
+    {
+        src = uint16_t(0x407a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b3a: jsr pc, *$1454
+    {
+        a = 0x1454;
+        r[6] -= 2;
+        WR16(r[6], 0x0b3e);
+    }
+    AOT_GOTO(0x1454, L1454);
+L0b3e:
+    AOT_BLOCK(0x0b3e, 2);
+    // 0b3e: mov 407a, (sp)
+    {
+        a = 0x407a;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b42: jsr pc, *$1362
+    {
+        a = 0x1362;
+        r[6] -= 2;
+        WR16(r[6], 0x0b46);
+    }
+    AOT_GOTO(0x1362, L1362);
+L0b46:
+    AOT_BLOCK(0x0b46, 2);
+    // 0b46: mov $17b1, (sp)
+    {
+        src = uint16_t(0x17b1);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b4a: jsr pc, *$15ec
+    {
+        a = 0x15ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0b4e);
+    }
+    AOT_GOTO(0x15ec, L15ec);
+L0b4e:
+    AOT_BLOCK(0x0b4e, 3);
+    // 0b4e: mov $17bd, (sp)
+    {
+        src = uint16_t(0x17bd);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b52: mov $17b7, -(sp)
+    {
+        src = uint16_t(0x17b7);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b56: jsr pc, *$1396
+    {
+        a = 0x1396;
+        r[6] -= 2;
+        WR16(r[6], 0x0b5a);
+    }
+    AOT_GOTO(0x1396, L1396);
+L0b5a:
+    AOT_BLOCK(0x0b5a, 3);
+    // 0b5a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0b5c: mov 4078, 165c
+    {
+        a = 0x4078;
+        src = RD16(a);
+        b = 0x165c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b62: jsr pc, 0b6a
+    {
+        a = 0x0b6a;
+        r[6] -= 2;
+        WR16(r[6], 0x0b66);
+    }
+    AOT_GOTO(0x0b6a, L0b6a);
+L0b66:
+    AOT_BLOCK(0x0b66, 2);
+    // 0b66: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b6a:
+    AOT_BLOCK(0x0b6a, 4);
+    // 0b6a: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b6e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0b6e: mov $17c3, (sp)
+    {
+        src = uint16_t(0x17c3);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b72: jsr pc, *$15ec
+    {
+        a = 0x15ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0b76);
+    }
+    AOT_GOTO(0x15ec, L15ec);
+L0b76:
+    AOT_BLOCK(0x0b76, 1);
+    // 0b76: mov $61, r4
+    {
+        src = uint16_t(0x0061);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b7a, L0b7a);
+L0b7a:
+    AOT_BLOCK(0x0b7a, 2);
+    // 0b7a: cmp $64, r4
+    {
+        src = uint16_t(0x0064);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b7e: blt 0b90
+    if (N ^ V)
+        AOT_GOTO(0x0b90, L0b90);
+    AOT_GOTO(0x0b80, L0b80);
+L0b80:
+    AOT_BLOCK(0x0b80, 3);
+    // 0b80: movb r4, 1664
+    {
+        src = uint8_t(r[4]);
+        b = 0x1664;
+        WR8(b, src);
+    }
+    // 0b84: mov $165e, (sp)
+    {
+        src = uint16_t(0x165e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b88: jsr pc, *$15ec
+    {
+        a = 0x15ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0b8c);
+    }
+    AOT_GOTO(0x15ec, L15ec);
+L0b8c:
+    AOT_BLOCK(0x0b8c, 2);
+    // 0b8c: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0b8e: br 0b7a
+    AOT_GOTO(0x0b7a, L0b7a);
+L0b90:
+    AOT_BLOCK(0x0b90, 2);
+    // 0b90: tst 165c
+    {
+        a = 0x165c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b94: bne 0ba4
+    if (!Z)
+        AOT_GOTO(0x0ba4, L0ba4);
+    AOT_GOTO(0x0b96, L0b96);
+L0b96:
+    AOT_BLOCK(0x0b96, 3);
+    // 0b96: mov $1ff, (sp)
+    {
+        src = uint16_t(0x01ff);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b9a: mov $17c9, -(sp)
+    {
+        src = uint16_t(0x17c9);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b9e: jsr pc, *$1342
+    {
+        a = 0x1342;
+        r[6] -= 2;
+        WR16(r[6], 0x0ba2);
+    }
+    AOT_GOTO(0x1342, L1342);
+L0ba2:
+    AOT_BLOCK(0x0ba2, 1);
+    // 0ba2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0ba4, L0ba4);
+L0ba4:
+    AOT_BLOCK(0x0ba4, 2);
+    // 0ba4: mov 165c, (sp)
+    {
+        a = 0x165c;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ba8: jsr pc, *$1606
+    {
+        a = 0x1606;
+        r[6] -= 2;
+        WR16(r[6], 0x0bac);
+    }
+    AOT_GOTO(0x1606, L1606);
+L0bac:
+    AOT_BLOCK(0x0bac, 2);
+    // 0bac: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0bb0:
+    AOT_BLOCK(0x0bb0, 4);
+    // 0bb0: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0bb4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0bb4: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bb8: jsr pc, *$1454
+    {
+        a = 0x1454;
+        r[6] -= 2;
+        WR16(r[6], 0x0bbc);
+    }
+    AOT_GOTO(0x1454, L1454);
+L0bbc:
+    AOT_BLOCK(0x0bbc, 2);
+    // 0bbc: mov *4(r5), (sp)
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bc0: jsr pc, *$1362
+    {
+        a = 0x1362;
+        r[6] -= 2;
+        WR16(r[6], 0x0bc4);
+    }
+    AOT_GOTO(0x1362, L1362);
+L0bc4:
+    AOT_BLOCK(0x0bc4, 3);
+    // 0bc4: movb 6(r5), 1664
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD8(a);
+        b = 0x1664;
+        WR8(b, src);
+    }
+    // 0bca: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0bcc: mov $165e, -(sp)
+    {
+        src = uint16_t(0x165e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bd0, L0bd0);
+L0bd0:
+    AOT_BLOCK(0x0bd0, 1);
+    // 0bd0: jsr pc, *$13b6
+    {
+        a = 0x13b6;
+        r[6] -= 2;
+        WR16(r[6], 0x0bd4);
+    }
+    AOT_GOTO(0x13b6, L13b6);
+L0bd4:
+    AOT_BLOCK(0x0bd4, 2);
+    // 0bd4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0bd6: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bd8, L0bd8);
+L0bd8:
+    AOT_BLOCK(0x0bd8, 4);
+    // 0bd8: mov $200, (sp)
+    {
+        src = uint16_t(0x0200);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bdc: mov $4280, -(sp)
+    {
+        src = uint16_t(0x4280);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0be0: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0be2: jsr pc, *$1498
+    {
+        a = 0x1498;
+        r[6] -= 2;
+        WR16(r[6], 0x0be6);
+    }
+    AOT_GOTO(0x1498, L1498);
+L0be6:
+    AOT_BLOCK(0x0be6, 4);
+    // 0be6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0be8: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0bea: cmp $1, r2
+    {
+        src = uint16_t(0x0001);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bee: bge 0c08
+    if (!(N ^ V))
+        AOT_GOTO(0x0c08, L0c08);
+    AOT_GOTO(0x0bf0, L0bf0);
+L0bf0:
+    AOT_BLOCK(0x0bf0, 2);
+    // 0bf0: asr r2
+    {
+        src = r[2];
+        val = int16_t(src) >> 1;
+        r[2] = val;
+        C = (src & 1) != 0;
+    }
+    // 0bf2: mov $4280, r3
+    {
+        src = uint16_t(0x4280);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bf6, L0bf6);
+L0bf6:
+    AOT_BLOCK(0x0bf6, 3);
+    // 0bf6: mov $407a, (sp)
+    {
+        src = uint16_t(0x407a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bfa: mov (r3)+, -(sp)
+    {
+        a = r[3];
+        r[3] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bfc: jsr pc, *$13f2
+    {
+        a = 0x13f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0c00);
+    }
+    AOT_GOTO(0x13f2, L13f2);
+L0c00:
+    AOT_BLOCK(0x0c00, 3);
+    // 0c00: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0c02: dec r2
+    {
+        val = int(int16_t(r[2])) - 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0c04: bne 0bf6
+    if (!Z)
+        AOT_GOTO(0x0bf6, L0bf6);
+    AOT_GOTO(0x0c06, L0c06);
+L0c06:
+    AOT_BLOCK(0x0c06, 1);
+    // 0c06: br 0bd8
+    AOT_GOTO(0x0bd8, L0bd8);
+L0c08:
+    AOT_BLOCK(0x0c08, 2);
+    // 0c08: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c0a: jsr pc, *$1362
+    {
+        a = 0x1362;
+        r[6] -= 2;
+        WR16(r[6], 0x0c0e);
+    }
+    AOT_GOTO(0x1362, L1362);
+L0c0e:
+    AOT_BLOCK(0x0c0e, 2);
+    // 0c0e: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0c12:
+    AOT_BLOCK(0x0c12, 4);
+    // 0c12: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0c16;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0c16: tst 4056
+    {
+        a = 0x4056;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c1a: bne 0c4e
+    if (!Z)
+        AOT_GOTO(0x0c4e, L0c4e);
+    AOT_GOTO(0x0c1c, L0c1c);
+L0c1c:
+    AOT_BLOCK(0x0c1c, 2);
+    // 0c1c: tst 404e
+    {
+        a = 0x404e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c20: bne 0c4e
+    if (!Z)
+        AOT_GOTO(0x0c4e, L0c4e);
+    AOT_GOTO(0x0c22, L0c22);
+L0c22:
+    AOT_BLOCK(0x0c22, 3);
+    // 0c22: mov $20ea, (sp)
+    {
+        src = uint16_t(0x20ea);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c26: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c2a: jsr pc, *$10f8
+    {
+        a = 0x10f8;
+        r[6] -= 2;
+        WR16(r[6], 0x0c2e);
+    }
+    AOT_GOTO(0x10f8, L10f8);
+L0c2e:
+    AOT_BLOCK(0x0c2e, 7);
+    // 0c2e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0c30: movb $1f, 20f2
+    {
+        src = uint8_t(0x1f);
+        b = 0x20f2;
+        WR8(b, src);
+    }
+    // 0c36: mov 406c, 20f4
+    {
+        a = 0x406c;
+        src = RD16(a);
+        b = 0x20f4;
+        WR16(b, src);
+    }
+    // 0c3c: mov $c, (sp)
+    {
+        src = uint16_t(0x000c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c40: mov $20ea, -(sp)
+    {
+        src = uint16_t(0x20ea);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c44: mov $4892, -(sp)
+    {
+        src = uint16_t(0x4892);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c48: jsr pc, *$0ca0
+    {
+        a = 0x0ca0;
+        r[6] -= 2;
+        WR16(r[6], 0x0c4c);
+    }
+    AOT_GOTO(0x0ca0, L0ca0);
+L0c4c:
+    AOT_BLOCK(0x0c4c, 1);
+    // 0c4c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0c4e, L0c4e);
+L0c4e:
+    AOT_BLOCK(0x0c4e, 2);
+    // 0c4e: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0c52:
+    AOT_BLOCK(0x0c52, 8);
+    // 0c52: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0c56;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0c56: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0c5a: asr r3
+    {
+        src = r[3];
+        val = int16_t(src) >> 1;
+        r[3] = val;
+    }
+    // 0c5c: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0c60: sub r3, 1cba
+    {
+        src = r[3];
+        b = 0x1cba;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x1cba;
+        WR16(b, val16);
+    }
+    // 0c64: tst 1cba
+    {
+        a = 0x1cba;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c68: blt 0c8a
+    if (N ^ V)
+        AOT_GOTO(0x0c8a, L0c8a);
+    AOT_GOTO(0x0c6a, L0c6a);
+L0c6a:
+    AOT_BLOCK(0x0c6a, 3);
+    // 0c6a: sub r3, 1cbc
+    {
+        src = r[3];
+        b = 0x1cbc;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x1cbc;
+        WR16(b, val16);
+    }
+    // 0c6e: tst 1cbc
+    {
+        a = 0x1cbc;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c72: ble 0c86
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0c86, L0c86);
+    AOT_GOTO(0x0c74, L0c74);
+L0c74:
+    AOT_BLOCK(0x0c74, 1);
+    // 0c74: mov 1cb6, r2
+    {
+        a = 0x1cb6;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c78, L0c78);
+L0c78:
+    AOT_BLOCK(0x0c78, 3);
+    // 0c78: mov (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+    }
+    // 0c7a: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0c7c: bne 0c78
+    if (!Z)
+        AOT_GOTO(0x0c78, L0c78);
+    AOT_GOTO(0x0c7e, L0c7e);
+L0c7e:
+    AOT_BLOCK(0x0c7e, 2);
+    // 0c7e: mov r2, 1cb6
+    {
+        src = r[2];
+        b = 0x1cb6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c82: br 0c9c
+    AOT_GOTO(0x0c9c, L0c9c);
+L0c86:
+    AOT_BLOCK(0x0c86, 1);
+    // 0c86: add r3, 1cbc
+    {
+        src = r[3];
+        b = 0x1cbc;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0c8a, L0c8a);
+L0c8a:
+    AOT_BLOCK(0x0c8a, 1);
+    // 0c8a: add r3, 1cba
+    {
+        src = r[3];
+        b = 0x1cba;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0c8e, L0c8e);
+L0c8e:
+    AOT_BLOCK(0x0c8e, 2);
+    // 0c8e: mov $1cb6, (sp)
+    {
+        src = uint16_t(0x1cb6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c92: jsr pc, *$0dac
+    {
+        a = 0x0dac;
+        r[6] -= 2;
+        WR16(r[6], 0x0c96);
+    }
+    AOT_GOTO(0x0dac, L0dac);
+L0c96:
+    AOT_BLOCK(0x0c96, 3);
+    // 0c96: mov r0, (r4)+
+    {
+        src = r[0];
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+    }
+    // 0c98: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0c9a: bne 0c8e
+    if (!Z)
+        AOT_GOTO(0x0c8e, L0c8e);
+    AOT_GOTO(0x0c9c, L0c9c);
+L0c9c:
+    AOT_BLOCK(0x0c9c, 2);
+    // 0c9c: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ca0:
+    AOT_BLOCK(0x0ca0, 5);
+    // 0ca0: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0ca4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0ca4: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0ca8: mov 8(r5), r3
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0cac: asr r3
+    {
+        src = r[3];
+        val = int16_t(src) >> 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 1) != 0;
+        V = (val < 0) != ((src & 1) != 0);
+    }
+    AOT_GOTO(0x0cae, L0cae);
+L0cae:
+    AOT_BLOCK(0x0cae, 3);
+    // 0cae: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0cb2: mov (r4)+, -(sp)
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cb4: jsr pc, *$13f2
+    {
+        a = 0x13f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0cb8);
+    }
+    AOT_GOTO(0x13f2, L13f2);
+L0cb8:
+    AOT_BLOCK(0x0cb8, 3);
+    // 0cb8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0cba: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0cbc: bne 0cae
+    if (!Z)
+        AOT_GOTO(0x0cae, L0cae);
+    AOT_GOTO(0x0cbe, L0cbe);
+L0cbe:
+    AOT_BLOCK(0x0cbe, 2);
+    // 0cbe: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0cc2:
+    AOT_BLOCK(0x0cc2, 13);
+    // 0cc2: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0cc6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0cc6: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0cc8: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0ccc: mov 8(r5), r2
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0cd0: ash $fff8, r2
+    {
+        src = uint16_t(0xfff8) & 077;
+        val16 = r[2];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0cd4: bic $ff00, r2
+    {
+        src = uint16_t(0xff00);
+        dst = r[2];
+        val = (~src) & dst;
+        r[2] = val;
+    }
+    // 0cd8: add 6(r5), r2
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 0cdc: bic $ff00, 8(r5)
+    {
+        src = uint16_t(0xff00);
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0ce2: dec *8(r4)
+    {
+        a = RD16(r[4] + 8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0ce6: mov $18a6, r3
+    {
+        src = uint16_t(0x18a6);
+        r[3] = src;
+    }
+    // 0cea: cmp r2, 2(r3)
+    {
+        src = r[2];
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cee: beq 0d68
+    if (Z)
+        AOT_GOTO(0x0d68, L0d68);
+    AOT_GOTO(0x0cf0, L0cf0);
+L0cf0:
+    AOT_BLOCK(0x0cf0, 3);
+    // 0cf0: mov $1aac, r3
+    {
+        src = uint16_t(0x1aac);
+        r[3] = src;
+    }
+    // 0cf4: cmp r2, 2(r3)
+    {
+        src = r[2];
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cf8: beq 0d68
+    if (Z)
+        AOT_GOTO(0x0d68, L0d68);
+    AOT_GOTO(0x0cfa, L0cfa);
+L0cfa:
+    AOT_BLOCK(0x0cfa, 2);
+    // 0cfa: tst (r3)
+    {
+        a = r[3];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0cfc: beq 0d06
+    if (Z)
+        AOT_GOTO(0x0d06, L0d06);
+    AOT_GOTO(0x0cfe, L0cfe);
+L0cfe:
+    AOT_BLOCK(0x0cfe, 3);
+    // 0cfe: mov $18a6, r3
+    {
+        src = uint16_t(0x18a6);
+        r[3] = src;
+    }
+    // 0d02: tst (r3)
+    {
+        a = r[3];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d04: bne 0d5a
+    if (!Z)
+        AOT_GOTO(0x0d5a, L0d5a);
+    AOT_GOTO(0x0d06, L0d06);
+L0d06:
+    AOT_BLOCK(0x0d06, 2);
+    // 0d06: tst 18a6
+    {
+        a = 0x18a6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d0a: bne 0d1e
+    if (!Z)
+        AOT_GOTO(0x0d1e, L0d1e);
+    AOT_GOTO(0x0d0c, L0d0c);
+L0d0c:
+    AOT_BLOCK(0x0d0c, 2);
+    // 0d0c: tst 1aac
+    {
+        a = 0x1aac;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d10: bne 0d1e
+    if (!Z)
+        AOT_GOTO(0x0d1e, L0d1e);
+    AOT_GOTO(0x0d12, L0d12);
+L0d12:
+    AOT_BLOCK(0x0d12, 2);
+    // 0d12: cmp 1aae, 18a8
+    {
+        a = 0x1aae;
+        src = RD16(a);
+        b = 0x18a8;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d18: ble 0d1e
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0d1e, L0d1e);
+    AOT_GOTO(0x0d1a, L0d1a);
+L0d1a:
+    AOT_BLOCK(0x0d1a, 1);
+    // 0d1a: mov $18a6, r3
+    {
+        src = uint16_t(0x18a6);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d1e, L0d1e);
+L0d1e:
+    AOT_BLOCK(0x0d1e, 5);
+    // 0d1e: mov r2, 2(r3)
+    {
+        src = r[2];
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+    }
+    // 0d22: mov $3, (sp)
+    {
+        src = uint16_t(0x0003);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d26: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d28: mov 405e, -(sp)
+    {
+        a = 0x405e;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d2c: jsr pc, *$14ba
+    {
+        a = 0x14ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0d30);
+    }
+    AOT_GOTO(0x14ba, L14ba);
+L0d30:
+    AOT_BLOCK(0x0d30, 6);
+    // 0d30: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0d32: mov $200, (sp)
+    {
+        src = uint16_t(0x0200);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d36: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d38: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0d3c: mov 405e, -(sp)
+    {
+        a = 0x405e;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d40: jsr pc, *$1498
+    {
+        a = 0x1498;
+        r[6] -= 2;
+        WR16(r[6], 0x0d44);
+    }
+    AOT_GOTO(0x1498, L1498);
+L0d44:
+    AOT_BLOCK(0x0d44, 4);
+    // 0d44: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0d46: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+        C = (src & 1) != 0;
+    }
+    // 0d48: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d4c: bge 0d52
+    if (!(N ^ V))
+        AOT_GOTO(0x0d52, L0d52);
+    AOT_GOTO(0x0d4e, L0d4e);
+L0d4e:
+    AOT_BLOCK(0x0d4e, 1);
+    // 0d4e: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0d52, L0d52);
+L0d52:
+    AOT_BLOCK(0x0d52, 2);
+    // 0d52: mov -8(r5), 4(r3)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[3] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d58: br 0d68
+    AOT_GOTO(0x0d68, L0d68);
+L0d5a:
+    AOT_BLOCK(0x0d5a, 3);
+    // 0d5a: mov $17cf, (sp)
+    {
+        src = uint16_t(0x17cf);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d5e: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d62: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x0d66);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L0d66:
+    AOT_BLOCK(0x0d66, 1);
+    // 0d66: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0d68, L0d68);
+L0d68:
+    AOT_BLOCK(0x0d68, 10);
+    // 0d68: inc (r3)
+    {
+        a = r[3];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0d6a: mov r2, 2(r4)
+    {
+        src = r[2];
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 0d6e: mov r3, 8(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 0d72: mov 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d76: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0d78: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0d7a: add $6, r0
+    {
+        src = uint16_t(0x0006);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0d7e: mov r0, (r4)
+    {
+        src = r[0];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 0d80: cmp $ffff, a(r5)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[5] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d86: beq 0d96
+    if (Z)
+        AOT_GOTO(0x0d96, L0d96);
+    AOT_GOTO(0x0d88, L0d88);
+L0d88:
+    AOT_BLOCK(0x0d88, 4);
+    // 0d88: mov a(r5), r0
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d8c: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+        C = (src & 1) != 0;
+    }
+    // 0d8e: bic $8000, r0
+    {
+        src = uint16_t(0x8000);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0d92: mov r0, 6(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d96, L0d96);
+L0d96:
+    AOT_BLOCK(0x0d96, 4);
+    // 0d96: mov 4(r3), r0
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d9a: sub 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 0d9e: mov r0, 4(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0da2: bgt 0da8
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0da8, L0da8);
+    AOT_GOTO(0x0da4, L0da4);
+L0da4:
+    AOT_BLOCK(0x0da4, 1);
+    // 0da4: clr 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0da8, L0da8);
+L0da8:
+    AOT_BLOCK(0x0da8, 2);
+    // 0da8: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0dac:
+    AOT_BLOCK(0x0dac, 6);
+    // 0dac: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0db0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0db0: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0db4: dec 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0db8: tst 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0dbc: bge 0dd8
+    if (!(N ^ V))
+        AOT_GOTO(0x0dd8, L0dd8);
+    AOT_GOTO(0x0dbe, L0dbe);
+L0dbe:
+    AOT_BLOCK(0x0dbe, 6);
+    // 0dbe: mov $ffff, (sp)
+    {
+        src = uint16_t(0xffff);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dc2: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0dc4: mov 2(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dc8: inc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0dca: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dcc: jsr pc, *$0cc2
+    {
+        a = 0x0cc2;
+        r[6] -= 2;
+        WR16(r[6], 0x0dd0);
+    }
+    AOT_GOTO(0x0cc2, L0cc2);
+L0dd0:
+    AOT_BLOCK(0x0dd0, 2);
+    // 0dd0: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0dd4: dec 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0dd8, L0dd8);
+L0dd8:
+    AOT_BLOCK(0x0dd8, 3);
+    // 0dd8: dec 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0ddc: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0de0: bgt 0e04
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0e04, L0e04);
+    AOT_GOTO(0x0de2, L0de2);
+L0de2:
+    AOT_BLOCK(0x0de2, 2);
+    // 0de2: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0de6: bge 0df6
+    if (!(N ^ V))
+        AOT_GOTO(0x0df6, L0df6);
+    AOT_GOTO(0x0de8, L0de8);
+L0de8:
+    AOT_BLOCK(0x0de8, 3);
+    // 0de8: mov $1644, (sp)
+    {
+        src = uint16_t(0x1644);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dec: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0df0: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x0df4);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L0df4:
+    AOT_BLOCK(0x0df4, 1);
+    // 0df4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0df6, L0df6);
+L0df6:
+    AOT_BLOCK(0x0df6, 3);
+    // 0df6: inc 1cb2
+    {
+        a = 0x1cb2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0dfa: dec *8(r4)
+    {
+        a = RD16(r[4] + 8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0dfe: mov $1cb2, 8(r4)
+    {
+        src = uint16_t(0x1cb2);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e04, L0e04);
+L0e04:
+    AOT_BLOCK(0x0e04, 3);
+    // 0e04: mov *0(r4), r0
+    {
+        a = RD16(r[4] + 0);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0e08: add $2, (r4)
+    {
+        src = uint16_t(0x0002);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0e0c: br 0e0e
+    AOT_GOTO(0x0e0e, L0e0e);
+L0e0e:
+    AOT_BLOCK(0x0e0e, 2);
+    // 0e0e: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0e12:
+    AOT_BLOCK(0x0e12, 6);
+    // 0e12: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0e16;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0e16: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0e1a: clrb 1cca
+    {
+        a = 0x1cca;
+        WR8(a, 0);
+    }
+    // 0e1e: cmpb $2d, (r4)
+    {
+        src = uint8_t(0x2d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0e22: bne 0e40
+    if (!Z)
+        AOT_GOTO(0x0e40, L0e40);
+    AOT_GOTO(0x0e24, L0e24);
+L0e24:
+    AOT_BLOCK(0x0e24, 2);
+    // 0e24: cmpb $6c, 1(r4)
+    {
+        src = uint8_t(0x6c);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0e2a: bne 0e40
+    if (!Z)
+        AOT_GOTO(0x0e40, L0e40);
+    AOT_GOTO(0x0e2c, L0e2c);
+L0e2c:
+    AOT_BLOCK(0x0e2c, 3);
+    // 0e2c: movb 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+    }
+    // 0e30: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e32: bne 0e38
+    if (!Z)
+        AOT_GOTO(0x0e38, L0e38);
+    AOT_GOTO(0x0e34, L0e34);
+L0e34:
+    AOT_BLOCK(0x0e34, 1);
+    // 0e34: mov $61, r3
+    {
+        src = uint16_t(0x0061);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e38, L0e38);
+L0e38:
+    AOT_BLOCK(0x0e38, 2);
+    // 0e38: mov $17d8, r4
+    {
+        src = uint16_t(0x17d8);
+        r[4] = src;
+    }
+    // 0e3c: movb r3, 8(r4)
+    {
+        src = uint8_t(r[3]);
+        b = uint16_t(r[4] + 8);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e40, L0e40);
+L0e40:
+    AOT_BLOCK(0x0e40, 4);
+    // 0e40: mov r4, 4060
+    {
+        src = r[4];
+        b = 0x4060;
+        WR16(b, src);
+    }
+    // 0e44: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0e46: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e48: jsr pc, *$13b6
+    {
+        a = 0x13b6;
+        r[6] -= 2;
+        WR16(r[6], 0x0e4c);
+    }
+    AOT_GOTO(0x13b6, L13b6);
+L0e4c:
+    AOT_BLOCK(0x0e4c, 3);
+    // 0e4c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0e4e: mov r0, 405e
+    {
+        src = r[0];
+        b = 0x405e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e52: bge 0e62
+    if (!(N ^ V))
+        AOT_GOTO(0x0e62, L0e62);
+    AOT_GOTO(0x0e54, L0e54);
+L0e54:
+    AOT_BLOCK(0x0e54, 3);
+    // 0e54: mov $17e4, (sp)
+    {
+        src = uint16_t(0x17e4);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e58: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e5c: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x0e60);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L0e60:
+    AOT_BLOCK(0x0e60, 1);
+    // 0e60: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0e62, L0e62);
+L0e62:
+    AOT_BLOCK(0x0e62, 15);
+    // 0e62: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+    }
+    // 0e66: mov r0, 1aae
+    {
+        src = r[0];
+        b = 0x1aae;
+        WR16(b, src);
+    }
+    // 0e6a: mov r0, 18a8
+    {
+        src = r[0];
+        b = 0x18a8;
+        WR16(b, src);
+    }
+    // 0e6e: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0e70: mov r0, 1aac
+    {
+        src = r[0];
+        b = 0x1aac;
+        WR16(b, src);
+    }
+    // 0e74: mov r0, 18a6
+    {
+        src = r[0];
+        b = 0x18a6;
+        WR16(b, src);
+    }
+    // 0e78: mov $1cb2, r0
+    {
+        src = uint16_t(0x1cb2);
+        r[0] = src;
+    }
+    // 0e7c: mov r0, 1cc8
+    {
+        src = r[0];
+        b = 0x1cc8;
+        WR16(b, src);
+    }
+    // 0e80: mov r0, 1cbe
+    {
+        src = r[0];
+        b = 0x1cbe;
+        WR16(b, src);
+    }
+    // 0e84: mov $2, 1cb2
+    {
+        src = uint16_t(0x0002);
+        b = 0x1cb2;
+        WR16(b, src);
+    }
+    // 0e8a: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e8e: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 0e90: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0e92: mov $1cb6, -(sp)
+    {
+        src = uint16_t(0x1cb6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e96: jsr pc, *$0cc2
+    {
+        a = 0x0cc2;
+        r[6] -= 2;
+        WR16(r[6], 0x0e9a);
+    }
+    AOT_GOTO(0x0cc2, L0cc2);
+L0e9a:
+    AOT_BLOCK(0x0e9a, 3);
+    // 0e9a: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0e9e: tst 1cbc
+    {
+        a = 0x1cbc;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ea2: bgt 0eb2
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0eb2, L0eb2);
+    AOT_GOTO(0x0ea4, L0ea4);
+L0ea4:
+    AOT_BLOCK(0x0ea4, 3);
+    // 0ea4: mov $1644, (sp)
+    {
+        src = uint16_t(0x1644);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ea8: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0eac: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x0eb0);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L0eb0:
+    AOT_BLOCK(0x0eb0, 1);
+    // 0eb0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0eb2, L0eb2);
+L0eb2:
+    AOT_BLOCK(0x0eb2, 2);
+    // 0eb2: mov $1cb6, (sp)
+    {
+        src = uint16_t(0x1cb6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0eb6: jsr pc, *$0dac
+    {
+        a = 0x0dac;
+        r[6] -= 2;
+        WR16(r[6], 0x0eba);
+    }
+    AOT_GOTO(0x0dac, L0dac);
+L0eba:
+    AOT_BLOCK(0x0eba, 2);
+    // 0eba: cmp $ff6d, r0
+    {
+        src = uint16_t(0xff6d);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ebe: beq 0ec4
+    if (Z)
+        AOT_GOTO(0x0ec4, L0ec4);
+    AOT_GOTO(0x0ec0, L0ec0);
+L0ec0:
+    AOT_BLOCK(0x0ec0, 2);
+    // 0ec0: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0ec2: br 0ec8
+    AOT_GOTO(0x0ec8, L0ec8);
+L0ec4:
+    AOT_BLOCK(0x0ec4, 1);
+    // 0ec4: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ec8, L0ec8);
+L0ec8:
+    AOT_BLOCK(0x0ec8, 1);
+    // 0ec8: br 0eca
+    AOT_GOTO(0x0eca, L0eca);
+L0eca:
+    AOT_BLOCK(0x0eca, 2);
+    // 0eca: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ece:
+    AOT_BLOCK(0x0ece, 5);
+    // 0ece: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0ed2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0ed2: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 0ed4: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0ed8: mov $20ea, r3
+    {
+        src = uint16_t(0x20ea);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0edc, L0edc);
+L0edc:
+    AOT_BLOCK(0x0edc, 2);
+    // 0edc: cmp $20f2, r3
+    {
+        src = uint16_t(0x20f2);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ee0: blos 0ef2
+    if (C | Z)
+        AOT_GOTO(0x0ef2, L0ef2);
+    AOT_GOTO(0x0ee2, L0ee2);
+L0ee2:
+    AOT_BLOCK(0x0ee2, 6);
+    // 0ee2: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0ee6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0ee8: movb (r3)+, r1
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 0eea: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0eec: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ef0: br 0edc
+    AOT_GOTO(0x0edc, L0edc);
+L0ef2:
+    AOT_BLOCK(0x0ef2, 7);
+    // 0ef2: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0ef6: bic $8000, r1
+    {
+        src = uint16_t(0x8000);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+        N = (val & 0x8000) != 0;
+    }
+    // 0efa: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0efc: div $1f5, r0
+    {
+        src = int16_t(uint16_t(0x01f5));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0f00: mov r1, r4
+    {
+        src = r[1];
+        r[4] = src;
+    }
+    // 0f02: asl r4
+    {
+        src = r[4];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[4] = val;
+    }
+    // 0f04: add $3876, r4
+    {
+        src = uint16_t(0x3876);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0f08, L0f08);
+L0f08:
+    AOT_BLOCK(0x0f08, 2);
+    // 0f08: tst (r4)
+    {
+        a = r[4];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f0a: beq 0f30
+    if (Z)
+        AOT_GOTO(0x0f30, L0f30);
+    AOT_GOTO(0x0f0c, L0f0c);
+L0f0c:
+    AOT_BLOCK(0x0f0c, 2);
+    // 0f0c: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0f0e: mov $20ea, r3
+    {
+        src = uint16_t(0x20ea);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f12, L0f12);
+L0f12:
+    AOT_BLOCK(0x0f12, 2);
+    // 0f12: cmp $20f2, r3
+    {
+        src = uint16_t(0x20f2);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f16: blos 0f1e
+    if (C | Z)
+        AOT_GOTO(0x0f1e, L0f1e);
+    AOT_GOTO(0x0f18, L0f18);
+L0f18:
+    AOT_BLOCK(0x0f18, 2);
+    // 0f18: cmpb (r2)+, (r3)+
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0f1a: bne 0f20
+    if (!Z)
+        AOT_GOTO(0x0f20, L0f20);
+    AOT_GOTO(0x0f1c, L0f1c);
+L0f1c:
+    AOT_BLOCK(0x0f1c, 1);
+    // 0f1c: br 0f12
+    AOT_GOTO(0x0f12, L0f12);
+L0f1e:
+    AOT_BLOCK(0x0f1e, 1);
+    // 0f1e: br 0f30
+    AOT_GOTO(0x0f30, L0f30);
+L0f20:
+    AOT_BLOCK(0x0f20, 3);
+    // 0f20: add $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+    }
+    // 0f24: cmp $3c60, r4
+    {
+        src = uint16_t(0x3c60);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f28: bhi 0f2e
+    if (!(C | Z))
+        AOT_GOTO(0x0f2e, L0f2e);
+    AOT_GOTO(0x0f2a, L0f2a);
+L0f2a:
+    AOT_BLOCK(0x0f2a, 1);
+    // 0f2a: mov $3872, r4
+    {
+        src = uint16_t(0x3872);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f2e, L0f2e);
+L0f2e:
+    AOT_BLOCK(0x0f2e, 1);
+    // 0f2e: br 0f08
+    AOT_GOTO(0x0f08, L0f08);
+L0f30:
+    AOT_BLOCK(0x0f30, 2);
+    // 0f30: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f32: br 0f34
+    AOT_GOTO(0x0f34, L0f34);
+L0f34:
+    AOT_BLOCK(0x0f34, 2);
+    // 0f34: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0f38:
+    AOT_BLOCK(0x0f38, 5);
+    // 0f38: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0f3c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0f3c: mov $20ea, (sp)
+    {
+        src = uint16_t(0x20ea);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f40: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f44: jsr pc, *$10f8
+    {
+        a = 0x10f8;
+        r[6] -= 2;
+        WR16(r[6], 0x0f48);
+    }
+    AOT_GOTO(0x10f8, L10f8);
+L0f48:
+    AOT_BLOCK(0x0f48, 4);
+    // 0f48: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0f4a: movb $20, 20f2
+    {
+        src = uint8_t(0x20);
+        b = 0x20f2;
+        WR8(b, src);
+    }
+    // 0f50: clr 20f4
+    {
+        a = 0x20f4;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0f54: jsr pc, 0ece
+    {
+        a = 0x0ece;
+        r[6] -= 2;
+        WR16(r[6], 0x0f58);
+    }
+    AOT_GOTO(0x0ece, L0ece);
+L0f58:
+    AOT_BLOCK(0x0f58, 1);
+    // 0f58: br 0f5a
+    AOT_GOTO(0x0f5a, L0f5a);
+L0f5a:
+    AOT_BLOCK(0x0f5a, 2);
+    // 0f5a: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0f5e:
+    AOT_BLOCK(0x0f5e, 5);
+    // 0f5e: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0f62;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0f62: mov 165a, r4
+    {
+        a = 0x165a;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0f66: cmp $3872, r4
+    {
+        src = uint16_t(0x3872);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f6a: bhi 0f7a
+    if (!(C | Z))
+        AOT_GOTO(0x0f7a, L0f7a);
+    AOT_GOTO(0x0f6c, L0f6c);
+L0f6c:
+    AOT_BLOCK(0x0f6c, 3);
+    // 0f6c: mov $17f0, (sp)
+    {
+        src = uint16_t(0x17f0);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f70: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f74: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x0f78);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L0f78:
+    AOT_BLOCK(0x0f78, 1);
+    // 0f78: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0f7a, L0f7a);
+L0f7a:
+    AOT_BLOCK(0x0f7a, 3);
+    // 0f7a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f7c: mov $20ea, -(sp)
+    {
+        src = uint16_t(0x20ea);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f80: jsr pc, *$10f8
+    {
+        a = 0x10f8;
+        r[6] -= 2;
+        WR16(r[6], 0x0f84);
+    }
+    AOT_GOTO(0x10f8, L10f8);
+L0f84:
+    AOT_BLOCK(0x0f84, 6);
+    // 0f84: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0f86: movb 20f2, 8(r4)
+    {
+        a = 0x20f2;
+        src = RD8(a);
+        b = uint16_t(r[4] + 8);
+        WR8(b, src);
+    }
+    // 0f8c: mov 20f4, a(r4)
+    {
+        a = 0x20f4;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+    }
+    // 0f92: add $c, 165a
+    {
+        src = uint16_t(0x000c);
+        b = 0x165a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0f98: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f9a: br 0f9c
+    AOT_GOTO(0x0f9c, L0f9c);
+L0f9c:
+    AOT_BLOCK(0x0f9c, 2);
+    // 0f9c: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0fa0:
+    AOT_BLOCK(0x0fa0, 4);
+    // 0fa0: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0fa4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0fa4: movb 20f2, r0
+    {
+        a = 0x20f2;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0fa8: br 0fc6
+    AOT_GOTO(0x0fc6, L0fc6);
+L0faa:
+    AOT_BLOCK(0x0faa, 2);
+    // 0faa: add 4072, 20f4
+    {
+        a = 0x4072;
+        src = RD16(a);
+        b = 0x20f4;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0fb0: br 0fe4
+    AOT_GOTO(0x0fe4, L0fe4);
+L0fb2:
+    AOT_BLOCK(0x0fb2, 2);
+    // 0fb2: add 4074, 20f4
+    {
+        a = 0x4074;
+        src = RD16(a);
+        b = 0x20f4;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0fb8: br 0fe4
+    AOT_GOTO(0x0fe4, L0fe4);
+L0fba:
+    AOT_BLOCK(0x0fba, 2);
+    // 0fba: add 4076, 20f4
+    {
+        a = 0x4076;
+        src = RD16(a);
+        b = 0x20f4;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0fc0: br 0fe4
+    AOT_GOTO(0x0fe4, L0fe4);
+L0fc2:
+    AOT_BLOCK(0x0fc2, 1);
+    // 0fc2: br 0fe4
+    AOT_GOTO(0x0fe4, L0fe4);
+L0fc6:
+    AOT_BLOCK(0x0fc6, 2);
+    // 0fc6: mov $16c4, r1
+    {
+        src = uint16_t(0x16c4);
+        r[1] = src;
+    }
+    // 0fca: mov r0, 16d2
+    {
+        src = r[0];
+        b = 0x16d2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fce, L0fce);
+L0fce:
+    AOT_BLOCK(0x0fce, 2);
+    // 0fce: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0fd0: bne 0fce
+    if (!Z)
+        AOT_GOTO(0x0fce, L0fce);
+    AOT_GOTO(0x0fd2, L0fd2);
+L0fd2:
+    AOT_BLOCK(0x0fd2, 1);
+    // 0fd2: jmp *e(r1)
+    {
+        a = RD16(r[1] + 14);
+    }
+    AOT_JUMP(a);
+L0fd6:
+    AOT_BLOCK(0x0fd6, 2);
+    // 0fd6: bitb $20, 20f2
+    {
+        src = uint8_t(0x20);
+        b = 0x20f2;
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0fdc: beq 0fe4
+    if (Z)
+        AOT_GOTO(0x0fe4, L0fe4);
+    AOT_GOTO(0x0fde, L0fde);
+L0fde:
+    AOT_BLOCK(0x0fde, 1);
+    // 0fde: movb $21, 20f2
+    {
+        src = uint8_t(0x21);
+        b = 0x20f2;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fe4, L0fe4);
+L0fe4:
+    AOT_BLOCK(0x0fe4, 2);
+    // 0fe4: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0fe8:
+    AOT_BLOCK(0x0fe8, 4);
+    // 0fe8: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0fec;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0fec: tst 4060
+    {
+        a = 0x4060;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ff0: beq 101c
+    if (Z)
+        AOT_GOTO(0x101c, L101c);
+    AOT_GOTO(0x0ff2, L0ff2);
+L0ff2:
+    AOT_BLOCK(0x0ff2, 3);
+    // 0ff2: mov 4060, (sp)
+    {
+        a = 0x4060;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ff6: mov $1806, -(sp)
+    {
+        src = uint16_t(0x1806);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ffa: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x0ffe);
+    }
+    AOT_GOTO(0x1120, L1120);
+L0ffe:
+    AOT_BLOCK(0x0ffe, 3);
+    // 0ffe: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1000: tstb 1cca
+    {
+        a = 0x1cca;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1004: beq 1014
+    if (Z)
+        AOT_GOTO(0x1014, L1014);
+    AOT_GOTO(0x1006, L1006);
+L1006:
+    AOT_BLOCK(0x1006, 2);
+    // 1006: mov $1cca, (sp)
+    {
+        src = uint16_t(0x1cca);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 100a: mov $1809, -(sp)
+    {
+        src = uint16_t(0x1809);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x100e, L100e);
+L100e:
+    AOT_BLOCK(0x100e, 1);
+    // 100e: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x1012);
+    }
+    AOT_GOTO(0x1120, L1120);
+L1012:
+    AOT_BLOCK(0x1012, 1);
+    // 1012: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1014, L1014);
+L1014:
+    AOT_BLOCK(0x1014, 2);
+    // 1014: mov $1810, (sp)
+    {
+        src = uint16_t(0x1810);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1018: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x101c);
+    }
+    AOT_GOTO(0x1120, L1120);
+L101c:
+    AOT_BLOCK(0x101c, 3);
+    // 101c: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1020: mov $1813, -(sp)
+    {
+        src = uint16_t(0x1813);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1024: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x1028);
+    }
+    AOT_GOTO(0x1120, L1120);
+L1028:
+    AOT_BLOCK(0x1028, 3);
+    // 1028: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 102a: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 102e: beq 1034
+    if (Z)
+        AOT_GOTO(0x1034, L1034);
+    AOT_GOTO(0x1030, L1030);
+L1030:
+    AOT_BLOCK(0x1030, 1);
+    // 1030: jsr pc, 0b6a
+    {
+        a = 0x0b6a;
+        r[6] -= 2;
+        WR16(r[6], 0x1034);
+    }
+    AOT_GOTO(0x0b6a, L0b6a);
+L1034:
+    AOT_BLOCK(0x1034, 3);
+    // 1034: mov $2, 4078
+    {
+        src = uint16_t(0x0002);
+        b = 0x4078;
+        WR16(b, src);
+    }
+    // 103a: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1036:
+    // 1036: rti
+    AOT_INTERP(0x1036);
+L1038:
+    AOT_BLOCK(0x1038, 2);
+    // 1038: bit r0, *77(sp)
+    {
+        src = r[0];
+        b = RD16(r[6] + 119);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 103c: blt 1012
+    if (N ^ V)
+        AOT_GOTO(0x1012, L1012);
+    AOT_GOTO(0x103e, L103e);
+L103e:
+    AOT_BLOCK(0x103e, 7);
+    // 103e: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1042;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1042: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1046: mov 6(r5), r2
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 104a: ash $fffc, r2
+    {
+        src = uint16_t(0xfffc) & 077;
+        val16 = r[2];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 104e: bic $f000, r2
+    {
+        src = uint16_t(0xf000);
+        dst = r[2];
+        val = (~src) & dst;
+        r[2] = val;
+    }
+    // 1052: mov $3c60, r4
+    {
+        src = uint16_t(0x3c60);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1056, L1056);
+L1056:
+    AOT_BLOCK(0x1056, 2);
+    // 1056: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1058: blos 106a
+    if (C | Z)
+        AOT_GOTO(0x106a, L106a);
+    AOT_GOTO(0x105a, L105a);
+L105a:
+    AOT_BLOCK(0x105a, 2);
+    // 105a: cmp r2, (r4)
+    {
+        src = r[2];
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 105c: bne 1064
+    if (!Z)
+        AOT_GOTO(0x1064, L1064);
+    AOT_GOTO(0x105e, L105e);
+L105e:
+    AOT_BLOCK(0x105e, 2);
+    // 105e: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1062: br 1078
+    AOT_GOTO(0x1078, L1078);
+L1064:
+    AOT_BLOCK(0x1064, 2);
+    // 1064: add $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1068: br 1056
+    AOT_GOTO(0x1056, L1056);
+L106a:
+    AOT_BLOCK(0x106a, 3);
+    // 106a: mov $1817, (sp)
+    {
+        src = uint16_t(0x1817);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 106e: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1072: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x1076);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L1076:
+    AOT_BLOCK(0x1076, 1);
+    // 1076: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1078, L1078);
+L1078:
+    AOT_BLOCK(0x1078, 2);
+    // 1078: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L107c:
+    AOT_BLOCK(0x107c, 7);
+    // 107c: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1080;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1080: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1084: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1088: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 108c: mov $1cb6, -(sp)
+    {
+        src = uint16_t(0x1cb6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1090: jsr pc, *$0cc2
+    {
+        a = 0x0cc2;
+        r[6] -= 2;
+        WR16(r[6], 0x1094);
+    }
+    AOT_GOTO(0x0cc2, L0cc2);
+L1094:
+    AOT_BLOCK(0x1094, 4);
+    // 1094: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1098: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 109c: mov $1cda, -(sp)
+    {
+        src = uint16_t(0x1cda);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10a0: jsr pc, *$0c52
+    {
+        a = 0x0c52;
+        r[6] -= 2;
+        WR16(r[6], 0x10a4);
+    }
+    AOT_GOTO(0x0c52, L0c52);
+L10a4:
+    AOT_BLOCK(0x10a4, 3);
+    // 10a4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 10a6: cmp $107, 1cda
+    {
+        src = uint16_t(0x0107);
+        b = 0x1cda;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 10ac: beq 10bc
+    if (Z)
+        AOT_GOTO(0x10bc, L10bc);
+    AOT_GOTO(0x10ae, L10ae);
+L10ae:
+    AOT_BLOCK(0x10ae, 3);
+    // 10ae: mov $182a, (sp)
+    {
+        src = uint16_t(0x182a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10b2: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10b6: jsr pc, *$0fe8
+    {
+        a = 0x0fe8;
+        r[6] -= 2;
+        WR16(r[6], 0x10ba);
+    }
+    AOT_GOTO(0x0fe8, L0fe8);
+L10ba:
+    AOT_BLOCK(0x10ba, 1);
+    // 10ba: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x10bc, L10bc);
+L10bc:
+    AOT_BLOCK(0x10bc, 20);
+    // 10bc: mov 1cdc, r4
+    {
+        a = 0x1cdc;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 10c0: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 10c2: bic $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 10c6: mov r4, 1cdc
+    {
+        src = r[4];
+        b = 0x1cdc;
+        WR16(b, src);
+    }
+    // 10ca: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 10cc: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+    }
+    // 10ce: mov r0, 4074
+    {
+        src = r[0];
+        b = 0x4074;
+        WR16(b, src);
+    }
+    // 10d2: mov 1cde, r3
+    {
+        a = 0x1cde;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 10d6: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+    }
+    // 10d8: bic $1, r3
+    {
+        src = uint16_t(0x0001);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+    }
+    // 10dc: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 10de: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 10e0: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        C = val != 0;
+    }
+    // 10e2: mov r0, 4076
+    {
+        src = r[0];
+        b = 0x4076;
+        WR16(b, src);
+    }
+    // 10e6: mov 1ce0, r0
+    {
+        a = 0x1ce0;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 10ea: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 10ec: bic $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 10f0: mov r0, 1ce0
+    {
+        src = r[0];
+        b = 0x1ce0;
+        WR16(b, src);
+    }
+    // 10f4: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L10f8:
+    AOT_BLOCK(0x10f8, 6);
+    // 10f8: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x10fc;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 10fc: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1100: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1104: mov r3, r2
+    {
+        src = r[3];
+        r[2] = src;
+    }
+    // 1106: add $8, r2
+    {
+        src = uint16_t(0x0008);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x110a, L110a);
+L110a:
+    AOT_BLOCK(0x110a, 2);
+    // 110a: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 110c: beq 1114
+    if (Z)
+        AOT_GOTO(0x1114, L1114);
+    AOT_GOTO(0x110e, L110e);
+L110e:
+    AOT_BLOCK(0x110e, 2);
+    // 110e: cmp r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1110: blos 1114
+    if (C | Z)
+        AOT_GOTO(0x1114, L1114);
+    AOT_GOTO(0x1112, L1112);
+L1112:
+    AOT_BLOCK(0x1112, 1);
+    // 1112: br 110a
+    AOT_GOTO(0x110a, L110a);
+L1114:
+    AOT_BLOCK(0x1114, 2);
+    // 1114: cmp r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1116: blos 111c
+    if (C | Z)
+        AOT_GOTO(0x111c, L111c);
+    AOT_GOTO(0x1118, L1118);
+L1118:
+    AOT_BLOCK(0x1118, 2);
+    // 1118: clrb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 111a: br 1114
+    AOT_GOTO(0x1114, L1114);
+L111c:
+    AOT_BLOCK(0x111c, 2);
+    // 111c: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1120:
+    AOT_BLOCK(0x1120, 6);
+    // 1120: jsr r5, 161a
+    {
+        a = 0x161a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1124;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1124: sub $7e, sp
+    {
+        src = uint16_t(0x007e);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1128: mov 4(r5), 4a9e
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x4a9e;
+        WR16(b, src);
+    }
+    // 112e: mov r5, r4
+    {
+        src = r[5];
+        r[4] = src;
+    }
+    // 1130: add $6, r4
+    {
+        src = uint16_t(0x0006);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1134, L1134);
+L1134:
+    AOT_BLOCK(0x1134, 2);
+    // 1134: movb *4a9e, r0
+    {
+        a = RD16(0x4a9e);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1138: beq 114c
+    if (Z)
+        AOT_GOTO(0x114c, L114c);
+    AOT_GOTO(0x113a, L113a);
+L113a:
+    AOT_BLOCK(0x113a, 3);
+    // 113a: inc 4a9e
+    {
+        a = 0x4a9e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 113e: cmp r0, $25
+    {
+        src = r[0];
+        dst = uint16_t(0x0025);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1142: beq 1150
+    if (Z)
+        AOT_GOTO(0x1150, L1150);
+    AOT_GOTO(0x1144, L1144);
+L1144:
+    AOT_BLOCK(0x1144, 2);
+    // 1144: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1146: jsr pc, *$12d2
+    {
+        a = 0x12d2;
+        r[6] -= 2;
+        WR16(r[6], 0x114a);
+    }
+    AOT_GOTO(0x12d2, L12d2);
+L114a:
+    AOT_BLOCK(0x114a, 1);
+    // 114a: br 1134
+    AOT_GOTO(0x1134, L1134);
+L114c:
+    AOT_BLOCK(0x114c, 2);
+    // 114c: jmp 1628
+    {
+        a = 0x1628;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1150:
+    AOT_BLOCK(0x1150, 4);
+    // 1150: clr 4aa0
+    {
+        a = 0x4aa0;
+        WR16(a, 0);
+    }
+    // 1154: clr 4aa4
+    {
+        a = 0x4aa4;
+        WR16(a, 0);
+    }
+    // 1158: cmpb *4a9e, $2d
+    {
+        a = RD16(0x4a9e);
+        src = RD8(a);
+        dst = uint8_t(0x2d);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 115e: bne 1168
+    if (!Z)
+        AOT_GOTO(0x1168, L1168);
+    AOT_GOTO(0x1160, L1160);
+L1160:
+    AOT_BLOCK(0x1160, 2);
+    // 1160: inc 4a9e
+    {
+        a = 0x4a9e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1164: inc 4aa0
+    {
+        a = 0x4aa0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1168, L1168);
+L1168:
+    AOT_BLOCK(0x1168, 1);
+    // 1168: jsr r3, 1294
+    {
+        a = 0x1294;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x116c;
+    }
+    AOT_GOTO(0x1294, L1294);
+L116c:
+    AOT_BLOCK(0x116c, 4);
+    // 116c: mov r1, 4a9c
+    {
+        src = r[1];
+        b = 0x4a9c;
+        WR16(b, src);
+    }
+    // 1170: clr 4aa2
+    {
+        a = 0x4aa2;
+        WR16(a, 0);
+    }
+    // 1174: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1178: bne 1182
+    if (!Z)
+        AOT_GOTO(0x1182, L1182);
+    AOT_GOTO(0x117a, L117a);
+L117a:
+    AOT_BLOCK(0x117a, 1);
+    // 117a: jsr r3, 1294
+    {
+        a = 0x1294;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x117e;
+    }
+    AOT_GOTO(0x1294, L1294);
+L117e:
+    AOT_BLOCK(0x117e, 1);
+    // 117e: mov r1, 4aa4
+    {
+        src = r[1];
+        b = 0x4aa4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1182, L1182);
+L1182:
+    AOT_BLOCK(0x1182, 3);
+    // 1182: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 1184: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1188: mov $1836, r1
+    {
+        src = uint16_t(0x1836);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x118c, L118c);
+L118c:
+    AOT_BLOCK(0x118c, 2);
+    // 118c: mov (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 118e: beq 1144
+    if (Z)
+        AOT_GOTO(0x1144, L1144);
+    AOT_GOTO(0x1190, L1190);
+L1190:
+    AOT_BLOCK(0x1190, 2);
+    // 1190: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1192: bne 118c
+    if (!Z)
+        AOT_GOTO(0x118c, L118c);
+    AOT_GOTO(0x1194, L1194);
+L1194:
+    AOT_BLOCK(0x1194, 1);
+    // 1194: jmp (r2)
+    {
+        a = r[2];
+    }
+    AOT_JUMP(a);
+L1196:
+    AOT_BLOCK(0x1196, 2);
+    // 1196: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1198: bge 11a4
+    if (!(N ^ V))
+        AOT_GOTO(0x11a4, L11a4);
+    AOT_GOTO(0x119a, L119a);
+L119a:
+    AOT_BLOCK(0x119a, 3);
+    // 119a: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 119c: movb $2d, (r3)+
+    {
+        src = uint8_t(0x2d);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 11a0: br 11a4
+    AOT_GOTO(0x11a4, L11a4);
+L11a2:
+    AOT_BLOCK(0x11a2, 1);
+    // 11a2: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x11a4, L11a4);
+L11a4:
+    AOT_BLOCK(0x11a4, 1);
+    // 11a4: jsr pc, 11aa
+    {
+        a = 0x11aa;
+        r[6] -= 2;
+        WR16(r[6], 0x11a8);
+    }
+    AOT_GOTO(0x11aa, L11aa);
+L11a8:
+    AOT_BLOCK(0x11a8, 1);
+    // 11a8: br 124e
+    AOT_GOTO(0x124e, L124e);
+L11aa:
+    AOT_BLOCK(0x11aa, 5);
+    // 11aa: clr r0
+    {
+        r[0] = 0;
+    }
+    // 11ac: div $a, r0
+    {
+        src = int16_t(uint16_t(0x000a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 11b0: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 11b2: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11b4: beq 11ba
+    if (Z)
+        AOT_GOTO(0x11ba, L11ba);
+    AOT_GOTO(0x11b6, L11b6);
+L11b6:
+    AOT_BLOCK(0x11b6, 1);
+    // 11b6: jsr pc, 11aa
+    {
+        a = 0x11aa;
+        r[6] -= 2;
+        WR16(r[6], 0x11ba);
+    }
+    AOT_GOTO(0x11aa, L11aa);
+L11ba:
+    AOT_BLOCK(0x11ba, 4);
+    // 11ba: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11bc: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 11c0: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 11c2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L11c4:
+    AOT_BLOCK(0x11c4, 2);
+    // 11c4: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 11c6: bne 11ca
+    if (!Z)
+        AOT_GOTO(0x11ca, L11ca);
+    AOT_GOTO(0x11c8, L11c8);
+L11c8:
+    AOT_BLOCK(0x11c8, 1);
+    // 11c8: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x11ca, L11ca);
+L11ca:
+    AOT_BLOCK(0x11ca, 2);
+    // 11ca: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 11cc: bne 124e
+    if (!Z)
+        AOT_GOTO(0x124e, L124e);
+    AOT_GOTO(0x11ce, L11ce);
+L11ce:
+    AOT_BLOCK(0x11ce, 2);
+    // 11ce: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 11d0: br 124e
+    AOT_GOTO(0x124e, L124e);
+L11d2:
+    AOT_BLOCK(0x11d2, 3);
+    // 11d2: mov 4aa4, r1
+    {
+        a = 0x4aa4;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 11d6: clr r3
+    {
+        r[3] = 0;
+        C = false;
+    }
+    // 11d8: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x11da, L11da);
+L11da:
+    AOT_BLOCK(0x11da, 2);
+    // 11da: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 11dc: beq 11e2
+    if (Z)
+        AOT_GOTO(0x11e2, L11e2);
+    AOT_GOTO(0x11de, L11de);
+L11de:
+    AOT_BLOCK(0x11de, 2);
+    // 11de: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 11e0: sob r1, 4
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x11da, L11da);
+    AOT_GOTO(0x11e2, L11e2);
+L11e2:
+    AOT_BLOCK(0x11e2, 2);
+    // 11e2: mov (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11e4: br 1256
+    AOT_GOTO(0x1256, L1256);
+L11e6:
+    AOT_BLOCK(0x11e6, 2);
+    // 11e6: mov $185e, r2
+    {
+        src = uint16_t(0x185e);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11ea: br 11f0
+    AOT_GOTO(0x11f0, L11f0);
+L11ec:
+    AOT_BLOCK(0x11ec, 1);
+    // 11ec: mov $1862, r2
+    {
+        src = uint16_t(0x1862);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x11f0, L11f0);
+L11f0:
+    AOT_BLOCK(0x11f0, 2);
+    // 11f0: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11f2: beq 11fe
+    if (Z)
+        AOT_GOTO(0x11fe, L11fe);
+    AOT_GOTO(0x11f4, L11f4);
+L11f4:
+    AOT_BLOCK(0x11f4, 2);
+    // 11f4: tst 4aa4
+    {
+        a = 0x4aa4;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 11f8: beq 11fe
+    if (Z)
+        AOT_GOTO(0x11fe, L11fe);
+    AOT_GOTO(0x11fa, L11fa);
+L11fa:
+    AOT_BLOCK(0x11fa, 1);
+    // 11fa: movb $30, (r3)+
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x11fe, L11fe);
+L11fe:
+    AOT_BLOCK(0x11fe, 2);
+    // 11fe: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1200: jsr pc, 1206
+    {
+        a = 0x1206;
+        r[6] -= 2;
+        WR16(r[6], 0x1204);
+    }
+    AOT_GOTO(0x1206, L1206);
+L1204:
+    AOT_BLOCK(0x1204, 1);
+    // 1204: br 124e
+    AOT_GOTO(0x124e, L124e);
+L1206:
+    AOT_BLOCK(0x1206, 3);
+    // 1206: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1208: ashc (r2), r0
+    {
+        a = r[2];
+        src = RD16(a) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 120a: beq 1210
+    if (Z)
+        AOT_GOTO(0x1210, L1210);
+    AOT_GOTO(0x120c, L120c);
+L120c:
+    AOT_BLOCK(0x120c, 1);
+    // 120c: jsr pc, 1206
+    {
+        a = 0x1206;
+        r[6] -= 2;
+        WR16(r[6], 0x1210);
+    }
+    AOT_GOTO(0x1206, L1206);
+L1210:
+    AOT_BLOCK(0x1210, 5);
+    // 1210: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1212: bic 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1216: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 121a: cmp r0, $39
+    {
+        src = r[0];
+        dst = uint16_t(0x0039);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 121e: ble 1224
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1224, L1224);
+    AOT_GOTO(0x1220, L1220);
+L1220:
+    AOT_BLOCK(0x1220, 1);
+    // 1220: add $7, r0
+    {
+        src = uint16_t(0x0007);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1224, L1224);
+L1224:
+    AOT_BLOCK(0x1224, 1);
+    // 1224: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1226, L1226);
+L1226:
+    AOT_BLOCK(0x1226, 1);
+    // 1226: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1228:
+    AOT_BLOCK(0x1228, 3);
+    // 1228: mov 4aa4, r0
+    {
+        a = 0x4aa4;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 122c: mov 4aa2, r2
+    {
+        a = 0x4aa2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1230: jsr pc, 12c8
+    {
+        a = 0x12c8;
+        r[6] -= 2;
+        WR16(r[6], 0x1234);
+    }
+    AOT_GOTO(0x12c8, L12c8);
+L1234:
+    AOT_BLOCK(0x1234, 1);
+    // 1234: br 124e
+    AOT_GOTO(0x124e, L124e);
+L1236:
+    AOT_BLOCK(0x1236, 3);
+    // 1236: mov 4aa4, r0
+    {
+        a = 0x4aa4;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 123a: mov 4aa2, r2
+    {
+        a = 0x4aa2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 123e: jsr pc, 12c8
+    {
+        a = 0x12c8;
+        r[6] -= 2;
+        WR16(r[6], 0x1242);
+    }
+    AOT_GOTO(0x12c8, L12c8);
+L1242:
+    AOT_BLOCK(0x1242, 1);
+    // 1242: br 124e
+    AOT_GOTO(0x124e, L124e);
+L1244:
+    AOT_BLOCK(0x1244, 3);
+    // 1244: mov (r4)+, r4
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1246: mov (r4)+, 4a9e
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = 0x4a9e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 124a: jmp 1134
+    {
+        a = 0x1134;
+    }
+    AOT_GOTO(0x1134, L1134);
+L124e:
+    AOT_BLOCK(0x124e, 3);
+    // 124e: mov sp, r2
+    {
+        src = r[6];
+        r[2] = src;
+    }
+    // 1250: add $4, r2
+    {
+        src = uint16_t(0x0004);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 1254: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1256, L1256);
+L1256:
+    AOT_BLOCK(0x1256, 6);
+    // 1256: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1258: mov $20, -(sp)
+    {
+        src = uint16_t(0x0020);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 125c: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+    }
+    // 125e: neg r3
+    {
+        val = -int16_t(r[3]);
+        r[3] = val;
+    }
+    // 1260: add 4a9c, r3
+    {
+        a = 0x4a9c;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1264: ble 1272
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1272, L1272);
+    AOT_GOTO(0x1266, L1266);
+L1266:
+    AOT_BLOCK(0x1266, 2);
+    // 1266: tst 4aa0
+    {
+        a = 0x4aa0;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 126a: bne 1272
+    if (!Z)
+        AOT_GOTO(0x1272, L1272);
+    AOT_GOTO(0x126c, L126c);
+L126c:
+    AOT_BLOCK(0x126c, 1);
+    // 126c: jsr pc, *$12d2
+    {
+        a = 0x12d2;
+        r[6] -= 2;
+        WR16(r[6], 0x1270);
+    }
+    AOT_GOTO(0x12d2, L12d2);
+L1270:
+    AOT_BLOCK(0x1270, 1);
+    // 1270: sob r3, 3
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x126c, L126c);
+    AOT_GOTO(0x1272, L1272);
+L1272:
+    AOT_BLOCK(0x1272, 2);
+    // 1272: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1274: beq 127e
+    if (Z)
+        AOT_GOTO(0x127e, L127e);
+    AOT_GOTO(0x1276, L1276);
+L1276:
+    AOT_BLOCK(0x1276, 2);
+    // 1276: movb (r2)+, (sp)
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[6];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1278: jsr pc, *$12d2
+    {
+        a = 0x12d2;
+        r[6] -= 2;
+        WR16(r[6], 0x127c);
+    }
+    AOT_GOTO(0x12d2, L12d2);
+L127c:
+    AOT_BLOCK(0x127c, 1);
+    // 127c: sob r4, 4
+    {
+        r[4]--;
+    }
+    if (r[4] != 0)
+        AOT_GOTO(0x1276, L1276);
+    AOT_GOTO(0x127e, L127e);
+L127e:
+    AOT_BLOCK(0x127e, 2);
+    // 127e: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1280: ble 128c
+    if (Z || (N ^ V))
+        AOT_GOTO(0x128c, L128c);
+    AOT_GOTO(0x1282, L1282);
+L1282:
+    AOT_BLOCK(0x1282, 1);
+    // 1282: mov $20, (sp)
+    {
+        src = uint16_t(0x0020);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1286, L1286);
+L1286:
+    AOT_BLOCK(0x1286, 1);
+    // 1286: jsr pc, *$12d2
+    {
+        a = 0x12d2;
+        r[6] -= 2;
+        WR16(r[6], 0x128a);
+    }
+    AOT_GOTO(0x12d2, L12d2);
+L128a:
+    AOT_BLOCK(0x128a, 1);
+    // 128a: sob r3, 3
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x1286, L1286);
+    AOT_GOTO(0x128c, L128c);
+L128c:
+    AOT_BLOCK(0x128c, 3);
+    // 128c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 128e: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1290: jmp 1134
+    {
+        a = 0x1134;
+    }
+    AOT_GOTO(0x1134, L1134);
+L1294:
+    AOT_BLOCK(0x1294, 2);
+    // 1294: clr 4aa2
+    {
+        a = 0x4aa2;
+        WR16(a, 0);
+    }
+    // 1298: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x129a, L129a);
+L129a:
+    AOT_BLOCK(0x129a, 5);
+    // 129a: movb *4a9e, r0
+    {
+        a = RD16(0x4a9e);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 129e: inc 4a9e
+    {
+        a = 0x4a9e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 12a2: sub $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 12a6: cmp r0, $fffa
+    {
+        src = r[0];
+        dst = uint16_t(0xfffa);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12aa: bne 12b0
+    if (!Z)
+        AOT_GOTO(0x12b0, L12b0);
+    AOT_GOTO(0x12ac, L12ac);
+L12ac:
+    AOT_BLOCK(0x12ac, 2);
+    // 12ac: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12ae: br 12b6
+    AOT_GOTO(0x12b6, L12b6);
+L12b0:
+    AOT_BLOCK(0x12b0, 2);
+    // 12b0: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12b4: bhi 12c2
+    if (!(C | Z))
+        AOT_GOTO(0x12c2, L12c2);
+    AOT_GOTO(0x12b6, L12b6);
+L12b6:
+    AOT_BLOCK(0x12b6, 2);
+    // 12b6: inc 4aa2
+    {
+        a = 0x4aa2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 12ba: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val < -0x8000 || val >= 0x8000;
+        V = false;
+    }
+    AOT_GOTO(0x12be, L12be);
+L12bc:
+    // 12bc: (undefined)
+    AOT_INTERP(0x12bc);
+L12be:
+    AOT_BLOCK(0x12be, 2);
+    // 12be: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 12c0: br 129a
+    AOT_GOTO(0x129a, L129a);
+L12c2:
+    AOT_BLOCK(0x12c2, 2);
+    // 12c2: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 12c6: rts r3
+    {
+        b = r[3];
+        r[3] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12c8:
+    AOT_BLOCK(0x12c8, 3);
+    // 12c8: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 12cc: movb $3f, (r3)+
+    {
+        src = uint8_t(0x3f);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 12d0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12d2:
+    AOT_BLOCK(0x12d2, 3);
+    // 12d2: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 12d4: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 12d6: mov 4aaa, r0
+    {
+        a = 0x4aaa;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x12da, L12da);
+L12da:
+    AOT_BLOCK(0x12da, 1);
+    // 12da: bne 12e4
+    if (!Z)
+        AOT_GOTO(0x12e4, L12e4);
+    AOT_GOTO(0x12dc, L12dc);
+L12dc:
+    AOT_BLOCK(0x12dc, 1);
+    // 12dc: jsr pc, 130c
+    {
+        a = 0x130c;
+        r[6] -= 2;
+        WR16(r[6], 0x12e0);
+    }
+    AOT_GOTO(0x130c, L130c);
+L12e0:
+    AOT_BLOCK(0x12e0, 1);
+    // 12e0: mov 4aaa, r0
+    {
+        a = 0x4aaa;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x12e4, L12e4);
+L12e4:
+    AOT_BLOCK(0x12e4, 2);
+    // 12e4: movb 4(r5), (r0)+
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = r[0];
+        r[0] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 12e8: beq 12f8
+    if (Z)
+        AOT_GOTO(0x12f8, L12f8);
+    AOT_GOTO(0x12ea, L12ea);
+L12ea:
+    AOT_BLOCK(0x12ea, 3);
+    // 12ea: inc 4aaa
+    {
+        a = 0x4aaa;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 12ee: dec 4aa8
+    {
+        a = 0x4aa8;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 12f2: bgt 12f8
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x12f8, L12f8);
+    AOT_GOTO(0x12f4, L12f4);
+L12f4:
+    AOT_BLOCK(0x12f4, 1);
+    // 12f4: jsr pc, 130c
+    {
+        a = 0x130c;
+        r[6] -= 2;
+        WR16(r[6], 0x12f8);
+    }
+    AOT_GOTO(0x130c, L130c);
+L12f8:
+    AOT_BLOCK(0x12f8, 1);
+    // 12f8: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x12fc, L12fc);
+L12fa:
+    // 12fa: iot
+    AOT_INTERP(0x12fa);
+L12fc:
+    AOT_BLOCK(0x12fc, 2);
+    // 12fc: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12fe: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L130c:
+    AOT_BLOCK(0x130c, 1);
+    // 130c: mov 4aaa, r0
+    {
+        a = 0x4aaa;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1310, L1310);
+L1310:
+    AOT_BLOCK(0x1310, 1);
+    // 1310: beq 1326
+    if (Z)
+        AOT_GOTO(0x1326, L1326);
+    AOT_GOTO(0x1312, L1312);
+L1312:
+    AOT_BLOCK(0x1312, 4);
+    // 1312: sub $4aac, r0
+    {
+        src = uint16_t(0x4aac);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 1316: mov r0, 186a
+    {
+        src = r[0];
+        b = 0x186a;
+        WR16(b, src);
+    }
+    // 131a: mov 4aa6, r0
+    {
+        a = 0x4aa6;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 131e: bne 1322
+    if (!Z)
+        AOT_GOTO(0x1322, L1322);
+    AOT_GOTO(0x1320, L1320);
+L1320:
+    AOT_BLOCK(0x1320, 1);
+    // 1320: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1322, L1322);
+L1322:
+    // 1322: sys 0
+    AOT_INTERP(0x1322);
+L1324:
+    AOT_BLOCK(0x1324, 1);
+    // 1324: mov -(r1), -(sp)
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1326, L1326);
+L1326:
+    AOT_BLOCK(0x1326, 1);
+    // 1326: mov $4aac, 4aaa
+    {
+        src = uint16_t(0x4aac);
+        b = 0x4aaa;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x132c, L132c);
+L1328:
+    AOT_BLOCK(0x1328, 1);
+    // 1328: bic *-(r2), *-(r4)
+    {
+        r[2] -= 2;
+        a = RD16(r[2]);
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x132a, L132a);
+L132a:
+    AOT_BLOCK(0x132a, 2);
+    // 132a: bit *(r5)+, *15f7(sp)
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        b = RD16(r[6] + 5623);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 132e: bne 1330
+    if (!Z)
+        AOT_GOTO(0x1330, L1330);
+    AOT_GOTO(0x1330, L1330);
+L132c:
+    AOT_BLOCK(0x132c, 3);
+    // 132c: mov $200, 4aa8
+    {
+        src = uint16_t(0x0200);
+        b = 0x4aa8;
+        WR16(b, src);
+    }
+    // 1332: cmp 4aa6, $2
+    {
+        a = 0x4aa6;
+        src = RD16(a);
+        dst = uint16_t(0x0002);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1338: bhi 1340
+    if (!(C | Z))
+        AOT_GOTO(0x1340, L1340);
+    AOT_GOTO(0x133a, L133a);
+L1330:
+    AOT_BLOCK(0x1330, 3);
+    // 1330: bit *(r5)+, 2dd7(sp)
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        b = uint16_t(r[6] + 11735);
+        dst = RD16(b);
+        val = src & dst;
+    }
+    // 1334: bit *(r5)+, 2(r0)
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1338: bhi 1340
+    if (!(C | Z))
+        AOT_GOTO(0x1340, L1340);
+    AOT_GOTO(0x133a, L133a);
+L133a:
+    AOT_BLOCK(0x133a, 1);
+    // 133a: mov $1, 4aa8
+    {
+        src = uint16_t(0x0001);
+        b = 0x4aa8;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1340, L1340);
+L1340:
+    AOT_BLOCK(0x1340, 1);
+    // 1340: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1342:
+    AOT_BLOCK(0x1342, 4);
+    // 1342: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1344: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1346: mov 4(r5), 186e
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x186e;
+        WR16(b, src);
+    }
+    // 134c: mov 6(r5), 1870
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x1870;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1352: sys 0
+    AOT_INTERP(0x1352);
+L1354:
+    AOT_BLOCK(0x1354, 1);
+    // 1354: mov -(r1), *-(r4)
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1356, L1356);
+L1356:
+    AOT_BLOCK(0x1356, 1);
+    // 1356: bcc 135c
+    if (!C)
+        AOT_GOTO(0x135c, L135c);
+    AOT_GOTO(0x1358, L1358);
+L1358:
+    AOT_BLOCK(0x1358, 1);
+    // 1358: jmp 1636
+    {
+        a = 0x1636;
+    }
+    AOT_GOTO(0x1636, L1636);
+L135a:
+    AOT_BLOCK(0x135a, 1);
+    // 135a: bne 1310
+    if (!Z)
+        AOT_GOTO(0x1310, L1310);
+    AOT_GOTO(0x135c, L135c);
+L135c:
+    AOT_BLOCK(0x135c, 3);
+    // 135c: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 135e: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1360: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1362:
+    AOT_BLOCK(0x1362, 3);
+    // 1362: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1364: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1366: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 136a: sys 6
+    AOT_INTERP(0x136a);
+L136c:
+    AOT_BLOCK(0x136c, 1);
+    // 136c: bcc 1372
+    if (!C)
+        AOT_GOTO(0x1372, L1372);
+    AOT_GOTO(0x136e, L136e);
+L136e:
+    AOT_BLOCK(0x136e, 1);
+    // 136e: jmp 1636
+    {
+        a = 0x1636;
+    }
+    AOT_GOTO(0x1636, L1636);
+L1370:
+    AOT_BLOCK(0x1370, 1);
+    // 1370: bne 12fa
+    if (!Z)
+        AOT_GOTO(0x12fa, L12fa);
+    AOT_GOTO(0x1372, L1372);
+L1372:
+    AOT_BLOCK(0x1372, 1);
+    // 1372: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1374, L1374);
+L1374:
+    AOT_BLOCK(0x1374, 2);
+    // 1374: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1376: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1378:
+    AOT_BLOCK(0x1378, 4);
+    // 1378: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 137a: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 137c: mov 4(r5), 1874
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x1874;
+        WR16(b, src);
+    }
+    // 1382: mov 6(r5), 1876
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x1876;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1388: sys 0
+    AOT_INTERP(0x1388);
+L138a:
+    AOT_BLOCK(0x138a, 1);
+    // 138a: mov -(r1), -79fe(r2)
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = RD16(a);
+        b = uint16_t(r[2] + -31230);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x138e, L138e);
+L138c:
+    AOT_BLOCK(0x138c, 1);
+    // 138c: bcc 1392
+    if (!C)
+        AOT_GOTO(0x1392, L1392);
+    AOT_GOTO(0x138e, L138e);
+L138e:
+    AOT_BLOCK(0x138e, 1);
+    // 138e: jmp 1636
+    {
+        a = 0x1636;
+    }
+    AOT_GOTO(0x1636, L1636);
+L1390:
+    AOT_BLOCK(0x1390, 1);
+    // 1390: bne 12da
+    if (!Z)
+        AOT_GOTO(0x12da, L12da);
+    AOT_GOTO(0x1392, L1392);
+L1392:
+    AOT_BLOCK(0x1392, 2);
+    // 1392: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1394: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1396:
+    AOT_BLOCK(0x1396, 4);
+    // 1396: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1398: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 139a: mov 4(r5), 187a
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x187a;
+        WR16(b, src);
+    }
+    // 13a0: mov 6(r5), 187c
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x187c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13a6: sys 0
+    AOT_INTERP(0x13a6);
+L13a8:
+    AOT_BLOCK(0x13a8, 1);
+    // 13a8: mov -(r1), *-79fe(r0)
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = RD16(a);
+        b = RD16(r[0] + -31230);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x13ac, L13ac);
+L13aa:
+    AOT_BLOCK(0x13aa, 1);
+    // 13aa: bcc 13b0
+    if (!C)
+        AOT_GOTO(0x13b0, L13b0);
+    AOT_GOTO(0x13ac, L13ac);
+L13ac:
+    AOT_BLOCK(0x13ac, 1);
+    // 13ac: jmp 1636
+    {
+        a = 0x1636;
+    }
+    AOT_GOTO(0x1636, L1636);
+L13ae:
+    AOT_BLOCK(0x13ae, 1);
+    // 13ae: bne 12bc
+    if (!Z)
+        AOT_GOTO(0x12bc, L12bc);
+    AOT_GOTO(0x13b0, L13b0);
+L13b0:
+    AOT_BLOCK(0x13b0, 3);
+    // 13b0: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 13b2: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13b4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13b6:
+    AOT_BLOCK(0x13b6, 4);
+    // 13b6: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13b8: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 13ba: mov 4(r5), 1880
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x1880;
+        WR16(b, src);
+    }
+    // 13c0: mov 6(r5), 1882
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x1882;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13c6: sys 0
+    AOT_INTERP(0x13c6);
+L13c8:
+    AOT_BLOCK(0x13c8, 1);
+    // 13c8: mov -(r1), *-79fe(sp)
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = RD16(a);
+        b = RD16(r[6] + -31230);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x13cc, L13cc);
+L13ca:
+    AOT_BLOCK(0x13ca, 1);
+    // 13ca: bcc 13d0
+    if (!C)
+        AOT_GOTO(0x13d0, L13d0);
+    AOT_GOTO(0x13cc, L13cc);
+L13cc:
+    AOT_BLOCK(0x13cc, 1);
+    // 13cc: jmp 1636
+    {
+        a = 0x1636;
+    }
+    AOT_GOTO(0x1636, L1636);
+L13ce:
+    AOT_BLOCK(0x13ce, 1);
+    // 13ce: bne 149c
+    if (!Z)
+        AOT_GOTO(0x149c, L149c);
+    AOT_GOTO(0x13d0, L13d0);
+L13d0:
+    AOT_BLOCK(0x13d0, 2);
+    // 13d0: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13d2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13f2:
+    AOT_BLOCK(0x13f2, 5);
+    // 13f2: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13f4: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 13f6: mov 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 13fa: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 13fe: bge 1408
+    if (!(N ^ V))
+        AOT_GOTO(0x1408, L1408);
+    AOT_GOTO(0x1400, L1400);
+L1400:
+    AOT_BLOCK(0x1400, 1);
+    // 1400: jsr pc, 1462
+    {
+        a = 0x1462;
+        r[6] -= 2;
+        WR16(r[6], 0x1404);
+    }
+    AOT_GOTO(0x1462, L1462);
+L1404:
+    AOT_BLOCK(0x1404, 1);
+    // 1404: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x1408, L1408);
+L1408:
+    AOT_BLOCK(0x1408, 4);
+    // 1408: movb 4(r5), *4(r1)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = RD16(r[1] + 4);
+        WR8(b, src);
+    }
+    // 140e: inc 4(r1)
+    {
+        a = uint16_t(r[1] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1412: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1416: bge 1420
+    if (!(N ^ V))
+        AOT_GOTO(0x1420, L1420);
+    AOT_GOTO(0x1418, L1418);
+L1418:
+    AOT_BLOCK(0x1418, 1);
+    // 1418: jsr pc, 1462
+    {
+        a = 0x1462;
+        r[6] -= 2;
+        WR16(r[6], 0x141c);
+    }
+    AOT_GOTO(0x1462, L1462);
+L141c:
+    AOT_BLOCK(0x141c, 1);
+    // 141c: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x1420, L1420);
+L1420:
+    AOT_BLOCK(0x1420, 4);
+    // 1420: movb 5(r5), *4(r1)
+    {
+        a = uint16_t(r[5] + 5);
+        src = RD8(a);
+        b = RD16(r[1] + 4);
+        WR8(b, src);
+    }
+    // 1426: inc 4(r1)
+    {
+        a = uint16_t(r[1] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 142a: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 142e: br 1490
+    AOT_GOTO(0x1490, L1490);
+L1454:
+    AOT_BLOCK(0x1454, 4);
+    // 1454: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1456: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1458: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 145c: jsr pc, 1462
+    {
+        a = 0x1462;
+        r[6] -= 2;
+        WR16(r[6], 0x1460);
+    }
+    AOT_GOTO(0x1462, L1462);
+L1460:
+    AOT_BLOCK(0x1460, 1);
+    // 1460: br 1490
+    AOT_GOTO(0x1490, L1490);
+L1462:
+    AOT_BLOCK(0x1462, 6);
+    // 1462: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 1464: add $6, r0
+    {
+        src = uint16_t(0x0006);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1468: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 146a: mov r0, 188c
+    {
+        src = r[0];
+        b = 0x188c;
+        WR16(b, src);
+    }
+    // 146e: mov 4(r1), 188e
+    {
+        a = uint16_t(r[1] + 4);
+        src = RD16(a);
+        b = 0x188e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1474: beq 1480
+    if (Z)
+        AOT_GOTO(0x1480, L1480);
+    AOT_GOTO(0x1476, L1476);
+L1476:
+    AOT_BLOCK(0x1476, 2);
+    // 1476: sub r0, 188e
+    {
+        src = r[0];
+        b = 0x188e;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x188e;
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 147a: mov (r1), r0
+    {
+        a = r[1];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 147c: sys 0
+    AOT_INTERP(0x147c);
+L147e:
+    AOT_BLOCK(0x147e, 1);
+    // 147e: mov -(r2), (r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = RD16(a);
+        b = r[2];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1480, L1480);
+L1480:
+    AOT_BLOCK(0x1480, 1);
+    // 1480: mov (sp)+, 4(r1)
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = uint16_t(r[1] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1484, L1484);
+L1482:
+    // 1482: iot
+    AOT_INTERP(0x1482);
+L1484:
+    AOT_BLOCK(0x1484, 1);
+    // 1484: mov $200, 2(r1)
+    {
+        src = uint16_t(0x0200);
+        b = uint16_t(r[1] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x148a, L148a);
+L1486:
+    AOT_BLOCK(0x1486, 1);
+    // 1486: bne 1488
+    if (!Z)
+        AOT_GOTO(0x1488, L1488);
+    AOT_GOTO(0x1488, L1488);
+L1488:
+    // 1488: rti
+    AOT_INTERP(0x1488);
+L148a:
+    AOT_BLOCK(0x148a, 1);
+    // 148a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1490:
+    AOT_BLOCK(0x1490, 3);
+    // 1490: clr 4a98
+    {
+        a = 0x4a98;
+        WR16(a, 0);
+        C = false;
+    }
+    // 1494: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1496: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1498:
+    AOT_BLOCK(0x1498, 2);
+    // 1498: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 149a: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x149c, L149c);
+L149c:
+    AOT_BLOCK(0x149c, 3);
+    // 149c: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 14a0: mov 6(r5), 1892
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x1892;
+        WR16(b, src);
+    }
+    // 14a6: mov 8(r5), 1894
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x1894;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14ac: sys 0
+    AOT_INTERP(0x14ac);
+L14ae:
+    AOT_BLOCK(0x14ae, 1);
+    // 14ae: mov -(r2), (r0)+
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = RD16(a);
+        b = r[0];
+        r[0] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14b0, L14b0);
+L14b0:
+    AOT_BLOCK(0x14b0, 1);
+    // 14b0: bcc 14b6
+    if (!C)
+        AOT_GOTO(0x14b6, L14b6);
+    AOT_GOTO(0x14b2, L14b2);
+L14b2:
+    AOT_BLOCK(0x14b2, 1);
+    // 14b2: jmp 1636
+    {
+        a = 0x1636;
+    }
+    AOT_GOTO(0x1636, L1636);
+L14b4:
+    AOT_BLOCK(0x14b4, 1);
+    // 14b4: br 13b6
+    AOT_GOTO(0x13b6, L13b6);
+L14b6:
+    AOT_BLOCK(0x14b6, 2);
+    // 14b6: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14b8: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L14ba:
+    AOT_BLOCK(0x14ba, 5);
+    // 14ba: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 14bc: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 14be: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 14c2: mov 6(r5), 1898
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x1898;
+        WR16(b, src);
+    }
+    // 14c8: mov 8(r5), 189a
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x189a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14ce: sys 0
+    AOT_INTERP(0x14ce);
+L14d0:
+    AOT_BLOCK(0x14d0, 1);
+    // 14d0: mov -(r2), (sp)+
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14d2, L14d2);
+L14d2:
+    AOT_BLOCK(0x14d2, 1);
+    // 14d2: bcc 14d8
+    if (!C)
+        AOT_GOTO(0x14d8, L14d8);
+    AOT_GOTO(0x14d4, L14d4);
+L14d4:
+    AOT_BLOCK(0x14d4, 1);
+    // 14d4: jmp 1636
+    {
+        a = 0x1636;
+    }
+    AOT_GOTO(0x1636, L1636);
+L14d6:
+    AOT_BLOCK(0x14d6, 1);
+    // 14d6: br 1594
+    AOT_GOTO(0x1594, L1594);
+L14d8:
+    AOT_BLOCK(0x14d8, 3);
+    // 14d8: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 14da: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14dc: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L14de:
+    AOT_BLOCK(0x14de, 5);
+    // 14de: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 14e0: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 14e2: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 14e6: cmp r1, $14
+    {
+        src = r[1];
+        dst = uint16_t(0x0014);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14ea: bcc 152a
+    if (!C)
+        AOT_GOTO(0x152a, L152a);
+    AOT_GOTO(0x14ec, L14ec);
+L14ec:
+    AOT_BLOCK(0x14ec, 7);
+    // 14ec: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 14f0: mov r1, 189e
+    {
+        src = r[1];
+        b = 0x189e;
+        WR16(b, src);
+    }
+    // 14f4: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 14f6: mov 4cac(r1), -(sp)
+    {
+        a = uint16_t(r[1] + 19628);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 14fa: mov r0, 4cac(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 19628);
+        WR16(b, src);
+    }
+    // 14fe: mov r0, 18a0
+    {
+        src = r[0];
+        b = 0x18a0;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1502: beq 1516
+    if (Z)
+        AOT_GOTO(0x1516, L1516);
+    AOT_GOTO(0x1504, L1504);
+L1504:
+    AOT_BLOCK(0x1504, 2);
+    // 1504: bit $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1508: bne 1516
+    if (!Z)
+        AOT_GOTO(0x1516, L1516);
+    AOT_GOTO(0x150a, L150a);
+L150a:
+    AOT_BLOCK(0x150a, 4);
+    // 150a: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 150c: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 150e: add $1536, r1
+    {
+        src = uint16_t(0x1536);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1512: mov r1, 18a0
+    {
+        src = r[1];
+        b = 0x18a0;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1516, L1516);
+L1516:
+    // 1516: sys 0
+    AOT_INTERP(0x1516);
+L1518:
+    AOT_BLOCK(0x1518, 1);
+    // 1518: mov -(r2), *(r4)+
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = RD16(a);
+        b = RD16(r[4]);
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x151a, L151a);
+L151a:
+    AOT_BLOCK(0x151a, 1);
+    // 151a: bcs 1530
+    if (C)
+        AOT_GOTO(0x1530, L1530);
+    AOT_GOTO(0x151c, L151c);
+L151c:
+    AOT_BLOCK(0x151c, 1);
+    // 151c: bit $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x1520, L1520);
+L151e:
+    // 151e: wait
+    AOT_INTERP(0x151e);
+L1520:
+    AOT_BLOCK(0x1520, 1);
+    // 1520: beq 1524
+    if (Z)
+        AOT_GOTO(0x1524, L1524);
+    AOT_GOTO(0x1522, L1522);
+L1522:
+    AOT_BLOCK(0x1522, 1);
+    // 1522: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1524, L1524);
+L1524:
+    AOT_BLOCK(0x1524, 3);
+    // 1524: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1526: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1528: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L152a:
+    AOT_BLOCK(0x152a, 2);
+    // 152a: mov $16, r0
+    {
+        src = uint16_t(0x0016);
+        r[0] = src;
+    }
+    // 152e: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1530, L1530);
+L1530:
+    AOT_BLOCK(0x1530, 2);
+    // 1530: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1532: jmp 1636
+    {
+        a = 0x1636;
+    }
+    AOT_GOTO(0x1636, L1636);
+L1594:
+    AOT_BLOCK(0x1594, 1);
+    // 1594: br 15d6
+    AOT_GOTO(0x15d6, L15d6);
+L15d6:
+    AOT_BLOCK(0x15d6, 5);
+    // 15d6: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15d8: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15da: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15dc: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15de: jsr pc, (r0)
+    {
+        a = r[0];
+        r[6] -= 2;
+        WR16(r[6], 0x15e0);
+    }
+    AOT_JUMP(a);
+L15e0:
+    AOT_BLOCK(0x15e0, 5);
+    // 15e0: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 15e2: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 15e4: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 15e6: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 15e8: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15ea: rtt
+    AOT_INTERP(0x15ea);
+L15ec:
+    AOT_BLOCK(0x15ec, 3);
+    // 15ec: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15ee: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 15f0: mov 4(r5), 18a4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x18a4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15f6: sys 0
+    AOT_INTERP(0x15f6);
+L15f8:
+    AOT_BLOCK(0x15f8, 1);
+    // 15f8: mov -(r2), -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15fa, L15fa);
+L15fa:
+    AOT_BLOCK(0x15fa, 1);
+    // 15fa: bcc 1600
+    if (!C)
+        AOT_GOTO(0x1600, L1600);
+    AOT_GOTO(0x15fc, L15fc);
+L15fc:
+    AOT_BLOCK(0x15fc, 1);
+    // 15fc: jmp 1636
+    {
+        a = 0x1636;
+    }
+    AOT_GOTO(0x1636, L1636);
+L15fe:
+    // 15fe: (undefined)
+    AOT_INTERP(0x15fe);
+L1600:
+    AOT_BLOCK(0x1600, 3);
+    // 1600: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 1602: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1604: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1606:
+    AOT_BLOCK(0x1606, 3);
+    // 1606: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1608: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 160a: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 160e: sys 1
+    AOT_INTERP(0x160e);
+L1610:
+    AOT_BLOCK(0x1610, 1);
+    // 1610: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1612, L1612);
+L1612:
+    AOT_BLOCK(0x1612, 1);
+    // 1612: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1614, L1614);
+L1614:
+    // 1614: sys 14
+    AOT_INTERP(0x1614);
+L1616:
+    AOT_BLOCK(0x1616, 1);
+    // 1616: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1618, L1618);
+L1618:
+    AOT_BLOCK(0x1618, 1);
+    // 1618: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L161a:
+    AOT_BLOCK(0x161a, 1);
+    // csv
+    {
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_JUMP(r[0]);
+L161c:
+    AOT_BLOCK(0x161c, 1);
+    // 161c: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x161e, L161e);
+L161e:
+    AOT_BLOCK(0x161e, 5);
+    // 161e: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1620: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1622: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1624: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1626: jmp (r0)
+    {
+        a = r[0];
+    }
+    AOT_JUMP(a);
+L1628:
+    AOT_BLOCK(0x1628, 1);
+    // cret
+    {
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1636:
+    AOT_BLOCK(0x1636, 5);
+    // 1636: mov r0, 4a98
+    {
+        src = r[0];
+        b = 0x4a98;
+        WR16(b, src);
+    }
+    // 163a: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+    }
+    // 163e: mov r5, sp
+    {
+        src = r[5];
+        r[6] = src;
+    }
+    // 1640: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1642: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("v6/bin/ld", 0x0000, 6310, 0x5182f270u, run);
+}
@@ -0,0 +1,8402 @@
+// v6/lib/as2 translated by 7aot: 679 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x0004: goto L0004;
+        case 0x0006: goto L0006;
+        case 0x0008: goto L0008;
+        case 0x000a: goto L000a;
+        case 0x000c: goto L000c;
+        case 0x000e: goto L000e;
+        case 0x0010: goto L0010;
+        case 0x0012: goto L0012;
+        case 0x0014: goto L0014;
+        case 0x0018: goto L0018;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0028: goto L0028;
+        case 0x002a: goto L002a;
+        case 0x002c: goto L002c;
+        case 0x0030: goto L0030;
+        case 0x0034: goto L0034;
+        case 0x0040: goto L0040;
+        case 0x0046: goto L0046;
+        case 0x0050: goto L0050;
+        case 0x0054: goto L0054;
+        case 0x005c: goto L005c;
+        case 0x0060: goto L0060;
+        case 0x0062: goto L0062;
+        case 0x0070: goto L0070;
+        case 0x0074: goto L0074;
+        case 0x0076: goto L0076;
+        case 0x0080: goto L0080;
+        case 0x0086: goto L0086;
+        case 0x0088: goto L0088;
+        case 0x0094: goto L0094;
+        case 0x0098: goto L0098;
+        case 0x00a0: goto L00a0;
+        case 0x00a4: goto L00a4;
+        case 0x00a8: goto L00a8;
+        case 0x00b4: goto L00b4;
+        case 0x00b8: goto L00b8;
+        case 0x00be: goto L00be;
+        case 0x00c0: goto L00c0;
+        case 0x00c2: goto L00c2;
+        case 0x00c4: goto L00c4;
+        case 0x00c6: goto L00c6;
+        case 0x00d0: goto L00d0;
+        case 0x0100: goto L0100;
+        case 0x012e: goto L012e;
+        case 0x0132: goto L0132;
+        case 0x013c: goto L013c;
+        case 0x0142: goto L0142;
+        case 0x014c: goto L014c;
+        case 0x0156: goto L0156;
+        case 0x015c: goto L015c;
+        case 0x0162: goto L0162;
+        case 0x0166: goto L0166;
+        case 0x016a: goto L016a;
+        case 0x0170: goto L0170;
+        case 0x017c: goto L017c;
+        case 0x017e: goto L017e;
+        case 0x0180: goto L0180;
+        case 0x0182: goto L0182;
+        case 0x0184: goto L0184;
+        case 0x018c: goto L018c;
+        case 0x0192: goto L0192;
+        case 0x0196: goto L0196;
+        case 0x0198: goto L0198;
+        case 0x019e: goto L019e;
+        case 0x01a4: goto L01a4;
+        case 0x01aa: goto L01aa;
+        case 0x01b0: goto L01b0;
+        case 0x01b6: goto L01b6;
+        case 0x01bc: goto L01bc;
+        case 0x01c2: goto L01c2;
+        case 0x01ca: goto L01ca;
+        case 0x01d2: goto L01d2;
+        case 0x01d8: goto L01d8;
+        case 0x01dc: goto L01dc;
+        case 0x01de: goto L01de;
+        case 0x01e2: goto L01e2;
+        case 0x01e8: goto L01e8;
+        case 0x01ec: goto L01ec;
+        case 0x01f2: goto L01f2;
+        case 0x01f8: goto L01f8;
+        case 0x01fa: goto L01fa;
+        case 0x01fc: goto L01fc;
+        case 0x01fe: goto L01fe;
+        case 0x0200: goto L0200;
+        case 0x0202: goto L0202;
+        case 0x0204: goto L0204;
+        case 0x0206: goto L0206;
+        case 0x0208: goto L0208;
+        case 0x020a: goto L020a;
+        case 0x020c: goto L020c;
+        case 0x0210: goto L0210;
+        case 0x0214: goto L0214;
+        case 0x021e: goto L021e;
+        case 0x0224: goto L0224;
+        case 0x0226: goto L0226;
+        case 0x022e: goto L022e;
+        case 0x0234: goto L0234;
+        case 0x0236: goto L0236;
+        case 0x0242: goto L0242;
+        case 0x024a: goto L024a;
+        case 0x024c: goto L024c;
+        case 0x024e: goto L024e;
+        case 0x0250: goto L0250;
+        case 0x0252: goto L0252;
+        case 0x0254: goto L0254;
+        case 0x025a: goto L025a;
+        case 0x025c: goto L025c;
+        case 0x0268: goto L0268;
+        case 0x026c: goto L026c;
+        case 0x0274: goto L0274;
+        case 0x0276: goto L0276;
+        case 0x027e: goto L027e;
+        case 0x0280: goto L0280;
+        case 0x0282: goto L0282;
+        case 0x0284: goto L0284;
+        case 0x0286: goto L0286;
+        case 0x028a: goto L028a;
+        case 0x0292: goto L0292;
+        case 0x029a: goto L029a;
+        case 0x02a6: goto L02a6;
+        case 0x02b4: goto L02b4;
+        case 0x02ca: goto L02ca;
+        case 0x02d4: goto L02d4;
+        case 0x02da: goto L02da;
+        case 0x02e0: goto L02e0;
+        case 0x02e4: goto L02e4;
+        case 0x02e6: goto L02e6;
+        case 0x02ea: goto L02ea;
+        case 0x02f0: goto L02f0;
+        case 0x02f6: goto L02f6;
+        case 0x02fa: goto L02fa;
+        case 0x0300: goto L0300;
+        case 0x0304: goto L0304;
+        case 0x0308: goto L0308;
+        case 0x030c: goto L030c;
+        case 0x030e: goto L030e;
+        case 0x0318: goto L0318;
+        case 0x0326: goto L0326;
+        case 0x032e: goto L032e;
+        case 0x0330: goto L0330;
+        case 0x0334: goto L0334;
+        case 0x0336: goto L0336;
+        case 0x033c: goto L033c;
+        case 0x033e: goto L033e;
+        case 0x0342: goto L0342;
+        case 0x0346: goto L0346;
+        case 0x034e: goto L034e;
+        case 0x0354: goto L0354;
+        case 0x0358: goto L0358;
+        case 0x035a: goto L035a;
+        case 0x0360: goto L0360;
+        case 0x036a: goto L036a;
+        case 0x036e: goto L036e;
+        case 0x0376: goto L0376;
+        case 0x0386: goto L0386;
+        case 0x038e: goto L038e;
+        case 0x0394: goto L0394;
+        case 0x03a6: goto L03a6;
+        case 0x03ac: goto L03ac;
+        case 0x03b4: goto L03b4;
+        case 0x03b6: goto L03b6;
+        case 0x03b8: goto L03b8;
+        case 0x03ba: goto L03ba;
+        case 0x03bc: goto L03bc;
+        case 0x03cc: goto L03cc;
+        case 0x03dc: goto L03dc;
+        case 0x03e2: goto L03e2;
+        case 0x03e4: goto L03e4;
+        case 0x03e6: goto L03e6;
+        case 0x03e8: goto L03e8;
+        case 0x03ea: goto L03ea;
+        case 0x03f0: goto L03f0;
+        case 0x03f4: goto L03f4;
+        case 0x03f8: goto L03f8;
+        case 0x03fa: goto L03fa;
+        case 0x03fc: goto L03fc;
+        case 0x0400: goto L0400;
+        case 0x0406: goto L0406;
+        case 0x040c: goto L040c;
+        case 0x0410: goto L0410;
+        case 0x043c: goto L043c;
+        case 0x0440: goto L0440;
+        case 0x0446: goto L0446;
+        case 0x0454: goto L0454;
+        case 0x045a: goto L045a;
+        case 0x0500: goto L0500;
+        case 0x0506: goto L0506;
+        case 0x050c: goto L050c;
+        case 0x0512: goto L0512;
+        case 0x0514: goto L0514;
+        case 0x0518: goto L0518;
+        case 0x0522: goto L0522;
+        case 0x0524: goto L0524;
+        case 0x0528: goto L0528;
+        case 0x052c: goto L052c;
+        case 0x052e: goto L052e;
+        case 0x054e: goto L054e;
+        case 0x0554: goto L0554;
+        case 0x055a: goto L055a;
+        case 0x055c: goto L055c;
+        case 0x0560: goto L0560;
+        case 0x0564: goto L0564;
+        case 0x056a: goto L056a;
+        case 0x0570: goto L0570;
+        case 0x0576: goto L0576;
+        case 0x057a: goto L057a;
+        case 0x057c: goto L057c;
+        case 0x0588: goto L0588;
+        case 0x058e: goto L058e;
+        case 0x0592: goto L0592;
+        case 0x0598: goto L0598;
+        case 0x059c: goto L059c;
+        case 0x05a4: goto L05a4;
+        case 0x05c4: goto L05c4;
+        case 0x05d0: goto L05d0;
+        case 0x05d6: goto L05d6;
+        case 0x05de: goto L05de;
+        case 0x05e6: goto L05e6;
+        case 0x05ec: goto L05ec;
+        case 0x05f0: goto L05f0;
+        case 0x05fc: goto L05fc;
+        case 0x05fe: goto L05fe;
+        case 0x0600: goto L0600;
+        case 0x0602: goto L0602;
+        case 0x0604: goto L0604;
+        case 0x0622: goto L0622;
+        case 0x0624: goto L0624;
+        case 0x0626: goto L0626;
+        case 0x0628: goto L0628;
+        case 0x062a: goto L062a;
+        case 0x062c: goto L062c;
+        case 0x0632: goto L0632;
+        case 0x0636: goto L0636;
+        case 0x063c: goto L063c;
+        case 0x0642: goto L0642;
+        case 0x0648: goto L0648;
+        case 0x064c: goto L064c;
+        case 0x064e: goto L064e;
+        case 0x0654: goto L0654;
+        case 0x065a: goto L065a;
+        case 0x0660: goto L0660;
+        case 0x0666: goto L0666;
+        case 0x0668: goto L0668;
+        case 0x066a: goto L066a;
+        case 0x066c: goto L066c;
+        case 0x066e: goto L066e;
+        case 0x0672: goto L0672;
+        case 0x0674: goto L0674;
+        case 0x0676: goto L0676;
+        case 0x0678: goto L0678;
+        case 0x067c: goto L067c;
+        case 0x0682: goto L0682;
+        case 0x068e: goto L068e;
+        case 0x0694: goto L0694;
+        case 0x0696: goto L0696;
+        case 0x06ac: goto L06ac;
+        case 0x06b0: goto L06b0;
+        case 0x06b4: goto L06b4;
+        case 0x06d2: goto L06d2;
+        case 0x06d4: goto L06d4;
+        case 0x06de: goto L06de;
+        case 0x0700: goto L0700;
+        case 0x0702: goto L0702;
+        case 0x0704: goto L0704;
+        case 0x0706: goto L0706;
+        case 0x0708: goto L0708;
+        case 0x070c: goto L070c;
+        case 0x0710: goto L0710;
+        case 0x0712: goto L0712;
+        case 0x0714: goto L0714;
+        case 0x0716: goto L0716;
+        case 0x0718: goto L0718;
+        case 0x071a: goto L071a;
+        case 0x071c: goto L071c;
+        case 0x0720: goto L0720;
+        case 0x0722: goto L0722;
+        case 0x0724: goto L0724;
+        case 0x0726: goto L0726;
+        case 0x0728: goto L0728;
+        case 0x0736: goto L0736;
+        case 0x073a: goto L073a;
+        case 0x073e: goto L073e;
+        case 0x0744: goto L0744;
+        case 0x0748: goto L0748;
+        case 0x076c: goto L076c;
+        case 0x0772: goto L0772;
+        case 0x0776: goto L0776;
+        case 0x077c: goto L077c;
+        case 0x0782: goto L0782;
+        case 0x078e: goto L078e;
+        case 0x0792: goto L0792;
+        case 0x0794: goto L0794;
+        case 0x079e: goto L079e;
+        case 0x07a2: goto L07a2;
+        case 0x07a6: goto L07a6;
+        case 0x07b2: goto L07b2;
+        case 0x07b4: goto L07b4;
+        case 0x07c0: goto L07c0;
+        case 0x07c4: goto L07c4;
+        case 0x07ca: goto L07ca;
+        case 0x07d0: goto L07d0;
+        case 0x07d2: goto L07d2;
+        case 0x07d4: goto L07d4;
+        case 0x0800: goto L0800;
+        case 0x09e8: goto L09e8;
+        case 0x09ea: goto L09ea;
+        case 0x09f0: goto L09f0;
+        case 0x09f6: goto L09f6;
+        case 0x09fc: goto L09fc;
+        case 0x0a00: goto L0a00;
+        case 0x0a02: goto L0a02;
+        case 0x0a06: goto L0a06;
+        case 0x0a0a: goto L0a0a;
+        case 0x0a10: goto L0a10;
+        case 0x0a14: goto L0a14;
+        case 0x0a20: goto L0a20;
+        case 0x0a24: goto L0a24;
+        case 0x0a28: goto L0a28;
+        case 0x0a30: goto L0a30;
+        case 0x0a36: goto L0a36;
+        case 0x0a3a: goto L0a3a;
+        case 0x0a3e: goto L0a3e;
+        case 0x0a40: goto L0a40;
+        case 0x0a58: goto L0a58;
+        case 0x0a5c: goto L0a5c;
+        case 0x0a6c: goto L0a6c;
+        case 0x0a70: goto L0a70;
+        case 0x0a74: goto L0a74;
+        case 0x0a78: goto L0a78;
+        case 0x0a7c: goto L0a7c;
+        case 0x0a80: goto L0a80;
+        case 0x0a82: goto L0a82;
+        case 0x0a86: goto L0a86;
+        case 0x0a94: goto L0a94;
+        case 0x0a9a: goto L0a9a;
+        case 0x0a9e: goto L0a9e;
+        case 0x0aa6: goto L0aa6;
+        case 0x0aaa: goto L0aaa;
+        case 0x0ab0: goto L0ab0;
+        case 0x0aba: goto L0aba;
+        case 0x0abe: goto L0abe;
+        case 0x0ac2: goto L0ac2;
+        case 0x0ac6: goto L0ac6;
+        case 0x0aca: goto L0aca;
+        case 0x0ad2: goto L0ad2;
+        case 0x0ad6: goto L0ad6;
+        case 0x0ada: goto L0ada;
+        case 0x0aea: goto L0aea;
+        case 0x0aee: goto L0aee;
+        case 0x0af2: goto L0af2;
+        case 0x0af4: goto L0af4;
+        case 0x0afc: goto L0afc;
+        case 0x0b00: goto L0b00;
+        case 0x0b04: goto L0b04;
+        case 0x0b08: goto L0b08;
+        case 0x0b0e: goto L0b0e;
+        case 0x0b14: goto L0b14;
+        case 0x0b1a: goto L0b1a;
+        case 0x0b1c: goto L0b1c;
+        case 0x0b20: goto L0b20;
+        case 0x0b2e: goto L0b2e;
+        case 0x0b34: goto L0b34;
+        case 0x0b38: goto L0b38;
+        case 0x0b3a: goto L0b3a;
+        case 0x0b3c: goto L0b3c;
+        case 0x0b40: goto L0b40;
+        case 0x0bb2: goto L0bb2;
+        case 0x0bc4: goto L0bc4;
+        case 0x0bc8: goto L0bc8;
+        case 0x0bce: goto L0bce;
+        case 0x0bd0: goto L0bd0;
+        case 0x0bd6: goto L0bd6;
+        case 0x0bdc: goto L0bdc;
+        case 0x0be2: goto L0be2;
+        case 0x0be6: goto L0be6;
+        case 0x0be8: goto L0be8;
+        case 0x0bee: goto L0bee;
+        case 0x0bf6: goto L0bf6;
+        case 0x0c00: goto L0c00;
+        case 0x0c02: goto L0c02;
+        case 0x0c10: goto L0c10;
+        case 0x0c14: goto L0c14;
+        case 0x0c18: goto L0c18;
+        case 0x0c1c: goto L0c1c;
+        case 0x0c22: goto L0c22;
+        case 0x0c40: goto L0c40;
+        case 0x0c44: goto L0c44;
+        case 0x0c48: goto L0c48;
+        case 0x0c80: goto L0c80;
+        case 0x0ca2: goto L0ca2;
+        case 0x0ca6: goto L0ca6;
+        case 0x0caa: goto L0caa;
+        case 0x0cae: goto L0cae;
+        case 0x0cb0: goto L0cb0;
+        case 0x0cc0: goto L0cc0;
+        case 0x0cc2: goto L0cc2;
+        case 0x0cc4: goto L0cc4;
+        case 0x0cc6: goto L0cc6;
+        case 0x0cc8: goto L0cc8;
+        case 0x0cca: goto L0cca;
+        case 0x0ccc: goto L0ccc;
+        case 0x0cce: goto L0cce;
+        case 0x0cd6: goto L0cd6;
+        case 0x0cde: goto L0cde;
+        case 0x0ce0: goto L0ce0;
+        case 0x0d00: goto L0d00;
+        case 0x0d02: goto L0d02;
+        case 0x0d64: goto L0d64;
+        case 0x0dc0: goto L0dc0;
+        case 0x0dc6: goto L0dc6;
+        case 0x0dcc: goto L0dcc;
+        case 0x0dd0: goto L0dd0;
+        case 0x0dd2: goto L0dd2;
+        case 0x0dd6: goto L0dd6;
+        case 0x0e76: goto L0e76;
+        case 0x0e7e: goto L0e7e;
+        case 0x0e80: goto L0e80;
+        case 0x0e82: goto L0e82;
+        case 0x0e84: goto L0e84;
+        case 0x0e86: goto L0e86;
+        case 0x0e88: goto L0e88;
+        case 0x0e8a: goto L0e8a;
+        case 0x0e8c: goto L0e8c;
+        case 0x0e8e: goto L0e8e;
+        case 0x0e90: goto L0e90;
+        case 0x0e92: goto L0e92;
+        case 0x0e94: goto L0e94;
+        case 0x0e96: goto L0e96;
+        case 0x0e98: goto L0e98;
+        case 0x0e9a: goto L0e9a;
+        case 0x0e9c: goto L0e9c;
+        case 0x0e9e: goto L0e9e;
+        case 0x0ea0: goto L0ea0;
+        case 0x0ea2: goto L0ea2;
+        case 0x0ea4: goto L0ea4;
+        case 0x0ea6: goto L0ea6;
+        case 0x0ea8: goto L0ea8;
+        case 0x0eaa: goto L0eaa;
+        case 0x0eae: goto L0eae;
+        case 0x0eb0: goto L0eb0;
+        case 0x0eb2: goto L0eb2;
+        case 0x0eb4: goto L0eb4;
+        case 0x0eb6: goto L0eb6;
+        case 0x0eb8: goto L0eb8;
+        case 0x0eba: goto L0eba;
+        case 0x0ebc: goto L0ebc;
+        case 0x0ebe: goto L0ebe;
+        case 0x0ec0: goto L0ec0;
+        case 0x0ec2: goto L0ec2;
+        case 0x0ec4: goto L0ec4;
+        case 0x0ed4: goto L0ed4;
+        case 0x0ed6: goto L0ed6;
+        case 0x0ed8: goto L0ed8;
+        case 0x0eda: goto L0eda;
+        case 0x0edc: goto L0edc;
+        case 0x0ede: goto L0ede;
+        case 0x0ee0: goto L0ee0;
+        case 0x0ee2: goto L0ee2;
+        case 0x0ee4: goto L0ee4;
+        case 0x0ee6: goto L0ee6;
+        case 0x0ee8: goto L0ee8;
+        case 0x0eea: goto L0eea;
+        case 0x0eec: goto L0eec;
+        case 0x0eee: goto L0eee;
+        case 0x0ef0: goto L0ef0;
+        case 0x0ef2: goto L0ef2;
+        case 0x0ef4: goto L0ef4;
+        case 0x0ef6: goto L0ef6;
+        case 0x0ef8: goto L0ef8;
+        case 0x0efa: goto L0efa;
+        case 0x0efc: goto L0efc;
+        case 0x0efe: goto L0efe;
+        case 0x0f00: goto L0f00;
+        case 0x0f02: goto L0f02;
+        case 0x0f04: goto L0f04;
+        case 0x0f06: goto L0f06;
+        case 0x0f08: goto L0f08;
+        case 0x0f0a: goto L0f0a;
+        case 0x0f0c: goto L0f0c;
+        case 0x0f0e: goto L0f0e;
+        case 0x0f10: goto L0f10;
+        case 0x0f12: goto L0f12;
+        case 0x0f14: goto L0f14;
+        case 0x0f16: goto L0f16;
+        case 0x0f18: goto L0f18;
+        case 0x0f1a: goto L0f1a;
+        case 0x0f1c: goto L0f1c;
+        case 0x0f1e: goto L0f1e;
+        case 0x0f20: goto L0f20;
+        case 0x0f22: goto L0f22;
+        case 0x0f24: goto L0f24;
+        case 0x0f26: goto L0f26;
+        case 0x0f28: goto L0f28;
+        case 0x0f2a: goto L0f2a;
+        case 0x0f2c: goto L0f2c;
+        case 0x0f2e: goto L0f2e;
+        case 0x0f30: goto L0f30;
+        case 0x0f32: goto L0f32;
+        case 0x0f34: goto L0f34;
+        case 0x0f36: goto L0f36;
+        case 0x0f38: goto L0f38;
+        case 0x0f3a: goto L0f3a;
+        case 0x0f3c: goto L0f3c;
+        case 0x0f3e: goto L0f3e;
+        case 0x0f40: goto L0f40;
+        case 0x0f42: goto L0f42;
+        case 0x0f44: goto L0f44;
+        case 0x0f46: goto L0f46;
+        case 0x0f48: goto L0f48;
+        case 0x0f4a: goto L0f4a;
+        case 0x0f4c: goto L0f4c;
+        case 0x0f4e: goto L0f4e;
+        case 0x0f50: goto L0f50;
+        case 0x0f52: goto L0f52;
+        case 0x0f54: goto L0f54;
+        case 0x0f56: goto L0f56;
+        case 0x0f58: goto L0f58;
+        case 0x0f5a: goto L0f5a;
+        case 0x0f5c: goto L0f5c;
+        case 0x0f5e: goto L0f5e;
+        case 0x0f60: goto L0f60;
+        case 0x0f62: goto L0f62;
+        case 0x0f64: goto L0f64;
+        case 0x0f66: goto L0f66;
+        case 0x0f68: goto L0f68;
+        case 0x0f6a: goto L0f6a;
+        case 0x0f6c: goto L0f6c;
+        case 0x0f6e: goto L0f6e;
+        case 0x0f70: goto L0f70;
+        case 0x0f72: goto L0f72;
+        case 0x0f74: goto L0f74;
+        case 0x0f76: goto L0f76;
+        case 0x0f78: goto L0f78;
+        case 0x0f7a: goto L0f7a;
+        case 0x0f7c: goto L0f7c;
+        case 0x0f7e: goto L0f7e;
+        case 0x0f80: goto L0f80;
+        case 0x0f82: goto L0f82;
+        case 0x0f84: goto L0f84;
+        case 0x0f86: goto L0f86;
+        case 0x0f88: goto L0f88;
+        case 0x0f8c: goto L0f8c;
+        case 0x0f90: goto L0f90;
+        case 0x0f94: goto L0f94;
+        case 0x0f98: goto L0f98;
+        case 0x0f9c: goto L0f9c;
+        case 0x0fa0: goto L0fa0;
+        case 0x0fa4: goto L0fa4;
+        case 0x0fa8: goto L0fa8;
+        case 0x0fac: goto L0fac;
+        case 0x0fb0: goto L0fb0;
+        case 0x0fb4: goto L0fb4;
+        case 0x0fb8: goto L0fb8;
+        case 0x0fba: goto L0fba;
+        case 0x0fbc: goto L0fbc;
+        case 0x0fbe: goto L0fbe;
+        case 0x0fc0: goto L0fc0;
+        case 0x0fc2: goto L0fc2;
+        case 0x0fc4: goto L0fc4;
+        case 0x0fc6: goto L0fc6;
+        case 0x0fc8: goto L0fc8;
+        case 0x0fca: goto L0fca;
+        case 0x0fcc: goto L0fcc;
+        case 0x0fce: goto L0fce;
+        case 0x0fd0: goto L0fd0;
+        case 0x0fd2: goto L0fd2;
+        case 0x0fd4: goto L0fd4;
+        case 0x0fd6: goto L0fd6;
+        case 0x0fd8: goto L0fd8;
+        case 0x0fda: goto L0fda;
+        case 0x0fdc: goto L0fdc;
+        case 0x0fde: goto L0fde;
+        case 0x0fe0: goto L0fe0;
+        case 0x0fe2: goto L0fe2;
+        case 0x0fe4: goto L0fe4;
+        case 0x0fe6: goto L0fe6;
+        case 0x0fe8: goto L0fe8;
+        case 0x0fea: goto L0fea;
+        case 0x0fec: goto L0fec;
+        case 0x0fee: goto L0fee;
+        case 0x0ff0: goto L0ff0;
+        case 0x0ff2: goto L0ff2;
+        case 0x0ff4: goto L0ff4;
+        case 0x0ff6: goto L0ff6;
+        case 0x0ff8: goto L0ff8;
+        case 0x0ffa: goto L0ffa;
+        case 0x0ffc: goto L0ffc;
+        case 0x0ffe: goto L0ffe;
+        case 0x1000: goto L1000;
+        case 0x1002: goto L1002;
+        case 0x1004: goto L1004;
+        case 0x1006: goto L1006;
+        case 0x1008: goto L1008;
+        case 0x100a: goto L100a;
+        case 0x100c: goto L100c;
+        case 0x100e: goto L100e;
+        case 0x1010: goto L1010;
+        case 0x1012: goto L1012;
+        case 0x1014: goto L1014;
+        case 0x1016: goto L1016;
+        case 0x1018: goto L1018;
+        case 0x101a: goto L101a;
+        case 0x101c: goto L101c;
+        case 0x101e: goto L101e;
+        case 0x1020: goto L1020;
+        case 0x1022: goto L1022;
+        case 0x1024: goto L1024;
+        case 0x1026: goto L1026;
+        case 0x1028: goto L1028;
+        case 0x102a: goto L102a;
+        case 0x102c: goto L102c;
+        case 0x102e: goto L102e;
+        case 0x1030: goto L1030;
+        case 0x1032: goto L1032;
+        case 0x1034: goto L1034;
+        case 0x1036: goto L1036;
+        case 0x1038: goto L1038;
+        case 0x103a: goto L103a;
+        case 0x103c: goto L103c;
+        case 0x103e: goto L103e;
+        case 0x1040: goto L1040;
+        case 0x1042: goto L1042;
+        case 0x1044: goto L1044;
+        case 0x1046: goto L1046;
+        case 0x1048: goto L1048;
+        case 0x104a: goto L104a;
+        case 0x104c: goto L104c;
+        case 0x104e: goto L104e;
+        case 0x1050: goto L1050;
+        case 0x1054: goto L1054;
+        case 0x1058: goto L1058;
+        case 0x105c: goto L105c;
+        case 0x1060: goto L1060;
+        case 0x1064: goto L1064;
+        case 0x1068: goto L1068;
+        case 0x106c: goto L106c;
+        case 0x1070: goto L1070;
+        case 0x1074: goto L1074;
+        case 0x1078: goto L1078;
+        case 0x107c: goto L107c;
+        case 0x1080: goto L1080;
+        case 0x1084: goto L1084;
+        case 0x1088: goto L1088;
+        case 0x108c: goto L108c;
+        case 0x1090: goto L1090;
+        case 0x1094: goto L1094;
+        case 0x1098: goto L1098;
+        case 0x109c: goto L109c;
+        case 0x10a0: goto L10a0;
+        case 0x10a4: goto L10a4;
+        case 0x10a8: goto L10a8;
+        case 0x10ac: goto L10ac;
+        case 0x10b0: goto L10b0;
+        case 0x10b2: goto L10b2;
+        case 0x10b4: goto L10b4;
+        case 0x10b8: goto L10b8;
+        case 0x10ba: goto L10ba;
+        case 0x10bc: goto L10bc;
+        case 0x11ae: goto L11ae;
+        case 0x11b4: goto L11b4;
+        case 0x11b8: goto L11b8;
+        case 0x11be: goto L11be;
+        case 0x11c4: goto L11c4;
+        case 0x11d6: goto L11d6;
+        case 0x11d8: goto L11d8;
+        case 0x11e0: goto L11e0;
+        case 0x11e2: goto L11e2;
+        case 0x11ea: goto L11ea;
+        case 0x11ec: goto L11ec;
+        case 0x11f6: goto L11f6;
+        case 0x11f8: goto L11f8;
+        case 0x11fa: goto L11fa;
+        case 0x11fc: goto L11fc;
+        case 0x11fe: goto L11fe;
+        case 0x1200: goto L1200;
+        case 0x1202: goto L1202;
+    }
+    goto interp;
+L0000:
+    // 0000: sys 30
+    AOT_INTERP(0x0000);
+L0002:
+    // 0002: rti
+    AOT_INTERP(0x0002);
+L0004:
+    // 0004: wait
+    AOT_INTERP(0x0004);
+L0006:
+    AOT_BLOCK(0x0006, 1);
+    // 0006: ror r0
+    {
+        src = r[0];
+        val = (src >> 1) | (C ? 0x8000 : 0);
+        dst = C;
+        r[0] = val;
+        Z = val == 0;
+        N = dst;
+        C = (src & 1) != 0;
+        V = dst != ((src & 1) != 0);
+    }
+    AOT_GOTO(0x0008, L0008);
+L0008:
+    AOT_BLOCK(0x0008, 1);
+    // 0008: bcs 0010
+    if (C)
+        AOT_GOTO(0x0010, L0010);
+    AOT_GOTO(0x000a, L000a);
+L000a:
+    // 000a: sys 30
+    AOT_INTERP(0x000a);
+L000c:
+    // 000c: rti
+    AOT_INTERP(0x000c);
+L000e:
+    // 000e: (undefined)
+    AOT_INTERP(0x000e);
+L0010:
+    AOT_BLOCK(0x0010, 1);
+    // 0010: jmp 11ae
+    {
+        a = 0x11ae;
+    }
+    AOT_GOTO(0x11ae, L11ae);
+L0012:
+    AOT_BLOCK(0x0012, 1);
+    // 0012: mov sp, *(r2)+
+    {
+        src = r[6];
+        b = RD16(r[2]);
+        r[2] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0014, L0014);
+L0014:
+    AOT_BLOCK(0x0014, 1);
+    // 0014: mov $18bc, r1
+    {
+        src = uint16_t(0x18bc);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0018, L0018);
+L0018:
+    AOT_BLOCK(0x0018, 1);
+    // 0018: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x001c);
+    }
+    AOT_GOTO(0x064e, L064e);
+L001c:
+    AOT_BLOCK(0x001c, 1);
+    // 001c: bvs 0062
+    if (V)
+        AOT_GOTO(0x0062, L0062);
+    AOT_GOTO(0x001e, L001e);
+L001e:
+    AOT_BLOCK(0x001e, 2);
+    // 001e: add $c, 0ecc
+    {
+        src = uint16_t(0x000c);
+        b = 0x0ecc;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0024: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x0028);
+    }
+    AOT_GOTO(0x064e, L064e);
+L0028:
+    AOT_BLOCK(0x0028, 1);
+    // 0028: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x002c);
+    }
+    AOT_GOTO(0x064e, L064e);
+L002a:
+    AOT_BLOCK(0x002a, 1);
+    // 002a: bgt 0070
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0070, L0070);
+    AOT_GOTO(0x002c, L002c);
+L002c:
+    AOT_BLOCK(0x002c, 1);
+    // 002c: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x0030);
+    }
+    AOT_GOTO(0x064e, L064e);
+L0030:
+    AOT_BLOCK(0x0030, 1);
+    // 0030: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x0034);
+    }
+    AOT_GOTO(0x064e, L064e);
+L0034:
+    AOT_BLOCK(0x0034, 4);
+    // 0034: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0036: bic $ffe0, r0
+    {
+        src = uint16_t(0xffe0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 003a: cmp r0, $2
+    {
+        src = r[0];
+        dst = uint16_t(0x0002);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 003e: bcs 0054
+    if (C)
+        AOT_GOTO(0x0054, L0054);
+    AOT_GOTO(0x0040, L0040);
+L0040:
+    AOT_BLOCK(0x0040, 2);
+    // 0040: cmp r0, $3
+    {
+        src = r[0];
+        dst = uint16_t(0x0003);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0044: bhi 0054
+    if (!(C | Z))
+        AOT_GOTO(0x0054, L0054);
+    AOT_GOTO(0x0046, L0046);
+L0046:
+    AOT_BLOCK(0x0046, 3);
+    // 0046: add $19, r4
+    {
+        src = uint16_t(0x0019);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 004a: mov r4, (r1)+
+    {
+        src = r[4];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 004c: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x0050);
+    }
+    AOT_GOTO(0x064e, L064e);
+L0050:
+    AOT_BLOCK(0x0050, 2);
+    // 0050: mov r4, (r1)+
+    {
+        src = r[4];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0052: br 005c
+    AOT_GOTO(0x005c, L005c);
+L0054:
+    AOT_BLOCK(0x0054, 3);
+    // 0054: clr (r1)+
+    {
+        a = r[1];
+        r[1] += 2;
+        WR16(a, 0);
+    }
+    // 0056: clr (r1)+
+    {
+        a = r[1];
+        r[1] += 2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0058: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x005c);
+    }
+    AOT_GOTO(0x064e, L064e);
+L005c:
+    AOT_BLOCK(0x005c, 1);
+    // 005c: jsr pc, 0236
+    {
+        a = 0x0236;
+        r[6] -= 2;
+        WR16(r[6], 0x0060);
+    }
+    AOT_GOTO(0x0236, L0236);
+L0060:
+    AOT_BLOCK(0x0060, 1);
+    // 0060: br 0018
+    AOT_GOTO(0x0018, L0018);
+L0062:
+    AOT_BLOCK(0x0062, 3);
+    // 0062: mov r1, 1432
+    {
+        src = r[1];
+        b = 0x1432;
+        WR16(b, src);
+    }
+    // 0066: movb 1440, 1442
+    {
+        a = 0x1440;
+        src = RD8(a);
+        b = 0x1442;
+        WR8(b, src);
+    }
+    // 006c: clr 1444
+    {
+        a = 0x1444;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0070, L0070);
+L0070:
+    AOT_BLOCK(0x0070, 1);
+    // 0070: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x0074);
+    }
+    AOT_GOTO(0x064e, L064e);
+L0074:
+    AOT_BLOCK(0x0074, 1);
+    // 0074: bvs 0088
+    if (V)
+        AOT_GOTO(0x0088, L0088);
+    AOT_GOTO(0x0076, L0076);
+L0076:
+    AOT_BLOCK(0x0076, 3);
+    // 0076: add $19, r4
+    {
+        src = uint16_t(0x0019);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 007a: mov r4, (r1)+
+    {
+        src = r[4];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 007c: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x0080);
+    }
+    AOT_GOTO(0x064e, L064e);
+L0080:
+    AOT_BLOCK(0x0080, 2);
+    // 0080: mov r4, (r1)+
+    {
+        src = r[4];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0082: jsr pc, 0236
+    {
+        a = 0x0236;
+        r[6] -= 2;
+        WR16(r[6], 0x0086);
+    }
+    AOT_GOTO(0x0236, L0236);
+L0086:
+    AOT_BLOCK(0x0086, 1);
+    // 0086: br 0070
+    AOT_GOTO(0x0070, L0070);
+L0088:
+    AOT_BLOCK(0x0088, 3);
+    // 0088: mov r1, 18ba
+    {
+        src = r[1];
+        b = 0x18ba;
+        WR16(b, src);
+    }
+    // 008c: mov $8000, (r1)+
+    {
+        src = uint16_t(0x8000);
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0090: jsr pc, 0250
+    {
+        a = 0x0250;
+        r[6] -= 2;
+        WR16(r[6], 0x0094);
+    }
+    AOT_GOTO(0x0250, L0250);
+L0094:
+    AOT_BLOCK(0x0094, 1);
+    // 0094: jsr pc, 03fc
+    {
+        a = 0x03fc;
+        r[6] -= 2;
+        WR16(r[6], 0x0098);
+    }
+    AOT_GOTO(0x03fc, L03fc);
+L0098:
+    AOT_BLOCK(0x0098, 2);
+    // 0098: cmp 0e98, $1ff
+    {
+        a = 0x0e98;
+        src = RD16(a);
+        dst = uint16_t(0x01ff);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 009e: beq 00a4
+    if (Z)
+        AOT_GOTO(0x00a4, L00a4);
+    AOT_GOTO(0x00a0, L00a0);
+L00a0:
+    AOT_BLOCK(0x00a0, 1);
+    // 00a0: jmp 0e76
+    {
+        a = 0x0e76;
+    }
+    AOT_GOTO(0x0e76, L0e76);
+L00a4:
+    AOT_BLOCK(0x00a4, 1);
+    // 00a4: clr 0ee4
+    {
+        a = 0x0ee4;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x00a8, L00a8);
+L00a8:
+    AOT_BLOCK(0x00a8, 2);
+    // 00a8: mov $2, 0ee2
+    {
+        src = uint16_t(0x0002);
+        b = 0x0ee2;
+        WR16(b, src);
+    }
+    // 00ae: mov $0, 0ee8
+    {
+        src = uint16_t(0x0000);
+        b = 0x0ee8;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00b4, L00b4);
+L00b4:
+    AOT_BLOCK(0x00b4, 1);
+    // 00b4: clr 142e
+    {
+        a = 0x142e;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x00b8, L00b8);
+L00b8:
+    AOT_BLOCK(0x00b8, 1);
+    // 00b8: movb 1442, r0
+    {
+        a = 0x1442;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 00bc: sys 6
+    AOT_INTERP(0x00bc);
+L00be:
+    AOT_BLOCK(0x00be, 1);
+    // 00be: jsr r5, 0276
+    {
+        a = 0x0276;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x00c2;
+    }
+    AOT_GOTO(0x0276, L0276);
+L00c0:
+    AOT_BLOCK(0x00c0, 1);
+    // 00c0: br 002a
+    AOT_GOTO(0x002a, L002a);
+L00c2:
+    // 00c2: (undefined)
+    AOT_INTERP(0x00c2);
+L00c4:
+    AOT_BLOCK(0x00c4, 3);
+    // 00c4: movb r0, 1442
+    {
+        src = uint8_t(r[0]);
+        b = 0x1442;
+        WR8(b, src);
+    }
+    // 00c8: clr 1444
+    {
+        a = 0x1444;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 00cc: jsr pc, 0250
+    {
+        a = 0x0250;
+        r[6] -= 2;
+        WR16(r[6], 0x00d0);
+    }
+    AOT_GOTO(0x0250, L0250);
+L00c6:
+    AOT_BLOCK(0x00c6, 3);
+    // 00c6: mov (r5), *a37(r2)
+    {
+        a = r[5];
+        src = RD16(a);
+        b = RD16(r[2] + 2615);
+        WR16(b, src);
+    }
+    // 00ca: mov (r5), *9f7(r0)
+    {
+        a = r[5];
+        src = RD16(a);
+        b = RD16(r[0] + 2551);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00ce: br -30
+    AOT_JUMP(0xffd0);
+L00d0:
+    AOT_BLOCK(0x00d0, 13);
+    // 00d0: inc 18b8
+    {
+        a = 0x18b8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 00d4: inc 0eca
+    {
+        a = 0x0eca;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 00d8: bic $1, 0eca
+    {
+        src = uint16_t(0x0001);
+        b = 0x0eca;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 00de: mov 0ec6, r1
+    {
+        a = 0x0ec6;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 00e2: inc r1
+    {
+        val = int(int16_t(r[1])) + 1;
+        r[1] = val;
+    }
+    // 00e4: bic $1, r1
+    {
+        src = uint16_t(0x0001);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 00e8: mov r1, 0ec6
+    {
+        src = r[1];
+        b = 0x0ec6;
+        WR16(b, src);
+    }
+    // 00ec: mov 0ec8, r2
+    {
+        a = 0x0ec8;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 00f0: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 00f2: bic $1, r2
+    {
+        src = uint16_t(0x0001);
+        dst = r[2];
+        val = (~src) & dst;
+        r[2] = val;
+    }
+    // 00f6: mov r2, 0ec8
+    {
+        src = r[2];
+        b = 0x0ec8;
+        WR16(b, src);
+    }
+    // 00fa: mov r1, r3
+    {
+        src = r[1];
+        r[3] = src;
+    }
+    // 00fc: mov r3, 143c
+    {
+        src = r[3];
+        b = 0x143c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0100, L0100);
+L0100:
+    AOT_BLOCK(0x0100, 14);
+    // 0100: mov r3, 1438
+    {
+        src = r[3];
+        b = 0x1438;
+        WR16(b, src);
+    }
+    // 0104: add r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 0106: mov r3, 143e
+    {
+        src = r[3];
+        b = 0x143e;
+        WR16(b, src);
+    }
+    // 010a: mov r3, 143a
+    {
+        src = r[3];
+        b = 0x143a;
+        WR16(b, src);
+    }
+    // 010e: asl r3
+    {
+        src = r[3];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[3] = val;
+    }
+    // 0110: add $10, r3
+    {
+        src = uint16_t(0x0010);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 0114: mov r3, 0ee0
+    {
+        src = r[3];
+        b = 0x0ee0;
+        WR16(b, src);
+    }
+    // 0118: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 011a: mov r3, 0edc
+    {
+        src = r[3];
+        b = 0x0edc;
+        WR16(b, src);
+    }
+    // 011e: sub r1, r3
+    {
+        src = r[1];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 0120: mov r3, 0eda
+    {
+        src = r[3];
+        b = 0x0eda;
+        WR16(b, src);
+    }
+    // 0124: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        C = dst < src;
+    }
+    // 0126: mov r3, 0ed6
+    {
+        src = r[3];
+        b = 0x0ed6;
+        WR16(b, src);
+    }
+    // 012a: mov $18bc, r1
+    {
+        src = uint16_t(0x18bc);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x012e, L012e);
+L012e:
+    AOT_BLOCK(0x012e, 1);
+    // 012e: jsr pc, 020c
+    {
+        a = 0x020c;
+        r[6] -= 2;
+        WR16(r[6], 0x0132);
+    }
+    AOT_GOTO(0x020c, L020c);
+L0132:
+    AOT_BLOCK(0x0132, 3);
+    // 0132: add $4, r1
+    {
+        src = uint16_t(0x0004);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0136: cmp r1, 18ba
+    {
+        src = r[1];
+        b = 0x18ba;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 013a: bcs 012e
+    if (C)
+        AOT_GOTO(0x012e, L012e);
+    AOT_GOTO(0x013c, L013c);
+L013c:
+    AOT_BLOCK(0x013c, 2);
+    // 013c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 013e: jsr r5, 05a4
+    {
+        a = 0x05a4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0142;
+    }
+    AOT_GOTO(0x05a4, L05a4);
+L0142:
+    AOT_BLOCK(0x0142, 3);
+    // 0142: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+    }
+    // 0144: mov 0eda, r0
+    {
+        a = 0x0eda;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0148: jsr r5, 05a4
+    {
+        a = 0x05a4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x014c;
+    }
+    AOT_GOTO(0x05a4, L05a4);
+L014c:
+    AOT_BLOCK(0x014c, 3);
+    // 014c: mov *(r2)+, *-(sp)
+    {
+        a = RD16(r[2]);
+        r[2] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        WR16(b, src);
+    }
+    // 014e: mov $8, r2
+    {
+        src = uint16_t(0x0008);
+        r[2] = src;
+    }
+    // 0152: mov $ec4, r1
+    {
+        src = uint16_t(0x0ec4);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0156, L0156);
+L0156:
+    AOT_BLOCK(0x0156, 2);
+    // 0156: mov (r1)+, r0
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0158: jsr r5, 05c4
+    {
+        a = 0x05c4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x015c;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L015c:
+    AOT_BLOCK(0x015c, 3);
+    // 015c: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+    }
+    // 015e: dec r2
+    {
+        val = int(int16_t(r[2])) - 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0160: bne 0156
+    if (!Z)
+        AOT_GOTO(0x0156, L0156);
+    AOT_GOTO(0x0162, L0162);
+L0162:
+    AOT_BLOCK(0x0162, 1);
+    // 0162: jsr pc, 03fc
+    {
+        a = 0x03fc;
+        r[6] -= 2;
+        WR16(r[6], 0x0166);
+    }
+    AOT_GOTO(0x03fc, L03fc);
+L0166:
+    AOT_BLOCK(0x0166, 1);
+    // 0166: jsr r5, 05ec
+    {
+        a = 0x05ec;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x016a;
+    }
+    AOT_GOTO(0x05ec, L05ec);
+L016a:
+    AOT_BLOCK(0x016a, 2);
+    // 016a: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 016c: jsr r5, 05ec
+    {
+        a = 0x05ec;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0170;
+    }
+    AOT_GOTO(0x05ec, L05ec);
+L0170:
+    AOT_BLOCK(0x0170, 3);
+    // 0170: mov *(r2)+, *-(sp)
+    {
+        a = RD16(r[2]);
+        r[2] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        WR16(b, src);
+    }
+    // 0172: mov 1448, r0
+    {
+        a = 0x1448;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0176: mov r0, 1442
+    {
+        src = r[0];
+        b = 0x1442;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 017a: sys 13
+    AOT_INTERP(0x017a);
+L017c:
+    // 017c: halt
+    AOT_INTERP(0x017c);
+L017e:
+    // 017e: halt
+    AOT_INTERP(0x017e);
+L0180:
+    AOT_BLOCK(0x0180, 1);
+    // 0180: clr 1444
+    {
+        a = 0x1444;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0184, L0184);
+L0182:
+    AOT_BLOCK(0x0182, 1);
+    // 0182: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0184, L0184);
+L0184:
+    AOT_BLOCK(0x0184, 2);
+    // 0184: mov 0ee0, r0
+    {
+        a = 0x0ee0;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0188: jsr r5, 05a4
+    {
+        a = 0x05a4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x018c;
+    }
+    AOT_GOTO(0x05a4, L05a4);
+L018c:
+    AOT_BLOCK(0x018c, 2);
+    // 018c: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+    }
+    // 018e: mov $18bc, r1
+    {
+        src = uint16_t(0x18bc);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0192, L0192);
+L0192:
+    AOT_BLOCK(0x0192, 1);
+    // 0192: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x0196);
+    }
+    AOT_GOTO(0x064e, L064e);
+L0196:
+    AOT_BLOCK(0x0196, 1);
+    // 0196: bvs 01de
+    if (V)
+        AOT_GOTO(0x01de, L01de);
+    AOT_GOTO(0x0198, L0198);
+L0198:
+    AOT_BLOCK(0x0198, 2);
+    // 0198: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 019a: jsr r5, 05c4
+    {
+        a = 0x05c4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x019e;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L019e:
+    AOT_BLOCK(0x019e, 2);
+    // 019e: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01a0: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x01a4);
+    }
+    AOT_GOTO(0x064e, L064e);
+L01a4:
+    AOT_BLOCK(0x01a4, 2);
+    // 01a4: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01a6: jsr r5, 05c4
+    {
+        a = 0x05c4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01aa;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L01aa:
+    AOT_BLOCK(0x01aa, 2);
+    // 01aa: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01ac: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x01b0);
+    }
+    AOT_GOTO(0x064e, L064e);
+L01b0:
+    AOT_BLOCK(0x01b0, 2);
+    // 01b0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01b2: jsr r5, 05c4
+    {
+        a = 0x05c4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01b6;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L01b6:
+    AOT_BLOCK(0x01b6, 2);
+    // 01b6: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01b8: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x01bc);
+    }
+    AOT_GOTO(0x064e, L064e);
+L01bc:
+    AOT_BLOCK(0x01bc, 2);
+    // 01bc: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01be: jsr r5, 05c4
+    {
+        a = 0x05c4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01c2;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L01c2:
+    AOT_BLOCK(0x01c2, 3);
+    // 01c2: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+    }
+    // 01c4: mov (r1)+, r0
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01c6: jsr r5, 05c4
+    {
+        a = 0x05c4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01ca;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L01ca:
+    AOT_BLOCK(0x01ca, 3);
+    // 01ca: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+    }
+    // 01cc: mov (r1)+, r0
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01ce: jsr r5, 05c4
+    {
+        a = 0x05c4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01d2;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L01d2:
+    AOT_BLOCK(0x01d2, 2);
+    // 01d2: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01d4: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x01d8);
+    }
+    AOT_GOTO(0x064e, L064e);
+L01d8:
+    AOT_BLOCK(0x01d8, 1);
+    // 01d8: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x01dc);
+    }
+    AOT_GOTO(0x064e, L064e);
+L01dc:
+    AOT_BLOCK(0x01dc, 1);
+    // 01dc: br 0192
+    AOT_GOTO(0x0192, L0192);
+L01de:
+    AOT_BLOCK(0x01de, 1);
+    // 01de: jsr r5, 05ec
+    {
+        a = 0x05ec;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01e2;
+    }
+    AOT_GOTO(0x05ec, L05ec);
+L01e2:
+    AOT_BLOCK(0x01e2, 2);
+    // 01e2: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01e4: jmp 0e76
+    {
+        a = 0x0e76;
+    }
+    AOT_GOTO(0x0e76, L0e76);
+L01e8:
+    AOT_BLOCK(0x01e8, 1);
+    // 01e8: mov *0(r5), r5
+    {
+        a = RD16(r[5] + 0);
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x01ec, L01ec);
+L01ec:
+    AOT_BLOCK(0x01ec, 2);
+    // 01ec: movb (r5)+, 145a
+    {
+        a = r[5];
+        r[5] += 1;
+        src = RD8(a);
+        b = 0x145a;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 01f0: beq 01fe
+    if (Z)
+        AOT_GOTO(0x01fe, L01fe);
+    AOT_GOTO(0x01f2, L01f2);
+L01f2:
+    AOT_BLOCK(0x01f2, 1);
+    // 01f2: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01f6: sys 4
+    AOT_INTERP(0x01f6);
+L01f8:
+    AOT_BLOCK(0x01f8, 1);
+    // 01f8: mov (r1)+, *(r2)+
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        b = RD16(r[2]);
+        r[2] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x01fa, L01fa);
+L01fa:
+    // 01fa: wait
+    AOT_INTERP(0x01fa);
+L01fc:
+    AOT_BLOCK(0x01fc, 1);
+    // 01fc: br 01ec
+    AOT_GOTO(0x01ec, L01ec);
+L01fe:
+    AOT_BLOCK(0x01fe, 1);
+    // 01fe: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0202, L0202);
+L0200:
+    // 0200: wait
+    AOT_INTERP(0x0200);
+L0202:
+    // 0202: sys 4
+    AOT_INTERP(0x0202);
+L0204:
+    // 0204: (undefined)
+    AOT_INTERP(0x0204);
+L0206:
+    // 0206: rti
+    AOT_INTERP(0x0206);
+L0208:
+    AOT_BLOCK(0x0208, 1);
+    // 0208: jmp 0e76
+    {
+        a = 0x0e76;
+    }
+    AOT_GOTO(0x0e76, L0e76);
+L020a:
+    AOT_BLOCK(0x020a, 1);
+    // 020a: rol *-(r2)
+    {
+        r[2] -= 2;
+        a = RD16(r[2]);
+        src = RD16(a);
+        val = uint16_t(src << 1) | (C ? 1 : 0);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = (src & 0x8000) != 0;
+        V = ((val & 0x8000) != 0) != ((src & 0x8000) != 0);
+    }
+    AOT_GOTO(0x020c, L020c);
+L020c:
+    AOT_BLOCK(0x020c, 2);
+    // 020c: movb (r1), r0
+    {
+        a = r[1];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 020e: bne 0214
+    if (!Z)
+        AOT_GOTO(0x0214, L0214);
+    AOT_GOTO(0x0210, L0210);
+L0210:
+    AOT_BLOCK(0x0210, 1);
+    // 0210: bisb 1434, (r1)
+    {
+        a = 0x1434;
+        src = RD8(a);
+        b = r[1];
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0214, L0214);
+L0214:
+    AOT_BLOCK(0x0214, 3);
+    // 0214: bic $ffe0, r0
+    {
+        src = uint16_t(0xffe0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0218: cmp r0, $5
+    {
+        src = r[0];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 021c: bcc 0234
+    if (!C)
+        AOT_GOTO(0x0234, L0234);
+    AOT_GOTO(0x021e, L021e);
+L021e:
+    AOT_BLOCK(0x021e, 2);
+    // 021e: cmp r0, $3
+    {
+        src = r[0];
+        dst = uint16_t(0x0003);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0222: bcs 0234
+    if (C)
+        AOT_GOTO(0x0234, L0234);
+    AOT_GOTO(0x0224, L0224);
+L0224:
+    AOT_BLOCK(0x0224, 1);
+    // 0224: beq 022e
+    if (Z)
+        AOT_GOTO(0x022e, L022e);
+    AOT_GOTO(0x0226, L0226);
+L0226:
+    AOT_BLOCK(0x0226, 2);
+    // 0226: add 143e, 2(r1)
+    {
+        a = 0x143e;
+        src = RD16(a);
+        b = uint16_t(r[1] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 022c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L022e:
+    AOT_BLOCK(0x022e, 1);
+    // 022e: add 143c, 2(r1)
+    {
+        a = 0x143c;
+        src = RD16(a);
+        b = uint16_t(r[1] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0234, L0234);
+L0234:
+    AOT_BLOCK(0x0234, 1);
+    // 0234: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0236:
+    AOT_BLOCK(0x0236, 4);
+    // 0236: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0238: add $10, r1
+    {
+        src = uint16_t(0x0010);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 023c: cmp r1, 0e9e
+    {
+        src = r[1];
+        b = 0x0e9e;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0240: bcs 024c
+    if (C)
+        AOT_GOTO(0x024c, L024c);
+    AOT_GOTO(0x0242, L0242);
+L0242:
+    AOT_BLOCK(0x0242, 1);
+    // 0242: add $200, 0e9e
+    {
+        src = uint16_t(0x0200);
+        b = 0x0e9e;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0248: sys 0
+    AOT_INTERP(0x0248);
+L024a:
+    // 024a: (undefined)
+    AOT_INTERP(0x024a);
+L024c:
+    AOT_BLOCK(0x024c, 1);
+    // 024c: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x024e, L024e);
+L024e:
+    AOT_BLOCK(0x024e, 1);
+    // 024e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0250:
+    AOT_BLOCK(0x0250, 1);
+    // 0250: mov $1478, r4
+    {
+        src = uint16_t(0x1478);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0254, L0254);
+L0252:
+    AOT_BLOCK(0x0252, 2);
+    // 0252: mov (r1)+, *a14(r0)
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        b = RD16(r[0] + 2580);
+        WR16(b, src);
+    }
+    // 0256: cmp r4, $14a0
+    {
+        src = r[4];
+        dst = uint16_t(0x14a0);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x025a, L025a);
+L0254:
+    AOT_BLOCK(0x0254, 2);
+    // 0254: clr (r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+        WR16(a, 0);
+    }
+    // 0256: cmp r4, $14a0
+    {
+        src = r[4];
+        dst = uint16_t(0x14a0);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x025a, L025a);
+L025a:
+    AOT_BLOCK(0x025a, 1);
+    // 025a: bcs 0254
+    if (C)
+        AOT_GOTO(0x0254, L0254);
+    AOT_GOTO(0x025c, L025c);
+L025c:
+    AOT_BLOCK(0x025c, 3);
+    // 025c: mov 1446, 1442
+    {
+        a = 0x1446;
+        src = RD16(a);
+        b = 0x1442;
+        WR16(b, src);
+    }
+    // 0262: clr 1444
+    {
+        a = 0x1444;
+        WR16(a, 0);
+    }
+    // 0266: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0268, L0268);
+L0268:
+    AOT_BLOCK(0x0268, 1);
+    // 0268: jsr pc, 057c
+    {
+        a = 0x057c;
+        r[6] -= 2;
+        WR16(r[6], 0x026c);
+    }
+    AOT_GOTO(0x057c, L057c);
+L026c:
+    AOT_BLOCK(0x026c, 3);
+    // 026c: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+    }
+    // 026e: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0272: blt 0268
+    if (N ^ V)
+        AOT_GOTO(0x0268, L0268);
+    AOT_GOTO(0x0274, L0274);
+L0274:
+    AOT_BLOCK(0x0274, 1);
+    // 0274: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0276:
+    AOT_BLOCK(0x0276, 1);
+    // 0276: mov *0(r5), 0ea2
+    {
+        a = RD16(r[5] + 0);
+        src = RD16(a);
+        b = 0x0ea2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 027c: sys 0
+    AOT_INTERP(0x027c);
+L027e:
+    // 027e: (undefined)
+    AOT_INTERP(0x027e);
+L0280:
+    AOT_BLOCK(0x0280, 1);
+    // 0280: bcs 0286
+    if (C)
+        AOT_GOTO(0x0286, L0286);
+    AOT_GOTO(0x0282, L0282);
+L0282:
+    AOT_BLOCK(0x0282, 1);
+    // 0282: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0284, L0284);
+L0284:
+    AOT_BLOCK(0x0284, 1);
+    // 0284: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0286:
+    AOT_BLOCK(0x0286, 1);
+    // 0286: jmp 01e8
+    {
+        a = 0x01e8;
+    }
+    AOT_GOTO(0x01e8, L01e8);
+L028a:
+    AOT_BLOCK(0x028a, 2);
+    // 028a: cmp 0ee2, $4
+    {
+        a = 0x0ee2;
+        src = RD16(a);
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0290: beq 033e
+    if (Z)
+        AOT_GOTO(0x033e, L033e);
+    AOT_GOTO(0x0292, L0292);
+L0292:
+    AOT_BLOCK(0x0292, 2);
+    // 0292: bit $1, 0ee4
+    {
+        src = uint16_t(0x0001);
+        b = 0x0ee4;
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0298: bne 0330
+    if (!Z)
+        AOT_GOTO(0x0330, L0330);
+    AOT_GOTO(0x029a, L029a);
+L029a:
+    AOT_BLOCK(0x029a, 3);
+    // 029a: add $2, 0ee4
+    {
+        src = uint16_t(0x0002);
+        b = 0x0ee4;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 02a0: tstb 18b8
+    {
+        a = 0x18b8;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 02a4: beq 032e
+    if (Z)
+        AOT_GOTO(0x032e, L032e);
+    AOT_GOTO(0x02a6, L02a6);
+L02a6:
+    AOT_BLOCK(0x02a6, 6);
+    // 02a6: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 02a8: rol r3
+    {
+        src = r[3];
+        val = uint16_t(src << 1) | (C ? 1 : 0);
+        r[3] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 02aa: adc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+    }
+    // 02ac: asr r3
+    {
+        src = r[3];
+        val = int16_t(src) >> 1;
+        r[3] = val;
+    }
+    // 02ae: cmp r3, $20
+    {
+        src = r[3];
+        dst = uint16_t(0x0020);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02b2: bne 02ca
+    if (!Z)
+        AOT_GOTO(0x02ca, L02ca);
+    AOT_GOTO(0x02b4, L02b4);
+L02b4:
+    AOT_BLOCK(0x02b4, 6);
+    // 02b4: mov $1b6, 0e98
+    {
+        src = uint16_t(0x01b6);
+        b = 0x0e98;
+        WR16(b, src);
+    }
+    // 02ba: mov 1456, r3
+    {
+        a = 0x1456;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 02be: sub $18bc, r3
+    {
+        src = uint16_t(0x18bc);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 02c2: asl r3
+    {
+        src = r[3];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[3] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 02c4: bis $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 02c8: br 030e
+    AOT_GOTO(0x030e, L030e);
+L02ca:
+    AOT_BLOCK(0x02ca, 3);
+    // 02ca: bic $20, r3
+    {
+        src = uint16_t(0x0020);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+    }
+    // 02ce: cmp r3, $5
+    {
+        src = r[3];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02d2: bcs 02ea
+    if (C)
+        AOT_GOTO(0x02ea, L02ea);
+    AOT_GOTO(0x02d4, L02d4);
+L02d4:
+    AOT_BLOCK(0x02d4, 2);
+    // 02d4: cmp r3, $1b
+    {
+        src = r[3];
+        dst = uint16_t(0x001b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02d8: beq 02e0
+    if (Z)
+        AOT_GOTO(0x02e0, L02e0);
+    AOT_GOTO(0x02da, L02da);
+L02da:
+    AOT_BLOCK(0x02da, 2);
+    // 02da: cmp r3, $1c
+    {
+        src = r[3];
+        dst = uint16_t(0x001c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02de: bne 02e6
+    if (!Z)
+        AOT_GOTO(0x02e6, L02e6);
+    AOT_GOTO(0x02e0, L02e0);
+L02e0:
+    AOT_BLOCK(0x02e0, 1);
+    // 02e0: jsr r5, 0394
+    {
+        a = 0x0394;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x02e4;
+    }
+    AOT_GOTO(0x0394, L0394);
+L02e4:
+    AOT_BLOCK(0x02e4, 1);
+    // 02e4: jmp 15c3(r2)
+    {
+        a = uint16_t(r[2] + 5571);
+    }
+    AOT_JUMP(a);
+L02e6:
+    AOT_BLOCK(0x02e6, 1);
+    // 02e6: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x02ea, L02ea);
+L02ea:
+    AOT_BLOCK(0x02ea, 2);
+    // 02ea: cmp r3, $2
+    {
+        src = r[3];
+        dst = uint16_t(0x0002);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02ee: bcs 0300
+    if (C)
+        AOT_GOTO(0x0300, L0300);
+    AOT_GOTO(0x02f0, L02f0);
+L02f0:
+    AOT_BLOCK(0x02f0, 2);
+    // 02f0: cmp r3, $4
+    {
+        src = r[3];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02f4: bhi 0300
+    if (!(C | Z))
+        AOT_GOTO(0x0300, L0300);
+    AOT_GOTO(0x02f6, L02f6);
+L02f6:
+    AOT_BLOCK(0x02f6, 2);
+    // 02f6: tst (sp)
+    {
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 02f8: bne 0308
+    if (!Z)
+        AOT_GOTO(0x0308, L0308);
+    AOT_GOTO(0x02fa, L02fa);
+L02fa:
+    AOT_BLOCK(0x02fa, 2);
+    // 02fa: add 0ee8, r2
+    {
+        a = 0x0ee8;
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 02fe: br 0308
+    AOT_GOTO(0x0308, L0308);
+L0300:
+    AOT_BLOCK(0x0300, 2);
+    // 0300: tst (sp)
+    {
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0302: beq 0308
+    if (Z)
+        AOT_GOTO(0x0308, L0308);
+    AOT_GOTO(0x0304, L0304);
+L0304:
+    AOT_BLOCK(0x0304, 1);
+    // 0304: sub 0ee8, r2
+    {
+        a = 0x0ee8;
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0308, L0308);
+L0308:
+    AOT_BLOCK(0x0308, 2);
+    // 0308: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 030a: bpl 030e
+    if (!N)
+        AOT_GOTO(0x030e, L030e);
+    AOT_GOTO(0x030c, L030c);
+L030c:
+    AOT_BLOCK(0x030c, 1);
+    // 030c: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x030e, L030e);
+L030e:
+    AOT_BLOCK(0x030e, 4);
+    // 030e: asl r3
+    {
+        src = r[3];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[3] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0310: bis (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+    }
+    // 0312: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0314: jsr r5, 05c4
+    {
+        a = 0x05c4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0318;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L0318:
+    AOT_BLOCK(0x0318, 4);
+    // 0318: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+    }
+    // 031a: add $2, *0ec0
+    {
+        src = uint16_t(0x0002);
+        b = RD16(0x0ec0);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0320: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0322: jsr r5, 05c4
+    {
+        a = 0x05c4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0326;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L0326:
+    AOT_BLOCK(0x0326, 2);
+    // 0326: mov *(r2)+, *-(sp)
+    {
+        a = RD16(r[2]);
+        r[2] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        WR16(b, src);
+    }
+    // 0328: add $2, *0ec2
+    {
+        src = uint16_t(0x0002);
+        b = RD16(0x0ec2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x032e, L032e);
+L032e:
+    AOT_BLOCK(0x032e, 1);
+    // 032e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0330:
+    AOT_BLOCK(0x0330, 1);
+    // 0330: jsr r5, 0394
+    {
+        a = 0x0394;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0334;
+    }
+    AOT_GOTO(0x0394, L0394);
+L0334:
+    // 0334: jmp *-(pc)
+    AOT_INTERP(0x0334);
+L0336:
+    AOT_BLOCK(0x0336, 2);
+    // 0336: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0338: jsr pc, 0346
+    {
+        a = 0x0346;
+        r[6] -= 2;
+        WR16(r[6], 0x033c);
+    }
+    AOT_GOTO(0x0346, L0346);
+L033c:
+    AOT_BLOCK(0x033c, 1);
+    // 033c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L033e:
+    AOT_BLOCK(0x033e, 1);
+    // 033e: jsr r5, 0394
+    {
+        a = 0x0394;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0342;
+    }
+    AOT_GOTO(0x0394, L0394);
+L0342:
+    AOT_BLOCK(0x0342, 1);
+    // 0342: jmp *87(r0)
+    {
+        a = RD16(r[0] + 135);
+    }
+    AOT_JUMP(a);
+L0346:
+    AOT_BLOCK(0x0346, 2);
+    // 0346: cmp 0ee2, $4
+    {
+        a = 0x0ee2;
+        src = RD16(a);
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 034c: beq 033e
+    if (Z)
+        AOT_GOTO(0x033e, L033e);
+    AOT_GOTO(0x034e, L034e);
+L034e:
+    AOT_BLOCK(0x034e, 2);
+    // 034e: cmp r3, $1
+    {
+        src = r[3];
+        dst = uint16_t(0x0001);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0352: blos 035a
+    if (C | Z)
+        AOT_GOTO(0x035a, L035a);
+    AOT_GOTO(0x0354, L0354);
+L0354:
+    AOT_BLOCK(0x0354, 1);
+    // 0354: jsr r5, 0394
+    {
+        a = 0x0394;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0358;
+    }
+    AOT_GOTO(0x0394, L0394);
+L0358:
+    AOT_BLOCK(0x0358, 1);
+    // 0358: jmp -7409(r2)
+    {
+        a = uint16_t(r[2] + -29705);
+    }
+    AOT_JUMP(a);
+L035a:
+    AOT_BLOCK(0x035a, 2);
+    // 035a: tstb 18b8
+    {
+        a = 0x18b8;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 035e: beq 038e
+    if (Z)
+        AOT_GOTO(0x038e, L038e);
+    AOT_GOTO(0x0360, L0360);
+L0360:
+    AOT_BLOCK(0x0360, 3);
+    // 0360: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 0362: bit $1, 0ee4
+    {
+        src = uint16_t(0x0001);
+        b = 0x0ee4;
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0368: bne 0386
+    if (!Z)
+        AOT_GOTO(0x0386, L0386);
+    AOT_GOTO(0x036a, L036a);
+L036a:
+    AOT_BLOCK(0x036a, 1);
+    // 036a: jsr r5, 05c4
+    {
+        a = 0x05c4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x036e;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L036e:
+    AOT_BLOCK(0x036e, 3);
+    // 036e: mov (r2)+, *-(r0)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+    }
+    // 0370: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0372: jsr r5, 05c4
+    {
+        a = 0x05c4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0376;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L0376:
+    AOT_BLOCK(0x0376, 4);
+    // 0376: mov *(r2)+, *-(sp)
+    {
+        a = RD16(r[2]);
+        r[2] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        WR16(b, src);
+    }
+    // 0378: add $2, *0ec2
+    {
+        src = uint16_t(0x0002);
+        b = RD16(0x0ec2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 037e: add $2, *0ec0
+    {
+        src = uint16_t(0x0002);
+        b = RD16(0x0ec0);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0384: br 038e
+    AOT_GOTO(0x038e, L038e);
+L0386:
+    AOT_BLOCK(0x0386, 2);
+    // 0386: mov 14a8, r0
+    {
+        a = 0x14a8;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 038a: movb r2, -1(r0)
+    {
+        src = uint8_t(r[2]);
+        b = uint16_t(r[0] + -1);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x038e, L038e);
+L038e:
+    AOT_BLOCK(0x038e, 2);
+    // 038e: inc 0ee4
+    {
+        a = 0x0ee4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0392: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0394:
+    AOT_BLOCK(0x0394, 6);
+    // 0394: mov $1b6, 0e98
+    {
+        src = uint16_t(0x01b6);
+        b = 0x0e98;
+        WR16(b, src);
+    }
+    // 039a: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 039c: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 039e: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03a0: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03a2: mov $145e, r1
+    {
+        src = uint16_t(0x145e);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03a6, L03a6);
+L03a6:
+    AOT_BLOCK(0x03a6, 2);
+    // 03a6: movb (r1), 145a
+    {
+        a = r[1];
+        src = RD8(a);
+        b = 0x145a;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 03aa: beq 03ba
+    if (Z)
+        AOT_GOTO(0x03ba, L03ba);
+    AOT_GOTO(0x03ac, L03ac);
+L03ac:
+    AOT_BLOCK(0x03ac, 2);
+    // 03ac: clrb (r1)+
+    {
+        a = r[1];
+        r[1] += 1;
+        WR8(a, 0);
+        C = false;
+    }
+    // 03ae: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03b2: sys 4
+    AOT_INTERP(0x03b2);
+L03b4:
+    AOT_BLOCK(0x03b4, 1);
+    // 03b4: mov (r1)+, *(r2)+
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        b = RD16(r[2]);
+        r[2] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03b6, L03b6);
+L03b6:
+    // 03b6: wait
+    AOT_INTERP(0x03b6);
+L03b8:
+    AOT_BLOCK(0x03b8, 1);
+    // 03b8: br 03a6
+    AOT_GOTO(0x03a6, L03a6);
+L03ba:
+    AOT_BLOCK(0x03ba, 1);
+    // 03ba: mov (r5)+, r0
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03bc, L03bc);
+L03bc:
+    AOT_BLOCK(0x03bc, 4);
+    // 03bc: movb r0, 0ea6
+    {
+        src = uint8_t(r[0]);
+        b = 0x0ea6;
+        WR8(b, src);
+    }
+    // 03c0: mov 1474, r3
+    {
+        a = 0x1474;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 03c4: mov $eac, r0
+    {
+        src = uint16_t(0x0eac);
+        r[0] = src;
+    }
+    // 03c8: mov $4, r1
+    {
+        src = uint16_t(0x0004);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03cc, L03cc);
+L03cc:
+    AOT_BLOCK(0x03cc, 6);
+    // 03cc: clr r2
+    {
+        r[2] = 0;
+    }
+    // 03ce: div $a, r2
+    {
+        src = int16_t(uint16_t(0x000a));
+        if (src == 0 || abs(int16_t(r[2])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[2]) << 16) | r[3];
+        dst = val / src;
+        r[2] = dst;
+        r[3] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 03d2: add $30, r3
+    {
+        src = uint16_t(0x0030);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 03d6: movb r3, -(r0)
+    {
+        src = uint8_t(r[3]);
+        r[0] -= 1;
+        b = r[0];
+        WR8(b, src);
+    }
+    // 03d8: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03da: sob r1, 8
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x03cc, L03cc);
+    AOT_GOTO(0x03dc, L03dc);
+L03dc:
+    AOT_BLOCK(0x03dc, 1);
+    // 03dc: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03e0: sys 4
+    AOT_INTERP(0x03e0);
+L03e2:
+    // 03e2: (undefined)
+    AOT_INTERP(0x03e2);
+L03e4:
+    // 03e4: (undefined)
+    AOT_INTERP(0x03e4);
+L03e6:
+    AOT_BLOCK(0x03e6, 1);
+    // 03e6: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03e8, L03e8);
+L03e8:
+    AOT_BLOCK(0x03e8, 1);
+    // 03e8: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L03ea:
+    AOT_BLOCK(0x03ea, 3);
+    // 03ea: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 03ec: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03ee: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L03f0:
+    AOT_BLOCK(0x03f0, 2);
+    // 03f0: cmp r0, (r5)+
+    {
+        src = r[0];
+        b = r[5];
+        r[5] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03f2: blt 03f8
+    if (N ^ V)
+        AOT_GOTO(0x03f8, L03f8);
+    AOT_GOTO(0x03f4, L03f4);
+L03f4:
+    AOT_BLOCK(0x03f4, 2);
+    // 03f4: cmp (r5)+, r0
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03f6: blt 03fa
+    if (N ^ V)
+        AOT_GOTO(0x03fa, L03fa);
+    AOT_GOTO(0x03f8, L03f8);
+L03f8:
+    AOT_BLOCK(0x03f8, 1);
+    // 03f8: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x03fa, L03fa);
+L03fa:
+    AOT_BLOCK(0x03fa, 1);
+    // 03fa: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L03fc:
+    AOT_BLOCK(0x03fc, 1);
+    // 03fc: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x0400);
+    }
+    AOT_GOTO(0x0626, L0626);
+L0400:
+    AOT_BLOCK(0x0400, 2);
+    // 0400: cmp r4, $5
+    {
+        src = r[4];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0404: beq 043c
+    if (Z)
+        AOT_GOTO(0x043c, L043c);
+    AOT_GOTO(0x0406, L0406);
+L0406:
+    AOT_BLOCK(0x0406, 2);
+    // 0406: cmp r4, $3c
+    {
+        src = r[4];
+        dst = uint16_t(0x003c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 040a: beq 043c
+    if (Z)
+        AOT_GOTO(0x043c, L043c);
+    AOT_GOTO(0x040c, L040c);
+L040c:
+    AOT_BLOCK(0x040c, 1);
+    // 040c: jsr pc, 0564
+    {
+        a = 0x0564;
+        r[6] -= 2;
+        WR16(r[6], 0x0410);
+    }
+    AOT_GOTO(0x0564, L0564);
+L0410:
+    AOT_BLOCK(0x0410, 1);
+    // 0410: br 045a
+    AOT_GOTO(0x045a, L045a);
+L043c:
+    AOT_BLOCK(0x043c, 1);
+    // 043c: jsr pc, 068e
+    {
+        a = 0x068e;
+        r[6] -= 2;
+        WR16(r[6], 0x0440);
+    }
+    AOT_GOTO(0x068e, L068e);
+L0440:
+    AOT_BLOCK(0x0440, 2);
+    // 0440: tstb 18b8
+    {
+        a = 0x18b8;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0444: bne 045a
+    if (!Z)
+        AOT_GOTO(0x045a, L045a);
+    AOT_GOTO(0x0446, L0446);
+L0446:
+    AOT_BLOCK(0x0446, 4);
+    // 0446: movb 0ee2, r0
+    {
+        a = 0x0ee2;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 044a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 044c: cmp 0ee4, ec2(r0)
+    {
+        a = 0x0ee4;
+        src = RD16(a);
+        b = uint16_t(r[0] + 3778);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0452: blos 054e
+    if (C | Z)
+        AOT_GOTO(0x054e, L054e);
+    AOT_GOTO(0x0454, L0454);
+L0454:
+    AOT_BLOCK(0x0454, 1);
+    // 0454: mov 0ee4, ec2(r0)
+    {
+        a = 0x0ee4;
+        src = RD16(a);
+        b = uint16_t(r[0] + 3778);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x045a, L045a);
+L045a:
+    AOT_BLOCK(0x045a, 1);
+    // 045a: jmp 054e
+    {
+        a = 0x054e;
+    }
+    AOT_GOTO(0x054e, L054e);
+L0500:
+    AOT_BLOCK(0x0500, 2);
+    // 0500: cmp r3, $4
+    {
+        src = r[3];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0504: bne 050c
+    if (!Z)
+        AOT_GOTO(0x050c, L050c);
+    AOT_GOTO(0x0506, L0506);
+L0506:
+    AOT_BLOCK(0x0506, 2);
+    // 0506: mov r2, 0ee4
+    {
+        src = r[2];
+        b = 0x0ee4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 050a: br 0440
+    AOT_GOTO(0x0440, L0440);
+L050c:
+    AOT_BLOCK(0x050c, 2);
+    // 050c: sub 0ee4, r2
+    {
+        a = 0x0ee4;
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 0510: bmi 0528
+    if (N)
+        AOT_GOTO(0x0528, L0528);
+    AOT_GOTO(0x0512, L0512);
+L0512:
+    AOT_BLOCK(0x0512, 1);
+    // 0512: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0514, L0514);
+L0514:
+    AOT_BLOCK(0x0514, 2);
+    // 0514: dec (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0516: bmi 0524
+    if (N)
+        AOT_GOTO(0x0524, L0524);
+    AOT_GOTO(0x0518, L0518);
+L0518:
+    AOT_BLOCK(0x0518, 3);
+    // 0518: clr r2
+    {
+        r[2] = 0;
+        C = false;
+    }
+    // 051a: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 051e: jsr pc, 0346
+    {
+        a = 0x0346;
+        r[6] -= 2;
+        WR16(r[6], 0x0522);
+    }
+    AOT_GOTO(0x0346, L0346);
+L0522:
+    AOT_BLOCK(0x0522, 1);
+    // 0522: br 0514
+    AOT_GOTO(0x0514, L0514);
+L0524:
+    AOT_BLOCK(0x0524, 2);
+    // 0524: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0526: br 0440
+    AOT_GOTO(0x0440, L0440);
+L0528:
+    AOT_BLOCK(0x0528, 1);
+    // 0528: jsr r5, 0394
+    {
+        a = 0x0394;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x052c;
+    }
+    AOT_GOTO(0x0394, L0394);
+L052c:
+    // 052c: (undefined)
+    AOT_INTERP(0x052c);
+L052e:
+    AOT_BLOCK(0x052e, 1);
+    // 052e: br 054e
+    AOT_GOTO(0x054e, L054e);
+L054e:
+    AOT_BLOCK(0x054e, 2);
+    // 054e: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0552: beq 055c
+    if (Z)
+        AOT_GOTO(0x055c, L055c);
+    AOT_GOTO(0x0554, L0554);
+L0554:
+    AOT_BLOCK(0x0554, 2);
+    // 0554: cmp r4, $4
+    {
+        src = r[4];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0558: bne 0560
+    if (!Z)
+        AOT_GOTO(0x0560, L0560);
+    AOT_GOTO(0x055a, L055a);
+L055a:
+    AOT_BLOCK(0x055a, 1);
+    // 055a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L055c:
+    AOT_BLOCK(0x055c, 1);
+    // 055c: inc 1474
+    {
+        a = 0x1474;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0560, L0560);
+L0560:
+    AOT_BLOCK(0x0560, 1);
+    // 0560: jmp 03fc
+    {
+        a = 0x03fc;
+    }
+    AOT_GOTO(0x03fc, L03fc);
+L0564:
+    AOT_BLOCK(0x0564, 2);
+    // 0564: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0568: beq 057a
+    if (Z)
+        AOT_GOTO(0x057a, L057a);
+    AOT_GOTO(0x056a, L056a);
+L056a:
+    AOT_BLOCK(0x056a, 2);
+    // 056a: cmp r4, $3b
+    {
+        src = r[4];
+        dst = uint16_t(0x003b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 056e: beq 057a
+    if (Z)
+        AOT_GOTO(0x057a, L057a);
+    AOT_GOTO(0x0570, L0570);
+L0570:
+    AOT_BLOCK(0x0570, 2);
+    // 0570: cmp r4, $4
+    {
+        src = r[4];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0574: beq 057a
+    if (Z)
+        AOT_GOTO(0x057a, L057a);
+    AOT_GOTO(0x0576, L0576);
+L0576:
+    AOT_BLOCK(0x0576, 1);
+    // 0576: add $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x057a, L057a);
+L057a:
+    AOT_BLOCK(0x057a, 1);
+    // 057a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L057c:
+    AOT_BLOCK(0x057c, 4);
+    // 057c: asl r4
+    {
+        src = r[4];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[4] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 057e: mov 148c(r4), r1
+    {
+        a = uint16_t(r[4] + 5260);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0582: mov r1, 1478(r4)
+    {
+        src = r[1];
+        b = uint16_t(r[4] + 5240);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0586: bne 058e
+    if (!Z)
+        AOT_GOTO(0x058e, L058e);
+    AOT_GOTO(0x0588, L0588);
+L0588:
+    AOT_BLOCK(0x0588, 2);
+    // 0588: mov 1432, r1
+    {
+        a = 0x1432;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 058c: br 0592
+    AOT_GOTO(0x0592, L0592);
+L058e:
+    AOT_BLOCK(0x058e, 1);
+    // 058e: add $4, r1
+    {
+        src = uint16_t(0x0004);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0592, L0592);
+L0592:
+    AOT_BLOCK(0x0592, 2);
+    // 0592: cmpb 1(r1), r4
+    {
+        a = uint16_t(r[1] + 1);
+        src = RD8(a);
+        dst = uint8_t(r[4]);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0596: beq 059c
+    if (Z)
+        AOT_GOTO(0x059c, L059c);
+    AOT_GOTO(0x0598, L0598);
+L0598:
+    AOT_BLOCK(0x0598, 2);
+    // 0598: tst (r1)
+    {
+        a = r[1];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 059a: bpl 058e
+    if (!N)
+        AOT_GOTO(0x058e, L058e);
+    AOT_GOTO(0x059c, L059c);
+L059c:
+    AOT_BLOCK(0x059c, 3);
+    // 059c: mov r1, 148c(r4)
+    {
+        src = r[1];
+        b = uint16_t(r[4] + 5260);
+        WR16(b, src);
+    }
+    // 05a0: asr r4
+    {
+        src = r[4];
+        val = int16_t(src) >> 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 1) != 0;
+        V = (val < 0) != ((src & 1) != 0);
+    }
+    // 05a2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L05a4:
+    AOT_BLOCK(0x05a4, 13);
+    // 05a4: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05a6: mov (r5)+, r1
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 05a8: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 05aa: bic $fe00, r0
+    {
+        src = uint16_t(0xfe00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 05ae: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 05b0: add $6, r0
+    {
+        src = uint16_t(0x0006);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 05b4: mov r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 05b6: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 05b8: add $204, r0
+    {
+        src = uint16_t(0x0204);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 05bc: mov r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 05be: mov r2, (r1)+
+    {
+        src = r[2];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 05c0: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05c2: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L05c4:
+    AOT_BLOCK(0x05c4, 6);
+    // 05c4: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05c6: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05c8: mov (r5)+, r2
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 05ca: mov (r2)+, r1
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 05cc: cmp r1, (r2)
+    {
+        src = r[1];
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05ce: bcc 05d6
+    if (!C)
+        AOT_GOTO(0x05d6, L05d6);
+    AOT_GOTO(0x05d0, L05d0);
+L05d0:
+    AOT_BLOCK(0x05d0, 3);
+    // 05d0: mov r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 05d2: mov r1, -(r2)
+    {
+        src = r[1];
+        r[2] -= 2;
+        b = r[2];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05d4: br 05e6
+    AOT_GOTO(0x05e6, L05e6);
+L05d6:
+    AOT_BLOCK(0x05d6, 3);
+    // 05d6: tst (r2)+
+    {
+        a = r[2];
+        r[2] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 05d8: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05da: jsr r5, 05f0
+    {
+        a = 0x05f0;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x05de;
+    }
+    AOT_GOTO(0x05f0, L05f0);
+L05de:
+    AOT_BLOCK(0x05de, 3);
+    // 05de: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 05e0: mov r0, *(r2)+
+    {
+        src = r[0];
+        b = RD16(r[2]);
+        r[2] += 2;
+        WR16(b, src);
+    }
+    // 05e2: add $2, -(r2)
+    {
+        src = uint16_t(0x0002);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x05e6, L05e6);
+L05e6:
+    AOT_BLOCK(0x05e6, 3);
+    // 05e6: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 05e8: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05ea: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L05ec:
+    AOT_BLOCK(0x05ec, 2);
+    // 05ec: mov (r5)+, r2
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 05ee: cmp (r2)+, (r2)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x05f0, L05f0);
+L05f0:
+    AOT_BLOCK(0x05f0, 3);
+    // 05f0: mov (r2)+, r1
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 05f2: mov r1, 0eb0
+    {
+        src = r[1];
+        b = 0x0eb0;
+        WR16(b, src);
+    }
+    // 05f6: mov 1458, r0
+    {
+        a = 0x1458;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05fa: sys 0
+    AOT_INTERP(0x05fa);
+L05fc:
+    // 05fc: (undefined)
+    AOT_INTERP(0x05fc);
+L05fe:
+    AOT_BLOCK(0x05fe, 1);
+    // 05fe: bic $fe00, r1
+    {
+        src = uint16_t(0xfe00);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0602, L0602);
+L0600:
+    // 0600: (undefined)
+    AOT_INTERP(0x0600);
+L0602:
+    AOT_BLOCK(0x0602, 1);
+    // 0602: add r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0604, L0604);
+L0604:
+    AOT_BLOCK(0x0604, 10);
+    // 0604: mov r1, 0eb6
+    {
+        src = r[1];
+        b = 0x0eb6;
+        WR16(b, src);
+    }
+    // 0608: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 060a: bis $1ff, -(r2)
+    {
+        src = uint16_t(0x01ff);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 060e: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0610: cmp -(r2), -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0612: sub (r2), r1
+    {
+        a = r[2];
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+    }
+    // 0614: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 0616: mov r1, 0eb8
+    {
+        src = r[1];
+        b = 0x0eb8;
+        WR16(b, src);
+    }
+    // 061a: mov r0, (r2)
+    {
+        src = r[0];
+        b = r[2];
+        WR16(b, src);
+    }
+    // 061c: mov 1458, r0
+    {
+        a = 0x1458;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0620: sys 0
+    AOT_INTERP(0x0620);
+L0622:
+    // 0622: (undefined)
+    AOT_INTERP(0x0622);
+L0624:
+    AOT_BLOCK(0x0624, 1);
+    // 0624: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0626:
+    AOT_BLOCK(0x0626, 1);
+    // 0626: mov 1476, r4
+    {
+        a = 0x1476;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x062a, L062a);
+L0628:
+    // 0628: (undefined)
+    AOT_INTERP(0x0628);
+L062a:
+    AOT_BLOCK(0x062a, 1);
+    // 062a: beq 0632
+    if (Z)
+        AOT_GOTO(0x0632, L0632);
+    AOT_GOTO(0x062c, L062c);
+L062c:
+    AOT_BLOCK(0x062c, 2);
+    // 062c: clr 1476
+    {
+        a = 0x1476;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0630: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0632:
+    AOT_BLOCK(0x0632, 1);
+    // 0632: jsr pc, 065a
+    {
+        a = 0x065a;
+        r[6] -= 2;
+        WR16(r[6], 0x0636);
+    }
+    AOT_GOTO(0x065a, L065a);
+L0636:
+    AOT_BLOCK(0x0636, 2);
+    // 0636: cmp r4, $80
+    {
+        src = r[4];
+        dst = uint16_t(0x0080);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 063a: bcs 064c
+    if (C)
+        AOT_GOTO(0x064c, L064c);
+    AOT_GOTO(0x063c, L063c);
+L063c:
+    AOT_BLOCK(0x063c, 2);
+    // 063c: cmp r4, $800
+    {
+        src = r[4];
+        dst = uint16_t(0x0800);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0640: bcs 0648
+    if (C)
+        AOT_GOTO(0x0648, L0648);
+    AOT_GOTO(0x0642, L0642);
+L0642:
+    AOT_BLOCK(0x0642, 2);
+    // 0642: add $10bc, r4
+    {
+        src = uint16_t(0x10bc);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0646: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0648:
+    AOT_BLOCK(0x0648, 1);
+    // 0648: add $ce2, r4
+    {
+        src = uint16_t(0x0ce2);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x064c, L064c);
+L064c:
+    AOT_BLOCK(0x064c, 1);
+    // 064c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L064e:
+    AOT_BLOCK(0x064e, 2);
+    // 064e: mov 1476, r4
+    {
+        a = 0x1476;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0652: beq 065a
+    if (Z)
+        AOT_GOTO(0x065a, L065a);
+    AOT_GOTO(0x0654, L0654);
+L0654:
+    AOT_BLOCK(0x0654, 2);
+    // 0654: clr 1476
+    {
+        a = 0x1476;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0658: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L065a:
+    AOT_BLOCK(0x065a, 2);
+    // 065a: dec 1444
+    {
+        a = 0x1444;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 065e: bgt 0682
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0682, L0682);
+    AOT_GOTO(0x0660, L0660);
+L0660:
+    AOT_BLOCK(0x0660, 1);
+    // 0660: movb 1442, r0
+    {
+        a = 0x1442;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0664: sys 3
+    AOT_INTERP(0x0664);
+L0666:
+    AOT_BLOCK(0x0666, 1);
+    // 0666: mov sp, *-(sp)
+    {
+        src = r[6];
+        r[6] -= 2;
+        b = RD16(r[6]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0668, L0668);
+L0668:
+    AOT_BLOCK(0x0668, 1);
+    // 0668: bne 066a
+    if (!Z)
+        AOT_GOTO(0x066a, L066a);
+    AOT_GOTO(0x066a, L066a);
+L066a:
+    AOT_BLOCK(0x066a, 1);
+    // 066a: bcs 0674
+    if (C)
+        AOT_GOTO(0x0674, L0674);
+    AOT_GOTO(0x066c, L066c);
+L066c:
+    AOT_BLOCK(0x066c, 1);
+    // 066c: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 1) != 0;
+        V = (val < 0) != ((src & 1) != 0);
+    }
+    AOT_GOTO(0x066e, L066e);
+L066e:
+    AOT_BLOCK(0x066e, 1);
+    // 066e: mov r0, 1444
+    {
+        src = r[0];
+        b = 0x1444;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0672, L0672);
+L0672:
+    AOT_BLOCK(0x0672, 1);
+    // 0672: bne 067c
+    if (!Z)
+        AOT_GOTO(0x067c, L067c);
+    AOT_GOTO(0x0674, L0674);
+L0674:
+    AOT_BLOCK(0x0674, 1);
+    // 0674: mov $4, r4
+    {
+        src = uint16_t(0x0004);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0678, L0678);
+L0676:
+    // 0676: iot
+    AOT_INTERP(0x0676);
+L0678:
+    AOT_BLOCK(0x0678, 2);
+    // 0678: sev
+    {
+        V = true;
+    }
+    // 067a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L067c:
+    AOT_BLOCK(0x067c, 1);
+    // 067c: mov $11ae, 14a6
+    {
+        src = uint16_t(0x11ae);
+        b = 0x14a6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0682, L0682);
+L0682:
+    AOT_BLOCK(0x0682, 3);
+    // 0682: mov *14a6, r4
+    {
+        a = RD16(0x14a6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0686: add $2, 14a6
+    {
+        src = uint16_t(0x0002);
+        b = 0x14a6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 068c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L068e:
+    AOT_BLOCK(0x068e, 2);
+    // 068e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0690: jsr r5, 03f0
+    {
+        a = 0x03f0;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0694;
+    }
+    AOT_GOTO(0x03f0, L03f0);
+L0694:
+    // 0694: halt
+    AOT_INTERP(0x0694);
+L0696:
+    AOT_BLOCK(0x0696, 1);
+    // 0696: jmp *07a8
+    {
+        a = RD16(0x07a8);
+    }
+    AOT_JUMP(a);
+L06ac:
+    AOT_BLOCK(0x06ac, 1);
+    // 06ac: jsr pc, 0bb2
+    {
+        a = 0x0bb2;
+        r[6] -= 2;
+        WR16(r[6], 0x06b0);
+    }
+    AOT_GOTO(0x0bb2, L0bb2);
+L06b0:
+    AOT_BLOCK(0x06b0, 1);
+    // 06b0: jsr pc, 028a
+    {
+        a = 0x028a;
+        r[6] -= 2;
+        WR16(r[6], 0x06b4);
+    }
+    AOT_GOTO(0x028a, L028a);
+L06b4:
+    AOT_BLOCK(0x06b4, 1);
+    // 06b4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06d2:
+    AOT_BLOCK(0x06d2, 1);
+    // 06d2: br 06ac
+    AOT_GOTO(0x06ac, L06ac);
+L06d4:
+    AOT_BLOCK(0x06d4, 3);
+    // 06d4: mov 2(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06d8: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06da: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x06de);
+    }
+    AOT_GOTO(0x0626, L0626);
+L06de:
+    AOT_BLOCK(0x06de, 6);
+    // 06de: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 06e0: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 06e2: mov $144a, r5
+    {
+        src = uint16_t(0x144a);
+        r[5] = src;
+    }
+    // 06e6: clr 18b4
+    {
+        a = 0x18b4;
+        WR16(a, 0);
+        C = false;
+    }
+    // 06ea: mov $ffff, 18b6
+    {
+        src = uint16_t(0xffff);
+        b = 0x18b6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06f0: jmp *6ea(r0)
+    {
+        a = RD16(r[0] + 1770);
+    }
+    AOT_JUMP(a);
+L0700:
+    AOT_BLOCK(0x0700, 1);
+    // 0700: ble 07d2
+    if (Z || (N ^ V))
+        AOT_GOTO(0x07d2, L07d2);
+    AOT_GOTO(0x0702, L0702);
+L0702:
+    AOT_BLOCK(0x0702, 1);
+    // 0702: ble 07c0
+    if (Z || (N ^ V))
+        AOT_GOTO(0x07c0, L07c0);
+    AOT_GOTO(0x0704, L0704);
+L0704:
+    AOT_BLOCK(0x0704, 1);
+    // 0704: ble 0672
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0672, L0672);
+    AOT_GOTO(0x0706, L0706);
+L0706:
+    AOT_BLOCK(0x0706, 1);
+    // 0706: jsr r3, -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x0708;
+    }
+    AOT_JUMP(a);
+L0708:
+    AOT_BLOCK(0x0708, 1);
+    // 0708: jsr r3, *916(r2)
+    {
+        a = RD16(r[2] + 2326);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x070c;
+    }
+    AOT_JUMP(a);
+L070c:
+    AOT_BLOCK(0x070c, 1);
+    // 070c: jsr r4, *93c(r0)
+    {
+        a = RD16(r[0] + 2364);
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[4] = 0x0710;
+    }
+    AOT_JUMP(a);
+L0710:
+    // 0710: jsr r5, r0
+    AOT_INTERP(0x0710);
+L0712:
+    AOT_BLOCK(0x0712, 1);
+    // 0712: bgt 0668
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0668, L0668);
+    AOT_GOTO(0x0714, L0714);
+L0714:
+    AOT_BLOCK(0x0714, 1);
+    // 0714: jsr r5, *(sp)+
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0716;
+    }
+    AOT_JUMP(a);
+L0716:
+    AOT_BLOCK(0x0716, 1);
+    // 0716: jsr r5, *(sp)+
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0718;
+    }
+    AOT_JUMP(a);
+L0718:
+    AOT_BLOCK(0x0718, 1);
+    // 0718: jsr r5, *(sp)+
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x071a;
+    }
+    AOT_JUMP(a);
+L071a:
+    AOT_BLOCK(0x071a, 1);
+    // 071a: ble 07c0
+    if (Z || (N ^ V))
+        AOT_GOTO(0x07c0, L07c0);
+    AOT_GOTO(0x071c, L071c);
+L071c:
+    AOT_BLOCK(0x071c, 1);
+    // 071c: jsr r0, *9c0(r0)
+    {
+        a = RD16(r[0] + 2496);
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x0720;
+    }
+    AOT_JUMP(a);
+L0720:
+    AOT_BLOCK(0x0720, 1);
+    // 0720: bgt 0676
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0676, L0676);
+    AOT_GOTO(0x0722, L0722);
+L0722:
+    AOT_BLOCK(0x0722, 1);
+    // 0722: bgt 0678
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0678, L0678);
+    AOT_GOTO(0x0724, L0724);
+L0724:
+    AOT_BLOCK(0x0724, 1);
+    // 0724: ble 06d2
+    if (Z || (N ^ V))
+        AOT_GOTO(0x06d2, L06d2);
+    AOT_GOTO(0x0726, L0726);
+L0726:
+    AOT_BLOCK(0x0726, 1);
+    // 0726: ble 06d4
+    if (Z || (N ^ V))
+        AOT_GOTO(0x06d4, L06d4);
+    AOT_GOTO(0x0728, L0728);
+L0728:
+    AOT_BLOCK(0x0728, 3);
+    // 0728: mov $1, 1474
+    {
+        src = uint16_t(0x0001);
+        b = 0x1474;
+        WR16(b, src);
+    }
+    // 072e: mov $10, -(sp)
+    {
+        src = uint16_t(0x0010);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0732: mov $145e, r1
+    {
+        src = uint16_t(0x145e);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0736, L0736);
+L0736:
+    AOT_BLOCK(0x0736, 1);
+    // 0736: jsr pc, 064e
+    {
+        a = 0x064e;
+        r[6] -= 2;
+        WR16(r[6], 0x073a);
+    }
+    AOT_GOTO(0x064e, L064e);
+L073a:
+    AOT_BLOCK(0x073a, 2);
+    // 073a: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 073c: bmi 0748
+    if (N)
+        AOT_GOTO(0x0748, L0748);
+    AOT_GOTO(0x073e, L073e);
+L073e:
+    AOT_BLOCK(0x073e, 3);
+    // 073e: movb r4, (r1)+
+    {
+        src = uint8_t(r[4]);
+        b = r[1];
+        r[1] += 1;
+        WR8(b, src);
+    }
+    // 0740: dec (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0742: bgt 0736
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0736, L0736);
+    AOT_GOTO(0x0744, L0744);
+L0744:
+    AOT_BLOCK(0x0744, 2);
+    // 0744: tstb -(r1)
+    {
+        r[1] -= 1;
+        a = r[1];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0746: br 0736
+    AOT_GOTO(0x0736, L0736);
+L0748:
+    AOT_BLOCK(0x0748, 4);
+    // 0748: movb $a, (r1)+
+    {
+        src = uint8_t(0x0a);
+        b = r[1];
+        r[1] += 1;
+        WR8(b, src);
+    }
+    // 074c: clrb (r1)+
+    {
+        a = r[1];
+        r[1] += 1;
+        WR8(a, 0);
+    }
+    // 074e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0750: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L076c:
+    AOT_BLOCK(0x076c, 2);
+    // 076c: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 076e: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x0772);
+    }
+    AOT_GOTO(0x0626, L0626);
+L0772:
+    AOT_BLOCK(0x0772, 1);
+    // 0772: jsr pc, 09e8
+    {
+        a = 0x09e8;
+        r[6] -= 2;
+        WR16(r[6], 0x0776);
+    }
+    AOT_GOTO(0x09e8, L09e8);
+L0776:
+    AOT_BLOCK(0x0776, 2);
+    // 0776: tst 18b4
+    {
+        a = 0x18b4;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 077a: beq 0782
+    if (Z)
+        AOT_GOTO(0x0782, L0782);
+    AOT_GOTO(0x077c, L077c);
+L077c:
+    AOT_BLOCK(0x077c, 3);
+    // 077c: mov (sp), r0
+    {
+        a = r[6];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 077e: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0780: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0782, L0782);
+L0782:
+    AOT_BLOCK(0x0782, 5);
+    // 0782: swab (sp)
+    {
+        a = r[6];
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+    }
+    // 0784: asr (sp)
+    {
+        a = r[6];
+        src = RD16(a);
+        val = int16_t(src) >> 1;
+        WR16(a, val);
+    }
+    // 0786: asr (sp)
+    {
+        a = r[6];
+        src = RD16(a);
+        val = int16_t(src) >> 1;
+        WR16(a, val);
+    }
+    // 0788: cmp (sp), 18b6
+    {
+        a = r[6];
+        src = RD16(a);
+        b = 0x18b6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 078c: bcs 0794
+    if (C)
+        AOT_GOTO(0x0794, L0794);
+    AOT_GOTO(0x078e, L078e);
+L078e:
+    AOT_BLOCK(0x078e, 1);
+    // 078e: jsr r5, 0394
+    {
+        a = 0x0394;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0792;
+    }
+    AOT_GOTO(0x0394, L0394);
+L0792:
+    AOT_BLOCK(0x0792, 1);
+    // 0792: jmp *5582(r0)
+    {
+        a = RD16(r[0] + 21890);
+    }
+    AOT_JUMP(a);
+L0794:
+    AOT_BLOCK(0x0794, 4);
+    // 0794: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0796: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0798: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 079a: jsr pc, 028a
+    {
+        a = 0x028a;
+        r[6] -= 2;
+        WR16(r[6], 0x079e);
+    }
+    AOT_GOTO(0x028a, L028a);
+L079e:
+    AOT_BLOCK(0x079e, 1);
+    // 079e: mov $144a, r1
+    {
+        src = uint16_t(0x144a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x07a2, L07a2);
+L07a2:
+    AOT_BLOCK(0x07a2, 2);
+    // 07a2: cmp r1, r5
+    {
+        src = r[1];
+        dst = r[5];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07a4: bcc 07b4
+    if (!C)
+        AOT_GOTO(0x07b4, L07b4);
+    AOT_GOTO(0x07a6, L07a6);
+L07a6:
+    AOT_BLOCK(0x07a6, 4);
+    // 07a6: mov (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 07a8: mov (r1)+, r3
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 07aa: mov (r1)+, 1456
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        b = 0x1456;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07ae: jsr pc, 028a
+    {
+        a = 0x028a;
+        r[6] -= 2;
+        WR16(r[6], 0x07b2);
+    }
+    AOT_GOTO(0x028a, L028a);
+L07b2:
+    AOT_BLOCK(0x07b2, 1);
+    // 07b2: br 07a2
+    AOT_GOTO(0x07a2, L07a2);
+L07b4:
+    AOT_BLOCK(0x07b4, 1);
+    // 07b4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L07c0:
+    AOT_BLOCK(0x07c0, 1);
+    // 07c0: jsr pc, 09e8
+    {
+        a = 0x09e8;
+        r[6] -= 2;
+        WR16(r[6], 0x07c4);
+    }
+    AOT_GOTO(0x09e8, L09e8);
+L07c4:
+    AOT_BLOCK(0x07c4, 2);
+    // 07c4: cmp r2, $4
+    {
+        src = r[2];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07c8: bcs 07d0
+    if (C)
+        AOT_GOTO(0x07d0, L07d0);
+    AOT_GOTO(0x07ca, L07ca);
+L07ca:
+    AOT_BLOCK(0x07ca, 2);
+    // 07ca: inc 18b4
+    {
+        a = 0x18b4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 07ce: br 076c
+    AOT_GOTO(0x076c, L076c);
+L07d0:
+    AOT_BLOCK(0x07d0, 1);
+    // 07d0: mov $f800, (sp)
+    {
+        src = uint16_t(0xf800);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x07d4, L07d4);
+L07d2:
+    // 07d2: (undefined)
+    AOT_INTERP(0x07d2);
+L07d4:
+    AOT_BLOCK(0x07d4, 1);
+    // 07d4: br 076c
+    AOT_GOTO(0x076c, L076c);
+L0800:
+    AOT_BLOCK(0x0800, 1);
+    // 0800: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L09e8:
+    AOT_BLOCK(0x09e8, 1);
+    // 09e8: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x09ea, L09ea);
+L09ea:
+    AOT_BLOCK(0x09ea, 2);
+    // 09ea: cmp r4, $28
+    {
+        src = r[4];
+        dst = uint16_t(0x0028);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09ee: beq 0a6c
+    if (Z)
+        AOT_GOTO(0x0a6c, L0a6c);
+    AOT_GOTO(0x09f0, L09f0);
+L09f0:
+    AOT_BLOCK(0x09f0, 2);
+    // 09f0: cmp r4, $2d
+    {
+        src = r[4];
+        dst = uint16_t(0x002d);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09f4: beq 0aa6
+    if (Z)
+        AOT_GOTO(0x0aa6, L0aa6);
+    AOT_GOTO(0x09f6, L09f6);
+L09f6:
+    AOT_BLOCK(0x09f6, 2);
+    // 09f6: cmp r4, $24
+    {
+        src = r[4];
+        dst = uint16_t(0x0024);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09fa: beq 0ad2
+    if (Z)
+        AOT_GOTO(0x0ad2, L0ad2);
+    AOT_GOTO(0x09fc, L09fc);
+L09fc:
+    AOT_BLOCK(0x09fc, 1);
+    // 09fc: cmp r4, $2a
+    {
+        src = r[4];
+        dst = uint16_t(0x002a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0a00, L0a00);
+L0a00:
+    AOT_BLOCK(0x0a00, 1);
+    // 0a00: bne 0a06
+    if (!Z)
+        AOT_GOTO(0x0a06, L0a06);
+    AOT_GOTO(0x0a02, L0a02);
+L0a02:
+    AOT_BLOCK(0x0a02, 1);
+    // 0a02: jmp 0aea
+    {
+        a = 0x0aea;
+    }
+    AOT_GOTO(0x0aea, L0aea);
+L0a06:
+    AOT_BLOCK(0x0a06, 1);
+    // 0a06: jsr pc, 0bb2
+    {
+        a = 0x0bb2;
+        r[6] -= 2;
+        WR16(r[6], 0x0a0a);
+    }
+    AOT_GOTO(0x0bb2, L0bb2);
+L0a0a:
+    AOT_BLOCK(0x0a0a, 2);
+    // 0a0a: cmp r4, $28
+    {
+        src = r[4];
+        dst = uint16_t(0x0028);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a0e: bne 0a30
+    if (!Z)
+        AOT_GOTO(0x0a30, L0a30);
+    AOT_GOTO(0x0a10, L0a10);
+L0a10:
+    AOT_BLOCK(0x0a10, 1);
+    // 0a10: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x0a14);
+    }
+    AOT_GOTO(0x0626, L0626);
+L0a14:
+    AOT_BLOCK(0x0a14, 4);
+    // 0a14: mov r2, (r5)+
+    {
+        src = r[2];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0a16: mov r3, (r5)+
+    {
+        src = r[3];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0a18: mov 1456, (r5)+
+    {
+        a = 0x1456;
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a1c: jsr pc, 0bb2
+    {
+        a = 0x0bb2;
+        r[6] -= 2;
+        WR16(r[6], 0x0a20);
+    }
+    AOT_GOTO(0x0bb2, L0bb2);
+L0a20:
+    AOT_BLOCK(0x0a20, 1);
+    // 0a20: jsr pc, 0b08
+    {
+        a = 0x0b08;
+        r[6] -= 2;
+        WR16(r[6], 0x0a24);
+    }
+    AOT_GOTO(0x0b08, L0b08);
+L0a24:
+    AOT_BLOCK(0x0a24, 1);
+    // 0a24: jsr pc, 0b2e
+    {
+        a = 0x0b2e;
+        r[6] -= 2;
+        WR16(r[6], 0x0a28);
+    }
+    AOT_GOTO(0x0b2e, L0b2e);
+L0a28:
+    AOT_BLOCK(0x0a28, 3);
+    // 0a28: bis $30, r2
+    {
+        src = uint16_t(0x0030);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0a2c: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0a2e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a30:
+    AOT_BLOCK(0x0a30, 2);
+    // 0a30: cmp r3, $14
+    {
+        src = r[3];
+        dst = uint16_t(0x0014);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a34: bne 0a3e
+    if (!Z)
+        AOT_GOTO(0x0a3e, L0a3e);
+    AOT_GOTO(0x0a36, L0a36);
+L0a36:
+    AOT_BLOCK(0x0a36, 1);
+    // 0a36: jsr pc, 0b08
+    {
+        a = 0x0b08;
+        r[6] -= 2;
+        WR16(r[6], 0x0a3a);
+    }
+    AOT_GOTO(0x0b08, L0b08);
+L0a3a:
+    AOT_BLOCK(0x0a3a, 2);
+    // 0a3a: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0a3c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a3e:
+    AOT_BLOCK(0x0a3e, 1);
+    // 0a3e: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a40, L0a40);
+L0a40:
+    AOT_BLOCK(0x0a40, 7);
+    // 0a40: bic $20, r3
+    {
+        src = uint16_t(0x0020);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+    }
+    // 0a44: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0a46: bis $8000, r3
+    {
+        src = uint16_t(0x8000);
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+    }
+    // 0a4a: sub 0ee4, r2
+    {
+        a = 0x0ee4;
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+    }
+    // 0a4e: sub $4, r2
+    {
+        src = uint16_t(0x0004);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+    }
+    // 0a52: cmp r5, $144a
+    {
+        src = r[5];
+        dst = uint16_t(0x144a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a56: beq 0a5c
+    if (Z)
+        AOT_GOTO(0x0a5c, L0a5c);
+    AOT_GOTO(0x0a58, L0a58);
+L0a58:
+    AOT_BLOCK(0x0a58, 1);
+    // 0a58: sub $2, r2
+    {
+        src = uint16_t(0x0002);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0a5c, L0a5c);
+L0a5c:
+    AOT_BLOCK(0x0a5c, 6);
+    // 0a5c: mov r2, (r5)+
+    {
+        src = r[2];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0a5e: mov r3, (r5)+
+    {
+        src = r[3];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0a60: mov 1456, (r5)+
+    {
+        a = 0x1456;
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0a64: mov $37, r2
+    {
+        src = uint16_t(0x0037);
+        r[2] = src;
+    }
+    // 0a68: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0a6a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a6c:
+    AOT_BLOCK(0x0a6c, 1);
+    // 0a6c: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x0a70);
+    }
+    AOT_GOTO(0x0626, L0626);
+L0a70:
+    AOT_BLOCK(0x0a70, 1);
+    // 0a70: jsr pc, 0bb2
+    {
+        a = 0x0bb2;
+        r[6] -= 2;
+        WR16(r[6], 0x0a74);
+    }
+    AOT_GOTO(0x0bb2, L0bb2);
+L0a74:
+    AOT_BLOCK(0x0a74, 1);
+    // 0a74: jsr pc, 0b2e
+    {
+        a = 0x0b2e;
+        r[6] -= 2;
+        WR16(r[6], 0x0a78);
+    }
+    AOT_GOTO(0x0b2e, L0b2e);
+L0a78:
+    AOT_BLOCK(0x0a78, 1);
+    // 0a78: jsr pc, 0b08
+    {
+        a = 0x0b08;
+        r[6] -= 2;
+        WR16(r[6], 0x0a7c);
+    }
+    AOT_GOTO(0x0b08, L0b08);
+L0a7c:
+    AOT_BLOCK(0x0a7c, 1);
+    // 0a7c: cmp r4, $2b
+    {
+        src = r[4];
+        dst = uint16_t(0x002b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0a80, L0a80);
+L0a80:
+    AOT_BLOCK(0x0a80, 1);
+    // 0a80: beq 0a9a
+    if (Z)
+        AOT_GOTO(0x0a9a, L0a9a);
+    AOT_GOTO(0x0a82, L0a82);
+L0a82:
+    AOT_BLOCK(0x0a82, 2);
+    // 0a82: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a84: beq 0a94
+    if (Z)
+        AOT_GOTO(0x0a94, L0a94);
+    AOT_GOTO(0x0a86, L0a86);
+L0a86:
+    AOT_BLOCK(0x0a86, 5);
+    // 0a86: bis $38, r2
+    {
+        src = uint16_t(0x0038);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0a8a: clr (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        WR16(a, 0);
+    }
+    // 0a8c: clr (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        WR16(a, 0);
+        C = false;
+    }
+    // 0a8e: mov 1456, (r5)+
+    {
+        a = 0x1456;
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a92: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a94:
+    AOT_BLOCK(0x0a94, 2);
+    // 0a94: bis $8, r2
+    {
+        src = uint16_t(0x0008);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0a98: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a9a:
+    AOT_BLOCK(0x0a9a, 1);
+    // 0a9a: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x0a9e);
+    }
+    AOT_GOTO(0x0626, L0626);
+L0a9e:
+    AOT_BLOCK(0x0a9e, 3);
+    // 0a9e: bis $10, r2
+    {
+        src = uint16_t(0x0010);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0aa2: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0aa4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0aa6:
+    AOT_BLOCK(0x0aa6, 1);
+    // 0aa6: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x0aaa);
+    }
+    AOT_GOTO(0x0626, L0626);
+L0aaa:
+    AOT_BLOCK(0x0aaa, 2);
+    // 0aaa: cmp r4, $28
+    {
+        src = r[4];
+        dst = uint16_t(0x0028);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0aae: beq 0aba
+    if (Z)
+        AOT_GOTO(0x0aba, L0aba);
+    AOT_GOTO(0x0ab0, L0ab0);
+L0ab0:
+    AOT_BLOCK(0x0ab0, 3);
+    // 0ab0: mov r4, 1476
+    {
+        src = r[4];
+        b = 0x1476;
+        WR16(b, src);
+    }
+    // 0ab4: mov $2d, r4
+    {
+        src = uint16_t(0x002d);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ab8: br 0a06
+    AOT_GOTO(0x0a06, L0a06);
+L0aba:
+    AOT_BLOCK(0x0aba, 1);
+    // 0aba: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x0abe);
+    }
+    AOT_GOTO(0x0626, L0626);
+L0abe:
+    AOT_BLOCK(0x0abe, 1);
+    // 0abe: jsr pc, 0bb2
+    {
+        a = 0x0bb2;
+        r[6] -= 2;
+        WR16(r[6], 0x0ac2);
+    }
+    AOT_GOTO(0x0bb2, L0bb2);
+L0ac2:
+    AOT_BLOCK(0x0ac2, 1);
+    // 0ac2: jsr pc, 0b2e
+    {
+        a = 0x0b2e;
+        r[6] -= 2;
+        WR16(r[6], 0x0ac6);
+    }
+    AOT_GOTO(0x0b2e, L0b2e);
+L0ac6:
+    AOT_BLOCK(0x0ac6, 1);
+    // 0ac6: jsr pc, 0b08
+    {
+        a = 0x0b08;
+        r[6] -= 2;
+        WR16(r[6], 0x0aca);
+    }
+    AOT_GOTO(0x0b08, L0b08);
+L0aca:
+    AOT_BLOCK(0x0aca, 3);
+    // 0aca: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0acc: bis $20, r2
+    {
+        src = uint16_t(0x0020);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0ad0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ad2:
+    AOT_BLOCK(0x0ad2, 1);
+    // 0ad2: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x0ad6);
+    }
+    AOT_GOTO(0x0626, L0626);
+L0ad6:
+    AOT_BLOCK(0x0ad6, 1);
+    // 0ad6: jsr pc, 0bb2
+    {
+        a = 0x0bb2;
+        r[6] -= 2;
+        WR16(r[6], 0x0ada);
+    }
+    AOT_GOTO(0x0bb2, L0bb2);
+L0ada:
+    AOT_BLOCK(0x0ada, 6);
+    // 0ada: mov r2, (r5)+
+    {
+        src = r[2];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0adc: mov r3, (r5)+
+    {
+        src = r[3];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0ade: mov 1456, (r5)+
+    {
+        a = 0x1456;
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0ae2: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0ae4: bis $17, r2
+    {
+        src = uint16_t(0x0017);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0ae8: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0aea:
+    AOT_BLOCK(0x0aea, 2);
+    // 0aea: tst (sp)
+    {
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0aec: beq 0af4
+    if (Z)
+        AOT_GOTO(0x0af4, L0af4);
+    AOT_GOTO(0x0aee, L0aee);
+L0aee:
+    AOT_BLOCK(0x0aee, 1);
+    // 0aee: jsr r5, 0394
+    {
+        a = 0x0394;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0af2;
+    }
+    AOT_GOTO(0x0394, L0394);
+L0af2:
+    // 0af2: (undefined)
+    AOT_INTERP(0x0af2);
+L0af4:
+    AOT_BLOCK(0x0af4, 2);
+    // 0af4: mov $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0af8: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x0afc);
+    }
+    AOT_GOTO(0x0626, L0626);
+L0afc:
+    AOT_BLOCK(0x0afc, 1);
+    // 0afc: jmp 09ea
+    {
+        a = 0x09ea;
+    }
+    AOT_GOTO(0x09ea, L09ea);
+L0b00:
+    AOT_BLOCK(0x0b00, 1);
+    // 0b00: jsr r5, 0394
+    {
+        a = 0x0394;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b04;
+    }
+    AOT_GOTO(0x0394, L0394);
+L0b04:
+    AOT_BLOCK(0x0b04, 1);
+    // 0b04: jmp -(r1)
+    {
+        r[1] -= 2;
+        a = r[1];
+    }
+    AOT_JUMP(a);
+L0b08:
+    AOT_BLOCK(0x0b08, 2);
+    // 0b08: cmp r2, $7
+    {
+        src = r[2];
+        dst = uint16_t(0x0007);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b0c: bhi 0b1c
+    if (!(C | Z))
+        AOT_GOTO(0x0b1c, L0b1c);
+    AOT_GOTO(0x0b0e, L0b0e);
+L0b0e:
+    AOT_BLOCK(0x0b0e, 2);
+    // 0b0e: cmp r1, $1
+    {
+        src = r[1];
+        dst = uint16_t(0x0001);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b12: blos 0b1a
+    if (C | Z)
+        AOT_GOTO(0x0b1a, L0b1a);
+    AOT_GOTO(0x0b14, L0b14);
+L0b14:
+    AOT_BLOCK(0x0b14, 2);
+    // 0b14: cmp r3, $5
+    {
+        src = r[3];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b18: bcs 0b1c
+    if (C)
+        AOT_GOTO(0x0b1c, L0b1c);
+    AOT_GOTO(0x0b1a, L0b1a);
+L0b1a:
+    AOT_BLOCK(0x0b1a, 1);
+    // 0b1a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b1c:
+    AOT_BLOCK(0x0b1c, 1);
+    // 0b1c: jsr pc, 0b00
+    {
+        a = 0x0b00;
+        r[6] -= 2;
+        WR16(r[6], 0x0b20);
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L0b20:
+    AOT_BLOCK(0x0b20, 3);
+    // 0b20: clr r2
+    {
+        r[2] = 0;
+    }
+    // 0b22: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0b24: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b2e:
+    AOT_BLOCK(0x0b2e, 2);
+    // 0b2e: cmp r4, $29
+    {
+        src = r[4];
+        dst = uint16_t(0x0029);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b32: beq 0b3c
+    if (Z)
+        AOT_GOTO(0x0b3c, L0b3c);
+    AOT_GOTO(0x0b34, L0b34);
+L0b34:
+    AOT_BLOCK(0x0b34, 1);
+    // 0b34: jsr r5, 0394
+    {
+        a = 0x0394;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b38;
+    }
+    AOT_GOTO(0x0394, L0394);
+L0b38:
+    // 0b38: (undefined)
+    AOT_INTERP(0x0b38);
+L0b3a:
+    AOT_BLOCK(0x0b3a, 1);
+    // 0b3a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b3c:
+    AOT_BLOCK(0x0b3c, 1);
+    // 0b3c: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x0b40);
+    }
+    AOT_GOTO(0x0626, L0626);
+L0b40:
+    AOT_BLOCK(0x0b40, 1);
+    // 0b40: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0bb2:
+    AOT_BLOCK(0x0bb2, 6);
+    // 0bb2: clr 1456
+    {
+        a = 0x1456;
+        WR16(a, 0);
+    }
+    // 0bb6: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bb8: mov $2b, -(sp)
+    {
+        src = uint16_t(0x002b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bbc: clr r2
+    {
+        r[2] = 0;
+        C = false;
+    }
+    // 0bbe: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bc2: br 0bc8
+    AOT_GOTO(0x0bc8, L0bc8);
+L0bc4:
+    AOT_BLOCK(0x0bc4, 1);
+    // 0bc4: jsr pc, 0626
+    {
+        a = 0x0626;
+        r[6] -= 2;
+        WR16(r[6], 0x0bc8);
+    }
+    AOT_GOTO(0x0626, L0626);
+L0bc8:
+    AOT_BLOCK(0x0bc8, 2);
+    // 0bc8: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bca: jsr r5, 03f0
+    {
+        a = 0x03f0;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0bce;
+    }
+    AOT_GOTO(0x03f0, L03f0);
+L0bce:
+    // 0bce: halt
+    AOT_INTERP(0x0bce);
+L0bd0:
+    AOT_BLOCK(0x0bd0, 1);
+    // 0bd0: jmp *0cd5
+    {
+        a = RD16(0x0cd5);
+    }
+    AOT_JUMP(a);
+L0bd6:
+    AOT_BLOCK(0x0bd6, 3);
+    // 0bd6: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0bd8: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0bda: bne 0be8
+    if (!Z)
+        AOT_GOTO(0x0be8, L0be8);
+    AOT_GOTO(0x0bdc, L0bdc);
+L0bdc:
+    AOT_BLOCK(0x0bdc, 2);
+    // 0bdc: tstb 18b8
+    {
+        a = 0x18b8;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0be0: beq 0be8
+    if (Z)
+        AOT_GOTO(0x0be8, L0be8);
+    AOT_GOTO(0x0be2, L0be2);
+L0be2:
+    AOT_BLOCK(0x0be2, 1);
+    // 0be2: jsr r5, 0394
+    {
+        a = 0x0394;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0be6;
+    }
+    AOT_GOTO(0x0394, L0394);
+L0be6:
+    AOT_BLOCK(0x0be6, 1);
+    // 0be6: jmp 2017(r5)
+    {
+        a = uint16_t(r[5] + 8215);
+    }
+    AOT_JUMP(a);
+L0be8:
+    AOT_BLOCK(0x0be8, 2);
+    // 0be8: cmp r0, $20
+    {
+        src = r[0];
+        dst = uint16_t(0x0020);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bec: bne 0bf6
+    if (!Z)
+        AOT_GOTO(0x0bf6, L0bf6);
+    AOT_GOTO(0x0bee, L0bee);
+L0bee:
+    AOT_BLOCK(0x0bee, 3);
+    // 0bee: mov r4, 1456
+    {
+        src = r[4];
+        b = 0x1456;
+        WR16(b, src);
+    }
+    // 0bf2: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0bf4: br 0ca2
+    AOT_GOTO(0x0ca2, L0ca2);
+L0bf6:
+    AOT_BLOCK(0x0bf6, 2);
+    // 0bf6: mov 2(r4), r1
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bfa: br 0ca2
+    AOT_GOTO(0x0ca2, L0ca2);
+L0c00:
+    AOT_BLOCK(0x0c00, 1);
+    // 0c00: bcs 0c10
+    if (C)
+        AOT_GOTO(0x0c10, L0c10);
+    AOT_GOTO(0x0c02, L0c02);
+L0c02:
+    AOT_BLOCK(0x0c02, 5);
+    // 0c02: asl r4
+    {
+        src = r[4];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[4] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0c04: mov 13b6(r4), r0
+    {
+        a = uint16_t(r[4] + 5046);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c08: mov 2(r0), r1
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0c0c: movb (r0), r0
+    {
+        a = r[0];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0c0e: br 0ca2
+    AOT_GOTO(0x0ca2, L0ca2);
+L0c10:
+    AOT_BLOCK(0x0c10, 1);
+    // 0c10: mov $c26, r1
+    {
+        src = uint16_t(0x0c26);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c14, L0c14);
+L0c14:
+    AOT_BLOCK(0x0c14, 2);
+    // 0c14: cmp (r1)+, r4
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c16: beq 0c22
+    if (Z)
+        AOT_GOTO(0x0c22, L0c22);
+    AOT_GOTO(0x0c18, L0c18);
+L0c18:
+    AOT_BLOCK(0x0c18, 2);
+    // 0c18: tst (r1)+
+    {
+        a = r[1];
+        r[1] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c1a: bne 0c14
+    if (!Z)
+        AOT_GOTO(0x0c14, L0c14);
+    AOT_GOTO(0x0c1c, L0c1c);
+L0c1c:
+    AOT_BLOCK(0x0c1c, 3);
+    // 0c1c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0c1e: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c20: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0c22:
+    AOT_BLOCK(0x0c22, 1);
+    // 0c22: jmp *0(r1)
+    {
+        a = RD16(r[1] + 0);
+    }
+    AOT_JUMP(a);
+L0c40:
+    AOT_BLOCK(0x0c40, 1);
+    // 0c40: rol -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = RD16(a);
+        val = uint16_t(src << 1) | (C ? 1 : 0);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = (src & 0x8000) != 0;
+        V = ((val & 0x8000) != 0) != ((src & 0x8000) != 0);
+    }
+    // 0c42: (undefined)
+    AOT_INTERP(0x0c42);
+L0c44:
+    AOT_BLOCK(0x0c44, 1);
+    // 0c44: rol -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = RD16(a);
+        val = uint16_t(src << 1) | (C ? 1 : 0);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = (src & 0x8000) != 0;
+        V = ((val & 0x8000) != 0) != ((src & 0x8000) != 0);
+    }
+    // 0c46: (undefined)
+    AOT_INTERP(0x0c46);
+L0c48:
+    AOT_BLOCK(0x0c48, 2);
+    // 0c48: rol -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = RD16(a);
+        val = uint16_t(src << 1) | (C ? 1 : 0);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = (src & 0x8000) != 0;
+        V = ((val & 0x8000) != 0) != ((src & 0x8000) != 0);
+    }
+    // 0c4a: jmp *(r3)+
+    {
+        a = RD16(r[3]);
+        r[3] += 2;
+    }
+    AOT_JUMP(a);
+L0c80:
+    AOT_BLOCK(0x0c80, 1);
+    // 0c80: br 0ca2
+    AOT_GOTO(0x0ca2, L0ca2);
+L0ca2:
+    AOT_BLOCK(0x0ca2, 1);
+    // 0ca2: mov $cb4, r5
+    {
+        src = uint16_t(0x0cb4);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ca6, L0ca6);
+L0ca6:
+    AOT_BLOCK(0x0ca6, 2);
+    // 0ca6: cmp (sp), (r5)+
+    {
+        a = r[6];
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ca8: beq 0cb0
+    if (Z)
+        AOT_GOTO(0x0cb0, L0cb0);
+    AOT_GOTO(0x0caa, L0caa);
+L0caa:
+    AOT_BLOCK(0x0caa, 2);
+    // 0caa: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0cac: bne 0ca6
+    if (!Z)
+        AOT_GOTO(0x0ca6, L0ca6);
+    AOT_GOTO(0x0cae, L0cae);
+L0cae:
+    AOT_BLOCK(0x0cae, 1);
+    // 0cae: br 0d64
+    AOT_GOTO(0x0d64, L0d64);
+L0cb0:
+    AOT_BLOCK(0x0cb0, 1);
+    // 0cb0: jmp *0(r5)
+    {
+        a = RD16(r[5] + 0);
+    }
+    AOT_JUMP(a);
+L0cc0:
+    // 0cc0: (undefined)
+    AOT_INTERP(0x0cc0);
+L0cc2:
+    // 0cc2: mfpi sp
+    AOT_INTERP(0x0cc2);
+L0cc4:
+    // 0cc4: (undefined)
+    AOT_INTERP(0x0cc4);
+L0cc6:
+    // 0cc6: mark 30
+    AOT_INTERP(0x0cc6);
+L0cc8:
+    // 0cc8: (undefined)
+    AOT_INTERP(0x0cc8);
+L0cca:
+    // 0cca: mark 24
+    AOT_INTERP(0x0cca);
+L0ccc:
+    // 0ccc: (undefined)
+    AOT_INTERP(0x0ccc);
+L0cce:
+    AOT_BLOCK(0x0cce, 2);
+    // 0cce: asl 1e(r2)
+    {
+        a = uint16_t(r[2] + 30);
+        src = RD16(a);
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        WR16(a, val);
+    }
+    // 0cd2: asl *-(r0)
+    {
+        r[0] -= 2;
+        a = RD16(r[0]);
+        src = RD16(a);
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0cd4: (undefined)
+    AOT_INTERP(0x0cd4);
+L0cd6:
+    AOT_BLOCK(0x0cd6, 2);
+    // 0cd6: asl *5e(r4)
+    {
+        a = RD16(r[4] + 94);
+        src = RD16(a);
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        WR16(a, val);
+    }
+    // 0cda: asl -(r4)
+    {
+        r[4] -= 2;
+        a = r[4];
+        src = RD16(a);
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0cdc: (undefined)
+    AOT_INTERP(0x0cdc);
+L0cde:
+    // 0cde: mfpi *(r0)+
+    AOT_INTERP(0x0cde);
+L0ce0:
+    AOT_BLOCK(0x0ce0, 1);
+    // 0ce0: rts r0
+    {
+        b = r[0];
+        r[0] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0d00:
+    // 0d00: (undefined)
+    AOT_INTERP(0x0d00);
+L0d02:
+    AOT_BLOCK(0x0d02, 7);
+    // 0d02: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 0d04: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+    }
+    // 0d06: clr r2
+    {
+        r[2] = 0;
+    }
+    // 0d08: div r1, r2
+    {
+        src = int16_t(r[1]);
+        if (src == 0 || abs(int16_t(r[2])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[2]) << 16) | r[3];
+        dst = val / src;
+        r[2] = dst;
+        r[3] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0d0a: mov r3, r2
+    {
+        src = r[3];
+        r[2] = src;
+    }
+    // 0d0c: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d0e: br 0d64
+    AOT_GOTO(0x0d64, L0d64);
+L0d64:
+    AOT_BLOCK(0x0d64, 2);
+    // 0d64: mov $2b, (sp)
+    {
+        src = uint16_t(0x002b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d68: jmp 0bc4
+    {
+        a = 0x0bc4;
+    }
+    AOT_GOTO(0x0bc4, L0bc4);
+L0dc0:
+    AOT_BLOCK(0x0dc0, 3);
+    // 0dc0: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0dc2: movb (r0), r3
+    {
+        a = r[0];
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0dc4: bpl 0dd6
+    if (!N)
+        AOT_GOTO(0x0dd6, L0dd6);
+    AOT_GOTO(0x0dc6, L0dc6);
+L0dc6:
+    AOT_BLOCK(0x0dc6, 2);
+    // 0dc6: cmp r3, $ffff
+    {
+        src = r[3];
+        dst = uint16_t(0xffff);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0dca: beq 0dd2
+    if (Z)
+        AOT_GOTO(0x0dd2, L0dd2);
+    AOT_GOTO(0x0dcc, L0dcc);
+L0dcc:
+    AOT_BLOCK(0x0dcc, 1);
+    // 0dcc: jsr r5, 0394
+    {
+        a = 0x0394;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0dd0;
+    }
+    AOT_GOTO(0x0394, L0394);
+L0dd0:
+    AOT_BLOCK(0x0dd0, 1);
+    // 0dd0: jmp 1dc3(r2)
+    {
+        a = uint16_t(r[2] + 7619);
+    }
+    AOT_JUMP(a);
+L0dd2:
+    AOT_BLOCK(0x0dd2, 1);
+    // 0dd2: mov 14a2, r3
+    {
+        a = 0x14a2;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0dd6, L0dd6);
+L0dd6:
+    AOT_BLOCK(0x0dd6, 2);
+    // 0dd6: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dd8: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0e76:
+    AOT_BLOCK(0x0e76, 1);
+    // 0e76: mov 0eba, 0e7e
+    {
+        a = 0x0eba;
+        src = RD16(a);
+        b = 0x0e7e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e7c: sys a
+    AOT_INTERP(0x0e7c);
+L0e7e:
+    // 0e7e: halt
+    AOT_INTERP(0x0e7e);
+L0e80:
+    AOT_BLOCK(0x0e80, 1);
+    // 0e80: mov 0ebc, 0e88
+    {
+        a = 0x0ebc;
+        src = RD16(a);
+        b = 0x0e88;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e86, L0e86);
+L0e82:
+    // 0e82: (undefined)
+    AOT_INTERP(0x0e82);
+L0e84:
+    // 0e84: rti
+    AOT_INTERP(0x0e84);
+L0e86:
+    // 0e86: sys a
+    AOT_INTERP(0x0e86);
+L0e88:
+    // 0e88: halt
+    AOT_INTERP(0x0e88);
+L0e8a:
+    AOT_BLOCK(0x0e8a, 1);
+    // 0e8a: mov 0ebe, 0e92
+    {
+        a = 0x0ebe;
+        src = RD16(a);
+        b = 0x0e92;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e90, L0e90);
+L0e8c:
+    // 0e8c: (undefined)
+    AOT_INTERP(0x0e8c);
+L0e8e:
+    // 0e8e: rti
+    AOT_INTERP(0x0e8e);
+L0e90:
+    // 0e90: sys a
+    AOT_INTERP(0x0e90);
+L0e92:
+    // 0e92: halt
+    AOT_INTERP(0x0e92);
+L0e94:
+    // 0e94: sys f
+    AOT_INTERP(0x0e94);
+L0e96:
+    // 0e96: (undefined)
+    AOT_INTERP(0x0e96);
+L0e98:
+    AOT_BLOCK(0x0e98, 1);
+    // 0e98: br 0e98
+    AOT_GOTO(0x0e98, L0e98);
+L0e9a:
+    // 0e9a: sys 1
+    AOT_INTERP(0x0e9a);
+L0e9c:
+    // 0e9c: sys 11
+    AOT_INTERP(0x0e9c);
+L0e9e:
+    AOT_BLOCK(0x0e9e, 1);
+    // 0e9e: mov -(r3), (r0)+
+    {
+        r[3] -= 2;
+        a = r[3];
+        src = RD16(a);
+        b = r[0];
+        r[0] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ea0, L0ea0);
+L0ea0:
+    // 0ea0: sys 5
+    AOT_INTERP(0x0ea0);
+L0ea2:
+    // 0ea2: halt
+    AOT_INTERP(0x0ea2);
+L0ea4:
+    // 0ea4: halt
+    AOT_INTERP(0x0ea4);
+L0ea6:
+    AOT_BLOCK(0x0ea6, 1);
+    // 0ea6: cmp r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0ea8, L0ea8);
+L0ea8:
+    AOT_BLOCK(0x0ea8, 1);
+    // 0ea8: xor r1, *7878(r0)
+    {
+        src = r[1];
+        b = RD16(r[0] + 30840);
+        val = src ^ RD16(b);
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0eac: (undefined)
+    AOT_INTERP(0x0eac);
+L0eaa:
+    AOT_BLOCK(0x0eaa, 1);
+    // 0eaa: xor r1, *a(r0)
+    {
+        src = r[1];
+        b = RD16(r[0] + 10);
+        val = src ^ RD16(b);
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0eae, L0eae);
+L0eae:
+    // 0eae: sys 13
+    AOT_INTERP(0x0eae);
+L0eb0:
+    // 0eb0: halt
+    AOT_INTERP(0x0eb0);
+L0eb2:
+    // 0eb2: halt
+    AOT_INTERP(0x0eb2);
+L0eb4:
+    // 0eb4: sys 4
+    AOT_INTERP(0x0eb4);
+L0eb6:
+    // 0eb6: halt
+    AOT_INTERP(0x0eb6);
+L0eb8:
+    // 0eb8: halt
+    AOT_INTERP(0x0eb8);
+L0eba:
+    // 0eba: halt
+    AOT_INTERP(0x0eba);
+L0ebc:
+    // 0ebc: halt
+    AOT_INTERP(0x0ebc);
+L0ebe:
+    // 0ebe: halt
+    AOT_INTERP(0x0ebe);
+L0ec0:
+    // 0ec0: (undefined)
+    AOT_INTERP(0x0ec0);
+L0ec2:
+    // 0ec2: (undefined)
+    AOT_INTERP(0x0ec2);
+L0ec4:
+    AOT_BLOCK(0x0ec4, 1);
+    // 0ec4: br 0ed4
+    AOT_GOTO(0x0ed4, L0ed4);
+L0ed4:
+    // 0ed4: (undefined)
+    AOT_INTERP(0x0ed4);
+L0ed6:
+    // 0ed6: halt
+    AOT_INTERP(0x0ed6);
+L0ed8:
+    // 0ed8: halt
+    AOT_INTERP(0x0ed8);
+L0eda:
+    // 0eda: halt
+    AOT_INTERP(0x0eda);
+L0edc:
+    // 0edc: halt
+    AOT_INTERP(0x0edc);
+L0ede:
+    // 0ede: halt
+    AOT_INTERP(0x0ede);
+L0ee0:
+    // 0ee0: halt
+    AOT_INTERP(0x0ee0);
+L0ee2:
+    // 0ee2: rti
+    AOT_INTERP(0x0ee2);
+L0ee4:
+    // 0ee4: halt
+    AOT_INTERP(0x0ee4);
+L0ee6:
+    // 0ee6: wait
+    AOT_INTERP(0x0ee6);
+L0ee8:
+    // 0ee8: halt
+    AOT_INTERP(0x0ee8);
+L0eea:
+    // 0eea: (undefined)
+    AOT_INTERP(0x0eea);
+L0eec:
+    // 0eec: halt
+    AOT_INTERP(0x0eec);
+L0eee:
+    // 0eee: (undefined)
+    AOT_INTERP(0x0eee);
+L0ef0:
+    // 0ef0: wait
+    AOT_INTERP(0x0ef0);
+L0ef2:
+    // 0ef2: (undefined)
+    AOT_INTERP(0x0ef2);
+L0ef4:
+    // 0ef4: rti
+    AOT_INTERP(0x0ef4);
+L0ef6:
+    // 0ef6: (undefined)
+    AOT_INTERP(0x0ef6);
+L0ef8:
+    // 0ef8: bpt
+    AOT_INTERP(0x0ef8);
+L0efa:
+    // 0efa: (undefined)
+    AOT_INTERP(0x0efa);
+L0efc:
+    // 0efc: iot
+    AOT_INTERP(0x0efc);
+L0efe:
+    // 0efe: (undefined)
+    AOT_INTERP(0x0efe);
+L0f00:
+    // 0f00: reset
+    AOT_INTERP(0x0f00);
+L0f02:
+    // 0f02: (undefined)
+    AOT_INTERP(0x0f02);
+L0f04:
+    // 0f04: rtt
+    AOT_INTERP(0x0f04);
+L0f06:
+    // 0f06: (undefined)
+    AOT_INTERP(0x0f06);
+L0f08:
+    // 0f08: (undefined)
+    AOT_INTERP(0x0f08);
+L0f0a:
+    // 0f0a: wait
+    AOT_INTERP(0x0f0a);
+L0f0c:
+    // 0f0c: wait
+    AOT_INTERP(0x0f0c);
+L0f0e:
+    // 0f0e: wait
+    AOT_INTERP(0x0f0e);
+L0f10:
+    // 0f10: rti
+    AOT_INTERP(0x0f10);
+L0f12:
+    // 0f12: wait
+    AOT_INTERP(0x0f12);
+L0f14:
+    // 0f14: bpt
+    AOT_INTERP(0x0f14);
+L0f16:
+    // 0f16: wait
+    AOT_INTERP(0x0f16);
+L0f18:
+    // 0f18: iot
+    AOT_INTERP(0x0f18);
+L0f1a:
+    // 0f1a: wait
+    AOT_INTERP(0x0f1a);
+L0f1c:
+    // 0f1c: reset
+    AOT_INTERP(0x0f1c);
+L0f1e:
+    // 0f1e: wait
+    AOT_INTERP(0x0f1e);
+L0f20:
+    // 0f20: rtt
+    AOT_INTERP(0x0f20);
+L0f22:
+    // 0f22: wait
+    AOT_INTERP(0x0f22);
+L0f24:
+    // 0f24: (undefined)
+    AOT_INTERP(0x0f24);
+L0f26:
+    // 0f26: wait
+    AOT_INTERP(0x0f26);
+L0f28:
+    // 0f28: (undefined)
+    AOT_INTERP(0x0f28);
+L0f2a:
+    // 0f2a: wait
+    AOT_INTERP(0x0f2a);
+L0f2c:
+    // 0f2c: (undefined)
+    AOT_INTERP(0x0f2c);
+L0f2e:
+    // 0f2e: wait
+    AOT_INTERP(0x0f2e);
+L0f30:
+    // 0f30: (undefined)
+    AOT_INTERP(0x0f30);
+L0f32:
+    // 0f32: wait
+    AOT_INTERP(0x0f32);
+L0f34:
+    // 0f34: (undefined)
+    AOT_INTERP(0x0f34);
+L0f36:
+    // 0f36: wait
+    AOT_INTERP(0x0f36);
+L0f38:
+    // 0f38: (undefined)
+    AOT_INTERP(0x0f38);
+L0f3a:
+    // 0f3a: wait
+    AOT_INTERP(0x0f3a);
+L0f3c:
+    // 0f3c: (undefined)
+    AOT_INTERP(0x0f3c);
+L0f3e:
+    // 0f3e: wait
+    AOT_INTERP(0x0f3e);
+L0f40:
+    // 0f40: (undefined)
+    AOT_INTERP(0x0f40);
+L0f42:
+    // 0f42: wait
+    AOT_INTERP(0x0f42);
+L0f44:
+    // 0f44: (undefined)
+    AOT_INTERP(0x0f44);
+L0f46:
+    // 0f46: wait
+    AOT_INTERP(0x0f46);
+L0f48:
+    // 0f48: (undefined)
+    AOT_INTERP(0x0f48);
+L0f4a:
+    // 0f4a: wait
+    AOT_INTERP(0x0f4a);
+L0f4c:
+    // 0f4c: (undefined)
+    AOT_INTERP(0x0f4c);
+L0f4e:
+    // 0f4e: wait
+    AOT_INTERP(0x0f4e);
+L0f50:
+    // 0f50: (undefined)
+    AOT_INTERP(0x0f50);
+L0f52:
+    // 0f52: wait
+    AOT_INTERP(0x0f52);
+L0f54:
+    // 0f54: (undefined)
+    AOT_INTERP(0x0f54);
+L0f56:
+    // 0f56: wait
+    AOT_INTERP(0x0f56);
+L0f58:
+    // 0f58: (undefined)
+    AOT_INTERP(0x0f58);
+L0f5a:
+    // 0f5a: wait
+    AOT_INTERP(0x0f5a);
+L0f5c:
+    // 0f5c: (undefined)
+    AOT_INTERP(0x0f5c);
+L0f5e:
+    // 0f5e: wait
+    AOT_INTERP(0x0f5e);
+L0f60:
+    // 0f60: (undefined)
+    AOT_INTERP(0x0f60);
+L0f62:
+    // 0f62: wait
+    AOT_INTERP(0x0f62);
+L0f64:
+    // 0f64: (undefined)
+    AOT_INTERP(0x0f64);
+L0f66:
+    // 0f66: wait
+    AOT_INTERP(0x0f66);
+L0f68:
+    // 0f68: (undefined)
+    AOT_INTERP(0x0f68);
+L0f6a:
+    // 0f6a: wait
+    AOT_INTERP(0x0f6a);
+L0f6c:
+    // 0f6c: (undefined)
+    AOT_INTERP(0x0f6c);
+L0f6e:
+    // 0f6e: wait
+    AOT_INTERP(0x0f6e);
+L0f70:
+    // 0f70: (undefined)
+    AOT_INTERP(0x0f70);
+L0f72:
+    // 0f72: wait
+    AOT_INTERP(0x0f72);
+L0f74:
+    // 0f74: (undefined)
+    AOT_INTERP(0x0f74);
+L0f76:
+    // 0f76: wait
+    AOT_INTERP(0x0f76);
+L0f78:
+    // 0f78: (undefined)
+    AOT_INTERP(0x0f78);
+L0f7a:
+    // 0f7a: wait
+    AOT_INTERP(0x0f7a);
+L0f7c:
+    // 0f7c: (undefined)
+    AOT_INTERP(0x0f7c);
+L0f7e:
+    // 0f7e: wait
+    AOT_INTERP(0x0f7e);
+L0f80:
+    // 0f80: (undefined)
+    AOT_INTERP(0x0f80);
+L0f82:
+    // 0f82: wait
+    AOT_INTERP(0x0f82);
+L0f84:
+    // 0f84: (undefined)
+    AOT_INTERP(0x0f84);
+L0f86:
+    // 0f86: (undefined)
+    AOT_INTERP(0x0f86);
+L0f88:
+    AOT_BLOCK(0x0f88, 1);
+    // 0f88: mov r0, r0
+    {
+        src = r[0];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f8a: (undefined)
+    AOT_INTERP(0x0f8a);
+L0f8c:
+    AOT_BLOCK(0x0f8c, 1);
+    // 0f8c: movb r0, r0
+    {
+        src = uint8_t(r[0]);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0f8e: (undefined)
+    AOT_INTERP(0x0f8e);
+L0f90:
+    AOT_BLOCK(0x0f90, 1);
+    // 0f90: cmp r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f92: (undefined)
+    AOT_INTERP(0x0f92);
+L0f94:
+    AOT_BLOCK(0x0f94, 1);
+    // 0f94: cmpb r0, r0
+    {
+        src = uint8_t(r[0]);
+        dst = uint8_t(r[0]);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0f96: (undefined)
+    AOT_INTERP(0x0f96);
+L0f98:
+    AOT_BLOCK(0x0f98, 1);
+    // 0f98: bit r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0f9a: (undefined)
+    AOT_INTERP(0x0f9a);
+L0f9c:
+    AOT_BLOCK(0x0f9c, 1);
+    // 0f9c: bitb r0, r0
+    {
+        src = uint8_t(r[0]);
+        dst = uint8_t(r[0]);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0f9e: (undefined)
+    AOT_INTERP(0x0f9e);
+L0fa0:
+    AOT_BLOCK(0x0fa0, 1);
+    // 0fa0: bic r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0fa2: (undefined)
+    AOT_INTERP(0x0fa2);
+L0fa4:
+    AOT_BLOCK(0x0fa4, 1);
+    // 0fa4: bicb r0, r0
+    {
+        src = uint8_t(r[0]);
+        dst = uint8_t(r[0]);
+        val = (~src) & dst;
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0fa6: (undefined)
+    AOT_INTERP(0x0fa6);
+L0fa8:
+    AOT_BLOCK(0x0fa8, 1);
+    // 0fa8: bis r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0faa: (undefined)
+    AOT_INTERP(0x0faa);
+L0fac:
+    AOT_BLOCK(0x0fac, 1);
+    // 0fac: bisb r0, r0
+    {
+        src = uint8_t(r[0]);
+        dst = uint8_t(r[0]);
+        val = src | dst;
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0fae: (undefined)
+    AOT_INTERP(0x0fae);
+L0fb0:
+    AOT_BLOCK(0x0fb0, 1);
+    // 0fb0: add r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0fb2: (undefined)
+    AOT_INTERP(0x0fb2);
+L0fb4:
+    AOT_BLOCK(0x0fb4, 1);
+    // 0fb4: sub r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 0fb6: rtt
+    AOT_INTERP(0x0fb6);
+L0fb8:
+    AOT_BLOCK(0x0fb8, 1);
+    // 0fb8: br 0fba
+    AOT_GOTO(0x0fba, L0fba);
+L0fba:
+    // 0fba: rtt
+    AOT_INTERP(0x0fba);
+L0fbc:
+    AOT_BLOCK(0x0fbc, 1);
+    // 0fbc: bne 0fbe
+    if (!Z)
+        AOT_GOTO(0x0fbe, L0fbe);
+    AOT_GOTO(0x0fbe, L0fbe);
+L0fbe:
+    // 0fbe: rtt
+    AOT_INTERP(0x0fbe);
+L0fc0:
+    AOT_BLOCK(0x0fc0, 1);
+    // 0fc0: beq 0fc2
+    if (Z)
+        AOT_GOTO(0x0fc2, L0fc2);
+    AOT_GOTO(0x0fc2, L0fc2);
+L0fc2:
+    // 0fc2: rtt
+    AOT_INTERP(0x0fc2);
+L0fc4:
+    AOT_BLOCK(0x0fc4, 1);
+    // 0fc4: bge 0fc6
+    if (!(N ^ V))
+        AOT_GOTO(0x0fc6, L0fc6);
+    AOT_GOTO(0x0fc6, L0fc6);
+L0fc6:
+    // 0fc6: rtt
+    AOT_INTERP(0x0fc6);
+L0fc8:
+    AOT_BLOCK(0x0fc8, 1);
+    // 0fc8: blt 0fca
+    if (N ^ V)
+        AOT_GOTO(0x0fca, L0fca);
+    AOT_GOTO(0x0fca, L0fca);
+L0fca:
+    // 0fca: rtt
+    AOT_INTERP(0x0fca);
+L0fcc:
+    AOT_BLOCK(0x0fcc, 1);
+    // 0fcc: bgt 0fce
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0fce, L0fce);
+    AOT_GOTO(0x0fce, L0fce);
+L0fce:
+    // 0fce: rtt
+    AOT_INTERP(0x0fce);
+L0fd0:
+    AOT_BLOCK(0x0fd0, 1);
+    // 0fd0: ble 0fd2
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0fd2, L0fd2);
+    AOT_GOTO(0x0fd2, L0fd2);
+L0fd2:
+    // 0fd2: rtt
+    AOT_INTERP(0x0fd2);
+L0fd4:
+    AOT_BLOCK(0x0fd4, 1);
+    // 0fd4: bpl 0fd6
+    if (!N)
+        AOT_GOTO(0x0fd6, L0fd6);
+    AOT_GOTO(0x0fd6, L0fd6);
+L0fd6:
+    // 0fd6: rtt
+    AOT_INTERP(0x0fd6);
+L0fd8:
+    AOT_BLOCK(0x0fd8, 1);
+    // 0fd8: bmi 0fda
+    if (N)
+        AOT_GOTO(0x0fda, L0fda);
+    AOT_GOTO(0x0fda, L0fda);
+L0fda:
+    // 0fda: rtt
+    AOT_INTERP(0x0fda);
+L0fdc:
+    AOT_BLOCK(0x0fdc, 1);
+    // 0fdc: bhi 0fde
+    if (!(C | Z))
+        AOT_GOTO(0x0fde, L0fde);
+    AOT_GOTO(0x0fde, L0fde);
+L0fde:
+    // 0fde: rtt
+    AOT_INTERP(0x0fde);
+L0fe0:
+    AOT_BLOCK(0x0fe0, 1);
+    // 0fe0: blos 0fe2
+    if (C | Z)
+        AOT_GOTO(0x0fe2, L0fe2);
+    AOT_GOTO(0x0fe2, L0fe2);
+L0fe2:
+    // 0fe2: rtt
+    AOT_INTERP(0x0fe2);
+L0fe4:
+    AOT_BLOCK(0x0fe4, 1);
+    // 0fe4: bvc 0fe6
+    if (!V)
+        AOT_GOTO(0x0fe6, L0fe6);
+    AOT_GOTO(0x0fe6, L0fe6);
+L0fe6:
+    // 0fe6: rtt
+    AOT_INTERP(0x0fe6);
+L0fe8:
+    AOT_BLOCK(0x0fe8, 1);
+    // 0fe8: bvs 0fea
+    if (V)
+        AOT_GOTO(0x0fea, L0fea);
+    AOT_GOTO(0x0fea, L0fea);
+L0fea:
+    // 0fea: rtt
+    AOT_INTERP(0x0fea);
+L0fec:
+    AOT_BLOCK(0x0fec, 1);
+    // 0fec: bcc 0fee
+    if (!C)
+        AOT_GOTO(0x0fee, L0fee);
+    AOT_GOTO(0x0fee, L0fee);
+L0fee:
+    // 0fee: rtt
+    AOT_INTERP(0x0fee);
+L0ff0:
+    AOT_BLOCK(0x0ff0, 1);
+    // 0ff0: bcc 0ff2
+    if (!C)
+        AOT_GOTO(0x0ff2, L0ff2);
+    AOT_GOTO(0x0ff2, L0ff2);
+L0ff2:
+    // 0ff2: rtt
+    AOT_INTERP(0x0ff2);
+L0ff4:
+    AOT_BLOCK(0x0ff4, 1);
+    // 0ff4: bcc 0ff6
+    if (!C)
+        AOT_GOTO(0x0ff6, L0ff6);
+    AOT_GOTO(0x0ff6, L0ff6);
+L0ff6:
+    // 0ff6: rtt
+    AOT_INTERP(0x0ff6);
+L0ff8:
+    AOT_BLOCK(0x0ff8, 1);
+    // 0ff8: bcs 0ffa
+    if (C)
+        AOT_GOTO(0x0ffa, L0ffa);
+    AOT_GOTO(0x0ffa, L0ffa);
+L0ffa:
+    // 0ffa: rtt
+    AOT_INTERP(0x0ffa);
+L0ffc:
+    AOT_BLOCK(0x0ffc, 1);
+    // 0ffc: bcs 0ffe
+    if (C)
+        AOT_GOTO(0x0ffe, L0ffe);
+    AOT_GOTO(0x0ffe, L0ffe);
+L0ffe:
+    // 0ffe: rtt
+    AOT_INTERP(0x0ffe);
+L1000:
+    AOT_BLOCK(0x1000, 1);
+    // 1000: bcs 1002
+    if (C)
+        AOT_GOTO(0x1002, L1002);
+    AOT_GOTO(0x1002, L1002);
+L1002:
+    // 1002: (undefined)
+    AOT_INTERP(0x1002);
+L1004:
+    AOT_BLOCK(0x1004, 1);
+    // 1004: br 1006
+    AOT_GOTO(0x1006, L1006);
+L1006:
+    // 1006: (undefined)
+    AOT_INTERP(0x1006);
+L1008:
+    AOT_BLOCK(0x1008, 1);
+    // 1008: bne 100a
+    if (!Z)
+        AOT_GOTO(0x100a, L100a);
+    AOT_GOTO(0x100a, L100a);
+L100a:
+    // 100a: (undefined)
+    AOT_INTERP(0x100a);
+L100c:
+    AOT_BLOCK(0x100c, 1);
+    // 100c: beq 100e
+    if (Z)
+        AOT_GOTO(0x100e, L100e);
+    AOT_GOTO(0x100e, L100e);
+L100e:
+    // 100e: (undefined)
+    AOT_INTERP(0x100e);
+L1010:
+    AOT_BLOCK(0x1010, 1);
+    // 1010: bge 1012
+    if (!(N ^ V))
+        AOT_GOTO(0x1012, L1012);
+    AOT_GOTO(0x1012, L1012);
+L1012:
+    // 1012: (undefined)
+    AOT_INTERP(0x1012);
+L1014:
+    AOT_BLOCK(0x1014, 1);
+    // 1014: blt 1016
+    if (N ^ V)
+        AOT_GOTO(0x1016, L1016);
+    AOT_GOTO(0x1016, L1016);
+L1016:
+    // 1016: (undefined)
+    AOT_INTERP(0x1016);
+L1018:
+    AOT_BLOCK(0x1018, 1);
+    // 1018: bgt 101a
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x101a, L101a);
+    AOT_GOTO(0x101a, L101a);
+L101a:
+    // 101a: (undefined)
+    AOT_INTERP(0x101a);
+L101c:
+    AOT_BLOCK(0x101c, 1);
+    // 101c: ble 101e
+    if (Z || (N ^ V))
+        AOT_GOTO(0x101e, L101e);
+    AOT_GOTO(0x101e, L101e);
+L101e:
+    // 101e: (undefined)
+    AOT_INTERP(0x101e);
+L1020:
+    AOT_BLOCK(0x1020, 1);
+    // 1020: bpl 1022
+    if (!N)
+        AOT_GOTO(0x1022, L1022);
+    AOT_GOTO(0x1022, L1022);
+L1022:
+    // 1022: (undefined)
+    AOT_INTERP(0x1022);
+L1024:
+    AOT_BLOCK(0x1024, 1);
+    // 1024: bmi 1026
+    if (N)
+        AOT_GOTO(0x1026, L1026);
+    AOT_GOTO(0x1026, L1026);
+L1026:
+    // 1026: (undefined)
+    AOT_INTERP(0x1026);
+L1028:
+    AOT_BLOCK(0x1028, 1);
+    // 1028: bhi 102a
+    if (!(C | Z))
+        AOT_GOTO(0x102a, L102a);
+    AOT_GOTO(0x102a, L102a);
+L102a:
+    // 102a: (undefined)
+    AOT_INTERP(0x102a);
+L102c:
+    AOT_BLOCK(0x102c, 1);
+    // 102c: blos 102e
+    if (C | Z)
+        AOT_GOTO(0x102e, L102e);
+    AOT_GOTO(0x102e, L102e);
+L102e:
+    // 102e: (undefined)
+    AOT_INTERP(0x102e);
+L1030:
+    AOT_BLOCK(0x1030, 1);
+    // 1030: bvc 1032
+    if (!V)
+        AOT_GOTO(0x1032, L1032);
+    AOT_GOTO(0x1032, L1032);
+L1032:
+    // 1032: (undefined)
+    AOT_INTERP(0x1032);
+L1034:
+    AOT_BLOCK(0x1034, 1);
+    // 1034: bvs 1036
+    if (V)
+        AOT_GOTO(0x1036, L1036);
+    AOT_GOTO(0x1036, L1036);
+L1036:
+    // 1036: (undefined)
+    AOT_INTERP(0x1036);
+L1038:
+    AOT_BLOCK(0x1038, 1);
+    // 1038: bcc 103a
+    if (!C)
+        AOT_GOTO(0x103a, L103a);
+    AOT_GOTO(0x103a, L103a);
+L103a:
+    // 103a: (undefined)
+    AOT_INTERP(0x103a);
+L103c:
+    AOT_BLOCK(0x103c, 1);
+    // 103c: bcc 103e
+    if (!C)
+        AOT_GOTO(0x103e, L103e);
+    AOT_GOTO(0x103e, L103e);
+L103e:
+    // 103e: (undefined)
+    AOT_INTERP(0x103e);
+L1040:
+    AOT_BLOCK(0x1040, 1);
+    // 1040: bcc 1042
+    if (!C)
+        AOT_GOTO(0x1042, L1042);
+    AOT_GOTO(0x1042, L1042);
+L1042:
+    // 1042: (undefined)
+    AOT_INTERP(0x1042);
+L1044:
+    AOT_BLOCK(0x1044, 1);
+    // 1044: bcs 1046
+    if (C)
+        AOT_GOTO(0x1046, L1046);
+    AOT_GOTO(0x1046, L1046);
+L1046:
+    // 1046: (undefined)
+    AOT_INTERP(0x1046);
+L1048:
+    AOT_BLOCK(0x1048, 1);
+    // 1048: bcs 104a
+    if (C)
+        AOT_GOTO(0x104a, L104a);
+    AOT_GOTO(0x104a, L104a);
+L104a:
+    // 104a: (undefined)
+    AOT_INTERP(0x104a);
+L104c:
+    AOT_BLOCK(0x104c, 1);
+    // 104c: bcs 104e
+    if (C)
+        AOT_GOTO(0x104e, L104e);
+    AOT_GOTO(0x104e, L104e);
+L104e:
+    // 104e: (undefined)
+    AOT_INTERP(0x104e);
+L1050:
+    AOT_BLOCK(0x1050, 1);
+    // 1050: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1052: (undefined)
+    AOT_INTERP(0x1052);
+L1054:
+    AOT_BLOCK(0x1054, 1);
+    // 1054: clrb r0
+    {
+        r[0] = (r[0] & 0xff00) | uint8_t(0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1056: (undefined)
+    AOT_INTERP(0x1056);
+L1058:
+    AOT_BLOCK(0x1058, 1);
+    // 1058: com r0
+    {
+        val = ~int(r[0]);
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = true;
+        V = false;
+    }
+    // 105a: (undefined)
+    AOT_INTERP(0x105a);
+L105c:
+    AOT_BLOCK(0x105c, 1);
+    // 105c: comb r0
+    {
+        val = ~int(uint8_t(r[0]));
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        C = true;
+        V = false;
+    }
+    // 105e: (undefined)
+    AOT_INTERP(0x105e);
+L1060:
+    AOT_BLOCK(0x1060, 1);
+    // 1060: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1062: (undefined)
+    AOT_INTERP(0x1062);
+L1064:
+    AOT_BLOCK(0x1064, 1);
+    // 1064: incb r0
+    {
+        val = int(int8_t(uint8_t(r[0]))) + 1;
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x80;
+    }
+    // 1066: (undefined)
+    AOT_INTERP(0x1066);
+L1068:
+    AOT_BLOCK(0x1068, 1);
+    // 1068: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 106a: (undefined)
+    AOT_INTERP(0x106a);
+L106c:
+    AOT_BLOCK(0x106c, 1);
+    // 106c: decb r0
+    {
+        val = int(int8_t(uint8_t(r[0]))) - 1;
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x81;
+    }
+    // 106e: (undefined)
+    AOT_INTERP(0x106e);
+L1070:
+    AOT_BLOCK(0x1070, 1);
+    // 1070: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    // 1072: (undefined)
+    AOT_INTERP(0x1072);
+L1074:
+    AOT_BLOCK(0x1074, 1);
+    // 1074: negb r0
+    {
+        src = uint8_t(r[0]);
+        val = -int8_t(src);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x80;
+    }
+    // 1076: (undefined)
+    AOT_INTERP(0x1076);
+L1078:
+    AOT_BLOCK(0x1078, 1);
+    // 1078: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    // 107a: (undefined)
+    AOT_INTERP(0x107a);
+L107c:
+    AOT_BLOCK(0x107c, 1);
+    // 107c: adcb r0
+    {
+        val = int(int8_t(uint8_t(r[0]))) + (C ? 1 : 0);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x80;
+    }
+    // 107e: (undefined)
+    AOT_INTERP(0x107e);
+L1080:
+    AOT_BLOCK(0x1080, 1);
+    // 1080: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == -1;
+        V = val == -0x8001;
+    }
+    // 1082: (undefined)
+    AOT_INTERP(0x1082);
+L1084:
+    AOT_BLOCK(0x1084, 1);
+    // 1084: sbcb r0
+    {
+        val = int(int8_t(uint8_t(r[0]))) - (C ? 1 : 0);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == -1;
+        V = val == -0x81;
+    }
+    // 1086: (undefined)
+    AOT_INTERP(0x1086);
+L1088:
+    AOT_BLOCK(0x1088, 1);
+    // 1088: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 108a: (undefined)
+    AOT_INTERP(0x108a);
+L108c:
+    AOT_BLOCK(0x108c, 1);
+    // 108c: tstb r0
+    {
+        val = int8_t(uint8_t(r[0]));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 108e: (undefined)
+    AOT_INTERP(0x108e);
+L1090:
+    AOT_BLOCK(0x1090, 1);
+    // 1090: ror r0
+    {
+        src = r[0];
+        val = (src >> 1) | (C ? 0x8000 : 0);
+        dst = C;
+        r[0] = val;
+        Z = val == 0;
+        N = dst;
+        C = (src & 1) != 0;
+        V = dst != ((src & 1) != 0);
+    }
+    // 1092: (undefined)
+    AOT_INTERP(0x1092);
+L1094:
+    AOT_BLOCK(0x1094, 1);
+    // 1094: rorb r0
+    {
+        src = uint8_t(r[0]);
+        val = src >> 1;
+        if (C) val = uint8_t(val + 0x80);
+        dst = C;
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = dst;
+        C = (src & 1) != 0;
+        V = dst != ((src & 1) != 0);
+    }
+    // 1096: (undefined)
+    AOT_INTERP(0x1096);
+L1098:
+    AOT_BLOCK(0x1098, 1);
+    // 1098: rol r0
+    {
+        src = r[0];
+        val = uint16_t(src << 1) | (C ? 1 : 0);
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = (src & 0x8000) != 0;
+        V = ((val & 0x8000) != 0) != ((src & 0x8000) != 0);
+    }
+    // 109a: (undefined)
+    AOT_INTERP(0x109a);
+L109c:
+    AOT_BLOCK(0x109c, 1);
+    // 109c: rolb r0
+    {
+        src = uint8_t(r[0]);
+        val = uint8_t(((uint32_t(src) << 1) + (C ? 1 : 0)) & 0xff);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        C = (src & 0x80) != 0;
+        V = ((val & 0x80) != 0) != ((src & 0x80) != 0);
+    }
+    // 109e: (undefined)
+    AOT_INTERP(0x109e);
+L10a0:
+    AOT_BLOCK(0x10a0, 1);
+    // 10a0: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 1) != 0;
+        V = (val < 0) != ((src & 1) != 0);
+    }
+    // 10a2: (undefined)
+    AOT_INTERP(0x10a2);
+L10a4:
+    AOT_BLOCK(0x10a4, 1);
+    // 10a4: asrb r0
+    {
+        src = uint8_t(r[0]);
+        val = int8_t(src) >> 1;
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 1) != 0;
+        V = (val < 0) != ((src & 1) != 0);
+    }
+    // 10a6: (undefined)
+    AOT_INTERP(0x10a6);
+L10a8:
+    AOT_BLOCK(0x10a8, 1);
+    // 10a8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 10aa: (undefined)
+    AOT_INTERP(0x10aa);
+L10ac:
+    AOT_BLOCK(0x10ac, 1);
+    // 10ac: aslb r0
+    {
+        src = uint8_t(r[0]);
+        val = uint8_t((uint32_t(src) << 1) & 0xff);
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x80) != 0;
+        V = (val < 0) != ((src & 0x80) != 0);
+    }
+    // 10ae: (undefined)
+    AOT_INTERP(0x10ae);
+L10b0:
+    // 10b0: jmp r0
+    AOT_INTERP(0x10b0);
+L10b2:
+    // 10b2: (undefined)
+    AOT_INTERP(0x10b2);
+L10b4:
+    AOT_BLOCK(0x10b4, 1);
+    // 10b4: swab r0
+    {
+        src = r[0];
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = false;
+        V = false;
+    }
+    // 10b6: (undefined)
+    AOT_INTERP(0x10b6);
+L10b8:
+    // 10b8: jsr r0, r0
+    AOT_INTERP(0x10b8);
+L10ba:
+    // 10ba: (undefined)
+    AOT_INTERP(0x10ba);
+L10bc:
+    AOT_BLOCK(0x10bc, 1);
+    // 10bc: rts r0
+    {
+        b = r[0];
+        r[0] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L11ae:
+    AOT_BLOCK(0x11ae, 2);
+    // 11ae: cmp (sp), $4
+    {
+        a = r[6];
+        src = RD16(a);
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11b2: bge 11b8
+    if (!(N ^ V))
+        AOT_GOTO(0x11b8, L11b8);
+    AOT_GOTO(0x11b4, L11b4);
+L11b4:
+    AOT_BLOCK(0x11b4, 1);
+    // 11b4: jmp 0e76
+    {
+        a = 0x0e76;
+    }
+    AOT_GOTO(0x0e76, L0e76);
+L11b8:
+    AOT_BLOCK(0x11b8, 2);
+    // 11b8: cmp (sp)+, $5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11bc: blt 11c4
+    if (N ^ V)
+        AOT_GOTO(0x11c4, L11c4);
+    AOT_GOTO(0x11be, L11be);
+L11be:
+    AOT_BLOCK(0x11be, 1);
+    // 11be: mov $20, 1434
+    {
+        src = uint16_t(0x0020);
+        b = 0x1434;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x11c4, L11c4);
+L11c4:
+    AOT_BLOCK(0x11c4, 5);
+    // 11c4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 11c6: mov (sp)+, 0eba
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = 0x0eba;
+        WR16(b, src);
+    }
+    // 11ca: mov (sp)+, 0ebc
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = 0x0ebc;
+        WR16(b, src);
+    }
+    // 11ce: mov (sp)+, 0ebe
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = 0x0ebe;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11d2: jsr r5, 0276
+    {
+        a = 0x0276;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x11d6;
+    }
+    AOT_GOTO(0x0276, L0276);
+L11d6:
+    // 11d6: (undefined)
+    AOT_INTERP(0x11d6);
+L11d8:
+    AOT_BLOCK(0x11d8, 2);
+    // 11d8: movb r0, 1446
+    {
+        src = uint8_t(r[0]);
+        b = 0x1446;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 11dc: jsr r5, 0276
+    {
+        a = 0x0276;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x11e0;
+    }
+    AOT_GOTO(0x0276, L0276);
+L11e0:
+    // 11e0: (undefined)
+    AOT_INTERP(0x11e0);
+L11e2:
+    AOT_BLOCK(0x11e2, 2);
+    // 11e2: movb r0, 1440
+    {
+        src = uint8_t(r[0]);
+        b = 0x1440;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 11e6: jsr r5, 0276
+    {
+        a = 0x0276;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x11ea;
+    }
+    AOT_GOTO(0x0276, L0276);
+L11ea:
+    // 11ea: (undefined)
+    AOT_INTERP(0x11ea);
+L11ec:
+    AOT_BLOCK(0x11ec, 2);
+    // 11ec: movb r0, 1448
+    {
+        src = uint8_t(r[0]);
+        b = 0x1448;
+        WR8(b, src);
+    }
+    // 11f0: movb r0, 1442
+    {
+        src = uint8_t(r[0]);
+        b = 0x1442;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 11f4: sys 8
+    AOT_INTERP(0x11f4);
+L11f6:
+    // 11f6: (undefined)
+    AOT_INTERP(0x11f6);
+L11f8:
+    // 11f8: halt
+    AOT_INTERP(0x11f8);
+L11fa:
+    AOT_BLOCK(0x11fa, 1);
+    // 11fa: bcc 1202
+    if (!C)
+        AOT_GOTO(0x1202, L1202);
+    AOT_GOTO(0x11fc, L11fc);
+L11fc:
+    AOT_BLOCK(0x11fc, 1);
+    // 11fc: jsr r5, 01e8
+    {
+        a = 0x01e8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1200;
+    }
+    AOT_GOTO(0x01e8, L01e8);
+L11fe:
+    AOT_BLOCK(0x11fe, 1);
+    // 11fe: sub *2076, *-(r0)
+    {
+        a = RD16(0x2076);
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1202, L1202);
+L1200:
+    // 1200: (undefined)
+    AOT_INTERP(0x1200);
+L1202:
+    AOT_BLOCK(0x1202, 2);
+    // 1202: movb r0, 1458
+    {
+        src = uint8_t(r[0]);
+        b = 0x1458;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1206: jmp 0014
+    {
+        a = 0x0014;
+    }
+    AOT_GOTO(0x0014, L0014);
+}
+
+AotImage image("v6/lib/as2", 0x0000, 5038, 0xb72df427u, run);
+}
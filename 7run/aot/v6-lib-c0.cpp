@@ -0,0 +1,35011 @@
+// v6/lib/c0 translated by 7aot: 1613 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x0004: goto L0004;
+        case 0x0006: goto L0006;
+        case 0x0008: goto L0008;
+        case 0x000c: goto L000c;
+        case 0x0010: goto L0010;
+        case 0x0012: goto L0012;
+        case 0x0014: goto L0014;
+        case 0x0016: goto L0016;
+        case 0x0018: goto L0018;
+        case 0x001a: goto L001a;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0020: goto L0020;
+        case 0x0022: goto L0022;
+        case 0x0024: goto L0024;
+        case 0x002a: goto L002a;
+        case 0x002c: goto L002c;
+        case 0x0030: goto L0030;
+        case 0x0034: goto L0034;
+        case 0x0042: goto L0042;
+        case 0x004a: goto L004a;
+        case 0x004e: goto L004e;
+        case 0x005a: goto L005a;
+        case 0x005c: goto L005c;
+        case 0x0064: goto L0064;
+        case 0x006c: goto L006c;
+        case 0x0074: goto L0074;
+        case 0x0078: goto L0078;
+        case 0x007a: goto L007a;
+        case 0x008a: goto L008a;
+        case 0x0090: goto L0090;
+        case 0x0098: goto L0098;
+        case 0x00a0: goto L00a0;
+        case 0x00a8: goto L00a8;
+        case 0x00ac: goto L00ac;
+        case 0x00b0: goto L00b0;
+        case 0x00b4: goto L00b4;
+        case 0x00b6: goto L00b6;
+        case 0x00ba: goto L00ba;
+        case 0x00c0: goto L00c0;
+        case 0x00d8: goto L00d8;
+        case 0x00de: goto L00de;
+        case 0x00e2: goto L00e2;
+        case 0x00e6: goto L00e6;
+        case 0x00e8: goto L00e8;
+        case 0x00f2: goto L00f2;
+        case 0x0102: goto L0102;
+        case 0x0108: goto L0108;
+        case 0x010c: goto L010c;
+        case 0x0114: goto L0114;
+        case 0x011a: goto L011a;
+        case 0x011e: goto L011e;
+        case 0x0122: goto L0122;
+        case 0x0126: goto L0126;
+        case 0x012a: goto L012a;
+        case 0x013e: goto L013e;
+        case 0x0140: goto L0140;
+        case 0x0146: goto L0146;
+        case 0x014e: goto L014e;
+        case 0x016a: goto L016a;
+        case 0x016e: goto L016e;
+        case 0x0172: goto L0172;
+        case 0x0178: goto L0178;
+        case 0x0182: goto L0182;
+        case 0x0186: goto L0186;
+        case 0x018c: goto L018c;
+        case 0x0190: goto L0190;
+        case 0x0192: goto L0192;
+        case 0x019c: goto L019c;
+        case 0x01a6: goto L01a6;
+        case 0x01aa: goto L01aa;
+        case 0x01ac: goto L01ac;
+        case 0x01b6: goto L01b6;
+        case 0x01b8: goto L01b8;
+        case 0x01c0: goto L01c0;
+        case 0x01c8: goto L01c8;
+        case 0x01e6: goto L01e6;
+        case 0x01ec: goto L01ec;
+        case 0x01f0: goto L01f0;
+        case 0x01fa: goto L01fa;
+        case 0x01fe: goto L01fe;
+        case 0x0212: goto L0212;
+        case 0x0216: goto L0216;
+        case 0x021a: goto L021a;
+        case 0x021e: goto L021e;
+        case 0x0222: goto L0222;
+        case 0x0226: goto L0226;
+        case 0x022a: goto L022a;
+        case 0x0236: goto L0236;
+        case 0x0238: goto L0238;
+        case 0x023e: goto L023e;
+        case 0x0242: goto L0242;
+        case 0x0246: goto L0246;
+        case 0x0250: goto L0250;
+        case 0x0260: goto L0260;
+        case 0x0264: goto L0264;
+        case 0x026a: goto L026a;
+        case 0x0270: goto L0270;
+        case 0x027a: goto L027a;
+        case 0x0280: goto L0280;
+        case 0x0286: goto L0286;
+        case 0x028a: goto L028a;
+        case 0x028c: goto L028c;
+        case 0x0294: goto L0294;
+        case 0x029e: goto L029e;
+        case 0x02a2: goto L02a2;
+        case 0x02a8: goto L02a8;
+        case 0x02ac: goto L02ac;
+        case 0x02b0: goto L02b0;
+        case 0x02b4: goto L02b4;
+        case 0x02b8: goto L02b8;
+        case 0x02c2: goto L02c2;
+        case 0x02d0: goto L02d0;
+        case 0x02d6: goto L02d6;
+        case 0x02ea: goto L02ea;
+        case 0x02f6: goto L02f6;
+        case 0x02fc: goto L02fc;
+        case 0x030a: goto L030a;
+        case 0x0310: goto L0310;
+        case 0x0318: goto L0318;
+        case 0x031c: goto L031c;
+        case 0x0324: goto L0324;
+        case 0x032a: goto L032a;
+        case 0x032e: goto L032e;
+        case 0x0334: goto L0334;
+        case 0x033a: goto L033a;
+        case 0x0340: goto L0340;
+        case 0x0346: goto L0346;
+        case 0x034e: goto L034e;
+        case 0x0352: goto L0352;
+        case 0x035c: goto L035c;
+        case 0x0362: goto L0362;
+        case 0x036a: goto L036a;
+        case 0x0376: goto L0376;
+        case 0x0382: goto L0382;
+        case 0x0388: goto L0388;
+        case 0x0390: goto L0390;
+        case 0x03a0: goto L03a0;
+        case 0x03a6: goto L03a6;
+        case 0x03b2: goto L03b2;
+        case 0x03b8: goto L03b8;
+        case 0x03c0: goto L03c0;
+        case 0x03d0: goto L03d0;
+        case 0x03d6: goto L03d6;
+        case 0x03e6: goto L03e6;
+        case 0x03ec: goto L03ec;
+        case 0x03fa: goto L03fa;
+        case 0x0400: goto L0400;
+        case 0x0408: goto L0408;
+        case 0x040c: goto L040c;
+        case 0x0412: goto L0412;
+        case 0x041c: goto L041c;
+        case 0x0420: goto L0420;
+        case 0x0426: goto L0426;
+        case 0x042e: goto L042e;
+        case 0x0434: goto L0434;
+        case 0x0436: goto L0436;
+        case 0x0442: goto L0442;
+        case 0x0448: goto L0448;
+        case 0x0452: goto L0452;
+        case 0x0458: goto L0458;
+        case 0x045c: goto L045c;
+        case 0x0460: goto L0460;
+        case 0x0468: goto L0468;
+        case 0x0472: goto L0472;
+        case 0x0476: goto L0476;
+        case 0x047a: goto L047a;
+        case 0x047c: goto L047c;
+        case 0x0480: goto L0480;
+        case 0x0482: goto L0482;
+        case 0x048c: goto L048c;
+        case 0x0494: goto L0494;
+        case 0x049c: goto L049c;
+        case 0x04a4: goto L04a4;
+        case 0x04aa: goto L04aa;
+        case 0x04ac: goto L04ac;
+        case 0x04b0: goto L04b0;
+        case 0x04b4: goto L04b4;
+        case 0x04ba: goto L04ba;
+        case 0x04be: goto L04be;
+        case 0x04c6: goto L04c6;
+        case 0x04ce: goto L04ce;
+        case 0x04d6: goto L04d6;
+        case 0x04da: goto L04da;
+        case 0x04de: goto L04de;
+        case 0x04ee: goto L04ee;
+        case 0x04f2: goto L04f2;
+        case 0x0502: goto L0502;
+        case 0x0506: goto L0506;
+        case 0x050e: goto L050e;
+        case 0x0512: goto L0512;
+        case 0x051a: goto L051a;
+        case 0x052c: goto L052c;
+        case 0x0530: goto L0530;
+        case 0x0534: goto L0534;
+        case 0x053a: goto L053a;
+        case 0x053e: goto L053e;
+        case 0x0546: goto L0546;
+        case 0x054c: goto L054c;
+        case 0x0552: goto L0552;
+        case 0x055c: goto L055c;
+        case 0x0560: goto L0560;
+        case 0x056e: goto L056e;
+        case 0x0576: goto L0576;
+        case 0x057c: goto L057c;
+        case 0x0586: goto L0586;
+        case 0x0592: goto L0592;
+        case 0x0596: goto L0596;
+        case 0x05aa: goto L05aa;
+        case 0x05ae: goto L05ae;
+        case 0x05b8: goto L05b8;
+        case 0x05d0: goto L05d0;
+        case 0x05d6: goto L05d6;
+        case 0x05e2: goto L05e2;
+        case 0x05e4: goto L05e4;
+        case 0x05e8: goto L05e8;
+        case 0x05ee: goto L05ee;
+        case 0x05fe: goto L05fe;
+        case 0x0602: goto L0602;
+        case 0x060a: goto L060a;
+        case 0x0612: goto L0612;
+        case 0x0620: goto L0620;
+        case 0x0628: goto L0628;
+        case 0x062e: goto L062e;
+        case 0x0638: goto L0638;
+        case 0x063a: goto L063a;
+        case 0x063c: goto L063c;
+        case 0x0642: goto L0642;
+        case 0x064a: goto L064a;
+        case 0x0650: goto L0650;
+        case 0x0654: goto L0654;
+        case 0x0662: goto L0662;
+        case 0x0666: goto L0666;
+        case 0x066e: goto L066e;
+        case 0x0672: goto L0672;
+        case 0x0674: goto L0674;
+        case 0x0678: goto L0678;
+        case 0x067e: goto L067e;
+        case 0x0682: goto L0682;
+        case 0x068a: goto L068a;
+        case 0x0694: goto L0694;
+        case 0x0698: goto L0698;
+        case 0x069e: goto L069e;
+        case 0x06a4: goto L06a4;
+        case 0x06aa: goto L06aa;
+        case 0x06b0: goto L06b0;
+        case 0x06b4: goto L06b4;
+        case 0x06bc: goto L06bc;
+        case 0x06c2: goto L06c2;
+        case 0x06c8: goto L06c8;
+        case 0x06d8: goto L06d8;
+        case 0x06dc: goto L06dc;
+        case 0x06e4: goto L06e4;
+        case 0x06ea: goto L06ea;
+        case 0x06f0: goto L06f0;
+        case 0x06f4: goto L06f4;
+        case 0x06fc: goto L06fc;
+        case 0x0702: goto L0702;
+        case 0x0706: goto L0706;
+        case 0x0708: goto L0708;
+        case 0x070a: goto L070a;
+        case 0x0714: goto L0714;
+        case 0x0718: goto L0718;
+        case 0x071c: goto L071c;
+        case 0x071e: goto L071e;
+        case 0x0726: goto L0726;
+        case 0x072a: goto L072a;
+        case 0x072e: goto L072e;
+        case 0x0732: goto L0732;
+        case 0x0736: goto L0736;
+        case 0x076c: goto L076c;
+        case 0x0770: goto L0770;
+        case 0x0778: goto L0778;
+        case 0x0780: goto L0780;
+        case 0x0786: goto L0786;
+        case 0x078a: goto L078a;
+        case 0x0790: goto L0790;
+        case 0x079c: goto L079c;
+        case 0x07a2: goto L07a2;
+        case 0x07a8: goto L07a8;
+        case 0x07b4: goto L07b4;
+        case 0x07be: goto L07be;
+        case 0x07c4: goto L07c4;
+        case 0x07d0: goto L07d0;
+        case 0x07d6: goto L07d6;
+        case 0x07dc: goto L07dc;
+        case 0x07f8: goto L07f8;
+        case 0x07fc: goto L07fc;
+        case 0x0808: goto L0808;
+        case 0x080c: goto L080c;
+        case 0x0810: goto L0810;
+        case 0x081a: goto L081a;
+        case 0x082a: goto L082a;
+        case 0x0832: goto L0832;
+        case 0x084e: goto L084e;
+        case 0x085c: goto L085c;
+        case 0x0864: goto L0864;
+        case 0x086c: goto L086c;
+        case 0x0874: goto L0874;
+        case 0x0878: goto L0878;
+        case 0x087c: goto L087c;
+        case 0x0884: goto L0884;
+        case 0x0888: goto L0888;
+        case 0x088c: goto L088c;
+        case 0x088e: goto L088e;
+        case 0x0892: goto L0892;
+        case 0x0896: goto L0896;
+        case 0x0898: goto L0898;
+        case 0x089c: goto L089c;
+        case 0x08a0: goto L08a0;
+        case 0x08aa: goto L08aa;
+        case 0x08ac: goto L08ac;
+        case 0x08b0: goto L08b0;
+        case 0x08b2: goto L08b2;
+        case 0x08b8: goto L08b8;
+        case 0x08c0: goto L08c0;
+        case 0x08c2: goto L08c2;
+        case 0x08c8: goto L08c8;
+        case 0x08da: goto L08da;
+        case 0x08de: goto L08de;
+        case 0x08e2: goto L08e2;
+        case 0x08e6: goto L08e6;
+        case 0x08ea: goto L08ea;
+        case 0x08f0: goto L08f0;
+        case 0x08f6: goto L08f6;
+        case 0x08fa: goto L08fa;
+        case 0x08fc: goto L08fc;
+        case 0x0900: goto L0900;
+        case 0x0904: goto L0904;
+        case 0x090c: goto L090c;
+        case 0x0912: goto L0912;
+        case 0x091c: goto L091c;
+        case 0x091e: goto L091e;
+        case 0x0922: goto L0922;
+        case 0x0926: goto L0926;
+        case 0x0928: goto L0928;
+        case 0x0930: goto L0930;
+        case 0x0942: goto L0942;
+        case 0x0946: goto L0946;
+        case 0x094a: goto L094a;
+        case 0x094e: goto L094e;
+        case 0x0952: goto L0952;
+        case 0x0954: goto L0954;
+        case 0x096e: goto L096e;
+        case 0x0974: goto L0974;
+        case 0x097a: goto L097a;
+        case 0x0980: goto L0980;
+        case 0x098e: goto L098e;
+        case 0x0996: goto L0996;
+        case 0x09a2: goto L09a2;
+        case 0x09a6: goto L09a6;
+        case 0x09ae: goto L09ae;
+        case 0x09b6: goto L09b6;
+        case 0x09be: goto L09be;
+        case 0x09c2: goto L09c2;
+        case 0x09c6: goto L09c6;
+        case 0x09d2: goto L09d2;
+        case 0x09da: goto L09da;
+        case 0x09e2: goto L09e2;
+        case 0x09fc: goto L09fc;
+        case 0x0a12: goto L0a12;
+        case 0x0a1c: goto L0a1c;
+        case 0x0a28: goto L0a28;
+        case 0x0a2e: goto L0a2e;
+        case 0x0a36: goto L0a36;
+        case 0x0a3a: goto L0a3a;
+        case 0x0a46: goto L0a46;
+        case 0x0a5c: goto L0a5c;
+        case 0x0a70: goto L0a70;
+        case 0x0a80: goto L0a80;
+        case 0x0a86: goto L0a86;
+        case 0x0a8a: goto L0a8a;
+        case 0x0a90: goto L0a90;
+        case 0x0a98: goto L0a98;
+        case 0x0a9e: goto L0a9e;
+        case 0x0ab0: goto L0ab0;
+        case 0x0ab4: goto L0ab4;
+        case 0x0ab8: goto L0ab8;
+        case 0x0ac0: goto L0ac0;
+        case 0x0ac4: goto L0ac4;
+        case 0x0acc: goto L0acc;
+        case 0x0ad2: goto L0ad2;
+        case 0x0ad6: goto L0ad6;
+        case 0x0ada: goto L0ada;
+        case 0x0aee: goto L0aee;
+        case 0x0b08: goto L0b08;
+        case 0x0b0e: goto L0b0e;
+        case 0x0b1e: goto L0b1e;
+        case 0x0b26: goto L0b26;
+        case 0x0b3c: goto L0b3c;
+        case 0x0b4a: goto L0b4a;
+        case 0x0b52: goto L0b52;
+        case 0x0b58: goto L0b58;
+        case 0x0b5c: goto L0b5c;
+        case 0x0b60: goto L0b60;
+        case 0x0b70: goto L0b70;
+        case 0x0b78: goto L0b78;
+        case 0x0b7e: goto L0b7e;
+        case 0x0b92: goto L0b92;
+        case 0x0ba0: goto L0ba0;
+        case 0x0ba6: goto L0ba6;
+        case 0x0bae: goto L0bae;
+        case 0x0bc0: goto L0bc0;
+        case 0x0bc6: goto L0bc6;
+        case 0x0bd0: goto L0bd0;
+        case 0x0be6: goto L0be6;
+        case 0x0bee: goto L0bee;
+        case 0x0bf4: goto L0bf4;
+        case 0x0bfe: goto L0bfe;
+        case 0x0c04: goto L0c04;
+        case 0x0c06: goto L0c06;
+        case 0x0c1a: goto L0c1a;
+        case 0x0c28: goto L0c28;
+        case 0x0c2e: goto L0c2e;
+        case 0x0c36: goto L0c36;
+        case 0x0c3c: goto L0c3c;
+        case 0x0c52: goto L0c52;
+        case 0x0c64: goto L0c64;
+        case 0x0c70: goto L0c70;
+        case 0x0c78: goto L0c78;
+        case 0x0c86: goto L0c86;
+        case 0x0c96: goto L0c96;
+        case 0x0ca8: goto L0ca8;
+        case 0x0cae: goto L0cae;
+        case 0x0cbe: goto L0cbe;
+        case 0x0cca: goto L0cca;
+        case 0x0cd2: goto L0cd2;
+        case 0x0cde: goto L0cde;
+        case 0x0cee: goto L0cee;
+        case 0x0d00: goto L0d00;
+        case 0x0d06: goto L0d06;
+        case 0x0d16: goto L0d16;
+        case 0x0d2e: goto L0d2e;
+        case 0x0d34: goto L0d34;
+        case 0x0d40: goto L0d40;
+        case 0x0d50: goto L0d50;
+        case 0x0d62: goto L0d62;
+        case 0x0d6a: goto L0d6a;
+        case 0x0d6e: goto L0d6e;
+        case 0x0d82: goto L0d82;
+        case 0x0d92: goto L0d92;
+        case 0x0d9c: goto L0d9c;
+        case 0x0da2: goto L0da2;
+        case 0x0daa: goto L0daa;
+        case 0x0db2: goto L0db2;
+        case 0x0dba: goto L0dba;
+        case 0x0dd8: goto L0dd8;
+        case 0x0de0: goto L0de0;
+        case 0x0de8: goto L0de8;
+        case 0x0df6: goto L0df6;
+        case 0x0e00: goto L0e00;
+        case 0x0e16: goto L0e16;
+        case 0x0e2c: goto L0e2c;
+        case 0x0e3a: goto L0e3a;
+        case 0x0e42: goto L0e42;
+        case 0x0e4a: goto L0e4a;
+        case 0x0e6a: goto L0e6a;
+        case 0x0e78: goto L0e78;
+        case 0x0e7e: goto L0e7e;
+        case 0x0e90: goto L0e90;
+        case 0x0e94: goto L0e94;
+        case 0x0e98: goto L0e98;
+        case 0x0ea0: goto L0ea0;
+        case 0x0ea6: goto L0ea6;
+        case 0x0eae: goto L0eae;
+        case 0x0eb8: goto L0eb8;
+        case 0x0eba: goto L0eba;
+        case 0x0ec2: goto L0ec2;
+        case 0x0ecc: goto L0ecc;
+        case 0x0ece: goto L0ece;
+        case 0x0ed6: goto L0ed6;
+        case 0x0ede: goto L0ede;
+        case 0x0ee4: goto L0ee4;
+        case 0x0eec: goto L0eec;
+        case 0x0eee: goto L0eee;
+        case 0x0efa: goto L0efa;
+        case 0x0f00: goto L0f00;
+        case 0x0f14: goto L0f14;
+        case 0x0f22: goto L0f22;
+        case 0x0f26: goto L0f26;
+        case 0x0f30: goto L0f30;
+        case 0x0f38: goto L0f38;
+        case 0x0f40: goto L0f40;
+        case 0x0f48: goto L0f48;
+        case 0x0f50: goto L0f50;
+        case 0x0f5e: goto L0f5e;
+        case 0x0f66: goto L0f66;
+        case 0x0f6e: goto L0f6e;
+        case 0x0f7e: goto L0f7e;
+        case 0x0f9a: goto L0f9a;
+        case 0x0fa0: goto L0fa0;
+        case 0x0fa2: goto L0fa2;
+        case 0x0fae: goto L0fae;
+        case 0x0fba: goto L0fba;
+        case 0x0fc2: goto L0fc2;
+        case 0x0fca: goto L0fca;
+        case 0x0fd4: goto L0fd4;
+        case 0x0fda: goto L0fda;
+        case 0x0fe0: goto L0fe0;
+        case 0x0fe6: goto L0fe6;
+        case 0x0fee: goto L0fee;
+        case 0x0ff4: goto L0ff4;
+        case 0x0ffa: goto L0ffa;
+        case 0x1000: goto L1000;
+        case 0x1008: goto L1008;
+        case 0x100e: goto L100e;
+        case 0x1010: goto L1010;
+        case 0x1016: goto L1016;
+        case 0x101e: goto L101e;
+        case 0x1024: goto L1024;
+        case 0x102c: goto L102c;
+        case 0x1030: goto L1030;
+        case 0x1036: goto L1036;
+        case 0x1038: goto L1038;
+        case 0x1044: goto L1044;
+        case 0x104e: goto L104e;
+        case 0x1054: goto L1054;
+        case 0x105a: goto L105a;
+        case 0x1060: goto L1060;
+        case 0x1066: goto L1066;
+        case 0x106c: goto L106c;
+        case 0x1074: goto L1074;
+        case 0x1080: goto L1080;
+        case 0x1088: goto L1088;
+        case 0x108e: goto L108e;
+        case 0x1096: goto L1096;
+        case 0x1098: goto L1098;
+        case 0x109e: goto L109e;
+        case 0x10b0: goto L10b0;
+        case 0x10b8: goto L10b8;
+        case 0x10c8: goto L10c8;
+        case 0x10ce: goto L10ce;
+        case 0x10d6: goto L10d6;
+        case 0x10da: goto L10da;
+        case 0x10e6: goto L10e6;
+        case 0x10ec: goto L10ec;
+        case 0x10f6: goto L10f6;
+        case 0x10fa: goto L10fa;
+        case 0x10fc: goto L10fc;
+        case 0x1110: goto L1110;
+        case 0x111e: goto L111e;
+        case 0x1124: goto L1124;
+        case 0x112a: goto L112a;
+        case 0x113c: goto L113c;
+        case 0x114a: goto L114a;
+        case 0x1158: goto L1158;
+        case 0x115c: goto L115c;
+        case 0x1166: goto L1166;
+        case 0x116e: goto L116e;
+        case 0x1174: goto L1174;
+        case 0x1188: goto L1188;
+        case 0x11a0: goto L11a0;
+        case 0x11a6: goto L11a6;
+        case 0x11aa: goto L11aa;
+        case 0x11b2: goto L11b2;
+        case 0x11b8: goto L11b8;
+        case 0x11be: goto L11be;
+        case 0x11c4: goto L11c4;
+        case 0x11ca: goto L11ca;
+        case 0x11d0: goto L11d0;
+        case 0x11d6: goto L11d6;
+        case 0x11de: goto L11de;
+        case 0x11e8: goto L11e8;
+        case 0x11ee: goto L11ee;
+        case 0x1202: goto L1202;
+        case 0x1208: goto L1208;
+        case 0x120c: goto L120c;
+        case 0x1226: goto L1226;
+        case 0x122a: goto L122a;
+        case 0x122e: goto L122e;
+        case 0x1236: goto L1236;
+        case 0x1242: goto L1242;
+        case 0x1246: goto L1246;
+        case 0x124e: goto L124e;
+        case 0x125a: goto L125a;
+        case 0x125e: goto L125e;
+        case 0x126a: goto L126a;
+        case 0x126e: goto L126e;
+        case 0x1278: goto L1278;
+        case 0x127e: goto L127e;
+        case 0x1282: goto L1282;
+        case 0x129a: goto L129a;
+        case 0x12a6: goto L12a6;
+        case 0x12b6: goto L12b6;
+        case 0x12bc: goto L12bc;
+        case 0x12c0: goto L12c0;
+        case 0x12c4: goto L12c4;
+        case 0x12dc: goto L12dc;
+        case 0x12e2: goto L12e2;
+        case 0x12ea: goto L12ea;
+        case 0x12ee: goto L12ee;
+        case 0x1306: goto L1306;
+        case 0x1310: goto L1310;
+        case 0x131a: goto L131a;
+        case 0x1326: goto L1326;
+        case 0x132a: goto L132a;
+        case 0x133c: goto L133c;
+        case 0x1342: goto L1342;
+        case 0x1348: goto L1348;
+        case 0x1350: goto L1350;
+        case 0x1352: goto L1352;
+        case 0x1356: goto L1356;
+        case 0x1360: goto L1360;
+        case 0x1364: goto L1364;
+        case 0x136a: goto L136a;
+        case 0x1370: goto L1370;
+        case 0x1378: goto L1378;
+        case 0x137e: goto L137e;
+        case 0x1384: goto L1384;
+        case 0x1388: goto L1388;
+        case 0x139c: goto L139c;
+        case 0x13be: goto L13be;
+        case 0x13ca: goto L13ca;
+        case 0x13ce: goto L13ce;
+        case 0x13e2: goto L13e2;
+        case 0x13ee: goto L13ee;
+        case 0x13f4: goto L13f4;
+        case 0x13fa: goto L13fa;
+        case 0x13fe: goto L13fe;
+        case 0x1418: goto L1418;
+        case 0x1420: goto L1420;
+        case 0x1428: goto L1428;
+        case 0x142c: goto L142c;
+        case 0x1430: goto L1430;
+        case 0x143e: goto L143e;
+        case 0x1444: goto L1444;
+        case 0x144c: goto L144c;
+        case 0x1450: goto L1450;
+        case 0x145e: goto L145e;
+        case 0x1464: goto L1464;
+        case 0x146c: goto L146c;
+        case 0x1470: goto L1470;
+        case 0x1482: goto L1482;
+        case 0x1486: goto L1486;
+        case 0x148a: goto L148a;
+        case 0x1492: goto L1492;
+        case 0x149c: goto L149c;
+        case 0x14a6: goto L14a6;
+        case 0x14ae: goto L14ae;
+        case 0x14b2: goto L14b2;
+        case 0x14ba: goto L14ba;
+        case 0x14c2: goto L14c2;
+        case 0x14ca: goto L14ca;
+        case 0x14ce: goto L14ce;
+        case 0x14d6: goto L14d6;
+        case 0x14dc: goto L14dc;
+        case 0x14e6: goto L14e6;
+        case 0x14ec: goto L14ec;
+        case 0x1500: goto L1500;
+        case 0x1504: goto L1504;
+        case 0x1510: goto L1510;
+        case 0x1514: goto L1514;
+        case 0x151a: goto L151a;
+        case 0x1522: goto L1522;
+        case 0x152c: goto L152c;
+        case 0x1530: goto L1530;
+        case 0x153c: goto L153c;
+        case 0x1542: goto L1542;
+        case 0x1546: goto L1546;
+        case 0x154c: goto L154c;
+        case 0x1550: goto L1550;
+        case 0x1574: goto L1574;
+        case 0x157e: goto L157e;
+        case 0x1586: goto L1586;
+        case 0x158e: goto L158e;
+        case 0x1592: goto L1592;
+        case 0x15a6: goto L15a6;
+        case 0x15b2: goto L15b2;
+        case 0x15ce: goto L15ce;
+        case 0x15e2: goto L15e2;
+        case 0x15e6: goto L15e6;
+        case 0x15f0: goto L15f0;
+        case 0x15f8: goto L15f8;
+        case 0x1600: goto L1600;
+        case 0x160e: goto L160e;
+        case 0x1610: goto L1610;
+        case 0x1612: goto L1612;
+        case 0x1618: goto L1618;
+        case 0x161c: goto L161c;
+        case 0x1624: goto L1624;
+        case 0x162a: goto L162a;
+        case 0x1630: goto L1630;
+        case 0x1638: goto L1638;
+        case 0x163e: goto L163e;
+        case 0x1646: goto L1646;
+        case 0x164c: goto L164c;
+        case 0x1652: goto L1652;
+        case 0x1656: goto L1656;
+        case 0x1672: goto L1672;
+        case 0x167e: goto L167e;
+        case 0x1692: goto L1692;
+        case 0x169c: goto L169c;
+        case 0x16a4: goto L16a4;
+        case 0x16ac: goto L16ac;
+        case 0x16c0: goto L16c0;
+        case 0x16cc: goto L16cc;
+        case 0x16e0: goto L16e0;
+        case 0x16ec: goto L16ec;
+        case 0x1702: goto L1702;
+        case 0x1706: goto L1706;
+        case 0x170c: goto L170c;
+        case 0x1710: goto L1710;
+        case 0x1718: goto L1718;
+        case 0x172e: goto L172e;
+        case 0x1742: goto L1742;
+        case 0x1746: goto L1746;
+        case 0x1750: goto L1750;
+        case 0x1758: goto L1758;
+        case 0x177a: goto L177a;
+        case 0x1782: goto L1782;
+        case 0x179c: goto L179c;
+        case 0x17a4: goto L17a4;
+        case 0x17ae: goto L17ae;
+        case 0x17c0: goto L17c0;
+        case 0x17ca: goto L17ca;
+        case 0x17d4: goto L17d4;
+        case 0x17dc: goto L17dc;
+        case 0x17e2: goto L17e2;
+        case 0x17e4: goto L17e4;
+        case 0x17fc: goto L17fc;
+        case 0x1802: goto L1802;
+        case 0x1808: goto L1808;
+        case 0x1818: goto L1818;
+        case 0x182c: goto L182c;
+        case 0x182e: goto L182e;
+        case 0x1852: goto L1852;
+        case 0x1856: goto L1856;
+        case 0x186c: goto L186c;
+        case 0x1870: goto L1870;
+        case 0x1874: goto L1874;
+        case 0x1886: goto L1886;
+        case 0x1898: goto L1898;
+        case 0x189a: goto L189a;
+        case 0x18a0: goto L18a0;
+        case 0x18b2: goto L18b2;
+        case 0x18ba: goto L18ba;
+        case 0x18ca: goto L18ca;
+        case 0x18d6: goto L18d6;
+        case 0x18d8: goto L18d8;
+        case 0x18dc: goto L18dc;
+        case 0x18f0: goto L18f0;
+        case 0x18fa: goto L18fa;
+        case 0x1902: goto L1902;
+        case 0x190c: goto L190c;
+        case 0x1910: goto L1910;
+        case 0x1916: goto L1916;
+        case 0x191e: goto L191e;
+        case 0x1936: goto L1936;
+        case 0x1942: goto L1942;
+        case 0x194a: goto L194a;
+        case 0x1952: goto L1952;
+        case 0x1958: goto L1958;
+        case 0x1960: goto L1960;
+        case 0x196a: goto L196a;
+        case 0x1970: goto L1970;
+        case 0x1980: goto L1980;
+        case 0x1984: goto L1984;
+        case 0x198a: goto L198a;
+        case 0x199a: goto L199a;
+        case 0x199e: goto L199e;
+        case 0x19a4: goto L19a4;
+        case 0x19aa: goto L19aa;
+        case 0x19b2: goto L19b2;
+        case 0x19b8: goto L19b8;
+        case 0x19ba: goto L19ba;
+        case 0x19cc: goto L19cc;
+        case 0x19d6: goto L19d6;
+        case 0x19d8: goto L19d8;
+        case 0x19da: goto L19da;
+        case 0x19de: goto L19de;
+        case 0x19e0: goto L19e0;
+        case 0x19e2: goto L19e2;
+        case 0x19e4: goto L19e4;
+        case 0x19e6: goto L19e6;
+        case 0x19f2: goto L19f2;
+        case 0x19f8: goto L19f8;
+        case 0x19fa: goto L19fa;
+        case 0x1a0a: goto L1a0a;
+        case 0x1a0e: goto L1a0e;
+        case 0x1a14: goto L1a14;
+        case 0x1a1a: goto L1a1a;
+        case 0x1a1e: goto L1a1e;
+        case 0x1a20: goto L1a20;
+        case 0x1a2a: goto L1a2a;
+        case 0x1a30: goto L1a30;
+        case 0x1a36: goto L1a36;
+        case 0x1a3a: goto L1a3a;
+        case 0x1a46: goto L1a46;
+        case 0x1a4a: goto L1a4a;
+        case 0x1a52: goto L1a52;
+        case 0x1a56: goto L1a56;
+        case 0x1a5e: goto L1a5e;
+        case 0x1a66: goto L1a66;
+        case 0x1a6a: goto L1a6a;
+        case 0x1a70: goto L1a70;
+        case 0x1a76: goto L1a76;
+        case 0x1a8a: goto L1a8a;
+        case 0x1a8c: goto L1a8c;
+        case 0x1a90: goto L1a90;
+        case 0x1a9e: goto L1a9e;
+        case 0x1aa0: goto L1aa0;
+        case 0x1aa6: goto L1aa6;
+        case 0x1aaa: goto L1aaa;
+        case 0x1ab2: goto L1ab2;
+        case 0x1ab6: goto L1ab6;
+        case 0x1ac0: goto L1ac0;
+        case 0x1ac2: goto L1ac2;
+        case 0x1aca: goto L1aca;
+        case 0x1ace: goto L1ace;
+        case 0x1ad6: goto L1ad6;
+        case 0x1ada: goto L1ada;
+        case 0x1ade: goto L1ade;
+        case 0x1ae4: goto L1ae4;
+        case 0x1ae6: goto L1ae6;
+        case 0x1aea: goto L1aea;
+        case 0x1aee: goto L1aee;
+        case 0x1af2: goto L1af2;
+        case 0x1af6: goto L1af6;
+        case 0x1afa: goto L1afa;
+        case 0x1b04: goto L1b04;
+        case 0x1b0c: goto L1b0c;
+        case 0x1b12: goto L1b12;
+        case 0x1b16: goto L1b16;
+        case 0x1b1a: goto L1b1a;
+        case 0x1b2e: goto L1b2e;
+        case 0x1b34: goto L1b34;
+        case 0x1b3a: goto L1b3a;
+        case 0x1b3c: goto L1b3c;
+        case 0x1b40: goto L1b40;
+        case 0x1b46: goto L1b46;
+        case 0x1b4c: goto L1b4c;
+        case 0x1b60: goto L1b60;
+        case 0x1b66: goto L1b66;
+        case 0x1b6c: goto L1b6c;
+        case 0x1b70: goto L1b70;
+        case 0x1b76: goto L1b76;
+        case 0x1b7a: goto L1b7a;
+        case 0x1b80: goto L1b80;
+        case 0x1b8e: goto L1b8e;
+        case 0x1b90: goto L1b90;
+        case 0x1b94: goto L1b94;
+        case 0x1b9c: goto L1b9c;
+        case 0x1ba0: goto L1ba0;
+        case 0x1ba4: goto L1ba4;
+        case 0x1bac: goto L1bac;
+        case 0x1bb4: goto L1bb4;
+        case 0x1bb8: goto L1bb8;
+        case 0x1bc2: goto L1bc2;
+        case 0x1bcc: goto L1bcc;
+        case 0x1bd2: goto L1bd2;
+        case 0x1bea: goto L1bea;
+        case 0x1bf2: goto L1bf2;
+        case 0x1bf6: goto L1bf6;
+        case 0x1bfe: goto L1bfe;
+        case 0x1c06: goto L1c06;
+        case 0x1c14: goto L1c14;
+        case 0x1c1a: goto L1c1a;
+        case 0x1c20: goto L1c20;
+        case 0x1c26: goto L1c26;
+        case 0x1c2a: goto L1c2a;
+        case 0x1c34: goto L1c34;
+        case 0x1c38: goto L1c38;
+        case 0x1c52: goto L1c52;
+        case 0x1c66: goto L1c66;
+        case 0x1c6c: goto L1c6c;
+        case 0x1c74: goto L1c74;
+        case 0x1c7c: goto L1c7c;
+        case 0x1c84: goto L1c84;
+        case 0x1c90: goto L1c90;
+        case 0x1c98: goto L1c98;
+        case 0x1ca0: goto L1ca0;
+        case 0x1ca4: goto L1ca4;
+        case 0x1cac: goto L1cac;
+        case 0x1cb4: goto L1cb4;
+        case 0x1cb8: goto L1cb8;
+        case 0x1ce6: goto L1ce6;
+        case 0x1cec: goto L1cec;
+        case 0x1cf4: goto L1cf4;
+        case 0x1cfc: goto L1cfc;
+        case 0x1d04: goto L1d04;
+        case 0x1d0c: goto L1d0c;
+        case 0x1d18: goto L1d18;
+        case 0x1d1e: goto L1d1e;
+        case 0x1d28: goto L1d28;
+        case 0x1d30: goto L1d30;
+        case 0x1d34: goto L1d34;
+        case 0x1d38: goto L1d38;
+        case 0x1d3e: goto L1d3e;
+        case 0x1d46: goto L1d46;
+        case 0x1d4a: goto L1d4a;
+        case 0x1d50: goto L1d50;
+        case 0x1d58: goto L1d58;
+        case 0x1d5c: goto L1d5c;
+        case 0x1d64: goto L1d64;
+        case 0x1d6c: goto L1d6c;
+        case 0x1d6e: goto L1d6e;
+        case 0x1d8e: goto L1d8e;
+        case 0x1d92: goto L1d92;
+        case 0x1da4: goto L1da4;
+        case 0x1db4: goto L1db4;
+        case 0x1dca: goto L1dca;
+        case 0x1dd4: goto L1dd4;
+        case 0x1dd8: goto L1dd8;
+        case 0x1de0: goto L1de0;
+        case 0x1de6: goto L1de6;
+        case 0x1dee: goto L1dee;
+        case 0x1df2: goto L1df2;
+        case 0x1dfa: goto L1dfa;
+        case 0x1dfe: goto L1dfe;
+        case 0x1e10: goto L1e10;
+        case 0x1e14: goto L1e14;
+        case 0x1e34: goto L1e34;
+        case 0x1e38: goto L1e38;
+        case 0x1e40: goto L1e40;
+        case 0x1e4c: goto L1e4c;
+        case 0x1e56: goto L1e56;
+        case 0x1e5c: goto L1e5c;
+        case 0x1e64: goto L1e64;
+        case 0x1e66: goto L1e66;
+        case 0x1e6a: goto L1e6a;
+        case 0x1e70: goto L1e70;
+        case 0x1e7c: goto L1e7c;
+        case 0x1e84: goto L1e84;
+        case 0x1e88: goto L1e88;
+        case 0x1e98: goto L1e98;
+        case 0x1ea2: goto L1ea2;
+        case 0x1eaa: goto L1eaa;
+        case 0x1eae: goto L1eae;
+        case 0x1eb0: goto L1eb0;
+        case 0x1eb8: goto L1eb8;
+        case 0x1ebc: goto L1ebc;
+        case 0x1ec0: goto L1ec0;
+        case 0x1ec8: goto L1ec8;
+        case 0x1ece: goto L1ece;
+        case 0x1ed2: goto L1ed2;
+        case 0x1eda: goto L1eda;
+        case 0x1ee2: goto L1ee2;
+        case 0x1ee8: goto L1ee8;
+        case 0x1eec: goto L1eec;
+        case 0x1ef8: goto L1ef8;
+        case 0x1f00: goto L1f00;
+        case 0x1f06: goto L1f06;
+        case 0x1f0a: goto L1f0a;
+        case 0x1f12: goto L1f12;
+        case 0x1f1a: goto L1f1a;
+        case 0x1f20: goto L1f20;
+        case 0x1f24: goto L1f24;
+        case 0x1f2c: goto L1f2c;
+        case 0x1f30: goto L1f30;
+        case 0x1f38: goto L1f38;
+        case 0x1f3c: goto L1f3c;
+        case 0x1f44: goto L1f44;
+        case 0x1f52: goto L1f52;
+        case 0x1f60: goto L1f60;
+        case 0x1f6a: goto L1f6a;
+        case 0x1f6e: goto L1f6e;
+        case 0x1f76: goto L1f76;
+        case 0x1f7a: goto L1f7a;
+        case 0x1f7e: goto L1f7e;
+        case 0x1f88: goto L1f88;
+        case 0x1f94: goto L1f94;
+        case 0x1f9c: goto L1f9c;
+        case 0x1fa0: goto L1fa0;
+        case 0x1fb2: goto L1fb2;
+        case 0x1fbe: goto L1fbe;
+        case 0x1fc6: goto L1fc6;
+        case 0x1fca: goto L1fca;
+        case 0x1fdc: goto L1fdc;
+        case 0x1fee: goto L1fee;
+        case 0x1ff6: goto L1ff6;
+        case 0x2008: goto L2008;
+        case 0x200c: goto L200c;
+        case 0x2010: goto L2010;
+        case 0x2018: goto L2018;
+        case 0x2020: goto L2020;
+        case 0x2024: goto L2024;
+        case 0x202a: goto L202a;
+        case 0x2032: goto L2032;
+        case 0x2036: goto L2036;
+        case 0x203a: goto L203a;
+        case 0x203e: goto L203e;
+        case 0x2044: goto L2044;
+        case 0x2048: goto L2048;
+        case 0x204c: goto L204c;
+        case 0x2060: goto L2060;
+        case 0x2064: goto L2064;
+        case 0x2068: goto L2068;
+        case 0x206a: goto L206a;
+        case 0x206e: goto L206e;
+        case 0x2072: goto L2072;
+        case 0x2074: goto L2074;
+        case 0x207c: goto L207c;
+        case 0x208c: goto L208c;
+        case 0x2094: goto L2094;
+        case 0x209c: goto L209c;
+        case 0x20a2: goto L20a2;
+        case 0x20a8: goto L20a8;
+        case 0x20bc: goto L20bc;
+        case 0x20c0: goto L20c0;
+        case 0x20c6: goto L20c6;
+        case 0x20d4: goto L20d4;
+        case 0x20dc: goto L20dc;
+        case 0x20e4: goto L20e4;
+        case 0x20ec: goto L20ec;
+        case 0x20fa: goto L20fa;
+        case 0x210a: goto L210a;
+        case 0x210e: goto L210e;
+        case 0x2114: goto L2114;
+        case 0x2132: goto L2132;
+        case 0x2138: goto L2138;
+        case 0x214e: goto L214e;
+        case 0x2158: goto L2158;
+        case 0x215e: goto L215e;
+        case 0x2162: goto L2162;
+        case 0x2166: goto L2166;
+        case 0x216c: goto L216c;
+        case 0x2172: goto L2172;
+        case 0x2178: goto L2178;
+        case 0x2186: goto L2186;
+        case 0x21aa: goto L21aa;
+        case 0x21b0: goto L21b0;
+        case 0x21c0: goto L21c0;
+        case 0x21ce: goto L21ce;
+        case 0x21d0: goto L21d0;
+        case 0x21d6: goto L21d6;
+        case 0x21e4: goto L21e4;
+        case 0x21e6: goto L21e6;
+        case 0x21ec: goto L21ec;
+        case 0x21f2: goto L21f2;
+        case 0x21f8: goto L21f8;
+        case 0x220e: goto L220e;
+        case 0x2216: goto L2216;
+        case 0x221a: goto L221a;
+        case 0x2222: goto L2222;
+        case 0x2228: goto L2228;
+        case 0x222e: goto L222e;
+        case 0x2232: goto L2232;
+        case 0x223a: goto L223a;
+        case 0x2248: goto L2248;
+        case 0x2250: goto L2250;
+        case 0x2258: goto L2258;
+        case 0x2266: goto L2266;
+        case 0x226c: goto L226c;
+        case 0x2270: goto L2270;
+        case 0x227c: goto L227c;
+        case 0x2282: goto L2282;
+        case 0x2288: goto L2288;
+        case 0x228e: goto L228e;
+        case 0x2292: goto L2292;
+        case 0x229c: goto L229c;
+        case 0x22a2: goto L22a2;
+        case 0x22b6: goto L22b6;
+        case 0x22ba: goto L22ba;
+        case 0x22be: goto L22be;
+        case 0x22c6: goto L22c6;
+        case 0x22cc: goto L22cc;
+        case 0x22d0: goto L22d0;
+        case 0x22d4: goto L22d4;
+        case 0x22dc: goto L22dc;
+        case 0x22e8: goto L22e8;
+        case 0x22f8: goto L22f8;
+        case 0x2302: goto L2302;
+        case 0x2312: goto L2312;
+        case 0x231e: goto L231e;
+        case 0x2328: goto L2328;
+        case 0x232e: goto L232e;
+        case 0x2332: goto L2332;
+        case 0x2352: goto L2352;
+        case 0x2356: goto L2356;
+        case 0x235a: goto L235a;
+        case 0x235e: goto L235e;
+        case 0x2368: goto L2368;
+        case 0x2372: goto L2372;
+        case 0x2378: goto L2378;
+        case 0x237c: goto L237c;
+        case 0x237e: goto L237e;
+        case 0x2382: goto L2382;
+        case 0x2388: goto L2388;
+        case 0x2390: goto L2390;
+        case 0x2396: goto L2396;
+        case 0x239a: goto L239a;
+        case 0x23ae: goto L23ae;
+        case 0x23ba: goto L23ba;
+        case 0x23be: goto L23be;
+        case 0x23c6: goto L23c6;
+        case 0x23cc: goto L23cc;
+        case 0x23d8: goto L23d8;
+        case 0x23de: goto L23de;
+        case 0x23e2: goto L23e2;
+        case 0x23e4: goto L23e4;
+        case 0x23e8: goto L23e8;
+        case 0x23ec: goto L23ec;
+        case 0x23f0: goto L23f0;
+        case 0x23f6: goto L23f6;
+        case 0x23fc: goto L23fc;
+        case 0x2400: goto L2400;
+        case 0x2406: goto L2406;
+        case 0x240e: goto L240e;
+        case 0x241e: goto L241e;
+        case 0x2424: goto L2424;
+        case 0x242a: goto L242a;
+        case 0x2430: goto L2430;
+        case 0x2434: goto L2434;
+        case 0x2448: goto L2448;
+        case 0x2450: goto L2450;
+        case 0x2458: goto L2458;
+        case 0x2466: goto L2466;
+        case 0x2474: goto L2474;
+        case 0x247a: goto L247a;
+        case 0x247e: goto L247e;
+        case 0x2488: goto L2488;
+        case 0x248a: goto L248a;
+        case 0x2494: goto L2494;
+        case 0x2498: goto L2498;
+        case 0x249e: goto L249e;
+        case 0x24a2: goto L24a2;
+        case 0x24a8: goto L24a8;
+        case 0x24b0: goto L24b0;
+        case 0x24c2: goto L24c2;
+        case 0x24ca: goto L24ca;
+        case 0x24d0: goto L24d0;
+        case 0x24ec: goto L24ec;
+        case 0x24fe: goto L24fe;
+        case 0x2500: goto L2500;
+        case 0x2506: goto L2506;
+        case 0x250a: goto L250a;
+        case 0x251a: goto L251a;
+        case 0x2528: goto L2528;
+        case 0x252a: goto L252a;
+        case 0x2538: goto L2538;
+        case 0x253c: goto L253c;
+        case 0x2540: goto L2540;
+        case 0x254c: goto L254c;
+        case 0x2554: goto L2554;
+        case 0x255c: goto L255c;
+        case 0x2560: goto L2560;
+        case 0x2568: goto L2568;
+        case 0x257a: goto L257a;
+        case 0x2586: goto L2586;
+        case 0x258e: goto L258e;
+        case 0x2594: goto L2594;
+        case 0x259a: goto L259a;
+        case 0x25a0: goto L25a0;
+        case 0x25a6: goto L25a6;
+        case 0x25ac: goto L25ac;
+        case 0x25b0: goto L25b0;
+        case 0x25c6: goto L25c6;
+        case 0x25ca: goto L25ca;
+        case 0x25ce: goto L25ce;
+        case 0x25d6: goto L25d6;
+        case 0x25e0: goto L25e0;
+        case 0x25e8: goto L25e8;
+        case 0x25ee: goto L25ee;
+        case 0x25f6: goto L25f6;
+        case 0x25fc: goto L25fc;
+        case 0x2606: goto L2606;
+        case 0x261a: goto L261a;
+        case 0x262e: goto L262e;
+        case 0x2632: goto L2632;
+        case 0x2638: goto L2638;
+        case 0x263c: goto L263c;
+        case 0x263e: goto L263e;
+        case 0x2662: goto L2662;
+        case 0x266e: goto L266e;
+        case 0x2674: goto L2674;
+        case 0x267a: goto L267a;
+        case 0x2680: goto L2680;
+        case 0x2686: goto L2686;
+        case 0x268c: goto L268c;
+        case 0x2692: goto L2692;
+        case 0x2698: goto L2698;
+        case 0x269e: goto L269e;
+        case 0x26a6: goto L26a6;
+        case 0x26aa: goto L26aa;
+        case 0x26ae: goto L26ae;
+        case 0x26b6: goto L26b6;
+        case 0x26b8: goto L26b8;
+        case 0x26be: goto L26be;
+        case 0x26c4: goto L26c4;
+        case 0x26ca: goto L26ca;
+        case 0x26d2: goto L26d2;
+        case 0x26d6: goto L26d6;
+        case 0x26dc: goto L26dc;
+        case 0x26e8: goto L26e8;
+        case 0x26f4: goto L26f4;
+        case 0x26fe: goto L26fe;
+        case 0x270e: goto L270e;
+        case 0x2718: goto L2718;
+        case 0x271e: goto L271e;
+        case 0x272a: goto L272a;
+        case 0x2734: goto L2734;
+        case 0x2742: goto L2742;
+        case 0x274c: goto L274c;
+        case 0x275a: goto L275a;
+        case 0x2772: goto L2772;
+        case 0x2778: goto L2778;
+        case 0x2782: goto L2782;
+        case 0x278c: goto L278c;
+        case 0x2790: goto L2790;
+        case 0x27a2: goto L27a2;
+        case 0x27a8: goto L27a8;
+        case 0x27b0: goto L27b0;
+        case 0x27b4: goto L27b4;
+        case 0x27ba: goto L27ba;
+        case 0x27c8: goto L27c8;
+        case 0x27ce: goto L27ce;
+        case 0x27d4: goto L27d4;
+        case 0x27dc: goto L27dc;
+        case 0x27e0: goto L27e0;
+        case 0x27e6: goto L27e6;
+        case 0x27ec: goto L27ec;
+        case 0x27fc: goto L27fc;
+        case 0x2802: goto L2802;
+        case 0x2812: goto L2812;
+        case 0x282a: goto L282a;
+        case 0x2832: goto L2832;
+        case 0x2838: goto L2838;
+        case 0x283e: goto L283e;
+        case 0x284a: goto L284a;
+        case 0x2850: goto L2850;
+        case 0x285c: goto L285c;
+        case 0x2864: goto L2864;
+        case 0x286e: goto L286e;
+        case 0x2870: goto L2870;
+        case 0x287a: goto L287a;
+        case 0x2880: goto L2880;
+        case 0x2884: goto L2884;
+        case 0x288c: goto L288c;
+        case 0x2894: goto L2894;
+        case 0x2898: goto L2898;
+        case 0x28a4: goto L28a4;
+        case 0x28a8: goto L28a8;
+        case 0x28ae: goto L28ae;
+        case 0x28b6: goto L28b6;
+        case 0x28ba: goto L28ba;
+        case 0x28bc: goto L28bc;
+        case 0x28cc: goto L28cc;
+        case 0x28d0: goto L28d0;
+        case 0x28d6: goto L28d6;
+        case 0x28dc: goto L28dc;
+        case 0x28f2: goto L28f2;
+        case 0x2900: goto L2900;
+        case 0x2904: goto L2904;
+        case 0x290c: goto L290c;
+        case 0x2916: goto L2916;
+        case 0x291a: goto L291a;
+        case 0x291e: goto L291e;
+        case 0x2926: goto L2926;
+        case 0x292e: goto L292e;
+        case 0x293a: goto L293a;
+        case 0x2940: goto L2940;
+        case 0x295a: goto L295a;
+        case 0x296e: goto L296e;
+        case 0x2976: goto L2976;
+        case 0x2978: goto L2978;
+        case 0x2988: goto L2988;
+        case 0x2994: goto L2994;
+        case 0x299e: goto L299e;
+        case 0x29a4: goto L29a4;
+        case 0x29ae: goto L29ae;
+        case 0x29b6: goto L29b6;
+        case 0x29ba: goto L29ba;
+        case 0x29be: goto L29be;
+        case 0x29c4: goto L29c4;
+        case 0x29ca: goto L29ca;
+        case 0x29ce: goto L29ce;
+        case 0x29ea: goto L29ea;
+        case 0x29f0: goto L29f0;
+        case 0x2a00: goto L2a00;
+        case 0x2a0c: goto L2a0c;
+        case 0x2a12: goto L2a12;
+        case 0x2a16: goto L2a16;
+        case 0x2a1c: goto L2a1c;
+        case 0x2a28: goto L2a28;
+        case 0x2a2c: goto L2a2c;
+        case 0x2a30: goto L2a30;
+        case 0x2a36: goto L2a36;
+        case 0x2a3c: goto L2a3c;
+        case 0x2a44: goto L2a44;
+        case 0x2a50: goto L2a50;
+        case 0x2a58: goto L2a58;
+        case 0x2a5a: goto L2a5a;
+        case 0x2a62: goto L2a62;
+        case 0x2a68: goto L2a68;
+        case 0x2a70: goto L2a70;
+        case 0x2a7c: goto L2a7c;
+        case 0x2a82: goto L2a82;
+        case 0x2a84: goto L2a84;
+        case 0x2a8c: goto L2a8c;
+        case 0x2a94: goto L2a94;
+        case 0x2a98: goto L2a98;
+        case 0x2aa4: goto L2aa4;
+        case 0x2aac: goto L2aac;
+        case 0x2ab0: goto L2ab0;
+        case 0x2ac4: goto L2ac4;
+        case 0x2aca: goto L2aca;
+        case 0x2ad8: goto L2ad8;
+        case 0x2ae0: goto L2ae0;
+        case 0x2ae4: goto L2ae4;
+        case 0x2af8: goto L2af8;
+        case 0x2afc: goto L2afc;
+        case 0x2b1c: goto L2b1c;
+        case 0x2b20: goto L2b20;
+        case 0x2b3c: goto L2b3c;
+        case 0x2b46: goto L2b46;
+        case 0x2b4a: goto L2b4a;
+        case 0x2b56: goto L2b56;
+        case 0x2b66: goto L2b66;
+        case 0x2b6c: goto L2b6c;
+        case 0x2b78: goto L2b78;
+        case 0x2b7c: goto L2b7c;
+        case 0x2b80: goto L2b80;
+        case 0x2b8c: goto L2b8c;
+        case 0x2b90: goto L2b90;
+        case 0x2ba4: goto L2ba4;
+        case 0x2bb0: goto L2bb0;
+        case 0x2bbe: goto L2bbe;
+        case 0x2bc2: goto L2bc2;
+        case 0x2bce: goto L2bce;
+        case 0x2bd0: goto L2bd0;
+        case 0x2bd2: goto L2bd2;
+        case 0x2be4: goto L2be4;
+        case 0x2bea: goto L2bea;
+        case 0x2bf2: goto L2bf2;
+        case 0x2c04: goto L2c04;
+        case 0x2c0a: goto L2c0a;
+        case 0x2c12: goto L2c12;
+        case 0x2c24: goto L2c24;
+        case 0x2c2a: goto L2c2a;
+        case 0x2c32: goto L2c32;
+        case 0x2c3e: goto L2c3e;
+        case 0x2c46: goto L2c46;
+        case 0x2c54: goto L2c54;
+        case 0x2c5a: goto L2c5a;
+        case 0x2c62: goto L2c62;
+        case 0x2c66: goto L2c66;
+        case 0x2c6a: goto L2c6a;
+        case 0x2c6e: goto L2c6e;
+        case 0x2c82: goto L2c82;
+        case 0x2c88: goto L2c88;
+        case 0x2c9c: goto L2c9c;
+        case 0x2ca2: goto L2ca2;
+        case 0x2cae: goto L2cae;
+        case 0x2cb8: goto L2cb8;
+        case 0x2cbe: goto L2cbe;
+        case 0x2cc4: goto L2cc4;
+        case 0x2cce: goto L2cce;
+        case 0x2cd8: goto L2cd8;
+        case 0x2cdc: goto L2cdc;
+        case 0x2cec: goto L2cec;
+        case 0x2cf8: goto L2cf8;
+        case 0x2cfe: goto L2cfe;
+        case 0x2d10: goto L2d10;
+        case 0x2d1c: goto L2d1c;
+        case 0x2d20: goto L2d20;
+        case 0x2d26: goto L2d26;
+        case 0x2d2c: goto L2d2c;
+        case 0x2d34: goto L2d34;
+        case 0x2d3a: goto L2d3a;
+        case 0x2d3e: goto L2d3e;
+        case 0x2d46: goto L2d46;
+        case 0x2d4e: goto L2d4e;
+        case 0x2d62: goto L2d62;
+        case 0x2d6a: goto L2d6a;
+        case 0x2d6e: goto L2d6e;
+        case 0x2d70: goto L2d70;
+        case 0x2d76: goto L2d76;
+        case 0x2d7c: goto L2d7c;
+        case 0x2d84: goto L2d84;
+        case 0x2d88: goto L2d88;
+        case 0x2d94: goto L2d94;
+        case 0x2d9c: goto L2d9c;
+        case 0x2da0: goto L2da0;
+        case 0x2da8: goto L2da8;
+        case 0x2db2: goto L2db2;
+        case 0x2db6: goto L2db6;
+        case 0x2dbc: goto L2dbc;
+        case 0x2dc4: goto L2dc4;
+        case 0x2dca: goto L2dca;
+        case 0x2dd6: goto L2dd6;
+        case 0x2de0: goto L2de0;
+        case 0x2de4: goto L2de4;
+        case 0x2dea: goto L2dea;
+        case 0x2df2: goto L2df2;
+        case 0x2dfe: goto L2dfe;
+        case 0x2e02: goto L2e02;
+        case 0x2e06: goto L2e06;
+        case 0x2e0a: goto L2e0a;
+        case 0x2e0e: goto L2e0e;
+        case 0x2e14: goto L2e14;
+        case 0x2e1a: goto L2e1a;
+        case 0x2e20: goto L2e20;
+        case 0x2e24: goto L2e24;
+        case 0x2e30: goto L2e30;
+        case 0x2e34: goto L2e34;
+        case 0x2e36: goto L2e36;
+        case 0x2e3c: goto L2e3c;
+        case 0x2e42: goto L2e42;
+        case 0x2e48: goto L2e48;
+        case 0x2e52: goto L2e52;
+        case 0x2e56: goto L2e56;
+        case 0x2e5c: goto L2e5c;
+        case 0x2e62: goto L2e62;
+        case 0x2e6a: goto L2e6a;
+        case 0x2e72: goto L2e72;
+        case 0x2e76: goto L2e76;
+        case 0x2e80: goto L2e80;
+        case 0x2e88: goto L2e88;
+        case 0x2e8c: goto L2e8c;
+        case 0x2e94: goto L2e94;
+        case 0x2ea6: goto L2ea6;
+        case 0x2eba: goto L2eba;
+        case 0x2ece: goto L2ece;
+        case 0x2ed8: goto L2ed8;
+        case 0x2edc: goto L2edc;
+        case 0x2ee4: goto L2ee4;
+        case 0x2eea: goto L2eea;
+        case 0x2eee: goto L2eee;
+        case 0x2f0e: goto L2f0e;
+        case 0x2f28: goto L2f28;
+        case 0x2f36: goto L2f36;
+        case 0x2f3e: goto L2f3e;
+        case 0x2f42: goto L2f42;
+        case 0x2f58: goto L2f58;
+        case 0x2f5e: goto L2f5e;
+        case 0x2f70: goto L2f70;
+        case 0x2f74: goto L2f74;
+        case 0x2f7a: goto L2f7a;
+        case 0x2f84: goto L2f84;
+        case 0x2f90: goto L2f90;
+        case 0x2f94: goto L2f94;
+        case 0x2f9c: goto L2f9c;
+        case 0x2fa0: goto L2fa0;
+        case 0x2faa: goto L2faa;
+        case 0x2fb6: goto L2fb6;
+        case 0x2fbc: goto L2fbc;
+        case 0x2fcc: goto L2fcc;
+        case 0x2fd0: goto L2fd0;
+        case 0x2fd8: goto L2fd8;
+        case 0x2fdc: goto L2fdc;
+        case 0x2fe6: goto L2fe6;
+        case 0x2fea: goto L2fea;
+        case 0x2ff2: goto L2ff2;
+        case 0x2ff6: goto L2ff6;
+        case 0x2ffa: goto L2ffa;
+        case 0x3002: goto L3002;
+        case 0x3006: goto L3006;
+        case 0x300a: goto L300a;
+        case 0x3014: goto L3014;
+        case 0x3018: goto L3018;
+        case 0x3030: goto L3030;
+        case 0x3034: goto L3034;
+        case 0x303c: goto L303c;
+        case 0x3042: goto L3042;
+        case 0x304c: goto L304c;
+        case 0x3052: goto L3052;
+        case 0x3058: goto L3058;
+        case 0x305e: goto L305e;
+        case 0x3076: goto L3076;
+        case 0x307c: goto L307c;
+        case 0x3082: goto L3082;
+        case 0x3086: goto L3086;
+        case 0x308a: goto L308a;
+        case 0x308e: goto L308e;
+        case 0x3092: goto L3092;
+        case 0x3096: goto L3096;
+        case 0x309a: goto L309a;
+        case 0x30a0: goto L30a0;
+        case 0x30aa: goto L30aa;
+        case 0x30ae: goto L30ae;
+        case 0x30b2: goto L30b2;
+        case 0x30b8: goto L30b8;
+        case 0x30be: goto L30be;
+        case 0x30c6: goto L30c6;
+        case 0x30e2: goto L30e2;
+        case 0x30e8: goto L30e8;
+        case 0x30ee: goto L30ee;
+        case 0x30f2: goto L30f2;
+        case 0x30fc: goto L30fc;
+        case 0x3100: goto L3100;
+        case 0x3112: goto L3112;
+        case 0x3118: goto L3118;
+        case 0x312c: goto L312c;
+        case 0x3132: goto L3132;
+        case 0x313c: goto L313c;
+        case 0x3142: goto L3142;
+        case 0x3144: goto L3144;
+        case 0x3148: goto L3148;
+        case 0x3158: goto L3158;
+        case 0x3160: goto L3160;
+        case 0x3164: goto L3164;
+        case 0x3172: goto L3172;
+        case 0x3176: goto L3176;
+        case 0x317a: goto L317a;
+        case 0x3184: goto L3184;
+        case 0x3188: goto L3188;
+        case 0x318c: goto L318c;
+        case 0x318e: goto L318e;
+        case 0x3192: goto L3192;
+        case 0x319a: goto L319a;
+        case 0x319c: goto L319c;
+        case 0x31a0: goto L31a0;
+        case 0x31a2: goto L31a2;
+        case 0x31ae: goto L31ae;
+        case 0x31b2: goto L31b2;
+        case 0x31bc: goto L31bc;
+        case 0x31c0: goto L31c0;
+        case 0x31c2: goto L31c2;
+        case 0x31c6: goto L31c6;
+        case 0x31ca: goto L31ca;
+        case 0x31d2: goto L31d2;
+        case 0x31d6: goto L31d6;
+        case 0x31da: goto L31da;
+        case 0x31de: goto L31de;
+        case 0x31e4: goto L31e4;
+        case 0x31e8: goto L31e8;
+        case 0x31ec: goto L31ec;
+        case 0x31f2: goto L31f2;
+        case 0x31f6: goto L31f6;
+        case 0x31fc: goto L31fc;
+        case 0x31fe: goto L31fe;
+        case 0x3204: goto L3204;
+        case 0x3208: goto L3208;
+        case 0x3218: goto L3218;
+        case 0x321c: goto L321c;
+        case 0x3220: goto L3220;
+        case 0x322c: goto L322c;
+        case 0x322e: goto L322e;
+        case 0x323a: goto L323a;
+        case 0x323c: goto L323c;
+        case 0x3246: goto L3246;
+        case 0x324e: goto L324e;
+        case 0x325e: goto L325e;
+        case 0x3264: goto L3264;
+        case 0x3268: goto L3268;
+        case 0x326a: goto L326a;
+        case 0x326e: goto L326e;
+        case 0x3274: goto L3274;
+        case 0x3276: goto L3276;
+        case 0x327a: goto L327a;
+        case 0x327e: goto L327e;
+        case 0x3282: goto L3282;
+        case 0x3284: goto L3284;
+        case 0x328c: goto L328c;
+        case 0x3292: goto L3292;
+        case 0x32a4: goto L32a4;
+        case 0x32a8: goto L32a8;
+        case 0x32ae: goto L32ae;
+        case 0x32ba: goto L32ba;
+        case 0x32c0: goto L32c0;
+        case 0x32ca: goto L32ca;
+        case 0x32d4: goto L32d4;
+        case 0x32e0: goto L32e0;
+        case 0x32e2: goto L32e2;
+        case 0x32e4: goto L32e4;
+        case 0x32e6: goto L32e6;
+        case 0x32e8: goto L32e8;
+        case 0x32ea: goto L32ea;
+        case 0x32f0: goto L32f0;
+        case 0x32fe: goto L32fe;
+        case 0x330c: goto L330c;
+        case 0x331e: goto L331e;
+        case 0x3320: goto L3320;
+        case 0x3322: goto L3322;
+        case 0x3324: goto L3324;
+        case 0x3326: goto L3326;
+        case 0x332a: goto L332a;
+        case 0x333c: goto L333c;
+        case 0x333e: goto L333e;
+        case 0x3340: goto L3340;
+        case 0x3342: goto L3342;
+        case 0x3344: goto L3344;
+        case 0x3346: goto L3346;
+        case 0x3348: goto L3348;
+        case 0x3356: goto L3356;
+        case 0x335a: goto L335a;
+        case 0x335e: goto L335e;
+        case 0x336e: goto L336e;
+        case 0x3372: goto L3372;
+        case 0x3376: goto L3376;
+        case 0x3386: goto L3386;
+        case 0x3394: goto L3394;
+        case 0x3398: goto L3398;
+        case 0x339c: goto L339c;
+        case 0x33aa: goto L33aa;
+        case 0x33b6: goto L33b6;
+        case 0x33b8: goto L33b8;
+        case 0x33cc: goto L33cc;
+        case 0x33d4: goto L33d4;
+        case 0x33d6: goto L33d6;
+        case 0x33d8: goto L33d8;
+        case 0x33da: goto L33da;
+        case 0x33dc: goto L33dc;
+        case 0x33de: goto L33de;
+        case 0x33e0: goto L33e0;
+        case 0x33e2: goto L33e2;
+        case 0x33e6: goto L33e6;
+        case 0x33ee: goto L33ee;
+        case 0x3404: goto L3404;
+        case 0x3406: goto L3406;
+        case 0x3408: goto L3408;
+        case 0x340a: goto L340a;
+        case 0x340c: goto L340c;
+        case 0x3410: goto L3410;
+        case 0x341a: goto L341a;
+        case 0x341c: goto L341c;
+        case 0x341e: goto L341e;
+        case 0x3420: goto L3420;
+        case 0x3422: goto L3422;
+        case 0x3428: goto L3428;
+        case 0x3436: goto L3436;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: setd
+    AOT_GOTO(0x0002, L0002);
+L0002:
+    AOT_BLOCK(0x0002, 1);
+    // 0002: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0004, L0004);
+L0004:
+    AOT_BLOCK(0x0004, 1);
+    // 0004: mov (r0), -(sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0006, L0006);
+L0006:
+    AOT_BLOCK(0x0006, 1);
+    // 0006: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0008, L0008);
+L0008:
+    AOT_BLOCK(0x0008, 1);
+    // 0008: mov r0, 2(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x000c, L000c);
+L000c:
+    AOT_BLOCK(0x000c, 1);
+    // 000c: jsr pc, 0018
+    {
+        a = 0x0018;
+        r[6] -= 2;
+        WR16(r[6], 0x0010);
+    }
+    AOT_GOTO(0x0018, L0018);
+L0010:
+    AOT_BLOCK(0x0010, 1);
+    // 0010: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0012, L0012);
+L0012:
+    AOT_BLOCK(0x0012, 1);
+    // 0012: jsr pc, *$3410
+    {
+        a = 0x3410;
+        r[6] -= 2;
+        WR16(r[6], 0x0016);
+    }
+    AOT_GOTO(0x3410, L3410);
+L0014:
+    AOT_BLOCK(0x0014, 1);
+    // 0014: bit (r0)+, (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        b = r[0];
+        r[0] += 2;
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0016, L0016);
+L0016:
+    // 0016: sys 1
+    AOT_INTERP(0x0016);
+L0018:
+    AOT_BLOCK(0x0018, 2);
+    // 0018: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x001c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x001c, L001c);
+L001a:
+    AOT_BLOCK(0x001a, 1);
+    // 001a: bit (pc), *25f5(sp)
+    {
+        src = uint16_t(0x25f5);
+        b = RD16(r[6] + 9717);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x001e, L001e);
+L001c:
+    AOT_BLOCK(0x001c, 1);
+    // 001c: cmp $3, 4(r5)
+    {
+        src = uint16_t(0x0003);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0022, L0022);
+L001e:
+    // 001e: bpt
+    AOT_INTERP(0x001e);
+L0020:
+    // 0020: iot
+    AOT_INTERP(0x0020);
+L0022:
+    AOT_BLOCK(0x0022, 1);
+    // 0022: ble 0034
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0034, L0034);
+    AOT_GOTO(0x0024, L0024);
+L0024:
+    AOT_BLOCK(0x0024, 2);
+    // 0024: mov $36c3, (sp)
+    {
+        src = uint16_t(0x36c3);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0028: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x002c);
+    }
+    AOT_GOTO(0x1388, L1388);
+L002a:
+    AOT_BLOCK(0x002a, 1);
+    // 002a: mov (sp), (r0)
+    {
+        a = r[6];
+        src = RD16(a);
+        b = r[0];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x002c, L002c);
+L002c:
+    AOT_BLOCK(0x002c, 1);
+    // 002c: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0030, L0030);
+L0030:
+    AOT_BLOCK(0x0030, 1);
+    // 0030: jsr pc, *$3410
+    {
+        a = 0x3410;
+        r[6] -= 2;
+        WR16(r[6], 0x0034);
+    }
+    AOT_GOTO(0x3410, L3410);
+L0034:
+    AOT_BLOCK(0x0034, 4);
+    // 0034: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0036: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 003a: mov 2(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 003e: jsr pc, *$330c
+    {
+        a = 0x330c;
+        r[6] -= 2;
+        WR16(r[6], 0x0042);
+    }
+    AOT_GOTO(0x330c, L330c);
+L0042:
+    AOT_BLOCK(0x0042, 3);
+    // 0042: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0044: mov r0, 58e4
+    {
+        src = r[0];
+        b = 0x58e4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0048: bge 0064
+    if (!(N ^ V))
+        AOT_GOTO(0x0064, L0064);
+    AOT_GOTO(0x004a, L004a);
+L004a:
+    AOT_BLOCK(0x004a, 1);
+    // 004a: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x004e, L004e);
+L004e:
+    AOT_BLOCK(0x004e, 3);
+    // 004e: mov 2(r0), (sp)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0052: mov $36cd, -(sp)
+    {
+        src = uint16_t(0x36cd);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0056: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x005a);
+    }
+    AOT_GOTO(0x1388, L1388);
+L005a:
+    AOT_BLOCK(0x005a, 1);
+    // 005a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x005c, L005c);
+L005c:
+    AOT_BLOCK(0x005c, 2);
+    // 005c: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0060: jsr pc, *$3410
+    {
+        a = 0x3410;
+        r[6] -= 2;
+        WR16(r[6], 0x0064);
+    }
+    AOT_GOTO(0x3410, L3410);
+L0064:
+    AOT_BLOCK(0x0064, 2);
+    // 0064: mov $54d4, (sp)
+    {
+        src = uint16_t(0x54d4);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0068: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x006c, L006c);
+L006c:
+    AOT_BLOCK(0x006c, 2);
+    // 006c: mov 4(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0070: jsr pc, *$332a
+    {
+        a = 0x332a;
+        r[6] -= 2;
+        WR16(r[6], 0x0074);
+    }
+    AOT_GOTO(0x332a, L332a);
+L0074:
+    AOT_BLOCK(0x0074, 2);
+    // 0074: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0076: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0078, L0078);
+L0078:
+    AOT_BLOCK(0x0078, 1);
+    // 0078: blt 0090
+    if (N ^ V)
+        AOT_GOTO(0x0090, L0090);
+    AOT_GOTO(0x007a, L007a);
+L007a:
+    AOT_BLOCK(0x007a, 4);
+    // 007a: mov $56da, (sp)
+    {
+        src = uint16_t(0x56da);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 007e: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0082: mov 6(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0086: jsr pc, *$332a
+    {
+        a = 0x332a;
+        r[6] -= 2;
+        WR16(r[6], 0x008a);
+    }
+    AOT_GOTO(0x332a, L332a);
+L008a:
+    AOT_BLOCK(0x008a, 3);
+    // 008a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 008c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 008e: bge 00a0
+    if (!(N ^ V))
+        AOT_GOTO(0x00a0, L00a0);
+    AOT_GOTO(0x0090, L0090);
+L0090:
+    AOT_BLOCK(0x0090, 2);
+    // 0090: mov $36db, (sp)
+    {
+        src = uint16_t(0x36db);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0094: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x0098);
+    }
+    AOT_GOTO(0x1388, L1388);
+L0098:
+    AOT_BLOCK(0x0098, 2);
+    // 0098: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 009c: jsr pc, *$3410
+    {
+        a = 0x3410;
+        r[6] -= 2;
+        WR16(r[6], 0x00a0);
+    }
+    AOT_GOTO(0x3410, L3410);
+L00a0:
+    AOT_BLOCK(0x00a0, 2);
+    // 00a0: cmp $4, 4(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00a6: bge 00ac
+    if (!(N ^ V))
+        AOT_GOTO(0x00ac, L00ac);
+    AOT_GOTO(0x00a8, L00a8);
+L00a8:
+    AOT_BLOCK(0x00a8, 1);
+    // 00a8: inc 53ee
+    {
+        a = 0x53ee;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x00ac, L00ac);
+L00ac:
+    AOT_BLOCK(0x00ac, 1);
+    // 00ac: mov $345e, r2
+    {
+        src = uint16_t(0x345e);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00b0, L00b0);
+L00b0:
+    AOT_BLOCK(0x00b0, 2);
+    // 00b0: mov (r2), r4
+    {
+        a = r[2];
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00b2: beq 00d8
+    if (Z)
+        AOT_GOTO(0x00d8, L00d8);
+    AOT_GOTO(0x00b4, L00b4);
+L00b4:
+    AOT_BLOCK(0x00b4, 1);
+    // 00b4: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x00b6, L00b6);
+L00b6:
+    AOT_BLOCK(0x00b6, 2);
+    // 00b6: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 00b8: beq 00c0
+    if (Z)
+        AOT_GOTO(0x00c0, L00c0);
+    AOT_GOTO(0x00ba, L00ba);
+L00ba:
+    AOT_BLOCK(0x00ba, 3);
+    // 00ba: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 00bc: add r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 00be: br 00b6
+    AOT_GOTO(0x00b6, L00b6);
+L00c0:
+    AOT_BLOCK(0x00c0, 7);
+    // 00c0: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 00c2: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 00c4: div $c8, r0
+    {
+        src = int16_t(uint16_t(0x00c8));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 00c8: ash $4, r1
+    {
+        src = uint16_t(0x0004) & 077;
+        val16 = r[1];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 00cc: movb $4, 3ffb(r1)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[1] + 16379);
+        WR8(b, src);
+    }
+    // 00d2: add $4, r2
+    {
+        src = uint16_t(0x0004);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 00d6: br 00b0
+    AOT_GOTO(0x00b0, L00b0);
+L00d8:
+    AOT_BLOCK(0x00d8, 2);
+    // 00d8: tst 4ffe
+    {
+        a = 0x4ffe;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 00dc: bne 00e8
+    if (!Z)
+        AOT_GOTO(0x00e8, L00e8);
+    AOT_GOTO(0x00de, L00de);
+L00de:
+    AOT_BLOCK(0x00de, 1);
+    // 00de: jsr pc, 1530
+    {
+        a = 0x1530;
+        r[6] -= 2;
+        WR16(r[6], 0x00e2);
+    }
+    AOT_GOTO(0x1530, L1530);
+L00e2:
+    AOT_BLOCK(0x00e2, 1);
+    // 00e2: jsr pc, 221a
+    {
+        a = 0x221a;
+        r[6] -= 2;
+        WR16(r[6], 0x00e6);
+    }
+    AOT_GOTO(0x221a, L221a);
+L00e6:
+    AOT_BLOCK(0x00e6, 1);
+    // 00e6: br 00d8
+    AOT_GOTO(0x00d8, L00d8);
+L00e8:
+    AOT_BLOCK(0x00e8, 3);
+    // 00e8: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 00ea: mov $36ed, -(sp)
+    {
+        src = uint16_t(0x36ed);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00ee: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x00f2);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L00f2:
+    AOT_BLOCK(0x00f2, 5);
+    // 00f2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 00f4: inc 5404
+    {
+        a = 0x5404;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 00f8: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 00fa: mov $36ef, -(sp)
+    {
+        src = uint16_t(0x36ef);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00fe: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x0102);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L0102:
+    AOT_BLOCK(0x0102, 2);
+    // 0102: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0104: mov $54d4, (sp)
+    {
+        src = uint16_t(0x54d4);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0108, L0108);
+L0108:
+    AOT_BLOCK(0x0108, 1);
+    // 0108: jsr pc, *$33aa
+    {
+        a = 0x33aa;
+        r[6] -= 2;
+        WR16(r[6], 0x010c);
+    }
+    AOT_GOTO(0x33aa, L33aa);
+L010c:
+    AOT_BLOCK(0x010c, 2);
+    // 010c: mov $56da, (sp)
+    {
+        src = uint16_t(0x56da);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0110: jsr pc, *$33aa
+    {
+        a = 0x33aa;
+        r[6] -= 2;
+        WR16(r[6], 0x0114);
+    }
+    AOT_GOTO(0x33aa, L33aa);
+L0114:
+    AOT_BLOCK(0x0114, 2);
+    // 0114: tst 53fe
+    {
+        a = 0x53fe;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0118: bne 011e
+    if (!Z)
+        AOT_GOTO(0x011e, L011e);
+    AOT_GOTO(0x011a, L011a);
+L011a:
+    AOT_BLOCK(0x011a, 2);
+    // 011a: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 011c: br 0122
+    AOT_GOTO(0x0122, L0122);
+L011e:
+    AOT_BLOCK(0x011e, 1);
+    // 011e: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0122, L0122);
+L0122:
+    AOT_BLOCK(0x0122, 1);
+    // 0122: jsr pc, *$3410
+    {
+        a = 0x3410;
+        r[6] -= 2;
+        WR16(r[6], 0x0126);
+    }
+    AOT_GOTO(0x3410, L3410);
+L0126:
+    AOT_BLOCK(0x0126, 2);
+    // 0126: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L012a:
+    AOT_BLOCK(0x012a, 7);
+    // 012a: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x012e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 012e: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 0130: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+    }
+    // 0134: mov $3fee, r3
+    {
+        src = uint16_t(0x3fee);
+        r[3] = src;
+    }
+    // 0138: cmpb $2e, (r3)
+    {
+        src = uint8_t(0x2e);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 013c: bne 0140
+    if (!Z)
+        AOT_GOTO(0x0140, L0140);
+    AOT_GOTO(0x013e, L013e);
+L013e:
+    AOT_BLOCK(0x013e, 1);
+    // 013e: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0140, L0140);
+L0140:
+    AOT_BLOCK(0x0140, 2);
+    // 0140: cmp $3ff6, r3
+    {
+        src = uint16_t(0x3ff6);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0144: blos 014e
+    if (C | Z)
+        AOT_GOTO(0x014e, L014e);
+    AOT_GOTO(0x0146, L0146);
+L0146:
+    AOT_BLOCK(0x0146, 3);
+    // 0146: movb (r3)+, r0
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0148: add r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 014c: br 0140
+    AOT_GOTO(0x0140, L0140);
+L014e:
+    AOT_BLOCK(0x014e, 8);
+    // 014e: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 0152: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0154: div $c8, r0
+    {
+        src = int16_t(uint16_t(0x00c8));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0158: mov r1, r4
+    {
+        src = r[1];
+        r[4] = src;
+    }
+    // 015a: ash $4, r4
+    {
+        src = uint16_t(0x0004) & 077;
+        val16 = r[4];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[4] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[4] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 015e: add $3ffa, r4
+    {
+        src = uint16_t(0x3ffa);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0162: bitb $4, 1(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0168: beq 0178
+    if (Z)
+        AOT_GOTO(0x0178, L0178);
+    AOT_GOTO(0x016a, L016a);
+L016a:
+    AOT_BLOCK(0x016a, 1);
+    // 016a: jsr pc, 01fe
+    {
+        a = 0x01fe;
+        r[6] -= 2;
+        WR16(r[6], 0x016e);
+    }
+    AOT_GOTO(0x01fe, L01fe);
+L016e:
+    AOT_BLOCK(0x016e, 2);
+    // 016e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0170: beq 0178
+    if (Z)
+        AOT_GOTO(0x0178, L0178);
+    AOT_GOTO(0x0172, L0172);
+L0172:
+    AOT_BLOCK(0x0172, 2);
+    // 0172: mov $13, r0
+    {
+        src = uint16_t(0x0013);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0176: br 01fa
+    AOT_GOTO(0x01fa, L01fa);
+L0178:
+    AOT_BLOCK(0x0178, 4);
+    // 0178: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+    }
+    // 017a: add $8, r2
+    {
+        src = uint16_t(0x0008);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 017e: tstb (r2)
+    {
+        a = r[2];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0180: beq 01ac
+    if (Z)
+        AOT_GOTO(0x01ac, L01ac);
+    AOT_GOTO(0x0182, L0182);
+L0182:
+    AOT_BLOCK(0x0182, 1);
+    // 0182: mov $3fee, r3
+    {
+        src = uint16_t(0x3fee);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0186, L0186);
+L0186:
+    AOT_BLOCK(0x0186, 2);
+    // 0186: cmp $3ff6, r3
+    {
+        src = uint16_t(0x3ff6);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 018a: blos 0192
+    if (C | Z)
+        AOT_GOTO(0x0192, L0192);
+    AOT_GOTO(0x018c, L018c);
+L018c:
+    AOT_BLOCK(0x018c, 2);
+    // 018c: cmpb (r3)+, (r2)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 018e: bne 019c
+    if (!Z)
+        AOT_GOTO(0x019c, L019c);
+    AOT_GOTO(0x0190, L0190);
+L0190:
+    AOT_BLOCK(0x0190, 1);
+    // 0190: br 0186
+    AOT_GOTO(0x0186, L0186);
+L0192:
+    AOT_BLOCK(0x0192, 3);
+    // 0192: mov r4, 53f0
+    {
+        src = r[4];
+        b = 0x53f0;
+        WR16(b, src);
+    }
+    // 0196: mov $14, r0
+    {
+        src = uint16_t(0x0014);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 019a: br 01fa
+    AOT_GOTO(0x01fa, L01fa);
+L019c:
+    AOT_BLOCK(0x019c, 3);
+    // 019c: add $10, r4
+    {
+        src = uint16_t(0x0010);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+    }
+    // 01a0: cmp $4c7a, r4
+    {
+        src = uint16_t(0x4c7a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01a4: bhi 01aa
+    if (!(C | Z))
+        AOT_GOTO(0x01aa, L01aa);
+    AOT_GOTO(0x01a6, L01a6);
+L01a6:
+    AOT_BLOCK(0x01a6, 1);
+    // 01a6: mov $3ffa, r4
+    {
+        src = uint16_t(0x3ffa);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x01aa, L01aa);
+L01aa:
+    AOT_BLOCK(0x01aa, 1);
+    // 01aa: br 0178
+    AOT_GOTO(0x0178, L0178);
+L01ac:
+    AOT_BLOCK(0x01ac, 2);
+    // 01ac: inc 3ff8
+    {
+        a = 0x3ff8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 01b0: cmp $c8, 3ff8
+    {
+        src = uint16_t(0x00c8);
+        b = 0x3ff8;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x01b6, L01b6);
+L01b6:
+    AOT_BLOCK(0x01b6, 1);
+    // 01b6: bgt 01c8
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x01c8, L01c8);
+    AOT_GOTO(0x01b8, L01b8);
+L01b8:
+    AOT_BLOCK(0x01b8, 2);
+    // 01b8: mov $36f1, (sp)
+    {
+        src = uint16_t(0x36f1);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01bc: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x01c0);
+    }
+    AOT_GOTO(0x1388, L1388);
+L01c0:
+    AOT_BLOCK(0x01c0, 2);
+    // 01c0: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01c4: jsr pc, *$3410
+    {
+        a = 0x3410;
+        r[6] -= 2;
+        WR16(r[6], 0x01c8);
+    }
+    AOT_GOTO(0x3410, L3410);
+L01c8:
+    AOT_BLOCK(0x01c8, 8);
+    // 01c8: clrb (r4)
+    {
+        a = r[4];
+        WR8(a, 0);
+    }
+    // 01ca: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+    }
+    // 01ce: clr 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        WR16(a, 0);
+    }
+    // 01d2: clr 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        WR16(a, 0);
+    }
+    // 01d6: bisb 53ec, 1(r4)
+    {
+        a = 0x53ec;
+        src = RD8(a);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 01dc: mov $3fee, r3
+    {
+        src = uint16_t(0x3fee);
+        r[3] = src;
+    }
+    // 01e0: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+    }
+    // 01e2: add $8, r2
+    {
+        src = uint16_t(0x0008);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x01e6, L01e6);
+L01e6:
+    AOT_BLOCK(0x01e6, 2);
+    // 01e6: cmp $3ff6, r3
+    {
+        src = uint16_t(0x3ff6);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01ea: blos 01f0
+    if (C | Z)
+        AOT_GOTO(0x01f0, L01f0);
+    AOT_GOTO(0x01ec, L01ec);
+L01ec:
+    AOT_BLOCK(0x01ec, 2);
+    // 01ec: movb (r3)+, (r2)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 01ee: br 01e6
+    AOT_GOTO(0x01e6, L01e6);
+L01f0:
+    AOT_BLOCK(0x01f0, 3);
+    // 01f0: mov r4, 53f0
+    {
+        src = r[4];
+        b = 0x53f0;
+        WR16(b, src);
+    }
+    // 01f4: mov $14, r0
+    {
+        src = uint16_t(0x0014);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01f8: br 01fa
+    AOT_GOTO(0x01fa, L01fa);
+L01fa:
+    AOT_BLOCK(0x01fa, 2);
+    // 01fa: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L01fe:
+    AOT_BLOCK(0x01fe, 6);
+    // 01fe: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0202;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0202: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 0204: mov $3fee, -8(r5)
+    {
+        src = uint16_t(0x3fee);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 020a: cmpb $2e, *-8(r5)
+    {
+        src = uint8_t(0x2e);
+        b = RD16(r[5] + -8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0210: bne 0216
+    if (!Z)
+        AOT_GOTO(0x0216, L0216);
+    AOT_GOTO(0x0212, L0212);
+L0212:
+    AOT_BLOCK(0x0212, 1);
+    // 0212: inc -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0216, L0216);
+L0216:
+    AOT_BLOCK(0x0216, 1);
+    // 0216: mov $345e, r4
+    {
+        src = uint16_t(0x345e);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x021a, L021a);
+L021a:
+    AOT_BLOCK(0x021a, 2);
+    // 021a: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 021c: beq 023e
+    if (Z)
+        AOT_GOTO(0x023e, L023e);
+    AOT_GOTO(0x021e, L021e);
+L021e:
+    AOT_BLOCK(0x021e, 1);
+    // 021e: mov -8(r5), r3
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0222, L0222);
+L0222:
+    AOT_BLOCK(0x0222, 2);
+    // 0222: cmpb (r3), (r2)+
+    {
+        a = r[3];
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0224: bne 0238
+    if (!Z)
+        AOT_GOTO(0x0238, L0238);
+    AOT_GOTO(0x0226, L0226);
+L0226:
+    AOT_BLOCK(0x0226, 2);
+    // 0226: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0228: bne 0236
+    if (!Z)
+        AOT_GOTO(0x0236, L0236);
+    AOT_GOTO(0x022a, L022a);
+L022a:
+    AOT_BLOCK(0x022a, 3);
+    // 022a: mov 2(r4), 53f2
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = 0x53f2;
+        WR16(b, src);
+    }
+    // 0230: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0234: br 0242
+    AOT_GOTO(0x0242, L0242);
+L0236:
+    AOT_BLOCK(0x0236, 1);
+    // 0236: br 0222
+    AOT_GOTO(0x0222, L0222);
+L0238:
+    AOT_BLOCK(0x0238, 2);
+    // 0238: add $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 023c: br 021a
+    AOT_GOTO(0x021a, L021a);
+L023e:
+    AOT_BLOCK(0x023e, 2);
+    // 023e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0240: br 0242
+    AOT_GOTO(0x0242, L0242);
+L0242:
+    AOT_BLOCK(0x0242, 2);
+    // 0242: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0246:
+    AOT_BLOCK(0x0246, 4);
+    // 0246: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x024a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 024a: tst 3448
+    {
+        a = 0x3448;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 024e: blt 026a
+    if (N ^ V)
+        AOT_GOTO(0x026a, L026a);
+    AOT_GOTO(0x0250, L0250);
+L0250:
+    AOT_BLOCK(0x0250, 4);
+    // 0250: mov 3448, r4
+    {
+        a = 0x3448;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0254: mov $ffff, 3448
+    {
+        src = uint16_t(0xffff);
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 025a: cmp $14, r4
+    {
+        src = uint16_t(0x0014);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 025e: bne 0264
+    if (!Z)
+        AOT_GOTO(0x0264, L0264);
+    AOT_GOTO(0x0260, L0260);
+L0260:
+    AOT_BLOCK(0x0260, 1);
+    // 0260: clr 5406
+    {
+        a = 0x5406;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0264, L0264);
+L0264:
+    AOT_BLOCK(0x0264, 2);
+    // 0264: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0266: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L026a:
+    AOT_BLOCK(0x026a, 2);
+    // 026a: tst 4ffc
+    {
+        a = 0x4ffc;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 026e: beq 027a
+    if (Z)
+        AOT_GOTO(0x027a, L027a);
+    AOT_GOTO(0x0270, L0270);
+L0270:
+    AOT_BLOCK(0x0270, 3);
+    // 0270: mov 4ffc, r4
+    {
+        a = 0x4ffc;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0274: clr 4ffc
+    {
+        a = 0x4ffc;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0278: br 028c
+    AOT_GOTO(0x028c, L028c);
+L027a:
+    AOT_BLOCK(0x027a, 2);
+    // 027a: tst 4ffe
+    {
+        a = 0x4ffe;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 027e: beq 0286
+    if (Z)
+        AOT_GOTO(0x0286, L0286);
+    AOT_GOTO(0x0280, L0280);
+L0280:
+    AOT_BLOCK(0x0280, 2);
+    // 0280: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0282: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L0286:
+    AOT_BLOCK(0x0286, 1);
+    // 0286: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x028a);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L028a:
+    AOT_BLOCK(0x028a, 1);
+    // 028a: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x028c, L028c);
+L028c:
+    AOT_BLOCK(0x028c, 2);
+    // 028c: movb 3e24(r4), r0
+    {
+        a = uint16_t(r[4] + 15908);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0290: jmp *$051a
+    {
+        a = 0x051a;
+    }
+    AOT_GOTO(0x051a, L051a);
+L0294:
+    AOT_BLOCK(0x0294, 2);
+    // 0294: mov $1, 540a
+    {
+        src = uint16_t(0x0001);
+        b = 0x540a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 029a: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x029e);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L029e:
+    AOT_BLOCK(0x029e, 2);
+    // 029e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02a0: br 028c
+    AOT_GOTO(0x028c, L028c);
+L02a2:
+    AOT_BLOCK(0x02a2, 2);
+    // 02a2: tst 540a
+    {
+        a = 0x540a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 02a6: bne 02ac
+    if (!Z)
+        AOT_GOTO(0x02ac, L02ac);
+    AOT_GOTO(0x02a8, L02a8);
+L02a8:
+    AOT_BLOCK(0x02a8, 1);
+    // 02a8: inc 344a
+    {
+        a = 0x344a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x02ac, L02ac);
+L02ac:
+    AOT_BLOCK(0x02ac, 1);
+    // 02ac: clr 540a
+    {
+        a = 0x540a;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x02b0, L02b0);
+L02b0:
+    AOT_BLOCK(0x02b0, 1);
+    // 02b0: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x02b4);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L02b4:
+    AOT_BLOCK(0x02b4, 2);
+    // 02b4: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02b6: br 028c
+    AOT_GOTO(0x028c, L028c);
+L02b8:
+    AOT_BLOCK(0x02b8, 3);
+    // 02b8: inc 4ffe
+    {
+        a = 0x4ffe;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 02bc: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 02be: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L02c2:
+    AOT_BLOCK(0x02c2, 4);
+    // 02c2: mov $1e, (sp)
+    {
+        src = uint16_t(0x001e);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02c6: mov $28, -(sp)
+    {
+        src = uint16_t(0x0028);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02ca: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02cc: jsr pc, *$053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x02d0);
+    }
+    AOT_GOTO(0x053e, L053e);
+L02d0:
+    AOT_BLOCK(0x02d0, 2);
+    // 02d0: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02d2: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L02d6:
+    AOT_BLOCK(0x02d6, 5);
+    // 02d6: mov $1f, (sp)
+    {
+        src = uint16_t(0x001f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02da: mov $32, -(sp)
+    {
+        src = uint16_t(0x0032);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02de: mov $29, -(sp)
+    {
+        src = uint16_t(0x0029);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02e2: mov $3e, -(sp)
+    {
+        src = uint16_t(0x003e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02e6: jsr pc, 053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x02ea);
+    }
+    AOT_GOTO(0x053e, L053e);
+L02ea:
+    AOT_BLOCK(0x02ea, 4);
+    // 02ea: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 02ee: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02f0: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02f2: jsr pc, *$053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x02f6);
+    }
+    AOT_GOTO(0x053e, L053e);
+L02f6:
+    AOT_BLOCK(0x02f6, 2);
+    // 02f6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02f8: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L02fc:
+    AOT_BLOCK(0x02fc, 4);
+    // 02fc: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0300: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0302: mov $20, -(sp)
+    {
+        src = uint16_t(0x0020);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0306: jsr pc, *$053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x030a);
+    }
+    AOT_GOTO(0x053e, L053e);
+L030a:
+    AOT_BLOCK(0x030a, 3);
+    // 030a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 030c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 030e: beq 0318
+    if (Z)
+        AOT_GOTO(0x0318, L0318);
+    AOT_GOTO(0x0310, L0310);
+L0310:
+    AOT_BLOCK(0x0310, 2);
+    // 0310: mov $50, r0
+    {
+        src = uint16_t(0x0050);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0314: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L0318:
+    AOT_BLOCK(0x0318, 1);
+    // 0318: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x031c);
+    }
+    AOT_GOTO(0x0246, L0246);
+L031c:
+    AOT_BLOCK(0x031c, 3);
+    // 031c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 031e: cmp $28, r4
+    {
+        src = uint16_t(0x0028);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0322: bgt 035c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x035c, L035c);
+    AOT_GOTO(0x0324, L0324);
+L0324:
+    AOT_BLOCK(0x0324, 2);
+    // 0324: cmp $31, r4
+    {
+        src = uint16_t(0x0031);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0328: blt 035c
+    if (N ^ V)
+        AOT_GOTO(0x035c, L035c);
+    AOT_GOTO(0x032a, L032a);
+L032a:
+    AOT_BLOCK(0x032a, 1);
+    // 032a: jsr pc, 2e24
+    {
+        a = 0x2e24;
+        r[6] -= 2;
+        WR16(r[6], 0x032e);
+    }
+    AOT_GOTO(0x2e24, L2e24);
+L032e:
+    AOT_BLOCK(0x032e, 2);
+    // 032e: cmp $20, r0
+    {
+        src = uint16_t(0x0020);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0332: beq 0352
+    if (Z)
+        AOT_GOTO(0x0352, L0352);
+    AOT_GOTO(0x0334, L0334);
+L0334:
+    AOT_BLOCK(0x0334, 2);
+    // 0334: cmp $29, r4
+    {
+        src = uint16_t(0x0029);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0338: beq 0346
+    if (Z)
+        AOT_GOTO(0x0346, L0346);
+    AOT_GOTO(0x033a, L033a);
+L033a:
+    AOT_BLOCK(0x033a, 2);
+    // 033a: cmp $2f, r4
+    {
+        src = uint16_t(0x002f);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 033e: beq 0346
+    if (Z)
+        AOT_GOTO(0x0346, L0346);
+    AOT_GOTO(0x0340, L0340);
+L0340:
+    AOT_BLOCK(0x0340, 2);
+    // 0340: cmp $2a, r4
+    {
+        src = uint16_t(0x002a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0344: bne 0352
+    if (!Z)
+        AOT_GOTO(0x0352, L0352);
+    AOT_GOTO(0x0346, L0346);
+L0346:
+    AOT_BLOCK(0x0346, 2);
+    // 0346: mov $3707, (sp)
+    {
+        src = uint16_t(0x3707);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 034a: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x034e);
+    }
+    AOT_GOTO(0x1388, L1388);
+L034e:
+    AOT_BLOCK(0x034e, 1);
+    // 034e: dec 53fe
+    {
+        a = 0x53fe;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0352, L0352);
+L0352:
+    AOT_BLOCK(0x0352, 3);
+    // 0352: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0354: add $1e, r0
+    {
+        src = uint16_t(0x001e);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0358: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L035c:
+    AOT_BLOCK(0x035c, 2);
+    // 035c: cmp $50, r4
+    {
+        src = uint16_t(0x0050);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0360: bne 036a
+    if (!Z)
+        AOT_GOTO(0x036a, L036a);
+    AOT_GOTO(0x0362, L0362);
+L0362:
+    AOT_BLOCK(0x0362, 2);
+    // 0362: mov $3c, r0
+    {
+        src = uint16_t(0x003c);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0366: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L036a:
+    AOT_BLOCK(0x036a, 3);
+    // 036a: mov r4, 3448
+    {
+        src = r[4];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 036e: mov $50, r0
+    {
+        src = uint16_t(0x0050);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0372: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L0376:
+    AOT_BLOCK(0x0376, 4);
+    // 0376: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 037a: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 037c: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 037e: jsr pc, *$053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x0382);
+    }
+    AOT_GOTO(0x053e, L053e);
+L0382:
+    AOT_BLOCK(0x0382, 3);
+    // 0382: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0384: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0386: beq 0390
+    if (Z)
+        AOT_GOTO(0x0390, L0390);
+    AOT_GOTO(0x0388, L0388);
+L0388:
+    AOT_BLOCK(0x0388, 2);
+    // 0388: mov $2e, r0
+    {
+        src = uint16_t(0x002e);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 038c: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L0390:
+    AOT_BLOCK(0x0390, 4);
+    // 0390: mov $3e, (sp)
+    {
+        src = uint16_t(0x003e);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0394: mov $3f, -(sp)
+    {
+        src = uint16_t(0x003f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0398: mov $3d, -(sp)
+    {
+        src = uint16_t(0x003d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 039c: jsr pc, *$053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x03a0);
+    }
+    AOT_GOTO(0x053e, L053e);
+L03a0:
+    AOT_BLOCK(0x03a0, 2);
+    // 03a0: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03a2: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L03a6:
+    AOT_BLOCK(0x03a6, 4);
+    // 03a6: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03aa: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 03ac: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03ae: jsr pc, *$053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x03b2);
+    }
+    AOT_GOTO(0x053e, L053e);
+L03b2:
+    AOT_BLOCK(0x03b2, 3);
+    // 03b2: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 03b4: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03b6: beq 03c0
+    if (Z)
+        AOT_GOTO(0x03c0, L03c0);
+    AOT_GOTO(0x03b8, L03b8);
+L03b8:
+    AOT_BLOCK(0x03b8, 2);
+    // 03b8: mov $2d, r0
+    {
+        src = uint16_t(0x002d);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03bc: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L03c0:
+    AOT_BLOCK(0x03c0, 4);
+    // 03c0: mov $40, (sp)
+    {
+        src = uint16_t(0x0040);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03c4: mov $41, -(sp)
+    {
+        src = uint16_t(0x0041);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03c8: mov $3d, -(sp)
+    {
+        src = uint16_t(0x003d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03cc: jsr pc, *$053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x03d0);
+    }
+    AOT_GOTO(0x053e, L053e);
+L03d0:
+    AOT_BLOCK(0x03d0, 2);
+    // 03d0: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03d2: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L03d6:
+    AOT_BLOCK(0x03d6, 4);
+    // 03d6: mov $3d, (sp)
+    {
+        src = uint16_t(0x003d);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03da: mov $22, -(sp)
+    {
+        src = uint16_t(0x0022);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03de: mov $3d, -(sp)
+    {
+        src = uint16_t(0x003d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03e2: jsr pc, *$053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x03e6);
+    }
+    AOT_GOTO(0x053e, L053e);
+L03e6:
+    AOT_BLOCK(0x03e6, 2);
+    // 03e6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03e8: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L03ec:
+    AOT_BLOCK(0x03ec, 4);
+    // 03ec: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 03ee: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03f2: mov $2a, -(sp)
+    {
+        src = uint16_t(0x002a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03f6: jsr pc, *$053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x03fa);
+    }
+    AOT_GOTO(0x053e, L053e);
+L03fa:
+    AOT_BLOCK(0x03fa, 3);
+    // 03fa: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 03fc: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03fe: beq 0408
+    if (Z)
+        AOT_GOTO(0x0408, L0408);
+    AOT_GOTO(0x0400, L0400);
+L0400:
+    AOT_BLOCK(0x0400, 2);
+    // 0400: mov $2b, r0
+    {
+        src = uint16_t(0x002b);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0404: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L0408:
+    AOT_BLOCK(0x0408, 1);
+    // 0408: jsr pc, 2e24
+    {
+        a = 0x2e24;
+        r[6] -= 2;
+        WR16(r[6], 0x040c);
+    }
+    AOT_GOTO(0x2e24, L2e24);
+L040c:
+    AOT_BLOCK(0x040c, 3);
+    // 040c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 040e: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0410: beq 0436
+    if (Z)
+        AOT_GOTO(0x0436, L0436);
+    AOT_GOTO(0x0412, L0412);
+L0412:
+    AOT_BLOCK(0x0412, 3);
+    // 0412: clr 4ffc
+    {
+        a = 0x4ffc;
+        WR16(a, 0);
+    }
+    // 0416: cmp $2a, r4
+    {
+        src = uint16_t(0x002a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 041a: bne 0434
+    if (!Z)
+        AOT_GOTO(0x0434, L0434);
+    AOT_GOTO(0x041c, L041c);
+L041c:
+    AOT_BLOCK(0x041c, 1);
+    // 041c: jsr pc, 2e24
+    {
+        a = 0x2e24;
+        r[6] -= 2;
+        WR16(r[6], 0x0420);
+    }
+    AOT_GOTO(0x2e24, L2e24);
+L0420:
+    AOT_BLOCK(0x0420, 2);
+    // 0420: cmp $2f, r0
+    {
+        src = uint16_t(0x002f);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0424: bne 0434
+    if (!Z)
+        AOT_GOTO(0x0434, L0434);
+    AOT_GOTO(0x0426, L0426);
+L0426:
+    AOT_BLOCK(0x0426, 2);
+    // 0426: clr 4ffc
+    {
+        a = 0x4ffc;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 042a: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x042e);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L042e:
+    AOT_BLOCK(0x042e, 2);
+    // 042e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0430: jmp *$028c
+    {
+        a = 0x028c;
+    }
+    AOT_GOTO(0x028c, L028c);
+L0434:
+    AOT_BLOCK(0x0434, 1);
+    // 0434: br 0408
+    AOT_GOTO(0x0408, L0408);
+L0436:
+    AOT_BLOCK(0x0436, 3);
+    // 0436: inc 4ffe
+    {
+        a = 0x4ffe;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 043a: mov $372c, (sp)
+    {
+        src = uint16_t(0x372c);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 043e: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x0442);
+    }
+    AOT_GOTO(0x1388, L1388);
+L0442:
+    AOT_BLOCK(0x0442, 2);
+    // 0442: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0444: jmp *$053a
+    {
+        a = 0x053a;
+    }
+    AOT_GOTO(0x053a, L053a);
+L0448:
+    AOT_BLOCK(0x0448, 3);
+    // 0448: mov r4, 4ffc
+    {
+        src = r[4];
+        b = 0x4ffc;
+        WR16(b, src);
+    }
+    // 044c: cmp $30, r4
+    {
+        src = uint16_t(0x0030);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0450: bne 0458
+    if (!Z)
+        AOT_GOTO(0x0458, L0458);
+    AOT_GOTO(0x0452, L0452);
+L0452:
+    AOT_BLOCK(0x0452, 2);
+    // 0452: mov $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0456: br 045c
+    AOT_GOTO(0x045c, L045c);
+L0458:
+    AOT_BLOCK(0x0458, 1);
+    // 0458: mov $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x045c, L045c);
+L045c:
+    AOT_BLOCK(0x045c, 1);
+    // 045c: jsr pc, *$3018
+    {
+        a = 0x3018;
+        r[6] -= 2;
+        WR16(r[6], 0x0460);
+    }
+    AOT_GOTO(0x3018, L3018);
+L0460:
+    AOT_BLOCK(0x0460, 3);
+    // 0460: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0462: cmp $17, r4
+    {
+        src = uint16_t(0x0017);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0466: bne 0472
+    if (!Z)
+        AOT_GOTO(0x0472, L0472);
+    AOT_GOTO(0x0468, L0468);
+L0468:
+    AOT_BLOCK(0x0468, 2);
+    // 0468: mov 3444, 53f2
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = 0x53f2;
+        WR16(b, src);
+    }
+    // 046e: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0472, L0472);
+L0472:
+    AOT_BLOCK(0x0472, 2);
+    // 0472: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0474: br 053a
+    AOT_GOTO(0x053a, L053a);
+L0476:
+    AOT_BLOCK(0x0476, 1);
+    // 0476: jsr pc, 0560
+    {
+        a = 0x0560;
+        r[6] -= 2;
+        WR16(r[6], 0x047a);
+    }
+    AOT_GOTO(0x0560, L0560);
+L047a:
+    AOT_BLOCK(0x047a, 1);
+    // 047a: br 053a
+    AOT_GOTO(0x053a, L053a);
+L047c:
+    AOT_BLOCK(0x047c, 1);
+    // 047c: jsr pc, 0612
+    {
+        a = 0x0612;
+        r[6] -= 2;
+        WR16(r[6], 0x0480);
+    }
+    AOT_GOTO(0x0612, L0612);
+L0480:
+    AOT_BLOCK(0x0480, 1);
+    // 0480: br 053a
+    AOT_GOTO(0x053a, L053a);
+L0482:
+    AOT_BLOCK(0x0482, 3);
+    // 0482: mov $3fee, r3
+    {
+        src = uint16_t(0x3fee);
+        r[3] = src;
+    }
+    // 0486: tst 5406
+    {
+        a = 0x5406;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 048a: beq 0494
+    if (Z)
+        AOT_GOTO(0x0494, L0494);
+    AOT_GOTO(0x048c, L048c);
+L048c:
+    AOT_BLOCK(0x048c, 2);
+    // 048c: movb $2e, (r3)+
+    {
+        src = uint8_t(0x2e);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 0490: clr 5406
+    {
+        a = 0x5406;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0494, L0494);
+L0494:
+    AOT_BLOCK(0x0494, 2);
+    // 0494: cmpb $7b, 3e24(r4)
+    {
+        src = uint8_t(0x7b);
+        b = uint16_t(r[4] + 15908);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 049a: beq 04a4
+    if (Z)
+        AOT_GOTO(0x04a4, L04a4);
+    AOT_GOTO(0x049c, L049c);
+L049c:
+    AOT_BLOCK(0x049c, 2);
+    // 049c: cmpb $7c, 3e24(r4)
+    {
+        src = uint8_t(0x7c);
+        b = uint16_t(r[4] + 15908);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 04a2: bne 04b4
+    if (!Z)
+        AOT_GOTO(0x04b4, L04b4);
+    AOT_GOTO(0x04a4, L04a4);
+L04a4:
+    AOT_BLOCK(0x04a4, 2);
+    // 04a4: cmp $3ff6, r3
+    {
+        src = uint16_t(0x3ff6);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04a8: blos 04ac
+    if (C | Z)
+        AOT_GOTO(0x04ac, L04ac);
+    AOT_GOTO(0x04aa, L04aa);
+L04aa:
+    AOT_BLOCK(0x04aa, 1);
+    // 04aa: movb r4, (r3)+
+    {
+        src = uint8_t(r[4]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04ac, L04ac);
+L04ac:
+    AOT_BLOCK(0x04ac, 1);
+    // 04ac: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x04b0);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L04b0:
+    AOT_BLOCK(0x04b0, 2);
+    // 04b0: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04b2: br 0494
+    AOT_GOTO(0x0494, L0494);
+L04b4:
+    AOT_BLOCK(0x04b4, 2);
+    // 04b4: cmp $3ff6, r3
+    {
+        src = uint16_t(0x3ff6);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04b8: blos 04be
+    if (C | Z)
+        AOT_GOTO(0x04be, L04be);
+    AOT_GOTO(0x04ba, L04ba);
+L04ba:
+    AOT_BLOCK(0x04ba, 2);
+    // 04ba: clrb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 04bc: br 04b4
+    AOT_GOTO(0x04b4, L04b4);
+L04be:
+    AOT_BLOCK(0x04be, 2);
+    // 04be: mov r4, 4ffc
+    {
+        src = r[4];
+        b = 0x4ffc;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04c2: jsr pc, 012a
+    {
+        a = 0x012a;
+        r[6] -= 2;
+        WR16(r[6], 0x04c6);
+    }
+    AOT_GOTO(0x012a, L012a);
+L04c6:
+    AOT_BLOCK(0x04c6, 3);
+    // 04c6: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 04c8: cmp $13, r4
+    {
+        src = uint16_t(0x0013);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04cc: bne 04da
+    if (!Z)
+        AOT_GOTO(0x04da, L04da);
+    AOT_GOTO(0x04ce, L04ce);
+L04ce:
+    AOT_BLOCK(0x04ce, 2);
+    // 04ce: cmp $5b, 53f2
+    {
+        src = uint16_t(0x005b);
+        b = 0x53f2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04d4: bne 04da
+    if (!Z)
+        AOT_GOTO(0x04da, L04da);
+    AOT_GOTO(0x04d6, L04d6);
+L04d6:
+    AOT_BLOCK(0x04d6, 1);
+    // 04d6: mov $5b, r4
+    {
+        src = uint16_t(0x005b);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04da, L04da);
+L04da:
+    AOT_BLOCK(0x04da, 2);
+    // 04da: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04dc: br 053a
+    AOT_GOTO(0x053a, L053a);
+L04de:
+    AOT_BLOCK(0x04de, 4);
+    // 04de: mov $35, (sp)
+    {
+        src = uint16_t(0x0035);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04e2: mov $2f, -(sp)
+    {
+        src = uint16_t(0x002f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04e6: mov $26, -(sp)
+    {
+        src = uint16_t(0x0026);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04ea: jsr pc, *$053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x04ee);
+    }
+    AOT_GOTO(0x053e, L053e);
+L04ee:
+    AOT_BLOCK(0x04ee, 2);
+    // 04ee: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04f0: br 053a
+    AOT_GOTO(0x053a, L053a);
+L04f2:
+    AOT_BLOCK(0x04f2, 4);
+    // 04f2: mov $36, (sp)
+    {
+        src = uint16_t(0x0036);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04f6: mov $30, -(sp)
+    {
+        src = uint16_t(0x0030);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04fa: mov $7c, -(sp)
+    {
+        src = uint16_t(0x007c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04fe: jsr pc, *$053e
+    {
+        a = 0x053e;
+        r[6] -= 2;
+        WR16(r[6], 0x0502);
+    }
+    AOT_GOTO(0x053e, L053e);
+L0502:
+    AOT_BLOCK(0x0502, 2);
+    // 0502: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0504: br 053a
+    AOT_GOTO(0x053a, L053a);
+L0506:
+    AOT_BLOCK(0x0506, 2);
+    // 0506: mov $3742, (sp)
+    {
+        src = uint16_t(0x3742);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 050a: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x050e);
+    }
+    AOT_GOTO(0x1388, L1388);
+L050e:
+    AOT_BLOCK(0x050e, 1);
+    // 050e: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0512);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L0512:
+    AOT_BLOCK(0x0512, 2);
+    // 0512: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0514: jmp *$028c
+    {
+        a = 0x028c;
+    }
+    AOT_GOTO(0x028c, L028c);
+L051a:
+    AOT_BLOCK(0x051a, 7);
+    // 051a: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 051c: clr r0
+    {
+        r[0] = 0;
+    }
+    // 051e: div $4, r0
+    {
+        src = int16_t(uint16_t(0x0004));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0522: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0524: add $34be, r1
+    {
+        src = uint16_t(0x34be);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0528: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 052a: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x052c, L052c);
+L052c:
+    AOT_BLOCK(0x052c, 2);
+    // 052c: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 052e: bne 052c
+    if (!Z)
+        AOT_GOTO(0x052c, L052c);
+    AOT_GOTO(0x0530, L0530);
+L0530:
+    AOT_BLOCK(0x0530, 1);
+    // 0530: jmp *2e(r1)
+    {
+        a = RD16(r[1] + 46);
+    }
+    AOT_JUMP(a);
+L0534:
+    AOT_BLOCK(0x0534, 2);
+    // 0534: movb 3e24(r4), r0
+    {
+        a = uint16_t(r[4] + 15908);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0538: br 053a
+    AOT_GOTO(0x053a, L053a);
+L053a:
+    AOT_BLOCK(0x053a, 2);
+    // 053a: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L053e:
+    AOT_BLOCK(0x053e, 3);
+    // 053e: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0542;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0542: jsr pc, 2e24
+    {
+        a = 0x2e24;
+        r[6] -= 2;
+        WR16(r[6], 0x0546);
+    }
+    AOT_GOTO(0x2e24, L2e24);
+L0546:
+    AOT_BLOCK(0x0546, 2);
+    // 0546: cmp 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 054a: beq 0552
+    if (Z)
+        AOT_GOTO(0x0552, L0552);
+    AOT_GOTO(0x054c, L054c);
+L054c:
+    AOT_BLOCK(0x054c, 2);
+    // 054c: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0550: br 055c
+    AOT_GOTO(0x055c, L055c);
+L0552:
+    AOT_BLOCK(0x0552, 3);
+    // 0552: clr 4ffc
+    {
+        a = 0x4ffc;
+        WR16(a, 0);
+        C = false;
+    }
+    // 0556: mov 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 055a: br 055c
+    AOT_GOTO(0x055c, L055c);
+L055c:
+    AOT_BLOCK(0x055c, 2);
+    // 055c: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0560:
+    AOT_BLOCK(0x0560, 4);
+    // 0560: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0564;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0564: mov $1, 53fc
+    {
+        src = uint16_t(0x0001);
+        b = 0x53fc;
+        WR16(b, src);
+    }
+    // 056a: mov $3eec, r3
+    {
+        src = uint16_t(0x3eec);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x056e, L056e);
+L056e:
+    AOT_BLOCK(0x056e, 2);
+    // 056e: mov $22, (sp)
+    {
+        src = uint16_t(0x0022);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0572: jsr pc, *$0654
+    {
+        a = 0x0654;
+        r[6] -= 2;
+        WR16(r[6], 0x0576);
+    }
+    AOT_GOTO(0x0654, L0654);
+L0576:
+    AOT_BLOCK(0x0576, 3);
+    // 0576: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0578: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 057a: blt 0596
+    if (N ^ V)
+        AOT_GOTO(0x0596, L0596);
+    AOT_GOTO(0x057c, L057c);
+L057c:
+    AOT_BLOCK(0x057c, 3);
+    // 057c: inc 53fc
+    {
+        a = 0x53fc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0580: cmp $3fec, r3
+    {
+        src = uint16_t(0x3fec);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0584: bhi 0592
+    if (!(C | Z))
+        AOT_GOTO(0x0592, L0592);
+    AOT_GOTO(0x0586, L0586);
+L0586:
+    AOT_BLOCK(0x0586, 3);
+    // 0586: mov $3eec, r3
+    {
+        src = uint16_t(0x3eec);
+        r[3] = src;
+    }
+    // 058a: mov $3754, (sp)
+    {
+        src = uint16_t(0x3754);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 058e: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x0592);
+    }
+    AOT_GOTO(0x1388, L1388);
+L0592:
+    AOT_BLOCK(0x0592, 2);
+    // 0592: movb r4, (r3)+
+    {
+        src = uint8_t(r[4]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0594: br 056e
+    AOT_GOTO(0x056e, L056e);
+L0596:
+    AOT_BLOCK(0x0596, 5);
+    // 0596: mov r3, 3fec
+    {
+        src = r[3];
+        b = 0x3fec;
+        WR16(b, src);
+    }
+    // 059a: mov 3444, 53f2
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = 0x53f2;
+        WR16(b, src);
+    }
+    // 05a0: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 05a4: mov $16, r0
+    {
+        src = uint16_t(0x0016);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05a8: br 05aa
+    AOT_GOTO(0x05aa, L05aa);
+L05aa:
+    AOT_BLOCK(0x05aa, 2);
+    // 05aa: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L05ae:
+    AOT_BLOCK(0x05ae, 4);
+    // 05ae: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x05b2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 05b2: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05b6: beq 05d6
+    if (Z)
+        AOT_GOTO(0x05d6, L05d6);
+    AOT_GOTO(0x05b8, L05b8);
+L05b8:
+    AOT_BLOCK(0x05b8, 6);
+    // 05b8: inc 5404
+    {
+        a = 0x5404;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 05bc: mov $c8, (sp)
+    {
+        src = uint16_t(0x00c8);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05c0: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05c4: mov $70, -(sp)
+    {
+        src = uint16_t(0x0070);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05c8: mov $3764, -(sp)
+    {
+        src = uint16_t(0x3764);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05cc: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x05d0);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L05d0:
+    AOT_BLOCK(0x05d0, 2);
+    // 05d0: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 05d4: br 05e4
+    AOT_GOTO(0x05e4, L05e4);
+L05d6:
+    AOT_BLOCK(0x05d6, 3);
+    // 05d6: mov $c8, (sp)
+    {
+        src = uint16_t(0x00c8);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05da: mov $3768, -(sp)
+    {
+        src = uint16_t(0x3768);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05de: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x05e2);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L05e2:
+    AOT_BLOCK(0x05e2, 1);
+    // 05e2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x05e4, L05e4);
+L05e4:
+    AOT_BLOCK(0x05e4, 1);
+    // 05e4: mov $3eec, r4
+    {
+        src = uint16_t(0x3eec);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x05e8, L05e8);
+L05e8:
+    AOT_BLOCK(0x05e8, 2);
+    // 05e8: cmp 3fec, r4
+    {
+        a = 0x3fec;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05ec: blos 0602
+    if (C | Z)
+        AOT_GOTO(0x0602, L0602);
+    AOT_GOTO(0x05ee, L05ee);
+L05ee:
+    AOT_BLOCK(0x05ee, 5);
+    // 05ee: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 05f0: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05f2: bic $ff00, (sp)
+    {
+        src = uint16_t(0xff00);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 05f6: mov $376a, -(sp)
+    {
+        src = uint16_t(0x376a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05fa: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x05fe);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L05fe:
+    AOT_BLOCK(0x05fe, 2);
+    // 05fe: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0600: br 05e8
+    AOT_GOTO(0x05e8, L05e8);
+L0602:
+    AOT_BLOCK(0x0602, 2);
+    // 0602: mov $376d, (sp)
+    {
+        src = uint16_t(0x376d);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0606: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x060a);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L060a:
+    AOT_BLOCK(0x060a, 3);
+    // 060a: clr 5404
+    {
+        a = 0x5404;
+        WR16(a, 0);
+        C = false;
+    }
+    // 060e: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0612:
+    AOT_BLOCK(0x0612, 5);
+    // 0612: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0616;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0616: clr 53f2
+    {
+        a = 0x53f2;
+        WR16(a, 0);
+    }
+    // 061a: mov $53f2, r2
+    {
+        src = uint16_t(0x53f2);
+        r[2] = src;
+    }
+    // 061e: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0620, L0620);
+L0620:
+    AOT_BLOCK(0x0620, 2);
+    // 0620: mov $27, (sp)
+    {
+        src = uint16_t(0x0027);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0624: jsr pc, *$0654
+    {
+        a = 0x0654;
+        r[6] -= 2;
+        WR16(r[6], 0x0628);
+    }
+    AOT_GOTO(0x0654, L0654);
+L0628:
+    AOT_BLOCK(0x0628, 3);
+    // 0628: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 062a: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 062c: blt 063c
+    if (N ^ V)
+        AOT_GOTO(0x063c, L063c);
+    AOT_GOTO(0x062e, L062e);
+L062e:
+    AOT_BLOCK(0x062e, 4);
+    // 062e: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 0630: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+    }
+    // 0632: cmp $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0636: ble 063a
+    if (Z || (N ^ V))
+        AOT_GOTO(0x063a, L063a);
+    AOT_GOTO(0x0638, L0638);
+L0638:
+    AOT_BLOCK(0x0638, 1);
+    // 0638: movb r4, (r2)+
+    {
+        src = uint8_t(r[4]);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x063a, L063a);
+L063a:
+    AOT_BLOCK(0x063a, 1);
+    // 063a: br 0620
+    AOT_GOTO(0x0620, L0620);
+L063c:
+    AOT_BLOCK(0x063c, 2);
+    // 063c: cmp $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0640: bge 064a
+    if (!(N ^ V))
+        AOT_GOTO(0x064a, L064a);
+    AOT_GOTO(0x0642, L0642);
+L0642:
+    AOT_BLOCK(0x0642, 2);
+    // 0642: mov $3771, (sp)
+    {
+        src = uint16_t(0x3771);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0646: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x064a);
+    }
+    AOT_GOTO(0x1388, L1388);
+L064a:
+    AOT_BLOCK(0x064a, 2);
+    // 064a: mov $15, r0
+    {
+        src = uint16_t(0x0015);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 064e: br 0650
+    AOT_GOTO(0x0650, L0650);
+L0650:
+    AOT_BLOCK(0x0650, 2);
+    // 0650: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0654:
+    AOT_BLOCK(0x0654, 5);
+    // 0654: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0658;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0658: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 065c: mov 5aee, r4
+    {
+        a = 0x5aee;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0660: bne 0666
+    if (!Z)
+        AOT_GOTO(0x0666, L0666);
+    AOT_GOTO(0x0662, L0662);
+L0662:
+    AOT_BLOCK(0x0662, 1);
+    // 0662: jmp *$066e
+    {
+        a = 0x066e;
+    }
+    AOT_GOTO(0x066e, L066e);
+L0666:
+    AOT_BLOCK(0x0666, 2);
+    // 0666: clr 5aee
+    {
+        a = 0x5aee;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 066a: jmp *$0674
+    {
+        a = 0x0674;
+    }
+    AOT_GOTO(0x0674, L0674);
+L066e:
+    AOT_BLOCK(0x066e, 1);
+    // 066e: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0672);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L0672:
+    AOT_BLOCK(0x0672, 1);
+    // 0672: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0674, L0674);
+L0674:
+    AOT_BLOCK(0x0674, 2);
+    // 0674: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0676: bne 067e
+    if (!Z)
+        AOT_GOTO(0x067e, L067e);
+    AOT_GOTO(0x0678, L0678);
+L0678:
+    AOT_BLOCK(0x0678, 2);
+    // 0678: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 067c: br 0732
+    AOT_GOTO(0x0732, L0732);
+L067e:
+    AOT_BLOCK(0x067e, 2);
+    // 067e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0680: br 071e
+    AOT_GOTO(0x071e, L071e);
+L0682:
+    AOT_BLOCK(0x0682, 2);
+    // 0682: mov $3789, (sp)
+    {
+        src = uint16_t(0x3789);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0686: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x068a);
+    }
+    AOT_GOTO(0x1388, L1388);
+L068a:
+    AOT_BLOCK(0x068a, 3);
+    // 068a: mov r4, 4ffc
+    {
+        src = r[4];
+        b = 0x4ffc;
+        WR16(b, src);
+    }
+    // 068e: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0692: br 0732
+    AOT_GOTO(0x0732, L0732);
+L0694:
+    AOT_BLOCK(0x0694, 1);
+    // 0694: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0698);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L0698:
+    AOT_BLOCK(0x0698, 3);
+    // 0698: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 069a: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 069c: br 0702
+    AOT_GOTO(0x0702, L0702);
+L069e:
+    AOT_BLOCK(0x069e, 2);
+    // 069e: mov $9, r0
+    {
+        src = uint16_t(0x0009);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06a2: br 0732
+    AOT_GOTO(0x0732, L0732);
+L06a4:
+    AOT_BLOCK(0x06a4, 2);
+    // 06a4: mov $a, r0
+    {
+        src = uint16_t(0x000a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06a8: br 0732
+    AOT_GOTO(0x0732, L0732);
+L06aa:
+    AOT_BLOCK(0x06aa, 2);
+    // 06aa: mov $8, r0
+    {
+        src = uint16_t(0x0008);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06ae: br 0732
+    AOT_GOTO(0x0732, L0732);
+L06b0:
+    AOT_BLOCK(0x06b0, 2);
+    // 06b0: clr r2
+    {
+        r[2] = 0;
+    }
+    // 06b2: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x06b4, L06b4);
+L06b4:
+    AOT_BLOCK(0x06b4, 3);
+    // 06b4: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+    }
+    // 06b6: cmp $3, r3
+    {
+        src = uint16_t(0x0003);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06ba: blt 06dc
+    if (N ^ V)
+        AOT_GOTO(0x06dc, L06dc);
+    AOT_GOTO(0x06bc, L06bc);
+L06bc:
+    AOT_BLOCK(0x06bc, 2);
+    // 06bc: cmp $30, r4
+    {
+        src = uint16_t(0x0030);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06c0: bgt 06dc
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x06dc, L06dc);
+    AOT_GOTO(0x06c2, L06c2);
+L06c2:
+    AOT_BLOCK(0x06c2, 2);
+    // 06c2: cmp $37, r4
+    {
+        src = uint16_t(0x0037);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06c6: blt 06dc
+    if (N ^ V)
+        AOT_GOTO(0x06dc, L06dc);
+    AOT_GOTO(0x06c8, L06c8);
+L06c8:
+    AOT_BLOCK(0x06c8, 5);
+    // 06c8: ash $3, r2
+    {
+        src = uint16_t(0x0003) & 077;
+        val16 = r[2];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 06cc: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 06ce: add $ffd0, r0
+    {
+        src = uint16_t(0xffd0);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 06d2: add r0, r2
+    {
+        src = r[0];
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 06d4: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x06d8);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L06d8:
+    AOT_BLOCK(0x06d8, 2);
+    // 06d8: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06da: br 06b4
+    AOT_GOTO(0x06b4, L06b4);
+L06dc:
+    AOT_BLOCK(0x06dc, 3);
+    // 06dc: mov r4, 5aee
+    {
+        src = r[4];
+        b = 0x5aee;
+        WR16(b, src);
+    }
+    // 06e0: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06e2: br 0732
+    AOT_GOTO(0x0732, L0732);
+L06e4:
+    AOT_BLOCK(0x06e4, 2);
+    // 06e4: mov $d, r0
+    {
+        src = uint16_t(0x000d);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06e8: br 0732
+    AOT_GOTO(0x0732, L0732);
+L06ea:
+    AOT_BLOCK(0x06ea, 2);
+    // 06ea: tst 540a
+    {
+        a = 0x540a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06ee: bne 06f4
+    if (!Z)
+        AOT_GOTO(0x06f4, L06f4);
+    AOT_GOTO(0x06f0, L06f0);
+L06f0:
+    AOT_BLOCK(0x06f0, 1);
+    // 06f0: inc 344a
+    {
+        a = 0x344a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x06f4, L06f4);
+L06f4:
+    AOT_BLOCK(0x06f4, 2);
+    // 06f4: clr 540a
+    {
+        a = 0x540a;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 06f8: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x06fc);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L06fc:
+    AOT_BLOCK(0x06fc, 2);
+    // 06fc: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06fe: br 0674
+    AOT_GOTO(0x0674, L0674);
+L0702:
+    AOT_BLOCK(0x0702, 2);
+    // 0702: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0704: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0706, L0706);
+L0706:
+    AOT_BLOCK(0x0706, 1);
+    // 0706: div $3, r0
+    {
+        src = int16_t(uint16_t(0x0003));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    AOT_GOTO(0x070a, L070a);
+L0708:
+    // 0708: bpt
+    AOT_INTERP(0x0708);
+L070a:
+    AOT_BLOCK(0x070a, 4);
+    // 070a: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 070c: add $3524, r1
+    {
+        src = uint16_t(0x3524);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0710: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 0712: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0714, L0714);
+L0714:
+    AOT_BLOCK(0x0714, 2);
+    // 0714: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0716: bne 0714
+    if (!Z)
+        AOT_GOTO(0x0714, L0714);
+    AOT_GOTO(0x0718, L0718);
+L0718:
+    AOT_BLOCK(0x0718, 1);
+    // 0718: jmp *20(r1)
+    {
+        a = RD16(r[1] + 32);
+    }
+    AOT_JUMP(a);
+L071c:
+    AOT_BLOCK(0x071c, 1);
+    // 071c: br 072e
+    AOT_GOTO(0x072e, L072e);
+L071e:
+    AOT_BLOCK(0x071e, 2);
+    // 071e: mov $356c, r1
+    {
+        src = uint16_t(0x356c);
+        r[1] = src;
+    }
+    // 0722: mov r0, 3572
+    {
+        src = r[0];
+        b = 0x3572;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0726, L0726);
+L0726:
+    AOT_BLOCK(0x0726, 2);
+    // 0726: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0728: bne 0726
+    if (!Z)
+        AOT_GOTO(0x0726, L0726);
+    AOT_GOTO(0x072a, L072a);
+L072a:
+    AOT_BLOCK(0x072a, 1);
+    // 072a: jmp *6(r1)
+    {
+        a = RD16(r[1] + 6);
+    }
+    AOT_JUMP(a);
+L072e:
+    AOT_BLOCK(0x072e, 2);
+    // 072e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0730: br 0732
+    AOT_GOTO(0x0732, L0732);
+L0732:
+    AOT_BLOCK(0x0732, 2);
+    // 0732: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0736:
+    AOT_BLOCK(0x0736, 14);
+    // 0736: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x073a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 073a: sub $5a, sp
+    {
+        src = uint16_t(0x005a);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 073e: mov 345c, 4c7a
+    {
+        a = 0x345c;
+        src = RD16(a);
+        b = 0x4c7a;
+        WR16(b, src);
+    }
+    // 0744: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0746: add $ffd0, r0
+    {
+        src = uint16_t(0xffd0);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 074a: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 074e: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0750: add $ffa6, r0
+    {
+        src = uint16_t(0xffa6);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0754: mov r0, -32(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -50);
+        WR16(b, src);
+    }
+    // 0758: mov $4c7e, 4c7c
+    {
+        src = uint16_t(0x4c7e);
+        b = 0x4c7c;
+        WR16(b, src);
+    }
+    // 075e: mov $c8, *-8(r5)
+    {
+        src = uint16_t(0x00c8);
+        b = RD16(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0764: mov $6, *-32(r5)
+    {
+        src = uint16_t(0x0006);
+        b = RD16(r[5] + -50);
+        WR16(b, src);
+    }
+    // 076a: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x076c, L076c);
+L076c:
+    AOT_BLOCK(0x076c, 1);
+    // 076c: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x0770);
+    }
+    AOT_GOTO(0x0246, L0246);
+L0770:
+    AOT_BLOCK(0x0770, 3);
+    // 0770: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0772: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0774: jmp *$0930
+    {
+        a = 0x0930;
+    }
+    AOT_GOTO(0x0930, L0930);
+L0778:
+    AOT_BLOCK(0x0778, 3);
+    // 0778: mov 53f0, r2
+    {
+        a = 0x53f0;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 077c: tstb (r2)
+    {
+        a = r[2];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 077e: bne 07be
+    if (!Z)
+        AOT_GOTO(0x07be, L07be);
+    AOT_GOTO(0x0780, L0780);
+L0780:
+    AOT_BLOCK(0x0780, 2);
+    // 0780: tst 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0784: bne 07be
+    if (!Z)
+        AOT_GOTO(0x07be, L07be);
+    AOT_GOTO(0x0786, L0786);
+L0786:
+    AOT_BLOCK(0x0786, 1);
+    // 0786: jsr pc, 2e06
+    {
+        a = 0x2e06;
+        r[6] -= 2;
+        WR16(r[6], 0x078a);
+    }
+    AOT_GOTO(0x2e06, L2e06);
+L078a:
+    AOT_BLOCK(0x078a, 2);
+    // 078a: cmp $28, r0
+    {
+        src = uint16_t(0x0028);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 078e: bne 079c
+    if (!Z)
+        AOT_GOTO(0x079c, L079c);
+    AOT_GOTO(0x0790, L0790);
+L0790:
+    AOT_BLOCK(0x0790, 3);
+    // 0790: movb $c, (r2)
+    {
+        src = uint8_t(0x0c);
+        b = r[2];
+        WR8(b, src);
+    }
+    // 0794: mov $10, 2(r2)
+    {
+        src = uint16_t(0x0010);
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 079a: br 07be
+    AOT_GOTO(0x07be, L07be);
+L079c:
+    AOT_BLOCK(0x079c, 2);
+    // 079c: tst 5408
+    {
+        a = 0x5408;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07a0: beq 07a8
+    if (Z)
+        AOT_GOTO(0x07a8, L07a8);
+    AOT_GOTO(0x07a2, L07a2);
+L07a2:
+    AOT_BLOCK(0x07a2, 2);
+    // 07a2: movb $c, (r2)
+    {
+        src = uint8_t(0x0c);
+        b = r[2];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 07a6: br 07be
+    AOT_GOTO(0x07be, L07be);
+L07a8:
+    AOT_BLOCK(0x07a8, 3);
+    // 07a8: mov $18, 2(r2)
+    {
+        src = uint16_t(0x0018);
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 07ae: tst 6(r2)
+    {
+        a = uint16_t(r[2] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07b2: bne 07be
+    if (!Z)
+        AOT_GOTO(0x07be, L07be);
+    AOT_GOTO(0x07b4, L07b4);
+L07b4:
+    AOT_BLOCK(0x07b4, 2);
+    // 07b4: mov 3444, 6(r2)
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = uint16_t(r[2] + 6);
+        WR16(b, src);
+    }
+    // 07ba: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x07be, L07be);
+L07be:
+    AOT_BLOCK(0x07be, 2);
+    // 07be: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07c0: jsr pc, *$0ada
+    {
+        a = 0x0ada;
+        r[6] -= 2;
+        WR16(r[6], 0x07c4);
+    }
+    AOT_GOTO(0x0ada, L0ada);
+L07c4:
+    AOT_BLOCK(0x07c4, 3);
+    // 07c4: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 07c8: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 07ce: br 085c
+    AOT_GOTO(0x085c, L085c);
+L07d0:
+    AOT_BLOCK(0x07d0, 2);
+    // 07d0: tst 5408
+    {
+        a = 0x5408;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07d4: bne 07fc
+    if (!Z)
+        AOT_GOTO(0x07fc, L07fc);
+    AOT_GOTO(0x07d6, L07d6);
+L07d6:
+    AOT_BLOCK(0x07d6, 1);
+    // 07d6: mov $ca, (sp)
+    {
+        src = uint16_t(0x00ca);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07da: (undefined)
+    AOT_INTERP(0x07da);
+L07dc:
+    AOT_BLOCK(0x07dc, 7);
+    // 07dc: bic -7da(r0), (sp)+
+    {
+        a = uint16_t(r[0] + -2010);
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 07e0: mov $c9, -(sp)
+    {
+        src = uint16_t(0x00c9);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07e4: mov 53f2, -(sp)
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07e8: mov $70, -(sp)
+    {
+        src = uint16_t(0x0070);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07ec: mov $cb, -(sp)
+    {
+        src = uint16_t(0x00cb);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07f0: mov $379e, -(sp)
+    {
+        src = uint16_t(0x379e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07f4: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x07f8);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L07f8:
+    AOT_BLOCK(0x07f8, 1);
+    // 07f8: add $12, sp
+    {
+        src = uint16_t(0x0012);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x07fc, L07fc);
+L07fc:
+    AOT_BLOCK(0x07fc, 4);
+    // 07fc: mov 53f2, (sp)
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0800: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 0802: cmp $15, r3
+    {
+        src = uint16_t(0x0015);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0806: bne 080c
+    if (!Z)
+        AOT_GOTO(0x080c, L080c);
+    AOT_GOTO(0x0808, L0808);
+L0808:
+    AOT_BLOCK(0x0808, 2);
+    // 0808: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 080a: br 0810
+    AOT_GOTO(0x0810, L0810);
+L080c:
+    AOT_BLOCK(0x080c, 1);
+    // 080c: mov $3, -(sp)
+    {
+        src = uint16_t(0x0003);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0810, L0810);
+L0810:
+    AOT_BLOCK(0x0810, 3);
+    // 0810: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0812: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0816: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x081a);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L081a:
+    AOT_BLOCK(0x081a, 4);
+    // 081a: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 081e: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0822: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0828: br 085c
+    AOT_GOTO(0x085c, L085c);
+L082a:
+    AOT_BLOCK(0x082a, 2);
+    // 082a: mov 53f2, (sp)
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 082e: jsr pc, *$05ae
+    {
+        a = 0x05ae;
+        r[6] -= 2;
+        WR16(r[6], 0x0832);
+    }
+    AOT_GOTO(0x05ae, L05ae);
+L0832:
+    AOT_BLOCK(0x0832, 8);
+    // 0832: mov 53f2, (sp)
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0836: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 0838: mov $d, -(sp)
+    {
+        src = uint16_t(0x000d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 083c: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 083e: mov $19, -(sp)
+    {
+        src = uint16_t(0x0019);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0842: mov $14, -(sp)
+    {
+        src = uint16_t(0x0014);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0846: mov $3, -(sp)
+    {
+        src = uint16_t(0x0003);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 084a: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x084e);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L084e:
+    AOT_BLOCK(0x084e, 3);
+    // 084e: add $c, sp
+    {
+        src = uint16_t(0x000c);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0852: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0856: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x085c, L085c);
+L085c:
+    AOT_BLOCK(0x085c, 2);
+    // 085c: cmp $4cce, 4c7c
+    {
+        src = uint16_t(0x4cce);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0862: bhi 0874
+    if (!(C | Z))
+        AOT_GOTO(0x0874, L0874);
+    AOT_GOTO(0x0864, L0864);
+L0864:
+    AOT_BLOCK(0x0864, 2);
+    // 0864: mov $37ad, (sp)
+    {
+        src = uint16_t(0x37ad);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0868: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x086c);
+    }
+    AOT_GOTO(0x1388, L1388);
+L086c:
+    AOT_BLOCK(0x086c, 2);
+    // 086c: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0870: jsr pc, *$3410
+    {
+        a = 0x3410;
+        r[6] -= 2;
+        WR16(r[6], 0x0874);
+    }
+    AOT_GOTO(0x3410, L3410);
+L0874:
+    AOT_BLOCK(0x0874, 2);
+    // 0874: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0876: beq 087c
+    if (Z)
+        AOT_GOTO(0x087c, L087c);
+    AOT_GOTO(0x0878, L0878);
+L0878:
+    AOT_BLOCK(0x0878, 1);
+    // 0878: jmp *$0ac4
+    {
+        a = 0x0ac4;
+    }
+    AOT_GOTO(0x0ac4, L0ac4);
+L087c:
+    AOT_BLOCK(0x087c, 2);
+    // 087c: mov $1, r4
+    {
+        src = uint16_t(0x0001);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0880: jmp *$076c
+    {
+        a = 0x076c;
+    }
+    AOT_GOTO(0x076c, L076c);
+L0884:
+    AOT_BLOCK(0x0884, 2);
+    // 0884: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0886: beq 088c
+    if (Z)
+        AOT_GOTO(0x088c, L088c);
+    AOT_GOTO(0x0888, L0888);
+L0888:
+    AOT_BLOCK(0x0888, 1);
+    // 0888: add $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x088c, L088c);
+L088c:
+    AOT_BLOCK(0x088c, 1);
+    // 088c: br 0954
+    AOT_GOTO(0x0954, L0954);
+L088e:
+    AOT_BLOCK(0x088e, 2);
+    // 088e: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0890: beq 0896
+    if (Z)
+        AOT_GOTO(0x0896, L0896);
+    AOT_GOTO(0x0892, L0892);
+L0892:
+    AOT_BLOCK(0x0892, 1);
+    // 0892: jmp *$0ac4
+    {
+        a = 0x0ac4;
+    }
+    AOT_GOTO(0x0ac4, L0ac4);
+L0896:
+    AOT_BLOCK(0x0896, 1);
+    // 0896: br 0954
+    AOT_GOTO(0x0954, L0954);
+L0898:
+    AOT_BLOCK(0x0898, 2);
+    // 0898: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 089a: bne 08de
+    if (!Z)
+        AOT_GOTO(0x08de, L08de);
+    AOT_GOTO(0x089c, L089c);
+L089c:
+    AOT_BLOCK(0x089c, 1);
+    // 089c: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x08a0);
+    }
+    AOT_GOTO(0x0246, L0246);
+L08a0:
+    AOT_BLOCK(0x08a0, 3);
+    // 08a0: mov r0, 3448
+    {
+        src = r[0];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 08a4: cmp $17, r0
+    {
+        src = uint16_t(0x0017);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08a8: bne 08b8
+    if (!Z)
+        AOT_GOTO(0x08b8, L08b8);
+    AOT_GOTO(0x08aa, L08aa);
+L08aa:
+    // 08aa: (undefined)
+    AOT_INTERP(0x08aa);
+L08ac:
+    AOT_BLOCK(0x08ac, 1);
+    // 08ac: bic *-(r5), sp
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        dst = r[6];
+        val = (~src) & dst;
+        r[6] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 08ae: (undefined)
+    AOT_INTERP(0x08ae);
+L08b0:
+    // 08b0: (undefined)
+    AOT_INTERP(0x08b0);
+L08b2:
+    AOT_BLOCK(0x08b2, 2);
+    // 08b2: bic *-(r5), r0
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 08b4: jmp *$076c
+    {
+        a = 0x076c;
+    }
+    AOT_GOTO(0x076c, L076c);
+L08b8:
+    AOT_BLOCK(0x08b8, 2);
+    // 08b8: cmp $18, 3448
+    {
+        src = uint16_t(0x0018);
+        b = 0x3448;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08be: bne 08da
+    if (!Z)
+        AOT_GOTO(0x08da, L08da);
+    AOT_GOTO(0x08c0, L08c0);
+L08c0:
+    // 08c0: (undefined)
+    AOT_INTERP(0x08c0);
+L08c2:
+    AOT_BLOCK(0x08c2, 1);
+    // 08c2: bic *-(r4), -e40(r0)
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+        src = RD16(a);
+        b = uint16_t(r[0] + -3648);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 08c6: (undefined)
+    AOT_INTERP(0x08c6);
+L08c8:
+    AOT_BLOCK(0x08c8, 5);
+    // 08c8: bic *-(r4), *-(r2)
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 08ca: mov $8000, r0
+    {
+        src = uint16_t(0x8000);
+        r[0] = src;
+    }
+    // 08ce: xor r0, 53f2
+    {
+        src = r[0];
+        b = 0x53f2;
+        val = src ^ RD16(b);
+        WR16(b, val);
+    }
+    // 08d2: mov 53f2, r0
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08d6: jmp *$076c
+    {
+        a = 0x076c;
+    }
+    AOT_GOTO(0x076c, L076c);
+L08da:
+    AOT_BLOCK(0x08da, 1);
+    // 08da: mov $25, r3
+    {
+        src = uint16_t(0x0025);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x08de, L08de);
+L08de:
+    AOT_BLOCK(0x08de, 2);
+    // 08de: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 08e0: br 0954
+    AOT_GOTO(0x0954, L0954);
+L08e2:
+    AOT_BLOCK(0x08e2, 2);
+    // 08e2: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08e4: beq 08ea
+    if (Z)
+        AOT_GOTO(0x08ea, L08ea);
+    AOT_GOTO(0x08e6, L08e6);
+L08e6:
+    AOT_BLOCK(0x08e6, 2);
+    // 08e6: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 08e8: br 08fa
+    AOT_GOTO(0x08fa, L08fa);
+L08ea:
+    AOT_BLOCK(0x08ea, 2);
+    // 08ea: cmp $2f, r3
+    {
+        src = uint16_t(0x002f);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08ee: bne 08f6
+    if (!Z)
+        AOT_GOTO(0x08f6, L08f6);
+    AOT_GOTO(0x08f0, L08f0);
+L08f0:
+    AOT_BLOCK(0x08f0, 2);
+    // 08f0: mov $23, r3
+    {
+        src = uint16_t(0x0023);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08f4: br 08fa
+    AOT_GOTO(0x08fa, L08fa);
+L08f6:
+    AOT_BLOCK(0x08f6, 1);
+    // 08f6: mov $24, r3
+    {
+        src = uint16_t(0x0024);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x08fa, L08fa);
+L08fa:
+    AOT_BLOCK(0x08fa, 1);
+    // 08fa: br 0954
+    AOT_GOTO(0x0954, L0954);
+L08fc:
+    AOT_BLOCK(0x08fc, 2);
+    // 08fc: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08fe: beq 091c
+    if (Z)
+        AOT_GOTO(0x091c, L091c);
+    AOT_GOTO(0x0900, L0900);
+L0900:
+    AOT_BLOCK(0x0900, 1);
+    // 0900: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x0904);
+    }
+    AOT_GOTO(0x0246, L0246);
+L0904:
+    AOT_BLOCK(0x0904, 3);
+    // 0904: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0906: cmp $7, r3
+    {
+        src = uint16_t(0x0007);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 090a: bne 0912
+    if (!Z)
+        AOT_GOTO(0x0912, L0912);
+    AOT_GOTO(0x090c, L090c);
+L090c:
+    AOT_BLOCK(0x090c, 2);
+    // 090c: mov $65, r3
+    {
+        src = uint16_t(0x0065);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0910: br 091c
+    AOT_GOTO(0x091c, L091c);
+L0912:
+    AOT_BLOCK(0x0912, 3);
+    // 0912: mov r3, 3448
+    {
+        src = r[3];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 0916: mov $64, r3
+    {
+        src = uint16_t(0x0064);
+        r[3] = src;
+    }
+    // 091a: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x091c, L091c);
+L091c:
+    AOT_BLOCK(0x091c, 1);
+    // 091c: br 0954
+    AOT_GOTO(0x0954, L0954);
+L091e:
+    AOT_BLOCK(0x091e, 2);
+    // 091e: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0920: bne 0926
+    if (!Z)
+        AOT_GOTO(0x0926, L0926);
+    AOT_GOTO(0x0922, L0922);
+L0922:
+    AOT_BLOCK(0x0922, 1);
+    // 0922: jmp *$0ac4
+    {
+        a = 0x0ac4;
+    }
+    AOT_GOTO(0x0ac4, L0ac4);
+L0926:
+    AOT_BLOCK(0x0926, 1);
+    // 0926: br 0954
+    AOT_GOTO(0x0954, L0954);
+L0928:
+    AOT_BLOCK(0x0928, 2);
+    // 0928: inc 5406
+    {
+        a = 0x5406;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 092c: br 094a
+    AOT_GOTO(0x094a, L094a);
+L0930:
+    AOT_BLOCK(0x0930, 7);
+    // 0930: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0932: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0934: div $6, r0
+    {
+        src = int16_t(uint16_t(0x0006));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0938: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 093a: add $357c, r1
+    {
+        src = uint16_t(0x357c);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 093e: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 0940: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0942, L0942);
+L0942:
+    AOT_BLOCK(0x0942, 2);
+    // 0942: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0944: bne 0942
+    if (!Z)
+        AOT_GOTO(0x0942, L0942);
+    AOT_GOTO(0x0946, L0946);
+L0946:
+    AOT_BLOCK(0x0946, 1);
+    // 0946: jmp *30(r1)
+    {
+        a = RD16(r[1] + 48);
+    }
+    AOT_JUMP(a);
+L094a:
+    AOT_BLOCK(0x094a, 2);
+    // 094a: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 094c: bne 0952
+    if (!Z)
+        AOT_GOTO(0x0952, L0952);
+    AOT_GOTO(0x094e, L094e);
+L094e:
+    AOT_BLOCK(0x094e, 1);
+    // 094e: jmp *$0ac4
+    {
+        a = 0x0ac4;
+    }
+    AOT_GOTO(0x0ac4, L0ac4);
+L0952:
+    AOT_BLOCK(0x0952, 1);
+    // 0952: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0954, L0954);
+L0954:
+    AOT_BLOCK(0x0954, 8);
+    // 0954: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 0956: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0958: mov 3d36(r0), r0
+    {
+        a = uint16_t(r[0] + 15670);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 095c: ash $fff7, r0
+    {
+        src = uint16_t(0xfff7) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0960: bic $ffc0, r0
+    {
+        src = uint16_t(0xffc0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0964: mov r0, -5c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -92);
+        WR16(b, src);
+    }
+    // 0968: cmp $9, r3
+    {
+        src = uint16_t(0x0009);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 096c: beq 0974
+    if (Z)
+        AOT_GOTO(0x0974, L0974);
+    AOT_GOTO(0x096e, L096e);
+L096e:
+    AOT_BLOCK(0x096e, 2);
+    // 096e: cmp $8, r3
+    {
+        src = uint16_t(0x0008);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0972: bne 0980
+    if (!Z)
+        AOT_GOTO(0x0980, L0980);
+    AOT_GOTO(0x0974, L0974);
+L0974:
+    AOT_BLOCK(0x0974, 2);
+    // 0974: tst 5408
+    {
+        a = 0x5408;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0978: beq 0980
+    if (Z)
+        AOT_GOTO(0x0980, L0980);
+    AOT_GOTO(0x097a, L097a);
+L097a:
+    AOT_BLOCK(0x097a, 1);
+    // 097a: mov $5, -5c(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -92);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0980, L0980);
+L0980:
+    AOT_BLOCK(0x0980, 3);
+    // 0980: mov *-32(r5), -5e(r5)
+    {
+        a = RD16(r[5] + -50);
+        src = RD16(a);
+        b = uint16_t(r[5] + -94);
+        WR16(b, src);
+    }
+    // 0986: cmp -5e(r5), -5c(r5)
+    {
+        a = uint16_t(r[5] + -94);
+        src = RD16(a);
+        b = uint16_t(r[5] + -92);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 098c: blt 09a2
+    if (N ^ V)
+        AOT_GOTO(0x09a2, L09a2);
+    AOT_GOTO(0x098e, L098e);
+L098e:
+    AOT_BLOCK(0x098e, 2);
+    // 098e: cmp -5e(r5), -5c(r5)
+    {
+        a = uint16_t(r[5] + -94);
+        src = RD16(a);
+        b = uint16_t(r[5] + -92);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0994: bne 09fc
+    if (!Z)
+        AOT_GOTO(0x09fc, L09fc);
+    AOT_GOTO(0x0996, L0996);
+L0996:
+    AOT_BLOCK(0x0996, 4);
+    // 0996: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 0998: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 099a: bit $80, 3d36(r0)
+    {
+        src = uint16_t(0x0080);
+        b = uint16_t(r[0] + 15670);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 09a0: beq 09fc
+    if (Z)
+        AOT_GOTO(0x09fc, L09fc);
+    AOT_GOTO(0x09a2, L09a2);
+L09a2:
+    AOT_BLOCK(0x09a2, 2);
+    // 09a2: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09a4: br 09b6
+    AOT_GOTO(0x09b6, L09b6);
+L09a6:
+    AOT_BLOCK(0x09a6, 2);
+    // 09a6: mov $25, -5c(r5)
+    {
+        src = uint16_t(0x0025);
+        b = uint16_t(r[5] + -92);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09ac: br 09c6
+    AOT_GOTO(0x09c6, L09c6);
+L09ae:
+    AOT_BLOCK(0x09ae, 2);
+    // 09ae: mov $4, -5c(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -92);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09b4: br 09c6
+    AOT_GOTO(0x09c6, L09c6);
+L09b6:
+    AOT_BLOCK(0x09b6, 2);
+    // 09b6: mov $35ea, r1
+    {
+        src = uint16_t(0x35ea);
+        r[1] = src;
+    }
+    // 09ba: mov r0, 35f4
+    {
+        src = r[0];
+        b = 0x35f4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x09be, L09be);
+L09be:
+    AOT_BLOCK(0x09be, 2);
+    // 09be: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09c0: bne 09be
+    if (!Z)
+        AOT_GOTO(0x09be, L09be);
+    AOT_GOTO(0x09c2, L09c2);
+L09c2:
+    AOT_BLOCK(0x09c2, 1);
+    // 09c2: jmp *a(r1)
+    {
+        a = RD16(r[1] + 10);
+    }
+    AOT_JUMP(a);
+L09c6:
+    AOT_BLOCK(0x09c6, 4);
+    // 09c6: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 09c8: add $fff6, r0
+    {
+        src = uint16_t(0xfff6);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 09cc: cmp -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09d0: bcs 09e2
+    if (C)
+        AOT_GOTO(0x09e2, L09e2);
+    AOT_GOTO(0x09d2, L09d2);
+L09d2:
+    AOT_BLOCK(0x09d2, 2);
+    // 09d2: mov $37c1, (sp)
+    {
+        src = uint16_t(0x37c1);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09d6: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x09da);
+    }
+    AOT_GOTO(0x1388, L1388);
+L09da:
+    AOT_BLOCK(0x09da, 2);
+    // 09da: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09de: jsr pc, *$3410
+    {
+        a = 0x3410;
+        r[6] -= 2;
+        WR16(r[6], 0x09e2);
+    }
+    AOT_GOTO(0x3410, L3410);
+L09e2:
+    AOT_BLOCK(0x09e2, 5);
+    // 09e2: add $2, -8(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 09e8: mov r3, *-8(r5)
+    {
+        src = r[3];
+        b = RD16(r[5] + -8);
+        WR16(b, src);
+    }
+    // 09ec: add $2, -32(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -50);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 09f2: mov -5c(r5), *-32(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        src = RD16(a);
+        b = RD16(r[5] + -50);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09f8: jmp *$076c
+    {
+        a = 0x076c;
+    }
+    AOT_GOTO(0x076c, L076c);
+L09fc:
+    AOT_BLOCK(0x09fc, 5);
+    // 09fc: sub $2, -32(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -50);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[5] + -50);
+        WR16(b, val16);
+    }
+    // 0a02: mov *-8(r5), r0
+    {
+        a = RD16(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0a06: mov r0, -60(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -96);
+        WR16(b, src);
+    }
+    // 0a0a: sub $2, -8(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[5] + -8);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 0a10: br 0a9e
+    AOT_GOTO(0x0a9e, L0a9e);
+L0a12:
+    AOT_BLOCK(0x0a12, 3);
+    // 0a12: mov r3, 3448
+    {
+        src = r[3];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 0a16: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0a18: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x0a1c);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L0a1c:
+    AOT_BLOCK(0x0a1c, 3);
+    // 0a1c: sub $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x4c7c;
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 0a22: mov *4c7c, r0
+    {
+        a = RD16(0x4c7c);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a26: br 0ad6
+    AOT_GOTO(0x0ad6, L0ad6);
+L0a28:
+    AOT_BLOCK(0x0a28, 2);
+    // 0a28: cmp $7, r3
+    {
+        src = uint16_t(0x0007);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a2c: bne 0ac4
+    if (!Z)
+        AOT_GOTO(0x0ac4, L0ac4);
+    AOT_GOTO(0x0a2e, L0a2e);
+L0a2e:
+    AOT_BLOCK(0x0a2e, 2);
+    // 0a2e: mov -60(r5), (sp)
+    {
+        a = uint16_t(r[5] + -96);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a32: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x0a36);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L0a36:
+    AOT_BLOCK(0x0a36, 1);
+    // 0a36: jmp *$076c
+    {
+        a = 0x076c;
+    }
+    AOT_GOTO(0x076c, L076c);
+L0a3a:
+    AOT_BLOCK(0x0a3a, 5);
+    // 0a3a: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 0a3c: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 0a3e: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 0a40: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0a42: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x0a46);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L0a46:
+    AOT_BLOCK(0x0a46, 5);
+    // 0a46: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0a4a: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0a4e: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0a54: mov $64, -60(r5)
+    {
+        src = uint16_t(0x0064);
+        b = uint16_t(r[5] + -96);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a5a: br 0ab8
+    AOT_GOTO(0x0ab8, L0ab8);
+L0a5c:
+    AOT_BLOCK(0x0a5c, 6);
+    // 0a5c: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a60: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 0a62: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0a64: mov $15, -(sp)
+    {
+        src = uint16_t(0x0015);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a68: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a6c: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x0a70);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L0a70:
+    AOT_BLOCK(0x0a70, 4);
+    // 0a70: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0a74: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0a78: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0a7e: br 0ab8
+    AOT_GOTO(0x0ab8, L0ab8);
+L0a80:
+    AOT_BLOCK(0x0a80, 2);
+    // 0a80: cmp $7, r3
+    {
+        src = uint16_t(0x0007);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a84: bne 0ac4
+    if (!Z)
+        AOT_GOTO(0x0ac4, L0ac4);
+    AOT_GOTO(0x0a86, L0a86);
+L0a86:
+    AOT_BLOCK(0x0a86, 1);
+    // 0a86: jmp *$076c
+    {
+        a = 0x076c;
+    }
+    AOT_GOTO(0x076c, L076c);
+L0a8a:
+    AOT_BLOCK(0x0a8a, 2);
+    // 0a8a: cmp $5, r3
+    {
+        src = uint16_t(0x0005);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a8e: bne 0ac4
+    if (!Z)
+        AOT_GOTO(0x0ac4, L0ac4);
+    AOT_GOTO(0x0a90, L0a90);
+L0a90:
+    AOT_BLOCK(0x0a90, 2);
+    // 0a90: mov $4, (sp)
+    {
+        src = uint16_t(0x0004);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a94: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x0a98);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L0a98:
+    AOT_BLOCK(0x0a98, 1);
+    // 0a98: jmp *$076c
+    {
+        a = 0x076c;
+    }
+    AOT_GOTO(0x076c, L076c);
+L0a9e:
+    AOT_BLOCK(0x0a9e, 7);
+    // 0a9e: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0aa0: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0aa2: div $3, r0
+    {
+        src = int16_t(uint16_t(0x0003));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0aa6: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0aa8: add $3602, r1
+    {
+        src = uint16_t(0x3602);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0aac: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 0aae: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ab0, L0ab0);
+L0ab0:
+    AOT_BLOCK(0x0ab0, 2);
+    // 0ab0: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ab2: bne 0ab0
+    if (!Z)
+        AOT_GOTO(0x0ab0, L0ab0);
+    AOT_GOTO(0x0ab4, L0ab4);
+L0ab4:
+    AOT_BLOCK(0x0ab4, 1);
+    // 0ab4: jmp *18(r1)
+    {
+        a = RD16(r[1] + 24);
+    }
+    AOT_JUMP(a);
+L0ab8:
+    AOT_BLOCK(0x0ab8, 2);
+    // 0ab8: mov -60(r5), (sp)
+    {
+        a = uint16_t(r[5] + -96);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0abc: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x0ac0);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L0ac0:
+    AOT_BLOCK(0x0ac0, 1);
+    // 0ac0: jmp *$0980
+    {
+        a = 0x0980;
+    }
+    AOT_GOTO(0x0980, L0980);
+L0ac4:
+    AOT_BLOCK(0x0ac4, 2);
+    // 0ac4: mov $37d5, (sp)
+    {
+        src = uint16_t(0x37d5);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ac8: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x0acc);
+    }
+    AOT_GOTO(0x1388, L1388);
+L0acc:
+    AOT_BLOCK(0x0acc, 2);
+    // 0acc: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ace: jsr pc, *$22be
+    {
+        a = 0x22be;
+        r[6] -= 2;
+        WR16(r[6], 0x0ad2);
+    }
+    AOT_GOTO(0x22be, L22be);
+L0ad2:
+    AOT_BLOCK(0x0ad2, 2);
+    // 0ad2: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0ad4: br 0ad6
+    AOT_GOTO(0x0ad6, L0ad6);
+L0ad6:
+    AOT_BLOCK(0x0ad6, 2);
+    // 0ad6: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ada:
+    AOT_BLOCK(0x0ada, 6);
+    // 0ada: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0ade;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0ade: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 0ae2: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0ae6: mov $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0aea: jsr pc, *$13fe
+    {
+        a = 0x13fe;
+        r[6] -= 2;
+        WR16(r[6], 0x0aee);
+    }
+    AOT_GOTO(0x13fe, L13fe);
+L0aee:
+    AOT_BLOCK(0x0aee, 7);
+    // 0aee: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0af0: mov $14, (r3)
+    {
+        src = uint16_t(0x0014);
+        b = r[3];
+        WR16(b, src);
+    }
+    // 0af4: mov 2(r4), 2(r3)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+    }
+    // 0afa: mov 4(r4), 4(r3)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[3] + 4);
+        WR16(b, src);
+    }
+    // 0b00: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0b02: mov r0, 6(r3)
+    {
+        src = r[0];
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b06: bne 0b0e
+    if (!Z)
+        AOT_GOTO(0x0b0e, L0b0e);
+    AOT_GOTO(0x0b08, L0b08);
+L0b08:
+    AOT_BLOCK(0x0b08, 1);
+    // 0b08: mov $d, 6(r3)
+    {
+        src = uint16_t(0x000d);
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b0e, L0b0e);
+L0b0e:
+    AOT_BLOCK(0x0b0e, 4);
+    // 0b0e: clr 8(r3)
+    {
+        a = uint16_t(r[3] + 8);
+        WR16(a, 0);
+    }
+    // 0b12: mov 6(r4), a(r3)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = uint16_t(r[3] + 10);
+        WR16(b, src);
+    }
+    // 0b18: cmpb $c, (r4)
+    {
+        src = uint8_t(0x0c);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b1c: bne 0b4a
+    if (!Z)
+        AOT_GOTO(0x0b4a, L0b4a);
+    AOT_GOTO(0x0b1e, L0b1e);
+L0b1e:
+    AOT_BLOCK(0x0b1e, 2);
+    // 0b1e: mov $3, (sp)
+    {
+        src = uint16_t(0x0003);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b22: jsr pc, *$13fe
+    {
+        a = 0x13fe;
+        r[6] -= 2;
+        WR16(r[6], 0x0b26);
+    }
+    AOT_GOTO(0x13fe, L13fe);
+L0b26:
+    AOT_BLOCK(0x0b26, 6);
+    // 0b26: mov r3, r2
+    {
+        src = r[3];
+        r[2] = src;
+    }
+    // 0b28: add $a, r2
+    {
+        src = uint16_t(0x000a);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 0b2c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0b2e: add $8, r0
+    {
+        src = uint16_t(0x0008);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0b32: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0b36: mov $8, -8(r5)
+    {
+        src = uint16_t(0x0008);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b3c, L0b3c);
+L0b3c:
+    AOT_BLOCK(0x0b3c, 4);
+    // 0b3c: movb *-a(r5), (r2)+
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+    }
+    // 0b40: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0b44: dec -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0b48: bne 0b3c
+    if (!Z)
+        AOT_GOTO(0x0b3c, L0b3c);
+    AOT_GOTO(0x0b4a, L0b4a);
+L0b4a:
+    AOT_BLOCK(0x0b4a, 2);
+    // 0b4a: bitb $10, 1(r4)
+    {
+        src = uint8_t(0x10);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0b50: beq 0b58
+    if (Z)
+        AOT_GOTO(0x0b58, L0b58);
+    AOT_GOTO(0x0b52, L0b52);
+L0b52:
+    AOT_BLOCK(0x0b52, 1);
+    // 0b52: mov $12, 6(r3)
+    {
+        src = uint16_t(0x0012);
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b58, L0b58);
+L0b58:
+    AOT_BLOCK(0x0b58, 2);
+    // 0b58: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b5a: br 0b5c
+    AOT_GOTO(0x0b5c, L0b5c);
+L0b5c:
+    AOT_BLOCK(0x0b5c, 2);
+    // 0b5c: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b60:
+    AOT_BLOCK(0x0b60, 5);
+    // 0b60: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b64;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0b64: sub $12, sp
+    {
+        src = uint16_t(0x0012);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0b68: cmp $4, 4(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b6e: bne 0b7e
+    if (!Z)
+        AOT_GOTO(0x0b7e, L0b7e);
+    AOT_GOTO(0x0b70, L0b70);
+L0b70:
+    AOT_BLOCK(0x0b70, 2);
+    // 0b70: mov $28, (sp)
+    {
+        src = uint16_t(0x0028);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b74: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x0b78);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L0b78:
+    AOT_BLOCK(0x0b78, 1);
+    // 0b78: mov $24, 4(r5)
+    {
+        src = uint16_t(0x0024);
+        b = uint16_t(r[5] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b7e, L0b7e);
+L0b7e:
+    AOT_BLOCK(0x0b7e, 5);
+    // 0b7e: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b82: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0b84: mov 3d36(r0), -12(r5)
+    {
+        a = uint16_t(r[0] + 15670);
+        src = RD16(a);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 0b8a: bit $1, -12(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -18);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b90: beq 0bae
+    if (Z)
+        AOT_GOTO(0x0bae, L0bae);
+    AOT_GOTO(0x0b92, L0b92);
+L0b92:
+    AOT_BLOCK(0x0b92, 3);
+    // 0b92: sub $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x4c7c;
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 0b98: mov *4c7c, (sp)
+    {
+        a = RD16(0x4c7c);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b9c: jsr pc, *$12c4
+    {
+        a = 0x12c4;
+        r[6] -= 2;
+        WR16(r[6], 0x0ba0);
+    }
+    AOT_GOTO(0x12c4, L12c4);
+L0ba0:
+    AOT_BLOCK(0x0ba0, 2);
+    // 0ba0: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ba2: jsr pc, *$1282
+    {
+        a = 0x1282;
+        r[6] -= 2;
+        WR16(r[6], 0x0ba6);
+    }
+    AOT_GOTO(0x1282, L1282);
+L0ba6:
+    AOT_BLOCK(0x0ba6, 2);
+    // 0ba6: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0ba8: mov 2(r2), -8(r5)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bae, L0bae);
+L0bae:
+    AOT_BLOCK(0x0bae, 4);
+    // 0bae: sub $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x4c7c;
+        WR16(b, val16);
+    }
+    // 0bb4: mov *4c7c, r3
+    {
+        a = RD16(0x4c7c);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0bb8: cmp $5b, 4(r5)
+    {
+        src = uint16_t(0x005b);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bbe: bne 0be6
+    if (!Z)
+        AOT_GOTO(0x0be6, L0be6);
+    AOT_GOTO(0x0bc0, L0bc0);
+L0bc0:
+    AOT_BLOCK(0x0bc0, 2);
+    // 0bc0: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bc2: jsr pc, *$2cdc
+    {
+        a = 0x2cdc;
+        r[6] -= 2;
+        WR16(r[6], 0x0bc6);
+    }
+    AOT_GOTO(0x2cdc, L2cdc);
+L0bc6:
+    AOT_BLOCK(0x0bc6, 3);
+    // 0bc6: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0bc8: mov $15, (r3)
+    {
+        src = uint16_t(0x0015);
+        b = r[3];
+        WR16(b, src);
+    }
+    // 0bcc: clr 2(r3)
+    {
+        a = uint16_t(r[3] + 2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0bd0, L0bd0);
+L0bd0:
+    AOT_BLOCK(0x0bd0, 5);
+    // 0bd0: clr 4(r3)
+    {
+        a = uint16_t(r[3] + 4);
+        WR16(a, 0);
+    }
+    // 0bd4: mov r4, 6(r3)
+    {
+        src = r[4];
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 0bd8: mov r3, *4c7c
+    {
+        src = r[3];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0bdc: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0be2: jmp *$1158
+    {
+        a = 0x1158;
+    }
+    AOT_GOTO(0x1158, L1158);
+L0be6:
+    AOT_BLOCK(0x0be6, 2);
+    // 0be6: cmp $23, 4(r5)
+    {
+        src = uint16_t(0x0023);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bec: beq 0c06
+    if (Z)
+        AOT_GOTO(0x0c06, L0c06);
+    AOT_GOTO(0x0bee, L0bee);
+L0bee:
+    AOT_BLOCK(0x0bee, 2);
+    // 0bee: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bf0: jsr pc, *$12c4
+    {
+        a = 0x12c4;
+        r[6] -= 2;
+        WR16(r[6], 0x0bf4);
+    }
+    AOT_GOTO(0x12c4, L12c4);
+L0bf4:
+    AOT_BLOCK(0x0bf4, 3);
+    // 0bf4: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0bf6: cmp $64, 4(r5)
+    {
+        src = uint16_t(0x0064);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bfc: beq 0c06
+    if (Z)
+        AOT_GOTO(0x0c06, L0c06);
+    AOT_GOTO(0x0bfe, L0bfe);
+L0bfe:
+    AOT_BLOCK(0x0bfe, 2);
+    // 0bfe: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c00: jsr pc, *$1282
+    {
+        a = 0x1282;
+        r[6] -= 2;
+        WR16(r[6], 0x0c04);
+    }
+    AOT_GOTO(0x1282, L1282);
+L0c04:
+    AOT_BLOCK(0x0c04, 1);
+    // 0c04: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c06, L0c06);
+L0c06:
+    AOT_BLOCK(0x0c06, 5);
+    // 0c06: mov 2(r3), r4
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0c0a: clr -18(r5)
+    {
+        a = uint16_t(r[5] + -24);
+        WR16(a, 0);
+    }
+    // 0c0e: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0c12: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c16: jmp *$0e7e
+    {
+        a = 0x0e7e;
+    }
+    AOT_GOTO(0x0e7e, L0e7e);
+L0c1a:
+    AOT_BLOCK(0x0c1a, 3);
+    // 0c1a: mov r3, *4c7c
+    {
+        src = r[3];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0c1e: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0c24: jmp *$1158
+    {
+        a = 0x1158;
+    }
+    AOT_GOTO(0x1158, L1158);
+L0c28:
+    AOT_BLOCK(0x0c28, 2);
+    // 0c28: cmp $8, (r2)
+    {
+        src = uint16_t(0x0008);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c2c: beq 0c36
+    if (Z)
+        AOT_GOTO(0x0c36, L0c36);
+    AOT_GOTO(0x0c2e, L0c2e);
+L0c2e:
+    AOT_BLOCK(0x0c2e, 2);
+    // 0c2e: mov $3864, (sp)
+    {
+        src = uint16_t(0x3864);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c32: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x0c36);
+    }
+    AOT_GOTO(0x1388, L1388);
+L0c36:
+    AOT_BLOCK(0x0c36, 1);
+    // 0c36: mov -8(r5), -c(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c3c, L0c3c);
+L0c3c:
+    AOT_BLOCK(0x0c3c, 7);
+    // 0c3c: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c3e: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c40: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0c42: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c46: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c4a: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c4e: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x0c52);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L0c52:
+    AOT_BLOCK(0x0c52, 4);
+    // 0c52: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0c56: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0c5a: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0c60: jmp *$1158
+    {
+        a = 0x1158;
+    }
+    AOT_GOTO(0x1158, L1158);
+L0c64:
+    AOT_BLOCK(0x0c64, 4);
+    // 0c64: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0c66: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0c6a: cmp $10, r0
+    {
+        src = uint16_t(0x0010);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c6e: beq 0c78
+    if (Z)
+        AOT_GOTO(0x0c78, L0c78);
+    AOT_GOTO(0x0c70, L0c70);
+L0c70:
+    AOT_BLOCK(0x0c70, 2);
+    // 0c70: mov $3878, (sp)
+    {
+        src = uint16_t(0x3878);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c74: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x0c78);
+    }
+    AOT_GOTO(0x1388, L1388);
+L0c78:
+    AOT_BLOCK(0x0c78, 5);
+    // 0c78: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c7a: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c7c: mov 4(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c80: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c82: jsr pc, 2aca
+    {
+        a = 0x2aca;
+        r[6] -= 2;
+        WR16(r[6], 0x0c86);
+    }
+    AOT_GOTO(0x2aca, L2aca);
+L0c86:
+    AOT_BLOCK(0x0c86, 5);
+    // 0c86: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0c88: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c8a: mov $64, -(sp)
+    {
+        src = uint16_t(0x0064);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c8e: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c92: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x0c96);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L0c96:
+    AOT_BLOCK(0x0c96, 4);
+    // 0c96: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0c9a: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0c9e: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0ca4: jmp *$1158
+    {
+        a = 0x1158;
+    }
+    AOT_GOTO(0x1158, L1158);
+L0ca8:
+    AOT_BLOCK(0x0ca8, 2);
+    // 0ca8: cmp $23, (r3)
+    {
+        src = uint16_t(0x0023);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cac: bne 0cbe
+    if (!Z)
+        AOT_GOTO(0x0cbe, L0cbe);
+    AOT_GOTO(0x0cae, L0cae);
+L0cae:
+    AOT_BLOCK(0x0cae, 3);
+    // 0cae: mov 6(r3), *4c7c
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0cb4: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0cba: jmp *$1158
+    {
+        a = 0x1158;
+    }
+    AOT_GOTO(0x1158, L1158);
+L0cbe:
+    AOT_BLOCK(0x0cbe, 4);
+    // 0cbe: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0cc0: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0cc4: cmp $10, r0
+    {
+        src = uint16_t(0x0010);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cc8: bne 0cd2
+    if (!Z)
+        AOT_GOTO(0x0cd2, L0cd2);
+    AOT_GOTO(0x0cca, L0cca);
+L0cca:
+    AOT_BLOCK(0x0cca, 2);
+    // 0cca: mov $388d, (sp)
+    {
+        src = uint16_t(0x388d);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cce: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x0cd2);
+    }
+    AOT_GOTO(0x1388, L1388);
+L0cd2:
+    AOT_BLOCK(0x0cd2, 4);
+    // 0cd2: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0cd4: mov 4(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0cd8: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cda: jsr pc, 2aca
+    {
+        a = 0x2aca;
+        r[6] -= 2;
+        WR16(r[6], 0x0cde);
+    }
+    AOT_GOTO(0x2aca, L2aca);
+L0cde:
+    AOT_BLOCK(0x0cde, 5);
+    // 0cde: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0ce0: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ce2: mov $24, -(sp)
+    {
+        src = uint16_t(0x0024);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ce6: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cea: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x0cee);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L0cee:
+    AOT_BLOCK(0x0cee, 4);
+    // 0cee: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0cf2: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0cf6: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0cfc: jmp *$1158
+    {
+        a = 0x1158;
+    }
+    AOT_GOTO(0x1158, L1158);
+L0d00:
+    AOT_BLOCK(0x0d00, 2);
+    // 0d00: cmp $24, (r3)
+    {
+        src = uint16_t(0x0024);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d04: bne 0d2e
+    if (!Z)
+        AOT_GOTO(0x0d2e, L0d2e);
+    AOT_GOTO(0x0d06, L0d06);
+L0d06:
+    AOT_BLOCK(0x0d06, 4);
+    // 0d06: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d0a: mov 4(r3), 4(r0)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0d10: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d12: jsr pc, *$2afc
+    {
+        a = 0x2afc;
+        r[6] -= 2;
+        WR16(r[6], 0x0d16);
+    }
+    AOT_GOTO(0x2afc, L2afc);
+L0d16:
+    AOT_BLOCK(0x0d16, 5);
+    // 0d16: mov 6(r3), r1
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0d1a: mov r0, 2(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 2);
+        WR16(b, src);
+    }
+    // 0d1e: mov 6(r3), *4c7c
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0d24: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0d2a: jmp *$1158
+    {
+        a = 0x1158;
+    }
+    AOT_GOTO(0x1158, L1158);
+L0d2e:
+    AOT_BLOCK(0x0d2e, 2);
+    // 0d2e: cmp $14, (r3)
+    {
+        src = uint16_t(0x0014);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d32: bne 0d62
+    if (!Z)
+        AOT_GOTO(0x0d62, L0d62);
+    AOT_GOTO(0x0d34, L0d34);
+L0d34:
+    AOT_BLOCK(0x0d34, 4);
+    // 0d34: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d36: mov 4(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d3a: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d3c: jsr pc, 2afc
+    {
+        a = 0x2afc;
+        r[6] -= 2;
+        WR16(r[6], 0x0d40);
+    }
+    AOT_GOTO(0x2afc, L2afc);
+L0d40:
+    AOT_BLOCK(0x0d40, 5);
+    // 0d40: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0d42: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d44: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d48: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d4c: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x0d50);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L0d50:
+    AOT_BLOCK(0x0d50, 4);
+    // 0d50: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0d54: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0d58: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0d5e: jmp *$1158
+    {
+        a = 0x1158;
+    }
+    AOT_GOTO(0x1158, L1158);
+L0d62:
+    AOT_BLOCK(0x0d62, 2);
+    // 0d62: mov $38a1, (sp)
+    {
+        src = uint16_t(0x38a1);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d66: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x0d6a);
+    }
+    AOT_GOTO(0x1388, L1388);
+L0d6a:
+    AOT_BLOCK(0x0d6a, 1);
+    // 0d6a: jmp *$0e98
+    {
+        a = 0x0e98;
+    }
+    AOT_GOTO(0x0e98, L0e98);
+L0d6e:
+    AOT_BLOCK(0x0d6e, 5);
+    // 0d6e: mov r3, *4c7c
+    {
+        src = r[3];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0d72: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0d78: mov $ffff, (sp)
+    {
+        src = uint16_t(0xffff);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d7c: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d7e: jsr pc, *$132a
+    {
+        a = 0x132a;
+        r[6] -= 2;
+        WR16(r[6], 0x0d82);
+    }
+    AOT_GOTO(0x132a, L132a);
+L0d82:
+    AOT_BLOCK(0x0d82, 4);
+    // 0d82: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0d84: mov $c, 2(r3)
+    {
+        src = uint16_t(0x000c);
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+    }
+    // 0d8a: mov $24, (sp)
+    {
+        src = uint16_t(0x0024);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d8e: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x0d92);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L0d92:
+    AOT_BLOCK(0x0d92, 2);
+    // 0d92: sub $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x4c7c;
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 0d98: mov *4c7c, r3
+    {
+        a = RD16(0x4c7c);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d9c, L0d9c);
+L0d9c:
+    AOT_BLOCK(0x0d9c, 2);
+    // 0d9c: cmp $14, (r2)
+    {
+        src = uint16_t(0x0014);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0da0: bne 0db2
+    if (!Z)
+        AOT_GOTO(0x0db2, L0db2);
+    AOT_GOTO(0x0da2, L0da2);
+L0da2:
+    AOT_BLOCK(0x0da2, 2);
+    // 0da2: cmp $a, 6(r2)
+    {
+        src = uint16_t(0x000a);
+        b = uint16_t(r[2] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0da8: beq 0dba
+    if (Z)
+        AOT_GOTO(0x0dba, L0dba);
+    AOT_GOTO(0x0daa, L0daa);
+L0daa:
+    AOT_BLOCK(0x0daa, 2);
+    // 0daa: cmp $12, 6(r2)
+    {
+        src = uint16_t(0x0012);
+        b = uint16_t(r[2] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0db0: beq 0dba
+    if (Z)
+        AOT_GOTO(0x0dba, L0dba);
+    AOT_GOTO(0x0db2, L0db2);
+L0db2:
+    AOT_BLOCK(0x0db2, 2);
+    // 0db2: mov $38b0, (sp)
+    {
+        src = uint16_t(0x38b0);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0db6: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x0dba);
+    }
+    AOT_GOTO(0x1388, L1388);
+L0dba:
+    AOT_BLOCK(0x0dba, 7);
+    // 0dba: mov r3, *4c7c
+    {
+        src = r[3];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0dbe: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0dc4: mov -8(r5), -c(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0dca: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0dce: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0dd2: cmp $18, r0
+    {
+        src = uint16_t(0x0018);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0dd6: bne 0de8
+    if (!Z)
+        AOT_GOTO(0x0de8, L0de8);
+    AOT_GOTO(0x0dd8, L0dd8);
+L0dd8:
+    AOT_BLOCK(0x0dd8, 2);
+    // 0dd8: mov -c(r5), (sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ddc: jsr pc, *$2aca
+    {
+        a = 0x2aca;
+        r[6] -= 2;
+        WR16(r[6], 0x0de0);
+    }
+    AOT_GOTO(0x2aca, L2aca);
+L0de0:
+    AOT_BLOCK(0x0de0, 2);
+    // 0de0: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0de4: incb 4(r2)
+    {
+        a = uint16_t(r[2] + 4);
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x80;
+    }
+    AOT_GOTO(0x0de8, L0de8);
+L0de8:
+    AOT_BLOCK(0x0de8, 4);
+    // 0de8: mov 4(r2), (sp)
+    {
+        a = uint16_t(r[2] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dec: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0df0: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0df2: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x0df6);
+    }
+    AOT_GOTO(0x120c, L120c);
+L0df6:
+    AOT_BLOCK(0x0df6, 3);
+    // 0df6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0df8: mov $23, (sp)
+    {
+        src = uint16_t(0x0023);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dfc: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x0e00);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L0e00:
+    AOT_BLOCK(0x0e00, 6);
+    // 0e00: mov a(r2), (sp)
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e04: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0e06: mov $7, -(sp)
+    {
+        src = uint16_t(0x0007);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e0a: mov $15, -(sp)
+    {
+        src = uint16_t(0x0015);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e0e: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e12: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x0e16);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L0e16:
+    AOT_BLOCK(0x0e16, 5);
+    // 0e16: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0e1a: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0e1e: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0e24: mov $28, (sp)
+    {
+        src = uint16_t(0x0028);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e28: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x0e2c);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L0e2c:
+    AOT_BLOCK(0x0e2c, 4);
+    // 0e2c: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0e30: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0e34: cmp $18, r0
+    {
+        src = uint16_t(0x0018);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e38: beq 0e42
+    if (Z)
+        AOT_GOTO(0x0e42, L0e42);
+    AOT_GOTO(0x0e3a, L0e3a);
+L0e3a:
+    AOT_BLOCK(0x0e3a, 2);
+    // 0e3a: mov $24, (sp)
+    {
+        src = uint16_t(0x0024);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e3e: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x0e42);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L0e42:
+    AOT_BLOCK(0x0e42, 2);
+    // 0e42: cmp $12, 6(r2)
+    {
+        src = uint16_t(0x0012);
+        b = uint16_t(r[2] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e48: bne 0e78
+    if (!Z)
+        AOT_GOTO(0x0e78, L0e78);
+    AOT_GOTO(0x0e4a, L0e4a);
+L0e4a:
+    AOT_BLOCK(0x0e4a, 8);
+    // 0e4a: mov 4(r2), (sp)
+    {
+        a = uint16_t(r[2] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e4e: sub $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x4c7c;
+        WR16(b, val16);
+    }
+    // 0e54: mov *4c7c, -(sp)
+    {
+        a = RD16(0x4c7c);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e58: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0e5a: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e5e: mov $a, -(sp)
+    {
+        src = uint16_t(0x000a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e62: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e66: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x0e6a);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L0e6a:
+    AOT_BLOCK(0x0e6a, 3);
+    // 0e6a: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0e6e: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0e72: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0e78, L0e78);
+L0e78:
+    AOT_BLOCK(0x0e78, 1);
+    // 0e78: jmp *$1158
+    {
+        a = 0x1158;
+    }
+    AOT_GOTO(0x1158, L1158);
+L0e7e:
+    AOT_BLOCK(0x0e7e, 7);
+    // 0e7e: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0e80: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0e82: div $2, r0
+    {
+        src = int16_t(uint16_t(0x0002));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0e86: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0e88: add $37e8, r1
+    {
+        src = uint16_t(0x37e8);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0e8c: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 0e8e: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e90, L0e90);
+L0e90:
+    AOT_BLOCK(0x0e90, 2);
+    // 0e90: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e92: bne 0e90
+    if (!Z)
+        AOT_GOTO(0x0e90, L0e90);
+    AOT_GOTO(0x0e94, L0e94);
+L0e94:
+    AOT_BLOCK(0x0e94, 1);
+    // 0e94: jmp *18(r1)
+    {
+        a = RD16(r[1] + 24);
+    }
+    AOT_JUMP(a);
+L0e98:
+    AOT_BLOCK(0x0e98, 2);
+    // 0e98: bit $2, -12(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -18);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0e9e: beq 0ea6
+    if (Z)
+        AOT_GOTO(0x0ea6, L0ea6);
+    AOT_GOTO(0x0ea0, L0ea0);
+L0ea0:
+    AOT_BLOCK(0x0ea0, 2);
+    // 0ea0: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ea2: jsr pc, *$1430
+    {
+        a = 0x1430;
+        r[6] -= 2;
+        WR16(r[6], 0x0ea6);
+    }
+    AOT_GOTO(0x1430, L1430);
+L0ea6:
+    AOT_BLOCK(0x0ea6, 2);
+    // 0ea6: bit $10, -12(r5)
+    {
+        src = uint16_t(0x0010);
+        b = uint16_t(r[5] + -18);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0eac: beq 0eba
+    if (Z)
+        AOT_GOTO(0x0eba, L0eba);
+    AOT_GOTO(0x0eae, L0eae);
+L0eae:
+    AOT_BLOCK(0x0eae, 3);
+    // 0eae: mov $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0eb2: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0eb4: jsr pc, *$132a
+    {
+        a = 0x132a;
+        r[6] -= 2;
+        WR16(r[6], 0x0eb8);
+    }
+    AOT_GOTO(0x132a, L132a);
+L0eb8:
+    AOT_BLOCK(0x0eb8, 1);
+    // 0eb8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0eba, L0eba);
+L0eba:
+    AOT_BLOCK(0x0eba, 2);
+    // 0eba: bit $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0ec0: beq 0ece
+    if (Z)
+        AOT_GOTO(0x0ece, L0ece);
+    AOT_GOTO(0x0ec2, L0ec2);
+L0ec2:
+    AOT_BLOCK(0x0ec2, 3);
+    // 0ec2: mov $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ec6: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ec8: jsr pc, *$132a
+    {
+        a = 0x132a;
+        r[6] -= 2;
+        WR16(r[6], 0x0ecc);
+    }
+    AOT_GOTO(0x132a, L132a);
+L0ecc:
+    AOT_BLOCK(0x0ecc, 1);
+    // 0ecc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0ece, L0ece);
+L0ece:
+    AOT_BLOCK(0x0ece, 2);
+    // 0ece: bit $1, -12(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -18);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0ed4: bne 0f26
+    if (!Z)
+        AOT_GOTO(0x0f26, L0f26);
+    AOT_GOTO(0x0ed6, L0ed6);
+L0ed6:
+    AOT_BLOCK(0x0ed6, 2);
+    // 0ed6: cmp $33, 4(r5)
+    {
+        src = uint16_t(0x0033);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0edc: bne 0ee4
+    if (!Z)
+        AOT_GOTO(0x0ee4, L0ee4);
+    AOT_GOTO(0x0ede, L0ede);
+L0ede:
+    AOT_BLOCK(0x0ede, 2);
+    // 0ede: mov $3, r4
+    {
+        src = uint16_t(0x0003);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ee2: br 0eee
+    AOT_GOTO(0x0eee, L0eee);
+L0ee4:
+    AOT_BLOCK(0x0ee4, 2);
+    // 0ee4: cmp $34, 4(r5)
+    {
+        src = uint16_t(0x0034);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0eea: bne 0eee
+    if (!Z)
+        AOT_GOTO(0x0eee, L0eee);
+    AOT_GOTO(0x0eec, L0eec);
+L0eec:
+    AOT_BLOCK(0x0eec, 1);
+    // 0eec: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0eee, L0eee);
+L0eee:
+    AOT_BLOCK(0x0eee, 4);
+    // 0eee: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0ef0: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ef2: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ef6: jsr pc, *$1450
+    {
+        a = 0x1450;
+        r[6] -= 2;
+        WR16(r[6], 0x0efa);
+    }
+    AOT_GOTO(0x1450, L1450);
+L0efa:
+    AOT_BLOCK(0x0efa, 3);
+    // 0efa: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0efc: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0efe: bne 0f22
+    if (!Z)
+        AOT_GOTO(0x0f22, L0f22);
+    AOT_GOTO(0x0f00, L0f00);
+L0f00:
+    AOT_BLOCK(0x0f00, 6);
+    // 0f00: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f02: mov 4(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f06: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f08: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f0c: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f10: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x0f14);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L0f14:
+    AOT_BLOCK(0x0f14, 3);
+    // 0f14: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0f18: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 0f1c: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0f22, L0f22);
+L0f22:
+    AOT_BLOCK(0x0f22, 1);
+    // 0f22: jmp *$1158
+    {
+        a = 0x1158;
+    }
+    AOT_GOTO(0x1158, L1158);
+L0f26:
+    AOT_BLOCK(0x0f26, 3);
+    // 0f26: clr -16(r5)
+    {
+        a = uint16_t(r[5] + -22);
+        WR16(a, 0);
+    }
+    // 0f2a: cmp $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f2e: beq 0f38
+    if (Z)
+        AOT_GOTO(0x0f38, L0f38);
+    AOT_GOTO(0x0f30, L0f30);
+L0f30:
+    AOT_BLOCK(0x0f30, 2);
+    // 0f30: cmp $4, -8(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f36: bne 0f48
+    if (!Z)
+        AOT_GOTO(0x0f48, L0f48);
+    AOT_GOTO(0x0f38, L0f38);
+L0f38:
+    AOT_BLOCK(0x0f38, 2);
+    // 0f38: mov $38c6, (sp)
+    {
+        src = uint16_t(0x38c6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f3c: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x0f40);
+    }
+    AOT_GOTO(0x1388, L1388);
+L0f40:
+    AOT_BLOCK(0x0f40, 3);
+    // 0f40: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 0f42: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0f46: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f48, L0f48);
+L0f48:
+    AOT_BLOCK(0x0f48, 2);
+    // 0f48: cmp $7, -8(r5)
+    {
+        src = uint16_t(0x0007);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f4e: bne 0f5e
+    if (!Z)
+        AOT_GOTO(0x0f5e, L0f5e);
+    AOT_GOTO(0x0f50, L0f50);
+L0f50:
+    AOT_BLOCK(0x0f50, 4);
+    // 0f50: mov r4, -c(r5)
+    {
+        src = r[4];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0f54: clr 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        WR16(a, 0);
+    }
+    // 0f58: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0f5c: br 0f7e
+    AOT_GOTO(0x0f7e, L0f7e);
+L0f5e:
+    AOT_BLOCK(0x0f5e, 2);
+    // 0f5e: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f62: jsr pc, *$1356
+    {
+        a = 0x1356;
+        r[6] -= 2;
+        WR16(r[6], 0x0f66);
+    }
+    AOT_GOTO(0x1356, L1356);
+L0f66:
+    AOT_BLOCK(0x0f66, 3);
+    // 0f66: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f68: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f6a: jsr pc, 1356
+    {
+        a = 0x1356;
+        r[6] -= 2;
+        WR16(r[6], 0x0f6e);
+    }
+    AOT_GOTO(0x1356, L1356);
+L0f6e:
+    AOT_BLOCK(0x0f6e, 5);
+    // 0f6e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0f70: ash $2, r0
+    {
+        src = uint16_t(0x0002) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0f74: add (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0f76: movb 3e14(r0), r0
+    {
+        a = uint16_t(r[0] + 15892);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0f7a: mov r0, -16(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -22);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f7e, L0f7e);
+L0f7e:
+    AOT_BLOCK(0x0f7e, 7);
+    // 0f7e: mov -16(r5), r0
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f82: ash $fffc, r0
+    {
+        src = uint16_t(0xfffc) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0f86: bic $fff0, r0
+    {
+        src = uint16_t(0xfff0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0f8a: mov r0, -14(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+    }
+    // 0f8e: bic $fff0, -16(r5)
+    {
+        src = uint16_t(0xfff0);
+        b = uint16_t(r[5] + -22);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0f94: tst -14(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f98: beq 0fa0
+    if (Z)
+        AOT_GOTO(0x0fa0, L0fa0);
+    AOT_GOTO(0x0f9a, L0f9a);
+L0f9a:
+    AOT_BLOCK(0x0f9a, 2);
+    // 0f9a: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f9e: br 0fa2
+    AOT_GOTO(0x0fa2, L0fa2);
+L0fa0:
+    AOT_BLOCK(0x0fa0, 1);
+    // 0fa0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fa2, L0fa2);
+L0fa2:
+    AOT_BLOCK(0x0fa2, 3);
+    // 0fa2: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0fa6: bit $8, -12(r5)
+    {
+        src = uint16_t(0x0008);
+        b = uint16_t(r[5] + -18);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0fac: beq 0fe6
+    if (Z)
+        AOT_GOTO(0x0fe6, L0fe6);
+    AOT_GOTO(0x0fae, L0fae);
+L0fae:
+    AOT_BLOCK(0x0fae, 3);
+    // 0fae: mov r4, -c(r5)
+    {
+        src = r[4];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0fb2: cmp $50, 4(r5)
+    {
+        src = uint16_t(0x0050);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0fb8: bne 0fd4
+    if (!Z)
+        AOT_GOTO(0x0fd4, L0fd4);
+    AOT_GOTO(0x0fba, L0fba);
+L0fba:
+    AOT_BLOCK(0x0fba, 2);
+    // 0fba: cmp $4, -16(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -22);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0fc0: beq 0fca
+    if (Z)
+        AOT_GOTO(0x0fca, L0fca);
+    AOT_GOTO(0x0fc2, L0fc2);
+L0fc2:
+    AOT_BLOCK(0x0fc2, 2);
+    // 0fc2: cmp $5, -16(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -22);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0fc8: bne 0fd4
+    if (!Z)
+        AOT_GOTO(0x0fd4, L0fd4);
+    AOT_GOTO(0x0fca, L0fca);
+L0fca:
+    AOT_BLOCK(0x0fca, 3);
+    // 0fca: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 0fcc: mov r0, -14(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+    }
+    // 0fd0: mov r0, -16(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -22);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fd4, L0fd4);
+L0fd4:
+    AOT_BLOCK(0x0fd4, 2);
+    // 0fd4: tst -14(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0fd8: beq 0fe0
+    if (Z)
+        AOT_GOTO(0x0fe0, L0fe0);
+    AOT_GOTO(0x0fda, L0fda);
+L0fda:
+    AOT_BLOCK(0x0fda, 1);
+    // 0fda: mov -14(r5), -16(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        b = uint16_t(r[5] + -22);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fe0, L0fe0);
+L0fe0:
+    AOT_BLOCK(0x0fe0, 2);
+    // 0fe0: clr -14(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0fe4: br 1030
+    AOT_GOTO(0x1030, L1030);
+L0fe6:
+    AOT_BLOCK(0x0fe6, 2);
+    // 0fe6: cmp $8, 4(r5)
+    {
+        src = uint16_t(0x0008);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0fec: bne 1000
+    if (!Z)
+        AOT_GOTO(0x1000, L1000);
+    AOT_GOTO(0x0fee, L0fee);
+L0fee:
+    AOT_BLOCK(0x0fee, 2);
+    // 0fee: cmp $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ff2: bgt 1000
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1000, L1000);
+    AOT_GOTO(0x0ff4, L0ff4);
+L0ff4:
+    AOT_BLOCK(0x0ff4, 2);
+    // 0ff4: cmp -8(r5), r4
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ff8: bne 1000
+    if (!Z)
+        AOT_GOTO(0x1000, L1000);
+    AOT_GOTO(0x0ffa, L0ffa);
+L0ffa:
+    AOT_BLOCK(0x0ffa, 2);
+    // 0ffa: clr -16(r5)
+    {
+        a = uint16_t(r[5] + -22);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0ffe: br 1030
+    AOT_GOTO(0x1030, L1030);
+L1000:
+    AOT_BLOCK(0x1000, 2);
+    // 1000: bit $4, -12(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -18);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1006: beq 1030
+    if (Z)
+        AOT_GOTO(0x1030, L1030);
+    AOT_GOTO(0x1008, L1008);
+L1008:
+    AOT_BLOCK(0x1008, 1);
+    // 1008: cmp $3e, 4(r5)
+    {
+        src = uint16_t(0x003e);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x100e, L100e);
+L100e:
+    AOT_BLOCK(0x100e, 1);
+    // 100e: bgt 1024
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1024, L1024);
+    AOT_GOTO(0x1010, L1010);
+L1010:
+    AOT_BLOCK(0x1010, 2);
+    // 1010: cmp $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1014: ble 101e
+    if (Z || (N ^ V))
+        AOT_GOTO(0x101e, L101e);
+    AOT_GOTO(0x1016, L1016);
+L1016:
+    AOT_BLOCK(0x1016, 2);
+    // 1016: cmp $8, -8(r5)
+    {
+        src = uint16_t(0x0008);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 101c: bgt 1024
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1024, L1024);
+    AOT_GOTO(0x101e, L101e);
+L101e:
+    AOT_BLOCK(0x101e, 1);
+    // 101e: add $4, 4(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1024, L1024);
+L1024:
+    AOT_BLOCK(0x1024, 2);
+    // 1024: cmp $5, -16(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -22);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 102a: bne 1030
+    if (!Z)
+        AOT_GOTO(0x1030, L1030);
+    AOT_GOTO(0x102c, L102c);
+L102c:
+    AOT_BLOCK(0x102c, 1);
+    // 102c: clr -16(r5)
+    {
+        a = uint16_t(r[5] + -22);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1030, L1030);
+L1030:
+    AOT_BLOCK(0x1030, 1);
+    // 1030: cmp $5, -16(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -22);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1036, L1036);
+L1036:
+    AOT_BLOCK(0x1036, 1);
+    // 1036: bne 1060
+    if (!Z)
+        AOT_GOTO(0x1060, L1060);
+    AOT_GOTO(0x1038, L1038);
+L1038:
+    AOT_BLOCK(0x1038, 3);
+    // 1038: clr -16(r5)
+    {
+        a = uint16_t(r[5] + -22);
+        WR16(a, 0);
+    }
+    // 103c: cmp $29, 4(r5)
+    {
+        src = uint16_t(0x0029);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1042: bne 104e
+    if (!Z)
+        AOT_GOTO(0x104e, L104e);
+    AOT_GOTO(0x1044, L1044);
+L1044:
+    AOT_BLOCK(0x1044, 3);
+    // 1044: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+        C = false;
+    }
+    // 1048: inc -18(r5)
+    {
+        a = uint16_t(r[5] + -24);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 104c: br 1060
+    AOT_GOTO(0x1060, L1060);
+L104e:
+    AOT_BLOCK(0x104e, 2);
+    // 104e: cmp -8(r5), r4
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1052: bne 105a
+    if (!Z)
+        AOT_GOTO(0x105a, L105a);
+    AOT_GOTO(0x1054, L1054);
+L1054:
+    AOT_BLOCK(0x1054, 2);
+    // 1054: cmp $9, r4
+    {
+        src = uint16_t(0x0009);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1058: beq 1060
+    if (Z)
+        AOT_GOTO(0x1060, L1060);
+    AOT_GOTO(0x105a, L105a);
+L105a:
+    AOT_BLOCK(0x105a, 1);
+    // 105a: mov $f, -16(r5)
+    {
+        src = uint16_t(0x000f);
+        b = uint16_t(r[5] + -22);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1060, L1060);
+L1060:
+    AOT_BLOCK(0x1060, 2);
+    // 1060: tst -16(r5)
+    {
+        a = uint16_t(r[5] + -22);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1064: beq 10ce
+    if (Z)
+        AOT_GOTO(0x10ce, L10ce);
+    AOT_GOTO(0x1066, L1066);
+L1066:
+    AOT_BLOCK(0x1066, 2);
+    // 1066: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1068: jsr pc, *$2ca2
+    {
+        a = 0x2ca2;
+        r[6] -= 2;
+        WR16(r[6], 0x106c);
+    }
+    AOT_GOTO(0x2ca2, L2ca2);
+L106c:
+    AOT_BLOCK(0x106c, 3);
+    // 106c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 106e: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1070: jsr pc, *$2ca2
+    {
+        a = 0x2ca2;
+        r[6] -= 2;
+        WR16(r[6], 0x1074);
+    }
+    AOT_GOTO(0x2ca2, L2ca2);
+L1074:
+    AOT_BLOCK(0x1074, 3);
+    // 1074: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1078: cmp $f, -16(r5)
+    {
+        src = uint16_t(0x000f);
+        b = uint16_t(r[5] + -22);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 107e: beq 108e
+    if (Z)
+        AOT_GOTO(0x108e, L108e);
+    AOT_GOTO(0x1080, L1080);
+L1080:
+    AOT_BLOCK(0x1080, 2);
+    // 1080: cmp $5, -16(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -22);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1086: bne 1098
+    if (!Z)
+        AOT_GOTO(0x1098, L1098);
+    AOT_GOTO(0x1088, L1088);
+L1088:
+    AOT_BLOCK(0x1088, 2);
+    // 1088: cmp -8(r5), r4
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 108c: beq 1098
+    if (Z)
+        AOT_GOTO(0x1098, L1098);
+    AOT_GOTO(0x108e, L108e);
+L108e:
+    AOT_BLOCK(0x108e, 2);
+    // 108e: mov $38e8, (sp)
+    {
+        src = uint16_t(0x38e8);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1092: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1096);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1096:
+    AOT_BLOCK(0x1096, 1);
+    // 1096: br 10ce
+    AOT_GOTO(0x10ce, L10ce);
+L1098:
+    AOT_BLOCK(0x1098, 2);
+    // 1098: tst -14(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 109c: beq 10b8
+    if (Z)
+        AOT_GOTO(0x10b8, L10b8);
+    AOT_GOTO(0x109e, L109e);
+L109e:
+    AOT_BLOCK(0x109e, 5);
+    // 109e: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10a2: mov -16(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10a6: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10aa: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10ac: jsr pc, *$115c
+    {
+        a = 0x115c;
+        r[6] -= 2;
+        WR16(r[6], 0x10b0);
+    }
+    AOT_GOTO(0x115c, L115c);
+L10b0:
+    AOT_BLOCK(0x10b0, 3);
+    // 10b0: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 10b4: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10b6: br 10ce
+    AOT_GOTO(0x10ce, L10ce);
+L10b8:
+    AOT_BLOCK(0x10b8, 5);
+    // 10b8: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10ba: mov -16(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10be: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10c2: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10c4: jsr pc, *$115c
+    {
+        a = 0x115c;
+        r[6] -= 2;
+        WR16(r[6], 0x10c8);
+    }
+    AOT_GOTO(0x115c, L115c);
+L10c8:
+    AOT_BLOCK(0x10c8, 2);
+    // 10c8: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 10cc: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x10ce, L10ce);
+L10ce:
+    AOT_BLOCK(0x10ce, 2);
+    // 10ce: bit $4, -12(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -18);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 10d4: beq 10da
+    if (Z)
+        AOT_GOTO(0x10da, L10da);
+    AOT_GOTO(0x10d6, L10d6);
+L10d6:
+    AOT_BLOCK(0x10d6, 1);
+    // 10d6: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x10da, L10da);
+L10da:
+    AOT_BLOCK(0x10da, 4);
+    // 10da: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10dc: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10de: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10e2: jsr pc, *$1450
+    {
+        a = 0x1450;
+        r[6] -= 2;
+        WR16(r[6], 0x10e6);
+    }
+    AOT_GOTO(0x1450, L1450);
+L10e6:
+    AOT_BLOCK(0x10e6, 3);
+    // 10e6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 10e8: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10ea: bne 111e
+    if (!Z)
+        AOT_GOTO(0x111e, L111e);
+    AOT_GOTO(0x10ec, L10ec);
+L10ec:
+    AOT_BLOCK(0x10ec, 4);
+    // 10ec: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10ee: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10f0: tst 4(r3)
+    {
+        a = uint16_t(r[3] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10f4: bne 10fa
+    if (!Z)
+        AOT_GOTO(0x10fa, L10fa);
+    AOT_GOTO(0x10f6, L10f6);
+L10f6:
+    AOT_BLOCK(0x10f6, 2);
+    // 10f6: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10f8: br 10fc
+    AOT_GOTO(0x10fc, L10fc);
+L10fa:
+    AOT_BLOCK(0x10fa, 1);
+    // 10fa: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x10fc, L10fc);
+L10fc:
+    AOT_BLOCK(0x10fc, 5);
+    // 10fc: mov 4(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1100: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1104: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1108: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 110c: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x1110);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L1110:
+    AOT_BLOCK(0x1110, 3);
+    // 1110: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 1114: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 1118: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x111e, L111e);
+L111e:
+    AOT_BLOCK(0x111e, 2);
+    // 111e: tst -18(r5)
+    {
+        a = uint16_t(r[5] + -24);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1122: beq 1158
+    if (Z)
+        AOT_GOTO(0x1158, L1158);
+    AOT_GOTO(0x1124, L1124);
+L1124:
+    AOT_BLOCK(0x1124, 2);
+    // 1124: cmp $9, r4
+    {
+        src = uint16_t(0x0009);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1128: beq 1158
+    if (Z)
+        AOT_GOTO(0x1158, L1158);
+    AOT_GOTO(0x112a, L112a);
+L112a:
+    AOT_BLOCK(0x112a, 4);
+    // 112a: sub $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x4c7c;
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 1130: mov *4c7c, r3
+    {
+        a = RD16(0x4c7c);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1134: mov 6(r3), (sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1138: jsr pc, *$2ca2
+    {
+        a = 0x2ca2;
+        r[6] -= 2;
+        WR16(r[6], 0x113c);
+    }
+    AOT_GOTO(0x2ca2, L2ca2);
+L113c:
+    AOT_BLOCK(0x113c, 5);
+    // 113c: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 113e: mov $5, -(sp)
+    {
+        src = uint16_t(0x0005);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1142: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1144: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1146: jsr pc, *$115c
+    {
+        a = 0x115c;
+        r[6] -= 2;
+        WR16(r[6], 0x114a);
+    }
+    AOT_GOTO(0x115c, L115c);
+L114a:
+    AOT_BLOCK(0x114a, 3);
+    // 114a: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 114e: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 1152: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1158, L1158);
+L1158:
+    AOT_BLOCK(0x1158, 2);
+    // 1158: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L115c:
+    AOT_BLOCK(0x115c, 4);
+    // 115c: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1160;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1160: mov 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1164: br 11de
+    AOT_GOTO(0x11de, L11de);
+L1166:
+    AOT_BLOCK(0x1166, 2);
+    // 1166: cmp $1, a(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 116c: bne 1174
+    if (!Z)
+        AOT_GOTO(0x1174, L1174);
+    AOT_GOTO(0x116e, L116e);
+L116e:
+    AOT_BLOCK(0x116e, 2);
+    // 116e: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1172: br 1208
+    AOT_GOTO(0x1208, L1208);
+L1174:
+    AOT_BLOCK(0x1174, 6);
+    // 1174: mov a(r5), (sp)
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1178: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 117a: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 117c: mov $15, -(sp)
+    {
+        src = uint16_t(0x0015);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1180: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1184: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x1188);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L1188:
+    AOT_BLOCK(0x1188, 7);
+    // 1188: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 118c: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 118e: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1192: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 1194: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1198: cmp $5, 8(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 119e: bne 11a6
+    if (!Z)
+        AOT_GOTO(0x11a6, L11a6);
+    AOT_GOTO(0x11a0, L11a0);
+L11a0:
+    AOT_BLOCK(0x11a0, 2);
+    // 11a0: mov $2b, -(sp)
+    {
+        src = uint16_t(0x002b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11a4: br 11aa
+    AOT_GOTO(0x11aa, L11aa);
+L11a6:
+    AOT_BLOCK(0x11a6, 1);
+    // 11a6: mov $2a, -(sp)
+    {
+        src = uint16_t(0x002a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x11aa, L11aa);
+L11aa:
+    AOT_BLOCK(0x11aa, 2);
+    // 11aa: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11ae: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x11b2);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L11b2:
+    AOT_BLOCK(0x11b2, 2);
+    // 11b2: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 11b6: br 1208
+    AOT_GOTO(0x1208, L1208);
+L11b8:
+    AOT_BLOCK(0x11b8, 2);
+    // 11b8: mov $33, r4
+    {
+        src = uint16_t(0x0033);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11bc: br 11ee
+    AOT_GOTO(0x11ee, L11ee);
+L11be:
+    AOT_BLOCK(0x11be, 2);
+    // 11be: mov $34, r4
+    {
+        src = uint16_t(0x0034);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11c2: br 11ee
+    AOT_GOTO(0x11ee, L11ee);
+L11c4:
+    AOT_BLOCK(0x11c4, 2);
+    // 11c4: mov $3a, r4
+    {
+        src = uint16_t(0x003a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11c8: br 11ee
+    AOT_GOTO(0x11ee, L11ee);
+L11ca:
+    AOT_BLOCK(0x11ca, 2);
+    // 11ca: mov $3b, r4
+    {
+        src = uint16_t(0x003b);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11ce: br 11ee
+    AOT_GOTO(0x11ee, L11ee);
+L11d0:
+    AOT_BLOCK(0x11d0, 2);
+    // 11d0: mov $38, r4
+    {
+        src = uint16_t(0x0038);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11d4: br 11ee
+    AOT_GOTO(0x11ee, L11ee);
+L11d6:
+    AOT_BLOCK(0x11d6, 2);
+    // 11d6: mov $39, r4
+    {
+        src = uint16_t(0x0039);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11da: br 11ee
+    AOT_GOTO(0x11ee, L11ee);
+L11de:
+    AOT_BLOCK(0x11de, 3);
+    // 11de: sub $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 11e2: cmp r0, $7
+    {
+        src = r[0];
+        dst = uint16_t(0x0007);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11e6: bhi 11ee
+    if (!(C | Z))
+        AOT_GOTO(0x11ee, L11ee);
+    AOT_GOTO(0x11e8, L11e8);
+L11e8:
+    AOT_BLOCK(0x11e8, 2);
+    // 11e8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 11ea: jmp *381e(r0)
+    {
+        a = RD16(r[0] + 14366);
+    }
+    AOT_JUMP(a);
+L11ee:
+    AOT_BLOCK(0x11ee, 6);
+    // 11ee: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 11f2: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 11f4: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 11f8: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 11fa: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11fe: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x1202);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L1202:
+    AOT_BLOCK(0x1202, 2);
+    // 1202: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1206: br 1208
+    AOT_GOTO(0x1208, L1208);
+L1208:
+    AOT_BLOCK(0x1208, 2);
+    // 1208: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L120c:
+    AOT_BLOCK(0x120c, 8);
+    // 120c: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1210;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1210: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1214: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1218: mov 8(r5), r2
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 121c: mov r3, 2(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 1220: cmp $ffff, r2
+    {
+        src = uint16_t(0xffff);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1224: beq 122a
+    if (Z)
+        AOT_GOTO(0x122a, L122a);
+    AOT_GOTO(0x1226, L1226);
+L1226:
+    AOT_BLOCK(0x1226, 1);
+    // 1226: mov r2, 4(r4)
+    {
+        src = r[2];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x122a, L122a);
+L122a:
+    AOT_BLOCK(0x122a, 2);
+    // 122a: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 122c: br 126e
+    AOT_GOTO(0x126e, L126e);
+L122e:
+    AOT_BLOCK(0x122e, 3);
+    // 122e: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1230: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1232: jsr pc, 2aca
+    {
+        a = 0x2aca;
+        r[6] -= 2;
+        WR16(r[6], 0x1236);
+    }
+    AOT_GOTO(0x2aca, L2aca);
+L1236:
+    AOT_BLOCK(0x1236, 4);
+    // 1236: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1238: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 123a: mov 6(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 123e: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x1242);
+    }
+    AOT_GOTO(0x120c, L120c);
+L1242:
+    AOT_BLOCK(0x1242, 2);
+    // 1242: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1244: br 127e
+    AOT_GOTO(0x127e, L127e);
+L1246:
+    AOT_BLOCK(0x1246, 3);
+    // 1246: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1248: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 124a: jsr pc, 2afc
+    {
+        a = 0x2afc;
+        r[6] -= 2;
+        WR16(r[6], 0x124e);
+    }
+    AOT_GOTO(0x2afc, L2afc);
+L124e:
+    AOT_BLOCK(0x124e, 4);
+    // 124e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1250: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1252: mov 6(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1256: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x125a);
+    }
+    AOT_GOTO(0x120c, L120c);
+L125a:
+    AOT_BLOCK(0x125a, 2);
+    // 125a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 125c: br 127e
+    AOT_GOTO(0x127e, L127e);
+L125e:
+    AOT_BLOCK(0x125e, 4);
+    // 125e: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1260: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1262: mov 6(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1266: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x126a);
+    }
+    AOT_GOTO(0x120c, L120c);
+L126a:
+    AOT_BLOCK(0x126a, 2);
+    // 126a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 126c: br 127e
+    AOT_GOTO(0x127e, L127e);
+L126e:
+    AOT_BLOCK(0x126e, 3);
+    // 126e: sub $23, r0
+    {
+        src = uint16_t(0x0023);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1272: cmp r0, $6
+    {
+        src = r[0];
+        dst = uint16_t(0x0006);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1276: bhi 127e
+    if (!(C | Z))
+        AOT_GOTO(0x127e, L127e);
+    AOT_GOTO(0x1278, L1278);
+L1278:
+    AOT_BLOCK(0x1278, 2);
+    // 1278: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 127a: jmp *382e(r0)
+    {
+        a = RD16(r[0] + 14382);
+    }
+    AOT_JUMP(a);
+L127e:
+    AOT_BLOCK(0x127e, 2);
+    // 127e: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1282:
+    AOT_BLOCK(0x1282, 8);
+    // 1282: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1286;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1286: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 128a: mov 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 128e: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 1290: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1294: cmp $10, r0
+    {
+        src = uint16_t(0x0010);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1298: bne 12bc
+    if (!Z)
+        AOT_GOTO(0x12bc, L12bc);
+    AOT_GOTO(0x129a, L129a);
+L129a:
+    AOT_BLOCK(0x129a, 4);
+    // 129a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 129c: mov 4(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 12a0: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12a2: jsr pc, 2afc
+    {
+        a = 0x2afc;
+        r[6] -= 2;
+        WR16(r[6], 0x12a6);
+    }
+    AOT_GOTO(0x2afc, L2afc);
+L12a6:
+    AOT_BLOCK(0x12a6, 5);
+    // 12a6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 12a8: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 12aa: mov $23, -(sp)
+    {
+        src = uint16_t(0x0023);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 12ae: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12b2: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x12b6);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L12b6:
+    AOT_BLOCK(0x12b6, 2);
+    // 12b6: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 12ba: br 12c0
+    AOT_GOTO(0x12c0, L12c0);
+L12bc:
+    AOT_BLOCK(0x12bc, 2);
+    // 12bc: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12be: br 12c0
+    AOT_GOTO(0x12c0, L12c0);
+L12c0:
+    AOT_BLOCK(0x12c0, 2);
+    // 12c0: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12c4:
+    AOT_BLOCK(0x12c4, 8);
+    // 12c4: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x12c8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 12c8: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 12cc: mov 2(r3), r4
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 12d0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 12d2: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 12d6: cmp $18, r0
+    {
+        src = uint16_t(0x0018);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12da: bne 12ea
+    if (!Z)
+        AOT_GOTO(0x12ea, L12ea);
+    AOT_GOTO(0x12dc, L12dc);
+L12dc:
+    AOT_BLOCK(0x12dc, 2);
+    // 12dc: cmp $14, (r3)
+    {
+        src = uint16_t(0x0014);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12e0: bne 12ee
+    if (!Z)
+        AOT_GOTO(0x12ee, L12ee);
+    AOT_GOTO(0x12e2, L12e2);
+L12e2:
+    AOT_BLOCK(0x12e2, 2);
+    // 12e2: cmp $a, 6(r3)
+    {
+        src = uint16_t(0x000a);
+        b = uint16_t(r[3] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12e8: bne 12ee
+    if (!Z)
+        AOT_GOTO(0x12ee, L12ee);
+    AOT_GOTO(0x12ea, L12ea);
+L12ea:
+    AOT_BLOCK(0x12ea, 2);
+    // 12ea: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12ec: br 1326
+    AOT_GOTO(0x1326, L1326);
+L12ee:
+    AOT_BLOCK(0x12ee, 6);
+    // 12ee: incb 4(r3)
+    {
+        a = uint16_t(r[3] + 4);
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+    }
+    // 12f2: mov r3, *4c7c
+    {
+        src = r[3];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 12f6: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 12fc: mov $ffff, (sp)
+    {
+        src = uint16_t(0xffff);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1300: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1302: jsr pc, 2aca
+    {
+        a = 0x2aca;
+        r[6] -= 2;
+        WR16(r[6], 0x1306);
+    }
+    AOT_GOTO(0x2aca, L2aca);
+L1306:
+    AOT_BLOCK(0x1306, 4);
+    // 1306: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1308: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 130a: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 130c: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x1310);
+    }
+    AOT_GOTO(0x120c, L120c);
+L1310:
+    AOT_BLOCK(0x1310, 3);
+    // 1310: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1312: mov $23, (sp)
+    {
+        src = uint16_t(0x0023);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1316: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x131a);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L131a:
+    AOT_BLOCK(0x131a, 3);
+    // 131a: sub $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x4c7c;
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 1320: mov *4c7c, r0
+    {
+        a = RD16(0x4c7c);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1324: br 1326
+    AOT_GOTO(0x1326, L1326);
+L1326:
+    AOT_BLOCK(0x1326, 2);
+    // 1326: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L132a:
+    AOT_BLOCK(0x132a, 6);
+    // 132a: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x132e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 132e: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1332: mov 2(r0), r4
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1336: cmp $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 133a: bge 1350
+    if (!(N ^ V))
+        AOT_GOTO(0x1350, L1350);
+    AOT_GOTO(0x133c, L133c);
+L133c:
+    AOT_BLOCK(0x133c, 2);
+    // 133c: cmp $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1340: ble 1350
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1350, L1350);
+    AOT_GOTO(0x1342, L1342);
+L1342:
+    AOT_BLOCK(0x1342, 2);
+    // 1342: cmp 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1346: beq 1350
+    if (Z)
+        AOT_GOTO(0x1350, L1350);
+    AOT_GOTO(0x1348, L1348);
+L1348:
+    AOT_BLOCK(0x1348, 2);
+    // 1348: mov $38fb, (sp)
+    {
+        src = uint16_t(0x38fb);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 134c: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1350);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1350:
+    AOT_BLOCK(0x1350, 1);
+    // 1350: br 1352
+    AOT_GOTO(0x1352, L1352);
+L1352:
+    AOT_BLOCK(0x1352, 2);
+    // 1352: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1356:
+    AOT_BLOCK(0x1356, 4);
+    // 1356: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x135a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 135a: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 135e: br 1378
+    AOT_GOTO(0x1378, L1378);
+L1360:
+    AOT_BLOCK(0x1360, 2);
+    // 1360: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1362: br 1384
+    AOT_GOTO(0x1384, L1384);
+L1364:
+    AOT_BLOCK(0x1364, 2);
+    // 1364: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1368: br 1384
+    AOT_GOTO(0x1384, L1384);
+L136a:
+    AOT_BLOCK(0x136a, 2);
+    // 136a: mov $2, r0
+    {
+        src = uint16_t(0x0002);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 136e: br 1384
+    AOT_GOTO(0x1384, L1384);
+L1370:
+    AOT_BLOCK(0x1370, 2);
+    // 1370: mov $3, r0
+    {
+        src = uint16_t(0x0003);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1374: br 1384
+    AOT_GOTO(0x1384, L1384);
+L1378:
+    AOT_BLOCK(0x1378, 2);
+    // 1378: cmp r0, $6
+    {
+        src = r[0];
+        dst = uint16_t(0x0006);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 137c: bhi 1370
+    if (!(C | Z))
+        AOT_GOTO(0x1370, L1370);
+    AOT_GOTO(0x137e, L137e);
+L137e:
+    AOT_BLOCK(0x137e, 2);
+    // 137e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 1380: jmp *383c(r0)
+    {
+        a = RD16(r[0] + 14396);
+    }
+    AOT_JUMP(a);
+L1384:
+    AOT_BLOCK(0x1384, 2);
+    // 1384: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1388:
+    AOT_BLOCK(0x1388, 6);
+    // 1388: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x138c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 138c: inc 53fe
+    {
+        a = 0x53fe;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1390: mov 344a, (sp)
+    {
+        a = 0x344a;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1394: mov $3914, -(sp)
+    {
+        src = uint16_t(0x3914);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1398: jsr pc, *$3118
+    {
+        a = 0x3118;
+        r[6] -= 2;
+        WR16(r[6], 0x139c);
+    }
+    AOT_GOTO(0x3118, L3118);
+L139c:
+    AOT_BLOCK(0x139c, 9);
+    // 139c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 139e: mov 10(r5), (sp)
+    {
+        a = uint16_t(r[5] + 16);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13a2: mov e(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 14);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13a6: mov c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13aa: mov a(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13ae: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13b2: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13b6: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13ba: jsr pc, *$3118
+    {
+        a = 0x3118;
+        r[6] -= 2;
+        WR16(r[6], 0x13be);
+    }
+    AOT_GOTO(0x3118, L3118);
+L13be:
+    AOT_BLOCK(0x13be, 3);
+    // 13be: add $c, sp
+    {
+        src = uint16_t(0x000c);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 13c2: mov $3919, (sp)
+    {
+        src = uint16_t(0x3919);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13c6: jsr pc, *$3118
+    {
+        a = 0x3118;
+        r[6] -= 2;
+        WR16(r[6], 0x13ca);
+    }
+    AOT_GOTO(0x3118, L3118);
+L13ca:
+    AOT_BLOCK(0x13ca, 2);
+    // 13ca: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13ce:
+    AOT_BLOCK(0x13ce, 7);
+    // 13ce: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x13d2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 13d2: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 13d4: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 13d8: add $3, r2
+    {
+        src = uint16_t(0x0003);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 13dc: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13de: jsr pc, *$13fe
+    {
+        a = 0x13fe;
+        r[6] -= 2;
+        WR16(r[6], 0x13e2);
+    }
+    AOT_GOTO(0x13fe, L13fe);
+L13e2:
+    AOT_BLOCK(0x13e2, 4);
+    // 13e2: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 13e4: mov r3, -8(r5)
+    {
+        src = r[3];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 13e8: mov r5, r4
+    {
+        src = r[5];
+        r[4] = src;
+    }
+    // 13ea: add $6, r4
+    {
+        src = uint16_t(0x0006);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x13ee, L13ee);
+L13ee:
+    AOT_BLOCK(0x13ee, 3);
+    // 13ee: mov (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = r[3];
+        r[3] += 2;
+        WR16(b, src);
+    }
+    // 13f0: dec r2
+    {
+        val = int(int16_t(r[2])) - 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 13f2: bne 13ee
+    if (!Z)
+        AOT_GOTO(0x13ee, L13ee);
+    AOT_GOTO(0x13f4, L13f4);
+L13f4:
+    AOT_BLOCK(0x13f4, 2);
+    // 13f4: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13f8: br 13fa
+    AOT_GOTO(0x13fa, L13fa);
+L13fa:
+    AOT_BLOCK(0x13fa, 2);
+    // 13fa: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13fe:
+    AOT_BLOCK(0x13fe, 8);
+    // 13fe: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1402;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1402: mov 4c7a, r4
+    {
+        a = 0x4c7a;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1406: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 140a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 140c: add r0, 4c7a
+    {
+        src = r[0];
+        b = 0x4c7a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 1410: cmp $53e8, 4c7a
+    {
+        src = uint16_t(0x53e8);
+        b = 0x4c7a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1416: bhi 1428
+    if (!(C | Z))
+        AOT_GOTO(0x1428, L1428);
+    AOT_GOTO(0x1418, L1418);
+L1418:
+    AOT_BLOCK(0x1418, 2);
+    // 1418: mov $391b, (sp)
+    {
+        src = uint16_t(0x391b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 141c: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1420);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1420:
+    AOT_BLOCK(0x1420, 2);
+    // 1420: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1424: jsr pc, *$3410
+    {
+        a = 0x3410;
+        r[6] -= 2;
+        WR16(r[6], 0x1428);
+    }
+    AOT_GOTO(0x3410, L3410);
+L1428:
+    AOT_BLOCK(0x1428, 2);
+    // 1428: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 142a: br 142c
+    AOT_GOTO(0x142c, L142c);
+L142c:
+    AOT_BLOCK(0x142c, 2);
+    // 142c: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1430:
+    AOT_BLOCK(0x1430, 5);
+    // 1430: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1434;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1434: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1438: cmp $14, (r4)
+    {
+        src = uint16_t(0x0014);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 143c: beq 144c
+    if (Z)
+        AOT_GOTO(0x144c, L144c);
+    AOT_GOTO(0x143e, L143e);
+L143e:
+    AOT_BLOCK(0x143e, 2);
+    // 143e: cmp $24, (r4)
+    {
+        src = uint16_t(0x0024);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1442: beq 144c
+    if (Z)
+        AOT_GOTO(0x144c, L144c);
+    AOT_GOTO(0x1444, L1444);
+L1444:
+    AOT_BLOCK(0x1444, 2);
+    // 1444: mov $392f, (sp)
+    {
+        src = uint16_t(0x392f);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1448: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x144c);
+    }
+    AOT_GOTO(0x1388, L1388);
+L144c:
+    AOT_BLOCK(0x144c, 2);
+    // 144c: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1450:
+    AOT_BLOCK(0x1450, 5);
+    // 1450: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1454;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1454: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1458: cmp $15, (r4)
+    {
+        src = uint16_t(0x0015);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 145c: bne 146c
+    if (!Z)
+        AOT_GOTO(0x146c, L146c);
+    AOT_GOTO(0x145e, L145e);
+L145e:
+    AOT_BLOCK(0x145e, 2);
+    // 145e: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1462: beq 1470
+    if (Z)
+        AOT_GOTO(0x1470, L1470);
+    AOT_GOTO(0x1464, L1464);
+L1464:
+    AOT_BLOCK(0x1464, 2);
+    // 1464: cmp $15, *8(r5)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 146a: beq 1470
+    if (Z)
+        AOT_GOTO(0x1470, L1470);
+    AOT_GOTO(0x146c, L146c);
+L146c:
+    AOT_BLOCK(0x146c, 2);
+    // 146c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 146e: br 1500
+    AOT_GOTO(0x1500, L1500);
+L1470:
+    AOT_BLOCK(0x1470, 5);
+    // 1470: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1474: mov 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1478: mov 6(r0), r2
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 147c: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1480: br 14dc
+    AOT_GOTO(0x14dc, L14dc);
+L1482:
+    AOT_BLOCK(0x1482, 2);
+    // 1482: add r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1484: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L1486:
+    AOT_BLOCK(0x1486, 2);
+    // 1486: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 1488: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L148a:
+    AOT_BLOCK(0x148a, 4);
+    // 148a: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 148c: mul r2, r1
+    {
+        src = int16_t(r[2]);
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 148e: mov r1, r3
+    {
+        src = r[1];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1490: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L1492:
+    AOT_BLOCK(0x1492, 5);
+    // 1492: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 1494: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 1496: div r2, r0
+    {
+        src = int16_t(r[2]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1498: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 149a: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L149c:
+    AOT_BLOCK(0x149c, 5);
+    // 149c: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 149e: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 14a0: div r2, r0
+    {
+        src = int16_t(r[2]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 14a2: mov r1, r3
+    {
+        src = r[1];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14a4: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L14a6:
+    AOT_BLOCK(0x14a6, 4);
+    // 14a6: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 14a8: com r0
+    {
+        val = ~int(r[0]);
+        r[0] = val;
+        C = true;
+    }
+    // 14aa: bic r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 14ac: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L14ae:
+    AOT_BLOCK(0x14ae, 2);
+    // 14ae: bis r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 14b0: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L14b2:
+    AOT_BLOCK(0x14b2, 4);
+    // 14b2: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 14b4: xor r0, r3
+    {
+        src = r[0];
+        val = src ^ r[3];
+        r[3] = val;
+    }
+    // 14b6: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14b8: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L14ba:
+    AOT_BLOCK(0x14ba, 4);
+    // 14ba: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 14bc: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        C = val != 0;
+    }
+    // 14be: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14c0: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L14c2:
+    AOT_BLOCK(0x14c2, 4);
+    // 14c2: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 14c4: com r0
+    {
+        val = ~int(r[0]);
+        r[0] = val;
+        C = true;
+    }
+    // 14c6: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14c8: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L14ca:
+    AOT_BLOCK(0x14ca, 2);
+    // 14ca: ash r2, r3
+    {
+        src = r[2] & 077;
+        val16 = r[3];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 14cc: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L14ce:
+    AOT_BLOCK(0x14ce, 4);
+    // 14ce: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 14d0: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        C = val != 0;
+    }
+    // 14d2: ash r0, r3
+    {
+        src = r[0] & 077;
+        val16 = r[3];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 14d4: br 14ec
+    AOT_GOTO(0x14ec, L14ec);
+L14d6:
+    AOT_BLOCK(0x14d6, 2);
+    // 14d6: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 14d8: br 1500
+    AOT_GOTO(0x1500, L1500);
+L14dc:
+    AOT_BLOCK(0x14dc, 3);
+    // 14dc: sub $25, r0
+    {
+        src = uint16_t(0x0025);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 14e0: cmp r0, $c
+    {
+        src = r[0];
+        dst = uint16_t(0x000c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14e4: bhi 14d6
+    if (!(C | Z))
+        AOT_GOTO(0x14d6, L14d6);
+    AOT_GOTO(0x14e6, L14e6);
+L14e6:
+    AOT_BLOCK(0x14e6, 2);
+    // 14e6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 14e8: jmp *384a(r0)
+    {
+        a = RD16(r[0] + 14410);
+    }
+    AOT_JUMP(a);
+L14ec:
+    AOT_BLOCK(0x14ec, 5);
+    // 14ec: mov r3, 6(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 14f0: mov r4, *4c7c
+    {
+        src = r[4];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 14f4: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 14fa: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14fe: br 1500
+    AOT_GOTO(0x1500, L1500);
+L1500:
+    AOT_BLOCK(0x1500, 2);
+    // 1500: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1504:
+    AOT_BLOCK(0x1504, 4);
+    // 1504: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1508;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1508: inc 5408
+    {
+        a = 0x5408;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 150c: jsr pc, 0736
+    {
+        a = 0x0736;
+        r[6] -= 2;
+        WR16(r[6], 0x1510);
+    }
+    AOT_GOTO(0x0736, L0736);
+L1510:
+    AOT_BLOCK(0x1510, 2);
+    // 1510: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1512: beq 1522
+    if (Z)
+        AOT_GOTO(0x1522, L1522);
+    AOT_GOTO(0x1514, L1514);
+L1514:
+    AOT_BLOCK(0x1514, 2);
+    // 1514: cmp $15, (r4)
+    {
+        src = uint16_t(0x0015);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1518: beq 1522
+    if (Z)
+        AOT_GOTO(0x1522, L1522);
+    AOT_GOTO(0x151a, L151a);
+L151a:
+    AOT_BLOCK(0x151a, 2);
+    // 151a: mov $393f, (sp)
+    {
+        src = uint16_t(0x393f);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 151e: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1522);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1522:
+    AOT_BLOCK(0x1522, 3);
+    // 1522: dec 5408
+    {
+        a = 0x5408;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 1526: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 152a: br 152c
+    AOT_GOTO(0x152c, L152c);
+L152c:
+    AOT_BLOCK(0x152c, 2);
+    // 152c: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1530:
+    AOT_BLOCK(0x1530, 4);
+    // 1530: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1534;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1534: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 1538: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x153c);
+    }
+    AOT_GOTO(0x0246, L0246);
+L153c:
+    AOT_BLOCK(0x153c, 3);
+    // 153c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 153e: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1540: bne 1546
+    if (!Z)
+        AOT_GOTO(0x1546, L1546);
+    AOT_GOTO(0x1542, L1542);
+L1542:
+    AOT_BLOCK(0x1542, 1);
+    // 1542: jmp *$1652
+    {
+        a = 0x1652;
+    }
+    AOT_GOTO(0x1652, L1652);
+L1546:
+    AOT_BLOCK(0x1546, 2);
+    // 1546: cmp $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 154a: bne 1550
+    if (!Z)
+        AOT_GOTO(0x1550, L1550);
+    AOT_GOTO(0x154c, L154c);
+L154c:
+    AOT_BLOCK(0x154c, 1);
+    // 154c: jmp *$1652
+    {
+        a = 0x1652;
+    }
+    AOT_GOTO(0x1652, L1652);
+L1550:
+    AOT_BLOCK(0x1550, 9);
+    // 1550: mov r4, 3448
+    {
+        src = r[4];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 1554: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+    }
+    // 1558: mov $c, -a(r5)
+    {
+        src = uint16_t(0x000c);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 155e: mov $1, 53ec
+    {
+        src = uint16_t(0x0001);
+        b = 0x53ec;
+        WR16(b, src);
+    }
+    // 1564: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1566: add $fff8, (sp)
+    {
+        src = uint16_t(0xfff8);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 156a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 156c: add $fff6, (sp)
+    {
+        src = uint16_t(0xfff6);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1570: jsr pc, *$2332
+    {
+        a = 0x2332;
+        r[6] -= 2;
+        WR16(r[6], 0x1574);
+    }
+    AOT_GOTO(0x2332, L2332);
+L1574:
+    AOT_BLOCK(0x1574, 4);
+    // 1574: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1576: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1578: cmp $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 157c: bne 1586
+    if (!Z)
+        AOT_GOTO(0x1586, L1586);
+    AOT_GOTO(0x157e, L157e);
+L157e:
+    AOT_BLOCK(0x157e, 2);
+    // 157e: cmp $14, 3448
+    {
+        src = uint16_t(0x0014);
+        b = 0x3448;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1584: bne 162a
+    if (!Z)
+        AOT_GOTO(0x162a, L162a);
+    AOT_GOTO(0x1586, L1586);
+L1586:
+    AOT_BLOCK(0x1586, 2);
+    // 1586: cmp $4, -8(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 158c: bne 1592
+    if (!Z)
+        AOT_GOTO(0x1592, L1592);
+    AOT_GOTO(0x158e, L158e);
+L158e:
+    AOT_BLOCK(0x158e, 1);
+    // 158e: jsr pc, 20fa
+    {
+        a = 0x20fa;
+        r[6] -= 2;
+        WR16(r[6], 0x1592);
+    }
+    AOT_GOTO(0x20fa, L20fa);
+L1592:
+    AOT_BLOCK(0x1592, 6);
+    // 1592: clr 53e8
+    {
+        a = 0x53e8;
+        WR16(a, 0);
+    }
+    // 1596: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1598: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 159a: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 159e: mov $c, -(sp)
+    {
+        src = uint16_t(0x000c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15a2: jsr pc, *$25b0
+    {
+        a = 0x25b0;
+        r[6] -= 2;
+        WR16(r[6], 0x15a6);
+    }
+    AOT_GOTO(0x25b0, L25b0);
+L15a6:
+    AOT_BLOCK(0x15a6, 4);
+    // 15a6: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 15aa: mov 53e8, r2
+    {
+        a = 0x53e8;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 15ae: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 15b0: beq 1652
+    if (Z)
+        AOT_GOTO(0x1652, L1652);
+    AOT_GOTO(0x15b2, L15b2);
+L15b2:
+    AOT_BLOCK(0x15b2, 7);
+    // 15b2: mov r2, 53ea
+    {
+        src = r[2];
+        b = 0x53ea;
+        WR16(b, src);
+    }
+    // 15b6: bisb $1, 1(r2)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[2] + 1);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 15bc: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15be: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 15c2: mov $cf, -(sp)
+    {
+        src = uint16_t(0x00cf);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15c6: mov $39ac, -(sp)
+    {
+        src = uint16_t(0x39ac);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15ca: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x15ce);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L15ce:
+    AOT_BLOCK(0x15ce, 6);
+    // 15ce: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 15d0: clr 53ec
+    {
+        a = 0x53ec;
+        WR16(a, 0);
+    }
+    // 15d4: mov 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 15d8: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 15dc: cmp $10, r0
+    {
+        src = uint16_t(0x0010);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 15e0: bne 1612
+    if (!Z)
+        AOT_GOTO(0x1612, L1612);
+    AOT_GOTO(0x15e2, L15e2);
+L15e2:
+    AOT_BLOCK(0x15e2, 1);
+    // 15e2: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x15e6);
+    }
+    AOT_GOTO(0x0246, L0246);
+L15e6:
+    AOT_BLOCK(0x15e6, 3);
+    // 15e6: mov r0, 3448
+    {
+        src = r[0];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 15ea: cmp $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 15ee: beq 15f8
+    if (Z)
+        AOT_GOTO(0x15f8, L15f8);
+    AOT_GOTO(0x15f0, L15f0);
+L15f0:
+    AOT_BLOCK(0x15f0, 2);
+    // 15f0: cmp $13, 3448
+    {
+        src = uint16_t(0x0013);
+        b = 0x3448;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 15f6: bne 1610
+    if (!Z)
+        AOT_GOTO(0x1610, L1610);
+    AOT_GOTO(0x15f8, L15f8);
+L15f8:
+    AOT_BLOCK(0x15f8, 2);
+    // 15f8: mov 2(r2), (sp)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15fc: jsr pc, *$2aca
+    {
+        a = 0x2aca;
+        r[6] -= 2;
+        WR16(r[6], 0x1600);
+    }
+    AOT_GOTO(0x2aca, L2aca);
+L1600:
+    AOT_BLOCK(0x1600, 4);
+    // 1600: mov r0, 3452
+    {
+        src = r[0];
+        b = 0x3452;
+        WR16(b, src);
+    }
+    // 1604: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1606: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 160a: jsr pc, *$1656
+    {
+        a = 0x1656;
+        r[6] -= 2;
+        WR16(r[6], 0x160e);
+    }
+    AOT_GOTO(0x1656, L1656);
+L160e:
+    AOT_BLOCK(0x160e, 1);
+    // 160e: br 1652
+    AOT_GOTO(0x1652, L1652);
+L1610:
+    AOT_BLOCK(0x1610, 1);
+    // 1610: br 1618
+    AOT_GOTO(0x1618, L1618);
+L1612:
+    AOT_BLOCK(0x1612, 2);
+    // 1612: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1614: jsr pc, *$16cc
+    {
+        a = 0x16cc;
+        r[6] -= 2;
+        WR16(r[6], 0x1618);
+    }
+    AOT_GOTO(0x16cc, L16cc);
+L1618:
+    AOT_BLOCK(0x1618, 1);
+    // 1618: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x161c);
+    }
+    AOT_GOTO(0x0246, L0246);
+L161c:
+    AOT_BLOCK(0x161c, 3);
+    // 161c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 161e: cmp $9, r4
+    {
+        src = uint16_t(0x0009);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1622: beq 1592
+    if (Z)
+        AOT_GOTO(0x1592, L1592);
+    AOT_GOTO(0x1624, L1624);
+L1624:
+    AOT_BLOCK(0x1624, 2);
+    // 1624: cmp $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1628: beq 1652
+    if (Z)
+        AOT_GOTO(0x1652, L1652);
+    AOT_GOTO(0x162a, L162a);
+L162a:
+    AOT_BLOCK(0x162a, 2);
+    // 162a: cmp $3, r4
+    {
+        src = uint16_t(0x0003);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 162e: bne 163e
+    if (!Z)
+        AOT_GOTO(0x163e, L163e);
+    AOT_GOTO(0x1630, L1630);
+L1630:
+    AOT_BLOCK(0x1630, 2);
+    // 1630: mov $39af, (sp)
+    {
+        src = uint16_t(0x39af);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1634: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1638);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1638:
+    AOT_BLOCK(0x1638, 2);
+    // 1638: clr 3448
+    {
+        a = 0x3448;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 163c: br 1652
+    AOT_GOTO(0x1652, L1652);
+L163e:
+    AOT_BLOCK(0x163e, 2);
+    // 163e: mov $39bc, (sp)
+    {
+        src = uint16_t(0x39bc);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1642: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1646);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1646:
+    AOT_BLOCK(0x1646, 2);
+    // 1646: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1648: jsr pc, *$22be
+    {
+        a = 0x22be;
+        r[6] -= 2;
+        WR16(r[6], 0x164c);
+    }
+    AOT_GOTO(0x22be, L22be);
+L164c:
+    AOT_BLOCK(0x164c, 2);
+    // 164c: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 164e: jsr pc, *$1a4a
+    {
+        a = 0x1a4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1652);
+    }
+    AOT_GOTO(0x1a4a, L1a4a);
+L1652:
+    AOT_BLOCK(0x1652, 2);
+    // 1652: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1656:
+    AOT_BLOCK(0x1656, 8);
+    // 1656: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x165a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 165a: mov 344e, r4
+    {
+        a = 0x344e;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 165e: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1662: mov $72, -(sp)
+    {
+        src = uint16_t(0x0072);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1666: mov $ca, -(sp)
+    {
+        src = uint16_t(0x00ca);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 166a: mov $39d7, -(sp)
+    {
+        src = uint16_t(0x39d7);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 166e: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x1672);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L1672:
+    AOT_BLOCK(0x1672, 3);
+    // 1672: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1676: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 167a: jsr pc, *$22dc
+    {
+        a = 0x22dc;
+        r[6] -= 2;
+        WR16(r[6], 0x167e);
+    }
+    AOT_GOTO(0x22dc, L22dc);
+L167e:
+    AOT_BLOCK(0x167e, 4);
+    // 167e: mov $5, 58e0
+    {
+        src = uint16_t(0x0005);
+        b = 0x58e0;
+        WR16(b, src);
+    }
+    // 1684: mov 3444, 4ff4
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = 0x4ff4;
+        WR16(b, src);
+    }
+    // 168a: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 168e: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1692);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1692:
+    AOT_BLOCK(0x1692, 3);
+    // 1692: mov r0, 3448
+    {
+        src = r[0];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 1696: cmp $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 169a: beq 16a4
+    if (Z)
+        AOT_GOTO(0x16a4, L16a4);
+    AOT_GOTO(0x169c, L169c);
+L169c:
+    AOT_BLOCK(0x169c, 2);
+    // 169c: mov $39db, (sp)
+    {
+        src = uint16_t(0x39db);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16a0: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x16a4);
+    }
+    AOT_GOTO(0x1388, L1388);
+L16a4:
+    AOT_BLOCK(0x16a4, 2);
+    // 16a4: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16a8: jsr pc, *$1a4a
+    {
+        a = 0x1a4a;
+        r[6] -= 2;
+        WR16(r[6], 0x16ac);
+    }
+    AOT_GOTO(0x1a4a, L1a4a);
+L16ac:
+    AOT_BLOCK(0x16ac, 5);
+    // 16ac: mov $d1, (sp)
+    {
+        src = uint16_t(0x00d1);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 16b0: mov 4ff4, -(sp)
+    {
+        a = 0x4ff4;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 16b4: mov $70, -(sp)
+    {
+        src = uint16_t(0x0070);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 16b8: mov $39f7, -(sp)
+    {
+        src = uint16_t(0x39f7);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16bc: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x16c0);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L16c0:
+    AOT_BLOCK(0x16c0, 4);
+    // 16c0: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 16c4: mov r4, 344e
+    {
+        src = r[4];
+        b = 0x344e;
+        WR16(b, src);
+    }
+    // 16c8: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L16cc:
+    AOT_BLOCK(0x16cc, 6);
+    // 16cc: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x16d0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 16d0: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 16d4: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+    }
+    // 16d8: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 16dc: mov 2(r0), r4
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x16e0, L16e0);
+L16e0:
+    AOT_BLOCK(0x16e0, 4);
+    // 16e0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 16e2: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 16e6: cmp $18, r0
+    {
+        src = uint16_t(0x0018);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 16ea: bne 1710
+    if (!Z)
+        AOT_GOTO(0x1710, L1710);
+    AOT_GOTO(0x16ec, L16ec);
+L16ec:
+    AOT_BLOCK(0x16ec, 7);
+    // 16ec: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 16f0: movb 4(r0), r0
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 16f4: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 16f8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 16fa: mov 540c(r0), r3
+    {
+        a = uint16_t(r[0] + 21516);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 16fe: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1700: bne 1706
+    if (!Z)
+        AOT_GOTO(0x1706, L1706);
+    AOT_GOTO(0x1702, L1702);
+L1702:
+    AOT_BLOCK(0x1702, 1);
+    // 1702: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1706, L1706);
+L1706:
+    AOT_BLOCK(0x1706, 2);
+    // 1706: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1708: jsr pc, *$2aca
+    {
+        a = 0x2aca;
+        r[6] -= 2;
+        WR16(r[6], 0x170c);
+    }
+    AOT_GOTO(0x2aca, L2aca);
+L170c:
+    AOT_BLOCK(0x170c, 2);
+    // 170c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 170e: br 16e0
+    AOT_GOTO(0x16e0, L16e0);
+L1710:
+    AOT_BLOCK(0x1710, 2);
+    // 1710: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1714: jsr pc, *$2cdc
+    {
+        a = 0x2cdc;
+        r[6] -= 2;
+        WR16(r[6], 0x1718);
+    }
+    AOT_GOTO(0x2cdc, L2cdc);
+L1718:
+    AOT_BLOCK(0x1718, 8);
+    // 1718: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 171a: tst r1
+    {
+        val = int16_t(r[1]);
+        N = val < 0;
+    }
+    // 171c: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 171e: div r3, r0
+    {
+        src = int16_t(r[3]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1720: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1724: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 1728: cmp $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 172c: bne 1742
+    if (!Z)
+        AOT_GOTO(0x1742, L1742);
+    AOT_GOTO(0x172e, L172e);
+L172e:
+    AOT_BLOCK(0x172e, 7);
+    // 172e: mov -c(r5), r1
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1732: asr r1
+    {
+        src = r[1];
+        val = int16_t(src) >> 1;
+        r[1] = val;
+    }
+    // 1734: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1736: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 1738: mul (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 173a: mov r1, r3
+    {
+        src = r[1];
+        r[3] = src;
+    }
+    // 173c: mov $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1742, L1742);
+L1742:
+    AOT_BLOCK(0x1742, 1);
+    // 1742: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1746);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1746:
+    AOT_BLOCK(0x1746, 3);
+    // 1746: mov r0, 3448
+    {
+        src = r[0];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 174a: cmp $9, r0
+    {
+        src = uint16_t(0x0009);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 174e: beq 1758
+    if (Z)
+        AOT_GOTO(0x1758, L1758);
+    AOT_GOTO(0x1750, L1750);
+L1750:
+    AOT_BLOCK(0x1750, 2);
+    // 1750: cmp $1, 3448
+    {
+        src = uint16_t(0x0001);
+        b = 0x3448;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1756: bne 1782
+    if (!Z)
+        AOT_GOTO(0x1782, L1782);
+    AOT_GOTO(0x1758, L1758);
+L1758:
+    AOT_BLOCK(0x1758, 10);
+    // 1758: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 175a: mul -a(r5), r1
+    {
+        a = uint16_t(r[5] + -10);
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 175e: mov r1, (sp)
+    {
+        src = r[1];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1760: inc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1762: bic $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 1766: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 176a: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 176e: mov $cd, -(sp)
+    {
+        src = uint16_t(0x00cd);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1772: mov $39fb, -(sp)
+    {
+        src = uint16_t(0x39fb);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1776: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x177a);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L177a:
+    AOT_BLOCK(0x177a, 2);
+    // 177a: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 177e: jmp *$18d8
+    {
+        a = 0x18d8;
+    }
+    AOT_GOTO(0x18d8, L18d8);
+L1782:
+    AOT_BLOCK(0x1782, 7);
+    // 1782: clr r2
+    {
+        r[2] = 0;
+    }
+    // 1784: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1788: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 178c: mov $71, -(sp)
+    {
+        src = uint16_t(0x0071);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1790: mov $cb, -(sp)
+    {
+        src = uint16_t(0x00cb);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1794: mov $39ff, -(sp)
+    {
+        src = uint16_t(0x39ff);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1798: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x179c);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L179c:
+    AOT_BLOCK(0x179c, 2);
+    // 179c: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 17a0: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x17a4);
+    }
+    AOT_GOTO(0x0246, L0246);
+L17a4:
+    AOT_BLOCK(0x17a4, 3);
+    // 17a4: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 17a8: cmp $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17ac: bne 17e4
+    if (!Z)
+        AOT_GOTO(0x17e4, L17e4);
+    AOT_GOTO(0x17ae, L17ae);
+L17ae:
+    AOT_BLOCK(0x17ae, 6);
+    // 17ae: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17b0: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17b2: mov -a(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17b6: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17b8: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17bc: jsr pc, *$18dc
+    {
+        a = 0x18dc;
+        r[6] -= 2;
+        WR16(r[6], 0x17c0);
+    }
+    AOT_GOTO(0x18dc, L18dc);
+L17c0:
+    AOT_BLOCK(0x17c0, 3);
+    // 17c0: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 17c4: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17c6: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x17ca);
+    }
+    AOT_GOTO(0x0246, L0246);
+L17ca:
+    AOT_BLOCK(0x17ca, 3);
+    // 17ca: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 17ce: cmp $9, r0
+    {
+        src = uint16_t(0x0009);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17d2: beq 17ae
+    if (Z)
+        AOT_GOTO(0x17ae, L17ae);
+    AOT_GOTO(0x17d4, L17d4);
+L17d4:
+    AOT_BLOCK(0x17d4, 2);
+    // 17d4: cmp $3, -8(r5)
+    {
+        src = uint16_t(0x0003);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17da: beq 17e2
+    if (Z)
+        AOT_GOTO(0x17e2, L17e2);
+    AOT_GOTO(0x17dc, L17dc);
+L17dc:
+    AOT_BLOCK(0x17dc, 1);
+    // 17dc: mov -8(r5), 3448
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0x3448;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17e2, L17e2);
+L17e2:
+    AOT_BLOCK(0x17e2, 1);
+    // 17e2: br 1802
+    AOT_GOTO(0x1802, L1802);
+L17e4:
+    AOT_BLOCK(0x17e4, 7);
+    // 17e4: mov -8(r5), 3448
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 17ea: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17ec: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 17ee: mov -a(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17f2: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17f4: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17f8: jsr pc, *$18dc
+    {
+        a = 0x18dc;
+        r[6] -= 2;
+        WR16(r[6], 0x17fc);
+    }
+    AOT_GOTO(0x18dc, L18dc);
+L17fc:
+    AOT_BLOCK(0x17fc, 2);
+    // 17fc: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1800: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1802, L1802);
+L1802:
+    AOT_BLOCK(0x1802, 2);
+    // 1802: cmp $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1806: bne 1852
+    if (!Z)
+        AOT_GOTO(0x1852, L1852);
+    AOT_GOTO(0x1808, L1808);
+L1808:
+    AOT_BLOCK(0x1808, 6);
+    // 1808: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 180a: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        N = val < 0;
+    }
+    // 180c: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 180e: div -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1812: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1816: beq 182e
+    if (Z)
+        AOT_GOTO(0x182e, L182e);
+    AOT_GOTO(0x1818, L1818);
+L1818:
+    AOT_BLOCK(0x1818, 5);
+    // 1818: mov -c(r5), (sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 181c: sub -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 1820: mov $ce, -(sp)
+    {
+        src = uint16_t(0x00ce);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1824: mov $3a03, -(sp)
+    {
+        src = uint16_t(0x3a03);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1828: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x182c);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L182c:
+    AOT_BLOCK(0x182c, 1);
+    // 182c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x182e, L182e);
+L182e:
+    AOT_BLOCK(0x182e, 14);
+    // 182e: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 1830: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 1832: add -c(r5), r1
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 1836: add $fffe, r1
+    {
+        src = uint16_t(0xfffe);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        N = val16 < 0;
+    }
+    // 183a: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 183c: div -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1840: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 1842: mov -c(r5), r1
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1846: asr r1
+    {
+        src = r[1];
+        val = int16_t(src) >> 1;
+        r[1] = val;
+    }
+    // 1848: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 184a: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 184c: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 184e: div (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1850: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1852, L1852);
+L1852:
+    AOT_BLOCK(0x1852, 2);
+    // 1852: cmp r3, r2
+    {
+        src = r[3];
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1854: ble 1870
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1870, L1870);
+    AOT_GOTO(0x1856, L1856);
+L1856:
+    AOT_BLOCK(0x1856, 7);
+    // 1856: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 1858: sub r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+    }
+    // 185a: mul -c(r5), r1
+    {
+        a = uint16_t(r[5] + -12);
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 185e: mov r1, (sp)
+    {
+        src = r[1];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1860: mov $ce, -(sp)
+    {
+        src = uint16_t(0x00ce);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1864: mov $3a06, -(sp)
+    {
+        src = uint16_t(0x3a06);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1868: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x186c);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L186c:
+    AOT_BLOCK(0x186c, 2);
+    // 186c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 186e: br 189a
+    AOT_GOTO(0x189a, L189a);
+L1870:
+    AOT_BLOCK(0x1870, 2);
+    // 1870: cmp r3, r2
+    {
+        src = r[3];
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1872: bge 189a
+    if (!(N ^ V))
+        AOT_GOTO(0x189a, L189a);
+    AOT_GOTO(0x1874, L1874);
+L1874:
+    AOT_BLOCK(0x1874, 5);
+    // 1874: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1878: mov 2(r0), r0
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 187c: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1880: cmp $18, r0
+    {
+        src = uint16_t(0x0018);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1884: bne 1898
+    if (!Z)
+        AOT_GOTO(0x1898, L1898);
+    AOT_GOTO(0x1886, L1886);
+L1886:
+    AOT_BLOCK(0x1886, 5);
+    // 1886: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 188a: movb 4(r0), r0
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 188e: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1892: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1894: mov r2, 540c(r0)
+    {
+        src = r[2];
+        b = uint16_t(r[0] + 21516);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1898, L1898);
+L1898:
+    AOT_BLOCK(0x1898, 1);
+    // 1898: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x189a, L189a);
+L189a:
+    AOT_BLOCK(0x189a, 2);
+    // 189a: cmp $1, r2
+    {
+        src = uint16_t(0x0001);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 189e: bge 18ba
+    if (!(N ^ V))
+        AOT_GOTO(0x18ba, L18ba);
+    AOT_GOTO(0x18a0, L18a0);
+L18a0:
+    AOT_BLOCK(0x18a0, 5);
+    // 18a0: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 18a4: mov 2(r0), r0
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 18a8: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 18ac: cmp $18, r0
+    {
+        src = uint16_t(0x0018);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18b0: beq 18ba
+    if (Z)
+        AOT_GOTO(0x18ba, L18ba);
+    AOT_GOTO(0x18b2, L18b2);
+L18b2:
+    AOT_BLOCK(0x18b2, 2);
+    // 18b2: mov $3a09, (sp)
+    {
+        src = uint16_t(0x3a09);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18b6: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x18ba);
+    }
+    AOT_GOTO(0x1388, L1388);
+L18ba:
+    AOT_BLOCK(0x18ba, 6);
+    // 18ba: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 18bc: mov -a(r5), r1
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 18c0: com r1
+    {
+        val = ~int(r[1]);
+        r[1] = val;
+        C = true;
+    }
+    // 18c2: bic r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 18c4: bit $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 18c8: beq 18d8
+    if (Z)
+        AOT_GOTO(0x18d8, L18d8);
+    AOT_GOTO(0x18ca, L18ca);
+L18ca:
+    AOT_BLOCK(0x18ca, 3);
+    // 18ca: mov $d2, (sp)
+    {
+        src = uint16_t(0x00d2);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 18ce: mov $3a1f, -(sp)
+    {
+        src = uint16_t(0x3a1f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18d2: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x18d6);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L18d6:
+    AOT_BLOCK(0x18d6, 1);
+    // 18d6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x18d8, L18d8);
+L18d8:
+    AOT_BLOCK(0x18d8, 2);
+    // 18d8: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L18dc:
+    AOT_BLOCK(0x18dc, 6);
+    // 18dc: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x18e0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 18e0: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 18e4: mov 8(r5), r3
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 18e8: mov a(r5), r2
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18ec: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x18f0);
+    }
+    AOT_GOTO(0x0246, L0246);
+L18f0:
+    AOT_BLOCK(0x18f0, 3);
+    // 18f0: mov r0, 3448
+    {
+        src = r[0];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 18f4: cmp $16, r0
+    {
+        src = uint16_t(0x0016);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18f8: bne 194a
+    if (!Z)
+        AOT_GOTO(0x194a, L194a);
+    AOT_GOTO(0x18fa, L18fa);
+L18fa:
+    AOT_BLOCK(0x18fa, 2);
+    // 18fa: cmp $1, 6(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1900: bne 194a
+    if (!Z)
+        AOT_GOTO(0x194a, L194a);
+    AOT_GOTO(0x1902, L1902);
+L1902:
+    AOT_BLOCK(0x1902, 3);
+    // 1902: mov $ffff, 3448
+    {
+        src = uint16_t(0xffff);
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 1908: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 190a: beq 1910
+    if (Z)
+        AOT_GOTO(0x1910, L1910);
+    AOT_GOTO(0x190c, L190c);
+L190c:
+    AOT_BLOCK(0x190c, 1);
+    // 190c: jsr pc, 1a3a
+    {
+        a = 0x1a3a;
+        r[6] -= 2;
+        WR16(r[6], 0x1910);
+    }
+    AOT_GOTO(0x1a3a, L1a3a);
+L1910:
+    AOT_BLOCK(0x1910, 2);
+    // 1910: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1912: jsr pc, *$05ae
+    {
+        a = 0x05ae;
+        r[6] -= 2;
+        WR16(r[6], 0x1916);
+    }
+    AOT_GOTO(0x05ae, L05ae);
+L1916:
+    AOT_BLOCK(0x1916, 2);
+    // 1916: cmp 53fc, c(r5)
+    {
+        a = 0x53fc;
+        src = RD16(a);
+        b = uint16_t(r[5] + 12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 191c: bge 1942
+    if (!(N ^ V))
+        AOT_GOTO(0x1942, L1942);
+    AOT_GOTO(0x191e, L191e);
+L191e:
+    AOT_BLOCK(0x191e, 6);
+    // 191e: inc 5404
+    {
+        a = 0x5404;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1922: mov c(r5), (sp)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1926: sub 53fc, (sp)
+    {
+        a = 0x53fc;
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 192a: mov $ce, -(sp)
+    {
+        src = uint16_t(0x00ce);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 192e: mov $3a21, -(sp)
+    {
+        src = uint16_t(0x3a21);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1932: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x1936);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L1936:
+    AOT_BLOCK(0x1936, 3);
+    // 1936: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 1938: clr 5404
+    {
+        a = 0x5404;
+        WR16(a, 0);
+        C = false;
+    }
+    // 193c: mov c(r5), 53fc
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        b = 0x53fc;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1942, L1942);
+L1942:
+    AOT_BLOCK(0x1942, 2);
+    // 1942: mov 53fc, r0
+    {
+        a = 0x53fc;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1946: jmp *$1a36
+    {
+        a = 0x1a36;
+    }
+    AOT_GOTO(0x1a36, L1a36);
+L194a:
+    AOT_BLOCK(0x194a, 2);
+    // 194a: cmp $3, 3448
+    {
+        src = uint16_t(0x0003);
+        b = 0x3448;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1950: bne 1958
+    if (!Z)
+        AOT_GOTO(0x1958, L1958);
+    AOT_GOTO(0x1952, L1952);
+L1952:
+    AOT_BLOCK(0x1952, 2);
+    // 1952: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1954: jmp *$1a36
+    {
+        a = 0x1a36;
+    }
+    AOT_GOTO(0x1a36, L1a36);
+L1958:
+    AOT_BLOCK(0x1958, 2);
+    // 1958: inc 5408
+    {
+        a = 0x5408;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 195c: jsr pc, 0736
+    {
+        a = 0x0736;
+        r[6] -= 2;
+        WR16(r[6], 0x1960);
+    }
+    AOT_GOTO(0x0736, L0736);
+L1960:
+    AOT_BLOCK(0x1960, 4);
+    // 1960: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1962: clr 5408
+    {
+        a = 0x5408;
+        WR16(a, 0);
+        C = false;
+    }
+    // 1966: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1968: br 1a20
+    AOT_GOTO(0x1a20, L1a20);
+L196a:
+    AOT_BLOCK(0x196a, 2);
+    // 196a: cmp $15, (r4)
+    {
+        src = uint16_t(0x0015);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 196e: bne 1a1a
+    if (!Z)
+        AOT_GOTO(0x1a1a, L1a1a);
+    AOT_GOTO(0x1970, L1970);
+L1970:
+    AOT_BLOCK(0x1970, 4);
+    // 1970: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1974: mov $c8, -(sp)
+    {
+        src = uint16_t(0x00c8);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1978: mov $3a24, -(sp)
+    {
+        src = uint16_t(0x3a24);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 197c: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x1980);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L1980:
+    AOT_BLOCK(0x1980, 2);
+    // 1980: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1982: br 1a30
+    AOT_GOTO(0x1a30, L1a30);
+L1984:
+    AOT_BLOCK(0x1984, 2);
+    // 1984: cmp $15, (r4)
+    {
+        src = uint16_t(0x0015);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1988: bne 199e
+    if (!Z)
+        AOT_GOTO(0x199e, L199e);
+    AOT_GOTO(0x198a, L198a);
+L198a:
+    AOT_BLOCK(0x198a, 4);
+    // 198a: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 198e: mov $c9, -(sp)
+    {
+        src = uint16_t(0x00c9);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1992: mov $3a29, -(sp)
+    {
+        src = uint16_t(0x3a29);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1996: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x199a);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L199a:
+    AOT_BLOCK(0x199a, 2);
+    // 199a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 199c: br 1a30
+    AOT_GOTO(0x1a30, L1a30);
+L199e:
+    AOT_BLOCK(0x199e, 2);
+    // 199e: cmp $17, (r4)
+    {
+        src = uint16_t(0x0017);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 19a2: beq 19aa
+    if (Z)
+        AOT_GOTO(0x19aa, L19aa);
+    AOT_GOTO(0x19a4, L19a4);
+L19a4:
+    AOT_BLOCK(0x19a4, 2);
+    // 19a4: cmp $18, (r4)
+    {
+        src = uint16_t(0x0018);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 19a8: bne 19ba
+    if (!Z)
+        AOT_GOTO(0x19ba, L19ba);
+    AOT_GOTO(0x19aa, L19aa);
+L19aa:
+    AOT_BLOCK(0x19aa, 2);
+    // 19aa: cmp $4, 6(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 19b0: bne 19b8
+    if (!Z)
+        AOT_GOTO(0x19b8, L19b8);
+    AOT_GOTO(0x19b2, L19b2);
+L19b2:
+    AOT_BLOCK(0x19b2, 2);
+    // 19b2: add $3, r2
+    {
+        src = uint16_t(0x0003);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 19b6: br 19f8
+    AOT_GOTO(0x19f8, L19f8);
+L19b8:
+    AOT_BLOCK(0x19b8, 1);
+    // 19b8: br 1a1a
+    AOT_GOTO(0x1a1a, L1a1a);
+L19ba:
+    AOT_BLOCK(0x19ba, 6);
+    // 19ba: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19bc: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 19be: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 19c0: mov $68, -(sp)
+    {
+        src = uint16_t(0x0068);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19c4: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19c8: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x19cc);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L19cc:
+    AOT_BLOCK(0x19cc, 3);
+    // 19cc: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 19d0: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19d2: jsr pc, *$2b4a
+    {
+        a = 0x2b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x19d6);
+    }
+    AOT_GOTO(0x2b4a, L2b4a);
+L19d6:
+    AOT_BLOCK(0x19d6, 1);
+    // 19d6: br 1a30
+    AOT_GOTO(0x1a30, L1a30);
+L19d8:
+    // 19d8: (undefined)
+    AOT_INTERP(0x19d8);
+L19da:
+    AOT_BLOCK(0x19da, 1);
+    // 19da: bit *-(r0), *(r0)+
+    {
+        r[0] -= 2;
+        a = RD16(r[0]);
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 19dc: (undefined)
+    AOT_INTERP(0x19dc);
+L19de:
+    // 19de: (undefined)
+    AOT_INTERP(0x19de);
+L19e0:
+    // 19e0: (undefined)
+    AOT_INTERP(0x19e0);
+L19e2:
+    // 19e2: (undefined)
+    AOT_INTERP(0x19e2);
+L19e4:
+    // 19e4: (undefined)
+    AOT_INTERP(0x19e4);
+L19e6:
+    AOT_BLOCK(0x19e6, 3);
+    // 19e6: mov $c9, -(sp)
+    {
+        src = uint16_t(0x00c9);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19ea: mov $3a2e, -(sp)
+    {
+        src = uint16_t(0x3a2e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19ee: jsr pc, 2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x19f2);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L19f2:
+    AOT_BLOCK(0x19f2, 2);
+    // 19f2: add $c, sp
+    {
+        src = uint16_t(0x000c);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 19f6: br 1a0e
+    AOT_GOTO(0x1a0e, L1a0e);
+L19f8:
+    // 19f8: (undefined)
+    AOT_INTERP(0x19f8);
+L19fa:
+    AOT_BLOCK(0x19fa, 4);
+    // 19fa: bit -(pc), *-7da(r0)
+    {
+        src = uint16_t(0x0000);
+        b = RD16(r[0] + -2010);
+        dst = RD16(b);
+        val = src & dst;
+    }
+    // 19fe: mov $c9, -(sp)
+    {
+        src = uint16_t(0x00c9);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a02: mov $3a35, -(sp)
+    {
+        src = uint16_t(0x3a35);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a06: jsr pc, 2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x1a0a);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L1a0a:
+    AOT_BLOCK(0x1a0a, 1);
+    // 1a0a: add $c, sp
+    {
+        src = uint16_t(0x000c);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1a0e, L1a0e);
+L1a0e:
+    AOT_BLOCK(0x1a0e, 2);
+    // 1a0e: cmp $17, (r4)
+    {
+        src = uint16_t(0x0017);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a12: beq 1a30
+    if (Z)
+        AOT_GOTO(0x1a30, L1a30);
+    AOT_GOTO(0x1a14, L1a14);
+L1a14:
+    AOT_BLOCK(0x1a14, 2);
+    // 1a14: cmp $18, (r4)
+    {
+        src = uint16_t(0x0018);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a18: beq 1a30
+    if (Z)
+        AOT_GOTO(0x1a30, L1a30);
+    AOT_GOTO(0x1a1a, L1a1a);
+L1a1a:
+    AOT_BLOCK(0x1a1a, 1);
+    // 1a1a: jsr pc, 1a3a
+    {
+        a = 0x1a3a;
+        r[6] -= 2;
+        WR16(r[6], 0x1a1e);
+    }
+    AOT_GOTO(0x1a3a, L1a3a);
+L1a1e:
+    AOT_BLOCK(0x1a1e, 1);
+    // 1a1e: br 1a30
+    AOT_GOTO(0x1a30, L1a30);
+L1a20:
+    AOT_BLOCK(0x1a20, 3);
+    // 1a20: sub $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1a24: cmp r0, $7
+    {
+        src = r[0];
+        dst = uint16_t(0x0007);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a28: bhi 1a1a
+    if (!(C | Z))
+        AOT_GOTO(0x1a1a, L1a1a);
+    AOT_GOTO(0x1a2a, L1a2a);
+L1a2a:
+    AOT_BLOCK(0x1a2a, 2);
+    // 1a2a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 1a2c: jmp *3952(r0)
+    {
+        a = RD16(r[0] + 14674);
+    }
+    AOT_JUMP(a);
+L1a30:
+    AOT_BLOCK(0x1a30, 3);
+    // 1a30: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 1a32: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a34: br 1a36
+    AOT_GOTO(0x1a36, L1a36);
+L1a36:
+    AOT_BLOCK(0x1a36, 2);
+    // 1a36: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1a3a:
+    AOT_BLOCK(0x1a3a, 4);
+    // 1a3a: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1a3e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1a3e: mov $3a40, (sp)
+    {
+        src = uint16_t(0x3a40);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a42: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1a46);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1a46:
+    AOT_BLOCK(0x1a46, 2);
+    // 1a46: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1a4a:
+    AOT_BLOCK(0x1a4a, 3);
+    // 1a4a: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1a4e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1a4e: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1a52, L1a52);
+L1a52:
+    AOT_BLOCK(0x1a52, 1);
+    // 1a52: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1a56);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1a56:
+    AOT_BLOCK(0x1a56, 3);
+    // 1a56: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1a58: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a5a: jmp *$1eb0
+    {
+        a = 0x1eb0;
+    }
+    AOT_GOTO(0x1eb0, L1eb0);
+L1a5e:
+    AOT_BLOCK(0x1a5e, 2);
+    // 1a5e: mov $3a65, (sp)
+    {
+        src = uint16_t(0x3a65);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a62: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1a66);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1a66:
+    AOT_BLOCK(0x1a66, 1);
+    // 1a66: jmp *$1ee8
+    {
+        a = 0x1ee8;
+    }
+    AOT_GOTO(0x1ee8, L1ee8);
+L1a6a:
+    AOT_BLOCK(0x1a6a, 2);
+    // 1a6a: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1a6e: beq 1aa0
+    if (Z)
+        AOT_GOTO(0x1aa0, L1aa0);
+    AOT_GOTO(0x1a70, L1a70);
+L1a70:
+    AOT_BLOCK(0x1a70, 2);
+    // 1a70: tst 53ee
+    {
+        a = 0x53ee;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1a74: beq 1a8c
+    if (Z)
+        AOT_GOTO(0x1a8c, L1a8c);
+    AOT_GOTO(0x1a76, L1a76);
+L1a76:
+    AOT_BLOCK(0x1a76, 5);
+    // 1a76: mov 3444, (sp)
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a7a: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1a7e: mov $d4, -(sp)
+    {
+        src = uint16_t(0x00d4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a82: mov $3a74, -(sp)
+    {
+        src = uint16_t(0x3a74);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a86: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x1a8a);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L1a8a:
+    AOT_BLOCK(0x1a8a, 1);
+    // 1a8a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1a8c, L1a8c);
+L1a8c:
+    AOT_BLOCK(0x1a8c, 1);
+    // 1a8c: jsr pc, 20fa
+    {
+        a = 0x20fa;
+        r[6] -= 2;
+        WR16(r[6], 0x1a90);
+    }
+    AOT_GOTO(0x20fa, L20fa);
+L1a90:
+    AOT_BLOCK(0x1a90, 4);
+    // 1a90: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a92: mov $d0, -(sp)
+    {
+        src = uint16_t(0x00d0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a96: mov $3a77, -(sp)
+    {
+        src = uint16_t(0x3a77);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a9a: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x1a9e);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L1a9e:
+    AOT_BLOCK(0x1a9e, 1);
+    // 1a9e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1aa0, L1aa0);
+L1aa0:
+    AOT_BLOCK(0x1aa0, 2);
+    // 1aa0: tst 4ffe
+    {
+        a = 0x4ffe;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1aa4: bne 1ac2
+    if (!Z)
+        AOT_GOTO(0x1ac2, L1ac2);
+    AOT_GOTO(0x1aa6, L1aa6);
+L1aa6:
+    AOT_BLOCK(0x1aa6, 1);
+    // 1aa6: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1aaa);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1aaa:
+    AOT_BLOCK(0x1aaa, 3);
+    // 1aaa: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1aac: cmp $3, r4
+    {
+        src = uint16_t(0x0003);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ab0: bne 1ab6
+    if (!Z)
+        AOT_GOTO(0x1ab6, L1ab6);
+    AOT_GOTO(0x1ab2, L1ab2);
+L1ab2:
+    AOT_BLOCK(0x1ab2, 1);
+    // 1ab2: jmp *$1ee8
+    {
+        a = 0x1ee8;
+    }
+    AOT_GOTO(0x1ee8, L1ee8);
+L1ab6:
+    AOT_BLOCK(0x1ab6, 3);
+    // 1ab6: mov r4, 3448
+    {
+        src = r[4];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 1aba: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1abc: jsr pc, *$1a4a
+    {
+        a = 0x1a4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1ac0);
+    }
+    AOT_GOTO(0x1a4a, L1a4a);
+L1ac0:
+    AOT_BLOCK(0x1ac0, 1);
+    // 1ac0: br 1aa0
+    AOT_GOTO(0x1aa0, L1aa0);
+L1ac2:
+    AOT_BLOCK(0x1ac2, 2);
+    // 1ac2: mov $3a7a, (sp)
+    {
+        src = uint16_t(0x3a7a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ac6: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1aca);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1aca:
+    AOT_BLOCK(0x1aca, 1);
+    // 1aca: jmp *$1ee8
+    {
+        a = 0x1ee8;
+    }
+    AOT_GOTO(0x1ee8, L1ee8);
+L1ace:
+    AOT_BLOCK(0x1ace, 2);
+    // 1ace: mov 53f2, r0
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ad2: jmp *$1e4c
+    {
+        a = 0x1e4c;
+    }
+    AOT_GOTO(0x1e4c, L1e4c);
+L1ad6:
+    AOT_BLOCK(0x1ad6, 1);
+    // 1ad6: jsr pc, 2da0
+    {
+        a = 0x2da0;
+        r[6] -= 2;
+        WR16(r[6], 0x1ada);
+    }
+    AOT_GOTO(0x2da0, L2da0);
+L1ada:
+    AOT_BLOCK(0x1ada, 2);
+    // 1ada: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1adc: beq 1ae6
+    if (Z)
+        AOT_GOTO(0x1ae6, L1ae6);
+    AOT_GOTO(0x1ade, L1ade);
+L1ade:
+    AOT_BLOCK(0x1ade, 2);
+    // 1ade: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ae0: jsr pc, *$2c6e
+    {
+        a = 0x2c6e;
+        r[6] -= 2;
+        WR16(r[6], 0x1ae4);
+    }
+    AOT_GOTO(0x2c6e, L2c6e);
+L1ae4:
+    AOT_BLOCK(0x1ae4, 1);
+    // 1ae4: br 1aea
+    AOT_GOTO(0x1aea, L1aea);
+L1ae6:
+    AOT_BLOCK(0x1ae6, 1);
+    // 1ae6: jsr pc, 2e8c
+    {
+        a = 0x2e8c;
+        r[6] -= 2;
+        WR16(r[6], 0x1aea);
+    }
+    AOT_GOTO(0x2e8c, L2e8c);
+L1aea:
+    AOT_BLOCK(0x1aea, 1);
+    // 1aea: jmp *$1ece
+    {
+        a = 0x1ece;
+    }
+    AOT_GOTO(0x1ece, L1ece);
+L1aee:
+    AOT_BLOCK(0x1aee, 1);
+    // 1aee: jsr pc, 2edc
+    {
+        a = 0x2edc;
+        r[6] -= 2;
+        WR16(r[6], 0x1af2);
+    }
+    AOT_GOTO(0x2edc, L2edc);
+L1af2:
+    AOT_BLOCK(0x1af2, 1);
+    // 1af2: jmp *$1ece
+    {
+        a = 0x1ece;
+    }
+    AOT_GOTO(0x1ece, L1ece);
+L1af6:
+    AOT_BLOCK(0x1af6, 1);
+    // 1af6: jsr pc, 2010
+    {
+        a = 0x2010;
+        r[6] -= 2;
+        WR16(r[6], 0x1afa);
+    }
+    AOT_GOTO(0x2010, L2010);
+L1afa:
+    AOT_BLOCK(0x1afa, 3);
+    // 1afa: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 1afe: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1b00: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1b04);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1b04:
+    AOT_BLOCK(0x1b04, 3);
+    // 1b04: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1b06: cmp $13, r3
+    {
+        src = uint16_t(0x0013);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b0a: bne 1bd2
+    if (!Z)
+        AOT_GOTO(0x1bd2, L1bd2);
+    AOT_GOTO(0x1b0c, L1b0c);
+L1b0c:
+    AOT_BLOCK(0x1b0c, 2);
+    // 1b0c: mov 53f2, r0
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b10: br 1bc2
+    AOT_GOTO(0x1bc2, L1bc2);
+L1b12:
+    AOT_BLOCK(0x1b12, 1);
+    // 1b12: jsr pc, 2da0
+    {
+        a = 0x2da0;
+        r[6] -= 2;
+        WR16(r[6], 0x1b16);
+    }
+    AOT_GOTO(0x2da0, L2da0);
+L1b16:
+    AOT_BLOCK(0x1b16, 2);
+    // 1b16: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b18: bne 1b7a
+    if (!Z)
+        AOT_GOTO(0x1b7a, L1b7a);
+    AOT_GOTO(0x1b1a, L1b1a);
+L1b1a:
+    AOT_BLOCK(0x1b1a, 6);
+    // 1b1a: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1b1c: mov 3444, r2
+    {
+        a = 0x3444;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1b20: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b22: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1b26: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b2a: jsr pc, *$2b20
+    {
+        a = 0x2b20;
+        r[6] -= 2;
+        WR16(r[6], 0x1b2e);
+    }
+    AOT_GOTO(0x2b20, L2b20);
+L1b2e:
+    AOT_BLOCK(0x1b2e, 2);
+    // 1b2e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b30: jsr pc, 2e8c
+    {
+        a = 0x2e8c;
+        r[6] -= 2;
+        WR16(r[6], 0x1b34);
+    }
+    AOT_GOTO(0x2e8c, L2e8c);
+L1b34:
+    AOT_BLOCK(0x1b34, 2);
+    // 1b34: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b36: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1b3a);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1b3a:
+    AOT_BLOCK(0x1b3a, 1);
+    // 1b3a: br 1b90
+    AOT_GOTO(0x1b90, L1b90);
+L1b3c:
+    AOT_BLOCK(0x1b3c, 1);
+    // 1b3c: jsr pc, 2e06
+    {
+        a = 0x2e06;
+        r[6] -= 2;
+        WR16(r[6], 0x1b40);
+    }
+    AOT_GOTO(0x2e06, L2e06);
+L1b40:
+    AOT_BLOCK(0x1b40, 2);
+    // 1b40: cmp $3b, r0
+    {
+        src = uint16_t(0x003b);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b44: bne 1b4c
+    if (!Z)
+        AOT_GOTO(0x1b4c, L1b4c);
+    AOT_GOTO(0x1b46, L1b46);
+L1b46:
+    AOT_BLOCK(0x1b46, 2);
+    // 1b46: mov 4ff4, r2
+    {
+        a = 0x4ff4;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b4a: br 1b7a
+    AOT_GOTO(0x1b7a, L1b7a);
+L1b4c:
+    AOT_BLOCK(0x1b4c, 6);
+    // 1b4c: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1b4e: mov 3444, r3
+    {
+        a = 0x3444;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1b52: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b54: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1b58: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b5c: jsr pc, *$2b20
+    {
+        a = 0x2b20;
+        r[6] -= 2;
+        WR16(r[6], 0x1b60);
+    }
+    AOT_GOTO(0x2b20, L2b20);
+L1b60:
+    AOT_BLOCK(0x1b60, 2);
+    // 1b60: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b62: jsr pc, 2edc
+    {
+        a = 0x2edc;
+        r[6] -= 2;
+        WR16(r[6], 0x1b66);
+    }
+    AOT_GOTO(0x2edc, L2edc);
+L1b66:
+    AOT_BLOCK(0x1b66, 2);
+    // 1b66: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b68: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1b6c);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1b6c:
+    AOT_BLOCK(0x1b6c, 2);
+    // 1b6c: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1b6e: br 1b90
+    AOT_GOTO(0x1b90, L1b90);
+L1b70:
+    AOT_BLOCK(0x1b70, 2);
+    // 1b70: mov 4ff2, r2
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b74: br 1b7a
+    AOT_GOTO(0x1b7a, L1b7a);
+L1b76:
+    AOT_BLOCK(0x1b76, 1);
+    // 1b76: mov 4ff0, r2
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b7a, L1b7a);
+L1b7a:
+    AOT_BLOCK(0x1b7a, 2);
+    // 1b7a: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b7c: jsr pc, *$2e76
+    {
+        a = 0x2e76;
+        r[6] -= 2;
+        WR16(r[6], 0x1b80);
+    }
+    AOT_GOTO(0x2e76, L2e76);
+L1b80:
+    AOT_BLOCK(0x1b80, 4);
+    // 1b80: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b84: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b86: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b8a: jsr pc, *$2b20
+    {
+        a = 0x2b20;
+        r[6] -= 2;
+        WR16(r[6], 0x1b8e);
+    }
+    AOT_GOTO(0x2b20, L2b20);
+L1b8e:
+    AOT_BLOCK(0x1b8e, 1);
+    // 1b8e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1b90, L1b90);
+L1b90:
+    AOT_BLOCK(0x1b90, 1);
+    // 1b90: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1b94);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1b94:
+    AOT_BLOCK(0x1b94, 3);
+    // 1b94: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1b96: cmp $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b9a: beq 1ba0
+    if (Z)
+        AOT_GOTO(0x1ba0, L1ba0);
+    AOT_GOTO(0x1b9c, L1b9c);
+L1b9c:
+    AOT_BLOCK(0x1b9c, 1);
+    // 1b9c: jmp *$1eda
+    {
+        a = 0x1eda;
+    }
+    AOT_GOTO(0x1eda, L1eda);
+L1ba0:
+    AOT_BLOCK(0x1ba0, 1);
+    // 1ba0: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1ba4);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1ba4:
+    AOT_BLOCK(0x1ba4, 3);
+    // 1ba4: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1ba6: cmp $13, r3
+    {
+        src = uint16_t(0x0013);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1baa: bne 1bb8
+    if (!Z)
+        AOT_GOTO(0x1bb8, L1bb8);
+    AOT_GOTO(0x1bac, L1bac);
+L1bac:
+    AOT_BLOCK(0x1bac, 2);
+    // 1bac: cmp $18, 53f2
+    {
+        src = uint16_t(0x0018);
+        b = 0x53f2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1bb2: bne 1bb8
+    if (!Z)
+        AOT_GOTO(0x1bb8, L1bb8);
+    AOT_GOTO(0x1bb4, L1bb4);
+L1bb4:
+    AOT_BLOCK(0x1bb4, 1);
+    // 1bb4: jmp *$1a52
+    {
+        a = 0x1a52;
+    }
+    AOT_GOTO(0x1a52, L1a52);
+L1bb8:
+    AOT_BLOCK(0x1bb8, 2);
+    // 1bb8: mov r3, 3448
+    {
+        src = r[3];
+        b = 0x3448;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bbc: jmp *$1ee8
+    {
+        a = 0x1ee8;
+    }
+    AOT_GOTO(0x1ee8, L1ee8);
+L1bc2:
+    AOT_BLOCK(0x1bc2, 3);
+    // 1bc2: sub $14, r0
+    {
+        src = uint16_t(0x0014);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1bc6: cmp r0, $8
+    {
+        src = r[0];
+        dst = uint16_t(0x0008);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1bca: bhi 1bd2
+    if (!(C | Z))
+        AOT_GOTO(0x1bd2, L1bd2);
+    AOT_GOTO(0x1bcc, L1bcc);
+L1bcc:
+    AOT_BLOCK(0x1bcc, 2);
+    // 1bcc: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 1bce: jmp *3962(r0)
+    {
+        a = RD16(r[0] + 14690);
+    }
+    AOT_JUMP(a);
+L1bd2:
+    AOT_BLOCK(0x1bd2, 7);
+    // 1bd2: mov r3, 3448
+    {
+        src = r[3];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 1bd6: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1bd8: mov 3444, r3
+    {
+        a = 0x3444;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1bdc: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bde: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1be2: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1be6: jsr pc, *$2b20
+    {
+        a = 0x2b20;
+        r[6] -= 2;
+        WR16(r[6], 0x1bea);
+    }
+    AOT_GOTO(0x2b20, L2b20);
+L1bea:
+    AOT_BLOCK(0x1bea, 3);
+    // 1bea: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 1bec: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1bee: jsr pc, *$1a4a
+    {
+        a = 0x1a4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1bf2);
+    }
+    AOT_GOTO(0x1a4a, L1a4a);
+L1bf2:
+    AOT_BLOCK(0x1bf2, 1);
+    // 1bf2: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1bf6);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1bf6:
+    AOT_BLOCK(0x1bf6, 3);
+    // 1bf6: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1bf8: cmp $13, r4
+    {
+        src = uint16_t(0x0013);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1bfc: bne 1c2a
+    if (!Z)
+        AOT_GOTO(0x1c2a, L1c2a);
+    AOT_GOTO(0x1bfe, L1bfe);
+L1bfe:
+    AOT_BLOCK(0x1bfe, 2);
+    // 1bfe: cmp $18, 53f2
+    {
+        src = uint16_t(0x0018);
+        b = 0x53f2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c04: bne 1c2a
+    if (!Z)
+        AOT_GOTO(0x1c2a, L1c2a);
+    AOT_GOTO(0x1c06, L1c06);
+L1c06:
+    AOT_BLOCK(0x1c06, 4);
+    // 1c06: mov 3444, r2
+    {
+        a = 0x3444;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1c0a: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1c0e: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c10: jsr pc, *$2c6e
+    {
+        a = 0x2c6e;
+        r[6] -= 2;
+        WR16(r[6], 0x1c14);
+    }
+    AOT_GOTO(0x2c6e, L2c6e);
+L1c14:
+    AOT_BLOCK(0x1c14, 2);
+    // 1c14: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c16: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1c1a);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1c1a:
+    AOT_BLOCK(0x1c1a, 2);
+    // 1c1a: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1c1c: jsr pc, *$1a4a
+    {
+        a = 0x1a4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1c20);
+    }
+    AOT_GOTO(0x1a4a, L1a4a);
+L1c20:
+    AOT_BLOCK(0x1c20, 2);
+    // 1c20: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c22: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1c26);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1c26:
+    AOT_BLOCK(0x1c26, 1);
+    // 1c26: jmp *$1ee8
+    {
+        a = 0x1ee8;
+    }
+    AOT_GOTO(0x1ee8, L1ee8);
+L1c2a:
+    AOT_BLOCK(0x1c2a, 3);
+    // 1c2a: mov r4, 3448
+    {
+        src = r[4];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 1c2e: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c30: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1c34);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1c34:
+    AOT_BLOCK(0x1c34, 1);
+    // 1c34: jmp *$1ee8
+    {
+        a = 0x1ee8;
+    }
+    AOT_GOTO(0x1ee8, L1ee8);
+L1c38:
+    AOT_BLOCK(0x1c38, 7);
+    // 1c38: mov 4ff0, r3
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1c3c: mov 4ff2, r2
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1c40: mov 3444, r0
+    {
+        a = 0x3444;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1c44: mov r0, 4ff0
+    {
+        src = r[0];
+        b = 0x4ff0;
+        WR16(b, src);
+    }
+    // 1c48: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c4a: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1c4e: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1c52);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1c52:
+    AOT_BLOCK(0x1c52, 6);
+    // 1c52: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1c54: mov 3444, r0
+    {
+        a = 0x3444;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1c58: mov r0, 4ff2
+    {
+        src = r[0];
+        b = 0x4ff2;
+        WR16(b, src);
+    }
+    // 1c5c: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c5e: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1c62: jsr pc, 2010
+    {
+        a = 0x2010;
+        r[6] -= 2;
+        WR16(r[6], 0x1c66);
+    }
+    AOT_GOTO(0x2010, L2010);
+L1c66:
+    AOT_BLOCK(0x1c66, 2);
+    // 1c66: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c68: jsr pc, *$2b20
+    {
+        a = 0x2b20;
+        r[6] -= 2;
+        WR16(r[6], 0x1c6c);
+    }
+    AOT_GOTO(0x2b20, L2b20);
+L1c6c:
+    AOT_BLOCK(0x1c6c, 3);
+    // 1c6c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 1c6e: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1c70: jsr pc, *$1a4a
+    {
+        a = 0x1a4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1c74);
+    }
+    AOT_GOTO(0x1a4a, L1a4a);
+L1c74:
+    AOT_BLOCK(0x1c74, 2);
+    // 1c74: mov 4ff0, (sp)
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c78: jsr pc, *$2c6e
+    {
+        a = 0x2c6e;
+        r[6] -= 2;
+        WR16(r[6], 0x1c7c);
+    }
+    AOT_GOTO(0x2c6e, L2c6e);
+L1c7c:
+    AOT_BLOCK(0x1c7c, 2);
+    // 1c7c: mov 4ff2, (sp)
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c80: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1c84);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1c84:
+    AOT_BLOCK(0x1c84, 3);
+    // 1c84: mov r3, 4ff0
+    {
+        src = r[3];
+        b = 0x4ff0;
+        WR16(b, src);
+    }
+    // 1c88: mov r2, 4ff2
+    {
+        src = r[2];
+        b = 0x4ff2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c8c: jmp *$1ee8
+    {
+        a = 0x1ee8;
+    }
+    AOT_GOTO(0x1ee8, L1ee8);
+L1c90:
+    AOT_BLOCK(0x1c90, 2);
+    // 1c90: mov 4ff2, (sp)
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c94: jsr pc, *$2e76
+    {
+        a = 0x2e76;
+        r[6] -= 2;
+        WR16(r[6], 0x1c98);
+    }
+    AOT_GOTO(0x2e76, L2e76);
+L1c98:
+    AOT_BLOCK(0x1c98, 2);
+    // 1c98: mov 4ff2, (sp)
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c9c: jsr pc, *$2c6e
+    {
+        a = 0x2c6e;
+        r[6] -= 2;
+        WR16(r[6], 0x1ca0);
+    }
+    AOT_GOTO(0x2c6e, L2c6e);
+L1ca0:
+    AOT_BLOCK(0x1ca0, 1);
+    // 1ca0: jmp *$1ece
+    {
+        a = 0x1ece;
+    }
+    AOT_GOTO(0x1ece, L1ece);
+L1ca4:
+    AOT_BLOCK(0x1ca4, 2);
+    // 1ca4: mov 4ff0, (sp)
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ca8: jsr pc, *$2e76
+    {
+        a = 0x2e76;
+        r[6] -= 2;
+        WR16(r[6], 0x1cac);
+    }
+    AOT_GOTO(0x2e76, L2e76);
+L1cac:
+    AOT_BLOCK(0x1cac, 2);
+    // 1cac: mov 4ff0, (sp)
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cb0: jsr pc, *$2c6e
+    {
+        a = 0x2c6e;
+        r[6] -= 2;
+        WR16(r[6], 0x1cb4);
+    }
+    AOT_GOTO(0x2c6e, L2c6e);
+L1cb4:
+    AOT_BLOCK(0x1cb4, 1);
+    // 1cb4: jmp *$1ece
+    {
+        a = 0x1ece;
+    }
+    AOT_GOTO(0x1ece, L1ece);
+L1cb8:
+    AOT_BLOCK(0x1cb8, 11);
+    // 1cb8: mov 4ff0, r3
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1cbc: mov 4ff2, r2
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1cc0: mov 3444, 4ff0
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = 0x4ff0;
+        WR16(b, src);
+    }
+    // 1cc6: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1cca: mov 3444, 4ff2
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = 0x4ff2;
+        WR16(b, src);
+    }
+    // 1cd0: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1cd4: mov 3444, r0
+    {
+        a = 0x3444;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1cd8: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1cdc: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1cde: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1ce2: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1ce6);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1ce6:
+    AOT_BLOCK(0x1ce6, 2);
+    // 1ce6: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1ce8: jsr pc, *$1a4a
+    {
+        a = 0x1a4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1cec);
+    }
+    AOT_GOTO(0x1a4a, L1a4a);
+L1cec:
+    AOT_BLOCK(0x1cec, 2);
+    // 1cec: mov 4ff0, (sp)
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cf0: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1cf4);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1cf4:
+    AOT_BLOCK(0x1cf4, 2);
+    // 1cf4: mov r3, 4ff0
+    {
+        src = r[3];
+        b = 0x4ff0;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cf8: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1cfc);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1cfc:
+    AOT_BLOCK(0x1cfc, 3);
+    // 1cfc: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1cfe: cmp $13, r4
+    {
+        src = uint16_t(0x0013);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d02: bne 1d30
+    if (!Z)
+        AOT_GOTO(0x1d30, L1d30);
+    AOT_GOTO(0x1d04, L1d04);
+L1d04:
+    AOT_BLOCK(0x1d04, 2);
+    // 1d04: cmp $17, 53f2
+    {
+        src = uint16_t(0x0017);
+        b = 0x53f2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d0a: bne 1d30
+    if (!Z)
+        AOT_GOTO(0x1d30, L1d30);
+    AOT_GOTO(0x1d0c, L1d0c);
+L1d0c:
+    AOT_BLOCK(0x1d0c, 3);
+    // 1d0c: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1d10: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d14: jsr pc, 0736
+    {
+        a = 0x0736;
+        r[6] -= 2;
+        WR16(r[6], 0x1d18);
+    }
+    AOT_GOTO(0x0736, L0736);
+L1d18:
+    AOT_BLOCK(0x1d18, 2);
+    // 1d18: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d1a: jsr pc, *$2b20
+    {
+        a = 0x2b20;
+        r[6] -= 2;
+        WR16(r[6], 0x1d1e);
+    }
+    AOT_GOTO(0x2b20, L2b20);
+L1d1e:
+    AOT_BLOCK(0x1d1e, 3);
+    // 1d1e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1d20: mov 4ff2, (sp)
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d24: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1d28);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1d28:
+    AOT_BLOCK(0x1d28, 2);
+    // 1d28: mov r2, 4ff2
+    {
+        src = r[2];
+        b = 0x4ff2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d2c: jmp *$1ece
+    {
+        a = 0x1ece;
+    }
+    AOT_GOTO(0x1ece, L1ece);
+L1d30:
+    AOT_BLOCK(0x1d30, 1);
+    // 1d30: jmp *$1eda
+    {
+        a = 0x1eda;
+    }
+    AOT_GOTO(0x1eda, L1eda);
+L1d34:
+    AOT_BLOCK(0x1d34, 1);
+    // 1d34: jsr pc, 1504
+    {
+        a = 0x1504;
+        r[6] -= 2;
+        WR16(r[6], 0x1d38);
+    }
+    AOT_GOTO(0x1504, L1504);
+L1d38:
+    AOT_BLOCK(0x1d38, 2);
+    // 1d38: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d3a: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1d3e);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1d3e:
+    AOT_BLOCK(0x1d3e, 3);
+    // 1d3e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1d40: cmp $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d44: beq 1d4a
+    if (Z)
+        AOT_GOTO(0x1d4a, L1d4a);
+    AOT_GOTO(0x1d46, L1d46);
+L1d46:
+    AOT_BLOCK(0x1d46, 1);
+    // 1d46: jmp *$1eda
+    {
+        a = 0x1eda;
+    }
+    AOT_GOTO(0x1eda, L1eda);
+L1d4a:
+    AOT_BLOCK(0x1d4a, 2);
+    // 1d4a: tst 4fee
+    {
+        a = 0x4fee;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1d4e: bne 1d5c
+    if (!Z)
+        AOT_GOTO(0x1d5c, L1d5c);
+    AOT_GOTO(0x1d50, L1d50);
+L1d50:
+    AOT_BLOCK(0x1d50, 2);
+    // 1d50: mov $3a86, (sp)
+    {
+        src = uint16_t(0x3a86);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d54: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1d58);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1d58:
+    AOT_BLOCK(0x1d58, 1);
+    // 1d58: jmp *$1a52
+    {
+        a = 0x1a52;
+    }
+    AOT_GOTO(0x1a52, L1a52);
+L1d5c:
+    AOT_BLOCK(0x1d5c, 2);
+    // 1d5c: cmp $4fee, 4fee
+    {
+        src = uint16_t(0x4fee);
+        b = 0x4fee;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d62: bhi 1d6e
+    if (!(C | Z))
+        AOT_GOTO(0x1d6e, L1d6e);
+    AOT_GOTO(0x1d64, L1d64);
+L1d64:
+    AOT_BLOCK(0x1d64, 2);
+    // 1d64: mov $3a99, (sp)
+    {
+        src = uint16_t(0x3a99);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d68: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1d6c);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1d6c:
+    AOT_BLOCK(0x1d6c, 1);
+    // 1d6c: br 1d8e
+    AOT_GOTO(0x1d8e, L1d8e);
+L1d6e:
+    AOT_BLOCK(0x1d6e, 7);
+    // 1d6e: mov 3444, *4fee
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = RD16(0x4fee);
+        WR16(b, src);
+    }
+    // 1d74: mov 4fee, r0
+    {
+        a = 0x4fee;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1d78: mov r3, 2(r0)
+    {
+        src = r[3];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 1d7c: add $4, 4fee
+    {
+        src = uint16_t(0x0004);
+        b = 0x4fee;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1d82: mov 3444, (sp)
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1d86: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1d8a: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1d8e);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1d8e:
+    AOT_BLOCK(0x1d8e, 1);
+    // 1d8e: jmp *$1a52
+    {
+        a = 0x1a52;
+    }
+    AOT_GOTO(0x1a52, L1a52);
+L1d92:
+    AOT_BLOCK(0x1d92, 4);
+    // 1d92: mov 4ff2, r3
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1d96: mov 3444, 4ff2
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = 0x4ff2;
+        WR16(b, src);
+    }
+    // 1d9c: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1da0: jsr pc, 2010
+    {
+        a = 0x2010;
+        r[6] -= 2;
+        WR16(r[6], 0x1da4);
+    }
+    AOT_GOTO(0x2010, L2010);
+L1da4:
+    AOT_BLOCK(0x1da4, 4);
+    // 1da4: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 1da8: mov $ffff, (sp)
+    {
+        src = uint16_t(0xffff);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1dac: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1db0: jsr pc, *$132a
+    {
+        a = 0x132a;
+        r[6] -= 2;
+        WR16(r[6], 0x1db4);
+    }
+    AOT_GOTO(0x132a, L132a);
+L1db4:
+    AOT_BLOCK(0x1db4, 7);
+    // 1db4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1db6: mov -c(r5), (sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1dba: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 1dbc: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1dbe: mov $6e, -(sp)
+    {
+        src = uint16_t(0x006e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1dc2: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dc6: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x1dca);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L1dca:
+    AOT_BLOCK(0x1dca, 3);
+    // 1dca: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1dce: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dd0: jsr pc, *$2b4a
+    {
+        a = 0x2b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1dd4);
+    }
+    AOT_GOTO(0x2b4a, L2b4a);
+L1dd4:
+    AOT_BLOCK(0x1dd4, 1);
+    // 1dd4: jsr pc, 204c
+    {
+        a = 0x204c;
+        r[6] -= 2;
+        WR16(r[6], 0x1dd8);
+    }
+    AOT_GOTO(0x204c, L204c);
+L1dd8:
+    AOT_BLOCK(0x1dd8, 2);
+    // 1dd8: mov r3, 4ff2
+    {
+        src = r[3];
+        b = 0x4ff2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ddc: jmp *$1ee8
+    {
+        a = 0x1ee8;
+    }
+    AOT_GOTO(0x1ee8, L1ee8);
+L1de0:
+    AOT_BLOCK(0x1de0, 2);
+    // 1de0: tst 4fee
+    {
+        a = 0x4fee;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1de4: bne 1dee
+    if (!Z)
+        AOT_GOTO(0x1dee, L1dee);
+    AOT_GOTO(0x1de6, L1de6);
+L1de6:
+    AOT_BLOCK(0x1de6, 2);
+    // 1de6: mov $3aaf, (sp)
+    {
+        src = uint16_t(0x3aaf);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dea: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1dee);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1dee:
+    AOT_BLOCK(0x1dee, 1);
+    // 1dee: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1df2);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1df2:
+    AOT_BLOCK(0x1df2, 3);
+    // 1df2: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1df4: cmp $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1df8: beq 1dfe
+    if (Z)
+        AOT_GOTO(0x1dfe, L1dfe);
+    AOT_GOTO(0x1dfa, L1dfa);
+L1dfa:
+    AOT_BLOCK(0x1dfa, 1);
+    // 1dfa: jmp *$1eda
+    {
+        a = 0x1eda;
+    }
+    AOT_GOTO(0x1eda, L1eda);
+L1dfe:
+    AOT_BLOCK(0x1dfe, 5);
+    // 1dfe: mov 3444, r0
+    {
+        a = 0x3444;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1e02: mov r0, 4ff6
+    {
+        src = r[0];
+        b = 0x4ff6;
+        WR16(b, src);
+    }
+    // 1e06: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e08: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1e0c: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1e10);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1e10:
+    AOT_BLOCK(0x1e10, 1);
+    // 1e10: jmp *$1a52
+    {
+        a = 0x1a52;
+    }
+    AOT_GOTO(0x1a52, L1a52);
+L1e14:
+    AOT_BLOCK(0x1e14, 7);
+    // 1e14: mov 4ff0, r3
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1e18: mov 4ff2, r2
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1e1c: mov 3444, 4ff0
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = 0x4ff0;
+        WR16(b, src);
+    }
+    // 1e22: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1e26: mov 3444, 4ff2
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = 0x4ff2;
+        WR16(b, src);
+    }
+    // 1e2c: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1e30: jsr pc, 1eec
+    {
+        a = 0x1eec;
+        r[6] -= 2;
+        WR16(r[6], 0x1e34);
+    }
+    AOT_GOTO(0x1eec, L1eec);
+L1e34:
+    AOT_BLOCK(0x1e34, 2);
+    // 1e34: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e36: bne 1eda
+    if (!Z)
+        AOT_GOTO(0x1eda, L1eda);
+    AOT_GOTO(0x1e38, L1e38);
+L1e38:
+    AOT_BLOCK(0x1e38, 2);
+    // 1e38: mov 4ff2, (sp)
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e3c: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1e40);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1e40:
+    AOT_BLOCK(0x1e40, 3);
+    // 1e40: mov r3, 4ff0
+    {
+        src = r[3];
+        b = 0x4ff0;
+        WR16(b, src);
+    }
+    // 1e44: mov r2, 4ff2
+    {
+        src = r[2];
+        b = 0x4ff2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e48: br 1ee8
+    AOT_GOTO(0x1ee8, L1ee8);
+L1e4c:
+    AOT_BLOCK(0x1e4c, 3);
+    // 1e4c: sub $14, r0
+    {
+        src = uint16_t(0x0014);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1e50: cmp r0, $b
+    {
+        src = r[0];
+        dst = uint16_t(0x000b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e54: bhi 1e5c
+    if (!(C | Z))
+        AOT_GOTO(0x1e5c, L1e5c);
+    AOT_GOTO(0x1e56, L1e56);
+L1e56:
+    AOT_BLOCK(0x1e56, 2);
+    // 1e56: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 1e58: jmp *3974(r0)
+    {
+        a = RD16(r[0] + 14708);
+    }
+    AOT_JUMP(a);
+L1e5c:
+    AOT_BLOCK(0x1e5c, 2);
+    // 1e5c: mov $3ac5, (sp)
+    {
+        src = uint16_t(0x3ac5);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e60: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1e64);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1e64:
+    AOT_BLOCK(0x1e64, 1);
+    // 1e64: br 1eda
+    AOT_GOTO(0x1eda, L1eda);
+L1e66:
+    AOT_BLOCK(0x1e66, 1);
+    // 1e66: jsr pc, 2e06
+    {
+        a = 0x2e06;
+        r[6] -= 2;
+        WR16(r[6], 0x1e6a);
+    }
+    AOT_GOTO(0x2e06, L2e06);
+L1e6a:
+    AOT_BLOCK(0x1e6a, 2);
+    // 1e6a: cmp $3a, r0
+    {
+        src = uint16_t(0x003a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e6e: bne 1eae
+    if (!Z)
+        AOT_GOTO(0x1eae, L1eae);
+    AOT_GOTO(0x1e70, L1e70);
+L1e70:
+    AOT_BLOCK(0x1e70, 4);
+    // 1e70: clr 4ffc
+    {
+        a = 0x4ffc;
+        WR16(a, 0);
+    }
+    // 1e74: mov 53f0, r3
+    {
+        a = 0x53f0;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1e78: tstb (r3)
+    {
+        a = r[3];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1e7a: ble 1e88
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1e88, L1e88);
+    AOT_GOTO(0x1e7c, L1e7c);
+L1e7c:
+    AOT_BLOCK(0x1e7c, 2);
+    // 1e7c: mov $3ad5, (sp)
+    {
+        src = uint16_t(0x3ad5);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e80: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1e84);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1e84:
+    AOT_BLOCK(0x1e84, 1);
+    // 1e84: jmp *$1a52
+    {
+        a = 0x1a52;
+    }
+    AOT_GOTO(0x1a52, L1a52);
+L1e88:
+    AOT_BLOCK(0x1e88, 4);
+    // 1e88: movb $d, (r3)
+    {
+        src = uint8_t(0x0d);
+        b = r[3];
+        WR8(b, src);
+    }
+    // 1e8c: mov $18, 2(r3)
+    {
+        src = uint16_t(0x0018);
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+    }
+    // 1e92: tst 6(r3)
+    {
+        a = uint16_t(r[3] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1e96: bne 1ea2
+    if (!Z)
+        AOT_GOTO(0x1ea2, L1ea2);
+    AOT_GOTO(0x1e98, L1e98);
+L1e98:
+    AOT_BLOCK(0x1e98, 2);
+    // 1e98: mov 3444, 6(r3)
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 1e9e: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1ea2, L1ea2);
+L1ea2:
+    AOT_BLOCK(0x1ea2, 2);
+    // 1ea2: mov 6(r3), (sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ea6: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1eaa);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1eaa:
+    AOT_BLOCK(0x1eaa, 1);
+    // 1eaa: jmp *$1a52
+    {
+        a = 0x1a52;
+    }
+    AOT_GOTO(0x1a52, L1a52);
+L1eae:
+    AOT_BLOCK(0x1eae, 1);
+    // 1eae: br 1ec0
+    AOT_GOTO(0x1ec0, L1ec0);
+L1eb0:
+    AOT_BLOCK(0x1eb0, 2);
+    // 1eb0: mov $398c, r1
+    {
+        src = uint16_t(0x398c);
+        r[1] = src;
+    }
+    // 1eb4: mov r0, 3996
+    {
+        src = r[0];
+        b = 0x3996;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1eb8, L1eb8);
+L1eb8:
+    AOT_BLOCK(0x1eb8, 2);
+    // 1eb8: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1eba: bne 1eb8
+    if (!Z)
+        AOT_GOTO(0x1eb8, L1eb8);
+    AOT_GOTO(0x1ebc, L1ebc);
+L1ebc:
+    AOT_BLOCK(0x1ebc, 1);
+    // 1ebc: jmp *a(r1)
+    {
+        a = RD16(r[1] + 10);
+    }
+    AOT_JUMP(a);
+L1ec0:
+    AOT_BLOCK(0x1ec0, 2);
+    // 1ec0: mov r4, 3448
+    {
+        src = r[4];
+        b = 0x3448;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ec4: jsr pc, 0736
+    {
+        a = 0x0736;
+        r[6] -= 2;
+        WR16(r[6], 0x1ec8);
+    }
+    AOT_GOTO(0x0736, L0736);
+L1ec8:
+    AOT_BLOCK(0x1ec8, 2);
+    // 1ec8: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1eca: jsr pc, *$2b4a
+    {
+        a = 0x2b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1ece);
+    }
+    AOT_GOTO(0x2b4a, L2b4a);
+L1ece:
+    AOT_BLOCK(0x1ece, 1);
+    // 1ece: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1ed2);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1ed2:
+    AOT_BLOCK(0x1ed2, 3);
+    // 1ed2: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1ed4: cmp $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ed8: beq 1ee8
+    if (Z)
+        AOT_GOTO(0x1ee8, L1ee8);
+    AOT_GOTO(0x1eda, L1eda);
+L1eda:
+    AOT_BLOCK(0x1eda, 2);
+    // 1eda: mov $3ae2, (sp)
+    {
+        src = uint16_t(0x3ae2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ede: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x1ee2);
+    }
+    AOT_GOTO(0x1388, L1388);
+L1ee2:
+    AOT_BLOCK(0x1ee2, 2);
+    // 1ee2: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ee4: jsr pc, *$22be
+    {
+        a = 0x22be;
+        r[6] -= 2;
+        WR16(r[6], 0x1ee8);
+    }
+    AOT_GOTO(0x22be, L22be);
+L1ee8:
+    AOT_BLOCK(0x1ee8, 2);
+    // 1ee8: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1eec:
+    AOT_BLOCK(0x1eec, 4);
+    // 1eec: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1ef0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1ef0: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 1ef4: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1ef8);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1ef8:
+    AOT_BLOCK(0x1ef8, 3);
+    // 1ef8: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1efa: cmp $6, r3
+    {
+        src = uint16_t(0x0006);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1efe: beq 1f06
+    if (Z)
+        AOT_GOTO(0x1f06, L1f06);
+    AOT_GOTO(0x1f00, L1f00);
+L1f00:
+    AOT_BLOCK(0x1f00, 2);
+    // 1f00: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f02: jmp *$200c
+    {
+        a = 0x200c;
+    }
+    AOT_GOTO(0x200c, L200c);
+L1f06:
+    AOT_BLOCK(0x1f06, 1);
+    // 1f06: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1f0a);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1f0a:
+    AOT_BLOCK(0x1f0a, 3);
+    // 1f0a: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1f0c: cmp $1, r3
+    {
+        src = uint16_t(0x0001);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f10: beq 1f30
+    if (Z)
+        AOT_GOTO(0x1f30, L1f30);
+    AOT_GOTO(0x1f12, L1f12);
+L1f12:
+    AOT_BLOCK(0x1f12, 2);
+    // 1f12: mov r3, 3448
+    {
+        src = r[3];
+        b = 0x3448;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f16: jsr pc, 0736
+    {
+        a = 0x0736;
+        r[6] -= 2;
+        WR16(r[6], 0x1f1a);
+    }
+    AOT_GOTO(0x0736, L0736);
+L1f1a:
+    AOT_BLOCK(0x1f1a, 2);
+    // 1f1a: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f1c: jsr pc, *$2b4a
+    {
+        a = 0x2b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1f20);
+    }
+    AOT_GOTO(0x2b4a, L2b4a);
+L1f20:
+    AOT_BLOCK(0x1f20, 1);
+    // 1f20: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1f24);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1f24:
+    AOT_BLOCK(0x1f24, 3);
+    // 1f24: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1f26: cmp $1, r3
+    {
+        src = uint16_t(0x0001);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f2a: beq 1f30
+    if (Z)
+        AOT_GOTO(0x1f30, L1f30);
+    AOT_GOTO(0x1f2c, L1f2c);
+L1f2c:
+    AOT_BLOCK(0x1f2c, 2);
+    // 1f2c: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f2e: br 200c
+    AOT_GOTO(0x200c, L200c);
+L1f30:
+    AOT_BLOCK(0x1f30, 2);
+    // 1f30: mov 4ff0, (sp)
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f34: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1f38);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1f38:
+    AOT_BLOCK(0x1f38, 1);
+    // 1f38: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1f3c);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1f3c:
+    AOT_BLOCK(0x1f3c, 3);
+    // 1f3c: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1f3e: cmp $1, r3
+    {
+        src = uint16_t(0x0001);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f42: beq 1f7a
+    if (Z)
+        AOT_GOTO(0x1f7a, L1f7a);
+    AOT_GOTO(0x1f44, L1f44);
+L1f44:
+    AOT_BLOCK(0x1f44, 4);
+    // 1f44: mov r3, 3448
+    {
+        src = r[3];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 1f48: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1f4a: mov 4ff2, -(sp)
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f4e: jsr pc, 0736
+    {
+        a = 0x0736;
+        r[6] -= 2;
+        WR16(r[6], 0x1f52);
+    }
+    AOT_GOTO(0x0736, L0736);
+L1f52:
+    AOT_BLOCK(0x1f52, 4);
+    // 1f52: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1f54: mov $67, -(sp)
+    {
+        src = uint16_t(0x0067);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1f58: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f5c: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x1f60);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L1f60:
+    AOT_BLOCK(0x1f60, 3);
+    // 1f60: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1f64: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f66: jsr pc, *$2b4a
+    {
+        a = 0x2b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1f6a);
+    }
+    AOT_GOTO(0x2b4a, L2b4a);
+L1f6a:
+    AOT_BLOCK(0x1f6a, 1);
+    // 1f6a: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1f6e);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1f6e:
+    AOT_BLOCK(0x1f6e, 3);
+    // 1f6e: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1f70: cmp $1, r3
+    {
+        src = uint16_t(0x0001);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f74: beq 1f7a
+    if (Z)
+        AOT_GOTO(0x1f7a, L1f7a);
+    AOT_GOTO(0x1f76, L1f76);
+L1f76:
+    AOT_BLOCK(0x1f76, 2);
+    // 1f76: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f78: br 200c
+    AOT_GOTO(0x200c, L200c);
+L1f7a:
+    AOT_BLOCK(0x1f7a, 1);
+    // 1f7a: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1f7e);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1f7e:
+    AOT_BLOCK(0x1f7e, 3);
+    // 1f7e: mov r0, 3448
+    {
+        src = r[0];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 1f82: cmp $7, r0
+    {
+        src = uint16_t(0x0007);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f86: bne 1fa0
+    if (!Z)
+        AOT_GOTO(0x1fa0, L1fa0);
+    AOT_GOTO(0x1f88, L1f88);
+L1f88:
+    AOT_BLOCK(0x1f88, 3);
+    // 1f88: mov $ffff, 3448
+    {
+        src = uint16_t(0xffff);
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 1f8e: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1f90: jsr pc, *$1a4a
+    {
+        a = 0x1a4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1f94);
+    }
+    AOT_GOTO(0x1a4a, L1a4a);
+L1f94:
+    AOT_BLOCK(0x1f94, 2);
+    // 1f94: mov 4ff0, (sp)
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f98: jsr pc, *$2c6e
+    {
+        a = 0x2c6e;
+        r[6] -= 2;
+        WR16(r[6], 0x1f9c);
+    }
+    AOT_GOTO(0x2c6e, L2c6e);
+L1f9c:
+    AOT_BLOCK(0x1f9c, 2);
+    // 1f9c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1f9e: br 200c
+    AOT_GOTO(0x200c, L200c);
+L1fa0:
+    AOT_BLOCK(0x1fa0, 4);
+    // 1fa0: mov 4ff0, r4
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1fa4: mov 3444, 4ff0
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = 0x4ff0;
+        WR16(b, src);
+    }
+    // 1faa: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1fae: jsr pc, 0736
+    {
+        a = 0x0736;
+        r[6] -= 2;
+        WR16(r[6], 0x1fb2);
+    }
+    AOT_GOTO(0x0736, L0736);
+L1fb2:
+    AOT_BLOCK(0x1fb2, 3);
+    // 1fb2: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 1fb6: mov 344a, r2
+    {
+        a = 0x344a;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fba: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x1fbe);
+    }
+    AOT_GOTO(0x0246, L0246);
+L1fbe:
+    AOT_BLOCK(0x1fbe, 3);
+    // 1fbe: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1fc0: cmp $7, r3
+    {
+        src = uint16_t(0x0007);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1fc4: beq 1fca
+    if (Z)
+        AOT_GOTO(0x1fca, L1fca);
+    AOT_GOTO(0x1fc6, L1fc6);
+L1fc6:
+    AOT_BLOCK(0x1fc6, 2);
+    // 1fc6: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fc8: br 200c
+    AOT_GOTO(0x200c, L200c);
+L1fca:
+    AOT_BLOCK(0x1fca, 4);
+    // 1fca: mov 345c, -a(r5)
+    {
+        a = 0x345c;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1fd0: mov 4c7a, 345c
+    {
+        a = 0x4c7a;
+        src = RD16(a);
+        b = 0x345c;
+        WR16(b, src);
+    }
+    // 1fd6: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1fd8: jsr pc, *$1a4a
+    {
+        a = 0x1a4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1fdc);
+    }
+    AOT_GOTO(0x1a4a, L1a4a);
+L1fdc:
+    AOT_BLOCK(0x1fdc, 4);
+    // 1fdc: mov 344a, -8(r5)
+    {
+        a = 0x344a;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1fe2: mov r2, 344a
+    {
+        src = r[2];
+        b = 0x344a;
+        WR16(b, src);
+    }
+    // 1fe6: mov 4ff0, (sp)
+    {
+        a = 0x4ff0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fea: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x1fee);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L1fee:
+    AOT_BLOCK(0x1fee, 2);
+    // 1fee: mov -c(r5), (sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ff2: jsr pc, *$2b4a
+    {
+        a = 0x2b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1ff6);
+    }
+    AOT_GOTO(0x2b4a, L2b4a);
+L1ff6:
+    AOT_BLOCK(0x1ff6, 4);
+    // 1ff6: mov -8(r5), 344a
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0x344a;
+        WR16(b, src);
+    }
+    // 1ffc: mov -a(r5), 345c
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = 0x345c;
+        WR16(b, src);
+    }
+    // 2002: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2004: jsr pc, *$2c6e
+    {
+        a = 0x2c6e;
+        r[6] -= 2;
+        WR16(r[6], 0x2008);
+    }
+    AOT_GOTO(0x2c6e, L2c6e);
+L2008:
+    AOT_BLOCK(0x2008, 2);
+    // 2008: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 200a: br 200c
+    AOT_GOTO(0x200c, L200c);
+L200c:
+    AOT_BLOCK(0x200c, 2);
+    // 200c: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2010:
+    AOT_BLOCK(0x2010, 3);
+    // 2010: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2014;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2014: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x2018);
+    }
+    AOT_GOTO(0x0246, L0246);
+L2018:
+    AOT_BLOCK(0x2018, 3);
+    // 2018: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 201a: cmp $6, r4
+    {
+        src = uint16_t(0x0006);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 201e: bne 2036
+    if (!Z)
+        AOT_GOTO(0x2036, L2036);
+    AOT_GOTO(0x2020, L2020);
+L2020:
+    AOT_BLOCK(0x2020, 1);
+    // 2020: jsr pc, 0736
+    {
+        a = 0x0736;
+        r[6] -= 2;
+        WR16(r[6], 0x2024);
+    }
+    AOT_GOTO(0x0736, L0736);
+L2024:
+    AOT_BLOCK(0x2024, 2);
+    // 2024: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2026: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x202a);
+    }
+    AOT_GOTO(0x0246, L0246);
+L202a:
+    AOT_BLOCK(0x202a, 3);
+    // 202a: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 202c: cmp $7, r4
+    {
+        src = uint16_t(0x0007);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2030: bne 2036
+    if (!Z)
+        AOT_GOTO(0x2036, L2036);
+    AOT_GOTO(0x2032, L2032);
+L2032:
+    AOT_BLOCK(0x2032, 2);
+    // 2032: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2034: br 2048
+    AOT_GOTO(0x2048, L2048);
+L2036:
+    AOT_BLOCK(0x2036, 1);
+    // 2036: mov $3af3, (sp)
+    {
+        src = uint16_t(0x3af3);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x203a, L203a);
+L203a:
+    AOT_BLOCK(0x203a, 1);
+    // 203a: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x203e);
+    }
+    AOT_GOTO(0x1388, L1388);
+L203e:
+    AOT_BLOCK(0x203e, 2);
+    // 203e: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2040: jsr pc, *$22be
+    {
+        a = 0x22be;
+        r[6] -= 2;
+        WR16(r[6], 0x2044);
+    }
+    AOT_GOTO(0x22be, L22be);
+L2044:
+    AOT_BLOCK(0x2044, 2);
+    // 2044: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2046: br 2048
+    AOT_GOTO(0x2048, L2048);
+L2048:
+    AOT_BLOCK(0x2048, 2);
+    // 2048: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L204c:
+    AOT_BLOCK(0x204c, 7);
+    // 204c: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2050;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2050: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 2054: mov 4fee, r3
+    {
+        a = 0x4fee;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 2058: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+    }
+    // 205a: tst 4fee
+    {
+        a = 0x4fee;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 205e: bne 206a
+    if (!Z)
+        AOT_GOTO(0x206a, L206a);
+    AOT_GOTO(0x2060, L2060);
+L2060:
+    AOT_BLOCK(0x2060, 1);
+    // 2060: mov $4cce, r0
+    {
+        src = uint16_t(0x4cce);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2064, L2064);
+L2064:
+    AOT_BLOCK(0x2064, 1);
+    // 2064: mov r0, 4fee
+    {
+        src = r[0];
+        b = 0x4fee;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2068, L2068);
+L2068:
+    AOT_BLOCK(0x2068, 1);
+    // 2068: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x206a, L206a);
+L206a:
+    AOT_BLOCK(0x206a, 1);
+    // 206a: mov 3444, r0
+    {
+        a = 0x3444;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x206e, L206e);
+L206e:
+    AOT_BLOCK(0x206e, 1);
+    // 206e: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2072, L2072);
+L2072:
+    AOT_BLOCK(0x2072, 1);
+    // 2072: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2074, L2074);
+L2074:
+    AOT_BLOCK(0x2074, 2);
+    // 2074: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 2078: jsr pc, *$2c6e
+    {
+        a = 0x2c6e;
+        r[6] -= 2;
+        WR16(r[6], 0x207c);
+    }
+    AOT_GOTO(0x2c6e, L2c6e);
+L207c:
+    AOT_BLOCK(0x207c, 4);
+    // 207c: mov 4ff6, -8(r5)
+    {
+        a = 0x4ff6;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 2082: clr 4ff6
+    {
+        a = 0x4ff6;
+        WR16(a, 0);
+    }
+    // 2086: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2088: jsr pc, *$1a4a
+    {
+        a = 0x1a4a;
+        r[6] -= 2;
+        WR16(r[6], 0x208c);
+    }
+    AOT_GOTO(0x1a4a, L1a4a);
+L208c:
+    AOT_BLOCK(0x208c, 2);
+    // 208c: mov 4ff2, (sp)
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2090: jsr pc, *$2c6e
+    {
+        a = 0x2c6e;
+        r[6] -= 2;
+        WR16(r[6], 0x2094);
+    }
+    AOT_GOTO(0x2c6e, L2c6e);
+L2094:
+    AOT_BLOCK(0x2094, 2);
+    // 2094: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2098: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x209c);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L209c:
+    AOT_BLOCK(0x209c, 2);
+    // 209c: tst 4ff6
+    {
+        a = 0x4ff6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 20a0: bne 20a8
+    if (!Z)
+        AOT_GOTO(0x20a8, L20a8);
+    AOT_GOTO(0x20a2, L20a2);
+L20a2:
+    AOT_BLOCK(0x20a2, 1);
+    // 20a2: mov 4ff2, 4ff6
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        b = 0x4ff6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x20a8, L20a8);
+L20a8:
+    AOT_BLOCK(0x20a8, 5);
+    // 20a8: mov 344a, (sp)
+    {
+        a = 0x344a;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 20ac: mov 4ff6, -(sp)
+    {
+        a = 0x4ff6;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 20b0: mov $d5, -(sp)
+    {
+        src = uint16_t(0x00d5);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 20b4: mov $3b04, -(sp)
+    {
+        src = uint16_t(0x3b04);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20b8: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x20bc);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L20bc:
+    AOT_BLOCK(0x20bc, 1);
+    // 20bc: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x20c0, L20c0);
+L20c0:
+    AOT_BLOCK(0x20c0, 2);
+    // 20c0: cmp 4fee, r4
+    {
+        a = 0x4fee;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 20c4: blos 20dc
+    if (C | Z)
+        AOT_GOTO(0x20dc, L20dc);
+    AOT_GOTO(0x20c6, L20c6);
+L20c6:
+    AOT_BLOCK(0x20c6, 4);
+    // 20c6: mov 2(r4), (sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 20ca: mov (r4), -(sp)
+    {
+        a = r[4];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 20cc: mov $3b08, -(sp)
+    {
+        src = uint16_t(0x3b08);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20d0: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x20d4);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L20d4:
+    AOT_BLOCK(0x20d4, 3);
+    // 20d4: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 20d6: add $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 20da: br 20c0
+    AOT_GOTO(0x20c0, L20c0);
+L20dc:
+    AOT_BLOCK(0x20dc, 2);
+    // 20dc: mov $3b0b, (sp)
+    {
+        src = uint16_t(0x3b0b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20e0: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x20e4);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L20e4:
+    AOT_BLOCK(0x20e4, 2);
+    // 20e4: mov 4ff2, (sp)
+    {
+        a = 0x4ff2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20e8: jsr pc, *$2c88
+    {
+        a = 0x2c88;
+        r[6] -= 2;
+        WR16(r[6], 0x20ec);
+    }
+    AOT_GOTO(0x2c88, L2c88);
+L20ec:
+    AOT_BLOCK(0x20ec, 4);
+    // 20ec: mov -8(r5), 4ff6
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0x4ff6;
+        WR16(b, src);
+    }
+    // 20f2: mov r3, 4fee
+    {
+        src = r[3];
+        b = 0x4fee;
+        WR16(b, src);
+    }
+    // 20f6: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L20fa:
+    AOT_BLOCK(0x20fa, 5);
+    // 20fa: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x20fe;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 20fe: mov $6, 4ffa
+    {
+        src = uint16_t(0x0006);
+        b = 0x4ffa;
+        WR16(b, src);
+    }
+    // 2104: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2106: jsr pc, *$22dc
+    {
+        a = 0x22dc;
+        r[6] -= 2;
+        WR16(r[6], 0x210a);
+    }
+    AOT_GOTO(0x22dc, L22dc);
+L210a:
+    AOT_BLOCK(0x210a, 1);
+    // 210a: mov $4, r4
+    {
+        src = uint16_t(0x0004);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x210e, L210e);
+L210e:
+    AOT_BLOCK(0x210e, 2);
+    // 210e: tst 5400
+    {
+        a = 0x5400;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2112: beq 2162
+    if (Z)
+        AOT_GOTO(0x2162, L2162);
+    AOT_GOTO(0x2114, L2114);
+L2114:
+    AOT_BLOCK(0x2114, 7);
+    // 2114: mov 5402, r0
+    {
+        a = 0x5402;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2118: clr 6(r0)
+    {
+        a = uint16_t(r[0] + 6);
+        WR16(a, 0);
+    }
+    // 211c: mov 5400, r3
+    {
+        a = 0x5400;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 2120: mov 5400, r0
+    {
+        a = 0x5400;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2124: mov 6(r0), 5400
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = 0x5400;
+        WR16(b, src);
+    }
+    // 212a: cmp $2, 2(r3)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2130: bne 2138
+    if (!Z)
+        AOT_GOTO(0x2138, L2138);
+    AOT_GOTO(0x2132, L2132);
+L2132:
+    AOT_BLOCK(0x2132, 1);
+    // 2132: mov $3, 2(r3)
+    {
+        src = uint16_t(0x0003);
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2138, L2138);
+L2138:
+    AOT_BLOCK(0x2138, 6);
+    // 2138: mov r4, 6(r3)
+    {
+        src = r[4];
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 213c: movb $b, (r3)
+    {
+        src = uint8_t(0x0b);
+        b = r[3];
+        WR8(b, src);
+    }
+    // 2140: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2144: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2148: cmp $18, r0
+    {
+        src = uint16_t(0x0018);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 214c: bne 2158
+    if (!Z)
+        AOT_GOTO(0x2158, L2158);
+    AOT_GOTO(0x214e, L214e);
+L214e:
+    AOT_BLOCK(0x214e, 2);
+    // 214e: sub $10, 2(r3)
+    {
+        src = uint16_t(0x0010);
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[3] + 2);
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 2154: incb 4(r3)
+    {
+        a = uint16_t(r[3] + 4);
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x80;
+    }
+    AOT_GOTO(0x2158, L2158);
+L2158:
+    AOT_BLOCK(0x2158, 2);
+    // 2158: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 215a: jsr pc, *$2d88
+    {
+        a = 0x2d88;
+        r[6] -= 2;
+        WR16(r[6], 0x215e);
+    }
+    AOT_GOTO(0x2d88, L2d88);
+L215e:
+    AOT_BLOCK(0x215e, 2);
+    // 215e: add r0, r4
+    {
+        src = r[0];
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2160: br 210e
+    AOT_GOTO(0x210e, L210e);
+L2162:
+    AOT_BLOCK(0x2162, 1);
+    // 2162: mov $3ffa, r3
+    {
+        src = uint16_t(0x3ffa);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2166, L2166);
+L2166:
+    AOT_BLOCK(0x2166, 2);
+    // 2166: cmp $4c7a, r3
+    {
+        src = uint16_t(0x4c7a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 216a: blos 21f8
+    if (C | Z)
+        AOT_GOTO(0x21f8, L21f8);
+    AOT_GOTO(0x216c, L216c);
+L216c:
+    AOT_BLOCK(0x216c, 2);
+    // 216c: tstb 8(r3)
+    {
+        a = uint16_t(r[3] + 8);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2170: beq 21f2
+    if (Z)
+        AOT_GOTO(0x21f2, L21f2);
+    AOT_GOTO(0x2172, L2172);
+L2172:
+    AOT_BLOCK(0x2172, 2);
+    // 2172: cmpb $1, (r3)
+    {
+        src = uint8_t(0x01);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2176: bge 21aa
+    if (!(N ^ V))
+        AOT_GOTO(0x21aa, L21aa);
+    AOT_GOTO(0x2178, L2178);
+L2178:
+    AOT_BLOCK(0x2178, 4);
+    // 2178: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 217c: bic $fff8, r0
+    {
+        src = uint16_t(0xfff8);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2180: cmp $5, r0
+    {
+        src = uint16_t(0x0005);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2184: bne 21aa
+    if (!Z)
+        AOT_GOTO(0x21aa, L21aa);
+    AOT_GOTO(0x2186, L2186);
+L2186:
+    AOT_BLOCK(0x2186, 9);
+    // 2186: movb 5(r3), r0
+    {
+        a = uint16_t(r[3] + 5);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 218a: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 218e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 2190: mov 540c(r0), r0
+    {
+        a = uint16_t(r[0] + 21516);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2194: movb 5(r0), 5(r3)
+    {
+        a = uint16_t(r[0] + 5);
+        src = RD8(a);
+        b = uint16_t(r[3] + 5);
+        WR8(b, src);
+    }
+    // 219a: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 219e: bic $7, r0
+    {
+        src = uint16_t(0x0007);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 21a2: bis $4, r0
+    {
+        src = uint16_t(0x0004);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 21a6: mov r0, 2(r3)
+    {
+        src = r[0];
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x21aa, L21aa);
+L21aa:
+    AOT_BLOCK(0x21aa, 2);
+    // 21aa: cmpb $f, (r3)
+    {
+        src = uint8_t(0x0f);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 21ae: bne 21d0
+    if (!Z)
+        AOT_GOTO(0x21d0, L21d0);
+    AOT_GOTO(0x21b0, L21b0);
+L21b0:
+    AOT_BLOCK(0x21b0, 5);
+    // 21b0: movb 5(r3), r0
+    {
+        a = uint16_t(r[3] + 5);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 21b4: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 21b8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 21ba: tst 540c(r0)
+    {
+        a = uint16_t(r[0] + 21516);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 21be: bne 21d0
+    if (!Z)
+        AOT_GOTO(0x21d0, L21d0);
+    AOT_GOTO(0x21c0, L21c0);
+L21c0:
+    AOT_BLOCK(0x21c0, 4);
+    // 21c0: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 21c2: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 21c6: mov $3b0d, -(sp)
+    {
+        src = uint16_t(0x3b0d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21ca: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x21ce);
+    }
+    AOT_GOTO(0x1388, L1388);
+L21ce:
+    AOT_BLOCK(0x21ce, 1);
+    // 21ce: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x21d0, L21d0);
+L21d0:
+    AOT_BLOCK(0x21d0, 2);
+    // 21d0: cmpb $10, (r3)
+    {
+        src = uint8_t(0x10);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 21d4: bne 21e6
+    if (!Z)
+        AOT_GOTO(0x21e6, L21e6);
+    AOT_GOTO(0x21d6, L21d6);
+L21d6:
+    AOT_BLOCK(0x21d6, 4);
+    // 21d6: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 21d8: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 21dc: mov $3b27, -(sp)
+    {
+        src = uint16_t(0x3b27);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21e0: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x21e4);
+    }
+    AOT_GOTO(0x1388, L1388);
+L21e4:
+    AOT_BLOCK(0x21e4, 1);
+    // 21e4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x21e6, L21e6);
+L21e6:
+    AOT_BLOCK(0x21e6, 2);
+    // 21e6: tst 3446
+    {
+        a = 0x3446;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 21ea: beq 21f2
+    if (Z)
+        AOT_GOTO(0x21f2, L21f2);
+    AOT_GOTO(0x21ec, L21ec);
+L21ec:
+    AOT_BLOCK(0x21ec, 2);
+    // 21ec: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21ee: jsr pc, *$2270
+    {
+        a = 0x2270;
+        r[6] -= 2;
+        WR16(r[6], 0x21f2);
+    }
+    AOT_GOTO(0x2270, L2270);
+L21f2:
+    AOT_BLOCK(0x21f2, 2);
+    // 21f2: add $10, r3
+    {
+        src = uint16_t(0x0010);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 21f6: br 2166
+    AOT_GOTO(0x2166, L2166);
+L21f8:
+    AOT_BLOCK(0x21f8, 5);
+    // 21f8: mov 345c, 4c7a
+    {
+        a = 0x345c;
+        src = RD16(a);
+        b = 0x4c7a;
+        WR16(b, src);
+    }
+    // 21fe: mov 58e0, (sp)
+    {
+        a = 0x58e0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2202: mov $69, -(sp)
+    {
+        src = uint16_t(0x0069);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2206: mov $3b3d, -(sp)
+    {
+        src = uint16_t(0x3b3d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 220a: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x220e);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L220e:
+    AOT_BLOCK(0x220e, 3);
+    // 220e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 2210: mov 4ffa, r0
+    {
+        a = 0x4ffa;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2214: br 2216
+    AOT_GOTO(0x2216, L2216);
+L2216:
+    AOT_BLOCK(0x2216, 2);
+    // 2216: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L221a:
+    AOT_BLOCK(0x221a, 3);
+    // 221a: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x221e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 221e: mov $3ffa, r4
+    {
+        src = uint16_t(0x3ffa);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2222, L2222);
+L2222:
+    AOT_BLOCK(0x2222, 2);
+    // 2222: cmp $4c7a, r4
+    {
+        src = uint16_t(0x4c7a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2226: blos 226c
+    if (C | Z)
+        AOT_GOTO(0x226c, L226c);
+    AOT_GOTO(0x2228, L2228);
+L2228:
+    AOT_BLOCK(0x2228, 2);
+    // 2228: tstb 8(r4)
+    {
+        a = uint16_t(r[4] + 8);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 222c: beq 2266
+    if (Z)
+        AOT_GOTO(0x2266, L2266);
+    AOT_GOTO(0x222e, L222e);
+L222e:
+    AOT_BLOCK(0x222e, 2);
+    // 222e: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2230: bne 2250
+    if (!Z)
+        AOT_GOTO(0x2250, L2250);
+    AOT_GOTO(0x2232, L2232);
+L2232:
+    AOT_BLOCK(0x2232, 2);
+    // 2232: bitb $2, 1(r4)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2238: bne 2250
+    if (!Z)
+        AOT_GOTO(0x2250, L2250);
+    AOT_GOTO(0x223a, L223a);
+L223a:
+    AOT_BLOCK(0x223a, 4);
+    // 223a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 223c: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2240: mov $3b40, -(sp)
+    {
+        src = uint16_t(0x3b40);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2244: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2248);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2248:
+    AOT_BLOCK(0x2248, 2);
+    // 2248: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 224a: bisb $2, 1(r4)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2250, L2250);
+L2250:
+    AOT_BLOCK(0x2250, 2);
+    // 2250: bitb $1, 1(r4)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2256: bne 2266
+    if (!Z)
+        AOT_GOTO(0x2266, L2266);
+    AOT_GOTO(0x2258, L2258);
+L2258:
+    AOT_BLOCK(0x2258, 3);
+    // 2258: clrb 8(r4)
+    {
+        a = uint16_t(r[4] + 8);
+        WR8(a, 0);
+        C = false;
+    }
+    // 225c: dec 3ff8
+    {
+        a = 0x3ff8;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 2260: bicb $12, 1(r4)
+    {
+        src = uint8_t(0x12);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2266, L2266);
+L2266:
+    AOT_BLOCK(0x2266, 2);
+    // 2266: add $10, r4
+    {
+        src = uint16_t(0x0010);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 226a: br 2222
+    AOT_GOTO(0x2222, L2222);
+L226c:
+    AOT_BLOCK(0x226c, 2);
+    // 226c: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2270:
+    AOT_BLOCK(0x2270, 5);
+    // 2270: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2274;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2274: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2278: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 227a: br 2292
+    AOT_GOTO(0x2292, L2292);
+L227c:
+    AOT_BLOCK(0x227c, 2);
+    // 227c: mov $d8, r3
+    {
+        src = uint16_t(0x00d8);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2280: br 22a2
+    AOT_GOTO(0x22a2, L22a2);
+L2282:
+    AOT_BLOCK(0x2282, 2);
+    // 2282: mov $d9, r3
+    {
+        src = uint16_t(0x00d9);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2286: br 22a2
+    AOT_GOTO(0x22a2, L22a2);
+L2288:
+    AOT_BLOCK(0x2288, 2);
+    // 2288: mov $d7, r3
+    {
+        src = uint16_t(0x00d7);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 228c: br 22a2
+    AOT_GOTO(0x22a2, L22a2);
+L228e:
+    AOT_BLOCK(0x228e, 1);
+    // 228e: br 22ba
+    AOT_GOTO(0x22ba, L22ba);
+L2292:
+    AOT_BLOCK(0x2292, 3);
+    // 2292: sub $b, r0
+    {
+        src = uint16_t(0x000b);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 2296: cmp r0, $3
+    {
+        src = r[0];
+        dst = uint16_t(0x0003);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 229a: bhi 228e
+    if (!(C | Z))
+        AOT_GOTO(0x228e, L228e);
+    AOT_GOTO(0x229c, L229c);
+L229c:
+    AOT_BLOCK(0x229c, 2);
+    // 229c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 229e: jmp *39a4(r0)
+    {
+        a = RD16(r[0] + 14756);
+    }
+    AOT_JUMP(a);
+L22a2:
+    AOT_BLOCK(0x22a2, 6);
+    // 22a2: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 22a6: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 22a8: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 22ac: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 22ae: mov $3b4f, -(sp)
+    {
+        src = uint16_t(0x3b4f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22b2: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x22b6);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L22b6:
+    AOT_BLOCK(0x22b6, 1);
+    // 22b6: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x22ba, L22ba);
+L22ba:
+    AOT_BLOCK(0x22ba, 2);
+    // 22ba: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L22be:
+    AOT_BLOCK(0x22be, 3);
+    // 22be: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x22c2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 22c2: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x22c6, L22c6);
+L22c6:
+    AOT_BLOCK(0x22c6, 2);
+    // 22c6: cmp $3, r4
+    {
+        src = uint16_t(0x0003);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 22ca: bge 22d4
+    if (!(N ^ V))
+        AOT_GOTO(0x22d4, L22d4);
+    AOT_GOTO(0x22cc, L22cc);
+L22cc:
+    AOT_BLOCK(0x22cc, 1);
+    // 22cc: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x22d0);
+    }
+    AOT_GOTO(0x0246, L0246);
+L22d0:
+    AOT_BLOCK(0x22d0, 2);
+    // 22d0: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22d2: br 22c6
+    AOT_GOTO(0x22c6, L22c6);
+L22d4:
+    AOT_BLOCK(0x22d4, 3);
+    // 22d4: mov r4, 3448
+    {
+        src = r[4];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 22d8: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L22dc:
+    AOT_BLOCK(0x22dc, 5);
+    // 22dc: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x22e0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 22e0: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 22e2: clr r2
+    {
+        r[2] = 0;
+        C = false;
+    }
+    // 22e4: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x22e8, L22e8);
+L22e8:
+    AOT_BLOCK(0x22e8, 5);
+    // 22e8: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 22ea: add $fff8, (sp)
+    {
+        src = uint16_t(0xfff8);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 22ee: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 22f0: add $4, (sp)
+    {
+        src = uint16_t(0x0004);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 22f4: jsr pc, *$2332
+    {
+        a = 0x2332;
+        r[6] -= 2;
+        WR16(r[6], 0x22f8);
+    }
+    AOT_GOTO(0x2332, L2332);
+L22f8:
+    AOT_BLOCK(0x22f8, 4);
+    // 22f8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 22fa: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 22fc: cmp $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2300: beq 231e
+    if (Z)
+        AOT_GOTO(0x231e, L231e);
+    AOT_GOTO(0x2302, L2302);
+L2302:
+    AOT_BLOCK(0x2302, 5);
+    // 2302: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2304: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2306: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 230a: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 230e: jsr pc, *$2560
+    {
+        a = 0x2560;
+        r[6] -= 2;
+        WR16(r[6], 0x2312);
+    }
+    AOT_GOTO(0x2560, L2560);
+L2312:
+    AOT_BLOCK(0x2312, 4);
+    // 2312: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 2316: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 2318: mov r4, 4(r5)
+    {
+        src = r[4];
+        b = uint16_t(r[5] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 231c: br 22e8
+    AOT_GOTO(0x22e8, L22e8);
+L231e:
+    AOT_BLOCK(0x231e, 4);
+    // 231e: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 2320: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2322: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2324: jsr pc, *$29ce
+    {
+        a = 0x29ce;
+        r[6] -= 2;
+        WR16(r[6], 0x2328);
+    }
+    AOT_GOTO(0x29ce, L29ce);
+L2328:
+    AOT_BLOCK(0x2328, 3);
+    // 2328: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 232a: add r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 232c: br 232e
+    AOT_GOTO(0x232e, L232e);
+L232e:
+    AOT_BLOCK(0x232e, 2);
+    // 232e: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2332:
+    AOT_BLOCK(0x2332, 10);
+    // 2332: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2336;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2336: sub $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 233a: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+    }
+    // 233e: clr r2
+    {
+        r[2] = 0;
+    }
+    // 2340: mov $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        r[3] = src;
+    }
+    // 2344: mov *4(r5), r4
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2348: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+    }
+    // 234c: cmp $a, r4
+    {
+        src = uint16_t(0x000a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2350: beq 2356
+    if (Z)
+        AOT_GOTO(0x2356, L2356);
+    AOT_GOTO(0x2352, L2352);
+L2352:
+    AOT_BLOCK(0x2352, 2);
+    // 2352: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2354: br 235a
+    AOT_GOTO(0x235a, L235a);
+L2356:
+    AOT_BLOCK(0x2356, 1);
+    // 2356: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x235a, L235a);
+L235a:
+    AOT_BLOCK(0x235a, 1);
+    // 235a: mov r0, -e(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x235e, L235e);
+L235e:
+    AOT_BLOCK(0x235e, 2);
+    // 235e: mov -e(r5), 5406
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        b = 0x5406;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2364: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x2368);
+    }
+    AOT_GOTO(0x0246, L0246);
+L2368:
+    AOT_BLOCK(0x2368, 3);
+    // 2368: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 236c: cmp $13, r0
+    {
+        src = uint16_t(0x0013);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2370: bne 2378
+    if (!Z)
+        AOT_GOTO(0x2378, L2378);
+    AOT_GOTO(0x2372, L2372);
+L2372:
+    AOT_BLOCK(0x2372, 2);
+    // 2372: mov 53f2, r0
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2376: br 237c
+    AOT_GOTO(0x237c, L237c);
+L2378:
+    AOT_BLOCK(0x2378, 1);
+    // 2378: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x237c, L237c);
+L237c:
+    AOT_BLOCK(0x237c, 1);
+    // 237c: br 241e
+    AOT_GOTO(0x241e, L241e);
+L237e:
+    AOT_BLOCK(0x237e, 2);
+    // 237e: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2380: beq 2390
+    if (Z)
+        AOT_GOTO(0x2390, L2390);
+    AOT_GOTO(0x2382, L2382);
+L2382:
+    AOT_BLOCK(0x2382, 2);
+    // 2382: cmp 53f2, r4
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2386: beq 2390
+    if (Z)
+        AOT_GOTO(0x2390, L2390);
+    AOT_GOTO(0x2388, L2388);
+L2388:
+    AOT_BLOCK(0x2388, 2);
+    // 2388: mov $3b88, (sp)
+    {
+        src = uint16_t(0x3b88);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 238c: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2390);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2390:
+    AOT_BLOCK(0x2390, 2);
+    // 2390: mov 53f2, r4
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2394: br 242a
+    AOT_GOTO(0x242a, L242a);
+L2396:
+    AOT_BLOCK(0x2396, 2);
+    // 2396: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 2398: br 242a
+    AOT_GOTO(0x242a, L242a);
+L239a:
+    AOT_BLOCK(0x239a, 5);
+    // 239a: mov $4, -8(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 23a0: mov -e(r5), (sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 23a4: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 23a6: add $fff8, (sp)
+    {
+        src = uint16_t(0xfff8);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 23aa: jsr pc, *$2434
+    {
+        a = 0x2434;
+        r[6] -= 2;
+        WR16(r[6], 0x23ae);
+    }
+    AOT_GOTO(0x2434, L2434);
+L23ae:
+    AOT_BLOCK(0x23ae, 3);
+    // 23ae: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 23b0: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 23b4: mov -8(r5), 53f2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0x53f2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x23ba, L23ba);
+L23ba:
+    AOT_BLOCK(0x23ba, 2);
+    // 23ba: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 23bc: blt 23c6
+    if (N ^ V)
+        AOT_GOTO(0x23c6, L23c6);
+    AOT_GOTO(0x23be, L23be);
+L23be:
+    AOT_BLOCK(0x23be, 2);
+    // 23be: mov $3ba2, (sp)
+    {
+        src = uint16_t(0x3ba2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23c2: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x23c6);
+    }
+    AOT_GOTO(0x1388, L1388);
+L23c6:
+    AOT_BLOCK(0x23c6, 2);
+    // 23c6: mov 53f2, r3
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23ca: br 242a
+    AOT_GOTO(0x242a, L242a);
+L23cc:
+    AOT_BLOCK(0x23cc, 3);
+    // 23cc: mov -8(r5), 3448
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 23d2: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 23d6: bne 23de
+    if (!Z)
+        AOT_GOTO(0x23de, L23de);
+    AOT_GOTO(0x23d8, L23d8);
+L23d8:
+    AOT_BLOCK(0x23d8, 2);
+    // 23d8: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23dc: br 2430
+    AOT_GOTO(0x2430, L2430);
+L23de:
+    AOT_BLOCK(0x23de, 2);
+    // 23de: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 23e0: bge 23e4
+    if (!(N ^ V))
+        AOT_GOTO(0x23e4, L23e4);
+    AOT_GOTO(0x23e2, L23e2);
+L23e2:
+    AOT_BLOCK(0x23e2, 1);
+    // 23e2: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x23e4, L23e4);
+L23e4:
+    AOT_BLOCK(0x23e4, 2);
+    // 23e4: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 23e6: bne 23ec
+    if (!Z)
+        AOT_GOTO(0x23ec, L23ec);
+    AOT_GOTO(0x23e8, L23e8);
+L23e8:
+    AOT_BLOCK(0x23e8, 1);
+    // 23e8: mov $b, r4
+    {
+        src = uint16_t(0x000b);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x23ec, L23ec);
+L23ec:
+    AOT_BLOCK(0x23ec, 2);
+    // 23ec: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 23ee: beq 240e
+    if (Z)
+        AOT_GOTO(0x240e, L240e);
+    AOT_GOTO(0x23f0, L23f0);
+L23f0:
+    AOT_BLOCK(0x23f0, 2);
+    // 23f0: cmp $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 23f4: bne 23fc
+    if (!Z)
+        AOT_GOTO(0x23fc, L23fc);
+    AOT_GOTO(0x23f6, L23f6);
+L23f6:
+    AOT_BLOCK(0x23f6, 2);
+    // 23f6: mov $3, r3
+    {
+        src = uint16_t(0x0003);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23fa: br 240e
+    AOT_GOTO(0x240e, L240e);
+L23fc:
+    AOT_BLOCK(0x23fc, 2);
+    // 23fc: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 23fe: bne 2406
+    if (!Z)
+        AOT_GOTO(0x2406, L2406);
+    AOT_GOTO(0x2400, L2400);
+L2400:
+    AOT_BLOCK(0x2400, 2);
+    // 2400: mov $6, r3
+    {
+        src = uint16_t(0x0006);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2404: br 240e
+    AOT_GOTO(0x240e, L240e);
+L2406:
+    AOT_BLOCK(0x2406, 2);
+    // 2406: mov $3bad, (sp)
+    {
+        src = uint16_t(0x3bad);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 240a: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x240e);
+    }
+    AOT_GOTO(0x1388, L1388);
+L240e:
+    AOT_BLOCK(0x240e, 4);
+    // 240e: mov r4, *4(r5)
+    {
+        src = r[4];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+    }
+    // 2412: mov r3, *6(r5)
+    {
+        src = r[3];
+        b = RD16(r[5] + 6);
+        WR16(b, src);
+    }
+    // 2416: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 241a: br 2430
+    AOT_GOTO(0x2430, L2430);
+L241e:
+    AOT_BLOCK(0x241e, 2);
+    // 241e: cmp r0, $e
+    {
+        src = r[0];
+        dst = uint16_t(0x000e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2422: bhi 23cc
+    if (!(C | Z))
+        AOT_GOTO(0x23cc, L23cc);
+    AOT_GOTO(0x2424, L2424);
+L2424:
+    AOT_BLOCK(0x2424, 2);
+    // 2424: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 2426: jmp *3b54(r0)
+    {
+        a = RD16(r[0] + 15188);
+    }
+    AOT_JUMP(a);
+L242a:
+    AOT_BLOCK(0x242a, 2);
+    // 242a: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 242e: br 235e
+    AOT_GOTO(0x235e, L235e);
+L2430:
+    AOT_BLOCK(0x2430, 2);
+    // 2430: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2434:
+    AOT_BLOCK(0x2434, 6);
+    // 2434: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2438;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2438: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 243c: mov $1, 5406
+    {
+        src = uint16_t(0x0001);
+        b = 0x5406;
+        WR16(b, src);
+    }
+    // 2442: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2444: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x2448);
+    }
+    AOT_GOTO(0x0246, L0246);
+L2448:
+    AOT_BLOCK(0x2448, 3);
+    // 2448: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 244a: cmp $14, r3
+    {
+        src = uint16_t(0x0014);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 244e: bne 248a
+    if (!Z)
+        AOT_GOTO(0x248a, L248a);
+    AOT_GOTO(0x2450, L2450);
+L2450:
+    AOT_BLOCK(0x2450, 3);
+    // 2450: mov 53f0, r2
+    {
+        a = 0x53f0;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2454: tstb (r2)
+    {
+        a = r[2];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2456: bne 2474
+    if (!Z)
+        AOT_GOTO(0x2474, L2474);
+    AOT_GOTO(0x2458, L2458);
+L2458:
+    AOT_BLOCK(0x2458, 3);
+    // 2458: movb $f, (r2)
+    {
+        src = uint8_t(0x0f);
+        b = r[2];
+        WR8(b, src);
+    }
+    // 245c: movb 344e, 5(r2)
+    {
+        a = 0x344e;
+        src = RD8(a);
+        b = uint16_t(r[2] + 5);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 2462: jsr pc, 2540
+    {
+        a = 0x2540;
+        r[6] -= 2;
+        WR16(r[6], 0x2466);
+    }
+    AOT_GOTO(0x2540, L2540);
+L2466:
+    AOT_BLOCK(0x2466, 4);
+    // 2466: mov 344e, r0
+    {
+        a = 0x344e;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 246a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 246c: inc 344e
+    {
+        a = 0x344e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 2470: clr 540c(r0)
+    {
+        a = uint16_t(r[0] + 21516);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2474, L2474);
+L2474:
+    AOT_BLOCK(0x2474, 2);
+    // 2474: cmpb $f, (r2)
+    {
+        src = uint8_t(0x0f);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2478: beq 247e
+    if (Z)
+        AOT_GOTO(0x247e, L247e);
+    AOT_GOTO(0x247a, L247a);
+L247a:
+    AOT_BLOCK(0x247a, 1);
+    // 247a: jsr pc, 2ab0
+    {
+        a = 0x2ab0;
+        r[6] -= 2;
+        WR16(r[6], 0x247e);
+    }
+    AOT_GOTO(0x2ab0, L2ab0);
+L247e:
+    AOT_BLOCK(0x247e, 2);
+    // 247e: mov 6(r5), 5406
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x5406;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2484: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x2488);
+    }
+    AOT_GOTO(0x0246, L0246);
+L2488:
+    AOT_BLOCK(0x2488, 1);
+    // 2488: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x248a, L248a);
+L248a:
+    AOT_BLOCK(0x248a, 3);
+    // 248a: clr 5406
+    {
+        a = 0x5406;
+        WR16(a, 0);
+    }
+    // 248e: cmp $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2492: beq 24d0
+    if (Z)
+        AOT_GOTO(0x24d0, L24d0);
+    AOT_GOTO(0x2494, L2494);
+L2494:
+    AOT_BLOCK(0x2494, 2);
+    // 2494: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2496: bne 24a2
+    if (!Z)
+        AOT_GOTO(0x24a2, L24a2);
+    AOT_GOTO(0x2498, L2498);
+L2498:
+    AOT_BLOCK(0x2498, 2);
+    // 2498: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 249a: jsr pc, *$2a98
+    {
+        a = 0x2a98;
+        r[6] -= 2;
+        WR16(r[6], 0x249e);
+    }
+    AOT_GOTO(0x2a98, L2a98);
+L249e:
+    AOT_BLOCK(0x249e, 2);
+    // 249e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 24a0: br 253c
+    AOT_GOTO(0x253c, L253c);
+L24a2:
+    AOT_BLOCK(0x24a2, 2);
+    // 24a2: cmpb $f, (r2)
+    {
+        src = uint8_t(0x0f);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 24a6: beq 24b0
+    if (Z)
+        AOT_GOTO(0x24b0, L24b0);
+    AOT_GOTO(0x24a8, L24a8);
+L24a8:
+    AOT_BLOCK(0x24a8, 2);
+    // 24a8: mov $3bbe, (sp)
+    {
+        src = uint16_t(0x3bbe);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24ac: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x24b0);
+    }
+    AOT_GOTO(0x1388, L1388);
+L24b0:
+    AOT_BLOCK(0x24b0, 6);
+    // 24b0: movb 5(r2), r0
+    {
+        a = uint16_t(r[2] + 5);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 24b4: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 24b8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 24ba: mov 540c(r0), r4
+    {
+        a = uint16_t(r[0] + 21516);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 24be: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 24c0: bne 24ca
+    if (!Z)
+        AOT_GOTO(0x24ca, L24ca);
+    AOT_GOTO(0x24c2, L24c2);
+L24c2:
+    AOT_BLOCK(0x24c2, 2);
+    // 24c2: mov $5, *4(r5)
+    {
+        src = uint16_t(0x0005);
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+    }
+    // 24c8: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x24ca, L24ca);
+L24ca:
+    AOT_BLOCK(0x24ca, 2);
+    // 24ca: mov r3, 3448
+    {
+        src = r[3];
+        b = 0x3448;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24ce: br 2538
+    AOT_GOTO(0x2538, L2538);
+L24d0:
+    AOT_BLOCK(0x24d0, 6);
+    // 24d0: mov 53e8, -a(r5)
+    {
+        a = 0x53e8;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 24d6: clr 5406
+    {
+        a = 0x5406;
+        WR16(a, 0);
+    }
+    // 24da: mov 58e2, -8(r5)
+    {
+        a = 0x58e2;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 24e0: clr 58e2
+    {
+        a = 0x58e2;
+        WR16(a, 0);
+        C = false;
+    }
+    // 24e4: mov $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24e8: jsr pc, *$22dc
+    {
+        a = 0x22dc;
+        r[6] -= 2;
+        WR16(r[6], 0x24ec);
+    }
+    AOT_GOTO(0x22dc, L22dc);
+L24ec:
+    AOT_BLOCK(0x24ec, 4);
+    // 24ec: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 24ee: mov -8(r5), 58e2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0x58e2;
+        WR16(b, src);
+    }
+    // 24f4: mov -a(r5), 53e8
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = 0x53e8;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24fa: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x24fe);
+    }
+    AOT_GOTO(0x0246, L0246);
+L24fe:
+    AOT_BLOCK(0x24fe, 1);
+    // 24fe: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2500, L2500);
+L2500:
+    AOT_BLOCK(0x2500, 2);
+    // 2500: cmp $3, r3
+    {
+        src = uint16_t(0x0003);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2504: bne 2498
+    if (!Z)
+        AOT_GOTO(0x2498, L2498);
+    AOT_GOTO(0x2506, L2506);
+L2506:
+    AOT_BLOCK(0x2506, 2);
+    // 2506: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2508: beq 2538
+    if (Z)
+        AOT_GOTO(0x2538, L2538);
+    AOT_GOTO(0x250a, L250a);
+L250a:
+    AOT_BLOCK(0x250a, 5);
+    // 250a: movb 5(r2), r0
+    {
+        a = uint16_t(r[2] + 5);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 250e: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2512: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2514: tst 540c(r0)
+    {
+        a = uint16_t(r[0] + 21516);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2518: beq 252a
+    if (Z)
+        AOT_GOTO(0x252a, L252a);
+    AOT_GOTO(0x251a, L251a);
+L251a:
+    AOT_BLOCK(0x251a, 4);
+    // 251a: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 251c: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2520: mov $3bd1, -(sp)
+    {
+        src = uint16_t(0x3bd1);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2524: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2528);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2528:
+    AOT_BLOCK(0x2528, 1);
+    // 2528: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x252a, L252a);
+L252a:
+    AOT_BLOCK(0x252a, 4);
+    // 252a: movb 5(r2), r0
+    {
+        a = uint16_t(r[2] + 5);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 252e: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2532: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 2534: mov r4, 540c(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 21516);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2538, L2538);
+L2538:
+    AOT_BLOCK(0x2538, 2);
+    // 2538: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 253a: br 253c
+    AOT_GOTO(0x253c, L253c);
+L253c:
+    AOT_BLOCK(0x253c, 2);
+    // 253c: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2540:
+    AOT_BLOCK(0x2540, 4);
+    // 2540: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2544;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2544: cmp $64, 344e
+    {
+        src = uint16_t(0x0064);
+        b = 0x344e;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 254a: bgt 255c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x255c, L255c);
+    AOT_GOTO(0x254c, L254c);
+L254c:
+    AOT_BLOCK(0x254c, 2);
+    // 254c: mov $3be1, (sp)
+    {
+        src = uint16_t(0x3be1);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2550: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2554);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2554:
+    AOT_BLOCK(0x2554, 2);
+    // 2554: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2558: jsr pc, *$3410
+    {
+        a = 0x3410;
+        r[6] -= 2;
+        WR16(r[6], 0x255c);
+    }
+    AOT_GOTO(0x3410, L3410);
+L255c:
+    AOT_BLOCK(0x255c, 2);
+    // 255c: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2560:
+    AOT_BLOCK(0x2560, 3);
+    // 2560: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2564;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2564: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2568, L2568);
+L2568:
+    AOT_BLOCK(0x2568, 5);
+    // 2568: mov a(r5), (sp)
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 256c: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2570: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2574: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2576: jsr pc, *$25b0
+    {
+        a = 0x25b0;
+        r[6] -= 2;
+        WR16(r[6], 0x257a);
+    }
+    AOT_GOTO(0x25b0, L25b0);
+L257a:
+    AOT_BLOCK(0x257a, 3);
+    // 257a: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 257e: add r0, 8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2582: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x2586);
+    }
+    AOT_GOTO(0x0246, L0246);
+L2586:
+    AOT_BLOCK(0x2586, 3);
+    // 2586: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 2588: cmp $9, r4
+    {
+        src = uint16_t(0x0009);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 258c: beq 2568
+    if (Z)
+        AOT_GOTO(0x2568, L2568);
+    AOT_GOTO(0x258e, L258e);
+L258e:
+    AOT_BLOCK(0x258e, 2);
+    // 258e: cmp $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2592: beq 25a0
+    if (Z)
+        AOT_GOTO(0x25a0, L25a0);
+    AOT_GOTO(0x2594, L2594);
+L2594:
+    AOT_BLOCK(0x2594, 2);
+    // 2594: cmp $7, r4
+    {
+        src = uint16_t(0x0007);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2598: bne 25a6
+    if (!Z)
+        AOT_GOTO(0x25a6, L25a6);
+    AOT_GOTO(0x259a, L259a);
+L259a:
+    AOT_BLOCK(0x259a, 2);
+    // 259a: cmp $11, r3
+    {
+        src = uint16_t(0x0011);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 259e: bne 25a6
+    if (!Z)
+        AOT_GOTO(0x25a6, L25a6);
+    AOT_GOTO(0x25a0, L25a0);
+L25a0:
+    AOT_BLOCK(0x25a0, 2);
+    // 25a0: mov 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25a4: br 25ac
+    AOT_GOTO(0x25ac, L25ac);
+L25a6:
+    AOT_BLOCK(0x25a6, 2);
+    // 25a6: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25a8: jsr pc, *$2a98
+    {
+        a = 0x2a98;
+        r[6] -= 2;
+        WR16(r[6], 0x25ac);
+    }
+    AOT_GOTO(0x2a98, L2a98);
+L25ac:
+    AOT_BLOCK(0x25ac, 2);
+    // 25ac: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L25b0:
+    AOT_BLOCK(0x25b0, 7);
+    // 25b0: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x25b4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 25b4: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 25b8: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 25bc: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+    }
+    // 25c0: cmp $a, r3
+    {
+        src = uint16_t(0x000a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 25c4: beq 25ca
+    if (Z)
+        AOT_GOTO(0x25ca, L25ca);
+    AOT_GOTO(0x25c6, L25c6);
+L25c6:
+    AOT_BLOCK(0x25c6, 2);
+    // 25c6: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 25c8: br 25ce
+    AOT_GOTO(0x25ce, L25ce);
+L25ca:
+    AOT_BLOCK(0x25ca, 1);
+    // 25ca: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x25ce, L25ce);
+L25ce:
+    AOT_BLOCK(0x25ce, 2);
+    // 25ce: mov r0, 5406
+    {
+        src = r[0];
+        b = 0x5406;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25d2: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x25d6);
+    }
+    AOT_GOTO(0x0246, L0246);
+L25d6:
+    AOT_BLOCK(0x25d6, 3);
+    // 25d6: mov r0, 3448
+    {
+        src = r[0];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 25da: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 25de: beq 25e8
+    if (Z)
+        AOT_GOTO(0x25e8, L25e8);
+    AOT_GOTO(0x25e0, L25e0);
+L25e0:
+    AOT_BLOCK(0x25e0, 2);
+    // 25e0: cmp $7, 3448
+    {
+        src = uint16_t(0x0007);
+        b = 0x3448;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 25e6: bne 25ee
+    if (!Z)
+        AOT_GOTO(0x25ee, L25ee);
+    AOT_GOTO(0x25e8, L25e8);
+L25e8:
+    AOT_BLOCK(0x25e8, 2);
+    // 25e8: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 25ea: jmp *$2880
+    {
+        a = 0x2880;
+    }
+    AOT_GOTO(0x2880, L2880);
+L25ee:
+    AOT_BLOCK(0x25ee, 2);
+    // 25ee: cmp $8, 3448
+    {
+        src = uint16_t(0x0008);
+        b = 0x3448;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 25f4: bne 262e
+    if (!Z)
+        AOT_GOTO(0x262e, L262e);
+    AOT_GOTO(0x25f6, L25f6);
+L25f6:
+    AOT_BLOCK(0x25f6, 2);
+    // 25f6: cmp $a, r3
+    {
+        src = uint16_t(0x000a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 25fa: bne 262e
+    if (!Z)
+        AOT_GOTO(0x262e, L262e);
+    AOT_GOTO(0x25fc, L25fc);
+L25fc:
+    AOT_BLOCK(0x25fc, 2);
+    // 25fc: mov $ffff, 3448
+    {
+        src = uint16_t(0xffff);
+        b = 0x3448;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2602: jsr pc, 1504
+    {
+        a = 0x1504;
+        r[6] -= 2;
+        WR16(r[6], 0x2606);
+    }
+    AOT_GOTO(0x1504, L1504);
+L2606:
+    AOT_BLOCK(0x2606, 5);
+    // 2606: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 260a: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 260e: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2612: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2616: jsr pc, *$29ce
+    {
+        a = 0x29ce;
+        r[6] -= 2;
+        WR16(r[6], 0x261a);
+    }
+    AOT_GOTO(0x29ce, L29ce);
+L261a:
+    AOT_BLOCK(0x261a, 5);
+    // 261a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 261c: mov r0, a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 10);
+        WR16(b, src);
+    }
+    // 2620: add -8(r5), 58e2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0x58e2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2626: mov a(r5), r0
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 262a: jmp *$2880
+    {
+        a = 0x2880;
+    }
+    AOT_GOTO(0x2880, L2880);
+L262e:
+    AOT_BLOCK(0x262e, 1);
+    // 262e: jsr pc, 2884
+    {
+        a = 0x2884;
+        r[6] -= 2;
+        WR16(r[6], 0x2632);
+    }
+    AOT_GOTO(0x2884, L2884);
+L2632:
+    AOT_BLOCK(0x2632, 2);
+    // 2632: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2636: bge 263c
+    if (!(N ^ V))
+        AOT_GOTO(0x263c, L263c);
+    AOT_GOTO(0x2638, L2638);
+L2638:
+    AOT_BLOCK(0x2638, 1);
+    // 2638: jmp *$287a
+    {
+        a = 0x287a;
+    }
+    AOT_GOTO(0x287a, L287a);
+L263c:
+    AOT_BLOCK(0x263c, 1);
+    // 263c: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x263e, L263e);
+L263e:
+    AOT_BLOCK(0x263e, 11);
+    // 263e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2640: ash $2, r0
+    {
+        src = uint16_t(0x0002) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 2644: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2648: bic $ffe7, r1
+    {
+        src = uint16_t(0xffe7);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 264c: bis r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 264e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 2650: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2654: ash $fffe, r0
+    {
+        src = uint16_t(0xfffe) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 2658: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 265c: bit $18, r0
+    {
+        src = uint16_t(0x0018);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2660: bne 263e
+    if (!Z)
+        AOT_GOTO(0x263e, L263e);
+    AOT_GOTO(0x2662, L2662);
+L2662:
+    AOT_BLOCK(0x2662, 4);
+    // 2662: bis 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[4];
+        val = src | dst;
+        r[4] = val;
+    }
+    // 2666: mov 53e8, r2
+    {
+        a = 0x53e8;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 266a: tstb (r2)
+    {
+        a = r[2];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 266c: beq 26ae
+    if (Z)
+        AOT_GOTO(0x26ae, L26ae);
+    AOT_GOTO(0x266e, L266e);
+L266e:
+    AOT_BLOCK(0x266e, 2);
+    // 266e: cmp $10, r3
+    {
+        src = uint16_t(0x0010);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2672: bne 267a
+    if (!Z)
+        AOT_GOTO(0x267a, L267a);
+    AOT_GOTO(0x2674, L2674);
+L2674:
+    AOT_BLOCK(0x2674, 2);
+    // 2674: cmpb $11, (r2)
+    {
+        src = uint8_t(0x11);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2678: beq 26ae
+    if (Z)
+        AOT_GOTO(0x26ae, L26ae);
+    AOT_GOTO(0x267a, L267a);
+L267a:
+    AOT_BLOCK(0x267a, 2);
+    // 267a: cmp $c, r3
+    {
+        src = uint16_t(0x000c);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 267e: bne 268c
+    if (!Z)
+        AOT_GOTO(0x268c, L268c);
+    AOT_GOTO(0x2680, L2680);
+L2680:
+    AOT_BLOCK(0x2680, 2);
+    // 2680: cmpb $c, (r2)
+    {
+        src = uint8_t(0x0c);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2684: bne 268c
+    if (!Z)
+        AOT_GOTO(0x268c, L268c);
+    AOT_GOTO(0x2686, L2686);
+L2686:
+    AOT_BLOCK(0x2686, 2);
+    // 2686: cmp r4, 2(r2)
+    {
+        src = r[4];
+        b = uint16_t(r[2] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 268a: beq 26ae
+    if (Z)
+        AOT_GOTO(0x26ae, L26ae);
+    AOT_GOTO(0x268c, L268c);
+L268c:
+    AOT_BLOCK(0x268c, 2);
+    // 268c: cmp $a, r3
+    {
+        src = uint16_t(0x000a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2690: bne 26a6
+    if (!Z)
+        AOT_GOTO(0x26a6, L26a6);
+    AOT_GOTO(0x2692, L2692);
+L2692:
+    AOT_BLOCK(0x2692, 2);
+    // 2692: cmpb $a, (r2)
+    {
+        src = uint8_t(0x0a);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2696: bne 26a6
+    if (!Z)
+        AOT_GOTO(0x26a6, L26a6);
+    AOT_GOTO(0x2698, L2698);
+L2698:
+    AOT_BLOCK(0x2698, 2);
+    // 2698: cmp r4, 2(r2)
+    {
+        src = r[4];
+        b = uint16_t(r[2] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 269c: bne 26a6
+    if (!Z)
+        AOT_GOTO(0x26a6, L26a6);
+    AOT_GOTO(0x269e, L269e);
+L269e:
+    AOT_BLOCK(0x269e, 2);
+    // 269e: mov $1, -a(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26a4: br 26ae
+    AOT_GOTO(0x26ae, L26ae);
+L26a6:
+    AOT_BLOCK(0x26a6, 1);
+    // 26a6: jsr pc, 2ab0
+    {
+        a = 0x2ab0;
+        r[6] -= 2;
+        WR16(r[6], 0x26aa);
+    }
+    AOT_GOTO(0x2ab0, L2ab0);
+L26aa:
+    AOT_BLOCK(0x26aa, 1);
+    // 26aa: jmp *$287a
+    {
+        a = 0x287a;
+    }
+    AOT_GOTO(0x287a, L287a);
+L26ae:
+    AOT_BLOCK(0x26ae, 3);
+    // 26ae: mov r4, 2(r2)
+    {
+        src = r[4];
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 26b2: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 26b4: beq 26b8
+    if (Z)
+        AOT_GOTO(0x26b8, L26b8);
+    AOT_GOTO(0x26b6, L26b6);
+L26b6:
+    AOT_BLOCK(0x26b6, 1);
+    // 26b6: movb r3, (r2)
+    {
+        src = uint8_t(r[3]);
+        b = r[2];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x26b8, L26b8);
+L26b8:
+    AOT_BLOCK(0x26b8, 2);
+    // 26b8: cmp $11, r3
+    {
+        src = uint16_t(0x0011);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 26bc: bne 26d6
+    if (!Z)
+        AOT_GOTO(0x26d6, L26d6);
+    AOT_GOTO(0x26be, L26be);
+L26be:
+    AOT_BLOCK(0x26be, 2);
+    // 26be: tst 5400
+    {
+        a = 0x5400;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 26c2: bne 26ca
+    if (!Z)
+        AOT_GOTO(0x26ca, L26ca);
+    AOT_GOTO(0x26c4, L26c4);
+L26c4:
+    AOT_BLOCK(0x26c4, 2);
+    // 26c4: mov r2, 5400
+    {
+        src = r[2];
+        b = 0x5400;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26c8: br 26d2
+    AOT_GOTO(0x26d2, L26d2);
+L26ca:
+    AOT_BLOCK(0x26ca, 2);
+    // 26ca: mov 5402, r0
+    {
+        a = 0x5402;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 26ce: mov r2, 6(r0)
+    {
+        src = r[2];
+        b = uint16_t(r[0] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x26d2, L26d2);
+L26d2:
+    AOT_BLOCK(0x26d2, 1);
+    // 26d2: mov r2, 5402
+    {
+        src = r[2];
+        b = 0x5402;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x26d6, L26d6);
+L26d6:
+    AOT_BLOCK(0x26d6, 2);
+    // 26d6: tst a(r5)
+    {
+        a = uint16_t(r[5] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 26da: beq 270e
+    if (Z)
+        AOT_GOTO(0x270e, L270e);
+    AOT_GOTO(0x26dc, L26dc);
+L26dc:
+    AOT_BLOCK(0x26dc, 4);
+    // 26dc: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 26de: bic $fff8, r0
+    {
+        src = uint16_t(0xfff8);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 26e2: cmp $5, r0
+    {
+        src = uint16_t(0x0005);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 26e6: beq 26f4
+    if (Z)
+        AOT_GOTO(0x26f4, L26f4);
+    AOT_GOTO(0x26e8, L26e8);
+L26e8:
+    AOT_BLOCK(0x26e8, 4);
+    // 26e8: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 26ea: bic $fff8, r0
+    {
+        src = uint16_t(0xfff8);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 26ee: cmp $4, r0
+    {
+        src = uint16_t(0x0004);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 26f2: bne 270e
+    if (!Z)
+        AOT_GOTO(0x270e, L270e);
+    AOT_GOTO(0x26f4, L26f4);
+L26f4:
+    AOT_BLOCK(0x26f4, 2);
+    // 26f4: movb 344e, 5(r2)
+    {
+        a = 0x344e;
+        src = RD8(a);
+        b = uint16_t(r[2] + 5);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 26fa: jsr pc, 2540
+    {
+        a = 0x2540;
+        r[6] -= 2;
+        WR16(r[6], 0x26fe);
+    }
+    AOT_GOTO(0x2540, L2540);
+L26fe:
+    AOT_BLOCK(0x26fe, 4);
+    // 26fe: mov 344e, r0
+    {
+        a = 0x344e;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2702: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 2704: inc 344e
+    {
+        a = 0x344e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 2708: mov a(r5), 540c(r0)
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        b = uint16_t(r[0] + 21516);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x270e, L270e);
+L270e:
+    AOT_BLOCK(0x270e, 3);
+    // 270e: clr a(r5)
+    {
+        a = uint16_t(r[5] + 10);
+        WR16(a, 0);
+    }
+    // 2712: cmp $a, r3
+    {
+        src = uint16_t(0x000a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2716: bne 27ba
+    if (!Z)
+        AOT_GOTO(0x27ba, L27ba);
+    AOT_GOTO(0x2718, L2718);
+L2718:
+    AOT_BLOCK(0x2718, 2);
+    // 2718: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 271a: jsr pc, *$2cdc
+    {
+        a = 0x2cdc;
+        r[6] -= 2;
+        WR16(r[6], 0x271e);
+    }
+    AOT_GOTO(0x2cdc, L2cdc);
+L271e:
+    AOT_BLOCK(0x271e, 3);
+    // 271e: mov r0, a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 10);
+        WR16(b, src);
+    }
+    // 2722: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2726: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x272a);
+    }
+    AOT_GOTO(0x0246, L0246);
+L272a:
+    AOT_BLOCK(0x272a, 3);
+    // 272a: mov r0, 3448
+    {
+        src = r[0];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 272e: cmp $8, r0
+    {
+        src = uint16_t(0x0008);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2732: bne 274c
+    if (!Z)
+        AOT_GOTO(0x274c, L274c);
+    AOT_GOTO(0x2734, L2734);
+L2734:
+    AOT_BLOCK(0x2734, 3);
+    // 2734: clr a(r5)
+    {
+        a = uint16_t(r[5] + 10);
+        WR16(a, 0);
+        C = false;
+    }
+    // 2738: mov $ffff, 3448
+    {
+        src = uint16_t(0xffff);
+        b = 0x3448;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 273e: jsr pc, 1504
+    {
+        a = 0x1504;
+        r[6] -= 2;
+        WR16(r[6], 0x2742);
+    }
+    AOT_GOTO(0x1504, L1504);
+L2742:
+    AOT_BLOCK(0x2742, 2);
+    // 2742: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 2746: bisb $10, 1(r2)
+    {
+        src = uint8_t(0x10);
+        b = uint16_t(r[2] + 1);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x274c, L274c);
+L274c:
+    AOT_BLOCK(0x274c, 4);
+    // 274c: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2750: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2754: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2756: jsr pc, *$29ce
+    {
+        a = 0x29ce;
+        r[6] -= 2;
+        WR16(r[6], 0x275a);
+    }
+    AOT_GOTO(0x29ce, L29ce);
+L275a:
+    AOT_BLOCK(0x275a, 6);
+    // 275a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 275c: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 2760: add -c(r5), a(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = uint16_t(r[5] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 2766: add -c(r5), 8(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 276c: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2770: beq 27a2
+    if (Z)
+        AOT_GOTO(0x27a2, L27a2);
+    AOT_GOTO(0x2772, L2772);
+L2772:
+    AOT_BLOCK(0x2772, 2);
+    // 2772: tst -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2776: beq 2790
+    if (Z)
+        AOT_GOTO(0x2790, L2790);
+    AOT_GOTO(0x2778, L2778);
+L2778:
+    AOT_BLOCK(0x2778, 3);
+    // 2778: movb 5(r2), r0
+    {
+        a = uint16_t(r[2] + 5);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 277c: cmp 58e2, r0
+    {
+        a = 0x58e2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2780: bne 278c
+    if (!Z)
+        AOT_GOTO(0x278c, L278c);
+    AOT_GOTO(0x2782, L2782);
+L2782:
+    AOT_BLOCK(0x2782, 3);
+    // 2782: movb 4(r2), r0
+    {
+        a = uint16_t(r[2] + 4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2786: cmp -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 278a: beq 2790
+    if (Z)
+        AOT_GOTO(0x2790, L2790);
+    AOT_GOTO(0x278c, L278c);
+L278c:
+    AOT_BLOCK(0x278c, 1);
+    // 278c: jsr pc, 2ab0
+    {
+        a = 0x2ab0;
+        r[6] -= 2;
+        WR16(r[6], 0x2790);
+    }
+    AOT_GOTO(0x2ab0, L2ab0);
+L2790:
+    AOT_BLOCK(0x2790, 3);
+    // 2790: movb 58e2, 5(r2)
+    {
+        a = 0x58e2;
+        src = RD8(a);
+        b = uint16_t(r[2] + 5);
+        WR8(b, src);
+    }
+    // 2796: movb -8(r5), 4(r2)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD8(a);
+        b = uint16_t(r[2] + 4);
+        WR8(b, src);
+    }
+    // 279c: add -8(r5), 58e2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0x58e2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x27a2, L27a2);
+L27a2:
+    AOT_BLOCK(0x27a2, 2);
+    // 27a2: tst -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 27a6: beq 27b4
+    if (Z)
+        AOT_GOTO(0x27b4, L27b4);
+    AOT_GOTO(0x27a8, L27a8);
+L27a8:
+    AOT_BLOCK(0x27a8, 2);
+    // 27a8: cmp 8(r5), 6(r2)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = uint16_t(r[2] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 27ae: beq 27b4
+    if (Z)
+        AOT_GOTO(0x27b4, L27b4);
+    AOT_GOTO(0x27b0, L27b0);
+L27b0:
+    AOT_BLOCK(0x27b0, 1);
+    // 27b0: jsr pc, 2ab0
+    {
+        a = 0x2ab0;
+        r[6] -= 2;
+        WR16(r[6], 0x27b4);
+    }
+    AOT_GOTO(0x2ab0, L2ab0);
+L27b4:
+    AOT_BLOCK(0x27b4, 1);
+    // 27b4: mov 8(r5), 6(r2)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = uint16_t(r[2] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x27ba, L27ba);
+L27ba:
+    AOT_BLOCK(0x27ba, 4);
+    // 27ba: mov 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 27be: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 27c2: cmp $10, r0
+    {
+        src = uint16_t(0x0010);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 27c6: bne 27e0
+    if (!Z)
+        AOT_GOTO(0x27e0, L27e0);
+    AOT_GOTO(0x27c8, L27c8);
+L27c8:
+    AOT_BLOCK(0x27c8, 2);
+    // 27c8: cmpb $c, (r2)
+    {
+        src = uint8_t(0x0c);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 27cc: beq 27dc
+    if (Z)
+        AOT_GOTO(0x27dc, L27dc);
+    AOT_GOTO(0x27ce, L27ce);
+L27ce:
+    AOT_BLOCK(0x27ce, 2);
+    // 27ce: cmpb $b, (r2)
+    {
+        src = uint8_t(0x0b);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 27d2: beq 27dc
+    if (Z)
+        AOT_GOTO(0x27dc, L27dc);
+    AOT_GOTO(0x27d4, L27d4);
+L27d4:
+    AOT_BLOCK(0x27d4, 2);
+    // 27d4: mov $3c01, (sp)
+    {
+        src = uint16_t(0x3c01);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 27d8: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x27dc);
+    }
+    AOT_GOTO(0x1388, L1388);
+L27dc:
+    AOT_BLOCK(0x27dc, 1);
+    // 27dc: movb $c, (r2)
+    {
+        src = uint8_t(0x0c);
+        b = r[2];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x27e0, L27e0);
+L27e0:
+    AOT_BLOCK(0x27e0, 2);
+    // 27e0: cmpb $b, (r2)
+    {
+        src = uint8_t(0x0b);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 27e4: bne 27fc
+    if (!Z)
+        AOT_GOTO(0x27fc, L27fc);
+    AOT_GOTO(0x27e6, L27e6);
+L27e6:
+    AOT_BLOCK(0x27e6, 2);
+    // 27e6: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 27e8: jsr pc, *$2d88
+    {
+        a = 0x2d88;
+        r[6] -= 2;
+        WR16(r[6], 0x27ec);
+    }
+    AOT_GOTO(0x2d88, L2d88);
+L27ec:
+    AOT_BLOCK(0x27ec, 5);
+    // 27ec: add r0, 4ffa
+    {
+        src = r[0];
+        b = 0x4ffa;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 27f0: mov 4ffa, r0
+    {
+        a = 0x4ffa;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 27f4: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        C = val != 0;
+    }
+    // 27f6: mov r0, 6(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 27fa: br 287a
+    AOT_GOTO(0x287a, L287a);
+L27fc:
+    AOT_BLOCK(0x27fc, 2);
+    // 27fc: cmpb $d, (r2)
+    {
+        src = uint8_t(0x0d);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2800: bne 2838
+    if (!Z)
+        AOT_GOTO(0x2838, L2838);
+    AOT_GOTO(0x2802, L2802);
+L2802:
+    AOT_BLOCK(0x2802, 4);
+    // 2802: mov 3444, 6(r2)
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = uint16_t(r[2] + 6);
+        WR16(b, src);
+    }
+    // 2808: mov $ca, (sp)
+    {
+        src = uint16_t(0x00ca);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 280c: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 280e: jsr pc, 2d88
+    {
+        a = 0x2d88;
+        r[6] -= 2;
+        WR16(r[6], 0x2812);
+    }
+    AOT_GOTO(0x2d88, L2d88);
+L2812:
+    AOT_BLOCK(0x2812, 7);
+    // 2812: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2814: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2816: mov $ce, -(sp)
+    {
+        src = uint16_t(0x00ce);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 281a: mov 3444, -(sp)
+    {
+        a = 0x3444;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 281e: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 2822: mov $70, -(sp)
+    {
+        src = uint16_t(0x0070);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2826: mov $cc, -(sp)
+    {
+        src = uint16_t(0x00cc);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x282a, L282a);
+L282a:
+    AOT_BLOCK(0x282a, 2);
+    // 282a: mov $3c0e, -(sp)
+    {
+        src = uint16_t(0x3c0e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 282e: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2832);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2832:
+    AOT_BLOCK(0x2832, 2);
+    // 2832: add $c, sp
+    {
+        src = uint16_t(0x000c);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2836: br 287a
+    AOT_GOTO(0x287a, L287a);
+L2838:
+    AOT_BLOCK(0x2838, 2);
+    // 2838: cmpb $e, (r2)
+    {
+        src = uint8_t(0x0e);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 283c: bne 287a
+    if (!Z)
+        AOT_GOTO(0x287a, L287a);
+    AOT_GOTO(0x283e, L283e);
+L283e:
+    AOT_BLOCK(0x283e, 4);
+    // 283e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2840: bic $fff8, r0
+    {
+        src = uint16_t(0xfff8);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2844: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2848: bge 2850
+    if (!(N ^ V))
+        AOT_GOTO(0x2850, L2850);
+    AOT_GOTO(0x284a, L284a);
+L284a:
+    AOT_BLOCK(0x284a, 2);
+    // 284a: bit $18, r4
+    {
+        src = uint16_t(0x0018);
+        dst = r[4];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 284e: beq 2864
+    if (Z)
+        AOT_GOTO(0x2864, L2864);
+    AOT_GOTO(0x2850, L2850);
+L2850:
+    AOT_BLOCK(0x2850, 4);
+    // 2850: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2852: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2856: cmp $8, r0
+    {
+        src = uint16_t(0x0008);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 285a: blt 2864
+    if (N ^ V)
+        AOT_GOTO(0x2864, L2864);
+    AOT_GOTO(0x285c, L285c);
+L285c:
+    AOT_BLOCK(0x285c, 2);
+    // 285c: cmp $3, 58e0
+    {
+        src = uint16_t(0x0003);
+        b = 0x58e0;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2862: ble 2870
+    if (Z || (N ^ V))
+        AOT_GOTO(0x2870, L2870);
+    AOT_GOTO(0x2864, L2864);
+L2864:
+    AOT_BLOCK(0x2864, 3);
+    // 2864: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2866: mov $3c15, -(sp)
+    {
+        src = uint16_t(0x3c15);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 286a: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x286e);
+    }
+    AOT_GOTO(0x1388, L1388);
+L286e:
+    AOT_BLOCK(0x286e, 1);
+    // 286e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2870, L2870);
+L2870:
+    AOT_BLOCK(0x2870, 2);
+    // 2870: dec 58e0
+    {
+        a = 0x58e0;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 2874: mov 58e0, 6(r2)
+    {
+        a = 0x58e0;
+        src = RD16(a);
+        b = uint16_t(r[2] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x287a, L287a);
+L287a:
+    AOT_BLOCK(0x287a, 2);
+    // 287a: mov a(r5), r0
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 287e: br 2880
+    AOT_GOTO(0x2880, L2880);
+L2880:
+    AOT_BLOCK(0x2880, 2);
+    // 2880: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2884:
+    AOT_BLOCK(0x2884, 3);
+    // 2884: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2888;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2888: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x288c);
+    }
+    AOT_GOTO(0x0246, L0246);
+L288c:
+    AOT_BLOCK(0x288c, 3);
+    // 288c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 288e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2890: jmp *$29ae
+    {
+        a = 0x29ae;
+    }
+    AOT_GOTO(0x29ae, L29ae);
+L2894:
+    AOT_BLOCK(0x2894, 1);
+    // 2894: jsr pc, 2884
+    {
+        a = 0x2884;
+        r[6] -= 2;
+        WR16(r[6], 0x2898);
+    }
+    AOT_GOTO(0x2884, L2884);
+L2898:
+    AOT_BLOCK(0x2898, 3);
+    // 2898: ash $2, r0
+    {
+        src = uint16_t(0x0002) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 289c: bis $8, r0
+    {
+        src = uint16_t(0x0008);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 28a0: jmp *$29ca
+    {
+        a = 0x29ca;
+    }
+    AOT_GOTO(0x29ca, L29ca);
+L28a4:
+    AOT_BLOCK(0x28a4, 1);
+    // 28a4: jsr pc, 2884
+    {
+        a = 0x2884;
+        r[6] -= 2;
+        WR16(r[6], 0x28a8);
+    }
+    AOT_GOTO(0x2884, L2884);
+L28a8:
+    AOT_BLOCK(0x28a8, 2);
+    // 28a8: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 28aa: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x28ae);
+    }
+    AOT_GOTO(0x0246, L0246);
+L28ae:
+    AOT_BLOCK(0x28ae, 3);
+    // 28ae: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 28b0: cmp $7, r4
+    {
+        src = uint16_t(0x0007);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 28b4: beq 28ba
+    if (Z)
+        AOT_GOTO(0x28ba, L28ba);
+    AOT_GOTO(0x28b6, L28b6);
+L28b6:
+    AOT_BLOCK(0x28b6, 1);
+    // 28b6: jmp *$29be
+    {
+        a = 0x29be;
+    }
+    AOT_GOTO(0x29be, L29be);
+L28ba:
+    AOT_BLOCK(0x28ba, 1);
+    // 28ba: br 28cc
+    AOT_GOTO(0x28cc, L28cc);
+L28bc:
+    AOT_BLOCK(0x28bc, 4);
+    // 28bc: mov 53f0, r2
+    {
+        a = 0x53f0;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 28c0: mov r2, 53e8
+    {
+        src = r[2];
+        b = 0x53e8;
+        WR16(b, src);
+    }
+    // 28c4: clr r3
+    {
+        r[3] = 0;
+        C = false;
+    }
+    // 28c6: movb 344e, 4(r2)
+    {
+        a = 0x344e;
+        src = RD8(a);
+        b = uint16_t(r[2] + 4);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x28cc, L28cc);
+L28cc:
+    AOT_BLOCK(0x28cc, 1);
+    // 28cc: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x28d0);
+    }
+    AOT_GOTO(0x0246, L0246);
+L28d0:
+    AOT_BLOCK(0x28d0, 3);
+    // 28d0: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 28d2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 28d4: br 2994
+    AOT_GOTO(0x2994, L2994);
+L28d6:
+    AOT_BLOCK(0x28d6, 2);
+    // 28d6: tst 53ec
+    {
+        a = 0x53ec;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 28da: beq 2900
+    if (Z)
+        AOT_GOTO(0x2900, L2900);
+    AOT_GOTO(0x28dc, L28dc);
+L28dc:
+    AOT_BLOCK(0x28dc, 7);
+    // 28dc: clr 53ec
+    {
+        a = 0x53ec;
+        WR16(a, 0);
+    }
+    // 28e0: mov 53e8, r2
+    {
+        a = 0x53e8;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 28e4: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 28e6: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 28e8: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 28ea: mov $11, -(sp)
+    {
+        src = uint16_t(0x0011);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 28ee: jsr pc, *$2560
+    {
+        a = 0x2560;
+        r[6] -= 2;
+        WR16(r[6], 0x28f2);
+    }
+    AOT_GOTO(0x2560, L2560);
+L28f2:
+    AOT_BLOCK(0x28f2, 4);
+    // 28f2: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 28f6: mov r2, 53e8
+    {
+        src = r[2];
+        b = 0x53e8;
+        WR16(b, src);
+    }
+    // 28fa: inc 53ec
+    {
+        a = 0x53ec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 28fe: br 290c
+    AOT_GOTO(0x290c, L290c);
+L2900:
+    AOT_BLOCK(0x2900, 1);
+    // 2900: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x2904);
+    }
+    AOT_GOTO(0x0246, L0246);
+L2904:
+    AOT_BLOCK(0x2904, 3);
+    // 2904: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 2906: cmp $7, r4
+    {
+        src = uint16_t(0x0007);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 290a: bne 29be
+    if (!Z)
+        AOT_GOTO(0x29be, L29be);
+    AOT_GOTO(0x290c, L290c);
+L290c:
+    AOT_BLOCK(0x290c, 3);
+    // 290c: ash $2, r3
+    {
+        src = uint16_t(0x0002) & 077;
+        val16 = r[3];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 2910: bis $10, r3
+    {
+        src = uint16_t(0x0010);
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2914: br 28cc
+    AOT_GOTO(0x28cc, L28cc);
+L2916:
+    AOT_BLOCK(0x2916, 1);
+    // 2916: jsr pc, 2540
+    {
+        a = 0x2540;
+        r[6] -= 2;
+        WR16(r[6], 0x291a);
+    }
+    AOT_GOTO(0x2540, L2540);
+L291a:
+    AOT_BLOCK(0x291a, 1);
+    // 291a: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x291e);
+    }
+    AOT_GOTO(0x0246, L0246);
+L291e:
+    AOT_BLOCK(0x291e, 3);
+    // 291e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 2920: cmp $5, r4
+    {
+        src = uint16_t(0x0005);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2924: beq 2978
+    if (Z)
+        AOT_GOTO(0x2978, L2978);
+    AOT_GOTO(0x2926, L2926);
+L2926:
+    AOT_BLOCK(0x2926, 2);
+    // 2926: mov r4, 3448
+    {
+        src = r[4];
+        b = 0x3448;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 292a: jsr pc, 1504
+    {
+        a = 0x1504;
+        r[6] -= 2;
+        WR16(r[6], 0x292e);
+    }
+    AOT_GOTO(0x1504, L1504);
+L292e:
+    AOT_BLOCK(0x292e, 3);
+    // 292e: mov r0, 53f2
+    {
+        src = r[0];
+        b = 0x53f2;
+        WR16(b, src);
+    }
+    // 2932: movb 4(r2), r4
+    {
+        a = uint16_t(r[2] + 4);
+        src = RD8(a);
+        r[4] = int16_t(int8_t(src));
+    }
+    // 2936: bic $ff00, r4
+    {
+        src = uint16_t(0xff00);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x293a, L293a);
+L293a:
+    AOT_BLOCK(0x293a, 2);
+    // 293a: cmp 344e, r4
+    {
+        a = 0x344e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 293e: ble 295a
+    if (Z || (N ^ V))
+        AOT_GOTO(0x295a, L295a);
+    AOT_GOTO(0x2940, L2940);
+L2940:
+    AOT_BLOCK(0x2940, 10);
+    // 2940: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 2942: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 2944: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2946: add $540c, (sp)
+    {
+        src = uint16_t(0x540c);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 294a: mov 53f2, -(sp)
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 294e: mov *2(sp), r1
+    {
+        a = RD16(r[6] + 2);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2952: mul (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 2954: mov r1, *(sp)+
+    {
+        src = r[1];
+        b = RD16(r[6]);
+        r[6] += 2;
+        WR16(b, src);
+    }
+    // 2956: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 2958: br 293a
+    AOT_GOTO(0x293a, L293a);
+L295a:
+    AOT_BLOCK(0x295a, 5);
+    // 295a: mov 344e, r0
+    {
+        a = 0x344e;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 295e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 2960: inc 344e
+    {
+        a = 0x344e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 2964: mov 53f2, 540c(r0)
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        b = uint16_t(r[0] + 21516);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 296a: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x296e);
+    }
+    AOT_GOTO(0x0246, L0246);
+L296e:
+    AOT_BLOCK(0x296e, 3);
+    // 296e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 2970: cmp $5, r4
+    {
+        src = uint16_t(0x0005);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2974: bne 29be
+    if (!Z)
+        AOT_GOTO(0x29be, L29be);
+    AOT_GOTO(0x2976, L2976);
+L2976:
+    AOT_BLOCK(0x2976, 1);
+    // 2976: br 2988
+    AOT_GOTO(0x2988, L2988);
+L2978:
+    AOT_BLOCK(0x2978, 4);
+    // 2978: mov 344e, r0
+    {
+        a = 0x344e;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 297c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 297e: inc 344e
+    {
+        a = 0x344e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 2982: mov $1, 540c(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 21516);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2988, L2988);
+L2988:
+    AOT_BLOCK(0x2988, 3);
+    // 2988: ash $2, r3
+    {
+        src = uint16_t(0x0002) & 077;
+        val16 = r[3];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[3] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 298c: bis $18, r3
+    {
+        src = uint16_t(0x0018);
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2990: br 28cc
+    AOT_GOTO(0x28cc, L28cc);
+L2994:
+    AOT_BLOCK(0x2994, 3);
+    // 2994: sub $4, r0
+    {
+        src = uint16_t(0x0004);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 2998: cmp r0, $2
+    {
+        src = r[0];
+        dst = uint16_t(0x0002);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 299c: bhi 29a4
+    if (!(C | Z))
+        AOT_GOTO(0x29a4, L29a4);
+    AOT_GOTO(0x299e, L299e);
+L299e:
+    AOT_BLOCK(0x299e, 2);
+    // 299e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 29a0: jmp *3b72(r0)
+    {
+        a = RD16(r[0] + 15218);
+    }
+    AOT_JUMP(a);
+L29a4:
+    AOT_BLOCK(0x29a4, 3);
+    // 29a4: mov r4, 3448
+    {
+        src = r[4];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 29a8: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 29aa: br 29ca
+    AOT_GOTO(0x29ca, L29ca);
+L29ae:
+    AOT_BLOCK(0x29ae, 2);
+    // 29ae: mov $3b78, r1
+    {
+        src = uint16_t(0x3b78);
+        r[1] = src;
+    }
+    // 29b2: mov r0, 3b7e
+    {
+        src = r[0];
+        b = 0x3b7e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x29b6, L29b6);
+L29b6:
+    AOT_BLOCK(0x29b6, 2);
+    // 29b6: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 29b8: bne 29b6
+    if (!Z)
+        AOT_GOTO(0x29b6, L29b6);
+    AOT_GOTO(0x29ba, L29ba);
+L29ba:
+    AOT_BLOCK(0x29ba, 1);
+    // 29ba: jmp *6(r1)
+    {
+        a = RD16(r[1] + 6);
+    }
+    AOT_JUMP(a);
+L29be:
+    AOT_BLOCK(0x29be, 2);
+    // 29be: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 29c0: jsr pc, *$2a98
+    {
+        a = 0x2a98;
+        r[6] -= 2;
+        WR16(r[6], 0x29c4);
+    }
+    AOT_GOTO(0x2a98, L2a98);
+L29c4:
+    AOT_BLOCK(0x29c4, 2);
+    // 29c4: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 29c8: br 29ca
+    AOT_GOTO(0x29ca, L29ca);
+L29ca:
+    AOT_BLOCK(0x29ca, 2);
+    // 29ca: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L29ce:
+    AOT_BLOCK(0x29ce, 9);
+    // 29ce: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x29d2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 29d2: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 29d4: mov 8(r5), r2
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 29d8: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 29dc: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 29e0: mov $3c25, -8(r5)
+    {
+        src = uint16_t(0x3c25);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 29e6: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 29e8: bne 2a00
+    if (!Z)
+        AOT_GOTO(0x2a00, L2a00);
+    AOT_GOTO(0x29ea, L29ea);
+L29ea:
+    AOT_BLOCK(0x29ea, 2);
+    // 29ea: tst 58e2
+    {
+        a = 0x58e2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 29ee: beq 2a00
+    if (Z)
+        AOT_GOTO(0x2a00, L2a00);
+    AOT_GOTO(0x29f0, L29f0);
+L29f0:
+    AOT_BLOCK(0x29f0, 5);
+    // 29f0: mov 58e2, r0
+    {
+        a = 0x58e2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 29f4: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+    }
+    // 29f6: ash $fffd, r0
+    {
+        src = uint16_t(0xfffd) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 29fa: add r0, r4
+    {
+        src = r[0];
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+    }
+    // 29fc: clr 58e2
+    {
+        a = 0x58e2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2a00, L2a00);
+L2a00:
+    AOT_BLOCK(0x2a00, 4);
+    // 2a00: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 2a02: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2a06: cmp $18, r0
+    {
+        src = uint16_t(0x0018);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a0a: bne 2a16
+    if (!Z)
+        AOT_GOTO(0x2a16, L2a16);
+    AOT_GOTO(0x2a0c, L2a0c);
+L2a0c:
+    AOT_BLOCK(0x2a0c, 2);
+    // 2a0c: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a0e: jsr pc, *$2aca
+    {
+        a = 0x2aca;
+        r[6] -= 2;
+        WR16(r[6], 0x2a12);
+    }
+    AOT_GOTO(0x2aca, L2aca);
+L2a12:
+    AOT_BLOCK(0x2a12, 2);
+    // 2a12: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a14: br 2a00
+    AOT_GOTO(0x2a00, L2a00);
+L2a16:
+    AOT_BLOCK(0x2a16, 2);
+    // 2a16: cmp $1, r3
+    {
+        src = uint16_t(0x0001);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a1a: beq 2a2c
+    if (Z)
+        AOT_GOTO(0x2a2c, L2a2c);
+    AOT_GOTO(0x2a1c, L2a1c);
+L2a1c:
+    AOT_BLOCK(0x2a1c, 4);
+    // 2a1c: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 2a1e: bic $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 2a22: cmp 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a26: bge 2a2c
+    if (!(N ^ V))
+        AOT_GOTO(0x2a2c, L2a2c);
+    AOT_GOTO(0x2a28, L2a28);
+L2a28:
+    AOT_BLOCK(0x2a28, 1);
+    // 2a28: clr 58e2
+    {
+        a = 0x58e2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2a2c, L2a2c);
+L2a2c:
+    AOT_BLOCK(0x2a2c, 2);
+    // 2a2c: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2a2e: beq 2a8c
+    if (Z)
+        AOT_GOTO(0x2a8c, L2a8c);
+    AOT_GOTO(0x2a30, L2a30);
+L2a30:
+    AOT_BLOCK(0x2a30, 2);
+    // 2a30: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2a34: bne 2a5a
+    if (!Z)
+        AOT_GOTO(0x2a5a, L2a5a);
+    AOT_GOTO(0x2a36, L2a36);
+L2a36:
+    AOT_BLOCK(0x2a36, 2);
+    // 2a36: cmp $10, r2
+    {
+        src = uint16_t(0x0010);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a3a: bge 2a44
+    if (!(N ^ V))
+        AOT_GOTO(0x2a44, L2a44);
+    AOT_GOTO(0x2a3c, L2a3c);
+L2a3c:
+    AOT_BLOCK(0x2a3c, 2);
+    // 2a3c: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a40: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2a44);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2a44:
+    AOT_BLOCK(0x2a44, 4);
+    // 2a44: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 2a46: add 58e2, r0
+    {
+        a = 0x58e2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2a4a: cmp $10, r0
+    {
+        src = uint16_t(0x0010);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a4e: bge 2a58
+    if (!(N ^ V))
+        AOT_GOTO(0x2a58, L2a58);
+    AOT_GOTO(0x2a50, L2a50);
+L2a50:
+    AOT_BLOCK(0x2a50, 2);
+    // 2a50: clr 58e2
+    {
+        a = 0x58e2;
+        WR16(a, 0);
+    }
+    // 2a54: add $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2a58, L2a58);
+L2a58:
+    AOT_BLOCK(0x2a58, 1);
+    // 2a58: br 2a8c
+    AOT_GOTO(0x2a8c, L2a8c);
+L2a5a:
+    AOT_BLOCK(0x2a5a, 2);
+    // 2a5a: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a60: bne 2a84
+    if (!Z)
+        AOT_GOTO(0x2a84, L2a84);
+    AOT_GOTO(0x2a62, L2a62);
+L2a62:
+    AOT_BLOCK(0x2a62, 2);
+    // 2a62: cmp $8, r2
+    {
+        src = uint16_t(0x0008);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a66: bge 2a70
+    if (!(N ^ V))
+        AOT_GOTO(0x2a70, L2a70);
+    AOT_GOTO(0x2a68, L2a68);
+L2a68:
+    AOT_BLOCK(0x2a68, 2);
+    // 2a68: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a6c: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2a70);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2a70:
+    AOT_BLOCK(0x2a70, 4);
+    // 2a70: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 2a72: add 58e2, r0
+    {
+        a = 0x58e2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2a76: cmp $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a7a: bge 2a82
+    if (!(N ^ V))
+        AOT_GOTO(0x2a82, L2a82);
+    AOT_GOTO(0x2a7c, L2a7c);
+L2a7c:
+    AOT_BLOCK(0x2a7c, 2);
+    // 2a7c: clr 58e2
+    {
+        a = 0x58e2;
+        WR16(a, 0);
+        C = false;
+    }
+    // 2a80: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x2a82, L2a82);
+L2a82:
+    AOT_BLOCK(0x2a82, 1);
+    // 2a82: br 2a8c
+    AOT_GOTO(0x2a8c, L2a8c);
+L2a84:
+    AOT_BLOCK(0x2a84, 2);
+    // 2a84: mov $3c34, (sp)
+    {
+        src = uint16_t(0x3c34);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a88: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2a8c);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2a8c:
+    AOT_BLOCK(0x2a8c, 3);
+    // 2a8c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2a8e: sub 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 2a92: br 2a94
+    AOT_GOTO(0x2a94, L2a94);
+L2a94:
+    AOT_BLOCK(0x2a94, 2);
+    // 2a94: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2a98:
+    AOT_BLOCK(0x2a98, 4);
+    // 2a98: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2a9c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2a9c: mov $3c47, (sp)
+    {
+        src = uint16_t(0x3c47);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2aa0: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2aa4);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2aa4:
+    AOT_BLOCK(0x2aa4, 2);
+    // 2aa4: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2aa8: jsr pc, *$22be
+    {
+        a = 0x22be;
+        r[6] -= 2;
+        WR16(r[6], 0x2aac);
+    }
+    AOT_GOTO(0x22be, L22be);
+L2aac:
+    AOT_BLOCK(0x2aac, 2);
+    // 2aac: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2ab0:
+    AOT_BLOCK(0x2ab0, 6);
+    // 2ab0: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2ab4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2ab4: mov 53e8, (sp)
+    {
+        a = 0x53e8;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2ab8: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2abc: mov $3c5a, -(sp)
+    {
+        src = uint16_t(0x3c5a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ac0: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2ac4);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2ac4:
+    AOT_BLOCK(0x2ac4, 3);
+    // 2ac4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2ac6: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2aca:
+    AOT_BLOCK(0x2aca, 5);
+    // 2aca: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2ace;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2ace: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2ad2: bit $fff8, r4
+    {
+        src = uint16_t(0xfff8);
+        dst = r[4];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2ad6: bne 2ae4
+    if (!Z)
+        AOT_GOTO(0x2ae4, L2ae4);
+    AOT_GOTO(0x2ad8, L2ad8);
+L2ad8:
+    AOT_BLOCK(0x2ad8, 2);
+    // 2ad8: mov $3cb4, (sp)
+    {
+        src = uint16_t(0x3cb4);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2adc: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2ae0);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2ae0:
+    AOT_BLOCK(0x2ae0, 2);
+    // 2ae0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ae2: br 2af8
+    AOT_GOTO(0x2af8, L2af8);
+L2ae4:
+    AOT_BLOCK(0x2ae4, 7);
+    // 2ae4: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2ae6: ash $fffe, r0
+    {
+        src = uint16_t(0xfffe) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 2aea: bic $7, r0
+    {
+        src = uint16_t(0x0007);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2aee: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 2af0: bic $fff8, r1
+    {
+        src = uint16_t(0xfff8);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 2af4: bis r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2af6: br 2af8
+    AOT_GOTO(0x2af8, L2af8);
+L2af8:
+    AOT_BLOCK(0x2af8, 2);
+    // 2af8: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2afc:
+    AOT_BLOCK(0x2afc, 10);
+    // 2afc: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2b00;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2b00: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2b04: bic $7, r0
+    {
+        src = uint16_t(0x0007);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2b08: ash $2, r0
+    {
+        src = uint16_t(0x0002) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 2b0c: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2b10: bic $fff8, r1
+    {
+        src = uint16_t(0xfff8);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 2b14: bis r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 2b16: bis $8, r0
+    {
+        src = uint16_t(0x0008);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2b1a: br 2b1c
+    AOT_GOTO(0x2b1c, L2b1c);
+L2b1c:
+    AOT_BLOCK(0x2b1c, 2);
+    // 2b1c: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2b20:
+    AOT_BLOCK(0x2b20, 8);
+    // 2b20: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2b24;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2b24: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b28: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b2c: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b30: mov $67, -(sp)
+    {
+        src = uint16_t(0x0067);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b34: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b38: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x2b3c);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L2b3c:
+    AOT_BLOCK(0x2b3c, 3);
+    // 2b3c: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 2b40: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b42: jsr pc, *$2b4a
+    {
+        a = 0x2b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x2b46);
+    }
+    AOT_GOTO(0x2b4a, L2b4a);
+L2b46:
+    AOT_BLOCK(0x2b46, 2);
+    // 2b46: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2b4a:
+    AOT_BLOCK(0x2b4a, 4);
+    // 2b4a: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2b4e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2b4e: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b52: jsr pc, *$2b6c
+    {
+        a = 0x2b6c;
+        r[6] -= 2;
+        WR16(r[6], 0x2b56);
+    }
+    AOT_GOTO(0x2b6c, L2b6c);
+L2b56:
+    AOT_BLOCK(0x2b56, 4);
+    // 2b56: mov 344a, (sp)
+    {
+        a = 0x344a;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b5a: mov $d6, -(sp)
+    {
+        src = uint16_t(0x00d6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b5e: mov $3cc8, -(sp)
+    {
+        src = uint16_t(0x3cc8);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b62: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2b66);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2b66:
+    AOT_BLOCK(0x2b66, 3);
+    // 2b66: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 2b68: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2b6c:
+    AOT_BLOCK(0x2b6c, 5);
+    // 2b6c: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2b70;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2b70: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2b74: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2b76: bne 2b7c
+    if (!Z)
+        AOT_GOTO(0x2b7c, L2b7c);
+    AOT_GOTO(0x2b78, L2b78);
+L2b78:
+    AOT_BLOCK(0x2b78, 1);
+    // 2b78: jmp *$2c6a
+    {
+        a = 0x2c6a;
+    }
+    AOT_GOTO(0x2c6a, L2c6a);
+L2b7c:
+    AOT_BLOCK(0x2b7c, 2);
+    // 2b7c: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b7e: br 2c5a
+    AOT_GOTO(0x2c5a, L2c5a);
+L2b80:
+    AOT_BLOCK(0x2b80, 3);
+    // 2b80: mov $da, (sp)
+    {
+        src = uint16_t(0x00da);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b84: mov $3ccb, -(sp)
+    {
+        src = uint16_t(0x3ccb);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b88: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2b8c);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2b8c:
+    AOT_BLOCK(0x2b8c, 2);
+    // 2b8c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2b8e: br 2c6a
+    AOT_GOTO(0x2c6a, L2c6a);
+L2b90:
+    AOT_BLOCK(0x2b90, 5);
+    // 2b90: mov 2(r4), (sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b94: mov 6(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b98: mov $14, -(sp)
+    {
+        src = uint16_t(0x0014);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b9c: mov $3ccd, -(sp)
+    {
+        src = uint16_t(0x3ccd);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ba0: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2ba4);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2ba4:
+    AOT_BLOCK(0x2ba4, 3);
+    // 2ba4: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 2ba8: cmp $c, 6(r4)
+    {
+        src = uint16_t(0x000c);
+        b = uint16_t(r[4] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2bae: bne 2bc2
+    if (!Z)
+        AOT_GOTO(0x2bc2, L2bc2);
+    AOT_GOTO(0x2bb0, L2bb0);
+L2bb0:
+    AOT_BLOCK(0x2bb0, 4);
+    // 2bb0: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2bb2: add $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2bb6: mov $3cd1, -(sp)
+    {
+        src = uint16_t(0x3cd1);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2bba: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2bbe);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2bbe:
+    AOT_BLOCK(0x2bbe, 2);
+    // 2bbe: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2bc0: br 2bd0
+    AOT_GOTO(0x2bd0, L2bd0);
+L2bc2:
+    AOT_BLOCK(0x2bc2, 3);
+    // 2bc2: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2bc6: mov $3cd3, -(sp)
+    {
+        src = uint16_t(0x3cd3);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2bca: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2bce);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2bce:
+    AOT_BLOCK(0x2bce, 1);
+    // 2bce: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2bd0, L2bd0);
+L2bd0:
+    AOT_BLOCK(0x2bd0, 1);
+    // 2bd0: br 2c6a
+    AOT_GOTO(0x2c6a, L2c6a);
+L2bd2:
+    AOT_BLOCK(0x2bd2, 5);
+    // 2bd2: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2bd6: mov 2(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2bda: mov (r4), -(sp)
+    {
+        a = r[4];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2bdc: mov $3cd5, -(sp)
+    {
+        src = uint16_t(0x3cd5);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2be0: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2be4);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2be4:
+    AOT_BLOCK(0x2be4, 2);
+    // 2be4: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2be8: br 2c6a
+    AOT_GOTO(0x2c6a, L2c6a);
+L2bea:
+    AOT_BLOCK(0x2bea, 2);
+    // 2bea: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2bee: jsr pc, *$2b6c
+    {
+        a = 0x2b6c;
+        r[6] -= 2;
+        WR16(r[6], 0x2bf2);
+    }
+    AOT_GOTO(0x2b6c, L2b6c);
+L2bf2:
+    AOT_BLOCK(0x2bf2, 5);
+    // 2bf2: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2bf6: mov 2(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2bfa: mov (r4), -(sp)
+    {
+        a = r[4];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2bfc: mov $3cd9, -(sp)
+    {
+        src = uint16_t(0x3cd9);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c00: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2c04);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2c04:
+    AOT_BLOCK(0x2c04, 2);
+    // 2c04: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2c08: br 2c6a
+    AOT_GOTO(0x2c6a, L2c6a);
+L2c0a:
+    AOT_BLOCK(0x2c0a, 2);
+    // 2c0a: mov 2(r4), (sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c0e: jsr pc, *$2b6c
+    {
+        a = 0x2b6c;
+        r[6] -= 2;
+        WR16(r[6], 0x2c12);
+    }
+    AOT_GOTO(0x2b6c, L2b6c);
+L2c12:
+    AOT_BLOCK(0x2c12, 5);
+    // 2c12: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2c16: mov 4(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2c1a: mov (r4), -(sp)
+    {
+        a = r[4];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2c1c: mov $3cdd, -(sp)
+    {
+        src = uint16_t(0x3cdd);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c20: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2c24);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2c24:
+    AOT_BLOCK(0x2c24, 2);
+    // 2c24: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2c28: br 2c6a
+    AOT_GOTO(0x2c6a, L2c6a);
+L2c2a:
+    AOT_BLOCK(0x2c2a, 2);
+    // 2c2a: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c2e: jsr pc, *$2b6c
+    {
+        a = 0x2b6c;
+        r[6] -= 2;
+        WR16(r[6], 0x2c32);
+    }
+    AOT_GOTO(0x2b6c, L2b6c);
+L2c32:
+    AOT_BLOCK(0x2c32, 4);
+    // 2c32: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2c34: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 2c36: bit $1, 3d36(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 15670);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2c3c: beq 2c46
+    if (Z)
+        AOT_GOTO(0x2c46, L2c46);
+    AOT_GOTO(0x2c3e, L2c3e);
+L2c3e:
+    AOT_BLOCK(0x2c3e, 2);
+    // 2c3e: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c42: jsr pc, *$2b6c
+    {
+        a = 0x2b6c;
+        r[6] -= 2;
+        WR16(r[6], 0x2c46);
+    }
+    AOT_GOTO(0x2b6c, L2b6c);
+L2c46:
+    AOT_BLOCK(0x2c46, 4);
+    // 2c46: mov 2(r4), (sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2c4a: mov (r4), -(sp)
+    {
+        a = r[4];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2c4c: mov $3ce1, -(sp)
+    {
+        src = uint16_t(0x3ce1);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c50: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2c54);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2c54:
+    AOT_BLOCK(0x2c54, 2);
+    // 2c54: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2c56: br 2c6a
+    AOT_GOTO(0x2c6a, L2c6a);
+L2c5a:
+    AOT_BLOCK(0x2c5a, 2);
+    // 2c5a: mov $3c6a, r1
+    {
+        src = uint16_t(0x3c6a);
+        r[1] = src;
+    }
+    // 2c5e: mov r0, 3c78
+    {
+        src = r[0];
+        b = 0x3c78;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2c62, L2c62);
+L2c62:
+    AOT_BLOCK(0x2c62, 2);
+    // 2c62: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2c64: bne 2c62
+    if (!Z)
+        AOT_GOTO(0x2c62, L2c62);
+    AOT_GOTO(0x2c66, L2c66);
+L2c66:
+    AOT_BLOCK(0x2c66, 1);
+    // 2c66: jmp *e(r1)
+    {
+        a = RD16(r[1] + 14);
+    }
+    AOT_JUMP(a);
+L2c6a:
+    AOT_BLOCK(0x2c6a, 2);
+    // 2c6a: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2c6e:
+    AOT_BLOCK(0x2c6e, 6);
+    // 2c6e: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2c72;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2c72: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2c76: mov $6f, -(sp)
+    {
+        src = uint16_t(0x006f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2c7a: mov $3ce4, -(sp)
+    {
+        src = uint16_t(0x3ce4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c7e: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2c82);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2c82:
+    AOT_BLOCK(0x2c82, 3);
+    // 2c82: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 2c84: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2c88:
+    AOT_BLOCK(0x2c88, 6);
+    // 2c88: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2c8c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2c8c: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2c90: mov $70, -(sp)
+    {
+        src = uint16_t(0x0070);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2c94: mov $3ce7, -(sp)
+    {
+        src = uint16_t(0x3ce7);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c98: jsr pc, *$2f5e
+    {
+        a = 0x2f5e;
+        r[6] -= 2;
+        WR16(r[6], 0x2c9c);
+    }
+    AOT_GOTO(0x2f5e, L2f5e);
+L2c9c:
+    AOT_BLOCK(0x2c9c, 3);
+    // 2c9c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 2c9e: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2ca2:
+    AOT_BLOCK(0x2ca2, 5);
+    // 2ca2: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2ca6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2ca6: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2caa: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2cac: beq 2cb8
+    if (Z)
+        AOT_GOTO(0x2cb8, L2cb8);
+    AOT_GOTO(0x2cae, L2cae);
+L2cae:
+    AOT_BLOCK(0x2cae, 3);
+    // 2cae: mov 2(r2), r4
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2cb2: bit $fff8, r4
+    {
+        src = uint16_t(0xfff8);
+        dst = r[4];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2cb6: bne 2cbe
+    if (!Z)
+        AOT_GOTO(0x2cbe, L2cbe);
+    AOT_GOTO(0x2cb8, L2cb8);
+L2cb8:
+    AOT_BLOCK(0x2cb8, 2);
+    // 2cb8: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2cbc: br 2cd8
+    AOT_GOTO(0x2cd8, L2cd8);
+L2cbe:
+    AOT_BLOCK(0x2cbe, 2);
+    // 2cbe: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2cc0: jsr pc, *$2aca
+    {
+        a = 0x2aca;
+        r[6] -= 2;
+        WR16(r[6], 0x2cc4);
+    }
+    AOT_GOTO(0x2aca, L2aca);
+L2cc4:
+    AOT_BLOCK(0x2cc4, 3);
+    // 2cc4: mov r0, 2(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 2cc8: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2cca: jsr pc, *$2cdc
+    {
+        a = 0x2cdc;
+        r[6] -= 2;
+        WR16(r[6], 0x2cce);
+    }
+    AOT_GOTO(0x2cdc, L2cdc);
+L2cce:
+    AOT_BLOCK(0x2cce, 4);
+    // 2cce: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2cd0: mov r4, 2(r2)
+    {
+        src = r[4];
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 2cd4: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2cd6: br 2cd8
+    AOT_GOTO(0x2cd8, L2cd8);
+L2cd8:
+    AOT_BLOCK(0x2cd8, 2);
+    // 2cd8: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2cdc:
+    AOT_BLOCK(0x2cdc, 5);
+    // 2cdc: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2ce0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2ce0: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2ce4: mov 2(r2), r4
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2ce8: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2cec, L2cec);
+L2cec:
+    AOT_BLOCK(0x2cec, 4);
+    // 2cec: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2cee: bic $ffe7, r0
+    {
+        src = uint16_t(0xffe7);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2cf2: cmp $18, r0
+    {
+        src = uint16_t(0x0018);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2cf6: bne 2d10
+    if (!Z)
+        AOT_GOTO(0x2d10, L2d10);
+    AOT_GOTO(0x2cf8, L2cf8);
+L2cf8:
+    AOT_BLOCK(0x2cf8, 2);
+    // 2cf8: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2cfa: jsr pc, *$2aca
+    {
+        a = 0x2aca;
+        r[6] -= 2;
+        WR16(r[6], 0x2cfe);
+    }
+    AOT_GOTO(0x2aca, L2aca);
+L2cfe:
+    AOT_BLOCK(0x2cfe, 6);
+    // 2cfe: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 2d00: movb 4(r2), r0
+    {
+        a = uint16_t(r[2] + 4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2d04: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2d08: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 2d0a: mov 540c(r0), r3
+    {
+        a = uint16_t(r[0] + 21516);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2d0e: br 2cec
+    AOT_GOTO(0x2cec, L2cec);
+L2d10:
+    AOT_BLOCK(0x2d10, 4);
+    // 2d10: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2d12: bic $7, r0
+    {
+        src = uint16_t(0x0007);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2d16: cmp $10, r0
+    {
+        src = uint16_t(0x0010);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2d1a: bne 2d20
+    if (!Z)
+        AOT_GOTO(0x2d20, L2d20);
+    AOT_GOTO(0x2d1c, L2d1c);
+L2d1c:
+    AOT_BLOCK(0x2d1c, 2);
+    // 2d1c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2d1e: br 2d84
+    AOT_GOTO(0x2d84, L2d84);
+L2d20:
+    AOT_BLOCK(0x2d20, 2);
+    // 2d20: cmp $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2d24: bgt 2d2c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x2d2c, L2d2c);
+    AOT_GOTO(0x2d26, L2d26);
+L2d26:
+    AOT_BLOCK(0x2d26, 3);
+    // 2d26: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 2d28: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 2d2a: br 2d84
+    AOT_GOTO(0x2d84, L2d84);
+L2d2c:
+    AOT_BLOCK(0x2d2c, 3);
+    // 2d2c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2d2e: bic $fff8, r0
+    {
+        src = uint16_t(0xfff8);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2d32: br 2d70
+    AOT_GOTO(0x2d70, L2d70);
+L2d34:
+    AOT_BLOCK(0x2d34, 3);
+    // 2d34: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 2d36: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 2d38: br 2d84
+    AOT_GOTO(0x2d84, L2d84);
+L2d3a:
+    AOT_BLOCK(0x2d3a, 2);
+    // 2d3a: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2d3c: br 2d84
+    AOT_GOTO(0x2d84, L2d84);
+L2d3e:
+    AOT_BLOCK(0x2d3e, 3);
+    // 2d3e: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 2d40: ash $2, r0
+    {
+        src = uint16_t(0x0002) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 2d44: br 2d84
+    AOT_GOTO(0x2d84, L2d84);
+L2d46:
+    AOT_BLOCK(0x2d46, 3);
+    // 2d46: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 2d48: ash $3, r0
+    {
+        src = uint16_t(0x0003) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 2d4c: br 2d84
+    AOT_GOTO(0x2d84, L2d84);
+L2d4e:
+    AOT_BLOCK(0x2d4e, 7);
+    // 2d4e: movb 5(r2), r1
+    {
+        a = uint16_t(r[2] + 5);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 2d52: bic $ff00, r1
+    {
+        src = uint16_t(0xff00);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 2d56: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 2d58: mov 540c(r1), r1
+    {
+        a = uint16_t(r[1] + 21516);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2d5c: mul r3, r1
+    {
+        src = int16_t(r[3]);
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 2d5e: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2d60: br 2d84
+    AOT_GOTO(0x2d84, L2d84);
+L2d62:
+    AOT_BLOCK(0x2d62, 2);
+    // 2d62: mov $3cea, (sp)
+    {
+        src = uint16_t(0x3cea);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2d66: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2d6a);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2d6a:
+    AOT_BLOCK(0x2d6a, 2);
+    // 2d6a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2d6c: br 2d84
+    AOT_GOTO(0x2d84, L2d84);
+L2d6e:
+    AOT_BLOCK(0x2d6e, 1);
+    // 2d6e: br 2d7c
+    AOT_GOTO(0x2d7c, L2d7c);
+L2d70:
+    AOT_BLOCK(0x2d70, 2);
+    // 2d70: cmp r0, $6
+    {
+        src = r[0];
+        dst = uint16_t(0x0006);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2d74: bhi 2d7c
+    if (!(C | Z))
+        AOT_GOTO(0x2d7c, L2d7c);
+    AOT_GOTO(0x2d76, L2d76);
+L2d76:
+    AOT_BLOCK(0x2d76, 2);
+    // 2d76: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 2d78: jmp *3c8a(r0)
+    {
+        a = RD16(r[0] + 15498);
+    }
+    AOT_JUMP(a);
+L2d7c:
+    AOT_BLOCK(0x2d7c, 2);
+    // 2d7c: mov $3cf8, (sp)
+    {
+        src = uint16_t(0x3cf8);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2d80: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2d84);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2d84:
+    AOT_BLOCK(0x2d84, 2);
+    // 2d84: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2d88:
+    AOT_BLOCK(0x2d88, 4);
+    // 2d88: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2d8c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2d8c: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2d90: jsr pc, *$2cdc
+    {
+        a = 0x2cdc;
+        r[6] -= 2;
+        WR16(r[6], 0x2d94);
+    }
+    AOT_GOTO(0x2cdc, L2cdc);
+L2d94:
+    AOT_BLOCK(0x2d94, 3);
+    // 2d94: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 2d96: bic $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2d9a: br 2d9c
+    AOT_GOTO(0x2d9c, L2d9c);
+L2d9c:
+    AOT_BLOCK(0x2d9c, 2);
+    // 2d9c: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2da0:
+    AOT_BLOCK(0x2da0, 3);
+    // 2da0: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2da4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2da4: jsr pc, 0246
+    {
+        a = 0x0246;
+        r[6] -= 2;
+        WR16(r[6], 0x2da8);
+    }
+    AOT_GOTO(0x0246, L0246);
+L2da8:
+    AOT_BLOCK(0x2da8, 3);
+    // 2da8: mov r0, 3448
+    {
+        src = r[0];
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 2dac: cmp $14, r0
+    {
+        src = uint16_t(0x0014);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2db0: bne 2dfe
+    if (!Z)
+        AOT_GOTO(0x2dfe, L2dfe);
+    AOT_GOTO(0x2db2, L2db2);
+L2db2:
+    AOT_BLOCK(0x2db2, 1);
+    // 2db2: jsr pc, 2e06
+    {
+        a = 0x2e06;
+        r[6] -= 2;
+        WR16(r[6], 0x2db6);
+    }
+    AOT_GOTO(0x2e06, L2e06);
+L2db6:
+    AOT_BLOCK(0x2db6, 2);
+    // 2db6: cmp $3b, r0
+    {
+        src = uint16_t(0x003b);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2dba: bne 2dfe
+    if (!Z)
+        AOT_GOTO(0x2dfe, L2dfe);
+    AOT_GOTO(0x2dbc, L2dbc);
+L2dbc:
+    AOT_BLOCK(0x2dbc, 3);
+    // 2dbc: mov 53f0, r4
+    {
+        a = 0x53f0;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2dc0: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2dc2: bne 2de0
+    if (!Z)
+        AOT_GOTO(0x2de0, L2de0);
+    AOT_GOTO(0x2dc4, L2dc4);
+L2dc4:
+    AOT_BLOCK(0x2dc4, 2);
+    // 2dc4: tst 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2dc8: bne 2de0
+    if (!Z)
+        AOT_GOTO(0x2de0, L2de0);
+    AOT_GOTO(0x2dca, L2dca);
+L2dca:
+    AOT_BLOCK(0x2dca, 3);
+    // 2dca: mov $18, 2(r4)
+    {
+        src = uint16_t(0x0018);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 2dd0: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2dd4: bne 2de0
+    if (!Z)
+        AOT_GOTO(0x2de0, L2de0);
+    AOT_GOTO(0x2dd6, L2dd6);
+L2dd6:
+    AOT_BLOCK(0x2dd6, 2);
+    // 2dd6: mov 3444, 6(r4)
+    {
+        a = 0x3444;
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 2ddc: inc 3444
+    {
+        a = 0x3444;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x2de0, L2de0);
+L2de0:
+    AOT_BLOCK(0x2de0, 2);
+    // 2de0: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2de2: beq 2dea
+    if (Z)
+        AOT_GOTO(0x2dea, L2dea);
+    AOT_GOTO(0x2de4, L2de4);
+L2de4:
+    AOT_BLOCK(0x2de4, 2);
+    // 2de4: cmpb $d, (r4)
+    {
+        src = uint8_t(0x0d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2de8: bne 2dfe
+    if (!Z)
+        AOT_GOTO(0x2dfe, L2dfe);
+    AOT_GOTO(0x2dea, L2dea);
+L2dea:
+    AOT_BLOCK(0x2dea, 2);
+    // 2dea: cmp $18, 2(r4)
+    {
+        src = uint16_t(0x0018);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2df0: bne 2dfe
+    if (!Z)
+        AOT_GOTO(0x2dfe, L2dfe);
+    AOT_GOTO(0x2df2, L2df2);
+L2df2:
+    AOT_BLOCK(0x2df2, 3);
+    // 2df2: mov $ffff, 3448
+    {
+        src = uint16_t(0xffff);
+        b = 0x3448;
+        WR16(b, src);
+    }
+    // 2df8: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2dfc: br 2e02
+    AOT_GOTO(0x2e02, L2e02);
+L2dfe:
+    AOT_BLOCK(0x2dfe, 2);
+    // 2dfe: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2e00: br 2e02
+    AOT_GOTO(0x2e02, L2e02);
+L2e02:
+    AOT_BLOCK(0x2e02, 2);
+    // 2e02: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2e06:
+    AOT_BLOCK(0x2e06, 2);
+    // 2e06: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2e0a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2e0a, L2e0a);
+L2e0a:
+    AOT_BLOCK(0x2e0a, 1);
+    // 2e0a: jsr pc, 2e24
+    {
+        a = 0x2e24;
+        r[6] -= 2;
+        WR16(r[6], 0x2e0e);
+    }
+    AOT_GOTO(0x2e24, L2e24);
+L2e0e:
+    AOT_BLOCK(0x2e0e, 2);
+    // 2e0e: cmp $20, r0
+    {
+        src = uint16_t(0x0020);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2e12: bne 2e1a
+    if (!Z)
+        AOT_GOTO(0x2e1a, L2e1a);
+    AOT_GOTO(0x2e14, L2e14);
+L2e14:
+    AOT_BLOCK(0x2e14, 2);
+    // 2e14: clr 4ffc
+    {
+        a = 0x4ffc;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2e18: br 2e0a
+    AOT_GOTO(0x2e0a, L2e0a);
+L2e1a:
+    AOT_BLOCK(0x2e1a, 2);
+    // 2e1a: mov 4ffc, r0
+    {
+        a = 0x4ffc;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2e1e: br 2e20
+    AOT_GOTO(0x2e20, L2e20);
+L2e20:
+    AOT_BLOCK(0x2e20, 2);
+    // 2e20: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2e24:
+    AOT_BLOCK(0x2e24, 5);
+    // 2e24: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2e28;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2e28: mov 4ffc, r4
+    {
+        a = 0x4ffc;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2e2c: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2e2e: bne 2e36
+    if (!Z)
+        AOT_GOTO(0x2e36, L2e36);
+    AOT_GOTO(0x2e30, L2e30);
+L2e30:
+    AOT_BLOCK(0x2e30, 1);
+    // 2e30: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x2e34);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L2e34:
+    AOT_BLOCK(0x2e34, 1);
+    // 2e34: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2e36, L2e36);
+L2e36:
+    AOT_BLOCK(0x2e36, 2);
+    // 2e36: cmp $9, r4
+    {
+        src = uint16_t(0x0009);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2e3a: bne 2e42
+    if (!Z)
+        AOT_GOTO(0x2e42, L2e42);
+    AOT_GOTO(0x2e3c, L2e3c);
+L2e3c:
+    AOT_BLOCK(0x2e3c, 2);
+    // 2e3c: mov $20, r4
+    {
+        src = uint16_t(0x0020);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2e40: br 2e6a
+    AOT_GOTO(0x2e6a, L2e6a);
+L2e42:
+    AOT_BLOCK(0x2e42, 2);
+    // 2e42: cmp $a, r4
+    {
+        src = uint16_t(0x000a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2e46: bne 2e5c
+    if (!Z)
+        AOT_GOTO(0x2e5c, L2e5c);
+    AOT_GOTO(0x2e48, L2e48);
+L2e48:
+    AOT_BLOCK(0x2e48, 3);
+    // 2e48: mov $20, r4
+    {
+        src = uint16_t(0x0020);
+        r[4] = src;
+    }
+    // 2e4c: tst 540a
+    {
+        a = 0x540a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2e50: bne 2e56
+    if (!Z)
+        AOT_GOTO(0x2e56, L2e56);
+    AOT_GOTO(0x2e52, L2e52);
+L2e52:
+    AOT_BLOCK(0x2e52, 1);
+    // 2e52: inc 344a
+    {
+        a = 0x344a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x2e56, L2e56);
+L2e56:
+    AOT_BLOCK(0x2e56, 2);
+    // 2e56: clr 540a
+    {
+        a = 0x540a;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2e5a: br 2e6a
+    AOT_GOTO(0x2e6a, L2e6a);
+L2e5c:
+    AOT_BLOCK(0x2e5c, 2);
+    // 2e5c: cmp $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2e60: bne 2e6a
+    if (!Z)
+        AOT_GOTO(0x2e6a, L2e6a);
+    AOT_GOTO(0x2e62, L2e62);
+L2e62:
+    AOT_BLOCK(0x2e62, 2);
+    // 2e62: inc 540a
+    {
+        a = 0x540a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 2e66: mov $20, r4
+    {
+        src = uint16_t(0x0020);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2e6a, L2e6a);
+L2e6a:
+    AOT_BLOCK(0x2e6a, 3);
+    // 2e6a: mov r4, 4ffc
+    {
+        src = r[4];
+        b = 0x4ffc;
+        WR16(b, src);
+    }
+    // 2e6e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2e70: br 2e72
+    AOT_GOTO(0x2e72, L2e72);
+L2e72:
+    AOT_BLOCK(0x2e72, 2);
+    // 2e72: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2e76:
+    AOT_BLOCK(0x2e76, 4);
+    // 2e76: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2e7a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2e7a: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2e7e: bne 2e88
+    if (!Z)
+        AOT_GOTO(0x2e88, L2e88);
+    AOT_GOTO(0x2e80, L2e80);
+L2e80:
+    AOT_BLOCK(0x2e80, 2);
+    // 2e80: mov $3d10, (sp)
+    {
+        src = uint16_t(0x3d10);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2e84: jsr pc, *$1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x2e88);
+    }
+    AOT_GOTO(0x1388, L1388);
+L2e88:
+    AOT_BLOCK(0x2e88, 2);
+    // 2e88: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2e8c:
+    AOT_BLOCK(0x2e8c, 3);
+    // 2e8c: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2e90;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2e90: jsr pc, 0736
+    {
+        a = 0x0736;
+        r[6] -= 2;
+        WR16(r[6], 0x2e94);
+    }
+    AOT_GOTO(0x0736, L0736);
+L2e94:
+    AOT_BLOCK(0x2e94, 4);
+    // 2e94: mov r0, *4c7c
+    {
+        src = r[0];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 2e98: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2e9e: mov $24, (sp)
+    {
+        src = uint16_t(0x0024);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ea2: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x2ea6);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L2ea6:
+    AOT_BLOCK(0x2ea6, 5);
+    // 2ea6: mov $ffff, (sp)
+    {
+        src = uint16_t(0xffff);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2eaa: sub $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x4c7c;
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 2eb0: mov *4c7c, r4
+    {
+        a = RD16(0x4c7c);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2eb4: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2eb6: jsr pc, *$132a
+    {
+        a = 0x132a;
+        r[6] -= 2;
+        WR16(r[6], 0x2eba);
+    }
+    AOT_GOTO(0x132a, L132a);
+L2eba:
+    AOT_BLOCK(0x2eba, 7);
+    // 2eba: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 2ebc: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2ebe: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 2ec0: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 2ec2: mov $66, -(sp)
+    {
+        src = uint16_t(0x0066);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2ec6: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2eca: jsr pc, *$13ce
+    {
+        a = 0x13ce;
+        r[6] -= 2;
+        WR16(r[6], 0x2ece);
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L2ece:
+    AOT_BLOCK(0x2ece, 3);
+    // 2ece: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 2ed2: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ed4: jsr pc, *$2b4a
+    {
+        a = 0x2b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x2ed8);
+    }
+    AOT_GOTO(0x2b4a, L2b4a);
+L2ed8:
+    AOT_BLOCK(0x2ed8, 2);
+    // 2ed8: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2edc:
+    AOT_BLOCK(0x2edc, 3);
+    // 2edc: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2ee0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2ee0: jsr pc, 2e06
+    {
+        a = 0x2e06;
+        r[6] -= 2;
+        WR16(r[6], 0x2ee4);
+    }
+    AOT_GOTO(0x2e06, L2e06);
+L2ee4:
+    AOT_BLOCK(0x2ee4, 2);
+    // 2ee4: cmp $3b, r0
+    {
+        src = uint16_t(0x003b);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2ee8: beq 2f36
+    if (Z)
+        AOT_GOTO(0x2f36, L2f36);
+    AOT_GOTO(0x2eea, L2eea);
+L2eea:
+    AOT_BLOCK(0x2eea, 1);
+    // 2eea: jsr pc, 0736
+    {
+        a = 0x0736;
+        r[6] -= 2;
+        WR16(r[6], 0x2eee);
+    }
+    AOT_GOTO(0x0736, L0736);
+L2eee:
+    AOT_BLOCK(0x2eee, 7);
+    // 2eee: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 2ef0: mov $3450, *4c7c
+    {
+        src = uint16_t(0x3450);
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 2ef6: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 2efc: mov r4, *4c7c
+    {
+        src = r[4];
+        b = RD16(0x4c7c);
+        WR16(b, src);
+    }
+    // 2f00: add $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2f06: mov $50, (sp)
+    {
+        src = uint16_t(0x0050);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f0a: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x2f0e);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L2f0e:
+    AOT_BLOCK(0x2f0e, 6);
+    // 2f0e: mov 4c7c, r0
+    {
+        a = 0x4c7c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2f12: mov 4c7c, r1
+    {
+        a = 0x4c7c;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2f16: mov -2(r1), r1
+    {
+        a = uint16_t(r[1] + -2);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2f1a: mov 8(r1), -2(r0)
+    {
+        a = uint16_t(r[1] + 8);
+        src = RD16(a);
+        b = uint16_t(r[0] + -2);
+        WR16(b, src);
+    }
+    // 2f20: mov $6e, (sp)
+    {
+        src = uint16_t(0x006e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f24: jsr pc, *$0b60
+    {
+        a = 0x0b60;
+        r[6] -= 2;
+        WR16(r[6], 0x2f28);
+    }
+    AOT_GOTO(0x0b60, L0b60);
+L2f28:
+    AOT_BLOCK(0x2f28, 3);
+    // 2f28: sub $2, 4c7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x4c7c;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x4c7c;
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 2f2e: mov *4c7c, (sp)
+    {
+        a = RD16(0x4c7c);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f32: jsr pc, *$2b4a
+    {
+        a = 0x2b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x2f36);
+    }
+    AOT_GOTO(0x2b4a, L2b4a);
+L2f36:
+    AOT_BLOCK(0x2f36, 2);
+    // 2f36: mov 4ff4, (sp)
+    {
+        a = 0x4ff4;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f3a: jsr pc, *$2c6e
+    {
+        a = 0x2c6e;
+        r[6] -= 2;
+        WR16(r[6], 0x2f3e);
+    }
+    AOT_GOTO(0x2c6e, L2c6e);
+L2f3e:
+    AOT_BLOCK(0x2f3e, 2);
+    // 2f3e: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2f42:
+    AOT_BLOCK(0x2f42, 7);
+    // 2f42: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2f46;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2f46: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2f4a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2f4c: add $4, (sp)
+    {
+        src = uint16_t(0x0004);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2f50: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f54: jsr pc, *$33ee
+    {
+        a = 0x33ee;
+        r[6] -= 2;
+        WR16(r[6], 0x2f58);
+    }
+    AOT_GOTO(0x33ee, L33ee);
+L2f58:
+    AOT_BLOCK(0x2f58, 3);
+    // 2f58: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 2f5a: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2f5e:
+    AOT_BLOCK(0x2f5e, 6);
+    // 2f5e: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2f62;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2f62: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 2f66: mov $54d4, r2
+    {
+        src = uint16_t(0x54d4);
+        r[2] = src;
+    }
+    // 2f6a: tst 5404
+    {
+        a = 0x5404;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2f6e: beq 2f74
+    if (Z)
+        AOT_GOTO(0x2f74, L2f74);
+    AOT_GOTO(0x2f70, L2f70);
+L2f70:
+    AOT_BLOCK(0x2f70, 1);
+    // 2f70: mov $56da, r2
+    {
+        src = uint16_t(0x56da);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2f74, L2f74);
+L2f74:
+    AOT_BLOCK(0x2f74, 2);
+    // 2f74: mov r5, r3
+    {
+        src = r[5];
+        r[3] = src;
+    }
+    // 2f76: add $6, r3
+    {
+        src = uint16_t(0x0006);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2f7a, L2f7a);
+L2f7a:
+    AOT_BLOCK(0x2f7a, 3);
+    // 2f7a: movb *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2f7e: inc 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 2f82: br 2ffa
+    AOT_GOTO(0x2ffa, L2ffa);
+L2f84:
+    AOT_BLOCK(0x2f84, 4);
+    // 2f84: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2f86: mov (r3)+, -(sp)
+    {
+        a = r[3];
+        r[3] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2f88: bis $fe00, (sp)
+    {
+        src = uint16_t(0xfe00);
+        b = r[6];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2f8c: jsr pc, *$3348
+    {
+        a = 0x3348;
+        r[6] -= 2;
+        WR16(r[6], 0x2f90);
+    }
+    AOT_GOTO(0x3348, L3348);
+L2f90:
+    AOT_BLOCK(0x2f90, 2);
+    // 2f90: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2f92: br 2f7a
+    AOT_GOTO(0x2f7a, L2f7a);
+L2f94:
+    AOT_BLOCK(0x2f94, 3);
+    // 2f94: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2f96: mov (r3)+, -(sp)
+    {
+        a = r[3];
+        r[3] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f98: jsr pc, *$3348
+    {
+        a = 0x3348;
+        r[6] -= 2;
+        WR16(r[6], 0x2f9c);
+    }
+    AOT_GOTO(0x3348, L3348);
+L2f9c:
+    AOT_BLOCK(0x2f9c, 2);
+    // 2f9c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2f9e: br 2f7a
+    AOT_GOTO(0x2f7a, L2f7a);
+L2fa0:
+    AOT_BLOCK(0x2fa0, 2);
+    // 2fa0: mov (r3)+, -a(r5)
+    {
+        a = r[3];
+        r[3] += 2;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 2fa4: mov $8, -8(r5)
+    {
+        src = uint16_t(0x0008);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2faa, L2faa);
+L2faa:
+    AOT_BLOCK(0x2faa, 4);
+    // 2faa: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2fae: dec -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 2fb2: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2fb4: beq 2fd0
+    if (Z)
+        AOT_GOTO(0x2fd0, L2fd0);
+    AOT_GOTO(0x2fb6, L2fb6);
+L2fb6:
+    AOT_BLOCK(0x2fb6, 2);
+    // 2fb6: tstb *-a(r5)
+    {
+        a = RD16(r[5] + -10);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2fba: beq 2fd0
+    if (Z)
+        AOT_GOTO(0x2fd0, L2fd0);
+    AOT_GOTO(0x2fbc, L2fbc);
+L2fbc:
+    AOT_BLOCK(0x2fbc, 5);
+    // 2fbc: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2fbe: movb *-a(r5), r0
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2fc2: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2fc4: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 2fc8: jsr pc, *$3386
+    {
+        a = 0x3386;
+        r[6] -= 2;
+        WR16(r[6], 0x2fcc);
+    }
+    AOT_GOTO(0x3386, L3386);
+L2fcc:
+    AOT_BLOCK(0x2fcc, 2);
+    // 2fcc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2fce: br 2faa
+    AOT_GOTO(0x2faa, L2faa);
+L2fd0:
+    AOT_BLOCK(0x2fd0, 3);
+    // 2fd0: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2fd2: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2fd4: jsr pc, *$3386
+    {
+        a = 0x3386;
+        r[6] -= 2;
+        WR16(r[6], 0x2fd8);
+    }
+    AOT_GOTO(0x3386, L3386);
+L2fd8:
+    AOT_BLOCK(0x2fd8, 2);
+    // 2fd8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2fda: br 2f7a
+    AOT_GOTO(0x2f7a, L2f7a);
+L2fdc:
+    AOT_BLOCK(0x2fdc, 3);
+    // 2fdc: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2fde: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2fe2: jsr pc, *$3348
+    {
+        a = 0x3348;
+        r[6] -= 2;
+        WR16(r[6], 0x2fe6);
+    }
+    AOT_GOTO(0x3348, L3348);
+L2fe6:
+    AOT_BLOCK(0x2fe6, 2);
+    // 2fe6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2fe8: br 2f7a
+    AOT_GOTO(0x2f7a, L2f7a);
+L2fea:
+    AOT_BLOCK(0x2fea, 3);
+    // 2fea: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2fec: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2fee: jsr pc, *$3348
+    {
+        a = 0x3348;
+        r[6] -= 2;
+        WR16(r[6], 0x2ff2);
+    }
+    AOT_GOTO(0x3348, L3348);
+L2ff2:
+    AOT_BLOCK(0x2ff2, 2);
+    // 2ff2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2ff4: br 2f7a
+    AOT_GOTO(0x2f7a, L2f7a);
+L2ff6:
+    AOT_BLOCK(0x2ff6, 1);
+    // 2ff6: br 3014
+    AOT_GOTO(0x3014, L3014);
+L2ffa:
+    AOT_BLOCK(0x2ffa, 2);
+    // 2ffa: mov $3c98, r1
+    {
+        src = uint16_t(0x3c98);
+        r[1] = src;
+    }
+    // 2ffe: mov r0, 3ca4
+    {
+        src = r[0];
+        b = 0x3ca4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3002, L3002);
+L3002:
+    AOT_BLOCK(0x3002, 2);
+    // 3002: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3004: bne 3002
+    if (!Z)
+        AOT_GOTO(0x3002, L3002);
+    AOT_GOTO(0x3006, L3006);
+L3006:
+    AOT_BLOCK(0x3006, 1);
+    // 3006: jmp *c(r1)
+    {
+        a = RD16(r[1] + 12);
+    }
+    AOT_JUMP(a);
+L300a:
+    AOT_BLOCK(0x300a, 1);
+    // 300a: br 2f7a
+    AOT_GOTO(0x2f7a, L2f7a);
+L3014:
+    AOT_BLOCK(0x3014, 2);
+    // 3014: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3018:
+    AOT_BLOCK(0x3018, 6);
+    // 3018: clr 5af2
+    {
+        a = 0x5af2;
+        WR16(a, 0);
+    }
+    // 301c: clr 5af6
+    {
+        a = 0x5af6;
+        WR16(a, 0);
+    }
+    // 3020: clr 5af4
+    {
+        a = 0x5af4;
+        WR16(a, 0);
+    }
+    // 3024: clr 53f2
+    {
+        a = 0x53f2;
+        WR16(a, 0);
+        C = false;
+    }
+    // 3028: mov 2(sp), 5af0
+    {
+        a = uint16_t(r[6] + 2);
+        src = RD16(a);
+        b = 0x5af0;
+        WR16(b, src);
+    }
+    // 302e: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3030, L3030);
+L3030:
+    AOT_BLOCK(0x3030, 1);
+    // 3030: jsr r5, 30e2
+    {
+        a = 0x30e2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x3034;
+    }
+    AOT_GOTO(0x30e2, L30e2);
+L3034:
+    AOT_BLOCK(0x3034, 1);
+    // 3034: br 303c
+    AOT_GOTO(0x303c, L303c);
+L303c:
+    AOT_BLOCK(0x303c, 2);
+    // 303c: tst 5af4
+    {
+        a = 0x5af4;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3040: bne 3052
+    if (!Z)
+        AOT_GOTO(0x3052, L3052);
+    AOT_GOTO(0x3042, L3042);
+L3042:
+    AOT_BLOCK(0x3042, 3);
+    // 3042: clr 5af2
+    {
+        a = 0x5af2;
+        WR16(a, 0);
+    }
+    // 3046: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 304a: bne 3052
+    if (!Z)
+        AOT_GOTO(0x3052, L3052);
+    AOT_GOTO(0x304c, L304c);
+L304c:
+    AOT_BLOCK(0x304c, 2);
+    // 304c: mov pc, 5af4
+    {
+        src = uint16_t(0x304e);
+        b = 0x5af4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3050: br 3030
+    AOT_GOTO(0x3030, L3030);
+L3052:
+    AOT_BLOCK(0x3052, 2);
+    // 3052: tst 5af6
+    {
+        a = 0x5af6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3056: beq 30a0
+    if (Z)
+        AOT_GOTO(0x30a0, L30a0);
+    AOT_GOTO(0x3058, L3058);
+L3058:
+    AOT_BLOCK(0x3058, 2);
+    // 3058: cmp r0, $65
+    {
+        src = r[0];
+        dst = uint16_t(0x0065);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 305c: bne 30a0
+    if (!Z)
+        AOT_GOTO(0x30a0, L30a0);
+    AOT_GOTO(0x305e, L305e);
+L305e:
+    AOT_BLOCK(0x305e, 6);
+    // 305e: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 3060: clr 53f2
+    {
+        a = 0x53f2;
+        WR16(a, 0);
+    }
+    // 3064: mov pc, 5af4
+    {
+        src = uint16_t(0x3066);
+        b = 0x5af4;
+        WR16(b, src);
+    }
+    // 3068: clr 53f2
+    {
+        a = 0x53f2;
+        WR16(a, 0);
+        C = false;
+    }
+    // 306c: mov $a, 5af0
+    {
+        src = uint16_t(0x000a);
+        b = 0x5af0;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3072: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x3076);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L3076:
+    AOT_BLOCK(0x3076, 2);
+    // 3076: cmp r0, $2b
+    {
+        src = r[0];
+        dst = uint16_t(0x002b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 307a: beq 308a
+    if (Z)
+        AOT_GOTO(0x308a, L308a);
+    AOT_GOTO(0x307c, L307c);
+L307c:
+    AOT_BLOCK(0x307c, 2);
+    // 307c: cmp r0, $2d
+    {
+        src = r[0];
+        dst = uint16_t(0x002d);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3080: bne 3086
+    if (!Z)
+        AOT_GOTO(0x3086, L3086);
+    AOT_GOTO(0x3082, L3082);
+L3082:
+    AOT_BLOCK(0x3082, 2);
+    // 3082: inc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 3084: br 308a
+    AOT_GOTO(0x308a, L308a);
+L3086:
+    AOT_BLOCK(0x3086, 1);
+    // 3086: mov r0, 4ffc
+    {
+        src = r[0];
+        b = 0x4ffc;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x308a, L308a);
+L308a:
+    AOT_BLOCK(0x308a, 1);
+    // 308a: jsr r5, 30e2
+    {
+        a = 0x30e2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x308e;
+    }
+    AOT_GOTO(0x30e2, L30e2);
+L308e:
+    AOT_BLOCK(0x308e, 1);
+    // 308e: br 3092
+    AOT_GOTO(0x3092, L3092);
+L3092:
+    AOT_BLOCK(0x3092, 2);
+    // 3092: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3094: beq 309a
+    if (Z)
+        AOT_GOTO(0x309a, L309a);
+    AOT_GOTO(0x3096, L3096);
+L3096:
+    AOT_BLOCK(0x3096, 1);
+    // 3096: neg 53f2
+    {
+        a = 0x53f2;
+        val = -int16_t(RD16(a));
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x309a, L309a);
+L309a:
+    AOT_BLOCK(0x309a, 1);
+    // 309a: sub 53f2, 5af2
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        b = 0x5af2;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x5af2;
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x30a0, L30a0);
+L30a0:
+    AOT_BLOCK(0x30a0, 3);
+    // 30a0: mov r0, 4ffc
+    {
+        src = r[0];
+        b = 0x4ffc;
+        WR16(b, src);
+    }
+    // 30a4: tst 5af6
+    {
+        a = 0x5af6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 30a8: bne 30b2
+    if (!Z)
+        AOT_GOTO(0x30b2, L30b2);
+    AOT_GOTO(0x30aa, L30aa);
+L30aa:
+    AOT_BLOCK(0x30aa, 1);
+    // 30aa: mov $27, r0
+    {
+        src = uint16_t(0x0027);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x30ae, L30ae);
+L30ae:
+    AOT_BLOCK(0x30ae, 2);
+    // 30ae: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 30b0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L30b2:
+    AOT_BLOCK(0x30b2, 2);
+    // 30b2: tst 5af4
+    {
+        a = 0x5af4;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 30b6: bne 30be
+    if (!Z)
+        AOT_GOTO(0x30be, L30be);
+    AOT_GOTO(0x30b8, L30b8);
+L30b8:
+    AOT_BLOCK(0x30b8, 2);
+    // 30b8: mov $15, r0
+    {
+        src = uint16_t(0x0015);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 30bc: br 30ae
+    AOT_GOTO(0x30ae, L30ae);
+L30be:
+    AOT_BLOCK(0x30be, 2);
+    // 30be: mov $30ce, -(sp)
+    {
+        src = uint16_t(0x30ce);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 30c2: jsr pc, 1388
+    {
+        a = 0x1388;
+        r[6] -= 2;
+        WR16(r[6], 0x30c6);
+    }
+    AOT_GOTO(0x1388, L1388);
+L30c6:
+    AOT_BLOCK(0x30c6, 3);
+    // 30c6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 30c8: mov $15, r0
+    {
+        src = uint16_t(0x0015);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 30cc: br 30ae
+    AOT_GOTO(0x30ae, L30ae);
+L30e2:
+    AOT_BLOCK(0x30e2, 2);
+    // 30e2: mov 4ffc, r0
+    {
+        a = 0x4ffc;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 30e6: beq 30ee
+    if (Z)
+        AOT_GOTO(0x30ee, L30ee);
+    AOT_GOTO(0x30e8, L30e8);
+L30e8:
+    AOT_BLOCK(0x30e8, 2);
+    // 30e8: clr 4ffc
+    {
+        a = 0x4ffc;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 30ec: br 30f2
+    AOT_GOTO(0x30f2, L30f2);
+L30ee:
+    AOT_BLOCK(0x30ee, 1);
+    // 30ee: jsr pc, 32ca
+    {
+        a = 0x32ca;
+        r[6] -= 2;
+        WR16(r[6], 0x30f2);
+    }
+    AOT_GOTO(0x32ca, L32ca);
+L30f2:
+    AOT_BLOCK(0x30f2, 3);
+    // 30f2: sub $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 30f6: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 30fa: bhi 3112
+    if (!(C | Z))
+        AOT_GOTO(0x3112, L3112);
+    AOT_GOTO(0x30fc, L30fc);
+L30fc:
+    AOT_BLOCK(0x30fc, 1);
+    // 30fc: inc 5af6
+    {
+        a = 0x5af6;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x3100, L3100);
+L3100:
+    AOT_BLOCK(0x3100, 6);
+    // 3100: mov 53f2, r1
+    {
+        a = 0x53f2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 3104: mul 5af0, r1
+    {
+        a = 0x5af0;
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 3108: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 310a: mov r1, 53f2
+    {
+        src = r[1];
+        b = 0x53f2;
+        WR16(b, src);
+    }
+    // 310e: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3110: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3112:
+    AOT_BLOCK(0x3112, 2);
+    // 3112: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 3116: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3118:
+    AOT_BLOCK(0x3118, 6);
+    // 3118: jsr r5, 341a
+    {
+        a = 0x341a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x311c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 311c: sub $7e, sp
+    {
+        src = uint16_t(0x007e);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 3120: mov 4(r5), 5afa
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x5afa;
+        WR16(b, src);
+    }
+    // 3126: mov r5, r4
+    {
+        src = r[5];
+        r[4] = src;
+    }
+    // 3128: add $6, r4
+    {
+        src = uint16_t(0x0006);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x312c, L312c);
+L312c:
+    AOT_BLOCK(0x312c, 2);
+    // 312c: movb *5afa, r0
+    {
+        a = RD16(0x5afa);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 3130: beq 3144
+    if (Z)
+        AOT_GOTO(0x3144, L3144);
+    AOT_GOTO(0x3132, L3132);
+L3132:
+    AOT_BLOCK(0x3132, 3);
+    // 3132: inc 5afa
+    {
+        a = 0x5afa;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 3136: cmp r0, $25
+    {
+        src = r[0];
+        dst = uint16_t(0x0025);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 313a: beq 3148
+    if (Z)
+        AOT_GOTO(0x3148, L3148);
+    AOT_GOTO(0x313c, L313c);
+L313c:
+    AOT_BLOCK(0x313c, 2);
+    // 313c: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 313e: jsr pc, *$2f42
+    {
+        a = 0x2f42;
+        r[6] -= 2;
+        WR16(r[6], 0x3142);
+    }
+    AOT_GOTO(0x2f42, L2f42);
+L3142:
+    AOT_BLOCK(0x3142, 1);
+    // 3142: br 312c
+    AOT_GOTO(0x312c, L312c);
+L3144:
+    AOT_BLOCK(0x3144, 2);
+    // 3144: jmp 3428
+    {
+        a = 0x3428;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3148:
+    AOT_BLOCK(0x3148, 4);
+    // 3148: clr 5afc
+    {
+        a = 0x5afc;
+        WR16(a, 0);
+    }
+    // 314c: clr 5b00
+    {
+        a = 0x5b00;
+        WR16(a, 0);
+    }
+    // 3150: cmpb *5afa, $2d
+    {
+        a = RD16(0x5afa);
+        src = RD8(a);
+        dst = uint8_t(0x2d);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 3156: bne 3160
+    if (!Z)
+        AOT_GOTO(0x3160, L3160);
+    AOT_GOTO(0x3158, L3158);
+L3158:
+    AOT_BLOCK(0x3158, 2);
+    // 3158: inc 5afa
+    {
+        a = 0x5afa;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 315c: inc 5afc
+    {
+        a = 0x5afc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x3160, L3160);
+L3160:
+    AOT_BLOCK(0x3160, 1);
+    // 3160: jsr r3, 328c
+    {
+        a = 0x328c;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x3164;
+    }
+    AOT_GOTO(0x328c, L328c);
+L3164:
+    AOT_BLOCK(0x3164, 4);
+    // 3164: mov r1, 5af8
+    {
+        src = r[1];
+        b = 0x5af8;
+        WR16(b, src);
+    }
+    // 3168: clr 5afe
+    {
+        a = 0x5afe;
+        WR16(a, 0);
+    }
+    // 316c: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3170: bne 317a
+    if (!Z)
+        AOT_GOTO(0x317a, L317a);
+    AOT_GOTO(0x3172, L3172);
+L3172:
+    AOT_BLOCK(0x3172, 1);
+    // 3172: jsr r3, 328c
+    {
+        a = 0x328c;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x3176;
+    }
+    AOT_GOTO(0x328c, L328c);
+L3176:
+    AOT_BLOCK(0x3176, 1);
+    // 3176: mov r1, 5b00
+    {
+        src = r[1];
+        b = 0x5b00;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x317a, L317a);
+L317a:
+    AOT_BLOCK(0x317a, 3);
+    // 317a: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 317c: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 3180: mov $3ea4, r1
+    {
+        src = uint16_t(0x3ea4);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3184, L3184);
+L3184:
+    AOT_BLOCK(0x3184, 2);
+    // 3184: mov (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3186: beq 313c
+    if (Z)
+        AOT_GOTO(0x313c, L313c);
+    AOT_GOTO(0x3188, L3188);
+L3188:
+    AOT_BLOCK(0x3188, 2);
+    // 3188: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 318a: bne 3184
+    if (!Z)
+        AOT_GOTO(0x3184, L3184);
+    AOT_GOTO(0x318c, L318c);
+L318c:
+    AOT_BLOCK(0x318c, 1);
+    // 318c: jmp (r2)
+    {
+        a = r[2];
+    }
+    AOT_JUMP(a);
+L318e:
+    AOT_BLOCK(0x318e, 2);
+    // 318e: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3190: bge 319c
+    if (!(N ^ V))
+        AOT_GOTO(0x319c, L319c);
+    AOT_GOTO(0x3192, L3192);
+L3192:
+    AOT_BLOCK(0x3192, 3);
+    // 3192: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 3194: movb $2d, (r3)+
+    {
+        src = uint8_t(0x2d);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 3198: br 319c
+    AOT_GOTO(0x319c, L319c);
+L319a:
+    AOT_BLOCK(0x319a, 1);
+    // 319a: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x319c, L319c);
+L319c:
+    AOT_BLOCK(0x319c, 1);
+    // 319c: jsr pc, 31a2
+    {
+        a = 0x31a2;
+        r[6] -= 2;
+        WR16(r[6], 0x31a0);
+    }
+    AOT_GOTO(0x31a2, L31a2);
+L31a0:
+    AOT_BLOCK(0x31a0, 1);
+    // 31a0: br 3246
+    AOT_GOTO(0x3246, L3246);
+L31a2:
+    AOT_BLOCK(0x31a2, 5);
+    // 31a2: clr r0
+    {
+        r[0] = 0;
+    }
+    // 31a4: div $a, r0
+    {
+        src = int16_t(uint16_t(0x000a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 31a8: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 31aa: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 31ac: beq 31b2
+    if (Z)
+        AOT_GOTO(0x31b2, L31b2);
+    AOT_GOTO(0x31ae, L31ae);
+L31ae:
+    AOT_BLOCK(0x31ae, 1);
+    // 31ae: jsr pc, 31a2
+    {
+        a = 0x31a2;
+        r[6] -= 2;
+        WR16(r[6], 0x31b2);
+    }
+    AOT_GOTO(0x31a2, L31a2);
+L31b2:
+    AOT_BLOCK(0x31b2, 4);
+    // 31b2: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 31b4: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 31b8: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 31ba: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L31bc:
+    AOT_BLOCK(0x31bc, 2);
+    // 31bc: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 31be: bne 31c2
+    if (!Z)
+        AOT_GOTO(0x31c2, L31c2);
+    AOT_GOTO(0x31c0, L31c0);
+L31c0:
+    AOT_BLOCK(0x31c0, 1);
+    // 31c0: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x31c2, L31c2);
+L31c2:
+    AOT_BLOCK(0x31c2, 2);
+    // 31c2: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 31c4: bne 3246
+    if (!Z)
+        AOT_GOTO(0x3246, L3246);
+    AOT_GOTO(0x31c6, L31c6);
+L31c6:
+    AOT_BLOCK(0x31c6, 2);
+    // 31c6: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 31c8: br 3246
+    AOT_GOTO(0x3246, L3246);
+L31ca:
+    AOT_BLOCK(0x31ca, 3);
+    // 31ca: mov 5b00, r1
+    {
+        a = 0x5b00;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 31ce: clr r3
+    {
+        r[3] = 0;
+        C = false;
+    }
+    // 31d0: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x31d2, L31d2);
+L31d2:
+    AOT_BLOCK(0x31d2, 2);
+    // 31d2: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 31d4: beq 31da
+    if (Z)
+        AOT_GOTO(0x31da, L31da);
+    AOT_GOTO(0x31d6, L31d6);
+L31d6:
+    AOT_BLOCK(0x31d6, 2);
+    // 31d6: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 31d8: sob r1, 4
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x31d2, L31d2);
+    AOT_GOTO(0x31da, L31da);
+L31da:
+    AOT_BLOCK(0x31da, 2);
+    // 31da: mov (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 31dc: br 324e
+    AOT_GOTO(0x324e, L324e);
+L31de:
+    AOT_BLOCK(0x31de, 2);
+    // 31de: mov $3ecc, r2
+    {
+        src = uint16_t(0x3ecc);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 31e2: br 31e8
+    AOT_GOTO(0x31e8, L31e8);
+L31e4:
+    AOT_BLOCK(0x31e4, 1);
+    // 31e4: mov $3ed0, r2
+    {
+        src = uint16_t(0x3ed0);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x31e8, L31e8);
+L31e8:
+    AOT_BLOCK(0x31e8, 2);
+    // 31e8: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 31ea: beq 31f6
+    if (Z)
+        AOT_GOTO(0x31f6, L31f6);
+    AOT_GOTO(0x31ec, L31ec);
+L31ec:
+    AOT_BLOCK(0x31ec, 2);
+    // 31ec: tst 5b00
+    {
+        a = 0x5b00;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 31f0: beq 31f6
+    if (Z)
+        AOT_GOTO(0x31f6, L31f6);
+    AOT_GOTO(0x31f2, L31f2);
+L31f2:
+    AOT_BLOCK(0x31f2, 1);
+    // 31f2: movb $30, (r3)+
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x31f6, L31f6);
+L31f6:
+    AOT_BLOCK(0x31f6, 2);
+    // 31f6: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 31f8: jsr pc, 31fe
+    {
+        a = 0x31fe;
+        r[6] -= 2;
+        WR16(r[6], 0x31fc);
+    }
+    AOT_GOTO(0x31fe, L31fe);
+L31fc:
+    AOT_BLOCK(0x31fc, 1);
+    // 31fc: br 3246
+    AOT_GOTO(0x3246, L3246);
+L31fe:
+    AOT_BLOCK(0x31fe, 3);
+    // 31fe: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3200: ashc (r2), r0
+    {
+        a = r[2];
+        src = RD16(a) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 3202: beq 3208
+    if (Z)
+        AOT_GOTO(0x3208, L3208);
+    AOT_GOTO(0x3204, L3204);
+L3204:
+    AOT_BLOCK(0x3204, 1);
+    // 3204: jsr pc, 31fe
+    {
+        a = 0x31fe;
+        r[6] -= 2;
+        WR16(r[6], 0x3208);
+    }
+    AOT_GOTO(0x31fe, L31fe);
+L3208:
+    AOT_BLOCK(0x3208, 5);
+    // 3208: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 320a: bic 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 320e: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 3212: cmp r0, $39
+    {
+        src = r[0];
+        dst = uint16_t(0x0039);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3216: ble 321c
+    if (Z || (N ^ V))
+        AOT_GOTO(0x321c, L321c);
+    AOT_GOTO(0x3218, L3218);
+L3218:
+    AOT_BLOCK(0x3218, 1);
+    // 3218: add $7, r0
+    {
+        src = uint16_t(0x0007);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x321c, L321c);
+L321c:
+    AOT_BLOCK(0x321c, 2);
+    // 321c: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 321e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3220:
+    AOT_BLOCK(0x3220, 3);
+    // 3220: mov 5b00, r0
+    {
+        a = 0x5b00;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3224: mov 5afe, r2
+    {
+        a = 0x5afe;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3228: jsr pc, 32c0
+    {
+        a = 0x32c0;
+        r[6] -= 2;
+        WR16(r[6], 0x322c);
+    }
+    AOT_GOTO(0x32c0, L32c0);
+L322c:
+    AOT_BLOCK(0x322c, 1);
+    // 322c: br 3246
+    AOT_GOTO(0x3246, L3246);
+L322e:
+    AOT_BLOCK(0x322e, 3);
+    // 322e: mov 5b00, r0
+    {
+        a = 0x5b00;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3232: mov 5afe, r2
+    {
+        a = 0x5afe;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3236: jsr pc, 32c0
+    {
+        a = 0x32c0;
+        r[6] -= 2;
+        WR16(r[6], 0x323a);
+    }
+    AOT_GOTO(0x32c0, L32c0);
+L323a:
+    AOT_BLOCK(0x323a, 1);
+    // 323a: br 3246
+    AOT_GOTO(0x3246, L3246);
+L323c:
+    AOT_BLOCK(0x323c, 3);
+    // 323c: mov (r4)+, r4
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 323e: mov (r4)+, 5afa
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = 0x5afa;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3242: jmp 312c
+    {
+        a = 0x312c;
+    }
+    AOT_GOTO(0x312c, L312c);
+L3246:
+    AOT_BLOCK(0x3246, 3);
+    // 3246: mov sp, r2
+    {
+        src = r[6];
+        r[2] = src;
+    }
+    // 3248: add $4, r2
+    {
+        src = uint16_t(0x0004);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 324c: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x324e, L324e);
+L324e:
+    AOT_BLOCK(0x324e, 6);
+    // 324e: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3250: mov $20, -(sp)
+    {
+        src = uint16_t(0x0020);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3254: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+    }
+    // 3256: neg r3
+    {
+        val = -int16_t(r[3]);
+        r[3] = val;
+    }
+    // 3258: add 5af8, r3
+    {
+        a = 0x5af8;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 325c: ble 326a
+    if (Z || (N ^ V))
+        AOT_GOTO(0x326a, L326a);
+    AOT_GOTO(0x325e, L325e);
+L325e:
+    AOT_BLOCK(0x325e, 2);
+    // 325e: tst 5afc
+    {
+        a = 0x5afc;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3262: bne 326a
+    if (!Z)
+        AOT_GOTO(0x326a, L326a);
+    AOT_GOTO(0x3264, L3264);
+L3264:
+    AOT_BLOCK(0x3264, 1);
+    // 3264: jsr pc, *$2f42
+    {
+        a = 0x2f42;
+        r[6] -= 2;
+        WR16(r[6], 0x3268);
+    }
+    AOT_GOTO(0x2f42, L2f42);
+L3268:
+    AOT_BLOCK(0x3268, 1);
+    // 3268: sob r3, 3
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x3264, L3264);
+    AOT_GOTO(0x326a, L326a);
+L326a:
+    AOT_BLOCK(0x326a, 2);
+    // 326a: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 326c: beq 3276
+    if (Z)
+        AOT_GOTO(0x3276, L3276);
+    AOT_GOTO(0x326e, L326e);
+L326e:
+    AOT_BLOCK(0x326e, 2);
+    // 326e: movb (r2)+, (sp)
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[6];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 3270: jsr pc, *$2f42
+    {
+        a = 0x2f42;
+        r[6] -= 2;
+        WR16(r[6], 0x3274);
+    }
+    AOT_GOTO(0x2f42, L2f42);
+L3274:
+    AOT_BLOCK(0x3274, 1);
+    // 3274: sob r4, 4
+    {
+        r[4]--;
+    }
+    if (r[4] != 0)
+        AOT_GOTO(0x326e, L326e);
+    AOT_GOTO(0x3276, L3276);
+L3276:
+    AOT_BLOCK(0x3276, 2);
+    // 3276: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3278: ble 3284
+    if (Z || (N ^ V))
+        AOT_GOTO(0x3284, L3284);
+    AOT_GOTO(0x327a, L327a);
+L327a:
+    AOT_BLOCK(0x327a, 1);
+    // 327a: mov $20, (sp)
+    {
+        src = uint16_t(0x0020);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x327e, L327e);
+L327e:
+    AOT_BLOCK(0x327e, 1);
+    // 327e: jsr pc, *$2f42
+    {
+        a = 0x2f42;
+        r[6] -= 2;
+        WR16(r[6], 0x3282);
+    }
+    AOT_GOTO(0x2f42, L2f42);
+L3282:
+    AOT_BLOCK(0x3282, 1);
+    // 3282: sob r3, 3
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x327e, L327e);
+    AOT_GOTO(0x3284, L3284);
+L3284:
+    AOT_BLOCK(0x3284, 3);
+    // 3284: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 3286: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3288: jmp 312c
+    {
+        a = 0x312c;
+    }
+    AOT_GOTO(0x312c, L312c);
+L328c:
+    AOT_BLOCK(0x328c, 2);
+    // 328c: clr 5afe
+    {
+        a = 0x5afe;
+        WR16(a, 0);
+    }
+    // 3290: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x3292, L3292);
+L3292:
+    AOT_BLOCK(0x3292, 5);
+    // 3292: movb *5afa, r0
+    {
+        a = RD16(0x5afa);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 3296: inc 5afa
+    {
+        a = 0x5afa;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 329a: sub $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 329e: cmp r0, $fffa
+    {
+        src = r[0];
+        dst = uint16_t(0xfffa);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 32a2: bne 32a8
+    if (!Z)
+        AOT_GOTO(0x32a8, L32a8);
+    AOT_GOTO(0x32a4, L32a4);
+L32a4:
+    AOT_BLOCK(0x32a4, 2);
+    // 32a4: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 32a6: br 32ae
+    AOT_GOTO(0x32ae, L32ae);
+L32a8:
+    AOT_BLOCK(0x32a8, 2);
+    // 32a8: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 32ac: bhi 32ba
+    if (!(C | Z))
+        AOT_GOTO(0x32ba, L32ba);
+    AOT_GOTO(0x32ae, L32ae);
+L32ae:
+    AOT_BLOCK(0x32ae, 4);
+    // 32ae: inc 5afe
+    {
+        a = 0x5afe;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 32b2: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 32b6: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 32b8: br 3292
+    AOT_GOTO(0x3292, L3292);
+L32ba:
+    AOT_BLOCK(0x32ba, 2);
+    // 32ba: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 32be: rts r3
+    {
+        b = r[3];
+        r[3] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L32c0:
+    AOT_BLOCK(0x32c0, 3);
+    // 32c0: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 32c4: movb $3f, (r3)+
+    {
+        src = uint8_t(0x3f);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 32c8: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L32ca:
+    AOT_BLOCK(0x32ca, 4);
+    // 32ca: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 32cc: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 32ce: dec 58e6
+    {
+        a = 0x58e6;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 32d2: bge 32f0
+    if (!(N ^ V))
+        AOT_GOTO(0x32f0, L32f0);
+    AOT_GOTO(0x32d4, L32d4);
+L32d4:
+    AOT_BLOCK(0x32d4, 2);
+    // 32d4: mov $58ea, 58e8
+    {
+        src = uint16_t(0x58ea);
+        b = 0x58e8;
+        WR16(b, src);
+    }
+    // 32da: mov 58e4, r0
+    {
+        a = 0x58e4;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 32de: sys 3
+    AOT_INTERP(0x32de);
+L32e0:
+    AOT_BLOCK(0x32e0, 1);
+    // 32e0: bis -(r3), *-(r2)
+    {
+        r[3] -= 2;
+        a = r[3];
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x32e2, L32e2);
+L32e2:
+    AOT_BLOCK(0x32e2, 1);
+    // 32e2: bne 32e4
+    if (!Z)
+        AOT_GOTO(0x32e4, L32e4);
+    AOT_GOTO(0x32e4, L32e4);
+L32e4:
+    AOT_BLOCK(0x32e4, 1);
+    // 32e4: bcs 32fe
+    if (C)
+        AOT_GOTO(0x32fe, L32fe);
+    AOT_GOTO(0x32e6, L32e6);
+L32e6:
+    AOT_BLOCK(0x32e6, 1);
+    // 32e6: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x32e8, L32e8);
+L32e8:
+    AOT_BLOCK(0x32e8, 1);
+    // 32e8: beq 32fe
+    if (Z)
+        AOT_GOTO(0x32fe, L32fe);
+    AOT_GOTO(0x32ea, L32ea);
+L32ea:
+    AOT_BLOCK(0x32ea, 2);
+    // 32ea: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+    }
+    // 32ec: mov r0, 58e6
+    {
+        src = r[0];
+        b = 0x58e6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x32f0, L32f0);
+L32f0:
+    AOT_BLOCK(0x32f0, 5);
+    // 32f0: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 32f2: bisb *58e8, r0
+    {
+        a = RD16(0x58e8);
+        src = RD8(a);
+        dst = uint8_t(r[0]);
+        val = src | dst;
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+    }
+    // 32f6: inc 58e8
+    {
+        a = 0x58e8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 32fa: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 32fc: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L32fe:
+    AOT_BLOCK(0x32fe, 5);
+    // 32fe: mov r0, 5aea
+    {
+        src = r[0];
+        b = 0x5aea;
+        WR16(b, src);
+    }
+    // 3302: clr r0
+    {
+        r[0] = 0;
+    }
+    // 3304: clr 58e6
+    {
+        a = 0x58e6;
+        WR16(a, 0);
+        C = false;
+    }
+    // 3308: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 330a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L330c:
+    AOT_BLOCK(0x330c, 4);
+    // 330c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 330e: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 3310: mov 4(r5), 3ed6
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x3ed6;
+        WR16(b, src);
+    }
+    // 3316: mov 6(r5), 3ed8
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x3ed8;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 331c: sys 0
+    AOT_INTERP(0x331c);
+L331e:
+    AOT_BLOCK(0x331e, 1);
+    // 331e: bit *-79fe(r3), (r4)+
+    {
+        a = RD16(r[3] + -31230);
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3322, L3322);
+L3320:
+    AOT_BLOCK(0x3320, 1);
+    // 3320: bcc 3326
+    if (!C)
+        AOT_GOTO(0x3326, L3326);
+    AOT_GOTO(0x3322, L3322);
+L3322:
+    AOT_BLOCK(0x3322, 1);
+    // 3322: jmp 3436
+    {
+        a = 0x3436;
+    }
+    AOT_GOTO(0x3436, L3436);
+L3324:
+    AOT_BLOCK(0x3324, 1);
+    // 3324: br 3346
+    AOT_GOTO(0x3346, L3346);
+L3326:
+    AOT_BLOCK(0x3326, 2);
+    // 3326: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3328: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L332a:
+    AOT_BLOCK(0x332a, 5);
+    // 332a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 332c: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 332e: mov 4(r5), 3edc
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x3edc;
+        WR16(b, src);
+    }
+    // 3334: mov 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 3338: mov pc, (r1)
+    {
+        src = uint16_t(0x333a);
+        b = r[1];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 333a: sys 0
+    AOT_INTERP(0x333a);
+L333c:
+    AOT_BLOCK(0x333c, 1);
+    // 333c: bit *-78af(r3), *(r2)+
+    {
+        a = RD16(r[3] + -30895);
+        src = RD16(a);
+        b = RD16(r[2]);
+        r[2] += 2;
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3340, L3340);
+L333e:
+    AOT_BLOCK(0x333e, 1);
+    // 333e: bcs 33e2
+    if (C)
+        AOT_GOTO(0x33e2, L33e2);
+    AOT_GOTO(0x3340, L3340);
+L3340:
+    AOT_BLOCK(0x3340, 1);
+    // 3340: mov r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3342, L3342);
+L3342:
+    AOT_BLOCK(0x3342, 1);
+    // 3342: clr (r1)+
+    {
+        a = r[1];
+        r[1] += 2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x3344, L3344);
+L3344:
+    AOT_BLOCK(0x3344, 1);
+    // 3344: clr (r1)+
+    {
+        a = r[1];
+        r[1] += 2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x3346, L3346);
+L3346:
+    AOT_BLOCK(0x3346, 1);
+    // 3346: br 33e6
+    AOT_GOTO(0x33e6, L33e6);
+L3348:
+    AOT_BLOCK(0x3348, 5);
+    // 3348: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 334a: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 334c: mov 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 3350: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 3354: bge 335e
+    if (!(N ^ V))
+        AOT_GOTO(0x335e, L335e);
+    AOT_GOTO(0x3356, L3356);
+L3356:
+    AOT_BLOCK(0x3356, 1);
+    // 3356: jsr pc, 33b8
+    {
+        a = 0x33b8;
+        r[6] -= 2;
+        WR16(r[6], 0x335a);
+    }
+    AOT_GOTO(0x33b8, L33b8);
+L335a:
+    AOT_BLOCK(0x335a, 1);
+    // 335a: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x335e, L335e);
+L335e:
+    AOT_BLOCK(0x335e, 4);
+    // 335e: movb 4(r5), *4(r1)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = RD16(r[1] + 4);
+        WR8(b, src);
+    }
+    // 3364: inc 4(r1)
+    {
+        a = uint16_t(r[1] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 3368: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 336c: bge 3376
+    if (!(N ^ V))
+        AOT_GOTO(0x3376, L3376);
+    AOT_GOTO(0x336e, L336e);
+L336e:
+    AOT_BLOCK(0x336e, 1);
+    // 336e: jsr pc, 33b8
+    {
+        a = 0x33b8;
+        r[6] -= 2;
+        WR16(r[6], 0x3372);
+    }
+    AOT_GOTO(0x33b8, L33b8);
+L3372:
+    AOT_BLOCK(0x3372, 1);
+    // 3372: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x3376, L3376);
+L3376:
+    AOT_BLOCK(0x3376, 4);
+    // 3376: movb 5(r5), *4(r1)
+    {
+        a = uint16_t(r[5] + 5);
+        src = RD8(a);
+        b = RD16(r[1] + 4);
+        WR8(b, src);
+    }
+    // 337c: inc 4(r1)
+    {
+        a = uint16_t(r[1] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 3380: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3384: br 33e6
+    AOT_GOTO(0x33e6, L33e6);
+L3386:
+    AOT_BLOCK(0x3386, 5);
+    // 3386: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3388: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 338a: mov 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 338e: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 3392: bge 339c
+    if (!(N ^ V))
+        AOT_GOTO(0x339c, L339c);
+    AOT_GOTO(0x3394, L3394);
+L3394:
+    AOT_BLOCK(0x3394, 1);
+    // 3394: jsr pc, 33b8
+    {
+        a = 0x33b8;
+        r[6] -= 2;
+        WR16(r[6], 0x3398);
+    }
+    AOT_GOTO(0x33b8, L33b8);
+L3398:
+    AOT_BLOCK(0x3398, 1);
+    // 3398: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x339c, L339c);
+L339c:
+    AOT_BLOCK(0x339c, 4);
+    // 339c: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 33a0: movb r0, *4(r1)
+    {
+        src = uint8_t(r[0]);
+        b = RD16(r[1] + 4);
+        WR8(b, src);
+    }
+    // 33a4: inc 4(r1)
+    {
+        a = uint16_t(r[1] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 33a8: br 33e6
+    AOT_GOTO(0x33e6, L33e6);
+L33aa:
+    AOT_BLOCK(0x33aa, 4);
+    // 33aa: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 33ac: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 33ae: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 33b2: jsr pc, 33b8
+    {
+        a = 0x33b8;
+        r[6] -= 2;
+        WR16(r[6], 0x33b6);
+    }
+    AOT_GOTO(0x33b8, L33b8);
+L33b6:
+    AOT_BLOCK(0x33b6, 1);
+    // 33b6: br 33e6
+    AOT_GOTO(0x33e6, L33e6);
+L33b8:
+    AOT_BLOCK(0x33b8, 6);
+    // 33b8: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 33ba: add $6, r0
+    {
+        src = uint16_t(0x0006);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 33be: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 33c0: mov r0, 3ee2
+    {
+        src = r[0];
+        b = 0x3ee2;
+        WR16(b, src);
+    }
+    // 33c4: mov 4(r1), 3ee4
+    {
+        a = uint16_t(r[1] + 4);
+        src = RD16(a);
+        b = 0x3ee4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 33ca: beq 33d6
+    if (Z)
+        AOT_GOTO(0x33d6, L33d6);
+    AOT_GOTO(0x33cc, L33cc);
+L33cc:
+    AOT_BLOCK(0x33cc, 2);
+    // 33cc: sub r0, 3ee4
+    {
+        src = r[0];
+        b = 0x3ee4;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x3ee4;
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 33d0: mov (r1), r0
+    {
+        a = r[1];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 33d2: sys 0
+    AOT_INTERP(0x33d2);
+L33d4:
+    AOT_BLOCK(0x33d4, 1);
+    // 33d4: bit *15b1(r3), -(r0)
+    {
+        a = RD16(r[3] + 5553);
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x33d8, L33d8);
+L33d6:
+    AOT_BLOCK(0x33d6, 1);
+    // 33d6: mov (sp)+, 4(r1)
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = uint16_t(r[1] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x33da, L33da);
+L33d8:
+    // 33d8: iot
+    AOT_INTERP(0x33d8);
+L33da:
+    AOT_BLOCK(0x33da, 1);
+    // 33da: mov $200, 2(r1)
+    {
+        src = uint16_t(0x0200);
+        b = uint16_t(r[1] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x33e0, L33e0);
+L33dc:
+    AOT_BLOCK(0x33dc, 1);
+    // 33dc: bne 33de
+    if (!Z)
+        AOT_GOTO(0x33de, L33de);
+    AOT_GOTO(0x33de, L33de);
+L33de:
+    // 33de: rti
+    AOT_INTERP(0x33de);
+L33e0:
+    AOT_BLOCK(0x33e0, 1);
+    // 33e0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L33e2:
+    AOT_BLOCK(0x33e2, 1);
+    // 33e2: jmp 3436
+    {
+        a = 0x3436;
+    }
+    AOT_GOTO(0x3436, L3436);
+L33e6:
+    AOT_BLOCK(0x33e6, 3);
+    // 33e6: clr 5aea
+    {
+        a = 0x5aea;
+        WR16(a, 0);
+        C = false;
+    }
+    // 33ea: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 33ec: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L33ee:
+    AOT_BLOCK(0x33ee, 5);
+    // 33ee: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 33f0: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 33f2: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 33f6: mov 6(r5), 3ee8
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x3ee8;
+        WR16(b, src);
+    }
+    // 33fc: mov 8(r5), 3eea
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x3eea;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3402: sys 0
+    AOT_INTERP(0x3402);
+L3404:
+    AOT_BLOCK(0x3404, 1);
+    // 3404: bit *-79fe(r3), -(sp)
+    {
+        a = RD16(r[3] + -31230);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3408, L3408);
+L3406:
+    AOT_BLOCK(0x3406, 1);
+    // 3406: bcc 340c
+    if (!C)
+        AOT_GOTO(0x340c, L340c);
+    AOT_GOTO(0x3408, L3408);
+L3408:
+    AOT_BLOCK(0x3408, 1);
+    // 3408: jmp 3436
+    {
+        a = 0x3436;
+    }
+    AOT_GOTO(0x3436, L3436);
+L340a:
+    // 340a: (undefined)
+    AOT_INTERP(0x340a);
+L340c:
+    AOT_BLOCK(0x340c, 2);
+    // 340c: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 340e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3410:
+    AOT_BLOCK(0x3410, 3);
+    // 3410: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3412: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 3414: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3418: sys 1
+    AOT_INTERP(0x3418);
+L341a:
+    AOT_BLOCK(0x341a, 1);
+    // csv
+    {
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_JUMP(r[0]);
+L341c:
+    AOT_BLOCK(0x341c, 1);
+    // 341c: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x341e, L341e);
+L341e:
+    AOT_BLOCK(0x341e, 1);
+    // 341e: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3420, L3420);
+L3420:
+    AOT_BLOCK(0x3420, 1);
+    // 3420: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3422, L3422);
+L3422:
+    AOT_BLOCK(0x3422, 3);
+    // 3422: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3424: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3426: jmp (r0)
+    {
+        a = r[0];
+    }
+    AOT_JUMP(a);
+L3428:
+    AOT_BLOCK(0x3428, 1);
+    // cret
+    {
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3436:
+    AOT_BLOCK(0x3436, 5);
+    // 3436: mov r0, 5aea
+    {
+        src = r[0];
+        b = 0x5aea;
+        WR16(b, src);
+    }
+    // 343a: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+    }
+    // 343e: mov r5, sp
+    {
+        src = r[5];
+        r[6] = src;
+    }
+    // 3440: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3442: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("v6/lib/c0", 0x0000, 16108, 0x7bc18df2u, run);
+}
@@ -0,0 +1,40580 @@
+// v6/lib/c1 translated by 7aot: 2003 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x0008: goto L0008;
+        case 0x0010: goto L0010;
+        case 0x0012: goto L0012;
+        case 0x0016: goto L0016;
+        case 0x0018: goto L0018;
+        case 0x001a: goto L001a;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0020: goto L0020;
+        case 0x0022: goto L0022;
+        case 0x0024: goto L0024;
+        case 0x0028: goto L0028;
+        case 0x002a: goto L002a;
+        case 0x002c: goto L002c;
+        case 0x0030: goto L0030;
+        case 0x0034: goto L0034;
+        case 0x0038: goto L0038;
+        case 0x003c: goto L003c;
+        case 0x0040: goto L0040;
+        case 0x0044: goto L0044;
+        case 0x0046: goto L0046;
+        case 0x0048: goto L0048;
+        case 0x004a: goto L004a;
+        case 0x004e: goto L004e;
+        case 0x0052: goto L0052;
+        case 0x0056: goto L0056;
+        case 0x005a: goto L005a;
+        case 0x0062: goto L0062;
+        case 0x0066: goto L0066;
+        case 0x006a: goto L006a;
+        case 0x006c: goto L006c;
+        case 0x0070: goto L0070;
+        case 0x0072: goto L0072;
+        case 0x007e: goto L007e;
+        case 0x0082: goto L0082;
+        case 0x008c: goto L008c;
+        case 0x0096: goto L0096;
+        case 0x009c: goto L009c;
+        case 0x00a4: goto L00a4;
+        case 0x00ae: goto L00ae;
+        case 0x00be: goto L00be;
+        case 0x00c4: goto L00c4;
+        case 0x00cc: goto L00cc;
+        case 0x00d4: goto L00d4;
+        case 0x00dc: goto L00dc;
+        case 0x00e0: goto L00e0;
+        case 0x00e4: goto L00e4;
+        case 0x00ea: goto L00ea;
+        case 0x00ee: goto L00ee;
+        case 0x00f2: goto L00f2;
+        case 0x00f6: goto L00f6;
+        case 0x00fa: goto L00fa;
+        case 0x0106: goto L0106;
+        case 0x0108: goto L0108;
+        case 0x010a: goto L010a;
+        case 0x010c: goto L010c;
+        case 0x0110: goto L0110;
+        case 0x0118: goto L0118;
+        case 0x011e: goto L011e;
+        case 0x0124: goto L0124;
+        case 0x012a: goto L012a;
+        case 0x013e: goto L013e;
+        case 0x0144: goto L0144;
+        case 0x0146: goto L0146;
+        case 0x0156: goto L0156;
+        case 0x0164: goto L0164;
+        case 0x0176: goto L0176;
+        case 0x0184: goto L0184;
+        case 0x0198: goto L0198;
+        case 0x019e: goto L019e;
+        case 0x01a4: goto L01a4;
+        case 0x01aa: goto L01aa;
+        case 0x01b8: goto L01b8;
+        case 0x01c4: goto L01c4;
+        case 0x01dc: goto L01dc;
+        case 0x01e2: goto L01e2;
+        case 0x01e8: goto L01e8;
+        case 0x01ee: goto L01ee;
+        case 0x0200: goto L0200;
+        case 0x0204: goto L0204;
+        case 0x020a: goto L020a;
+        case 0x0212: goto L0212;
+        case 0x0218: goto L0218;
+        case 0x021c: goto L021c;
+        case 0x0224: goto L0224;
+        case 0x022c: goto L022c;
+        case 0x0230: goto L0230;
+        case 0x023c: goto L023c;
+        case 0x0242: goto L0242;
+        case 0x0248: goto L0248;
+        case 0x0258: goto L0258;
+        case 0x025e: goto L025e;
+        case 0x0260: goto L0260;
+        case 0x026e: goto L026e;
+        case 0x0274: goto L0274;
+        case 0x0282: goto L0282;
+        case 0x028a: goto L028a;
+        case 0x0292: goto L0292;
+        case 0x02a2: goto L02a2;
+        case 0x02a8: goto L02a8;
+        case 0x02ac: goto L02ac;
+        case 0x02b2: goto L02b2;
+        case 0x02b6: goto L02b6;
+        case 0x02ba: goto L02ba;
+        case 0x02d0: goto L02d0;
+        case 0x02e6: goto L02e6;
+        case 0x02f0: goto L02f0;
+        case 0x02f8: goto L02f8;
+        case 0x02fe: goto L02fe;
+        case 0x0304: goto L0304;
+        case 0x0316: goto L0316;
+        case 0x031e: goto L031e;
+        case 0x0328: goto L0328;
+        case 0x0330: goto L0330;
+        case 0x033a: goto L033a;
+        case 0x0342: goto L0342;
+        case 0x034a: goto L034a;
+        case 0x034c: goto L034c;
+        case 0x0354: goto L0354;
+        case 0x0360: goto L0360;
+        case 0x0362: goto L0362;
+        case 0x036a: goto L036a;
+        case 0x0372: goto L0372;
+        case 0x0378: goto L0378;
+        case 0x0388: goto L0388;
+        case 0x0390: goto L0390;
+        case 0x039a: goto L039a;
+        case 0x03a6: goto L03a6;
+        case 0x03a8: goto L03a8;
+        case 0x03ae: goto L03ae;
+        case 0x03be: goto L03be;
+        case 0x03cc: goto L03cc;
+        case 0x03d2: goto L03d2;
+        case 0x03ea: goto L03ea;
+        case 0x03f4: goto L03f4;
+        case 0x03f8: goto L03f8;
+        case 0x03fc: goto L03fc;
+        case 0x040e: goto L040e;
+        case 0x0416: goto L0416;
+        case 0x041e: goto L041e;
+        case 0x0424: goto L0424;
+        case 0x0432: goto L0432;
+        case 0x0440: goto L0440;
+        case 0x044c: goto L044c;
+        case 0x0454: goto L0454;
+        case 0x0462: goto L0462;
+        case 0x046a: goto L046a;
+        case 0x0476: goto L0476;
+        case 0x047a: goto L047a;
+        case 0x0488: goto L0488;
+        case 0x0490: goto L0490;
+        case 0x049c: goto L049c;
+        case 0x04a2: goto L04a2;
+        case 0x04a8: goto L04a8;
+        case 0x04ae: goto L04ae;
+        case 0x04b6: goto L04b6;
+        case 0x04be: goto L04be;
+        case 0x04c8: goto L04c8;
+        case 0x04ce: goto L04ce;
+        case 0x04d4: goto L04d4;
+        case 0x04d8: goto L04d8;
+        case 0x04da: goto L04da;
+        case 0x04e0: goto L04e0;
+        case 0x04e4: goto L04e4;
+        case 0x04f6: goto L04f6;
+        case 0x04fa: goto L04fa;
+        case 0x04fe: goto L04fe;
+        case 0x0504: goto L0504;
+        case 0x050a: goto L050a;
+        case 0x0512: goto L0512;
+        case 0x051e: goto L051e;
+        case 0x052e: goto L052e;
+        case 0x0534: goto L0534;
+        case 0x0544: goto L0544;
+        case 0x054a: goto L054a;
+        case 0x055a: goto L055a;
+        case 0x0560: goto L0560;
+        case 0x0566: goto L0566;
+        case 0x056e: goto L056e;
+        case 0x0576: goto L0576;
+        case 0x0580: goto L0580;
+        case 0x0586: goto L0586;
+        case 0x058e: goto L058e;
+        case 0x059a: goto L059a;
+        case 0x05a2: goto L05a2;
+        case 0x05a6: goto L05a6;
+        case 0x05ac: goto L05ac;
+        case 0x05ba: goto L05ba;
+        case 0x05c2: goto L05c2;
+        case 0x05c8: goto L05c8;
+        case 0x05d2: goto L05d2;
+        case 0x05d8: goto L05d8;
+        case 0x05e0: goto L05e0;
+        case 0x05ec: goto L05ec;
+        case 0x05f2: goto L05f2;
+        case 0x05f8: goto L05f8;
+        case 0x05fe: goto L05fe;
+        case 0x0600: goto L0600;
+        case 0x060e: goto L060e;
+        case 0x0616: goto L0616;
+        case 0x061c: goto L061c;
+        case 0x062a: goto L062a;
+        case 0x062c: goto L062c;
+        case 0x0630: goto L0630;
+        case 0x0634: goto L0634;
+        case 0x063a: goto L063a;
+        case 0x0644: goto L0644;
+        case 0x0654: goto L0654;
+        case 0x0658: goto L0658;
+        case 0x0662: goto L0662;
+        case 0x0664: goto L0664;
+        case 0x066a: goto L066a;
+        case 0x066e: goto L066e;
+        case 0x069c: goto L069c;
+        case 0x06a4: goto L06a4;
+        case 0x06ac: goto L06ac;
+        case 0x06b4: goto L06b4;
+        case 0x06bc: goto L06bc;
+        case 0x06d8: goto L06d8;
+        case 0x06ec: goto L06ec;
+        case 0x06f8: goto L06f8;
+        case 0x0702: goto L0702;
+        case 0x0708: goto L0708;
+        case 0x070a: goto L070a;
+        case 0x0712: goto L0712;
+        case 0x0720: goto L0720;
+        case 0x0728: goto L0728;
+        case 0x0730: goto L0730;
+        case 0x0738: goto L0738;
+        case 0x0740: goto L0740;
+        case 0x075c: goto L075c;
+        case 0x0776: goto L0776;
+        case 0x0796: goto L0796;
+        case 0x07a0: goto L07a0;
+        case 0x07b0: goto L07b0;
+        case 0x07be: goto L07be;
+        case 0x07cc: goto L07cc;
+        case 0x07d8: goto L07d8;
+        case 0x07dc: goto L07dc;
+        case 0x07e4: goto L07e4;
+        case 0x07ec: goto L07ec;
+        case 0x07f6: goto L07f6;
+        case 0x080e: goto L080e;
+        case 0x0814: goto L0814;
+        case 0x0818: goto L0818;
+        case 0x0826: goto L0826;
+        case 0x082e: goto L082e;
+        case 0x0836: goto L0836;
+        case 0x083c: goto L083c;
+        case 0x0842: goto L0842;
+        case 0x084c: goto L084c;
+        case 0x0854: goto L0854;
+        case 0x085c: goto L085c;
+        case 0x0864: goto L0864;
+        case 0x086a: goto L086a;
+        case 0x0872: goto L0872;
+        case 0x087a: goto L087a;
+        case 0x0882: goto L0882;
+        case 0x0894: goto L0894;
+        case 0x089c: goto L089c;
+        case 0x08ae: goto L08ae;
+        case 0x08b6: goto L08b6;
+        case 0x08be: goto L08be;
+        case 0x08dc: goto L08dc;
+        case 0x08e2: goto L08e2;
+        case 0x08f4: goto L08f4;
+        case 0x0902: goto L0902;
+        case 0x090a: goto L090a;
+        case 0x0910: goto L0910;
+        case 0x0914: goto L0914;
+        case 0x091a: goto L091a;
+        case 0x0920: goto L0920;
+        case 0x0924: goto L0924;
+        case 0x092c: goto L092c;
+        case 0x0930: goto L0930;
+        case 0x0936: goto L0936;
+        case 0x0942: goto L0942;
+        case 0x094e: goto L094e;
+        case 0x0956: goto L0956;
+        case 0x0960: goto L0960;
+        case 0x096a: goto L096a;
+        case 0x096c: goto L096c;
+        case 0x096e: goto L096e;
+        case 0x0972: goto L0972;
+        case 0x0976: goto L0976;
+        case 0x097c: goto L097c;
+        case 0x0982: goto L0982;
+        case 0x0986: goto L0986;
+        case 0x0994: goto L0994;
+        case 0x0998: goto L0998;
+        case 0x09a0: goto L09a0;
+        case 0x09a4: goto L09a4;
+        case 0x09a6: goto L09a6;
+        case 0x09a8: goto L09a8;
+        case 0x09ac: goto L09ac;
+        case 0x09b0: goto L09b0;
+        case 0x09b8: goto L09b8;
+        case 0x09c0: goto L09c0;
+        case 0x09c6: goto L09c6;
+        case 0x09ca: goto L09ca;
+        case 0x09d2: goto L09d2;
+        case 0x09d4: goto L09d4;
+        case 0x09dc: goto L09dc;
+        case 0x09e8: goto L09e8;
+        case 0x09f0: goto L09f0;
+        case 0x09f4: goto L09f4;
+        case 0x09fe: goto L09fe;
+        case 0x0a0a: goto L0a0a;
+        case 0x0a12: goto L0a12;
+        case 0x0a2e: goto L0a2e;
+        case 0x0a30: goto L0a30;
+        case 0x0a3a: goto L0a3a;
+        case 0x0a42: goto L0a42;
+        case 0x0a48: goto L0a48;
+        case 0x0a50: goto L0a50;
+        case 0x0a56: goto L0a56;
+        case 0x0a5e: goto L0a5e;
+        case 0x0a64: goto L0a64;
+        case 0x0a66: goto L0a66;
+        case 0x0a6e: goto L0a6e;
+        case 0x0a74: goto L0a74;
+        case 0x0a7a: goto L0a7a;
+        case 0x0a80: goto L0a80;
+        case 0x0a86: goto L0a86;
+        case 0x0a8c: goto L0a8c;
+        case 0x0a94: goto L0a94;
+        case 0x0a9e: goto L0a9e;
+        case 0x0aa2: goto L0aa2;
+        case 0x0aaa: goto L0aaa;
+        case 0x0ab0: goto L0ab0;
+        case 0x0ab4: goto L0ab4;
+        case 0x0ab8: goto L0ab8;
+        case 0x0ac0: goto L0ac0;
+        case 0x0ac8: goto L0ac8;
+        case 0x0ace: goto L0ace;
+        case 0x0ad6: goto L0ad6;
+        case 0x0ade: goto L0ade;
+        case 0x0aea: goto L0aea;
+        case 0x0af2: goto L0af2;
+        case 0x0afa: goto L0afa;
+        case 0x0b00: goto L0b00;
+        case 0x0b0e: goto L0b0e;
+        case 0x0b1c: goto L0b1c;
+        case 0x0b24: goto L0b24;
+        case 0x0b28: goto L0b28;
+        case 0x0b30: goto L0b30;
+        case 0x0b38: goto L0b38;
+        case 0x0b40: goto L0b40;
+        case 0x0b4e: goto L0b4e;
+        case 0x0b5a: goto L0b5a;
+        case 0x0b60: goto L0b60;
+        case 0x0b66: goto L0b66;
+        case 0x0b68: goto L0b68;
+        case 0x0b70: goto L0b70;
+        case 0x0b78: goto L0b78;
+        case 0x0b80: goto L0b80;
+        case 0x0b86: goto L0b86;
+        case 0x0b8e: goto L0b8e;
+        case 0x0b96: goto L0b96;
+        case 0x0ba8: goto L0ba8;
+        case 0x0bba: goto L0bba;
+        case 0x0bc2: goto L0bc2;
+        case 0x0bd0: goto L0bd0;
+        case 0x0bd2: goto L0bd2;
+        case 0x0be0: goto L0be0;
+        case 0x0bf2: goto L0bf2;
+        case 0x0c00: goto L0c00;
+        case 0x0c0c: goto L0c0c;
+        case 0x0c10: goto L0c10;
+        case 0x0c14: goto L0c14;
+        case 0x0c22: goto L0c22;
+        case 0x0c2a: goto L0c2a;
+        case 0x0c2c: goto L0c2c;
+        case 0x0c32: goto L0c32;
+        case 0x0c3a: goto L0c3a;
+        case 0x0c42: goto L0c42;
+        case 0x0c4a: goto L0c4a;
+        case 0x0c52: goto L0c52;
+        case 0x0c5e: goto L0c5e;
+        case 0x0c64: goto L0c64;
+        case 0x0c6c: goto L0c6c;
+        case 0x0c78: goto L0c78;
+        case 0x0c80: goto L0c80;
+        case 0x0c84: goto L0c84;
+        case 0x0c88: goto L0c88;
+        case 0x0c90: goto L0c90;
+        case 0x0c98: goto L0c98;
+        case 0x0c9c: goto L0c9c;
+        case 0x0ca0: goto L0ca0;
+        case 0x0ca6: goto L0ca6;
+        case 0x0cae: goto L0cae;
+        case 0x0cb4: goto L0cb4;
+        case 0x0cb8: goto L0cb8;
+        case 0x0cbe: goto L0cbe;
+        case 0x0cc6: goto L0cc6;
+        case 0x0cca: goto L0cca;
+        case 0x0cd4: goto L0cd4;
+        case 0x0cda: goto L0cda;
+        case 0x0ce2: goto L0ce2;
+        case 0x0ce4: goto L0ce4;
+        case 0x0cea: goto L0cea;
+        case 0x0cf4: goto L0cf4;
+        case 0x0cf6: goto L0cf6;
+        case 0x0cfa: goto L0cfa;
+        case 0x0d04: goto L0d04;
+        case 0x0d0c: goto L0d0c;
+        case 0x0d1a: goto L0d1a;
+        case 0x0d20: goto L0d20;
+        case 0x0d2c: goto L0d2c;
+        case 0x0d2e: goto L0d2e;
+        case 0x0d32: goto L0d32;
+        case 0x0d36: goto L0d36;
+        case 0x0d3e: goto L0d3e;
+        case 0x0d40: goto L0d40;
+        case 0x0d48: goto L0d48;
+        case 0x0d4a: goto L0d4a;
+        case 0x0d5c: goto L0d5c;
+        case 0x0d62: goto L0d62;
+        case 0x0d64: goto L0d64;
+        case 0x0d68: goto L0d68;
+        case 0x0d7a: goto L0d7a;
+        case 0x0d7e: goto L0d7e;
+        case 0x0d82: goto L0d82;
+        case 0x0d88: goto L0d88;
+        case 0x0d9a: goto L0d9a;
+        case 0x0d9e: goto L0d9e;
+        case 0x0da2: goto L0da2;
+        case 0x0daa: goto L0daa;
+        case 0x0dae: goto L0dae;
+        case 0x0db2: goto L0db2;
+        case 0x0dc6: goto L0dc6;
+        case 0x0dca: goto L0dca;
+        case 0x0dcc: goto L0dcc;
+        case 0x0dde: goto L0dde;
+        case 0x0de4: goto L0de4;
+        case 0x0de8: goto L0de8;
+        case 0x0df4: goto L0df4;
+        case 0x0e06: goto L0e06;
+        case 0x0e0c: goto L0e0c;
+        case 0x0e10: goto L0e10;
+        case 0x0e12: goto L0e12;
+        case 0x0e22: goto L0e22;
+        case 0x0e28: goto L0e28;
+        case 0x0e2c: goto L0e2c;
+        case 0x0e34: goto L0e34;
+        case 0x0e3c: goto L0e3c;
+        case 0x0e40: goto L0e40;
+        case 0x0e54: goto L0e54;
+        case 0x0e5a: goto L0e5a;
+        case 0x0e60: goto L0e60;
+        case 0x0e72: goto L0e72;
+        case 0x0e78: goto L0e78;
+        case 0x0e7e: goto L0e7e;
+        case 0x0e84: goto L0e84;
+        case 0x0e8e: goto L0e8e;
+        case 0x0e94: goto L0e94;
+        case 0x0ea6: goto L0ea6;
+        case 0x0eac: goto L0eac;
+        case 0x0eb2: goto L0eb2;
+        case 0x0eb8: goto L0eb8;
+        case 0x0ebc: goto L0ebc;
+        case 0x0ec2: goto L0ec2;
+        case 0x0ec6: goto L0ec6;
+        case 0x0ecc: goto L0ecc;
+        case 0x0ed4: goto L0ed4;
+        case 0x0edc: goto L0edc;
+        case 0x0ee0: goto L0ee0;
+        case 0x0ee6: goto L0ee6;
+        case 0x0eec: goto L0eec;
+        case 0x0ef2: goto L0ef2;
+        case 0x0efa: goto L0efa;
+        case 0x0efe: goto L0efe;
+        case 0x0f06: goto L0f06;
+        case 0x0f0a: goto L0f0a;
+        case 0x0f18: goto L0f18;
+        case 0x0f1e: goto L0f1e;
+        case 0x0f24: goto L0f24;
+        case 0x0f30: goto L0f30;
+        case 0x0f3e: goto L0f3e;
+        case 0x0f44: goto L0f44;
+        case 0x0f56: goto L0f56;
+        case 0x0f62: goto L0f62;
+        case 0x0f72: goto L0f72;
+        case 0x0f80: goto L0f80;
+        case 0x0f82: goto L0f82;
+        case 0x0f9c: goto L0f9c;
+        case 0x0fa6: goto L0fa6;
+        case 0x0fac: goto L0fac;
+        case 0x0fae: goto L0fae;
+        case 0x0fb4: goto L0fb4;
+        case 0x0fb8: goto L0fb8;
+        case 0x0fbc: goto L0fbc;
+        case 0x0fc4: goto L0fc4;
+        case 0x0fcc: goto L0fcc;
+        case 0x0fd2: goto L0fd2;
+        case 0x0fe4: goto L0fe4;
+        case 0x0fec: goto L0fec;
+        case 0x0ffa: goto L0ffa;
+        case 0x100c: goto L100c;
+        case 0x1010: goto L1010;
+        case 0x1014: goto L1014;
+        case 0x1018: goto L1018;
+        case 0x101c: goto L101c;
+        case 0x1032: goto L1032;
+        case 0x1036: goto L1036;
+        case 0x1038: goto L1038;
+        case 0x103e: goto L103e;
+        case 0x1046: goto L1046;
+        case 0x1056: goto L1056;
+        case 0x105c: goto L105c;
+        case 0x106a: goto L106a;
+        case 0x1074: goto L1074;
+        case 0x1076: goto L1076;
+        case 0x107a: goto L107a;
+        case 0x1084: goto L1084;
+        case 0x1086: goto L1086;
+        case 0x108a: goto L108a;
+        case 0x1098: goto L1098;
+        case 0x10a0: goto L10a0;
+        case 0x10ae: goto L10ae;
+        case 0x10b2: goto L10b2;
+        case 0x10b6: goto L10b6;
+        case 0x10c4: goto L10c4;
+        case 0x10ca: goto L10ca;
+        case 0x10d2: goto L10d2;
+        case 0x10da: goto L10da;
+        case 0x10e2: goto L10e2;
+        case 0x10e8: goto L10e8;
+        case 0x10ee: goto L10ee;
+        case 0x10f8: goto L10f8;
+        case 0x10fc: goto L10fc;
+        case 0x1100: goto L1100;
+        case 0x1106: goto L1106;
+        case 0x1110: goto L1110;
+        case 0x1112: goto L1112;
+        case 0x1116: goto L1116;
+        case 0x111a: goto L111a;
+        case 0x112a: goto L112a;
+        case 0x112e: goto L112e;
+        case 0x114e: goto L114e;
+        case 0x1154: goto L1154;
+        case 0x1158: goto L1158;
+        case 0x116a: goto L116a;
+        case 0x1178: goto L1178;
+        case 0x1180: goto L1180;
+        case 0x1186: goto L1186;
+        case 0x11ae: goto L11ae;
+        case 0x11b2: goto L11b2;
+        case 0x11b6: goto L11b6;
+        case 0x11c4: goto L11c4;
+        case 0x11ca: goto L11ca;
+        case 0x11ce: goto L11ce;
+        case 0x11d6: goto L11d6;
+        case 0x11e2: goto L11e2;
+        case 0x11ec: goto L11ec;
+        case 0x11f0: goto L11f0;
+        case 0x1200: goto L1200;
+        case 0x1204: goto L1204;
+        case 0x1208: goto L1208;
+        case 0x120c: goto L120c;
+        case 0x1218: goto L1218;
+        case 0x121e: goto L121e;
+        case 0x1224: goto L1224;
+        case 0x1228: goto L1228;
+        case 0x1234: goto L1234;
+        case 0x1238: goto L1238;
+        case 0x123c: goto L123c;
+        case 0x1242: goto L1242;
+        case 0x1248: goto L1248;
+        case 0x124e: goto L124e;
+        case 0x1254: goto L1254;
+        case 0x125a: goto L125a;
+        case 0x1260: goto L1260;
+        case 0x1264: goto L1264;
+        case 0x126a: goto L126a;
+        case 0x1270: goto L1270;
+        case 0x127c: goto L127c;
+        case 0x1284: goto L1284;
+        case 0x128c: goto L128c;
+        case 0x1292: goto L1292;
+        case 0x1296: goto L1296;
+        case 0x129c: goto L129c;
+        case 0x12a0: goto L12a0;
+        case 0x12a8: goto L12a8;
+        case 0x12ae: goto L12ae;
+        case 0x12b6: goto L12b6;
+        case 0x12be: goto L12be;
+        case 0x12c2: goto L12c2;
+        case 0x12ce: goto L12ce;
+        case 0x12d4: goto L12d4;
+        case 0x12e0: goto L12e0;
+        case 0x12e4: goto L12e4;
+        case 0x12e8: goto L12e8;
+        case 0x12ee: goto L12ee;
+        case 0x12f6: goto L12f6;
+        case 0x12fe: goto L12fe;
+        case 0x1306: goto L1306;
+        case 0x130a: goto L130a;
+        case 0x1310: goto L1310;
+        case 0x1316: goto L1316;
+        case 0x1324: goto L1324;
+        case 0x1328: goto L1328;
+        case 0x132e: goto L132e;
+        case 0x1330: goto L1330;
+        case 0x133c: goto L133c;
+        case 0x1342: goto L1342;
+        case 0x134c: goto L134c;
+        case 0x1352: goto L1352;
+        case 0x135a: goto L135a;
+        case 0x135c: goto L135c;
+        case 0x1364: goto L1364;
+        case 0x136e: goto L136e;
+        case 0x1376: goto L1376;
+        case 0x137a: goto L137a;
+        case 0x137c: goto L137c;
+        case 0x1384: goto L1384;
+        case 0x1388: goto L1388;
+        case 0x138c: goto L138c;
+        case 0x1398: goto L1398;
+        case 0x139c: goto L139c;
+        case 0x13a8: goto L13a8;
+        case 0x13ac: goto L13ac;
+        case 0x13b0: goto L13b0;
+        case 0x13b8: goto L13b8;
+        case 0x13bc: goto L13bc;
+        case 0x13c8: goto L13c8;
+        case 0x13ce: goto L13ce;
+        case 0x13d8: goto L13d8;
+        case 0x13de: goto L13de;
+        case 0x13e6: goto L13e6;
+        case 0x13ea: goto L13ea;
+        case 0x13f6: goto L13f6;
+        case 0x13fa: goto L13fa;
+        case 0x140a: goto L140a;
+        case 0x1412: goto L1412;
+        case 0x141e: goto L141e;
+        case 0x1422: goto L1422;
+        case 0x1430: goto L1430;
+        case 0x1432: goto L1432;
+        case 0x1436: goto L1436;
+        case 0x1448: goto L1448;
+        case 0x1452: goto L1452;
+        case 0x145a: goto L145a;
+        case 0x1462: goto L1462;
+        case 0x1468: goto L1468;
+        case 0x146c: goto L146c;
+        case 0x1470: goto L1470;
+        case 0x1474: goto L1474;
+        case 0x1480: goto L1480;
+        case 0x1484: goto L1484;
+        case 0x1488: goto L1488;
+        case 0x1490: goto L1490;
+        case 0x1496: goto L1496;
+        case 0x149c: goto L149c;
+        case 0x14a2: goto L14a2;
+        case 0x14a8: goto L14a8;
+        case 0x14b0: goto L14b0;
+        case 0x14b6: goto L14b6;
+        case 0x14bc: goto L14bc;
+        case 0x14c2: goto L14c2;
+        case 0x14c8: goto L14c8;
+        case 0x14d2: goto L14d2;
+        case 0x14d8: goto L14d8;
+        case 0x14de: goto L14de;
+        case 0x14e4: goto L14e4;
+        case 0x14ec: goto L14ec;
+        case 0x14f2: goto L14f2;
+        case 0x14f4: goto L14f4;
+        case 0x14fe: goto L14fe;
+        case 0x1504: goto L1504;
+        case 0x150c: goto L150c;
+        case 0x1510: goto L1510;
+        case 0x1518: goto L1518;
+        case 0x151e: goto L151e;
+        case 0x1522: goto L1522;
+        case 0x1524: goto L1524;
+        case 0x1528: goto L1528;
+        case 0x153c: goto L153c;
+        case 0x1542: goto L1542;
+        case 0x1548: goto L1548;
+        case 0x154c: goto L154c;
+        case 0x1550: goto L1550;
+        case 0x1552: goto L1552;
+        case 0x1558: goto L1558;
+        case 0x155c: goto L155c;
+        case 0x1562: goto L1562;
+        case 0x1566: goto L1566;
+        case 0x156a: goto L156a;
+        case 0x156c: goto L156c;
+        case 0x1576: goto L1576;
+        case 0x157a: goto L157a;
+        case 0x1580: goto L1580;
+        case 0x1588: goto L1588;
+        case 0x158e: goto L158e;
+        case 0x1594: goto L1594;
+        case 0x1598: goto L1598;
+        case 0x159e: goto L159e;
+        case 0x15a6: goto L15a6;
+        case 0x15ae: goto L15ae;
+        case 0x15b4: goto L15b4;
+        case 0x15b8: goto L15b8;
+        case 0x15bc: goto L15bc;
+        case 0x15c0: goto L15c0;
+        case 0x15c4: goto L15c4;
+        case 0x15c6: goto L15c6;
+        case 0x15ca: goto L15ca;
+        case 0x15ce: goto L15ce;
+        case 0x15d2: goto L15d2;
+        case 0x15d6: goto L15d6;
+        case 0x15dc: goto L15dc;
+        case 0x15e2: goto L15e2;
+        case 0x15e8: goto L15e8;
+        case 0x15ec: goto L15ec;
+        case 0x15f2: goto L15f2;
+        case 0x15fc: goto L15fc;
+        case 0x1600: goto L1600;
+        case 0x1606: goto L1606;
+        case 0x1612: goto L1612;
+        case 0x1614: goto L1614;
+        case 0x1618: goto L1618;
+        case 0x1626: goto L1626;
+        case 0x162a: goto L162a;
+        case 0x1630: goto L1630;
+        case 0x163a: goto L163a;
+        case 0x1640: goto L1640;
+        case 0x1646: goto L1646;
+        case 0x164a: goto L164a;
+        case 0x164e: goto L164e;
+        case 0x1662: goto L1662;
+        case 0x1666: goto L1666;
+        case 0x166e: goto L166e;
+        case 0x1676: goto L1676;
+        case 0x1682: goto L1682;
+        case 0x1686: goto L1686;
+        case 0x168a: goto L168a;
+        case 0x169a: goto L169a;
+        case 0x169e: goto L169e;
+        case 0x16a4: goto L16a4;
+        case 0x16a6: goto L16a6;
+        case 0x16b0: goto L16b0;
+        case 0x16b8: goto L16b8;
+        case 0x16bc: goto L16bc;
+        case 0x16c0: goto L16c0;
+        case 0x16c4: goto L16c4;
+        case 0x16c8: goto L16c8;
+        case 0x16d4: goto L16d4;
+        case 0x16da: goto L16da;
+        case 0x16e0: goto L16e0;
+        case 0x16e6: goto L16e6;
+        case 0x16ec: goto L16ec;
+        case 0x16f4: goto L16f4;
+        case 0x16fa: goto L16fa;
+        case 0x1700: goto L1700;
+        case 0x1706: goto L1706;
+        case 0x170a: goto L170a;
+        case 0x171e: goto L171e;
+        case 0x172a: goto L172a;
+        case 0x1730: goto L1730;
+        case 0x1742: goto L1742;
+        case 0x1748: goto L1748;
+        case 0x174c: goto L174c;
+        case 0x176e: goto L176e;
+        case 0x177c: goto L177c;
+        case 0x1782: goto L1782;
+        case 0x178e: goto L178e;
+        case 0x1790: goto L1790;
+        case 0x17a8: goto L17a8;
+        case 0x17b6: goto L17b6;
+        case 0x17be: goto L17be;
+        case 0x17c6: goto L17c6;
+        case 0x17d0: goto L17d0;
+        case 0x17d8: goto L17d8;
+        case 0x17e4: goto L17e4;
+        case 0x17e6: goto L17e6;
+        case 0x17ec: goto L17ec;
+        case 0x17f0: goto L17f0;
+        case 0x17f8: goto L17f8;
+        case 0x1830: goto L1830;
+        case 0x1838: goto L1838;
+        case 0x183c: goto L183c;
+        case 0x1848: goto L1848;
+        case 0x1850: goto L1850;
+        case 0x185c: goto L185c;
+        case 0x1862: goto L1862;
+        case 0x1866: goto L1866;
+        case 0x1870: goto L1870;
+        case 0x1878: goto L1878;
+        case 0x1884: goto L1884;
+        case 0x188a: goto L188a;
+        case 0x189c: goto L189c;
+        case 0x18a8: goto L18a8;
+        case 0x18ac: goto L18ac;
+        case 0x18b4: goto L18b4;
+        case 0x18c6: goto L18c6;
+        case 0x18c8: goto L18c8;
+        case 0x18cc: goto L18cc;
+        case 0x18da: goto L18da;
+        case 0x18ea: goto L18ea;
+        case 0x18f2: goto L18f2;
+        case 0x18fa: goto L18fa;
+        case 0x190a: goto L190a;
+        case 0x1918: goto L1918;
+        case 0x191e: goto L191e;
+        case 0x192c: goto L192c;
+        case 0x193e: goto L193e;
+        case 0x1944: goto L1944;
+        case 0x197a: goto L197a;
+        case 0x1986: goto L1986;
+        case 0x198e: goto L198e;
+        case 0x199e: goto L199e;
+        case 0x19a6: goto L19a6;
+        case 0x19aa: goto L19aa;
+        case 0x19b2: goto L19b2;
+        case 0x19c2: goto L19c2;
+        case 0x19c6: goto L19c6;
+        case 0x19ca: goto L19ca;
+        case 0x19d8: goto L19d8;
+        case 0x19e0: goto L19e0;
+        case 0x19ee: goto L19ee;
+        case 0x19fa: goto L19fa;
+        case 0x19fc: goto L19fc;
+        case 0x1a02: goto L1a02;
+        case 0x1a08: goto L1a08;
+        case 0x1a18: goto L1a18;
+        case 0x1a1e: goto L1a1e;
+        case 0x1a26: goto L1a26;
+        case 0x1a32: goto L1a32;
+        case 0x1a36: goto L1a36;
+        case 0x1a3a: goto L1a3a;
+        case 0x1a48: goto L1a48;
+        case 0x1a50: goto L1a50;
+        case 0x1a5a: goto L1a5a;
+        case 0x1a5c: goto L1a5c;
+        case 0x1a62: goto L1a62;
+        case 0x1a68: goto L1a68;
+        case 0x1a70: goto L1a70;
+        case 0x1a74: goto L1a74;
+        case 0x1a84: goto L1a84;
+        case 0x1a8c: goto L1a8c;
+        case 0x1a92: goto L1a92;
+        case 0x1a96: goto L1a96;
+        case 0x1a9e: goto L1a9e;
+        case 0x1aaa: goto L1aaa;
+        case 0x1ab2: goto L1ab2;
+        case 0x1aba: goto L1aba;
+        case 0x1ade: goto L1ade;
+        case 0x1ae4: goto L1ae4;
+        case 0x1aea: goto L1aea;
+        case 0x1aec: goto L1aec;
+        case 0x1af0: goto L1af0;
+        case 0x1af4: goto L1af4;
+        case 0x1b02: goto L1b02;
+        case 0x1b06: goto L1b06;
+        case 0x1b0e: goto L1b0e;
+        case 0x1b1c: goto L1b1c;
+        case 0x1b24: goto L1b24;
+        case 0x1b28: goto L1b28;
+        case 0x1b2c: goto L1b2c;
+        case 0x1b30: goto L1b30;
+        case 0x1b3e: goto L1b3e;
+        case 0x1b42: goto L1b42;
+        case 0x1b44: goto L1b44;
+        case 0x1b4a: goto L1b4a;
+        case 0x1b4e: goto L1b4e;
+        case 0x1b5e: goto L1b5e;
+        case 0x1b64: goto L1b64;
+        case 0x1b6a: goto L1b6a;
+        case 0x1b70: goto L1b70;
+        case 0x1b76: goto L1b76;
+        case 0x1b7c: goto L1b7c;
+        case 0x1b80: goto L1b80;
+        case 0x1b88: goto L1b88;
+        case 0x1b8a: goto L1b8a;
+        case 0x1b8e: goto L1b8e;
+        case 0x1b92: goto L1b92;
+        case 0x1baa: goto L1baa;
+        case 0x1bae: goto L1bae;
+        case 0x1bb4: goto L1bb4;
+        case 0x1bba: goto L1bba;
+        case 0x1bd4: goto L1bd4;
+        case 0x1be8: goto L1be8;
+        case 0x1bf4: goto L1bf4;
+        case 0x1bf6: goto L1bf6;
+        case 0x1c04: goto L1c04;
+        case 0x1c16: goto L1c16;
+        case 0x1c1a: goto L1c1a;
+        case 0x1c1e: goto L1c1e;
+        case 0x1c24: goto L1c24;
+        case 0x1c34: goto L1c34;
+        case 0x1c48: goto L1c48;
+        case 0x1c4e: goto L1c4e;
+        case 0x1c6a: goto L1c6a;
+        case 0x1c7c: goto L1c7c;
+        case 0x1c88: goto L1c88;
+        case 0x1c8c: goto L1c8c;
+        case 0x1c94: goto L1c94;
+        case 0x1c98: goto L1c98;
+        case 0x1c9c: goto L1c9c;
+        case 0x1ca6: goto L1ca6;
+        case 0x1cae: goto L1cae;
+        case 0x1cbc: goto L1cbc;
+        case 0x1cc6: goto L1cc6;
+        case 0x1cce: goto L1cce;
+        case 0x1cd2: goto L1cd2;
+        case 0x1cd6: goto L1cd6;
+        case 0x1ce2: goto L1ce2;
+        case 0x1cf0: goto L1cf0;
+        case 0x1cfc: goto L1cfc;
+        case 0x1d04: goto L1d04;
+        case 0x1d14: goto L1d14;
+        case 0x1d18: goto L1d18;
+        case 0x1d1e: goto L1d1e;
+        case 0x1d2a: goto L1d2a;
+        case 0x1d34: goto L1d34;
+        case 0x1d3a: goto L1d3a;
+        case 0x1d3e: goto L1d3e;
+        case 0x1d42: goto L1d42;
+        case 0x1d4c: goto L1d4c;
+        case 0x1d50: goto L1d50;
+        case 0x1d5c: goto L1d5c;
+        case 0x1d70: goto L1d70;
+        case 0x1d78: goto L1d78;
+        case 0x1d86: goto L1d86;
+        case 0x1d8e: goto L1d8e;
+        case 0x1d98: goto L1d98;
+        case 0x1da0: goto L1da0;
+        case 0x1dac: goto L1dac;
+        case 0x1db2: goto L1db2;
+        case 0x1db6: goto L1db6;
+        case 0x1dbe: goto L1dbe;
+        case 0x1dc4: goto L1dc4;
+        case 0x1dc8: goto L1dc8;
+        case 0x1dcc: goto L1dcc;
+        case 0x1dd6: goto L1dd6;
+        case 0x1dd8: goto L1dd8;
+        case 0x1ddc: goto L1ddc;
+        case 0x1de6: goto L1de6;
+        case 0x1df4: goto L1df4;
+        case 0x1df8: goto L1df8;
+        case 0x1e00: goto L1e00;
+        case 0x1e0c: goto L1e0c;
+        case 0x1e12: goto L1e12;
+        case 0x1e22: goto L1e22;
+        case 0x1e28: goto L1e28;
+        case 0x1e32: goto L1e32;
+        case 0x1e34: goto L1e34;
+        case 0x1e3c: goto L1e3c;
+        case 0x1e3e: goto L1e3e;
+        case 0x1e46: goto L1e46;
+        case 0x1e4a: goto L1e4a;
+        case 0x1e50: goto L1e50;
+        case 0x1e56: goto L1e56;
+        case 0x1e62: goto L1e62;
+        case 0x1e64: goto L1e64;
+        case 0x1e68: goto L1e68;
+        case 0x1e74: goto L1e74;
+        case 0x1e8a: goto L1e8a;
+        case 0x1eac: goto L1eac;
+        case 0x1eb8: goto L1eb8;
+        case 0x1ebc: goto L1ebc;
+        case 0x1ec4: goto L1ec4;
+        case 0x1ed2: goto L1ed2;
+        case 0x1edc: goto L1edc;
+        case 0x1ee8: goto L1ee8;
+        case 0x1eee: goto L1eee;
+        case 0x1f02: goto L1f02;
+        case 0x1f0c: goto L1f0c;
+        case 0x1f14: goto L1f14;
+        case 0x1f1c: goto L1f1c;
+        case 0x1f2a: goto L1f2a;
+        case 0x1f32: goto L1f32;
+        case 0x1f3a: goto L1f3a;
+        case 0x1f44: goto L1f44;
+        case 0x1f48: goto L1f48;
+        case 0x1f50: goto L1f50;
+        case 0x1f58: goto L1f58;
+        case 0x1f5c: goto L1f5c;
+        case 0x1f64: goto L1f64;
+        case 0x1f68: goto L1f68;
+        case 0x1f70: goto L1f70;
+        case 0x1f74: goto L1f74;
+        case 0x1f7c: goto L1f7c;
+        case 0x1f80: goto L1f80;
+        case 0x1f88: goto L1f88;
+        case 0x1f8c: goto L1f8c;
+        case 0x1f94: goto L1f94;
+        case 0x1f9e: goto L1f9e;
+        case 0x1fa4: goto L1fa4;
+        case 0x1fac: goto L1fac;
+        case 0x1fb0: goto L1fb0;
+        case 0x1fb8: goto L1fb8;
+        case 0x1fc2: goto L1fc2;
+        case 0x1fce: goto L1fce;
+        case 0x1fd4: goto L1fd4;
+        case 0x1fdc: goto L1fdc;
+        case 0x1fe6: goto L1fe6;
+        case 0x1fec: goto L1fec;
+        case 0x1ff4: goto L1ff4;
+        case 0x1ff8: goto L1ff8;
+        case 0x2000: goto L2000;
+        case 0x2008: goto L2008;
+        case 0x2014: goto L2014;
+        case 0x201c: goto L201c;
+        case 0x201e: goto L201e;
+        case 0x2024: goto L2024;
+        case 0x2026: goto L2026;
+        case 0x202e: goto L202e;
+        case 0x2030: goto L2030;
+        case 0x2034: goto L2034;
+        case 0x203c: goto L203c;
+        case 0x2048: goto L2048;
+        case 0x2054: goto L2054;
+        case 0x205a: goto L205a;
+        case 0x2062: goto L2062;
+        case 0x2064: goto L2064;
+        case 0x206c: goto L206c;
+        case 0x206e: goto L206e;
+        case 0x2074: goto L2074;
+        case 0x2078: goto L2078;
+        case 0x207e: goto L207e;
+        case 0x2086: goto L2086;
+        case 0x2090: goto L2090;
+        case 0x209c: goto L209c;
+        case 0x20a2: goto L20a2;
+        case 0x20aa: goto L20aa;
+        case 0x20b4: goto L20b4;
+        case 0x20c0: goto L20c0;
+        case 0x20c6: goto L20c6;
+        case 0x20ce: goto L20ce;
+        case 0x20d8: goto L20d8;
+        case 0x20e2: goto L20e2;
+        case 0x20ea: goto L20ea;
+        case 0x20f0: goto L20f0;
+        case 0x20f8: goto L20f8;
+        case 0x2100: goto L2100;
+        case 0x2108: goto L2108;
+        case 0x2116: goto L2116;
+        case 0x211c: goto L211c;
+        case 0x2124: goto L2124;
+        case 0x2132: goto L2132;
+        case 0x213a: goto L213a;
+        case 0x2142: goto L2142;
+        case 0x2152: goto L2152;
+        case 0x215a: goto L215a;
+        case 0x2166: goto L2166;
+        case 0x216e: goto L216e;
+        case 0x2176: goto L2176;
+        case 0x217e: goto L217e;
+        case 0x219e: goto L219e;
+        case 0x21ae: goto L21ae;
+        case 0x21b6: goto L21b6;
+        case 0x21cc: goto L21cc;
+        case 0x21da: goto L21da;
+        case 0x21e8: goto L21e8;
+        case 0x21f6: goto L21f6;
+        case 0x21fe: goto L21fe;
+        case 0x2208: goto L2208;
+        case 0x2218: goto L2218;
+        case 0x2222: goto L2222;
+        case 0x222a: goto L222a;
+        case 0x2234: goto L2234;
+        case 0x2248: goto L2248;
+        case 0x2254: goto L2254;
+        case 0x2260: goto L2260;
+        case 0x226a: goto L226a;
+        case 0x2272: goto L2272;
+        case 0x227c: goto L227c;
+        case 0x2290: goto L2290;
+        case 0x229c: goto L229c;
+        case 0x22a4: goto L22a4;
+        case 0x22aa: goto L22aa;
+        case 0x22ac: goto L22ac;
+        case 0x22b4: goto L22b4;
+        case 0x22be: goto L22be;
+        case 0x22c2: goto L22c2;
+        case 0x22ca: goto L22ca;
+        case 0x22d8: goto L22d8;
+        case 0x22dc: goto L22dc;
+        case 0x22e6: goto L22e6;
+        case 0x22ee: goto L22ee;
+        case 0x22f2: goto L22f2;
+        case 0x22fa: goto L22fa;
+        case 0x2302: goto L2302;
+        case 0x230e: goto L230e;
+        case 0x2318: goto L2318;
+        case 0x2320: goto L2320;
+        case 0x2328: goto L2328;
+        case 0x232c: goto L232c;
+        case 0x2338: goto L2338;
+        case 0x2346: goto L2346;
+        case 0x234e: goto L234e;
+        case 0x235c: goto L235c;
+        case 0x236a: goto L236a;
+        case 0x2372: goto L2372;
+        case 0x2376: goto L2376;
+        case 0x2388: goto L2388;
+        case 0x238c: goto L238c;
+        case 0x2390: goto L2390;
+        case 0x2394: goto L2394;
+        case 0x2398: goto L2398;
+        case 0x23a2: goto L23a2;
+        case 0x23aa: goto L23aa;
+        case 0x23ae: goto L23ae;
+        case 0x23b4: goto L23b4;
+        case 0x23be: goto L23be;
+        case 0x23c2: goto L23c2;
+        case 0x23c8: goto L23c8;
+        case 0x23cc: goto L23cc;
+        case 0x23d8: goto L23d8;
+        case 0x23dc: goto L23dc;
+        case 0x23e4: goto L23e4;
+        case 0x23ee: goto L23ee;
+        case 0x23f8: goto L23f8;
+        case 0x2400: goto L2400;
+        case 0x240c: goto L240c;
+        case 0x2410: goto L2410;
+        case 0x2418: goto L2418;
+        case 0x241c: goto L241c;
+        case 0x242c: goto L242c;
+        case 0x2432: goto L2432;
+        case 0x2438: goto L2438;
+        case 0x243e: goto L243e;
+        case 0x2444: goto L2444;
+        case 0x244c: goto L244c;
+        case 0x245e: goto L245e;
+        case 0x246c: goto L246c;
+        case 0x2472: goto L2472;
+        case 0x2478: goto L2478;
+        case 0x247e: goto L247e;
+        case 0x2482: goto L2482;
+        case 0x248a: goto L248a;
+        case 0x248e: goto L248e;
+        case 0x2494: goto L2494;
+        case 0x24a0: goto L24a0;
+        case 0x24ae: goto L24ae;
+        case 0x24b4: goto L24b4;
+        case 0x24d2: goto L24d2;
+        case 0x24da: goto L24da;
+        case 0x24e2: goto L24e2;
+        case 0x24ee: goto L24ee;
+        case 0x24f8: goto L24f8;
+        case 0x2500: goto L2500;
+        case 0x250e: goto L250e;
+        case 0x2518: goto L2518;
+        case 0x2520: goto L2520;
+        case 0x2528: goto L2528;
+        case 0x2530: goto L2530;
+        case 0x2548: goto L2548;
+        case 0x254c: goto L254c;
+        case 0x2554: goto L2554;
+        case 0x255c: goto L255c;
+        case 0x2564: goto L2564;
+        case 0x256a: goto L256a;
+        case 0x2572: goto L2572;
+        case 0x2576: goto L2576;
+        case 0x257e: goto L257e;
+        case 0x2588: goto L2588;
+        case 0x2592: goto L2592;
+        case 0x259a: goto L259a;
+        case 0x25a4: goto L25a4;
+        case 0x25ac: goto L25ac;
+        case 0x25bc: goto L25bc;
+        case 0x25c4: goto L25c4;
+        case 0x25d6: goto L25d6;
+        case 0x25dc: goto L25dc;
+        case 0x25e2: goto L25e2;
+        case 0x25e8: goto L25e8;
+        case 0x25f2: goto L25f2;
+        case 0x2612: goto L2612;
+        case 0x261e: goto L261e;
+        case 0x2626: goto L2626;
+        case 0x262a: goto L262a;
+        case 0x2634: goto L2634;
+        case 0x263c: goto L263c;
+        case 0x2640: goto L2640;
+        case 0x264a: goto L264a;
+        case 0x2656: goto L2656;
+        case 0x2660: goto L2660;
+        case 0x2668: goto L2668;
+        case 0x266e: goto L266e;
+        case 0x267e: goto L267e;
+        case 0x2696: goto L2696;
+        case 0x26a8: goto L26a8;
+        case 0x26ac: goto L26ac;
+        case 0x26b0: goto L26b0;
+        case 0x26b8: goto L26b8;
+        case 0x26c4: goto L26c4;
+        case 0x26cc: goto L26cc;
+        case 0x26d2: goto L26d2;
+        case 0x26d6: goto L26d6;
+        case 0x26e2: goto L26e2;
+        case 0x26ea: goto L26ea;
+        case 0x26f0: goto L26f0;
+        case 0x26f4: goto L26f4;
+        case 0x26f6: goto L26f6;
+        case 0x26fe: goto L26fe;
+        case 0x2708: goto L2708;
+        case 0x270e: goto L270e;
+        case 0x2714: goto L2714;
+        case 0x271a: goto L271a;
+        case 0x2722: goto L2722;
+        case 0x272e: goto L272e;
+        case 0x2748: goto L2748;
+        case 0x2754: goto L2754;
+        case 0x275c: goto L275c;
+        case 0x2764: goto L2764;
+        case 0x277a: goto L277a;
+        case 0x2782: goto L2782;
+        case 0x278a: goto L278a;
+        case 0x2792: goto L2792;
+        case 0x2798: goto L2798;
+        case 0x27a4: goto L27a4;
+        case 0x27a6: goto L27a6;
+        case 0x27ae: goto L27ae;
+        case 0x27c0: goto L27c0;
+        case 0x27c4: goto L27c4;
+        case 0x27c8: goto L27c8;
+        case 0x27cc: goto L27cc;
+        case 0x27d0: goto L27d0;
+        case 0x27dc: goto L27dc;
+        case 0x27e2: goto L27e2;
+        case 0x27e8: goto L27e8;
+        case 0x27f0: goto L27f0;
+        case 0x27fa: goto L27fa;
+        case 0x2802: goto L2802;
+        case 0x280e: goto L280e;
+        case 0x2820: goto L2820;
+        case 0x2824: goto L2824;
+        case 0x282a: goto L282a;
+        case 0x282c: goto L282c;
+        case 0x283c: goto L283c;
+        case 0x286a: goto L286a;
+        case 0x2878: goto L2878;
+        case 0x287c: goto L287c;
+        case 0x2882: goto L2882;
+        case 0x288a: goto L288a;
+        case 0x2890: goto L2890;
+        case 0x2898: goto L2898;
+        case 0x28b0: goto L28b0;
+        case 0x28e6: goto L28e6;
+        case 0x28ea: goto L28ea;
+        case 0x28f0: goto L28f0;
+        case 0x28f8: goto L28f8;
+        case 0x28fe: goto L28fe;
+        case 0x2906: goto L2906;
+        case 0x291e: goto L291e;
+        case 0x2928: goto L2928;
+        case 0x292e: goto L292e;
+        case 0x2936: goto L2936;
+        case 0x293c: goto L293c;
+        case 0x2944: goto L2944;
+        case 0x294a: goto L294a;
+        case 0x294c: goto L294c;
+        case 0x2958: goto L2958;
+        case 0x295e: goto L295e;
+        case 0x2962: goto L2962;
+        case 0x296a: goto L296a;
+        case 0x2970: goto L2970;
+        case 0x2976: goto L2976;
+        case 0x297e: goto L297e;
+        case 0x2986: goto L2986;
+        case 0x29a8: goto L29a8;
+        case 0x29b0: goto L29b0;
+        case 0x29d8: goto L29d8;
+        case 0x29da: goto L29da;
+        case 0x29e6: goto L29e6;
+        case 0x29f2: goto L29f2;
+        case 0x29fa: goto L29fa;
+        case 0x29fe: goto L29fe;
+        case 0x2a00: goto L2a00;
+        case 0x2a02: goto L2a02;
+        case 0x2a08: goto L2a08;
+        case 0x2a0e: goto L2a0e;
+        case 0x2a18: goto L2a18;
+        case 0x2a1a: goto L2a1a;
+        case 0x2a22: goto L2a22;
+        case 0x2a26: goto L2a26;
+        case 0x2a2a: goto L2a2a;
+        case 0x2a30: goto L2a30;
+        case 0x2a34: goto L2a34;
+        case 0x2a42: goto L2a42;
+        case 0x2a50: goto L2a50;
+        case 0x2a52: goto L2a52;
+        case 0x2a54: goto L2a54;
+        case 0x2a56: goto L2a56;
+        case 0x2a64: goto L2a64;
+        case 0x2a68: goto L2a68;
+        case 0x2a6c: goto L2a6c;
+        case 0x2a80: goto L2a80;
+        case 0x2a84: goto L2a84;
+        case 0x2a8c: goto L2a8c;
+        case 0x2a90: goto L2a90;
+        case 0x2a94: goto L2a94;
+        case 0x2a9a: goto L2a9a;
+        case 0x2aa4: goto L2aa4;
+        case 0x2aac: goto L2aac;
+        case 0x2ab6: goto L2ab6;
+        case 0x2aba: goto L2aba;
+        case 0x2ad8: goto L2ad8;
+        case 0x2aec: goto L2aec;
+        case 0x2b04: goto L2b04;
+        case 0x2b0a: goto L2b0a;
+        case 0x2b10: goto L2b10;
+        case 0x2b18: goto L2b18;
+        case 0x2b20: goto L2b20;
+        case 0x2b3e: goto L2b3e;
+        case 0x2b46: goto L2b46;
+        case 0x2b4e: goto L2b4e;
+        case 0x2b56: goto L2b56;
+        case 0x2b5c: goto L2b5c;
+        case 0x2b62: goto L2b62;
+        case 0x2b66: goto L2b66;
+        case 0x2b6c: goto L2b6c;
+        case 0x2b74: goto L2b74;
+        case 0x2b7a: goto L2b7a;
+        case 0x2b80: goto L2b80;
+        case 0x2b88: goto L2b88;
+        case 0x2b90: goto L2b90;
+        case 0x2b98: goto L2b98;
+        case 0x2bb0: goto L2bb0;
+        case 0x2bb2: goto L2bb2;
+        case 0x2bba: goto L2bba;
+        case 0x2bc2: goto L2bc2;
+        case 0x2bd4: goto L2bd4;
+        case 0x2bda: goto L2bda;
+        case 0x2be0: goto L2be0;
+        case 0x2be8: goto L2be8;
+        case 0x2bf0: goto L2bf0;
+        case 0x2bf6: goto L2bf6;
+        case 0x2c00: goto L2c00;
+        case 0x2c08: goto L2c08;
+        case 0x2c10: goto L2c10;
+        case 0x2c16: goto L2c16;
+        case 0x2c20: goto L2c20;
+        case 0x2c30: goto L2c30;
+        case 0x2c38: goto L2c38;
+        case 0x2c40: goto L2c40;
+        case 0x2c4e: goto L2c4e;
+        case 0x2c54: goto L2c54;
+        case 0x2c58: goto L2c58;
+        case 0x2c5c: goto L2c5c;
+        case 0x2c64: goto L2c64;
+        case 0x2c86: goto L2c86;
+        case 0x2c8c: goto L2c8c;
+        case 0x2c94: goto L2c94;
+        case 0x2c9a: goto L2c9a;
+        case 0x2ca2: goto L2ca2;
+        case 0x2cac: goto L2cac;
+        case 0x2cae: goto L2cae;
+        case 0x2cc2: goto L2cc2;
+        case 0x2cc4: goto L2cc4;
+        case 0x2cca: goto L2cca;
+        case 0x2cd0: goto L2cd0;
+        case 0x2cd4: goto L2cd4;
+        case 0x2cda: goto L2cda;
+        case 0x2ce2: goto L2ce2;
+        case 0x2ce8: goto L2ce8;
+        case 0x2cf2: goto L2cf2;
+        case 0x2d1a: goto L2d1a;
+        case 0x2d20: goto L2d20;
+        case 0x2d26: goto L2d26;
+        case 0x2d2c: goto L2d2c;
+        case 0x2d30: goto L2d30;
+        case 0x2d38: goto L2d38;
+        case 0x2d42: goto L2d42;
+        case 0x2d4a: goto L2d4a;
+        case 0x2d50: goto L2d50;
+        case 0x2d54: goto L2d54;
+        case 0x2d58: goto L2d58;
+        case 0x2d60: goto L2d60;
+        case 0x2d64: goto L2d64;
+        case 0x2d84: goto L2d84;
+        case 0x2d8a: goto L2d8a;
+        case 0x2d8e: goto L2d8e;
+        case 0x2d96: goto L2d96;
+        case 0x2d9a: goto L2d9a;
+        case 0x2da4: goto L2da4;
+        case 0x2db0: goto L2db0;
+        case 0x2db6: goto L2db6;
+        case 0x2dba: goto L2dba;
+        case 0x2dc2: goto L2dc2;
+        case 0x2dcc: goto L2dcc;
+        case 0x2de0: goto L2de0;
+        case 0x2dfc: goto L2dfc;
+        case 0x2e08: goto L2e08;
+        case 0x2e0a: goto L2e0a;
+        case 0x2e10: goto L2e10;
+        case 0x2e2a: goto L2e2a;
+        case 0x2e44: goto L2e44;
+        case 0x2e4c: goto L2e4c;
+        case 0x2e52: goto L2e52;
+        case 0x2e58: goto L2e58;
+        case 0x2e60: goto L2e60;
+        case 0x2e70: goto L2e70;
+        case 0x2e76: goto L2e76;
+        case 0x2e7c: goto L2e7c;
+        case 0x2ef0: goto L2ef0;
+        case 0x2ef8: goto L2ef8;
+        case 0x2f00: goto L2f00;
+        case 0x2f06: goto L2f06;
+        case 0x2f0a: goto L2f0a;
+        case 0x2f18: goto L2f18;
+        case 0x2f1a: goto L2f1a;
+        case 0x2f22: goto L2f22;
+        case 0x2f26: goto L2f26;
+        case 0x2f2e: goto L2f2e;
+        case 0x2f34: goto L2f34;
+        case 0x2f3e: goto L2f3e;
+        case 0x2f42: goto L2f42;
+        case 0x2f50: goto L2f50;
+        case 0x2f56: goto L2f56;
+        case 0x2f62: goto L2f62;
+        case 0x2f6c: goto L2f6c;
+        case 0x2f72: goto L2f72;
+        case 0x2f7e: goto L2f7e;
+        case 0x2f82: goto L2f82;
+        case 0x2f8a: goto L2f8a;
+        case 0x2f8c: goto L2f8c;
+        case 0x2f94: goto L2f94;
+        case 0x2fa2: goto L2fa2;
+        case 0x2fae: goto L2fae;
+        case 0x2fb0: goto L2fb0;
+        case 0x2fc2: goto L2fc2;
+        case 0x2fce: goto L2fce;
+        case 0x2fd6: goto L2fd6;
+        case 0x2fe0: goto L2fe0;
+        case 0x2fe6: goto L2fe6;
+        case 0x2fee: goto L2fee;
+        case 0x2ff2: goto L2ff2;
+        case 0x3008: goto L3008;
+        case 0x3026: goto L3026;
+        case 0x3036: goto L3036;
+        case 0x303c: goto L303c;
+        case 0x3042: goto L3042;
+        case 0x304a: goto L304a;
+        case 0x3050: goto L3050;
+        case 0x3054: goto L3054;
+        case 0x305a: goto L305a;
+        case 0x3060: goto L3060;
+        case 0x3068: goto L3068;
+        case 0x3072: goto L3072;
+        case 0x307a: goto L307a;
+        case 0x3086: goto L3086;
+        case 0x3094: goto L3094;
+        case 0x30b2: goto L30b2;
+        case 0x30c8: goto L30c8;
+        case 0x30e4: goto L30e4;
+        case 0x30ea: goto L30ea;
+        case 0x30f0: goto L30f0;
+        case 0x30f6: goto L30f6;
+        case 0x3106: goto L3106;
+        case 0x310e: goto L310e;
+        case 0x3130: goto L3130;
+        case 0x3136: goto L3136;
+        case 0x3142: goto L3142;
+        case 0x3146: goto L3146;
+        case 0x3162: goto L3162;
+        case 0x3168: goto L3168;
+        case 0x316e: goto L316e;
+        case 0x3172: goto L3172;
+        case 0x3176: goto L3176;
+        case 0x317e: goto L317e;
+        case 0x3188: goto L3188;
+        case 0x318c: goto L318c;
+        case 0x3198: goto L3198;
+        case 0x319e: goto L319e;
+        case 0x31a4: goto L31a4;
+        case 0x31a8: goto L31a8;
+        case 0x31b6: goto L31b6;
+        case 0x31bc: goto L31bc;
+        case 0x31c0: goto L31c0;
+        case 0x31c6: goto L31c6;
+        case 0x31ce: goto L31ce;
+        case 0x31d4: goto L31d4;
+        case 0x31d8: goto L31d8;
+        case 0x31dc: goto L31dc;
+        case 0x31e8: goto L31e8;
+        case 0x31ee: goto L31ee;
+        case 0x3208: goto L3208;
+        case 0x3212: goto L3212;
+        case 0x3218: goto L3218;
+        case 0x3220: goto L3220;
+        case 0x3224: goto L3224;
+        case 0x3228: goto L3228;
+        case 0x322e: goto L322e;
+        case 0x3230: goto L3230;
+        case 0x3234: goto L3234;
+        case 0x3238: goto L3238;
+        case 0x323c: goto L323c;
+        case 0x3240: goto L3240;
+        case 0x3244: goto L3244;
+        case 0x3248: goto L3248;
+        case 0x324c: goto L324c;
+        case 0x3250: goto L3250;
+        case 0x3254: goto L3254;
+        case 0x3258: goto L3258;
+        case 0x3264: goto L3264;
+        case 0x3268: goto L3268;
+        case 0x326c: goto L326c;
+        case 0x3274: goto L3274;
+        case 0x3280: goto L3280;
+        case 0x328c: goto L328c;
+        case 0x3294: goto L3294;
+        case 0x3298: goto L3298;
+        case 0x329a: goto L329a;
+        case 0x329c: goto L329c;
+        case 0x32a2: goto L32a2;
+        case 0x32a8: goto L32a8;
+        case 0x32aa: goto L32aa;
+        case 0x32ae: goto L32ae;
+        case 0x32b4: goto L32b4;
+        case 0x32ba: goto L32ba;
+        case 0x32c6: goto L32c6;
+        case 0x32ce: goto L32ce;
+        case 0x32d2: goto L32d2;
+        case 0x32de: goto L32de;
+        case 0x32e8: goto L32e8;
+        case 0x32ec: goto L32ec;
+        case 0x32f2: goto L32f2;
+        case 0x32fc: goto L32fc;
+        case 0x32fe: goto L32fe;
+        case 0x3300: goto L3300;
+        case 0x3302: goto L3302;
+        case 0x330c: goto L330c;
+        case 0x330e: goto L330e;
+        case 0x3310: goto L3310;
+        case 0x3320: goto L3320;
+        case 0x3322: goto L3322;
+        case 0x3324: goto L3324;
+        case 0x3328: goto L3328;
+        case 0x332a: goto L332a;
+        case 0x332e: goto L332e;
+        case 0x3330: goto L3330;
+        case 0x3334: goto L3334;
+        case 0x3336: goto L3336;
+        case 0x333a: goto L333a;
+        case 0x333c: goto L333c;
+        case 0x3354: goto L3354;
+        case 0x335a: goto L335a;
+        case 0x335e: goto L335e;
+        case 0x3360: goto L3360;
+        case 0x3362: goto L3362;
+        case 0x3368: goto L3368;
+        case 0x3396: goto L3396;
+        case 0x3398: goto L3398;
+        case 0x339a: goto L339a;
+        case 0x33a0: goto L33a0;
+        case 0x33a6: goto L33a6;
+        case 0x33aa: goto L33aa;
+        case 0x33ac: goto L33ac;
+        case 0x33ae: goto L33ae;
+        case 0x33b4: goto L33b4;
+        case 0x33ba: goto L33ba;
+        case 0x33cc: goto L33cc;
+        case 0x33d2: goto L33d2;
+        case 0x33de: goto L33de;
+        case 0x33e4: goto L33e4;
+        case 0x33ec: goto L33ec;
+        case 0x33ee: goto L33ee;
+        case 0x33f0: goto L33f0;
+        case 0x33f4: goto L33f4;
+        case 0x33f6: goto L33f6;
+        case 0x33f8: goto L33f8;
+        case 0x33fe: goto L33fe;
+        case 0x3424: goto L3424;
+        case 0x3426: goto L3426;
+        case 0x3432: goto L3432;
+        case 0x3434: goto L3434;
+        case 0x3438: goto L3438;
+        case 0x343a: goto L343a;
+        case 0x3440: goto L3440;
+        case 0x3446: goto L3446;
+        case 0x3454: goto L3454;
+        case 0x3456: goto L3456;
+        case 0x3458: goto L3458;
+        case 0x345a: goto L345a;
+        case 0x345c: goto L345c;
+        case 0x345e: goto L345e;
+        case 0x3460: goto L3460;
+        case 0x3468: goto L3468;
+        case 0x346c: goto L346c;
+        case 0x346e: goto L346e;
+        case 0x3490: goto L3490;
+        case 0x3492: goto L3492;
+        case 0x3494: goto L3494;
+        case 0x349a: goto L349a;
+        case 0x349e: goto L349e;
+        case 0x34a0: goto L34a0;
+        case 0x34b8: goto L34b8;
+        case 0x34ba: goto L34ba;
+        case 0x34c0: goto L34c0;
+        case 0x34c2: goto L34c2;
+        case 0x34c4: goto L34c4;
+        case 0x34c6: goto L34c6;
+        case 0x34d0: goto L34d0;
+        case 0x34da: goto L34da;
+        case 0x34ec: goto L34ec;
+        case 0x34ee: goto L34ee;
+        case 0x34f2: goto L34f2;
+        case 0x34fe: goto L34fe;
+        case 0x3504: goto L3504;
+        case 0x350a: goto L350a;
+        case 0x3510: goto L3510;
+        case 0x3516: goto L3516;
+        case 0x3518: goto L3518;
+        case 0x351c: goto L351c;
+        case 0x3522: goto L3522;
+        case 0x3526: goto L3526;
+        case 0x3528: goto L3528;
+        case 0x352c: goto L352c;
+        case 0x352e: goto L352e;
+        case 0x3542: goto L3542;
+        case 0x3548: goto L3548;
+        case 0x354e: goto L354e;
+        case 0x3550: goto L3550;
+        case 0x3554: goto L3554;
+        case 0x355a: goto L355a;
+        case 0x3560: goto L3560;
+        case 0x3564: goto L3564;
+        case 0x3566: goto L3566;
+        case 0x3568: goto L3568;
+        case 0x356c: goto L356c;
+        case 0x356e: goto L356e;
+        case 0x3582: goto L3582;
+        case 0x3584: goto L3584;
+        case 0x3586: goto L3586;
+        case 0x3588: goto L3588;
+        case 0x358a: goto L358a;
+        case 0x358c: goto L358c;
+        case 0x3592: goto L3592;
+        case 0x3598: goto L3598;
+        case 0x359e: goto L359e;
+        case 0x35a0: goto L35a0;
+        case 0x35a2: goto L35a2;
+        case 0x35a4: goto L35a4;
+        case 0x35a6: goto L35a6;
+        case 0x35aa: goto L35aa;
+        case 0x35ac: goto L35ac;
+        case 0x35ae: goto L35ae;
+        case 0x35bc: goto L35bc;
+        case 0x35c6: goto L35c6;
+        case 0x35cc: goto L35cc;
+        case 0x35d0: goto L35d0;
+        case 0x35d2: goto L35d2;
+        case 0x35d4: goto L35d4;
+        case 0x35d8: goto L35d8;
+        case 0x35da: goto L35da;
+        case 0x35de: goto L35de;
+        case 0x35e2: goto L35e2;
+        case 0x35f0: goto L35f0;
+        case 0x35f4: goto L35f4;
+        case 0x35fa: goto L35fa;
+        case 0x35fe: goto L35fe;
+        case 0x360a: goto L360a;
+        case 0x360c: goto L360c;
+        case 0x360e: goto L360e;
+        case 0x3610: goto L3610;
+        case 0x3612: goto L3612;
+        case 0x3614: goto L3614;
+        case 0x3616: goto L3616;
+        case 0x361a: goto L361a;
+        case 0x361c: goto L361c;
+        case 0x361e: goto L361e;
+        case 0x3620: goto L3620;
+        case 0x3622: goto L3622;
+        case 0x3624: goto L3624;
+        case 0x3626: goto L3626;
+        case 0x362c: goto L362c;
+        case 0x3632: goto L3632;
+        case 0x3636: goto L3636;
+        case 0x3638: goto L3638;
+        case 0x363a: goto L363a;
+        case 0x363e: goto L363e;
+        case 0x3640: goto L3640;
+        case 0x3642: goto L3642;
+        case 0x3648: goto L3648;
+        case 0x364e: goto L364e;
+        case 0x3652: goto L3652;
+        case 0x3656: goto L3656;
+        case 0x365a: goto L365a;
+        case 0x365c: goto L365c;
+        case 0x3660: goto L3660;
+        case 0x3662: goto L3662;
+        case 0x3664: goto L3664;
+        case 0x3666: goto L3666;
+        case 0x366c: goto L366c;
+        case 0x3672: goto L3672;
+        case 0x3674: goto L3674;
+        case 0x3676: goto L3676;
+        case 0x3678: goto L3678;
+        case 0x3680: goto L3680;
+        case 0x3682: goto L3682;
+        case 0x3684: goto L3684;
+        case 0x3688: goto L3688;
+        case 0x3690: goto L3690;
+        case 0x3692: goto L3692;
+        case 0x3694: goto L3694;
+        case 0x3696: goto L3696;
+        case 0x369a: goto L369a;
+        case 0x369e: goto L369e;
+        case 0x36a0: goto L36a0;
+        case 0x36a2: goto L36a2;
+        case 0x36a8: goto L36a8;
+        case 0x36ac: goto L36ac;
+        case 0x36bc: goto L36bc;
+        case 0x36be: goto L36be;
+        case 0x3736: goto L3736;
+        case 0x3738: goto L3738;
+        case 0x373a: goto L373a;
+        case 0x373e: goto L373e;
+        case 0x3740: goto L3740;
+        case 0x3766: goto L3766;
+        case 0x3774: goto L3774;
+        case 0x3776: goto L3776;
+        case 0x377a: goto L377a;
+        case 0x377e: goto L377e;
+        case 0x3780: goto L3780;
+        case 0x3784: goto L3784;
+        case 0x3788: goto L3788;
+        case 0x3790: goto L3790;
+        case 0x3794: goto L3794;
+        case 0x3798: goto L3798;
+        case 0x379e: goto L379e;
+        case 0x37a0: goto L37a0;
+        case 0x37a2: goto L37a2;
+        case 0x37a6: goto L37a6;
+        case 0x37a8: goto L37a8;
+        case 0x37aa: goto L37aa;
+        case 0x37cc: goto L37cc;
+        case 0x37d0: goto L37d0;
+        case 0x37d2: goto L37d2;
+        case 0x37d8: goto L37d8;
+        case 0x3812: goto L3812;
+        case 0x3814: goto L3814;
+        case 0x3816: goto L3816;
+        case 0x381c: goto L381c;
+        case 0x3820: goto L3820;
+        case 0x3822: goto L3822;
+        case 0x3824: goto L3824;
+        case 0x3840: goto L3840;
+        case 0x3842: goto L3842;
+        case 0x3864: goto L3864;
+        case 0x3880: goto L3880;
+        case 0x3882: goto L3882;
+        case 0x388a: goto L388a;
+        case 0x388c: goto L388c;
+        case 0x388e: goto L388e;
+        case 0x3890: goto L3890;
+        case 0x38a6: goto L38a6;
+        case 0x38ac: goto L38ac;
+        case 0x38ae: goto L38ae;
+        case 0x38b0: goto L38b0;
+        case 0x38b2: goto L38b2;
+        case 0x38da: goto L38da;
+        case 0x38dc: goto L38dc;
+        case 0x38f2: goto L38f2;
+        case 0x38f4: goto L38f4;
+        case 0x38f6: goto L38f6;
+        case 0x3912: goto L3912;
+        case 0x3914: goto L3914;
+        case 0x3916: goto L3916;
+        case 0x391a: goto L391a;
+        case 0x391c: goto L391c;
+        case 0x3920: goto L3920;
+        case 0x3922: goto L3922;
+        case 0x3924: goto L3924;
+        case 0x3928: goto L3928;
+        case 0x392a: goto L392a;
+        case 0x3930: goto L3930;
+        case 0x3940: goto L3940;
+        case 0x3942: goto L3942;
+        case 0x3944: goto L3944;
+        case 0x3948: goto L3948;
+        case 0x394e: goto L394e;
+        case 0x3954: goto L3954;
+        case 0x3956: goto L3956;
+        case 0x395a: goto L395a;
+        case 0x395c: goto L395c;
+        case 0x395e: goto L395e;
+        case 0x3962: goto L3962;
+        case 0x3964: goto L3964;
+        case 0x3966: goto L3966;
+        case 0x396a: goto L396a;
+        case 0x397e: goto L397e;
+        case 0x3984: goto L3984;
+        case 0x398e: goto L398e;
+        case 0x3990: goto L3990;
+        case 0x3994: goto L3994;
+        case 0x3996: goto L3996;
+        case 0x3998: goto L3998;
+        case 0x399a: goto L399a;
+        case 0x39aa: goto L39aa;
+        case 0x39ae: goto L39ae;
+        case 0x39b2: goto L39b2;
+        case 0x39b4: goto L39b4;
+        case 0x39b6: goto L39b6;
+        case 0x39c4: goto L39c4;
+        case 0x39c8: goto L39c8;
+        case 0x39cc: goto L39cc;
+        case 0x39d6: goto L39d6;
+        case 0x39da: goto L39da;
+        case 0x39de: goto L39de;
+        case 0x39e0: goto L39e0;
+        case 0x39e2: goto L39e2;
+        case 0x39e4: goto L39e4;
+        case 0x39ec: goto L39ec;
+        case 0x39ee: goto L39ee;
+        case 0x39f2: goto L39f2;
+        case 0x39f4: goto L39f4;
+        case 0x3a00: goto L3a00;
+        case 0x3a04: goto L3a04;
+        case 0x3a06: goto L3a06;
+        case 0x3a0e: goto L3a0e;
+        case 0x3a12: goto L3a12;
+        case 0x3a14: goto L3a14;
+        case 0x3a18: goto L3a18;
+        case 0x3a1c: goto L3a1c;
+        case 0x3a24: goto L3a24;
+        case 0x3a28: goto L3a28;
+        case 0x3a2c: goto L3a2c;
+        case 0x3a30: goto L3a30;
+        case 0x3a32: goto L3a32;
+        case 0x3a36: goto L3a36;
+        case 0x3a3a: goto L3a3a;
+        case 0x3a3e: goto L3a3e;
+        case 0x3a44: goto L3a44;
+        case 0x3a48: goto L3a48;
+        case 0x3a4e: goto L3a4e;
+        case 0x3a50: goto L3a50;
+        case 0x3a56: goto L3a56;
+        case 0x3a5a: goto L3a5a;
+        case 0x3a64: goto L3a64;
+        case 0x3a6a: goto L3a6a;
+        case 0x3a6e: goto L3a6e;
+        case 0x3a70: goto L3a70;
+        case 0x3a72: goto L3a72;
+        case 0x3a7e: goto L3a7e;
+        case 0x3a80: goto L3a80;
+        case 0x3a8c: goto L3a8c;
+        case 0x3a8e: goto L3a8e;
+        case 0x3a98: goto L3a98;
+        case 0x3aa0: goto L3aa0;
+        case 0x3ab0: goto L3ab0;
+        case 0x3ab6: goto L3ab6;
+        case 0x3aba: goto L3aba;
+        case 0x3abc: goto L3abc;
+        case 0x3ac0: goto L3ac0;
+        case 0x3ac6: goto L3ac6;
+        case 0x3ac8: goto L3ac8;
+        case 0x3acc: goto L3acc;
+        case 0x3ad0: goto L3ad0;
+        case 0x3ad4: goto L3ad4;
+        case 0x3ad6: goto L3ad6;
+        case 0x3ade: goto L3ade;
+        case 0x3ae4: goto L3ae4;
+        case 0x3af6: goto L3af6;
+        case 0x3afa: goto L3afa;
+        case 0x3b00: goto L3b00;
+        case 0x3b0c: goto L3b0c;
+        case 0x3b12: goto L3b12;
+        case 0x3b1c: goto L3b1c;
+        case 0x3b26: goto L3b26;
+        case 0x3b2a: goto L3b2a;
+        case 0x3b2e: goto L3b2e;
+        case 0x3b34: goto L3b34;
+        case 0x3b3e: goto L3b3e;
+        case 0x3b42: goto L3b42;
+        case 0x3b4a: goto L3b4a;
+        case 0x3b52: goto L3b52;
+        case 0x3b56: goto L3b56;
+        case 0x3b5c: goto L3b5c;
+        case 0x3b6a: goto L3b6a;
+        case 0x3b6c: goto L3b6c;
+        case 0x3b6e: goto L3b6e;
+        case 0x3b70: goto L3b70;
+        case 0x3b72: goto L3b72;
+        case 0x3b74: goto L3b74;
+        case 0x3b76: goto L3b76;
+        case 0x3b84: goto L3b84;
+        case 0x3b8a: goto L3b8a;
+        case 0x3b8c: goto L3b8c;
+        case 0x3b96: goto L3b96;
+        case 0x3b98: goto L3b98;
+        case 0x3b9a: goto L3b9a;
+        case 0x3b9c: goto L3b9c;
+        case 0x3b9e: goto L3b9e;
+        case 0x3ba2: goto L3ba2;
+        case 0x3bb4: goto L3bb4;
+        case 0x3bb6: goto L3bb6;
+        case 0x3bb8: goto L3bb8;
+        case 0x3bba: goto L3bba;
+        case 0x3bbc: goto L3bbc;
+        case 0x3bc0: goto L3bc0;
+        case 0x3bcc: goto L3bcc;
+        case 0x3bce: goto L3bce;
+        case 0x3bd0: goto L3bd0;
+        case 0x3bd2: goto L3bd2;
+        case 0x3bd4: goto L3bd4;
+        case 0x3bde: goto L3bde;
+        case 0x3bf2: goto L3bf2;
+        case 0x3bfa: goto L3bfa;
+        case 0x3c02: goto L3c02;
+        case 0x3c08: goto L3c08;
+        case 0x3c0c: goto L3c0c;
+        case 0x3c10: goto L3c10;
+        case 0x3c16: goto L3c16;
+        case 0x3c24: goto L3c24;
+        case 0x3c32: goto L3c32;
+        case 0x3c36: goto L3c36;
+        case 0x3c3c: goto L3c3c;
+        case 0x3c44: goto L3c44;
+        case 0x3c56: goto L3c56;
+        case 0x3c58: goto L3c58;
+        case 0x3c5a: goto L3c5a;
+        case 0x3c5c: goto L3c5c;
+        case 0x3c5e: goto L3c5e;
+        case 0x3c64: goto L3c64;
+        case 0x3c68: goto L3c68;
+        case 0x3c72: goto L3c72;
+        case 0x3c74: goto L3c74;
+        case 0x3c76: goto L3c76;
+        case 0x3c78: goto L3c78;
+        case 0x3c7a: goto L3c7a;
+        case 0x3c80: goto L3c80;
+        case 0x3c8e: goto L3c8e;
+        case 0x3c9c: goto L3c9c;
+        case 0x3cae: goto L3cae;
+        case 0x3e02: goto L3e02;
+        case 0x3e04: goto L3e04;
+        case 0x3e06: goto L3e06;
+        case 0x3e08: goto L3e08;
+        case 0x3e0a: goto L3e0a;
+        case 0x3e0c: goto L3e0c;
+        case 0x3e0e: goto L3e0e;
+        case 0x3e10: goto L3e10;
+        case 0x3e12: goto L3e12;
+        case 0x3e14: goto L3e14;
+        case 0x3e16: goto L3e16;
+        case 0x3e18: goto L3e18;
+        case 0x3e1a: goto L3e1a;
+        case 0x3e1c: goto L3e1c;
+        case 0x3e1e: goto L3e1e;
+        case 0x3e20: goto L3e20;
+        case 0x3e22: goto L3e22;
+        case 0x3e24: goto L3e24;
+        case 0x3e28: goto L3e28;
+        case 0x3e2a: goto L3e2a;
+        case 0x3e2c: goto L3e2c;
+        case 0x3e30: goto L3e30;
+        case 0x3e32: goto L3e32;
+        case 0x3e34: goto L3e34;
+        case 0x3e38: goto L3e38;
+        case 0x3e3a: goto L3e3a;
+        case 0x3e3c: goto L3e3c;
+        case 0x3e40: goto L3e40;
+        case 0x3e42: goto L3e42;
+        case 0x3e44: goto L3e44;
+        case 0x3e46: goto L3e46;
+        case 0x4148: goto L4148;
+        case 0x414a: goto L414a;
+        case 0x414c: goto L414c;
+        case 0x414e: goto L414e;
+        case 0x4150: goto L4150;
+        case 0x4152: goto L4152;
+        case 0x4154: goto L4154;
+        case 0x4156: goto L4156;
+        case 0x4158: goto L4158;
+        case 0x415a: goto L415a;
+        case 0x415c: goto L415c;
+        case 0x415e: goto L415e;
+        case 0x4160: goto L4160;
+        case 0x4162: goto L4162;
+        case 0x4164: goto L4164;
+        case 0x4166: goto L4166;
+        case 0x4168: goto L4168;
+        case 0x416a: goto L416a;
+        case 0x416c: goto L416c;
+        case 0x416e: goto L416e;
+        case 0x4170: goto L4170;
+        case 0x4172: goto L4172;
+        case 0x4174: goto L4174;
+        case 0x4176: goto L4176;
+        case 0x4178: goto L4178;
+        case 0x417a: goto L417a;
+        case 0x417c: goto L417c;
+        case 0x417e: goto L417e;
+        case 0x4180: goto L4180;
+        case 0x4182: goto L4182;
+        case 0x4184: goto L4184;
+        case 0x4186: goto L4186;
+        case 0x4188: goto L4188;
+        case 0x418a: goto L418a;
+        case 0x418c: goto L418c;
+        case 0x418e: goto L418e;
+        case 0x4190: goto L4190;
+        case 0x4192: goto L4192;
+        case 0x4194: goto L4194;
+        case 0x4196: goto L4196;
+        case 0x4198: goto L4198;
+        case 0x419a: goto L419a;
+        case 0x41ee: goto L41ee;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: setd
+    AOT_GOTO(0x0002, L0002);
+L0002:
+    AOT_BLOCK(0x0002, 3);
+    // 0002: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+    }
+    // 0004: mov (r0), -(sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0006: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0008, L0008);
+L0008:
+    AOT_BLOCK(0x0008, 2);
+    // 0008: mov r0, 2(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 000c: jsr pc, 0018
+    {
+        a = 0x0018;
+        r[6] -= 2;
+        WR16(r[6], 0x0010);
+    }
+    AOT_GOTO(0x0018, L0018);
+L0010:
+    AOT_BLOCK(0x0010, 1);
+    // 0010: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0012, L0012);
+L0012:
+    AOT_BLOCK(0x0012, 1);
+    // 0012: jsr pc, *$3c68
+    {
+        a = 0x3c68;
+        r[6] -= 2;
+        WR16(r[6], 0x0016);
+    }
+    AOT_GOTO(0x3c68, L3c68);
+L0016:
+    // 0016: sys 1
+    AOT_INTERP(0x0016);
+L0018:
+    AOT_BLOCK(0x0018, 2);
+    // 0018: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x001c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x001c, L001c);
+L001a:
+    AOT_BLOCK(0x001a, 1);
+    // 001a: bit 25f5(r1), (sp)+
+    {
+        a = uint16_t(r[1] + 9717);
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x001e, L001e);
+L001c:
+    AOT_BLOCK(0x001c, 1);
+    // 001c: cmp $4, 4(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0022, L0022);
+L001e:
+    // 001e: iot
+    AOT_INTERP(0x001e);
+L0020:
+    // 0020: iot
+    AOT_INTERP(0x0020);
+L0022:
+    AOT_BLOCK(0x0022, 1);
+    // 0022: ble 0034
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0034, L0034);
+    AOT_GOTO(0x0024, L0024);
+L0024:
+    AOT_BLOCK(0x0024, 1);
+    // 0024: mov $3e46, (sp)
+    {
+        src = uint16_t(0x3e46);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0028, L0028);
+L0028:
+    AOT_BLOCK(0x0028, 1);
+    // 0028: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x002c);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L002a:
+    AOT_BLOCK(0x002a, 1);
+    // 002a: mov *15ce(r1), *-(r0)
+    {
+        a = RD16(r[1] + 5582);
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 002e: wait
+    AOT_INTERP(0x002e);
+L002c:
+    AOT_BLOCK(0x002c, 1);
+    // 002c: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0030, L0030);
+L0030:
+    AOT_BLOCK(0x0030, 1);
+    // 0030: jsr pc, *$3c68
+    {
+        a = 0x3c68;
+        r[6] -= 2;
+        WR16(r[6], 0x0034);
+    }
+    AOT_GOTO(0x3c68, L3c68);
+L0034:
+    AOT_BLOCK(0x0034, 1);
+    // 0034: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0038, L0038);
+L0038:
+    AOT_BLOCK(0x0038, 1);
+    // 0038: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x003c, L003c);
+L003c:
+    AOT_BLOCK(0x003c, 1);
+    // 003c: mov 2(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0040, L0040);
+L0040:
+    AOT_BLOCK(0x0040, 1);
+    // 0040: jsr pc, *$3bc0
+    {
+        a = 0x3bc0;
+        r[6] -= 2;
+        WR16(r[6], 0x0044);
+    }
+    AOT_GOTO(0x3bc0, L3bc0);
+L0044:
+    AOT_BLOCK(0x0044, 1);
+    // 0044: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0046, L0046);
+L0046:
+    AOT_BLOCK(0x0046, 1);
+    // 0046: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0048, L0048);
+L0048:
+    AOT_BLOCK(0x0048, 1);
+    // 0048: bge 005a
+    if (!(N ^ V))
+        AOT_GOTO(0x005a, L005a);
+    AOT_GOTO(0x004a, L004a);
+L004a:
+    AOT_BLOCK(0x004a, 1);
+    // 004a: mov $3e50, (sp)
+    {
+        src = uint16_t(0x3e50);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x004e, L004e);
+L004e:
+    AOT_BLOCK(0x004e, 1);
+    // 004e: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x0052);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L0052:
+    AOT_BLOCK(0x0052, 1);
+    // 0052: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0056, L0056);
+L0056:
+    AOT_BLOCK(0x0056, 1);
+    // 0056: jsr pc, *$3c68
+    {
+        a = 0x3c68;
+        r[6] -= 2;
+        WR16(r[6], 0x005a);
+    }
+    AOT_GOTO(0x3c68, L3c68);
+L005a:
+    AOT_BLOCK(0x005a, 2);
+    // 005a: mov $1b6, (sp)
+    {
+        src = uint16_t(0x01b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 005e: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0062, L0062);
+L0062:
+    AOT_BLOCK(0x0062, 1);
+    // 0062: mov 6(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0066, L0066);
+L0066:
+    AOT_BLOCK(0x0066, 1);
+    // 0066: jsr pc, *$3ba2
+    {
+        a = 0x3ba2;
+        r[6] -= 2;
+        WR16(r[6], 0x006a);
+    }
+    AOT_GOTO(0x3ba2, L3ba2);
+L006a:
+    AOT_BLOCK(0x006a, 1);
+    // 006a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x006c, L006c);
+L006c:
+    AOT_BLOCK(0x006c, 1);
+    // 006c: mov r0, 5e04
+    {
+        src = r[0];
+        b = 0x5e04;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0070, L0070);
+L0070:
+    AOT_BLOCK(0x0070, 1);
+    // 0070: bge 008c
+    if (!(N ^ V))
+        AOT_GOTO(0x008c, L008c);
+    AOT_GOTO(0x0072, L0072);
+L0072:
+    AOT_BLOCK(0x0072, 3);
+    // 0072: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0076: mov 6(r0), (sp)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 007a: mov $3e62, -(sp)
+    {
+        src = uint16_t(0x3e62);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x007e, L007e);
+L007e:
+    AOT_BLOCK(0x007e, 1);
+    // 007e: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x0082);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L0082:
+    AOT_BLOCK(0x0082, 3);
+    // 0082: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0084: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0088: jsr pc, *$3c68
+    {
+        a = 0x3c68;
+        r[6] -= 2;
+        WR16(r[6], 0x008c);
+    }
+    AOT_GOTO(0x3c68, L3c68);
+L008c:
+    AOT_BLOCK(0x008c, 2);
+    // 008c: mov $59f8, 59f6
+    {
+        src = uint16_t(0x59f8);
+        b = 0x59f6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0092: jsr pc, 1eee
+    {
+        a = 0x1eee;
+        r[6] -= 2;
+        WR16(r[6], 0x0096);
+    }
+    AOT_GOTO(0x1eee, L1eee);
+L0096:
+    AOT_BLOCK(0x0096, 2);
+    // 0096: tst 59f4
+    {
+        a = 0x59f4;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 009a: beq 00a4
+    if (Z)
+        AOT_GOTO(0x00a4, L00a4);
+    AOT_GOTO(0x009c, L009c);
+L009c:
+    AOT_BLOCK(0x009c, 2);
+    // 009c: mov $3e72, (sp)
+    {
+        src = uint16_t(0x3e72);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00a0: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x00a4);
+    }
+    AOT_GOTO(0x396a, L396a);
+L00a4:
+    AOT_BLOCK(0x00a4, 3);
+    // 00a4: movb 57e6, r0
+    {
+        a = 0x57e6;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 00a8: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00aa: jsr pc, *$3b8c
+    {
+        a = 0x3b8c;
+        r[6] -= 2;
+        WR16(r[6], 0x00ae);
+    }
+    AOT_GOTO(0x3b8c, L3b8c);
+L00ae:
+    AOT_BLOCK(0x00ae, 4);
+    // 00ae: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00b2: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00b6: mov 4(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00ba: jsr pc, *$3bc0
+    {
+        a = 0x3bc0;
+        r[6] -= 2;
+        WR16(r[6], 0x00be);
+    }
+    AOT_GOTO(0x3bc0, L3bc0);
+L00be:
+    AOT_BLOCK(0x00be, 3);
+    // 00be: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 00c0: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 00c2: bge 00d4
+    if (!(N ^ V))
+        AOT_GOTO(0x00d4, L00d4);
+    AOT_GOTO(0x00c4, L00c4);
+L00c4:
+    AOT_BLOCK(0x00c4, 2);
+    // 00c4: mov $3e82, (sp)
+    {
+        src = uint16_t(0x3e82);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00c8: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x00cc);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L00cc:
+    AOT_BLOCK(0x00cc, 2);
+    // 00cc: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00d0: jsr pc, *$3c68
+    {
+        a = 0x3c68;
+        r[6] -= 2;
+        WR16(r[6], 0x00d4);
+    }
+    AOT_GOTO(0x3c68, L3c68);
+L00d4:
+    AOT_BLOCK(0x00d4, 2);
+    // 00d4: mov $3e94, (sp)
+    {
+        src = uint16_t(0x3e94);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00d8: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x00dc);
+    }
+    AOT_GOTO(0x396a, L396a);
+L00dc:
+    AOT_BLOCK(0x00dc, 1);
+    // 00dc: jsr pc, 1eee
+    {
+        a = 0x1eee;
+        r[6] -= 2;
+        WR16(r[6], 0x00e0);
+    }
+    AOT_GOTO(0x1eee, L1eee);
+L00e0:
+    AOT_BLOCK(0x00e0, 1);
+    // 00e0: jsr pc, 3b4a
+    {
+        a = 0x3b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x00e4);
+    }
+    AOT_GOTO(0x3b4a, L3b4a);
+L00e4:
+    AOT_BLOCK(0x00e4, 2);
+    // 00e4: tst 59ec
+    {
+        a = 0x59ec;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 00e8: bne 00ee
+    if (!Z)
+        AOT_GOTO(0x00ee, L00ee);
+    AOT_GOTO(0x00ea, L00ea);
+L00ea:
+    AOT_BLOCK(0x00ea, 2);
+    // 00ea: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 00ec: br 00f2
+    AOT_GOTO(0x00f2, L00f2);
+L00ee:
+    AOT_BLOCK(0x00ee, 1);
+    // 00ee: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00f2, L00f2);
+L00f2:
+    AOT_BLOCK(0x00f2, 1);
+    // 00f2: jsr pc, *$3c68
+    {
+        a = 0x3c68;
+        r[6] -= 2;
+        WR16(r[6], 0x00f6);
+    }
+    AOT_GOTO(0x3c68, L3c68);
+L00f6:
+    AOT_BLOCK(0x00f6, 2);
+    // 00f6: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L00fa:
+    AOT_BLOCK(0x00fa, 4);
+    // 00fa: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x00fe;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 00fe: sub $e, sp
+    {
+        src = uint16_t(0x000e);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 0102: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0106, L0106);
+L0106:
+    AOT_BLOCK(0x0106, 1);
+    // 0106: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0108, L0108);
+L0108:
+    AOT_BLOCK(0x0108, 1);
+    // 0108: bne 0110
+    if (!Z)
+        AOT_GOTO(0x0110, L0110);
+    AOT_GOTO(0x010a, L010a);
+L010a:
+    AOT_BLOCK(0x010a, 1);
+    // 010a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x010c, L010c);
+L010c:
+    AOT_BLOCK(0x010c, 1);
+    // 010c: jmp *$02b6
+    {
+        a = 0x02b6;
+    }
+    AOT_GOTO(0x02b6, L02b6);
+L0110:
+    AOT_BLOCK(0x0110, 2);
+    // 0110: cmp $59ee, 6(r5)
+    {
+        src = uint16_t(0x59ee);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0116: bne 011e
+    if (!Z)
+        AOT_GOTO(0x011e, L011e);
+    AOT_GOTO(0x0118, L0118);
+L0118:
+    AOT_BLOCK(0x0118, 1);
+    // 0118: mov $56e2, 6(r5)
+    {
+        src = uint16_t(0x56e2);
+        b = uint16_t(r[5] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x011e, L011e);
+L011e:
+    AOT_BLOCK(0x011e, 2);
+    // 011e: mov (r3), -8(r5)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0122: bne 012a
+    if (!Z)
+        AOT_GOTO(0x012a, L012a);
+    AOT_GOTO(0x0124, L0124);
+L0124:
+    AOT_BLOCK(0x0124, 2);
+    // 0124: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0126: jmp *$02b6
+    {
+        a = 0x02b6;
+    }
+    AOT_GOTO(0x02b6, L02b6);
+L012a:
+    AOT_BLOCK(0x012a, 5);
+    // 012a: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 012e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0130: mov 4568(r0), -12(r5)
+    {
+        a = uint16_t(r[0] + 17768);
+        src = RD16(a);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 0136: bit $100, -12(r5)
+    {
+        src = uint16_t(0x0100);
+        b = uint16_t(r[5] + -18);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 013c: bne 0144
+    if (!Z)
+        AOT_GOTO(0x0144, L0144);
+    AOT_GOTO(0x013e, L013e);
+L013e:
+    AOT_BLOCK(0x013e, 2);
+    // 013e: mov 6(r3), r4
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0142: br 0146
+    AOT_GOTO(0x0146, L0146);
+L0144:
+    AOT_BLOCK(0x0144, 1);
+    // 0144: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0146, L0146);
+L0146:
+    AOT_BLOCK(0x0146, 4);
+    // 0146: mov 2(r4), -e(r5)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 014c: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0150: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0152: jsr pc, *$1474
+    {
+        a = 0x1474;
+        r[6] -= 2;
+        WR16(r[6], 0x0156);
+    }
+    AOT_GOTO(0x1474, L1474);
+L0156:
+    AOT_BLOCK(0x0156, 4);
+    // 0156: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0158: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 015c: bit $1, -12(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -18);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0162: beq 020a
+    if (Z)
+        AOT_GOTO(0x020a, L020a);
+    AOT_GOTO(0x0164, L0164);
+L0164:
+    AOT_BLOCK(0x0164, 5);
+    // 0164: mov 8(r3), -14(r5)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+    }
+    // 016a: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 016c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 016e: bit $200, 4568(r0)
+    {
+        src = uint16_t(0x0200);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0174: beq 01aa
+    if (Z)
+        AOT_GOTO(0x01aa, L01aa);
+    AOT_GOTO(0x0176, L0176);
+L0176:
+    AOT_BLOCK(0x0176, 4);
+    // 0176: mov *-14(r5), r0
+    {
+        a = RD16(r[5] + -20);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 017a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 017c: bit $200, 4568(r0)
+    {
+        src = uint16_t(0x0200);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0182: bne 01aa
+    if (!Z)
+        AOT_GOTO(0x01aa, L01aa);
+    AOT_GOTO(0x0184, L0184);
+L0184:
+    AOT_BLOCK(0x0184, 5);
+    // 0184: mov 6(r4), 6(r3)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 018a: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 018e: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0192: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0194: jsr pc, *$00fa
+    {
+        a = 0x00fa;
+        r[6] -= 2;
+        WR16(r[6], 0x0198);
+    }
+    AOT_GOTO(0x00fa, L00fa);
+L0198:
+    AOT_BLOCK(0x0198, 3);
+    // 0198: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 019a: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 019c: beq 01a4
+    if (Z)
+        AOT_GOTO(0x01a4, L01a4);
+    AOT_GOTO(0x019e, L019e);
+L019e:
+    AOT_BLOCK(0x019e, 2);
+    // 019e: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01a0: jmp *$02b6
+    {
+        a = 0x02b6;
+    }
+    AOT_GOTO(0x02b6, L02b6);
+L01a4:
+    AOT_BLOCK(0x01a4, 2);
+    // 01a4: mov r4, 6(r3)
+    {
+        src = r[4];
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01a8: br 01ee
+    AOT_GOTO(0x01ee, L01ee);
+L01aa:
+    AOT_BLOCK(0x01aa, 4);
+    // 01aa: mov *-14(r5), r0
+    {
+        a = RD16(r[5] + -20);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01ae: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 01b0: bit $200, 4568(r0)
+    {
+        src = uint16_t(0x0200);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 01b6: beq 01ee
+    if (Z)
+        AOT_GOTO(0x01ee, L01ee);
+    AOT_GOTO(0x01b8, L01b8);
+L01b8:
+    AOT_BLOCK(0x01b8, 4);
+    // 01b8: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01ba: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 01bc: bit $200, 4568(r0)
+    {
+        src = uint16_t(0x0200);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 01c2: bne 01ee
+    if (!Z)
+        AOT_GOTO(0x01ee, L01ee);
+    AOT_GOTO(0x01c4, L01c4);
+L01c4:
+    AOT_BLOCK(0x01c4, 6);
+    // 01c4: mov -14(r5), r0
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01c8: mov 6(r0), 8(r3)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = uint16_t(r[3] + 8);
+        WR16(b, src);
+    }
+    // 01ce: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01d2: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01d6: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01d8: jsr pc, *$00fa
+    {
+        a = 0x00fa;
+        r[6] -= 2;
+        WR16(r[6], 0x01dc);
+    }
+    AOT_GOTO(0x00fa, L00fa);
+L01dc:
+    AOT_BLOCK(0x01dc, 3);
+    // 01dc: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 01de: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01e0: beq 01e8
+    if (Z)
+        AOT_GOTO(0x01e8, L01e8);
+    AOT_GOTO(0x01e2, L01e2);
+L01e2:
+    AOT_BLOCK(0x01e2, 2);
+    // 01e2: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01e4: jmp *$02b6
+    {
+        a = 0x02b6;
+    }
+    AOT_GOTO(0x02b6, L02b6);
+L01e8:
+    AOT_BLOCK(0x01e8, 1);
+    // 01e8: mov -14(r5), 8(r3)
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        b = uint16_t(r[3] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x01ee, L01ee);
+L01ee:
+    AOT_BLOCK(0x01ee, 4);
+    // 01ee: mov -14(r5), r0
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01f2: mov 2(r0), -10(r5)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+    }
+    // 01f8: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01fc: mov -14(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0200, L0200);
+L0200:
+    AOT_BLOCK(0x0200, 1);
+    // 0200: jsr pc, *$1474
+    {
+        a = 0x1474;
+        r[6] -= 2;
+        WR16(r[6], 0x0204);
+    }
+    AOT_GOTO(0x1474, L1474);
+L0204:
+    AOT_BLOCK(0x0204, 2);
+    // 0204: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0206: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x020a, L020a);
+L020a:
+    AOT_BLOCK(0x020a, 2);
+    // 020a: cmp -8(r5), *6(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = RD16(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0210: beq 0224
+    if (Z)
+        AOT_GOTO(0x0224, L0224);
+    AOT_GOTO(0x0212, L0212);
+L0212:
+    AOT_BLOCK(0x0212, 2);
+    // 0212: tst *6(r5)
+    {
+        a = RD16(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0216: bne 021c
+    if (!Z)
+        AOT_GOTO(0x021c, L021c);
+    AOT_GOTO(0x0218, L0218);
+L0218:
+    AOT_BLOCK(0x0218, 2);
+    // 0218: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 021a: br 02b6
+    AOT_GOTO(0x02b6, L02b6);
+L021c:
+    AOT_BLOCK(0x021c, 2);
+    // 021c: add $4, 6(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0222: br 020a
+    AOT_GOTO(0x020a, L020a);
+L0224:
+    AOT_BLOCK(0x0224, 2);
+    // 0224: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0228: mov 2(r0), r2
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x022c, L022c);
+L022c:
+    AOT_BLOCK(0x022c, 2);
+    // 022c: tstb (r2)
+    {
+        a = r[2];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 022e: beq 02b2
+    if (Z)
+        AOT_GOTO(0x02b2, L02b2);
+    AOT_GOTO(0x0230, L0230);
+L0230:
+    AOT_BLOCK(0x0230, 4);
+    // 0230: movb (r2), r0
+    {
+        a = r[2];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0232: bic $ffc0, r0
+    {
+        src = uint16_t(0xffc0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0236: cmp -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 023a: bgt 02ac
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x02ac, L02ac);
+    AOT_GOTO(0x023c, L023c);
+L023c:
+    AOT_BLOCK(0x023c, 2);
+    // 023c: cmpb $40, (r2)
+    {
+        src = uint8_t(0x40);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0240: bgt 0248
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0248, L0248);
+    AOT_GOTO(0x0242, L0242);
+L0242:
+    AOT_BLOCK(0x0242, 2);
+    // 0242: cmp $24, (r4)
+    {
+        src = uint16_t(0x0024);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0246: bne 02ac
+    if (!Z)
+        AOT_GOTO(0x02ac, L02ac);
+    AOT_GOTO(0x0248, L0248);
+L0248:
+    AOT_BLOCK(0x0248, 5);
+    // 0248: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 024c: movb 1(r2), r0
+    {
+        a = uint16_t(r[2] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0250: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0252: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0254: jsr pc, *$1528
+    {
+        a = 0x1528;
+        r[6] -= 2;
+        WR16(r[6], 0x0258);
+    }
+    AOT_GOTO(0x1528, L1528);
+L0258:
+    AOT_BLOCK(0x0258, 3);
+    // 0258: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 025a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 025c: beq 0260
+    if (Z)
+        AOT_GOTO(0x0260, L0260);
+    AOT_GOTO(0x025e, L025e);
+L025e:
+    AOT_BLOCK(0x025e, 1);
+    // 025e: br 02ac
+    AOT_GOTO(0x02ac, L02ac);
+L0260:
+    AOT_BLOCK(0x0260, 4);
+    // 0260: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0264: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0266: bit $1, 4568(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 026c: beq 02a8
+    if (Z)
+        AOT_GOTO(0x02a8, L02a8);
+    AOT_GOTO(0x026e, L026e);
+L026e:
+    AOT_BLOCK(0x026e, 2);
+    // 026e: tst -14(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0272: beq 02a8
+    if (Z)
+        AOT_GOTO(0x02a8, L02a8);
+    AOT_GOTO(0x0274, L0274);
+L0274:
+    AOT_BLOCK(0x0274, 4);
+    // 0274: movb 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0278: bic $ffc0, r0
+    {
+        src = uint16_t(0xffc0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 027c: cmp -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0280: bgt 02ac
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x02ac, L02ac);
+    AOT_GOTO(0x0282, L0282);
+L0282:
+    AOT_BLOCK(0x0282, 2);
+    // 0282: cmpb $40, 2(r2)
+    {
+        src = uint8_t(0x40);
+        b = uint16_t(r[2] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0288: bgt 0292
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0292, L0292);
+    AOT_GOTO(0x028a, L028a);
+L028a:
+    AOT_BLOCK(0x028a, 2);
+    // 028a: cmp $24, *-14(r5)
+    {
+        src = uint16_t(0x0024);
+        b = RD16(r[5] + -20);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0290: bne 02ac
+    if (!Z)
+        AOT_GOTO(0x02ac, L02ac);
+    AOT_GOTO(0x0292, L0292);
+L0292:
+    AOT_BLOCK(0x0292, 5);
+    // 0292: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0294: movb 3(r2), r0
+    {
+        a = uint16_t(r[2] + 3);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0298: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 029a: mov -14(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 029e: jsr pc, *$1528
+    {
+        a = 0x1528;
+        r[6] -= 2;
+        WR16(r[6], 0x02a2);
+    }
+    AOT_GOTO(0x1528, L1528);
+L02a2:
+    AOT_BLOCK(0x02a2, 3);
+    // 02a2: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 02a4: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 02a6: bne 02ac
+    if (!Z)
+        AOT_GOTO(0x02ac, L02ac);
+    AOT_GOTO(0x02a8, L02a8);
+L02a8:
+    AOT_BLOCK(0x02a8, 2);
+    // 02a8: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02aa: br 02b6
+    AOT_GOTO(0x02b6, L02b6);
+L02ac:
+    AOT_BLOCK(0x02ac, 2);
+    // 02ac: add $6, r2
+    {
+        src = uint16_t(0x0006);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 02b0: br 022c
+    AOT_GOTO(0x022c, L022c);
+L02b2:
+    AOT_BLOCK(0x02b2, 2);
+    // 02b2: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 02b4: br 02b6
+    AOT_GOTO(0x02b6, L02b6);
+L02b6:
+    AOT_BLOCK(0x02b6, 2);
+    // 02b6: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L02ba:
+    AOT_BLOCK(0x02ba, 7);
+    // 02ba: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x02be;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 02be: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 02c2: mov 6(r5), r2
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 02c6: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+    }
+    // 02ca: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 02ce: bge 02f0
+    if (!(N ^ V))
+        AOT_GOTO(0x02f0, L02f0);
+    AOT_GOTO(0x02d0, L02d0);
+L02d0:
+    AOT_BLOCK(0x02d0, 6);
+    // 02d0: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 02d4: mov 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 02d8: com r0
+    {
+        val = ~int(r[0]);
+        r[0] = val;
+    }
+    // 02da: mov r0, 8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 8);
+        WR16(b, src);
+    }
+    // 02de: cmp $10, 8(r5)
+    {
+        src = uint16_t(0x0010);
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02e4: bgt 02f0
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x02f0, L02f0);
+    AOT_GOTO(0x02e6, L02e6);
+L02e6:
+    AOT_BLOCK(0x02e6, 2);
+    // 02e6: sub $10, 8(r5)
+    {
+        src = uint16_t(0x0010);
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[5] + 8);
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 02ec: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x02f0, L02f0);
+L02f0:
+    AOT_BLOCK(0x02f0, 3);
+    // 02f0: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 02f4: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 02f6: bne 02fe
+    if (!Z)
+        AOT_GOTO(0x02fe, L02fe);
+    AOT_GOTO(0x02f8, L02f8);
+L02f8:
+    AOT_BLOCK(0x02f8, 2);
+    // 02f8: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 02fa: jmp *$066a
+    {
+        a = 0x066a;
+    }
+    AOT_GOTO(0x066a, L066a);
+L02fe:
+    AOT_BLOCK(0x02fe, 2);
+    // 02fe: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0300: jmp *$04e4
+    {
+        a = 0x04e4;
+    }
+    AOT_GOTO(0x04e4, L04e4);
+L0304:
+    AOT_BLOCK(0x0304, 5);
+    // 0304: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0306: mov 6(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 030a: mov 4(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 030e: mov 2(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0312: jsr pc, 241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x0316);
+    }
+    AOT_GOTO(0x241c, L241c);
+L0316:
+    AOT_BLOCK(0x0316, 3);
+    // 0316: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0318: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 031a: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x031e);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L031e:
+    AOT_BLOCK(0x031e, 3);
+    // 031e: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0322: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0324: jmp *$066a
+    {
+        a = 0x066a;
+    }
+    AOT_GOTO(0x066a, L066a);
+L0328:
+    AOT_BLOCK(0x0328, 2);
+    // 0328: cmp $23, *6(r3)
+    {
+        src = uint16_t(0x0023);
+        b = RD16(r[3] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 032e: bne 033a
+    if (!Z)
+        AOT_GOTO(0x033a, L033a);
+    AOT_GOTO(0x0330, L0330);
+L0330:
+    AOT_BLOCK(0x0330, 2);
+    // 0330: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0334: mov 6(r0), 6(r3)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x033a, L033a);
+L033a:
+    AOT_BLOCK(0x033a, 2);
+    // 033a: cmp $14, *6(r3)
+    {
+        src = uint16_t(0x0014);
+        b = RD16(r[3] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0340: bne 034c
+    if (!Z)
+        AOT_GOTO(0x034c, L034c);
+    AOT_GOTO(0x0342, L0342);
+L0342:
+    AOT_BLOCK(0x0342, 2);
+    // 0342: mov 6(r3), (sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0346: jsr pc, *$12a0
+    {
+        a = 0x12a0;
+        r[6] -= 2;
+        WR16(r[6], 0x034a);
+    }
+    AOT_GOTO(0x12a0, L12a0);
+L034a:
+    AOT_BLOCK(0x034a, 1);
+    // 034a: br 036a
+    AOT_GOTO(0x036a, L036a);
+L034c:
+    AOT_BLOCK(0x034c, 2);
+    // 034c: cmp $d2, 6(r3)
+    {
+        src = uint16_t(0x00d2);
+        b = uint16_t(r[3] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0352: bne 0362
+    if (!Z)
+        AOT_GOTO(0x0362, L0362);
+    AOT_GOTO(0x0354, L0354);
+L0354:
+    AOT_BLOCK(0x0354, 3);
+    // 0354: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0358: mov 6(r0), (sp)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 035c: jsr pc, *$1ec4
+    {
+        a = 0x1ec4;
+        r[6] -= 2;
+        WR16(r[6], 0x0360);
+    }
+    AOT_GOTO(0x1ec4, L1ec4);
+L0360:
+    AOT_BLOCK(0x0360, 1);
+    // 0360: br 036a
+    AOT_GOTO(0x036a, L036a);
+L0362:
+    AOT_BLOCK(0x0362, 2);
+    // 0362: mov $3ea2, (sp)
+    {
+        src = uint16_t(0x3ea2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0366: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x036a);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L036a:
+    AOT_BLOCK(0x036a, 2);
+    // 036a: mov $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 036e: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0372);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L0372:
+    AOT_BLOCK(0x0372, 2);
+    // 0372: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0374: jmp *$066a
+    {
+        a = 0x066a;
+    }
+    AOT_GOTO(0x066a, L066a);
+L0378:
+    AOT_BLOCK(0x0378, 4);
+    // 0378: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 037c: mov $4a5e, -(sp)
+    {
+        src = uint16_t(0x4a5e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0380: mov 6(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0384: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0388);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L0388:
+    AOT_BLOCK(0x0388, 4);
+    // 0388: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 038a: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 038c: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 038e: beq 03a8
+    if (Z)
+        AOT_GOTO(0x03a8, L03a8);
+    AOT_GOTO(0x0390, L0390);
+L0390:
+    AOT_BLOCK(0x0390, 3);
+    // 0390: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0392: mov 6(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0396: jsr pc, 164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x039a);
+    }
+    AOT_GOTO(0x164e, L164e);
+L039a:
+    AOT_BLOCK(0x039a, 4);
+    // 039a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 039c: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 039e: mov $3eb9, -(sp)
+    {
+        src = uint16_t(0x3eb9);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03a2: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x03a6);
+    }
+    AOT_GOTO(0x396a, L396a);
+L03a6:
+    AOT_BLOCK(0x03a6, 1);
+    // 03a6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x03a8, L03a8);
+L03a8:
+    AOT_BLOCK(0x03a8, 2);
+    // 03a8: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 03aa: jmp *$066a
+    {
+        a = 0x066a;
+    }
+    AOT_GOTO(0x066a, L066a);
+L03ae:
+    AOT_BLOCK(0x03ae, 4);
+    // 03ae: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03b2: mov $5300, -(sp)
+    {
+        src = uint16_t(0x5300);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03b6: mov 6(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03ba: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x03be);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L03be:
+    AOT_BLOCK(0x03be, 4);
+    // 03be: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 03c0: mov 8(r3), r3
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 03c4: mov r3, 4(r5)
+    {
+        src = r[3];
+        b = uint16_t(r[5] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03c8: jmp *$04fe
+    {
+        a = 0x04fe;
+    }
+    AOT_GOTO(0x04fe, L04fe);
+L03cc:
+    AOT_BLOCK(0x03cc, 2);
+    // 03cc: cmp $564e, r2
+    {
+        src = uint16_t(0x564e);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03d0: bne 03f8
+    if (!Z)
+        AOT_GOTO(0x03f8, L03f8);
+    AOT_GOTO(0x03d2, L03d2);
+L03d2:
+    AOT_BLOCK(0x03d2, 7);
+    // 03d2: mov $51, (r3)
+    {
+        src = uint16_t(0x0051);
+        b = r[3];
+        WR16(b, src);
+    }
+    // 03d6: mov 8(r3), (sp)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03da: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 03dc: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 03de: mov $26, -(sp)
+    {
+        src = uint16_t(0x0026);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03e2: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03e6: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x03ea);
+    }
+    AOT_GOTO(0x3146, L3146);
+L03ea:
+    AOT_BLOCK(0x03ea, 3);
+    // 03ea: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 03ee: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03f0: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x03f4);
+    }
+    AOT_GOTO(0x241c, L241c);
+L03f4:
+    AOT_BLOCK(0x03f4, 1);
+    // 03f4: mov r0, 8(r3)
+    {
+        src = r[0];
+        b = uint16_t(r[3] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03f8, L03f8);
+L03f8:
+    AOT_BLOCK(0x03f8, 1);
+    // 03f8: jmp *$04fe
+    {
+        a = 0x04fe;
+    }
+    AOT_GOTO(0x04fe, L04fe);
+L03fc:
+    AOT_BLOCK(0x03fc, 5);
+    // 03fc: clr r4
+    {
+        r[4] = 0;
+    }
+    // 03fe: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+    }
+    // 0402: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+    }
+    // 0406: cmp $14, *6(r3)
+    {
+        src = uint16_t(0x0014);
+        b = RD16(r[3] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 040c: beq 0416
+    if (Z)
+        AOT_GOTO(0x0416, L0416);
+    AOT_GOTO(0x040e, L040e);
+L040e:
+    AOT_BLOCK(0x040e, 2);
+    // 040e: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0412: inc 59f2
+    {
+        a = 0x59f2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0416, L0416);
+L0416:
+    AOT_BLOCK(0x0416, 3);
+    // 0416: mov 8(r3), r3
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 041a: tst (r3)
+    {
+        a = r[3];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 041c: beq 0454
+    if (Z)
+        AOT_GOTO(0x0454, L0454);
+    AOT_GOTO(0x041e, L041e);
+L041e:
+    AOT_BLOCK(0x041e, 2);
+    // 041e: cmp $9, (r3)
+    {
+        src = uint16_t(0x0009);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0422: bne 0440
+    if (!Z)
+        AOT_GOTO(0x0440, L0440);
+    AOT_GOTO(0x0424, L0424);
+L0424:
+    AOT_BLOCK(0x0424, 4);
+    // 0424: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0426: add $fff8, (sp)
+    {
+        src = uint16_t(0xfff8);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 042a: mov 8(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 042e: jsr pc, *$11b6
+    {
+        a = 0x11b6;
+        r[6] -= 2;
+        WR16(r[6], 0x0432);
+    }
+    AOT_GOTO(0x11b6, L11b6);
+L0432:
+    AOT_BLOCK(0x0432, 5);
+    // 0432: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0434: add r0, r4
+    {
+        src = r[0];
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0436: mov 6(r3), r3
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 043a: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 043e: br 041e
+    AOT_GOTO(0x041e, L041e);
+L0440:
+    AOT_BLOCK(0x0440, 4);
+    // 0440: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0442: add $fff8, (sp)
+    {
+        src = uint16_t(0xfff8);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0446: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0448: jsr pc, *$11b6
+    {
+        a = 0x11b6;
+        r[6] -= 2;
+        WR16(r[6], 0x044c);
+    }
+    AOT_GOTO(0x11b6, L11b6);
+L044c:
+    AOT_BLOCK(0x044c, 3);
+    // 044c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 044e: add r0, r4
+    {
+        src = r[0];
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0450: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0454, L0454);
+L0454:
+    AOT_BLOCK(0x0454, 4);
+    // 0454: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0458: mov $63, (r3)
+    {
+        src = uint16_t(0x0063);
+        b = r[3];
+        WR16(b, src);
+    }
+    // 045c: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0460: beq 047a
+    if (Z)
+        AOT_GOTO(0x047a, L047a);
+    AOT_GOTO(0x0462, L0462);
+L0462:
+    AOT_BLOCK(0x0462, 2);
+    // 0462: cmp $14, *6(r3)
+    {
+        src = uint16_t(0x0014);
+        b = RD16(r[3] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0468: bne 047a
+    if (!Z)
+        AOT_GOTO(0x047a, L047a);
+    AOT_GOTO(0x046a, L046a);
+L046a:
+    AOT_BLOCK(0x046a, 3);
+    // 046a: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 046e: cmpb $c, 6(r0)
+    {
+        src = uint8_t(0x0c);
+        b = uint16_t(r[0] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0474: bne 047a
+    if (!Z)
+        AOT_GOTO(0x047a, L047a);
+    AOT_GOTO(0x0476, L0476);
+L0476:
+    AOT_BLOCK(0x0476, 1);
+    // 0476: mov $62, (r3)
+    {
+        src = uint16_t(0x0062);
+        b = r[3];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x047a, L047a);
+L047a:
+    AOT_BLOCK(0x047a, 4);
+    // 047a: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 047e: mov $4a5e, -(sp)
+    {
+        src = uint16_t(0x4a5e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0482: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0484: jsr pc, *$066e
+    {
+        a = 0x066e;
+        r[6] -= 2;
+        WR16(r[6], 0x0488);
+    }
+    AOT_GOTO(0x066e, L066e);
+L0488:
+    AOT_BLOCK(0x0488, 3);
+    // 0488: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 048a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 048c: jsr pc, *$1e28
+    {
+        a = 0x1e28;
+        r[6] -= 2;
+        WR16(r[6], 0x0490);
+    }
+    AOT_GOTO(0x1e28, L1e28);
+L0490:
+    AOT_BLOCK(0x0490, 3);
+    // 0490: sub -a(r5), 59f2
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = 0x59f2;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x59f2;
+        WR16(b, val16);
+    }
+    // 0496: cmp $5300, r2
+    {
+        src = uint16_t(0x5300);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 049a: beq 04a2
+    if (Z)
+        AOT_GOTO(0x04a2, L04a2);
+    AOT_GOTO(0x049c, L049c);
+L049c:
+    AOT_BLOCK(0x049c, 2);
+    // 049c: cmp $4a5e, r2
+    {
+        src = uint16_t(0x4a5e);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04a0: bne 04a8
+    if (!Z)
+        AOT_GOTO(0x04a8, L04a8);
+    AOT_GOTO(0x04a2, L04a2);
+L04a2:
+    AOT_BLOCK(0x04a2, 2);
+    // 04a2: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 04a4: jmp *$066a
+    {
+        a = 0x066a;
+    }
+    AOT_GOTO(0x066a, L066a);
+L04a8:
+    AOT_BLOCK(0x04a8, 2);
+    // 04a8: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 04aa: jmp *$05c2
+    {
+        a = 0x05c2;
+    }
+    AOT_GOTO(0x05c2, L05c2);
+L04ae:
+    AOT_BLOCK(0x04ae, 2);
+    // 04ae: cmp $6, 2(r3)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04b4: bne 04d8
+    if (!Z)
+        AOT_GOTO(0x04d8, L04d8);
+    AOT_GOTO(0x04b6, L04b6);
+L04b6:
+    AOT_BLOCK(0x04b6, 2);
+    // 04b6: cmp $3a, *8(r3)
+    {
+        src = uint16_t(0x003a);
+        b = RD16(r[3] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04bc: bne 04c8
+    if (!Z)
+        AOT_GOTO(0x04c8, L04c8);
+    AOT_GOTO(0x04be, L04be);
+L04be:
+    AOT_BLOCK(0x04be, 2);
+    // 04be: mov 8(r3), r0
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04c2: mov 6(r0), 8(r3)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = uint16_t(r[3] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04c8, L04c8);
+L04c8:
+    AOT_BLOCK(0x04c8, 2);
+    // 04c8: cmp $4c, (r3)
+    {
+        src = uint16_t(0x004c);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04cc: bne 04d4
+    if (!Z)
+        AOT_GOTO(0x04d4, L04d4);
+    AOT_GOTO(0x04ce, L04ce);
+L04ce:
+    AOT_BLOCK(0x04ce, 2);
+    // 04ce: mov $5c, (r3)
+    {
+        src = uint16_t(0x005c);
+        b = r[3];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04d2: br 04d8
+    AOT_GOTO(0x04d8, L04d8);
+L04d4:
+    AOT_BLOCK(0x04d4, 1);
+    // 04d4: mov $5b, (r3)
+    {
+        src = uint16_t(0x005b);
+        b = r[3];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04d8, L04d8);
+L04d8:
+    AOT_BLOCK(0x04d8, 1);
+    // 04d8: br 04fe
+    AOT_GOTO(0x04fe, L04fe);
+L04da:
+    AOT_BLOCK(0x04da, 2);
+    // 04da: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04dc: jsr pc, *$1b30
+    {
+        a = 0x1b30;
+        r[6] -= 2;
+        WR16(r[6], 0x04e0);
+    }
+    AOT_GOTO(0x1b30, L1b30);
+L04e0:
+    AOT_BLOCK(0x04e0, 2);
+    // 04e0: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04e2: br 04fe
+    AOT_GOTO(0x04fe, L04fe);
+L04e4:
+    AOT_BLOCK(0x04e4, 7);
+    // 04e4: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 04e6: clr r0
+    {
+        r[0] = 0;
+    }
+    // 04e8: div $5, r0
+    {
+        src = int16_t(uint16_t(0x0005));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 04ec: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 04ee: add $3cf0, r1
+    {
+        src = uint16_t(0x3cf0);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 04f2: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 04f4: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04f6, L04f6);
+L04f6:
+    AOT_BLOCK(0x04f6, 2);
+    // 04f6: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04f8: bne 04f6
+    if (!Z)
+        AOT_GOTO(0x04f6, L04f6);
+    AOT_GOTO(0x04fa, L04fa);
+L04fa:
+    AOT_BLOCK(0x04fa, 1);
+    // 04fa: jmp *22(r1)
+    {
+        a = RD16(r[1] + 34);
+    }
+    AOT_JUMP(a);
+L04fe:
+    AOT_BLOCK(0x04fe, 2);
+    // 04fe: cmp $564e, r2
+    {
+        src = uint16_t(0x564e);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0502: beq 0544
+    if (Z)
+        AOT_GOTO(0x0544, L0544);
+    AOT_GOTO(0x0504, L0504);
+L0504:
+    AOT_BLOCK(0x0504, 2);
+    // 0504: cmp 5de2, r2
+    {
+        a = 0x5de2;
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0508: beq 0544
+    if (Z)
+        AOT_GOTO(0x0544, L0544);
+    AOT_GOTO(0x050a, L050a);
+L050a:
+    AOT_BLOCK(0x050a, 2);
+    // 050a: cmp $2, -c(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0510: ble 0544
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0544, L0544);
+    AOT_GOTO(0x0512, L0512);
+L0512:
+    AOT_BLOCK(0x0512, 4);
+    // 0512: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0514: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0516: bit $100, 4568(r0)
+    {
+        src = uint16_t(0x0100);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 051c: bne 0544
+    if (!Z)
+        AOT_GOTO(0x0544, L0544);
+    AOT_GOTO(0x051e, L051e);
+L051e:
+    AOT_BLOCK(0x051e, 5);
+    // 051e: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0522: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0524: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0526: add $4, (sp)
+    {
+        src = uint16_t(0x0004);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 052a: jsr pc, *$101c
+    {
+        a = 0x101c;
+        r[6] -= 2;
+        WR16(r[6], 0x052e);
+    }
+    AOT_GOTO(0x101c, L101c);
+L052e:
+    AOT_BLOCK(0x052e, 3);
+    // 052e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0530: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0532: beq 0544
+    if (Z)
+        AOT_GOTO(0x0544, L0544);
+    AOT_GOTO(0x0534, L0534);
+L0534:
+    AOT_BLOCK(0x0534, 5);
+    // 0534: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0538: mov $5300, r2
+    {
+        src = uint16_t(0x5300);
+        r[2] = src;
+    }
+    // 053c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 053e: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+    }
+    // 0540: mov r0, 8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0544, L0544);
+L0544:
+    AOT_BLOCK(0x0544, 2);
+    // 0544: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0548: bne 0576
+    if (!Z)
+        AOT_GOTO(0x0576, L0576);
+    AOT_GOTO(0x054a, L054a);
+L054a:
+    AOT_BLOCK(0x054a, 5);
+    // 054a: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 054e: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0550: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0552: add $4, (sp)
+    {
+        src = uint16_t(0x0004);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0556: jsr pc, *$0db2
+    {
+        a = 0x0db2;
+        r[6] -= 2;
+        WR16(r[6], 0x055a);
+    }
+    AOT_GOTO(0x0db2, L0db2);
+L055a:
+    AOT_BLOCK(0x055a, 3);
+    // 055a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 055c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 055e: beq 0576
+    if (Z)
+        AOT_GOTO(0x0576, L0576);
+    AOT_GOTO(0x0560, L0560);
+L0560:
+    AOT_BLOCK(0x0560, 2);
+    // 0560: cmp $564e, r2
+    {
+        src = uint16_t(0x564e);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0564: bne 0576
+    if (!Z)
+        AOT_GOTO(0x0576, L0576);
+    AOT_GOTO(0x0566, L0566);
+L0566:
+    AOT_BLOCK(0x0566, 2);
+    // 0566: cmp $14, *4(r5)
+    {
+        src = uint16_t(0x0014);
+        b = RD16(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 056c: bne 0576
+    if (!Z)
+        AOT_GOTO(0x0576, L0576);
+    AOT_GOTO(0x056e, L056e);
+L056e:
+    AOT_BLOCK(0x056e, 2);
+    // 056e: mov 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0572: jmp *$066a
+    {
+        a = 0x066a;
+    }
+    AOT_GOTO(0x066a, L066a);
+L0576:
+    AOT_BLOCK(0x0576, 3);
+    // 0576: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 057a: cmp $5300, r2
+    {
+        src = uint16_t(0x5300);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 057e: bne 058e
+    if (!Z)
+        AOT_GOTO(0x058e, L058e);
+    AOT_GOTO(0x0580, L0580);
+L0580:
+    AOT_BLOCK(0x0580, 2);
+    // 0580: cmp $14, (r3)
+    {
+        src = uint16_t(0x0014);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0584: bne 058e
+    if (!Z)
+        AOT_GOTO(0x058e, L058e);
+    AOT_GOTO(0x0586, L0586);
+L0586:
+    AOT_BLOCK(0x0586, 2);
+    // 0586: mov 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 058a: jmp *$066a
+    {
+        a = 0x066a;
+    }
+    AOT_GOTO(0x066a, L066a);
+L058e:
+    AOT_BLOCK(0x058e, 4);
+    // 058e: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0592: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0594: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0596: jsr pc, *$066e
+    {
+        a = 0x066e;
+        r[6] -= 2;
+        WR16(r[6], 0x059a);
+    }
+    AOT_GOTO(0x066e, L066e);
+L059a:
+    AOT_BLOCK(0x059a, 4);
+    // 059a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 059c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 059e: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05a0: blt 05a6
+    if (N ^ V)
+        AOT_GOTO(0x05a6, L05a6);
+    AOT_GOTO(0x05a2, L05a2);
+L05a2:
+    AOT_BLOCK(0x05a2, 2);
+    // 05a2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05a4: br 066a
+    AOT_GOTO(0x066a, L066a);
+L05a6:
+    AOT_BLOCK(0x05a6, 2);
+    // 05a6: cmp $4a5e, r2
+    {
+        src = uint16_t(0x4a5e);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05aa: beq 0630
+    if (Z)
+        AOT_GOTO(0x0630, L0630);
+    AOT_GOTO(0x05ac, L05ac);
+L05ac:
+    AOT_BLOCK(0x05ac, 4);
+    // 05ac: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05b0: mov $4a5e, -(sp)
+    {
+        src = uint16_t(0x4a5e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05b4: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05b6: jsr pc, *$066e
+    {
+        a = 0x066e;
+        r[6] -= 2;
+        WR16(r[6], 0x05ba);
+    }
+    AOT_GOTO(0x066e, L066e);
+L05ba:
+    AOT_BLOCK(0x05ba, 4);
+    // 05ba: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 05bc: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 05be: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05c0: blt 0630
+    if (N ^ V)
+        AOT_GOTO(0x0630, L0630);
+    AOT_GOTO(0x05c2, L05c2);
+L05c2:
+    AOT_BLOCK(0x05c2, 2);
+    // 05c2: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05c4: jsr pc, *$164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x05c8);
+    }
+    AOT_GOTO(0x164e, L164e);
+L05c8:
+    AOT_BLOCK(0x05c8, 3);
+    // 05c8: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 05cc: cmp $56e2, r2
+    {
+        src = uint16_t(0x56e2);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05d0: beq 05d8
+    if (Z)
+        AOT_GOTO(0x05d8, L05d8);
+    AOT_GOTO(0x05d2, L05d2);
+L05d2:
+    AOT_BLOCK(0x05d2, 2);
+    // 05d2: cmp $59ee, r2
+    {
+        src = uint16_t(0x59ee);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05d6: bne 0616
+    if (!Z)
+        AOT_GOTO(0x0616, L0616);
+    AOT_GOTO(0x05d8, L05d8);
+L05d8:
+    AOT_BLOCK(0x05d8, 2);
+    // 05d8: cmp $6, 2(r3)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05de: bne 05f2
+    if (!Z)
+        AOT_GOTO(0x05f2, L05f2);
+    AOT_GOTO(0x05e0, L05e0);
+L05e0:
+    AOT_BLOCK(0x05e0, 4);
+    // 05e0: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05e2: inc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 05e4: mov $3ec7, -(sp)
+    {
+        src = uint16_t(0x3ec7);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05e8: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x05ec);
+    }
+    AOT_GOTO(0x396a, L396a);
+L05ec:
+    AOT_BLOCK(0x05ec, 2);
+    // 05ec: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 05ee: inc 59f2
+    {
+        a = 0x59f2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x05f2, L05f2);
+L05f2:
+    AOT_BLOCK(0x05f2, 2);
+    // 05f2: cmp $56e2, r2
+    {
+        src = uint16_t(0x56e2);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05f6: bne 05fe
+    if (!Z)
+        AOT_GOTO(0x05fe, L05fe);
+    AOT_GOTO(0x05f8, L05f8);
+L05f8:
+    AOT_BLOCK(0x05f8, 2);
+    // 05f8: mov $2d, (sp)
+    {
+        src = uint16_t(0x002d);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05fc: br 0600
+    AOT_GOTO(0x0600, L0600);
+L05fe:
+    AOT_BLOCK(0x05fe, 1);
+    // 05fe: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0600, L0600);
+L0600:
+    AOT_BLOCK(0x0600, 4);
+    // 0600: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0602: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0606: mov $3ed6, -(sp)
+    {
+        src = uint16_t(0x3ed6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 060a: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x060e);
+    }
+    AOT_GOTO(0x396a, L396a);
+L060e:
+    AOT_BLOCK(0x060e, 2);
+    // 060e: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0612: inc 59f2
+    {
+        a = 0x59f2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0616, L0616);
+L0616:
+    AOT_BLOCK(0x0616, 2);
+    // 0616: cmp $564e, r2
+    {
+        src = uint16_t(0x564e);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 061a: bne 062c
+    if (!Z)
+        AOT_GOTO(0x062c, L062c);
+    AOT_GOTO(0x061c, L061c);
+L061c:
+    AOT_BLOCK(0x061c, 4);
+    // 061c: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 061e: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0622: mov $3ee8, -(sp)
+    {
+        src = uint16_t(0x3ee8);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0626: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x062a);
+    }
+    AOT_GOTO(0x396a, L396a);
+L062a:
+    AOT_BLOCK(0x062a, 1);
+    // 062a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x062c, L062c);
+L062c:
+    AOT_BLOCK(0x062c, 2);
+    // 062c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 062e: br 066a
+    AOT_GOTO(0x066a, L066a);
+L0630:
+    AOT_BLOCK(0x0630, 2);
+    // 0630: tst (r3)
+    {
+        a = r[3];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0632: ble 0658
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0658, L0658);
+    AOT_GOTO(0x0634, L0634);
+L0634:
+    AOT_BLOCK(0x0634, 2);
+    // 0634: cmp $6e, (r3)
+    {
+        src = uint16_t(0x006e);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0638: ble 0658
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0658, L0658);
+    AOT_GOTO(0x063a, L063a);
+L063a:
+    AOT_BLOCK(0x063a, 4);
+    // 063a: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 063c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 063e: tst 4646(r0)
+    {
+        a = uint16_t(r[0] + 17990);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0642: beq 0658
+    if (Z)
+        AOT_GOTO(0x0658, L0658);
+    AOT_GOTO(0x0644, L0644);
+L0644:
+    AOT_BLOCK(0x0644, 5);
+    // 0644: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0646: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0648: mov 4646(r0), (sp)
+    {
+        a = uint16_t(r[0] + 17990);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 064c: mov $3ef3, -(sp)
+    {
+        src = uint16_t(0x3ef3);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0650: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x0654);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L0654:
+    AOT_BLOCK(0x0654, 2);
+    // 0654: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0656: br 0664
+    AOT_GOTO(0x0664, L0664);
+L0658:
+    AOT_BLOCK(0x0658, 3);
+    // 0658: mov (r3), (sp)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 065a: mov $3f0c, -(sp)
+    {
+        src = uint16_t(0x3f0c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 065e: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x0662);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L0662:
+    AOT_BLOCK(0x0662, 1);
+    // 0662: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0664, L0664);
+L0664:
+    AOT_BLOCK(0x0664, 2);
+    // 0664: mov 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0668: br 066a
+    AOT_GOTO(0x066a, L066a);
+L066a:
+    AOT_BLOCK(0x066a, 2);
+    // 066a: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L066e:
+    AOT_BLOCK(0x066e, 12);
+    // 066e: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0672;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0672: sub $16, sp
+    {
+        src = uint16_t(0x0016);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0676: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 067a: mov 8(r5), -12(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 0680: mov 8(r2), r3
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0684: mov (r2), -8(r5)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0688: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 068c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 068e: mov 4568(r0), -1a(r5)
+    {
+        a = uint16_t(r[0] + 17768);
+        src = RD16(a);
+        b = uint16_t(r[5] + -26);
+        WR16(b, src);
+    }
+    // 0694: bit $4, -1a(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -26);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 069a: bne 06b4
+    if (!Z)
+        AOT_GOTO(0x06b4, L06b4);
+    AOT_GOTO(0x069c, L069c);
+L069c:
+    AOT_BLOCK(0x069c, 2);
+    // 069c: cmp $35, -8(r5)
+    {
+        src = uint16_t(0x0035);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06a2: beq 06b4
+    if (Z)
+        AOT_GOTO(0x06b4, L06b4);
+    AOT_GOTO(0x06a4, L06a4);
+L06a4:
+    AOT_BLOCK(0x06a4, 2);
+    // 06a4: cmp $36, -8(r5)
+    {
+        src = uint16_t(0x0036);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06aa: beq 06b4
+    if (Z)
+        AOT_GOTO(0x06b4, L06b4);
+    AOT_GOTO(0x06ac, L06ac);
+L06ac:
+    AOT_BLOCK(0x06ac, 2);
+    // 06ac: cmp $22, -8(r5)
+    {
+        src = uint16_t(0x0022);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06b2: bne 0728
+    if (!Z)
+        AOT_GOTO(0x0728, L0728);
+    AOT_GOTO(0x06b4, L06b4);
+L06b4:
+    AOT_BLOCK(0x06b4, 2);
+    // 06b4: cmp $564e, 6(r5)
+    {
+        src = uint16_t(0x564e);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06ba: beq 0728
+    if (Z)
+        AOT_GOTO(0x0728, L0728);
+    AOT_GOTO(0x06bc, L06bc);
+L06bc:
+    AOT_BLOCK(0x06bc, 8);
+    // 06bc: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06c0: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06c4: mov 3cec, r0
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 06c8: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 06cc: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06ce: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 06d2: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06d4: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x06d8);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L06d8:
+    AOT_BLOCK(0x06d8, 5);
+    // 06d8: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 06dc: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06e0: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06e4: mov $3cd2, -(sp)
+    {
+        src = uint16_t(0x3cd2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06e8: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x06ec);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L06ec:
+    AOT_BLOCK(0x06ec, 4);
+    // 06ec: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 06ee: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 06f0: mov 3cec, -(sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06f4: jsr pc, *$1ddc
+    {
+        a = 0x1ddc;
+        r[6] -= 2;
+        WR16(r[6], 0x06f8);
+    }
+    AOT_GOTO(0x1ddc, L1ddc);
+L06f8:
+    AOT_BLOCK(0x06f8, 3);
+    // 06f8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 06fa: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06fe: jsr pc, *$1e12
+    {
+        a = 0x1e12;
+        r[6] -= 2;
+        WR16(r[6], 0x0702);
+    }
+    AOT_GOTO(0x1e12, L1e12);
+L0702:
+    AOT_BLOCK(0x0702, 2);
+    // 0702: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0706: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x070a, L070a);
+L0708:
+    // 0708: rtt
+    AOT_INTERP(0x0708);
+L070a:
+    AOT_BLOCK(0x070a, 2);
+    // 070a: mov $3cda, -(sp)
+    {
+        src = uint16_t(0x3cda);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 070e: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0712);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L0712:
+    AOT_BLOCK(0x0712, 4);
+    // 0712: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0714: mov 3cec, (sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0718: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 071c: jsr pc, *$1e12
+    {
+        a = 0x1e12;
+        r[6] -= 2;
+        WR16(r[6], 0x0720);
+    }
+    AOT_GOTO(0x1e12, L1e12);
+L0720:
+    AOT_BLOCK(0x0720, 2);
+    // 0720: mov -12(r5), r0
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0724: jmp *$0dae
+    {
+        a = 0x0dae;
+    }
+    AOT_GOTO(0x0dae, L0dae);
+L0728:
+    AOT_BLOCK(0x0728, 2);
+    // 0728: cmp $5a, -8(r5)
+    {
+        src = uint16_t(0x005a);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 072e: bne 07ec
+    if (!Z)
+        AOT_GOTO(0x07ec, L07ec);
+    AOT_GOTO(0x0730, L0730);
+L0730:
+    AOT_BLOCK(0x0730, 2);
+    // 0730: cmp $564e, 6(r5)
+    {
+        src = uint16_t(0x564e);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0736: bne 0740
+    if (!Z)
+        AOT_GOTO(0x0740, L0740);
+    AOT_GOTO(0x0738, L0738);
+L0738:
+    AOT_BLOCK(0x0738, 2);
+    // 0738: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 073c: jmp *$0dae
+    {
+        a = 0x0dae;
+    }
+    AOT_GOTO(0x0dae, L0dae);
+L0740:
+    AOT_BLOCK(0x0740, 8);
+    // 0740: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0744: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0746: mov 3cec, r0
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 074a: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 074e: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0750: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0754: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0758: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x075c);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L075c:
+    AOT_BLOCK(0x075c, 6);
+    // 075c: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0760: mov 59f2, -18(r5)
+    {
+        a = 0x59f2;
+        src = RD16(a);
+        b = uint16_t(r[5] + -24);
+        WR16(b, src);
+    }
+    // 0766: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 076a: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 076e: mov 6(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0772: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0776);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L0776:
+    AOT_BLOCK(0x0776, 9);
+    // 0776: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0778: mov r0, -16(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -22);
+        WR16(b, src);
+    }
+    // 077c: mov -18(r5), 59f2
+    {
+        a = uint16_t(r[5] + -24);
+        src = RD16(a);
+        b = 0x59f2;
+        WR16(b, src);
+    }
+    // 0782: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0784: mov 3cec, r0
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0788: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 078c: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 078e: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0792: jsr pc, *$1ddc
+    {
+        a = 0x1ddc;
+        r[6] -= 2;
+        WR16(r[6], 0x0796);
+    }
+    AOT_GOTO(0x1ddc, L1ddc);
+L0796:
+    AOT_BLOCK(0x0796, 3);
+    // 0796: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0798: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 079c: jsr pc, *$1e12
+    {
+        a = 0x1e12;
+        r[6] -= 2;
+        WR16(r[6], 0x07a0);
+    }
+    AOT_GOTO(0x1e12, L1e12);
+L07a0:
+    AOT_BLOCK(0x07a0, 4);
+    // 07a0: mov -16(r5), (sp)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07a4: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07a8: mov 8(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07ac: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x07b0);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L07b0:
+    AOT_BLOCK(0x07b0, 4);
+    // 07b0: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 07b2: mov r0, -12(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 07b6: cmp -12(r5), -16(r5)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = uint16_t(r[5] + -22);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07bc: beq 07dc
+    if (Z)
+        AOT_GOTO(0x07dc, L07dc);
+    AOT_GOTO(0x07be, L07be);
+L07be:
+    AOT_BLOCK(0x07be, 4);
+    // 07be: mov -16(r5), (sp)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07c2: mov -12(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07c6: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07c8: jsr pc, 164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x07cc);
+    }
+    AOT_GOTO(0x164e, L164e);
+L07cc:
+    AOT_BLOCK(0x07cc, 4);
+    // 07cc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 07ce: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07d0: mov $3f24, -(sp)
+    {
+        src = uint16_t(0x3f24);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07d4: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x07d8);
+    }
+    AOT_GOTO(0x396a, L396a);
+L07d8:
+    AOT_BLOCK(0x07d8, 1);
+    // 07d8: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x07dc, L07dc);
+L07dc:
+    AOT_BLOCK(0x07dc, 2);
+    // 07dc: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07e0: jsr pc, *$1e12
+    {
+        a = 0x1e12;
+        r[6] -= 2;
+        WR16(r[6], 0x07e4);
+    }
+    AOT_GOTO(0x1e12, L1e12);
+L07e4:
+    AOT_BLOCK(0x07e4, 2);
+    // 07e4: mov -16(r5), r0
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07e8: jmp *$0dae
+    {
+        a = 0x0dae;
+    }
+    AOT_GOTO(0x0dae, L0dae);
+L07ec:
+    AOT_BLOCK(0x07ec, 3);
+    // 07ec: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07f0: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07f2: jsr pc, *$168a
+    {
+        a = 0x168a;
+        r[6] -= 2;
+        WR16(r[6], 0x07f6);
+    }
+    AOT_GOTO(0x168a, L168a);
+L07f6:
+    AOT_BLOCK(0x07f6, 7);
+    // 07f6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 07f8: mov r0, -12(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 07fc: mov -12(r5), r0
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0800: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 0802: mov r0, -14(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+    }
+    // 0806: cmp $6, 2(r2)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[2] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 080c: bne 0818
+    if (!Z)
+        AOT_GOTO(0x0818, L0818);
+    AOT_GOTO(0x080e, L080e);
+L080e:
+    AOT_BLOCK(0x080e, 2);
+    // 080e: cmp $3a, (r2)
+    {
+        src = uint16_t(0x003a);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0812: beq 0818
+    if (Z)
+        AOT_GOTO(0x0818, L0818);
+    AOT_GOTO(0x0814, L0814);
+L0814:
+    AOT_BLOCK(0x0814, 1);
+    // 0814: inc -14(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0818, L0818);
+L0818:
+    AOT_BLOCK(0x0818, 4);
+    // 0818: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 081c: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0820: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0822: jsr pc, *$1158
+    {
+        a = 0x1158;
+        r[6] -= 2;
+        WR16(r[6], 0x0826);
+    }
+    AOT_GOTO(0x1158, L1158);
+L0826:
+    AOT_BLOCK(0x0826, 3);
+    // 0826: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0828: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 082c: blt 0836
+    if (N ^ V)
+        AOT_GOTO(0x0836, L0836);
+    AOT_GOTO(0x082e, L082e);
+L082e:
+    AOT_BLOCK(0x082e, 2);
+    // 082e: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0832: jmp *$0dae
+    {
+        a = 0x0dae;
+    }
+    AOT_GOTO(0x0dae, L0dae);
+L0836:
+    AOT_BLOCK(0x0836, 2);
+    // 0836: cmp $28, (r2)
+    {
+        src = uint16_t(0x0028);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 083a: beq 0842
+    if (Z)
+        AOT_GOTO(0x0842, L0842);
+    AOT_GOTO(0x083c, L083c);
+L083c:
+    AOT_BLOCK(0x083c, 2);
+    // 083c: cmp $46, (r2)
+    {
+        src = uint16_t(0x0046);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0840: bne 085c
+    if (!Z)
+        AOT_GOTO(0x085c, L085c);
+    AOT_GOTO(0x0842, L0842);
+L0842:
+    AOT_BLOCK(0x0842, 3);
+    // 0842: mov 8(r2), r3
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0846: cmp $15, (r3)
+    {
+        src = uint16_t(0x0015);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 084a: bne 085c
+    if (!Z)
+        AOT_GOTO(0x085c, L085c);
+    AOT_GOTO(0x084c, L084c);
+L084c:
+    AOT_BLOCK(0x084c, 2);
+    // 084c: cmp $ffff, 6(r3)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[3] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0852: bne 085c
+    if (!Z)
+        AOT_GOTO(0x085c, L085c);
+    AOT_GOTO(0x0854, L0854);
+L0854:
+    AOT_BLOCK(0x0854, 2);
+    // 0854: mov $1, 6(r3)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 085a: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x085c, L085c);
+L085c:
+    AOT_BLOCK(0x085c, 2);
+    // 085c: cmp 5de2, 6(r5)
+    {
+        a = 0x5de2;
+        src = RD16(a);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0862: bne 086a
+    if (!Z)
+        AOT_GOTO(0x086a, L086a);
+    AOT_GOTO(0x0864, L0864);
+L0864:
+    AOT_BLOCK(0x0864, 1);
+    // 0864: mov $4a5e, 6(r5)
+    {
+        src = uint16_t(0x4a5e);
+        b = uint16_t(r[5] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x086a, L086a);
+L086a:
+    AOT_BLOCK(0x086a, 2);
+    // 086a: cmp $564e, 6(r5)
+    {
+        src = uint16_t(0x564e);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0870: bne 089c
+    if (!Z)
+        AOT_GOTO(0x089c, L089c);
+    AOT_GOTO(0x0872, L0872);
+L0872:
+    AOT_BLOCK(0x0872, 2);
+    // 0872: cmp $20, -8(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0878: beq 089c
+    if (Z)
+        AOT_GOTO(0x089c, L089c);
+    AOT_GOTO(0x087a, L087a);
+L087a:
+    AOT_BLOCK(0x087a, 2);
+    // 087a: cmp $21, -8(r5)
+    {
+        src = uint16_t(0x0021);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0880: beq 089c
+    if (Z)
+        AOT_GOTO(0x089c, L089c);
+    AOT_GOTO(0x0882, L0882);
+L0882:
+    AOT_BLOCK(0x0882, 5);
+    // 0882: mov 3cea, (sp)
+    {
+        a = 0x3cea;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0886: sub -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 088a: mov $5300, -(sp)
+    {
+        src = uint16_t(0x5300);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 088e: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0890: jsr pc, *$00fa
+    {
+        a = 0x00fa;
+        r[6] -= 2;
+        WR16(r[6], 0x0894);
+    }
+    AOT_GOTO(0x00fa, L00fa);
+L0894:
+    AOT_BLOCK(0x0894, 3);
+    // 0894: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0896: mov r0, -1c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -28);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 089a: bne 08be
+    if (!Z)
+        AOT_GOTO(0x08be, L08be);
+    AOT_GOTO(0x089c, L089c);
+L089c:
+    AOT_BLOCK(0x089c, 5);
+    // 089c: mov 3cea, (sp)
+    {
+        a = 0x3cea;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08a0: sub -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 08a4: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08a8: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08aa: jsr pc, *$00fa
+    {
+        a = 0x00fa;
+        r[6] -= 2;
+        WR16(r[6], 0x08ae);
+    }
+    AOT_GOTO(0x00fa, L00fa);
+L08ae:
+    AOT_BLOCK(0x08ae, 3);
+    // 08ae: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 08b0: mov r0, -1c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -28);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08b4: bne 08be
+    if (!Z)
+        AOT_GOTO(0x08be, L08be);
+    AOT_GOTO(0x08b6, L08b6);
+L08b6:
+    AOT_BLOCK(0x08b6, 2);
+    // 08b6: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08ba: jmp *$0dae
+    {
+        a = 0x0dae;
+    }
+    AOT_GOTO(0x0dae, L0dae);
+L08be:
+    AOT_BLOCK(0x08be, 8);
+    // 08be: mov -1c(r5), r0
+    {
+        a = uint16_t(r[5] + -28);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 08c2: mov 4(r0), -10(r5)
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+    }
+    // 08c8: mov 6(r2), r3
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 08cc: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+    }
+    // 08d0: mov (r2), r0
+    {
+        a = r[2];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 08d2: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 08d4: bit $1, 4568(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 08da: beq 08e2
+    if (Z)
+        AOT_GOTO(0x08e2, L08e2);
+    AOT_GOTO(0x08dc, L08dc);
+L08dc:
+    AOT_BLOCK(0x08dc, 1);
+    // 08dc: mov 8(r2), -e(r5)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x08e2, L08e2);
+L08e2:
+    AOT_BLOCK(0x08e2, 5);
+    // 08e2: movb *-10(r5), r0
+    {
+        a = RD16(r[5] + -16);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 08e6: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 08ea: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 08ee: bit $80, r0
+    {
+        src = uint16_t(0x0080);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 08f2: beq 0902
+    if (Z)
+        AOT_GOTO(0x0902, L0902);
+    AOT_GOTO(0x08f4, L08f4);
+L08f4:
+    AOT_BLOCK(0x08f4, 3);
+    // 08f4: bic $ff80, -8(r5)
+    {
+        src = uint16_t(0xff80);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 08fa: mov $9, (sp)
+    {
+        src = uint16_t(0x0009);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08fe: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0902);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L0902:
+    AOT_BLOCK(0x0902, 2);
+    // 0902: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0906: jmp *$0d88
+    {
+        a = 0x0d88;
+    }
+    AOT_GOTO(0x0d88, L0d88);
+L090a:
+    AOT_BLOCK(0x090a, 2);
+    // 090a: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 090c: jsr pc, *$164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x0910);
+    }
+    AOT_GOTO(0x164e, L164e);
+L0910:
+    AOT_BLOCK(0x0910, 2);
+    // 0910: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0912: bne 0924
+    if (!Z)
+        AOT_GOTO(0x0924, L0924);
+    AOT_GOTO(0x0914, L0914);
+L0914:
+    AOT_BLOCK(0x0914, 2);
+    // 0914: cmp $2b, (r2)
+    {
+        src = uint16_t(0x002b);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0918: beq 0920
+    if (Z)
+        AOT_GOTO(0x0920, L0920);
+    AOT_GOTO(0x091a, L091a);
+L091a:
+    AOT_BLOCK(0x091a, 2);
+    // 091a: cmp $49, (r2)
+    {
+        src = uint16_t(0x0049);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 091e: bne 0924
+    if (!Z)
+        AOT_GOTO(0x0924, L0924);
+    AOT_GOTO(0x0920, L0920);
+L0920:
+    AOT_BLOCK(0x0920, 1);
+    // 0920: dec -12(r5)
+    {
+        a = uint16_t(r[5] + -18);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0924, L0924);
+L0924:
+    AOT_BLOCK(0x0924, 2);
+    // 0924: mov -12(r5), r0
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0928: jmp *$0dae
+    {
+        a = 0x0dae;
+    }
+    AOT_GOTO(0x0dae, L0dae);
+L092c:
+    AOT_BLOCK(0x092c, 2);
+    // 092c: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 092e: br 0936
+    AOT_GOTO(0x0936, L0936);
+L0930:
+    AOT_BLOCK(0x0930, 2);
+    // 0930: mov -e(r5), r4
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0934: br 0936
+    AOT_GOTO(0x0936, L0936);
+L0936:
+    AOT_BLOCK(0x0936, 3);
+    // 0936: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+    }
+    // 093a: cmpb $27, *-10(r5)
+    {
+        src = uint8_t(0x27);
+        b = RD16(r[5] + -16);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0940: bne 094e
+    if (!Z)
+        AOT_GOTO(0x094e, L094e);
+    AOT_GOTO(0x0942, L0942);
+L0942:
+    AOT_BLOCK(0x0942, 3);
+    // 0942: mov $1, -8(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0948: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 094c: br 0960
+    AOT_GOTO(0x0960, L0960);
+L094e:
+    AOT_BLOCK(0x094e, 2);
+    // 094e: cmpb $2b, *-10(r5)
+    {
+        src = uint8_t(0x2b);
+        b = RD16(r[5] + -16);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0954: bne 0960
+    if (!Z)
+        AOT_GOTO(0x0960, L0960);
+    AOT_GOTO(0x0956, L0956);
+L0956:
+    AOT_BLOCK(0x0956, 2);
+    // 0956: mov $2, -8(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 095c: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0960, L0960);
+L0960:
+    AOT_BLOCK(0x0960, 3);
+    // 0960: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0964: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0966: jsr pc, *$12a0
+    {
+        a = 0x12a0;
+        r[6] -= 2;
+        WR16(r[6], 0x096a);
+    }
+    AOT_GOTO(0x12a0, L12a0);
+L096a:
+    AOT_BLOCK(0x096a, 1);
+    // 096a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x096c, L096c);
+L096c:
+    AOT_BLOCK(0x096c, 1);
+    // 096c: br 08e2
+    AOT_GOTO(0x08e2, L08e2);
+L096e:
+    AOT_BLOCK(0x096e, 1);
+    // 096e: movb *-10(r5), r0
+    {
+        a = RD16(r[5] + -16);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0972, L0972);
+L0972:
+    AOT_BLOCK(0x0972, 1);
+    // 0972: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0976, L0976);
+L0976:
+    AOT_BLOCK(0x0976, 2);
+    // 0976: cmp $27, r0
+    {
+        src = uint16_t(0x0027);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 097a: bne 0982
+    if (!Z)
+        AOT_GOTO(0x0982, L0982);
+    AOT_GOTO(0x097c, L097c);
+L097c:
+    AOT_BLOCK(0x097c, 2);
+    // 097c: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0980: br 0986
+    AOT_GOTO(0x0986, L0986);
+L0982:
+    AOT_BLOCK(0x0982, 1);
+    // 0982: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0986, L0986);
+L0986:
+    AOT_BLOCK(0x0986, 4);
+    // 0986: mov $48b6, (sp)
+    {
+        src = uint16_t(0x48b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 098a: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 098e: mov (r2), -(sp)
+    {
+        a = r[2];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0990: jsr pc, *$15ca
+    {
+        a = 0x15ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0994);
+    }
+    AOT_GOTO(0x15ca, L15ca);
+L0994:
+    AOT_BLOCK(0x0994, 2);
+    // 0994: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0996: br 08e2
+    AOT_GOTO(0x08e2, L08e2);
+L0998:
+    AOT_BLOCK(0x0998, 2);
+    // 0998: bit $100, -1a(r5)
+    {
+        src = uint16_t(0x0100);
+        b = uint16_t(r[5] + -26);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 099e: beq 09a4
+    if (Z)
+        AOT_GOTO(0x09a4, L09a4);
+    AOT_GOTO(0x09a0, L09a0);
+L09a0:
+    AOT_BLOCK(0x09a0, 2);
+    // 09a0: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09a2: br 09a6
+    AOT_GOTO(0x09a6, L09a6);
+L09a4:
+    AOT_BLOCK(0x09a4, 1);
+    // 09a4: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x09a6, L09a6);
+L09a6:
+    AOT_BLOCK(0x09a6, 1);
+    // 09a6: br 09b0
+    AOT_GOTO(0x09b0, L09b0);
+L09a8:
+    AOT_BLOCK(0x09a8, 2);
+    // 09a8: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09aa: br 09c0
+    AOT_GOTO(0x09c0, L09c0);
+L09ac:
+    AOT_BLOCK(0x09ac, 1);
+    // 09ac: mov -e(r5), r4
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x09b0, L09b0);
+L09b0:
+    AOT_BLOCK(0x09b0, 2);
+    // 09b0: cmp $1, 2(r4)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09b6: bne 09c0
+    if (!Z)
+        AOT_GOTO(0x09c0, L09c0);
+    AOT_GOTO(0x09b8, L09b8);
+L09b8:
+    AOT_BLOCK(0x09b8, 2);
+    // 09b8: mov $62, (sp)
+    {
+        src = uint16_t(0x0062);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09bc: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x09c0);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L09c0:
+    AOT_BLOCK(0x09c0, 2);
+    // 09c0: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09c2: jsr pc, *$164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x09c6);
+    }
+    AOT_GOTO(0x164e, L164e);
+L09c6:
+    AOT_BLOCK(0x09c6, 2);
+    // 09c6: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09c8: beq 09d2
+    if (Z)
+        AOT_GOTO(0x09d2, L09d2);
+    AOT_GOTO(0x09ca, L09ca);
+L09ca:
+    AOT_BLOCK(0x09ca, 2);
+    // 09ca: mov $66, (sp)
+    {
+        src = uint16_t(0x0066);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09ce: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x09d2);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L09d2:
+    AOT_BLOCK(0x09d2, 1);
+    // 09d2: br 08e2
+    AOT_GOTO(0x08e2, L08e2);
+L09d4:
+    AOT_BLOCK(0x09d4, 2);
+    // 09d4: cmp $1, 2(r3)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09da: beq 09e8
+    if (Z)
+        AOT_GOTO(0x09e8, L09e8);
+    AOT_GOTO(0x09dc, L09dc);
+L09dc:
+    AOT_BLOCK(0x09dc, 3);
+    // 09dc: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 09e0: cmp $1, 2(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09e6: bne 09f0
+    if (!Z)
+        AOT_GOTO(0x09f0, L09f0);
+    AOT_GOTO(0x09e8, L09e8);
+L09e8:
+    AOT_BLOCK(0x09e8, 2);
+    // 09e8: mov $62, (sp)
+    {
+        src = uint16_t(0x0062);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09ec: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x09f0);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L09f0:
+    AOT_BLOCK(0x09f0, 2);
+    // 09f0: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09f2: br 09c0
+    AOT_GOTO(0x09c0, L09c0);
+L09f4:
+    AOT_BLOCK(0x09f4, 3);
+    // 09f4: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+    }
+    // 09f6: mov $1, -18(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -24);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09fc: br 0a12
+    AOT_GOTO(0x0a12, L0a12);
+L09fe:
+    AOT_BLOCK(0x09fe, 3);
+    // 09fe: mov -e(r5), r4
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0a02: mov $2, -18(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -24);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a08: br 0a12
+    AOT_GOTO(0x0a12, L0a12);
+L0a0a:
+    AOT_BLOCK(0x0a0a, 2);
+    // 0a0a: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+    }
+    // 0a0c: mov $4, -18(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -24);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a12, L0a12);
+L0a12:
+    AOT_BLOCK(0x0a12, 6);
+    // 0a12: mov $4a5e, -c(r5)
+    {
+        src = uint16_t(0x4a5e);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0a18: movb *-10(r5), r0
+    {
+        a = RD16(r[5] + -16);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0a1c: add $ffbf, r0
+    {
+        src = uint16_t(0xffbf);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0a20: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0a24: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0a28: cmpb $21, *-10(r5)
+    {
+        src = uint8_t(0x21);
+        b = RD16(r[5] + -16);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    AOT_GOTO(0x0a2e, L0a2e);
+L0a2e:
+    AOT_BLOCK(0x0a2e, 1);
+    // 0a2e: bne 0a3a
+    if (!Z)
+        AOT_GOTO(0x0a3a, L0a3a);
+    AOT_GOTO(0x0a30, L0a30);
+L0a30:
+    AOT_BLOCK(0x0a30, 2);
+    // 0a30: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0a34: bis $10, -8(r5)
+    {
+        src = uint16_t(0x0010);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a3a, L0a3a);
+L0a3a:
+    AOT_BLOCK(0x0a3a, 2);
+    // 0a3a: bit $2, -8(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0a40: beq 0a48
+    if (Z)
+        AOT_GOTO(0x0a48, L0a48);
+    AOT_GOTO(0x0a42, L0a42);
+L0a42:
+    AOT_BLOCK(0x0a42, 1);
+    // 0a42: mov $56e2, -c(r5)
+    {
+        src = uint16_t(0x56e2);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a48, L0a48);
+L0a48:
+    AOT_BLOCK(0x0a48, 2);
+    // 0a48: bit $4, -8(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0a4e: beq 0a56
+    if (Z)
+        AOT_GOTO(0x0a56, L0a56);
+    AOT_GOTO(0x0a50, L0a50);
+L0a50:
+    AOT_BLOCK(0x0a50, 1);
+    // 0a50: mov $564e, -c(r5)
+    {
+        src = uint16_t(0x564e);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a56, L0a56);
+L0a56:
+    AOT_BLOCK(0x0a56, 2);
+    // 0a56: bit $1, -18(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -24);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0a5c: beq 0a8c
+    if (Z)
+        AOT_GOTO(0x0a8c, L0a8c);
+    AOT_GOTO(0x0a5e, L0a5e);
+L0a5e:
+    AOT_BLOCK(0x0a5e, 1);
+    // 0a5e: cmp $4a5e, -c(r5)
+    {
+        src = uint16_t(0x4a5e);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0a64, L0a64);
+L0a64:
+    AOT_BLOCK(0x0a64, 1);
+    // 0a64: bne 0a8c
+    if (!Z)
+        AOT_GOTO(0x0a8c, L0a8c);
+    AOT_GOTO(0x0a66, L0a66);
+L0a66:
+    AOT_BLOCK(0x0a66, 2);
+    // 0a66: bit $1, -8(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0a6c: bne 0a8c
+    if (!Z)
+        AOT_GOTO(0x0a8c, L0a8c);
+    AOT_GOTO(0x0a6e, L0a6e);
+L0a6e:
+    AOT_BLOCK(0x0a6e, 2);
+    // 0a6e: cmp $2b, (r2)
+    {
+        src = uint16_t(0x002b);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a72: beq 0a86
+    if (Z)
+        AOT_GOTO(0x0a86, L0a86);
+    AOT_GOTO(0x0a74, L0a74);
+L0a74:
+    AOT_BLOCK(0x0a74, 2);
+    // 0a74: cmp $2c, (r2)
+    {
+        src = uint16_t(0x002c);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a78: beq 0a86
+    if (Z)
+        AOT_GOTO(0x0a86, L0a86);
+    AOT_GOTO(0x0a7a, L0a7a);
+L0a7a:
+    AOT_BLOCK(0x0a7a, 2);
+    // 0a7a: cmp $49, (r2)
+    {
+        src = uint16_t(0x0049);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a7e: beq 0a86
+    if (Z)
+        AOT_GOTO(0x0a86, L0a86);
+    AOT_GOTO(0x0a80, L0a80);
+L0a80:
+    AOT_BLOCK(0x0a80, 2);
+    // 0a80: cmp $4a, (r2)
+    {
+        src = uint16_t(0x004a);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a84: bne 0a8c
+    if (!Z)
+        AOT_GOTO(0x0a8c, L0a8c);
+    AOT_GOTO(0x0a86, L0a86);
+L0a86:
+    AOT_BLOCK(0x0a86, 1);
+    // 0a86: mov 5de2, -c(r5)
+    {
+        a = 0x5de2;
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a8c, L0a8c);
+L0a8c:
+    AOT_BLOCK(0x0a8c, 2);
+    // 0a8c: bit $1, -8(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0a92: beq 0ab8
+    if (Z)
+        AOT_GOTO(0x0ab8, L0ab8);
+    AOT_GOTO(0x0a94, L0a94);
+L0a94:
+    AOT_BLOCK(0x0a94, 3);
+    // 0a94: mov 6(r4), r4
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0a98: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a9a: jsr pc, *$1618
+    {
+        a = 0x1618;
+        r[6] -= 2;
+        WR16(r[6], 0x0a9e);
+    }
+    AOT_GOTO(0x1618, L1618);
+L0a9e:
+    AOT_BLOCK(0x0a9e, 2);
+    // 0a9e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0aa0: beq 0ab8
+    if (Z)
+        AOT_GOTO(0x0ab8, L0ab8);
+    AOT_GOTO(0x0aa2, L0aa2);
+L0aa2:
+    AOT_BLOCK(0x0aa2, 2);
+    // 0aa2: cmp $56e2, -c(r5)
+    {
+        src = uint16_t(0x56e2);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0aa8: beq 0ab8
+    if (Z)
+        AOT_GOTO(0x0ab8, L0ab8);
+    AOT_GOTO(0x0aaa, L0aaa);
+L0aaa:
+    AOT_BLOCK(0x0aaa, 2);
+    // 0aaa: cmp $24, (r4)
+    {
+        src = uint16_t(0x0024);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0aae: bne 0ab4
+    if (!Z)
+        AOT_GOTO(0x0ab4, L0ab4);
+    AOT_GOTO(0x0ab0, L0ab0);
+L0ab0:
+    AOT_BLOCK(0x0ab0, 1);
+    // 0ab0: mov 6(r4), r4
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ab4, L0ab4);
+L0ab4:
+    AOT_BLOCK(0x0ab4, 1);
+    // 0ab4: mov 6(r4), r4
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ab8, L0ab8);
+L0ab8:
+    AOT_BLOCK(0x0ab8, 2);
+    // 0ab8: cmp $59ee, 6(r5)
+    {
+        src = uint16_t(0x59ee);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0abe: bne 0ace
+    if (!Z)
+        AOT_GOTO(0x0ace, L0ace);
+    AOT_GOTO(0x0ac0, L0ac0);
+L0ac0:
+    AOT_BLOCK(0x0ac0, 2);
+    // 0ac0: cmp $56e2, -c(r5)
+    {
+        src = uint16_t(0x56e2);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ac6: bne 0ace
+    if (!Z)
+        AOT_GOTO(0x0ace, L0ace);
+    AOT_GOTO(0x0ac8, L0ac8);
+L0ac8:
+    AOT_BLOCK(0x0ac8, 1);
+    // 0ac8: mov $59ee, -c(r5)
+    {
+        src = uint16_t(0x59ee);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ace, L0ace);
+L0ace:
+    AOT_BLOCK(0x0ace, 2);
+    // 0ace: bit $8, -8(r5)
+    {
+        src = uint16_t(0x0008);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0ad4: beq 0ade
+    if (Z)
+        AOT_GOTO(0x0ade, L0ade);
+    AOT_GOTO(0x0ad6, L0ad6);
+L0ad6:
+    AOT_BLOCK(0x0ad6, 2);
+    // 0ad6: mov -14(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0adc: br 0b00
+    AOT_GOTO(0x0b00, L0b00);
+L0ade:
+    AOT_BLOCK(0x0ade, 4);
+    // 0ade: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0ae0: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0ae2: bit $100, 4568(r0)
+    {
+        src = uint16_t(0x0100);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0ae8: bne 0af2
+    if (!Z)
+        AOT_GOTO(0x0af2, L0af2);
+    AOT_GOTO(0x0aea, L0aea);
+L0aea:
+    AOT_BLOCK(0x0aea, 2);
+    // 0aea: cmp $2, 4(r4)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[4] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0af0: ble 0afa
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0afa, L0afa);
+    AOT_GOTO(0x0af2, L0af2);
+L0af2:
+    AOT_BLOCK(0x0af2, 2);
+    // 0af2: mov -12(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0af8: br 0b00
+    AOT_GOTO(0x0b00, L0b00);
+L0afa:
+    AOT_BLOCK(0x0afa, 1);
+    // 0afa: mov 8(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L0b00:
+    AOT_BLOCK(0x0b00, 4);
+    // 0b00: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b04: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b08: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b0a: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0b0e);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L0b0e:
+    AOT_BLOCK(0x0b0e, 4);
+    // 0b0e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0b10: mov r0, -16(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -22);
+        WR16(b, src);
+    }
+    // 0b14: cmp $4a5e, -c(r5)
+    {
+        src = uint16_t(0x4a5e);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b1a: beq 0b28
+    if (Z)
+        AOT_GOTO(0x0b28, L0b28);
+    AOT_GOTO(0x0b1c, L0b1c);
+L0b1c:
+    AOT_BLOCK(0x0b1c, 2);
+    // 0b1c: cmp 5de2, -c(r5)
+    {
+        a = 0x5de2;
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b22: beq 0b28
+    if (Z)
+        AOT_GOTO(0x0b28, L0b28);
+    AOT_GOTO(0x0b24, L0b24);
+L0b24:
+    AOT_BLOCK(0x0b24, 1);
+    // 0b24: jmp *$08e2
+    {
+        a = 0x08e2;
+    }
+    AOT_GOTO(0x08e2, L08e2);
+L0b28:
+    AOT_BLOCK(0x0b28, 2);
+    // 0b28: bit $8, -8(r5)
+    {
+        src = uint16_t(0x0008);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b2e: beq 0b68
+    if (Z)
+        AOT_GOTO(0x0b68, L0b68);
+    AOT_GOTO(0x0b30, L0b30);
+L0b30:
+    AOT_BLOCK(0x0b30, 2);
+    // 0b30: bit $10, -8(r5)
+    {
+        src = uint16_t(0x0010);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b36: beq 0b60
+    if (Z)
+        AOT_GOTO(0x0b60, L0b60);
+    AOT_GOTO(0x0b38, L0b38);
+L0b38:
+    AOT_BLOCK(0x0b38, 2);
+    // 0b38: cmp -14(r5), -16(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        b = uint16_t(r[5] + -22);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b3e: beq 0b60
+    if (Z)
+        AOT_GOTO(0x0b60, L0b60);
+    AOT_GOTO(0x0b40, L0b40);
+L0b40:
+    AOT_BLOCK(0x0b40, 4);
+    // 0b40: mov -14(r5), (sp)
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b44: mov -16(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b48: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b4a: jsr pc, 164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x0b4e);
+    }
+    AOT_GOTO(0x164e, L164e);
+L0b4e:
+    AOT_BLOCK(0x0b4e, 4);
+    // 0b4e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0b50: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b52: mov $3f33, -(sp)
+    {
+        src = uint16_t(0x3f33);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b56: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x0b5a);
+    }
+    AOT_GOTO(0x396a, L396a);
+L0b5a:
+    AOT_BLOCK(0x0b5a, 2);
+    // 0b5a: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0b5e: br 0b66
+    AOT_GOTO(0x0b66, L0b66);
+L0b60:
+    AOT_BLOCK(0x0b60, 1);
+    // 0b60: mov -16(r5), -14(r5)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b66, L0b66);
+L0b66:
+    AOT_BLOCK(0x0b66, 1);
+    // 0b66: br 0c10
+    AOT_GOTO(0x0c10, L0c10);
+L0b68:
+    AOT_BLOCK(0x0b68, 2);
+    // 0b68: cmp -12(r5), -16(r5)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = uint16_t(r[5] + -22);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b6e: beq 0c10
+    if (Z)
+        AOT_GOTO(0x0c10, L0c10);
+    AOT_GOTO(0x0b70, L0b70);
+L0b70:
+    AOT_BLOCK(0x0b70, 2);
+    // 0b70: bit $10, -8(r5)
+    {
+        src = uint16_t(0x0010);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b76: bne 0bf2
+    if (!Z)
+        AOT_GOTO(0x0bf2, L0bf2);
+    AOT_GOTO(0x0b78, L0b78);
+L0b78:
+    AOT_BLOCK(0x0b78, 3);
+    // 0b78: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0b7a: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b7c: jsr pc, *$168a
+    {
+        a = 0x168a;
+        r[6] -= 2;
+        WR16(r[6], 0x0b80);
+    }
+    AOT_GOTO(0x168a, L168a);
+L0b80:
+    AOT_BLOCK(0x0b80, 3);
+    // 0b80: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0b82: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b84: bne 0bf2
+    if (!Z)
+        AOT_GOTO(0x0bf2, L0bf2);
+    AOT_GOTO(0x0b86, L0b86);
+L0b86:
+    AOT_BLOCK(0x0b86, 2);
+    // 0b86: bit $4, -18(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -24);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b8c: bne 0be0
+    if (!Z)
+        AOT_GOTO(0x0be0, L0be0);
+    AOT_GOTO(0x0b8e, L0b8e);
+L0b8e:
+    AOT_BLOCK(0x0b8e, 2);
+    // 0b8e: bit $1, -18(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -24);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b94: beq 0bba
+    if (Z)
+        AOT_GOTO(0x0bba, L0bba);
+    AOT_GOTO(0x0b96, L0b96);
+L0b96:
+    AOT_BLOCK(0x0b96, 5);
+    // 0b96: mov 3cea, (sp)
+    {
+        a = 0x3cea;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b9a: sub -16(r5), (sp)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 0b9e: dec (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0ba0: mov -e(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ba4: jsr pc, *$1436
+    {
+        a = 0x1436;
+        r[6] -= 2;
+        WR16(r[6], 0x0ba8);
+    }
+    AOT_GOTO(0x1436, L1436);
+L0ba8:
+    AOT_BLOCK(0x0ba8, 6);
+    // 0ba8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0baa: mov -1c(r5), r1
+    {
+        a = uint16_t(r[5] + -28);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0bae: movb 2(r1), r1
+    {
+        a = uint16_t(r[1] + 2);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 0bb2: bic $ffc0, r1
+    {
+        src = uint16_t(0xffc0);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 0bb6: cmp r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bb8: bge 0be0
+    if (!(N ^ V))
+        AOT_GOTO(0x0be0, L0be0);
+    AOT_GOTO(0x0bba, L0bba);
+L0bba:
+    AOT_BLOCK(0x0bba, 2);
+    // 0bba: bit $2, -18(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -24);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0bc0: beq 0bf2
+    if (Z)
+        AOT_GOTO(0x0bf2, L0bf2);
+    AOT_GOTO(0x0bc2, L0bc2);
+L0bc2:
+    AOT_BLOCK(0x0bc2, 5);
+    // 0bc2: mov 3cea, (sp)
+    {
+        a = 0x3cea;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bc6: sub -16(r5), (sp)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 0bca: dec (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0bcc: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bce: jsr pc, *$1436
+    {
+        a = 0x1436;
+        r[6] -= 2;
+        WR16(r[6], 0x0bd2);
+    }
+    AOT_GOTO(0x1436, L1436);
+L0bd0:
+    AOT_BLOCK(0x0bd0, 5);
+    // 0bd0: mov (r0)+, bd6(sp)
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        b = uint16_t(r[6] + 3030);
+        WR16(b, src);
+    }
+    // 0bd4: movb *-1c(r5), r1
+    {
+        a = RD16(r[5] + -28);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 0bd8: bic $ffc0, r1
+    {
+        src = uint16_t(0xffc0);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 0bdc: cmp r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bde: blt 0bf2
+    if (N ^ V)
+        AOT_GOTO(0x0bf2, L0bf2);
+    AOT_GOTO(0x0be0, L0be0);
+L0bd2:
+    AOT_BLOCK(0x0bd2, 5);
+    // 0bd2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0bd4: movb *-1c(r5), r1
+    {
+        a = RD16(r[5] + -28);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 0bd8: bic $ffc0, r1
+    {
+        src = uint16_t(0xffc0);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 0bdc: cmp r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bde: blt 0bf2
+    if (N ^ V)
+        AOT_GOTO(0x0bf2, L0bf2);
+    AOT_GOTO(0x0be0, L0be0);
+L0be0:
+    AOT_BLOCK(0x0be0, 5);
+    // 0be0: mov -16(r5), -12(r5)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 0be6: mov -16(r5), r0
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0bea: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 0bec: mov r0, -14(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bf0: br 0c10
+    AOT_GOTO(0x0c10, L0c10);
+L0bf2:
+    AOT_BLOCK(0x0bf2, 4);
+    // 0bf2: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bf6: mov -16(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bfa: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bfc: jsr pc, 164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x0c00);
+    }
+    AOT_GOTO(0x164e, L164e);
+L0c00:
+    AOT_BLOCK(0x0c00, 4);
+    // 0c00: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0c02: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c04: mov $3f42, -(sp)
+    {
+        src = uint16_t(0x3f42);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c08: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x0c0c);
+    }
+    AOT_GOTO(0x396a, L396a);
+L0c0c:
+    AOT_BLOCK(0x0c0c, 1);
+    // 0c0c: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0c10, L0c10);
+L0c10:
+    AOT_BLOCK(0x0c10, 1);
+    // 0c10: jmp *$08e2
+    {
+        a = 0x08e2;
+    }
+    AOT_GOTO(0x08e2, L08e2);
+L0c14:
+    AOT_BLOCK(0x0c14, 3);
+    // 0c14: mov -12(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0c1a: cmpb $2d, *-10(r5)
+    {
+        src = uint8_t(0x2d);
+        b = RD16(r[5] + -16);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c20: bne 0c2a
+    if (!Z)
+        AOT_GOTO(0x0c2a, L0c2a);
+    AOT_GOTO(0x0c22, L0c22);
+L0c22:
+    AOT_BLOCK(0x0c22, 2);
+    // 0c22: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0c26: dec -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0c2a, L0c2a);
+L0c2a:
+    AOT_BLOCK(0x0c2a, 1);
+    // 0c2a: br 0c32
+    AOT_GOTO(0x0c32, L0c32);
+L0c2c:
+    AOT_BLOCK(0x0c2c, 1);
+    // 0c2c: mov -14(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c32, L0c32);
+L0c32:
+    AOT_BLOCK(0x0c32, 2);
+    // 0c32: cmpb $2b, *-10(r5)
+    {
+        src = uint8_t(0x2b);
+        b = RD16(r[5] + -16);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c38: bne 0c42
+    if (!Z)
+        AOT_GOTO(0x0c42, L0c42);
+    AOT_GOTO(0x0c3a, L0c3a);
+L0c3a:
+    AOT_BLOCK(0x0c3a, 2);
+    // 0c3a: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0c3e: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0c42, L0c42);
+L0c42:
+    AOT_BLOCK(0x0c42, 2);
+    // 0c42: cmp 3cea, -a(r5)
+    {
+        a = 0x3cea;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c48: bge 0c52
+    if (!(N ^ V))
+        AOT_GOTO(0x0c52, L0c52);
+    AOT_GOTO(0x0c4a, L0c4a);
+L0c4a:
+    AOT_BLOCK(0x0c4a, 2);
+    // 0c4a: mov $3f51, (sp)
+    {
+        src = uint16_t(0x3f51);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c4e: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x0c52);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L0c52:
+    AOT_BLOCK(0x0c52, 3);
+    // 0c52: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c56: mov $3f78, -(sp)
+    {
+        src = uint16_t(0x3f78);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c5a: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x0c5e);
+    }
+    AOT_GOTO(0x396a, L396a);
+L0c5e:
+    AOT_BLOCK(0x0c5e, 2);
+    // 0c5e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c60: jmp *$08e2
+    {
+        a = 0x08e2;
+    }
+    AOT_GOTO(0x08e2, L08e2);
+L0c64:
+    AOT_BLOCK(0x0c64, 2);
+    // 0c64: cmpb $28, *-10(r5)
+    {
+        src = uint8_t(0x28);
+        b = RD16(r[5] + -16);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c6a: bne 0c84
+    if (!Z)
+        AOT_GOTO(0x0c84, L0c84);
+    AOT_GOTO(0x0c6c, L0c6c);
+L0c6c:
+    AOT_BLOCK(0x0c6c, 3);
+    // 0c6c: inc 59f2
+    {
+        a = 0x59f2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0c70: cmp $59ee, 6(r5)
+    {
+        src = uint16_t(0x59ee);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c76: beq 0c80
+    if (Z)
+        AOT_GOTO(0x0c80, L0c80);
+    AOT_GOTO(0x0c78, L0c78);
+L0c78:
+    AOT_BLOCK(0x0c78, 2);
+    // 0c78: mov $2d, (sp)
+    {
+        src = uint16_t(0x002d);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c7c: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0c80);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L0c80:
+    AOT_BLOCK(0x0c80, 1);
+    // 0c80: jmp *$08e2
+    {
+        a = 0x08e2;
+    }
+    AOT_GOTO(0x08e2, L08e2);
+L0c84:
+    AOT_BLOCK(0x0c84, 1);
+    // 0c84: jmp *$0da2
+    {
+        a = 0x0da2;
+    }
+    AOT_GOTO(0x0da2, L0da2);
+L0c88:
+    AOT_BLOCK(0x0c88, 2);
+    // 0c88: mov $29, (sp)
+    {
+        src = uint16_t(0x0029);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c8c: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0c90);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L0c90:
+    AOT_BLOCK(0x0c90, 2);
+    // 0c90: cmpb $2b, *-10(r5)
+    {
+        src = uint8_t(0x2b);
+        b = RD16(r[5] + -16);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c96: bne 0c9c
+    if (!Z)
+        AOT_GOTO(0x0c9c, L0c9c);
+    AOT_GOTO(0x0c98, L0c98);
+L0c98:
+    AOT_BLOCK(0x0c98, 1);
+    // 0c98: dec 59f2
+    {
+        a = 0x59f2;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0c9c, L0c9c);
+L0c9c:
+    AOT_BLOCK(0x0c9c, 1);
+    // 0c9c: jmp *$08e2
+    {
+        a = 0x08e2;
+    }
+    AOT_GOTO(0x08e2, L08e2);
+L0ca0:
+    AOT_BLOCK(0x0ca0, 2);
+    // 0ca0: mov 6(r3), r4
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ca4: br 0cae
+    AOT_GOTO(0x0cae, L0cae);
+L0ca6:
+    AOT_BLOCK(0x0ca6, 2);
+    // 0ca6: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0caa: mov 6(r0), r4
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cae, L0cae);
+L0cae:
+    AOT_BLOCK(0x0cae, 2);
+    // 0cae: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cb0: jsr pc, *$1618
+    {
+        a = 0x1618;
+        r[6] -= 2;
+        WR16(r[6], 0x0cb4);
+    }
+    AOT_GOTO(0x1618, L1618);
+L0cb4:
+    AOT_BLOCK(0x0cb4, 2);
+    // 0cb4: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0cb6: beq 0cf6
+    if (Z)
+        AOT_GOTO(0x0cf6, L0cf6);
+    AOT_GOTO(0x0cb8, L0cb8);
+L0cb8:
+    AOT_BLOCK(0x0cb8, 2);
+    // 0cb8: cmp $24, (r4)
+    {
+        src = uint16_t(0x0024);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cbc: bne 0cca
+    if (!Z)
+        AOT_GOTO(0x0cca, L0cca);
+    AOT_GOTO(0x0cbe, L0cbe);
+L0cbe:
+    AOT_BLOCK(0x0cbe, 2);
+    // 0cbe: mov $3f7c, (sp)
+    {
+        src = uint16_t(0x3f7c);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cc2: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x0cc6);
+    }
+    AOT_GOTO(0x396a, L396a);
+L0cc6:
+    AOT_BLOCK(0x0cc6, 1);
+    // 0cc6: mov 6(r4), r4
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cca, L0cca);
+L0cca:
+    AOT_BLOCK(0x0cca, 3);
+    // 0cca: mov 8(r4), r4
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0cce: cmp $15, (r4)
+    {
+        src = uint16_t(0x0015);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cd2: bne 0ce4
+    if (!Z)
+        AOT_GOTO(0x0ce4, L0ce4);
+    AOT_GOTO(0x0cd4, L0cd4);
+L0cd4:
+    AOT_BLOCK(0x0cd4, 2);
+    // 0cd4: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0cd8: beq 0ce2
+    if (Z)
+        AOT_GOTO(0x0ce2, L0ce2);
+    AOT_GOTO(0x0cda, L0cda);
+L0cda:
+    AOT_BLOCK(0x0cda, 2);
+    // 0cda: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cde: jsr pc, *$1ec4
+    {
+        a = 0x1ec4;
+        r[6] -= 2;
+        WR16(r[6], 0x0ce2);
+    }
+    AOT_GOTO(0x1ec4, L1ec4);
+L0ce2:
+    AOT_BLOCK(0x0ce2, 1);
+    // 0ce2: br 0cf6
+    AOT_GOTO(0x0cf6, L0cf6);
+L0ce4:
+    AOT_BLOCK(0x0ce4, 2);
+    // 0ce4: cmp $23, (r4)
+    {
+        src = uint16_t(0x0023);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ce8: bne 0cf6
+    if (!Z)
+        AOT_GOTO(0x0cf6, L0cf6);
+    AOT_GOTO(0x0cea, L0cea);
+L0cea:
+    AOT_BLOCK(0x0cea, 3);
+    // 0cea: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0cec: mov 6(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cf0: jsr pc, *$12a0
+    {
+        a = 0x12a0;
+        r[6] -= 2;
+        WR16(r[6], 0x0cf4);
+    }
+    AOT_GOTO(0x12a0, L12a0);
+L0cf4:
+    AOT_BLOCK(0x0cf4, 1);
+    // 0cf4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0cf6, L0cf6);
+L0cf6:
+    AOT_BLOCK(0x0cf6, 1);
+    // 0cf6: jmp *$08e2
+    {
+        a = 0x08e2;
+    }
+    AOT_GOTO(0x08e2, L08e2);
+L0cfa:
+    AOT_BLOCK(0x0cfa, 3);
+    // 0cfa: mov $5, (sp)
+    {
+        src = uint16_t(0x0005);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0cfe: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d00: jsr pc, *$1474
+    {
+        a = 0x1474;
+        r[6] -= 2;
+        WR16(r[6], 0x0d04);
+    }
+    AOT_GOTO(0x1474, L1474);
+L0d04:
+    AOT_BLOCK(0x0d04, 3);
+    // 0d04: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0d06: cmp $c, r0
+    {
+        src = uint16_t(0x000c);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d0a: bge 0d2e
+    if (!(N ^ V))
+        AOT_GOTO(0x0d2e, L0d2e);
+    AOT_GOTO(0x0d0c, L0d0c);
+L0d0c:
+    AOT_BLOCK(0x0d0c, 4);
+    // 0d0c: mov $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d10: mov $564e, -(sp)
+    {
+        src = uint16_t(0x564e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d14: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d16: jsr pc, *$00fa
+    {
+        a = 0x00fa;
+        r[6] -= 2;
+        WR16(r[6], 0x0d1a);
+    }
+    AOT_GOTO(0x00fa, L00fa);
+L0d1a:
+    AOT_BLOCK(0x0d1a, 3);
+    // 0d1a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0d1c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d1e: bne 0d2e
+    if (!Z)
+        AOT_GOTO(0x0d2e, L0d2e);
+    AOT_GOTO(0x0d20, L0d20);
+L0d20:
+    AOT_BLOCK(0x0d20, 3);
+    // 0d20: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d24: mov $3f7e, -(sp)
+    {
+        src = uint16_t(0x3f7e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d28: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x0d2c);
+    }
+    AOT_GOTO(0x396a, L396a);
+L0d2c:
+    AOT_BLOCK(0x0d2c, 1);
+    // 0d2c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0d2e, L0d2e);
+L0d2e:
+    AOT_BLOCK(0x0d2e, 1);
+    // 0d2e: jmp *$08e2
+    {
+        a = 0x08e2;
+    }
+    AOT_GOTO(0x08e2, L08e2);
+L0d32:
+    AOT_BLOCK(0x0d32, 2);
+    // 0d32: mov (r2), r0
+    {
+        a = r[2];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d34: br 0d68
+    AOT_GOTO(0x0d68, L0d68);
+L0d36:
+    AOT_BLOCK(0x0d36, 2);
+    // 0d36: mov $3f87, (sp)
+    {
+        src = uint16_t(0x3f87);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d3a: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x0d3e);
+    }
+    AOT_GOTO(0x396a, L396a);
+L0d3e:
+    AOT_BLOCK(0x0d3e, 1);
+    // 0d3e: br 0d82
+    AOT_GOTO(0x0d82, L0d82);
+L0d40:
+    AOT_BLOCK(0x0d40, 2);
+    // 0d40: mov $3f8b, (sp)
+    {
+        src = uint16_t(0x3f8b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d44: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x0d48);
+    }
+    AOT_GOTO(0x396a, L396a);
+L0d48:
+    AOT_BLOCK(0x0d48, 1);
+    // 0d48: br 0d82
+    AOT_GOTO(0x0d82, L0d82);
+L0d4a:
+    AOT_BLOCK(0x0d4a, 5);
+    // 0d4a: movb *-10(r5), r0
+    {
+        a = RD16(r[5] + -16);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0d4e: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0d52: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0d56: cmp $a, r0
+    {
+        src = uint16_t(0x000a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d5a: beq 0d64
+    if (Z)
+        AOT_GOTO(0x0d64, L0d64);
+    AOT_GOTO(0x0d5c, L0d5c);
+L0d5c:
+    AOT_BLOCK(0x0d5c, 2);
+    // 0d5c: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d60: beq 0d64
+    if (Z)
+        AOT_GOTO(0x0d64, L0d64);
+    AOT_GOTO(0x0d62, L0d62);
+L0d62:
+    AOT_BLOCK(0x0d62, 1);
+    // 0d62: br 0d4a
+    AOT_GOTO(0x0d4a, L0d4a);
+L0d64:
+    AOT_BLOCK(0x0d64, 1);
+    // 0d64: br 0d82
+    AOT_GOTO(0x0d82, L0d82);
+L0d68:
+    AOT_BLOCK(0x0d68, 7);
+    // 0d68: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0d6a: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0d6c: div $2, r0
+    {
+        src = int16_t(uint16_t(0x0002));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0d70: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0d72: add $3d40, r1
+    {
+        src = uint16_t(0x3d40);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0d76: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 0d78: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d7a, L0d7a);
+L0d7a:
+    AOT_BLOCK(0x0d7a, 2);
+    // 0d7a: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d7c: bne 0d7a
+    if (!Z)
+        AOT_GOTO(0x0d7a, L0d7a);
+    AOT_GOTO(0x0d7e, L0d7e);
+L0d7e:
+    AOT_BLOCK(0x0d7e, 1);
+    // 0d7e: jmp *16(r1)
+    {
+        a = RD16(r[1] + 22);
+    }
+    AOT_JUMP(a);
+L0d82:
+    AOT_BLOCK(0x0d82, 1);
+    // 0d82: jmp *$08e2
+    {
+        a = 0x08e2;
+    }
+    AOT_GOTO(0x08e2, L08e2);
+L0d88:
+    AOT_BLOCK(0x0d88, 7);
+    // 0d88: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0d8a: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0d8c: div $4, r0
+    {
+        src = int16_t(uint16_t(0x0004));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0d90: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0d92: add $3d72, r1
+    {
+        src = uint16_t(0x3d72);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0d96: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 0d98: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d9a, L0d9a);
+L0d9a:
+    AOT_BLOCK(0x0d9a, 2);
+    // 0d9a: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d9c: bne 0d9a
+    if (!Z)
+        AOT_GOTO(0x0d9a, L0d9a);
+    AOT_GOTO(0x0d9e, L0d9e);
+L0d9e:
+    AOT_BLOCK(0x0d9e, 1);
+    // 0d9e: jmp *2e(r1)
+    {
+        a = RD16(r[1] + 46);
+    }
+    AOT_JUMP(a);
+L0da2:
+    AOT_BLOCK(0x0da2, 2);
+    // 0da2: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0da6: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x0daa);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L0daa:
+    AOT_BLOCK(0x0daa, 1);
+    // 0daa: jmp *$08e2
+    {
+        a = 0x08e2;
+    }
+    AOT_GOTO(0x08e2, L08e2);
+L0dae:
+    AOT_BLOCK(0x0dae, 2);
+    // 0dae: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0db2:
+    AOT_BLOCK(0x0db2, 7);
+    // 0db2: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0db6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0db6: mov *4(r5), r2
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0dba: mov (r2), r0
+    {
+        a = r[2];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0dbc: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0dbe: bit $100, 4568(r0)
+    {
+        src = uint16_t(0x0100);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0dc4: beq 0dca
+    if (Z)
+        AOT_GOTO(0x0dca, L0dca);
+    AOT_GOTO(0x0dc6, L0dc6);
+L0dc6:
+    AOT_BLOCK(0x0dc6, 2);
+    // 0dc6: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0dc8: br 0e3c
+    AOT_GOTO(0x0e3c, L0e3c);
+L0dca:
+    AOT_BLOCK(0x0dca, 1);
+    // 0dca: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0dcc, L0dcc);
+L0dcc:
+    AOT_BLOCK(0x0dcc, 5);
+    // 0dcc: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dd0: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dd4: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dd6: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0dda: jsr pc, *$0e40
+    {
+        a = 0x0e40;
+        r[6] -= 2;
+        WR16(r[6], 0x0dde);
+    }
+    AOT_GOTO(0x0e40, L0e40);
+L0dde:
+    AOT_BLOCK(0x0dde, 3);
+    // 0dde: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0de0: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0de2: beq 0de8
+    if (Z)
+        AOT_GOTO(0x0de8, L0de8);
+    AOT_GOTO(0x0de4, L0de4);
+L0de4:
+    AOT_BLOCK(0x0de4, 2);
+    // 0de4: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0de6: br 0dcc
+    AOT_GOTO(0x0dcc, L0dcc);
+L0de8:
+    AOT_BLOCK(0x0de8, 4);
+    // 0de8: mov (r2), r0
+    {
+        a = r[2];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0dea: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0dec: bit $1, 4568(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0df2: beq 0e10
+    if (Z)
+        AOT_GOTO(0x0e10, L0e10);
+    AOT_GOTO(0x0df4, L0df4);
+L0df4:
+    AOT_BLOCK(0x0df4, 5);
+    // 0df4: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0df8: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dfc: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dfe: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0e02: jsr pc, *$0e40
+    {
+        a = 0x0e40;
+        r[6] -= 2;
+        WR16(r[6], 0x0e06);
+    }
+    AOT_GOTO(0x0e40, L0e40);
+L0e06:
+    AOT_BLOCK(0x0e06, 3);
+    // 0e06: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0e08: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e0a: beq 0e10
+    if (Z)
+        AOT_GOTO(0x0e10, L0e10);
+    AOT_GOTO(0x0e0c, L0e0c);
+L0e0c:
+    AOT_BLOCK(0x0e0c, 2);
+    // 0e0c: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0e0e: br 0df4
+    AOT_GOTO(0x0df4, L0df4);
+L0e10:
+    AOT_BLOCK(0x0e10, 1);
+    // 0e10: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0e12, L0e12);
+L0e12:
+    AOT_BLOCK(0x0e12, 4);
+    // 0e12: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e16: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e1a: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e1e: jsr pc, *$0e40
+    {
+        a = 0x0e40;
+        r[6] -= 2;
+        WR16(r[6], 0x0e22);
+    }
+    AOT_GOTO(0x0e40, L0e40);
+L0e22:
+    AOT_BLOCK(0x0e22, 3);
+    // 0e22: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0e24: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e26: beq 0e2c
+    if (Z)
+        AOT_GOTO(0x0e2c, L0e2c);
+    AOT_GOTO(0x0e28, L0e28);
+L0e28:
+    AOT_BLOCK(0x0e28, 2);
+    // 0e28: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0e2a: br 0e12
+    AOT_GOTO(0x0e12, L0e12);
+L0e2c:
+    AOT_BLOCK(0x0e2c, 2);
+    // 0e2c: mov *4(r5), (sp)
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e30: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x0e34);
+    }
+    AOT_GOTO(0x241c, L241c);
+L0e34:
+    AOT_BLOCK(0x0e34, 3);
+    // 0e34: mov r0, *4(r5)
+    {
+        src = r[0];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+    }
+    // 0e38: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e3a: br 0e3c
+    AOT_GOTO(0x0e3c, L0e3c);
+L0e3c:
+    AOT_BLOCK(0x0e3c, 2);
+    // 0e3c: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0e40:
+    AOT_BLOCK(0x0e40, 7);
+    // 0e40: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0e44;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0e44: mov *4(r5), r4
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0e48: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0e4a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0e4c: bit $100, 4568(r0)
+    {
+        src = uint16_t(0x0100);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0e52: beq 0e5a
+    if (Z)
+        AOT_GOTO(0x0e5a, L0e5a);
+    AOT_GOTO(0x0e54, L0e54);
+L0e54:
+    AOT_BLOCK(0x0e54, 2);
+    // 0e54: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0e56: jmp *$1018
+    {
+        a = 0x1018;
+    }
+    AOT_GOTO(0x1018, L1018);
+L0e5a:
+    AOT_BLOCK(0x0e5a, 2);
+    // 0e5a: cmp $28, (r4)
+    {
+        src = uint16_t(0x0028);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e5e: bne 0e84
+    if (!Z)
+        AOT_GOTO(0x0e84, L0e84);
+    AOT_GOTO(0x0e60, L0e60);
+L0e60:
+    AOT_BLOCK(0x0e60, 5);
+    // 0e60: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e64: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e68: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e6a: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0e6e: jsr pc, *$0db2
+    {
+        a = 0x0db2;
+        r[6] -= 2;
+        WR16(r[6], 0x0e72);
+    }
+    AOT_GOTO(0x0db2, L0db2);
+L0e72:
+    AOT_BLOCK(0x0e72, 3);
+    // 0e72: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0e74: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e76: beq 0e84
+    if (Z)
+        AOT_GOTO(0x0e84, L0e84);
+    AOT_GOTO(0x0e78, L0e78);
+L0e78:
+    AOT_BLOCK(0x0e78, 2);
+    // 0e78: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e7a: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x0e7e);
+    }
+    AOT_GOTO(0x241c, L241c);
+L0e7e:
+    AOT_BLOCK(0x0e7e, 2);
+    // 0e7e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0e80: mov r4, *4(r5)
+    {
+        src = r[4];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e84, L0e84);
+L0e84:
+    AOT_BLOCK(0x0e84, 3);
+    // 0e84: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0e88: cmp $24, (r4)
+    {
+        src = uint16_t(0x0024);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e8c: beq 0e94
+    if (Z)
+        AOT_GOTO(0x0e94, L0e94);
+    AOT_GOTO(0x0e8e, L0e8e);
+L0e8e:
+    AOT_BLOCK(0x0e8e, 2);
+    // 0e8e: cmp $28, (r4)
+    {
+        src = uint16_t(0x0028);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e92: bne 0ebc
+    if (!Z)
+        AOT_GOTO(0x0ebc, L0ebc);
+    AOT_GOTO(0x0e94, L0e94);
+L0e94:
+    AOT_BLOCK(0x0e94, 5);
+    // 0e94: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e98: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e9c: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e9e: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0ea2: jsr pc, *$0db2
+    {
+        a = 0x0db2;
+        r[6] -= 2;
+        WR16(r[6], 0x0ea6);
+    }
+    AOT_GOTO(0x0db2, L0db2);
+L0ea6:
+    AOT_BLOCK(0x0ea6, 3);
+    // 0ea6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0ea8: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0eaa: beq 0eb8
+    if (Z)
+        AOT_GOTO(0x0eb8, L0eb8);
+    AOT_GOTO(0x0eac, L0eac);
+L0eac:
+    AOT_BLOCK(0x0eac, 2);
+    // 0eac: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0eae: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x0eb2);
+    }
+    AOT_GOTO(0x241c, L241c);
+L0eb2:
+    AOT_BLOCK(0x0eb2, 2);
+    // 0eb2: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0eb4: mov r4, *4(r5)
+    {
+        src = r[4];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0eb8, L0eb8);
+L0eb8:
+    AOT_BLOCK(0x0eb8, 1);
+    // 0eb8: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ebc, L0ebc);
+L0ebc:
+    AOT_BLOCK(0x0ebc, 2);
+    // 0ebc: cmp $14, (r3)
+    {
+        src = uint16_t(0x0014);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ec0: beq 0ec6
+    if (Z)
+        AOT_GOTO(0x0ec6, L0ec6);
+    AOT_GOTO(0x0ec2, L0ec2);
+L0ec2:
+    AOT_BLOCK(0x0ec2, 1);
+    // 0ec2: jmp *$1014
+    {
+        a = 0x1014;
+    }
+    AOT_GOTO(0x1014, L1014);
+L0ec6:
+    AOT_BLOCK(0x0ec6, 2);
+    // 0ec6: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ec8: jmp *$0ffa
+    {
+        a = 0x0ffa;
+    }
+    AOT_GOTO(0x0ffa, L0ffa);
+L0ecc:
+    AOT_BLOCK(0x0ecc, 2);
+    // 0ecc: cmpb $e, 6(r3)
+    {
+        src = uint8_t(0x0e);
+        b = uint16_t(r[3] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0ed2: bne 0ee0
+    if (!Z)
+        AOT_GOTO(0x0ee0, L0ee0);
+    AOT_GOTO(0x0ed4, L0ed4);
+L0ed4:
+    AOT_BLOCK(0x0ed4, 2);
+    // 0ed4: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ed8: jsr pc, *$164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x0edc);
+    }
+    AOT_GOTO(0x164e, L164e);
+L0edc:
+    AOT_BLOCK(0x0edc, 2);
+    // 0edc: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ede: beq 0ee6
+    if (Z)
+        AOT_GOTO(0x0ee6, L0ee6);
+    AOT_GOTO(0x0ee0, L0ee0);
+L0ee0:
+    AOT_BLOCK(0x0ee0, 2);
+    // 0ee0: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0ee2: jmp *$1018
+    {
+        a = 0x1018;
+    }
+    AOT_GOTO(0x1018, L1018);
+L0ee6:
+    AOT_BLOCK(0x0ee6, 2);
+    // 0ee6: cmp $50, (r4)
+    {
+        src = uint16_t(0x0050);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0eea: bne 0fac
+    if (!Z)
+        AOT_GOTO(0x0fac, L0fac);
+    AOT_GOTO(0x0eec, L0eec);
+L0eec:
+    AOT_BLOCK(0x0eec, 2);
+    // 0eec: mov *8(r4), r0
+    {
+        a = RD16(r[4] + 8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ef0: br 0f9c
+    AOT_GOTO(0x0f9c, L0f9c);
+L0ef2:
+    AOT_BLOCK(0x0ef2, 2);
+    // 0ef2: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ef6: jsr pc, *$1af4
+    {
+        a = 0x1af4;
+        r[6] -= 2;
+        WR16(r[6], 0x0efa);
+    }
+    AOT_GOTO(0x1af4, L1af4);
+L0efa:
+    AOT_BLOCK(0x0efa, 2);
+    // 0efa: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0efc: beq 0fac
+    if (Z)
+        AOT_GOTO(0x0fac, L0fac);
+    AOT_GOTO(0x0efe, L0efe);
+L0efe:
+    AOT_BLOCK(0x0efe, 2);
+    // 0efe: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f02: jsr pc, *$1b30
+    {
+        a = 0x1b30;
+        r[6] -= 2;
+        WR16(r[6], 0x0f06);
+    }
+    AOT_GOTO(0x1b30, L1b30);
+L0f06:
+    AOT_BLOCK(0x0f06, 1);
+    // 0f06: mov r0, 8(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f0a, L0f0a);
+L0f0a:
+    AOT_BLOCK(0x0f0a, 4);
+    // 0f0a: mov 8(r4), r0
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f0e: mov 8(r0), r3
+    {
+        a = uint16_t(r[0] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0f12: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f14: jsr pc, *$1436
+    {
+        a = 0x1436;
+        r[6] -= 2;
+        WR16(r[6], 0x0f18);
+    }
+    AOT_GOTO(0x1436, L1436);
+L0f18:
+    AOT_BLOCK(0x0f18, 2);
+    // 0f18: cmp $c, r0
+    {
+        src = uint16_t(0x000c);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f1c: blt 0f3e
+    if (N ^ V)
+        AOT_GOTO(0x0f3e, L0f3e);
+    AOT_GOTO(0x0f1e, L0f1e);
+L0f1e:
+    AOT_BLOCK(0x0f1e, 2);
+    // 0f1e: cmp $14, (r3)
+    {
+        src = uint16_t(0x0014);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f22: bne 0f44
+    if (!Z)
+        AOT_GOTO(0x0f44, L0f44);
+    AOT_GOTO(0x0f24, L0f24);
+L0f24:
+    AOT_BLOCK(0x0f24, 3);
+    // 0f24: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f28: cmp a(r3), a(r0)
+    {
+        a = uint16_t(r[3] + 10);
+        src = RD16(a);
+        b = uint16_t(r[0] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f2e: beq 0f3e
+    if (Z)
+        AOT_GOTO(0x0f3e, L0f3e);
+    AOT_GOTO(0x0f30, L0f30);
+L0f30:
+    AOT_BLOCK(0x0f30, 4);
+    // 0f30: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f34: movb 7(r3), r1
+    {
+        a = uint16_t(r[3] + 7);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 0f38: cmp r1, a(r0)
+    {
+        src = r[1];
+        b = uint16_t(r[0] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f3c: bne 0f44
+    if (!Z)
+        AOT_GOTO(0x0f44, L0f44);
+    AOT_GOTO(0x0f3e, L0f3e);
+L0f3e:
+    AOT_BLOCK(0x0f3e, 2);
+    // 0f3e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0f40: jmp *$1018
+    {
+        a = 0x1018;
+    }
+    AOT_GOTO(0x1018, L1018);
+L0f44:
+    AOT_BLOCK(0x0f44, 4);
+    // 0f44: mov 8(r4), r3
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0f48: mov 6(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 0f4e: cmp $14, *6(r3)
+    {
+        src = uint16_t(0x0014);
+        b = RD16(r[3] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f54: bne 0f72
+    if (!Z)
+        AOT_GOTO(0x0f72, L0f72);
+    AOT_GOTO(0x0f56, L0f56);
+L0f56:
+    AOT_BLOCK(0x0f56, 3);
+    // 0f56: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f5a: cmpb $e, 6(r0)
+    {
+        src = uint8_t(0x0e);
+        b = uint16_t(r[0] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0f60: bne 0f72
+    if (!Z)
+        AOT_GOTO(0x0f72, L0f72);
+    AOT_GOTO(0x0f62, L0f62);
+L0f62:
+    AOT_BLOCK(0x0f62, 4);
+    // 0f62: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f66: mov 6(r4), r1
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0f6a: cmp a(r1), a(r0)
+    {
+        a = uint16_t(r[1] + 10);
+        src = RD16(a);
+        b = uint16_t(r[0] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f70: beq 0f82
+    if (Z)
+        AOT_GOTO(0x0f82, L0f82);
+    AOT_GOTO(0x0f72, L0f72);
+L0f72:
+    AOT_BLOCK(0x0f72, 4);
+    // 0f72: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f76: mov $5300, -(sp)
+    {
+        src = uint16_t(0x5300);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f7a: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f7c: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0f80);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L0f80:
+    AOT_BLOCK(0x0f80, 1);
+    // 0f80: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0f82, L0f82);
+L0f82:
+    AOT_BLOCK(0x0f82, 7);
+    // 0f82: mov 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 0f88: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f8a: add $1e, r0
+    {
+        src = uint16_t(0x001e);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0f8e: mov r0, (r4)
+    {
+        src = r[0];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 0f90: mov r4, *4(r5)
+    {
+        src = r[4];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+    }
+    // 0f94: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f98: br 1018
+    AOT_GOTO(0x1018, L1018);
+L0f9c:
+    AOT_BLOCK(0x0f9c, 3);
+    // 0f9c: sub $28, r0
+    {
+        src = uint16_t(0x0028);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0fa0: cmp r0, $f
+    {
+        src = r[0];
+        dst = uint16_t(0x000f);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0fa4: bhi 0fac
+    if (!(C | Z))
+        AOT_GOTO(0x0fac, L0fac);
+    AOT_GOTO(0x0fa6, L0fa6);
+L0fa6:
+    AOT_BLOCK(0x0fa6, 2);
+    // 0fa6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0fa8: jmp *3dd8(r0)
+    {
+        a = RD16(r[0] + 15832);
+    }
+    AOT_JUMP(a);
+L0fac:
+    AOT_BLOCK(0x0fac, 1);
+    // 0fac: br 0fbc
+    AOT_GOTO(0x0fbc, L0fbc);
+L0fae:
+    AOT_BLOCK(0x0fae, 2);
+    // 0fae: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fb0: jsr pc, *$1af4
+    {
+        a = 0x1af4;
+        r[6] -= 2;
+        WR16(r[6], 0x0fb4);
+    }
+    AOT_GOTO(0x1af4, L1af4);
+L0fb4:
+    AOT_BLOCK(0x0fb4, 2);
+    // 0fb4: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0fb6: bne 0fbc
+    if (!Z)
+        AOT_GOTO(0x0fbc, L0fbc);
+    AOT_GOTO(0x0fb8, L0fb8);
+L0fb8:
+    AOT_BLOCK(0x0fb8, 2);
+    // 0fb8: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0fba: br 1018
+    AOT_GOTO(0x1018, L1018);
+L0fbc:
+    AOT_BLOCK(0x0fbc, 2);
+    // 0fbc: cmp $564e, 6(r5)
+    {
+        src = uint16_t(0x564e);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0fc2: beq 0fcc
+    if (Z)
+        AOT_GOTO(0x0fcc, L0fcc);
+    AOT_GOTO(0x0fc4, L0fc4);
+L0fc4:
+    AOT_BLOCK(0x0fc4, 2);
+    // 0fc4: cmp 5de2, 6(r5)
+    {
+        a = 0x5de2;
+        src = RD16(a);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0fca: bne 0fd2
+    if (!Z)
+        AOT_GOTO(0x0fd2, L0fd2);
+    AOT_GOTO(0x0fcc, L0fcc);
+L0fcc:
+    AOT_BLOCK(0x0fcc, 1);
+    // 0fcc: add $10, 8(r5)
+    {
+        src = uint16_t(0x0010);
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0fd2, L0fd2);
+L0fd2:
+    AOT_BLOCK(0x0fd2, 6);
+    // 0fd2: mov 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0fd6: com r0
+    {
+        val = ~int(r[0]);
+        r[0] = val;
+        C = true;
+    }
+    // 0fd8: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fda: mov $5300, -(sp)
+    {
+        src = uint16_t(0x5300);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fde: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fe0: jsr pc, 241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x0fe4);
+    }
+    AOT_GOTO(0x241c, L241c);
+L0fe4:
+    AOT_BLOCK(0x0fe4, 3);
+    // 0fe4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0fe6: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fe8: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0fec);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L0fec:
+    AOT_BLOCK(0x0fec, 4);
+    // 0fec: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0fee: mov r3, *4(r5)
+    {
+        src = r[3];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+    }
+    // 0ff2: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ff6: br 1018
+    AOT_GOTO(0x1018, L1018);
+L0ffa:
+    AOT_BLOCK(0x0ffa, 7);
+    // 0ffa: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0ffc: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0ffe: div $4, r0
+    {
+        src = int16_t(uint16_t(0x0004));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1002: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 1004: add $3df8, r1
+    {
+        src = uint16_t(0x3df8);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1008: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 100a: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x100c, L100c);
+L100c:
+    AOT_BLOCK(0x100c, 2);
+    // 100c: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 100e: bne 100c
+    if (!Z)
+        AOT_GOTO(0x100c, L100c);
+    AOT_GOTO(0x1010, L1010);
+L1010:
+    AOT_BLOCK(0x1010, 1);
+    // 1010: jmp *22(r1)
+    {
+        a = RD16(r[1] + 34);
+    }
+    AOT_JUMP(a);
+L1014:
+    AOT_BLOCK(0x1014, 2);
+    // 1014: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1016: br 1018
+    AOT_GOTO(0x1018, L1018);
+L1018:
+    AOT_BLOCK(0x1018, 2);
+    // 1018: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L101c:
+    AOT_BLOCK(0x101c, 7);
+    // 101c: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1020;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1020: mov *4(r5), r4
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1024: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1028: ash $2, r0
+    {
+        src = uint16_t(0x0002) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 102c: cmp $5300, r0
+    {
+        src = uint16_t(0x5300);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1030: beq 105c
+    if (Z)
+        AOT_GOTO(0x105c, L105c);
+    AOT_GOTO(0x1032, L1032);
+L1032:
+    AOT_BLOCK(0x1032, 1);
+    // 1032: cmp $20, (r4)
+    {
+        src = uint16_t(0x0020);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1036, L1036);
+L1036:
+    AOT_BLOCK(0x1036, 1);
+    // 1036: beq 103e
+    if (Z)
+        AOT_GOTO(0x103e, L103e);
+    AOT_GOTO(0x1038, L1038);
+L1038:
+    AOT_BLOCK(0x1038, 2);
+    // 1038: cmp $21, (r4)
+    {
+        src = uint16_t(0x0021);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 103c: bne 105c
+    if (!Z)
+        AOT_GOTO(0x105c, L105c);
+    AOT_GOTO(0x103e, L103e);
+L103e:
+    AOT_BLOCK(0x103e, 2);
+    // 103e: cmp $14, *6(r4)
+    {
+        src = uint16_t(0x0014);
+        b = RD16(r[4] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1044: bne 105c
+    if (!Z)
+        AOT_GOTO(0x105c, L105c);
+    AOT_GOTO(0x1046, L1046);
+L1046:
+    AOT_BLOCK(0x1046, 4);
+    // 1046: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 104a: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 104e: mov 6(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1052: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x1056);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L1056:
+    AOT_BLOCK(0x1056, 3);
+    // 1056: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1058: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 105a: br 10b2
+    AOT_GOTO(0x10b2, L10b2);
+L105c:
+    AOT_BLOCK(0x105c, 5);
+    // 105c: clr r3
+    {
+        r[3] = 0;
+    }
+    // 105e: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1060: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1062: bit $1, 4568(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1068: beq 1076
+    if (Z)
+        AOT_GOTO(0x1076, L1076);
+    AOT_GOTO(0x106a, L106a);
+L106a:
+    AOT_BLOCK(0x106a, 3);
+    // 106a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 106c: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1070: jsr pc, *$10b6
+    {
+        a = 0x10b6;
+        r[6] -= 2;
+        WR16(r[6], 0x1074);
+    }
+    AOT_GOTO(0x10b6, L10b6);
+L1074:
+    AOT_BLOCK(0x1074, 1);
+    // 1074: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1076, L1076);
+L1076:
+    AOT_BLOCK(0x1076, 2);
+    // 1076: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1078: bne 1086
+    if (!Z)
+        AOT_GOTO(0x1086, L1086);
+    AOT_GOTO(0x107a, L107a);
+L107a:
+    AOT_BLOCK(0x107a, 3);
+    // 107a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 107c: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1080: jsr pc, *$10b6
+    {
+        a = 0x10b6;
+        r[6] -= 2;
+        WR16(r[6], 0x1084);
+    }
+    AOT_GOTO(0x10b6, L10b6);
+L1084:
+    AOT_BLOCK(0x1084, 1);
+    // 1084: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1086, L1086);
+L1086:
+    AOT_BLOCK(0x1086, 2);
+    // 1086: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1088: beq 10ae
+    if (Z)
+        AOT_GOTO(0x10ae, L10ae);
+    AOT_GOTO(0x108a, L108a);
+L108a:
+    AOT_BLOCK(0x108a, 4);
+    // 108a: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 108e: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1092: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1094: jsr pc, 241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x1098);
+    }
+    AOT_GOTO(0x241c, L241c);
+L1098:
+    AOT_BLOCK(0x1098, 3);
+    // 1098: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 109a: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 109c: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x10a0);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L10a0:
+    AOT_BLOCK(0x10a0, 6);
+    // 10a0: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 10a2: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 10a4: mov r3, *4(r5)
+    {
+        src = r[3];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+    }
+    // 10a8: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 10aa: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 10ac: br 10b2
+    AOT_GOTO(0x10b2, L10b2);
+L10ae:
+    AOT_BLOCK(0x10ae, 2);
+    // 10ae: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 10b0: br 10b2
+    AOT_GOTO(0x10b2, L10b2);
+L10b2:
+    AOT_BLOCK(0x10b2, 2);
+    // 10b2: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L10b6:
+    AOT_BLOCK(0x10b6, 5);
+    // 10b6: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x10ba;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 10ba: mov *4(r5), r4
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 10be: cmp $20, (r4)
+    {
+        src = uint16_t(0x0020);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 10c2: beq 10ca
+    if (Z)
+        AOT_GOTO(0x10ca, L10ca);
+    AOT_GOTO(0x10c4, L10c4);
+L10c4:
+    AOT_BLOCK(0x10c4, 2);
+    // 10c4: cmp $21, (r4)
+    {
+        src = uint16_t(0x0021);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 10c8: bne 10e2
+    if (!Z)
+        AOT_GOTO(0x10e2, L10e2);
+    AOT_GOTO(0x10ca, L10ca);
+L10ca:
+    AOT_BLOCK(0x10ca, 2);
+    // 10ca: cmp $14, *6(r4)
+    {
+        src = uint16_t(0x0014);
+        b = RD16(r[4] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 10d0: bne 10e2
+    if (!Z)
+        AOT_GOTO(0x10e2, L10e2);
+    AOT_GOTO(0x10d2, L10d2);
+L10d2:
+    AOT_BLOCK(0x10d2, 2);
+    // 10d2: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10d6: jsr pc, *$111a
+    {
+        a = 0x111a;
+        r[6] -= 2;
+        WR16(r[6], 0x10da);
+    }
+    AOT_GOTO(0x111a, L111a);
+L10da:
+    AOT_BLOCK(0x10da, 3);
+    // 10da: mov r0, *4(r5)
+    {
+        src = r[0];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+    }
+    // 10de: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10e0: br 1116
+    AOT_GOTO(0x1116, L1116);
+L10e2:
+    AOT_BLOCK(0x10e2, 2);
+    // 10e2: cmp $24, (r4)
+    {
+        src = uint16_t(0x0024);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 10e6: beq 10ee
+    if (Z)
+        AOT_GOTO(0x10ee, L10ee);
+    AOT_GOTO(0x10e8, L10e8);
+L10e8:
+    AOT_BLOCK(0x10e8, 2);
+    // 10e8: cmp $28, (r4)
+    {
+        src = uint16_t(0x0028);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 10ec: bne 1100
+    if (!Z)
+        AOT_GOTO(0x1100, L1100);
+    AOT_GOTO(0x10ee, L10ee);
+L10ee:
+    AOT_BLOCK(0x10ee, 3);
+    // 10ee: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10f0: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 10f4: jsr pc, *$10b6
+    {
+        a = 0x10b6;
+        r[6] -= 2;
+        WR16(r[6], 0x10f8);
+    }
+    AOT_GOTO(0x10b6, L10b6);
+L10f8:
+    AOT_BLOCK(0x10f8, 2);
+    // 10f8: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10fa: beq 1100
+    if (Z)
+        AOT_GOTO(0x1100, L1100);
+    AOT_GOTO(0x10fc, L10fc);
+L10fc:
+    AOT_BLOCK(0x10fc, 2);
+    // 10fc: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10fe: br 1116
+    AOT_GOTO(0x1116, L1116);
+L1100:
+    AOT_BLOCK(0x1100, 2);
+    // 1100: cmp $28, (r4)
+    {
+        src = uint16_t(0x0028);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1104: bne 1112
+    if (!Z)
+        AOT_GOTO(0x1112, L1112);
+    AOT_GOTO(0x1106, L1106);
+L1106:
+    AOT_BLOCK(0x1106, 3);
+    // 1106: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1108: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 110c: jsr pc, *$10b6
+    {
+        a = 0x10b6;
+        r[6] -= 2;
+        WR16(r[6], 0x1110);
+    }
+    AOT_GOTO(0x10b6, L10b6);
+L1110:
+    AOT_BLOCK(0x1110, 1);
+    // 1110: br 1116
+    AOT_GOTO(0x1116, L1116);
+L1112:
+    AOT_BLOCK(0x1112, 2);
+    // 1112: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1114: br 1116
+    AOT_GOTO(0x1116, L1116);
+L1116:
+    AOT_BLOCK(0x1116, 2);
+    // 1116: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L111a:
+    AOT_BLOCK(0x111a, 5);
+    // 111a: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x111e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 111e: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1122: cmpb $e, 6(r4)
+    {
+        src = uint8_t(0x0e);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1128: beq 112e
+    if (Z)
+        AOT_GOTO(0x112e, L112e);
+    AOT_GOTO(0x112a, L112a);
+L112a:
+    AOT_BLOCK(0x112a, 2);
+    // 112a: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 112c: br 1154
+    AOT_GOTO(0x1154, L1154);
+L112e:
+    AOT_BLOCK(0x112e, 8);
+    // 112e: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1132: mov 8(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1136: mov 6(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 113a: mov 4(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 113e: mov 2(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1142: mov $14, -(sp)
+    {
+        src = uint16_t(0x0014);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1146: mov $3, -(sp)
+    {
+        src = uint16_t(0x0003);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 114a: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x114e);
+    }
+    AOT_GOTO(0x3146, L3146);
+L114e:
+    AOT_BLOCK(0x114e, 2);
+    // 114e: add $c, sp
+    {
+        src = uint16_t(0x000c);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1152: br 1154
+    AOT_GOTO(0x1154, L1154);
+L1154:
+    AOT_BLOCK(0x1154, 2);
+    // 1154: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1158:
+    AOT_BLOCK(0x1158, 6);
+    // 1158: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x115c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 115c: sub $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1160: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1164: cmp $24, (r4)
+    {
+        src = uint16_t(0x0024);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1168: beq 1186
+    if (Z)
+        AOT_GOTO(0x1186, L1186);
+    AOT_GOTO(0x116a, L116a);
+L116a:
+    AOT_BLOCK(0x116a, 4);
+    // 116a: mov 3cea, (sp)
+    {
+        a = 0x3cea;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 116e: sub 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 1172: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1174: jsr pc, *$1474
+    {
+        a = 0x1474;
+        r[6] -= 2;
+        WR16(r[6], 0x1178);
+    }
+    AOT_GOTO(0x1474, L1474);
+L1178:
+    AOT_BLOCK(0x1178, 3);
+    // 1178: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 117a: cmp $c, r0
+    {
+        src = uint16_t(0x000c);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 117e: bge 1186
+    if (!(N ^ V))
+        AOT_GOTO(0x1186, L1186);
+    AOT_GOTO(0x1180, L1180);
+L1180:
+    AOT_BLOCK(0x1180, 2);
+    // 1180: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1184: br 11b2
+    AOT_GOTO(0x11b2, L11b2);
+L1186:
+    AOT_BLOCK(0x1186, 9);
+    // 1186: mov $6a, -10(r5)
+    {
+        src = uint16_t(0x006a);
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+    }
+    // 118c: mov 2(r4), -e(r5)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 1192: mov 4(r4), -c(r5)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 1198: mov r4, -a(r5)
+    {
+        src = r[4];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 119c: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 11a0: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 11a4: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 11a6: add $fff0, (sp)
+    {
+        src = uint16_t(0xfff0);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 11aa: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x11ae);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L11ae:
+    AOT_BLOCK(0x11ae, 2);
+    // 11ae: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11b0: br 11b2
+    AOT_GOTO(0x11b2, L11b2);
+L11b2:
+    AOT_BLOCK(0x11b2, 2);
+    // 11b2: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L11b6:
+    AOT_BLOCK(0x11b6, 5);
+    // 11b6: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x11ba;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 11ba: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 11be: tst 59f2
+    {
+        a = 0x59f2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 11c2: bne 11d6
+    if (!Z)
+        AOT_GOTO(0x11d6, L11d6);
+    AOT_GOTO(0x11c4, L11c4);
+L11c4:
+    AOT_BLOCK(0x11c4, 2);
+    // 11c4: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11c6: jsr pc, *$164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x11ca);
+    }
+    AOT_GOTO(0x164e, L164e);
+L11ca:
+    AOT_BLOCK(0x11ca, 2);
+    // 11ca: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 11cc: bne 11d6
+    if (!Z)
+        AOT_GOTO(0x11d6, L11d6);
+    AOT_GOTO(0x11ce, L11ce);
+L11ce:
+    AOT_BLOCK(0x11ce, 2);
+    // 11ce: cmp $6, 2(r4)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11d4: bne 11f0
+    if (!Z)
+        AOT_GOTO(0x11f0, L11f0);
+    AOT_GOTO(0x11d6, L11d6);
+L11d6:
+    AOT_BLOCK(0x11d6, 4);
+    // 11d6: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 11d8: mov $56e2, -(sp)
+    {
+        src = uint16_t(0x56e2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 11dc: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11de: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x11e2);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L11e2:
+    AOT_BLOCK(0x11e2, 3);
+    // 11e2: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 11e4: mov 2(r4), (sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11e8: jsr pc, *$16c8
+    {
+        a = 0x16c8;
+        r[6] -= 2;
+        WR16(r[6], 0x11ec);
+    }
+    AOT_GOTO(0x16c8, L16c8);
+L11ec:
+    AOT_BLOCK(0x11ec, 2);
+    // 11ec: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11ee: br 1204
+    AOT_GOTO(0x1204, L1204);
+L11f0:
+    AOT_BLOCK(0x11f0, 5);
+    // 11f0: inc *6(r5)
+    {
+        a = RD16(r[5] + 6);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 11f4: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 11f6: mov $59ee, -(sp)
+    {
+        src = uint16_t(0x59ee);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 11fa: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11fc: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x1200);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L1200:
+    AOT_BLOCK(0x1200, 2);
+    // 1200: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 1202: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1204, L1204);
+L1204:
+    AOT_BLOCK(0x1204, 2);
+    // 1204: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1206: br 1208
+    AOT_GOTO(0x1208, L1208);
+L1208:
+    AOT_BLOCK(0x1208, 2);
+    // 1208: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L120c:
+    AOT_BLOCK(0x120c, 4);
+    // 120c: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1210;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1210: cmp 6(r5), 4(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1216: bge 121e
+    if (!(N ^ V))
+        AOT_GOTO(0x121e, L121e);
+    AOT_GOTO(0x1218, L1218);
+L1218:
+    AOT_BLOCK(0x1218, 2);
+    // 1218: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 121c: br 1224
+    AOT_GOTO(0x1224, L1224);
+L121e:
+    AOT_BLOCK(0x121e, 2);
+    // 121e: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1222: br 1224
+    AOT_GOTO(0x1224, L1224);
+L1224:
+    AOT_BLOCK(0x1224, 2);
+    // 1224: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1228:
+    AOT_BLOCK(0x1228, 5);
+    // 1228: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x122c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 122c: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1230: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1232: beq 1238
+    if (Z)
+        AOT_GOTO(0x1238, L1238);
+    AOT_GOTO(0x1234, L1234);
+L1234:
+    AOT_BLOCK(0x1234, 2);
+    // 1234: tst (r4)
+    {
+        a = r[4];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1236: bne 123c
+    if (!Z)
+        AOT_GOTO(0x123c, L123c);
+    AOT_GOTO(0x1238, L1238);
+L1238:
+    AOT_BLOCK(0x1238, 2);
+    // 1238: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 123a: br 129c
+    AOT_GOTO(0x129c, L129c);
+L123c:
+    AOT_BLOCK(0x123c, 2);
+    // 123c: cmp $15, (r4)
+    {
+        src = uint16_t(0x0015);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1240: bne 1248
+    if (!Z)
+        AOT_GOTO(0x1248, L1248);
+    AOT_GOTO(0x1242, L1242);
+L1242:
+    AOT_BLOCK(0x1242, 2);
+    // 1242: mov $fffd, r0
+    {
+        src = uint16_t(0xfffd);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1246: br 129c
+    AOT_GOTO(0x129c, L129c);
+L1248:
+    AOT_BLOCK(0x1248, 2);
+    // 1248: cmp $23, (r4)
+    {
+        src = uint16_t(0x0023);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 124c: bne 1254
+    if (!Z)
+        AOT_GOTO(0x1254, L1254);
+    AOT_GOTO(0x124e, L124e);
+L124e:
+    AOT_BLOCK(0x124e, 2);
+    // 124e: mov $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1252: br 129c
+    AOT_GOTO(0x129c, L129c);
+L1254:
+    AOT_BLOCK(0x1254, 2);
+    // 1254: cmp $3a, (r4)
+    {
+        src = uint16_t(0x003a);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1258: bne 1270
+    if (!Z)
+        AOT_GOTO(0x1270, L1270);
+    AOT_GOTO(0x125a, L125a);
+L125a:
+    AOT_BLOCK(0x125a, 2);
+    // 125a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 125c: jsr pc, *$31a8
+    {
+        a = 0x31a8;
+        r[6] -= 2;
+        WR16(r[6], 0x1260);
+    }
+    AOT_GOTO(0x31a8, L31a8);
+L1260:
+    AOT_BLOCK(0x1260, 2);
+    // 1260: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1262: beq 1270
+    if (Z)
+        AOT_GOTO(0x1270, L1270);
+    AOT_GOTO(0x1264, L1264);
+L1264:
+    AOT_BLOCK(0x1264, 2);
+    // 1264: tst 6(r3)
+    {
+        a = uint16_t(r[3] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1268: blt 1270
+    if (N ^ V)
+        AOT_GOTO(0x1270, L1270);
+    AOT_GOTO(0x126a, L126a);
+L126a:
+    AOT_BLOCK(0x126a, 2);
+    // 126a: mov $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 126e: br 129c
+    AOT_GOTO(0x129c, L129c);
+L1270:
+    AOT_BLOCK(0x1270, 4);
+    // 1270: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1272: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1274: bit $100, 4568(r0)
+    {
+        src = uint16_t(0x0100);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 127a: beq 1296
+    if (Z)
+        AOT_GOTO(0x1296, L1296);
+    AOT_GOTO(0x127c, L127c);
+L127c:
+    AOT_BLOCK(0x127c, 2);
+    // 127c: cmp $1, 2(r4)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1282: beq 128c
+    if (Z)
+        AOT_GOTO(0x128c, L128c);
+    AOT_GOTO(0x1284, L1284);
+L1284:
+    AOT_BLOCK(0x1284, 2);
+    // 1284: cmp $2, 2(r4)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 128a: bne 1292
+    if (!Z)
+        AOT_GOTO(0x1292, L1292);
+    AOT_GOTO(0x128c, L128c);
+L128c:
+    AOT_BLOCK(0x128c, 2);
+    // 128c: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1290: br 129c
+    AOT_GOTO(0x129c, L129c);
+L1292:
+    AOT_BLOCK(0x1292, 2);
+    // 1292: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1294: br 129c
+    AOT_GOTO(0x129c, L129c);
+L1296:
+    AOT_BLOCK(0x1296, 2);
+    // 1296: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 129a: br 129c
+    AOT_GOTO(0x129c, L129c);
+L129c:
+    AOT_BLOCK(0x129c, 2);
+    // 129c: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12a0:
+    AOT_BLOCK(0x12a0, 3);
+    // 12a0: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x12a4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 12a4: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x12a8, L12a8);
+L12a8:
+    AOT_BLOCK(0x12a8, 2);
+    // 12a8: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12aa: jmp *$13ce
+    {
+        a = 0x13ce;
+    }
+    AOT_GOTO(0x13ce, L13ce);
+L12ae:
+    AOT_BLOCK(0x12ae, 2);
+    // 12ae: mov $41ec, (sp)
+    {
+        src = uint16_t(0x41ec);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12b2: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x12b6);
+    }
+    AOT_GOTO(0x396a, L396a);
+L12b6:
+    AOT_BLOCK(0x12b6, 2);
+    // 12b6: mov 6(r3), (sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12ba: jsr pc, *$1ec4
+    {
+        a = 0x1ec4;
+        r[6] -= 2;
+        WR16(r[6], 0x12be);
+    }
+    AOT_GOTO(0x1ec4, L1ec4);
+L12be:
+    AOT_BLOCK(0x12be, 1);
+    // 12be: jmp *$13e6
+    {
+        a = 0x13e6;
+    }
+    AOT_GOTO(0x13e6, L13e6);
+L12c2:
+    AOT_BLOCK(0x12c2, 3);
+    // 12c2: mov 6(r3), (sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 12c6: mov $41ee, -(sp)
+    {
+        src = uint16_t(0x41ee);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12ca: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x12ce);
+    }
+    AOT_GOTO(0x396a, L396a);
+L12ce:
+    AOT_BLOCK(0x12ce, 2);
+    // 12ce: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 12d0: jmp *$13e6
+    {
+        a = 0x13e6;
+    }
+    AOT_GOTO(0x13e6, L13e6);
+L12d4:
+    AOT_BLOCK(0x12d4, 3);
+    // 12d4: mov 8(r3), r4
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 12d8: cmp $2, 6(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12de: bne 12e4
+    if (!Z)
+        AOT_GOTO(0x12e4, L12e4);
+    AOT_GOTO(0x12e0, L12e0);
+L12e0:
+    AOT_BLOCK(0x12e0, 1);
+    // 12e0: add $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x12e4, L12e4);
+L12e4:
+    AOT_BLOCK(0x12e4, 2);
+    // 12e4: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 12e6: beq 130a
+    if (Z)
+        AOT_GOTO(0x130a, L130a);
+    AOT_GOTO(0x12e8, L12e8);
+L12e8:
+    AOT_BLOCK(0x12e8, 2);
+    // 12e8: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12ea: jsr pc, *$1ec4
+    {
+        a = 0x1ec4;
+        r[6] -= 2;
+        WR16(r[6], 0x12ee);
+    }
+    AOT_GOTO(0x1ec4, L1ec4);
+L12ee:
+    AOT_BLOCK(0x12ee, 2);
+    // 12ee: cmpb $14, 6(r3)
+    {
+        src = uint8_t(0x14);
+        b = uint16_t(r[3] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 12f4: beq 12fe
+    if (Z)
+        AOT_GOTO(0x12fe, L12fe);
+    AOT_GOTO(0x12f6, L12f6);
+L12f6:
+    AOT_BLOCK(0x12f6, 2);
+    // 12f6: mov $2b, (sp)
+    {
+        src = uint16_t(0x002b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12fa: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x12fe);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L12fe:
+    AOT_BLOCK(0x12fe, 2);
+    // 12fe: cmpb $e, 6(r3)
+    {
+        src = uint8_t(0x0e);
+        b = uint16_t(r[3] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1304: bne 130a
+    if (!Z)
+        AOT_GOTO(0x130a, L130a);
+    AOT_GOTO(0x1306, L1306);
+L1306:
+    AOT_BLOCK(0x1306, 1);
+    // 1306: jsr pc, 13ea
+    {
+        a = 0x13ea;
+        r[6] -= 2;
+        WR16(r[6], 0x130a);
+    }
+    AOT_GOTO(0x13ea, L13ea);
+L130a:
+    AOT_BLOCK(0x130a, 2);
+    // 130a: movb 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 130e: br 1342
+    AOT_GOTO(0x1342, L1342);
+L1310:
+    AOT_BLOCK(0x1310, 2);
+    // 1310: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1312: jsr pc, *$13fa
+    {
+        a = 0x13fa;
+        r[6] -= 2;
+        WR16(r[6], 0x1316);
+    }
+    AOT_GOTO(0x13fa, L13fa);
+L1316:
+    AOT_BLOCK(0x1316, 4);
+    // 1316: movb 7(r3), r0
+    {
+        a = uint16_t(r[3] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 131a: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 131c: mov $41f2, -(sp)
+    {
+        src = uint16_t(0x41f2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1320: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1324);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1324:
+    AOT_BLOCK(0x1324, 2);
+    // 1324: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1326: br 13e6
+    AOT_GOTO(0x13e6, L13e6);
+L1328:
+    AOT_BLOCK(0x1328, 2);
+    // 1328: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 132a: jsr pc, *$13fa
+    {
+        a = 0x13fa;
+        r[6] -= 2;
+        WR16(r[6], 0x132e);
+    }
+    AOT_GOTO(0x13fa, L13fa);
+L132e:
+    AOT_BLOCK(0x132e, 1);
+    // 132e: br 13e6
+    AOT_GOTO(0x13e6, L13e6);
+L1330:
+    AOT_BLOCK(0x1330, 3);
+    // 1330: mov a(r3), (sp)
+    {
+        a = uint16_t(r[3] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1334: mov $41f8, -(sp)
+    {
+        src = uint16_t(0x41f8);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1338: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x133c);
+    }
+    AOT_GOTO(0x396a, L396a);
+L133c:
+    AOT_BLOCK(0x133c, 2);
+    // 133c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 133e: br 13e6
+    AOT_GOTO(0x13e6, L13e6);
+L1342:
+    AOT_BLOCK(0x1342, 3);
+    // 1342: sub $c, r0
+    {
+        src = uint16_t(0x000c);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1346: cmp r0, $a
+    {
+        src = r[0];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 134a: bhi 1352
+    if (!(C | Z))
+        AOT_GOTO(0x1352, L1352);
+    AOT_GOTO(0x134c, L134c);
+L134c:
+    AOT_BLOCK(0x134c, 2);
+    // 134c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 134e: jmp *3f90(r0)
+    {
+        a = RD16(r[0] + 16272);
+    }
+    AOT_JUMP(a);
+L1352:
+    AOT_BLOCK(0x1352, 2);
+    // 1352: mov $41fc, (sp)
+    {
+        src = uint16_t(0x41fc);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1356: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x135a);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L135a:
+    AOT_BLOCK(0x135a, 1);
+    // 135a: br 13e6
+    AOT_GOTO(0x13e6, L13e6);
+L135c:
+    AOT_BLOCK(0x135c, 2);
+    // 135c: mov $24, (sp)
+    {
+        src = uint16_t(0x0024);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1360: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x1364);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L1364:
+    AOT_BLOCK(0x1364, 3);
+    // 1364: mov 6(r3), r3
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1368: cmp $14, (r3)
+    {
+        src = uint16_t(0x0014);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 136c: bne 137a
+    if (!Z)
+        AOT_GOTO(0x137a, L137a);
+    AOT_GOTO(0x136e, L136e);
+L136e:
+    AOT_BLOCK(0x136e, 2);
+    // 136e: cmpb $e, 6(r3)
+    {
+        src = uint8_t(0x0e);
+        b = uint16_t(r[3] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1374: bne 137a
+    if (!Z)
+        AOT_GOTO(0x137a, L137a);
+    AOT_GOTO(0x1376, L1376);
+L1376:
+    AOT_BLOCK(0x1376, 1);
+    // 1376: jsr pc, 13ea
+    {
+        a = 0x13ea;
+        r[6] -= 2;
+        WR16(r[6], 0x137a);
+    }
+    AOT_GOTO(0x13ea, L13ea);
+L137a:
+    AOT_BLOCK(0x137a, 1);
+    // 137a: br 12a8
+    AOT_GOTO(0x12a8, L12a8);
+L137c:
+    AOT_BLOCK(0x137c, 2);
+    // 137c: cmp $1, 6(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1382: bne 1388
+    if (!Z)
+        AOT_GOTO(0x1388, L1388);
+    AOT_GOTO(0x1384, L1384);
+L1384:
+    AOT_BLOCK(0x1384, 2);
+    // 1384: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1386: br 138c
+    AOT_GOTO(0x138c, L138c);
+L1388:
+    AOT_BLOCK(0x1388, 1);
+    // 1388: mov $2b, (sp)
+    {
+        src = uint16_t(0x002b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x138c, L138c);
+L138c:
+    AOT_BLOCK(0x138c, 3);
+    // 138c: mov a(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1390: mov $4212, -(sp)
+    {
+        src = uint16_t(0x4212);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1394: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1398);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1398:
+    AOT_BLOCK(0x1398, 2);
+    // 1398: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 139a: br 13e6
+    AOT_GOTO(0x13e6, L13e6);
+L139c:
+    AOT_BLOCK(0x139c, 3);
+    // 139c: mov a(r3), (sp)
+    {
+        a = uint16_t(r[3] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13a0: cmp $1, 6(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13a6: bne 13ac
+    if (!Z)
+        AOT_GOTO(0x13ac, L13ac);
+    AOT_GOTO(0x13a8, L13a8);
+L13a8:
+    AOT_BLOCK(0x13a8, 2);
+    // 13a8: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 13aa: br 13b0
+    AOT_GOTO(0x13b0, L13b0);
+L13ac:
+    AOT_BLOCK(0x13ac, 1);
+    // 13ac: mov $2d, -(sp)
+    {
+        src = uint16_t(0x002d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x13b0, L13b0);
+L13b0:
+    AOT_BLOCK(0x13b0, 2);
+    // 13b0: mov $421a, -(sp)
+    {
+        src = uint16_t(0x421a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13b4: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x13b8);
+    }
+    AOT_GOTO(0x396a, L396a);
+L13b8:
+    AOT_BLOCK(0x13b8, 2);
+    // 13b8: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13ba: br 13e6
+    AOT_GOTO(0x13e6, L13e6);
+L13bc:
+    AOT_BLOCK(0x13bc, 3);
+    // 13bc: mov 6(r3), r3
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 13c0: mov $2a, (sp)
+    {
+        src = uint16_t(0x002a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13c4: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x13c8);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L13c8:
+    AOT_BLOCK(0x13c8, 1);
+    // 13c8: jmp *$12a8
+    {
+        a = 0x12a8;
+    }
+    AOT_GOTO(0x12a8, L12a8);
+L13ce:
+    AOT_BLOCK(0x13ce, 3);
+    // 13ce: sub $14, r0
+    {
+        src = uint16_t(0x0014);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 13d2: cmp r0, $10
+    {
+        src = r[0];
+        dst = uint16_t(0x0010);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13d6: bhi 13de
+    if (!(C | Z))
+        AOT_GOTO(0x13de, L13de);
+    AOT_GOTO(0x13d8, L13d8);
+L13d8:
+    AOT_BLOCK(0x13d8, 2);
+    // 13d8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 13da: jmp *3fa6(r0)
+    {
+        a = RD16(r[0] + 16294);
+    }
+    AOT_JUMP(a);
+L13de:
+    AOT_BLOCK(0x13de, 2);
+    // 13de: mov $4222, (sp)
+    {
+        src = uint16_t(0x4222);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13e2: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x13e6);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L13e6:
+    AOT_BLOCK(0x13e6, 2);
+    // 13e6: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13ea:
+    AOT_BLOCK(0x13ea, 4);
+    // 13ea: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x13ee;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 13ee: mov $4239, (sp)
+    {
+        src = uint16_t(0x4239);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13f2: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x13f6);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L13f6:
+    AOT_BLOCK(0x13f6, 2);
+    // 13f6: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13fa:
+    AOT_BLOCK(0x13fa, 5);
+    // 13fa: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x13fe;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 13fe: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1402: cmpb $16, 6(r4)
+    {
+        src = uint8_t(0x16);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1408: beq 1412
+    if (Z)
+        AOT_GOTO(0x1412, L1412);
+    AOT_GOTO(0x140a, L140a);
+L140a:
+    AOT_BLOCK(0x140a, 2);
+    // 140a: cmpb $d, 6(r4)
+    {
+        src = uint8_t(0x0d);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1410: bne 1422
+    if (!Z)
+        AOT_GOTO(0x1422, L1422);
+    AOT_GOTO(0x1412, L1412);
+L1412:
+    AOT_BLOCK(0x1412, 3);
+    // 1412: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1416: mov $4251, -(sp)
+    {
+        src = uint16_t(0x4251);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 141a: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x141e);
+    }
+    AOT_GOTO(0x396a, L396a);
+L141e:
+    AOT_BLOCK(0x141e, 2);
+    // 141e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1420: br 1432
+    AOT_GOTO(0x1432, L1432);
+L1422:
+    AOT_BLOCK(0x1422, 4);
+    // 1422: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1424: add $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1428: mov $4255, -(sp)
+    {
+        src = uint16_t(0x4255);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 142c: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1430);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1430:
+    AOT_BLOCK(0x1430, 1);
+    // 1430: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1432, L1432);
+L1432:
+    AOT_BLOCK(0x1432, 2);
+    // 1432: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1436:
+    AOT_BLOCK(0x1436, 6);
+    // 1436: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x143a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 143a: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 143e: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1442: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1444: jsr pc, *$1474
+    {
+        a = 0x1474;
+        r[6] -= 2;
+        WR16(r[6], 0x1448);
+    }
+    AOT_GOTO(0x1474, L1474);
+L1448:
+    AOT_BLOCK(0x1448, 4);
+    // 1448: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 144a: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 144c: cmp $14, r3
+    {
+        src = uint16_t(0x0014);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1450: ble 146c
+    if (Z || (N ^ V))
+        AOT_GOTO(0x146c, L146c);
+    AOT_GOTO(0x1452, L1452);
+L1452:
+    AOT_BLOCK(0x1452, 2);
+    // 1452: cmp $1, 2(r4)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1458: bne 146c
+    if (!Z)
+        AOT_GOTO(0x146c, L146c);
+    AOT_GOTO(0x145a, L145a);
+L145a:
+    AOT_BLOCK(0x145a, 2);
+    // 145a: cmp $1, 6(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1460: bgt 1468
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1468, L1468);
+    AOT_GOTO(0x1462, L1462);
+L1462:
+    AOT_BLOCK(0x1462, 2);
+    // 1462: mov $14, r3
+    {
+        src = uint16_t(0x0014);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1466: br 146c
+    AOT_GOTO(0x146c, L146c);
+L1468:
+    AOT_BLOCK(0x1468, 1);
+    // 1468: mov $18, r3
+    {
+        src = uint16_t(0x0018);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x146c, L146c);
+L146c:
+    AOT_BLOCK(0x146c, 2);
+    // 146c: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 146e: br 1470
+    AOT_GOTO(0x1470, L1470);
+L1470:
+    AOT_BLOCK(0x1470, 2);
+    // 1470: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1474:
+    AOT_BLOCK(0x1474, 5);
+    // 1474: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1478;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1478: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 147c: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 147e: bne 1484
+    if (!Z)
+        AOT_GOTO(0x1484, L1484);
+    AOT_GOTO(0x1480, L1480);
+L1480:
+    AOT_BLOCK(0x1480, 2);
+    // 1480: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1482: br 1524
+    AOT_GOTO(0x1524, L1524);
+L1484:
+    AOT_BLOCK(0x1484, 2);
+    // 1484: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1486: br 14f4
+    AOT_GOTO(0x14f4, L14f4);
+L1488:
+    AOT_BLOCK(0x1488, 2);
+    // 1488: cmpb $e, 6(r4)
+    {
+        src = uint8_t(0x0e);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 148e: bne 1496
+    if (!Z)
+        AOT_GOTO(0x1496, L1496);
+    AOT_GOTO(0x1490, L1490);
+L1490:
+    AOT_BLOCK(0x1490, 2);
+    // 1490: mov $9, r0
+    {
+        src = uint16_t(0x0009);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1494: br 1524
+    AOT_GOTO(0x1524, L1524);
+L1496:
+    AOT_BLOCK(0x1496, 2);
+    // 1496: mov $c, r0
+    {
+        src = uint16_t(0x000c);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 149a: br 1524
+    AOT_GOTO(0x1524, L1524);
+L149c:
+    AOT_BLOCK(0x149c, 2);
+    // 149c: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 14a0: bne 14a8
+    if (!Z)
+        AOT_GOTO(0x14a8, L14a8);
+    AOT_GOTO(0x14a2, L14a2);
+L14a2:
+    AOT_BLOCK(0x14a2, 2);
+    // 14a2: mov $4, r0
+    {
+        src = uint16_t(0x0004);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14a6: br 1524
+    AOT_GOTO(0x1524, L1524);
+L14a8:
+    AOT_BLOCK(0x14a8, 2);
+    // 14a8: cmp $1, 6(r4)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[4] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14ae: bne 14b6
+    if (!Z)
+        AOT_GOTO(0x14b6, L14b6);
+    AOT_GOTO(0x14b0, L14b0);
+L14b0:
+    AOT_BLOCK(0x14b0, 2);
+    // 14b0: mov $5, r0
+    {
+        src = uint16_t(0x0005);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14b4: br 1524
+    AOT_GOTO(0x1524, L1524);
+L14b6:
+    AOT_BLOCK(0x14b6, 2);
+    // 14b6: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 14ba: ble 14c2
+    if (Z || (N ^ V))
+        AOT_GOTO(0x14c2, L14c2);
+    AOT_GOTO(0x14bc, L14bc);
+L14bc:
+    AOT_BLOCK(0x14bc, 2);
+    // 14bc: mov $8, r0
+    {
+        src = uint16_t(0x0008);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14c0: br 1524
+    AOT_GOTO(0x1524, L1524);
+L14c2:
+    AOT_BLOCK(0x14c2, 2);
+    // 14c2: mov $c, r0
+    {
+        src = uint16_t(0x000c);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14c6: br 1524
+    AOT_GOTO(0x1524, L1524);
+L14c8:
+    AOT_BLOCK(0x14c8, 3);
+    // 14c8: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 14cc: cmp $14, (r3)
+    {
+        src = uint16_t(0x0014);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14d0: beq 14e4
+    if (Z)
+        AOT_GOTO(0x14e4, L14e4);
+    AOT_GOTO(0x14d2, L14d2);
+L14d2:
+    AOT_BLOCK(0x14d2, 2);
+    // 14d2: cmp $15, (r3)
+    {
+        src = uint16_t(0x0015);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14d6: beq 14e4
+    if (Z)
+        AOT_GOTO(0x14e4, L14e4);
+    AOT_GOTO(0x14d8, L14d8);
+L14d8:
+    AOT_BLOCK(0x14d8, 2);
+    // 14d8: cmp $1b, (r3)
+    {
+        src = uint16_t(0x001b);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14dc: beq 14e4
+    if (Z)
+        AOT_GOTO(0x14e4, L14e4);
+    AOT_GOTO(0x14de, L14de);
+L14de:
+    AOT_BLOCK(0x14de, 2);
+    // 14de: cmp $1c, (r3)
+    {
+        src = uint16_t(0x001c);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14e2: bne 14f2
+    if (!Z)
+        AOT_GOTO(0x14f2, L14f2);
+    AOT_GOTO(0x14e4, L14e4);
+L14e4:
+    AOT_BLOCK(0x14e4, 2);
+    // 14e4: cmp $6, 2(r4)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14ea: beq 14f2
+    if (Z)
+        AOT_GOTO(0x14f2, L14f2);
+    AOT_GOTO(0x14ec, L14ec);
+L14ec:
+    AOT_BLOCK(0x14ec, 2);
+    // 14ec: mov $c, r0
+    {
+        src = uint16_t(0x000c);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14f0: br 1524
+    AOT_GOTO(0x1524, L1524);
+L14f2:
+    AOT_BLOCK(0x14f2, 1);
+    // 14f2: br 1504
+    AOT_GOTO(0x1504, L1504);
+L14f4:
+    AOT_BLOCK(0x14f4, 3);
+    // 14f4: sub $14, r0
+    {
+        src = uint16_t(0x0014);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 14f8: cmp r0, $10
+    {
+        src = r[0];
+        dst = uint16_t(0x0010);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14fc: bhi 1504
+    if (!(C | Z))
+        AOT_GOTO(0x1504, L1504);
+    AOT_GOTO(0x14fe, L14fe);
+L14fe:
+    AOT_BLOCK(0x14fe, 2);
+    // 14fe: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 1500: jmp *3fc8(r0)
+    {
+        a = RD16(r[0] + 16328);
+    }
+    AOT_JUMP(a);
+L1504:
+    AOT_BLOCK(0x1504, 2);
+    // 1504: cmp $6, 2(r4)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 150a: bne 1510
+    if (!Z)
+        AOT_GOTO(0x1510, L1510);
+    AOT_GOTO(0x150c, L150c);
+L150c:
+    AOT_BLOCK(0x150c, 1);
+    // 150c: dec 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x1510, L1510);
+L1510:
+    AOT_BLOCK(0x1510, 2);
+    // 1510: cmp 6(r5), 4(r4)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1516: blt 151e
+    if (N ^ V)
+        AOT_GOTO(0x151e, L151e);
+    AOT_GOTO(0x1518, L1518);
+L1518:
+    AOT_BLOCK(0x1518, 2);
+    // 1518: mov $14, r0
+    {
+        src = uint16_t(0x0014);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 151c: br 1522
+    AOT_GOTO(0x1522, L1522);
+L151e:
+    AOT_BLOCK(0x151e, 1);
+    // 151e: mov $18, r0
+    {
+        src = uint16_t(0x0018);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1522, L1522);
+L1522:
+    AOT_BLOCK(0x1522, 1);
+    // 1522: br 1524
+    AOT_GOTO(0x1524, L1524);
+L1524:
+    AOT_BLOCK(0x1524, 2);
+    // 1524: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1528:
+    AOT_BLOCK(0x1528, 7);
+    // 1528: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x152c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 152c: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1530: mov 2(r2), r4
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1534: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1538: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 153a: bne 1552
+    if (!Z)
+        AOT_GOTO(0x1552, L1552);
+    AOT_GOTO(0x153c, L153c);
+L153c:
+    AOT_BLOCK(0x153c, 2);
+    // 153c: cmp $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1540: bge 1548
+    if (!(N ^ V))
+        AOT_GOTO(0x1548, L1548);
+    AOT_GOTO(0x1542, L1542);
+L1542:
+    AOT_BLOCK(0x1542, 2);
+    // 1542: cmp $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1546: bgt 154c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x154c, L154c);
+    AOT_GOTO(0x1548, L1548);
+L1548:
+    AOT_BLOCK(0x1548, 2);
+    // 1548: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 154a: br 1550
+    AOT_GOTO(0x1550, L1550);
+L154c:
+    AOT_BLOCK(0x154c, 1);
+    // 154c: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1550, L1550);
+L1550:
+    AOT_BLOCK(0x1550, 1);
+    // 1550: br 15c6
+    AOT_GOTO(0x15c6, L15c6);
+L1552:
+    AOT_BLOCK(0x1552, 2);
+    // 1552: cmp $1, r3
+    {
+        src = uint16_t(0x0001);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1556: bne 156c
+    if (!Z)
+        AOT_GOTO(0x156c, L156c);
+    AOT_GOTO(0x1558, L1558);
+L1558:
+    AOT_BLOCK(0x1558, 2);
+    // 1558: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 155a: ble 1562
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1562, L1562);
+    AOT_GOTO(0x155c, L155c);
+L155c:
+    AOT_BLOCK(0x155c, 2);
+    // 155c: cmp $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1560: bgt 1566
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1566, L1566);
+    AOT_GOTO(0x1562, L1562);
+L1562:
+    AOT_BLOCK(0x1562, 2);
+    // 1562: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1564: br 156a
+    AOT_GOTO(0x156a, L156a);
+L1566:
+    AOT_BLOCK(0x1566, 1);
+    // 1566: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x156a, L156a);
+L156a:
+    AOT_BLOCK(0x156a, 1);
+    // 156a: br 15c6
+    AOT_GOTO(0x15c6, L15c6);
+L156c:
+    AOT_BLOCK(0x156c, 3);
+    // 156c: sub $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        C = dst < src;
+    }
+    // 1570: bit $ffe0, r4
+    {
+        src = uint16_t(0xffe0);
+        dst = r[4];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1574: beq 157a
+    if (Z)
+        AOT_GOTO(0x157a, L157a);
+    AOT_GOTO(0x1576, L1576);
+L1576:
+    AOT_BLOCK(0x1576, 1);
+    // 1576: mov $10, r4
+    {
+        src = uint16_t(0x0010);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x157a, L157a);
+L157a:
+    AOT_BLOCK(0x157a, 2);
+    // 157a: bit $fff8, r4
+    {
+        src = uint16_t(0xfff8);
+        dst = r[4];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 157e: beq 1588
+    if (Z)
+        AOT_GOTO(0x1588, L1588);
+    AOT_GOTO(0x1580, L1580);
+L1580:
+    AOT_BLOCK(0x1580, 2);
+    // 1580: bic $fff8, r4
+    {
+        src = uint16_t(0xfff8);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 1584: bis $10, r4
+    {
+        src = uint16_t(0x0010);
+        dst = r[4];
+        val = src | dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x1588, L1588);
+L1588:
+    AOT_BLOCK(0x1588, 2);
+    // 1588: cmp $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 158c: bne 1598
+    if (!Z)
+        AOT_GOTO(0x1598, L1598);
+    AOT_GOTO(0x158e, L158e);
+L158e:
+    AOT_BLOCK(0x158e, 2);
+    // 158e: cmp $3, r4
+    {
+        src = uint16_t(0x0003);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1592: bne 1598
+    if (!Z)
+        AOT_GOTO(0x1598, L1598);
+    AOT_GOTO(0x1594, L1594);
+L1594:
+    AOT_BLOCK(0x1594, 1);
+    // 1594: mov $2, r4
+    {
+        src = uint16_t(0x0002);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1598, L1598);
+L1598:
+    AOT_BLOCK(0x1598, 2);
+    // 1598: cmp $14, (r2)
+    {
+        src = uint16_t(0x0014);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 159c: bne 15b8
+    if (!Z)
+        AOT_GOTO(0x15b8, L15b8);
+    AOT_GOTO(0x159e, L159e);
+L159e:
+    AOT_BLOCK(0x159e, 2);
+    // 159e: cmpb $e, 6(r2)
+    {
+        src = uint8_t(0x0e);
+        b = uint16_t(r[2] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 15a4: bne 15b8
+    if (!Z)
+        AOT_GOTO(0x15b8, L15b8);
+    AOT_GOTO(0x15a6, L15a6);
+L15a6:
+    AOT_BLOCK(0x15a6, 2);
+    // 15a6: cmp $50, 8(r5)
+    {
+        src = uint16_t(0x0050);
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 15ac: bne 15b8
+    if (!Z)
+        AOT_GOTO(0x15b8, L15b8);
+    AOT_GOTO(0x15ae, L15ae);
+L15ae:
+    AOT_BLOCK(0x15ae, 2);
+    // 15ae: cmp $1, r3
+    {
+        src = uint16_t(0x0001);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 15b2: bne 15b8
+    if (!Z)
+        AOT_GOTO(0x15b8, L15b8);
+    AOT_GOTO(0x15b4, L15b4);
+L15b4:
+    AOT_BLOCK(0x15b4, 2);
+    // 15b4: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 15b6: br 15c6
+    AOT_GOTO(0x15c6, L15c6);
+L15b8:
+    AOT_BLOCK(0x15b8, 2);
+    // 15b8: cmp r4, r3
+    {
+        src = r[4];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 15ba: bne 15c0
+    if (!Z)
+        AOT_GOTO(0x15c0, L15c0);
+    AOT_GOTO(0x15bc, L15bc);
+L15bc:
+    AOT_BLOCK(0x15bc, 2);
+    // 15bc: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 15be: br 15c4
+    AOT_GOTO(0x15c4, L15c4);
+L15c0:
+    AOT_BLOCK(0x15c0, 1);
+    // 15c0: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15c4, L15c4);
+L15c4:
+    AOT_BLOCK(0x15c4, 1);
+    // 15c4: br 15c6
+    AOT_GOTO(0x15c6, L15c6);
+L15c6:
+    AOT_BLOCK(0x15c6, 2);
+    // 15c6: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L15ca:
+    AOT_BLOCK(0x15ca, 2);
+    // 15ca: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x15ce;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x15ce, L15ce);
+L15ce:
+    AOT_BLOCK(0x15ce, 1);
+    // 15ce: mov 8(r5), r4
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15d2, L15d2);
+L15d2:
+    AOT_BLOCK(0x15d2, 2);
+    // 15d2: tst (r4)
+    {
+        a = r[4];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 15d4: beq 1606
+    if (Z)
+        AOT_GOTO(0x1606, L1606);
+    AOT_GOTO(0x15d6, L15d6);
+L15d6:
+    AOT_BLOCK(0x15d6, 2);
+    // 15d6: cmp 4(r5), (r4)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 15da: bne 1600
+    if (!Z)
+        AOT_GOTO(0x1600, L1600);
+    AOT_GOTO(0x15dc, L15dc);
+L15dc:
+    AOT_BLOCK(0x15dc, 2);
+    // 15dc: tst 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 15e0: beq 15e8
+    if (Z)
+        AOT_GOTO(0x15e8, L15e8);
+    AOT_GOTO(0x15e2, L15e2);
+L15e2:
+    AOT_BLOCK(0x15e2, 2);
+    // 15e2: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15e6: br 15ec
+    AOT_GOTO(0x15ec, L15ec);
+L15e8:
+    AOT_BLOCK(0x15e8, 1);
+    // 15e8: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15ec, L15ec);
+L15ec:
+    AOT_BLOCK(0x15ec, 3);
+    // 15ec: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 15ee: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 15f0: beq 1606
+    if (Z)
+        AOT_GOTO(0x1606, L1606);
+    AOT_GOTO(0x15f2, L15f2);
+L15f2:
+    AOT_BLOCK(0x15f2, 3);
+    // 15f2: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15f4: mov $425b, -(sp)
+    {
+        src = uint16_t(0x425b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15f8: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x15fc);
+    }
+    AOT_GOTO(0x396a, L396a);
+L15fc:
+    AOT_BLOCK(0x15fc, 2);
+    // 15fc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 15fe: br 1614
+    AOT_GOTO(0x1614, L1614);
+L1600:
+    AOT_BLOCK(0x1600, 2);
+    // 1600: add $6, r4
+    {
+        src = uint16_t(0x0006);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1604: br 15d2
+    AOT_GOTO(0x15d2, L15d2);
+L1606:
+    AOT_BLOCK(0x1606, 3);
+    // 1606: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 160a: mov $425e, -(sp)
+    {
+        src = uint16_t(0x425e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 160e: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x1612);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L1612:
+    AOT_BLOCK(0x1612, 1);
+    // 1612: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1614, L1614);
+L1614:
+    AOT_BLOCK(0x1614, 2);
+    // 1614: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1618:
+    AOT_BLOCK(0x1618, 5);
+    // 1618: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x161c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 161c: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1620: cmp $24, (r3)
+    {
+        src = uint16_t(0x0024);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1624: bne 162a
+    if (!Z)
+        AOT_GOTO(0x162a, L162a);
+    AOT_GOTO(0x1626, L1626);
+L1626:
+    AOT_BLOCK(0x1626, 1);
+    // 1626: mov 6(r3), r3
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x162a, L162a);
+L162a:
+    AOT_BLOCK(0x162a, 2);
+    // 162a: cmp $28, (r3)
+    {
+        src = uint16_t(0x0028);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 162e: bne 1646
+    if (!Z)
+        AOT_GOTO(0x1646, L1646);
+    AOT_GOTO(0x1630, L1630);
+L1630:
+    AOT_BLOCK(0x1630, 3);
+    // 1630: mov *8(r3), r4
+    {
+        a = RD16(r[3] + 8);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1634: cmp $15, r4
+    {
+        src = uint16_t(0x0015);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1638: beq 1640
+    if (Z)
+        AOT_GOTO(0x1640, L1640);
+    AOT_GOTO(0x163a, L163a);
+L163a:
+    AOT_BLOCK(0x163a, 2);
+    // 163a: cmp $23, r4
+    {
+        src = uint16_t(0x0023);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 163e: bne 1646
+    if (!Z)
+        AOT_GOTO(0x1646, L1646);
+    AOT_GOTO(0x1640, L1640);
+L1640:
+    AOT_BLOCK(0x1640, 2);
+    // 1640: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1644: br 164a
+    AOT_GOTO(0x164a, L164a);
+L1646:
+    AOT_BLOCK(0x1646, 2);
+    // 1646: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1648: br 164a
+    AOT_GOTO(0x164a, L164a);
+L164a:
+    AOT_BLOCK(0x164a, 2);
+    // 164a: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L164e:
+    AOT_BLOCK(0x164e, 7);
+    // 164e: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1652;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1652: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1656: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1658: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 165a: bit $4, 4568(r0)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1660: beq 1666
+    if (Z)
+        AOT_GOTO(0x1666, L1666);
+    AOT_GOTO(0x1662, L1662);
+L1662:
+    AOT_BLOCK(0x1662, 1);
+    // 1662: mov 6(r4), r4
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1666, L1666);
+L1666:
+    AOT_BLOCK(0x1666, 2);
+    // 1666: cmp $2, 2(r4)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 166c: beq 1676
+    if (Z)
+        AOT_GOTO(0x1676, L1676);
+    AOT_GOTO(0x166e, L166e);
+L166e:
+    AOT_BLOCK(0x166e, 2);
+    // 166e: cmp $3, 2(r4)
+    {
+        src = uint16_t(0x0003);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1674: bne 1682
+    if (!Z)
+        AOT_GOTO(0x1682, L1682);
+    AOT_GOTO(0x1676, L1676);
+L1676:
+    AOT_BLOCK(0x1676, 3);
+    // 1676: mov $1, 59f4
+    {
+        src = uint16_t(0x0001);
+        b = 0x59f4;
+        WR16(b, src);
+    }
+    // 167c: mov $66, r0
+    {
+        src = uint16_t(0x0066);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1680: br 1686
+    AOT_GOTO(0x1686, L1686);
+L1682:
+    AOT_BLOCK(0x1682, 2);
+    // 1682: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1684: br 1686
+    AOT_GOTO(0x1686, L1686);
+L1686:
+    AOT_BLOCK(0x1686, 2);
+    // 1686: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L168a:
+    AOT_BLOCK(0x168a, 5);
+    // 168a: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x168e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 168e: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1692: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1696: jsr pc, *$164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x169a);
+    }
+    AOT_GOTO(0x164e, L164e);
+L169a:
+    AOT_BLOCK(0x169a, 2);
+    // 169a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 169c: bne 16c0
+    if (!Z)
+        AOT_GOTO(0x16c0, L16c0);
+    AOT_GOTO(0x169e, L169e);
+L169e:
+    AOT_BLOCK(0x169e, 2);
+    // 169e: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16a2: br 16b0
+    AOT_GOTO(0x16b0, L16b0);
+L16a4:
+    AOT_BLOCK(0x16a4, 1);
+    // 16a4: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x16a6, L16a6);
+L16a6:
+    AOT_BLOCK(0x16a6, 3);
+    // 16a6: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 16a8: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 16ac: br 16c4
+    AOT_GOTO(0x16c4, L16c4);
+L16b0:
+    AOT_BLOCK(0x16b0, 2);
+    // 16b0: mov $3fea, r1
+    {
+        src = uint16_t(0x3fea);
+        r[1] = src;
+    }
+    // 16b4: mov r0, 3ff6
+    {
+        src = r[0];
+        b = 0x3ff6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x16b8, L16b8);
+L16b8:
+    AOT_BLOCK(0x16b8, 2);
+    // 16b8: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 16ba: bne 16b8
+    if (!Z)
+        AOT_GOTO(0x16b8, L16b8);
+    AOT_GOTO(0x16bc, L16bc);
+L16bc:
+    AOT_BLOCK(0x16bc, 1);
+    // 16bc: jmp *c(r1)
+    {
+        a = RD16(r[1] + 12);
+    }
+    AOT_JUMP(a);
+L16c0:
+    AOT_BLOCK(0x16c0, 2);
+    // 16c0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16c2: br 16c4
+    AOT_GOTO(0x16c4, L16c4);
+L16c4:
+    AOT_BLOCK(0x16c4, 2);
+    // 16c4: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L16c8:
+    AOT_BLOCK(0x16c8, 4);
+    // 16c8: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x16cc;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 16cc: cmp $8, 4(r5)
+    {
+        src = uint16_t(0x0008);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 16d2: bgt 16da
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x16da, L16da);
+    AOT_GOTO(0x16d4, L16d4);
+L16d4:
+    AOT_BLOCK(0x16d4, 2);
+    // 16d4: mov $2, r0
+    {
+        src = uint16_t(0x0002);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16d8: br 1706
+    AOT_GOTO(0x1706, L1706);
+L16da:
+    AOT_BLOCK(0x16da, 2);
+    // 16da: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16de: br 16f4
+    AOT_GOTO(0x16f4, L16f4);
+L16e0:
+    AOT_BLOCK(0x16e0, 2);
+    // 16e0: mov $2, r0
+    {
+        src = uint16_t(0x0002);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16e4: br 1706
+    AOT_GOTO(0x1706, L1706);
+L16e6:
+    AOT_BLOCK(0x16e6, 2);
+    // 16e6: mov $4, r0
+    {
+        src = uint16_t(0x0004);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16ea: br 1706
+    AOT_GOTO(0x1706, L1706);
+L16ec:
+    AOT_BLOCK(0x16ec, 2);
+    // 16ec: mov $8, r0
+    {
+        src = uint16_t(0x0008);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16f0: br 1706
+    AOT_GOTO(0x1706, L1706);
+L16f4:
+    AOT_BLOCK(0x16f4, 2);
+    // 16f4: cmp r0, $6
+    {
+        src = r[0];
+        dst = uint16_t(0x0006);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 16f8: bhi 1700
+    if (!(C | Z))
+        AOT_GOTO(0x1700, L1700);
+    AOT_GOTO(0x16fa, L16fa);
+L16fa:
+    AOT_BLOCK(0x16fa, 2);
+    // 16fa: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 16fc: jmp *4006(r0)
+    {
+        a = RD16(r[0] + 16390);
+    }
+    AOT_JUMP(a);
+L1700:
+    AOT_BLOCK(0x1700, 2);
+    // 1700: mov $400, r0
+    {
+        src = uint16_t(0x0400);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1704: br 1706
+    AOT_GOTO(0x1706, L1706);
+L1706:
+    AOT_BLOCK(0x1706, 2);
+    // 1706: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L170a:
+    AOT_BLOCK(0x170a, 7);
+    // 170a: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x170e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 170e: sub $1a0, sp
+    {
+        src = uint16_t(0x01a0);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1712: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1716: mov 6(r5), r2
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 171a: cmp r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 171c: bne 1730
+    if (!Z)
+        AOT_GOTO(0x1730, L1730);
+    AOT_GOTO(0x171e, L171e);
+L171e:
+    AOT_BLOCK(0x171e, 3);
+    // 171e: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1722: mov $4272, -(sp)
+    {
+        src = uint16_t(0x4272);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1726: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x172a);
+    }
+    AOT_GOTO(0x396a, L396a);
+L172a:
+    AOT_BLOCK(0x172a, 2);
+    // 172a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 172c: jmp *$1a70
+    {
+        a = 0x1a70;
+    }
+    AOT_GOTO(0x1a70, L1a70);
+L1730:
+    AOT_BLOCK(0x1730, 5);
+    // 1730: mov 3cec, -8(r5)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1736: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 173a: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 173c: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 173e: jsr pc, *$1a74
+    {
+        a = 0x1a74;
+        r[6] -= 2;
+        WR16(r[6], 0x1742);
+    }
+    AOT_GOTO(0x1a74, L1a74);
+L1742:
+    AOT_BLOCK(0x1742, 3);
+    // 1742: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1744: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1746: beq 174c
+    if (Z)
+        AOT_GOTO(0x174c, L174c);
+    AOT_GOTO(0x1748, L1748);
+L1748:
+    AOT_BLOCK(0x1748, 1);
+    // 1748: jmp *$1a70
+    {
+        a = 0x1a70;
+    }
+    AOT_GOTO(0x1a70, L1a70);
+L174c:
+    AOT_BLOCK(0x174c, 10);
+    // 174c: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 174e: sub r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 1750: ash $fffe, r0
+    {
+        src = uint16_t(0xfffe) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1754: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1758: sub $4, r2
+    {
+        src = uint16_t(0x0004);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+    }
+    // 175c: mov 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1760: sub 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1764: mov r0, -16(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -22);
+        WR16(b, src);
+    }
+    // 1768: tst -16(r5)
+    {
+        a = uint16_t(r[5] + -22);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 176c: ble 17f0
+    if (Z || (N ^ V))
+        AOT_GOTO(0x17f0, L17f0);
+    AOT_GOTO(0x176e, L176e);
+L176e:
+    AOT_BLOCK(0x176e, 4);
+    // 176e: mov -a(r5), r1
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1772: mul $3, r1
+    {
+        src = int16_t(uint16_t(0x0003));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1776: cmp -16(r5), r1
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 177a: bgt 17f0
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x17f0, L17f0);
+    AOT_GOTO(0x177c, L177c);
+L177c:
+    AOT_BLOCK(0x177c, 2);
+    // 177c: tst 2(r3)
+    {
+        a = uint16_t(r[3] + 2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1780: beq 1790
+    if (Z)
+        AOT_GOTO(0x1790, L1790);
+    AOT_GOTO(0x1782, L1782);
+L1782:
+    AOT_BLOCK(0x1782, 3);
+    // 1782: mov 2(r3), (sp)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1786: mov $427b, -(sp)
+    {
+        src = uint16_t(0x427b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 178a: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x178e);
+    }
+    AOT_GOTO(0x396a, L396a);
+L178e:
+    AOT_BLOCK(0x178e, 1);
+    // 178e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1790, L1790);
+L1790:
+    AOT_BLOCK(0x1790, 6);
+    // 1790: mov 3cec, (sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1794: mov 3cec, -(sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1798: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 179c: mov -16(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17a0: mov $4014, -(sp)
+    {
+        src = uint16_t(0x4014);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17a4: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x17a8);
+    }
+    AOT_GOTO(0x396a, L396a);
+L17a8:
+    AOT_BLOCK(0x17a8, 3);
+    // 17a8: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 17ac: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 17b0: mov 2(r3), -c(r5)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17b6, L17b6);
+L17b6:
+    AOT_BLOCK(0x17b6, 2);
+    // 17b6: cmp 2(r2), -c(r5)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17bc: blt 17ec
+    if (N ^ V)
+        AOT_GOTO(0x17ec, L17ec);
+    AOT_GOTO(0x17be, L17be);
+L17be:
+    AOT_BLOCK(0x17be, 2);
+    // 17be: cmp 2(r3), -c(r5)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17c4: bne 17d8
+    if (!Z)
+        AOT_GOTO(0x17d8, L17d8);
+    AOT_GOTO(0x17c6, L17c6);
+L17c6:
+    AOT_BLOCK(0x17c6, 3);
+    // 17c6: mov (r3), (sp)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17c8: mov $4287, -(sp)
+    {
+        src = uint16_t(0x4287);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17cc: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x17d0);
+    }
+    AOT_GOTO(0x396a, L396a);
+L17d0:
+    AOT_BLOCK(0x17d0, 3);
+    // 17d0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 17d2: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 17d6: br 17e6
+    AOT_GOTO(0x17e6, L17e6);
+L17d8:
+    AOT_BLOCK(0x17d8, 3);
+    // 17d8: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17dc: mov $428c, -(sp)
+    {
+        src = uint16_t(0x428c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17e0: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x17e4);
+    }
+    AOT_GOTO(0x396a, L396a);
+L17e4:
+    AOT_BLOCK(0x17e4, 1);
+    // 17e4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x17e6, L17e6);
+L17e6:
+    AOT_BLOCK(0x17e6, 2);
+    // 17e6: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 17ea: br 17b6
+    AOT_GOTO(0x17b6, L17b6);
+L17ec:
+    AOT_BLOCK(0x17ec, 1);
+    // 17ec: jmp *$1a68
+    {
+        a = 0x1a68;
+    }
+    AOT_GOTO(0x1a68, L1a68);
+L17f0:
+    AOT_BLOCK(0x17f0, 2);
+    // 17f0: cmp $8, -a(r5)
+    {
+        src = uint16_t(0x0008);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17f6: ble 188a
+    if (Z || (N ^ V))
+        AOT_GOTO(0x188a, L188a);
+    AOT_GOTO(0x17f8, L17f8);
+L17f8:
+    AOT_BLOCK(0x17f8, 13);
+    // 17f8: mov 3cec, -c(r5)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 17fe: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1802: mov 3cec, -e(r5)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 1808: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 180c: mov -c(r5), (sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1810: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1814: mov -e(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1818: mov 3cec, -(sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 181c: mov 3cec, -(sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1820: mov -e(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1824: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1828: mov $4046, -(sp)
+    {
+        src = uint16_t(0x4046);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 182c: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1830);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1830:
+    AOT_BLOCK(0x1830, 2);
+    // 1830: add $e, sp
+    {
+        src = uint16_t(0x000e);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1834: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1838, L1838);
+L1838:
+    AOT_BLOCK(0x1838, 2);
+    // 1838: cmp r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 183a: bcs 1850
+    if (C)
+        AOT_GOTO(0x1850, L1850);
+    AOT_GOTO(0x183c, L183c);
+L183c:
+    AOT_BLOCK(0x183c, 3);
+    // 183c: mov 2(r3), (sp)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1840: mov $4291, -(sp)
+    {
+        src = uint16_t(0x4291);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1844: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1848);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1848:
+    AOT_BLOCK(0x1848, 3);
+    // 1848: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 184a: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 184e: br 1838
+    AOT_GOTO(0x1838, L1838);
+L1850:
+    AOT_BLOCK(0x1850, 3);
+    // 1850: mov -e(r5), (sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1854: mov $4295, -(sp)
+    {
+        src = uint16_t(0x4295);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1858: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x185c);
+    }
+    AOT_GOTO(0x396a, L396a);
+L185c:
+    AOT_BLOCK(0x185c, 2);
+    // 185c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 185e: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1862, L1862);
+L1862:
+    AOT_BLOCK(0x1862, 2);
+    // 1862: cmp r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1864: bcs 1878
+    if (C)
+        AOT_GOTO(0x1878, L1878);
+    AOT_GOTO(0x1866, L1866);
+L1866:
+    AOT_BLOCK(0x1866, 3);
+    // 1866: mov (r3), (sp)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1868: mov $429d, -(sp)
+    {
+        src = uint16_t(0x429d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 186c: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1870);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1870:
+    AOT_BLOCK(0x1870, 3);
+    // 1870: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1872: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1876: br 1862
+    AOT_GOTO(0x1862, L1862);
+L1878:
+    AOT_BLOCK(0x1878, 3);
+    // 1878: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 187c: mov $42a2, -(sp)
+    {
+        src = uint16_t(0x42a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1880: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1884);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1884:
+    AOT_BLOCK(0x1884, 2);
+    // 1884: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1886: jmp *$1a68
+    {
+        a = 0x1a68;
+    }
+    AOT_GOTO(0x1a68, L1a68);
+L188a:
+    AOT_BLOCK(0x188a, 4);
+    // 188a: mov $7fff, -14(r5)
+    {
+        src = uint16_t(0x7fff);
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+    }
+    // 1890: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1894: ash $fffe, r0
+    {
+        src = uint16_t(0xfffe) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1898: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x189c, L189c);
+L189c:
+    AOT_BLOCK(0x189c, 4);
+    // 189c: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 18a0: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+    }
+    // 18a2: cmp -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18a6: bgt 1944
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1944, L1944);
+    AOT_GOTO(0x18a8, L18a8);
+L18a8:
+    AOT_BLOCK(0x18a8, 1);
+    // 18a8: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x18ac, L18ac);
+L18ac:
+    AOT_BLOCK(0x18ac, 2);
+    // 18ac: cmp -c(r5), -e(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18b2: ble 18c6
+    if (Z || (N ^ V))
+        AOT_GOTO(0x18c6, L18c6);
+    AOT_GOTO(0x18b4, L18b4);
+L18b4:
+    AOT_BLOCK(0x18b4, 6);
+    // 18b4: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 18b8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 18ba: add r5, r0
+    {
+        src = r[5];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 18bc: clr -1a6(r0)
+    {
+        a = uint16_t(r[0] + -422);
+        WR16(a, 0);
+        C = false;
+    }
+    // 18c0: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 18c4: br 18ac
+    AOT_GOTO(0x18ac, L18ac);
+L18c6:
+    AOT_BLOCK(0x18c6, 1);
+    // 18c6: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x18c8, L18c8);
+L18c8:
+    AOT_BLOCK(0x18c8, 2);
+    // 18c8: cmp r2, r4
+    {
+        src = r[2];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18ca: bcs 18ea
+    if (C)
+        AOT_GOTO(0x18ea, L18ea);
+    AOT_GOTO(0x18cc, L18cc);
+L18cc:
+    AOT_BLOCK(0x18cc, 4);
+    // 18cc: mov -c(r5), (sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 18d0: mov 2(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 18d4: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 18d6: jsr pc, *$3cae
+    {
+        a = 0x3cae;
+        r[6] -= 2;
+        WR16(r[6], 0x18da);
+    }
+    AOT_GOTO(0x3cae, L3cae);
+L18da:
+    AOT_BLOCK(0x18da, 6);
+    // 18da: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 18dc: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 18de: add r5, r0
+    {
+        src = r[5];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 18e0: inc -1a6(r0)
+    {
+        a = uint16_t(r[0] + -422);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 18e4: add $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 18e8: br 18c8
+    AOT_GOTO(0x18c8, L18c8);
+L18ea:
+    AOT_BLOCK(0x18ea, 2);
+    // 18ea: clr -12(r5)
+    {
+        a = uint16_t(r[5] + -18);
+        WR16(a, 0);
+    }
+    // 18ee: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x18f2, L18f2);
+L18f2:
+    AOT_BLOCK(0x18f2, 2);
+    // 18f2: cmp -c(r5), -e(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18f8: ble 191e
+    if (Z || (N ^ V))
+        AOT_GOTO(0x191e, L191e);
+    AOT_GOTO(0x18fa, L18fa);
+L18fa:
+    AOT_BLOCK(0x18fa, 5);
+    // 18fa: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 18fe: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1900: add r5, r0
+    {
+        src = r[5];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1902: cmp -12(r5), -1a6(r0)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = uint16_t(r[0] + -422);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1908: bge 1918
+    if (!(N ^ V))
+        AOT_GOTO(0x1918, L1918);
+    AOT_GOTO(0x190a, L190a);
+L190a:
+    AOT_BLOCK(0x190a, 4);
+    // 190a: mov -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 190e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1910: add r5, r0
+    {
+        src = r[5];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1912: mov -1a6(r0), -12(r5)
+    {
+        a = uint16_t(r[0] + -422);
+        src = RD16(a);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1918, L1918);
+L1918:
+    AOT_BLOCK(0x1918, 2);
+    // 1918: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 191c: br 18f2
+    AOT_GOTO(0x18f2, L18f2);
+L191e:
+    AOT_BLOCK(0x191e, 4);
+    // 191e: mov -c(r5), r1
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1922: mul -12(r5), r1
+    {
+        a = uint16_t(r[5] + -18);
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1926: cmp -14(r5), r1
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 192a: ble 193e
+    if (Z || (N ^ V))
+        AOT_GOTO(0x193e, L193e);
+    AOT_GOTO(0x192c, L192c);
+L192c:
+    AOT_BLOCK(0x192c, 4);
+    // 192c: mov -c(r5), -10(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+    }
+    // 1932: mov -c(r5), r1
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1936: mul -12(r5), r1
+    {
+        a = uint16_t(r[5] + -18);
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 193a: mov r1, -14(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x193e, L193e);
+L193e:
+    AOT_BLOCK(0x193e, 2);
+    // 193e: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1942: br 189c
+    AOT_GOTO(0x189c, L189c);
+L1944:
+    AOT_BLOCK(0x1944, 14);
+    // 1944: mov 3cec, -c(r5)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 194a: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 194e: mov 3cec, (sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1952: mov 3cec, -(sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1956: inc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1958: mov 3cec, -(sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 195c: add -10(r5), (sp)
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1960: inc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1962: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1966: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 196a: mov 3cec, -(sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 196e: mov -10(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1972: mov $4092, -(sp)
+    {
+        src = uint16_t(0x4092);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1976: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x197a);
+    }
+    AOT_GOTO(0x396a, L396a);
+L197a:
+    AOT_BLOCK(0x197a, 3);
+    // 197a: add $e, sp
+    {
+        src = uint16_t(0x000e);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 197e: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1982: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1986, L1986);
+L1986:
+    AOT_BLOCK(0x1986, 2);
+    // 1986: cmp -10(r5), -c(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 198c: blt 19a6
+    if (N ^ V)
+        AOT_GOTO(0x19a6, L19a6);
+    AOT_GOTO(0x198e, L198e);
+L198e:
+    AOT_BLOCK(0x198e, 4);
+    // 198e: mov 3cec, (sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1992: add -c(r5), (sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1996: mov $42a7, -(sp)
+    {
+        src = uint16_t(0x42a7);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 199a: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x199e);
+    }
+    AOT_GOTO(0x396a, L396a);
+L199e:
+    AOT_BLOCK(0x199e, 3);
+    // 199e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 19a0: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 19a4: br 1986
+    AOT_GOTO(0x1986, L1986);
+L19a6:
+    AOT_BLOCK(0x19a6, 1);
+    // 19a6: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x19aa, L19aa);
+L19aa:
+    AOT_BLOCK(0x19aa, 2);
+    // 19aa: cmp -10(r5), -c(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 19b0: ble 1a08
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1a08, L1a08);
+    AOT_GOTO(0x19b2, L19b2);
+L19b2:
+    AOT_BLOCK(0x19b2, 4);
+    // 19b2: mov 3cec, (sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19b6: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 19ba: mov $42ac, -(sp)
+    {
+        src = uint16_t(0x42ac);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19be: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x19c2);
+    }
+    AOT_GOTO(0x396a, L396a);
+L19c2:
+    AOT_BLOCK(0x19c2, 2);
+    // 19c2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 19c4: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x19c6, L19c6);
+L19c6:
+    AOT_BLOCK(0x19c6, 2);
+    // 19c6: cmp r2, r4
+    {
+        src = r[2];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 19c8: bcs 1a02
+    if (C)
+        AOT_GOTO(0x1a02, L1a02);
+    AOT_GOTO(0x19ca, L19ca);
+L19ca:
+    AOT_BLOCK(0x19ca, 4);
+    // 19ca: mov -10(r5), (sp)
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19ce: mov 2(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19d2: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 19d4: jsr pc, *$3cae
+    {
+        a = 0x3cae;
+        r[6] -= 2;
+        WR16(r[6], 0x19d8);
+    }
+    AOT_GOTO(0x3cae, L3cae);
+L19d8:
+    AOT_BLOCK(0x19d8, 3);
+    // 19d8: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 19da: cmp -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 19de: bne 19fc
+    if (!Z)
+        AOT_GOTO(0x19fc, L19fc);
+    AOT_GOTO(0x19e0, L19e0);
+L19e0:
+    AOT_BLOCK(0x19e0, 4);
+    // 19e0: mov -10(r5), (sp)
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19e4: mov 2(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19e8: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 19ea: jsr pc, *$3c9c
+    {
+        a = 0x3c9c;
+        r[6] -= 2;
+        WR16(r[6], 0x19ee);
+    }
+    AOT_GOTO(0x3c9c, L3c9c);
+L19ee:
+    AOT_BLOCK(0x19ee, 4);
+    // 19ee: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 19f0: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19f2: mov $42b4, -(sp)
+    {
+        src = uint16_t(0x42b4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19f6: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x19fa);
+    }
+    AOT_GOTO(0x396a, L396a);
+L19fa:
+    AOT_BLOCK(0x19fa, 1);
+    // 19fa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x19fc, L19fc);
+L19fc:
+    AOT_BLOCK(0x19fc, 2);
+    // 19fc: add $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1a00: br 19c6
+    AOT_GOTO(0x19c6, L19c6);
+L1a02:
+    AOT_BLOCK(0x1a02, 2);
+    // 1a02: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1a06: br 19aa
+    AOT_GOTO(0x19aa, L19aa);
+L1a08:
+    AOT_BLOCK(0x1a08, 4);
+    // 1a08: mov 3cec, (sp)
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a0c: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1a10: mov $42b8, -(sp)
+    {
+        src = uint16_t(0x42b8);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a14: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1a18);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1a18:
+    AOT_BLOCK(0x1a18, 2);
+    // 1a18: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1a1a: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1a1e, L1a1e);
+L1a1e:
+    AOT_BLOCK(0x1a1e, 2);
+    // 1a1e: cmp -10(r5), -c(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a24: ble 1a68
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1a68, L1a68);
+    AOT_GOTO(0x1a26, L1a26);
+L1a26:
+    AOT_BLOCK(0x1a26, 3);
+    // 1a26: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a2a: mov $42bd, -(sp)
+    {
+        src = uint16_t(0x42bd);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a2e: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1a32);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1a32:
+    AOT_BLOCK(0x1a32, 2);
+    // 1a32: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1a34: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a36, L1a36);
+L1a36:
+    AOT_BLOCK(0x1a36, 2);
+    // 1a36: cmp r2, r4
+    {
+        src = r[2];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a38: bcs 1a62
+    if (C)
+        AOT_GOTO(0x1a62, L1a62);
+    AOT_GOTO(0x1a3a, L1a3a);
+L1a3a:
+    AOT_BLOCK(0x1a3a, 4);
+    // 1a3a: mov -10(r5), (sp)
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a3e: mov 2(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a42: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1a44: jsr pc, *$3cae
+    {
+        a = 0x3cae;
+        r[6] -= 2;
+        WR16(r[6], 0x1a48);
+    }
+    AOT_GOTO(0x3cae, L3cae);
+L1a48:
+    AOT_BLOCK(0x1a48, 3);
+    // 1a48: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 1a4a: cmp -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a4e: bne 1a5c
+    if (!Z)
+        AOT_GOTO(0x1a5c, L1a5c);
+    AOT_GOTO(0x1a50, L1a50);
+L1a50:
+    AOT_BLOCK(0x1a50, 3);
+    // 1a50: mov (r4), (sp)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a52: mov $42c2, -(sp)
+    {
+        src = uint16_t(0x42c2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a56: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1a5a);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1a5a:
+    AOT_BLOCK(0x1a5a, 1);
+    // 1a5a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1a5c, L1a5c);
+L1a5c:
+    AOT_BLOCK(0x1a5c, 2);
+    // 1a5c: add $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1a60: br 1a36
+    AOT_GOTO(0x1a36, L1a36);
+L1a62:
+    AOT_BLOCK(0x1a62, 2);
+    // 1a62: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1a66: br 1a1e
+    AOT_GOTO(0x1a1e, L1a1e);
+L1a68:
+    AOT_BLOCK(0x1a68, 2);
+    // 1a68: mov $42c7, (sp)
+    {
+        src = uint16_t(0x42c7);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a6c: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1a70);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1a70:
+    AOT_BLOCK(0x1a70, 2);
+    // 1a70: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1a74:
+    AOT_BLOCK(0x1a74, 5);
+    // 1a74: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1a78;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1a78: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 1a7c: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1a80: mov 6(r5), r2
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a84, L1a84);
+L1a84:
+    AOT_BLOCK(0x1a84, 3);
+    // 1a84: sub $4, r2
+    {
+        src = uint16_t(0x0004);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+    }
+    // 1a88: cmp r3, r2
+    {
+        src = r[3];
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a8a: bcc 1aec
+    if (!C)
+        AOT_GOTO(0x1aec, L1aec);
+    AOT_GOTO(0x1a8c, L1a8c);
+L1a8c:
+    AOT_BLOCK(0x1a8c, 2);
+    // 1a8c: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 1a90: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a92, L1a92);
+L1a92:
+    AOT_BLOCK(0x1a92, 2);
+    // 1a92: cmp r2, r4
+    {
+        src = r[2];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a94: blos 1ae4
+    if (C | Z)
+        AOT_GOTO(0x1ae4, L1ae4);
+    AOT_GOTO(0x1a96, L1a96);
+L1a96:
+    AOT_BLOCK(0x1a96, 2);
+    // 1a96: cmp 6(r4), 2(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a9c: bne 1ab2
+    if (!Z)
+        AOT_GOTO(0x1ab2, L1ab2);
+    AOT_GOTO(0x1a9e, L1a9e);
+L1a9e:
+    AOT_BLOCK(0x1a9e, 3);
+    // 1a9e: mov 2(r4), (sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1aa2: mov $42ce, -(sp)
+    {
+        src = uint16_t(0x42ce);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1aa6: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x1aaa);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L1aaa:
+    AOT_BLOCK(0x1aaa, 3);
+    // 1aaa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1aac: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ab0: br 1af0
+    AOT_GOTO(0x1af0, L1af0);
+L1ab2:
+    AOT_BLOCK(0x1ab2, 2);
+    // 1ab2: cmp 6(r4), 2(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ab8: bge 1ade
+    if (!(N ^ V))
+        AOT_GOTO(0x1ade, L1ade);
+    AOT_GOTO(0x1aba, L1aba);
+L1aba:
+    AOT_BLOCK(0x1aba, 7);
+    // 1aba: inc -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1abe: mov 2(r4), -a(r5)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1ac4: mov 6(r4), 2(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 1aca: mov -a(r5), 6(r4)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 1ad0: mov (r4), -a(r5)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1ad4: mov 4(r4), (r4)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 1ad8: mov -a(r5), 4(r4)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ade, L1ade);
+L1ade:
+    AOT_BLOCK(0x1ade, 2);
+    // 1ade: add $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1ae2: br 1a92
+    AOT_GOTO(0x1a92, L1a92);
+L1ae4:
+    AOT_BLOCK(0x1ae4, 2);
+    // 1ae4: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1ae8: beq 1aec
+    if (Z)
+        AOT_GOTO(0x1aec, L1aec);
+    AOT_GOTO(0x1aea, L1aea);
+L1aea:
+    AOT_BLOCK(0x1aea, 1);
+    // 1aea: br 1a84
+    AOT_GOTO(0x1a84, L1a84);
+L1aec:
+    AOT_BLOCK(0x1aec, 2);
+    // 1aec: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1aee: br 1af0
+    AOT_GOTO(0x1af0, L1af0);
+L1af0:
+    AOT_BLOCK(0x1af0, 2);
+    // 1af0: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1af4:
+    AOT_BLOCK(0x1af4, 5);
+    // 1af4: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1af8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1af8: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1afc: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1afe: jsr pc, *$164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x1b02);
+    }
+    AOT_GOTO(0x164e, L164e);
+L1b02:
+    AOT_BLOCK(0x1b02, 2);
+    // 1b02: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1b04: bne 1b28
+    if (!Z)
+        AOT_GOTO(0x1b28, L1b28);
+    AOT_GOTO(0x1b06, L1b06);
+L1b06:
+    AOT_BLOCK(0x1b06, 2);
+    // 1b06: cmp $15, *8(r3)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[3] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b0c: bne 1b28
+    if (!Z)
+        AOT_GOTO(0x1b28, L1b28);
+    AOT_GOTO(0x1b0e, L1b0e);
+L1b0e:
+    AOT_BLOCK(0x1b0e, 4);
+    // 1b0e: mov 8(r3), r0
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1b12: mov 6(r0), r4
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1b16: cmp $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b1a: bge 1b28
+    if (!(N ^ V))
+        AOT_GOTO(0x1b28, L1b28);
+    AOT_GOTO(0x1b1c, L1b1c);
+L1b1c:
+    AOT_BLOCK(0x1b1c, 4);
+    // 1b1c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1b1e: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+    }
+    // 1b20: bit r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1b22: bne 1b28
+    if (!Z)
+        AOT_GOTO(0x1b28, L1b28);
+    AOT_GOTO(0x1b24, L1b24);
+L1b24:
+    AOT_BLOCK(0x1b24, 2);
+    // 1b24: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b26: br 1b2c
+    AOT_GOTO(0x1b2c, L1b2c);
+L1b28:
+    AOT_BLOCK(0x1b28, 2);
+    // 1b28: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1b2a: br 1b2c
+    AOT_GOTO(0x1b2c, L1b2c);
+L1b2c:
+    AOT_BLOCK(0x1b2c, 2);
+    // 1b2c: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1b30:
+    AOT_BLOCK(0x1b30, 5);
+    // 1b30: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1b34;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1b34: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1b38: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b3a: jsr pc, *$1af4
+    {
+        a = 0x1af4;
+        r[6] -= 2;
+        WR16(r[6], 0x1b3e);
+    }
+    AOT_GOTO(0x1af4, L1af4);
+L1b3e:
+    AOT_BLOCK(0x1b3e, 2);
+    // 1b3e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b40: beq 1b8a
+    if (Z)
+        AOT_GOTO(0x1b8a, L1b8a);
+    AOT_GOTO(0x1b42, L1b42);
+L1b42:
+    AOT_BLOCK(0x1b42, 1);
+    // 1b42: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1b44, L1b44);
+L1b44:
+    AOT_BLOCK(0x1b44, 3);
+    // 1b44: asr r4
+    {
+        src = r[4];
+        val = int16_t(src) >> 1;
+        r[4] = val;
+    }
+    // 1b46: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1b48: beq 1b4e
+    if (Z)
+        AOT_GOTO(0x1b4e, L1b4e);
+    AOT_GOTO(0x1b4a, L1b4a);
+L1b4a:
+    AOT_BLOCK(0x1b4a, 2);
+    // 1b4a: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1b4c: br 1b44
+    AOT_GOTO(0x1b44, L1b44);
+L1b4e:
+    AOT_BLOCK(0x1b4e, 5);
+    // 1b4e: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1b52: mov r3, 6(r0)
+    {
+        src = r[3];
+        b = uint16_t(r[0] + 6);
+        WR16(b, src);
+    }
+    // 1b56: mov (r2), r4
+    {
+        a = r[2];
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1b58: cmp $2a, r4
+    {
+        src = uint16_t(0x002a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b5c: bne 1b64
+    if (!Z)
+        AOT_GOTO(0x1b64, L1b64);
+    AOT_GOTO(0x1b5e, L1b5e);
+L1b5e:
+    AOT_BLOCK(0x1b5e, 2);
+    // 1b5e: mov $2e, r0
+    {
+        src = uint16_t(0x002e);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b62: br 1b80
+    AOT_GOTO(0x1b80, L1b80);
+L1b64:
+    AOT_BLOCK(0x1b64, 2);
+    // 1b64: cmp $2b, r4
+    {
+        src = uint16_t(0x002b);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b68: bne 1b70
+    if (!Z)
+        AOT_GOTO(0x1b70, L1b70);
+    AOT_GOTO(0x1b6a, L1b6a);
+L1b6a:
+    AOT_BLOCK(0x1b6a, 2);
+    // 1b6a: mov $2d, r0
+    {
+        src = uint16_t(0x002d);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b6e: br 1b80
+    AOT_GOTO(0x1b80, L1b80);
+L1b70:
+    AOT_BLOCK(0x1b70, 2);
+    // 1b70: cmp $48, r4
+    {
+        src = uint16_t(0x0048);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b74: bne 1b7c
+    if (!Z)
+        AOT_GOTO(0x1b7c, L1b7c);
+    AOT_GOTO(0x1b76, L1b76);
+L1b76:
+    AOT_BLOCK(0x1b76, 2);
+    // 1b76: mov $4c, r0
+    {
+        src = uint16_t(0x004c);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b7a: br 1b80
+    AOT_GOTO(0x1b80, L1b80);
+L1b7c:
+    AOT_BLOCK(0x1b7c, 1);
+    // 1b7c: mov $4b, r0
+    {
+        src = uint16_t(0x004b);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b80, L1b80);
+L1b80:
+    AOT_BLOCK(0x1b80, 3);
+    // 1b80: mov r0, (r2)
+    {
+        src = r[0];
+        b = r[2];
+        WR16(b, src);
+    }
+    // 1b82: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b84: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x1b88);
+    }
+    AOT_GOTO(0x241c, L241c);
+L1b88:
+    AOT_BLOCK(0x1b88, 1);
+    // 1b88: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b8a, L1b8a);
+L1b8a:
+    AOT_BLOCK(0x1b8a, 2);
+    // 1b8a: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b8c: br 1b8e
+    AOT_GOTO(0x1b8e, L1b8e);
+L1b8e:
+    AOT_BLOCK(0x1b8e, 2);
+    // 1b8e: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1b92:
+    AOT_BLOCK(0x1b92, 8);
+    // 1b92: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1b96;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1b96: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1b9a: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1b9e: mov a(r5), r3
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1ba2: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1ba6: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1ba8: bne 1bae
+    if (!Z)
+        AOT_GOTO(0x1bae, L1bae);
+    AOT_GOTO(0x1baa, L1baa);
+L1baa:
+    AOT_BLOCK(0x1baa, 1);
+    // 1baa: jmp *$1dd8
+    {
+        a = 0x1dd8;
+    }
+    AOT_GOTO(0x1dd8, L1dd8);
+L1bae:
+    AOT_BLOCK(0x1bae, 2);
+    // 1bae: mov (r2), r0
+    {
+        a = r[2];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bb0: jmp *$1cc6
+    {
+        a = 0x1cc6;
+    }
+    AOT_GOTO(0x1cc6, L1cc6);
+L1bb4:
+    AOT_BLOCK(0x1bb4, 2);
+    // 1bb4: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1bb8: beq 1bf6
+    if (Z)
+        AOT_GOTO(0x1bf6, L1bf6);
+    AOT_GOTO(0x1bba, L1bba);
+L1bba:
+    AOT_BLOCK(0x1bba, 8);
+    // 1bba: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bbc: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1bbe: mov 3cec, r0
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1bc2: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1bc6: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bc8: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1bcc: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bd0: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x1bd4);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L1bd4:
+    AOT_BLOCK(0x1bd4, 6);
+    // 1bd4: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1bd8: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bda: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bde: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1be0: mov 8(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1be4: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x1be8);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L1be8:
+    AOT_BLOCK(0x1be8, 3);
+    // 1be8: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1bec: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bf0: jsr pc, *$1e12
+    {
+        a = 0x1e12;
+        r[6] -= 2;
+        WR16(r[6], 0x1bf4);
+    }
+    AOT_GOTO(0x1e12, L1e12);
+L1bf4:
+    AOT_BLOCK(0x1bf4, 1);
+    // 1bf4: br 1c1a
+    AOT_GOTO(0x1c1a, L1c1a);
+L1bf6:
+    AOT_BLOCK(0x1bf6, 5);
+    // 1bf6: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bf8: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1bfa: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bfc: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c00: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x1c04);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L1c04:
+    AOT_BLOCK(0x1c04, 6);
+    // 1c04: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 1c08: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c0a: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1c0c: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c0e: mov 8(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c12: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x1c16);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L1c16:
+    AOT_BLOCK(0x1c16, 1);
+    // 1c16: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1c1a, L1c1a);
+L1c1a:
+    AOT_BLOCK(0x1c1a, 1);
+    // 1c1a: jmp *$1dd8
+    {
+        a = 0x1dd8;
+    }
+    AOT_GOTO(0x1dd8, L1dd8);
+L1c1e:
+    AOT_BLOCK(0x1c1e, 2);
+    // 1c1e: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1c22: beq 1c4e
+    if (Z)
+        AOT_GOTO(0x1c4e, L1c4e);
+    AOT_GOTO(0x1c24, L1c24);
+L1c24:
+    AOT_BLOCK(0x1c24, 5);
+    // 1c24: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c26: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c2a: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c2c: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c30: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x1c34);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L1c34:
+    AOT_BLOCK(0x1c34, 6);
+    // 1c34: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1c38: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c3a: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c3e: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c40: mov 8(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c44: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x1c48);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L1c48:
+    AOT_BLOCK(0x1c48, 2);
+    // 1c48: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1c4c: br 1c88
+    AOT_GOTO(0x1c88, L1c88);
+L1c4e:
+    AOT_BLOCK(0x1c4e, 8);
+    // 1c4e: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c50: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c54: mov 3cec, r0
+    {
+        a = 0x3cec;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1c58: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1c5c: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c5e: inc 3cec
+    {
+        a = 0x3cec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1c62: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c66: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x1c6a);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L1c6a:
+    AOT_BLOCK(0x1c6a, 6);
+    // 1c6a: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 1c6e: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c70: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1c72: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c74: mov 8(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c78: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x1c7c);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L1c7c:
+    AOT_BLOCK(0x1c7c, 3);
+    // 1c7c: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1c80: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c84: jsr pc, *$1e12
+    {
+        a = 0x1e12;
+        r[6] -= 2;
+        WR16(r[6], 0x1c88);
+    }
+    AOT_GOTO(0x1e12, L1e12);
+L1c88:
+    AOT_BLOCK(0x1c88, 1);
+    // 1c88: jmp *$1dd8
+    {
+        a = 0x1dd8;
+    }
+    AOT_GOTO(0x1dd8, L1dd8);
+L1c8c:
+    AOT_BLOCK(0x1c8c, 3);
+    // 1c8c: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c8e: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1c92: beq 1c98
+    if (Z)
+        AOT_GOTO(0x1c98, L1c98);
+    AOT_GOTO(0x1c94, L1c94);
+L1c94:
+    AOT_BLOCK(0x1c94, 2);
+    // 1c94: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1c96: br 1c9c
+    AOT_GOTO(0x1c9c, L1c9c);
+L1c98:
+    AOT_BLOCK(0x1c98, 1);
+    // 1c98: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1c9c, L1c9c);
+L1c9c:
+    AOT_BLOCK(0x1c9c, 3);
+    // 1c9c: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c9e: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ca2: jsr pc, *$1b92
+    {
+        a = 0x1b92;
+        r[6] -= 2;
+        WR16(r[6], 0x1ca6);
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L1ca6:
+    AOT_BLOCK(0x1ca6, 2);
+    // 1ca6: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1caa: jmp *$1dd8
+    {
+        a = 0x1dd8;
+    }
+    AOT_GOTO(0x1dd8, L1dd8);
+L1cae:
+    AOT_BLOCK(0x1cae, 4);
+    // 1cae: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1cb0: mov $5300, -(sp)
+    {
+        src = uint16_t(0x5300);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1cb4: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cb8: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x1cbc);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L1cbc:
+    AOT_BLOCK(0x1cbc, 3);
+    // 1cbc: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1cbe: mov 8(r2), r2
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cc2: br 1cd6
+    AOT_GOTO(0x1cd6, L1cd6);
+L1cc6:
+    AOT_BLOCK(0x1cc6, 2);
+    // 1cc6: mov $4112, r1
+    {
+        src = uint16_t(0x4112);
+        r[1] = src;
+    }
+    // 1cca: mov r0, 411a
+    {
+        src = r[0];
+        b = 0x411a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1cce, L1cce);
+L1cce:
+    AOT_BLOCK(0x1cce, 2);
+    // 1cce: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1cd0: bne 1cce
+    if (!Z)
+        AOT_GOTO(0x1cce, L1cce);
+    AOT_GOTO(0x1cd2, L1cd2);
+L1cd2:
+    AOT_BLOCK(0x1cd2, 1);
+    // 1cd2: jmp *8(r1)
+    {
+        a = RD16(r[1] + 8);
+    }
+    AOT_JUMP(a);
+L1cd6:
+    AOT_BLOCK(0x1cd6, 3);
+    // 1cd6: mov (r2), -a(r5)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1cda: cmp $6, 2(r2)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[2] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ce0: beq 1cfc
+    if (Z)
+        AOT_GOTO(0x1cfc, L1cfc);
+    AOT_GOTO(0x1ce2, L1ce2);
+L1ce2:
+    AOT_BLOCK(0x1ce2, 4);
+    // 1ce2: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1ce6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1ce8: bit $4, 4568(r0)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1cee: beq 1d50
+    if (Z)
+        AOT_GOTO(0x1d50, L1d50);
+    AOT_GOTO(0x1cf0, L1cf0);
+L1cf0:
+    AOT_BLOCK(0x1cf0, 3);
+    // 1cf0: mov 6(r2), r0
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1cf4: cmp $6, 2(r0)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[0] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1cfa: bne 1d50
+    if (!Z)
+        AOT_GOTO(0x1d50, L1d50);
+    AOT_GOTO(0x1cfc, L1cfc);
+L1cfc:
+    AOT_BLOCK(0x1cfc, 2);
+    // 1cfc: cmp $6, 2(r2)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[2] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d02: beq 1d18
+    if (Z)
+        AOT_GOTO(0x1d18, L1d18);
+    AOT_GOTO(0x1d04, L1d04);
+L1d04:
+    AOT_BLOCK(0x1d04, 4);
+    // 1d04: mov $29, (r2)
+    {
+        src = uint16_t(0x0029);
+        b = r[2];
+        WR16(b, src);
+    }
+    // 1d08: mov $6, 2(r2)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 1d0e: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d10: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x1d14);
+    }
+    AOT_GOTO(0x241c, L241c);
+L1d14:
+    AOT_BLOCK(0x1d14, 2);
+    // 1d14: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d16: br 1d1e
+    AOT_GOTO(0x1d1e, L1d1e);
+L1d18:
+    AOT_BLOCK(0x1d18, 1);
+    // 1d18: mov $3d, -a(r5)
+    {
+        src = uint16_t(0x003d);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d1e, L1d1e);
+L1d1e:
+    AOT_BLOCK(0x1d1e, 4);
+    // 1d1e: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 1d20: mov $4a5e, -(sp)
+    {
+        src = uint16_t(0x4a5e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1d24: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d26: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x1d2a);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L1d2a:
+    AOT_BLOCK(0x1d2a, 3);
+    // 1d2a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1d2c: mov $42e2, (sp)
+    {
+        src = uint16_t(0x42e2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d30: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1d34);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1d34:
+    AOT_BLOCK(0x1d34, 2);
+    // 1d34: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1d38: beq 1d3e
+    if (Z)
+        AOT_GOTO(0x1d3e, L1d3e);
+    AOT_GOTO(0x1d3a, L1d3a);
+L1d3a:
+    AOT_BLOCK(0x1d3a, 2);
+    // 1d3a: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1d3c: br 1d42
+    AOT_GOTO(0x1d42, L1d42);
+L1d3e:
+    AOT_BLOCK(0x1d3e, 1);
+    // 1d3e: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d42, L1d42);
+L1d42:
+    AOT_BLOCK(0x1d42, 3);
+    // 1d42: mov -a(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1d46: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d48: jsr pc, *$1ddc
+    {
+        a = 0x1ddc;
+        r[6] -= 2;
+        WR16(r[6], 0x1d4c);
+    }
+    AOT_GOTO(0x1ddc, L1ddc);
+L1d4c:
+    AOT_BLOCK(0x1d4c, 2);
+    // 1d4c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d4e: br 1dd8
+    AOT_GOTO(0x1dd8, L1dd8);
+L1d50:
+    AOT_BLOCK(0x1d50, 4);
+    // 1d50: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1d52: mov $564e, -(sp)
+    {
+        src = uint16_t(0x564e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1d56: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d58: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x1d5c);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L1d5c:
+    AOT_BLOCK(0x1d5c, 6);
+    // 1d5c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 1d5e: mov (r2), -a(r5)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1d62: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1d66: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1d68: bit $4, 4568(r0)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1d6e: bne 1d78
+    if (!Z)
+        AOT_GOTO(0x1d78, L1d78);
+    AOT_GOTO(0x1d70, L1d70);
+L1d70:
+    AOT_BLOCK(0x1d70, 2);
+    // 1d70: mov $3d, -a(r5)
+    {
+        src = uint16_t(0x003d);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d76: br 1dac
+    AOT_GOTO(0x1dac, L1dac);
+L1d78:
+    AOT_BLOCK(0x1d78, 3);
+    // 1d78: mov *8(r2), -8(r5)
+    {
+        a = RD16(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1d7e: cmp $15, -8(r5)
+    {
+        src = uint16_t(0x0015);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d84: beq 1d8e
+    if (Z)
+        AOT_GOTO(0x1d8e, L1d8e);
+    AOT_GOTO(0x1d86, L1d86);
+L1d86:
+    AOT_BLOCK(0x1d86, 2);
+    // 1d86: cmp $18, -8(r5)
+    {
+        src = uint16_t(0x0018);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d8c: bne 1da0
+    if (!Z)
+        AOT_GOTO(0x1da0, L1da0);
+    AOT_GOTO(0x1d8e, L1d8e);
+L1d8e:
+    AOT_BLOCK(0x1d8e, 3);
+    // 1d8e: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1d92: tst 6(r0)
+    {
+        a = uint16_t(r[0] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1d96: bne 1da0
+    if (!Z)
+        AOT_GOTO(0x1da0, L1da0);
+    AOT_GOTO(0x1d98, L1d98);
+L1d98:
+    AOT_BLOCK(0x1d98, 2);
+    // 1d98: add $c8, -a(r5)
+    {
+        src = uint16_t(0x00c8);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1d9e: br 1dac
+    AOT_GOTO(0x1dac, L1dac);
+L1da0:
+    AOT_BLOCK(0x1da0, 3);
+    // 1da0: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1da4: movb 3c82(r0), r0
+    {
+        a = uint16_t(r[0] + 15490);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1da8: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1dac, L1dac);
+L1dac:
+    AOT_BLOCK(0x1dac, 2);
+    // 1dac: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dae: jsr pc, *$164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x1db2);
+    }
+    AOT_GOTO(0x164e, L164e);
+L1db2:
+    AOT_BLOCK(0x1db2, 2);
+    // 1db2: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1db4: beq 1dbe
+    if (Z)
+        AOT_GOTO(0x1dbe, L1dbe);
+    AOT_GOTO(0x1db6, L1db6);
+L1db6:
+    AOT_BLOCK(0x1db6, 2);
+    // 1db6: mov $42ee, (sp)
+    {
+        src = uint16_t(0x42ee);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dba: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1dbe);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1dbe:
+    AOT_BLOCK(0x1dbe, 2);
+    // 1dbe: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1dc2: beq 1dc8
+    if (Z)
+        AOT_GOTO(0x1dc8, L1dc8);
+    AOT_GOTO(0x1dc4, L1dc4);
+L1dc4:
+    AOT_BLOCK(0x1dc4, 2);
+    // 1dc4: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1dc6: br 1dcc
+    AOT_GOTO(0x1dcc, L1dcc);
+L1dc8:
+    AOT_BLOCK(0x1dc8, 1);
+    // 1dc8: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1dcc, L1dcc);
+L1dcc:
+    AOT_BLOCK(0x1dcc, 3);
+    // 1dcc: mov -a(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1dd0: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dd2: jsr pc, *$1ddc
+    {
+        a = 0x1ddc;
+        r[6] -= 2;
+        WR16(r[6], 0x1dd6);
+    }
+    AOT_GOTO(0x1ddc, L1ddc);
+L1dd6:
+    AOT_BLOCK(0x1dd6, 1);
+    // 1dd6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1dd8, L1dd8);
+L1dd8:
+    AOT_BLOCK(0x1dd8, 2);
+    // 1dd8: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1ddc:
+    AOT_BLOCK(0x1ddc, 4);
+    // 1ddc: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1de0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1de0: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1de4: beq 1df8
+    if (Z)
+        AOT_GOTO(0x1df8, L1df8);
+    AOT_GOTO(0x1de6, L1de6);
+L1de6:
+    AOT_BLOCK(0x1de6, 4);
+    // 1de6: mov $49e4, (sp)
+    {
+        src = uint16_t(0x49e4);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1dea: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1dee: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1df0: jsr pc, *$15ca
+    {
+        a = 0x15ca;
+        r[6] -= 2;
+        WR16(r[6], 0x1df4);
+    }
+    AOT_GOTO(0x15ca, L15ca);
+L1df4:
+    AOT_BLOCK(0x1df4, 2);
+    // 1df4: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1df6: br 1e00
+    AOT_GOTO(0x1e00, L1e00);
+L1df8:
+    AOT_BLOCK(0x1df8, 2);
+    // 1df8: mov $42f4, (sp)
+    {
+        src = uint16_t(0x42f4);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dfc: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1e00);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1e00:
+    AOT_BLOCK(0x1e00, 3);
+    // 1e00: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e04: mov $42f8, -(sp)
+    {
+        src = uint16_t(0x42f8);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e08: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1e0c);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1e0c:
+    AOT_BLOCK(0x1e0c, 3);
+    // 1e0c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1e0e: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1e12:
+    AOT_BLOCK(0x1e12, 5);
+    // 1e12: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1e16;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1e16: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e1a: mov $42fe, -(sp)
+    {
+        src = uint16_t(0x42fe);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e1e: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1e22);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1e22:
+    AOT_BLOCK(0x1e22, 3);
+    // 1e22: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1e24: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1e28:
+    AOT_BLOCK(0x1e28, 4);
+    // 1e28: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1e2c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1e2c: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e30: br 1e4a
+    AOT_GOTO(0x1e4a, L1e4a);
+L1e32:
+    AOT_BLOCK(0x1e32, 1);
+    // 1e32: br 1e64
+    AOT_GOTO(0x1e64, L1e64);
+L1e34:
+    AOT_BLOCK(0x1e34, 2);
+    // 1e34: mov $4303, (sp)
+    {
+        src = uint16_t(0x4303);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e38: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1e3c);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1e3c:
+    AOT_BLOCK(0x1e3c, 1);
+    // 1e3c: br 1e64
+    AOT_GOTO(0x1e64, L1e64);
+L1e3e:
+    AOT_BLOCK(0x1e3e, 2);
+    // 1e3e: mov $430e, (sp)
+    {
+        src = uint16_t(0x430e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e42: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1e46);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1e46:
+    AOT_BLOCK(0x1e46, 1);
+    // 1e46: br 1e64
+    AOT_GOTO(0x1e64, L1e64);
+L1e4a:
+    AOT_BLOCK(0x1e4a, 2);
+    // 1e4a: cmp r0, $4
+    {
+        src = r[0];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e4e: bhi 1e56
+    if (!(C | Z))
+        AOT_GOTO(0x1e56, L1e56);
+    AOT_GOTO(0x1e50, L1e50);
+L1e50:
+    AOT_BLOCK(0x1e50, 2);
+    // 1e50: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 1e52: jmp *4126(r0)
+    {
+        a = RD16(r[0] + 16678);
+    }
+    AOT_JUMP(a);
+L1e56:
+    AOT_BLOCK(0x1e56, 3);
+    // 1e56: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e5a: mov $431f, -(sp)
+    {
+        src = uint16_t(0x431f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e5e: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1e62);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1e62:
+    AOT_BLOCK(0x1e62, 1);
+    // 1e62: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1e64, L1e64);
+L1e64:
+    AOT_BLOCK(0x1e64, 2);
+    // 1e64: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1e68:
+    AOT_BLOCK(0x1e68, 4);
+    // 1e68: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1e6c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1e6c: inc 59ec
+    {
+        a = 0x59ec;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1e70: jsr pc, 3b4a
+    {
+        a = 0x3b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1e74);
+    }
+    AOT_GOTO(0x3b4a, L3b4a);
+L1e74:
+    AOT_BLOCK(0x1e74, 5);
+    // 1e74: mov 5e04, r4
+    {
+        a = 0x5e04;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1e78: mov $1, 5e04
+    {
+        src = uint16_t(0x0001);
+        b = 0x5e04;
+        WR16(b, src);
+    }
+    // 1e7e: mov 57e4, (sp)
+    {
+        a = 0x57e4;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e82: mov $432b, -(sp)
+    {
+        src = uint16_t(0x432b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e86: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1e8a);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1e8a:
+    AOT_BLOCK(0x1e8a, 9);
+    // 1e8a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1e8c: mov 10(r5), (sp)
+    {
+        a = uint16_t(r[5] + 16);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e90: mov e(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 14);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e94: mov c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e98: mov a(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e9c: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ea0: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ea4: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ea8: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1eac);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1eac:
+    AOT_BLOCK(0x1eac, 3);
+    // 1eac: add $c, sp
+    {
+        src = uint16_t(0x000c);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1eb0: mov $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1eb4: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x1eb8);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L1eb8:
+    AOT_BLOCK(0x1eb8, 1);
+    // 1eb8: jsr pc, 3b4a
+    {
+        a = 0x3b4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1ebc);
+    }
+    AOT_GOTO(0x3b4a, L3b4a);
+L1ebc:
+    AOT_BLOCK(0x1ebc, 3);
+    // 1ebc: mov r4, 5e04
+    {
+        src = r[4];
+        b = 0x5e04;
+        WR16(b, src);
+    }
+    // 1ec0: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1ec4:
+    AOT_BLOCK(0x1ec4, 6);
+    // 1ec4: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1ec8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1ec8: clr r3
+    {
+        r[3] = 0;
+    }
+    // 1eca: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1ece: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1ed0: bge 1edc
+    if (!(N ^ V))
+        AOT_GOTO(0x1edc, L1edc);
+    AOT_GOTO(0x1ed2, L1ed2);
+L1ed2:
+    AOT_BLOCK(0x1ed2, 4);
+    // 1ed2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1ed4: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        C = val != 0;
+    }
+    // 1ed6: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1ed8: mov $2d, r3
+    {
+        src = uint16_t(0x002d);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1edc, L1edc);
+L1edc:
+    AOT_BLOCK(0x1edc, 4);
+    // 1edc: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ede: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ee0: mov $4330, -(sp)
+    {
+        src = uint16_t(0x4330);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ee4: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1ee8);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1ee8:
+    AOT_BLOCK(0x1ee8, 3);
+    // 1ee8: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1eea: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1eee:
+    AOT_BLOCK(0x1eee, 6);
+    // 1eee: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1ef2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1ef2: sub $2a, sp
+    {
+        src = uint16_t(0x002a);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1ef6: mov $59f8, 59f6
+    {
+        src = uint16_t(0x59f8);
+        b = 0x59f6;
+        WR16(b, src);
+    }
+    // 1efc: mov r5, r4
+    {
+        src = r[5];
+        r[4] = src;
+    }
+    // 1efe: add $ffd2, r4
+    {
+        src = uint16_t(0xffd2);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1f02, L1f02);
+L1f02:
+    AOT_BLOCK(0x1f02, 4);
+    // 1f02: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 1f04: add $fffa, r0
+    {
+        src = uint16_t(0xfffa);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1f08: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f0a: bcs 1f14
+    if (C)
+        AOT_GOTO(0x1f14, L1f14);
+    AOT_GOTO(0x1f0c, L1f0c);
+L1f0c:
+    AOT_BLOCK(0x1f0c, 2);
+    // 1f0c: mov $4335, (sp)
+    {
+        src = uint16_t(0x4335);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f10: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x1f14);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L1f14:
+    AOT_BLOCK(0x1f14, 2);
+    // 1f14: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f18: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x1f1c);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L1f1c:
+    AOT_BLOCK(0x1f1c, 5);
+    // 1f1c: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 1f1e: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 1f20: bic $ff, r0
+    {
+        src = uint16_t(0x00ff);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1f24: cmp $fe00, r0
+    {
+        src = uint16_t(0xfe00);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f28: beq 1f3a
+    if (Z)
+        AOT_GOTO(0x1f3a, L1f3a);
+    AOT_GOTO(0x1f2a, L1f2a);
+L1f2a:
+    AOT_BLOCK(0x1f2a, 2);
+    // 1f2a: mov $4341, (sp)
+    {
+        src = uint16_t(0x4341);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f2e: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x1f32);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L1f32:
+    AOT_BLOCK(0x1f32, 2);
+    // 1f32: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f36: jsr pc, *$3c68
+    {
+        a = 0x3c68;
+        r[6] -= 2;
+        WR16(r[6], 0x1f3a);
+    }
+    AOT_GOTO(0x3c68, L3c68);
+L1f3a:
+    AOT_BLOCK(0x1f3a, 3);
+    // 1f3a: bic $ff00, r2
+    {
+        src = uint16_t(0xff00);
+        dst = r[2];
+        val = (~src) & dst;
+        r[2] = val;
+    }
+    // 1f3e: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f40: jmp *$2376
+    {
+        a = 0x2376;
+    }
+    AOT_GOTO(0x2376, L2376);
+L1f44:
+    AOT_BLOCK(0x1f44, 1);
+    // 1f44: jmp *$2394
+    {
+        a = 0x2394;
+    }
+    AOT_GOTO(0x2394, L2394);
+L1f48:
+    AOT_BLOCK(0x1f48, 2);
+    // 1f48: mov $4359, (sp)
+    {
+        src = uint16_t(0x4359);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f4c: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1f50);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1f50:
+    AOT_BLOCK(0x1f50, 2);
+    // 1f50: mov $2c, (sp)
+    {
+        src = uint16_t(0x002c);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f54: jsr pc, *$23cc
+    {
+        a = 0x23cc;
+        r[6] -= 2;
+        WR16(r[6], 0x1f58);
+    }
+    AOT_GOTO(0x23cc, L23cc);
+L1f58:
+    AOT_BLOCK(0x1f58, 1);
+    // 1f58: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L1f5c:
+    AOT_BLOCK(0x1f5c, 2);
+    // 1f5c: mov $3b, (sp)
+    {
+        src = uint16_t(0x003b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f60: jsr pc, *$23cc
+    {
+        a = 0x23cc;
+        r[6] -= 2;
+        WR16(r[6], 0x1f64);
+    }
+    AOT_GOTO(0x23cc, L23cc);
+L1f64:
+    AOT_BLOCK(0x1f64, 1);
+    // 1f64: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L1f68:
+    AOT_BLOCK(0x1f68, 2);
+    // 1f68: mov $4360, (sp)
+    {
+        src = uint16_t(0x4360);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f6c: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1f70);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1f70:
+    AOT_BLOCK(0x1f70, 1);
+    // 1f70: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L1f74:
+    AOT_BLOCK(0x1f74, 2);
+    // 1f74: mov $4367, (sp)
+    {
+        src = uint16_t(0x4367);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f78: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1f7c);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1f7c:
+    AOT_BLOCK(0x1f7c, 1);
+    // 1f7c: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L1f80:
+    AOT_BLOCK(0x1f80, 2);
+    // 1f80: mov $436e, (sp)
+    {
+        src = uint16_t(0x436e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f84: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1f88);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1f88:
+    AOT_BLOCK(0x1f88, 1);
+    // 1f88: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L1f8c:
+    AOT_BLOCK(0x1f8c, 2);
+    // 1f8c: mov $5de8, (sp)
+    {
+        src = uint16_t(0x5de8);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f90: jsr pc, *$2398
+    {
+        a = 0x2398;
+        r[6] -= 2;
+        WR16(r[6], 0x1f94);
+    }
+    AOT_GOTO(0x2398, L2398);
+L1f94:
+    AOT_BLOCK(0x1f94, 3);
+    // 1f94: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1f96: mov $4374, -(sp)
+    {
+        src = uint16_t(0x4374);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f9a: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1f9e);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1f9e:
+    AOT_BLOCK(0x1f9e, 2);
+    // 1f9e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1fa0: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L1fa4:
+    AOT_BLOCK(0x1fa4, 2);
+    // 1fa4: mov $4380, (sp)
+    {
+        src = uint16_t(0x4380);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fa8: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1fac);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1fac:
+    AOT_BLOCK(0x1fac, 1);
+    // 1fac: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L1fb0:
+    AOT_BLOCK(0x1fb0, 2);
+    // 1fb0: mov $5de8, (sp)
+    {
+        src = uint16_t(0x5de8);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fb4: jsr pc, *$2398
+    {
+        a = 0x2398;
+        r[6] -= 2;
+        WR16(r[6], 0x1fb8);
+    }
+    AOT_GOTO(0x2398, L2398);
+L1fb8:
+    AOT_BLOCK(0x1fb8, 3);
+    // 1fb8: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1fba: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fbe: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x1fc2);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L1fc2:
+    AOT_BLOCK(0x1fc2, 4);
+    // 1fc2: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1fc4: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1fc6: mov $438a, -(sp)
+    {
+        src = uint16_t(0x438a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fca: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1fce);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1fce:
+    AOT_BLOCK(0x1fce, 2);
+    // 1fce: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1fd0: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L1fd4:
+    AOT_BLOCK(0x1fd4, 2);
+    // 1fd4: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fd8: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x1fdc);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L1fdc:
+    AOT_BLOCK(0x1fdc, 3);
+    // 1fdc: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1fde: mov $4398, -(sp)
+    {
+        src = uint16_t(0x4398);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fe2: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1fe6);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1fe6:
+    AOT_BLOCK(0x1fe6, 2);
+    // 1fe6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1fe8: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L1fec:
+    AOT_BLOCK(0x1fec, 2);
+    // 1fec: mov $43a0, (sp)
+    {
+        src = uint16_t(0x43a0);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ff0: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x1ff4);
+    }
+    AOT_GOTO(0x396a, L396a);
+L1ff4:
+    AOT_BLOCK(0x1ff4, 1);
+    // 1ff4: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L1ff8:
+    AOT_BLOCK(0x1ff8, 2);
+    // 1ff8: mov $43a7, (sp)
+    {
+        src = uint16_t(0x43a7);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ffc: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x2000);
+    }
+    AOT_GOTO(0x396a, L396a);
+L2000:
+    AOT_BLOCK(0x2000, 2);
+    // 2000: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2004: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x2008);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L2008:
+    AOT_BLOCK(0x2008, 4);
+    // 2008: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 200a: add $fffa, r3
+    {
+        src = uint16_t(0xfffa);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 200e: cmp $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2012: bne 201e
+    if (!Z)
+        AOT_GOTO(0x201e, L201e);
+    AOT_GOTO(0x2014, L2014);
+L2014:
+    AOT_BLOCK(0x2014, 2);
+    // 2014: mov $43b3, (sp)
+    {
+        src = uint16_t(0x43b3);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2018: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x201c);
+    }
+    AOT_GOTO(0x396a, L396a);
+L201c:
+    AOT_BLOCK(0x201c, 1);
+    // 201c: br 2030
+    AOT_GOTO(0x2030, L2030);
+L201e:
+    AOT_BLOCK(0x201e, 2);
+    // 201e: cmp $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2022: bge 2030
+    if (!(N ^ V))
+        AOT_GOTO(0x2030, L2030);
+    AOT_GOTO(0x2024, L2024);
+L2024:
+    AOT_BLOCK(0x2024, 1);
+    // 2024: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2026, L2026);
+L2026:
+    AOT_BLOCK(0x2026, 2);
+    // 2026: mov $43be, -(sp)
+    {
+        src = uint16_t(0x43be);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 202a: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x202e);
+    }
+    AOT_GOTO(0x396a, L396a);
+L202e:
+    AOT_BLOCK(0x202e, 1);
+    // 202e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2030, L2030);
+L2030:
+    AOT_BLOCK(0x2030, 1);
+    // 2030: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L2034:
+    AOT_BLOCK(0x2034, 2);
+    // 2034: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2038: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x203c);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L203c:
+    AOT_BLOCK(0x203c, 4);
+    // 203c: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 203e: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2040: mov $43ca, -(sp)
+    {
+        src = uint16_t(0x43ca);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2044: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x2048);
+    }
+    AOT_GOTO(0x396a, L396a);
+L2048:
+    AOT_BLOCK(0x2048, 4);
+    // 2048: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 204a: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 204c: mov $43e5, -(sp)
+    {
+        src = uint16_t(0x43e5);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2050: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x2054);
+    }
+    AOT_GOTO(0x396a, L396a);
+L2054:
+    AOT_BLOCK(0x2054, 2);
+    // 2054: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2056: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L205a:
+    AOT_BLOCK(0x205a, 2);
+    // 205a: mov $5de8, (sp)
+    {
+        src = uint16_t(0x5de8);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 205e: jsr pc, *$2398
+    {
+        a = 0x2398;
+        r[6] -= 2;
+        WR16(r[6], 0x2062);
+    }
+    AOT_GOTO(0x2398, L2398);
+L2062:
+    AOT_BLOCK(0x2062, 1);
+    // 2062: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2064, L2064);
+L2064:
+    AOT_BLOCK(0x2064, 2);
+    // 2064: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2068: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x206c);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L206c:
+    AOT_BLOCK(0x206c, 1);
+    // 206c: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x206e, L206e);
+L206e:
+    AOT_BLOCK(0x206e, 2);
+    // 206e: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2070: mov $43fb, -(sp)
+    {
+        src = uint16_t(0x43fb);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2074, L2074);
+L2074:
+    AOT_BLOCK(0x2074, 1);
+    // 2074: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x2078);
+    }
+    AOT_GOTO(0x396a, L396a);
+L2078:
+    AOT_BLOCK(0x2078, 2);
+    // 2078: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 207a: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L207e:
+    AOT_BLOCK(0x207e, 2);
+    // 207e: mov $5de8, (sp)
+    {
+        src = uint16_t(0x5de8);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2082: jsr pc, *$2398
+    {
+        a = 0x2398;
+        r[6] -= 2;
+        WR16(r[6], 0x2086);
+    }
+    AOT_GOTO(0x2398, L2398);
+L2086:
+    AOT_BLOCK(0x2086, 3);
+    // 2086: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2088: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 208c: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x2090);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L2090:
+    AOT_BLOCK(0x2090, 4);
+    // 2090: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2092: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2094: mov $4404, -(sp)
+    {
+        src = uint16_t(0x4404);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2098: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x209c);
+    }
+    AOT_GOTO(0x396a, L396a);
+L209c:
+    AOT_BLOCK(0x209c, 2);
+    // 209c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 209e: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L20a2:
+    AOT_BLOCK(0x20a2, 2);
+    // 20a2: mov $5de8, (sp)
+    {
+        src = uint16_t(0x5de8);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20a6: jsr pc, *$2398
+    {
+        a = 0x2398;
+        r[6] -= 2;
+        WR16(r[6], 0x20aa);
+    }
+    AOT_GOTO(0x2398, L2398);
+L20aa:
+    AOT_BLOCK(0x20aa, 3);
+    // 20aa: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 20ac: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20b0: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x20b4);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L20b4:
+    AOT_BLOCK(0x20b4, 4);
+    // 20b4: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 20b6: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 20b8: mov $440c, -(sp)
+    {
+        src = uint16_t(0x440c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20bc: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x20c0);
+    }
+    AOT_GOTO(0x396a, L396a);
+L20c0:
+    AOT_BLOCK(0x20c0, 2);
+    // 20c0: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 20c2: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L20c6:
+    AOT_BLOCK(0x20c6, 2);
+    // 20c6: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20ca: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x20ce);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L20ce:
+    AOT_BLOCK(0x20ce, 3);
+    // 20ce: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 20d0: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20d4: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x20d8);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L20d8:
+    AOT_BLOCK(0x20d8, 2);
+    // 20d8: mov r0, 57e4
+    {
+        src = r[0];
+        b = 0x57e4;
+        WR16(b, src);
+    }
+    // 20dc: mov $59f8, -30(r5)
+    {
+        src = uint16_t(0x59f8);
+        b = uint16_t(r[5] + -48);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x20e2, L20e2);
+L20e2:
+    AOT_BLOCK(0x20e2, 2);
+    // 20e2: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20e6: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x20ea);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L20ea:
+    AOT_BLOCK(0x20ea, 2);
+    // 20ea: mov r0, *-30(r5)
+    {
+        src = r[0];
+        b = RD16(r[5] + -48);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20ee: beq 2108
+    if (Z)
+        AOT_GOTO(0x2108, L2108);
+    AOT_GOTO(0x20f0, L20f0);
+L20f0:
+    AOT_BLOCK(0x20f0, 2);
+    // 20f0: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20f4: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x20f8);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L20f8:
+    AOT_BLOCK(0x20f8, 2);
+    // 20f8: mov -30(r5), r1
+    {
+        a = uint16_t(r[5] + -48);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 20fc: mov r0, 2(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2100, L2100);
+L2100:
+    AOT_BLOCK(0x2100, 2);
+    // 2100: add $4, -30(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -48);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2106: br 20e2
+    AOT_GOTO(0x20e2, L20e2);
+L2108:
+    AOT_BLOCK(0x2108, 4);
+    // 2108: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 210a: mov -30(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -48);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 210e: mov $59f8, -(sp)
+    {
+        src = uint16_t(0x59f8);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2112: jsr pc, *$170a
+    {
+        a = 0x170a;
+        r[6] -= 2;
+        WR16(r[6], 0x2116);
+    }
+    AOT_GOTO(0x170a, L170a);
+L2116:
+    AOT_BLOCK(0x2116, 2);
+    // 2116: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2118: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L211c:
+    AOT_BLOCK(0x211c, 2);
+    // 211c: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2120: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x2124);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L2124:
+    AOT_BLOCK(0x2124, 5);
+    // 2124: mov r0, 57e4
+    {
+        src = r[0];
+        b = 0x57e4;
+        WR16(b, src);
+    }
+    // 2128: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 212a: add $ffd4, r0
+    {
+        src = uint16_t(0xffd4);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 212e: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2130: beq 2142
+    if (Z)
+        AOT_GOTO(0x2142, L2142);
+    AOT_GOTO(0x2132, L2132);
+L2132:
+    AOT_BLOCK(0x2132, 2);
+    // 2132: mov $4415, (sp)
+    {
+        src = uint16_t(0x4415);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2136: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x213a);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L213a:
+    AOT_BLOCK(0x213a, 2);
+    // 213a: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 213e: jsr pc, *$3c68
+    {
+        a = 0x3c68;
+        r[6] -= 2;
+        WR16(r[6], 0x2142);
+    }
+    AOT_GOTO(0x3c68, L3c68);
+L2142:
+    AOT_BLOCK(0x2142, 5);
+    // 2142: clr 59f2
+    {
+        a = 0x59f2;
+        WR16(a, 0);
+    }
+    // 2146: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 2148: mov $5300, -(sp)
+    {
+        src = uint16_t(0x5300);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 214c: mov -(r4), -(sp)
+    {
+        r[4] -= 2;
+        a = r[4];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 214e: jsr pc, 241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x2152);
+    }
+    AOT_GOTO(0x241c, L241c);
+L2152:
+    AOT_BLOCK(0x2152, 3);
+    // 2152: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2154: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2156: jsr pc, *$02ba
+    {
+        a = 0x02ba;
+        r[6] -= 2;
+        WR16(r[6], 0x215a);
+    }
+    AOT_GOTO(0x02ba, L02ba);
+L215a:
+    AOT_BLOCK(0x215a, 3);
+    // 215a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 215c: mov $59f8, 59f6
+    {
+        src = uint16_t(0x59f8);
+        b = 0x59f6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2162: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L2166:
+    AOT_BLOCK(0x2166, 2);
+    // 2166: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 216a: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x216e);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L216e:
+    AOT_BLOCK(0x216e, 3);
+    // 216e: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2170: cmp $c, r3
+    {
+        src = uint16_t(0x000c);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2174: bne 21b6
+    if (!Z)
+        AOT_GOTO(0x21b6, L21b6);
+    AOT_GOTO(0x2176, L2176);
+L2176:
+    AOT_BLOCK(0x2176, 2);
+    // 2176: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 217a: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x217e);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L217e:
+    AOT_BLOCK(0x217e, 12);
+    // 217e: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2180: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 2182: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 2184: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 2186: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 2188: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 218a: mov $c, -(sp)
+    {
+        src = uint16_t(0x000c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 218e: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 2190: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2192: mov $14, -(sp)
+    {
+        src = uint16_t(0x0014);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2196: mov $6, -(sp)
+    {
+        src = uint16_t(0x0006);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 219a: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x219e);
+    }
+    AOT_GOTO(0x3146, L3146);
+L219e:
+    AOT_BLOCK(0x219e, 5);
+    // 219e: add $12, sp
+    {
+        src = uint16_t(0x0012);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 21a2: mov r0, (r4)
+    {
+        src = r[0];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 21a4: mov (r4), (sp)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 21a6: add $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 21aa: jsr pc, *$2398
+    {
+        a = 0x2398;
+        r[6] -= 2;
+        WR16(r[6], 0x21ae);
+    }
+    AOT_GOTO(0x2398, L2398);
+L21ae:
+    AOT_BLOCK(0x21ae, 2);
+    // 21ae: add $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 21b2: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L21b6:
+    AOT_BLOCK(0x21b6, 8);
+    // 21b6: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 21b8: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 21ba: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 21bc: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 21be: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 21c0: mov $14, -(sp)
+    {
+        src = uint16_t(0x0014);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 21c4: mov $3, -(sp)
+    {
+        src = uint16_t(0x0003);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21c8: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x21cc);
+    }
+    AOT_GOTO(0x3146, L3146);
+L21cc:
+    AOT_BLOCK(0x21cc, 4);
+    // 21cc: add $c, sp
+    {
+        src = uint16_t(0x000c);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 21d0: mov r0, (r4)
+    {
+        src = r[0];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 21d2: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21d6: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x21da);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L21da:
+    AOT_BLOCK(0x21da, 4);
+    // 21da: mov (r4), r1
+    {
+        a = r[4];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 21dc: mov r0, 2(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 2);
+        WR16(b, src);
+    }
+    // 21e0: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21e4: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x21e8);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L21e8:
+    AOT_BLOCK(0x21e8, 4);
+    // 21e8: mov (r4), r1
+    {
+        a = r[4];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 21ea: mov r0, a(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 10);
+        WR16(b, src);
+    }
+    // 21ee: add $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 21f2: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L21f6:
+    AOT_BLOCK(0x21f6, 2);
+    // 21f6: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21fa: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x21fe);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L21fe:
+    AOT_BLOCK(0x21fe, 3);
+    // 21fe: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2200: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2204: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x2208);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L2208:
+    AOT_BLOCK(0x2208, 6);
+    // 2208: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 220a: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 220c: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 220e: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2210: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2214: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x2218);
+    }
+    AOT_GOTO(0x3146, L3146);
+L2218:
+    AOT_BLOCK(0x2218, 3);
+    // 2218: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 221c: mov r0, (r4)+
+    {
+        src = r[0];
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 221e: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L2222:
+    AOT_BLOCK(0x2222, 2);
+    // 2222: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2226: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x222a);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L222a:
+    AOT_BLOCK(0x222a, 3);
+    // 222a: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 222c: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2230: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x2234);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L2234:
+    AOT_BLOCK(0x2234, 7);
+    // 2234: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2236: mov -2(r4), -(sp)
+    {
+        a = uint16_t(r[4] + -2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 223a: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 223c: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 223e: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2240: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2244: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x2248);
+    }
+    AOT_GOTO(0x3146, L3146);
+L2248:
+    AOT_BLOCK(0x2248, 3);
+    // 2248: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 224c: mov r0, -2(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + -2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2250: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L2254:
+    AOT_BLOCK(0x2254, 5);
+    // 2254: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 2256: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 2258: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 225a: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 225c: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x2260);
+    }
+    AOT_GOTO(0x3146, L3146);
+L2260:
+    AOT_BLOCK(0x2260, 3);
+    // 2260: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 2264: mov r0, (r4)+
+    {
+        src = r[0];
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2266: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L226a:
+    AOT_BLOCK(0x226a, 2);
+    // 226a: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 226e: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x2272);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L2272:
+    AOT_BLOCK(0x2272, 3);
+    // 2272: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2274: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2278: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x227c);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L227c:
+    AOT_BLOCK(0x227c, 6);
+    // 227c: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 227e: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2280: mov -2(r4), -(sp)
+    {
+        a = uint16_t(r[4] + -2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2284: mov $67, -(sp)
+    {
+        src = uint16_t(0x0067);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2288: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 228c: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x2290);
+    }
+    AOT_GOTO(0x3146, L3146);
+L2290:
+    AOT_BLOCK(0x2290, 3);
+    // 2290: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 2294: mov r0, -2(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + -2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2298: jmp *$2390
+    {
+        a = 0x2390;
+    }
+    AOT_GOTO(0x2390, L2390);
+L229c:
+    AOT_BLOCK(0x229c, 2);
+    // 229c: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22a0: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x22a4);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L22a4:
+    AOT_BLOCK(0x22a4, 2);
+    // 22a4: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22a6: jsr pc, *$1e12
+    {
+        a = 0x1e12;
+        r[6] -= 2;
+        WR16(r[6], 0x22aa);
+    }
+    AOT_GOTO(0x1e12, L1e12);
+L22aa:
+    AOT_BLOCK(0x22aa, 1);
+    // 22aa: br 2390
+    AOT_GOTO(0x2390, L2390);
+L22ac:
+    AOT_BLOCK(0x22ac, 2);
+    // 22ac: mov $5de8, (sp)
+    {
+        src = uint16_t(0x5de8);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22b0: jsr pc, *$2398
+    {
+        a = 0x2398;
+        r[6] -= 2;
+        WR16(r[6], 0x22b4);
+    }
+    AOT_GOTO(0x2398, L2398);
+L22b4:
+    AOT_BLOCK(0x22b4, 3);
+    // 22b4: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 22b6: mov $442d, -(sp)
+    {
+        src = uint16_t(0x442d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22ba: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x22be);
+    }
+    AOT_GOTO(0x396a, L396a);
+L22be:
+    AOT_BLOCK(0x22be, 2);
+    // 22be: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 22c0: br 2390
+    AOT_GOTO(0x2390, L2390);
+L22c2:
+    AOT_BLOCK(0x22c2, 2);
+    // 22c2: mov $5de8, (sp)
+    {
+        src = uint16_t(0x5de8);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22c6: jsr pc, *$2398
+    {
+        a = 0x2398;
+        r[6] -= 2;
+        WR16(r[6], 0x22ca);
+    }
+    AOT_GOTO(0x2398, L2398);
+L22ca:
+    AOT_BLOCK(0x22ca, 5);
+    // 22ca: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 22cc: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 22ce: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 22d0: mov $4433, -(sp)
+    {
+        src = uint16_t(0x4433);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22d4: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x22d8);
+    }
+    AOT_GOTO(0x396a, L396a);
+L22d8:
+    AOT_BLOCK(0x22d8, 2);
+    // 22d8: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 22da: br 2390
+    AOT_GOTO(0x2390, L2390);
+L22dc:
+    AOT_BLOCK(0x22dc, 3);
+    // 22dc: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 22de: mov $57e6, -(sp)
+    {
+        src = uint16_t(0x57e6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22e2: jsr pc, 3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x22e6);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L22e6:
+    AOT_BLOCK(0x22e6, 3);
+    // 22e6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 22e8: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22ea: jsr pc, *$1ddc
+    {
+        a = 0x1ddc;
+        r[6] -= 2;
+        WR16(r[6], 0x22ee);
+    }
+    AOT_GOTO(0x1ddc, L1ddc);
+L22ee:
+    AOT_BLOCK(0x22ee, 2);
+    // 22ee: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 22f0: br 2390
+    AOT_GOTO(0x2390, L2390);
+L22f2:
+    AOT_BLOCK(0x22f2, 2);
+    // 22f2: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22f6: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x22fa);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L22fa:
+    AOT_BLOCK(0x22fa, 3);
+    // 22fa: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+    }
+    // 22fc: mov r0, 3cea
+    {
+        src = r[0];
+        b = 0x3cea;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2300: br 2390
+    AOT_GOTO(0x2390, L2390);
+L2302:
+    AOT_BLOCK(0x2302, 4);
+    // 2302: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 2304: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 2306: bit $1, 4568(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 230c: beq 234e
+    if (Z)
+        AOT_GOTO(0x234e, L234e);
+    AOT_GOTO(0x230e, L230e);
+L230e:
+    AOT_BLOCK(0x230e, 4);
+    // 230e: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 2310: add $ffd4, r0
+    {
+        src = uint16_t(0xffd4);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2314: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2316: bcc 2328
+    if (!C)
+        AOT_GOTO(0x2328, L2328);
+    AOT_GOTO(0x2318, L2318);
+L2318:
+    AOT_BLOCK(0x2318, 2);
+    // 2318: mov $443f, (sp)
+    {
+        src = uint16_t(0x443f);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 231c: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x2320);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L2320:
+    AOT_BLOCK(0x2320, 2);
+    // 2320: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2324: jsr pc, *$3c68
+    {
+        a = 0x3c68;
+        r[6] -= 2;
+        WR16(r[6], 0x2328);
+    }
+    AOT_GOTO(0x3c68, L3c68);
+L2328:
+    AOT_BLOCK(0x2328, 2);
+    // 2328: mov -(r4), r3
+    {
+        r[4] -= 2;
+        a = r[4];
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 232a: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x232c, L232c);
+L232c:
+    AOT_BLOCK(0x232c, 4);
+    // 232c: mov -(r4), -(sp)
+    {
+        r[4] -= 2;
+        a = r[4];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 232e: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 2330: mov $57e6, -(sp)
+    {
+        src = uint16_t(0x57e6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2334: jsr pc, 3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x2338);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L2338:
+    AOT_BLOCK(0x2338, 5);
+    // 2338: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 233a: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 233c: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 233e: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2342: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x2346);
+    }
+    AOT_GOTO(0x3146, L3146);
+L2346:
+    AOT_BLOCK(0x2346, 3);
+    // 2346: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 234a: mov r0, (r4)+
+    {
+        src = r[0];
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 234c: br 2372
+    AOT_GOTO(0x2372, L2372);
+L234e:
+    AOT_BLOCK(0x234e, 4);
+    // 234e: mov -2(r4), (sp)
+    {
+        a = uint16_t(r[4] + -2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2352: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 2354: mov $57e6, -(sp)
+    {
+        src = uint16_t(0x57e6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2358: jsr pc, 3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x235c);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L235c:
+    AOT_BLOCK(0x235c, 5);
+    // 235c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 235e: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2360: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2362: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2366: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x236a);
+    }
+    AOT_GOTO(0x3146, L3146);
+L236a:
+    AOT_BLOCK(0x236a, 2);
+    // 236a: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 236e: mov r0, -2(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + -2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2372, L2372);
+L2372:
+    AOT_BLOCK(0x2372, 1);
+    // 2372: br 2390
+    AOT_GOTO(0x2390, L2390);
+L2376:
+    AOT_BLOCK(0x2376, 7);
+    // 2376: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 2378: clr r0
+    {
+        r[0] = 0;
+    }
+    // 237a: div $b, r0
+    {
+        src = int16_t(uint16_t(0x000b));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 237e: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 2380: add $4130, r1
+    {
+        src = uint16_t(0x4130);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 2384: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 2386: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2388, L2388);
+L2388:
+    AOT_BLOCK(0x2388, 2);
+    // 2388: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 238a: bne 2388
+    if (!Z)
+        AOT_GOTO(0x2388, L2388);
+    AOT_GOTO(0x238c, L238c);
+L238c:
+    AOT_BLOCK(0x238c, 1);
+    // 238c: jmp *52(r1)
+    {
+        a = RD16(r[1] + 82);
+    }
+    AOT_JUMP(a);
+L2390:
+    AOT_BLOCK(0x2390, 1);
+    // 2390: jmp *$1f02
+    {
+        a = 0x1f02;
+    }
+    AOT_GOTO(0x1f02, L1f02);
+L2394:
+    AOT_BLOCK(0x2394, 2);
+    // 2394: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2398:
+    AOT_BLOCK(0x2398, 4);
+    // 2398: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x239c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 239c: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 23a0: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x23a2, L23a2);
+L23a2:
+    AOT_BLOCK(0x23a2, 2);
+    // 23a2: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23a6: jsr pc, *$3c24
+    {
+        a = 0x3c24;
+        r[6] -= 2;
+        WR16(r[6], 0x23aa);
+    }
+    AOT_GOTO(0x3c24, L3c24);
+L23aa:
+    AOT_BLOCK(0x23aa, 2);
+    // 23aa: movb r0, r3
+    {
+        src = uint8_t(r[0]);
+        r[3] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 23ac: beq 23b4
+    if (Z)
+        AOT_GOTO(0x23b4, L23b4);
+    AOT_GOTO(0x23ae, L23ae);
+L23ae:
+    AOT_BLOCK(0x23ae, 3);
+    // 23ae: movb r3, (r4)+
+    {
+        src = uint8_t(r[3]);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+    }
+    // 23b0: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 23b2: br 23a2
+    AOT_GOTO(0x23a2, L23a2);
+L23b4:
+    AOT_BLOCK(0x23b4, 4);
+    // 23b4: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 23b6: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 23b8: cmp $8, r0
+    {
+        src = uint16_t(0x0008);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 23bc: ble 23c2
+    if (Z || (N ^ V))
+        AOT_GOTO(0x23c2, L23c2);
+    AOT_GOTO(0x23be, L23be);
+L23be:
+    AOT_BLOCK(0x23be, 2);
+    // 23be: clrb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 23c0: br 23b4
+    AOT_GOTO(0x23b4, L23b4);
+L23c2:
+    AOT_BLOCK(0x23c2, 2);
+    // 23c2: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23c6: br 23c8
+    AOT_GOTO(0x23c8, L23c8);
+L23c8:
+    AOT_BLOCK(0x23c8, 2);
+    // 23c8: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L23cc:
+    AOT_BLOCK(0x23cc, 4);
+    // 23cc: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x23d0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 23d0: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23d4: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x23d8);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L23d8:
+    AOT_BLOCK(0x23d8, 2);
+    // 23d8: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 23da: beq 2418
+    if (Z)
+        AOT_GOTO(0x2418, L2418);
+    AOT_GOTO(0x23dc, L23dc);
+L23dc:
+    AOT_BLOCK(0x23dc, 2);
+    // 23dc: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23e0: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x23e4);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L23e4:
+    AOT_BLOCK(0x23e4, 3);
+    // 23e4: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 23e6: mov $4457, -(sp)
+    {
+        src = uint16_t(0x4457);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23ea: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x23ee);
+    }
+    AOT_GOTO(0x396a, L396a);
+L23ee:
+    AOT_BLOCK(0x23ee, 3);
+    // 23ee: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 23f0: mov $57e6, (sp)
+    {
+        src = uint16_t(0x57e6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23f4: jsr pc, *$3bde
+    {
+        a = 0x3bde;
+        r[6] -= 2;
+        WR16(r[6], 0x23f8);
+    }
+    AOT_GOTO(0x3bde, L3bde);
+L23f8:
+    AOT_BLOCK(0x23f8, 3);
+    // 23f8: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 23fa: cmp $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 23fe: bne 2410
+    if (!Z)
+        AOT_GOTO(0x2410, L2410);
+    AOT_GOTO(0x2400, L2400);
+L2400:
+    AOT_BLOCK(0x2400, 3);
+    // 2400: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2404: mov $445a, -(sp)
+    {
+        src = uint16_t(0x445a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2408: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x240c);
+    }
+    AOT_GOTO(0x396a, L396a);
+L240c:
+    AOT_BLOCK(0x240c, 2);
+    // 240c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 240e: br 23dc
+    AOT_GOTO(0x23dc, L23dc);
+L2410:
+    AOT_BLOCK(0x2410, 2);
+    // 2410: mov $445d, (sp)
+    {
+        src = uint16_t(0x445d);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2414: jsr pc, *$396a
+    {
+        a = 0x396a;
+        r[6] -= 2;
+        WR16(r[6], 0x2418);
+    }
+    AOT_GOTO(0x396a, L396a);
+L2418:
+    AOT_BLOCK(0x2418, 2);
+    // 2418: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L241c:
+    AOT_BLOCK(0x241c, 6);
+    // 241c: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2420;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2420: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 2424: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2428: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 242a: bne 2432
+    if (!Z)
+        AOT_GOTO(0x2432, L2432);
+    AOT_GOTO(0x242c, L242c);
+L242c:
+    AOT_BLOCK(0x242c, 2);
+    // 242c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 242e: jmp *$27cc
+    {
+        a = 0x27cc;
+    }
+    AOT_GOTO(0x27cc, L27cc);
+L2432:
+    AOT_BLOCK(0x2432, 3);
+    // 2432: mov (r2), r4
+    {
+        a = r[2];
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2434: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2436: bne 243e
+    if (!Z)
+        AOT_GOTO(0x243e, L243e);
+    AOT_GOTO(0x2438, L2438);
+L2438:
+    AOT_BLOCK(0x2438, 2);
+    // 2438: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 243a: jmp *$27cc
+    {
+        a = 0x27cc;
+    }
+    AOT_GOTO(0x27cc, L27cc);
+L243e:
+    AOT_BLOCK(0x243e, 2);
+    // 243e: cmp $14, r4
+    {
+        src = uint16_t(0x0014);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2442: bne 245e
+    if (!Z)
+        AOT_GOTO(0x245e, L245e);
+    AOT_GOTO(0x2444, L2444);
+L2444:
+    AOT_BLOCK(0x2444, 2);
+    // 2444: cmpb $b, 6(r2)
+    {
+        src = uint8_t(0x0b);
+        b = uint16_t(r[2] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 244a: bne 245e
+    if (!Z)
+        AOT_GOTO(0x245e, L245e);
+    AOT_GOTO(0x244c, L244c);
+L244c:
+    AOT_BLOCK(0x244c, 3);
+    // 244c: movb $14, 6(r2)
+    {
+        src = uint8_t(0x14);
+        b = uint16_t(r[2] + 6);
+        WR8(b, src);
+    }
+    // 2452: movb $5, 7(r2)
+    {
+        src = uint8_t(0x05);
+        b = uint16_t(r[2] + 7);
+        WR8(b, src);
+    }
+    // 2458: mov a(r2), 8(r2)
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        b = uint16_t(r[2] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x245e, L245e);
+L245e:
+    AOT_BLOCK(0x245e, 5);
+    // 245e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2460: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 2462: mov 4568(r0), r3
+    {
+        a = uint16_t(r[0] + 17768);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 2466: bit $100, r3
+    {
+        src = uint16_t(0x0100);
+        dst = r[3];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 246a: beq 2472
+    if (Z)
+        AOT_GOTO(0x2472, L2472);
+    AOT_GOTO(0x246c, L246c);
+L246c:
+    AOT_BLOCK(0x246c, 2);
+    // 246c: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 246e: jmp *$27cc
+    {
+        a = 0x27cc;
+    }
+    AOT_GOTO(0x27cc, L27cc);
+L2472:
+    AOT_BLOCK(0x2472, 2);
+    // 2472: bit $1, r3
+    {
+        src = uint16_t(0x0001);
+        dst = r[3];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2476: bne 2482
+    if (!Z)
+        AOT_GOTO(0x2482, L2482);
+    AOT_GOTO(0x2478, L2478);
+L2478:
+    AOT_BLOCK(0x2478, 2);
+    // 2478: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 247a: jsr pc, *$27d0
+    {
+        a = 0x27d0;
+        r[6] -= 2;
+        WR16(r[6], 0x247e);
+    }
+    AOT_GOTO(0x27d0, L27d0);
+L247e:
+    AOT_BLOCK(0x247e, 1);
+    // 247e: jmp *$27cc
+    {
+        a = 0x27cc;
+    }
+    AOT_GOTO(0x27cc, L27cc);
+L2482:
+    AOT_BLOCK(0x2482, 2);
+    // 2482: cmp $1, 2(r2)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[2] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2488: bne 248e
+    if (!Z)
+        AOT_GOTO(0x248e, L248e);
+    AOT_GOTO(0x248a, L248a);
+L248a:
+    AOT_BLOCK(0x248a, 1);
+    // 248a: clr 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x248e, L248e);
+L248e:
+    AOT_BLOCK(0x248e, 2);
+    // 248e: bit $40, r3
+    {
+        src = uint16_t(0x0040);
+        dst = r[3];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2492: beq 24da
+    if (Z)
+        AOT_GOTO(0x24da, L24da);
+    AOT_GOTO(0x2494, L2494);
+L2494:
+    AOT_BLOCK(0x2494, 3);
+    // 2494: mov 2(r2), -8(r5)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 249a: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 249c: jsr pc, *$2aba
+    {
+        a = 0x2aba;
+        r[6] -= 2;
+        WR16(r[6], 0x24a0);
+    }
+    AOT_GOTO(0x2aba, L2aba);
+L24a0:
+    AOT_BLOCK(0x24a0, 4);
+    // 24a0: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 24a2: mov -8(r5), 2(r2)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 24a8: cmp $2f, (r2)
+    {
+        src = uint16_t(0x002f);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 24ac: beq 24b4
+    if (Z)
+        AOT_GOTO(0x24b4, L24b4);
+    AOT_GOTO(0x24ae, L24ae);
+L24ae:
+    AOT_BLOCK(0x24ae, 2);
+    // 24ae: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24b0: jmp *$27cc
+    {
+        a = 0x27cc;
+    }
+    AOT_GOTO(0x27cc, L27cc);
+L24b4:
+    AOT_BLOCK(0x24b4, 8);
+    // 24b4: mov $37, (r2)
+    {
+        src = uint16_t(0x0037);
+        b = r[2];
+        WR16(b, src);
+    }
+    // 24b8: mov 8(r2), (sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 24bc: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 24be: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 24c2: mov 2(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 24c6: mov $26, -(sp)
+    {
+        src = uint16_t(0x0026);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 24ca: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24ce: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x24d2);
+    }
+    AOT_GOTO(0x3146, L3146);
+L24d2:
+    AOT_BLOCK(0x24d2, 2);
+    // 24d2: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 24d6: mov r0, 8(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x24da, L24da);
+L24da:
+    AOT_BLOCK(0x24da, 2);
+    // 24da: mov 6(r2), (sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24de: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x24e2);
+    }
+    AOT_GOTO(0x241c, L241c);
+L24e2:
+    AOT_BLOCK(0x24e2, 3);
+    // 24e2: mov r0, 6(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 6);
+        WR16(b, src);
+    }
+    // 24e6: mov 8(r2), (sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24ea: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x24ee);
+    }
+    AOT_GOTO(0x241c, L241c);
+L24ee:
+    AOT_BLOCK(0x24ee, 3);
+    // 24ee: mov r0, 8(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 8);
+        WR16(b, src);
+    }
+    // 24f2: bit $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 24f6: beq 2592
+    if (Z)
+        AOT_GOTO(0x2592, L2592);
+    AOT_GOTO(0x24f8, L24f8);
+L24f8:
+    AOT_BLOCK(0x24f8, 2);
+    // 24f8: mov 8(r2), (sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24fc: jsr pc, *$1228
+    {
+        a = 0x1228;
+        r[6] -= 2;
+        WR16(r[6], 0x2500);
+    }
+    AOT_GOTO(0x1228, L1228);
+L2500:
+    AOT_BLOCK(0x2500, 4);
+    // 2500: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 2504: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2506: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 250a: jsr pc, 1228
+    {
+        a = 0x1228;
+        r[6] -= 2;
+        WR16(r[6], 0x250e);
+    }
+    AOT_GOTO(0x1228, L1228);
+L250e:
+    AOT_BLOCK(0x250e, 4);
+    // 250e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 2510: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 2514: cmp (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2516: bgt 2530
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x2530, L2530);
+    AOT_GOTO(0x2518, L2518);
+L2518:
+    AOT_BLOCK(0x2518, 2);
+    // 2518: cmp -a(r5), -8(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 251e: bne 2548
+    if (!Z)
+        AOT_GOTO(0x2548, L2548);
+    AOT_GOTO(0x2520, L2520);
+L2520:
+    AOT_BLOCK(0x2520, 2);
+    // 2520: cmp $14, *6(r2)
+    {
+        src = uint16_t(0x0014);
+        b = RD16(r[2] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2526: bne 2548
+    if (!Z)
+        AOT_GOTO(0x2548, L2548);
+    AOT_GOTO(0x2528, L2528);
+L2528:
+    AOT_BLOCK(0x2528, 2);
+    // 2528: cmp $14, *8(r2)
+    {
+        src = uint16_t(0x0014);
+        b = RD16(r[2] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 252e: beq 2548
+    if (Z)
+        AOT_GOTO(0x2548, L2548);
+    AOT_GOTO(0x2530, L2530);
+L2530:
+    AOT_BLOCK(0x2530, 5);
+    // 2530: mov 6(r2), -c(r5)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 2536: mov 8(r2), 6(r2)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[2] + 6);
+        WR16(b, src);
+    }
+    // 253c: mov -c(r5), 8(r2)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = uint16_t(r[2] + 8);
+        WR16(b, src);
+    }
+    // 2542: movb 3c82(r4), r0
+    {
+        a = uint16_t(r[4] + 15490);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2546: mov r0, (r2)
+    {
+        src = r[0];
+        b = r[2];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2548, L2548);
+L2548:
+    AOT_BLOCK(0x2548, 1);
+    // 2548: mov 6(r2), r0
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x254c, L254c);
+L254c:
+    AOT_BLOCK(0x254c, 2);
+    // 254c: cmp $1, 2(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2552: bne 2592
+    if (!Z)
+        AOT_GOTO(0x2592, L2592);
+    AOT_GOTO(0x2554, L2554);
+L2554:
+    AOT_BLOCK(0x2554, 2);
+    // 2554: cmp $15, *8(r2)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[2] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 255a: bne 2592
+    if (!Z)
+        AOT_GOTO(0x2592, L2592);
+    AOT_GOTO(0x255c, L255c);
+L255c:
+    AOT_BLOCK(0x255c, 2);
+    // 255c: mov 6(r2), (sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2560: jsr pc, *$1474
+    {
+        a = 0x1474;
+        r[6] -= 2;
+        WR16(r[6], 0x2564);
+    }
+    AOT_GOTO(0x1474, L1474);
+L2564:
+    AOT_BLOCK(0x2564, 2);
+    // 2564: cmp $c, r0
+    {
+        src = uint16_t(0x000c);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2568: bge 2572
+    if (!(N ^ V))
+        AOT_GOTO(0x2572, L2572);
+    AOT_GOTO(0x256a, L256a);
+L256a:
+    AOT_BLOCK(0x256a, 2);
+    // 256a: cmp $24, *6(r2)
+    {
+        src = uint16_t(0x0024);
+        b = RD16(r[2] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2570: bne 2592
+    if (!Z)
+        AOT_GOTO(0x2592, L2592);
+    AOT_GOTO(0x2572, L2572);
+L2572:
+    AOT_BLOCK(0x2572, 1);
+    // 2572: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2576, L2576);
+L2576:
+    AOT_BLOCK(0x2576, 2);
+    // 2576: cmp $7f, 6(r0)
+    {
+        src = uint16_t(0x007f);
+        b = uint16_t(r[0] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 257c: blt 2592
+    if (N ^ V)
+        AOT_GOTO(0x2592, L2592);
+    AOT_GOTO(0x257e, L257e);
+L257e:
+    AOT_BLOCK(0x257e, 3);
+    // 257e: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2582: tst 6(r0)
+    {
+        a = uint16_t(r[0] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2586: blt 2592
+    if (N ^ V)
+        AOT_GOTO(0x2592, L2592);
+    AOT_GOTO(0x2588, L2588);
+L2588:
+    AOT_BLOCK(0x2588, 2);
+    // 2588: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 258c: mov $1, 2(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2592, L2592);
+L2592:
+    AOT_BLOCK(0x2592, 2);
+    // 2592: mov 2(r2), (sp)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2596: jsr pc, *$318c
+    {
+        a = 0x318c;
+        r[6] -= 2;
+        WR16(r[6], 0x259a);
+    }
+    AOT_GOTO(0x318c, L318c);
+L259a:
+    AOT_BLOCK(0x259a, 3);
+    // 259a: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 259c: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25a0: jsr pc, 1228
+    {
+        a = 0x1228;
+        r[6] -= 2;
+        WR16(r[6], 0x25a4);
+    }
+    AOT_GOTO(0x1228, L1228);
+L25a4:
+    AOT_BLOCK(0x25a4, 3);
+    // 25a4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 25a6: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25a8: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x25ac);
+    }
+    AOT_GOTO(0x120c, L120c);
+L25ac:
+    AOT_BLOCK(0x25ac, 5);
+    // 25ac: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 25ae: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 25b2: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 25b4: mov 8(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25b8: jsr pc, 1228
+    {
+        a = 0x1228;
+        r[6] -= 2;
+        WR16(r[6], 0x25bc);
+    }
+    AOT_GOTO(0x1228, L1228);
+L25bc:
+    AOT_BLOCK(0x25bc, 3);
+    // 25bc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 25be: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25c0: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x25c4);
+    }
+    AOT_GOTO(0x120c, L120c);
+L25c4:
+    AOT_BLOCK(0x25c4, 5);
+    // 25c4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 25c6: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 25ca: mov 6(r2), r0
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 25ce: cmp $6, 2(r0)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[0] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 25d4: bne 25e2
+    if (!Z)
+        AOT_GOTO(0x25e2, L25e2);
+    AOT_GOTO(0x25d6, L25d6);
+L25d6:
+    AOT_BLOCK(0x25d6, 2);
+    // 25d6: bit $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 25da: beq 25e2
+    if (Z)
+        AOT_GOTO(0x25e2, L25e2);
+    AOT_GOTO(0x25dc, L25dc);
+L25dc:
+    AOT_BLOCK(0x25dc, 1);
+    // 25dc: mov $a, -8(r5)
+    {
+        src = uint16_t(0x000a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x25e2, L25e2);
+L25e2:
+    AOT_BLOCK(0x25e2, 2);
+    // 25e2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25e4: jmp *$27ae
+    {
+        a = 0x27ae;
+    }
+    AOT_GOTO(0x27ae, L27ae);
+L25e8:
+    AOT_BLOCK(0x25e8, 2);
+    // 25e8: mov $a, 4(r2)
+    {
+        src = uint16_t(0x000a);
+        b = uint16_t(r[2] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25ee: jmp *$27c8
+    {
+        a = 0x27c8;
+    }
+    AOT_GOTO(0x27c8, L27c8);
+L25f2:
+    AOT_BLOCK(0x25f2, 9);
+    // 25f2: mov $55, r4
+    {
+        src = uint16_t(0x0055);
+        r[4] = src;
+    }
+    // 25f6: mov r4, (r2)
+    {
+        src = r[4];
+        b = r[2];
+        WR16(b, src);
+    }
+    // 25f8: mov 8(r2), (sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 25fc: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 25fe: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2602: mov 2(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2606: mov $26, -(sp)
+    {
+        src = uint16_t(0x0026);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 260a: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 260e: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x2612);
+    }
+    AOT_GOTO(0x3146, L3146);
+L2612:
+    AOT_BLOCK(0x2612, 3);
+    // 2612: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 2616: mov r0, 8(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 261a: jmp *$24da
+    {
+        a = 0x24da;
+    }
+    AOT_GOTO(0x24da, L24da);
+L261e:
+    AOT_BLOCK(0x261e, 2);
+    // 261e: mov 8(r2), (sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2622: jsr pc, *$31a8
+    {
+        a = 0x31a8;
+        r[6] -= 2;
+        WR16(r[6], 0x2626);
+    }
+    AOT_GOTO(0x31a8, L31a8);
+L2626:
+    AOT_BLOCK(0x2626, 2);
+    // 2626: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2628: beq 263c
+    if (Z)
+        AOT_GOTO(0x263c, L263c);
+    AOT_GOTO(0x262a, L262a);
+L262a:
+    AOT_BLOCK(0x262a, 3);
+    // 262a: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 262e: tst 6(r0)
+    {
+        a = uint16_t(r[0] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2632: bne 263c
+    if (!Z)
+        AOT_GOTO(0x263c, L263c);
+    AOT_GOTO(0x2634, L2634);
+L2634:
+    AOT_BLOCK(0x2634, 2);
+    // 2634: mov 6(r2), r0
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2638: jmp *$27cc
+    {
+        a = 0x27cc;
+    }
+    AOT_GOTO(0x27cc, L27cc);
+L263c:
+    AOT_BLOCK(0x263c, 1);
+    // 263c: jmp *$2782
+    {
+        a = 0x2782;
+    }
+    AOT_GOTO(0x2782, L2782);
+L2640:
+    AOT_BLOCK(0x2640, 2);
+    // 2640: mov $a, 4(r2)
+    {
+        src = uint16_t(0x000a);
+        b = uint16_t(r[2] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2646: jmp *$27c8
+    {
+        a = 0x27c8;
+    }
+    AOT_GOTO(0x27c8, L27c8);
+L264a:
+    AOT_BLOCK(0x264a, 3);
+    // 264a: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 264e: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2652: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x2656);
+    }
+    AOT_GOTO(0x120c, L120c);
+L2656:
+    AOT_BLOCK(0x2656, 3);
+    // 2656: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2658: mov r0, 4(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 265c: jmp *$27c8
+    {
+        a = 0x27c8;
+    }
+    AOT_GOTO(0x27c8, L27c8);
+L2660:
+    AOT_BLOCK(0x2660, 2);
+    // 2660: mov 8(r2), (sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2664: jsr pc, *$31a8
+    {
+        a = 0x31a8;
+        r[6] -= 2;
+        WR16(r[6], 0x2668);
+    }
+    AOT_GOTO(0x31a8, L31a8);
+L2668:
+    AOT_BLOCK(0x2668, 2);
+    // 2668: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 266c: beq 26ac
+    if (Z)
+        AOT_GOTO(0x26ac, L26ac);
+    AOT_GOTO(0x266e, L266e);
+L266e:
+    AOT_BLOCK(0x266e, 4);
+    // 266e: mov $28, (r2)
+    {
+        src = uint16_t(0x0028);
+        b = r[2];
+        WR16(b, src);
+    }
+    // 2672: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2676: cmp $3, 2(r0)
+    {
+        src = uint16_t(0x0003);
+        b = uint16_t(r[0] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 267c: bne 2696
+    if (!Z)
+        AOT_GOTO(0x2696, L2696);
+    AOT_GOTO(0x267e, L267e);
+L267e:
+    AOT_BLOCK(0x267e, 8);
+    // 267e: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2682: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2686: mov *0(sp), -(sp)
+    {
+        a = RD16(r[6] + 0);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 268a: mov $8000, r0
+    {
+        src = uint16_t(0x8000);
+        r[0] = src;
+    }
+    // 268e: xor r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        val = src ^ RD16(b);
+        WR16(b, val);
+    }
+    // 2690: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2692: mov r0, *(sp)+
+    {
+        src = r[0];
+        b = RD16(r[6]);
+        r[6] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2694: br 26a8
+    AOT_GOTO(0x26a8, L26a8);
+L2696:
+    AOT_BLOCK(0x2696, 5);
+    // 2696: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 269a: mov -c(r5), r1
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 269e: mov 6(r1), r1
+    {
+        a = uint16_t(r[1] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 26a2: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 26a4: mov r1, 6(r0)
+    {
+        src = r[1];
+        b = uint16_t(r[0] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x26a8, L26a8);
+L26a8:
+    AOT_BLOCK(0x26a8, 1);
+    // 26a8: jmp *$2494
+    {
+        a = 0x2494;
+    }
+    AOT_GOTO(0x2494, L2494);
+L26ac:
+    AOT_BLOCK(0x26ac, 1);
+    // 26ac: jmp *$2782
+    {
+        a = 0x2782;
+    }
+    AOT_GOTO(0x2782, L2782);
+L26b0:
+    AOT_BLOCK(0x26b0, 2);
+    // 26b0: cmp $15, *8(r2)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[2] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 26b6: bne 26cc
+    if (!Z)
+        AOT_GOTO(0x26cc, L26cc);
+    AOT_GOTO(0x26b8, L26b8);
+L26b8:
+    AOT_BLOCK(0x26b8, 3);
+    // 26b8: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 26bc: cmp $1, 6(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 26c2: bne 26cc
+    if (!Z)
+        AOT_GOTO(0x26cc, L26cc);
+    AOT_GOTO(0x26c4, L26c4);
+L26c4:
+    AOT_BLOCK(0x26c4, 2);
+    // 26c4: mov 6(r2), r0
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26c8: jmp *$27cc
+    {
+        a = 0x27cc;
+    }
+    AOT_GOTO(0x27cc, L27cc);
+L26cc:
+    AOT_BLOCK(0x26cc, 2);
+    // 26cc: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26ce: jsr pc, *$1af4
+    {
+        a = 0x1af4;
+        r[6] -= 2;
+        WR16(r[6], 0x26d2);
+    }
+    AOT_GOTO(0x1af4, L1af4);
+L26d2:
+    AOT_BLOCK(0x26d2, 2);
+    // 26d2: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 26d4: bne 26e2
+    if (!Z)
+        AOT_GOTO(0x26e2, L26e2);
+    AOT_GOTO(0x26d6, L26d6);
+L26d6:
+    AOT_BLOCK(0x26d6, 2);
+    // 26d6: add $2, -8(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 26dc: add $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x26e2, L26e2);
+L26e2:
+    AOT_BLOCK(0x26e2, 2);
+    // 26e2: cmp $6, 2(r2)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[2] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 26e8: bne 26f4
+    if (!Z)
+        AOT_GOTO(0x26f4, L26f4);
+    AOT_GOTO(0x26ea, L26ea);
+L26ea:
+    AOT_BLOCK(0x26ea, 2);
+    // 26ea: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26ec: jsr pc, *$31dc
+    {
+        a = 0x31dc;
+        r[6] -= 2;
+        WR16(r[6], 0x26f0);
+    }
+    AOT_GOTO(0x31dc, L31dc);
+L26f0:
+    AOT_BLOCK(0x26f0, 1);
+    // 26f0: jmp *$27cc
+    {
+        a = 0x27cc;
+    }
+    AOT_GOTO(0x27cc, L27cc);
+L26f4:
+    AOT_BLOCK(0x26f4, 1);
+    // 26f4: br 2754
+    AOT_GOTO(0x2754, L2754);
+L26f6:
+    AOT_BLOCK(0x26f6, 2);
+    // 26f6: cmp $15, *8(r2)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[2] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 26fc: bne 270e
+    if (!Z)
+        AOT_GOTO(0x270e, L270e);
+    AOT_GOTO(0x26fe, L26fe);
+L26fe:
+    AOT_BLOCK(0x26fe, 3);
+    // 26fe: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2702: tst 6(r0)
+    {
+        a = uint16_t(r[0] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2706: bne 270e
+    if (!Z)
+        AOT_GOTO(0x270e, L270e);
+    AOT_GOTO(0x2708, L2708);
+L2708:
+    AOT_BLOCK(0x2708, 2);
+    // 2708: mov 6(r2), r0
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 270c: br 27cc
+    AOT_GOTO(0x27cc, L27cc);
+L270e:
+    AOT_BLOCK(0x270e, 2);
+    // 270e: cmp $2e, r4
+    {
+        src = uint16_t(0x002e);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2712: beq 2754
+    if (Z)
+        AOT_GOTO(0x2754, L2754);
+    AOT_GOTO(0x2714, L2714);
+L2714:
+    AOT_BLOCK(0x2714, 2);
+    // 2714: cmp $4c, r4
+    {
+        src = uint16_t(0x004c);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2718: beq 2754
+    if (Z)
+        AOT_GOTO(0x2754, L2754);
+    AOT_GOTO(0x271a, L271a);
+L271a:
+    AOT_BLOCK(0x271a, 2);
+    // 271a: cmp $15, *8(r2)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[2] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2720: bne 272e
+    if (!Z)
+        AOT_GOTO(0x272e, L272e);
+    AOT_GOTO(0x2722, L2722);
+L2722:
+    AOT_BLOCK(0x2722, 3);
+    // 2722: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2726: cmp $1, 6(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 272c: beq 2754
+    if (Z)
+        AOT_GOTO(0x2754, L2754);
+    AOT_GOTO(0x272e, L272e);
+L272e:
+    AOT_BLOCK(0x272e, 8);
+    // 272e: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 2730: mov r4, (r2)
+    {
+        src = r[4];
+        b = r[2];
+        WR16(b, src);
+    }
+    // 2732: mov 8(r2), (sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2736: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 2738: mov 2(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 273c: mov $25, -(sp)
+    {
+        src = uint16_t(0x0025);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2740: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2744: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x2748);
+    }
+    AOT_GOTO(0x3146, L3146);
+L2748:
+    AOT_BLOCK(0x2748, 3);
+    // 2748: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 274c: mov r0, 8(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2750: jmp *$24da
+    {
+        a = 0x24da;
+    }
+    AOT_GOTO(0x24da, L24da);
+L2754:
+    AOT_BLOCK(0x2754, 2);
+    // 2754: cmp $15, *6(r2)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[2] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 275a: bne 2782
+    if (!Z)
+        AOT_GOTO(0x2782, L2782);
+    AOT_GOTO(0x275c, L275c);
+L275c:
+    AOT_BLOCK(0x275c, 2);
+    // 275c: cmp $15, *8(r2)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[2] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2762: bne 2782
+    if (!Z)
+        AOT_GOTO(0x2782, L2782);
+    AOT_GOTO(0x2764, L2764);
+L2764:
+    AOT_BLOCK(0x2764, 6);
+    // 2764: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2768: mov 6(r0), (sp)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 276c: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2770: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2774: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2776: jsr pc, *$2f42
+    {
+        a = 0x2f42;
+        r[6] -= 2;
+        WR16(r[6], 0x277a);
+    }
+    AOT_GOTO(0x2f42, L2f42);
+L277a:
+    AOT_BLOCK(0x277a, 3);
+    // 277a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 277c: mov 6(r2), r0
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2780: br 27cc
+    AOT_GOTO(0x27cc, L27cc);
+L2782:
+    AOT_BLOCK(0x2782, 2);
+    // 2782: cmp -a(r5), -8(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2788: bne 2798
+    if (!Z)
+        AOT_GOTO(0x2798, L2798);
+    AOT_GOTO(0x278a, L278a);
+L278a:
+    AOT_BLOCK(0x278a, 2);
+    // 278a: mov 2(r2), (sp)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 278e: jsr pc, *$318c
+    {
+        a = 0x318c;
+        r[6] -= 2;
+        WR16(r[6], 0x2792);
+    }
+    AOT_GOTO(0x318c, L318c);
+L2792:
+    AOT_BLOCK(0x2792, 2);
+    // 2792: add -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2796: br 27a6
+    AOT_GOTO(0x27a6, L27a6);
+L2798:
+    AOT_BLOCK(0x2798, 3);
+    // 2798: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 279c: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 27a0: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x27a4);
+    }
+    AOT_GOTO(0x120c, L120c);
+L27a4:
+    AOT_BLOCK(0x27a4, 1);
+    // 27a4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x27a6, L27a6);
+L27a6:
+    AOT_BLOCK(0x27a6, 2);
+    // 27a6: mov r0, 4(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 27aa: br 27c8
+    AOT_GOTO(0x27c8, L27c8);
+L27ae:
+    AOT_BLOCK(0x27ae, 7);
+    // 27ae: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 27b0: clr r0
+    {
+        r[0] = 0;
+    }
+    // 27b2: div $5, r0
+    {
+        src = int16_t(uint16_t(0x0005));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 27b6: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 27b8: add $4460, r1
+    {
+        src = uint16_t(0x4460);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 27bc: mov r0, *(r1)+
+    {
+        src = r[0];
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 27be: mov (r1)+, r1
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x27c0, L27c0);
+L27c0:
+    AOT_BLOCK(0x27c0, 2);
+    // 27c0: cmp r0, -(r1)
+    {
+        src = r[0];
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 27c2: bne 27c0
+    if (!Z)
+        AOT_GOTO(0x27c0, L27c0);
+    AOT_GOTO(0x27c4, L27c4);
+L27c4:
+    AOT_BLOCK(0x27c4, 1);
+    // 27c4: jmp *34(r1)
+    {
+        a = RD16(r[1] + 52);
+    }
+    AOT_JUMP(a);
+L27c8:
+    AOT_BLOCK(0x27c8, 2);
+    // 27c8: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 27ca: br 27cc
+    AOT_GOTO(0x27cc, L27cc);
+L27cc:
+    AOT_BLOCK(0x27cc, 2);
+    // 27cc: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L27d0:
+    AOT_BLOCK(0x27d0, 5);
+    // 27d0: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x27d4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 27d4: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 27d8: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 27da: bne 27e2
+    if (!Z)
+        AOT_GOTO(0x27e2, L27e2);
+    AOT_GOTO(0x27dc, L27dc);
+L27dc:
+    AOT_BLOCK(0x27dc, 2);
+    // 27dc: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 27de: jmp *$2ab6
+    {
+        a = 0x2ab6;
+    }
+    AOT_GOTO(0x2ab6, L2ab6);
+L27e2:
+    AOT_BLOCK(0x27e2, 2);
+    // 27e2: cmp $67, (r3)
+    {
+        src = uint16_t(0x0067);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 27e6: bne 27fa
+    if (!Z)
+        AOT_GOTO(0x27fa, L27fa);
+    AOT_GOTO(0x27e8, L27e8);
+L27e8:
+    AOT_BLOCK(0x27e8, 2);
+    // 27e8: mov 2(r3), (sp)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 27ec: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x27f0);
+    }
+    AOT_GOTO(0x241c, L241c);
+L27f0:
+    AOT_BLOCK(0x27f0, 3);
+    // 27f0: mov r0, 2(r3)
+    {
+        src = r[0];
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+    }
+    // 27f4: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 27f6: jmp *$2ab6
+    {
+        a = 0x2ab6;
+    }
+    AOT_GOTO(0x2ab6, L2ab6);
+L27fa:
+    AOT_BLOCK(0x27fa, 2);
+    // 27fa: mov 6(r3), (sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 27fe: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x2802);
+    }
+    AOT_GOTO(0x241c, L241c);
+L2802:
+    AOT_BLOCK(0x2802, 4);
+    // 2802: mov r0, 6(r3)
+    {
+        src = r[0];
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 2806: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 2808: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 280a: jmp *$2a1a
+    {
+        a = 0x2a1a;
+    }
+    AOT_GOTO(0x2a1a, L2a1a);
+L280e:
+    AOT_BLOCK(0x280e, 6);
+    // 280e: movb 9(r3), r0
+    {
+        a = uint16_t(r[3] + 9);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2812: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2814: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 2816: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 2818: mov $15, -(sp)
+    {
+        src = uint16_t(0x0015);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 281c: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2820, L2820);
+L2820:
+    AOT_BLOCK(0x2820, 1);
+    // 2820: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x2824);
+    }
+    AOT_GOTO(0x3146, L3146);
+L2824:
+    AOT_BLOCK(0x2824, 2);
+    // 2824: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 2828: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x282a, L282a);
+L282a:
+    AOT_BLOCK(0x282a, 1);
+    // 282a: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x282c, L282c);
+L282c:
+    AOT_BLOCK(0x282c, 5);
+    // 282c: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 282e: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 2830: mov $2d, -(sp)
+    {
+        src = uint16_t(0x002d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2834: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2838: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x283c);
+    }
+    AOT_GOTO(0x3146, L3146);
+L283c:
+    AOT_BLOCK(0x283c, 14);
+    // 283c: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 2840: mov r0, 6(r3)
+    {
+        src = r[0];
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 2844: mov $2f, (r3)
+    {
+        src = uint16_t(0x002f);
+        b = r[3];
+        WR16(b, src);
+    }
+    // 2848: clr 2(r3)
+    {
+        a = uint16_t(r[3] + 2);
+        WR16(a, 0);
+        C = false;
+    }
+    // 284c: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+    }
+    // 2850: movb 8(r3), r1
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 2854: ash r1, r0
+    {
+        src = r[1] & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 2856: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2858: dec (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 285a: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 285c: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 285e: mov $15, -(sp)
+    {
+        src = uint16_t(0x0015);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2862: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2866: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x286a);
+    }
+    AOT_GOTO(0x3146, L3146);
+L286a:
+    AOT_BLOCK(0x286a, 4);
+    // 286a: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 286e: mov r0, 8(r3)
+    {
+        src = r[0];
+        b = uint16_t(r[3] + 8);
+        WR16(b, src);
+    }
+    // 2872: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2874: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x2878);
+    }
+    AOT_GOTO(0x241c, L241c);
+L2878:
+    AOT_BLOCK(0x2878, 1);
+    // 2878: jmp *$2ab6
+    {
+        a = 0x2ab6;
+    }
+    AOT_GOTO(0x2ab6, L2ab6);
+L287c:
+    AOT_BLOCK(0x287c, 2);
+    // 287c: cmp $24, (r4)
+    {
+        src = uint16_t(0x0024);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2880: bne 288a
+    if (!Z)
+        AOT_GOTO(0x288a, L288a);
+    AOT_GOTO(0x2882, L2882);
+L2882:
+    AOT_BLOCK(0x2882, 2);
+    // 2882: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2886: jmp *$2ab6
+    {
+        a = 0x2ab6;
+    }
+    AOT_GOTO(0x2ab6, L2ab6);
+L288a:
+    AOT_BLOCK(0x288a, 2);
+    // 288a: cmp $14, (r4)
+    {
+        src = uint16_t(0x0014);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 288e: bne 28e6
+    if (!Z)
+        AOT_GOTO(0x28e6, L28e6);
+    AOT_GOTO(0x2890, L2890);
+L2890:
+    AOT_BLOCK(0x2890, 2);
+    // 2890: cmpb $14, 6(r4)
+    {
+        src = uint8_t(0x14);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2896: bne 28e6
+    if (!Z)
+        AOT_GOTO(0x28e6, L28e6);
+    AOT_GOTO(0x2898, L2898);
+L2898:
+    AOT_BLOCK(0x2898, 7);
+    // 2898: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 289a: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 289c: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 28a0: mov 2(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 28a4: mov $28, -(sp)
+    {
+        src = uint16_t(0x0028);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 28a8: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 28ac: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x28b0);
+    }
+    AOT_GOTO(0x3146, L3146);
+L28b0:
+    AOT_BLOCK(0x28b0, 13);
+    // 28b0: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 28b4: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 28b6: mov 2(r3), 2(r4)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 28bc: mov $15, (r3)
+    {
+        src = uint16_t(0x0015);
+        b = r[3];
+        WR16(b, src);
+    }
+    // 28c0: clr 2(r3)
+    {
+        a = uint16_t(r[3] + 2);
+        WR16(a, 0);
+    }
+    // 28c4: clr 4(r3)
+    {
+        a = uint16_t(r[3] + 4);
+        WR16(a, 0);
+    }
+    // 28c8: mov 8(r4), 6(r3)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 28ce: movb $e, 6(r4)
+    {
+        src = uint8_t(0x0e);
+        b = uint16_t(r[4] + 6);
+        WR8(b, src);
+    }
+    // 28d4: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 28d8: mov r0, a(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+    }
+    // 28dc: clr 8(r4)
+    {
+        a = uint16_t(r[4] + 8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 28e0: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 28e2: jmp *$2ab6
+    {
+        a = 0x2ab6;
+    }
+    AOT_GOTO(0x2ab6, L2ab6);
+L28e6:
+    AOT_BLOCK(0x28e6, 1);
+    // 28e6: jmp *$2a2a
+    {
+        a = 0x2a2a;
+    }
+    AOT_GOTO(0x2a2a, L2a2a);
+L28ea:
+    AOT_BLOCK(0x28ea, 2);
+    // 28ea: cmp $23, (r4)
+    {
+        src = uint16_t(0x0023);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 28ee: bne 28f8
+    if (!Z)
+        AOT_GOTO(0x28f8, L28f8);
+    AOT_GOTO(0x28f0, L28f0);
+L28f0:
+    AOT_BLOCK(0x28f0, 2);
+    // 28f0: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 28f4: jmp *$2ab6
+    {
+        a = 0x2ab6;
+    }
+    AOT_GOTO(0x2ab6, L2ab6);
+L28f8:
+    AOT_BLOCK(0x28f8, 2);
+    // 28f8: cmp $14, (r4)
+    {
+        src = uint16_t(0x0014);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 28fc: bne 291e
+    if (!Z)
+        AOT_GOTO(0x291e, L291e);
+    AOT_GOTO(0x28fe, L28fe);
+L28fe:
+    AOT_BLOCK(0x28fe, 2);
+    // 28fe: cmpb $e, 6(r4)
+    {
+        src = uint8_t(0x0e);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2904: bne 291e
+    if (!Z)
+        AOT_GOTO(0x291e, L291e);
+    AOT_GOTO(0x2906, L2906);
+L2906:
+    AOT_BLOCK(0x2906, 5);
+    // 2906: mov 2(r3), 2(r4)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 290c: movb $14, 6(r4)
+    {
+        src = uint8_t(0x14);
+        b = uint16_t(r[4] + 6);
+        WR8(b, src);
+    }
+    // 2912: movb a(r4), 7(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD8(a);
+        b = uint16_t(r[4] + 7);
+        WR8(b, src);
+    }
+    // 2918: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 291a: jmp *$2ab6
+    {
+        a = 0x2ab6;
+    }
+    AOT_GOTO(0x2ab6, L2ab6);
+L291e:
+    AOT_BLOCK(0x291e, 3);
+    // 291e: mov 6(r4), r2
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2922: cmp $20, (r4)
+    {
+        src = uint16_t(0x0020);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2926: beq 292e
+    if (Z)
+        AOT_GOTO(0x292e, L292e);
+    AOT_GOTO(0x2928, L2928);
+L2928:
+    AOT_BLOCK(0x2928, 2);
+    // 2928: cmp $1f, (r4)
+    {
+        src = uint16_t(0x001f);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 292c: bne 296a
+    if (!Z)
+        AOT_GOTO(0x296a, L296a);
+    AOT_GOTO(0x292e, L292e);
+L292e:
+    AOT_BLOCK(0x292e, 2);
+    // 292e: cmp $6, 2(r3)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2934: beq 296a
+    if (Z)
+        AOT_GOTO(0x296a, L296a);
+    AOT_GOTO(0x2936, L2936);
+L2936:
+    AOT_BLOCK(0x2936, 2);
+    // 2936: cmp $14, (r2)
+    {
+        src = uint16_t(0x0014);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 293a: bne 296a
+    if (!Z)
+        AOT_GOTO(0x296a, L296a);
+    AOT_GOTO(0x293c, L293c);
+L293c:
+    AOT_BLOCK(0x293c, 2);
+    // 293c: cmpb $e, 6(r2)
+    {
+        src = uint8_t(0x0e);
+        b = uint16_t(r[2] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2942: bne 296a
+    if (!Z)
+        AOT_GOTO(0x296a, L296a);
+    AOT_GOTO(0x2944, L2944);
+L2944:
+    AOT_BLOCK(0x2944, 1);
+    // 2944: cmp 2(r4), 2(r2)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[2] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x294a, L294a);
+L294a:
+    AOT_BLOCK(0x294a, 1);
+    // 294a: bne 296a
+    if (!Z)
+        AOT_GOTO(0x296a, L296a);
+    AOT_GOTO(0x294c, L294c);
+L294c:
+    AOT_BLOCK(0x294c, 3);
+    // 294c: mov 2(r3), 2(r2)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 2952: cmp $20, (r4)
+    {
+        src = uint16_t(0x0020);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2956: bne 295e
+    if (!Z)
+        AOT_GOTO(0x295e, L295e);
+    AOT_GOTO(0x2958, L2958);
+L2958:
+    AOT_BLOCK(0x2958, 2);
+    // 2958: mov $1b, r0
+    {
+        src = uint16_t(0x001b);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 295c: br 2962
+    AOT_GOTO(0x2962, L2962);
+L295e:
+    AOT_BLOCK(0x295e, 1);
+    // 295e: mov $1c, r0
+    {
+        src = uint16_t(0x001c);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2962, L2962);
+L2962:
+    AOT_BLOCK(0x2962, 3);
+    // 2962: mov r0, (r2)
+    {
+        src = r[0];
+        b = r[2];
+        WR16(b, src);
+    }
+    // 2964: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2966: jmp *$2ab6
+    {
+        a = 0x2ab6;
+    }
+    AOT_GOTO(0x2ab6, L2ab6);
+L296a:
+    AOT_BLOCK(0x296a, 2);
+    // 296a: cmp $28, (r4)
+    {
+        src = uint16_t(0x0028);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 296e: bne 29d8
+    if (!Z)
+        AOT_GOTO(0x29d8, L29d8);
+    AOT_GOTO(0x2970, L2970);
+L2970:
+    AOT_BLOCK(0x2970, 2);
+    // 2970: cmp $14, (r2)
+    {
+        src = uint16_t(0x0014);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2974: bne 29d8
+    if (!Z)
+        AOT_GOTO(0x29d8, L29d8);
+    AOT_GOTO(0x2976, L2976);
+L2976:
+    AOT_BLOCK(0x2976, 2);
+    // 2976: cmpb $e, 6(r2)
+    {
+        src = uint8_t(0x0e);
+        b = uint16_t(r[2] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 297c: bne 29d8
+    if (!Z)
+        AOT_GOTO(0x29d8, L29d8);
+    AOT_GOTO(0x297e, L297e);
+L297e:
+    AOT_BLOCK(0x297e, 2);
+    // 297e: cmp $15, *8(r4)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[4] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2984: bne 29a8
+    if (!Z)
+        AOT_GOTO(0x29a8, L29a8);
+    AOT_GOTO(0x2986, L2986);
+L2986:
+    AOT_BLOCK(0x2986, 7);
+    // 2986: mov 8(r4), r0
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 298a: add 6(r0), 8(r2)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = uint16_t(r[2] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2990: movb $14, 6(r2)
+    {
+        src = uint8_t(0x14);
+        b = uint16_t(r[2] + 6);
+        WR8(b, src);
+    }
+    // 2996: mov 2(r3), 2(r2)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 299c: movb a(r2), 7(r2)
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD8(a);
+        b = uint16_t(r[2] + 7);
+        WR8(b, src);
+    }
+    // 29a2: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 29a4: jmp *$2ab6
+    {
+        a = 0x2ab6;
+    }
+    AOT_GOTO(0x2ab6, L2ab6);
+L29a8:
+    AOT_BLOCK(0x29a8, 2);
+    // 29a8: cmp $23, *8(r4)
+    {
+        src = uint16_t(0x0023);
+        b = RD16(r[4] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 29ae: bne 29d8
+    if (!Z)
+        AOT_GOTO(0x29d8, L29d8);
+    AOT_GOTO(0x29b0, L29b0);
+L29b0:
+    AOT_BLOCK(0x29b0, 10);
+    // 29b0: mov 8(r4), r0
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 29b4: mov 6(r0), r4
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 29b8: mov $9, r0
+    {
+        src = uint16_t(0x0009);
+        r[0] = src;
+    }
+    // 29bc: movb 6(r4), r1
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 29c0: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 29c2: movb r1, 6(r4)
+    {
+        src = uint8_t(r[1]);
+        b = uint16_t(r[4] + 6);
+        WR8(b, src);
+    }
+    // 29c6: movb a(r2), 7(r4)
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD8(a);
+        b = uint16_t(r[4] + 7);
+        WR8(b, src);
+    }
+    // 29cc: mov 2(r3), 2(r4)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 29d2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 29d4: jmp *$2ab6
+    {
+        a = 0x2ab6;
+    }
+    AOT_GOTO(0x2ab6, L2ab6);
+L29d8:
+    AOT_BLOCK(0x29d8, 1);
+    // 29d8: br 2a2a
+    AOT_GOTO(0x2a2a, L2a2a);
+L29da:
+    AOT_BLOCK(0x29da, 4);
+    // 29da: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 29dc: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 29de: bit $4, 4568(r0)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[0] + 17768);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 29e4: beq 2a2a
+    if (Z)
+        AOT_GOTO(0x2a2a, L2a2a);
+    AOT_GOTO(0x29e6, L29e6);
+L29e6:
+    AOT_BLOCK(0x29e6, 5);
+    // 29e6: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 29e8: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 29ea: movb 3c8c(r0), r0
+    {
+        a = uint16_t(r[0] + 15500);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 29ee: mov r0, (r3)
+    {
+        src = r[0];
+        b = r[3];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 29f0: br 2a2a
+    AOT_GOTO(0x2a2a, L2a2a);
+L29f2:
+    AOT_BLOCK(0x29f2, 2);
+    // 29f2: cmp $1, 2(r3)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 29f8: bne 29fe
+    if (!Z)
+        AOT_GOTO(0x29fe, L29fe);
+    AOT_GOTO(0x29fa, L29fa);
+L29fa:
+    AOT_BLOCK(0x29fa, 1);
+    // 29fa: clr 2(r3)
+    {
+        a = uint16_t(r[3] + 2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x29fe, L29fe);
+L29fe:
+    AOT_BLOCK(0x29fe, 1);
+    // 29fe: cmp (r4), (r3)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2a00, L2a00);
+L2a00:
+    AOT_BLOCK(0x2a00, 1);
+    // 2a00: bne 2a08
+    if (!Z)
+        AOT_GOTO(0x2a08, L2a08);
+    AOT_GOTO(0x2a02, L2a02);
+L2a02:
+    AOT_BLOCK(0x2a02, 2);
+    // 2a02: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a06: br 2ab6
+    AOT_GOTO(0x2ab6, L2ab6);
+L2a08:
+    AOT_BLOCK(0x2a08, 2);
+    // 2a08: cmp $3a, (r4)
+    {
+        src = uint16_t(0x003a);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a0c: bne 2a18
+    if (!Z)
+        AOT_GOTO(0x2a18, L2a18);
+    AOT_GOTO(0x2a0e, L2a0e);
+L2a0e:
+    AOT_BLOCK(0x2a0e, 3);
+    // 2a0e: mov (r3), (r4)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 2a10: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        C = false;
+    }
+    // 2a14: mov $3a, (r3)
+    {
+        src = uint16_t(0x003a);
+        b = r[3];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2a18, L2a18);
+L2a18:
+    AOT_BLOCK(0x2a18, 1);
+    // 2a18: br 2a2a
+    AOT_GOTO(0x2a2a, L2a2a);
+L2a1a:
+    AOT_BLOCK(0x2a1a, 2);
+    // 2a1a: mov $44d4, r1
+    {
+        src = uint16_t(0x44d4);
+        r[1] = src;
+    }
+    // 2a1e: mov r0, 44e0
+    {
+        src = r[0];
+        b = 0x44e0;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2a22, L2a22);
+L2a22:
+    AOT_BLOCK(0x2a22, 2);
+    // 2a22: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a24: bne 2a22
+    if (!Z)
+        AOT_GOTO(0x2a22, L2a22);
+    AOT_GOTO(0x2a26, L2a26);
+L2a26:
+    AOT_BLOCK(0x2a26, 1);
+    // 2a26: jmp *c(r1)
+    {
+        a = RD16(r[1] + 12);
+    }
+    AOT_JUMP(a);
+L2a2a:
+    AOT_BLOCK(0x2a2a, 2);
+    // 2a2a: cmp $15, (r4)
+    {
+        src = uint16_t(0x0015);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a2e: bne 2a94
+    if (!Z)
+        AOT_GOTO(0x2a94, L2a94);
+    AOT_GOTO(0x2a30, L2a30);
+L2a30:
+    AOT_BLOCK(0x2a30, 2);
+    // 2a30: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a32: br 2a84
+    AOT_GOTO(0x2a84, L2a84);
+L2a34:
+    AOT_BLOCK(0x2a34, 5);
+    // 2a34: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2a38: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        C = val != 0;
+    }
+    // 2a3a: mov r0, 6(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 2a3e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a40: br 2ab6
+    AOT_GOTO(0x2ab6, L2ab6);
+L2a42:
+    AOT_BLOCK(0x2a42, 5);
+    // 2a42: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2a46: com r0
+    {
+        val = ~int(r[0]);
+        r[0] = val;
+        C = true;
+    }
+    // 2a48: mov r0, 6(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 2a4c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a4e: br 2ab6
+    AOT_GOTO(0x2ab6, L2ab6);
+L2a50:
+    // 2a50: (undefined)
+    AOT_INTERP(0x2a50);
+L2a52:
+    // 2a52: rtt
+    AOT_INTERP(0x2a52);
+L2a54:
+    // 2a54: (undefined)
+    AOT_INTERP(0x2a54);
+L2a56:
+    AOT_BLOCK(0x2a56, 5);
+    // 2a56: bit (sp), *(r2)+
+    {
+        a = r[6];
+        src = RD16(a);
+        b = RD16(r[2]);
+        r[2] += 2;
+        dst = RD16(b);
+        val = src & dst;
+    }
+    // 2a58: mov $5df2, r2
+    {
+        src = uint16_t(0x5df2);
+        r[2] = src;
+    }
+    // 2a5c: add $2, r2
+    {
+        src = uint16_t(0x0002);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 2a60: tst (r2)+
+    {
+        a = r[2];
+        r[2] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2a62: bne 2a80
+    if (!Z)
+        AOT_GOTO(0x2a80, L2a80);
+    AOT_GOTO(0x2a64, L2a64);
+L2a64:
+    AOT_BLOCK(0x2a64, 2);
+    // 2a64: tst (r2)+
+    {
+        a = r[2];
+        r[2] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2a66: bne 2a80
+    if (!Z)
+        AOT_GOTO(0x2a80, L2a80);
+    AOT_GOTO(0x2a68, L2a68);
+L2a68:
+    AOT_BLOCK(0x2a68, 2);
+    // 2a68: tst (r2)+
+    {
+        a = r[2];
+        r[2] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2a6a: bne 2a80
+    if (!Z)
+        AOT_GOTO(0x2a80, L2a80);
+    AOT_GOTO(0x2a6c, L2a6c);
+L2a6c:
+    AOT_BLOCK(0x2a6c, 5);
+    // 2a6c: mov $3, 2(r4)
+    {
+        src = uint16_t(0x0003);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 2a72: mov 5df2, 6(r4)
+    {
+        a = 0x5df2;
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 2a78: mov $18, (r4)
+    {
+        src = uint16_t(0x0018);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 2a7c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a7e: br 2ab6
+    AOT_GOTO(0x2ab6, L2ab6);
+L2a80:
+    AOT_BLOCK(0x2a80, 1);
+    // 2a80: br 2a94
+    AOT_GOTO(0x2a94, L2a94);
+L2a84:
+    AOT_BLOCK(0x2a84, 2);
+    // 2a84: mov $44f0, r1
+    {
+        src = uint16_t(0x44f0);
+        r[1] = src;
+    }
+    // 2a88: mov r0, 44f6
+    {
+        src = r[0];
+        b = 0x44f6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2a8c, L2a8c);
+L2a8c:
+    AOT_BLOCK(0x2a8c, 2);
+    // 2a8c: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2a8e: bne 2a8c
+    if (!Z)
+        AOT_GOTO(0x2a8c, L2a8c);
+    AOT_GOTO(0x2a90, L2a90);
+L2a90:
+    AOT_BLOCK(0x2a90, 1);
+    // 2a90: jmp *6(r1)
+    {
+        a = RD16(r[1] + 6);
+    }
+    AOT_JUMP(a);
+L2a94:
+    AOT_BLOCK(0x2a94, 2);
+    // 2a94: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a96: jsr pc, *$1228
+    {
+        a = 0x1228;
+        r[6] -= 2;
+        WR16(r[6], 0x2a9a);
+    }
+    AOT_GOTO(0x1228, L1228);
+L2a9a:
+    AOT_BLOCK(0x2a9a, 3);
+    // 2a9a: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2a9c: mov 2(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2aa0: jsr pc, 318c
+    {
+        a = 0x318c;
+        r[6] -= 2;
+        WR16(r[6], 0x2aa4);
+    }
+    AOT_GOTO(0x318c, L318c);
+L2aa4:
+    AOT_BLOCK(0x2aa4, 3);
+    // 2aa4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2aa6: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2aa8: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x2aac);
+    }
+    AOT_GOTO(0x120c, L120c);
+L2aac:
+    AOT_BLOCK(0x2aac, 4);
+    // 2aac: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2aae: mov r0, 4(r3)
+    {
+        src = r[0];
+        b = uint16_t(r[3] + 4);
+        WR16(b, src);
+    }
+    // 2ab2: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ab4: br 2ab6
+    AOT_GOTO(0x2ab6, L2ab6);
+L2ab6:
+    AOT_BLOCK(0x2ab6, 2);
+    // 2ab6: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2aba:
+    AOT_BLOCK(0x2aba, 9);
+    // 2aba: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2abe;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2abe: sub $60, sp
+    {
+        src = uint16_t(0x0060);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 2ac2: clr -5c(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        WR16(a, 0);
+    }
+    // 2ac6: clr -5a(r5)
+    {
+        a = uint16_t(r[5] + -90);
+        WR16(a, 0);
+        C = false;
+    }
+    // 2aca: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2ace: mov (r2), -62(r5)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = uint16_t(r[5] + -98);
+        WR16(b, src);
+    }
+    // 2ad2: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ad4: jsr pc, *$164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x2ad8);
+    }
+    AOT_GOTO(0x164e, L164e);
+L2ad8:
+    AOT_BLOCK(0x2ad8, 6);
+    // 2ad8: mov r0, -64(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -100);
+        WR16(b, src);
+    }
+    // 2adc: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2ade: add $ffa4, (sp)
+    {
+        src = uint16_t(0xffa4);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2ae2: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2ae4: mov -62(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -98);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ae8: jsr pc, *$2ff2
+    {
+        a = 0x2ff2;
+        r[6] -= 2;
+        WR16(r[6], 0x2aec);
+    }
+    AOT_GOTO(0x2ff2, L2ff2);
+L2aec:
+    AOT_BLOCK(0x2aec, 8);
+    // 2aec: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 2aee: dec -5c(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 2af2: mov -5c(r5), r3
+    {
+        a = uint16_t(r[5] + -92);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 2af6: asl r3
+    {
+        src = r[3];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[3] = val;
+    }
+    // 2af8: add r5, r3
+    {
+        src = r[5];
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 2afa: add $ffd0, r3
+    {
+        src = uint16_t(0xffd0);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 2afe: tst -64(r5)
+    {
+        a = uint16_t(r[5] + -100);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2b02: bne 2b46
+    if (!Z)
+        AOT_GOTO(0x2b46, L2b46);
+    AOT_GOTO(0x2b04, L2b04);
+L2b04:
+    AOT_BLOCK(0x2b04, 1);
+    // 2b04: mov -5c(r5), -60(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        src = RD16(a);
+        b = uint16_t(r[5] + -96);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2b0a, L2b0a);
+L2b0a:
+    AOT_BLOCK(0x2b0a, 2);
+    // 2b0a: tst -60(r5)
+    {
+        a = uint16_t(r[5] + -96);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2b0e: ble 2b46
+    if (Z || (N ^ V))
+        AOT_GOTO(0x2b46, L2b46);
+    AOT_GOTO(0x2b10, L2b10);
+L2b10:
+    AOT_BLOCK(0x2b10, 2);
+    // 2b10: cmp $15, *0(r3)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[3] + 0);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2b16: bne 2b46
+    if (!Z)
+        AOT_GOTO(0x2b46, L2b46);
+    AOT_GOTO(0x2b18, L2b18);
+L2b18:
+    AOT_BLOCK(0x2b18, 2);
+    // 2b18: cmp $15, *-2(r3)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[3] + -2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2b1e: bne 2b46
+    if (!Z)
+        AOT_GOTO(0x2b46, L2b46);
+    AOT_GOTO(0x2b20, L2b20);
+L2b20:
+    AOT_BLOCK(0x2b20, 8);
+    // 2b20: dec -5c(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 2b24: sub $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 2b28: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2b2c: mov 6(r0), (sp)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b30: mov (r3), -(sp)
+    {
+        a = r[3];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2b32: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2b36: mov -62(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -98);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b3a: jsr pc, *$2f42
+    {
+        a = 0x2f42;
+        r[6] -= 2;
+        WR16(r[6], 0x2b3e);
+    }
+    AOT_GOTO(0x2f42, L2f42);
+L2b3e:
+    AOT_BLOCK(0x2b3e, 3);
+    // 2b3e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 2b40: dec -60(r5)
+    {
+        a = uint16_t(r[5] + -96);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 2b44: br 2b0a
+    AOT_GOTO(0x2b0a, L2b0a);
+L2b46:
+    AOT_BLOCK(0x2b46, 2);
+    // 2b46: cmp $28, -62(r5)
+    {
+        src = uint16_t(0x0028);
+        b = uint16_t(r[5] + -98);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2b4c: beq 2b56
+    if (Z)
+        AOT_GOTO(0x2b56, L2b56);
+    AOT_GOTO(0x2b4e, L2b4e);
+L2b4e:
+    AOT_BLOCK(0x2b4e, 2);
+    // 2b4e: cmp $30, -62(r5)
+    {
+        src = uint16_t(0x0030);
+        b = uint16_t(r[5] + -98);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2b54: bne 2bb2
+    if (!Z)
+        AOT_GOTO(0x2bb2, L2bb2);
+    AOT_GOTO(0x2b56, L2b56);
+L2b56:
+    AOT_BLOCK(0x2b56, 2);
+    // 2b56: tst -5c(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2b5a: ble 2b74
+    if (Z || (N ^ V))
+        AOT_GOTO(0x2b74, L2b74);
+    AOT_GOTO(0x2b5c, L2b5c);
+L2b5c:
+    AOT_BLOCK(0x2b5c, 2);
+    // 2b5c: mov (r3), (sp)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b5e: jsr pc, *$31a8
+    {
+        a = 0x31a8;
+        r[6] -= 2;
+        WR16(r[6], 0x2b62);
+    }
+    AOT_GOTO(0x31a8, L31a8);
+L2b62:
+    AOT_BLOCK(0x2b62, 2);
+    // 2b62: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b64: beq 2b74
+    if (Z)
+        AOT_GOTO(0x2b74, L2b74);
+    AOT_GOTO(0x2b66, L2b66);
+L2b66:
+    AOT_BLOCK(0x2b66, 2);
+    // 2b66: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2b6a: bne 2b74
+    if (!Z)
+        AOT_GOTO(0x2b74, L2b74);
+    AOT_GOTO(0x2b6c, L2b6c);
+L2b6c:
+    AOT_BLOCK(0x2b6c, 2);
+    // 2b6c: dec -5c(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 2b70: sub $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2b74, L2b74);
+L2b74:
+    AOT_BLOCK(0x2b74, 2);
+    // 2b74: tst -5c(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2b78: bgt 2b80
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x2b80, L2b80);
+    AOT_GOTO(0x2b7a, L2b7a);
+L2b7a:
+    AOT_BLOCK(0x2b7a, 2);
+    // 2b7a: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b7c: jmp *$2d54
+    {
+        a = 0x2d54;
+    }
+    AOT_GOTO(0x2d54, L2d54);
+L2b80:
+    AOT_BLOCK(0x2b80, 2);
+    // 2b80: cmp $28, -62(r5)
+    {
+        src = uint16_t(0x0028);
+        b = uint16_t(r[5] + -98);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2b86: bne 2bb0
+    if (!Z)
+        AOT_GOTO(0x2bb0, L2bb0);
+    AOT_GOTO(0x2b88, L2b88);
+L2b88:
+    AOT_BLOCK(0x2b88, 2);
+    // 2b88: cmp $15, *0(r3)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[3] + 0);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2b8e: bne 2bb0
+    if (!Z)
+        AOT_GOTO(0x2bb0, L2bb0);
+    AOT_GOTO(0x2b90, L2b90);
+L2b90:
+    AOT_BLOCK(0x2b90, 2);
+    // 2b90: cmp $23, *-2(r3)
+    {
+        src = uint16_t(0x0023);
+        b = RD16(r[3] + -2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2b96: bne 2bb0
+    if (!Z)
+        AOT_GOTO(0x2bb0, L2bb0);
+    AOT_GOTO(0x2b98, L2b98);
+L2b98:
+    AOT_BLOCK(0x2b98, 6);
+    // 2b98: sub $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 2b9c: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2ba0: mov (r3), r1
+    {
+        a = r[3];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2ba2: mov 6(r1), r1
+    {
+        a = uint16_t(r[1] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2ba6: add 6(r0), 8(r1)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = uint16_t(r[1] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2bac: dec -5c(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x2bb0, L2bb0);
+L2bb0:
+    AOT_BLOCK(0x2bb0, 1);
+    // 2bb0: br 2c08
+    AOT_GOTO(0x2c08, L2c08);
+L2bb2:
+    AOT_BLOCK(0x2bb2, 2);
+    // 2bb2: cmp $2a, -62(r5)
+    {
+        src = uint16_t(0x002a);
+        b = uint16_t(r[5] + -98);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2bb8: beq 2bc2
+    if (Z)
+        AOT_GOTO(0x2bc2, L2bc2);
+    AOT_GOTO(0x2bba, L2bba);
+L2bba:
+    AOT_BLOCK(0x2bba, 2);
+    // 2bba: cmp $2f, -62(r5)
+    {
+        src = uint16_t(0x002f);
+        b = uint16_t(r[5] + -98);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2bc0: bne 2c08
+    if (!Z)
+        AOT_GOTO(0x2c08, L2c08);
+    AOT_GOTO(0x2bc2, L2bc2);
+L2bc2:
+    AOT_BLOCK(0x2bc2, 6);
+    // 2bc2: mov -5c(r5), r0
+    {
+        a = uint16_t(r[5] + -92);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2bc6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2bc8: add r5, r0
+    {
+        src = r[5];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2bca: mov -30(r0), r4
+    {
+        a = uint16_t(r[0] + -48);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2bce: cmp $15, (r4)
+    {
+        src = uint16_t(0x0015);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2bd2: bne 2c08
+    if (!Z)
+        AOT_GOTO(0x2c08, L2c08);
+    AOT_GOTO(0x2bd4, L2bd4);
+L2bd4:
+    AOT_BLOCK(0x2bd4, 2);
+    // 2bd4: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2bd8: bne 2be0
+    if (!Z)
+        AOT_GOTO(0x2be0, L2be0);
+    AOT_GOTO(0x2bda, L2bda);
+L2bda:
+    AOT_BLOCK(0x2bda, 2);
+    // 2bda: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2bdc: jmp *$2d54
+    {
+        a = 0x2d54;
+    }
+    AOT_GOTO(0x2d54, L2d54);
+L2be0:
+    AOT_BLOCK(0x2be0, 2);
+    // 2be0: cmp $2a, -62(r5)
+    {
+        src = uint16_t(0x002a);
+        b = uint16_t(r[5] + -98);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2be6: bne 2c08
+    if (!Z)
+        AOT_GOTO(0x2c08, L2c08);
+    AOT_GOTO(0x2be8, L2be8);
+L2be8:
+    AOT_BLOCK(0x2be8, 2);
+    // 2be8: cmp $1, 6(r4)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[4] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2bee: bne 2c08
+    if (!Z)
+        AOT_GOTO(0x2c08, L2c08);
+    AOT_GOTO(0x2bf0, L2bf0);
+L2bf0:
+    AOT_BLOCK(0x2bf0, 2);
+    // 2bf0: tst -5c(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2bf4: ble 2c08
+    if (Z || (N ^ V))
+        AOT_GOTO(0x2c08, L2c08);
+    AOT_GOTO(0x2bf6, L2bf6);
+L2bf6:
+    AOT_BLOCK(0x2bf6, 3);
+    // 2bf6: dec -5c(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 2bfa: tst -5c(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2bfe: bgt 2c08
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x2c08, L2c08);
+    AOT_GOTO(0x2c00, L2c00);
+L2c00:
+    AOT_BLOCK(0x2c00, 2);
+    // 2c00: mov -30(r5), r0
+    {
+        a = uint16_t(r[5] + -48);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c04: jmp *$2d54
+    {
+        a = 0x2d54;
+    }
+    AOT_GOTO(0x2d54, L2d54);
+L2c08:
+    AOT_BLOCK(0x2c08, 2);
+    // 2c08: cmp $28, -62(r5)
+    {
+        src = uint16_t(0x0028);
+        b = uint16_t(r[5] + -98);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2c0e: bne 2c20
+    if (!Z)
+        AOT_GOTO(0x2c20, L2c20);
+    AOT_GOTO(0x2c10, L2c10);
+L2c10:
+    AOT_BLOCK(0x2c10, 2);
+    // 2c10: tst -64(r5)
+    {
+        a = uint16_t(r[5] + -100);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2c14: bne 2c20
+    if (!Z)
+        AOT_GOTO(0x2c20, L2c20);
+    AOT_GOTO(0x2c16, L2c16);
+L2c16:
+    AOT_BLOCK(0x2c16, 3);
+    // 2c16: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2c18: add $ffa4, (sp)
+    {
+        src = uint16_t(0xffa4);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2c1c: jsr pc, *$2d58
+    {
+        a = 0x2d58;
+        r[6] -= 2;
+        WR16(r[6], 0x2c20);
+    }
+    AOT_GOTO(0x2d58, L2d58);
+L2c20:
+    AOT_BLOCK(0x2c20, 5);
+    // 2c20: mov r5, r3
+    {
+        src = r[5];
+        r[3] = src;
+    }
+    // 2c22: add $ffd0, r3
+    {
+        src = uint16_t(0xffd0);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 2c26: mov (r3), r2
+    {
+        a = r[3];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2c28: mov 2(r2), (sp)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c2c: jsr pc, *$318c
+    {
+        a = 0x318c;
+        r[6] -= 2;
+        WR16(r[6], 0x2c30);
+    }
+    AOT_GOTO(0x318c, L318c);
+L2c30:
+    AOT_BLOCK(0x2c30, 3);
+    // 2c30: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2c32: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c34: jsr pc, 1228
+    {
+        a = 0x1228;
+        r[6] -= 2;
+        WR16(r[6], 0x2c38);
+    }
+    AOT_GOTO(0x1228, L1228);
+L2c38:
+    AOT_BLOCK(0x2c38, 3);
+    // 2c38: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2c3a: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c3c: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x2c40);
+    }
+    AOT_GOTO(0x120c, L120c);
+L2c40:
+    AOT_BLOCK(0x2c40, 4);
+    // 2c40: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 2c42: mov r0, -5e(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -94);
+        WR16(b, src);
+    }
+    // 2c46: cmp $2a, -62(r5)
+    {
+        src = uint16_t(0x002a);
+        b = uint16_t(r[5] + -98);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2c4c: bne 2c58
+    if (!Z)
+        AOT_GOTO(0x2c58, L2c58);
+    AOT_GOTO(0x2c4e, L2c4e);
+L2c4e:
+    AOT_BLOCK(0x2c4e, 2);
+    // 2c4e: tst -64(r5)
+    {
+        a = uint16_t(r[5] + -100);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2c52: bne 2c58
+    if (!Z)
+        AOT_GOTO(0x2c58, L2c58);
+    AOT_GOTO(0x2c54, L2c54);
+L2c54:
+    AOT_BLOCK(0x2c54, 1);
+    // 2c54: inc -5e(r5)
+    {
+        a = uint16_t(r[5] + -94);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x2c58, L2c58);
+L2c58:
+    AOT_BLOCK(0x2c58, 1);
+    // 2c58: clr -60(r5)
+    {
+        a = uint16_t(r[5] + -96);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2c5c, L2c5c);
+L2c5c:
+    AOT_BLOCK(0x2c5c, 2);
+    // 2c5c: cmp -5c(r5), -60(r5)
+    {
+        a = uint16_t(r[5] + -92);
+        src = RD16(a);
+        b = uint16_t(r[5] + -96);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2c62: ble 2d20
+    if (Z || (N ^ V))
+        AOT_GOTO(0x2d20, L2d20);
+    AOT_GOTO(0x2c64, L2c64);
+L2c64:
+    AOT_BLOCK(0x2c64, 10);
+    // 2c64: mov -60(r5), r0
+    {
+        a = uint16_t(r[5] + -96);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2c68: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2c6a: add r5, r0
+    {
+        src = r[5];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2c6c: mov -58(r0), r4
+    {
+        a = uint16_t(r[0] + -88);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2c70: add $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 2c74: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2c76: mov r0, -66(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -102);
+        WR16(b, src);
+    }
+    // 2c7a: mov r0, 8(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 2c7e: mov -66(r5), (sp)
+    {
+        a = uint16_t(r[5] + -102);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c82: jsr pc, *$1228
+    {
+        a = 0x1228;
+        r[6] -= 2;
+        WR16(r[6], 0x2c86);
+    }
+    AOT_GOTO(0x1228, L1228);
+L2c86:
+    AOT_BLOCK(0x2c86, 2);
+    // 2c86: cmp -5e(r5), r0
+    {
+        a = uint16_t(r[5] + -94);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2c8a: bne 2c9a
+    if (!Z)
+        AOT_GOTO(0x2c9a, L2c9a);
+    AOT_GOTO(0x2c8c, L2c8c);
+L2c8c:
+    AOT_BLOCK(0x2c8c, 2);
+    // 2c8c: mov 2(r4), (sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c90: jsr pc, *$318c
+    {
+        a = 0x318c;
+        r[6] -= 2;
+        WR16(r[6], 0x2c94);
+    }
+    AOT_GOTO(0x318c, L318c);
+L2c94:
+    AOT_BLOCK(0x2c94, 2);
+    // 2c94: add -5e(r5), r0
+    {
+        a = uint16_t(r[5] + -94);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2c98: br 2cae
+    AOT_GOTO(0x2cae, L2cae);
+L2c9a:
+    AOT_BLOCK(0x2c9a, 2);
+    // 2c9a: mov -66(r5), (sp)
+    {
+        a = uint16_t(r[5] + -102);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2c9e: jsr pc, *$1228
+    {
+        a = 0x1228;
+        r[6] -= 2;
+        WR16(r[6], 0x2ca2);
+    }
+    AOT_GOTO(0x1228, L1228);
+L2ca2:
+    AOT_BLOCK(0x2ca2, 3);
+    // 2ca2: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2ca4: mov -5e(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -94);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ca8: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x2cac);
+    }
+    AOT_GOTO(0x120c, L120c);
+L2cac:
+    AOT_BLOCK(0x2cac, 1);
+    // 2cac: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2cae, L2cae);
+L2cae:
+    AOT_BLOCK(0x2cae, 5);
+    // 2cae: mov r0, -5e(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -94);
+        WR16(b, src);
+    }
+    // 2cb2: mov r0, 4(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 2cb6: mov r2, 6(r4)
+    {
+        src = r[2];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 2cba: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+    }
+    // 2cbc: cmp $6, 2(r2)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[2] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2cc2, L2cc2);
+L2cc2:
+    AOT_BLOCK(0x2cc2, 1);
+    // 2cc2: bne 2d1a
+    if (!Z)
+        AOT_GOTO(0x2d1a, L2d1a);
+    AOT_GOTO(0x2cc4, L2cc4);
+L2cc4:
+    AOT_BLOCK(0x2cc4, 2);
+    // 2cc4: cmp $2a, (r2)
+    {
+        src = uint16_t(0x002a);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2cc8: bne 2cd4
+    if (!Z)
+        AOT_GOTO(0x2cd4, L2cd4);
+    AOT_GOTO(0x2cca, L2cca);
+L2cca:
+    AOT_BLOCK(0x2cca, 2);
+    // 2cca: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ccc: jsr pc, *$31dc
+    {
+        a = 0x31dc;
+        r[6] -= 2;
+        WR16(r[6], 0x2cd0);
+    }
+    AOT_GOTO(0x31dc, L31dc);
+L2cd0:
+    AOT_BLOCK(0x2cd0, 2);
+    // 2cd0: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2cd2: br 2d1a
+    AOT_GOTO(0x2d1a, L2d1a);
+L2cd4:
+    AOT_BLOCK(0x2cd4, 2);
+    // 2cd4: cmp $28, (r2)
+    {
+        src = uint16_t(0x0028);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2cd8: bne 2d1a
+    if (!Z)
+        AOT_GOTO(0x2d1a, L2d1a);
+    AOT_GOTO(0x2cda, L2cda);
+L2cda:
+    AOT_BLOCK(0x2cda, 2);
+    // 2cda: mov 6(r2), (sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2cde: jsr pc, *$31a8
+    {
+        a = 0x31a8;
+        r[6] -= 2;
+        WR16(r[6], 0x2ce2);
+    }
+    AOT_GOTO(0x31a8, L31a8);
+L2ce2:
+    AOT_BLOCK(0x2ce2, 2);
+    // 2ce2: mov r0, -66(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -102);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ce6: beq 2d1a
+    if (Z)
+        AOT_GOTO(0x2d1a, L2d1a);
+    AOT_GOTO(0x2ce8, L2ce8);
+L2ce8:
+    AOT_BLOCK(0x2ce8, 3);
+    // 2ce8: mov -66(r5), r0
+    {
+        a = uint16_t(r[5] + -102);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2cec: tst 6(r0)
+    {
+        a = uint16_t(r[0] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2cf0: bge 2d1a
+    if (!(N ^ V))
+        AOT_GOTO(0x2d1a, L2d1a);
+    AOT_GOTO(0x2cf2, L2cf2);
+L2cf2:
+    AOT_BLOCK(0x2cf2, 9);
+    // 2cf2: mov $29, (r2)
+    {
+        src = uint16_t(0x0029);
+        b = r[2];
+        WR16(b, src);
+    }
+    // 2cf6: mov -66(r5), r0
+    {
+        a = uint16_t(r[5] + -102);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2cfa: mov -66(r5), r1
+    {
+        a = uint16_t(r[5] + -102);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2cfe: mov 6(r1), r1
+    {
+        a = uint16_t(r[1] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2d02: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 2d04: mov r1, 6(r0)
+    {
+        src = r[1];
+        b = uint16_t(r[0] + 6);
+        WR16(b, src);
+    }
+    // 2d08: mov 6(r2), -66(r5)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        b = uint16_t(r[5] + -102);
+        WR16(b, src);
+    }
+    // 2d0e: mov 8(r2), 6(r2)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[2] + 6);
+        WR16(b, src);
+    }
+    // 2d14: mov -66(r5), 8(r2)
+    {
+        a = uint16_t(r[5] + -102);
+        src = RD16(a);
+        b = uint16_t(r[2] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2d1a, L2d1a);
+L2d1a:
+    AOT_BLOCK(0x2d1a, 2);
+    // 2d1a: inc -60(r5)
+    {
+        a = uint16_t(r[5] + -96);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 2d1e: br 2c5c
+    AOT_GOTO(0x2c5c, L2c5c);
+L2d20:
+    AOT_BLOCK(0x2d20, 2);
+    // 2d20: cmp $2a, (r2)
+    {
+        src = uint16_t(0x002a);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2d24: bne 2d50
+    if (!Z)
+        AOT_GOTO(0x2d50, L2d50);
+    AOT_GOTO(0x2d26, L2d26);
+L2d26:
+    AOT_BLOCK(0x2d26, 2);
+    // 2d26: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2d28: jsr pc, *$1af4
+    {
+        a = 0x1af4;
+        r[6] -= 2;
+        WR16(r[6], 0x2d2c);
+    }
+    AOT_GOTO(0x1af4, L1af4);
+L2d2c:
+    AOT_BLOCK(0x2d2c, 2);
+    // 2d2c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2d2e: beq 2d50
+    if (Z)
+        AOT_GOTO(0x2d50, L2d50);
+    AOT_GOTO(0x2d30, L2d30);
+L2d30:
+    AOT_BLOCK(0x2d30, 2);
+    // 2d30: mov 2(r2), (sp)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2d34: jsr pc, *$318c
+    {
+        a = 0x318c;
+        r[6] -= 2;
+        WR16(r[6], 0x2d38);
+    }
+    AOT_GOTO(0x318c, L318c);
+L2d38:
+    AOT_BLOCK(0x2d38, 3);
+    // 2d38: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2d3a: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2d3e: jsr pc, 1228
+    {
+        a = 0x1228;
+        r[6] -= 2;
+        WR16(r[6], 0x2d42);
+    }
+    AOT_GOTO(0x1228, L1228);
+L2d42:
+    AOT_BLOCK(0x2d42, 3);
+    // 2d42: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2d44: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2d46: jsr pc, *$120c
+    {
+        a = 0x120c;
+        r[6] -= 2;
+        WR16(r[6], 0x2d4a);
+    }
+    AOT_GOTO(0x120c, L120c);
+L2d4a:
+    AOT_BLOCK(0x2d4a, 2);
+    // 2d4a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2d4c: mov r0, 4(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2d50, L2d50);
+L2d50:
+    AOT_BLOCK(0x2d50, 2);
+    // 2d50: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2d52: br 2d54
+    AOT_GOTO(0x2d54, L2d54);
+L2d54:
+    AOT_BLOCK(0x2d54, 2);
+    // 2d54: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2d58:
+    AOT_BLOCK(0x2d58, 3);
+    // 2d58: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2d5c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2d5c: sub $e, sp
+    {
+        src = uint16_t(0x000e);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2d60, L2d60);
+L2d60:
+    AOT_BLOCK(0x2d60, 1);
+    // 2d60: mov *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2d64, L2d64);
+L2d64:
+    AOT_BLOCK(0x2d64, 8);
+    // 2d64: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2d66: add 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2d6a: add $2c, r0
+    {
+        src = uint16_t(0x002c);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2d6e: mov r0, -12(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 2d72: mov $3e8, -a(r5)
+    {
+        src = uint16_t(0x03e8);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 2d78: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+    }
+    // 2d7c: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2d80: add $2c, r4
+    {
+        src = uint16_t(0x002c);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2d84, L2d84);
+L2d84:
+    AOT_BLOCK(0x2d84, 2);
+    // 2d84: cmp -12(r5), r4
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2d88: bcc 2d8e
+    if (!C)
+        AOT_GOTO(0x2d8e, L2d8e);
+    AOT_GOTO(0x2d8a, L2d8a);
+L2d8a:
+    AOT_BLOCK(0x2d8a, 1);
+    // 2d8a: jmp *$2e76
+    {
+        a = 0x2e76;
+    }
+    AOT_GOTO(0x2e76, L2e76);
+L2d8e:
+    AOT_BLOCK(0x2d8e, 2);
+    // 2d8e: cmp $2a, *0(r4)
+    {
+        src = uint16_t(0x002a);
+        b = RD16(r[4] + 0);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2d94: beq 2d9a
+    if (Z)
+        AOT_GOTO(0x2d9a, L2d9a);
+    AOT_GOTO(0x2d96, L2d96);
+L2d96:
+    AOT_BLOCK(0x2d96, 1);
+    // 2d96: jmp *$2e70
+    {
+        a = 0x2e70;
+    }
+    AOT_GOTO(0x2e70, L2e70);
+L2d9a:
+    AOT_BLOCK(0x2d9a, 3);
+    // 2d9a: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2d9c: cmp $15, *8(r0)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[0] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2da2: bne 2e70
+    if (!Z)
+        AOT_GOTO(0x2e70, L2e70);
+    AOT_GOTO(0x2da4, L2da4);
+L2da4:
+    AOT_BLOCK(0x2da4, 3);
+    // 2da4: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+    }
+    // 2da8: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 2dac: add $2c, r3
+    {
+        src = uint16_t(0x002c);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2db0, L2db0);
+L2db0:
+    AOT_BLOCK(0x2db0, 2);
+    // 2db0: cmp -12(r5), r3
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2db4: bcs 2e52
+    if (C)
+        AOT_GOTO(0x2e52, L2e52);
+    AOT_GOTO(0x2db6, L2db6);
+L2db6:
+    AOT_BLOCK(0x2db6, 2);
+    // 2db6: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2db8: beq 2e4c
+    if (Z)
+        AOT_GOTO(0x2e4c, L2e4c);
+    AOT_GOTO(0x2dba, L2dba);
+L2dba:
+    AOT_BLOCK(0x2dba, 2);
+    // 2dba: cmp $2a, *0(r3)
+    {
+        src = uint16_t(0x002a);
+        b = RD16(r[3] + 0);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2dc0: bne 2e4c
+    if (!Z)
+        AOT_GOTO(0x2e4c, L2e4c);
+    AOT_GOTO(0x2dc2, L2dc2);
+L2dc2:
+    AOT_BLOCK(0x2dc2, 3);
+    // 2dc2: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2dc4: cmp $15, *8(r0)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[0] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2dca: bne 2e4c
+    if (!Z)
+        AOT_GOTO(0x2e4c, L2e4c);
+    AOT_GOTO(0x2dcc, L2dcc);
+L2dcc:
+    AOT_BLOCK(0x2dcc, 6);
+    // 2dcc: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2dce: mov 8(r0), r0
+    {
+        a = uint16_t(r[0] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2dd2: mov (r3), r1
+    {
+        a = r[3];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2dd4: mov 8(r1), r1
+    {
+        a = uint16_t(r[1] + 8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2dd8: cmp 6(r1), 6(r0)
+    {
+        a = uint16_t(r[1] + 6);
+        src = RD16(a);
+        b = uint16_t(r[0] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2dde: bne 2e10
+    if (!Z)
+        AOT_GOTO(0x2e10, L2e10);
+    AOT_GOTO(0x2de0, L2de0);
+L2de0:
+    AOT_BLOCK(0x2de0, 8);
+    // 2de0: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2de2: mov (r4), r1
+    {
+        a = r[4];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2de4: mov 6(r1), 8(r0)
+    {
+        a = uint16_t(r[1] + 6);
+        src = RD16(a);
+        b = uint16_t(r[0] + 8);
+        WR16(b, src);
+    }
+    // 2dea: mov $28, *0(r3)
+    {
+        src = uint16_t(0x0028);
+        b = RD16(r[3] + 0);
+        WR16(b, src);
+    }
+    // 2df0: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2df2: mov (r3), 6(r0)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = uint16_t(r[0] + 6);
+        WR16(b, src);
+    }
+    // 2df6: mov (r4), (sp)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2df8: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x2dfc);
+    }
+    AOT_GOTO(0x241c, L241c);
+L2dfc:
+    AOT_BLOCK(0x2dfc, 4);
+    // 2dfc: mov r0, (r4)
+    {
+        src = r[0];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 2dfe: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2e02: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2e04: jsr pc, *$2f26
+    {
+        a = 0x2f26;
+        r[6] -= 2;
+        WR16(r[6], 0x2e08);
+    }
+    AOT_GOTO(0x2f26, L2f26);
+L2e08:
+    AOT_BLOCK(0x2e08, 1);
+    // 2e08: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2e0a, L2e0a);
+L2e0a:
+    AOT_BLOCK(0x2e0a, 2);
+    // 2e0a: dec *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 2e0e: br 2d60
+    AOT_GOTO(0x2d60, L2d60);
+L2e10:
+    AOT_BLOCK(0x2e10, 9);
+    // 2e10: mov (r3), r1
+    {
+        a = r[3];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2e12: mov 8(r1), r1
+    {
+        a = uint16_t(r[1] + 8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2e16: mov 6(r1), r1
+    {
+        a = uint16_t(r[1] + 6);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 2e1a: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 2e1c: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2e1e: mov 8(r2), r2
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2e22: div 6(r2), r0
+    {
+        a = uint16_t(r[2] + 6);
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2e26: tst r1
+    {
+        val = int16_t(r[1]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2e28: beq 2e70
+    if (Z)
+        AOT_GOTO(0x2e70, L2e70);
+    AOT_GOTO(0x2e2a, L2e2a);
+L2e2a:
+    AOT_BLOCK(0x2e2a, 9);
+    // 2e2a: mov (r4), r1
+    {
+        a = r[4];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2e2c: mov 8(r1), r1
+    {
+        a = uint16_t(r[1] + 8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2e30: mov 6(r1), r1
+    {
+        a = uint16_t(r[1] + 6);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 2e34: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 2e36: mov (r3), r2
+    {
+        a = r[3];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2e38: mov 8(r2), r2
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2e3c: div 6(r2), r0
+    {
+        a = uint16_t(r[2] + 6);
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2e40: tst r1
+    {
+        val = int16_t(r[1]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2e42: bne 2e4c
+    if (!Z)
+        AOT_GOTO(0x2e4c, L2e4c);
+    AOT_GOTO(0x2e44, L2e44);
+L2e44:
+    AOT_BLOCK(0x2e44, 2);
+    // 2e44: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 2e48: mov r3, -14(r5)
+    {
+        src = r[3];
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2e4c, L2e4c);
+L2e4c:
+    AOT_BLOCK(0x2e4c, 2);
+    // 2e4c: add $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2e50: br 2db0
+    AOT_GOTO(0x2db0, L2db0);
+L2e52:
+    AOT_BLOCK(0x2e52, 2);
+    // 2e52: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2e56: ble 2e70
+    if (Z || (N ^ V))
+        AOT_GOTO(0x2e70, L2e70);
+    AOT_GOTO(0x2e58, L2e58);
+L2e58:
+    AOT_BLOCK(0x2e58, 2);
+    // 2e58: cmp -a(r5), -c(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2e5e: ble 2e70
+    if (Z || (N ^ V))
+        AOT_GOTO(0x2e70, L2e70);
+    AOT_GOTO(0x2e60, L2e60);
+L2e60:
+    AOT_BLOCK(0x2e60, 3);
+    // 2e60: mov -c(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 2e66: mov r4, -e(r5)
+    {
+        src = r[4];
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 2e6a: mov -14(r5), -10(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2e70, L2e70);
+L2e70:
+    AOT_BLOCK(0x2e70, 2);
+    // 2e70: add $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2e74: br 2d84
+    AOT_GOTO(0x2d84, L2d84);
+L2e76:
+    AOT_BLOCK(0x2e76, 2);
+    // 2e76: tst -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2e7a: beq 2f22
+    if (Z)
+        AOT_GOTO(0x2f22, L2f22);
+    AOT_GOTO(0x2e7c, L2e7c);
+L2e7c:
+    AOT_BLOCK(0x2e7c, 31);
+    // 2e7c: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+    }
+    // 2e80: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2e84: sub r0, 2(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[1] + 2);
+        WR16(b, val16);
+    }
+    // 2e88: mov 2(r1), r0
+    {
+        a = uint16_t(r[1] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2e8c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2e8e: add 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2e92: mov 4(r0), -8(r5)
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 2e98: mov -e(r5), r4
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2e9c: mov -10(r5), r3
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 2ea0: mov $28, *-8(r5)
+    {
+        src = uint16_t(0x0028);
+        b = RD16(r[5] + -8);
+        WR16(b, src);
+    }
+    // 2ea6: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2eaa: mov (r4), r1
+    {
+        a = r[4];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2eac: mov 2(r1), 2(r0)
+    {
+        a = uint16_t(r[1] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 2eb2: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2eb6: mov (r4), 6(r0)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = uint16_t(r[0] + 6);
+        WR16(b, src);
+    }
+    // 2eba: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2ebe: mov (r3), r1
+    {
+        a = r[3];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2ec0: mov 6(r1), 8(r0)
+    {
+        a = uint16_t(r[1] + 6);
+        src = RD16(a);
+        b = uint16_t(r[0] + 8);
+        WR16(b, src);
+    }
+    // 2ec6: mov (r3), r1
+    {
+        a = r[3];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2ec8: mov 8(r1), r1
+    {
+        a = uint16_t(r[1] + 8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2ecc: mov 6(r1), -(sp)
+    {
+        a = uint16_t(r[1] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2ed0: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2ed2: mov 8(r2), r2
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2ed6: mov 6(r2), r1
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 2eda: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 2edc: div (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2ede: mov r0, 6(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 6);
+        WR16(b, src);
+    }
+    // 2ee2: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2ee4: mov -8(r5), 6(r0)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[0] + 6);
+        WR16(b, src);
+    }
+    // 2eea: mov (r3), (sp)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2eec: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x2ef0);
+    }
+    AOT_GOTO(0x241c, L241c);
+L2ef0:
+    AOT_BLOCK(0x2ef0, 3);
+    // 2ef0: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 2ef4: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2ef6: blos 2f0a
+    if (C | Z)
+        AOT_GOTO(0x2f0a, L2f0a);
+    AOT_GOTO(0x2ef8, L2ef8);
+L2ef8:
+    AOT_BLOCK(0x2ef8, 2);
+    // 2ef8: mov -8(r5), (r4)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 2efc: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2f00, L2f00);
+L2f00:
+    AOT_BLOCK(0x2f00, 2);
+    // 2f00: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f02: jsr pc, *$2f26
+    {
+        a = 0x2f26;
+        r[6] -= 2;
+        WR16(r[6], 0x2f06);
+    }
+    AOT_GOTO(0x2f26, L2f26);
+L2f06:
+    AOT_BLOCK(0x2f06, 2);
+    // 2f06: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2f08: br 2f1a
+    AOT_GOTO(0x2f1a, L2f1a);
+L2f0a:
+    AOT_BLOCK(0x2f0a, 4);
+    // 2f0a: mov -8(r5), (r3)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[3];
+        WR16(b, src);
+    }
+    // 2f0e: mov -12(r5), (sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2f12: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f14: jsr pc, *$2f26
+    {
+        a = 0x2f26;
+        r[6] -= 2;
+        WR16(r[6], 0x2f18);
+    }
+    AOT_GOTO(0x2f26, L2f26);
+L2f18:
+    AOT_BLOCK(0x2f18, 1);
+    // 2f18: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2f1a, L2f1a);
+L2f1a:
+    AOT_BLOCK(0x2f1a, 2);
+    // 2f1a: dec *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 2f1e: jmp *$2d60
+    {
+        a = 0x2d60;
+    }
+    AOT_GOTO(0x2d60, L2d60);
+L2f22:
+    AOT_BLOCK(0x2f22, 2);
+    // 2f22: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2f26:
+    AOT_BLOCK(0x2f26, 3);
+    // 2f26: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2f2a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2f2a: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2f2e, L2f2e);
+L2f2e:
+    AOT_BLOCK(0x2f2e, 2);
+    // 2f2e: cmp 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2f32: blos 2f3e
+    if (C | Z)
+        AOT_GOTO(0x2f3e, L2f3e);
+    AOT_GOTO(0x2f34, L2f34);
+L2f34:
+    AOT_BLOCK(0x2f34, 3);
+    // 2f34: mov 2(r4), (r4)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 2f38: add $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2f3c: br 2f2e
+    AOT_GOTO(0x2f2e, L2f2e);
+L2f3e:
+    AOT_BLOCK(0x2f3e, 2);
+    // 2f3e: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2f42:
+    AOT_BLOCK(0x2f42, 5);
+    // 2f42: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2f46;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2f46: mov 8(r5), r4
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2f4a: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f4e: br 2fd6
+    AOT_GOTO(0x2fd6, L2fd6);
+L2f50:
+    AOT_BLOCK(0x2f50, 2);
+    // 2f50: add r4, *6(r5)
+    {
+        src = r[4];
+        b = RD16(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2f54: br 2fee
+    AOT_GOTO(0x2fee, L2fee);
+L2f56:
+    AOT_BLOCK(0x2f56, 4);
+    // 2f56: mov *6(r5), r1
+    {
+        a = RD16(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2f5a: mul r4, r1
+    {
+        src = int16_t(r[4]);
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 2f5c: mov r1, *6(r5)
+    {
+        src = r[1];
+        b = RD16(r[5] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f60: br 2fee
+    AOT_GOTO(0x2fee, L2fee);
+L2f62:
+    AOT_BLOCK(0x2f62, 4);
+    // 2f62: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2f64: com r0
+    {
+        val = ~int(r[0]);
+        r[0] = val;
+        C = true;
+    }
+    // 2f66: bic r0, *6(r5)
+    {
+        src = r[0];
+        b = RD16(r[5] + 6);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2f6a: br 2fee
+    AOT_GOTO(0x2fee, L2fee);
+L2f6c:
+    AOT_BLOCK(0x2f6c, 2);
+    // 2f6c: bis r4, *6(r5)
+    {
+        src = r[4];
+        b = RD16(r[5] + 6);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2f70: br 2fee
+    AOT_GOTO(0x2fee, L2fee);
+L2f72:
+    AOT_BLOCK(0x2f72, 4);
+    // 2f72: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2f74: xor r0, *6(r5)
+    {
+        src = r[0];
+        b = RD16(r[5] + 6);
+        val = src ^ RD16(b);
+        WR16(b, val);
+    }
+    // 2f78: mov *6(r5), r0
+    {
+        a = RD16(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f7c: br 2fee
+    AOT_GOTO(0x2fee, L2fee);
+L2f7e:
+    AOT_BLOCK(0x2f7e, 2);
+    // 2f7e: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2f80: bne 2f8c
+    if (!Z)
+        AOT_GOTO(0x2f8c, L2f8c);
+    AOT_GOTO(0x2f82, L2f82);
+L2f82:
+    AOT_BLOCK(0x2f82, 2);
+    // 2f82: mov $453c, (sp)
+    {
+        src = uint16_t(0x453c);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2f86: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x2f8a);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L2f8a:
+    AOT_BLOCK(0x2f8a, 1);
+    // 2f8a: br 2fae
+    AOT_GOTO(0x2fae, L2fae);
+L2f8c:
+    AOT_BLOCK(0x2f8c, 2);
+    // 2f8c: cmp $2b, 4(r5)
+    {
+        src = uint16_t(0x002b);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2f92: bne 2fa2
+    if (!Z)
+        AOT_GOTO(0x2fa2, L2fa2);
+    AOT_GOTO(0x2f94, L2f94);
+L2f94:
+    AOT_BLOCK(0x2f94, 5);
+    // 2f94: mov *6(r5), r1
+    {
+        a = RD16(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 2f98: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 2f9a: div r4, r0
+    {
+        src = int16_t(r[4]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2f9c: mov r0, *6(r5)
+    {
+        src = r[0];
+        b = RD16(r[5] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2fa0: br 2fae
+    AOT_GOTO(0x2fae, L2fae);
+L2fa2:
+    AOT_BLOCK(0x2fa2, 4);
+    // 2fa2: mov *6(r5), r1
+    {
+        a = RD16(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 2fa6: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 2fa8: div r4, r0
+    {
+        src = int16_t(r[4]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2faa: mov r1, *6(r5)
+    {
+        src = r[1];
+        b = RD16(r[5] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2fae, L2fae);
+L2fae:
+    AOT_BLOCK(0x2fae, 1);
+    // 2fae: br 2fee
+    AOT_GOTO(0x2fee, L2fee);
+L2fb0:
+    AOT_BLOCK(0x2fb0, 7);
+    // 2fb0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2fb2: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        C = val != 0;
+    }
+    // 2fb4: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2fb6: mov *6(r5), r0
+    {
+        a = RD16(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2fba: ash (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 2fbc: mov r0, *6(r5)
+    {
+        src = r[0];
+        b = RD16(r[5] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2fc0: br 2fee
+    AOT_GOTO(0x2fee, L2fee);
+L2fc2:
+    AOT_BLOCK(0x2fc2, 4);
+    // 2fc2: mov *6(r5), r0
+    {
+        a = RD16(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2fc6: ash r4, r0
+    {
+        src = r[4] & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 2fc8: mov r0, *6(r5)
+    {
+        src = r[0];
+        b = RD16(r[5] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2fcc: br 2fee
+    AOT_GOTO(0x2fee, L2fee);
+L2fce:
+    AOT_BLOCK(0x2fce, 2);
+    // 2fce: bic r4, *6(r5)
+    {
+        src = r[4];
+        b = RD16(r[5] + 6);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2fd2: br 2fee
+    AOT_GOTO(0x2fee, L2fee);
+L2fd6:
+    AOT_BLOCK(0x2fd6, 3);
+    // 2fd6: sub $28, r0
+    {
+        src = uint16_t(0x0028);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 2fda: cmp r0, $f
+    {
+        src = r[0];
+        dst = uint16_t(0x000f);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2fde: bhi 2fe6
+    if (!(C | Z))
+        AOT_GOTO(0x2fe6, L2fe6);
+    AOT_GOTO(0x2fe0, L2fe0);
+L2fe0:
+    AOT_BLOCK(0x2fe0, 2);
+    // 2fe0: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 2fe2: jmp *4500(r0)
+    {
+        a = RD16(r[0] + 17664);
+    }
+    AOT_JUMP(a);
+L2fe6:
+    AOT_BLOCK(0x2fe6, 2);
+    // 2fe6: mov $4549, (sp)
+    {
+        src = uint16_t(0x4549);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2fea: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x2fee);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L2fee:
+    AOT_BLOCK(0x2fee, 2);
+    // 2fee: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2ff2:
+    AOT_BLOCK(0x2ff2, 7);
+    // 2ff2: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2ff6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 2ff6: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 2ffa: mov 6(r5), r2
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2ffe: mov 8(r5), r3
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 3002: cmp 4(r5), (r2)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3006: bne 303c
+    if (!Z)
+        AOT_GOTO(0x303c, L303c);
+    AOT_GOTO(0x3008, L3008);
+L3008:
+    AOT_BLOCK(0x3008, 9);
+    // 3008: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 300c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 300e: inc 2(r3)
+    {
+        a = uint16_t(r[3] + 2);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 3012: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 3014: mov r2, 4(r0)
+    {
+        src = r[2];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 3018: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 301a: mov 6(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 301e: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3022: jsr pc, *$2ff2
+    {
+        a = 0x2ff2;
+        r[6] -= 2;
+        WR16(r[6], 0x3026);
+    }
+    AOT_GOTO(0x2ff2, L2ff2);
+L3026:
+    AOT_BLOCK(0x3026, 5);
+    // 3026: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 3028: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 302a: mov 8(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 302e: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3032: jsr pc, *$2ff2
+    {
+        a = 0x2ff2;
+        r[6] -= 2;
+        WR16(r[6], 0x3036);
+    }
+    AOT_GOTO(0x2ff2, L2ff2);
+L3036:
+    AOT_BLOCK(0x3036, 2);
+    // 3036: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3038: jmp *$3142
+    {
+        a = 0x3142;
+    }
+    AOT_GOTO(0x3142, L3142);
+L303c:
+    AOT_BLOCK(0x303c, 2);
+    // 303c: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 303e: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x3042);
+    }
+    AOT_GOTO(0x241c, L241c);
+L3042:
+    AOT_BLOCK(0x3042, 3);
+    // 3042: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 3044: cmp 4(r5), (r2)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3048: beq 3008
+    if (Z)
+        AOT_GOTO(0x3008, L3008);
+    AOT_GOTO(0x304a, L304a);
+L304a:
+    AOT_BLOCK(0x304a, 2);
+    // 304a: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 304c: jsr pc, *$164e
+    {
+        a = 0x164e;
+        r[6] -= 2;
+        WR16(r[6], 0x3050);
+    }
+    AOT_GOTO(0x164e, L164e);
+L3050:
+    AOT_BLOCK(0x3050, 2);
+    // 3050: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3052: bne 30e4
+    if (!Z)
+        AOT_GOTO(0x30e4, L30e4);
+    AOT_GOTO(0x3054, L3054);
+L3054:
+    AOT_BLOCK(0x3054, 2);
+    // 3054: cmp $2a, (r2)
+    {
+        src = uint16_t(0x002a);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3058: beq 3060
+    if (Z)
+        AOT_GOTO(0x3060, L3060);
+    AOT_GOTO(0x305a, L305a);
+L305a:
+    AOT_BLOCK(0x305a, 2);
+    // 305a: cmp $2e, (r2)
+    {
+        src = uint16_t(0x002e);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 305e: bne 30e4
+    if (!Z)
+        AOT_GOTO(0x30e4, L30e4);
+    AOT_GOTO(0x3060, L3060);
+L3060:
+    AOT_BLOCK(0x3060, 2);
+    // 3060: cmp $15, *8(r2)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[2] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3066: bne 30e4
+    if (!Z)
+        AOT_GOTO(0x30e4, L30e4);
+    AOT_GOTO(0x3068, L3068);
+L3068:
+    AOT_BLOCK(0x3068, 3);
+    // 3068: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 306c: tst 6(r0)
+    {
+        a = uint16_t(r[0] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3070: ble 30e4
+    if (Z || (N ^ V))
+        AOT_GOTO(0x30e4, L30e4);
+    AOT_GOTO(0x3072, L3072);
+L3072:
+    AOT_BLOCK(0x3072, 2);
+    // 3072: cmp $28, *6(r2)
+    {
+        src = uint16_t(0x0028);
+        b = RD16(r[2] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3078: bne 30e4
+    if (!Z)
+        AOT_GOTO(0x30e4, L30e4);
+    AOT_GOTO(0x307a, L307a);
+L307a:
+    AOT_BLOCK(0x307a, 3);
+    // 307a: mov 6(r2), r0
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 307e: cmp $15, *8(r0)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[0] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3084: bne 30e4
+    if (!Z)
+        AOT_GOTO(0x30e4, L30e4);
+    AOT_GOTO(0x3086, L3086);
+L3086:
+    AOT_BLOCK(0x3086, 4);
+    // 3086: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 308a: mov 6(r0), r4
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 308e: cmp $2a, (r2)
+    {
+        src = uint16_t(0x002a);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3092: bne 30b2
+    if (!Z)
+        AOT_GOTO(0x30b2, L30b2);
+    AOT_GOTO(0x3094, L3094);
+L3094:
+    AOT_BLOCK(0x3094, 9);
+    // 3094: mov 8(r2), -(sp)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3098: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 309c: mov 6(r2), r1
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 30a0: mov 8(r1), r1
+    {
+        a = uint16_t(r[1] + 8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 30a4: mov 6(r1), -(sp)
+    {
+        a = uint16_t(r[1] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 30a8: mov *2(sp), r1
+    {
+        a = RD16(r[6] + 2);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 30ac: mul (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 30ae: mov r1, *(sp)+
+    {
+        src = r[1];
+        b = RD16(r[6]);
+        r[6] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 30b0: br 30c8
+    AOT_GOTO(0x30c8, L30c8);
+L30b2:
+    AOT_BLOCK(0x30b2, 6);
+    // 30b2: mov 8(r2), r0
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 30b6: mov 6(r2), r1
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 30ba: mov 8(r1), r1
+    {
+        a = uint16_t(r[1] + 8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 30be: mov 6(r1), r1
+    {
+        a = uint16_t(r[1] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 30c2: ash r4, r1
+    {
+        src = r[4] & 077;
+        val16 = r[1];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 30c4: mov r1, 6(r0)
+    {
+        src = r[1];
+        b = uint16_t(r[0] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x30c8, L30c8);
+L30c8:
+    AOT_BLOCK(0x30c8, 7);
+    // 30c8: mov 6(r2), r0
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 30cc: mov 8(r0), r0
+    {
+        a = uint16_t(r[0] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 30d0: mov r4, 6(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 6);
+        WR16(b, src);
+    }
+    // 30d4: mov (r2), *6(r2)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = RD16(r[2] + 6);
+        WR16(b, src);
+    }
+    // 30d8: mov $28, (r2)
+    {
+        src = uint16_t(0x0028);
+        b = r[2];
+        WR16(b, src);
+    }
+    // 30dc: cmp $28, 4(r5)
+    {
+        src = uint16_t(0x0028);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 30e2: beq 3008
+    if (Z)
+        AOT_GOTO(0x3008, L3008);
+    AOT_GOTO(0x30e4, L30e4);
+L30e4:
+    AOT_BLOCK(0x30e4, 2);
+    // 30e4: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 30e6: jsr pc, *$1228
+    {
+        a = 0x1228;
+        r[6] -= 2;
+        WR16(r[6], 0x30ea);
+    }
+    AOT_GOTO(0x1228, L1228);
+L30ea:
+    AOT_BLOCK(0x30ea, 2);
+    // 30ea: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 30ec: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x30f0, L30f0);
+L30f0:
+    AOT_BLOCK(0x30f0, 2);
+    // 30f0: cmp (r3), -a(r5)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 30f4: ble 3136
+    if (Z || (N ^ V))
+        AOT_GOTO(0x3136, L3136);
+    AOT_GOTO(0x30f6, L30f6);
+L30f6:
+    AOT_BLOCK(0x30f6, 5);
+    // 30f6: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 30fa: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 30fc: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 30fe: mov 2c(r0), (sp)
+    {
+        a = uint16_t(r[0] + 44);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3102: jsr pc, *$1228
+    {
+        a = 0x1228;
+        r[6] -= 2;
+        WR16(r[6], 0x3106);
+    }
+    AOT_GOTO(0x1228, L1228);
+L3106:
+    AOT_BLOCK(0x3106, 3);
+    // 3106: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 310a: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 310c: ble 3130
+    if (Z || (N ^ V))
+        AOT_GOTO(0x3130, L3130);
+    AOT_GOTO(0x310e, L310e);
+L310e:
+    AOT_BLOCK(0x310e, 10);
+    // 310e: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3112: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 3114: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 3116: mov 2c(r0), -c(r5)
+    {
+        a = uint16_t(r[0] + 44);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 311c: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3120: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 3122: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 3124: mov r2, 2c(r0)
+    {
+        src = r[2];
+        b = uint16_t(r[0] + 44);
+        WR16(b, src);
+    }
+    // 3128: mov -c(r5), r2
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 312c: mov -8(r5), r4
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3130, L3130);
+L3130:
+    AOT_BLOCK(0x3130, 2);
+    // 3130: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 3134: br 30f0
+    AOT_GOTO(0x30f0, L30f0);
+L3136:
+    AOT_BLOCK(0x3136, 5);
+    // 3136: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3138: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 313a: inc (r3)
+    {
+        a = r[3];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 313c: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 313e: mov r2, 2c(r0)
+    {
+        src = r[2];
+        b = uint16_t(r[0] + 44);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3142, L3142);
+L3142:
+    AOT_BLOCK(0x3142, 2);
+    // 3142: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3146:
+    AOT_BLOCK(0x3146, 9);
+    // 3146: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x314a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 314a: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 314c: mov 59f6, r4
+    {
+        a = 0x59f6;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 3150: mov r4, -8(r5)
+    {
+        src = r[4];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 3154: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 3158: add $3, r2
+    {
+        src = uint16_t(0x0003);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 315c: mov r5, r3
+    {
+        src = r[5];
+        r[3] = src;
+    }
+    // 315e: add $6, r3
+    {
+        src = uint16_t(0x0006);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x3162, L3162);
+L3162:
+    AOT_BLOCK(0x3162, 3);
+    // 3162: mov (r3)+, (r4)+
+    {
+        a = r[3];
+        r[3] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+    }
+    // 3164: dec r2
+    {
+        val = int(int16_t(r[2])) - 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 3166: bne 3162
+    if (!Z)
+        AOT_GOTO(0x3162, L3162);
+    AOT_GOTO(0x3168, L3168);
+L3168:
+    AOT_BLOCK(0x3168, 2);
+    // 3168: cmp $5de0, r4
+    {
+        src = uint16_t(0x5de0);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 316c: bhi 317e
+    if (!(C | Z))
+        AOT_GOTO(0x317e, L317e);
+    AOT_GOTO(0x316e, L316e);
+L316e:
+    AOT_BLOCK(0x316e, 1);
+    // 316e: mov $4558, (sp)
+    {
+        src = uint16_t(0x4558);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3172, L3172);
+L3172:
+    AOT_BLOCK(0x3172, 1);
+    // 3172: jsr pc, *$1e68
+    {
+        a = 0x1e68;
+        r[6] -= 2;
+        WR16(r[6], 0x3176);
+    }
+    AOT_GOTO(0x1e68, L1e68);
+L3176:
+    AOT_BLOCK(0x3176, 2);
+    // 3176: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 317a: jsr pc, *$3c68
+    {
+        a = 0x3c68;
+        r[6] -= 2;
+        WR16(r[6], 0x317e);
+    }
+    AOT_GOTO(0x3c68, L3c68);
+L317e:
+    AOT_BLOCK(0x317e, 3);
+    // 317e: mov r4, 59f6
+    {
+        src = r[4];
+        b = 0x59f6;
+        WR16(b, src);
+    }
+    // 3182: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3186: br 3188
+    AOT_GOTO(0x3188, L3188);
+L3188:
+    AOT_BLOCK(0x3188, 2);
+    // 3188: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L318c:
+    AOT_BLOCK(0x318c, 4);
+    // 318c: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x3190;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 3190: cmp $6, 4(r5)
+    {
+        src = uint16_t(0x0006);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3196: bne 319e
+    if (!Z)
+        AOT_GOTO(0x319e, L319e);
+    AOT_GOTO(0x3198, L3198);
+L3198:
+    AOT_BLOCK(0x3198, 2);
+    // 3198: mov $2, r0
+    {
+        src = uint16_t(0x0002);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 319c: br 31a4
+    AOT_GOTO(0x31a4, L31a4);
+L319e:
+    AOT_BLOCK(0x319e, 2);
+    // 319e: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 31a2: br 31a4
+    AOT_GOTO(0x31a4, L31a4);
+L31a4:
+    AOT_BLOCK(0x31a4, 2);
+    // 31a4: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L31a8:
+    AOT_BLOCK(0x31a8, 5);
+    // 31a8: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x31ac;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 31ac: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 31b0: cmp $15, (r4)
+    {
+        src = uint16_t(0x0015);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 31b4: beq 31bc
+    if (Z)
+        AOT_GOTO(0x31bc, L31bc);
+    AOT_GOTO(0x31b6, L31b6);
+L31b6:
+    AOT_BLOCK(0x31b6, 2);
+    // 31b6: cmp $18, (r4)
+    {
+        src = uint16_t(0x0018);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 31ba: bne 31c0
+    if (!Z)
+        AOT_GOTO(0x31c0, L31c0);
+    AOT_GOTO(0x31bc, L31bc);
+L31bc:
+    AOT_BLOCK(0x31bc, 2);
+    // 31bc: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 31be: br 31d8
+    AOT_GOTO(0x31d8, L31d8);
+L31c0:
+    AOT_BLOCK(0x31c0, 2);
+    // 31c0: cmp $3a, (r4)
+    {
+        src = uint16_t(0x003a);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 31c4: bne 31d4
+    if (!Z)
+        AOT_GOTO(0x31d4, L31d4);
+    AOT_GOTO(0x31c6, L31c6);
+L31c6:
+    AOT_BLOCK(0x31c6, 2);
+    // 31c6: cmp $15, *6(r4)
+    {
+        src = uint16_t(0x0015);
+        b = RD16(r[4] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 31cc: bne 31d4
+    if (!Z)
+        AOT_GOTO(0x31d4, L31d4);
+    AOT_GOTO(0x31ce, L31ce);
+L31ce:
+    AOT_BLOCK(0x31ce, 2);
+    // 31ce: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 31d2: br 31d8
+    AOT_GOTO(0x31d8, L31d8);
+L31d4:
+    AOT_BLOCK(0x31d4, 2);
+    // 31d4: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 31d6: br 31d8
+    AOT_GOTO(0x31d8, L31d8);
+L31d8:
+    AOT_BLOCK(0x31d8, 2);
+    // 31d8: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L31dc:
+    AOT_BLOCK(0x31dc, 5);
+    // 31dc: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x31e0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 31e0: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 31e4: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 31e6: br 3218
+    AOT_GOTO(0x3218, L3218);
+L31e8:
+    AOT_BLOCK(0x31e8, 2);
+    // 31e8: add $28, (r4)
+    {
+        src = uint16_t(0x0028);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 31ec: br 3228
+    AOT_GOTO(0x3228, L3228);
+L31ee:
+    AOT_BLOCK(0x31ee, 7);
+    // 31ee: add $e, (r4)
+    {
+        src = uint16_t(0x000e);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 31f2: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 31f6: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 31f8: mov $e, -(sp)
+    {
+        src = uint16_t(0x000e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 31fc: mov $23, -(sp)
+    {
+        src = uint16_t(0x0023);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3200: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3204: jsr pc, *$3146
+    {
+        a = 0x3146;
+        r[6] -= 2;
+        WR16(r[6], 0x3208);
+    }
+    AOT_GOTO(0x3146, L3146);
+L3208:
+    AOT_BLOCK(0x3208, 3);
+    // 3208: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 320c: mov r0, 6(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3210: br 3228
+    AOT_GOTO(0x3228, L3228);
+L3212:
+    AOT_BLOCK(0x3212, 2);
+    // 3212: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3214: br 3230
+    AOT_GOTO(0x3230, L3230);
+L3218:
+    AOT_BLOCK(0x3218, 2);
+    // 3218: mov $4520, r1
+    {
+        src = uint16_t(0x4520);
+        r[1] = src;
+    }
+    // 321c: mov r0, 452c
+    {
+        src = r[0];
+        b = 0x452c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3220, L3220);
+L3220:
+    AOT_BLOCK(0x3220, 2);
+    // 3220: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3222: bne 3220
+    if (!Z)
+        AOT_GOTO(0x3220, L3220);
+    AOT_GOTO(0x3224, L3224);
+L3224:
+    AOT_BLOCK(0x3224, 1);
+    // 3224: jmp *c(r1)
+    {
+        a = RD16(r[1] + 12);
+    }
+    AOT_JUMP(a);
+L3228:
+    AOT_BLOCK(0x3228, 2);
+    // 3228: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 322a: jsr pc, *$241c
+    {
+        a = 0x241c;
+        r[6] -= 2;
+        WR16(r[6], 0x322e);
+    }
+    AOT_GOTO(0x241c, L241c);
+L322e:
+    AOT_BLOCK(0x322e, 1);
+    // 322e: br 3230
+    AOT_GOTO(0x3230, L3230);
+L3230:
+    AOT_BLOCK(0x3230, 2);
+    // 3230: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3234:
+    AOT_BLOCK(0x3234, 1);
+    // 3234: add *76(r5), *-(r5)
+    {
+        a = RD16(r[5] + 118);
+        src = RD16(a);
+        r[5] -= 2;
+        b = RD16(r[5]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x3238, L3238);
+L3238:
+    AOT_BLOCK(0x3238, 1);
+    // 3238: add 72(r1), -(r3)
+    {
+        a = uint16_t(r[1] + 114);
+        src = RD16(a);
+        r[3] -= 2;
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x323c, L323c);
+L323c:
+    AOT_BLOCK(0x323c, 1);
+    // 323c: add 70(r5), -(r3)
+    {
+        a = uint16_t(r[5] + 112);
+        src = RD16(a);
+        r[3] -= 2;
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x3240, L3240);
+L3240:
+    AOT_BLOCK(0x3240, 1);
+    // 3240: div 74(r4), r5
+    {
+        a = uint16_t(r[4] + 116);
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[5])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[5]) << 16) | r[6];
+        dst = val / src;
+        r[5] = dst;
+        r[6] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    AOT_GOTO(0x3244, L3244);
+L3244:
+    AOT_BLOCK(0x3244, 2);
+    // 3244: add (r1)+, -(r1)
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 3246: jmp -(r4)
+    {
+        r[4] -= 2;
+        a = r[4];
+    }
+    AOT_JUMP(a);
+L3248:
+    AOT_BLOCK(0x3248, 1);
+    // 3248: ash 62(r3), r5
+    {
+        a = uint16_t(r[3] + 98);
+        src = RD16(a) & 077;
+        val16 = r[5];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    AOT_GOTO(0x324c, L324c);
+L324c:
+    AOT_BLOCK(0x324c, 1);
+    // 324c: add *63(r1), *-(r1)
+    {
+        a = RD16(r[1] + 99);
+        src = RD16(a);
+        r[1] -= 2;
+        b = RD16(r[1]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x3250, L3250);
+L3250:
+    AOT_BLOCK(0x3250, 2);
+    // 3250: add (r5)+, -(r4)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 3252: jmp -(r3)
+    {
+        r[3] -= 2;
+        a = r[3];
+    }
+    AOT_JUMP(a);
+L3254:
+    AOT_BLOCK(0x3254, 2);
+    // 3254: ash *-(r5), r5
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a) & 077;
+        val16 = r[5];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 3256: jmp *-(r4)
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+    }
+    AOT_JUMP(a);
+L3258:
+    AOT_BLOCK(0x3258, 2);
+    // 3258: add -(r5), -(r4)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 325a: jmp 7361(sp)
+    {
+        a = uint16_t(r[6] + 29537);
+    }
+    AOT_JUMP(a);
+L3264:
+    AOT_BLOCK(0x3264, 2);
+    // 3264: div -(r1), r5
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[5])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[5]) << 16) | r[6];
+        dst = val / src;
+        r[5] = dst;
+        r[6] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 3266: jmp *-(r4)
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+    }
+    AOT_JUMP(a);
+L3268:
+    AOT_BLOCK(0x3268, 2);
+    // 3268: add -(r5), -(r2)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 326a: jmp -(r3)
+    {
+        r[3] -= 2;
+        a = r[3];
+    }
+    AOT_JUMP(a);
+L326c:
+    AOT_BLOCK(0x326c, 3);
+    // 326c: add -(r5), -(r2)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 326e: cmp r1, -(r3)
+    {
+        src = r[1];
+        r[3] -= 2;
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 3270: bit r4, -(r4)
+    {
+        src = r[4];
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3272: (undefined)
+    AOT_INTERP(0x3272);
+L3274:
+    AOT_BLOCK(0x3274, 2);
+    // 3274: add -(r5), -(r2)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 3276: jmp 6962(r4)
+    {
+        a = uint16_t(r[4] + 26978);
+    }
+    AOT_JUMP(a);
+L3280:
+    AOT_BLOCK(0x3280, 2);
+    // 3280: add -(r5), -(r2)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 3282: jmp 6962(r3)
+    {
+        a = uint16_t(r[3] + 26978);
+    }
+    AOT_JUMP(a);
+L328c:
+    AOT_BLOCK(0x328c, 1);
+    // 328c: add *72(r5), *656e(r0)
+    {
+        a = RD16(r[5] + 114);
+        src = RD16(a);
+        b = RD16(r[0] + 25966);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 3292: jmp -(pc)
+    AOT_INTERP(0x3292);
+L3294:
+    AOT_BLOCK(0x3294, 1);
+    // 3294: add *6d(r5), -(r3)
+    {
+        a = RD16(r[5] + 109);
+        src = RD16(a);
+        r[3] -= 2;
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x3298, L3298);
+L3298:
+    AOT_BLOCK(0x3298, 1);
+    // 3298: cmp (r0)+, *-(r2)
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x329a, L329a);
+L329a:
+    // 329a: halt
+    AOT_INTERP(0x329a);
+L329c:
+    AOT_BLOCK(0x329c, 2);
+    // 329c: div -(r1), r5
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[5])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[5]) << 16) | r[6];
+        dst = val / src;
+        r[5] = dst;
+        r[6] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 329e: add (r5), *-(r0)
+    {
+        a = r[5];
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 32a0: halt
+    AOT_INTERP(0x32a0);
+L32a2:
+    AOT_BLOCK(0x32a2, 1);
+    // 32a2: add 6c75(r5), *-(r4)
+    {
+        a = uint16_t(r[5] + 27765);
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 32a6: halt
+    AOT_INTERP(0x32a6);
+L32a8:
+    AOT_BLOCK(0x32a8, 1);
+    // 32a8: add (r1)+, *-(r4)
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x32aa, L32aa);
+L32aa:
+    AOT_BLOCK(0x32aa, 1);
+    // 32aa: ashc *-(r1), r1
+    {
+        r[1] -= 2;
+        a = RD16(r[1]);
+        src = RD16(a) & 077;
+        val = int32_t((uint32_t(r[1]) << 16) | r[2]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[1] = uint32_t(val2) >> 16;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[1] = uint32_t(val2) >> 16;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 32ac: halt
+    AOT_INTERP(0x32ac);
+L32ae:
+    AOT_BLOCK(0x32ae, 2);
+    // 32ae: div *-(r4), r1
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[1])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[1]) << 16) | r[2];
+        dst = val / src;
+        r[1] = dst;
+        r[2] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 32b0: add 0(r5), -(r5)
+    {
+        a = uint16_t(r[5] + 0);
+        src = RD16(a);
+        r[5] -= 2;
+        b = r[5];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x32b4, L32b4);
+L32b4:
+    AOT_BLOCK(0x32b4, 2);
+    // 32b4: add 756d(r1), -(r1)
+    {
+        a = uint16_t(r[1] + 30061);
+        src = RD16(a);
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 32b8: jmp *-(r4)
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+    }
+    AOT_JUMP(a);
+L32ba:
+    AOT_BLOCK(0x32ba, 2);
+    // 32ba: add 6964(r1), -(r1)
+    {
+        a = uint16_t(r[1] + 26980);
+        src = RD16(a);
+        r[1] -= 2;
+        b = r[1];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 32be: jmp 6c61(sp)
+    {
+        a = uint16_t(r[6] + 27745);
+    }
+    AOT_JUMP(a);
+L32c6:
+    AOT_BLOCK(0x32c6, 2);
+    // 32c6: add (r5)+, *-(r2)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 32c8: jmp 6e6a(r1)
+    {
+        a = uint16_t(r[1] + 28266);
+    }
+    AOT_JUMP(a);
+L32ce:
+    AOT_BLOCK(0x32ce, 1);
+    // 32ce: add 65(r1), *-(r2)
+    {
+        a = uint16_t(r[1] + 101);
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x32d2, L32d2);
+L32d2:
+    AOT_BLOCK(0x32d2, 2);
+    // 32d2: add *(r5)+, *-(r2)
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 32d4: jmp 6c6a(r4)
+    {
+        a = uint16_t(r[4] + 27754);
+    }
+    AOT_JUMP(a);
+L32de:
+    AOT_BLOCK(0x32de, 3);
+    // 32de: add 736f(r1), *-(r2)
+    {
+        a = uint16_t(r[1] + 29551);
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 32e2: add *-(r0), r0
+    {
+        r[0] -= 2;
+        a = RD16(r[0]);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 32e4: add -(r5), *-(r0)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 32e6: halt
+    AOT_INTERP(0x32e6);
+L32e8:
+    AOT_BLOCK(0x32e8, 1);
+    // 32e8: add 6f(r1), *-(r2)
+    {
+        a = uint16_t(r[1] + 111);
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x32ec, L32ec);
+L32ec:
+    AOT_BLOCK(0x32ec, 2);
+    // 32ec: add -(r1), *-(r2)
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 32ee: div *-(r1), r5
+    {
+        r[1] -= 2;
+        a = RD16(r[1]);
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[5])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[5]) << 16) | r[6];
+        dst = val / src;
+        r[5] = dst;
+        r[6] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 32f0: halt
+    AOT_INTERP(0x32f0);
+L32f2:
+    AOT_BLOCK(0x32f2, 3);
+    // 32f2: add *706f(r0), *-(pc)
+    {
+        a = RD16(r[0] + 28783);
+        src = RD16(a);
+        dst = uint16_t(0x0000);
+        val16 = val = int16_t(src) + int16_t(dst);
+    }
+    // 32f6: add *-(r0), r0
+    {
+        r[0] -= 2;
+        a = RD16(r[0]);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 32f8: div -(r2), r1
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[1])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[1]) << 16) | r[2];
+        dst = val / src;
+        r[1] = dst;
+        r[2] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 32fa: halt
+    AOT_INTERP(0x32fa);
+L32fc:
+    // 32fc: halt
+    AOT_INTERP(0x32fc);
+L32fe:
+    // 32fe: (undefined)
+    AOT_INTERP(0x32fe);
+L3300:
+    // 3300: (undefined)
+    AOT_INTERP(0x3300);
+L3302:
+    AOT_BLOCK(0x3302, 2);
+    // 3302: bic *-(r4), (r0)+
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+        src = RD16(a);
+        b = r[0];
+        r[0] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3304: jmp *3347
+    {
+        a = RD16(0x3347);
+    }
+    AOT_JUMP(a);
+L330c:
+    // 330c: (undefined)
+    AOT_INTERP(0x330c);
+L330e:
+    // 330e: (undefined)
+    AOT_INTERP(0x330e);
+L3310:
+    AOT_BLOCK(0x3310, 2);
+    // 3310: bic *-(r4), -(r2)
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3312: jmp *3355
+    {
+        a = RD16(0x3355);
+    }
+    AOT_JUMP(a);
+L3320:
+    // 3320: iot
+    AOT_INTERP(0x3320);
+L3322:
+    // 3322: (undefined)
+    AOT_INTERP(0x3322);
+L3324:
+    AOT_BLOCK(0x3324, 2);
+    // 3324: bic *-(r5), (r0)
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3326: bge 3330
+    if (!(N ^ V))
+        AOT_GOTO(0x3330, L3330);
+    AOT_GOTO(0x3328, L3328);
+L3328:
+    // 3328: (undefined)
+    AOT_INTERP(0x3328);
+L332a:
+    AOT_BLOCK(0x332a, 1);
+    // 332a: bic *-(r5), (sp)
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 332c: (undefined)
+    AOT_INTERP(0x332c);
+L332e:
+    // 332e: (undefined)
+    AOT_INTERP(0x332e);
+L3330:
+    AOT_BLOCK(0x3330, 2);
+    // 3330: bic *-(r5), (sp)+
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3332: blt 3354
+    if (N ^ V)
+        AOT_GOTO(0x3354, L3354);
+    AOT_GOTO(0x3334, L3334);
+L3334:
+    // 3334: (undefined)
+    AOT_INTERP(0x3334);
+L3336:
+    AOT_BLOCK(0x3336, 2);
+    // 3336: bic *-(r5), (sp)+
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3338: bge 335a
+    if (!(N ^ V))
+        AOT_GOTO(0x335a, L335a);
+    AOT_GOTO(0x333a, L333a);
+L333a:
+    // 333a: (undefined)
+    AOT_INTERP(0x333a);
+L333c:
+    AOT_BLOCK(0x333c, 2);
+    // 333c: bic *-(r5), -(r0)
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 333e: jmp *3381
+    {
+        a = RD16(0x3381);
+    }
+    AOT_JUMP(a);
+L3354:
+    AOT_BLOCK(0x3354, 2);
+    // 3354: bic *-(sp), (r0)
+    {
+        r[6] -= 2;
+        a = RD16(r[6]);
+        src = RD16(a);
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3356: jsr r1, *3399
+    {
+        a = RD16(0x3399);
+        r[6] -= 2;
+        WR16(r[6], r[1]);
+        r[1] = 0x335a;
+    }
+    AOT_JUMP(a);
+L335a:
+    AOT_BLOCK(0x335a, 1);
+    // 335a: bic *-(sp), *(r2)+
+    {
+        r[6] -= 2;
+        a = RD16(r[6]);
+        src = RD16(a);
+        b = RD16(r[2]);
+        r[2] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 335c: halt
+    AOT_INTERP(0x335c);
+L335e:
+    // 335e: (undefined)
+    AOT_INTERP(0x335e);
+L3360:
+    // 3360: reset
+    AOT_INTERP(0x3360);
+L3362:
+    AOT_BLOCK(0x3362, 1);
+    // 3362: bic *-(sp), 110(r4)
+    {
+        r[6] -= 2;
+        a = RD16(r[6]);
+        src = RD16(a);
+        b = uint16_t(r[4] + 272);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3366: (undefined)
+    AOT_INTERP(0x3366);
+L3368:
+    AOT_BLOCK(0x3368, 2);
+    // 3368: bic *-(pc), r4
+    {
+        src = uint16_t(0x0000);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 336a: jmp (r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+    }
+    AOT_JUMP(a);
+L3396:
+    // 3396: (undefined)
+    AOT_INTERP(0x3396);
+L3398:
+    // 3398: (undefined)
+    AOT_INTERP(0x3398);
+L339a:
+    AOT_BLOCK(0x339a, 1);
+    // 339a: bic 43f(r3), (sp)
+    {
+        a = uint16_t(r[3] + 1087);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 339e: (undefined)
+    AOT_INTERP(0x339e);
+L33a0:
+    AOT_BLOCK(0x33a0, 1);
+    // 33a0: bic 83f(r3), (sp)
+    {
+        a = uint16_t(r[3] + 2111);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 33a4: (undefined)
+    AOT_INTERP(0x33a4);
+L33a6:
+    AOT_BLOCK(0x33a6, 1);
+    // 33a6: bic 0(r3), (sp)+
+    {
+        a = uint16_t(r[3] + 0);
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x33aa, L33aa);
+L33aa:
+    // 33aa: (undefined)
+    AOT_INTERP(0x33aa);
+L33ac:
+    // 33ac: (undefined)
+    AOT_INTERP(0x33ac);
+L33ae:
+    AOT_BLOCK(0x33ae, 2);
+    // 33ae: bic 510(r3), -(r4)
+    {
+        a = uint16_t(r[3] + 1296);
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 33b2: bge 3432
+    if (!(N ^ V))
+        AOT_GOTO(0x3432, L3432);
+    AOT_GOTO(0x33b4, L33b4);
+L33b4:
+    AOT_BLOCK(0x33b4, 2);
+    // 33b4: bic 410(r3), -(r4)
+    {
+        a = uint16_t(r[3] + 1040);
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 33b8: bge 3438
+    if (!(N ^ V))
+        AOT_GOTO(0x3438, L3438);
+    AOT_GOTO(0x33ba, L33ba);
+L33ba:
+    AOT_BLOCK(0x33ba, 4);
+    // 33ba: bic 57f(r3), 410(r0)
+    {
+        a = uint16_t(r[3] + 1407);
+        src = RD16(a);
+        b = uint16_t(r[0] + 1040);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 33c0: bic 7f(r3), *10(r4)
+    {
+        a = uint16_t(r[3] + 127);
+        src = RD16(a);
+        b = RD16(r[4] + 16);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 33c6: bic 47f(r4), (r4)
+    {
+        a = uint16_t(r[4] + 1151);
+        src = RD16(a);
+        b = r[4];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 33ca: bge 33ec
+    if (!(N ^ V))
+        AOT_GOTO(0x33ec, L33ec);
+    AOT_GOTO(0x33cc, L33cc);
+L33cc:
+    AOT_BLOCK(0x33cc, 1);
+    // 33cc: bic 7f(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 127);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 33d0: (undefined)
+    AOT_INTERP(0x33d0);
+L33d2:
+    AOT_BLOCK(0x33d2, 3);
+    // 33d2: bic 554(r4), *43f(r0)
+    {
+        a = uint16_t(r[4] + 1364);
+        src = RD16(a);
+        b = RD16(r[0] + 1087);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 33d8: bic 454(r5), (r0)+
+    {
+        a = uint16_t(r[5] + 1108);
+        src = RD16(a);
+        b = r[0];
+        r[0] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 33dc: bge 345c
+    if (!(N ^ V))
+        AOT_GOTO(0x345c, L345c);
+    AOT_GOTO(0x33de, L33de);
+L33de:
+    AOT_BLOCK(0x33de, 1);
+    // 33de: bic 7f(r5), -(r0)
+    {
+        a = uint16_t(r[5] + 127);
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 33e2: (undefined)
+    AOT_INTERP(0x33e2);
+L33e4:
+    AOT_BLOCK(0x33e4, 2);
+    // 33e4: bic 57f(r5), 43f(r2)
+    {
+        a = uint16_t(r[5] + 1407);
+        src = RD16(a);
+        b = uint16_t(r[2] + 1087);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 33ea: bic 47f(r5), 43f(r2)
+    {
+        a = uint16_t(r[5] + 1151);
+        src = RD16(a);
+        b = uint16_t(r[2] + 1087);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x33f0, L33f0);
+L33ec:
+    AOT_BLOCK(0x33ec, 1);
+    // 33ec: bge 34ec
+    if (!(N ^ V))
+        AOT_GOTO(0x34ec, L34ec);
+    AOT_GOTO(0x33ee, L33ee);
+L33ee:
+    AOT_BLOCK(0x33ee, 1);
+    // 33ee: bge 346e
+    if (!(N ^ V))
+        AOT_GOTO(0x346e, L346e);
+    AOT_GOTO(0x33f0, L33f0);
+L33f0:
+    AOT_BLOCK(0x33f0, 1);
+    // 33f0: bic 0(sp), r4
+    {
+        a = uint16_t(r[6] + 0);
+        src = RD16(a);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x33f4, L33f4);
+L33f4:
+    // 33f4: (undefined)
+    AOT_INTERP(0x33f4);
+L33f6:
+    // 33f6: iot
+    AOT_INTERP(0x33f6);
+L33f8:
+    AOT_BLOCK(0x33f8, 1);
+    // 33f8: bic 3f(sp), *(r0)+
+    {
+        a = uint16_t(r[6] + 63);
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 33fc: reset
+    AOT_INTERP(0x33fc);
+L33fe:
+    AOT_BLOCK(0x33fe, 2);
+    // 33fe: bic 3f(sp), *(r4)+
+    {
+        a = uint16_t(r[6] + 63);
+        src = RD16(a);
+        b = RD16(r[4]);
+        r[4] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3402: br 3424
+    AOT_GOTO(0x3424, L3424);
+L3424:
+    // 3424: (undefined)
+    AOT_INTERP(0x3424);
+L3426:
+    AOT_BLOCK(0x3426, 1);
+    // 3426: br 3526
+    AOT_GOTO(0x3526, L3526);
+L3432:
+    // 3432: (undefined)
+    AOT_INTERP(0x3432);
+L3434:
+    AOT_BLOCK(0x3434, 1);
+    // 3434: bic 3877, *(r0)+
+    {
+        a = 0x3877;
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3438, L3438);
+L3438:
+    AOT_BLOCK(0x3438, 1);
+    // 3438: bge 34b8
+    if (!(N ^ V))
+        AOT_GOTO(0x34b8, L34b8);
+    AOT_GOTO(0x343a, L343a);
+L343a:
+    AOT_BLOCK(0x343a, 1);
+    // 343a: bic 3c7d, *(r0)+
+    {
+        a = 0x3c7d;
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 343e: (undefined)
+    AOT_INTERP(0x343e);
+L3440:
+    AOT_BLOCK(0x3440, 2);
+    // 3440: bic 3c83, *-(r0)
+    {
+        a = 0x3c83;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3444: jsr r0, (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3446;
+    }
+    AOT_JUMP(a);
+L3446:
+    AOT_BLOCK(0x3446, 3);
+    // 3446: bic 3c89, 814(r4)
+    {
+        a = 0x3c89;
+        src = RD16(a);
+        b = uint16_t(r[4] + 2068);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 344c: bic *83f(r0), sp
+    {
+        a = RD16(r[0] + 2111);
+        src = RD16(a);
+        dst = r[6];
+        val = (~src) & dst;
+        r[6] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3450: jsr r0, *826e
+    {
+        a = RD16(0x826e);
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3454;
+    }
+    AOT_JUMP(a);
+L3454:
+    // 3454: halt
+    AOT_INTERP(0x3454);
+L3456:
+    // 3456: (undefined)
+    AOT_INTERP(0x3456);
+L3458:
+    // 3458: (undefined)
+    AOT_INTERP(0x3458);
+L345a:
+    AOT_BLOCK(0x345a, 1);
+    // 345a: bic 3f(sp), *3f(r4)
+    {
+        a = uint16_t(r[6] + 63);
+        src = RD16(a);
+        b = RD16(r[4] + 63);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3460, L3460);
+L345c:
+    // 345c: (undefined)
+    AOT_INTERP(0x345c);
+L345e:
+    // 345e: (undefined)
+    AOT_INTERP(0x345e);
+L3460:
+    AOT_BLOCK(0x3460, 1);
+    // 3460: bic *0(r0), 3f(sp)
+    {
+        a = RD16(r[0] + 0);
+        src = RD16(a);
+        b = uint16_t(r[6] + 63);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3466: reset
+    AOT_INTERP(0x3466);
+L3468:
+    AOT_BLOCK(0x3468, 1);
+    // 3468: bic *0(r1), (r0)+
+    {
+        a = RD16(r[1] + 0);
+        src = RD16(a);
+        b = r[0];
+        r[0] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x346c, L346c);
+L346c:
+    // 346c: (undefined)
+    AOT_INTERP(0x346c);
+L346e:
+    AOT_BLOCK(0x346e, 1);
+    // 346e: br 3490
+    AOT_GOTO(0x3490, L3490);
+L3490:
+    // 3490: (undefined)
+    AOT_INTERP(0x3490);
+L3492:
+    // 3492: (undefined)
+    AOT_INTERP(0x3492);
+L3494:
+    AOT_BLOCK(0x3494, 2);
+    // 3494: bic 38d7, *(r0)+
+    {
+        a = 0x38d7;
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3498: bge 3518
+    if (!(N ^ V))
+        AOT_GOTO(0x3518, L3518);
+    AOT_GOTO(0x349a, L349a);
+L349a:
+    AOT_BLOCK(0x349a, 1);
+    // 349a: bic 349e, *(r0)+
+    {
+        a = 0x349e;
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x349e, L349e);
+L349e:
+    // 349e: (undefined)
+    AOT_INTERP(0x349e);
+L34a0:
+    AOT_BLOCK(0x34a0, 1);
+    // 34a0: br 34c2
+    AOT_GOTO(0x34c2, L34c2);
+L34b8:
+    AOT_BLOCK(0x34b8, 1);
+    // 34b8: blt 34da
+    if (N ^ V)
+        AOT_GOTO(0x34da, L34da);
+    AOT_GOTO(0x34ba, L34ba);
+L34ba:
+    AOT_BLOCK(0x34ba, 2);
+    // 34ba: bic 43f(sp), -(r4)
+    {
+        a = uint16_t(r[6] + 1087);
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 34be: blt 3568
+    if (N ^ V)
+        AOT_GOTO(0x3568, L3568);
+    AOT_GOTO(0x34c0, L34c0);
+L34c0:
+    AOT_BLOCK(0x34c0, 1);
+    // 34c0: bic 43f(sp), *-(sp)
+    {
+        a = uint16_t(r[6] + 1087);
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x34c4, L34c4);
+L34c2:
+    AOT_BLOCK(0x34c2, 1);
+    // 34c2: bge 3542
+    if (!(N ^ V))
+        AOT_GOTO(0x3542, L3542);
+    AOT_GOTO(0x34c4, L34c4);
+L34c4:
+    AOT_BLOCK(0x34c4, 1);
+    // 34c4: bge 34ee
+    if (!(N ^ V))
+        AOT_GOTO(0x34ee, L34ee);
+    AOT_GOTO(0x34c6, L34c6);
+L34c6:
+    AOT_BLOCK(0x34c6, 2);
+    // 34c6: bic 43f(sp), *43f(r4)
+    {
+        a = uint16_t(r[6] + 1087);
+        src = RD16(a);
+        b = RD16(r[4] + 1087);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 34cc: bic 34d0, *(r0)+
+    {
+        a = 0x34d0;
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x34d0, L34d0);
+L34d0:
+    AOT_BLOCK(0x34d0, 1);
+    // 34d0: br 34f2
+    AOT_GOTO(0x34f2, L34f2);
+L34da:
+    AOT_BLOCK(0x34da, 3);
+    // 34da: bic *510(r2), *510(r4)
+    {
+        a = RD16(r[2] + 1296);
+        src = RD16(a);
+        b = RD16(r[4] + 1296);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 34e0: bic *110(r2), *17f(r4)
+    {
+        a = RD16(r[2] + 272);
+        src = RD16(a);
+        b = RD16(r[4] + 383);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 34e6: bic *110(r3), (r4)+
+    {
+        a = RD16(r[3] + 272);
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 34ea: (undefined)
+    AOT_INTERP(0x34ea);
+L34ec:
+    AOT_BLOCK(0x34ec, 2);
+    // 34ec: bic *154(r3), *-(r0)
+    {
+        a = RD16(r[3] + 340);
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 34f0: br 35f0
+    AOT_GOTO(0x35f0, L35f0);
+L34ee:
+    AOT_BLOCK(0x34ee, 1);
+    // 34ee: br 3598
+    AOT_GOTO(0x3598, L3598);
+L34f2:
+    AOT_BLOCK(0x34f2, 2);
+    // 34f2: bic *510(r3), *414(r0)
+    {
+        a = RD16(r[3] + 1296);
+        src = RD16(a);
+        b = RD16(r[0] + 1044);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 34f8: bic *10(r4), (r2)+
+    {
+        a = RD16(r[4] + 16);
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 34fc: (undefined)
+    AOT_INTERP(0x34fc);
+L34fe:
+    AOT_BLOCK(0x34fe, 2);
+    // 34fe: bic *510(r4), *-(r4)
+    {
+        a = RD16(r[4] + 1296);
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3502: bge 3582
+    if (!(N ^ V))
+        AOT_GOTO(0x3582, L3582);
+    AOT_GOTO(0x3504, L3504);
+L3504:
+    AOT_BLOCK(0x3504, 2);
+    // 3504: bic *410(r4), *-(r4)
+    {
+        a = RD16(r[4] + 1040);
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3508: bge 3588
+    if (!(N ^ V))
+        AOT_GOTO(0x3588, L3588);
+    AOT_GOTO(0x350a, L350a);
+L350a:
+    AOT_BLOCK(0x350a, 1);
+    // 350a: bic *154(r5), (r2)
+    {
+        a = RD16(r[5] + 340);
+        src = RD16(a);
+        b = r[2];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 350e: (undefined)
+    AOT_INTERP(0x350e);
+L3510:
+    AOT_BLOCK(0x3510, 1);
+    // 3510: bic *17f(r5), *-(r2)
+    {
+        a = RD16(r[5] + 383);
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3514: (undefined)
+    AOT_INTERP(0x3514);
+L3516:
+    AOT_BLOCK(0x3516, 1);
+    // 3516: bic *7f(sp), r2
+    {
+        a = RD16(r[6] + 127);
+        src = RD16(a);
+        dst = r[2];
+        val = (~src) & dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 351a: (undefined)
+    AOT_INTERP(0x351a);
+L3518:
+    AOT_BLOCK(0x3518, 1);
+    // 3518: jmp *355b
+    {
+        a = RD16(0x355b);
+    }
+    AOT_JUMP(a);
+L351c:
+    AOT_BLOCK(0x351c, 2);
+    // 351c: bic *57f(sp), *(sp)+
+    {
+        a = RD16(r[6] + 1407);
+        src = RD16(a);
+        b = RD16(r[6]);
+        r[6] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3520: bge 35a0
+    if (!(N ^ V))
+        AOT_GOTO(0x35a0, L35a0);
+    AOT_GOTO(0x3522, L3522);
+L3522:
+    AOT_BLOCK(0x3522, 1);
+    // 3522: bic *39a5, (r0)
+    {
+        a = RD16(0x39a5);
+        src = RD16(a);
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3526, L3526);
+L3526:
+    AOT_BLOCK(0x3526, 1);
+    // 3526: bge 35a6
+    if (!(N ^ V))
+        AOT_GOTO(0x35a6, L35a6);
+    AOT_GOTO(0x3528, L3528);
+L3528:
+    AOT_BLOCK(0x3528, 1);
+    // 3528: bic *352c, *-(sp)
+    {
+        a = RD16(0x352c);
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x352c, L352c);
+L352c:
+    // 352c: (undefined)
+    AOT_INTERP(0x352c);
+L352e:
+    AOT_BLOCK(0x352e, 1);
+    // 352e: br 3550
+    AOT_GOTO(0x3550, L3550);
+L3542:
+    AOT_BLOCK(0x3542, 1);
+    // 3542: bic *10(r4), (r2)+
+    {
+        a = RD16(r[4] + 16);
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3546: (undefined)
+    AOT_INTERP(0x3546);
+L3548:
+    AOT_BLOCK(0x3548, 2);
+    // 3548: bic *510(r4), *-(r4)
+    {
+        a = RD16(r[4] + 1296);
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 354c: bge 35cc
+    if (!(N ^ V))
+        AOT_GOTO(0x35cc, L35cc);
+    AOT_GOTO(0x354e, L354e);
+L354e:
+    AOT_BLOCK(0x354e, 1);
+    // 354e: bic *7f(r4), *-(r4)
+    {
+        a = RD16(r[4] + 127);
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3552: (undefined)
+    AOT_INTERP(0x3552);
+L3550:
+    AOT_BLOCK(0x3550, 1);
+    // 3550: jmp *3593
+    {
+        a = RD16(0x3593);
+    }
+    AOT_JUMP(a);
+L3554:
+    AOT_BLOCK(0x3554, 2);
+    // 3554: bic *57f(sp), *(sp)+
+    {
+        a = RD16(r[6] + 1407);
+        src = RD16(a);
+        b = RD16(r[6]);
+        r[6] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3558: bge 35d8
+    if (!(N ^ V))
+        AOT_GOTO(0x35d8, L35d8);
+    AOT_GOTO(0x355a, L355a);
+L355a:
+    AOT_BLOCK(0x355a, 2);
+    // 355a: bic *39dd, (r0)
+    {
+        a = RD16(0x39dd);
+        src = RD16(a);
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 355e: bge 35de
+    if (!(N ^ V))
+        AOT_GOTO(0x35de, L35de);
+    AOT_GOTO(0x3560, L3560);
+L3560:
+    AOT_BLOCK(0x3560, 1);
+    // 3560: bic *3564, *-(sp)
+    {
+        a = RD16(0x3564);
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3564, L3564);
+L3564:
+    // 3564: (undefined)
+    AOT_INTERP(0x3564);
+L3566:
+    AOT_BLOCK(0x3566, 1);
+    // 3566: br 3588
+    AOT_GOTO(0x3588, L3588);
+L3568:
+    AOT_BLOCK(0x3568, 1);
+    // 3568: bis r0, *(sp)+
+    {
+        src = r[0];
+        b = RD16(r[6]);
+        r[6] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 356a: (undefined)
+    AOT_INTERP(0x356a);
+L356c:
+    // 356c: (undefined)
+    AOT_INTERP(0x356c);
+L356e:
+    AOT_BLOCK(0x356e, 2);
+    // 356e: bis r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3570: jmp (r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+    }
+    AOT_JUMP(a);
+L3582:
+    AOT_BLOCK(0x3582, 1);
+    // 3582: blt 35a4
+    if (N ^ V)
+        AOT_GOTO(0x35a4, L35a4);
+    AOT_GOTO(0x3584, L3584);
+L3584:
+    AOT_BLOCK(0x3584, 1);
+    // 3584: bge 35ae
+    if (!(N ^ V))
+        AOT_GOTO(0x35ae, L35ae);
+    AOT_GOTO(0x3586, L3586);
+L3586:
+    AOT_BLOCK(0x3586, 1);
+    // 3586: bic *510(r4), (r2)+
+    {
+        a = RD16(r[4] + 1296);
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x358a, L358a);
+L3588:
+    AOT_BLOCK(0x3588, 1);
+    // 3588: blt 35aa
+    if (N ^ V)
+        AOT_GOTO(0x35aa, L35aa);
+    AOT_GOTO(0x358a, L358a);
+L358a:
+    AOT_BLOCK(0x358a, 1);
+    // 358a: bge 360a
+    if (!(N ^ V))
+        AOT_GOTO(0x360a, L360a);
+    AOT_GOTO(0x358c, L358c);
+L358c:
+    AOT_BLOCK(0x358c, 2);
+    // 358c: bic *410(r4), *-(r4)
+    {
+        a = RD16(r[4] + 1040);
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3590: bge 3610
+    if (!(N ^ V))
+        AOT_GOTO(0x3610, L3610);
+    AOT_GOTO(0x3592, L3592);
+L3592:
+    AOT_BLOCK(0x3592, 2);
+    // 3592: bic *57f(r5), (r2)
+    {
+        a = RD16(r[5] + 1407);
+        src = RD16(a);
+        b = r[2];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3596: bge 3616
+    if (!(N ^ V))
+        AOT_GOTO(0x3616, L3616);
+    AOT_GOTO(0x3598, L3598);
+L3598:
+    AOT_BLOCK(0x3598, 2);
+    // 3598: bic *3a1b, (r0)
+    {
+        a = RD16(0x3a1b);
+        src = RD16(a);
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 359c: bge 361c
+    if (!(N ^ V))
+        AOT_GOTO(0x361c, L361c);
+    AOT_GOTO(0x359e, L359e);
+L359e:
+    AOT_BLOCK(0x359e, 1);
+    // 359e: bic *35a2, *-(sp)
+    {
+        a = RD16(0x35a2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x35a2, L35a2);
+L35a0:
+    // 35a0: halt
+    AOT_INTERP(0x35a0);
+L35a2:
+    // 35a2: (undefined)
+    AOT_INTERP(0x35a2);
+L35a4:
+    AOT_BLOCK(0x35a4, 1);
+    // 35a4: br 35c6
+    AOT_GOTO(0x35c6, L35c6);
+L35a6:
+    AOT_BLOCK(0x35a6, 1);
+    // 35a6: bis r3, (r0)
+    {
+        src = r[3];
+        b = r[0];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 35a8: (undefined)
+    AOT_INTERP(0x35a8);
+L35aa:
+    // 35aa: (undefined)
+    AOT_INTERP(0x35aa);
+L35ac:
+    AOT_BLOCK(0x35ac, 1);
+    // 35ac: bis r3, *-(r0)
+    {
+        src = r[3];
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x35ae, L35ae);
+L35ae:
+    AOT_BLOCK(0x35ae, 1);
+    // 35ae: jmp (r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+    }
+    AOT_JUMP(a);
+L35bc:
+    AOT_BLOCK(0x35bc, 1);
+    // 35bc: br 35de
+    AOT_GOTO(0x35de, L35de);
+L35c6:
+    AOT_BLOCK(0x35c6, 2);
+    // 35c6: bis r5, *-(r4)
+    {
+        src = r[5];
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 35c8: jmp *360b
+    {
+        a = RD16(0x360b);
+    }
+    AOT_JUMP(a);
+L35cc:
+    AOT_BLOCK(0x35cc, 1);
+    // 35cc: bis sp, (sp)+
+    {
+        src = r[6];
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 35ce: halt
+    AOT_INTERP(0x35ce);
+L35d0:
+    // 35d0: (undefined)
+    AOT_INTERP(0x35d0);
+L35d2:
+    // 35d2: reset
+    AOT_INTERP(0x35d2);
+L35d4:
+    AOT_BLOCK(0x35d4, 2);
+    // 35d4: bis pc, (sp)
+    {
+        src = uint16_t(0x35d6);
+        b = r[6];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 35d6: jmp *35df
+    {
+        a = RD16(0x35df);
+    }
+    AOT_JUMP(a);
+L35d8:
+    // 35d8: reset
+    AOT_INTERP(0x35d8);
+L35da:
+    AOT_BLOCK(0x35da, 1);
+    // 35da: bis pc, *(sp)+
+    {
+        src = uint16_t(0x35dc);
+        b = RD16(r[6]);
+        r[6] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 35dc: halt
+    AOT_INTERP(0x35dc);
+L35de:
+    AOT_BLOCK(0x35de, 1);
+    // 35de: jsr r0, *36f2
+    {
+        a = RD16(0x36f2);
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x35e2;
+    }
+    AOT_JUMP(a);
+L35e2:
+    AOT_BLOCK(0x35e2, 2);
+    // 35e2: bic 83f(sp), -(r4)
+    {
+        a = uint16_t(r[6] + 2111);
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 35e6: br 3690
+    AOT_GOTO(0x3690, L3690);
+L35f0:
+    AOT_BLOCK(0x35f0, 1);
+    // 35f0: jsr r0, *3773
+    {
+        a = RD16(0x3773);
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x35f4;
+    }
+    AOT_JUMP(a);
+L35f4:
+    AOT_BLOCK(0x35f4, 1);
+    // 35f4: bic 3e37, (r0)
+    {
+        a = 0x3e37;
+        src = RD16(a);
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 35f8: (undefined)
+    AOT_INTERP(0x35f8);
+L35fa:
+    AOT_BLOCK(0x35fa, 1);
+    // 35fa: bic 35fe, *(r0)+
+    {
+        a = 0x35fe;
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x35fe, L35fe);
+L35fe:
+    AOT_BLOCK(0x35fe, 1);
+    // 35fe: br 3620
+    AOT_GOTO(0x3620, L3620);
+L360a:
+    // 360a: (undefined)
+    AOT_INTERP(0x360a);
+L360c:
+    // 360c: (undefined)
+    AOT_INTERP(0x360c);
+L360e:
+    AOT_BLOCK(0x360e, 1);
+    // 360e: bis (r0), (r0)+
+    {
+        a = r[0];
+        src = RD16(a);
+        b = r[0];
+        r[0] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3610, L3610);
+L3610:
+    // 3610: halt
+    AOT_INTERP(0x3610);
+L3612:
+    AOT_BLOCK(0x3612, 1);
+    // 3612: bge 3692
+    if (!(N ^ V))
+        AOT_GOTO(0x3692, L3692);
+    AOT_GOTO(0x3614, L3614);
+L3614:
+    // 3614: (undefined)
+    AOT_INTERP(0x3614);
+L3616:
+    AOT_BLOCK(0x3616, 1);
+    // 3616: bis (r0), *(r4)+
+    {
+        a = r[0];
+        src = RD16(a);
+        b = RD16(r[4]);
+        r[4] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3618: halt
+    AOT_INTERP(0x3618);
+L361a:
+    AOT_BLOCK(0x361a, 1);
+    // 361a: bge 369a
+    if (!(N ^ V))
+        AOT_GOTO(0x369a, L369a);
+    AOT_GOTO(0x361c, L361c);
+L361c:
+    // 361c: (undefined)
+    AOT_INTERP(0x361c);
+L361e:
+    AOT_BLOCK(0x361e, 1);
+    // 361e: bis (r0), *-(r0)
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3620, L3620);
+L3620:
+    // 3620: halt
+    AOT_INTERP(0x3620);
+L3622:
+    AOT_BLOCK(0x3622, 1);
+    // 3622: jsr r0, (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3624;
+    }
+    AOT_JUMP(a);
+L3624:
+    // 3624: (undefined)
+    AOT_INTERP(0x3624);
+L3626:
+    AOT_BLOCK(0x3626, 2);
+    // 3626: bis (r1), *(r2)+
+    {
+        a = r[1];
+        src = RD16(a);
+        b = RD16(r[2]);
+        r[2] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3628: jsr r1, *366b
+    {
+        a = RD16(0x366b);
+        r[6] -= 2;
+        WR16(r[6], r[1]);
+        r[1] = 0x362c;
+    }
+    AOT_JUMP(a);
+L362c:
+    AOT_BLOCK(0x362c, 2);
+    // 362c: bis (r1), *-(sp)
+    {
+        a = r[1];
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 362e: jsr r0, *3671
+    {
+        a = RD16(0x3671);
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3632;
+    }
+    AOT_JUMP(a);
+L3632:
+    AOT_BLOCK(0x3632, 1);
+    // 3632: bis (r2), (r0)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = r[0];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3634: halt
+    AOT_INTERP(0x3634);
+L3636:
+    // 3636: (undefined)
+    AOT_INTERP(0x3636);
+L3638:
+    // 3638: (undefined)
+    AOT_INTERP(0x3638);
+L363a:
+    AOT_BLOCK(0x363a, 1);
+    // 363a: bis (r2), -(r2)
+    {
+        a = r[2];
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 363c: halt
+    AOT_INTERP(0x363c);
+L363e:
+    AOT_BLOCK(0x363e, 1);
+    // 363e: jsr r0, (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3640;
+    }
+    AOT_JUMP(a);
+L3640:
+    // 3640: (undefined)
+    AOT_INTERP(0x3640);
+L3642:
+    AOT_BLOCK(0x3642, 2);
+    // 3642: bis (r2), *-(r4)
+    {
+        a = r[2];
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3644: jsr r1, *3687
+    {
+        a = RD16(0x3687);
+        r[6] -= 2;
+        WR16(r[6], r[1]);
+        r[1] = 0x3648;
+    }
+    AOT_JUMP(a);
+L3648:
+    AOT_BLOCK(0x3648, 1);
+    // 3648: bis (r2), 83f(sp)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = uint16_t(r[6] + 2111);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 364c: (undefined)
+    AOT_INTERP(0x364c);
+L364e:
+    AOT_BLOCK(0x364e, 1);
+    // 364e: bis (r3), sp
+    {
+        a = r[3];
+        src = RD16(a);
+        dst = r[6];
+        val = src | dst;
+        r[6] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3650: halt
+    AOT_INTERP(0x3650);
+L3652:
+    AOT_BLOCK(0x3652, 1);
+    // 3652: jsr r0, *3e95
+    {
+        a = RD16(0x3e95);
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3656;
+    }
+    AOT_JUMP(a);
+L3656:
+    AOT_BLOCK(0x3656, 1);
+    // 3656: bis (r3), (r2)+
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3658: halt
+    AOT_INTERP(0x3658);
+L365a:
+    // 365a: (undefined)
+    AOT_INTERP(0x365a);
+L365c:
+    AOT_BLOCK(0x365c, 1);
+    // 365c: jsr r0, *894a
+    {
+        a = RD16(0x894a);
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3660;
+    }
+    AOT_JUMP(a);
+L3660:
+    // 3660: halt
+    AOT_INTERP(0x3660);
+L3662:
+    // 3662: (undefined)
+    AOT_INTERP(0x3662);
+L3664:
+    // 3664: iot
+    AOT_INTERP(0x3664);
+L3666:
+    AOT_BLOCK(0x3666, 2);
+    // 3666: bis (r4), 510(r2)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = uint16_t(r[2] + 1296);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 366a: bge 3674
+    if (!(N ^ V))
+        AOT_GOTO(0x3674, L3674);
+    AOT_GOTO(0x366c, L366c);
+L366c:
+    AOT_BLOCK(0x366c, 1);
+    // 366c: bis (r4), 7f(r2)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = uint16_t(r[2] + 127);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3670: iot
+    AOT_INTERP(0x3670);
+L3672:
+    AOT_BLOCK(0x3672, 1);
+    // 3672: bis (r4), *57f(r0)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = RD16(r[0] + 1407);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3676, L3676);
+L3674:
+    AOT_BLOCK(0x3674, 1);
+    // 3674: blt 3774
+    if (N ^ V)
+        AOT_GOTO(0x3774, L3774);
+    AOT_GOTO(0x3676, L3676);
+L3676:
+    AOT_BLOCK(0x3676, 1);
+    // 3676: bge 3680
+    if (!(N ^ V))
+        AOT_GOTO(0x3680, L3680);
+    AOT_GOTO(0x3678, L3678);
+L3678:
+    AOT_BLOCK(0x3678, 2);
+    // 3678: bis (r4), *10(r0)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = RD16(r[0] + 16);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 367c: br 369e
+    AOT_GOTO(0x369e, L369e);
+L3680:
+    AOT_BLOCK(0x3680, 1);
+    // 3680: beq 36a2
+    if (Z)
+        AOT_GOTO(0x36a2, L36a2);
+    AOT_GOTO(0x3682, L3682);
+L3682:
+    // 3682: (undefined)
+    AOT_INTERP(0x3682);
+L3684:
+    AOT_BLOCK(0x3684, 2);
+    // 3684: bis (r5), r4
+    {
+        a = r[5];
+        src = RD16(a);
+        dst = r[4];
+        val = src | dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3686: beq 36a8
+    if (Z)
+        AOT_GOTO(0x36a8, L36a8);
+    AOT_GOTO(0x3688, L3688);
+L3688:
+    AOT_BLOCK(0x3688, 1);
+    // 3688: jmp *89d8
+    {
+        a = RD16(0x89d8);
+    }
+    AOT_JUMP(a);
+L3690:
+    AOT_BLOCK(0x3690, 1);
+    // 3690: bis (r5), (r4)
+    {
+        a = r[5];
+        src = RD16(a);
+        b = r[4];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3692, L3692);
+L3692:
+    // 3692: (undefined)
+    AOT_INTERP(0x3692);
+L3694:
+    // 3694: (undefined)
+    AOT_INTERP(0x3694);
+L3696:
+    AOT_BLOCK(0x3696, 2);
+    // 3696: bis (r5), *(r0)+
+    {
+        a = r[5];
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3698: jmp *37ac
+    {
+        a = RD16(0x37ac);
+    }
+    AOT_JUMP(a);
+L369a:
+    AOT_BLOCK(0x369a, 1);
+    // 369a: br 36bc
+    AOT_GOTO(0x36bc, L36bc);
+L369e:
+    AOT_BLOCK(0x369e, 1);
+    // 369e: beq 379e
+    if (Z)
+        AOT_GOTO(0x379e, L379e);
+    AOT_GOTO(0x36a0, L36a0);
+L36a0:
+    // 36a0: (undefined)
+    AOT_INTERP(0x36a0);
+L36a2:
+    AOT_BLOCK(0x36a2, 2);
+    // 36a2: bis (r5), -(r2)
+    {
+        a = r[5];
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 36a4: jmp *37fc
+    {
+        a = RD16(0x37fc);
+    }
+    AOT_JUMP(a);
+L36a8:
+    AOT_BLOCK(0x36a8, 2);
+    // 36a8: bis (r5), *-(sp)
+    {
+        a = r[5];
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 36aa: beq 37aa
+    if (Z)
+        AOT_GOTO(0x37aa, L37aa);
+    AOT_GOTO(0x36ac, L36ac);
+L36ac:
+    AOT_BLOCK(0x36ac, 1);
+    // 36ac: jmp (r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+    }
+    AOT_JUMP(a);
+L36bc:
+    AOT_BLOCK(0x36bc, 1);
+    // 36bc: beq 3766
+    if (Z)
+        AOT_GOTO(0x3766, L3766);
+    AOT_GOTO(0x36be, L36be);
+L36be:
+    AOT_BLOCK(0x36be, 1);
+    // 36be: jmp *8a50
+    {
+        a = RD16(0x8a50);
+    }
+    AOT_JUMP(a);
+L3736:
+    // 3736: (undefined)
+    AOT_INTERP(0x3736);
+L3738:
+    // 3738: (undefined)
+    AOT_INTERP(0x3738);
+L373a:
+    AOT_BLOCK(0x373a, 1);
+    // 373a: bis (r5), r4
+    {
+        a = r[5];
+        src = RD16(a);
+        dst = r[4];
+        val = src | dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 373c: (undefined)
+    AOT_INTERP(0x373c);
+L373e:
+    // 373e: (undefined)
+    AOT_INTERP(0x373e);
+L3740:
+    AOT_BLOCK(0x3740, 2);
+    // 3740: bis (r5), *(r0)+
+    {
+        a = r[5];
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3742: jmp *3756
+    {
+        a = RD16(0x3756);
+    }
+    AOT_JUMP(a);
+L3766:
+    AOT_BLOCK(0x3766, 1);
+    // 3766: jmp *37a9
+    {
+        a = RD16(0x37a9);
+    }
+    AOT_JUMP(a);
+L3774:
+    AOT_BLOCK(0x3774, 1);
+    // 3774: jsr r0, (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3776;
+    }
+    AOT_JUMP(a);
+L3776:
+    AOT_BLOCK(0x3776, 2);
+    // 3776: bis (r1)+, (r2)
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        b = r[2];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3778: jsr r0, (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x377a;
+    }
+    AOT_JUMP(a);
+L377a:
+    AOT_BLOCK(0x377a, 1);
+    // 377a: jsr r1, *8bd8
+    {
+        a = RD16(0x8bd8);
+        r[6] -= 2;
+        WR16(r[6], r[1]);
+        r[1] = 0x377e;
+    }
+    AOT_JUMP(a);
+L377e:
+    AOT_BLOCK(0x377e, 1);
+    // 377e: jsr r0, (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3780;
+    }
+    AOT_JUMP(a);
+L3780:
+    AOT_BLOCK(0x3780, 1);
+    // 3780: jsr r0, *8c0c
+    {
+        a = RD16(0x8c0c);
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3784;
+    }
+    AOT_JUMP(a);
+L3784:
+    AOT_BLOCK(0x3784, 1);
+    // 3784: jsr r1, *3790
+    {
+        a = RD16(0x3790);
+        r[6] -= 2;
+        WR16(r[6], r[1]);
+        r[1] = 0x3788;
+    }
+    AOT_JUMP(a);
+L3788:
+    AOT_BLOCK(0x3788, 2);
+    // 3788: bis (r1)+, 854(r4)
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        b = uint16_t(r[4] + 2132);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 378c: jsr r0, *8c42
+    {
+        a = RD16(0x8c42);
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3790;
+    }
+    AOT_JUMP(a);
+L3790:
+    AOT_BLOCK(0x3790, 1);
+    // 3790: jsr r1, *3fd3
+    {
+        a = RD16(0x3fd3);
+        r[6] -= 2;
+        WR16(r[6], r[1]);
+        r[1] = 0x3794;
+    }
+    AOT_JUMP(a);
+L3794:
+    AOT_BLOCK(0x3794, 1);
+    // 3794: bis (r3)+, *-(sp)
+    {
+        a = r[3];
+        r[3] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3796: halt
+    AOT_INTERP(0x3796);
+L3798:
+    AOT_BLOCK(0x3798, 1);
+    // 3798: jmp *37a0
+    {
+        a = RD16(0x37a0);
+    }
+    AOT_JUMP(a);
+L379e:
+    // 379e: (undefined)
+    AOT_INTERP(0x379e);
+L37a0:
+    // 37a0: iot
+    AOT_INTERP(0x37a0);
+L37a2:
+    AOT_BLOCK(0x37a2, 1);
+    // 37a2: bis (r4)+, (r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 37a4: (undefined)
+    AOT_INTERP(0x37a4);
+L37a6:
+    // 37a6: reset
+    AOT_INTERP(0x37a6);
+L37a8:
+    AOT_BLOCK(0x37a8, 1);
+    // 37a8: bis (r4)+, (sp)+
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x37aa, L37aa);
+L37aa:
+    AOT_BLOCK(0x37aa, 1);
+    // 37aa: br 37cc
+    AOT_GOTO(0x37cc, L37cc);
+L37cc:
+    AOT_BLOCK(0x37cc, 1);
+    // 37cc: bis (r4)+, *(r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = RD16(r[4]);
+        r[4] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 37ce: (undefined)
+    AOT_INTERP(0x37ce);
+L37d0:
+    // 37d0: (undefined)
+    AOT_INTERP(0x37d0);
+L37d2:
+    AOT_BLOCK(0x37d2, 1);
+    // 37d2: bis (r4)+, *154(r0)
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = RD16(r[0] + 340);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 37d6: (undefined)
+    AOT_INTERP(0x37d6);
+L37d8:
+    AOT_BLOCK(0x37d8, 2);
+    // 37d8: bis (sp), -(r0)
+    {
+        a = r[6];
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 37da: br 38da
+    AOT_GOTO(0x38da, L38da);
+L3812:
+    // 3812: (undefined)
+    AOT_INTERP(0x3812);
+L3814:
+    // 3814: reset
+    AOT_INTERP(0x3814);
+L3816:
+    AOT_BLOCK(0x3816, 1);
+    // 3816: bis (r5)+, 7f(sp)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        b = uint16_t(r[6] + 127);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 381a: reset
+    AOT_INTERP(0x381a);
+L381c:
+    AOT_BLOCK(0x381c, 1);
+    // 381c: bis (r5)+, *0(sp)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        b = RD16(r[6] + 0);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3820, L3820);
+L3820:
+    // 3820: (undefined)
+    AOT_INTERP(0x3820);
+L3822:
+    // 3822: reset
+    AOT_INTERP(0x3822);
+L3824:
+    AOT_BLOCK(0x3824, 2);
+    // 3824: bis (sp)+, (r2)
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[2];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3826: jmp *382f
+    {
+        a = RD16(0x382f);
+    }
+    AOT_JUMP(a);
+L3840:
+    AOT_BLOCK(0x3840, 1);
+    // 3840: jsr r0, (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x3842;
+    }
+    AOT_JUMP(a);
+L3842:
+    AOT_BLOCK(0x3842, 1);
+    // 3842: br 3864
+    AOT_GOTO(0x3864, L3864);
+L3864:
+    AOT_BLOCK(0x3864, 2);
+    // 3864: bis *(r3)+, r0
+    {
+        a = RD16(r[3]);
+        r[3] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3866: jmp *386e
+    {
+        a = RD16(0x386e);
+    }
+    AOT_JUMP(a);
+L3880:
+    AOT_BLOCK(0x3880, 1);
+    // 3880: bge 388a
+    if (!(N ^ V))
+        AOT_GOTO(0x388a, L388a);
+    AOT_GOTO(0x3882, L3882);
+L3882:
+    AOT_BLOCK(0x3882, 2);
+    // 3882: bis *(r3)+, *(r2)+
+    {
+        a = RD16(r[3]);
+        r[3] += 2;
+        src = RD16(a);
+        b = RD16(r[2]);
+        r[2] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3884: br 38a6
+    AOT_GOTO(0x38a6, L38a6);
+L388a:
+    AOT_BLOCK(0x388a, 1);
+    // 388a: beq 38ac
+    if (Z)
+        AOT_GOTO(0x38ac, L38ac);
+    AOT_GOTO(0x388c, L388c);
+L388c:
+    AOT_BLOCK(0x388c, 1);
+    // 388c: beq 38ae
+    if (Z)
+        AOT_GOTO(0x38ae, L38ae);
+    AOT_GOTO(0x388e, L388e);
+L388e:
+    AOT_BLOCK(0x388e, 1);
+    // 388e: bis (r5), r4
+    {
+        a = r[5];
+        src = RD16(a);
+        dst = r[4];
+        val = src | dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3890, L3890);
+L3890:
+    AOT_BLOCK(0x3890, 1);
+    // 3890: br 3990
+    AOT_GOTO(0x3990, L3990);
+L38a6:
+    AOT_BLOCK(0x38a6, 2);
+    // 38a6: bic 17f(sp), -(r4)
+    {
+        a = uint16_t(r[6] + 383);
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 38aa: br 3954
+    AOT_GOTO(0x3954, L3954);
+L38ac:
+    AOT_BLOCK(0x38ac, 1);
+    // 38ac: bis (r5), *-(sp)
+    {
+        a = r[5];
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x38ae, L38ae);
+L38ae:
+    AOT_BLOCK(0x38ae, 1);
+    // 38ae: beq 39ae
+    if (Z)
+        AOT_GOTO(0x39ae, L39ae);
+    AOT_GOTO(0x38b0, L38b0);
+L38b0:
+    AOT_BLOCK(0x38b0, 1);
+    // 38b0: beq 395a
+    if (Z)
+        AOT_GOTO(0x395a, L395a);
+    AOT_GOTO(0x38b2, L38b2);
+L38b2:
+    AOT_BLOCK(0x38b2, 2);
+    // 38b2: bis (r5), *-(sp)
+    {
+        a = r[5];
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 38b4: br 39b4
+    AOT_GOTO(0x39b4, L39b4);
+L38da:
+    AOT_BLOCK(0x38da, 1);
+    // 38da: beq 39da
+    if (Z)
+        AOT_GOTO(0x39da, L39da);
+    AOT_GOTO(0x38dc, L38dc);
+L38dc:
+    AOT_BLOCK(0x38dc, 2);
+    // 38dc: bis (sp), *-(sp)
+    {
+        a = r[6];
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 38de: br 39de
+    AOT_GOTO(0x39de, L39de);
+L38f2:
+    // 38f2: (undefined)
+    AOT_INTERP(0x38f2);
+L38f4:
+    // 38f4: (undefined)
+    AOT_INTERP(0x38f4);
+L38f6:
+    AOT_BLOCK(0x38f6, 2);
+    // 38f6: bis (r5), r4
+    {
+        a = r[5];
+        src = RD16(a);
+        dst = r[4];
+        val = src | dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 38f8: jmp *390c
+    {
+        a = RD16(0x390c);
+    }
+    AOT_JUMP(a);
+L3912:
+    // 3912: (undefined)
+    AOT_INTERP(0x3912);
+L3914:
+    // 3914: (undefined)
+    AOT_INTERP(0x3914);
+L3916:
+    AOT_BLOCK(0x3916, 2);
+    // 3916: bis *(r3)+, *(sp)+
+    {
+        a = RD16(r[3]);
+        r[3] += 2;
+        src = RD16(a);
+        b = RD16(r[6]);
+        r[6] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3918: bge 3998
+    if (!(N ^ V))
+        AOT_GOTO(0x3998, L3998);
+    AOT_GOTO(0x391a, L391a);
+L391a:
+    AOT_BLOCK(0x391a, 1);
+    // 391a: bge 399a
+    if (!(N ^ V))
+        AOT_GOTO(0x399a, L399a);
+    AOT_GOTO(0x391c, L391c);
+L391c:
+    AOT_BLOCK(0x391c, 1);
+    // 391c: bis *(r3)+, *(sp)+
+    {
+        a = RD16(r[3]);
+        r[3] += 2;
+        src = RD16(a);
+        b = RD16(r[6]);
+        r[6] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 391e: halt
+    AOT_INTERP(0x391e);
+L3920:
+    // 3920: iot
+    AOT_INTERP(0x3920);
+L3922:
+    // 3922: (undefined)
+    AOT_INTERP(0x3922);
+L3924:
+    AOT_BLOCK(0x3924, 2);
+    // 3924: bis *(r4)+, r0
+    {
+        a = RD16(r[4]);
+        r[4] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3926: bge 3930
+    if (!(N ^ V))
+        AOT_GOTO(0x3930, L3930);
+    AOT_GOTO(0x3928, L3928);
+L3928:
+    // 3928: (undefined)
+    AOT_INTERP(0x3928);
+L392a:
+    AOT_BLOCK(0x392a, 2);
+    // 392a: bis *(r4)+, r0
+    {
+        a = RD16(r[4]);
+        r[4] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 392c: br 394e
+    AOT_GOTO(0x394e, L394e);
+L3930:
+    AOT_BLOCK(0x3930, 2);
+    // 3930: bis *(r4)+, (r4)
+    {
+        a = RD16(r[4]);
+        r[4] += 2;
+        src = RD16(a);
+        b = r[4];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3932: br 3a32
+    AOT_GOTO(0x3a32, L3a32);
+L3940:
+    // 3940: (undefined)
+    AOT_INTERP(0x3940);
+L3942:
+    // 3942: reset
+    AOT_INTERP(0x3942);
+L3944:
+    AOT_BLOCK(0x3944, 1);
+    // 3944: bis *(r5)+, r2
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3946: (undefined)
+    AOT_INTERP(0x3946);
+L3948:
+    AOT_BLOCK(0x3948, 1);
+    // 3948: br 396a
+    AOT_GOTO(0x396a, L396a);
+L394e:
+    AOT_BLOCK(0x394e, 1);
+    // 394e: br 3a4e
+    AOT_GOTO(0x3a4e, L3a4e);
+L3954:
+    // 3954: (undefined)
+    AOT_INTERP(0x3954);
+L3956:
+    AOT_BLOCK(0x3956, 1);
+    // 3956: bis *(r5)+, *-(r0)
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3958: halt
+    AOT_INTERP(0x3958);
+L395a:
+    // 395a: (undefined)
+    AOT_INTERP(0x395a);
+L395c:
+    // 395c: (undefined)
+    AOT_INTERP(0x395c);
+L395e:
+    AOT_BLOCK(0x395e, 1);
+    // 395e: bis *(r5)+, 0(sp)
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        b = uint16_t(r[6] + 0);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3962, L3962);
+L3962:
+    AOT_BLOCK(0x3962, 1);
+    // 3962: bge 39e2
+    if (!(N ^ V))
+        AOT_GOTO(0x39e2, L39e2);
+    AOT_GOTO(0x3964, L3964);
+L3964:
+    // 3964: (undefined)
+    AOT_INTERP(0x3964);
+L3966:
+    AOT_BLOCK(0x3966, 1);
+    // 3966: bis *(sp)+, r2
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 3968: halt
+    AOT_INTERP(0x3968);
+L396a:
+    AOT_BLOCK(0x396a, 6);
+    // 396a: jsr r5, 3c72
+    {
+        a = 0x3c72;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x396e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 396e: sub $7e, sp
+    {
+        src = uint16_t(0x007e);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 3972: mov 4(r5), 5dfc
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x5dfc;
+        WR16(b, src);
+    }
+    // 3978: mov r5, r4
+    {
+        src = r[5];
+        r[4] = src;
+    }
+    // 397a: add $6, r4
+    {
+        src = uint16_t(0x0006);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x397e, L397e);
+L397e:
+    AOT_BLOCK(0x397e, 2);
+    // 397e: movb *5dfc, r0
+    {
+        a = RD16(0x5dfc);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 3982: beq 3996
+    if (Z)
+        AOT_GOTO(0x3996, L3996);
+    AOT_GOTO(0x3984, L3984);
+L3984:
+    AOT_BLOCK(0x3984, 3);
+    // 3984: inc 5dfc
+    {
+        a = 0x5dfc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 3988: cmp r0, $25
+    {
+        src = r[0];
+        dst = uint16_t(0x0025);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 398c: beq 399a
+    if (Z)
+        AOT_GOTO(0x399a, L399a);
+    AOT_GOTO(0x398e, L398e);
+L398e:
+    AOT_BLOCK(0x398e, 1);
+    // 398e: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3990, L3990);
+L3990:
+    AOT_BLOCK(0x3990, 1);
+    // 3990: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x3994);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L3994:
+    AOT_BLOCK(0x3994, 1);
+    // 3994: br 397e
+    AOT_GOTO(0x397e, L397e);
+L3996:
+    AOT_BLOCK(0x3996, 2);
+    // 3996: jmp 3c80
+    {
+        a = 0x3c80;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3998:
+    AOT_BLOCK(0x3998, 1);
+    // 3998: bne 3966
+    if (!Z)
+        AOT_GOTO(0x3966, L3966);
+    AOT_GOTO(0x399a, L399a);
+L399a:
+    AOT_BLOCK(0x399a, 4);
+    // 399a: clr 5dfe
+    {
+        a = 0x5dfe;
+        WR16(a, 0);
+    }
+    // 399e: clr 5e02
+    {
+        a = 0x5e02;
+        WR16(a, 0);
+    }
+    // 39a2: cmpb *5dfc, $2d
+    {
+        a = RD16(0x5dfc);
+        src = RD8(a);
+        dst = uint8_t(0x2d);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 39a8: bne 39b2
+    if (!Z)
+        AOT_GOTO(0x39b2, L39b2);
+    AOT_GOTO(0x39aa, L39aa);
+L39aa:
+    AOT_BLOCK(0x39aa, 1);
+    // 39aa: inc 5dfc
+    {
+        a = 0x5dfc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x39ae, L39ae);
+L39ae:
+    AOT_BLOCK(0x39ae, 1);
+    // 39ae: inc 5dfe
+    {
+        a = 0x5dfe;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x39b2, L39b2);
+L39b2:
+    AOT_BLOCK(0x39b2, 1);
+    // 39b2: jsr r3, 3ade
+    {
+        a = 0x3ade;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x39b6;
+    }
+    AOT_GOTO(0x3ade, L3ade);
+L39b4:
+    AOT_BLOCK(0x39b4, 1);
+    // 39b4: br 3a06
+    AOT_GOTO(0x3a06, L3a06);
+L39b6:
+    AOT_BLOCK(0x39b6, 4);
+    // 39b6: mov r1, 5dfa
+    {
+        src = r[1];
+        b = 0x5dfa;
+        WR16(b, src);
+    }
+    // 39ba: clr 5e00
+    {
+        a = 0x5e00;
+        WR16(a, 0);
+    }
+    // 39be: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 39c2: bne 39cc
+    if (!Z)
+        AOT_GOTO(0x39cc, L39cc);
+    AOT_GOTO(0x39c4, L39c4);
+L39c4:
+    AOT_BLOCK(0x39c4, 1);
+    // 39c4: jsr r3, 3ade
+    {
+        a = 0x3ade;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x39c8;
+    }
+    AOT_GOTO(0x3ade, L3ade);
+L39c8:
+    AOT_BLOCK(0x39c8, 1);
+    // 39c8: mov r1, 5e02
+    {
+        src = r[1];
+        b = 0x5e02;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x39cc, L39cc);
+L39cc:
+    AOT_BLOCK(0x39cc, 3);
+    // 39cc: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 39ce: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 39d2: mov $579c, r1
+    {
+        src = uint16_t(0x579c);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x39d6, L39d6);
+L39d6:
+    AOT_BLOCK(0x39d6, 2);
+    // 39d6: mov (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 39d8: beq 398e
+    if (Z)
+        AOT_GOTO(0x398e, L398e);
+    AOT_GOTO(0x39da, L39da);
+L39da:
+    AOT_BLOCK(0x39da, 2);
+    // 39da: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 39dc: bne 39d6
+    if (!Z)
+        AOT_GOTO(0x39d6, L39d6);
+    AOT_GOTO(0x39de, L39de);
+L39de:
+    AOT_BLOCK(0x39de, 1);
+    // 39de: jmp (r2)
+    {
+        a = r[2];
+    }
+    AOT_JUMP(a);
+L39e0:
+    AOT_BLOCK(0x39e0, 1);
+    // 39e0: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x39e2, L39e2);
+L39e2:
+    AOT_BLOCK(0x39e2, 1);
+    // 39e2: bge 39ee
+    if (!(N ^ V))
+        AOT_GOTO(0x39ee, L39ee);
+    AOT_GOTO(0x39e4, L39e4);
+L39e4:
+    AOT_BLOCK(0x39e4, 3);
+    // 39e4: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 39e6: movb $2d, (r3)+
+    {
+        src = uint8_t(0x2d);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 39ea: br 39ee
+    AOT_GOTO(0x39ee, L39ee);
+L39ec:
+    AOT_BLOCK(0x39ec, 1);
+    // 39ec: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x39ee, L39ee);
+L39ee:
+    AOT_BLOCK(0x39ee, 1);
+    // 39ee: jsr pc, 39f4
+    {
+        a = 0x39f4;
+        r[6] -= 2;
+        WR16(r[6], 0x39f2);
+    }
+    AOT_GOTO(0x39f4, L39f4);
+L39f2:
+    AOT_BLOCK(0x39f2, 1);
+    // 39f2: br 3a98
+    AOT_GOTO(0x3a98, L3a98);
+L39f4:
+    AOT_BLOCK(0x39f4, 5);
+    // 39f4: clr r0
+    {
+        r[0] = 0;
+    }
+    // 39f6: div $a, r0
+    {
+        src = int16_t(uint16_t(0x000a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 39fa: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 39fc: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 39fe: beq 3a04
+    if (Z)
+        AOT_GOTO(0x3a04, L3a04);
+    AOT_GOTO(0x3a00, L3a00);
+L3a00:
+    AOT_BLOCK(0x3a00, 1);
+    // 3a00: jsr pc, 39f4
+    {
+        a = 0x39f4;
+        r[6] -= 2;
+        WR16(r[6], 0x3a04);
+    }
+    AOT_GOTO(0x39f4, L39f4);
+L3a04:
+    AOT_BLOCK(0x3a04, 1);
+    // 3a04: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3a06, L3a06);
+L3a06:
+    AOT_BLOCK(0x3a06, 3);
+    // 3a06: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 3a0a: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 3a0c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3a0e:
+    AOT_BLOCK(0x3a0e, 2);
+    // 3a0e: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 3a10: bne 3a14
+    if (!Z)
+        AOT_GOTO(0x3a14, L3a14);
+    AOT_GOTO(0x3a12, L3a12);
+L3a12:
+    AOT_BLOCK(0x3a12, 1);
+    // 3a12: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x3a14, L3a14);
+L3a14:
+    AOT_BLOCK(0x3a14, 2);
+    // 3a14: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 3a16: bne 3a98
+    if (!Z)
+        AOT_GOTO(0x3a98, L3a98);
+    AOT_GOTO(0x3a18, L3a18);
+L3a18:
+    AOT_BLOCK(0x3a18, 2);
+    // 3a18: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 3a1a: br 3a98
+    AOT_GOTO(0x3a98, L3a98);
+L3a1c:
+    AOT_BLOCK(0x3a1c, 3);
+    // 3a1c: mov 5e02, r1
+    {
+        a = 0x5e02;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 3a20: clr r3
+    {
+        r[3] = 0;
+        C = false;
+    }
+    // 3a22: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3a24, L3a24);
+L3a24:
+    AOT_BLOCK(0x3a24, 2);
+    // 3a24: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3a26: beq 3a2c
+    if (Z)
+        AOT_GOTO(0x3a2c, L3a2c);
+    AOT_GOTO(0x3a28, L3a28);
+L3a28:
+    AOT_BLOCK(0x3a28, 2);
+    // 3a28: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 3a2a: sob r1, 4
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x3a24, L3a24);
+    AOT_GOTO(0x3a2c, L3a2c);
+L3a2c:
+    AOT_BLOCK(0x3a2c, 2);
+    // 3a2c: mov (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3a2e: br 3aa0
+    AOT_GOTO(0x3aa0, L3aa0);
+L3a30:
+    AOT_BLOCK(0x3a30, 2);
+    // 3a30: mov $57c4, r2
+    {
+        src = uint16_t(0x57c4);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3a34: br 3a3a
+    AOT_GOTO(0x3a3a, L3a3a);
+L3a32:
+    AOT_BLOCK(0x3a32, 1);
+    // 3a32: bis *$0102, r4
+    {
+        a = 0x0102;
+        src = RD16(a);
+        dst = r[4];
+        val = src | dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3a36, L3a36);
+L3a36:
+    AOT_BLOCK(0x3a36, 1);
+    // 3a36: mov $57c8, r2
+    {
+        src = uint16_t(0x57c8);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3a3a, L3a3a);
+L3a3a:
+    AOT_BLOCK(0x3a3a, 2);
+    // 3a3a: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3a3c: beq 3a48
+    if (Z)
+        AOT_GOTO(0x3a48, L3a48);
+    AOT_GOTO(0x3a3e, L3a3e);
+L3a3e:
+    AOT_BLOCK(0x3a3e, 2);
+    // 3a3e: tst 5e02
+    {
+        a = 0x5e02;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3a42: beq 3a48
+    if (Z)
+        AOT_GOTO(0x3a48, L3a48);
+    AOT_GOTO(0x3a44, L3a44);
+L3a44:
+    AOT_BLOCK(0x3a44, 1);
+    // 3a44: movb $30, (r3)+
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3a48, L3a48);
+L3a48:
+    AOT_BLOCK(0x3a48, 2);
+    // 3a48: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 3a4a: jsr pc, 3a50
+    {
+        a = 0x3a50;
+        r[6] -= 2;
+        WR16(r[6], 0x3a4e);
+    }
+    AOT_GOTO(0x3a50, L3a50);
+L3a4e:
+    AOT_BLOCK(0x3a4e, 1);
+    // 3a4e: br 3a98
+    AOT_GOTO(0x3a98, L3a98);
+L3a50:
+    AOT_BLOCK(0x3a50, 3);
+    // 3a50: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3a52: ashc (r2), r0
+    {
+        a = r[2];
+        src = RD16(a) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 3a54: beq 3a5a
+    if (Z)
+        AOT_GOTO(0x3a5a, L3a5a);
+    AOT_GOTO(0x3a56, L3a56);
+L3a56:
+    AOT_BLOCK(0x3a56, 1);
+    // 3a56: jsr pc, 3a50
+    {
+        a = 0x3a50;
+        r[6] -= 2;
+        WR16(r[6], 0x3a5a);
+    }
+    AOT_GOTO(0x3a50, L3a50);
+L3a5a:
+    AOT_BLOCK(0x3a5a, 3);
+    // 3a5a: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3a5c: bic 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 3a60: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x3a64, L3a64);
+L3a64:
+    AOT_BLOCK(0x3a64, 2);
+    // 3a64: cmp r0, $39
+    {
+        src = r[0];
+        dst = uint16_t(0x0039);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3a68: ble 3a6e
+    if (Z || (N ^ V))
+        AOT_GOTO(0x3a6e, L3a6e);
+    AOT_GOTO(0x3a6a, L3a6a);
+L3a6a:
+    AOT_BLOCK(0x3a6a, 1);
+    // 3a6a: add $7, r0
+    {
+        src = uint16_t(0x0007);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x3a6e, L3a6e);
+L3a6e:
+    AOT_BLOCK(0x3a6e, 1);
+    // 3a6e: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3a70, L3a70);
+L3a70:
+    AOT_BLOCK(0x3a70, 1);
+    // 3a70: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3a72:
+    AOT_BLOCK(0x3a72, 3);
+    // 3a72: mov 5e02, r0
+    {
+        a = 0x5e02;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3a76: mov 5e00, r2
+    {
+        a = 0x5e00;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3a7a: jsr pc, 3b12
+    {
+        a = 0x3b12;
+        r[6] -= 2;
+        WR16(r[6], 0x3a7e);
+    }
+    AOT_GOTO(0x3b12, L3b12);
+L3a7e:
+    AOT_BLOCK(0x3a7e, 1);
+    // 3a7e: br 3a98
+    AOT_GOTO(0x3a98, L3a98);
+L3a80:
+    AOT_BLOCK(0x3a80, 3);
+    // 3a80: mov 5e02, r0
+    {
+        a = 0x5e02;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3a84: mov 5e00, r2
+    {
+        a = 0x5e00;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3a88: jsr pc, 3b12
+    {
+        a = 0x3b12;
+        r[6] -= 2;
+        WR16(r[6], 0x3a8c);
+    }
+    AOT_GOTO(0x3b12, L3b12);
+L3a8c:
+    AOT_BLOCK(0x3a8c, 1);
+    // 3a8c: br 3a98
+    AOT_GOTO(0x3a98, L3a98);
+L3a8e:
+    AOT_BLOCK(0x3a8e, 3);
+    // 3a8e: mov (r4)+, r4
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 3a90: mov (r4)+, 5dfc
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = 0x5dfc;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3a94: jmp 397e
+    {
+        a = 0x397e;
+    }
+    AOT_GOTO(0x397e, L397e);
+L3a98:
+    AOT_BLOCK(0x3a98, 3);
+    // 3a98: mov sp, r2
+    {
+        src = r[6];
+        r[2] = src;
+    }
+    // 3a9a: add $4, r2
+    {
+        src = uint16_t(0x0004);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 3a9e: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x3aa0, L3aa0);
+L3aa0:
+    AOT_BLOCK(0x3aa0, 6);
+    // 3aa0: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3aa2: mov $20, -(sp)
+    {
+        src = uint16_t(0x0020);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3aa6: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+    }
+    // 3aa8: neg r3
+    {
+        val = -int16_t(r[3]);
+        r[3] = val;
+    }
+    // 3aaa: add 5dfa, r3
+    {
+        a = 0x5dfa;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 3aae: ble 3abc
+    if (Z || (N ^ V))
+        AOT_GOTO(0x3abc, L3abc);
+    AOT_GOTO(0x3ab0, L3ab0);
+L3ab0:
+    AOT_BLOCK(0x3ab0, 2);
+    // 3ab0: tst 5dfe
+    {
+        a = 0x5dfe;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3ab4: bne 3abc
+    if (!Z)
+        AOT_GOTO(0x3abc, L3abc);
+    AOT_GOTO(0x3ab6, L3ab6);
+L3ab6:
+    AOT_BLOCK(0x3ab6, 1);
+    // 3ab6: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x3aba);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L3aba:
+    AOT_BLOCK(0x3aba, 1);
+    // 3aba: sob r3, 3
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x3ab6, L3ab6);
+    AOT_GOTO(0x3abc, L3abc);
+L3abc:
+    AOT_BLOCK(0x3abc, 2);
+    // 3abc: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3abe: beq 3ac8
+    if (Z)
+        AOT_GOTO(0x3ac8, L3ac8);
+    AOT_GOTO(0x3ac0, L3ac0);
+L3ac0:
+    AOT_BLOCK(0x3ac0, 2);
+    // 3ac0: movb (r2)+, (sp)
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[6];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 3ac2: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x3ac6);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L3ac6:
+    AOT_BLOCK(0x3ac6, 1);
+    // 3ac6: sob r4, 4
+    {
+        r[4]--;
+    }
+    if (r[4] != 0)
+        AOT_GOTO(0x3ac0, L3ac0);
+    AOT_GOTO(0x3ac8, L3ac8);
+L3ac8:
+    AOT_BLOCK(0x3ac8, 2);
+    // 3ac8: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3aca: ble 3ad6
+    if (Z || (N ^ V))
+        AOT_GOTO(0x3ad6, L3ad6);
+    AOT_GOTO(0x3acc, L3acc);
+L3acc:
+    AOT_BLOCK(0x3acc, 1);
+    // 3acc: mov $20, (sp)
+    {
+        src = uint16_t(0x0020);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3ad0, L3ad0);
+L3ad0:
+    AOT_BLOCK(0x3ad0, 1);
+    // 3ad0: jsr pc, *$3b1c
+    {
+        a = 0x3b1c;
+        r[6] -= 2;
+        WR16(r[6], 0x3ad4);
+    }
+    AOT_GOTO(0x3b1c, L3b1c);
+L3ad4:
+    AOT_BLOCK(0x3ad4, 1);
+    // 3ad4: sob r3, 3
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x3ad0, L3ad0);
+    AOT_GOTO(0x3ad6, L3ad6);
+L3ad6:
+    AOT_BLOCK(0x3ad6, 3);
+    // 3ad6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 3ad8: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3ada: jmp 397e
+    {
+        a = 0x397e;
+    }
+    AOT_GOTO(0x397e, L397e);
+L3ade:
+    AOT_BLOCK(0x3ade, 2);
+    // 3ade: clr 5e00
+    {
+        a = 0x5e00;
+        WR16(a, 0);
+    }
+    // 3ae2: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x3ae4, L3ae4);
+L3ae4:
+    AOT_BLOCK(0x3ae4, 5);
+    // 3ae4: movb *5dfc, r0
+    {
+        a = RD16(0x5dfc);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 3ae8: inc 5dfc
+    {
+        a = 0x5dfc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 3aec: sub $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 3af0: cmp r0, $fffa
+    {
+        src = r[0];
+        dst = uint16_t(0xfffa);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3af4: bne 3afa
+    if (!Z)
+        AOT_GOTO(0x3afa, L3afa);
+    AOT_GOTO(0x3af6, L3af6);
+L3af6:
+    AOT_BLOCK(0x3af6, 2);
+    // 3af6: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3af8: br 3b00
+    AOT_GOTO(0x3b00, L3b00);
+L3afa:
+    AOT_BLOCK(0x3afa, 2);
+    // 3afa: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3afe: bhi 3b0c
+    if (!(C | Z))
+        AOT_GOTO(0x3b0c, L3b0c);
+    AOT_GOTO(0x3b00, L3b00);
+L3b00:
+    AOT_BLOCK(0x3b00, 4);
+    // 3b00: inc 5e00
+    {
+        a = 0x5e00;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 3b04: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 3b08: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 3b0a: br 3ae4
+    AOT_GOTO(0x3ae4, L3ae4);
+L3b0c:
+    AOT_BLOCK(0x3b0c, 2);
+    // 3b0c: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 3b10: rts r3
+    {
+        b = r[3];
+        r[3] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3b12:
+    AOT_BLOCK(0x3b12, 3);
+    // 3b12: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 3b16: movb $3f, (r3)+
+    {
+        src = uint8_t(0x3f);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 3b1a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3b1c:
+    AOT_BLOCK(0x3b1c, 4);
+    // 3b1c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3b1e: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 3b20: mov 5e08, r0
+    {
+        a = 0x5e08;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3b24: bne 3b2e
+    if (!Z)
+        AOT_GOTO(0x3b2e, L3b2e);
+    AOT_GOTO(0x3b26, L3b26);
+L3b26:
+    AOT_BLOCK(0x3b26, 1);
+    // 3b26: jsr pc, 3b56
+    {
+        a = 0x3b56;
+        r[6] -= 2;
+        WR16(r[6], 0x3b2a);
+    }
+    AOT_GOTO(0x3b56, L3b56);
+L3b2a:
+    AOT_BLOCK(0x3b2a, 1);
+    // 3b2a: mov 5e08, r0
+    {
+        a = 0x5e08;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3b2e, L3b2e);
+L3b2e:
+    AOT_BLOCK(0x3b2e, 2);
+    // 3b2e: movb 4(r5), (r0)+
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = r[0];
+        r[0] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 3b32: beq 3b42
+    if (Z)
+        AOT_GOTO(0x3b42, L3b42);
+    AOT_GOTO(0x3b34, L3b34);
+L3b34:
+    AOT_BLOCK(0x3b34, 3);
+    // 3b34: inc 5e08
+    {
+        a = 0x5e08;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 3b38: dec 5e06
+    {
+        a = 0x5e06;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 3b3c: bgt 3b42
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x3b42, L3b42);
+    AOT_GOTO(0x3b3e, L3b3e);
+L3b3e:
+    AOT_BLOCK(0x3b3e, 1);
+    // 3b3e: jsr pc, 3b56
+    {
+        a = 0x3b56;
+        r[6] -= 2;
+        WR16(r[6], 0x3b42);
+    }
+    AOT_GOTO(0x3b56, L3b56);
+L3b42:
+    AOT_BLOCK(0x3b42, 3);
+    // 3b42: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3b46: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3b48: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3b4a:
+    AOT_BLOCK(0x3b4a, 3);
+    // 3b4a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3b4c: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3b4e: jsr pc, 3b56
+    {
+        a = 0x3b56;
+        r[6] -= 2;
+        WR16(r[6], 0x3b52);
+    }
+    AOT_GOTO(0x3b56, L3b56);
+L3b52:
+    AOT_BLOCK(0x3b52, 2);
+    // 3b52: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3b54: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3b56:
+    AOT_BLOCK(0x3b56, 2);
+    // 3b56: mov 5e08, r0
+    {
+        a = 0x5e08;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3b5a: beq 3b70
+    if (Z)
+        AOT_GOTO(0x3b70, L3b70);
+    AOT_GOTO(0x3b5c, L3b5c);
+L3b5c:
+    AOT_BLOCK(0x3b5c, 4);
+    // 3b5c: sub $5e0a, r0
+    {
+        src = uint16_t(0x5e0a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 3b60: mov r0, 57d0
+    {
+        src = r[0];
+        b = 0x57d0;
+        WR16(b, src);
+    }
+    // 3b64: mov 5e04, r0
+    {
+        a = 0x5e04;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3b68: bne 3b6c
+    if (!Z)
+        AOT_GOTO(0x3b6c, L3b6c);
+    AOT_GOTO(0x3b6a, L3b6a);
+L3b6a:
+    AOT_BLOCK(0x3b6a, 1);
+    // 3b6a: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x3b6c, L3b6c);
+L3b6c:
+    // 3b6c: sys 0
+    AOT_INTERP(0x3b6c);
+L3b6e:
+    AOT_BLOCK(0x3b6e, 1);
+    // 3b6e: bis *$15f7, (r4)
+    {
+        a = 0x15f7;
+        src = RD16(a);
+        b = r[4];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3b72, L3b72);
+L3b70:
+    AOT_BLOCK(0x3b70, 1);
+    // 3b70: mov $5e0a, 5e08
+    {
+        src = uint16_t(0x5e0a);
+        b = 0x5e08;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3b76, L3b76);
+L3b72:
+    AOT_BLOCK(0x3b72, 1);
+    // 3b72: bis *2292(r0), (r2)
+    {
+        a = RD16(r[0] + 8850);
+        src = RD16(a);
+        b = r[2];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3b76, L3b76);
+L3b74:
+    AOT_BLOCK(0x3b74, 1);
+    // 3b74: cmp (r2), (r2)+
+    {
+        a = r[2];
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x3b76, L3b76);
+L3b76:
+    AOT_BLOCK(0x3b76, 3);
+    // 3b76: mov $200, 5e06
+    {
+        src = uint16_t(0x0200);
+        b = 0x5e06;
+        WR16(b, src);
+    }
+    // 3b7c: cmp 5e04, $2
+    {
+        a = 0x5e04;
+        src = RD16(a);
+        dst = uint16_t(0x0002);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3b82: bhi 3b8a
+    if (!(C | Z))
+        AOT_GOTO(0x3b8a, L3b8a);
+    AOT_GOTO(0x3b84, L3b84);
+L3b84:
+    AOT_BLOCK(0x3b84, 1);
+    // 3b84: mov $1, 5e06
+    {
+        src = uint16_t(0x0001);
+        b = 0x5e06;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3b8a, L3b8a);
+L3b8a:
+    AOT_BLOCK(0x3b8a, 1);
+    // 3b8a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3b8c:
+    AOT_BLOCK(0x3b8c, 3);
+    // 3b8c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3b8e: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 3b90: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3b94: sys 6
+    AOT_INTERP(0x3b94);
+L3b96:
+    AOT_BLOCK(0x3b96, 1);
+    // 3b96: bcc 3b9c
+    if (!C)
+        AOT_GOTO(0x3b9c, L3b9c);
+    AOT_GOTO(0x3b98, L3b98);
+L3b98:
+    AOT_BLOCK(0x3b98, 1);
+    // 3b98: jmp 3c8e
+    {
+        a = 0x3c8e;
+    }
+    AOT_GOTO(0x3c8e, L3c8e);
+L3b9a:
+    AOT_BLOCK(0x3b9a, 1);
+    // 3b9a: swab a00(r2)
+    {
+        a = uint16_t(r[2] + 2560);
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x3b9e, L3b9e);
+L3b9c:
+    AOT_BLOCK(0x3b9c, 1);
+    // 3b9c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x3b9e, L3b9e);
+L3b9e:
+    AOT_BLOCK(0x3b9e, 2);
+    // 3b9e: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3ba0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3ba2:
+    AOT_BLOCK(0x3ba2, 4);
+    // 3ba2: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3ba4: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 3ba6: mov 4(r5), 57d4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x57d4;
+        WR16(b, src);
+    }
+    // 3bac: mov 6(r5), 57d6
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x57d6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3bb2: sys 0
+    AOT_INTERP(0x3bb2);
+L3bb4:
+    AOT_BLOCK(0x3bb4, 1);
+    // 3bb4: bis *$8602, (r2)+
+    {
+        a = 0x8602;
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3bb8, L3bb8);
+L3bb6:
+    AOT_BLOCK(0x3bb6, 1);
+    // 3bb6: bcc 3bbc
+    if (!C)
+        AOT_GOTO(0x3bbc, L3bbc);
+    AOT_GOTO(0x3bb8, L3bb8);
+L3bb8:
+    AOT_BLOCK(0x3bb8, 1);
+    // 3bb8: jmp 3c8e
+    {
+        a = 0x3c8e;
+    }
+    AOT_GOTO(0x3c8e, L3c8e);
+L3bba:
+    AOT_BLOCK(0x3bba, 1);
+    // 3bba: swab (r2)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x3bbc, L3bbc);
+L3bbc:
+    AOT_BLOCK(0x3bbc, 2);
+    // 3bbc: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3bbe: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3bc0:
+    AOT_BLOCK(0x3bc0, 3);
+    // 3bc0: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3bc2: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 3bc4: mov 4(r5), 57da
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x57da;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3bca: sys 0
+    AOT_INTERP(0x3bca);
+L3bcc:
+    AOT_BLOCK(0x3bcc, 1);
+    // 3bcc: bis *$874a, *(r0)+
+    {
+        a = 0x874a;
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3bd0, L3bd0);
+L3bce:
+    AOT_BLOCK(0x3bce, 1);
+    // 3bce: bcs 3c64
+    if (C)
+        AOT_GOTO(0x3c64, L3c64);
+    AOT_GOTO(0x3bd0, L3bd0);
+L3bd0:
+    AOT_BLOCK(0x3bd0, 1);
+    // 3bd0: mov 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3bd4, L3bd4);
+L3bd2:
+    // 3bd2: rtt
+    AOT_INTERP(0x3bd2);
+L3bd4:
+    AOT_BLOCK(0x3bd4, 5);
+    // 3bd4: mov r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 3bd6: clr (r1)+
+    {
+        a = r[1];
+        r[1] += 2;
+        WR16(a, 0);
+    }
+    // 3bd8: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 3bda: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3bdc: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3bde:
+    AOT_BLOCK(0x3bde, 6);
+    // 3bde: clr 5de4
+    {
+        a = 0x5de4;
+        WR16(a, 0);
+    }
+    // 3be2: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3be4: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 3be6: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 3bea: sub $2, 2(r1)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[1] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[1] + 2);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 3bf0: bge 3c10
+    if (!(N ^ V))
+        AOT_GOTO(0x3c10, L3c10);
+    AOT_GOTO(0x3bf2, L3bf2);
+L3bf2:
+    AOT_BLOCK(0x3bf2, 2);
+    // 3bf2: cmp 2(r1), $ffff
+    {
+        a = uint16_t(r[1] + 2);
+        src = RD16(a);
+        dst = uint16_t(0xffff);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 3bf8: blt 3c08
+    if (N ^ V)
+        AOT_GOTO(0x3c08, L3c08);
+    AOT_GOTO(0x3bfa, L3bfa);
+L3bfa:
+    AOT_BLOCK(0x3bfa, 2);
+    // 3bfa: movb *4(r1), -(sp)
+    {
+        a = RD16(r[1] + 4);
+        src = RD8(a);
+        r[6] -= 2;
+        b = r[6];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 3bfe: jsr pc, 3c44
+    {
+        a = 0x3c44;
+        r[6] -= 2;
+        WR16(r[6], 0x3c02);
+    }
+    AOT_GOTO(0x3c44, L3c44);
+L3c02:
+    AOT_BLOCK(0x3c02, 2);
+    // 3c02: mov 4(r1), r0
+    {
+        a = uint16_t(r[1] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3c06: br 3c16
+    AOT_GOTO(0x3c16, L3c16);
+L3c08:
+    AOT_BLOCK(0x3c08, 1);
+    // 3c08: jsr pc, 3c44
+    {
+        a = 0x3c44;
+        r[6] -= 2;
+        WR16(r[6], 0x3c0c);
+    }
+    AOT_GOTO(0x3c44, L3c44);
+L3c0c:
+    AOT_BLOCK(0x3c0c, 1);
+    // 3c0c: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x3c10, L3c10);
+L3c10:
+    AOT_BLOCK(0x3c10, 2);
+    // 3c10: mov 4(r1), r0
+    {
+        a = uint16_t(r[1] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3c14: movb (r0)+, -(sp)
+    {
+        a = r[0];
+        r[0] += 1;
+        src = RD8(a);
+        r[6] -= 2;
+        b = r[6];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3c16, L3c16);
+L3c16:
+    AOT_BLOCK(0x3c16, 5);
+    // 3c16: movb (r0)+, 1(sp)
+    {
+        a = r[0];
+        r[0] += 1;
+        src = RD8(a);
+        b = uint16_t(r[6] + 1);
+        WR8(b, src);
+    }
+    // 3c1a: mov r0, 4(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 4);
+        WR16(b, src);
+    }
+    // 3c1e: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3c20: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3c22: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3c24:
+    AOT_BLOCK(0x3c24, 5);
+    // 3c24: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3c26: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 3c28: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 3c2c: dec 2(r1)
+    {
+        a = uint16_t(r[1] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 3c30: bge 3c36
+    if (!(N ^ V))
+        AOT_GOTO(0x3c36, L3c36);
+    AOT_GOTO(0x3c32, L3c32);
+L3c32:
+    AOT_BLOCK(0x3c32, 1);
+    // 3c32: jsr pc, 3c44
+    {
+        a = 0x3c44;
+        r[6] -= 2;
+        WR16(r[6], 0x3c36);
+    }
+    AOT_GOTO(0x3c44, L3c44);
+L3c36:
+    AOT_BLOCK(0x3c36, 2);
+    // 3c36: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 3c38: bisb *4(r1), r0
+    {
+        a = RD16(r[1] + 4);
+        src = RD8(a);
+        dst = uint8_t(r[0]);
+        val = src | dst;
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3c3c, L3c3c);
+L3c3c:
+    AOT_BLOCK(0x3c3c, 3);
+    // 3c3c: inc 4(r1)
+    {
+        a = uint16_t(r[1] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 3c40: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3c42: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3c44:
+    AOT_BLOCK(0x3c44, 5);
+    // 3c44: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 3c46: add $6, r0
+    {
+        src = uint16_t(0x0006);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 3c4a: mov r0, 57e0
+    {
+        src = r[0];
+        b = 0x57e0;
+        WR16(b, src);
+    }
+    // 3c4e: mov r0, 4(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 4);
+        WR16(b, src);
+    }
+    // 3c52: mov (r1), r0
+    {
+        a = r[1];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3c54: sys 0
+    AOT_INTERP(0x3c54);
+L3c56:
+    AOT_BLOCK(0x3c56, 1);
+    // 3c56: bis *$8705, *(sp)+
+    {
+        a = 0x8705;
+        src = RD16(a);
+        b = RD16(r[6]);
+        r[6] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x3c5a, L3c5a);
+L3c58:
+    AOT_BLOCK(0x3c58, 1);
+    // 3c58: bcs 3c64
+    if (C)
+        AOT_GOTO(0x3c64, L3c64);
+    AOT_GOTO(0x3c5a, L3c5a);
+L3c5a:
+    AOT_BLOCK(0x3c5a, 1);
+    // 3c5a: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x3c5c, L3c5c);
+L3c5c:
+    AOT_BLOCK(0x3c5c, 1);
+    // 3c5c: bmi 3c64
+    if (N)
+        AOT_GOTO(0x3c64, L3c64);
+    AOT_GOTO(0x3c5e, L3c5e);
+L3c5e:
+    AOT_BLOCK(0x3c5e, 2);
+    // 3c5e: mov r0, 2(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3c62: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3c64:
+    AOT_BLOCK(0x3c64, 1);
+    // 3c64: jmp 3c8e
+    {
+        a = 0x3c8e;
+    }
+    AOT_GOTO(0x3c8e, L3c8e);
+L3c68:
+    AOT_BLOCK(0x3c68, 3);
+    // 3c68: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3c6a: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 3c6c: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3c70: sys 1
+    AOT_INTERP(0x3c70);
+L3c72:
+    AOT_BLOCK(0x3c72, 1);
+    // csv
+    {
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_JUMP(r[0]);
+L3c74:
+    AOT_BLOCK(0x3c74, 1);
+    // 3c74: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3c76, L3c76);
+L3c76:
+    AOT_BLOCK(0x3c76, 1);
+    // 3c76: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3c78, L3c78);
+L3c78:
+    AOT_BLOCK(0x3c78, 1);
+    // 3c78: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x3c7a, L3c7a);
+L3c7a:
+    AOT_BLOCK(0x3c7a, 3);
+    // 3c7a: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 3c7c: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 3c7e: jmp (r0)
+    {
+        a = r[0];
+    }
+    AOT_JUMP(a);
+L3c80:
+    AOT_BLOCK(0x3c80, 1);
+    // cret
+    {
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3c8e:
+    AOT_BLOCK(0x3c8e, 5);
+    // 3c8e: mov r0, 5de4
+    {
+        src = r[0];
+        b = 0x5de4;
+        WR16(b, src);
+    }
+    // 3c92: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+    }
+    // 3c96: mov r5, sp
+    {
+        src = r[5];
+        r[6] = src;
+    }
+    // 3c98: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3c9a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3c9c:
+    AOT_BLOCK(0x3c9c, 5);
+    // 3c9c: mov 2(sp), r0
+    {
+        a = uint16_t(r[6] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3ca0: mov 4(sp), r1
+    {
+        a = uint16_t(r[6] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 3ca4: div 6(sp), r0
+    {
+        a = uint16_t(r[6] + 6);
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 3ca8: mov r1, 600a
+    {
+        src = r[1];
+        b = 0x600a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3cac: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3cae:
+    AOT_BLOCK(0x3cae, 5);
+    // 3cae: mov 2(sp), r0
+    {
+        a = uint16_t(r[6] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 3cb2: mov 4(sp), r1
+    {
+        a = uint16_t(r[6] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 3cb6: div 6(sp), r0
+    {
+        a = uint16_t(r[6] + 6);
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 3cba: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3cbc: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L3e02:
+    // 3e02: halt
+    AOT_INTERP(0x3e02);
+L3e04:
+    // 3e04: (undefined)
+    AOT_INTERP(0x3e04);
+L3e06:
+    // 3e06: (undefined)
+    AOT_INTERP(0x3e06);
+L3e08:
+    // 3e08: (undefined)
+    AOT_INTERP(0x3e08);
+L3e0a:
+    // 3e0a: halt
+    AOT_INTERP(0x3e0a);
+L3e0c:
+    // 3e0c: (undefined)
+    AOT_INTERP(0x3e0c);
+L3e0e:
+    // 3e0e: (undefined)
+    AOT_INTERP(0x3e0e);
+L3e10:
+    // 3e10: (undefined)
+    AOT_INTERP(0x3e10);
+L3e12:
+    // 3e12: halt
+    AOT_INTERP(0x3e12);
+L3e14:
+    // 3e14: (undefined)
+    AOT_INTERP(0x3e14);
+L3e16:
+    // 3e16: (undefined)
+    AOT_INTERP(0x3e16);
+L3e18:
+    // 3e18: (undefined)
+    AOT_INTERP(0x3e18);
+L3e1a:
+    // 3e1a: halt
+    AOT_INTERP(0x3e1a);
+L3e1c:
+    // 3e1c: (undefined)
+    AOT_INTERP(0x3e1c);
+L3e1e:
+    // 3e1e: (undefined)
+    AOT_INTERP(0x3e1e);
+L3e20:
+    // 3e20: (undefined)
+    AOT_INTERP(0x3e20);
+L3e22:
+    // 3e22: (undefined)
+    AOT_INTERP(0x3e22);
+L3e24:
+    AOT_BLOCK(0x3e24, 1);
+    // 3e24: mov r0, (r4)+
+    {
+        src = r[0];
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3e26: (undefined)
+    AOT_INTERP(0x3e26);
+L3e28:
+    // 3e28: (undefined)
+    AOT_INTERP(0x3e28);
+L3e2a:
+    // 3e2a: (undefined)
+    AOT_INTERP(0x3e2a);
+L3e2c:
+    AOT_BLOCK(0x3e2c, 1);
+    // 3e2c: mov r0, (r4)+
+    {
+        src = r[0];
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3e2e: (undefined)
+    AOT_INTERP(0x3e2e);
+L3e30:
+    // 3e30: (undefined)
+    AOT_INTERP(0x3e30);
+L3e32:
+    // 3e32: (undefined)
+    AOT_INTERP(0x3e32);
+L3e34:
+    AOT_BLOCK(0x3e34, 1);
+    // 3e34: mov r0, (r4)+
+    {
+        src = r[0];
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3e36: (undefined)
+    AOT_INTERP(0x3e36);
+L3e38:
+    // 3e38: (undefined)
+    AOT_INTERP(0x3e38);
+L3e3a:
+    // 3e3a: (undefined)
+    AOT_INTERP(0x3e3a);
+L3e3c:
+    AOT_BLOCK(0x3e3c, 1);
+    // 3e3c: mov r0, (r4)+
+    {
+        src = r[0];
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 3e3e: (undefined)
+    AOT_INTERP(0x3e3e);
+L3e40:
+    // 3e40: (undefined)
+    AOT_INTERP(0x3e40);
+L3e42:
+    // 3e42: (undefined)
+    AOT_INTERP(0x3e42);
+L3e44:
+    // 3e44: (undefined)
+    AOT_INTERP(0x3e44);
+L3e46:
+    AOT_BLOCK(0x3e46, 4);
+    // 3e46: div r1, r1
+    {
+        src = int16_t(r[1]);
+        if (src == 0 || abs(int16_t(r[1])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[1]) << 16) | r[2];
+        dst = val / src;
+        r[1] = dst;
+        r[2] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 3e48: cmp r1, -(pc)
+    {
+        src = r[1];
+        dst = uint16_t(0x0000);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 3e4a: add *6e75(r5), -(r3)
+    {
+        a = RD16(r[5] + 28277);
+        src = RD16(a);
+        r[3] -= 2;
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 3e4e: jmp 694d(r4)
+    {
+        a = uint16_t(r[4] + 26957);
+    }
+    AOT_JUMP(a);
+L4148:
+    // 4148: halt
+    AOT_INTERP(0x4148);
+L414a:
+    // 414a: halt
+    AOT_INTERP(0x414a);
+L414c:
+    // 414c: (undefined)
+    AOT_INTERP(0x414c);
+L414e:
+    // 414e: halt
+    AOT_INTERP(0x414e);
+L4150:
+    // 4150: rti
+    AOT_INTERP(0x4150);
+L4152:
+    // 4152: (undefined)
+    AOT_INTERP(0x4152);
+L4154:
+    // 4154: (undefined)
+    AOT_INTERP(0x4154);
+L4156:
+    // 4156: halt
+    AOT_INTERP(0x4156);
+L4158:
+    // 4158: rti
+    AOT_INTERP(0x4158);
+L415a:
+    // 415a: (undefined)
+    AOT_INTERP(0x415a);
+L415c:
+    // 415c: (undefined)
+    AOT_INTERP(0x415c);
+L415e:
+    // 415e: halt
+    AOT_INTERP(0x415e);
+L4160:
+    // 4160: (undefined)
+    AOT_INTERP(0x4160);
+L4162:
+    // 4162: (undefined)
+    AOT_INTERP(0x4162);
+L4164:
+    // 4164: (undefined)
+    AOT_INTERP(0x4164);
+L4166:
+    // 4166: halt
+    AOT_INTERP(0x4166);
+L4168:
+    // 4168: (undefined)
+    AOT_INTERP(0x4168);
+L416a:
+    // 416a: (undefined)
+    AOT_INTERP(0x416a);
+L416c:
+    // 416c: (undefined)
+    AOT_INTERP(0x416c);
+L416e:
+    // 416e: (undefined)
+    AOT_INTERP(0x416e);
+L4170:
+    // 4170: halt
+    AOT_INTERP(0x4170);
+L4172:
+    // 4172: (undefined)
+    AOT_INTERP(0x4172);
+L4174:
+    // 4174: (undefined)
+    AOT_INTERP(0x4174);
+L4176:
+    // 4176: halt
+    AOT_INTERP(0x4176);
+L4178:
+    // 4178: (undefined)
+    AOT_INTERP(0x4178);
+L417a:
+    // 417a: (undefined)
+    AOT_INTERP(0x417a);
+L417c:
+    // 417c: (undefined)
+    AOT_INTERP(0x417c);
+L417e:
+    // 417e: halt
+    AOT_INTERP(0x417e);
+L4180:
+    // 4180: (undefined)
+    AOT_INTERP(0x4180);
+L4182:
+    // 4182: (undefined)
+    AOT_INTERP(0x4182);
+L4184:
+    // 4184: halt
+    AOT_INTERP(0x4184);
+L4186:
+    // 4186: (undefined)
+    AOT_INTERP(0x4186);
+L4188:
+    // 4188: (undefined)
+    AOT_INTERP(0x4188);
+L418a:
+    // 418a: halt
+    AOT_INTERP(0x418a);
+L418c:
+    // 418c: wait
+    AOT_INTERP(0x418c);
+L418e:
+    // 418e: (undefined)
+    AOT_INTERP(0x418e);
+L4190:
+    // 4190: (undefined)
+    AOT_INTERP(0x4190);
+L4192:
+    // 4192: halt
+    AOT_INTERP(0x4192);
+L4194:
+    // 4194: halt
+    AOT_INTERP(0x4194);
+L4196:
+    // 4196: wait
+    AOT_INTERP(0x4196);
+L4198:
+    // 4198: (undefined)
+    AOT_INTERP(0x4198);
+L419a:
+    AOT_BLOCK(0x419a, 26);
+    // 419a: cmp (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 419c: mov *1fa4(r5), r4
+    {
+        a = RD16(r[5] + 8100);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 41a0: cmp (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41a2: cmp pc, 22dc(sp)
+    {
+        src = uint16_t(0x41a4);
+        b = uint16_t(r[6] + 8924);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41a6: mov *64ac, *-(r4)
+    {
+        a = RD16(0x64ac);
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        WR16(b, src);
+    }
+    // 41aa: cmp pc, 229c(sp)
+    {
+        src = uint16_t(0x41ac);
+        b = uint16_t(r[6] + 8860);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41ae: mov *2302(r5), (r0)
+    {
+        a = RD16(r[5] + 8962);
+        src = RD16(a);
+        b = r[0];
+        WR16(b, src);
+    }
+    // 41b2: cmp (r2), *-(r4)
+    {
+        a = r[2];
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41b4: mov *2034(r5), *(r4)+
+    {
+        a = RD16(r[5] + 8244);
+        src = RD16(a);
+        b = RD16(r[4]);
+        r[4] += 2;
+        WR16(b, src);
+    }
+    // 41b8: cmp (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41ba: cmp (r1), *-(r2)
+    {
+        a = r[1];
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41bc: cmp (r3), r2
+    {
+        a = r[3];
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41be: mov *20c6(r5), *-(r0)
+    {
+        a = RD16(r[5] + 8390);
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+    }
+    // 41c2: cmp (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41c4: mov *211c(r5), 2302(r4)
+    {
+        a = RD16(r[5] + 8476);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8962);
+        WR16(b, src);
+    }
+    // 41ca: cmp (r3), 1f80(r2)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = uint16_t(r[2] + 8064);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41ce: cmp r1, *(r2)+
+    {
+        src = r[1];
+        b = RD16(r[2]);
+        r[2] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41d0: cmp (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41d2: mov *20a2(sp), 2302(r0)
+    {
+        a = RD16(r[6] + 8354);
+        src = RD16(a);
+        b = uint16_t(r[0] + 8962);
+        WR16(b, src);
+    }
+    // 41d8: mov *625a, (r4)+
+    {
+        a = RD16(0x625a);
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+    }
+    // 41dc: cmp (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41de: cmp r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41e0: mov *2254(sp), (r4)
+    {
+        a = RD16(r[6] + 8788);
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 41e4: cmp (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41e6: cmp (r0), -(r2)
+    {
+        a = r[0];
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 41e8: cmp pc, 1ff8(sp)
+    {
+        src = uint16_t(0x41ea);
+        b = uint16_t(r[6] + 8184);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 41ec: (undefined)
+    AOT_INTERP(0x41ec);
+L41ee:
+    AOT_BLOCK(0x41ee, 2);
+    // 41ee: cmp (r5)+, (r4)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 41f0: jmp -(r4)
+    {
+        r[4] -= 2;
+        a = r[4];
+    }
+    AOT_JUMP(a);
+}
+
+AotImage image("v6/lib/c1", 0x0000, 22500, 0x19395d3au, run);
+}
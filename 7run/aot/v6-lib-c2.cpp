@@ -0,0 +1,21226 @@
+// v6/lib/c2 translated by 7aot: 1052 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x0004: goto L0004;
+        case 0x000c: goto L000c;
+        case 0x0010: goto L0010;
+        case 0x0012: goto L0012;
+        case 0x0016: goto L0016;
+        case 0x0018: goto L0018;
+        case 0x001a: goto L001a;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0020: goto L0020;
+        case 0x0022: goto L0022;
+        case 0x0024: goto L0024;
+        case 0x0026: goto L0026;
+        case 0x002a: goto L002a;
+        case 0x0030: goto L0030;
+        case 0x0032: goto L0032;
+        case 0x0040: goto L0040;
+        case 0x0048: goto L0048;
+        case 0x0054: goto L0054;
+        case 0x0062: goto L0062;
+        case 0x006a: goto L006a;
+        case 0x006c: goto L006c;
+        case 0x0070: goto L0070;
+        case 0x0074: goto L0074;
+        case 0x0078: goto L0078;
+        case 0x0080: goto L0080;
+        case 0x0090: goto L0090;
+        case 0x009a: goto L009a;
+        case 0x009c: goto L009c;
+        case 0x00a2: goto L00a2;
+        case 0x00a6: goto L00a6;
+        case 0x00ae: goto L00ae;
+        case 0x00be: goto L00be;
+        case 0x00c6: goto L00c6;
+        case 0x00dc: goto L00dc;
+        case 0x00e6: goto L00e6;
+        case 0x00e8: goto L00e8;
+        case 0x00f0: goto L00f0;
+        case 0x00f4: goto L00f4;
+        case 0x00fc: goto L00fc;
+        case 0x010e: goto L010e;
+        case 0x0112: goto L0112;
+        case 0x0118: goto L0118;
+        case 0x011a: goto L011a;
+        case 0x011e: goto L011e;
+        case 0x0122: goto L0122;
+        case 0x0126: goto L0126;
+        case 0x012e: goto L012e;
+        case 0x0132: goto L0132;
+        case 0x0136: goto L0136;
+        case 0x013c: goto L013c;
+        case 0x0140: goto L0140;
+        case 0x0144: goto L0144;
+        case 0x0148: goto L0148;
+        case 0x014c: goto L014c;
+        case 0x0150: goto L0150;
+        case 0x0152: goto L0152;
+        case 0x015c: goto L015c;
+        case 0x0160: goto L0160;
+        case 0x016c: goto L016c;
+        case 0x0170: goto L0170;
+        case 0x017a: goto L017a;
+        case 0x0188: goto L0188;
+        case 0x0196: goto L0196;
+        case 0x01a4: goto L01a4;
+        case 0x01b2: goto L01b2;
+        case 0x01c0: goto L01c0;
+        case 0x01ce: goto L01ce;
+        case 0x01dc: goto L01dc;
+        case 0x01ea: goto L01ea;
+        case 0x01f8: goto L01f8;
+        case 0x0202: goto L0202;
+        case 0x0206: goto L0206;
+        case 0x0214: goto L0214;
+        case 0x0222: goto L0222;
+        case 0x0230: goto L0230;
+        case 0x023e: goto L023e;
+        case 0x024c: goto L024c;
+        case 0x025a: goto L025a;
+        case 0x0276: goto L0276;
+        case 0x027c: goto L027c;
+        case 0x0282: goto L0282;
+        case 0x0286: goto L0286;
+        case 0x028e: goto L028e;
+        case 0x0292: goto L0292;
+        case 0x0298: goto L0298;
+        case 0x02a0: goto L02a0;
+        case 0x02aa: goto L02aa;
+        case 0x02b6: goto L02b6;
+        case 0x02c0: goto L02c0;
+        case 0x02d0: goto L02d0;
+        case 0x02d4: goto L02d4;
+        case 0x02d6: goto L02d6;
+        case 0x02de: goto L02de;
+        case 0x02ea: goto L02ea;
+        case 0x02f4: goto L02f4;
+        case 0x02fa: goto L02fa;
+        case 0x0300: goto L0300;
+        case 0x030c: goto L030c;
+        case 0x0310: goto L0310;
+        case 0x0312: goto L0312;
+        case 0x031a: goto L031a;
+        case 0x032a: goto L032a;
+        case 0x0332: goto L0332;
+        case 0x033c: goto L033c;
+        case 0x0342: goto L0342;
+        case 0x035a: goto L035a;
+        case 0x0360: goto L0360;
+        case 0x0366: goto L0366;
+        case 0x036a: goto L036a;
+        case 0x036c: goto L036c;
+        case 0x0370: goto L0370;
+        case 0x0378: goto L0378;
+        case 0x037c: goto L037c;
+        case 0x0380: goto L0380;
+        case 0x0386: goto L0386;
+        case 0x038e: goto L038e;
+        case 0x0394: goto L0394;
+        case 0x039a: goto L039a;
+        case 0x039c: goto L039c;
+        case 0x03a0: goto L03a0;
+        case 0x03a8: goto L03a8;
+        case 0x03ac: goto L03ac;
+        case 0x03b6: goto L03b6;
+        case 0x03be: goto L03be;
+        case 0x03c4: goto L03c4;
+        case 0x03d4: goto L03d4;
+        case 0x03d8: goto L03d8;
+        case 0x03dc: goto L03dc;
+        case 0x03e0: goto L03e0;
+        case 0x03e4: goto L03e4;
+        case 0x03ec: goto L03ec;
+        case 0x03f2: goto L03f2;
+        case 0x03f6: goto L03f6;
+        case 0x03fc: goto L03fc;
+        case 0x0400: goto L0400;
+        case 0x040c: goto L040c;
+        case 0x0410: goto L0410;
+        case 0x041c: goto L041c;
+        case 0x0420: goto L0420;
+        case 0x042a: goto L042a;
+        case 0x042e: goto L042e;
+        case 0x0432: goto L0432;
+        case 0x0436: goto L0436;
+        case 0x043c: goto L043c;
+        case 0x0446: goto L0446;
+        case 0x044e: goto L044e;
+        case 0x0456: goto L0456;
+        case 0x0458: goto L0458;
+        case 0x045e: goto L045e;
+        case 0x0464: goto L0464;
+        case 0x046a: goto L046a;
+        case 0x0476: goto L0476;
+        case 0x047a: goto L047a;
+        case 0x0480: goto L0480;
+        case 0x0486: goto L0486;
+        case 0x0492: goto L0492;
+        case 0x0496: goto L0496;
+        case 0x049e: goto L049e;
+        case 0x04a0: goto L04a0;
+        case 0x04ac: goto L04ac;
+        case 0x04b0: goto L04b0;
+        case 0x04c0: goto L04c0;
+        case 0x04c4: goto L04c4;
+        case 0x04ca: goto L04ca;
+        case 0x04d6: goto L04d6;
+        case 0x04d8: goto L04d8;
+        case 0x04e0: goto L04e0;
+        case 0x04e4: goto L04e4;
+        case 0x04ec: goto L04ec;
+        case 0x04f0: goto L04f0;
+        case 0x04f8: goto L04f8;
+        case 0x04fc: goto L04fc;
+        case 0x0502: goto L0502;
+        case 0x050e: goto L050e;
+        case 0x0512: goto L0512;
+        case 0x0518: goto L0518;
+        case 0x051c: goto L051c;
+        case 0x051e: goto L051e;
+        case 0x052a: goto L052a;
+        case 0x052c: goto L052c;
+        case 0x0532: goto L0532;
+        case 0x0536: goto L0536;
+        case 0x0538: goto L0538;
+        case 0x053e: goto L053e;
+        case 0x0544: goto L0544;
+        case 0x0550: goto L0550;
+        case 0x055a: goto L055a;
+        case 0x055e: goto L055e;
+        case 0x056a: goto L056a;
+        case 0x0578: goto L0578;
+        case 0x057c: goto L057c;
+        case 0x0582: goto L0582;
+        case 0x058a: goto L058a;
+        case 0x058e: goto L058e;
+        case 0x0592: goto L0592;
+        case 0x0596: goto L0596;
+        case 0x059c: goto L059c;
+        case 0x05a6: goto L05a6;
+        case 0x05aa: goto L05aa;
+        case 0x05ac: goto L05ac;
+        case 0x05b4: goto L05b4;
+        case 0x05ba: goto L05ba;
+        case 0x05be: goto L05be;
+        case 0x05c0: goto L05c0;
+        case 0x05c6: goto L05c6;
+        case 0x05ca: goto L05ca;
+        case 0x05d2: goto L05d2;
+        case 0x05d6: goto L05d6;
+        case 0x05fe: goto L05fe;
+        case 0x0602: goto L0602;
+        case 0x0608: goto L0608;
+        case 0x060c: goto L060c;
+        case 0x060e: goto L060e;
+        case 0x0616: goto L0616;
+        case 0x061a: goto L061a;
+        case 0x0628: goto L0628;
+        case 0x062c: goto L062c;
+        case 0x0632: goto L0632;
+        case 0x0638: goto L0638;
+        case 0x063c: goto L063c;
+        case 0x063e: goto L063e;
+        case 0x0644: goto L0644;
+        case 0x064a: goto L064a;
+        case 0x064e: goto L064e;
+        case 0x067e: goto L067e;
+        case 0x0684: goto L0684;
+        case 0x068a: goto L068a;
+        case 0x068e: goto L068e;
+        case 0x0692: goto L0692;
+        case 0x0698: goto L0698;
+        case 0x069a: goto L069a;
+        case 0x06a0: goto L06a0;
+        case 0x06a4: goto L06a4;
+        case 0x06a8: goto L06a8;
+        case 0x06b2: goto L06b2;
+        case 0x06c0: goto L06c0;
+        case 0x06c6: goto L06c6;
+        case 0x06c8: goto L06c8;
+        case 0x06d0: goto L06d0;
+        case 0x06d4: goto L06d4;
+        case 0x06d8: goto L06d8;
+        case 0x06de: goto L06de;
+        case 0x06e4: goto L06e4;
+        case 0x06e8: goto L06e8;
+        case 0x06ea: goto L06ea;
+        case 0x06f6: goto L06f6;
+        case 0x0700: goto L0700;
+        case 0x0704: goto L0704;
+        case 0x070c: goto L070c;
+        case 0x0712: goto L0712;
+        case 0x0716: goto L0716;
+        case 0x071a: goto L071a;
+        case 0x071e: goto L071e;
+        case 0x0724: goto L0724;
+        case 0x0738: goto L0738;
+        case 0x073e: goto L073e;
+        case 0x0742: goto L0742;
+        case 0x0746: goto L0746;
+        case 0x074c: goto L074c;
+        case 0x0752: goto L0752;
+        case 0x0758: goto L0758;
+        case 0x0770: goto L0770;
+        case 0x0778: goto L0778;
+        case 0x077c: goto L077c;
+        case 0x0780: goto L0780;
+        case 0x0786: goto L0786;
+        case 0x078e: goto L078e;
+        case 0x0794: goto L0794;
+        case 0x0798: goto L0798;
+        case 0x079e: goto L079e;
+        case 0x07a6: goto L07a6;
+        case 0x07ae: goto L07ae;
+        case 0x07b6: goto L07b6;
+        case 0x07bc: goto L07bc;
+        case 0x07c0: goto L07c0;
+        case 0x07c4: goto L07c4;
+        case 0x07ca: goto L07ca;
+        case 0x07d0: goto L07d0;
+        case 0x07d6: goto L07d6;
+        case 0x07dc: goto L07dc;
+        case 0x07e2: goto L07e2;
+        case 0x07e8: goto L07e8;
+        case 0x07ee: goto L07ee;
+        case 0x07f2: goto L07f2;
+        case 0x07fe: goto L07fe;
+        case 0x0802: goto L0802;
+        case 0x0806: goto L0806;
+        case 0x080c: goto L080c;
+        case 0x0812: goto L0812;
+        case 0x0818: goto L0818;
+        case 0x081e: goto L081e;
+        case 0x0826: goto L0826;
+        case 0x082e: goto L082e;
+        case 0x0834: goto L0834;
+        case 0x0838: goto L0838;
+        case 0x084a: goto L084a;
+        case 0x085c: goto L085c;
+        case 0x0862: goto L0862;
+        case 0x086c: goto L086c;
+        case 0x0870: goto L0870;
+        case 0x087a: goto L087a;
+        case 0x087e: goto L087e;
+        case 0x0886: goto L0886;
+        case 0x08b2: goto L08b2;
+        case 0x08b8: goto L08b8;
+        case 0x08be: goto L08be;
+        case 0x08c4: goto L08c4;
+        case 0x08cc: goto L08cc;
+        case 0x08d4: goto L08d4;
+        case 0x08dc: goto L08dc;
+        case 0x08ee: goto L08ee;
+        case 0x08fa: goto L08fa;
+        case 0x090e: goto L090e;
+        case 0x0912: goto L0912;
+        case 0x0916: goto L0916;
+        case 0x091c: goto L091c;
+        case 0x0922: goto L0922;
+        case 0x0940: goto L0940;
+        case 0x094a: goto L094a;
+        case 0x0950: goto L0950;
+        case 0x0956: goto L0956;
+        case 0x095c: goto L095c;
+        case 0x095e: goto L095e;
+        case 0x0962: goto L0962;
+        case 0x0966: goto L0966;
+        case 0x096a: goto L096a;
+        case 0x0980: goto L0980;
+        case 0x0984: goto L0984;
+        case 0x098a: goto L098a;
+        case 0x0990: goto L0990;
+        case 0x0992: goto L0992;
+        case 0x0998: goto L0998;
+        case 0x099e: goto L099e;
+        case 0x09a0: goto L09a0;
+        case 0x09a8: goto L09a8;
+        case 0x09ae: goto L09ae;
+        case 0x09b2: goto L09b2;
+        case 0x09b8: goto L09b8;
+        case 0x09be: goto L09be;
+        case 0x09e0: goto L09e0;
+        case 0x09e4: goto L09e4;
+        case 0x09f2: goto L09f2;
+        case 0x09fa: goto L09fa;
+        case 0x0a00: goto L0a00;
+        case 0x0a02: goto L0a02;
+        case 0x0a0e: goto L0a0e;
+        case 0x0a16: goto L0a16;
+        case 0x0a4e: goto L0a4e;
+        case 0x0a52: goto L0a52;
+        case 0x0a64: goto L0a64;
+        case 0x0a6c: goto L0a6c;
+        case 0x0a72: goto L0a72;
+        case 0x0a78: goto L0a78;
+        case 0x0a80: goto L0a80;
+        case 0x0a86: goto L0a86;
+        case 0x0a88: goto L0a88;
+        case 0x0a8e: goto L0a8e;
+        case 0x0a94: goto L0a94;
+        case 0x0a9c: goto L0a9c;
+        case 0x0aa0: goto L0aa0;
+        case 0x0aa6: goto L0aa6;
+        case 0x0aac: goto L0aac;
+        case 0x0ab0: goto L0ab0;
+        case 0x0ab6: goto L0ab6;
+        case 0x0af6: goto L0af6;
+        case 0x0afe: goto L0afe;
+        case 0x0b04: goto L0b04;
+        case 0x0b0a: goto L0b0a;
+        case 0x0b12: goto L0b12;
+        case 0x0b18: goto L0b18;
+        case 0x0b24: goto L0b24;
+        case 0x0b2c: goto L0b2c;
+        case 0x0b30: goto L0b30;
+        case 0x0b3a: goto L0b3a;
+        case 0x0b3e: goto L0b3e;
+        case 0x0b44: goto L0b44;
+        case 0x0b50: goto L0b50;
+        case 0x0b58: goto L0b58;
+        case 0x0b5e: goto L0b5e;
+        case 0x0b62: goto L0b62;
+        case 0x0b6c: goto L0b6c;
+        case 0x0b82: goto L0b82;
+        case 0x0bce: goto L0bce;
+        case 0x0bd6: goto L0bd6;
+        case 0x0be2: goto L0be2;
+        case 0x0bec: goto L0bec;
+        case 0x0bf0: goto L0bf0;
+        case 0x0bfc: goto L0bfc;
+        case 0x0c00: goto L0c00;
+        case 0x0c08: goto L0c08;
+        case 0x0c0c: goto L0c0c;
+        case 0x0c12: goto L0c12;
+        case 0x0c18: goto L0c18;
+        case 0x0c20: goto L0c20;
+        case 0x0c24: goto L0c24;
+        case 0x0c28: goto L0c28;
+        case 0x0c2e: goto L0c2e;
+        case 0x0c34: goto L0c34;
+        case 0x0c3c: goto L0c3c;
+        case 0x0c3e: goto L0c3e;
+        case 0x0c44: goto L0c44;
+        case 0x0c4a: goto L0c4a;
+        case 0x0c4e: goto L0c4e;
+        case 0x0c5a: goto L0c5a;
+        case 0x0c60: goto L0c60;
+        case 0x0c66: goto L0c66;
+        case 0x0c68: goto L0c68;
+        case 0x0c74: goto L0c74;
+        case 0x0c7a: goto L0c7a;
+        case 0x0c80: goto L0c80;
+        case 0x0ca2: goto L0ca2;
+        case 0x0cb6: goto L0cb6;
+        case 0x0cb8: goto L0cb8;
+        case 0x0cba: goto L0cba;
+        case 0x0cbe: goto L0cbe;
+        case 0x0cca: goto L0cca;
+        case 0x0cce: goto L0cce;
+        case 0x0cd2: goto L0cd2;
+        case 0x0cd8: goto L0cd8;
+        case 0x0cda: goto L0cda;
+        case 0x0ce0: goto L0ce0;
+        case 0x0cec: goto L0cec;
+        case 0x0d02: goto L0d02;
+        case 0x0d04: goto L0d04;
+        case 0x0d08: goto L0d08;
+        case 0x0d10: goto L0d10;
+        case 0x0d1a: goto L0d1a;
+        case 0x0d20: goto L0d20;
+        case 0x0d28: goto L0d28;
+        case 0x0d2c: goto L0d2c;
+        case 0x0d32: goto L0d32;
+        case 0x0d3e: goto L0d3e;
+        case 0x0d46: goto L0d46;
+        case 0x0d4e: goto L0d4e;
+        case 0x0d56: goto L0d56;
+        case 0x0d5e: goto L0d5e;
+        case 0x0d7a: goto L0d7a;
+        case 0x0d86: goto L0d86;
+        case 0x0d90: goto L0d90;
+        case 0x0d9a: goto L0d9a;
+        case 0x0daa: goto L0daa;
+        case 0x0db0: goto L0db0;
+        case 0x0db6: goto L0db6;
+        case 0x0dd2: goto L0dd2;
+        case 0x0dd6: goto L0dd6;
+        case 0x0de4: goto L0de4;
+        case 0x0de6: goto L0de6;
+        case 0x0de8: goto L0de8;
+        case 0x0dee: goto L0dee;
+        case 0x0dfe: goto L0dfe;
+        case 0x0e02: goto L0e02;
+        case 0x0e0e: goto L0e0e;
+        case 0x0e10: goto L0e10;
+        case 0x0e18: goto L0e18;
+        case 0x0e20: goto L0e20;
+        case 0x0e24: goto L0e24;
+        case 0x0e2a: goto L0e2a;
+        case 0x0e30: goto L0e30;
+        case 0x0e3c: goto L0e3c;
+        case 0x0e46: goto L0e46;
+        case 0x0e52: goto L0e52;
+        case 0x0e5a: goto L0e5a;
+        case 0x0e62: goto L0e62;
+        case 0x0e66: goto L0e66;
+        case 0x0e6a: goto L0e6a;
+        case 0x0e6e: goto L0e6e;
+        case 0x0e72: goto L0e72;
+        case 0x0e7c: goto L0e7c;
+        case 0x0e84: goto L0e84;
+        case 0x0e8a: goto L0e8a;
+        case 0x0e90: goto L0e90;
+        case 0x0e9c: goto L0e9c;
+        case 0x0ea4: goto L0ea4;
+        case 0x0eaa: goto L0eaa;
+        case 0x0eb2: goto L0eb2;
+        case 0x0eb8: goto L0eb8;
+        case 0x0ec2: goto L0ec2;
+        case 0x0ec6: goto L0ec6;
+        case 0x0ed2: goto L0ed2;
+        case 0x0ed4: goto L0ed4;
+        case 0x0edc: goto L0edc;
+        case 0x0ede: goto L0ede;
+        case 0x0ee4: goto L0ee4;
+        case 0x0eea: goto L0eea;
+        case 0x0ef6: goto L0ef6;
+        case 0x0f00: goto L0f00;
+        case 0x0f0c: goto L0f0c;
+        case 0x0f12: goto L0f12;
+        case 0x0f32: goto L0f32;
+        case 0x0f34: goto L0f34;
+        case 0x0f3a: goto L0f3a;
+        case 0x0f40: goto L0f40;
+        case 0x0f48: goto L0f48;
+        case 0x0f50: goto L0f50;
+        case 0x0f5e: goto L0f5e;
+        case 0x0f66: goto L0f66;
+        case 0x0f6c: goto L0f6c;
+        case 0x0f72: goto L0f72;
+        case 0x0f76: goto L0f76;
+        case 0x0f78: goto L0f78;
+        case 0x0f82: goto L0f82;
+        case 0x0f88: goto L0f88;
+        case 0x0f90: goto L0f90;
+        case 0x0f94: goto L0f94;
+        case 0x0fa4: goto L0fa4;
+        case 0x0fa8: goto L0fa8;
+        case 0x0fb4: goto L0fb4;
+        case 0x0fb8: goto L0fb8;
+        case 0x0fbc: goto L0fbc;
+        case 0x0fc6: goto L0fc6;
+        case 0x0fcc: goto L0fcc;
+        case 0x0fd2: goto L0fd2;
+        case 0x0fd8: goto L0fd8;
+        case 0x0fe8: goto L0fe8;
+        case 0x0ffa: goto L0ffa;
+        case 0x1000: goto L1000;
+        case 0x102e: goto L102e;
+        case 0x1032: goto L1032;
+        case 0x1038: goto L1038;
+        case 0x103c: goto L103c;
+        case 0x1044: goto L1044;
+        case 0x104c: goto L104c;
+        case 0x1052: goto L1052;
+        case 0x105a: goto L105a;
+        case 0x105e: goto L105e;
+        case 0x1064: goto L1064;
+        case 0x1070: goto L1070;
+        case 0x1082: goto L1082;
+        case 0x109e: goto L109e;
+        case 0x10a2: goto L10a2;
+        case 0x10a6: goto L10a6;
+        case 0x10b0: goto L10b0;
+        case 0x10b8: goto L10b8;
+        case 0x10bc: goto L10bc;
+        case 0x10be: goto L10be;
+        case 0x10c2: goto L10c2;
+        case 0x10d0: goto L10d0;
+        case 0x10d4: goto L10d4;
+        case 0x10d8: goto L10d8;
+        case 0x10de: goto L10de;
+        case 0x10e2: goto L10e2;
+        case 0x10f2: goto L10f2;
+        case 0x10f6: goto L10f6;
+        case 0x10fc: goto L10fc;
+        case 0x1100: goto L1100;
+        case 0x1104: goto L1104;
+        case 0x1108: goto L1108;
+        case 0x110c: goto L110c;
+        case 0x1110: goto L1110;
+        case 0x1116: goto L1116;
+        case 0x1118: goto L1118;
+        case 0x111c: goto L111c;
+        case 0x1120: goto L1120;
+        case 0x1132: goto L1132;
+        case 0x114a: goto L114a;
+        case 0x114e: goto L114e;
+        case 0x1156: goto L1156;
+        case 0x115a: goto L115a;
+        case 0x1160: goto L1160;
+        case 0x1166: goto L1166;
+        case 0x116a: goto L116a;
+        case 0x116e: goto L116e;
+        case 0x1188: goto L1188;
+        case 0x1190: goto L1190;
+        case 0x1196: goto L1196;
+        case 0x11a6: goto L11a6;
+        case 0x11b0: goto L11b0;
+        case 0x11b6: goto L11b6;
+        case 0x11c2: goto L11c2;
+        case 0x11c6: goto L11c6;
+        case 0x11cc: goto L11cc;
+        case 0x11d2: goto L11d2;
+        case 0x11e0: goto L11e0;
+        case 0x11ec: goto L11ec;
+        case 0x120a: goto L120a;
+        case 0x120e: goto L120e;
+        case 0x1212: goto L1212;
+        case 0x1218: goto L1218;
+        case 0x1220: goto L1220;
+        case 0x1228: goto L1228;
+        case 0x122c: goto L122c;
+        case 0x1232: goto L1232;
+        case 0x1234: goto L1234;
+        case 0x1236: goto L1236;
+        case 0x123a: goto L123a;
+        case 0x1248: goto L1248;
+        case 0x124e: goto L124e;
+        case 0x125c: goto L125c;
+        case 0x1266: goto L1266;
+        case 0x126e: goto L126e;
+        case 0x127a: goto L127a;
+        case 0x127e: goto L127e;
+        case 0x1284: goto L1284;
+        case 0x128c: goto L128c;
+        case 0x1294: goto L1294;
+        case 0x129a: goto L129a;
+        case 0x129e: goto L129e;
+        case 0x12aa: goto L12aa;
+        case 0x12ba: goto L12ba;
+        case 0x12c4: goto L12c4;
+        case 0x12cc: goto L12cc;
+        case 0x12ce: goto L12ce;
+        case 0x12d0: goto L12d0;
+        case 0x12d4: goto L12d4;
+        case 0x12e4: goto L12e4;
+        case 0x12e8: goto L12e8;
+        case 0x12ea: goto L12ea;
+        case 0x12f2: goto L12f2;
+        case 0x1302: goto L1302;
+        case 0x1306: goto L1306;
+        case 0x130c: goto L130c;
+        case 0x1310: goto L1310;
+        case 0x131e: goto L131e;
+        case 0x1322: goto L1322;
+        case 0x1324: goto L1324;
+        case 0x1328: goto L1328;
+        case 0x1330: goto L1330;
+        case 0x133c: goto L133c;
+        case 0x1350: goto L1350;
+        case 0x1356: goto L1356;
+        case 0x135a: goto L135a;
+        case 0x135e: goto L135e;
+        case 0x1364: goto L1364;
+        case 0x1368: goto L1368;
+        case 0x1376: goto L1376;
+        case 0x137e: goto L137e;
+        case 0x1386: goto L1386;
+        case 0x138c: goto L138c;
+        case 0x1396: goto L1396;
+        case 0x139c: goto L139c;
+        case 0x13c6: goto L13c6;
+        case 0x13d4: goto L13d4;
+        case 0x13d8: goto L13d8;
+        case 0x13dc: goto L13dc;
+        case 0x13de: goto L13de;
+        case 0x13e4: goto L13e4;
+        case 0x13ec: goto L13ec;
+        case 0x13f2: goto L13f2;
+        case 0x13fa: goto L13fa;
+        case 0x1402: goto L1402;
+        case 0x140a: goto L140a;
+        case 0x140e: goto L140e;
+        case 0x1414: goto L1414;
+        case 0x1416: goto L1416;
+        case 0x141c: goto L141c;
+        case 0x1422: goto L1422;
+        case 0x142c: goto L142c;
+        case 0x1432: goto L1432;
+        case 0x1436: goto L1436;
+        case 0x143a: goto L143a;
+        case 0x1446: goto L1446;
+        case 0x144a: goto L144a;
+        case 0x1456: goto L1456;
+        case 0x1460: goto L1460;
+        case 0x1466: goto L1466;
+        case 0x1472: goto L1472;
+        case 0x147e: goto L147e;
+        case 0x1484: goto L1484;
+        case 0x148a: goto L148a;
+        case 0x148e: goto L148e;
+        case 0x1492: goto L1492;
+        case 0x1498: goto L1498;
+        case 0x14a0: goto L14a0;
+        case 0x14a4: goto L14a4;
+        case 0x14a6: goto L14a6;
+        case 0x14ac: goto L14ac;
+        case 0x14b8: goto L14b8;
+        case 0x14bc: goto L14bc;
+        case 0x14be: goto L14be;
+        case 0x14c0: goto L14c0;
+        case 0x14c4: goto L14c4;
+        case 0x14c8: goto L14c8;
+        case 0x14e0: goto L14e0;
+        case 0x14e6: goto L14e6;
+        case 0x1500: goto L1500;
+        case 0x150c: goto L150c;
+        case 0x1516: goto L1516;
+        case 0x151a: goto L151a;
+        case 0x1528: goto L1528;
+        case 0x152c: goto L152c;
+        case 0x153a: goto L153a;
+        case 0x153e: goto L153e;
+        case 0x1544: goto L1544;
+        case 0x1548: goto L1548;
+        case 0x154c: goto L154c;
+        case 0x1552: goto L1552;
+        case 0x1558: goto L1558;
+        case 0x155c: goto L155c;
+        case 0x1590: goto L1590;
+        case 0x1596: goto L1596;
+        case 0x159c: goto L159c;
+        case 0x15c0: goto L15c0;
+        case 0x15c8: goto L15c8;
+        case 0x15cc: goto L15cc;
+        case 0x15d2: goto L15d2;
+        case 0x15d8: goto L15d8;
+        case 0x15de: goto L15de;
+        case 0x15e4: goto L15e4;
+        case 0x15ea: goto L15ea;
+        case 0x15f2: goto L15f2;
+        case 0x160c: goto L160c;
+        case 0x160e: goto L160e;
+        case 0x1614: goto L1614;
+        case 0x1618: goto L1618;
+        case 0x1626: goto L1626;
+        case 0x162c: goto L162c;
+        case 0x1634: goto L1634;
+        case 0x163a: goto L163a;
+        case 0x1646: goto L1646;
+        case 0x164a: goto L164a;
+        case 0x1650: goto L1650;
+        case 0x1656: goto L1656;
+        case 0x1658: goto L1658;
+        case 0x165a: goto L165a;
+        case 0x1662: goto L1662;
+        case 0x166a: goto L166a;
+        case 0x1674: goto L1674;
+        case 0x168c: goto L168c;
+        case 0x1692: goto L1692;
+        case 0x16a2: goto L16a2;
+        case 0x16b6: goto L16b6;
+        case 0x16ba: goto L16ba;
+        case 0x16d2: goto L16d2;
+        case 0x16d6: goto L16d6;
+        case 0x16dc: goto L16dc;
+        case 0x16e2: goto L16e2;
+        case 0x16f0: goto L16f0;
+        case 0x16fa: goto L16fa;
+        case 0x1700: goto L1700;
+        case 0x1706: goto L1706;
+        case 0x170a: goto L170a;
+        case 0x170e: goto L170e;
+        case 0x1722: goto L1722;
+        case 0x1728: goto L1728;
+        case 0x172e: goto L172e;
+        case 0x1730: goto L1730;
+        case 0x1736: goto L1736;
+        case 0x173c: goto L173c;
+        case 0x174a: goto L174a;
+        case 0x1750: goto L1750;
+        case 0x1756: goto L1756;
+        case 0x175c: goto L175c;
+        case 0x176a: goto L176a;
+        case 0x1770: goto L1770;
+        case 0x1772: goto L1772;
+        case 0x1778: goto L1778;
+        case 0x177a: goto L177a;
+        case 0x177e: goto L177e;
+        case 0x1784: goto L1784;
+        case 0x1788: goto L1788;
+        case 0x1794: goto L1794;
+        case 0x1798: goto L1798;
+        case 0x179c: goto L179c;
+        case 0x17a0: goto L17a0;
+        case 0x17a2: goto L17a2;
+        case 0x17a6: goto L17a6;
+        case 0x17aa: goto L17aa;
+        case 0x17ae: goto L17ae;
+        case 0x17b0: goto L17b0;
+        case 0x17b4: goto L17b4;
+        case 0x17b8: goto L17b8;
+        case 0x17bc: goto L17bc;
+        case 0x17be: goto L17be;
+        case 0x17c2: goto L17c2;
+        case 0x17c6: goto L17c6;
+        case 0x17ca: goto L17ca;
+        case 0x17cc: goto L17cc;
+        case 0x17d0: goto L17d0;
+        case 0x17d4: goto L17d4;
+        case 0x17d8: goto L17d8;
+        case 0x17da: goto L17da;
+        case 0x17de: goto L17de;
+        case 0x17e2: goto L17e2;
+        case 0x17e6: goto L17e6;
+        case 0x17e8: goto L17e8;
+        case 0x17ec: goto L17ec;
+        case 0x17f0: goto L17f0;
+        case 0x17f4: goto L17f4;
+        case 0x17f6: goto L17f6;
+        case 0x17fa: goto L17fa;
+        case 0x17fe: goto L17fe;
+        case 0x1802: goto L1802;
+        case 0x1804: goto L1804;
+        case 0x1808: goto L1808;
+        case 0x180c: goto L180c;
+        case 0x1810: goto L1810;
+        case 0x1812: goto L1812;
+        case 0x1816: goto L1816;
+        case 0x181a: goto L181a;
+        case 0x181e: goto L181e;
+        case 0x1822: goto L1822;
+        case 0x1828: goto L1828;
+        case 0x182e: goto L182e;
+        case 0x1832: goto L1832;
+        case 0x1836: goto L1836;
+        case 0x1848: goto L1848;
+        case 0x184e: goto L184e;
+        case 0x1852: goto L1852;
+        case 0x1856: goto L1856;
+        case 0x185a: goto L185a;
+        case 0x185c: goto L185c;
+        case 0x1860: goto L1860;
+        case 0x1864: goto L1864;
+        case 0x1866: goto L1866;
+        case 0x186a: goto L186a;
+        case 0x187e: goto L187e;
+        case 0x188c: goto L188c;
+        case 0x1890: goto L1890;
+        case 0x189c: goto L189c;
+        case 0x18a2: goto L18a2;
+        case 0x18a6: goto L18a6;
+        case 0x18b4: goto L18b4;
+        case 0x18b8: goto L18b8;
+        case 0x18be: goto L18be;
+        case 0x18c2: goto L18c2;
+        case 0x18c6: goto L18c6;
+        case 0x18c8: goto L18c8;
+        case 0x18cc: goto L18cc;
+        case 0x18da: goto L18da;
+        case 0x18e0: goto L18e0;
+        case 0x18e6: goto L18e6;
+        case 0x18ee: goto L18ee;
+        case 0x18f2: goto L18f2;
+        case 0x18f6: goto L18f6;
+        case 0x18f8: goto L18f8;
+        case 0x1900: goto L1900;
+        case 0x1906: goto L1906;
+        case 0x190c: goto L190c;
+        case 0x1910: goto L1910;
+        case 0x1916: goto L1916;
+        case 0x191a: goto L191a;
+        case 0x192e: goto L192e;
+        case 0x1934: goto L1934;
+        case 0x193e: goto L193e;
+        case 0x1944: goto L1944;
+        case 0x1946: goto L1946;
+        case 0x194a: goto L194a;
+        case 0x195a: goto L195a;
+        case 0x1962: goto L1962;
+        case 0x1966: goto L1966;
+        case 0x1974: goto L1974;
+        case 0x1978: goto L1978;
+        case 0x197c: goto L197c;
+        case 0x1986: goto L1986;
+        case 0x198a: goto L198a;
+        case 0x198e: goto L198e;
+        case 0x1990: goto L1990;
+        case 0x1994: goto L1994;
+        case 0x199c: goto L199c;
+        case 0x199e: goto L199e;
+        case 0x19a2: goto L19a2;
+        case 0x19a4: goto L19a4;
+        case 0x19b0: goto L19b0;
+        case 0x19b4: goto L19b4;
+        case 0x19be: goto L19be;
+        case 0x19c2: goto L19c2;
+        case 0x19c4: goto L19c4;
+        case 0x19c8: goto L19c8;
+        case 0x19cc: goto L19cc;
+        case 0x19d4: goto L19d4;
+        case 0x19d8: goto L19d8;
+        case 0x19dc: goto L19dc;
+        case 0x19e0: goto L19e0;
+        case 0x19e6: goto L19e6;
+        case 0x19ea: goto L19ea;
+        case 0x19ee: goto L19ee;
+        case 0x19f4: goto L19f4;
+        case 0x19f8: goto L19f8;
+        case 0x19fe: goto L19fe;
+        case 0x1a00: goto L1a00;
+        case 0x1a06: goto L1a06;
+        case 0x1a0a: goto L1a0a;
+        case 0x1a1a: goto L1a1a;
+        case 0x1a1e: goto L1a1e;
+        case 0x1a22: goto L1a22;
+        case 0x1a2e: goto L1a2e;
+        case 0x1a30: goto L1a30;
+        case 0x1a3c: goto L1a3c;
+        case 0x1a3e: goto L1a3e;
+        case 0x1a48: goto L1a48;
+        case 0x1a50: goto L1a50;
+        case 0x1a60: goto L1a60;
+        case 0x1a66: goto L1a66;
+        case 0x1a6a: goto L1a6a;
+        case 0x1a6c: goto L1a6c;
+        case 0x1a70: goto L1a70;
+        case 0x1a76: goto L1a76;
+        case 0x1a78: goto L1a78;
+        case 0x1a7c: goto L1a7c;
+        case 0x1a80: goto L1a80;
+        case 0x1a84: goto L1a84;
+        case 0x1a86: goto L1a86;
+        case 0x1a8e: goto L1a8e;
+        case 0x1a94: goto L1a94;
+        case 0x1aa6: goto L1aa6;
+        case 0x1aaa: goto L1aaa;
+        case 0x1ab0: goto L1ab0;
+        case 0x1abc: goto L1abc;
+        case 0x1ac2: goto L1ac2;
+        case 0x1acc: goto L1acc;
+        case 0x1ad6: goto L1ad6;
+        case 0x1ada: goto L1ada;
+        case 0x1ade: goto L1ade;
+        case 0x1ae4: goto L1ae4;
+        case 0x1aee: goto L1aee;
+        case 0x1af2: goto L1af2;
+        case 0x1afa: goto L1afa;
+        case 0x1b02: goto L1b02;
+        case 0x1b06: goto L1b06;
+        case 0x1b0c: goto L1b0c;
+        case 0x1b1a: goto L1b1a;
+        case 0x1b1c: goto L1b1c;
+        case 0x1b1e: goto L1b1e;
+        case 0x1b20: goto L1b20;
+        case 0x1b22: goto L1b22;
+        case 0x1b24: goto L1b24;
+        case 0x1b26: goto L1b26;
+        case 0x1b34: goto L1b34;
+        case 0x1b3a: goto L1b3a;
+        case 0x1b3c: goto L1b3c;
+        case 0x1b46: goto L1b46;
+        case 0x1b52: goto L1b52;
+        case 0x1b54: goto L1b54;
+        case 0x1b56: goto L1b56;
+        case 0x1b58: goto L1b58;
+        case 0x1b5a: goto L1b5a;
+        case 0x1b5c: goto L1b5c;
+        case 0x1b62: goto L1b62;
+        case 0x1b70: goto L1b70;
+        case 0x1b7e: goto L1b7e;
+        case 0x1b90: goto L1b90;
+        case 0x1b92: goto L1b92;
+        case 0x1b94: goto L1b94;
+        case 0x1b96: goto L1b96;
+        case 0x1b98: goto L1b98;
+        case 0x1b9c: goto L1b9c;
+        case 0x1ba6: goto L1ba6;
+        case 0x1ba8: goto L1ba8;
+        case 0x1baa: goto L1baa;
+        case 0x1bac: goto L1bac;
+        case 0x1bae: goto L1bae;
+        case 0x1bb0: goto L1bb0;
+        case 0x1bc2: goto L1bc2;
+        case 0x1bc4: goto L1bc4;
+        case 0x1bc6: goto L1bc6;
+        case 0x1bc8: goto L1bc8;
+        case 0x1bca: goto L1bca;
+        case 0x1bce: goto L1bce;
+        case 0x1bde: goto L1bde;
+        case 0x1be0: goto L1be0;
+        case 0x1be2: goto L1be2;
+        case 0x1be4: goto L1be4;
+        case 0x1be6: goto L1be6;
+        case 0x1be8: goto L1be8;
+        case 0x1bfc: goto L1bfc;
+        case 0x1bfe: goto L1bfe;
+        case 0x1c00: goto L1c00;
+        case 0x1c02: goto L1c02;
+        case 0x1c04: goto L1c04;
+        case 0x1c06: goto L1c06;
+        case 0x1c08: goto L1c08;
+        case 0x1c0a: goto L1c0a;
+        case 0x1c10: goto L1c10;
+        case 0x1c16: goto L1c16;
+        case 0x1c2c: goto L1c2c;
+        case 0x1c2e: goto L1c2e;
+        case 0x1c30: goto L1c30;
+        case 0x1c32: goto L1c32;
+        case 0x1c34: goto L1c34;
+        case 0x1c42: goto L1c42;
+        case 0x1c4c: goto L1c4c;
+        case 0x1c4e: goto L1c4e;
+        case 0x1c50: goto L1c50;
+        case 0x1c52: goto L1c52;
+        case 0x1c54: goto L1c54;
+        case 0x1c5e: goto L1c5e;
+        case 0x1c62: goto L1c62;
+        case 0x1c68: goto L1c68;
+        case 0x1c6e: goto L1c6e;
+        case 0x1c74: goto L1c74;
+        case 0x1c7a: goto L1c7a;
+        case 0x1c80: goto L1c80;
+        case 0x1c86: goto L1c86;
+        case 0x1c8c: goto L1c8c;
+        case 0x1c96: goto L1c96;
+        case 0x1c9e: goto L1c9e;
+        case 0x1cb2: goto L1cb2;
+        case 0x1cb8: goto L1cb8;
+        case 0x1cc6: goto L1cc6;
+        case 0x1cd4: goto L1cd4;
+        case 0x1ce4: goto L1ce4;
+        case 0x1ce6: goto L1ce6;
+        case 0x1cf2: goto L1cf2;
+        case 0x1cf6: goto L1cf6;
+        case 0x1cfa: goto L1cfa;
+        case 0x1cfe: goto L1cfe;
+        case 0x1d26: goto L1d26;
+        case 0x1d2a: goto L1d2a;
+        case 0x1d2e: goto L1d2e;
+        case 0x1d32: goto L1d32;
+        case 0x1d36: goto L1d36;
+        case 0x1d48: goto L1d48;
+        case 0x1d4a: goto L1d4a;
+        case 0x1d68: goto L1d68;
+        case 0x1d6a: goto L1d6a;
+        case 0x1d6c: goto L1d6c;
+        case 0x1d6e: goto L1d6e;
+        case 0x1d70: goto L1d70;
+        case 0x1d72: goto L1d72;
+        case 0x1d7c: goto L1d7c;
+        case 0x1d7e: goto L1d7e;
+        case 0x1d9a: goto L1d9a;
+        case 0x1da2: goto L1da2;
+        case 0x1db0: goto L1db0;
+        case 0x1db2: goto L1db2;
+        case 0x1db4: goto L1db4;
+        case 0x1db6: goto L1db6;
+        case 0x1db8: goto L1db8;
+        case 0x1dba: goto L1dba;
+        case 0x1dbc: goto L1dbc;
+        case 0x1dbe: goto L1dbe;
+        case 0x1dc0: goto L1dc0;
+        case 0x1dc2: goto L1dc2;
+        case 0x1dc4: goto L1dc4;
+        case 0x1dc6: goto L1dc6;
+        case 0x1dc8: goto L1dc8;
+        case 0x1dca: goto L1dca;
+        case 0x1dcc: goto L1dcc;
+        case 0x1dce: goto L1dce;
+        case 0x1dd0: goto L1dd0;
+        case 0x1dd2: goto L1dd2;
+        case 0x1dd4: goto L1dd4;
+        case 0x1dd6: goto L1dd6;
+        case 0x1dd8: goto L1dd8;
+        case 0x1dda: goto L1dda;
+        case 0x1ddc: goto L1ddc;
+        case 0x1dde: goto L1dde;
+        case 0x1de0: goto L1de0;
+        case 0x1de2: goto L1de2;
+        case 0x1de4: goto L1de4;
+        case 0x1de6: goto L1de6;
+        case 0x1de8: goto L1de8;
+        case 0x1dea: goto L1dea;
+        case 0x1dec: goto L1dec;
+        case 0x1dee: goto L1dee;
+        case 0x1df0: goto L1df0;
+        case 0x1df2: goto L1df2;
+        case 0x1e04: goto L1e04;
+        case 0x1e2c: goto L1e2c;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: setd
+    AOT_GOTO(0x0002, L0002);
+L0002:
+    AOT_BLOCK(0x0002, 1);
+    // 0002: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0004, L0004);
+L0004:
+    AOT_BLOCK(0x0004, 3);
+    // 0004: mov (r0), -(sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0006: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0008: mov r0, 2(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x000c, L000c);
+L000c:
+    AOT_BLOCK(0x000c, 1);
+    // 000c: jsr pc, 0018
+    {
+        a = 0x0018;
+        r[6] -= 2;
+        WR16(r[6], 0x0010);
+    }
+    AOT_GOTO(0x0018, L0018);
+L0010:
+    AOT_BLOCK(0x0010, 1);
+    // 0010: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0012, L0012);
+L0012:
+    AOT_BLOCK(0x0012, 1);
+    // 0012: jsr pc, *$1c42
+    {
+        a = 0x1c42;
+        r[6] -= 2;
+        WR16(r[6], 0x0016);
+    }
+    AOT_GOTO(0x1c42, L1c42);
+L0016:
+    // 0016: sys 1
+    AOT_INTERP(0x0016);
+L0018:
+    AOT_BLOCK(0x0018, 2);
+    // 0018: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x001c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x001c, L001c);
+L001a:
+    AOT_BLOCK(0x001a, 1);
+    // 001a: mov be6(r2), *(r4)+
+    {
+        a = uint16_t(r[2] + 3046);
+        src = RD16(a);
+        b = RD16(r[4]);
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x001e, L001e);
+L001c:
+    AOT_BLOCK(0x001c, 1);
+    // 001c: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x001e, L001e);
+L001e:
+    AOT_BLOCK(0x001e, 1);
+    // 001e: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0024, L0024);
+L0020:
+    // 0020: wait
+    AOT_INTERP(0x0020);
+L0022:
+    // 0022: iot
+    AOT_INTERP(0x0022);
+L0024:
+    AOT_BLOCK(0x0024, 1);
+    // 0024: bge 0040
+    if (!(N ^ V))
+        AOT_GOTO(0x0040, L0040);
+    AOT_GOTO(0x0026, L0026);
+L0026:
+    AOT_BLOCK(0x0026, 1);
+    // 0026: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x002a, L002a);
+L002a:
+    AOT_BLOCK(0x002a, 1);
+    // 002a: cmpb $2b, *2(r0)
+    {
+        src = uint8_t(0x2b);
+        b = RD16(r[0] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    AOT_GOTO(0x0030, L0030);
+L0030:
+    AOT_BLOCK(0x0030, 1);
+    // 0030: bne 0040
+    if (!Z)
+        AOT_GOTO(0x0040, L0040);
+    AOT_GOTO(0x0032, L0032);
+L0032:
+    AOT_BLOCK(0x0032, 3);
+    // 0032: dec 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0036: add $2, 6(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 003c: inc 23c0
+    {
+        a = 0x23c0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0040, L0040);
+L0040:
+    AOT_BLOCK(0x0040, 2);
+    // 0040: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0046: bge 0062
+    if (!(N ^ V))
+        AOT_GOTO(0x0062, L0062);
+    AOT_GOTO(0x0048, L0048);
+L0048:
+    AOT_BLOCK(0x0048, 3);
+    // 0048: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 004c: cmpb $2d, *2(r0)
+    {
+        src = uint8_t(0x2d);
+        b = RD16(r[0] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0052: bne 0062
+    if (!Z)
+        AOT_GOTO(0x0062, L0062);
+    AOT_GOTO(0x0054, L0054);
+L0054:
+    AOT_BLOCK(0x0054, 3);
+    // 0054: dec 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0058: add $2, 6(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 005e: inc -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0062, L0062);
+L0062:
+    AOT_BLOCK(0x0062, 2);
+    // 0062: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0068: bge 009c
+    if (!(N ^ V))
+        AOT_GOTO(0x009c, L009c);
+    AOT_GOTO(0x006a, L006a);
+L006a:
+    AOT_BLOCK(0x006a, 1);
+    // 006a: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x006c, L006c);
+L006c:
+    AOT_BLOCK(0x006c, 1);
+    // 006c: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0070, L0070);
+L0070:
+    AOT_BLOCK(0x0070, 1);
+    // 0070: mov 2(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0074, L0074);
+L0074:
+    AOT_BLOCK(0x0074, 1);
+    // 0074: jsr pc, *$1bb0
+    {
+        a = 0x1bb0;
+        r[6] -= 2;
+        WR16(r[6], 0x0078);
+    }
+    AOT_GOTO(0x1bb0, L1bb0);
+L0078:
+    AOT_BLOCK(0x0078, 3);
+    // 0078: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 007a: mov r0, 2566
+    {
+        src = r[0];
+        b = 0x2566;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 007e: bge 009a
+    if (!(N ^ V))
+        AOT_GOTO(0x009a, L009a);
+    AOT_GOTO(0x0080, L0080);
+L0080:
+    AOT_BLOCK(0x0080, 4);
+    // 0080: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0084: mov 2(r0), (sp)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0088: mov $1ed3, -(sp)
+    {
+        src = uint16_t(0x1ed3);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 008c: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0090);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0090:
+    AOT_BLOCK(0x0090, 3);
+    // 0090: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0092: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0096: jsr pc, *$1c42
+    {
+        a = 0x1c42;
+        r[6] -= 2;
+        WR16(r[6], 0x009a);
+    }
+    AOT_GOTO(0x1c42, L1c42);
+L009a:
+    AOT_BLOCK(0x009a, 1);
+    // 009a: br 00a6
+    AOT_GOTO(0x00a6, L00a6);
+L009c:
+    AOT_BLOCK(0x009c, 2);
+    // 009c: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 009e: jsr pc, *$1b9c
+    {
+        a = 0x1b9c;
+        r[6] -= 2;
+        WR16(r[6], 0x00a2);
+    }
+    AOT_GOTO(0x1b9c, L1b9c);
+L00a2:
+    AOT_BLOCK(0x00a2, 1);
+    // 00a2: mov r0, 2566
+    {
+        src = r[0];
+        b = 0x2566;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00a6, L00a6);
+L00a6:
+    AOT_BLOCK(0x00a6, 2);
+    // 00a6: cmp $2, 4(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00ac: bge 00e8
+    if (!(N ^ V))
+        AOT_GOTO(0x00e8, L00e8);
+    AOT_GOTO(0x00ae, L00ae);
+L00ae:
+    AOT_BLOCK(0x00ae, 4);
+    // 00ae: mov $1b6, (sp)
+    {
+        src = uint16_t(0x01b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00b2: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00b6: mov 4(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00ba: jsr pc, *$1b7e
+    {
+        a = 0x1b7e;
+        r[6] -= 2;
+        WR16(r[6], 0x00be);
+    }
+    AOT_GOTO(0x1b7e, L1b7e);
+L00be:
+    AOT_BLOCK(0x00be, 3);
+    // 00be: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 00c0: mov r0, 28fc
+    {
+        src = r[0];
+        b = 0x28fc;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00c4: bge 00e6
+    if (!(N ^ V))
+        AOT_GOTO(0x00e6, L00e6);
+    AOT_GOTO(0x00c6, L00c6);
+L00c6:
+    AOT_BLOCK(0x00c6, 5);
+    // 00c6: mov $1, 28fc
+    {
+        src = uint16_t(0x0001);
+        b = 0x28fc;
+        WR16(b, src);
+    }
+    // 00cc: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00d0: mov 4(r0), (sp)
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00d4: mov $1ee6, -(sp)
+    {
+        src = uint16_t(0x1ee6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00d8: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x00dc);
+    }
+    AOT_GOTO(0x191a, L191a);
+L00dc:
+    AOT_BLOCK(0x00dc, 3);
+    // 00dc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 00de: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00e2: jsr pc, *$1c42
+    {
+        a = 0x1c42;
+        r[6] -= 2;
+        WR16(r[6], 0x00e6);
+    }
+    AOT_GOTO(0x1c42, L1c42);
+L00e6:
+    AOT_BLOCK(0x00e6, 1);
+    // 00e6: br 00f4
+    AOT_GOTO(0x00f4, L00f4);
+L00e8:
+    AOT_BLOCK(0x00e8, 2);
+    // 00e8: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00ec: jsr pc, *$1b9c
+    {
+        a = 0x1b9c;
+        r[6] -= 2;
+        WR16(r[6], 0x00f0);
+    }
+    AOT_GOTO(0x1b9c, L1b9c);
+L00f0:
+    AOT_BLOCK(0x00f0, 1);
+    // 00f0: mov r0, 28fc
+    {
+        src = r[0];
+        b = 0x28fc;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00f4, L00f4);
+L00f4:
+    AOT_BLOCK(0x00f4, 2);
+    // 00f4: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00f8: jsr pc, *$1bce
+    {
+        a = 0x1bce;
+        r[6] -= 2;
+        WR16(r[6], 0x00fc);
+    }
+    AOT_GOTO(0x1bce, L1bce);
+L00fc:
+    AOT_BLOCK(0x00fc, 5);
+    // 00fc: mov r0, 23c4
+    {
+        src = r[0];
+        b = 0x23c4;
+        WR16(b, src);
+    }
+    // 0100: mov r0, 23c6
+    {
+        src = r[0];
+        b = 0x23c6;
+        WR16(b, src);
+    }
+    // 0104: mov r0, 23c2
+    {
+        src = r[0];
+        b = 0x23c2;
+        WR16(b, src);
+    }
+    // 0108: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 010a: jsr pc, 05ca
+    {
+        a = 0x05ca;
+        r[6] -= 2;
+        WR16(r[6], 0x010e);
+    }
+    AOT_GOTO(0x05ca, L05ca);
+L010e:
+    AOT_BLOCK(0x010e, 1);
+    // 010e: jsr pc, 0286
+    {
+        a = 0x0286;
+        r[6] -= 2;
+        WR16(r[6], 0x0112);
+    }
+    AOT_GOTO(0x0286, L0286);
+L0112:
+    AOT_BLOCK(0x0112, 2);
+    // 0112: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0114: jsr pc, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], 0x0118);
+    }
+    AOT_GOTO(0x151a, L151a);
+L0118:
+    AOT_BLOCK(0x0118, 1);
+    // 0118: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x011a, L011a);
+L011a:
+    AOT_BLOCK(0x011a, 1);
+    // 011a: jsr pc, 0704
+    {
+        a = 0x0704;
+        r[6] -= 2;
+        WR16(r[6], 0x011e);
+    }
+    AOT_GOTO(0x0704, L0704);
+L011e:
+    AOT_BLOCK(0x011e, 1);
+    // 011e: jsr pc, 07f2
+    {
+        a = 0x07f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0122);
+    }
+    AOT_GOTO(0x07f2, L07f2);
+L0122:
+    AOT_BLOCK(0x0122, 1);
+    // 0122: jsr pc, 11c6
+    {
+        a = 0x11c6;
+        r[6] -= 2;
+        WR16(r[6], 0x0126);
+    }
+    AOT_GOTO(0x11c6, L11c6);
+L0126:
+    AOT_BLOCK(0x0126, 3);
+    // 0126: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 0128: tst 23be
+    {
+        a = 0x23be;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 012c: bne 011e
+    if (!Z)
+        AOT_GOTO(0x011e, L011e);
+    AOT_GOTO(0x012e, L012e);
+L012e:
+    AOT_BLOCK(0x012e, 1);
+    // 012e: jsr pc, 0c00
+    {
+        a = 0x0c00;
+        r[6] -= 2;
+        WR16(r[6], 0x0132);
+    }
+    AOT_GOTO(0x0c00, L0c00);
+L0132:
+    AOT_BLOCK(0x0132, 1);
+    // 0132: jsr pc, 0cbe
+    {
+        a = 0x0cbe;
+        r[6] -= 2;
+        WR16(r[6], 0x0136);
+    }
+    AOT_GOTO(0x0cbe, L0cbe);
+L0136:
+    AOT_BLOCK(0x0136, 2);
+    // 0136: tst 23be
+    {
+        a = 0x23be;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 013a: bne 011a
+    if (!Z)
+        AOT_GOTO(0x011a, L011a);
+    AOT_GOTO(0x013c, L013c);
+L013c:
+    AOT_BLOCK(0x013c, 1);
+    // 013c: jsr pc, 0f94
+    {
+        a = 0x0f94;
+        r[6] -= 2;
+        WR16(r[6], 0x0140);
+    }
+    AOT_GOTO(0x0f94, L0f94);
+L0140:
+    AOT_BLOCK(0x0140, 2);
+    // 0140: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0142: bne 011a
+    if (!Z)
+        AOT_GOTO(0x011a, L011a);
+    AOT_GOTO(0x0144, L0144);
+L0144:
+    AOT_BLOCK(0x0144, 1);
+    // 0144: jsr pc, 103c
+    {
+        a = 0x103c;
+        r[6] -= 2;
+        WR16(r[6], 0x0148);
+    }
+    AOT_GOTO(0x103c, L103c);
+L0148:
+    AOT_BLOCK(0x0148, 1);
+    // 0148: jsr pc, 03e4
+    {
+        a = 0x03e4;
+        r[6] -= 2;
+        WR16(r[6], 0x014c);
+    }
+    AOT_GOTO(0x03e4, L03e4);
+L014c:
+    AOT_BLOCK(0x014c, 2);
+    // 014c: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 014e: bge 0152
+    if (!(N ^ V))
+        AOT_GOTO(0x0152, L0152);
+    AOT_GOTO(0x0150, L0150);
+L0150:
+    AOT_BLOCK(0x0150, 1);
+    // 0150: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0152, L0152);
+L0152:
+    AOT_BLOCK(0x0152, 3);
+    // 0152: mov 23c6, 23c2
+    {
+        a = 0x23c6;
+        src = RD16(a);
+        b = 0x23c2;
+        WR16(b, src);
+    }
+    // 0158: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 015a: bne 010e
+    if (!Z)
+        AOT_GOTO(0x010e, L010e);
+    AOT_GOTO(0x015c, L015c);
+L015c:
+    AOT_BLOCK(0x015c, 1);
+    // 015c: jsr pc, 1afa
+    {
+        a = 0x1afa;
+        r[6] -= 2;
+        WR16(r[6], 0x0160);
+    }
+    AOT_GOTO(0x1afa, L1afa);
+L0160:
+    AOT_BLOCK(0x0160, 3);
+    // 0160: mov $2, 28fc
+    {
+        src = uint16_t(0x0002);
+        b = 0x28fc;
+        WR16(b, src);
+    }
+    // 0166: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 016a: bne 0170
+    if (!Z)
+        AOT_GOTO(0x0170, L0170);
+    AOT_GOTO(0x016c, L016c);
+L016c:
+    AOT_BLOCK(0x016c, 1);
+    // 016c: jmp *$027c
+    {
+        a = 0x027c;
+    }
+    AOT_GOTO(0x027c, L027c);
+L0170:
+    AOT_BLOCK(0x0170, 3);
+    // 0170: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0172: mov $1efb, -(sp)
+    {
+        src = uint16_t(0x1efb);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0176: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x017a);
+    }
+    AOT_GOTO(0x191a, L191a);
+L017a:
+    AOT_BLOCK(0x017a, 4);
+    // 017a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 017c: mov 239e, (sp)
+    {
+        a = 0x239e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0180: mov $1f0a, -(sp)
+    {
+        src = uint16_t(0x1f0a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0184: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0188);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0188:
+    AOT_BLOCK(0x0188, 4);
+    // 0188: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 018a: mov 23a4, (sp)
+    {
+        a = 0x23a4;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 018e: mov $1f1d, -(sp)
+    {
+        src = uint16_t(0x1f1d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0192: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0196);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0196:
+    AOT_BLOCK(0x0196, 4);
+    // 0196: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0198: mov 23a6, (sp)
+    {
+        a = 0x23a6;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 019c: mov $1f33, -(sp)
+    {
+        src = uint16_t(0x1f33);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01a0: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x01a4);
+    }
+    AOT_GOTO(0x191a, L191a);
+L01a4:
+    AOT_BLOCK(0x01a4, 4);
+    // 01a4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 01a6: mov 23a8, (sp)
+    {
+        a = 0x23a8;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01aa: mov $1f44, -(sp)
+    {
+        src = uint16_t(0x1f44);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01ae: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x01b2);
+    }
+    AOT_GOTO(0x191a, L191a);
+L01b2:
+    AOT_BLOCK(0x01b2, 4);
+    // 01b2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 01b4: mov 23aa, (sp)
+    {
+        a = 0x23aa;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01b8: mov $1f59, -(sp)
+    {
+        src = uint16_t(0x1f59);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01bc: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x01c0);
+    }
+    AOT_GOTO(0x191a, L191a);
+L01c0:
+    AOT_BLOCK(0x01c0, 4);
+    // 01c0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 01c2: mov 23ac, (sp)
+    {
+        a = 0x23ac;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01c6: mov $1f69, -(sp)
+    {
+        src = uint16_t(0x1f69);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01ca: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x01ce);
+    }
+    AOT_GOTO(0x191a, L191a);
+L01ce:
+    AOT_BLOCK(0x01ce, 4);
+    // 01ce: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 01d0: mov 23ae, (sp)
+    {
+        a = 0x23ae;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01d4: mov $1f7a, -(sp)
+    {
+        src = uint16_t(0x1f7a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01d8: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x01dc);
+    }
+    AOT_GOTO(0x191a, L191a);
+L01dc:
+    AOT_BLOCK(0x01dc, 4);
+    // 01dc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 01de: mov 23a2, (sp)
+    {
+        a = 0x23a2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01e2: mov $1f90, -(sp)
+    {
+        src = uint16_t(0x1f90);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01e6: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x01ea);
+    }
+    AOT_GOTO(0x191a, L191a);
+L01ea:
+    AOT_BLOCK(0x01ea, 4);
+    // 01ea: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 01ec: mov 23a0, (sp)
+    {
+        a = 0x23a0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01f0: mov $1fa4, -(sp)
+    {
+        src = uint16_t(0x1fa4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01f4: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x01f8);
+    }
+    AOT_GOTO(0x191a, L191a);
+L01f8:
+    AOT_BLOCK(0x01f8, 3);
+    // 01f8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 01fa: mov 23b0, (sp)
+    {
+        a = 0x23b0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01fe: mov $1fbd, -(sp)
+    {
+        src = uint16_t(0x1fbd);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0202, L0202);
+L0202:
+    AOT_BLOCK(0x0202, 1);
+    // 0202: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0206);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0206:
+    AOT_BLOCK(0x0206, 4);
+    // 0206: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0208: mov 23b2, (sp)
+    {
+        a = 0x23b2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 020c: mov $1fd0, -(sp)
+    {
+        src = uint16_t(0x1fd0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0210: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0214);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0214:
+    AOT_BLOCK(0x0214, 4);
+    // 0214: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0216: mov 23b6, (sp)
+    {
+        a = 0x23b6;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 021a: mov $1fe4, -(sp)
+    {
+        src = uint16_t(0x1fe4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 021e: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0222);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0222:
+    AOT_BLOCK(0x0222, 4);
+    // 0222: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0224: mov 23b4, (sp)
+    {
+        a = 0x23b4;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0228: mov $2001, -(sp)
+    {
+        src = uint16_t(0x2001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 022c: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0230);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0230:
+    AOT_BLOCK(0x0230, 4);
+    // 0230: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0232: mov 23b8, (sp)
+    {
+        a = 0x23b8;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0236: mov $2016, -(sp)
+    {
+        src = uint16_t(0x2016);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 023a: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x023e);
+    }
+    AOT_GOTO(0x191a, L191a);
+L023e:
+    AOT_BLOCK(0x023e, 4);
+    // 023e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0240: mov 23ba, (sp)
+    {
+        a = 0x23ba;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0244: mov $2026, -(sp)
+    {
+        src = uint16_t(0x2026);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0248: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x024c);
+    }
+    AOT_GOTO(0x191a, L191a);
+L024c:
+    AOT_BLOCK(0x024c, 4);
+    // 024c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 024e: mov 23bc, (sp)
+    {
+        a = 0x23bc;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0252: mov $203a, -(sp)
+    {
+        src = uint16_t(0x203a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0256: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x025a);
+    }
+    AOT_GOTO(0x191a, L191a);
+L025a:
+    AOT_BLOCK(0x025a, 8);
+    // 025a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 025c: mov 23c4, r0
+    {
+        a = 0x23c4;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0260: add $3ff, r0
+    {
+        src = uint16_t(0x03ff);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0264: ash $fff6, r0
+    {
+        src = uint16_t(0xfff6) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0268: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 026a: bic $ffc0, (sp)
+    {
+        src = uint16_t(0xffc0);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 026e: mov $2052, -(sp)
+    {
+        src = uint16_t(0x2052);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0272: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0276);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0276:
+    AOT_BLOCK(0x0276, 2);
+    // 0276: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0278: jsr pc, 1afa
+    {
+        a = 0x1afa;
+        r[6] -= 2;
+        WR16(r[6], 0x027c);
+    }
+    AOT_GOTO(0x1afa, L1afa);
+L027c:
+    AOT_BLOCK(0x027c, 2);
+    // 027c: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 027e: jsr pc, *$1c42
+    {
+        a = 0x1c42;
+        r[6] -= 2;
+        WR16(r[6], 0x0282);
+    }
+    AOT_GOTO(0x1c42, L1c42);
+L0282:
+    AOT_BLOCK(0x0282, 2);
+    // 0282: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0286:
+    AOT_BLOCK(0x0286, 3);
+    // 0286: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x028a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 028a: mov $238e, r3
+    {
+        src = uint16_t(0x238e);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x028e, L028e);
+L028e:
+    AOT_BLOCK(0x028e, 1);
+    // 028e: jsr pc, 0370
+    {
+        a = 0x0370;
+        r[6] -= 2;
+        WR16(r[6], 0x0292);
+    }
+    AOT_GOTO(0x0370, L0370);
+L0292:
+    AOT_BLOCK(0x0292, 3);
+    // 0292: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0294: movb r2, r0
+    {
+        src = uint8_t(r[2]);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0296: br 0332
+    AOT_GOTO(0x0332, L0332);
+L0298:
+    AOT_BLOCK(0x0298, 2);
+    // 0298: mov $e, (sp)
+    {
+        src = uint16_t(0x000e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 029c: jsr pc, *$116e
+    {
+        a = 0x116e;
+        r[6] -= 2;
+        WR16(r[6], 0x02a0);
+    }
+    AOT_GOTO(0x116e, L116e);
+L02a0:
+    AOT_BLOCK(0x02a0, 3);
+    // 02a0: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 02a2: cmpb $4c, 218e
+    {
+        src = uint8_t(0x4c);
+        b = 0x218e;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 02a8: bne 02c0
+    if (!Z)
+        AOT_GOTO(0x02c0, L02c0);
+    AOT_GOTO(0x02aa, L02aa);
+L02aa:
+    AOT_BLOCK(0x02aa, 3);
+    // 02aa: mov $4, (r4)
+    {
+        src = uint16_t(0x0004);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 02ae: mov $218f, (sp)
+    {
+        src = uint16_t(0x218f);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02b2: jsr pc, *$03ac
+    {
+        a = 0x03ac;
+        r[6] -= 2;
+        WR16(r[6], 0x02b6);
+    }
+    AOT_GOTO(0x03ac, L03ac);
+L02b6:
+    AOT_BLOCK(0x02b6, 3);
+    // 02b6: mov r0, 8(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 02ba: clr a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 02be: br 02d4
+    AOT_GOTO(0x02d4, L02d4);
+L02c0:
+    AOT_BLOCK(0x02c0, 4);
+    // 02c0: mov $5, (r4)
+    {
+        src = uint16_t(0x0005);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 02c4: clr 8(r4)
+    {
+        a = uint16_t(r[4] + 8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 02c8: mov $218e, (sp)
+    {
+        src = uint16_t(0x218e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02cc: jsr pc, *$055e
+    {
+        a = 0x055e;
+        r[6] -= 2;
+        WR16(r[6], 0x02d0);
+    }
+    AOT_GOTO(0x055e, L055e);
+L02d0:
+    AOT_BLOCK(0x02d0, 1);
+    // 02d0: mov r0, a(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x02d4, L02d4);
+L02d4:
+    AOT_BLOCK(0x02d4, 1);
+    // 02d4: br 0342
+    AOT_GOTO(0x0342, L0342);
+L02d6:
+    AOT_BLOCK(0x02d6, 2);
+    // 02d6: mov $e, (sp)
+    {
+        src = uint16_t(0x000e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02da: jsr pc, *$116e
+    {
+        a = 0x116e;
+        r[6] -= 2;
+        WR16(r[6], 0x02de);
+    }
+    AOT_GOTO(0x116e, L116e);
+L02de:
+    AOT_BLOCK(0x02de, 4);
+    // 02de: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 02e0: mov r2, (r4)
+    {
+        src = r[2];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 02e2: cmpb $4c, *239c
+    {
+        src = uint8_t(0x4c);
+        b = RD16(0x239c);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 02e8: bne 0300
+    if (!Z)
+        AOT_GOTO(0x0300, L0300);
+    AOT_GOTO(0x02ea, L02ea);
+L02ea:
+    AOT_BLOCK(0x02ea, 3);
+    // 02ea: mov 239c, (sp)
+    {
+        a = 0x239c;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02ee: inc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 02f0: jsr pc, *$03ac
+    {
+        a = 0x03ac;
+        r[6] -= 2;
+        WR16(r[6], 0x02f4);
+    }
+    AOT_GOTO(0x03ac, L03ac);
+L02f4:
+    AOT_BLOCK(0x02f4, 2);
+    // 02f4: mov r0, 8(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02f8: beq 0300
+    if (Z)
+        AOT_GOTO(0x0300, L0300);
+    AOT_GOTO(0x02fa, L02fa);
+L02fa:
+    AOT_BLOCK(0x02fa, 2);
+    // 02fa: clr a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 02fe: br 0310
+    AOT_GOTO(0x0310, L0310);
+L0300:
+    AOT_BLOCK(0x0300, 3);
+    // 0300: clr 8(r4)
+    {
+        a = uint16_t(r[4] + 8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0304: mov 239c, (sp)
+    {
+        a = 0x239c;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0308: jsr pc, *$055e
+    {
+        a = 0x055e;
+        r[6] -= 2;
+        WR16(r[6], 0x030c);
+    }
+    AOT_GOTO(0x055e, L055e);
+L030c:
+    AOT_BLOCK(0x030c, 1);
+    // 030c: mov r0, a(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0310, L0310);
+L0310:
+    AOT_BLOCK(0x0310, 1);
+    // 0310: br 0342
+    AOT_GOTO(0x0342, L0342);
+L0312:
+    AOT_BLOCK(0x0312, 2);
+    // 0312: mov $e, (sp)
+    {
+        src = uint16_t(0x000e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0316: jsr pc, *$116e
+    {
+        a = 0x116e;
+        r[6] -= 2;
+        WR16(r[6], 0x031a);
+    }
+    AOT_GOTO(0x116e, L116e);
+L031a:
+    AOT_BLOCK(0x031a, 5);
+    // 031a: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 031c: mov r2, (r4)
+    {
+        src = r[2];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 031e: clr 8(r4)
+    {
+        a = uint16_t(r[4] + 8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0322: mov 239c, (sp)
+    {
+        a = 0x239c;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0326: jsr pc, *$055e
+    {
+        a = 0x055e;
+        r[6] -= 2;
+        WR16(r[6], 0x032a);
+    }
+    AOT_GOTO(0x055e, L055e);
+L032a:
+    AOT_BLOCK(0x032a, 2);
+    // 032a: mov r0, a(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 032e: br 0342
+    AOT_GOTO(0x0342, L0342);
+L0332:
+    AOT_BLOCK(0x0332, 3);
+    // 0332: sub $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0336: cmp r0, $8
+    {
+        src = r[0];
+        dst = uint16_t(0x0008);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 033a: bhi 0312
+    if (!(C | Z))
+        AOT_GOTO(0x0312, L0312);
+    AOT_GOTO(0x033c, L033c);
+L033c:
+    AOT_BLOCK(0x033c, 2);
+    // 033c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 033e: jmp *1dbe(r0)
+    {
+        a = RD16(r[0] + 7614);
+    }
+    AOT_JUMP(a);
+L0342:
+    AOT_BLOCK(0x0342, 7);
+    // 0342: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+    }
+    // 0346: mov r3, 4(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 034a: mov r4, 2(r3)
+    {
+        src = r[4];
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+    }
+    // 034e: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 0350: clr 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        WR16(a, 0);
+    }
+    // 0354: cmp $7, r2
+    {
+        src = uint16_t(0x0007);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0358: bne 0360
+    if (!Z)
+        AOT_GOTO(0x0360, L0360);
+    AOT_GOTO(0x035a, L035a);
+L035a:
+    AOT_BLOCK(0x035a, 2);
+    // 035a: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 035e: br 036c
+    AOT_GOTO(0x036c, L036c);
+L0360:
+    AOT_BLOCK(0x0360, 2);
+    // 0360: cmp $30, r2
+    {
+        src = uint16_t(0x0030);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0364: bne 036a
+    if (!Z)
+        AOT_GOTO(0x036a, L036a);
+    AOT_GOTO(0x0366, L0366);
+L0366:
+    AOT_BLOCK(0x0366, 2);
+    // 0366: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0368: br 036c
+    AOT_GOTO(0x036c, L036c);
+L036a:
+    AOT_BLOCK(0x036a, 1);
+    // 036a: br 028e
+    AOT_GOTO(0x028e, L028e);
+L036c:
+    AOT_BLOCK(0x036c, 2);
+    // 036c: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0370:
+    AOT_BLOCK(0x0370, 3);
+    // 0370: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0374;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0374: mov $218e, r4
+    {
+        src = uint16_t(0x218e);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0378, L0378);
+L0378:
+    AOT_BLOCK(0x0378, 1);
+    // 0378: jsr pc, 1b3c
+    {
+        a = 0x1b3c;
+        r[6] -= 2;
+        WR16(r[6], 0x037c);
+    }
+    AOT_GOTO(0x1b3c, L1b3c);
+L037c:
+    AOT_BLOCK(0x037c, 2);
+    // 037c: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 037e: beq 03a0
+    if (Z)
+        AOT_GOTO(0x03a0, L03a0);
+    AOT_GOTO(0x0380, L0380);
+L0380:
+    AOT_BLOCK(0x0380, 2);
+    // 0380: cmp $3a, r3
+    {
+        src = uint16_t(0x003a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0384: bne 038e
+    if (!Z)
+        AOT_GOTO(0x038e, L038e);
+    AOT_GOTO(0x0386, L0386);
+L0386:
+    AOT_BLOCK(0x0386, 3);
+    // 0386: clrb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        WR8(a, 0);
+        C = false;
+    }
+    // 0388: mov $4, r0
+    {
+        src = uint16_t(0x0004);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 038c: br 03a8
+    AOT_GOTO(0x03a8, L03a8);
+L038e:
+    AOT_BLOCK(0x038e, 2);
+    // 038e: cmp $a, r3
+    {
+        src = uint16_t(0x000a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0392: bne 039c
+    if (!Z)
+        AOT_GOTO(0x039c, L039c);
+    AOT_GOTO(0x0394, L0394);
+L0394:
+    AOT_BLOCK(0x0394, 2);
+    // 0394: clrb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0396: jsr pc, 061a
+    {
+        a = 0x061a;
+        r[6] -= 2;
+        WR16(r[6], 0x039a);
+    }
+    AOT_GOTO(0x061a, L061a);
+L039a:
+    AOT_BLOCK(0x039a, 1);
+    // 039a: br 03a8
+    AOT_GOTO(0x03a8, L03a8);
+L039c:
+    AOT_BLOCK(0x039c, 2);
+    // 039c: movb r3, (r4)+
+    {
+        src = uint8_t(r[3]);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 039e: br 0378
+    AOT_GOTO(0x0378, L0378);
+L03a0:
+    AOT_BLOCK(0x03a0, 3);
+    // 03a0: clrb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        WR8(a, 0);
+        C = false;
+    }
+    // 03a2: mov $30, r0
+    {
+        src = uint16_t(0x0030);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03a6: br 03a8
+    AOT_GOTO(0x03a8, L03a8);
+L03a8:
+    AOT_BLOCK(0x03a8, 2);
+    // 03a8: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L03ac:
+    AOT_BLOCK(0x03ac, 4);
+    // 03ac: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x03b0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 03b0: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 03b4: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x03b6, L03b6);
+L03b6:
+    AOT_BLOCK(0x03b6, 3);
+    // 03b6: movb (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+    }
+    // 03b8: cmp $30, r2
+    {
+        src = uint16_t(0x0030);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03bc: bgt 03d4
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x03d4, L03d4);
+    AOT_GOTO(0x03be, L03be);
+L03be:
+    AOT_BLOCK(0x03be, 2);
+    // 03be: cmp $39, r2
+    {
+        src = uint16_t(0x0039);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03c2: blt 03d4
+    if (N ^ V)
+        AOT_GOTO(0x03d4, L03d4);
+    AOT_GOTO(0x03c4, L03c4);
+L03c4:
+    AOT_BLOCK(0x03c4, 6);
+    // 03c4: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 03c6: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 03ca: mov r1, r3
+    {
+        src = r[1];
+        r[3] = src;
+    }
+    // 03cc: add r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 03ce: add $ffd0, r3
+    {
+        src = uint16_t(0xffd0);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 03d2: br 03b6
+    AOT_GOTO(0x03b6, L03b6);
+L03d4:
+    AOT_BLOCK(0x03d4, 2);
+    // 03d4: tstb -(r4)
+    {
+        r[4] -= 1;
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03d6: beq 03dc
+    if (Z)
+        AOT_GOTO(0x03dc, L03dc);
+    AOT_GOTO(0x03d8, L03d8);
+L03d8:
+    AOT_BLOCK(0x03d8, 2);
+    // 03d8: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 03da: br 03e0
+    AOT_GOTO(0x03e0, L03e0);
+L03dc:
+    AOT_BLOCK(0x03dc, 2);
+    // 03dc: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03de: br 03e0
+    AOT_GOTO(0x03e0, L03e0);
+L03e0:
+    AOT_BLOCK(0x03e0, 2);
+    // 03e0: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L03e4:
+    AOT_BLOCK(0x03e4, 3);
+    // 03e4: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x03e8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 03e8: mov $238e, r4
+    {
+        src = uint16_t(0x238e);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03ec, L03ec);
+L03ec:
+    AOT_BLOCK(0x03ec, 2);
+    // 03ec: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03f0: bne 03f6
+    if (!Z)
+        AOT_GOTO(0x03f6, L03f6);
+    AOT_GOTO(0x03f2, L03f2);
+L03f2:
+    AOT_BLOCK(0x03f2, 1);
+    // 03f2: jmp *$04f8
+    {
+        a = 0x04f8;
+    }
+    AOT_GOTO(0x04f8, L04f8);
+L03f6:
+    AOT_BLOCK(0x03f6, 2);
+    // 03f6: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 03f8: jmp *$04e4
+    {
+        a = 0x04e4;
+    }
+    AOT_GOTO(0x04e4, L04e4);
+L03fc:
+    AOT_BLOCK(0x03fc, 1);
+    // 03fc: jmp *$04f8
+    {
+        a = 0x04f8;
+    }
+    AOT_GOTO(0x04f8, L04f8);
+L0400:
+    AOT_BLOCK(0x0400, 3);
+    // 0400: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0404: mov $205c, -(sp)
+    {
+        src = uint16_t(0x205c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0408: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x040c);
+    }
+    AOT_GOTO(0x191a, L191a);
+L040c:
+    AOT_BLOCK(0x040c, 2);
+    // 040c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 040e: br 03ec
+    AOT_GOTO(0x03ec, L03ec);
+L0410:
+    AOT_BLOCK(0x0410, 3);
+    // 0410: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0414: mov $2061, -(sp)
+    {
+        src = uint16_t(0x2061);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0418: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x041c);
+    }
+    AOT_GOTO(0x191a, L191a);
+L041c:
+    AOT_BLOCK(0x041c, 2);
+    // 041c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 041e: br 03ec
+    AOT_GOTO(0x03ec, L03ec);
+L0420:
+    AOT_BLOCK(0x0420, 3);
+    // 0420: movb 1(r4), r2
+    {
+        a = uint16_t(r[4] + 1);
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+    }
+    // 0424: cmp $64, r2
+    {
+        src = uint16_t(0x0064);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0428: bne 042e
+    if (!Z)
+        AOT_GOTO(0x042e, L042e);
+    AOT_GOTO(0x042a, L042a);
+L042a:
+    AOT_BLOCK(0x042a, 1);
+    // 042a: clrb 1(r4)
+    {
+        a = uint16_t(r[4] + 1);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x042e, L042e);
+L042e:
+    AOT_BLOCK(0x042e, 1);
+    // 042e: mov $1ce2, r3
+    {
+        src = uint16_t(0x1ce2);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0432, L0432);
+L0432:
+    AOT_BLOCK(0x0432, 2);
+    // 0432: tst (r3)
+    {
+        a = r[3];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0434: beq 045e
+    if (Z)
+        AOT_GOTO(0x045e, L045e);
+    AOT_GOTO(0x0436, L0436);
+L0436:
+    AOT_BLOCK(0x0436, 2);
+    // 0436: cmp (r4), 2(r3)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 043a: bne 0458
+    if (!Z)
+        AOT_GOTO(0x0458, L0458);
+    AOT_GOTO(0x043c, L043c);
+L043c:
+    AOT_BLOCK(0x043c, 3);
+    // 043c: mov (r3), (sp)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 043e: mov $2065, -(sp)
+    {
+        src = uint16_t(0x2065);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0442: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0446);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0446:
+    AOT_BLOCK(0x0446, 3);
+    // 0446: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0448: cmp $64, r2
+    {
+        src = uint16_t(0x0064);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 044c: bne 0456
+    if (!Z)
+        AOT_GOTO(0x0456, L0456);
+    AOT_GOTO(0x044e, L044e);
+L044e:
+    AOT_BLOCK(0x044e, 2);
+    // 044e: mov $2068, (sp)
+    {
+        src = uint16_t(0x2068);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0452: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0456);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0456:
+    AOT_BLOCK(0x0456, 1);
+    // 0456: br 045e
+    AOT_GOTO(0x045e, L045e);
+L0458:
+    AOT_BLOCK(0x0458, 2);
+    // 0458: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 045c: br 0432
+    AOT_GOTO(0x0432, L0432);
+L045e:
+    AOT_BLOCK(0x045e, 2);
+    // 045e: tst a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0462: beq 047a
+    if (Z)
+        AOT_GOTO(0x047a, L047a);
+    AOT_GOTO(0x0464, L0464);
+L0464:
+    AOT_BLOCK(0x0464, 2);
+    // 0464: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0466: jsr pc, *$04fc
+    {
+        a = 0x04fc;
+        r[6] -= 2;
+        WR16(r[6], 0x046a);
+    }
+    AOT_GOTO(0x04fc, L04fc);
+L046a:
+    AOT_BLOCK(0x046a, 3);
+    // 046a: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 046e: mov $206a, -(sp)
+    {
+        src = uint16_t(0x206a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0472: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0476);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0476:
+    AOT_BLOCK(0x0476, 2);
+    // 0476: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0478: br 049e
+    AOT_GOTO(0x049e, L049e);
+L047a:
+    AOT_BLOCK(0x047a, 2);
+    // 047a: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 047e: beq 0486
+    if (Z)
+        AOT_GOTO(0x0486, L0486);
+    AOT_GOTO(0x0480, L0480);
+L0480:
+    AOT_BLOCK(0x0480, 2);
+    // 0480: cmpb $2, (r4)
+    {
+        src = uint8_t(0x02);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0484: bne 0496
+    if (!Z)
+        AOT_GOTO(0x0496, L0496);
+    AOT_GOTO(0x0486, L0486);
+L0486:
+    AOT_BLOCK(0x0486, 3);
+    // 0486: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 048a: mov $206f, -(sp)
+    {
+        src = uint16_t(0x206f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 048e: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0492);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0492:
+    AOT_BLOCK(0x0492, 2);
+    // 0492: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0494: br 049e
+    AOT_GOTO(0x049e, L049e);
+L0496:
+    AOT_BLOCK(0x0496, 2);
+    // 0496: mov $2075, (sp)
+    {
+        src = uint16_t(0x2075);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 049a: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x049e);
+    }
+    AOT_GOTO(0x191a, L191a);
+L049e:
+    AOT_BLOCK(0x049e, 1);
+    // 049e: br 03ec
+    AOT_GOTO(0x03ec, L03ec);
+L04a0:
+    AOT_BLOCK(0x04a0, 3);
+    // 04a0: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04a4: mov $2077, -(sp)
+    {
+        src = uint16_t(0x2077);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04a8: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x04ac);
+    }
+    AOT_GOTO(0x191a, L191a);
+L04ac:
+    AOT_BLOCK(0x04ac, 2);
+    // 04ac: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04ae: br 03ec
+    AOT_GOTO(0x03ec, L03ec);
+L04b0:
+    AOT_BLOCK(0x04b0, 4);
+    // 04b0: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04b4: mov a(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04b8: mov $207c, -(sp)
+    {
+        src = uint16_t(0x207c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04bc: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x04c0);
+    }
+    AOT_GOTO(0x191a, L191a);
+L04c0:
+    AOT_BLOCK(0x04c0, 2);
+    // 04c0: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04c2: br 03ec
+    AOT_GOTO(0x03ec, L03ec);
+L04c4:
+    AOT_BLOCK(0x04c4, 2);
+    // 04c4: tst a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04c8: beq 04d8
+    if (Z)
+        AOT_GOTO(0x04d8, L04d8);
+    AOT_GOTO(0x04ca, L04ca);
+L04ca:
+    AOT_BLOCK(0x04ca, 3);
+    // 04ca: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04ce: mov $2088, -(sp)
+    {
+        src = uint16_t(0x2088);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04d2: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x04d6);
+    }
+    AOT_GOTO(0x191a, L191a);
+L04d6:
+    AOT_BLOCK(0x04d6, 1);
+    // 04d6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x04d8, L04d8);
+L04d8:
+    AOT_BLOCK(0x04d8, 2);
+    // 04d8: mov $208b, (sp)
+    {
+        src = uint16_t(0x208b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04dc: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x04e0);
+    }
+    AOT_GOTO(0x191a, L191a);
+L04e0:
+    AOT_BLOCK(0x04e0, 1);
+    // 04e0: br 03ec
+    AOT_GOTO(0x03ec, L03ec);
+L04e4:
+    AOT_BLOCK(0x04e4, 2);
+    // 04e4: mov $1dd0, r1
+    {
+        src = uint16_t(0x1dd0);
+        r[1] = src;
+    }
+    // 04e8: mov r0, 1ddc
+    {
+        src = r[0];
+        b = 0x1ddc;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04ec, L04ec);
+L04ec:
+    AOT_BLOCK(0x04ec, 2);
+    // 04ec: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04ee: bne 04ec
+    if (!Z)
+        AOT_GOTO(0x04ec, L04ec);
+    AOT_GOTO(0x04f0, L04f0);
+L04f0:
+    AOT_BLOCK(0x04f0, 1);
+    // 04f0: jmp *c(r1)
+    {
+        a = RD16(r[1] + 12);
+    }
+    AOT_JUMP(a);
+L04f8:
+    AOT_BLOCK(0x04f8, 2);
+    // 04f8: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L04fc:
+    AOT_BLOCK(0x04fc, 3);
+    // 04fc: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0500;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0500: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0502, L0502);
+L0502:
+    AOT_BLOCK(0x0502, 3);
+    // 0502: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0506: cmpb $24, *a(r2)
+    {
+        src = uint8_t(0x24);
+        b = RD16(r[2] + 10);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 050c: bne 055a
+    if (!Z)
+        AOT_GOTO(0x055a, L055a);
+    AOT_GOTO(0x050e, L050e);
+L050e:
+    AOT_BLOCK(0x050e, 1);
+    // 050e: mov a(r2), r4
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0512, L0512);
+L0512:
+    AOT_BLOCK(0x0512, 2);
+    // 0512: cmpb $2c, (r4)
+    {
+        src = uint8_t(0x2c);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0516: beq 051e
+    if (Z)
+        AOT_GOTO(0x051e, L051e);
+    AOT_GOTO(0x0518, L0518);
+L0518:
+    AOT_BLOCK(0x0518, 2);
+    // 0518: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 051a: beq 055a
+    if (Z)
+        AOT_GOTO(0x055a, L055a);
+    AOT_GOTO(0x051c, L051c);
+L051c:
+    AOT_BLOCK(0x051c, 1);
+    // 051c: br 0512
+    AOT_GOTO(0x0512, L0512);
+L051e:
+    AOT_BLOCK(0x051e, 4);
+    // 051e: mov r4, -8(r5)
+    {
+        src = r[4];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0522: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 0524: cmpb $2a, (r4)
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0528: bne 052c
+    if (!Z)
+        AOT_GOTO(0x052c, L052c);
+    AOT_GOTO(0x052a, L052a);
+L052a:
+    AOT_BLOCK(0x052a, 1);
+    // 052a: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x052c, L052c);
+L052c:
+    AOT_BLOCK(0x052c, 2);
+    // 052c: mov a(r2), r3
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0530: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0532, L0532);
+L0532:
+    AOT_BLOCK(0x0532, 2);
+    // 0532: cmpb (r3)+, (r4)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0534: bne 0538
+    if (!Z)
+        AOT_GOTO(0x0538, L0538);
+    AOT_GOTO(0x0536, L0536);
+L0536:
+    AOT_BLOCK(0x0536, 1);
+    // 0536: br 0532
+    AOT_GOTO(0x0532, L0532);
+L0538:
+    AOT_BLOCK(0x0538, 2);
+    // 0538: cmpb $28, -(r4)
+    {
+        src = uint8_t(0x28);
+        r[4] -= 1;
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 053c: bne 055a
+    if (!Z)
+        AOT_GOTO(0x055a, L055a);
+    AOT_GOTO(0x053e, L053e);
+L053e:
+    AOT_BLOCK(0x053e, 2);
+    // 053e: cmpb $2c, -(r3)
+    {
+        src = uint8_t(0x2c);
+        r[3] -= 1;
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0542: bne 055a
+    if (!Z)
+        AOT_GOTO(0x055a, L055a);
+    AOT_GOTO(0x0544, L0544);
+L0544:
+    AOT_BLOCK(0x0544, 3);
+    // 0544: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0548: mov $208d, -(sp)
+    {
+        src = uint16_t(0x208d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 054c: jsr pc, *$055e
+    {
+        a = 0x055e;
+        r[6] -= 2;
+        WR16(r[6], 0x0550);
+    }
+    AOT_GOTO(0x055e, L055e);
+L0550:
+    AOT_BLOCK(0x0550, 3);
+    // 0550: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0552: mov r0, a(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 10);
+        WR16(b, src);
+    }
+    // 0556: inc 23bc
+    {
+        a = 0x23bc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x055a, L055a);
+L055a:
+    AOT_BLOCK(0x055a, 2);
+    // 055a: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L055e:
+    AOT_BLOCK(0x055e, 4);
+    // 055e: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0562;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0562: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 0566: jsr pc, 1c4c
+    {
+        a = 0x1c4c;
+        r[6] -= 2;
+        WR16(r[6], 0x056a);
+    }
+    AOT_GOTO(0x1c4c, L1c4c);
+L056a:
+    AOT_BLOCK(0x056a, 5);
+    // 056a: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 056e: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0572: clr r2
+    {
+        r[2] = 0;
+    }
+    // 0574: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0576: bne 057c
+    if (!Z)
+        AOT_GOTO(0x057c, L057c);
+    AOT_GOTO(0x0578, L0578);
+L0578:
+    AOT_BLOCK(0x0578, 2);
+    // 0578: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 057a: br 05c6
+    AOT_GOTO(0x05c6, L05c6);
+L057c:
+    AOT_BLOCK(0x057c, 3);
+    // 057c: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 057e: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0580: bne 057c
+    if (!Z)
+        AOT_GOTO(0x057c, L057c);
+    AOT_GOTO(0x0582, L0582);
+L0582:
+    AOT_BLOCK(0x0582, 2);
+    // 0582: cmp $1, -a(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0588: bge 0596
+    if (!(N ^ V))
+        AOT_GOTO(0x0596, L0596);
+    AOT_GOTO(0x058a, L058a);
+L058a:
+    AOT_BLOCK(0x058a, 1);
+    // 058a: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x058e, L058e);
+L058e:
+    AOT_BLOCK(0x058e, 2);
+    // 058e: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0590: beq 0596
+    if (Z)
+        AOT_GOTO(0x0596, L0596);
+    AOT_GOTO(0x0592, L0592);
+L0592:
+    AOT_BLOCK(0x0592, 2);
+    // 0592: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0594: br 058e
+    AOT_GOTO(0x058e, L058e);
+L0596:
+    AOT_BLOCK(0x0596, 2);
+    // 0596: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0598: jsr pc, *$116e
+    {
+        a = 0x116e;
+        r[6] -= 2;
+        WR16(r[6], 0x059c);
+    }
+    AOT_GOTO(0x116e, L116e);
+L059c:
+    AOT_BLOCK(0x059c, 3);
+    // 059c: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 059e: mov r3, -8(r5)
+    {
+        src = r[3];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 05a2: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x05a6, L05a6);
+L05a6:
+    AOT_BLOCK(0x05a6, 2);
+    // 05a6: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 05a8: beq 05ac
+    if (Z)
+        AOT_GOTO(0x05ac, L05ac);
+    AOT_GOTO(0x05aa, L05aa);
+L05aa:
+    AOT_BLOCK(0x05aa, 1);
+    // 05aa: br 05a6
+    AOT_GOTO(0x05a6, L05a6);
+L05ac:
+    AOT_BLOCK(0x05ac, 2);
+    // 05ac: cmp $1, -a(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05b2: bge 05c0
+    if (!(N ^ V))
+        AOT_GOTO(0x05c0, L05c0);
+    AOT_GOTO(0x05b4, L05b4);
+L05b4:
+    AOT_BLOCK(0x05b4, 2);
+    // 05b4: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 05b8: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x05ba, L05ba);
+L05ba:
+    AOT_BLOCK(0x05ba, 2);
+    // 05ba: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 05bc: beq 05c0
+    if (Z)
+        AOT_GOTO(0x05c0, L05c0);
+    AOT_GOTO(0x05be, L05be);
+L05be:
+    AOT_BLOCK(0x05be, 1);
+    // 05be: br 05ba
+    AOT_GOTO(0x05ba, L05ba);
+L05c0:
+    AOT_BLOCK(0x05c0, 2);
+    // 05c0: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05c4: br 05c6
+    AOT_GOTO(0x05c6, L05c6);
+L05c6:
+    AOT_BLOCK(0x05c6, 2);
+    // 05c6: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L05ca:
+    AOT_BLOCK(0x05ca, 3);
+    // 05ca: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x05ce;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 05ce: mov $1ce2, r4
+    {
+        src = uint16_t(0x1ce2);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x05d2, L05d2);
+L05d2:
+    AOT_BLOCK(0x05d2, 2);
+    // 05d2: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05d4: beq 0616
+    if (Z)
+        AOT_GOTO(0x0616, L0616);
+    AOT_GOTO(0x05d6, L05d6);
+L05d6:
+    AOT_BLOCK(0x05d6, 14);
+    // 05d6: movb (r2), r0
+    {
+        a = r[2];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 05d8: ash $3, r0
+    {
+        src = uint16_t(0x0003) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 05dc: movb 1(r2), r1
+    {
+        a = uint16_t(r[2] + 1);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 05e0: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 05e2: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 05e4: movb 2(r2), r1
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 05e8: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 05ea: bic $8000, r0
+    {
+        src = uint16_t(0x8000);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 05ee: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 05f0: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 05f2: div $39, r0
+    {
+        src = int16_t(uint16_t(0x0039));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 05f6: mov r1, r3
+    {
+        src = r[1];
+        r[3] = src;
+    }
+    // 05f8: asl r3
+    {
+        src = r[3];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[3] = val;
+    }
+    // 05fa: add $24f4, r3
+    {
+        src = uint16_t(0x24f4);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x05fe, L05fe);
+L05fe:
+    AOT_BLOCK(0x05fe, 2);
+    // 05fe: tst (r3)+
+    {
+        a = r[3];
+        r[3] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0600: beq 060e
+    if (Z)
+        AOT_GOTO(0x060e, L060e);
+    AOT_GOTO(0x0602, L0602);
+L0602:
+    AOT_BLOCK(0x0602, 2);
+    // 0602: cmp $2566, r3
+    {
+        src = uint16_t(0x2566);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0606: bcc 060c
+    if (!C)
+        AOT_GOTO(0x060c, L060c);
+    AOT_GOTO(0x0608, L0608);
+L0608:
+    AOT_BLOCK(0x0608, 1);
+    // 0608: mov $24f4, r3
+    {
+        src = uint16_t(0x24f4);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x060c, L060c);
+L060c:
+    AOT_BLOCK(0x060c, 1);
+    // 060c: br 05fe
+    AOT_GOTO(0x05fe, L05fe);
+L060e:
+    AOT_BLOCK(0x060e, 3);
+    // 060e: mov r4, -(r3)
+    {
+        src = r[4];
+        r[3] -= 2;
+        b = r[3];
+        WR16(b, src);
+    }
+    // 0610: add $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0614: br 05d2
+    AOT_GOTO(0x05d2, L05d2);
+L0616:
+    AOT_BLOCK(0x0616, 2);
+    // 0616: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L061a:
+    AOT_BLOCK(0x061a, 5);
+    // 061a: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x061e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 061e: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0620: mov $2770, r2
+    {
+        src = uint16_t(0x2770);
+        r[2] = src;
+    }
+    // 0624: mov $218e, r3
+    {
+        src = uint16_t(0x218e);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0628, L0628);
+L0628:
+    AOT_BLOCK(0x0628, 2);
+    // 0628: tstb (r3)
+    {
+        a = r[3];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 062a: beq 063c
+    if (Z)
+        AOT_GOTO(0x063c, L063c);
+    AOT_GOTO(0x062c, L062c);
+L062c:
+    AOT_BLOCK(0x062c, 2);
+    // 062c: cmpb $20, (r3)
+    {
+        src = uint8_t(0x20);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0630: beq 063c
+    if (Z)
+        AOT_GOTO(0x063c, L063c);
+    AOT_GOTO(0x0632, L0632);
+L0632:
+    AOT_BLOCK(0x0632, 2);
+    // 0632: cmpb $9, (r3)
+    {
+        src = uint8_t(0x09);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0636: beq 063c
+    if (Z)
+        AOT_GOTO(0x063c, L063c);
+    AOT_GOTO(0x0638, L0638);
+L0638:
+    AOT_BLOCK(0x0638, 2);
+    // 0638: movb (r3)+, (r2)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 063a: br 0628
+    AOT_GOTO(0x0628, L0628);
+L063c:
+    AOT_BLOCK(0x063c, 1);
+    // 063c: clrb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x063e, L063e);
+L063e:
+    AOT_BLOCK(0x063e, 2);
+    // 063e: cmpb $9, (r3)
+    {
+        src = uint8_t(0x09);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0642: beq 064a
+    if (Z)
+        AOT_GOTO(0x064a, L064a);
+    AOT_GOTO(0x0644, L0644);
+L0644:
+    AOT_BLOCK(0x0644, 2);
+    // 0644: cmpb $20, (r3)
+    {
+        src = uint8_t(0x20);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0648: bne 064e
+    if (!Z)
+        AOT_GOTO(0x064e, L064e);
+    AOT_GOTO(0x064a, L064a);
+L064a:
+    AOT_BLOCK(0x064a, 2);
+    // 064a: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 064c: br 063e
+    AOT_GOTO(0x063e, L063e);
+L064e:
+    AOT_BLOCK(0x064e, 15);
+    // 064e: mov r3, 239c
+    {
+        src = r[3];
+        b = 0x239c;
+        WR16(b, src);
+    }
+    // 0652: movb 2770, r0
+    {
+        a = 0x2770;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0656: ash $3, r0
+    {
+        src = uint16_t(0x0003) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 065a: movb 2771, r1
+    {
+        a = 0x2771;
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 065e: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0660: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0662: movb 2772, r1
+    {
+        a = 0x2772;
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 0666: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0668: bic $8000, r0
+    {
+        src = uint16_t(0x8000);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 066c: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 066e: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0670: div $39, r0
+    {
+        src = int16_t(uint16_t(0x0039));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0674: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0676: add $24f4, r1
+    {
+        src = uint16_t(0x24f4);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 067a: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x067e, L067e);
+L067e:
+    AOT_BLOCK(0x067e, 2);
+    // 067e: mov *-8(r5), r4
+    {
+        a = RD16(r[5] + -8);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0682: beq 06c8
+    if (Z)
+        AOT_GOTO(0x06c8, L06c8);
+    AOT_GOTO(0x0684, L0684);
+L0684:
+    AOT_BLOCK(0x0684, 2);
+    // 0684: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0686: mov $2770, r3
+    {
+        src = uint16_t(0x2770);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x068a, L068a);
+L068a:
+    AOT_BLOCK(0x068a, 2);
+    // 068a: cmpb (r3), (r2)+
+    {
+        a = r[3];
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 068c: bne 069a
+    if (!Z)
+        AOT_GOTO(0x069a, L069a);
+    AOT_GOTO(0x068e, L068e);
+L068e:
+    AOT_BLOCK(0x068e, 2);
+    // 068e: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0690: bne 0698
+    if (!Z)
+        AOT_GOTO(0x0698, L0698);
+    AOT_GOTO(0x0692, L0692);
+L0692:
+    AOT_BLOCK(0x0692, 2);
+    // 0692: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0696: br 0700
+    AOT_GOTO(0x0700, L0700);
+L0698:
+    AOT_BLOCK(0x0698, 1);
+    // 0698: br 068a
+    AOT_GOTO(0x068a, L068a);
+L069a:
+    AOT_BLOCK(0x069a, 2);
+    // 069a: cmpb $62, (r3)+
+    {
+        src = uint8_t(0x62);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 069e: bne 06b2
+    if (!Z)
+        AOT_GOTO(0x06b2, L06b2);
+    AOT_GOTO(0x06a0, L06a0);
+L06a0:
+    AOT_BLOCK(0x06a0, 2);
+    // 06a0: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06a2: bne 06b2
+    if (!Z)
+        AOT_GOTO(0x06b2, L06b2);
+    AOT_GOTO(0x06a4, L06a4);
+L06a4:
+    AOT_BLOCK(0x06a4, 2);
+    // 06a4: tstb -(r2)
+    {
+        r[2] -= 1;
+        a = r[2];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06a6: bne 06b2
+    if (!Z)
+        AOT_GOTO(0x06b2, L06b2);
+    AOT_GOTO(0x06a8, L06a8);
+L06a8:
+    AOT_BLOCK(0x06a8, 3);
+    // 06a8: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 06ac: add $6400, r0
+    {
+        src = uint16_t(0x6400);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 06b0: br 0700
+    AOT_GOTO(0x0700, L0700);
+L06b2:
+    AOT_BLOCK(0x06b2, 3);
+    // 06b2: add $2, -8(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 06b8: cmp $2566, -8(r5)
+    {
+        src = uint16_t(0x2566);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06be: bhi 06c6
+    if (!(C | Z))
+        AOT_GOTO(0x06c6, L06c6);
+    AOT_GOTO(0x06c0, L06c0);
+L06c0:
+    AOT_BLOCK(0x06c0, 1);
+    // 06c0: mov $24f4, -8(r5)
+    {
+        src = uint16_t(0x24f4);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x06c6, L06c6);
+L06c6:
+    AOT_BLOCK(0x06c6, 1);
+    // 06c6: br 067e
+    AOT_GOTO(0x067e, L067e);
+L06c8:
+    AOT_BLOCK(0x06c8, 2);
+    // 06c8: cmpb $4c, 218e
+    {
+        src = uint8_t(0x4c);
+        b = 0x218e;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 06ce: bne 06f6
+    if (!Z)
+        AOT_GOTO(0x06f6, L06f6);
+    AOT_GOTO(0x06d0, L06d0);
+L06d0:
+    AOT_BLOCK(0x06d0, 1);
+    // 06d0: mov $218f, r3
+    {
+        src = uint16_t(0x218f);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x06d4, L06d4);
+L06d4:
+    AOT_BLOCK(0x06d4, 2);
+    // 06d4: tstb (r3)
+    {
+        a = r[3];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06d6: beq 06ea
+    if (Z)
+        AOT_GOTO(0x06ea, L06ea);
+    AOT_GOTO(0x06d8, L06d8);
+L06d8:
+    AOT_BLOCK(0x06d8, 2);
+    // 06d8: cmpb $30, (r3)
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 06dc: bgt 06e4
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x06e4, L06e4);
+    AOT_GOTO(0x06de, L06de);
+L06de:
+    AOT_BLOCK(0x06de, 2);
+    // 06de: cmpb $39, (r3)+
+    {
+        src = uint8_t(0x39);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 06e2: bge 06e8
+    if (!(N ^ V))
+        AOT_GOTO(0x06e8, L06e8);
+    AOT_GOTO(0x06e4, L06e4);
+L06e4:
+    AOT_BLOCK(0x06e4, 2);
+    // 06e4: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 06e6: br 0700
+    AOT_GOTO(0x0700, L0700);
+L06e8:
+    AOT_BLOCK(0x06e8, 1);
+    // 06e8: br 06d4
+    AOT_GOTO(0x06d4, L06d4);
+L06ea:
+    AOT_BLOCK(0x06ea, 3);
+    // 06ea: mov $218e, 239c
+    {
+        src = uint16_t(0x218e);
+        b = 0x239c;
+        WR16(b, src);
+    }
+    // 06f0: mov $9, r0
+    {
+        src = uint16_t(0x0009);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06f4: br 0700
+    AOT_GOTO(0x0700, L0700);
+L06f6:
+    AOT_BLOCK(0x06f6, 3);
+    // 06f6: mov $218e, 239c
+    {
+        src = uint16_t(0x218e);
+        b = 0x239c;
+        WR16(b, src);
+    }
+    // 06fc: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 06fe: br 0700
+    AOT_GOTO(0x0700, L0700);
+L0700:
+    AOT_BLOCK(0x0700, 2);
+    // 0700: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0704:
+    AOT_BLOCK(0x0704, 3);
+    // 0704: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0708;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0708: mov $2790, r2
+    {
+        src = uint16_t(0x2790);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x070c, L070c);
+L070c:
+    AOT_BLOCK(0x070c, 2);
+    // 070c: cmp $288e, r2
+    {
+        src = uint16_t(0x288e);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0710: blos 0716
+    if (C | Z)
+        AOT_GOTO(0x0716, L0716);
+    AOT_GOTO(0x0712, L0712);
+L0712:
+    AOT_BLOCK(0x0712, 2);
+    // 0712: clr (r2)+
+    {
+        a = r[2];
+        r[2] += 2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0714: br 070c
+    AOT_GOTO(0x070c, L070c);
+L0716:
+    AOT_BLOCK(0x0716, 1);
+    // 0716: mov 2390, r4
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x071a, L071a);
+L071a:
+    AOT_BLOCK(0x071a, 2);
+    // 071a: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 071c: beq 073e
+    if (Z)
+        AOT_GOTO(0x073e, L073e);
+    AOT_GOTO(0x071e, L071e);
+L071e:
+    AOT_BLOCK(0x071e, 2);
+    // 071e: cmpb $4, (r4)
+    {
+        src = uint8_t(0x04);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0722: bne 0738
+    if (!Z)
+        AOT_GOTO(0x0738, L0738);
+    AOT_GOTO(0x0724, L0724);
+L0724:
+    AOT_BLOCK(0x0724, 6);
+    // 0724: mov 8(r4), r1
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 0728: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 072a: div $7f, r0
+    {
+        src = int16_t(uint16_t(0x007f));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 072e: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0730: mov r4, 2790(r1)
+    {
+        src = r[4];
+        b = uint16_t(r[1] + 10128);
+        WR16(b, src);
+    }
+    // 0734: clr c(r4)
+    {
+        a = uint16_t(r[4] + 12);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0738, L0738);
+L0738:
+    AOT_BLOCK(0x0738, 2);
+    // 0738: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 073c: br 071a
+    AOT_GOTO(0x071a, L071a);
+L073e:
+    AOT_BLOCK(0x073e, 1);
+    // 073e: mov 2390, r4
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0742, L0742);
+L0742:
+    AOT_BLOCK(0x0742, 2);
+    // 0742: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0744: beq 07bc
+    if (Z)
+        AOT_GOTO(0x07bc, L07bc);
+    AOT_GOTO(0x0746, L0746);
+L0746:
+    AOT_BLOCK(0x0746, 2);
+    // 0746: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 074a: beq 0758
+    if (Z)
+        AOT_GOTO(0x0758, L0758);
+    AOT_GOTO(0x074c, L074c);
+L074c:
+    AOT_BLOCK(0x074c, 2);
+    // 074c: cmpb $2, (r4)
+    {
+        src = uint8_t(0x02);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0750: beq 0758
+    if (Z)
+        AOT_GOTO(0x0758, L0758);
+    AOT_GOTO(0x0752, L0752);
+L0752:
+    AOT_BLOCK(0x0752, 2);
+    // 0752: cmpb $9, (r4)
+    {
+        src = uint8_t(0x09);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0756: bne 07b6
+    if (!Z)
+        AOT_GOTO(0x07b6, L07b6);
+    AOT_GOTO(0x0758, L0758);
+L0758:
+    AOT_BLOCK(0x0758, 8);
+    // 0758: clr 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        WR16(a, 0);
+    }
+    // 075c: mov 8(r4), r1
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 0760: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0762: div $7f, r0
+    {
+        src = int16_t(uint16_t(0x007f));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0766: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0768: mov 2790(r1), r3
+    {
+        a = uint16_t(r[1] + 10128);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 076c: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 076e: beq 0778
+    if (Z)
+        AOT_GOTO(0x0778, L0778);
+    AOT_GOTO(0x0770, L0770);
+L0770:
+    AOT_BLOCK(0x0770, 2);
+    // 0770: cmp 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0776: beq 0794
+    if (Z)
+        AOT_GOTO(0x0794, L0794);
+    AOT_GOTO(0x0778, L0778);
+L0778:
+    AOT_BLOCK(0x0778, 1);
+    // 0778: mov 2390, r3
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x077c, L077c);
+L077c:
+    AOT_BLOCK(0x077c, 2);
+    // 077c: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 077e: beq 0794
+    if (Z)
+        AOT_GOTO(0x0794, L0794);
+    AOT_GOTO(0x0780, L0780);
+L0780:
+    AOT_BLOCK(0x0780, 2);
+    // 0780: cmpb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0784: bne 078e
+    if (!Z)
+        AOT_GOTO(0x078e, L078e);
+    AOT_GOTO(0x0786, L0786);
+L0786:
+    AOT_BLOCK(0x0786, 2);
+    // 0786: cmp 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 078c: beq 0794
+    if (Z)
+        AOT_GOTO(0x0794, L0794);
+    AOT_GOTO(0x078e, L078e);
+L078e:
+    AOT_BLOCK(0x078e, 2);
+    // 078e: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0792: br 077c
+    AOT_GOTO(0x077c, L077c);
+L0794:
+    AOT_BLOCK(0x0794, 2);
+    // 0794: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0796: beq 07b6
+    if (Z)
+        AOT_GOTO(0x07b6, L07b6);
+    AOT_GOTO(0x0798, L0798);
+L0798:
+    AOT_BLOCK(0x0798, 2);
+    // 0798: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 079a: jsr pc, *$114e
+    {
+        a = 0x114e;
+        r[6] -= 2;
+        WR16(r[6], 0x079e);
+    }
+    AOT_GOTO(0x114e, L114e);
+L079e:
+    AOT_BLOCK(0x079e, 3);
+    // 079e: mov 4(r0), r2
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 07a2: cmp r3, r2
+    {
+        src = r[3];
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07a4: beq 07ae
+    if (Z)
+        AOT_GOTO(0x07ae, L07ae);
+    AOT_GOTO(0x07a6, L07a6);
+L07a6:
+    AOT_BLOCK(0x07a6, 2);
+    // 07a6: mov 8(r2), 8(r4)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 07ac: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x07ae, L07ae);
+L07ae:
+    AOT_BLOCK(0x07ae, 2);
+    // 07ae: mov r3, 6(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 07b2: inc c(r3)
+    {
+        a = uint16_t(r[3] + 12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x07b6, L07b6);
+L07b6:
+    AOT_BLOCK(0x07b6, 2);
+    // 07b6: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07ba: br 0742
+    AOT_GOTO(0x0742, L0742);
+L07bc:
+    AOT_BLOCK(0x07bc, 1);
+    // 07bc: mov 2390, r4
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x07c0, L07c0);
+L07c0:
+    AOT_BLOCK(0x07c0, 2);
+    // 07c0: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07c2: beq 07ee
+    if (Z)
+        AOT_GOTO(0x07ee, L07ee);
+    AOT_GOTO(0x07c4, L07c4);
+L07c4:
+    AOT_BLOCK(0x07c4, 2);
+    // 07c4: cmpb $4, (r4)
+    {
+        src = uint8_t(0x04);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 07c8: bne 07e8
+    if (!Z)
+        AOT_GOTO(0x07e8, L07e8);
+    AOT_GOTO(0x07ca, L07ca);
+L07ca:
+    AOT_BLOCK(0x07ca, 2);
+    // 07ca: tst c(r4)
+    {
+        a = uint16_t(r[4] + 12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07ce: bne 07e8
+    if (!Z)
+        AOT_GOTO(0x07e8, L07e8);
+    AOT_GOTO(0x07d0, L07d0);
+L07d0:
+    AOT_BLOCK(0x07d0, 2);
+    // 07d0: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07d2: jsr pc, *$114e
+    {
+        a = 0x114e;
+        r[6] -= 2;
+        WR16(r[6], 0x07d6);
+    }
+    AOT_GOTO(0x114e, L114e);
+L07d6:
+    AOT_BLOCK(0x07d6, 3);
+    // 07d6: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 07d8: tstb (r3)
+    {
+        a = r[3];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07da: beq 07e8
+    if (Z)
+        AOT_GOTO(0x07e8, L07e8);
+    AOT_GOTO(0x07dc, L07dc);
+L07dc:
+    AOT_BLOCK(0x07dc, 2);
+    // 07dc: cmpb $9, (r3)
+    {
+        src = uint8_t(0x09);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 07e0: beq 07e8
+    if (Z)
+        AOT_GOTO(0x07e8, L07e8);
+    AOT_GOTO(0x07e2, L07e2);
+L07e2:
+    AOT_BLOCK(0x07e2, 2);
+    // 07e2: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07e4: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x07e8);
+    }
+    AOT_GOTO(0x1120, L1120);
+L07e8:
+    AOT_BLOCK(0x07e8, 2);
+    // 07e8: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07ec: br 07c0
+    AOT_GOTO(0x07c0, L07c0);
+L07ee:
+    AOT_BLOCK(0x07ee, 2);
+    // 07ee: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L07f2:
+    AOT_BLOCK(0x07f2, 4);
+    // 07f2: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x07f6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 07f6: clr 23be
+    {
+        a = 0x23be;
+        WR16(a, 0);
+        C = false;
+    }
+    // 07fa: mov 2390, r4
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x07fe, L07fe);
+L07fe:
+    AOT_BLOCK(0x07fe, 2);
+    // 07fe: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0800: bne 0806
+    if (!Z)
+        AOT_GOTO(0x0806, L0806);
+    AOT_GOTO(0x0802, L0802);
+L0802:
+    AOT_BLOCK(0x0802, 1);
+    // 0802: jmp *$0966
+    {
+        a = 0x0966;
+    }
+    AOT_GOTO(0x0966, L0966);
+L0806:
+    AOT_BLOCK(0x0806, 2);
+    // 0806: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 080a: beq 0818
+    if (Z)
+        AOT_GOTO(0x0818, L0818);
+    AOT_GOTO(0x080c, L080c);
+L080c:
+    AOT_BLOCK(0x080c, 2);
+    // 080c: cmpb $2, (r4)
+    {
+        src = uint8_t(0x02);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0810: beq 0818
+    if (Z)
+        AOT_GOTO(0x0818, L0818);
+    AOT_GOTO(0x0812, L0812);
+L0812:
+    AOT_BLOCK(0x0812, 2);
+    // 0812: cmpb $9, (r4)
+    {
+        src = uint8_t(0x09);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0816: bne 085c
+    if (!Z)
+        AOT_GOTO(0x085c, L085c);
+    AOT_GOTO(0x0818, L0818);
+L0818:
+    AOT_BLOCK(0x0818, 2);
+    // 0818: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 081c: beq 085c
+    if (Z)
+        AOT_GOTO(0x085c, L085c);
+    AOT_GOTO(0x081e, L081e);
+L081e:
+    AOT_BLOCK(0x081e, 2);
+    // 081e: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0822: jsr pc, *$114e
+    {
+        a = 0x114e;
+        r[6] -= 2;
+        WR16(r[6], 0x0826);
+    }
+    AOT_GOTO(0x114e, L114e);
+L0826:
+    AOT_BLOCK(0x0826, 3);
+    // 0826: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0828: cmpb $1, (r3)
+    {
+        src = uint8_t(0x01);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 082c: bne 085c
+    if (!Z)
+        AOT_GOTO(0x085c, L085c);
+    AOT_GOTO(0x082e, L082e);
+L082e:
+    AOT_BLOCK(0x082e, 2);
+    // 082e: tst 8(r3)
+    {
+        a = uint16_t(r[3] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0832: beq 085c
+    if (Z)
+        AOT_GOTO(0x085c, L085c);
+    AOT_GOTO(0x0834, L0834);
+L0834:
+    AOT_BLOCK(0x0834, 2);
+    // 0834: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0836: beq 085c
+    if (Z)
+        AOT_GOTO(0x085c, L085c);
+    AOT_GOTO(0x0838, L0838);
+L0838:
+    AOT_BLOCK(0x0838, 4);
+    // 0838: inc 239e
+    {
+        a = 0x239e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 083c: mov 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 0842: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0846: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x084a);
+    }
+    AOT_GOTO(0x1120, L1120);
+L084a:
+    AOT_BLOCK(0x084a, 4);
+    // 084a: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 084e: inc c(r0)
+    {
+        a = uint16_t(r[0] + 12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0852: mov 6(r3), 6(r4)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 0858: inc 23be
+    {
+        a = 0x23be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x085c, L085c);
+L085c:
+    AOT_BLOCK(0x085c, 2);
+    // 085c: cmpb $2, (r4)
+    {
+        src = uint8_t(0x02);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0860: bne 08b2
+    if (!Z)
+        AOT_GOTO(0x08b2, L08b2);
+    AOT_GOTO(0x0862, L0862);
+L0862:
+    AOT_BLOCK(0x0862, 3);
+    // 0862: mov 2(r4), r2
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0866: cmpb $1, (r2)
+    {
+        src = uint8_t(0x01);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 086a: bne 08b2
+    if (!Z)
+        AOT_GOTO(0x08b2, L08b2);
+    AOT_GOTO(0x086c, L086c);
+L086c:
+    AOT_BLOCK(0x086c, 1);
+    // 086c: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0870, L0870);
+L0870:
+    AOT_BLOCK(0x0870, 3);
+    // 0870: mov 4(r3), r3
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0874: cmpb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0878: beq 0870
+    if (Z)
+        AOT_GOTO(0x0870, L0870);
+    AOT_GOTO(0x087a, L087a);
+L087a:
+    AOT_BLOCK(0x087a, 2);
+    // 087a: cmp r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 087c: bne 08b2
+    if (!Z)
+        AOT_GOTO(0x08b2, L08b2);
+    AOT_GOTO(0x087e, L087e);
+L087e:
+    AOT_BLOCK(0x087e, 2);
+    // 087e: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0882: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x0886);
+    }
+    AOT_GOTO(0x1120, L1120);
+L0886:
+    AOT_BLOCK(0x0886, 9);
+    // 0886: mov 6(r2), 6(r4)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 088c: mov 8(r2), 8(r4)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 0892: mov 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0896: mov r4, 4(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 089a: mov 2(r2), 2(r4)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 08a0: movb 1(r4), r0
+    {
+        a = uint16_t(r[4] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 08a4: movb 1db2(r0), 1(r4)
+    {
+        a = uint16_t(r[0] + 7602);
+        src = RD8(a);
+        b = uint16_t(r[4] + 1);
+        WR8(b, src);
+    }
+    // 08aa: inc 23be
+    {
+        a = 0x23be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 08ae: inc 23b4
+    {
+        a = 0x23b4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x08b2, L08b2);
+L08b2:
+    AOT_BLOCK(0x08b2, 2);
+    // 08b2: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08b6: beq 08be
+    if (Z)
+        AOT_GOTO(0x08be, L08be);
+    AOT_GOTO(0x08b8, L08b8);
+L08b8:
+    AOT_BLOCK(0x08b8, 2);
+    // 08b8: cmpb $3, (r4)
+    {
+        src = uint8_t(0x03);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08bc: bne 095e
+    if (!Z)
+        AOT_GOTO(0x095e, L095e);
+    AOT_GOTO(0x08be, L08be);
+L08be:
+    AOT_BLOCK(0x08be, 2);
+    // 08be: tst 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08c2: beq 090e
+    if (Z)
+        AOT_GOTO(0x090e, L090e);
+    AOT_GOTO(0x08c4, L08c4);
+L08c4:
+    AOT_BLOCK(0x08c4, 2);
+    // 08c4: cmpb $4, *2(r4)
+    {
+        src = uint8_t(0x04);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08ca: beq 090e
+    if (Z)
+        AOT_GOTO(0x090e, L090e);
+    AOT_GOTO(0x08cc, L08cc);
+L08cc:
+    AOT_BLOCK(0x08cc, 2);
+    // 08cc: cmpb $7, *2(r4)
+    {
+        src = uint8_t(0x07);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08d2: beq 090e
+    if (Z)
+        AOT_GOTO(0x090e, L090e);
+    AOT_GOTO(0x08d4, L08d4);
+L08d4:
+    AOT_BLOCK(0x08d4, 2);
+    // 08d4: cmpb $30, *2(r4)
+    {
+        src = uint8_t(0x30);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08da: beq 090e
+    if (Z)
+        AOT_GOTO(0x090e, L090e);
+    AOT_GOTO(0x08dc, L08dc);
+L08dc:
+    AOT_BLOCK(0x08dc, 5);
+    // 08dc: inc 23be
+    {
+        a = 0x23be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 08e0: inc 23a4
+    {
+        a = 0x23a4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 08e4: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 08e8: tst 6(r0)
+    {
+        a = uint16_t(r[0] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08ec: beq 08fa
+    if (Z)
+        AOT_GOTO(0x08fa, L08fa);
+    AOT_GOTO(0x08ee, L08ee);
+L08ee:
+    AOT_BLOCK(0x08ee, 3);
+    // 08ee: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 08f2: mov 6(r0), (sp)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08f6: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x08fa);
+    }
+    AOT_GOTO(0x1120, L1120);
+L08fa:
+    AOT_BLOCK(0x08fa, 5);
+    // 08fa: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 08fe: mov 2(r0), 2(r4)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 0904: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0908: mov r4, 4(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 090c: br 08be
+    AOT_GOTO(0x08be, L08be);
+L090e:
+    AOT_BLOCK(0x090e, 1);
+    // 090e: mov 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0912, L0912);
+L0912:
+    AOT_BLOCK(0x0912, 2);
+    // 0912: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0914: beq 0950
+    if (Z)
+        AOT_GOTO(0x0950, L0950);
+    AOT_GOTO(0x0916, L0916);
+L0916:
+    AOT_BLOCK(0x0916, 2);
+    // 0916: cmpb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 091a: bne 0950
+    if (!Z)
+        AOT_GOTO(0x0950, L0950);
+    AOT_GOTO(0x091c, L091c);
+L091c:
+    AOT_BLOCK(0x091c, 2);
+    // 091c: cmp r3, 6(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0920: bne 094a
+    if (!Z)
+        AOT_GOTO(0x094a, L094a);
+    AOT_GOTO(0x0922, L0922);
+L0922:
+    AOT_BLOCK(0x0922, 7);
+    // 0922: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0926: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 092c: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0930: mov 4(r4), 4(r0)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0936: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 093a: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 093c: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x0940);
+    }
+    AOT_GOTO(0x1120, L1120);
+L0940:
+    AOT_BLOCK(0x0940, 3);
+    // 0940: inc 23be
+    {
+        a = 0x23be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0944: inc 23a6
+    {
+        a = 0x23a6;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0948: br 0950
+    AOT_GOTO(0x0950, L0950);
+L094a:
+    AOT_BLOCK(0x094a, 2);
+    // 094a: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 094e: br 0912
+    AOT_GOTO(0x0912, L0912);
+L0950:
+    AOT_BLOCK(0x0950, 2);
+    // 0950: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0952: jsr pc, *$096a
+    {
+        a = 0x096a;
+        r[6] -= 2;
+        WR16(r[6], 0x0956);
+    }
+    AOT_GOTO(0x096a, L096a);
+L0956:
+    AOT_BLOCK(0x0956, 2);
+    // 0956: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0958: jsr pc, *$0a52
+    {
+        a = 0x0a52;
+        r[6] -= 2;
+        WR16(r[6], 0x095c);
+    }
+    AOT_GOTO(0x0a52, L0a52);
+L095c:
+    AOT_BLOCK(0x095c, 1);
+    // 095c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x095e, L095e);
+L095e:
+    AOT_BLOCK(0x095e, 1);
+    // 095e: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0962, L0962);
+L0962:
+    AOT_BLOCK(0x0962, 1);
+    // 0962: jmp *$07fe
+    {
+        a = 0x07fe;
+    }
+    AOT_GOTO(0x07fe, L07fe);
+L0966:
+    AOT_BLOCK(0x0966, 2);
+    // 0966: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L096a:
+    AOT_BLOCK(0x096a, 8);
+    // 096a: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x096e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 096e: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 0970: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+    }
+    // 0974: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0978: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 097c: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 097e: bne 0984
+    if (!Z)
+        AOT_GOTO(0x0984, L0984);
+    AOT_GOTO(0x0980, L0980);
+L0980:
+    AOT_BLOCK(0x0980, 2);
+    // 0980: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0982: br 09e0
+    AOT_GOTO(0x09e0, L09e0);
+L0984:
+    AOT_BLOCK(0x0984, 2);
+    // 0984: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0988: beq 0992
+    if (Z)
+        AOT_GOTO(0x0992, L0992);
+    AOT_GOTO(0x098a, L098a);
+L098a:
+    AOT_BLOCK(0x098a, 2);
+    // 098a: cmpb $4, (r4)
+    {
+        src = uint8_t(0x04);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 098e: bne 0992
+    if (!Z)
+        AOT_GOTO(0x0992, L0992);
+    AOT_GOTO(0x0990, L0990);
+L0990:
+    AOT_BLOCK(0x0990, 1);
+    // 0990: br 0984
+    AOT_GOTO(0x0984, L0984);
+L0992:
+    AOT_BLOCK(0x0992, 2);
+    // 0992: mov 4(r3), r3
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0996: beq 09a0
+    if (Z)
+        AOT_GOTO(0x09a0, L09a0);
+    AOT_GOTO(0x0998, L0998);
+L0998:
+    AOT_BLOCK(0x0998, 2);
+    // 0998: cmpb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 099c: bne 09a0
+    if (!Z)
+        AOT_GOTO(0x09a0, L09a0);
+    AOT_GOTO(0x099e, L099e);
+L099e:
+    AOT_BLOCK(0x099e, 1);
+    // 099e: br 0992
+    AOT_GOTO(0x0992, L0992);
+L09a0:
+    AOT_BLOCK(0x09a0, 3);
+    // 09a0: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 09a2: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09a4: jsr pc, *$10c2
+    {
+        a = 0x10c2;
+        r[6] -= 2;
+        WR16(r[6], 0x09a8);
+    }
+    AOT_GOTO(0x10c2, L10c2);
+L09a8:
+    AOT_BLOCK(0x09a8, 3);
+    // 09a8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 09aa: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09ac: beq 09b2
+    if (Z)
+        AOT_GOTO(0x09b2, L09b2);
+    AOT_GOTO(0x09ae, L09ae);
+L09ae:
+    AOT_BLOCK(0x09ae, 2);
+    // 09ae: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09b0: bne 09b8
+    if (!Z)
+        AOT_GOTO(0x09b8, L09b8);
+    AOT_GOTO(0x09b2, L09b2);
+L09b2:
+    AOT_BLOCK(0x09b2, 2);
+    // 09b2: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09b6: br 09e0
+    AOT_GOTO(0x09e0, L09e0);
+L09b8:
+    AOT_BLOCK(0x09b8, 2);
+    // 09b8: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09ba: jsr pc, *$09e4
+    {
+        a = 0x09e4;
+        r[6] -= 2;
+        WR16(r[6], 0x09be);
+    }
+    AOT_GOTO(0x09e4, L09e4);
+L09be:
+    AOT_BLOCK(0x09be, 9);
+    // 09be: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 09c0: mov $1, (r4)
+    {
+        src = uint16_t(0x0001);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 09c4: mov r2, 6(r4)
+    {
+        src = r[2];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 09c8: mov 8(r2), 8(r4)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 09ce: clr a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        WR16(a, 0);
+        C = false;
+    }
+    // 09d2: inc -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09d6: inc 23aa
+    {
+        a = 0x23aa;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09da: inc 23be
+    {
+        a = 0x23be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 09de: br 0984
+    AOT_GOTO(0x0984, L0984);
+L09e0:
+    AOT_BLOCK(0x09e0, 2);
+    // 09e0: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L09e4:
+    AOT_BLOCK(0x09e4, 5);
+    // 09e4: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x09e8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 09e8: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 09ec: cmpb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 09f0: bne 09fa
+    if (!Z)
+        AOT_GOTO(0x09fa, L09fa);
+    AOT_GOTO(0x09f2, L09f2);
+L09f2:
+    AOT_BLOCK(0x09f2, 3);
+    // 09f2: inc c(r3)
+    {
+        a = uint16_t(r[3] + 12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09f6: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09f8: br 0a4e
+    AOT_GOTO(0x0a4e, L0a4e);
+L09fa:
+    AOT_BLOCK(0x09fa, 1);
+    // 09fa: cmpb $4, *4(r3)
+    {
+        src = uint8_t(0x04);
+        b = RD16(r[3] + 4);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    AOT_GOTO(0x0a00, L0a00);
+L0a00:
+    AOT_BLOCK(0x0a00, 1);
+    // 0a00: bne 0a0e
+    if (!Z)
+        AOT_GOTO(0x0a0e, L0a0e);
+    AOT_GOTO(0x0a02, L0a02);
+L0a02:
+    AOT_BLOCK(0x0a02, 4);
+    // 0a02: mov 4(r3), r3
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0a06: inc c(r3)
+    {
+        a = uint16_t(r[3] + 12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0a0a: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a0c: br 0a4e
+    AOT_GOTO(0x0a4e, L0a4e);
+L0a0e:
+    AOT_BLOCK(0x0a0e, 2);
+    // 0a0e: mov $e, (sp)
+    {
+        src = uint16_t(0x000e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a12: jsr pc, *$116e
+    {
+        a = 0x116e;
+        r[6] -= 2;
+        WR16(r[6], 0x0a16);
+    }
+    AOT_GOTO(0x116e, L116e);
+L0a16:
+    AOT_BLOCK(0x0a16, 14);
+    // 0a16: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0a18: mov $4, (r4)
+    {
+        src = uint16_t(0x0004);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 0a1c: mov 1dbc, 8(r4)
+    {
+        a = 0x1dbc;
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 0a22: inc 1dbc
+    {
+        a = 0x1dbc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0a26: clr 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        WR16(a, 0);
+    }
+    // 0a2a: clr a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0a2e: mov $1, c(r4)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[4] + 12);
+        WR16(b, src);
+    }
+    // 0a34: mov 4(r3), 4(r4)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 0a3a: mov r3, 2(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 0a3e: mov 4(r3), r0
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0a42: mov r4, 2(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0a46: mov r4, 4(r3)
+    {
+        src = r[4];
+        b = uint16_t(r[3] + 4);
+        WR16(b, src);
+    }
+    // 0a4a: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a4c: br 0a4e
+    AOT_GOTO(0x0a4e, L0a4e);
+L0a4e:
+    AOT_BLOCK(0x0a4e, 2);
+    // 0a4e: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a52:
+    AOT_BLOCK(0x0a52, 6);
+    // 0a52: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a56;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0a56: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0a5a: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0a5e: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a62: bne 0a6c
+    if (!Z)
+        AOT_GOTO(0x0a6c, L0a6c);
+    AOT_GOTO(0x0a64, L0a64);
+L0a64:
+    AOT_BLOCK(0x0a64, 3);
+    // 0a64: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0a68: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a6a: bne 0a72
+    if (!Z)
+        AOT_GOTO(0x0a72, L0a72);
+    AOT_GOTO(0x0a6c, L0a6c);
+L0a6c:
+    AOT_BLOCK(0x0a6c, 2);
+    // 0a6c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a6e: jmp *$0bfc
+    {
+        a = 0x0bfc;
+    }
+    AOT_GOTO(0x0bfc, L0bfc);
+L0a72:
+    AOT_BLOCK(0x0a72, 2);
+    // 0a72: cmpb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a76: bne 0a88
+    if (!Z)
+        AOT_GOTO(0x0a88, L0a88);
+    AOT_GOTO(0x0a78, L0a78);
+L0a78:
+    AOT_BLOCK(0x0a78, 3);
+    // 0a78: mov 4(r3), r3
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0a7c: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a7e: bne 0a86
+    if (!Z)
+        AOT_GOTO(0x0a86, L0a86);
+    AOT_GOTO(0x0a80, L0a80);
+L0a80:
+    AOT_BLOCK(0x0a80, 2);
+    // 0a80: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a82: jmp *$0bfc
+    {
+        a = 0x0bfc;
+    }
+    AOT_GOTO(0x0bfc, L0bfc);
+L0a86:
+    AOT_BLOCK(0x0a86, 1);
+    // 0a86: br 0a72
+    AOT_GOTO(0x0a72, L0a72);
+L0a88:
+    AOT_BLOCK(0x0a88, 2);
+    // 0a88: cmpb $1, (r3)
+    {
+        src = uint8_t(0x01);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a8c: beq 0a94
+    if (Z)
+        AOT_GOTO(0x0a94, L0a94);
+    AOT_GOTO(0x0a8e, L0a8e);
+L0a8e:
+    AOT_BLOCK(0x0a8e, 2);
+    // 0a8e: cmpb $3, (r3)
+    {
+        src = uint8_t(0x03);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a92: bne 0b0a
+    if (!Z)
+        AOT_GOTO(0x0b0a, L0b0a);
+    AOT_GOTO(0x0a94, L0a94);
+L0a94:
+    AOT_BLOCK(0x0a94, 2);
+    // 0a94: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0a98: mov 6(r4), r2
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a9c, L0a9c);
+L0a9c:
+    AOT_BLOCK(0x0a9c, 2);
+    // 0a9c: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a9e: beq 0b04
+    if (Z)
+        AOT_GOTO(0x0b04, L0b04);
+    AOT_GOTO(0x0aa0, L0aa0);
+L0aa0:
+    AOT_BLOCK(0x0aa0, 2);
+    // 0aa0: cmpb $1, (r2)
+    {
+        src = uint8_t(0x01);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0aa4: beq 0aac
+    if (Z)
+        AOT_GOTO(0x0aac, L0aac);
+    AOT_GOTO(0x0aa6, L0aa6);
+L0aa6:
+    AOT_BLOCK(0x0aa6, 2);
+    // 0aa6: cmpb $3, (r2)
+    {
+        src = uint8_t(0x03);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0aaa: bne 0afe
+    if (!Z)
+        AOT_GOTO(0x0afe, L0afe);
+    AOT_GOTO(0x0aac, L0aac);
+L0aac:
+    AOT_BLOCK(0x0aac, 2);
+    // 0aac: cmp r2, r4
+    {
+        src = r[2];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0aae: bne 0ab6
+    if (!Z)
+        AOT_GOTO(0x0ab6, L0ab6);
+    AOT_GOTO(0x0ab0, L0ab0);
+L0ab0:
+    AOT_BLOCK(0x0ab0, 2);
+    // 0ab0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ab2: jmp *$0bfc
+    {
+        a = 0x0bfc;
+    }
+    AOT_GOTO(0x0bfc, L0bfc);
+L0ab6:
+    AOT_BLOCK(0x0ab6, 14);
+    // 0ab6: inc 23ac
+    {
+        a = 0x23ac;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0aba: inc 23be
+    {
+        a = 0x23be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0abe: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0ac2: mov r3, 2(r0)
+    {
+        src = r[3];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0ac6: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0aca: mov r2, 4(r0)
+    {
+        src = r[2];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0ace: mov 4(r3), r0
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0ad2: mov 2(r2), 2(r0)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0ad8: mov 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0adc: mov 4(r3), 4(r0)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0ae2: mov 4(r4), 4(r3)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[3] + 4);
+        WR16(b, src);
+    }
+    // 0ae8: mov 2(r4), 2(r2)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 0aee: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0af2: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x0af6);
+    }
+    AOT_GOTO(0x1120, L1120);
+L0af6:
+    AOT_BLOCK(0x0af6, 2);
+    // 0af6: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0af8: jmp *$0bfc
+    {
+        a = 0x0bfc;
+    }
+    AOT_GOTO(0x0bfc, L0bfc);
+L0afe:
+    AOT_BLOCK(0x0afe, 2);
+    // 0afe: mov 2(r2), r2
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b02: br 0a9c
+    AOT_GOTO(0x0a9c, L0a9c);
+L0b04:
+    AOT_BLOCK(0x0b04, 2);
+    // 0b04: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b06: jmp *$0bfc
+    {
+        a = 0x0bfc;
+    }
+    AOT_GOTO(0x0bfc, L0bfc);
+L0b0a:
+    AOT_BLOCK(0x0b0a, 2);
+    // 0b0a: cmpb $4, *2(r4)
+    {
+        src = uint8_t(0x04);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b10: beq 0b18
+    if (Z)
+        AOT_GOTO(0x0b18, L0b18);
+    AOT_GOTO(0x0b12, L0b12);
+L0b12:
+    AOT_BLOCK(0x0b12, 2);
+    // 0b12: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b14: jmp *$0bfc
+    {
+        a = 0x0bfc;
+    }
+    AOT_GOTO(0x0bfc, L0bfc);
+L0b18:
+    AOT_BLOCK(0x0b18, 3);
+    // 0b18: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0b1c: mov r3, r2
+    {
+        src = r[3];
+        r[2] = src;
+    }
+    // 0b1e: mov $10, -c(r5)
+    {
+        src = uint16_t(0x0010);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b24, L0b24);
+L0b24:
+    AOT_BLOCK(0x0b24, 3);
+    // 0b24: mov 2(r2), r2
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0b28: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b2a: beq 0b3a
+    if (Z)
+        AOT_GOTO(0x0b3a, L0b3a);
+    AOT_GOTO(0x0b2c, L0b2c);
+L0b2c:
+    AOT_BLOCK(0x0b2c, 2);
+    // 0b2c: cmp r4, r2
+    {
+        src = r[4];
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b2e: beq 0b3a
+    if (Z)
+        AOT_GOTO(0x0b3a, L0b3a);
+    AOT_GOTO(0x0b30, L0b30);
+L0b30:
+    AOT_BLOCK(0x0b30, 3);
+    // 0b30: dec -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0b34: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b38: bne 0b3e
+    if (!Z)
+        AOT_GOTO(0x0b3e, L0b3e);
+    AOT_GOTO(0x0b3a, L0b3a);
+L0b3a:
+    AOT_BLOCK(0x0b3a, 2);
+    // 0b3a: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b3c: br 0bfc
+    AOT_GOTO(0x0bfc, L0bfc);
+L0b3e:
+    AOT_BLOCK(0x0b3e, 2);
+    // 0b3e: cmpb $2, (r2)
+    {
+        src = uint8_t(0x02);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b42: bne 0b24
+    if (!Z)
+        AOT_GOTO(0x0b24, L0b24);
+    AOT_GOTO(0x0b44, L0b44);
+L0b44:
+    AOT_BLOCK(0x0b44, 3);
+    // 0b44: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b48: cmp 8(r2), 8(r0)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[0] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b4e: bne 0b24
+    if (!Z)
+        AOT_GOTO(0x0b24, L0b24);
+    AOT_GOTO(0x0b50, L0b50);
+L0b50:
+    AOT_BLOCK(0x0b50, 3);
+    // 0b50: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0b54: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b56: bne 0b5e
+    if (!Z)
+        AOT_GOTO(0x0b5e, L0b5e);
+    AOT_GOTO(0x0b58, L0b58);
+L0b58:
+    AOT_BLOCK(0x0b58, 2);
+    // 0b58: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b5c: br 0bfc
+    AOT_GOTO(0x0bfc, L0bfc);
+L0b5e:
+    AOT_BLOCK(0x0b5e, 2);
+    // 0b5e: cmp r2, r4
+    {
+        src = r[2];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b60: bne 0b50
+    if (!Z)
+        AOT_GOTO(0x0b50, L0b50);
+    AOT_GOTO(0x0b62, L0b62);
+L0b62:
+    AOT_BLOCK(0x0b62, 3);
+    // 0b62: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0b66: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b68: jsr pc, *$09e4
+    {
+        a = 0x09e4;
+        r[6] -= 2;
+        WR16(r[6], 0x0b6c);
+    }
+    AOT_GOTO(0x09e4, L09e4);
+L0b6c:
+    AOT_BLOCK(0x0b6c, 5);
+    // 0b6c: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0b70: movb 1(r2), r0
+    {
+        a = uint16_t(r[2] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0b74: movb 1db2(r0), 1(r2)
+    {
+        a = uint16_t(r[0] + 7602);
+        src = RD8(a);
+        b = uint16_t(r[2] + 1);
+        WR8(b, src);
+    }
+    // 0b7a: mov 6(r2), (sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b7e: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x0b82);
+    }
+    AOT_GOTO(0x1120, L1120);
+L0b82:
+    AOT_BLOCK(0x0b82, 16);
+    // 0b82: mov 4(r3), r0
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b86: mov r4, 2(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0b8a: mov 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b8e: mov r4, 4(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0b92: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b96: mov r3, 2(r0)
+    {
+        src = r[3];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0b9a: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b9e: mov r2, 4(r0)
+    {
+        src = r[2];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0ba2: mov 4(r4), -8(r5)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0ba8: mov 4(r3), 4(r4)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 0bae: mov -8(r5), 4(r3)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[3] + 4);
+        WR16(b, src);
+    }
+    // 0bb4: mov 2(r4), -8(r5)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0bba: mov 2(r2), 2(r4)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 0bc0: mov -8(r5), 2(r2)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 0bc6: mov 2(r4), (sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bca: jsr pc, *$09e4
+    {
+        a = 0x09e4;
+        r[6] -= 2;
+        WR16(r[6], 0x0bce);
+    }
+    AOT_GOTO(0x09e4, L09e4);
+L0bce:
+    AOT_BLOCK(0x0bce, 2);
+    // 0bce: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0bd0: mov 8(r3), 8(r2)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[2] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bd6, L0bd6);
+L0bd6:
+    AOT_BLOCK(0x0bd6, 3);
+    // 0bd6: mov r3, 6(r2)
+    {
+        src = r[3];
+        b = uint16_t(r[2] + 6);
+        WR16(b, src);
+    }
+    // 0bda: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bde: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x0be2);
+    }
+    AOT_GOTO(0x1120, L1120);
+L0be2:
+    AOT_BLOCK(0x0be2, 3);
+    // 0be2: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0be6: tst c(r0)
+    {
+        a = uint16_t(r[0] + 12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0bea: bgt 0bf0
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0bf0, L0bf0);
+    AOT_GOTO(0x0bec, L0bec);
+L0bec:
+    AOT_BLOCK(0x0bec, 1);
+    // 0bec: dec 23a8
+    {
+        a = 0x23a8;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0bf0, L0bf0);
+L0bf0:
+    AOT_BLOCK(0x0bf0, 4);
+    // 0bf0: inc 23b0
+    {
+        a = 0x23b0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0bf4: inc 23be
+    {
+        a = 0x23be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0bf8: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bfa: br 0bfc
+    AOT_GOTO(0x0bfc, L0bfc);
+L0bfc:
+    AOT_BLOCK(0x0bfc, 2);
+    // 0bfc: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0c00:
+    AOT_BLOCK(0x0c00, 3);
+    // 0c00: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0c04;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0c04: mov 2390, r4
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c08, L0c08);
+L0c08:
+    AOT_BLOCK(0x0c08, 2);
+    // 0c08: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c0a: beq 0c4a
+    if (Z)
+        AOT_GOTO(0x0c4a, L0c4a);
+    AOT_GOTO(0x0c0c, L0c0c);
+L0c0c:
+    AOT_BLOCK(0x0c0c, 2);
+    // 0c0c: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c10: bne 0c44
+    if (!Z)
+        AOT_GOTO(0x0c44, L0c44);
+    AOT_GOTO(0x0c12, L0c12);
+L0c12:
+    AOT_BLOCK(0x0c12, 2);
+    // 0c12: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c16: beq 0c44
+    if (Z)
+        AOT_GOTO(0x0c44, L0c44);
+    AOT_GOTO(0x0c18, L0c18);
+L0c18:
+    AOT_BLOCK(0x0c18, 2);
+    // 0c18: cmp $1, c(r3)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[3] + 12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c1e: bge 0c44
+    if (!(N ^ V))
+        AOT_GOTO(0x0c44, L0c44);
+    AOT_GOTO(0x0c20, L0c20);
+L0c20:
+    AOT_BLOCK(0x0c20, 1);
+    // 0c20: mov 2(r4), r2
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c24, L0c24);
+L0c24:
+    AOT_BLOCK(0x0c24, 2);
+    // 0c24: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c26: beq 0c44
+    if (Z)
+        AOT_GOTO(0x0c44, L0c44);
+    AOT_GOTO(0x0c28, L0c28);
+L0c28:
+    AOT_BLOCK(0x0c28, 2);
+    // 0c28: cmpb $1, (r2)
+    {
+        src = uint8_t(0x01);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c2c: bne 0c3e
+    if (!Z)
+        AOT_GOTO(0x0c3e, L0c3e);
+    AOT_GOTO(0x0c2e, L0c2e);
+L0c2e:
+    AOT_BLOCK(0x0c2e, 2);
+    // 0c2e: cmp r3, 6(r2)
+    {
+        src = r[3];
+        b = uint16_t(r[2] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c32: bne 0c3e
+    if (!Z)
+        AOT_GOTO(0x0c3e, L0c3e);
+    AOT_GOTO(0x0c34, L0c34);
+L0c34:
+    AOT_BLOCK(0x0c34, 3);
+    // 0c34: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c36: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c38: jsr pc, *$0c4e
+    {
+        a = 0x0c4e;
+        r[6] -= 2;
+        WR16(r[6], 0x0c3c);
+    }
+    AOT_GOTO(0x0c4e, L0c4e);
+L0c3c:
+    AOT_BLOCK(0x0c3c, 1);
+    // 0c3c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0c3e, L0c3e);
+L0c3e:
+    AOT_BLOCK(0x0c3e, 2);
+    // 0c3e: mov 2(r2), r2
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c42: br 0c24
+    AOT_GOTO(0x0c24, L0c24);
+L0c44:
+    AOT_BLOCK(0x0c44, 2);
+    // 0c44: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c48: br 0c08
+    AOT_GOTO(0x0c08, L0c08);
+L0c4a:
+    AOT_BLOCK(0x0c4a, 2);
+    // 0c4a: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0c4e:
+    AOT_BLOCK(0x0c4e, 4);
+    // 0c4e: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0c52;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0c52: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0c56: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c5a, L0c5a);
+L0c5a:
+    AOT_BLOCK(0x0c5a, 2);
+    // 0c5a: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c5e: beq 0c68
+    if (Z)
+        AOT_GOTO(0x0c68, L0c68);
+    AOT_GOTO(0x0c60, L0c60);
+L0c60:
+    AOT_BLOCK(0x0c60, 2);
+    // 0c60: cmpb $4, (r4)
+    {
+        src = uint8_t(0x04);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c64: bne 0c68
+    if (!Z)
+        AOT_GOTO(0x0c68, L0c68);
+    AOT_GOTO(0x0c66, L0c66);
+L0c66:
+    AOT_BLOCK(0x0c66, 1);
+    // 0c66: br 0c5a
+    AOT_GOTO(0x0c5a, L0c5a);
+L0c68:
+    AOT_BLOCK(0x0c68, 4);
+    // 0c68: mov 4(r3), r3
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0c6c: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c6e: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c70: jsr pc, *$10c2
+    {
+        a = 0x10c2;
+        r[6] -= 2;
+        WR16(r[6], 0x0c74);
+    }
+    AOT_GOTO(0x10c2, L10c2);
+L0c74:
+    AOT_BLOCK(0x0c74, 3);
+    // 0c74: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0c76: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c78: beq 0cb6
+    if (Z)
+        AOT_GOTO(0x0cb6, L0cb6);
+    AOT_GOTO(0x0c7a, L0c7a);
+L0c7a:
+    AOT_BLOCK(0x0c7a, 2);
+    // 0c7a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c7c: jsr pc, *$09e4
+    {
+        a = 0x09e4;
+        r[6] -= 2;
+        WR16(r[6], 0x0c80);
+    }
+    AOT_GOTO(0x09e4, L09e4);
+L0c80:
+    AOT_BLOCK(0x0c80, 8);
+    // 0c80: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0c82: mov 4(r3), r0
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c86: mov 2(r3), 2(r0)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0c8c: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c90: mov 4(r3), 4(r0)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0c96: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0c9a: mov 6(r3), (sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c9e: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x0ca2);
+    }
+    AOT_GOTO(0x1120, L1120);
+L0ca2:
+    AOT_BLOCK(0x0ca2, 5);
+    // 0ca2: mov 8(r2), 8(r3)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[3] + 8);
+        WR16(b, src);
+    }
+    // 0ca8: mov r2, 6(r3)
+    {
+        src = r[2];
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 0cac: inc 23be
+    {
+        a = 0x23be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0cb0: inc 23b6
+    {
+        a = 0x23b6;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0cb4: br 0cb8
+    AOT_GOTO(0x0cb8, L0cb8);
+L0cb6:
+    AOT_BLOCK(0x0cb6, 1);
+    // 0cb6: br 0cba
+    AOT_GOTO(0x0cba, L0cba);
+L0cb8:
+    AOT_BLOCK(0x0cb8, 1);
+    // 0cb8: br 0c5a
+    AOT_GOTO(0x0c5a, L0c5a);
+L0cba:
+    AOT_BLOCK(0x0cba, 2);
+    // 0cba: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0cbe:
+    AOT_BLOCK(0x0cbe, 4);
+    // 0cbe: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0cc2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0cc2: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 0cc6: mov 2390, r4
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cca, L0cca);
+L0cca:
+    AOT_BLOCK(0x0cca, 2);
+    // 0cca: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ccc: bne 0cd2
+    if (!Z)
+        AOT_GOTO(0x0cd2, L0cd2);
+    AOT_GOTO(0x0cce, L0cce);
+L0cce:
+    AOT_BLOCK(0x0cce, 1);
+    // 0cce: jmp *$0f90
+    {
+        a = 0x0f90;
+    }
+    AOT_GOTO(0x0f90, L0f90);
+L0cd2:
+    AOT_BLOCK(0x0cd2, 2);
+    // 0cd2: tst 23c0
+    {
+        a = 0x23c0;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0cd6: beq 0d10
+    if (Z)
+        AOT_GOTO(0x0d10, L0d10);
+    AOT_GOTO(0x0cd8, L0cd8);
+L0cd8:
+    AOT_BLOCK(0x0cd8, 1);
+    // 0cd8: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0cda, L0cda);
+L0cda:
+    AOT_BLOCK(0x0cda, 2);
+    // 0cda: cmp $a, r2
+    {
+        src = uint16_t(0x000a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cde: ble 0d08
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0d08, L0d08);
+    AOT_GOTO(0x0ce0, L0ce0);
+L0ce0:
+    AOT_BLOCK(0x0ce0, 4);
+    // 0ce0: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 0ce2: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0ce6: tstb 23c8(r1)
+    {
+        a = uint16_t(r[1] + 9160);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0cea: beq 0d04
+    if (Z)
+        AOT_GOTO(0x0d04, L0d04);
+    AOT_GOTO(0x0cec, L0cec);
+L0cec:
+    AOT_BLOCK(0x0cec, 7);
+    // 0cec: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 0cee: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0cf2: mov r1, (sp)
+    {
+        src = r[1];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0cf4: add $23c8, (sp)
+    {
+        src = uint16_t(0x23c8);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0cf8: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0cfa: mov $2100, -(sp)
+    {
+        src = uint16_t(0x2100);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cfe: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0d02);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0d02:
+    AOT_BLOCK(0x0d02, 1);
+    // 0d02: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0d04, L0d04);
+L0d04:
+    AOT_BLOCK(0x0d04, 2);
+    // 0d04: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0d06: br 0cda
+    AOT_GOTO(0x0cda, L0cda);
+L0d08:
+    AOT_BLOCK(0x0d08, 2);
+    // 0d08: mov $2108, (sp)
+    {
+        src = uint16_t(0x2108);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d0c: jsr pc, *$191a
+    {
+        a = 0x191a;
+        r[6] -= 2;
+        WR16(r[6], 0x0d10);
+    }
+    AOT_GOTO(0x191a, L191a);
+L0d10:
+    AOT_BLOCK(0x0d10, 3);
+    // 0d10: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0d14: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0d16: jmp *$0f78
+    {
+        a = 0x0f78;
+    }
+    AOT_GOTO(0x0f78, L0f78);
+L0d1a:
+    AOT_BLOCK(0x0d1a, 1);
+    // 0d1a: mov $5, -a(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d20, L0d20);
+L0d20:
+    AOT_BLOCK(0x0d20, 2);
+    // 0d20: cmpb $64, 1(r4)
+    {
+        src = uint8_t(0x64);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0d26: bne 0d2c
+    if (!Z)
+        AOT_GOTO(0x0d2c, L0d2c);
+    AOT_GOTO(0x0d28, L0d28);
+L0d28:
+    AOT_BLOCK(0x0d28, 1);
+    // 0d28: jmp *$0e2a
+    {
+        a = 0x0e2a;
+    }
+    AOT_GOTO(0x0e2a, L0e2a);
+L0d2c:
+    AOT_BLOCK(0x0d2c, 2);
+    // 0d2c: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d2e: jsr pc, *$12f2
+    {
+        a = 0x12f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0d32);
+    }
+    AOT_GOTO(0x12f2, L12f2);
+L0d32:
+    AOT_BLOCK(0x0d32, 3);
+    // 0d32: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d36: mov $2490, -(sp)
+    {
+        src = uint16_t(0x2490);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d3a: jsr pc, *$1328
+    {
+        a = 0x1328;
+        r[6] -= 2;
+        WR16(r[6], 0x0d3e);
+    }
+    AOT_GOTO(0x1328, L1328);
+L0d3e:
+    AOT_BLOCK(0x0d3e, 4);
+    // 0d3e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0d40: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0d42: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d44: blt 0d7a
+    if (N ^ V)
+        AOT_GOTO(0x0d7a, L0d7a);
+    AOT_GOTO(0x0d46, L0d46);
+L0d46:
+    AOT_BLOCK(0x0d46, 2);
+    // 0d46: mov $24a4, (sp)
+    {
+        src = uint16_t(0x24a4);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d4a: jsr pc, *$1368
+    {
+        a = 0x1368;
+        r[6] -= 2;
+        WR16(r[6], 0x0d4e);
+    }
+    AOT_GOTO(0x1368, L1368);
+L0d4e:
+    AOT_BLOCK(0x0d4e, 3);
+    // 0d4e: add -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0d52: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d54: bne 0d7a
+    if (!Z)
+        AOT_GOTO(0x0d7a, L0d7a);
+    AOT_GOTO(0x0d56, L0d56);
+L0d56:
+    AOT_BLOCK(0x0d56, 2);
+    // 0d56: cmpb $2, *2(r4)
+    {
+        src = uint8_t(0x02);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0d5c: beq 0d7a
+    if (Z)
+        AOT_GOTO(0x0d7a, L0d7a);
+    AOT_GOTO(0x0d5e, L0d5e);
+L0d5e:
+    AOT_BLOCK(0x0d5e, 6);
+    // 0d5e: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d62: mov 4(r4), 4(r0)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0d68: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d6c: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0d72: inc 23a2
+    {
+        a = 0x23a2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0d76: jmp *$0f88
+    {
+        a = 0x0f88;
+    }
+    AOT_GOTO(0x0f88, L0f88);
+L0d7a:
+    AOT_BLOCK(0x0d7a, 4);
+    // 0d7a: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d7e: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0d80: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d82: jsr pc, *$143a
+    {
+        a = 0x143a;
+        r[6] -= 2;
+        WR16(r[6], 0x0d86);
+    }
+    AOT_GOTO(0x143a, L143a);
+L0d86:
+    AOT_BLOCK(0x0d86, 3);
+    // 0d86: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0d88: mov $2490, (sp)
+    {
+        src = uint16_t(0x2490);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d8c: jsr pc, *$1368
+    {
+        a = 0x1368;
+        r[6] -= 2;
+        WR16(r[6], 0x0d90);
+    }
+    AOT_GOTO(0x1368, L1368);
+L0d90:
+    AOT_BLOCK(0x0d90, 3);
+    // 0d90: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0d92: mov $24a4, (sp)
+    {
+        src = uint16_t(0x24a4);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d96: jsr pc, *$1368
+    {
+        a = 0x1368;
+        r[6] -= 2;
+        WR16(r[6], 0x0d9a);
+    }
+    AOT_GOTO(0x1368, L1368);
+L0d9a:
+    AOT_BLOCK(0x0d9a, 4);
+    // 0d9a: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0d9e: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0da2: mov $24a4, -(sp)
+    {
+        src = uint16_t(0x24a4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0da6: jsr pc, *$123a
+    {
+        a = 0x123a;
+        r[6] -= 2;
+        WR16(r[6], 0x0daa);
+    }
+    AOT_GOTO(0x123a, L123a);
+L0daa:
+    AOT_BLOCK(0x0daa, 3);
+    // 0daa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0dac: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0dae: blt 0de8
+    if (N ^ V)
+        AOT_GOTO(0x0de8, L0de8);
+    AOT_GOTO(0x0db0, L0db0);
+L0db0:
+    AOT_BLOCK(0x0db0, 2);
+    // 0db0: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0db4: blt 0dd6
+    if (N ^ V)
+        AOT_GOTO(0x0dd6, L0dd6);
+    AOT_GOTO(0x0db6, L0db6);
+L0db6:
+    AOT_BLOCK(0x0db6, 8);
+    // 0db6: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 0db8: add -a(r5), r1
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0dbc: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0dc0: mov r1, (sp)
+    {
+        src = r[1];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dc2: add $23c8, (sp)
+    {
+        src = uint16_t(0x23c8);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0dc6: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dca: add -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0dce: jsr pc, *$11ec
+    {
+        a = 0x11ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0dd2);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L0dd2:
+    AOT_BLOCK(0x0dd2, 2);
+    // 0dd2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0dd4: br 0de6
+    AOT_GOTO(0x0de6, L0de6);
+L0dd6:
+    AOT_BLOCK(0x0dd6, 4);
+    // 0dd6: mov $24a4, (sp)
+    {
+        src = uint16_t(0x24a4);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dda: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ddc: add -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0de0: jsr pc, *$11ec
+    {
+        a = 0x11ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0de4);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L0de4:
+    AOT_BLOCK(0x0de4, 1);
+    // 0de4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0de6, L0de6);
+L0de6:
+    AOT_BLOCK(0x0de6, 1);
+    // 0de6: br 0e10
+    AOT_GOTO(0x0e10, L0e10);
+L0de8:
+    AOT_BLOCK(0x0de8, 2);
+    // 0de8: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0dec: blt 0e02
+    if (N ^ V)
+        AOT_GOTO(0x0e02, L0e02);
+    AOT_GOTO(0x0dee, L0dee);
+L0dee:
+    AOT_BLOCK(0x0dee, 4);
+    // 0dee: mov $2490, (sp)
+    {
+        src = uint16_t(0x2490);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0df2: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0df6: add -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0dfa: jsr pc, *$11ec
+    {
+        a = 0x11ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0dfe);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L0dfe:
+    AOT_BLOCK(0x0dfe, 2);
+    // 0dfe: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e00: br 0e10
+    AOT_GOTO(0x0e10, L0e10);
+L0e02:
+    AOT_BLOCK(0x0e02, 3);
+    // 0e02: mov $24a4, (sp)
+    {
+        src = uint16_t(0x24a4);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e06: mov $2490, -(sp)
+    {
+        src = uint16_t(0x2490);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e0a: jsr pc, *$1836
+    {
+        a = 0x1836;
+        r[6] -= 2;
+        WR16(r[6], 0x0e0e);
+    }
+    AOT_GOTO(0x1836, L1836);
+L0e0e:
+    AOT_BLOCK(0x0e0e, 1);
+    // 0e0e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0e10, L0e10);
+L0e10:
+    AOT_BLOCK(0x0e10, 2);
+    // 0e10: mov $2490, (sp)
+    {
+        src = uint16_t(0x2490);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e14: jsr pc, *$13c6
+    {
+        a = 0x13c6;
+        r[6] -= 2;
+        WR16(r[6], 0x0e18);
+    }
+    AOT_GOTO(0x13c6, L13c6);
+L0e18:
+    AOT_BLOCK(0x0e18, 2);
+    // 0e18: mov $24a4, (sp)
+    {
+        src = uint16_t(0x24a4);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e1c: jsr pc, *$18a6
+    {
+        a = 0x18a6;
+        r[6] -= 2;
+        WR16(r[6], 0x0e20);
+    }
+    AOT_GOTO(0x18a6, L18a6);
+L0e20:
+    AOT_BLOCK(0x0e20, 1);
+    // 0e20: jmp *$0f88
+    {
+        a = 0x0f88;
+    }
+    AOT_GOTO(0x0f88, L0f88);
+L0e24:
+    AOT_BLOCK(0x0e24, 1);
+    // 0e24: mov $5, -a(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e2a, L0e2a);
+L0e2a:
+    AOT_BLOCK(0x0e2a, 2);
+    // 0e2a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e2c: jsr pc, *$12f2
+    {
+        a = 0x12f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0e30);
+    }
+    AOT_GOTO(0x12f2, L12f2);
+L0e30:
+    AOT_BLOCK(0x0e30, 4);
+    // 0e30: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e34: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0e36: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e38: jsr pc, *$143a
+    {
+        a = 0x143a;
+        r[6] -= 2;
+        WR16(r[6], 0x0e3c);
+    }
+    AOT_GOTO(0x143a, L143a);
+L0e3c:
+    AOT_BLOCK(0x0e3c, 3);
+    // 0e3c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0e3e: mov $2490, (sp)
+    {
+        src = uint16_t(0x2490);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e42: jsr pc, *$13c6
+    {
+        a = 0x13c6;
+        r[6] -= 2;
+        WR16(r[6], 0x0e46);
+    }
+    AOT_GOTO(0x13c6, L13c6);
+L0e46:
+    AOT_BLOCK(0x0e46, 3);
+    // 0e46: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e4a: mov $24a4, -(sp)
+    {
+        src = uint16_t(0x24a4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e4e: jsr pc, *$123a
+    {
+        a = 0x123a;
+        r[6] -= 2;
+        WR16(r[6], 0x0e52);
+    }
+    AOT_GOTO(0x123a, L123a);
+L0e52:
+    AOT_BLOCK(0x0e52, 3);
+    // 0e52: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0e54: cmpb $1b, (r4)
+    {
+        src = uint8_t(0x1b);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0e58: bne 0e7c
+    if (!Z)
+        AOT_GOTO(0x0e7c, L0e7c);
+    AOT_GOTO(0x0e5a, L0e5a);
+L0e5a:
+    AOT_BLOCK(0x0e5a, 2);
+    // 0e5a: mov $24a4, (sp)
+    {
+        src = uint16_t(0x24a4);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e5e: jsr pc, *$1368
+    {
+        a = 0x1368;
+        r[6] -= 2;
+        WR16(r[6], 0x0e62);
+    }
+    AOT_GOTO(0x1368, L1368);
+L0e62:
+    AOT_BLOCK(0x0e62, 2);
+    // 0e62: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e64: bge 0e6a
+    if (!(N ^ V))
+        AOT_GOTO(0x0e6a, L0e6a);
+    AOT_GOTO(0x0e66, L0e66);
+L0e66:
+    AOT_BLOCK(0x0e66, 2);
+    // 0e66: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0e68: br 0e6e
+    AOT_GOTO(0x0e6e, L0e6e);
+L0e6a:
+    AOT_BLOCK(0x0e6a, 1);
+    // 0e6a: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e6e, L0e6e);
+L0e6e:
+    AOT_BLOCK(0x0e6e, 2);
+    // 0e6e: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e70: beq 0e7c
+    if (Z)
+        AOT_GOTO(0x0e7c, L0e7c);
+    AOT_GOTO(0x0e72, L0e72);
+L0e72:
+    AOT_BLOCK(0x0e72, 3);
+    // 0e72: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 0e74: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0e78: clrb 23dc(r1)
+    {
+        a = uint16_t(r[1] + 9180);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0e7c, L0e7c);
+L0e7c:
+    AOT_BLOCK(0x0e7c, 2);
+    // 0e7c: clrb 24e0
+    {
+        a = 0x24e0;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0e80: jmp *$0f88
+    {
+        a = 0x0f88;
+    }
+    AOT_GOTO(0x0f88, L0f88);
+L0e84:
+    AOT_BLOCK(0x0e84, 1);
+    // 0e84: mov $5, -a(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e8a, L0e8a);
+L0e8a:
+    AOT_BLOCK(0x0e8a, 2);
+    // 0e8a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e8c: jsr pc, *$12d4
+    {
+        a = 0x12d4;
+        r[6] -= 2;
+        WR16(r[6], 0x0e90);
+    }
+    AOT_GOTO(0x12d4, L12d4);
+L0e90:
+    AOT_BLOCK(0x0e90, 3);
+    // 0e90: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e94: mov $2490, -(sp)
+    {
+        src = uint16_t(0x2490);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e98: jsr pc, *$123a
+    {
+        a = 0x123a;
+        r[6] -= 2;
+        WR16(r[6], 0x0e9c);
+    }
+    AOT_GOTO(0x123a, L123a);
+L0e9c:
+    AOT_BLOCK(0x0e9c, 3);
+    // 0e9c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0e9e: cmpb $b, (r4)
+    {
+        src = uint8_t(0x0b);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0ea2: bne 0ed4
+    if (!Z)
+        AOT_GOTO(0x0ed4, L0ed4);
+    AOT_GOTO(0x0ea4, L0ea4);
+L0ea4:
+    AOT_BLOCK(0x0ea4, 2);
+    // 0ea4: tst -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ea8: bne 0ed4
+    if (!Z)
+        AOT_GOTO(0x0ed4, L0ed4);
+    AOT_GOTO(0x0eaa, L0eaa);
+L0eaa:
+    AOT_BLOCK(0x0eaa, 2);
+    // 0eaa: mov $2490, (sp)
+    {
+        src = uint16_t(0x2490);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0eae: jsr pc, *$1368
+    {
+        a = 0x1368;
+        r[6] -= 2;
+        WR16(r[6], 0x0eb2);
+    }
+    AOT_GOTO(0x1368, L1368);
+L0eb2:
+    AOT_BLOCK(0x0eb2, 3);
+    // 0eb2: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0eb4: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0eb6: blt 0ec6
+    if (N ^ V)
+        AOT_GOTO(0x0ec6, L0ec6);
+    AOT_GOTO(0x0eb8, L0eb8);
+L0eb8:
+    AOT_BLOCK(0x0eb8, 3);
+    // 0eb8: mov $210b, (sp)
+    {
+        src = uint16_t(0x210b);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ebc: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ebe: jsr pc, *$11ec
+    {
+        a = 0x11ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0ec2);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L0ec2:
+    AOT_BLOCK(0x0ec2, 2);
+    // 0ec2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ec4: br 0ed4
+    AOT_GOTO(0x0ed4, L0ed4);
+L0ec6:
+    AOT_BLOCK(0x0ec6, 3);
+    // 0ec6: mov $2490, (sp)
+    {
+        src = uint16_t(0x2490);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0eca: mov $210e, -(sp)
+    {
+        src = uint16_t(0x210e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ece: jsr pc, *$1836
+    {
+        a = 0x1836;
+        r[6] -= 2;
+        WR16(r[6], 0x0ed2);
+    }
+    AOT_GOTO(0x1836, L1836);
+L0ed2:
+    AOT_BLOCK(0x0ed2, 1);
+    // 0ed2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0ed4, L0ed4);
+L0ed4:
+    AOT_BLOCK(0x0ed4, 2);
+    // 0ed4: mov $2490, (sp)
+    {
+        src = uint16_t(0x2490);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ed8: jsr pc, *$18a6
+    {
+        a = 0x18a6;
+        r[6] -= 2;
+        WR16(r[6], 0x0edc);
+    }
+    AOT_GOTO(0x18a6, L18a6);
+L0edc:
+    AOT_BLOCK(0x0edc, 1);
+    // 0edc: br 0f88
+    AOT_GOTO(0x0f88, L0f88);
+L0ede:
+    AOT_BLOCK(0x0ede, 1);
+    // 0ede: mov $5, -a(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ee4, L0ee4);
+L0ee4:
+    AOT_BLOCK(0x0ee4, 2);
+    // 0ee4: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ee6: jsr pc, *$12d4
+    {
+        a = 0x12d4;
+        r[6] -= 2;
+        WR16(r[6], 0x0eea);
+    }
+    AOT_GOTO(0x12d4, L12d4);
+L0eea:
+    AOT_BLOCK(0x0eea, 4);
+    // 0eea: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0eee: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0ef0: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ef2: jsr pc, *$143a
+    {
+        a = 0x143a;
+        r[6] -= 2;
+        WR16(r[6], 0x0ef6);
+    }
+    AOT_GOTO(0x143a, L143a);
+L0ef6:
+    AOT_BLOCK(0x0ef6, 3);
+    // 0ef6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0ef8: mov $2490, (sp)
+    {
+        src = uint16_t(0x2490);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0efc: jsr pc, *$13c6
+    {
+        a = 0x13c6;
+        r[6] -= 2;
+        WR16(r[6], 0x0f00);
+    }
+    AOT_GOTO(0x13c6, L13c6);
+L0f00:
+    AOT_BLOCK(0x0f00, 3);
+    // 0f00: mov $24e0, (sp)
+    {
+        src = uint16_t(0x24e0);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f04: mov $2490, -(sp)
+    {
+        src = uint16_t(0x2490);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f08: jsr pc, *$186a
+    {
+        a = 0x186a;
+        r[6] -= 2;
+        WR16(r[6], 0x0f0c);
+    }
+    AOT_GOTO(0x186a, L186a);
+L0f0c:
+    AOT_BLOCK(0x0f0c, 3);
+    // 0f0c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0f0e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f10: beq 0f32
+    if (Z)
+        AOT_GOTO(0x0f32, L0f32);
+    AOT_GOTO(0x0f12, L0f12);
+L0f12:
+    AOT_BLOCK(0x0f12, 7);
+    // 0f12: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f16: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0f1c: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f20: mov 4(r4), 4(r0)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0f26: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0f2a: inc 23ba
+    {
+        a = 0x23ba;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0f2e: inc 23be
+    {
+        a = 0x23be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0f32, L0f32);
+L0f32:
+    AOT_BLOCK(0x0f32, 1);
+    // 0f32: br 0f88
+    AOT_GOTO(0x0f88, L0f88);
+L0f34:
+    AOT_BLOCK(0x0f34, 1);
+    // 0f34: mov $5, -a(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f3a, L0f3a);
+L0f3a:
+    AOT_BLOCK(0x0f3a, 2);
+    // 0f3a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f3c: jsr pc, *$12f2
+    {
+        a = 0x12f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0f40);
+    }
+    AOT_GOTO(0x12f2, L12f2);
+L0f40:
+    AOT_BLOCK(0x0f40, 2);
+    // 0f40: mov $2490, (sp)
+    {
+        src = uint16_t(0x2490);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f44: jsr pc, *$13c6
+    {
+        a = 0x13c6;
+        r[6] -= 2;
+        WR16(r[6], 0x0f48);
+    }
+    AOT_GOTO(0x13c6, L13c6);
+L0f48:
+    AOT_BLOCK(0x0f48, 2);
+    // 0f48: mov $24a4, (sp)
+    {
+        src = uint16_t(0x24a4);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f4c: jsr pc, *$13c6
+    {
+        a = 0x13c6;
+        r[6] -= 2;
+        WR16(r[6], 0x0f50);
+    }
+    AOT_GOTO(0x13c6, L13c6);
+L0f50:
+    AOT_BLOCK(0x0f50, 4);
+    // 0f50: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f54: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f58: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f5a: jsr pc, *$143a
+    {
+        a = 0x143a;
+        r[6] -= 2;
+        WR16(r[6], 0x0f5e);
+    }
+    AOT_GOTO(0x143a, L143a);
+L0f5e:
+    AOT_BLOCK(0x0f5e, 3);
+    // 0f5e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0f60: clrb 24e0
+    {
+        a = 0x24e0;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0f64: br 0f88
+    AOT_GOTO(0x0f88, L0f88);
+L0f66:
+    AOT_BLOCK(0x0f66, 2);
+    // 0f66: clrb 24e0
+    {
+        a = 0x24e0;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0f6a: br 0f88
+    AOT_GOTO(0x0f88, L0f88);
+L0f6c:
+    AOT_BLOCK(0x0f6c, 2);
+    // 0f6c: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f6e: jsr pc, *$1618
+    {
+        a = 0x1618;
+        r[6] -= 2;
+        WR16(r[6], 0x0f72);
+    }
+    AOT_GOTO(0x1618, L1618);
+L0f72:
+    AOT_BLOCK(0x0f72, 1);
+    // 0f72: jsr pc, 11c6
+    {
+        a = 0x11c6;
+        r[6] -= 2;
+        WR16(r[6], 0x0f76);
+    }
+    AOT_GOTO(0x11c6, L11c6);
+L0f76:
+    AOT_BLOCK(0x0f76, 1);
+    // 0f76: br 0f88
+    AOT_GOTO(0x0f88, L0f88);
+L0f78:
+    AOT_BLOCK(0x0f78, 3);
+    // 0f78: sub $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0f7c: cmp r0, $2c
+    {
+        src = r[0];
+        dst = uint16_t(0x002c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f80: bhi 0f72
+    if (!(C | Z))
+        AOT_GOTO(0x0f72, L0f72);
+    AOT_GOTO(0x0f82, L0f82);
+L0f82:
+    AOT_BLOCK(0x0f82, 2);
+    // 0f82: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0f84: jmp *2092(r0)
+    {
+        a = RD16(r[0] + 8338);
+    }
+    AOT_JUMP(a);
+L0f88:
+    AOT_BLOCK(0x0f88, 2);
+    // 0f88: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f8c: jmp *$0cca
+    {
+        a = 0x0cca;
+    }
+    AOT_GOTO(0x0cca, L0cca);
+L0f90:
+    AOT_BLOCK(0x0f90, 2);
+    // 0f90: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0f94:
+    AOT_BLOCK(0x0f94, 6);
+    // 0f94: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0f98;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 0f98: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 0f9a: clr r2
+    {
+        r[2] = 0;
+    }
+    // 0f9c: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0fa0: mov 2390, r4
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fa4, L0fa4);
+L0fa4:
+    AOT_BLOCK(0x0fa4, 2);
+    // 0fa4: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0fa6: beq 0fb4
+    if (Z)
+        AOT_GOTO(0x0fb4, L0fb4);
+    AOT_GOTO(0x0fa8, L0fa8);
+L0fa8:
+    AOT_BLOCK(0x0fa8, 4);
+    // 0fa8: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 0faa: mov r2, c(r4)
+    {
+        src = r[2];
+        b = uint16_t(r[4] + 12);
+        WR16(b, src);
+    }
+    // 0fae: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fb2: br 0fa4
+    AOT_GOTO(0x0fa4, L0fa4);
+L0fb4:
+    AOT_BLOCK(0x0fb4, 1);
+    // 0fb4: mov 2390, r4
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fb8, L0fb8);
+L0fb8:
+    AOT_BLOCK(0x0fb8, 2);
+    // 0fb8: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0fba: beq 1032
+    if (Z)
+        AOT_GOTO(0x1032, L1032);
+    AOT_GOTO(0x0fbc, L0fbc);
+L0fbc:
+    AOT_BLOCK(0x0fbc, 3);
+    // 0fbc: mov 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0fc0: cmpb $2, (r4)
+    {
+        src = uint8_t(0x02);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0fc4: bne 102e
+    if (!Z)
+        AOT_GOTO(0x102e, L102e);
+    AOT_GOTO(0x0fc6, L0fc6);
+L0fc6:
+    AOT_BLOCK(0x0fc6, 2);
+    // 0fc6: cmpb $1, (r3)
+    {
+        src = uint8_t(0x01);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0fca: bne 102e
+    if (!Z)
+        AOT_GOTO(0x102e, L102e);
+    AOT_GOTO(0x0fcc, L0fcc);
+L0fcc:
+    AOT_BLOCK(0x0fcc, 2);
+    // 0fcc: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0fd0: beq 102e
+    if (Z)
+        AOT_GOTO(0x102e, L102e);
+    AOT_GOTO(0x0fd2, L0fd2);
+L0fd2:
+    AOT_BLOCK(0x0fd2, 2);
+    // 0fd2: tst 6(r3)
+    {
+        a = uint16_t(r[3] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0fd6: beq 102e
+    if (Z)
+        AOT_GOTO(0x102e, L102e);
+    AOT_GOTO(0x0fd8, L0fd8);
+L0fd8:
+    AOT_BLOCK(0x0fd8, 4);
+    // 0fd8: mov c(r3), (sp)
+    {
+        a = uint16_t(r[3] + 12);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fdc: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0fe0: sub c(r0), (sp)
+    {
+        a = uint16_t(r[0] + 12);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 0fe4: jsr pc, *$10a6
+    {
+        a = 0x10a6;
+        r[6] -= 2;
+        WR16(r[6], 0x0fe8);
+    }
+    AOT_GOTO(0x10a6, L10a6);
+L0fe8:
+    AOT_BLOCK(0x0fe8, 5);
+    // 0fe8: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fea: mov c(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fee: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0ff2: sub c(r0), (sp)
+    {
+        a = uint16_t(r[0] + 12);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 0ff6: jsr pc, 10a6
+    {
+        a = 0x10a6;
+        r[6] -= 2;
+        WR16(r[6], 0x0ffa);
+    }
+    AOT_GOTO(0x10a6, L10a6);
+L0ffa:
+    AOT_BLOCK(0x0ffa, 3);
+    // 0ffa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0ffc: cmp (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ffe: bge 102e
+    if (!(N ^ V))
+        AOT_GOTO(0x102e, L102e);
+    AOT_GOTO(0x1000, L1000);
+L1000:
+    AOT_BLOCK(0x1000, 10);
+    // 1000: movb 1(r4), r0
+    {
+        a = uint16_t(r[4] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1004: movb 1db2(r0), 1(r4)
+    {
+        a = uint16_t(r[0] + 7602);
+        src = RD8(a);
+        b = uint16_t(r[4] + 1);
+        WR8(b, src);
+    }
+    // 100a: mov 6(r3), r2
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 100e: mov 6(r4), 6(r3)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 1014: mov r2, 6(r4)
+    {
+        src = r[2];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 1018: mov 8(r3), r2
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 101c: mov 8(r4), 8(r3)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = uint16_t(r[3] + 8);
+        WR16(b, src);
+    }
+    // 1022: mov r2, 8(r4)
+    {
+        src = r[2];
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 1026: inc 23ae
+    {
+        a = 0x23ae;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 102a: inc -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x102e, L102e);
+L102e:
+    AOT_BLOCK(0x102e, 2);
+    // 102e: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1030: br 0fb8
+    AOT_GOTO(0x0fb8, L0fb8);
+L1032:
+    AOT_BLOCK(0x1032, 2);
+    // 1032: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1036: br 1038
+    AOT_GOTO(0x1038, L1038);
+L1038:
+    AOT_BLOCK(0x1038, 2);
+    // 1038: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L103c:
+    AOT_BLOCK(0x103c, 3);
+    // 103c: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1040;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1040: mov $238e, r4
+    {
+        src = uint16_t(0x238e);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1044, L1044);
+L1044:
+    AOT_BLOCK(0x1044, 3);
+    // 1044: mov 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1048: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 104a: beq 10a2
+    if (Z)
+        AOT_GOTO(0x10a2, L10a2);
+    AOT_GOTO(0x104c, L104c);
+L104c:
+    AOT_BLOCK(0x104c, 2);
+    // 104c: cmpb $e, (r4)
+    {
+        src = uint8_t(0x0e);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1050: bne 109e
+    if (!Z)
+        AOT_GOTO(0x109e, L109e);
+    AOT_GOTO(0x1052, L1052);
+L1052:
+    AOT_BLOCK(0x1052, 2);
+    // 1052: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1056: jsr pc, *$1368
+    {
+        a = 0x1368;
+        r[6] -= 2;
+        WR16(r[6], 0x105a);
+    }
+    AOT_GOTO(0x1368, L1368);
+L105a:
+    AOT_BLOCK(0x105a, 2);
+    // 105a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 105c: blt 109e
+    if (N ^ V)
+        AOT_GOTO(0x109e, L109e);
+    AOT_GOTO(0x105e, L105e);
+L105e:
+    AOT_BLOCK(0x105e, 2);
+    // 105e: cmp $102, (r3)
+    {
+        src = uint16_t(0x0102);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1062: bne 109e
+    if (!Z)
+        AOT_GOTO(0x109e, L109e);
+    AOT_GOTO(0x1064, L1064);
+L1064:
+    AOT_BLOCK(0x1064, 3);
+    // 1064: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1068: cmp c(r4), c(r0)
+    {
+        a = uint16_t(r[4] + 12);
+        src = RD16(a);
+        b = uint16_t(r[0] + 12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 106e: blt 109e
+    if (N ^ V)
+        AOT_GOTO(0x109e, L109e);
+    AOT_GOTO(0x1070, L1070);
+L1070:
+    AOT_BLOCK(0x1070, 5);
+    // 1070: mov c(r4), r0
+    {
+        a = uint16_t(r[4] + 12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1074: mov 6(r3), r1
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1078: sub c(r1), r0
+    {
+        a = uint16_t(r[1] + 12);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 107c: cmp $32, r0
+    {
+        src = uint16_t(0x0032);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1080: blt 109e
+    if (N ^ V)
+        AOT_GOTO(0x109e, L109e);
+    AOT_GOTO(0x1082, L1082);
+L1082:
+    AOT_BLOCK(0x1082, 6);
+    // 1082: mov 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 1088: mov $2e, (r4)
+    {
+        src = uint16_t(0x002e);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 108c: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1090: mov r4, 4(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 1094: mov 2(r3), 2(r4)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 109a: inc 23b8
+    {
+        a = 0x23b8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x109e, L109e);
+L109e:
+    AOT_BLOCK(0x109e, 2);
+    // 109e: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10a0: br 1044
+    AOT_GOTO(0x1044, L1044);
+L10a2:
+    AOT_BLOCK(0x10a2, 2);
+    // 10a2: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L10a6:
+    AOT_BLOCK(0x10a6, 4);
+    // 10a6: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x10aa;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 10aa: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10ae: bge 10b8
+    if (!(N ^ V))
+        AOT_GOTO(0x10b8, L10b8);
+    AOT_GOTO(0x10b0, L10b0);
+L10b0:
+    AOT_BLOCK(0x10b0, 3);
+    // 10b0: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 10b4: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    // 10b6: br 10bc
+    AOT_GOTO(0x10bc, L10bc);
+L10b8:
+    AOT_BLOCK(0x10b8, 1);
+    // 10b8: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x10bc, L10bc);
+L10bc:
+    AOT_BLOCK(0x10bc, 1);
+    // 10bc: br 10be
+    AOT_GOTO(0x10be, L10be);
+L10be:
+    AOT_BLOCK(0x10be, 2);
+    // 10be: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L10c2:
+    AOT_BLOCK(0x10c2, 5);
+    // 10c2: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x10c6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 10c6: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 10ca: cmp (r2), *6(r5)
+    {
+        a = r[2];
+        src = RD16(a);
+        b = RD16(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 10ce: beq 10d4
+    if (Z)
+        AOT_GOTO(0x10d4, L10d4);
+    AOT_GOTO(0x10d0, L10d0);
+L10d0:
+    AOT_BLOCK(0x10d0, 2);
+    // 10d0: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 10d2: br 111c
+    AOT_GOTO(0x111c, L111c);
+L10d4:
+    AOT_BLOCK(0x10d4, 2);
+    // 10d4: tstb (r2)
+    {
+        a = r[2];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10d6: ble 10e2
+    if (Z || (N ^ V))
+        AOT_GOTO(0x10e2, L10e2);
+    AOT_GOTO(0x10d8, L10d8);
+L10d8:
+    AOT_BLOCK(0x10d8, 2);
+    // 10d8: cmpb $a, (r2)
+    {
+        src = uint8_t(0x0a);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 10dc: ble 10e2
+    if (Z || (N ^ V))
+        AOT_GOTO(0x10e2, L10e2);
+    AOT_GOTO(0x10de, L10de);
+L10de:
+    AOT_BLOCK(0x10de, 2);
+    // 10de: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 10e0: br 111c
+    AOT_GOTO(0x111c, L111c);
+L10e2:
+    AOT_BLOCK(0x10e2, 5);
+    // 10e2: mov a(r2), r4
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 10e6: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 10ea: mov a(r0), r3
+    {
+        a = uint16_t(r[0] + 10);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 10ee: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10f0: bne 10fc
+    if (!Z)
+        AOT_GOTO(0x10fc, L10fc);
+    AOT_GOTO(0x10f2, L10f2);
+L10f2:
+    AOT_BLOCK(0x10f2, 2);
+    // 10f2: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10f4: bne 10fc
+    if (!Z)
+        AOT_GOTO(0x10fc, L10fc);
+    AOT_GOTO(0x10f6, L10f6);
+L10f6:
+    AOT_BLOCK(0x10f6, 2);
+    // 10f6: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10fa: br 111c
+    AOT_GOTO(0x111c, L111c);
+L10fc:
+    AOT_BLOCK(0x10fc, 2);
+    // 10fc: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10fe: beq 1104
+    if (Z)
+        AOT_GOTO(0x1104, L1104);
+    AOT_GOTO(0x1100, L1100);
+L1100:
+    AOT_BLOCK(0x1100, 2);
+    // 1100: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1102: bne 1108
+    if (!Z)
+        AOT_GOTO(0x1108, L1108);
+    AOT_GOTO(0x1104, L1104);
+L1104:
+    AOT_BLOCK(0x1104, 2);
+    // 1104: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1106: br 111c
+    AOT_GOTO(0x111c, L111c);
+L1108:
+    AOT_BLOCK(0x1108, 2);
+    // 1108: cmpb (r4), (r3)+
+    {
+        a = r[4];
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 110a: bne 1118
+    if (!Z)
+        AOT_GOTO(0x1118, L1118);
+    AOT_GOTO(0x110c, L110c);
+L110c:
+    AOT_BLOCK(0x110c, 2);
+    // 110c: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 110e: bne 1116
+    if (!Z)
+        AOT_GOTO(0x1116, L1116);
+    AOT_GOTO(0x1110, L1110);
+L1110:
+    AOT_BLOCK(0x1110, 2);
+    // 1110: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1114: br 111c
+    AOT_GOTO(0x111c, L111c);
+L1116:
+    AOT_BLOCK(0x1116, 1);
+    // 1116: br 1108
+    AOT_GOTO(0x1108, L1108);
+L1118:
+    AOT_BLOCK(0x1118, 2);
+    // 1118: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 111a: br 111c
+    AOT_GOTO(0x111c, L111c);
+L111c:
+    AOT_BLOCK(0x111c, 2);
+    // 111c: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1120:
+    AOT_BLOCK(0x1120, 6);
+    // 1120: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1124;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1124: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1128: dec c(r4)
+    {
+        a = uint16_t(r[4] + 12);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 112c: tst c(r4)
+    {
+        a = uint16_t(r[4] + 12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1130: bgt 114a
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x114a, L114a);
+    AOT_GOTO(0x1132, L1132);
+L1132:
+    AOT_BLOCK(0x1132, 5);
+    // 1132: inc 23a8
+    {
+        a = 0x23a8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1136: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 113a: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 1140: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1144: mov 4(r4), 4(r0)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x114a, L114a);
+L114a:
+    AOT_BLOCK(0x114a, 2);
+    // 114a: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L114e:
+    AOT_BLOCK(0x114e, 3);
+    // 114e: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1152;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1152: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1156, L1156);
+L1156:
+    AOT_BLOCK(0x1156, 2);
+    // 1156: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1158: beq 1166
+    if (Z)
+        AOT_GOTO(0x1166, L1166);
+    AOT_GOTO(0x115a, L115a);
+L115a:
+    AOT_BLOCK(0x115a, 2);
+    // 115a: cmpb $4, (r4)
+    {
+        src = uint8_t(0x04);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 115e: bne 1166
+    if (!Z)
+        AOT_GOTO(0x1166, L1166);
+    AOT_GOTO(0x1160, L1160);
+L1160:
+    AOT_BLOCK(0x1160, 2);
+    // 1160: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1164: br 1156
+    AOT_GOTO(0x1156, L1156);
+L1166:
+    AOT_BLOCK(0x1166, 2);
+    // 1166: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1168: br 116a
+    AOT_GOTO(0x116a, L116a);
+L116a:
+    AOT_BLOCK(0x116a, 2);
+    // 116a: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L116e:
+    AOT_BLOCK(0x116e, 9);
+    // 116e: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1172;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1172: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1176: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 1178: bic $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 117c: mov 23c2, r0
+    {
+        a = 0x23c2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1180: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1182: cmp 23c4, r0
+    {
+        a = 0x23c4;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1186: bhi 11b6
+    if (!(C | Z))
+        AOT_GOTO(0x11b6, L11b6);
+    AOT_GOTO(0x1188, L1188);
+L1188:
+    AOT_BLOCK(0x1188, 2);
+    // 1188: mov $7d0, (sp)
+    {
+        src = uint16_t(0x07d0);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 118c: jsr pc, *$1bce
+    {
+        a = 0x1bce;
+        r[6] -= 2;
+        WR16(r[6], 0x1190);
+    }
+    AOT_GOTO(0x1bce, L1bce);
+L1190:
+    AOT_BLOCK(0x1190, 2);
+    // 1190: cmp $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1194: bne 11b0
+    if (!Z)
+        AOT_GOTO(0x11b0, L11b0);
+    AOT_GOTO(0x1196, L1196);
+L1196:
+    AOT_BLOCK(0x1196, 4);
+    // 1196: mov $e, (sp)
+    {
+        src = uint16_t(0x000e);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 119a: mov $2111, -(sp)
+    {
+        src = uint16_t(0x2111);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 119e: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11a2: jsr pc, *$1c16
+    {
+        a = 0x1c16;
+        r[6] -= 2;
+        WR16(r[6], 0x11a6);
+    }
+    AOT_GOTO(0x1c16, L1c16);
+L11a6:
+    AOT_BLOCK(0x11a6, 3);
+    // 11a6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 11a8: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11ac: jsr pc, *$1c42
+    {
+        a = 0x1c42;
+        r[6] -= 2;
+        WR16(r[6], 0x11b0);
+    }
+    AOT_GOTO(0x1c42, L1c42);
+L11b0:
+    AOT_BLOCK(0x11b0, 1);
+    // 11b0: add $7d0, 23c4
+    {
+        src = uint16_t(0x07d0);
+        b = 0x23c4;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x11b6, L11b6);
+L11b6:
+    AOT_BLOCK(0x11b6, 4);
+    // 11b6: mov 23c2, r3
+    {
+        a = 0x23c2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 11ba: add r4, 23c2
+    {
+        src = r[4];
+        b = 0x23c2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 11be: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11c0: br 11c2
+    AOT_GOTO(0x11c2, L11c2);
+L11c2:
+    AOT_BLOCK(0x11c2, 2);
+    // 11c2: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L11c6:
+    AOT_BLOCK(0x11c6, 3);
+    // 11c6: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x11ca;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 11ca: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x11cc, L11cc);
+L11cc:
+    AOT_BLOCK(0x11cc, 2);
+    // 11cc: cmp $a, r4
+    {
+        src = uint16_t(0x000a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11d0: ble 11e0
+    if (Z || (N ^ V))
+        AOT_GOTO(0x11e0, L11e0);
+    AOT_GOTO(0x11d2, L11d2);
+L11d2:
+    AOT_BLOCK(0x11d2, 5);
+    // 11d2: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 11d4: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 11d8: clrb 23c8(r1)
+    {
+        a = uint16_t(r[1] + 9160);
+        WR8(a, 0);
+        C = false;
+    }
+    // 11dc: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 11de: br 11cc
+    AOT_GOTO(0x11cc, L11cc);
+L11e0:
+    AOT_BLOCK(0x11e0, 4);
+    // 11e0: clrb 24b8
+    {
+        a = 0x24b8;
+        WR8(a, 0);
+    }
+    // 11e4: clrb 24e0
+    {
+        a = 0x24e0;
+        WR8(a, 0);
+        C = false;
+    }
+    // 11e8: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L11ec:
+    AOT_BLOCK(0x11ec, 10);
+    // 11ec: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x11f0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 11f0: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 11f4: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 11f8: mov r1, r4
+    {
+        src = r[1];
+        r[4] = src;
+    }
+    // 11fa: add $23c8, r4
+    {
+        src = uint16_t(0x23c8);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 11fe: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+    }
+    // 1200: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1204: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1206: jsr pc, *$13c6
+    {
+        a = 0x13c6;
+        r[6] -= 2;
+        WR16(r[6], 0x120a);
+    }
+    AOT_GOTO(0x13c6, L13c6);
+L120a:
+    AOT_BLOCK(0x120a, 2);
+    // 120a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 120c: bne 1236
+    if (!Z)
+        AOT_GOTO(0x1236, L1236);
+    AOT_GOTO(0x120e, L120e);
+L120e:
+    AOT_BLOCK(0x120e, 2);
+    // 120e: movb (r3), (r4)+
+    {
+        a = r[3];
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1210: beq 1234
+    if (Z)
+        AOT_GOTO(0x1234, L1234);
+    AOT_GOTO(0x1212, L1212);
+L1212:
+    AOT_BLOCK(0x1212, 2);
+    // 1212: cmpb $28, (r3)
+    {
+        src = uint8_t(0x28);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1216: bne 122c
+    if (!Z)
+        AOT_GOTO(0x122c, L122c);
+    AOT_GOTO(0x1218, L1218);
+L1218:
+    AOT_BLOCK(0x1218, 2);
+    // 1218: cmpb $72, 1(r3)
+    {
+        src = uint8_t(0x72);
+        b = uint16_t(r[3] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 121e: bne 122c
+    if (!Z)
+        AOT_GOTO(0x122c, L122c);
+    AOT_GOTO(0x1220, L1220);
+L1220:
+    AOT_BLOCK(0x1220, 2);
+    // 1220: cmpb $35, 2(r3)
+    {
+        src = uint8_t(0x35);
+        b = uint16_t(r[3] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1226: ble 122c
+    if (Z || (N ^ V))
+        AOT_GOTO(0x122c, L122c);
+    AOT_GOTO(0x1228, L1228);
+L1228:
+    AOT_BLOCK(0x1228, 2);
+    // 1228: clrb (r2)
+    {
+        a = r[2];
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 122a: br 1236
+    AOT_GOTO(0x1236, L1236);
+L122c:
+    AOT_BLOCK(0x122c, 2);
+    // 122c: cmpb $2c, (r3)+
+    {
+        src = uint8_t(0x2c);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1230: beq 1234
+    if (Z)
+        AOT_GOTO(0x1234, L1234);
+    AOT_GOTO(0x1232, L1232);
+L1232:
+    AOT_BLOCK(0x1232, 1);
+    // 1232: br 120e
+    AOT_GOTO(0x120e, L120e);
+L1234:
+    AOT_BLOCK(0x1234, 1);
+    // 1234: clrb -(r4)
+    {
+        r[4] -= 1;
+        a = r[4];
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1236, L1236);
+L1236:
+    AOT_BLOCK(0x1236, 2);
+    // 1236: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L123a:
+    AOT_BLOCK(0x123a, 5);
+    // 123a: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x123e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 123e: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1242: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1244: jsr pc, *$1368
+    {
+        a = 0x1368;
+        r[6] -= 2;
+        WR16(r[6], 0x1248);
+    }
+    AOT_GOTO(0x1368, L1368);
+L1248:
+    AOT_BLOCK(0x1248, 3);
+    // 1248: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 124a: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 124c: blt 125c
+    if (N ^ V)
+        AOT_GOTO(0x125c, L125c);
+    AOT_GOTO(0x124e, L124e);
+L124e:
+    AOT_BLOCK(0x124e, 4);
+    // 124e: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 1250: add 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 1254: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1258: clrb 23c8(r1)
+    {
+        a = uint16_t(r[1] + 9160);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x125c, L125c);
+L125c:
+    AOT_BLOCK(0x125c, 3);
+    // 125c: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1260: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1262: jsr pc, *$1328
+    {
+        a = 0x1328;
+        r[6] -= 2;
+        WR16(r[6], 0x1266);
+    }
+    AOT_GOTO(0x1328, L1328);
+L1266:
+    AOT_BLOCK(0x1266, 4);
+    // 1266: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1268: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 126a: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 126c: blt 127a
+    if (N ^ V)
+        AOT_GOTO(0x127a, L127a);
+    AOT_GOTO(0x126e, L126e);
+L126e:
+    AOT_BLOCK(0x126e, 4);
+    // 126e: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 1270: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1274: clrb 23c8(r1)
+    {
+        a = uint16_t(r[1] + 9160);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1278: br 125c
+    AOT_GOTO(0x125c, L125c);
+L127a:
+    AOT_BLOCK(0x127a, 2);
+    // 127a: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 127c: beq 12d0
+    if (Z)
+        AOT_GOTO(0x12d0, L12d0);
+    AOT_GOTO(0x127e, L127e);
+L127e:
+    AOT_BLOCK(0x127e, 2);
+    // 127e: cmpb $28, (r4)
+    {
+        src = uint8_t(0x28);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1282: bne 1294
+    if (!Z)
+        AOT_GOTO(0x1294, L1294);
+    AOT_GOTO(0x1284, L1284);
+L1284:
+    AOT_BLOCK(0x1284, 2);
+    // 1284: cmpb $72, 1(r4)
+    {
+        src = uint8_t(0x72);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 128a: bne 129a
+    if (!Z)
+        AOT_GOTO(0x129a, L129a);
+    AOT_GOTO(0x128c, L128c);
+L128c:
+    AOT_BLOCK(0x128c, 2);
+    // 128c: cmpb $35, 2(r4)
+    {
+        src = uint8_t(0x35);
+        b = uint16_t(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1292: bne 129a
+    if (!Z)
+        AOT_GOTO(0x129a, L129a);
+    AOT_GOTO(0x1294, L1294);
+L1294:
+    AOT_BLOCK(0x1294, 2);
+    // 1294: cmpb $2a, (r4)+
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1298: bne 12ce
+    if (!Z)
+        AOT_GOTO(0x12ce, L12ce);
+    AOT_GOTO(0x129a, L129a);
+L129a:
+    AOT_BLOCK(0x129a, 1);
+    // 129a: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x129e, L129e);
+L129e:
+    AOT_BLOCK(0x129e, 4);
+    // 129e: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 12a2: add $5, r0
+    {
+        src = uint16_t(0x0005);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 12a6: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12a8: bge 12cc
+    if (!(N ^ V))
+        AOT_GOTO(0x12cc, L12cc);
+    AOT_GOTO(0x12aa, L12aa);
+L12aa:
+    AOT_BLOCK(0x12aa, 5);
+    // 12aa: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 12ac: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 12b0: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 12b2: cmpb $24, 23c8(r0)
+    {
+        src = uint8_t(0x24);
+        b = uint16_t(r[0] + 9160);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 12b8: beq 12c4
+    if (Z)
+        AOT_GOTO(0x12c4, L12c4);
+    AOT_GOTO(0x12ba, L12ba);
+L12ba:
+    AOT_BLOCK(0x12ba, 3);
+    // 12ba: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 12bc: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 12c0: clrb 23c8(r1)
+    {
+        a = uint16_t(r[1] + 9160);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x12c4, L12c4);
+L12c4:
+    AOT_BLOCK(0x12c4, 3);
+    // 12c4: clrb 24b8
+    {
+        a = 0x24b8;
+        WR8(a, 0);
+        C = false;
+    }
+    // 12c8: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 12ca: br 129e
+    AOT_GOTO(0x129e, L129e);
+L12cc:
+    AOT_BLOCK(0x12cc, 1);
+    // 12cc: br 12d0
+    AOT_GOTO(0x12d0, L12d0);
+L12ce:
+    AOT_BLOCK(0x12ce, 1);
+    // 12ce: br 127a
+    AOT_GOTO(0x127a, L127a);
+L12d0:
+    AOT_BLOCK(0x12d0, 2);
+    // 12d0: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12d4:
+    AOT_BLOCK(0x12d4, 5);
+    // 12d4: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x12d8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 12d8: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 12dc: mov a(r0), r4
+    {
+        a = uint16_t(r[0] + 10);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 12e0: mov $2490, r3
+    {
+        src = uint16_t(0x2490);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x12e4, L12e4);
+L12e4:
+    AOT_BLOCK(0x12e4, 2);
+    // 12e4: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 12e6: beq 12ea
+    if (Z)
+        AOT_GOTO(0x12ea, L12ea);
+    AOT_GOTO(0x12e8, L12e8);
+L12e8:
+    AOT_BLOCK(0x12e8, 1);
+    // 12e8: br 12e4
+    AOT_GOTO(0x12e4, L12e4);
+L12ea:
+    AOT_BLOCK(0x12ea, 3);
+    // 12ea: clrb 24a4
+    {
+        a = 0x24a4;
+        WR8(a, 0);
+        C = false;
+    }
+    // 12ee: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12f2:
+    AOT_BLOCK(0x12f2, 5);
+    // 12f2: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x12f6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 12f6: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 12fa: mov a(r2), r4
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 12fe: mov $2490, r3
+    {
+        src = uint16_t(0x2490);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1302, L1302);
+L1302:
+    AOT_BLOCK(0x1302, 2);
+    // 1302: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1304: beq 1310
+    if (Z)
+        AOT_GOTO(0x1310, L1310);
+    AOT_GOTO(0x1306, L1306);
+L1306:
+    AOT_BLOCK(0x1306, 2);
+    // 1306: cmpb $2c, (r4)
+    {
+        src = uint8_t(0x2c);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 130a: beq 1310
+    if (Z)
+        AOT_GOTO(0x1310, L1310);
+    AOT_GOTO(0x130c, L130c);
+L130c:
+    AOT_BLOCK(0x130c, 2);
+    // 130c: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 130e: br 1302
+    AOT_GOTO(0x1302, L1302);
+L1310:
+    AOT_BLOCK(0x1310, 5);
+    // 1310: clrb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        WR8(a, 0);
+    }
+    // 1312: mov $24a4, r3
+    {
+        src = uint16_t(0x24a4);
+        r[3] = src;
+    }
+    // 1316: clrb (r3)
+    {
+        a = r[3];
+        WR8(a, 0);
+    }
+    // 1318: cmpb $2c, (r4)+
+    {
+        src = uint8_t(0x2c);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 131c: bne 1324
+    if (!Z)
+        AOT_GOTO(0x1324, L1324);
+    AOT_GOTO(0x131e, L131e);
+L131e:
+    AOT_BLOCK(0x131e, 2);
+    // 131e: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1320: beq 1324
+    if (Z)
+        AOT_GOTO(0x1324, L1324);
+    AOT_GOTO(0x1322, L1322);
+L1322:
+    AOT_BLOCK(0x1322, 1);
+    // 1322: br 131e
+    AOT_GOTO(0x131e, L131e);
+L1324:
+    AOT_BLOCK(0x1324, 2);
+    // 1324: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1328:
+    AOT_BLOCK(0x1328, 3);
+    // 1328: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x132c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 132c: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1330, L1330);
+L1330:
+    AOT_BLOCK(0x1330, 4);
+    // 1330: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1334: add $5, r0
+    {
+        src = uint16_t(0x0005);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1338: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 133a: bge 135e
+    if (!(N ^ V))
+        AOT_GOTO(0x135e, L135e);
+    AOT_GOTO(0x133c, L133c);
+L133c:
+    AOT_BLOCK(0x133c, 6);
+    // 133c: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1340: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 1342: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1346: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1348: add $23c8, (sp)
+    {
+        src = uint16_t(0x23c8);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 134c: jsr pc, *$186a
+    {
+        a = 0x186a;
+        r[6] -= 2;
+        WR16(r[6], 0x1350);
+    }
+    AOT_GOTO(0x186a, L186a);
+L1350:
+    AOT_BLOCK(0x1350, 3);
+    // 1350: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1352: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1354: beq 135a
+    if (Z)
+        AOT_GOTO(0x135a, L135a);
+    AOT_GOTO(0x1356, L1356);
+L1356:
+    AOT_BLOCK(0x1356, 2);
+    // 1356: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1358: br 1364
+    AOT_GOTO(0x1364, L1364);
+L135a:
+    AOT_BLOCK(0x135a, 2);
+    // 135a: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 135c: br 1330
+    AOT_GOTO(0x1330, L1330);
+L135e:
+    AOT_BLOCK(0x135e, 2);
+    // 135e: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1362: br 1364
+    AOT_GOTO(0x1364, L1364);
+L1364:
+    AOT_BLOCK(0x1364, 2);
+    // 1364: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1368:
+    AOT_BLOCK(0x1368, 5);
+    // 1368: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x136c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 136c: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1370: cmpb $72, (r4)
+    {
+        src = uint8_t(0x72);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1374: bne 1396
+    if (!Z)
+        AOT_GOTO(0x1396, L1396);
+    AOT_GOTO(0x1376, L1376);
+L1376:
+    AOT_BLOCK(0x1376, 2);
+    // 1376: cmpb $30, 1(r4)
+    {
+        src = uint8_t(0x30);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 137c: bgt 1396
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1396, L1396);
+    AOT_GOTO(0x137e, L137e);
+L137e:
+    AOT_BLOCK(0x137e, 2);
+    // 137e: cmpb $34, 1(r4)
+    {
+        src = uint8_t(0x34);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1384: blt 1396
+    if (N ^ V)
+        AOT_GOTO(0x1396, L1396);
+    AOT_GOTO(0x1386, L1386);
+L1386:
+    AOT_BLOCK(0x1386, 2);
+    // 1386: tstb 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 138a: bne 1396
+    if (!Z)
+        AOT_GOTO(0x1396, L1396);
+    AOT_GOTO(0x138c, L138c);
+L138c:
+    AOT_BLOCK(0x138c, 3);
+    // 138c: movb 1(r4), r0
+    {
+        a = uint16_t(r[4] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1390: add $ffd0, r0
+    {
+        src = uint16_t(0xffd0);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1394: br 139c
+    AOT_GOTO(0x139c, L139c);
+L1396:
+    AOT_BLOCK(0x1396, 2);
+    // 1396: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 139a: br 139c
+    AOT_GOTO(0x139c, L139c);
+L139c:
+    AOT_BLOCK(0x139c, 2);
+    // 139c: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13c6:
+    AOT_BLOCK(0x13c6, 6);
+    // 13c6: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x13ca;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 13ca: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 13ce: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 13d0: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 13d2: bne 13d8
+    if (!Z)
+        AOT_GOTO(0x13d8, L13d8);
+    AOT_GOTO(0x13d4, L13d4);
+L13d4:
+    AOT_BLOCK(0x13d4, 2);
+    // 13d4: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 13d6: br 1436
+    AOT_GOTO(0x1436, L1436);
+L13d8:
+    AOT_BLOCK(0x13d8, 2);
+    // 13d8: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 13da: beq 13de
+    if (Z)
+        AOT_GOTO(0x13de, L13de);
+    AOT_GOTO(0x13dc, L13dc);
+L13dc:
+    AOT_BLOCK(0x13dc, 1);
+    // 13dc: br 13d8
+    AOT_GOTO(0x13d8, L13d8);
+L13de:
+    AOT_BLOCK(0x13de, 2);
+    // 13de: cmpb $2d, (r4)
+    {
+        src = uint8_t(0x2d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 13e2: bne 13ec
+    if (!Z)
+        AOT_GOTO(0x13ec, L13ec);
+    AOT_GOTO(0x13e4, L13e4);
+L13e4:
+    AOT_BLOCK(0x13e4, 2);
+    // 13e4: cmpb $28, 1(r4)
+    {
+        src = uint8_t(0x28);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 13ea: beq 140a
+    if (Z)
+        AOT_GOTO(0x140a, L140a);
+    AOT_GOTO(0x13ec, L13ec);
+L13ec:
+    AOT_BLOCK(0x13ec, 2);
+    // 13ec: cmpb $2a, (r4)
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 13f0: bne 1402
+    if (!Z)
+        AOT_GOTO(0x1402, L1402);
+    AOT_GOTO(0x13f2, L13f2);
+L13f2:
+    AOT_BLOCK(0x13f2, 2);
+    // 13f2: cmpb $2d, 1(r4)
+    {
+        src = uint8_t(0x2d);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 13f8: bne 1402
+    if (!Z)
+        AOT_GOTO(0x1402, L1402);
+    AOT_GOTO(0x13fa, L13fa);
+L13fa:
+    AOT_BLOCK(0x13fa, 2);
+    // 13fa: cmpb $28, 2(r4)
+    {
+        src = uint8_t(0x28);
+        b = uint16_t(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1400: beq 140a
+    if (Z)
+        AOT_GOTO(0x140a, L140a);
+    AOT_GOTO(0x1402, L1402);
+L1402:
+    AOT_BLOCK(0x1402, 2);
+    // 1402: cmpb $2b, -2(r3)
+    {
+        src = uint8_t(0x2b);
+        b = uint16_t(r[3] + -2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1408: bne 1432
+    if (!Z)
+        AOT_GOTO(0x1432, L1432);
+    AOT_GOTO(0x140a, L140a);
+L140a:
+    AOT_BLOCK(0x140a, 2);
+    // 140a: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 140c: beq 1416
+    if (Z)
+        AOT_GOTO(0x1416, L1416);
+    AOT_GOTO(0x140e, L140e);
+L140e:
+    AOT_BLOCK(0x140e, 2);
+    // 140e: cmpb $72, (r4)+
+    {
+        src = uint8_t(0x72);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1412: beq 1416
+    if (Z)
+        AOT_GOTO(0x1416, L1416);
+    AOT_GOTO(0x1414, L1414);
+L1414:
+    AOT_BLOCK(0x1414, 1);
+    // 1414: br 140a
+    AOT_GOTO(0x140a, L140a);
+L1416:
+    AOT_BLOCK(0x1416, 2);
+    // 1416: cmpb $30, (r4)
+    {
+        src = uint8_t(0x30);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 141a: bgt 142c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x142c, L142c);
+    AOT_GOTO(0x141c, L141c);
+L141c:
+    AOT_BLOCK(0x141c, 2);
+    // 141c: cmpb $34, (r4)
+    {
+        src = uint8_t(0x34);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1420: blt 142c
+    if (N ^ V)
+        AOT_GOTO(0x142c, L142c);
+    AOT_GOTO(0x1422, L1422);
+L1422:
+    AOT_BLOCK(0x1422, 3);
+    // 1422: movb (r4), r1
+    {
+        a = r[4];
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 1424: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1428: clrb 2008(r1)
+    {
+        a = uint16_t(r[1] + 8200);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x142c, L142c);
+L142c:
+    AOT_BLOCK(0x142c, 2);
+    // 142c: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1430: br 1436
+    AOT_GOTO(0x1436, L1436);
+L1432:
+    AOT_BLOCK(0x1432, 2);
+    // 1432: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1434: br 1436
+    AOT_GOTO(0x1436, L1436);
+L1436:
+    AOT_BLOCK(0x1436, 2);
+    // 1436: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L143a:
+    AOT_BLOCK(0x143a, 5);
+    // 143a: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x143e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 143e: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 1440: tst 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1444: bne 144a
+    if (!Z)
+        AOT_GOTO(0x144a, L144a);
+    AOT_GOTO(0x1446, L1446);
+L1446:
+    AOT_BLOCK(0x1446, 1);
+    // 1446: jmp *$1460
+    {
+        a = 0x1460;
+    }
+    AOT_GOTO(0x1460, L1460);
+L144a:
+    AOT_BLOCK(0x144a, 3);
+    // 144a: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 144e: mov $24a4, -(sp)
+    {
+        src = uint16_t(0x24a4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1452: jsr pc, *$1328
+    {
+        a = 0x1328;
+        r[6] -= 2;
+        WR16(r[6], 0x1456);
+    }
+    AOT_GOTO(0x1328, L1328);
+L1456:
+    AOT_BLOCK(0x1456, 3);
+    // 1456: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1458: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 145c: jmp *$1466
+    {
+        a = 0x1466;
+    }
+    AOT_GOTO(0x1466, L1466);
+L1460:
+    AOT_BLOCK(0x1460, 1);
+    // 1460: mov $ffff, -8(r5)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1466, L1466);
+L1466:
+    AOT_BLOCK(0x1466, 3);
+    // 1466: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 146a: mov $2490, -(sp)
+    {
+        src = uint16_t(0x2490);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 146e: jsr pc, *$1328
+    {
+        a = 0x1328;
+        r[6] -= 2;
+        WR16(r[6], 0x1472);
+    }
+    AOT_GOTO(0x1328, L1328);
+L1472:
+    AOT_BLOCK(0x1472, 4);
+    // 1472: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1474: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1476: cmp $5, -8(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 147c: bgt 1484
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1484, L1484);
+    AOT_GOTO(0x147e, L147e);
+L147e:
+    AOT_BLOCK(0x147e, 1);
+    // 147e: sub $5, -8(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[5] + -8);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1484, L1484);
+L1484:
+    AOT_BLOCK(0x1484, 2);
+    // 1484: cmp $5, r4
+    {
+        src = uint16_t(0x0005);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1488: bgt 148e
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x148e, L148e);
+    AOT_GOTO(0x148a, L148a);
+L148a:
+    AOT_BLOCK(0x148a, 1);
+    // 148a: sub $5, r4
+    {
+        src = uint16_t(0x0005);
+        dst = r[4];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x148e, L148e);
+L148e:
+    AOT_BLOCK(0x148e, 2);
+    // 148e: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1490: bge 1498
+    if (!(N ^ V))
+        AOT_GOTO(0x1498, L1498);
+    AOT_GOTO(0x1492, L1492);
+L1492:
+    AOT_BLOCK(0x1492, 2);
+    // 1492: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1496: blt 1516
+    if (N ^ V)
+        AOT_GOTO(0x1516, L1516);
+    AOT_GOTO(0x1498, L1498);
+L1498:
+    AOT_BLOCK(0x1498, 2);
+    // 1498: mov $2490, r2
+    {
+        src = uint16_t(0x2490);
+        r[2] = src;
+    }
+    // 149c: mov $288e, r3
+    {
+        src = uint16_t(0x288e);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14a0, L14a0);
+L14a0:
+    AOT_BLOCK(0x14a0, 2);
+    // 14a0: movb (r2)+, (r3)+
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 14a2: beq 14a6
+    if (Z)
+        AOT_GOTO(0x14a6, L14a6);
+    AOT_GOTO(0x14a4, L14a4);
+L14a4:
+    AOT_BLOCK(0x14a4, 1);
+    // 14a4: br 14a0
+    AOT_GOTO(0x14a0, L14a0);
+L14a6:
+    AOT_BLOCK(0x14a6, 2);
+    // 14a6: tstb 24a4
+    {
+        a = 0x24a4;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 14aa: beq 14c0
+    if (Z)
+        AOT_GOTO(0x14c0, L14c0);
+    AOT_GOTO(0x14ac, L14ac);
+L14ac:
+    AOT_BLOCK(0x14ac, 3);
+    // 14ac: mov $28c0, r3
+    {
+        src = uint16_t(0x28c0);
+        r[3] = src;
+    }
+    // 14b0: movb $2c, (r3)+
+    {
+        src = uint8_t(0x2c);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 14b4: mov $24a4, r2
+    {
+        src = uint16_t(0x24a4);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14b8, L14b8);
+L14b8:
+    AOT_BLOCK(0x14b8, 2);
+    // 14b8: movb (r2)+, (r3)+
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 14ba: beq 14be
+    if (Z)
+        AOT_GOTO(0x14be, L14be);
+    AOT_GOTO(0x14bc, L14bc);
+L14bc:
+    AOT_BLOCK(0x14bc, 1);
+    // 14bc: br 14b8
+    AOT_GOTO(0x14b8, L14b8);
+L14be:
+    AOT_BLOCK(0x14be, 1);
+    // 14be: br 14c4
+    AOT_GOTO(0x14c4, L14c4);
+L14c0:
+    AOT_BLOCK(0x14c0, 1);
+    // 14c0: clrb 28c0
+    {
+        a = 0x28c0;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x14c4, L14c4);
+L14c4:
+    AOT_BLOCK(0x14c4, 2);
+    // 14c4: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 14c6: blt 14e0
+    if (N ^ V)
+        AOT_GOTO(0x14e0, L14e0);
+    AOT_GOTO(0x14c8, L14c8);
+L14c8:
+    AOT_BLOCK(0x14c8, 6);
+    // 14c8: movb $72, 288e
+    {
+        src = uint8_t(0x72);
+        b = 0x288e;
+        WR8(b, src);
+    }
+    // 14ce: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 14d0: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 14d4: movb r0, 288f
+    {
+        src = uint8_t(r[0]);
+        b = 0x288f;
+        WR8(b, src);
+    }
+    // 14d8: clrb 2890
+    {
+        a = 0x2890;
+        WR8(a, 0);
+        C = false;
+    }
+    // 14dc: inc 23a0
+    {
+        a = 0x23a0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x14e0, L14e0);
+L14e0:
+    AOT_BLOCK(0x14e0, 2);
+    // 14e0: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 14e4: blt 1500
+    if (N ^ V)
+        AOT_GOTO(0x1500, L1500);
+    AOT_GOTO(0x14e6, L14e6);
+L14e6:
+    AOT_BLOCK(0x14e6, 6);
+    // 14e6: movb $72, 28c1
+    {
+        src = uint8_t(0x72);
+        b = 0x28c1;
+        WR8(b, src);
+    }
+    // 14ec: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 14f0: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 14f4: movb r0, 28c2
+    {
+        src = uint8_t(r[0]);
+        b = 0x28c2;
+        WR8(b, src);
+    }
+    // 14f8: clrb 28c3
+    {
+        a = 0x28c3;
+        WR8(a, 0);
+        C = false;
+    }
+    // 14fc: inc 23a0
+    {
+        a = 0x23a0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1500, L1500);
+L1500:
+    AOT_BLOCK(0x1500, 3);
+    // 1500: mov $28c0, (sp)
+    {
+        src = uint16_t(0x28c0);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1504: mov $288e, -(sp)
+    {
+        src = uint16_t(0x288e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1508: jsr pc, *$055e
+    {
+        a = 0x055e;
+        r[6] -= 2;
+        WR16(r[6], 0x150c);
+    }
+    AOT_GOTO(0x055e, L055e);
+L150c:
+    AOT_BLOCK(0x150c, 3);
+    // 150c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 150e: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1512: mov r0, a(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1516, L1516);
+L1516:
+    AOT_BLOCK(0x1516, 2);
+    // 1516: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L151a:
+    AOT_BLOCK(0x151a, 5);
+    // 151a: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x151e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 151e: sub $12, sp
+    {
+        src = uint16_t(0x0012);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1522: tst 2390
+    {
+        a = 0x2390;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1526: bne 152c
+    if (!Z)
+        AOT_GOTO(0x152c, L152c);
+    AOT_GOTO(0x1528, L1528);
+L1528:
+    AOT_BLOCK(0x1528, 1);
+    // 1528: jmp *$1614
+    {
+        a = 0x1614;
+    }
+    AOT_GOTO(0x1614, L1614);
+L152c:
+    AOT_BLOCK(0x152c, 4);
+    // 152c: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 152e: add $ffea, r0
+    {
+        src = uint16_t(0xffea);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1532: mov r0, -18(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -24);
+        WR16(b, src);
+    }
+    // 1536: mov 2390, r4
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x153a, L153a);
+L153a:
+    AOT_BLOCK(0x153a, 2);
+    // 153a: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 153c: beq 1596
+    if (Z)
+        AOT_GOTO(0x1596, L1596);
+    AOT_GOTO(0x153e, L153e);
+L153e:
+    AOT_BLOCK(0x153e, 2);
+    // 153e: cmpb $1f, (r4)
+    {
+        src = uint8_t(0x1f);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1542: bne 1590
+    if (!Z)
+        AOT_GOTO(0x1590, L1590);
+    AOT_GOTO(0x1544, L1544);
+L1544:
+    AOT_BLOCK(0x1544, 1);
+    // 1544: mov 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1548, L1548);
+L1548:
+    AOT_BLOCK(0x1548, 2);
+    // 1548: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 154a: beq 1558
+    if (Z)
+        AOT_GOTO(0x1558, L1558);
+    AOT_GOTO(0x154c, L154c);
+L154c:
+    AOT_BLOCK(0x154c, 2);
+    // 154c: cmpb $1e, (r3)
+    {
+        src = uint8_t(0x1e);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1550: beq 1558
+    if (Z)
+        AOT_GOTO(0x1558, L1558);
+    AOT_GOTO(0x1552, L1552);
+L1552:
+    AOT_BLOCK(0x1552, 2);
+    // 1552: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1556: br 1548
+    AOT_GOTO(0x1548, L1548);
+L1558:
+    AOT_BLOCK(0x1558, 2);
+    // 1558: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 155a: beq 1596
+    if (Z)
+        AOT_GOTO(0x1596, L1596);
+    AOT_GOTO(0x155c, L155c);
+L155c:
+    AOT_BLOCK(0x155c, 11);
+    // 155c: mov 4(r4), -8(r5)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1562: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1566: mov 2(r3), 2(r0)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 156c: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1570: mov -8(r5), 4(r0)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 1576: clr 2(r3)
+    {
+        a = uint16_t(r[3] + 2);
+        WR16(a, 0);
+        C = false;
+    }
+    // 157a: mov -18(r5), r0
+    {
+        a = uint16_t(r[5] + -24);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 157e: mov r4, 2(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 1582: mov -18(r5), 4(r4)
+    {
+        a = uint16_t(r[5] + -24);
+        src = RD16(a);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 1588: mov -8(r5), r4
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 158c: mov r3, -18(r5)
+    {
+        src = r[3];
+        b = uint16_t(r[5] + -24);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1590, L1590);
+L1590:
+    AOT_BLOCK(0x1590, 2);
+    // 1590: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1594: br 153a
+    AOT_GOTO(0x153a, L153a);
+L1596:
+    AOT_BLOCK(0x1596, 2);
+    // 1596: tst -14(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 159a: beq 15c0
+    if (Z)
+        AOT_GOTO(0x15c0, L15c0);
+    AOT_GOTO(0x159c, L159c);
+L159c:
+    AOT_BLOCK(0x159c, 7);
+    // 159c: mov -18(r5), r0
+    {
+        a = uint16_t(r[5] + -24);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 15a0: mov 2390, 2(r0)
+    {
+        a = 0x2390;
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 15a6: mov 2390, r0
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 15aa: mov -18(r5), 4(r0)
+    {
+        a = uint16_t(r[5] + -24);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 15b0: mov -14(r5), r0
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 15b4: mov $238e, 4(r0)
+    {
+        src = uint16_t(0x238e);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 15ba: mov -14(r5), 2390
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        b = 0x2390;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15c0, L15c0);
+L15c0:
+    AOT_BLOCK(0x15c0, 2);
+    // 15c0: mov $ffff, r2
+    {
+        src = uint16_t(0xffff);
+        r[2] = src;
+    }
+    // 15c4: mov 2390, r4
+    {
+        a = 0x2390;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15c8, L15c8);
+L15c8:
+    AOT_BLOCK(0x15c8, 2);
+    // 15c8: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 15ca: beq 1614
+    if (Z)
+        AOT_GOTO(0x1614, L1614);
+    AOT_GOTO(0x15cc, L15cc);
+L15cc:
+    AOT_BLOCK(0x15cc, 2);
+    // 15cc: cmpb $1e, (r4)
+    {
+        src = uint8_t(0x1e);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 15d0: beq 15de
+    if (Z)
+        AOT_GOTO(0x15de, L15de);
+    AOT_GOTO(0x15d2, L15d2);
+L15d2:
+    AOT_BLOCK(0x15d2, 2);
+    // 15d2: cmpb $1f, (r4)
+    {
+        src = uint8_t(0x1f);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 15d6: beq 15de
+    if (Z)
+        AOT_GOTO(0x15de, L15de);
+    AOT_GOTO(0x15d8, L15d8);
+L15d8:
+    AOT_BLOCK(0x15d8, 2);
+    // 15d8: cmpb $20, (r4)
+    {
+        src = uint8_t(0x20);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 15dc: bne 160e
+    if (!Z)
+        AOT_GOTO(0x160e, L160e);
+    AOT_GOTO(0x15de, L15de);
+L15de:
+    AOT_BLOCK(0x15de, 3);
+    // 15de: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 15e0: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 15e2: beq 15f2
+    if (Z)
+        AOT_GOTO(0x15f2, L15f2);
+    AOT_GOTO(0x15e4, L15e4);
+L15e4:
+    AOT_BLOCK(0x15e4, 2);
+    // 15e4: tst 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 15e8: beq 160c
+    if (Z)
+        AOT_GOTO(0x160c, L160c);
+    AOT_GOTO(0x15ea, L15ea);
+L15ea:
+    AOT_BLOCK(0x15ea, 3);
+    // 15ea: movb *2(r4), r0
+    {
+        a = RD16(r[4] + 2);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 15ee: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 15f0: bne 160c
+    if (!Z)
+        AOT_GOTO(0x160c, L160c);
+    AOT_GOTO(0x15f2, L15f2);
+L15f2:
+    AOT_BLOCK(0x15f2, 6);
+    // 15f2: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 15f6: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 15fc: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1600: mov 4(r4), 4(r0)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 1606: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 160a: br 160e
+    AOT_GOTO(0x160e, L160e);
+L160c:
+    AOT_BLOCK(0x160c, 1);
+    // 160c: movb (r4), r2
+    {
+        a = r[4];
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x160e, L160e);
+L160e:
+    AOT_BLOCK(0x160e, 2);
+    // 160e: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1612: br 15c8
+    AOT_GOTO(0x15c8, L15c8);
+L1614:
+    AOT_BLOCK(0x1614, 2);
+    // 1614: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1618:
+    AOT_BLOCK(0x1618, 6);
+    // 1618: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x161c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 161c: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 161e: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1622: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1624: beq 16b6
+    if (Z)
+        AOT_GOTO(0x16b6, L16b6);
+    AOT_GOTO(0x1626, L1626);
+L1626:
+    AOT_BLOCK(0x1626, 2);
+    // 1626: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1628: jsr pc, *$114e
+    {
+        a = 0x114e;
+        r[6] -= 2;
+        WR16(r[6], 0x162c);
+    }
+    AOT_GOTO(0x114e, L114e);
+L162c:
+    AOT_BLOCK(0x162c, 3);
+    // 162c: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 162e: cmpb $10, (r3)
+    {
+        src = uint8_t(0x10);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1632: bne 164a
+    if (!Z)
+        AOT_GOTO(0x164a, L164a);
+    AOT_GOTO(0x1634, L1634);
+L1634:
+    AOT_BLOCK(0x1634, 2);
+    // 1634: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1636: jsr pc, *$12d4
+    {
+        a = 0x12d4;
+        r[6] -= 2;
+        WR16(r[6], 0x163a);
+    }
+    AOT_GOTO(0x12d4, L12d4);
+L163a:
+    AOT_BLOCK(0x163a, 3);
+    // 163a: mov $212a, (sp)
+    {
+        src = uint16_t(0x212a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 163e: mov $b, -(sp)
+    {
+        src = uint16_t(0x000b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1642: jsr pc, *$11ec
+    {
+        a = 0x11ec;
+        r[6] -= 2;
+        WR16(r[6], 0x1646);
+    }
+    AOT_GOTO(0x11ec, L11ec);
+L1646:
+    AOT_BLOCK(0x1646, 2);
+    // 1646: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1648: br 165a
+    AOT_GOTO(0x165a, L165a);
+L164a:
+    AOT_BLOCK(0x164a, 2);
+    // 164a: cmpb $14, (r3)
+    {
+        src = uint8_t(0x14);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 164e: bne 1658
+    if (!Z)
+        AOT_GOTO(0x1658, L1658);
+    AOT_GOTO(0x1650, L1650);
+L1650:
+    AOT_BLOCK(0x1650, 2);
+    // 1650: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1652: jsr pc, *$12f2
+    {
+        a = 0x12f2;
+        r[6] -= 2;
+        WR16(r[6], 0x1656);
+    }
+    AOT_GOTO(0x12f2, L12f2);
+L1656:
+    AOT_BLOCK(0x1656, 1);
+    // 1656: br 165a
+    AOT_GOTO(0x165a, L165a);
+L1658:
+    AOT_BLOCK(0x1658, 1);
+    // 1658: br 16b6
+    AOT_GOTO(0x16b6, L16b6);
+L165a:
+    AOT_BLOCK(0x165a, 2);
+    // 165a: cmpb $2, *2(r3)
+    {
+        src = uint8_t(0x02);
+        b = RD16(r[3] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1660: bne 16b6
+    if (!Z)
+        AOT_GOTO(0x16b6, L16b6);
+    AOT_GOTO(0x1662, L1662);
+L1662:
+    AOT_BLOCK(0x1662, 2);
+    // 1662: mov $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1666: jsr pc, *$16ba
+    {
+        a = 0x16ba;
+        r[6] -= 2;
+        WR16(r[6], 0x166a);
+    }
+    AOT_GOTO(0x16ba, L16ba);
+L166a:
+    AOT_BLOCK(0x166a, 3);
+    // 166a: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 166c: mov $b, (sp)
+    {
+        src = uint16_t(0x000b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1670: jsr pc, *$16ba
+    {
+        a = 0x16ba;
+        r[6] -= 2;
+        WR16(r[6], 0x1674);
+    }
+    AOT_GOTO(0x16ba, L16ba);
+L1674:
+    AOT_BLOCK(0x1674, 7);
+    // 1674: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1678: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 167c: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1680: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1682: movb 1(r3), r0
+    {
+        a = uint16_t(r[3] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1686: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1688: jsr pc, *$170e
+    {
+        a = 0x170e;
+        r[6] -= 2;
+        WR16(r[6], 0x168c);
+    }
+    AOT_GOTO(0x170e, L170e);
+L168c:
+    AOT_BLOCK(0x168c, 3);
+    // 168c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 168e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1690: beq 16b6
+    if (Z)
+        AOT_GOTO(0x16b6, L16b6);
+    AOT_GOTO(0x1692, L1692);
+L1692:
+    AOT_BLOCK(0x1692, 4);
+    // 1692: inc 23b2
+    {
+        a = 0x23b2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1696: inc 23be
+    {
+        a = 0x23be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 169a: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 169e: jsr pc, *$1120
+    {
+        a = 0x1120;
+        r[6] -= 2;
+        WR16(r[6], 0x16a2);
+    }
+    AOT_GOTO(0x1120, L1120);
+L16a2:
+    AOT_BLOCK(0x16a2, 4);
+    // 16a2: mov 6(r3), 6(r4)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 16a8: mov 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 16ae: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 16b2: inc c(r0)
+    {
+        a = uint16_t(r[0] + 12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x16b6, L16b6);
+L16b6:
+    AOT_BLOCK(0x16b6, 2);
+    // 16b6: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L16ba:
+    AOT_BLOCK(0x16ba, 8);
+    // 16ba: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x16be;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 16be: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 16c2: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 16c6: mov r1, r4
+    {
+        src = r[1];
+        r[4] = src;
+    }
+    // 16c8: add $23c8, r4
+    {
+        src = uint16_t(0x23c8);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+    }
+    // 16cc: cmpb $24, (r4)
+    {
+        src = uint8_t(0x24);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 16d0: bne 16d6
+    if (!Z)
+        AOT_GOTO(0x16d6, L16d6);
+    AOT_GOTO(0x16d2, L16d2);
+L16d2:
+    AOT_BLOCK(0x16d2, 2);
+    // 16d2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16d4: br 170a
+    AOT_GOTO(0x170a, L170a);
+L16d6:
+    AOT_BLOCK(0x16d6, 2);
+    // 16d6: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16d8: jsr pc, *$1368
+    {
+        a = 0x1368;
+        r[6] -= 2;
+        WR16(r[6], 0x16dc);
+    }
+    AOT_GOTO(0x1368, L1368);
+L16dc:
+    AOT_BLOCK(0x16dc, 3);
+    // 16dc: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 16de: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 16e0: blt 16f0
+    if (N ^ V)
+        AOT_GOTO(0x16f0, L16f0);
+    AOT_GOTO(0x16e2, L16e2);
+L16e2:
+    AOT_BLOCK(0x16e2, 5);
+    // 16e2: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 16e4: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 16e8: add $23c8, r1
+    {
+        src = uint16_t(0x23c8);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 16ec: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16ee: br 170a
+    AOT_GOTO(0x170a, L170a);
+L16f0:
+    AOT_BLOCK(0x16f0, 3);
+    // 16f0: mov $24b8, (sp)
+    {
+        src = uint16_t(0x24b8);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 16f4: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16f6: jsr pc, *$186a
+    {
+        a = 0x186a;
+        r[6] -= 2;
+        WR16(r[6], 0x16fa);
+    }
+    AOT_GOTO(0x186a, L186a);
+L16fa:
+    AOT_BLOCK(0x16fa, 3);
+    // 16fa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 16fc: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 16fe: beq 1706
+    if (Z)
+        AOT_GOTO(0x1706, L1706);
+    AOT_GOTO(0x1700, L1700);
+L1700:
+    AOT_BLOCK(0x1700, 2);
+    // 1700: mov $24cc, r0
+    {
+        src = uint16_t(0x24cc);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1704: br 170a
+    AOT_GOTO(0x170a, L170a);
+L1706:
+    AOT_BLOCK(0x1706, 2);
+    // 1706: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1708: br 170a
+    AOT_GOTO(0x170a, L170a);
+L170a:
+    AOT_BLOCK(0x170a, 2);
+    // 170a: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L170e:
+    AOT_BLOCK(0x170e, 7);
+    // 170e: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1712;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 1712: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 1714: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1718: mov 8(r5), r3
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 171c: cmpb $24, (r4)+
+    {
+        src = uint8_t(0x24);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1720: bne 1728
+    if (!Z)
+        AOT_GOTO(0x1728, L1728);
+    AOT_GOTO(0x1722, L1722);
+L1722:
+    AOT_BLOCK(0x1722, 2);
+    // 1722: cmpb $24, (r3)+
+    {
+        src = uint8_t(0x24);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1726: beq 172e
+    if (Z)
+        AOT_GOTO(0x172e, L172e);
+    AOT_GOTO(0x1728, L1728);
+L1728:
+    AOT_BLOCK(0x1728, 2);
+    // 1728: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 172a: jmp *$1832
+    {
+        a = 0x1832;
+    }
+    AOT_GOTO(0x1832, L1832);
+L172e:
+    AOT_BLOCK(0x172e, 1);
+    // 172e: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1730, L1730);
+L1730:
+    AOT_BLOCK(0x1730, 2);
+    // 1730: cmpb $30, (r3)
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1734: bgt 174a
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x174a, L174a);
+    AOT_GOTO(0x1736, L1736);
+L1736:
+    AOT_BLOCK(0x1736, 2);
+    // 1736: cmpb $37, (r3)
+    {
+        src = uint8_t(0x37);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 173a: blt 174a
+    if (N ^ V)
+        AOT_GOTO(0x174a, L174a);
+    AOT_GOTO(0x173c, L173c);
+L173c:
+    AOT_BLOCK(0x173c, 5);
+    // 173c: ash $3, r2
+    {
+        src = uint16_t(0x0003) & 077;
+        val16 = r[2];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1740: movb (r3)+, r0
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1742: add $ffd0, r0
+    {
+        src = uint16_t(0xffd0);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1746: add r0, r2
+    {
+        src = r[0];
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1748: br 1730
+    AOT_GOTO(0x1730, L1730);
+L174a:
+    AOT_BLOCK(0x174a, 2);
+    // 174a: mov r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 174e: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1750, L1750);
+L1750:
+    AOT_BLOCK(0x1750, 2);
+    // 1750: cmpb $30, (r4)
+    {
+        src = uint8_t(0x30);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1754: bgt 176a
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x176a, L176a);
+    AOT_GOTO(0x1756, L1756);
+L1756:
+    AOT_BLOCK(0x1756, 2);
+    // 1756: cmpb $37, (r4)
+    {
+        src = uint8_t(0x37);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 175a: blt 176a
+    if (N ^ V)
+        AOT_GOTO(0x176a, L176a);
+    AOT_GOTO(0x175c, L175c);
+L175c:
+    AOT_BLOCK(0x175c, 5);
+    // 175c: ash $3, r2
+    {
+        src = uint16_t(0x0003) & 077;
+        val16 = r[2];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1760: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1762: add $ffd0, r0
+    {
+        src = uint16_t(0xffd0);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1766: add r0, r2
+    {
+        src = r[0];
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1768: br 1750
+    AOT_GOTO(0x1750, L1750);
+L176a:
+    AOT_BLOCK(0x176a, 2);
+    // 176a: cmpb $2b, (r4)
+    {
+        src = uint8_t(0x2b);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 176e: bne 1772
+    if (!Z)
+        AOT_GOTO(0x1772, L1772);
+    AOT_GOTO(0x1770, L1770);
+L1770:
+    AOT_BLOCK(0x1770, 1);
+    // 1770: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1772, L1772);
+L1772:
+    AOT_BLOCK(0x1772, 2);
+    // 1772: cmpb $2b, (r3)
+    {
+        src = uint8_t(0x2b);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1776: bne 177a
+    if (!Z)
+        AOT_GOTO(0x177a, L177a);
+    AOT_GOTO(0x1778, L1778);
+L1778:
+    AOT_BLOCK(0x1778, 1);
+    // 1778: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x177a, L177a);
+L177a:
+    AOT_BLOCK(0x177a, 2);
+    // 177a: cmpb (r3), (r4)+
+    {
+        a = r[3];
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 177c: beq 1784
+    if (Z)
+        AOT_GOTO(0x1784, L1784);
+    AOT_GOTO(0x177e, L177e);
+L177e:
+    AOT_BLOCK(0x177e, 2);
+    // 177e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1780: jmp *$1832
+    {
+        a = 0x1832;
+    }
+    AOT_GOTO(0x1832, L1832);
+L1784:
+    AOT_BLOCK(0x1784, 2);
+    // 1784: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1786: bne 177a
+    if (!Z)
+        AOT_GOTO(0x177a, L177a);
+    AOT_GOTO(0x1788, L1788);
+L1788:
+    AOT_BLOCK(0x1788, 4);
+    // 1788: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+    }
+    // 178a: mov -8(r5), r3
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 178e: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1792: br 1822
+    AOT_GOTO(0x1822, L1822);
+L1794:
+    AOT_BLOCK(0x1794, 2);
+    // 1794: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1796: beq 179c
+    if (Z)
+        AOT_GOTO(0x179c, L179c);
+    AOT_GOTO(0x1798, L1798);
+L1798:
+    AOT_BLOCK(0x1798, 2);
+    // 1798: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 179a: br 17a0
+    AOT_GOTO(0x17a0, L17a0);
+L179c:
+    AOT_BLOCK(0x179c, 1);
+    // 179c: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17a0, L17a0);
+L17a0:
+    AOT_BLOCK(0x17a0, 1);
+    // 17a0: br 1832
+    AOT_GOTO(0x1832, L1832);
+L17a2:
+    AOT_BLOCK(0x17a2, 2);
+    // 17a2: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17a4: bne 17aa
+    if (!Z)
+        AOT_GOTO(0x17aa, L17aa);
+    AOT_GOTO(0x17a6, L17a6);
+L17a6:
+    AOT_BLOCK(0x17a6, 2);
+    // 17a6: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 17a8: br 17ae
+    AOT_GOTO(0x17ae, L17ae);
+L17aa:
+    AOT_BLOCK(0x17aa, 1);
+    // 17aa: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17ae, L17ae);
+L17ae:
+    AOT_BLOCK(0x17ae, 1);
+    // 17ae: br 1832
+    AOT_GOTO(0x1832, L1832);
+L17b0:
+    AOT_BLOCK(0x17b0, 2);
+    // 17b0: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17b2: bge 17b8
+    if (!(N ^ V))
+        AOT_GOTO(0x17b8, L17b8);
+    AOT_GOTO(0x17b4, L17b4);
+L17b4:
+    AOT_BLOCK(0x17b4, 2);
+    // 17b4: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 17b6: br 17bc
+    AOT_GOTO(0x17bc, L17bc);
+L17b8:
+    AOT_BLOCK(0x17b8, 1);
+    // 17b8: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17bc, L17bc);
+L17bc:
+    AOT_BLOCK(0x17bc, 1);
+    // 17bc: br 1832
+    AOT_GOTO(0x1832, L1832);
+L17be:
+    AOT_BLOCK(0x17be, 2);
+    // 17be: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17c0: ble 17c6
+    if (Z || (N ^ V))
+        AOT_GOTO(0x17c6, L17c6);
+    AOT_GOTO(0x17c2, L17c2);
+L17c2:
+    AOT_BLOCK(0x17c2, 2);
+    // 17c2: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 17c4: br 17ca
+    AOT_GOTO(0x17ca, L17ca);
+L17c6:
+    AOT_BLOCK(0x17c6, 1);
+    // 17c6: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17ca, L17ca);
+L17ca:
+    AOT_BLOCK(0x17ca, 1);
+    // 17ca: br 1832
+    AOT_GOTO(0x1832, L1832);
+L17cc:
+    AOT_BLOCK(0x17cc, 2);
+    // 17cc: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17ce: bgt 17d4
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x17d4, L17d4);
+    AOT_GOTO(0x17d0, L17d0);
+L17d0:
+    AOT_BLOCK(0x17d0, 2);
+    // 17d0: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 17d2: br 17d8
+    AOT_GOTO(0x17d8, L17d8);
+L17d4:
+    AOT_BLOCK(0x17d4, 1);
+    // 17d4: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17d8, L17d8);
+L17d8:
+    AOT_BLOCK(0x17d8, 1);
+    // 17d8: br 1832
+    AOT_GOTO(0x1832, L1832);
+L17da:
+    AOT_BLOCK(0x17da, 2);
+    // 17da: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17dc: blt 17e2
+    if (N ^ V)
+        AOT_GOTO(0x17e2, L17e2);
+    AOT_GOTO(0x17de, L17de);
+L17de:
+    AOT_BLOCK(0x17de, 2);
+    // 17de: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 17e0: br 17e6
+    AOT_GOTO(0x17e6, L17e6);
+L17e2:
+    AOT_BLOCK(0x17e2, 1);
+    // 17e2: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17e6, L17e6);
+L17e6:
+    AOT_BLOCK(0x17e6, 1);
+    // 17e6: br 1832
+    AOT_GOTO(0x1832, L1832);
+L17e8:
+    AOT_BLOCK(0x17e8, 2);
+    // 17e8: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17ea: bhi 17f0
+    if (!(C | Z))
+        AOT_GOTO(0x17f0, L17f0);
+    AOT_GOTO(0x17ec, L17ec);
+L17ec:
+    AOT_BLOCK(0x17ec, 2);
+    // 17ec: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 17ee: br 17f4
+    AOT_GOTO(0x17f4, L17f4);
+L17f0:
+    AOT_BLOCK(0x17f0, 1);
+    // 17f0: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17f4, L17f4);
+L17f4:
+    AOT_BLOCK(0x17f4, 1);
+    // 17f4: br 1832
+    AOT_GOTO(0x1832, L1832);
+L17f6:
+    AOT_BLOCK(0x17f6, 2);
+    // 17f6: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17f8: bcs 17fe
+    if (C)
+        AOT_GOTO(0x17fe, L17fe);
+    AOT_GOTO(0x17fa, L17fa);
+L17fa:
+    AOT_BLOCK(0x17fa, 2);
+    // 17fa: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 17fc: br 1802
+    AOT_GOTO(0x1802, L1802);
+L17fe:
+    AOT_BLOCK(0x17fe, 1);
+    // 17fe: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1802, L1802);
+L1802:
+    AOT_BLOCK(0x1802, 1);
+    // 1802: br 1832
+    AOT_GOTO(0x1832, L1832);
+L1804:
+    AOT_BLOCK(0x1804, 2);
+    // 1804: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1806: bcc 180c
+    if (!C)
+        AOT_GOTO(0x180c, L180c);
+    AOT_GOTO(0x1808, L1808);
+L1808:
+    AOT_BLOCK(0x1808, 2);
+    // 1808: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 180a: br 1810
+    AOT_GOTO(0x1810, L1810);
+L180c:
+    AOT_BLOCK(0x180c, 1);
+    // 180c: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1810, L1810);
+L1810:
+    AOT_BLOCK(0x1810, 1);
+    // 1810: br 1832
+    AOT_GOTO(0x1832, L1832);
+L1812:
+    AOT_BLOCK(0x1812, 2);
+    // 1812: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1814: blos 181a
+    if (C | Z)
+        AOT_GOTO(0x181a, L181a);
+    AOT_GOTO(0x1816, L1816);
+L1816:
+    AOT_BLOCK(0x1816, 2);
+    // 1816: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1818: br 181e
+    AOT_GOTO(0x181e, L181e);
+L181a:
+    AOT_BLOCK(0x181a, 1);
+    // 181a: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x181e, L181e);
+L181e:
+    AOT_BLOCK(0x181e, 1);
+    // 181e: br 1832
+    AOT_GOTO(0x1832, L1832);
+L1822:
+    AOT_BLOCK(0x1822, 2);
+    // 1822: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1826: bhi 182e
+    if (!(C | Z))
+        AOT_GOTO(0x182e, L182e);
+    AOT_GOTO(0x1828, L1828);
+L1828:
+    AOT_BLOCK(0x1828, 2);
+    // 1828: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 182a: jmp *20ec(r0)
+    {
+        a = RD16(r[0] + 8428);
+    }
+    AOT_JUMP(a);
+L182e:
+    AOT_BLOCK(0x182e, 2);
+    // 182e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1830: br 1832
+    AOT_GOTO(0x1832, L1832);
+L1832:
+    AOT_BLOCK(0x1832, 2);
+    // 1832: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1836:
+    AOT_BLOCK(0x1836, 6);
+    // 1836: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x183a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 183a: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 183e: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1842: cmpb $24, (r3)
+    {
+        src = uint8_t(0x24);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1846: bne 1866
+    if (!Z)
+        AOT_GOTO(0x1866, L1866);
+    AOT_GOTO(0x1848, L1848);
+L1848:
+    AOT_BLOCK(0x1848, 2);
+    // 1848: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 184a: jsr pc, *$18cc
+    {
+        a = 0x18cc;
+        r[6] -= 2;
+        WR16(r[6], 0x184e);
+    }
+    AOT_GOTO(0x18cc, L18cc);
+L184e:
+    AOT_BLOCK(0x184e, 2);
+    // 184e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1850: beq 1866
+    if (Z)
+        AOT_GOTO(0x1866, L1866);
+    AOT_GOTO(0x1852, L1852);
+L1852:
+    AOT_BLOCK(0x1852, 1);
+    // 1852: mov $24b8, r2
+    {
+        src = uint16_t(0x24b8);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1856, L1856);
+L1856:
+    AOT_BLOCK(0x1856, 2);
+    // 1856: movb (r4)+, (r2)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1858: beq 185c
+    if (Z)
+        AOT_GOTO(0x185c, L185c);
+    AOT_GOTO(0x185a, L185a);
+L185a:
+    AOT_BLOCK(0x185a, 1);
+    // 185a: br 1856
+    AOT_GOTO(0x1856, L1856);
+L185c:
+    AOT_BLOCK(0x185c, 1);
+    // 185c: mov $24cc, r2
+    {
+        src = uint16_t(0x24cc);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1860, L1860);
+L1860:
+    AOT_BLOCK(0x1860, 2);
+    // 1860: movb (r3)+, (r2)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1862: beq 1866
+    if (Z)
+        AOT_GOTO(0x1866, L1866);
+    AOT_GOTO(0x1864, L1864);
+L1864:
+    AOT_BLOCK(0x1864, 1);
+    // 1864: br 1860
+    AOT_GOTO(0x1860, L1860);
+L1866:
+    AOT_BLOCK(0x1866, 2);
+    // 1866: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L186a:
+    AOT_BLOCK(0x186a, 5);
+    // 186a: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x186e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 186e: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 1872: mov 4(r5), -8(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1878: mov 6(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x187e, L187e);
+L187e:
+    AOT_BLOCK(0x187e, 4);
+    // 187e: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1882: inc -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1886: cmpb *-a(r5), (r0)
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        b = r[0];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 188a: beq 1890
+    if (Z)
+        AOT_GOTO(0x1890, L1890);
+    AOT_GOTO(0x188c, L188c);
+L188c:
+    AOT_BLOCK(0x188c, 2);
+    // 188c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 188e: br 18a2
+    AOT_GOTO(0x18a2, L18a2);
+L1890:
+    AOT_BLOCK(0x1890, 4);
+    // 1890: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1894: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1898: tstb (r0)
+    {
+        a = r[0];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 189a: bne 187e
+    if (!Z)
+        AOT_GOTO(0x187e, L187e);
+    AOT_GOTO(0x189c, L189c);
+L189c:
+    AOT_BLOCK(0x189c, 2);
+    // 189c: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18a0: br 18a2
+    AOT_GOTO(0x18a2, L18a2);
+L18a2:
+    AOT_BLOCK(0x18a2, 2);
+    // 18a2: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L18a6:
+    AOT_BLOCK(0x18a6, 5);
+    // 18a6: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x18aa;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 18aa: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 18ae: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18b0: jsr pc, *$18cc
+    {
+        a = 0x18cc;
+        r[6] -= 2;
+        WR16(r[6], 0x18b4);
+    }
+    AOT_GOTO(0x18cc, L18cc);
+L18b4:
+    AOT_BLOCK(0x18b4, 2);
+    // 18b4: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 18b6: bne 18be
+    if (!Z)
+        AOT_GOTO(0x18be, L18be);
+    AOT_GOTO(0x18b8, L18b8);
+L18b8:
+    AOT_BLOCK(0x18b8, 2);
+    // 18b8: clrb 24e0
+    {
+        a = 0x24e0;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 18bc: br 18c8
+    AOT_GOTO(0x18c8, L18c8);
+L18be:
+    AOT_BLOCK(0x18be, 1);
+    // 18be: mov $24e0, r3
+    {
+        src = uint16_t(0x24e0);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x18c2, L18c2);
+L18c2:
+    AOT_BLOCK(0x18c2, 2);
+    // 18c2: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 18c4: beq 18c8
+    if (Z)
+        AOT_GOTO(0x18c8, L18c8);
+    AOT_GOTO(0x18c6, L18c6);
+L18c6:
+    AOT_BLOCK(0x18c6, 1);
+    // 18c6: br 18c2
+    AOT_GOTO(0x18c2, L18c2);
+L18c8:
+    AOT_BLOCK(0x18c8, 2);
+    // 18c8: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L18cc:
+    AOT_BLOCK(0x18cc, 5);
+    // 18cc: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x18d0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 18d0: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 18d4: cmpb $2a, (r4)
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 18d8: beq 18ee
+    if (Z)
+        AOT_GOTO(0x18ee, L18ee);
+    AOT_GOTO(0x18da, L18da);
+L18da:
+    AOT_BLOCK(0x18da, 2);
+    // 18da: cmpb $28, (r4)
+    {
+        src = uint8_t(0x28);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 18de: beq 18ee
+    if (Z)
+        AOT_GOTO(0x18ee, L18ee);
+    AOT_GOTO(0x18e0, L18e0);
+L18e0:
+    AOT_BLOCK(0x18e0, 2);
+    // 18e0: cmpb $2d, (r4)
+    {
+        src = uint8_t(0x2d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 18e4: bne 18f2
+    if (!Z)
+        AOT_GOTO(0x18f2, L18f2);
+    AOT_GOTO(0x18e6, L18e6);
+L18e6:
+    AOT_BLOCK(0x18e6, 2);
+    // 18e6: cmpb $28, 1(r4)
+    {
+        src = uint8_t(0x28);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 18ec: bne 18f2
+    if (!Z)
+        AOT_GOTO(0x18f2, L18f2);
+    AOT_GOTO(0x18ee, L18ee);
+L18ee:
+    AOT_BLOCK(0x18ee, 2);
+    // 18ee: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 18f0: br 1916
+    AOT_GOTO(0x1916, L1916);
+L18f2:
+    AOT_BLOCK(0x18f2, 2);
+    // 18f2: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 18f4: beq 18f8
+    if (Z)
+        AOT_GOTO(0x18f8, L18f8);
+    AOT_GOTO(0x18f6, L18f6);
+L18f6:
+    AOT_BLOCK(0x18f6, 1);
+    // 18f6: br 18f2
+    AOT_GOTO(0x18f2, L18f2);
+L18f8:
+    AOT_BLOCK(0x18f8, 3);
+    // 18f8: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 18fa: cmpb $2b, -(r4)
+    {
+        src = uint8_t(0x2b);
+        r[4] -= 1;
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 18fe: beq 190c
+    if (Z)
+        AOT_GOTO(0x190c, L190c);
+    AOT_GOTO(0x1900, L1900);
+L1900:
+    AOT_BLOCK(0x1900, 2);
+    // 1900: cmpb $29, (r4)
+    {
+        src = uint8_t(0x29);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1904: bne 1910
+    if (!Z)
+        AOT_GOTO(0x1910, L1910);
+    AOT_GOTO(0x1906, L1906);
+L1906:
+    AOT_BLOCK(0x1906, 2);
+    // 1906: cmpb $35, -(r4)
+    {
+        src = uint8_t(0x35);
+        r[4] -= 1;
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 190a: beq 1910
+    if (Z)
+        AOT_GOTO(0x1910, L1910);
+    AOT_GOTO(0x190c, L190c);
+L190c:
+    AOT_BLOCK(0x190c, 2);
+    // 190c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 190e: br 1916
+    AOT_GOTO(0x1916, L1916);
+L1910:
+    AOT_BLOCK(0x1910, 2);
+    // 1910: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1914: br 1916
+    AOT_GOTO(0x1916, L1916);
+L1916:
+    AOT_BLOCK(0x1916, 2);
+    // 1916: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L191a:
+    AOT_BLOCK(0x191a, 6);
+    // 191a: jsr r5, 1cb8
+    {
+        a = 0x1cb8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x191e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    // 191e: sub $7e, sp
+    {
+        src = uint16_t(0x007e);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1922: mov 4(r5), 28f4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x28f4;
+        WR16(b, src);
+    }
+    // 1928: mov r5, r4
+    {
+        src = r[5];
+        r[4] = src;
+    }
+    // 192a: add $6, r4
+    {
+        src = uint16_t(0x0006);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x192e, L192e);
+L192e:
+    AOT_BLOCK(0x192e, 2);
+    // 192e: movb *28f4, r0
+    {
+        a = RD16(0x28f4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1932: beq 1946
+    if (Z)
+        AOT_GOTO(0x1946, L1946);
+    AOT_GOTO(0x1934, L1934);
+L1934:
+    AOT_BLOCK(0x1934, 3);
+    // 1934: inc 28f4
+    {
+        a = 0x28f4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1938: cmp r0, $25
+    {
+        src = r[0];
+        dst = uint16_t(0x0025);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 193c: beq 194a
+    if (Z)
+        AOT_GOTO(0x194a, L194a);
+    AOT_GOTO(0x193e, L193e);
+L193e:
+    AOT_BLOCK(0x193e, 2);
+    // 193e: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1940: jsr pc, *$1acc
+    {
+        a = 0x1acc;
+        r[6] -= 2;
+        WR16(r[6], 0x1944);
+    }
+    AOT_GOTO(0x1acc, L1acc);
+L1944:
+    AOT_BLOCK(0x1944, 1);
+    // 1944: br 192e
+    AOT_GOTO(0x192e, L192e);
+L1946:
+    AOT_BLOCK(0x1946, 2);
+    // 1946: jmp 1cc6
+    {
+        a = 0x1cc6;
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L194a:
+    AOT_BLOCK(0x194a, 4);
+    // 194a: clr 28f6
+    {
+        a = 0x28f6;
+        WR16(a, 0);
+    }
+    // 194e: clr 28fa
+    {
+        a = 0x28fa;
+        WR16(a, 0);
+    }
+    // 1952: cmpb *28f4, $2d
+    {
+        a = RD16(0x28f4);
+        src = RD8(a);
+        dst = uint8_t(0x2d);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1958: bne 1962
+    if (!Z)
+        AOT_GOTO(0x1962, L1962);
+    AOT_GOTO(0x195a, L195a);
+L195a:
+    AOT_BLOCK(0x195a, 2);
+    // 195a: inc 28f4
+    {
+        a = 0x28f4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 195e: inc 28f6
+    {
+        a = 0x28f6;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1962, L1962);
+L1962:
+    AOT_BLOCK(0x1962, 1);
+    // 1962: jsr r3, 1a8e
+    {
+        a = 0x1a8e;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x1966;
+    }
+    AOT_GOTO(0x1a8e, L1a8e);
+L1966:
+    AOT_BLOCK(0x1966, 4);
+    // 1966: mov r1, 28f2
+    {
+        src = r[1];
+        b = 0x28f2;
+        WR16(b, src);
+    }
+    // 196a: clr 28f8
+    {
+        a = 0x28f8;
+        WR16(a, 0);
+    }
+    // 196e: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1972: bne 197c
+    if (!Z)
+        AOT_GOTO(0x197c, L197c);
+    AOT_GOTO(0x1974, L1974);
+L1974:
+    AOT_BLOCK(0x1974, 1);
+    // 1974: jsr r3, 1a8e
+    {
+        a = 0x1a8e;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x1978;
+    }
+    AOT_GOTO(0x1a8e, L1a8e);
+L1978:
+    AOT_BLOCK(0x1978, 1);
+    // 1978: mov r1, 28fa
+    {
+        src = r[1];
+        b = 0x28fa;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x197c, L197c);
+L197c:
+    AOT_BLOCK(0x197c, 3);
+    // 197c: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 197e: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1982: mov $212e, r1
+    {
+        src = uint16_t(0x212e);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1986, L1986);
+L1986:
+    AOT_BLOCK(0x1986, 2);
+    // 1986: mov (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1988: beq 193e
+    if (Z)
+        AOT_GOTO(0x193e, L193e);
+    AOT_GOTO(0x198a, L198a);
+L198a:
+    AOT_BLOCK(0x198a, 2);
+    // 198a: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 198c: bne 1986
+    if (!Z)
+        AOT_GOTO(0x1986, L1986);
+    AOT_GOTO(0x198e, L198e);
+L198e:
+    AOT_BLOCK(0x198e, 1);
+    // 198e: jmp (r2)
+    {
+        a = r[2];
+    }
+    AOT_JUMP(a);
+L1990:
+    AOT_BLOCK(0x1990, 2);
+    // 1990: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1992: bge 199e
+    if (!(N ^ V))
+        AOT_GOTO(0x199e, L199e);
+    AOT_GOTO(0x1994, L1994);
+L1994:
+    AOT_BLOCK(0x1994, 3);
+    // 1994: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 1996: movb $2d, (r3)+
+    {
+        src = uint8_t(0x2d);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 199a: br 199e
+    AOT_GOTO(0x199e, L199e);
+L199c:
+    AOT_BLOCK(0x199c, 1);
+    // 199c: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x199e, L199e);
+L199e:
+    AOT_BLOCK(0x199e, 1);
+    // 199e: jsr pc, 19a4
+    {
+        a = 0x19a4;
+        r[6] -= 2;
+        WR16(r[6], 0x19a2);
+    }
+    AOT_GOTO(0x19a4, L19a4);
+L19a2:
+    AOT_BLOCK(0x19a2, 1);
+    // 19a2: br 1a48
+    AOT_GOTO(0x1a48, L1a48);
+L19a4:
+    AOT_BLOCK(0x19a4, 5);
+    // 19a4: clr r0
+    {
+        r[0] = 0;
+    }
+    // 19a6: div $a, r0
+    {
+        src = int16_t(uint16_t(0x000a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 19aa: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19ac: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19ae: beq 19b4
+    if (Z)
+        AOT_GOTO(0x19b4, L19b4);
+    AOT_GOTO(0x19b0, L19b0);
+L19b0:
+    AOT_BLOCK(0x19b0, 1);
+    // 19b0: jsr pc, 19a4
+    {
+        a = 0x19a4;
+        r[6] -= 2;
+        WR16(r[6], 0x19b4);
+    }
+    AOT_GOTO(0x19a4, L19a4);
+L19b4:
+    AOT_BLOCK(0x19b4, 4);
+    // 19b4: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 19b6: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 19ba: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 19bc: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L19be:
+    AOT_BLOCK(0x19be, 2);
+    // 19be: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 19c0: bne 19c4
+    if (!Z)
+        AOT_GOTO(0x19c4, L19c4);
+    AOT_GOTO(0x19c2, L19c2);
+L19c2:
+    AOT_BLOCK(0x19c2, 1);
+    // 19c2: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x19c4, L19c4);
+L19c4:
+    AOT_BLOCK(0x19c4, 2);
+    // 19c4: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 19c6: bne 1a48
+    if (!Z)
+        AOT_GOTO(0x1a48, L1a48);
+    AOT_GOTO(0x19c8, L19c8);
+L19c8:
+    AOT_BLOCK(0x19c8, 2);
+    // 19c8: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 19ca: br 1a48
+    AOT_GOTO(0x1a48, L1a48);
+L19cc:
+    AOT_BLOCK(0x19cc, 3);
+    // 19cc: mov 28fa, r1
+    {
+        a = 0x28fa;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 19d0: clr r3
+    {
+        r[3] = 0;
+        C = false;
+    }
+    // 19d2: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x19d4, L19d4);
+L19d4:
+    AOT_BLOCK(0x19d4, 2);
+    // 19d4: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 19d6: beq 19dc
+    if (Z)
+        AOT_GOTO(0x19dc, L19dc);
+    AOT_GOTO(0x19d8, L19d8);
+L19d8:
+    AOT_BLOCK(0x19d8, 2);
+    // 19d8: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 19da: sob r1, 4
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x19d4, L19d4);
+    AOT_GOTO(0x19dc, L19dc);
+L19dc:
+    AOT_BLOCK(0x19dc, 2);
+    // 19dc: mov (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19de: br 1a50
+    AOT_GOTO(0x1a50, L1a50);
+L19e0:
+    AOT_BLOCK(0x19e0, 2);
+    // 19e0: mov $2156, r2
+    {
+        src = uint16_t(0x2156);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19e4: br 19ea
+    AOT_GOTO(0x19ea, L19ea);
+L19e6:
+    AOT_BLOCK(0x19e6, 1);
+    // 19e6: mov $215a, r2
+    {
+        src = uint16_t(0x215a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x19ea, L19ea);
+L19ea:
+    AOT_BLOCK(0x19ea, 2);
+    // 19ea: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19ec: beq 19f8
+    if (Z)
+        AOT_GOTO(0x19f8, L19f8);
+    AOT_GOTO(0x19ee, L19ee);
+L19ee:
+    AOT_BLOCK(0x19ee, 2);
+    // 19ee: tst 28fa
+    {
+        a = 0x28fa;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 19f2: beq 19f8
+    if (Z)
+        AOT_GOTO(0x19f8, L19f8);
+    AOT_GOTO(0x19f4, L19f4);
+L19f4:
+    AOT_BLOCK(0x19f4, 1);
+    // 19f4: movb $30, (r3)+
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x19f8, L19f8);
+L19f8:
+    AOT_BLOCK(0x19f8, 2);
+    // 19f8: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 19fa: jsr pc, 1a00
+    {
+        a = 0x1a00;
+        r[6] -= 2;
+        WR16(r[6], 0x19fe);
+    }
+    AOT_GOTO(0x1a00, L1a00);
+L19fe:
+    AOT_BLOCK(0x19fe, 1);
+    // 19fe: br 1a48
+    AOT_GOTO(0x1a48, L1a48);
+L1a00:
+    AOT_BLOCK(0x1a00, 3);
+    // 1a00: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a02: ashc (r2), r0
+    {
+        a = r[2];
+        src = RD16(a) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 1a04: beq 1a0a
+    if (Z)
+        AOT_GOTO(0x1a0a, L1a0a);
+    AOT_GOTO(0x1a06, L1a06);
+L1a06:
+    AOT_BLOCK(0x1a06, 1);
+    // 1a06: jsr pc, 1a00
+    {
+        a = 0x1a00;
+        r[6] -= 2;
+        WR16(r[6], 0x1a0a);
+    }
+    AOT_GOTO(0x1a00, L1a00);
+L1a0a:
+    AOT_BLOCK(0x1a0a, 5);
+    // 1a0a: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1a0c: bic 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1a10: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1a14: cmp r0, $39
+    {
+        src = r[0];
+        dst = uint16_t(0x0039);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a18: ble 1a1e
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1a1e, L1a1e);
+    AOT_GOTO(0x1a1a, L1a1a);
+L1a1a:
+    AOT_BLOCK(0x1a1a, 1);
+    // 1a1a: add $7, r0
+    {
+        src = uint16_t(0x0007);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1a1e, L1a1e);
+L1a1e:
+    AOT_BLOCK(0x1a1e, 2);
+    // 1a1e: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1a20: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1a22:
+    AOT_BLOCK(0x1a22, 3);
+    // 1a22: mov 28fa, r0
+    {
+        a = 0x28fa;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1a26: mov 28f8, r2
+    {
+        a = 0x28f8;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a2a: jsr pc, 1ac2
+    {
+        a = 0x1ac2;
+        r[6] -= 2;
+        WR16(r[6], 0x1a2e);
+    }
+    AOT_GOTO(0x1ac2, L1ac2);
+L1a2e:
+    AOT_BLOCK(0x1a2e, 1);
+    // 1a2e: br 1a48
+    AOT_GOTO(0x1a48, L1a48);
+L1a30:
+    AOT_BLOCK(0x1a30, 3);
+    // 1a30: mov 28fa, r0
+    {
+        a = 0x28fa;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1a34: mov 28f8, r2
+    {
+        a = 0x28f8;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a38: jsr pc, 1ac2
+    {
+        a = 0x1ac2;
+        r[6] -= 2;
+        WR16(r[6], 0x1a3c);
+    }
+    AOT_GOTO(0x1ac2, L1ac2);
+L1a3c:
+    AOT_BLOCK(0x1a3c, 1);
+    // 1a3c: br 1a48
+    AOT_GOTO(0x1a48, L1a48);
+L1a3e:
+    AOT_BLOCK(0x1a3e, 3);
+    // 1a3e: mov (r4)+, r4
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1a40: mov (r4)+, 28f4
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = 0x28f4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a44: jmp 192e
+    {
+        a = 0x192e;
+    }
+    AOT_GOTO(0x192e, L192e);
+L1a48:
+    AOT_BLOCK(0x1a48, 3);
+    // 1a48: mov sp, r2
+    {
+        src = r[6];
+        r[2] = src;
+    }
+    // 1a4a: add $4, r2
+    {
+        src = uint16_t(0x0004);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 1a4e: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1a50, L1a50);
+L1a50:
+    AOT_BLOCK(0x1a50, 6);
+    // 1a50: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a52: mov $20, -(sp)
+    {
+        src = uint16_t(0x0020);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a56: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+    }
+    // 1a58: neg r3
+    {
+        val = -int16_t(r[3]);
+        r[3] = val;
+    }
+    // 1a5a: add 28f2, r3
+    {
+        a = 0x28f2;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1a5e: ble 1a6c
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1a6c, L1a6c);
+    AOT_GOTO(0x1a60, L1a60);
+L1a60:
+    AOT_BLOCK(0x1a60, 2);
+    // 1a60: tst 28f6
+    {
+        a = 0x28f6;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1a64: bne 1a6c
+    if (!Z)
+        AOT_GOTO(0x1a6c, L1a6c);
+    AOT_GOTO(0x1a66, L1a66);
+L1a66:
+    AOT_BLOCK(0x1a66, 1);
+    // 1a66: jsr pc, *$1acc
+    {
+        a = 0x1acc;
+        r[6] -= 2;
+        WR16(r[6], 0x1a6a);
+    }
+    AOT_GOTO(0x1acc, L1acc);
+L1a6a:
+    AOT_BLOCK(0x1a6a, 1);
+    // 1a6a: sob r3, 3
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x1a66, L1a66);
+    AOT_GOTO(0x1a6c, L1a6c);
+L1a6c:
+    AOT_BLOCK(0x1a6c, 2);
+    // 1a6c: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1a6e: beq 1a78
+    if (Z)
+        AOT_GOTO(0x1a78, L1a78);
+    AOT_GOTO(0x1a70, L1a70);
+L1a70:
+    AOT_BLOCK(0x1a70, 2);
+    // 1a70: movb (r2)+, (sp)
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[6];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1a72: jsr pc, *$1acc
+    {
+        a = 0x1acc;
+        r[6] -= 2;
+        WR16(r[6], 0x1a76);
+    }
+    AOT_GOTO(0x1acc, L1acc);
+L1a76:
+    AOT_BLOCK(0x1a76, 1);
+    // 1a76: sob r4, 4
+    {
+        r[4]--;
+    }
+    if (r[4] != 0)
+        AOT_GOTO(0x1a70, L1a70);
+    AOT_GOTO(0x1a78, L1a78);
+L1a78:
+    AOT_BLOCK(0x1a78, 2);
+    // 1a78: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1a7a: ble 1a86
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1a86, L1a86);
+    AOT_GOTO(0x1a7c, L1a7c);
+L1a7c:
+    AOT_BLOCK(0x1a7c, 1);
+    // 1a7c: mov $20, (sp)
+    {
+        src = uint16_t(0x0020);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a80, L1a80);
+L1a80:
+    AOT_BLOCK(0x1a80, 1);
+    // 1a80: jsr pc, *$1acc
+    {
+        a = 0x1acc;
+        r[6] -= 2;
+        WR16(r[6], 0x1a84);
+    }
+    AOT_GOTO(0x1acc, L1acc);
+L1a84:
+    AOT_BLOCK(0x1a84, 1);
+    // 1a84: sob r3, 3
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x1a80, L1a80);
+    AOT_GOTO(0x1a86, L1a86);
+L1a86:
+    AOT_BLOCK(0x1a86, 3);
+    // 1a86: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1a88: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a8a: jmp 192e
+    {
+        a = 0x192e;
+    }
+    AOT_GOTO(0x192e, L192e);
+L1a8e:
+    AOT_BLOCK(0x1a8e, 2);
+    // 1a8e: clr 28f8
+    {
+        a = 0x28f8;
+        WR16(a, 0);
+    }
+    // 1a92: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1a94, L1a94);
+L1a94:
+    AOT_BLOCK(0x1a94, 5);
+    // 1a94: movb *28f4, r0
+    {
+        a = RD16(0x28f4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1a98: inc 28f4
+    {
+        a = 0x28f4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1a9c: sub $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1aa0: cmp r0, $fffa
+    {
+        src = r[0];
+        dst = uint16_t(0xfffa);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1aa4: bne 1aaa
+    if (!Z)
+        AOT_GOTO(0x1aaa, L1aaa);
+    AOT_GOTO(0x1aa6, L1aa6);
+L1aa6:
+    AOT_BLOCK(0x1aa6, 2);
+    // 1aa6: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1aa8: br 1ab0
+    AOT_GOTO(0x1ab0, L1ab0);
+L1aaa:
+    AOT_BLOCK(0x1aaa, 2);
+    // 1aaa: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1aae: bhi 1abc
+    if (!(C | Z))
+        AOT_GOTO(0x1abc, L1abc);
+    AOT_GOTO(0x1ab0, L1ab0);
+L1ab0:
+    AOT_BLOCK(0x1ab0, 4);
+    // 1ab0: inc 28f8
+    {
+        a = 0x28f8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1ab4: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1ab8: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1aba: br 1a94
+    AOT_GOTO(0x1a94, L1a94);
+L1abc:
+    AOT_BLOCK(0x1abc, 2);
+    // 1abc: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1ac0: rts r3
+    {
+        b = r[3];
+        r[3] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1ac2:
+    AOT_BLOCK(0x1ac2, 3);
+    // 1ac2: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1ac6: movb $3f, (r3)+
+    {
+        src = uint8_t(0x3f);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1aca: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1acc:
+    AOT_BLOCK(0x1acc, 4);
+    // 1acc: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ace: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1ad0: mov 2900, r0
+    {
+        a = 0x2900;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ad4: bne 1ade
+    if (!Z)
+        AOT_GOTO(0x1ade, L1ade);
+    AOT_GOTO(0x1ad6, L1ad6);
+L1ad6:
+    AOT_BLOCK(0x1ad6, 1);
+    // 1ad6: jsr pc, 1b06
+    {
+        a = 0x1b06;
+        r[6] -= 2;
+        WR16(r[6], 0x1ada);
+    }
+    AOT_GOTO(0x1b06, L1b06);
+L1ada:
+    AOT_BLOCK(0x1ada, 1);
+    // 1ada: mov 2900, r0
+    {
+        a = 0x2900;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ade, L1ade);
+L1ade:
+    AOT_BLOCK(0x1ade, 2);
+    // 1ade: movb 4(r5), (r0)+
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = r[0];
+        r[0] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1ae2: beq 1af2
+    if (Z)
+        AOT_GOTO(0x1af2, L1af2);
+    AOT_GOTO(0x1ae4, L1ae4);
+L1ae4:
+    AOT_BLOCK(0x1ae4, 3);
+    // 1ae4: inc 2900
+    {
+        a = 0x2900;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1ae8: dec 28fe
+    {
+        a = 0x28fe;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1aec: bgt 1af2
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1af2, L1af2);
+    AOT_GOTO(0x1aee, L1aee);
+L1aee:
+    AOT_BLOCK(0x1aee, 1);
+    // 1aee: jsr pc, 1b06
+    {
+        a = 0x1b06;
+        r[6] -= 2;
+        WR16(r[6], 0x1af2);
+    }
+    AOT_GOTO(0x1b06, L1b06);
+L1af2:
+    AOT_BLOCK(0x1af2, 3);
+    // 1af2: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1af6: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1af8: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1afa:
+    AOT_BLOCK(0x1afa, 3);
+    // 1afa: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1afc: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1afe: jsr pc, 1b06
+    {
+        a = 0x1b06;
+        r[6] -= 2;
+        WR16(r[6], 0x1b02);
+    }
+    AOT_GOTO(0x1b06, L1b06);
+L1b02:
+    AOT_BLOCK(0x1b02, 2);
+    // 1b02: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b04: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1b06:
+    AOT_BLOCK(0x1b06, 2);
+    // 1b06: mov 2900, r0
+    {
+        a = 0x2900;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b0a: beq 1b20
+    if (Z)
+        AOT_GOTO(0x1b20, L1b20);
+    AOT_GOTO(0x1b0c, L1b0c);
+L1b0c:
+    AOT_BLOCK(0x1b0c, 4);
+    // 1b0c: sub $2902, r0
+    {
+        src = uint16_t(0x2902);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 1b10: mov r0, 2162
+    {
+        src = r[0];
+        b = 0x2162;
+        WR16(b, src);
+    }
+    // 1b14: mov 28fc, r0
+    {
+        a = 0x28fc;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b18: bne 1b1c
+    if (!Z)
+        AOT_GOTO(0x1b1c, L1b1c);
+    AOT_GOTO(0x1b1a, L1b1a);
+L1b1a:
+    AOT_BLOCK(0x1b1a, 1);
+    // 1b1a: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1b1c, L1b1c);
+L1b1c:
+    // 1b1c: sys 0
+    AOT_INTERP(0x1b1c);
+L1b1e:
+    AOT_BLOCK(0x1b1e, 1);
+    // 1b1e: cmp r5, *(sp)+
+    {
+        src = r[5];
+        b = RD16(r[6]);
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1b20, L1b20);
+L1b20:
+    AOT_BLOCK(0x1b20, 1);
+    // 1b20: mov $2902, 2900
+    {
+        src = uint16_t(0x2902);
+        b = 0x2900;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b26, L1b26);
+L1b22:
+    AOT_BLOCK(0x1b22, 1);
+    // 1b22: cmp -(r4), r2
+    {
+        r[4] -= 2;
+        a = r[4];
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1b24, L1b24);
+L1b24:
+    AOT_BLOCK(0x1b24, 1);
+    // 1b24: sxt *(r2)+
+    {
+        a = RD16(r[2]);
+        r[2] += 2;
+        WR16(a, -int(N));
+        Z = !N;
+    }
+    AOT_GOTO(0x1b26, L1b26);
+L1b26:
+    AOT_BLOCK(0x1b26, 3);
+    // 1b26: mov $200, 28fe
+    {
+        src = uint16_t(0x0200);
+        b = 0x28fe;
+        WR16(b, src);
+    }
+    // 1b2c: cmp 28fc, $2
+    {
+        a = 0x28fc;
+        src = RD16(a);
+        dst = uint16_t(0x0002);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b32: bhi 1b3a
+    if (!(C | Z))
+        AOT_GOTO(0x1b3a, L1b3a);
+    AOT_GOTO(0x1b34, L1b34);
+L1b34:
+    AOT_BLOCK(0x1b34, 1);
+    // 1b34: mov $1, 28fe
+    {
+        src = uint16_t(0x0001);
+        b = 0x28fe;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b3a, L1b3a);
+L1b3a:
+    AOT_BLOCK(0x1b3a, 1);
+    // 1b3a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1b3c:
+    AOT_BLOCK(0x1b3c, 4);
+    // 1b3c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b3e: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1b40: dec 2568
+    {
+        a = 0x2568;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1b44: bge 1b62
+    if (!(N ^ V))
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1b46, L1b46);
+L1b46:
+    AOT_BLOCK(0x1b46, 2);
+    // 1b46: mov $256c, 256a
+    {
+        src = uint16_t(0x256c);
+        b = 0x256a;
+        WR16(b, src);
+    }
+    // 1b4c: mov 2566, r0
+    {
+        a = 0x2566;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b50: sys 3
+    AOT_INTERP(0x1b50);
+L1b52:
+    AOT_BLOCK(0x1b52, 1);
+    // 1b52: cmp (r5)+, *-(r4)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1b54, L1b54);
+L1b54:
+    AOT_BLOCK(0x1b54, 1);
+    // 1b54: bne 1b56
+    if (!Z)
+        AOT_GOTO(0x1b56, L1b56);
+    AOT_GOTO(0x1b56, L1b56);
+L1b56:
+    AOT_BLOCK(0x1b56, 1);
+    // 1b56: bcs 1b70
+    if (C)
+        AOT_GOTO(0x1b70, L1b70);
+    AOT_GOTO(0x1b58, L1b58);
+L1b58:
+    AOT_BLOCK(0x1b58, 1);
+    // 1b58: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1b5a, L1b5a);
+L1b5a:
+    AOT_BLOCK(0x1b5a, 1);
+    // 1b5a: beq 1b70
+    if (Z)
+        AOT_GOTO(0x1b70, L1b70);
+    AOT_GOTO(0x1b5c, L1b5c);
+L1b5c:
+    AOT_BLOCK(0x1b5c, 2);
+    // 1b5c: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+    }
+    // 1b5e: mov r0, 2568
+    {
+        src = r[0];
+        b = 0x2568;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b62, L1b62);
+L1b62:
+    AOT_BLOCK(0x1b62, 5);
+    // 1b62: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 1b64: bisb *256a, r0
+    {
+        a = RD16(0x256a);
+        src = RD8(a);
+        dst = uint8_t(r[0]);
+        val = src | dst;
+        r[0] = (r[0] & 0xff00) | uint8_t(val);
+    }
+    // 1b68: inc 256a
+    {
+        a = 0x256a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1b6c: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b6e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1b70:
+    AOT_BLOCK(0x1b70, 5);
+    // 1b70: mov r0, 276c
+    {
+        src = r[0];
+        b = 0x276c;
+        WR16(b, src);
+    }
+    // 1b74: clr r0
+    {
+        r[0] = 0;
+    }
+    // 1b76: clr 2568
+    {
+        a = 0x2568;
+        WR16(a, 0);
+        C = false;
+    }
+    // 1b7a: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b7c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1b7e:
+    AOT_BLOCK(0x1b7e, 4);
+    // 1b7e: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b80: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1b82: mov 4(r5), 2166
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x2166;
+        WR16(b, src);
+    }
+    // 1b88: mov 6(r5), 2168
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x2168;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b8e: sys 0
+    AOT_INTERP(0x1b8e);
+L1b90:
+    AOT_BLOCK(0x1b90, 1);
+    // 1b90: cmp r5, -(r4)
+    {
+        src = r[5];
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1b92, L1b92);
+L1b92:
+    AOT_BLOCK(0x1b92, 1);
+    // 1b92: bcc 1b98
+    if (!C)
+        AOT_GOTO(0x1b98, L1b98);
+    AOT_GOTO(0x1b94, L1b94);
+L1b94:
+    AOT_BLOCK(0x1b94, 1);
+    // 1b94: jmp 1cd4
+    {
+        a = 0x1cd4;
+    }
+    AOT_GOTO(0x1cd4, L1cd4);
+L1b96:
+    AOT_BLOCK(0x1b96, 1);
+    // 1b96: br 1c10
+    AOT_GOTO(0x1c10, L1c10);
+L1b98:
+    AOT_BLOCK(0x1b98, 2);
+    // 1b98: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b9a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1b9c:
+    AOT_BLOCK(0x1b9c, 3);
+    // 1b9c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b9e: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1ba0: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ba4: sys 29
+    AOT_INTERP(0x1ba4);
+L1ba6:
+    AOT_BLOCK(0x1ba6, 1);
+    // 1ba6: bcc 1bac
+    if (!C)
+        AOT_GOTO(0x1bac, L1bac);
+    AOT_GOTO(0x1ba8, L1ba8);
+L1ba8:
+    AOT_BLOCK(0x1ba8, 1);
+    // 1ba8: jmp 1cd4
+    {
+        a = 0x1cd4;
+    }
+    AOT_GOTO(0x1cd4, L1cd4);
+L1baa:
+    AOT_BLOCK(0x1baa, 1);
+    // 1baa: br 1bfc
+    AOT_GOTO(0x1bfc, L1bfc);
+L1bac:
+    AOT_BLOCK(0x1bac, 1);
+    // 1bac: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1bae, L1bae);
+L1bae:
+    AOT_BLOCK(0x1bae, 1);
+    // 1bae: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1bb0:
+    AOT_BLOCK(0x1bb0, 4);
+    // 1bb0: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bb2: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1bb4: mov 4(r5), 216c
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x216c;
+        WR16(b, src);
+    }
+    // 1bba: mov 6(r5), 216e
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x216e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bc0: sys 0
+    AOT_INTERP(0x1bc0);
+L1bc2:
+    AOT_BLOCK(0x1bc2, 1);
+    // 1bc2: cmp r5, *-(r2)
+    {
+        src = r[5];
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1bc4, L1bc4);
+L1bc4:
+    AOT_BLOCK(0x1bc4, 1);
+    // 1bc4: bcc 1bca
+    if (!C)
+        AOT_GOTO(0x1bca, L1bca);
+    AOT_GOTO(0x1bc6, L1bc6);
+L1bc6:
+    AOT_BLOCK(0x1bc6, 1);
+    // 1bc6: jmp 1cd4
+    {
+        a = 0x1cd4;
+    }
+    AOT_GOTO(0x1cd4, L1cd4);
+L1bc8:
+    AOT_BLOCK(0x1bc8, 1);
+    // 1bc8: br 1bde
+    AOT_GOTO(0x1bde, L1bde);
+L1bca:
+    AOT_BLOCK(0x1bca, 2);
+    // 1bca: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bcc: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1bce:
+    AOT_BLOCK(0x1bce, 4);
+    // 1bce: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bd0: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1bd2: mov 2174, 2172
+    {
+        a = 0x2174;
+        src = RD16(a);
+        b = 0x2172;
+        WR16(b, src);
+    }
+    // 1bd8: add 4(r5), 2172
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x2172;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1bde, L1bde);
+L1bde:
+    // 1bde: sys 0
+    AOT_INTERP(0x1bde);
+L1be0:
+    AOT_BLOCK(0x1be0, 1);
+    // 1be0: cmp r5, -79fe(r0)
+    {
+        src = r[5];
+        b = uint16_t(r[0] + -31230);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1be4, L1be4);
+L1be2:
+    AOT_BLOCK(0x1be2, 1);
+    // 1be2: bcc 1be8
+    if (!C)
+        AOT_GOTO(0x1be8, L1be8);
+    AOT_GOTO(0x1be4, L1be4);
+L1be4:
+    AOT_BLOCK(0x1be4, 1);
+    // 1be4: jmp 1cd4
+    {
+        a = 0x1cd4;
+    }
+    AOT_GOTO(0x1cd4, L1cd4);
+L1be6:
+    AOT_BLOCK(0x1be6, 1);
+    // 1be6: swab *-(r4)
+    {
+        r[4] -= 2;
+        a = RD16(r[4]);
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1be8, L1be8);
+L1be8:
+    AOT_BLOCK(0x1be8, 4);
+    // 1be8: mov 2174, r0
+    {
+        a = 0x2174;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1bec: add 4(r5), 2174
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x2174;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1bf2: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bf4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1bfc:
+    // 1bfc: iot
+    AOT_INTERP(0x1bfc);
+L1bfe:
+    AOT_BLOCK(0x1bfe, 1);
+    // 1bfe: blt 1ce4
+    if (N ^ V)
+        AOT_GOTO(0x1ce4, L1ce4);
+    AOT_GOTO(0x1c00, L1c00);
+L1c00:
+    // 1c00: sys 0
+    AOT_INTERP(0x1c00);
+L1c02:
+    AOT_BLOCK(0x1c02, 1);
+    // 1c02: cmp r5, -79fe(r0)
+    {
+        src = r[5];
+        b = uint16_t(r[0] + -31230);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1c06, L1c06);
+L1c04:
+    AOT_BLOCK(0x1c04, 1);
+    // 1c04: bcc 1c0a
+    if (!C)
+        AOT_GOTO(0x1c0a, L1c0a);
+    AOT_GOTO(0x1c06, L1c06);
+L1c06:
+    AOT_BLOCK(0x1c06, 1);
+    // 1c06: jmp 1cd4
+    {
+        a = 0x1cd4;
+    }
+    AOT_GOTO(0x1cd4, L1cd4);
+L1c08:
+    AOT_BLOCK(0x1c08, 1);
+    // 1c08: swab (r2)
+    {
+        a = r[2];
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1c0a, L1c0a);
+L1c0a:
+    AOT_BLOCK(0x1c0a, 1);
+    // 1c0a: mov 4(r5), 2174
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x2174;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1c10, L1c10);
+L1c10:
+    AOT_BLOCK(0x1c10, 3);
+    // 1c10: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 1c12: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c14: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1c16:
+    AOT_BLOCK(0x1c16, 5);
+    // 1c16: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c18: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1c1a: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1c1e: mov 6(r5), 2178
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x2178;
+        WR16(b, src);
+    }
+    // 1c24: mov 8(r5), 217a
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x217a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c2a: sys 0
+    AOT_INTERP(0x1c2a);
+L1c2c:
+    AOT_BLOCK(0x1c2c, 1);
+    // 1c2c: cmp r5, -79fe(sp)
+    {
+        src = r[5];
+        b = uint16_t(r[6] + -31230);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1c30, L1c30);
+L1c2e:
+    AOT_BLOCK(0x1c2e, 1);
+    // 1c2e: bcc 1c34
+    if (!C)
+        AOT_GOTO(0x1c34, L1c34);
+    AOT_GOTO(0x1c30, L1c30);
+L1c30:
+    AOT_BLOCK(0x1c30, 1);
+    // 1c30: jmp 1cd4
+    {
+        a = 0x1cd4;
+    }
+    AOT_GOTO(0x1cd4, L1cd4);
+L1c32:
+    AOT_BLOCK(0x1c32, 1);
+    // 1c32: nop
+    AOT_GOTO(0x1c34, L1c34);
+L1c34:
+    AOT_BLOCK(0x1c34, 2);
+    // 1c34: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c36: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1c42:
+    AOT_BLOCK(0x1c42, 3);
+    // 1c42: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c44: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1c46: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c4a: sys 1
+    AOT_INTERP(0x1c4a);
+L1c4c:
+    AOT_BLOCK(0x1c4c, 1);
+    // 1c4c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1c4e, L1c4e);
+L1c4e:
+    AOT_BLOCK(0x1c4e, 1);
+    // 1c4e: mov 2(r5), r1
+    {
+        a = uint16_t(r[5] + 2);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1c52, L1c52);
+L1c50:
+    // 1c50: rti
+    AOT_INTERP(0x1c50);
+L1c52:
+    AOT_BLOCK(0x1c52, 1);
+    // 1c52: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1c54, L1c54);
+L1c54:
+    AOT_BLOCK(0x1c54, 3);
+    // 1c54: clr r0
+    {
+        r[0] = 0;
+    }
+    // 1c56: cmp -4(r1), 217c
+    {
+        a = uint16_t(r[1] + -4);
+        src = RD16(a);
+        b = 0x217c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c5c: bne 1c62
+    if (!Z)
+        AOT_GOTO(0x1c62, L1c62);
+    AOT_GOTO(0x1c5e, L1c5e);
+L1c5e:
+    AOT_BLOCK(0x1c5e, 1);
+    // 1c5e: mov $2, r0
+    {
+        src = uint16_t(0x0002);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1c62, L1c62);
+L1c62:
+    AOT_BLOCK(0x1c62, 2);
+    // 1c62: cmp (r1), 2180
+    {
+        a = r[1];
+        src = RD16(a);
+        b = 0x2180;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c66: bne 1c6e
+    if (!Z)
+        AOT_GOTO(0x1c6e, L1c6e);
+    AOT_GOTO(0x1c68, L1c68);
+L1c68:
+    AOT_BLOCK(0x1c68, 2);
+    // 1c68: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1c6c: br 1cb2
+    AOT_GOTO(0x1cb2, L1cb2);
+L1c6e:
+    AOT_BLOCK(0x1c6e, 2);
+    // 1c6e: cmp (r1), 2182
+    {
+        a = r[1];
+        src = RD16(a);
+        b = 0x2182;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c72: bne 1c7a
+    if (!Z)
+        AOT_GOTO(0x1c7a, L1c7a);
+    AOT_GOTO(0x1c74, L1c74);
+L1c74:
+    AOT_BLOCK(0x1c74, 2);
+    // 1c74: add $4, r0
+    {
+        src = uint16_t(0x0004);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1c78: br 1cb2
+    AOT_GOTO(0x1cb2, L1cb2);
+L1c7a:
+    AOT_BLOCK(0x1c7a, 2);
+    // 1c7a: cmp (r1), 2184
+    {
+        a = r[1];
+        src = RD16(a);
+        b = 0x2184;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c7e: bne 1c86
+    if (!Z)
+        AOT_GOTO(0x1c86, L1c86);
+    AOT_GOTO(0x1c80, L1c80);
+L1c80:
+    AOT_BLOCK(0x1c80, 2);
+    // 1c80: add 2(r1), r0
+    {
+        a = uint16_t(r[1] + 2);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1c84: br 1cb2
+    AOT_GOTO(0x1cb2, L1cb2);
+L1c86:
+    AOT_BLOCK(0x1c86, 2);
+    // 1c86: cmp (r1), 2188
+    {
+        a = r[1];
+        src = RD16(a);
+        b = 0x2188;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c8a: bne 1c96
+    if (!Z)
+        AOT_GOTO(0x1c96, L1c96);
+    AOT_GOTO(0x1c8c, L1c8c);
+L1c8c:
+    AOT_BLOCK(0x1c8c, 3);
+    // 1c8c: add 2(r1), r1
+    {
+        a = uint16_t(r[1] + 2);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 1c90: add $4, r1
+    {
+        src = uint16_t(0x0004);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1c94: br 1c62
+    AOT_GOTO(0x1c62, L1c62);
+L1c96:
+    AOT_BLOCK(0x1c96, 2);
+    // 1c96: cmpb 1(r1), 218d
+    {
+        a = uint16_t(r[1] + 1);
+        src = RD8(a);
+        b = 0x218d;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1c9c: bne 1cb2
+    if (!Z)
+        AOT_GOTO(0x1cb2, L1cb2);
+    AOT_GOTO(0x1c9e, L1c9e);
+L1c9e:
+    AOT_BLOCK(0x1c9e, 8);
+    // 1c9e: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ca0: mov (r1), r0
+    {
+        a = r[1];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1ca2: swab r0
+    {
+        src = r[0];
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        r[0] = val;
+        C = false;
+    }
+    // 1ca4: ash $fff9, r0
+    {
+        src = uint16_t(0xfff9) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1ca8: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 1caa: add $2, r1
+    {
+        src = uint16_t(0x0002);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1cae: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cb0: br 1c62
+    AOT_GOTO(0x1c62, L1c62);
+L1cb2:
+    AOT_BLOCK(0x1cb2, 3);
+    // 1cb2: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+        C = (src & 1) != 0;
+    }
+    // 1cb4: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cb6: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1cb8:
+    AOT_BLOCK(0x1cb8, 1);
+    // csv
+    {
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        r[6] -= 2;
+        val = RD16(r[6]);
+        Z = val == 0;
+        N = int16_t(val) < 0;
+        C = false;
+        V = false;
+    }
+    AOT_JUMP(r[0]);
+L1cc6:
+    AOT_BLOCK(0x1cc6, 1);
+    // cret
+    {
+        r[1] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1cd4:
+    AOT_BLOCK(0x1cd4, 5);
+    // 1cd4: mov r0, 276c
+    {
+        src = r[0];
+        b = 0x276c;
+        WR16(b, src);
+    }
+    // 1cd8: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+    }
+    // 1cdc: mov r5, sp
+    {
+        src = r[5];
+        r[6] = src;
+    }
+    // 1cde: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ce0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1ce4:
+    // 1ce4: wait
+    AOT_INTERP(0x1ce4);
+L1ce6:
+    AOT_BLOCK(0x1ce6, 2);
+    // 1ce6: mov 1cec, 1df4(r0)
+    {
+        a = 0x1cec;
+        src = RD16(a);
+        b = uint16_t(r[0] + 7668);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cec: br 1cf2
+    AOT_GOTO(0x1cf2, L1cf2);
+L1cf2:
+    AOT_BLOCK(0x1cf2, 2);
+    // 1cf2: mov 1ff8, *1e00(r4)
+    {
+        a = 0x1ff8;
+        src = RD16(a);
+        b = RD16(r[4] + 7680);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cf8: bge 1cfe
+    if (!(N ^ V))
+        AOT_GOTO(0x1cfe, L1cfe);
+    AOT_GOTO(0x1cfa, L1cfa);
+L1cf6:
+    AOT_BLOCK(0x1cf6, 1);
+    // 1cf6: mov *402(r0), r0
+    {
+        a = RD16(r[0] + 1026);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1cfa, L1cfa);
+L1cfa:
+    AOT_BLOCK(0x1cfa, 1);
+    // 1cfa: mov *502(r0), r4
+    {
+        a = RD16(r[0] + 1282);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1cfe, L1cfe);
+L1cfe:
+    AOT_BLOCK(0x1cfe, 10);
+    // 1cfe: mov *602(r0), (r0)
+    {
+        a = RD16(r[0] + 1538);
+        src = RD16(a);
+        b = r[0];
+        WR16(b, src);
+    }
+    // 1d02: mov *702(r0), (r4)
+    {
+        a = RD16(r[0] + 1794);
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 1d06: mov *802(r0), (r0)+
+    {
+        a = RD16(r[0] + 2050);
+        src = RD16(a);
+        b = r[0];
+        r[0] += 2;
+        WR16(b, src);
+    }
+    // 1d0a: mov *902(r0), (r5)+
+    {
+        a = RD16(r[0] + 2306);
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 1d0e: mov *3(r0), *(r2)+
+    {
+        a = RD16(r[0] + 3);
+        src = RD16(a);
+        b = RD16(r[2]);
+        r[2] += 2;
+        WR16(b, src);
+    }
+    // 1d12: mov *7(r0), *(sp)+
+    {
+        a = RD16(r[0] + 7);
+        src = RD16(a);
+        b = RD16(r[6]);
+        r[6] += 2;
+        WR16(b, src);
+    }
+    // 1d16: mov *a(r0), -(r5)
+    {
+        a = RD16(r[0] + 10);
+        src = RD16(a);
+        r[5] -= 2;
+        b = r[5];
+        WR16(b, src);
+    }
+    // 1d1a: mov *b(r0), *-(r1)
+    {
+        a = RD16(r[0] + 11);
+        src = RD16(a);
+        r[1] -= 2;
+        b = RD16(r[1]);
+        WR16(b, src);
+    }
+    // 1d1e: mov *c(r0), *-(r5)
+    {
+        a = RD16(r[0] + 12);
+        src = RD16(a);
+        r[5] -= 2;
+        b = RD16(r[5]);
+        WR16(b, src);
+    }
+    // 1d22: mov *d(r0), 1e35(r1)
+    {
+        a = RD16(r[0] + 13);
+        src = RD16(a);
+        b = uint16_t(r[1] + 7733);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d28: (undefined)
+    AOT_INTERP(0x1d28);
+L1d26:
+    AOT_BLOCK(0x1d26, 1);
+    // 1d26: mov *e(r0), 1e39(r5)
+    {
+        a = RD16(r[0] + 14);
+        src = RD16(a);
+        b = uint16_t(r[5] + 7737);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d2c: (undefined)
+    AOT_INTERP(0x1d2c);
+L1d2a:
+    AOT_BLOCK(0x1d2a, 1);
+    // 1d2a: mov *f(r0), *1e3d(r1)
+    {
+        a = RD16(r[0] + 15);
+        src = RD16(a);
+        b = RD16(r[1] + 7741);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d30: (undefined)
+    AOT_INTERP(0x1d30);
+L1d2e:
+    AOT_BLOCK(0x1d2e, 1);
+    // 1d2e: mov *10(r0), *1e41(r5)
+    {
+        a = RD16(r[0] + 16);
+        src = RD16(a);
+        b = RD16(r[5] + 7745);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d34: (undefined)
+    AOT_INTERP(0x1d34);
+L1d32:
+    AOT_BLOCK(0x1d32, 1);
+    // 1d32: mov *11(r1), r1
+    {
+        a = RD16(r[1] + 17);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d36, L1d36);
+L1d36:
+    AOT_BLOCK(0x1d36, 5);
+    // 1d36: mov *12(r1), r5
+    {
+        a = RD16(r[1] + 18);
+        src = RD16(a);
+        r[5] = src;
+    }
+    // 1d3a: mov *13(r1), (r1)
+    {
+        a = RD16(r[1] + 19);
+        src = RD16(a);
+        b = r[1];
+        WR16(b, src);
+    }
+    // 1d3e: mov *14(r1), (r5)
+    {
+        a = RD16(r[1] + 20);
+        src = RD16(a);
+        b = r[5];
+        WR16(b, src);
+    }
+    // 1d42: mov *15(r1), (r1)+
+    {
+        a = RD16(r[1] + 21);
+        src = RD16(a);
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 1d46: mov *16(r1), (r5)+
+    {
+        a = RD16(r[1] + 22);
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d4a, L1d4a);
+L1d48:
+    // 1d48: (undefined)
+    AOT_INTERP(0x1d48);
+L1d4a:
+    AOT_BLOCK(0x1d4a, 7);
+    // 1d4a: mov *17(r1), *(r1)+
+    {
+        a = RD16(r[1] + 23);
+        src = RD16(a);
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 1d4e: mov *18(r1), *(r5)+
+    {
+        a = RD16(r[1] + 24);
+        src = RD16(a);
+        b = RD16(r[5]);
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 1d52: mov *19(r1), -(r1)
+    {
+        a = RD16(r[1] + 25);
+        src = RD16(a);
+        r[1] -= 2;
+        b = r[1];
+        WR16(b, src);
+    }
+    // 1d56: mov *1a(r1), -(r5)
+    {
+        a = RD16(r[1] + 26);
+        src = RD16(a);
+        r[5] -= 2;
+        b = r[5];
+        WR16(b, src);
+    }
+    // 1d5a: mov *1c(r1), *-(r1)
+    {
+        a = RD16(r[1] + 28);
+        src = RD16(a);
+        r[1] -= 2;
+        b = RD16(r[1]);
+        WR16(b, src);
+    }
+    // 1d5e: mov *1d(r1), *-(r5)
+    {
+        a = RD16(r[1] + 29);
+        src = RD16(a);
+        r[5] -= 2;
+        b = RD16(r[5]);
+        WR16(b, src);
+    }
+    // 1d62: mov *1e(r1), 1e77(r1)
+    {
+        a = RD16(r[1] + 30);
+        src = RD16(a);
+        b = uint16_t(r[1] + 7799);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d68, L1d68);
+L1d68:
+    // 1d68: (undefined)
+    AOT_INTERP(0x1d68);
+L1d6a:
+    AOT_BLOCK(0x1d6a, 1);
+    // 1d6a: mov *20(r1), *1e82(r5)
+    {
+        a = RD16(r[1] + 32);
+        src = RD16(a);
+        b = RD16(r[5] + 7810);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d70, L1d70);
+L1d6c:
+    // 1d6c: (undefined)
+    AOT_INTERP(0x1d6c);
+L1d6e:
+    AOT_BLOCK(0x1d6e, 1);
+    // 1d6e: mov *21(r2), r2
+    {
+        a = RD16(r[2] + 33);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d72, L1d72);
+L1d70:
+    // 1d70: (undefined)
+    AOT_INTERP(0x1d70);
+L1d72:
+    AOT_BLOCK(0x1d72, 3);
+    // 1d72: mov *22(r2), (r0)
+    {
+        a = RD16(r[2] + 34);
+        src = RD16(a);
+        b = r[0];
+        WR16(b, src);
+    }
+    // 1d76: mov *23(r2), (r5)
+    {
+        a = RD16(r[2] + 35);
+        src = RD16(a);
+        b = r[5];
+        WR16(b, src);
+    }
+    // 1d7a: mov *24(r2), (r3)+
+    {
+        a = RD16(r[2] + 36);
+        src = RD16(a);
+        b = r[3];
+        r[3] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d7e, L1d7e);
+L1d7c:
+    // 1d7c: (undefined)
+    AOT_INTERP(0x1d7c);
+L1d7e:
+    AOT_BLOCK(0x1d7e, 6);
+    // 1d7e: mov *25(r2), *(r1)+
+    {
+        a = RD16(r[2] + 37);
+        src = RD16(a);
+        b = RD16(r[1]);
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 1d82: mov *26(r2), *(sp)+
+    {
+        a = RD16(r[2] + 38);
+        src = RD16(a);
+        b = RD16(r[6]);
+        r[6] += 2;
+        WR16(b, src);
+    }
+    // 1d86: mov *27(r2), -(r3)
+    {
+        a = RD16(r[2] + 39);
+        src = RD16(a);
+        r[3] -= 2;
+        b = r[3];
+        WR16(b, src);
+    }
+    // 1d8a: mov *28(r2), *-(r0)
+    {
+        a = RD16(r[2] + 40);
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        WR16(b, src);
+    }
+    // 1d8e: mov *29(r2), *-(r5)
+    {
+        a = RD16(r[2] + 41);
+        src = RD16(a);
+        r[5] -= 2;
+        b = RD16(r[5]);
+        WR16(b, src);
+    }
+    // 1d92: mov *2a(r2), 1eb7(r2)
+    {
+        a = RD16(r[2] + 42);
+        src = RD16(a);
+        b = uint16_t(r[2] + 7863);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d98: (undefined)
+    AOT_INTERP(0x1d98);
+L1d9a:
+    AOT_BLOCK(0x1d9a, 1);
+    // 1d9a: mov *2c(r2), *1ec1(r4)
+    {
+        a = RD16(r[2] + 44);
+        src = RD16(a);
+        b = RD16(r[4] + 7873);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1da0: (undefined)
+    AOT_INTERP(0x1da0);
+L1da2:
+    AOT_BLOCK(0x1da2, 3);
+    // 1da2: mov *2e(r3), sp
+    {
+        a = RD16(r[3] + 46);
+        src = RD16(a);
+        r[6] = src;
+    }
+    // 1da6: mov *2f(r3), (r2)
+    {
+        a = RD16(r[3] + 47);
+        src = RD16(a);
+        b = r[2];
+        WR16(b, src);
+    }
+    // 1daa: mov *30(r3), (sp)
+    {
+        a = RD16(r[3] + 48);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dae: halt
+    AOT_INTERP(0x1dae);
+L1db0:
+    // 1db0: halt
+    AOT_INTERP(0x1db0);
+L1db2:
+    // 1db2: wait
+    AOT_INTERP(0x1db2);
+L1db4:
+    AOT_BLOCK(0x1db4, 1);
+    // 1db4: bge 1dc0
+    if (!(N ^ V))
+        AOT_GOTO(0x1dc0, L1dc0);
+    AOT_GOTO(0x1db6, L1db6);
+L1db6:
+    AOT_BLOCK(0x1db6, 1);
+    // 1db6: bne 1dbe
+    if (!Z)
+        AOT_GOTO(0x1dbe, L1dbe);
+    AOT_GOTO(0x1db8, L1db8);
+L1db8:
+    AOT_BLOCK(0x1db8, 1);
+    // 1db8: jsr r0, (r1)
+    {
+        a = r[1];
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x1dba;
+    }
+    AOT_JUMP(a);
+L1dba:
+    AOT_BLOCK(0x1dba, 1);
+    // 1dba: bgt 1dca
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1dca, L1dca);
+    AOT_GOTO(0x1dbc, L1dbc);
+L1dbc:
+    AOT_BLOCK(0x1dbc, 1);
+    // 1dbc: bic *2d6(r0), -(r0)
+    {
+        a = RD16(r[0] + 726);
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x1dc0, L1dc0);
+L1dbe:
+    AOT_BLOCK(0x1dbe, 1);
+    // 1dbe: bne 1d6c
+    if (!Z)
+        AOT_GOTO(0x1d6c, L1d6c);
+    AOT_GOTO(0x1dc0, L1dc0);
+L1dc0:
+    AOT_BLOCK(0x1dc0, 1);
+    // 1dc0: bne 1d6e
+    if (!Z)
+        AOT_GOTO(0x1d6e, L1d6e);
+    AOT_GOTO(0x1dc2, L1dc2);
+L1dc2:
+    AOT_BLOCK(0x1dc2, 1);
+    // 1dc2: bne 1d70
+    if (!Z)
+        AOT_GOTO(0x1d70, L1d70);
+    AOT_GOTO(0x1dc4, L1dc4);
+L1dc4:
+    AOT_BLOCK(0x1dc4, 1);
+    // 1dc4: bne 1cf6
+    if (!Z)
+        AOT_GOTO(0x1cf6, L1cf6);
+    AOT_GOTO(0x1dc6, L1dc6);
+L1dc6:
+    AOT_BLOCK(0x1dc6, 1);
+    // 1dc6: beq 1dec
+    if (Z)
+        AOT_GOTO(0x1dec, L1dec);
+    AOT_GOTO(0x1dc8, L1dc8);
+L1dc8:
+    AOT_BLOCK(0x1dc8, 1);
+    // 1dc8: beq 1dee
+    if (Z)
+        AOT_GOTO(0x1dee, L1dee);
+    AOT_GOTO(0x1dca, L1dca);
+L1dca:
+    AOT_BLOCK(0x1dca, 1);
+    // 1dca: beq 1df0
+    if (Z)
+        AOT_GOTO(0x1df0, L1df0);
+    AOT_GOTO(0x1dcc, L1dcc);
+L1dcc:
+    AOT_BLOCK(0x1dcc, 1);
+    // 1dcc: beq 1df2
+    if (Z)
+        AOT_GOTO(0x1df2, L1df2);
+    AOT_GOTO(0x1dce, L1dce);
+L1dce:
+    AOT_BLOCK(0x1dce, 1);
+    // 1dce: bne 1d7c
+    if (!Z)
+        AOT_GOTO(0x1d7c, L1d7c);
+    AOT_GOTO(0x1dd0, L1dd0);
+L1dd0:
+    // 1dd0: halt
+    AOT_INTERP(0x1dd0);
+L1dd2:
+    // 1dd2: iot
+    AOT_INTERP(0x1dd2);
+L1dd4:
+    // 1dd4: reset
+    AOT_INTERP(0x1dd4);
+L1dd6:
+    // 1dd6: (undefined)
+    AOT_INTERP(0x1dd6);
+L1dd8:
+    // 1dd8: (undefined)
+    AOT_INTERP(0x1dd8);
+L1dda:
+    // 1dda: (undefined)
+    AOT_INTERP(0x1dda);
+L1ddc:
+    // 1ddc: halt
+    AOT_INTERP(0x1ddc);
+L1dde:
+    AOT_BLOCK(0x1dde, 1);
+    // 1dde: bge 1d68
+    if (!(N ^ V))
+        AOT_GOTO(0x1d68, L1d68);
+    AOT_GOTO(0x1de0, L1de0);
+L1de0:
+    AOT_BLOCK(0x1de0, 1);
+    // 1de0: bge 1de2
+    if (!(N ^ V))
+        AOT_GOTO(0x1de2, L1de2);
+    AOT_GOTO(0x1de2, L1de2);
+L1de2:
+    AOT_BLOCK(0x1de2, 1);
+    // 1de2: bge 1e04
+    if (!(N ^ V))
+        AOT_GOTO(0x1e04, L1e04);
+    AOT_GOTO(0x1de4, L1de4);
+L1de4:
+    AOT_BLOCK(0x1de4, 1);
+    // 1de4: bge 1d26
+    if (!(N ^ V))
+        AOT_GOTO(0x1d26, L1d26);
+    AOT_GOTO(0x1de6, L1de6);
+L1de6:
+    AOT_BLOCK(0x1de6, 1);
+    // 1de6: bge 1d48
+    if (!(N ^ V))
+        AOT_GOTO(0x1d48, L1d48);
+    AOT_GOTO(0x1de8, L1de8);
+L1de8:
+    AOT_BLOCK(0x1de8, 1);
+    // 1de8: beq 1de2
+    if (Z)
+        AOT_GOTO(0x1de2, L1de2);
+    AOT_GOTO(0x1dea, L1dea);
+L1dea:
+    AOT_BLOCK(0x1dea, 1);
+    // 1dea: bge 1e2c
+    if (!(N ^ V))
+        AOT_GOTO(0x1e2c, L1e2c);
+    AOT_GOTO(0x1dec, L1dec);
+L1dec:
+    AOT_BLOCK(0x1dec, 1);
+    // 1dec: add (r1), *-(r2)
+    {
+        a = r[1];
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1dee, L1dee);
+L1dee:
+    AOT_BLOCK(0x1dee, 1);
+    // 1dee: jmp 656a(r2)
+    {
+        a = uint16_t(r[2] + 25962);
+    }
+    AOT_JUMP(a);
+L1df0:
+    AOT_BLOCK(0x1df0, 1);
+    // 1df0: add (r5)+, *-(r2)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1df2, L1df2);
+L1df2:
+    AOT_BLOCK(0x1df2, 1);
+    // 1df2: jmp 6e6a(r1)
+    {
+        a = uint16_t(r[1] + 28266);
+    }
+    AOT_JUMP(a);
+L1e04:
+    AOT_BLOCK(0x1e04, 2);
+    // 1e04: add *(r5)+, *-(r2)
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1e06: jmp 6c6a(r4)
+    {
+        a = uint16_t(r[4] + 27754);
+    }
+    AOT_JUMP(a);
+L1e2c:
+    AOT_BLOCK(0x1e2c, 31);
+    // 1e2c: add (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1e2e: add 6900(r5), *-(pc)
+    {
+        a = uint16_t(r[5] + 26880);
+        src = RD16(a);
+        dst = uint16_t(0x0000);
+        val16 = val = int16_t(src) + int16_t(dst);
+    }
+    // 1e32: add (r5), *-(sp)
+    {
+        a = r[5];
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 1e34: add (r0)+, r0
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1e36: add (r5), -(r5)
+    {
+        a = r[5];
+        src = RD16(a);
+        r[5] -= 2;
+        b = r[5];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 1e38: add *6765(r0), r0
+    {
+        a = RD16(r[0] + 26469);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1e3c: ash r0, r0
+    {
+        src = r[0] & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1e3e: ash 6100(r3), r1
+    {
+        a = uint16_t(r[3] + 24832);
+        src = RD16(a) & 077;
+        val16 = r[1];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1e42: div 6100(r3), r1
+    {
+        a = uint16_t(r[3] + 24832);
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[1])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[1]) << 16) | r[2];
+        dst = val / src;
+        r[1] = dst;
+        r[2] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1e46: add 7300(r1), 7478(r3)
+    {
+        a = uint16_t(r[1] + 29440);
+        src = RD16(a);
+        b = uint16_t(r[3] + 29816);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 1e4c: add (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1e4e: mul *-(r5), r1
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1e50: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1e52: add (r1)+, -(r4)
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 1e54: div r0, r4
+    {
+        src = int16_t(r[0]);
+        if (src == 0 || abs(int16_t(r[4])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[4]) << 16) | r[5];
+        dst = val / src;
+        r[4] = dst;
+        r[5] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1e56: add (r1), 6200(r5)
+    {
+        a = r[1];
+        src = RD16(a);
+        b = uint16_t(r[5] + 25088);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1e5a: ash *-(r1), r1
+    {
+        r[1] -= 2;
+        a = RD16(r[1]);
+        src = RD16(a) & 077;
+        val16 = r[1];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1e5c: add (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1e5e: add (r5), *-(r1)
+    {
+        a = r[5];
+        src = RD16(a);
+        r[1] -= 2;
+        b = RD16(r[1]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 1e60: add (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1e62: div *-(r1), r5
+    {
+        r[1] -= 2;
+        a = RD16(r[1]);
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[5])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[5]) << 16) | r[6];
+        dst = val / src;
+        r[5] = dst;
+        r[6] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1e64: add 6c75(r4), r0
+    {
+        a = uint16_t(r[4] + 27765);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1e68: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1e6a: add -(r1), 7800(r3)
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = RD16(a);
+        b = uint16_t(r[3] + 30720);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 1e6e: div *-(pc), r1
+    {
+        src = int16_t(uint16_t(0x0000));
+        if (src == 0 || abs(int16_t(r[1])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[1]) << 16) | r[2];
+        dst = val / src;
+        r[1] = dst;
+        r[2] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1e70: cmp *6574(r0), r0
+    {
+        a = RD16(r[0] + 25972);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1e74: ash *2e00(r0), r1
+    {
+        a = RD16(r[0] + 11776);
+        src = RD16(a) & 077;
+        val16 = r[1];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1e78: add r5, -(r4)
+    {
+        src = r[5];
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 1e7a: add r5, 2e00(r4)
+    {
+        src = r[5];
+        b = uint16_t(r[4] + 11776);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 1e7e: div -(r2), r5
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[5])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[5]) << 16) | r[6];
+        dst = val / src;
+        r[5] = dst;
+        r[6] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1e80: jmp 652e(r3)
+    {
+        a = uint16_t(r[3] + 25902);
+    }
+    AOT_JUMP(a);
+}
+
+AotImage image("v6/lib/c2", 0x0000, 8590, 0x38cafe60u, run);
+}
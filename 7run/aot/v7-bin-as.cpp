@@ -0,0 +1,6621 @@
+// v7/bin/as translated by 7aot: 458 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x0004: goto L0004;
+        case 0x0008: goto L0008;
+        case 0x000c: goto L000c;
+        case 0x000e: goto L000e;
+        case 0x0010: goto L0010;
+        case 0x0012: goto L0012;
+        case 0x0014: goto L0014;
+        case 0x0016: goto L0016;
+        case 0x0018: goto L0018;
+        case 0x001a: goto L001a;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0020: goto L0020;
+        case 0x0022: goto L0022;
+        case 0x0024: goto L0024;
+        case 0x0026: goto L0026;
+        case 0x0028: goto L0028;
+        case 0x002a: goto L002a;
+        case 0x002e: goto L002e;
+        case 0x0034: goto L0034;
+        case 0x003c: goto L003c;
+        case 0x003e: goto L003e;
+        case 0x0040: goto L0040;
+        case 0x0042: goto L0042;
+        case 0x0044: goto L0044;
+        case 0x0046: goto L0046;
+        case 0x0048: goto L0048;
+        case 0x004a: goto L004a;
+        case 0x004c: goto L004c;
+        case 0x004e: goto L004e;
+        case 0x0052: goto L0052;
+        case 0x0054: goto L0054;
+        case 0x0056: goto L0056;
+        case 0x0058: goto L0058;
+        case 0x005a: goto L005a;
+        case 0x005c: goto L005c;
+        case 0x005e: goto L005e;
+        case 0x0060: goto L0060;
+        case 0x0062: goto L0062;
+        case 0x0064: goto L0064;
+        case 0x0066: goto L0066;
+        case 0x0068: goto L0068;
+        case 0x006a: goto L006a;
+        case 0x006c: goto L006c;
+        case 0x006e: goto L006e;
+        case 0x0070: goto L0070;
+        case 0x0072: goto L0072;
+        case 0x0074: goto L0074;
+        case 0x0076: goto L0076;
+        case 0x0078: goto L0078;
+        case 0x0080: goto L0080;
+        case 0x0082: goto L0082;
+        case 0x0084: goto L0084;
+        case 0x0086: goto L0086;
+        case 0x0088: goto L0088;
+        case 0x008a: goto L008a;
+        case 0x008c: goto L008c;
+        case 0x0092: goto L0092;
+        case 0x0094: goto L0094;
+        case 0x009a: goto L009a;
+        case 0x00a0: goto L00a0;
+        case 0x00a2: goto L00a2;
+        case 0x00a4: goto L00a4;
+        case 0x00a6: goto L00a6;
+        case 0x00a8: goto L00a8;
+        case 0x00b0: goto L00b0;
+        case 0x00b2: goto L00b2;
+        case 0x00b4: goto L00b4;
+        case 0x00b6: goto L00b6;
+        case 0x00b8: goto L00b8;
+        case 0x00ba: goto L00ba;
+        case 0x00bc: goto L00bc;
+        case 0x00be: goto L00be;
+        case 0x00c0: goto L00c0;
+        case 0x00c2: goto L00c2;
+        case 0x00c4: goto L00c4;
+        case 0x00d0: goto L00d0;
+        case 0x00d6: goto L00d6;
+        case 0x00dc: goto L00dc;
+        case 0x00de: goto L00de;
+        case 0x00e0: goto L00e0;
+        case 0x00e2: goto L00e2;
+        case 0x00e4: goto L00e4;
+        case 0x00e6: goto L00e6;
+        case 0x00e8: goto L00e8;
+        case 0x00ea: goto L00ea;
+        case 0x00ec: goto L00ec;
+        case 0x00ee: goto L00ee;
+        case 0x010e: goto L010e;
+        case 0x011e: goto L011e;
+        case 0x0124: goto L0124;
+        case 0x012c: goto L012c;
+        case 0x012e: goto L012e;
+        case 0x0130: goto L0130;
+        case 0x0144: goto L0144;
+        case 0x0154: goto L0154;
+        case 0x015a: goto L015a;
+        case 0x015c: goto L015c;
+        case 0x015e: goto L015e;
+        case 0x0160: goto L0160;
+        case 0x0162: goto L0162;
+        case 0x0168: goto L0168;
+        case 0x016c: goto L016c;
+        case 0x0170: goto L0170;
+        case 0x0172: goto L0172;
+        case 0x0174: goto L0174;
+        case 0x017a: goto L017a;
+        case 0x0180: goto L0180;
+        case 0x0192: goto L0192;
+        case 0x019e: goto L019e;
+        case 0x01a0: goto L01a0;
+        case 0x01a2: goto L01a2;
+        case 0x01a4: goto L01a4;
+        case 0x01a6: goto L01a6;
+        case 0x01aa: goto L01aa;
+        case 0x01ae: goto L01ae;
+        case 0x01e2: goto L01e2;
+        case 0x01e4: goto L01e4;
+        case 0x01ea: goto L01ea;
+        case 0x01ee: goto L01ee;
+        case 0x01f0: goto L01f0;
+        case 0x01f2: goto L01f2;
+        case 0x01f8: goto L01f8;
+        case 0x01fe: goto L01fe;
+        case 0x0202: goto L0202;
+        case 0x0206: goto L0206;
+        case 0x020c: goto L020c;
+        case 0x0210: goto L0210;
+        case 0x0212: goto L0212;
+        case 0x021e: goto L021e;
+        case 0x0226: goto L0226;
+        case 0x024a: goto L024a;
+        case 0x024c: goto L024c;
+        case 0x024e: goto L024e;
+        case 0x0250: goto L0250;
+        case 0x0252: goto L0252;
+        case 0x0254: goto L0254;
+        case 0x029e: goto L029e;
+        case 0x02a4: goto L02a4;
+        case 0x02aa: goto L02aa;
+        case 0x02b0: goto L02b0;
+        case 0x02b6: goto L02b6;
+        case 0x02bc: goto L02bc;
+        case 0x02c0: goto L02c0;
+        case 0x02c2: goto L02c2;
+        case 0x02c4: goto L02c4;
+        case 0x02c8: goto L02c8;
+        case 0x02d6: goto L02d6;
+        case 0x02da: goto L02da;
+        case 0x02e0: goto L02e0;
+        case 0x02e2: goto L02e2;
+        case 0x02e6: goto L02e6;
+        case 0x02ec: goto L02ec;
+        case 0x02f2: goto L02f2;
+        case 0x02f8: goto L02f8;
+        case 0x02fe: goto L02fe;
+        case 0x0302: goto L0302;
+        case 0x0304: goto L0304;
+        case 0x0324: goto L0324;
+        case 0x032c: goto L032c;
+        case 0x0330: goto L0330;
+        case 0x0336: goto L0336;
+        case 0x033e: goto L033e;
+        case 0x0342: goto L0342;
+        case 0x034e: goto L034e;
+        case 0x0354: goto L0354;
+        case 0x0364: goto L0364;
+        case 0x036c: goto L036c;
+        case 0x0376: goto L0376;
+        case 0x037c: goto L037c;
+        case 0x037e: goto L037e;
+        case 0x0380: goto L0380;
+        case 0x0382: goto L0382;
+        case 0x0384: goto L0384;
+        case 0x0388: goto L0388;
+        case 0x0390: goto L0390;
+        case 0x0394: goto L0394;
+        case 0x0398: goto L0398;
+        case 0x039c: goto L039c;
+        case 0x03a0: goto L03a0;
+        case 0x03a2: goto L03a2;
+        case 0x03a8: goto L03a8;
+        case 0x03b8: goto L03b8;
+        case 0x03c0: goto L03c0;
+        case 0x03c2: goto L03c2;
+        case 0x03c4: goto L03c4;
+        case 0x03c6: goto L03c6;
+        case 0x03c8: goto L03c8;
+        case 0x03d8: goto L03d8;
+        case 0x03e6: goto L03e6;
+        case 0x03f8: goto L03f8;
+        case 0x0408: goto L0408;
+        case 0x040c: goto L040c;
+        case 0x0418: goto L0418;
+        case 0x0426: goto L0426;
+        case 0x042a: goto L042a;
+        case 0x042c: goto L042c;
+        case 0x042e: goto L042e;
+        case 0x0442: goto L0442;
+        case 0x0448: goto L0448;
+        case 0x044e: goto L044e;
+        case 0x0454: goto L0454;
+        case 0x0458: goto L0458;
+        case 0x0466: goto L0466;
+        case 0x046e: goto L046e;
+        case 0x0478: goto L0478;
+        case 0x047c: goto L047c;
+        case 0x048a: goto L048a;
+        case 0x0490: goto L0490;
+        case 0x0496: goto L0496;
+        case 0x049c: goto L049c;
+        case 0x04aa: goto L04aa;
+        case 0x04ac: goto L04ac;
+        case 0x04b2: goto L04b2;
+        case 0x04b4: goto L04b4;
+        case 0x04b6: goto L04b6;
+        case 0x04b8: goto L04b8;
+        case 0x04ba: goto L04ba;
+        case 0x04bc: goto L04bc;
+        case 0x04be: goto L04be;
+        case 0x04ca: goto L04ca;
+        case 0x04d4: goto L04d4;
+        case 0x04d6: goto L04d6;
+        case 0x04d8: goto L04d8;
+        case 0x04da: goto L04da;
+        case 0x04dc: goto L04dc;
+        case 0x04de: goto L04de;
+        case 0x04e0: goto L04e0;
+        case 0x04e6: goto L04e6;
+        case 0x04ea: goto L04ea;
+        case 0x04f0: goto L04f0;
+        case 0x0504: goto L0504;
+        case 0x0506: goto L0506;
+        case 0x0508: goto L0508;
+        case 0x050a: goto L050a;
+        case 0x050c: goto L050c;
+        case 0x0510: goto L0510;
+        case 0x0516: goto L0516;
+        case 0x052c: goto L052c;
+        case 0x0530: goto L0530;
+        case 0x0534: goto L0534;
+        case 0x0538: goto L0538;
+        case 0x053a: goto L053a;
+        case 0x0542: goto L0542;
+        case 0x0548: goto L0548;
+        case 0x054e: goto L054e;
+        case 0x0554: goto L0554;
+        case 0x0558: goto L0558;
+        case 0x055c: goto L055c;
+        case 0x055e: goto L055e;
+        case 0x0562: goto L0562;
+        case 0x056a: goto L056a;
+        case 0x05ac: goto L05ac;
+        case 0x05b6: goto L05b6;
+        case 0x05bc: goto L05bc;
+        case 0x05c0: goto L05c0;
+        case 0x05c4: goto L05c4;
+        case 0x05dc: goto L05dc;
+        case 0x05e8: goto L05e8;
+        case 0x05f0: goto L05f0;
+        case 0x0614: goto L0614;
+        case 0x061c: goto L061c;
+        case 0x0620: goto L0620;
+        case 0x0624: goto L0624;
+        case 0x0628: goto L0628;
+        case 0x0632: goto L0632;
+        case 0x0638: goto L0638;
+        case 0x0640: goto L0640;
+        case 0x0648: goto L0648;
+        case 0x064c: goto L064c;
+        case 0x0652: goto L0652;
+        case 0x0658: goto L0658;
+        case 0x0660: goto L0660;
+        case 0x0664: goto L0664;
+        case 0x0668: goto L0668;
+        case 0x066c: goto L066c;
+        case 0x0670: goto L0670;
+        case 0x0672: goto L0672;
+        case 0x0676: goto L0676;
+        case 0x0678: goto L0678;
+        case 0x067e: goto L067e;
+        case 0x0680: goto L0680;
+        case 0x0682: goto L0682;
+        case 0x0686: goto L0686;
+        case 0x0688: goto L0688;
+        case 0x069e: goto L069e;
+        case 0x06a4: goto L06a4;
+        case 0x06a6: goto L06a6;
+        case 0x06b4: goto L06b4;
+        case 0x06b8: goto L06b8;
+        case 0x06be: goto L06be;
+        case 0x06c0: goto L06c0;
+        case 0x06c2: goto L06c2;
+        case 0x06c8: goto L06c8;
+        case 0x06cc: goto L06cc;
+        case 0x06ce: goto L06ce;
+        case 0x06d0: goto L06d0;
+        case 0x0700: goto L0700;
+        case 0x0702: goto L0702;
+        case 0x0704: goto L0704;
+        case 0x0706: goto L0706;
+        case 0x0708: goto L0708;
+        case 0x070a: goto L070a;
+        case 0x070c: goto L070c;
+        case 0x070e: goto L070e;
+        case 0x0710: goto L0710;
+        case 0x0712: goto L0712;
+        case 0x0714: goto L0714;
+        case 0x071e: goto L071e;
+        case 0x0722: goto L0722;
+        case 0x0728: goto L0728;
+        case 0x072e: goto L072e;
+        case 0x0734: goto L0734;
+        case 0x0738: goto L0738;
+        case 0x073a: goto L073a;
+        case 0x0742: goto L0742;
+        case 0x0748: goto L0748;
+        case 0x074c: goto L074c;
+        case 0x074e: goto L074e;
+        case 0x0752: goto L0752;
+        case 0x0756: goto L0756;
+        case 0x077c: goto L077c;
+        case 0x0780: goto L0780;
+        case 0x0784: goto L0784;
+        case 0x078a: goto L078a;
+        case 0x078e: goto L078e;
+        case 0x0790: goto L0790;
+        case 0x07c2: goto L07c2;
+        case 0x07c6: goto L07c6;
+        case 0x07c8: goto L07c8;
+        case 0x07d0: goto L07d0;
+        case 0x07d6: goto L07d6;
+        case 0x07da: goto L07da;
+        case 0x07dc: goto L07dc;
+        case 0x0800: goto L0800;
+        case 0x0802: goto L0802;
+        case 0x080a: goto L080a;
+        case 0x0810: goto L0810;
+        case 0x0814: goto L0814;
+        case 0x0818: goto L0818;
+        case 0x081a: goto L081a;
+        case 0x081e: goto L081e;
+        case 0x0822: goto L0822;
+        case 0x0828: goto L0828;
+        case 0x082e: goto L082e;
+        case 0x0834: goto L0834;
+        case 0x083a: goto L083a;
+        case 0x083e: goto L083e;
+        case 0x0844: goto L0844;
+        case 0x0848: goto L0848;
+        case 0x084c: goto L084c;
+        case 0x0850: goto L0850;
+        case 0x0854: goto L0854;
+        case 0x085e: goto L085e;
+        case 0x0864: goto L0864;
+        case 0x0868: goto L0868;
+        case 0x086c: goto L086c;
+        case 0x0876: goto L0876;
+        case 0x087a: goto L087a;
+        case 0x087e: goto L087e;
+        case 0x0882: goto L0882;
+        case 0x0886: goto L0886;
+        case 0x088c: goto L088c;
+        case 0x0890: goto L0890;
+        case 0x0894: goto L0894;
+        case 0x089a: goto L089a;
+        case 0x089e: goto L089e;
+        case 0x08a4: goto L08a4;
+        case 0x08ae: goto L08ae;
+        case 0x08b2: goto L08b2;
+        case 0x08b6: goto L08b6;
+        case 0x08ba: goto L08ba;
+        case 0x08be: goto L08be;
+        case 0x08c2: goto L08c2;
+        case 0x08c6: goto L08c6;
+        case 0x08ca: goto L08ca;
+        case 0x08d4: goto L08d4;
+        case 0x08d8: goto L08d8;
+        case 0x08de: goto L08de;
+        case 0x08e2: goto L08e2;
+        case 0x08e4: goto L08e4;
+        case 0x08e8: goto L08e8;
+        case 0x08ee: goto L08ee;
+        case 0x08f2: goto L08f2;
+        case 0x08f6: goto L08f6;
+        case 0x08fc: goto L08fc;
+        case 0x0902: goto L0902;
+        case 0x0908: goto L0908;
+        case 0x090c: goto L090c;
+        case 0x0916: goto L0916;
+        case 0x091c: goto L091c;
+        case 0x0920: goto L0920;
+        case 0x0922: goto L0922;
+        case 0x0924: goto L0924;
+        case 0x0928: goto L0928;
+        case 0x092a: goto L092a;
+        case 0x093c: goto L093c;
+        case 0x0940: goto L0940;
+        case 0x0946: goto L0946;
+        case 0x0948: goto L0948;
+        case 0x0a00: goto L0a00;
+        case 0x0a02: goto L0a02;
+        case 0x0a06: goto L0a06;
+        case 0x0a08: goto L0a08;
+        case 0x0a18: goto L0a18;
+        case 0x0a1c: goto L0a1c;
+        case 0x0a20: goto L0a20;
+        case 0x0a22: goto L0a22;
+        case 0x0a40: goto L0a40;
+        case 0x0a44: goto L0a44;
+        case 0x0a48: goto L0a48;
+        case 0x0a4c: goto L0a4c;
+        case 0x0a80: goto L0a80;
+        case 0x0a84: goto L0a84;
+        case 0x0a86: goto L0a86;
+        case 0x0ac0: goto L0ac0;
+        case 0x0ad4: goto L0ad4;
+        case 0x0adc: goto L0adc;
+        case 0x0af0: goto L0af0;
+        case 0x0af6: goto L0af6;
+        case 0x0afa: goto L0afa;
+        case 0x0afe: goto L0afe;
+        case 0x0b00: goto L0b00;
+        case 0x0b02: goto L0b02;
+        case 0x0b08: goto L0b08;
+        case 0x0b0c: goto L0b0c;
+        case 0x0b40: goto L0b40;
+        case 0x0b4e: goto L0b4e;
+        case 0x0b50: goto L0b50;
+        case 0x0b6c: goto L0b6c;
+        case 0x0b6e: goto L0b6e;
+        case 0x0b80: goto L0b80;
+        case 0x0b8e: goto L0b8e;
+        case 0x0b90: goto L0b90;
+        case 0x0b92: goto L0b92;
+        case 0x0b94: goto L0b94;
+        case 0x0b96: goto L0b96;
+        case 0x0b98: goto L0b98;
+        case 0x0b9a: goto L0b9a;
+        case 0x0b9c: goto L0b9c;
+        case 0x0b9e: goto L0b9e;
+        case 0x0ba0: goto L0ba0;
+        case 0x0ba2: goto L0ba2;
+        case 0x0ba4: goto L0ba4;
+        case 0x0ba6: goto L0ba6;
+        case 0x0ba8: goto L0ba8;
+        case 0x0baa: goto L0baa;
+        case 0x0bac: goto L0bac;
+        case 0x0bae: goto L0bae;
+        case 0x0bb0: goto L0bb0;
+        case 0x0bb2: goto L0bb2;
+        case 0x0bb4: goto L0bb4;
+        case 0x0bb6: goto L0bb6;
+        case 0x0bb8: goto L0bb8;
+        case 0x0bba: goto L0bba;
+        case 0x0bbc: goto L0bbc;
+        case 0x0bbe: goto L0bbe;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: jmp 279e
+    {
+        a = 0x279e;
+    }
+    AOT_JUMP(0x279e);
+L0004:
+    AOT_BLOCK(0x0004, 1);
+    // 0004: jsr pc, 01a6
+    {
+        a = 0x01a6;
+        r[6] -= 2;
+        WR16(r[6], 0x0008);
+    }
+    AOT_GOTO(0x01a6, L01a6);
+L0008:
+    AOT_BLOCK(0x0008, 1);
+    // 0008: movb 4198, r0
+    {
+        a = 0x4198;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x000c, L000c);
+L000c:
+    // 000c: sys 4
+    AOT_INTERP(0x000c);
+L000e:
+    AOT_BLOCK(0x000e, 1);
+    // 000e: bic sp, *-(r2)
+    {
+        src = r[6];
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0010, L0010);
+L0010:
+    AOT_BLOCK(0x0010, 1);
+    // 0010: bne 0012
+    if (!Z)
+        AOT_GOTO(0x0012, L0012);
+    AOT_GOTO(0x0012, L0012);
+L0012:
+    AOT_BLOCK(0x0012, 1);
+    // 0012: bcs 00e0
+    if (C)
+        AOT_GOTO(0x00e0, L00e0);
+    AOT_GOTO(0x0014, L0014);
+L0014:
+    AOT_BLOCK(0x0014, 1);
+    // 0014: movb 4198, r0
+    {
+        a = 0x4198;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0018, L0018);
+L0016:
+    AOT_BLOCK(0x0016, 1);
+    // 0016: bic sp, r0
+    {
+        src = r[6];
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0018, L0018);
+L0018:
+    // 0018: sys 6
+    AOT_INTERP(0x0018);
+L001a:
+    AOT_BLOCK(0x001a, 1);
+    // 001a: movb 419b, r0
+    {
+        a = 0x419b;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x001e, L001e);
+L001c:
+    AOT_BLOCK(0x001c, 1);
+    // 001c: bic r5, *-76fa(r5)
+    {
+        src = r[5];
+        b = RD16(r[5] + -30458);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0020, L0020);
+L001e:
+    // 001e: sys 6
+    AOT_INTERP(0x001e);
+L0020:
+    AOT_BLOCK(0x0020, 1);
+    // 0020: tstb 419d
+    {
+        a = 0x419d;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0024, L0024);
+L0022:
+    AOT_BLOCK(0x0022, 1);
+    // 0022: bic r5, *217(r1)
+    {
+        src = r[5];
+        b = RD16(r[1] + 535);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0026, L0026);
+L0024:
+    AOT_BLOCK(0x0024, 1);
+    // 0024: bne 0054
+    if (!Z)
+        AOT_GOTO(0x0054, L0054);
+    AOT_GOTO(0x0026, L0026);
+L0026:
+    AOT_BLOCK(0x0026, 1);
+    // 0026: jsr r5, 00a8
+    {
+        a = 0x00a8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x002a;
+    }
+    AOT_GOTO(0x00a8, L00a8);
+L0028:
+    AOT_BLOCK(0x0028, 1);
+    // 0028: jmp *208b(sp)
+    {
+        a = RD16(r[6] + 8331);
+    }
+    AOT_JUMP(a);
+L002a:
+    AOT_BLOCK(0x002a, 2);
+    // 002a: cmp r2, (r3)
+    {
+        src = r[2];
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 002c: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x002e, L002e);
+L002e:
+    AOT_BLOCK(0x002e, 1);
+    // 002e: mov 20ac, 2004
+    {
+        a = 0x20ac;
+        src = RD16(a);
+        b = 0x2004;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0034, L0034);
+L0034:
+    AOT_BLOCK(0x0034, 1);
+    // 0034: sub $43c0, 2004
+    {
+        src = uint16_t(0x43c0);
+        b = 0x2004;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x2004;
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 003a: sys 0
+    AOT_INTERP(0x003a);
+L003c:
+    AOT_BLOCK(0x003c, 1);
+    // 003c: cmp r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x003e, L003e);
+L003e:
+    AOT_BLOCK(0x003e, 1);
+    // 003e: bcs 00e0
+    if (C)
+        AOT_GOTO(0x00e0, L00e0);
+    AOT_GOTO(0x0040, L0040);
+L0040:
+    AOT_BLOCK(0x0040, 1);
+    // 0040: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0042, L0042);
+L0042:
+    // 0042: sys 6
+    AOT_INTERP(0x0042);
+L0044:
+    // 0044: sys b
+    AOT_INTERP(0x0044);
+L0046:
+    AOT_BLOCK(0x0046, 1);
+    // 0046: cmp r0, (sp)+
+    {
+        src = r[0];
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0048, L0048);
+L0048:
+    AOT_BLOCK(0x0048, 1);
+    // 0048: cmp r0, sp
+    {
+        src = r[0];
+        dst = r[6];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x004a, L004a);
+L004a:
+    AOT_BLOCK(0x004a, 1);
+    // 004a: mov $2016, r0
+    {
+        src = uint16_t(0x2016);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x004e, L004e);
+L004c:
+    AOT_BLOCK(0x004c, 1);
+    // 004c: cmp r0, (sp)+
+    {
+        src = r[0];
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x004e, L004e);
+L004e:
+    AOT_BLOCK(0x004e, 1);
+    // 004e: jsr r5, 0066
+    {
+        a = 0x0066;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0052;
+    }
+    AOT_GOTO(0x0066, L0066);
+L0052:
+    AOT_BLOCK(0x0052, 1);
+    // 0052: clr *8960
+    {
+        a = RD16(0x8960);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0056, L0056);
+L0054:
+    // 0054: sys a
+    AOT_INTERP(0x0054);
+L0056:
+    AOT_BLOCK(0x0056, 1);
+    // 0056: cmp r1, -76f6(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -30454);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x005a, L005a);
+L0058:
+    // 0058: sys a
+    AOT_INTERP(0x0058);
+L005a:
+    AOT_BLOCK(0x005a, 1);
+    // 005a: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x005c, L005c);
+L005c:
+    // 005c: sys a
+    AOT_INTERP(0x005c);
+L005e:
+    AOT_BLOCK(0x005e, 1);
+    // 005e: cmp r2, (r3)
+    {
+        src = r[2];
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0060, L0060);
+L0060:
+    AOT_BLOCK(0x0060, 1);
+    // 0060: mov $3, r0
+    {
+        src = uint16_t(0x0003);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0064, L0064);
+L0062:
+    // 0062: bpt
+    AOT_INTERP(0x0062);
+L0064:
+    // 0064: sys 1
+    AOT_INTERP(0x0064);
+L0066:
+    AOT_BLOCK(0x0066, 1);
+    // 0066: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0068, L0068);
+L0068:
+    AOT_BLOCK(0x0068, 1);
+    // 0068: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x006a, L006a);
+L006a:
+    AOT_BLOCK(0x006a, 1);
+    // 006a: mov r4, 2030
+    {
+        src = r[4];
+        b = 0x2030;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x006e, L006e);
+L006c:
+    AOT_BLOCK(0x006c, 1);
+    // 006c: mov *0a70, r2
+    {
+        a = RD16(0x0a70);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0070, L0070);
+L006e:
+    AOT_BLOCK(0x006e, 1);
+    // 006e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0070, L0070);
+L0070:
+    AOT_BLOCK(0x0070, 1);
+    // 0070: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0072, L0072);
+L0072:
+    AOT_BLOCK(0x0072, 1);
+    // 0072: beq 0078
+    if (Z)
+        AOT_GOTO(0x0078, L0078);
+    AOT_GOTO(0x0074, L0074);
+L0074:
+    AOT_BLOCK(0x0074, 1);
+    // 0074: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0076, L0076);
+L0076:
+    AOT_BLOCK(0x0076, 1);
+    // 0076: br 0070
+    AOT_GOTO(0x0070, L0070);
+L0078:
+    AOT_BLOCK(0x0078, 2);
+    // 0078: mov r0, 2032
+    {
+        src = r[0];
+        b = 0x2032;
+        WR16(b, src);
+    }
+    // 007c: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0080, L0080);
+L0080:
+    // 0080: sys 0
+    AOT_INTERP(0x0080);
+L0082:
+    AOT_BLOCK(0x0082, 1);
+    // 0082: cmp r0, *-(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0084, L0084);
+L0084:
+    AOT_BLOCK(0x0084, 1);
+    // 0084: mov r5, 2036
+    {
+        src = r[5];
+        b = 0x2036;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0088, L0088);
+L0086:
+    AOT_BLOCK(0x0086, 1);
+    // 0086: mov *15f7(sp), *-(sp)
+    {
+        a = RD16(r[6] + 5623);
+        src = RD16(a);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x008a, L008a);
+L0088:
+    AOT_BLOCK(0x0088, 2);
+    // 0088: mov $1, 2038
+    {
+        src = uint16_t(0x0001);
+        b = 0x2038;
+        WR16(b, src);
+    }
+    // 008e: tstb 1(r5)
+    {
+        a = uint16_t(r[5] + 1);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0092, L0092);
+L008a:
+    // 008a: wait
+    AOT_INTERP(0x008a);
+L008c:
+    AOT_BLOCK(0x008c, 1);
+    // 008c: mov *-740b(sp), *-(r2)
+    {
+        a = RD16(r[6] + -29707);
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0090: wait
+    AOT_INTERP(0x0090);
+L0092:
+    AOT_BLOCK(0x0092, 1);
+    // 0092: beq 009a
+    if (Z)
+        AOT_GOTO(0x009a, L009a);
+    AOT_GOTO(0x0094, L0094);
+L0094:
+    AOT_BLOCK(0x0094, 1);
+    // 0094: mov $2, 2038
+    {
+        src = uint16_t(0x0002);
+        b = 0x2038;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x009a, L009a);
+L009a:
+    AOT_BLOCK(0x009a, 1);
+    // 009a: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 009e: sys 0
+    AOT_INTERP(0x009e);
+L00a0:
+    AOT_BLOCK(0x00a0, 1);
+    // 00a0: cmp r0, bd5(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 3029);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x00a4, L00a4);
+L00a2:
+    AOT_BLOCK(0x00a2, 1);
+    // 00a2: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x00a4, L00a4);
+L00a4:
+    AOT_BLOCK(0x00a4, 1);
+    // 00a4: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00a6, L00a6);
+L00a6:
+    AOT_BLOCK(0x00a6, 1);
+    // 00a6: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L00a8:
+    AOT_BLOCK(0x00a8, 3);
+    // 00a8: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00aa: mov (r5)+, r4
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 00ac: mov r4, 203c
+    {
+        src = r[4];
+        b = 0x203c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00b0, L00b0);
+L00b0:
+    // 00b0: sys 0
+    AOT_INTERP(0x00b0);
+L00b2:
+    AOT_BLOCK(0x00b2, 1);
+    // 00b2: cmp r0, *-79f9(r2)
+    {
+        src = r[0];
+        b = RD16(r[2] + -31225);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x00b6, L00b6);
+L00b4:
+    AOT_BLOCK(0x00b4, 1);
+    // 00b4: bcc 00c4
+    if (!C)
+        AOT_GOTO(0x00c4, L00c4);
+    AOT_GOTO(0x00b6, L00b6);
+L00b6:
+    AOT_BLOCK(0x00b6, 1);
+    // 00b6: mov r4, 2042
+    {
+        src = r[4];
+        b = 0x2042;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L00b8:
+    AOT_BLOCK(0x00b8, 1);
+    // 00b8: mov *-7700(sp), (r0)
+    {
+        a = RD16(r[6] + -30464);
+        src = RD16(a);
+        b = r[0];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00bc, L00bc);
+L00ba:
+    // 00ba: sys 0
+    AOT_INTERP(0x00ba);
+L00bc:
+    AOT_BLOCK(0x00bc, 1);
+    // 00bc: cmp r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x00be, L00be);
+L00be:
+    AOT_BLOCK(0x00be, 1);
+    // 00be: bcs 00c4
+    if (C)
+        AOT_GOTO(0x00c4, L00c4);
+    AOT_GOTO(0x00c0, L00c0);
+L00c0:
+    AOT_BLOCK(0x00c0, 1);
+    // 00c0: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00c2, L00c2);
+L00c2:
+    AOT_BLOCK(0x00c2, 1);
+    // 00c2: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L00c4:
+    AOT_BLOCK(0x00c4, 3);
+    // 00c4: incb 9(r4)
+    {
+        a = uint16_t(r[4] + 9);
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+    }
+    // 00c8: cmpb 9(r4), $7a
+    {
+        a = uint16_t(r[4] + 9);
+        src = RD8(a);
+        dst = uint8_t(0x7a);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 00ce: blos 00b0
+    if (C | Z)
+        AOT_GOTO(0x00b0, L00b0);
+    AOT_GOTO(0x00d0, L00d0);
+L00d0:
+    AOT_BLOCK(0x00d0, 2);
+    // 00d0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00d2: jsr r5, 0066
+    {
+        a = 0x0066;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x00d6;
+    }
+    AOT_GOTO(0x0066, L0066);
+L00d6:
+    AOT_BLOCK(0x00d6, 1);
+    // 00d6: clr *169a
+    {
+        a = RD16(0x169a);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 00da: bpt
+    AOT_INTERP(0x00da);
+L00dc:
+    // 00dc: sys 1
+    AOT_INTERP(0x00dc);
+L00de:
+    // 00de: halt
+    AOT_INTERP(0x00de);
+L00e0:
+    AOT_BLOCK(0x00e0, 1);
+    // 00e0: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00e4, L00e4);
+L00e2:
+    // 00e2: wait
+    AOT_INTERP(0x00e2);
+L00e4:
+    // 00e4: sys 4
+    AOT_INTERP(0x00e4);
+L00e6:
+    AOT_BLOCK(0x00e6, 1);
+    // 00e6: swab -1e(r0)
+    {
+        a = uint16_t(r[0] + -30);
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x00ea, L00ea);
+L00e8:
+    // 00e8: (undefined)
+    AOT_INTERP(0x00e8);
+L00ea:
+    AOT_BLOCK(0x00ea, 1);
+    // 00ea: inc 419d
+    {
+        a = 0x419d;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x00ee, L00ee);
+L00ec:
+    AOT_BLOCK(0x00ec, 1);
+    // 00ec: bic r2, *-(pc)
+    {
+        src = r[2];
+        dst = uint16_t(0x0000);
+        val = (~src) & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x00ee, L00ee);
+L00ee:
+    AOT_BLOCK(0x00ee, 1);
+    // 00ee: br 0054
+    AOT_GOTO(0x0054, L0054);
+L010e:
+    AOT_BLOCK(0x010e, 6);
+    // 010e: incb 419d
+    {
+        a = 0x419d;
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+    }
+    // 0112: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0114: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0116: mov (r5)+, r0
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0118: tst *43b4
+    {
+        a = RD16(0x43b4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 011c: beq 0130
+    if (Z)
+        AOT_GOTO(0x0130, L0130);
+    AOT_GOTO(0x011e, L011e);
+L011e:
+    AOT_BLOCK(0x011e, 2);
+    // 011e: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0120: mov *43b4, r0
+    {
+        a = RD16(0x43b4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0124, L0124);
+L0124:
+    AOT_BLOCK(0x0124, 2);
+    // 0124: clr *43b4
+    {
+        a = RD16(0x43b4);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0128: jsr r5, 0066
+    {
+        a = 0x0066;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x012c;
+    }
+    AOT_GOTO(0x0066, L0066);
+L012c:
+    // 012c: (undefined)
+    AOT_INTERP(0x012c);
+L012e:
+    AOT_BLOCK(0x012e, 1);
+    // 012e: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0130, L0130);
+L0130:
+    AOT_BLOCK(0x0130, 6);
+    // 0130: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0132: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0134: mov 43aa, r3
+    {
+        a = 0x43aa;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0138: movb r0, 2046
+    {
+        src = uint8_t(r[0]);
+        b = 0x2046;
+        WR8(b, src);
+    }
+    // 013c: mov $204c, r0
+    {
+        src = uint16_t(0x204c);
+        r[0] = src;
+    }
+    // 0140: mov $4, r1
+    {
+        src = uint16_t(0x0004);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0144, L0144);
+L0144:
+    AOT_BLOCK(0x0144, 6);
+    // 0144: clr r2
+    {
+        r[2] = 0;
+    }
+    // 0146: div $a, r2
+    {
+        src = int16_t(uint16_t(0x000a));
+        if (src == 0 || abs(int16_t(r[2])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[2]) << 16) | r[3];
+        dst = val / src;
+        r[2] = dst;
+        r[3] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 014a: add $30, r3
+    {
+        src = uint16_t(0x0030);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 014e: movb r3, -(r0)
+    {
+        src = uint8_t(r[3]);
+        r[0] -= 1;
+        b = r[0];
+        WR8(b, src);
+    }
+    // 0150: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0152: sob r1, 8
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x0144, L0144);
+    AOT_GOTO(0x0154, L0154);
+L0154:
+    AOT_BLOCK(0x0154, 1);
+    // 0154: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0158: sys 4
+    AOT_INTERP(0x0158);
+L015a:
+    AOT_BLOCK(0x015a, 1);
+    // 015a: cmp r1, sp
+    {
+        src = r[1];
+        dst = r[6];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x015c, L015c);
+L015c:
+    // 015c: (undefined)
+    AOT_INTERP(0x015c);
+L015e:
+    AOT_BLOCK(0x015e, 1);
+    // 015e: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0160, L0160);
+L0160:
+    AOT_BLOCK(0x0160, 1);
+    // 0160: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0162, L0162);
+L0162:
+    AOT_BLOCK(0x0162, 3);
+    // 0162: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0164: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0166: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0168:
+    AOT_BLOCK(0x0168, 2);
+    // 0168: cmp r0, (r5)+
+    {
+        src = r[0];
+        b = r[5];
+        r[5] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 016a: blt 0170
+    if (N ^ V)
+        AOT_GOTO(0x0170, L0170);
+    AOT_GOTO(0x016c, L016c);
+L016c:
+    AOT_BLOCK(0x016c, 2);
+    // 016c: cmp (r5)+, r0
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 016e: blt 0172
+    if (N ^ V)
+        AOT_GOTO(0x0172, L0172);
+    AOT_GOTO(0x0170, L0170);
+L0170:
+    AOT_BLOCK(0x0170, 1);
+    // 0170: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0172, L0172);
+L0172:
+    AOT_BLOCK(0x0172, 1);
+    // 0172: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0174:
+    AOT_BLOCK(0x0174, 2);
+    // 0174: tst 43ae
+    {
+        a = 0x43ae;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0178: beq 0180
+    if (Z)
+        AOT_GOTO(0x0180, L0180);
+    AOT_GOTO(0x017a, L017a);
+L017a:
+    AOT_BLOCK(0x017a, 2);
+    // 017a: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 017e: bne 01a4
+    if (!Z)
+        AOT_GOTO(0x01a4, L01a4);
+    AOT_GOTO(0x0180, L0180);
+L0180:
+    AOT_BLOCK(0x0180, 4);
+    // 0180: mov r4, *20aa
+    {
+        src = r[4];
+        b = RD16(0x20aa);
+        WR16(b, src);
+    }
+    // 0184: add $2, 20aa
+    {
+        src = uint16_t(0x0002);
+        b = 0x20aa;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 018a: cmp 20aa, $43aa
+    {
+        a = 0x20aa;
+        src = RD16(a);
+        dst = uint16_t(0x43aa);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0190: bcs 01a4
+    if (C)
+        AOT_GOTO(0x01a4, L01a4);
+    AOT_GOTO(0x0192, L0192);
+L0192:
+    AOT_BLOCK(0x0192, 2);
+    // 0192: mov $41aa, 20aa
+    {
+        src = uint16_t(0x41aa);
+        b = 0x20aa;
+        WR16(b, src);
+    }
+    // 0198: movb 4198, r0
+    {
+        a = 0x4198;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 019c: sys 4
+    AOT_INTERP(0x019c);
+L019e:
+    AOT_BLOCK(0x019e, 1);
+    // 019e: bic sp, *-(r2)
+    {
+        src = r[6];
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x01a0, L01a0);
+L01a0:
+    AOT_BLOCK(0x01a0, 1);
+    // 01a0: bne 01a2
+    if (!Z)
+        AOT_GOTO(0x01a2, L01a2);
+    AOT_GOTO(0x01a2, L01a2);
+L01a2:
+    AOT_BLOCK(0x01a2, 1);
+    // 01a2: bcs 00e0
+    if (C)
+        AOT_GOTO(0x00e0, L00e0);
+    AOT_GOTO(0x01a4, L01a4);
+L01a4:
+    AOT_BLOCK(0x01a4, 1);
+    // 01a4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L01a6:
+    AOT_BLOCK(0x01a6, 1);
+    // 01a6: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x01aa);
+    }
+    AOT_GOTO(0x0548, L0548);
+L01aa:
+    AOT_BLOCK(0x01aa, 1);
+    // 01aa: jsr pc, 02ec
+    {
+        a = 0x02ec;
+        r[6] -= 2;
+        WR16(r[6], 0x01ae);
+    }
+    AOT_GOTO(0x02ec, L02ec);
+L01ae:
+    AOT_BLOCK(0x01ae, 1);
+    // 01ae: br 029e
+    AOT_GOTO(0x029e, L029e);
+L01e2:
+    AOT_BLOCK(0x01e2, 1);
+    // 01e2: beq 01f0
+    if (Z)
+        AOT_GOTO(0x01f0, L01f0);
+    AOT_GOTO(0x01e4, L01e4);
+L01e4:
+    AOT_BLOCK(0x01e4, 2);
+    // 01e4: mov r4, 43b8
+    {
+        src = r[4];
+        b = 0x43b8;
+        WR16(b, src);
+    }
+    // 01e8: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x01ea, L01ea);
+L01ea:
+    AOT_BLOCK(0x01ea, 1);
+    // 01ea: jsr pc, 069e
+    {
+        a = 0x069e;
+        r[6] -= 2;
+        WR16(r[6], 0x01ee);
+    }
+    AOT_GOTO(0x069e, L069e);
+L01ee:
+    AOT_BLOCK(0x01ee, 1);
+    // 01ee: br 029e
+    AOT_GOTO(0x029e, L029e);
+L01f0:
+    AOT_BLOCK(0x01f0, 1);
+    // 01f0: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x01f2, L01f2);
+L01f2:
+    AOT_BLOCK(0x01f2, 2);
+    // 01f2: cmp r4, $80
+    {
+        src = r[4];
+        dst = uint16_t(0x0080);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01f6: bcc 0206
+    if (!C)
+        AOT_GOTO(0x0206, L0206);
+    AOT_GOTO(0x01f8, L01f8);
+L01f8:
+    AOT_BLOCK(0x01f8, 2);
+    // 01f8: cmp r4, $1
+    {
+        src = r[4];
+        dst = uint16_t(0x0001);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01fc: beq 021e
+    if (Z)
+        AOT_GOTO(0x021e, L021e);
+    AOT_GOTO(0x01fe, L01fe);
+L01fe:
+    AOT_BLOCK(0x01fe, 1);
+    // 01fe: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0202;
+    }
+    AOT_GOTO(0x010e, L010e);
+L0202:
+    AOT_BLOCK(0x0202, 1);
+    // 0202: jmp *1d0(r0)
+    {
+        a = RD16(r[0] + 464);
+    }
+    AOT_JUMP(a);
+L0206:
+    AOT_BLOCK(0x0206, 2);
+    // 0206: bitb $1f, (r4)
+    {
+        src = uint8_t(0x1f);
+        b = r[4];
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 020a: beq 0212
+    if (Z)
+        AOT_GOTO(0x0212, L0212);
+    AOT_GOTO(0x020c, L020c);
+L020c:
+    AOT_BLOCK(0x020c, 1);
+    // 020c: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0210;
+    }
+    AOT_GOTO(0x010e, L010e);
+L0210:
+    AOT_BLOCK(0x0210, 1);
+    // 0210: jmp *-(r5)
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+    }
+    AOT_JUMP(a);
+L0212:
+    AOT_BLOCK(0x0212, 3);
+    // 0212: bisb 20b6, (r4)
+    {
+        a = 0x20b6;
+        src = RD8(a);
+        b = r[4];
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 0216: mov 20b8, 2(r4)
+    {
+        a = 0x20b8;
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 021c: br 01a6
+    AOT_GOTO(0x01a6, L01a6);
+L021e:
+    AOT_BLOCK(0x021e, 2);
+    // 021e: mov 43ba, r0
+    {
+        a = 0x43ba;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0222: jsr pc, 02da
+    {
+        a = 0x02da;
+        r[6] -= 2;
+        WR16(r[6], 0x0226);
+    }
+    AOT_GOTO(0x02da, L02da);
+L0226:
+    AOT_BLOCK(0x0226, 7);
+    // 0226: movb 20b6, 2a14(r0)
+    {
+        a = 0x20b6;
+        src = RD8(a);
+        b = uint16_t(r[0] + 10772);
+        WR8(b, src);
+    }
+    // 022c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 022e: movb 20b6, 43bc
+    {
+        a = 0x20b6;
+        src = RD8(a);
+        b = 0x43bc;
+        WR8(b, src);
+    }
+    // 0234: mov 20b8, 43be
+    {
+        a = 0x20b8;
+        src = RD16(a);
+        b = 0x43be;
+        WR16(b, src);
+    }
+    // 023a: movb r0, 43bd
+    {
+        src = uint8_t(r[0]);
+        b = 0x43bd;
+        WR8(b, src);
+    }
+    // 023e: mov 20b8, 2096(r0)
+    {
+        a = 0x20b8;
+        src = RD16(a);
+        b = uint16_t(r[0] + 8342);
+        WR16(b, src);
+    }
+    // 0244: movb 419b, r0
+    {
+        a = 0x419b;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0248: sys 4
+    AOT_INTERP(0x0248);
+L024a:
+    AOT_BLOCK(0x024a, 1);
+    // 024a: bic (sp), *4(r4)
+    {
+        a = r[6];
+        src = RD16(a);
+        b = RD16(r[4] + 4);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x024e, L024e);
+L024c:
+    // 024c: iot
+    AOT_INTERP(0x024c);
+L024e:
+    AOT_BLOCK(0x024e, 1);
+    // 024e: bcc 0254
+    if (!C)
+        AOT_GOTO(0x0254, L0254);
+    AOT_GOTO(0x0250, L0250);
+L0250:
+    AOT_BLOCK(0x0250, 1);
+    // 0250: jmp *$00e0
+    {
+        a = 0x00e0;
+    }
+    AOT_GOTO(0x00e0, L00e0);
+L0252:
+    AOT_BLOCK(0x0252, 1);
+    // 0252: swab -(r0)
+    {
+        r[0] -= 2;
+        a = r[0];
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0254, L0254);
+L0254:
+    AOT_BLOCK(0x0254, 1);
+    // 0254: br 01a6
+    AOT_GOTO(0x01a6, L01a6);
+L029e:
+    AOT_BLOCK(0x029e, 2);
+    // 029e: cmp r4, $3b
+    {
+        src = r[4];
+        dst = uint16_t(0x003b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02a2: beq 02d6
+    if (Z)
+        AOT_GOTO(0x02d6, L02d6);
+    AOT_GOTO(0x02a4, L02a4);
+L02a4:
+    AOT_BLOCK(0x02a4, 2);
+    // 02a4: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02a8: bne 02b0
+    if (!Z)
+        AOT_GOTO(0x02b0, L02b0);
+    AOT_GOTO(0x02aa, L02aa);
+L02aa:
+    AOT_BLOCK(0x02aa, 2);
+    // 02aa: inc 43aa
+    {
+        a = 0x43aa;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 02ae: br 02d6
+    AOT_GOTO(0x02d6, L02d6);
+L02b0:
+    AOT_BLOCK(0x02b0, 2);
+    // 02b0: cmp r4, $4
+    {
+        src = r[4];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02b4: bne 02c4
+    if (!Z)
+        AOT_GOTO(0x02c4, L02c4);
+    AOT_GOTO(0x02b6, L02b6);
+L02b6:
+    AOT_BLOCK(0x02b6, 2);
+    // 02b6: tst 43ae
+    {
+        a = 0x43ae;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 02ba: beq 02c2
+    if (Z)
+        AOT_GOTO(0x02c2, L02c2);
+    AOT_GOTO(0x02bc, L02bc);
+L02bc:
+    AOT_BLOCK(0x02bc, 1);
+    // 02bc: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x02c0;
+    }
+    AOT_GOTO(0x010e, L010e);
+L02c0:
+    AOT_BLOCK(0x02c0, 1);
+    // 02c0: jmp *87(r0)
+    {
+        a = RD16(r[0] + 135);
+    }
+    AOT_JUMP(a);
+L02c2:
+    AOT_BLOCK(0x02c2, 1);
+    // 02c2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L02c4:
+    AOT_BLOCK(0x02c4, 1);
+    // 02c4: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x02c8;
+    }
+    AOT_GOTO(0x010e, L010e);
+L02c8:
+    AOT_BLOCK(0x02c8, 1);
+    // 02c8: jmp *9f7(r0)
+    {
+        a = RD16(r[0] + 2551);
+    }
+    AOT_JUMP(a);
+L02d6:
+    AOT_BLOCK(0x02d6, 1);
+    // 02d6: jmp 01a6
+    {
+        a = 0x01a6;
+    }
+    AOT_GOTO(0x01a6, L01a6);
+L02da:
+    AOT_BLOCK(0x02da, 2);
+    // 02da: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02de: bhi 02e2
+    if (!(C | Z))
+        AOT_GOTO(0x02e2, L02e2);
+    AOT_GOTO(0x02e0, L02e0);
+L02e0:
+    AOT_BLOCK(0x02e0, 1);
+    // 02e0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L02e2:
+    AOT_BLOCK(0x02e2, 1);
+    // 02e2: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x02e6;
+    }
+    AOT_GOTO(0x010e, L010e);
+L02e6:
+    AOT_BLOCK(0x02e6, 1);
+    // 02e6: jmp -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+    }
+    AOT_JUMP(a);
+L02ec:
+    AOT_BLOCK(0x02ec, 2);
+    // 02ec: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02f0: beq 0302
+    if (Z)
+        AOT_GOTO(0x0302, L0302);
+    AOT_GOTO(0x02f2, L02f2);
+L02f2:
+    AOT_BLOCK(0x02f2, 2);
+    // 02f2: cmp r4, $3b
+    {
+        src = r[4];
+        dst = uint16_t(0x003b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02f6: beq 0302
+    if (Z)
+        AOT_GOTO(0x0302, L0302);
+    AOT_GOTO(0x02f8, L02f8);
+L02f8:
+    AOT_BLOCK(0x02f8, 2);
+    // 02f8: cmp r4, $4
+    {
+        src = r[4];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02fc: beq 0302
+    if (Z)
+        AOT_GOTO(0x0302, L0302);
+    AOT_GOTO(0x02fe, L02fe);
+L02fe:
+    AOT_BLOCK(0x02fe, 1);
+    // 02fe: add $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0302, L0302);
+L0302:
+    AOT_BLOCK(0x0302, 1);
+    // 0302: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0304:
+    AOT_BLOCK(0x0304, 13);
+    // 0304: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0306: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0308: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 030a: mov $8, r5
+    {
+        src = uint16_t(0x0008);
+        r[5] = src;
+    }
+    // 030e: mov $41a8, r2
+    {
+        src = uint16_t(0x41a8);
+        r[2] = src;
+    }
+    // 0312: clr -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        WR16(a, 0);
+    }
+    // 0314: clr -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        WR16(a, 0);
+    }
+    // 0316: clr -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        WR16(a, 0);
+    }
+    // 0318: clr -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        WR16(a, 0);
+    }
+    // 031a: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 031c: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 031e: cmp r0, $7e
+    {
+        src = r[0];
+        dst = uint16_t(0x007e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0322: bne 032c
+    if (!Z)
+        AOT_GOTO(0x032c, L032c);
+    AOT_GOTO(0x0324, L0324);
+L0324:
+    AOT_BLOCK(0x0324, 2);
+    // 0324: inc 2(sp)
+    {
+        a = uint16_t(r[6] + 2);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0328: clrb 419e
+    {
+        a = 0x419e;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x032c, L032c);
+L032c:
+    AOT_BLOCK(0x032c, 1);
+    // 032c: jsr pc, 048a
+    {
+        a = 0x048a;
+        r[6] -= 2;
+        WR16(r[6], 0x0330);
+    }
+    AOT_GOTO(0x048a, L048a);
+L0330:
+    AOT_BLOCK(0x0330, 2);
+    // 0330: movb b10(r0), r3
+    {
+        a = uint16_t(r[0] + 2832);
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0334: ble 0342
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0342, L0342);
+    AOT_GOTO(0x0336, L0336);
+L0336:
+    AOT_BLOCK(0x0336, 4);
+    // 0336: add r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0338: swab (sp)
+    {
+        a = r[6];
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+        C = false;
+    }
+    // 033a: dec r5
+    {
+        val = int(int16_t(r[5])) - 1;
+        r[5] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 033c: blt 032c
+    if (N ^ V)
+        AOT_GOTO(0x032c, L032c);
+    AOT_GOTO(0x033e, L033e);
+L033e:
+    AOT_BLOCK(0x033e, 2);
+    // 033e: movb r3, (r2)+
+    {
+        src = uint8_t(r[3]);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0340: br 032c
+    AOT_GOTO(0x032c, L032c);
+L0342:
+    AOT_BLOCK(0x0342, 5);
+    // 0342: movb r0, 419e
+    {
+        src = uint8_t(r[0]);
+        b = 0x419e;
+        WR8(b, src);
+    }
+    // 0346: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0348: clr r0
+    {
+        r[0] = 0;
+    }
+    // 034a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 034c: beq 0354
+    if (Z)
+        AOT_GOTO(0x0354, L0354);
+    AOT_GOTO(0x034e, L034e);
+L034e:
+    AOT_BLOCK(0x034e, 2);
+    // 034e: mov 20ac, r4
+    {
+        a = 0x20ac;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0352: br 03a8
+    AOT_GOTO(0x03a8, L03a8);
+L0354:
+    AOT_BLOCK(0x0354, 4);
+    // 0354: div $bb9, r0
+    {
+        src = int16_t(uint16_t(0x0bb9));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0358: ashc $1, r0
+    {
+        src = uint16_t(0x0001) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 035c: add $2a26, r1
+    {
+        src = uint16_t(0x2a26);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0360: clr 204e
+    {
+        a = 0x204e;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0364, L0364);
+L0364:
+    AOT_BLOCK(0x0364, 3);
+    // 0364: sub r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+    }
+    // 0366: cmp r1, $2a26
+    {
+        src = r[1];
+        dst = uint16_t(0x2a26);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 036a: bhi 0388
+    if (!(C | Z))
+        AOT_GOTO(0x0388, L0388);
+    AOT_GOTO(0x036c, L036c);
+L036c:
+    AOT_BLOCK(0x036c, 3);
+    // 036c: add $1772, r1
+    {
+        src = uint16_t(0x1772);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0370: tst 204e
+    {
+        a = 0x204e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0374: beq 0384
+    if (Z)
+        AOT_GOTO(0x0384, L0384);
+    AOT_GOTO(0x0376, L0376);
+L0376:
+    AOT_BLOCK(0x0376, 1);
+    // 0376: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 037a: sys 4
+    AOT_INTERP(0x037a);
+L037c:
+    AOT_BLOCK(0x037c, 1);
+    // 037c: cmp r1, (r0)+
+    {
+        src = r[1];
+        b = r[0];
+        r[0] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x037e, L037e);
+L037e:
+    // 037e: (undefined)
+    AOT_INTERP(0x037e);
+L0380:
+    AOT_BLOCK(0x0380, 1);
+    // 0380: jmp 0054
+    {
+        a = 0x0054;
+    }
+    AOT_GOTO(0x0054, L0054);
+L0382:
+    // 0382: (undefined)
+    AOT_INTERP(0x0382);
+L0384:
+    AOT_BLOCK(0x0384, 1);
+    // 0384: inc 204e
+    {
+        a = 0x204e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0388, L0388);
+L0388:
+    AOT_BLOCK(0x0388, 3);
+    // 0388: mov $41a0, r2
+    {
+        src = uint16_t(0x41a0);
+        r[2] = src;
+    }
+    // 038c: mov -(r1), r4
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 038e: beq 03a2
+    if (Z)
+        AOT_GOTO(0x03a2, L03a2);
+    AOT_GOTO(0x0390, L0390);
+L0390:
+    AOT_BLOCK(0x0390, 2);
+    // 0390: cmp (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0392: bne 0364
+    if (!Z)
+        AOT_GOTO(0x0364, L0364);
+    AOT_GOTO(0x0394, L0394);
+L0394:
+    AOT_BLOCK(0x0394, 2);
+    // 0394: cmp (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0396: bne 0364
+    if (!Z)
+        AOT_GOTO(0x0364, L0364);
+    AOT_GOTO(0x0398, L0398);
+L0398:
+    AOT_BLOCK(0x0398, 2);
+    // 0398: cmp (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 039a: bne 0364
+    if (!Z)
+        AOT_GOTO(0x0364, L0364);
+    AOT_GOTO(0x039c, L039c);
+L039c:
+    AOT_BLOCK(0x039c, 2);
+    // 039c: cmp (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 039e: bne 0364
+    if (!Z)
+        AOT_GOTO(0x0364, L0364);
+    AOT_GOTO(0x03a0, L03a0);
+L03a0:
+    AOT_BLOCK(0x03a0, 1);
+    // 03a0: br 03d8
+    AOT_GOTO(0x03d8, L03d8);
+L03a2:
+    AOT_BLOCK(0x03a2, 2);
+    // 03a2: mov 20ac, r4
+    {
+        a = 0x20ac;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 03a6: mov r4, (r1)
+    {
+        src = r[4];
+        b = r[1];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03a8, L03a8);
+L03a8:
+    AOT_BLOCK(0x03a8, 5);
+    // 03a8: mov $41a0, r2
+    {
+        src = uint16_t(0x41a0);
+        r[2] = src;
+    }
+    // 03ac: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03ae: add $10, r4
+    {
+        src = uint16_t(0x0010);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+    }
+    // 03b2: cmp r4, 206c
+    {
+        src = r[4];
+        b = 0x206c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03b6: blos 03c2
+    if (C | Z)
+        AOT_GOTO(0x03c2, L03c2);
+    AOT_GOTO(0x03b8, L03b8);
+L03b8:
+    AOT_BLOCK(0x03b8, 1);
+    // 03b8: add $200, 206c
+    {
+        src = uint16_t(0x0200);
+        b = 0x206c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 03be: sys 0
+    AOT_INTERP(0x03be);
+L03c0:
+    AOT_BLOCK(0x03c0, 1);
+    // 03c0: cmp r1, *-(r2)
+    {
+        src = r[1];
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x03c2, L03c2);
+L03c2:
+    AOT_BLOCK(0x03c2, 1);
+    // 03c2: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03c4, L03c4);
+L03c4:
+    AOT_BLOCK(0x03c4, 1);
+    // 03c4: mov (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03c6, L03c6);
+L03c6:
+    AOT_BLOCK(0x03c6, 1);
+    // 03c6: mov (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03c8, L03c8);
+L03c8:
+    AOT_BLOCK(0x03c8, 6);
+    // 03c8: mov (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+    }
+    // 03ca: mov (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+    }
+    // 03cc: clr (r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+        WR16(a, 0);
+    }
+    // 03ce: clr (r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+        WR16(a, 0);
+    }
+    // 03d0: mov r4, 20ac
+    {
+        src = r[4];
+        b = 0x20ac;
+        WR16(b, src);
+    }
+    // 03d4: sub $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x03d8, L03d8);
+L03d8:
+    AOT_BLOCK(0x03d8, 5);
+    // 03d8: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03da: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 03dc: sub $8, r3
+    {
+        src = uint16_t(0x0008);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 03e0: cmp r3, $43c0
+    {
+        src = r[3];
+        dst = uint16_t(0x43c0);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03e4: bcs 03f8
+    if (C)
+        AOT_GOTO(0x03f8, L03f8);
+    AOT_GOTO(0x03e6, L03e6);
+L03e6:
+    AOT_BLOCK(0x03e6, 6);
+    // 03e6: sub $43c0, r3
+    {
+        src = uint16_t(0x43c0);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 03ea: clr r2
+    {
+        r[2] = 0;
+    }
+    // 03ec: div $3, r2
+    {
+        src = int16_t(uint16_t(0x0003));
+        if (src == 0 || abs(int16_t(r[2])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[2]) << 16) | r[3];
+        dst = val / src;
+        r[2] = dst;
+        r[3] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 03f0: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+    }
+    // 03f2: add $800, r4
+    {
+        src = uint16_t(0x0800);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 03f6: br 0408
+    AOT_GOTO(0x0408, L0408);
+L03f8:
+    AOT_BLOCK(0x03f8, 5);
+    // 03f8: sub $20ae, r3
+    {
+        src = uint16_t(0x20ae);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 03fc: clr r2
+    {
+        r[2] = 0;
+    }
+    // 03fe: div $3, r2
+    {
+        src = int16_t(uint16_t(0x0003));
+        if (src == 0 || abs(int16_t(r[2])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[2]) << 16) | r[3];
+        dst = val / src;
+        r[2] = dst;
+        r[3] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0402: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+    }
+    // 0404: add $200, r4
+    {
+        src = uint16_t(0x0200);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0408, L0408);
+L0408:
+    AOT_BLOCK(0x0408, 1);
+    // 0408: jsr pc, 0174
+    {
+        a = 0x0174;
+        r[6] -= 2;
+        WR16(r[6], 0x040c);
+    }
+    AOT_GOTO(0x0174, L0174);
+L040c:
+    AOT_BLOCK(0x040c, 6);
+    // 040c: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 040e: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0410: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0412: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0414: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0416: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0418:
+    AOT_BLOCK(0x0418, 6);
+    // 0418: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 041a: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 041c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 041e: clr r1
+    {
+        r[1] = 0;
+    }
+    // 0420: clr r5
+    {
+        r[5] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0422: jsr pc, 048a
+    {
+        a = 0x048a;
+        r[6] -= 2;
+        WR16(r[6], 0x0426);
+    }
+    AOT_GOTO(0x048a, L048a);
+L0426:
+    AOT_BLOCK(0x0426, 1);
+    // 0426: jsr r5, 0168
+    {
+        a = 0x0168;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x042a;
+    }
+    AOT_GOTO(0x0168, L0168);
+L042a:
+    // 042a: (undefined)
+    AOT_INTERP(0x042a);
+L042c:
+    // 042c: (undefined)
+    AOT_INTERP(0x042c);
+L042e:
+    AOT_BLOCK(0x042e, 1);
+    // 042e: br 0442
+    AOT_GOTO(0x0442, L0442);
+L0442:
+    AOT_BLOCK(0x0442, 2);
+    // 0442: cmp r0, $62
+    {
+        src = r[0];
+        dst = uint16_t(0x0062);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0446: beq 0466
+    if (Z)
+        AOT_GOTO(0x0466, L0466);
+    AOT_GOTO(0x0448, L0448);
+L0448:
+    AOT_BLOCK(0x0448, 2);
+    // 0448: cmp r0, $66
+    {
+        src = r[0];
+        dst = uint16_t(0x0066);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 044c: beq 0466
+    if (Z)
+        AOT_GOTO(0x0466, L0466);
+    AOT_GOTO(0x044e, L044e);
+L044e:
+    AOT_BLOCK(0x044e, 2);
+    // 044e: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0452: bne 0458
+    if (!Z)
+        AOT_GOTO(0x0458, L0458);
+    AOT_GOTO(0x0454, L0454);
+L0454:
+    AOT_BLOCK(0x0454, 2);
+    // 0454: mov r5, r1
+    {
+        src = r[5];
+        r[1] = src;
+    }
+    // 0456: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0458, L0458);
+L0458:
+    AOT_BLOCK(0x0458, 6);
+    // 0458: movb r0, 419e
+    {
+        src = uint8_t(r[0]);
+        b = 0x419e;
+        WR8(b, src);
+    }
+    // 045c: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 045e: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+    }
+    // 0460: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0462: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0464: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0466:
+    AOT_BLOCK(0x0466, 3);
+    // 0466: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0468: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 046a: jsr pc, 02da
+    {
+        a = 0x02da;
+        r[6] -= 2;
+        WR16(r[6], 0x046e);
+    }
+    AOT_GOTO(0x02da, L02da);
+L046e:
+    AOT_BLOCK(0x046e, 3);
+    // 046e: add $61, r0
+    {
+        src = uint16_t(0x0061);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0472: cmp r3, $62
+    {
+        src = r[3];
+        dst = uint16_t(0x0062);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0476: beq 047c
+    if (Z)
+        AOT_GOTO(0x047c, L047c);
+    AOT_GOTO(0x0478, L0478);
+L0478:
+    AOT_BLOCK(0x0478, 1);
+    // 0478: add $a, r0
+    {
+        src = uint16_t(0x000a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x047c, L047c);
+L047c:
+    AOT_BLOCK(0x047c, 6);
+    // 047c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 047e: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+    }
+    // 0480: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0482: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0484: add $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0488: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L048a:
+    AOT_BLOCK(0x048a, 2);
+    // 048a: movb 419e, r0
+    {
+        a = 0x419e;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 048e: beq 0496
+    if (Z)
+        AOT_GOTO(0x0496, L0496);
+    AOT_GOTO(0x0490, L0490);
+L0490:
+    AOT_BLOCK(0x0490, 2);
+    // 0490: clrb 419e
+    {
+        a = 0x419e;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0494: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0496:
+    AOT_BLOCK(0x0496, 2);
+    // 0496: dec 43ac
+    {
+        a = 0x43ac;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 049a: blt 04ac
+    if (N ^ V)
+        AOT_GOTO(0x04ac, L04ac);
+    AOT_GOTO(0x049c, L049c);
+L049c:
+    AOT_BLOCK(0x049c, 4);
+    // 049c: movb *43b0, r0
+    {
+        a = RD16(0x43b0);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 04a0: inc 43b0
+    {
+        a = 0x43b0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 04a4: bic $ff80, r0
+    {
+        src = uint16_t(0xff80);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 04a8: beq 0496
+    if (Z)
+        AOT_GOTO(0x0496, L0496);
+    AOT_GOTO(0x04aa, L04aa);
+L04aa:
+    AOT_BLOCK(0x04aa, 1);
+    // 04aa: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L04ac:
+    AOT_BLOCK(0x04ac, 2);
+    // 04ac: movb 419a, r0
+    {
+        a = 0x419a;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 04b0: beq 04d4
+    if (Z)
+        AOT_GOTO(0x04d4, L04d4);
+    AOT_GOTO(0x04b2, L04b2);
+L04b2:
+    // 04b2: sys 3
+    AOT_INTERP(0x04b2);
+L04b4:
+    AOT_BLOCK(0x04b4, 1);
+    // 04b4: cmp -(r0), (r4)+
+    {
+        r[0] -= 2;
+        a = r[0];
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x04b6, L04b6);
+L04b6:
+    AOT_BLOCK(0x04b6, 1);
+    // 04b6: bne 04b8
+    if (!Z)
+        AOT_GOTO(0x04b8, L04b8);
+    AOT_GOTO(0x04b8, L04b8);
+L04b8:
+    AOT_BLOCK(0x04b8, 1);
+    // 04b8: bcs 04ca
+    if (C)
+        AOT_GOTO(0x04ca, L04ca);
+    AOT_GOTO(0x04ba, L04ba);
+L04ba:
+    AOT_BLOCK(0x04ba, 1);
+    // 04ba: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x04bc, L04bc);
+L04bc:
+    AOT_BLOCK(0x04bc, 1);
+    // 04bc: beq 04ca
+    if (Z)
+        AOT_GOTO(0x04ca, L04ca);
+    AOT_GOTO(0x04be, L04be);
+L04be:
+    AOT_BLOCK(0x04be, 3);
+    // 04be: mov r0, 43ac
+    {
+        src = r[0];
+        b = 0x43ac;
+        WR16(b, src);
+    }
+    // 04c2: mov $2814, 43b0
+    {
+        src = uint16_t(0x2814);
+        b = 0x43b0;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04c8: br 0496
+    AOT_GOTO(0x0496, L0496);
+L04ca:
+    AOT_BLOCK(0x04ca, 2);
+    // 04ca: movb 419a, r0
+    {
+        a = 0x419a;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 04ce: clrb 419a
+    {
+        a = 0x419a;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 04d2: sys 6
+    AOT_INTERP(0x04d2);
+L04d4:
+    AOT_BLOCK(0x04d4, 1);
+    // 04d4: decb 43b2
+    {
+        a = 0x43b2;
+        val = int(int8_t(RD8(a))) - 1;
+        WR8(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x81;
+    }
+    AOT_GOTO(0x04d8, L04d8);
+L04d6:
+    AOT_BLOCK(0x04d6, 1);
+    // 04d6: bit *603(r3), *(r2)+
+    {
+        a = RD16(r[3] + 1539);
+        src = RD16(a);
+        b = RD16(r[2]);
+        r[2] += 2;
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x04da, L04da);
+L04d8:
+    AOT_BLOCK(0x04d8, 1);
+    // 04d8: bgt 04e0
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x04e0, L04e0);
+    AOT_GOTO(0x04da, L04da);
+L04da:
+    AOT_BLOCK(0x04da, 1);
+    // 04da: mov $4, r0
+    {
+        src = uint16_t(0x0004);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04de, L04de);
+L04dc:
+    // 04dc: iot
+    AOT_INTERP(0x04dc);
+L04de:
+    AOT_BLOCK(0x04de, 1);
+    // 04de: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L04e0:
+    AOT_BLOCK(0x04e0, 2);
+    // 04e0: tst 43ae
+    {
+        a = 0x43ae;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04e4: beq 04f0
+    if (Z)
+        AOT_GOTO(0x04f0, L04f0);
+    AOT_GOTO(0x04e6, L04e6);
+L04e6:
+    AOT_BLOCK(0x04e6, 1);
+    // 04e6: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x04ea;
+    }
+    AOT_GOTO(0x010e, L010e);
+L04ea:
+    AOT_BLOCK(0x04ea, 1);
+    // 04ea: jmp *-(r1)
+    {
+        r[1] -= 2;
+        a = RD16(r[1]);
+    }
+    AOT_JUMP(a);
+L04f0:
+    AOT_BLOCK(0x04f0, 5);
+    // 04f0: mov 43b4, r0
+    {
+        a = 0x43b4;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04f4: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 04f6: mov (r0), 2070
+    {
+        a = r[0];
+        src = RD16(a);
+        b = 0x2070;
+        WR16(b, src);
+    }
+    // 04fa: mov r0, 43b4
+    {
+        src = r[0];
+        b = 0x43b4;
+        WR16(b, src);
+    }
+    // 04fe: incb 419c
+    {
+        a = 0x419c;
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x80;
+    }
+    // 0502: sys 0
+    AOT_INTERP(0x0502);
+L0504:
+    AOT_BLOCK(0x0504, 1);
+    // 0504: cmp r1, *-(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0506, L0506);
+L0506:
+    AOT_BLOCK(0x0506, 1);
+    // 0506: bcc 0516
+    if (!C)
+        AOT_GOTO(0x0516, L0516);
+    AOT_GOTO(0x0508, L0508);
+L0508:
+    AOT_BLOCK(0x0508, 1);
+    // 0508: mov 2070, r0
+    {
+        a = 0x2070;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x050c, L050c);
+L050a:
+    AOT_BLOCK(0x050a, 1);
+    // 050a: mov *-(r5), -(r4)
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x050c, L050c);
+L050c:
+    AOT_BLOCK(0x050c, 1);
+    // 050c: jsr r5, 0066
+    {
+        a = 0x0066;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0510;
+    }
+    AOT_GOTO(0x0066, L0066);
+L0510:
+    AOT_BLOCK(0x0510, 1);
+    // 0510: clr *058b
+    {
+        a = RD16(0x058b);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0514: (undefined)
+    AOT_INTERP(0x0514);
+L0516:
+    AOT_BLOCK(0x0516, 6);
+    // 0516: movb r0, 419a
+    {
+        src = uint8_t(r[0]);
+        b = 0x419a;
+        WR8(b, src);
+    }
+    // 051a: mov $1, 43aa
+    {
+        src = uint16_t(0x0001);
+        b = 0x43aa;
+        WR16(b, src);
+    }
+    // 0520: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0522: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0524: mov $5, r4
+    {
+        src = uint16_t(0x0005);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0528: jsr pc, 0174
+    {
+        a = 0x0174;
+        r[6] -= 2;
+        WR16(r[6], 0x052c);
+    }
+    AOT_GOTO(0x0174, L0174);
+L052c:
+    AOT_BLOCK(0x052c, 1);
+    // 052c: mov *43b4, r1
+    {
+        a = RD16(0x43b4);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0530, L0530);
+L0530:
+    AOT_BLOCK(0x0530, 2);
+    // 0530: movb (r1)+, r4
+    {
+        a = r[1];
+        r[1] += 1;
+        src = RD8(a);
+        r[4] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0532: beq 053a
+    if (Z)
+        AOT_GOTO(0x053a, L053a);
+    AOT_GOTO(0x0534, L0534);
+L0534:
+    AOT_BLOCK(0x0534, 1);
+    // 0534: jsr pc, 0174
+    {
+        a = 0x0174;
+        r[6] -= 2;
+        WR16(r[6], 0x0538);
+    }
+    AOT_GOTO(0x0174, L0174);
+L0538:
+    AOT_BLOCK(0x0538, 1);
+    // 0538: br 0530
+    AOT_GOTO(0x0530, L0530);
+L053a:
+    AOT_BLOCK(0x053a, 2);
+    // 053a: mov $ffff, r4
+    {
+        src = uint16_t(0xffff);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 053e: jsr pc, 0174
+    {
+        a = 0x0174;
+        r[6] -= 2;
+        WR16(r[6], 0x0542);
+    }
+    AOT_GOTO(0x0174, L0174);
+L0542:
+    AOT_BLOCK(0x0542, 3);
+    // 0542: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0544: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0546: br 0496
+    AOT_GOTO(0x0496, L0496);
+L0548:
+    AOT_BLOCK(0x0548, 2);
+    // 0548: mov 43b8, r4
+    {
+        a = 0x43b8;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 054c: beq 0554
+    if (Z)
+        AOT_GOTO(0x0554, L0554);
+    AOT_GOTO(0x054e, L054e);
+L054e:
+    AOT_BLOCK(0x054e, 2);
+    // 054e: clr 43b8
+    {
+        a = 0x43b8;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0552: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0554:
+    AOT_BLOCK(0x0554, 1);
+    // 0554: jsr pc, 055e
+    {
+        a = 0x055e;
+        r[6] -= 2;
+        WR16(r[6], 0x0558);
+    }
+    AOT_GOTO(0x055e, L055e);
+L0558:
+    AOT_BLOCK(0x0558, 1);
+    // 0558: jsr pc, 0174
+    {
+        a = 0x0174;
+        r[6] -= 2;
+        WR16(r[6], 0x055c);
+    }
+    AOT_GOTO(0x0174, L0174);
+L055c:
+    AOT_BLOCK(0x055c, 1);
+    // 055c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L055e:
+    AOT_BLOCK(0x055e, 1);
+    // 055e: jsr pc, 048a
+    {
+        a = 0x048a;
+        r[6] -= 2;
+        WR16(r[6], 0x0562);
+    }
+    AOT_GOTO(0x048a, L048a);
+L0562:
+    AOT_BLOCK(0x0562, 3);
+    // 0562: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0564: movb b10(r0), r1
+    {
+        a = uint16_t(r[0] + 2832);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0568: bgt 05ac
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x05ac, L05ac);
+    AOT_GOTO(0x056a, L056a);
+L056a:
+    AOT_BLOCK(0x056a, 1);
+    // 056a: jmp *584(r1)
+    {
+        a = RD16(r[1] + 1412);
+    }
+    AOT_JUMP(a);
+L05ac:
+    AOT_BLOCK(0x05ac, 3);
+    // 05ac: movb r0, 419e
+    {
+        src = uint8_t(r[0]);
+        b = 0x419e;
+        WR8(b, src);
+    }
+    // 05b0: cmp r1, $30
+    {
+        src = r[1];
+        dst = uint16_t(0x0030);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05b4: bcs 05bc
+    if (C)
+        AOT_GOTO(0x05bc, L05bc);
+    AOT_GOTO(0x05b6, L05b6);
+L05b6:
+    AOT_BLOCK(0x05b6, 2);
+    // 05b6: cmp r1, $39
+    {
+        src = r[1];
+        dst = uint16_t(0x0039);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05ba: blos 05c0
+    if (C | Z)
+        AOT_GOTO(0x05c0, L05c0);
+    AOT_GOTO(0x05bc, L05bc);
+L05bc:
+    AOT_BLOCK(0x05bc, 1);
+    // 05bc: jmp 0304
+    {
+        a = 0x0304;
+    }
+    AOT_GOTO(0x0304, L0304);
+L05c0:
+    AOT_BLOCK(0x05c0, 1);
+    // 05c0: jsr pc, 0418
+    {
+        a = 0x0418;
+        r[6] -= 2;
+        WR16(r[6], 0x05c4);
+    }
+    AOT_GOTO(0x0418, L0418);
+L05c4:
+    AOT_BLOCK(0x05c4, 1);
+    // 05c4: br 05dc
+    AOT_GOTO(0x05dc, L05dc);
+L05dc:
+    AOT_BLOCK(0x05dc, 3);
+    // 05dc: mov r0, 43ba
+    {
+        src = r[0];
+        b = 0x43ba;
+        WR16(b, src);
+    }
+    // 05e0: mov $1, r4
+    {
+        src = uint16_t(0x0001);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05e4: jsr pc, 0174
+    {
+        a = 0x0174;
+        r[6] -= 2;
+        WR16(r[6], 0x05e8);
+    }
+    AOT_GOTO(0x0174, L0174);
+L05e8:
+    AOT_BLOCK(0x05e8, 2);
+    // 05e8: mov 43ba, r4
+    {
+        a = 0x43ba;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05ec: jsr pc, 0174
+    {
+        a = 0x0174;
+        r[6] -= 2;
+        WR16(r[6], 0x05f0);
+    }
+    AOT_GOTO(0x0174, L0174);
+L05f0:
+    AOT_BLOCK(0x05f0, 3);
+    // 05f0: mov $1, r4
+    {
+        src = uint16_t(0x0001);
+        r[4] = src;
+    }
+    // 05f4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05f6: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0614:
+    AOT_BLOCK(0x0614, 2);
+    // 0614: mov $3c, r4
+    {
+        src = uint16_t(0x003c);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0618: jsr pc, 0174
+    {
+        a = 0x0174;
+        r[6] -= 2;
+        WR16(r[6], 0x061c);
+    }
+    AOT_GOTO(0x0174, L0174);
+L061c:
+    AOT_BLOCK(0x061c, 1);
+    // 061c: clr 43ba
+    {
+        a = 0x43ba;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0620, L0620);
+L0620:
+    AOT_BLOCK(0x0620, 1);
+    // 0620: jsr pc, 0648
+    {
+        a = 0x0648;
+        r[6] -= 2;
+        WR16(r[6], 0x0624);
+    }
+    AOT_GOTO(0x0648, L0648);
+L0624:
+    AOT_BLOCK(0x0624, 2);
+    // 0624: tst r1
+    {
+        val = int16_t(r[1]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0626: bne 0638
+    if (!Z)
+        AOT_GOTO(0x0638, L0638);
+    AOT_GOTO(0x0628, L0628);
+L0628:
+    AOT_BLOCK(0x0628, 3);
+    // 0628: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 062a: bis $100, r4
+    {
+        src = uint16_t(0x0100);
+        dst = r[4];
+        val = src | dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 062e: jsr pc, 0174
+    {
+        a = 0x0174;
+        r[6] -= 2;
+        WR16(r[6], 0x0632);
+    }
+    AOT_GOTO(0x0174, L0174);
+L0632:
+    AOT_BLOCK(0x0632, 2);
+    // 0632: inc 43ba
+    {
+        a = 0x43ba;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0636: br 0620
+    AOT_GOTO(0x0620, L0620);
+L0638:
+    AOT_BLOCK(0x0638, 2);
+    // 0638: mov $ffff, r4
+    {
+        src = uint16_t(0xffff);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 063c: jsr pc, 0174
+    {
+        a = 0x0174;
+        r[6] -= 2;
+        WR16(r[6], 0x0640);
+    }
+    AOT_GOTO(0x0174, L0174);
+L0640:
+    AOT_BLOCK(0x0640, 3);
+    // 0640: mov $3c, r4
+    {
+        src = uint16_t(0x003c);
+        r[4] = src;
+    }
+    // 0644: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0646: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0648:
+    AOT_BLOCK(0x0648, 1);
+    // 0648: jsr pc, 048a
+    {
+        a = 0x048a;
+        r[6] -= 2;
+        WR16(r[6], 0x064c);
+    }
+    AOT_GOTO(0x048a, L048a);
+L064c:
+    AOT_BLOCK(0x064c, 2);
+    // 064c: cmp r0, $4
+    {
+        src = r[0];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0650: beq 0682
+    if (Z)
+        AOT_GOTO(0x0682, L0682);
+    AOT_GOTO(0x0652, L0652);
+L0652:
+    AOT_BLOCK(0x0652, 2);
+    // 0652: cmp r0, $a
+    {
+        src = r[0];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0656: beq 0682
+    if (Z)
+        AOT_GOTO(0x0682, L0682);
+    AOT_GOTO(0x0658, L0658);
+L0658:
+    AOT_BLOCK(0x0658, 3);
+    // 0658: clr r1
+    {
+        r[1] = 0;
+    }
+    // 065a: cmp r0, $5c
+    {
+        src = r[0];
+        dst = uint16_t(0x005c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 065e: bne 0678
+    if (!Z)
+        AOT_GOTO(0x0678, L0678);
+    AOT_GOTO(0x0660, L0660);
+L0660:
+    AOT_BLOCK(0x0660, 1);
+    // 0660: jsr pc, 048a
+    {
+        a = 0x048a;
+        r[6] -= 2;
+        WR16(r[6], 0x0664);
+    }
+    AOT_GOTO(0x048a, L048a);
+L0664:
+    AOT_BLOCK(0x0664, 1);
+    // 0664: mov $68c, r2
+    {
+        src = uint16_t(0x068c);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0668, L0668);
+L0668:
+    AOT_BLOCK(0x0668, 2);
+    // 0668: cmpb (r2)+, r0
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        dst = uint8_t(r[0]);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 066a: beq 0672
+    if (Z)
+        AOT_GOTO(0x0672, L0672);
+    AOT_GOTO(0x066c, L066c);
+L066c:
+    AOT_BLOCK(0x066c, 2);
+    // 066c: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 066e: bpl 0668
+    if (!N)
+        AOT_GOTO(0x0668, L0668);
+    AOT_GOTO(0x0670, L0670);
+L0670:
+    AOT_BLOCK(0x0670, 1);
+    // 0670: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0672:
+    AOT_BLOCK(0x0672, 2);
+    // 0672: movb (r2)+, r0
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0674: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0676, L0676);
+L0676:
+    AOT_BLOCK(0x0676, 1);
+    // 0676: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0678:
+    AOT_BLOCK(0x0678, 2);
+    // 0678: cmp r0, $3e
+    {
+        src = r[0];
+        dst = uint16_t(0x003e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 067c: bne 0680
+    if (!Z)
+        AOT_GOTO(0x0680, L0680);
+    AOT_GOTO(0x067e, L067e);
+L067e:
+    AOT_BLOCK(0x067e, 1);
+    // 067e: inc r1
+    {
+        val = int(int16_t(r[1])) + 1;
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0680, L0680);
+L0680:
+    AOT_BLOCK(0x0680, 1);
+    // 0680: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0682:
+    AOT_BLOCK(0x0682, 1);
+    // 0682: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0686;
+    }
+    AOT_GOTO(0x010e, L010e);
+L0686:
+    // 0686: (undefined)
+    AOT_INTERP(0x0686);
+L0688:
+    AOT_BLOCK(0x0688, 1);
+    // 0688: jmp 0054
+    {
+        a = 0x0054;
+    }
+    AOT_GOTO(0x0054, L0054);
+L069e:
+    AOT_BLOCK(0x069e, 2);
+    // 069e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06a0: jsr r5, 0168
+    {
+        a = 0x0168;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x06a4;
+    }
+    AOT_GOTO(0x0168, L0168);
+L06a4:
+    // 06a4: halt
+    AOT_INTERP(0x06a4);
+L06a6:
+    AOT_BLOCK(0x06a6, 1);
+    // 06a6: rts r0
+    {
+        b = r[0];
+        r[0] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06b4:
+    AOT_BLOCK(0x06b4, 1);
+    // 06b4: jsr pc, 092a
+    {
+        a = 0x092a;
+        r[6] -= 2;
+        WR16(r[6], 0x06b8);
+    }
+    AOT_GOTO(0x092a, L092a);
+L06b8:
+    AOT_BLOCK(0x06b8, 1);
+    // 06b8: add $2, 20b8
+    {
+        src = uint16_t(0x0002);
+        b = 0x20b8;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x06be, L06be);
+L06be:
+    AOT_BLOCK(0x06be, 1);
+    // 06be: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06c0:
+    AOT_BLOCK(0x06c0, 1);
+    // 06c0: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x06c2, L06c2);
+L06c2:
+    AOT_BLOCK(0x06c2, 2);
+    // 06c2: cmp r0, $14
+    {
+        src = r[0];
+        dst = uint16_t(0x0014);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06c6: beq 06b4
+    if (Z)
+        AOT_GOTO(0x06b4, L06b4);
+    AOT_GOTO(0x06c8, L06c8);
+L06c8:
+    AOT_BLOCK(0x06c8, 1);
+    // 06c8: jsr r5, 0168
+    {
+        a = 0x0168;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x06cc;
+    }
+    AOT_GOTO(0x0168, L0168);
+L06cc:
+    // 06cc: reset
+    AOT_INTERP(0x06cc);
+L06ce:
+    // 06ce: (undefined)
+    AOT_INTERP(0x06ce);
+L06d0:
+    AOT_BLOCK(0x06d0, 1);
+    // 06d0: br 06b4
+    AOT_GOTO(0x06b4, L06b4);
+L0700:
+    AOT_BLOCK(0x0700, 1);
+    // 0700: ble 06be
+    if (Z || (N ^ V))
+        AOT_GOTO(0x06be, L06be);
+    AOT_GOTO(0x0702, L0702);
+L0702:
+    AOT_BLOCK(0x0702, 1);
+    // 0702: ble 06c0
+    if (Z || (N ^ V))
+        AOT_GOTO(0x06c0, L06c0);
+    AOT_GOTO(0x0704, L0704);
+L0704:
+    AOT_BLOCK(0x0704, 1);
+    // 0704: ble 06c2
+    if (Z || (N ^ V))
+        AOT_GOTO(0x06c2, L06c2);
+    AOT_GOTO(0x0706, L0706);
+L0706:
+    AOT_BLOCK(0x0706, 1);
+    // 0706: ble 0784
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0784, L0784);
+    AOT_GOTO(0x0708, L0708);
+L0708:
+    AOT_BLOCK(0x0708, 1);
+    // 0708: ble 07c6
+    if (Z || (N ^ V))
+        AOT_GOTO(0x07c6, L07c6);
+    AOT_GOTO(0x070a, L070a);
+L070a:
+    AOT_BLOCK(0x070a, 1);
+    // 070a: ble 0704
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0704, L0704);
+    AOT_GOTO(0x070c, L070c);
+L070c:
+    AOT_BLOCK(0x070c, 1);
+    // 070c: bgt 0676
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0676, L0676);
+    AOT_GOTO(0x070e, L070e);
+L070e:
+    AOT_BLOCK(0x070e, 1);
+    // 070e: bgt 0678
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0678, L0678);
+    AOT_GOTO(0x0710, L0710);
+L0710:
+    AOT_BLOCK(0x0710, 1);
+    // 0710: ble 073a
+    if (Z || (N ^ V))
+        AOT_GOTO(0x073a, L073a);
+    AOT_GOTO(0x0712, L0712);
+L0712:
+    AOT_BLOCK(0x0712, 1);
+    // 0712: ble 0748
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0748, L0748);
+    AOT_GOTO(0x0714, L0714);
+L0714:
+    AOT_BLOCK(0x0714, 2);
+    // 0714: mov $4, -(sp)
+    {
+        src = uint16_t(0x0004);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0718: br 071e
+    AOT_GOTO(0x071e, L071e);
+L071e:
+    AOT_BLOCK(0x071e, 1);
+    // 071e: jsr pc, 092a
+    {
+        a = 0x092a;
+        r[6] -= 2;
+        WR16(r[6], 0x0722);
+    }
+    AOT_GOTO(0x092a, L092a);
+L0722:
+    AOT_BLOCK(0x0722, 2);
+    // 0722: cmp r3, 20b6
+    {
+        src = r[3];
+        b = 0x20b6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0726: bne 0738
+    if (!Z)
+        AOT_GOTO(0x0738, L0738);
+    AOT_GOTO(0x0728, L0728);
+L0728:
+    AOT_BLOCK(0x0728, 2);
+    // 0728: sub 20b8, r2
+    {
+        a = 0x20b8;
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 072c: bge 0738
+    if (!(N ^ V))
+        AOT_GOTO(0x0738, L0738);
+    AOT_GOTO(0x072e, L072e);
+L072e:
+    AOT_BLOCK(0x072e, 2);
+    // 072e: cmp r2, $ff02
+    {
+        src = r[2];
+        dst = uint16_t(0xff02);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0732: blt 0738
+    if (N ^ V)
+        AOT_GOTO(0x0738, L0738);
+    AOT_GOTO(0x0734, L0734);
+L0734:
+    AOT_BLOCK(0x0734, 1);
+    // 0734: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0738, L0738);
+L0738:
+    AOT_BLOCK(0x0738, 2);
+    // 0738: add (sp)+, 20b8
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = 0x20b8;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 073c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L073a:
+    AOT_BLOCK(0x073a, 2);
+    // 073a: mov -(r5), *87(r4)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        b = RD16(r[4] + 135);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 073e: jsr pc, 0822
+    {
+        a = 0x0822;
+        r[6] -= 2;
+        WR16(r[6], 0x0742);
+    }
+    AOT_GOTO(0x0822, L0822);
+L0742:
+    AOT_BLOCK(0x0742, 2);
+    // 0742: cmp r4, $2c
+    {
+        src = r[4];
+        dst = uint16_t(0x002c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0746: beq 074e
+    if (Z)
+        AOT_GOTO(0x074e, L074e);
+    AOT_GOTO(0x0748, L0748);
+L0748:
+    AOT_BLOCK(0x0748, 1);
+    // 0748: jsr pc, 08ee
+    {
+        a = 0x08ee;
+        r[6] -= 2;
+        WR16(r[6], 0x074c);
+    }
+    AOT_GOTO(0x08ee, L08ee);
+L074c:
+    AOT_BLOCK(0x074c, 1);
+    // 074c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L074e:
+    AOT_BLOCK(0x074e, 1);
+    // 074e: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x0752);
+    }
+    AOT_GOTO(0x0548, L0548);
+L0752:
+    AOT_BLOCK(0x0752, 1);
+    // 0752: jsr pc, 0822
+    {
+        a = 0x0822;
+        r[6] -= 2;
+        WR16(r[6], 0x0756);
+    }
+    AOT_GOTO(0x0822, L0822);
+L0756:
+    AOT_BLOCK(0x0756, 2);
+    // 0756: add $2, 20b8
+    {
+        src = uint16_t(0x0002);
+        b = 0x20b8;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 075c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L077c:
+    AOT_BLOCK(0x077c, 1);
+    // 077c: jsr pc, 092a
+    {
+        a = 0x092a;
+        r[6] -= 2;
+        WR16(r[6], 0x0780);
+    }
+    AOT_GOTO(0x092a, L092a);
+L0780:
+    AOT_BLOCK(0x0780, 1);
+    // 0780: inc 20b8
+    {
+        a = 0x20b8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0784, L0784);
+L0784:
+    AOT_BLOCK(0x0784, 2);
+    // 0784: cmp r4, $2c
+    {
+        src = r[4];
+        dst = uint16_t(0x002c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0788: bne 0790
+    if (!Z)
+        AOT_GOTO(0x0790, L0790);
+    AOT_GOTO(0x078a, L078a);
+L078a:
+    AOT_BLOCK(0x078a, 1);
+    // 078a: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x078e);
+    }
+    AOT_GOTO(0x0548, L0548);
+L078e:
+    AOT_BLOCK(0x078e, 1);
+    // 078e: br 077c
+    AOT_GOTO(0x077c, L077c);
+L0790:
+    AOT_BLOCK(0x0790, 1);
+    // 0790: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L07c2:
+    AOT_BLOCK(0x07c2, 1);
+    // 07c2: cmp r4, $80
+    {
+        src = r[4];
+        dst = uint16_t(0x0080);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x07c6, L07c6);
+L07c6:
+    AOT_BLOCK(0x07c6, 1);
+    // 07c6: bcs 07dc
+    if (C)
+        AOT_GOTO(0x07dc, L07dc);
+    AOT_GOTO(0x07c8, L07c8);
+L07c8:
+    AOT_BLOCK(0x07c8, 2);
+    // 07c8: bisb $20, (r4)
+    {
+        src = uint8_t(0x20);
+        b = r[4];
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 07cc: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x07d0);
+    }
+    AOT_GOTO(0x0548, L0548);
+L07d0:
+    AOT_BLOCK(0x07d0, 2);
+    // 07d0: cmp r4, $2c
+    {
+        src = r[4];
+        dst = uint16_t(0x002c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07d4: bne 07dc
+    if (!Z)
+        AOT_GOTO(0x07dc, L07dc);
+    AOT_GOTO(0x07d6, L07d6);
+L07d6:
+    AOT_BLOCK(0x07d6, 1);
+    // 07d6: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x07da);
+    }
+    AOT_GOTO(0x0548, L0548);
+L07da:
+    AOT_BLOCK(0x07da, 1);
+    // 07da: br 07c2
+    AOT_GOTO(0x07c2, L07c2);
+L07dc:
+    AOT_BLOCK(0x07dc, 1);
+    // 07dc: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0800:
+    AOT_BLOCK(0x0800, 1);
+    // 0800: bcs 081a
+    if (C)
+        AOT_GOTO(0x081a, L081a);
+    AOT_GOTO(0x0802, L0802);
+L0802:
+    AOT_BLOCK(0x0802, 2);
+    // 0802: bis $20, (r4)
+    {
+        src = uint16_t(0x0020);
+        b = r[4];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0806: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x080a);
+    }
+    AOT_GOTO(0x0548, L0548);
+L080a:
+    AOT_BLOCK(0x080a, 2);
+    // 080a: cmp r4, $2c
+    {
+        src = r[4];
+        dst = uint16_t(0x002c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 080e: bne 081a
+    if (!Z)
+        AOT_GOTO(0x081a, L081a);
+    AOT_GOTO(0x0810, L0810);
+L0810:
+    AOT_BLOCK(0x0810, 1);
+    // 0810: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x0814);
+    }
+    AOT_GOTO(0x0548, L0548);
+L0814:
+    AOT_BLOCK(0x0814, 1);
+    // 0814: jsr pc, 092a
+    {
+        a = 0x092a;
+        r[6] -= 2;
+        WR16(r[6], 0x0818);
+    }
+    AOT_GOTO(0x092a, L092a);
+L0818:
+    AOT_BLOCK(0x0818, 1);
+    // 0818: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L081a:
+    AOT_BLOCK(0x081a, 1);
+    // 081a: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x081e;
+    }
+    AOT_GOTO(0x010e, L010e);
+L081e:
+    AOT_BLOCK(0x081e, 1);
+    // 081e: jmp *87(r0)
+    {
+        a = RD16(r[0] + 135);
+    }
+    AOT_JUMP(a);
+L0822:
+    AOT_BLOCK(0x0822, 2);
+    // 0822: cmp r4, $28
+    {
+        src = r[4];
+        dst = uint16_t(0x0028);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0826: beq 0876
+    if (Z)
+        AOT_GOTO(0x0876, L0876);
+    AOT_GOTO(0x0828, L0828);
+L0828:
+    AOT_BLOCK(0x0828, 2);
+    // 0828: cmp r4, $2d
+    {
+        src = r[4];
+        dst = uint16_t(0x002d);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 082c: beq 089a
+    if (Z)
+        AOT_GOTO(0x089a, L089a);
+    AOT_GOTO(0x082e, L082e);
+L082e:
+    AOT_BLOCK(0x082e, 2);
+    // 082e: cmp r4, $24
+    {
+        src = r[4];
+        dst = uint16_t(0x0024);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0832: beq 08c2
+    if (Z)
+        AOT_GOTO(0x08c2, L08c2);
+    AOT_GOTO(0x0834, L0834);
+L0834:
+    AOT_BLOCK(0x0834, 2);
+    // 0834: cmp r4, $2a
+    {
+        src = r[4];
+        dst = uint16_t(0x002a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0838: beq 08d4
+    if (Z)
+        AOT_GOTO(0x08d4, L08d4);
+    AOT_GOTO(0x083a, L083a);
+L083a:
+    AOT_BLOCK(0x083a, 1);
+    // 083a: jsr pc, 092a
+    {
+        a = 0x092a;
+        r[6] -= 2;
+        WR16(r[6], 0x083e);
+    }
+    AOT_GOTO(0x092a, L092a);
+L083e:
+    AOT_BLOCK(0x083e, 2);
+    // 083e: cmp r4, $28
+    {
+        src = r[4];
+        dst = uint16_t(0x0028);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0842: bne 085e
+    if (!Z)
+        AOT_GOTO(0x085e, L085e);
+    AOT_GOTO(0x0844, L0844);
+L0844:
+    AOT_BLOCK(0x0844, 1);
+    // 0844: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x0848);
+    }
+    AOT_GOTO(0x0548, L0548);
+L0848:
+    AOT_BLOCK(0x0848, 1);
+    // 0848: jsr pc, 092a
+    {
+        a = 0x092a;
+        r[6] -= 2;
+        WR16(r[6], 0x084c);
+    }
+    AOT_GOTO(0x092a, L092a);
+L084c:
+    AOT_BLOCK(0x084c, 1);
+    // 084c: jsr pc, 08f6
+    {
+        a = 0x08f6;
+        r[6] -= 2;
+        WR16(r[6], 0x0850);
+    }
+    AOT_GOTO(0x08f6, L08f6);
+L0850:
+    AOT_BLOCK(0x0850, 1);
+    // 0850: jsr pc, 0916
+    {
+        a = 0x0916;
+        r[6] -= 2;
+        WR16(r[6], 0x0854);
+    }
+    AOT_GOTO(0x0916, L0916);
+L0854:
+    AOT_BLOCK(0x0854, 3);
+    // 0854: add $2, 20b8
+    {
+        src = uint16_t(0x0002);
+        b = 0x20b8;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 085a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 085c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L085e:
+    AOT_BLOCK(0x085e, 2);
+    // 085e: cmp r3, $14
+    {
+        src = r[3];
+        dst = uint16_t(0x0014);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0862: bne 086c
+    if (!Z)
+        AOT_GOTO(0x086c, L086c);
+    AOT_GOTO(0x0864, L0864);
+L0864:
+    AOT_BLOCK(0x0864, 1);
+    // 0864: jsr pc, 08f6
+    {
+        a = 0x08f6;
+        r[6] -= 2;
+        WR16(r[6], 0x0868);
+    }
+    AOT_GOTO(0x08f6, L08f6);
+L0868:
+    AOT_BLOCK(0x0868, 2);
+    // 0868: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 086a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L086c:
+    AOT_BLOCK(0x086c, 3);
+    // 086c: add $2, 20b8
+    {
+        src = uint16_t(0x0002);
+        b = 0x20b8;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0872: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0874: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0876:
+    AOT_BLOCK(0x0876, 1);
+    // 0876: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x087a);
+    }
+    AOT_GOTO(0x0548, L0548);
+L087a:
+    AOT_BLOCK(0x087a, 1);
+    // 087a: jsr pc, 092a
+    {
+        a = 0x092a;
+        r[6] -= 2;
+        WR16(r[6], 0x087e);
+    }
+    AOT_GOTO(0x092a, L092a);
+L087e:
+    AOT_BLOCK(0x087e, 1);
+    // 087e: jsr pc, 0916
+    {
+        a = 0x0916;
+        r[6] -= 2;
+        WR16(r[6], 0x0882);
+    }
+    AOT_GOTO(0x0916, L0916);
+L0882:
+    AOT_BLOCK(0x0882, 1);
+    // 0882: jsr pc, 08f6
+    {
+        a = 0x08f6;
+        r[6] -= 2;
+        WR16(r[6], 0x0886);
+    }
+    AOT_GOTO(0x08f6, L08f6);
+L0886:
+    AOT_BLOCK(0x0886, 2);
+    // 0886: cmp r4, $2b
+    {
+        src = r[4];
+        dst = uint16_t(0x002b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 088a: bne 0894
+    if (!Z)
+        AOT_GOTO(0x0894, L0894);
+    AOT_GOTO(0x088c, L088c);
+L088c:
+    AOT_BLOCK(0x088c, 1);
+    // 088c: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x0890);
+    }
+    AOT_GOTO(0x0548, L0548);
+L0890:
+    AOT_BLOCK(0x0890, 2);
+    // 0890: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0892: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0894:
+    AOT_BLOCK(0x0894, 2);
+    // 0894: mov $2, r0
+    {
+        src = uint16_t(0x0002);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0898: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L089a:
+    AOT_BLOCK(0x089a, 1);
+    // 089a: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x089e);
+    }
+    AOT_GOTO(0x0548, L0548);
+L089e:
+    AOT_BLOCK(0x089e, 2);
+    // 089e: cmp r4, $28
+    {
+        src = r[4];
+        dst = uint16_t(0x0028);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08a2: beq 08ae
+    if (Z)
+        AOT_GOTO(0x08ae, L08ae);
+    AOT_GOTO(0x08a4, L08a4);
+L08a4:
+    AOT_BLOCK(0x08a4, 3);
+    // 08a4: mov r4, 43b8
+    {
+        src = r[4];
+        b = 0x43b8;
+        WR16(b, src);
+    }
+    // 08a8: mov $2d, r4
+    {
+        src = uint16_t(0x002d);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08ac: br 083a
+    AOT_GOTO(0x083a, L083a);
+L08ae:
+    AOT_BLOCK(0x08ae, 1);
+    // 08ae: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x08b2);
+    }
+    AOT_GOTO(0x0548, L0548);
+L08b2:
+    AOT_BLOCK(0x08b2, 1);
+    // 08b2: jsr pc, 092a
+    {
+        a = 0x092a;
+        r[6] -= 2;
+        WR16(r[6], 0x08b6);
+    }
+    AOT_GOTO(0x092a, L092a);
+L08b6:
+    AOT_BLOCK(0x08b6, 1);
+    // 08b6: jsr pc, 0916
+    {
+        a = 0x0916;
+        r[6] -= 2;
+        WR16(r[6], 0x08ba);
+    }
+    AOT_GOTO(0x0916, L0916);
+L08ba:
+    AOT_BLOCK(0x08ba, 1);
+    // 08ba: jsr pc, 08f6
+    {
+        a = 0x08f6;
+        r[6] -= 2;
+        WR16(r[6], 0x08be);
+    }
+    AOT_GOTO(0x08f6, L08f6);
+L08be:
+    AOT_BLOCK(0x08be, 2);
+    // 08be: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 08c0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L08c2:
+    AOT_BLOCK(0x08c2, 1);
+    // 08c2: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x08c6);
+    }
+    AOT_GOTO(0x0548, L0548);
+L08c6:
+    AOT_BLOCK(0x08c6, 1);
+    // 08c6: jsr pc, 092a
+    {
+        a = 0x092a;
+        r[6] -= 2;
+        WR16(r[6], 0x08ca);
+    }
+    AOT_GOTO(0x092a, L092a);
+L08ca:
+    AOT_BLOCK(0x08ca, 3);
+    // 08ca: add $2, 20b8
+    {
+        src = uint16_t(0x0002);
+        b = 0x20b8;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 08d0: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 08d2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L08d4:
+    AOT_BLOCK(0x08d4, 1);
+    // 08d4: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x08d8);
+    }
+    AOT_GOTO(0x0548, L0548);
+L08d8:
+    AOT_BLOCK(0x08d8, 2);
+    // 08d8: cmp r4, $2a
+    {
+        src = r[4];
+        dst = uint16_t(0x002a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08dc: bne 08e4
+    if (!Z)
+        AOT_GOTO(0x08e4, L08e4);
+    AOT_GOTO(0x08de, L08de);
+L08de:
+    AOT_BLOCK(0x08de, 1);
+    // 08de: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x08e2;
+    }
+    AOT_GOTO(0x010e, L010e);
+L08e2:
+    // 08e2: (undefined)
+    AOT_INTERP(0x08e2);
+L08e4:
+    AOT_BLOCK(0x08e4, 1);
+    // 08e4: jsr pc, 0822
+    {
+        a = 0x0822;
+        r[6] -= 2;
+        WR16(r[6], 0x08e8);
+    }
+    AOT_GOTO(0x0822, L0822);
+L08e8:
+    AOT_BLOCK(0x08e8, 2);
+    // 08e8: add r0, 20b8
+    {
+        src = r[0];
+        b = 0x20b8;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 08ec: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L08ee:
+    AOT_BLOCK(0x08ee, 1);
+    // 08ee: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x08f2;
+    }
+    AOT_GOTO(0x010e, L010e);
+L08f2:
+    AOT_BLOCK(0x08f2, 1);
+    // 08f2: jmp -(r1)
+    {
+        r[1] -= 2;
+        a = r[1];
+    }
+    AOT_JUMP(a);
+L08f6:
+    AOT_BLOCK(0x08f6, 2);
+    // 08f6: cmp r2, $7
+    {
+        src = r[2];
+        dst = uint16_t(0x0007);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08fa: bhi 0908
+    if (!(C | Z))
+        AOT_GOTO(0x0908, L0908);
+    AOT_GOTO(0x08fc, L08fc);
+L08fc:
+    AOT_BLOCK(0x08fc, 2);
+    // 08fc: cmp r3, $1
+    {
+        src = r[3];
+        dst = uint16_t(0x0001);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0900: beq 090c
+    if (Z)
+        AOT_GOTO(0x090c, L090c);
+    AOT_GOTO(0x0902, L0902);
+L0902:
+    AOT_BLOCK(0x0902, 2);
+    // 0902: cmp r3, $4
+    {
+        src = r[3];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0906: bhi 090c
+    if (!(C | Z))
+        AOT_GOTO(0x090c, L090c);
+    AOT_GOTO(0x0908, L0908);
+L0908:
+    AOT_BLOCK(0x0908, 1);
+    // 0908: jsr pc, 08ee
+    {
+        a = 0x08ee;
+        r[6] -= 2;
+        WR16(r[6], 0x090c);
+    }
+    AOT_GOTO(0x08ee, L08ee);
+L090c:
+    AOT_BLOCK(0x090c, 1);
+    // 090c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0916:
+    AOT_BLOCK(0x0916, 2);
+    // 0916: cmp r4, $29
+    {
+        src = r[4];
+        dst = uint16_t(0x0029);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 091a: beq 0924
+    if (Z)
+        AOT_GOTO(0x0924, L0924);
+    AOT_GOTO(0x091c, L091c);
+L091c:
+    AOT_BLOCK(0x091c, 1);
+    // 091c: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0920;
+    }
+    AOT_GOTO(0x010e, L010e);
+L0920:
+    // 0920: (undefined)
+    AOT_INTERP(0x0920);
+L0922:
+    AOT_BLOCK(0x0922, 1);
+    // 0922: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0924:
+    AOT_BLOCK(0x0924, 1);
+    // 0924: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x0928);
+    }
+    AOT_GOTO(0x0548, L0548);
+L0928:
+    AOT_BLOCK(0x0928, 1);
+    // 0928: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L092a:
+    AOT_BLOCK(0x092a, 6);
+    // 092a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 092c: mov $2b, -(sp)
+    {
+        src = uint16_t(0x002b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0930: clr 43b6
+    {
+        a = 0x43b6;
+        WR16(a, 0);
+    }
+    // 0934: clr r2
+    {
+        r[2] = 0;
+        C = false;
+    }
+    // 0936: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 093a: br 0940
+    AOT_GOTO(0x0940, L0940);
+L093c:
+    AOT_BLOCK(0x093c, 1);
+    // 093c: jsr pc, 0548
+    {
+        a = 0x0548;
+        r[6] -= 2;
+        WR16(r[6], 0x0940);
+    }
+    AOT_GOTO(0x0548, L0548);
+L0940:
+    AOT_BLOCK(0x0940, 2);
+    // 0940: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0942: jsr r5, 0168
+    {
+        a = 0x0168;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0946;
+    }
+    AOT_GOTO(0x0168, L0168);
+L0946:
+    // 0946: halt
+    AOT_INTERP(0x0946);
+L0948:
+    AOT_BLOCK(0x0948, 1);
+    // 0948: jmp *0a4d
+    {
+        a = RD16(0x0a4d);
+    }
+    AOT_JUMP(a);
+L0a00:
+    AOT_BLOCK(0x0a00, 1);
+    // 0a00: beq 0a08
+    if (Z)
+        AOT_GOTO(0x0a08, L0a08);
+    AOT_GOTO(0x0a02, L0a02);
+L0a02:
+    AOT_BLOCK(0x0a02, 1);
+    // 0a02: jsr r5, 010e
+    {
+        a = 0x010e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a06;
+    }
+    AOT_GOTO(0x010e, L010e);
+L0a06:
+    AOT_BLOCK(0x0a06, 1);
+    // 0a06: jmp *(r5)+
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+    }
+    AOT_JUMP(a);
+L0a08:
+    AOT_BLOCK(0x0a08, 6);
+    // 0a08: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 0a0a: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 0a0c: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0a0e: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0a10: inc 43b6
+    {
+        a = 0x43b6;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0a14: mov $a26, r5
+    {
+        src = uint16_t(0x0a26);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a18, L0a18);
+L0a18:
+    AOT_BLOCK(0x0a18, 2);
+    // 0a18: cmp (sp), (r5)+
+    {
+        a = r[6];
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a1a: beq 0a22
+    if (Z)
+        AOT_GOTO(0x0a22, L0a22);
+    AOT_GOTO(0x0a1c, L0a1c);
+L0a1c:
+    AOT_BLOCK(0x0a1c, 2);
+    // 0a1c: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a1e: bne 0a18
+    if (!Z)
+        AOT_GOTO(0x0a18, L0a18);
+    AOT_GOTO(0x0a20, L0a20);
+L0a20:
+    AOT_BLOCK(0x0a20, 1);
+    // 0a20: br 0ad4
+    AOT_GOTO(0x0ad4, L0ad4);
+L0a22:
+    AOT_BLOCK(0x0a22, 1);
+    // 0a22: jmp *0(r5)
+    {
+        a = RD16(r[5] + 0);
+    }
+    AOT_JUMP(a);
+L0a40:
+    AOT_BLOCK(0x0a40, 1);
+    // 0a40: com -(r4)
+    {
+        r[4] -= 2;
+        a = r[4];
+        val = ~int(RD16(a));
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = true;
+        V = false;
+    }
+    // 0a42: (undefined)
+    AOT_INTERP(0x0a42);
+L0a44:
+    AOT_BLOCK(0x0a44, 1);
+    // 0a44: com *(r2)+
+    {
+        a = RD16(r[2]);
+        r[2] += 2;
+        val = ~int(RD16(a));
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = true;
+        V = false;
+    }
+    // 0a46: (undefined)
+    AOT_INTERP(0x0a46);
+L0a48:
+    AOT_BLOCK(0x0a48, 1);
+    // 0a48: com *-(sp)
+    {
+        r[6] -= 2;
+        a = RD16(r[6]);
+        val = ~int(RD16(a));
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = true;
+        V = false;
+    }
+    // 0a4a: (undefined)
+    AOT_INTERP(0x0a4a);
+L0a4c:
+    AOT_BLOCK(0x0a4c, 2);
+    // 0a4c: dec (r0)
+    {
+        a = r[0];
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0a4e: jmp *(sp)+
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(a);
+L0a80:
+    AOT_BLOCK(0x0a80, 1);
+    // 0a80: jsr r5, 0adc
+    {
+        a = 0x0adc;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a84;
+    }
+    AOT_GOTO(0x0adc, L0adc);
+L0a84:
+    // 0a84: halt
+    AOT_INTERP(0x0a84);
+L0a86:
+    AOT_BLOCK(0x0a86, 2);
+    // 0a86: add r1, r2
+    {
+        src = r[1];
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0a88: br 0ad4
+    AOT_GOTO(0x0ad4, L0ad4);
+L0ac0:
+    AOT_BLOCK(0x0ac0, 4);
+    // 0ac0: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0ac2: div (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0ac4: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ac6: br 0ad4
+    AOT_GOTO(0x0ad4, L0ad4);
+L0ad4:
+    AOT_BLOCK(0x0ad4, 2);
+    // 0ad4: mov $2b, (sp)
+    {
+        src = uint16_t(0x002b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ad8: jmp 093c
+    {
+        a = 0x093c;
+    }
+    AOT_GOTO(0x093c, L093c);
+L0adc:
+    AOT_BLOCK(0x0adc, 7);
+    // 0adc: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ade: bis r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0ae0: bic $ffdf, (sp)
+    {
+        src = uint16_t(0xffdf);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0ae4: bic $ffe0, r0
+    {
+        src = uint16_t(0xffe0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0ae8: bic $ffe0, r3
+    {
+        src = uint16_t(0xffe0);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+    }
+    // 0aec: cmp r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0aee: ble 0af6
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0af6, L0af6);
+    AOT_GOTO(0x0af0, L0af0);
+L0af0:
+    AOT_BLOCK(0x0af0, 3);
+    // 0af0: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0af2: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 0af4: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0af6, L0af6);
+L0af6:
+    AOT_BLOCK(0x0af6, 2);
+    // 0af6: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0af8: beq 0b08
+    if (Z)
+        AOT_GOTO(0x0b08, L0b08);
+    AOT_GOTO(0x0afa, L0afa);
+L0afa:
+    AOT_BLOCK(0x0afa, 2);
+    // 0afa: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0afc: beq 0b0c
+    if (Z)
+        AOT_GOTO(0x0b0c, L0b0c);
+    AOT_GOTO(0x0afe, L0afe);
+L0afe:
+    AOT_BLOCK(0x0afe, 1);
+    // 0afe: cmp r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0b00, L0b00);
+L0b00:
+    AOT_BLOCK(0x0b00, 1);
+    // 0b00: bne 0b0c
+    if (!Z)
+        AOT_GOTO(0x0b0c, L0b0c);
+    AOT_GOTO(0x0b02, L0b02);
+L0b02:
+    AOT_BLOCK(0x0b02, 2);
+    // 0b02: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b06: br 0b0c
+    AOT_GOTO(0x0b0c, L0b0c);
+L0b08:
+    AOT_BLOCK(0x0b08, 2);
+    // 0b08: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0b0a: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0b0c, L0b0c);
+L0b0c:
+    AOT_BLOCK(0x0b0c, 2);
+    // 0b0c: bis (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b0e: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b40:
+    AOT_BLOCK(0x0b40, 3);
+    // 0b40: bit r4, 3332(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 13106);
+        dst = RD16(b);
+        val = src & dst;
+    }
+    // 0b44: bit (r4)+, 3736(r4)
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = uint16_t(r[4] + 14134);
+        dst = RD16(b);
+        val = src & dst;
+    }
+    // 0b48: bit -(r4), *-110(r0)
+    {
+        r[4] -= 2;
+        a = r[4];
+        src = RD16(a);
+        b = RD16(r[0] + -272);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b4c: (undefined)
+    AOT_INTERP(0x0b4c);
+L0b4e:
+    // 0b4e: (undefined)
+    AOT_INTERP(0x0b4e);
+L0b50:
+    AOT_BLOCK(0x0b50, 11);
+    // 0b50: bic pc, 4342(r4)
+    {
+        src = uint16_t(0x0b52);
+        b = uint16_t(r[4] + 17218);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0b54: bic (r5)+, r4
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 0b56: bic *(r5)+, sp
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        dst = r[6];
+        val = (~src) & dst;
+        r[6] = val;
+    }
+    // 0b58: bic -(r5), (r0)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0b5a: bic *-(r5), (r2)
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        b = r[2];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0b5c: bic 4f4e(r5), (r4)
+    {
+        a = uint16_t(r[5] + 20302);
+        src = RD16(a);
+        b = r[4];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0b60: bis r5, (r0)+
+    {
+        src = r[5];
+        b = r[0];
+        r[0] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0b62: bis (r5), (r2)+
+    {
+        a = r[5];
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0b64: bis (r5)+, (r4)+
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0b66: bis *(r5)+, (sp)+
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0b68: bis -(r5), *(r0)+
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        b = RD16(r[0]);
+        r[0] += 2;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b6a: (undefined)
+    AOT_INTERP(0x0b6a);
+L0b6c:
+    // 0b6c: (undefined)
+    AOT_INTERP(0x0b6c);
+L0b6e:
+    AOT_BLOCK(0x0b6e, 6);
+    // 0b6e: bis *6d66, 6362(r0)
+    {
+        a = RD16(0x6d66);
+        src = RD16(a);
+        b = uint16_t(r[0] + 25442);
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0b74: add (r5)+, -(r4)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0b76: add *(r5)+, -(sp)
+    {
+        a = RD16(r[5]);
+        r[5] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0b78: add -(r5), *-(r0)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0b7a: add *-(r5), *-(r2)
+    {
+        r[5] -= 2;
+        a = RD16(r[5]);
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0b7c: add 6f6e(r5), *-(r4)
+    {
+        a = uint16_t(r[5] + 28526);
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0b80, L0b80);
+L0b80:
+    AOT_BLOCK(0x0b80, 3);
+    // 0b80: mul 7372(r0), r5
+    {
+        a = uint16_t(r[0] + 29554);
+        src = int16_t(RD16(a));
+        val = int(r[5]) * src;
+        r[5] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 0b84: ash 7776(r4), r5
+    {
+        a = uint16_t(r[4] + 30582);
+        src = RD16(a) & 077;
+        val16 = r[5];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0b88: xor r5, *-b86(r0)
+    {
+        src = r[5];
+        b = RD16(r[0] + -2950);
+        val = src ^ RD16(b);
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b8c: (undefined)
+    AOT_INTERP(0x0b8c);
+L0b8e:
+    // 0b8e: (undefined)
+    AOT_INTERP(0x0b8e);
+L0b90:
+    // 0b90: halt
+    AOT_INTERP(0x0b90);
+L0b92:
+    // 0b92: halt
+    AOT_INTERP(0x0b92);
+L0b94:
+    // 0b94: halt
+    AOT_INTERP(0x0b94);
+L0b96:
+    // 0b96: halt
+    AOT_INTERP(0x0b96);
+L0b98:
+    // 0b98: halt
+    AOT_INTERP(0x0b98);
+L0b9a:
+    // 0b9a: halt
+    AOT_INTERP(0x0b9a);
+L0b9c:
+    // 0b9c: halt
+    AOT_INTERP(0x0b9c);
+L0b9e:
+    // 0b9e: halt
+    AOT_INTERP(0x0b9e);
+L0ba0:
+    // 0ba0: halt
+    AOT_INTERP(0x0ba0);
+L0ba2:
+    // 0ba2: halt
+    AOT_INTERP(0x0ba2);
+L0ba4:
+    // 0ba4: halt
+    AOT_INTERP(0x0ba4);
+L0ba6:
+    // 0ba6: halt
+    AOT_INTERP(0x0ba6);
+L0ba8:
+    // 0ba8: halt
+    AOT_INTERP(0x0ba8);
+L0baa:
+    // 0baa: halt
+    AOT_INTERP(0x0baa);
+L0bac:
+    // 0bac: halt
+    AOT_INTERP(0x0bac);
+L0bae:
+    // 0bae: halt
+    AOT_INTERP(0x0bae);
+L0bb0:
+    // 0bb0: halt
+    AOT_INTERP(0x0bb0);
+L0bb2:
+    // 0bb2: halt
+    AOT_INTERP(0x0bb2);
+L0bb4:
+    // 0bb4: halt
+    AOT_INTERP(0x0bb4);
+L0bb6:
+    // 0bb6: halt
+    AOT_INTERP(0x0bb6);
+L0bb8:
+    // 0bb8: halt
+    AOT_INTERP(0x0bb8);
+L0bba:
+    // 0bba: halt
+    AOT_INTERP(0x0bba);
+L0bbc:
+    // 0bbc: halt
+    AOT_INTERP(0x0bbc);
+L0bbe:
+    // 0bbe: halt
+    AOT_INTERP(0x0bbe);
+}
+
+AotImage image("v7/bin/as", 0x0000, 3008, 0x88cce83bu, run);
+}
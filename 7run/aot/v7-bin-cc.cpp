@@ -0,0 +1,14001 @@
+// v7/bin/cc translated by 7aot: 657 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x000a: goto L000a;
+        case 0x001a: goto L001a;
+        case 0x001e: goto L001e;
+        case 0x0024: goto L0024;
+        case 0x0026: goto L0026;
+        case 0x0032: goto L0032;
+        case 0x003a: goto L003a;
+        case 0x003c: goto L003c;
+        case 0x003e: goto L003e;
+        case 0x0040: goto L0040;
+        case 0x0042: goto L0042;
+        case 0x0044: goto L0044;
+        case 0x0064: goto L0064;
+        case 0x0066: goto L0066;
+        case 0x006c: goto L006c;
+        case 0x0070: goto L0070;
+        case 0x0074: goto L0074;
+        case 0x0078: goto L0078;
+        case 0x0086: goto L0086;
+        case 0x008a: goto L008a;
+        case 0x00a8: goto L00a8;
+        case 0x00ac: goto L00ac;
+        case 0x00b4: goto L00b4;
+        case 0x00c0: goto L00c0;
+        case 0x00c4: goto L00c4;
+        case 0x00da: goto L00da;
+        case 0x00e4: goto L00e4;
+        case 0x00ea: goto L00ea;
+        case 0x00ee: goto L00ee;
+        case 0x00fa: goto L00fa;
+        case 0x0104: goto L0104;
+        case 0x0108: goto L0108;
+        case 0x0110: goto L0110;
+        case 0x0114: goto L0114;
+        case 0x012e: goto L012e;
+        case 0x0138: goto L0138;
+        case 0x013e: goto L013e;
+        case 0x0148: goto L0148;
+        case 0x014a: goto L014a;
+        case 0x015a: goto L015a;
+        case 0x016c: goto L016c;
+        case 0x0176: goto L0176;
+        case 0x0186: goto L0186;
+        case 0x01a6: goto L01a6;
+        case 0x01aa: goto L01aa;
+        case 0x01b4: goto L01b4;
+        case 0x01c0: goto L01c0;
+        case 0x01c6: goto L01c6;
+        case 0x01d0: goto L01d0;
+        case 0x01d2: goto L01d2;
+        case 0x01ec: goto L01ec;
+        case 0x01f0: goto L01f0;
+        case 0x01fa: goto L01fa;
+        case 0x0200: goto L0200;
+        case 0x0206: goto L0206;
+        case 0x020c: goto L020c;
+        case 0x0210: goto L0210;
+        case 0x0216: goto L0216;
+        case 0x021c: goto L021c;
+        case 0x0220: goto L0220;
+        case 0x0236: goto L0236;
+        case 0x0240: goto L0240;
+        case 0x0246: goto L0246;
+        case 0x024c: goto L024c;
+        case 0x0264: goto L0264;
+        case 0x026e: goto L026e;
+        case 0x0278: goto L0278;
+        case 0x0284: goto L0284;
+        case 0x028a: goto L028a;
+        case 0x0296: goto L0296;
+        case 0x029c: goto L029c;
+        case 0x02b4: goto L02b4;
+        case 0x02be: goto L02be;
+        case 0x02c8: goto L02c8;
+        case 0x02d0: goto L02d0;
+        case 0x02d6: goto L02d6;
+        case 0x02dc: goto L02dc;
+        case 0x02e2: goto L02e2;
+        case 0x02e6: goto L02e6;
+        case 0x02ec: goto L02ec;
+        case 0x02f0: goto L02f0;
+        case 0x02f6: goto L02f6;
+        case 0x02fa: goto L02fa;
+        case 0x0300: goto L0300;
+        case 0x0304: goto L0304;
+        case 0x030a: goto L030a;
+        case 0x0310: goto L0310;
+        case 0x0316: goto L0316;
+        case 0x031a: goto L031a;
+        case 0x0320: goto L0320;
+        case 0x0324: goto L0324;
+        case 0x032a: goto L032a;
+        case 0x032e: goto L032e;
+        case 0x0334: goto L0334;
+        case 0x0338: goto L0338;
+        case 0x033e: goto L033e;
+        case 0x0342: goto L0342;
+        case 0x0348: goto L0348;
+        case 0x0352: goto L0352;
+        case 0x0354: goto L0354;
+        case 0x036e: goto L036e;
+        case 0x0374: goto L0374;
+        case 0x0380: goto L0380;
+        case 0x0384: goto L0384;
+        case 0x038a: goto L038a;
+        case 0x0390: goto L0390;
+        case 0x0396: goto L0396;
+        case 0x039c: goto L039c;
+        case 0x03a2: goto L03a2;
+        case 0x03a8: goto L03a8;
+        case 0x03ae: goto L03ae;
+        case 0x03b6: goto L03b6;
+        case 0x03bc: goto L03bc;
+        case 0x03c2: goto L03c2;
+        case 0x03c8: goto L03c8;
+        case 0x03ca: goto L03ca;
+        case 0x03d4: goto L03d4;
+        case 0x03e0: goto L03e0;
+        case 0x03ec: goto L03ec;
+        case 0x03f8: goto L03f8;
+        case 0x0404: goto L0404;
+        case 0x0410: goto L0410;
+        case 0x041c: goto L041c;
+        case 0x0428: goto L0428;
+        case 0x0432: goto L0432;
+        case 0x0436: goto L0436;
+        case 0x0438: goto L0438;
+        case 0x043c: goto L043c;
+        case 0x0442: goto L0442;
+        case 0x0448: goto L0448;
+        case 0x044e: goto L044e;
+        case 0x0454: goto L0454;
+        case 0x0458: goto L0458;
+        case 0x045e: goto L045e;
+        case 0x0464: goto L0464;
+        case 0x046a: goto L046a;
+        case 0x0470: goto L0470;
+        case 0x0474: goto L0474;
+        case 0x047a: goto L047a;
+        case 0x0482: goto L0482;
+        case 0x0488: goto L0488;
+        case 0x0490: goto L0490;
+        case 0x049a: goto L049a;
+        case 0x04a0: goto L04a0;
+        case 0x04a2: goto L04a2;
+        case 0x04ae: goto L04ae;
+        case 0x04b8: goto L04b8;
+        case 0x04c2: goto L04c2;
+        case 0x04ca: goto L04ca;
+        case 0x04d6: goto L04d6;
+        case 0x04dc: goto L04dc;
+        case 0x04e8: goto L04e8;
+        case 0x04f0: goto L04f0;
+        case 0x04fc: goto L04fc;
+        case 0x04fe: goto L04fe;
+        case 0x050a: goto L050a;
+        case 0x0512: goto L0512;
+        case 0x051e: goto L051e;
+        case 0x0520: goto L0520;
+        case 0x0528: goto L0528;
+        case 0x053a: goto L053a;
+        case 0x054c: goto L054c;
+        case 0x055c: goto L055c;
+        case 0x0564: goto L0564;
+        case 0x056e: goto L056e;
+        case 0x0574: goto L0574;
+        case 0x057c: goto L057c;
+        case 0x0586: goto L0586;
+        case 0x0590: goto L0590;
+        case 0x0598: goto L0598;
+        case 0x059c: goto L059c;
+        case 0x05a4: goto L05a4;
+        case 0x05b6: goto L05b6;
+        case 0x05b8: goto L05b8;
+        case 0x05c6: goto L05c6;
+        case 0x05cc: goto L05cc;
+        case 0x05dc: goto L05dc;
+        case 0x05e8: goto L05e8;
+        case 0x05fa: goto L05fa;
+        case 0x0600: goto L0600;
+        case 0x061e: goto L061e;
+        case 0x0624: goto L0624;
+        case 0x0628: goto L0628;
+        case 0x063e: goto L063e;
+        case 0x0654: goto L0654;
+        case 0x065c: goto L065c;
+        case 0x0676: goto L0676;
+        case 0x067c: goto L067c;
+        case 0x0686: goto L0686;
+        case 0x068a: goto L068a;
+        case 0x0690: goto L0690;
+        case 0x06a8: goto L06a8;
+        case 0x06ba: goto L06ba;
+        case 0x06c6: goto L06c6;
+        case 0x06ca: goto L06ca;
+        case 0x06d6: goto L06d6;
+        case 0x06dc: goto L06dc;
+        case 0x06f4: goto L06f4;
+        case 0x0706: goto L0706;
+        case 0x0710: goto L0710;
+        case 0x071c: goto L071c;
+        case 0x0722: goto L0722;
+        case 0x0732: goto L0732;
+        case 0x0738: goto L0738;
+        case 0x073e: goto L073e;
+        case 0x0760: goto L0760;
+        case 0x0766: goto L0766;
+        case 0x076e: goto L076e;
+        case 0x077c: goto L077c;
+        case 0x0784: goto L0784;
+        case 0x078a: goto L078a;
+        case 0x07ae: goto L07ae;
+        case 0x07c6: goto L07c6;
+        case 0x07ce: goto L07ce;
+        case 0x07d6: goto L07d6;
+        case 0x07e2: goto L07e2;
+        case 0x07ea: goto L07ea;
+        case 0x07ee: goto L07ee;
+        case 0x07f2: goto L07f2;
+        case 0x07f8: goto L07f8;
+        case 0x07fc: goto L07fc;
+        case 0x0802: goto L0802;
+        case 0x0806: goto L0806;
+        case 0x0828: goto L0828;
+        case 0x0834: goto L0834;
+        case 0x083a: goto L083a;
+        case 0x085c: goto L085c;
+        case 0x0876: goto L0876;
+        case 0x087e: goto L087e;
+        case 0x0884: goto L0884;
+        case 0x0896: goto L0896;
+        case 0x08a6: goto L08a6;
+        case 0x08c0: goto L08c0;
+        case 0x08ce: goto L08ce;
+        case 0x08d6: goto L08d6;
+        case 0x08dc: goto L08dc;
+        case 0x08e8: goto L08e8;
+        case 0x08f0: goto L08f0;
+        case 0x08f4: goto L08f4;
+        case 0x090a: goto L090a;
+        case 0x0914: goto L0914;
+        case 0x091c: goto L091c;
+        case 0x0924: goto L0924;
+        case 0x092a: goto L092a;
+        case 0x0932: goto L0932;
+        case 0x093a: goto L093a;
+        case 0x0942: goto L0942;
+        case 0x094a: goto L094a;
+        case 0x0952: goto L0952;
+        case 0x0956: goto L0956;
+        case 0x0968: goto L0968;
+        case 0x096e: goto L096e;
+        case 0x0972: goto L0972;
+        case 0x0976: goto L0976;
+        case 0x097e: goto L097e;
+        case 0x0984: goto L0984;
+        case 0x0988: goto L0988;
+        case 0x098e: goto L098e;
+        case 0x0994: goto L0994;
+        case 0x099a: goto L099a;
+        case 0x099e: goto L099e;
+        case 0x09a8: goto L09a8;
+        case 0x09ae: goto L09ae;
+        case 0x09b4: goto L09b4;
+        case 0x09b8: goto L09b8;
+        case 0x09c0: goto L09c0;
+        case 0x09c2: goto L09c2;
+        case 0x09ce: goto L09ce;
+        case 0x09d6: goto L09d6;
+        case 0x09da: goto L09da;
+        case 0x09e0: goto L09e0;
+        case 0x09e2: goto L09e2;
+        case 0x09e6: goto L09e6;
+        case 0x09f0: goto L09f0;
+        case 0x09f6: goto L09f6;
+        case 0x09fc: goto L09fc;
+        case 0x09fe: goto L09fe;
+        case 0x0a02: goto L0a02;
+        case 0x0a06: goto L0a06;
+        case 0x0a12: goto L0a12;
+        case 0x0a18: goto L0a18;
+        case 0x0a1e: goto L0a1e;
+        case 0x0a20: goto L0a20;
+        case 0x0a24: goto L0a24;
+        case 0x0a30: goto L0a30;
+        case 0x0a3c: goto L0a3c;
+        case 0x0a42: goto L0a42;
+        case 0x0a4e: goto L0a4e;
+        case 0x0a5c: goto L0a5c;
+        case 0x0a66: goto L0a66;
+        case 0x0a70: goto L0a70;
+        case 0x0a76: goto L0a76;
+        case 0x0a84: goto L0a84;
+        case 0x0a8a: goto L0a8a;
+        case 0x0a96: goto L0a96;
+        case 0x0a9e: goto L0a9e;
+        case 0x0aa2: goto L0aa2;
+        case 0x0ab0: goto L0ab0;
+        case 0x0ab8: goto L0ab8;
+        case 0x0ac0: goto L0ac0;
+        case 0x0ac4: goto L0ac4;
+        case 0x0ac8: goto L0ac8;
+        case 0x0ad4: goto L0ad4;
+        case 0x0ae0: goto L0ae0;
+        case 0x0aee: goto L0aee;
+        case 0x0af6: goto L0af6;
+        case 0x0b00: goto L0b00;
+        case 0x0b0a: goto L0b0a;
+        case 0x0b10: goto L0b10;
+        case 0x0b16: goto L0b16;
+        case 0x0b24: goto L0b24;
+        case 0x0b2a: goto L0b2a;
+        case 0x0b30: goto L0b30;
+        case 0x0b34: goto L0b34;
+        case 0x0b36: goto L0b36;
+        case 0x0b3a: goto L0b3a;
+        case 0x0b48: goto L0b48;
+        case 0x0b4c: goto L0b4c;
+        case 0x0b52: goto L0b52;
+        case 0x0b56: goto L0b56;
+        case 0x0b5c: goto L0b5c;
+        case 0x0b66: goto L0b66;
+        case 0x0b6e: goto L0b6e;
+        case 0x0b72: goto L0b72;
+        case 0x0b88: goto L0b88;
+        case 0x0b96: goto L0b96;
+        case 0x0b9a: goto L0b9a;
+        case 0x0b9e: goto L0b9e;
+        case 0x0ba2: goto L0ba2;
+        case 0x0bb8: goto L0bb8;
+        case 0x0bc2: goto L0bc2;
+        case 0x0bc6: goto L0bc6;
+        case 0x0bca: goto L0bca;
+        case 0x0bce: goto L0bce;
+        case 0x0bdc: goto L0bdc;
+        case 0x0be4: goto L0be4;
+        case 0x0bec: goto L0bec;
+        case 0x0bfa: goto L0bfa;
+        case 0x0c02: goto L0c02;
+        case 0x0c06: goto L0c06;
+        case 0x0c0e: goto L0c0e;
+        case 0x0c20: goto L0c20;
+        case 0x0c26: goto L0c26;
+        case 0x0c2a: goto L0c2a;
+        case 0x0c30: goto L0c30;
+        case 0x0c34: goto L0c34;
+        case 0x0c3c: goto L0c3c;
+        case 0x0c4e: goto L0c4e;
+        case 0x0c52: goto L0c52;
+        case 0x0c56: goto L0c56;
+        case 0x0c5a: goto L0c5a;
+        case 0x0c72: goto L0c72;
+        case 0x0c7a: goto L0c7a;
+        case 0x0c82: goto L0c82;
+        case 0x0c88: goto L0c88;
+        case 0x0c8c: goto L0c8c;
+        case 0x0c9a: goto L0c9a;
+        case 0x0c9e: goto L0c9e;
+        case 0x0ca2: goto L0ca2;
+        case 0x0ca6: goto L0ca6;
+        case 0x0caa: goto L0caa;
+        case 0x0cb0: goto L0cb0;
+        case 0x0cb4: goto L0cb4;
+        case 0x0cb6: goto L0cb6;
+        case 0x0cc2: goto L0cc2;
+        case 0x0cc6: goto L0cc6;
+        case 0x0cd4: goto L0cd4;
+        case 0x0cda: goto L0cda;
+        case 0x0ce0: goto L0ce0;
+        case 0x0ce6: goto L0ce6;
+        case 0x0cec: goto L0cec;
+        case 0x0cf0: goto L0cf0;
+        case 0x0cf2: goto L0cf2;
+        case 0x0cf8: goto L0cf8;
+        case 0x0cfc: goto L0cfc;
+        case 0x0cfe: goto L0cfe;
+        case 0x0d02: goto L0d02;
+        case 0x0d06: goto L0d06;
+        case 0x0d0c: goto L0d0c;
+        case 0x0d0e: goto L0d0e;
+        case 0x0d12: goto L0d12;
+        case 0x0d16: goto L0d16;
+        case 0x0d18: goto L0d18;
+        case 0x0d24: goto L0d24;
+        case 0x0d26: goto L0d26;
+        case 0x0d28: goto L0d28;
+        case 0x0d2c: goto L0d2c;
+        case 0x0d3e: goto L0d3e;
+        case 0x0d42: goto L0d42;
+        case 0x0d46: goto L0d46;
+        case 0x0d4a: goto L0d4a;
+        case 0x0d50: goto L0d50;
+        case 0x0d56: goto L0d56;
+        case 0x0d5c: goto L0d5c;
+        case 0x0d6a: goto L0d6a;
+        case 0x0d6e: goto L0d6e;
+        case 0x0d74: goto L0d74;
+        case 0x0d78: goto L0d78;
+        case 0x0d7c: goto L0d7c;
+        case 0x0d88: goto L0d88;
+        case 0x0d8c: goto L0d8c;
+        case 0x0d90: goto L0d90;
+        case 0x0d9e: goto L0d9e;
+        case 0x0da2: goto L0da2;
+        case 0x0db2: goto L0db2;
+        case 0x0dba: goto L0dba;
+        case 0x0dbe: goto L0dbe;
+        case 0x0dc2: goto L0dc2;
+        case 0x0dc6: goto L0dc6;
+        case 0x0dd2: goto L0dd2;
+        case 0x0dd4: goto L0dd4;
+        case 0x0de0: goto L0de0;
+        case 0x0de4: goto L0de4;
+        case 0x0dea: goto L0dea;
+        case 0x0dec: goto L0dec;
+        case 0x0df6: goto L0df6;
+        case 0x0df8: goto L0df8;
+        case 0x0e02: goto L0e02;
+        case 0x0e04: goto L0e04;
+        case 0x0e0a: goto L0e0a;
+        case 0x0e0c: goto L0e0c;
+        case 0x0e1e: goto L0e1e;
+        case 0x0e26: goto L0e26;
+        case 0x0e2c: goto L0e2c;
+        case 0x0e3e: goto L0e3e;
+        case 0x0e42: goto L0e42;
+        case 0x0e48: goto L0e48;
+        case 0x0e54: goto L0e54;
+        case 0x0e5a: goto L0e5a;
+        case 0x0e64: goto L0e64;
+        case 0x0e76: goto L0e76;
+        case 0x0e84: goto L0e84;
+        case 0x0e86: goto L0e86;
+        case 0x0e88: goto L0e88;
+        case 0x0e8e: goto L0e8e;
+        case 0x0e98: goto L0e98;
+        case 0x0ea2: goto L0ea2;
+        case 0x0ea4: goto L0ea4;
+        case 0x0ea8: goto L0ea8;
+        case 0x0eae: goto L0eae;
+        case 0x0eb4: goto L0eb4;
+        case 0x0ebc: goto L0ebc;
+        case 0x0ec2: goto L0ec2;
+        case 0x0ed0: goto L0ed0;
+        case 0x0ede: goto L0ede;
+        case 0x0ee4: goto L0ee4;
+        case 0x0ef2: goto L0ef2;
+        case 0x0ef4: goto L0ef4;
+        case 0x0ef8: goto L0ef8;
+        case 0x0efa: goto L0efa;
+        case 0x0f00: goto L0f00;
+        case 0x0f0a: goto L0f0a;
+        case 0x0f14: goto L0f14;
+        case 0x0f16: goto L0f16;
+        case 0x0f1a: goto L0f1a;
+        case 0x0f20: goto L0f20;
+        case 0x0f24: goto L0f24;
+        case 0x0f38: goto L0f38;
+        case 0x0f44: goto L0f44;
+        case 0x0f4c: goto L0f4c;
+        case 0x0f6c: goto L0f6c;
+        case 0x0f76: goto L0f76;
+        case 0x0f7c: goto L0f7c;
+        case 0x0f82: goto L0f82;
+        case 0x0f8c: goto L0f8c;
+        case 0x0f90: goto L0f90;
+        case 0x0f98: goto L0f98;
+        case 0x0fa4: goto L0fa4;
+        case 0x0fac: goto L0fac;
+        case 0x0fb4: goto L0fb4;
+        case 0x0fc2: goto L0fc2;
+        case 0x0fcc: goto L0fcc;
+        case 0x0fdc: goto L0fdc;
+        case 0x0fe0: goto L0fe0;
+        case 0x0fec: goto L0fec;
+        case 0x0ff2: goto L0ff2;
+        case 0x0ffc: goto L0ffc;
+        case 0x1000: goto L1000;
+        case 0x1006: goto L1006;
+        case 0x101c: goto L101c;
+        case 0x1022: goto L1022;
+        case 0x102a: goto L102a;
+        case 0x1040: goto L1040;
+        case 0x1046: goto L1046;
+        case 0x1050: goto L1050;
+        case 0x1054: goto L1054;
+        case 0x1058: goto L1058;
+        case 0x105a: goto L105a;
+        case 0x105c: goto L105c;
+        case 0x1062: goto L1062;
+        case 0x1068: goto L1068;
+        case 0x106c: goto L106c;
+        case 0x1072: goto L1072;
+        case 0x1076: goto L1076;
+        case 0x108a: goto L108a;
+        case 0x1092: goto L1092;
+        case 0x1098: goto L1098;
+        case 0x10a4: goto L10a4;
+        case 0x10a8: goto L10a8;
+        case 0x10ac: goto L10ac;
+        case 0x10b4: goto L10b4;
+        case 0x10bc: goto L10bc;
+        case 0x10c4: goto L10c4;
+        case 0x10c8: goto L10c8;
+        case 0x10d8: goto L10d8;
+        case 0x10e0: goto L10e0;
+        case 0x10e6: goto L10e6;
+        case 0x10e8: goto L10e8;
+        case 0x10ea: goto L10ea;
+        case 0x10ec: goto L10ec;
+        case 0x10ee: goto L10ee;
+        case 0x10f0: goto L10f0;
+        case 0x10f8: goto L10f8;
+        case 0x1114: goto L1114;
+        case 0x1128: goto L1128;
+        case 0x112c: goto L112c;
+        case 0x1132: goto L1132;
+        case 0x1134: goto L1134;
+        case 0x1136: goto L1136;
+        case 0x113e: goto L113e;
+        case 0x1148: goto L1148;
+        case 0x1152: goto L1152;
+        case 0x115e: goto L115e;
+        case 0x1164: goto L1164;
+        case 0x116a: goto L116a;
+        case 0x116c: goto L116c;
+        case 0x1170: goto L1170;
+        case 0x117c: goto L117c;
+        case 0x1196: goto L1196;
+        case 0x11a8: goto L11a8;
+        case 0x11b4: goto L11b4;
+        case 0x11bc: goto L11bc;
+        case 0x11cc: goto L11cc;
+        case 0x11d6: goto L11d6;
+        case 0x11f6: goto L11f6;
+        case 0x1204: goto L1204;
+        case 0x120e: goto L120e;
+        case 0x1220: goto L1220;
+        case 0x12e8: goto L12e8;
+        case 0x12fe: goto L12fe;
+        case 0x1304: goto L1304;
+        case 0x1306: goto L1306;
+        case 0x130a: goto L130a;
+        case 0x132a: goto L132a;
+        case 0x1338: goto L1338;
+        case 0x133a: goto L133a;
+        case 0x133e: goto L133e;
+        case 0x1344: goto L1344;
+        case 0x1352: goto L1352;
+        case 0x1356: goto L1356;
+        case 0x1358: goto L1358;
+        case 0x135a: goto L135a;
+        case 0x135c: goto L135c;
+        case 0x1362: goto L1362;
+        case 0x1370: goto L1370;
+        case 0x1374: goto L1374;
+        case 0x137a: goto L137a;
+        case 0x138e: goto L138e;
+        case 0x1390: goto L1390;
+        case 0x1392: goto L1392;
+        case 0x1394: goto L1394;
+        case 0x1396: goto L1396;
+        case 0x139a: goto L139a;
+        case 0x139e: goto L139e;
+        case 0x13a8: goto L13a8;
+        case 0x13aa: goto L13aa;
+        case 0x13ac: goto L13ac;
+        case 0x13ae: goto L13ae;
+        case 0x13b0: goto L13b0;
+        case 0x13b4: goto L13b4;
+        case 0x13c6: goto L13c6;
+        case 0x13c8: goto L13c8;
+        case 0x13ca: goto L13ca;
+        case 0x13cc: goto L13cc;
+        case 0x13ce: goto L13ce;
+        case 0x13d2: goto L13d2;
+        case 0x13ea: goto L13ea;
+        case 0x13ec: goto L13ec;
+        case 0x13ee: goto L13ee;
+        case 0x13f0: goto L13f0;
+        case 0x13f2: goto L13f2;
+        case 0x13f6: goto L13f6;
+        case 0x13f8: goto L13f8;
+        case 0x13fa: goto L13fa;
+        case 0x13fc: goto L13fc;
+        case 0x13fe: goto L13fe;
+        case 0x1404: goto L1404;
+        case 0x1408: goto L1408;
+        case 0x1420: goto L1420;
+        case 0x1422: goto L1422;
+        case 0x1424: goto L1424;
+        case 0x1426: goto L1426;
+        case 0x1428: goto L1428;
+        case 0x142e: goto L142e;
+        case 0x143a: goto L143a;
+        case 0x1442: goto L1442;
+        case 0x1444: goto L1444;
+        case 0x1446: goto L1446;
+        case 0x1448: goto L1448;
+        case 0x144a: goto L144a;
+        case 0x1478: goto L1478;
+        case 0x1486: goto L1486;
+        case 0x149e: goto L149e;
+        case 0x14a4: goto L14a4;
+        case 0x14ae: goto L14ae;
+        case 0x14b0: goto L14b0;
+        case 0x14b2: goto L14b2;
+        case 0x14b4: goto L14b4;
+        case 0x14b6: goto L14b6;
+        case 0x14b8: goto L14b8;
+        case 0x14ba: goto L14ba;
+        case 0x14bc: goto L14bc;
+        case 0x14c2: goto L14c2;
+        case 0x14c6: goto L14c6;
+        case 0x14de: goto L14de;
+        case 0x14e2: goto L14e2;
+        case 0x14e6: goto L14e6;
+        case 0x14ea: goto L14ea;
+        case 0x14ee: goto L14ee;
+        case 0x14f2: goto L14f2;
+        case 0x14f6: goto L14f6;
+        case 0x14fa: goto L14fa;
+        case 0x14fe: goto L14fe;
+        case 0x1500: goto L1500;
+        case 0x1502: goto L1502;
+        case 0x1506: goto L1506;
+        case 0x150a: goto L150a;
+        case 0x150e: goto L150e;
+        case 0x1512: goto L1512;
+        case 0x1516: goto L1516;
+        case 0x151a: goto L151a;
+        case 0x1530: goto L1530;
+        case 0x153e: goto L153e;
+        case 0x154a: goto L154a;
+        case 0x154c: goto L154c;
+        case 0x154e: goto L154e;
+        case 0x1550: goto L1550;
+        case 0x1552: goto L1552;
+        case 0x1558: goto L1558;
+        case 0x155e: goto L155e;
+        case 0x1560: goto L1560;
+        case 0x1562: goto L1562;
+        case 0x1564: goto L1564;
+        case 0x1566: goto L1566;
+        case 0x1568: goto L1568;
+        case 0x156a: goto L156a;
+        case 0x156e: goto L156e;
+        case 0x1572: goto L1572;
+        case 0x1588: goto L1588;
+        case 0x158a: goto L158a;
+        case 0x158c: goto L158c;
+        case 0x158e: goto L158e;
+        case 0x1590: goto L1590;
+        case 0x1594: goto L1594;
+        case 0x15a2: goto L15a2;
+        case 0x15ae: goto L15ae;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 3);
+    // 0000: setd
+    // 0002: mov 2(sp), r0
+    {
+        a = uint16_t(r[6] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0006: clr -2(r0)
+    {
+        a = uint16_t(r[0] + -2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x000a, L000a);
+L000a:
+    AOT_BLOCK(0x000a, 5);
+    // 000a: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+    }
+    // 000c: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0010: mov 4(sp), (sp)
+    {
+        a = uint16_t(r[6] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0014: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0016: mov r0, 2(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x001a, L001a);
+L001a:
+    AOT_BLOCK(0x001a, 2);
+    // 001a: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 001c: bne 001a
+    if (!Z)
+        AOT_GOTO(0x001a, L001a);
+    AOT_GOTO(0x001e, L001e);
+L001e:
+    AOT_BLOCK(0x001e, 2);
+    // 001e: cmp r0, *2(sp)
+    {
+        src = r[0];
+        b = RD16(r[6] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0022: bcs 0026
+    if (C)
+        AOT_GOTO(0x0026, L0026);
+    AOT_GOTO(0x0024, L0024);
+L0024:
+    AOT_BLOCK(0x0024, 1);
+    // 0024: tst -(r0)
+    {
+        r[0] -= 2;
+        a = r[0];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0026, L0026);
+L0026:
+    AOT_BLOCK(0x0026, 3);
+    // 0026: mov r0, 4(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 4);
+        WR16(b, src);
+    }
+    // 002a: mov r0, 2da2
+    {
+        src = r[0];
+        b = 0x2da2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 002e: jsr pc, 003c
+    {
+        a = 0x003c;
+        r[6] -= 2;
+        WR16(r[6], 0x0032);
+    }
+    AOT_GOTO(0x003c, L003c);
+L0032:
+    AOT_BLOCK(0x0032, 3);
+    // 0032: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0034: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0036: jsr pc, *$10d8
+    {
+        a = 0x10d8;
+        r[6] -= 2;
+        WR16(r[6], 0x003a);
+    }
+    AOT_GOTO(0x10d8, L10d8);
+L003a:
+    // 003a: sys 1
+    AOT_INTERP(0x003a);
+L003c:
+    AOT_BLOCK(0x003c, 2);
+    // 003c: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0040;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    AOT_GOTO(0x0040, L0040);
+L003e:
+    AOT_BLOCK(0x003e, 1);
+    // 003e: mov (r5)+, -(r2)
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0040, L0040);
+L0040:
+    AOT_BLOCK(0x0040, 1);
+    // 0040: sub $e2, sp
+    {
+        src = uint16_t(0x00e2);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0044, L0044);
+L0042:
+    AOT_BLOCK(0x0042, 1);
+    // 0042: swab -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0044, L0044);
+L0044:
+    AOT_BLOCK(0x0044, 9);
+    // 0044: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0046: mov r0, -e6(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -230);
+        WR16(b, src);
+    }
+    // 004a: mov r0, -e4(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -228);
+        WR16(b, src);
+    }
+    // 004e: mov r0, -dc(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -220);
+        WR16(b, src);
+    }
+    // 0052: mov r0, -da(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -218);
+        WR16(b, src);
+    }
+    // 0056: mov r0, -de(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -222);
+        WR16(b, src);
+    }
+    // 005a: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 005c: mov $22a4, -(sp)
+    {
+        src = uint16_t(0x22a4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0060: jsr pc, *$0bce
+    {
+        a = 0x0bce;
+        r[6] -= 2;
+        WR16(r[6], 0x0064);
+    }
+    AOT_GOTO(0x0bce, L0bce);
+L0064:
+    AOT_BLOCK(0x0064, 1);
+    // 0064: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0066, L0066);
+L0066:
+    AOT_BLOCK(0x0066, 2);
+    // 0066: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0068: add $ff2a, r0
+    {
+        src = uint16_t(0xff2a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x006c, L006c);
+L006c:
+    AOT_BLOCK(0x006c, 1);
+    // 006c: mov r0, -e(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0070, L0070);
+L0070:
+    AOT_BLOCK(0x0070, 1);
+    // 0070: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L0074:
+    AOT_BLOCK(0x0074, 1);
+    // 0074: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0078, L0078);
+L0078:
+    AOT_BLOCK(0x0078, 5);
+    // 0078: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 007a: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 007e: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0080: cmpb $2d, (r0)
+    {
+        src = uint8_t(0x2d);
+        b = r[0];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0084: beq 008a
+    if (Z)
+        AOT_GOTO(0x008a, L008a);
+    AOT_GOTO(0x0086, L0086);
+L0086:
+    AOT_BLOCK(0x0086, 1);
+    // 0086: jmp *$0220
+    {
+        a = 0x0220;
+    }
+    AOT_GOTO(0x0220, L0220);
+L008a:
+    AOT_BLOCK(0x008a, 10);
+    // 008a: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 008e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0090: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0094: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0096: movb 1(r0), r0
+    {
+        a = uint16_t(r[0] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 009a: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 009c: clr r0
+    {
+        r[0] = 0;
+    }
+    // 009e: div $3, r0
+    {
+        src = int16_t(uint16_t(0x0003));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 00a2: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 00a4: jmp *2058(r1)
+    {
+        a = RD16(r[1] + 8280);
+    }
+    AOT_JUMP(a);
+L00a8:
+    AOT_BLOCK(0x00a8, 1);
+    // 00a8: inc 298e
+    {
+        a = 0x298e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x00ac, L00ac);
+L00ac:
+    AOT_BLOCK(0x00ac, 2);
+    // 00ac: inc 2990
+    {
+        a = 0x2990;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 00b0: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L00b4:
+    AOT_BLOCK(0x00b4, 3);
+    // 00b4: inc -de(r5)
+    {
+        a = uint16_t(r[5] + -222);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 00b8: cmp 4(r5), -de(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -222);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00be: bgt 00c4
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x00c4, L00c4);
+    AOT_GOTO(0x00c0, L00c0);
+L00c0:
+    AOT_BLOCK(0x00c0, 1);
+    // 00c0: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L00c4:
+    AOT_BLOCK(0x00c4, 6);
+    // 00c4: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00c8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 00ca: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 00ce: mov (r0), 237c
+    {
+        a = r[0];
+        src = RD16(a);
+        b = 0x237c;
+        WR16(b, src);
+    }
+    // 00d2: mov 237c, (sp)
+    {
+        a = 0x237c;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00d6: jsr pc, *$09ce
+    {
+        a = 0x09ce;
+        r[6] -= 2;
+        WR16(r[6], 0x00da);
+    }
+    AOT_GOTO(0x09ce, L09ce);
+L00da:
+    AOT_BLOCK(0x00da, 3);
+    // 00da: mov r0, -e2(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -226);
+        WR16(b, src);
+    }
+    // 00de: cmp $63, r0
+    {
+        src = uint16_t(0x0063);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00e2: beq 00ee
+    if (Z)
+        AOT_GOTO(0x00ee, L00ee);
+    AOT_GOTO(0x00e4, L00e4);
+L00e4:
+    AOT_BLOCK(0x00e4, 2);
+    // 00e4: cmp $6f, r0
+    {
+        src = uint16_t(0x006f);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00e8: beq 00ee
+    if (Z)
+        AOT_GOTO(0x00ee, L00ee);
+    AOT_GOTO(0x00ea, L00ea);
+L00ea:
+    AOT_BLOCK(0x00ea, 1);
+    // 00ea: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L00ee:
+    AOT_BLOCK(0x00ee, 3);
+    // 00ee: mov 237c, (sp)
+    {
+        a = 0x237c;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00f2: mov $206a, -(sp)
+    {
+        src = uint16_t(0x206a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00f6: jsr pc, *$0956
+    {
+        a = 0x0956;
+        r[6] -= 2;
+        WR16(r[6], 0x00fa);
+    }
+    AOT_GOTO(0x0956, L0956);
+L00fa:
+    AOT_BLOCK(0x00fa, 3);
+    // 00fa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 00fc: mov $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0100: jsr pc, *$10d8
+    {
+        a = 0x10d8;
+        r[6] -= 2;
+        WR16(r[6], 0x0104);
+    }
+    AOT_GOTO(0x10d8, L10d8);
+L0104:
+    AOT_BLOCK(0x0104, 1);
+    // 0104: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L0108:
+    AOT_BLOCK(0x0108, 2);
+    // 0108: inc 2996
+    {
+        a = 0x2996;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 010c: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L0110:
+    AOT_BLOCK(0x0110, 1);
+    // 0110: inc 2994
+    {
+        a = 0x2994;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0114, L0114);
+L0114:
+    AOT_BLOCK(0x0114, 7);
+    // 0114: inc 298c
+    {
+        a = 0x298c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0118: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 011c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 011e: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0122: mov (r0), *-e(r5)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = RD16(r[5] + -14);
+        WR16(b, src);
+    }
+    // 0126: add $2, -e(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 012c: br 00ac
+    AOT_GOTO(0x00ac, L00ac);
+L012e:
+    AOT_BLOCK(0x012e, 3);
+    // 012e: inc 299a
+    {
+        a = 0x299a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0132: tst 299e
+    {
+        a = 0x299e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0136: bne 013e
+    if (!Z)
+        AOT_GOTO(0x013e, L013e);
+    AOT_GOTO(0x0138, L0138);
+L0138:
+    AOT_BLOCK(0x0138, 2);
+    // 0138: tst 299c
+    {
+        a = 0x299c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 013c: beq 014a
+    if (Z)
+        AOT_GOTO(0x014a, L014a);
+    AOT_GOTO(0x013e, L013e);
+L013e:
+    AOT_BLOCK(0x013e, 3);
+    // 013e: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0140: mov $207d, -(sp)
+    {
+        src = uint16_t(0x207d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0144: jsr pc, *$0956
+    {
+        a = 0x0956;
+        r[6] -= 2;
+        WR16(r[6], 0x0148);
+    }
+    AOT_GOTO(0x0956, L0956);
+L0148:
+    AOT_BLOCK(0x0148, 1);
+    // 0148: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x014a, L014a);
+L014a:
+    AOT_BLOCK(0x014a, 3);
+    // 014a: mov $209a, 299e
+    {
+        src = uint16_t(0x209a);
+        b = 0x299e;
+        WR16(b, src);
+    }
+    // 0150: mov $20a1, 299c
+    {
+        src = uint16_t(0x20a1);
+        b = 0x299c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0156: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L015a:
+    AOT_BLOCK(0x015a, 6);
+    // 015a: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 015e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0160: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0164: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0166: tstb 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 016a: bne 0176
+    if (!Z)
+        AOT_GOTO(0x0176, L0176);
+    AOT_GOTO(0x016c, L016c);
+L016c:
+    AOT_BLOCK(0x016c, 2);
+    // 016c: mov $20a3, 2056
+    {
+        src = uint16_t(0x20a3);
+        b = 0x2056;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0172: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L0176:
+    AOT_BLOCK(0x0176, 3);
+    // 0176: mov $20af, 2056
+    {
+        src = uint16_t(0x20af);
+        b = 0x2056;
+        WR16(b, src);
+    }
+    // 017c: mov $1, -e4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -228);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0182: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L0186:
+    AOT_BLOCK(0x0186, 9);
+    // 0186: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 018a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 018c: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0190: mov (r0), *-e(r5)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = RD16(r[5] + -14);
+        WR16(b, src);
+    }
+    // 0194: add $2, -e(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 019a: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 019c: add $fff2, r0
+    {
+        src = uint16_t(0xfff2);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 01a0: cmp -e(r5), r0
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01a4: bcc 01aa
+    if (!C)
+        AOT_GOTO(0x01aa, L01aa);
+    AOT_GOTO(0x01a6, L01a6);
+L01a6:
+    AOT_BLOCK(0x01a6, 1);
+    // 01a6: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L01aa:
+    AOT_BLOCK(0x01aa, 3);
+    // 01aa: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 01ac: mov $20bc, -(sp)
+    {
+        src = uint16_t(0x20bc);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01b0: jsr pc, *$0956
+    {
+        a = 0x0956;
+        r[6] -= 2;
+        WR16(r[6], 0x01b4);
+    }
+    AOT_GOTO(0x0956, L0956);
+L01b4:
+    AOT_BLOCK(0x01b4, 3);
+    // 01b4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 01b6: sub $2, -e(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[5] + -14);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 01bc: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L01c0:
+    AOT_BLOCK(0x01c0, 2);
+    // 01c0: tst 299e
+    {
+        a = 0x299e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 01c4: beq 01d2
+    if (Z)
+        AOT_GOTO(0x01d2, L01d2);
+    AOT_GOTO(0x01c6, L01c6);
+L01c6:
+    AOT_BLOCK(0x01c6, 3);
+    // 01c6: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 01c8: mov $20f4, -(sp)
+    {
+        src = uint16_t(0x20f4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01cc: jsr pc, *$0956
+    {
+        a = 0x0956;
+        r[6] -= 2;
+        WR16(r[6], 0x01d0);
+    }
+    AOT_GOTO(0x0956, L0956);
+L01d0:
+    AOT_BLOCK(0x01d0, 1);
+    // 01d0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x01d2, L01d2);
+L01d2:
+    AOT_BLOCK(0x01d2, 8);
+    // 01d2: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01d6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 01d8: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 01dc: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01de: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 01e2: mov r0, 299e
+    {
+        src = r[0];
+        b = 0x299e;
+        WR16(b, src);
+    }
+    // 01e6: tstb *299e
+    {
+        a = RD16(0x299e);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 01ea: beq 01f0
+    if (Z)
+        AOT_GOTO(0x01f0, L01f0);
+    AOT_GOTO(0x01ec, L01ec);
+L01ec:
+    AOT_BLOCK(0x01ec, 1);
+    // 01ec: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L01f0:
+    AOT_BLOCK(0x01f0, 2);
+    // 01f0: mov $2111, 299e
+    {
+        src = uint16_t(0x2111);
+        b = 0x299e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01f6: jmp *$0374
+    {
+        a = 0x0374;
+    }
+    AOT_GOTO(0x0374, L0374);
+L01fa:
+    AOT_BLOCK(0x01fa, 2);
+    // 01fa: cmp r0, $16
+    {
+        src = r[0];
+        dst = uint16_t(0x0016);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01fe: beq 01c0
+    if (Z)
+        AOT_GOTO(0x01c0, L01c0);
+    AOT_GOTO(0x0200, L0200);
+L0200:
+    AOT_BLOCK(0x0200, 2);
+    // 0200: cmp r0, $17
+    {
+        src = r[0];
+        dst = uint16_t(0x0017);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0204: beq 0110
+    if (Z)
+        AOT_GOTO(0x0110, L0110);
+    AOT_GOTO(0x0206, L0206);
+L0206:
+    AOT_BLOCK(0x0206, 2);
+    // 0206: cmp r0, $21
+    {
+        src = r[0];
+        dst = uint16_t(0x0021);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 020a: bne 0210
+    if (!Z)
+        AOT_GOTO(0x0210, L0210);
+    AOT_GOTO(0x020c, L020c);
+L020c:
+    AOT_BLOCK(0x020c, 1);
+    // 020c: jmp *$00ac
+    {
+        a = 0x00ac;
+    }
+    AOT_GOTO(0x00ac, L00ac);
+L0210:
+    AOT_BLOCK(0x0210, 2);
+    // 0210: cmp r0, $22
+    {
+        src = r[0];
+        dst = uint16_t(0x0022);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0214: beq 012e
+    if (Z)
+        AOT_GOTO(0x012e, L012e);
+    AOT_GOTO(0x0216, L0216);
+L0216:
+    AOT_BLOCK(0x0216, 2);
+    // 0216: cmp r0, $25
+    {
+        src = r[0];
+        dst = uint16_t(0x0025);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 021a: bne 0220
+    if (!Z)
+        AOT_GOTO(0x0220, L0220);
+    AOT_GOTO(0x021c, L021c);
+L021c:
+    AOT_BLOCK(0x021c, 1);
+    // 021c: jmp *$00b4
+    {
+        a = 0x00b4;
+    }
+    AOT_GOTO(0x00b4, L00b4);
+L0220:
+    AOT_BLOCK(0x0220, 6);
+    // 0220: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0224: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0226: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 022a: mov (r0), -8(r5)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 022e: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0232: jsr pc, *$09ce
+    {
+        a = 0x09ce;
+        r[6] -= 2;
+        WR16(r[6], 0x0236);
+    }
+    AOT_GOTO(0x09ce, L09ce);
+L0236:
+    AOT_BLOCK(0x0236, 3);
+    // 0236: mov r0, -e2(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -226);
+        WR16(b, src);
+    }
+    // 023a: cmp $63, r0
+    {
+        src = uint16_t(0x0063);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 023e: beq 024c
+    if (Z)
+        AOT_GOTO(0x024c, L024c);
+    AOT_GOTO(0x0240, L0240);
+L0240:
+    AOT_BLOCK(0x0240, 2);
+    // 0240: cmp $73, r0
+    {
+        src = uint16_t(0x0073);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0244: beq 024c
+    if (Z)
+        AOT_GOTO(0x024c, L024c);
+    AOT_GOTO(0x0246, L0246);
+L0246:
+    AOT_BLOCK(0x0246, 2);
+    // 0246: tst 2994
+    {
+        a = 0x2994;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 024a: beq 028a
+    if (Z)
+        AOT_GOTO(0x028a, L028a);
+    AOT_GOTO(0x024c, L024c);
+L024c:
+    AOT_BLOCK(0x024c, 6);
+    // 024c: mov -da(r5), r0
+    {
+        a = uint16_t(r[5] + -218);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0250: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0252: inc -da(r5)
+    {
+        a = uint16_t(r[5] + -218);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0256: mov -8(r5), 27fc(r0)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[0] + 10236);
+        WR16(b, src);
+    }
+    // 025c: cmp $64, -da(r5)
+    {
+        src = uint16_t(0x0064);
+        b = uint16_t(r[5] + -218);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0262: bgt 0278
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0278, L0278);
+    AOT_GOTO(0x0264, L0264);
+L0264:
+    AOT_BLOCK(0x0264, 3);
+    // 0264: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0266: mov $2122, -(sp)
+    {
+        src = uint16_t(0x2122);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 026a: jsr pc, *$0956
+    {
+        a = 0x0956;
+        r[6] -= 2;
+        WR16(r[6], 0x026e);
+    }
+    AOT_GOTO(0x0956, L0956);
+L026e:
+    AOT_BLOCK(0x026e, 3);
+    // 026e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0270: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0274: jsr pc, *$10d8
+    {
+        a = 0x10d8;
+        r[6] -= 2;
+        WR16(r[6], 0x0278);
+    }
+    AOT_GOTO(0x10d8, L10d8);
+L0278:
+    AOT_BLOCK(0x0278, 3);
+    // 0278: mov $6f, (sp)
+    {
+        src = uint16_t(0x006f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 027c: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0280: jsr pc, *$0a06
+    {
+        a = 0x0a06;
+        r[6] -= 2;
+        WR16(r[6], 0x0284);
+    }
+    AOT_GOTO(0x0a06, L0a06);
+L0284:
+    AOT_BLOCK(0x0284, 2);
+    // 0284: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0286: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x028a, L028a);
+L028a:
+    AOT_BLOCK(0x028a, 3);
+    // 028a: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 028e: mov $28c4, -(sp)
+    {
+        src = uint16_t(0x28c4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0292: jsr pc, *$0b16
+    {
+        a = 0x0b16;
+        r[6] -= 2;
+        WR16(r[6], 0x0296);
+    }
+    AOT_GOTO(0x0b16, L0b16);
+L0296:
+    AOT_BLOCK(0x0296, 3);
+    // 0296: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0298: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 029a: beq 0374
+    if (Z)
+        AOT_GOTO(0x0374, L0374);
+    AOT_GOTO(0x029c, L029c);
+L029c:
+    AOT_BLOCK(0x029c, 6);
+    // 029c: mov -dc(r5), r0
+    {
+        a = uint16_t(r[5] + -220);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 02a0: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 02a2: inc -dc(r5)
+    {
+        a = uint16_t(r[5] + -220);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 02a6: mov -8(r5), 28c4(r0)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[0] + 10436);
+        WR16(b, src);
+    }
+    // 02ac: cmp $64, -dc(r5)
+    {
+        src = uint16_t(0x0064);
+        b = uint16_t(r[5] + -220);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02b2: bgt 02c8
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x02c8, L02c8);
+    AOT_GOTO(0x02b4, L02b4);
+L02b4:
+    AOT_BLOCK(0x02b4, 3);
+    // 02b4: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 02b6: mov $2138, -(sp)
+    {
+        src = uint16_t(0x2138);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02ba: jsr pc, *$0956
+    {
+        a = 0x0956;
+        r[6] -= 2;
+        WR16(r[6], 0x02be);
+    }
+    AOT_GOTO(0x0956, L0956);
+L02be:
+    AOT_BLOCK(0x02be, 3);
+    // 02be: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 02c0: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02c4: jsr pc, *$10d8
+    {
+        a = 0x10d8;
+        r[6] -= 2;
+        WR16(r[6], 0x02c8);
+    }
+    AOT_GOTO(0x10d8, L10d8);
+L02c8:
+    AOT_BLOCK(0x02c8, 2);
+    // 02c8: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02cc: jsr pc, *$09ce
+    {
+        a = 0x09ce;
+        r[6] -= 2;
+        WR16(r[6], 0x02d0);
+    }
+    AOT_GOTO(0x09ce, L09ce);
+L02d0:
+    AOT_BLOCK(0x02d0, 2);
+    // 02d0: cmp $6f, r0
+    {
+        src = uint16_t(0x006f);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02d4: bne 0374
+    if (!Z)
+        AOT_GOTO(0x0374, L0374);
+    AOT_GOTO(0x02d6, L02d6);
+L02d6:
+    AOT_BLOCK(0x02d6, 2);
+    // 02d6: inc -e6(r5)
+    {
+        a = uint16_t(r[5] + -230);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 02da: br 0374
+    AOT_GOTO(0x0374, L0374);
+L02dc:
+    AOT_BLOCK(0x02dc, 2);
+    // 02dc: cmp r0, $16
+    {
+        src = r[0];
+        dst = uint16_t(0x0016);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02e0: bne 02e6
+    if (!Z)
+        AOT_GOTO(0x02e6, L02e6);
+    AOT_GOTO(0x02e2, L02e2);
+L02e2:
+    AOT_BLOCK(0x02e2, 1);
+    // 02e2: jmp *$0186
+    {
+        a = 0x0186;
+    }
+    AOT_GOTO(0x0186, L0186);
+L02e6:
+    AOT_BLOCK(0x02e6, 2);
+    // 02e6: cmp r0, $18
+    {
+        src = r[0];
+        dst = uint16_t(0x0018);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02ea: bne 02f0
+    if (!Z)
+        AOT_GOTO(0x02f0, L02f0);
+    AOT_GOTO(0x02ec, L02ec);
+L02ec:
+    AOT_BLOCK(0x02ec, 1);
+    // 02ec: jmp *$0186
+    {
+        a = 0x0186;
+    }
+    AOT_GOTO(0x0186, L0186);
+L02f0:
+    AOT_BLOCK(0x02f0, 2);
+    // 02f0: cmp r0, $1a
+    {
+        src = r[0];
+        dst = uint16_t(0x001a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02f4: bne 02fa
+    if (!Z)
+        AOT_GOTO(0x02fa, L02fa);
+    AOT_GOTO(0x02f6, L02f6);
+L02f6:
+    AOT_BLOCK(0x02f6, 1);
+    // 02f6: jmp *$0108
+    {
+        a = 0x0108;
+    }
+    AOT_GOTO(0x0108, L0108);
+L02fa:
+    AOT_BLOCK(0x02fa, 2);
+    // 02fa: cmp r0, $1c
+    {
+        src = r[0];
+        dst = uint16_t(0x001c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02fe: bne 0304
+    if (!Z)
+        AOT_GOTO(0x0304, L0304);
+    AOT_GOTO(0x0300, L0300);
+L0300:
+    AOT_BLOCK(0x0300, 1);
+    // 0300: jmp *$0186
+    {
+        a = 0x0186;
+    }
+    AOT_GOTO(0x0186, L0186);
+L0304:
+    AOT_BLOCK(0x0304, 2);
+    // 0304: cmp r0, $25
+    {
+        src = r[0];
+        dst = uint16_t(0x0025);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0308: bne 0220
+    if (!Z)
+        AOT_GOTO(0x0220, L0220);
+    AOT_GOTO(0x030a, L030a);
+L030a:
+    AOT_BLOCK(0x030a, 2);
+    // 030a: inc 2998
+    {
+        a = 0x2998;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 030e: br 0374
+    AOT_GOTO(0x0374, L0374);
+L0310:
+    AOT_BLOCK(0x0310, 2);
+    // 0310: cmp r0, $10
+    {
+        src = r[0];
+        dst = uint16_t(0x0010);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0314: bne 031a
+    if (!Z)
+        AOT_GOTO(0x031a, L031a);
+    AOT_GOTO(0x0316, L0316);
+L0316:
+    AOT_BLOCK(0x0316, 1);
+    // 0316: jmp *$015a
+    {
+        a = 0x015a;
+    }
+    AOT_GOTO(0x015a, L015a);
+L031a:
+    AOT_BLOCK(0x031a, 2);
+    // 031a: cmp r0, $16
+    {
+        src = r[0];
+        dst = uint16_t(0x0016);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 031e: bne 0324
+    if (!Z)
+        AOT_GOTO(0x0324, L0324);
+    AOT_GOTO(0x0320, L0320);
+L0320:
+    AOT_BLOCK(0x0320, 1);
+    // 0320: jmp *$0186
+    {
+        a = 0x0186;
+    }
+    AOT_GOTO(0x0186, L0186);
+L0324:
+    AOT_BLOCK(0x0324, 2);
+    // 0324: cmp r0, $1a
+    {
+        src = r[0];
+        dst = uint16_t(0x001a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0328: bne 032e
+    if (!Z)
+        AOT_GOTO(0x032e, L032e);
+    AOT_GOTO(0x032a, L032a);
+L032a:
+    AOT_BLOCK(0x032a, 1);
+    // 032a: jmp *$0114
+    {
+        a = 0x0114;
+    }
+    AOT_GOTO(0x0114, L0114);
+L032e:
+    AOT_BLOCK(0x032e, 2);
+    // 032e: cmp r0, $1b
+    {
+        src = r[0];
+        dst = uint16_t(0x001b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0332: bne 0338
+    if (!Z)
+        AOT_GOTO(0x0338, L0338);
+    AOT_GOTO(0x0334, L0334);
+L0334:
+    AOT_BLOCK(0x0334, 1);
+    // 0334: jmp *$00a8
+    {
+        a = 0x00a8;
+    }
+    AOT_GOTO(0x00a8, L00a8);
+L0338:
+    AOT_BLOCK(0x0338, 2);
+    // 0338: cmp r0, $26
+    {
+        src = r[0];
+        dst = uint16_t(0x0026);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 033c: beq 0342
+    if (Z)
+        AOT_GOTO(0x0342, L0342);
+    AOT_GOTO(0x033e, L033e);
+L033e:
+    AOT_BLOCK(0x033e, 1);
+    // 033e: jmp *$0220
+    {
+        a = 0x0220;
+    }
+    AOT_GOTO(0x0220, L0220);
+L0342:
+    AOT_BLOCK(0x0342, 2);
+    // 0342: tst 299c
+    {
+        a = 0x299c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0346: beq 0354
+    if (Z)
+        AOT_GOTO(0x0354, L0354);
+    AOT_GOTO(0x0348, L0348);
+L0348:
+    AOT_BLOCK(0x0348, 3);
+    // 0348: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 034a: mov $20d2, -(sp)
+    {
+        src = uint16_t(0x20d2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 034e: jsr pc, *$0956
+    {
+        a = 0x0956;
+        r[6] -= 2;
+        WR16(r[6], 0x0352);
+    }
+    AOT_GOTO(0x0956, L0956);
+L0352:
+    AOT_BLOCK(0x0352, 1);
+    // 0352: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0354, L0354);
+L0354:
+    AOT_BLOCK(0x0354, 8);
+    // 0354: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0358: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 035a: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 035e: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0360: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0364: mov r0, 299c
+    {
+        src = r[0];
+        b = 0x299c;
+        WR16(b, src);
+    }
+    // 0368: tstb *299c
+    {
+        a = RD16(0x299c);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 036c: bne 0374
+    if (!Z)
+        AOT_GOTO(0x0374, L0374);
+    AOT_GOTO(0x036e, L036e);
+L036e:
+    AOT_BLOCK(0x036e, 1);
+    // 036e: mov $20ef, 299c
+    {
+        src = uint16_t(0x20ef);
+        b = 0x299c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0374, L0374);
+L0374:
+    AOT_BLOCK(0x0374, 3);
+    // 0374: inc -de(r5)
+    {
+        a = uint16_t(r[5] + -222);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0378: cmp 4(r5), -de(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -222);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 037e: ble 0384
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0384, L0384);
+    AOT_GOTO(0x0380, L0380);
+L0380:
+    AOT_BLOCK(0x0380, 1);
+    // 0380: jmp *$0074
+    {
+        a = 0x0074;
+    }
+    AOT_GOTO(0x0074, L0074);
+L0384:
+    AOT_BLOCK(0x0384, 2);
+    // 0384: tst 299e
+    {
+        a = 0x299e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0388: beq 0396
+    if (Z)
+        AOT_GOTO(0x0396, L0396);
+    AOT_GOTO(0x038a, L038a);
+L038a:
+    AOT_BLOCK(0x038a, 2);
+    // 038a: tst 299c
+    {
+        a = 0x299c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 038e: bne 0396
+    if (!Z)
+        AOT_GOTO(0x0396, L0396);
+    AOT_GOTO(0x0390, L0390);
+L0390:
+    AOT_BLOCK(0x0390, 1);
+    // 0390: mov $2156, 299c
+    {
+        src = uint16_t(0x2156);
+        b = 0x299c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0396, L0396);
+L0396:
+    AOT_BLOCK(0x0396, 2);
+    // 0396: tst 299c
+    {
+        a = 0x299c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 039a: beq 03a8
+    if (Z)
+        AOT_GOTO(0x03a8, L03a8);
+    AOT_GOTO(0x039c, L039c);
+L039c:
+    AOT_BLOCK(0x039c, 2);
+    // 039c: tst 299e
+    {
+        a = 0x299e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03a0: bne 03a8
+    if (!Z)
+        AOT_GOTO(0x03a8, L03a8);
+    AOT_GOTO(0x03a2, L03a2);
+L03a2:
+    AOT_BLOCK(0x03a2, 1);
+    // 03a2: mov $215b, 299e
+    {
+        src = uint16_t(0x215b);
+        b = 0x299e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03a8, L03a8);
+L03a8:
+    AOT_BLOCK(0x03a8, 2);
+    // 03a8: tst 299c
+    {
+        a = 0x299c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03ac: beq 0442
+    if (Z)
+        AOT_GOTO(0x0442, L0442);
+    AOT_GOTO(0x03ae, L03ae);
+L03ae:
+    AOT_BLOCK(0x03ae, 2);
+    // 03ae: mov 299c, -8(r5)
+    {
+        a = 0x299c;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03b4: br 043c
+    AOT_GOTO(0x043c, L043c);
+L03b6:
+    AOT_BLOCK(0x03b6, 2);
+    // 03b6: cmp r0, $31
+    {
+        src = r[0];
+        dst = uint16_t(0x0031);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03ba: beq 03ec
+    if (Z)
+        AOT_GOTO(0x03ec, L03ec);
+    AOT_GOTO(0x03bc, L03bc);
+L03bc:
+    AOT_BLOCK(0x03bc, 2);
+    // 03bc: cmp r0, $32
+    {
+        src = r[0];
+        dst = uint16_t(0x0032);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03c0: beq 0404
+    if (Z)
+        AOT_GOTO(0x0404, L0404);
+    AOT_GOTO(0x03c2, L03c2);
+L03c2:
+    AOT_BLOCK(0x03c2, 2);
+    // 03c2: cmp r0, $70
+    {
+        src = r[0];
+        dst = uint16_t(0x0070);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03c6: beq 041c
+    if (Z)
+        AOT_GOTO(0x041c, L041c);
+    AOT_GOTO(0x03c8, L03c8);
+L03c8:
+    AOT_BLOCK(0x03c8, 1);
+    // 03c8: br 0438
+    AOT_GOTO(0x0438, L0438);
+L03ca:
+    AOT_BLOCK(0x03ca, 3);
+    // 03ca: movb *-8(r5), r0
+    {
+        a = RD16(r[5] + -8);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 03ce: cmp r0, $30
+    {
+        src = r[0];
+        dst = uint16_t(0x0030);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03d2: bne 03b6
+    if (!Z)
+        AOT_GOTO(0x03b6, L03b6);
+    AOT_GOTO(0x03d4, L03d4);
+L03d4:
+    AOT_BLOCK(0x03d4, 3);
+    // 03d4: mov 299e, (sp)
+    {
+        a = 0x299e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03d8: mov $2006, -(sp)
+    {
+        src = uint16_t(0x2006);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03dc: jsr pc, *$1362
+    {
+        a = 0x1362;
+        r[6] -= 2;
+        WR16(r[6], 0x03e0);
+    }
+    AOT_GOTO(0x1362, L1362);
+L03e0:
+    AOT_BLOCK(0x03e0, 4);
+    // 03e0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 03e2: mov $216b, (sp)
+    {
+        src = uint16_t(0x216b);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03e6: mov $2006, -(sp)
+    {
+        src = uint16_t(0x2006);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03ea: br 0432
+    AOT_GOTO(0x0432, L0432);
+L03ec:
+    AOT_BLOCK(0x03ec, 3);
+    // 03ec: mov 299e, (sp)
+    {
+        a = 0x299e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03f0: mov $201a, -(sp)
+    {
+        src = uint16_t(0x201a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03f4: jsr pc, *$1362
+    {
+        a = 0x1362;
+        r[6] -= 2;
+        WR16(r[6], 0x03f8);
+    }
+    AOT_GOTO(0x1362, L1362);
+L03f8:
+    AOT_BLOCK(0x03f8, 4);
+    // 03f8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 03fa: mov $216e, (sp)
+    {
+        src = uint16_t(0x216e);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03fe: mov $201a, -(sp)
+    {
+        src = uint16_t(0x201a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0402: br 0432
+    AOT_GOTO(0x0432, L0432);
+L0404:
+    AOT_BLOCK(0x0404, 3);
+    // 0404: mov 299e, (sp)
+    {
+        a = 0x299e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0408: mov $202e, -(sp)
+    {
+        src = uint16_t(0x202e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 040c: jsr pc, *$1362
+    {
+        a = 0x1362;
+        r[6] -= 2;
+        WR16(r[6], 0x0410);
+    }
+    AOT_GOTO(0x1362, L1362);
+L0410:
+    AOT_BLOCK(0x0410, 4);
+    // 0410: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0412: mov $2171, (sp)
+    {
+        src = uint16_t(0x2171);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0416: mov $202e, -(sp)
+    {
+        src = uint16_t(0x202e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 041a: br 0432
+    AOT_GOTO(0x0432, L0432);
+L041c:
+    AOT_BLOCK(0x041c, 3);
+    // 041c: mov 299e, (sp)
+    {
+        a = 0x299e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0420: mov $2042, -(sp)
+    {
+        src = uint16_t(0x2042);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0424: jsr pc, *$1362
+    {
+        a = 0x1362;
+        r[6] -= 2;
+        WR16(r[6], 0x0428);
+    }
+    AOT_GOTO(0x1362, L1362);
+L0428:
+    AOT_BLOCK(0x0428, 3);
+    // 0428: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 042a: mov $2174, (sp)
+    {
+        src = uint16_t(0x2174);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 042e: mov $2042, -(sp)
+    {
+        src = uint16_t(0x2042);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0432, L0432);
+L0432:
+    AOT_BLOCK(0x0432, 1);
+    // 0432: jsr pc, *$1344
+    {
+        a = 0x1344;
+        r[6] -= 2;
+        WR16(r[6], 0x0436);
+    }
+    AOT_GOTO(0x1344, L1344);
+L0436:
+    AOT_BLOCK(0x0436, 1);
+    // 0436: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0438, L0438);
+L0438:
+    AOT_BLOCK(0x0438, 1);
+    // 0438: inc -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x043c, L043c);
+L043c:
+    AOT_BLOCK(0x043c, 2);
+    // 043c: tstb *-8(r5)
+    {
+        a = RD16(r[5] + -8);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0440: bne 03ca
+    if (!Z)
+        AOT_GOTO(0x03ca, L03ca);
+    AOT_GOTO(0x0442, L0442);
+L0442:
+    AOT_BLOCK(0x0442, 2);
+    // 0442: tst 299a
+    {
+        a = 0x299a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0446: beq 045e
+    if (Z)
+        AOT_GOTO(0x045e, L045e);
+    AOT_GOTO(0x0448, L0448);
+L0448:
+    AOT_BLOCK(0x0448, 2);
+    // 0448: tst 2998
+    {
+        a = 0x2998;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 044c: beq 0454
+    if (Z)
+        AOT_GOTO(0x0454, L0454);
+    AOT_GOTO(0x044e, L044e);
+L044e:
+    AOT_BLOCK(0x044e, 2);
+    // 044e: mov $2178, r0
+    {
+        src = uint16_t(0x2178);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0452: br 0458
+    AOT_GOTO(0x0458, L0458);
+L0454:
+    AOT_BLOCK(0x0454, 1);
+    // 0454: mov $2186, r0
+    {
+        src = uint16_t(0x2186);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0458, L0458);
+L0458:
+    AOT_BLOCK(0x0458, 2);
+    // 0458: mov r0, 2056
+    {
+        src = r[0];
+        b = 0x2056;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 045c: br 046a
+    AOT_GOTO(0x046a, L046a);
+L045e:
+    AOT_BLOCK(0x045e, 2);
+    // 045e: tst 2998
+    {
+        a = 0x2998;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0462: beq 046a
+    if (Z)
+        AOT_GOTO(0x046a, L046a);
+    AOT_GOTO(0x0464, L0464);
+L0464:
+    AOT_BLOCK(0x0464, 1);
+    // 0464: mov $2193, 2056
+    {
+        src = uint16_t(0x2193);
+        b = 0x2056;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x046a, L046a);
+L046a:
+    AOT_BLOCK(0x046a, 2);
+    // 046a: tst -da(r5)
+    {
+        a = uint16_t(r[5] + -218);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 046e: bne 0474
+    if (!Z)
+        AOT_GOTO(0x0474, L0474);
+    AOT_GOTO(0x0470, L0470);
+L0470:
+    AOT_BLOCK(0x0470, 1);
+    // 0470: jmp *$07f2
+    {
+        a = 0x07f2;
+    }
+    AOT_GOTO(0x07f2, L07f2);
+L0474:
+    AOT_BLOCK(0x0474, 2);
+    // 0474: tst 298c
+    {
+        a = 0x298c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0478: bne 04dc
+    if (!Z)
+        AOT_GOTO(0x04dc, L04dc);
+    AOT_GOTO(0x047a, L047a);
+L047a:
+    AOT_BLOCK(0x047a, 2);
+    // 047a: mov $21a0, (sp)
+    {
+        src = uint16_t(0x21a0);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 047e: jsr pc, *$0ac8
+    {
+        a = 0x0ac8;
+        r[6] -= 2;
+        WR16(r[6], 0x0482);
+    }
+    AOT_GOTO(0x0ac8, L0ac8);
+L0482:
+    AOT_BLOCK(0x0482, 2);
+    // 0482: mov r0, 2370
+    {
+        src = r[0];
+        b = 0x2370;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0486: br 0490
+    AOT_GOTO(0x0490, L0490);
+L0488:
+    AOT_BLOCK(0x0488, 2);
+    // 0488: mov 2370, r0
+    {
+        a = 0x2370;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 048c: incb 9(r0)
+    {
+        a = uint16_t(r[0] + 9);
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x80;
+    }
+    AOT_GOTO(0x0490, L0490);
+L0490:
+    AOT_BLOCK(0x0490, 3);
+    // 0490: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0492: mov 2370, -(sp)
+    {
+        a = 0x2370;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0496: jsr pc, *$137a
+    {
+        a = 0x137a;
+        r[6] -= 2;
+        WR16(r[6], 0x049a);
+    }
+    AOT_GOTO(0x137a, L137a);
+L049a:
+    AOT_BLOCK(0x049a, 3);
+    // 049a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 049c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 049e: beq 0488
+    if (Z)
+        AOT_GOTO(0x0488, L0488);
+    AOT_GOTO(0x04a0, L04a0);
+L04a0:
+    AOT_BLOCK(0x04a0, 1);
+    // 04a0: br 04ca
+    AOT_GOTO(0x04ca, L04ca);
+L04a2:
+    AOT_BLOCK(0x04a2, 3);
+    // 04a2: mov 2370, r0
+    {
+        a = 0x2370;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04a6: cmpb $7a, 9(r0)
+    {
+        src = uint8_t(0x7a);
+        b = uint16_t(r[0] + 9);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 04ac: bne 04c2
+    if (!Z)
+        AOT_GOTO(0x04c2, L04c2);
+    AOT_GOTO(0x04ae, L04ae);
+L04ae:
+    AOT_BLOCK(0x04ae, 3);
+    // 04ae: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 04b0: mov $21ab, -(sp)
+    {
+        src = uint16_t(0x21ab);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04b4: jsr pc, *$0956
+    {
+        a = 0x0956;
+        r[6] -= 2;
+        WR16(r[6], 0x04b8);
+    }
+    AOT_GOTO(0x0956, L0956);
+L04b8:
+    AOT_BLOCK(0x04b8, 3);
+    // 04b8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 04ba: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04be: jsr pc, *$10d8
+    {
+        a = 0x10d8;
+        r[6] -= 2;
+        WR16(r[6], 0x04c2);
+    }
+    AOT_GOTO(0x10d8, L10d8);
+L04c2:
+    AOT_BLOCK(0x04c2, 2);
+    // 04c2: mov 2370, r0
+    {
+        a = 0x2370;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04c6: incb 9(r0)
+    {
+        a = uint16_t(r[0] + 9);
+        val = int(int8_t(RD8(a))) + 1;
+        WR8(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x80;
+    }
+    AOT_GOTO(0x04ca, L04ca);
+L04ca:
+    AOT_BLOCK(0x04ca, 3);
+    // 04ca: mov $100, (sp)
+    {
+        src = uint16_t(0x0100);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04ce: mov 2370, -(sp)
+    {
+        a = 0x2370;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04d2: jsr pc, *$13b4
+    {
+        a = 0x13b4;
+        r[6] -= 2;
+        WR16(r[6], 0x04d6);
+    }
+    AOT_GOTO(0x13b4, L13b4);
+L04d6:
+    AOT_BLOCK(0x04d6, 3);
+    // 04d6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 04d8: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04da: blt 04a2
+    if (N ^ V)
+        AOT_GOTO(0x04a2, L04a2);
+    AOT_GOTO(0x04dc, L04dc);
+L04dc:
+    AOT_BLOCK(0x04dc, 3);
+    // 04dc: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04e0: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04e4: jsr pc, *$1478
+    {
+        a = 0x1478;
+        r[6] -= 2;
+        WR16(r[6], 0x04e8);
+    }
+    AOT_GOTO(0x1478, L1478);
+L04e8:
+    AOT_BLOCK(0x04e8, 3);
+    // 04e8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 04ea: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04ee: beq 04fe
+    if (Z)
+        AOT_GOTO(0x04fe, L04fe);
+    AOT_GOTO(0x04f0, L04f0);
+L04f0:
+    AOT_BLOCK(0x04f0, 3);
+    // 04f0: mov $8f8, (sp)
+    {
+        src = uint16_t(0x08f8);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04f4: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04f8: jsr pc, *$1478
+    {
+        a = 0x1478;
+        r[6] -= 2;
+        WR16(r[6], 0x04fc);
+    }
+    AOT_GOTO(0x1478, L1478);
+L04fc:
+    AOT_BLOCK(0x04fc, 1);
+    // 04fc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x04fe, L04fe);
+L04fe:
+    AOT_BLOCK(0x04fe, 3);
+    // 04fe: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0502: mov $f, -(sp)
+    {
+        src = uint16_t(0x000f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0506: jsr pc, *$1478
+    {
+        a = 0x1478;
+        r[6] -= 2;
+        WR16(r[6], 0x050a);
+    }
+    AOT_GOTO(0x1478, L1478);
+L050a:
+    AOT_BLOCK(0x050a, 3);
+    // 050a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 050c: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0510: beq 0520
+    if (Z)
+        AOT_GOTO(0x0520, L0520);
+    AOT_GOTO(0x0512, L0512);
+L0512:
+    AOT_BLOCK(0x0512, 3);
+    // 0512: mov $8f8, (sp)
+    {
+        src = uint16_t(0x08f8);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0516: mov $f, -(sp)
+    {
+        src = uint16_t(0x000f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 051a: jsr pc, *$1478
+    {
+        a = 0x1478;
+        r[6] -= 2;
+        WR16(r[6], 0x051e);
+    }
+    AOT_GOTO(0x1478, L1478);
+L051e:
+    AOT_BLOCK(0x051e, 1);
+    // 051e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0520, L0520);
+L0520:
+    AOT_BLOCK(0x0520, 2);
+    // 0520: mov 2370, (sp)
+    {
+        a = 0x2370;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0524: jsr pc, *$0ac8
+    {
+        a = 0x0ac8;
+        r[6] -= 2;
+        WR16(r[6], 0x0528);
+    }
+    AOT_GOTO(0x0ac8, L0ac8);
+L0528:
+    AOT_BLOCK(0x0528, 4);
+    // 0528: mov r0, 2372
+    {
+        src = r[0];
+        b = 0x2372;
+        WR16(b, src);
+    }
+    // 052c: movb $31, 8(r0)
+    {
+        src = uint8_t(0x31);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+    }
+    // 0532: mov 2370, (sp)
+    {
+        a = 0x2370;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0536: jsr pc, *$0ac8
+    {
+        a = 0x0ac8;
+        r[6] -= 2;
+        WR16(r[6], 0x053a);
+    }
+    AOT_GOTO(0x0ac8, L0ac8);
+L053a:
+    AOT_BLOCK(0x053a, 4);
+    // 053a: mov r0, 2374
+    {
+        src = r[0];
+        b = 0x2374;
+        WR16(b, src);
+    }
+    // 053e: movb $32, 8(r0)
+    {
+        src = uint8_t(0x32);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+    }
+    // 0544: mov 2370, (sp)
+    {
+        a = 0x2370;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0548: jsr pc, *$0ac8
+    {
+        a = 0x0ac8;
+        r[6] -= 2;
+        WR16(r[6], 0x054c);
+    }
+    AOT_GOTO(0x0ac8, L0ac8);
+L054c:
+    AOT_BLOCK(0x054c, 4);
+    // 054c: mov r0, 2376
+    {
+        src = r[0];
+        b = 0x2376;
+        WR16(b, src);
+    }
+    // 0550: movb $33, 8(r0)
+    {
+        src = uint8_t(0x33);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+    }
+    // 0556: tst 2996
+    {
+        a = 0x2996;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 055a: beq 056e
+    if (Z)
+        AOT_GOTO(0x056e, L056e);
+    AOT_GOTO(0x055c, L055c);
+L055c:
+    AOT_BLOCK(0x055c, 2);
+    // 055c: mov 2370, (sp)
+    {
+        a = 0x2370;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0560: jsr pc, *$0ac8
+    {
+        a = 0x0ac8;
+        r[6] -= 2;
+        WR16(r[6], 0x0564);
+    }
+    AOT_GOTO(0x0ac8, L0ac8);
+L0564:
+    AOT_BLOCK(0x0564, 2);
+    // 0564: mov r0, 237a
+    {
+        src = r[0];
+        b = 0x237a;
+        WR16(b, src);
+    }
+    // 0568: movb $35, 8(r0)
+    {
+        src = uint8_t(0x35);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x056e, L056e);
+L056e:
+    AOT_BLOCK(0x056e, 2);
+    // 056e: tst 298c
+    {
+        a = 0x298c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0572: bne 0586
+    if (!Z)
+        AOT_GOTO(0x0586, L0586);
+    AOT_GOTO(0x0574, L0574);
+L0574:
+    AOT_BLOCK(0x0574, 2);
+    // 0574: mov 2370, (sp)
+    {
+        a = 0x2370;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0578: jsr pc, *$0ac8
+    {
+        a = 0x0ac8;
+        r[6] -= 2;
+        WR16(r[6], 0x057c);
+    }
+    AOT_GOTO(0x0ac8, L0ac8);
+L057c:
+    AOT_BLOCK(0x057c, 2);
+    // 057c: mov r0, 2378
+    {
+        src = r[0];
+        b = 0x2378;
+        WR16(b, src);
+    }
+    // 0580: movb $34, 8(r0)
+    {
+        src = uint8_t(0x34);
+        b = uint16_t(r[0] + 8);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0586, L0586);
+L0586:
+    AOT_BLOCK(0x0586, 2);
+    // 0586: mov -e(r5), -d8(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        b = uint16_t(r[5] + -216);
+        WR16(b, src);
+    }
+    // 058c: clr -de(r5)
+    {
+        a = uint16_t(r[5] + -222);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0590, L0590);
+L0590:
+    AOT_BLOCK(0x0590, 2);
+    // 0590: cmp -da(r5), -de(r5)
+    {
+        a = uint16_t(r[5] + -218);
+        src = RD16(a);
+        b = uint16_t(r[5] + -222);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0596: bgt 059c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x059c, L059c);
+    AOT_GOTO(0x0598, L0598);
+L0598:
+    AOT_BLOCK(0x0598, 1);
+    // 0598: jmp *$07f2
+    {
+        a = 0x07f2;
+    }
+    AOT_GOTO(0x07f2, L07f2);
+L059c:
+    AOT_BLOCK(0x059c, 2);
+    // 059c: cmp $1, -da(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -218);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05a2: bge 05b8
+    if (!(N ^ V))
+        AOT_GOTO(0x05b8, L05b8);
+    AOT_GOTO(0x05a4, L05a4);
+L05a4:
+    AOT_BLOCK(0x05a4, 5);
+    // 05a4: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 05a8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 05aa: mov 27fc(r0), (sp)
+    {
+        a = uint16_t(r[0] + 10236);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05ae: mov $21c2, -(sp)
+    {
+        src = uint16_t(0x21c2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05b2: jsr pc, *$0ba2
+    {
+        a = 0x0ba2;
+        r[6] -= 2;
+        WR16(r[6], 0x05b6);
+    }
+    AOT_GOTO(0x0ba2, L0ba2);
+L05b6:
+    AOT_BLOCK(0x05b6, 1);
+    // 05b6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x05b8, L05b8);
+L05b8:
+    AOT_BLOCK(0x05b8, 4);
+    // 05b8: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 05bc: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 05be: mov 27fc(r0), (sp)
+    {
+        a = uint16_t(r[0] + 10236);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05c2: jsr pc, *$09ce
+    {
+        a = 0x09ce;
+        r[6] -= 2;
+        WR16(r[6], 0x05c6);
+    }
+    AOT_GOTO(0x09ce, L09ce);
+L05c6:
+    AOT_BLOCK(0x05c6, 2);
+    // 05c6: cmp $73, r0
+    {
+        src = uint16_t(0x0073);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05ca: bne 05dc
+    if (!Z)
+        AOT_GOTO(0x05dc, L05dc);
+    AOT_GOTO(0x05cc, L05cc);
+L05cc:
+    AOT_BLOCK(0x05cc, 4);
+    // 05cc: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 05d0: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 05d2: mov 27fc(r0), -c(r5)
+    {
+        a = uint16_t(r[0] + 10236);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05d8: jmp *$078a
+    {
+        a = 0x078a;
+    }
+    AOT_GOTO(0x078a, L078a);
+L05dc:
+    AOT_BLOCK(0x05dc, 3);
+    // 05dc: mov 2376, -c(r5)
+    {
+        a = 0x2376;
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 05e2: tst 298c
+    {
+        a = 0x298c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05e6: beq 0600
+    if (Z)
+        AOT_GOTO(0x0600, L0600);
+    AOT_GOTO(0x05e8, L05e8);
+L05e8:
+    AOT_BLOCK(0x05e8, 5);
+    // 05e8: mov $69, (sp)
+    {
+        src = uint16_t(0x0069);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05ec: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 05f0: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 05f2: mov 27fc(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 10236);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05f6: jsr pc, *$0a06
+    {
+        a = 0x0a06;
+        r[6] -= 2;
+        WR16(r[6], 0x05fa);
+    }
+    AOT_GOTO(0x0a06, L0a06);
+L05fa:
+    AOT_BLOCK(0x05fa, 2);
+    // 05fa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 05fc: mov r0, 2378
+    {
+        src = r[0];
+        b = 0x2378;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0600, L0600);
+L0600:
+    AOT_BLOCK(0x0600, 7);
+    // 0600: mov 2004, -a(r5)
+    {
+        a = 0x2004;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0606: mov $21c7, 2798
+    {
+        src = uint16_t(0x21c7);
+        b = 0x2798;
+        WR16(b, src);
+    }
+    // 060c: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0610: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0612: mov 27fc(r0), 279a
+    {
+        a = uint16_t(r[0] + 10236);
+        src = RD16(a);
+        b = 0x279a;
+        WR16(b, src);
+    }
+    // 0618: tst 2994
+    {
+        a = 0x2994;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 061c: beq 0624
+    if (Z)
+        AOT_GOTO(0x0624, L0624);
+    AOT_GOTO(0x061e, L061e);
+L061e:
+    AOT_BLOCK(0x061e, 2);
+    // 061e: mov $21cb, r0
+    {
+        src = uint16_t(0x21cb);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0622: br 0628
+    AOT_GOTO(0x0628, L0628);
+L0624:
+    AOT_BLOCK(0x0624, 1);
+    // 0624: mov 2378, r0
+    {
+        a = 0x2378;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0628, L0628);
+L0628:
+    AOT_BLOCK(0x0628, 6);
+    // 0628: mov r0, 279c
+    {
+        src = r[0];
+        b = 0x279c;
+        WR16(b, src);
+    }
+    // 062c: mov $3, -e8(r5)
+    {
+        src = uint16_t(0x0003);
+        b = uint16_t(r[5] + -232);
+        WR16(b, src);
+    }
+    // 0632: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0634: add $ff2a, r0
+    {
+        src = uint16_t(0xff2a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0638: mov r0, -e(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 063c: br 0654
+    AOT_GOTO(0x0654, L0654);
+L063e:
+    AOT_BLOCK(0x063e, 5);
+    // 063e: mov -e8(r5), r0
+    {
+        a = uint16_t(r[5] + -232);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0642: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0644: inc -e8(r5)
+    {
+        a = uint16_t(r[5] + -232);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0648: mov *-e(r5), 2798(r0)
+    {
+        a = RD16(r[5] + -14);
+        src = RD16(a);
+        b = uint16_t(r[0] + 10136);
+        WR16(b, src);
+    }
+    // 064e: add $2, -e(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0654, L0654);
+L0654:
+    AOT_BLOCK(0x0654, 2);
+    // 0654: cmp -d8(r5), -e(r5)
+    {
+        a = uint16_t(r[5] + -216);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 065a: bhi 063e
+    if (!(C | Z))
+        AOT_GOTO(0x063e, L063e);
+    AOT_GOTO(0x065c, L065c);
+L065c:
+    AOT_BLOCK(0x065c, 7);
+    // 065c: mov -e8(r5), r0
+    {
+        a = uint16_t(r[5] + -232);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0660: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0662: inc -e8(r5)
+    {
+        a = uint16_t(r[5] + -232);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0666: clr 2798(r0)
+    {
+        a = uint16_t(r[0] + 10136);
+        WR16(a, 0);
+        C = false;
+    }
+    // 066a: mov $2798, (sp)
+    {
+        src = uint16_t(0x2798);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 066e: mov $2042, -(sp)
+    {
+        src = uint16_t(0x2042);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0672: jsr pc, *$0a30
+    {
+        a = 0x0a30;
+        r[6] -= 2;
+        WR16(r[6], 0x0676);
+    }
+    AOT_GOTO(0x0a30, L0a30);
+L0676:
+    AOT_BLOCK(0x0676, 3);
+    // 0676: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0678: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 067a: beq 0690
+    if (Z)
+        AOT_GOTO(0x0690, L0690);
+    AOT_GOTO(0x067c, L067c);
+L067c:
+    AOT_BLOCK(0x067c, 3);
+    // 067c: inc 2990
+    {
+        a = 0x2990;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0680: inc 2992
+    {
+        a = 0x2992;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0684: br 068a
+    AOT_GOTO(0x068a, L068a);
+L0686:
+    AOT_BLOCK(0x0686, 1);
+    // 0686: inc 2990
+    {
+        a = 0x2990;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x068a, L068a);
+L068a:
+    AOT_BLOCK(0x068a, 2);
+    // 068a: inc -de(r5)
+    {
+        a = uint16_t(r[5] + -222);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 068e: br 0590
+    AOT_GOTO(0x0590, L0590);
+L0690:
+    AOT_BLOCK(0x0690, 5);
+    // 0690: mov 2378, 279a
+    {
+        a = 0x2378;
+        src = RD16(a);
+        b = 0x279a;
+        WR16(b, src);
+    }
+    // 0696: mov -a(r5), 2004
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = 0x2004;
+        WR16(b, src);
+    }
+    // 069c: mov $21cd, 2798
+    {
+        src = uint16_t(0x21cd);
+        b = 0x2798;
+        WR16(b, src);
+    }
+    // 06a2: tst 298c
+    {
+        a = 0x298c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06a6: bne 0686
+    if (!Z)
+        AOT_GOTO(0x0686, L0686);
+    AOT_GOTO(0x06a8, L06a8);
+L06a8:
+    AOT_BLOCK(0x06a8, 4);
+    // 06a8: mov 2372, 279c
+    {
+        a = 0x2372;
+        src = RD16(a);
+        b = 0x279c;
+        WR16(b, src);
+    }
+    // 06ae: mov 2374, 279e
+    {
+        a = 0x2374;
+        src = RD16(a);
+        b = 0x279e;
+        WR16(b, src);
+    }
+    // 06b4: tst 2998
+    {
+        a = 0x2998;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06b8: beq 06c6
+    if (Z)
+        AOT_GOTO(0x06c6, L06c6);
+    AOT_GOTO(0x06ba, L06ba);
+L06ba:
+    AOT_BLOCK(0x06ba, 3);
+    // 06ba: mov $21d0, 27a0
+    {
+        src = uint16_t(0x21d0);
+        b = 0x27a0;
+        WR16(b, src);
+    }
+    // 06c0: clr 27a2
+    {
+        a = 0x27a2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 06c4: br 06ca
+    AOT_GOTO(0x06ca, L06ca);
+L06c6:
+    AOT_BLOCK(0x06c6, 1);
+    // 06c6: clr 27a0
+    {
+        a = 0x27a0;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L06ca:
+    AOT_BLOCK(0x06ca, 3);
+    // 06ca: mov $2798, (sp)
+    {
+        src = uint16_t(0x2798);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06ce: mov $2006, -(sp)
+    {
+        src = uint16_t(0x2006);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06d2: jsr pc, *$0a30
+    {
+        a = 0x0a30;
+        r[6] -= 2;
+        WR16(r[6], 0x06d6);
+    }
+    AOT_GOTO(0x0a30, L0a30);
+L06d6:
+    AOT_BLOCK(0x06d6, 3);
+    // 06d6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 06d8: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06da: bne 067c
+    if (!Z)
+        AOT_GOTO(0x067c, L067c);
+    AOT_GOTO(0x06dc, L06dc);
+L06dc:
+    AOT_BLOCK(0x06dc, 5);
+    // 06dc: mov $21d3, 2798
+    {
+        src = uint16_t(0x21d3);
+        b = 0x2798;
+        WR16(b, src);
+    }
+    // 06e2: mov 2372, 279a
+    {
+        a = 0x2372;
+        src = RD16(a);
+        b = 0x279a;
+        WR16(b, src);
+    }
+    // 06e8: mov 2374, 279c
+    {
+        a = 0x2374;
+        src = RD16(a);
+        b = 0x279c;
+        WR16(b, src);
+    }
+    // 06ee: tst 298e
+    {
+        a = 0x298e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06f2: beq 0710
+    if (Z)
+        AOT_GOTO(0x0710, L0710);
+    AOT_GOTO(0x06f4, L06f4);
+L06f4:
+    AOT_BLOCK(0x06f4, 5);
+    // 06f4: mov $73, (sp)
+    {
+        src = uint16_t(0x0073);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06f8: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 06fc: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 06fe: mov 27fc(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 10236);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0702: jsr pc, *$0a06
+    {
+        a = 0x0a06;
+        r[6] -= 2;
+        WR16(r[6], 0x0706);
+    }
+    AOT_GOTO(0x0a06, L0a06);
+L0706:
+    AOT_BLOCK(0x0706, 3);
+    // 0706: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0708: mov r0, 2376
+    {
+        src = r[0];
+        b = 0x2376;
+        WR16(b, src);
+    }
+    // 070c: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0710, L0710);
+L0710:
+    AOT_BLOCK(0x0710, 3);
+    // 0710: mov 2376, 279e
+    {
+        a = 0x2376;
+        src = RD16(a);
+        b = 0x279e;
+        WR16(b, src);
+    }
+    // 0716: tst 2996
+    {
+        a = 0x2996;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 071a: beq 0722
+    if (Z)
+        AOT_GOTO(0x0722, L0722);
+    AOT_GOTO(0x071c, L071c);
+L071c:
+    AOT_BLOCK(0x071c, 1);
+    // 071c: mov 237a, 279e
+    {
+        a = 0x237a;
+        src = RD16(a);
+        b = 0x279e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0722, L0722);
+L0722:
+    AOT_BLOCK(0x0722, 4);
+    // 0722: clr 27a0
+    {
+        a = 0x27a0;
+        WR16(a, 0);
+        C = false;
+    }
+    // 0726: mov $2798, (sp)
+    {
+        src = uint16_t(0x2798);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 072a: mov $201a, -(sp)
+    {
+        src = uint16_t(0x201a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 072e: jsr pc, *$0a30
+    {
+        a = 0x0a30;
+        r[6] -= 2;
+        WR16(r[6], 0x0732);
+    }
+    AOT_GOTO(0x0a30, L0a30);
+L0732:
+    AOT_BLOCK(0x0732, 3);
+    // 0732: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0734: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0736: bne 067c
+    if (!Z)
+        AOT_GOTO(0x067c, L067c);
+    AOT_GOTO(0x0738, L0738);
+L0738:
+    AOT_BLOCK(0x0738, 2);
+    // 0738: tst 2996
+    {
+        a = 0x2996;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 073c: beq 0784
+    if (Z)
+        AOT_GOTO(0x0784, L0784);
+    AOT_GOTO(0x073e, L073e);
+L073e:
+    AOT_BLOCK(0x073e, 7);
+    // 073e: mov $21d6, 2798
+    {
+        src = uint16_t(0x21d6);
+        b = 0x2798;
+        WR16(b, src);
+    }
+    // 0744: mov 237a, 279a
+    {
+        a = 0x237a;
+        src = RD16(a);
+        b = 0x279a;
+        WR16(b, src);
+    }
+    // 074a: mov 2376, 279c
+    {
+        a = 0x2376;
+        src = RD16(a);
+        b = 0x279c;
+        WR16(b, src);
+    }
+    // 0750: clr 279e
+    {
+        a = 0x279e;
+        WR16(a, 0);
+        C = false;
+    }
+    // 0754: mov $2798, (sp)
+    {
+        src = uint16_t(0x2798);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0758: mov $202e, -(sp)
+    {
+        src = uint16_t(0x202e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 075c: jsr pc, *$0a30
+    {
+        a = 0x0a30;
+        r[6] -= 2;
+        WR16(r[6], 0x0760);
+    }
+    AOT_GOTO(0x0a30, L0a30);
+L0760:
+    AOT_BLOCK(0x0760, 3);
+    // 0760: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0762: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0764: beq 077c
+    if (Z)
+        AOT_GOTO(0x077c, L077c);
+    AOT_GOTO(0x0766, L0766);
+L0766:
+    AOT_BLOCK(0x0766, 2);
+    // 0766: mov 2376, (sp)
+    {
+        a = 0x2376;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 076a: jsr pc, *$153e
+    {
+        a = 0x153e;
+        r[6] -= 2;
+        WR16(r[6], 0x076e);
+    }
+    AOT_GOTO(0x153e, L153e);
+L076e:
+    AOT_BLOCK(0x076e, 4);
+    // 076e: mov 237a, r0
+    {
+        a = 0x237a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0772: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0776: mov r0, 2376
+    {
+        src = r[0];
+        b = 0x2376;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 077a: br 0784
+    AOT_GOTO(0x0784, L0784);
+L077c:
+    AOT_BLOCK(0x077c, 2);
+    // 077c: mov 237a, (sp)
+    {
+        a = 0x237a;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0780: jsr pc, *$153e
+    {
+        a = 0x153e;
+        r[6] -= 2;
+        WR16(r[6], 0x0784);
+    }
+    AOT_GOTO(0x153e, L153e);
+L0784:
+    AOT_BLOCK(0x0784, 2);
+    // 0784: tst 298e
+    {
+        a = 0x298e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0788: bne 068a
+    if (!Z)
+        AOT_GOTO(0x068a, L068a);
+    AOT_GOTO(0x078a, L078a);
+L078a:
+    AOT_BLOCK(0x078a, 8);
+    // 078a: mov $21d9, 2798
+    {
+        src = uint16_t(0x21d9);
+        b = 0x2798;
+        WR16(b, src);
+    }
+    // 0790: mov $21dc, 279a
+    {
+        src = uint16_t(0x21dc);
+        b = 0x279a;
+        WR16(b, src);
+    }
+    // 0796: mov $21df, 279c
+    {
+        src = uint16_t(0x21df);
+        b = 0x279c;
+        WR16(b, src);
+    }
+    // 079c: mov $6f, (sp)
+    {
+        src = uint16_t(0x006f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07a0: mov -de(r5), r0
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 07a4: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 07a6: mov 27fc(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 10236);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07aa: jsr pc, *$0a06
+    {
+        a = 0x0a06;
+        r[6] -= 2;
+        WR16(r[6], 0x07ae);
+    }
+    AOT_GOTO(0x0a06, L0a06);
+L07ae:
+    AOT_BLOCK(0x07ae, 6);
+    // 07ae: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 07b0: mov r0, 279e
+    {
+        src = r[0];
+        b = 0x279e;
+        WR16(b, src);
+    }
+    // 07b4: mov -c(r5), 27a0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = 0x27a0;
+        WR16(b, src);
+    }
+    // 07ba: clr 27a2
+    {
+        a = 0x27a2;
+        WR16(a, 0);
+        C = false;
+    }
+    // 07be: mov 2372, (sp)
+    {
+        a = 0x2372;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07c2: jsr pc, *$0b5c
+    {
+        a = 0x0b5c;
+        r[6] -= 2;
+        WR16(r[6], 0x07c6);
+    }
+    AOT_GOTO(0x0b5c, L0b5c);
+L07c6:
+    AOT_BLOCK(0x07c6, 2);
+    // 07c6: mov 2374, (sp)
+    {
+        a = 0x2374;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07ca: jsr pc, *$0b5c
+    {
+        a = 0x0b5c;
+        r[6] -= 2;
+        WR16(r[6], 0x07ce);
+    }
+    AOT_GOTO(0x0b5c, L0b5c);
+L07ce:
+    AOT_BLOCK(0x07ce, 2);
+    // 07ce: mov 2378, (sp)
+    {
+        a = 0x2378;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07d2: jsr pc, *$0b5c
+    {
+        a = 0x0b5c;
+        r[6] -= 2;
+        WR16(r[6], 0x07d6);
+    }
+    AOT_GOTO(0x0b5c, L0b5c);
+L07d6:
+    AOT_BLOCK(0x07d6, 3);
+    // 07d6: mov $2798, (sp)
+    {
+        src = uint16_t(0x2798);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07da: mov $21e2, -(sp)
+    {
+        src = uint16_t(0x21e2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07de: jsr pc, *$0a30
+    {
+        a = 0x0a30;
+        r[6] -= 2;
+        WR16(r[6], 0x07e2);
+    }
+    AOT_GOTO(0x0a30, L0a30);
+L07e2:
+    AOT_BLOCK(0x07e2, 3);
+    // 07e2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 07e4: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07e8: blt 07ee
+    if (N ^ V)
+        AOT_GOTO(0x07ee, L07ee);
+    AOT_GOTO(0x07ea, L07ea);
+L07ea:
+    AOT_BLOCK(0x07ea, 1);
+    // 07ea: jmp *$068a
+    {
+        a = 0x068a;
+    }
+    AOT_GOTO(0x068a, L068a);
+L07ee:
+    AOT_BLOCK(0x07ee, 1);
+    // 07ee: jmp *$067c
+    {
+        a = 0x067c;
+    }
+    AOT_GOTO(0x067c, L067c);
+L07f2:
+    AOT_BLOCK(0x07f2, 2);
+    // 07f2: tst 2990
+    {
+        a = 0x2990;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07f6: beq 07fc
+    if (Z)
+        AOT_GOTO(0x07fc, L07fc);
+    AOT_GOTO(0x07f8, L07f8);
+L07f8:
+    AOT_BLOCK(0x07f8, 1);
+    // 07f8: jmp *$08f0
+    {
+        a = 0x08f0;
+    }
+    AOT_GOTO(0x08f0, L08f0);
+L07fc:
+    AOT_BLOCK(0x07fc, 2);
+    // 07fc: tst -dc(r5)
+    {
+        a = uint16_t(r[5] + -220);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0800: bne 0806
+    if (!Z)
+        AOT_GOTO(0x0806, L0806);
+    AOT_GOTO(0x0802, L0802);
+L0802:
+    AOT_BLOCK(0x0802, 1);
+    // 0802: jmp *$08f0
+    {
+        a = 0x08f0;
+    }
+    AOT_GOTO(0x08f0, L08f0);
+L0806:
+    AOT_BLOCK(0x0806, 7);
+    // 0806: clr -de(r5)
+    {
+        a = uint16_t(r[5] + -222);
+        WR16(a, 0);
+    }
+    // 080a: mov $21ea, 2798
+    {
+        src = uint16_t(0x21ea);
+        b = 0x2798;
+        WR16(b, src);
+    }
+    // 0810: mov $21ed, 279a
+    {
+        src = uint16_t(0x21ed);
+        b = 0x279a;
+        WR16(b, src);
+    }
+    // 0816: mov 2056, 279c
+    {
+        a = 0x2056;
+        src = RD16(a);
+        b = 0x279c;
+        WR16(b, src);
+    }
+    // 081c: mov $3, -e0(r5)
+    {
+        src = uint16_t(0x0003);
+        b = uint16_t(r[5] + -224);
+        WR16(b, src);
+    }
+    // 0822: tst 299a
+    {
+        a = 0x299a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0826: beq 0834
+    if (Z)
+        AOT_GOTO(0x0834, L0834);
+    AOT_GOTO(0x0828, L0828);
+L0828:
+    AOT_BLOCK(0x0828, 2);
+    // 0828: mov $4, -e0(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -224);
+        WR16(b, src);
+    }
+    // 082e: mov $21f0, 279e
+    {
+        src = uint16_t(0x21f0);
+        b = 0x279e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0834, L0834);
+L0834:
+    AOT_BLOCK(0x0834, 2);
+    // 0834: tst 237c
+    {
+        a = 0x237c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0838: beq 0876
+    if (Z)
+        AOT_GOTO(0x0876, L0876);
+    AOT_GOTO(0x083a, L083a);
+L083a:
+    AOT_BLOCK(0x083a, 9);
+    // 083a: mov -e0(r5), r0
+    {
+        a = uint16_t(r[5] + -224);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 083e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0840: inc -e0(r5)
+    {
+        a = uint16_t(r[5] + -224);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0844: mov $21f8, 2798(r0)
+    {
+        src = uint16_t(0x21f8);
+        b = uint16_t(r[0] + 10136);
+        WR16(b, src);
+    }
+    // 084a: mov -e0(r5), r0
+    {
+        a = uint16_t(r[5] + -224);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 084e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0850: inc -e0(r5)
+    {
+        a = uint16_t(r[5] + -224);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0854: mov 237c, 2798(r0)
+    {
+        a = 0x237c;
+        src = RD16(a);
+        b = uint16_t(r[0] + 10136);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 085a: br 0876
+    AOT_GOTO(0x0876, L0876);
+L085c:
+    AOT_BLOCK(0x085c, 7);
+    // 085c: mov -e0(r5), r0
+    {
+        a = uint16_t(r[5] + -224);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0860: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0862: inc -e0(r5)
+    {
+        a = uint16_t(r[5] + -224);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0866: mov -de(r5), r1
+    {
+        a = uint16_t(r[5] + -222);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 086a: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 086c: inc -de(r5)
+    {
+        a = uint16_t(r[5] + -222);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0870: mov 28c4(r1), 2798(r0)
+    {
+        a = uint16_t(r[1] + 10436);
+        src = RD16(a);
+        b = uint16_t(r[0] + 10136);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0876, L0876);
+L0876:
+    AOT_BLOCK(0x0876, 2);
+    // 0876: cmp -dc(r5), -de(r5)
+    {
+        a = uint16_t(r[5] + -220);
+        src = RD16(a);
+        b = uint16_t(r[5] + -222);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 087c: bgt 085c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x085c, L085c);
+    AOT_GOTO(0x087e, L087e);
+L087e:
+    AOT_BLOCK(0x087e, 2);
+    // 087e: tst -e4(r5)
+    {
+        a = uint16_t(r[5] + -228);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0882: beq 0896
+    if (Z)
+        AOT_GOTO(0x0896, L0896);
+    AOT_GOTO(0x0884, L0884);
+L0884:
+    AOT_BLOCK(0x0884, 5);
+    // 0884: mov -e0(r5), r0
+    {
+        a = uint16_t(r[5] + -224);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0888: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 088a: inc -e0(r5)
+    {
+        a = uint16_t(r[5] + -224);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 088e: mov $21fb, 2798(r0)
+    {
+        src = uint16_t(0x21fb);
+        b = uint16_t(r[0] + 10136);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0894: br 08a6
+    AOT_GOTO(0x08a6, L08a6);
+L0896:
+    AOT_BLOCK(0x0896, 4);
+    // 0896: mov -e0(r5), r0
+    {
+        a = uint16_t(r[5] + -224);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 089a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 089c: inc -e0(r5)
+    {
+        a = uint16_t(r[5] + -224);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 08a0: mov $21ff, 2798(r0)
+    {
+        src = uint16_t(0x21ff);
+        b = uint16_t(r[0] + 10136);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x08a6, L08a6);
+L08a6:
+    AOT_BLOCK(0x08a6, 7);
+    // 08a6: mov -e0(r5), r0
+    {
+        a = uint16_t(r[5] + -224);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 08aa: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 08ac: inc -e0(r5)
+    {
+        a = uint16_t(r[5] + -224);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 08b0: clr 2798(r0)
+    {
+        a = uint16_t(r[0] + 10136);
+        WR16(a, 0);
+        C = false;
+    }
+    // 08b4: mov $2798, (sp)
+    {
+        src = uint16_t(0x2798);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08b8: mov $2203, -(sp)
+    {
+        src = uint16_t(0x2203);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08bc: jsr pc, *$0a30
+    {
+        a = 0x0a30;
+        r[6] -= 2;
+        WR16(r[6], 0x08c0);
+    }
+    AOT_GOTO(0x0a30, L0a30);
+L08c0:
+    AOT_BLOCK(0x08c0, 4);
+    // 08c0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 08c2: bis r0, 2992
+    {
+        src = r[0];
+        b = 0x2992;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 08c6: cmp $1, -da(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -218);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08cc: bne 08f0
+    if (!Z)
+        AOT_GOTO(0x08f0, L08f0);
+    AOT_GOTO(0x08ce, L08ce);
+L08ce:
+    AOT_BLOCK(0x08ce, 2);
+    // 08ce: cmp $1, -e6(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -230);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08d4: bne 08f0
+    if (!Z)
+        AOT_GOTO(0x08f0, L08f0);
+    AOT_GOTO(0x08d6, L08d6);
+L08d6:
+    AOT_BLOCK(0x08d6, 2);
+    // 08d6: tst 2992
+    {
+        a = 0x2992;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08da: bne 08f0
+    if (!Z)
+        AOT_GOTO(0x08f0, L08f0);
+    AOT_GOTO(0x08dc, L08dc);
+L08dc:
+    AOT_BLOCK(0x08dc, 3);
+    // 08dc: mov $6f, (sp)
+    {
+        src = uint16_t(0x006f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08e0: mov 27fc, -(sp)
+    {
+        a = 0x27fc;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08e4: jsr pc, *$0a06
+    {
+        a = 0x0a06;
+        r[6] -= 2;
+        WR16(r[6], 0x08e8);
+    }
+    AOT_GOTO(0x0a06, L0a06);
+L08e8:
+    AOT_BLOCK(0x08e8, 3);
+    // 08e8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 08ea: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08ec: jsr pc, *$0b5c
+    {
+        a = 0x0b5c;
+        r[6] -= 2;
+        WR16(r[6], 0x08f0);
+    }
+    AOT_GOTO(0x0b5c, L0b5c);
+L08f0:
+    AOT_BLOCK(0x08f0, 1);
+    // 08f0: jsr pc, 090a
+    {
+        a = 0x090a;
+        r[6] -= 2;
+        WR16(r[6], 0x08f4);
+    }
+    AOT_GOTO(0x090a, L090a);
+L08f4:
+    AOT_BLOCK(0x08f4, 2);
+    // 08f4: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L090a:
+    AOT_BLOCK(0x090a, 4);
+    // 090a: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x090e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 090e: tst 298c
+    {
+        a = 0x298c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0912: bne 094a
+    if (!Z)
+        AOT_GOTO(0x094a, L094a);
+    AOT_GOTO(0x0914, L0914);
+L0914:
+    AOT_BLOCK(0x0914, 2);
+    // 0914: mov 2372, (sp)
+    {
+        a = 0x2372;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0918: jsr pc, *$0b5c
+    {
+        a = 0x0b5c;
+        r[6] -= 2;
+        WR16(r[6], 0x091c);
+    }
+    AOT_GOTO(0x0b5c, L0b5c);
+L091c:
+    AOT_BLOCK(0x091c, 2);
+    // 091c: mov 2374, (sp)
+    {
+        a = 0x2374;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0920: jsr pc, *$0b5c
+    {
+        a = 0x0b5c;
+        r[6] -= 2;
+        WR16(r[6], 0x0924);
+    }
+    AOT_GOTO(0x0b5c, L0b5c);
+L0924:
+    AOT_BLOCK(0x0924, 2);
+    // 0924: tst 298e
+    {
+        a = 0x298e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0928: bne 0932
+    if (!Z)
+        AOT_GOTO(0x0932, L0932);
+    AOT_GOTO(0x092a, L092a);
+L092a:
+    AOT_BLOCK(0x092a, 2);
+    // 092a: mov 2376, (sp)
+    {
+        a = 0x2376;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 092e: jsr pc, *$0b5c
+    {
+        a = 0x0b5c;
+        r[6] -= 2;
+        WR16(r[6], 0x0932);
+    }
+    AOT_GOTO(0x0b5c, L0b5c);
+L0932:
+    AOT_BLOCK(0x0932, 2);
+    // 0932: mov 2378, (sp)
+    {
+        a = 0x2378;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0936: jsr pc, *$0b5c
+    {
+        a = 0x0b5c;
+        r[6] -= 2;
+        WR16(r[6], 0x093a);
+    }
+    AOT_GOTO(0x0b5c, L0b5c);
+L093a:
+    AOT_BLOCK(0x093a, 2);
+    // 093a: mov 237a, (sp)
+    {
+        a = 0x237a;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 093e: jsr pc, *$0b5c
+    {
+        a = 0x0b5c;
+        r[6] -= 2;
+        WR16(r[6], 0x0942);
+    }
+    AOT_GOTO(0x0b5c, L0b5c);
+L0942:
+    AOT_BLOCK(0x0942, 2);
+    // 0942: mov 2370, (sp)
+    {
+        a = 0x2370;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0946: jsr pc, *$0b5c
+    {
+        a = 0x0b5c;
+        r[6] -= 2;
+        WR16(r[6], 0x094a);
+    }
+    AOT_GOTO(0x0b5c, L0b5c);
+L094a:
+    AOT_BLOCK(0x094a, 2);
+    // 094a: mov 2992, (sp)
+    {
+        a = 0x2992;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 094e: jsr pc, *$10d8
+    {
+        a = 0x10d8;
+        r[6] -= 2;
+        WR16(r[6], 0x0952);
+    }
+    AOT_GOTO(0x10d8, L10d8);
+L0952:
+    AOT_BLOCK(0x0952, 2);
+    // 0952: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0956:
+    AOT_BLOCK(0x0956, 6);
+    // 0956: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x095a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 095a: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 095e: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0962: tst 2994
+    {
+        a = 0x2994;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0966: beq 096e
+    if (Z)
+        AOT_GOTO(0x096e, L096e);
+    AOT_GOTO(0x0968, L0968);
+L0968:
+    AOT_BLOCK(0x0968, 2);
+    // 0968: mov $22ac, -(sp)
+    {
+        src = uint16_t(0x22ac);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 096c: br 0972
+    AOT_GOTO(0x0972, L0972);
+L096e:
+    AOT_BLOCK(0x096e, 1);
+    // 096e: mov $22a4, -(sp)
+    {
+        src = uint16_t(0x22a4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0972, L0972);
+L0972:
+    AOT_BLOCK(0x0972, 1);
+    // 0972: jsr pc, *$0b72
+    {
+        a = 0x0b72;
+        r[6] -= 2;
+        WR16(r[6], 0x0976);
+    }
+    AOT_GOTO(0x0b72, L0b72);
+L0976:
+    AOT_BLOCK(0x0976, 3);
+    // 0976: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0978: tst 2994
+    {
+        a = 0x2994;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 097c: beq 0984
+    if (Z)
+        AOT_GOTO(0x0984, L0984);
+    AOT_GOTO(0x097e, L097e);
+L097e:
+    AOT_BLOCK(0x097e, 2);
+    // 097e: mov $22ac, r0
+    {
+        src = uint16_t(0x22ac);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0982: br 0988
+    AOT_GOTO(0x0988, L0988);
+L0984:
+    AOT_BLOCK(0x0984, 1);
+    // 0984: mov $22a4, r0
+    {
+        src = uint16_t(0x22a4);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0988, L0988);
+L0988:
+    AOT_BLOCK(0x0988, 2);
+    // 0988: dec 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 098c: blt 09a8
+    if (N ^ V)
+        AOT_GOTO(0x09a8, L09a8);
+    AOT_GOTO(0x098e, L098e);
+L098e:
+    AOT_BLOCK(0x098e, 2);
+    // 098e: tst 2994
+    {
+        a = 0x2994;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0992: beq 099a
+    if (Z)
+        AOT_GOTO(0x099a, L099a);
+    AOT_GOTO(0x0994, L0994);
+L0994:
+    AOT_BLOCK(0x0994, 2);
+    // 0994: mov $22ac, r1
+    {
+        src = uint16_t(0x22ac);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0998: br 099e
+    AOT_GOTO(0x099e, L099e);
+L099a:
+    AOT_BLOCK(0x099a, 1);
+    // 099a: mov $22a4, r1
+    {
+        src = uint16_t(0x22a4);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x099e, L099e);
+L099e:
+    AOT_BLOCK(0x099e, 4);
+    // 099e: mov (r1), r0
+    {
+        a = r[1];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 09a0: inc (r1)
+    {
+        a = r[1];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09a2: movb $a, (r0)
+    {
+        src = uint8_t(0x0a);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 09a6: br 09c2
+    AOT_GOTO(0x09c2, L09c2);
+L09a8:
+    AOT_BLOCK(0x09a8, 2);
+    // 09a8: tst 2994
+    {
+        a = 0x2994;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09ac: beq 09b4
+    if (Z)
+        AOT_GOTO(0x09b4, L09b4);
+    AOT_GOTO(0x09ae, L09ae);
+L09ae:
+    AOT_BLOCK(0x09ae, 2);
+    // 09ae: mov $22ac, (sp)
+    {
+        src = uint16_t(0x22ac);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09b2: br 09b8
+    AOT_GOTO(0x09b8, L09b8);
+L09b4:
+    AOT_BLOCK(0x09b4, 1);
+    // 09b4: mov $22a4, (sp)
+    {
+        src = uint16_t(0x22a4);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x09b8, L09b8);
+L09b8:
+    AOT_BLOCK(0x09b8, 2);
+    // 09b8: mov $a, -(sp)
+    {
+        src = uint16_t(0x000a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09bc: jsr pc, *$0f24
+    {
+        a = 0x0f24;
+        r[6] -= 2;
+        WR16(r[6], 0x09c0);
+    }
+    AOT_GOTO(0x0f24, L0f24);
+L09c0:
+    AOT_BLOCK(0x09c0, 1);
+    // 09c0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x09c2, L09c2);
+L09c2:
+    AOT_BLOCK(0x09c2, 4);
+    // 09c2: inc 2990
+    {
+        a = 0x2990;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09c6: inc 2992
+    {
+        a = 0x2992;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09ca: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L09ce:
+    AOT_BLOCK(0x09ce, 3);
+    // 09ce: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x09d2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 09d2: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x09d6, L09d6);
+L09d6:
+    AOT_BLOCK(0x09d6, 2);
+    // 09d6: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 09d8: br 09e2
+    AOT_GOTO(0x09e2, L09e2);
+L09da:
+    AOT_BLOCK(0x09da, 2);
+    // 09da: cmp $2f, r2
+    {
+        src = uint16_t(0x002f);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09de: beq 09d6
+    if (Z)
+        AOT_GOTO(0x09d6, L09d6);
+    AOT_GOTO(0x09e0, L09e0);
+L09e0:
+    AOT_BLOCK(0x09e0, 1);
+    // 09e0: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x09e2, L09e2);
+L09e2:
+    AOT_BLOCK(0x09e2, 2);
+    // 09e2: movb (r3)+, r2
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 09e4: bne 09da
+    if (!Z)
+        AOT_GOTO(0x09da, L09da);
+    AOT_GOTO(0x09e6, L09e6);
+L09e6:
+    AOT_BLOCK(0x09e6, 3);
+    // 09e6: sub $3, r3
+    {
+        src = uint16_t(0x0003);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 09ea: cmp $e, r4
+    {
+        src = uint16_t(0x000e);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09ee: blt 0a02
+    if (N ^ V)
+        AOT_GOTO(0x0a02, L0a02);
+    AOT_GOTO(0x09f0, L09f0);
+L09f0:
+    AOT_BLOCK(0x09f0, 2);
+    // 09f0: cmp $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09f4: bge 0a02
+    if (!(N ^ V))
+        AOT_GOTO(0x0a02, L0a02);
+    AOT_GOTO(0x09f6, L09f6);
+L09f6:
+    AOT_BLOCK(0x09f6, 2);
+    // 09f6: cmpb $2e, (r3)+
+    {
+        src = uint8_t(0x2e);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 09fa: bne 0a02
+    if (!Z)
+        AOT_GOTO(0x0a02, L0a02);
+    AOT_GOTO(0x09fc, L09fc);
+L09fc:
+    AOT_BLOCK(0x09fc, 1);
+    // 09fc: movb (r3), r0
+    {
+        a = r[3];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x09fe, L09fe);
+L09fe:
+    AOT_BLOCK(0x09fe, 2);
+    // 09fe: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a02:
+    AOT_BLOCK(0x0a02, 2);
+    // 0a02: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0a04: br 09fe
+    AOT_GOTO(0x09fe, L09fe);
+L0a06:
+    AOT_BLOCK(0x0a06, 4);
+    // 0a06: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a0a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 0a0a: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a0e: jsr pc, *$0ac8
+    {
+        a = 0x0ac8;
+        r[6] -= 2;
+        WR16(r[6], 0x0a12);
+    }
+    AOT_GOTO(0x0ac8, L0ac8);
+L0a12:
+    AOT_BLOCK(0x0a12, 3);
+    // 0a12: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0a14: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a16: br 0a20
+    AOT_GOTO(0x0a20, L0a20);
+L0a18:
+    AOT_BLOCK(0x0a18, 2);
+    // 0a18: cmpb $2f, (r4)+
+    {
+        src = uint8_t(0x2f);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a1c: bne 0a20
+    if (!Z)
+        AOT_GOTO(0x0a20, L0a20);
+    AOT_GOTO(0x0a1e, L0a1e);
+L0a1e:
+    AOT_BLOCK(0x0a1e, 1);
+    // 0a1e: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a20, L0a20);
+L0a20:
+    AOT_BLOCK(0x0a20, 2);
+    // 0a20: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a22: bne 0a18
+    if (!Z)
+        AOT_GOTO(0x0a18, L0a18);
+    AOT_GOTO(0x0a24, L0a24);
+L0a24:
+    AOT_BLOCK(0x0a24, 4);
+    // 0a24: movb 6(r5), -1(r4)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD8(a);
+        b = uint16_t(r[4] + -1);
+        WR8(b, src);
+    }
+    // 0a2a: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 0a2c: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a30:
+    AOT_BLOCK(0x0a30, 4);
+    // 0a30: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a34;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 0a34: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 0a38: jsr pc, 13f0
+    {
+        a = 0x13f0;
+        r[6] -= 2;
+        WR16(r[6], 0x0a3c);
+    }
+    AOT_GOTO(0x13f0, L13f0);
+L0a3c:
+    AOT_BLOCK(0x0a3c, 2);
+    // 0a3c: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a40: bne 0ab0
+    if (!Z)
+        AOT_GOTO(0x0ab0, L0ab0);
+    AOT_GOTO(0x0a42, L0a42);
+L0a42:
+    AOT_BLOCK(0x0a42, 3);
+    // 0a42: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a46: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a4a: jsr pc, *$13d2
+    {
+        a = 0x13d2;
+        r[6] -= 2;
+        WR16(r[6], 0x0a4e);
+    }
+    AOT_GOTO(0x13d2, L13d2);
+L0a4e:
+    AOT_BLOCK(0x0a4e, 4);
+    // 0a4e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0a50: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a54: mov $220b, -(sp)
+    {
+        src = uint16_t(0x220b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a58: jsr pc, *$0ba2
+    {
+        a = 0x0ba2;
+        r[6] -= 2;
+        WR16(r[6], 0x0a5c);
+    }
+    AOT_GOTO(0x0ba2, L0ba2);
+L0a5c:
+    AOT_BLOCK(0x0a5c, 3);
+    // 0a5c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0a5e: mov $64, (sp)
+    {
+        src = uint16_t(0x0064);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a62: jsr pc, *$10d8
+    {
+        a = 0x10d8;
+        r[6] -= 2;
+        WR16(r[6], 0x0a66);
+    }
+    AOT_GOTO(0x10d8, L10d8);
+L0a66:
+    AOT_BLOCK(0x0a66, 3);
+    // 0a66: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a68: add $fff6, (sp)
+    {
+        src = uint16_t(0xfff6);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0a6c: jsr pc, *$1558
+    {
+        a = 0x1558;
+        r[6] -= 2;
+        WR16(r[6], 0x0a70);
+    }
+    AOT_GOTO(0x1558, L1558);
+L0a70:
+    AOT_BLOCK(0x0a70, 2);
+    // 0a70: cmp -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a74: bne 0a66
+    if (!Z)
+        AOT_GOTO(0x0a66, L0a66);
+    AOT_GOTO(0x0a76, L0a76);
+L0a76:
+    AOT_BLOCK(0x0a76, 4);
+    // 0a76: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0a7a: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0a7e: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a82: beq 0aa2
+    if (Z)
+        AOT_GOTO(0x0aa2, L0aa2);
+    AOT_GOTO(0x0a84, L0a84);
+L0a84:
+    AOT_BLOCK(0x0a84, 2);
+    // 0a84: cmp $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a88: beq 0a9e
+    if (Z)
+        AOT_GOTO(0x0a9e, L0a9e);
+    AOT_GOTO(0x0a8a, L0a8a);
+L0a8a:
+    AOT_BLOCK(0x0a8a, 3);
+    // 0a8a: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a8e: mov $2225, -(sp)
+    {
+        src = uint16_t(0x2225);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a92: jsr pc, *$0ba2
+    {
+        a = 0x0ba2;
+        r[6] -= 2;
+        WR16(r[6], 0x0a96);
+    }
+    AOT_GOTO(0x0ba2, L0ba2);
+L0a96:
+    AOT_BLOCK(0x0a96, 2);
+    // 0a96: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0a98: mov $8, 2992
+    {
+        src = uint16_t(0x0008);
+        b = 0x2992;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a9e, L0a9e);
+L0a9e:
+    AOT_BLOCK(0x0a9e, 1);
+    // 0a9e: jsr pc, 090a
+    {
+        a = 0x090a;
+        r[6] -= 2;
+        WR16(r[6], 0x0aa2);
+    }
+    AOT_GOTO(0x090a, L090a);
+L0aa2:
+    AOT_BLOCK(0x0aa2, 4);
+    // 0aa2: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0aa6: ash $fff8, r0
+    {
+        src = uint16_t(0xfff8) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0aaa: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0aae: br 0ac4
+    AOT_GOTO(0x0ac4, L0ac4);
+L0ab0:
+    AOT_BLOCK(0x0ab0, 2);
+    // 0ab0: cmp $ffff, -8(r5)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ab6: bne 0a66
+    if (!Z)
+        AOT_GOTO(0x0a66, L0a66);
+    AOT_GOTO(0x0ab8, L0ab8);
+L0ab8:
+    AOT_BLOCK(0x0ab8, 2);
+    // 0ab8: mov $221a, (sp)
+    {
+        src = uint16_t(0x221a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0abc: jsr pc, *$0ba2
+    {
+        a = 0x0ba2;
+        r[6] -= 2;
+        WR16(r[6], 0x0ac0);
+    }
+    AOT_GOTO(0x0ba2, L0ba2);
+L0ac0:
+    AOT_BLOCK(0x0ac0, 1);
+    // 0ac0: mov $64, r0
+    {
+        src = uint16_t(0x0064);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ac4, L0ac4);
+L0ac4:
+    AOT_BLOCK(0x0ac4, 2);
+    // 0ac4: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ac8:
+    AOT_BLOCK(0x0ac8, 4);
+    // 0ac8: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0acc;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 0acc: mov 2004, r4
+    {
+        a = 0x2004;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0ad0: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ad4, L0ad4);
+L0ad4:
+    AOT_BLOCK(0x0ad4, 4);
+    // 0ad4: mov 2004, r0
+    {
+        a = 0x2004;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0ad8: inc 2004
+    {
+        a = 0x2004;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0adc: movb (r3)+, (r0)
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0ade: bne 0ad4
+    if (!Z)
+        AOT_GOTO(0x0ad4, L0ad4);
+    AOT_GOTO(0x0ae0, L0ae0);
+L0ae0:
+    AOT_BLOCK(0x0ae0, 4);
+    // 0ae0: mov 2002, r0
+    {
+        a = 0x2002;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0ae4: add $3e8, r0
+    {
+        src = uint16_t(0x03e8);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0ae8: cmp 2004, r0
+    {
+        a = 0x2004;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0aec: blos 0b10
+    if (C | Z)
+        AOT_GOTO(0x0b10, L0b10);
+    AOT_GOTO(0x0aee, L0aee);
+L0aee:
+    AOT_BLOCK(0x0aee, 2);
+    // 0aee: mov $41a, (sp)
+    {
+        src = uint16_t(0x041a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0af2: jsr pc, *$10e6
+    {
+        a = 0x10e6;
+        r[6] -= 2;
+        WR16(r[6], 0x0af6);
+    }
+    AOT_GOTO(0x10e6, L10e6);
+L0af6:
+    AOT_BLOCK(0x0af6, 3);
+    // 0af6: mov r0, 2002
+    {
+        src = r[0];
+        b = 0x2002;
+        WR16(b, src);
+    }
+    // 0afa: mov r0, 2004
+    {
+        src = r[0];
+        b = 0x2004;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0afe: bne 0b10
+    if (!Z)
+        AOT_GOTO(0x0b10, L0b10);
+    AOT_GOTO(0x0b00, L0b00);
+L0b00:
+    AOT_BLOCK(0x0b00, 3);
+    // 0b00: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0b02: mov $2238, -(sp)
+    {
+        src = uint16_t(0x2238);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b06: jsr pc, *$0956
+    {
+        a = 0x0956;
+        r[6] -= 2;
+        WR16(r[6], 0x0b0a);
+    }
+    AOT_GOTO(0x0956, L0956);
+L0b0a:
+    AOT_BLOCK(0x0b0a, 2);
+    // 0b0a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b0c: jsr pc, 090a
+    {
+        a = 0x090a;
+        r[6] -= 2;
+        WR16(r[6], 0x0b10);
+    }
+    AOT_GOTO(0x090a, L090a);
+L0b10:
+    AOT_BLOCK(0x0b10, 3);
+    // 0b10: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0b12: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b16:
+    AOT_BLOCK(0x0b16, 5);
+    // 0b16: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b1a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 0b1a: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0b1e: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b20: jsr pc, *$09ce
+    {
+        a = 0x09ce;
+        r[6] -= 2;
+        WR16(r[6], 0x0b24);
+    }
+    AOT_GOTO(0x09ce, L09ce);
+L0b24:
+    AOT_BLOCK(0x0b24, 2);
+    // 0b24: cmp $6f, r0
+    {
+        src = uint16_t(0x006f);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b28: beq 0b3a
+    if (Z)
+        AOT_GOTO(0x0b3a, L0b3a);
+    AOT_GOTO(0x0b2a, L0b2a);
+L0b2a:
+    AOT_BLOCK(0x0b2a, 2);
+    // 0b2a: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b2e: br 0b36
+    AOT_GOTO(0x0b36, L0b36);
+L0b30:
+    AOT_BLOCK(0x0b30, 2);
+    // 0b30: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b32: bne 0b56
+    if (!Z)
+        AOT_GOTO(0x0b56, L0b56);
+    AOT_GOTO(0x0b34, L0b34);
+L0b34:
+    AOT_BLOCK(0x0b34, 1);
+    // 0b34: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0b36, L0b36);
+L0b36:
+    AOT_BLOCK(0x0b36, 2);
+    // 0b36: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b3a:
+    AOT_BLOCK(0x0b3a, 4);
+    // 0b3a: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b3e: add $2, 4(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0b44: mov (r0), r4
+    {
+        a = r[0];
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b46: beq 0b2a
+    if (Z)
+        AOT_GOTO(0x0b2a, L0b2a);
+    AOT_GOTO(0x0b48, L0b48);
+L0b48:
+    AOT_BLOCK(0x0b48, 2);
+    // 0b48: movb (r3)+, r2
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0b4a: beq 0b52
+    if (Z)
+        AOT_GOTO(0x0b52, L0b52);
+    AOT_GOTO(0x0b4c, L0b4c);
+L0b4c:
+    AOT_BLOCK(0x0b4c, 3);
+    // 0b4c: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0b4e: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b50: beq 0b48
+    if (Z)
+        AOT_GOTO(0x0b48, L0b48);
+    AOT_GOTO(0x0b52, L0b52);
+L0b52:
+    AOT_BLOCK(0x0b52, 2);
+    // 0b52: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b54: beq 0b30
+    if (Z)
+        AOT_GOTO(0x0b30, L0b30);
+    AOT_GOTO(0x0b56, L0b56);
+L0b56:
+    AOT_BLOCK(0x0b56, 2);
+    // 0b56: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b5a: br 0b3a
+    AOT_GOTO(0x0b3a, L0b3a);
+L0b5c:
+    AOT_BLOCK(0x0b5c, 4);
+    // 0b5c: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b60;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 0b60: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b64: beq 0b6e
+    if (Z)
+        AOT_GOTO(0x0b6e, L0b6e);
+    AOT_GOTO(0x0b66, L0b66);
+L0b66:
+    AOT_BLOCK(0x0b66, 2);
+    // 0b66: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b6a: jsr pc, *$153e
+    {
+        a = 0x153e;
+        r[6] -= 2;
+        WR16(r[6], 0x0b6e);
+    }
+    AOT_GOTO(0x153e, L153e);
+L0b6e:
+    AOT_BLOCK(0x0b6e, 2);
+    // 0b6e: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b72:
+    AOT_BLOCK(0x0b72, 7);
+    // 0b72: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b76;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 0b76: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b7a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b7c: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0b80: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b84: jsr pc, *$0c0e
+    {
+        a = 0x0c0e;
+        r[6] -= 2;
+        WR16(r[6], 0x0b88);
+    }
+    AOT_GOTO(0x0c0e, L0c0e);
+L0b88:
+    AOT_BLOCK(0x0b88, 4);
+    // 0b88: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0b8a: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b8e: bitb $20, 6(r0)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[0] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0b94: beq 0b9e
+    if (Z)
+        AOT_GOTO(0x0b9e, L0b9e);
+    AOT_GOTO(0x0b96, L0b96);
+L0b96:
+    AOT_BLOCK(0x0b96, 1);
+    // 0b96: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b9a, L0b9a);
+L0b9a:
+    AOT_BLOCK(0x0b9a, 2);
+    // 0b9a: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b9e:
+    AOT_BLOCK(0x0b9e, 2);
+    // 0b9e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0ba0: br 0b9a
+    AOT_GOTO(0x0b9a, L0b9a);
+L0ba2:
+    AOT_BLOCK(0x0ba2, 7);
+    // 0ba2: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0ba6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 0ba6: mov $22a4, (sp)
+    {
+        src = uint16_t(0x22a4);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0baa: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bac: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0bb0: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bb4: jsr pc, *$0c0e
+    {
+        a = 0x0c0e;
+        r[6] -= 2;
+        WR16(r[6], 0x0bb8);
+    }
+    AOT_GOTO(0x0c0e, L0c0e);
+L0bb8:
+    AOT_BLOCK(0x0bb8, 3);
+    // 0bb8: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0bba: bitb $20, 22aa
+    {
+        src = uint8_t(0x20);
+        b = 0x22aa;
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0bc0: beq 0bca
+    if (Z)
+        AOT_GOTO(0x0bca, L0bca);
+    AOT_GOTO(0x0bc2, L0bc2);
+L0bc2:
+    AOT_BLOCK(0x0bc2, 1);
+    // 0bc2: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bc6, L0bc6);
+L0bc6:
+    AOT_BLOCK(0x0bc6, 2);
+    // 0bc6: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0bca:
+    AOT_BLOCK(0x0bca, 2);
+    // 0bca: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0bcc: br 0bc6
+    AOT_GOTO(0x0bc6, L0bc6);
+L0bce:
+    AOT_BLOCK(0x0bce, 5);
+    // 0bce: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0bd2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 0bd2: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0bd6: tst 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0bda: beq 0bec
+    if (Z)
+        AOT_GOTO(0x0bec, L0bec);
+    AOT_GOTO(0x0bdc, L0bdc);
+L0bdc:
+    AOT_BLOCK(0x0bdc, 2);
+    // 0bdc: bitb $8, 6(r4)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0be2: beq 0bec
+    if (Z)
+        AOT_GOTO(0x0bec, L0bec);
+    AOT_GOTO(0x0be4, L0be4);
+L0be4:
+    AOT_BLOCK(0x0be4, 2);
+    // 0be4: mov 4(r4), (sp)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0be8: jsr pc, *$1220
+    {
+        a = 0x1220;
+        r[6] -= 2;
+        WR16(r[6], 0x0bec);
+    }
+    AOT_GOTO(0x1220, L1220);
+L0bec:
+    AOT_BLOCK(0x0bec, 3);
+    // 0bec: bicb $c, 6(r4)
+    {
+        src = uint8_t(0x0c);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+    }
+    // 0bf2: mov 6(r5), 4(r4)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bf8: bne 0c02
+    if (!Z)
+        AOT_GOTO(0x0c02, L0c02);
+    AOT_GOTO(0x0bfa, L0bfa);
+L0bfa:
+    AOT_BLOCK(0x0bfa, 2);
+    // 0bfa: bisb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0c00: br 0c06
+    AOT_GOTO(0x0c06, L0c06);
+L0c02:
+    AOT_BLOCK(0x0c02, 1);
+    // 0c02: mov 4(r4), (r4)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c06, L0c06);
+L0c06:
+    AOT_BLOCK(0x0c06, 3);
+    // 0c06: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0c0a: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0c0e:
+    AOT_BLOCK(0x0c0e, 5);
+    // 0c0e: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0c12;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 0c12: sub $8c, sp
+    {
+        src = uint16_t(0x008c);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 0c16: mov 4(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0c1c: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c20, L0c20);
+L0c20:
+    AOT_BLOCK(0x0c20, 2);
+    // 0c20: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 0c22: mov -a(r5), r1
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c26, L0c26);
+L0c26:
+    AOT_BLOCK(0x0c26, 2);
+    // 0c26: movb (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0c28: beq 0c34
+    if (Z)
+        AOT_GOTO(0x0c34, L0c34);
+    AOT_GOTO(0x0c2a, L0c2a);
+L0c2a:
+    AOT_BLOCK(0x0c2a, 2);
+    // 0c2a: cmp r2, $25
+    {
+        src = r[2];
+        dst = uint16_t(0x0025);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c2e: beq 0c34
+    if (Z)
+        AOT_GOTO(0x0c34, L0c34);
+    AOT_GOTO(0x0c30, L0c30);
+L0c30:
+    AOT_BLOCK(0x0c30, 2);
+    // 0c30: movb r2, (r3)+
+    {
+        src = uint8_t(r[2]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0c32: br 0c26
+    AOT_GOTO(0x0c26, L0c26);
+L0c34:
+    AOT_BLOCK(0x0c34, 3);
+    // 0c34: mov r1, -a(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0c38: cmp r3, sp
+    {
+        src = r[3];
+        dst = r[6];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c3a: beq 0c52
+    if (Z)
+        AOT_GOTO(0x0c52, L0c52);
+    AOT_GOTO(0x0c3c, L0c3c);
+L0c3c:
+    AOT_BLOCK(0x0c3c, 7);
+    // 0c3c: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+    }
+    // 0c3e: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c42: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 0c44: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c46: sub r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 0c48: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c4a: jsr pc, 0e64
+    {
+        a = 0x0e64;
+        r[6] -= 2;
+        WR16(r[6], 0x0c4e);
+    }
+    AOT_GOTO(0x0e64, L0e64);
+L0c4e:
+    AOT_BLOCK(0x0c4e, 1);
+    // 0c4e: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0c52, L0c52);
+L0c52:
+    AOT_BLOCK(0x0c52, 2);
+    // 0c52: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c54: bne 0c5a
+    if (!Z)
+        AOT_GOTO(0x0c5a, L0c5a);
+    AOT_GOTO(0x0c56, L0c56);
+L0c56:
+    AOT_BLOCK(0x0c56, 2);
+    // 0c56: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0c5a:
+    AOT_BLOCK(0x0c5a, 6);
+    // 0c5a: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 0c5c: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+    }
+    // 0c60: clr -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        WR16(a, 0);
+    }
+    // 0c64: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 0c6a: cmpb *-a(r5), $2d
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        dst = uint8_t(0x2d);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c70: bne 0c7a
+    if (!Z)
+        AOT_GOTO(0x0c7a, L0c7a);
+    AOT_GOTO(0x0c72, L0c72);
+L0c72:
+    AOT_BLOCK(0x0c72, 2);
+    // 0c72: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0c76: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0c7a, L0c7a);
+L0c7a:
+    AOT_BLOCK(0x0c7a, 2);
+    // 0c7a: cmpb *-a(r5), $30
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        dst = uint8_t(0x30);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c80: bne 0c88
+    if (!Z)
+        AOT_GOTO(0x0c88, L0c88);
+    AOT_GOTO(0x0c82, L0c82);
+L0c82:
+    AOT_BLOCK(0x0c82, 1);
+    // 0c82: mov $30, -12(r5)
+    {
+        src = uint16_t(0x0030);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c88, L0c88);
+L0c88:
+    AOT_BLOCK(0x0c88, 1);
+    // 0c88: jsr r3, 0e26
+    {
+        a = 0x0e26;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x0c8c;
+    }
+    AOT_GOTO(0x0e26, L0e26);
+L0c8c:
+    AOT_BLOCK(0x0c8c, 4);
+    // 0c8c: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0c90: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+    }
+    // 0c94: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c98: bne 0ca2
+    if (!Z)
+        AOT_GOTO(0x0ca2, L0ca2);
+    AOT_GOTO(0x0c9a, L0c9a);
+L0c9a:
+    AOT_BLOCK(0x0c9a, 1);
+    // 0c9a: jsr r3, 0e26
+    {
+        a = 0x0e26;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x0c9e;
+    }
+    AOT_GOTO(0x0e26, L0e26);
+L0c9e:
+    AOT_BLOCK(0x0c9e, 1);
+    // 0c9e: mov r1, -10(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ca2, L0ca2);
+L0ca2:
+    AOT_BLOCK(0x0ca2, 1);
+    // 0ca2: mov $2250, r1
+    {
+        src = uint16_t(0x2250);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ca6, L0ca6);
+L0ca6:
+    AOT_BLOCK(0x0ca6, 2);
+    // 0ca6: mov (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ca8: bne 0cb0
+    if (!Z)
+        AOT_GOTO(0x0cb0, L0cb0);
+    AOT_GOTO(0x0caa, L0caa);
+L0caa:
+    AOT_BLOCK(0x0caa, 2);
+    // 0caa: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0cac: jmp 0df6
+    {
+        a = 0x0df6;
+    }
+    AOT_GOTO(0x0df6, L0df6);
+L0cb0:
+    AOT_BLOCK(0x0cb0, 2);
+    // 0cb0: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cb2: bne 0ca6
+    if (!Z)
+        AOT_GOTO(0x0ca6, L0ca6);
+    AOT_GOTO(0x0cb4, L0cb4);
+L0cb4:
+    AOT_BLOCK(0x0cb4, 1);
+    // 0cb4: jmp (r2)
+    {
+        a = r[2];
+    }
+    AOT_JUMP(a);
+L0cb6:
+    AOT_BLOCK(0x0cb6, 3);
+    // 0cb6: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0cba: mov -e(r5), r2
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cbe: jsr pc, 0e5a
+    {
+        a = 0x0e5a;
+        r[6] -= 2;
+        WR16(r[6], 0x0cc2);
+    }
+    AOT_GOTO(0x0e5a, L0e5a);
+L0cc2:
+    AOT_BLOCK(0x0cc2, 1);
+    // 0cc2: jmp *$0df6
+    {
+        a = 0x0df6;
+    }
+    AOT_GOTO(0x0df6, L0df6);
+L0cc6:
+    AOT_BLOCK(0x0cc6, 4);
+    // 0cc6: movb *-a(r5), r0
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0cca: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0cce: cmp r0, $6f
+    {
+        src = r[0];
+        dst = uint16_t(0x006f);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cd2: beq 0cf0
+    if (Z)
+        AOT_GOTO(0x0cf0, L0cf0);
+    AOT_GOTO(0x0cd4, L0cd4);
+L0cd4:
+    AOT_BLOCK(0x0cd4, 2);
+    // 0cd4: cmp r0, $78
+    {
+        src = r[0];
+        dst = uint16_t(0x0078);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cd8: beq 0cfc
+    if (Z)
+        AOT_GOTO(0x0cfc, L0cfc);
+    AOT_GOTO(0x0cda, L0cda);
+L0cda:
+    AOT_BLOCK(0x0cda, 2);
+    // 0cda: cmp r0, $64
+    {
+        src = r[0];
+        dst = uint16_t(0x0064);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cde: beq 0d12
+    if (Z)
+        AOT_GOTO(0x0d12, L0d12);
+    AOT_GOTO(0x0ce0, L0ce0);
+L0ce0:
+    AOT_BLOCK(0x0ce0, 2);
+    // 0ce0: cmp r0, $75
+    {
+        src = r[0];
+        dst = uint16_t(0x0075);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ce4: beq 0d24
+    if (Z)
+        AOT_GOTO(0x0d24, L0d24);
+    AOT_GOTO(0x0ce6, L0ce6);
+L0ce6:
+    AOT_BLOCK(0x0ce6, 2);
+    // 0ce6: dec -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0cea: br 0d0e
+    AOT_GOTO(0x0d0e, L0d0e);
+L0cec:
+    AOT_BLOCK(0x0cec, 2);
+    // 0cec: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0cee: br 0cf2
+    AOT_GOTO(0x0cf2, L0cf2);
+L0cf0:
+    AOT_BLOCK(0x0cf0, 1);
+    // 0cf0: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cf2, L0cf2);
+L0cf2:
+    AOT_BLOCK(0x0cf2, 2);
+    // 0cf2: mov $8, r2
+    {
+        src = uint16_t(0x0008);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cf6: br 0d02
+    AOT_GOTO(0x0d02, L0d02);
+L0cf8:
+    AOT_BLOCK(0x0cf8, 2);
+    // 0cf8: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0cfa: br 0cfe
+    AOT_GOTO(0x0cfe, L0cfe);
+L0cfc:
+    AOT_BLOCK(0x0cfc, 1);
+    // 0cfc: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cfe, L0cfe);
+L0cfe:
+    AOT_BLOCK(0x0cfe, 1);
+    // 0cfe: mov $10, r2
+    {
+        src = uint16_t(0x0010);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d02, L0d02);
+L0d02:
+    AOT_BLOCK(0x0d02, 2);
+    // 0d02: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d04: br 0d2c
+    AOT_GOTO(0x0d2c, L0d2c);
+L0d06:
+    AOT_BLOCK(0x0d06, 3);
+    // 0d06: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d08: sxt r0
+    {
+        r[0] = -int(N);
+        Z = !N;
+    }
+    // 0d0a: bmi 0d18
+    if (N)
+        AOT_GOTO(0x0d18, L0d18);
+    AOT_GOTO(0x0d0c, L0d0c);
+L0d0c:
+    AOT_BLOCK(0x0d0c, 1);
+    // 0d0c: br 0d28
+    AOT_GOTO(0x0d28, L0d28);
+L0d0e:
+    AOT_BLOCK(0x0d0e, 2);
+    // 0d0e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0d10: br 0d26
+    AOT_GOTO(0x0d26, L0d26);
+L0d12:
+    AOT_BLOCK(0x0d12, 2);
+    // 0d12: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d14: bge 0d26
+    if (!(N ^ V))
+        AOT_GOTO(0x0d26, L0d26);
+    AOT_GOTO(0x0d16, L0d16);
+L0d16:
+    AOT_BLOCK(0x0d16, 1);
+    // 0d16: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d18, L0d18);
+L0d18:
+    AOT_BLOCK(0x0d18, 5);
+    // 0d18: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+    }
+    // 0d1a: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 0d1c: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+        C = C && val == -1;
+    }
+    // 0d1e: movb $2d, (r3)+
+    {
+        src = uint8_t(0x2d);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0d22: br 0d28
+    AOT_GOTO(0x0d28, L0d28);
+L0d24:
+    AOT_BLOCK(0x0d24, 1);
+    // 0d24: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d26, L0d26);
+L0d26:
+    AOT_BLOCK(0x0d26, 1);
+    // 0d26: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d28, L0d28);
+L0d28:
+    AOT_BLOCK(0x0d28, 1);
+    // 0d28: mov $a, r2
+    {
+        src = uint16_t(0x000a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d2c, L0d2c);
+L0d2c:
+    AOT_BLOCK(0x0d2c, 7);
+    // 0d2c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d2e: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d30: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0d32: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d36: mov r1, r5
+    {
+        src = r[1];
+        r[5] = src;
+    }
+    // 0d38: ashc $0, r4
+    {
+        src = uint16_t(0x0000) & 077;
+        val = int32_t((uint32_t(r[4]) << 16) | r[5]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[4] = uint32_t(val2) >> 16;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[4] = uint32_t(val2) >> 16;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 0d3c: beq 0d46
+    if (Z)
+        AOT_GOTO(0x0d46, L0d46);
+    AOT_GOTO(0x0d3e, L0d3e);
+L0d3e:
+    AOT_BLOCK(0x0d3e, 2);
+    // 0d3e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d40: beq 0d46
+    if (Z)
+        AOT_GOTO(0x0d46, L0d46);
+    AOT_GOTO(0x0d42, L0d42);
+L0d42:
+    AOT_BLOCK(0x0d42, 1);
+    // 0d42: movb $30, (r3)+
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d46, L0d46);
+L0d46:
+    AOT_BLOCK(0x0d46, 1);
+    // 0d46: jsr pc, 0d50
+    {
+        a = 0x0d50;
+        r[6] -= 2;
+        WR16(r[6], 0x0d4a);
+    }
+    AOT_GOTO(0x0d50, L0d50);
+L0d4a:
+    AOT_BLOCK(0x0d4a, 3);
+    // 0d4a: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0d4c: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d4e: br 0df6
+    AOT_GOTO(0x0df6, L0df6);
+L0d50:
+    AOT_BLOCK(0x0d50, 3);
+    // 0d50: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 0d52: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d54: beq 0d5c
+    if (Z)
+        AOT_GOTO(0x0d5c, L0d5c);
+    AOT_GOTO(0x0d56, L0d56);
+L0d56:
+    AOT_BLOCK(0x0d56, 3);
+    // 0d56: div r2, r0
+    {
+        src = int16_t(r[2]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0d58: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0d5a: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d5c, L0d5c);
+L0d5c:
+    AOT_BLOCK(0x0d5c, 7);
+    // 0d5c: mov r5, r1
+    {
+        src = r[5];
+        r[1] = src;
+    }
+    // 0d5e: asl r2
+    {
+        src = r[2];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[2] = val;
+    }
+    // 0d60: div r2, r0
+    {
+        src = int16_t(r[2]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0d62: asr r2
+    {
+        src = r[2];
+        val = int16_t(src) >> 1;
+        r[2] = val;
+    }
+    // 0d64: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0d66: cmp r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d68: bgt 0d6e
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0d6e, L0d6e);
+    AOT_GOTO(0x0d6a, L0d6a);
+L0d6a:
+    AOT_BLOCK(0x0d6a, 2);
+    // 0d6a: sub r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        C = dst < src;
+    }
+    // 0d6c: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0d6e, L0d6e);
+L0d6e:
+    AOT_BLOCK(0x0d6e, 3);
+    // 0d6e: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d70: mov r0, r5
+    {
+        src = r[0];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d72: bne 0d78
+    if (!Z)
+        AOT_GOTO(0x0d78, L0d78);
+    AOT_GOTO(0x0d74, L0d74);
+L0d74:
+    AOT_BLOCK(0x0d74, 2);
+    // 0d74: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d76: beq 0d7c
+    if (Z)
+        AOT_GOTO(0x0d7c, L0d7c);
+    AOT_GOTO(0x0d78, L0d78);
+L0d78:
+    AOT_BLOCK(0x0d78, 1);
+    // 0d78: jsr pc, 0d50
+    {
+        a = 0x0d50;
+        r[6] -= 2;
+        WR16(r[6], 0x0d7c);
+    }
+    AOT_GOTO(0x0d50, L0d50);
+L0d7c:
+    AOT_BLOCK(0x0d7c, 4);
+    // 0d7c: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d7e: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0d82: cmp r0, $39
+    {
+        src = r[0];
+        dst = uint16_t(0x0039);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d86: ble 0d8c
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0d8c, L0d8c);
+    AOT_GOTO(0x0d88, L0d88);
+L0d88:
+    AOT_BLOCK(0x0d88, 1);
+    // 0d88: add $27, r0
+    {
+        src = uint16_t(0x0027);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0d8c, L0d8c);
+L0d8c:
+    AOT_BLOCK(0x0d8c, 2);
+    // 0d8c: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0d8e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0d90:
+    AOT_BLOCK(0x0d90, 4);
+    // 0d90: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 0d96: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d98: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0d9c: beq 0df6
+    if (Z)
+        AOT_GOTO(0x0df6, L0df6);
+    AOT_GOTO(0x0d9e, L0d9e);
+L0d9e:
+    AOT_BLOCK(0x0d9e, 2);
+    // 0d9e: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0da0: br 0df6
+    AOT_GOTO(0x0df6, L0df6);
+L0da2:
+    AOT_BLOCK(0x0da2, 5);
+    // 0da2: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 0da8: mov -10(r5), r1
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0dac: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0dae: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0db0: bne 0dba
+    if (!Z)
+        AOT_GOTO(0x0dba, L0dba);
+    AOT_GOTO(0x0db2, L0db2);
+L0db2:
+    AOT_BLOCK(0x0db2, 3);
+    // 0db2: mov $2294, r2
+    {
+        src = uint16_t(0x2294);
+        r[2] = src;
+    }
+    // 0db6: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+    }
+    // 0db8: mov r2, (r4)
+    {
+        src = r[2];
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0dba, L0dba);
+L0dba:
+    AOT_BLOCK(0x0dba, 2);
+    // 0dba: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0dbc: beq 0dc2
+    if (Z)
+        AOT_GOTO(0x0dc2, L0dc2);
+    AOT_GOTO(0x0dbe, L0dbe);
+L0dbe:
+    AOT_BLOCK(0x0dbe, 2);
+    // 0dbe: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0dc0: sob r1, 4
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x0dba, L0dba);
+    AOT_GOTO(0x0dc2, L0dc2);
+L0dc2:
+    AOT_BLOCK(0x0dc2, 2);
+    // 0dc2: mov (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dc4: br 0df8
+    AOT_GOTO(0x0df8, L0df8);
+L0dc6:
+    AOT_BLOCK(0x0dc6, 3);
+    // 0dc6: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0dca: mov -e(r5), r2
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dce: jsr pc, 0e5a
+    {
+        a = 0x0e5a;
+        r[6] -= 2;
+        WR16(r[6], 0x0dd2);
+    }
+    AOT_GOTO(0x0e5a, L0e5a);
+L0dd2:
+    AOT_BLOCK(0x0dd2, 1);
+    // 0dd2: br 0df6
+    AOT_GOTO(0x0df6, L0df6);
+L0dd4:
+    AOT_BLOCK(0x0dd4, 4);
+    // 0dd4: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0dd8: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 0dda: tst -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0dde: bne 0de4
+    if (!Z)
+        AOT_GOTO(0x0de4, L0de4);
+    AOT_GOTO(0x0de0, L0de0);
+L0de0:
+    AOT_BLOCK(0x0de0, 1);
+    // 0de0: mov $7, r0
+    {
+        src = uint16_t(0x0007);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0de4, L0de4);
+L0de4:
+    AOT_BLOCK(0x0de4, 2);
+    // 0de4: mov pc, r2
+    {
+        src = uint16_t(0x0de6);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0de6: jsr pc, 0e5a
+    {
+        a = 0x0e5a;
+        r[6] -= 2;
+        WR16(r[6], 0x0dea);
+    }
+    AOT_GOTO(0x0e5a, L0e5a);
+L0dea:
+    AOT_BLOCK(0x0dea, 1);
+    // 0dea: br 0df6
+    AOT_GOTO(0x0df6, L0df6);
+L0dec:
+    AOT_BLOCK(0x0dec, 3);
+    // 0dec: mov (r4)+, r4
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0dee: mov (r4)+, -a(r5)
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0df2: jmp 0c20
+    {
+        a = 0x0c20;
+    }
+    AOT_GOTO(0x0c20, L0c20);
+L0df6:
+    AOT_BLOCK(0x0df6, 1);
+    // 0df6: mov sp, r2
+    {
+        src = r[6];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0df8, L0df8);
+L0df8:
+    AOT_BLOCK(0x0df8, 4);
+    // 0df8: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 0dfa: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0dfe: sub r3, r1
+    {
+        src = r[3];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 0e00: bge 0e04
+    if (!(N ^ V))
+        AOT_GOTO(0x0e04, L0e04);
+    AOT_GOTO(0x0e02, L0e02);
+L0e02:
+    AOT_BLOCK(0x0e02, 1);
+    // 0e02: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0e04, L0e04);
+L0e04:
+    AOT_BLOCK(0x0e04, 2);
+    // 0e04: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e08: bne 0e0c
+    if (!Z)
+        AOT_GOTO(0x0e0c, L0e0c);
+    AOT_GOTO(0x0e0a, L0e0a);
+L0e0a:
+    AOT_BLOCK(0x0e0a, 1);
+    // 0e0a: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0e0c, L0e0c);
+L0e0c:
+    AOT_BLOCK(0x0e0c, 6);
+    // 0e0c: mov -12(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e10: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e14: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e16: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e18: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e1a: jsr pc, 0e64
+    {
+        a = 0x0e64;
+        r[6] -= 2;
+        WR16(r[6], 0x0e1e);
+    }
+    AOT_GOTO(0x0e64, L0e64);
+L0e1e:
+    AOT_BLOCK(0x0e1e, 2);
+    // 0e1e: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0e22: jmp 0c20
+    {
+        a = 0x0c20;
+    }
+    AOT_GOTO(0x0c20, L0c20);
+L0e26:
+    AOT_BLOCK(0x0e26, 2);
+    // 0e26: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+    }
+    // 0e2a: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0e2c, L0e2c);
+L0e2c:
+    AOT_BLOCK(0x0e2c, 5);
+    // 0e2c: movb *-a(r5), r0
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0e30: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0e34: sub $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0e38: cmp r0, $fffa
+    {
+        src = r[0];
+        dst = uint16_t(0xfffa);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e3c: bne 0e42
+    if (!Z)
+        AOT_GOTO(0x0e42, L0e42);
+    AOT_GOTO(0x0e3e, L0e3e);
+L0e3e:
+    AOT_BLOCK(0x0e3e, 2);
+    // 0e3e: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e40: br 0e48
+    AOT_GOTO(0x0e48, L0e48);
+L0e42:
+    AOT_BLOCK(0x0e42, 2);
+    // 0e42: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e46: bhi 0e54
+    if (!(C | Z))
+        AOT_GOTO(0x0e54, L0e54);
+    AOT_GOTO(0x0e48, L0e48);
+L0e48:
+    AOT_BLOCK(0x0e48, 4);
+    // 0e48: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0e4c: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0e50: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0e52: br 0e2c
+    AOT_GOTO(0x0e2c, L0e2c);
+L0e54:
+    AOT_BLOCK(0x0e54, 2);
+    // 0e54: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0e58: rts r3
+    {
+        b = r[3];
+        r[3] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0e5a:
+    AOT_BLOCK(0x0e5a, 3);
+    // 0e5a: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0e5e: movb $3f, (r3)+
+    {
+        src = uint8_t(0x3f);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0e62: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0e64:
+    AOT_BLOCK(0x0e64, 6);
+    // 0e64: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0e68;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 0e68: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0e6c: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0e70: mov a(r5), r2
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e74: br 0ea8
+    AOT_GOTO(0x0ea8, L0ea8);
+L0e76:
+    AOT_BLOCK(0x0e76, 5);
+    // 0e76: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e78: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0e7a: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e7c: bic $ff00, (sp)
+    {
+        src = uint16_t(0xff00);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0e80: jsr pc, *$0f24
+    {
+        a = 0x0f24;
+        r[6] -= 2;
+        WR16(r[6], 0x0e84);
+    }
+    AOT_GOTO(0x0f24, L0f24);
+L0e84:
+    AOT_BLOCK(0x0e84, 1);
+    // 0e84: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0e86, L0e86);
+L0e86:
+    AOT_BLOCK(0x0e86, 1);
+    // 0e86: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0e88, L0e88);
+L0e88:
+    AOT_BLOCK(0x0e88, 2);
+    // 0e88: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0e8c: blt 0e98
+    if (N ^ V)
+        AOT_GOTO(0x0e98, L0e98);
+    AOT_GOTO(0x0e8e, L0e8e);
+L0e8e:
+    AOT_BLOCK(0x0e8e, 3);
+    // 0e8e: movb c(r5), *0(r2)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD8(a);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 0e94: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0e96: br 0ea4
+    AOT_GOTO(0x0ea4, L0ea4);
+L0e98:
+    AOT_BLOCK(0x0e98, 3);
+    // 0e98: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e9a: mov c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e9e: jsr pc, *$0f24
+    {
+        a = 0x0f24;
+        r[6] -= 2;
+        WR16(r[6], 0x0ea2);
+    }
+    AOT_GOTO(0x0f24, L0f24);
+L0ea2:
+    AOT_BLOCK(0x0ea2, 1);
+    // 0ea2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0ea4, L0ea4);
+L0ea4:
+    AOT_BLOCK(0x0ea4, 1);
+    // 0ea4: inc 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0ea8, L0ea8);
+L0ea8:
+    AOT_BLOCK(0x0ea8, 2);
+    // 0ea8: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0eac: bge 0ef4
+    if (!(N ^ V))
+        AOT_GOTO(0x0ef4, L0ef4);
+    AOT_GOTO(0x0eae, L0eae);
+L0eae:
+    AOT_BLOCK(0x0eae, 2);
+    // 0eae: cmpb $2d, (r4)
+    {
+        src = uint8_t(0x2d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0eb2: bne 0e88
+    if (!Z)
+        AOT_GOTO(0x0e88, L0e88);
+    AOT_GOTO(0x0eb4, L0eb4);
+L0eb4:
+    AOT_BLOCK(0x0eb4, 2);
+    // 0eb4: cmp $30, c(r5)
+    {
+        src = uint16_t(0x0030);
+        b = uint16_t(r[5] + 12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0eba: bne 0e88
+    if (!Z)
+        AOT_GOTO(0x0e88, L0e88);
+    AOT_GOTO(0x0ebc, L0ebc);
+L0ebc:
+    AOT_BLOCK(0x0ebc, 2);
+    // 0ebc: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0ec0: blt 0e76
+    if (N ^ V)
+        AOT_GOTO(0x0e76, L0e76);
+    AOT_GOTO(0x0ec2, L0ec2);
+L0ec2:
+    AOT_BLOCK(0x0ec2, 5);
+    // 0ec2: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0ec4: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0ec8: movb r0, *0(r2)
+    {
+        src = uint8_t(r[0]);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 0ecc: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0ece: br 0e86
+    AOT_GOTO(0x0e86, L0e86);
+L0ed0:
+    AOT_BLOCK(0x0ed0, 5);
+    // 0ed0: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0ed2: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0ed6: movb r0, *0(r2)
+    {
+        src = uint8_t(r[0]);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 0eda: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0edc: br 0ef4
+    AOT_GOTO(0x0ef4, L0ef4);
+L0ede:
+    AOT_BLOCK(0x0ede, 2);
+    // 0ede: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0ee2: bge 0ed0
+    if (!(N ^ V))
+        AOT_GOTO(0x0ed0, L0ed0);
+    AOT_GOTO(0x0ee4, L0ee4);
+L0ee4:
+    AOT_BLOCK(0x0ee4, 5);
+    // 0ee4: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ee6: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0ee8: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0eea: bic $ff00, (sp)
+    {
+        src = uint16_t(0xff00);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0eee: jsr pc, *$0f24
+    {
+        a = 0x0f24;
+        r[6] -= 2;
+        WR16(r[6], 0x0ef2);
+    }
+    AOT_GOTO(0x0f24, L0f24);
+L0ef2:
+    AOT_BLOCK(0x0ef2, 1);
+    // 0ef2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0ef4, L0ef4);
+L0ef4:
+    AOT_BLOCK(0x0ef4, 2);
+    // 0ef4: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0ef6: bge 0ede
+    if (!(N ^ V))
+        AOT_GOTO(0x0ede, L0ede);
+    AOT_GOTO(0x0ef8, L0ef8);
+L0ef8:
+    AOT_BLOCK(0x0ef8, 1);
+    // 0ef8: br 0f1a
+    AOT_GOTO(0x0f1a, L0f1a);
+L0efa:
+    AOT_BLOCK(0x0efa, 2);
+    // 0efa: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0efe: blt 0f0a
+    if (N ^ V)
+        AOT_GOTO(0x0f0a, L0f0a);
+    AOT_GOTO(0x0f00, L0f00);
+L0f00:
+    AOT_BLOCK(0x0f00, 3);
+    // 0f00: movb c(r5), *0(r2)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD8(a);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 0f06: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0f08: br 0f16
+    AOT_GOTO(0x0f16, L0f16);
+L0f0a:
+    AOT_BLOCK(0x0f0a, 3);
+    // 0f0a: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f0c: mov c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f10: jsr pc, *$0f24
+    {
+        a = 0x0f24;
+        r[6] -= 2;
+        WR16(r[6], 0x0f14);
+    }
+    AOT_GOTO(0x0f24, L0f24);
+L0f14:
+    AOT_BLOCK(0x0f14, 1);
+    // 0f14: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0f16, L0f16);
+L0f16:
+    AOT_BLOCK(0x0f16, 1);
+    // 0f16: dec 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0f1a, L0f1a);
+L0f1a:
+    AOT_BLOCK(0x0f1a, 2);
+    // 0f1a: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f1e: bne 0efa
+    if (!Z)
+        AOT_GOTO(0x0efa, L0efa);
+    AOT_GOTO(0x0f20, L0f20);
+L0f20:
+    AOT_BLOCK(0x0f20, 2);
+    // 0f20: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0f24:
+    AOT_BLOCK(0x0f24, 6);
+    // 0f24: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0f28;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 0f28: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0f2c: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 0f30: bitb $80, 6(r4)
+    {
+        src = uint8_t(0x80);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0f36: beq 0f44
+    if (Z)
+        AOT_GOTO(0x0f44, L0f44);
+    AOT_GOTO(0x0f38, L0f38);
+L0f38:
+    AOT_BLOCK(0x0f38, 2);
+    // 0f38: bisb $2, 6(r4)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 0f3e: bicb $10, 6(r4)
+    {
+        src = uint8_t(0x10);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f44, L0f44);
+L0f44:
+    AOT_BLOCK(0x0f44, 2);
+    // 0f44: bitb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0f4a: beq 0f76
+    if (Z)
+        AOT_GOTO(0x0f76, L0f76);
+    AOT_GOTO(0x0f4c, L0f4c);
+L0f4c:
+    AOT_BLOCK(0x0f4c, 8);
+    // 0f4c: movb 4(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = uint16_t(r[5] + -10);
+        WR8(b, src);
+    }
+    // 0f52: mov $1, -8(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0f58: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f5c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f5e: add $fff6, (sp)
+    {
+        src = uint16_t(0xfff6);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0f62: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0f66: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f68: jsr pc, *$1572
+    {
+        a = 0x1572;
+        r[6] -= 2;
+        WR16(r[6], 0x0f6c);
+    }
+    AOT_GOTO(0x1572, L1572);
+L0f6c:
+    AOT_BLOCK(0x0f6c, 4);
+    // 0f6c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0f6e: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0f70: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0f74: br 0fec
+    AOT_GOTO(0x0fec, L0fec);
+L0f76:
+    AOT_BLOCK(0x0f76, 2);
+    // 0f76: mov 4(r4), r3
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f7a: bne 0fc2
+    if (!Z)
+        AOT_GOTO(0x0fc2, L0fc2);
+    AOT_GOTO(0x0f7c, L0f7c);
+L0f7c:
+    AOT_BLOCK(0x0f7c, 2);
+    // 0f7c: cmp $22a4, r4
+    {
+        src = uint16_t(0x22a4);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f80: bne 0fa4
+    if (!Z)
+        AOT_GOTO(0x0fa4, L0fa4);
+    AOT_GOTO(0x0f82, L0f82);
+L0f82:
+    AOT_BLOCK(0x0f82, 3);
+    // 0f82: movb 22ab, r0
+    {
+        a = 0x22ab;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0f86: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f88: jsr pc, *$12e8
+    {
+        a = 0x12e8;
+        r[6] -= 2;
+        WR16(r[6], 0x0f8c);
+    }
+    AOT_GOTO(0x12e8, L12e8);
+L0f8c:
+    AOT_BLOCK(0x0f8c, 2);
+    // 0f8c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f8e: beq 0f98
+    if (Z)
+        AOT_GOTO(0x0f98, L0f98);
+    AOT_GOTO(0x0f90, L0f90);
+L0f90:
+    AOT_BLOCK(0x0f90, 2);
+    // 0f90: bisb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0f96: br 0f44
+    AOT_GOTO(0x0f44, L0f44);
+L0f98:
+    AOT_BLOCK(0x0f98, 3);
+    // 0f98: mov $29a0, 4(r4)
+    {
+        src = uint16_t(0x29a0);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 0f9e: mov $29a0, (r4)
+    {
+        src = uint16_t(0x29a0);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fa2: br 0f44
+    AOT_GOTO(0x0f44, L0f44);
+L0fa4:
+    AOT_BLOCK(0x0fa4, 2);
+    // 0fa4: mov $200, (sp)
+    {
+        src = uint16_t(0x0200);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fa8: jsr pc, *$10e6
+    {
+        a = 0x10e6;
+        r[6] -= 2;
+        WR16(r[6], 0x0fac);
+    }
+    AOT_GOTO(0x10e6, L10e6);
+L0fac:
+    AOT_BLOCK(0x0fac, 3);
+    // 0fac: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0fae: mov r3, 4(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fb2: beq 0f90
+    if (Z)
+        AOT_GOTO(0x0f90, L0f90);
+    AOT_GOTO(0x0fb4, L0fb4);
+L0fb4:
+    AOT_BLOCK(0x0fb4, 4);
+    // 0fb4: bisb $8, 6(r4)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 0fba: clr r2
+    {
+        r[2] = 0;
+        C = false;
+    }
+    // 0fbc: mov r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fc0: br 0fe0
+    AOT_GOTO(0x0fe0, L0fe0);
+L0fc2:
+    AOT_BLOCK(0x0fc2, 4);
+    // 0fc2: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0fc4: sub r3, r2
+    {
+        src = r[3];
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+        C = dst < src;
+    }
+    // 0fc6: mov r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fca: ble 0fe0
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0fe0, L0fe0);
+    AOT_GOTO(0x0fcc, L0fcc);
+L0fcc:
+    AOT_BLOCK(0x0fcc, 6);
+    // 0fcc: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 0fce: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fd0: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fd2: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0fd6: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fd8: jsr pc, *$1572
+    {
+        a = 0x1572;
+        r[6] -= 2;
+        WR16(r[6], 0x0fdc);
+    }
+    AOT_GOTO(0x1572, L1572);
+L0fdc:
+    AOT_BLOCK(0x0fdc, 2);
+    // 0fdc: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0fde: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fe0, L0fe0);
+L0fe0:
+    AOT_BLOCK(0x0fe0, 3);
+    // 0fe0: mov $1ff, 2(r4)
+    {
+        src = uint16_t(0x01ff);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 0fe6: movb 4(r5), (r3)+
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 0fea: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fec, L0fec);
+L0fec:
+    AOT_BLOCK(0x0fec, 2);
+    // 0fec: cmp r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ff0: beq 1000
+    if (Z)
+        AOT_GOTO(0x1000, L1000);
+    AOT_GOTO(0x0ff2, L0ff2);
+L0ff2:
+    AOT_BLOCK(0x0ff2, 2);
+    // 0ff2: bisb $20, 6(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 0ff8: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ffc, L0ffc);
+L0ffc:
+    AOT_BLOCK(0x0ffc, 2);
+    // 0ffc: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1000:
+    AOT_BLOCK(0x1000, 2);
+    // 1000: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1004: br 0ffc
+    AOT_GOTO(0x0ffc, L0ffc);
+L1006:
+    AOT_BLOCK(0x1006, 7);
+    // 1006: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x100a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 100a: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 100e: movb 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1012: bic $fff9, r0
+    {
+        src = uint16_t(0xfff9);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1016: cmp $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 101a: bne 1054
+    if (!Z)
+        AOT_GOTO(0x1054, L1054);
+    AOT_GOTO(0x101c, L101c);
+L101c:
+    AOT_BLOCK(0x101c, 2);
+    // 101c: mov 4(r4), r3
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1020: beq 1054
+    if (Z)
+        AOT_GOTO(0x1054, L1054);
+    AOT_GOTO(0x1022, L1022);
+L1022:
+    AOT_BLOCK(0x1022, 4);
+    // 1022: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1024: sub r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 1026: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1028: ble 1054
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1054, L1054);
+    AOT_GOTO(0x102a, L102a);
+L102a:
+    AOT_BLOCK(0x102a, 7);
+    // 102a: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 102c: mov $200, 2(r4)
+    {
+        src = uint16_t(0x0200);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 1032: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1034: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1036: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 103a: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 103c: jsr pc, *$1572
+    {
+        a = 0x1572;
+        r[6] -= 2;
+        WR16(r[6], 0x1040);
+    }
+    AOT_GOTO(0x1572, L1572);
+L1040:
+    AOT_BLOCK(0x1040, 3);
+    // 1040: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 1042: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1044: beq 1054
+    if (Z)
+        AOT_GOTO(0x1054, L1054);
+    AOT_GOTO(0x1046, L1046);
+L1046:
+    AOT_BLOCK(0x1046, 2);
+    // 1046: bisb $20, 6(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 104c: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1050, L1050);
+L1050:
+    AOT_BLOCK(0x1050, 2);
+    // 1050: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1054:
+    AOT_BLOCK(0x1054, 2);
+    // 1054: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1056: br 1050
+    AOT_GOTO(0x1050, L1050);
+L1058:
+    AOT_BLOCK(0x1058, 2);
+    // 1058: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x105c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    AOT_GOTO(0x105c, L105c);
+L105a:
+    AOT_BLOCK(0x105a, 1);
+    // 105a: blt 10e8
+    if (N ^ V)
+        AOT_GOTO(0x10e8, L10e8);
+    AOT_GOTO(0x105c, L105c);
+L105c:
+    AOT_BLOCK(0x105c, 2);
+    // 105c: mov $229c, r4
+    {
+        src = uint16_t(0x229c);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1060: br 106c
+    AOT_GOTO(0x106c, L106c);
+L1062:
+    AOT_BLOCK(0x1062, 2);
+    // 1062: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1064: jsr pc, *$1076
+    {
+        a = 0x1076;
+        r[6] -= 2;
+        WR16(r[6], 0x1068);
+    }
+    AOT_GOTO(0x1076, L1076);
+L1068:
+    AOT_BLOCK(0x1068, 1);
+    // 1068: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x106c, L106c);
+L106c:
+    AOT_BLOCK(0x106c, 2);
+    // 106c: cmp 233c, r4
+    {
+        a = 0x233c;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1070: bhi 1062
+    if (!(C | Z))
+        AOT_GOTO(0x1062, L1062);
+    AOT_GOTO(0x1072, L1072);
+L1072:
+    AOT_BLOCK(0x1072, 2);
+    // 1072: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1076:
+    AOT_BLOCK(0x1076, 6);
+    // 1076: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x107a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 107a: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 107e: mov $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        r[3] = src;
+    }
+    // 1082: bitb $83, 6(r4)
+    {
+        src = uint8_t(0x83);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1088: beq 10c8
+    if (Z)
+        AOT_GOTO(0x10c8, L10c8);
+    AOT_GOTO(0x108a, L108a);
+L108a:
+    AOT_BLOCK(0x108a, 2);
+    // 108a: bitb $40, 6(r4)
+    {
+        src = uint8_t(0x40);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1090: bne 10c8
+    if (!Z)
+        AOT_GOTO(0x10c8, L10c8);
+    AOT_GOTO(0x1092, L1092);
+L1092:
+    AOT_BLOCK(0x1092, 2);
+    // 1092: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1094: jsr pc, *$1006
+    {
+        a = 0x1006;
+        r[6] -= 2;
+        WR16(r[6], 0x1098);
+    }
+    AOT_GOTO(0x1006, L1006);
+L1098:
+    AOT_BLOCK(0x1098, 4);
+    // 1098: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 109a: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 109e: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10a0: jsr pc, *$139e
+    {
+        a = 0x139e;
+        r[6] -= 2;
+        WR16(r[6], 0x10a4);
+    }
+    AOT_GOTO(0x139e, L139e);
+L10a4:
+    AOT_BLOCK(0x10a4, 2);
+    // 10a4: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10a6: bge 10ac
+    if (!(N ^ V))
+        AOT_GOTO(0x10ac, L10ac);
+    AOT_GOTO(0x10a8, L10a8);
+L10a8:
+    AOT_BLOCK(0x10a8, 1);
+    // 10a8: mov $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x10ac, L10ac);
+L10ac:
+    AOT_BLOCK(0x10ac, 2);
+    // 10ac: bitb $8, 6(r4)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 10b2: beq 10bc
+    if (Z)
+        AOT_GOTO(0x10bc, L10bc);
+    AOT_GOTO(0x10b4, L10b4);
+L10b4:
+    AOT_BLOCK(0x10b4, 2);
+    // 10b4: mov 4(r4), (sp)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10b8: jsr pc, *$1220
+    {
+        a = 0x1220;
+        r[6] -= 2;
+        WR16(r[6], 0x10bc);
+    }
+    AOT_GOTO(0x1220, L1220);
+L10bc:
+    AOT_BLOCK(0x10bc, 2);
+    // 10bc: bitb $c, 6(r4)
+    {
+        src = uint8_t(0x0c);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 10c2: beq 10c8
+    if (Z)
+        AOT_GOTO(0x10c8, L10c8);
+    AOT_GOTO(0x10c4, L10c4);
+L10c4:
+    AOT_BLOCK(0x10c4, 1);
+    // 10c4: clr 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x10c8, L10c8);
+L10c8:
+    AOT_BLOCK(0x10c8, 5);
+    // 10c8: bicb $ff, 6(r4)
+    {
+        src = uint8_t(0xff);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+    }
+    // 10ce: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        C = false;
+    }
+    // 10d2: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 10d4: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L10d8:
+    AOT_BLOCK(0x10d8, 3);
+    // 10d8: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10da: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10dc: jsr pc, 1058
+    {
+        a = 0x1058;
+        r[6] -= 2;
+        WR16(r[6], 0x10e0);
+    }
+    AOT_GOTO(0x1058, L1058);
+L10e0:
+    AOT_BLOCK(0x10e0, 1);
+    // 10e0: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10e4: sys 1
+    AOT_INTERP(0x10e4);
+L10e6:
+    AOT_BLOCK(0x10e6, 2);
+    // 10e6: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x10ea;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    AOT_GOTO(0x10ea, L10ea);
+L10e8:
+    AOT_BLOCK(0x10e8, 1);
+    // 10e8: bge 105a
+    if (!(N ^ V))
+        AOT_GOTO(0x105a, L105a);
+    AOT_GOTO(0x10ea, L10ea);
+L10ea:
+    AOT_BLOCK(0x10ea, 1);
+    // 10ea: tst 2da4
+    {
+        a = 0x2da4;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x10ee, L10ee);
+L10ec:
+    AOT_BLOCK(0x10ec, 2);
+    // 10ec: mov 212(r2), 15c0(sp)
+    {
+        a = uint16_t(r[2] + 530);
+        src = RD16(a);
+        b = uint16_t(r[6] + 5568);
+        WR16(b, src);
+    }
+    // 10f2: cmp 55c0(sp), -(sp)
+    {
+        a = uint16_t(r[6] + 21952);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 10f6: wait
+    AOT_INTERP(0x10f6);
+L10ee:
+    AOT_BLOCK(0x10ee, 1);
+    // 10ee: bne 1114
+    if (!Z)
+        AOT_GOTO(0x1114, L1114);
+    AOT_GOTO(0x10f0, L10f0);
+L10f0:
+    AOT_BLOCK(0x10f0, 2);
+    // 10f0: mov $2da6, r0
+    {
+        src = uint16_t(0x2da6);
+        r[0] = src;
+    }
+    // 10f4: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x10f8, L10f8);
+L10f8:
+    AOT_BLOCK(0x10f8, 6);
+    // 10f8: mov r0, 2da4
+    {
+        src = r[0];
+        b = 0x2da4;
+        WR16(b, src);
+    }
+    // 10fc: mov $2da4, r0
+    {
+        src = uint16_t(0x2da4);
+        r[0] = src;
+    }
+    // 1100: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 1104: mov r0, 2da6
+    {
+        src = r[0];
+        b = 0x2da6;
+        WR16(b, src);
+    }
+    // 1108: mov $2da6, 2daa
+    {
+        src = uint16_t(0x2da6);
+        b = 0x2daa;
+        WR16(b, src);
+    }
+    // 110e: mov $2da4, 2da8
+    {
+        src = uint16_t(0x2da4);
+        b = 0x2da8;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1114, L1114);
+L1114:
+    AOT_BLOCK(0x1114, 6);
+    // 1114: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1118: add $3, r1
+    {
+        src = uint16_t(0x0003);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 111c: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 111e: ashc $ffff, r0
+    {
+        src = uint16_t(0xffff) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 1122: mov r1, r2
+    {
+        src = r[1];
+        r[2] = src;
+    }
+    // 1124: mov 2da8, r4
+    {
+        a = 0x2da8;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1128, L1128);
+L1128:
+    AOT_BLOCK(0x1128, 1);
+    // 1128: clr 2dae
+    {
+        a = 0x2dae;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x112c, L112c);
+L112c:
+    AOT_BLOCK(0x112c, 2);
+    // 112c: bit $1, (r4)
+    {
+        src = uint16_t(0x0001);
+        b = r[4];
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1130: beq 1136
+    if (Z)
+        AOT_GOTO(0x1136, L1136);
+    AOT_GOTO(0x1132, L1132);
+L1132:
+    AOT_BLOCK(0x1132, 1);
+    // 1132: br 1152
+    AOT_GOTO(0x1152, L1152);
+L1134:
+    AOT_BLOCK(0x1134, 1);
+    // 1134: mov (r3), (r4)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1136, L1136);
+L1136:
+    AOT_BLOCK(0x1136, 3);
+    // 1136: mov (r4), r3
+    {
+        a = r[4];
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1138: bit $1, (r3)
+    {
+        src = uint16_t(0x0001);
+        b = r[3];
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 113c: beq 1134
+    if (Z)
+        AOT_GOTO(0x1134, L1134);
+    AOT_GOTO(0x113e, L113e);
+L113e:
+    AOT_BLOCK(0x113e, 5);
+    // 113e: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 1140: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1142: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1144: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1146: bcs 1152
+    if (C)
+        AOT_GOTO(0x1152, L1152);
+    AOT_GOTO(0x1148, L1148);
+L1148:
+    AOT_BLOCK(0x1148, 5);
+    // 1148: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 114a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 114c: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 114e: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1150: blos 11f6
+    if (C | Z)
+        AOT_GOTO(0x11f6, L11f6);
+    AOT_GOTO(0x1152, L1152);
+L1152:
+    AOT_BLOCK(0x1152, 5);
+    // 1152: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 1154: mov (r4), r4
+    {
+        a = r[4];
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1156: bic $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 115a: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 115c: bcs 112c
+    if (C)
+        AOT_GOTO(0x112c, L112c);
+    AOT_GOTO(0x115e, L115e);
+L115e:
+    AOT_BLOCK(0x115e, 2);
+    // 115e: cmp 2daa, r3
+    {
+        a = 0x2daa;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1162: bne 116a
+    if (!Z)
+        AOT_GOTO(0x116a, L116a);
+    AOT_GOTO(0x1164, L1164);
+L1164:
+    AOT_BLOCK(0x1164, 2);
+    // 1164: cmp $2da4, r4
+    {
+        src = uint16_t(0x2da4);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1168: beq 1170
+    if (Z)
+        AOT_GOTO(0x1170, L1170);
+    AOT_GOTO(0x116a, L116a);
+L116a:
+    AOT_BLOCK(0x116a, 1);
+    // 116a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x116c, L116c);
+L116c:
+    AOT_BLOCK(0x116c, 2);
+    // 116c: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1170:
+    AOT_BLOCK(0x1170, 3);
+    // 1170: inc 2dae
+    {
+        a = 0x2dae;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1174: cmp $1, 2dae
+    {
+        src = uint16_t(0x0001);
+        b = 0x2dae;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 117a: bge 112c
+    if (!(N ^ V))
+        AOT_GOTO(0x112c, L112c);
+    AOT_GOTO(0x117c, L117c);
+L117c:
+    AOT_BLOCK(0x117c, 8);
+    // 117c: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 117e: add $200, r1
+    {
+        src = uint16_t(0x0200);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        N = val16 < 0;
+    }
+    // 1182: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 1184: div $200, r0
+    {
+        src = int16_t(uint16_t(0x0200));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1188: ash $9, r0
+    {
+        src = uint16_t(0x0009) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 118c: mov r0, 2dae
+    {
+        src = r[0];
+        b = 0x2dae;
+        WR16(b, src);
+    }
+    // 1190: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1192: jsr pc, *$142e
+    {
+        a = 0x142e;
+        r[6] -= 2;
+        WR16(r[6], 0x1196);
+    }
+    AOT_GOTO(0x142e, L142e);
+L1196:
+    AOT_BLOCK(0x1196, 7);
+    // 1196: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1198: mov 2dae, r0
+    {
+        a = 0x2dae;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 119c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 119e: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 11a0: add $80, r0
+    {
+        src = uint16_t(0x0080);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 11a4: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11a6: bhi 116a
+    if (!(C | Z))
+        AOT_GOTO(0x116a, L116a);
+    AOT_GOTO(0x11a8, L11a8);
+L11a8:
+    AOT_BLOCK(0x11a8, 4);
+    // 11a8: mov 2dae, r0
+    {
+        a = 0x2dae;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11ac: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 11ae: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11b0: jsr pc, *$142e
+    {
+        a = 0x142e;
+        r[6] -= 2;
+        WR16(r[6], 0x11b4);
+    }
+    AOT_GOTO(0x142e, L142e);
+L11b4:
+    AOT_BLOCK(0x11b4, 3);
+    // 11b4: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 11b6: cmp $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11ba: beq 116a
+    if (Z)
+        AOT_GOTO(0x116a, L116a);
+    AOT_GOTO(0x11bc, L11bc);
+L11bc:
+    AOT_BLOCK(0x11bc, 5);
+    // 11bc: mov r3, *2daa
+    {
+        src = r[3];
+        b = RD16(0x2daa);
+        WR16(b, src);
+    }
+    // 11c0: mov 2daa, r0
+    {
+        a = 0x2daa;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11c4: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 11c8: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11ca: beq 11d6
+    if (Z)
+        AOT_GOTO(0x11d6, L11d6);
+    AOT_GOTO(0x11cc, L11cc);
+L11cc:
+    AOT_BLOCK(0x11cc, 3);
+    // 11cc: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 11ce: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 11d2: mov r0, *2daa
+    {
+        src = r[0];
+        b = RD16(0x2daa);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x11d6, L11d6);
+L11d6:
+    AOT_BLOCK(0x11d6, 10);
+    // 11d6: mov 2dae, r0
+    {
+        a = 0x2dae;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11da: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 11dc: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 11de: add $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 11e2: mov r0, (r3)
+    {
+        src = r[0];
+        b = r[3];
+        WR16(b, src);
+    }
+    // 11e4: mov r0, 2daa
+    {
+        src = r[0];
+        b = 0x2daa;
+        WR16(b, src);
+    }
+    // 11e8: mov $2da4, r0
+    {
+        src = uint16_t(0x2da4);
+        r[0] = src;
+    }
+    // 11ec: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 11f0: mov r0, *2daa
+    {
+        src = r[0];
+        b = RD16(0x2daa);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11f4: br 1128
+    AOT_GOTO(0x1128, L1128);
+L11f6:
+    AOT_BLOCK(0x11f6, 6);
+    // 11f6: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 11f8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 11fa: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 11fc: mov r0, 2da8
+    {
+        src = r[0];
+        b = 0x2da8;
+        WR16(b, src);
+    }
+    // 1200: cmp r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1202: bcc 120e
+    if (!C)
+        AOT_GOTO(0x120e, L120e);
+    AOT_GOTO(0x1204, L1204);
+L1204:
+    AOT_BLOCK(0x1204, 2);
+    // 1204: mov *2da8, 2dac
+    {
+        a = RD16(0x2da8);
+        src = RD16(a);
+        b = 0x2dac;
+        WR16(b, src);
+    }
+    // 120a: mov (r4), *2da8
+    {
+        a = r[4];
+        src = RD16(a);
+        b = RD16(0x2da8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x120e, L120e);
+L120e:
+    AOT_BLOCK(0x120e, 6);
+    // 120e: mov 2da8, r0
+    {
+        a = 0x2da8;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1212: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 1216: mov r0, (r4)
+    {
+        src = r[0];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 1218: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 121a: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 121e: br 116c
+    AOT_GOTO(0x116c, L116c);
+L1220:
+    AOT_BLOCK(0x1220, 11);
+    // 1220: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1224;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 1224: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1228: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 122a: sub $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        C = dst < src;
+    }
+    // 122e: mov r3, 2da8
+    {
+        src = r[3];
+        b = 0x2da8;
+        WR16(b, src);
+    }
+    // 1232: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1234: bic $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1238: mov r0, (r3)
+    {
+        src = r[0];
+        b = r[3];
+        WR16(b, src);
+    }
+    // 123a: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12e8:
+    AOT_BLOCK(0x12e8, 7);
+    // 12e8: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x12ec;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 12ec: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 12f0: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 12f2: add $fff4, (sp)
+    {
+        src = uint16_t(0xfff4);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 12f6: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12fa: jsr pc, *$132a
+    {
+        a = 0x132a;
+        r[6] -= 2;
+        WR16(r[6], 0x12fe);
+    }
+    AOT_GOTO(0x132a, L132a);
+L12fe:
+    AOT_BLOCK(0x12fe, 3);
+    // 12fe: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1300: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1302: bge 130a
+    if (!(N ^ V))
+        AOT_GOTO(0x130a, L130a);
+    AOT_GOTO(0x1304, L1304);
+L1304:
+    AOT_BLOCK(0x1304, 1);
+    // 1304: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1306, L1306);
+L1306:
+    AOT_BLOCK(0x1306, 2);
+    // 1306: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L130a:
+    AOT_BLOCK(0x130a, 2);
+    // 130a: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 130e: br 1306
+    AOT_GOTO(0x1306, L1306);
+L132a:
+    AOT_BLOCK(0x132a, 5);
+    // 132a: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x132e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 132e: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1332: mov $7408, -(sp)
+    {
+        src = uint16_t(0x7408);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1336: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x133a, L133a);
+L1338:
+    // 1338: iot
+    AOT_INTERP(0x1338);
+L133a:
+    AOT_BLOCK(0x133a, 1);
+    // 133a: jsr pc, *$1408
+    {
+        a = 0x1408;
+        r[6] -= 2;
+        WR16(r[6], 0x133e);
+    }
+    AOT_GOTO(0x1408, L1408);
+L133e:
+    AOT_BLOCK(0x133e, 3);
+    // 133e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1340: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1344:
+    AOT_BLOCK(0x1344, 5);
+    // 1344: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1348;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 1348: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 134c: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1350: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1352, L1352);
+L1352:
+    AOT_BLOCK(0x1352, 2);
+    // 1352: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1354: bne 1352
+    if (!Z)
+        AOT_GOTO(0x1352, L1352);
+    AOT_GOTO(0x1356, L1356);
+L1356:
+    AOT_BLOCK(0x1356, 1);
+    // 1356: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x1358, L1358);
+L1358:
+    AOT_BLOCK(0x1358, 1);
+    // 1358: movb (r3)+, (r4)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x135a, L135a);
+L135a:
+    AOT_BLOCK(0x135a, 1);
+    // 135a: bne 1358
+    if (!Z)
+        AOT_GOTO(0x1358, L1358);
+    AOT_GOTO(0x135c, L135c);
+L135c:
+    AOT_BLOCK(0x135c, 3);
+    // 135c: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 135e: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1362:
+    AOT_BLOCK(0x1362, 5);
+    // 1362: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1366;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 1366: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 136a: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 136e: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1370, L1370);
+L1370:
+    AOT_BLOCK(0x1370, 2);
+    // 1370: movb (r3)+, (r4)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1372: bne 1370
+    if (!Z)
+        AOT_GOTO(0x1370, L1370);
+    AOT_GOTO(0x1374, L1374);
+L1374:
+    AOT_BLOCK(0x1374, 3);
+    // 1374: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 1376: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L137a:
+    AOT_BLOCK(0x137a, 5);
+    // 137a: jsr r5, 15a2
+    {
+        a = 0x15a2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x137e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    // 137e: mov 4(r5), 2340
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x2340;
+        WR16(b, src);
+    }
+    // 1384: mov 6(r5), 2342
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x2342;
+        WR16(b, src);
+    }
+    // 138a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 138c: sys 0
+    AOT_INTERP(0x138c);
+L138e:
+    AOT_BLOCK(0x138e, 1);
+    // 138e: cmp (r4), *-79fc(sp)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = RD16(r[6] + -31228);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1392, L1392);
+L1390:
+    AOT_BLOCK(0x1390, 1);
+    // 1390: bcc 139a
+    if (!C)
+        AOT_GOTO(0x139a, L139a);
+    AOT_GOTO(0x1392, L1392);
+L1392:
+    AOT_BLOCK(0x1392, 1);
+    // 1392: mov r0, 2da0
+    {
+        src = r[0];
+        b = 0x2da0;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1396, L1396);
+L1394:
+    AOT_BLOCK(0x1394, 1);
+    // 1394: mov *-(r0), (r2)
+    {
+        r[0] -= 2;
+        a = RD16(r[0]);
+        src = RD16(a);
+        b = r[2];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1396, L1396);
+L1396:
+    AOT_BLOCK(0x1396, 1);
+    // 1396: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x139a, L139a);
+L139a:
+    AOT_BLOCK(0x139a, 2);
+    // 139a: jmp 15ae
+    {
+        a = 0x15ae;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L139e:
+    AOT_BLOCK(0x139e, 3);
+    // 139e: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13a0: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 13a2: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13a6: sys 6
+    AOT_INTERP(0x13a6);
+L13a8:
+    AOT_BLOCK(0x13a8, 1);
+    // 13a8: bcc 13ae
+    if (!C)
+        AOT_GOTO(0x13ae, L13ae);
+    AOT_GOTO(0x13aa, L13aa);
+L13aa:
+    AOT_BLOCK(0x13aa, 1);
+    // 13aa: jmp 1594
+    {
+        a = 0x1594;
+    }
+    AOT_GOTO(0x1594, L1594);
+L13ac:
+    AOT_BLOCK(0x13ac, 1);
+    // 13ac: br 137a
+    AOT_GOTO(0x137a, L137a);
+L13ae:
+    AOT_BLOCK(0x13ae, 1);
+    // 13ae: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x13b0, L13b0);
+L13b0:
+    AOT_BLOCK(0x13b0, 2);
+    // 13b0: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13b2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13b4:
+    AOT_BLOCK(0x13b4, 4);
+    // 13b4: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13b6: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 13b8: mov 4(r5), 2346
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x2346;
+        WR16(b, src);
+    }
+    // 13be: mov 6(r5), 2348
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x2348;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13c4: sys 0
+    AOT_INTERP(0x13c4);
+L13c6:
+    AOT_BLOCK(0x13c6, 1);
+    // 13c6: cmp (r5), r4
+    {
+        a = r[5];
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x13c8, L13c8);
+L13c8:
+    AOT_BLOCK(0x13c8, 1);
+    // 13c8: bcc 13ce
+    if (!C)
+        AOT_GOTO(0x13ce, L13ce);
+    AOT_GOTO(0x13ca, L13ca);
+L13ca:
+    AOT_BLOCK(0x13ca, 1);
+    // 13ca: jmp 1594
+    {
+        a = 0x1594;
+    }
+    AOT_GOTO(0x1594, L1594);
+L13cc:
+    AOT_BLOCK(0x13cc, 1);
+    // 13cc: br 135a
+    AOT_GOTO(0x135a, L135a);
+L13ce:
+    AOT_BLOCK(0x13ce, 2);
+    // 13ce: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13d0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13d2:
+    AOT_BLOCK(0x13d2, 5);
+    // 13d2: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13d4: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 13d6: mov 4(r5), 234c
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x234c;
+        WR16(b, src);
+    }
+    // 13dc: mov 6(r5), 234e
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x234e;
+        WR16(b, src);
+    }
+    // 13e2: mov 2da2, 2350
+    {
+        a = 0x2da2;
+        src = RD16(a);
+        b = 0x2350;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13e8: sys 0
+    AOT_INTERP(0x13e8);
+L13ea:
+    AOT_BLOCK(0x13ea, 1);
+    // 13ea: cmp (r5), (r2)
+    {
+        a = r[5];
+        src = RD16(a);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x13ec, L13ec);
+L13ec:
+    AOT_BLOCK(0x13ec, 1);
+    // 13ec: jmp 1594
+    {
+        a = 0x1594;
+    }
+    AOT_GOTO(0x1594, L1594);
+L13ee:
+    AOT_BLOCK(0x13ee, 1);
+    // 13ee: br 1338
+    AOT_GOTO(0x1338, L1338);
+L13f0:
+    AOT_BLOCK(0x13f0, 1);
+    // 13f0: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x13f2, L13f2);
+L13f2:
+    AOT_BLOCK(0x13f2, 1);
+    // 13f2: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13f4: sys 2
+    AOT_INTERP(0x13f4);
+L13f6:
+    AOT_BLOCK(0x13f6, 1);
+    // 13f6: br 13fe
+    AOT_GOTO(0x13fe, L13fe);
+L13f8:
+    AOT_BLOCK(0x13f8, 1);
+    // 13f8: bcc 1404
+    if (!C)
+        AOT_GOTO(0x1404, L1404);
+    AOT_GOTO(0x13fa, L13fa);
+L13fa:
+    AOT_BLOCK(0x13fa, 1);
+    // 13fa: jmp 1594
+    {
+        a = 0x1594;
+    }
+    AOT_GOTO(0x1594, L1594);
+L13fc:
+    AOT_BLOCK(0x13fc, 1);
+    // 13fc: br 132a
+    AOT_GOTO(0x132a, L132a);
+L13fe:
+    AOT_BLOCK(0x13fe, 2);
+    // 13fe: mov r0, 2db0
+    {
+        src = r[0];
+        b = 0x2db0;
+        WR16(b, src);
+    }
+    // 1402: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1404, L1404);
+L1404:
+    AOT_BLOCK(0x1404, 2);
+    // 1404: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1406: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1408:
+    AOT_BLOCK(0x1408, 5);
+    // 1408: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 140a: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 140c: mov 4(r5), 2354
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x2354;
+        WR16(b, src);
+    }
+    // 1412: mov 6(r5), 2356
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x2356;
+        WR16(b, src);
+    }
+    // 1418: mov 8(r5), 2358
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x2358;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 141e: sys 0
+    AOT_INTERP(0x141e);
+L1420:
+    AOT_BLOCK(0x1420, 1);
+    // 1420: cmp (r5), (r2)+
+    {
+        a = r[5];
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1422, L1422);
+L1422:
+    AOT_BLOCK(0x1422, 1);
+    // 1422: bcc 1428
+    if (!C)
+        AOT_GOTO(0x1428, L1428);
+    AOT_GOTO(0x1424, L1424);
+L1424:
+    AOT_BLOCK(0x1424, 1);
+    // 1424: jmp 1594
+    {
+        a = 0x1594;
+    }
+    AOT_GOTO(0x1594, L1594);
+L1426:
+    AOT_BLOCK(0x1426, 1);
+    // 1426: br 1500
+    AOT_GOTO(0x1500, L1500);
+L1428:
+    AOT_BLOCK(0x1428, 3);
+    // 1428: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+    }
+    // 142a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 142c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L142e:
+    AOT_BLOCK(0x142e, 4);
+    // 142e: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1430: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1432: mov 4(r5), 235c
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x235c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1438: beq 144a
+    if (Z)
+        AOT_GOTO(0x144a, L144a);
+    AOT_GOTO(0x143a, L143a);
+L143a:
+    AOT_BLOCK(0x143a, 1);
+    // 143a: add 235e, 235c
+    {
+        a = 0x235e;
+        src = RD16(a);
+        b = 0x235c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1440: sys 0
+    AOT_INTERP(0x1440);
+L1442:
+    AOT_BLOCK(0x1442, 1);
+    // 1442: cmp (r5), *(r2)+
+    {
+        a = r[5];
+        src = RD16(a);
+        b = RD16(r[2]);
+        r[2] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1444, L1444);
+L1444:
+    AOT_BLOCK(0x1444, 1);
+    // 1444: bcc 144a
+    if (!C)
+        AOT_GOTO(0x144a, L144a);
+    AOT_GOTO(0x1446, L1446);
+L1446:
+    AOT_BLOCK(0x1446, 1);
+    // 1446: jmp 1594
+    {
+        a = 0x1594;
+    }
+    AOT_GOTO(0x1594, L1594);
+L1448:
+    AOT_BLOCK(0x1448, 1);
+    // 1448: br 14de
+    AOT_GOTO(0x14de, L14de);
+L144a:
+    AOT_BLOCK(0x144a, 4);
+    // 144a: mov 235e, r0
+    {
+        a = 0x235e;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 144e: add 4(r5), 235e
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x235e;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1454: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1456: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1478:
+    AOT_BLOCK(0x1478, 5);
+    // 1478: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 147a: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 147c: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1480: cmp r1, $14
+    {
+        src = r[1];
+        dst = uint16_t(0x0014);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1484: bcc 14c2
+    if (!C)
+        AOT_GOTO(0x14c2, L14c2);
+    AOT_GOTO(0x1486, L1486);
+L1486:
+    AOT_BLOCK(0x1486, 7);
+    // 1486: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 148a: mov r1, 2362
+    {
+        src = r[1];
+        b = 0x2362;
+        WR16(b, src);
+    }
+    // 148e: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1490: mov 2db2(r1), -(sp)
+    {
+        a = uint16_t(r[1] + 11698);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1494: mov r0, 2db2(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 11698);
+        WR16(b, src);
+    }
+    // 1498: mov r0, 2364
+    {
+        src = r[0];
+        b = 0x2364;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 149c: beq 14ae
+    if (Z)
+        AOT_GOTO(0x14ae, L14ae);
+    AOT_GOTO(0x149e, L149e);
+L149e:
+    AOT_BLOCK(0x149e, 2);
+    // 149e: bit $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 14a2: bne 14ae
+    if (!Z)
+        AOT_GOTO(0x14ae, L14ae);
+    AOT_GOTO(0x14a4, L14a4);
+L14a4:
+    AOT_BLOCK(0x14a4, 3);
+    // 14a4: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 14a6: add $14ca, r1
+    {
+        src = uint16_t(0x14ca);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 14aa: mov r1, 2364
+    {
+        src = r[1];
+        b = 0x2364;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14ae, L14ae);
+L14ae:
+    // 14ae: sys 0
+    AOT_INTERP(0x14ae);
+L14b0:
+    AOT_BLOCK(0x14b0, 1);
+    // 14b0: cmp (r5), -(r0)
+    {
+        a = r[5];
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x14b2, L14b2);
+L14b2:
+    AOT_BLOCK(0x14b2, 1);
+    // 14b2: bcs 14c6
+    if (C)
+        AOT_GOTO(0x14c6, L14c6);
+    AOT_GOTO(0x14b4, L14b4);
+L14b4:
+    AOT_BLOCK(0x14b4, 1);
+    // 14b4: bit $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x14b8, L14b8);
+L14b6:
+    // 14b6: wait
+    AOT_INTERP(0x14b6);
+L14b8:
+    AOT_BLOCK(0x14b8, 1);
+    // 14b8: beq 14bc
+    if (Z)
+        AOT_GOTO(0x14bc, L14bc);
+    AOT_GOTO(0x14ba, L14ba);
+L14ba:
+    AOT_BLOCK(0x14ba, 1);
+    // 14ba: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14bc, L14bc);
+L14bc:
+    AOT_BLOCK(0x14bc, 3);
+    // 14bc: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 14be: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14c0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L14c2:
+    AOT_BLOCK(0x14c2, 1);
+    // 14c2: mov $16, r0
+    {
+        src = uint16_t(0x0016);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14c6, L14c6);
+L14c6:
+    AOT_BLOCK(0x14c6, 1);
+    // 14c6: jmp 1594
+    {
+        a = 0x1594;
+    }
+    AOT_GOTO(0x1594, L1594);
+L14de:
+    AOT_BLOCK(0x14de, 1);
+    // 14de: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x14e2;
+    }
+    AOT_GOTO(0x151a, L151a);
+L14e2:
+    AOT_BLOCK(0x14e2, 1);
+    // 14e2: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x14e6;
+    }
+    AOT_GOTO(0x151a, L151a);
+L14e6:
+    AOT_BLOCK(0x14e6, 1);
+    // 14e6: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x14ea;
+    }
+    AOT_GOTO(0x151a, L151a);
+L14ea:
+    AOT_BLOCK(0x14ea, 1);
+    // 14ea: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x14ee;
+    }
+    AOT_GOTO(0x151a, L151a);
+L14ee:
+    AOT_BLOCK(0x14ee, 1);
+    // 14ee: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x14f2;
+    }
+    AOT_GOTO(0x151a, L151a);
+L14f2:
+    AOT_BLOCK(0x14f2, 1);
+    // 14f2: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x14f6;
+    }
+    AOT_GOTO(0x151a, L151a);
+L14f6:
+    AOT_BLOCK(0x14f6, 1);
+    // 14f6: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x14fa;
+    }
+    AOT_GOTO(0x151a, L151a);
+L14fa:
+    AOT_BLOCK(0x14fa, 1);
+    // 14fa: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x14fe;
+    }
+    AOT_GOTO(0x151a, L151a);
+L14fe:
+    AOT_BLOCK(0x14fe, 1);
+    // 14fe: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x1502;
+    }
+    AOT_GOTO(0x151a, L151a);
+L1500:
+    // 1500: (undefined)
+    AOT_INTERP(0x1500);
+L1502:
+    AOT_BLOCK(0x1502, 1);
+    // 1502: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x1506;
+    }
+    AOT_GOTO(0x151a, L151a);
+L1506:
+    AOT_BLOCK(0x1506, 1);
+    // 1506: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x150a;
+    }
+    AOT_GOTO(0x151a, L151a);
+L150a:
+    AOT_BLOCK(0x150a, 1);
+    // 150a: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x150e;
+    }
+    AOT_GOTO(0x151a, L151a);
+L150e:
+    AOT_BLOCK(0x150e, 1);
+    // 150e: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x1512;
+    }
+    AOT_GOTO(0x151a, L151a);
+L1512:
+    AOT_BLOCK(0x1512, 1);
+    // 1512: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x1516;
+    }
+    AOT_GOTO(0x151a, L151a);
+L1516:
+    AOT_BLOCK(0x1516, 1);
+    // 1516: jsr r0, 151a
+    {
+        a = 0x151a;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x151a;
+    }
+    AOT_GOTO(0x151a, L151a);
+L151a:
+    AOT_BLOCK(0x151a, 9);
+    // 151a: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 151c: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 151e: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1520: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1522: sub $14ce, r0
+    {
+        src = uint16_t(0x14ce);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1526: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+    }
+    // 1528: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 152a: asr (sp)
+    {
+        a = r[6];
+        src = RD16(a);
+        val = int16_t(src) >> 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 1) != 0;
+        V = (val < 0) != ((src & 1) != 0);
+    }
+    // 152c: jsr pc, *2db2(r0)
+    {
+        a = RD16(r[0] + 11698);
+        r[6] -= 2;
+        WR16(r[6], 0x1530);
+    }
+    AOT_JUMP(a);
+L1530:
+    AOT_BLOCK(0x1530, 6);
+    // 1530: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1532: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1534: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1536: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1538: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 153a: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 153c: rtt
+    AOT_INTERP(0x153c);
+L153e:
+    AOT_BLOCK(0x153e, 3);
+    // 153e: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1540: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1542: mov 4(r5), 2368
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x2368;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1548: sys 0
+    AOT_INTERP(0x1548);
+L154a:
+    AOT_BLOCK(0x154a, 1);
+    // 154a: cmp (r5), -(sp)
+    {
+        a = r[5];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x154c, L154c);
+L154c:
+    AOT_BLOCK(0x154c, 1);
+    // 154c: bcc 1552
+    if (!C)
+        AOT_GOTO(0x1552, L1552);
+    AOT_GOTO(0x154e, L154e);
+L154e:
+    AOT_BLOCK(0x154e, 1);
+    // 154e: jmp 1594
+    {
+        a = 0x1594;
+    }
+    AOT_GOTO(0x1594, L1594);
+L1550:
+    // 1550: jmp r2
+    AOT_INTERP(0x1550);
+L1552:
+    AOT_BLOCK(0x1552, 3);
+    // 1552: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 1554: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1556: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1558:
+    AOT_BLOCK(0x1558, 2);
+    // 1558: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 155a: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 155c: sys 7
+    AOT_INTERP(0x155c);
+L155e:
+    AOT_BLOCK(0x155e, 1);
+    // 155e: bcc 1564
+    if (!C)
+        AOT_GOTO(0x1564, L1564);
+    AOT_GOTO(0x1560, L1560);
+L1560:
+    AOT_BLOCK(0x1560, 1);
+    // 1560: jmp 1594
+    {
+        a = 0x1594;
+    }
+    AOT_GOTO(0x1594, L1594);
+L1562:
+    // 1562: (undefined)
+    AOT_INTERP(0x1562);
+L1564:
+    AOT_BLOCK(0x1564, 1);
+    // 1564: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1568, L1568);
+L1566:
+    // 1566: iot
+    AOT_INTERP(0x1566);
+L1568:
+    AOT_BLOCK(0x1568, 1);
+    // 1568: beq 156e
+    if (Z)
+        AOT_GOTO(0x156e, L156e);
+    AOT_GOTO(0x156a, L156a);
+L156a:
+    AOT_BLOCK(0x156a, 1);
+    // 156a: mov r1, *4(r5)
+    {
+        src = r[1];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x156e, L156e);
+L156e:
+    AOT_BLOCK(0x156e, 2);
+    // 156e: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1570: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1572:
+    AOT_BLOCK(0x1572, 5);
+    // 1572: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1574: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 1576: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 157a: mov 6(r5), 236c
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x236c;
+        WR16(b, src);
+    }
+    // 1580: mov 8(r5), 236e
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x236e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1586: sys 0
+    AOT_INTERP(0x1586);
+L1588:
+    AOT_BLOCK(0x1588, 1);
+    // 1588: cmp (r5), *-(r2)
+    {
+        a = r[5];
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x158a, L158a);
+L158a:
+    AOT_BLOCK(0x158a, 1);
+    // 158a: bcc 1590
+    if (!C)
+        AOT_GOTO(0x1590, L1590);
+    AOT_GOTO(0x158c, L158c);
+L158c:
+    AOT_BLOCK(0x158c, 1);
+    // 158c: jmp 1594
+    {
+        a = 0x1594;
+    }
+    AOT_GOTO(0x1594, L1594);
+L158e:
+    // 158e: iot
+    AOT_INTERP(0x158e);
+L1590:
+    AOT_BLOCK(0x1590, 2);
+    // 1590: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1592: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1594:
+    AOT_BLOCK(0x1594, 5);
+    // 1594: mov r0, 2da0
+    {
+        src = r[0];
+        b = 0x2da0;
+        WR16(b, src);
+    }
+    // 1598: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+    }
+    // 159c: mov r5, sp
+    {
+        src = r[5];
+        r[6] = src;
+    }
+    // 159e: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15a0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L15a2:
+    AOT_BLOCK(0x15a2, 1);
+    // csv
+    {
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x15ae);
+    }
+    AOT_JUMP(r[0]);
+L15ae:
+    AOT_BLOCK(0x15ae, 1);
+    // cret
+    {
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("v7/bin/cc", 0x0000, 5568, 0x60319313u, run);
+}
@@ -0,0 +1,25345 @@
+// v7/bin/ld translated by 7aot: 1064 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x000a: goto L000a;
+        case 0x001a: goto L001a;
+        case 0x001e: goto L001e;
+        case 0x0024: goto L0024;
+        case 0x0026: goto L0026;
+        case 0x0032: goto L0032;
+        case 0x003a: goto L003a;
+        case 0x003c: goto L003c;
+        case 0x003e: goto L003e;
+        case 0x0040: goto L0040;
+        case 0x0042: goto L0042;
+        case 0x0044: goto L0044;
+        case 0x0048: goto L0048;
+        case 0x004c: goto L004c;
+        case 0x004e: goto L004e;
+        case 0x0054: goto L0054;
+        case 0x0064: goto L0064;
+        case 0x0066: goto L0066;
+        case 0x006e: goto L006e;
+        case 0x0072: goto L0072;
+        case 0x0086: goto L0086;
+        case 0x008e: goto L008e;
+        case 0x009a: goto L009a;
+        case 0x009c: goto L009c;
+        case 0x00a8: goto L00a8;
+        case 0x00b0: goto L00b0;
+        case 0x00bc: goto L00bc;
+        case 0x00be: goto L00be;
+        case 0x00c6: goto L00c6;
+        case 0x00ce: goto L00ce;
+        case 0x00e2: goto L00e2;
+        case 0x00e8: goto L00e8;
+        case 0x00f4: goto L00f4;
+        case 0x00f6: goto L00f6;
+        case 0x010a: goto L010a;
+        case 0x010e: goto L010e;
+        case 0x0112: goto L0112;
+        case 0x011a: goto L011a;
+        case 0x011e: goto L011e;
+        case 0x0132: goto L0132;
+        case 0x013a: goto L013a;
+        case 0x0146: goto L0146;
+        case 0x0148: goto L0148;
+        case 0x0158: goto L0158;
+        case 0x015c: goto L015c;
+        case 0x0162: goto L0162;
+        case 0x0176: goto L0176;
+        case 0x017c: goto L017c;
+        case 0x0182: goto L0182;
+        case 0x0188: goto L0188;
+        case 0x0192: goto L0192;
+        case 0x019c: goto L019c;
+        case 0x019e: goto L019e;
+        case 0x01a8: goto L01a8;
+        case 0x01aa: goto L01aa;
+        case 0x01b2: goto L01b2;
+        case 0x01ba: goto L01ba;
+        case 0x01c6: goto L01c6;
+        case 0x01c8: goto L01c8;
+        case 0x01d6: goto L01d6;
+        case 0x01e0: goto L01e0;
+        case 0x01ec: goto L01ec;
+        case 0x01ee: goto L01ee;
+        case 0x01f6: goto L01f6;
+        case 0x0210: goto L0210;
+        case 0x021c: goto L021c;
+        case 0x0222: goto L0222;
+        case 0x0228: goto L0228;
+        case 0x0232: goto L0232;
+        case 0x0238: goto L0238;
+        case 0x023e: goto L023e;
+        case 0x0244: goto L0244;
+        case 0x024a: goto L024a;
+        case 0x0250: goto L0250;
+        case 0x0256: goto L0256;
+        case 0x025c: goto L025c;
+        case 0x0268: goto L0268;
+        case 0x026c: goto L026c;
+        case 0x0272: goto L0272;
+        case 0x0278: goto L0278;
+        case 0x027c: goto L027c;
+        case 0x0284: goto L0284;
+        case 0x028a: goto L028a;
+        case 0x0290: goto L0290;
+        case 0x0296: goto L0296;
+        case 0x029e: goto L029e;
+        case 0x02a4: goto L02a4;
+        case 0x02aa: goto L02aa;
+        case 0x02ae: goto L02ae;
+        case 0x02b4: goto L02b4;
+        case 0x02bc: goto L02bc;
+        case 0x02c8: goto L02c8;
+        case 0x02ca: goto L02ca;
+        case 0x02d8: goto L02d8;
+        case 0x02de: goto L02de;
+        case 0x02e8: goto L02e8;
+        case 0x02ec: goto L02ec;
+        case 0x02f6: goto L02f6;
+        case 0x02fc: goto L02fc;
+        case 0x0302: goto L0302;
+        case 0x0308: goto L0308;
+        case 0x0310: goto L0310;
+        case 0x031c: goto L031c;
+        case 0x031e: goto L031e;
+        case 0x0332: goto L0332;
+        case 0x0338: goto L0338;
+        case 0x033c: goto L033c;
+        case 0x0342: goto L0342;
+        case 0x0344: goto L0344;
+        case 0x034a: goto L034a;
+        case 0x034c: goto L034c;
+        case 0x0352: goto L0352;
+        case 0x0356: goto L0356;
+        case 0x0362: goto L0362;
+        case 0x0368: goto L0368;
+        case 0x0378: goto L0378;
+        case 0x037c: goto L037c;
+        case 0x0394: goto L0394;
+        case 0x03a4: goto L03a4;
+        case 0x03ae: goto L03ae;
+        case 0x03b0: goto L03b0;
+        case 0x03b6: goto L03b6;
+        case 0x03bc: goto L03bc;
+        case 0x03c2: goto L03c2;
+        case 0x03c8: goto L03c8;
+        case 0x03ce: goto L03ce;
+        case 0x03d4: goto L03d4;
+        case 0x03da: goto L03da;
+        case 0x03dc: goto L03dc;
+        case 0x03e4: goto L03e4;
+        case 0x03f0: goto L03f0;
+        case 0x03f8: goto L03f8;
+        case 0x03fe: goto L03fe;
+        case 0x0408: goto L0408;
+        case 0x0410: goto L0410;
+        case 0x041a: goto L041a;
+        case 0x041c: goto L041c;
+        case 0x0422: goto L0422;
+        case 0x042a: goto L042a;
+        case 0x0434: goto L0434;
+        case 0x0444: goto L0444;
+        case 0x0446: goto L0446;
+        case 0x044a: goto L044a;
+        case 0x044c: goto L044c;
+        case 0x0452: goto L0452;
+        case 0x0456: goto L0456;
+        case 0x045a: goto L045a;
+        case 0x04b4: goto L04b4;
+        case 0x0506: goto L0506;
+        case 0x0514: goto L0514;
+        case 0x051a: goto L051a;
+        case 0x051e: goto L051e;
+        case 0x0530: goto L0530;
+        case 0x0536: goto L0536;
+        case 0x053c: goto L053c;
+        case 0x0546: goto L0546;
+        case 0x054a: goto L054a;
+        case 0x0552: goto L0552;
+        case 0x0556: goto L0556;
+        case 0x0560: goto L0560;
+        case 0x056c: goto L056c;
+        case 0x0572: goto L0572;
+        case 0x0596: goto L0596;
+        case 0x05a8: goto L05a8;
+        case 0x05b6: goto L05b6;
+        case 0x05c2: goto L05c2;
+        case 0x05c4: goto L05c4;
+        case 0x05d4: goto L05d4;
+        case 0x05ee: goto L05ee;
+        case 0x05f0: goto L05f0;
+        case 0x05f4: goto L05f4;
+        case 0x05f8: goto L05f8;
+        case 0x060e: goto L060e;
+        case 0x0618: goto L0618;
+        case 0x063e: goto L063e;
+        case 0x064a: goto L064a;
+        case 0x0650: goto L0650;
+        case 0x0654: goto L0654;
+        case 0x0678: goto L0678;
+        case 0x0690: goto L0690;
+        case 0x069a: goto L069a;
+        case 0x06b0: goto L06b0;
+        case 0x06b4: goto L06b4;
+        case 0x06c0: goto L06c0;
+        case 0x06dc: goto L06dc;
+        case 0x06e4: goto L06e4;
+        case 0x06f8: goto L06f8;
+        case 0x06fe: goto L06fe;
+        case 0x0712: goto L0712;
+        case 0x0724: goto L0724;
+        case 0x072a: goto L072a;
+        case 0x073c: goto L073c;
+        case 0x075a: goto L075a;
+        case 0x075c: goto L075c;
+        case 0x0760: goto L0760;
+        case 0x0768: goto L0768;
+        case 0x0770: goto L0770;
+        case 0x0772: goto L0772;
+        case 0x0776: goto L0776;
+        case 0x077c: goto L077c;
+        case 0x079e: goto L079e;
+        case 0x07a0: goto L07a0;
+        case 0x07a6: goto L07a6;
+        case 0x07b2: goto L07b2;
+        case 0x07b4: goto L07b4;
+        case 0x07bc: goto L07bc;
+        case 0x07d0: goto L07d0;
+        case 0x0802: goto L0802;
+        case 0x080e: goto L080e;
+        case 0x0810: goto L0810;
+        case 0x0812: goto L0812;
+        case 0x0816: goto L0816;
+        case 0x0844: goto L0844;
+        case 0x084a: goto L084a;
+        case 0x0856: goto L0856;
+        case 0x0866: goto L0866;
+        case 0x0874: goto L0874;
+        case 0x087a: goto L087a;
+        case 0x0882: goto L0882;
+        case 0x0888: goto L0888;
+        case 0x0890: goto L0890;
+        case 0x0898: goto L0898;
+        case 0x089c: goto L089c;
+        case 0x08a0: goto L08a0;
+        case 0x08a6: goto L08a6;
+        case 0x08aa: goto L08aa;
+        case 0x08b6: goto L08b6;
+        case 0x08be: goto L08be;
+        case 0x08c6: goto L08c6;
+        case 0x08c8: goto L08c8;
+        case 0x08ce: goto L08ce;
+        case 0x08d6: goto L08d6;
+        case 0x08e0: goto L08e0;
+        case 0x08e6: goto L08e6;
+        case 0x08ec: goto L08ec;
+        case 0x08f2: goto L08f2;
+        case 0x08f8: goto L08f8;
+        case 0x0908: goto L0908;
+        case 0x091e: goto L091e;
+        case 0x0934: goto L0934;
+        case 0x094a: goto L094a;
+        case 0x0958: goto L0958;
+        case 0x0960: goto L0960;
+        case 0x0964: goto L0964;
+        case 0x0974: goto L0974;
+        case 0x0990: goto L0990;
+        case 0x099c: goto L099c;
+        case 0x09a8: goto L09a8;
+        case 0x09c0: goto L09c0;
+        case 0x09c4: goto L09c4;
+        case 0x09c8: goto L09c8;
+        case 0x09d0: goto L09d0;
+        case 0x09d6: goto L09d6;
+        case 0x09dc: goto L09dc;
+        case 0x09e2: goto L09e2;
+        case 0x09e8: goto L09e8;
+        case 0x09f0: goto L09f0;
+        case 0x09f6: goto L09f6;
+        case 0x0a08: goto L0a08;
+        case 0x0a12: goto L0a12;
+        case 0x0a18: goto L0a18;
+        case 0x0a28: goto L0a28;
+        case 0x0a3a: goto L0a3a;
+        case 0x0a4c: goto L0a4c;
+        case 0x0a52: goto L0a52;
+        case 0x0a56: goto L0a56;
+        case 0x0a5e: goto L0a5e;
+        case 0x0a64: goto L0a64;
+        case 0x0a84: goto L0a84;
+        case 0x0a8a: goto L0a8a;
+        case 0x0a90: goto L0a90;
+        case 0x0a96: goto L0a96;
+        case 0x0a9c: goto L0a9c;
+        case 0x0aa2: goto L0aa2;
+        case 0x0ab2: goto L0ab2;
+        case 0x0abe: goto L0abe;
+        case 0x0ace: goto L0ace;
+        case 0x0ad4: goto L0ad4;
+        case 0x0ad8: goto L0ad8;
+        case 0x0af4: goto L0af4;
+        case 0x0af8: goto L0af8;
+        case 0x0b06: goto L0b06;
+        case 0x0b0c: goto L0b0c;
+        case 0x0b18: goto L0b18;
+        case 0x0b1e: goto L0b1e;
+        case 0x0b24: goto L0b24;
+        case 0x0b2c: goto L0b2c;
+        case 0x0b3a: goto L0b3a;
+        case 0x0b3c: goto L0b3c;
+        case 0x0b42: goto L0b42;
+        case 0x0b4a: goto L0b4a;
+        case 0x0b52: goto L0b52;
+        case 0x0b5a: goto L0b5a;
+        case 0x0b68: goto L0b68;
+        case 0x0b6e: goto L0b6e;
+        case 0x0b74: goto L0b74;
+        case 0x0b78: goto L0b78;
+        case 0x0b88: goto L0b88;
+        case 0x0ba0: goto L0ba0;
+        case 0x0baa: goto L0baa;
+        case 0x0bb2: goto L0bb2;
+        case 0x0bb8: goto L0bb8;
+        case 0x0bc2: goto L0bc2;
+        case 0x0bd0: goto L0bd0;
+        case 0x0bd4: goto L0bd4;
+        case 0x0be0: goto L0be0;
+        case 0x0be4: goto L0be4;
+        case 0x0bf2: goto L0bf2;
+        case 0x0bfc: goto L0bfc;
+        case 0x0c08: goto L0c08;
+        case 0x0c10: goto L0c10;
+        case 0x0c16: goto L0c16;
+        case 0x0c22: goto L0c22;
+        case 0x0c24: goto L0c24;
+        case 0x0c2a: goto L0c2a;
+        case 0x0c36: goto L0c36;
+        case 0x0c44: goto L0c44;
+        case 0x0c46: goto L0c46;
+        case 0x0c4c: goto L0c4c;
+        case 0x0c52: goto L0c52;
+        case 0x0c58: goto L0c58;
+        case 0x0c5e: goto L0c5e;
+        case 0x0c64: goto L0c64;
+        case 0x0c6a: goto L0c6a;
+        case 0x0c6e: goto L0c6e;
+        case 0x0c8a: goto L0c8a;
+        case 0x0c8e: goto L0c8e;
+        case 0x0c9c: goto L0c9c;
+        case 0x0ca6: goto L0ca6;
+        case 0x0cb2: goto L0cb2;
+        case 0x0cbe: goto L0cbe;
+        case 0x0cc2: goto L0cc2;
+        case 0x0cd4: goto L0cd4;
+        case 0x0cd8: goto L0cd8;
+        case 0x0ce2: goto L0ce2;
+        case 0x0ce6: goto L0ce6;
+        case 0x0cea: goto L0cea;
+        case 0x0cfe: goto L0cfe;
+        case 0x0d04: goto L0d04;
+        case 0x0d10: goto L0d10;
+        case 0x0d16: goto L0d16;
+        case 0x0d1a: goto L0d1a;
+        case 0x0d2a: goto L0d2a;
+        case 0x0d30: goto L0d30;
+        case 0x0d36: goto L0d36;
+        case 0x0d3c: goto L0d3c;
+        case 0x0d40: goto L0d40;
+        case 0x0d48: goto L0d48;
+        case 0x0d4a: goto L0d4a;
+        case 0x0d50: goto L0d50;
+        case 0x0d5c: goto L0d5c;
+        case 0x0d68: goto L0d68;
+        case 0x0d70: goto L0d70;
+        case 0x0d8c: goto L0d8c;
+        case 0x0d9a: goto L0d9a;
+        case 0x0d9e: goto L0d9e;
+        case 0x0da4: goto L0da4;
+        case 0x0da6: goto L0da6;
+        case 0x0daa: goto L0daa;
+        case 0x0db0: goto L0db0;
+        case 0x0db6: goto L0db6;
+        case 0x0dbe: goto L0dbe;
+        case 0x0dc6: goto L0dc6;
+        case 0x0dca: goto L0dca;
+        case 0x0ddc: goto L0ddc;
+        case 0x0dec: goto L0dec;
+        case 0x0df6: goto L0df6;
+        case 0x0e0a: goto L0e0a;
+        case 0x0e10: goto L0e10;
+        case 0x0e16: goto L0e16;
+        case 0x0e1e: goto L0e1e;
+        case 0x0e26: goto L0e26;
+        case 0x0e2e: goto L0e2e;
+        case 0x0e32: goto L0e32;
+        case 0x0e46: goto L0e46;
+        case 0x0e98: goto L0e98;
+        case 0x0ea0: goto L0ea0;
+        case 0x0eae: goto L0eae;
+        case 0x0eb4: goto L0eb4;
+        case 0x0ec2: goto L0ec2;
+        case 0x0ed0: goto L0ed0;
+        case 0x0ed6: goto L0ed6;
+        case 0x0ede: goto L0ede;
+        case 0x0ee4: goto L0ee4;
+        case 0x0eea: goto L0eea;
+        case 0x0ef0: goto L0ef0;
+        case 0x0ef8: goto L0ef8;
+        case 0x0f08: goto L0f08;
+        case 0x0f0c: goto L0f0c;
+        case 0x0f10: goto L0f10;
+        case 0x0f14: goto L0f14;
+        case 0x0f20: goto L0f20;
+        case 0x0f22: goto L0f22;
+        case 0x0f2a: goto L0f2a;
+        case 0x0f30: goto L0f30;
+        case 0x0f3c: goto L0f3c;
+        case 0x0f3e: goto L0f3e;
+        case 0x0f4a: goto L0f4a;
+        case 0x0f52: goto L0f52;
+        case 0x0f5a: goto L0f5a;
+        case 0x0f66: goto L0f66;
+        case 0x0f74: goto L0f74;
+        case 0x0f76: goto L0f76;
+        case 0x0f7c: goto L0f7c;
+        case 0x0f90: goto L0f90;
+        case 0x0fa4: goto L0fa4;
+        case 0x0fc0: goto L0fc0;
+        case 0x0fd6: goto L0fd6;
+        case 0x0fe6: goto L0fe6;
+        case 0x1002: goto L1002;
+        case 0x1018: goto L1018;
+        case 0x103a: goto L103a;
+        case 0x1050: goto L1050;
+        case 0x106a: goto L106a;
+        case 0x106e: goto L106e;
+        case 0x1074: goto L1074;
+        case 0x107a: goto L107a;
+        case 0x107e: goto L107e;
+        case 0x1082: goto L1082;
+        case 0x108e: goto L108e;
+        case 0x1092: goto L1092;
+        case 0x1098: goto L1098;
+        case 0x10a2: goto L10a2;
+        case 0x10a8: goto L10a8;
+        case 0x10ae: goto L10ae;
+        case 0x10ba: goto L10ba;
+        case 0x10be: goto L10be;
+        case 0x10c2: goto L10c2;
+        case 0x10ce: goto L10ce;
+        case 0x10d2: goto L10d2;
+        case 0x10d8: goto L10d8;
+        case 0x10e2: goto L10e2;
+        case 0x10f2: goto L10f2;
+        case 0x10f8: goto L10f8;
+        case 0x10fc: goto L10fc;
+        case 0x1102: goto L1102;
+        case 0x1106: goto L1106;
+        case 0x1110: goto L1110;
+        case 0x1118: goto L1118;
+        case 0x1122: goto L1122;
+        case 0x1126: goto L1126;
+        case 0x112c: goto L112c;
+        case 0x1132: goto L1132;
+        case 0x113c: goto L113c;
+        case 0x1148: goto L1148;
+        case 0x116e: goto L116e;
+        case 0x1188: goto L1188;
+        case 0x1192: goto L1192;
+        case 0x1198: goto L1198;
+        case 0x119e: goto L119e;
+        case 0x11ac: goto L11ac;
+        case 0x11b4: goto L11b4;
+        case 0x11be: goto L11be;
+        case 0x11c0: goto L11c0;
+        case 0x11c6: goto L11c6;
+        case 0x11ce: goto L11ce;
+        case 0x11d4: goto L11d4;
+        case 0x11dc: goto L11dc;
+        case 0x11e4: goto L11e4;
+        case 0x11ea: goto L11ea;
+        case 0x11f0: goto L11f0;
+        case 0x11f8: goto L11f8;
+        case 0x11fe: goto L11fe;
+        case 0x1208: goto L1208;
+        case 0x120a: goto L120a;
+        case 0x121a: goto L121a;
+        case 0x1222: goto L1222;
+        case 0x122a: goto L122a;
+        case 0x1230: goto L1230;
+        case 0x1238: goto L1238;
+        case 0x1244: goto L1244;
+        case 0x124c: goto L124c;
+        case 0x1256: goto L1256;
+        case 0x125a: goto L125a;
+        case 0x1266: goto L1266;
+        case 0x1276: goto L1276;
+        case 0x127c: goto L127c;
+        case 0x1282: goto L1282;
+        case 0x128c: goto L128c;
+        case 0x1290: goto L1290;
+        case 0x129e: goto L129e;
+        case 0x12a8: goto L12a8;
+        case 0x12ae: goto L12ae;
+        case 0x12b2: goto L12b2;
+        case 0x12bc: goto L12bc;
+        case 0x12c2: goto L12c2;
+        case 0x12ce: goto L12ce;
+        case 0x12ec: goto L12ec;
+        case 0x12ee: goto L12ee;
+        case 0x12f2: goto L12f2;
+        case 0x1306: goto L1306;
+        case 0x130c: goto L130c;
+        case 0x1310: goto L1310;
+        case 0x1314: goto L1314;
+        case 0x131a: goto L131a;
+        case 0x131e: goto L131e;
+        case 0x1322: goto L1322;
+        case 0x132a: goto L132a;
+        case 0x132e: goto L132e;
+        case 0x1332: goto L1332;
+        case 0x1340: goto L1340;
+        case 0x134a: goto L134a;
+        case 0x134e: goto L134e;
+        case 0x1352: goto L1352;
+        case 0x1396: goto L1396;
+        case 0x139c: goto L139c;
+        case 0x13ac: goto L13ac;
+        case 0x13b2: goto L13b2;
+        case 0x13b6: goto L13b6;
+        case 0x13be: goto L13be;
+        case 0x13c4: goto L13c4;
+        case 0x13ca: goto L13ca;
+        case 0x13d2: goto L13d2;
+        case 0x13d6: goto L13d6;
+        case 0x13fa: goto L13fa;
+        case 0x1410: goto L1410;
+        case 0x141a: goto L141a;
+        case 0x141e: goto L141e;
+        case 0x1426: goto L1426;
+        case 0x1432: goto L1432;
+        case 0x1434: goto L1434;
+        case 0x1456: goto L1456;
+        case 0x145e: goto L145e;
+        case 0x1462: goto L1462;
+        case 0x1470: goto L1470;
+        case 0x1474: goto L1474;
+        case 0x1478: goto L1478;
+        case 0x148a: goto L148a;
+        case 0x1498: goto L1498;
+        case 0x14b2: goto L14b2;
+        case 0x14ba: goto L14ba;
+        case 0x14c0: goto L14c0;
+        case 0x14c6: goto L14c6;
+        case 0x14d2: goto L14d2;
+        case 0x14d4: goto L14d4;
+        case 0x14e2: goto L14e2;
+        case 0x14ee: goto L14ee;
+        case 0x150e: goto L150e;
+        case 0x1516: goto L1516;
+        case 0x151c: goto L151c;
+        case 0x1520: goto L1520;
+        case 0x152a: goto L152a;
+        case 0x153c: goto L153c;
+        case 0x1546: goto L1546;
+        case 0x1576: goto L1576;
+        case 0x157e: goto L157e;
+        case 0x1584: goto L1584;
+        case 0x158c: goto L158c;
+        case 0x1596: goto L1596;
+        case 0x159e: goto L159e;
+        case 0x15aa: goto L15aa;
+        case 0x15ac: goto L15ac;
+        case 0x15e4: goto L15e4;
+        case 0x15ee: goto L15ee;
+        case 0x15fa: goto L15fa;
+        case 0x15fc: goto L15fc;
+        case 0x1604: goto L1604;
+        case 0x160a: goto L160a;
+        case 0x160e: goto L160e;
+        case 0x1620: goto L1620;
+        case 0x162a: goto L162a;
+        case 0x1636: goto L1636;
+        case 0x1648: goto L1648;
+        case 0x164e: goto L164e;
+        case 0x1654: goto L1654;
+        case 0x1656: goto L1656;
+        case 0x165e: goto L165e;
+        case 0x1662: goto L1662;
+        case 0x1666: goto L1666;
+        case 0x1674: goto L1674;
+        case 0x167e: goto L167e;
+        case 0x1684: goto L1684;
+        case 0x1694: goto L1694;
+        case 0x16a8: goto L16a8;
+        case 0x16bc: goto L16bc;
+        case 0x16c0: goto L16c0;
+        case 0x16c6: goto L16c6;
+        case 0x16d0: goto L16d0;
+        case 0x16d6: goto L16d6;
+        case 0x16da: goto L16da;
+        case 0x16e0: goto L16e0;
+        case 0x16e6: goto L16e6;
+        case 0x16f0: goto L16f0;
+        case 0x16f6: goto L16f6;
+        case 0x1706: goto L1706;
+        case 0x1716: goto L1716;
+        case 0x171a: goto L171a;
+        case 0x1724: goto L1724;
+        case 0x172c: goto L172c;
+        case 0x1738: goto L1738;
+        case 0x173a: goto L173a;
+        case 0x176c: goto L176c;
+        case 0x177e: goto L177e;
+        case 0x1782: goto L1782;
+        case 0x178c: goto L178c;
+        case 0x179a: goto L179a;
+        case 0x17a0: goto L17a0;
+        case 0x17a6: goto L17a6;
+        case 0x17ac: goto L17ac;
+        case 0x17b2: goto L17b2;
+        case 0x17b8: goto L17b8;
+        case 0x17be: goto L17be;
+        case 0x17c6: goto L17c6;
+        case 0x17cc: goto L17cc;
+        case 0x17d0: goto L17d0;
+        case 0x17d8: goto L17d8;
+        case 0x17e0: goto L17e0;
+        case 0x17e8: goto L17e8;
+        case 0x17f2: goto L17f2;
+        case 0x17fa: goto L17fa;
+        case 0x1800: goto L1800;
+        case 0x180c: goto L180c;
+        case 0x1814: goto L1814;
+        case 0x1820: goto L1820;
+        case 0x1822: goto L1822;
+        case 0x182a: goto L182a;
+        case 0x1836: goto L1836;
+        case 0x1840: goto L1840;
+        case 0x1844: goto L1844;
+        case 0x184e: goto L184e;
+        case 0x1868: goto L1868;
+        case 0x186c: goto L186c;
+        case 0x1872: goto L1872;
+        case 0x1876: goto L1876;
+        case 0x187a: goto L187a;
+        case 0x1886: goto L1886;
+        case 0x1888: goto L1888;
+        case 0x188c: goto L188c;
+        case 0x18a4: goto L18a4;
+        case 0x18b4: goto L18b4;
+        case 0x18be: goto L18be;
+        case 0x18ca: goto L18ca;
+        case 0x18cc: goto L18cc;
+        case 0x1908: goto L1908;
+        case 0x191a: goto L191a;
+        case 0x191e: goto L191e;
+        case 0x1922: goto L1922;
+        case 0x1924: goto L1924;
+        case 0x1926: goto L1926;
+        case 0x192a: goto L192a;
+        case 0x192e: goto L192e;
+        case 0x1932: goto L1932;
+        case 0x1942: goto L1942;
+        case 0x194a: goto L194a;
+        case 0x194e: goto L194e;
+        case 0x1952: goto L1952;
+        case 0x1956: goto L1956;
+        case 0x1970: goto L1970;
+        case 0x1976: goto L1976;
+        case 0x197a: goto L197a;
+        case 0x1992: goto L1992;
+        case 0x19a0: goto L19a0;
+        case 0x19a6: goto L19a6;
+        case 0x19b2: goto L19b2;
+        case 0x19b4: goto L19b4;
+        case 0x19c8: goto L19c8;
+        case 0x19de: goto L19de;
+        case 0x19e8: goto L19e8;
+        case 0x19ec: goto L19ec;
+        case 0x19f0: goto L19f0;
+        case 0x19f4: goto L19f4;
+        case 0x1a06: goto L1a06;
+        case 0x1a0c: goto L1a0c;
+        case 0x1a10: goto L1a10;
+        case 0x1a16: goto L1a16;
+        case 0x1a1a: goto L1a1a;
+        case 0x1a22: goto L1a22;
+        case 0x1a34: goto L1a34;
+        case 0x1a38: goto L1a38;
+        case 0x1a3c: goto L1a3c;
+        case 0x1a40: goto L1a40;
+        case 0x1a58: goto L1a58;
+        case 0x1a60: goto L1a60;
+        case 0x1a68: goto L1a68;
+        case 0x1a6e: goto L1a6e;
+        case 0x1a72: goto L1a72;
+        case 0x1a80: goto L1a80;
+        case 0x1a84: goto L1a84;
+        case 0x1a88: goto L1a88;
+        case 0x1a8c: goto L1a8c;
+        case 0x1a90: goto L1a90;
+        case 0x1a96: goto L1a96;
+        case 0x1a9a: goto L1a9a;
+        case 0x1a9c: goto L1a9c;
+        case 0x1aa8: goto L1aa8;
+        case 0x1aac: goto L1aac;
+        case 0x1aba: goto L1aba;
+        case 0x1ac0: goto L1ac0;
+        case 0x1ac6: goto L1ac6;
+        case 0x1acc: goto L1acc;
+        case 0x1ad2: goto L1ad2;
+        case 0x1ad6: goto L1ad6;
+        case 0x1ad8: goto L1ad8;
+        case 0x1ade: goto L1ade;
+        case 0x1ae2: goto L1ae2;
+        case 0x1ae4: goto L1ae4;
+        case 0x1ae8: goto L1ae8;
+        case 0x1aec: goto L1aec;
+        case 0x1af2: goto L1af2;
+        case 0x1af4: goto L1af4;
+        case 0x1af8: goto L1af8;
+        case 0x1afc: goto L1afc;
+        case 0x1afe: goto L1afe;
+        case 0x1b0a: goto L1b0a;
+        case 0x1b0c: goto L1b0c;
+        case 0x1b0e: goto L1b0e;
+        case 0x1b12: goto L1b12;
+        case 0x1b24: goto L1b24;
+        case 0x1b28: goto L1b28;
+        case 0x1b2c: goto L1b2c;
+        case 0x1b30: goto L1b30;
+        case 0x1b36: goto L1b36;
+        case 0x1b3c: goto L1b3c;
+        case 0x1b42: goto L1b42;
+        case 0x1b50: goto L1b50;
+        case 0x1b54: goto L1b54;
+        case 0x1b5a: goto L1b5a;
+        case 0x1b5e: goto L1b5e;
+        case 0x1b62: goto L1b62;
+        case 0x1b6e: goto L1b6e;
+        case 0x1b72: goto L1b72;
+        case 0x1b76: goto L1b76;
+        case 0x1b84: goto L1b84;
+        case 0x1b88: goto L1b88;
+        case 0x1b98: goto L1b98;
+        case 0x1ba0: goto L1ba0;
+        case 0x1ba4: goto L1ba4;
+        case 0x1ba8: goto L1ba8;
+        case 0x1bac: goto L1bac;
+        case 0x1bb8: goto L1bb8;
+        case 0x1bba: goto L1bba;
+        case 0x1bc6: goto L1bc6;
+        case 0x1bca: goto L1bca;
+        case 0x1bd0: goto L1bd0;
+        case 0x1bd2: goto L1bd2;
+        case 0x1bdc: goto L1bdc;
+        case 0x1bde: goto L1bde;
+        case 0x1be8: goto L1be8;
+        case 0x1bea: goto L1bea;
+        case 0x1bf0: goto L1bf0;
+        case 0x1bf2: goto L1bf2;
+        case 0x1c04: goto L1c04;
+        case 0x1c0c: goto L1c0c;
+        case 0x1c12: goto L1c12;
+        case 0x1c24: goto L1c24;
+        case 0x1c28: goto L1c28;
+        case 0x1c2e: goto L1c2e;
+        case 0x1c3a: goto L1c3a;
+        case 0x1c40: goto L1c40;
+        case 0x1c4a: goto L1c4a;
+        case 0x1c5c: goto L1c5c;
+        case 0x1c6a: goto L1c6a;
+        case 0x1c6c: goto L1c6c;
+        case 0x1c6e: goto L1c6e;
+        case 0x1c74: goto L1c74;
+        case 0x1c7e: goto L1c7e;
+        case 0x1c88: goto L1c88;
+        case 0x1c8a: goto L1c8a;
+        case 0x1c8e: goto L1c8e;
+        case 0x1c94: goto L1c94;
+        case 0x1c9a: goto L1c9a;
+        case 0x1ca2: goto L1ca2;
+        case 0x1ca8: goto L1ca8;
+        case 0x1cb6: goto L1cb6;
+        case 0x1cc4: goto L1cc4;
+        case 0x1cca: goto L1cca;
+        case 0x1cd8: goto L1cd8;
+        case 0x1cda: goto L1cda;
+        case 0x1cde: goto L1cde;
+        case 0x1ce0: goto L1ce0;
+        case 0x1ce6: goto L1ce6;
+        case 0x1cf0: goto L1cf0;
+        case 0x1cfa: goto L1cfa;
+        case 0x1cfc: goto L1cfc;
+        case 0x1d00: goto L1d00;
+        case 0x1d06: goto L1d06;
+        case 0x1d0a: goto L1d0a;
+        case 0x1d1e: goto L1d1e;
+        case 0x1d2a: goto L1d2a;
+        case 0x1d32: goto L1d32;
+        case 0x1d52: goto L1d52;
+        case 0x1d5c: goto L1d5c;
+        case 0x1d62: goto L1d62;
+        case 0x1d68: goto L1d68;
+        case 0x1d72: goto L1d72;
+        case 0x1d76: goto L1d76;
+        case 0x1d7e: goto L1d7e;
+        case 0x1d8a: goto L1d8a;
+        case 0x1d92: goto L1d92;
+        case 0x1d9a: goto L1d9a;
+        case 0x1da8: goto L1da8;
+        case 0x1db2: goto L1db2;
+        case 0x1dc2: goto L1dc2;
+        case 0x1dc6: goto L1dc6;
+        case 0x1dd2: goto L1dd2;
+        case 0x1dd8: goto L1dd8;
+        case 0x1de2: goto L1de2;
+        case 0x1de6: goto L1de6;
+        case 0x1dec: goto L1dec;
+        case 0x1e02: goto L1e02;
+        case 0x1e08: goto L1e08;
+        case 0x1e10: goto L1e10;
+        case 0x1e26: goto L1e26;
+        case 0x1e2c: goto L1e2c;
+        case 0x1e36: goto L1e36;
+        case 0x1e3a: goto L1e3a;
+        case 0x1e3e: goto L1e3e;
+        case 0x1e48: goto L1e48;
+        case 0x1e4e: goto L1e4e;
+        case 0x1e52: goto L1e52;
+        case 0x1e58: goto L1e58;
+        case 0x1e5c: goto L1e5c;
+        case 0x1e70: goto L1e70;
+        case 0x1e78: goto L1e78;
+        case 0x1e7e: goto L1e7e;
+        case 0x1e8a: goto L1e8a;
+        case 0x1e8e: goto L1e8e;
+        case 0x1e92: goto L1e92;
+        case 0x1e9a: goto L1e9a;
+        case 0x1ea2: goto L1ea2;
+        case 0x1eaa: goto L1eaa;
+        case 0x1eae: goto L1eae;
+        case 0x1ebe: goto L1ebe;
+        case 0x1ec6: goto L1ec6;
+        case 0x1ecc: goto L1ecc;
+        case 0x1ece: goto L1ece;
+        case 0x1ed0: goto L1ed0;
+        case 0x1ed2: goto L1ed2;
+        case 0x1ed4: goto L1ed4;
+        case 0x1eda: goto L1eda;
+        case 0x1ee0: goto L1ee0;
+        case 0x1ef4: goto L1ef4;
+        case 0x1ef6: goto L1ef6;
+        case 0x1efa: goto L1efa;
+        case 0x1efc: goto L1efc;
+        case 0x1f04: goto L1f04;
+        case 0x1f0a: goto L1f0a;
+        case 0x1f10: goto L1f10;
+        case 0x1f16: goto L1f16;
+        case 0x1f1c: goto L1f1c;
+        case 0x1f20: goto L1f20;
+        case 0x1f24: goto L1f24;
+        case 0x1f28: goto L1f28;
+        case 0x1f2c: goto L1f2c;
+        case 0x1f36: goto L1f36;
+        case 0x1f5a: goto L1f5a;
+        case 0x1f6e: goto L1f6e;
+        case 0x1f72: goto L1f72;
+        case 0x1f78: goto L1f78;
+        case 0x1f7a: goto L1f7a;
+        case 0x1f7c: goto L1f7c;
+        case 0x1f84: goto L1f84;
+        case 0x1f8e: goto L1f8e;
+        case 0x1f98: goto L1f98;
+        case 0x1fa4: goto L1fa4;
+        case 0x1faa: goto L1faa;
+        case 0x1fb0: goto L1fb0;
+        case 0x1fb2: goto L1fb2;
+        case 0x1fb6: goto L1fb6;
+        case 0x1fc2: goto L1fc2;
+        case 0x1fdc: goto L1fdc;
+        case 0x1fee: goto L1fee;
+        case 0x1ffa: goto L1ffa;
+        case 0x2002: goto L2002;
+        case 0x2012: goto L2012;
+        case 0x201c: goto L201c;
+        case 0x203a: goto L203a;
+        case 0x203c: goto L203c;
+        case 0x204a: goto L204a;
+        case 0x2054: goto L2054;
+        case 0x2064: goto L2064;
+        case 0x2066: goto L2066;
+        case 0x206e: goto L206e;
+        case 0x2074: goto L2074;
+        case 0x212e: goto L212e;
+        case 0x2144: goto L2144;
+        case 0x214a: goto L214a;
+        case 0x214c: goto L214c;
+        case 0x2150: goto L2150;
+        case 0x2156: goto L2156;
+        case 0x215e: goto L215e;
+        case 0x2164: goto L2164;
+        case 0x2168: goto L2168;
+        case 0x216c: goto L216c;
+        case 0x2186: goto L2186;
+        case 0x218c: goto L218c;
+        case 0x2194: goto L2194;
+        case 0x219a: goto L219a;
+        case 0x219e: goto L219e;
+        case 0x21a2: goto L21a2;
+        case 0x21a6: goto L21a6;
+        case 0x21b0: goto L21b0;
+        case 0x21b8: goto L21b8;
+        case 0x21d8: goto L21d8;
+        case 0x21ec: goto L21ec;
+        case 0x21f2: goto L21f2;
+        case 0x2202: goto L2202;
+        case 0x2206: goto L2206;
+        case 0x220a: goto L220a;
+        case 0x220e: goto L220e;
+        case 0x2212: goto L2212;
+        case 0x2216: goto L2216;
+        case 0x221c: goto L221c;
+        case 0x2220: goto L2220;
+        case 0x2234: goto L2234;
+        case 0x2236: goto L2236;
+        case 0x2238: goto L2238;
+        case 0x223a: goto L223a;
+        case 0x223c: goto L223c;
+        case 0x2240: goto L2240;
+        case 0x2244: goto L2244;
+        case 0x2256: goto L2256;
+        case 0x2258: goto L2258;
+        case 0x225a: goto L225a;
+        case 0x225c: goto L225c;
+        case 0x225e: goto L225e;
+        case 0x2260: goto L2260;
+        case 0x2264: goto L2264;
+        case 0x226e: goto L226e;
+        case 0x2270: goto L2270;
+        case 0x2272: goto L2272;
+        case 0x2274: goto L2274;
+        case 0x2276: goto L2276;
+        case 0x227a: goto L227a;
+        case 0x228c: goto L228c;
+        case 0x228e: goto L228e;
+        case 0x2290: goto L2290;
+        case 0x2292: goto L2292;
+        case 0x2294: goto L2294;
+        case 0x2298: goto L2298;
+        case 0x22a8: goto L22a8;
+        case 0x22aa: goto L22aa;
+        case 0x22ac: goto L22ac;
+        case 0x22ae: goto L22ae;
+        case 0x22b0: goto L22b0;
+        case 0x22b6: goto L22b6;
+        case 0x22bc: goto L22bc;
+        case 0x22be: goto L22be;
+        case 0x22c0: goto L22c0;
+        case 0x22c2: goto L22c2;
+        case 0x22c4: goto L22c4;
+        case 0x22cc: goto L22cc;
+        case 0x22ce: goto L22ce;
+        case 0x22d8: goto L22d8;
+        case 0x22da: goto L22da;
+        case 0x22dc: goto L22dc;
+        case 0x22de: goto L22de;
+        case 0x22e0: goto L22e0;
+        case 0x22e6: goto L22e6;
+        case 0x22f8: goto L22f8;
+        case 0x22fa: goto L22fa;
+        case 0x22fc: goto L22fc;
+        case 0x22fe: goto L22fe;
+        case 0x2300: goto L2300;
+        case 0x2306: goto L2306;
+        case 0x2318: goto L2318;
+        case 0x2322: goto L2322;
+        case 0x2324: goto L2324;
+        case 0x2326: goto L2326;
+        case 0x2328: goto L2328;
+        case 0x232a: goto L232a;
+        case 0x232e: goto L232e;
+        case 0x2332: goto L2332;
+        case 0x2338: goto L2338;
+        case 0x233a: goto L233a;
+        case 0x2344: goto L2344;
+        case 0x2346: goto L2346;
+        case 0x2348: goto L2348;
+        case 0x234a: goto L234a;
+        case 0x234c: goto L234c;
+        case 0x234e: goto L234e;
+        case 0x2350: goto L2350;
+        case 0x2366: goto L2366;
+        case 0x2368: goto L2368;
+        case 0x236a: goto L236a;
+        case 0x236c: goto L236c;
+        case 0x236e: goto L236e;
+        case 0x2372: goto L2372;
+        case 0x237e: goto L237e;
+        case 0x2386: goto L2386;
+        case 0x2388: goto L2388;
+        case 0x238a: goto L238a;
+        case 0x238c: goto L238c;
+        case 0x238e: goto L238e;
+        case 0x23bc: goto L23bc;
+        case 0x23ca: goto L23ca;
+        case 0x23e2: goto L23e2;
+        case 0x23e8: goto L23e8;
+        case 0x23f2: goto L23f2;
+        case 0x23f4: goto L23f4;
+        case 0x23f6: goto L23f6;
+        case 0x23f8: goto L23f8;
+        case 0x23fa: goto L23fa;
+        case 0x23fc: goto L23fc;
+        case 0x23fe: goto L23fe;
+        case 0x2400: goto L2400;
+        case 0x2406: goto L2406;
+        case 0x240a: goto L240a;
+        case 0x241e: goto L241e;
+        case 0x2422: goto L2422;
+        case 0x2426: goto L2426;
+        case 0x242a: goto L242a;
+        case 0x242e: goto L242e;
+        case 0x2432: goto L2432;
+        case 0x2436: goto L2436;
+        case 0x243a: goto L243a;
+        case 0x243e: goto L243e;
+        case 0x2442: goto L2442;
+        case 0x2446: goto L2446;
+        case 0x244a: goto L244a;
+        case 0x244e: goto L244e;
+        case 0x2452: goto L2452;
+        case 0x2456: goto L2456;
+        case 0x245a: goto L245a;
+        case 0x245e: goto L245e;
+        case 0x2474: goto L2474;
+        case 0x2482: goto L2482;
+        case 0x248e: goto L248e;
+        case 0x2490: goto L2490;
+        case 0x2492: goto L2492;
+        case 0x2494: goto L2494;
+        case 0x2496: goto L2496;
+        case 0x249a: goto L249a;
+        case 0x24a6: goto L24a6;
+        case 0x24a8: goto L24a8;
+        case 0x24aa: goto L24aa;
+        case 0x24ac: goto L24ac;
+        case 0x24ae: goto L24ae;
+        case 0x24b4: goto L24b4;
+        case 0x24ca: goto L24ca;
+        case 0x24cc: goto L24cc;
+        case 0x24ce: goto L24ce;
+        case 0x24d0: goto L24d0;
+        case 0x24d2: goto L24d2;
+        case 0x24d6: goto L24d6;
+        case 0x24e4: goto L24e4;
+        case 0x24f0: goto L24f0;
+        case 0x24f2: goto L24f2;
+        case 0x24f8: goto L24f8;
+        case 0x2500: goto L2500;
+        case 0x2502: goto L2502;
+        case 0x250a: goto L250a;
+        case 0x251a: goto L251a;
+        case 0x2524: goto L2524;
+        case 0x2528: goto L2528;
+        case 0x252c: goto L252c;
+        case 0x2532: goto L2532;
+        case 0x2536: goto L2536;
+        case 0x2542: goto L2542;
+        case 0x254a: goto L254a;
+        case 0x2552: goto L2552;
+        case 0x255c: goto L255c;
+        case 0x2560: goto L2560;
+        case 0x256c: goto L256c;
+        case 0x256e: goto L256e;
+        case 0x2574: goto L2574;
+        case 0x2576: goto L2576;
+        case 0x2578: goto L2578;
+        case 0x2584: goto L2584;
+        case 0x258c: goto L258c;
+        case 0x2592: goto L2592;
+        case 0x2596: goto L2596;
+        case 0x25a2: goto L25a2;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 3);
+    // 0000: setd
+    // 0002: mov 2(sp), r0
+    {
+        a = uint16_t(r[6] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0006: clr -2(r0)
+    {
+        a = uint16_t(r[0] + -2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x000a, L000a);
+L000a:
+    AOT_BLOCK(0x000a, 5);
+    // 000a: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+    }
+    // 000c: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0010: mov 4(sp), (sp)
+    {
+        a = uint16_t(r[6] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0014: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0016: mov r0, 2(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x001a, L001a);
+L001a:
+    AOT_BLOCK(0x001a, 2);
+    // 001a: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 001c: bne 001a
+    if (!Z)
+        AOT_GOTO(0x001a, L001a);
+    AOT_GOTO(0x001e, L001e);
+L001e:
+    AOT_BLOCK(0x001e, 2);
+    // 001e: cmp r0, *2(sp)
+    {
+        src = r[0];
+        b = RD16(r[6] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0022: bcs 0026
+    if (C)
+        AOT_GOTO(0x0026, L0026);
+    AOT_GOTO(0x0024, L0024);
+L0024:
+    AOT_BLOCK(0x0024, 1);
+    // 0024: tst -(r0)
+    {
+        r[0] -= 2;
+        a = r[0];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0026, L0026);
+L0026:
+    AOT_BLOCK(0x0026, 3);
+    // 0026: mov r0, 4(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 4);
+        WR16(b, src);
+    }
+    // 002a: mov r0, d1b2
+    {
+        src = r[0];
+        b = 0xd1b2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 002e: jsr pc, 0072
+    {
+        a = 0x0072;
+        r[6] -= 2;
+        WR16(r[6], 0x0032);
+    }
+    AOT_GOTO(0x0072, L0072);
+L0032:
+    AOT_BLOCK(0x0032, 3);
+    // 0032: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0034: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0036: jsr pc, *$1ebe
+    {
+        a = 0x1ebe;
+        r[6] -= 2;
+        WR16(r[6], 0x003a);
+    }
+    AOT_GOTO(0x1ebe, L1ebe);
+L003a:
+    // 003a: sys 1
+    AOT_INTERP(0x003a);
+L003c:
+    AOT_BLOCK(0x003c, 2);
+    // 003c: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0040;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    AOT_GOTO(0x0040, L0040);
+L003e:
+    AOT_BLOCK(0x003e, 1);
+    // 003e: cmp (r5)+, (sp)+
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0040, L0040);
+L0040:
+    AOT_BLOCK(0x0040, 1);
+    // 0040: mov $4062, (sp)
+    {
+        src = uint16_t(0x4062);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0044, L0044);
+L0042:
+    AOT_BLOCK(0x0042, 1);
+    // 0042: bic r1, -(r2)
+    {
+        src = r[1];
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0044, L0044);
+L0044:
+    AOT_BLOCK(0x0044, 1);
+    // 0044: jsr pc, *$249a
+    {
+        a = 0x249a;
+        r[6] -= 2;
+        WR16(r[6], 0x0048);
+    }
+    AOT_GOTO(0x249a, L249a);
+L0048:
+    AOT_BLOCK(0x0048, 1);
+    // 0048: tst 401e
+    {
+        a = 0x401e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x004c, L004c);
+L004c:
+    AOT_BLOCK(0x004c, 1);
+    // 004c: bne 0066
+    if (!Z)
+        AOT_GOTO(0x0066, L0066);
+    AOT_GOTO(0x004e, L004e);
+L004e:
+    AOT_BLOCK(0x004e, 2);
+    // 004e: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0050: jsr pc, *$2482
+    {
+        a = 0x2482;
+        r[6] -= 2;
+        WR16(r[6], 0x0054);
+    }
+    AOT_GOTO(0x2482, L2482);
+L0054:
+    AOT_BLOCK(0x0054, 5);
+    // 0054: com r0
+    {
+        val = ~int(r[0]);
+        r[0] = val;
+        C = true;
+    }
+    // 0056: bic $fe00, r0
+    {
+        src = uint16_t(0xfe00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 005a: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 005c: mov 401c, -(sp)
+    {
+        a = 0x401c;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0060: jsr pc, *$2244
+    {
+        a = 0x2244;
+        r[6] -= 2;
+        WR16(r[6], 0x0064);
+    }
+    AOT_GOTO(0x2244, L2244);
+L0064:
+    AOT_BLOCK(0x0064, 1);
+    // 0064: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0066, L0066);
+L0066:
+    AOT_BLOCK(0x0066, 2);
+    // 0066: mov 401e, (sp)
+    {
+        a = 0x401e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 006a: jsr pc, *$1ebe
+    {
+        a = 0x1ebe;
+        r[6] -= 2;
+        WR16(r[6], 0x006e);
+    }
+    AOT_GOTO(0x1ebe, L1ebe);
+L006e:
+    AOT_BLOCK(0x006e, 2);
+    // 006e: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0072:
+    AOT_BLOCK(0x0072, 6);
+    // 0072: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0076;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 0076: sub $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 007a: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 007e: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0082: jsr pc, *$23bc
+    {
+        a = 0x23bc;
+        r[6] -= 2;
+        WR16(r[6], 0x0086);
+    }
+    AOT_GOTO(0x23bc, L23bc);
+L0086:
+    AOT_BLOCK(0x0086, 3);
+    // 0086: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0088: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 008c: beq 009c
+    if (Z)
+        AOT_GOTO(0x009c, L009c);
+    AOT_GOTO(0x008e, L008e);
+L008e:
+    AOT_BLOCK(0x008e, 3);
+    // 008e: mov $3c, (sp)
+    {
+        src = uint16_t(0x003c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0092: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0096: jsr pc, *$23bc
+    {
+        a = 0x23bc;
+        r[6] -= 2;
+        WR16(r[6], 0x009a);
+    }
+    AOT_GOTO(0x23bc, L23bc);
+L009a:
+    AOT_BLOCK(0x009a, 1);
+    // 009a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x009c, L009c);
+L009c:
+    AOT_BLOCK(0x009c, 3);
+    // 009c: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00a0: mov $f, -(sp)
+    {
+        src = uint16_t(0x000f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00a4: jsr pc, *$23bc
+    {
+        a = 0x23bc;
+        r[6] -= 2;
+        WR16(r[6], 0x00a8);
+    }
+    AOT_GOTO(0x23bc, L23bc);
+L00a8:
+    AOT_BLOCK(0x00a8, 3);
+    // 00a8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 00aa: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00ae: beq 00be
+    if (Z)
+        AOT_GOTO(0x00be, L00be);
+    AOT_GOTO(0x00b0, L00b0);
+L00b0:
+    AOT_BLOCK(0x00b0, 3);
+    // 00b0: mov $3c, (sp)
+    {
+        src = uint16_t(0x003c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00b4: mov $f, -(sp)
+    {
+        src = uint16_t(0x000f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00b8: jsr pc, *$23bc
+    {
+        a = 0x23bc;
+        r[6] -= 2;
+        WR16(r[6], 0x00bc);
+    }
+    AOT_GOTO(0x23bc, L23bc);
+L00bc:
+    AOT_BLOCK(0x00bc, 1);
+    // 00bc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x00be, L00be);
+L00be:
+    AOT_BLOCK(0x00be, 2);
+    // 00be: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00c4: bne 00ce
+    if (!Z)
+        AOT_GOTO(0x00ce, L00ce);
+    AOT_GOTO(0x00c6, L00c6);
+L00c6:
+    AOT_BLOCK(0x00c6, 2);
+    // 00c6: mov $4, (sp)
+    {
+        src = uint16_t(0x0004);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00ca: jsr pc, *$1ebe
+    {
+        a = 0x1ebe;
+        r[6] -= 2;
+        WR16(r[6], 0x00ce);
+    }
+    AOT_GOTO(0x1ebe, L1ebe);
+L00ce:
+    AOT_BLOCK(0x00ce, 5);
+    // 00ce: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00d2: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 00d6: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 00da: mov $1, r4
+    {
+        src = uint16_t(0x0001);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00de: jmp *$034c
+    {
+        a = 0x034c;
+    }
+    AOT_GOTO(0x034c, L034c);
+L00e2:
+    AOT_BLOCK(0x00e2, 2);
+    // 00e2: tst c35c
+    {
+        a = 0xc35c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 00e6: beq 00f6
+    if (Z)
+        AOT_GOTO(0x00f6, L00f6);
+    AOT_GOTO(0x00e8, L00e8);
+L00e8:
+    AOT_BLOCK(0x00e8, 3);
+    // 00e8: mov *-a(r5), (sp)
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00ec: mov $4068, -(sp)
+    {
+        src = uint16_t(0x4068);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00f0: jsr pc, *$19c8
+    {
+        a = 0x19c8;
+        r[6] -= 2;
+        WR16(r[6], 0x00f4);
+    }
+    AOT_GOTO(0x19c8, L19c8);
+L00f4:
+    AOT_BLOCK(0x00f4, 1);
+    // 00f4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x00f6, L00f6);
+L00f6:
+    AOT_BLOCK(0x00f6, 5);
+    // 00f6: clr c378
+    {
+        a = 0xc378;
+        WR16(a, 0);
+    }
+    // 00fa: mov *-a(r5), r2
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 00fe: add $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0104: cmpb $2d, (r2)
+    {
+        src = uint8_t(0x2d);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0108: beq 010e
+    if (Z)
+        AOT_GOTO(0x010e, L010e);
+    AOT_GOTO(0x010a, L010a);
+L010a:
+    AOT_BLOCK(0x010a, 1);
+    // 010a: jmp *$0344
+    {
+        a = 0x0344;
+    }
+    AOT_GOTO(0x0344, L0344);
+L010e:
+    AOT_BLOCK(0x010e, 1);
+    // 010e: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0112, L0112);
+L0112:
+    AOT_BLOCK(0x0112, 4);
+    // 0112: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 0114: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0116: tstb (r0)
+    {
+        a = r[0];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0118: bne 011e
+    if (!Z)
+        AOT_GOTO(0x011e, L011e);
+    AOT_GOTO(0x011a, L011a);
+L011a:
+    AOT_BLOCK(0x011a, 1);
+    // 011a: jmp *$034a
+    {
+        a = 0x034a;
+    }
+    AOT_GOTO(0x034a, L034a);
+L011e:
+    AOT_BLOCK(0x011e, 8);
+    // 011e: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 0120: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0122: movb (r0), r0
+    {
+        a = r[0];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0124: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0126: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0128: div $6, r0
+    {
+        src = int16_t(uint16_t(0x0006));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 012c: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 012e: jmp *402e(r1)
+    {
+        a = RD16(r[1] + 16430);
+    }
+    AOT_JUMP(a);
+L0132:
+    AOT_BLOCK(0x0132, 3);
+    // 0132: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 0134: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0138: bgt 0148
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0148, L0148);
+    AOT_GOTO(0x013a, L013a);
+L013a:
+    AOT_BLOCK(0x013a, 3);
+    // 013a: mov $406d, (sp)
+    {
+        src = uint16_t(0x406d);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 013e: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0142: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x0146);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L0146:
+    AOT_BLOCK(0x0146, 1);
+    // 0146: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0148, L0148);
+L0148:
+    AOT_BLOCK(0x0148, 3);
+    // 0148: mov *-a(r5), 401c
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        b = 0x401c;
+        WR16(b, src);
+    }
+    // 014e: add $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0154: inc c374
+    {
+        a = 0xc374;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0158, L0158);
+L0158:
+    AOT_BLOCK(0x0158, 2);
+    // 0158: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 015a: br 0112
+    AOT_GOTO(0x0112, L0112);
+L015c:
+    AOT_BLOCK(0x015c, 2);
+    // 015c: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0160: bne 0182
+    if (!Z)
+        AOT_GOTO(0x0182, L0182);
+    AOT_GOTO(0x0162, L0162);
+L0162:
+    AOT_BLOCK(0x0162, 5);
+    // 0162: mov *-a(r5), (sp)
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0166: mov -e(r5), r1
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 016a: mul $16, r1
+    {
+        src = int16_t(uint16_t(0x0016));
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 016e: mov 6508(r1), -(sp)
+    {
+        a = uint16_t(r[1] + 25864);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0172: jsr pc, *$192e
+    {
+        a = 0x192e;
+        r[6] -= 2;
+        WR16(r[6], 0x0176);
+    }
+    AOT_GOTO(0x192e, L192e);
+L0176:
+    AOT_BLOCK(0x0176, 2);
+    // 0176: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0178: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x017c, L017c);
+L017c:
+    AOT_BLOCK(0x017c, 2);
+    // 017c: dec -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0180: bge 015c
+    if (!(N ^ V))
+        AOT_GOTO(0x015c, L015c);
+    AOT_GOTO(0x0182, L0182);
+L0182:
+    AOT_BLOCK(0x0182, 2);
+    // 0182: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0186: beq 019e
+    if (Z)
+        AOT_GOTO(0x019e, L019e);
+    AOT_GOTO(0x0188, L0188);
+L0188:
+    AOT_BLOCK(0x0188, 3);
+    // 0188: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 018c: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 018e: jsr pc, *$0368
+    {
+        a = 0x0368;
+        r[6] -= 2;
+        WR16(r[6], 0x0192);
+    }
+    AOT_GOTO(0x0368, L0368);
+L0192:
+    AOT_BLOCK(0x0192, 3);
+    // 0192: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0194: mov -e(r5), (sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0198: jsr pc, *$04b4
+    {
+        a = 0x04b4;
+        r[6] -= 2;
+        WR16(r[6], 0x019c);
+    }
+    AOT_GOTO(0x04b4, L04b4);
+L019c:
+    AOT_BLOCK(0x019c, 1);
+    // 019c: br 01aa
+    AOT_GOTO(0x01aa, L01aa);
+L019e:
+    AOT_BLOCK(0x019e, 3);
+    // 019e: mov *-a(r5), (sp)
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01a2: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01a4: jsr pc, *$045a
+    {
+        a = 0x045a;
+        r[6] -= 2;
+        WR16(r[6], 0x01a8);
+    }
+    AOT_GOTO(0x045a, L045a);
+L01a8:
+    AOT_BLOCK(0x01a8, 1);
+    // 01a8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x01aa, L01aa);
+L01aa:
+    AOT_BLOCK(0x01aa, 2);
+    // 01aa: add $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 01b0: br 0158
+    AOT_GOTO(0x0158, L0158);
+L01b2:
+    AOT_BLOCK(0x01b2, 3);
+    // 01b2: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 01b4: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01b8: bgt 01c8
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x01c8, L01c8);
+    AOT_GOTO(0x01ba, L01ba);
+L01ba:
+    AOT_BLOCK(0x01ba, 3);
+    // 01ba: mov $40a2, (sp)
+    {
+        src = uint16_t(0x40a2);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01be: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01c2: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x01c6);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L01c6:
+    AOT_BLOCK(0x01c6, 1);
+    // 01c6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x01c8, L01c8);
+L01c8:
+    AOT_BLOCK(0x01c8, 3);
+    // 01c8: mov *-a(r5), (sp)
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01cc: add $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 01d2: jsr pc, *$1ecc
+    {
+        a = 0x1ecc;
+        r[6] -= 2;
+        WR16(r[6], 0x01d6);
+    }
+    AOT_GOTO(0x1ecc, L1ecc);
+L01d6:
+    AOT_BLOCK(0x01d6, 3);
+    // 01d6: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 01da: cmp r0, c37c
+    {
+        src = r[0];
+        b = 0xc37c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01de: bge 01ee
+    if (!(N ^ V))
+        AOT_GOTO(0x01ee, L01ee);
+    AOT_GOTO(0x01e0, L01e0);
+L01e0:
+    AOT_BLOCK(0x01e0, 3);
+    // 01e0: mov $40b2, (sp)
+    {
+        src = uint16_t(0x40b2);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01e4: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01e8: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x01ec);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L01ec:
+    AOT_BLOCK(0x01ec, 1);
+    // 01ec: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x01ee, L01ee);
+L01ee:
+    AOT_BLOCK(0x01ee, 2);
+    // 01ee: mov -8(r5), c37c
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0xc37c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01f4: br 0158
+    AOT_GOTO(0x0158, L0158);
+L01f6:
+    AOT_BLOCK(0x01f6, 10);
+    // 01f6: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+    }
+    // 01f8: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 01fa: add r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 01fc: movb (r0), -10(r5)
+    {
+        a = r[0];
+        src = RD8(a);
+        b = uint16_t(r[5] + -16);
+        WR8(b, src);
+    }
+    // 0200: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 0202: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0204: movb $2d, (r0)
+    {
+        src = uint8_t(0x2d);
+        b = r[0];
+        WR8(b, src);
+    }
+    // 0208: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 020a: add r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 020c: jsr pc, *$051e
+    {
+        a = 0x051e;
+        r[6] -= 2;
+        WR16(r[6], 0x0210);
+    }
+    AOT_GOTO(0x051e, L051e);
+L0210:
+    AOT_BLOCK(0x0210, 4);
+    // 0210: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 0212: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0214: movb -10(r5), (r0)
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD8(a);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0218: jmp *$034a
+    {
+        a = 0x034a;
+    }
+    AOT_GOTO(0x034a, L034a);
+L021c:
+    AOT_BLOCK(0x021c, 2);
+    // 021c: inc c360
+    {
+        a = 0xc360;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0220: br 0158
+    AOT_GOTO(0x0158, L0158);
+L0222:
+    AOT_BLOCK(0x0222, 2);
+    // 0222: inc c362
+    {
+        a = 0xc362;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0226: br 0158
+    AOT_GOTO(0x0158, L0158);
+L0228:
+    AOT_BLOCK(0x0228, 3);
+    // 0228: inc c364
+    {
+        a = 0xc364;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 022c: inc c366
+    {
+        a = 0xc366;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0230: br 0158
+    AOT_GOTO(0x0158, L0158);
+L0232:
+    AOT_BLOCK(0x0232, 2);
+    // 0232: inc c36a
+    {
+        a = 0xc36a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0236: br 0158
+    AOT_GOTO(0x0158, L0158);
+L0238:
+    AOT_BLOCK(0x0238, 2);
+    // 0238: inc c36e
+    {
+        a = 0xc36e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 023c: br 0158
+    AOT_GOTO(0x0158, L0158);
+L023e:
+    AOT_BLOCK(0x023e, 2);
+    // 023e: inc c370
+    {
+        a = 0xc370;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0242: br 0158
+    AOT_GOTO(0x0158, L0158);
+L0244:
+    AOT_BLOCK(0x0244, 2);
+    // 0244: inc c36c
+    {
+        a = 0xc36c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0248: br 0158
+    AOT_GOTO(0x0158, L0158);
+L024a:
+    AOT_BLOCK(0x024a, 2);
+    // 024a: cmp r0, $12
+    {
+        src = r[0];
+        dst = uint16_t(0x0012);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 024e: beq 01f6
+    if (Z)
+        AOT_GOTO(0x01f6, L01f6);
+    AOT_GOTO(0x0250, L0250);
+L0250:
+    AOT_BLOCK(0x0250, 2);
+    // 0250: cmp r0, $13
+    {
+        src = r[0];
+        dst = uint16_t(0x0013);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0254: beq 0228
+    if (Z)
+        AOT_GOTO(0x0228, L0228);
+    AOT_GOTO(0x0256, L0256);
+L0256:
+    AOT_BLOCK(0x0256, 2);
+    // 0256: cmp r0, $14
+    {
+        src = r[0];
+        dst = uint16_t(0x0014);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 025a: beq 027c
+    if (Z)
+        AOT_GOTO(0x027c, L027c);
+    AOT_GOTO(0x025c, L025c);
+L025c:
+    AOT_BLOCK(0x025c, 3);
+    // 025c: mov $40c0, (sp)
+    {
+        src = uint16_t(0x40c0);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0260: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0264: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x0268);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L0268:
+    AOT_BLOCK(0x0268, 2);
+    // 0268: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 026a: br 034a
+    AOT_GOTO(0x034a, L034a);
+L026c:
+    AOT_BLOCK(0x026c, 2);
+    // 026c: cmp r0, $d
+    {
+        src = r[0];
+        dst = uint16_t(0x000d);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0270: beq 0244
+    if (Z)
+        AOT_GOTO(0x0244, L0244);
+    AOT_GOTO(0x0272, L0272);
+L0272:
+    AOT_BLOCK(0x0272, 2);
+    // 0272: cmp r0, $13
+    {
+        src = r[0];
+        dst = uint16_t(0x0013);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0276: bne 025c
+    if (!Z)
+        AOT_GOTO(0x025c, L025c);
+    AOT_GOTO(0x0278, L0278);
+L0278:
+    AOT_BLOCK(0x0278, 1);
+    // 0278: inc c368
+    {
+        a = 0xc368;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x027c, L027c);
+L027c:
+    AOT_BLOCK(0x027c, 2);
+    // 027c: inc c35e
+    {
+        a = 0xc35e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0280: jmp *$0158
+    {
+        a = 0x0158;
+    }
+    AOT_GOTO(0x0158, L0158);
+L0284:
+    AOT_BLOCK(0x0284, 2);
+    // 0284: cmp r0, $b
+    {
+        src = r[0];
+        dst = uint16_t(0x000b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0288: beq 01b2
+    if (Z)
+        AOT_GOTO(0x01b2, L01b2);
+    AOT_GOTO(0x028a, L028a);
+L028a:
+    AOT_BLOCK(0x028a, 2);
+    // 028a: cmp r0, $12
+    {
+        src = r[0];
+        dst = uint16_t(0x0012);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 028e: beq 0232
+    if (Z)
+        AOT_GOTO(0x0232, L0232);
+    AOT_GOTO(0x0290, L0290);
+L0290:
+    AOT_BLOCK(0x0290, 2);
+    // 0290: cmp r0, $13
+    {
+        src = r[0];
+        dst = uint16_t(0x0013);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0294: bne 025c
+    if (!Z)
+        AOT_GOTO(0x025c, L025c);
+    AOT_GOTO(0x0296, L0296);
+L0296:
+    AOT_BLOCK(0x0296, 2);
+    // 0296: inc c35c
+    {
+        a = 0xc35c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 029a: jmp *$0158
+    {
+        a = 0x0158;
+    }
+    AOT_GOTO(0x0158, L0158);
+L029e:
+    AOT_BLOCK(0x029e, 2);
+    // 029e: cmp r0, $11
+    {
+        src = r[0];
+        dst = uint16_t(0x0011);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02a2: beq 023e
+    if (Z)
+        AOT_GOTO(0x023e, L023e);
+    AOT_GOTO(0x02a4, L02a4);
+L02a4:
+    AOT_BLOCK(0x02a4, 2);
+    // 02a4: cmp r0, $12
+    {
+        src = r[0];
+        dst = uint16_t(0x0012);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02a8: bne 02ae
+    if (!Z)
+        AOT_GOTO(0x02ae, L02ae);
+    AOT_GOTO(0x02aa, L02aa);
+L02aa:
+    AOT_BLOCK(0x02aa, 1);
+    // 02aa: jmp *$0132
+    {
+        a = 0x0132;
+    }
+    AOT_GOTO(0x0132, L0132);
+L02ae:
+    AOT_BLOCK(0x02ae, 2);
+    // 02ae: cmp r0, $13
+    {
+        src = r[0];
+        dst = uint16_t(0x0013);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02b2: bne 025c
+    if (!Z)
+        AOT_GOTO(0x025c, L025c);
+    AOT_GOTO(0x02b4, L02b4);
+L02b4:
+    AOT_BLOCK(0x02b4, 3);
+    // 02b4: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 02b6: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02ba: bgt 02ca
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x02ca, L02ca);
+    AOT_GOTO(0x02bc, L02bc);
+L02bc:
+    AOT_BLOCK(0x02bc, 3);
+    // 02bc: mov $407d, (sp)
+    {
+        src = uint16_t(0x407d);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02c0: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02c4: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x02c8);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L02c8:
+    AOT_BLOCK(0x02c8, 1);
+    // 02c8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x02ca, L02ca);
+L02ca:
+    AOT_BLOCK(0x02ca, 3);
+    // 02ca: mov *-a(r5), (sp)
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02ce: add $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 02d4: jsr pc, *$16f6
+    {
+        a = 0x16f6;
+        r[6] -= 2;
+        WR16(r[6], 0x02d8);
+    }
+    AOT_GOTO(0x16f6, L16f6);
+L02d8:
+    AOT_BLOCK(0x02d8, 2);
+    // 02d8: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02da: jsr pc, *$171a
+    {
+        a = 0x171a;
+        r[6] -= 2;
+        WR16(r[6], 0x02de);
+    }
+    AOT_GOTO(0x171a, L171a);
+L02de:
+    AOT_BLOCK(0x02de, 4);
+    // 02de: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 02e0: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 02e2: cmpb $65, (r0)
+    {
+        src = uint8_t(0x65);
+        b = r[0];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 02e6: beq 02ec
+    if (Z)
+        AOT_GOTO(0x02ec, L02ec);
+    AOT_GOTO(0x02e8, L02e8);
+L02e8:
+    AOT_BLOCK(0x02e8, 1);
+    // 02e8: jmp *$0158
+    {
+        a = 0x0158;
+    }
+    AOT_GOTO(0x0158, L0158);
+L02ec:
+    AOT_BLOCK(0x02ec, 2);
+    // 02ec: mov ab0e, c35a
+    {
+        a = 0xab0e;
+        src = RD16(a);
+        b = 0xc35a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02f2: jmp *$0158
+    {
+        a = 0x0158;
+    }
+    AOT_GOTO(0x0158, L0158);
+L02f6:
+    AOT_BLOCK(0x02f6, 2);
+    // 02f6: cmp r0, $e
+    {
+        src = r[0];
+        dst = uint16_t(0x000e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02fa: beq 021c
+    if (Z)
+        AOT_GOTO(0x021c, L021c);
+    AOT_GOTO(0x02fc, L02fc);
+L02fc:
+    AOT_BLOCK(0x02fc, 2);
+    // 02fc: cmp r0, $10
+    {
+        src = r[0];
+        dst = uint16_t(0x0010);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0300: beq 0238
+    if (Z)
+        AOT_GOTO(0x0238, L0238);
+    AOT_GOTO(0x0302, L0302);
+L0302:
+    AOT_BLOCK(0x0302, 2);
+    // 0302: cmp r0, $13
+    {
+        src = r[0];
+        dst = uint16_t(0x0013);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0306: bne 025c
+    if (!Z)
+        AOT_GOTO(0x025c, L025c);
+    AOT_GOTO(0x0308, L0308);
+L0308:
+    AOT_BLOCK(0x0308, 3);
+    // 0308: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 030a: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 030e: bgt 031e
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x031e, L031e);
+    AOT_GOTO(0x0310, L0310);
+L0310:
+    AOT_BLOCK(0x0310, 3);
+    // 0310: mov $4092, (sp)
+    {
+        src = uint16_t(0x4092);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0314: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0318: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x031c);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L031c:
+    AOT_BLOCK(0x031c, 1);
+    // 031c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x031e, L031e);
+L031e:
+    AOT_BLOCK(0x031e, 4);
+    // 031e: mov $1, c372
+    {
+        src = uint16_t(0x0001);
+        b = 0xc372;
+        WR16(b, src);
+    }
+    // 0324: mov 6500, -e(r5)
+    {
+        a = 0x6500;
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 032a: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 032e: jmp *$017c
+    {
+        a = 0x017c;
+    }
+    AOT_GOTO(0x017c, L017c);
+L0332:
+    AOT_BLOCK(0x0332, 2);
+    // 0332: cmp r0, $d
+    {
+        src = r[0];
+        dst = uint16_t(0x000d);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0336: bne 033c
+    if (!Z)
+        AOT_GOTO(0x033c, L033c);
+    AOT_GOTO(0x0338, L0338);
+L0338:
+    AOT_BLOCK(0x0338, 1);
+    // 0338: jmp *$0222
+    {
+        a = 0x0222;
+    }
+    AOT_GOTO(0x0222, L0222);
+L033c:
+    AOT_BLOCK(0x033c, 2);
+    // 033c: cmp r0, $10
+    {
+        src = r[0];
+        dst = uint16_t(0x0010);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0340: beq 02b4
+    if (Z)
+        AOT_GOTO(0x02b4, L02b4);
+    AOT_GOTO(0x0342, L0342);
+L0342:
+    AOT_BLOCK(0x0342, 1);
+    // 0342: br 025c
+    AOT_GOTO(0x025c, L025c);
+L0344:
+    AOT_BLOCK(0x0344, 2);
+    // 0344: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0346: jsr pc, *$051e
+    {
+        a = 0x051e;
+        r[6] -= 2;
+        WR16(r[6], 0x034a);
+    }
+    AOT_GOTO(0x051e, L051e);
+L034a:
+    AOT_BLOCK(0x034a, 1);
+    // 034a: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x034c, L034c);
+L034c:
+    AOT_BLOCK(0x034c, 2);
+    // 034c: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0350: ble 0356
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0356, L0356);
+    AOT_GOTO(0x0352, L0352);
+L0352:
+    AOT_BLOCK(0x0352, 1);
+    // 0352: jmp *$00e2
+    {
+        a = 0x00e2;
+    }
+    AOT_GOTO(0x00e2, L00e2);
+L0356:
+    AOT_BLOCK(0x0356, 3);
+    // 0356: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 035a: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 035e: jsr pc, *$0368
+    {
+        a = 0x0368;
+        r[6] -= 2;
+        WR16(r[6], 0x0362);
+    }
+    AOT_GOTO(0x0368, L0368);
+L0362:
+    AOT_BLOCK(0x0362, 3);
+    // 0362: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0364: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0368:
+    AOT_BLOCK(0x0368, 5);
+    // 0368: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x036c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 036c: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0370: clr c378
+    {
+        a = 0xc378;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0374: jsr pc, 0974
+    {
+        a = 0x0974;
+        r[6] -= 2;
+        WR16(r[6], 0x0378);
+    }
+    AOT_GOTO(0x0974, L0974);
+L0378:
+    AOT_BLOCK(0x0378, 1);
+    // 0378: jsr pc, 0be4
+    {
+        a = 0x0be4;
+        r[6] -= 2;
+        WR16(r[6], 0x037c);
+    }
+    AOT_GOTO(0x0be4, L0be4);
+L037c:
+    AOT_BLOCK(0x037c, 6);
+    // 037c: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0380: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0384: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0388: mov $6ab0, 401a
+    {
+        src = uint16_t(0x6ab0);
+        b = 0x401a;
+        WR16(b, src);
+    }
+    // 038e: mov $1, r4
+    {
+        src = uint16_t(0x0001);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0392: br 044c
+    AOT_GOTO(0x044c, L044c);
+L0394:
+    AOT_BLOCK(0x0394, 4);
+    // 0394: mov *-a(r5), r2
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0398: add $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 039e: tst c35c
+    {
+        a = 0xc35c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03a2: beq 03b0
+    if (Z)
+        AOT_GOTO(0x03b0, L03b0);
+    AOT_GOTO(0x03a4, L03a4);
+L03a4:
+    AOT_BLOCK(0x03a4, 3);
+    // 03a4: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03a6: mov $40c9, -(sp)
+    {
+        src = uint16_t(0x40c9);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03aa: jsr pc, *$19c8
+    {
+        a = 0x19c8;
+        r[6] -= 2;
+        WR16(r[6], 0x03ae);
+    }
+    AOT_GOTO(0x19c8, L19c8);
+L03ae:
+    AOT_BLOCK(0x03ae, 1);
+    // 03ae: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x03b0, L03b0);
+L03b0:
+    AOT_BLOCK(0x03b0, 2);
+    // 03b0: cmpb $2d, (r2)
+    {
+        src = uint8_t(0x2d);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 03b4: bne 0444
+    if (!Z)
+        AOT_GOTO(0x0444, L0444);
+    AOT_GOTO(0x03b6, L03b6);
+L03b6:
+    AOT_BLOCK(0x03b6, 2);
+    // 03b6: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03ba: br 03dc
+    AOT_GOTO(0x03dc, L03dc);
+L03bc:
+    AOT_BLOCK(0x03bc, 2);
+    // 03bc: cmp r0, $65
+    {
+        src = r[0];
+        dst = uint16_t(0x0065);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03c0: beq 042a
+    if (Z)
+        AOT_GOTO(0x042a, L042a);
+    AOT_GOTO(0x03c2, L03c2);
+L03c2:
+    AOT_BLOCK(0x03c2, 2);
+    // 03c2: cmp r0, $6c
+    {
+        src = r[0];
+        dst = uint16_t(0x006c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03c6: beq 0434
+    if (Z)
+        AOT_GOTO(0x0434, L0434);
+    AOT_GOTO(0x03c8, L03c8);
+L03c8:
+    AOT_BLOCK(0x03c8, 2);
+    // 03c8: cmp r0, $6f
+    {
+        src = r[0];
+        dst = uint16_t(0x006f);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03cc: beq 042a
+    if (Z)
+        AOT_GOTO(0x042a, L042a);
+    AOT_GOTO(0x03ce, L03ce);
+L03ce:
+    AOT_BLOCK(0x03ce, 2);
+    // 03ce: cmp r0, $75
+    {
+        src = r[0];
+        dst = uint16_t(0x0075);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03d2: beq 042a
+    if (Z)
+        AOT_GOTO(0x042a, L042a);
+    AOT_GOTO(0x03d4, L03d4);
+L03d4:
+    AOT_BLOCK(0x03d4, 2);
+    // 03d4: cmp r0, $76
+    {
+        src = r[0];
+        dst = uint16_t(0x0076);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03d8: beq 042a
+    if (Z)
+        AOT_GOTO(0x042a, L042a);
+    AOT_GOTO(0x03da, L03da);
+L03da:
+    AOT_BLOCK(0x03da, 1);
+    // 03da: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x03dc, L03dc);
+L03dc:
+    AOT_BLOCK(0x03dc, 4);
+    // 03dc: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 03de: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 03e0: tstb (r0)
+    {
+        a = r[0];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03e2: beq 044a
+    if (Z)
+        AOT_GOTO(0x044a, L044a);
+    AOT_GOTO(0x03e4, L03e4);
+L03e4:
+    AOT_BLOCK(0x03e4, 5);
+    // 03e4: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 03e6: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 03e8: movb (r0), r0
+    {
+        a = r[0];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 03ea: cmp r0, $44
+    {
+        src = r[0];
+        dst = uint16_t(0x0044);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03ee: bne 03bc
+    if (!Z)
+        AOT_GOTO(0x03bc, L03bc);
+    AOT_GOTO(0x03f0, L03f0);
+L03f0:
+    AOT_BLOCK(0x03f0, 2);
+    // 03f0: mov *-a(r5), (sp)
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03f4: jsr pc, *$1ecc
+    {
+        a = 0x1ecc;
+        r[6] -= 2;
+        WR16(r[6], 0x03f8);
+    }
+    AOT_GOTO(0x1ecc, L1ecc);
+L03f8:
+    AOT_BLOCK(0x03f8, 2);
+    // 03f8: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03fc: br 0422
+    AOT_GOTO(0x0422, L0422);
+L03fe:
+    AOT_BLOCK(0x03fe, 3);
+    // 03fe: mov $c590, (sp)
+    {
+        src = uint16_t(0xc590);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0402: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0404: jsr pc, *$1956
+    {
+        a = 0x1956;
+        r[6] -= 2;
+        WR16(r[6], 0x0408);
+    }
+    AOT_GOTO(0x1956, L1956);
+L0408:
+    AOT_BLOCK(0x0408, 3);
+    // 0408: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 040a: tst c364
+    {
+        a = 0xc364;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 040e: beq 041c
+    if (Z)
+        AOT_GOTO(0x041c, L041c);
+    AOT_GOTO(0x0410, L0410);
+L0410:
+    AOT_BLOCK(0x0410, 3);
+    // 0410: mov $c99c, (sp)
+    {
+        src = uint16_t(0xc99c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0414: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0416: jsr pc, *$1956
+    {
+        a = 0x1956;
+        r[6] -= 2;
+        WR16(r[6], 0x041a);
+    }
+    AOT_GOTO(0x1956, L1956);
+L041a:
+    AOT_BLOCK(0x041a, 1);
+    // 041a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x041c, L041c);
+L041c:
+    AOT_BLOCK(0x041c, 1);
+    // 041c: add $2, cdac
+    {
+        src = uint16_t(0x0002);
+        b = 0xcdac;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0422, L0422);
+L0422:
+    AOT_BLOCK(0x0422, 2);
+    // 0422: cmp -8(r5), cdac
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0xcdac;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0428: bgt 03fe
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x03fe, L03fe);
+    AOT_GOTO(0x042a, L042a);
+L042a:
+    AOT_BLOCK(0x042a, 3);
+    // 042a: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 042c: add $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0432: br 03da
+    AOT_GOTO(0x03da, L03da);
+L0434:
+    AOT_BLOCK(0x0434, 7);
+    // 0434: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+    }
+    // 0436: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 0438: add r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 043a: movb $2d, (r0)
+    {
+        src = uint8_t(0x2d);
+        b = r[0];
+        WR8(b, src);
+    }
+    // 043e: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0440: add r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0442: br 0446
+    AOT_GOTO(0x0446, L0446);
+L0444:
+    AOT_BLOCK(0x0444, 1);
+    // 0444: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0446, L0446);
+L0446:
+    AOT_BLOCK(0x0446, 1);
+    // 0446: jsr pc, *$0d8c
+    {
+        a = 0x0d8c;
+        r[6] -= 2;
+        WR16(r[6], 0x044a);
+    }
+    AOT_GOTO(0x0d8c, L0d8c);
+L044a:
+    AOT_BLOCK(0x044a, 1);
+    // 044a: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x044c, L044c);
+L044c:
+    AOT_BLOCK(0x044c, 2);
+    // 044c: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0450: bgt 0394
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0394, L0394);
+    AOT_GOTO(0x0452, L0452);
+L0452:
+    AOT_BLOCK(0x0452, 1);
+    // 0452: jsr pc, 1188
+    {
+        a = 0x1188;
+        r[6] -= 2;
+        WR16(r[6], 0x0456);
+    }
+    AOT_GOTO(0x1188, L1188);
+L0456:
+    AOT_BLOCK(0x0456, 2);
+    // 0456: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L045a:
+    AOT_BLOCK(0x045a, 20);
+    // 045a: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x045e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 045e: mov 6500, r1
+    {
+        a = 0x6500;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0462: mul $16, r1
+    {
+        src = int16_t(uint16_t(0x0016));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0466: inc 6500
+    {
+        a = 0x6500;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 046a: mov r1, r4
+    {
+        src = r[1];
+        r[4] = src;
+    }
+    // 046c: add $6502, r4
+    {
+        src = uint16_t(0x6502);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0470: mov 4(r5), (r4)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 0474: mov ab10, 2(r4)
+    {
+        a = 0xab10;
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 047a: mov 401a, 4(r4)
+    {
+        a = 0x401a;
+        src = RD16(a);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 0480: mov 6(r5), 6(r4)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 0486: mov c37a, e(r4)
+    {
+        a = 0xc37a;
+        src = RD16(a);
+        b = uint16_t(r[4] + 14);
+        WR16(b, src);
+    }
+    // 048c: mov c37c, 10(r4)
+    {
+        a = 0xc37c;
+        src = RD16(a);
+        b = uint16_t(r[4] + 16);
+        WR16(b, src);
+    }
+    // 0492: mov c37e, 12(r4)
+    {
+        a = 0xc37e;
+        src = RD16(a);
+        b = uint16_t(r[4] + 18);
+        WR16(b, src);
+    }
+    // 0498: mov c380, 14(r4)
+    {
+        a = 0xc380;
+        src = RD16(a);
+        b = uint16_t(r[4] + 20);
+        WR16(b, src);
+    }
+    // 049e: mov c382, 8(r4)
+    {
+        a = 0xc382;
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 04a4: mov c384, a(r4)
+    {
+        a = 0xc384;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+    }
+    // 04aa: mov c386, c(r4)
+    {
+        a = 0xc386;
+        src = RD16(a);
+        b = uint16_t(r[4] + 12);
+        WR16(b, src);
+    }
+    // 04b0: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L04b4:
+    AOT_BLOCK(0x04b4, 19);
+    // 04b4: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x04b8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 04b8: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 04bc: mul $16, r1
+    {
+        src = int16_t(uint16_t(0x0016));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 04c0: mov r1, r4
+    {
+        src = r[1];
+        r[4] = src;
+    }
+    // 04c2: add $6502, r4
+    {
+        src = uint16_t(0x6502);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 04c6: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 04ca: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 04cc: mov r0, 6500
+    {
+        src = r[0];
+        b = 0x6500;
+        WR16(b, src);
+    }
+    // 04d0: mov 4(r4), 401a
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = 0x401a;
+        WR16(b, src);
+    }
+    // 04d6: mov 8(r4), c382
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = 0xc382;
+        WR16(b, src);
+    }
+    // 04dc: mov a(r4), c384
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = 0xc384;
+        WR16(b, src);
+    }
+    // 04e2: mov c(r4), c386
+    {
+        a = uint16_t(r[4] + 12);
+        src = RD16(a);
+        b = 0xc386;
+        WR16(b, src);
+    }
+    // 04e8: mov e(r4), c37a
+    {
+        a = uint16_t(r[4] + 14);
+        src = RD16(a);
+        b = 0xc37a;
+        WR16(b, src);
+    }
+    // 04ee: mov 10(r4), c37c
+    {
+        a = uint16_t(r[4] + 16);
+        src = RD16(a);
+        b = 0xc37c;
+        WR16(b, src);
+    }
+    // 04f4: mov 12(r4), c37e
+    {
+        a = uint16_t(r[4] + 18);
+        src = RD16(a);
+        b = 0xc37e;
+        WR16(b, src);
+    }
+    // 04fa: mov 14(r4), c380
+    {
+        a = uint16_t(r[4] + 20);
+        src = RD16(a);
+        b = 0xc380;
+        WR16(b, src);
+    }
+    // 0500: mov 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0504: br 0514
+    AOT_GOTO(0x0514, L0514);
+L0506:
+    AOT_BLOCK(0x0506, 4);
+    // 0506: dec ab10
+    {
+        a = 0xab10;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 050a: mov ab10, r0
+    {
+        a = 0xab10;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 050e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0510: clr *-5d90(r0)
+    {
+        a = RD16(r[0] + -23952);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0514, L0514);
+L0514:
+    AOT_BLOCK(0x0514, 2);
+    // 0514: cmp r3, ab10
+    {
+        src = r[3];
+        b = 0xab10;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0518: blt 0506
+    if (N ^ V)
+        AOT_GOTO(0x0506, L0506);
+    AOT_GOTO(0x051a, L051a);
+L051a:
+    AOT_BLOCK(0x051a, 2);
+    // 051a: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L051e:
+    AOT_BLOCK(0x051e, 6);
+    // 051e: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0522;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 0522: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 0526: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 052a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 052c: jsr pc, *$14ee
+    {
+        a = 0x14ee;
+        r[6] -= 2;
+        WR16(r[6], 0x0530);
+    }
+    AOT_GOTO(0x14ee, L14ee);
+L0530:
+    AOT_BLOCK(0x0530, 2);
+    // 0530: cmp r0, $3
+    {
+        src = r[0];
+        dst = uint16_t(0x0003);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0534: bhi 054a
+    if (!(C | Z))
+        AOT_GOTO(0x054a, L054a);
+    AOT_GOTO(0x0536, L0536);
+L0536:
+    AOT_BLOCK(0x0536, 2);
+    // 0536: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0538: jmp *403a(r0)
+    {
+        a = RD16(r[0] + 16442);
+    }
+    AOT_JUMP(a);
+L053c:
+    AOT_BLOCK(0x053c, 4);
+    // 053c: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        N = false;
+    }
+    // 053e: sxt -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, -int(N));
+    }
+    // 0540: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0542: jsr pc, 07bc
+    {
+        a = 0x07bc;
+        r[6] -= 2;
+        WR16(r[6], 0x0546);
+    }
+    AOT_GOTO(0x07bc, L07bc);
+L0546:
+    AOT_BLOCK(0x0546, 1);
+    // 0546: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x054a, L054a);
+L054a:
+    AOT_BLOCK(0x054a, 2);
+    // 054a: mov c376, (sp)
+    {
+        a = 0xc376;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 054e: jsr pc, *$2264
+    {
+        a = 0x2264;
+        r[6] -= 2;
+        WR16(r[6], 0x0552);
+    }
+    AOT_GOTO(0x2264, L2264);
+L0552:
+    AOT_BLOCK(0x0552, 2);
+    // 0552: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0556:
+    AOT_BLOCK(0x0556, 2);
+    // 0556: mov $1, -8(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 055c: sxt -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, -int(N));
+        Z = !N;
+    }
+    AOT_GOTO(0x0560, L0560);
+L0560:
+    AOT_BLOCK(0x0560, 3);
+    // 0560: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0564: mov -a(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0568: jsr pc, 0678
+    {
+        a = 0x0678;
+        r[6] -= 2;
+        WR16(r[6], 0x056c);
+    }
+    AOT_GOTO(0x0678, L0678);
+L056c:
+    AOT_BLOCK(0x056c, 3);
+    // 056c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 056e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0570: beq 054a
+    if (Z)
+        AOT_GOTO(0x054a, L054a);
+    AOT_GOTO(0x0572, L0572);
+L0572:
+    AOT_BLOCK(0x0572, 10);
+    // 0572: mov 6a9e, r1
+    {
+        a = 0x6a9e;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0576: mov 6a9c, r0
+    {
+        a = 0x6a9c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 057a: add $0, r0
+    {
+        src = uint16_t(0x0000);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 057e: add $1b, r1
+    {
+        src = uint16_t(0x001b);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0582: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+        C = C && val == 0;
+    }
+    // 0584: ashc $ffff, r0
+    {
+        src = uint16_t(0xffff) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 0588: add r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 058c: add r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0590: adc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    // 0594: br 0560
+    AOT_GOTO(0x0560, L0560);
+L0596:
+    AOT_BLOCK(0x0596, 5);
+    // 0596: mov $c, -(sp)
+    {
+        src = uint16_t(0x000c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 059a: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 059c: mov 6a9e, -(sp)
+    {
+        a = 0x6a9e;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05a0: mov 6a9c, -(sp)
+    {
+        a = 0x6a9c;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05a4: jsr pc, 24e4
+    {
+        a = 0x24e4;
+        r[6] -= 2;
+        WR16(r[6], 0x05a8);
+    }
+    AOT_GOTO(0x24e4, L24e4);
+L05a8:
+    AOT_BLOCK(0x05a8, 4);
+    // 05a8: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 05ac: mov r1, 64fe
+    {
+        src = r[1];
+        b = 0x64fe;
+        WR16(b, src);
+    }
+    // 05b0: cmp $2bc, r1
+    {
+        src = uint16_t(0x02bc);
+        dst = r[1];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05b4: bgt 05c4
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x05c4, L05c4);
+    AOT_GOTO(0x05b6, L05b6);
+L05b6:
+    AOT_BLOCK(0x05b6, 3);
+    // 05b6: mov $40ce, (sp)
+    {
+        src = uint16_t(0x40ce);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05ba: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05be: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x05c2);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L05c2:
+    AOT_BLOCK(0x05c2, 1);
+    // 05c2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x05c4, L05c4);
+L05c4:
+    AOT_BLOCK(0x05c4, 5);
+    // 05c4: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 05c6: mov $1c, -(sp)
+    {
+        src = uint16_t(0x001c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05ca: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 05cc: mov c376, -(sp)
+    {
+        a = 0xc376;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05d0: jsr pc, *$2306
+    {
+        a = 0x2306;
+        r[6] -= 2;
+        WR16(r[6], 0x05d4);
+    }
+    AOT_GOTO(0x2306, L2306);
+L05d4:
+    AOT_BLOCK(0x05d4, 7);
+    // 05d4: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 05d8: mov 64fe, r1
+    {
+        a = 0x64fe;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 05dc: mul $c, r1
+    {
+        src = int16_t(uint16_t(0x000c));
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 05e0: mov r1, (sp)
+    {
+        src = r[1];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05e2: mov $442e, -(sp)
+    {
+        src = uint16_t(0x442e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05e6: mov c376, -(sp)
+    {
+        a = 0xc376;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05ea: jsr pc, *$2350
+    {
+        a = 0x2350;
+        r[6] -= 2;
+        WR16(r[6], 0x05ee);
+    }
+    AOT_GOTO(0x2350, L2350);
+L05ee:
+    AOT_BLOCK(0x05ee, 1);
+    // 05ee: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x05f0, L05f0);
+L05f0:
+    AOT_BLOCK(0x05f0, 1);
+    // 05f0: jsr pc, 06fe
+    {
+        a = 0x06fe;
+        r[6] -= 2;
+        WR16(r[6], 0x05f4);
+    }
+    AOT_GOTO(0x06fe, L06fe);
+L05f4:
+    AOT_BLOCK(0x05f4, 2);
+    // 05f4: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05f6: bne 05f0
+    if (!Z)
+        AOT_GOTO(0x05f0, L05f0);
+    AOT_GOTO(0x05f8, L05f8);
+L05f8:
+    AOT_BLOCK(0x05f8, 5);
+    // 05f8: mov 401a, r0
+    {
+        a = 0x401a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 05fc: mov $ffff, 2(r0)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0602: mov $ffff, (r0)
+    {
+        src = uint16_t(0xffff);
+        b = r[0];
+        WR16(b, src);
+    }
+    // 0606: add $4, 401a
+    {
+        src = uint16_t(0x0004);
+        b = 0x401a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 060c: br 054a
+    AOT_GOTO(0x054a, L054a);
+L060e:
+    AOT_BLOCK(0x060e, 3);
+    // 060e: mov $40e9, (sp)
+    {
+        src = uint16_t(0x40e9);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0612: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0614: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x0618);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L0618:
+    AOT_BLOCK(0x0618, 11);
+    // 0618: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 061a: mov 6a9e, r1
+    {
+        a = 0x6a9e;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 061e: mov 6a9c, r0
+    {
+        a = 0x6a9c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0622: add $0, r0
+    {
+        src = uint16_t(0x0000);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0626: add $1b, r1
+    {
+        src = uint16_t(0x001b);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 062a: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+        C = C && val == 0;
+    }
+    // 062c: ashc $ffff, r0
+    {
+        src = uint16_t(0xffff) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 0630: add $1, r1
+    {
+        src = uint16_t(0x0001);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0634: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+        C = C && val == 0;
+    }
+    // 0636: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 063a: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x063e, L063e);
+L063e:
+    AOT_BLOCK(0x063e, 3);
+    // 063e: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0642: mov -a(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0646: jsr pc, 0678
+    {
+        a = 0x0678;
+        r[6] -= 2;
+        WR16(r[6], 0x064a);
+    }
+    AOT_GOTO(0x0678, L0678);
+L064a:
+    AOT_BLOCK(0x064a, 3);
+    // 064a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 064c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 064e: bne 0654
+    if (!Z)
+        AOT_GOTO(0x0654, L0654);
+    AOT_GOTO(0x0650, L0650);
+L0650:
+    AOT_BLOCK(0x0650, 1);
+    // 0650: jmp *$054a
+    {
+        a = 0x054a;
+    }
+    AOT_GOTO(0x054a, L054a);
+L0654:
+    AOT_BLOCK(0x0654, 10);
+    // 0654: mov 6a9e, r1
+    {
+        a = 0x6a9e;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0658: mov 6a9c, r0
+    {
+        a = 0x6a9c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 065c: add $0, r0
+    {
+        src = uint16_t(0x0000);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0660: add $1b, r1
+    {
+        src = uint16_t(0x001b);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0664: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+        C = C && val == 0;
+    }
+    // 0666: ashc $ffff, r0
+    {
+        src = uint16_t(0xffff) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 066a: add r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 066e: add r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0672: adc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    // 0676: br 063e
+    AOT_GOTO(0x063e, L063e);
+L0678:
+    AOT_BLOCK(0x0678, 7);
+    // 0678: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x067c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 067c: mov $1a, (sp)
+    {
+        src = uint16_t(0x001a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0680: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0684: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0688: mov $6a72, -(sp)
+    {
+        src = uint16_t(0x6a72);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 068c: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x0690);
+    }
+    AOT_GOTO(0x1352, L1352);
+L0690:
+    AOT_BLOCK(0x0690, 3);
+    // 0690: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0694: tst 6a78
+    {
+        a = 0x6a78;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0698: bgt 06b4
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x06b4, L06b4);
+    AOT_GOTO(0x069a, L069a);
+L069a:
+    AOT_BLOCK(0x069a, 5);
+    // 069a: mov 401a, r0
+    {
+        a = 0x401a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 069e: mov $ffff, 2(r0)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 06a4: mov $ffff, (r0)
+    {
+        src = uint16_t(0xffff);
+        b = r[0];
+        WR16(b, src);
+    }
+    // 06a8: add $4, 401a
+    {
+        src = uint16_t(0x0004);
+        b = 0x401a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 06ae: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x06b0, L06b0);
+L06b0:
+    AOT_BLOCK(0x06b0, 2);
+    // 06b0: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06b4:
+    AOT_BLOCK(0x06b4, 3);
+    // 06b4: mov $1a, (sp)
+    {
+        src = uint16_t(0x001a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06b8: mov $6a86, -(sp)
+    {
+        src = uint16_t(0x6a86);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06bc: jsr pc, *$12f2
+    {
+        a = 0x12f2;
+        r[6] -= 2;
+        WR16(r[6], 0x06c0);
+    }
+    AOT_GOTO(0x12f2, L12f2);
+L06c0:
+    AOT_BLOCK(0x06c0, 9);
+    // 06c0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 06c2: mov 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 06c6: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 06ca: add $d, r1
+    {
+        src = uint16_t(0x000d);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 06ce: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+        C = C && val == 0;
+    }
+    // 06d0: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06d2: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06d4: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06d8: jsr pc, 07bc
+    {
+        a = 0x07bc;
+        r[6] -= 2;
+        WR16(r[6], 0x06dc);
+    }
+    AOT_GOTO(0x07bc, L07bc);
+L06dc:
+    AOT_BLOCK(0x06dc, 3);
+    // 06dc: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 06e0: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06e2: beq 06f8
+    if (Z)
+        AOT_GOTO(0x06f8, L06f8);
+    AOT_GOTO(0x06e4, L06e4);
+L06e4:
+    AOT_BLOCK(0x06e4, 4);
+    // 06e4: mov 401a, r0
+    {
+        a = 0x401a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 06e8: mov 6(r5), 2(r0)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 06ee: mov 4(r5), (r0)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[0];
+        WR16(b, src);
+    }
+    // 06f2: add $4, 401a
+    {
+        src = uint16_t(0x0004);
+        b = 0x401a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x06f8, L06f8);
+L06f8:
+    AOT_BLOCK(0x06f8, 2);
+    // 06f8: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06fc: br 06b0
+    AOT_GOTO(0x06b0, L06b0);
+L06fe:
+    AOT_BLOCK(0x06fe, 6);
+    // 06fe: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0702;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 0702: sub $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0706: mov 401a, -e(r5)
+    {
+        a = 0x401a;
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 070c: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0710: br 0760
+    AOT_GOTO(0x0760, L0760);
+L0712:
+    AOT_BLOCK(0x0712, 5);
+    // 0712: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0716: mul $c, r1
+    {
+        src = int16_t(uint16_t(0x000c));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 071a: add $442e, r1
+    {
+        src = uint16_t(0x442e);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 071e: mov r1, (sp)
+    {
+        src = r[1];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0720: jsr pc, *$16f6
+    {
+        a = 0x16f6;
+        r[6] -= 2;
+        WR16(r[6], 0x0724);
+    }
+    AOT_GOTO(0x16f6, L16f6);
+L0724:
+    AOT_BLOCK(0x0724, 2);
+    // 0724: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0728: beq 075c
+    if (Z)
+        AOT_GOTO(0x075c, L075c);
+    AOT_GOTO(0x072a, L072a);
+L072a:
+    AOT_BLOCK(0x072a, 4);
+    // 072a: mov *-c(r5), -a(r5)
+    {
+        a = RD16(r[5] + -12);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0730: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0734: cmpb $20, 8(r0)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[0] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 073a: bne 075c
+    if (!Z)
+        AOT_GOTO(0x075c, L075c);
+    AOT_GOTO(0x073c, L073c);
+L073c:
+    AOT_BLOCK(0x073c, 9);
+    // 073c: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0740: mul $c, r1
+    {
+        src = int16_t(uint16_t(0x000c));
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 0744: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 0746: mov 4438(r0), r1
+    {
+        a = uint16_t(r[0] + 17464);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 074a: mov 4436(r0), r0
+    {
+        a = uint16_t(r[0] + 17462);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 074e: ashc $ffff, r0
+    {
+        src = uint16_t(0xffff) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 0752: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0754: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0756: jsr pc, 0678
+    {
+        a = 0x0678;
+        r[6] -= 2;
+        WR16(r[6], 0x075a);
+    }
+    AOT_GOTO(0x0678, L0678);
+L075a:
+    AOT_BLOCK(0x075a, 1);
+    // 075a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x075c, L075c);
+L075c:
+    AOT_BLOCK(0x075c, 1);
+    // 075c: inc -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0760, L0760);
+L0760:
+    AOT_BLOCK(0x0760, 2);
+    // 0760: cmp 64fe, -8(r5)
+    {
+        a = 0x64fe;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0766: bgt 0712
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0712, L0712);
+    AOT_GOTO(0x0768, L0768);
+L0768:
+    AOT_BLOCK(0x0768, 2);
+    // 0768: cmp 401a, -e(r5)
+    {
+        a = 0x401a;
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 076e: bne 0776
+    if (!Z)
+        AOT_GOTO(0x0776, L0776);
+    AOT_GOTO(0x0770, L0770);
+L0770:
+    AOT_BLOCK(0x0770, 1);
+    // 0770: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0772, L0772);
+L0772:
+    AOT_BLOCK(0x0772, 2);
+    // 0772: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0776:
+    AOT_BLOCK(0x0776, 2);
+    // 0776: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 077a: br 0772
+    AOT_GOTO(0x0772, L0772);
+L077c:
+    AOT_BLOCK(0x077c, 11);
+    // 077c: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0780;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 0780: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0784: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0788: clr r0
+    {
+        r[0] = 0;
+    }
+    // 078a: add 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 078e: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+    }
+    // 0790: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0794: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0798: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 079c: bgt 07b4
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x07b4, L07b4);
+    AOT_GOTO(0x079e, L079e);
+L079e:
+    AOT_BLOCK(0x079e, 1);
+    // 079e: blt 07a6
+    if (N ^ V)
+        AOT_GOTO(0x07a6, L07a6);
+    AOT_GOTO(0x07a0, L07a0);
+L07a0:
+    AOT_BLOCK(0x07a0, 2);
+    // 07a0: cmp $0, r1
+    {
+        src = uint16_t(0x0000);
+        dst = r[1];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07a4: bhi 07b4
+    if (!(C | Z))
+        AOT_GOTO(0x07b4, L07b4);
+    AOT_GOTO(0x07a6, L07a6);
+L07a6:
+    AOT_BLOCK(0x07a6, 3);
+    // 07a6: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07aa: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07ae: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x07b2);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L07b2:
+    AOT_BLOCK(0x07b2, 1);
+    // 07b2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x07b4, L07b4);
+L07b4:
+    AOT_BLOCK(0x07b4, 3);
+    // 07b4: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 07b8: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L07bc:
+    AOT_BLOCK(0x07bc, 6);
+    // 07bc: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x07c0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 07c0: sub $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 07c4: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 07c8: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07cc: jsr pc, 188c
+    {
+        a = 0x188c;
+        r[6] -= 2;
+        WR16(r[6], 0x07d0);
+    }
+    AOT_GOTO(0x188c, L188c);
+L07d0:
+    AOT_BLOCK(0x07d0, 11);
+    // 07d0: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 07d2: mov c37a, c382
+    {
+        a = 0xc37a;
+        src = RD16(a);
+        b = 0xc382;
+        WR16(b, src);
+    }
+    // 07d8: add c37c, c384
+    {
+        a = 0xc37c;
+        src = RD16(a);
+        b = 0xc384;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 07de: add c37e, c386
+    {
+        a = 0xc37e;
+        src = RD16(a);
+        b = 0xc386;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 07e4: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+    }
+    // 07e8: mov $c, -c(r5)
+    {
+        src = uint16_t(0x000c);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 07ee: mov ab10, -8(r5)
+    {
+        a = 0xab10;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 07f4: mov 6aae, r0
+    {
+        a = 0x6aae;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 07f8: bic $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 07fc: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0800: bne 0816
+    if (!Z)
+        AOT_GOTO(0x0816, L0816);
+    AOT_GOTO(0x0802, L0802);
+L0802:
+    AOT_BLOCK(0x0802, 3);
+    // 0802: mov $40ff, (sp)
+    {
+        src = uint16_t(0x40ff);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0806: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 080a: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x080e);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L080e:
+    AOT_BLOCK(0x080e, 1);
+    // 080e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0810, L0810);
+L0810:
+    AOT_BLOCK(0x0810, 1);
+    // 0810: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0812, L0812);
+L0812:
+    AOT_BLOCK(0x0812, 2);
+    // 0812: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0816:
+    AOT_BLOCK(0x0816, 12);
+    // 0816: mov 6aa2, r1
+    {
+        a = 0x6aa2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 081a: add 6aa4, r1
+    {
+        a = 0x6aa4;
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 081e: add $8, r1
+    {
+        src = uint16_t(0x0008);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0822: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0824: add r0, 6(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0828: add r1, 8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 082c: adc 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        C = C && val == 0;
+    }
+    // 0830: mov 6aa8, (sp)
+    {
+        a = 0x6aa8;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0834: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0838: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 083c: mov $6a72, -(sp)
+    {
+        src = uint16_t(0x6a72);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0840: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x0844);
+    }
+    AOT_GOTO(0x1352, L1352);
+L0844:
+    AOT_BLOCK(0x0844, 2);
+    // 0844: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0848: br 08e6
+    AOT_GOTO(0x08e6, L08e6);
+L084a:
+    AOT_BLOCK(0x084a, 3);
+    // 084a: mov $c, (sp)
+    {
+        src = uint16_t(0x000c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 084e: mov $6eb0, -(sp)
+    {
+        src = uint16_t(0x6eb0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0852: jsr pc, *$12f2
+    {
+        a = 0x12f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0856);
+    }
+    AOT_GOTO(0x12f2, L12f2);
+L0856:
+    AOT_BLOCK(0x0856, 5);
+    // 0856: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0858: movb 6eb8, r0
+    {
+        a = 0x6eb8;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 085c: mov r0, -e(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 0860: tst c362
+    {
+        a = 0xc362;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0864: beq 087a
+    if (Z)
+        AOT_GOTO(0x087a, L087a);
+    AOT_GOTO(0x0866, L0866);
+L0866:
+    AOT_BLOCK(0x0866, 4);
+    // 0866: bic $ffe0, r0
+    {
+        src = uint16_t(0xffe0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 086a: mov r0, -10(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+    }
+    // 086e: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0872: beq 08e6
+    if (Z)
+        AOT_GOTO(0x08e6, L08e6);
+    AOT_GOTO(0x0874, L0874);
+L0874:
+    AOT_BLOCK(0x0874, 2);
+    // 0874: cmp $4, r0
+    {
+        src = uint16_t(0x0004);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0878: blt 08e6
+    if (N ^ V)
+        AOT_GOTO(0x08e6, L08e6);
+    AOT_GOTO(0x087a, L087a);
+L087a:
+    AOT_BLOCK(0x087a, 2);
+    // 087a: bit $20, -e(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -14);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0880: bne 0898
+    if (!Z)
+        AOT_GOTO(0x0898, L0898);
+    AOT_GOTO(0x0882, L0882);
+L0882:
+    AOT_BLOCK(0x0882, 2);
+    // 0882: tst c360
+    {
+        a = 0xc360;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0886: beq 0890
+    if (Z)
+        AOT_GOTO(0x0890, L0890);
+    AOT_GOTO(0x0888, L0888);
+L0888:
+    AOT_BLOCK(0x0888, 2);
+    // 0888: cmpb $4c, 6eb0
+    {
+        src = uint8_t(0x4c);
+        b = 0x6eb0;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 088e: beq 08e6
+    if (Z)
+        AOT_GOTO(0x08e6, L08e6);
+    AOT_GOTO(0x0890, L0890);
+L0890:
+    AOT_BLOCK(0x0890, 2);
+    // 0890: add $c, -c(r5)
+    {
+        src = uint16_t(0x000c);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0896: br 08e6
+    AOT_GOTO(0x08e6, L08e6);
+L0898:
+    AOT_BLOCK(0x0898, 1);
+    // 0898: jsr pc, 178c
+    {
+        a = 0x178c;
+        r[6] -= 2;
+        WR16(r[6], 0x089c);
+    }
+    AOT_GOTO(0x178c, L178c);
+L089c:
+    AOT_BLOCK(0x089c, 1);
+    // 089c: jsr pc, 1684
+    {
+        a = 0x1684;
+        r[6] -= 2;
+        WR16(r[6], 0x08a0);
+    }
+    AOT_GOTO(0x1684, L1684);
+L08a0:
+    AOT_BLOCK(0x08a0, 2);
+    // 08a0: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08a2: jsr pc, *$171a
+    {
+        a = 0x171a;
+        r[6] -= 2;
+        WR16(r[6], 0x08a6);
+    }
+    AOT_GOTO(0x171a, L171a);
+L08a6:
+    AOT_BLOCK(0x08a6, 2);
+    // 08a6: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08a8: bne 08e6
+    if (!Z)
+        AOT_GOTO(0x08e6, L08e6);
+    AOT_GOTO(0x08aa, L08aa);
+L08aa:
+    AOT_BLOCK(0x08aa, 3);
+    // 08aa: mov ab0e, r4
+    {
+        a = 0xab0e;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 08ae: cmpb $20, 8(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08b4: bne 08e6
+    if (!Z)
+        AOT_GOTO(0x08e6, L08e6);
+    AOT_GOTO(0x08b6, L08b6);
+L08b6:
+    AOT_BLOCK(0x08b6, 2);
+    // 08b6: cmpb $20, 6eb8
+    {
+        src = uint8_t(0x20);
+        b = 0x6eb8;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08bc: bne 08c8
+    if (!Z)
+        AOT_GOTO(0x08c8, L08c8);
+    AOT_GOTO(0x08be, L08be);
+L08be:
+    AOT_BLOCK(0x08be, 2);
+    // 08be: cmp a(r4), 6eba
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = 0x6eba;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08c4: blt 08e0
+    if (N ^ V)
+        AOT_GOTO(0x08e0, L08e0);
+    AOT_GOTO(0x08c6, L08c6);
+L08c6:
+    AOT_BLOCK(0x08c6, 1);
+    // 08c6: br 08e6
+    AOT_GOTO(0x08e6, L08e6);
+L08c8:
+    AOT_BLOCK(0x08c8, 2);
+    // 08c8: tst a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08cc: beq 08d6
+    if (Z)
+        AOT_GOTO(0x08d6, L08d6);
+    AOT_GOTO(0x08ce, L08ce);
+L08ce:
+    AOT_BLOCK(0x08ce, 2);
+    // 08ce: cmpb $22, 6eb8
+    {
+        src = uint8_t(0x22);
+        b = 0x6eb8;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08d4: beq 08e6
+    if (Z)
+        AOT_GOTO(0x08e6, L08e6);
+    AOT_GOTO(0x08d6, L08d6);
+L08d6:
+    AOT_BLOCK(0x08d6, 2);
+    // 08d6: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 08da: movb 6eb8, 8(r4)
+    {
+        a = 0x6eb8;
+        src = RD8(a);
+        b = uint16_t(r[4] + 8);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x08e0, L08e0);
+L08e0:
+    AOT_BLOCK(0x08e0, 1);
+    // 08e0: mov 6eba, a(r4)
+    {
+        a = 0x6eba;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x08e6, L08e6);
+L08e6:
+    AOT_BLOCK(0x08e6, 2);
+    // 08e6: tst 6a78
+    {
+        a = 0x6a78;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08ea: bgt 084a
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x084a, L084a);
+    AOT_GOTO(0x08ec, L08ec);
+L08ec:
+    AOT_BLOCK(0x08ec, 2);
+    // 08ec: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08f0: beq 08f8
+    if (Z)
+        AOT_GOTO(0x08f8, L08f8);
+    AOT_GOTO(0x08f2, L08f2);
+L08f2:
+    AOT_BLOCK(0x08f2, 2);
+    // 08f2: tst -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08f6: beq 0958
+    if (Z)
+        AOT_GOTO(0x0958, L0958);
+    AOT_GOTO(0x08f8, L08f8);
+L08f8:
+    AOT_BLOCK(0x08f8, 4);
+    // 08f8: mov $4112, (sp)
+    {
+        src = uint16_t(0x4112);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 08fc: mov 6aa2, -(sp)
+    {
+        a = 0x6aa2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0900: mov c37a, -(sp)
+    {
+        a = 0xc37a;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0904: jsr pc, *$077c
+    {
+        a = 0x077c;
+        r[6] -= 2;
+        WR16(r[6], 0x0908);
+    }
+    AOT_GOTO(0x077c, L077c);
+L0908:
+    AOT_BLOCK(0x0908, 6);
+    // 0908: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 090a: mov r0, c37a
+    {
+        src = r[0];
+        b = 0xc37a;
+        WR16(b, src);
+    }
+    // 090e: mov $4120, (sp)
+    {
+        src = uint16_t(0x4120);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0912: mov 6aa4, -(sp)
+    {
+        a = 0x6aa4;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0916: mov c37c, -(sp)
+    {
+        a = 0xc37c;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 091a: jsr pc, *$077c
+    {
+        a = 0x077c;
+        r[6] -= 2;
+        WR16(r[6], 0x091e);
+    }
+    AOT_GOTO(0x077c, L077c);
+L091e:
+    AOT_BLOCK(0x091e, 6);
+    // 091e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0920: mov r0, c37c
+    {
+        src = r[0];
+        b = 0xc37c;
+        WR16(b, src);
+    }
+    // 0924: mov $412e, (sp)
+    {
+        src = uint16_t(0x412e);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0928: mov 6aa6, -(sp)
+    {
+        a = 0x6aa6;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 092c: mov c37e, -(sp)
+    {
+        a = 0xc37e;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0930: jsr pc, *$077c
+    {
+        a = 0x077c;
+        r[6] -= 2;
+        WR16(r[6], 0x0934);
+    }
+    AOT_GOTO(0x077c, L077c);
+L0934:
+    AOT_BLOCK(0x0934, 6);
+    // 0934: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0936: mov r0, c37e
+    {
+        src = r[0];
+        b = 0xc37e;
+        WR16(b, src);
+    }
+    // 093a: mov $413b, (sp)
+    {
+        src = uint16_t(0x413b);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 093e: mov -c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0942: mov c380, -(sp)
+    {
+        a = 0xc380;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0946: jsr pc, *$077c
+    {
+        a = 0x077c;
+        r[6] -= 2;
+        WR16(r[6], 0x094a);
+    }
+    AOT_GOTO(0x077c, L077c);
+L094a:
+    AOT_BLOCK(0x094a, 4);
+    // 094a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 094c: mov r0, c380
+    {
+        src = r[0];
+        b = 0xc380;
+        WR16(b, src);
+    }
+    // 0950: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0954: jmp *$0812
+    {
+        a = 0x0812;
+    }
+    AOT_GOTO(0x0812, L0812);
+L0958:
+    AOT_BLOCK(0x0958, 2);
+    // 0958: cmp -8(r5), ab10
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0xab10;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 095e: blt 0964
+    if (N ^ V)
+        AOT_GOTO(0x0964, L0964);
+    AOT_GOTO(0x0960, L0960);
+L0960:
+    AOT_BLOCK(0x0960, 1);
+    // 0960: jmp *$0810
+    {
+        a = 0x0810;
+    }
+    AOT_GOTO(0x0810, L0810);
+L0964:
+    AOT_BLOCK(0x0964, 5);
+    // 0964: dec ab10
+    {
+        a = 0xab10;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0968: mov ab10, r0
+    {
+        a = 0xab10;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 096c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 096e: clr *-5d90(r0)
+    {
+        a = RD16(r[0] + -23952);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0972: br 0958
+    AOT_GOTO(0x0958, L0958);
+L0974:
+    AOT_BLOCK(0x0974, 8);
+    // 0974: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0978;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 0978: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 097c: clr cdaa
+    {
+        a = 0xcdaa;
+        WR16(a, 0);
+    }
+    // 0980: clr cdac
+    {
+        a = 0xcdac;
+        WR16(a, 0);
+    }
+    // 0984: clr cdae
+    {
+        a = 0xcdae;
+        WR16(a, 0);
+        C = false;
+    }
+    // 0988: mov $4151, (sp)
+    {
+        src = uint16_t(0x4151);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 098c: jsr pc, *$16f6
+    {
+        a = 0x16f6;
+        r[6] -= 2;
+        WR16(r[6], 0x0990);
+    }
+    AOT_GOTO(0x16f6, L16f6);
+L0990:
+    AOT_BLOCK(0x0990, 3);
+    // 0990: mov (r0), c354
+    {
+        a = r[0];
+        src = RD16(a);
+        b = 0xc354;
+        WR16(b, src);
+    }
+    // 0994: mov $4158, (sp)
+    {
+        src = uint16_t(0x4158);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0998: jsr pc, *$16f6
+    {
+        a = 0x16f6;
+        r[6] -= 2;
+        WR16(r[6], 0x099c);
+    }
+    AOT_GOTO(0x16f6, L16f6);
+L099c:
+    AOT_BLOCK(0x099c, 3);
+    // 099c: mov (r0), c356
+    {
+        a = r[0];
+        src = RD16(a);
+        b = 0xc356;
+        WR16(b, src);
+    }
+    // 09a0: mov $415f, (sp)
+    {
+        src = uint16_t(0x415f);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09a4: jsr pc, *$16f6
+    {
+        a = 0x16f6;
+        r[6] -= 2;
+        WR16(r[6], 0x09a8);
+    }
+    AOT_GOTO(0x16f6, L16f6);
+L09a8:
+    AOT_BLOCK(0x09a8, 7);
+    // 09a8: mov (r0), c358
+    {
+        a = r[0];
+        src = RD16(a);
+        b = 0xc358;
+        WR16(b, src);
+    }
+    // 09ac: mov ab10, r1
+    {
+        a = 0xab10;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 09b0: mul $c, r1
+    {
+        src = int16_t(uint16_t(0x000c));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 09b4: mov r1, r3
+    {
+        src = r[1];
+        r[3] = src;
+    }
+    // 09b6: add $6ebc, r3
+    {
+        src = uint16_t(0x6ebc);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 09ba: tst c364
+    {
+        a = 0xc364;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09be: bne 09f0
+    if (!Z)
+        AOT_GOTO(0x09f0, L09f0);
+    AOT_GOTO(0x09c0, L09c0);
+L09c0:
+    AOT_BLOCK(0x09c0, 1);
+    // 09c0: mov $6ebc, r4
+    {
+        src = uint16_t(0x6ebc);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x09c4, L09c4);
+L09c4:
+    AOT_BLOCK(0x09c4, 2);
+    // 09c4: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09c6: blos 09f0
+    if (C | Z)
+        AOT_GOTO(0x09f0, L09f0);
+    AOT_GOTO(0x09c8, L09c8);
+L09c8:
+    AOT_BLOCK(0x09c8, 2);
+    // 09c8: cmpb $20, 8(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 09ce: bne 0a90
+    if (!Z)
+        AOT_GOTO(0x0a90, L0a90);
+    AOT_GOTO(0x09d0, L09d0);
+L09d0:
+    AOT_BLOCK(0x09d0, 2);
+    // 09d0: tst a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09d4: bne 0a90
+    if (!Z)
+        AOT_GOTO(0x0a90, L0a90);
+    AOT_GOTO(0x09d6, L09d6);
+L09d6:
+    AOT_BLOCK(0x09d6, 2);
+    // 09d6: cmp c358, r4
+    {
+        a = 0xc358;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09da: beq 0a90
+    if (Z)
+        AOT_GOTO(0x0a90, L0a90);
+    AOT_GOTO(0x09dc, L09dc);
+L09dc:
+    AOT_BLOCK(0x09dc, 2);
+    // 09dc: cmp c356, r4
+    {
+        a = 0xc356;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09e0: beq 0a90
+    if (Z)
+        AOT_GOTO(0x0a90, L0a90);
+    AOT_GOTO(0x09e2, L09e2);
+L09e2:
+    AOT_BLOCK(0x09e2, 2);
+    // 09e2: cmp c354, r4
+    {
+        a = 0xc354;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09e6: beq 0a90
+    if (Z)
+        AOT_GOTO(0x0a90, L0a90);
+    AOT_GOTO(0x09e8, L09e8);
+L09e8:
+    AOT_BLOCK(0x09e8, 2);
+    // 09e8: inc c364
+    {
+        a = 0xc364;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09ec: clr c36e
+    {
+        a = 0xc36e;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x09f0, L09f0);
+L09f0:
+    AOT_BLOCK(0x09f0, 2);
+    // 09f0: tst c364
+    {
+        a = 0xc364;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09f4: beq 0a08
+    if (Z)
+        AOT_GOTO(0x0a08, L0a08);
+    AOT_GOTO(0x09f6, L09f6);
+L09f6:
+    AOT_BLOCK(0x09f6, 5);
+    // 09f6: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 09f8: mov r0, c36c
+    {
+        src = r[0];
+        b = 0xc36c;
+        WR16(b, src);
+    }
+    // 09fc: mov r0, c370
+    {
+        src = r[0];
+        b = 0xc370;
+        WR16(b, src);
+    }
+    // 0a00: mov r0, c368
+    {
+        src = r[0];
+        b = 0xc368;
+        WR16(b, src);
+    }
+    // 0a04: mov r0, c36a
+    {
+        src = r[0];
+        b = 0xc36a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a08, L0a08);
+L0a08:
+    AOT_BLOCK(0x0a08, 3);
+    // 0a08: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+    }
+    // 0a0c: tst c36e
+    {
+        a = 0xc36e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a10: bne 0a18
+    if (!Z)
+        AOT_GOTO(0x0a18, L0a18);
+    AOT_GOTO(0x0a12, L0a12);
+L0a12:
+    AOT_BLOCK(0x0a12, 2);
+    // 0a12: tst c364
+    {
+        a = 0xc364;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a16: bne 0a96
+    if (!Z)
+        AOT_GOTO(0x0a96, L0a96);
+    AOT_GOTO(0x0a18, L0a18);
+L0a18:
+    AOT_BLOCK(0x0a18, 4);
+    // 0a18: mov $22, (sp)
+    {
+        src = uint16_t(0x0022);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a1c: mov c37a, -(sp)
+    {
+        a = 0xc37a;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a20: mov c354, -(sp)
+    {
+        a = 0xc354;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a24: jsr pc, *$0ba0
+    {
+        a = 0x0ba0;
+        r[6] -= 2;
+        WR16(r[6], 0x0a28);
+    }
+    AOT_GOTO(0x0ba0, L0ba0);
+L0a28:
+    AOT_BLOCK(0x0a28, 5);
+    // 0a28: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0a2a: mov $23, (sp)
+    {
+        src = uint16_t(0x0023);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a2e: mov c37c, -(sp)
+    {
+        a = 0xc37c;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a32: mov c356, -(sp)
+    {
+        a = 0xc356;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a36: jsr pc, *$0ba0
+    {
+        a = 0x0ba0;
+        r[6] -= 2;
+        WR16(r[6], 0x0a3a);
+    }
+    AOT_GOTO(0x0ba0, L0ba0);
+L0a3a:
+    AOT_BLOCK(0x0a3a, 5);
+    // 0a3a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0a3c: mov $24, (sp)
+    {
+        src = uint16_t(0x0024);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a40: mov c37e, -(sp)
+    {
+        a = 0xc37e;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a44: mov c358, -(sp)
+    {
+        a = 0xc358;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a48: jsr pc, *$0ba0
+    {
+        a = 0x0ba0;
+        r[6] -= 2;
+        WR16(r[6], 0x0a4c);
+    }
+    AOT_GOTO(0x0ba0, L0ba0);
+L0a4c:
+    AOT_BLOCK(0x0a4c, 2);
+    // 0a4c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0a4e: mov $6ebc, r4
+    {
+        src = uint16_t(0x6ebc);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a52, L0a52);
+L0a52:
+    AOT_BLOCK(0x0a52, 2);
+    // 0a52: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a54: blos 0a96
+    if (C | Z)
+        AOT_GOTO(0x0a96, L0a96);
+    AOT_GOTO(0x0a56, L0a56);
+L0a56:
+    AOT_BLOCK(0x0a56, 2);
+    // 0a56: cmpb $20, 8(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a5c: bne 0a8a
+    if (!Z)
+        AOT_GOTO(0x0a8a, L0a8a);
+    AOT_GOTO(0x0a5e, L0a5e);
+L0a5e:
+    AOT_BLOCK(0x0a5e, 2);
+    // 0a5e: mov a(r4), r2
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a62: beq 0a8a
+    if (Z)
+        AOT_GOTO(0x0a8a, L0a8a);
+    AOT_GOTO(0x0a64, L0a64);
+L0a64:
+    AOT_BLOCK(0x0a64, 8);
+    // 0a64: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 0a66: bic $1, r2
+    {
+        src = uint16_t(0x0001);
+        dst = r[2];
+        val = (~src) & dst;
+        r[2] = val;
+    }
+    // 0a6a: mov -8(r5), a(r4)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+    }
+    // 0a70: movb $25, 8(r4)
+    {
+        src = uint8_t(0x25);
+        b = uint16_t(r[4] + 8);
+        WR8(b, src);
+    }
+    // 0a76: mov $4164, (sp)
+    {
+        src = uint16_t(0x4164);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a7a: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a7c: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a80: jsr pc, *$077c
+    {
+        a = 0x077c;
+        r[6] -= 2;
+        WR16(r[6], 0x0a84);
+    }
+    AOT_GOTO(0x077c, L077c);
+L0a84:
+    AOT_BLOCK(0x0a84, 2);
+    // 0a84: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0a86: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a8a, L0a8a);
+L0a8a:
+    AOT_BLOCK(0x0a8a, 2);
+    // 0a8a: add $c, r4
+    {
+        src = uint16_t(0x000c);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0a8e: br 0a52
+    AOT_GOTO(0x0a52, L0a52);
+L0a90:
+    AOT_BLOCK(0x0a90, 2);
+    // 0a90: add $c, r4
+    {
+        src = uint16_t(0x000c);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0a94: br 09c4
+    AOT_GOTO(0x09c4, L09c4);
+L0a96:
+    AOT_BLOCK(0x0a96, 2);
+    // 0a96: tst c36a
+    {
+        a = 0xc36a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a9a: bne 0aa2
+    if (!Z)
+        AOT_GOTO(0x0aa2, L0aa2);
+    AOT_GOTO(0x0a9c, L0a9c);
+L0a9c:
+    AOT_BLOCK(0x0a9c, 2);
+    // 0a9c: tst c370
+    {
+        a = 0xc370;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0aa0: beq 0ab2
+    if (Z)
+        AOT_GOTO(0x0ab2, L0ab2);
+    AOT_GOTO(0x0aa2, L0aa2);
+L0aa2:
+    AOT_BLOCK(0x0aa2, 4);
+    // 0aa2: mov c37a, r0
+    {
+        a = 0xc37a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0aa6: add $3f, r0
+    {
+        src = uint16_t(0x003f);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0aaa: bic $3f, r0
+    {
+        src = uint16_t(0x003f);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0aae: mov r0, c37a
+    {
+        src = r[0];
+        b = 0xc37a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ab2, L0ab2);
+L0ab2:
+    AOT_BLOCK(0x0ab2, 3);
+    // 0ab2: mov c37a, cdac
+    {
+        a = 0xc37a;
+        src = RD16(a);
+        b = 0xcdac;
+        WR16(b, src);
+    }
+    // 0ab8: tst c36a
+    {
+        a = 0xc36a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0abc: beq 0ace
+    if (Z)
+        AOT_GOTO(0x0ace, L0ace);
+    AOT_GOTO(0x0abe, L0abe);
+L0abe:
+    AOT_BLOCK(0x0abe, 4);
+    // 0abe: mov c37a, r0
+    {
+        a = 0xc37a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0ac2: add $1fff, r0
+    {
+        src = uint16_t(0x1fff);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0ac6: bic $1fff, r0
+    {
+        src = uint16_t(0x1fff);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0aca: mov r0, cdac
+    {
+        src = r[0];
+        b = 0xcdac;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ace, L0ace);
+L0ace:
+    AOT_BLOCK(0x0ace, 2);
+    // 0ace: tst c370
+    {
+        a = 0xc370;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ad2: beq 0ad8
+    if (Z)
+        AOT_GOTO(0x0ad8, L0ad8);
+    AOT_GOTO(0x0ad4, L0ad4);
+L0ad4:
+    AOT_BLOCK(0x0ad4, 1);
+    // 0ad4: clr cdac
+    {
+        a = 0xcdac;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0ad8, L0ad8);
+L0ad8:
+    AOT_BLOCK(0x0ad8, 7);
+    // 0ad8: mov cdac, r0
+    {
+        a = 0xcdac;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0adc: add c37c, r0
+    {
+        a = 0xc37c;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0ae0: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0ae4: add -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0ae8: mov r0, cdae
+    {
+        src = r[0];
+        b = 0xcdae;
+        WR16(b, src);
+    }
+    // 0aec: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0af0: mov $6ebc, r4
+    {
+        src = uint16_t(0x6ebc);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0af4, L0af4);
+L0af4:
+    AOT_BLOCK(0x0af4, 2);
+    // 0af4: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0af6: blos 0b68
+    if (C | Z)
+        AOT_GOTO(0x0b68, L0b68);
+    AOT_GOTO(0x0af8, L0af8);
+L0af8:
+    AOT_BLOCK(0x0af8, 4);
+    // 0af8: movb 8(r4), r0
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0afc: sub $20, r0
+    {
+        src = uint16_t(0x0020);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0b00: cmp r0, $5
+    {
+        src = r[0];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b04: bhi 0b3c
+    if (!(C | Z))
+        AOT_GOTO(0x0b3c, L0b3c);
+    AOT_GOTO(0x0b06, L0b06);
+L0b06:
+    AOT_BLOCK(0x0b06, 2);
+    // 0b06: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0b08: jmp *4042(r0)
+    {
+        a = RD16(r[0] + 16450);
+    }
+    AOT_JUMP(a);
+L0b0c:
+    AOT_BLOCK(0x0b0c, 3);
+    // 0b0c: bis $1, c388
+    {
+        src = uint16_t(0x0001);
+        b = 0xc388;
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0b12: tst c366
+    {
+        a = 0xc366;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b16: bne 0b3c
+    if (!Z)
+        AOT_GOTO(0x0b3c, L0b3c);
+    AOT_GOTO(0x0b18, L0b18);
+L0b18:
+    AOT_BLOCK(0x0b18, 2);
+    // 0b18: tst a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b1c: bne 0b3c
+    if (!Z)
+        AOT_GOTO(0x0b3c, L0b3c);
+    AOT_GOTO(0x0b1e, L0b1e);
+L0b1e:
+    AOT_BLOCK(0x0b1e, 2);
+    // 0b1e: tst -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b22: bne 0b2c
+    if (!Z)
+        AOT_GOTO(0x0b2c, L0b2c);
+    AOT_GOTO(0x0b24, L0b24);
+L0b24:
+    AOT_BLOCK(0x0b24, 2);
+    // 0b24: mov $4171, (sp)
+    {
+        src = uint16_t(0x4171);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b28: jsr pc, *$19c8
+    {
+        a = 0x19c8;
+        r[6] -= 2;
+        WR16(r[6], 0x0b2c);
+    }
+    AOT_GOTO(0x19c8, L19c8);
+L0b2c:
+    AOT_BLOCK(0x0b2c, 4);
+    // 0b2c: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0b30: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b32: mov $417d, -(sp)
+    {
+        src = uint16_t(0x417d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b36: jsr pc, *$19c8
+    {
+        a = 0x19c8;
+        r[6] -= 2;
+        WR16(r[6], 0x0b3a);
+    }
+    AOT_GOTO(0x19c8, L19c8);
+L0b3a:
+    AOT_BLOCK(0x0b3a, 1);
+    // 0b3a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0b3c, L0b3c);
+L0b3c:
+    AOT_BLOCK(0x0b3c, 2);
+    // 0b3c: add $c, r4
+    {
+        src = uint16_t(0x000c);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0b40: br 0af4
+    AOT_GOTO(0x0af4, L0af4);
+L0b42:
+    AOT_BLOCK(0x0b42, 2);
+    // 0b42: add cdaa, a(r4)
+    {
+        a = 0xcdaa;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0b48: br 0b3c
+    AOT_GOTO(0x0b3c, L0b3c);
+L0b4a:
+    AOT_BLOCK(0x0b4a, 2);
+    // 0b4a: add cdac, a(r4)
+    {
+        a = 0xcdac;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0b50: br 0b3c
+    AOT_GOTO(0x0b3c, L0b3c);
+L0b52:
+    AOT_BLOCK(0x0b52, 2);
+    // 0b52: add cdae, a(r4)
+    {
+        a = 0xcdae;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0b58: br 0b3c
+    AOT_GOTO(0x0b3c, L0b3c);
+L0b5a:
+    AOT_BLOCK(0x0b5a, 3);
+    // 0b5a: movb $24, 8(r4)
+    {
+        src = uint8_t(0x24);
+        b = uint16_t(r[4] + 8);
+        WR8(b, src);
+    }
+    // 0b60: add -c(r5), a(r4)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0b66: br 0b3c
+    AOT_GOTO(0x0b3c, L0b3c);
+L0b68:
+    AOT_BLOCK(0x0b68, 2);
+    // 0b68: tst c368
+    {
+        a = 0xc368;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b6c: bne 0b74
+    if (!Z)
+        AOT_GOTO(0x0b74, L0b74);
+    AOT_GOTO(0x0b6e, L0b6e);
+L0b6e:
+    AOT_BLOCK(0x0b6e, 2);
+    // 0b6e: tst c35e
+    {
+        a = 0xc35e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b72: beq 0b78
+    if (Z)
+        AOT_GOTO(0x0b78, L0b78);
+    AOT_GOTO(0x0b74, L0b74);
+L0b74:
+    AOT_BLOCK(0x0b74, 1);
+    // 0b74: clr c380
+    {
+        a = 0xc380;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0b78, L0b78);
+L0b78:
+    AOT_BLOCK(0x0b78, 4);
+    // 0b78: mov $4183, (sp)
+    {
+        src = uint16_t(0x4183);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b7c: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b80: mov c37e, -(sp)
+    {
+        a = 0xc37e;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b84: jsr pc, *$077c
+    {
+        a = 0x077c;
+        r[6] -= 2;
+        WR16(r[6], 0x0b88);
+    }
+    AOT_GOTO(0x077c, L077c);
+L0b88:
+    AOT_BLOCK(0x0b88, 8);
+    // 0b88: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0b8a: mov r0, c37e
+    {
+        src = r[0];
+        b = 0xc37e;
+        WR16(b, src);
+    }
+    // 0b8e: mov c380, r1
+    {
+        a = 0xc380;
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 0b92: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0b94: div $c, r0
+    {
+        src = int16_t(uint16_t(0x000c));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0b98: mov r0, cda8
+    {
+        src = r[0];
+        b = 0xcda8;
+        WR16(b, src);
+    }
+    // 0b9c: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ba0:
+    AOT_BLOCK(0x0ba0, 4);
+    // 0ba0: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0ba4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 0ba4: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ba8: beq 0be0
+    if (Z)
+        AOT_GOTO(0x0be0, L0be0);
+    AOT_GOTO(0x0baa, L0baa);
+L0baa:
+    AOT_BLOCK(0x0baa, 2);
+    // 0baa: cmpb $20, 8(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0bb0: bne 0bb8
+    if (!Z)
+        AOT_GOTO(0x0bb8, L0bb8);
+    AOT_GOTO(0x0bb2, L0bb2);
+L0bb2:
+    AOT_BLOCK(0x0bb2, 2);
+    // 0bb2: tst a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0bb6: beq 0bd4
+    if (Z)
+        AOT_GOTO(0x0bd4, L0bd4);
+    AOT_GOTO(0x0bb8, L0bb8);
+L0bb8:
+    AOT_BLOCK(0x0bb8, 3);
+    // 0bb8: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bba: mov $4190, -(sp)
+    {
+        src = uint16_t(0x4190);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bbe: jsr pc, *$19c8
+    {
+        a = 0x19c8;
+        r[6] -= 2;
+        WR16(r[6], 0x0bc2);
+    }
+    AOT_GOTO(0x19c8, L19c8);
+L0bc2:
+    AOT_BLOCK(0x0bc2, 4);
+    // 0bc2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0bc4: mov $4197, (sp)
+    {
+        src = uint16_t(0x4197);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bc8: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bcc: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x0bd0);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L0bd0:
+    AOT_BLOCK(0x0bd0, 2);
+    // 0bd0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0bd2: br 0be0
+    AOT_GOTO(0x0be0, L0be0);
+L0bd4:
+    AOT_BLOCK(0x0bd4, 2);
+    // 0bd4: movb 8(r5), 8(r4)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD8(a);
+        b = uint16_t(r[4] + 8);
+        WR8(b, src);
+    }
+    // 0bda: mov 6(r5), a(r4)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0be0, L0be0);
+L0be0:
+    AOT_BLOCK(0x0be0, 2);
+    // 0be0: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0be4:
+    AOT_BLOCK(0x0be4, 5);
+    // 0be4: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0be8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 0be8: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0bea: mov $c38a, -(sp)
+    {
+        src = uint16_t(0xc38a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bee: jsr pc, *$0d04
+    {
+        a = 0x0d04;
+        r[6] -= 2;
+        WR16(r[6], 0x0bf2);
+    }
+    AOT_GOTO(0x0d04, L0d04);
+L0bf2:
+    AOT_BLOCK(0x0bf2, 3);
+    // 0bf2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0bf4: mov $4020, (sp)
+    {
+        src = uint16_t(0x4020);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bf8: jsr pc, *$2156
+    {
+        a = 0x2156;
+        r[6] -= 2;
+        WR16(r[6], 0x0bfc);
+    }
+    AOT_GOTO(0x2156, L2156);
+L0bfc:
+    AOT_BLOCK(0x0bfc, 3);
+    // 0bfc: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c00: mov $c590, -(sp)
+    {
+        src = uint16_t(0xc590);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c04: jsr pc, *$0d04
+    {
+        a = 0x0d04;
+        r[6] -= 2;
+        WR16(r[6], 0x0c08);
+    }
+    AOT_GOTO(0x0d04, L0d04);
+L0c08:
+    AOT_BLOCK(0x0c08, 3);
+    // 0c08: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0c0a: tst c368
+    {
+        a = 0xc368;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c0e: beq 0c16
+    if (Z)
+        AOT_GOTO(0x0c16, L0c16);
+    AOT_GOTO(0x0c10, L0c10);
+L0c10:
+    AOT_BLOCK(0x0c10, 2);
+    // 0c10: tst c35e
+    {
+        a = 0xc35e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c14: bne 0c24
+    if (!Z)
+        AOT_GOTO(0x0c24, L0c24);
+    AOT_GOTO(0x0c16, L0c16);
+L0c16:
+    AOT_BLOCK(0x0c16, 3);
+    // 0c16: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c1a: mov $cba2, -(sp)
+    {
+        src = uint16_t(0xcba2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c1e: jsr pc, *$0d04
+    {
+        a = 0x0d04;
+        r[6] -= 2;
+        WR16(r[6], 0x0c22);
+    }
+    AOT_GOTO(0x0d04, L0d04);
+L0c22:
+    AOT_BLOCK(0x0c22, 1);
+    // 0c22: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0c24, L0c24);
+L0c24:
+    AOT_BLOCK(0x0c24, 2);
+    // 0c24: tst c364
+    {
+        a = 0xc364;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c28: beq 0c46
+    if (Z)
+        AOT_GOTO(0x0c46, L0c46);
+    AOT_GOTO(0x0c2a, L0c2a);
+L0c2a:
+    AOT_BLOCK(0x0c2a, 3);
+    // 0c2a: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c2e: mov $c796, -(sp)
+    {
+        src = uint16_t(0xc796);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c32: jsr pc, *$0d04
+    {
+        a = 0x0d04;
+        r[6] -= 2;
+        WR16(r[6], 0x0c36);
+    }
+    AOT_GOTO(0x0d04, L0d04);
+L0c36:
+    AOT_BLOCK(0x0c36, 4);
+    // 0c36: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0c38: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c3c: mov $c99c, -(sp)
+    {
+        src = uint16_t(0xc99c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c40: jsr pc, *$0d04
+    {
+        a = 0x0d04;
+        r[6] -= 2;
+        WR16(r[6], 0x0c44);
+    }
+    AOT_GOTO(0x0d04, L0d04);
+L0c44:
+    AOT_BLOCK(0x0c44, 1);
+    // 0c44: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0c46, L0c46);
+L0c46:
+    AOT_BLOCK(0x0c46, 2);
+    // 0c46: tst c36c
+    {
+        a = 0xc36c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c4a: beq 0c52
+    if (Z)
+        AOT_GOTO(0x0c52, L0c52);
+    AOT_GOTO(0x0c4c, L0c4c);
+L0c4c:
+    AOT_BLOCK(0x0c4c, 2);
+    // 0c4c: mov $105, r0
+    {
+        src = uint16_t(0x0105);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c50: br 0c6e
+    AOT_GOTO(0x0c6e, L0c6e);
+L0c52:
+    AOT_BLOCK(0x0c52, 2);
+    // 0c52: tst c370
+    {
+        a = 0xc370;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c56: beq 0c5e
+    if (Z)
+        AOT_GOTO(0x0c5e, L0c5e);
+    AOT_GOTO(0x0c58, L0c58);
+L0c58:
+    AOT_BLOCK(0x0c58, 2);
+    // 0c58: mov $109, r0
+    {
+        src = uint16_t(0x0109);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c5c: br 0c6e
+    AOT_GOTO(0x0c6e, L0c6e);
+L0c5e:
+    AOT_BLOCK(0x0c5e, 2);
+    // 0c5e: tst c36a
+    {
+        a = 0xc36a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c62: beq 0c6a
+    if (Z)
+        AOT_GOTO(0x0c6a, L0c6a);
+    AOT_GOTO(0x0c64, L0c64);
+L0c64:
+    AOT_BLOCK(0x0c64, 2);
+    // 0c64: mov $108, r0
+    {
+        src = uint16_t(0x0108);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c68: br 0c6e
+    AOT_GOTO(0x0c6e, L0c6e);
+L0c6a:
+    AOT_BLOCK(0x0c6a, 1);
+    // 0c6a: mov $107, r0
+    {
+        src = uint16_t(0x0107);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c6e, L0c6e);
+L0c6e:
+    AOT_BLOCK(0x0c6e, 6);
+    // 0c6e: mov r0, 6aa0
+    {
+        src = r[0];
+        b = 0x6aa0;
+        WR16(b, src);
+    }
+    // 0c72: mov c37a, 6aa2
+    {
+        a = 0xc37a;
+        src = RD16(a);
+        b = 0x6aa2;
+        WR16(b, src);
+    }
+    // 0c78: mov c37c, 6aa4
+    {
+        a = 0xc37c;
+        src = RD16(a);
+        b = 0x6aa4;
+        WR16(b, src);
+    }
+    // 0c7e: mov c37e, 6aa6
+    {
+        a = 0xc37e;
+        src = RD16(a);
+        b = 0x6aa6;
+        WR16(b, src);
+    }
+    // 0c84: tst c368
+    {
+        a = 0xc368;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c88: beq 0c8e
+    if (Z)
+        AOT_GOTO(0x0c8e, L0c8e);
+    AOT_GOTO(0x0c8a, L0c8a);
+L0c8a:
+    AOT_BLOCK(0x0c8a, 2);
+    // 0c8a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0c8c: br 0c9c
+    AOT_GOTO(0x0c9c, L0c9c);
+L0c8e:
+    AOT_BLOCK(0x0c8e, 4);
+    // 0c8e: mov ab10, r1
+    {
+        a = 0xab10;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0c92: mul $c, r1
+    {
+        src = int16_t(uint16_t(0x000c));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0c96: add c380, r1
+    {
+        a = 0xc380;
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0c9a: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c9c, L0c9c);
+L0c9c:
+    AOT_BLOCK(0x0c9c, 3);
+    // 0c9c: mov r0, 6aa8
+    {
+        src = r[0];
+        b = 0x6aa8;
+        WR16(b, src);
+    }
+    // 0ca0: tst c35a
+    {
+        a = 0xc35a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ca4: beq 0cd4
+    if (Z)
+        AOT_GOTO(0x0cd4, L0cd4);
+    AOT_GOTO(0x0ca6, L0ca6);
+L0ca6:
+    AOT_BLOCK(0x0ca6, 3);
+    // 0ca6: mov c35a, r0
+    {
+        a = 0xc35a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0caa: cmpb $22, 8(r0)
+    {
+        src = uint8_t(0x22);
+        b = uint16_t(r[0] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0cb0: beq 0cc2
+    if (Z)
+        AOT_GOTO(0x0cc2, L0cc2);
+    AOT_GOTO(0x0cb2, L0cb2);
+L0cb2:
+    AOT_BLOCK(0x0cb2, 3);
+    // 0cb2: mov $41a8, (sp)
+    {
+        src = uint16_t(0x41a8);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0cb6: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cba: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x0cbe);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L0cbe:
+    AOT_BLOCK(0x0cbe, 2);
+    // 0cbe: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0cc0: br 0cd8
+    AOT_GOTO(0x0cd8, L0cd8);
+L0cc2:
+    AOT_BLOCK(0x0cc2, 5);
+    // 0cc2: mov c35a, r0
+    {
+        a = 0xc35a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0cc6: mov a(r0), r0
+    {
+        a = uint16_t(r[0] + 10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0cca: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 0cce: mov r0, 6aaa
+    {
+        src = r[0];
+        b = 0x6aaa;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cd2: br 0cd8
+    AOT_GOTO(0x0cd8, L0cd8);
+L0cd4:
+    AOT_BLOCK(0x0cd4, 1);
+    // 0cd4: clr 6aaa
+    {
+        a = 0x6aaa;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0cd8, L0cd8);
+L0cd8:
+    AOT_BLOCK(0x0cd8, 3);
+    // 0cd8: clr 6aac
+    {
+        a = 0x6aac;
+        WR16(a, 0);
+    }
+    // 0cdc: tst c364
+    {
+        a = 0xc364;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ce0: beq 0ce6
+    if (Z)
+        AOT_GOTO(0x0ce6, L0ce6);
+    AOT_GOTO(0x0ce2, L0ce2);
+L0ce2:
+    AOT_BLOCK(0x0ce2, 2);
+    // 0ce2: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0ce4: br 0cea
+    AOT_GOTO(0x0cea, L0cea);
+L0ce6:
+    AOT_BLOCK(0x0ce6, 1);
+    // 0ce6: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cea, L0cea);
+L0cea:
+    AOT_BLOCK(0x0cea, 5);
+    // 0cea: mov r0, 6aae
+    {
+        src = r[0];
+        b = 0x6aae;
+        WR16(b, src);
+    }
+    // 0cee: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0cf2: mov $6aa0, -(sp)
+    {
+        src = uint16_t(0x6aa0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0cf6: mov $c38a, -(sp)
+    {
+        src = uint16_t(0xc38a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cfa: jsr pc, *$1332
+    {
+        a = 0x1332;
+        r[6] -= 2;
+        WR16(r[6], 0x0cfe);
+    }
+    AOT_GOTO(0x1332, L1332);
+L0cfe:
+    AOT_BLOCK(0x0cfe, 3);
+    // 0cfe: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0d00: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0d04:
+    AOT_BLOCK(0x0d04, 5);
+    // 0d04: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0d08;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 0d08: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 0d0a: tst 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d0e: beq 0d16
+    if (Z)
+        AOT_GOTO(0x0d16, L0d16);
+    AOT_GOTO(0x0d10, L0d10);
+L0d10:
+    AOT_BLOCK(0x0d10, 2);
+    // 0d10: mov $4020, r0
+    {
+        src = uint16_t(0x4020);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d14: br 0d1a
+    AOT_GOTO(0x0d1a, L0d1a);
+L0d16:
+    AOT_BLOCK(0x0d16, 1);
+    // 0d16: mov 401c, r0
+    {
+        a = 0x401c;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d1a, L0d1a);
+L0d1a:
+    AOT_BLOCK(0x0d1a, 4);
+    // 0d1a: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0d1e: mov $1b6, (sp)
+    {
+        src = uint16_t(0x01b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d22: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d26: jsr pc, *$227a
+    {
+        a = 0x227a;
+        r[6] -= 2;
+        WR16(r[6], 0x0d2a);
+    }
+    AOT_GOTO(0x227a, L227a);
+L0d2a:
+    AOT_BLOCK(0x0d2a, 3);
+    // 0d2a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0d2c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d2e: bge 0d4a
+    if (!(N ^ V))
+        AOT_GOTO(0x0d4a, L0d4a);
+    AOT_GOTO(0x0d30, L0d30);
+L0d30:
+    AOT_BLOCK(0x0d30, 2);
+    // 0d30: tst 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d34: beq 0d3c
+    if (Z)
+        AOT_GOTO(0x0d3c, L0d3c);
+    AOT_GOTO(0x0d36, L0d36);
+L0d36:
+    AOT_BLOCK(0x0d36, 2);
+    // 0d36: mov $41c0, (sp)
+    {
+        src = uint16_t(0x41c0);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d3a: br 0d40
+    AOT_GOTO(0x0d40, L0d40);
+L0d3c:
+    AOT_BLOCK(0x0d3c, 1);
+    // 0d3c: mov $41d3, (sp)
+    {
+        src = uint16_t(0x41d3);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d40, L0d40);
+L0d40:
+    AOT_BLOCK(0x0d40, 2);
+    // 0d40: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d44: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x0d48);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L0d48:
+    AOT_BLOCK(0x0d48, 1);
+    // 0d48: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0d4a, L0d4a);
+L0d4a:
+    AOT_BLOCK(0x0d4a, 2);
+    // 0d4a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d4c: jsr pc, *$2264
+    {
+        a = 0x2264;
+        r[6] -= 2;
+        WR16(r[6], 0x0d50);
+    }
+    AOT_GOTO(0x2264, L2264);
+L0d50:
+    AOT_BLOCK(0x0d50, 3);
+    // 0d50: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d54: mov -8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d58: jsr pc, *$2332
+    {
+        a = 0x2332;
+        r[6] -= 2;
+        WR16(r[6], 0x0d5c);
+    }
+    AOT_GOTO(0x2332, L2332);
+L0d5c:
+    AOT_BLOCK(0x0d5c, 4);
+    // 0d5c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0d5e: mov r0, *4(r5)
+    {
+        src = r[0];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+    }
+    // 0d62: tst 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d66: beq 0d70
+    if (Z)
+        AOT_GOTO(0x0d70, L0d70);
+    AOT_GOTO(0x0d68, L0d68);
+L0d68:
+    AOT_BLOCK(0x0d68, 2);
+    // 0d68: mov $4020, (sp)
+    {
+        src = uint16_t(0x4020);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d6c: jsr pc, *$249a
+    {
+        a = 0x249a;
+        r[6] -= 2;
+        WR16(r[6], 0x0d70);
+    }
+    AOT_GOTO(0x249a, L249a);
+L0d70:
+    AOT_BLOCK(0x0d70, 8);
+    // 0d70: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d74: mov $100, 2(r0)
+    {
+        src = uint16_t(0x0100);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0d7a: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d7e: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0d80: add $6, r1
+    {
+        src = uint16_t(0x0006);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0d84: mov r1, 4(r0)
+    {
+        src = r[1];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0d88: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0d8c:
+    AOT_BLOCK(0x0d8c, 5);
+    // 0d8c: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0d90;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 0d90: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0d94: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d96: jsr pc, *$14ee
+    {
+        a = 0x14ee;
+        r[6] -= 2;
+        WR16(r[6], 0x0d9a);
+    }
+    AOT_GOTO(0x14ee, L14ee);
+L0d9a:
+    AOT_BLOCK(0x0d9a, 2);
+    // 0d9a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d9c: beq 0da6
+    if (Z)
+        AOT_GOTO(0x0da6, L0da6);
+    AOT_GOTO(0x0d9e, L0d9e);
+L0d9e:
+    AOT_BLOCK(0x0d9e, 2);
+    // 0d9e: mov 401a, r3
+    {
+        a = 0x401a;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0da2: br 0e10
+    AOT_GOTO(0x0e10, L0e10);
+L0da4:
+    AOT_BLOCK(0x0da4, 1);
+    // 0da4: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0da6, L0da6);
+L0da6:
+    AOT_BLOCK(0x0da6, 2);
+    // 0da6: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0da8: bne 0da4
+    if (!Z)
+        AOT_GOTO(0x0da4, L0da4);
+    AOT_GOTO(0x0daa, L0daa);
+L0daa:
+    AOT_BLOCK(0x0daa, 2);
+    // 0daa: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0dae: bhi 0db6
+    if (!(C | Z))
+        AOT_GOTO(0x0db6, L0db6);
+    AOT_GOTO(0x0db0, L0db0);
+L0db0:
+    AOT_BLOCK(0x0db0, 2);
+    // 0db0: cmpb $2f, -(r4)
+    {
+        src = uint8_t(0x2f);
+        r[4] -= 1;
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0db4: bne 0daa
+    if (!Z)
+        AOT_GOTO(0x0daa, L0daa);
+    AOT_GOTO(0x0db6, L0db6);
+L0db6:
+    AOT_BLOCK(0x0db6, 3);
+    // 0db6: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 0db8: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dba: jsr pc, *$12b2
+    {
+        a = 0x12b2;
+        r[6] -= 2;
+        WR16(r[6], 0x0dbe);
+    }
+    AOT_GOTO(0x12b2, L12b2);
+L0dbe:
+    AOT_BLOCK(0x0dbe, 3);
+    // 0dbe: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0dc0: sxt -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, -int(N));
+        Z = !N;
+    }
+    // 0dc2: jsr pc, 0e32
+    {
+        a = 0x0e32;
+        r[6] -= 2;
+        WR16(r[6], 0x0dc6);
+    }
+    AOT_GOTO(0x0e32, L0e32);
+L0dc6:
+    AOT_BLOCK(0x0dc6, 2);
+    // 0dc6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0dc8: br 0e26
+    AOT_GOTO(0x0e26, L0e26);
+L0dca:
+    AOT_BLOCK(0x0dca, 5);
+    // 0dca: mov $1a, (sp)
+    {
+        src = uint16_t(0x001a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dce: mov 2(r3), -(sp)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dd2: mov (r3), -(sp)
+    {
+        a = r[3];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dd4: mov $6a72, -(sp)
+    {
+        src = uint16_t(0x6a72);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dd8: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x0ddc);
+    }
+    AOT_GOTO(0x1352, L1352);
+L0ddc:
+    AOT_BLOCK(0x0ddc, 4);
+    // 0ddc: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0de0: mov $1a, (sp)
+    {
+        src = uint16_t(0x001a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0de4: mov $6a86, -(sp)
+    {
+        src = uint16_t(0x6a86);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0de8: jsr pc, *$12f2
+    {
+        a = 0x12f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0dec);
+    }
+    AOT_GOTO(0x12f2, L12f2);
+L0dec:
+    AOT_BLOCK(0x0dec, 3);
+    // 0dec: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0dee: mov $6a86, (sp)
+    {
+        src = uint16_t(0x6a86);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0df2: jsr pc, *$12b2
+    {
+        a = 0x12b2;
+        r[6] -= 2;
+        WR16(r[6], 0x0df6);
+    }
+    AOT_GOTO(0x12b2, L12b2);
+L0df6:
+    AOT_BLOCK(0x0df6, 7);
+    // 0df6: mov 2(r3), r1
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0dfa: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0dfc: add $d, r1
+    {
+        src = uint16_t(0x000d);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0e00: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+        C = C && val == 0;
+    }
+    // 0e02: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e04: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e06: jsr pc, 0e32
+    {
+        a = 0x0e32;
+        r[6] -= 2;
+        WR16(r[6], 0x0e0a);
+    }
+    AOT_GOTO(0x0e32, L0e32);
+L0e0a:
+    AOT_BLOCK(0x0e0a, 2);
+    // 0e0a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0e0c: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0e10, L0e10);
+L0e10:
+    AOT_BLOCK(0x0e10, 2);
+    // 0e10: cmp $ffff, (r3)
+    {
+        src = uint16_t(0xffff);
+        b = r[3];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e14: bne 0dca
+    if (!Z)
+        AOT_GOTO(0x0dca, L0dca);
+    AOT_GOTO(0x0e16, L0e16);
+L0e16:
+    AOT_BLOCK(0x0e16, 2);
+    // 0e16: cmp $ffff, 2(r3)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[3] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e1c: bne 0dca
+    if (!Z)
+        AOT_GOTO(0x0dca, L0dca);
+    AOT_GOTO(0x0e1e, L0e1e);
+L0e1e:
+    AOT_BLOCK(0x0e1e, 2);
+    // 0e1e: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0e22: mov r3, 401a
+    {
+        src = r[3];
+        b = 0x401a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e26, L0e26);
+L0e26:
+    AOT_BLOCK(0x0e26, 2);
+    // 0e26: mov c376, (sp)
+    {
+        a = 0xc376;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e2a: jsr pc, *$2264
+    {
+        a = 0x2264;
+        r[6] -= 2;
+        WR16(r[6], 0x0e2e);
+    }
+    AOT_GOTO(0x2264, L2264);
+L0e2e:
+    AOT_BLOCK(0x0e2e, 2);
+    // 0e2e: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0e32:
+    AOT_BLOCK(0x0e32, 6);
+    // 0e32: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0e36;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 0e36: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 0e3a: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e3e: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e42: jsr pc, 188c
+    {
+        a = 0x188c;
+        r[6] -= 2;
+        WR16(r[6], 0x0e46);
+    }
+    AOT_GOTO(0x188c, L188c);
+L0e46:
+    AOT_BLOCK(0x0e46, 23);
+    // 0e46: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0e48: mov cdaa, c382
+    {
+        a = 0xcdaa;
+        src = RD16(a);
+        b = 0xc382;
+        WR16(b, src);
+    }
+    // 0e4e: add cdac, c384
+    {
+        a = 0xcdac;
+        src = RD16(a);
+        b = 0xc384;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0e54: add cdae, c386
+    {
+        a = 0xcdae;
+        src = RD16(a);
+        b = 0xc386;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 0e5a: mov $b3b4, r3
+    {
+        src = uint16_t(0xb3b4);
+        r[3] = src;
+    }
+    // 0e5e: mov $ffff, r2
+    {
+        src = uint16_t(0xffff);
+        r[2] = src;
+    }
+    // 0e62: add $8, 6(r5)
+    {
+        src = uint16_t(0x0008);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0e68: adc 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+    }
+    // 0e6c: mov 6aa8, (sp)
+    {
+        a = 0x6aa8;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e70: mov 6aa4, -(sp)
+    {
+        a = 0x6aa4;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        N = int16_t(src) < 0;
+    }
+    // 0e74: sxt -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, -int(N));
+    }
+    // 0e76: mov 6aa2, r1
+    {
+        a = 0x6aa2;
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 0e7a: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0e7c: add (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0e7e: add (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0e80: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+    }
+    // 0e82: add 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0e86: add 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0e8a: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+        C = C && val == 0;
+    }
+    // 0e8c: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e8e: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e90: mov $6a72, -(sp)
+    {
+        src = uint16_t(0x6a72);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e94: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x0e98);
+    }
+    AOT_GOTO(0x1352, L1352);
+L0e98:
+    AOT_BLOCK(0x0e98, 2);
+    // 0e98: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0e9c: jmp *$0f76
+    {
+        a = 0x0f76;
+    }
+    AOT_GOTO(0x0f76, L0f76);
+L0ea0:
+    AOT_BLOCK(0x0ea0, 4);
+    // 0ea0: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 0ea2: mov $c, (sp)
+    {
+        src = uint16_t(0x000c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ea6: mov $6eb0, -(sp)
+    {
+        src = uint16_t(0x6eb0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0eaa: jsr pc, *$12f2
+    {
+        a = 0x12f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0eae);
+    }
+    AOT_GOTO(0x12f2, L12f2);
+L0eae:
+    AOT_BLOCK(0x0eae, 2);
+    // 0eae: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0eb0: jsr pc, 178c
+    {
+        a = 0x178c;
+        r[6] -= 2;
+        WR16(r[6], 0x0eb4);
+    }
+    AOT_GOTO(0x178c, L178c);
+L0eb4:
+    AOT_BLOCK(0x0eb4, 4);
+    // 0eb4: movb 6eb8, r0
+    {
+        a = 0x6eb8;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0eb8: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0ebc: tst c362
+    {
+        a = 0xc362;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ec0: beq 0ed6
+    if (Z)
+        AOT_GOTO(0x0ed6, L0ed6);
+    AOT_GOTO(0x0ec2, L0ec2);
+L0ec2:
+    AOT_BLOCK(0x0ec2, 4);
+    // 0ec2: bic $ffe0, r0
+    {
+        src = uint16_t(0xffe0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0ec6: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0eca: cmp $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ece: beq 0f76
+    if (Z)
+        AOT_GOTO(0x0f76, L0f76);
+    AOT_GOTO(0x0ed0, L0ed0);
+L0ed0:
+    AOT_BLOCK(0x0ed0, 2);
+    // 0ed0: cmp $4, r0
+    {
+        src = uint16_t(0x0004);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ed4: blt 0f76
+    if (N ^ V)
+        AOT_GOTO(0x0f76, L0f76);
+    AOT_GOTO(0x0ed6, L0ed6);
+L0ed6:
+    AOT_BLOCK(0x0ed6, 2);
+    // 0ed6: bit $20, -8(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0edc: bne 0f0c
+    if (!Z)
+        AOT_GOTO(0x0f0c, L0f0c);
+    AOT_GOTO(0x0ede, L0ede);
+L0ede:
+    AOT_BLOCK(0x0ede, 2);
+    // 0ede: tst c368
+    {
+        a = 0xc368;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ee2: bne 0f76
+    if (!Z)
+        AOT_GOTO(0x0f76, L0f76);
+    AOT_GOTO(0x0ee4, L0ee4);
+L0ee4:
+    AOT_BLOCK(0x0ee4, 2);
+    // 0ee4: tst c35e
+    {
+        a = 0xc35e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ee8: bne 0f76
+    if (!Z)
+        AOT_GOTO(0x0f76, L0f76);
+    AOT_GOTO(0x0eea, L0eea);
+L0eea:
+    AOT_BLOCK(0x0eea, 2);
+    // 0eea: tst c360
+    {
+        a = 0xc360;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0eee: beq 0ef8
+    if (Z)
+        AOT_GOTO(0x0ef8, L0ef8);
+    AOT_GOTO(0x0ef0, L0ef0);
+L0ef0:
+    AOT_BLOCK(0x0ef0, 2);
+    // 0ef0: cmpb $4c, 6eb0
+    {
+        src = uint8_t(0x4c);
+        b = 0x6eb0;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0ef6: beq 0f76
+    if (Z)
+        AOT_GOTO(0x0f76, L0f76);
+    AOT_GOTO(0x0ef8, L0ef8);
+L0ef8:
+    AOT_BLOCK(0x0ef8, 4);
+    // 0ef8: mov $c, (sp)
+    {
+        src = uint16_t(0x000c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0efc: mov $6eb0, -(sp)
+    {
+        src = uint16_t(0x6eb0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f00: mov $cba2, -(sp)
+    {
+        src = uint16_t(0xcba2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f04: jsr pc, *$1332
+    {
+        a = 0x1332;
+        r[6] -= 2;
+        WR16(r[6], 0x0f08);
+    }
+    AOT_GOTO(0x1332, L1332);
+L0f08:
+    AOT_BLOCK(0x0f08, 2);
+    // 0f08: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f0a: br 0f76
+    AOT_GOTO(0x0f76, L0f76);
+L0f0c:
+    AOT_BLOCK(0x0f0c, 1);
+    // 0f0c: jsr pc, 1684
+    {
+        a = 0x1684;
+        r[6] -= 2;
+        WR16(r[6], 0x0f10);
+    }
+    AOT_GOTO(0x1684, L1684);
+L0f10:
+    AOT_BLOCK(0x0f10, 2);
+    // 0f10: mov (r0), r4
+    {
+        a = r[0];
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f12: bne 0f22
+    if (!Z)
+        AOT_GOTO(0x0f22, L0f22);
+    AOT_GOTO(0x0f14, L0f14);
+L0f14:
+    AOT_BLOCK(0x0f14, 3);
+    // 0f14: mov $41e8, (sp)
+    {
+        src = uint16_t(0x41e8);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f18: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f1c: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x0f20);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L0f20:
+    AOT_BLOCK(0x0f20, 1);
+    // 0f20: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0f22, L0f22);
+L0f22:
+    AOT_BLOCK(0x0f22, 2);
+    // 0f22: cmpb $20, 6eb8
+    {
+        src = uint8_t(0x20);
+        b = 0x6eb8;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0f28: bne 0f4a
+    if (!Z)
+        AOT_GOTO(0x0f4a, L0f4a);
+    AOT_GOTO(0x0f2a, L0f2a);
+L0f2a:
+    AOT_BLOCK(0x0f2a, 2);
+    // 0f2a: cmp $c354, r3
+    {
+        src = uint16_t(0xc354);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f2e: bhi 0f3e
+    if (!(C | Z))
+        AOT_GOTO(0x0f3e, L0f3e);
+    AOT_GOTO(0x0f30, L0f30);
+L0f30:
+    AOT_BLOCK(0x0f30, 3);
+    // 0f30: mov $4209, (sp)
+    {
+        src = uint16_t(0x4209);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f34: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f38: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x0f3c);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L0f3c:
+    AOT_BLOCK(0x0f3c, 1);
+    // 0f3c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0f3e, L0f3e);
+L0f3e:
+    AOT_BLOCK(0x0f3e, 4);
+    // 0f3e: mov r2, (r3)
+    {
+        src = r[2];
+        b = r[3];
+        WR16(b, src);
+    }
+    // 0f40: mov r4, 2(r3)
+    {
+        src = r[4];
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+    }
+    // 0f44: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0f48: br 0f76
+    AOT_GOTO(0x0f76, L0f76);
+L0f4a:
+    AOT_BLOCK(0x0f4a, 2);
+    // 0f4a: cmpb 8(r4), 6eb8
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD8(a);
+        b = 0x6eb8;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0f50: bne 0f5a
+    if (!Z)
+        AOT_GOTO(0x0f5a, L0f5a);
+    AOT_GOTO(0x0f52, L0f52);
+L0f52:
+    AOT_BLOCK(0x0f52, 2);
+    // 0f52: cmp a(r4), 6eba
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = 0x6eba;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f58: beq 0f76
+    if (Z)
+        AOT_GOTO(0x0f76, L0f76);
+    AOT_GOTO(0x0f5a, L0f5a);
+L0f5a:
+    AOT_BLOCK(0x0f5a, 3);
+    // 0f5a: mov $6eb0, (sp)
+    {
+        src = uint16_t(0x6eb0);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f5e: mov $421f, -(sp)
+    {
+        src = uint16_t(0x421f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f62: jsr pc, *$19c8
+    {
+        a = 0x19c8;
+        r[6] -= 2;
+        WR16(r[6], 0x0f66);
+    }
+    AOT_GOTO(0x19c8, L19c8);
+L0f66:
+    AOT_BLOCK(0x0f66, 4);
+    // 0f66: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0f68: mov $4226, (sp)
+    {
+        src = uint16_t(0x4226);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f6c: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f70: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x0f74);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L0f74:
+    AOT_BLOCK(0x0f74, 1);
+    // 0f74: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0f76, L0f76);
+L0f76:
+    AOT_BLOCK(0x0f76, 2);
+    // 0f76: tst 6a78
+    {
+        a = 0x6a78;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f7a: bgt 0ea0
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0ea0, L0ea0);
+    AOT_GOTO(0x0f7c, L0f7c);
+L0f7c:
+    AOT_BLOCK(0x0f7c, 5);
+    // 0f7c: mov 6aa2, (sp)
+    {
+        a = 0x6aa2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f80: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f84: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f88: mov $6a72, -(sp)
+    {
+        src = uint16_t(0x6a72);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f8c: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x0f90);
+    }
+    AOT_GOTO(0x1352, L1352);
+L0f90:
+    AOT_BLOCK(0x0f90, 5);
+    // 0f90: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 0f94: mov 6aa2, (sp)
+    {
+        a = 0x6aa2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f98: mov 6aa2, -(sp)
+    {
+        a = 0x6aa2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f9c: add 6aa4, (sp)
+    {
+        a = 0x6aa4;
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0fa0: jsr pc, 1478
+    {
+        a = 0x1478;
+        r[6] -= 2;
+        WR16(r[6], 0x0fa4);
+    }
+    AOT_GOTO(0x1478, L1478);
+L0fa4:
+    AOT_BLOCK(0x0fa4, 10);
+    // 0fa4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0fa6: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 0fa8: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0faa: add 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0fae: add 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0fb2: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+        C = C && val == 0;
+    }
+    // 0fb4: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fb6: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fb8: mov $6a7c, -(sp)
+    {
+        src = uint16_t(0x6a7c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fbc: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x0fc0);
+    }
+    AOT_GOTO(0x1352, L1352);
+L0fc0:
+    AOT_BLOCK(0x0fc0, 6);
+    // 0fc0: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0fc4: mov $c796, (sp)
+    {
+        src = uint16_t(0xc796);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fc8: mov $c38a, -(sp)
+    {
+        src = uint16_t(0xc38a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fcc: mov c382, -(sp)
+    {
+        a = 0xc382;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fd0: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fd2: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x0fd6);
+    }
+    AOT_GOTO(0x106a, L106a);
+L0fd6:
+    AOT_BLOCK(0x0fd6, 4);
+    // 0fd6: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0fda: mov 6aa4, (sp)
+    {
+        a = 0x6aa4;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fde: mov 6aa2, -(sp)
+    {
+        a = 0x6aa2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fe2: jsr pc, 1478
+    {
+        a = 0x1478;
+        r[6] -= 2;
+        WR16(r[6], 0x0fe6);
+    }
+    AOT_GOTO(0x1478, L1478);
+L0fe6:
+    AOT_BLOCK(0x0fe6, 10);
+    // 0fe6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0fe8: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 0fea: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0fec: add 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0ff0: add 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0ff4: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+        C = C && val == 0;
+    }
+    // 0ff6: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ff8: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ffa: mov $6a72, -(sp)
+    {
+        src = uint16_t(0x6a72);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ffe: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x1002);
+    }
+    AOT_GOTO(0x1352, L1352);
+L1002:
+    AOT_BLOCK(0x1002, 6);
+    // 1002: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1006: mov 6aa4, (sp)
+    {
+        a = 0x6aa4;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 100a: mov 6aa2, -(sp)
+    {
+        a = 0x6aa2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        N = int16_t(src) < 0;
+    }
+    // 100e: sxt -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, -int(N));
+    }
+    // 1010: mov 6aa4, -(sp)
+    {
+        a = 0x6aa4;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1014: jsr pc, 1478
+    {
+        a = 0x1478;
+        r[6] -= 2;
+        WR16(r[6], 0x1018);
+    }
+    AOT_GOTO(0x1478, L1478);
+L1018:
+    AOT_BLOCK(0x1018, 13);
+    // 1018: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 101a: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 101c: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 101e: add (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1020: add (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1022: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+    }
+    // 1024: add 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1028: add 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 102c: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+        C = C && val == 0;
+    }
+    // 102e: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1030: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1032: mov $6a7c, -(sp)
+    {
+        src = uint16_t(0x6a7c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1036: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x103a);
+    }
+    AOT_GOTO(0x1352, L1352);
+L103a:
+    AOT_BLOCK(0x103a, 6);
+    // 103a: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 103e: mov $c99c, (sp)
+    {
+        src = uint16_t(0xc99c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1042: mov $c590, -(sp)
+    {
+        src = uint16_t(0xc590);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1046: mov c384, -(sp)
+    {
+        a = 0xc384;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 104a: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 104c: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x1050);
+    }
+    AOT_GOTO(0x106a, L106a);
+L1050:
+    AOT_BLOCK(0x1050, 6);
+    // 1050: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 1054: add 6aa2, cdaa
+    {
+        a = 0x6aa2;
+        src = RD16(a);
+        b = 0xcdaa;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 105a: add 6aa4, cdac
+    {
+        a = 0x6aa4;
+        src = RD16(a);
+        b = 0xcdac;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 1060: add 6aa6, cdae
+    {
+        a = 0x6aa6;
+        src = RD16(a);
+        b = 0xcdae;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1066: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L106a:
+    AOT_BLOCK(0x106a, 2);
+    // 106a: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x106e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    AOT_GOTO(0x106e, L106e);
+L106e:
+    AOT_BLOCK(0x106e, 2);
+    // 106e: dec 6a78
+    {
+        a = 0x6a78;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1072: bgt 1092
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1092, L1092);
+    AOT_GOTO(0x1074, L1074);
+L1074:
+    AOT_BLOCK(0x1074, 2);
+    // 1074: tst 6a78
+    {
+        a = 0x6a78;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1078: bge 1082
+    if (!(N ^ V))
+        AOT_GOTO(0x1082, L1082);
+    AOT_GOTO(0x107a, L107a);
+L107a:
+    AOT_BLOCK(0x107a, 2);
+    // 107a: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L107e:
+    AOT_BLOCK(0x107e, 1);
+    // 107e: inc 6a76
+    {
+        a = 0x6a76;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1082, L1082);
+L1082:
+    AOT_BLOCK(0x1082, 3);
+    // 1082: inc 6a78
+    {
+        a = 0x6a78;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1086: mov $6a72, (sp)
+    {
+        src = uint16_t(0x6a72);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 108a: jsr pc, *$148a
+    {
+        a = 0x148a;
+        r[6] -= 2;
+        WR16(r[6], 0x108e);
+    }
+    AOT_GOTO(0x148a, L148a);
+L108e:
+    AOT_BLOCK(0x108e, 2);
+    // 108e: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1090: br 10a2
+    AOT_GOTO(0x10a2, L10a2);
+L1092:
+    AOT_BLOCK(0x1092, 2);
+    // 1092: dec 6a76
+    {
+        a = 0x6a76;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1096: blt 107e
+    if (N ^ V)
+        AOT_GOTO(0x107e, L107e);
+    AOT_GOTO(0x1098, L1098);
+L1098:
+    AOT_BLOCK(0x1098, 2);
+    // 1098: mov *6a72, r3
+    {
+        a = RD16(0x6a72);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 109c: add $2, 6a72
+    {
+        src = uint16_t(0x0002);
+        b = 0x6a72;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x10a2, L10a2);
+L10a2:
+    AOT_BLOCK(0x10a2, 2);
+    // 10a2: dec 6a82
+    {
+        a = 0x6a82;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 10a6: bgt 10d2
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x10d2, L10d2);
+    AOT_GOTO(0x10a8, L10a8);
+L10a8:
+    AOT_BLOCK(0x10a8, 2);
+    // 10a8: tst 6a82
+    {
+        a = 0x6a82;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10ac: bge 10c2
+    if (!(N ^ V))
+        AOT_GOTO(0x10c2, L10c2);
+    AOT_GOTO(0x10ae, L10ae);
+L10ae:
+    AOT_BLOCK(0x10ae, 3);
+    // 10ae: mov $4237, (sp)
+    {
+        src = uint16_t(0x4237);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10b2: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10b6: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x10ba);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L10ba:
+    AOT_BLOCK(0x10ba, 2);
+    // 10ba: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10bc: br 10c2
+    AOT_GOTO(0x10c2, L10c2);
+L10be:
+    AOT_BLOCK(0x10be, 1);
+    // 10be: inc 6a80
+    {
+        a = 0x6a80;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x10c2, L10c2);
+L10c2:
+    AOT_BLOCK(0x10c2, 3);
+    // 10c2: inc 6a82
+    {
+        a = 0x6a82;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 10c6: mov $6a7c, (sp)
+    {
+        src = uint16_t(0x6a7c);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10ca: jsr pc, *$148a
+    {
+        a = 0x148a;
+        r[6] -= 2;
+        WR16(r[6], 0x10ce);
+    }
+    AOT_GOTO(0x148a, L148a);
+L10ce:
+    AOT_BLOCK(0x10ce, 2);
+    // 10ce: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10d0: br 10e2
+    AOT_GOTO(0x10e2, L10e2);
+L10d2:
+    AOT_BLOCK(0x10d2, 2);
+    // 10d2: dec 6a80
+    {
+        a = 0x6a80;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 10d6: blt 10be
+    if (N ^ V)
+        AOT_GOTO(0x10be, L10be);
+    AOT_GOTO(0x10d8, L10d8);
+L10d8:
+    AOT_BLOCK(0x10d8, 2);
+    // 10d8: mov *6a7c, r4
+    {
+        a = RD16(0x6a7c);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 10dc: add $2, 6a7c
+    {
+        src = uint16_t(0x0002);
+        b = 0x6a7c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x10e2, L10e2);
+L10e2:
+    AOT_BLOCK(0x10e2, 5);
+    // 10e2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 10e4: bic $fff1, r0
+    {
+        src = uint16_t(0xfff1);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 10e8: sub $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 10ec: cmp r0, $6
+    {
+        src = r[0];
+        dst = uint16_t(0x0006);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 10f0: bhi 10fc
+    if (!(C | Z))
+        AOT_GOTO(0x10fc, L10fc);
+    AOT_GOTO(0x10f2, L10f2);
+L10f2:
+    AOT_BLOCK(0x10f2, 2);
+    // 10f2: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 10f4: jmp *404e(r0)
+    {
+        a = RD16(r[0] + 16462);
+    }
+    AOT_JUMP(a);
+L10f8:
+    AOT_BLOCK(0x10f8, 1);
+    // 10f8: add c382, r3
+    {
+        a = 0xc382;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x10fc, L10fc);
+L10fc:
+    AOT_BLOCK(0x10fc, 2);
+    // 10fc: bit $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1100: beq 1106
+    if (Z)
+        AOT_GOTO(0x1106, L1106);
+    AOT_GOTO(0x1102, L1102);
+L1102:
+    AOT_BLOCK(0x1102, 1);
+    // 1102: sub 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1106, L1106);
+L1106:
+    AOT_BLOCK(0x1106, 3);
+    // 1106: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 110a: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 110c: jsr pc, *$1956
+    {
+        a = 0x1956;
+        r[6] -= 2;
+        WR16(r[6], 0x1110);
+    }
+    AOT_GOTO(0x1956, L1956);
+L1110:
+    AOT_BLOCK(0x1110, 3);
+    // 1110: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1112: tst c364
+    {
+        a = 0xc364;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1116: beq 106e
+    if (Z)
+        AOT_GOTO(0x106e, L106e);
+    AOT_GOTO(0x1118, L1118);
+L1118:
+    AOT_BLOCK(0x1118, 3);
+    // 1118: mov a(r5), (sp)
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 111c: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 111e: jsr pc, *$1956
+    {
+        a = 0x1956;
+        r[6] -= 2;
+        WR16(r[6], 0x1122);
+    }
+    AOT_GOTO(0x1956, L1956);
+L1122:
+    AOT_BLOCK(0x1122, 2);
+    // 1122: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1124: br 106e
+    AOT_GOTO(0x106e, L106e);
+L1126:
+    AOT_BLOCK(0x1126, 2);
+    // 1126: add c384, r3
+    {
+        a = 0xc384;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 112a: br 10fc
+    AOT_GOTO(0x10fc, L10fc);
+L112c:
+    AOT_BLOCK(0x112c, 2);
+    // 112c: add c386, r3
+    {
+        a = 0xc386;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1130: br 10fc
+    AOT_GOTO(0x10fc, L10fc);
+L1132:
+    AOT_BLOCK(0x1132, 3);
+    // 1132: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1134: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1138: jsr pc, *$184e
+    {
+        a = 0x184e;
+        r[6] -= 2;
+        WR16(r[6], 0x113c);
+    }
+    AOT_GOTO(0x184e, L184e);
+L113c:
+    AOT_BLOCK(0x113c, 4);
+    // 113c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 113e: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 1140: cmpb $20, 8(r2)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[2] + 8);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1146: bne 116e
+    if (!Z)
+        AOT_GOTO(0x116e, L116e);
+    AOT_GOTO(0x1148, L1148);
+L1148:
+    AOT_BLOCK(0x1148, 13);
+    // 1148: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 114a: sub $6ebc, r1
+    {
+        src = uint16_t(0x6ebc);
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        C = dst < src;
+    }
+    // 114e: bic r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1150: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+    }
+    // 1152: div $c, r0
+    {
+        src = int16_t(uint16_t(0x000c));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1156: add cda8, r0
+    {
+        a = 0xcda8;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 115a: ash $4, r0
+    {
+        src = uint16_t(0x0004) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 115e: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 1160: bic $fffe, r1
+    {
+        src = uint16_t(0xfffe);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 1164: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1166: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1168: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 116c: br 10fc
+    AOT_GOTO(0x10fc, L10fc);
+L116e:
+    AOT_BLOCK(0x116e, 9);
+    // 116e: add a(r2), r3
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 1172: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1174: bic $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1178: movb 8(r2), r1
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 117c: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 117e: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1180: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1182: add $ffbe, r4
+    {
+        src = uint16_t(0xffbe);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1186: br 10fc
+    AOT_GOTO(0x10fc, L10fc);
+L1188:
+    AOT_BLOCK(0x1188, 4);
+    // 1188: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x118c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 118c: tst c36a
+    {
+        a = 0xc36a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1190: bne 1198
+    if (!Z)
+        AOT_GOTO(0x1198, L1198);
+    AOT_GOTO(0x1192, L1192);
+L1192:
+    AOT_BLOCK(0x1192, 2);
+    // 1192: tst c370
+    {
+        a = 0xc370;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1196: beq 11c6
+    if (Z)
+        AOT_GOTO(0x11c6, L11c6);
+    AOT_GOTO(0x1198, L1198);
+L1198:
+    AOT_BLOCK(0x1198, 2);
+    // 1198: mov cdaa, r4
+    {
+        a = 0xcdaa;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 119c: br 11c0
+    AOT_GOTO(0x11c0, L11c0);
+L119e:
+    AOT_BLOCK(0x119e, 4);
+    // 119e: add $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+    }
+    // 11a2: mov $c38a, (sp)
+    {
+        src = uint16_t(0xc38a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 11a6: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 11a8: jsr pc, *$1956
+    {
+        a = 0x1956;
+        r[6] -= 2;
+        WR16(r[6], 0x11ac);
+    }
+    AOT_GOTO(0x1956, L1956);
+L11ac:
+    AOT_BLOCK(0x11ac, 3);
+    // 11ac: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 11ae: tst c364
+    {
+        a = 0xc364;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 11b2: beq 11c0
+    if (Z)
+        AOT_GOTO(0x11c0, L11c0);
+    AOT_GOTO(0x11b4, L11b4);
+L11b4:
+    AOT_BLOCK(0x11b4, 3);
+    // 11b4: mov $c796, (sp)
+    {
+        src = uint16_t(0xc796);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 11b8: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 11ba: jsr pc, *$1956
+    {
+        a = 0x1956;
+        r[6] -= 2;
+        WR16(r[6], 0x11be);
+    }
+    AOT_GOTO(0x1956, L1956);
+L11be:
+    AOT_BLOCK(0x11be, 1);
+    // 11be: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x11c0, L11c0);
+L11c0:
+    AOT_BLOCK(0x11c0, 2);
+    // 11c0: bit $3f, r4
+    {
+        src = uint16_t(0x003f);
+        dst = r[4];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 11c4: bne 119e
+    if (!Z)
+        AOT_GOTO(0x119e, L119e);
+    AOT_GOTO(0x11c6, L11c6);
+L11c6:
+    AOT_BLOCK(0x11c6, 2);
+    // 11c6: mov $c590, (sp)
+    {
+        src = uint16_t(0xc590);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11ca: jsr pc, *$125a
+    {
+        a = 0x125a;
+        r[6] -= 2;
+        WR16(r[6], 0x11ce);
+    }
+    AOT_GOTO(0x125a, L125a);
+L11ce:
+    AOT_BLOCK(0x11ce, 2);
+    // 11ce: tst c364
+    {
+        a = 0xc364;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 11d2: beq 11e4
+    if (Z)
+        AOT_GOTO(0x11e4, L11e4);
+    AOT_GOTO(0x11d4, L11d4);
+L11d4:
+    AOT_BLOCK(0x11d4, 2);
+    // 11d4: mov $c796, (sp)
+    {
+        src = uint16_t(0xc796);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11d8: jsr pc, *$125a
+    {
+        a = 0x125a;
+        r[6] -= 2;
+        WR16(r[6], 0x11dc);
+    }
+    AOT_GOTO(0x125a, L125a);
+L11dc:
+    AOT_BLOCK(0x11dc, 2);
+    // 11dc: mov $c99c, (sp)
+    {
+        src = uint16_t(0xc99c);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11e0: jsr pc, *$125a
+    {
+        a = 0x125a;
+        r[6] -= 2;
+        WR16(r[6], 0x11e4);
+    }
+    AOT_GOTO(0x125a, L125a);
+L11e4:
+    AOT_BLOCK(0x11e4, 2);
+    // 11e4: tst c368
+    {
+        a = 0xc368;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 11e8: bne 121a
+    if (!Z)
+        AOT_GOTO(0x121a, L121a);
+    AOT_GOTO(0x11ea, L11ea);
+L11ea:
+    AOT_BLOCK(0x11ea, 2);
+    // 11ea: tst c35e
+    {
+        a = 0xc35e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 11ee: bne 11f8
+    if (!Z)
+        AOT_GOTO(0x11f8, L11f8);
+    AOT_GOTO(0x11f0, L11f0);
+L11f0:
+    AOT_BLOCK(0x11f0, 2);
+    // 11f0: mov $cba2, (sp)
+    {
+        src = uint16_t(0xcba2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11f4: jsr pc, *$125a
+    {
+        a = 0x125a;
+        r[6] -= 2;
+        WR16(r[6], 0x11f8);
+    }
+    AOT_GOTO(0x125a, L125a);
+L11f8:
+    AOT_BLOCK(0x11f8, 2);
+    // 11f8: mov $6ebc, r3
+    {
+        src = uint16_t(0x6ebc);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11fc: br 120a
+    AOT_GOTO(0x120a, L120a);
+L11fe:
+    AOT_BLOCK(0x11fe, 3);
+    // 11fe: mov $c38a, (sp)
+    {
+        src = uint16_t(0xc38a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1202: mov (r3)+, -(sp)
+    {
+        a = r[3];
+        r[3] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1204: jsr pc, *$1956
+    {
+        a = 0x1956;
+        r[6] -= 2;
+        WR16(r[6], 0x1208);
+    }
+    AOT_GOTO(0x1956, L1956);
+L1208:
+    AOT_BLOCK(0x1208, 1);
+    // 1208: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x120a, L120a);
+L120a:
+    AOT_BLOCK(0x120a, 5);
+    // 120a: mov ab10, r1
+    {
+        a = 0xab10;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 120e: mul $c, r1
+    {
+        src = int16_t(uint16_t(0x000c));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1212: add $6ebc, r1
+    {
+        src = uint16_t(0x6ebc);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 1216: cmp r3, r1
+    {
+        src = r[3];
+        dst = r[1];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1218: bcs 11fe
+    if (C)
+        AOT_GOTO(0x11fe, L11fe);
+    AOT_GOTO(0x121a, L121a);
+L121a:
+    AOT_BLOCK(0x121a, 2);
+    // 121a: mov $c38a, (sp)
+    {
+        src = uint16_t(0xc38a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 121e: jsr pc, *$197a
+    {
+        a = 0x197a;
+        r[6] -= 2;
+        WR16(r[6], 0x1222);
+    }
+    AOT_GOTO(0x197a, L197a);
+L1222:
+    AOT_BLOCK(0x1222, 2);
+    // 1222: mov c38a, (sp)
+    {
+        a = 0xc38a;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1226: jsr pc, *$2264
+    {
+        a = 0x2264;
+        r[6] -= 2;
+        WR16(r[6], 0x122a);
+    }
+    AOT_GOTO(0x2264, L2264);
+L122a:
+    AOT_BLOCK(0x122a, 2);
+    // 122a: tst c374
+    {
+        a = 0xc374;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 122e: bne 124c
+    if (!Z)
+        AOT_GOTO(0x124c, L124c);
+    AOT_GOTO(0x1230, L1230);
+L1230:
+    AOT_BLOCK(0x1230, 2);
+    // 1230: mov $4248, (sp)
+    {
+        src = uint16_t(0x4248);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1234: jsr pc, *$249a
+    {
+        a = 0x249a;
+        r[6] -= 2;
+        WR16(r[6], 0x1238);
+    }
+    AOT_GOTO(0x249a, L249a);
+L1238:
+    AOT_BLOCK(0x1238, 3);
+    // 1238: mov $4254, (sp)
+    {
+        src = uint16_t(0x4254);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 123c: mov $424e, -(sp)
+    {
+        src = uint16_t(0x424e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1240: jsr pc, *$22e6
+    {
+        a = 0x22e6;
+        r[6] -= 2;
+        WR16(r[6], 0x1244);
+    }
+    AOT_GOTO(0x22e6, L22e6);
+L1244:
+    AOT_BLOCK(0x1244, 2);
+    // 1244: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1246: mov $425a, 401c
+    {
+        src = uint16_t(0x425a);
+        b = 0x401c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x124c, L124c);
+L124c:
+    AOT_BLOCK(0x124c, 2);
+    // 124c: mov c388, 401e
+    {
+        a = 0xc388;
+        src = RD16(a);
+        b = 0x401e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1252: jsr pc, 003c
+    {
+        a = 0x003c;
+        r[6] -= 2;
+        WR16(r[6], 0x1256);
+    }
+    AOT_GOTO(0x003c, L003c);
+L1256:
+    AOT_BLOCK(0x1256, 2);
+    // 1256: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L125a:
+    AOT_BLOCK(0x125a, 4);
+    // 125a: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x125e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 125e: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1262: jsr pc, *$197a
+    {
+        a = 0x197a;
+        r[6] -= 2;
+        WR16(r[6], 0x1266);
+    }
+    AOT_GOTO(0x197a, L197a);
+L1266:
+    AOT_BLOCK(0x1266, 6);
+    // 1266: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 1268: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        N = false;
+        C = false;
+    }
+    // 126a: sxt -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, -int(N));
+    }
+    // 126c: mov *4(r5), r4
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1270: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1272: jsr pc, *$2306
+    {
+        a = 0x2306;
+        r[6] -= 2;
+        WR16(r[6], 0x1276);
+    }
+    AOT_GOTO(0x2306, L2306);
+L1276:
+    AOT_BLOCK(0x1276, 2);
+    // 1276: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 127a: br 1290
+    AOT_GOTO(0x1290, L1290);
+L127c:
+    AOT_BLOCK(0x127c, 2);
+    // 127c: asr r2
+    {
+        src = r[2];
+        val = int16_t(src) >> 1;
+        r[2] = val;
+        C = (src & 1) != 0;
+    }
+    // 127e: mov $c596, r3
+    {
+        src = uint16_t(0xc596);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1282, L1282);
+L1282:
+    AOT_BLOCK(0x1282, 3);
+    // 1282: mov $c38a, (sp)
+    {
+        src = uint16_t(0xc38a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1286: mov (r3)+, -(sp)
+    {
+        a = r[3];
+        r[3] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1288: jsr pc, *$1956
+    {
+        a = 0x1956;
+        r[6] -= 2;
+        WR16(r[6], 0x128c);
+    }
+    AOT_GOTO(0x1956, L1956);
+L128c:
+    AOT_BLOCK(0x128c, 2);
+    // 128c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 128e: sob r2, 7
+    {
+        r[2]--;
+    }
+    if (r[2] != 0)
+        AOT_GOTO(0x1282, L1282);
+    AOT_GOTO(0x1290, L1290);
+L1290:
+    AOT_BLOCK(0x1290, 4);
+    // 1290: mov $200, (sp)
+    {
+        src = uint16_t(0x0200);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1294: mov $c596, -(sp)
+    {
+        src = uint16_t(0xc596);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1298: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 129a: jsr pc, *$2350
+    {
+        a = 0x2350;
+        r[6] -= 2;
+        WR16(r[6], 0x129e);
+    }
+    AOT_GOTO(0x2350, L2350);
+L129e:
+    AOT_BLOCK(0x129e, 4);
+    // 129e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 12a0: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 12a2: cmp $1, r2
+    {
+        src = uint16_t(0x0001);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12a6: blt 127c
+    if (N ^ V)
+        AOT_GOTO(0x127c, L127c);
+    AOT_GOTO(0x12a8, L12a8);
+L12a8:
+    AOT_BLOCK(0x12a8, 2);
+    // 12a8: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12aa: jsr pc, *$2264
+    {
+        a = 0x2264;
+        r[6] -= 2;
+        WR16(r[6], 0x12ae);
+    }
+    AOT_GOTO(0x2264, L2264);
+L12ae:
+    AOT_BLOCK(0x12ae, 2);
+    // 12ae: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12b2:
+    AOT_BLOCK(0x12b2, 4);
+    // 12b2: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x12b6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 12b6: tst c368
+    {
+        a = 0xc368;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 12ba: bne 12ee
+    if (!Z)
+        AOT_GOTO(0x12ee, L12ee);
+    AOT_GOTO(0x12bc, L12bc);
+L12bc:
+    AOT_BLOCK(0x12bc, 2);
+    // 12bc: tst c35e
+    {
+        a = 0xc35e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 12c0: bne 12ee
+    if (!Z)
+        AOT_GOTO(0x12ee, L12ee);
+    AOT_GOTO(0x12c2, L12c2);
+L12c2:
+    AOT_BLOCK(0x12c2, 3);
+    // 12c2: mov $6eb0, (sp)
+    {
+        src = uint16_t(0x6eb0);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 12c6: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12ca: jsr pc, *$1908
+    {
+        a = 0x1908;
+        r[6] -= 2;
+        WR16(r[6], 0x12ce);
+    }
+    AOT_GOTO(0x1908, L1908);
+L12ce:
+    AOT_BLOCK(0x12ce, 7);
+    // 12ce: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 12d0: movb $1f, 6eb8
+    {
+        src = uint8_t(0x1f);
+        b = 0x6eb8;
+        WR8(b, src);
+    }
+    // 12d6: mov cdaa, 6eba
+    {
+        a = 0xcdaa;
+        src = RD16(a);
+        b = 0x6eba;
+        WR16(b, src);
+    }
+    // 12dc: mov $c, (sp)
+    {
+        src = uint16_t(0x000c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 12e0: mov $6eb0, -(sp)
+    {
+        src = uint16_t(0x6eb0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 12e4: mov $cba2, -(sp)
+    {
+        src = uint16_t(0xcba2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12e8: jsr pc, *$1332
+    {
+        a = 0x1332;
+        r[6] -= 2;
+        WR16(r[6], 0x12ec);
+    }
+    AOT_GOTO(0x1332, L1332);
+L12ec:
+    AOT_BLOCK(0x12ec, 1);
+    // 12ec: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x12ee, L12ee);
+L12ee:
+    AOT_BLOCK(0x12ee, 2);
+    // 12ee: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12f2:
+    AOT_BLOCK(0x12f2, 7);
+    // 12f2: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x12f6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 12f6: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 12fa: asr r3
+    {
+        src = r[3];
+        val = int16_t(src) >> 1;
+        r[3] = val;
+    }
+    // 12fc: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1300: sub r3, 6a76
+    {
+        src = r[3];
+        b = 0x6a76;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x6a76;
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 1304: blt 131e
+    if (N ^ V)
+        AOT_GOTO(0x131e, L131e);
+    AOT_GOTO(0x1306, L1306);
+L1306:
+    AOT_BLOCK(0x1306, 2);
+    // 1306: sub r3, 6a78
+    {
+        src = r[3];
+        b = 0x6a78;
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = 0x6a78;
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 130a: ble 131a
+    if (Z || (N ^ V))
+        AOT_GOTO(0x131a, L131a);
+    AOT_GOTO(0x130c, L130c);
+L130c:
+    AOT_BLOCK(0x130c, 1);
+    // 130c: mov 6a72, r2
+    {
+        a = 0x6a72;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1310, L1310);
+L1310:
+    AOT_BLOCK(0x1310, 2);
+    // 1310: mov (r2)+, (r4)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1312: sob r3, 2
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x1310, L1310);
+    AOT_GOTO(0x1314, L1314);
+L1314:
+    AOT_BLOCK(0x1314, 2);
+    // 1314: mov r2, 6a72
+    {
+        src = r[2];
+        b = 0x6a72;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1318: br 132e
+    AOT_GOTO(0x132e, L132e);
+L131a:
+    AOT_BLOCK(0x131a, 1);
+    // 131a: add r3, 6a78
+    {
+        src = r[3];
+        b = 0x6a78;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x131e, L131e);
+L131e:
+    AOT_BLOCK(0x131e, 1);
+    // 131e: add r3, 6a76
+    {
+        src = r[3];
+        b = 0x6a76;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1322, L1322);
+L1322:
+    AOT_BLOCK(0x1322, 2);
+    // 1322: mov $6a72, (sp)
+    {
+        src = uint16_t(0x6a72);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1326: jsr pc, *$148a
+    {
+        a = 0x148a;
+        r[6] -= 2;
+        WR16(r[6], 0x132a);
+    }
+    AOT_GOTO(0x148a, L148a);
+L132a:
+    AOT_BLOCK(0x132a, 2);
+    // 132a: mov r0, (r4)+
+    {
+        src = r[0];
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 132c: sob r3, 6
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x1322, L1322);
+    AOT_GOTO(0x132e, L132e);
+L132e:
+    AOT_BLOCK(0x132e, 2);
+    // 132e: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1332:
+    AOT_BLOCK(0x1332, 5);
+    // 1332: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1336;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1336: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 133a: mov 8(r5), r3
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 133e: asr r3
+    {
+        src = r[3];
+        val = int16_t(src) >> 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 1) != 0;
+        V = (val < 0) != ((src & 1) != 0);
+    }
+    AOT_GOTO(0x1340, L1340);
+L1340:
+    AOT_BLOCK(0x1340, 3);
+    // 1340: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1344: mov (r4)+, -(sp)
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1346: jsr pc, *$1956
+    {
+        a = 0x1956;
+        r[6] -= 2;
+        WR16(r[6], 0x134a);
+    }
+    AOT_GOTO(0x1956, L1956);
+L134a:
+    AOT_BLOCK(0x134a, 2);
+    // 134a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 134c: sob r3, 7
+    {
+        r[3]--;
+    }
+    if (r[3] != 0)
+        AOT_GOTO(0x1340, L1340);
+    AOT_GOTO(0x134e, L134e);
+L134e:
+    AOT_BLOCK(0x134e, 2);
+    // 134e: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1352:
+    AOT_BLOCK(0x1352, 19);
+    // 1352: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1356;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1356: sub $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 135a: mov 8(r5), r1
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 135e: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1362: ashc $fff8, r0
+    {
+        src = uint16_t(0xfff8) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 1366: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 136a: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 136e: mov 8(r5), r0
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1372: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1376: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 137a: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+    }
+    // 137e: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1382: dec *8(r4)
+    {
+        a = RD16(r[4] + 8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 1386: mov $6662, r3
+    {
+        src = uint16_t(0x6662);
+        r[3] = src;
+    }
+    // 138a: mov 2(r3), r1
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 138e: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 1390: cmp r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1394: bne 139c
+    if (!Z)
+        AOT_GOTO(0x139c, L139c);
+    AOT_GOTO(0x1396, L1396);
+L1396:
+    AOT_BLOCK(0x1396, 2);
+    // 1396: cmp r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 139a: beq 1434
+    if (Z)
+        AOT_GOTO(0x1434, L1434);
+    AOT_GOTO(0x139c, L139c);
+L139c:
+    AOT_BLOCK(0x139c, 5);
+    // 139c: mov $6868, r3
+    {
+        src = uint16_t(0x6868);
+        r[3] = src;
+    }
+    // 13a0: mov 2(r3), r1
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 13a4: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 13a6: cmp r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13aa: bne 13b2
+    if (!Z)
+        AOT_GOTO(0x13b2, L13b2);
+    AOT_GOTO(0x13ac, L13ac);
+L13ac:
+    AOT_BLOCK(0x13ac, 2);
+    // 13ac: cmp r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13b0: beq 1434
+    if (Z)
+        AOT_GOTO(0x1434, L1434);
+    AOT_GOTO(0x13b2, L13b2);
+L13b2:
+    AOT_BLOCK(0x13b2, 2);
+    // 13b2: tst (r3)
+    {
+        a = r[3];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 13b4: beq 13be
+    if (Z)
+        AOT_GOTO(0x13be, L13be);
+    AOT_GOTO(0x13b6, L13b6);
+L13b6:
+    AOT_BLOCK(0x13b6, 3);
+    // 13b6: mov $6662, r3
+    {
+        src = uint16_t(0x6662);
+        r[3] = src;
+    }
+    // 13ba: tst (r3)
+    {
+        a = r[3];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 13bc: bne 1426
+    if (!Z)
+        AOT_GOTO(0x1426, L1426);
+    AOT_GOTO(0x13be, L13be);
+L13be:
+    AOT_BLOCK(0x13be, 2);
+    // 13be: tst 6662
+    {
+        a = 0x6662;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 13c2: bne 13d6
+    if (!Z)
+        AOT_GOTO(0x13d6, L13d6);
+    AOT_GOTO(0x13c4, L13c4);
+L13c4:
+    AOT_BLOCK(0x13c4, 2);
+    // 13c4: tst 6868
+    {
+        a = 0x6868;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 13c8: bne 13d6
+    if (!Z)
+        AOT_GOTO(0x13d6, L13d6);
+    AOT_GOTO(0x13ca, L13ca);
+L13ca:
+    AOT_BLOCK(0x13ca, 2);
+    // 13ca: cmp 686a, 6664
+    {
+        a = 0x686a;
+        src = RD16(a);
+        b = 0x6664;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13d0: ble 13d6
+    if (Z || (N ^ V))
+        AOT_GOTO(0x13d6, L13d6);
+    AOT_GOTO(0x13d2, L13d2);
+L13d2:
+    AOT_BLOCK(0x13d2, 1);
+    // 13d2: mov $6662, r3
+    {
+        src = uint16_t(0x6662);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x13d6, L13d6);
+L13d6:
+    AOT_BLOCK(0x13d6, 10);
+    // 13d6: mov -8(r5), 2(r3)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+    }
+    // 13dc: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 13de: mov 8(r5), r1
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 13e2: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 13e6: bic $ff, r1
+    {
+        src = uint16_t(0x00ff);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 13ea: ashc $1, r0
+    {
+        src = uint16_t(0x0001) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 13ee: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13f0: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13f2: mov c376, -(sp)
+    {
+        a = 0xc376;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13f6: jsr pc, *$2306
+    {
+        a = 0x2306;
+        r[6] -= 2;
+        WR16(r[6], 0x13fa);
+    }
+    AOT_GOTO(0x2306, L2306);
+L13fa:
+    AOT_BLOCK(0x13fa, 6);
+    // 13fa: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 13fe: mov $200, (sp)
+    {
+        src = uint16_t(0x0200);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1402: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1404: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1408: mov c376, -(sp)
+    {
+        a = 0xc376;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 140c: jsr pc, *$2350
+    {
+        a = 0x2350;
+        r[6] -= 2;
+        WR16(r[6], 0x1410);
+    }
+    AOT_GOTO(0x2350, L2350);
+L1410:
+    AOT_BLOCK(0x1410, 4);
+    // 1410: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 1412: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+        C = (src & 1) != 0;
+    }
+    // 1414: mov r0, -10(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1418: bge 141e
+    if (!(N ^ V))
+        AOT_GOTO(0x141e, L141e);
+    AOT_GOTO(0x141a, L141a);
+L141a:
+    AOT_BLOCK(0x141a, 1);
+    // 141a: clr -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x141e, L141e);
+L141e:
+    AOT_BLOCK(0x141e, 2);
+    // 141e: mov -10(r5), 4(r3)
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        b = uint16_t(r[3] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1424: br 1434
+    AOT_GOTO(0x1434, L1434);
+L1426:
+    AOT_BLOCK(0x1426, 3);
+    // 1426: mov $4260, (sp)
+    {
+        src = uint16_t(0x4260);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 142a: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 142e: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x1432);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L1432:
+    AOT_BLOCK(0x1432, 1);
+    // 1432: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1434, L1434);
+L1434:
+    AOT_BLOCK(0x1434, 10);
+    // 1434: inc (r3)
+    {
+        a = r[3];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1436: mov -8(r5), 2(r4)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 143c: mov r3, 8(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 1440: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1444: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1446: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1448: add $6, r0
+    {
+        src = uint16_t(0x0006);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 144c: mov r0, (r4)
+    {
+        src = r[0];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 144e: cmp $ffff, a(r5)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[5] + 10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1454: beq 1462
+    if (Z)
+        AOT_GOTO(0x1462, L1462);
+    AOT_GOTO(0x1456, L1456);
+L1456:
+    AOT_BLOCK(0x1456, 2);
+    // 1456: mov a(r5), (sp)
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 145a: jsr pc, *$1478
+    {
+        a = 0x1478;
+        r[6] -= 2;
+        WR16(r[6], 0x145e);
+    }
+    AOT_GOTO(0x1478, L1478);
+L145e:
+    AOT_BLOCK(0x145e, 1);
+    // 145e: mov r0, 6(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1462, L1462);
+L1462:
+    AOT_BLOCK(0x1462, 4);
+    // 1462: mov 4(r3), r0
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1466: sub -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 146a: mov r0, 4(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 146e: bgt 1474
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1474, L1474);
+    AOT_GOTO(0x1470, L1470);
+L1470:
+    AOT_BLOCK(0x1470, 1);
+    // 1470: clr 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1474, L1474);
+L1474:
+    AOT_BLOCK(0x1474, 2);
+    // 1474: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1478:
+    AOT_BLOCK(0x1478, 7);
+    // 1478: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x147c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 147c: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1480: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+        C = (src & 1) != 0;
+    }
+    // 1482: bic $8000, r0
+    {
+        src = uint16_t(0x8000);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1486: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L148a:
+    AOT_BLOCK(0x148a, 5);
+    // 148a: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x148e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 148e: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1492: dec 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1496: bge 14ba
+    if (!(N ^ V))
+        AOT_GOTO(0x14ba, L14ba);
+    AOT_GOTO(0x1498, L1498);
+L1498:
+    AOT_BLOCK(0x1498, 9);
+    // 1498: mov $ffff, (sp)
+    {
+        src = uint16_t(0xffff);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 149c: mov 2(r4), r1
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 14a0: inc r1
+    {
+        val = int(int16_t(r[1])) + 1;
+        r[1] = val;
+        N = val < 0;
+    }
+    // 14a2: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 14a4: ashc $8, r0
+    {
+        src = uint16_t(0x0008) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 14a8: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 14aa: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 14ac: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14ae: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x14b2);
+    }
+    AOT_GOTO(0x1352, L1352);
+L14b2:
+    AOT_BLOCK(0x14b2, 2);
+    // 14b2: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 14b6: dec 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x14ba, L14ba);
+L14ba:
+    AOT_BLOCK(0x14ba, 2);
+    // 14ba: dec 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 14be: bgt 14e2
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x14e2, L14e2);
+    AOT_GOTO(0x14c0, L14c0);
+L14c0:
+    AOT_BLOCK(0x14c0, 2);
+    // 14c0: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 14c4: bge 14d4
+    if (!(N ^ V))
+        AOT_GOTO(0x14d4, L14d4);
+    AOT_GOTO(0x14c6, L14c6);
+L14c6:
+    AOT_BLOCK(0x14c6, 3);
+    // 14c6: mov $4002, (sp)
+    {
+        src = uint16_t(0x4002);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 14ca: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14ce: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x14d2);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L14d2:
+    AOT_BLOCK(0x14d2, 1);
+    // 14d2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x14d4, L14d4);
+L14d4:
+    AOT_BLOCK(0x14d4, 3);
+    // 14d4: inc 6a6e
+    {
+        a = 0x6a6e;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 14d8: dec *8(r4)
+    {
+        a = RD16(r[4] + 8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 14dc: mov $6a6e, 8(r4)
+    {
+        src = uint16_t(0x6a6e);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14e2, L14e2);
+L14e2:
+    AOT_BLOCK(0x14e2, 4);
+    // 14e2: mov *0(r4), r0
+    {
+        a = RD16(r[4] + 0);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 14e6: add $2, (r4)
+    {
+        src = uint16_t(0x0002);
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 14ea: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L14ee:
+    AOT_BLOCK(0x14ee, 9);
+    // 14ee: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x14f2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 14f2: sub $1e, sp
+    {
+        src = uint16_t(0x001e);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 14f6: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 14fa: mov $ffff, c376
+    {
+        src = uint16_t(0xffff);
+        b = 0xc376;
+        WR16(b, src);
+    }
+    // 1500: clrb 6a86
+    {
+        a = 0x6a86;
+        WR8(a, 0);
+    }
+    // 1504: mov r4, c378
+    {
+        src = r[4];
+        b = 0xc378;
+        WR16(b, src);
+    }
+    // 1508: cmpb $2d, (r4)
+    {
+        src = uint8_t(0x2d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 150c: bne 1584
+    if (!Z)
+        AOT_GOTO(0x1584, L1584);
+    AOT_GOTO(0x150e, L150e);
+L150e:
+    AOT_BLOCK(0x150e, 2);
+    // 150e: cmpb $6c, 1(r4)
+    {
+        src = uint8_t(0x6c);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1514: bne 1584
+    if (!Z)
+        AOT_GOTO(0x1584, L1584);
+    AOT_GOTO(0x1516, L1516);
+L1516:
+    AOT_BLOCK(0x1516, 2);
+    // 1516: tstb 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 151a: bne 1520
+    if (!Z)
+        AOT_GOTO(0x1520, L1520);
+    AOT_GOTO(0x151c, L151c);
+L151c:
+    AOT_BLOCK(0x151c, 1);
+    // 151c: mov $4269, r4
+    {
+        src = uint16_t(0x4269);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1520, L1520);
+L1520:
+    AOT_BLOCK(0x1520, 3);
+    // 1520: mov $426d, c378
+    {
+        src = uint16_t(0x426d);
+        b = 0xc378;
+        WR16(b, src);
+    }
+    // 1526: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1528: br 153c
+    AOT_GOTO(0x153c, L153c);
+L152a:
+    AOT_BLOCK(0x152a, 6);
+    // 152a: mov c378, r0
+    {
+        a = 0xc378;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 152e: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1530: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 1532: add r3, r1
+    {
+        src = r[3];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1534: movb 2(r1), c(r0)
+    {
+        a = uint16_t(r[1] + 2);
+        src = RD8(a);
+        b = uint16_t(r[0] + 12);
+        WR8(b, src);
+    }
+    // 153a: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x153c, L153c);
+L153c:
+    AOT_BLOCK(0x153c, 4);
+    // 153c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 153e: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1540: tstb 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1544: bne 152a
+    if (!Z)
+        AOT_GOTO(0x152a, L152a);
+    AOT_GOTO(0x1546, L1546);
+L1546:
+    AOT_BLOCK(0x1546, 13);
+    // 1546: mov c378, r0
+    {
+        a = 0xc378;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 154a: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 154c: movb $2e, c(r0)
+    {
+        src = uint8_t(0x2e);
+        b = uint16_t(r[0] + 12);
+        WR8(b, src);
+    }
+    // 1552: mov c378, r0
+    {
+        a = 0xc378;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1556: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1558: movb $61, d(r0)
+    {
+        src = uint8_t(0x61);
+        b = uint16_t(r[0] + 13);
+        WR8(b, src);
+    }
+    // 155e: mov c378, r0
+    {
+        a = 0xc378;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1562: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1564: clrb e(r0)
+    {
+        a = uint16_t(r[0] + 14);
+        WR8(a, 0);
+    }
+    // 1568: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 156a: mov c378, -(sp)
+    {
+        a = 0xc378;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 156e: add $4, (sp)
+    {
+        src = uint16_t(0x0004);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1572: jsr pc, *$2332
+    {
+        a = 0x2332;
+        r[6] -= 2;
+        WR16(r[6], 0x1576);
+    }
+    AOT_GOTO(0x2332, L2332);
+L1576:
+    AOT_BLOCK(0x1576, 3);
+    // 1576: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1578: mov r0, c376
+    {
+        src = r[0];
+        b = 0xc376;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 157c: blt 1584
+    if (N ^ V)
+        AOT_GOTO(0x1584, L1584);
+    AOT_GOTO(0x157e, L157e);
+L157e:
+    AOT_BLOCK(0x157e, 1);
+    // 157e: add $4, c378
+    {
+        src = uint16_t(0x0004);
+        b = 0xc378;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1584, L1584);
+L1584:
+    AOT_BLOCK(0x1584, 2);
+    // 1584: cmp $ffff, c376
+    {
+        src = uint16_t(0xffff);
+        b = 0xc376;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 158a: bne 15ac
+    if (!Z)
+        AOT_GOTO(0x15ac, L15ac);
+    AOT_GOTO(0x158c, L158c);
+L158c:
+    AOT_BLOCK(0x158c, 3);
+    // 158c: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 158e: mov c378, -(sp)
+    {
+        a = 0xc378;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1592: jsr pc, *$2332
+    {
+        a = 0x2332;
+        r[6] -= 2;
+        WR16(r[6], 0x1596);
+    }
+    AOT_GOTO(0x2332, L2332);
+L1596:
+    AOT_BLOCK(0x1596, 3);
+    // 1596: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1598: mov r0, c376
+    {
+        src = r[0];
+        b = 0xc376;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 159c: bge 15ac
+    if (!(N ^ V))
+        AOT_GOTO(0x15ac, L15ac);
+    AOT_GOTO(0x159e, L159e);
+L159e:
+    AOT_BLOCK(0x159e, 3);
+    // 159e: mov $4289, (sp)
+    {
+        src = uint16_t(0x4289);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15a2: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15a6: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x15aa);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L15aa:
+    AOT_BLOCK(0x15aa, 1);
+    // 15aa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x15ac, L15ac);
+L15ac:
+    AOT_BLOCK(0x15ac, 15);
+    // 15ac: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+    }
+    // 15b0: mov r0, 686a
+    {
+        src = r[0];
+        b = 0x686a;
+        WR16(b, src);
+    }
+    // 15b4: mov r0, 6664
+    {
+        src = r[0];
+        b = 0x6664;
+        WR16(b, src);
+    }
+    // 15b8: clr r0
+    {
+        r[0] = 0;
+    }
+    // 15ba: mov r0, 6868
+    {
+        src = r[0];
+        b = 0x6868;
+        WR16(b, src);
+    }
+    // 15be: mov r0, 6662
+    {
+        src = r[0];
+        b = 0x6662;
+        WR16(b, src);
+    }
+    // 15c2: mov $6a6e, r0
+    {
+        src = uint16_t(0x6a6e);
+        r[0] = src;
+    }
+    // 15c6: mov r0, 6a84
+    {
+        src = r[0];
+        b = 0x6a84;
+        WR16(b, src);
+    }
+    // 15ca: mov r0, 6a7a
+    {
+        src = r[0];
+        b = 0x6a7a;
+        WR16(b, src);
+    }
+    // 15ce: mov $2, 6a6e
+    {
+        src = uint16_t(0x0002);
+        b = 0x6a6e;
+        WR16(b, src);
+    }
+    // 15d4: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15d8: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        N = false;
+        C = false;
+    }
+    // 15da: sxt -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, -int(N));
+    }
+    // 15dc: mov $6a72, -(sp)
+    {
+        src = uint16_t(0x6a72);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15e0: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x15e4);
+    }
+    AOT_GOTO(0x1352, L1352);
+L15e4:
+    AOT_BLOCK(0x15e4, 3);
+    // 15e4: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 15e8: tst 6a78
+    {
+        a = 0x6a78;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 15ec: bgt 15fc
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x15fc, L15fc);
+    AOT_GOTO(0x15ee, L15ee);
+L15ee:
+    AOT_BLOCK(0x15ee, 3);
+    // 15ee: mov $4002, (sp)
+    {
+        src = uint16_t(0x4002);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15f2: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15f6: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x15fa);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L15fa:
+    AOT_BLOCK(0x15fa, 1);
+    // 15fa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x15fc, L15fc);
+L15fc:
+    AOT_BLOCK(0x15fc, 2);
+    // 15fc: mov $6a72, (sp)
+    {
+        src = uint16_t(0x6a72);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1600: jsr pc, *$148a
+    {
+        a = 0x148a;
+        r[6] -= 2;
+        WR16(r[6], 0x1604);
+    }
+    AOT_GOTO(0x148a, L148a);
+L1604:
+    AOT_BLOCK(0x1604, 2);
+    // 1604: cmp $ff65, r0
+    {
+        src = uint16_t(0xff65);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1608: beq 160e
+    if (Z)
+        AOT_GOTO(0x160e, L160e);
+    AOT_GOTO(0x160a, L160a);
+L160a:
+    AOT_BLOCK(0x160a, 2);
+    // 160a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 160c: br 1662
+    AOT_GOTO(0x1662, L1662);
+L160e:
+    AOT_BLOCK(0x160e, 5);
+    // 160e: mov $1a, (sp)
+    {
+        src = uint16_t(0x001a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1612: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        N = int16_t(src) < 0;
+    }
+    // 1616: sxt -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, -int(N));
+    }
+    // 1618: mov $6a72, -(sp)
+    {
+        src = uint16_t(0x6a72);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 161c: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x1620);
+    }
+    AOT_GOTO(0x1352, L1352);
+L1620:
+    AOT_BLOCK(0x1620, 3);
+    // 1620: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+    }
+    // 1624: tst 6a78
+    {
+        a = 0x6a78;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1628: ble 164e
+    if (Z || (N ^ V))
+        AOT_GOTO(0x164e, L164e);
+    AOT_GOTO(0x162a, L162a);
+L162a:
+    AOT_BLOCK(0x162a, 3);
+    // 162a: mov $1a, (sp)
+    {
+        src = uint16_t(0x001a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 162e: mov $6a86, -(sp)
+    {
+        src = uint16_t(0x6a86);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1632: jsr pc, *$12f2
+    {
+        a = 0x12f2;
+        r[6] -= 2;
+        WR16(r[6], 0x1636);
+    }
+    AOT_GOTO(0x12f2, L12f2);
+L1636:
+    AOT_BLOCK(0x1636, 5);
+    // 1636: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1638: mov $e, (sp)
+    {
+        src = uint16_t(0x000e);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 163c: mov $4010, -(sp)
+    {
+        src = uint16_t(0x4010);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1640: mov $6a86, -(sp)
+    {
+        src = uint16_t(0x6a86);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1644: jsr pc, *$21f2
+    {
+        a = 0x21f2;
+        r[6] -= 2;
+        WR16(r[6], 0x1648);
+    }
+    AOT_GOTO(0x21f2, L21f2);
+L1648:
+    AOT_BLOCK(0x1648, 3);
+    // 1648: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 164a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 164c: beq 1666
+    if (Z)
+        AOT_GOTO(0x1666, L1666);
+    AOT_GOTO(0x164e, L164e);
+L164e:
+    AOT_BLOCK(0x164e, 2);
+    // 164e: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1652: br 1662
+    AOT_GOTO(0x1662, L1662);
+L1654:
+    AOT_BLOCK(0x1654, 1);
+    // 1654: bgt 165e
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x165e, L165e);
+    AOT_GOTO(0x1656, L1656);
+L1656:
+    AOT_BLOCK(0x1656, 2);
+    // 1656: cmp -c(r5), 6a96
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = 0x6a96;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 165c: blos 167e
+    if (C | Z)
+        AOT_GOTO(0x167e, L167e);
+    AOT_GOTO(0x165e, L165e);
+L165e:
+    AOT_BLOCK(0x165e, 1);
+    // 165e: mov $3, r0
+    {
+        src = uint16_t(0x0003);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1662, L1662);
+L1662:
+    AOT_BLOCK(0x1662, 2);
+    // 1662: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1666:
+    AOT_BLOCK(0x1666, 4);
+    // 1666: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1668: add $ffdc, (sp)
+    {
+        src = uint16_t(0xffdc);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 166c: mov c376, -(sp)
+    {
+        a = 0xc376;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1670: jsr pc, *$2298
+    {
+        a = 0x2298;
+        r[6] -= 2;
+        WR16(r[6], 0x1674);
+    }
+    AOT_GOTO(0x2298, L2298);
+L1674:
+    AOT_BLOCK(0x1674, 3);
+    // 1674: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1676: cmp -e(r5), 6a94
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        b = 0x6a94;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 167c: bge 1654
+    if (!(N ^ V))
+        AOT_GOTO(0x1654, L1654);
+    AOT_GOTO(0x167e, L167e);
+L167e:
+    AOT_BLOCK(0x167e, 2);
+    // 167e: mov $2, r0
+    {
+        src = uint16_t(0x0002);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1682: br 1662
+    AOT_GOTO(0x1662, L1662);
+L1684:
+    AOT_BLOCK(0x1684, 5);
+    // 1684: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1688;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1688: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 168c: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 1690: mov $6eb0, r3
+    {
+        src = uint16_t(0x6eb0);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1694, L1694);
+L1694:
+    AOT_BLOCK(0x1694, 7);
+    // 1694: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1698: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 169a: movb (r3)+, r1
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 169c: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 169e: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 16a2: cmp $6eb8, r3
+    {
+        src = uint16_t(0x6eb8);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 16a6: bhi 1694
+    if (!(C | Z))
+        AOT_GOTO(0x1694, L1694);
+    AOT_GOTO(0x16a8, L16a8);
+L16a8:
+    AOT_BLOCK(0x16a8, 7);
+    // 16a8: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 16aa: bic $8000, r1
+    {
+        src = uint16_t(0x8000);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+        N = (val & 0x8000) != 0;
+    }
+    // 16ae: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 16b0: div $44f, r0
+    {
+        src = int16_t(uint16_t(0x044f));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 16b4: mov r1, r4
+    {
+        src = r[1];
+        r[4] = src;
+    }
+    // 16b6: asl r4
+    {
+        src = r[4];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[4] = val;
+    }
+    // 16b8: add $ab16, r4
+    {
+        src = uint16_t(0xab16);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x16bc, L16bc);
+L16bc:
+    AOT_BLOCK(0x16bc, 2);
+    // 16bc: tst (r4)
+    {
+        a = r[4];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 16be: bne 16c6
+    if (!Z)
+        AOT_GOTO(0x16c6, L16c6);
+    AOT_GOTO(0x16c0, L16c0);
+L16c0:
+    AOT_BLOCK(0x16c0, 3);
+    // 16c0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 16c2: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L16c6:
+    AOT_BLOCK(0x16c6, 3);
+    // 16c6: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 16c8: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+        C = false;
+    }
+    // 16cc: mov $6eb0, r3
+    {
+        src = uint16_t(0x6eb0);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x16d0, L16d0);
+L16d0:
+    AOT_BLOCK(0x16d0, 2);
+    // 16d0: cmp $6eb8, r3
+    {
+        src = uint16_t(0x6eb8);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 16d4: blos 16e0
+    if (C | Z)
+        AOT_GOTO(0x16e0, L16e0);
+    AOT_GOTO(0x16d6, L16d6);
+L16d6:
+    AOT_BLOCK(0x16d6, 2);
+    // 16d6: cmpb (r2)+, (r3)+
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 16d8: beq 16d0
+    if (Z)
+        AOT_GOTO(0x16d0, L16d0);
+    AOT_GOTO(0x16da, L16da);
+L16da:
+    AOT_BLOCK(0x16da, 1);
+    // 16da: mov $1, -a(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x16e0, L16e0);
+L16e0:
+    AOT_BLOCK(0x16e0, 2);
+    // 16e0: tst -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 16e4: beq 16c0
+    if (Z)
+        AOT_GOTO(0x16c0, L16c0);
+    AOT_GOTO(0x16e6, L16e6);
+L16e6:
+    AOT_BLOCK(0x16e6, 3);
+    // 16e6: add $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+    }
+    // 16ea: cmp $b3b4, r4
+    {
+        src = uint16_t(0xb3b4);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 16ee: bhi 16bc
+    if (!(C | Z))
+        AOT_GOTO(0x16bc, L16bc);
+    AOT_GOTO(0x16f0, L16f0);
+L16f0:
+    AOT_BLOCK(0x16f0, 2);
+    // 16f0: mov $ab12, r4
+    {
+        src = uint16_t(0xab12);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16f4: br 16bc
+    AOT_GOTO(0x16bc, L16bc);
+L16f6:
+    AOT_BLOCK(0x16f6, 5);
+    // 16f6: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x16fa;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 16fa: mov $6eb0, (sp)
+    {
+        src = uint16_t(0x6eb0);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 16fe: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1702: jsr pc, *$1908
+    {
+        a = 0x1908;
+        r[6] -= 2;
+        WR16(r[6], 0x1706);
+    }
+    AOT_GOTO(0x1908, L1908);
+L1706:
+    AOT_BLOCK(0x1706, 4);
+    // 1706: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1708: movb $20, 6eb8
+    {
+        src = uint8_t(0x20);
+        b = 0x6eb8;
+        WR8(b, src);
+    }
+    // 170e: clr 6eba
+    {
+        a = 0x6eba;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1712: jsr pc, 1684
+    {
+        a = 0x1684;
+        r[6] -= 2;
+        WR16(r[6], 0x1716);
+    }
+    AOT_GOTO(0x1684, L1684);
+L1716:
+    AOT_BLOCK(0x1716, 2);
+    // 1716: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L171a:
+    AOT_BLOCK(0x171a, 4);
+    // 171a: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x171e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 171e: tst *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1722: bne 1782
+    if (!Z)
+        AOT_GOTO(0x1782, L1782);
+    AOT_GOTO(0x1724, L1724);
+L1724:
+    AOT_BLOCK(0x1724, 2);
+    // 1724: cmp $44f, ab10
+    {
+        src = uint16_t(0x044f);
+        b = 0xab10;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 172a: bgt 173a
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x173a, L173a);
+    AOT_GOTO(0x172c, L172c);
+L172c:
+    AOT_BLOCK(0x172c, 3);
+    // 172c: mov $4295, (sp)
+    {
+        src = uint16_t(0x4295);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1730: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1734: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x1738);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L1738:
+    AOT_BLOCK(0x1738, 1);
+    // 1738: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x173a, L173a);
+L173a:
+    AOT_BLOCK(0x173a, 14);
+    // 173a: mov ab10, r0
+    {
+        a = 0xab10;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 173e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1740: mov 4(r5), -5d90(r0)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + -23952);
+        WR16(b, src);
+    }
+    // 1746: mov ab10, r1
+    {
+        a = 0xab10;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 174a: mul $c, r1
+    {
+        src = int16_t(uint16_t(0x000c));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 174e: inc ab10
+    {
+        a = 0xab10;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1752: mov r1, r4
+    {
+        src = r[1];
+        r[4] = src;
+    }
+    // 1754: add $6ebc, r4
+    {
+        src = uint16_t(0x6ebc);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1758: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 175a: mov r0, ab0e
+    {
+        src = r[0];
+        b = 0xab0e;
+        WR16(b, src);
+    }
+    // 175e: mov r0, *4(r5)
+    {
+        src = r[0];
+        b = RD16(r[5] + 4);
+        WR16(b, src);
+    }
+    // 1762: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1764: mov $6eb0, -(sp)
+    {
+        src = uint16_t(0x6eb0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1768: jsr pc, *$1908
+    {
+        a = 0x1908;
+        r[6] -= 2;
+        WR16(r[6], 0x176c);
+    }
+    AOT_GOTO(0x1908, L1908);
+L176c:
+    AOT_BLOCK(0x176c, 4);
+    // 176c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 176e: movb 6eb8, 8(r4)
+    {
+        a = 0x6eb8;
+        src = RD8(a);
+        b = uint16_t(r[4] + 8);
+        WR8(b, src);
+    }
+    // 1774: mov 6eba, a(r4)
+    {
+        a = 0x6eba;
+        src = RD16(a);
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+    }
+    // 177a: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x177e, L177e);
+L177e:
+    AOT_BLOCK(0x177e, 2);
+    // 177e: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1782:
+    AOT_BLOCK(0x1782, 3);
+    // 1782: mov *4(r5), ab0e
+    {
+        a = RD16(r[5] + 4);
+        src = RD16(a);
+        b = 0xab0e;
+        WR16(b, src);
+    }
+    // 1788: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 178a: br 177e
+    AOT_GOTO(0x177e, L177e);
+L178c:
+    AOT_BLOCK(0x178c, 5);
+    // 178c: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1790;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1790: movb 6eb8, r0
+    {
+        a = 0x6eb8;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1794: cmp r0, $2
+    {
+        src = r[0];
+        dst = uint16_t(0x0002);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1798: beq 17d0
+    if (Z)
+        AOT_GOTO(0x17d0, L17d0);
+    AOT_GOTO(0x179a, L179a);
+L179a:
+    AOT_BLOCK(0x179a, 2);
+    // 179a: cmp r0, $3
+    {
+        src = r[0];
+        dst = uint16_t(0x0003);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 179e: beq 17d8
+    if (Z)
+        AOT_GOTO(0x17d8, L17d8);
+    AOT_GOTO(0x17a0, L17a0);
+L17a0:
+    AOT_BLOCK(0x17a0, 2);
+    // 17a0: cmp r0, $4
+    {
+        src = r[0];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17a4: beq 17e0
+    if (Z)
+        AOT_GOTO(0x17e0, L17e0);
+    AOT_GOTO(0x17a6, L17a6);
+L17a6:
+    AOT_BLOCK(0x17a6, 2);
+    // 17a6: cmp r0, $20
+    {
+        src = r[0];
+        dst = uint16_t(0x0020);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17aa: beq 17cc
+    if (Z)
+        AOT_GOTO(0x17cc, L17cc);
+    AOT_GOTO(0x17ac, L17ac);
+L17ac:
+    AOT_BLOCK(0x17ac, 2);
+    // 17ac: cmp r0, $22
+    {
+        src = r[0];
+        dst = uint16_t(0x0022);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17b0: beq 17d0
+    if (Z)
+        AOT_GOTO(0x17d0, L17d0);
+    AOT_GOTO(0x17b2, L17b2);
+L17b2:
+    AOT_BLOCK(0x17b2, 2);
+    // 17b2: cmp r0, $23
+    {
+        src = r[0];
+        dst = uint16_t(0x0023);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17b6: beq 17d8
+    if (Z)
+        AOT_GOTO(0x17d8, L17d8);
+    AOT_GOTO(0x17b8, L17b8);
+L17b8:
+    AOT_BLOCK(0x17b8, 2);
+    // 17b8: cmp r0, $24
+    {
+        src = r[0];
+        dst = uint16_t(0x0024);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17bc: beq 17e0
+    if (Z)
+        AOT_GOTO(0x17e0, L17e0);
+    AOT_GOTO(0x17be, L17be);
+L17be:
+    AOT_BLOCK(0x17be, 2);
+    // 17be: bitb $20, 6eb8
+    {
+        src = uint8_t(0x20);
+        b = 0x6eb8;
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 17c4: beq 17cc
+    if (Z)
+        AOT_GOTO(0x17cc, L17cc);
+    AOT_GOTO(0x17c6, L17c6);
+L17c6:
+    AOT_BLOCK(0x17c6, 1);
+    // 17c6: movb $21, 6eb8
+    {
+        src = uint8_t(0x21);
+        b = 0x6eb8;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17cc, L17cc);
+L17cc:
+    AOT_BLOCK(0x17cc, 2);
+    // 17cc: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L17d0:
+    AOT_BLOCK(0x17d0, 2);
+    // 17d0: add c382, 6eba
+    {
+        a = 0xc382;
+        src = RD16(a);
+        b = 0x6eba;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 17d6: br 17cc
+    AOT_GOTO(0x17cc, L17cc);
+L17d8:
+    AOT_BLOCK(0x17d8, 2);
+    // 17d8: add c384, 6eba
+    {
+        a = 0xc384;
+        src = RD16(a);
+        b = 0x6eba;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 17de: br 17cc
+    AOT_GOTO(0x17cc, L17cc);
+L17e0:
+    AOT_BLOCK(0x17e0, 2);
+    // 17e0: add c386, 6eba
+    {
+        a = 0xc386;
+        src = RD16(a);
+        b = 0x6eba;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 17e6: br 17cc
+    AOT_GOTO(0x17cc, L17cc);
+L17e8:
+    AOT_BLOCK(0x17e8, 4);
+    // 17e8: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x17ec;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 17ec: tst c388
+    {
+        a = 0xc388;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 17f0: bne 17fa
+    if (!Z)
+        AOT_GOTO(0x17fa, L17fa);
+    AOT_GOTO(0x17f2, L17f2);
+L17f2:
+    AOT_BLOCK(0x17f2, 2);
+    // 17f2: mov $42ab, (sp)
+    {
+        src = uint16_t(0x42ab);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17f6: jsr pc, *$19c8
+    {
+        a = 0x19c8;
+        r[6] -= 2;
+        WR16(r[6], 0x17fa);
+    }
+    AOT_GOTO(0x19c8, L19c8);
+L17fa:
+    AOT_BLOCK(0x17fa, 2);
+    // 17fa: tst c378
+    {
+        a = 0xc378;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 17fe: beq 182a
+    if (Z)
+        AOT_GOTO(0x182a, L182a);
+    AOT_GOTO(0x1800, L1800);
+L1800:
+    AOT_BLOCK(0x1800, 3);
+    // 1800: mov c378, (sp)
+    {
+        a = 0xc378;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1804: mov $42af, -(sp)
+    {
+        src = uint16_t(0x42af);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1808: jsr pc, *$19c8
+    {
+        a = 0x19c8;
+        r[6] -= 2;
+        WR16(r[6], 0x180c);
+    }
+    AOT_GOTO(0x19c8, L19c8);
+L180c:
+    AOT_BLOCK(0x180c, 3);
+    // 180c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 180e: tstb 6a86
+    {
+        a = 0x6a86;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1812: beq 1822
+    if (Z)
+        AOT_GOTO(0x1822, L1822);
+    AOT_GOTO(0x1814, L1814);
+L1814:
+    AOT_BLOCK(0x1814, 3);
+    // 1814: mov $6a86, (sp)
+    {
+        src = uint16_t(0x6a86);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1818: mov $42b2, -(sp)
+    {
+        src = uint16_t(0x42b2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 181c: jsr pc, *$19c8
+    {
+        a = 0x19c8;
+        r[6] -= 2;
+        WR16(r[6], 0x1820);
+    }
+    AOT_GOTO(0x19c8, L19c8);
+L1820:
+    AOT_BLOCK(0x1820, 1);
+    // 1820: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1822, L1822);
+L1822:
+    AOT_BLOCK(0x1822, 2);
+    // 1822: mov $42ba, (sp)
+    {
+        src = uint16_t(0x42ba);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1826: jsr pc, *$19c8
+    {
+        a = 0x19c8;
+        r[6] -= 2;
+        WR16(r[6], 0x182a);
+    }
+    AOT_GOTO(0x19c8, L19c8);
+L182a:
+    AOT_BLOCK(0x182a, 3);
+    // 182a: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 182e: mov $42bd, -(sp)
+    {
+        src = uint16_t(0x42bd);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1832: jsr pc, *$19c8
+    {
+        a = 0x19c8;
+        r[6] -= 2;
+        WR16(r[6], 0x1836);
+    }
+    AOT_GOTO(0x19c8, L19c8);
+L1836:
+    AOT_BLOCK(0x1836, 3);
+    // 1836: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1838: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 183e: bge 1844
+    if (!(N ^ V))
+        AOT_GOTO(0x1844, L1844);
+    AOT_GOTO(0x1840, L1840);
+L1840:
+    AOT_BLOCK(0x1840, 1);
+    // 1840: jsr pc, 003c
+    {
+        a = 0x003c;
+        r[6] -= 2;
+        WR16(r[6], 0x1844);
+    }
+    AOT_GOTO(0x003c, L003c);
+L1844:
+    AOT_BLOCK(0x1844, 3);
+    // 1844: mov 4(r5), c388
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0xc388;
+        WR16(b, src);
+    }
+    // 184a: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L184e:
+    AOT_BLOCK(0x184e, 8);
+    // 184e: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1852;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1852: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1856: mov 6(r5), r2
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 185a: ash $fffc, r2
+    {
+        src = uint16_t(0xfffc) & 077;
+        val16 = r[2];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 185e: bic $f000, r2
+    {
+        src = uint16_t(0xf000);
+        dst = r[2];
+        val = (~src) & dst;
+        r[2] = val;
+    }
+    // 1862: mov $b3b4, r4
+    {
+        src = uint16_t(0xb3b4);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1866: br 1876
+    AOT_GOTO(0x1876, L1876);
+L1868:
+    AOT_BLOCK(0x1868, 2);
+    // 1868: cmp r2, (r4)
+    {
+        src = r[2];
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 186a: bne 1872
+    if (!Z)
+        AOT_GOTO(0x1872, L1872);
+    AOT_GOTO(0x186c, L186c);
+L186c:
+    AOT_BLOCK(0x186c, 2);
+    // 186c: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1870: br 1888
+    AOT_GOTO(0x1888, L1888);
+L1872:
+    AOT_BLOCK(0x1872, 1);
+    // 1872: add $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1876, L1876);
+L1876:
+    AOT_BLOCK(0x1876, 2);
+    // 1876: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1878: bhi 1868
+    if (!(C | Z))
+        AOT_GOTO(0x1868, L1868);
+    AOT_GOTO(0x187a, L187a);
+L187a:
+    AOT_BLOCK(0x187a, 3);
+    // 187a: mov $42c1, (sp)
+    {
+        src = uint16_t(0x42c1);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 187e: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1882: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x1886);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L1886:
+    AOT_BLOCK(0x1886, 1);
+    // 1886: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1888, L1888);
+L1888:
+    AOT_BLOCK(0x1888, 2);
+    // 1888: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L188c:
+    AOT_BLOCK(0x188c, 7);
+    // 188c: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1890;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1890: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1894: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1898: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 189c: mov $6a72, -(sp)
+    {
+        src = uint16_t(0x6a72);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18a0: jsr pc, *$1352
+    {
+        a = 0x1352;
+        r[6] -= 2;
+        WR16(r[6], 0x18a4);
+    }
+    AOT_GOTO(0x1352, L1352);
+L18a4:
+    AOT_BLOCK(0x18a4, 4);
+    // 18a4: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 18a8: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 18ac: mov $6aa0, -(sp)
+    {
+        src = uint16_t(0x6aa0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18b0: jsr pc, *$12f2
+    {
+        a = 0x12f2;
+        r[6] -= 2;
+        WR16(r[6], 0x18b4);
+    }
+    AOT_GOTO(0x12f2, L12f2);
+L18b4:
+    AOT_BLOCK(0x18b4, 3);
+    // 18b4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 18b6: cmp $107, 6aa0
+    {
+        src = uint16_t(0x0107);
+        b = 0x6aa0;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18bc: beq 18cc
+    if (Z)
+        AOT_GOTO(0x18cc, L18cc);
+    AOT_GOTO(0x18be, L18be);
+L18be:
+    AOT_BLOCK(0x18be, 3);
+    // 18be: mov $42d4, (sp)
+    {
+        src = uint16_t(0x42d4);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 18c2: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18c6: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x18ca);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L18ca:
+    AOT_BLOCK(0x18ca, 1);
+    // 18ca: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x18cc, L18cc);
+L18cc:
+    AOT_BLOCK(0x18cc, 20);
+    // 18cc: mov 6aa2, r4
+    {
+        a = 0x6aa2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 18d0: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 18d2: bic $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 18d6: mov r4, 6aa2
+    {
+        src = r[4];
+        b = 0x6aa2;
+        WR16(b, src);
+    }
+    // 18da: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 18dc: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+    }
+    // 18de: mov r0, c384
+    {
+        src = r[0];
+        b = 0xc384;
+        WR16(b, src);
+    }
+    // 18e2: mov 6aa4, r3
+    {
+        a = 0x6aa4;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 18e6: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+    }
+    // 18e8: bic $1, r3
+    {
+        src = uint16_t(0x0001);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+    }
+    // 18ec: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 18ee: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 18f0: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        C = val != 0;
+    }
+    // 18f2: mov r0, c386
+    {
+        src = r[0];
+        b = 0xc386;
+        WR16(b, src);
+    }
+    // 18f6: mov 6aa6, r0
+    {
+        a = 0x6aa6;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 18fa: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 18fc: bic $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1900: mov r0, 6aa6
+    {
+        src = r[0];
+        b = 0x6aa6;
+        WR16(b, src);
+    }
+    // 1904: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1908:
+    AOT_BLOCK(0x1908, 6);
+    // 1908: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x190c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 190c: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1910: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1914: mov r3, r2
+    {
+        src = r[3];
+        r[2] = src;
+    }
+    // 1916: add $8, r2
+    {
+        src = uint16_t(0x0008);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x191a, L191a);
+L191a:
+    AOT_BLOCK(0x191a, 2);
+    // 191a: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 191c: beq 1926
+    if (Z)
+        AOT_GOTO(0x1926, L1926);
+    AOT_GOTO(0x191e, L191e);
+L191e:
+    AOT_BLOCK(0x191e, 2);
+    // 191e: cmp r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1920: blos 1926
+    if (C | Z)
+        AOT_GOTO(0x1926, L1926);
+    AOT_GOTO(0x1922, L1922);
+L1922:
+    AOT_BLOCK(0x1922, 1);
+    // 1922: br 191a
+    AOT_GOTO(0x191a, L191a);
+L1924:
+    AOT_BLOCK(0x1924, 1);
+    // 1924: clrb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1926, L1926);
+L1926:
+    AOT_BLOCK(0x1926, 2);
+    // 1926: cmp r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1928: bhi 1924
+    if (!(C | Z))
+        AOT_GOTO(0x1924, L1924);
+    AOT_GOTO(0x192a, L192a);
+L192a:
+    AOT_BLOCK(0x192a, 2);
+    // 192a: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L192e:
+    AOT_BLOCK(0x192e, 2);
+    // 192e: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1932;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    AOT_GOTO(0x1932, L1932);
+L1932:
+    AOT_BLOCK(0x1932, 5);
+    // 1932: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1936: mov 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 193a: inc 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 193e: cmpb (r1), (r0)
+    {
+        a = r[1];
+        src = RD8(a);
+        b = r[0];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1940: bne 1952
+    if (!Z)
+        AOT_GOTO(0x1952, L1952);
+    AOT_GOTO(0x1942, L1942);
+L1942:
+    AOT_BLOCK(0x1942, 3);
+    // 1942: inc 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1946: tstb (r0)
+    {
+        a = r[0];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1948: bne 1932
+    if (!Z)
+        AOT_GOTO(0x1932, L1932);
+    AOT_GOTO(0x194a, L194a);
+L194a:
+    AOT_BLOCK(0x194a, 1);
+    // 194a: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x194e, L194e);
+L194e:
+    AOT_BLOCK(0x194e, 2);
+    // 194e: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1952:
+    AOT_BLOCK(0x1952, 2);
+    // 1952: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1954: br 194e
+    AOT_GOTO(0x194e, L194e);
+L1956:
+    AOT_BLOCK(0x1956, 7);
+    // 1956: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x195a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 195a: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 195e: mov 4(r5), *4(r4)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = RD16(r[4] + 4);
+        WR16(b, src);
+    }
+    // 1964: add $2, 4(r4)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[4] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 196a: dec 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 196e: bgt 1976
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1976, L1976);
+    AOT_GOTO(0x1970, L1970);
+L1970:
+    AOT_BLOCK(0x1970, 2);
+    // 1970: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1972: jsr pc, *$197a
+    {
+        a = 0x197a;
+        r[6] -= 2;
+        WR16(r[6], 0x1976);
+    }
+    AOT_GOTO(0x197a, L197a);
+L1976:
+    AOT_BLOCK(0x1976, 2);
+    // 1976: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L197a:
+    AOT_BLOCK(0x197a, 9);
+    // 197a: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x197e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 197e: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1982: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1986: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 1988: add $6, r1
+    {
+        src = uint16_t(0x0006);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 198c: sub r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 198e: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1990: ble 19b4
+    if (Z || (N ^ V))
+        AOT_GOTO(0x19b4, L19b4);
+    AOT_GOTO(0x1992, L1992);
+L1992:
+    AOT_BLOCK(0x1992, 5);
+    // 1992: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1994: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1996: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 199a: mov (r4), -(sp)
+    {
+        a = r[4];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 199c: jsr pc, *$24b4
+    {
+        a = 0x24b4;
+        r[6] -= 2;
+        WR16(r[6], 0x19a0);
+    }
+    AOT_GOTO(0x24b4, L24b4);
+L19a0:
+    AOT_BLOCK(0x19a0, 3);
+    // 19a0: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 19a2: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 19a4: beq 19b4
+    if (Z)
+        AOT_GOTO(0x19b4, L19b4);
+    AOT_GOTO(0x19a6, L19a6);
+L19a6:
+    AOT_BLOCK(0x19a6, 3);
+    // 19a6: mov $42df, (sp)
+    {
+        src = uint16_t(0x42df);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19aa: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19ae: jsr pc, *$17e8
+    {
+        a = 0x17e8;
+        r[6] -= 2;
+        WR16(r[6], 0x19b2);
+    }
+    AOT_GOTO(0x17e8, L17e8);
+L19b2:
+    AOT_BLOCK(0x19b2, 1);
+    // 19b2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x19b4, L19b4);
+L19b4:
+    AOT_BLOCK(0x19b4, 6);
+    // 19b4: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 19b6: add $6, r0
+    {
+        src = uint16_t(0x0006);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 19ba: mov r0, 4(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 19be: mov $100, 2(r4)
+    {
+        src = uint16_t(0x0100);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 19c4: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L19c8:
+    AOT_BLOCK(0x19c8, 7);
+    // 19c8: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x19cc;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 19cc: mov $4340, (sp)
+    {
+        src = uint16_t(0x4340);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19d0: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19d2: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 19d6: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19da: jsr pc, *$19f4
+    {
+        a = 0x19f4;
+        r[6] -= 2;
+        WR16(r[6], 0x19de);
+    }
+    AOT_GOTO(0x19f4, L19f4);
+L19de:
+    AOT_BLOCK(0x19de, 3);
+    // 19de: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 19e0: bitb $20, 4346
+    {
+        src = uint8_t(0x20);
+        b = 0x4346;
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 19e6: beq 19f0
+    if (Z)
+        AOT_GOTO(0x19f0, L19f0);
+    AOT_GOTO(0x19e8, L19e8);
+L19e8:
+    AOT_BLOCK(0x19e8, 1);
+    // 19e8: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x19ec, L19ec);
+L19ec:
+    AOT_BLOCK(0x19ec, 2);
+    // 19ec: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L19f0:
+    AOT_BLOCK(0x19f0, 2);
+    // 19f0: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 19f2: br 19ec
+    AOT_GOTO(0x19ec, L19ec);
+L19f4:
+    AOT_BLOCK(0x19f4, 5);
+    // 19f4: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x19f8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 19f8: sub $8c, sp
+    {
+        src = uint16_t(0x008c);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 19fc: mov 4(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1a02: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a06, L1a06);
+L1a06:
+    AOT_BLOCK(0x1a06, 2);
+    // 1a06: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 1a08: mov -a(r5), r1
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a0c, L1a0c);
+L1a0c:
+    AOT_BLOCK(0x1a0c, 2);
+    // 1a0c: movb (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1a0e: beq 1a1a
+    if (Z)
+        AOT_GOTO(0x1a1a, L1a1a);
+    AOT_GOTO(0x1a10, L1a10);
+L1a10:
+    AOT_BLOCK(0x1a10, 2);
+    // 1a10: cmp r2, $25
+    {
+        src = r[2];
+        dst = uint16_t(0x0025);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a14: beq 1a1a
+    if (Z)
+        AOT_GOTO(0x1a1a, L1a1a);
+    AOT_GOTO(0x1a16, L1a16);
+L1a16:
+    AOT_BLOCK(0x1a16, 2);
+    // 1a16: movb r2, (r3)+
+    {
+        src = uint8_t(r[2]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1a18: br 1a0c
+    AOT_GOTO(0x1a0c, L1a0c);
+L1a1a:
+    AOT_BLOCK(0x1a1a, 3);
+    // 1a1a: mov r1, -a(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1a1e: cmp r3, sp
+    {
+        src = r[3];
+        dst = r[6];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a20: beq 1a38
+    if (Z)
+        AOT_GOTO(0x1a38, L1a38);
+    AOT_GOTO(0x1a22, L1a22);
+L1a22:
+    AOT_BLOCK(0x1a22, 7);
+    // 1a22: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+    }
+    // 1a24: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a28: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 1a2a: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a2c: sub r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 1a2e: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a30: jsr pc, 1c4a
+    {
+        a = 0x1c4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1a34);
+    }
+    AOT_GOTO(0x1c4a, L1c4a);
+L1a34:
+    AOT_BLOCK(0x1a34, 1);
+    // 1a34: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1a38, L1a38);
+L1a38:
+    AOT_BLOCK(0x1a38, 2);
+    // 1a38: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1a3a: bne 1a40
+    if (!Z)
+        AOT_GOTO(0x1a40, L1a40);
+    AOT_GOTO(0x1a3c, L1a3c);
+L1a3c:
+    AOT_BLOCK(0x1a3c, 2);
+    // 1a3c: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1a40:
+    AOT_BLOCK(0x1a40, 6);
+    // 1a40: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 1a42: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+    }
+    // 1a46: clr -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        WR16(a, 0);
+    }
+    // 1a4a: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 1a50: cmpb *-a(r5), $2d
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        dst = uint8_t(0x2d);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a56: bne 1a60
+    if (!Z)
+        AOT_GOTO(0x1a60, L1a60);
+    AOT_GOTO(0x1a58, L1a58);
+L1a58:
+    AOT_BLOCK(0x1a58, 2);
+    // 1a58: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1a5c: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1a60, L1a60);
+L1a60:
+    AOT_BLOCK(0x1a60, 2);
+    // 1a60: cmpb *-a(r5), $30
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        dst = uint8_t(0x30);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a66: bne 1a6e
+    if (!Z)
+        AOT_GOTO(0x1a6e, L1a6e);
+    AOT_GOTO(0x1a68, L1a68);
+L1a68:
+    AOT_BLOCK(0x1a68, 1);
+    // 1a68: mov $30, -12(r5)
+    {
+        src = uint16_t(0x0030);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a6e, L1a6e);
+L1a6e:
+    AOT_BLOCK(0x1a6e, 1);
+    // 1a6e: jsr r3, 1c0c
+    {
+        a = 0x1c0c;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x1a72;
+    }
+    AOT_GOTO(0x1c0c, L1c0c);
+L1a72:
+    AOT_BLOCK(0x1a72, 4);
+    // 1a72: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1a76: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+    }
+    // 1a7a: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a7e: bne 1a88
+    if (!Z)
+        AOT_GOTO(0x1a88, L1a88);
+    AOT_GOTO(0x1a80, L1a80);
+L1a80:
+    AOT_BLOCK(0x1a80, 1);
+    // 1a80: jsr r3, 1c0c
+    {
+        a = 0x1c0c;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x1a84;
+    }
+    AOT_GOTO(0x1c0c, L1c0c);
+L1a84:
+    AOT_BLOCK(0x1a84, 1);
+    // 1a84: mov r1, -10(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a88, L1a88);
+L1a88:
+    AOT_BLOCK(0x1a88, 1);
+    // 1a88: mov $42ec, r1
+    {
+        src = uint16_t(0x42ec);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a8c, L1a8c);
+L1a8c:
+    AOT_BLOCK(0x1a8c, 2);
+    // 1a8c: mov (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a8e: bne 1a96
+    if (!Z)
+        AOT_GOTO(0x1a96, L1a96);
+    AOT_GOTO(0x1a90, L1a90);
+L1a90:
+    AOT_BLOCK(0x1a90, 2);
+    // 1a90: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1a92: jmp 1bdc
+    {
+        a = 0x1bdc;
+    }
+    AOT_GOTO(0x1bdc, L1bdc);
+L1a96:
+    AOT_BLOCK(0x1a96, 2);
+    // 1a96: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a98: bne 1a8c
+    if (!Z)
+        AOT_GOTO(0x1a8c, L1a8c);
+    AOT_GOTO(0x1a9a, L1a9a);
+L1a9a:
+    AOT_BLOCK(0x1a9a, 1);
+    // 1a9a: jmp (r2)
+    {
+        a = r[2];
+    }
+    AOT_JUMP(a);
+L1a9c:
+    AOT_BLOCK(0x1a9c, 3);
+    // 1a9c: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1aa0: mov -e(r5), r2
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1aa4: jsr pc, 1c40
+    {
+        a = 0x1c40;
+        r[6] -= 2;
+        WR16(r[6], 0x1aa8);
+    }
+    AOT_GOTO(0x1c40, L1c40);
+L1aa8:
+    AOT_BLOCK(0x1aa8, 1);
+    // 1aa8: jmp *$1bdc
+    {
+        a = 0x1bdc;
+    }
+    AOT_GOTO(0x1bdc, L1bdc);
+L1aac:
+    AOT_BLOCK(0x1aac, 4);
+    // 1aac: movb *-a(r5), r0
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1ab0: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1ab4: cmp r0, $6f
+    {
+        src = r[0];
+        dst = uint16_t(0x006f);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ab8: beq 1ad6
+    if (Z)
+        AOT_GOTO(0x1ad6, L1ad6);
+    AOT_GOTO(0x1aba, L1aba);
+L1aba:
+    AOT_BLOCK(0x1aba, 2);
+    // 1aba: cmp r0, $78
+    {
+        src = r[0];
+        dst = uint16_t(0x0078);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1abe: beq 1ae2
+    if (Z)
+        AOT_GOTO(0x1ae2, L1ae2);
+    AOT_GOTO(0x1ac0, L1ac0);
+L1ac0:
+    AOT_BLOCK(0x1ac0, 2);
+    // 1ac0: cmp r0, $64
+    {
+        src = r[0];
+        dst = uint16_t(0x0064);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ac4: beq 1af8
+    if (Z)
+        AOT_GOTO(0x1af8, L1af8);
+    AOT_GOTO(0x1ac6, L1ac6);
+L1ac6:
+    AOT_BLOCK(0x1ac6, 2);
+    // 1ac6: cmp r0, $75
+    {
+        src = r[0];
+        dst = uint16_t(0x0075);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1aca: beq 1b0a
+    if (Z)
+        AOT_GOTO(0x1b0a, L1b0a);
+    AOT_GOTO(0x1acc, L1acc);
+L1acc:
+    AOT_BLOCK(0x1acc, 2);
+    // 1acc: dec -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1ad0: br 1af4
+    AOT_GOTO(0x1af4, L1af4);
+L1ad2:
+    AOT_BLOCK(0x1ad2, 2);
+    // 1ad2: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1ad4: br 1ad8
+    AOT_GOTO(0x1ad8, L1ad8);
+L1ad6:
+    AOT_BLOCK(0x1ad6, 1);
+    // 1ad6: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ad8, L1ad8);
+L1ad8:
+    AOT_BLOCK(0x1ad8, 2);
+    // 1ad8: mov $8, r2
+    {
+        src = uint16_t(0x0008);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1adc: br 1ae8
+    AOT_GOTO(0x1ae8, L1ae8);
+L1ade:
+    AOT_BLOCK(0x1ade, 2);
+    // 1ade: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1ae0: br 1ae4
+    AOT_GOTO(0x1ae4, L1ae4);
+L1ae2:
+    AOT_BLOCK(0x1ae2, 1);
+    // 1ae2: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ae4, L1ae4);
+L1ae4:
+    AOT_BLOCK(0x1ae4, 1);
+    // 1ae4: mov $10, r2
+    {
+        src = uint16_t(0x0010);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ae8, L1ae8);
+L1ae8:
+    AOT_BLOCK(0x1ae8, 2);
+    // 1ae8: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1aea: br 1b12
+    AOT_GOTO(0x1b12, L1b12);
+L1aec:
+    AOT_BLOCK(0x1aec, 3);
+    // 1aec: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1aee: sxt r0
+    {
+        r[0] = -int(N);
+        Z = !N;
+    }
+    // 1af0: bmi 1afe
+    if (N)
+        AOT_GOTO(0x1afe, L1afe);
+    AOT_GOTO(0x1af2, L1af2);
+L1af2:
+    AOT_BLOCK(0x1af2, 1);
+    // 1af2: br 1b0e
+    AOT_GOTO(0x1b0e, L1b0e);
+L1af4:
+    AOT_BLOCK(0x1af4, 2);
+    // 1af4: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1af6: br 1b0c
+    AOT_GOTO(0x1b0c, L1b0c);
+L1af8:
+    AOT_BLOCK(0x1af8, 2);
+    // 1af8: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1afa: bge 1b0c
+    if (!(N ^ V))
+        AOT_GOTO(0x1b0c, L1b0c);
+    AOT_GOTO(0x1afc, L1afc);
+L1afc:
+    AOT_BLOCK(0x1afc, 1);
+    // 1afc: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1afe, L1afe);
+L1afe:
+    AOT_BLOCK(0x1afe, 5);
+    // 1afe: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+    }
+    // 1b00: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 1b02: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+        C = C && val == -1;
+    }
+    // 1b04: movb $2d, (r3)+
+    {
+        src = uint8_t(0x2d);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1b08: br 1b0e
+    AOT_GOTO(0x1b0e, L1b0e);
+L1b0a:
+    AOT_BLOCK(0x1b0a, 1);
+    // 1b0a: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b0c, L1b0c);
+L1b0c:
+    AOT_BLOCK(0x1b0c, 1);
+    // 1b0c: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b0e, L1b0e);
+L1b0e:
+    AOT_BLOCK(0x1b0e, 1);
+    // 1b0e: mov $a, r2
+    {
+        src = uint16_t(0x000a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b12, L1b12);
+L1b12:
+    AOT_BLOCK(0x1b12, 7);
+    // 1b12: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b14: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b16: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1b18: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1b1c: mov r1, r5
+    {
+        src = r[1];
+        r[5] = src;
+    }
+    // 1b1e: ashc $0, r4
+    {
+        src = uint16_t(0x0000) & 077;
+        val = int32_t((uint32_t(r[4]) << 16) | r[5]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[4] = uint32_t(val2) >> 16;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[4] = uint32_t(val2) >> 16;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 1b22: beq 1b2c
+    if (Z)
+        AOT_GOTO(0x1b2c, L1b2c);
+    AOT_GOTO(0x1b24, L1b24);
+L1b24:
+    AOT_BLOCK(0x1b24, 2);
+    // 1b24: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1b26: beq 1b2c
+    if (Z)
+        AOT_GOTO(0x1b2c, L1b2c);
+    AOT_GOTO(0x1b28, L1b28);
+L1b28:
+    AOT_BLOCK(0x1b28, 1);
+    // 1b28: movb $30, (r3)+
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b2c, L1b2c);
+L1b2c:
+    AOT_BLOCK(0x1b2c, 1);
+    // 1b2c: jsr pc, 1b36
+    {
+        a = 0x1b36;
+        r[6] -= 2;
+        WR16(r[6], 0x1b30);
+    }
+    AOT_GOTO(0x1b36, L1b36);
+L1b30:
+    AOT_BLOCK(0x1b30, 3);
+    // 1b30: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1b32: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b34: br 1bdc
+    AOT_GOTO(0x1bdc, L1bdc);
+L1b36:
+    AOT_BLOCK(0x1b36, 3);
+    // 1b36: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 1b38: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b3a: beq 1b42
+    if (Z)
+        AOT_GOTO(0x1b42, L1b42);
+    AOT_GOTO(0x1b3c, L1b3c);
+L1b3c:
+    AOT_BLOCK(0x1b3c, 3);
+    // 1b3c: div r2, r0
+    {
+        src = int16_t(r[2]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1b3e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1b40: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b42, L1b42);
+L1b42:
+    AOT_BLOCK(0x1b42, 7);
+    // 1b42: mov r5, r1
+    {
+        src = r[5];
+        r[1] = src;
+    }
+    // 1b44: asl r2
+    {
+        src = r[2];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[2] = val;
+    }
+    // 1b46: div r2, r0
+    {
+        src = int16_t(r[2]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1b48: asr r2
+    {
+        src = r[2];
+        val = int16_t(src) >> 1;
+        r[2] = val;
+    }
+    // 1b4a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1b4c: cmp r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b4e: bgt 1b54
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1b54, L1b54);
+    AOT_GOTO(0x1b50, L1b50);
+L1b50:
+    AOT_BLOCK(0x1b50, 2);
+    // 1b50: sub r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        C = dst < src;
+    }
+    // 1b52: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1b54, L1b54);
+L1b54:
+    AOT_BLOCK(0x1b54, 3);
+    // 1b54: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b56: mov r0, r5
+    {
+        src = r[0];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b58: bne 1b5e
+    if (!Z)
+        AOT_GOTO(0x1b5e, L1b5e);
+    AOT_GOTO(0x1b5a, L1b5a);
+L1b5a:
+    AOT_BLOCK(0x1b5a, 2);
+    // 1b5a: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1b5c: beq 1b62
+    if (Z)
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1b5e, L1b5e);
+L1b5e:
+    AOT_BLOCK(0x1b5e, 1);
+    // 1b5e: jsr pc, 1b36
+    {
+        a = 0x1b36;
+        r[6] -= 2;
+        WR16(r[6], 0x1b62);
+    }
+    AOT_GOTO(0x1b36, L1b36);
+L1b62:
+    AOT_BLOCK(0x1b62, 4);
+    // 1b62: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1b64: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1b68: cmp r0, $39
+    {
+        src = r[0];
+        dst = uint16_t(0x0039);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b6c: ble 1b72
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1b72, L1b72);
+    AOT_GOTO(0x1b6e, L1b6e);
+L1b6e:
+    AOT_BLOCK(0x1b6e, 1);
+    // 1b6e: add $27, r0
+    {
+        src = uint16_t(0x0027);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1b72, L1b72);
+L1b72:
+    AOT_BLOCK(0x1b72, 2);
+    // 1b72: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1b74: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1b76:
+    AOT_BLOCK(0x1b76, 4);
+    // 1b76: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 1b7c: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1b7e: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1b82: beq 1bdc
+    if (Z)
+        AOT_GOTO(0x1bdc, L1bdc);
+    AOT_GOTO(0x1b84, L1b84);
+L1b84:
+    AOT_BLOCK(0x1b84, 2);
+    // 1b84: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1b86: br 1bdc
+    AOT_GOTO(0x1bdc, L1bdc);
+L1b88:
+    AOT_BLOCK(0x1b88, 5);
+    // 1b88: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 1b8e: mov -10(r5), r1
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1b92: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1b94: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b96: bne 1ba0
+    if (!Z)
+        AOT_GOTO(0x1ba0, L1ba0);
+    AOT_GOTO(0x1b98, L1b98);
+L1b98:
+    AOT_BLOCK(0x1b98, 3);
+    // 1b98: mov $4330, r2
+    {
+        src = uint16_t(0x4330);
+        r[2] = src;
+    }
+    // 1b9c: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+    }
+    // 1b9e: mov r2, (r4)
+    {
+        src = r[2];
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ba0, L1ba0);
+L1ba0:
+    AOT_BLOCK(0x1ba0, 2);
+    // 1ba0: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1ba2: beq 1ba8
+    if (Z)
+        AOT_GOTO(0x1ba8, L1ba8);
+    AOT_GOTO(0x1ba4, L1ba4);
+L1ba4:
+    AOT_BLOCK(0x1ba4, 2);
+    // 1ba4: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1ba6: sob r1, 4
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x1ba0, L1ba0);
+    AOT_GOTO(0x1ba8, L1ba8);
+L1ba8:
+    AOT_BLOCK(0x1ba8, 2);
+    // 1ba8: mov (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1baa: br 1bde
+    AOT_GOTO(0x1bde, L1bde);
+L1bac:
+    AOT_BLOCK(0x1bac, 3);
+    // 1bac: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1bb0: mov -e(r5), r2
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bb4: jsr pc, 1c40
+    {
+        a = 0x1c40;
+        r[6] -= 2;
+        WR16(r[6], 0x1bb8);
+    }
+    AOT_GOTO(0x1c40, L1c40);
+L1bb8:
+    AOT_BLOCK(0x1bb8, 1);
+    // 1bb8: br 1bdc
+    AOT_GOTO(0x1bdc, L1bdc);
+L1bba:
+    AOT_BLOCK(0x1bba, 4);
+    // 1bba: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1bbe: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 1bc0: tst -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1bc4: bne 1bca
+    if (!Z)
+        AOT_GOTO(0x1bca, L1bca);
+    AOT_GOTO(0x1bc6, L1bc6);
+L1bc6:
+    AOT_BLOCK(0x1bc6, 1);
+    // 1bc6: mov $7, r0
+    {
+        src = uint16_t(0x0007);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1bca, L1bca);
+L1bca:
+    AOT_BLOCK(0x1bca, 2);
+    // 1bca: mov pc, r2
+    {
+        src = uint16_t(0x1bcc);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bcc: jsr pc, 1c40
+    {
+        a = 0x1c40;
+        r[6] -= 2;
+        WR16(r[6], 0x1bd0);
+    }
+    AOT_GOTO(0x1c40, L1c40);
+L1bd0:
+    AOT_BLOCK(0x1bd0, 1);
+    // 1bd0: br 1bdc
+    AOT_GOTO(0x1bdc, L1bdc);
+L1bd2:
+    AOT_BLOCK(0x1bd2, 3);
+    // 1bd2: mov (r4)+, r4
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1bd4: mov (r4)+, -a(r5)
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bd8: jmp 1a06
+    {
+        a = 0x1a06;
+    }
+    AOT_GOTO(0x1a06, L1a06);
+L1bdc:
+    AOT_BLOCK(0x1bdc, 1);
+    // 1bdc: mov sp, r2
+    {
+        src = r[6];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1bde, L1bde);
+L1bde:
+    AOT_BLOCK(0x1bde, 4);
+    // 1bde: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 1be0: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1be4: sub r3, r1
+    {
+        src = r[3];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 1be6: bge 1bea
+    if (!(N ^ V))
+        AOT_GOTO(0x1bea, L1bea);
+    AOT_GOTO(0x1be8, L1be8);
+L1be8:
+    AOT_BLOCK(0x1be8, 1);
+    // 1be8: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1bea, L1bea);
+L1bea:
+    AOT_BLOCK(0x1bea, 2);
+    // 1bea: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1bee: bne 1bf2
+    if (!Z)
+        AOT_GOTO(0x1bf2, L1bf2);
+    AOT_GOTO(0x1bf0, L1bf0);
+L1bf0:
+    AOT_BLOCK(0x1bf0, 1);
+    // 1bf0: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1bf2, L1bf2);
+L1bf2:
+    AOT_BLOCK(0x1bf2, 6);
+    // 1bf2: mov -12(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bf6: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bfa: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bfc: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1bfe: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c00: jsr pc, 1c4a
+    {
+        a = 0x1c4a;
+        r[6] -= 2;
+        WR16(r[6], 0x1c04);
+    }
+    AOT_GOTO(0x1c4a, L1c4a);
+L1c04:
+    AOT_BLOCK(0x1c04, 2);
+    // 1c04: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1c08: jmp 1a06
+    {
+        a = 0x1a06;
+    }
+    AOT_GOTO(0x1a06, L1a06);
+L1c0c:
+    AOT_BLOCK(0x1c0c, 2);
+    // 1c0c: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+    }
+    // 1c10: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1c12, L1c12);
+L1c12:
+    AOT_BLOCK(0x1c12, 5);
+    // 1c12: movb *-a(r5), r0
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1c16: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1c1a: sub $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1c1e: cmp r0, $fffa
+    {
+        src = r[0];
+        dst = uint16_t(0xfffa);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c22: bne 1c28
+    if (!Z)
+        AOT_GOTO(0x1c28, L1c28);
+    AOT_GOTO(0x1c24, L1c24);
+L1c24:
+    AOT_BLOCK(0x1c24, 2);
+    // 1c24: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c26: br 1c2e
+    AOT_GOTO(0x1c2e, L1c2e);
+L1c28:
+    AOT_BLOCK(0x1c28, 2);
+    // 1c28: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c2c: bhi 1c3a
+    if (!(C | Z))
+        AOT_GOTO(0x1c3a, L1c3a);
+    AOT_GOTO(0x1c2e, L1c2e);
+L1c2e:
+    AOT_BLOCK(0x1c2e, 4);
+    // 1c2e: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1c32: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1c36: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1c38: br 1c12
+    AOT_GOTO(0x1c12, L1c12);
+L1c3a:
+    AOT_BLOCK(0x1c3a, 2);
+    // 1c3a: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1c3e: rts r3
+    {
+        b = r[3];
+        r[3] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1c40:
+    AOT_BLOCK(0x1c40, 3);
+    // 1c40: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1c44: movb $3f, (r3)+
+    {
+        src = uint8_t(0x3f);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1c48: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1c4a:
+    AOT_BLOCK(0x1c4a, 6);
+    // 1c4a: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1c4e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1c4e: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1c52: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1c56: mov a(r5), r2
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c5a: br 1c8e
+    AOT_GOTO(0x1c8e, L1c8e);
+L1c5c:
+    AOT_BLOCK(0x1c5c, 5);
+    // 1c5c: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c5e: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1c60: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c62: bic $ff00, (sp)
+    {
+        src = uint16_t(0xff00);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1c66: jsr pc, *$1d0a
+    {
+        a = 0x1d0a;
+        r[6] -= 2;
+        WR16(r[6], 0x1c6a);
+    }
+    AOT_GOTO(0x1d0a, L1d0a);
+L1c6a:
+    AOT_BLOCK(0x1c6a, 1);
+    // 1c6a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1c6c, L1c6c);
+L1c6c:
+    AOT_BLOCK(0x1c6c, 1);
+    // 1c6c: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x1c6e, L1c6e);
+L1c6e:
+    AOT_BLOCK(0x1c6e, 2);
+    // 1c6e: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1c72: blt 1c7e
+    if (N ^ V)
+        AOT_GOTO(0x1c7e, L1c7e);
+    AOT_GOTO(0x1c74, L1c74);
+L1c74:
+    AOT_BLOCK(0x1c74, 3);
+    // 1c74: movb c(r5), *0(r2)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD8(a);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 1c7a: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1c7c: br 1c8a
+    AOT_GOTO(0x1c8a, L1c8a);
+L1c7e:
+    AOT_BLOCK(0x1c7e, 3);
+    // 1c7e: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c80: mov c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c84: jsr pc, *$1d0a
+    {
+        a = 0x1d0a;
+        r[6] -= 2;
+        WR16(r[6], 0x1c88);
+    }
+    AOT_GOTO(0x1d0a, L1d0a);
+L1c88:
+    AOT_BLOCK(0x1c88, 1);
+    // 1c88: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1c8a, L1c8a);
+L1c8a:
+    AOT_BLOCK(0x1c8a, 1);
+    // 1c8a: inc 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1c8e, L1c8e);
+L1c8e:
+    AOT_BLOCK(0x1c8e, 2);
+    // 1c8e: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1c92: bge 1cda
+    if (!(N ^ V))
+        AOT_GOTO(0x1cda, L1cda);
+    AOT_GOTO(0x1c94, L1c94);
+L1c94:
+    AOT_BLOCK(0x1c94, 2);
+    // 1c94: cmpb $2d, (r4)
+    {
+        src = uint8_t(0x2d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1c98: bne 1c6e
+    if (!Z)
+        AOT_GOTO(0x1c6e, L1c6e);
+    AOT_GOTO(0x1c9a, L1c9a);
+L1c9a:
+    AOT_BLOCK(0x1c9a, 2);
+    // 1c9a: cmp $30, c(r5)
+    {
+        src = uint16_t(0x0030);
+        b = uint16_t(r[5] + 12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ca0: bne 1c6e
+    if (!Z)
+        AOT_GOTO(0x1c6e, L1c6e);
+    AOT_GOTO(0x1ca2, L1ca2);
+L1ca2:
+    AOT_BLOCK(0x1ca2, 2);
+    // 1ca2: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1ca6: blt 1c5c
+    if (N ^ V)
+        AOT_GOTO(0x1c5c, L1c5c);
+    AOT_GOTO(0x1ca8, L1ca8);
+L1ca8:
+    AOT_BLOCK(0x1ca8, 5);
+    // 1ca8: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1caa: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1cae: movb r0, *0(r2)
+    {
+        src = uint8_t(r[0]);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 1cb2: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1cb4: br 1c6c
+    AOT_GOTO(0x1c6c, L1c6c);
+L1cb6:
+    AOT_BLOCK(0x1cb6, 5);
+    // 1cb6: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1cb8: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1cbc: movb r0, *0(r2)
+    {
+        src = uint8_t(r[0]);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 1cc0: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1cc2: br 1cda
+    AOT_GOTO(0x1cda, L1cda);
+L1cc4:
+    AOT_BLOCK(0x1cc4, 2);
+    // 1cc4: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1cc8: bge 1cb6
+    if (!(N ^ V))
+        AOT_GOTO(0x1cb6, L1cb6);
+    AOT_GOTO(0x1cca, L1cca);
+L1cca:
+    AOT_BLOCK(0x1cca, 5);
+    // 1cca: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ccc: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1cce: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1cd0: bic $ff00, (sp)
+    {
+        src = uint16_t(0xff00);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1cd4: jsr pc, *$1d0a
+    {
+        a = 0x1d0a;
+        r[6] -= 2;
+        WR16(r[6], 0x1cd8);
+    }
+    AOT_GOTO(0x1d0a, L1d0a);
+L1cd8:
+    AOT_BLOCK(0x1cd8, 1);
+    // 1cd8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1cda, L1cda);
+L1cda:
+    AOT_BLOCK(0x1cda, 2);
+    // 1cda: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1cdc: bge 1cc4
+    if (!(N ^ V))
+        AOT_GOTO(0x1cc4, L1cc4);
+    AOT_GOTO(0x1cde, L1cde);
+L1cde:
+    AOT_BLOCK(0x1cde, 1);
+    // 1cde: br 1d00
+    AOT_GOTO(0x1d00, L1d00);
+L1ce0:
+    AOT_BLOCK(0x1ce0, 2);
+    // 1ce0: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1ce4: blt 1cf0
+    if (N ^ V)
+        AOT_GOTO(0x1cf0, L1cf0);
+    AOT_GOTO(0x1ce6, L1ce6);
+L1ce6:
+    AOT_BLOCK(0x1ce6, 3);
+    // 1ce6: movb c(r5), *0(r2)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD8(a);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 1cec: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1cee: br 1cfc
+    AOT_GOTO(0x1cfc, L1cfc);
+L1cf0:
+    AOT_BLOCK(0x1cf0, 3);
+    // 1cf0: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1cf2: mov c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cf6: jsr pc, *$1d0a
+    {
+        a = 0x1d0a;
+        r[6] -= 2;
+        WR16(r[6], 0x1cfa);
+    }
+    AOT_GOTO(0x1d0a, L1d0a);
+L1cfa:
+    AOT_BLOCK(0x1cfa, 1);
+    // 1cfa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1cfc, L1cfc);
+L1cfc:
+    AOT_BLOCK(0x1cfc, 1);
+    // 1cfc: dec 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x1d00, L1d00);
+L1d00:
+    AOT_BLOCK(0x1d00, 2);
+    // 1d00: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1d04: bne 1ce0
+    if (!Z)
+        AOT_GOTO(0x1ce0, L1ce0);
+    AOT_GOTO(0x1d06, L1d06);
+L1d06:
+    AOT_BLOCK(0x1d06, 2);
+    // 1d06: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1d0a:
+    AOT_BLOCK(0x1d0a, 6);
+    // 1d0a: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1d0e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1d0e: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1d12: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 1d16: bitb $80, 6(r4)
+    {
+        src = uint8_t(0x80);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1d1c: beq 1d2a
+    if (Z)
+        AOT_GOTO(0x1d2a, L1d2a);
+    AOT_GOTO(0x1d1e, L1d1e);
+L1d1e:
+    AOT_BLOCK(0x1d1e, 2);
+    // 1d1e: bisb $2, 6(r4)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 1d24: bicb $10, 6(r4)
+    {
+        src = uint8_t(0x10);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d2a, L1d2a);
+L1d2a:
+    AOT_BLOCK(0x1d2a, 2);
+    // 1d2a: bitb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1d30: beq 1d5c
+    if (Z)
+        AOT_GOTO(0x1d5c, L1d5c);
+    AOT_GOTO(0x1d32, L1d32);
+L1d32:
+    AOT_BLOCK(0x1d32, 8);
+    // 1d32: movb 4(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = uint16_t(r[5] + -10);
+        WR8(b, src);
+    }
+    // 1d38: mov $1, -8(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1d3e: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1d42: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1d44: add $fff6, (sp)
+    {
+        src = uint16_t(0xfff6);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1d48: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1d4c: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d4e: jsr pc, *$24b4
+    {
+        a = 0x24b4;
+        r[6] -= 2;
+        WR16(r[6], 0x1d52);
+    }
+    AOT_GOTO(0x24b4, L24b4);
+L1d52:
+    AOT_BLOCK(0x1d52, 4);
+    // 1d52: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 1d54: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 1d56: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1d5a: br 1dd2
+    AOT_GOTO(0x1dd2, L1dd2);
+L1d5c:
+    AOT_BLOCK(0x1d5c, 2);
+    // 1d5c: mov 4(r4), r3
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d60: bne 1da8
+    if (!Z)
+        AOT_GOTO(0x1da8, L1da8);
+    AOT_GOTO(0x1d62, L1d62);
+L1d62:
+    AOT_BLOCK(0x1d62, 2);
+    // 1d62: cmp $4340, r4
+    {
+        src = uint16_t(0x4340);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d66: bne 1d8a
+    if (!Z)
+        AOT_GOTO(0x1d8a, L1d8a);
+    AOT_GOTO(0x1d68, L1d68);
+L1d68:
+    AOT_BLOCK(0x1d68, 3);
+    // 1d68: movb 4347, r0
+    {
+        a = 0x4347;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1d6c: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d6e: jsr pc, *$212e
+    {
+        a = 0x212e;
+        r[6] -= 2;
+        WR16(r[6], 0x1d72);
+    }
+    AOT_GOTO(0x212e, L212e);
+L1d72:
+    AOT_BLOCK(0x1d72, 2);
+    // 1d72: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1d74: beq 1d7e
+    if (Z)
+        AOT_GOTO(0x1d7e, L1d7e);
+    AOT_GOTO(0x1d76, L1d76);
+L1d76:
+    AOT_BLOCK(0x1d76, 2);
+    // 1d76: bisb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1d7c: br 1d2a
+    AOT_GOTO(0x1d2a, L1d2a);
+L1d7e:
+    AOT_BLOCK(0x1d7e, 3);
+    // 1d7e: mov $cdb0, 4(r4)
+    {
+        src = uint16_t(0xcdb0);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 1d84: mov $cdb0, (r4)
+    {
+        src = uint16_t(0xcdb0);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d88: br 1d2a
+    AOT_GOTO(0x1d2a, L1d2a);
+L1d8a:
+    AOT_BLOCK(0x1d8a, 2);
+    // 1d8a: mov $200, (sp)
+    {
+        src = uint16_t(0x0200);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d8e: jsr pc, *$1f2c
+    {
+        a = 0x1f2c;
+        r[6] -= 2;
+        WR16(r[6], 0x1d92);
+    }
+    AOT_GOTO(0x1f2c, L1f2c);
+L1d92:
+    AOT_BLOCK(0x1d92, 3);
+    // 1d92: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1d94: mov r3, 4(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d98: beq 1d76
+    if (Z)
+        AOT_GOTO(0x1d76, L1d76);
+    AOT_GOTO(0x1d9a, L1d9a);
+L1d9a:
+    AOT_BLOCK(0x1d9a, 4);
+    // 1d9a: bisb $8, 6(r4)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 1da0: clr r2
+    {
+        r[2] = 0;
+        C = false;
+    }
+    // 1da2: mov r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1da6: br 1dc6
+    AOT_GOTO(0x1dc6, L1dc6);
+L1da8:
+    AOT_BLOCK(0x1da8, 4);
+    // 1da8: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1daa: sub r3, r2
+    {
+        src = r[3];
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+        C = dst < src;
+    }
+    // 1dac: mov r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1db0: ble 1dc6
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1dc6, L1dc6);
+    AOT_GOTO(0x1db2, L1db2);
+L1db2:
+    AOT_BLOCK(0x1db2, 6);
+    // 1db2: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 1db4: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1db6: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1db8: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1dbc: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dbe: jsr pc, *$24b4
+    {
+        a = 0x24b4;
+        r[6] -= 2;
+        WR16(r[6], 0x1dc2);
+    }
+    AOT_GOTO(0x24b4, L24b4);
+L1dc2:
+    AOT_BLOCK(0x1dc2, 2);
+    // 1dc2: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1dc4: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1dc6, L1dc6);
+L1dc6:
+    AOT_BLOCK(0x1dc6, 3);
+    // 1dc6: mov $1ff, 2(r4)
+    {
+        src = uint16_t(0x01ff);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 1dcc: movb 4(r5), (r3)+
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 1dd0: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1dd2, L1dd2);
+L1dd2:
+    AOT_BLOCK(0x1dd2, 2);
+    // 1dd2: cmp r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1dd6: beq 1de6
+    if (Z)
+        AOT_GOTO(0x1de6, L1de6);
+    AOT_GOTO(0x1dd8, L1dd8);
+L1dd8:
+    AOT_BLOCK(0x1dd8, 2);
+    // 1dd8: bisb $20, 6(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 1dde: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1de2, L1de2);
+L1de2:
+    AOT_BLOCK(0x1de2, 2);
+    // 1de2: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1de6:
+    AOT_BLOCK(0x1de6, 2);
+    // 1de6: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dea: br 1de2
+    AOT_GOTO(0x1de2, L1de2);
+L1dec:
+    AOT_BLOCK(0x1dec, 7);
+    // 1dec: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1df0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1df0: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1df4: movb 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1df8: bic $fff9, r0
+    {
+        src = uint16_t(0xfff9);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1dfc: cmp $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e00: bne 1e3a
+    if (!Z)
+        AOT_GOTO(0x1e3a, L1e3a);
+    AOT_GOTO(0x1e02, L1e02);
+L1e02:
+    AOT_BLOCK(0x1e02, 2);
+    // 1e02: mov 4(r4), r3
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e06: beq 1e3a
+    if (Z)
+        AOT_GOTO(0x1e3a, L1e3a);
+    AOT_GOTO(0x1e08, L1e08);
+L1e08:
+    AOT_BLOCK(0x1e08, 4);
+    // 1e08: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1e0a: sub r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 1e0c: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e0e: ble 1e3a
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1e3a, L1e3a);
+    AOT_GOTO(0x1e10, L1e10);
+L1e10:
+    AOT_BLOCK(0x1e10, 7);
+    // 1e10: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 1e12: mov $200, 2(r4)
+    {
+        src = uint16_t(0x0200);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 1e18: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e1a: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e1c: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1e20: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e22: jsr pc, *$24b4
+    {
+        a = 0x24b4;
+        r[6] -= 2;
+        WR16(r[6], 0x1e26);
+    }
+    AOT_GOTO(0x24b4, L24b4);
+L1e26:
+    AOT_BLOCK(0x1e26, 3);
+    // 1e26: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 1e28: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e2a: beq 1e3a
+    if (Z)
+        AOT_GOTO(0x1e3a, L1e3a);
+    AOT_GOTO(0x1e2c, L1e2c);
+L1e2c:
+    AOT_BLOCK(0x1e2c, 2);
+    // 1e2c: bisb $20, 6(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 1e32: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1e36, L1e36);
+L1e36:
+    AOT_BLOCK(0x1e36, 2);
+    // 1e36: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1e3a:
+    AOT_BLOCK(0x1e3a, 2);
+    // 1e3a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1e3c: br 1e36
+    AOT_GOTO(0x1e36, L1e36);
+L1e3e:
+    AOT_BLOCK(0x1e3e, 4);
+    // 1e3e: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1e42;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1e42: mov $4338, r4
+    {
+        src = uint16_t(0x4338);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e46: br 1e52
+    AOT_GOTO(0x1e52, L1e52);
+L1e48:
+    AOT_BLOCK(0x1e48, 2);
+    // 1e48: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e4a: jsr pc, *$1e5c
+    {
+        a = 0x1e5c;
+        r[6] -= 2;
+        WR16(r[6], 0x1e4e);
+    }
+    AOT_GOTO(0x1e5c, L1e5c);
+L1e4e:
+    AOT_BLOCK(0x1e4e, 1);
+    // 1e4e: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1e52, L1e52);
+L1e52:
+    AOT_BLOCK(0x1e52, 2);
+    // 1e52: cmp 43d8, r4
+    {
+        a = 0x43d8;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e56: bhi 1e48
+    if (!(C | Z))
+        AOT_GOTO(0x1e48, L1e48);
+    AOT_GOTO(0x1e58, L1e58);
+L1e58:
+    AOT_BLOCK(0x1e58, 2);
+    // 1e58: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1e5c:
+    AOT_BLOCK(0x1e5c, 6);
+    // 1e5c: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1e60;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1e60: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1e64: mov $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        r[3] = src;
+    }
+    // 1e68: bitb $83, 6(r4)
+    {
+        src = uint8_t(0x83);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1e6e: beq 1eae
+    if (Z)
+        AOT_GOTO(0x1eae, L1eae);
+    AOT_GOTO(0x1e70, L1e70);
+L1e70:
+    AOT_BLOCK(0x1e70, 2);
+    // 1e70: bitb $40, 6(r4)
+    {
+        src = uint8_t(0x40);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1e76: bne 1eae
+    if (!Z)
+        AOT_GOTO(0x1eae, L1eae);
+    AOT_GOTO(0x1e78, L1e78);
+L1e78:
+    AOT_BLOCK(0x1e78, 2);
+    // 1e78: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e7a: jsr pc, *$1dec
+    {
+        a = 0x1dec;
+        r[6] -= 2;
+        WR16(r[6], 0x1e7e);
+    }
+    AOT_GOTO(0x1dec, L1dec);
+L1e7e:
+    AOT_BLOCK(0x1e7e, 4);
+    // 1e7e: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1e80: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1e84: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e86: jsr pc, *$2264
+    {
+        a = 0x2264;
+        r[6] -= 2;
+        WR16(r[6], 0x1e8a);
+    }
+    AOT_GOTO(0x2264, L2264);
+L1e8a:
+    AOT_BLOCK(0x1e8a, 2);
+    // 1e8a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1e8c: bge 1e92
+    if (!(N ^ V))
+        AOT_GOTO(0x1e92, L1e92);
+    AOT_GOTO(0x1e8e, L1e8e);
+L1e8e:
+    AOT_BLOCK(0x1e8e, 1);
+    // 1e8e: mov $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1e92, L1e92);
+L1e92:
+    AOT_BLOCK(0x1e92, 2);
+    // 1e92: bitb $8, 6(r4)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1e98: beq 1ea2
+    if (Z)
+        AOT_GOTO(0x1ea2, L1ea2);
+    AOT_GOTO(0x1e9a, L1e9a);
+L1e9a:
+    AOT_BLOCK(0x1e9a, 2);
+    // 1e9a: mov 4(r4), (sp)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e9e: jsr pc, *$2066
+    {
+        a = 0x2066;
+        r[6] -= 2;
+        WR16(r[6], 0x1ea2);
+    }
+    AOT_GOTO(0x2066, L2066);
+L1ea2:
+    AOT_BLOCK(0x1ea2, 2);
+    // 1ea2: bitb $c, 6(r4)
+    {
+        src = uint8_t(0x0c);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1ea8: beq 1eae
+    if (Z)
+        AOT_GOTO(0x1eae, L1eae);
+    AOT_GOTO(0x1eaa, L1eaa);
+L1eaa:
+    AOT_BLOCK(0x1eaa, 1);
+    // 1eaa: clr 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1eae, L1eae);
+L1eae:
+    AOT_BLOCK(0x1eae, 5);
+    // 1eae: bicb $ff, 6(r4)
+    {
+        src = uint8_t(0xff);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+    }
+    // 1eb4: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        C = false;
+    }
+    // 1eb8: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 1eba: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1ebe:
+    AOT_BLOCK(0x1ebe, 3);
+    // 1ebe: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ec0: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ec2: jsr pc, 1e3e
+    {
+        a = 0x1e3e;
+        r[6] -= 2;
+        WR16(r[6], 0x1ec6);
+    }
+    AOT_GOTO(0x1e3e, L1e3e);
+L1ec6:
+    AOT_BLOCK(0x1ec6, 1);
+    // 1ec6: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1eca: sys 1
+    AOT_INTERP(0x1eca);
+L1ecc:
+    AOT_BLOCK(0x1ecc, 2);
+    // 1ecc: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1ed0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    AOT_GOTO(0x1ed0, L1ed0);
+L1ece:
+    AOT_BLOCK(0x1ece, 1);
+    // 1ece: bgt 1e5c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1e5c, L1e5c);
+    AOT_GOTO(0x1ed0, L1ed0);
+L1ed0:
+    AOT_BLOCK(0x1ed0, 1);
+    // 1ed0: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ed4, L1ed4);
+L1ed2:
+    // 1ed2: iot
+    AOT_INTERP(0x1ed2);
+L1ed4:
+    AOT_BLOCK(0x1ed4, 3);
+    // 1ed4: clr r3
+    {
+        r[3] = 0;
+    }
+    // 1ed6: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1ed8: br 1efc
+    AOT_GOTO(0x1efc, L1efc);
+L1eda:
+    AOT_BLOCK(0x1eda, 2);
+    // 1eda: cmpb $39, (r4)
+    {
+        src = uint8_t(0x39);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1ede: blt 1f1c
+    if (N ^ V)
+        AOT_GOTO(0x1f1c, L1f1c);
+    AOT_GOTO(0x1ee0, L1ee0);
+L1ee0:
+    AOT_BLOCK(0x1ee0, 8);
+    // 1ee0: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 1ee2: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1ee6: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 1ee8: movb (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 1eea: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1eec: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1eee: add $ffd0, r3
+    {
+        src = uint16_t(0xffd0);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1ef2: br 1f16
+    AOT_GOTO(0x1f16, L1f16);
+L1ef4:
+    AOT_BLOCK(0x1ef4, 1);
+    // 1ef4: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1ef6, L1ef6);
+L1ef6:
+    AOT_BLOCK(0x1ef6, 2);
+    // 1ef6: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1ef8: br 1f16
+    AOT_GOTO(0x1f16, L1f16);
+L1efa:
+    AOT_BLOCK(0x1efa, 1);
+    // 1efa: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1efc, L1efc);
+L1efc:
+    AOT_BLOCK(0x1efc, 3);
+    // 1efc: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1efe: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f02: beq 1efa
+    if (Z)
+        AOT_GOTO(0x1efa, L1efa);
+    AOT_GOTO(0x1f04, L1f04);
+L1f04:
+    AOT_BLOCK(0x1f04, 2);
+    // 1f04: cmp r0, $20
+    {
+        src = r[0];
+        dst = uint16_t(0x0020);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f08: beq 1efa
+    if (Z)
+        AOT_GOTO(0x1efa, L1efa);
+    AOT_GOTO(0x1f0a, L1f0a);
+L1f0a:
+    AOT_BLOCK(0x1f0a, 2);
+    // 1f0a: cmp r0, $2b
+    {
+        src = r[0];
+        dst = uint16_t(0x002b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f0e: beq 1ef6
+    if (Z)
+        AOT_GOTO(0x1ef6, L1ef6);
+    AOT_GOTO(0x1f10, L1f10);
+L1f10:
+    AOT_BLOCK(0x1f10, 2);
+    // 1f10: cmp r0, $2d
+    {
+        src = r[0];
+        dst = uint16_t(0x002d);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f14: beq 1ef4
+    if (Z)
+        AOT_GOTO(0x1ef4, L1ef4);
+    AOT_GOTO(0x1f16, L1f16);
+L1f16:
+    AOT_BLOCK(0x1f16, 2);
+    // 1f16: cmpb $30, (r4)
+    {
+        src = uint8_t(0x30);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1f1a: ble 1eda
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1eda, L1eda);
+    AOT_GOTO(0x1f1c, L1f1c);
+L1f1c:
+    AOT_BLOCK(0x1f1c, 2);
+    // 1f1c: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1f1e: beq 1f28
+    if (Z)
+        AOT_GOTO(0x1f28, L1f28);
+    AOT_GOTO(0x1f20, L1f20);
+L1f20:
+    AOT_BLOCK(0x1f20, 2);
+    // 1f20: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 1f22: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1f24, L1f24);
+L1f24:
+    AOT_BLOCK(0x1f24, 2);
+    // 1f24: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1f28:
+    AOT_BLOCK(0x1f28, 2);
+    // 1f28: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f2a: br 1f24
+    AOT_GOTO(0x1f24, L1f24);
+L1f2c:
+    AOT_BLOCK(0x1f2c, 4);
+    // 1f2c: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1f30;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 1f30: tst d1b4
+    {
+        a = 0xd1b4;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1f34: bne 1f5a
+    if (!Z)
+        AOT_GOTO(0x1f5a, L1f5a);
+    AOT_GOTO(0x1f36, L1f36);
+L1f36:
+    AOT_BLOCK(0x1f36, 8);
+    // 1f36: mov $d1b6, r0
+    {
+        src = uint16_t(0xd1b6);
+        r[0] = src;
+    }
+    // 1f3a: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 1f3e: mov r0, d1b4
+    {
+        src = r[0];
+        b = 0xd1b4;
+        WR16(b, src);
+    }
+    // 1f42: mov $d1b4, r0
+    {
+        src = uint16_t(0xd1b4);
+        r[0] = src;
+    }
+    // 1f46: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 1f4a: mov r0, d1b6
+    {
+        src = r[0];
+        b = 0xd1b6;
+        WR16(b, src);
+    }
+    // 1f4e: mov $d1b6, d1ba
+    {
+        src = uint16_t(0xd1b6);
+        b = 0xd1ba;
+        WR16(b, src);
+    }
+    // 1f54: mov $d1b4, d1b8
+    {
+        src = uint16_t(0xd1b4);
+        b = 0xd1b8;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1f5a, L1f5a);
+L1f5a:
+    AOT_BLOCK(0x1f5a, 6);
+    // 1f5a: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1f5e: add $3, r1
+    {
+        src = uint16_t(0x0003);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 1f62: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 1f64: ashc $ffff, r0
+    {
+        src = uint16_t(0xffff) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 1f68: mov r1, r2
+    {
+        src = r[1];
+        r[2] = src;
+    }
+    // 1f6a: mov d1b8, r4
+    {
+        a = 0xd1b8;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1f6e, L1f6e);
+L1f6e:
+    AOT_BLOCK(0x1f6e, 1);
+    // 1f6e: clr d1be
+    {
+        a = 0xd1be;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1f72, L1f72);
+L1f72:
+    AOT_BLOCK(0x1f72, 2);
+    // 1f72: bit $1, (r4)
+    {
+        src = uint16_t(0x0001);
+        b = r[4];
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1f76: beq 1f7c
+    if (Z)
+        AOT_GOTO(0x1f7c, L1f7c);
+    AOT_GOTO(0x1f78, L1f78);
+L1f78:
+    AOT_BLOCK(0x1f78, 1);
+    // 1f78: br 1f98
+    AOT_GOTO(0x1f98, L1f98);
+L1f7a:
+    AOT_BLOCK(0x1f7a, 1);
+    // 1f7a: mov (r3), (r4)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1f7c, L1f7c);
+L1f7c:
+    AOT_BLOCK(0x1f7c, 3);
+    // 1f7c: mov (r4), r3
+    {
+        a = r[4];
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1f7e: bit $1, (r3)
+    {
+        src = uint16_t(0x0001);
+        b = r[3];
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1f82: beq 1f7a
+    if (Z)
+        AOT_GOTO(0x1f7a, L1f7a);
+    AOT_GOTO(0x1f84, L1f84);
+L1f84:
+    AOT_BLOCK(0x1f84, 5);
+    // 1f84: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 1f86: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1f88: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1f8a: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f8c: bcs 1f98
+    if (C)
+        AOT_GOTO(0x1f98, L1f98);
+    AOT_GOTO(0x1f8e, L1f8e);
+L1f8e:
+    AOT_BLOCK(0x1f8e, 5);
+    // 1f8e: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 1f90: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1f92: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1f94: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f96: blos 203c
+    if (C | Z)
+        AOT_GOTO(0x203c, L203c);
+    AOT_GOTO(0x1f98, L1f98);
+L1f98:
+    AOT_BLOCK(0x1f98, 5);
+    // 1f98: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 1f9a: mov (r4), r4
+    {
+        a = r[4];
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1f9c: bic $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 1fa0: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1fa2: bcs 1f72
+    if (C)
+        AOT_GOTO(0x1f72, L1f72);
+    AOT_GOTO(0x1fa4, L1fa4);
+L1fa4:
+    AOT_BLOCK(0x1fa4, 2);
+    // 1fa4: cmp d1ba, r3
+    {
+        a = 0xd1ba;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1fa8: bne 1fb0
+    if (!Z)
+        AOT_GOTO(0x1fb0, L1fb0);
+    AOT_GOTO(0x1faa, L1faa);
+L1faa:
+    AOT_BLOCK(0x1faa, 2);
+    // 1faa: cmp $d1b4, r4
+    {
+        src = uint16_t(0xd1b4);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1fae: beq 1fb6
+    if (Z)
+        AOT_GOTO(0x1fb6, L1fb6);
+    AOT_GOTO(0x1fb0, L1fb0);
+L1fb0:
+    AOT_BLOCK(0x1fb0, 1);
+    // 1fb0: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1fb2, L1fb2);
+L1fb2:
+    AOT_BLOCK(0x1fb2, 2);
+    // 1fb2: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1fb6:
+    AOT_BLOCK(0x1fb6, 3);
+    // 1fb6: inc d1be
+    {
+        a = 0xd1be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1fba: cmp $1, d1be
+    {
+        src = uint16_t(0x0001);
+        b = 0xd1be;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1fc0: bge 1f72
+    if (!(N ^ V))
+        AOT_GOTO(0x1f72, L1f72);
+    AOT_GOTO(0x1fc2, L1fc2);
+L1fc2:
+    AOT_BLOCK(0x1fc2, 8);
+    // 1fc2: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 1fc4: add $200, r1
+    {
+        src = uint16_t(0x0200);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        N = val16 < 0;
+    }
+    // 1fc8: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 1fca: div $200, r0
+    {
+        src = int16_t(uint16_t(0x0200));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1fce: ash $9, r0
+    {
+        src = uint16_t(0x0009) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1fd2: mov r0, d1be
+    {
+        src = r[0];
+        b = 0xd1be;
+        WR16(b, src);
+    }
+    // 1fd6: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1fd8: jsr pc, *$2372
+    {
+        a = 0x2372;
+        r[6] -= 2;
+        WR16(r[6], 0x1fdc);
+    }
+    AOT_GOTO(0x2372, L2372);
+L1fdc:
+    AOT_BLOCK(0x1fdc, 7);
+    // 1fdc: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1fde: mov d1be, r0
+    {
+        a = 0xd1be;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1fe2: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1fe4: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1fe6: add $80, r0
+    {
+        src = uint16_t(0x0080);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1fea: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1fec: bhi 1fb0
+    if (!(C | Z))
+        AOT_GOTO(0x1fb0, L1fb0);
+    AOT_GOTO(0x1fee, L1fee);
+L1fee:
+    AOT_BLOCK(0x1fee, 4);
+    // 1fee: mov d1be, r0
+    {
+        a = 0xd1be;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1ff2: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1ff4: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ff6: jsr pc, *$2372
+    {
+        a = 0x2372;
+        r[6] -= 2;
+        WR16(r[6], 0x1ffa);
+    }
+    AOT_GOTO(0x2372, L2372);
+L1ffa:
+    AOT_BLOCK(0x1ffa, 3);
+    // 1ffa: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1ffc: cmp $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2000: beq 1fb0
+    if (Z)
+        AOT_GOTO(0x1fb0, L1fb0);
+    AOT_GOTO(0x2002, L2002);
+L2002:
+    AOT_BLOCK(0x2002, 5);
+    // 2002: mov r3, *d1ba
+    {
+        src = r[3];
+        b = RD16(0xd1ba);
+        WR16(b, src);
+    }
+    // 2006: mov d1ba, r0
+    {
+        a = 0xd1ba;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 200a: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 200e: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2010: beq 201c
+    if (Z)
+        AOT_GOTO(0x201c, L201c);
+    AOT_GOTO(0x2012, L2012);
+L2012:
+    AOT_BLOCK(0x2012, 3);
+    // 2012: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 2014: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 2018: mov r0, *d1ba
+    {
+        src = r[0];
+        b = RD16(0xd1ba);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x201c, L201c);
+L201c:
+    AOT_BLOCK(0x201c, 9);
+    // 201c: mov d1be, r0
+    {
+        a = 0xd1be;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2020: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2022: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2024: add $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 2028: mov r0, (r3)
+    {
+        src = r[0];
+        b = r[3];
+        WR16(b, src);
+    }
+    // 202a: mov r0, d1ba
+    {
+        src = r[0];
+        b = 0xd1ba;
+        WR16(b, src);
+    }
+    // 202e: mov $d1b4, r0
+    {
+        src = uint16_t(0xd1b4);
+        r[0] = src;
+    }
+    // 2032: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 2036: mov r0, *d1ba
+    {
+        src = r[0];
+        b = RD16(0xd1ba);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x203a, L203a);
+L203a:
+    AOT_BLOCK(0x203a, 1);
+    // 203a: br 1f6e
+    AOT_GOTO(0x1f6e, L1f6e);
+L203c:
+    AOT_BLOCK(0x203c, 6);
+    // 203c: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 203e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2040: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2042: mov r0, d1b8
+    {
+        src = r[0];
+        b = 0xd1b8;
+        WR16(b, src);
+    }
+    // 2046: cmp r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2048: bcc 2054
+    if (!C)
+        AOT_GOTO(0x2054, L2054);
+    AOT_GOTO(0x204a, L204a);
+L204a:
+    AOT_BLOCK(0x204a, 2);
+    // 204a: mov *d1b8, d1bc
+    {
+        a = RD16(0xd1b8);
+        src = RD16(a);
+        b = 0xd1bc;
+        WR16(b, src);
+    }
+    // 2050: mov (r4), *d1b8
+    {
+        a = r[4];
+        src = RD16(a);
+        b = RD16(0xd1b8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2054, L2054);
+L2054:
+    AOT_BLOCK(0x2054, 5);
+    // 2054: mov d1b8, r0
+    {
+        a = 0xd1b8;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2058: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 205c: mov r0, (r4)
+    {
+        src = r[0];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 205e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2060: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2064, L2064);
+L2064:
+    AOT_BLOCK(0x2064, 1);
+    // 2064: br 1fb2
+    AOT_GOTO(0x1fb2, L1fb2);
+L2066:
+    AOT_BLOCK(0x2066, 3);
+    // 2066: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x206a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 206a: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x206e, L206e);
+L206e:
+    AOT_BLOCK(0x206e, 2);
+    // 206e: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 2070: sub $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2074, L2074);
+L2074:
+    AOT_BLOCK(0x2074, 6);
+    // 2074: mov r3, d1b8
+    {
+        src = r[3];
+        b = 0xd1b8;
+        WR16(b, src);
+    }
+    // 2078: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 207a: bic $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 207e: mov r0, (r3)
+    {
+        src = r[0];
+        b = r[3];
+        WR16(b, src);
+    }
+    // 2080: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L212e:
+    AOT_BLOCK(0x212e, 7);
+    // 212e: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2132;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 2132: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 2136: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2138: add $fff4, (sp)
+    {
+        src = uint16_t(0xfff4);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 213c: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2140: jsr pc, *$21d8
+    {
+        a = 0x21d8;
+        r[6] -= 2;
+        WR16(r[6], 0x2144);
+    }
+    AOT_GOTO(0x21d8, L21d8);
+L2144:
+    AOT_BLOCK(0x2144, 3);
+    // 2144: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 2146: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2148: bge 2150
+    if (!(N ^ V))
+        AOT_GOTO(0x2150, L2150);
+    AOT_GOTO(0x214a, L214a);
+L214a:
+    AOT_BLOCK(0x214a, 1);
+    // 214a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x214c, L214c);
+L214c:
+    AOT_BLOCK(0x214c, 2);
+    // 214c: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2150:
+    AOT_BLOCK(0x2150, 2);
+    // 2150: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2154: br 214c
+    AOT_GOTO(0x214c, L214c);
+L2156:
+    AOT_BLOCK(0x2156, 3);
+    // 2156: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x215a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 215a: jsr pc, 22b6
+    {
+        a = 0x22b6;
+        r[6] -= 2;
+        WR16(r[6], 0x215e);
+    }
+    AOT_GOTO(0x22b6, L22b6);
+L215e:
+    AOT_BLOCK(0x215e, 2);
+    // 215e: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2160: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2164, L2164);
+L2164:
+    AOT_BLOCK(0x2164, 2);
+    // 2164: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2166: bne 2164
+    if (!Z)
+        AOT_GOTO(0x2164, L2164);
+    AOT_GOTO(0x2168, L2168);
+L2168:
+    AOT_BLOCK(0x2168, 2);
+    // 2168: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 216a: br 2186
+    AOT_GOTO(0x2186, L2186);
+L216c:
+    AOT_BLOCK(0x216c, 10);
+    // 216c: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 216e: clr r0
+    {
+        r[0] = 0;
+    }
+    // 2170: div $a, r0
+    {
+        src = int16_t(uint16_t(0x000a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2174: add $30, r1
+    {
+        src = uint16_t(0x0030);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 2178: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 217a: movb r0, (r4)
+    {
+        src = uint8_t(r[0]);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 217c: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 217e: clr r0
+    {
+        r[0] = 0;
+    }
+    // 2180: div $a, r0
+    {
+        src = int16_t(uint16_t(0x000a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2184: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2186, L2186);
+L2186:
+    AOT_BLOCK(0x2186, 2);
+    // 2186: cmpb $58, -(r4)
+    {
+        src = uint8_t(0x58);
+        r[4] -= 1;
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 218a: beq 216c
+    if (Z)
+        AOT_GOTO(0x216c, L216c);
+    AOT_GOTO(0x218c, L218c);
+L218c:
+    AOT_BLOCK(0x218c, 3);
+    // 218c: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 218e: mov $61, r2
+    {
+        src = uint16_t(0x0061);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2192: br 21a6
+    AOT_GOTO(0x21a6, L21a6);
+L2194:
+    AOT_BLOCK(0x2194, 2);
+    // 2194: cmp $7a, r2
+    {
+        src = uint16_t(0x007a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2198: bne 21a2
+    if (!Z)
+        AOT_GOTO(0x21a2, L21a2);
+    AOT_GOTO(0x219a, L219a);
+L219a:
+    AOT_BLOCK(0x219a, 1);
+    // 219a: mov $43da, r0
+    {
+        src = uint16_t(0x43da);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x219e, L219e);
+L219e:
+    AOT_BLOCK(0x219e, 2);
+    // 219e: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L21a2:
+    AOT_BLOCK(0x21a2, 2);
+    // 21a2: movb r2, (r4)
+    {
+        src = uint8_t(r[2]);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 21a4: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x21a6, L21a6);
+L21a6:
+    AOT_BLOCK(0x21a6, 3);
+    // 21a6: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 21a8: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21ac: jsr pc, *$2220
+    {
+        a = 0x2220;
+        r[6] -= 2;
+        WR16(r[6], 0x21b0);
+    }
+    AOT_GOTO(0x2220, L2220);
+L21b0:
+    AOT_BLOCK(0x21b0, 3);
+    // 21b0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 21b2: cmp $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 21b6: bne 2194
+    if (!Z)
+        AOT_GOTO(0x2194, L2194);
+    AOT_GOTO(0x21b8, L21b8);
+L21b8:
+    AOT_BLOCK(0x21b8, 2);
+    // 21b8: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21bc: br 219e
+    AOT_GOTO(0x219e, L219e);
+L21d8:
+    AOT_BLOCK(0x21d8, 6);
+    // 21d8: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x21dc;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 21dc: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 21e0: mov $7408, -(sp)
+    {
+        src = uint16_t(0x7408);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 21e4: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21e8: jsr pc, *$22c0
+    {
+        a = 0x22c0;
+        r[6] -= 2;
+        WR16(r[6], 0x21ec);
+    }
+    AOT_GOTO(0x22c0, L22c0);
+L21ec:
+    AOT_BLOCK(0x21ec, 3);
+    // 21ec: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 21ee: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L21f2:
+    AOT_BLOCK(0x21f2, 5);
+    // 21f2: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x21f6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 21f6: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 21fa: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 21fe: mov 8(r5), r2
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2202, L2202);
+L2202:
+    AOT_BLOCK(0x2202, 2);
+    // 2202: dec r2
+    {
+        val = int(int16_t(r[2])) - 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 2204: blt 2212
+    if (N ^ V)
+        AOT_GOTO(0x2212, L2212);
+    AOT_GOTO(0x2206, L2206);
+L2206:
+    AOT_BLOCK(0x2206, 2);
+    // 2206: cmpb (r4), (r3)+
+    {
+        a = r[4];
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2208: bne 2212
+    if (!Z)
+        AOT_GOTO(0x2212, L2212);
+    AOT_GOTO(0x220a, L220a);
+L220a:
+    AOT_BLOCK(0x220a, 2);
+    // 220a: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 220c: bne 2202
+    if (!Z)
+        AOT_GOTO(0x2202, L2202);
+    AOT_GOTO(0x220e, L220e);
+L220e:
+    AOT_BLOCK(0x220e, 2);
+    // 220e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2210: br 221c
+    AOT_GOTO(0x221c, L221c);
+L2212:
+    AOT_BLOCK(0x2212, 2);
+    // 2212: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2214: blt 220e
+    if (N ^ V)
+        AOT_GOTO(0x220e, L220e);
+    AOT_GOTO(0x2216, L2216);
+L2216:
+    AOT_BLOCK(0x2216, 3);
+    // 2216: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2218: movb -(r3), r1
+    {
+        r[3] -= 1;
+        a = r[3];
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 221a: sub r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x221c, L221c);
+L221c:
+    AOT_BLOCK(0x221c, 2);
+    // 221c: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2220:
+    AOT_BLOCK(0x2220, 5);
+    // 2220: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2224;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 2224: mov 4(r5), 43de
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x43de;
+        WR16(b, src);
+    }
+    // 222a: mov 6(r5), 43e0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x43e0;
+        WR16(b, src);
+    }
+    // 2230: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2232: sys 0
+    AOT_INTERP(0x2232);
+L2234:
+    AOT_BLOCK(0x2234, 1);
+    // 2234: bic (pc), *(r4)+
+    {
+        src = uint16_t(0x8604);
+        b = RD16(r[4]);
+        r[4] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2236, L2236);
+L2236:
+    AOT_BLOCK(0x2236, 1);
+    // 2236: bcc 2240
+    if (!C)
+        AOT_GOTO(0x2240, L2240);
+    AOT_GOTO(0x2238, L2238);
+L2238:
+    AOT_BLOCK(0x2238, 1);
+    // 2238: mov r0, d1b0
+    {
+        src = r[0];
+        b = 0xd1b0;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x223c, L223c);
+L223a:
+    AOT_BLOCK(0x223a, 1);
+    // 223a: cmpb *15c0(r5), -1(r4)
+    {
+        a = RD16(r[5] + 5568);
+        src = RD8(a);
+        b = uint16_t(r[4] + -1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    AOT_GOTO(0x2240, L2240);
+L223c:
+    AOT_BLOCK(0x223c, 1);
+    // 223c: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2240, L2240);
+L2240:
+    AOT_BLOCK(0x2240, 2);
+    // 2240: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2244:
+    AOT_BLOCK(0x2244, 4);
+    // 2244: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2246: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2248: mov 4(r5), 43e4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x43e4;
+        WR16(b, src);
+    }
+    // 224e: mov 6(r5), 43e6
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x43e6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2254: sys 0
+    AOT_INTERP(0x2254);
+L2256:
+    AOT_BLOCK(0x2256, 1);
+    // 2256: bic (pc), -(r2)
+    {
+        src = uint16_t(0x8602);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2258, L2258);
+L2258:
+    AOT_BLOCK(0x2258, 1);
+    // 2258: bcc 225e
+    if (!C)
+        AOT_GOTO(0x225e, L225e);
+    AOT_GOTO(0x225a, L225a);
+L225a:
+    AOT_BLOCK(0x225a, 1);
+    // 225a: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L225c:
+    AOT_BLOCK(0x225c, 1);
+    // 225c: bne 234e
+    if (!Z)
+        AOT_GOTO(0x234e, L234e);
+    AOT_GOTO(0x225e, L225e);
+L225e:
+    AOT_BLOCK(0x225e, 1);
+    // 225e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2260, L2260);
+L2260:
+    AOT_BLOCK(0x2260, 2);
+    // 2260: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2262: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2264:
+    AOT_BLOCK(0x2264, 3);
+    // 2264: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2266: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2268: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 226c: sys 6
+    AOT_INTERP(0x226c);
+L226e:
+    AOT_BLOCK(0x226e, 1);
+    // 226e: bcc 2274
+    if (!C)
+        AOT_GOTO(0x2274, L2274);
+    AOT_GOTO(0x2270, L2270);
+L2270:
+    AOT_BLOCK(0x2270, 1);
+    // 2270: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L2272:
+    AOT_BLOCK(0x2272, 1);
+    // 2272: bne 2338
+    if (!Z)
+        AOT_GOTO(0x2338, L2338);
+    AOT_GOTO(0x2274, L2274);
+L2274:
+    AOT_BLOCK(0x2274, 1);
+    // 2274: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2276, L2276);
+L2276:
+    AOT_BLOCK(0x2276, 2);
+    // 2276: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2278: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L227a:
+    AOT_BLOCK(0x227a, 4);
+    // 227a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 227c: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 227e: mov 4(r5), 43ea
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x43ea;
+        WR16(b, src);
+    }
+    // 2284: mov 6(r5), 43ec
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x43ec;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 228a: sys 0
+    AOT_INTERP(0x228a);
+L228c:
+    AOT_BLOCK(0x228c, 1);
+    // 228c: bic (pc), *-(r0)
+    {
+        src = uint16_t(0x8602);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x228e, L228e);
+L228e:
+    AOT_BLOCK(0x228e, 1);
+    // 228e: bcc 2294
+    if (!C)
+        AOT_GOTO(0x2294, L2294);
+    AOT_GOTO(0x2290, L2290);
+L2290:
+    AOT_BLOCK(0x2290, 1);
+    // 2290: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L2292:
+    AOT_BLOCK(0x2292, 1);
+    // 2292: bne 2318
+    if (!Z)
+        AOT_GOTO(0x2318, L2318);
+    AOT_GOTO(0x2294, L2294);
+L2294:
+    AOT_BLOCK(0x2294, 2);
+    // 2294: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2296: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2298:
+    AOT_BLOCK(0x2298, 4);
+    // 2298: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 229a: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 229c: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 22a0: mov 6(r5), 43f0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x43f0;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22a6: sys 0
+    AOT_INTERP(0x22a6);
+L22a8:
+    AOT_BLOCK(0x22a8, 1);
+    // 22a8: bic (pc), *-(sp)
+    {
+        src = uint16_t(0x8602);
+        r[6] -= 2;
+        b = RD16(r[6]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x22aa, L22aa);
+L22aa:
+    AOT_BLOCK(0x22aa, 1);
+    // 22aa: bcc 22b0
+    if (!C)
+        AOT_GOTO(0x22b0, L22b0);
+    AOT_GOTO(0x22ac, L22ac);
+L22ac:
+    AOT_BLOCK(0x22ac, 1);
+    // 22ac: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L22ae:
+    AOT_BLOCK(0x22ae, 1);
+    // 22ae: bne 22fc
+    if (!Z)
+        AOT_GOTO(0x22fc, L22fc);
+    AOT_GOTO(0x22b0, L22b0);
+L22b0:
+    AOT_BLOCK(0x22b0, 3);
+    // 22b0: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 22b2: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22b4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L22b6:
+    AOT_BLOCK(0x22b6, 2);
+    // 22b6: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 22b8: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22ba: sys 14
+    AOT_INTERP(0x22ba);
+L22bc:
+    AOT_BLOCK(0x22bc, 1);
+    // 22bc: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x22be, L22be);
+L22be:
+    AOT_BLOCK(0x22be, 1);
+    // 22be: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L22c0:
+    AOT_BLOCK(0x22c0, 1);
+    // 22c0: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x22c2, L22c2);
+L22c2:
+    AOT_BLOCK(0x22c2, 1);
+    // 22c2: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x22c4, L22c4);
+L22c4:
+    AOT_BLOCK(0x22c4, 3);
+    // 22c4: mov 4(r5), 43f4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x43f4;
+        WR16(b, src);
+    }
+    // 22ca: mov 6(r5), 43f6
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x43f6;
+        WR16(b, src);
+    }
+    // 22d0: mov 8(r5), 43f8
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x43f8;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22d6: sys 0
+    AOT_INTERP(0x22d6);
+L22cc:
+    // 22cc: rtt
+    AOT_INTERP(0x22cc);
+L22ce:
+    AOT_BLOCK(0x22ce, 2);
+    // 22ce: cmp r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 22d0: mov 8(r5), 43f8
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x43f8;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22d6: sys 0
+    AOT_INTERP(0x22d6);
+L22d8:
+    AOT_BLOCK(0x22d8, 1);
+    // 22d8: bic (pc), -79fe(r2)
+    {
+        src = uint16_t(0x8602);
+        b = uint16_t(r[2] + -31230);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x22dc, L22dc);
+L22da:
+    AOT_BLOCK(0x22da, 1);
+    // 22da: bcc 22e0
+    if (!C)
+        AOT_GOTO(0x22e0, L22e0);
+    AOT_GOTO(0x22dc, L22dc);
+L22dc:
+    AOT_BLOCK(0x22dc, 1);
+    // 22dc: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L22de:
+    AOT_BLOCK(0x22de, 1);
+    // 22de: br 22cc
+    AOT_GOTO(0x22cc, L22cc);
+L22e0:
+    AOT_BLOCK(0x22e0, 3);
+    // 22e0: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+    }
+    // 22e2: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 22e4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L22e6:
+    AOT_BLOCK(0x22e6, 4);
+    // 22e6: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 22e8: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 22ea: mov 4(r5), 43fc
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x43fc;
+        WR16(b, src);
+    }
+    // 22f0: mov 6(r5), 43fe
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x43fe;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22f6: sys 0
+    AOT_INTERP(0x22f6);
+L22f8:
+    AOT_BLOCK(0x22f8, 1);
+    // 22f8: bic (pc), *-79fe(r2)
+    {
+        src = uint16_t(0x8602);
+        b = RD16(r[2] + -31230);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x22fc, L22fc);
+L22fa:
+    AOT_BLOCK(0x22fa, 1);
+    // 22fa: bcc 2300
+    if (!C)
+        AOT_GOTO(0x2300, L2300);
+    AOT_GOTO(0x22fc, L22fc);
+L22fc:
+    AOT_BLOCK(0x22fc, 1);
+    // 22fc: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L22fe:
+    AOT_BLOCK(0x22fe, 1);
+    // 22fe: br 22ac
+    AOT_GOTO(0x22ac, L22ac);
+L2300:
+    AOT_BLOCK(0x2300, 3);
+    // 2300: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 2302: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2304: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2306:
+    AOT_BLOCK(0x2306, 6);
+    // 2306: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2308: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 230a: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 230e: mov 6(r5), 4402
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x4402;
+        WR16(b, src);
+    }
+    // 2314: mov 8(r5), 4404
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x4404;
+        WR16(b, src);
+    }
+    // 231a: mov a(r5), 4406
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        b = 0x4406;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2320: sys 0
+    AOT_INTERP(0x2320);
+L2318:
+    AOT_BLOCK(0x2318, 2);
+    // 2318: cmp r3, *-(r2)
+    {
+        src = r[3];
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 231a: mov a(r5), 4406
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        b = 0x4406;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2320: sys 0
+    AOT_INTERP(0x2320);
+L2322:
+    AOT_BLOCK(0x2322, 1);
+    // 2322: bic (r0)+, r0
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2324, L2324);
+L2324:
+    AOT_BLOCK(0x2324, 1);
+    // 2324: bcc 232e
+    if (!C)
+        AOT_GOTO(0x232e, L232e);
+    AOT_GOTO(0x2326, L2326);
+L2326:
+    AOT_BLOCK(0x2326, 1);
+    // 2326: mov $1, r1
+    {
+        src = uint16_t(0x0001);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x232a, L232a);
+L2328:
+    // 2328: wait
+    AOT_INTERP(0x2328);
+L232a:
+    AOT_BLOCK(0x232a, 1);
+    // 232a: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L232e:
+    AOT_BLOCK(0x232e, 2);
+    // 232e: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2330: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2332:
+    AOT_BLOCK(0x2332, 4);
+    // 2332: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2334: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2336: mov 4(r5), 440a
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x440a;
+        WR16(b, src);
+    }
+    // 233c: mov 6(r5), 440c
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x440c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2342: sys 0
+    AOT_INTERP(0x2342);
+L2338:
+    // 2338: iot
+    AOT_INTERP(0x2338);
+L233a:
+    AOT_BLOCK(0x233a, 2);
+    // 233a: cmp r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 233c: mov 6(r5), 440c
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x440c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2342: sys 0
+    AOT_INTERP(0x2342);
+L2344:
+    AOT_BLOCK(0x2344, 1);
+    // 2344: bic (r0)+, (r0)
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2346, L2346);
+L2346:
+    AOT_BLOCK(0x2346, 1);
+    // 2346: bcc 234c
+    if (!C)
+        AOT_GOTO(0x234c, L234c);
+    AOT_GOTO(0x2348, L2348);
+L2348:
+    AOT_BLOCK(0x2348, 1);
+    // 2348: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L234a:
+    AOT_BLOCK(0x234a, 1);
+    // 234a: br 2260
+    AOT_GOTO(0x2260, L2260);
+L234c:
+    AOT_BLOCK(0x234c, 1);
+    // 234c: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x234e, L234e);
+L234e:
+    AOT_BLOCK(0x234e, 1);
+    // 234e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2350:
+    AOT_BLOCK(0x2350, 5);
+    // 2350: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2352: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2354: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2358: mov 6(r5), 4410
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x4410;
+        WR16(b, src);
+    }
+    // 235e: mov 8(r5), 4412
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x4412;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2364: sys 0
+    AOT_INTERP(0x2364);
+L2366:
+    AOT_BLOCK(0x2366, 1);
+    // 2366: bic (r0)+, (sp)
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2368, L2368);
+L2368:
+    AOT_BLOCK(0x2368, 1);
+    // 2368: bcc 236e
+    if (!C)
+        AOT_GOTO(0x236e, L236e);
+    AOT_GOTO(0x236a, L236a);
+L236a:
+    AOT_BLOCK(0x236a, 1);
+    // 236a: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L236c:
+    AOT_BLOCK(0x236c, 1);
+    // 236c: br 243e
+    AOT_GOTO(0x243e, L243e);
+L236e:
+    AOT_BLOCK(0x236e, 2);
+    // 236e: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2370: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2372:
+    AOT_BLOCK(0x2372, 4);
+    // 2372: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2374: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2376: mov 4(r5), 4416
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x4416;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 237c: beq 238e
+    if (Z)
+        AOT_GOTO(0x238e, L238e);
+    AOT_GOTO(0x237e, L237e);
+L237e:
+    AOT_BLOCK(0x237e, 1);
+    // 237e: add 4418, 4416
+    {
+        a = 0x4418;
+        src = RD16(a);
+        b = 0x4416;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2384: sys 0
+    AOT_INTERP(0x2384);
+L2386:
+    AOT_BLOCK(0x2386, 1);
+    // 2386: bic (r0)+, (r4)+
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2388, L2388);
+L2388:
+    AOT_BLOCK(0x2388, 1);
+    // 2388: bcc 238e
+    if (!C)
+        AOT_GOTO(0x238e, L238e);
+    AOT_GOTO(0x238a, L238a);
+L238a:
+    AOT_BLOCK(0x238a, 1);
+    // 238a: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L238c:
+    AOT_BLOCK(0x238c, 1);
+    // 238c: br 241e
+    AOT_GOTO(0x241e, L241e);
+L238e:
+    AOT_BLOCK(0x238e, 4);
+    // 238e: mov 4418, r0
+    {
+        a = 0x4418;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2392: add 4(r5), 4418
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x4418;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2398: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 239a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L23bc:
+    AOT_BLOCK(0x23bc, 5);
+    // 23bc: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 23be: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 23c0: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 23c4: cmp r1, $14
+    {
+        src = r[1];
+        dst = uint16_t(0x0014);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 23c8: bcc 2406
+    if (!C)
+        AOT_GOTO(0x2406, L2406);
+    AOT_GOTO(0x23ca, L23ca);
+L23ca:
+    AOT_BLOCK(0x23ca, 7);
+    // 23ca: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 23ce: mov r1, 441c
+    {
+        src = r[1];
+        b = 0x441c;
+        WR16(b, src);
+    }
+    // 23d2: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 23d4: mov -2e40(r1), -(sp)
+    {
+        a = uint16_t(r[1] + -11840);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 23d8: mov r0, -2e40(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + -11840);
+        WR16(b, src);
+    }
+    // 23dc: mov r0, 441e
+    {
+        src = r[0];
+        b = 0x441e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23e0: beq 23f2
+    if (Z)
+        AOT_GOTO(0x23f2, L23f2);
+    AOT_GOTO(0x23e2, L23e2);
+L23e2:
+    AOT_BLOCK(0x23e2, 2);
+    // 23e2: bit $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 23e6: bne 23f2
+    if (!Z)
+        AOT_GOTO(0x23f2, L23f2);
+    AOT_GOTO(0x23e8, L23e8);
+L23e8:
+    AOT_BLOCK(0x23e8, 3);
+    // 23e8: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 23ea: add $240e, r1
+    {
+        src = uint16_t(0x240e);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 23ee: mov r1, 441e
+    {
+        src = r[1];
+        b = 0x441e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x23f2, L23f2);
+L23f2:
+    // 23f2: sys 0
+    AOT_INTERP(0x23f2);
+L23f4:
+    AOT_BLOCK(0x23f4, 1);
+    // 23f4: bic (r0)+, *(r2)+
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        b = RD16(r[2]);
+        r[2] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x23f6, L23f6);
+L23f6:
+    AOT_BLOCK(0x23f6, 1);
+    // 23f6: bcs 240a
+    if (C)
+        AOT_GOTO(0x240a, L240a);
+    AOT_GOTO(0x23f8, L23f8);
+L23f8:
+    AOT_BLOCK(0x23f8, 1);
+    // 23f8: bit $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x23fc, L23fc);
+L23fa:
+    // 23fa: wait
+    AOT_INTERP(0x23fa);
+L23fc:
+    AOT_BLOCK(0x23fc, 1);
+    // 23fc: beq 2400
+    if (Z)
+        AOT_GOTO(0x2400, L2400);
+    AOT_GOTO(0x23fe, L23fe);
+L23fe:
+    AOT_BLOCK(0x23fe, 1);
+    // 23fe: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2400, L2400);
+L2400:
+    AOT_BLOCK(0x2400, 3);
+    // 2400: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2402: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2404: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2406:
+    AOT_BLOCK(0x2406, 1);
+    // 2406: mov $16, r0
+    {
+        src = uint16_t(0x0016);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x240a, L240a);
+L240a:
+    AOT_BLOCK(0x240a, 1);
+    // 240a: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L241e:
+    AOT_BLOCK(0x241e, 1);
+    // 241e: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x2422;
+    }
+    AOT_GOTO(0x245e, L245e);
+L2422:
+    AOT_BLOCK(0x2422, 1);
+    // 2422: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x2426;
+    }
+    AOT_GOTO(0x245e, L245e);
+L2426:
+    AOT_BLOCK(0x2426, 1);
+    // 2426: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x242a;
+    }
+    AOT_GOTO(0x245e, L245e);
+L242a:
+    AOT_BLOCK(0x242a, 1);
+    // 242a: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x242e;
+    }
+    AOT_GOTO(0x245e, L245e);
+L242e:
+    AOT_BLOCK(0x242e, 1);
+    // 242e: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x2432;
+    }
+    AOT_GOTO(0x245e, L245e);
+L2432:
+    AOT_BLOCK(0x2432, 1);
+    // 2432: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x2436;
+    }
+    AOT_GOTO(0x245e, L245e);
+L2436:
+    AOT_BLOCK(0x2436, 1);
+    // 2436: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x243a;
+    }
+    AOT_GOTO(0x245e, L245e);
+L243a:
+    AOT_BLOCK(0x243a, 1);
+    // 243a: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x243e;
+    }
+    AOT_GOTO(0x245e, L245e);
+L243e:
+    AOT_BLOCK(0x243e, 1);
+    // 243e: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x2442;
+    }
+    AOT_GOTO(0x245e, L245e);
+L2442:
+    AOT_BLOCK(0x2442, 1);
+    // 2442: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x2446;
+    }
+    AOT_GOTO(0x245e, L245e);
+L2446:
+    AOT_BLOCK(0x2446, 1);
+    // 2446: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x244a;
+    }
+    AOT_GOTO(0x245e, L245e);
+L244a:
+    AOT_BLOCK(0x244a, 1);
+    // 244a: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x244e;
+    }
+    AOT_GOTO(0x245e, L245e);
+L244e:
+    AOT_BLOCK(0x244e, 1);
+    // 244e: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x2452;
+    }
+    AOT_GOTO(0x245e, L245e);
+L2452:
+    AOT_BLOCK(0x2452, 1);
+    // 2452: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x2456;
+    }
+    AOT_GOTO(0x245e, L245e);
+L2456:
+    AOT_BLOCK(0x2456, 1);
+    // 2456: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x245a;
+    }
+    AOT_GOTO(0x245e, L245e);
+L245a:
+    AOT_BLOCK(0x245a, 1);
+    // 245a: jsr r0, 245e
+    {
+        a = 0x245e;
+        r[6] -= 2;
+        WR16(r[6], r[0]);
+        r[0] = 0x245e;
+    }
+    AOT_GOTO(0x245e, L245e);
+L245e:
+    AOT_BLOCK(0x245e, 9);
+    // 245e: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2460: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2462: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2464: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2466: sub $2412, r0
+    {
+        src = uint16_t(0x2412);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 246a: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+    }
+    // 246c: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 246e: asr (sp)
+    {
+        a = r[6];
+        src = RD16(a);
+        val = int16_t(src) >> 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 1) != 0;
+        V = (val < 0) != ((src & 1) != 0);
+    }
+    // 2470: jsr pc, *-2e40(r0)
+    {
+        a = RD16(r[0] + -11840);
+        r[6] -= 2;
+        WR16(r[6], 0x2474);
+    }
+    AOT_JUMP(a);
+L2474:
+    AOT_BLOCK(0x2474, 6);
+    // 2474: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2476: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2478: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 247a: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 247c: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 247e: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2480: rtt
+    AOT_INTERP(0x2480);
+L2482:
+    AOT_BLOCK(0x2482, 3);
+    // 2482: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2484: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2486: mov 4(r5), 4422
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x4422;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 248c: sys 0
+    AOT_INTERP(0x248c);
+L248e:
+    AOT_BLOCK(0x248e, 1);
+    // 248e: bic (r0)+, -(r0)
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2490, L2490);
+L2490:
+    AOT_BLOCK(0x2490, 1);
+    // 2490: bcc 2496
+    if (!C)
+        AOT_GOTO(0x2496, L2496);
+    AOT_GOTO(0x2492, L2492);
+L2492:
+    AOT_BLOCK(0x2492, 1);
+    // 2492: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L2494:
+    // 2494: jmp r0
+    AOT_INTERP(0x2494);
+L2496:
+    AOT_BLOCK(0x2496, 2);
+    // 2496: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2498: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L249a:
+    AOT_BLOCK(0x249a, 3);
+    // 249a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 249c: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 249e: mov 4(r5), 4426
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x4426;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24a4: sys 0
+    AOT_INTERP(0x24a4);
+L24a6:
+    AOT_BLOCK(0x24a6, 1);
+    // 24a6: bic (r0)+, -(r4)
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x24a8, L24a8);
+L24a8:
+    AOT_BLOCK(0x24a8, 1);
+    // 24a8: bcc 24ae
+    if (!C)
+        AOT_GOTO(0x24ae, L24ae);
+    AOT_GOTO(0x24aa, L24aa);
+L24aa:
+    AOT_BLOCK(0x24aa, 1);
+    // 24aa: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L24ac:
+    // 24ac: (undefined)
+    AOT_INTERP(0x24ac);
+L24ae:
+    AOT_BLOCK(0x24ae, 3);
+    // 24ae: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 24b0: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24b2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L24b4:
+    AOT_BLOCK(0x24b4, 5);
+    // 24b4: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 24b6: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 24b8: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 24bc: mov 6(r5), 442a
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x442a;
+        WR16(b, src);
+    }
+    // 24c2: mov 8(r5), 442c
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x442c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24c8: sys 0
+    AOT_INTERP(0x24c8);
+L24ca:
+    AOT_BLOCK(0x24ca, 1);
+    // 24ca: bic (r0)+, *-(r0)
+    {
+        a = r[0];
+        r[0] += 2;
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x24cc, L24cc);
+L24cc:
+    AOT_BLOCK(0x24cc, 1);
+    // 24cc: bcc 24d2
+    if (!C)
+        AOT_GOTO(0x24d2, L24d2);
+    AOT_GOTO(0x24ce, L24ce);
+L24ce:
+    AOT_BLOCK(0x24ce, 1);
+    // 24ce: jmp 24d6
+    {
+        a = 0x24d6;
+    }
+    AOT_GOTO(0x24d6, L24d6);
+L24d0:
+    // 24d0: iot
+    AOT_INTERP(0x24d0);
+L24d2:
+    AOT_BLOCK(0x24d2, 2);
+    // 24d2: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24d4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L24d6:
+    AOT_BLOCK(0x24d6, 5);
+    // 24d6: mov r0, d1b0
+    {
+        src = r[0];
+        b = 0xd1b0;
+        WR16(b, src);
+    }
+    // 24da: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+    }
+    // 24de: mov r5, sp
+    {
+        src = r[5];
+        r[6] = src;
+    }
+    // 24e0: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24e2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L24e4:
+    AOT_BLOCK(0x24e4, 5);
+    // 24e4: jsr r5, 2596
+    {
+        a = 0x2596;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x24e8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    // 24e8: mov a(r5), r3
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[3] = src;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24ec: sxt r4
+    {
+        r[4] = -int(N);
+        Z = !N;
+    }
+    // 24ee: bpl 24f2
+    if (!N)
+        AOT_GOTO(0x24f2, L24f2);
+    AOT_GOTO(0x24f0, L24f0);
+L24f0:
+    AOT_BLOCK(0x24f0, 1);
+    // 24f0: neg r3
+    {
+        val = -int16_t(r[3]);
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x24f2, L24f2);
+L24f2:
+    AOT_BLOCK(0x24f2, 2);
+    // 24f2: cmp r4, 8(r5)
+    {
+        src = r[4];
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 24f6: bne 2536
+    if (!Z)
+        AOT_GOTO(0x2536, L2536);
+    AOT_GOTO(0x24f8, L24f8);
+L24f8:
+    AOT_BLOCK(0x24f8, 2);
+    // 24f8: mov 6(r5), r2
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 24fc: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2500, L2500);
+L2500:
+    AOT_BLOCK(0x2500, 1);
+    // 2500: bge 250a
+    if (!(N ^ V))
+        AOT_GOTO(0x250a, L250a);
+    AOT_GOTO(0x2502, L2502);
+L2502:
+    AOT_BLOCK(0x2502, 4);
+    // 2502: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+    }
+    // 2504: neg r2
+    {
+        val = -int16_t(r[2]);
+        r[2] = val;
+        C = val != 0;
+    }
+    // 2506: sbc r1
+    {
+        val = int(int16_t(r[1])) - int(C);
+        r[1] = val;
+    }
+    // 2508: com r4
+    {
+        val = ~int(r[4]);
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = true;
+        V = false;
+    }
+    AOT_GOTO(0x250a, L250a);
+L250a:
+    AOT_BLOCK(0x250a, 8);
+    // 250a: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 250c: clr r0
+    {
+        r[0] = 0;
+    }
+    // 250e: div r3, r0
+    {
+        src = int16_t(r[3]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2510: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 2512: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 2514: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 2516: div r3, r0
+    {
+        src = int16_t(r[3]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2518: bvc 2524
+    if (!V)
+        AOT_GOTO(0x2524, L2524);
+    AOT_GOTO(0x251a, L251a);
+L251a:
+    AOT_BLOCK(0x251a, 5);
+    // 251a: sub r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 251c: div r3, r0
+    {
+        src = int16_t(r[3]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 251e: tst r1
+    {
+        val = int16_t(r[1]);
+        N = val < 0;
+    }
+    // 2520: sxt r1
+    {
+        r[1] = -int(N);
+    }
+    // 2522: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2524, L2524);
+L2524:
+    AOT_BLOCK(0x2524, 2);
+    // 2524: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 2526: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2528, L2528);
+L2528:
+    AOT_BLOCK(0x2528, 2);
+    // 2528: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 252a: bpl 2532
+    if (!N)
+        AOT_GOTO(0x2532, L2532);
+    AOT_GOTO(0x252c, L252c);
+L252c:
+    AOT_BLOCK(0x252c, 3);
+    // 252c: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+    }
+    // 252e: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 2530: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == -1;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x2532, L2532);
+L2532:
+    AOT_BLOCK(0x2532, 2);
+    // 2532: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2536:
+    AOT_BLOCK(0x2536, 4);
+    // 2536: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 2538: mov 6(r5), r2
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 253c: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2540: bpl 254a
+    if (!N)
+        AOT_GOTO(0x254a, L254a);
+    AOT_GOTO(0x2542, L2542);
+L2542:
+    AOT_BLOCK(0x2542, 4);
+    // 2542: com (sp)
+    {
+        a = r[6];
+        val = ~int(RD16(a));
+        WR16(a, val);
+    }
+    // 2544: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+    }
+    // 2546: neg r2
+    {
+        val = -int16_t(r[2]);
+        r[2] = val;
+        C = val != 0;
+    }
+    // 2548: sbc r1
+    {
+        val = int(int16_t(r[1])) - int(C);
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == -1;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x254a, L254a);
+L254a:
+    AOT_BLOCK(0x254a, 3);
+    // 254a: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 254c: mov 8(r5), r3
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2550: bge 255c
+    if (!(N ^ V))
+        AOT_GOTO(0x255c, L255c);
+    AOT_GOTO(0x2552, L2552);
+L2552:
+    AOT_BLOCK(0x2552, 4);
+    // 2552: neg r3
+    {
+        val = -int16_t(r[3]);
+        r[3] = val;
+    }
+    // 2554: neg a(r5)
+    {
+        a = uint16_t(r[5] + 10);
+        val = -int16_t(RD16(a));
+        WR16(a, val);
+        C = val != 0;
+    }
+    // 2558: sbc r3
+    {
+        val = int(int16_t(r[3])) - int(C);
+        r[3] = val;
+    }
+    // 255a: com (sp)
+    {
+        a = r[6];
+        val = ~int(RD16(a));
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = true;
+        V = false;
+    }
+    AOT_GOTO(0x255c, L255c);
+L255c:
+    AOT_BLOCK(0x255c, 1);
+    // 255c: mov $10, r4
+    {
+        src = uint16_t(0x0010);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2560, L2560);
+L2560:
+    AOT_BLOCK(0x2560, 6);
+    // 2560: clc
+    {
+        C = false;
+    }
+    // 2562: rol r2
+    {
+        src = r[2];
+        val = uint16_t(src << 1) | (C ? 1 : 0);
+        r[2] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 2564: rol r1
+    {
+        src = r[1];
+        val = uint16_t(src << 1) | (C ? 1 : 0);
+        r[1] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 2566: rol r0
+    {
+        src = r[0];
+        val = uint16_t(src << 1) | (C ? 1 : 0);
+        r[0] = val;
+    }
+    // 2568: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 256a: bgt 2574
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x2574, L2574);
+    AOT_GOTO(0x256c, L256c);
+L256c:
+    AOT_BLOCK(0x256c, 1);
+    // 256c: blt 2578
+    if (N ^ V)
+        AOT_GOTO(0x2578, L2578);
+    AOT_GOTO(0x256e, L256e);
+L256e:
+    AOT_BLOCK(0x256e, 2);
+    // 256e: cmp a(r5), r1
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2572: blos 2578
+    if (C | Z)
+        AOT_GOTO(0x2578, L2578);
+    AOT_GOTO(0x2574, L2574);
+L2574:
+    AOT_BLOCK(0x2574, 1);
+    // 2574: sob r4, b
+    {
+        r[4]--;
+    }
+    if (r[4] != 0)
+        AOT_GOTO(0x2560, L2560);
+    AOT_GOTO(0x2576, L2576);
+L2576:
+    AOT_BLOCK(0x2576, 1);
+    // 2576: br 2584
+    AOT_GOTO(0x2584, L2584);
+L2578:
+    AOT_BLOCK(0x2578, 5);
+    // 2578: sub a(r5), r1
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        C = dst < src;
+    }
+    // 257c: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+    }
+    // 257e: sub r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 2580: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 2582: sob r4, 12
+    {
+        r[4]--;
+    }
+    if (r[4] != 0)
+        AOT_GOTO(0x2560, L2560);
+    AOT_GOTO(0x2584, L2584);
+L2584:
+    AOT_BLOCK(0x2584, 4);
+    // 2584: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 2586: clr r0
+    {
+        r[0] = 0;
+    }
+    // 2588: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 258a: beq 2592
+    if (Z)
+        AOT_GOTO(0x2592, L2592);
+    AOT_GOTO(0x258c, L258c);
+L258c:
+    AOT_BLOCK(0x258c, 3);
+    // 258c: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+    }
+    // 258e: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 2590: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == -1;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x2592, L2592);
+L2592:
+    AOT_BLOCK(0x2592, 2);
+    // 2592: jmp 25a2
+    {
+        a = 0x25a2;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2596:
+    AOT_BLOCK(0x2596, 1);
+    // csv
+    {
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x25a2);
+    }
+    AOT_JUMP(r[0]);
+L25a2:
+    AOT_BLOCK(0x25a2, 1);
+    // cret
+    {
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("v7/bin/ld", 0x0000, 9664, 0xee2a7634u, run);
+}
@@ -0,0 +1,6961 @@
+// v7/lib/as2 translated by 7aot: 395 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x0004: goto L0004;
+        case 0x0006: goto L0006;
+        case 0x0008: goto L0008;
+        case 0x000a: goto L000a;
+        case 0x000c: goto L000c;
+        case 0x000e: goto L000e;
+        case 0x0010: goto L0010;
+        case 0x0012: goto L0012;
+        case 0x0014: goto L0014;
+        case 0x0018: goto L0018;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0020: goto L0020;
+        case 0x0022: goto L0022;
+        case 0x0028: goto L0028;
+        case 0x002c: goto L002c;
+        case 0x0030: goto L0030;
+        case 0x0034: goto L0034;
+        case 0x0040: goto L0040;
+        case 0x0046: goto L0046;
+        case 0x004a: goto L004a;
+        case 0x0050: goto L0050;
+        case 0x0052: goto L0052;
+        case 0x0054: goto L0054;
+        case 0x005c: goto L005c;
+        case 0x0060: goto L0060;
+        case 0x0062: goto L0062;
+        case 0x0070: goto L0070;
+        case 0x0074: goto L0074;
+        case 0x0076: goto L0076;
+        case 0x007a: goto L007a;
+        case 0x0080: goto L0080;
+        case 0x0086: goto L0086;
+        case 0x0088: goto L0088;
+        case 0x0094: goto L0094;
+        case 0x0098: goto L0098;
+        case 0x00a0: goto L00a0;
+        case 0x00a4: goto L00a4;
+        case 0x00a8: goto L00a8;
+        case 0x00b4: goto L00b4;
+        case 0x00b8: goto L00b8;
+        case 0x00be: goto L00be;
+        case 0x00c0: goto L00c0;
+        case 0x00c2: goto L00c2;
+        case 0x00c4: goto L00c4;
+        case 0x00c6: goto L00c6;
+        case 0x00d0: goto L00d0;
+        case 0x00da: goto L00da;
+        case 0x00dc: goto L00dc;
+        case 0x0100: goto L0100;
+        case 0x014a: goto L014a;
+        case 0x014e: goto L014e;
+        case 0x0158: goto L0158;
+        case 0x0160: goto L0160;
+        case 0x016e: goto L016e;
+        case 0x0174: goto L0174;
+        case 0x0178: goto L0178;
+        case 0x017e: goto L017e;
+        case 0x0184: goto L0184;
+        case 0x0188: goto L0188;
+        case 0x018c: goto L018c;
+        case 0x0192: goto L0192;
+        case 0x0194: goto L0194;
+        case 0x019e: goto L019e;
+        case 0x01a0: goto L01a0;
+        case 0x01a2: goto L01a2;
+        case 0x01a4: goto L01a4;
+        case 0x01a6: goto L01a6;
+        case 0x01b0: goto L01b0;
+        case 0x01b4: goto L01b4;
+        case 0x01ba: goto L01ba;
+        case 0x01bc: goto L01bc;
+        case 0x01be: goto L01be;
+        case 0x01c0: goto L01c0;
+        case 0x01c6: goto L01c6;
+        case 0x01c8: goto L01c8;
+        case 0x01cc: goto L01cc;
+        case 0x01d2: goto L01d2;
+        case 0x01d6: goto L01d6;
+        case 0x01d8: goto L01d8;
+        case 0x01de: goto L01de;
+        case 0x01e4: goto L01e4;
+        case 0x01e6: goto L01e6;
+        case 0x01ea: goto L01ea;
+        case 0x01f2: goto L01f2;
+        case 0x01fa: goto L01fa;
+        case 0x0200: goto L0200;
+        case 0x0204: goto L0204;
+        case 0x0206: goto L0206;
+        case 0x020a: goto L020a;
+        case 0x0210: goto L0210;
+        case 0x0214: goto L0214;
+        case 0x021a: goto L021a;
+        case 0x0220: goto L0220;
+        case 0x0222: goto L0222;
+        case 0x0224: goto L0224;
+        case 0x0226: goto L0226;
+        case 0x0228: goto L0228;
+        case 0x022a: goto L022a;
+        case 0x022c: goto L022c;
+        case 0x022e: goto L022e;
+        case 0x0230: goto L0230;
+        case 0x0232: goto L0232;
+        case 0x0234: goto L0234;
+        case 0x0238: goto L0238;
+        case 0x023c: goto L023c;
+        case 0x0240: goto L0240;
+        case 0x0246: goto L0246;
+        case 0x024c: goto L024c;
+        case 0x024e: goto L024e;
+        case 0x0256: goto L0256;
+        case 0x025c: goto L025c;
+        case 0x025e: goto L025e;
+        case 0x0262: goto L0262;
+        case 0x0264: goto L0264;
+        case 0x026a: goto L026a;
+        case 0x0272: goto L0272;
+        case 0x0274: goto L0274;
+        case 0x0276: goto L0276;
+        case 0x0278: goto L0278;
+        case 0x027a: goto L027a;
+        case 0x027c: goto L027c;
+        case 0x0284: goto L0284;
+        case 0x0290: goto L0290;
+        case 0x0294: goto L0294;
+        case 0x029c: goto L029c;
+        case 0x029e: goto L029e;
+        case 0x02a6: goto L02a6;
+        case 0x02a8: goto L02a8;
+        case 0x02aa: goto L02aa;
+        case 0x02ac: goto L02ac;
+        case 0x02ae: goto L02ae;
+        case 0x02b2: goto L02b2;
+        case 0x02ba: goto L02ba;
+        case 0x02c2: goto L02c2;
+        case 0x02ce: goto L02ce;
+        case 0x02dc: goto L02dc;
+        case 0x02f2: goto L02f2;
+        case 0x02fc: goto L02fc;
+        case 0x0300: goto L0300;
+        case 0x0302: goto L0302;
+        case 0x0308: goto L0308;
+        case 0x030c: goto L030c;
+        case 0x030e: goto L030e;
+        case 0x0312: goto L0312;
+        case 0x0318: goto L0318;
+        case 0x031e: goto L031e;
+        case 0x0322: goto L0322;
+        case 0x0328: goto L0328;
+        case 0x032c: goto L032c;
+        case 0x0330: goto L0330;
+        case 0x0334: goto L0334;
+        case 0x0336: goto L0336;
+        case 0x0340: goto L0340;
+        case 0x034a: goto L034a;
+        case 0x034c: goto L034c;
+        case 0x0354: goto L0354;
+        case 0x035e: goto L035e;
+        case 0x0360: goto L0360;
+        case 0x0362: goto L0362;
+        case 0x0364: goto L0364;
+        case 0x0368: goto L0368;
+        case 0x036a: goto L036a;
+        case 0x0370: goto L0370;
+        case 0x0372: goto L0372;
+        case 0x0376: goto L0376;
+        case 0x037a: goto L037a;
+        case 0x0382: goto L0382;
+        case 0x0388: goto L0388;
+        case 0x038c: goto L038c;
+        case 0x038e: goto L038e;
+        case 0x0394: goto L0394;
+        case 0x039e: goto L039e;
+        case 0x03a2: goto L03a2;
+        case 0x03aa: goto L03aa;
+        case 0x03b6: goto L03b6;
+        case 0x03c6: goto L03c6;
+        case 0x03ce: goto L03ce;
+        case 0x03d4: goto L03d4;
+        case 0x03ea: goto L03ea;
+        case 0x03f0: goto L03f0;
+        case 0x03f8: goto L03f8;
+        case 0x03fa: goto L03fa;
+        case 0x03fc: goto L03fc;
+        case 0x03fe: goto L03fe;
+        case 0x0400: goto L0400;
+        case 0x0410: goto L0410;
+        case 0x0420: goto L0420;
+        case 0x0426: goto L0426;
+        case 0x0428: goto L0428;
+        case 0x042a: goto L042a;
+        case 0x042c: goto L042c;
+        case 0x042e: goto L042e;
+        case 0x0434: goto L0434;
+        case 0x0438: goto L0438;
+        case 0x043c: goto L043c;
+        case 0x043e: goto L043e;
+        case 0x0440: goto L0440;
+        case 0x0444: goto L0444;
+        case 0x044a: goto L044a;
+        case 0x0450: goto L0450;
+        case 0x0454: goto L0454;
+        case 0x0480: goto L0480;
+        case 0x0484: goto L0484;
+        case 0x048a: goto L048a;
+        case 0x0498: goto L0498;
+        case 0x049e: goto L049e;
+        case 0x0500: goto L0500;
+        case 0x0570: goto L0570;
+        case 0x0572: goto L0572;
+        case 0x0592: goto L0592;
+        case 0x0598: goto L0598;
+        case 0x059e: goto L059e;
+        case 0x05a0: goto L05a0;
+        case 0x05a4: goto L05a4;
+        case 0x05a8: goto L05a8;
+        case 0x05ae: goto L05ae;
+        case 0x05b4: goto L05b4;
+        case 0x05ba: goto L05ba;
+        case 0x05be: goto L05be;
+        case 0x05c0: goto L05c0;
+        case 0x05cc: goto L05cc;
+        case 0x05d2: goto L05d2;
+        case 0x05d6: goto L05d6;
+        case 0x05dc: goto L05dc;
+        case 0x05e0: goto L05e0;
+        case 0x05e8: goto L05e8;
+        case 0x060e: goto L060e;
+        case 0x061a: goto L061a;
+        case 0x0620: goto L0620;
+        case 0x0628: goto L0628;
+        case 0x0630: goto L0630;
+        case 0x0636: goto L0636;
+        case 0x063a: goto L063a;
+        case 0x064a: goto L064a;
+        case 0x064c: goto L064c;
+        case 0x064e: goto L064e;
+        case 0x0650: goto L0650;
+        case 0x0652: goto L0652;
+        case 0x0674: goto L0674;
+        case 0x0676: goto L0676;
+        case 0x0678: goto L0678;
+        case 0x067a: goto L067a;
+        case 0x067c: goto L067c;
+        case 0x067e: goto L067e;
+        case 0x0680: goto L0680;
+        case 0x0682: goto L0682;
+        case 0x0684: goto L0684;
+        case 0x0686: goto L0686;
+        case 0x0688: goto L0688;
+        case 0x06a2: goto L06a2;
+        case 0x06a8: goto L06a8;
+        case 0x06ae: goto L06ae;
+        case 0x06b2: goto L06b2;
+        case 0x06b8: goto L06b8;
+        case 0x06be: goto L06be;
+        case 0x06c4: goto L06c4;
+        case 0x06c8: goto L06c8;
+        case 0x06ca: goto L06ca;
+        case 0x06d0: goto L06d0;
+        case 0x06d6: goto L06d6;
+        case 0x06dc: goto L06dc;
+        case 0x06e2: goto L06e2;
+        case 0x06e4: goto L06e4;
+        case 0x06e6: goto L06e6;
+        case 0x06e8: goto L06e8;
+        case 0x06ea: goto L06ea;
+        case 0x06f0: goto L06f0;
+        case 0x06f8: goto L06f8;
+        case 0x06fe: goto L06fe;
+        case 0x070a: goto L070a;
+        case 0x0710: goto L0710;
+        case 0x0712: goto L0712;
+        case 0x0800: goto L0800;
+        case 0x080a: goto L080a;
+        case 0x080e: goto L080e;
+        case 0x0810: goto L0810;
+        case 0x081a: goto L081a;
+        case 0x081e: goto L081e;
+        case 0x0822: goto L0822;
+        case 0x082e: goto L082e;
+        case 0x0830: goto L0830;
+        case 0x0a00: goto L0a00;
+        case 0x0a02: goto L0a02;
+        case 0x0a1a: goto L0a1a;
+        case 0x0a20: goto L0a20;
+        case 0x0a2e: goto L0a2e;
+        case 0x0a70: goto L0a70;
+        case 0x0a76: goto L0a76;
+        case 0x0a7c: goto L0a7c;
+        case 0x0a80: goto L0a80;
+        case 0x0a82: goto L0a82;
+        case 0x0a88: goto L0a88;
+        case 0x0a8c: goto L0a8c;
+        case 0x0a90: goto L0a90;
+        case 0x0a96: goto L0a96;
+        case 0x0a9a: goto L0a9a;
+        case 0x0aa6: goto L0aa6;
+        case 0x0aaa: goto L0aaa;
+        case 0x0aae: goto L0aae;
+        case 0x0ab6: goto L0ab6;
+        case 0x0abc: goto L0abc;
+        case 0x0ac0: goto L0ac0;
+        case 0x0ac4: goto L0ac4;
+        case 0x0ade: goto L0ade;
+        case 0x0ae2: goto L0ae2;
+        case 0x0af2: goto L0af2;
+        case 0x0af6: goto L0af6;
+        case 0x0afa: goto L0afa;
+        case 0x0afe: goto L0afe;
+        case 0x0b02: goto L0b02;
+        case 0x0b08: goto L0b08;
+        case 0x0b0c: goto L0b0c;
+        case 0x0b1a: goto L0b1a;
+        case 0x0b20: goto L0b20;
+        case 0x0b24: goto L0b24;
+        case 0x0b2c: goto L0b2c;
+        case 0x0b30: goto L0b30;
+        case 0x0b36: goto L0b36;
+        case 0x0b40: goto L0b40;
+        case 0x0b44: goto L0b44;
+        case 0x0b48: goto L0b48;
+        case 0x0b4c: goto L0b4c;
+        case 0x0b50: goto L0b50;
+        case 0x0b58: goto L0b58;
+        case 0x0b5c: goto L0b5c;
+        case 0x0b60: goto L0b60;
+        case 0x0b70: goto L0b70;
+        case 0x0b74: goto L0b74;
+        case 0x0b78: goto L0b78;
+        case 0x0b7a: goto L0b7a;
+        case 0x0b82: goto L0b82;
+        case 0x0b86: goto L0b86;
+        case 0x0b8a: goto L0b8a;
+        case 0x0b8e: goto L0b8e;
+        case 0x0b94: goto L0b94;
+        case 0x0b9a: goto L0b9a;
+        case 0x0ba0: goto L0ba0;
+        case 0x0ba2: goto L0ba2;
+        case 0x0ba6: goto L0ba6;
+        case 0x0bb4: goto L0bb4;
+        case 0x0bba: goto L0bba;
+        case 0x0bbe: goto L0bbe;
+        case 0x0bc0: goto L0bc0;
+        case 0x0bc2: goto L0bc2;
+        case 0x0bc6: goto L0bc6;
+        case 0x0bd6: goto L0bd6;
+        case 0x0c00: goto L0c00;
+        case 0x0c38: goto L0c38;
+        case 0x0c4a: goto L0c4a;
+        case 0x0c4e: goto L0c4e;
+        case 0x0c54: goto L0c54;
+        case 0x0c56: goto L0c56;
+        case 0x0c80: goto L0c80;
+        case 0x0cc0: goto L0cc0;
+        case 0x0cc2: goto L0cc2;
+        case 0x0cc6: goto L0cc6;
+        case 0x0cca: goto L0cca;
+        case 0x0cce: goto L0cce;
+        case 0x0d00: goto L0d00;
+        case 0x0d28: goto L0d28;
+        case 0x0d2c: goto L0d2c;
+        case 0x0d30: goto L0d30;
+        case 0x0d34: goto L0d34;
+        case 0x0d36: goto L0d36;
+        case 0x0dc0: goto L0dc0;
+        case 0x0dc4: goto L0dc4;
+        case 0x0dc6: goto L0dc6;
+        case 0x0dea: goto L0dea;
+        case 0x0df2: goto L0df2;
+        case 0x0df8: goto L0df8;
+        case 0x0e0c: goto L0e0c;
+        case 0x0e12: goto L0e12;
+        case 0x0e16: goto L0e16;
+        case 0x0e1c: goto L0e1c;
+        case 0x0e20: goto L0e20;
+        case 0x0e26: goto L0e26;
+        case 0x0e2a: goto L0e2a;
+        case 0x0e2e: goto L0e2e;
+        case 0x0e38: goto L0e38;
+        case 0x0e44: goto L0e44;
+        case 0x0e4c: goto L0e4c;
+        case 0x0e52: goto L0e52;
+        case 0x0e56: goto L0e56;
+        case 0x0e58: goto L0e58;
+        case 0x0e5c: goto L0e5c;
+        case 0x0e60: goto L0e60;
+        case 0x0e66: goto L0e66;
+        case 0x0e6c: goto L0e6c;
+        case 0x0e76: goto L0e76;
+        case 0x0e7a: goto L0e7a;
+        case 0x0e80: goto L0e80;
+        case 0x0e84: goto L0e84;
+    }
+    goto interp;
+L0000:
+    // 0000: sys 30
+    AOT_INTERP(0x0000);
+L0002:
+    // 0002: rti
+    AOT_INTERP(0x0002);
+L0004:
+    // 0004: wait
+    AOT_INTERP(0x0004);
+L0006:
+    AOT_BLOCK(0x0006, 1);
+    // 0006: ror r0
+    {
+        src = r[0];
+        val = (src >> 1) | (C ? 0x8000 : 0);
+        dst = C;
+        r[0] = val;
+        Z = val == 0;
+        N = dst;
+        C = (src & 1) != 0;
+        V = dst != ((src & 1) != 0);
+    }
+    AOT_GOTO(0x0008, L0008);
+L0008:
+    AOT_BLOCK(0x0008, 1);
+    // 0008: bcs 0010
+    if (C)
+        AOT_GOTO(0x0010, L0010);
+    AOT_GOTO(0x000a, L000a);
+L000a:
+    // 000a: sys 30
+    AOT_INTERP(0x000a);
+L000c:
+    // 000c: rti
+    AOT_INTERP(0x000c);
+L000e:
+    AOT_BLOCK(0x000e, 1);
+    // 000e: cmp r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0010, L0010);
+L0010:
+    AOT_BLOCK(0x0010, 1);
+    // 0010: jmp 22e8
+    {
+        a = 0x22e8;
+    }
+    AOT_JUMP(0x22e8);
+L0012:
+    AOT_BLOCK(0x0012, 1);
+    // 0012: cmp (r3), (r4)+
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0014, L0014);
+L0014:
+    AOT_BLOCK(0x0014, 1);
+    // 0014: mov $29fc, r1
+    {
+        src = uint16_t(0x29fc);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0018, L0018);
+L0018:
+    AOT_BLOCK(0x0018, 1);
+    // 0018: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x001c);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L001c:
+    AOT_BLOCK(0x001c, 1);
+    // 001c: bvs 0062
+    if (V)
+        AOT_GOTO(0x0062, L0062);
+    AOT_GOTO(0x001e, L001e);
+L001e:
+    AOT_BLOCK(0x001e, 2);
+    // 001e: add $c, 2074
+    {
+        src = uint16_t(0x000c);
+        b = 0x2074;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0024: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0028);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L0020:
+    // 0020: (undefined)
+    AOT_INTERP(0x0020);
+L0022:
+    AOT_BLOCK(0x0022, 2);
+    // 0022: cmp r1, (r0)+
+    {
+        src = r[1];
+        b = r[0];
+        r[0] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0024: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0028);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L0028:
+    AOT_BLOCK(0x0028, 1);
+    // 0028: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x002c);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L002c:
+    AOT_BLOCK(0x002c, 1);
+    // 002c: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0030);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L0030:
+    AOT_BLOCK(0x0030, 1);
+    // 0030: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0034);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L0034:
+    AOT_BLOCK(0x0034, 4);
+    // 0034: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0036: bic $ffe0, r0
+    {
+        src = uint16_t(0xffe0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 003a: cmp r0, $2
+    {
+        src = r[0];
+        dst = uint16_t(0x0002);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 003e: bcs 0054
+    if (C)
+        AOT_GOTO(0x0054, L0054);
+    AOT_GOTO(0x0040, L0040);
+L0040:
+    AOT_BLOCK(0x0040, 2);
+    // 0040: cmp r0, $3
+    {
+        src = r[0];
+        dst = uint16_t(0x0003);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0044: bhi 0054
+    if (!(C | Z))
+        AOT_GOTO(0x0054, L0054);
+    AOT_GOTO(0x0046, L0046);
+L0046:
+    AOT_BLOCK(0x0046, 1);
+    // 0046: add $19, r4
+    {
+        src = uint16_t(0x0019);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x004a, L004a);
+L004a:
+    AOT_BLOCK(0x004a, 2);
+    // 004a: mov r4, (r1)+
+    {
+        src = r[4];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 004c: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0050);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L0050:
+    AOT_BLOCK(0x0050, 1);
+    // 0050: mov r4, (r1)+
+    {
+        src = r[4];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0052, L0052);
+L0052:
+    AOT_BLOCK(0x0052, 1);
+    // 0052: br 005c
+    AOT_GOTO(0x005c, L005c);
+L0054:
+    AOT_BLOCK(0x0054, 3);
+    // 0054: clr (r1)+
+    {
+        a = r[1];
+        r[1] += 2;
+        WR16(a, 0);
+    }
+    // 0056: clr (r1)+
+    {
+        a = r[1];
+        r[1] += 2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0058: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x005c);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L005c:
+    AOT_BLOCK(0x005c, 1);
+    // 005c: jsr pc, 025e
+    {
+        a = 0x025e;
+        r[6] -= 2;
+        WR16(r[6], 0x0060);
+    }
+    AOT_GOTO(0x025e, L025e);
+L0060:
+    AOT_BLOCK(0x0060, 1);
+    // 0060: br 0018
+    AOT_GOTO(0x0018, L0018);
+L0062:
+    AOT_BLOCK(0x0062, 3);
+    // 0062: mov r1, 256c
+    {
+        src = r[1];
+        b = 0x256c;
+        WR16(b, src);
+    }
+    // 0066: movb 257a, 257c
+    {
+        a = 0x257a;
+        src = RD8(a);
+        b = 0x257c;
+        WR8(b, src);
+    }
+    // 006c: clr 257e
+    {
+        a = 0x257e;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0070, L0070);
+L0070:
+    AOT_BLOCK(0x0070, 1);
+    // 0070: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0074);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L0074:
+    AOT_BLOCK(0x0074, 1);
+    // 0074: bvs 0088
+    if (V)
+        AOT_GOTO(0x0088, L0088);
+    AOT_GOTO(0x0076, L0076);
+L0076:
+    AOT_BLOCK(0x0076, 1);
+    // 0076: add $19, r4
+    {
+        src = uint16_t(0x0019);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x007a, L007a);
+L007a:
+    AOT_BLOCK(0x007a, 2);
+    // 007a: mov r4, (r1)+
+    {
+        src = r[4];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 007c: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0080);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L0080:
+    AOT_BLOCK(0x0080, 2);
+    // 0080: mov r4, (r1)+
+    {
+        src = r[4];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0082: jsr pc, 025e
+    {
+        a = 0x025e;
+        r[6] -= 2;
+        WR16(r[6], 0x0086);
+    }
+    AOT_GOTO(0x025e, L025e);
+L0086:
+    AOT_BLOCK(0x0086, 1);
+    // 0086: br 0070
+    AOT_GOTO(0x0070, L0070);
+L0088:
+    AOT_BLOCK(0x0088, 3);
+    // 0088: mov r1, 29fa
+    {
+        src = r[1];
+        b = 0x29fa;
+        WR16(b, src);
+    }
+    // 008c: mov $8000, (r1)+
+    {
+        src = uint16_t(0x8000);
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0090: jsr pc, 0278
+    {
+        a = 0x0278;
+        r[6] -= 2;
+        WR16(r[6], 0x0094);
+    }
+    AOT_GOTO(0x0278, L0278);
+L0094:
+    AOT_BLOCK(0x0094, 1);
+    // 0094: jsr pc, 0440
+    {
+        a = 0x0440;
+        r[6] -= 2;
+        WR16(r[6], 0x0098);
+    }
+    AOT_GOTO(0x0440, L0440);
+L0098:
+    AOT_BLOCK(0x0098, 2);
+    // 0098: cmp 2034, $1ff
+    {
+        a = 0x2034;
+        src = RD16(a);
+        dst = uint16_t(0x01ff);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 009e: beq 00a4
+    if (Z)
+        AOT_GOTO(0x00a4, L00a4);
+    AOT_GOTO(0x00a0, L00a0);
+L00a0:
+    AOT_BLOCK(0x00a0, 1);
+    // 00a0: jmp 2004
+    {
+        a = 0x2004;
+    }
+    AOT_JUMP(0x2004);
+L00a4:
+    AOT_BLOCK(0x00a4, 1);
+    // 00a4: clr 209a
+    {
+        a = 0x209a;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x00a8, L00a8);
+L00a8:
+    AOT_BLOCK(0x00a8, 2);
+    // 00a8: mov $2, 2098
+    {
+        src = uint16_t(0x0002);
+        b = 0x2098;
+        WR16(b, src);
+    }
+    // 00ae: mov $0, 209e
+    {
+        src = uint16_t(0x0000);
+        b = 0x209e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00b4, L00b4);
+L00b4:
+    AOT_BLOCK(0x00b4, 1);
+    // 00b4: clr 2568
+    {
+        a = 0x2568;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x00b8, L00b8);
+L00b8:
+    AOT_BLOCK(0x00b8, 1);
+    // 00b8: movb 257c, r0
+    {
+        a = 0x257c;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 00bc: sys 6
+    AOT_INTERP(0x00bc);
+L00be:
+    AOT_BLOCK(0x00be, 1);
+    // 00be: jsr r5, 029e
+    {
+        a = 0x029e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x00c2;
+    }
+    AOT_GOTO(0x029e, L029e);
+L00c0:
+    AOT_BLOCK(0x00c0, 1);
+    // 00c0: br 007a
+    AOT_GOTO(0x007a, L007a);
+L00c2:
+    AOT_BLOCK(0x00c2, 1);
+    // 00c2: cmp r1, -(r2)
+    {
+        src = r[1];
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x00c4, L00c4);
+L00c4:
+    AOT_BLOCK(0x00c4, 3);
+    // 00c4: movb r0, 257c
+    {
+        src = uint8_t(r[0]);
+        b = 0x257c;
+        WR8(b, src);
+    }
+    // 00c8: clr 257e
+    {
+        a = 0x257e;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 00cc: jsr pc, 0278
+    {
+        a = 0x0278;
+        r[6] -= 2;
+        WR16(r[6], 0x00d0);
+    }
+    AOT_GOTO(0x0278, L0278);
+L00c6:
+    AOT_BLOCK(0x00c6, 3);
+    // 00c6: cmp (r2)+, a37(r4)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = uint16_t(r[4] + 2615);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 00ca: cmp (r2)+, 9f7(r2)
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = uint16_t(r[2] + 2551);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00ce: br 0020
+    AOT_GOTO(0x0020, L0020);
+L00d0:
+    AOT_BLOCK(0x00d0, 13);
+    // 00d0: inc 29f8
+    {
+        a = 0x29f8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 00d4: inc 2072
+    {
+        a = 0x2072;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 00d8: bic $1, 2072
+    {
+        src = uint16_t(0x0001);
+        b = 0x2072;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 00de: mov 206e, r1
+    {
+        a = 0x206e;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 00e2: inc r1
+    {
+        val = int(int16_t(r[1])) + 1;
+        r[1] = val;
+    }
+    // 00e4: bic $1, r1
+    {
+        src = uint16_t(0x0001);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 00e8: mov r1, 206e
+    {
+        src = r[1];
+        b = 0x206e;
+        WR16(b, src);
+    }
+    // 00ec: mov 2070, r2
+    {
+        a = 0x2070;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 00f0: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 00f2: bic $1, r2
+    {
+        src = uint16_t(0x0001);
+        dst = r[2];
+        val = (~src) & dst;
+        r[2] = val;
+    }
+    // 00f6: mov r2, 2070
+    {
+        src = r[2];
+        b = 0x2070;
+        WR16(b, src);
+    }
+    // 00fa: mov r1, r3
+    {
+        src = r[1];
+        r[3] = src;
+    }
+    // 00fc: mov r3, 2576
+    {
+        src = r[3];
+        b = 0x2576;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0100, L0100);
+L00da:
+    // 00da: wait
+    AOT_INTERP(0x00da);
+L00dc:
+    AOT_BLOCK(0x00dc, 10);
+    // 00dc: mov *1dc1(sp), (r4)+
+    {
+        a = RD16(r[6] + 7617);
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        WR16(b, src);
+    }
+    // 00e0: mov *a81(sp), (r4)
+    {
+        a = RD16(r[6] + 2689);
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 00e4: bic $1, r1
+    {
+        src = uint16_t(0x0001);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 00e8: mov r1, 206e
+    {
+        src = r[1];
+        b = 0x206e;
+        WR16(b, src);
+    }
+    // 00ec: mov 2070, r2
+    {
+        a = 0x2070;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 00f0: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 00f2: bic $1, r2
+    {
+        src = uint16_t(0x0001);
+        dst = r[2];
+        val = (~src) & dst;
+        r[2] = val;
+    }
+    // 00f6: mov r2, 2070
+    {
+        src = r[2];
+        b = 0x2070;
+        WR16(b, src);
+    }
+    // 00fa: mov r1, r3
+    {
+        src = r[1];
+        r[3] = src;
+    }
+    // 00fc: mov r3, 2576
+    {
+        src = r[3];
+        b = 0x2576;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0100, L0100);
+L0100:
+    AOT_BLOCK(0x0100, 24);
+    // 0100: mov r3, 2572
+    {
+        src = r[3];
+        b = 0x2572;
+        WR16(b, src);
+    }
+    // 0104: add r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 0106: mov r3, 2578
+    {
+        src = r[3];
+        b = 0x2578;
+        WR16(b, src);
+    }
+    // 010a: mov r3, 2574
+    {
+        src = r[3];
+        b = 0x2574;
+        WR16(b, src);
+    }
+    // 010e: clr r0
+    {
+        r[0] = 0;
+    }
+    // 0110: asl r3
+    {
+        src = r[3];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[3] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0112: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+    }
+    // 0114: add $10, r3
+    {
+        src = uint16_t(0x0010);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0118: adc r0
+    {
+        val = int(int16_t(r[0])) + int(C);
+        r[0] = val;
+    }
+    // 011a: mov r3, 2096
+    {
+        src = r[3];
+        b = 0x2096;
+        WR16(b, src);
+    }
+    // 011e: mov r0, 2094
+    {
+        src = r[0];
+        b = 0x2094;
+        WR16(b, src);
+    }
+    // 0122: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        C = dst < src;
+    }
+    // 0124: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+    }
+    // 0126: mov r3, 208e
+    {
+        src = r[3];
+        b = 0x208e;
+        WR16(b, src);
+    }
+    // 012a: mov r0, 208c
+    {
+        src = r[0];
+        b = 0x208c;
+        WR16(b, src);
+    }
+    // 012e: sub r1, r3
+    {
+        src = r[1];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        C = dst < src;
+    }
+    // 0130: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+    }
+    // 0132: mov r3, 208a
+    {
+        src = r[3];
+        b = 0x208a;
+        WR16(b, src);
+    }
+    // 0136: mov r0, 2088
+    {
+        src = r[0];
+        b = 0x2088;
+        WR16(b, src);
+    }
+    // 013a: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        C = dst < src;
+    }
+    // 013c: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+        C = C && val == -1;
+    }
+    // 013e: mov r0, 2080
+    {
+        src = r[0];
+        b = 0x2080;
+        WR16(b, src);
+    }
+    // 0142: mov r3, 2082
+    {
+        src = r[3];
+        b = 0x2082;
+        WR16(b, src);
+    }
+    // 0146: mov $29fc, r1
+    {
+        src = uint16_t(0x29fc);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x014a, L014a);
+L014a:
+    AOT_BLOCK(0x014a, 1);
+    // 014a: jsr pc, 0234
+    {
+        a = 0x0234;
+        r[6] -= 2;
+        WR16(r[6], 0x014e);
+    }
+    AOT_GOTO(0x0234, L0234);
+L014e:
+    AOT_BLOCK(0x014e, 3);
+    // 014e: add $4, r1
+    {
+        src = uint16_t(0x0004);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0152: cmp r1, 29fa
+    {
+        src = r[1];
+        b = 0x29fa;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0156: bcs 014a
+    if (C)
+        AOT_GOTO(0x014a, L014a);
+    AOT_GOTO(0x0158, L0158);
+L0158:
+    AOT_BLOCK(0x0158, 3);
+    // 0158: clr r0
+    {
+        r[0] = 0;
+    }
+    // 015a: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 015c: jsr r5, 05e8
+    {
+        a = 0x05e8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0160;
+    }
+    AOT_GOTO(0x05e8, L05e8);
+L0160:
+    AOT_BLOCK(0x0160, 4);
+    // 0160: cmp $1dc0, -(r4)
+    {
+        src = uint16_t(0x1dc0);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0164: mov *1dc1(r4), -(r2)
+    {
+        a = RD16(r[4] + 7617);
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        WR16(b, src);
+    }
+    // 0168: mov *977(r4), -(r0)
+    {
+        a = RD16(r[4] + 2423);
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 016c: bge 0262
+    if (!(N ^ V))
+        AOT_GOTO(0x0262, L0262);
+    AOT_GOTO(0x016e, L016e);
+L016e:
+    AOT_BLOCK(0x016e, 1);
+    // 016e: cmp *$15c2, *-(r4)
+    {
+        a = 0x15c2;
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0172: (undefined)
+    AOT_INTERP(0x0172);
+L0174:
+    AOT_BLOCK(0x0174, 1);
+    // 0174: mov $206c, r1
+    {
+        src = uint16_t(0x206c);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0178, L0178);
+L0178:
+    AOT_BLOCK(0x0178, 2);
+    // 0178: mov (r1)+, r0
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 017a: jsr r5, 060e
+    {
+        a = 0x060e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x017e;
+    }
+    AOT_GOTO(0x060e, L060e);
+L017e:
+    AOT_BLOCK(0x017e, 2);
+    // 017e: cmp $ac2, -(r4)
+    {
+        src = uint16_t(0x0ac2);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0182: bne 0178
+    if (!Z)
+        AOT_GOTO(0x0178, L0178);
+    AOT_GOTO(0x0184, L0184);
+L0184:
+    AOT_BLOCK(0x0184, 1);
+    // 0184: jsr pc, 0440
+    {
+        a = 0x0440;
+        r[6] -= 2;
+        WR16(r[6], 0x0188);
+    }
+    AOT_GOTO(0x0440, L0440);
+L0188:
+    AOT_BLOCK(0x0188, 1);
+    // 0188: jsr r5, 0636
+    {
+        a = 0x0636;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x018c;
+    }
+    AOT_GOTO(0x0636, L0636);
+L018c:
+    AOT_BLOCK(0x018c, 2);
+    // 018c: cmp $977, -(r4)
+    {
+        src = uint16_t(0x0977);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0190: bge 00da
+    if (!(N ^ V))
+        AOT_GOTO(0x00da, L00da);
+    AOT_GOTO(0x0192, L0192);
+L0192:
+    AOT_BLOCK(0x0192, 3);
+    // 0192: cmp *$1dc0, *-(r4)
+    {
+        a = 0x1dc0;
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0196: cmp (pc), *-(r2)
+    {
+        src = uint16_t(0x1037);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0198: mov r0, 257c
+    {
+        src = r[0];
+        b = 0x257c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 019c: sys 13
+    AOT_INTERP(0x019c);
+L0194:
+    AOT_BLOCK(0x0194, 2);
+    // 0194: mov 2582, r0
+    {
+        a = 0x2582;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0198: mov r0, 257c
+    {
+        src = r[0];
+        b = 0x257c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 019c: sys 13
+    AOT_INTERP(0x019c);
+L019e:
+    // 019e: halt
+    AOT_INTERP(0x019e);
+L01a0:
+    // 01a0: halt
+    AOT_INTERP(0x01a0);
+L01a2:
+    // 01a2: halt
+    AOT_INTERP(0x01a2);
+L01a4:
+    AOT_BLOCK(0x01a4, 3);
+    // 01a4: clr 257e
+    {
+        a = 0x257e;
+        WR16(a, 0);
+        C = false;
+    }
+    // 01a8: mov 2094, r0
+    {
+        a = 0x2094;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01ac: mov 2096, r1
+    {
+        a = 0x2096;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x01b0, L01b0);
+L01a6:
+    AOT_BLOCK(0x01a6, 3);
+    // 01a6: cmp (pc), (sp)+
+    {
+        src = uint16_t(0x1dc0);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 01a8: mov 2094, r0
+    {
+        a = 0x2094;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01ac: mov 2096, r1
+    {
+        a = 0x2096;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x01b0, L01b0);
+L01b0:
+    AOT_BLOCK(0x01b0, 1);
+    // 01b0: jsr r5, 05e8
+    {
+        a = 0x05e8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01b4;
+    }
+    AOT_GOTO(0x05e8, L05e8);
+L01b4:
+    AOT_BLOCK(0x01b4, 2);
+    // 01b4: cmp $15c1, -(r4)
+    {
+        src = uint16_t(0x15c1);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 01b8: cmp -(pc), *9f7(r4)
+    {
+        src = uint16_t(0x0000);
+        b = RD16(r[4] + 2551);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x01bc, L01bc);
+L01ba:
+    AOT_BLOCK(0x01ba, 1);
+    // 01ba: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x01be);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L01bc:
+    AOT_BLOCK(0x01bc, 1);
+    // 01bc: blt 01d6
+    if (N ^ V)
+        AOT_GOTO(0x01d6, L01d6);
+    AOT_GOTO(0x01be, L01be);
+L01be:
+    AOT_BLOCK(0x01be, 1);
+    // 01be: bvs 0206
+    if (V)
+        AOT_GOTO(0x0206, L0206);
+    AOT_GOTO(0x01c0, L01c0);
+L01c0:
+    AOT_BLOCK(0x01c0, 2);
+    // 01c0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01c2: jsr r5, 060e
+    {
+        a = 0x060e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01c6;
+    }
+    AOT_GOTO(0x060e, L060e);
+L01c6:
+    AOT_BLOCK(0x01c6, 2);
+    // 01c6: cmp $9f7, -(r4)
+    {
+        src = uint16_t(0x09f7);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01ca: bge 01c8
+    if (!(N ^ V))
+        AOT_GOTO(0x01c8, L01c8);
+    AOT_GOTO(0x01cc, L01cc);
+L01c8:
+    AOT_BLOCK(0x01c8, 1);
+    // 01c8: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x01cc);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L01cc:
+    AOT_BLOCK(0x01cc, 2);
+    // 01cc: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01ce: jsr r5, 060e
+    {
+        a = 0x060e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01d2;
+    }
+    AOT_GOTO(0x060e, L060e);
+L01d2:
+    AOT_BLOCK(0x01d2, 1);
+    // 01d2: cmp $9f7, -(r4)
+    {
+        src = uint16_t(0x09f7);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x01d6, L01d6);
+L01d6:
+    AOT_BLOCK(0x01d6, 1);
+    // 01d6: bge 01bc
+    if (!(N ^ V))
+        AOT_GOTO(0x01bc, L01bc);
+    AOT_GOTO(0x01d8, L01d8);
+L01d8:
+    AOT_BLOCK(0x01d8, 2);
+    // 01d8: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01da: jsr r5, 060e
+    {
+        a = 0x060e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01de;
+    }
+    AOT_GOTO(0x060e, L060e);
+L01de:
+    AOT_BLOCK(0x01de, 2);
+    // 01de: cmp $9f7, -(r4)
+    {
+        src = uint16_t(0x09f7);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01e2: bge 01b0
+    if (!(N ^ V))
+        AOT_GOTO(0x01b0, L01b0);
+    AOT_GOTO(0x01e4, L01e4);
+L01e4:
+    AOT_BLOCK(0x01e4, 1);
+    // 01e4: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x01e6, L01e6);
+L01e6:
+    AOT_BLOCK(0x01e6, 1);
+    // 01e6: jsr r5, 060e
+    {
+        a = 0x060e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01ea;
+    }
+    AOT_GOTO(0x060e, L060e);
+L01ea:
+    AOT_BLOCK(0x01ea, 2);
+    // 01ea: cmp $1440, -(r4)
+    {
+        src = uint16_t(0x1440);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01ee: jsr r5, 060e
+    {
+        a = 0x060e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01f2;
+    }
+    AOT_GOTO(0x060e, L060e);
+L01f2:
+    AOT_BLOCK(0x01f2, 2);
+    // 01f2: cmp $1440, -(r4)
+    {
+        src = uint16_t(0x1440);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01f6: jsr r5, 060e
+    {
+        a = 0x060e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x01fa;
+    }
+    AOT_GOTO(0x060e, L060e);
+L01fa:
+    AOT_BLOCK(0x01fa, 2);
+    // 01fa: cmp $9f7, -(r4)
+    {
+        src = uint16_t(0x09f7);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 01fe: bge 0194
+    if (!(N ^ V))
+        AOT_GOTO(0x0194, L0194);
+    AOT_GOTO(0x0200, L0200);
+L0200:
+    AOT_BLOCK(0x0200, 1);
+    // 0200: jsr pc, 06ca
+    {
+        a = 0x06ca;
+        r[6] -= 2;
+        WR16(r[6], 0x0204);
+    }
+    AOT_GOTO(0x06ca, L06ca);
+L0204:
+    AOT_BLOCK(0x0204, 1);
+    // 0204: br 01ba
+    AOT_GOTO(0x01ba, L01ba);
+L0206:
+    AOT_BLOCK(0x0206, 1);
+    // 0206: jsr r5, 0636
+    {
+        a = 0x0636;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x020a;
+    }
+    AOT_GOTO(0x0636, L0636);
+L020a:
+    AOT_BLOCK(0x020a, 2);
+    // 020a: cmp $77, -(r4)
+    {
+        src = uint16_t(0x0077);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 020e: mov 2157, 0(r4)
+    {
+        a = 0x2157;
+        src = RD16(a);
+        b = uint16_t(r[4] + 0);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0214, L0214);
+L0210:
+    AOT_BLOCK(0x0210, 1);
+    // 0210: mov *0(r5), r5
+    {
+        a = RD16(r[5] + 0);
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0214, L0214);
+L0214:
+    AOT_BLOCK(0x0214, 2);
+    // 0214: movb (r5)+, 2594
+    {
+        a = r[5];
+        r[5] += 1;
+        src = RD8(a);
+        b = 0x2594;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0218: beq 0226
+    if (Z)
+        AOT_GOTO(0x0226, L0226);
+    AOT_GOTO(0x021a, L021a);
+L021a:
+    AOT_BLOCK(0x021a, 1);
+    // 021a: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 021e: sys 4
+    AOT_INTERP(0x021e);
+L0220:
+    AOT_BLOCK(0x0220, 1);
+    // 0220: cmp (sp)+, (r4)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0222, L0222);
+L0222:
+    // 0222: wait
+    AOT_INTERP(0x0222);
+L0224:
+    AOT_BLOCK(0x0224, 1);
+    // 0224: br 0214
+    AOT_GOTO(0x0214, L0214);
+L0226:
+    AOT_BLOCK(0x0226, 1);
+    // 0226: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x022a, L022a);
+L0228:
+    // 0228: wait
+    AOT_INTERP(0x0228);
+L022a:
+    // 022a: sys 4
+    AOT_INTERP(0x022a);
+L022c:
+    // 022c: (undefined)
+    AOT_INTERP(0x022c);
+L022e:
+    // 022e: rti
+    AOT_INTERP(0x022e);
+L0230:
+    AOT_BLOCK(0x0230, 1);
+    // 0230: jmp 2000
+    {
+        a = 0x2000;
+    }
+    AOT_JUMP(0x2000);
+L0232:
+    AOT_BLOCK(0x0232, 2);
+    // 0232: mov 9476, (r4)
+    {
+        a = 0x9476;
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0236: bne 023c
+    if (!Z)
+        AOT_GOTO(0x023c, L023c);
+    AOT_GOTO(0x0238, L0238);
+L0234:
+    AOT_BLOCK(0x0234, 2);
+    // 0234: movb (r1), r0
+    {
+        a = r[1];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0236: bne 023c
+    if (!Z)
+        AOT_GOTO(0x023c, L023c);
+    AOT_GOTO(0x0238, L0238);
+L0238:
+    AOT_BLOCK(0x0238, 1);
+    // 0238: bisb 256e, (r1)
+    {
+        a = 0x256e;
+        src = RD8(a);
+        b = r[1];
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x023c, L023c);
+L023c:
+    AOT_BLOCK(0x023c, 1);
+    // 023c: bic $ffe0, r0
+    {
+        src = uint16_t(0xffe0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0240, L0240);
+L0240:
+    AOT_BLOCK(0x0240, 2);
+    // 0240: cmp r0, $5
+    {
+        src = r[0];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0244: bcc 025c
+    if (!C)
+        AOT_GOTO(0x025c, L025c);
+    AOT_GOTO(0x0246, L0246);
+L0246:
+    AOT_BLOCK(0x0246, 2);
+    // 0246: cmp r0, $3
+    {
+        src = r[0];
+        dst = uint16_t(0x0003);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 024a: bcs 025c
+    if (C)
+        AOT_GOTO(0x025c, L025c);
+    AOT_GOTO(0x024c, L024c);
+L024c:
+    AOT_BLOCK(0x024c, 1);
+    // 024c: beq 0256
+    if (Z)
+        AOT_GOTO(0x0256, L0256);
+    AOT_GOTO(0x024e, L024e);
+L024e:
+    AOT_BLOCK(0x024e, 2);
+    // 024e: add 2578, 2(r1)
+    {
+        a = 0x2578;
+        src = RD16(a);
+        b = uint16_t(r[1] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0254: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0256:
+    AOT_BLOCK(0x0256, 1);
+    // 0256: add 2576, 2(r1)
+    {
+        a = 0x2576;
+        src = RD16(a);
+        b = uint16_t(r[1] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x025c, L025c);
+L025c:
+    AOT_BLOCK(0x025c, 1);
+    // 025c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L025e:
+    AOT_BLOCK(0x025e, 2);
+    // 025e: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0260: add $10, r1
+    {
+        src = uint16_t(0x0010);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0264, L0264);
+L0262:
+    // 0262: (undefined)
+    AOT_INTERP(0x0262);
+L0264:
+    AOT_BLOCK(0x0264, 2);
+    // 0264: cmp r1, 2042
+    {
+        src = r[1];
+        b = 0x2042;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0268: bcs 0274
+    if (C)
+        AOT_GOTO(0x0274, L0274);
+    AOT_GOTO(0x026a, L026a);
+L026a:
+    AOT_BLOCK(0x026a, 1);
+    // 026a: add $200, 2042
+    {
+        src = uint16_t(0x0200);
+        b = 0x2042;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0270: sys 0
+    AOT_INTERP(0x0270);
+L0272:
+    AOT_BLOCK(0x0272, 1);
+    // 0272: cmp r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0274, L0274);
+L0274:
+    AOT_BLOCK(0x0274, 1);
+    // 0274: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0276, L0276);
+L0276:
+    AOT_BLOCK(0x0276, 1);
+    // 0276: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0278:
+    AOT_BLOCK(0x0278, 1);
+    // 0278: mov $25b4, r4
+    {
+        src = uint16_t(0x25b4);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x027c, L027c);
+L027a:
+    AOT_BLOCK(0x027a, 3);
+    // 027a: cmp (sp)+, a14(r4)
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = uint16_t(r[4] + 2580);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 027e: cmp r4, $25dc
+    {
+        src = r[4];
+        dst = uint16_t(0x25dc);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0282: bcs 027c
+    if (C)
+        AOT_GOTO(0x027c, L027c);
+    AOT_GOTO(0x0284, L0284);
+L027c:
+    AOT_BLOCK(0x027c, 3);
+    // 027c: clr (r4)+
+    {
+        a = r[4];
+        r[4] += 2;
+        WR16(a, 0);
+    }
+    // 027e: cmp r4, $25dc
+    {
+        src = r[4];
+        dst = uint16_t(0x25dc);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0282: bcs 027c
+    if (C)
+        AOT_GOTO(0x027c, L027c);
+    AOT_GOTO(0x0284, L0284);
+L0284:
+    AOT_BLOCK(0x0284, 3);
+    // 0284: mov 2580, 257c
+    {
+        a = 0x2580;
+        src = RD16(a);
+        b = 0x257c;
+        WR16(b, src);
+    }
+    // 028a: clr 257e
+    {
+        a = 0x257e;
+        WR16(a, 0);
+    }
+    // 028e: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0290, L0290);
+L0290:
+    AOT_BLOCK(0x0290, 1);
+    // 0290: jsr pc, 05c0
+    {
+        a = 0x05c0;
+        r[6] -= 2;
+        WR16(r[6], 0x0294);
+    }
+    AOT_GOTO(0x05c0, L05c0);
+L0294:
+    AOT_BLOCK(0x0294, 3);
+    // 0294: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+    }
+    // 0296: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 029a: blt 0290
+    if (N ^ V)
+        AOT_GOTO(0x0290, L0290);
+    AOT_GOTO(0x029c, L029c);
+L029c:
+    AOT_BLOCK(0x029c, 1);
+    // 029c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L029e:
+    AOT_BLOCK(0x029e, 1);
+    // 029e: mov *0(r5), 2046
+    {
+        a = RD16(r[5] + 0);
+        src = RD16(a);
+        b = 0x2046;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02a4: sys 0
+    AOT_INTERP(0x02a4);
+L02a6:
+    AOT_BLOCK(0x02a6, 1);
+    // 02a6: cmp r1, r4
+    {
+        src = r[1];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x02a8, L02a8);
+L02a8:
+    AOT_BLOCK(0x02a8, 1);
+    // 02a8: bcs 02ae
+    if (C)
+        AOT_GOTO(0x02ae, L02ae);
+    AOT_GOTO(0x02aa, L02aa);
+L02aa:
+    AOT_BLOCK(0x02aa, 1);
+    // 02aa: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x02ac, L02ac);
+L02ac:
+    AOT_BLOCK(0x02ac, 1);
+    // 02ac: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L02ae:
+    AOT_BLOCK(0x02ae, 1);
+    // 02ae: jmp 0210
+    {
+        a = 0x0210;
+    }
+    AOT_GOTO(0x0210, L0210);
+L02b2:
+    AOT_BLOCK(0x02b2, 2);
+    // 02b2: cmp 2098, $4
+    {
+        a = 0x2098;
+        src = RD16(a);
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02b8: beq 0372
+    if (Z)
+        AOT_GOTO(0x0372, L0372);
+    AOT_GOTO(0x02ba, L02ba);
+L02ba:
+    AOT_BLOCK(0x02ba, 2);
+    // 02ba: bit $1, 209a
+    {
+        src = uint16_t(0x0001);
+        b = 0x209a;
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 02c0: bne 0364
+    if (!Z)
+        AOT_GOTO(0x0364, L0364);
+    AOT_GOTO(0x02c2, L02c2);
+L02c2:
+    AOT_BLOCK(0x02c2, 3);
+    // 02c2: add $2, 209a
+    {
+        src = uint16_t(0x0002);
+        b = 0x209a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 02c8: tstb 29f8
+    {
+        a = 0x29f8;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 02cc: beq 0362
+    if (Z)
+        AOT_GOTO(0x0362, L0362);
+    AOT_GOTO(0x02ce, L02ce);
+L02ce:
+    AOT_BLOCK(0x02ce, 6);
+    // 02ce: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 02d0: rol r3
+    {
+        src = r[3];
+        val = uint16_t(src << 1) | (C ? 1 : 0);
+        r[3] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 02d2: adc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+    }
+    // 02d4: asr r3
+    {
+        src = r[3];
+        val = int16_t(src) >> 1;
+        r[3] = val;
+    }
+    // 02d6: cmp r3, $20
+    {
+        src = r[3];
+        dst = uint16_t(0x0020);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02da: bne 02f2
+    if (!Z)
+        AOT_GOTO(0x02f2, L02f2);
+    AOT_GOTO(0x02dc, L02dc);
+L02dc:
+    AOT_BLOCK(0x02dc, 6);
+    // 02dc: mov $1b6, 2034
+    {
+        src = uint16_t(0x01b6);
+        b = 0x2034;
+        WR16(b, src);
+    }
+    // 02e2: mov 2590, r3
+    {
+        a = 0x2590;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 02e6: sub $29fc, r3
+    {
+        src = uint16_t(0x29fc);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 02ea: asl r3
+    {
+        src = r[3];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[3] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 02ec: bis $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 02f0: br 0336
+    AOT_GOTO(0x0336, L0336);
+L02f2:
+    AOT_BLOCK(0x02f2, 3);
+    // 02f2: bic $20, r3
+    {
+        src = uint16_t(0x0020);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+    }
+    // 02f6: cmp r3, $5
+    {
+        src = r[3];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02fa: bcs 0312
+    if (C)
+        AOT_GOTO(0x0312, L0312);
+    AOT_GOTO(0x02fc, L02fc);
+L02fc:
+    AOT_BLOCK(0x02fc, 1);
+    // 02fc: cmp r3, $1b
+    {
+        src = r[3];
+        dst = uint16_t(0x001b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0300, L0300);
+L0300:
+    AOT_BLOCK(0x0300, 1);
+    // 0300: beq 0308
+    if (Z)
+        AOT_GOTO(0x0308, L0308);
+    AOT_GOTO(0x0302, L0302);
+L0302:
+    AOT_BLOCK(0x0302, 2);
+    // 0302: cmp r3, $1c
+    {
+        src = r[3];
+        dst = uint16_t(0x001c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0306: bne 030e
+    if (!Z)
+        AOT_GOTO(0x030e, L030e);
+    AOT_GOTO(0x0308, L0308);
+L0308:
+    AOT_BLOCK(0x0308, 1);
+    // 0308: jsr r5, 03d4
+    {
+        a = 0x03d4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x030c;
+    }
+    AOT_GOTO(0x03d4, L03d4);
+L030c:
+    AOT_BLOCK(0x030c, 1);
+    // 030c: jmp 15c3(r2)
+    {
+        a = uint16_t(r[2] + 5571);
+    }
+    AOT_JUMP(a);
+L030e:
+    AOT_BLOCK(0x030e, 1);
+    // 030e: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0312, L0312);
+L0312:
+    AOT_BLOCK(0x0312, 2);
+    // 0312: cmp r3, $2
+    {
+        src = r[3];
+        dst = uint16_t(0x0002);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0316: bcs 0328
+    if (C)
+        AOT_GOTO(0x0328, L0328);
+    AOT_GOTO(0x0318, L0318);
+L0318:
+    AOT_BLOCK(0x0318, 2);
+    // 0318: cmp r3, $4
+    {
+        src = r[3];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 031c: bhi 0328
+    if (!(C | Z))
+        AOT_GOTO(0x0328, L0328);
+    AOT_GOTO(0x031e, L031e);
+L031e:
+    AOT_BLOCK(0x031e, 2);
+    // 031e: tst (sp)
+    {
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0320: bne 0330
+    if (!Z)
+        AOT_GOTO(0x0330, L0330);
+    AOT_GOTO(0x0322, L0322);
+L0322:
+    AOT_BLOCK(0x0322, 2);
+    // 0322: add 209e, r2
+    {
+        a = 0x209e;
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0326: br 0330
+    AOT_GOTO(0x0330, L0330);
+L0328:
+    AOT_BLOCK(0x0328, 2);
+    // 0328: tst (sp)
+    {
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 032a: beq 0330
+    if (Z)
+        AOT_GOTO(0x0330, L0330);
+    AOT_GOTO(0x032c, L032c);
+L032c:
+    AOT_BLOCK(0x032c, 1);
+    // 032c: sub 209e, r2
+    {
+        a = 0x209e;
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0330, L0330);
+L0330:
+    AOT_BLOCK(0x0330, 2);
+    // 0330: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0332: bpl 0336
+    if (!N)
+        AOT_GOTO(0x0336, L0336);
+    AOT_GOTO(0x0334, L0334);
+L0334:
+    AOT_BLOCK(0x0334, 1);
+    // 0334: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0336, L0336);
+L0336:
+    AOT_BLOCK(0x0336, 4);
+    // 0336: asl r3
+    {
+        src = r[3];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[3] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0338: bis (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+    }
+    // 033a: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 033c: jsr r5, 060e
+    {
+        a = 0x060e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0340;
+    }
+    AOT_GOTO(0x060e, L060e);
+L0340:
+    AOT_BLOCK(0x0340, 2);
+    // 0340: cmp $1dc0, -(r4)
+    {
+        src = uint16_t(0x1dc0);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0344: mov 65f0(r4), -(r2)
+    {
+        a = uint16_t(r[4] + 26096);
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0348: rti
+    AOT_INTERP(0x0348);
+L034a:
+    // 034a: rti
+    AOT_INTERP(0x034a);
+L034c:
+    AOT_BLOCK(0x034c, 3);
+    // 034c: adc (r0)
+    {
+        a = r[0];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        C = C && val == 0;
+    }
+    // 034e: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0350: jsr r5, 060e
+    {
+        a = 0x060e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0354;
+    }
+    AOT_GOTO(0x060e, L060e);
+L0354:
+    AOT_BLOCK(0x0354, 2);
+    // 0354: cmp *$1dc0, *-(r4)
+    {
+        a = 0x1dc0;
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0358: mov 65f0(r4), (r0)+
+    {
+        a = uint16_t(r[4] + 26096);
+        src = RD16(a);
+        b = r[0];
+        r[0] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 035c: rti
+    AOT_INTERP(0x035c);
+L035e:
+    // 035e: rti
+    AOT_INTERP(0x035e);
+L0360:
+    AOT_BLOCK(0x0360, 1);
+    // 0360: adc (r0)
+    {
+        a = r[0];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0362, L0362);
+L0362:
+    AOT_BLOCK(0x0362, 1);
+    // 0362: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0364:
+    AOT_BLOCK(0x0364, 1);
+    // 0364: jsr r5, 03d4
+    {
+        a = 0x03d4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0368;
+    }
+    AOT_GOTO(0x03d4, L03d4);
+L0368:
+    // 0368: jmp *-(pc)
+    AOT_INTERP(0x0368);
+L036a:
+    AOT_BLOCK(0x036a, 2);
+    // 036a: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 036c: jsr pc, 037a
+    {
+        a = 0x037a;
+        r[6] -= 2;
+        WR16(r[6], 0x0370);
+    }
+    AOT_GOTO(0x037a, L037a);
+L0370:
+    AOT_BLOCK(0x0370, 1);
+    // 0370: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0372:
+    AOT_BLOCK(0x0372, 1);
+    // 0372: jsr r5, 03d4
+    {
+        a = 0x03d4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0376;
+    }
+    AOT_GOTO(0x03d4, L03d4);
+L0376:
+    AOT_BLOCK(0x0376, 1);
+    // 0376: jmp *87(r0)
+    {
+        a = RD16(r[0] + 135);
+    }
+    AOT_JUMP(a);
+L037a:
+    AOT_BLOCK(0x037a, 2);
+    // 037a: cmp 2098, $4
+    {
+        a = 0x2098;
+        src = RD16(a);
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0380: beq 0372
+    if (Z)
+        AOT_GOTO(0x0372, L0372);
+    AOT_GOTO(0x0382, L0382);
+L0382:
+    AOT_BLOCK(0x0382, 2);
+    // 0382: cmp r3, $1
+    {
+        src = r[3];
+        dst = uint16_t(0x0001);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0386: blos 038e
+    if (C | Z)
+        AOT_GOTO(0x038e, L038e);
+    AOT_GOTO(0x0388, L0388);
+L0388:
+    AOT_BLOCK(0x0388, 1);
+    // 0388: jsr r5, 03d4
+    {
+        a = 0x03d4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x038c;
+    }
+    AOT_GOTO(0x03d4, L03d4);
+L038c:
+    AOT_BLOCK(0x038c, 1);
+    // 038c: jmp -7409(r2)
+    {
+        a = uint16_t(r[2] + -29705);
+    }
+    AOT_JUMP(a);
+L038e:
+    AOT_BLOCK(0x038e, 2);
+    // 038e: tstb 29f8
+    {
+        a = 0x29f8;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0392: beq 03ce
+    if (Z)
+        AOT_GOTO(0x03ce, L03ce);
+    AOT_GOTO(0x0394, L0394);
+L0394:
+    AOT_BLOCK(0x0394, 3);
+    // 0394: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 0396: bit $1, 209a
+    {
+        src = uint16_t(0x0001);
+        b = 0x209a;
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 039c: bne 03c6
+    if (!Z)
+        AOT_GOTO(0x03c6, L03c6);
+    AOT_GOTO(0x039e, L039e);
+L039e:
+    AOT_BLOCK(0x039e, 1);
+    // 039e: jsr r5, 060e
+    {
+        a = 0x060e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x03a2;
+    }
+    AOT_GOTO(0x060e, L060e);
+L03a2:
+    AOT_BLOCK(0x03a2, 2);
+    // 03a2: cmp $a00, -(r4)
+    {
+        src = uint16_t(0x0a00);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03a6: jsr r5, 060e
+    {
+        a = 0x060e;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x03aa;
+    }
+    AOT_GOTO(0x060e, L060e);
+L03aa:
+    AOT_BLOCK(0x03aa, 2);
+    // 03aa: cmp *$1dc0, *-(r4)
+    {
+        a = 0x1dc0;
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 03ae: mov 65f0(r2), *2(r0)
+    {
+        a = uint16_t(r[2] + 26096);
+        src = RD16(a);
+        b = RD16(r[0] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03b4: rti
+    AOT_INTERP(0x03b4);
+L03b6:
+    AOT_BLOCK(0x03b6, 5);
+    // 03b6: adc (r0)
+    {
+        a = r[0];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+    }
+    // 03b8: mov 206a, r0
+    {
+        a = 0x206a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 03bc: add $2, 2(r0)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[0] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 03c2: adc (r0)
+    {
+        a = r[0];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = C && val == 0;
+        V = val == 0x8000;
+    }
+    // 03c4: br 03ce
+    AOT_GOTO(0x03ce, L03ce);
+L03c6:
+    AOT_BLOCK(0x03c6, 2);
+    // 03c6: mov 25e4, r0
+    {
+        a = 0x25e4;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 03ca: movb r2, -1(r0)
+    {
+        src = uint8_t(r[2]);
+        b = uint16_t(r[0] + -1);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03ce, L03ce);
+L03ce:
+    AOT_BLOCK(0x03ce, 2);
+    // 03ce: inc 209a
+    {
+        a = 0x209a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 03d2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L03d4:
+    AOT_BLOCK(0x03d4, 7);
+    // 03d4: mov pc, 2596
+    {
+        src = uint16_t(0x03d6);
+        b = 0x2596;
+        WR16(b, src);
+    }
+    // 03d8: mov $1b6, 2034
+    {
+        src = uint16_t(0x01b6);
+        b = 0x2034;
+        WR16(b, src);
+    }
+    // 03de: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03e0: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03e2: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03e4: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03e6: mov $259a, r1
+    {
+        src = uint16_t(0x259a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03ea, L03ea);
+L03ea:
+    AOT_BLOCK(0x03ea, 2);
+    // 03ea: movb (r1), 2594
+    {
+        a = r[1];
+        src = RD8(a);
+        b = 0x2594;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 03ee: beq 03fe
+    if (Z)
+        AOT_GOTO(0x03fe, L03fe);
+    AOT_GOTO(0x03f0, L03f0);
+L03f0:
+    AOT_BLOCK(0x03f0, 2);
+    // 03f0: clrb (r1)+
+    {
+        a = r[1];
+        r[1] += 1;
+        WR8(a, 0);
+        C = false;
+    }
+    // 03f2: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03f6: sys 4
+    AOT_INTERP(0x03f6);
+L03f8:
+    AOT_BLOCK(0x03f8, 1);
+    // 03f8: cmp (sp)+, (r4)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[4];
+        r[4] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x03fa, L03fa);
+L03fa:
+    // 03fa: wait
+    AOT_INTERP(0x03fa);
+L03fc:
+    AOT_BLOCK(0x03fc, 1);
+    // 03fc: br 03ea
+    AOT_GOTO(0x03ea, L03ea);
+L03fe:
+    AOT_BLOCK(0x03fe, 1);
+    // 03fe: mov (r5)+, r0
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0400, L0400);
+L0400:
+    AOT_BLOCK(0x0400, 4);
+    // 0400: movb r0, 204a
+    {
+        src = uint8_t(r[0]);
+        b = 0x204a;
+        WR8(b, src);
+    }
+    // 0404: mov 25b0, r3
+    {
+        a = 0x25b0;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0408: mov $2050, r0
+    {
+        src = uint16_t(0x2050);
+        r[0] = src;
+    }
+    // 040c: mov $4, r1
+    {
+        src = uint16_t(0x0004);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0410, L0410);
+L0410:
+    AOT_BLOCK(0x0410, 6);
+    // 0410: clr r2
+    {
+        r[2] = 0;
+    }
+    // 0412: div $a, r2
+    {
+        src = int16_t(uint16_t(0x000a));
+        if (src == 0 || abs(int16_t(r[2])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[2]) << 16) | r[3];
+        dst = val / src;
+        r[2] = dst;
+        r[3] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0416: add $30, r3
+    {
+        src = uint16_t(0x0030);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 041a: movb r3, -(r0)
+    {
+        src = uint8_t(r[3]);
+        r[0] -= 1;
+        b = r[0];
+        WR8(b, src);
+    }
+    // 041c: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 041e: sob r1, 8
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x0410, L0410);
+    AOT_GOTO(0x0420, L0420);
+L0420:
+    AOT_BLOCK(0x0420, 1);
+    // 0420: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0424: sys 4
+    AOT_INTERP(0x0424);
+L0426:
+    AOT_BLOCK(0x0426, 1);
+    // 0426: cmp r1, (r2)
+    {
+        src = r[1];
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0428, L0428);
+L0428:
+    // 0428: (undefined)
+    AOT_INTERP(0x0428);
+L042a:
+    AOT_BLOCK(0x042a, 1);
+    // 042a: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x042c, L042c);
+L042c:
+    AOT_BLOCK(0x042c, 1);
+    // 042c: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x042e, L042e);
+L042e:
+    AOT_BLOCK(0x042e, 3);
+    // 042e: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0430: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0432: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0434:
+    AOT_BLOCK(0x0434, 2);
+    // 0434: cmp r0, (r5)+
+    {
+        src = r[0];
+        b = r[5];
+        r[5] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0436: blt 043c
+    if (N ^ V)
+        AOT_GOTO(0x043c, L043c);
+    AOT_GOTO(0x0438, L0438);
+L0438:
+    AOT_BLOCK(0x0438, 2);
+    // 0438: cmp (r5)+, r0
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 043a: blt 043e
+    if (N ^ V)
+        AOT_GOTO(0x043e, L043e);
+    AOT_GOTO(0x043c, L043c);
+L043c:
+    AOT_BLOCK(0x043c, 1);
+    // 043c: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x043e, L043e);
+L043e:
+    AOT_BLOCK(0x043e, 1);
+    // 043e: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0440:
+    AOT_BLOCK(0x0440, 1);
+    // 0440: jsr pc, 06a2
+    {
+        a = 0x06a2;
+        r[6] -= 2;
+        WR16(r[6], 0x0444);
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0444:
+    AOT_BLOCK(0x0444, 2);
+    // 0444: cmp r4, $5
+    {
+        src = r[4];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0448: beq 0480
+    if (Z)
+        AOT_GOTO(0x0480, L0480);
+    AOT_GOTO(0x044a, L044a);
+L044a:
+    AOT_BLOCK(0x044a, 2);
+    // 044a: cmp r4, $3c
+    {
+        src = r[4];
+        dst = uint16_t(0x003c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 044e: beq 0480
+    if (Z)
+        AOT_GOTO(0x0480, L0480);
+    AOT_GOTO(0x0450, L0450);
+L0450:
+    AOT_BLOCK(0x0450, 1);
+    // 0450: jsr pc, 05a8
+    {
+        a = 0x05a8;
+        r[6] -= 2;
+        WR16(r[6], 0x0454);
+    }
+    AOT_GOTO(0x05a8, L05a8);
+L0454:
+    AOT_BLOCK(0x0454, 1);
+    // 0454: br 049e
+    AOT_GOTO(0x049e, L049e);
+L0480:
+    AOT_BLOCK(0x0480, 1);
+    // 0480: jsr pc, 070a
+    {
+        a = 0x070a;
+        r[6] -= 2;
+        WR16(r[6], 0x0484);
+    }
+    AOT_GOTO(0x070a, L070a);
+L0484:
+    AOT_BLOCK(0x0484, 2);
+    // 0484: tstb 29f8
+    {
+        a = 0x29f8;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0488: bne 049e
+    if (!Z)
+        AOT_GOTO(0x049e, L049e);
+    AOT_GOTO(0x048a, L048a);
+L048a:
+    AOT_BLOCK(0x048a, 4);
+    // 048a: movb 2098, r0
+    {
+        a = 0x2098;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 048e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0490: cmp 209a, 206a(r0)
+    {
+        a = 0x209a;
+        src = RD16(a);
+        b = uint16_t(r[0] + 8298);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0496: blos 0592
+    if (C | Z)
+        AOT_GOTO(0x0592, L0592);
+    AOT_GOTO(0x0498, L0498);
+L0498:
+    AOT_BLOCK(0x0498, 1);
+    // 0498: mov 209a, 206a(r0)
+    {
+        a = 0x209a;
+        src = RD16(a);
+        b = uint16_t(r[0] + 8298);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x049e, L049e);
+L049e:
+    AOT_BLOCK(0x049e, 1);
+    // 049e: jmp 0592
+    {
+        a = 0x0592;
+    }
+    AOT_GOTO(0x0592, L0592);
+L0500:
+    AOT_BLOCK(0x0500, 1);
+    // 0500: jmp 19e(r0)
+    {
+        a = uint16_t(r[0] + 414);
+    }
+    AOT_JUMP(a);
+L0570:
+    // 0570: (undefined)
+    AOT_INTERP(0x0570);
+L0572:
+    AOT_BLOCK(0x0572, 1);
+    // 0572: br 0592
+    AOT_GOTO(0x0592, L0592);
+L0592:
+    AOT_BLOCK(0x0592, 2);
+    // 0592: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0596: beq 05a0
+    if (Z)
+        AOT_GOTO(0x05a0, L05a0);
+    AOT_GOTO(0x0598, L0598);
+L0598:
+    AOT_BLOCK(0x0598, 2);
+    // 0598: cmp r4, $4
+    {
+        src = r[4];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 059c: bne 05a4
+    if (!Z)
+        AOT_GOTO(0x05a4, L05a4);
+    AOT_GOTO(0x059e, L059e);
+L059e:
+    AOT_BLOCK(0x059e, 1);
+    // 059e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L05a0:
+    AOT_BLOCK(0x05a0, 1);
+    // 05a0: inc 25b0
+    {
+        a = 0x25b0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x05a4, L05a4);
+L05a4:
+    AOT_BLOCK(0x05a4, 1);
+    // 05a4: jmp 0440
+    {
+        a = 0x0440;
+    }
+    AOT_GOTO(0x0440, L0440);
+L05a8:
+    AOT_BLOCK(0x05a8, 2);
+    // 05a8: cmp r4, $a
+    {
+        src = r[4];
+        dst = uint16_t(0x000a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05ac: beq 05be
+    if (Z)
+        AOT_GOTO(0x05be, L05be);
+    AOT_GOTO(0x05ae, L05ae);
+L05ae:
+    AOT_BLOCK(0x05ae, 2);
+    // 05ae: cmp r4, $3b
+    {
+        src = r[4];
+        dst = uint16_t(0x003b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05b2: beq 05be
+    if (Z)
+        AOT_GOTO(0x05be, L05be);
+    AOT_GOTO(0x05b4, L05b4);
+L05b4:
+    AOT_BLOCK(0x05b4, 2);
+    // 05b4: cmp r4, $4
+    {
+        src = r[4];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05b8: beq 05be
+    if (Z)
+        AOT_GOTO(0x05be, L05be);
+    AOT_GOTO(0x05ba, L05ba);
+L05ba:
+    AOT_BLOCK(0x05ba, 1);
+    // 05ba: add $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x05be, L05be);
+L05be:
+    AOT_BLOCK(0x05be, 1);
+    // 05be: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L05c0:
+    AOT_BLOCK(0x05c0, 4);
+    // 05c0: asl r4
+    {
+        src = r[4];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[4] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 05c2: mov 25c8(r4), r1
+    {
+        a = uint16_t(r[4] + 9672);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 05c6: mov r1, 25b4(r4)
+    {
+        src = r[1];
+        b = uint16_t(r[4] + 9652);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05ca: bne 05d2
+    if (!Z)
+        AOT_GOTO(0x05d2, L05d2);
+    AOT_GOTO(0x05cc, L05cc);
+L05cc:
+    AOT_BLOCK(0x05cc, 2);
+    // 05cc: mov 256c, r1
+    {
+        a = 0x256c;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05d0: br 05d6
+    AOT_GOTO(0x05d6, L05d6);
+L05d2:
+    AOT_BLOCK(0x05d2, 1);
+    // 05d2: add $4, r1
+    {
+        src = uint16_t(0x0004);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x05d6, L05d6);
+L05d6:
+    AOT_BLOCK(0x05d6, 2);
+    // 05d6: cmpb 1(r1), r4
+    {
+        a = uint16_t(r[1] + 1);
+        src = RD8(a);
+        dst = uint8_t(r[4]);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 05da: beq 05e0
+    if (Z)
+        AOT_GOTO(0x05e0, L05e0);
+    AOT_GOTO(0x05dc, L05dc);
+L05dc:
+    AOT_BLOCK(0x05dc, 2);
+    // 05dc: tst (r1)
+    {
+        a = r[1];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05de: bpl 05d2
+    if (!N)
+        AOT_GOTO(0x05d2, L05d2);
+    AOT_GOTO(0x05e0, L05e0);
+L05e0:
+    AOT_BLOCK(0x05e0, 3);
+    // 05e0: mov r1, 25c8(r4)
+    {
+        src = r[1];
+        b = uint16_t(r[4] + 9672);
+        WR16(b, src);
+    }
+    // 05e4: asr r4
+    {
+        src = r[4];
+        val = int16_t(src) >> 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 1) != 0;
+        V = (val < 0) != ((src & 1) != 0);
+    }
+    // 05e6: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L05e8:
+    AOT_BLOCK(0x05e8, 16);
+    // 05e8: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05ea: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05ec: mov (r5)+, r3
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 05ee: mov r1, r2
+    {
+        src = r[1];
+        r[2] = src;
+    }
+    // 05f0: bic $fe00, r1
+    {
+        src = uint16_t(0xfe00);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+    }
+    // 05f4: add r3, r1
+    {
+        src = r[3];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 05f6: add $8, r1
+    {
+        src = uint16_t(0x0008);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 05fa: mov r1, (r3)+
+    {
+        src = r[1];
+        b = r[3];
+        r[3] += 2;
+        WR16(b, src);
+    }
+    // 05fc: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 05fe: add $206, r1
+    {
+        src = uint16_t(0x0206);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0602: mov r1, (r3)+
+    {
+        src = r[1];
+        b = r[3];
+        r[3] += 2;
+        WR16(b, src);
+    }
+    // 0604: mov r0, (r3)+
+    {
+        src = r[0];
+        b = r[3];
+        r[3] += 2;
+        WR16(b, src);
+    }
+    // 0606: mov r2, (r3)+
+    {
+        src = r[2];
+        b = r[3];
+        r[3] += 2;
+        WR16(b, src);
+    }
+    // 0608: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 060a: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 060c: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L060e:
+    AOT_BLOCK(0x060e, 6);
+    // 060e: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0610: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0612: mov (r5)+, r2
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0614: mov (r2)+, r1
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0616: cmp r1, (r2)
+    {
+        src = r[1];
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0618: bcc 0620
+    if (!C)
+        AOT_GOTO(0x0620, L0620);
+    AOT_GOTO(0x061a, L061a);
+L061a:
+    AOT_BLOCK(0x061a, 3);
+    // 061a: mov r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        WR16(b, src);
+    }
+    // 061c: mov r1, -(r2)
+    {
+        src = r[1];
+        r[2] -= 2;
+        b = r[2];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 061e: br 0630
+    AOT_GOTO(0x0630, L0630);
+L0620:
+    AOT_BLOCK(0x0620, 3);
+    // 0620: tst (r2)+
+    {
+        a = r[2];
+        r[2] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0622: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0624: jsr r5, 063a
+    {
+        a = 0x063a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0628;
+    }
+    AOT_GOTO(0x063a, L063a);
+L0628:
+    AOT_BLOCK(0x0628, 3);
+    // 0628: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 062a: mov r0, *(r2)+
+    {
+        src = r[0];
+        b = RD16(r[2]);
+        r[2] += 2;
+        WR16(b, src);
+    }
+    // 062c: add $2, -(r2)
+    {
+        src = uint16_t(0x0002);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0630, L0630);
+L0630:
+    AOT_BLOCK(0x0630, 3);
+    // 0630: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0632: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0634: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0636:
+    AOT_BLOCK(0x0636, 2);
+    // 0636: mov (r5)+, r2
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0638: cmp (r2)+, (r2)+
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x063a, L063a);
+L063a:
+    AOT_BLOCK(0x063a, 4);
+    // 063a: mov (r2)+, 2054
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        b = 0x2054;
+        WR16(b, src);
+    }
+    // 063e: mov (r2)+, r1
+    {
+        a = r[2];
+        r[2] += 2;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0640: mov r1, 2056
+    {
+        src = r[1];
+        b = 0x2056;
+        WR16(b, src);
+    }
+    // 0644: mov 2592, r0
+    {
+        a = 0x2592;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0648: sys 0
+    AOT_INTERP(0x0648);
+L064a:
+    AOT_BLOCK(0x064a, 1);
+    // 064a: cmp r1, (r2)+
+    {
+        src = r[1];
+        b = r[2];
+        r[2] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x064c, L064c);
+L064c:
+    AOT_BLOCK(0x064c, 1);
+    // 064c: bic $fe00, r1
+    {
+        src = uint16_t(0xfe00);
+        dst = r[1];
+        val = (~src) & dst;
+        r[1] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x0650, L0650);
+L064e:
+    // 064e: (undefined)
+    AOT_INTERP(0x064e);
+L0650:
+    AOT_BLOCK(0x0650, 1);
+    // 0650: add r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0652, L0652);
+L0652:
+    AOT_BLOCK(0x0652, 11);
+    // 0652: mov r1, 205c
+    {
+        src = r[1];
+        b = 0x205c;
+        WR16(b, src);
+    }
+    // 0656: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 0658: bis $1ff, -(r2)
+    {
+        src = uint16_t(0x01ff);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 065c: add $1, (r2)
+    {
+        src = uint16_t(0x0001);
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0660: adc -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        val = int(int16_t(RD16(a))) + int(C);
+        WR16(a, val);
+    }
+    // 0662: cmp -(r2), -(r2)
+    {
+        r[2] -= 2;
+        a = r[2];
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0664: sub (r2), r1
+    {
+        a = r[2];
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+    }
+    // 0666: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 0668: mov r1, 205e
+    {
+        src = r[1];
+        b = 0x205e;
+        WR16(b, src);
+    }
+    // 066c: mov r0, (r2)
+    {
+        src = r[0];
+        b = r[2];
+        WR16(b, src);
+    }
+    // 066e: mov 2592, r0
+    {
+        a = 0x2592;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0672: sys 0
+    AOT_INTERP(0x0672);
+L0674:
+    AOT_BLOCK(0x0674, 1);
+    // 0674: cmp r1, *(r2)+
+    {
+        src = r[1];
+        b = RD16(r[2]);
+        r[2] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0676, L0676);
+L0676:
+    AOT_BLOCK(0x0676, 1);
+    // 0676: bcs 067a
+    if (C)
+        AOT_GOTO(0x067a, L067a);
+    AOT_GOTO(0x0678, L0678);
+L0678:
+    AOT_BLOCK(0x0678, 1);
+    // 0678: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L067a:
+    AOT_BLOCK(0x067a, 1);
+    // 067a: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x067e, L067e);
+L067c:
+    // 067c: wait
+    AOT_INTERP(0x067c);
+L067e:
+    // 067e: sys 4
+    AOT_INTERP(0x067e);
+L0680:
+    AOT_BLOCK(0x0680, 1);
+    // 0680: bgt 0592
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0592, L0592);
+    AOT_GOTO(0x0682, L0682);
+L0682:
+    // 0682: (undefined)
+    AOT_INTERP(0x0682);
+L0684:
+    AOT_BLOCK(0x0684, 1);
+    // 0684: jmp 2000
+    {
+        a = 0x2000;
+    }
+    AOT_JUMP(0x2000);
+L0686:
+    AOT_BLOCK(0x0686, 8);
+    // 0686: mov -(r5), *7361(r0)
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = RD16(a);
+        b = RD16(r[0] + 29537);
+        WR16(b, src);
+    }
+    // 068a: cmp r0, *7277(r2)
+    {
+        src = r[0];
+        b = RD16(r[2] + 29303);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 068e: ash *-(r1), r1
+    {
+        r[1] -= 2;
+        a = RD16(r[1]);
+        src = RD16(a) & 077;
+        val16 = r[1];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0690: cmp r1, -(r5)
+    {
+        src = r[1];
+        r[5] -= 2;
+        b = r[5];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0692: div -(r5), r1
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[1])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[1]) << 16) | r[2];
+        dst = val / src;
+        r[1] = dst;
+        r[2] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0694: add *2072(r5), 6e6f(r2)
+    {
+        a = RD16(r[5] + 8306);
+        src = RD16(a);
+        b = uint16_t(r[2] + 28271);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 069a: add *7475(r4), -(r0)
+    {
+        a = RD16(r[4] + 29813);
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 069e: ash a74(r0), r5
+    {
+        a = uint16_t(r[0] + 2676);
+        src = RD16(a) & 077;
+        val16 = r[5];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0688:
+    AOT_BLOCK(0x0688, 8);
+    // 0688: div -(r1), r5
+    {
+        r[1] -= 2;
+        a = r[1];
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[5])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[5]) << 16) | r[6];
+        dst = val / src;
+        r[5] = dst;
+        r[6] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 068a: cmp r0, *7277(r2)
+    {
+        src = r[0];
+        b = RD16(r[2] + 29303);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 068e: ash *-(r1), r1
+    {
+        r[1] -= 2;
+        a = RD16(r[1]);
+        src = RD16(a) & 077;
+        val16 = r[1];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0690: cmp r1, -(r5)
+    {
+        src = r[1];
+        r[5] -= 2;
+        b = r[5];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0692: div -(r5), r1
+    {
+        r[5] -= 2;
+        a = r[5];
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[1])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[1]) << 16) | r[2];
+        dst = val / src;
+        r[1] = dst;
+        r[2] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0694: add *2072(r5), 6e6f(r2)
+    {
+        a = RD16(r[5] + 8306);
+        src = RD16(a);
+        b = uint16_t(r[2] + 28271);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 069a: add *7475(r4), -(r0)
+    {
+        a = RD16(r[4] + 29813);
+        src = RD16(a);
+        r[0] -= 2;
+        b = r[0];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 069e: ash a74(r0), r5
+    {
+        a = uint16_t(r[0] + 2676);
+        src = RD16(a) & 077;
+        val16 = r[5];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L06a2:
+    AOT_BLOCK(0x06a2, 2);
+    // 06a2: mov 25b2, r4
+    {
+        a = 0x25b2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06a6: beq 06ae
+    if (Z)
+        AOT_GOTO(0x06ae, L06ae);
+    AOT_GOTO(0x06a8, L06a8);
+L06a8:
+    AOT_BLOCK(0x06a8, 2);
+    // 06a8: clr 25b2
+    {
+        a = 0x25b2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 06ac: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06ae:
+    AOT_BLOCK(0x06ae, 1);
+    // 06ae: jsr pc, 06d6
+    {
+        a = 0x06d6;
+        r[6] -= 2;
+        WR16(r[6], 0x06b2);
+    }
+    AOT_GOTO(0x06d6, L06d6);
+L06b2:
+    AOT_BLOCK(0x06b2, 2);
+    // 06b2: cmp r4, $80
+    {
+        src = r[4];
+        dst = uint16_t(0x0080);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06b6: bcs 06c8
+    if (C)
+        AOT_GOTO(0x06c8, L06c8);
+    AOT_GOTO(0x06b8, L06b8);
+L06b8:
+    AOT_BLOCK(0x06b8, 2);
+    // 06b8: cmp r4, $800
+    {
+        src = r[4];
+        dst = uint16_t(0x0800);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06bc: bcs 06c4
+    if (C)
+        AOT_GOTO(0x06c4, L06c4);
+    AOT_GOTO(0x06be, L06be);
+L06be:
+    AOT_BLOCK(0x06be, 2);
+    // 06be: add $21fc, r4
+    {
+        src = uint16_t(0x21fc);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 06c2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06c4:
+    AOT_BLOCK(0x06c4, 1);
+    // 06c4: add $1e98, r4
+    {
+        src = uint16_t(0x1e98);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x06c8, L06c8);
+L06c8:
+    AOT_BLOCK(0x06c8, 1);
+    // 06c8: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06ca:
+    AOT_BLOCK(0x06ca, 2);
+    // 06ca: mov 25b2, r4
+    {
+        a = 0x25b2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06ce: beq 06d6
+    if (Z)
+        AOT_GOTO(0x06d6, L06d6);
+    AOT_GOTO(0x06d0, L06d0);
+L06d0:
+    AOT_BLOCK(0x06d0, 2);
+    // 06d0: clr 25b2
+    {
+        a = 0x25b2;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 06d4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06d6:
+    AOT_BLOCK(0x06d6, 2);
+    // 06d6: dec 257e
+    {
+        a = 0x257e;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 06da: bgt 06fe
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x06fe, L06fe);
+    AOT_GOTO(0x06dc, L06dc);
+L06dc:
+    AOT_BLOCK(0x06dc, 1);
+    // 06dc: movb 257c, r0
+    {
+        a = 0x257c;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 06e0: sys 3
+    AOT_INTERP(0x06e0);
+L06e2:
+    AOT_BLOCK(0x06e2, 1);
+    // 06e2: cmp (r3), *-(r0)
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] -= 2;
+        b = RD16(r[0]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x06e4, L06e4);
+L06e4:
+    AOT_BLOCK(0x06e4, 1);
+    // 06e4: bne 06e6
+    if (!Z)
+        AOT_GOTO(0x06e6, L06e6);
+    AOT_GOTO(0x06e6, L06e6);
+L06e6:
+    AOT_BLOCK(0x06e6, 1);
+    // 06e6: bcs 06f0
+    if (C)
+        AOT_GOTO(0x06f0, L06f0);
+    AOT_GOTO(0x06e8, L06e8);
+L06e8:
+    AOT_BLOCK(0x06e8, 1);
+    // 06e8: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 1) != 0;
+        V = (val < 0) != ((src & 1) != 0);
+    }
+    AOT_GOTO(0x06ea, L06ea);
+L06ea:
+    AOT_BLOCK(0x06ea, 2);
+    // 06ea: mov r0, 257e
+    {
+        src = r[0];
+        b = 0x257e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06ee: bne 06f8
+    if (!Z)
+        AOT_GOTO(0x06f8, L06f8);
+    AOT_GOTO(0x06f0, L06f0);
+L06f0:
+    AOT_BLOCK(0x06f0, 3);
+    // 06f0: mov $4, r4
+    {
+        src = uint16_t(0x0004);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+    }
+    // 06f4: sev
+    {
+        V = true;
+    }
+    // 06f6: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06f8:
+    AOT_BLOCK(0x06f8, 1);
+    // 06f8: mov $22e8, 25e2
+    {
+        src = uint16_t(0x22e8);
+        b = 0x25e2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x06fe, L06fe);
+L06fe:
+    AOT_BLOCK(0x06fe, 3);
+    // 06fe: mov *25e2, r4
+    {
+        a = RD16(0x25e2);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0702: add $2, 25e2
+    {
+        src = uint16_t(0x0002);
+        b = 0x25e2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0708: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L070a:
+    AOT_BLOCK(0x070a, 2);
+    // 070a: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 070c: jsr r5, 0434
+    {
+        a = 0x0434;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0710;
+    }
+    AOT_GOTO(0x0434, L0434);
+L0710:
+    // 0710: halt
+    AOT_INTERP(0x0710);
+L0712:
+    AOT_BLOCK(0x0712, 1);
+    // 0712: jmp *0824
+    {
+        a = RD16(0x0824);
+    }
+    AOT_JUMP(a);
+L0800:
+    AOT_BLOCK(0x0800, 4);
+    // 0800: asr (sp)
+    {
+        a = r[6];
+        src = RD16(a);
+        val = int16_t(src) >> 1;
+        WR16(a, val);
+    }
+    // 0802: asr (sp)
+    {
+        a = r[6];
+        src = RD16(a);
+        val = int16_t(src) >> 1;
+        WR16(a, val);
+    }
+    // 0804: cmp (sp), 29f6
+    {
+        a = r[6];
+        src = RD16(a);
+        b = 0x29f6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0808: bcs 0810
+    if (C)
+        AOT_GOTO(0x0810, L0810);
+    AOT_GOTO(0x080a, L080a);
+L080a:
+    AOT_BLOCK(0x080a, 1);
+    // 080a: jsr r5, 03d4
+    {
+        a = 0x03d4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x080e;
+    }
+    AOT_GOTO(0x03d4, L03d4);
+L080e:
+    AOT_BLOCK(0x080e, 1);
+    // 080e: jmp *5582(r0)
+    {
+        a = RD16(r[0] + 21890);
+    }
+    AOT_JUMP(a);
+L0810:
+    AOT_BLOCK(0x0810, 4);
+    // 0810: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0812: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0814: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0816: jsr pc, 02b2
+    {
+        a = 0x02b2;
+        r[6] -= 2;
+        WR16(r[6], 0x081a);
+    }
+    AOT_GOTO(0x02b2, L02b2);
+L081a:
+    AOT_BLOCK(0x081a, 1);
+    // 081a: mov $2584, r1
+    {
+        src = uint16_t(0x2584);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x081e, L081e);
+L081e:
+    AOT_BLOCK(0x081e, 2);
+    // 081e: cmp r1, r5
+    {
+        src = r[1];
+        dst = r[5];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0820: bcc 0830
+    if (!C)
+        AOT_GOTO(0x0830, L0830);
+    AOT_GOTO(0x0822, L0822);
+L0822:
+    AOT_BLOCK(0x0822, 4);
+    // 0822: mov (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0824: mov (r1)+, r3
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0826: mov (r1)+, 2590
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        b = 0x2590;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 082a: jsr pc, 02b2
+    {
+        a = 0x02b2;
+        r[6] -= 2;
+        WR16(r[6], 0x082e);
+    }
+    AOT_GOTO(0x02b2, L02b2);
+L082e:
+    AOT_BLOCK(0x082e, 1);
+    // 082e: br 081e
+    AOT_GOTO(0x081e, L081e);
+L0830:
+    AOT_BLOCK(0x0830, 1);
+    // 0830: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a00:
+    // 0a00: (undefined)
+    AOT_INTERP(0x0a00);
+L0a02:
+    AOT_BLOCK(0x0a02, 7);
+    // 0a02: cmp *$1382, *-(r4)
+    {
+        a = 0x1382;
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0a06: asl r2
+    {
+        src = r[2];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[2] = val;
+    }
+    // 0a08: add $2028, r2
+    {
+        src = uint16_t(0x2028);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0a0c: mov r2, 2068
+    {
+        src = r[2];
+        b = 0x2068;
+        WR16(b, src);
+    }
+    // 0a10: mov (r2), r0
+    {
+        a = r[2];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0a12: mov 2(r2), r1
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a16: jsr r5, 05e8
+    {
+        a = 0x05e8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a1a;
+    }
+    AOT_GOTO(0x05e8, L05e8);
+L0a1a:
+    AOT_BLOCK(0x0a1a, 1);
+    // 0a1a: cmp $65c2, -(r4)
+    {
+        src = uint16_t(0x65c2);
+        r[4] -= 2;
+        b = r[4];
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a1e: (undefined)
+    AOT_INTERP(0x0a1e);
+L0a20:
+    AOT_BLOCK(0x0a20, 4);
+    // 0a20: mov (r2), r0
+    {
+        a = r[2];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0a22: mov 2(r2), r1
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0a26: mov r2, 206a
+    {
+        src = r[2];
+        b = 0x206a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a2a: jsr r5, 05e8
+    {
+        a = 0x05e8;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a2e;
+    }
+    AOT_GOTO(0x05e8, L05e8);
+L0a2e:
+    AOT_BLOCK(0x0a2e, 7);
+    // 0a2e: cmp *$1580, *-(r4)
+    {
+        a = 0x1580;
+        src = RD16(a);
+        r[4] -= 2;
+        b = RD16(r[4]);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0a32: mov 2546(r0), 209a
+    {
+        a = uint16_t(r[0] + 9542);
+        src = RD16(a);
+        b = 0x209a;
+        WR16(b, src);
+    }
+    // 0a38: asr r0
+    {
+        src = r[0];
+        val = int16_t(src) >> 1;
+        r[0] = val;
+    }
+    // 0a3a: sub $13, r0
+    {
+        src = uint16_t(0x0013);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0a3e: mov r0, 2098
+    {
+        src = r[0];
+        b = 0x2098;
+        WR16(b, src);
+    }
+    // 0a42: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a44: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a70:
+    AOT_BLOCK(0x0a70, 2);
+    // 0a70: cmp r4, $28
+    {
+        src = r[4];
+        dst = uint16_t(0x0028);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a74: beq 0af2
+    if (Z)
+        AOT_GOTO(0x0af2, L0af2);
+    AOT_GOTO(0x0a76, L0a76);
+L0a76:
+    AOT_BLOCK(0x0a76, 2);
+    // 0a76: cmp r4, $2d
+    {
+        src = r[4];
+        dst = uint16_t(0x002d);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a7a: beq 0b2c
+    if (Z)
+        AOT_GOTO(0x0b2c, L0b2c);
+    AOT_GOTO(0x0a7c, L0a7c);
+L0a7c:
+    AOT_BLOCK(0x0a7c, 1);
+    // 0a7c: cmp r4, $24
+    {
+        src = r[4];
+        dst = uint16_t(0x0024);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0a80, L0a80);
+L0a80:
+    AOT_BLOCK(0x0a80, 1);
+    // 0a80: beq 0b58
+    if (Z)
+        AOT_GOTO(0x0b58, L0b58);
+    AOT_GOTO(0x0a82, L0a82);
+L0a82:
+    AOT_BLOCK(0x0a82, 2);
+    // 0a82: cmp r4, $2a
+    {
+        src = r[4];
+        dst = uint16_t(0x002a);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a86: bne 0a8c
+    if (!Z)
+        AOT_GOTO(0x0a8c, L0a8c);
+    AOT_GOTO(0x0a88, L0a88);
+L0a88:
+    AOT_BLOCK(0x0a88, 1);
+    // 0a88: jmp 0b70
+    {
+        a = 0x0b70;
+    }
+    AOT_GOTO(0x0b70, L0b70);
+L0a8c:
+    AOT_BLOCK(0x0a8c, 1);
+    // 0a8c: jsr pc, 0c38
+    {
+        a = 0x0c38;
+        r[6] -= 2;
+        WR16(r[6], 0x0a90);
+    }
+    AOT_GOTO(0x0c38, L0c38);
+L0a90:
+    AOT_BLOCK(0x0a90, 2);
+    // 0a90: cmp r4, $28
+    {
+        src = r[4];
+        dst = uint16_t(0x0028);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a94: bne 0ab6
+    if (!Z)
+        AOT_GOTO(0x0ab6, L0ab6);
+    AOT_GOTO(0x0a96, L0a96);
+L0a96:
+    AOT_BLOCK(0x0a96, 1);
+    // 0a96: jsr pc, 06a2
+    {
+        a = 0x06a2;
+        r[6] -= 2;
+        WR16(r[6], 0x0a9a);
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0a9a:
+    AOT_BLOCK(0x0a9a, 4);
+    // 0a9a: mov r2, (r5)+
+    {
+        src = r[2];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0a9c: mov r3, (r5)+
+    {
+        src = r[3];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0a9e: mov 2590, (r5)+
+    {
+        a = 0x2590;
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0aa2: jsr pc, 0c38
+    {
+        a = 0x0c38;
+        r[6] -= 2;
+        WR16(r[6], 0x0aa6);
+    }
+    AOT_GOTO(0x0c38, L0c38);
+L0aa6:
+    AOT_BLOCK(0x0aa6, 1);
+    // 0aa6: jsr pc, 0b8e
+    {
+        a = 0x0b8e;
+        r[6] -= 2;
+        WR16(r[6], 0x0aaa);
+    }
+    AOT_GOTO(0x0b8e, L0b8e);
+L0aaa:
+    AOT_BLOCK(0x0aaa, 1);
+    // 0aaa: jsr pc, 0bb4
+    {
+        a = 0x0bb4;
+        r[6] -= 2;
+        WR16(r[6], 0x0aae);
+    }
+    AOT_GOTO(0x0bb4, L0bb4);
+L0aae:
+    AOT_BLOCK(0x0aae, 3);
+    // 0aae: bis $30, r2
+    {
+        src = uint16_t(0x0030);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0ab2: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0ab4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ab6:
+    AOT_BLOCK(0x0ab6, 2);
+    // 0ab6: cmp r3, $14
+    {
+        src = r[3];
+        dst = uint16_t(0x0014);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0aba: bne 0ac4
+    if (!Z)
+        AOT_GOTO(0x0ac4, L0ac4);
+    AOT_GOTO(0x0abc, L0abc);
+L0abc:
+    AOT_BLOCK(0x0abc, 1);
+    // 0abc: jsr pc, 0b8e
+    {
+        a = 0x0b8e;
+        r[6] -= 2;
+        WR16(r[6], 0x0ac0);
+    }
+    AOT_GOTO(0x0b8e, L0b8e);
+L0ac0:
+    AOT_BLOCK(0x0ac0, 2);
+    // 0ac0: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0ac2: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ac4:
+    AOT_BLOCK(0x0ac4, 8);
+    // 0ac4: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ac6: bic $20, r3
+    {
+        src = uint16_t(0x0020);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+    }
+    // 0aca: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0acc: bis $8000, r3
+    {
+        src = uint16_t(0x8000);
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+    }
+    // 0ad0: sub 209a, r2
+    {
+        a = 0x209a;
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+    }
+    // 0ad4: sub $4, r2
+    {
+        src = uint16_t(0x0004);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+    }
+    // 0ad8: cmp r5, $2584
+    {
+        src = r[5];
+        dst = uint16_t(0x2584);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0adc: beq 0ae2
+    if (Z)
+        AOT_GOTO(0x0ae2, L0ae2);
+    AOT_GOTO(0x0ade, L0ade);
+L0ade:
+    AOT_BLOCK(0x0ade, 1);
+    // 0ade: sub $2, r2
+    {
+        src = uint16_t(0x0002);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0ae2, L0ae2);
+L0ae2:
+    AOT_BLOCK(0x0ae2, 6);
+    // 0ae2: mov r2, (r5)+
+    {
+        src = r[2];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0ae4: mov r3, (r5)+
+    {
+        src = r[3];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0ae6: mov 2590, (r5)+
+    {
+        a = 0x2590;
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0aea: mov $37, r2
+    {
+        src = uint16_t(0x0037);
+        r[2] = src;
+    }
+    // 0aee: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0af0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0af2:
+    AOT_BLOCK(0x0af2, 1);
+    // 0af2: jsr pc, 06a2
+    {
+        a = 0x06a2;
+        r[6] -= 2;
+        WR16(r[6], 0x0af6);
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0af6:
+    AOT_BLOCK(0x0af6, 1);
+    // 0af6: jsr pc, 0c38
+    {
+        a = 0x0c38;
+        r[6] -= 2;
+        WR16(r[6], 0x0afa);
+    }
+    AOT_GOTO(0x0c38, L0c38);
+L0afa:
+    AOT_BLOCK(0x0afa, 1);
+    // 0afa: jsr pc, 0bb4
+    {
+        a = 0x0bb4;
+        r[6] -= 2;
+        WR16(r[6], 0x0afe);
+    }
+    AOT_GOTO(0x0bb4, L0bb4);
+L0afe:
+    AOT_BLOCK(0x0afe, 1);
+    // 0afe: jsr pc, 0b8e
+    {
+        a = 0x0b8e;
+        r[6] -= 2;
+        WR16(r[6], 0x0b02);
+    }
+    AOT_GOTO(0x0b8e, L0b8e);
+L0b02:
+    AOT_BLOCK(0x0b02, 2);
+    // 0b02: cmp r4, $2b
+    {
+        src = r[4];
+        dst = uint16_t(0x002b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b06: beq 0b20
+    if (Z)
+        AOT_GOTO(0x0b20, L0b20);
+    AOT_GOTO(0x0b08, L0b08);
+L0b08:
+    AOT_BLOCK(0x0b08, 2);
+    // 0b08: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b0a: beq 0b1a
+    if (Z)
+        AOT_GOTO(0x0b1a, L0b1a);
+    AOT_GOTO(0x0b0c, L0b0c);
+L0b0c:
+    AOT_BLOCK(0x0b0c, 5);
+    // 0b0c: bis $38, r2
+    {
+        src = uint16_t(0x0038);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0b10: clr (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        WR16(a, 0);
+    }
+    // 0b12: clr (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        WR16(a, 0);
+        C = false;
+    }
+    // 0b14: mov 2590, (r5)+
+    {
+        a = 0x2590;
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b18: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b1a:
+    AOT_BLOCK(0x0b1a, 2);
+    // 0b1a: bis $8, r2
+    {
+        src = uint16_t(0x0008);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b1e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b20:
+    AOT_BLOCK(0x0b20, 1);
+    // 0b20: jsr pc, 06a2
+    {
+        a = 0x06a2;
+        r[6] -= 2;
+        WR16(r[6], 0x0b24);
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0b24:
+    AOT_BLOCK(0x0b24, 3);
+    // 0b24: bis $10, r2
+    {
+        src = uint16_t(0x0010);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0b28: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b2a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b2c:
+    AOT_BLOCK(0x0b2c, 1);
+    // 0b2c: jsr pc, 06a2
+    {
+        a = 0x06a2;
+        r[6] -= 2;
+        WR16(r[6], 0x0b30);
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0b30:
+    AOT_BLOCK(0x0b30, 2);
+    // 0b30: cmp r4, $28
+    {
+        src = r[4];
+        dst = uint16_t(0x0028);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b34: beq 0b40
+    if (Z)
+        AOT_GOTO(0x0b40, L0b40);
+    AOT_GOTO(0x0b36, L0b36);
+L0b36:
+    AOT_BLOCK(0x0b36, 3);
+    // 0b36: mov r4, 25b2
+    {
+        src = r[4];
+        b = 0x25b2;
+        WR16(b, src);
+    }
+    // 0b3a: mov $2d, r4
+    {
+        src = uint16_t(0x002d);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b3e: br 0a8c
+    AOT_GOTO(0x0a8c, L0a8c);
+L0b40:
+    AOT_BLOCK(0x0b40, 1);
+    // 0b40: jsr pc, 06a2
+    {
+        a = 0x06a2;
+        r[6] -= 2;
+        WR16(r[6], 0x0b44);
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0b44:
+    AOT_BLOCK(0x0b44, 1);
+    // 0b44: jsr pc, 0c38
+    {
+        a = 0x0c38;
+        r[6] -= 2;
+        WR16(r[6], 0x0b48);
+    }
+    AOT_GOTO(0x0c38, L0c38);
+L0b48:
+    AOT_BLOCK(0x0b48, 1);
+    // 0b48: jsr pc, 0bb4
+    {
+        a = 0x0bb4;
+        r[6] -= 2;
+        WR16(r[6], 0x0b4c);
+    }
+    AOT_GOTO(0x0bb4, L0bb4);
+L0b4c:
+    AOT_BLOCK(0x0b4c, 1);
+    // 0b4c: jsr pc, 0b8e
+    {
+        a = 0x0b8e;
+        r[6] -= 2;
+        WR16(r[6], 0x0b50);
+    }
+    AOT_GOTO(0x0b8e, L0b8e);
+L0b50:
+    AOT_BLOCK(0x0b50, 3);
+    // 0b50: bis (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+    }
+    // 0b52: bis $20, r2
+    {
+        src = uint16_t(0x0020);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b56: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b58:
+    AOT_BLOCK(0x0b58, 1);
+    // 0b58: jsr pc, 06a2
+    {
+        a = 0x06a2;
+        r[6] -= 2;
+        WR16(r[6], 0x0b5c);
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0b5c:
+    AOT_BLOCK(0x0b5c, 1);
+    // 0b5c: jsr pc, 0c38
+    {
+        a = 0x0c38;
+        r[6] -= 2;
+        WR16(r[6], 0x0b60);
+    }
+    AOT_GOTO(0x0c38, L0c38);
+L0b60:
+    AOT_BLOCK(0x0b60, 6);
+    // 0b60: mov r2, (r5)+
+    {
+        src = r[2];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0b62: mov r3, (r5)+
+    {
+        src = r[3];
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0b64: mov 2590, (r5)+
+    {
+        a = 0x2590;
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        WR16(b, src);
+    }
+    // 0b68: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0b6a: bis $17, r2
+    {
+        src = uint16_t(0x0017);
+        dst = r[2];
+        val = src | dst;
+        r[2] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0b6e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b70:
+    AOT_BLOCK(0x0b70, 2);
+    // 0b70: tst (sp)
+    {
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b72: beq 0b7a
+    if (Z)
+        AOT_GOTO(0x0b7a, L0b7a);
+    AOT_GOTO(0x0b74, L0b74);
+L0b74:
+    AOT_BLOCK(0x0b74, 1);
+    // 0b74: jsr r5, 03d4
+    {
+        a = 0x03d4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b78;
+    }
+    AOT_GOTO(0x03d4, L03d4);
+L0b78:
+    // 0b78: (undefined)
+    AOT_INTERP(0x0b78);
+L0b7a:
+    AOT_BLOCK(0x0b7a, 2);
+    // 0b7a: mov $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b7e: jsr pc, 06a2
+    {
+        a = 0x06a2;
+        r[6] -= 2;
+        WR16(r[6], 0x0b82);
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0b82:
+    AOT_BLOCK(0x0b82, 1);
+    // 0b82: jmp 0a70
+    {
+        a = 0x0a70;
+    }
+    AOT_GOTO(0x0a70, L0a70);
+L0b86:
+    AOT_BLOCK(0x0b86, 1);
+    // 0b86: jsr r5, 03d4
+    {
+        a = 0x03d4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b8a;
+    }
+    AOT_GOTO(0x03d4, L03d4);
+L0b8a:
+    AOT_BLOCK(0x0b8a, 1);
+    // 0b8a: jmp -(r1)
+    {
+        r[1] -= 2;
+        a = r[1];
+    }
+    AOT_JUMP(a);
+L0b8e:
+    AOT_BLOCK(0x0b8e, 2);
+    // 0b8e: cmp r2, $7
+    {
+        src = r[2];
+        dst = uint16_t(0x0007);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b92: bhi 0ba2
+    if (!(C | Z))
+        AOT_GOTO(0x0ba2, L0ba2);
+    AOT_GOTO(0x0b94, L0b94);
+L0b94:
+    AOT_BLOCK(0x0b94, 2);
+    // 0b94: cmp r1, $1
+    {
+        src = r[1];
+        dst = uint16_t(0x0001);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b98: blos 0ba0
+    if (C | Z)
+        AOT_GOTO(0x0ba0, L0ba0);
+    AOT_GOTO(0x0b9a, L0b9a);
+L0b9a:
+    AOT_BLOCK(0x0b9a, 2);
+    // 0b9a: cmp r3, $5
+    {
+        src = r[3];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0b9e: bcs 0ba2
+    if (C)
+        AOT_GOTO(0x0ba2, L0ba2);
+    AOT_GOTO(0x0ba0, L0ba0);
+L0ba0:
+    AOT_BLOCK(0x0ba0, 1);
+    // 0ba0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ba2:
+    AOT_BLOCK(0x0ba2, 1);
+    // 0ba2: jsr pc, 0b86
+    {
+        a = 0x0b86;
+        r[6] -= 2;
+        WR16(r[6], 0x0ba6);
+    }
+    AOT_GOTO(0x0b86, L0b86);
+L0ba6:
+    AOT_BLOCK(0x0ba6, 3);
+    // 0ba6: clr r2
+    {
+        r[2] = 0;
+    }
+    // 0ba8: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0baa: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0bb4:
+    AOT_BLOCK(0x0bb4, 2);
+    // 0bb4: cmp r4, $29
+    {
+        src = r[4];
+        dst = uint16_t(0x0029);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bb8: beq 0bc2
+    if (Z)
+        AOT_GOTO(0x0bc2, L0bc2);
+    AOT_GOTO(0x0bba, L0bba);
+L0bba:
+    AOT_BLOCK(0x0bba, 1);
+    // 0bba: jsr r5, 03d4
+    {
+        a = 0x03d4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0bbe;
+    }
+    AOT_GOTO(0x03d4, L03d4);
+L0bbe:
+    // 0bbe: (undefined)
+    AOT_INTERP(0x0bbe);
+L0bc0:
+    AOT_BLOCK(0x0bc0, 1);
+    // 0bc0: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0bc2:
+    AOT_BLOCK(0x0bc2, 1);
+    // 0bc2: jsr pc, 06a2
+    {
+        a = 0x06a2;
+        r[6] -= 2;
+        WR16(r[6], 0x0bc6);
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0bc6:
+    AOT_BLOCK(0x0bc6, 1);
+    // 0bc6: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0bd6:
+    AOT_BLOCK(0x0bd6, 1);
+    // 0bd6: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0c00:
+    AOT_BLOCK(0x0c00, 5);
+    // 0c00: ash $fffd, r1
+    {
+        src = uint16_t(0xfffd) & 077;
+        val16 = r[1];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0c04: bisb r0, 24e8(r1)
+    {
+        src = uint8_t(r[0]);
+        b = uint16_t(r[1] + 9448);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 0c08: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c0c: mov (sp)+, r2
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c0e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0c38:
+    AOT_BLOCK(0x0c38, 6);
+    // 0c38: clr 2590
+    {
+        a = 0x2590;
+        WR16(a, 0);
+    }
+    // 0c3c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c3e: mov $2b, -(sp)
+    {
+        src = uint16_t(0x002b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c42: clr r2
+    {
+        r[2] = 0;
+        C = false;
+    }
+    // 0c44: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c48: br 0c4e
+    AOT_GOTO(0x0c4e, L0c4e);
+L0c4a:
+    AOT_BLOCK(0x0c4a, 1);
+    // 0c4a: jsr pc, 06a2
+    {
+        a = 0x06a2;
+        r[6] -= 2;
+        WR16(r[6], 0x0c4e);
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0c4e:
+    AOT_BLOCK(0x0c4e, 2);
+    // 0c4e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c50: jsr r5, 0434
+    {
+        a = 0x0434;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0c54;
+    }
+    AOT_GOTO(0x0434, L0434);
+L0c54:
+    // 0c54: halt
+    AOT_INTERP(0x0c54);
+L0c56:
+    AOT_BLOCK(0x0c56, 1);
+    // 0c56: jmp *0d5b
+    {
+        a = RD16(0x0d5b);
+    }
+    AOT_JUMP(a);
+L0c80:
+    AOT_BLOCK(0x0c80, 1);
+    // 0c80: br 0d28
+    AOT_GOTO(0x0d28, L0d28);
+L0cc0:
+    // 0cc0: (undefined)
+    AOT_INTERP(0x0cc0);
+L0cc2:
+    AOT_BLOCK(0x0cc2, 1);
+    // 0cc2: asl *-(r0)
+    {
+        r[0] -= 2;
+        a = RD16(r[0]);
+        src = RD16(a);
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0cc4: (undefined)
+    AOT_INTERP(0x0cc4);
+L0cc6:
+    AOT_BLOCK(0x0cc6, 1);
+    // 0cc6: asl *-(r0)
+    {
+        r[0] -= 2;
+        a = RD16(r[0]);
+        src = RD16(a);
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0cc8: (undefined)
+    AOT_INTERP(0x0cc8);
+L0cca:
+    AOT_BLOCK(0x0cca, 1);
+    // 0cca: asl *-(r0)
+    {
+        r[0] -= 2;
+        a = RD16(r[0]);
+        src = RD16(a);
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0ccc: (undefined)
+    AOT_INTERP(0x0ccc);
+L0cce:
+    AOT_BLOCK(0x0cce, 2);
+    // 0cce: asl *-(r0)
+    {
+        r[0] -= 2;
+        a = RD16(r[0]);
+        src = RD16(a);
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0cd0: jmp *(r3)+
+    {
+        a = RD16(r[3]);
+        r[3] += 2;
+    }
+    AOT_JUMP(a);
+L0d00:
+    AOT_BLOCK(0x0d00, 3);
+    // 0d00: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 0d02: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d06: br 0d28
+    AOT_GOTO(0x0d28, L0d28);
+L0d28:
+    AOT_BLOCK(0x0d28, 1);
+    // 0d28: mov $d3a, r5
+    {
+        src = uint16_t(0x0d3a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d2c, L0d2c);
+L0d2c:
+    AOT_BLOCK(0x0d2c, 2);
+    // 0d2c: cmp (sp), (r5)+
+    {
+        a = r[6];
+        src = RD16(a);
+        b = r[5];
+        r[5] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d2e: beq 0d36
+    if (Z)
+        AOT_GOTO(0x0d36, L0d36);
+    AOT_GOTO(0x0d30, L0d30);
+L0d30:
+    AOT_BLOCK(0x0d30, 2);
+    // 0d30: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d32: bne 0d2c
+    if (!Z)
+        AOT_GOTO(0x0d2c, L0d2c);
+    AOT_GOTO(0x0d34, L0d34);
+L0d34:
+    AOT_BLOCK(0x0d34, 1);
+    // 0d34: br 0dea
+    AOT_GOTO(0x0dea, L0dea);
+L0d36:
+    AOT_BLOCK(0x0d36, 1);
+    // 0d36: jmp *0(r5)
+    {
+        a = RD16(r[5] + 0);
+    }
+    AOT_JUMP(a);
+L0dc0:
+    AOT_BLOCK(0x0dc0, 1);
+    // 0dc0: jsr r5, 0df2
+    {
+        a = 0x0df2;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0dc4;
+    }
+    AOT_GOTO(0x0df2, L0df2);
+L0dc4:
+    // 0dc4: (undefined)
+    AOT_INTERP(0x0dc4);
+L0dc6:
+    AOT_BLOCK(0x0dc6, 3);
+    // 0dc6: mul r2, r1
+    {
+        src = int16_t(r[2]);
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 0dc8: mov r1, r2
+    {
+        src = r[1];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dca: br 0dea
+    AOT_GOTO(0x0dea, L0dea);
+L0dea:
+    AOT_BLOCK(0x0dea, 2);
+    // 0dea: mov $2b, (sp)
+    {
+        src = uint16_t(0x002b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dee: jmp 0c4a
+    {
+        a = 0x0c4a;
+    }
+    AOT_GOTO(0x0c4a, L0c4a);
+L0df2:
+    AOT_BLOCK(0x0df2, 2);
+    // 0df2: tstb 29f8
+    {
+        a = 0x29f8;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0df6: bne 0e2e
+    if (!Z)
+        AOT_GOTO(0x0e2e, L0e2e);
+    AOT_GOTO(0x0df8, L0df8);
+L0df8:
+    AOT_BLOCK(0x0df8, 7);
+    // 0df8: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0dfa: bis r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        dst = RD16(b);
+        val = src | dst;
+        WR16(b, val);
+    }
+    // 0dfc: bic $ffdf, (sp)
+    {
+        src = uint16_t(0xffdf);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+    }
+    // 0e00: bic $ffe0, r0
+    {
+        src = uint16_t(0xffe0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0e04: bic $ffe0, r3
+    {
+        src = uint16_t(0xffe0);
+        dst = r[3];
+        val = (~src) & dst;
+        r[3] = val;
+    }
+    // 0e08: cmp r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e0a: ble 0e12
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0e12, L0e12);
+    AOT_GOTO(0x0e0c, L0e0c);
+L0e0c:
+    AOT_BLOCK(0x0e0c, 3);
+    // 0e0c: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e0e: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 0e10: mov (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e12, L0e12);
+L0e12:
+    AOT_BLOCK(0x0e12, 2);
+    // 0e12: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e14: beq 0e26
+    if (Z)
+        AOT_GOTO(0x0e26, L0e26);
+    AOT_GOTO(0x0e16, L0e16);
+L0e16:
+    AOT_BLOCK(0x0e16, 2);
+    // 0e16: cmp (r5)+, $eaa
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        dst = uint16_t(0x0eaa);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e1a: bne 0e2a
+    if (!Z)
+        AOT_GOTO(0x0e2a, L0e2a);
+    AOT_GOTO(0x0e1c, L0e1c);
+L0e1c:
+    AOT_BLOCK(0x0e1c, 2);
+    // 0e1c: cmp r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e1e: bne 0e2a
+    if (!Z)
+        AOT_GOTO(0x0e2a, L0e2a);
+    AOT_GOTO(0x0e20, L0e20);
+L0e20:
+    AOT_BLOCK(0x0e20, 2);
+    // 0e20: mov $1, r3
+    {
+        src = uint16_t(0x0001);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e24: br 0e2a
+    AOT_GOTO(0x0e2a, L0e2a);
+L0e26:
+    AOT_BLOCK(0x0e26, 2);
+    // 0e26: tst (r5)+
+    {
+        a = r[5];
+        r[5] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0e28: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0e2a, L0e2a);
+L0e2a:
+    AOT_BLOCK(0x0e2a, 2);
+    // 0e2a: bis (sp)+, r3
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[3];
+        val = src | dst;
+        r[3] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 0e2c: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0e2e:
+    AOT_BLOCK(0x0e2e, 3);
+    // 0e2e: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e30: clr 25de
+    {
+        a = 0x25de;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0e34: jsr pc, 0e60
+    {
+        a = 0x0e60;
+        r[6] -= 2;
+        WR16(r[6], 0x0e38);
+    }
+    AOT_GOTO(0x0e60, L0e60);
+L0e38:
+    AOT_BLOCK(0x0e38, 4);
+    // 0e38: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0e3a: mul $6, r1
+    {
+        src = int16_t(uint16_t(0x0006));
+        val = int(r[1]) * src;
+        r[1] = val;
+        C = val < -0x8000 || val >= 0x8000;
+    }
+    // 0e3e: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e40: jsr pc, 0e60
+    {
+        a = 0x0e60;
+        r[6] -= 2;
+        WR16(r[6], 0x0e44);
+    }
+    AOT_GOTO(0x0e60, L0e60);
+L0e44:
+    AOT_BLOCK(0x0e44, 4);
+    // 0e44: add (r5)+, r0
+    {
+        a = r[5];
+        r[5] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0e46: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0e48: movb (r0), r3
+    {
+        a = r[0];
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0e4a: bpl 0e5c
+    if (!N)
+        AOT_GOTO(0x0e5c, L0e5c);
+    AOT_GOTO(0x0e4c, L0e4c);
+L0e4c:
+    AOT_BLOCK(0x0e4c, 2);
+    // 0e4c: cmp r3, $ffff
+    {
+        src = r[3];
+        dst = uint16_t(0xffff);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e50: beq 0e58
+    if (Z)
+        AOT_GOTO(0x0e58, L0e58);
+    AOT_GOTO(0x0e52, L0e52);
+L0e52:
+    AOT_BLOCK(0x0e52, 1);
+    // 0e52: jsr r5, 03d4
+    {
+        a = 0x03d4;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0e56;
+    }
+    AOT_GOTO(0x03d4, L03d4);
+L0e56:
+    AOT_BLOCK(0x0e56, 1);
+    // 0e56: jmp 1dc3(r2)
+    {
+        a = uint16_t(r[2] + 7619);
+    }
+    AOT_JUMP(a);
+L0e58:
+    AOT_BLOCK(0x0e58, 1);
+    // 0e58: mov 25de, r3
+    {
+        a = 0x25de;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e5c, L0e5c);
+L0e5c:
+    AOT_BLOCK(0x0e5c, 2);
+    // 0e5c: mov (sp)+, r1
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e5e: rts r5
+    {
+        b = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0e60:
+    AOT_BLOCK(0x0e60, 2);
+    // 0e60: cmp r0, $20
+    {
+        src = r[0];
+        dst = uint16_t(0x0020);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e64: bne 0e6c
+    if (!Z)
+        AOT_GOTO(0x0e6c, L0e6c);
+    AOT_GOTO(0x0e66, L0e66);
+L0e66:
+    AOT_BLOCK(0x0e66, 2);
+    // 0e66: mov $5, r0
+    {
+        src = uint16_t(0x0005);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e6a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0e6c:
+    AOT_BLOCK(0x0e6c, 3);
+    // 0e6c: bic $ffe0, r0
+    {
+        src = uint16_t(0xffe0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0e70: cmp r0, 25de
+    {
+        src = r[0];
+        b = 0x25de;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e74: blos 0e7a
+    if (C | Z)
+        AOT_GOTO(0x0e7a, L0e7a);
+    AOT_GOTO(0x0e76, L0e76);
+L0e76:
+    AOT_BLOCK(0x0e76, 1);
+    // 0e76: mov r0, 25de
+    {
+        src = r[0];
+        b = 0x25de;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e7a, L0e7a);
+L0e7a:
+    AOT_BLOCK(0x0e7a, 2);
+    // 0e7a: cmp r0, $5
+    {
+        src = r[0];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e7e: bcs 0e84
+    if (C)
+        AOT_GOTO(0x0e84, L0e84);
+    AOT_GOTO(0x0e80, L0e80);
+L0e80:
+    AOT_BLOCK(0x0e80, 1);
+    // 0e80: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e84, L0e84);
+L0e84:
+    AOT_BLOCK(0x0e84, 1);
+    // 0e84: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("v7/lib/as2", 0x0000, 3840, 0x499ecd28u, run);
+}
@@ -0,0 +1,27351 @@
+// v7/lib/c2 translated by 7aot: 1249 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x000a: goto L000a;
+        case 0x000c: goto L000c;
+        case 0x0010: goto L0010;
+        case 0x0014: goto L0014;
+        case 0x0016: goto L0016;
+        case 0x001a: goto L001a;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0022: goto L0022;
+        case 0x0024: goto L0024;
+        case 0x0026: goto L0026;
+        case 0x002a: goto L002a;
+        case 0x002e: goto L002e;
+        case 0x0032: goto L0032;
+        case 0x003a: goto L003a;
+        case 0x003c: goto L003c;
+        case 0x003e: goto L003e;
+        case 0x0040: goto L0040;
+        case 0x0042: goto L0042;
+        case 0x0044: goto L0044;
+        case 0x0046: goto L0046;
+        case 0x0048: goto L0048;
+        case 0x004a: goto L004a;
+        case 0x0056: goto L0056;
+        case 0x0064: goto L0064;
+        case 0x006e: goto L006e;
+        case 0x0070: goto L0070;
+        case 0x0074: goto L0074;
+        case 0x007c: goto L007c;
+        case 0x008a: goto L008a;
+        case 0x0092: goto L0092;
+        case 0x00a6: goto L00a6;
+        case 0x00ac: goto L00ac;
+        case 0x00c0: goto L00c0;
+        case 0x00ca: goto L00ca;
+        case 0x00d2: goto L00d2;
+        case 0x00e6: goto L00e6;
+        case 0x00ec: goto L00ec;
+        case 0x0100: goto L0100;
+        case 0x0102: goto L0102;
+        case 0x0106: goto L0106;
+        case 0x010a: goto L010a;
+        case 0x010e: goto L010e;
+        case 0x0112: goto L0112;
+        case 0x0116: goto L0116;
+        case 0x0120: goto L0120;
+        case 0x0124: goto L0124;
+        case 0x0128: goto L0128;
+        case 0x012e: goto L012e;
+        case 0x0130: goto L0130;
+        case 0x0134: goto L0134;
+        case 0x0138: goto L0138;
+        case 0x013c: goto L013c;
+        case 0x0144: goto L0144;
+        case 0x0148: goto L0148;
+        case 0x014c: goto L014c;
+        case 0x0152: goto L0152;
+        case 0x0156: goto L0156;
+        case 0x015a: goto L015a;
+        case 0x015e: goto L015e;
+        case 0x0162: goto L0162;
+        case 0x0166: goto L0166;
+        case 0x0168: goto L0168;
+        case 0x0172: goto L0172;
+        case 0x0178: goto L0178;
+        case 0x017c: goto L017c;
+        case 0x018a: goto L018a;
+        case 0x019c: goto L019c;
+        case 0x01ae: goto L01ae;
+        case 0x01b8: goto L01b8;
+        case 0x01c0: goto L01c0;
+        case 0x01c2: goto L01c2;
+        case 0x01d2: goto L01d2;
+        case 0x01d4: goto L01d4;
+        case 0x01e4: goto L01e4;
+        case 0x01f6: goto L01f6;
+        case 0x0208: goto L0208;
+        case 0x021a: goto L021a;
+        case 0x022c: goto L022c;
+        case 0x023e: goto L023e;
+        case 0x0250: goto L0250;
+        case 0x0262: goto L0262;
+        case 0x0274: goto L0274;
+        case 0x0286: goto L0286;
+        case 0x0298: goto L0298;
+        case 0x02aa: goto L02aa;
+        case 0x02ca: goto L02ca;
+        case 0x02cc: goto L02cc;
+        case 0x02d2: goto L02d2;
+        case 0x02d6: goto L02d6;
+        case 0x02de: goto L02de;
+        case 0x02e2: goto L02e2;
+        case 0x02f4: goto L02f4;
+        case 0x02fa: goto L02fa;
+        case 0x0302: goto L0302;
+        case 0x030c: goto L030c;
+        case 0x031c: goto L031c;
+        case 0x0320: goto L0320;
+        case 0x0326: goto L0326;
+        case 0x032a: goto L032a;
+        case 0x032e: goto L032e;
+        case 0x0340: goto L0340;
+        case 0x0348: goto L0348;
+        case 0x0364: goto L0364;
+        case 0x036e: goto L036e;
+        case 0x0374: goto L0374;
+        case 0x0376: goto L0376;
+        case 0x037e: goto L037e;
+        case 0x0392: goto L0392;
+        case 0x039a: goto L039a;
+        case 0x03a2: goto L03a2;
+        case 0x03a8: goto L03a8;
+        case 0x03c0: goto L03c0;
+        case 0x03c6: goto L03c6;
+        case 0x03ca: goto L03ca;
+        case 0x03d2: goto L03d2;
+        case 0x03d8: goto L03d8;
+        case 0x03e6: goto L03e6;
+        case 0x03ee: goto L03ee;
+        case 0x03f6: goto L03f6;
+        case 0x03fc: goto L03fc;
+        case 0x0402: goto L0402;
+        case 0x040a: goto L040a;
+        case 0x0410: goto L0410;
+        case 0x0414: goto L0414;
+        case 0x041a: goto L041a;
+        case 0x0420: goto L0420;
+        case 0x042c: goto L042c;
+        case 0x0436: goto L0436;
+        case 0x043e: goto L043e;
+        case 0x044c: goto L044c;
+        case 0x0454: goto L0454;
+        case 0x045c: goto L045c;
+        case 0x0464: goto L0464;
+        case 0x0470: goto L0470;
+        case 0x0476: goto L0476;
+        case 0x0484: goto L0484;
+        case 0x048c: goto L048c;
+        case 0x0490: goto L0490;
+        case 0x0492: goto L0492;
+        case 0x0496: goto L0496;
+        case 0x049a: goto L049a;
+        case 0x04a6: goto L04a6;
+        case 0x04ac: goto L04ac;
+        case 0x04b8: goto L04b8;
+        case 0x04ba: goto L04ba;
+        case 0x04c2: goto L04c2;
+        case 0x04c8: goto L04c8;
+        case 0x04ce: goto L04ce;
+        case 0x04d4: goto L04d4;
+        case 0x04da: goto L04da;
+        case 0x04de: goto L04de;
+        case 0x04e4: goto L04e4;
+        case 0x04e6: goto L04e6;
+        case 0x04ee: goto L04ee;
+        case 0x04f2: goto L04f2;
+        case 0x04f6: goto L04f6;
+        case 0x04fc: goto L04fc;
+        case 0x0502: goto L0502;
+        case 0x0508: goto L0508;
+        case 0x0512: goto L0512;
+        case 0x0518: goto L0518;
+        case 0x0522: goto L0522;
+        case 0x0526: goto L0526;
+        case 0x052a: goto L052a;
+        case 0x052e: goto L052e;
+        case 0x053c: goto L053c;
+        case 0x054c: goto L054c;
+        case 0x0556: goto L0556;
+        case 0x055e: goto L055e;
+        case 0x0566: goto L0566;
+        case 0x056c: goto L056c;
+        case 0x0572: goto L0572;
+        case 0x057c: goto L057c;
+        case 0x0582: goto L0582;
+        case 0x0588: goto L0588;
+        case 0x058e: goto L058e;
+        case 0x0598: goto L0598;
+        case 0x059c: goto L059c;
+        case 0x05a0: goto L05a0;
+        case 0x05a6: goto L05a6;
+        case 0x05aa: goto L05aa;
+        case 0x05b0: goto L05b0;
+        case 0x05ba: goto L05ba;
+        case 0x05c6: goto L05c6;
+        case 0x05ce: goto L05ce;
+        case 0x05da: goto L05da;
+        case 0x05dc: goto L05dc;
+        case 0x05e2: goto L05e2;
+        case 0x05f4: goto L05f4;
+        case 0x05fa: goto L05fa;
+        case 0x05fe: goto L05fe;
+        case 0x0602: goto L0602;
+        case 0x0604: goto L0604;
+        case 0x0610: goto L0610;
+        case 0x0612: goto L0612;
+        case 0x0618: goto L0618;
+        case 0x061c: goto L061c;
+        case 0x0622: goto L0622;
+        case 0x0628: goto L0628;
+        case 0x0638: goto L0638;
+        case 0x0642: goto L0642;
+        case 0x0646: goto L0646;
+        case 0x0656: goto L0656;
+        case 0x0658: goto L0658;
+        case 0x065c: goto L065c;
+        case 0x0662: goto L0662;
+        case 0x066a: goto L066a;
+        case 0x0670: goto L0670;
+        case 0x0672: goto L0672;
+        case 0x0676: goto L0676;
+        case 0x067c: goto L067c;
+        case 0x0686: goto L0686;
+        case 0x068a: goto L068a;
+        case 0x0692: goto L0692;
+        case 0x0698: goto L0698;
+        case 0x069c: goto L069c;
+        case 0x06a2: goto L06a2;
+        case 0x06ac: goto L06ac;
+        case 0x06d6: goto L06d6;
+        case 0x06dc: goto L06dc;
+        case 0x06e0: goto L06e0;
+        case 0x06e4: goto L06e4;
+        case 0x06ea: goto L06ea;
+        case 0x06ee: goto L06ee;
+        case 0x06f2: goto L06f2;
+        case 0x06fe: goto L06fe;
+        case 0x0704: goto L0704;
+        case 0x0706: goto L0706;
+        case 0x070a: goto L070a;
+        case 0x0714: goto L0714;
+        case 0x071a: goto L071a;
+        case 0x0720: goto L0720;
+        case 0x0722: goto L0722;
+        case 0x0726: goto L0726;
+        case 0x072a: goto L072a;
+        case 0x072c: goto L072c;
+        case 0x0732: goto L0732;
+        case 0x0738: goto L0738;
+        case 0x076a: goto L076a;
+        case 0x0770: goto L0770;
+        case 0x0774: goto L0774;
+        case 0x0778: goto L0778;
+        case 0x077e: goto L077e;
+        case 0x0784: goto L0784;
+        case 0x0788: goto L0788;
+        case 0x078c: goto L078c;
+        case 0x0796: goto L0796;
+        case 0x07a4: goto L07a4;
+        case 0x07aa: goto L07aa;
+        case 0x07b0: goto L07b0;
+        case 0x07b8: goto L07b8;
+        case 0x07bc: goto L07bc;
+        case 0x07c0: goto L07c0;
+        case 0x07c6: goto L07c6;
+        case 0x07cc: goto L07cc;
+        case 0x07ce: goto L07ce;
+        case 0x07da: goto L07da;
+        case 0x07e4: goto L07e4;
+        case 0x07ec: goto L07ec;
+        case 0x07f2: goto L07f2;
+        case 0x07f8: goto L07f8;
+        case 0x0802: goto L0802;
+        case 0x080c: goto L080c;
+        case 0x0810: goto L0810;
+        case 0x0814: goto L0814;
+        case 0x081a: goto L081a;
+        case 0x0820: goto L0820;
+        case 0x0826: goto L0826;
+        case 0x082c: goto L082c;
+        case 0x0842: goto L0842;
+        case 0x084a: goto L084a;
+        case 0x0850: goto L0850;
+        case 0x0856: goto L0856;
+        case 0x085e: goto L085e;
+        case 0x0862: goto L0862;
+        case 0x0866: goto L0866;
+        case 0x086a: goto L086a;
+        case 0x0870: goto L0870;
+        case 0x087c: goto L087c;
+        case 0x088a: goto L088a;
+        case 0x0892: goto L0892;
+        case 0x0896: goto L0896;
+        case 0x089a: goto L089a;
+        case 0x08a0: goto L08a0;
+        case 0x08a6: goto L08a6;
+        case 0x08ac: goto L08ac;
+        case 0x08b2: goto L08b2;
+        case 0x08b8: goto L08b8;
+        case 0x08be: goto L08be;
+        case 0x08c4: goto L08c4;
+        case 0x08c8: goto L08c8;
+        case 0x08cc: goto L08cc;
+        case 0x08d0: goto L08d0;
+        case 0x08dc: goto L08dc;
+        case 0x08e0: goto L08e0;
+        case 0x08e4: goto L08e4;
+        case 0x08ea: goto L08ea;
+        case 0x08f0: goto L08f0;
+        case 0x08f6: goto L08f6;
+        case 0x08fc: goto L08fc;
+        case 0x0900: goto L0900;
+        case 0x0904: goto L0904;
+        case 0x090c: goto L090c;
+        case 0x0912: goto L0912;
+        case 0x091a: goto L091a;
+        case 0x092c: goto L092c;
+        case 0x093e: goto L093e;
+        case 0x0944: goto L0944;
+        case 0x094e: goto L094e;
+        case 0x0952: goto L0952;
+        case 0x095c: goto L095c;
+        case 0x0960: goto L0960;
+        case 0x0968: goto L0968;
+        case 0x0994: goto L0994;
+        case 0x099a: goto L099a;
+        case 0x09a0: goto L09a0;
+        case 0x09a2: goto L09a2;
+        case 0x09aa: goto L09aa;
+        case 0x09b2: goto L09b2;
+        case 0x09ba: goto L09ba;
+        case 0x09c2: goto L09c2;
+        case 0x09c8: goto L09c8;
+        case 0x09d0: goto L09d0;
+        case 0x09e2: goto L09e2;
+        case 0x09ee: goto L09ee;
+        case 0x0a00: goto L0a00;
+        case 0x0a06: goto L0a06;
+        case 0x0a0a: goto L0a0a;
+        case 0x0a0e: goto L0a0e;
+        case 0x0a14: goto L0a14;
+        case 0x0a1a: goto L0a1a;
+        case 0x0a38: goto L0a38;
+        case 0x0a40: goto L0a40;
+        case 0x0a46: goto L0a46;
+        case 0x0a4c: goto L0a4c;
+        case 0x0a52: goto L0a52;
+        case 0x0a58: goto L0a58;
+        case 0x0a5a: goto L0a5a;
+        case 0x0a62: goto L0a62;
+        case 0x0a68: goto L0a68;
+        case 0x0a6c: goto L0a6c;
+        case 0x0a7a: goto L0a7a;
+        case 0x0a80: goto L0a80;
+        case 0x0a86: goto L0a86;
+        case 0x0a8c: goto L0a8c;
+        case 0x0a92: goto L0a92;
+        case 0x0a9a: goto L0a9a;
+        case 0x0aa0: goto L0aa0;
+        case 0x0aa4: goto L0aa4;
+        case 0x0aaa: goto L0aaa;
+        case 0x0acc: goto L0acc;
+        case 0x0ad0: goto L0ad0;
+        case 0x0ade: goto L0ade;
+        case 0x0ae6: goto L0ae6;
+        case 0x0aec: goto L0aec;
+        case 0x0af2: goto L0af2;
+        case 0x0afa: goto L0afa;
+        case 0x0b34: goto L0b34;
+        case 0x0b38: goto L0b38;
+        case 0x0b4a: goto L0b4a;
+        case 0x0b50: goto L0b50;
+        case 0x0b52: goto L0b52;
+        case 0x0b58: goto L0b58;
+        case 0x0b5e: goto L0b5e;
+        case 0x0b64: goto L0b64;
+        case 0x0b6a: goto L0b6a;
+        case 0x0b74: goto L0b74;
+        case 0x0bb4: goto L0bb4;
+        case 0x0bb8: goto L0bb8;
+        case 0x0bbc: goto L0bbc;
+        case 0x0bc0: goto L0bc0;
+        case 0x0bc6: goto L0bc6;
+        case 0x0bcc: goto L0bcc;
+        case 0x0bd0: goto L0bd0;
+        case 0x0bd2: goto L0bd2;
+        case 0x0bd6: goto L0bd6;
+        case 0x0bde: goto L0bde;
+        case 0x0bea: goto L0bea;
+        case 0x0bf0: goto L0bf0;
+        case 0x0bf4: goto L0bf4;
+        case 0x0bfa: goto L0bfa;
+        case 0x0c00: goto L0c00;
+        case 0x0c0c: goto L0c0c;
+        case 0x0c12: goto L0c12;
+        case 0x0c18: goto L0c18;
+        case 0x0c1c: goto L0c1c;
+        case 0x0c26: goto L0c26;
+        case 0x0c3c: goto L0c3c;
+        case 0x0c88: goto L0c88;
+        case 0x0c9c: goto L0c9c;
+        case 0x0ca6: goto L0ca6;
+        case 0x0caa: goto L0caa;
+        case 0x0cb6: goto L0cb6;
+        case 0x0cc0: goto L0cc0;
+        case 0x0cc6: goto L0cc6;
+        case 0x0ccc: goto L0ccc;
+        case 0x0cd4: goto L0cd4;
+        case 0x0cda: goto L0cda;
+        case 0x0ce0: goto L0ce0;
+        case 0x0ce6: goto L0ce6;
+        case 0x0cee: goto L0cee;
+        case 0x0cf0: goto L0cf0;
+        case 0x0cf4: goto L0cf4;
+        case 0x0cf8: goto L0cf8;
+        case 0x0cfc: goto L0cfc;
+        case 0x0d00: goto L0d00;
+        case 0x0d04: goto L0d04;
+        case 0x0d12: goto L0d12;
+        case 0x0d18: goto L0d18;
+        case 0x0d3a: goto L0d3a;
+        case 0x0d4c: goto L0d4c;
+        case 0x0d52: goto L0d52;
+        case 0x0d58: goto L0d58;
+        case 0x0d64: goto L0d64;
+        case 0x0d6a: goto L0d6a;
+        case 0x0d6e: goto L0d6e;
+        case 0x0d78: goto L0d78;
+        case 0x0d7c: goto L0d7c;
+        case 0x0d80: goto L0d80;
+        case 0x0d90: goto L0d90;
+        case 0x0d94: goto L0d94;
+        case 0x0d9a: goto L0d9a;
+        case 0x0da0: goto L0da0;
+        case 0x0da8: goto L0da8;
+        case 0x0dac: goto L0dac;
+        case 0x0db2: goto L0db2;
+        case 0x0dbe: goto L0dbe;
+        case 0x0dc4: goto L0dc4;
+        case 0x0dcc: goto L0dcc;
+        case 0x0dd4: goto L0dd4;
+        case 0x0dda: goto L0dda;
+        case 0x0de2: goto L0de2;
+        case 0x0dea: goto L0dea;
+        case 0x0e02: goto L0e02;
+        case 0x0e08: goto L0e08;
+        case 0x0e14: goto L0e14;
+        case 0x0e1a: goto L0e1a;
+        case 0x0e2a: goto L0e2a;
+        case 0x0e3c: goto L0e3c;
+        case 0x0e46: goto L0e46;
+        case 0x0e52: goto L0e52;
+        case 0x0e5c: goto L0e5c;
+        case 0x0e66: goto L0e66;
+        case 0x0e74: goto L0e74;
+        case 0x0e7a: goto L0e7a;
+        case 0x0e7e: goto L0e7e;
+        case 0x0e90: goto L0e90;
+        case 0x0e94: goto L0e94;
+        case 0x0e96: goto L0e96;
+        case 0x0e9e: goto L0e9e;
+        case 0x0ea0: goto L0ea0;
+        case 0x0ea8: goto L0ea8;
+        case 0x0eac: goto L0eac;
+        case 0x0eb8: goto L0eb8;
+        case 0x0ec2: goto L0ec2;
+        case 0x0eca: goto L0eca;
+        case 0x0ecc: goto L0ecc;
+        case 0x0ed2: goto L0ed2;
+        case 0x0ed8: goto L0ed8;
+        case 0x0ede: goto L0ede;
+        case 0x0eea: goto L0eea;
+        case 0x0ef0: goto L0ef0;
+        case 0x0efc: goto L0efc;
+        case 0x0f02: goto L0f02;
+        case 0x0f08: goto L0f08;
+        case 0x0f0e: goto L0f0e;
+        case 0x0f1a: goto L0f1a;
+        case 0x0f1e: goto L0f1e;
+        case 0x0f20: goto L0f20;
+        case 0x0f26: goto L0f26;
+        case 0x0f3e: goto L0f3e;
+        case 0x0f4a: goto L0f4a;
+        case 0x0f54: goto L0f54;
+        case 0x0f60: goto L0f60;
+        case 0x0f68: goto L0f68;
+        case 0x0f70: goto L0f70;
+        case 0x0f74: goto L0f74;
+        case 0x0f78: goto L0f78;
+        case 0x0f7c: goto L0f7c;
+        case 0x0f80: goto L0f80;
+        case 0x0f8a: goto L0f8a;
+        case 0x0f92: goto L0f92;
+        case 0x0f98: goto L0f98;
+        case 0x0f9e: goto L0f9e;
+        case 0x0faa: goto L0faa;
+        case 0x0fb2: goto L0fb2;
+        case 0x0fb8: goto L0fb8;
+        case 0x0fc0: goto L0fc0;
+        case 0x0fc4: goto L0fc4;
+        case 0x0fce: goto L0fce;
+        case 0x0fd0: goto L0fd0;
+        case 0x0fdc: goto L0fdc;
+        case 0x0fe0: goto L0fe0;
+        case 0x0fe6: goto L0fe6;
+        case 0x0fec: goto L0fec;
+        case 0x0ff8: goto L0ff8;
+        case 0x1002: goto L1002;
+        case 0x100e: goto L100e;
+        case 0x1014: goto L1014;
+        case 0x1018: goto L1018;
+        case 0x103c: goto L103c;
+        case 0x1042: goto L1042;
+        case 0x1048: goto L1048;
+        case 0x1050: goto L1050;
+        case 0x1058: goto L1058;
+        case 0x105e: goto L105e;
+        case 0x106a: goto L106a;
+        case 0x1070: goto L1070;
+        case 0x107c: goto L107c;
+        case 0x1082: goto L1082;
+        case 0x1092: goto L1092;
+        case 0x1096: goto L1096;
+        case 0x10a2: goto L10a2;
+        case 0x10a8: goto L10a8;
+        case 0x10b4: goto L10b4;
+        case 0x10ba: goto L10ba;
+        case 0x10be: goto L10be;
+        case 0x10ce: goto L10ce;
+        case 0x10dc: goto L10dc;
+        case 0x10e8: goto L10e8;
+        case 0x10ee: goto L10ee;
+        case 0x10f4: goto L10f4;
+        case 0x1100: goto L1100;
+        case 0x1106: goto L1106;
+        case 0x1116: goto L1116;
+        case 0x1118: goto L1118;
+        case 0x1128: goto L1128;
+        case 0x1136: goto L1136;
+        case 0x1144: goto L1144;
+        case 0x114a: goto L114a;
+        case 0x1152: goto L1152;
+        case 0x115a: goto L115a;
+        case 0x115e: goto L115e;
+        case 0x1166: goto L1166;
+        case 0x116e: goto L116e;
+        case 0x117a: goto L117a;
+        case 0x117e: goto L117e;
+        case 0x1186: goto L1186;
+        case 0x118e: goto L118e;
+        case 0x1198: goto L1198;
+        case 0x11a6: goto L11a6;
+        case 0x11ac: goto L11ac;
+        case 0x11d0: goto L11d0;
+        case 0x11da: goto L11da;
+        case 0x11de: goto L11de;
+        case 0x11e2: goto L11e2;
+        case 0x1204: goto L1204;
+        case 0x120c: goto L120c;
+        case 0x1212: goto L1212;
+        case 0x1216: goto L1216;
+        case 0x121a: goto L121a;
+        case 0x121e: goto L121e;
+        case 0x1232: goto L1232;
+        case 0x123c: goto L123c;
+        case 0x1240: goto L1240;
+        case 0x1246: goto L1246;
+        case 0x1250: goto L1250;
+        case 0x1256: goto L1256;
+        case 0x125c: goto L125c;
+        case 0x1262: goto L1262;
+        case 0x1272: goto L1272;
+        case 0x1284: goto L1284;
+        case 0x128a: goto L128a;
+        case 0x1292: goto L1292;
+        case 0x12c4: goto L12c4;
+        case 0x12c6: goto L12c6;
+        case 0x12ca: goto L12ca;
+        case 0x12d2: goto L12d2;
+        case 0x12dc: goto L12dc;
+        case 0x12e2: goto L12e2;
+        case 0x12ea: goto L12ea;
+        case 0x12ee: goto L12ee;
+        case 0x12f4: goto L12f4;
+        case 0x12fa: goto L12fa;
+        case 0x1306: goto L1306;
+        case 0x130c: goto L130c;
+        case 0x1310: goto L1310;
+        case 0x1330: goto L1330;
+        case 0x1332: goto L1332;
+        case 0x1338: goto L1338;
+        case 0x133c: goto L133c;
+        case 0x1350: goto L1350;
+        case 0x1356: goto L1356;
+        case 0x135c: goto L135c;
+        case 0x1364: goto L1364;
+        case 0x1368: goto L1368;
+        case 0x1370: goto L1370;
+        case 0x1372: goto L1372;
+        case 0x1376: goto L1376;
+        case 0x137c: goto L137c;
+        case 0x138c: goto L138c;
+        case 0x1392: goto L1392;
+        case 0x1398: goto L1398;
+        case 0x139e: goto L139e;
+        case 0x13a4: goto L13a4;
+        case 0x13aa: goto L13aa;
+        case 0x13ac: goto L13ac;
+        case 0x13b0: goto L13b0;
+        case 0x13b6: goto L13b6;
+        case 0x13bc: goto L13bc;
+        case 0x13c4: goto L13c4;
+        case 0x13ce: goto L13ce;
+        case 0x13d8: goto L13d8;
+        case 0x13e4: goto L13e4;
+        case 0x13ea: goto L13ea;
+        case 0x13f0: goto L13f0;
+        case 0x13f2: goto L13f2;
+        case 0x13f6: goto L13f6;
+        case 0x13fa: goto L13fa;
+        case 0x1402: goto L1402;
+        case 0x1408: goto L1408;
+        case 0x1410: goto L1410;
+        case 0x1414: goto L1414;
+        case 0x141e: goto L141e;
+        case 0x1424: goto L1424;
+        case 0x1428: goto L1428;
+        case 0x142e: goto L142e;
+        case 0x143c: goto L143c;
+        case 0x1448: goto L1448;
+        case 0x144c: goto L144c;
+        case 0x1452: goto L1452;
+        case 0x1454: goto L1454;
+        case 0x1458: goto L1458;
+        case 0x1468: goto L1468;
+        case 0x146c: goto L146c;
+        case 0x1470: goto L1470;
+        case 0x1474: goto L1474;
+        case 0x1478: goto L1478;
+        case 0x147c: goto L147c;
+        case 0x1480: goto L1480;
+        case 0x1484: goto L1484;
+        case 0x1492: goto L1492;
+        case 0x14aa: goto L14aa;
+        case 0x14ae: goto L14ae;
+        case 0x14b4: goto L14b4;
+        case 0x14ba: goto L14ba;
+        case 0x14c4: goto L14c4;
+        case 0x14ca: goto L14ca;
+        case 0x14d2: goto L14d2;
+        case 0x14ec: goto L14ec;
+        case 0x14f4: goto L14f4;
+        case 0x14fa: goto L14fa;
+        case 0x1506: goto L1506;
+        case 0x1510: goto L1510;
+        case 0x1516: goto L1516;
+        case 0x1524: goto L1524;
+        case 0x152a: goto L152a;
+        case 0x153c: goto L153c;
+        case 0x1548: goto L1548;
+        case 0x1566: goto L1566;
+        case 0x156a: goto L156a;
+        case 0x156e: goto L156e;
+        case 0x1574: goto L1574;
+        case 0x157c: goto L157c;
+        case 0x1584: goto L1584;
+        case 0x1588: goto L1588;
+        case 0x158e: goto L158e;
+        case 0x1590: goto L1590;
+        case 0x1594: goto L1594;
+        case 0x15a2: goto L15a2;
+        case 0x15a8: goto L15a8;
+        case 0x15ac: goto L15ac;
+        case 0x15ba: goto L15ba;
+        case 0x15bc: goto L15bc;
+        case 0x15cc: goto L15cc;
+        case 0x15de: goto L15de;
+        case 0x15e4: goto L15e4;
+        case 0x15ee: goto L15ee;
+        case 0x15f6: goto L15f6;
+        case 0x15f8: goto L15f8;
+        case 0x1602: goto L1602;
+        case 0x160c: goto L160c;
+        case 0x1612: goto L1612;
+        case 0x1616: goto L1616;
+        case 0x161c: goto L161c;
+        case 0x1624: goto L1624;
+        case 0x162c: goto L162c;
+        case 0x1632: goto L1632;
+        case 0x1634: goto L1634;
+        case 0x1644: goto L1644;
+        case 0x164e: goto L164e;
+        case 0x165a: goto L165a;
+        case 0x165e: goto L165e;
+        case 0x166e: goto L166e;
+        case 0x1672: goto L1672;
+        case 0x167a: goto L167a;
+        case 0x168c: goto L168c;
+        case 0x1692: goto L1692;
+        case 0x1694: goto L1694;
+        case 0x1698: goto L1698;
+        case 0x16a6: goto L16a6;
+        case 0x16aa: goto L16aa;
+        case 0x16ae: goto L16ae;
+        case 0x16b8: goto L16b8;
+        case 0x16cc: goto L16cc;
+        case 0x16d2: goto L16d2;
+        case 0x16d4: goto L16d4;
+        case 0x16d8: goto L16d8;
+        case 0x16da: goto L16da;
+        case 0x16e6: goto L16e6;
+        case 0x16ec: goto L16ec;
+        case 0x16fa: goto L16fa;
+        case 0x1702: goto L1702;
+        case 0x170a: goto L170a;
+        case 0x1710: goto L1710;
+        case 0x1718: goto L1718;
+        case 0x171c: goto L171c;
+        case 0x1748: goto L1748;
+        case 0x1756: goto L1756;
+        case 0x1758: goto L1758;
+        case 0x175c: goto L175c;
+        case 0x1760: goto L1760;
+        case 0x1766: goto L1766;
+        case 0x176e: goto L176e;
+        case 0x1774: goto L1774;
+        case 0x177c: goto L177c;
+        case 0x1784: goto L1784;
+        case 0x178c: goto L178c;
+        case 0x1790: goto L1790;
+        case 0x1796: goto L1796;
+        case 0x179c: goto L179c;
+        case 0x17a2: goto L17a2;
+        case 0x17ac: goto L17ac;
+        case 0x17b2: goto L17b2;
+        case 0x17be: goto L17be;
+        case 0x17c2: goto L17c2;
+        case 0x17ce: goto L17ce;
+        case 0x17d8: goto L17d8;
+        case 0x17de: goto L17de;
+        case 0x17ea: goto L17ea;
+        case 0x17f6: goto L17f6;
+        case 0x17fc: goto L17fc;
+        case 0x1802: goto L1802;
+        case 0x1806: goto L1806;
+        case 0x180a: goto L180a;
+        case 0x1810: goto L1810;
+        case 0x1818: goto L1818;
+        case 0x181c: goto L181c;
+        case 0x1822: goto L1822;
+        case 0x182e: goto L182e;
+        case 0x1832: goto L1832;
+        case 0x1834: goto L1834;
+        case 0x1838: goto L1838;
+        case 0x183c: goto L183c;
+        case 0x1854: goto L1854;
+        case 0x185a: goto L185a;
+        case 0x1874: goto L1874;
+        case 0x1884: goto L1884;
+        case 0x188e: goto L188e;
+        case 0x1892: goto L1892;
+        case 0x18a0: goto L18a0;
+        case 0x18a4: goto L18a4;
+        case 0x18ac: goto L18ac;
+        case 0x18b4: goto L18b4;
+        case 0x18bc: goto L18bc;
+        case 0x18e2: goto L18e2;
+        case 0x18f2: goto L18f2;
+        case 0x18f8: goto L18f8;
+        case 0x18fe: goto L18fe;
+        case 0x1904: goto L1904;
+        case 0x1908: goto L1908;
+        case 0x190c: goto L190c;
+        case 0x1910: goto L1910;
+        case 0x1944: goto L1944;
+        case 0x1948: goto L1948;
+        case 0x194c: goto L194c;
+        case 0x1952: goto L1952;
+        case 0x1976: goto L1976;
+        case 0x1980: goto L1980;
+        case 0x1986: goto L1986;
+        case 0x198c: goto L198c;
+        case 0x1992: goto L1992;
+        case 0x1998: goto L1998;
+        case 0x199e: goto L199e;
+        case 0x19a4: goto L19a4;
+        case 0x19aa: goto L19aa;
+        case 0x19ac: goto L19ac;
+        case 0x19b2: goto L19b2;
+        case 0x19b8: goto L19b8;
+        case 0x19c0: goto L19c0;
+        case 0x19da: goto L19da;
+        case 0x19dc: goto L19dc;
+        case 0x19e0: goto L19e0;
+        case 0x19e4: goto L19e4;
+        case 0x19e8: goto L19e8;
+        case 0x19f8: goto L19f8;
+        case 0x19fe: goto L19fe;
+        case 0x1a06: goto L1a06;
+        case 0x1a0c: goto L1a0c;
+        case 0x1a18: goto L1a18;
+        case 0x1a1a: goto L1a1a;
+        case 0x1a20: goto L1a20;
+        case 0x1a28: goto L1a28;
+        case 0x1a32: goto L1a32;
+        case 0x1a48: goto L1a48;
+        case 0x1a4e: goto L1a4e;
+        case 0x1a5e: goto L1a5e;
+        case 0x1a72: goto L1a72;
+        case 0x1a76: goto L1a76;
+        case 0x1a7c: goto L1a7c;
+        case 0x1a82: goto L1a82;
+        case 0x1a84: goto L1a84;
+        case 0x1a9c: goto L1a9c;
+        case 0x1aa0: goto L1aa0;
+        case 0x1aae: goto L1aae;
+        case 0x1ab2: goto L1ab2;
+        case 0x1ab6: goto L1ab6;
+        case 0x1abc: goto L1abc;
+        case 0x1ac0: goto L1ac0;
+        case 0x1aca: goto L1aca;
+        case 0x1ad0: goto L1ad0;
+        case 0x1ad2: goto L1ad2;
+        case 0x1ae6: goto L1ae6;
+        case 0x1aec: goto L1aec;
+        case 0x1af0: goto L1af0;
+        case 0x1af4: goto L1af4;
+        case 0x1af8: goto L1af8;
+        case 0x1afe: goto L1afe;
+        case 0x1b0a: goto L1b0a;
+        case 0x1b10: goto L1b10;
+        case 0x1b18: goto L1b18;
+        case 0x1b1e: goto L1b1e;
+        case 0x1b2a: goto L1b2a;
+        case 0x1b30: goto L1b30;
+        case 0x1b36: goto L1b36;
+        case 0x1b38: goto L1b38;
+        case 0x1b3e: goto L1b3e;
+        case 0x1b40: goto L1b40;
+        case 0x1b44: goto L1b44;
+        case 0x1b48: goto L1b48;
+        case 0x1b52: goto L1b52;
+        case 0x1b58: goto L1b58;
+        case 0x1b5e: goto L1b5e;
+        case 0x1b62: goto L1b62;
+        case 0x1b68: goto L1b68;
+        case 0x1b6e: goto L1b6e;
+        case 0x1b70: goto L1b70;
+        case 0x1b76: goto L1b76;
+        case 0x1b78: goto L1b78;
+        case 0x1b7e: goto L1b7e;
+        case 0x1b80: goto L1b80;
+        case 0x1b86: goto L1b86;
+        case 0x1b88: goto L1b88;
+        case 0x1b8e: goto L1b8e;
+        case 0x1b90: goto L1b90;
+        case 0x1b96: goto L1b96;
+        case 0x1b98: goto L1b98;
+        case 0x1b9e: goto L1b9e;
+        case 0x1ba0: goto L1ba0;
+        case 0x1ba6: goto L1ba6;
+        case 0x1ba8: goto L1ba8;
+        case 0x1bae: goto L1bae;
+        case 0x1bb0: goto L1bb0;
+        case 0x1bc2: goto L1bc2;
+        case 0x1bc8: goto L1bc8;
+        case 0x1bcc: goto L1bcc;
+        case 0x1bd0: goto L1bd0;
+        case 0x1bd4: goto L1bd4;
+        case 0x1bd8: goto L1bd8;
+        case 0x1bdc: goto L1bdc;
+        case 0x1be0: goto L1be0;
+        case 0x1bf4: goto L1bf4;
+        case 0x1c02: goto L1c02;
+        case 0x1c04: goto L1c04;
+        case 0x1c08: goto L1c08;
+        case 0x1c14: goto L1c14;
+        case 0x1c1a: goto L1c1a;
+        case 0x1c28: goto L1c28;
+        case 0x1c2c: goto L1c2c;
+        case 0x1c30: goto L1c30;
+        case 0x1c34: goto L1c34;
+        case 0x1c38: goto L1c38;
+        case 0x1c3c: goto L1c3c;
+        case 0x1c3e: goto L1c3e;
+        case 0x1c4c: goto L1c4c;
+        case 0x1c52: goto L1c52;
+        case 0x1c58: goto L1c58;
+        case 0x1c60: goto L1c60;
+        case 0x1c64: goto L1c64;
+        case 0x1c6a: goto L1c6a;
+        case 0x1c6c: goto L1c6c;
+        case 0x1c70: goto L1c70;
+        case 0x1c78: goto L1c78;
+        case 0x1c7e: goto L1c7e;
+        case 0x1c82: goto L1c82;
+        case 0x1c86: goto L1c86;
+        case 0x1c94: goto L1c94;
+        case 0x1ca2: goto L1ca2;
+        case 0x1ca8: goto L1ca8;
+        case 0x1cbe: goto L1cbe;
+        case 0x1ccc: goto L1ccc;
+        case 0x1cd0: goto L1cd0;
+        case 0x1cd4: goto L1cd4;
+        case 0x1cd8: goto L1cd8;
+        case 0x1cee: goto L1cee;
+        case 0x1cf8: goto L1cf8;
+        case 0x1cfc: goto L1cfc;
+        case 0x1d00: goto L1d00;
+        case 0x1d04: goto L1d04;
+        case 0x1d14: goto L1d14;
+        case 0x1d1a: goto L1d1a;
+        case 0x1d22: goto L1d22;
+        case 0x1d2a: goto L1d2a;
+        case 0x1d2e: goto L1d2e;
+        case 0x1d32: goto L1d32;
+        case 0x1d3a: goto L1d3a;
+        case 0x1d40: goto L1d40;
+        case 0x1d46: goto L1d46;
+        case 0x1d4c: goto L1d4c;
+        case 0x1d54: goto L1d54;
+        case 0x1d62: goto L1d62;
+        case 0x1d68: goto L1d68;
+        case 0x1d74: goto L1d74;
+        case 0x1d7a: goto L1d7a;
+        case 0x1d7e: goto L1d7e;
+        case 0x1d8a: goto L1d8a;
+        case 0x1d96: goto L1d96;
+        case 0x1d9e: goto L1d9e;
+        case 0x1dac: goto L1dac;
+        case 0x1db4: goto L1db4;
+        case 0x1dba: goto L1dba;
+        case 0x1dc0: goto L1dc0;
+        case 0x1dcc: goto L1dcc;
+        case 0x1dde: goto L1dde;
+        case 0x1de4: goto L1de4;
+        case 0x1de8: goto L1de8;
+        case 0x1dee: goto L1dee;
+        case 0x1df2: goto L1df2;
+        case 0x1dfa: goto L1dfa;
+        case 0x1e0c: goto L1e0c;
+        case 0x1e10: goto L1e10;
+        case 0x1e14: goto L1e14;
+        case 0x1e18: goto L1e18;
+        case 0x1e30: goto L1e30;
+        case 0x1e38: goto L1e38;
+        case 0x1e40: goto L1e40;
+        case 0x1e46: goto L1e46;
+        case 0x1e4a: goto L1e4a;
+        case 0x1e58: goto L1e58;
+        case 0x1e5c: goto L1e5c;
+        case 0x1e60: goto L1e60;
+        case 0x1e64: goto L1e64;
+        case 0x1e68: goto L1e68;
+        case 0x1e6e: goto L1e6e;
+        case 0x1e72: goto L1e72;
+        case 0x1e74: goto L1e74;
+        case 0x1e80: goto L1e80;
+        case 0x1e84: goto L1e84;
+        case 0x1e92: goto L1e92;
+        case 0x1e98: goto L1e98;
+        case 0x1e9e: goto L1e9e;
+        case 0x1ea4: goto L1ea4;
+        case 0x1eaa: goto L1eaa;
+        case 0x1eae: goto L1eae;
+        case 0x1eb0: goto L1eb0;
+        case 0x1eb6: goto L1eb6;
+        case 0x1eba: goto L1eba;
+        case 0x1ebc: goto L1ebc;
+        case 0x1ec0: goto L1ec0;
+        case 0x1ec4: goto L1ec4;
+        case 0x1eca: goto L1eca;
+        case 0x1ecc: goto L1ecc;
+        case 0x1ed0: goto L1ed0;
+        case 0x1ed4: goto L1ed4;
+        case 0x1ed6: goto L1ed6;
+        case 0x1ee2: goto L1ee2;
+        case 0x1ee4: goto L1ee4;
+        case 0x1ee6: goto L1ee6;
+        case 0x1eea: goto L1eea;
+        case 0x1efc: goto L1efc;
+        case 0x1f00: goto L1f00;
+        case 0x1f04: goto L1f04;
+        case 0x1f08: goto L1f08;
+        case 0x1f0e: goto L1f0e;
+        case 0x1f14: goto L1f14;
+        case 0x1f1a: goto L1f1a;
+        case 0x1f28: goto L1f28;
+        case 0x1f2c: goto L1f2c;
+        case 0x1f32: goto L1f32;
+        case 0x1f36: goto L1f36;
+        case 0x1f3a: goto L1f3a;
+        case 0x1f46: goto L1f46;
+        case 0x1f4a: goto L1f4a;
+        case 0x1f4e: goto L1f4e;
+        case 0x1f5c: goto L1f5c;
+        case 0x1f60: goto L1f60;
+        case 0x1f70: goto L1f70;
+        case 0x1f78: goto L1f78;
+        case 0x1f7c: goto L1f7c;
+        case 0x1f80: goto L1f80;
+        case 0x1f84: goto L1f84;
+        case 0x1f90: goto L1f90;
+        case 0x1f92: goto L1f92;
+        case 0x1f9e: goto L1f9e;
+        case 0x1fa2: goto L1fa2;
+        case 0x1fa8: goto L1fa8;
+        case 0x1faa: goto L1faa;
+        case 0x1fb4: goto L1fb4;
+        case 0x1fb6: goto L1fb6;
+        case 0x1fc0: goto L1fc0;
+        case 0x1fc2: goto L1fc2;
+        case 0x1fc8: goto L1fc8;
+        case 0x1fca: goto L1fca;
+        case 0x1fdc: goto L1fdc;
+        case 0x1fe4: goto L1fe4;
+        case 0x1fea: goto L1fea;
+        case 0x1ffc: goto L1ffc;
+        case 0x2000: goto L2000;
+        case 0x2006: goto L2006;
+        case 0x2012: goto L2012;
+        case 0x2018: goto L2018;
+        case 0x2022: goto L2022;
+        case 0x202e: goto L202e;
+        case 0x2034: goto L2034;
+        case 0x203a: goto L203a;
+        case 0x2042: goto L2042;
+        case 0x2044: goto L2044;
+        case 0x2046: goto L2046;
+        case 0x204c: goto L204c;
+        case 0x2056: goto L2056;
+        case 0x2060: goto L2060;
+        case 0x2062: goto L2062;
+        case 0x2066: goto L2066;
+        case 0x206c: goto L206c;
+        case 0x2072: goto L2072;
+        case 0x207a: goto L207a;
+        case 0x2080: goto L2080;
+        case 0x208e: goto L208e;
+        case 0x209c: goto L209c;
+        case 0x20a2: goto L20a2;
+        case 0x20b0: goto L20b0;
+        case 0x20b2: goto L20b2;
+        case 0x20b6: goto L20b6;
+        case 0x20b8: goto L20b8;
+        case 0x20be: goto L20be;
+        case 0x20c8: goto L20c8;
+        case 0x20d2: goto L20d2;
+        case 0x20d4: goto L20d4;
+        case 0x20d8: goto L20d8;
+        case 0x20de: goto L20de;
+        case 0x20e2: goto L20e2;
+        case 0x20f6: goto L20f6;
+        case 0x2102: goto L2102;
+        case 0x210a: goto L210a;
+        case 0x212a: goto L212a;
+        case 0x2134: goto L2134;
+        case 0x213a: goto L213a;
+        case 0x2140: goto L2140;
+        case 0x214a: goto L214a;
+        case 0x214e: goto L214e;
+        case 0x2156: goto L2156;
+        case 0x2162: goto L2162;
+        case 0x216a: goto L216a;
+        case 0x2172: goto L2172;
+        case 0x2180: goto L2180;
+        case 0x218a: goto L218a;
+        case 0x219a: goto L219a;
+        case 0x219e: goto L219e;
+        case 0x21aa: goto L21aa;
+        case 0x21b0: goto L21b0;
+        case 0x21ba: goto L21ba;
+        case 0x21be: goto L21be;
+        case 0x21c4: goto L21c4;
+        case 0x21da: goto L21da;
+        case 0x21e0: goto L21e0;
+        case 0x21e8: goto L21e8;
+        case 0x21fe: goto L21fe;
+        case 0x2204: goto L2204;
+        case 0x220e: goto L220e;
+        case 0x2212: goto L2212;
+        case 0x2216: goto L2216;
+        case 0x2220: goto L2220;
+        case 0x2226: goto L2226;
+        case 0x222a: goto L222a;
+        case 0x2230: goto L2230;
+        case 0x2234: goto L2234;
+        case 0x2248: goto L2248;
+        case 0x2250: goto L2250;
+        case 0x2256: goto L2256;
+        case 0x2262: goto L2262;
+        case 0x2266: goto L2266;
+        case 0x226a: goto L226a;
+        case 0x2272: goto L2272;
+        case 0x227a: goto L227a;
+        case 0x2282: goto L2282;
+        case 0x2286: goto L2286;
+        case 0x2296: goto L2296;
+        case 0x22a2: goto L22a2;
+        case 0x22a4: goto L22a4;
+        case 0x22a8: goto L22a8;
+        case 0x22ae: goto L22ae;
+        case 0x22b4: goto L22b4;
+        case 0x22be: goto L22be;
+        case 0x22c0: goto L22c0;
+        case 0x22cc: goto L22cc;
+        case 0x22d0: goto L22d0;
+        case 0x22d4: goto L22d4;
+        case 0x22e0: goto L22e0;
+        case 0x22e4: goto L22e4;
+        case 0x22ea: goto L22ea;
+        case 0x22ee: goto L22ee;
+        case 0x22f6: goto L22f6;
+        case 0x22fc: goto L22fc;
+        case 0x2304: goto L2304;
+        case 0x230e: goto L230e;
+        case 0x2312: goto L2312;
+        case 0x2320: goto L2320;
+        case 0x2326: goto L2326;
+        case 0x232a: goto L232a;
+        case 0x2330: goto L2330;
+        case 0x2332: goto L2332;
+        case 0x2338: goto L2338;
+        case 0x233a: goto L233a;
+        case 0x233e: goto L233e;
+        case 0x2342: goto L2342;
+        case 0x234e: goto L234e;
+        case 0x2356: goto L2356;
+        case 0x235e: goto L235e;
+        case 0x2366: goto L2366;
+        case 0x236c: goto L236c;
+        case 0x2370: goto L2370;
+        case 0x2382: goto L2382;
+        case 0x238c: goto L238c;
+        case 0x2390: goto L2390;
+        case 0x2396: goto L2396;
+        case 0x23a0: goto L23a0;
+        case 0x23a4: goto L23a4;
+        case 0x23aa: goto L23aa;
+        case 0x23b2: goto L23b2;
+        case 0x23b8: goto L23b8;
+        case 0x23ba: goto L23ba;
+        case 0x23bc: goto L23bc;
+        case 0x23be: goto L23be;
+        case 0x23c0: goto L23c0;
+        case 0x23c4: goto L23c4;
+        case 0x23ce: goto L23ce;
+        case 0x23f2: goto L23f2;
+        case 0x2400: goto L2400;
+        case 0x2406: goto L2406;
+        case 0x240a: goto L240a;
+        case 0x2410: goto L2410;
+        case 0x2412: goto L2412;
+        case 0x2414: goto L2414;
+        case 0x241c: goto L241c;
+        case 0x2426: goto L2426;
+        case 0x2430: goto L2430;
+        case 0x243c: goto L243c;
+        case 0x2442: goto L2442;
+        case 0x2448: goto L2448;
+        case 0x244a: goto L244a;
+        case 0x244e: goto L244e;
+        case 0x245a: goto L245a;
+        case 0x2474: goto L2474;
+        case 0x2486: goto L2486;
+        case 0x2492: goto L2492;
+        case 0x249a: goto L249a;
+        case 0x24aa: goto L24aa;
+        case 0x24b4: goto L24b4;
+        case 0x24d4: goto L24d4;
+        case 0x24e2: goto L24e2;
+        case 0x24ec: goto L24ec;
+        case 0x24fe: goto L24fe;
+        case 0x2520: goto L2520;
+        case 0x2530: goto L2530;
+        case 0x2536: goto L2536;
+        case 0x254c: goto L254c;
+        case 0x2550: goto L2550;
+        case 0x2554: goto L2554;
+        case 0x2558: goto L2558;
+        case 0x255e: goto L255e;
+        case 0x257a: goto L257a;
+        case 0x2580: goto L2580;
+        case 0x2592: goto L2592;
+        case 0x259e: goto L259e;
+        case 0x25a2: goto L25a2;
+        case 0x25ac: goto L25ac;
+        case 0x25b2: goto L25b2;
+        case 0x25c6: goto L25c6;
+        case 0x25dc: goto L25dc;
+        case 0x25e2: goto L25e2;
+        case 0x25e4: goto L25e4;
+        case 0x25e8: goto L25e8;
+        case 0x2608: goto L2608;
+        case 0x2612: goto L2612;
+        case 0x261c: goto L261c;
+        case 0x2622: goto L2622;
+        case 0x2630: goto L2630;
+        case 0x2634: goto L2634;
+        case 0x263a: goto L263a;
+        case 0x263e: goto L263e;
+        case 0x2644: goto L2644;
+        case 0x2646: goto L2646;
+        case 0x2648: goto L2648;
+        case 0x264a: goto L264a;
+        case 0x264c: goto L264c;
+        case 0x2650: goto L2650;
+        case 0x2662: goto L2662;
+        case 0x2664: goto L2664;
+        case 0x2666: goto L2666;
+        case 0x2668: goto L2668;
+        case 0x266a: goto L266a;
+        case 0x266e: goto L266e;
+        case 0x2686: goto L2686;
+        case 0x2688: goto L2688;
+        case 0x268a: goto L268a;
+        case 0x268c: goto L268c;
+        case 0x268e: goto L268e;
+        case 0x2694: goto L2694;
+        case 0x2696: goto L2696;
+        case 0x26b0: goto L26b0;
+        case 0x26b2: goto L26b2;
+        case 0x26b4: goto L26b4;
+        case 0x26b6: goto L26b6;
+        case 0x26b8: goto L26b8;
+        case 0x26bc: goto L26bc;
+        case 0x26c0: goto L26c0;
+        case 0x26d2: goto L26d2;
+        case 0x26d4: goto L26d4;
+        case 0x26d6: goto L26d6;
+        case 0x26d8: goto L26d8;
+        case 0x26da: goto L26da;
+        case 0x26de: goto L26de;
+        case 0x26f4: goto L26f4;
+        case 0x26f6: goto L26f6;
+        case 0x26f8: goto L26f8;
+        case 0x26fa: goto L26fa;
+        case 0x26fc: goto L26fc;
+        case 0x2700: goto L2700;
+        case 0x270c: goto L270c;
+        case 0x2714: goto L2714;
+        case 0x2716: goto L2716;
+        case 0x2718: goto L2718;
+        case 0x271a: goto L271a;
+        case 0x271c: goto L271c;
+        case 0x2748: goto L2748;
+        case 0x274a: goto L274a;
+        case 0x2760: goto L2760;
+        case 0x2762: goto L2762;
+        case 0x2764: goto L2764;
+        case 0x2766: goto L2766;
+        case 0x2768: goto L2768;
+        case 0x276c: goto L276c;
+        case 0x2770: goto L2770;
+        case 0x2778: goto L2778;
+        case 0x277a: goto L277a;
+        case 0x2786: goto L2786;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: setd
+    AOT_GOTO(0x0002, L0002);
+L0002:
+    AOT_BLOCK(0x0002, 2);
+    // 0002: mov 2(sp), r0
+    {
+        a = uint16_t(r[6] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0006: clr -2(r0)
+    {
+        a = uint16_t(r[0] + -2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x000a, L000a);
+L000a:
+    AOT_BLOCK(0x000a, 1);
+    // 000a: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x000c, L000c);
+L000c:
+    AOT_BLOCK(0x000c, 1);
+    // 000c: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0010, L0010);
+L0010:
+    AOT_BLOCK(0x0010, 1);
+    // 0010: mov 4(sp), (sp)
+    {
+        a = uint16_t(r[6] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0014, L0014);
+L0014:
+    AOT_BLOCK(0x0014, 1);
+    // 0014: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0016, L0016);
+L0016:
+    AOT_BLOCK(0x0016, 1);
+    // 0016: mov r0, 2(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x001a, L001a);
+L001a:
+    AOT_BLOCK(0x001a, 1);
+    // 001a: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x001c, L001c);
+L001c:
+    AOT_BLOCK(0x001c, 1);
+    // 001c: bne 001a
+    if (!Z)
+        AOT_GOTO(0x001a, L001a);
+    AOT_GOTO(0x001e, L001e);
+L001e:
+    AOT_BLOCK(0x001e, 1);
+    // 001e: cmp r0, *2(sp)
+    {
+        src = r[0];
+        b = RD16(r[6] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0022, L0022);
+L0022:
+    AOT_BLOCK(0x0022, 1);
+    // 0022: bcs 0026
+    if (C)
+        AOT_GOTO(0x0026, L0026);
+    AOT_GOTO(0x0024, L0024);
+L0024:
+    AOT_BLOCK(0x0024, 1);
+    // 0024: tst -(r0)
+    {
+        r[0] -= 2;
+        a = r[0];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0026, L0026);
+L0026:
+    AOT_BLOCK(0x0026, 1);
+    // 0026: mov r0, 4(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x002a, L002a);
+L002a:
+    AOT_BLOCK(0x002a, 1);
+    // 002a: mov r0, 0d7a
+    {
+        src = r[0];
+        b = 0x0d7a;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x002e, L002e);
+L002e:
+    AOT_BLOCK(0x002e, 1);
+    // 002e: jsr pc, 003c
+    {
+        a = 0x003c;
+        r[6] -= 2;
+        WR16(r[6], 0x0032);
+    }
+    AOT_GOTO(0x003c, L003c);
+L0032:
+    AOT_BLOCK(0x0032, 3);
+    // 0032: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0034: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0036: jsr pc, *$23aa
+    {
+        a = 0x23aa;
+        r[6] -= 2;
+        WR16(r[6], 0x003a);
+    }
+    AOT_GOTO(0x23aa, L23aa);
+L003a:
+    // 003a: sys 1
+    AOT_INTERP(0x003a);
+L003c:
+    AOT_BLOCK(0x003c, 2);
+    // 003c: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0040;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    AOT_GOTO(0x0040, L0040);
+L003e:
+    AOT_BLOCK(0x003e, 1);
+    // 003e: cmp *(r4)+, *be6(r2)
+    {
+        a = RD16(r[4]);
+        r[4] += 2;
+        src = RD16(a);
+        b = RD16(r[2] + 3046);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0042, L0042);
+L0040:
+    AOT_BLOCK(0x0040, 1);
+    // 0040: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0042, L0042);
+L0042:
+    AOT_BLOCK(0x0042, 1);
+    // 0042: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0048, L0048);
+L0044:
+    // 0044: wait
+    AOT_INTERP(0x0044);
+L0046:
+    // 0046: iot
+    AOT_INTERP(0x0046);
+L0048:
+    AOT_BLOCK(0x0048, 1);
+    // 0048: bge 0064
+    if (!(N ^ V))
+        AOT_GOTO(0x0064, L0064);
+    AOT_GOTO(0x004a, L004a);
+L004a:
+    AOT_BLOCK(0x004a, 3);
+    // 004a: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 004e: cmpb $2b, *2(r0)
+    {
+        src = uint8_t(0x2b);
+        b = RD16(r[0] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0054: bne 0064
+    if (!Z)
+        AOT_GOTO(0x0064, L0064);
+    AOT_GOTO(0x0056, L0056);
+L0056:
+    AOT_BLOCK(0x0056, 3);
+    // 0056: dec 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 005a: add $2, 6(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0060: inc 07d2
+    {
+        a = 0x07d2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0064, L0064);
+L0064:
+    AOT_BLOCK(0x0064, 2);
+    // 0064: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+    }
+    // 0068: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x006e, L006e);
+L006e:
+    AOT_BLOCK(0x006e, 1);
+    // 006e: bge 008a
+    if (!(N ^ V))
+        AOT_GOTO(0x008a, L008a);
+    AOT_GOTO(0x0070, L0070);
+L0070:
+    AOT_BLOCK(0x0070, 1);
+    // 0070: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0074, L0074);
+L0074:
+    AOT_BLOCK(0x0074, 2);
+    // 0074: cmpb $2d, *2(r0)
+    {
+        src = uint8_t(0x2d);
+        b = RD16(r[0] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 007a: bne 008a
+    if (!Z)
+        AOT_GOTO(0x008a, L008a);
+    AOT_GOTO(0x007c, L007c);
+L007c:
+    AOT_BLOCK(0x007c, 3);
+    // 007c: dec 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0080: add $2, 6(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0086: inc -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x008a, L008a);
+L008a:
+    AOT_BLOCK(0x008a, 2);
+    // 008a: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0090: bge 00ca
+    if (!(N ^ V))
+        AOT_GOTO(0x00ca, L00ca);
+    AOT_GOTO(0x0092, L0092);
+L0092:
+    AOT_BLOCK(0x0092, 5);
+    // 0092: mov $4d0, (sp)
+    {
+        src = uint16_t(0x04d0);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0096: mov $1d9, -(sp)
+    {
+        src = uint16_t(0x01d9);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 009a: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 009e: mov 2(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00a2: jsr pc, *$1c86
+    {
+        a = 0x1c86;
+        r[6] -= 2;
+        WR16(r[6], 0x00a6);
+    }
+    AOT_GOTO(0x1c86, L1c86);
+L00a6:
+    AOT_BLOCK(0x00a6, 3);
+    // 00a6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 00a8: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 00aa: bne 00ca
+    if (!Z)
+        AOT_GOTO(0x00ca, L00ca);
+    AOT_GOTO(0x00ac, L00ac);
+L00ac:
+    AOT_BLOCK(0x00ac, 5);
+    // 00ac: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00b0: mov 2(r0), (sp)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00b4: mov $1db, -(sp)
+    {
+        src = uint16_t(0x01db);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00b8: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00bc: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x00c0);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L00c0:
+    AOT_BLOCK(0x00c0, 3);
+    // 00c0: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 00c2: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00c6: jsr pc, *$23aa
+    {
+        a = 0x23aa;
+        r[6] -= 2;
+        WR16(r[6], 0x00ca);
+    }
+    AOT_GOTO(0x23aa, L23aa);
+L00ca:
+    AOT_BLOCK(0x00ca, 2);
+    // 00ca: cmp $2, 4(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00d0: bge 010a
+    if (!(N ^ V))
+        AOT_GOTO(0x010a, L010a);
+    AOT_GOTO(0x00d2, L00d2);
+L00d2:
+    AOT_BLOCK(0x00d2, 5);
+    // 00d2: mov $4d8, (sp)
+    {
+        src = uint16_t(0x04d8);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00d6: mov $1ee, -(sp)
+    {
+        src = uint16_t(0x01ee);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00da: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00de: mov 4(r0), -(sp)
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00e2: jsr pc, *$1c86
+    {
+        a = 0x1c86;
+        r[6] -= 2;
+        WR16(r[6], 0x00e6);
+    }
+    AOT_GOTO(0x1c86, L1c86);
+L00e6:
+    AOT_BLOCK(0x00e6, 3);
+    // 00e6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 00e8: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 00ea: bne 010a
+    if (!Z)
+        AOT_GOTO(0x010a, L010a);
+    AOT_GOTO(0x00ec, L00ec);
+L00ec:
+    AOT_BLOCK(0x00ec, 5);
+    // 00ec: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00f0: mov 4(r0), (sp)
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00f4: mov $1f0, -(sp)
+    {
+        src = uint16_t(0x01f0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00f8: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00fc: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x0100);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L0100:
+    AOT_BLOCK(0x0100, 1);
+    // 0100: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0102, L0102);
+L0102:
+    AOT_BLOCK(0x0102, 1);
+    // 0102: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0106, L0106);
+L0106:
+    AOT_BLOCK(0x0106, 1);
+    // 0106: jsr pc, *$23aa
+    {
+        a = 0x23aa;
+        r[6] -= 2;
+        WR16(r[6], 0x010a);
+    }
+    AOT_GOTO(0x23aa, L23aa);
+L010a:
+    AOT_BLOCK(0x010a, 1);
+    // 010a: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x010e, L010e);
+L010e:
+    AOT_BLOCK(0x010e, 1);
+    // 010e: jsr pc, *$2700
+    {
+        a = 0x2700;
+        r[6] -= 2;
+        WR16(r[6], 0x0112);
+    }
+    AOT_GOTO(0x2700, L2700);
+L0112:
+    AOT_BLOCK(0x0112, 1);
+    // 0112: mov r0, 07d6
+    {
+        src = r[0];
+        b = 0x07d6;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0116, L0116);
+L0116:
+    AOT_BLOCK(0x0116, 3);
+    // 0116: mov r0, 07d8
+    {
+        src = r[0];
+        b = 0x07d8;
+        WR16(b, src);
+    }
+    // 011a: mov r0, 07d4
+    {
+        src = r[0];
+        b = 0x07d4;
+        WR16(b, src);
+    }
+    // 011e: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0120, L0120);
+L0120:
+    AOT_BLOCK(0x0120, 1);
+    // 0120: jsr pc, 06a2
+    {
+        a = 0x06a2;
+        r[6] -= 2;
+        WR16(r[6], 0x0124);
+    }
+    AOT_GOTO(0x06a2, L06a2);
+L0124:
+    AOT_BLOCK(0x0124, 1);
+    // 0124: jsr pc, 02d6
+    {
+        a = 0x02d6;
+        r[6] -= 2;
+        WR16(r[6], 0x0128);
+    }
+    AOT_GOTO(0x02d6, L02d6);
+L0128:
+    AOT_BLOCK(0x0128, 2);
+    // 0128: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 012a: jsr pc, 1892
+    {
+        a = 0x1892;
+        r[6] -= 2;
+        WR16(r[6], 0x012e);
+    }
+    AOT_GOTO(0x1892, L1892);
+L012e:
+    AOT_BLOCK(0x012e, 1);
+    // 012e: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0130, L0130);
+L0130:
+    AOT_BLOCK(0x0130, 1);
+    // 0130: jsr pc, 07da
+    {
+        a = 0x07da;
+        r[6] -= 2;
+        WR16(r[6], 0x0134);
+    }
+    AOT_GOTO(0x07da, L07da);
+L0134:
+    AOT_BLOCK(0x0134, 1);
+    // 0134: jsr pc, 08d0
+    {
+        a = 0x08d0;
+        r[6] -= 2;
+        WR16(r[6], 0x0138);
+    }
+    AOT_GOTO(0x08d0, L08d0);
+L0138:
+    AOT_BLOCK(0x0138, 1);
+    // 0138: jsr pc, 1524
+    {
+        a = 0x1524;
+        r[6] -= 2;
+        WR16(r[6], 0x013c);
+    }
+    AOT_GOTO(0x1524, L1524);
+L013c:
+    AOT_BLOCK(0x013c, 3);
+    // 013c: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 013e: tst 07d0
+    {
+        a = 0x07d0;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0142: bne 0134
+    if (!Z)
+        AOT_GOTO(0x0134, L0134);
+    AOT_GOTO(0x0144, L0144);
+L0144:
+    AOT_BLOCK(0x0144, 1);
+    // 0144: jsr pc, 0cb6
+    {
+        a = 0x0cb6;
+        r[6] -= 2;
+        WR16(r[6], 0x0148);
+    }
+    AOT_GOTO(0x0cb6, L0cb6);
+L0148:
+    AOT_BLOCK(0x0148, 1);
+    // 0148: jsr pc, 0d6e
+    {
+        a = 0x0d6e;
+        r[6] -= 2;
+        WR16(r[6], 0x014c);
+    }
+    AOT_GOTO(0x0d6e, L0d6e);
+L014c:
+    AOT_BLOCK(0x014c, 2);
+    // 014c: tst 07d0
+    {
+        a = 0x07d0;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0150: bne 0130
+    if (!Z)
+        AOT_GOTO(0x0130, L0130);
+    AOT_GOTO(0x0152, L0152);
+L0152:
+    AOT_BLOCK(0x0152, 1);
+    // 0152: jsr pc, 121e
+    {
+        a = 0x121e;
+        r[6] -= 2;
+        WR16(r[6], 0x0156);
+    }
+    AOT_GOTO(0x121e, L121e);
+L0156:
+    AOT_BLOCK(0x0156, 2);
+    // 0156: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0158: bne 0130
+    if (!Z)
+        AOT_GOTO(0x0130, L0130);
+    AOT_GOTO(0x015a, L015a);
+L015a:
+    AOT_BLOCK(0x015a, 1);
+    // 015a: jsr pc, 12d2
+    {
+        a = 0x12d2;
+        r[6] -= 2;
+        WR16(r[6], 0x015e);
+    }
+    AOT_GOTO(0x12d2, L12d2);
+L015e:
+    AOT_BLOCK(0x015e, 1);
+    // 015e: jsr pc, 049a
+    {
+        a = 0x049a;
+        r[6] -= 2;
+        WR16(r[6], 0x0162);
+    }
+    AOT_GOTO(0x049a, L049a);
+L0162:
+    AOT_BLOCK(0x0162, 2);
+    // 0162: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0164: bge 0168
+    if (!(N ^ V))
+        AOT_GOTO(0x0168, L0168);
+    AOT_GOTO(0x0166, L0166);
+L0166:
+    AOT_BLOCK(0x0166, 1);
+    // 0166: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0168, L0168);
+L0168:
+    AOT_BLOCK(0x0168, 3);
+    // 0168: mov 07d8, 07d4
+    {
+        a = 0x07d8;
+        src = RD16(a);
+        b = 0x07d4;
+        WR16(b, src);
+    }
+    // 016e: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0170: bne 0124
+    if (!Z)
+        AOT_GOTO(0x0124, L0124);
+    AOT_GOTO(0x0172, L0172);
+L0172:
+    AOT_BLOCK(0x0172, 2);
+    // 0172: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0176: bne 017c
+    if (!Z)
+        AOT_GOTO(0x017c, L017c);
+    AOT_GOTO(0x0178, L0178);
+L0178:
+    AOT_BLOCK(0x0178, 1);
+    // 0178: jmp *$02cc
+    {
+        a = 0x02cc;
+    }
+    AOT_GOTO(0x02cc, L02cc);
+L017c:
+    AOT_BLOCK(0x017c, 4);
+    // 017c: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 017e: mov $205, -(sp)
+    {
+        src = uint16_t(0x0205);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0182: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0186: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x018a);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L018a:
+    AOT_BLOCK(0x018a, 5);
+    // 018a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 018c: mov 07b0, (sp)
+    {
+        a = 0x07b0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0190: mov $214, -(sp)
+    {
+        src = uint16_t(0x0214);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0194: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0198: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x019c);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L019c:
+    AOT_BLOCK(0x019c, 5);
+    // 019c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 019e: mov 07b6, (sp)
+    {
+        a = 0x07b6;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01a2: mov $227, -(sp)
+    {
+        src = uint16_t(0x0227);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01a6: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01aa: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x01ae);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L01ae:
+    AOT_BLOCK(0x01ae, 3);
+    // 01ae: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 01b0: mov 07b8, (sp)
+    {
+        a = 0x07b8;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01b4: mov $23d, -(sp)
+    {
+        src = uint16_t(0x023d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x01b8, L01b8);
+L01b8:
+    AOT_BLOCK(0x01b8, 2);
+    // 01b8: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01bc: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x01c0);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L01c0:
+    AOT_BLOCK(0x01c0, 1);
+    // 01c0: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x01c2, L01c2);
+L01c2:
+    AOT_BLOCK(0x01c2, 4);
+    // 01c2: mov 07ba, (sp)
+    {
+        a = 0x07ba;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01c6: mov $24e, -(sp)
+    {
+        src = uint16_t(0x024e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01ca: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01ce: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x01d2);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L01d2:
+    AOT_BLOCK(0x01d2, 1);
+    // 01d2: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x01d4, L01d4);
+L01d4:
+    AOT_BLOCK(0x01d4, 4);
+    // 01d4: mov 07bc, (sp)
+    {
+        a = 0x07bc;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01d8: mov $263, -(sp)
+    {
+        src = uint16_t(0x0263);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01dc: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01e0: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x01e4);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L01e4:
+    AOT_BLOCK(0x01e4, 5);
+    // 01e4: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 01e6: mov 07be, (sp)
+    {
+        a = 0x07be;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01ea: mov $273, -(sp)
+    {
+        src = uint16_t(0x0273);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01ee: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01f2: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x01f6);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L01f6:
+    AOT_BLOCK(0x01f6, 5);
+    // 01f6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 01f8: mov 07c0, (sp)
+    {
+        a = 0x07c0;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01fc: mov $284, -(sp)
+    {
+        src = uint16_t(0x0284);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0200: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0204: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x0208);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L0208:
+    AOT_BLOCK(0x0208, 5);
+    // 0208: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 020a: mov 07b4, (sp)
+    {
+        a = 0x07b4;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 020e: mov $29a, -(sp)
+    {
+        src = uint16_t(0x029a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0212: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0216: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x021a);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L021a:
+    AOT_BLOCK(0x021a, 5);
+    // 021a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 021c: mov 07b2, (sp)
+    {
+        a = 0x07b2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0220: mov $2ae, -(sp)
+    {
+        src = uint16_t(0x02ae);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0224: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0228: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x022c);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L022c:
+    AOT_BLOCK(0x022c, 5);
+    // 022c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 022e: mov 07c2, (sp)
+    {
+        a = 0x07c2;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0232: mov $2c7, -(sp)
+    {
+        src = uint16_t(0x02c7);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0236: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 023a: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x023e);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L023e:
+    AOT_BLOCK(0x023e, 5);
+    // 023e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0240: mov 07c4, (sp)
+    {
+        a = 0x07c4;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0244: mov $2da, -(sp)
+    {
+        src = uint16_t(0x02da);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0248: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 024c: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x0250);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L0250:
+    AOT_BLOCK(0x0250, 5);
+    // 0250: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0252: mov 07c8, (sp)
+    {
+        a = 0x07c8;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0256: mov $2ee, -(sp)
+    {
+        src = uint16_t(0x02ee);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 025a: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 025e: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x0262);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L0262:
+    AOT_BLOCK(0x0262, 5);
+    // 0262: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0264: mov 07c6, (sp)
+    {
+        a = 0x07c6;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0268: mov $30b, -(sp)
+    {
+        src = uint16_t(0x030b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 026c: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0270: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x0274);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L0274:
+    AOT_BLOCK(0x0274, 5);
+    // 0274: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0276: mov 07ca, (sp)
+    {
+        a = 0x07ca;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 027a: mov $320, -(sp)
+    {
+        src = uint16_t(0x0320);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 027e: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0282: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x0286);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L0286:
+    AOT_BLOCK(0x0286, 5);
+    // 0286: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0288: mov 07cc, (sp)
+    {
+        a = 0x07cc;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 028c: mov $330, -(sp)
+    {
+        src = uint16_t(0x0330);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0290: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0294: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x0298);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L0298:
+    AOT_BLOCK(0x0298, 5);
+    // 0298: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 029a: mov 07ce, (sp)
+    {
+        a = 0x07ce;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 029e: mov $344, -(sp)
+    {
+        src = uint16_t(0x0344);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02a2: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02a6: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x02aa);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L02aa:
+    AOT_BLOCK(0x02aa, 9);
+    // 02aa: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 02ac: mov 07d6, r0
+    {
+        a = 0x07d6;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 02b0: add $3ff, r0
+    {
+        src = uint16_t(0x03ff);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 02b4: ash $fff6, r0
+    {
+        src = uint16_t(0xfff6) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 02b8: bic $ffc0, r0
+    {
+        src = uint16_t(0xffc0);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 02bc: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02be: mov $35c, -(sp)
+    {
+        src = uint16_t(0x035c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 02c2: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02c6: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x02ca);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L02ca:
+    AOT_BLOCK(0x02ca, 1);
+    // 02ca: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x02cc, L02cc);
+L02cc:
+    AOT_BLOCK(0x02cc, 2);
+    // 02cc: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 02ce: jsr pc, *$23aa
+    {
+        a = 0x23aa;
+        r[6] -= 2;
+        WR16(r[6], 0x02d2);
+    }
+    AOT_GOTO(0x23aa, L23aa);
+L02d2:
+    AOT_BLOCK(0x02d2, 2);
+    // 02d2: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L02d6:
+    AOT_BLOCK(0x02d6, 3);
+    // 02d6: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x02da;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 02da: mov $7a0, r3
+    {
+        src = uint16_t(0x07a0);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x02de, L02de);
+L02de:
+    AOT_BLOCK(0x02de, 1);
+    // 02de: jsr pc, 03ca
+    {
+        a = 0x03ca;
+        r[6] -= 2;
+        WR16(r[6], 0x02e2);
+    }
+    AOT_GOTO(0x03ca, L03ca);
+L02e2:
+    AOT_BLOCK(0x02e2, 6);
+    // 02e2: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 02e4: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 02e6: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 02ea: sub $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 02ee: cmp r0, $8
+    {
+        src = r[0];
+        dst = uint16_t(0x0008);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02f2: bhi 0376
+    if (!(C | Z))
+        AOT_GOTO(0x0376, L0376);
+    AOT_GOTO(0x02f4, L02f4);
+L02f4:
+    AOT_BLOCK(0x02f4, 2);
+    // 02f4: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 02f6: jmp *e0(r0)
+    {
+        a = RD16(r[0] + 224);
+    }
+    AOT_JUMP(a);
+L02fa:
+    AOT_BLOCK(0x02fa, 2);
+    // 02fa: mov $e, (sp)
+    {
+        src = uint16_t(0x000e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02fe: jsr pc, *$14d2
+    {
+        a = 0x14d2;
+        r[6] -= 2;
+        WR16(r[6], 0x0302);
+    }
+    AOT_GOTO(0x14d2, L14d2);
+L0302:
+    AOT_BLOCK(0x0302, 3);
+    // 0302: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0304: cmpb $4c, 05a0
+    {
+        src = uint8_t(0x4c);
+        b = 0x05a0;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 030a: bne 032e
+    if (!Z)
+        AOT_GOTO(0x032e, L032e);
+    AOT_GOTO(0x030c, L030c);
+L030c:
+    AOT_BLOCK(0x030c, 4);
+    // 030c: movb $4, (r4)
+    {
+        src = uint8_t(0x04);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 0310: clrb 1(r4)
+    {
+        a = uint16_t(r[4] + 1);
+        WR8(a, 0);
+        C = false;
+    }
+    // 0314: mov $5a1, (sp)
+    {
+        src = uint16_t(0x05a1);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0318: jsr pc, *$0464
+    {
+        a = 0x0464;
+        r[6] -= 2;
+        WR16(r[6], 0x031c);
+    }
+    AOT_GOTO(0x0464, L0464);
+L031c:
+    AOT_BLOCK(0x031c, 1);
+    // 031c: mov r0, 8(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0320, L0320);
+L0320:
+    AOT_BLOCK(0x0320, 2);
+    // 0320: clr a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0324: br 03a8
+    AOT_GOTO(0x03a8, L03a8);
+L0326:
+    AOT_BLOCK(0x0326, 1);
+    // 0326: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x032a, L032a);
+L032a:
+    AOT_BLOCK(0x032a, 2);
+    // 032a: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L032e:
+    AOT_BLOCK(0x032e, 5);
+    // 032e: movb $5, (r4)
+    {
+        src = uint8_t(0x05);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 0332: clrb 1(r4)
+    {
+        a = uint16_t(r[4] + 1);
+        WR8(a, 0);
+    }
+    // 0336: clr 8(r4)
+    {
+        a = uint16_t(r[4] + 8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 033a: mov $5a0, (sp)
+    {
+        src = uint16_t(0x05a0);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 033e: br 039a
+    AOT_GOTO(0x039a, L039a);
+L0340:
+    AOT_BLOCK(0x0340, 2);
+    // 0340: mov $e, (sp)
+    {
+        src = uint16_t(0x000e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0344: jsr pc, *$14d2
+    {
+        a = 0x14d2;
+        r[6] -= 2;
+        WR16(r[6], 0x0348);
+    }
+    AOT_GOTO(0x14d2, L14d2);
+L0348:
+    AOT_BLOCK(0x0348, 9);
+    // 0348: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 034a: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 034c: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0350: movb r0, (r4)
+    {
+        src = uint8_t(r[0]);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 0352: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 0354: ash $fff8, r0
+    {
+        src = uint16_t(0xfff8) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0358: movb r0, 1(r4)
+    {
+        src = uint8_t(r[0]);
+        b = uint16_t(r[4] + 1);
+        WR8(b, src);
+    }
+    // 035c: cmpb $4c, *07ae
+    {
+        src = uint8_t(0x4c);
+        b = RD16(0x07ae);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0362: bne 0392
+    if (!Z)
+        AOT_GOTO(0x0392, L0392);
+    AOT_GOTO(0x0364, L0364);
+L0364:
+    AOT_BLOCK(0x0364, 3);
+    // 0364: mov 07ae, (sp)
+    {
+        a = 0x07ae;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0368: inc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 036a: jsr pc, *$0464
+    {
+        a = 0x0464;
+        r[6] -= 2;
+        WR16(r[6], 0x036e);
+    }
+    AOT_GOTO(0x0464, L0464);
+L036e:
+    AOT_BLOCK(0x036e, 2);
+    // 036e: mov r0, 8(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0372: beq 0392
+    if (Z)
+        AOT_GOTO(0x0392, L0392);
+    AOT_GOTO(0x0374, L0374);
+L0374:
+    AOT_BLOCK(0x0374, 1);
+    // 0374: br 0320
+    AOT_GOTO(0x0320, L0320);
+L0376:
+    AOT_BLOCK(0x0376, 2);
+    // 0376: mov $e, (sp)
+    {
+        src = uint16_t(0x000e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 037a: jsr pc, *$14d2
+    {
+        a = 0x14d2;
+        r[6] -= 2;
+        WR16(r[6], 0x037e);
+    }
+    AOT_GOTO(0x14d2, L14d2);
+L037e:
+    AOT_BLOCK(0x037e, 7);
+    // 037e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0380: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 0382: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0386: movb r0, (r4)
+    {
+        src = uint8_t(r[0]);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 0388: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 038a: ash $fff8, r0
+    {
+        src = uint16_t(0xfff8) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 038e: movb r0, 1(r4)
+    {
+        src = uint8_t(r[0]);
+        b = uint16_t(r[4] + 1);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0392, L0392);
+L0392:
+    AOT_BLOCK(0x0392, 2);
+    // 0392: clr 8(r4)
+    {
+        a = uint16_t(r[4] + 8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0396: mov 07ae, (sp)
+    {
+        a = 0x07ae;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x039a, L039a);
+L039a:
+    AOT_BLOCK(0x039a, 2);
+    // 039a: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 039e: jsr pc, *$0646
+    {
+        a = 0x0646;
+        r[6] -= 2;
+        WR16(r[6], 0x03a2);
+    }
+    AOT_GOTO(0x0646, L0646);
+L03a2:
+    AOT_BLOCK(0x03a2, 2);
+    // 03a2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 03a4: mov r0, a(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03a8, L03a8);
+L03a8:
+    AOT_BLOCK(0x03a8, 7);
+    // 03a8: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+    }
+    // 03ac: mov r3, 4(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 03b0: mov r4, 2(r3)
+    {
+        src = r[4];
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+    }
+    // 03b4: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 03b6: clr 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        WR16(a, 0);
+    }
+    // 03ba: cmp $7, r2
+    {
+        src = uint16_t(0x0007);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03be: beq 0326
+    if (Z)
+        AOT_GOTO(0x0326, L0326);
+    AOT_GOTO(0x03c0, L03c0);
+L03c0:
+    AOT_BLOCK(0x03c0, 2);
+    // 03c0: cmp $30, r2
+    {
+        src = uint16_t(0x0030);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03c4: bne 02de
+    if (!Z)
+        AOT_GOTO(0x02de, L02de);
+    AOT_GOTO(0x03c6, L03c6);
+L03c6:
+    AOT_BLOCK(0x03c6, 2);
+    // 03c6: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 03c8: br 032a
+    AOT_GOTO(0x032a, L032a);
+L03ca:
+    AOT_BLOCK(0x03ca, 3);
+    // 03ca: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x03ce;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 03ce: mov $5a0, r4
+    {
+        src = uint16_t(0x05a0);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03d2, L03d2);
+L03d2:
+    AOT_BLOCK(0x03d2, 2);
+    // 03d2: dec 04d2
+    {
+        a = 0x04d2;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 03d6: blt 03e6
+    if (N ^ V)
+        AOT_GOTO(0x03e6, L03e6);
+    AOT_GOTO(0x03d8, L03d8);
+L03d8:
+    AOT_BLOCK(0x03d8, 4);
+    // 03d8: movb *04d0, r0
+    {
+        a = RD16(0x04d0);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 03dc: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 03e0: inc 04d0
+    {
+        a = 0x04d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 03e4: br 03ee
+    AOT_GOTO(0x03ee, L03ee);
+L03e6:
+    AOT_BLOCK(0x03e6, 2);
+    // 03e6: mov $4d0, (sp)
+    {
+        src = uint16_t(0x04d0);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03ea: jsr pc, *$1d04
+    {
+        a = 0x1d04;
+        r[6] -= 2;
+        WR16(r[6], 0x03ee);
+    }
+    AOT_GOTO(0x1d04, L1d04);
+L03ee:
+    AOT_BLOCK(0x03ee, 3);
+    // 03ee: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 03f0: cmp $20, r3
+    {
+        src = uint16_t(0x0020);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03f4: beq 03d2
+    if (Z)
+        AOT_GOTO(0x03d2, L03d2);
+    AOT_GOTO(0x03f6, L03f6);
+L03f6:
+    AOT_BLOCK(0x03f6, 2);
+    // 03f6: cmp $9, r3
+    {
+        src = uint16_t(0x0009);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03fa: beq 03d2
+    if (Z)
+        AOT_GOTO(0x03d2, L03d2);
+    AOT_GOTO(0x03fc, L03fc);
+L03fc:
+    AOT_BLOCK(0x03fc, 2);
+    // 03fc: cmp $3a, r3
+    {
+        src = uint16_t(0x003a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0400: bne 0414
+    if (!Z)
+        AOT_GOTO(0x0414, L0414);
+    AOT_GOTO(0x0402, L0402);
+L0402:
+    AOT_BLOCK(0x0402, 3);
+    // 0402: clrb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        WR8(a, 0);
+        C = false;
+    }
+    // 0404: mov $4, r0
+    {
+        src = uint16_t(0x0004);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0408: br 0410
+    AOT_GOTO(0x0410, L0410);
+L040a:
+    AOT_BLOCK(0x040a, 2);
+    // 040a: clrb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 040c: jsr pc, 06f2
+    {
+        a = 0x06f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0410);
+    }
+    AOT_GOTO(0x06f2, L06f2);
+L0410:
+    AOT_BLOCK(0x0410, 2);
+    // 0410: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0414:
+    AOT_BLOCK(0x0414, 2);
+    // 0414: cmp $a, r3
+    {
+        src = uint16_t(0x000a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0418: beq 040a
+    if (Z)
+        AOT_GOTO(0x040a, L040a);
+    AOT_GOTO(0x041a, L041a);
+L041a:
+    AOT_BLOCK(0x041a, 2);
+    // 041a: cmp $79e, r4
+    {
+        src = uint16_t(0x079e);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 041e: bhi 0436
+    if (!(C | Z))
+        AOT_GOTO(0x0436, L0436);
+    AOT_GOTO(0x0420, L0420);
+L0420:
+    AOT_BLOCK(0x0420, 3);
+    // 0420: mov $366, (sp)
+    {
+        src = uint16_t(0x0366);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0424: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0428: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x042c);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L042c:
+    AOT_BLOCK(0x042c, 3);
+    // 042c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 042e: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0432: jsr pc, *$23aa
+    {
+        a = 0x23aa;
+        r[6] -= 2;
+        WR16(r[6], 0x0436);
+    }
+    AOT_GOTO(0x23aa, L23aa);
+L0436:
+    AOT_BLOCK(0x0436, 3);
+    // 0436: movb r3, (r4)+
+    {
+        src = uint8_t(r[3]);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+    }
+    // 0438: dec 04d2
+    {
+        a = 0x04d2;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 043c: blt 044c
+    if (N ^ V)
+        AOT_GOTO(0x044c, L044c);
+    AOT_GOTO(0x043e, L043e);
+L043e:
+    AOT_BLOCK(0x043e, 4);
+    // 043e: movb *04d0, r0
+    {
+        a = RD16(0x04d0);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0442: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0446: inc 04d0
+    {
+        a = 0x04d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 044a: br 0454
+    AOT_GOTO(0x0454, L0454);
+L044c:
+    AOT_BLOCK(0x044c, 2);
+    // 044c: mov $4d0, (sp)
+    {
+        src = uint16_t(0x04d0);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0450: jsr pc, *$1d04
+    {
+        a = 0x1d04;
+        r[6] -= 2;
+        WR16(r[6], 0x0454);
+    }
+    AOT_GOTO(0x1d04, L1d04);
+L0454:
+    AOT_BLOCK(0x0454, 3);
+    // 0454: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0456: cmp $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 045a: bne 03fc
+    if (!Z)
+        AOT_GOTO(0x03fc, L03fc);
+    AOT_GOTO(0x045c, L045c);
+L045c:
+    AOT_BLOCK(0x045c, 3);
+    // 045c: clrb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        WR8(a, 0);
+        C = false;
+    }
+    // 045e: mov $30, r0
+    {
+        src = uint16_t(0x0030);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0462: br 0410
+    AOT_GOTO(0x0410, L0410);
+L0464:
+    AOT_BLOCK(0x0464, 5);
+    // 0464: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0468;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 0468: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 046c: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 046e: br 0484
+    AOT_GOTO(0x0484, L0484);
+L0470:
+    AOT_BLOCK(0x0470, 2);
+    // 0470: cmp $39, r2
+    {
+        src = uint16_t(0x0039);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0474: blt 048c
+    if (N ^ V)
+        AOT_GOTO(0x048c, L048c);
+    AOT_GOTO(0x0476, L0476);
+L0476:
+    AOT_BLOCK(0x0476, 5);
+    // 0476: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 0478: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 047c: mov r1, r3
+    {
+        src = r[1];
+        r[3] = src;
+    }
+    // 047e: add r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 0480: add $ffd0, r3
+    {
+        src = uint16_t(0xffd0);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0484, L0484);
+L0484:
+    AOT_BLOCK(0x0484, 3);
+    // 0484: movb (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+    }
+    // 0486: cmp $30, r2
+    {
+        src = uint16_t(0x0030);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 048a: ble 0470
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0470, L0470);
+    AOT_GOTO(0x048c, L048c);
+L048c:
+    AOT_BLOCK(0x048c, 2);
+    // 048c: tstb -(r4)
+    {
+        r[4] -= 1;
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 048e: beq 0496
+    if (Z)
+        AOT_GOTO(0x0496, L0496);
+    AOT_GOTO(0x0490, L0490);
+L0490:
+    AOT_BLOCK(0x0490, 1);
+    // 0490: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0492, L0492);
+L0492:
+    AOT_BLOCK(0x0492, 2);
+    // 0492: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0496:
+    AOT_BLOCK(0x0496, 2);
+    // 0496: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0498: br 0492
+    AOT_GOTO(0x0492, L0492);
+L049a:
+    AOT_BLOCK(0x049a, 4);
+    // 049a: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x049e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 049e: mov $7a0, r4
+    {
+        src = uint16_t(0x07a0);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04a2: jmp *$05a0
+    {
+        a = 0x05a0;
+    }
+    AOT_GOTO(0x05a0, L05a0);
+L04a6:
+    AOT_BLOCK(0x04a6, 2);
+    // 04a6: tst a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04aa: beq 04ba
+    if (Z)
+        AOT_GOTO(0x04ba, L04ba);
+    AOT_GOTO(0x04ac, L04ac);
+L04ac:
+    AOT_BLOCK(0x04ac, 3);
+    // 04ac: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04b0: mov $3b4, -(sp)
+    {
+        src = uint16_t(0x03b4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04b4: jsr pc, *$1cd8
+    {
+        a = 0x1cd8;
+        r[6] -= 2;
+        WR16(r[6], 0x04b8);
+    }
+    AOT_GOTO(0x1cd8, L1cd8);
+L04b8:
+    AOT_BLOCK(0x04b8, 1);
+    // 04b8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x04ba, L04ba);
+L04ba:
+    AOT_BLOCK(0x04ba, 2);
+    // 04ba: mov $3b7, (sp)
+    {
+        src = uint16_t(0x03b7);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04be: jmp *$059c
+    {
+        a = 0x059c;
+    }
+    AOT_GOTO(0x059c, L059c);
+L04c2:
+    AOT_BLOCK(0x04c2, 2);
+    // 04c2: cmp r0, $1e
+    {
+        src = r[0];
+        dst = uint16_t(0x001e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04c6: beq 0512
+    if (Z)
+        AOT_GOTO(0x0512, L0512);
+    AOT_GOTO(0x04c8, L04c8);
+L04c8:
+    AOT_BLOCK(0x04c8, 2);
+    // 04c8: cmp r0, $1f
+    {
+        src = r[0];
+        dst = uint16_t(0x001f);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04cc: beq 0512
+    if (Z)
+        AOT_GOTO(0x0512, L0512);
+    AOT_GOTO(0x04ce, L04ce);
+L04ce:
+    AOT_BLOCK(0x04ce, 2);
+    // 04ce: cmp r0, $20
+    {
+        src = r[0];
+        dst = uint16_t(0x0020);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04d2: beq 0512
+    if (Z)
+        AOT_GOTO(0x0512, L0512);
+    AOT_GOTO(0x04d4, L04d4);
+L04d4:
+    AOT_BLOCK(0x04d4, 2);
+    // 04d4: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04d8: bne 04de
+    if (!Z)
+        AOT_GOTO(0x04de, L04de);
+    AOT_GOTO(0x04da, L04da);
+L04da:
+    AOT_BLOCK(0x04da, 1);
+    // 04da: jmp *$05ba
+    {
+        a = 0x05ba;
+    }
+    AOT_GOTO(0x05ba, L05ba);
+L04de:
+    AOT_BLOCK(0x04de, 2);
+    // 04de: cmp r0, $30
+    {
+        src = r[0];
+        dst = uint16_t(0x0030);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04e2: bne 0518
+    if (!Z)
+        AOT_GOTO(0x0518, L0518);
+    AOT_GOTO(0x04e4, L04e4);
+L04e4:
+    AOT_BLOCK(0x04e4, 1);
+    // 04e4: br 05a6
+    AOT_GOTO(0x05a6, L05a6);
+L04e6:
+    AOT_BLOCK(0x04e6, 2);
+    // 04e6: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 04ea: mov $386, -(sp)
+    {
+        src = uint16_t(0x0386);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04ee, L04ee);
+L04ee:
+    AOT_BLOCK(0x04ee, 1);
+    // 04ee: jsr pc, *$1cd8
+    {
+        a = 0x1cd8;
+        r[6] -= 2;
+        WR16(r[6], 0x04f2);
+    }
+    AOT_GOTO(0x1cd8, L1cd8);
+L04f2:
+    AOT_BLOCK(0x04f2, 2);
+    // 04f2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04f4: br 05a0
+    AOT_GOTO(0x05a0, L05a0);
+L04f6:
+    AOT_BLOCK(0x04f6, 3);
+    // 04f6: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 04f8: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04fa: beq 04a6
+    if (Z)
+        AOT_GOTO(0x04a6, L04a6);
+    AOT_GOTO(0x04fc, L04fc);
+L04fc:
+    AOT_BLOCK(0x04fc, 2);
+    // 04fc: cmp r0, $4
+    {
+        src = r[0];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0500: beq 04e6
+    if (Z)
+        AOT_GOTO(0x04e6, L04e6);
+    AOT_GOTO(0x0502, L0502);
+L0502:
+    AOT_BLOCK(0x0502, 2);
+    // 0502: cmp r0, $5
+    {
+        src = r[0];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0506: bne 05aa
+    if (!Z)
+        AOT_GOTO(0x05aa, L05aa);
+    AOT_GOTO(0x0508, L0508);
+L0508:
+    AOT_BLOCK(0x0508, 3);
+    // 0508: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 050c: mov $38b, -(sp)
+    {
+        src = uint16_t(0x038b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0510: br 04ee
+    AOT_GOTO(0x04ee, L04ee);
+L0512:
+    AOT_BLOCK(0x0512, 2);
+    // 0512: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0514: mov r0, 00de
+    {
+        src = r[0];
+        b = 0x00de;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0518, L0518);
+L0518:
+    AOT_BLOCK(0x0518, 3);
+    // 0518: movb 1(r4), r2
+    {
+        a = uint16_t(r[4] + 1);
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+    }
+    // 051c: cmp $64, r2
+    {
+        src = uint16_t(0x0064);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0520: bne 0526
+    if (!Z)
+        AOT_GOTO(0x0526, L0526);
+    AOT_GOTO(0x0522, L0522);
+L0522:
+    AOT_BLOCK(0x0522, 1);
+    // 0522: clrb 1(r4)
+    {
+        a = uint16_t(r[4] + 1);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0526, L0526);
+L0526:
+    AOT_BLOCK(0x0526, 1);
+    // 0526: mov $2, r3
+    {
+        src = uint16_t(0x0002);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x052a, L052a);
+L052a:
+    AOT_BLOCK(0x052a, 2);
+    // 052a: tst (r3)
+    {
+        a = r[3];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 052c: beq 0566
+    if (Z)
+        AOT_GOTO(0x0566, L0566);
+    AOT_GOTO(0x052e, L052e);
+L052e:
+    AOT_BLOCK(0x052e, 5);
+    // 052e: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0532: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0536: movb (r4), r1
+    {
+        a = r[4];
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 0538: cmp r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 053a: bne 057c
+    if (!Z)
+        AOT_GOTO(0x057c, L057c);
+    AOT_GOTO(0x053c, L053c);
+L053c:
+    AOT_BLOCK(0x053c, 5);
+    // 053c: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0540: ash $fff8, r0
+    {
+        src = uint16_t(0xfff8) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0544: movb 1(r4), r1
+    {
+        a = uint16_t(r[4] + 1);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 0548: cmp r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 054a: bne 057c
+    if (!Z)
+        AOT_GOTO(0x057c, L057c);
+    AOT_GOTO(0x054c, L054c);
+L054c:
+    AOT_BLOCK(0x054c, 3);
+    // 054c: mov (r3), (sp)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 054e: mov $38f, -(sp)
+    {
+        src = uint16_t(0x038f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0552: jsr pc, *$1cd8
+    {
+        a = 0x1cd8;
+        r[6] -= 2;
+        WR16(r[6], 0x0556);
+    }
+    AOT_GOTO(0x1cd8, L1cd8);
+L0556:
+    AOT_BLOCK(0x0556, 3);
+    // 0556: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0558: cmp $64, r2
+    {
+        src = uint16_t(0x0064);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 055c: bne 0566
+    if (!Z)
+        AOT_GOTO(0x0566, L0566);
+    AOT_GOTO(0x055e, L055e);
+L055e:
+    AOT_BLOCK(0x055e, 2);
+    // 055e: mov $392, (sp)
+    {
+        src = uint16_t(0x0392);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0562: jsr pc, *$1cd8
+    {
+        a = 0x1cd8;
+        r[6] -= 2;
+        WR16(r[6], 0x0566);
+    }
+    AOT_GOTO(0x1cd8, L1cd8);
+L0566:
+    AOT_BLOCK(0x0566, 2);
+    // 0566: tst a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 056a: beq 0582
+    if (Z)
+        AOT_GOTO(0x0582, L0582);
+    AOT_GOTO(0x056c, L056c);
+L056c:
+    AOT_BLOCK(0x056c, 2);
+    // 056c: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 056e: jsr pc, *$05e2
+    {
+        a = 0x05e2;
+        r[6] -= 2;
+        WR16(r[6], 0x0572);
+    }
+    AOT_GOTO(0x05e2, L05e2);
+L0572:
+    AOT_BLOCK(0x0572, 3);
+    // 0572: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0576: mov $394, -(sp)
+    {
+        src = uint16_t(0x0394);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 057a: br 04ee
+    AOT_GOTO(0x04ee, L04ee);
+L057c:
+    AOT_BLOCK(0x057c, 2);
+    // 057c: add $4, r3
+    {
+        src = uint16_t(0x0004);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0580: br 052a
+    AOT_GOTO(0x052a, L052a);
+L0582:
+    AOT_BLOCK(0x0582, 2);
+    // 0582: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0586: beq 058e
+    if (Z)
+        AOT_GOTO(0x058e, L058e);
+    AOT_GOTO(0x0588, L0588);
+L0588:
+    AOT_BLOCK(0x0588, 2);
+    // 0588: cmpb $2, (r4)
+    {
+        src = uint8_t(0x02);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 058c: bne 0598
+    if (!Z)
+        AOT_GOTO(0x0598, L0598);
+    AOT_GOTO(0x058e, L058e);
+L058e:
+    AOT_BLOCK(0x058e, 3);
+    // 058e: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0592: mov $399, -(sp)
+    {
+        src = uint16_t(0x0399);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0596: br 04ee
+    AOT_GOTO(0x04ee, L04ee);
+L0598:
+    AOT_BLOCK(0x0598, 1);
+    // 0598: mov $39f, (sp)
+    {
+        src = uint16_t(0x039f);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x059c, L059c);
+L059c:
+    AOT_BLOCK(0x059c, 1);
+    // 059c: jsr pc, *$1cd8
+    {
+        a = 0x1cd8;
+        r[6] -= 2;
+        WR16(r[6], 0x05a0);
+    }
+    AOT_GOTO(0x1cd8, L1cd8);
+L05a0:
+    AOT_BLOCK(0x05a0, 2);
+    // 05a0: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05a4: bne 04f6
+    if (!Z)
+        AOT_GOTO(0x04f6, L04f6);
+    AOT_GOTO(0x05a6, L05a6);
+L05a6:
+    AOT_BLOCK(0x05a6, 2);
+    // 05a6: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L05aa:
+    AOT_BLOCK(0x05aa, 2);
+    // 05aa: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05ae: bne 04c2
+    if (!Z)
+        AOT_GOTO(0x04c2, L04c2);
+    AOT_GOTO(0x05b0, L05b0);
+L05b0:
+    AOT_BLOCK(0x05b0, 3);
+    // 05b0: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05b4: mov $3a1, -(sp)
+    {
+        src = uint16_t(0x03a1);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05b8: br 04ee
+    AOT_GOTO(0x04ee, L04ee);
+L05ba:
+    AOT_BLOCK(0x05ba, 3);
+    // 05ba: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05be: mov $3a6, -(sp)
+    {
+        src = uint16_t(0x03a6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05c2: jsr pc, *$1cd8
+    {
+        a = 0x1cd8;
+        r[6] -= 2;
+        WR16(r[6], 0x05c6);
+    }
+    AOT_GOTO(0x1cd8, L1cd8);
+L05c6:
+    AOT_BLOCK(0x05c6, 3);
+    // 05c6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 05c8: tst 8(r4)
+    {
+        a = uint16_t(r[4] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05cc: beq 05dc
+    if (Z)
+        AOT_GOTO(0x05dc, L05dc);
+    AOT_GOTO(0x05ce, L05ce);
+L05ce:
+    AOT_BLOCK(0x05ce, 3);
+    // 05ce: mov 8(r4), (sp)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05d2: mov $3ad, -(sp)
+    {
+        src = uint16_t(0x03ad);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05d6: jsr pc, *$1cd8
+    {
+        a = 0x1cd8;
+        r[6] -= 2;
+        WR16(r[6], 0x05da);
+    }
+    AOT_GOTO(0x1cd8, L1cd8);
+L05da:
+    AOT_BLOCK(0x05da, 1);
+    // 05da: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x05dc, L05dc);
+L05dc:
+    AOT_BLOCK(0x05dc, 2);
+    // 05dc: mov $3b2, (sp)
+    {
+        src = uint16_t(0x03b2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05e0: br 059c
+    AOT_GOTO(0x059c, L059c);
+L05e2:
+    AOT_BLOCK(0x05e2, 6);
+    // 05e2: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x05e6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 05e6: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 05e8: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 05ec: cmpb $24, *a(r2)
+    {
+        src = uint8_t(0x24);
+        b = RD16(r[2] + 10);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 05f2: bne 0642
+    if (!Z)
+        AOT_GOTO(0x0642, L0642);
+    AOT_GOTO(0x05f4, L05f4);
+L05f4:
+    AOT_BLOCK(0x05f4, 2);
+    // 05f4: mov a(r2), r4
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05f8: br 05fe
+    AOT_GOTO(0x05fe, L05fe);
+L05fa:
+    AOT_BLOCK(0x05fa, 2);
+    // 05fa: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05fc: beq 0642
+    if (Z)
+        AOT_GOTO(0x0642, L0642);
+    AOT_GOTO(0x05fe, L05fe);
+L05fe:
+    AOT_BLOCK(0x05fe, 1);
+    // 05fe: cmpb $2c, (r4)
+    {
+        src = uint8_t(0x2c);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    AOT_GOTO(0x0602, L0602);
+L0602:
+    AOT_BLOCK(0x0602, 1);
+    // 0602: bne 05fa
+    if (!Z)
+        AOT_GOTO(0x05fa, L05fa);
+    AOT_GOTO(0x0604, L0604);
+L0604:
+    AOT_BLOCK(0x0604, 4);
+    // 0604: mov r4, -8(r5)
+    {
+        src = r[4];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0608: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 060a: cmpb $2a, (r4)
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 060e: bne 0612
+    if (!Z)
+        AOT_GOTO(0x0612, L0612);
+    AOT_GOTO(0x0610, L0610);
+L0610:
+    AOT_BLOCK(0x0610, 1);
+    // 0610: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0612, L0612);
+L0612:
+    AOT_BLOCK(0x0612, 2);
+    // 0612: mov a(r2), r3
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0616: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0618, L0618);
+L0618:
+    AOT_BLOCK(0x0618, 2);
+    // 0618: cmpb (r3)+, (r4)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 061a: beq 0618
+    if (Z)
+        AOT_GOTO(0x0618, L0618);
+    AOT_GOTO(0x061c, L061c);
+L061c:
+    AOT_BLOCK(0x061c, 2);
+    // 061c: cmpb $28, -(r4)
+    {
+        src = uint8_t(0x28);
+        r[4] -= 1;
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0620: bne 0642
+    if (!Z)
+        AOT_GOTO(0x0642, L0642);
+    AOT_GOTO(0x0622, L0622);
+L0622:
+    AOT_BLOCK(0x0622, 2);
+    // 0622: cmpb $2c, -(r3)
+    {
+        src = uint8_t(0x2c);
+        r[3] -= 1;
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0626: bne 0642
+    if (!Z)
+        AOT_GOTO(0x0642, L0642);
+    AOT_GOTO(0x0628, L0628);
+L0628:
+    AOT_BLOCK(0x0628, 4);
+    // 0628: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 062c: mov $3b9, -(sp)
+    {
+        src = uint16_t(0x03b9);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0630: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0634: jsr pc, *$0646
+    {
+        a = 0x0646;
+        r[6] -= 2;
+        WR16(r[6], 0x0638);
+    }
+    AOT_GOTO(0x0646, L0646);
+L0638:
+    AOT_BLOCK(0x0638, 3);
+    // 0638: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 063a: mov r0, a(r2)
+    {
+        src = r[0];
+        b = uint16_t(r[2] + 10);
+        WR16(b, src);
+    }
+    // 063e: inc 07ce
+    {
+        a = 0x07ce;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0642, L0642);
+L0642:
+    AOT_BLOCK(0x0642, 2);
+    // 0642: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0646:
+    AOT_BLOCK(0x0646, 7);
+    // 0646: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x064a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 064a: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 064c: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0650: clr r2
+    {
+        r[2] = 0;
+    }
+    // 0652: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0654: bne 065c
+    if (!Z)
+        AOT_GOTO(0x065c, L065c);
+    AOT_GOTO(0x0656, L0656);
+L0656:
+    AOT_BLOCK(0x0656, 1);
+    // 0656: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0658, L0658);
+L0658:
+    AOT_BLOCK(0x0658, 2);
+    // 0658: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L065c:
+    AOT_BLOCK(0x065c, 3);
+    // 065c: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 065e: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0660: bne 065c
+    if (!Z)
+        AOT_GOTO(0x065c, L065c);
+    AOT_GOTO(0x0662, L0662);
+L0662:
+    AOT_BLOCK(0x0662, 2);
+    // 0662: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0668: bge 0676
+    if (!(N ^ V))
+        AOT_GOTO(0x0676, L0676);
+    AOT_GOTO(0x066a, L066a);
+L066a:
+    AOT_BLOCK(0x066a, 2);
+    // 066a: mov 8(r5), r4
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 066e: br 0672
+    AOT_GOTO(0x0672, L0672);
+L0670:
+    AOT_BLOCK(0x0670, 1);
+    // 0670: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0672, L0672);
+L0672:
+    AOT_BLOCK(0x0672, 2);
+    // 0672: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0674: bne 0670
+    if (!Z)
+        AOT_GOTO(0x0670, L0670);
+    AOT_GOTO(0x0676, L0676);
+L0676:
+    AOT_BLOCK(0x0676, 2);
+    // 0676: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0678: jsr pc, *$14d2
+    {
+        a = 0x14d2;
+        r[6] -= 2;
+        WR16(r[6], 0x067c);
+    }
+    AOT_GOTO(0x14d2, L14d2);
+L067c:
+    AOT_BLOCK(0x067c, 3);
+    // 067c: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 067e: mov r3, -8(r5)
+    {
+        src = r[3];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0682: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0686, L0686);
+L0686:
+    AOT_BLOCK(0x0686, 2);
+    // 0686: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0688: bne 0686
+    if (!Z)
+        AOT_GOTO(0x0686, L0686);
+    AOT_GOTO(0x068a, L068a);
+L068a:
+    AOT_BLOCK(0x068a, 2);
+    // 068a: cmp $1, 4(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0690: bge 069c
+    if (!(N ^ V))
+        AOT_GOTO(0x069c, L069c);
+    AOT_GOTO(0x0692, L0692);
+L0692:
+    AOT_BLOCK(0x0692, 2);
+    // 0692: mov 8(r5), r4
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0696: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0698, L0698);
+L0698:
+    AOT_BLOCK(0x0698, 2);
+    // 0698: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 069a: bne 0698
+    if (!Z)
+        AOT_GOTO(0x0698, L0698);
+    AOT_GOTO(0x069c, L069c);
+L069c:
+    AOT_BLOCK(0x069c, 2);
+    // 069c: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06a0: br 0658
+    AOT_GOTO(0x0658, L0658);
+L06a2:
+    AOT_BLOCK(0x06a2, 4);
+    // 06a2: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x06a6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 06a6: mov $2, r4
+    {
+        src = uint16_t(0x0002);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06aa: br 06ea
+    AOT_GOTO(0x06ea, L06ea);
+L06ac:
+    AOT_BLOCK(0x06ac, 15);
+    // 06ac: movb (r2), r0
+    {
+        a = r[2];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 06ae: ash $3, r0
+    {
+        src = uint16_t(0x0003) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 06b2: movb 1(r2), r1
+    {
+        a = uint16_t(r[2] + 1);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 06b6: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 06b8: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 06ba: movb 2(r2), r1
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 06be: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 06c0: bic $8000, r0
+    {
+        src = uint16_t(0x8000);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 06c4: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 06c6: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 06c8: div $39, r0
+    {
+        src = int16_t(uint16_t(0x0039));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 06cc: mov r1, r3
+    {
+        src = r[1];
+        r[3] = src;
+    }
+    // 06ce: asl r3
+    {
+        src = r[3];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[3] = val;
+    }
+    // 06d0: add $906, r3
+    {
+        src = uint16_t(0x0906);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 06d4: br 06e0
+    AOT_GOTO(0x06e0, L06e0);
+L06d6:
+    AOT_BLOCK(0x06d6, 2);
+    // 06d6: cmp $978, r3
+    {
+        src = uint16_t(0x0978);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06da: bcc 06e0
+    if (!C)
+        AOT_GOTO(0x06e0, L06e0);
+    AOT_GOTO(0x06dc, L06dc);
+L06dc:
+    AOT_BLOCK(0x06dc, 1);
+    // 06dc: mov $906, r3
+    {
+        src = uint16_t(0x0906);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x06e0, L06e0);
+L06e0:
+    AOT_BLOCK(0x06e0, 2);
+    // 06e0: tst (r3)+
+    {
+        a = r[3];
+        r[3] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06e2: bne 06d6
+    if (!Z)
+        AOT_GOTO(0x06d6, L06d6);
+    AOT_GOTO(0x06e4, L06e4);
+L06e4:
+    AOT_BLOCK(0x06e4, 2);
+    // 06e4: mov r4, -(r3)
+    {
+        src = r[4];
+        r[3] -= 2;
+        b = r[3];
+        WR16(b, src);
+    }
+    // 06e6: add $4, r4
+    {
+        src = uint16_t(0x0004);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x06ea, L06ea);
+L06ea:
+    AOT_BLOCK(0x06ea, 2);
+    // 06ea: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06ec: bne 06ac
+    if (!Z)
+        AOT_GOTO(0x06ac, L06ac);
+    AOT_GOTO(0x06ee, L06ee);
+L06ee:
+    AOT_BLOCK(0x06ee, 2);
+    // 06ee: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06f2:
+    AOT_BLOCK(0x06f2, 5);
+    // 06f2: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x06f6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 06f6: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 06f8: tstb 05a0
+    {
+        a = 0x05a0;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 06fc: bne 070a
+    if (!Z)
+        AOT_GOTO(0x070a, L070a);
+    AOT_GOTO(0x06fe, L06fe);
+L06fe:
+    AOT_BLOCK(0x06fe, 1);
+    // 06fe: mov $5a0, 07ae
+    {
+        src = uint16_t(0x05a0);
+        b = 0x07ae;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0704, L0704);
+L0704:
+    AOT_BLOCK(0x0704, 1);
+    // 0704: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0706, L0706);
+L0706:
+    AOT_BLOCK(0x0706, 2);
+    // 0706: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L070a:
+    AOT_BLOCK(0x070a, 3);
+    // 070a: mov $d7c, r2
+    {
+        src = uint16_t(0x0d7c);
+        r[2] = src;
+    }
+    // 070e: mov $5a0, r3
+    {
+        src = uint16_t(0x05a0);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0712: br 0722
+    AOT_GOTO(0x0722, L0722);
+L0714:
+    AOT_BLOCK(0x0714, 2);
+    // 0714: cmpb $20, (r3)
+    {
+        src = uint8_t(0x20);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0718: beq 0726
+    if (Z)
+        AOT_GOTO(0x0726, L0726);
+    AOT_GOTO(0x071a, L071a);
+L071a:
+    AOT_BLOCK(0x071a, 2);
+    // 071a: cmpb $9, (r3)
+    {
+        src = uint8_t(0x09);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 071e: beq 0726
+    if (Z)
+        AOT_GOTO(0x0726, L0726);
+    AOT_GOTO(0x0720, L0720);
+L0720:
+    AOT_BLOCK(0x0720, 1);
+    // 0720: movb (r3)+, (r2)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0722, L0722);
+L0722:
+    AOT_BLOCK(0x0722, 2);
+    // 0722: tstb (r3)
+    {
+        a = r[3];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0724: bne 0714
+    if (!Z)
+        AOT_GOTO(0x0714, L0714);
+    AOT_GOTO(0x0726, L0726);
+L0726:
+    AOT_BLOCK(0x0726, 2);
+    // 0726: clrb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0728: br 072c
+    AOT_GOTO(0x072c, L072c);
+L072a:
+    AOT_BLOCK(0x072a, 1);
+    // 072a: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x072c, L072c);
+L072c:
+    AOT_BLOCK(0x072c, 2);
+    // 072c: cmpb $9, (r3)
+    {
+        src = uint8_t(0x09);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0730: beq 072a
+    if (Z)
+        AOT_GOTO(0x072a, L072a);
+    AOT_GOTO(0x0732, L0732);
+L0732:
+    AOT_BLOCK(0x0732, 2);
+    // 0732: cmpb $20, (r3)
+    {
+        src = uint8_t(0x20);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0736: beq 072a
+    if (Z)
+        AOT_GOTO(0x072a, L072a);
+    AOT_GOTO(0x0738, L0738);
+L0738:
+    AOT_BLOCK(0x0738, 16);
+    // 0738: mov r3, 07ae
+    {
+        src = r[3];
+        b = 0x07ae;
+        WR16(b, src);
+    }
+    // 073c: movb 0d7c, r0
+    {
+        a = 0x0d7c;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0740: ash $3, r0
+    {
+        src = uint16_t(0x0003) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 0744: movb 0d7d, r1
+    {
+        a = 0x0d7d;
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 0748: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 074a: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 074c: movb 0d7e, r1
+    {
+        a = 0x0d7e;
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 0750: add r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0752: bic $8000, r0
+    {
+        src = uint16_t(0x8000);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0756: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 0758: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 075a: div $39, r0
+    {
+        src = int16_t(uint16_t(0x0039));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 075e: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0760: add $906, r1
+    {
+        src = uint16_t(0x0906);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0764: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0768: br 07aa
+    AOT_GOTO(0x07aa, L07aa);
+L076a:
+    AOT_BLOCK(0x076a, 2);
+    // 076a: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 076c: mov $d7c, r3
+    {
+        src = uint16_t(0x0d7c);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0770, L0770);
+L0770:
+    AOT_BLOCK(0x0770, 2);
+    // 0770: cmpb (r3), (r2)+
+    {
+        a = r[3];
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0772: bne 077e
+    if (!Z)
+        AOT_GOTO(0x077e, L077e);
+    AOT_GOTO(0x0774, L0774);
+L0774:
+    AOT_BLOCK(0x0774, 2);
+    // 0774: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0776: bne 0770
+    if (!Z)
+        AOT_GOTO(0x0770, L0770);
+    AOT_GOTO(0x0778, L0778);
+L0778:
+    AOT_BLOCK(0x0778, 2);
+    // 0778: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 077c: br 0706
+    AOT_GOTO(0x0706, L0706);
+L077e:
+    AOT_BLOCK(0x077e, 2);
+    // 077e: cmpb $62, (r3)+
+    {
+        src = uint8_t(0x62);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0782: bne 0796
+    if (!Z)
+        AOT_GOTO(0x0796, L0796);
+    AOT_GOTO(0x0784, L0784);
+L0784:
+    AOT_BLOCK(0x0784, 2);
+    // 0784: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0786: bne 0796
+    if (!Z)
+        AOT_GOTO(0x0796, L0796);
+    AOT_GOTO(0x0788, L0788);
+L0788:
+    AOT_BLOCK(0x0788, 2);
+    // 0788: tstb -(r2)
+    {
+        r[2] -= 1;
+        a = r[2];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 078a: bne 0796
+    if (!Z)
+        AOT_GOTO(0x0796, L0796);
+    AOT_GOTO(0x078c, L078c);
+L078c:
+    AOT_BLOCK(0x078c, 3);
+    // 078c: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0790: add $6400, r0
+    {
+        src = uint16_t(0x6400);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0794: br 0706
+    AOT_GOTO(0x0706, L0706);
+L0796:
+    AOT_BLOCK(0x0796, 3);
+    // 0796: add $2, -8(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 079c: cmp $978, -8(r5)
+    {
+        src = uint16_t(0x0978);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07a2: bhi 07aa
+    if (!(C | Z))
+        AOT_GOTO(0x07aa, L07aa);
+    AOT_GOTO(0x07a4, L07a4);
+L07a4:
+    AOT_BLOCK(0x07a4, 1);
+    // 07a4: mov $906, -8(r5)
+    {
+        src = uint16_t(0x0906);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x07aa, L07aa);
+L07aa:
+    AOT_BLOCK(0x07aa, 2);
+    // 07aa: mov *-8(r5), r4
+    {
+        a = RD16(r[5] + -8);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07ae: bne 076a
+    if (!Z)
+        AOT_GOTO(0x076a, L076a);
+    AOT_GOTO(0x07b0, L07b0);
+L07b0:
+    AOT_BLOCK(0x07b0, 2);
+    // 07b0: cmpb $4c, 05a0
+    {
+        src = uint8_t(0x4c);
+        b = 0x05a0;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 07b6: bne 06fe
+    if (!Z)
+        AOT_GOTO(0x06fe, L06fe);
+    AOT_GOTO(0x07b8, L07b8);
+L07b8:
+    AOT_BLOCK(0x07b8, 1);
+    // 07b8: mov $5a1, r3
+    {
+        src = uint16_t(0x05a1);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x07bc, L07bc);
+L07bc:
+    AOT_BLOCK(0x07bc, 2);
+    // 07bc: tstb (r3)
+    {
+        a = r[3];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 07be: beq 07ce
+    if (Z)
+        AOT_GOTO(0x07ce, L07ce);
+    AOT_GOTO(0x07c0, L07c0);
+L07c0:
+    AOT_BLOCK(0x07c0, 2);
+    // 07c0: cmpb $30, (r3)
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 07c4: bgt 0704
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0704, L0704);
+    AOT_GOTO(0x07c6, L07c6);
+L07c6:
+    AOT_BLOCK(0x07c6, 2);
+    // 07c6: cmpb $39, (r3)+
+    {
+        src = uint8_t(0x39);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 07ca: bge 07bc
+    if (!(N ^ V))
+        AOT_GOTO(0x07bc, L07bc);
+    AOT_GOTO(0x07cc, L07cc);
+L07cc:
+    AOT_BLOCK(0x07cc, 1);
+    // 07cc: br 0704
+    AOT_GOTO(0x0704, L0704);
+L07ce:
+    AOT_BLOCK(0x07ce, 3);
+    // 07ce: mov $5a0, 07ae
+    {
+        src = uint16_t(0x05a0);
+        b = 0x07ae;
+        WR16(b, src);
+    }
+    // 07d4: mov $9, r0
+    {
+        src = uint16_t(0x0009);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07d8: br 0706
+    AOT_GOTO(0x0706, L0706);
+L07da:
+    AOT_BLOCK(0x07da, 4);
+    // 07da: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x07de;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 07de: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 07e0: mov $d9c, r2
+    {
+        src = uint16_t(0x0d9c);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x07e4, L07e4);
+L07e4:
+    AOT_BLOCK(0x07e4, 3);
+    // 07e4: clr (r2)+
+    {
+        a = r[2];
+        r[2] += 2;
+        WR16(a, 0);
+    }
+    // 07e6: cmp $e9a, r2
+    {
+        src = uint16_t(0x0e9a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07ea: bhi 07e4
+    if (!(C | Z))
+        AOT_GOTO(0x07e4, L07e4);
+    AOT_GOTO(0x07ec, L07ec);
+L07ec:
+    AOT_BLOCK(0x07ec, 2);
+    // 07ec: mov 07a2, r4
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07f0: br 0810
+    AOT_GOTO(0x0810, L0810);
+L07f2:
+    AOT_BLOCK(0x07f2, 2);
+    // 07f2: cmpb $4, (r4)
+    {
+        src = uint8_t(0x04);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 07f6: bne 080c
+    if (!Z)
+        AOT_GOTO(0x080c, L080c);
+    AOT_GOTO(0x07f8, L07f8);
+L07f8:
+    AOT_BLOCK(0x07f8, 3);
+    // 07f8: mov 8(r4), r1
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 07fc: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 07fe: div $7f, r0
+    {
+        src = int16_t(uint16_t(0x007f));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    AOT_GOTO(0x0802, L0802);
+L0802:
+    AOT_BLOCK(0x0802, 3);
+    // 0802: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 0804: mov r4, d9c(r1)
+    {
+        src = r[4];
+        b = uint16_t(r[1] + 3484);
+        WR16(b, src);
+    }
+    // 0808: clr c(r4)
+    {
+        a = uint16_t(r[4] + 12);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x080c, L080c);
+L080c:
+    AOT_BLOCK(0x080c, 1);
+    // 080c: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0810, L0810);
+L0810:
+    AOT_BLOCK(0x0810, 2);
+    // 0810: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0812: bne 07f2
+    if (!Z)
+        AOT_GOTO(0x07f2, L07f2);
+    AOT_GOTO(0x0814, L0814);
+L0814:
+    AOT_BLOCK(0x0814, 2);
+    // 0814: mov 07a2, r4
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0818: br 0896
+    AOT_GOTO(0x0896, L0896);
+L081a:
+    AOT_BLOCK(0x081a, 2);
+    // 081a: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 081e: beq 082c
+    if (Z)
+        AOT_GOTO(0x082c, L082c);
+    AOT_GOTO(0x0820, L0820);
+L0820:
+    AOT_BLOCK(0x0820, 2);
+    // 0820: cmpb $2, (r4)
+    {
+        src = uint8_t(0x02);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0824: beq 082c
+    if (Z)
+        AOT_GOTO(0x082c, L082c);
+    AOT_GOTO(0x0826, L0826);
+L0826:
+    AOT_BLOCK(0x0826, 2);
+    // 0826: cmpb $9, (r4)
+    {
+        src = uint8_t(0x09);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 082a: bne 0892
+    if (!Z)
+        AOT_GOTO(0x0892, L0892);
+    AOT_GOTO(0x082c, L082c);
+L082c:
+    AOT_BLOCK(0x082c, 7);
+    // 082c: clr 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        WR16(a, 0);
+    }
+    // 0830: mov 8(r4), r1
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 0834: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 0836: div $7f, r0
+    {
+        src = int16_t(uint16_t(0x007f));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 083a: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 083c: mov d9c(r1), r3
+    {
+        a = uint16_t(r[1] + 3484);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0840: beq 084a
+    if (Z)
+        AOT_GOTO(0x084a, L084a);
+    AOT_GOTO(0x0842, L0842);
+L0842:
+    AOT_BLOCK(0x0842, 2);
+    // 0842: cmp 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0848: beq 0866
+    if (Z)
+        AOT_GOTO(0x0866, L0866);
+    AOT_GOTO(0x084a, L084a);
+L084a:
+    AOT_BLOCK(0x084a, 2);
+    // 084a: mov 07a2, r3
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 084e: br 0862
+    AOT_GOTO(0x0862, L0862);
+L0850:
+    AOT_BLOCK(0x0850, 2);
+    // 0850: cmpb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0854: bne 085e
+    if (!Z)
+        AOT_GOTO(0x085e, L085e);
+    AOT_GOTO(0x0856, L0856);
+L0856:
+    AOT_BLOCK(0x0856, 2);
+    // 0856: cmp 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 085c: beq 0866
+    if (Z)
+        AOT_GOTO(0x0866, L0866);
+    AOT_GOTO(0x085e, L085e);
+L085e:
+    AOT_BLOCK(0x085e, 1);
+    // 085e: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0862, L0862);
+L0862:
+    AOT_BLOCK(0x0862, 2);
+    // 0862: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0864: bne 0850
+    if (!Z)
+        AOT_GOTO(0x0850, L0850);
+    AOT_GOTO(0x0866, L0866);
+L0866:
+    AOT_BLOCK(0x0866, 2);
+    // 0866: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0868: beq 0892
+    if (Z)
+        AOT_GOTO(0x0892, L0892);
+    AOT_GOTO(0x086a, L086a);
+L086a:
+    AOT_BLOCK(0x086a, 2);
+    // 086a: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 086c: jsr pc, *$14ae
+    {
+        a = 0x14ae;
+        r[6] -= 2;
+        WR16(r[6], 0x0870);
+    }
+    AOT_GOTO(0x14ae, L14ae);
+L0870:
+    AOT_BLOCK(0x0870, 3);
+    // 0870: mov 4(r0), -8(r5)
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0876: cmp r3, -8(r5)
+    {
+        src = r[3];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 087a: beq 088a
+    if (Z)
+        AOT_GOTO(0x088a, L088a);
+    AOT_GOTO(0x087c, L087c);
+L087c:
+    AOT_BLOCK(0x087c, 3);
+    // 087c: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0880: mov 8(r0), 8(r4)
+    {
+        a = uint16_t(r[0] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 0886: mov -8(r5), r3
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x088a, L088a);
+L088a:
+    AOT_BLOCK(0x088a, 2);
+    // 088a: mov r3, 6(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 088e: inc c(r3)
+    {
+        a = uint16_t(r[3] + 12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0892, L0892);
+L0892:
+    AOT_BLOCK(0x0892, 1);
+    // 0892: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0896, L0896);
+L0896:
+    AOT_BLOCK(0x0896, 2);
+    // 0896: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0898: bne 081a
+    if (!Z)
+        AOT_GOTO(0x081a, L081a);
+    AOT_GOTO(0x089a, L089a);
+L089a:
+    AOT_BLOCK(0x089a, 2);
+    // 089a: mov 07a2, r4
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 089e: br 08c8
+    AOT_GOTO(0x08c8, L08c8);
+L08a0:
+    AOT_BLOCK(0x08a0, 2);
+    // 08a0: cmpb $4, (r4)
+    {
+        src = uint8_t(0x04);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08a4: bne 08c4
+    if (!Z)
+        AOT_GOTO(0x08c4, L08c4);
+    AOT_GOTO(0x08a6, L08a6);
+L08a6:
+    AOT_BLOCK(0x08a6, 2);
+    // 08a6: tst c(r4)
+    {
+        a = uint16_t(r[4] + 12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08aa: bne 08c4
+    if (!Z)
+        AOT_GOTO(0x08c4, L08c4);
+    AOT_GOTO(0x08ac, L08ac);
+L08ac:
+    AOT_BLOCK(0x08ac, 2);
+    // 08ac: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08ae: jsr pc, *$14ae
+    {
+        a = 0x14ae;
+        r[6] -= 2;
+        WR16(r[6], 0x08b2);
+    }
+    AOT_GOTO(0x14ae, L14ae);
+L08b2:
+    AOT_BLOCK(0x08b2, 3);
+    // 08b2: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 08b4: tstb (r3)
+    {
+        a = r[3];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08b6: beq 08c4
+    if (Z)
+        AOT_GOTO(0x08c4, L08c4);
+    AOT_GOTO(0x08b8, L08b8);
+L08b8:
+    AOT_BLOCK(0x08b8, 2);
+    // 08b8: cmpb $9, (r3)
+    {
+        src = uint8_t(0x09);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08bc: beq 08c4
+    if (Z)
+        AOT_GOTO(0x08c4, L08c4);
+    AOT_GOTO(0x08be, L08be);
+L08be:
+    AOT_BLOCK(0x08be, 2);
+    // 08be: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08c0: jsr pc, *$1484
+    {
+        a = 0x1484;
+        r[6] -= 2;
+        WR16(r[6], 0x08c4);
+    }
+    AOT_GOTO(0x1484, L1484);
+L08c4:
+    AOT_BLOCK(0x08c4, 1);
+    // 08c4: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x08c8, L08c8);
+L08c8:
+    AOT_BLOCK(0x08c8, 2);
+    // 08c8: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08ca: bne 08a0
+    if (!Z)
+        AOT_GOTO(0x08a0, L08a0);
+    AOT_GOTO(0x08cc, L08cc);
+L08cc:
+    AOT_BLOCK(0x08cc, 2);
+    // 08cc: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L08d0:
+    AOT_BLOCK(0x08d0, 4);
+    // 08d0: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x08d4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 08d4: clr 07d0
+    {
+        a = 0x07d0;
+        WR16(a, 0);
+        C = false;
+    }
+    // 08d8: mov 07a2, r4
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x08dc, L08dc);
+L08dc:
+    AOT_BLOCK(0x08dc, 2);
+    // 08dc: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08de: bne 08e4
+    if (!Z)
+        AOT_GOTO(0x08e4, L08e4);
+    AOT_GOTO(0x08e0, L08e0);
+L08e0:
+    AOT_BLOCK(0x08e0, 1);
+    // 08e0: jmp *$0a68
+    {
+        a = 0x0a68;
+    }
+    AOT_GOTO(0x0a68, L0a68);
+L08e4:
+    AOT_BLOCK(0x08e4, 2);
+    // 08e4: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08e8: beq 08f6
+    if (Z)
+        AOT_GOTO(0x08f6, L08f6);
+    AOT_GOTO(0x08ea, L08ea);
+L08ea:
+    AOT_BLOCK(0x08ea, 2);
+    // 08ea: cmpb $2, (r4)
+    {
+        src = uint8_t(0x02);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08ee: beq 08f6
+    if (Z)
+        AOT_GOTO(0x08f6, L08f6);
+    AOT_GOTO(0x08f0, L08f0);
+L08f0:
+    AOT_BLOCK(0x08f0, 2);
+    // 08f0: cmpb $9, (r4)
+    {
+        src = uint8_t(0x09);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08f4: bne 093e
+    if (!Z)
+        AOT_GOTO(0x093e, L093e);
+    AOT_GOTO(0x08f6, L08f6);
+L08f6:
+    AOT_BLOCK(0x08f6, 2);
+    // 08f6: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08fa: beq 093e
+    if (Z)
+        AOT_GOTO(0x093e, L093e);
+    AOT_GOTO(0x08fc, L08fc);
+L08fc:
+    AOT_BLOCK(0x08fc, 1);
+    // 08fc: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0900, L0900);
+L0900:
+    AOT_BLOCK(0x0900, 1);
+    // 0900: jsr pc, *$14ae
+    {
+        a = 0x14ae;
+        r[6] -= 2;
+        WR16(r[6], 0x0904);
+    }
+    AOT_GOTO(0x14ae, L14ae);
+L0904:
+    AOT_BLOCK(0x0904, 3);
+    // 0904: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0906: cmpb $1, (r3)
+    {
+        src = uint8_t(0x01);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 090a: bne 093e
+    if (!Z)
+        AOT_GOTO(0x093e, L093e);
+    AOT_GOTO(0x090c, L090c);
+L090c:
+    AOT_BLOCK(0x090c, 2);
+    // 090c: tst 8(r3)
+    {
+        a = uint16_t(r[3] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0910: beq 093e
+    if (Z)
+        AOT_GOTO(0x093e, L093e);
+    AOT_GOTO(0x0912, L0912);
+L0912:
+    AOT_BLOCK(0x0912, 2);
+    // 0912: cmp 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0918: beq 093e
+    if (Z)
+        AOT_GOTO(0x093e, L093e);
+    AOT_GOTO(0x091a, L091a);
+L091a:
+    AOT_BLOCK(0x091a, 4);
+    // 091a: inc 07b0
+    {
+        a = 0x07b0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 091e: mov 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 0924: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0928: jsr pc, *$1484
+    {
+        a = 0x1484;
+        r[6] -= 2;
+        WR16(r[6], 0x092c);
+    }
+    AOT_GOTO(0x1484, L1484);
+L092c:
+    AOT_BLOCK(0x092c, 4);
+    // 092c: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0930: inc c(r0)
+    {
+        a = uint16_t(r[0] + 12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0934: mov 6(r3), 6(r4)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 093a: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x093e, L093e);
+L093e:
+    AOT_BLOCK(0x093e, 2);
+    // 093e: cmpb $2, (r4)
+    {
+        src = uint8_t(0x02);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0942: bne 0994
+    if (!Z)
+        AOT_GOTO(0x0994, L0994);
+    AOT_GOTO(0x0944, L0944);
+L0944:
+    AOT_BLOCK(0x0944, 3);
+    // 0944: mov 2(r4), r2
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0948: cmpb $1, (r2)
+    {
+        src = uint8_t(0x01);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 094c: bne 0994
+    if (!Z)
+        AOT_GOTO(0x0994, L0994);
+    AOT_GOTO(0x094e, L094e);
+L094e:
+    AOT_BLOCK(0x094e, 1);
+    // 094e: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0952, L0952);
+L0952:
+    AOT_BLOCK(0x0952, 3);
+    // 0952: mov 4(r3), r3
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0956: cmpb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 095a: beq 0952
+    if (Z)
+        AOT_GOTO(0x0952, L0952);
+    AOT_GOTO(0x095c, L095c);
+L095c:
+    AOT_BLOCK(0x095c, 2);
+    // 095c: cmp r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 095e: bne 0994
+    if (!Z)
+        AOT_GOTO(0x0994, L0994);
+    AOT_GOTO(0x0960, L0960);
+L0960:
+    AOT_BLOCK(0x0960, 2);
+    // 0960: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0964: jsr pc, *$1484
+    {
+        a = 0x1484;
+        r[6] -= 2;
+        WR16(r[6], 0x0968);
+    }
+    AOT_GOTO(0x1484, L1484);
+L0968:
+    AOT_BLOCK(0x0968, 9);
+    // 0968: mov 6(r2), 6(r4)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 096e: mov 8(r2), 8(r4)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 0974: mov 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0978: mov r4, 4(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 097c: mov 2(r2), 2(r4)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 0982: movb 1(r4), r0
+    {
+        a = uint16_t(r[4] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0986: movb d2(r0), 1(r4)
+    {
+        a = uint16_t(r[0] + 210);
+        src = RD8(a);
+        b = uint16_t(r[4] + 1);
+        WR8(b, src);
+    }
+    // 098c: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0990: inc 07c6
+    {
+        a = 0x07c6;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0994, L0994);
+L0994:
+    AOT_BLOCK(0x0994, 2);
+    // 0994: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0998: beq 0a00
+    if (Z)
+        AOT_GOTO(0x0a00, L0a00);
+    AOT_GOTO(0x099a, L099a);
+L099a:
+    AOT_BLOCK(0x099a, 2);
+    // 099a: cmpb $3, (r4)
+    {
+        src = uint8_t(0x03);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 099e: beq 0a00
+    if (Z)
+        AOT_GOTO(0x0a00, L0a00);
+    AOT_GOTO(0x09a0, L09a0);
+L09a0:
+    AOT_BLOCK(0x09a0, 1);
+    // 09a0: br 0a40
+    AOT_GOTO(0x0a40, L0a40);
+L09a2:
+    AOT_BLOCK(0x09a2, 2);
+    // 09a2: cmpb $4, *2(r4)
+    {
+        src = uint8_t(0x04);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 09a8: beq 0a06
+    if (Z)
+        AOT_GOTO(0x0a06, L0a06);
+    AOT_GOTO(0x09aa, L09aa);
+L09aa:
+    AOT_BLOCK(0x09aa, 2);
+    // 09aa: cmpb $5, *2(r4)
+    {
+        src = uint8_t(0x05);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 09b0: beq 0a06
+    if (Z)
+        AOT_GOTO(0x0a06, L0a06);
+    AOT_GOTO(0x09b2, L09b2);
+L09b2:
+    AOT_BLOCK(0x09b2, 2);
+    // 09b2: cmpb $7, *2(r4)
+    {
+        src = uint8_t(0x07);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 09b8: beq 0a06
+    if (Z)
+        AOT_GOTO(0x0a06, L0a06);
+    AOT_GOTO(0x09ba, L09ba);
+L09ba:
+    AOT_BLOCK(0x09ba, 2);
+    // 09ba: cmpb $30, *2(r4)
+    {
+        src = uint8_t(0x30);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 09c0: beq 0a06
+    if (Z)
+        AOT_GOTO(0x0a06, L0a06);
+    AOT_GOTO(0x09c2, L09c2);
+L09c2:
+    AOT_BLOCK(0x09c2, 2);
+    // 09c2: tstb *2(r4)
+    {
+        a = RD16(r[4] + 2);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09c6: beq 0a06
+    if (Z)
+        AOT_GOTO(0x0a06, L0a06);
+    AOT_GOTO(0x09c8, L09c8);
+L09c8:
+    AOT_BLOCK(0x09c8, 2);
+    // 09c8: cmpb $1f, *2(r4)
+    {
+        src = uint8_t(0x1f);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 09ce: beq 0a06
+    if (Z)
+        AOT_GOTO(0x0a06, L0a06);
+    AOT_GOTO(0x09d0, L09d0);
+L09d0:
+    AOT_BLOCK(0x09d0, 5);
+    // 09d0: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09d4: inc 07b6
+    {
+        a = 0x07b6;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 09d8: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 09dc: tst 6(r0)
+    {
+        a = uint16_t(r[0] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09e0: beq 09ee
+    if (Z)
+        AOT_GOTO(0x09ee, L09ee);
+    AOT_GOTO(0x09e2, L09e2);
+L09e2:
+    AOT_BLOCK(0x09e2, 3);
+    // 09e2: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 09e6: mov 6(r0), (sp)
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09ea: jsr pc, *$1484
+    {
+        a = 0x1484;
+        r[6] -= 2;
+        WR16(r[6], 0x09ee);
+    }
+    AOT_GOTO(0x1484, L1484);
+L09ee:
+    AOT_BLOCK(0x09ee, 4);
+    // 09ee: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 09f2: mov 2(r0), 2(r4)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 09f8: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 09fc: mov r4, 4(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a00, L0a00);
+L0a00:
+    AOT_BLOCK(0x0a00, 2);
+    // 0a00: tst 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a04: bne 09a2
+    if (!Z)
+        AOT_GOTO(0x09a2, L09a2);
+    AOT_GOTO(0x0a06, L0a06);
+L0a06:
+    AOT_BLOCK(0x0a06, 1);
+    // 0a06: mov 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a0a, L0a0a);
+L0a0a:
+    AOT_BLOCK(0x0a0a, 2);
+    // 0a0a: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a0c: beq 0a40
+    if (Z)
+        AOT_GOTO(0x0a40, L0a40);
+    AOT_GOTO(0x0a0e, L0a0e);
+L0a0e:
+    AOT_BLOCK(0x0a0e, 2);
+    // 0a0e: cmpb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a12: bne 0a40
+    if (!Z)
+        AOT_GOTO(0x0a40, L0a40);
+    AOT_GOTO(0x0a14, L0a14);
+L0a14:
+    AOT_BLOCK(0x0a14, 2);
+    // 0a14: cmp r3, 6(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a18: bne 0a62
+    if (!Z)
+        AOT_GOTO(0x0a62, L0a62);
+    AOT_GOTO(0x0a1a, L0a1a);
+L0a1a:
+    AOT_BLOCK(0x0a1a, 7);
+    // 0a1a: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0a1e: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0a24: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0a28: mov 4(r4), 4(r0)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0a2e: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0a32: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a34: jsr pc, *$1484
+    {
+        a = 0x1484;
+        r[6] -= 2;
+        WR16(r[6], 0x0a38);
+    }
+    AOT_GOTO(0x1484, L1484);
+L0a38:
+    AOT_BLOCK(0x0a38, 2);
+    // 0a38: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0a3c: inc 07b8
+    {
+        a = 0x07b8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0a40, L0a40);
+L0a40:
+    AOT_BLOCK(0x0a40, 2);
+    // 0a40: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a44: beq 0a4c
+    if (Z)
+        AOT_GOTO(0x0a4c, L0a4c);
+    AOT_GOTO(0x0a46, L0a46);
+L0a46:
+    AOT_BLOCK(0x0a46, 2);
+    // 0a46: cmpb $3, (r4)
+    {
+        src = uint8_t(0x03);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a4a: bne 0a5a
+    if (!Z)
+        AOT_GOTO(0x0a5a, L0a5a);
+    AOT_GOTO(0x0a4c, L0a4c);
+L0a4c:
+    AOT_BLOCK(0x0a4c, 2);
+    // 0a4c: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a4e: jsr pc, *$0a6c
+    {
+        a = 0x0a6c;
+        r[6] -= 2;
+        WR16(r[6], 0x0a52);
+    }
+    AOT_GOTO(0x0a6c, L0a6c);
+L0a52:
+    AOT_BLOCK(0x0a52, 2);
+    // 0a52: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a54: jsr pc, *$0b38
+    {
+        a = 0x0b38;
+        r[6] -= 2;
+        WR16(r[6], 0x0a58);
+    }
+    AOT_GOTO(0x0b38, L0b38);
+L0a58:
+    AOT_BLOCK(0x0a58, 1);
+    // 0a58: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a5a, L0a5a);
+L0a5a:
+    AOT_BLOCK(0x0a5a, 2);
+    // 0a5a: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a5e: jmp *$08dc
+    {
+        a = 0x08dc;
+    }
+    AOT_GOTO(0x08dc, L08dc);
+L0a62:
+    AOT_BLOCK(0x0a62, 2);
+    // 0a62: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a66: br 0a0a
+    AOT_GOTO(0x0a0a, L0a0a);
+L0a68:
+    AOT_BLOCK(0x0a68, 2);
+    // 0a68: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a6c:
+    AOT_BLOCK(0x0a6c, 5);
+    // 0a6c: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a70;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 0a70: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0a74: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a78: beq 0acc
+    if (Z)
+        AOT_GOTO(0x0acc, L0acc);
+    AOT_GOTO(0x0a7a, L0a7a);
+L0a7a:
+    AOT_BLOCK(0x0a7a, 2);
+    // 0a7a: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a7e: beq 0a86
+    if (Z)
+        AOT_GOTO(0x0a86, L0a86);
+    AOT_GOTO(0x0a80, L0a80);
+L0a80:
+    AOT_BLOCK(0x0a80, 2);
+    // 0a80: cmpb $4, (r4)
+    {
+        src = uint8_t(0x04);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a84: beq 0a7a
+    if (Z)
+        AOT_GOTO(0x0a7a, L0a7a);
+    AOT_GOTO(0x0a86, L0a86);
+L0a86:
+    AOT_BLOCK(0x0a86, 2);
+    // 0a86: mov 4(r3), r3
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a8a: beq 0a92
+    if (Z)
+        AOT_GOTO(0x0a92, L0a92);
+    AOT_GOTO(0x0a8c, L0a8c);
+L0a8c:
+    AOT_BLOCK(0x0a8c, 2);
+    // 0a8c: cmpb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a90: beq 0a86
+    if (Z)
+        AOT_GOTO(0x0a86, L0a86);
+    AOT_GOTO(0x0a92, L0a92);
+L0a92:
+    AOT_BLOCK(0x0a92, 3);
+    // 0a92: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0a94: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a96: jsr pc, *$142e
+    {
+        a = 0x142e;
+        r[6] -= 2;
+        WR16(r[6], 0x0a9a);
+    }
+    AOT_GOTO(0x142e, L142e);
+L0a9a:
+    AOT_BLOCK(0x0a9a, 3);
+    // 0a9a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0a9c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a9e: beq 0acc
+    if (Z)
+        AOT_GOTO(0x0acc, L0acc);
+    AOT_GOTO(0x0aa0, L0aa0);
+L0aa0:
+    AOT_BLOCK(0x0aa0, 2);
+    // 0aa0: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0aa2: beq 0acc
+    if (Z)
+        AOT_GOTO(0x0acc, L0acc);
+    AOT_GOTO(0x0aa4, L0aa4);
+L0aa4:
+    AOT_BLOCK(0x0aa4, 2);
+    // 0aa4: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0aa6: jsr pc, *$0ad0
+    {
+        a = 0x0ad0;
+        r[6] -= 2;
+        WR16(r[6], 0x0aaa);
+    }
+    AOT_GOTO(0x0ad0, L0ad0);
+L0aaa:
+    AOT_BLOCK(0x0aaa, 9);
+    // 0aaa: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0aac: movb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 0ab0: clrb 1(r4)
+    {
+        a = uint16_t(r[4] + 1);
+        WR8(a, 0);
+    }
+    // 0ab4: mov r2, 6(r4)
+    {
+        src = r[2];
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 0ab8: mov 8(r2), 8(r4)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 0abe: clr a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0ac2: inc 07bc
+    {
+        a = 0x07bc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0ac6: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0aca: br 0a7a
+    AOT_GOTO(0x0a7a, L0a7a);
+L0acc:
+    AOT_BLOCK(0x0acc, 2);
+    // 0acc: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0ad0:
+    AOT_BLOCK(0x0ad0, 5);
+    // 0ad0: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0ad4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 0ad4: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0ad8: cmpb $4, (r4)
+    {
+        src = uint8_t(0x04);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0adc: bne 0aec
+    if (!Z)
+        AOT_GOTO(0x0aec, L0aec);
+    AOT_GOTO(0x0ade, L0ade);
+L0ade:
+    AOT_BLOCK(0x0ade, 3);
+    // 0ade: inc c(r4)
+    {
+        a = uint16_t(r[4] + 12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0ae2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ae4: br 0b34
+    AOT_GOTO(0x0b34, L0b34);
+L0ae6:
+    AOT_BLOCK(0x0ae6, 2);
+    // 0ae6: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0aea: br 0ade
+    AOT_GOTO(0x0ade, L0ade);
+L0aec:
+    AOT_BLOCK(0x0aec, 2);
+    // 0aec: cmpb (pc), *4(r4)
+    {
+        src = uint8_t(0x04);
+        b = RD16(r[4] + 4);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0af0: beq 0ae6
+    if (Z)
+        AOT_GOTO(0x0ae6, L0ae6);
+    AOT_GOTO(0x0af2, L0af2);
+L0af2:
+    AOT_BLOCK(0x0af2, 2);
+    // 0af2: mov $e, (sp)
+    {
+        src = uint16_t(0x000e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0af6: jsr pc, *$14d2
+    {
+        a = 0x14d2;
+        r[6] -= 2;
+        WR16(r[6], 0x0afa);
+    }
+    AOT_GOTO(0x14d2, L14d2);
+L0afa:
+    AOT_BLOCK(0x0afa, 14);
+    // 0afa: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0afc: movb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        WR8(b, src);
+    }
+    // 0b00: clrb 1(r3)
+    {
+        a = uint16_t(r[3] + 1);
+        WR8(a, 0);
+    }
+    // 0b04: mov 00dc, 8(r3)
+    {
+        a = 0x00dc;
+        src = RD16(a);
+        b = uint16_t(r[3] + 8);
+        WR16(b, src);
+    }
+    // 0b0a: inc 00dc
+    {
+        a = 0x00dc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0b0e: clr 6(r3)
+    {
+        a = uint16_t(r[3] + 6);
+        WR16(a, 0);
+    }
+    // 0b12: clr a(r3)
+    {
+        a = uint16_t(r[3] + 10);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0b16: mov $1, c(r3)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[3] + 12);
+        WR16(b, src);
+    }
+    // 0b1c: mov 4(r4), 4(r3)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[3] + 4);
+        WR16(b, src);
+    }
+    // 0b22: mov r4, 2(r3)
+    {
+        src = r[4];
+        b = uint16_t(r[3] + 2);
+        WR16(b, src);
+    }
+    // 0b26: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b2a: mov r3, 2(r0)
+    {
+        src = r[3];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0b2e: mov r3, 4(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 0b32: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b34, L0b34);
+L0b34:
+    AOT_BLOCK(0x0b34, 2);
+    // 0b34: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0b38:
+    AOT_BLOCK(0x0b38, 6);
+    // 0b38: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0b3c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 0b3c: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0b40: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0b44: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b48: bne 0bd0
+    if (!Z)
+        AOT_GOTO(0x0bd0, L0bd0);
+    AOT_GOTO(0x0b4a, L0b4a);
+L0b4a:
+    AOT_BLOCK(0x0b4a, 2);
+    // 0b4a: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b4e: bne 0b58
+    if (!Z)
+        AOT_GOTO(0x0b58, L0b58);
+    AOT_GOTO(0x0b50, L0b50);
+L0b50:
+    AOT_BLOCK(0x0b50, 1);
+    // 0b50: br 0bd0
+    AOT_GOTO(0x0bd0, L0bd0);
+L0b52:
+    AOT_BLOCK(0x0b52, 2);
+    // 0b52: mov 4(r3), r3
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b56: beq 0bd0
+    if (Z)
+        AOT_GOTO(0x0bd0, L0bd0);
+    AOT_GOTO(0x0b58, L0b58);
+L0b58:
+    AOT_BLOCK(0x0b58, 2);
+    // 0b58: cmpb $4, (r3)
+    {
+        src = uint8_t(0x04);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b5c: beq 0b52
+    if (Z)
+        AOT_GOTO(0x0b52, L0b52);
+    AOT_GOTO(0x0b5e, L0b5e);
+L0b5e:
+    AOT_BLOCK(0x0b5e, 2);
+    // 0b5e: cmpb $1, (r3)
+    {
+        src = uint8_t(0x01);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b62: beq 0b6a
+    if (Z)
+        AOT_GOTO(0x0b6a, L0b6a);
+    AOT_GOTO(0x0b64, L0b64);
+L0b64:
+    AOT_BLOCK(0x0b64, 2);
+    // 0b64: cmpb $3, (r3)
+    {
+        src = uint8_t(0x03);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b68: bne 0bd6
+    if (!Z)
+        AOT_GOTO(0x0bd6, L0bd6);
+    AOT_GOTO(0x0b6a, L0b6a);
+L0b6a:
+    AOT_BLOCK(0x0b6a, 3);
+    // 0b6a: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0b6e: mov 6(r4), r2
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b72: br 0bbc
+    AOT_GOTO(0x0bbc, L0bbc);
+L0b74:
+    AOT_BLOCK(0x0b74, 14);
+    // 0b74: inc 07be
+    {
+        a = 0x07be;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0b78: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0b7c: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b80: mov r3, 2(r0)
+    {
+        src = r[3];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0b84: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b88: mov r2, 4(r0)
+    {
+        src = r[2];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0b8c: mov 4(r3), r0
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b90: mov 2(r2), 2(r0)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0b96: mov 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b9a: mov 4(r3), 4(r0)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0ba0: mov 4(r4), 4(r3)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[3] + 4);
+        WR16(b, src);
+    }
+    // 0ba6: mov 2(r4), 2(r2)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 0bac: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bb0: jsr pc, *$1484
+    {
+        a = 0x1484;
+        r[6] -= 2;
+        WR16(r[6], 0x0bb4);
+    }
+    AOT_GOTO(0x1484, L1484);
+L0bb4:
+    AOT_BLOCK(0x0bb4, 2);
+    // 0bb4: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bb6: br 0bd2
+    AOT_GOTO(0x0bd2, L0bd2);
+L0bb8:
+    AOT_BLOCK(0x0bb8, 1);
+    // 0bb8: mov 2(r2), r2
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bbc, L0bbc);
+L0bbc:
+    AOT_BLOCK(0x0bbc, 2);
+    // 0bbc: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0bbe: beq 0bd0
+    if (Z)
+        AOT_GOTO(0x0bd0, L0bd0);
+    AOT_GOTO(0x0bc0, L0bc0);
+L0bc0:
+    AOT_BLOCK(0x0bc0, 2);
+    // 0bc0: cmpb $1, (r2)
+    {
+        src = uint8_t(0x01);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0bc4: beq 0bcc
+    if (Z)
+        AOT_GOTO(0x0bcc, L0bcc);
+    AOT_GOTO(0x0bc6, L0bc6);
+L0bc6:
+    AOT_BLOCK(0x0bc6, 2);
+    // 0bc6: cmpb $3, (r2)
+    {
+        src = uint8_t(0x03);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0bca: bne 0bb8
+    if (!Z)
+        AOT_GOTO(0x0bb8, L0bb8);
+    AOT_GOTO(0x0bcc, L0bcc);
+L0bcc:
+    AOT_BLOCK(0x0bcc, 2);
+    // 0bcc: cmp r2, r4
+    {
+        src = r[2];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bce: bne 0b74
+    if (!Z)
+        AOT_GOTO(0x0b74, L0b74);
+    AOT_GOTO(0x0bd0, L0bd0);
+L0bd0:
+    AOT_BLOCK(0x0bd0, 1);
+    // 0bd0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bd2, L0bd2);
+L0bd2:
+    AOT_BLOCK(0x0bd2, 2);
+    // 0bd2: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0bd6:
+    AOT_BLOCK(0x0bd6, 2);
+    // 0bd6: cmpb $4, *2(r4)
+    {
+        src = uint8_t(0x04);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0bdc: bne 0bd0
+    if (!Z)
+        AOT_GOTO(0x0bd0, L0bd0);
+    AOT_GOTO(0x0bde, L0bde);
+L0bde:
+    AOT_BLOCK(0x0bde, 3);
+    // 0bde: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0be2: mov r3, r2
+    {
+        src = r[3];
+        r[2] = src;
+    }
+    // 0be4: mov $10, -c(r5)
+    {
+        src = uint16_t(0x0010);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bea, L0bea);
+L0bea:
+    AOT_BLOCK(0x0bea, 2);
+    // 0bea: mov 2(r2), r2
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0bee: beq 0bd0
+    if (Z)
+        AOT_GOTO(0x0bd0, L0bd0);
+    AOT_GOTO(0x0bf0, L0bf0);
+L0bf0:
+    AOT_BLOCK(0x0bf0, 2);
+    // 0bf0: cmp r4, r2
+    {
+        src = r[4];
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bf2: beq 0bd0
+    if (Z)
+        AOT_GOTO(0x0bd0, L0bd0);
+    AOT_GOTO(0x0bf4, L0bf4);
+L0bf4:
+    AOT_BLOCK(0x0bf4, 2);
+    // 0bf4: dec -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0bf8: beq 0bd0
+    if (Z)
+        AOT_GOTO(0x0bd0, L0bd0);
+    AOT_GOTO(0x0bfa, L0bfa);
+L0bfa:
+    AOT_BLOCK(0x0bfa, 2);
+    // 0bfa: cmpb $2, (r2)
+    {
+        src = uint8_t(0x02);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0bfe: bne 0bea
+    if (!Z)
+        AOT_GOTO(0x0bea, L0bea);
+    AOT_GOTO(0x0c00, L0c00);
+L0c00:
+    AOT_BLOCK(0x0c00, 3);
+    // 0c00: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c04: cmp 8(r2), 8(r0)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[0] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c0a: bne 0bea
+    if (!Z)
+        AOT_GOTO(0x0bea, L0bea);
+    AOT_GOTO(0x0c0c, L0c0c);
+L0c0c:
+    AOT_BLOCK(0x0c0c, 2);
+    // 0c0c: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c10: bne 0c18
+    if (!Z)
+        AOT_GOTO(0x0c18, L0c18);
+    AOT_GOTO(0x0c12, L0c12);
+L0c12:
+    AOT_BLOCK(0x0c12, 2);
+    // 0c12: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c16: br 0bd2
+    AOT_GOTO(0x0bd2, L0bd2);
+L0c18:
+    AOT_BLOCK(0x0c18, 2);
+    // 0c18: cmp r2, r4
+    {
+        src = r[2];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c1a: bne 0c0c
+    if (!Z)
+        AOT_GOTO(0x0c0c, L0c0c);
+    AOT_GOTO(0x0c1c, L0c1c);
+L0c1c:
+    AOT_BLOCK(0x0c1c, 3);
+    // 0c1c: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0c20: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c22: jsr pc, *$0ad0
+    {
+        a = 0x0ad0;
+        r[6] -= 2;
+        WR16(r[6], 0x0c26);
+    }
+    AOT_GOTO(0x0ad0, L0ad0);
+L0c26:
+    AOT_BLOCK(0x0c26, 5);
+    // 0c26: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0c2a: movb 1(r2), r0
+    {
+        a = uint16_t(r[2] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0c2e: movb d2(r0), 1(r2)
+    {
+        a = uint16_t(r[0] + 210);
+        src = RD8(a);
+        b = uint16_t(r[2] + 1);
+        WR8(b, src);
+    }
+    // 0c34: mov 6(r2), (sp)
+    {
+        a = uint16_t(r[2] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c38: jsr pc, *$1484
+    {
+        a = 0x1484;
+        r[6] -= 2;
+        WR16(r[6], 0x0c3c);
+    }
+    AOT_GOTO(0x1484, L1484);
+L0c3c:
+    AOT_BLOCK(0x0c3c, 16);
+    // 0c3c: mov 4(r3), r0
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c40: mov r4, 2(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0c44: mov 2(r2), r0
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c48: mov r4, 4(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0c4c: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c50: mov r3, 2(r0)
+    {
+        src = r[3];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0c54: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c58: mov r2, 4(r0)
+    {
+        src = r[2];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0c5c: mov 4(r4), -8(r5)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0c62: mov 4(r3), 4(r4)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 0c68: mov -8(r5), 4(r3)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[3] + 4);
+        WR16(b, src);
+    }
+    // 0c6e: mov 2(r4), -8(r5)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0c74: mov 2(r2), 2(r4)
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 0c7a: mov -8(r5), 2(r2)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[2] + 2);
+        WR16(b, src);
+    }
+    // 0c80: mov 2(r4), (sp)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c84: jsr pc, *$0ad0
+    {
+        a = 0x0ad0;
+        r[6] -= 2;
+        WR16(r[6], 0x0c88);
+    }
+    AOT_GOTO(0x0ad0, L0ad0);
+L0c88:
+    AOT_BLOCK(0x0c88, 5);
+    // 0c88: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0c8a: mov 8(r3), 8(r2)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[2] + 8);
+        WR16(b, src);
+    }
+    // 0c90: mov r3, 6(r2)
+    {
+        src = r[3];
+        b = uint16_t(r[2] + 6);
+        WR16(b, src);
+    }
+    // 0c94: mov -a(r5), (sp)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c98: jsr pc, *$1484
+    {
+        a = 0x1484;
+        r[6] -= 2;
+        WR16(r[6], 0x0c9c);
+    }
+    AOT_GOTO(0x1484, L1484);
+L0c9c:
+    AOT_BLOCK(0x0c9c, 3);
+    // 0c9c: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0ca0: tst c(r0)
+    {
+        a = uint16_t(r[0] + 12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ca4: bgt 0caa
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0caa, L0caa);
+    AOT_GOTO(0x0ca6, L0ca6);
+L0ca6:
+    AOT_BLOCK(0x0ca6, 1);
+    // 0ca6: dec 07ba
+    {
+        a = 0x07ba;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0caa, L0caa);
+L0caa:
+    AOT_BLOCK(0x0caa, 4);
+    // 0caa: inc 07c2
+    {
+        a = 0x07c2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0cae: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0cb2: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cb4: br 0bd2
+    AOT_GOTO(0x0bd2, L0bd2);
+L0cb6:
+    AOT_BLOCK(0x0cb6, 4);
+    // 0cb6: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0cba;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 0cba: mov 07a2, r4
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cbe: br 0cfc
+    AOT_GOTO(0x0cfc, L0cfc);
+L0cc0:
+    AOT_BLOCK(0x0cc0, 2);
+    // 0cc0: cmpb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0cc4: bne 0cf8
+    if (!Z)
+        AOT_GOTO(0x0cf8, L0cf8);
+    AOT_GOTO(0x0cc6, L0cc6);
+L0cc6:
+    AOT_BLOCK(0x0cc6, 2);
+    // 0cc6: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cca: beq 0cf8
+    if (Z)
+        AOT_GOTO(0x0cf8, L0cf8);
+    AOT_GOTO(0x0ccc, L0ccc);
+L0ccc:
+    AOT_BLOCK(0x0ccc, 2);
+    // 0ccc: cmp $1, c(r3)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[3] + 12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cd2: bge 0cf8
+    if (!(N ^ V))
+        AOT_GOTO(0x0cf8, L0cf8);
+    AOT_GOTO(0x0cd4, L0cd4);
+L0cd4:
+    AOT_BLOCK(0x0cd4, 2);
+    // 0cd4: mov 2(r4), r2
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cd8: br 0cf4
+    AOT_GOTO(0x0cf4, L0cf4);
+L0cda:
+    AOT_BLOCK(0x0cda, 2);
+    // 0cda: cmpb $1, (r2)
+    {
+        src = uint8_t(0x01);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0cde: bne 0cf0
+    if (!Z)
+        AOT_GOTO(0x0cf0, L0cf0);
+    AOT_GOTO(0x0ce0, L0ce0);
+L0ce0:
+    AOT_BLOCK(0x0ce0, 2);
+    // 0ce0: cmp r3, 6(r2)
+    {
+        src = r[3];
+        b = uint16_t(r[2] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ce4: bne 0cf0
+    if (!Z)
+        AOT_GOTO(0x0cf0, L0cf0);
+    AOT_GOTO(0x0ce6, L0ce6);
+L0ce6:
+    AOT_BLOCK(0x0ce6, 3);
+    // 0ce6: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ce8: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cea: jsr pc, *$0d04
+    {
+        a = 0x0d04;
+        r[6] -= 2;
+        WR16(r[6], 0x0cee);
+    }
+    AOT_GOTO(0x0d04, L0d04);
+L0cee:
+    AOT_BLOCK(0x0cee, 1);
+    // 0cee: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0cf0, L0cf0);
+L0cf0:
+    AOT_BLOCK(0x0cf0, 1);
+    // 0cf0: mov 2(r2), r2
+    {
+        a = uint16_t(r[2] + 2);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cf4, L0cf4);
+L0cf4:
+    AOT_BLOCK(0x0cf4, 2);
+    // 0cf4: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0cf6: bne 0cda
+    if (!Z)
+        AOT_GOTO(0x0cda, L0cda);
+    AOT_GOTO(0x0cf8, L0cf8);
+L0cf8:
+    AOT_BLOCK(0x0cf8, 1);
+    // 0cf8: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cfc, L0cfc);
+L0cfc:
+    AOT_BLOCK(0x0cfc, 2);
+    // 0cfc: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0cfe: bne 0cc0
+    if (!Z)
+        AOT_GOTO(0x0cc0, L0cc0);
+    AOT_GOTO(0x0d00, L0d00);
+L0d00:
+    AOT_BLOCK(0x0d00, 2);
+    // 0d00: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0d04:
+    AOT_BLOCK(0x0d04, 5);
+    // 0d04: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0d08;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 0d08: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0d0c: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d10: br 0d4c
+    AOT_GOTO(0x0d4c, L0d4c);
+L0d12:
+    AOT_BLOCK(0x0d12, 2);
+    // 0d12: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d14: jsr pc, *$0ad0
+    {
+        a = 0x0ad0;
+        r[6] -= 2;
+        WR16(r[6], 0x0d18);
+    }
+    AOT_GOTO(0x0ad0, L0ad0);
+L0d18:
+    AOT_BLOCK(0x0d18, 8);
+    // 0d18: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0d1a: mov 4(r3), r0
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d1e: mov 2(r3), 2(r0)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0d24: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d28: mov 4(r3), 4(r0)
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0d2e: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0d32: mov 6(r3), (sp)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d36: jsr pc, *$1484
+    {
+        a = 0x1484;
+        r[6] -= 2;
+        WR16(r[6], 0x0d3a);
+    }
+    AOT_GOTO(0x1484, L1484);
+L0d3a:
+    AOT_BLOCK(0x0d3a, 4);
+    // 0d3a: mov 8(r2), 8(r3)
+    {
+        a = uint16_t(r[2] + 8);
+        src = RD16(a);
+        b = uint16_t(r[3] + 8);
+        WR16(b, src);
+    }
+    // 0d40: mov r2, 6(r3)
+    {
+        src = r[2];
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 0d44: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0d48: inc 07c8
+    {
+        a = 0x07c8;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0d4c, L0d4c);
+L0d4c:
+    AOT_BLOCK(0x0d4c, 2);
+    // 0d4c: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d50: beq 0d58
+    if (Z)
+        AOT_GOTO(0x0d58, L0d58);
+    AOT_GOTO(0x0d52, L0d52);
+L0d52:
+    AOT_BLOCK(0x0d52, 2);
+    // 0d52: cmpb $4, (r4)
+    {
+        src = uint8_t(0x04);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0d56: beq 0d4c
+    if (Z)
+        AOT_GOTO(0x0d4c, L0d4c);
+    AOT_GOTO(0x0d58, L0d58);
+L0d58:
+    AOT_BLOCK(0x0d58, 4);
+    // 0d58: mov 4(r3), r3
+    {
+        a = uint16_t(r[3] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0d5c: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d5e: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d60: jsr pc, *$142e
+    {
+        a = 0x142e;
+        r[6] -= 2;
+        WR16(r[6], 0x0d64);
+    }
+    AOT_GOTO(0x142e, L142e);
+L0d64:
+    AOT_BLOCK(0x0d64, 3);
+    // 0d64: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0d66: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d68: bne 0d12
+    if (!Z)
+        AOT_GOTO(0x0d12, L0d12);
+    AOT_GOTO(0x0d6a, L0d6a);
+L0d6a:
+    AOT_BLOCK(0x0d6a, 2);
+    // 0d6a: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0d6e:
+    AOT_BLOCK(0x0d6e, 4);
+    // 0d6e: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0d72;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 0d72: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0d74: mov 07a2, r4
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d78, L0d78);
+L0d78:
+    AOT_BLOCK(0x0d78, 2);
+    // 0d78: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d7a: bne 0d80
+    if (!Z)
+        AOT_GOTO(0x0d80, L0d80);
+    AOT_GOTO(0x0d7c, L0d7c);
+L0d7c:
+    AOT_BLOCK(0x0d7c, 1);
+    // 0d7c: jmp *$121a
+    {
+        a = 0x121a;
+    }
+    AOT_GOTO(0x121a, L121a);
+L0d80:
+    AOT_BLOCK(0x0d80, 5);
+    // 0d80: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+    }
+    // 0d84: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0d86: sub $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0d8a: cmp r0, $2c
+    {
+        src = r[0];
+        dst = uint16_t(0x002c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d8e: blos 0d94
+    if (C | Z)
+        AOT_GOTO(0x0d94, L0d94);
+    AOT_GOTO(0x0d90, L0d90);
+L0d90:
+    AOT_BLOCK(0x0d90, 1);
+    // 0d90: jmp *$1212
+    {
+        a = 0x1212;
+    }
+    AOT_GOTO(0x1212, L1212);
+L0d94:
+    AOT_BLOCK(0x0d94, 2);
+    // 0d94: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 0d96: jmp *3be(r0)
+    {
+        a = RD16(r[0] + 958);
+    }
+    AOT_JUMP(a);
+L0d9a:
+    AOT_BLOCK(0x0d9a, 1);
+    // 0d9a: mov $5, -8(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0da0, L0da0);
+L0da0:
+    AOT_BLOCK(0x0da0, 2);
+    // 0da0: cmpb $64, 1(r4)
+    {
+        src = uint8_t(0x64);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0da6: bne 0dac
+    if (!Z)
+        AOT_GOTO(0x0dac, L0dac);
+    AOT_GOTO(0x0da8, L0da8);
+L0da8:
+    AOT_BLOCK(0x0da8, 1);
+    // 0da8: jmp *$0ed2
+    {
+        a = 0x0ed2;
+    }
+    AOT_GOTO(0x0ed2, L0ed2);
+L0dac:
+    AOT_BLOCK(0x0dac, 2);
+    // 0dac: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dae: jsr pc, *$167a
+    {
+        a = 0x167a;
+        r[6] -= 2;
+        WR16(r[6], 0x0db2);
+    }
+    AOT_GOTO(0x167a, L167a);
+L0db2:
+    AOT_BLOCK(0x0db2, 3);
+    // 0db2: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0db6: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dba: jsr pc, *$16ae
+    {
+        a = 0x16ae;
+        r[6] -= 2;
+        WR16(r[6], 0x0dbe);
+    }
+    AOT_GOTO(0x16ae, L16ae);
+L0dbe:
+    AOT_BLOCK(0x0dbe, 3);
+    // 0dbe: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0dc0: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dc2: blt 0e08
+    if (N ^ V)
+        AOT_GOTO(0x0e08, L0e08);
+    AOT_GOTO(0x0dc4, L0dc4);
+L0dc4:
+    AOT_BLOCK(0x0dc4, 2);
+    // 0dc4: mov $8b6, (sp)
+    {
+        src = uint16_t(0x08b6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dc8: jsr pc, *$16ec
+    {
+        a = 0x16ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0dcc);
+    }
+    AOT_GOTO(0x16ec, L16ec);
+L0dcc:
+    AOT_BLOCK(0x0dcc, 3);
+    // 0dcc: add -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0dd0: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0dd2: bne 0e08
+    if (!Z)
+        AOT_GOTO(0x0e08, L0e08);
+    AOT_GOTO(0x0dd4, L0dd4);
+L0dd4:
+    AOT_BLOCK(0x0dd4, 2);
+    // 0dd4: cmpb (pc), *2(r4)
+    {
+        src = uint8_t(0x02);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0dd8: beq 0e08
+    if (Z)
+        AOT_GOTO(0x0e08, L0e08);
+    AOT_GOTO(0x0dda, L0dda);
+L0dda:
+    AOT_BLOCK(0x0dda, 2);
+    // 0dda: cmpb $13, *2(r4)
+    {
+        src = uint8_t(0x13);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0de0: beq 0e08
+    if (Z)
+        AOT_GOTO(0x0e08, L0e08);
+    AOT_GOTO(0x0de2, L0de2);
+L0de2:
+    AOT_BLOCK(0x0de2, 2);
+    // 0de2: cmpb $2d, *2(r4)
+    {
+        src = uint8_t(0x2d);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0de8: beq 0e08
+    if (Z)
+        AOT_GOTO(0x0e08, L0e08);
+    AOT_GOTO(0x0dea, L0dea);
+L0dea:
+    AOT_BLOCK(0x0dea, 5);
+    // 0dea: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0dee: mov 4(r4), 4(r0)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 0df4: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0df8: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0dfe: inc 07b4
+    {
+        a = 0x07b4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0e02, L0e02);
+L0e02:
+    AOT_BLOCK(0x0e02, 2);
+    // 0e02: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e06: br 0d78
+    AOT_GOTO(0x0d78, L0d78);
+L0e08:
+    AOT_BLOCK(0x0e08, 3);
+    // 0e08: mov $42c, (sp)
+    {
+        src = uint16_t(0x042c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e0c: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e10: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x0e14);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L0e14:
+    AOT_BLOCK(0x0e14, 3);
+    // 0e14: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0e16: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e18: beq 0e46
+    if (Z)
+        AOT_GOTO(0x0e46, L0e46);
+    AOT_GOTO(0x0e1a, L0e1a);
+L0e1a:
+    AOT_BLOCK(0x0e1a, 4);
+    // 0e1a: movb $b, (r4)
+    {
+        src = uint8_t(0x0b);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 0e1e: mov $8b6, (sp)
+    {
+        src = uint16_t(0x08b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e22: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e26: jsr pc, *$2622
+    {
+        a = 0x2622;
+        r[6] -= 2;
+        WR16(r[6], 0x0e2a);
+    }
+    AOT_GOTO(0x2622, L2622);
+L0e2a:
+    AOT_BLOCK(0x0e2a, 5);
+    // 0e2a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0e2c: clrb 08b6
+    {
+        a = 0x08b6;
+        WR8(a, 0);
+        C = false;
+    }
+    // 0e30: mov $8a2, (sp)
+    {
+        src = uint16_t(0x08a2);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e34: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e38: jsr pc, *$0646
+    {
+        a = 0x0646;
+        r[6] -= 2;
+        WR16(r[6], 0x0e3c);
+    }
+    AOT_GOTO(0x0646, L0646);
+L0e3c:
+    AOT_BLOCK(0x0e3c, 3);
+    // 0e3c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0e3e: mov r0, a(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e42: jmp *$0f9e
+    {
+        a = 0x0f9e;
+    }
+    AOT_GOTO(0x0f9e, L0f9e);
+L0e46:
+    AOT_BLOCK(0x0e46, 4);
+    // 0e46: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e4a: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0e4c: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e4e: jsr pc, *$17b2
+    {
+        a = 0x17b2;
+        r[6] -= 2;
+        WR16(r[6], 0x0e52);
+    }
+    AOT_GOTO(0x17b2, L17b2);
+L0e52:
+    AOT_BLOCK(0x0e52, 3);
+    // 0e52: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0e54: mov $8a2, (sp)
+    {
+        src = uint16_t(0x08a2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e58: jsr pc, *$16ec
+    {
+        a = 0x16ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0e5c);
+    }
+    AOT_GOTO(0x16ec, L16ec);
+L0e5c:
+    AOT_BLOCK(0x0e5c, 3);
+    // 0e5c: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0e5e: mov $8b6, (sp)
+    {
+        src = uint16_t(0x08b6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e62: jsr pc, *$16ec
+    {
+        a = 0x16ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0e66);
+    }
+    AOT_GOTO(0x16ec, L16ec);
+L0e66:
+    AOT_BLOCK(0x0e66, 4);
+    // 0e66: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 0e68: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e6c: mov $8b6, -(sp)
+    {
+        src = uint16_t(0x08b6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e70: jsr pc, *$1594
+    {
+        a = 0x1594;
+        r[6] -= 2;
+        WR16(r[6], 0x0e74);
+    }
+    AOT_GOTO(0x1594, L1594);
+L0e74:
+    AOT_BLOCK(0x0e74, 3);
+    // 0e74: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0e76: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e78: blt 0ea8
+    if (N ^ V)
+        AOT_GOTO(0x0ea8, L0ea8);
+    AOT_GOTO(0x0e7a, L0e7a);
+L0e7a:
+    AOT_BLOCK(0x0e7a, 2);
+    // 0e7a: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e7c: blt 0ea0
+    if (N ^ V)
+        AOT_GOTO(0x0ea0, L0ea0);
+    AOT_GOTO(0x0e7e, L0e7e);
+L0e7e:
+    AOT_BLOCK(0x0e7e, 6);
+    // 0e7e: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 0e80: add -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0e84: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0e88: add $7da, r1
+    {
+        src = uint16_t(0x07da);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0e8c: mov r1, (sp)
+    {
+        src = r[1];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e8e: br 0e94
+    AOT_GOTO(0x0e94, L0e94);
+L0e90:
+    AOT_BLOCK(0x0e90, 1);
+    // 0e90: mov $8a2, (sp)
+    {
+        src = uint16_t(0x08a2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e94, L0e94);
+L0e94:
+    AOT_BLOCK(0x0e94, 1);
+    // 0e94: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0e96, L0e96);
+L0e96:
+    AOT_BLOCK(0x0e96, 2);
+    // 0e96: add -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0e9a: jsr pc, *$1548
+    {
+        a = 0x1548;
+        r[6] -= 2;
+        WR16(r[6], 0x0e9e);
+    }
+    AOT_GOTO(0x1548, L1548);
+L0e9e:
+    AOT_BLOCK(0x0e9e, 1);
+    // 0e9e: br 0eb8
+    AOT_GOTO(0x0eb8, L0eb8);
+L0ea0:
+    AOT_BLOCK(0x0ea0, 3);
+    // 0ea0: mov $8b6, (sp)
+    {
+        src = uint16_t(0x08b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ea4: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ea6: br 0e96
+    AOT_GOTO(0x0e96, L0e96);
+L0ea8:
+    AOT_BLOCK(0x0ea8, 2);
+    // 0ea8: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0eaa: bge 0e90
+    if (!(N ^ V))
+        AOT_GOTO(0x0e90, L0e90);
+    AOT_GOTO(0x0eac, L0eac);
+L0eac:
+    AOT_BLOCK(0x0eac, 3);
+    // 0eac: mov $8b6, (sp)
+    {
+        src = uint16_t(0x08b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0eb0: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0eb4: jsr pc, *$1bb0
+    {
+        a = 0x1bb0;
+        r[6] -= 2;
+        WR16(r[6], 0x0eb8);
+    }
+    AOT_GOTO(0x1bb0, L1bb0);
+L0eb8:
+    AOT_BLOCK(0x0eb8, 3);
+    // 0eb8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0eba: mov $8a2, (sp)
+    {
+        src = uint16_t(0x08a2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ebe: jsr pc, *$1748
+    {
+        a = 0x1748;
+        r[6] -= 2;
+        WR16(r[6], 0x0ec2);
+    }
+    AOT_GOTO(0x1748, L1748);
+L0ec2:
+    AOT_BLOCK(0x0ec2, 2);
+    // 0ec2: mov $8b6, (sp)
+    {
+        src = uint16_t(0x08b6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ec6: jsr pc, *$1c1a
+    {
+        a = 0x1c1a;
+        r[6] -= 2;
+        WR16(r[6], 0x0eca);
+    }
+    AOT_GOTO(0x1c1a, L1c1a);
+L0eca:
+    AOT_BLOCK(0x0eca, 1);
+    // 0eca: br 0e02
+    AOT_GOTO(0x0e02, L0e02);
+L0ecc:
+    AOT_BLOCK(0x0ecc, 1);
+    // 0ecc: mov $5, -8(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ed2, L0ed2);
+L0ed2:
+    AOT_BLOCK(0x0ed2, 2);
+    // 0ed2: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ed4: jsr pc, *$167a
+    {
+        a = 0x167a;
+        r[6] -= 2;
+        WR16(r[6], 0x0ed8);
+    }
+    AOT_GOTO(0x167a, L167a);
+L0ed8:
+    AOT_BLOCK(0x0ed8, 2);
+    // 0ed8: cmpb $18, (r4)
+    {
+        src = uint8_t(0x18);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0edc: bne 0f02
+    if (!Z)
+        AOT_GOTO(0x0f02, L0f02);
+    AOT_GOTO(0x0ede, L0ede);
+L0ede:
+    AOT_BLOCK(0x0ede, 3);
+    // 0ede: mov $42f, (sp)
+    {
+        src = uint16_t(0x042f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ee2: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ee6: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x0eea);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L0eea:
+    AOT_BLOCK(0x0eea, 3);
+    // 0eea: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0eec: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0eee: bne 0e1a
+    if (!Z)
+        AOT_GOTO(0x0e1a, L0e1a);
+    AOT_GOTO(0x0ef0, L0ef0);
+L0ef0:
+    AOT_BLOCK(0x0ef0, 3);
+    // 0ef0: mov $433, (sp)
+    {
+        src = uint16_t(0x0433);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ef4: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ef8: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x0efc);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L0efc:
+    AOT_BLOCK(0x0efc, 3);
+    // 0efc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0efe: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f00: bne 0e1a
+    if (!Z)
+        AOT_GOTO(0x0e1a, L0e1a);
+    AOT_GOTO(0x0f02, L0f02);
+L0f02:
+    AOT_BLOCK(0x0f02, 2);
+    // 0f02: cmpb $18, (r4)
+    {
+        src = uint8_t(0x18);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0f06: beq 0f0e
+    if (Z)
+        AOT_GOTO(0x0f0e, L0f0e);
+    AOT_GOTO(0x0f08, L0f08);
+L0f08:
+    AOT_BLOCK(0x0f08, 2);
+    // 0f08: cmpb $19, (r4)
+    {
+        src = uint8_t(0x19);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0f0c: bne 0f3e
+    if (!Z)
+        AOT_GOTO(0x0f3e, L0f3e);
+    AOT_GOTO(0x0f0e, L0f0e);
+L0f0e:
+    AOT_BLOCK(0x0f0e, 3);
+    // 0f0e: mov $43b, (sp)
+    {
+        src = uint16_t(0x043b);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f12: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f16: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x0f1a);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L0f1a:
+    AOT_BLOCK(0x0f1a, 2);
+    // 0f1a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0f1c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0f1e, L0f1e);
+L0f1e:
+    AOT_BLOCK(0x0f1e, 1);
+    // 0f1e: beq 0f3e
+    if (Z)
+        AOT_GOTO(0x0f3e, L0f3e);
+    AOT_GOTO(0x0f20, L0f20);
+L0f20:
+    AOT_BLOCK(0x0f20, 2);
+    // 0f20: cmpb (pc), *2(r4)
+    {
+        src = uint8_t(0x02);
+        b = RD16(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0f24: beq 0f3e
+    if (Z)
+        AOT_GOTO(0x0f3e, L0f3e);
+    AOT_GOTO(0x0f26, L0f26);
+L0f26:
+    AOT_BLOCK(0x0f26, 5);
+    // 0f26: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f2a: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 0f30: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0f34: mov 4(r4), 4(r0)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f3a: jmp *$0e02
+    {
+        a = 0x0e02;
+    }
+    AOT_GOTO(0x0e02, L0e02);
+L0f3e:
+    AOT_BLOCK(0x0f3e, 4);
+    // 0f3e: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f42: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0f44: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f46: jsr pc, *$17b2
+    {
+        a = 0x17b2;
+        r[6] -= 2;
+        WR16(r[6], 0x0f4a);
+    }
+    AOT_GOTO(0x17b2, L17b2);
+L0f4a:
+    AOT_BLOCK(0x0f4a, 3);
+    // 0f4a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0f4c: mov $8a2, (sp)
+    {
+        src = uint16_t(0x08a2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f50: jsr pc, *$1748
+    {
+        a = 0x1748;
+        r[6] -= 2;
+        WR16(r[6], 0x0f54);
+    }
+    AOT_GOTO(0x1748, L1748);
+L0f54:
+    AOT_BLOCK(0x0f54, 3);
+    // 0f54: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f58: mov $8b6, -(sp)
+    {
+        src = uint16_t(0x08b6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f5c: jsr pc, *$1594
+    {
+        a = 0x1594;
+        r[6] -= 2;
+        WR16(r[6], 0x0f60);
+    }
+    AOT_GOTO(0x1594, L1594);
+L0f60:
+    AOT_BLOCK(0x0f60, 3);
+    // 0f60: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0f62: cmpb $1b, (r4)
+    {
+        src = uint8_t(0x1b);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0f66: bne 0f8a
+    if (!Z)
+        AOT_GOTO(0x0f8a, L0f8a);
+    AOT_GOTO(0x0f68, L0f68);
+L0f68:
+    AOT_BLOCK(0x0f68, 2);
+    // 0f68: mov $8b6, (sp)
+    {
+        src = uint16_t(0x08b6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f6c: jsr pc, *$16ec
+    {
+        a = 0x16ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0f70);
+    }
+    AOT_GOTO(0x16ec, L16ec);
+L0f70:
+    AOT_BLOCK(0x0f70, 2);
+    // 0f70: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f72: bge 0f78
+    if (!(N ^ V))
+        AOT_GOTO(0x0f78, L0f78);
+    AOT_GOTO(0x0f74, L0f74);
+L0f74:
+    AOT_BLOCK(0x0f74, 2);
+    // 0f74: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0f76: br 0f7c
+    AOT_GOTO(0x0f7c, L0f7c);
+L0f78:
+    AOT_BLOCK(0x0f78, 1);
+    // 0f78: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f7c, L0f7c);
+L0f7c:
+    AOT_BLOCK(0x0f7c, 2);
+    // 0f7c: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f7e: beq 0f8a
+    if (Z)
+        AOT_GOTO(0x0f8a, L0f8a);
+    AOT_GOTO(0x0f80, L0f80);
+L0f80:
+    AOT_BLOCK(0x0f80, 3);
+    // 0f80: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 0f82: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 0f86: clrb 7ee(r1)
+    {
+        a = uint16_t(r[1] + 2030);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0f8a, L0f8a);
+L0f8a:
+    AOT_BLOCK(0x0f8a, 2);
+    // 0f8a: clrb 08f2
+    {
+        a = 0x08f2;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0f8e: jmp *$0e02
+    {
+        a = 0x0e02;
+    }
+    AOT_GOTO(0x0e02, L0e02);
+L0f92:
+    AOT_BLOCK(0x0f92, 1);
+    // 0f92: mov $5, -8(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f98, L0f98);
+L0f98:
+    AOT_BLOCK(0x0f98, 2);
+    // 0f98: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f9a: jsr pc, *$165e
+    {
+        a = 0x165e;
+        r[6] -= 2;
+        WR16(r[6], 0x0f9e);
+    }
+    AOT_GOTO(0x165e, L165e);
+L0f9e:
+    AOT_BLOCK(0x0f9e, 3);
+    // 0f9e: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fa2: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fa6: jsr pc, *$1594
+    {
+        a = 0x1594;
+        r[6] -= 2;
+        WR16(r[6], 0x0faa);
+    }
+    AOT_GOTO(0x1594, L1594);
+L0faa:
+    AOT_BLOCK(0x0faa, 3);
+    // 0faa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0fac: cmpb $b, (r4)
+    {
+        src = uint8_t(0x0b);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0fb0: bne 0f8a
+    if (!Z)
+        AOT_GOTO(0x0f8a, L0f8a);
+    AOT_GOTO(0x0fb2, L0fb2);
+L0fb2:
+    AOT_BLOCK(0x0fb2, 2);
+    // 0fb2: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0fb6: bne 0f8a
+    if (!Z)
+        AOT_GOTO(0x0f8a, L0f8a);
+    AOT_GOTO(0x0fb8, L0fb8);
+L0fb8:
+    AOT_BLOCK(0x0fb8, 2);
+    // 0fb8: mov $8a2, (sp)
+    {
+        src = uint16_t(0x08a2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fbc: jsr pc, *$16ec
+    {
+        a = 0x16ec;
+        r[6] -= 2;
+        WR16(r[6], 0x0fc0);
+    }
+    AOT_GOTO(0x16ec, L16ec);
+L0fc0:
+    AOT_BLOCK(0x0fc0, 2);
+    // 0fc0: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fc2: blt 0fd0
+    if (N ^ V)
+        AOT_GOTO(0x0fd0, L0fd0);
+    AOT_GOTO(0x0fc4, L0fc4);
+L0fc4:
+    AOT_BLOCK(0x0fc4, 3);
+    // 0fc4: mov $43e, (sp)
+    {
+        src = uint16_t(0x043e);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fc8: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fca: jsr pc, *$1548
+    {
+        a = 0x1548;
+        r[6] -= 2;
+        WR16(r[6], 0x0fce);
+    }
+    AOT_GOTO(0x1548, L1548);
+L0fce:
+    AOT_BLOCK(0x0fce, 1);
+    // 0fce: br 0fdc
+    AOT_GOTO(0x0fdc, L0fdc);
+L0fd0:
+    AOT_BLOCK(0x0fd0, 3);
+    // 0fd0: mov $8a2, (sp)
+    {
+        src = uint16_t(0x08a2);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0fd4: mov $441, -(sp)
+    {
+        src = uint16_t(0x0441);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fd8: jsr pc, *$1bb0
+    {
+        a = 0x1bb0;
+        r[6] -= 2;
+        WR16(r[6], 0x0fdc);
+    }
+    AOT_GOTO(0x1bb0, L1bb0);
+L0fdc:
+    AOT_BLOCK(0x0fdc, 2);
+    // 0fdc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0fde: br 0f8a
+    AOT_GOTO(0x0f8a, L0f8a);
+L0fe0:
+    AOT_BLOCK(0x0fe0, 1);
+    // 0fe0: mov $5, -8(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fe6, L0fe6);
+L0fe6:
+    AOT_BLOCK(0x0fe6, 2);
+    // 0fe6: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fe8: jsr pc, *$165e
+    {
+        a = 0x165e;
+        r[6] -= 2;
+        WR16(r[6], 0x0fec);
+    }
+    AOT_GOTO(0x165e, L165e);
+L0fec:
+    AOT_BLOCK(0x0fec, 4);
+    // 0fec: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ff0: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0ff2: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ff4: jsr pc, *$17b2
+    {
+        a = 0x17b2;
+        r[6] -= 2;
+        WR16(r[6], 0x0ff8);
+    }
+    AOT_GOTO(0x17b2, L17b2);
+L0ff8:
+    AOT_BLOCK(0x0ff8, 3);
+    // 0ff8: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0ffa: mov $8a2, (sp)
+    {
+        src = uint16_t(0x08a2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ffe: jsr pc, *$1748
+    {
+        a = 0x1748;
+        r[6] -= 2;
+        WR16(r[6], 0x1002);
+    }
+    AOT_GOTO(0x1748, L1748);
+L1002:
+    AOT_BLOCK(0x1002, 3);
+    // 1002: mov $8f2, (sp)
+    {
+        src = uint16_t(0x08f2);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1006: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 100a: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x100e);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L100e:
+    AOT_BLOCK(0x100e, 3);
+    // 100e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1010: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1012: bne 1018
+    if (!Z)
+        AOT_GOTO(0x1018, L1018);
+    AOT_GOTO(0x1014, L1014);
+L1014:
+    AOT_BLOCK(0x1014, 1);
+    // 1014: jmp *$0e02
+    {
+        a = 0x0e02;
+    }
+    AOT_GOTO(0x0e02, L0e02);
+L1018:
+    AOT_BLOCK(0x1018, 8);
+    // 1018: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 101c: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 1022: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1026: mov 4(r4), 4(r0)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 102c: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1030: inc 07cc
+    {
+        a = 0x07cc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1034: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1038: jmp *$0e02
+    {
+        a = 0x0e02;
+    }
+    AOT_GOTO(0x0e02, L0e02);
+L103c:
+    AOT_BLOCK(0x103c, 1);
+    // 103c: mov $5, -8(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1042, L1042);
+L1042:
+    AOT_BLOCK(0x1042, 2);
+    // 1042: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1044: jsr pc, *$167a
+    {
+        a = 0x167a;
+        r[6] -= 2;
+        WR16(r[6], 0x1048);
+    }
+    AOT_GOTO(0x167a, L167a);
+L1048:
+    AOT_BLOCK(0x1048, 2);
+    // 1048: mov $8a2, (sp)
+    {
+        src = uint16_t(0x08a2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 104c: jsr pc, *$1748
+    {
+        a = 0x1748;
+        r[6] -= 2;
+        WR16(r[6], 0x1050);
+    }
+    AOT_GOTO(0x1748, L1748);
+L1050:
+    AOT_BLOCK(0x1050, 2);
+    // 1050: mov $8b6, (sp)
+    {
+        src = uint16_t(0x08b6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1054: jsr pc, *$1748
+    {
+        a = 0x1748;
+        r[6] -= 2;
+        WR16(r[6], 0x1058);
+    }
+    AOT_GOTO(0x1748, L1748);
+L1058:
+    AOT_BLOCK(0x1058, 2);
+    // 1058: cmpb $17, (r4)
+    {
+        src = uint8_t(0x17);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 105c: bne 1136
+    if (!Z)
+        AOT_GOTO(0x1136, L1136);
+    AOT_GOTO(0x105e, L105e);
+L105e:
+    AOT_BLOCK(0x105e, 3);
+    // 105e: mov $444, (sp)
+    {
+        src = uint16_t(0x0444);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1062: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1066: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x106a);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L106a:
+    AOT_BLOCK(0x106a, 3);
+    // 106a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 106c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 106e: bne 1082
+    if (!Z)
+        AOT_GOTO(0x1082, L1082);
+    AOT_GOTO(0x1070, L1070);
+L1070:
+    AOT_BLOCK(0x1070, 3);
+    // 1070: mov $448, (sp)
+    {
+        src = uint16_t(0x0448);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1074: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1078: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x107c);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L107c:
+    AOT_BLOCK(0x107c, 3);
+    // 107c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 107e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1080: beq 1096
+    if (Z)
+        AOT_GOTO(0x1096, L1096);
+    AOT_GOTO(0x1082, L1082);
+L1082:
+    AOT_BLOCK(0x1082, 4);
+    // 1082: movb $10, (r4)
+    {
+        src = uint8_t(0x10);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 1086: mov $8b6, (sp)
+    {
+        src = uint16_t(0x08b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 108a: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 108e: jsr pc, *$2622
+    {
+        a = 0x2622;
+        r[6] -= 2;
+        WR16(r[6], 0x1092);
+    }
+    AOT_GOTO(0x2622, L2622);
+L1092:
+    AOT_BLOCK(0x1092, 2);
+    // 1092: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1094: br 10be
+    AOT_GOTO(0x10be, L10be);
+L1096:
+    AOT_BLOCK(0x1096, 3);
+    // 1096: mov $450, (sp)
+    {
+        src = uint16_t(0x0450);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 109a: mov $8b6, -(sp)
+    {
+        src = uint16_t(0x08b6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 109e: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x10a2);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L10a2:
+    AOT_BLOCK(0x10a2, 3);
+    // 10a2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 10a4: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10a6: bne 10ba
+    if (!Z)
+        AOT_GOTO(0x10ba, L10ba);
+    AOT_GOTO(0x10a8, L10a8);
+L10a8:
+    AOT_BLOCK(0x10a8, 3);
+    // 10a8: mov $454, (sp)
+    {
+        src = uint16_t(0x0454);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10ac: mov $8b6, -(sp)
+    {
+        src = uint16_t(0x08b6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10b0: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x10b4);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L10b4:
+    AOT_BLOCK(0x10b4, 3);
+    // 10b4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 10b6: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10b8: beq 10dc
+    if (Z)
+        AOT_GOTO(0x10dc, L10dc);
+    AOT_GOTO(0x10ba, L10ba);
+L10ba:
+    AOT_BLOCK(0x10ba, 1);
+    // 10ba: movb $10, (r4)
+    {
+        src = uint8_t(0x10);
+        b = r[4];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x10be, L10be);
+L10be:
+    AOT_BLOCK(0x10be, 4);
+    // 10be: clrb 08b6
+    {
+        a = 0x08b6;
+        WR8(a, 0);
+        C = false;
+    }
+    // 10c2: mov $8a2, (sp)
+    {
+        src = uint16_t(0x08a2);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10c6: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10ca: jsr pc, *$0646
+    {
+        a = 0x0646;
+        r[6] -= 2;
+        WR16(r[6], 0x10ce);
+    }
+    AOT_GOTO(0x0646, L0646);
+L10ce:
+    AOT_BLOCK(0x10ce, 4);
+    // 10ce: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 10d0: mov r0, a(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+    }
+    // 10d4: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 10d8: inc 07b2
+    {
+        a = 0x07b2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x10dc, L10dc);
+L10dc:
+    AOT_BLOCK(0x10dc, 3);
+    // 10dc: mov $45c, (sp)
+    {
+        src = uint16_t(0x045c);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10e0: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10e4: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x10e8);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L10e8:
+    AOT_BLOCK(0x10e8, 3);
+    // 10e8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 10ea: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 10ec: beq 10f4
+    if (Z)
+        AOT_GOTO(0x10f4, L10f4);
+    AOT_GOTO(0x10ee, L10ee);
+L10ee:
+    AOT_BLOCK(0x10ee, 2);
+    // 10ee: movb $10, (r4)
+    {
+        src = uint8_t(0x10);
+        b = r[4];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 10f2: br 1118
+    AOT_GOTO(0x1118, L1118);
+L10f4:
+    AOT_BLOCK(0x10f4, 3);
+    // 10f4: mov $45f, (sp)
+    {
+        src = uint16_t(0x045f);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10f8: mov $8b6, -(sp)
+    {
+        src = uint16_t(0x08b6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10fc: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x1100);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L1100:
+    AOT_BLOCK(0x1100, 3);
+    // 1100: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1102: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1104: beq 1136
+    if (Z)
+        AOT_GOTO(0x1136, L1136);
+    AOT_GOTO(0x1106, L1106);
+L1106:
+    AOT_BLOCK(0x1106, 4);
+    // 1106: movb $10, (r4)
+    {
+        src = uint8_t(0x10);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 110a: mov $8b6, (sp)
+    {
+        src = uint16_t(0x08b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 110e: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1112: jsr pc, *$2622
+    {
+        a = 0x2622;
+        r[6] -= 2;
+        WR16(r[6], 0x1116);
+    }
+    AOT_GOTO(0x2622, L2622);
+L1116:
+    AOT_BLOCK(0x1116, 1);
+    // 1116: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1118, L1118);
+L1118:
+    AOT_BLOCK(0x1118, 4);
+    // 1118: clrb 08b6
+    {
+        a = 0x08b6;
+        WR8(a, 0);
+        C = false;
+    }
+    // 111c: mov $8a2, (sp)
+    {
+        src = uint16_t(0x08a2);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1120: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1124: jsr pc, *$0646
+    {
+        a = 0x0646;
+        r[6] -= 2;
+        WR16(r[6], 0x1128);
+    }
+    AOT_GOTO(0x0646, L0646);
+L1128:
+    AOT_BLOCK(0x1128, 4);
+    // 1128: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 112a: mov r0, a(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 10);
+        WR16(b, src);
+    }
+    // 112e: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1132: inc 07b2
+    {
+        a = 0x07b2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1136, L1136);
+L1136:
+    AOT_BLOCK(0x1136, 4);
+    // 1136: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 113a: mov $1, -(sp)
+    {
+        src = uint16_t(0x0001);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 113e: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1140: jsr pc, *$17b2
+    {
+        a = 0x17b2;
+        r[6] -= 2;
+        WR16(r[6], 0x1144);
+    }
+    AOT_GOTO(0x17b2, L17b2);
+L1144:
+    AOT_BLOCK(0x1144, 2);
+    // 1144: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1146: jmp *$0f8a
+    {
+        a = 0x0f8a;
+    }
+    AOT_GOTO(0x0f8a, L0f8a);
+L114a:
+    AOT_BLOCK(0x114a, 2);
+    // 114a: cmpb $10, *4(r4)
+    {
+        src = uint8_t(0x10);
+        b = RD16(r[4] + 4);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1150: beq 115e
+    if (Z)
+        AOT_GOTO(0x115e, L115e);
+    AOT_GOTO(0x1152, L1152);
+L1152:
+    AOT_BLOCK(0x1152, 2);
+    // 1152: cmpb $14, *4(r4)
+    {
+        src = uint8_t(0x14);
+        b = RD16(r[4] + 4);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1158: beq 115e
+    if (Z)
+        AOT_GOTO(0x115e, L115e);
+    AOT_GOTO(0x115a, L115a);
+L115a:
+    AOT_BLOCK(0x115a, 1);
+    // 115a: jmp *$0f8a
+    {
+        a = 0x0f8a;
+    }
+    AOT_GOTO(0x0f8a, L0f8a);
+L115e:
+    AOT_BLOCK(0x115e, 2);
+    // 115e: cmpb $10, *4(r4)
+    {
+        src = uint8_t(0x10);
+        b = RD16(r[4] + 4);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1164: bne 117e
+    if (!Z)
+        AOT_GOTO(0x117e, L117e);
+    AOT_GOTO(0x1166, L1166);
+L1166:
+    AOT_BLOCK(0x1166, 2);
+    // 1166: mov 4(r4), (sp)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 116a: jsr pc, *$165e
+    {
+        a = 0x165e;
+        r[6] -= 2;
+        WR16(r[6], 0x116e);
+    }
+    AOT_GOTO(0x165e, L165e);
+L116e:
+    AOT_BLOCK(0x116e, 3);
+    // 116e: mov $462, (sp)
+    {
+        src = uint16_t(0x0462);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1172: mov $b, -(sp)
+    {
+        src = uint16_t(0x000b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1176: jsr pc, *$1548
+    {
+        a = 0x1548;
+        r[6] -= 2;
+        WR16(r[6], 0x117a);
+    }
+    AOT_GOTO(0x1548, L1548);
+L117a:
+    AOT_BLOCK(0x117a, 2);
+    // 117a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 117c: br 1186
+    AOT_GOTO(0x1186, L1186);
+L117e:
+    AOT_BLOCK(0x117e, 2);
+    // 117e: mov 4(r4), (sp)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1182: jsr pc, *$167a
+    {
+        a = 0x167a;
+        r[6] -= 2;
+        WR16(r[6], 0x1186);
+    }
+    AOT_GOTO(0x167a, L167a);
+L1186:
+    AOT_BLOCK(0x1186, 2);
+    // 1186: mov $b, (sp)
+    {
+        src = uint16_t(0x000b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 118a: jsr pc, *$1a84
+    {
+        a = 0x1a84;
+        r[6] -= 2;
+        WR16(r[6], 0x118e);
+    }
+    AOT_GOTO(0x1a84, L1a84);
+L118e:
+    AOT_BLOCK(0x118e, 3);
+    // 118e: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1190: mov $a, -(sp)
+    {
+        src = uint16_t(0x000a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1194: jsr pc, 1a84
+    {
+        a = 0x1a84;
+        r[6] -= 2;
+        WR16(r[6], 0x1198);
+    }
+    AOT_GOTO(0x1a84, L1a84);
+L1198:
+    AOT_BLOCK(0x1198, 5);
+    // 1198: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 119a: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 119c: movb 1(r4), r0
+    {
+        a = uint16_t(r[4] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 11a0: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11a2: jsr pc, *$1ad2
+    {
+        a = 0x1ad2;
+        r[6] -= 2;
+        WR16(r[6], 0x11a6);
+    }
+    AOT_GOTO(0x1ad2, L1ad2);
+L11a6:
+    AOT_BLOCK(0x11a6, 3);
+    // 11a6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 11a8: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11aa: bne 11da
+    if (!Z)
+        AOT_GOTO(0x11da, L11da);
+    AOT_GOTO(0x11ac, L11ac);
+L11ac:
+    AOT_BLOCK(0x11ac, 8);
+    // 11ac: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11b0: mov 4(r0), r0
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11b4: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 11ba: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11be: mov 4(r4), r1
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 11c2: mov 4(r1), 4(r0)
+    {
+        a = uint16_t(r[1] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 11c8: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11cc: jsr pc, *$1484
+    {
+        a = 0x1484;
+        r[6] -= 2;
+        WR16(r[6], 0x11d0);
+    }
+    AOT_GOTO(0x1484, L1484);
+L11d0:
+    AOT_BLOCK(0x11d0, 3);
+    // 11d0: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11d4: mov 4(r0), r4
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11d8: br 1204
+    AOT_GOTO(0x1204, L1204);
+L11da:
+    AOT_BLOCK(0x11da, 2);
+    // 11da: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 11dc: bgt 11e2
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x11e2, L11e2);
+    AOT_GOTO(0x11de, L11de);
+L11de:
+    AOT_BLOCK(0x11de, 1);
+    // 11de: jmp *$0f8a
+    {
+        a = 0x0f8a;
+    }
+    AOT_GOTO(0x0f8a, L0f8a);
+L11e2:
+    AOT_BLOCK(0x11e2, 8);
+    // 11e2: movb $1, (r4)
+    {
+        src = uint8_t(0x01);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 11e6: clrb 1(r4)
+    {
+        a = uint16_t(r[4] + 1);
+        WR8(a, 0);
+        C = false;
+    }
+    // 11ea: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11ee: mov 4(r0), r0
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11f2: mov r4, 2(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 11f6: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 11fa: mov 4(r0), 4(r4)
+    {
+        a = uint16_t(r[0] + 4);
+        src = RD16(a);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 1200: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1204, L1204);
+L1204:
+    AOT_BLOCK(0x1204, 2);
+    // 1204: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1208: jmp *$0f8a
+    {
+        a = 0x0f8a;
+    }
+    AOT_GOTO(0x0f8a, L0f8a);
+L120c:
+    AOT_BLOCK(0x120c, 2);
+    // 120c: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 120e: jsr pc, *$19e8
+    {
+        a = 0x19e8;
+        r[6] -= 2;
+        WR16(r[6], 0x1212);
+    }
+    AOT_GOTO(0x19e8, L19e8);
+L1212:
+    AOT_BLOCK(0x1212, 1);
+    // 1212: jsr pc, 1524
+    {
+        a = 0x1524;
+        r[6] -= 2;
+        WR16(r[6], 0x1216);
+    }
+    AOT_GOTO(0x1524, L1524);
+L1216:
+    AOT_BLOCK(0x1216, 1);
+    // 1216: jmp *$0e02
+    {
+        a = 0x0e02;
+    }
+    AOT_GOTO(0x0e02, L0e02);
+L121a:
+    AOT_BLOCK(0x121a, 2);
+    // 121a: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L121e:
+    AOT_BLOCK(0x121e, 7);
+    // 121e: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1222;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1222: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1226: clr r2
+    {
+        r[2] = 0;
+    }
+    // 1228: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+        C = false;
+    }
+    // 122c: mov 07a2, r4
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1230: br 123c
+    AOT_GOTO(0x123c, L123c);
+L1232:
+    AOT_BLOCK(0x1232, 3);
+    // 1232: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 1234: mov r2, c(r4)
+    {
+        src = r[2];
+        b = uint16_t(r[4] + 12);
+        WR16(b, src);
+    }
+    // 1238: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x123c, L123c);
+L123c:
+    AOT_BLOCK(0x123c, 2);
+    // 123c: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 123e: bne 1232
+    if (!Z)
+        AOT_GOTO(0x1232, L1232);
+    AOT_GOTO(0x1240, L1240);
+L1240:
+    AOT_BLOCK(0x1240, 2);
+    // 1240: mov 07a2, r4
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1244: br 12c6
+    AOT_GOTO(0x12c6, L12c6);
+L1246:
+    AOT_BLOCK(0x1246, 3);
+    // 1246: mov 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 124a: cmpb $2, (r4)
+    {
+        src = uint8_t(0x02);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 124e: bne 12c4
+    if (!Z)
+        AOT_GOTO(0x12c4, L12c4);
+    AOT_GOTO(0x1250, L1250);
+L1250:
+    AOT_BLOCK(0x1250, 2);
+    // 1250: cmpb $1, (r3)
+    {
+        src = uint8_t(0x01);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1254: bne 12c4
+    if (!Z)
+        AOT_GOTO(0x12c4, L12c4);
+    AOT_GOTO(0x1256, L1256);
+L1256:
+    AOT_BLOCK(0x1256, 2);
+    // 1256: tst 6(r4)
+    {
+        a = uint16_t(r[4] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 125a: beq 12c4
+    if (Z)
+        AOT_GOTO(0x12c4, L12c4);
+    AOT_GOTO(0x125c, L125c);
+L125c:
+    AOT_BLOCK(0x125c, 2);
+    // 125c: tst 6(r3)
+    {
+        a = uint16_t(r[3] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1260: beq 12c4
+    if (Z)
+        AOT_GOTO(0x12c4, L12c4);
+    AOT_GOTO(0x1262, L1262);
+L1262:
+    AOT_BLOCK(0x1262, 4);
+    // 1262: mov c(r3), (sp)
+    {
+        a = uint16_t(r[3] + 12);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1266: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 126a: sub c(r0), (sp)
+    {
+        a = uint16_t(r[0] + 12);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 126e: jsr pc, *$1414
+    {
+        a = 0x1414;
+        r[6] -= 2;
+        WR16(r[6], 0x1272);
+    }
+    AOT_GOTO(0x1414, L1414);
+L1272:
+    AOT_BLOCK(0x1272, 5);
+    // 1272: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1274: mov c(r4), -(sp)
+    {
+        a = uint16_t(r[4] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1278: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 127c: sub c(r0), (sp)
+    {
+        a = uint16_t(r[0] + 12);
+        src = RD16(a);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 1280: jsr pc, 1414
+    {
+        a = 0x1414;
+        r[6] -= 2;
+        WR16(r[6], 0x1284);
+    }
+    AOT_GOTO(0x1414, L1414);
+L1284:
+    AOT_BLOCK(0x1284, 3);
+    // 1284: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1286: cmp (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1288: bge 12c4
+    if (!(N ^ V))
+        AOT_GOTO(0x12c4, L12c4);
+    AOT_GOTO(0x128a, L128a);
+L128a:
+    AOT_BLOCK(0x128a, 2);
+    // 128a: cmp 6(r3), 6(r4)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1290: beq 12c4
+    if (Z)
+        AOT_GOTO(0x12c4, L12c4);
+    AOT_GOTO(0x1292, L1292);
+L1292:
+    AOT_BLOCK(0x1292, 10);
+    // 1292: movb 1(r4), r0
+    {
+        a = uint16_t(r[4] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1296: movb d2(r0), 1(r4)
+    {
+        a = uint16_t(r[0] + 210);
+        src = RD8(a);
+        b = uint16_t(r[4] + 1);
+        WR8(b, src);
+    }
+    // 129c: mov 6(r3), -8(r5)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 12a2: mov 6(r4), 6(r3)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = uint16_t(r[3] + 6);
+        WR16(b, src);
+    }
+    // 12a8: mov -8(r5), 6(r4)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 12ae: mov 8(r3), r2
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 12b2: mov 8(r4), 8(r3)
+    {
+        a = uint16_t(r[4] + 8);
+        src = RD16(a);
+        b = uint16_t(r[3] + 8);
+        WR16(b, src);
+    }
+    // 12b8: mov r2, 8(r4)
+    {
+        src = r[2];
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 12bc: inc 07c0
+    {
+        a = 0x07c0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 12c0: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x12c4, L12c4);
+L12c4:
+    AOT_BLOCK(0x12c4, 1);
+    // 12c4: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x12c6, L12c6);
+L12c6:
+    AOT_BLOCK(0x12c6, 2);
+    // 12c6: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 12c8: bne 1246
+    if (!Z)
+        AOT_GOTO(0x1246, L1246);
+    AOT_GOTO(0x12ca, L12ca);
+L12ca:
+    AOT_BLOCK(0x12ca, 3);
+    // 12ca: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 12ce: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L12d2:
+    AOT_BLOCK(0x12d2, 4);
+    // 12d2: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x12d6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 12d6: mov $7a0, r4
+    {
+        src = uint16_t(0x07a0);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12da: br 1332
+    AOT_GOTO(0x1332, L1332);
+L12dc:
+    AOT_BLOCK(0x12dc, 2);
+    // 12dc: cmpb $e, (r4)
+    {
+        src = uint8_t(0x0e);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 12e0: bne 1330
+    if (!Z)
+        AOT_GOTO(0x1330, L1330);
+    AOT_GOTO(0x12e2, L12e2);
+L12e2:
+    AOT_BLOCK(0x12e2, 2);
+    // 12e2: mov a(r4), (sp)
+    {
+        a = uint16_t(r[4] + 10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12e6: jsr pc, *$16ec
+    {
+        a = 0x16ec;
+        r[6] -= 2;
+        WR16(r[6], 0x12ea);
+    }
+    AOT_GOTO(0x16ec, L16ec);
+L12ea:
+    AOT_BLOCK(0x12ea, 2);
+    // 12ea: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 12ec: blt 1330
+    if (N ^ V)
+        AOT_GOTO(0x1330, L1330);
+    AOT_GOTO(0x12ee, L12ee);
+L12ee:
+    AOT_BLOCK(0x12ee, 2);
+    // 12ee: cmpb $2, (r3)
+    {
+        src = uint8_t(0x02);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 12f2: bne 1330
+    if (!Z)
+        AOT_GOTO(0x1330, L1330);
+    AOT_GOTO(0x12f4, L12f4);
+L12f4:
+    AOT_BLOCK(0x12f4, 2);
+    // 12f4: cmpb (pc), 1(r3)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[3] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 12f8: bne 1330
+    if (!Z)
+        AOT_GOTO(0x1330, L1330);
+    AOT_GOTO(0x12fa, L12fa);
+L12fa:
+    AOT_BLOCK(0x12fa, 3);
+    // 12fa: mov 6(r3), r0
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 12fe: cmp c(r4), c(r0)
+    {
+        a = uint16_t(r[4] + 12);
+        src = RD16(a);
+        b = uint16_t(r[0] + 12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1304: blt 1330
+    if (N ^ V)
+        AOT_GOTO(0x1330, L1330);
+    AOT_GOTO(0x1306, L1306);
+L1306:
+    AOT_BLOCK(0x1306, 2);
+    // 1306: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1308: jsr pc, *$133c
+    {
+        a = 0x133c;
+        r[6] -= 2;
+        WR16(r[6], 0x130c);
+    }
+    AOT_GOTO(0x133c, L133c);
+L130c:
+    AOT_BLOCK(0x130c, 2);
+    // 130c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 130e: bne 1330
+    if (!Z)
+        AOT_GOTO(0x1330, L1330);
+    AOT_GOTO(0x1310, L1310);
+L1310:
+    AOT_BLOCK(0x1310, 7);
+    // 1310: mov 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 1316: movb $2e, (r4)
+    {
+        src = uint8_t(0x2e);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 131a: clrb 1(r4)
+    {
+        a = uint16_t(r[4] + 1);
+        WR8(a, 0);
+        C = false;
+    }
+    // 131e: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1322: mov r4, 4(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 1326: mov 2(r3), 2(r4)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 132c: inc 07ca
+    {
+        a = 0x07ca;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1330, L1330);
+L1330:
+    AOT_BLOCK(0x1330, 1);
+    // 1330: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1332, L1332);
+L1332:
+    AOT_BLOCK(0x1332, 2);
+    // 1332: mov 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1336: bne 12dc
+    if (!Z)
+        AOT_GOTO(0x12dc, L12dc);
+    AOT_GOTO(0x1338, L1338);
+L1338:
+    AOT_BLOCK(0x1338, 2);
+    // 1338: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L133c:
+    AOT_BLOCK(0x133c, 7);
+    // 133c: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1340;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1340: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 1342: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 1346: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 134a: mov 6(r0), r4
+    {
+        a = uint16_t(r[0] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 134e: br 1364
+    AOT_GOTO(0x1364, L1364);
+L1350:
+    AOT_BLOCK(0x1350, 2);
+    // 1350: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1354: beq 1368
+    if (Z)
+        AOT_GOTO(0x1368, L1368);
+    AOT_GOTO(0x1356, L1356);
+L1356:
+    AOT_BLOCK(0x1356, 2);
+    // 1356: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1358: jsr pc, *$137c
+    {
+        a = 0x137c;
+        r[6] -= 2;
+        WR16(r[6], 0x135c);
+    }
+    AOT_GOTO(0x137c, L137c);
+L135c:
+    AOT_BLOCK(0x135c, 2);
+    // 135c: add r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1360: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1364, L1364);
+L1364:
+    AOT_BLOCK(0x1364, 2);
+    // 1364: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1366: bne 1350
+    if (!Z)
+        AOT_GOTO(0x1350, L1350);
+    AOT_GOTO(0x1368, L1368);
+L1368:
+    AOT_BLOCK(0x1368, 2);
+    // 1368: cmp $80, -8(r5)
+    {
+        src = uint16_t(0x0080);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 136e: ble 1376
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1376, L1376);
+    AOT_GOTO(0x1370, L1370);
+L1370:
+    AOT_BLOCK(0x1370, 1);
+    // 1370: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1372, L1372);
+L1372:
+    AOT_BLOCK(0x1372, 2);
+    // 1372: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1376:
+    AOT_BLOCK(0x1376, 2);
+    // 1376: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 137a: br 1372
+    AOT_GOTO(0x1372, L1372);
+L137c:
+    AOT_BLOCK(0x137c, 6);
+    // 137c: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1380;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1380: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1384: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1386: cmp r0, $2
+    {
+        src = r[0];
+        dst = uint16_t(0x0002);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 138a: beq 13b0
+    if (Z)
+        AOT_GOTO(0x13b0, L13b0);
+    AOT_GOTO(0x138c, L138c);
+L138c:
+    AOT_BLOCK(0x138c, 2);
+    // 138c: cmp r0, $4
+    {
+        src = r[0];
+        dst = uint16_t(0x0004);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1390: beq 13aa
+    if (Z)
+        AOT_GOTO(0x13aa, L13aa);
+    AOT_GOTO(0x1392, L1392);
+L1392:
+    AOT_BLOCK(0x1392, 2);
+    // 1392: cmp r0, $5
+    {
+        src = r[0];
+        dst = uint16_t(0x0005);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1396: beq 13aa
+    if (Z)
+        AOT_GOTO(0x13aa, L13aa);
+    AOT_GOTO(0x1398, L1398);
+L1398:
+    AOT_BLOCK(0x1398, 2);
+    // 1398: cmp r0, $7
+    {
+        src = r[0];
+        dst = uint16_t(0x0007);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 139c: beq 13aa
+    if (Z)
+        AOT_GOTO(0x13aa, L13aa);
+    AOT_GOTO(0x139e, L139e);
+L139e:
+    AOT_BLOCK(0x139e, 2);
+    // 139e: cmp r0, $1e
+    {
+        src = r[0];
+        dst = uint16_t(0x001e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13a2: beq 13aa
+    if (Z)
+        AOT_GOTO(0x13aa, L13aa);
+    AOT_GOTO(0x13a4, L13a4);
+L13a4:
+    AOT_BLOCK(0x13a4, 2);
+    // 13a4: cmp r0, $21
+    {
+        src = r[0];
+        dst = uint16_t(0x0021);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13a8: bne 13b6
+    if (!Z)
+        AOT_GOTO(0x13b6, L13b6);
+    AOT_GOTO(0x13aa, L13aa);
+L13aa:
+    AOT_BLOCK(0x13aa, 1);
+    // 13aa: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x13ac, L13ac);
+L13ac:
+    AOT_BLOCK(0x13ac, 2);
+    // 13ac: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13b0:
+    AOT_BLOCK(0x13b0, 2);
+    // 13b0: mov $6, r0
+    {
+        src = uint16_t(0x0006);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13b4: br 13ac
+    AOT_GOTO(0x13ac, L13ac);
+L13b6:
+    AOT_BLOCK(0x13b6, 2);
+    // 13b6: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13b8: jsr pc, *$167a
+    {
+        a = 0x167a;
+        r[6] -= 2;
+        WR16(r[6], 0x13bc);
+    }
+    AOT_GOTO(0x167a, L167a);
+L13bc:
+    AOT_BLOCK(0x13bc, 2);
+    // 13bc: mov $8b6, (sp)
+    {
+        src = uint16_t(0x08b6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13c0: jsr pc, *$13d8
+    {
+        a = 0x13d8;
+        r[6] -= 2;
+        WR16(r[6], 0x13c4);
+    }
+    AOT_GOTO(0x13d8, L13d8);
+L13c4:
+    AOT_BLOCK(0x13c4, 3);
+    // 13c4: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13c6: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13ca: jsr pc, 13d8
+    {
+        a = 0x13d8;
+        r[6] -= 2;
+        WR16(r[6], 0x13ce);
+    }
+    AOT_GOTO(0x13d8, L13d8);
+L13ce:
+    AOT_BLOCK(0x13ce, 4);
+    // 13ce: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 13d0: add (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 13d2: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 13d6: br 13ac
+    AOT_GOTO(0x13ac, L13ac);
+L13d8:
+    AOT_BLOCK(0x13d8, 5);
+    // 13d8: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x13dc;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 13dc: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 13e0: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 13e2: beq 1410
+    if (Z)
+        AOT_GOTO(0x1410, L1410);
+    AOT_GOTO(0x13e4, L13e4);
+L13e4:
+    AOT_BLOCK(0x13e4, 2);
+    // 13e4: cmpb $72, (r4)
+    {
+        src = uint8_t(0x72);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 13e8: beq 1410
+    if (Z)
+        AOT_GOTO(0x1410, L1410);
+    AOT_GOTO(0x13ea, L13ea);
+L13ea:
+    AOT_BLOCK(0x13ea, 2);
+    // 13ea: cmpb $28, (r4)
+    {
+        src = uint8_t(0x28);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 13ee: beq 13fa
+    if (Z)
+        AOT_GOTO(0x13fa, L13fa);
+    AOT_GOTO(0x13f0, L13f0);
+L13f0:
+    AOT_BLOCK(0x13f0, 1);
+    // 13f0: br 1402
+    AOT_GOTO(0x1402, L1402);
+L13f2:
+    AOT_BLOCK(0x13f2, 1);
+    // 13f2: mov $2, r0
+    {
+        src = uint16_t(0x0002);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x13f6, L13f6);
+L13f6:
+    AOT_BLOCK(0x13f6, 2);
+    // 13f6: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L13fa:
+    AOT_BLOCK(0x13fa, 2);
+    // 13fa: cmpb $72, 1(r4)
+    {
+        src = uint8_t(0x72);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1400: beq 1410
+    if (Z)
+        AOT_GOTO(0x1410, L1410);
+    AOT_GOTO(0x1402, L1402);
+L1402:
+    AOT_BLOCK(0x1402, 2);
+    // 1402: cmpb $2d, (r4)
+    {
+        src = uint8_t(0x2d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1406: bne 13f2
+    if (!Z)
+        AOT_GOTO(0x13f2, L13f2);
+    AOT_GOTO(0x1408, L1408);
+L1408:
+    AOT_BLOCK(0x1408, 2);
+    // 1408: cmpb $28, 1(r4)
+    {
+        src = uint8_t(0x28);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 140e: bne 13f2
+    if (!Z)
+        AOT_GOTO(0x13f2, L13f2);
+    AOT_GOTO(0x1410, L1410);
+L1410:
+    AOT_BLOCK(0x1410, 2);
+    // 1410: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1412: br 13f6
+    AOT_GOTO(0x13f6, L13f6);
+L1414:
+    AOT_BLOCK(0x1414, 4);
+    // 1414: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1418;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1418: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 141c: bge 1428
+    if (!(N ^ V))
+        AOT_GOTO(0x1428, L1428);
+    AOT_GOTO(0x141e, L141e);
+L141e:
+    AOT_BLOCK(0x141e, 2);
+    // 141e: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1422: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1424, L1424);
+L1424:
+    AOT_BLOCK(0x1424, 2);
+    // 1424: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1428:
+    AOT_BLOCK(0x1428, 2);
+    // 1428: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 142c: br 1424
+    AOT_GOTO(0x1424, L1424);
+L142e:
+    AOT_BLOCK(0x142e, 5);
+    // 142e: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1432;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1432: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1436: cmpb (r2), *6(r5)
+    {
+        a = r[2];
+        src = RD8(a);
+        b = RD16(r[5] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 143a: bne 1448
+    if (!Z)
+        AOT_GOTO(0x1448, L1448);
+    AOT_GOTO(0x143c, L143c);
+L143c:
+    AOT_BLOCK(0x143c, 3);
+    // 143c: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1440: cmpb 1(r2), 1(r0)
+    {
+        a = uint16_t(r[2] + 1);
+        src = RD8(a);
+        b = uint16_t(r[0] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1446: beq 1454
+    if (Z)
+        AOT_GOTO(0x1454, L1454);
+    AOT_GOTO(0x1448, L1448);
+L1448:
+    AOT_BLOCK(0x1448, 2);
+    // 1448: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 144a: br 1480
+    AOT_GOTO(0x1480, L1480);
+L144c:
+    AOT_BLOCK(0x144c, 2);
+    // 144c: cmpb $a, (r2)
+    {
+        src = uint8_t(0x0a);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1450: ble 1458
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1458, L1458);
+    AOT_GOTO(0x1452, L1452);
+L1452:
+    AOT_BLOCK(0x1452, 1);
+    // 1452: br 1448
+    AOT_GOTO(0x1448, L1448);
+L1454:
+    AOT_BLOCK(0x1454, 2);
+    // 1454: tstb (r2)
+    {
+        a = r[2];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1456: bgt 144c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x144c, L144c);
+    AOT_GOTO(0x1458, L1458);
+L1458:
+    AOT_BLOCK(0x1458, 5);
+    // 1458: mov a(r2), r4
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 145c: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1460: mov a(r0), r3
+    {
+        a = uint16_t(r[0] + 10);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1464: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1466: bne 146c
+    if (!Z)
+        AOT_GOTO(0x146c, L146c);
+    AOT_GOTO(0x1468, L1468);
+L1468:
+    AOT_BLOCK(0x1468, 2);
+    // 1468: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 146a: beq 147c
+    if (Z)
+        AOT_GOTO(0x147c, L147c);
+    AOT_GOTO(0x146c, L146c);
+L146c:
+    AOT_BLOCK(0x146c, 2);
+    // 146c: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 146e: beq 1448
+    if (Z)
+        AOT_GOTO(0x1448, L1448);
+    AOT_GOTO(0x1470, L1470);
+L1470:
+    AOT_BLOCK(0x1470, 2);
+    // 1470: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1472: beq 1448
+    if (Z)
+        AOT_GOTO(0x1448, L1448);
+    AOT_GOTO(0x1474, L1474);
+L1474:
+    AOT_BLOCK(0x1474, 2);
+    // 1474: cmpb (r4), (r3)+
+    {
+        a = r[4];
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1476: bne 1448
+    if (!Z)
+        AOT_GOTO(0x1448, L1448);
+    AOT_GOTO(0x1478, L1478);
+L1478:
+    AOT_BLOCK(0x1478, 2);
+    // 1478: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 147a: bne 1474
+    if (!Z)
+        AOT_GOTO(0x1474, L1474);
+    AOT_GOTO(0x147c, L147c);
+L147c:
+    AOT_BLOCK(0x147c, 1);
+    // 147c: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1480, L1480);
+L1480:
+    AOT_BLOCK(0x1480, 2);
+    // 1480: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1484:
+    AOT_BLOCK(0x1484, 5);
+    // 1484: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1488;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1488: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 148c: dec c(r4)
+    {
+        a = uint16_t(r[4] + 12);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1490: bgt 14aa
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x14aa, L14aa);
+    AOT_GOTO(0x1492, L1492);
+L1492:
+    AOT_BLOCK(0x1492, 5);
+    // 1492: inc 07ba
+    {
+        a = 0x07ba;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1496: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 149a: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 14a0: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 14a4: mov 4(r4), 4(r0)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14aa, L14aa);
+L14aa:
+    AOT_BLOCK(0x14aa, 2);
+    // 14aa: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L14ae:
+    AOT_BLOCK(0x14ae, 3);
+    // 14ae: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x14b2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 14b2: br 14c4
+    AOT_GOTO(0x14c4, L14c4);
+L14b4:
+    AOT_BLOCK(0x14b4, 2);
+    // 14b4: cmpb (pc), *4(r5)
+    {
+        src = uint8_t(0x04);
+        b = RD16(r[5] + 4);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 14b8: bne 14ca
+    if (!Z)
+        AOT_GOTO(0x14ca, L14ca);
+    AOT_GOTO(0x14ba, L14ba);
+L14ba:
+    AOT_BLOCK(0x14ba, 2);
+    // 14ba: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 14be: mov 2(r0), 4(r5)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14c4, L14c4);
+L14c4:
+    AOT_BLOCK(0x14c4, 2);
+    // 14c4: tst 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 14c8: bne 14b4
+    if (!Z)
+        AOT_GOTO(0x14b4, L14b4);
+    AOT_GOTO(0x14ca, L14ca);
+L14ca:
+    AOT_BLOCK(0x14ca, 3);
+    // 14ca: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 14ce: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L14d2:
+    AOT_BLOCK(0x14d2, 9);
+    // 14d2: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x14d6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 14d6: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 14da: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 14dc: bic $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 14e0: mov 07d4, r0
+    {
+        a = 0x07d4;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 14e4: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 14e6: cmp 07d6, r0
+    {
+        a = 0x07d6;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14ea: bhi 1516
+    if (!(C | Z))
+        AOT_GOTO(0x1516, L1516);
+    AOT_GOTO(0x14ec, L14ec);
+L14ec:
+    AOT_BLOCK(0x14ec, 2);
+    // 14ec: mov $7d0, (sp)
+    {
+        src = uint16_t(0x07d0);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 14f0: jsr pc, *$2700
+    {
+        a = 0x2700;
+        r[6] -= 2;
+        WR16(r[6], 0x14f4);
+    }
+    AOT_GOTO(0x2700, L2700);
+L14f4:
+    AOT_BLOCK(0x14f4, 2);
+    // 14f4: cmp $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14f8: bne 1510
+    if (!Z)
+        AOT_GOTO(0x1510, L1510);
+    AOT_GOTO(0x14fa, L14fa);
+L14fa:
+    AOT_BLOCK(0x14fa, 3);
+    // 14fa: mov $465, (sp)
+    {
+        src = uint16_t(0x0465);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 14fe: mov $4e0, -(sp)
+    {
+        src = uint16_t(0x04e0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1502: jsr pc, *$1ca8
+    {
+        a = 0x1ca8;
+        r[6] -= 2;
+        WR16(r[6], 0x1506);
+    }
+    AOT_GOTO(0x1ca8, L1ca8);
+L1506:
+    AOT_BLOCK(0x1506, 3);
+    // 1506: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1508: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 150c: jsr pc, *$23aa
+    {
+        a = 0x23aa;
+        r[6] -= 2;
+        WR16(r[6], 0x1510);
+    }
+    AOT_GOTO(0x23aa, L23aa);
+L1510:
+    AOT_BLOCK(0x1510, 1);
+    // 1510: add $7d0, 07d6
+    {
+        src = uint16_t(0x07d0);
+        b = 0x07d6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1516, L1516);
+L1516:
+    AOT_BLOCK(0x1516, 5);
+    // 1516: mov 07d4, r3
+    {
+        a = 0x07d4;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 151a: add r4, 07d4
+    {
+        src = r[4];
+        b = 0x07d4;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 151e: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 1520: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1524:
+    AOT_BLOCK(0x1524, 3);
+    // 1524: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1528;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1528: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x152a, L152a);
+L152a:
+    AOT_BLOCK(0x152a, 6);
+    // 152a: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 152c: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1530: clrb 7da(r1)
+    {
+        a = uint16_t(r[1] + 2010);
+        WR8(a, 0);
+    }
+    // 1534: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+    }
+    // 1536: cmp $a, r4
+    {
+        src = uint16_t(0x000a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 153a: bgt 152a
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x152a, L152a);
+    AOT_GOTO(0x153c, L153c);
+L153c:
+    AOT_BLOCK(0x153c, 4);
+    // 153c: clrb 08ca
+    {
+        a = 0x08ca;
+        WR8(a, 0);
+    }
+    // 1540: clrb 08f2
+    {
+        a = 0x08f2;
+        WR8(a, 0);
+        C = false;
+    }
+    // 1544: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1548:
+    AOT_BLOCK(0x1548, 10);
+    // 1548: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x154c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 154c: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1550: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1554: mov r1, r4
+    {
+        src = r[1];
+        r[4] = src;
+    }
+    // 1556: add $7da, r4
+    {
+        src = uint16_t(0x07da);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 155a: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+    }
+    // 155c: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1560: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1562: jsr pc, *$1748
+    {
+        a = 0x1748;
+        r[6] -= 2;
+        WR16(r[6], 0x1566);
+    }
+    AOT_GOTO(0x1748, L1748);
+L1566:
+    AOT_BLOCK(0x1566, 2);
+    // 1566: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1568: bne 1590
+    if (!Z)
+        AOT_GOTO(0x1590, L1590);
+    AOT_GOTO(0x156a, L156a);
+L156a:
+    AOT_BLOCK(0x156a, 2);
+    // 156a: movb (r3), (r4)+
+    {
+        a = r[3];
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 156c: beq 158e
+    if (Z)
+        AOT_GOTO(0x158e, L158e);
+    AOT_GOTO(0x156e, L156e);
+L156e:
+    AOT_BLOCK(0x156e, 2);
+    // 156e: cmpb $28, (r3)
+    {
+        src = uint8_t(0x28);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1572: bne 1588
+    if (!Z)
+        AOT_GOTO(0x1588, L1588);
+    AOT_GOTO(0x1574, L1574);
+L1574:
+    AOT_BLOCK(0x1574, 2);
+    // 1574: cmpb $72, 1(r3)
+    {
+        src = uint8_t(0x72);
+        b = uint16_t(r[3] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 157a: bne 1588
+    if (!Z)
+        AOT_GOTO(0x1588, L1588);
+    AOT_GOTO(0x157c, L157c);
+L157c:
+    AOT_BLOCK(0x157c, 2);
+    // 157c: cmpb $35, 2(r3)
+    {
+        src = uint8_t(0x35);
+        b = uint16_t(r[3] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1582: ble 1588
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1588, L1588);
+    AOT_GOTO(0x1584, L1584);
+L1584:
+    AOT_BLOCK(0x1584, 2);
+    // 1584: clrb (r2)
+    {
+        a = r[2];
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1586: br 1590
+    AOT_GOTO(0x1590, L1590);
+L1588:
+    AOT_BLOCK(0x1588, 2);
+    // 1588: cmpb $2c, (r3)+
+    {
+        src = uint8_t(0x2c);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 158c: bne 156a
+    if (!Z)
+        AOT_GOTO(0x156a, L156a);
+    AOT_GOTO(0x158e, L158e);
+L158e:
+    AOT_BLOCK(0x158e, 1);
+    // 158e: clrb -(r4)
+    {
+        r[4] -= 1;
+        a = r[4];
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1590, L1590);
+L1590:
+    AOT_BLOCK(0x1590, 2);
+    // 1590: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1594:
+    AOT_BLOCK(0x1594, 5);
+    // 1594: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1598;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1598: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 159c: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 159e: jsr pc, *$1748
+    {
+        a = 0x1748;
+        r[6] -= 2;
+        WR16(r[6], 0x15a2);
+    }
+    AOT_GOTO(0x1748, L1748);
+L15a2:
+    AOT_BLOCK(0x15a2, 2);
+    // 15a2: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15a4: jsr pc, *$16ec
+    {
+        a = 0x16ec;
+        r[6] -= 2;
+        WR16(r[6], 0x15a8);
+    }
+    AOT_GOTO(0x16ec, L16ec);
+L15a8:
+    AOT_BLOCK(0x15a8, 2);
+    // 15a8: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15aa: blt 15ba
+    if (N ^ V)
+        AOT_GOTO(0x15ba, L15ba);
+    AOT_GOTO(0x15ac, L15ac);
+L15ac:
+    AOT_BLOCK(0x15ac, 4);
+    // 15ac: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 15ae: add 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 15b2: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 15b6: clrb 7da(r1)
+    {
+        a = uint16_t(r[1] + 2010);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x15ba, L15ba);
+L15ba:
+    AOT_BLOCK(0x15ba, 1);
+    // 15ba: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x15bc, L15bc);
+L15bc:
+    AOT_BLOCK(0x15bc, 5);
+    // 15bc: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 15be: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 15c2: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 15c4: cmpb $2a, 7da(r0)
+    {
+        src = uint8_t(0x2a);
+        b = uint16_t(r[0] + 2010);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 15ca: bne 15ee
+    if (!Z)
+        AOT_GOTO(0x15ee, L15ee);
+    AOT_GOTO(0x15cc, L15cc);
+L15cc:
+    AOT_BLOCK(0x15cc, 6);
+    // 15cc: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 15ce: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 15d2: add $7db, r1
+    {
+        src = uint16_t(0x07db);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 15d6: mov r1, (sp)
+    {
+        src = r[1];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 15d8: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15da: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x15de);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L15de:
+    AOT_BLOCK(0x15de, 3);
+    // 15de: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 15e0: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 15e2: beq 15ee
+    if (Z)
+        AOT_GOTO(0x15ee, L15ee);
+    AOT_GOTO(0x15e4, L15e4);
+L15e4:
+    AOT_BLOCK(0x15e4, 3);
+    // 15e4: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 15e6: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 15ea: clrb 7da(r1)
+    {
+        a = uint16_t(r[1] + 2010);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x15ee, L15ee);
+L15ee:
+    AOT_BLOCK(0x15ee, 3);
+    // 15ee: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+    }
+    // 15f0: cmp $a, r3
+    {
+        src = uint16_t(0x000a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 15f4: ble 1602
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1602, L1602);
+    AOT_GOTO(0x15f6, L15f6);
+L15f6:
+    AOT_BLOCK(0x15f6, 1);
+    // 15f6: br 15bc
+    AOT_GOTO(0x15bc, L15bc);
+L15f8:
+    AOT_BLOCK(0x15f8, 3);
+    // 15f8: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 15fa: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 15fe: clrb 7da(r1)
+    {
+        a = uint16_t(r[1] + 2010);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1602, L1602);
+L1602:
+    AOT_BLOCK(0x1602, 3);
+    // 1602: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1606: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1608: jsr pc, *$16ae
+    {
+        a = 0x16ae;
+        r[6] -= 2;
+        WR16(r[6], 0x160c);
+    }
+    AOT_GOTO(0x16ae, L16ae);
+L160c:
+    AOT_BLOCK(0x160c, 3);
+    // 160c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 160e: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1610: bge 15f8
+    if (!(N ^ V))
+        AOT_GOTO(0x15f8, L15f8);
+    AOT_GOTO(0x1612, L1612);
+L1612:
+    AOT_BLOCK(0x1612, 2);
+    // 1612: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1614: beq 165a
+    if (Z)
+        AOT_GOTO(0x165a, L165a);
+    AOT_GOTO(0x1616, L1616);
+L1616:
+    AOT_BLOCK(0x1616, 2);
+    // 1616: cmpb $28, (r4)
+    {
+        src = uint8_t(0x28);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 161a: bne 162c
+    if (!Z)
+        AOT_GOTO(0x162c, L162c);
+    AOT_GOTO(0x161c, L161c);
+L161c:
+    AOT_BLOCK(0x161c, 2);
+    // 161c: cmpb $72, 1(r4)
+    {
+        src = uint8_t(0x72);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1622: bne 1632
+    if (!Z)
+        AOT_GOTO(0x1632, L1632);
+    AOT_GOTO(0x1624, L1624);
+L1624:
+    AOT_BLOCK(0x1624, 2);
+    // 1624: cmpb $35, 2(r4)
+    {
+        src = uint8_t(0x35);
+        b = uint16_t(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 162a: bne 1632
+    if (!Z)
+        AOT_GOTO(0x1632, L1632);
+    AOT_GOTO(0x162c, L162c);
+L162c:
+    AOT_BLOCK(0x162c, 2);
+    // 162c: cmpb $2a, (r4)+
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1630: bne 1612
+    if (!Z)
+        AOT_GOTO(0x1612, L1612);
+    AOT_GOTO(0x1632, L1632);
+L1632:
+    AOT_BLOCK(0x1632, 1);
+    // 1632: clr r3
+    {
+        r[3] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1634, L1634);
+L1634:
+    AOT_BLOCK(0x1634, 5);
+    // 1634: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 1636: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 163a: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+    }
+    // 163c: cmpb $24, 7da(r0)
+    {
+        src = uint8_t(0x24);
+        b = uint16_t(r[0] + 2010);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1642: beq 164e
+    if (Z)
+        AOT_GOTO(0x164e, L164e);
+    AOT_GOTO(0x1644, L1644);
+L1644:
+    AOT_BLOCK(0x1644, 3);
+    // 1644: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 1646: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 164a: clrb 7da(r1)
+    {
+        a = uint16_t(r[1] + 2010);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x164e, L164e);
+L164e:
+    AOT_BLOCK(0x164e, 4);
+    // 164e: clrb 08ca
+    {
+        a = 0x08ca;
+        WR8(a, 0);
+    }
+    // 1652: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+    }
+    // 1654: cmp $a, r3
+    {
+        src = uint16_t(0x000a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1658: bgt 1634
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1634, L1634);
+    AOT_GOTO(0x165a, L165a);
+L165a:
+    AOT_BLOCK(0x165a, 2);
+    // 165a: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L165e:
+    AOT_BLOCK(0x165e, 5);
+    // 165e: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1662;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1662: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1666: mov a(r0), r4
+    {
+        a = uint16_t(r[0] + 10);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 166a: mov $8a2, r3
+    {
+        src = uint16_t(0x08a2);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x166e, L166e);
+L166e:
+    AOT_BLOCK(0x166e, 2);
+    // 166e: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1670: bne 166e
+    if (!Z)
+        AOT_GOTO(0x166e, L166e);
+    AOT_GOTO(0x1672, L1672);
+L1672:
+    AOT_BLOCK(0x1672, 3);
+    // 1672: clrb 08b6
+    {
+        a = 0x08b6;
+        WR8(a, 0);
+        C = false;
+    }
+    // 1676: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L167a:
+    AOT_BLOCK(0x167a, 6);
+    // 167a: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x167e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 167e: mov 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1682: mov a(r2), r4
+    {
+        a = uint16_t(r[2] + 10);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1686: mov $8a2, r3
+    {
+        src = uint16_t(0x08a2);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 168a: br 1694
+    AOT_GOTO(0x1694, L1694);
+L168c:
+    AOT_BLOCK(0x168c, 2);
+    // 168c: cmpb $2c, (r4)
+    {
+        src = uint8_t(0x2c);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1690: beq 1698
+    if (Z)
+        AOT_GOTO(0x1698, L1698);
+    AOT_GOTO(0x1692, L1692);
+L1692:
+    AOT_BLOCK(0x1692, 1);
+    // 1692: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1694, L1694);
+L1694:
+    AOT_BLOCK(0x1694, 2);
+    // 1694: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1696: bne 168c
+    if (!Z)
+        AOT_GOTO(0x168c, L168c);
+    AOT_GOTO(0x1698, L1698);
+L1698:
+    AOT_BLOCK(0x1698, 5);
+    // 1698: clrb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        WR8(a, 0);
+    }
+    // 169a: mov $8b6, r3
+    {
+        src = uint16_t(0x08b6);
+        r[3] = src;
+    }
+    // 169e: clrb (r3)
+    {
+        a = r[3];
+        WR8(a, 0);
+    }
+    // 16a0: cmpb $2c, (r4)+
+    {
+        src = uint8_t(0x2c);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 16a4: bne 16aa
+    if (!Z)
+        AOT_GOTO(0x16aa, L16aa);
+    AOT_GOTO(0x16a6, L16a6);
+L16a6:
+    AOT_BLOCK(0x16a6, 2);
+    // 16a6: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 16a8: bne 16a6
+    if (!Z)
+        AOT_GOTO(0x16a6, L16a6);
+    AOT_GOTO(0x16aa, L16aa);
+L16aa:
+    AOT_BLOCK(0x16aa, 2);
+    // 16aa: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L16ae:
+    AOT_BLOCK(0x16ae, 4);
+    // 16ae: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x16b2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 16b2: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16b6: br 16da
+    AOT_GOTO(0x16da, L16da);
+L16b8:
+    AOT_BLOCK(0x16b8, 6);
+    // 16b8: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 16bc: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 16be: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 16c2: add $7da, r1
+    {
+        src = uint16_t(0x07da);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 16c6: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16c8: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x16cc);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L16cc:
+    AOT_BLOCK(0x16cc, 3);
+    // 16cc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 16ce: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 16d0: beq 16d8
+    if (Z)
+        AOT_GOTO(0x16d8, L16d8);
+    AOT_GOTO(0x16d2, L16d2);
+L16d2:
+    AOT_BLOCK(0x16d2, 1);
+    // 16d2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x16d4, L16d4);
+L16d4:
+    AOT_BLOCK(0x16d4, 2);
+    // 16d4: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L16d8:
+    AOT_BLOCK(0x16d8, 1);
+    // 16d8: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x16da, L16da);
+L16da:
+    AOT_BLOCK(0x16da, 4);
+    // 16da: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 16de: add $5, r0
+    {
+        src = uint16_t(0x0005);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 16e2: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 16e4: blt 16b8
+    if (N ^ V)
+        AOT_GOTO(0x16b8, L16b8);
+    AOT_GOTO(0x16e6, L16e6);
+L16e6:
+    AOT_BLOCK(0x16e6, 2);
+    // 16e6: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16ea: br 16d4
+    AOT_GOTO(0x16d4, L16d4);
+L16ec:
+    AOT_BLOCK(0x16ec, 5);
+    // 16ec: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x16f0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 16f0: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 16f4: cmpb $72, (r4)
+    {
+        src = uint8_t(0x72);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 16f8: bne 171c
+    if (!Z)
+        AOT_GOTO(0x171c, L171c);
+    AOT_GOTO(0x16fa, L16fa);
+L16fa:
+    AOT_BLOCK(0x16fa, 2);
+    // 16fa: cmpb $30, 1(r4)
+    {
+        src = uint8_t(0x30);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1700: bgt 171c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x171c, L171c);
+    AOT_GOTO(0x1702, L1702);
+L1702:
+    AOT_BLOCK(0x1702, 2);
+    // 1702: cmpb $34, 1(r4)
+    {
+        src = uint8_t(0x34);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1708: blt 171c
+    if (N ^ V)
+        AOT_GOTO(0x171c, L171c);
+    AOT_GOTO(0x170a, L170a);
+L170a:
+    AOT_BLOCK(0x170a, 2);
+    // 170a: tstb 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 170e: bne 171c
+    if (!Z)
+        AOT_GOTO(0x171c, L171c);
+    AOT_GOTO(0x1710, L1710);
+L1710:
+    AOT_BLOCK(0x1710, 2);
+    // 1710: movb 1(r4), r0
+    {
+        a = uint16_t(r[4] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1714: add $ffd0, r0
+    {
+        src = uint16_t(0xffd0);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1718, L1718);
+L1718:
+    AOT_BLOCK(0x1718, 2);
+    // 1718: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L171c:
+    AOT_BLOCK(0x171c, 2);
+    // 171c: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1720: br 1718
+    AOT_GOTO(0x1718, L1718);
+L1748:
+    AOT_BLOCK(0x1748, 6);
+    // 1748: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x174c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 174c: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1750: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 1752: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1754: bne 175c
+    if (!Z)
+        AOT_GOTO(0x175c, L175c);
+    AOT_GOTO(0x1756, L1756);
+L1756:
+    AOT_BLOCK(0x1756, 1);
+    // 1756: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1758, L1758);
+L1758:
+    AOT_BLOCK(0x1758, 2);
+    // 1758: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L175c:
+    AOT_BLOCK(0x175c, 2);
+    // 175c: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 175e: bne 175c
+    if (!Z)
+        AOT_GOTO(0x175c, L175c);
+    AOT_GOTO(0x1760, L1760);
+L1760:
+    AOT_BLOCK(0x1760, 2);
+    // 1760: cmpb $2d, (r4)
+    {
+        src = uint8_t(0x2d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1764: bne 176e
+    if (!Z)
+        AOT_GOTO(0x176e, L176e);
+    AOT_GOTO(0x1766, L1766);
+L1766:
+    AOT_BLOCK(0x1766, 2);
+    // 1766: cmpb $28, 1(r4)
+    {
+        src = uint8_t(0x28);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 176c: beq 178c
+    if (Z)
+        AOT_GOTO(0x178c, L178c);
+    AOT_GOTO(0x176e, L176e);
+L176e:
+    AOT_BLOCK(0x176e, 2);
+    // 176e: cmpb $2a, (r4)
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1772: bne 1784
+    if (!Z)
+        AOT_GOTO(0x1784, L1784);
+    AOT_GOTO(0x1774, L1774);
+L1774:
+    AOT_BLOCK(0x1774, 2);
+    // 1774: cmpb $2d, 1(r4)
+    {
+        src = uint8_t(0x2d);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 177a: bne 1784
+    if (!Z)
+        AOT_GOTO(0x1784, L1784);
+    AOT_GOTO(0x177c, L177c);
+L177c:
+    AOT_BLOCK(0x177c, 2);
+    // 177c: cmpb $28, 2(r4)
+    {
+        src = uint8_t(0x28);
+        b = uint16_t(r[4] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1782: beq 178c
+    if (Z)
+        AOT_GOTO(0x178c, L178c);
+    AOT_GOTO(0x1784, L1784);
+L1784:
+    AOT_BLOCK(0x1784, 2);
+    // 1784: cmpb $2b, -2(r3)
+    {
+        src = uint8_t(0x2b);
+        b = uint16_t(r[3] + -2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 178a: bne 1756
+    if (!Z)
+        AOT_GOTO(0x1756, L1756);
+    AOT_GOTO(0x178c, L178c);
+L178c:
+    AOT_BLOCK(0x178c, 2);
+    // 178c: tstb (r4)
+    {
+        a = r[4];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 178e: beq 1796
+    if (Z)
+        AOT_GOTO(0x1796, L1796);
+    AOT_GOTO(0x1790, L1790);
+L1790:
+    AOT_BLOCK(0x1790, 2);
+    // 1790: cmpb $72, (r4)+
+    {
+        src = uint8_t(0x72);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1794: bne 178c
+    if (!Z)
+        AOT_GOTO(0x178c, L178c);
+    AOT_GOTO(0x1796, L1796);
+L1796:
+    AOT_BLOCK(0x1796, 2);
+    // 1796: cmpb $30, (r4)
+    {
+        src = uint8_t(0x30);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 179a: bgt 17ac
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x17ac, L17ac);
+    AOT_GOTO(0x179c, L179c);
+L179c:
+    AOT_BLOCK(0x179c, 2);
+    // 179c: cmpb $34, (r4)
+    {
+        src = uint8_t(0x34);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 17a0: blt 17ac
+    if (N ^ V)
+        AOT_GOTO(0x17ac, L17ac);
+    AOT_GOTO(0x17a2, L17a2);
+L17a2:
+    AOT_BLOCK(0x17a2, 3);
+    // 17a2: movb (r4), r1
+    {
+        a = r[4];
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 17a4: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 17a8: clrb 41a(r1)
+    {
+        a = uint16_t(r[1] + 1050);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x17ac, L17ac);
+L17ac:
+    AOT_BLOCK(0x17ac, 2);
+    // 17ac: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17b0: br 1758
+    AOT_GOTO(0x1758, L1758);
+L17b2:
+    AOT_BLOCK(0x17b2, 5);
+    // 17b2: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x17b6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 17b6: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 17b8: tst 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 17bc: bne 17c2
+    if (!Z)
+        AOT_GOTO(0x17c2, L17c2);
+    AOT_GOTO(0x17be, L17be);
+L17be:
+    AOT_BLOCK(0x17be, 1);
+    // 17be: jmp *$17d8
+    {
+        a = 0x17d8;
+    }
+    AOT_GOTO(0x17d8, L17d8);
+L17c2:
+    AOT_BLOCK(0x17c2, 3);
+    // 17c2: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17c6: mov $8b6, -(sp)
+    {
+        src = uint16_t(0x08b6);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17ca: jsr pc, *$16ae
+    {
+        a = 0x16ae;
+        r[6] -= 2;
+        WR16(r[6], 0x17ce);
+    }
+    AOT_GOTO(0x16ae, L16ae);
+L17ce:
+    AOT_BLOCK(0x17ce, 3);
+    // 17ce: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 17d0: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17d4: jmp *$17de
+    {
+        a = 0x17de;
+    }
+    AOT_GOTO(0x17de, L17de);
+L17d8:
+    AOT_BLOCK(0x17d8, 1);
+    // 17d8: mov $ffff, -8(r5)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x17de, L17de);
+L17de:
+    AOT_BLOCK(0x17de, 3);
+    // 17de: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17e2: mov $8a2, -(sp)
+    {
+        src = uint16_t(0x08a2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17e6: jsr pc, *$16ae
+    {
+        a = 0x16ae;
+        r[6] -= 2;
+        WR16(r[6], 0x17ea);
+    }
+    AOT_GOTO(0x16ae, L16ae);
+L17ea:
+    AOT_BLOCK(0x17ea, 4);
+    // 17ea: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 17ec: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 17ee: cmp $5, -8(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 17f4: bgt 17fc
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x17fc, L17fc);
+    AOT_GOTO(0x17f6, L17f6);
+L17f6:
+    AOT_BLOCK(0x17f6, 1);
+    // 17f6: sub $5, -8(r5)
+    {
+        src = uint16_t(0x0005);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[5] + -8);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x17fc, L17fc);
+L17fc:
+    AOT_BLOCK(0x17fc, 2);
+    // 17fc: cmp $5, r4
+    {
+        src = uint16_t(0x0005);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1800: bgt 1806
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1806, L1806);
+    AOT_GOTO(0x1802, L1802);
+L1802:
+    AOT_BLOCK(0x1802, 1);
+    // 1802: sub $5, r4
+    {
+        src = uint16_t(0x0005);
+        dst = r[4];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1806, L1806);
+L1806:
+    AOT_BLOCK(0x1806, 2);
+    // 1806: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1808: bge 1810
+    if (!(N ^ V))
+        AOT_GOTO(0x1810, L1810);
+    AOT_GOTO(0x180a, L180a);
+L180a:
+    AOT_BLOCK(0x180a, 2);
+    // 180a: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 180e: blt 188e
+    if (N ^ V)
+        AOT_GOTO(0x188e, L188e);
+    AOT_GOTO(0x1810, L1810);
+L1810:
+    AOT_BLOCK(0x1810, 2);
+    // 1810: mov $8a2, r2
+    {
+        src = uint16_t(0x08a2);
+        r[2] = src;
+    }
+    // 1814: mov $e9a, r3
+    {
+        src = uint16_t(0x0e9a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1818, L1818);
+L1818:
+    AOT_BLOCK(0x1818, 2);
+    // 1818: movb (r2)+, (r3)+
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 181a: bne 1818
+    if (!Z)
+        AOT_GOTO(0x1818, L1818);
+    AOT_GOTO(0x181c, L181c);
+L181c:
+    AOT_BLOCK(0x181c, 2);
+    // 181c: tstb 08b6
+    {
+        a = 0x08b6;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1820: beq 1834
+    if (Z)
+        AOT_GOTO(0x1834, L1834);
+    AOT_GOTO(0x1822, L1822);
+L1822:
+    AOT_BLOCK(0x1822, 3);
+    // 1822: mov $ecc, r3
+    {
+        src = uint16_t(0x0ecc);
+        r[3] = src;
+    }
+    // 1826: movb $2c, (r3)+
+    {
+        src = uint8_t(0x2c);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 182a: mov $8b6, r2
+    {
+        src = uint16_t(0x08b6);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x182e, L182e);
+L182e:
+    AOT_BLOCK(0x182e, 2);
+    // 182e: movb (r2)+, (r3)+
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1830: bne 182e
+    if (!Z)
+        AOT_GOTO(0x182e, L182e);
+    AOT_GOTO(0x1832, L1832);
+L1832:
+    AOT_BLOCK(0x1832, 1);
+    // 1832: br 1838
+    AOT_GOTO(0x1838, L1838);
+L1834:
+    AOT_BLOCK(0x1834, 1);
+    // 1834: clrb 0ecc
+    {
+        a = 0x0ecc;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1838, L1838);
+L1838:
+    AOT_BLOCK(0x1838, 2);
+    // 1838: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 183a: blt 1854
+    if (N ^ V)
+        AOT_GOTO(0x1854, L1854);
+    AOT_GOTO(0x183c, L183c);
+L183c:
+    AOT_BLOCK(0x183c, 6);
+    // 183c: movb $72, 0e9a
+    {
+        src = uint8_t(0x72);
+        b = 0x0e9a;
+        WR8(b, src);
+    }
+    // 1842: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1844: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1848: movb r0, 0e9b
+    {
+        src = uint8_t(r[0]);
+        b = 0x0e9b;
+        WR8(b, src);
+    }
+    // 184c: clrb 0e9c
+    {
+        a = 0x0e9c;
+        WR8(a, 0);
+        C = false;
+    }
+    // 1850: inc 07b2
+    {
+        a = 0x07b2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1854, L1854);
+L1854:
+    AOT_BLOCK(0x1854, 2);
+    // 1854: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1858: blt 1874
+    if (N ^ V)
+        AOT_GOTO(0x1874, L1874);
+    AOT_GOTO(0x185a, L185a);
+L185a:
+    AOT_BLOCK(0x185a, 6);
+    // 185a: movb $72, 0ecd
+    {
+        src = uint8_t(0x72);
+        b = 0x0ecd;
+        WR8(b, src);
+    }
+    // 1860: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1864: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1868: movb r0, 0ece
+    {
+        src = uint8_t(r[0]);
+        b = 0x0ece;
+        WR8(b, src);
+    }
+    // 186c: clrb 0ecf
+    {
+        a = 0x0ecf;
+        WR8(a, 0);
+        C = false;
+    }
+    // 1870: inc 07b2
+    {
+        a = 0x07b2;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1874, L1874);
+L1874:
+    AOT_BLOCK(0x1874, 4);
+    // 1874: mov $ecc, (sp)
+    {
+        src = uint16_t(0x0ecc);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1878: mov $e9a, -(sp)
+    {
+        src = uint16_t(0x0e9a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 187c: mov $2, -(sp)
+    {
+        src = uint16_t(0x0002);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1880: jsr pc, *$0646
+    {
+        a = 0x0646;
+        r[6] -= 2;
+        WR16(r[6], 0x1884);
+    }
+    AOT_GOTO(0x0646, L0646);
+L1884:
+    AOT_BLOCK(0x1884, 3);
+    // 1884: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1886: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 188a: mov r0, a(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + 10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x188e, L188e);
+L188e:
+    AOT_BLOCK(0x188e, 2);
+    // 188e: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1892:
+    AOT_BLOCK(0x1892, 5);
+    // 1892: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1896;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1896: sub $12, sp
+    {
+        src = uint16_t(0x0012);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 189a: tst 07a2
+    {
+        a = 0x07a2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 189e: bne 18a4
+    if (!Z)
+        AOT_GOTO(0x18a4, L18a4);
+    AOT_GOTO(0x18a0, L18a0);
+L18a0:
+    AOT_BLOCK(0x18a0, 1);
+    // 18a0: jmp *$19e4
+    {
+        a = 0x19e4;
+    }
+    AOT_GOTO(0x19e4, L19e4);
+L18a4:
+    AOT_BLOCK(0x18a4, 2);
+    // 18a4: cmp $1e, 00de
+    {
+        src = uint16_t(0x001e);
+        b = 0x00de;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18aa: beq 18e2
+    if (Z)
+        AOT_GOTO(0x18e2, L18e2);
+    AOT_GOTO(0x18ac, L18ac);
+L18ac:
+    AOT_BLOCK(0x18ac, 2);
+    // 18ac: cmp $ffff, 00de
+    {
+        src = uint16_t(0xffff);
+        b = 0x00de;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 18b2: beq 18e2
+    if (Z)
+        AOT_GOTO(0x18e2, L18e2);
+    AOT_GOTO(0x18b4, L18b4);
+L18b4:
+    AOT_BLOCK(0x18b4, 2);
+    // 18b4: mov $e, (sp)
+    {
+        src = uint16_t(0x000e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18b8: jsr pc, *$14d2
+    {
+        a = 0x14d2;
+        r[6] -= 2;
+        WR16(r[6], 0x18bc);
+    }
+    AOT_GOTO(0x14d2, L14d2);
+L18bc:
+    AOT_BLOCK(0x18bc, 9);
+    // 18bc: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 18be: movb 00de, (r4)
+    {
+        a = 0x00de;
+        src = RD8(a);
+        b = r[4];
+        WR8(b, src);
+    }
+    // 18c2: clrb 1(r4)
+    {
+        a = uint16_t(r[4] + 1);
+        WR8(a, 0);
+    }
+    // 18c6: clr a(r4)
+    {
+        a = uint16_t(r[4] + 10);
+        WR16(a, 0);
+        C = false;
+    }
+    // 18ca: mov 07a2, 2(r4)
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 18d0: mov $7a0, 4(r4)
+    {
+        src = uint16_t(0x07a0);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 18d6: mov 07a2, r0
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 18da: mov r4, 4(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 18de: mov r4, 07a2
+    {
+        src = r[4];
+        b = 0x07a2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x18e2, L18e2);
+L18e2:
+    AOT_BLOCK(0x18e2, 5);
+    // 18e2: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 18e4: add $ffea, r0
+    {
+        src = uint16_t(0xffea);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 18e8: mov r0, -18(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -24);
+        WR16(b, src);
+    }
+    // 18ec: mov 07a2, r4
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18f0: br 1948
+    AOT_GOTO(0x1948, L1948);
+L18f2:
+    AOT_BLOCK(0x18f2, 2);
+    // 18f2: cmpb $1f, (r4)
+    {
+        src = uint8_t(0x1f);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 18f6: bne 1944
+    if (!Z)
+        AOT_GOTO(0x1944, L1944);
+    AOT_GOTO(0x18f8, L18f8);
+L18f8:
+    AOT_BLOCK(0x18f8, 2);
+    // 18f8: mov 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18fc: br 1908
+    AOT_GOTO(0x1908, L1908);
+L18fe:
+    AOT_BLOCK(0x18fe, 2);
+    // 18fe: cmpb $1e, (r3)
+    {
+        src = uint8_t(0x1e);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1902: beq 190c
+    if (Z)
+        AOT_GOTO(0x190c, L190c);
+    AOT_GOTO(0x1904, L1904);
+L1904:
+    AOT_BLOCK(0x1904, 1);
+    // 1904: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1908, L1908);
+L1908:
+    AOT_BLOCK(0x1908, 2);
+    // 1908: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 190a: bne 18fe
+    if (!Z)
+        AOT_GOTO(0x18fe, L18fe);
+    AOT_GOTO(0x190c, L190c);
+L190c:
+    AOT_BLOCK(0x190c, 2);
+    // 190c: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 190e: beq 194c
+    if (Z)
+        AOT_GOTO(0x194c, L194c);
+    AOT_GOTO(0x1910, L1910);
+L1910:
+    AOT_BLOCK(0x1910, 11);
+    // 1910: mov 4(r4), -8(r5)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1916: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 191a: mov 2(r3), 2(r0)
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 1920: mov 2(r3), r0
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1924: mov -8(r5), 4(r0)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 192a: clr 2(r3)
+    {
+        a = uint16_t(r[3] + 2);
+        WR16(a, 0);
+        C = false;
+    }
+    // 192e: mov -18(r5), r0
+    {
+        a = uint16_t(r[5] + -24);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1932: mov r4, 2(r0)
+    {
+        src = r[4];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 1936: mov -18(r5), 4(r4)
+    {
+        a = uint16_t(r[5] + -24);
+        src = RD16(a);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 193c: mov -8(r5), r4
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1940: mov r3, -18(r5)
+    {
+        src = r[3];
+        b = uint16_t(r[5] + -24);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1944, L1944);
+L1944:
+    AOT_BLOCK(0x1944, 1);
+    // 1944: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1948, L1948);
+L1948:
+    AOT_BLOCK(0x1948, 2);
+    // 1948: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 194a: bne 18f2
+    if (!Z)
+        AOT_GOTO(0x18f2, L18f2);
+    AOT_GOTO(0x194c, L194c);
+L194c:
+    AOT_BLOCK(0x194c, 2);
+    // 194c: tst -14(r5)
+    {
+        a = uint16_t(r[5] + -20);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1950: beq 1976
+    if (Z)
+        AOT_GOTO(0x1976, L1976);
+    AOT_GOTO(0x1952, L1952);
+L1952:
+    AOT_BLOCK(0x1952, 7);
+    // 1952: mov -18(r5), r0
+    {
+        a = uint16_t(r[5] + -24);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1956: mov 07a2, 2(r0)
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 195c: mov 07a2, r0
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1960: mov -18(r5), 4(r0)
+    {
+        a = uint16_t(r[5] + -24);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 1966: mov -14(r5), r0
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 196a: mov $7a0, 4(r0)
+    {
+        src = uint16_t(0x07a0);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 1970: mov -14(r5), 07a2
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        b = 0x07a2;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1976, L1976);
+L1976:
+    AOT_BLOCK(0x1976, 3);
+    // 1976: mov 00de, r2
+    {
+        a = 0x00de;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 197a: mov 07a2, r4
+    {
+        a = 0x07a2;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 197e: br 19e0
+    AOT_GOTO(0x19e0, L19e0);
+L1980:
+    AOT_BLOCK(0x1980, 2);
+    // 1980: cmpb $1e, (r4)
+    {
+        src = uint8_t(0x1e);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1984: beq 1992
+    if (Z)
+        AOT_GOTO(0x1992, L1992);
+    AOT_GOTO(0x1986, L1986);
+L1986:
+    AOT_BLOCK(0x1986, 2);
+    // 1986: cmpb $1f, (r4)
+    {
+        src = uint8_t(0x1f);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 198a: beq 1992
+    if (Z)
+        AOT_GOTO(0x1992, L1992);
+    AOT_GOTO(0x198c, L198c);
+L198c:
+    AOT_BLOCK(0x198c, 2);
+    // 198c: cmpb $20, (r4)
+    {
+        src = uint8_t(0x20);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1990: bne 19dc
+    if (!Z)
+        AOT_GOTO(0x19dc, L19dc);
+    AOT_GOTO(0x1992, L1992);
+L1992:
+    AOT_BLOCK(0x1992, 2);
+    // 1992: mov 2(r4), r3
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1996: beq 19ac
+    if (Z)
+        AOT_GOTO(0x19ac, L19ac);
+    AOT_GOTO(0x1998, L1998);
+L1998:
+    AOT_BLOCK(0x1998, 2);
+    // 1998: cmpb $1e, (r3)
+    {
+        src = uint8_t(0x1e);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 199c: beq 19aa
+    if (Z)
+        AOT_GOTO(0x19aa, L19aa);
+    AOT_GOTO(0x199e, L199e);
+L199e:
+    AOT_BLOCK(0x199e, 2);
+    // 199e: cmpb $1f, (r3)
+    {
+        src = uint8_t(0x1f);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 19a2: beq 19aa
+    if (Z)
+        AOT_GOTO(0x19aa, L19aa);
+    AOT_GOTO(0x19a4, L19a4);
+L19a4:
+    AOT_BLOCK(0x19a4, 2);
+    // 19a4: cmpb $20, (r3)
+    {
+        src = uint8_t(0x20);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 19a8: bne 19ac
+    if (!Z)
+        AOT_GOTO(0x19ac, L19ac);
+    AOT_GOTO(0x19aa, L19aa);
+L19aa:
+    AOT_BLOCK(0x19aa, 1);
+    // 19aa: movb (r3), (r4)
+    {
+        a = r[3];
+        src = RD8(a);
+        b = r[4];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x19ac, L19ac);
+L19ac:
+    AOT_BLOCK(0x19ac, 3);
+    // 19ac: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 19ae: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 19b0: beq 19c0
+    if (Z)
+        AOT_GOTO(0x19c0, L19c0);
+    AOT_GOTO(0x19b2, L19b2);
+L19b2:
+    AOT_BLOCK(0x19b2, 2);
+    // 19b2: tst 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 19b6: beq 19da
+    if (Z)
+        AOT_GOTO(0x19da, L19da);
+    AOT_GOTO(0x19b8, L19b8);
+L19b8:
+    AOT_BLOCK(0x19b8, 3);
+    // 19b8: movb *2(r4), r0
+    {
+        a = RD16(r[4] + 2);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 19bc: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 19be: bne 19da
+    if (!Z)
+        AOT_GOTO(0x19da, L19da);
+    AOT_GOTO(0x19c0, L19c0);
+L19c0:
+    AOT_BLOCK(0x19c0, 6);
+    // 19c0: mov 4(r4), r0
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 19c4: mov 2(r4), 2(r0)
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+    }
+    // 19ca: mov 2(r4), r0
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 19ce: mov 4(r4), 4(r0)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = uint16_t(r[0] + 4);
+        WR16(b, src);
+    }
+    // 19d4: mov 4(r4), r4
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19d8: br 19dc
+    AOT_GOTO(0x19dc, L19dc);
+L19da:
+    AOT_BLOCK(0x19da, 1);
+    // 19da: movb (r4), r2
+    {
+        a = r[4];
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x19dc, L19dc);
+L19dc:
+    AOT_BLOCK(0x19dc, 1);
+    // 19dc: mov 2(r4), r4
+    {
+        a = uint16_t(r[4] + 2);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x19e0, L19e0);
+L19e0:
+    AOT_BLOCK(0x19e0, 2);
+    // 19e0: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 19e2: bne 1980
+    if (!Z)
+        AOT_GOTO(0x1980, L1980);
+    AOT_GOTO(0x19e4, L19e4);
+L19e4:
+    AOT_BLOCK(0x19e4, 2);
+    // 19e4: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L19e8:
+    AOT_BLOCK(0x19e8, 6);
+    // 19e8: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x19ec;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 19ec: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 19f0: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 19f2: mov 6(r4), r3
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19f6: beq 1a72
+    if (Z)
+        AOT_GOTO(0x1a72, L1a72);
+    AOT_GOTO(0x19f8, L19f8);
+L19f8:
+    AOT_BLOCK(0x19f8, 2);
+    // 19f8: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19fa: jsr pc, *$14ae
+    {
+        a = 0x14ae;
+        r[6] -= 2;
+        WR16(r[6], 0x19fe);
+    }
+    AOT_GOTO(0x14ae, L14ae);
+L19fe:
+    AOT_BLOCK(0x19fe, 3);
+    // 19fe: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 1a00: cmpb $10, (r3)
+    {
+        src = uint8_t(0x10);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a04: bne 1a76
+    if (!Z)
+        AOT_GOTO(0x1a76, L1a76);
+    AOT_GOTO(0x1a06, L1a06);
+L1a06:
+    AOT_BLOCK(0x1a06, 2);
+    // 1a06: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a08: jsr pc, *$165e
+    {
+        a = 0x165e;
+        r[6] -= 2;
+        WR16(r[6], 0x1a0c);
+    }
+    AOT_GOTO(0x165e, L165e);
+L1a0c:
+    AOT_BLOCK(0x1a0c, 3);
+    // 1a0c: mov $480, (sp)
+    {
+        src = uint16_t(0x0480);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a10: mov $b, -(sp)
+    {
+        src = uint16_t(0x000b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a14: jsr pc, *$1548
+    {
+        a = 0x1548;
+        r[6] -= 2;
+        WR16(r[6], 0x1a18);
+    }
+    AOT_GOTO(0x1548, L1548);
+L1a18:
+    AOT_BLOCK(0x1a18, 1);
+    // 1a18: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1a1a, L1a1a);
+L1a1a:
+    AOT_BLOCK(0x1a1a, 2);
+    // 1a1a: cmpb (pc), *2(r3)
+    {
+        src = uint8_t(0x02);
+        b = RD16(r[3] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a1e: bne 1a72
+    if (!Z)
+        AOT_GOTO(0x1a72, L1a72);
+    AOT_GOTO(0x1a20, L1a20);
+L1a20:
+    AOT_BLOCK(0x1a20, 2);
+    // 1a20: mov $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a24: jsr pc, *$1a84
+    {
+        a = 0x1a84;
+        r[6] -= 2;
+        WR16(r[6], 0x1a28);
+    }
+    AOT_GOTO(0x1a84, L1a84);
+L1a28:
+    AOT_BLOCK(0x1a28, 3);
+    // 1a28: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 1a2a: mov $b, (sp)
+    {
+        src = uint16_t(0x000b);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a2e: jsr pc, *$1a84
+    {
+        a = 0x1a84;
+        r[6] -= 2;
+        WR16(r[6], 0x1a32);
+    }
+    AOT_GOTO(0x1a84, L1a84);
+L1a32:
+    AOT_BLOCK(0x1a32, 7);
+    // 1a32: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1a36: mov 2(r3), r3
+    {
+        a = uint16_t(r[3] + 2);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1a3a: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a3c: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a3e: movb 1(r3), r0
+    {
+        a = uint16_t(r[3] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1a42: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a44: jsr pc, *$1ad2
+    {
+        a = 0x1ad2;
+        r[6] -= 2;
+        WR16(r[6], 0x1a48);
+    }
+    AOT_GOTO(0x1ad2, L1ad2);
+L1a48:
+    AOT_BLOCK(0x1a48, 3);
+    // 1a48: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 1a4a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1a4c: ble 1a72
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1a72, L1a72);
+    AOT_GOTO(0x1a4e, L1a4e);
+L1a4e:
+    AOT_BLOCK(0x1a4e, 4);
+    // 1a4e: inc 07c4
+    {
+        a = 0x07c4;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1a52: inc 07d0
+    {
+        a = 0x07d0;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1a56: mov 6(r4), (sp)
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a5a: jsr pc, *$1484
+    {
+        a = 0x1484;
+        r[6] -= 2;
+        WR16(r[6], 0x1a5e);
+    }
+    AOT_GOTO(0x1484, L1484);
+L1a5e:
+    AOT_BLOCK(0x1a5e, 4);
+    // 1a5e: mov 6(r3), 6(r4)
+    {
+        a = uint16_t(r[3] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 6);
+        WR16(b, src);
+    }
+    // 1a64: mov 8(r3), 8(r4)
+    {
+        a = uint16_t(r[3] + 8);
+        src = RD16(a);
+        b = uint16_t(r[4] + 8);
+        WR16(b, src);
+    }
+    // 1a6a: mov 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1a6e: inc c(r0)
+    {
+        a = uint16_t(r[0] + 12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1a72, L1a72);
+L1a72:
+    AOT_BLOCK(0x1a72, 2);
+    // 1a72: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1a76:
+    AOT_BLOCK(0x1a76, 2);
+    // 1a76: cmpb $14, (r3)
+    {
+        src = uint8_t(0x14);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a7a: bne 1a72
+    if (!Z)
+        AOT_GOTO(0x1a72, L1a72);
+    AOT_GOTO(0x1a7c, L1a7c);
+L1a7c:
+    AOT_BLOCK(0x1a7c, 2);
+    // 1a7c: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a7e: jsr pc, *$167a
+    {
+        a = 0x167a;
+        r[6] -= 2;
+        WR16(r[6], 0x1a82);
+    }
+    AOT_GOTO(0x167a, L167a);
+L1a82:
+    AOT_BLOCK(0x1a82, 1);
+    // 1a82: br 1a1a
+    AOT_GOTO(0x1a1a, L1a1a);
+L1a84:
+    AOT_BLOCK(0x1a84, 8);
+    // 1a84: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1a88;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1a88: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1a8c: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1a90: mov r1, r4
+    {
+        src = r[1];
+        r[4] = src;
+    }
+    // 1a92: add $7da, r4
+    {
+        src = uint16_t(0x07da);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+    }
+    // 1a96: cmpb $24, (r4)
+    {
+        src = uint8_t(0x24);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a9a: bne 1ab6
+    if (!Z)
+        AOT_GOTO(0x1ab6, L1ab6);
+    AOT_GOTO(0x1a9c, L1a9c);
+L1a9c:
+    AOT_BLOCK(0x1a9c, 2);
+    // 1a9c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a9e: br 1ab2
+    AOT_GOTO(0x1ab2, L1ab2);
+L1aa0:
+    AOT_BLOCK(0x1aa0, 5);
+    // 1aa0: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 1aa2: mul $14, r1
+    {
+        src = int16_t(uint16_t(0x0014));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1aa6: add $7da, r1
+    {
+        src = uint16_t(0x07da);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1aaa: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1aac: br 1ab2
+    AOT_GOTO(0x1ab2, L1ab2);
+L1aae:
+    AOT_BLOCK(0x1aae, 1);
+    // 1aae: mov $8de, r0
+    {
+        src = uint16_t(0x08de);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ab2, L1ab2);
+L1ab2:
+    AOT_BLOCK(0x1ab2, 2);
+    // 1ab2: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1ab6:
+    AOT_BLOCK(0x1ab6, 2);
+    // 1ab6: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ab8: jsr pc, *$16ec
+    {
+        a = 0x16ec;
+        r[6] -= 2;
+        WR16(r[6], 0x1abc);
+    }
+    AOT_GOTO(0x16ec, L16ec);
+L1abc:
+    AOT_BLOCK(0x1abc, 2);
+    // 1abc: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1abe: bge 1aa0
+    if (!(N ^ V))
+        AOT_GOTO(0x1aa0, L1aa0);
+    AOT_GOTO(0x1ac0, L1ac0);
+L1ac0:
+    AOT_BLOCK(0x1ac0, 3);
+    // 1ac0: mov $8ca, (sp)
+    {
+        src = uint16_t(0x08ca);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ac4: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ac6: jsr pc, *$1be0
+    {
+        a = 0x1be0;
+        r[6] -= 2;
+        WR16(r[6], 0x1aca);
+    }
+    AOT_GOTO(0x1be0, L1be0);
+L1aca:
+    AOT_BLOCK(0x1aca, 3);
+    // 1aca: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1acc: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1ace: bne 1aae
+    if (!Z)
+        AOT_GOTO(0x1aae, L1aae);
+    AOT_GOTO(0x1ad0, L1ad0);
+L1ad0:
+    AOT_BLOCK(0x1ad0, 1);
+    // 1ad0: br 1a9c
+    AOT_GOTO(0x1a9c, L1a9c);
+L1ad2:
+    AOT_BLOCK(0x1ad2, 7);
+    // 1ad2: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1ad6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1ad6: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1ada: mov 8(r5), r3
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1ade: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 1ae0: cmpb $24, (r4)+
+    {
+        src = uint8_t(0x24);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1ae4: bne 1aec
+    if (!Z)
+        AOT_GOTO(0x1aec, L1aec);
+    AOT_GOTO(0x1ae6, L1ae6);
+L1ae6:
+    AOT_BLOCK(0x1ae6, 2);
+    // 1ae6: cmpb $24, (r3)+
+    {
+        src = uint8_t(0x24);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1aea: beq 1af4
+    if (Z)
+        AOT_GOTO(0x1af4, L1af4);
+    AOT_GOTO(0x1aec, L1aec);
+L1aec:
+    AOT_BLOCK(0x1aec, 1);
+    // 1aec: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1af0, L1af0);
+L1af0:
+    AOT_BLOCK(0x1af0, 2);
+    // 1af0: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1af4:
+    AOT_BLOCK(0x1af4, 2);
+    // 1af4: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1af6: br 1b0a
+    AOT_GOTO(0x1b0a, L1b0a);
+L1af8:
+    AOT_BLOCK(0x1af8, 2);
+    // 1af8: cmpb $37, (r3)
+    {
+        src = uint8_t(0x37);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1afc: blt 1b10
+    if (N ^ V)
+        AOT_GOTO(0x1b10, L1b10);
+    AOT_GOTO(0x1afe, L1afe);
+L1afe:
+    AOT_BLOCK(0x1afe, 4);
+    // 1afe: ash $3, r2
+    {
+        src = uint16_t(0x0003) & 077;
+        val16 = r[2];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1b02: movb (r3)+, r0
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1b04: add $ffd0, r0
+    {
+        src = uint16_t(0xffd0);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1b08: add r0, r2
+    {
+        src = r[0];
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1b0a, L1b0a);
+L1b0a:
+    AOT_BLOCK(0x1b0a, 2);
+    // 1b0a: cmpb $30, (r3)
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1b0e: ble 1af8
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1af8, L1af8);
+    AOT_GOTO(0x1b10, L1b10);
+L1b10:
+    AOT_BLOCK(0x1b10, 3);
+    // 1b10: mov r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1b14: clr r2
+    {
+        r[2] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1b16: br 1b2a
+    AOT_GOTO(0x1b2a, L1b2a);
+L1b18:
+    AOT_BLOCK(0x1b18, 2);
+    // 1b18: cmpb $37, (r4)
+    {
+        src = uint8_t(0x37);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1b1c: blt 1b30
+    if (N ^ V)
+        AOT_GOTO(0x1b30, L1b30);
+    AOT_GOTO(0x1b1e, L1b1e);
+L1b1e:
+    AOT_BLOCK(0x1b1e, 4);
+    // 1b1e: ash $3, r2
+    {
+        src = uint16_t(0x0003) & 077;
+        val16 = r[2];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[2] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1b22: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1b24: add $ffd0, r0
+    {
+        src = uint16_t(0xffd0);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1b28: add r0, r2
+    {
+        src = r[0];
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1b2a, L1b2a);
+L1b2a:
+    AOT_BLOCK(0x1b2a, 2);
+    // 1b2a: cmpb $30, (r4)
+    {
+        src = uint8_t(0x30);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1b2e: ble 1b18
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1b18, L1b18);
+    AOT_GOTO(0x1b30, L1b30);
+L1b30:
+    AOT_BLOCK(0x1b30, 2);
+    // 1b30: cmpb $2b, (r4)
+    {
+        src = uint8_t(0x2b);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1b34: bne 1b38
+    if (!Z)
+        AOT_GOTO(0x1b38, L1b38);
+    AOT_GOTO(0x1b36, L1b36);
+L1b36:
+    AOT_BLOCK(0x1b36, 1);
+    // 1b36: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1b38, L1b38);
+L1b38:
+    AOT_BLOCK(0x1b38, 2);
+    // 1b38: cmpb $2b, (r3)
+    {
+        src = uint8_t(0x2b);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1b3c: bne 1b40
+    if (!Z)
+        AOT_GOTO(0x1b40, L1b40);
+    AOT_GOTO(0x1b3e, L1b3e);
+L1b3e:
+    AOT_BLOCK(0x1b3e, 1);
+    // 1b3e: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1b40, L1b40);
+L1b40:
+    AOT_BLOCK(0x1b40, 2);
+    // 1b40: cmpb (r3), (r4)+
+    {
+        a = r[3];
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1b42: bne 1aec
+    if (!Z)
+        AOT_GOTO(0x1aec, L1aec);
+    AOT_GOTO(0x1b44, L1b44);
+L1b44:
+    AOT_BLOCK(0x1b44, 2);
+    // 1b44: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1b46: bne 1b40
+    if (!Z)
+        AOT_GOTO(0x1b40, L1b40);
+    AOT_GOTO(0x1b48, L1b48);
+L1b48:
+    AOT_BLOCK(0x1b48, 3);
+    // 1b48: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1b4c: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b50: bhi 1aec
+    if (!(C | Z))
+        AOT_GOTO(0x1aec, L1aec);
+    AOT_GOTO(0x1b52, L1b52);
+L1b52:
+    AOT_BLOCK(0x1b52, 2);
+    // 1b52: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 1b54: jmp *418(r0)
+    {
+        a = RD16(r[0] + 1048);
+    }
+    AOT_JUMP(a);
+L1b58:
+    AOT_BLOCK(0x1b58, 2);
+    // 1b58: cmp -8(r5), r2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b5c: beq 1b62
+    if (Z)
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1b5e, L1b5e);
+L1b5e:
+    AOT_BLOCK(0x1b5e, 2);
+    // 1b5e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1b60: br 1af0
+    AOT_GOTO(0x1af0, L1af0);
+L1b62:
+    AOT_BLOCK(0x1b62, 2);
+    // 1b62: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b66: br 1af0
+    AOT_GOTO(0x1af0, L1af0);
+L1b68:
+    AOT_BLOCK(0x1b68, 2);
+    // 1b68: cmp -8(r5), r2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b6c: bne 1b62
+    if (!Z)
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1b6e, L1b6e);
+L1b6e:
+    AOT_BLOCK(0x1b6e, 1);
+    // 1b6e: br 1b5e
+    AOT_GOTO(0x1b5e, L1b5e);
+L1b70:
+    AOT_BLOCK(0x1b70, 2);
+    // 1b70: cmp -8(r5), r2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b74: bge 1b62
+    if (!(N ^ V))
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1b76, L1b76);
+L1b76:
+    AOT_BLOCK(0x1b76, 1);
+    // 1b76: br 1b5e
+    AOT_GOTO(0x1b5e, L1b5e);
+L1b78:
+    AOT_BLOCK(0x1b78, 2);
+    // 1b78: cmp -8(r5), r2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b7c: ble 1b62
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1b7e, L1b7e);
+L1b7e:
+    AOT_BLOCK(0x1b7e, 1);
+    // 1b7e: br 1b5e
+    AOT_GOTO(0x1b5e, L1b5e);
+L1b80:
+    AOT_BLOCK(0x1b80, 2);
+    // 1b80: cmp -8(r5), r2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b84: bgt 1b62
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1b86, L1b86);
+L1b86:
+    AOT_BLOCK(0x1b86, 1);
+    // 1b86: br 1b5e
+    AOT_GOTO(0x1b5e, L1b5e);
+L1b88:
+    AOT_BLOCK(0x1b88, 2);
+    // 1b88: cmp -8(r5), r2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b8c: blt 1b62
+    if (N ^ V)
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1b8e, L1b8e);
+L1b8e:
+    AOT_BLOCK(0x1b8e, 1);
+    // 1b8e: br 1b5e
+    AOT_GOTO(0x1b5e, L1b5e);
+L1b90:
+    AOT_BLOCK(0x1b90, 2);
+    // 1b90: cmp -8(r5), r2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b94: bhi 1b62
+    if (!(C | Z))
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1b96, L1b96);
+L1b96:
+    AOT_BLOCK(0x1b96, 1);
+    // 1b96: br 1b5e
+    AOT_GOTO(0x1b5e, L1b5e);
+L1b98:
+    AOT_BLOCK(0x1b98, 2);
+    // 1b98: cmp -8(r5), r2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b9c: bcs 1b62
+    if (C)
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1b9e, L1b9e);
+L1b9e:
+    AOT_BLOCK(0x1b9e, 1);
+    // 1b9e: br 1b5e
+    AOT_GOTO(0x1b5e, L1b5e);
+L1ba0:
+    AOT_BLOCK(0x1ba0, 2);
+    // 1ba0: cmp -8(r5), r2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ba4: bcc 1b62
+    if (!C)
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1ba6, L1ba6);
+L1ba6:
+    AOT_BLOCK(0x1ba6, 1);
+    // 1ba6: br 1b5e
+    AOT_GOTO(0x1b5e, L1b5e);
+L1ba8:
+    AOT_BLOCK(0x1ba8, 2);
+    // 1ba8: cmp -8(r5), r2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1bac: blos 1b62
+    if (C | Z)
+        AOT_GOTO(0x1b62, L1b62);
+    AOT_GOTO(0x1bae, L1bae);
+L1bae:
+    AOT_BLOCK(0x1bae, 1);
+    // 1bae: br 1b5e
+    AOT_GOTO(0x1b5e, L1b5e);
+L1bb0:
+    AOT_BLOCK(0x1bb0, 6);
+    // 1bb0: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1bb4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1bb4: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1bb8: mov 4(r5), r3
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1bbc: cmpb $24, (r3)
+    {
+        src = uint8_t(0x24);
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1bc0: bne 1bdc
+    if (!Z)
+        AOT_GOTO(0x1bdc, L1bdc);
+    AOT_GOTO(0x1bc2, L1bc2);
+L1bc2:
+    AOT_BLOCK(0x1bc2, 2);
+    // 1bc2: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bc4: jsr pc, *$1c3e
+    {
+        a = 0x1c3e;
+        r[6] -= 2;
+        WR16(r[6], 0x1bc8);
+    }
+    AOT_GOTO(0x1c3e, L1c3e);
+L1bc8:
+    AOT_BLOCK(0x1bc8, 2);
+    // 1bc8: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1bca: beq 1bdc
+    if (Z)
+        AOT_GOTO(0x1bdc, L1bdc);
+    AOT_GOTO(0x1bcc, L1bcc);
+L1bcc:
+    AOT_BLOCK(0x1bcc, 1);
+    // 1bcc: mov $8ca, r2
+    {
+        src = uint16_t(0x08ca);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1bd0, L1bd0);
+L1bd0:
+    AOT_BLOCK(0x1bd0, 2);
+    // 1bd0: movb (r4)+, (r2)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1bd2: bne 1bd0
+    if (!Z)
+        AOT_GOTO(0x1bd0, L1bd0);
+    AOT_GOTO(0x1bd4, L1bd4);
+L1bd4:
+    AOT_BLOCK(0x1bd4, 1);
+    // 1bd4: mov $8de, r2
+    {
+        src = uint16_t(0x08de);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1bd8, L1bd8);
+L1bd8:
+    AOT_BLOCK(0x1bd8, 2);
+    // 1bd8: movb (r3)+, (r2)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1bda: bne 1bd8
+    if (!Z)
+        AOT_GOTO(0x1bd8, L1bd8);
+    AOT_GOTO(0x1bdc, L1bdc);
+L1bdc:
+    AOT_BLOCK(0x1bdc, 2);
+    // 1bdc: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1be0:
+    AOT_BLOCK(0x1be0, 5);
+    // 1be0: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1be4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1be4: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 1be8: mov 4(r5), -8(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1bee: mov 6(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1bf4, L1bf4);
+L1bf4:
+    AOT_BLOCK(0x1bf4, 4);
+    // 1bf4: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1bf8: inc -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1bfc: cmpb *-a(r5), (r0)
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        b = r[0];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1c00: beq 1c08
+    if (Z)
+        AOT_GOTO(0x1c08, L1c08);
+    AOT_GOTO(0x1c02, L1c02);
+L1c02:
+    AOT_BLOCK(0x1c02, 1);
+    // 1c02: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1c04, L1c04);
+L1c04:
+    AOT_BLOCK(0x1c04, 2);
+    // 1c04: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1c08:
+    AOT_BLOCK(0x1c08, 4);
+    // 1c08: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1c0c: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1c10: tstb (r0)
+    {
+        a = r[0];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1c12: bne 1bf4
+    if (!Z)
+        AOT_GOTO(0x1bf4, L1bf4);
+    AOT_GOTO(0x1c14, L1c14);
+L1c14:
+    AOT_BLOCK(0x1c14, 2);
+    // 1c14: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c18: br 1c04
+    AOT_GOTO(0x1c04, L1c04);
+L1c1a:
+    AOT_BLOCK(0x1c1a, 5);
+    // 1c1a: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1c1e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1c1e: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1c22: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c24: jsr pc, *$1c3e
+    {
+        a = 0x1c3e;
+        r[6] -= 2;
+        WR16(r[6], 0x1c28);
+    }
+    AOT_GOTO(0x1c3e, L1c3e);
+L1c28:
+    AOT_BLOCK(0x1c28, 2);
+    // 1c28: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1c2a: bne 1c34
+    if (!Z)
+        AOT_GOTO(0x1c34, L1c34);
+    AOT_GOTO(0x1c2c, L1c2c);
+L1c2c:
+    AOT_BLOCK(0x1c2c, 1);
+    // 1c2c: clrb 08f2
+    {
+        a = 0x08f2;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1c30, L1c30);
+L1c30:
+    AOT_BLOCK(0x1c30, 2);
+    // 1c30: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1c34:
+    AOT_BLOCK(0x1c34, 1);
+    // 1c34: mov $8f2, r3
+    {
+        src = uint16_t(0x08f2);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1c38, L1c38);
+L1c38:
+    AOT_BLOCK(0x1c38, 2);
+    // 1c38: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1c3a: bne 1c38
+    if (!Z)
+        AOT_GOTO(0x1c38, L1c38);
+    AOT_GOTO(0x1c3c, L1c3c);
+L1c3c:
+    AOT_BLOCK(0x1c3c, 1);
+    // 1c3c: br 1c30
+    AOT_GOTO(0x1c30, L1c30);
+L1c3e:
+    AOT_BLOCK(0x1c3e, 5);
+    // 1c3e: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1c42;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1c42: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1c46: cmpb $2a, (r4)
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1c4a: beq 1c60
+    if (Z)
+        AOT_GOTO(0x1c60, L1c60);
+    AOT_GOTO(0x1c4c, L1c4c);
+L1c4c:
+    AOT_BLOCK(0x1c4c, 2);
+    // 1c4c: cmpb $28, (r4)
+    {
+        src = uint8_t(0x28);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1c50: beq 1c60
+    if (Z)
+        AOT_GOTO(0x1c60, L1c60);
+    AOT_GOTO(0x1c52, L1c52);
+L1c52:
+    AOT_BLOCK(0x1c52, 2);
+    // 1c52: cmpb $2d, (r4)
+    {
+        src = uint8_t(0x2d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1c56: bne 1c6c
+    if (!Z)
+        AOT_GOTO(0x1c6c, L1c6c);
+    AOT_GOTO(0x1c58, L1c58);
+L1c58:
+    AOT_BLOCK(0x1c58, 2);
+    // 1c58: cmpb $28, 1(r4)
+    {
+        src = uint8_t(0x28);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1c5e: bne 1c6c
+    if (!Z)
+        AOT_GOTO(0x1c6c, L1c6c);
+    AOT_GOTO(0x1c60, L1c60);
+L1c60:
+    AOT_BLOCK(0x1c60, 2);
+    // 1c60: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1c62: br 1c82
+    AOT_GOTO(0x1c82, L1c82);
+L1c64:
+    AOT_BLOCK(0x1c64, 2);
+    // 1c64: cmpb $35, -(r4)
+    {
+        src = uint8_t(0x35);
+        r[4] -= 1;
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1c68: bne 1c60
+    if (!Z)
+        AOT_GOTO(0x1c60, L1c60);
+    AOT_GOTO(0x1c6a, L1c6a);
+L1c6a:
+    AOT_BLOCK(0x1c6a, 1);
+    // 1c6a: br 1c7e
+    AOT_GOTO(0x1c7e, L1c7e);
+L1c6c:
+    AOT_BLOCK(0x1c6c, 2);
+    // 1c6c: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1c6e: bne 1c6c
+    if (!Z)
+        AOT_GOTO(0x1c6c, L1c6c);
+    AOT_GOTO(0x1c70, L1c70);
+L1c70:
+    AOT_BLOCK(0x1c70, 3);
+    // 1c70: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 1c72: cmpb $2b, -(r4)
+    {
+        src = uint8_t(0x2b);
+        r[4] -= 1;
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1c76: beq 1c60
+    if (Z)
+        AOT_GOTO(0x1c60, L1c60);
+    AOT_GOTO(0x1c78, L1c78);
+L1c78:
+    AOT_BLOCK(0x1c78, 2);
+    // 1c78: cmpb $29, (r4)
+    {
+        src = uint8_t(0x29);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1c7c: beq 1c64
+    if (Z)
+        AOT_GOTO(0x1c64, L1c64);
+    AOT_GOTO(0x1c7e, L1c7e);
+L1c7e:
+    AOT_BLOCK(0x1c7e, 1);
+    // 1c7e: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1c82, L1c82);
+L1c82:
+    AOT_BLOCK(0x1c82, 2);
+    // 1c82: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1c86:
+    AOT_BLOCK(0x1c86, 5);
+    // 1c86: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1c8a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1c8a: mov 8(r5), r4
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1c8e: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c90: jsr pc, *$2234
+    {
+        a = 0x2234;
+        r[6] -= 2;
+        WR16(r[6], 0x1c94);
+    }
+    AOT_GOTO(0x2234, L2234);
+L1c94:
+    AOT_BLOCK(0x1c94, 4);
+    // 1c94: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c96: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c9a: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c9e: jsr pc, *$2296
+    {
+        a = 0x2296;
+        r[6] -= 2;
+        WR16(r[6], 0x1ca2);
+    }
+    AOT_GOTO(0x2296, L2296);
+L1ca2:
+    AOT_BLOCK(0x1ca2, 3);
+    // 1ca2: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1ca4: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1ca8:
+    AOT_BLOCK(0x1ca8, 7);
+    // 1ca8: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1cac;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1cac: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1cb0: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1cb2: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1cb6: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cba: jsr pc, *$1dcc
+    {
+        a = 0x1dcc;
+        r[6] -= 2;
+        WR16(r[6], 0x1cbe);
+    }
+    AOT_GOTO(0x1dcc, L1dcc);
+L1cbe:
+    AOT_BLOCK(0x1cbe, 4);
+    // 1cbe: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1cc0: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1cc4: bitb $20, 6(r0)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[0] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1cca: beq 1cd4
+    if (Z)
+        AOT_GOTO(0x1cd4, L1cd4);
+    AOT_GOTO(0x1ccc, L1ccc);
+L1ccc:
+    AOT_BLOCK(0x1ccc, 1);
+    // 1ccc: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1cd0, L1cd0);
+L1cd0:
+    AOT_BLOCK(0x1cd0, 2);
+    // 1cd0: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1cd4:
+    AOT_BLOCK(0x1cd4, 2);
+    // 1cd4: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1cd6: br 1cd0
+    AOT_GOTO(0x1cd0, L1cd0);
+L1cd8:
+    AOT_BLOCK(0x1cd8, 7);
+    // 1cd8: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1cdc;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1cdc: mov $4d8, (sp)
+    {
+        src = uint16_t(0x04d8);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ce0: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ce2: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1ce6: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cea: jsr pc, *$1dcc
+    {
+        a = 0x1dcc;
+        r[6] -= 2;
+        WR16(r[6], 0x1cee);
+    }
+    AOT_GOTO(0x1dcc, L1dcc);
+L1cee:
+    AOT_BLOCK(0x1cee, 3);
+    // 1cee: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1cf0: bitb $20, 04de
+    {
+        src = uint8_t(0x20);
+        b = 0x04de;
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1cf6: beq 1d00
+    if (Z)
+        AOT_GOTO(0x1d00, L1d00);
+    AOT_GOTO(0x1cf8, L1cf8);
+L1cf8:
+    AOT_BLOCK(0x1cf8, 1);
+    // 1cf8: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1cfc, L1cfc);
+L1cfc:
+    AOT_BLOCK(0x1cfc, 2);
+    // 1cfc: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1d00:
+    AOT_BLOCK(0x1d00, 2);
+    // 1d00: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1d02: br 1cfc
+    AOT_GOTO(0x1cfc, L1cfc);
+L1d04:
+    AOT_BLOCK(0x1d04, 5);
+    // 1d04: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1d08;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1d08: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1d0c: bitb $80, 6(r4)
+    {
+        src = uint8_t(0x80);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1d12: beq 1d1a
+    if (Z)
+        AOT_GOTO(0x1d1a, L1d1a);
+    AOT_GOTO(0x1d14, L1d14);
+L1d14:
+    AOT_BLOCK(0x1d14, 1);
+    // 1d14: bisb $1, 6(r4)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d1a, L1d1a);
+L1d1a:
+    AOT_BLOCK(0x1d1a, 2);
+    // 1d1a: bitb $1, 6(r4)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1d20: beq 1d2a
+    if (Z)
+        AOT_GOTO(0x1d2a, L1d2a);
+    AOT_GOTO(0x1d22, L1d22);
+L1d22:
+    AOT_BLOCK(0x1d22, 2);
+    // 1d22: bitb $40, 6(r4)
+    {
+        src = uint8_t(0x40);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1d28: beq 1d46
+    if (Z)
+        AOT_GOTO(0x1d46, L1d46);
+    AOT_GOTO(0x1d2a, L1d2a);
+L1d2a:
+    AOT_BLOCK(0x1d2a, 1);
+    // 1d2a: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d2e, L1d2e);
+L1d2e:
+    AOT_BLOCK(0x1d2e, 2);
+    // 1d2e: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1d32:
+    AOT_BLOCK(0x1d32, 2);
+    // 1d32: mov $200, (sp)
+    {
+        src = uint16_t(0x0200);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d36: jsr pc, *$23c4
+    {
+        a = 0x23c4;
+        r[6] -= 2;
+        WR16(r[6], 0x1d3a);
+    }
+    AOT_GOTO(0x23c4, L23c4);
+L1d3a:
+    AOT_BLOCK(0x1d3a, 2);
+    // 1d3a: mov r0, 4(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d3e: bne 1d62
+    if (!Z)
+        AOT_GOTO(0x1d62, L1d62);
+    AOT_GOTO(0x1d40, L1d40);
+L1d40:
+    AOT_BLOCK(0x1d40, 1);
+    // 1d40: bisb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d46, L1d46);
+L1d46:
+    AOT_BLOCK(0x1d46, 2);
+    // 1d46: tst 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1d4a: bne 1d68
+    if (!Z)
+        AOT_GOTO(0x1d68, L1d68);
+    AOT_GOTO(0x1d4c, L1d4c);
+L1d4c:
+    AOT_BLOCK(0x1d4c, 2);
+    // 1d4c: bitb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1d52: beq 1d32
+    if (Z)
+        AOT_GOTO(0x1d32, L1d32);
+    AOT_GOTO(0x1d54, L1d54);
+L1d54:
+    AOT_BLOCK(0x1d54, 4);
+    // 1d54: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1d58: add $efe, r0
+    {
+        src = uint16_t(0x0efe);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1d5c: mov r0, 4(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d60: br 1d46
+    AOT_GOTO(0x1d46, L1d46);
+L1d62:
+    AOT_BLOCK(0x1d62, 1);
+    // 1d62: bisb $8, 6(r4)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d68, L1d68);
+L1d68:
+    AOT_BLOCK(0x1d68, 3);
+    // 1d68: mov 4(r4), (r4)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+    }
+    // 1d6c: bitb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1d72: beq 1d7a
+    if (Z)
+        AOT_GOTO(0x1d7a, L1d7a);
+    AOT_GOTO(0x1d74, L1d74);
+L1d74:
+    AOT_BLOCK(0x1d74, 2);
+    // 1d74: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d78: br 1d7e
+    AOT_GOTO(0x1d7e, L1d7e);
+L1d7a:
+    AOT_BLOCK(0x1d7a, 1);
+    // 1d7a: mov $200, (sp)
+    {
+        src = uint16_t(0x0200);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1d7e, L1d7e);
+L1d7e:
+    AOT_BLOCK(0x1d7e, 4);
+    // 1d7e: mov (r4), -(sp)
+    {
+        a = r[4];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1d80: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1d84: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d86: jsr pc, *$26de
+    {
+        a = 0x26de;
+        r[6] -= 2;
+        WR16(r[6], 0x1d8a);
+    }
+    AOT_GOTO(0x26de, L26de);
+L1d8a:
+    AOT_BLOCK(0x1d8a, 4);
+    // 1d8a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 1d8c: mov r0, 2(r4)
+    {
+        src = r[0];
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 1d90: dec 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1d94: bge 1dc0
+    if (!(N ^ V))
+        AOT_GOTO(0x1dc0, L1dc0);
+    AOT_GOTO(0x1d96, L1d96);
+L1d96:
+    AOT_BLOCK(0x1d96, 2);
+    // 1d96: cmp $ffff, 2(r4)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[4] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d9c: bne 1db4
+    if (!Z)
+        AOT_GOTO(0x1db4, L1db4);
+    AOT_GOTO(0x1d9e, L1d9e);
+L1d9e:
+    AOT_BLOCK(0x1d9e, 3);
+    // 1d9e: bisb $10, 6(r4)
+    {
+        src = uint8_t(0x10);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 1da4: bitb $80, 6(r4)
+    {
+        src = uint8_t(0x80);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1daa: beq 1dba
+    if (Z)
+        AOT_GOTO(0x1dba, L1dba);
+    AOT_GOTO(0x1dac, L1dac);
+L1dac:
+    AOT_BLOCK(0x1dac, 2);
+    // 1dac: bicb $1, 6(r4)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1db2: br 1dba
+    AOT_GOTO(0x1dba, L1dba);
+L1db4:
+    AOT_BLOCK(0x1db4, 1);
+    // 1db4: bisb $20, 6(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x1dba, L1dba);
+L1dba:
+    AOT_BLOCK(0x1dba, 2);
+    // 1dba: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1dbe: br 1d2a
+    AOT_GOTO(0x1d2a, L1d2a);
+L1dc0:
+    AOT_BLOCK(0x1dc0, 4);
+    // 1dc0: movb *0(r4), r0
+    {
+        a = RD16(r[4] + 0);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1dc4: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1dc8: inc (r4)
+    {
+        a = r[4];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1dca: br 1d2e
+    AOT_GOTO(0x1d2e, L1d2e);
+L1dcc:
+    AOT_BLOCK(0x1dcc, 5);
+    // 1dcc: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1dd0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 1dd0: sub $8c, sp
+    {
+        src = uint16_t(0x008c);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 1dd4: mov 4(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1dda: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1dde, L1dde);
+L1dde:
+    AOT_BLOCK(0x1dde, 2);
+    // 1dde: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 1de0: mov -a(r5), r1
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1de4, L1de4);
+L1de4:
+    AOT_BLOCK(0x1de4, 2);
+    // 1de4: movb (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1de6: beq 1df2
+    if (Z)
+        AOT_GOTO(0x1df2, L1df2);
+    AOT_GOTO(0x1de8, L1de8);
+L1de8:
+    AOT_BLOCK(0x1de8, 2);
+    // 1de8: cmp r2, $25
+    {
+        src = r[2];
+        dst = uint16_t(0x0025);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1dec: beq 1df2
+    if (Z)
+        AOT_GOTO(0x1df2, L1df2);
+    AOT_GOTO(0x1dee, L1dee);
+L1dee:
+    AOT_BLOCK(0x1dee, 2);
+    // 1dee: movb r2, (r3)+
+    {
+        src = uint8_t(r[2]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1df0: br 1de4
+    AOT_GOTO(0x1de4, L1de4);
+L1df2:
+    AOT_BLOCK(0x1df2, 3);
+    // 1df2: mov r1, -a(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1df6: cmp r3, sp
+    {
+        src = r[3];
+        dst = r[6];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1df8: beq 1e10
+    if (Z)
+        AOT_GOTO(0x1e10, L1e10);
+    AOT_GOTO(0x1dfa, L1dfa);
+L1dfa:
+    AOT_BLOCK(0x1dfa, 7);
+    // 1dfa: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+    }
+    // 1dfc: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e00: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 1e02: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e04: sub r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 1e06: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e08: jsr pc, 2022
+    {
+        a = 0x2022;
+        r[6] -= 2;
+        WR16(r[6], 0x1e0c);
+    }
+    AOT_GOTO(0x2022, L2022);
+L1e0c:
+    AOT_BLOCK(0x1e0c, 1);
+    // 1e0c: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1e10, L1e10);
+L1e10:
+    AOT_BLOCK(0x1e10, 2);
+    // 1e10: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1e12: bne 1e18
+    if (!Z)
+        AOT_GOTO(0x1e18, L1e18);
+    AOT_GOTO(0x1e14, L1e14);
+L1e14:
+    AOT_BLOCK(0x1e14, 2);
+    // 1e14: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1e18:
+    AOT_BLOCK(0x1e18, 6);
+    // 1e18: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 1e1a: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+    }
+    // 1e1e: clr -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        WR16(a, 0);
+    }
+    // 1e22: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 1e28: cmpb *-a(r5), $2d
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        dst = uint8_t(0x2d);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1e2e: bne 1e38
+    if (!Z)
+        AOT_GOTO(0x1e38, L1e38);
+    AOT_GOTO(0x1e30, L1e30);
+L1e30:
+    AOT_BLOCK(0x1e30, 2);
+    // 1e30: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1e34: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1e38, L1e38);
+L1e38:
+    AOT_BLOCK(0x1e38, 2);
+    // 1e38: cmpb *-a(r5), $30
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        dst = uint8_t(0x30);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1e3e: bne 1e46
+    if (!Z)
+        AOT_GOTO(0x1e46, L1e46);
+    AOT_GOTO(0x1e40, L1e40);
+L1e40:
+    AOT_BLOCK(0x1e40, 1);
+    // 1e40: mov $30, -12(r5)
+    {
+        src = uint16_t(0x0030);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1e46, L1e46);
+L1e46:
+    AOT_BLOCK(0x1e46, 1);
+    // 1e46: jsr r3, 1fe4
+    {
+        a = 0x1fe4;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x1e4a;
+    }
+    AOT_GOTO(0x1fe4, L1fe4);
+L1e4a:
+    AOT_BLOCK(0x1e4a, 4);
+    // 1e4a: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1e4e: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+    }
+    // 1e52: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e56: bne 1e60
+    if (!Z)
+        AOT_GOTO(0x1e60, L1e60);
+    AOT_GOTO(0x1e58, L1e58);
+L1e58:
+    AOT_BLOCK(0x1e58, 1);
+    // 1e58: jsr r3, 1fe4
+    {
+        a = 0x1fe4;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x1e5c;
+    }
+    AOT_GOTO(0x1fe4, L1fe4);
+L1e5c:
+    AOT_BLOCK(0x1e5c, 1);
+    // 1e5c: mov r1, -10(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1e60, L1e60);
+L1e60:
+    AOT_BLOCK(0x1e60, 1);
+    // 1e60: mov $484, r1
+    {
+        src = uint16_t(0x0484);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1e64, L1e64);
+L1e64:
+    AOT_BLOCK(0x1e64, 2);
+    // 1e64: mov (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e66: bne 1e6e
+    if (!Z)
+        AOT_GOTO(0x1e6e, L1e6e);
+    AOT_GOTO(0x1e68, L1e68);
+L1e68:
+    AOT_BLOCK(0x1e68, 2);
+    // 1e68: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1e6a: jmp 1fb4
+    {
+        a = 0x1fb4;
+    }
+    AOT_GOTO(0x1fb4, L1fb4);
+L1e6e:
+    AOT_BLOCK(0x1e6e, 2);
+    // 1e6e: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e70: bne 1e64
+    if (!Z)
+        AOT_GOTO(0x1e64, L1e64);
+    AOT_GOTO(0x1e72, L1e72);
+L1e72:
+    AOT_BLOCK(0x1e72, 1);
+    // 1e72: jmp (r2)
+    {
+        a = r[2];
+    }
+    AOT_JUMP(a);
+L1e74:
+    AOT_BLOCK(0x1e74, 3);
+    // 1e74: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1e78: mov -e(r5), r2
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e7c: jsr pc, 2018
+    {
+        a = 0x2018;
+        r[6] -= 2;
+        WR16(r[6], 0x1e80);
+    }
+    AOT_GOTO(0x2018, L2018);
+L1e80:
+    AOT_BLOCK(0x1e80, 1);
+    // 1e80: jmp *$1fb4
+    {
+        a = 0x1fb4;
+    }
+    AOT_GOTO(0x1fb4, L1fb4);
+L1e84:
+    AOT_BLOCK(0x1e84, 4);
+    // 1e84: movb *-a(r5), r0
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1e88: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1e8c: cmp r0, $6f
+    {
+        src = r[0];
+        dst = uint16_t(0x006f);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e90: beq 1eae
+    if (Z)
+        AOT_GOTO(0x1eae, L1eae);
+    AOT_GOTO(0x1e92, L1e92);
+L1e92:
+    AOT_BLOCK(0x1e92, 2);
+    // 1e92: cmp r0, $78
+    {
+        src = r[0];
+        dst = uint16_t(0x0078);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e96: beq 1eba
+    if (Z)
+        AOT_GOTO(0x1eba, L1eba);
+    AOT_GOTO(0x1e98, L1e98);
+L1e98:
+    AOT_BLOCK(0x1e98, 2);
+    // 1e98: cmp r0, $64
+    {
+        src = r[0];
+        dst = uint16_t(0x0064);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e9c: beq 1ed0
+    if (Z)
+        AOT_GOTO(0x1ed0, L1ed0);
+    AOT_GOTO(0x1e9e, L1e9e);
+L1e9e:
+    AOT_BLOCK(0x1e9e, 2);
+    // 1e9e: cmp r0, $75
+    {
+        src = r[0];
+        dst = uint16_t(0x0075);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ea2: beq 1ee2
+    if (Z)
+        AOT_GOTO(0x1ee2, L1ee2);
+    AOT_GOTO(0x1ea4, L1ea4);
+L1ea4:
+    AOT_BLOCK(0x1ea4, 2);
+    // 1ea4: dec -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1ea8: br 1ecc
+    AOT_GOTO(0x1ecc, L1ecc);
+L1eaa:
+    AOT_BLOCK(0x1eaa, 2);
+    // 1eaa: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1eac: br 1eb0
+    AOT_GOTO(0x1eb0, L1eb0);
+L1eae:
+    AOT_BLOCK(0x1eae, 1);
+    // 1eae: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1eb0, L1eb0);
+L1eb0:
+    AOT_BLOCK(0x1eb0, 2);
+    // 1eb0: mov $8, r2
+    {
+        src = uint16_t(0x0008);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1eb4: br 1ec0
+    AOT_GOTO(0x1ec0, L1ec0);
+L1eb6:
+    AOT_BLOCK(0x1eb6, 2);
+    // 1eb6: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1eb8: br 1ebc
+    AOT_GOTO(0x1ebc, L1ebc);
+L1eba:
+    AOT_BLOCK(0x1eba, 1);
+    // 1eba: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ebc, L1ebc);
+L1ebc:
+    AOT_BLOCK(0x1ebc, 1);
+    // 1ebc: mov $10, r2
+    {
+        src = uint16_t(0x0010);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ec0, L1ec0);
+L1ec0:
+    AOT_BLOCK(0x1ec0, 2);
+    // 1ec0: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ec2: br 1eea
+    AOT_GOTO(0x1eea, L1eea);
+L1ec4:
+    AOT_BLOCK(0x1ec4, 3);
+    // 1ec4: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ec6: sxt r0
+    {
+        r[0] = -int(N);
+        Z = !N;
+    }
+    // 1ec8: bmi 1ed6
+    if (N)
+        AOT_GOTO(0x1ed6, L1ed6);
+    AOT_GOTO(0x1eca, L1eca);
+L1eca:
+    AOT_BLOCK(0x1eca, 1);
+    // 1eca: br 1ee6
+    AOT_GOTO(0x1ee6, L1ee6);
+L1ecc:
+    AOT_BLOCK(0x1ecc, 2);
+    // 1ecc: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1ece: br 1ee4
+    AOT_GOTO(0x1ee4, L1ee4);
+L1ed0:
+    AOT_BLOCK(0x1ed0, 2);
+    // 1ed0: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ed2: bge 1ee4
+    if (!(N ^ V))
+        AOT_GOTO(0x1ee4, L1ee4);
+    AOT_GOTO(0x1ed4, L1ed4);
+L1ed4:
+    AOT_BLOCK(0x1ed4, 1);
+    // 1ed4: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ed6, L1ed6);
+L1ed6:
+    AOT_BLOCK(0x1ed6, 5);
+    // 1ed6: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+    }
+    // 1ed8: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 1eda: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+        C = C && val == -1;
+    }
+    // 1edc: movb $2d, (r3)+
+    {
+        src = uint8_t(0x2d);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1ee0: br 1ee6
+    AOT_GOTO(0x1ee6, L1ee6);
+L1ee2:
+    AOT_BLOCK(0x1ee2, 1);
+    // 1ee2: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ee4, L1ee4);
+L1ee4:
+    AOT_BLOCK(0x1ee4, 1);
+    // 1ee4: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ee6, L1ee6);
+L1ee6:
+    AOT_BLOCK(0x1ee6, 1);
+    // 1ee6: mov $a, r2
+    {
+        src = uint16_t(0x000a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1eea, L1eea);
+L1eea:
+    AOT_BLOCK(0x1eea, 7);
+    // 1eea: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1eec: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1eee: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1ef0: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1ef4: mov r1, r5
+    {
+        src = r[1];
+        r[5] = src;
+    }
+    // 1ef6: ashc $0, r4
+    {
+        src = uint16_t(0x0000) & 077;
+        val = int32_t((uint32_t(r[4]) << 16) | r[5]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[4] = uint32_t(val2) >> 16;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[4] = uint32_t(val2) >> 16;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 1efa: beq 1f04
+    if (Z)
+        AOT_GOTO(0x1f04, L1f04);
+    AOT_GOTO(0x1efc, L1efc);
+L1efc:
+    AOT_BLOCK(0x1efc, 2);
+    // 1efc: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1efe: beq 1f04
+    if (Z)
+        AOT_GOTO(0x1f04, L1f04);
+    AOT_GOTO(0x1f00, L1f00);
+L1f00:
+    AOT_BLOCK(0x1f00, 1);
+    // 1f00: movb $30, (r3)+
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1f04, L1f04);
+L1f04:
+    AOT_BLOCK(0x1f04, 1);
+    // 1f04: jsr pc, 1f0e
+    {
+        a = 0x1f0e;
+        r[6] -= 2;
+        WR16(r[6], 0x1f08);
+    }
+    AOT_GOTO(0x1f0e, L1f0e);
+L1f08:
+    AOT_BLOCK(0x1f08, 3);
+    // 1f08: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1f0a: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f0c: br 1fb4
+    AOT_GOTO(0x1fb4, L1fb4);
+L1f0e:
+    AOT_BLOCK(0x1f0e, 3);
+    // 1f0e: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 1f10: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f12: beq 1f1a
+    if (Z)
+        AOT_GOTO(0x1f1a, L1f1a);
+    AOT_GOTO(0x1f14, L1f14);
+L1f14:
+    AOT_BLOCK(0x1f14, 3);
+    // 1f14: div r2, r0
+    {
+        src = int16_t(r[2]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1f16: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1f18: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1f1a, L1f1a);
+L1f1a:
+    AOT_BLOCK(0x1f1a, 7);
+    // 1f1a: mov r5, r1
+    {
+        src = r[5];
+        r[1] = src;
+    }
+    // 1f1c: asl r2
+    {
+        src = r[2];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[2] = val;
+    }
+    // 1f1e: div r2, r0
+    {
+        src = int16_t(r[2]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1f20: asr r2
+    {
+        src = r[2];
+        val = int16_t(src) >> 1;
+        r[2] = val;
+    }
+    // 1f22: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1f24: cmp r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f26: bgt 1f2c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1f2c, L1f2c);
+    AOT_GOTO(0x1f28, L1f28);
+L1f28:
+    AOT_BLOCK(0x1f28, 2);
+    // 1f28: sub r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        C = dst < src;
+    }
+    // 1f2a: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1f2c, L1f2c);
+L1f2c:
+    AOT_BLOCK(0x1f2c, 3);
+    // 1f2c: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1f2e: mov r0, r5
+    {
+        src = r[0];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f30: bne 1f36
+    if (!Z)
+        AOT_GOTO(0x1f36, L1f36);
+    AOT_GOTO(0x1f32, L1f32);
+L1f32:
+    AOT_BLOCK(0x1f32, 2);
+    // 1f32: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1f34: beq 1f3a
+    if (Z)
+        AOT_GOTO(0x1f3a, L1f3a);
+    AOT_GOTO(0x1f36, L1f36);
+L1f36:
+    AOT_BLOCK(0x1f36, 1);
+    // 1f36: jsr pc, 1f0e
+    {
+        a = 0x1f0e;
+        r[6] -= 2;
+        WR16(r[6], 0x1f3a);
+    }
+    AOT_GOTO(0x1f0e, L1f0e);
+L1f3a:
+    AOT_BLOCK(0x1f3a, 4);
+    // 1f3a: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1f3c: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1f40: cmp r0, $39
+    {
+        src = r[0];
+        dst = uint16_t(0x0039);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f44: ble 1f4a
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1f4a, L1f4a);
+    AOT_GOTO(0x1f46, L1f46);
+L1f46:
+    AOT_BLOCK(0x1f46, 1);
+    // 1f46: add $27, r0
+    {
+        src = uint16_t(0x0027);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1f4a, L1f4a);
+L1f4a:
+    AOT_BLOCK(0x1f4a, 2);
+    // 1f4a: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1f4c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1f4e:
+    AOT_BLOCK(0x1f4e, 4);
+    // 1f4e: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 1f54: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1f56: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1f5a: beq 1fb4
+    if (Z)
+        AOT_GOTO(0x1fb4, L1fb4);
+    AOT_GOTO(0x1f5c, L1f5c);
+L1f5c:
+    AOT_BLOCK(0x1f5c, 2);
+    // 1f5c: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1f5e: br 1fb4
+    AOT_GOTO(0x1fb4, L1fb4);
+L1f60:
+    AOT_BLOCK(0x1f60, 5);
+    // 1f60: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 1f66: mov -10(r5), r1
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1f6a: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1f6c: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f6e: bne 1f78
+    if (!Z)
+        AOT_GOTO(0x1f78, L1f78);
+    AOT_GOTO(0x1f70, L1f70);
+L1f70:
+    AOT_BLOCK(0x1f70, 3);
+    // 1f70: mov $4c8, r2
+    {
+        src = uint16_t(0x04c8);
+        r[2] = src;
+    }
+    // 1f74: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+    }
+    // 1f76: mov r2, (r4)
+    {
+        src = r[2];
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1f78, L1f78);
+L1f78:
+    AOT_BLOCK(0x1f78, 2);
+    // 1f78: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1f7a: beq 1f80
+    if (Z)
+        AOT_GOTO(0x1f80, L1f80);
+    AOT_GOTO(0x1f7c, L1f7c);
+L1f7c:
+    AOT_BLOCK(0x1f7c, 2);
+    // 1f7c: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1f7e: sob r1, 4
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x1f78, L1f78);
+    AOT_GOTO(0x1f80, L1f80);
+L1f80:
+    AOT_BLOCK(0x1f80, 2);
+    // 1f80: mov (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f82: br 1fb6
+    AOT_GOTO(0x1fb6, L1fb6);
+L1f84:
+    AOT_BLOCK(0x1f84, 3);
+    // 1f84: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1f88: mov -e(r5), r2
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f8c: jsr pc, 2018
+    {
+        a = 0x2018;
+        r[6] -= 2;
+        WR16(r[6], 0x1f90);
+    }
+    AOT_GOTO(0x2018, L2018);
+L1f90:
+    AOT_BLOCK(0x1f90, 1);
+    // 1f90: br 1fb4
+    AOT_GOTO(0x1fb4, L1fb4);
+L1f92:
+    AOT_BLOCK(0x1f92, 4);
+    // 1f92: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1f96: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 1f98: tst -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1f9c: bne 1fa2
+    if (!Z)
+        AOT_GOTO(0x1fa2, L1fa2);
+    AOT_GOTO(0x1f9e, L1f9e);
+L1f9e:
+    AOT_BLOCK(0x1f9e, 1);
+    // 1f9e: mov $7, r0
+    {
+        src = uint16_t(0x0007);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1fa2, L1fa2);
+L1fa2:
+    AOT_BLOCK(0x1fa2, 2);
+    // 1fa2: mov pc, r2
+    {
+        src = uint16_t(0x1fa4);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fa4: jsr pc, 2018
+    {
+        a = 0x2018;
+        r[6] -= 2;
+        WR16(r[6], 0x1fa8);
+    }
+    AOT_GOTO(0x2018, L2018);
+L1fa8:
+    AOT_BLOCK(0x1fa8, 1);
+    // 1fa8: br 1fb4
+    AOT_GOTO(0x1fb4, L1fb4);
+L1faa:
+    AOT_BLOCK(0x1faa, 3);
+    // 1faa: mov (r4)+, r4
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1fac: mov (r4)+, -a(r5)
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fb0: jmp 1dde
+    {
+        a = 0x1dde;
+    }
+    AOT_GOTO(0x1dde, L1dde);
+L1fb4:
+    AOT_BLOCK(0x1fb4, 1);
+    // 1fb4: mov sp, r2
+    {
+        src = r[6];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1fb6, L1fb6);
+L1fb6:
+    AOT_BLOCK(0x1fb6, 4);
+    // 1fb6: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 1fb8: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1fbc: sub r3, r1
+    {
+        src = r[3];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 1fbe: bge 1fc2
+    if (!(N ^ V))
+        AOT_GOTO(0x1fc2, L1fc2);
+    AOT_GOTO(0x1fc0, L1fc0);
+L1fc0:
+    AOT_BLOCK(0x1fc0, 1);
+    // 1fc0: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1fc2, L1fc2);
+L1fc2:
+    AOT_BLOCK(0x1fc2, 2);
+    // 1fc2: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1fc6: bne 1fca
+    if (!Z)
+        AOT_GOTO(0x1fca, L1fca);
+    AOT_GOTO(0x1fc8, L1fc8);
+L1fc8:
+    AOT_BLOCK(0x1fc8, 1);
+    // 1fc8: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1fca, L1fca);
+L1fca:
+    AOT_BLOCK(0x1fca, 6);
+    // 1fca: mov -12(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1fce: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1fd2: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1fd4: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1fd6: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fd8: jsr pc, 2022
+    {
+        a = 0x2022;
+        r[6] -= 2;
+        WR16(r[6], 0x1fdc);
+    }
+    AOT_GOTO(0x2022, L2022);
+L1fdc:
+    AOT_BLOCK(0x1fdc, 2);
+    // 1fdc: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1fe0: jmp 1dde
+    {
+        a = 0x1dde;
+    }
+    AOT_GOTO(0x1dde, L1dde);
+L1fe4:
+    AOT_BLOCK(0x1fe4, 2);
+    // 1fe4: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+    }
+    // 1fe8: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1fea, L1fea);
+L1fea:
+    AOT_BLOCK(0x1fea, 5);
+    // 1fea: movb *-a(r5), r0
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1fee: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1ff2: sub $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1ff6: cmp r0, $fffa
+    {
+        src = r[0];
+        dst = uint16_t(0xfffa);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ffa: bne 2000
+    if (!Z)
+        AOT_GOTO(0x2000, L2000);
+    AOT_GOTO(0x1ffc, L1ffc);
+L1ffc:
+    AOT_BLOCK(0x1ffc, 2);
+    // 1ffc: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ffe: br 2006
+    AOT_GOTO(0x2006, L2006);
+L2000:
+    AOT_BLOCK(0x2000, 2);
+    // 2000: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2004: bhi 2012
+    if (!(C | Z))
+        AOT_GOTO(0x2012, L2012);
+    AOT_GOTO(0x2006, L2006);
+L2006:
+    AOT_BLOCK(0x2006, 4);
+    // 2006: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 200a: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 200e: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2010: br 1fea
+    AOT_GOTO(0x1fea, L1fea);
+L2012:
+    AOT_BLOCK(0x2012, 2);
+    // 2012: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2016: rts r3
+    {
+        b = r[3];
+        r[3] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2018:
+    AOT_BLOCK(0x2018, 3);
+    // 2018: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 201c: movb $3f, (r3)+
+    {
+        src = uint8_t(0x3f);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 2020: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2022:
+    AOT_BLOCK(0x2022, 4);
+    // 2022: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2026;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 2026: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 202a: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x202e, L202e);
+L202e:
+    AOT_BLOCK(0x202e, 2);
+    // 202e: mov a(r5), r2
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2032: br 2066
+    AOT_GOTO(0x2066, L2066);
+L2034:
+    AOT_BLOCK(0x2034, 3);
+    // 2034: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2036: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2038: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x203a, L203a);
+L203a:
+    AOT_BLOCK(0x203a, 2);
+    // 203a: bic $ff00, (sp)
+    {
+        src = uint16_t(0xff00);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 203e: jsr pc, *$20e2
+    {
+        a = 0x20e2;
+        r[6] -= 2;
+        WR16(r[6], 0x2042);
+    }
+    AOT_GOTO(0x20e2, L20e2);
+L2042:
+    AOT_BLOCK(0x2042, 1);
+    // 2042: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2044, L2044);
+L2044:
+    AOT_BLOCK(0x2044, 1);
+    // 2044: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x2046, L2046);
+L2046:
+    AOT_BLOCK(0x2046, 2);
+    // 2046: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 204a: blt 2056
+    if (N ^ V)
+        AOT_GOTO(0x2056, L2056);
+    AOT_GOTO(0x204c, L204c);
+L204c:
+    AOT_BLOCK(0x204c, 3);
+    // 204c: movb c(r5), *0(r2)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD8(a);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 2052: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 2054: br 2062
+    AOT_GOTO(0x2062, L2062);
+L2056:
+    AOT_BLOCK(0x2056, 3);
+    // 2056: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2058: mov c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 205c: jsr pc, *$20e2
+    {
+        a = 0x20e2;
+        r[6] -= 2;
+        WR16(r[6], 0x2060);
+    }
+    AOT_GOTO(0x20e2, L20e2);
+L2060:
+    AOT_BLOCK(0x2060, 1);
+    // 2060: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2062, L2062);
+L2062:
+    AOT_BLOCK(0x2062, 1);
+    // 2062: inc 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x2066, L2066);
+L2066:
+    AOT_BLOCK(0x2066, 2);
+    // 2066: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 206a: bge 20b2
+    if (!(N ^ V))
+        AOT_GOTO(0x20b2, L20b2);
+    AOT_GOTO(0x206c, L206c);
+L206c:
+    AOT_BLOCK(0x206c, 2);
+    // 206c: cmpb $2d, (r4)
+    {
+        src = uint8_t(0x2d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2070: bne 2046
+    if (!Z)
+        AOT_GOTO(0x2046, L2046);
+    AOT_GOTO(0x2072, L2072);
+L2072:
+    AOT_BLOCK(0x2072, 2);
+    // 2072: cmp $30, c(r5)
+    {
+        src = uint16_t(0x0030);
+        b = uint16_t(r[5] + 12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2078: bne 2046
+    if (!Z)
+        AOT_GOTO(0x2046, L2046);
+    AOT_GOTO(0x207a, L207a);
+L207a:
+    AOT_BLOCK(0x207a, 2);
+    // 207a: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 207e: blt 2034
+    if (N ^ V)
+        AOT_GOTO(0x2034, L2034);
+    AOT_GOTO(0x2080, L2080);
+L2080:
+    AOT_BLOCK(0x2080, 5);
+    // 2080: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2082: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2086: movb r0, *0(r2)
+    {
+        src = uint8_t(r[0]);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 208a: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 208c: br 2044
+    AOT_GOTO(0x2044, L2044);
+L208e:
+    AOT_BLOCK(0x208e, 5);
+    // 208e: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2090: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2094: movb r0, *0(r2)
+    {
+        src = uint8_t(r[0]);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 2098: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 209a: br 20b2
+    AOT_GOTO(0x20b2, L20b2);
+L209c:
+    AOT_BLOCK(0x209c, 2);
+    // 209c: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 20a0: bge 208e
+    if (!(N ^ V))
+        AOT_GOTO(0x208e, L208e);
+    AOT_GOTO(0x20a2, L20a2);
+L20a2:
+    AOT_BLOCK(0x20a2, 5);
+    // 20a2: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 20a4: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 20a6: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 20a8: bic $ff00, (sp)
+    {
+        src = uint16_t(0xff00);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 20ac: jsr pc, *$20e2
+    {
+        a = 0x20e2;
+        r[6] -= 2;
+        WR16(r[6], 0x20b0);
+    }
+    AOT_GOTO(0x20e2, L20e2);
+L20b0:
+    AOT_BLOCK(0x20b0, 1);
+    // 20b0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x20b2, L20b2);
+L20b2:
+    AOT_BLOCK(0x20b2, 2);
+    // 20b2: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 20b4: bge 209c
+    if (!(N ^ V))
+        AOT_GOTO(0x209c, L209c);
+    AOT_GOTO(0x20b6, L20b6);
+L20b6:
+    AOT_BLOCK(0x20b6, 1);
+    // 20b6: br 20d8
+    AOT_GOTO(0x20d8, L20d8);
+L20b8:
+    AOT_BLOCK(0x20b8, 2);
+    // 20b8: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 20bc: blt 20c8
+    if (N ^ V)
+        AOT_GOTO(0x20c8, L20c8);
+    AOT_GOTO(0x20be, L20be);
+L20be:
+    AOT_BLOCK(0x20be, 3);
+    // 20be: movb c(r5), *0(r2)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD8(a);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 20c4: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 20c6: br 20d4
+    AOT_GOTO(0x20d4, L20d4);
+L20c8:
+    AOT_BLOCK(0x20c8, 3);
+    // 20c8: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 20ca: mov c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20ce: jsr pc, *$20e2
+    {
+        a = 0x20e2;
+        r[6] -= 2;
+        WR16(r[6], 0x20d2);
+    }
+    AOT_GOTO(0x20e2, L20e2);
+L20d2:
+    AOT_BLOCK(0x20d2, 1);
+    // 20d2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x20d4, L20d4);
+L20d4:
+    AOT_BLOCK(0x20d4, 1);
+    // 20d4: dec 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x20d8, L20d8);
+L20d8:
+    AOT_BLOCK(0x20d8, 2);
+    // 20d8: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 20dc: bne 20b8
+    if (!Z)
+        AOT_GOTO(0x20b8, L20b8);
+    AOT_GOTO(0x20de, L20de);
+L20de:
+    AOT_BLOCK(0x20de, 2);
+    // 20de: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L20e2:
+    AOT_BLOCK(0x20e2, 6);
+    // 20e2: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x20e6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 20e6: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 20ea: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 20ee: bitb $80, 6(r4)
+    {
+        src = uint8_t(0x80);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 20f4: beq 2102
+    if (Z)
+        AOT_GOTO(0x2102, L2102);
+    AOT_GOTO(0x20f6, L20f6);
+L20f6:
+    AOT_BLOCK(0x20f6, 2);
+    // 20f6: bisb $2, 6(r4)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 20fc: bicb $10, 6(r4)
+    {
+        src = uint8_t(0x10);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2102, L2102);
+L2102:
+    AOT_BLOCK(0x2102, 2);
+    // 2102: bitb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2108: beq 2134
+    if (Z)
+        AOT_GOTO(0x2134, L2134);
+    AOT_GOTO(0x210a, L210a);
+L210a:
+    AOT_BLOCK(0x210a, 8);
+    // 210a: movb 4(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = uint16_t(r[5] + -10);
+        WR8(b, src);
+    }
+    // 2110: mov $1, -8(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 2116: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 211a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 211c: add $fff6, (sp)
+    {
+        src = uint16_t(0xfff6);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2120: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2124: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2126: jsr pc, *$274a
+    {
+        a = 0x274a;
+        r[6] -= 2;
+        WR16(r[6], 0x212a);
+    }
+    AOT_GOTO(0x274a, L274a);
+L212a:
+    AOT_BLOCK(0x212a, 4);
+    // 212a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 212c: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 212e: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2132: br 21aa
+    AOT_GOTO(0x21aa, L21aa);
+L2134:
+    AOT_BLOCK(0x2134, 2);
+    // 2134: mov 4(r4), r3
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2138: bne 2180
+    if (!Z)
+        AOT_GOTO(0x2180, L2180);
+    AOT_GOTO(0x213a, L213a);
+L213a:
+    AOT_BLOCK(0x213a, 2);
+    // 213a: cmp $4d8, r4
+    {
+        src = uint16_t(0x04d8);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 213e: bne 2162
+    if (!Z)
+        AOT_GOTO(0x2162, L2162);
+    AOT_GOTO(0x2140, L2140);
+L2140:
+    AOT_BLOCK(0x2140, 3);
+    // 2140: movb 04df, r0
+    {
+        a = 0x04df;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2144: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2146: jsr pc, *$25c6
+    {
+        a = 0x25c6;
+        r[6] -= 2;
+        WR16(r[6], 0x214a);
+    }
+    AOT_GOTO(0x25c6, L25c6);
+L214a:
+    AOT_BLOCK(0x214a, 2);
+    // 214a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 214c: beq 2156
+    if (Z)
+        AOT_GOTO(0x2156, L2156);
+    AOT_GOTO(0x214e, L214e);
+L214e:
+    AOT_BLOCK(0x214e, 2);
+    // 214e: bisb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2154: br 2102
+    AOT_GOTO(0x2102, L2102);
+L2156:
+    AOT_BLOCK(0x2156, 3);
+    // 2156: mov $978, 4(r4)
+    {
+        src = uint16_t(0x0978);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 215c: mov $978, (r4)
+    {
+        src = uint16_t(0x0978);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2160: br 2102
+    AOT_GOTO(0x2102, L2102);
+L2162:
+    AOT_BLOCK(0x2162, 2);
+    // 2162: mov $200, (sp)
+    {
+        src = uint16_t(0x0200);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2166: jsr pc, *$23c4
+    {
+        a = 0x23c4;
+        r[6] -= 2;
+        WR16(r[6], 0x216a);
+    }
+    AOT_GOTO(0x23c4, L23c4);
+L216a:
+    AOT_BLOCK(0x216a, 3);
+    // 216a: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 216c: mov r3, 4(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2170: beq 214e
+    if (Z)
+        AOT_GOTO(0x214e, L214e);
+    AOT_GOTO(0x2172, L2172);
+L2172:
+    AOT_BLOCK(0x2172, 4);
+    // 2172: bisb $8, 6(r4)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 2178: clr r2
+    {
+        r[2] = 0;
+        C = false;
+    }
+    // 217a: mov r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 217e: br 219e
+    AOT_GOTO(0x219e, L219e);
+L2180:
+    AOT_BLOCK(0x2180, 4);
+    // 2180: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 2182: sub r3, r2
+    {
+        src = r[3];
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+        C = dst < src;
+    }
+    // 2184: mov r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2188: ble 219e
+    if (Z || (N ^ V))
+        AOT_GOTO(0x219e, L219e);
+    AOT_GOTO(0x218a, L218a);
+L218a:
+    AOT_BLOCK(0x218a, 6);
+    // 218a: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 218c: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 218e: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2190: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2194: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2196: jsr pc, *$274a
+    {
+        a = 0x274a;
+        r[6] -= 2;
+        WR16(r[6], 0x219a);
+    }
+    AOT_GOTO(0x274a, L274a);
+L219a:
+    AOT_BLOCK(0x219a, 2);
+    // 219a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 219c: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x219e, L219e);
+L219e:
+    AOT_BLOCK(0x219e, 3);
+    // 219e: mov $1ff, 2(r4)
+    {
+        src = uint16_t(0x01ff);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 21a4: movb 4(r5), (r3)+
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 21a8: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x21aa, L21aa);
+L21aa:
+    AOT_BLOCK(0x21aa, 2);
+    // 21aa: cmp r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 21ae: beq 21be
+    if (Z)
+        AOT_GOTO(0x21be, L21be);
+    AOT_GOTO(0x21b0, L21b0);
+L21b0:
+    AOT_BLOCK(0x21b0, 2);
+    // 21b0: bisb $20, 6(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 21b6: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x21ba, L21ba);
+L21ba:
+    AOT_BLOCK(0x21ba, 2);
+    // 21ba: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L21be:
+    AOT_BLOCK(0x21be, 2);
+    // 21be: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21c2: br 21ba
+    AOT_GOTO(0x21ba, L21ba);
+L21c4:
+    AOT_BLOCK(0x21c4, 7);
+    // 21c4: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x21c8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 21c8: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 21cc: movb 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 21d0: bic $fff9, r0
+    {
+        src = uint16_t(0xfff9);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 21d4: cmp $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 21d8: bne 2212
+    if (!Z)
+        AOT_GOTO(0x2212, L2212);
+    AOT_GOTO(0x21da, L21da);
+L21da:
+    AOT_BLOCK(0x21da, 2);
+    // 21da: mov 4(r4), r3
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21de: beq 2212
+    if (Z)
+        AOT_GOTO(0x2212, L2212);
+    AOT_GOTO(0x21e0, L21e0);
+L21e0:
+    AOT_BLOCK(0x21e0, 4);
+    // 21e0: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 21e2: sub r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 21e4: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21e6: ble 2212
+    if (Z || (N ^ V))
+        AOT_GOTO(0x2212, L2212);
+    AOT_GOTO(0x21e8, L21e8);
+L21e8:
+    AOT_BLOCK(0x21e8, 7);
+    // 21e8: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 21ea: mov $200, 2(r4)
+    {
+        src = uint16_t(0x0200);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 21f0: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 21f2: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 21f4: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 21f8: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21fa: jsr pc, *$274a
+    {
+        a = 0x274a;
+        r[6] -= 2;
+        WR16(r[6], 0x21fe);
+    }
+    AOT_GOTO(0x274a, L274a);
+L21fe:
+    AOT_BLOCK(0x21fe, 3);
+    // 21fe: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 2200: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2202: beq 2212
+    if (Z)
+        AOT_GOTO(0x2212, L2212);
+    AOT_GOTO(0x2204, L2204);
+L2204:
+    AOT_BLOCK(0x2204, 2);
+    // 2204: bisb $20, 6(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 220a: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x220e, L220e);
+L220e:
+    AOT_BLOCK(0x220e, 2);
+    // 220e: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2212:
+    AOT_BLOCK(0x2212, 2);
+    // 2212: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2214: br 220e
+    AOT_GOTO(0x220e, L220e);
+L2216:
+    AOT_BLOCK(0x2216, 4);
+    // 2216: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x221a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 221a: mov $4d0, r4
+    {
+        src = uint16_t(0x04d0);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 221e: br 222a
+    AOT_GOTO(0x222a, L222a);
+L2220:
+    AOT_BLOCK(0x2220, 2);
+    // 2220: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2222: jsr pc, *$2234
+    {
+        a = 0x2234;
+        r[6] -= 2;
+        WR16(r[6], 0x2226);
+    }
+    AOT_GOTO(0x2234, L2234);
+L2226:
+    AOT_BLOCK(0x2226, 1);
+    // 2226: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x222a, L222a);
+L222a:
+    AOT_BLOCK(0x222a, 2);
+    // 222a: cmp 0570, r4
+    {
+        a = 0x0570;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 222e: bhi 2220
+    if (!(C | Z))
+        AOT_GOTO(0x2220, L2220);
+    AOT_GOTO(0x2230, L2230);
+L2230:
+    AOT_BLOCK(0x2230, 2);
+    // 2230: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2234:
+    AOT_BLOCK(0x2234, 6);
+    // 2234: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2238;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 2238: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 223c: mov $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        r[3] = src;
+    }
+    // 2240: bitb $83, 6(r4)
+    {
+        src = uint8_t(0x83);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2246: beq 2286
+    if (Z)
+        AOT_GOTO(0x2286, L2286);
+    AOT_GOTO(0x2248, L2248);
+L2248:
+    AOT_BLOCK(0x2248, 2);
+    // 2248: bitb $40, 6(r4)
+    {
+        src = uint8_t(0x40);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 224e: bne 2286
+    if (!Z)
+        AOT_GOTO(0x2286, L2286);
+    AOT_GOTO(0x2250, L2250);
+L2250:
+    AOT_BLOCK(0x2250, 2);
+    // 2250: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2252: jsr pc, *$21c4
+    {
+        a = 0x21c4;
+        r[6] -= 2;
+        WR16(r[6], 0x2256);
+    }
+    AOT_GOTO(0x21c4, L21c4);
+L2256:
+    AOT_BLOCK(0x2256, 4);
+    // 2256: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2258: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 225c: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 225e: jsr pc, *$263a
+    {
+        a = 0x263a;
+        r[6] -= 2;
+        WR16(r[6], 0x2262);
+    }
+    AOT_GOTO(0x263a, L263a);
+L2262:
+    AOT_BLOCK(0x2262, 2);
+    // 2262: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2264: bge 226a
+    if (!(N ^ V))
+        AOT_GOTO(0x226a, L226a);
+    AOT_GOTO(0x2266, L2266);
+L2266:
+    AOT_BLOCK(0x2266, 1);
+    // 2266: mov $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x226a, L226a);
+L226a:
+    AOT_BLOCK(0x226a, 2);
+    // 226a: bitb $8, 6(r4)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2270: beq 227a
+    if (Z)
+        AOT_GOTO(0x227a, L227a);
+    AOT_GOTO(0x2272, L2272);
+L2272:
+    AOT_BLOCK(0x2272, 2);
+    // 2272: mov 4(r4), (sp)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2276: jsr pc, *$24fe
+    {
+        a = 0x24fe;
+        r[6] -= 2;
+        WR16(r[6], 0x227a);
+    }
+    AOT_GOTO(0x24fe, L24fe);
+L227a:
+    AOT_BLOCK(0x227a, 2);
+    // 227a: bitb $c, 6(r4)
+    {
+        src = uint8_t(0x0c);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2280: beq 2286
+    if (Z)
+        AOT_GOTO(0x2286, L2286);
+    AOT_GOTO(0x2282, L2282);
+L2282:
+    AOT_BLOCK(0x2282, 1);
+    // 2282: clr 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2286, L2286);
+L2286:
+    AOT_BLOCK(0x2286, 5);
+    // 2286: bicb $ff, 6(r4)
+    {
+        src = uint8_t(0xff);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+    }
+    // 228c: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        C = false;
+    }
+    // 2290: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 2292: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2296:
+    AOT_BLOCK(0x2296, 5);
+    // 2296: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x229a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 229a: mov 8(r5), r4
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 229e: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 22a0: bne 22c0
+    if (!Z)
+        AOT_GOTO(0x22c0, L22c0);
+    AOT_GOTO(0x22a2, L22a2);
+L22a2:
+    AOT_BLOCK(0x22a2, 1);
+    // 22a2: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x22a4, L22a4);
+L22a4:
+    AOT_BLOCK(0x22a4, 2);
+    // 22a4: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L22a8:
+    AOT_BLOCK(0x22a8, 2);
+    // 22a8: cmp r0, $72
+    {
+        src = r[0];
+        dst = uint16_t(0x0072);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 22ac: beq 2326
+    if (Z)
+        AOT_GOTO(0x2326, L2326);
+    AOT_GOTO(0x22ae, L22ae);
+L22ae:
+    AOT_BLOCK(0x22ae, 2);
+    // 22ae: cmp r0, $77
+    {
+        src = r[0];
+        dst = uint16_t(0x0077);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 22b2: bne 22a2
+    if (!Z)
+        AOT_GOTO(0x22a2, L22a2);
+    AOT_GOTO(0x22b4, L22b4);
+L22b4:
+    AOT_BLOCK(0x22b4, 3);
+    // 22b4: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 22b6: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22ba: jsr pc, *$2370
+    {
+        a = 0x2370;
+        r[6] -= 2;
+        WR16(r[6], 0x22be);
+    }
+    AOT_GOTO(0x2370, L2370);
+L22be:
+    AOT_BLOCK(0x22be, 1);
+    // 22be: br 233a
+    AOT_GOTO(0x233a, L233a);
+L22c0:
+    AOT_BLOCK(0x22c0, 3);
+    // 22c0: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 22c4: cmpb $2b, 1(r0)
+    {
+        src = uint8_t(0x2b);
+        b = uint16_t(r[0] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 22ca: beq 22d0
+    if (Z)
+        AOT_GOTO(0x22d0, L22d0);
+    AOT_GOTO(0x22cc, L22cc);
+L22cc:
+    AOT_BLOCK(0x22cc, 2);
+    // 22cc: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 22ce: br 22d4
+    AOT_GOTO(0x22d4, L22d4);
+L22d0:
+    AOT_BLOCK(0x22d0, 1);
+    // 22d0: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x22d4, L22d4);
+L22d4:
+    AOT_BLOCK(0x22d4, 4);
+    // 22d4: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 22d6: movb *6(r5), r0
+    {
+        a = RD16(r[5] + 6);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 22da: cmp r0, $61
+    {
+        src = r[0];
+        dst = uint16_t(0x0061);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 22de: bne 22a8
+    if (!Z)
+        AOT_GOTO(0x22a8, L22a8);
+    AOT_GOTO(0x22e0, L22e0);
+L22e0:
+    AOT_BLOCK(0x22e0, 2);
+    // 22e0: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 22e2: beq 22ea
+    if (Z)
+        AOT_GOTO(0x22ea, L22ea);
+    AOT_GOTO(0x22e4, L22e4);
+L22e4:
+    AOT_BLOCK(0x22e4, 2);
+    // 22e4: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22e8: br 22ee
+    AOT_GOTO(0x22ee, L22ee);
+L22ea:
+    AOT_BLOCK(0x22ea, 1);
+    // 22ea: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x22ee, L22ee);
+L22ee:
+    AOT_BLOCK(0x22ee, 2);
+    // 22ee: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22f2: jsr pc, *$26c0
+    {
+        a = 0x26c0;
+        r[6] -= 2;
+        WR16(r[6], 0x22f6);
+    }
+    AOT_GOTO(0x26c0, L26c0);
+L22f6:
+    AOT_BLOCK(0x22f6, 3);
+    // 22f6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 22f8: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22fa: bge 2312
+    if (!(N ^ V))
+        AOT_GOTO(0x2312, L2312);
+    AOT_GOTO(0x22fc, L22fc);
+L22fc:
+    AOT_BLOCK(0x22fc, 2);
+    // 22fc: cmp $2, 0b78
+    {
+        src = uint16_t(0x0002);
+        b = 0x0b78;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2302: bne 2312
+    if (!Z)
+        AOT_GOTO(0x2312, L2312);
+    AOT_GOTO(0x2304, L2304);
+L2304:
+    AOT_BLOCK(0x2304, 3);
+    // 2304: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2306: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 230a: jsr pc, *$2370
+    {
+        a = 0x2370;
+        r[6] -= 2;
+        WR16(r[6], 0x230e);
+    }
+    AOT_GOTO(0x2370, L2370);
+L230e:
+    AOT_BLOCK(0x230e, 2);
+    // 230e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2310: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2312, L2312);
+L2312:
+    AOT_BLOCK(0x2312, 5);
+    // 2312: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2316: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        N = false;
+        C = false;
+    }
+    // 2318: sxt -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, -int(N));
+    }
+    // 231a: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 231c: jsr pc, *$2694
+    {
+        a = 0x2694;
+        r[6] -= 2;
+        WR16(r[6], 0x2320);
+    }
+    AOT_GOTO(0x2694, L2694);
+L2320:
+    AOT_BLOCK(0x2320, 2);
+    // 2320: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2324: br 233e
+    AOT_GOTO(0x233e, L233e);
+L2326:
+    AOT_BLOCK(0x2326, 2);
+    // 2326: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2328: beq 2330
+    if (Z)
+        AOT_GOTO(0x2330, L2330);
+    AOT_GOTO(0x232a, L232a);
+L232a:
+    AOT_BLOCK(0x232a, 2);
+    // 232a: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 232e: br 2332
+    AOT_GOTO(0x2332, L2332);
+L2330:
+    AOT_BLOCK(0x2330, 1);
+    // 2330: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2332, L2332);
+L2332:
+    AOT_BLOCK(0x2332, 2);
+    // 2332: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2336: jsr pc, *$26c0
+    {
+        a = 0x26c0;
+        r[6] -= 2;
+        WR16(r[6], 0x233a);
+    }
+    AOT_GOTO(0x26c0, L26c0);
+L2338:
+    AOT_BLOCK(0x2338, 1);
+    // 2338: cmp *(r3)+, r0
+    {
+        a = RD16(r[3]);
+        r[3] += 2;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x233a, L233a);
+L233a:
+    AOT_BLOCK(0x233a, 2);
+    // 233a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 233c: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x233e, L233e);
+L233e:
+    AOT_BLOCK(0x233e, 2);
+    // 233e: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2340: blt 22a2
+    if (N ^ V)
+        AOT_GOTO(0x22a2, L22a2);
+    AOT_GOTO(0x2342, L2342);
+L2342:
+    AOT_BLOCK(0x2342, 4);
+    // 2342: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+    }
+    // 2346: movb r2, 7(r4)
+    {
+        src = uint8_t(r[2]);
+        b = uint16_t(r[4] + 7);
+        WR8(b, src);
+    }
+    // 234a: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 234c: beq 2356
+    if (Z)
+        AOT_GOTO(0x2356, L2356);
+    AOT_GOTO(0x234e, L234e);
+L234e:
+    AOT_BLOCK(0x234e, 2);
+    // 234e: bisb $80, 6(r4)
+    {
+        src = uint8_t(0x80);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2354: br 236c
+    AOT_GOTO(0x236c, L236c);
+L2356:
+    AOT_BLOCK(0x2356, 2);
+    // 2356: cmpb $72, *6(r5)
+    {
+        src = uint8_t(0x72);
+        b = RD16(r[5] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 235c: bne 2366
+    if (!Z)
+        AOT_GOTO(0x2366, L2366);
+    AOT_GOTO(0x235e, L235e);
+L235e:
+    AOT_BLOCK(0x235e, 2);
+    // 235e: bisb $1, 6(r4)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2364: br 236c
+    AOT_GOTO(0x236c, L236c);
+L2366:
+    AOT_BLOCK(0x2366, 1);
+    // 2366: bisb $2, 6(r4)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x236c, L236c);
+L236c:
+    AOT_BLOCK(0x236c, 2);
+    // 236c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 236e: br 22a4
+    AOT_GOTO(0x22a4, L22a4);
+L2370:
+    AOT_BLOCK(0x2370, 6);
+    // 2370: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2374;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 2374: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2378: mov $1b6, (sp)
+    {
+        src = uint16_t(0x01b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 237c: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 237e: jsr pc, *$2650
+    {
+        a = 0x2650;
+        r[6] -= 2;
+        WR16(r[6], 0x2382);
+    }
+    AOT_GOTO(0x2650, L2650);
+L2382:
+    AOT_BLOCK(0x2382, 4);
+    // 2382: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 2384: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2386: tst 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 238a: beq 23a4
+    if (Z)
+        AOT_GOTO(0x23a4, L23a4);
+    AOT_GOTO(0x238c, L238c);
+L238c:
+    AOT_BLOCK(0x238c, 2);
+    // 238c: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 238e: blt 23a4
+    if (N ^ V)
+        AOT_GOTO(0x23a4, L23a4);
+    AOT_GOTO(0x2390, L2390);
+L2390:
+    AOT_BLOCK(0x2390, 2);
+    // 2390: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2392: jsr pc, *$263a
+    {
+        a = 0x263a;
+        r[6] -= 2;
+        WR16(r[6], 0x2396);
+    }
+    AOT_GOTO(0x263a, L263a);
+L2396:
+    AOT_BLOCK(0x2396, 3);
+    // 2396: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 239a: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 239c: jsr pc, *$26c0
+    {
+        a = 0x26c0;
+        r[6] -= 2;
+        WR16(r[6], 0x23a0);
+    }
+    AOT_GOTO(0x26c0, L26c0);
+L23a0:
+    AOT_BLOCK(0x23a0, 2);
+    // 23a0: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 23a2: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x23a4, L23a4);
+L23a4:
+    AOT_BLOCK(0x23a4, 3);
+    // 23a4: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 23a6: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L23aa:
+    AOT_BLOCK(0x23aa, 3);
+    // 23aa: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 23ac: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23ae: jsr pc, 2216
+    {
+        a = 0x2216;
+        r[6] -= 2;
+        WR16(r[6], 0x23b2);
+    }
+    AOT_GOTO(0x2216, L2216);
+L23b2:
+    AOT_BLOCK(0x23b2, 1);
+    // 23b2: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 23b6: sys 1
+    AOT_INTERP(0x23b6);
+L23b8:
+    AOT_BLOCK(0x23b8, 2);
+    // 23b8: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x23bc;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    AOT_GOTO(0x23bc, L23bc);
+L23ba:
+    AOT_BLOCK(0x23ba, 1);
+    // 23ba: beq 2338
+    if (Z)
+        AOT_GOTO(0x2338, L2338);
+    AOT_GOTO(0x23bc, L23bc);
+L23bc:
+    // 23bc: iot
+    AOT_INTERP(0x23bc);
+L23be:
+    AOT_BLOCK(0x23be, 1);
+    // 23be: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x23c0, L23c0);
+L23c0:
+    AOT_BLOCK(0x23c0, 2);
+    // 23c0: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L23c4:
+    AOT_BLOCK(0x23c4, 4);
+    // 23c4: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x23c8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 23c8: tst 0f12
+    {
+        a = 0x0f12;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 23cc: bne 23f2
+    if (!Z)
+        AOT_GOTO(0x23f2, L23f2);
+    AOT_GOTO(0x23ce, L23ce);
+L23ce:
+    AOT_BLOCK(0x23ce, 8);
+    // 23ce: mov $f14, r0
+    {
+        src = uint16_t(0x0f14);
+        r[0] = src;
+    }
+    // 23d2: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 23d6: mov r0, 0f12
+    {
+        src = r[0];
+        b = 0x0f12;
+        WR16(b, src);
+    }
+    // 23da: mov $f12, r0
+    {
+        src = uint16_t(0x0f12);
+        r[0] = src;
+    }
+    // 23de: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 23e2: mov r0, 0f14
+    {
+        src = r[0];
+        b = 0x0f14;
+        WR16(b, src);
+    }
+    // 23e6: mov $f14, 0f18
+    {
+        src = uint16_t(0x0f14);
+        b = 0x0f18;
+        WR16(b, src);
+    }
+    // 23ec: mov $f12, 0f16
+    {
+        src = uint16_t(0x0f12);
+        b = 0x0f16;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x23f2, L23f2);
+L23f2:
+    AOT_BLOCK(0x23f2, 4);
+    // 23f2: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 23f6: add $3, r1
+    {
+        src = uint16_t(0x0003);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 23fa: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 23fc: ashc $ffff, r0
+    {
+        src = uint16_t(0xffff) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    AOT_GOTO(0x2400, L2400);
+L2400:
+    AOT_BLOCK(0x2400, 2);
+    // 2400: mov r1, r2
+    {
+        src = r[1];
+        r[2] = src;
+    }
+    // 2402: mov 0f16, r4
+    {
+        a = 0x0f16;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2406, L2406);
+L2406:
+    AOT_BLOCK(0x2406, 1);
+    // 2406: clr 0f1c
+    {
+        a = 0x0f1c;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x240a, L240a);
+L240a:
+    AOT_BLOCK(0x240a, 2);
+    // 240a: bit $1, (r4)
+    {
+        src = uint16_t(0x0001);
+        b = r[4];
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 240e: beq 2414
+    if (Z)
+        AOT_GOTO(0x2414, L2414);
+    AOT_GOTO(0x2410, L2410);
+L2410:
+    AOT_BLOCK(0x2410, 1);
+    // 2410: br 2430
+    AOT_GOTO(0x2430, L2430);
+L2412:
+    AOT_BLOCK(0x2412, 1);
+    // 2412: mov (r3), (r4)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2414, L2414);
+L2414:
+    AOT_BLOCK(0x2414, 3);
+    // 2414: mov (r4), r3
+    {
+        a = r[4];
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 2416: bit $1, (r3)
+    {
+        src = uint16_t(0x0001);
+        b = r[3];
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 241a: beq 2412
+    if (Z)
+        AOT_GOTO(0x2412, L2412);
+    AOT_GOTO(0x241c, L241c);
+L241c:
+    AOT_BLOCK(0x241c, 5);
+    // 241c: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 241e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2420: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2422: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2424: bcs 2430
+    if (C)
+        AOT_GOTO(0x2430, L2430);
+    AOT_GOTO(0x2426, L2426);
+L2426:
+    AOT_BLOCK(0x2426, 5);
+    // 2426: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 2428: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 242a: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 242c: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 242e: blos 24d4
+    if (C | Z)
+        AOT_GOTO(0x24d4, L24d4);
+    AOT_GOTO(0x2430, L2430);
+L2430:
+    AOT_BLOCK(0x2430, 5);
+    // 2430: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 2432: mov (r4), r4
+    {
+        a = r[4];
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2434: bic $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 2438: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 243a: bcs 240a
+    if (C)
+        AOT_GOTO(0x240a, L240a);
+    AOT_GOTO(0x243c, L243c);
+L243c:
+    AOT_BLOCK(0x243c, 2);
+    // 243c: cmp 0f18, r3
+    {
+        a = 0x0f18;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2440: bne 2448
+    if (!Z)
+        AOT_GOTO(0x2448, L2448);
+    AOT_GOTO(0x2442, L2442);
+L2442:
+    AOT_BLOCK(0x2442, 2);
+    // 2442: cmp $f12, r4
+    {
+        src = uint16_t(0x0f12);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2446: beq 244e
+    if (Z)
+        AOT_GOTO(0x244e, L244e);
+    AOT_GOTO(0x2448, L2448);
+L2448:
+    AOT_BLOCK(0x2448, 1);
+    // 2448: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x244a, L244a);
+L244a:
+    AOT_BLOCK(0x244a, 2);
+    // 244a: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L244e:
+    AOT_BLOCK(0x244e, 3);
+    // 244e: inc 0f1c
+    {
+        a = 0x0f1c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 2452: cmp $1, 0f1c
+    {
+        src = uint16_t(0x0001);
+        b = 0x0f1c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2458: bge 240a
+    if (!(N ^ V))
+        AOT_GOTO(0x240a, L240a);
+    AOT_GOTO(0x245a, L245a);
+L245a:
+    AOT_BLOCK(0x245a, 8);
+    // 245a: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 245c: add $200, r1
+    {
+        src = uint16_t(0x0200);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        N = val16 < 0;
+    }
+    // 2460: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 2462: div $200, r0
+    {
+        src = int16_t(uint16_t(0x0200));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2466: ash $9, r0
+    {
+        src = uint16_t(0x0009) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 246a: mov r0, 0f1c
+    {
+        src = r[0];
+        b = 0x0f1c;
+        WR16(b, src);
+    }
+    // 246e: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2470: jsr pc, *$2700
+    {
+        a = 0x2700;
+        r[6] -= 2;
+        WR16(r[6], 0x2474);
+    }
+    AOT_GOTO(0x2700, L2700);
+L2474:
+    AOT_BLOCK(0x2474, 7);
+    // 2474: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2476: mov 0f1c, r0
+    {
+        a = 0x0f1c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 247a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 247c: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 247e: add $80, r0
+    {
+        src = uint16_t(0x0080);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2482: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2484: bhi 2448
+    if (!(C | Z))
+        AOT_GOTO(0x2448, L2448);
+    AOT_GOTO(0x2486, L2486);
+L2486:
+    AOT_BLOCK(0x2486, 4);
+    // 2486: mov 0f1c, r0
+    {
+        a = 0x0f1c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 248a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 248c: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 248e: jsr pc, *$2700
+    {
+        a = 0x2700;
+        r[6] -= 2;
+        WR16(r[6], 0x2492);
+    }
+    AOT_GOTO(0x2700, L2700);
+L2492:
+    AOT_BLOCK(0x2492, 3);
+    // 2492: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2494: cmp $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2498: beq 2448
+    if (Z)
+        AOT_GOTO(0x2448, L2448);
+    AOT_GOTO(0x249a, L249a);
+L249a:
+    AOT_BLOCK(0x249a, 5);
+    // 249a: mov r3, *0f18
+    {
+        src = r[3];
+        b = RD16(0x0f18);
+        WR16(b, src);
+    }
+    // 249e: mov 0f18, r0
+    {
+        a = 0x0f18;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 24a2: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 24a6: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 24a8: beq 24b4
+    if (Z)
+        AOT_GOTO(0x24b4, L24b4);
+    AOT_GOTO(0x24aa, L24aa);
+L24aa:
+    AOT_BLOCK(0x24aa, 3);
+    // 24aa: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 24ac: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 24b0: mov r0, *0f18
+    {
+        src = r[0];
+        b = RD16(0x0f18);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x24b4, L24b4);
+L24b4:
+    AOT_BLOCK(0x24b4, 10);
+    // 24b4: mov 0f1c, r0
+    {
+        a = 0x0f1c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 24b8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 24ba: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 24bc: add $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 24c0: mov r0, (r3)
+    {
+        src = r[0];
+        b = r[3];
+        WR16(b, src);
+    }
+    // 24c2: mov r0, 0f18
+    {
+        src = r[0];
+        b = 0x0f18;
+        WR16(b, src);
+    }
+    // 24c6: mov $f12, r0
+    {
+        src = uint16_t(0x0f12);
+        r[0] = src;
+    }
+    // 24ca: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 24ce: mov r0, *0f18
+    {
+        src = r[0];
+        b = RD16(0x0f18);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24d2: br 2406
+    AOT_GOTO(0x2406, L2406);
+L24d4:
+    AOT_BLOCK(0x24d4, 6);
+    // 24d4: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 24d6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 24d8: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 24da: mov r0, 0f16
+    {
+        src = r[0];
+        b = 0x0f16;
+        WR16(b, src);
+    }
+    // 24de: cmp r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 24e0: bcc 24ec
+    if (!C)
+        AOT_GOTO(0x24ec, L24ec);
+    AOT_GOTO(0x24e2, L24e2);
+L24e2:
+    AOT_BLOCK(0x24e2, 2);
+    // 24e2: mov *0f16, 0f1a
+    {
+        a = RD16(0x0f16);
+        src = RD16(a);
+        b = 0x0f1a;
+        WR16(b, src);
+    }
+    // 24e8: mov (r4), *0f16
+    {
+        a = r[4];
+        src = RD16(a);
+        b = RD16(0x0f16);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x24ec, L24ec);
+L24ec:
+    AOT_BLOCK(0x24ec, 6);
+    // 24ec: mov 0f16, r0
+    {
+        a = 0x0f16;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 24f0: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 24f4: mov r0, (r4)
+    {
+        src = r[0];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 24f6: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 24f8: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 24fc: br 244a
+    AOT_GOTO(0x244a, L244a);
+L24fe:
+    AOT_BLOCK(0x24fe, 11);
+    // 24fe: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2502;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 2502: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2506: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 2508: sub $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        C = dst < src;
+    }
+    // 250c: mov r3, 0f16
+    {
+        src = r[3];
+        b = 0x0f16;
+        WR16(b, src);
+    }
+    // 2510: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2512: bic $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2516: mov r0, (r3)
+    {
+        src = r[0];
+        b = r[3];
+        WR16(b, src);
+    }
+    // 2518: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2520:
+    AOT_BLOCK(0x2520, 4);
+    // 2520: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2524: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 2528: bit $1, -2(r4)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[4] + -2);
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 252e: beq 2536
+    if (Z)
+        AOT_GOTO(0x2536, L2536);
+    AOT_GOTO(0x2530, L2530);
+L2530:
+    AOT_BLOCK(0x2530, 2);
+    // 2530: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2532: jsr pc, *$24fe
+    {
+        a = 0x24fe;
+        r[6] -= 2;
+        WR16(r[6], 0x2536);
+    }
+    AOT_GOTO(0x24fe, L24fe);
+L2536:
+    AOT_BLOCK(0x2536, 7);
+    // 2536: mov -2(r4), r1
+    {
+        a = uint16_t(r[4] + -2);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 253a: sub r4, r1
+    {
+        src = r[4];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        C = dst < src;
+    }
+    // 253c: bic r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 253e: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+    }
+    // 2540: div $2, r0
+    {
+        src = int16_t(uint16_t(0x0002));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2544: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 2548: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x254c, L254c);
+L254c:
+    AOT_BLOCK(0x254c, 1);
+    // 254c: jsr pc, *$23c4
+    {
+        a = 0x23c4;
+        r[6] -= 2;
+        WR16(r[6], 0x2550);
+    }
+    AOT_GOTO(0x23c4, L23c4);
+L2550:
+    AOT_BLOCK(0x2550, 2);
+    // 2550: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2552: beq 2558
+    if (Z)
+        AOT_GOTO(0x2558, L2558);
+    AOT_GOTO(0x2554, L2554);
+L2554:
+    AOT_BLOCK(0x2554, 2);
+    // 2554: cmp r4, r3
+    {
+        src = r[4];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2556: bne 255e
+    if (!Z)
+        AOT_GOTO(0x255e, L255e);
+    AOT_GOTO(0x2558, L2558);
+L2558:
+    AOT_BLOCK(0x2558, 3);
+    // 2558: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 255a: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L255e:
+    AOT_BLOCK(0x255e, 9);
+    // 255e: mov r4, -8(r5)
+    {
+        src = r[4];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 2562: mov r3, -a(r5)
+    {
+        src = r[3];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 2566: mov 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 256a: inc r1
+    {
+        val = int(int16_t(r[1])) + 1;
+        r[1] = val;
+    }
+    // 256c: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 256e: ashc $ffff, r0
+    {
+        src = uint16_t(0xffff) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 2572: mov r1, r2
+    {
+        src = r[1];
+        r[2] = src;
+    }
+    // 2574: cmp -c(r5), r2
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2578: blos 2592
+    if (C | Z)
+        AOT_GOTO(0x2592, L2592);
+    AOT_GOTO(0x257a, L257a);
+L257a:
+    AOT_BLOCK(0x257a, 2);
+    // 257a: mov r2, -c(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 257e: br 2592
+    AOT_GOTO(0x2592, L2592);
+L2580:
+    AOT_BLOCK(0x2580, 3);
+    // 2580: mov *-8(r5), *-a(r5)
+    {
+        a = RD16(r[5] + -8);
+        src = RD16(a);
+        b = RD16(r[5] + -10);
+        WR16(b, src);
+    }
+    // 2586: add $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 258c: add $2, -8(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2592, L2592);
+L2592:
+    AOT_BLOCK(0x2592, 4);
+    // 2592: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2596: dec -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 259a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 259c: bne 2580
+    if (!Z)
+        AOT_GOTO(0x2580, L2580);
+    AOT_GOTO(0x259e, L259e);
+L259e:
+    AOT_BLOCK(0x259e, 2);
+    // 259e: cmp r4, r3
+    {
+        src = r[4];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 25a0: blos 2558
+    if (C | Z)
+        AOT_GOTO(0x2558, L2558);
+    AOT_GOTO(0x25a2, L25a2);
+L25a2:
+    AOT_BLOCK(0x25a2, 5);
+    // 25a2: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 25a4: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 25a6: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 25a8: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 25aa: bhi 2558
+    if (!(C | Z))
+        AOT_GOTO(0x2558, L2558);
+    AOT_GOTO(0x25ac, L25ac);
+L25ac:
+    AOT_BLOCK(0x25ac, 3);
+    // 25ac: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 25ae: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 25b0: add r3, r1
+    {
+        src = r[3];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x25b2, L25b2);
+L25b2:
+    AOT_BLOCK(0x25b2, 8);
+    // 25b2: sub r4, r1
+    {
+        src = r[4];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        C = dst < src;
+    }
+    // 25b4: bic r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 25b6: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+    }
+    // 25b8: div $2, r0
+    {
+        src = int16_t(uint16_t(0x0002));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 25bc: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 25be: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 25c0: mov 0f1a, (r0)
+    {
+        a = 0x0f1a;
+        src = RD16(a);
+        b = r[0];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25c4: br 2558
+    AOT_GOTO(0x2558, L2558);
+L25c6:
+    AOT_BLOCK(0x25c6, 7);
+    // 25c6: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x25ca;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 25ca: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 25ce: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 25d0: add $fff4, (sp)
+    {
+        src = uint16_t(0xfff4);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 25d4: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25d8: jsr pc, *$2608
+    {
+        a = 0x2608;
+        r[6] -= 2;
+        WR16(r[6], 0x25dc);
+    }
+    AOT_GOTO(0x2608, L2608);
+L25dc:
+    AOT_BLOCK(0x25dc, 3);
+    // 25dc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 25de: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 25e0: bge 25e8
+    if (!(N ^ V))
+        AOT_GOTO(0x25e8, L25e8);
+    AOT_GOTO(0x25e2, L25e2);
+L25e2:
+    AOT_BLOCK(0x25e2, 1);
+    // 25e2: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x25e4, L25e4);
+L25e4:
+    AOT_BLOCK(0x25e4, 2);
+    // 25e4: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L25e8:
+    AOT_BLOCK(0x25e8, 2);
+    // 25e8: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25ec: br 25e4
+    AOT_GOTO(0x25e4, L25e4);
+L2608:
+    AOT_BLOCK(0x2608, 6);
+    // 2608: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x260c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 260c: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2610: mov $7408, -(sp)
+    {
+        src = uint16_t(0x7408);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2614: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2618: jsr pc, *$266e
+    {
+        a = 0x266e;
+        r[6] -= 2;
+        WR16(r[6], 0x261c);
+    }
+    AOT_GOTO(0x266e, L266e);
+L2612:
+    AOT_BLOCK(0x2612, 3);
+    // 2612: ash (r0), r0
+    {
+        a = r[0];
+        src = RD16(a) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 2614: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2618: jsr pc, *$266e
+    {
+        a = 0x266e;
+        r[6] -= 2;
+        WR16(r[6], 0x261c);
+    }
+    AOT_GOTO(0x266e, L266e);
+L261c:
+    AOT_BLOCK(0x261c, 3);
+    // 261c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 261e: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2622:
+    AOT_BLOCK(0x2622, 5);
+    // 2622: jsr r5, 277a
+    {
+        a = 0x277a;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2626;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    // 2626: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 262a: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 262e: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2630, L2630);
+L2630:
+    AOT_BLOCK(0x2630, 2);
+    // 2630: movb (r3)+, (r4)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 2632: bne 2630
+    if (!Z)
+        AOT_GOTO(0x2630, L2630);
+    AOT_GOTO(0x2634, L2634);
+L2634:
+    AOT_BLOCK(0x2634, 3);
+    // 2634: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 2636: jmp 2786
+    {
+        a = 0x2786;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L263a:
+    AOT_BLOCK(0x263a, 2);
+    // 263a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 263c: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x263e, L263e);
+L263e:
+    AOT_BLOCK(0x263e, 1);
+    // 263e: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2642: sys 6
+    AOT_INTERP(0x2642);
+L2644:
+    AOT_BLOCK(0x2644, 1);
+    // 2644: bcc 264a
+    if (!C)
+        AOT_GOTO(0x264a, L264a);
+    AOT_GOTO(0x2646, L2646);
+L2646:
+    AOT_BLOCK(0x2646, 1);
+    // 2646: jmp 276c
+    {
+        a = 0x276c;
+    }
+    AOT_GOTO(0x276c, L276c);
+L2648:
+    AOT_BLOCK(0x2648, 1);
+    // 2648: br 268e
+    AOT_GOTO(0x268e, L268e);
+L264a:
+    AOT_BLOCK(0x264a, 1);
+    // 264a: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x264c, L264c);
+L264c:
+    AOT_BLOCK(0x264c, 2);
+    // 264c: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 264e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2650:
+    AOT_BLOCK(0x2650, 4);
+    // 2650: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2652: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2654: mov 4(r5), 0574
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x0574;
+        WR16(b, src);
+    }
+    // 265a: mov 6(r5), 0576
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x0576;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2660: sys 0
+    AOT_INTERP(0x2660);
+L2662:
+    AOT_BLOCK(0x2662, 1);
+    // 2662: blt 2748
+    if (N ^ V)
+        AOT_GOTO(0x2748, L2748);
+    AOT_GOTO(0x2664, L2664);
+L2664:
+    AOT_BLOCK(0x2664, 1);
+    // 2664: bcc 266a
+    if (!C)
+        AOT_GOTO(0x266a, L266a);
+    AOT_GOTO(0x2666, L2666);
+L2666:
+    AOT_BLOCK(0x2666, 1);
+    // 2666: jmp 276c
+    {
+        a = 0x276c;
+    }
+    AOT_GOTO(0x276c, L276c);
+L2668:
+    AOT_BLOCK(0x2668, 1);
+    // 2668: br 266e
+    AOT_GOTO(0x266e, L266e);
+L266a:
+    AOT_BLOCK(0x266a, 2);
+    // 266a: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 266c: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L266e:
+    AOT_BLOCK(0x266e, 5);
+    // 266e: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2670: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2672: mov 4(r5), 057a
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x057a;
+        WR16(b, src);
+    }
+    // 2678: mov 6(r5), 057c
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x057c;
+        WR16(b, src);
+    }
+    // 267e: mov 8(r5), 057e
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x057e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2684: sys 0
+    AOT_INTERP(0x2684);
+L2686:
+    AOT_BLOCK(0x2686, 1);
+    // 2686: blt 2778
+    if (N ^ V)
+        AOT_GOTO(0x2778, L2778);
+    AOT_GOTO(0x2688, L2688);
+L2688:
+    AOT_BLOCK(0x2688, 1);
+    // 2688: bcc 268e
+    if (!C)
+        AOT_GOTO(0x268e, L268e);
+    AOT_GOTO(0x268a, L268a);
+L268a:
+    AOT_BLOCK(0x268a, 1);
+    // 268a: jmp 276c
+    {
+        a = 0x276c;
+    }
+    AOT_GOTO(0x276c, L276c);
+L268c:
+    AOT_BLOCK(0x268c, 1);
+    // 268c: swab *(sp)+
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x268e, L268e);
+L268e:
+    AOT_BLOCK(0x268e, 3);
+    // 268e: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+    }
+    // 2690: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2692: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2694:
+    AOT_BLOCK(0x2694, 1);
+    // 2694: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2696, L2696);
+L2696:
+    AOT_BLOCK(0x2696, 5);
+    // 2696: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2698: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 269c: mov 6(r5), 0582
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x0582;
+        WR16(b, src);
+    }
+    // 26a2: mov 8(r5), 0584
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x0584;
+        WR16(b, src);
+    }
+    // 26a8: mov a(r5), 0586
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        b = 0x0586;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26ae: sys 0
+    AOT_INTERP(0x26ae);
+L26b0:
+    AOT_BLOCK(0x26b0, 1);
+    // 26b0: blt 25b2
+    if (N ^ V)
+        AOT_GOTO(0x25b2, L25b2);
+    AOT_GOTO(0x26b2, L26b2);
+L26b2:
+    AOT_BLOCK(0x26b2, 1);
+    // 26b2: bcc 26bc
+    if (!C)
+        AOT_GOTO(0x26bc, L26bc);
+    AOT_GOTO(0x26b4, L26b4);
+L26b4:
+    AOT_BLOCK(0x26b4, 1);
+    // 26b4: mov $1, r1
+    {
+        src = uint16_t(0x0001);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x26b8, L26b8);
+L26b6:
+    // 26b6: wait
+    AOT_INTERP(0x26b6);
+L26b8:
+    AOT_BLOCK(0x26b8, 1);
+    // 26b8: jmp 276c
+    {
+        a = 0x276c;
+    }
+    AOT_GOTO(0x276c, L276c);
+L26bc:
+    AOT_BLOCK(0x26bc, 2);
+    // 26bc: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26be: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L26c0:
+    AOT_BLOCK(0x26c0, 4);
+    // 26c0: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 26c2: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 26c4: mov 4(r5), 058a
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x058a;
+        WR16(b, src);
+    }
+    // 26ca: mov 6(r5), 058c
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x058c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26d0: sys 0
+    AOT_INTERP(0x26d0);
+L26d2:
+    AOT_BLOCK(0x26d2, 1);
+    // 26d2: blt 25e4
+    if (N ^ V)
+        AOT_GOTO(0x25e4, L25e4);
+    AOT_GOTO(0x26d4, L26d4);
+L26d4:
+    AOT_BLOCK(0x26d4, 1);
+    // 26d4: bcc 26da
+    if (!C)
+        AOT_GOTO(0x26da, L26da);
+    AOT_GOTO(0x26d6, L26d6);
+L26d6:
+    AOT_BLOCK(0x26d6, 1);
+    // 26d6: jmp 276c
+    {
+        a = 0x276c;
+    }
+    AOT_GOTO(0x276c, L276c);
+L26d8:
+    // 26d8: (undefined)
+    AOT_INTERP(0x26d8);
+L26da:
+    AOT_BLOCK(0x26da, 2);
+    // 26da: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26dc: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L26de:
+    AOT_BLOCK(0x26de, 5);
+    // 26de: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 26e0: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 26e2: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 26e6: mov 6(r5), 0590
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x0590;
+        WR16(b, src);
+    }
+    // 26ec: mov 8(r5), 0592
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x0592;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26f2: sys 0
+    AOT_INTERP(0x26f2);
+L26f4:
+    AOT_BLOCK(0x26f4, 1);
+    // 26f4: blt 2612
+    if (N ^ V)
+        AOT_GOTO(0x2612, L2612);
+    AOT_GOTO(0x26f6, L26f6);
+L26f6:
+    AOT_BLOCK(0x26f6, 1);
+    // 26f6: bcc 26fc
+    if (!C)
+        AOT_GOTO(0x26fc, L26fc);
+    AOT_GOTO(0x26f8, L26f8);
+L26f8:
+    AOT_BLOCK(0x26f8, 1);
+    // 26f8: jmp 276c
+    {
+        a = 0x276c;
+    }
+    AOT_GOTO(0x276c, L276c);
+L26fa:
+    AOT_BLOCK(0x26fa, 1);
+    // 26fa: jmp 1585(r0)
+    {
+        a = uint16_t(r[0] + 5509);
+    }
+    AOT_JUMP(a);
+L26fc:
+    AOT_BLOCK(0x26fc, 2);
+    // 26fc: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26fe: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2700:
+    AOT_BLOCK(0x2700, 4);
+    // 2700: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2702: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2704: mov 4(r5), 0596
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x0596;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 270a: beq 271c
+    if (Z)
+        AOT_GOTO(0x271c, L271c);
+    AOT_GOTO(0x270c, L270c);
+L270c:
+    AOT_BLOCK(0x270c, 1);
+    // 270c: add 0598, 0596
+    {
+        a = 0x0598;
+        src = RD16(a);
+        b = 0x0596;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2712: sys 0
+    AOT_INTERP(0x2712);
+L2714:
+    AOT_BLOCK(0x2714, 1);
+    // 2714: blt 263e
+    if (N ^ V)
+        AOT_GOTO(0x263e, L263e);
+    AOT_GOTO(0x2716, L2716);
+L2716:
+    AOT_BLOCK(0x2716, 1);
+    // 2716: bcc 271c
+    if (!C)
+        AOT_GOTO(0x271c, L271c);
+    AOT_GOTO(0x2718, L2718);
+L2718:
+    AOT_BLOCK(0x2718, 1);
+    // 2718: jmp 276c
+    {
+        a = 0x276c;
+    }
+    AOT_GOTO(0x276c, L276c);
+L271a:
+    AOT_BLOCK(0x271a, 1);
+    // 271a: jmp (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+    }
+    AOT_JUMP(a);
+L271c:
+    AOT_BLOCK(0x271c, 4);
+    // 271c: mov 0598, r0
+    {
+        a = 0x0598;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2720: add 4(r5), 0598
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x0598;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2726: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2728: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2748:
+    AOT_BLOCK(0x2748, 1);
+    // 2748: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L274a:
+    AOT_BLOCK(0x274a, 5);
+    // 274a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 274c: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 274e: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2752: mov 6(r5), 059c
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x059c;
+        WR16(b, src);
+    }
+    // 2758: mov 8(r5), 059e
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x059e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 275e: sys 0
+    AOT_INTERP(0x275e);
+L2760:
+    AOT_BLOCK(0x2760, 1);
+    // 2760: blt 2696
+    if (N ^ V)
+        AOT_GOTO(0x2696, L2696);
+    AOT_GOTO(0x2762, L2762);
+L2762:
+    AOT_BLOCK(0x2762, 1);
+    // 2762: bcc 2768
+    if (!C)
+        AOT_GOTO(0x2768, L2768);
+    AOT_GOTO(0x2764, L2764);
+L2764:
+    AOT_BLOCK(0x2764, 1);
+    // 2764: jmp 276c
+    {
+        a = 0x276c;
+    }
+    AOT_GOTO(0x276c, L276c);
+L2766:
+    // 2766: iot
+    AOT_INTERP(0x2766);
+L2768:
+    AOT_BLOCK(0x2768, 2);
+    // 2768: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 276a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L276c:
+    AOT_BLOCK(0x276c, 1);
+    // 276c: mov r0, 0b78
+    {
+        src = r[0];
+        b = 0x0b78;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2770, L2770);
+L2770:
+    AOT_BLOCK(0x2770, 3);
+    // 2770: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+    }
+    // 2774: mov r5, sp
+    {
+        src = r[5];
+        r[6] = src;
+    }
+    // 2776: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2778, L2778);
+L2778:
+    AOT_BLOCK(0x2778, 1);
+    // 2778: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L277a:
+    AOT_BLOCK(0x277a, 1);
+    // csv
+    {
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2786);
+    }
+    AOT_JUMP(r[0]);
+L2786:
+    AOT_BLOCK(0x2786, 1);
+    // cret
+    {
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("v7/lib/c2", 0x0000, 10176, 0xd2e2f9edu, run);
+}
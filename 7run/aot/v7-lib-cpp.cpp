@@ -0,0 +1,28298 @@
+// v7/lib/cpp translated by 7aot: 1240 blocks, do not edit
+#include "../PDP11/aot.h"
+
+namespace {
+
+void run(VMBase *base) {
+    AOT_ENTER;
+    goto poll;
+    AOT_RUNTIME
+    switch (vm.r[7]) {
+        case 0x0000: goto L0000;
+        case 0x0002: goto L0002;
+        case 0x0006: goto L0006;
+        case 0x000a: goto L000a;
+        case 0x000c: goto L000c;
+        case 0x0010: goto L0010;
+        case 0x0014: goto L0014;
+        case 0x0016: goto L0016;
+        case 0x001a: goto L001a;
+        case 0x001c: goto L001c;
+        case 0x001e: goto L001e;
+        case 0x0022: goto L0022;
+        case 0x0024: goto L0024;
+        case 0x0026: goto L0026;
+        case 0x002a: goto L002a;
+        case 0x002e: goto L002e;
+        case 0x0032: goto L0032;
+        case 0x0034: goto L0034;
+        case 0x0036: goto L0036;
+        case 0x003a: goto L003a;
+        case 0x003c: goto L003c;
+        case 0x003e: goto L003e;
+        case 0x0040: goto L0040;
+        case 0x0042: goto L0042;
+        case 0x0044: goto L0044;
+        case 0x0046: goto L0046;
+        case 0x004c: goto L004c;
+        case 0x005e: goto L005e;
+        case 0x0066: goto L0066;
+        case 0x006a: goto L006a;
+        case 0x006e: goto L006e;
+        case 0x0072: goto L0072;
+        case 0x007c: goto L007c;
+        case 0x0082: goto L0082;
+        case 0x0088: goto L0088;
+        case 0x0096: goto L0096;
+        case 0x009c: goto L009c;
+        case 0x00a4: goto L00a4;
+        case 0x00a6: goto L00a6;
+        case 0x00aa: goto L00aa;
+        case 0x00ac: goto L00ac;
+        case 0x00b2: goto L00b2;
+        case 0x00b6: goto L00b6;
+        case 0x00ba: goto L00ba;
+        case 0x00ca: goto L00ca;
+        case 0x00e6: goto L00e6;
+        case 0x00ee: goto L00ee;
+        case 0x00fa: goto L00fa;
+        case 0x0104: goto L0104;
+        case 0x0106: goto L0106;
+        case 0x010a: goto L010a;
+        case 0x0110: goto L0110;
+        case 0x0112: goto L0112;
+        case 0x0116: goto L0116;
+        case 0x0118: goto L0118;
+        case 0x0126: goto L0126;
+        case 0x0138: goto L0138;
+        case 0x013c: goto L013c;
+        case 0x0148: goto L0148;
+        case 0x0158: goto L0158;
+        case 0x0170: goto L0170;
+        case 0x0182: goto L0182;
+        case 0x0196: goto L0196;
+        case 0x019e: goto L019e;
+        case 0x01a4: goto L01a4;
+        case 0x01aa: goto L01aa;
+        case 0x01ec: goto L01ec;
+        case 0x0206: goto L0206;
+        case 0x020e: goto L020e;
+        case 0x0212: goto L0212;
+        case 0x0218: goto L0218;
+        case 0x0224: goto L0224;
+        case 0x0228: goto L0228;
+        case 0x022e: goto L022e;
+        case 0x0236: goto L0236;
+        case 0x023e: goto L023e;
+        case 0x0246: goto L0246;
+        case 0x0266: goto L0266;
+        case 0x026a: goto L026a;
+        case 0x027a: goto L027a;
+        case 0x027e: goto L027e;
+        case 0x028a: goto L028a;
+        case 0x029a: goto L029a;
+        case 0x02a0: goto L02a0;
+        case 0x02a8: goto L02a8;
+        case 0x02ae: goto L02ae;
+        case 0x02b2: goto L02b2;
+        case 0x02b4: goto L02b4;
+        case 0x02bc: goto L02bc;
+        case 0x02c2: goto L02c2;
+        case 0x02c8: goto L02c8;
+        case 0x02d0: goto L02d0;
+        case 0x02d6: goto L02d6;
+        case 0x02da: goto L02da;
+        case 0x02e0: goto L02e0;
+        case 0x02e8: goto L02e8;
+        case 0x02ee: goto L02ee;
+        case 0x02f2: goto L02f2;
+        case 0x02f8: goto L02f8;
+        case 0x0300: goto L0300;
+        case 0x0308: goto L0308;
+        case 0x030e: goto L030e;
+        case 0x0312: goto L0312;
+        case 0x031a: goto L031a;
+        case 0x0320: goto L0320;
+        case 0x0322: goto L0322;
+        case 0x0328: goto L0328;
+        case 0x0334: goto L0334;
+        case 0x033a: goto L033a;
+        case 0x0344: goto L0344;
+        case 0x0350: goto L0350;
+        case 0x035e: goto L035e;
+        case 0x036a: goto L036a;
+        case 0x036c: goto L036c;
+        case 0x0388: goto L0388;
+        case 0x038e: goto L038e;
+        case 0x039a: goto L039a;
+        case 0x03a0: goto L03a0;
+        case 0x03a2: goto L03a2;
+        case 0x03a8: goto L03a8;
+        case 0x03ac: goto L03ac;
+        case 0x03b4: goto L03b4;
+        case 0x03b6: goto L03b6;
+        case 0x03c6: goto L03c6;
+        case 0x03d0: goto L03d0;
+        case 0x03de: goto L03de;
+        case 0x03ea: goto L03ea;
+        case 0x03ee: goto L03ee;
+        case 0x03f4: goto L03f4;
+        case 0x03f8: goto L03f8;
+        case 0x03fe: goto L03fe;
+        case 0x0400: goto L0400;
+        case 0x040a: goto L040a;
+        case 0x0412: goto L0412;
+        case 0x041a: goto L041a;
+        case 0x0422: goto L0422;
+        case 0x0426: goto L0426;
+        case 0x0432: goto L0432;
+        case 0x043c: goto L043c;
+        case 0x0448: goto L0448;
+        case 0x0456: goto L0456;
+        case 0x0462: goto L0462;
+        case 0x0464: goto L0464;
+        case 0x046e: goto L046e;
+        case 0x047c: goto L047c;
+        case 0x0488: goto L0488;
+        case 0x048a: goto L048a;
+        case 0x04a2: goto L04a2;
+        case 0x04a8: goto L04a8;
+        case 0x04ac: goto L04ac;
+        case 0x04be: goto L04be;
+        case 0x04c6: goto L04c6;
+        case 0x04ca: goto L04ca;
+        case 0x04d0: goto L04d0;
+        case 0x04d2: goto L04d2;
+        case 0x04d8: goto L04d8;
+        case 0x04de: goto L04de;
+        case 0x04ec: goto L04ec;
+        case 0x04f2: goto L04f2;
+        case 0x04fa: goto L04fa;
+        case 0x0500: goto L0500;
+        case 0x0502: goto L0502;
+        case 0x0508: goto L0508;
+        case 0x0514: goto L0514;
+        case 0x051c: goto L051c;
+        case 0x051e: goto L051e;
+        case 0x0528: goto L0528;
+        case 0x0530: goto L0530;
+        case 0x0534: goto L0534;
+        case 0x053c: goto L053c;
+        case 0x0542: goto L0542;
+        case 0x054a: goto L054a;
+        case 0x0552: goto L0552;
+        case 0x0558: goto L0558;
+        case 0x055c: goto L055c;
+        case 0x056e: goto L056e;
+        case 0x0578: goto L0578;
+        case 0x057c: goto L057c;
+        case 0x0582: goto L0582;
+        case 0x0586: goto L0586;
+        case 0x0594: goto L0594;
+        case 0x0598: goto L0598;
+        case 0x059e: goto L059e;
+        case 0x05a2: goto L05a2;
+        case 0x05ac: goto L05ac;
+        case 0x05b4: goto L05b4;
+        case 0x05b8: goto L05b8;
+        case 0x05be: goto L05be;
+        case 0x05c2: goto L05c2;
+        case 0x05c8: goto L05c8;
+        case 0x05ca: goto L05ca;
+        case 0x05d4: goto L05d4;
+        case 0x05dc: goto L05dc;
+        case 0x05e8: goto L05e8;
+        case 0x05f0: goto L05f0;
+        case 0x05f4: goto L05f4;
+        case 0x05fc: goto L05fc;
+        case 0x0604: goto L0604;
+        case 0x060e: goto L060e;
+        case 0x0616: goto L0616;
+        case 0x0620: goto L0620;
+        case 0x0628: goto L0628;
+        case 0x0632: goto L0632;
+        case 0x063a: goto L063a;
+        case 0x0644: goto L0644;
+        case 0x064c: goto L064c;
+        case 0x0656: goto L0656;
+        case 0x065e: goto L065e;
+        case 0x0668: goto L0668;
+        case 0x0670: goto L0670;
+        case 0x067a: goto L067a;
+        case 0x0682: goto L0682;
+        case 0x0688: goto L0688;
+        case 0x068e: goto L068e;
+        case 0x069a: goto L069a;
+        case 0x06a4: goto L06a4;
+        case 0x06ac: goto L06ac;
+        case 0x06b0: goto L06b0;
+        case 0x06b6: goto L06b6;
+        case 0x06ba: goto L06ba;
+        case 0x06c2: goto L06c2;
+        case 0x06d2: goto L06d2;
+        case 0x06e0: goto L06e0;
+        case 0x06e6: goto L06e6;
+        case 0x06f8: goto L06f8;
+        case 0x0704: goto L0704;
+        case 0x0708: goto L0708;
+        case 0x0718: goto L0718;
+        case 0x071e: goto L071e;
+        case 0x0720: goto L0720;
+        case 0x072e: goto L072e;
+        case 0x073c: goto L073c;
+        case 0x0742: goto L0742;
+        case 0x0754: goto L0754;
+        case 0x075c: goto L075c;
+        case 0x0764: goto L0764;
+        case 0x076c: goto L076c;
+        case 0x0782: goto L0782;
+        case 0x0784: goto L0784;
+        case 0x0788: goto L0788;
+        case 0x078e: goto L078e;
+        case 0x07b4: goto L07b4;
+        case 0x07b8: goto L07b8;
+        case 0x07ba: goto L07ba;
+        case 0x07c0: goto L07c0;
+        case 0x07c6: goto L07c6;
+        case 0x07ce: goto L07ce;
+        case 0x07ee: goto L07ee;
+        case 0x0800: goto L0800;
+        case 0x0816: goto L0816;
+        case 0x081c: goto L081c;
+        case 0x082c: goto L082c;
+        case 0x0836: goto L0836;
+        case 0x083a: goto L083a;
+        case 0x0840: goto L0840;
+        case 0x0848: goto L0848;
+        case 0x084e: goto L084e;
+        case 0x0854: goto L0854;
+        case 0x0858: goto L0858;
+        case 0x0860: goto L0860;
+        case 0x0866: goto L0866;
+        case 0x0870: goto L0870;
+        case 0x087c: goto L087c;
+        case 0x0886: goto L0886;
+        case 0x088e: goto L088e;
+        case 0x0892: goto L0892;
+        case 0x08a2: goto L08a2;
+        case 0x08ac: goto L08ac;
+        case 0x08b8: goto L08b8;
+        case 0x08c0: goto L08c0;
+        case 0x08c4: goto L08c4;
+        case 0x08ca: goto L08ca;
+        case 0x08ce: goto L08ce;
+        case 0x08d4: goto L08d4;
+        case 0x08e0: goto L08e0;
+        case 0x08ee: goto L08ee;
+        case 0x08f6: goto L08f6;
+        case 0x08fe: goto L08fe;
+        case 0x0910: goto L0910;
+        case 0x0916: goto L0916;
+        case 0x091e: goto L091e;
+        case 0x0926: goto L0926;
+        case 0x0934: goto L0934;
+        case 0x0936: goto L0936;
+        case 0x0942: goto L0942;
+        case 0x0950: goto L0950;
+        case 0x0960: goto L0960;
+        case 0x096c: goto L096c;
+        case 0x0974: goto L0974;
+        case 0x097a: goto L097a;
+        case 0x0990: goto L0990;
+        case 0x0996: goto L0996;
+        case 0x09a2: goto L09a2;
+        case 0x09aa: goto L09aa;
+        case 0x09c4: goto L09c4;
+        case 0x09c8: goto L09c8;
+        case 0x09d4: goto L09d4;
+        case 0x09da: goto L09da;
+        case 0x09ec: goto L09ec;
+        case 0x09ee: goto L09ee;
+        case 0x09f4: goto L09f4;
+        case 0x09f6: goto L09f6;
+        case 0x09fc: goto L09fc;
+        case 0x0a00: goto L0a00;
+        case 0x0a08: goto L0a08;
+        case 0x0a0e: goto L0a0e;
+        case 0x0a22: goto L0a22;
+        case 0x0a2a: goto L0a2a;
+        case 0x0a30: goto L0a30;
+        case 0x0a40: goto L0a40;
+        case 0x0a42: goto L0a42;
+        case 0x0a46: goto L0a46;
+        case 0x0a4c: goto L0a4c;
+        case 0x0a5c: goto L0a5c;
+        case 0x0a64: goto L0a64;
+        case 0x0a68: goto L0a68;
+        case 0x0a70: goto L0a70;
+        case 0x0a72: goto L0a72;
+        case 0x0a7a: goto L0a7a;
+        case 0x0a7e: goto L0a7e;
+        case 0x0a86: goto L0a86;
+        case 0x0a8a: goto L0a8a;
+        case 0x0a9c: goto L0a9c;
+        case 0x0aae: goto L0aae;
+        case 0x0abc: goto L0abc;
+        case 0x0aca: goto L0aca;
+        case 0x0ad0: goto L0ad0;
+        case 0x0ada: goto L0ada;
+        case 0x0afa: goto L0afa;
+        case 0x0b00: goto L0b00;
+        case 0x0b18: goto L0b18;
+        case 0x0b26: goto L0b26;
+        case 0x0b36: goto L0b36;
+        case 0x0b3e: goto L0b3e;
+        case 0x0b4c: goto L0b4c;
+        case 0x0b66: goto L0b66;
+        case 0x0b68: goto L0b68;
+        case 0x0b6e: goto L0b6e;
+        case 0x0b74: goto L0b74;
+        case 0x0b7a: goto L0b7a;
+        case 0x0b80: goto L0b80;
+        case 0x0b8a: goto L0b8a;
+        case 0x0b9e: goto L0b9e;
+        case 0x0bb0: goto L0bb0;
+        case 0x0bb4: goto L0bb4;
+        case 0x0bbe: goto L0bbe;
+        case 0x0bca: goto L0bca;
+        case 0x0bd6: goto L0bd6;
+        case 0x0bd8: goto L0bd8;
+        case 0x0bde: goto L0bde;
+        case 0x0be6: goto L0be6;
+        case 0x0bec: goto L0bec;
+        case 0x0bfa: goto L0bfa;
+        case 0x0c02: goto L0c02;
+        case 0x0c16: goto L0c16;
+        case 0x0c24: goto L0c24;
+        case 0x0c2c: goto L0c2c;
+        case 0x0c32: goto L0c32;
+        case 0x0c36: goto L0c36;
+        case 0x0c3c: goto L0c3c;
+        case 0x0c46: goto L0c46;
+        case 0x0c4c: goto L0c4c;
+        case 0x0c5e: goto L0c5e;
+        case 0x0c6c: goto L0c6c;
+        case 0x0c72: goto L0c72;
+        case 0x0c94: goto L0c94;
+        case 0x0c9a: goto L0c9a;
+        case 0x0c9e: goto L0c9e;
+        case 0x0ca4: goto L0ca4;
+        case 0x0caa: goto L0caa;
+        case 0x0cb0: goto L0cb0;
+        case 0x0cb6: goto L0cb6;
+        case 0x0cbc: goto L0cbc;
+        case 0x0cbe: goto L0cbe;
+        case 0x0cc8: goto L0cc8;
+        case 0x0cca: goto L0cca;
+        case 0x0cd0: goto L0cd0;
+        case 0x0cd4: goto L0cd4;
+        case 0x0cde: goto L0cde;
+        case 0x0ce0: goto L0ce0;
+        case 0x0ce6: goto L0ce6;
+        case 0x0cec: goto L0cec;
+        case 0x0cfe: goto L0cfe;
+        case 0x0d0a: goto L0d0a;
+        case 0x0d0c: goto L0d0c;
+        case 0x0d10: goto L0d10;
+        case 0x0d30: goto L0d30;
+        case 0x0d34: goto L0d34;
+        case 0x0d38: goto L0d38;
+        case 0x0d44: goto L0d44;
+        case 0x0d46: goto L0d46;
+        case 0x0d4a: goto L0d4a;
+        case 0x0d56: goto L0d56;
+        case 0x0d5c: goto L0d5c;
+        case 0x0d72: goto L0d72;
+        case 0x0d7e: goto L0d7e;
+        case 0x0d8a: goto L0d8a;
+        case 0x0d96: goto L0d96;
+        case 0x0d9e: goto L0d9e;
+        case 0x0da4: goto L0da4;
+        case 0x0dac: goto L0dac;
+        case 0x0db8: goto L0db8;
+        case 0x0dc2: goto L0dc2;
+        case 0x0dc6: goto L0dc6;
+        case 0x0dca: goto L0dca;
+        case 0x0dd6: goto L0dd6;
+        case 0x0df8: goto L0df8;
+        case 0x0e06: goto L0e06;
+        case 0x0e0c: goto L0e0c;
+        case 0x0e10: goto L0e10;
+        case 0x0e16: goto L0e16;
+        case 0x0e18: goto L0e18;
+        case 0x0e1e: goto L0e1e;
+        case 0x0e22: goto L0e22;
+        case 0x0e28: goto L0e28;
+        case 0x0e2c: goto L0e2c;
+        case 0x0e32: goto L0e32;
+        case 0x0e38: goto L0e38;
+        case 0x0e42: goto L0e42;
+        case 0x0e50: goto L0e50;
+        case 0x0e5e: goto L0e5e;
+        case 0x0e64: goto L0e64;
+        case 0x0e6c: goto L0e6c;
+        case 0x0e76: goto L0e76;
+        case 0x0e84: goto L0e84;
+        case 0x0e92: goto L0e92;
+        case 0x0e98: goto L0e98;
+        case 0x0ea0: goto L0ea0;
+        case 0x0ea6: goto L0ea6;
+        case 0x0eac: goto L0eac;
+        case 0x0eb2: goto L0eb2;
+        case 0x0eb8: goto L0eb8;
+        case 0x0ebc: goto L0ebc;
+        case 0x0ec0: goto L0ec0;
+        case 0x0ec4: goto L0ec4;
+        case 0x0eca: goto L0eca;
+        case 0x0ed2: goto L0ed2;
+        case 0x0edc: goto L0edc;
+        case 0x0ee2: goto L0ee2;
+        case 0x0ee8: goto L0ee8;
+        case 0x0eee: goto L0eee;
+        case 0x0ef4: goto L0ef4;
+        case 0x0efa: goto L0efa;
+        case 0x0f00: goto L0f00;
+        case 0x0f08: goto L0f08;
+        case 0x0f0e: goto L0f0e;
+        case 0x0f14: goto L0f14;
+        case 0x0f1e: goto L0f1e;
+        case 0x0f2e: goto L0f2e;
+        case 0x0f36: goto L0f36;
+        case 0x0f3c: goto L0f3c;
+        case 0x0f46: goto L0f46;
+        case 0x0f4a: goto L0f4a;
+        case 0x0f4e: goto L0f4e;
+        case 0x0f54: goto L0f54;
+        case 0x0f58: goto L0f58;
+        case 0x0f5e: goto L0f5e;
+        case 0x0f64: goto L0f64;
+        case 0x0f6a: goto L0f6a;
+        case 0x0f70: goto L0f70;
+        case 0x0f84: goto L0f84;
+        case 0x0f8c: goto L0f8c;
+        case 0x0f90: goto L0f90;
+        case 0x0f96: goto L0f96;
+        case 0x0f9a: goto L0f9a;
+        case 0x0fa6: goto L0fa6;
+        case 0x0fae: goto L0fae;
+        case 0x0fb4: goto L0fb4;
+        case 0x0fb8: goto L0fb8;
+        case 0x0fba: goto L0fba;
+        case 0x0fc0: goto L0fc0;
+        case 0x0fd0: goto L0fd0;
+        case 0x0fd2: goto L0fd2;
+        case 0x0fda: goto L0fda;
+        case 0x0fe2: goto L0fe2;
+        case 0x0ff4: goto L0ff4;
+        case 0x0ff8: goto L0ff8;
+        case 0x0ffe: goto L0ffe;
+        case 0x1008: goto L1008;
+        case 0x100e: goto L100e;
+        case 0x1012: goto L1012;
+        case 0x1016: goto L1016;
+        case 0x1018: goto L1018;
+        case 0x101c: goto L101c;
+        case 0x1020: goto L1020;
+        case 0x1038: goto L1038;
+        case 0x1040: goto L1040;
+        case 0x105c: goto L105c;
+        case 0x106a: goto L106a;
+        case 0x107a: goto L107a;
+        case 0x1090: goto L1090;
+        case 0x1092: goto L1092;
+        case 0x10a8: goto L10a8;
+        case 0x10be: goto L10be;
+        case 0x10ce: goto L10ce;
+        case 0x10d8: goto L10d8;
+        case 0x10ec: goto L10ec;
+        case 0x10f2: goto L10f2;
+        case 0x1110: goto L1110;
+        case 0x111c: goto L111c;
+        case 0x1136: goto L1136;
+        case 0x1140: goto L1140;
+        case 0x1144: goto L1144;
+        case 0x1154: goto L1154;
+        case 0x1158: goto L1158;
+        case 0x1168: goto L1168;
+        case 0x116c: goto L116c;
+        case 0x1170: goto L1170;
+        case 0x1174: goto L1174;
+        case 0x117c: goto L117c;
+        case 0x118c: goto L118c;
+        case 0x1198: goto L1198;
+        case 0x11a6: goto L11a6;
+        case 0x11ac: goto L11ac;
+        case 0x11b6: goto L11b6;
+        case 0x11c0: goto L11c0;
+        case 0x11c2: goto L11c2;
+        case 0x11cc: goto L11cc;
+        case 0x11d2: goto L11d2;
+        case 0x11d8: goto L11d8;
+        case 0x11e0: goto L11e0;
+        case 0x1200: goto L1200;
+        case 0x1208: goto L1208;
+        case 0x120a: goto L120a;
+        case 0x1218: goto L1218;
+        case 0x121e: goto L121e;
+        case 0x1220: goto L1220;
+        case 0x122a: goto L122a;
+        case 0x1242: goto L1242;
+        case 0x1248: goto L1248;
+        case 0x1250: goto L1250;
+        case 0x1258: goto L1258;
+        case 0x125c: goto L125c;
+        case 0x1264: goto L1264;
+        case 0x127a: goto L127a;
+        case 0x127e: goto L127e;
+        case 0x128a: goto L128a;
+        case 0x1290: goto L1290;
+        case 0x129c: goto L129c;
+        case 0x12a2: goto L12a2;
+        case 0x12ae: goto L12ae;
+        case 0x12b2: goto L12b2;
+        case 0x12c4: goto L12c4;
+        case 0x12cc: goto L12cc;
+        case 0x12e8: goto L12e8;
+        case 0x12ea: goto L12ea;
+        case 0x12ee: goto L12ee;
+        case 0x12f0: goto L12f0;
+        case 0x12f8: goto L12f8;
+        case 0x1314: goto L1314;
+        case 0x1316: goto L1316;
+        case 0x131a: goto L131a;
+        case 0x1326: goto L1326;
+        case 0x132a: goto L132a;
+        case 0x1342: goto L1342;
+        case 0x1348: goto L1348;
+        case 0x1358: goto L1358;
+        case 0x135e: goto L135e;
+        case 0x1368: goto L1368;
+        case 0x1370: goto L1370;
+        case 0x138e: goto L138e;
+        case 0x1390: goto L1390;
+        case 0x13a0: goto L13a0;
+        case 0x13aa: goto L13aa;
+        case 0x13ae: goto L13ae;
+        case 0x13b6: goto L13b6;
+        case 0x13bc: goto L13bc;
+        case 0x13cc: goto L13cc;
+        case 0x13d8: goto L13d8;
+        case 0x13dc: goto L13dc;
+        case 0x13e4: goto L13e4;
+        case 0x13ec: goto L13ec;
+        case 0x13ee: goto L13ee;
+        case 0x13f6: goto L13f6;
+        case 0x13fc: goto L13fc;
+        case 0x1406: goto L1406;
+        case 0x1412: goto L1412;
+        case 0x1416: goto L1416;
+        case 0x1420: goto L1420;
+        case 0x1426: goto L1426;
+        case 0x142c: goto L142c;
+        case 0x1438: goto L1438;
+        case 0x143c: goto L143c;
+        case 0x1448: goto L1448;
+        case 0x144e: goto L144e;
+        case 0x145a: goto L145a;
+        case 0x1460: goto L1460;
+        case 0x1470: goto L1470;
+        case 0x1472: goto L1472;
+        case 0x1476: goto L1476;
+        case 0x1482: goto L1482;
+        case 0x1488: goto L1488;
+        case 0x1498: goto L1498;
+        case 0x149a: goto L149a;
+        case 0x149c: goto L149c;
+        case 0x14a0: goto L14a0;
+        case 0x14aa: goto L14aa;
+        case 0x14b0: goto L14b0;
+        case 0x14ba: goto L14ba;
+        case 0x14c0: goto L14c0;
+        case 0x14ca: goto L14ca;
+        case 0x14ce: goto L14ce;
+        case 0x14d0: goto L14d0;
+        case 0x14d4: goto L14d4;
+        case 0x14da: goto L14da;
+        case 0x14de: goto L14de;
+        case 0x14e2: goto L14e2;
+        case 0x14ea: goto L14ea;
+        case 0x14f6: goto L14f6;
+        case 0x1502: goto L1502;
+        case 0x1508: goto L1508;
+        case 0x150c: goto L150c;
+        case 0x1512: goto L1512;
+        case 0x1520: goto L1520;
+        case 0x1528: goto L1528;
+        case 0x152c: goto L152c;
+        case 0x153c: goto L153c;
+        case 0x154c: goto L154c;
+        case 0x1558: goto L1558;
+        case 0x155c: goto L155c;
+        case 0x1562: goto L1562;
+        case 0x156e: goto L156e;
+        case 0x1572: goto L1572;
+        case 0x1578: goto L1578;
+        case 0x157e: goto L157e;
+        case 0x1582: goto L1582;
+        case 0x1588: goto L1588;
+        case 0x158e: goto L158e;
+        case 0x1592: goto L1592;
+        case 0x1598: goto L1598;
+        case 0x159e: goto L159e;
+        case 0x15a2: goto L15a2;
+        case 0x15b8: goto L15b8;
+        case 0x15c4: goto L15c4;
+        case 0x15c8: goto L15c8;
+        case 0x15ce: goto L15ce;
+        case 0x15d4: goto L15d4;
+        case 0x15d8: goto L15d8;
+        case 0x15ea: goto L15ea;
+        case 0x15f0: goto L15f0;
+        case 0x15f4: goto L15f4;
+        case 0x1606: goto L1606;
+        case 0x160a: goto L160a;
+        case 0x161c: goto L161c;
+        case 0x1622: goto L1622;
+        case 0x1628: goto L1628;
+        case 0x162e: goto L162e;
+        case 0x1634: goto L1634;
+        case 0x163a: goto L163a;
+        case 0x1640: goto L1640;
+        case 0x1646: goto L1646;
+        case 0x1656: goto L1656;
+        case 0x1666: goto L1666;
+        case 0x166c: goto L166c;
+        case 0x1672: goto L1672;
+        case 0x1678: goto L1678;
+        case 0x1680: goto L1680;
+        case 0x1690: goto L1690;
+        case 0x16aa: goto L16aa;
+        case 0x16b8: goto L16b8;
+        case 0x16bc: goto L16bc;
+        case 0x16be: goto L16be;
+        case 0x16c2: goto L16c2;
+        case 0x16ca: goto L16ca;
+        case 0x16e4: goto L16e4;
+        case 0x16ec: goto L16ec;
+        case 0x16fc: goto L16fc;
+        case 0x171a: goto L171a;
+        case 0x1720: goto L1720;
+        case 0x1730: goto L1730;
+        case 0x1738: goto L1738;
+        case 0x174a: goto L174a;
+        case 0x1754: goto L1754;
+        case 0x1762: goto L1762;
+        case 0x1786: goto L1786;
+        case 0x1790: goto L1790;
+        case 0x1798: goto L1798;
+        case 0x17aa: goto L17aa;
+        case 0x17b2: goto L17b2;
+        case 0x17c4: goto L17c4;
+        case 0x17ce: goto L17ce;
+        case 0x17d2: goto L17d2;
+        case 0x17da: goto L17da;
+        case 0x17e6: goto L17e6;
+        case 0x17ea: goto L17ea;
+        case 0x17fc: goto L17fc;
+        case 0x1832: goto L1832;
+        case 0x183e: goto L183e;
+        case 0x184a: goto L184a;
+        case 0x1856: goto L1856;
+        case 0x1862: goto L1862;
+        case 0x186e: goto L186e;
+        case 0x187a: goto L187a;
+        case 0x1886: goto L1886;
+        case 0x1892: goto L1892;
+        case 0x189c: goto L189c;
+        case 0x18a0: goto L18a0;
+        case 0x18a4: goto L18a4;
+        case 0x18ac: goto L18ac;
+        case 0x18b8: goto L18b8;
+        case 0x18c4: goto L18c4;
+        case 0x18d0: goto L18d0;
+        case 0x1900: goto L1900;
+        case 0x190e: goto L190e;
+        case 0x1916: goto L1916;
+        case 0x191e: goto L191e;
+        case 0x192a: goto L192a;
+        case 0x1930: goto L1930;
+        case 0x1932: goto L1932;
+        case 0x1944: goto L1944;
+        case 0x1946: goto L1946;
+        case 0x194e: goto L194e;
+        case 0x1986: goto L1986;
+        case 0x199a: goto L199a;
+        case 0x19a2: goto L19a2;
+        case 0x19aa: goto L19aa;
+        case 0x19b2: goto L19b2;
+        case 0x19be: goto L19be;
+        case 0x19c4: goto L19c4;
+        case 0x19ce: goto L19ce;
+        case 0x19d4: goto L19d4;
+        case 0x19ea: goto L19ea;
+        case 0x19fe: goto L19fe;
+        case 0x1a02: goto L1a02;
+        case 0x1a0e: goto L1a0e;
+        case 0x1a18: goto L1a18;
+        case 0x1a1c: goto L1a1c;
+        case 0x1a20: goto L1a20;
+        case 0x1a26: goto L1a26;
+        case 0x1a2e: goto L1a2e;
+        case 0x1a36: goto L1a36;
+        case 0x1a3e: goto L1a3e;
+        case 0x1a46: goto L1a46;
+        case 0x1a52: goto L1a52;
+        case 0x1a5a: goto L1a5a;
+        case 0x1a68: goto L1a68;
+        case 0x1a74: goto L1a74;
+        case 0x1a7c: goto L1a7c;
+        case 0x1a80: goto L1a80;
+        case 0x1a84: goto L1a84;
+        case 0x1a90: goto L1a90;
+        case 0x1a96: goto L1a96;
+        case 0x1aa8: goto L1aa8;
+        case 0x1ab4: goto L1ab4;
+        case 0x1ac0: goto L1ac0;
+        case 0x1ac8: goto L1ac8;
+        case 0x1ad2: goto L1ad2;
+        case 0x1ad6: goto L1ad6;
+        case 0x1ada: goto L1ada;
+        case 0x1ae6: goto L1ae6;
+        case 0x1af2: goto L1af2;
+        case 0x1afa: goto L1afa;
+        case 0x1b0c: goto L1b0c;
+        case 0x1b18: goto L1b18;
+        case 0x1b1c: goto L1b1c;
+        case 0x1b22: goto L1b22;
+        case 0x1b24: goto L1b24;
+        case 0x1b28: goto L1b28;
+        case 0x1b36: goto L1b36;
+        case 0x1b3a: goto L1b3a;
+        case 0x1b42: goto L1b42;
+        case 0x1b52: goto L1b52;
+        case 0x1b58: goto L1b58;
+        case 0x1b60: goto L1b60;
+        case 0x1b6c: goto L1b6c;
+        case 0x1b76: goto L1b76;
+        case 0x1b80: goto L1b80;
+        case 0x1b8c: goto L1b8c;
+        case 0x1b92: goto L1b92;
+        case 0x1b9a: goto L1b9a;
+        case 0x1bac: goto L1bac;
+        case 0x1bb2: goto L1bb2;
+        case 0x1bc4: goto L1bc4;
+        case 0x1bd2: goto L1bd2;
+        case 0x1bdc: goto L1bdc;
+        case 0x1be2: goto L1be2;
+        case 0x1bf0: goto L1bf0;
+        case 0x1c02: goto L1c02;
+        case 0x1c16: goto L1c16;
+        case 0x1c2a: goto L1c2a;
+        case 0x1c38: goto L1c38;
+        case 0x1c40: goto L1c40;
+        case 0x1c46: goto L1c46;
+        case 0x1c52: goto L1c52;
+        case 0x1c54: goto L1c54;
+        case 0x1c5a: goto L1c5a;
+        case 0x1c62: goto L1c62;
+        case 0x1c86: goto L1c86;
+        case 0x1c8c: goto L1c8c;
+        case 0x1c9a: goto L1c9a;
+        case 0x1c9c: goto L1c9c;
+        case 0x1caa: goto L1caa;
+        case 0x1cb2: goto L1cb2;
+        case 0x1cb6: goto L1cb6;
+        case 0x1cba: goto L1cba;
+        case 0x1cc8: goto L1cc8;
+        case 0x1cda: goto L1cda;
+        case 0x1ce0: goto L1ce0;
+        case 0x1ce4: goto L1ce4;
+        case 0x1cea: goto L1cea;
+        case 0x1cee: goto L1cee;
+        case 0x1cf6: goto L1cf6;
+        case 0x1cfe: goto L1cfe;
+        case 0x1d16: goto L1d16;
+        case 0x1d2c: goto L1d2c;
+        case 0x1d32: goto L1d32;
+        case 0x1d44: goto L1d44;
+        case 0x1d4a: goto L1d4a;
+        case 0x1d4e: goto L1d4e;
+        case 0x1d54: goto L1d54;
+        case 0x1d58: goto L1d58;
+        case 0x1d60: goto L1d60;
+        case 0x1d66: goto L1d66;
+        case 0x1d6e: goto L1d6e;
+        case 0x1d78: goto L1d78;
+        case 0x1d84: goto L1d84;
+        case 0x1d8c: goto L1d8c;
+        case 0x1d98: goto L1d98;
+        case 0x1d9c: goto L1d9c;
+        case 0x1da2: goto L1da2;
+        case 0x1dac: goto L1dac;
+        case 0x1db2: goto L1db2;
+        case 0x1dba: goto L1dba;
+        case 0x1dbe: goto L1dbe;
+        case 0x1dc6: goto L1dc6;
+        case 0x1dd8: goto L1dd8;
+        case 0x1dde: goto L1dde;
+        case 0x1dee: goto L1dee;
+        case 0x1dfc: goto L1dfc;
+        case 0x1e0c: goto L1e0c;
+        case 0x1e1a: goto L1e1a;
+        case 0x1e1c: goto L1e1c;
+        case 0x1e26: goto L1e26;
+        case 0x1e30: goto L1e30;
+        case 0x1e34: goto L1e34;
+        case 0x1e3a: goto L1e3a;
+        case 0x1e46: goto L1e46;
+        case 0x1e48: goto L1e48;
+        case 0x1e4e: goto L1e4e;
+        case 0x1e52: goto L1e52;
+        case 0x1e5c: goto L1e5c;
+        case 0x1e62: goto L1e62;
+        case 0x1e6e: goto L1e6e;
+        case 0x1e70: goto L1e70;
+        case 0x1ec6: goto L1ec6;
+        case 0x1edc: goto L1edc;
+        case 0x1eec: goto L1eec;
+        case 0x1efa: goto L1efa;
+        case 0x1efe: goto L1efe;
+        case 0x1f04: goto L1f04;
+        case 0x1f0c: goto L1f0c;
+        case 0x1f12: goto L1f12;
+        case 0x1f1a: goto L1f1a;
+        case 0x1f22: goto L1f22;
+        case 0x1f2a: goto L1f2a;
+        case 0x1f34: goto L1f34;
+        case 0x1f3c: goto L1f3c;
+        case 0x1f44: goto L1f44;
+        case 0x1f4c: goto L1f4c;
+        case 0x1f58: goto L1f58;
+        case 0x1f5e: goto L1f5e;
+        case 0x1f62: goto L1f62;
+        case 0x1f68: goto L1f68;
+        case 0x1f6e: goto L1f6e;
+        case 0x1f70: goto L1f70;
+        case 0x1f76: goto L1f76;
+        case 0x1f78: goto L1f78;
+        case 0x1f7e: goto L1f7e;
+        case 0x1f80: goto L1f80;
+        case 0x1f86: goto L1f86;
+        case 0x1f88: goto L1f88;
+        case 0x1f8e: goto L1f8e;
+        case 0x1f90: goto L1f90;
+        case 0x1f9c: goto L1f9c;
+        case 0x1fa6: goto L1fa6;
+        case 0x1fae: goto L1fae;
+        case 0x1fb4: goto L1fb4;
+        case 0x1fb8: goto L1fb8;
+        case 0x1fba: goto L1fba;
+        case 0x1fc0: goto L1fc0;
+        case 0x1fc4: goto L1fc4;
+        case 0x1fc6: goto L1fc6;
+        case 0x1fcc: goto L1fcc;
+        case 0x1fd2: goto L1fd2;
+        case 0x1fd6: goto L1fd6;
+        case 0x1fde: goto L1fde;
+        case 0x1fe6: goto L1fe6;
+        case 0x1fec: goto L1fec;
+        case 0x1fee: goto L1fee;
+        case 0x1ff6: goto L1ff6;
+        case 0x2000: goto L2000;
+        case 0x2008: goto L2008;
+        case 0x2016: goto L2016;
+        case 0x201c: goto L201c;
+        case 0x2032: goto L2032;
+        case 0x2040: goto L2040;
+        case 0x2044: goto L2044;
+        case 0x2048: goto L2048;
+        case 0x204c: goto L204c;
+        case 0x2062: goto L2062;
+        case 0x2064: goto L2064;
+        case 0x206c: goto L206c;
+        case 0x2070: goto L2070;
+        case 0x2074: goto L2074;
+        case 0x2078: goto L2078;
+        case 0x20a6: goto L20a6;
+        case 0x20ae: goto L20ae;
+        case 0x20b8: goto L20b8;
+        case 0x20c4: goto L20c4;
+        case 0x20c6: goto L20c6;
+        case 0x20ce: goto L20ce;
+        case 0x20dc: goto L20dc;
+        case 0x20e4: goto L20e4;
+        case 0x20ec: goto L20ec;
+        case 0x20fa: goto L20fa;
+        case 0x2102: goto L2102;
+        case 0x2106: goto L2106;
+        case 0x210e: goto L210e;
+        case 0x2120: goto L2120;
+        case 0x2126: goto L2126;
+        case 0x212a: goto L212a;
+        case 0x2130: goto L2130;
+        case 0x2134: goto L2134;
+        case 0x213a: goto L213a;
+        case 0x213c: goto L213c;
+        case 0x214e: goto L214e;
+        case 0x2152: goto L2152;
+        case 0x2156: goto L2156;
+        case 0x215a: goto L215a;
+        case 0x2172: goto L2172;
+        case 0x217a: goto L217a;
+        case 0x2182: goto L2182;
+        case 0x2188: goto L2188;
+        case 0x218c: goto L218c;
+        case 0x219a: goto L219a;
+        case 0x219e: goto L219e;
+        case 0x21a2: goto L21a2;
+        case 0x21a6: goto L21a6;
+        case 0x21aa: goto L21aa;
+        case 0x21b0: goto L21b0;
+        case 0x21b4: goto L21b4;
+        case 0x21b6: goto L21b6;
+        case 0x21c2: goto L21c2;
+        case 0x21c6: goto L21c6;
+        case 0x21d4: goto L21d4;
+        case 0x21da: goto L21da;
+        case 0x21e0: goto L21e0;
+        case 0x21e6: goto L21e6;
+        case 0x21ec: goto L21ec;
+        case 0x21f0: goto L21f0;
+        case 0x21f2: goto L21f2;
+        case 0x21f8: goto L21f8;
+        case 0x21fc: goto L21fc;
+        case 0x21fe: goto L21fe;
+        case 0x2202: goto L2202;
+        case 0x2206: goto L2206;
+        case 0x220c: goto L220c;
+        case 0x220e: goto L220e;
+        case 0x2212: goto L2212;
+        case 0x2216: goto L2216;
+        case 0x2218: goto L2218;
+        case 0x2224: goto L2224;
+        case 0x2226: goto L2226;
+        case 0x2228: goto L2228;
+        case 0x222c: goto L222c;
+        case 0x223e: goto L223e;
+        case 0x2242: goto L2242;
+        case 0x2246: goto L2246;
+        case 0x224a: goto L224a;
+        case 0x2250: goto L2250;
+        case 0x2256: goto L2256;
+        case 0x225c: goto L225c;
+        case 0x226a: goto L226a;
+        case 0x226e: goto L226e;
+        case 0x2274: goto L2274;
+        case 0x2278: goto L2278;
+        case 0x227c: goto L227c;
+        case 0x2288: goto L2288;
+        case 0x228c: goto L228c;
+        case 0x2290: goto L2290;
+        case 0x229e: goto L229e;
+        case 0x22a2: goto L22a2;
+        case 0x22b2: goto L22b2;
+        case 0x22ba: goto L22ba;
+        case 0x22be: goto L22be;
+        case 0x22c2: goto L22c2;
+        case 0x22c6: goto L22c6;
+        case 0x22d2: goto L22d2;
+        case 0x22d4: goto L22d4;
+        case 0x22e0: goto L22e0;
+        case 0x22e4: goto L22e4;
+        case 0x22ea: goto L22ea;
+        case 0x22ec: goto L22ec;
+        case 0x22f6: goto L22f6;
+        case 0x22f8: goto L22f8;
+        case 0x2302: goto L2302;
+        case 0x2304: goto L2304;
+        case 0x230a: goto L230a;
+        case 0x230c: goto L230c;
+        case 0x231e: goto L231e;
+        case 0x2326: goto L2326;
+        case 0x232c: goto L232c;
+        case 0x233e: goto L233e;
+        case 0x2342: goto L2342;
+        case 0x2348: goto L2348;
+        case 0x2354: goto L2354;
+        case 0x235a: goto L235a;
+        case 0x2364: goto L2364;
+        case 0x2376: goto L2376;
+        case 0x2384: goto L2384;
+        case 0x2386: goto L2386;
+        case 0x2388: goto L2388;
+        case 0x238e: goto L238e;
+        case 0x2398: goto L2398;
+        case 0x23a2: goto L23a2;
+        case 0x23a4: goto L23a4;
+        case 0x23a8: goto L23a8;
+        case 0x23ae: goto L23ae;
+        case 0x23b4: goto L23b4;
+        case 0x23bc: goto L23bc;
+        case 0x23c2: goto L23c2;
+        case 0x23d0: goto L23d0;
+        case 0x23de: goto L23de;
+        case 0x23e4: goto L23e4;
+        case 0x23f2: goto L23f2;
+        case 0x23f4: goto L23f4;
+        case 0x23f8: goto L23f8;
+        case 0x23fa: goto L23fa;
+        case 0x2400: goto L2400;
+        case 0x240a: goto L240a;
+        case 0x2414: goto L2414;
+        case 0x2416: goto L2416;
+        case 0x241a: goto L241a;
+        case 0x2420: goto L2420;
+        case 0x2424: goto L2424;
+        case 0x2438: goto L2438;
+        case 0x2444: goto L2444;
+        case 0x244c: goto L244c;
+        case 0x246c: goto L246c;
+        case 0x2476: goto L2476;
+        case 0x247c: goto L247c;
+        case 0x2482: goto L2482;
+        case 0x248c: goto L248c;
+        case 0x2490: goto L2490;
+        case 0x2498: goto L2498;
+        case 0x24a4: goto L24a4;
+        case 0x24ac: goto L24ac;
+        case 0x24b4: goto L24b4;
+        case 0x24c2: goto L24c2;
+        case 0x24cc: goto L24cc;
+        case 0x24dc: goto L24dc;
+        case 0x24e0: goto L24e0;
+        case 0x24ec: goto L24ec;
+        case 0x24f2: goto L24f2;
+        case 0x24fc: goto L24fc;
+        case 0x2500: goto L2500;
+        case 0x2506: goto L2506;
+        case 0x251c: goto L251c;
+        case 0x2520: goto L2520;
+        case 0x2522: goto L2522;
+        case 0x2528: goto L2528;
+        case 0x252a: goto L252a;
+        case 0x2540: goto L2540;
+        case 0x2546: goto L2546;
+        case 0x2550: goto L2550;
+        case 0x2554: goto L2554;
+        case 0x2558: goto L2558;
+        case 0x2562: goto L2562;
+        case 0x2568: goto L2568;
+        case 0x256c: goto L256c;
+        case 0x2572: goto L2572;
+        case 0x2576: goto L2576;
+        case 0x258a: goto L258a;
+        case 0x2592: goto L2592;
+        case 0x2598: goto L2598;
+        case 0x25a4: goto L25a4;
+        case 0x25a8: goto L25a8;
+        case 0x25ac: goto L25ac;
+        case 0x25b4: goto L25b4;
+        case 0x25bc: goto L25bc;
+        case 0x25c4: goto L25c4;
+        case 0x25c8: goto L25c8;
+        case 0x25d8: goto L25d8;
+        case 0x25e4: goto L25e4;
+        case 0x25e6: goto L25e6;
+        case 0x25ea: goto L25ea;
+        case 0x25f0: goto L25f0;
+        case 0x25f6: goto L25f6;
+        case 0x2600: goto L2600;
+        case 0x2602: goto L2602;
+        case 0x260e: goto L260e;
+        case 0x2612: goto L2612;
+        case 0x2616: goto L2616;
+        case 0x2622: goto L2622;
+        case 0x2626: goto L2626;
+        case 0x262c: goto L262c;
+        case 0x2630: goto L2630;
+        case 0x2638: goto L2638;
+        case 0x263e: goto L263e;
+        case 0x2646: goto L2646;
+        case 0x2650: goto L2650;
+        case 0x2654: goto L2654;
+        case 0x2662: goto L2662;
+        case 0x2668: goto L2668;
+        case 0x266c: goto L266c;
+        case 0x2672: goto L2672;
+        case 0x2674: goto L2674;
+        case 0x267c: goto L267c;
+        case 0x2680: goto L2680;
+        case 0x2684: goto L2684;
+        case 0x2690: goto L2690;
+        case 0x2698: goto L2698;
+        case 0x26a0: goto L26a0;
+        case 0x26a8: goto L26a8;
+        case 0x26ae: goto L26ae;
+        case 0x26b2: goto L26b2;
+        case 0x26c4: goto L26c4;
+        case 0x26ce: goto L26ce;
+        case 0x26d2: goto L26d2;
+        case 0x26d8: goto L26d8;
+        case 0x26e2: goto L26e2;
+        case 0x26e6: goto L26e6;
+        case 0x26ec: goto L26ec;
+        case 0x26f6: goto L26f6;
+        case 0x26fc: goto L26fc;
+        case 0x26fe: goto L26fe;
+        case 0x2702: goto L2702;
+        case 0x2706: goto L2706;
+        case 0x2708: goto L2708;
+        case 0x270e: goto L270e;
+        case 0x2712: goto L2712;
+        case 0x271a: goto L271a;
+        case 0x2720: goto L2720;
+        case 0x2722: goto L2722;
+        case 0x2724: goto L2724;
+        case 0x2726: goto L2726;
+        case 0x2728: goto L2728;
+        case 0x272a: goto L272a;
+        case 0x274e: goto L274e;
+        case 0x2762: goto L2762;
+        case 0x2766: goto L2766;
+        case 0x276c: goto L276c;
+        case 0x276e: goto L276e;
+        case 0x2770: goto L2770;
+        case 0x2778: goto L2778;
+        case 0x2782: goto L2782;
+        case 0x278c: goto L278c;
+        case 0x2798: goto L2798;
+        case 0x279e: goto L279e;
+        case 0x27a4: goto L27a4;
+        case 0x27a6: goto L27a6;
+        case 0x27aa: goto L27aa;
+        case 0x27b6: goto L27b6;
+        case 0x27d0: goto L27d0;
+        case 0x27e2: goto L27e2;
+        case 0x27ee: goto L27ee;
+        case 0x27f6: goto L27f6;
+        case 0x2806: goto L2806;
+        case 0x2810: goto L2810;
+        case 0x2830: goto L2830;
+        case 0x283e: goto L283e;
+        case 0x2848: goto L2848;
+        case 0x285a: goto L285a;
+        case 0x28b4: goto L28b4;
+        case 0x2920: goto L2920;
+        case 0x2922: goto L2922;
+        case 0x2938: goto L2938;
+        case 0x293e: goto L293e;
+        case 0x2940: goto L2940;
+        case 0x2944: goto L2944;
+        case 0x2964: goto L2964;
+        case 0x296c: goto L296c;
+        case 0x2978: goto L2978;
+        case 0x297e: goto L297e;
+        case 0x298c: goto L298c;
+        case 0x2990: goto L2990;
+        case 0x2992: goto L2992;
+        case 0x2996: goto L2996;
+        case 0x299c: goto L299c;
+        case 0x29a8: goto L29a8;
+        case 0x29ac: goto L29ac;
+        case 0x29b0: goto L29b0;
+        case 0x29b2: goto L29b2;
+        case 0x29b6: goto L29b6;
+        case 0x29be: goto L29be;
+        case 0x29cc: goto L29cc;
+        case 0x29d0: goto L29d0;
+        case 0x29d6: goto L29d6;
+        case 0x29e0: goto L29e0;
+        case 0x29e2: goto L29e2;
+        case 0x29e4: goto L29e4;
+        case 0x29e6: goto L29e6;
+        case 0x29e8: goto L29e8;
+        case 0x29ec: goto L29ec;
+        case 0x29fe: goto L29fe;
+        case 0x2a00: goto L2a00;
+        case 0x2a02: goto L2a02;
+        case 0x2a04: goto L2a04;
+        case 0x2a06: goto L2a06;
+        case 0x2a0a: goto L2a0a;
+        case 0x2a22: goto L2a22;
+        case 0x2a24: goto L2a24;
+        case 0x2a26: goto L2a26;
+        case 0x2a28: goto L2a28;
+        case 0x2a2a: goto L2a2a;
+        case 0x2a30: goto L2a30;
+        case 0x2a4c: goto L2a4c;
+        case 0x2a4e: goto L2a4e;
+        case 0x2a50: goto L2a50;
+        case 0x2a52: goto L2a52;
+        case 0x2a54: goto L2a54;
+        case 0x2a58: goto L2a58;
+        case 0x2a5c: goto L2a5c;
+        case 0x2a6e: goto L2a6e;
+        case 0x2a70: goto L2a70;
+        case 0x2a72: goto L2a72;
+        case 0x2a74: goto L2a74;
+        case 0x2a76: goto L2a76;
+        case 0x2a7a: goto L2a7a;
+        case 0x2a90: goto L2a90;
+        case 0x2a92: goto L2a92;
+        case 0x2a94: goto L2a94;
+        case 0x2a96: goto L2a96;
+        case 0x2a98: goto L2a98;
+        case 0x2a9c: goto L2a9c;
+        case 0x2aa8: goto L2aa8;
+        case 0x2ab0: goto L2ab0;
+        case 0x2ab2: goto L2ab2;
+        case 0x2ab4: goto L2ab4;
+        case 0x2ab6: goto L2ab6;
+        case 0x2ab8: goto L2ab8;
+        case 0x2ae6: goto L2ae6;
+        case 0x2afc: goto L2afc;
+        case 0x2afe: goto L2afe;
+        case 0x2b00: goto L2b00;
+        case 0x2b02: goto L2b02;
+        case 0x2b04: goto L2b04;
+        case 0x2b08: goto L2b08;
+        case 0x2b16: goto L2b16;
+        case 0x2b22: goto L2b22;
+    }
+    goto interp;
+L0000:
+    AOT_BLOCK(0x0000, 1);
+    // 0000: setd
+    AOT_GOTO(0x0002, L0002);
+L0002:
+    AOT_BLOCK(0x0002, 1);
+    // 0002: mov 2(sp), r0
+    {
+        a = uint16_t(r[6] + 2);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0006, L0006);
+L0006:
+    AOT_BLOCK(0x0006, 1);
+    // 0006: clr -2(r0)
+    {
+        a = uint16_t(r[0] + -2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x000a, L000a);
+L000a:
+    AOT_BLOCK(0x000a, 1);
+    // 000a: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x000c, L000c);
+L000c:
+    AOT_BLOCK(0x000c, 1);
+    // 000c: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0010, L0010);
+L0010:
+    AOT_BLOCK(0x0010, 1);
+    // 0010: mov 4(sp), (sp)
+    {
+        a = uint16_t(r[6] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0014, L0014);
+L0014:
+    AOT_BLOCK(0x0014, 1);
+    // 0014: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0016, L0016);
+L0016:
+    AOT_BLOCK(0x0016, 1);
+    // 0016: mov r0, 2(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x001a, L001a);
+L001a:
+    AOT_BLOCK(0x001a, 1);
+    // 001a: tst (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x001c, L001c);
+L001c:
+    AOT_BLOCK(0x001c, 1);
+    // 001c: bne 001a
+    if (!Z)
+        AOT_GOTO(0x001a, L001a);
+    AOT_GOTO(0x001e, L001e);
+L001e:
+    AOT_BLOCK(0x001e, 1);
+    // 001e: cmp r0, *2(sp)
+    {
+        src = r[0];
+        b = RD16(r[6] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0022, L0022);
+L0022:
+    AOT_BLOCK(0x0022, 1);
+    // 0022: bcs 0026
+    if (C)
+        AOT_GOTO(0x0026, L0026);
+    AOT_GOTO(0x0024, L0024);
+L0024:
+    AOT_BLOCK(0x0024, 1);
+    // 0024: tst -(r0)
+    {
+        r[0] -= 2;
+        a = r[0];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0026, L0026);
+L0026:
+    AOT_BLOCK(0x0026, 1);
+    // 0026: mov r0, 4(sp)
+    {
+        src = r[0];
+        b = uint16_t(r[6] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x002a, L002a);
+L002a:
+    AOT_BLOCK(0x002a, 1);
+    // 002a: mov r0, 9060
+    {
+        src = r[0];
+        b = 0x9060;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x002e, L002e);
+L002e:
+    AOT_BLOCK(0x002e, 1);
+    // 002e: jsr pc, 153c
+    {
+        a = 0x153c;
+        r[6] -= 2;
+        WR16(r[6], 0x0032);
+    }
+    AOT_GOTO(0x153c, L153c);
+L0032:
+    AOT_BLOCK(0x0032, 1);
+    // 0032: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0034, L0034);
+L0034:
+    AOT_BLOCK(0x0034, 1);
+    // 0034: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0036, L0036);
+L0036:
+    AOT_BLOCK(0x0036, 1);
+    // 0036: jsr pc, *$2712
+    {
+        a = 0x2712;
+        r[6] -= 2;
+        WR16(r[6], 0x003a);
+    }
+    AOT_GOTO(0x2712, L2712);
+L003a:
+    // 003a: sys 1
+    AOT_INTERP(0x003a);
+L003c:
+    AOT_BLOCK(0x003c, 2);
+    // 003c: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0040;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    AOT_GOTO(0x0040, L0040);
+L003e:
+    AOT_BLOCK(0x003e, 1);
+    // 003e: cmp *-(r3), (sp)+
+    {
+        r[3] -= 2;
+        a = RD16(r[3]);
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0040, L0040);
+L0040:
+    AOT_BLOCK(0x0040, 1);
+    // 0040: tst 8474
+    {
+        a = 0x8474;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0044, L0044);
+L0042:
+    AOT_BLOCK(0x0042, 1);
+    // 0042: bvc 00a4
+    if (!V)
+        AOT_GOTO(0x00a4, L00a4);
+    AOT_GOTO(0x0044, L0044);
+L0044:
+    AOT_BLOCK(0x0044, 1);
+    // 0044: bne 006a
+    if (!Z)
+        AOT_GOTO(0x006a, L006a);
+    AOT_GOTO(0x0046, L0046);
+L0046:
+    AOT_BLOCK(0x0046, 2);
+    // 0046: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 004a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    AOT_GOTO(0x004c, L004c);
+L004c:
+    AOT_BLOCK(0x004c, 5);
+    // 004c: mov -7bf0(r0), (sp)
+    {
+        a = uint16_t(r[0] + -31728);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0050: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0054: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0056: mov -7bb4(r0), -(sp)
+    {
+        a = uint16_t(r[0] + -31668);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 005a: mov $4122, -(sp)
+    {
+        src = uint16_t(0x4122);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x005e, L005e);
+L005e:
+    AOT_BLOCK(0x005e, 2);
+    // 005e: mov 4008, -(sp)
+    {
+        a = 0x4008;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0062: jsr pc, *$201c
+    {
+        a = 0x201c;
+        r[6] -= 2;
+        WR16(r[6], 0x0066);
+    }
+    AOT_GOTO(0x201c, L201c);
+L0066:
+    AOT_BLOCK(0x0066, 1);
+    // 0066: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x006a, L006a);
+L006a:
+    AOT_BLOCK(0x006a, 2);
+    // 006a: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L006e:
+    AOT_BLOCK(0x006e, 2);
+    // 006e: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0072;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    AOT_GOTO(0x0072, L0072);
+L0072:
+    AOT_BLOCK(0x0072, 3);
+    // 0072: mov 4c90, r4
+    {
+        a = 0x4c90;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0076: cmp 4c92, r4
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 007a: beq 00b6
+    if (Z)
+        AOT_GOTO(0x00b6, L00b6);
+    AOT_GOTO(0x007c, L007c);
+L007c:
+    AOT_BLOCK(0x007c, 2);
+    // 007c: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0080: bne 00b6
+    if (!Z)
+        AOT_GOTO(0x00b6, L00b6);
+    AOT_GOTO(0x0082, L0082);
+L0082:
+    AOT_BLOCK(0x0082, 2);
+    // 0082: mov 4008, r2
+    {
+        a = 0x4008;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0086: br 00ac
+    AOT_GOTO(0x00ac, L00ac);
+L0088:
+    AOT_BLOCK(0x0088, 5);
+    // 0088: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 008a: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 008e: movb r0, *0(r2)
+    {
+        src = uint8_t(r[0]);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 0092: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0094: br 00ac
+    AOT_GOTO(0x00ac, L00ac);
+L0096:
+    AOT_BLOCK(0x0096, 2);
+    // 0096: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 009a: bge 0088
+    if (!(N ^ V))
+        AOT_GOTO(0x0088, L0088);
+    AOT_GOTO(0x009c, L009c);
+L009c:
+    AOT_BLOCK(0x009c, 4);
+    // 009c: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 009e: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 00a0: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 00a2: bic $ff00, (sp)
+    {
+        src = uint16_t(0xff00);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x00a6, L00a6);
+L00a4:
+    // 00a4: (undefined)
+    AOT_INTERP(0x00a4);
+L00a6:
+    AOT_BLOCK(0x00a6, 1);
+    // 00a6: jsr pc, *$2424
+    {
+        a = 0x2424;
+        r[6] -= 2;
+        WR16(r[6], 0x00aa);
+    }
+    AOT_GOTO(0x2424, L2424);
+L00aa:
+    AOT_BLOCK(0x00aa, 1);
+    // 00aa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x00ac, L00ac);
+L00ac:
+    AOT_BLOCK(0x00ac, 2);
+    // 00ac: cmp 4c92, r4
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00b0: bhi 0096
+    if (!(C | Z))
+        AOT_GOTO(0x0096, L0096);
+    AOT_GOTO(0x00b2, L00b2);
+L00b2:
+    AOT_BLOCK(0x00b2, 1);
+    // 00b2: mov r4, 4c90
+    {
+        src = r[4];
+        b = 0x4c90;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x00b6, L00b6);
+L00b6:
+    AOT_BLOCK(0x00b6, 2);
+    // 00b6: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L00ba:
+    AOT_BLOCK(0x00ba, 5);
+    // 00ba: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x00be;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 00be: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 00c2: sub $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 00c6: jsr pc, 006e
+    {
+        a = 0x006e;
+        r[6] -= 2;
+        WR16(r[6], 0x00ca);
+    }
+    AOT_GOTO(0x006e, L006e);
+L00ca:
+    AOT_BLOCK(0x00ca, 10);
+    // 00ca: mov 4c8c, r0
+    {
+        a = 0x4c8c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 00ce: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 00d0: sub 4c92, r1
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+    }
+    // 00d4: sub r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 00d6: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 00d8: mov 4c92, r2
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 00dc: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 00de: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 00e0: cmp 4c8a, r0
+    {
+        a = 0x4c8a;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 00e4: bcs 00fa
+    if (C)
+        AOT_GOTO(0x00fa, L00fa);
+    AOT_GOTO(0x00e6, L00e6);
+L00e6:
+    AOT_BLOCK(0x00e6, 2);
+    // 00e6: mov $412d, (sp)
+    {
+        src = uint16_t(0x412d);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 00ea: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x00ee);
+    }
+    AOT_GOTO(0x106a, L106a);
+L00ee:
+    AOT_BLOCK(0x00ee, 3);
+    // 00ee: mov 4c8a, r3
+    {
+        a = 0x4c8a;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 00f2: mov 4c92, r4
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 00f6: add $200, r4
+    {
+        src = uint16_t(0x0200);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x00fa, L00fa);
+L00fa:
+    AOT_BLOCK(0x00fa, 3);
+    // 00fa: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 00fc: sub 4c92, r0
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0100: add r0, 83fa
+    {
+        src = r[0];
+        b = 0x83fa;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0104, L0104);
+L0104:
+    AOT_BLOCK(0x0104, 1);
+    // 0104: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0106, L0106);
+L0106:
+    AOT_BLOCK(0x0106, 1);
+    // 0106: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x010a, L010a);
+L010a:
+    AOT_BLOCK(0x010a, 2);
+    // 010a: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 010e: br 0112
+    AOT_GOTO(0x0112, L0112);
+L0110:
+    AOT_BLOCK(0x0110, 1);
+    // 0110: movb (r2)+, (r3)+
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0112, L0112);
+L0112:
+    AOT_BLOCK(0x0112, 2);
+    // 0112: cmp r4, r2
+    {
+        src = r[4];
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0114: bhi 0110
+    if (!(C | Z))
+        AOT_GOTO(0x0110, L0110);
+    AOT_GOTO(0x0116, L0116);
+L0116:
+    AOT_BLOCK(0x0116, 1);
+    // 0116: mov r3, r4
+    {
+        src = r[3];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0118, L0118);
+L0118:
+    AOT_BLOCK(0x0118, 4);
+    // 0118: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 011c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 011e: cmp 8396, -7c04(r0)
+    {
+        a = 0x8396;
+        src = RD16(a);
+        b = uint16_t(r[0] + -31748);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0124: ble 0182
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0182, L0182);
+    AOT_GOTO(0x0126, L0126);
+L0126:
+    AOT_BLOCK(0x0126, 5);
+    // 0126: dec 8396
+    {
+        a = 0x8396;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 012a: mov 8396, r0
+    {
+        a = 0x8396;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 012e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0130: mov -7c66(r0), r2
+    {
+        a = uint16_t(r[0] + -31846);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0134: mov 4c8c, r3
+    {
+        a = 0x4c8c;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0138, L0138);
+L0138:
+    AOT_BLOCK(0x0138, 2);
+    // 0138: movb (r2)+, (r3)+
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 013a: bne 0138
+    if (!Z)
+        AOT_GOTO(0x0138, L0138);
+    AOT_GOTO(0x013c, L013c);
+L013c:
+    AOT_BLOCK(0x013c, 4);
+    // 013c: mov 8396, r0
+    {
+        a = 0x8396;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0140: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0142: cmp r2, -7c2e(r0)
+    {
+        src = r[2];
+        b = uint16_t(r[0] + -31790);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0146: bcs 0138
+    if (C)
+        AOT_GOTO(0x0138, L0138);
+    AOT_GOTO(0x0148, L0148);
+L0148:
+    AOT_BLOCK(0x0148, 5);
+    // 0148: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 014a: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+    }
+    // 014c: mov r0, 4c8e
+    {
+        src = r[0];
+        b = 0x4c8e;
+        WR16(b, src);
+    }
+    // 0150: cmp $e, 8398
+    {
+        src = uint16_t(0x000e);
+        b = 0x8398;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0156: ble 0228
+    if (Z || (N ^ V))
+        AOT_GOTO(0x0228, L0228);
+    AOT_GOTO(0x0158, L0158);
+L0158:
+    AOT_BLOCK(0x0158, 7);
+    // 0158: mov 8398, r0
+    {
+        a = 0x8398;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 015c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 015e: inc 8398
+    {
+        a = 0x8398;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0162: mov 8396, r1
+    {
+        a = 0x8396;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0166: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0168: mov -7c66(r1), -7c4a(r0)
+    {
+        a = uint16_t(r[1] + -31846);
+        src = RD16(a);
+        b = uint16_t(r[0] + -31818);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 016e: br 0228
+    AOT_GOTO(0x0228, L0228);
+L0170:
+    AOT_BLOCK(0x0170, 5);
+    // 0170: mov 4c8c, r0
+    {
+        a = 0x4c8c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0174: add -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0178: mov r0, 4c8e
+    {
+        src = r[0];
+        b = 0x4c8e;
+        WR16(b, src);
+    }
+    // 017c: clrb *4c8e
+    {
+        a = RD16(0x4c8e);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0180: br 0228
+    AOT_GOTO(0x0228, L0228);
+L0182:
+    AOT_BLOCK(0x0182, 5);
+    // 0182: clr 83f6
+    {
+        a = 0x83f6;
+        WR16(a, 0);
+        C = false;
+    }
+    // 0186: mov $200, (sp)
+    {
+        src = uint16_t(0x0200);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 018a: mov 4c8c, -(sp)
+    {
+        a = 0x4c8c;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 018e: mov 4006, -(sp)
+    {
+        a = 0x4006;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0192: jsr pc, *$2a7a
+    {
+        a = 0x2a7a;
+        r[6] -= 2;
+        WR16(r[6], 0x0196);
+    }
+    AOT_GOTO(0x2a7a, L2a7a);
+L0196:
+    AOT_BLOCK(0x0196, 3);
+    // 0196: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0198: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 019c: bgt 0170
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0170, L0170);
+    AOT_GOTO(0x019e, L019e);
+L019e:
+    AOT_BLOCK(0x019e, 2);
+    // 019e: tst 847a
+    {
+        a = 0x847a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 01a2: bne 023e
+    if (!Z)
+        AOT_GOTO(0x023e, L023e);
+    AOT_GOTO(0x01a4, L01a4);
+L01a4:
+    AOT_BLOCK(0x01a4, 2);
+    // 01a4: tst 83ee
+    {
+        a = 0x83ee;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 01a8: beq 022e
+    if (Z)
+        AOT_GOTO(0x022e, L022e);
+    AOT_GOTO(0x01aa, L01aa);
+L01aa:
+    AOT_BLOCK(0x01aa, 16);
+    // 01aa: mov 83ee, -a(r5)
+    {
+        a = 0x83ee;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 01b0: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01b4: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 01b6: mov -7bb4(r0), -c(r5)
+    {
+        a = uint16_t(r[0] + -31668);
+        src = RD16(a);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 01bc: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01c0: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 01c2: mov -7bf0(r0), -e(r5)
+    {
+        a = uint16_t(r[0] + -31728);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 01c8: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01cc: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 01ce: mov 83f0, -7bb4(r0)
+    {
+        a = 0x83f0;
+        src = RD16(a);
+        b = uint16_t(r[0] + -31668);
+        WR16(b, src);
+    }
+    // 01d4: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01d8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 01da: mov 83f2, -7bf0(r0)
+    {
+        a = 0x83f2;
+        src = RD16(a);
+        b = uint16_t(r[0] + -31728);
+        WR16(b, src);
+    }
+    // 01e0: mov 83f4, (sp)
+    {
+        a = 0x83f4;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 01e4: mov $413c, -(sp)
+    {
+        src = uint16_t(0x413c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 01e8: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x01ec);
+    }
+    AOT_GOTO(0x106a, L106a);
+L01ec:
+    AOT_BLOCK(0x01ec, 7);
+    // 01ec: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 01ee: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01f2: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 01f4: mov -c(r5), -7bb4(r0)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        b = uint16_t(r[0] + -31668);
+        WR16(b, src);
+    }
+    // 01fa: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 01fe: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0200: mov -e(r5), -7bf0(r0)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        b = uint16_t(r[0] + -31728);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0206, L0206);
+L0206:
+    AOT_BLOCK(0x0206, 3);
+    // 0206: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 0208: movb $a, (r3)+
+    {
+        src = uint8_t(0x0a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 020c: br 0212
+    AOT_GOTO(0x0212, L0212);
+L020e:
+    AOT_BLOCK(0x020e, 1);
+    // 020e: movb $29, (r3)+
+    {
+        src = uint8_t(0x29);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0212, L0212);
+L0212:
+    AOT_BLOCK(0x0212, 2);
+    // 0212: dec -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0216: bge 020e
+    if (!(N ^ V))
+        AOT_GOTO(0x020e, L020e);
+    AOT_GOTO(0x0218, L0218);
+L0218:
+    AOT_BLOCK(0x0218, 4);
+    // 0218: mov r3, 4c8e
+    {
+        src = r[3];
+        b = 0x4c8e;
+        WR16(b, src);
+    }
+    // 021c: clrb (r3)
+    {
+        a = r[3];
+        WR8(a, 0);
+    }
+    // 021e: tst 83ee
+    {
+        a = 0x83ee;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0222: bge 0228
+    if (!(N ^ V))
+        AOT_GOTO(0x0228, L0228);
+    AOT_GOTO(0x0224, L0224);
+L0224:
+    AOT_BLOCK(0x0224, 1);
+    // 0224: clr 83ee
+    {
+        a = 0x83ee;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0228, L0228);
+L0228:
+    AOT_BLOCK(0x0228, 3);
+    // 0228: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 022a: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L022e:
+    AOT_BLOCK(0x022e, 2);
+    // 022e: mov r4, 4c92
+    {
+        src = r[4];
+        b = 0x4c92;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0232: jsr pc, 006e
+    {
+        a = 0x006e;
+        r[6] -= 2;
+        WR16(r[6], 0x0236);
+    }
+    AOT_GOTO(0x006e, L006e);
+L0236:
+    AOT_BLOCK(0x0236, 2);
+    // 0236: mov 84cc, (sp)
+    {
+        a = 0x84cc;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 023a: jsr pc, *$2712
+    {
+        a = 0x2712;
+        r[6] -= 2;
+        WR16(r[6], 0x023e);
+    }
+    AOT_GOTO(0x2712, L2712);
+L023e:
+    AOT_BLOCK(0x023e, 2);
+    // 023e: mov 4006, (sp)
+    {
+        a = 0x4006;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0242: jsr pc, *$29d6
+    {
+        a = 0x29d6;
+        r[6] -= 2;
+        WR16(r[6], 0x0246);
+    }
+    AOT_GOTO(0x29d6, L29d6);
+L0246:
+    AOT_BLOCK(0x0246, 8);
+    // 0246: dec 847a
+    {
+        a = 0x847a;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 024a: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 024e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0250: mov -7bc8(r0), 4006
+    {
+        a = uint16_t(r[0] + -31688);
+        src = RD16(a);
+        b = 0x4006;
+        WR16(b, src);
+    }
+    // 0256: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 025a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 025c: mov -7bdc(r0), 8460
+    {
+        a = uint16_t(r[0] + -31708);
+        src = RD16(a);
+        b = 0x8460;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0262: jsr pc, 003c
+    {
+        a = 0x003c;
+        r[6] -= 2;
+        WR16(r[6], 0x0266);
+    }
+    AOT_GOTO(0x003c, L003c);
+L0266:
+    AOT_BLOCK(0x0266, 1);
+    // 0266: jmp *$0118
+    {
+        a = 0x0118;
+    }
+    AOT_GOTO(0x0118, L0118);
+L026a:
+    AOT_BLOCK(0x026a, 6);
+    // 026a: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x026e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 026e: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0272: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 0274: tst 4010
+    {
+        a = 0x4010;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0278: beq 027e
+    if (Z)
+        AOT_GOTO(0x027e, L027e);
+    AOT_GOTO(0x027a, L027a);
+L027a:
+    AOT_BLOCK(0x027a, 1);
+    // 027a: jmp *$0578
+    {
+        a = 0x0578;
+    }
+    AOT_GOTO(0x0578, L0578);
+L027e:
+    AOT_BLOCK(0x027e, 4);
+    // 027e: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0280: add 50a4, r0
+    {
+        a = 0x50a4;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0284: bitb $2, (r0)
+    {
+        src = uint8_t(0x02);
+        b = r[0];
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0288: beq 027e
+    if (Z)
+        AOT_GOTO(0x027e, L027e);
+    AOT_GOTO(0x028a, L028a);
+L028a:
+    AOT_BLOCK(0x028a, 6);
+    // 028a: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 028c: dec r0
+    {
+        val = int(int16_t(r[0])) - 1;
+        r[0] = val;
+    }
+    // 028e: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0292: movb (r0), r0
+    {
+        a = r[0];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0294: cmp r0, $7c
+    {
+        src = r[0];
+        dst = uint16_t(0x007c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0298: bhi 02b4
+    if (!(C | Z))
+        AOT_GOTO(0x02b4, L02b4);
+    AOT_GOTO(0x029a, L029a);
+L029a:
+    AOT_BLOCK(0x029a, 2);
+    // 029a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 029c: jmp *4012(r0)
+    {
+        a = RD16(r[0] + 16402);
+    }
+    AOT_JUMP(a);
+L02a0:
+    AOT_BLOCK(0x02a0, 3);
+    // 02a0: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 02a2: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02a6: bhi 02b2
+    if (!(C | Z))
+        AOT_GOTO(0x02b2, L02b2);
+    AOT_GOTO(0x02a8, L02a8);
+L02a8:
+    AOT_BLOCK(0x02a8, 2);
+    // 02a8: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02aa: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x02ae);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L02ae:
+    AOT_BLOCK(0x02ae, 2);
+    // 02ae: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02b0: br 027e
+    AOT_GOTO(0x027e, L027e);
+L02b2:
+    AOT_BLOCK(0x02b2, 1);
+    // 02b2: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x02b4, L02b4);
+L02b4:
+    AOT_BLOCK(0x02b4, 2);
+    // 02b4: cmp $5024, 50a4
+    {
+        src = uint16_t(0x5024);
+        b = 0x50a4;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02ba: bne 027e
+    if (!Z)
+        AOT_GOTO(0x027e, L027e);
+    AOT_GOTO(0x02bc, L02bc);
+L02bc:
+    AOT_BLOCK(0x02bc, 3);
+    // 02bc: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 02be: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L02c2:
+    AOT_BLOCK(0x02c2, 2);
+    // 02c2: cmpb *4c92, (r4)+
+    {
+        a = RD16(0x4c92);
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 02c6: beq 02b4
+    if (Z)
+        AOT_GOTO(0x02b4, L02b4);
+    AOT_GOTO(0x02c8, L02c8);
+L02c8:
+    AOT_BLOCK(0x02c8, 3);
+    // 02c8: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 02ca: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02ce: bhi 02b4
+    if (!(C | Z))
+        AOT_GOTO(0x02b4, L02b4);
+    AOT_GOTO(0x02d0, L02d0);
+L02d0:
+    AOT_BLOCK(0x02d0, 2);
+    // 02d0: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02d2: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x02d6);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L02d6:
+    AOT_BLOCK(0x02d6, 2);
+    // 02d6: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02d8: br 02c2
+    AOT_GOTO(0x02c2, L02c2);
+L02da:
+    AOT_BLOCK(0x02da, 2);
+    // 02da: cmpb $3d, (r4)+
+    {
+        src = uint8_t(0x3d);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 02de: beq 02b4
+    if (Z)
+        AOT_GOTO(0x02b4, L02b4);
+    AOT_GOTO(0x02e0, L02e0);
+L02e0:
+    AOT_BLOCK(0x02e0, 3);
+    // 02e0: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 02e2: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 02e6: bhi 02b4
+    if (!(C | Z))
+        AOT_GOTO(0x02b4, L02b4);
+    AOT_GOTO(0x02e8, L02e8);
+L02e8:
+    AOT_BLOCK(0x02e8, 2);
+    // 02e8: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02ea: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x02ee);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L02ee:
+    AOT_BLOCK(0x02ee, 2);
+    // 02ee: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 02f0: br 02da
+    AOT_GOTO(0x02da, L02da);
+L02f2:
+    AOT_BLOCK(0x02f2, 2);
+    // 02f2: cmpb $3d, (r4)+
+    {
+        src = uint8_t(0x3d);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 02f6: beq 02b4
+    if (Z)
+        AOT_GOTO(0x02b4, L02b4);
+    AOT_GOTO(0x02f8, L02f8);
+L02f8:
+    AOT_BLOCK(0x02f8, 2);
+    // 02f8: cmpb -1(r4), -2(r4)
+    {
+        a = uint16_t(r[4] + -1);
+        src = RD8(a);
+        b = uint16_t(r[4] + -2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 02fe: beq 02b4
+    if (Z)
+        AOT_GOTO(0x02b4, L02b4);
+    AOT_GOTO(0x0300, L0300);
+L0300:
+    AOT_BLOCK(0x0300, 3);
+    // 0300: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 0302: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0306: bhi 02b4
+    if (!(C | Z))
+        AOT_GOTO(0x02b4, L02b4);
+    AOT_GOTO(0x0308, L0308);
+L0308:
+    AOT_BLOCK(0x0308, 2);
+    // 0308: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 030a: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x030e);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L030e:
+    AOT_BLOCK(0x030e, 2);
+    // 030e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0310: br 02f2
+    AOT_GOTO(0x02f2, L02f2);
+L0312:
+    AOT_BLOCK(0x0312, 3);
+    // 0312: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 0314: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0318: bhi 02b2
+    if (!(C | Z))
+        AOT_GOTO(0x02b2, L02b2);
+    AOT_GOTO(0x031a, L031a);
+L031a:
+    AOT_BLOCK(0x031a, 2);
+    // 031a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 031c: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0320);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L0320:
+    AOT_BLOCK(0x0320, 1);
+    // 0320: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0322, L0322);
+L0322:
+    AOT_BLOCK(0x0322, 2);
+    // 0322: cmpb $a, (r4)+
+    {
+        src = uint8_t(0x0a);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0326: bne 0312
+    if (!Z)
+        AOT_GOTO(0x0312, L0312);
+    AOT_GOTO(0x0328, L0328);
+L0328:
+    AOT_BLOCK(0x0328, 4);
+    // 0328: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 032c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 032e: inc -7bb4(r0)
+    {
+        a = uint16_t(r[0] + -31668);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0332: br 02b4
+    AOT_GOTO(0x02b4, L02b4);
+L0334:
+    AOT_BLOCK(0x0334, 2);
+    // 0334: mov r4, 4c92
+    {
+        src = r[4];
+        b = 0x4c92;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0338: br 039a
+    AOT_GOTO(0x039a, L039a);
+L033a:
+    AOT_BLOCK(0x033a, 3);
+    // 033a: mov r4, 4c92
+    {
+        src = r[4];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 033e: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0340: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0344);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L0344:
+    AOT_BLOCK(0x0344, 4);
+    // 0344: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0346: mov 4008, r0
+    {
+        a = 0x4008;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 034a: dec 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 034e: blt 035e
+    if (N ^ V)
+        AOT_GOTO(0x035e, L035e);
+    AOT_GOTO(0x0350, L0350);
+L0350:
+    AOT_BLOCK(0x0350, 4);
+    // 0350: mov *4008, r0
+    {
+        a = RD16(0x4008);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0354: inc *4008
+    {
+        a = RD16(0x4008);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0358: movb $2f, (r0)
+    {
+        src = uint8_t(0x2f);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 035c: br 036c
+    AOT_GOTO(0x036c, L036c);
+L035e:
+    AOT_BLOCK(0x035e, 3);
+    // 035e: mov 4008, (sp)
+    {
+        a = 0x4008;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0362: mov $2f, -(sp)
+    {
+        src = uint16_t(0x002f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0366: jsr pc, *$2424
+    {
+        a = 0x2424;
+        r[6] -= 2;
+        WR16(r[6], 0x036a);
+    }
+    AOT_GOTO(0x2424, L2424);
+L036a:
+    AOT_BLOCK(0x036a, 1);
+    // 036a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x036c, L036c);
+L036c:
+    AOT_BLOCK(0x036c, 8);
+    // 036c: sub $3, r4
+    {
+        src = uint16_t(0x0003);
+        dst = r[4];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[4] = val16;
+        C = dst < src;
+    }
+    // 0370: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0372: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0376: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 037a: movb $2f, (r4)+
+    {
+        src = uint8_t(0x2f);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+    }
+    // 037e: movb $2a, (r4)+
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+    }
+    // 0382: movb $2a, (r4)+
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0386: br 03a2
+    AOT_GOTO(0x03a2, L03a2);
+L0388:
+    AOT_BLOCK(0x0388, 2);
+    // 0388: tst 8476
+    {
+        a = 0x8476;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 038c: beq 0334
+    if (Z)
+        AOT_GOTO(0x0334, L0334);
+    AOT_GOTO(0x038e, L038e);
+L038e:
+    AOT_BLOCK(0x038e, 4);
+    // 038e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0390: sub 4c92, r0
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 0394: cmp $200, r0
+    {
+        src = uint16_t(0x0200);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0398: ble 033a
+    if (Z || (N ^ V))
+        AOT_GOTO(0x033a, L033a);
+    AOT_GOTO(0x039a, L039a);
+L039a:
+    AOT_BLOCK(0x039a, 2);
+    // 039a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 039c: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x03a0);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L03a0:
+    AOT_BLOCK(0x03a0, 1);
+    // 03a0: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03a2, L03a2);
+L03a2:
+    AOT_BLOCK(0x03a2, 2);
+    // 03a2: cmpb $2f, (r4)+
+    {
+        src = uint8_t(0x2f);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 03a6: bne 03ac
+    if (!Z)
+        AOT_GOTO(0x03ac, L03ac);
+    AOT_GOTO(0x03a8, L03a8);
+L03a8:
+    AOT_BLOCK(0x03a8, 1);
+    // 03a8: jmp *$04a2
+    {
+        a = 0x04a2;
+    }
+    AOT_GOTO(0x04a2, L04a2);
+L03ac:
+    AOT_BLOCK(0x03ac, 3);
+    // 03ac: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 03ae: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 03b2: blos 0388
+    if (C | Z)
+        AOT_GOTO(0x0388, L0388);
+    AOT_GOTO(0x03b4, L03b4);
+L03b4:
+    AOT_BLOCK(0x03b4, 1);
+    // 03b4: br 0400
+    AOT_GOTO(0x0400, L0400);
+L03b6:
+    AOT_BLOCK(0x03b6, 5);
+    // 03b6: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 03ba: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 03bc: inc -7bb4(r0)
+    {
+        a = uint16_t(r[0] + -31668);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 03c0: tst 8476
+    {
+        a = 0x8476;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03c4: bne 0400
+    if (!Z)
+        AOT_GOTO(0x0400, L0400);
+    AOT_GOTO(0x03c6, L03c6);
+L03c6:
+    AOT_BLOCK(0x03c6, 3);
+    // 03c6: mov 4008, r0
+    {
+        a = 0x4008;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 03ca: dec 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 03ce: blt 03de
+    if (N ^ V)
+        AOT_GOTO(0x03de, L03de);
+    AOT_GOTO(0x03d0, L03d0);
+L03d0:
+    AOT_BLOCK(0x03d0, 4);
+    // 03d0: mov *4008, r0
+    {
+        a = RD16(0x4008);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 03d4: inc *4008
+    {
+        a = RD16(0x4008);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 03d8: movb $a, (r0)
+    {
+        src = uint8_t(0x0a);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 03dc: br 0400
+    AOT_GOTO(0x0400, L0400);
+L03de:
+    AOT_BLOCK(0x03de, 3);
+    // 03de: mov 4008, (sp)
+    {
+        a = 0x4008;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 03e2: mov $a, -(sp)
+    {
+        src = uint16_t(0x000a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03e6: jsr pc, *$2424
+    {
+        a = 0x2424;
+        r[6] -= 2;
+        WR16(r[6], 0x03ea);
+    }
+    AOT_GOTO(0x2424, L2424);
+L03ea:
+    AOT_BLOCK(0x03ea, 2);
+    // 03ea: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03ec: br 0400
+    AOT_GOTO(0x0400, L0400);
+L03ee:
+    AOT_BLOCK(0x03ee, 2);
+    // 03ee: tst 8476
+    {
+        a = 0x8476;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 03f2: bne 0426
+    if (!Z)
+        AOT_GOTO(0x0426, L0426);
+    AOT_GOTO(0x03f4, L03f4);
+L03f4:
+    AOT_BLOCK(0x03f4, 1);
+    // 03f4: mov r4, 4c92
+    {
+        src = r[4];
+        b = 0x4c92;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x03f8, L03f8);
+L03f8:
+    AOT_BLOCK(0x03f8, 2);
+    // 03f8: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 03fa: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x03fe);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L03fe:
+    AOT_BLOCK(0x03fe, 1);
+    // 03fe: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0400, L0400);
+L0400:
+    AOT_BLOCK(0x0400, 3);
+    // 0400: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0402: bitb $8, 4f24(r0)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[0] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0408: beq 0400
+    if (Z)
+        AOT_GOTO(0x0400, L0400);
+    AOT_GOTO(0x040a, L040a);
+L040a:
+    AOT_BLOCK(0x040a, 2);
+    // 040a: cmpb $2a, -1(r4)
+    {
+        src = uint8_t(0x2a);
+        b = uint16_t(r[4] + -1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0410: beq 03a2
+    if (Z)
+        AOT_GOTO(0x03a2, L03a2);
+    AOT_GOTO(0x0412, L0412);
+L0412:
+    AOT_BLOCK(0x0412, 2);
+    // 0412: cmpb $a, -1(r4)
+    {
+        src = uint8_t(0x0a);
+        b = uint16_t(r[4] + -1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0418: beq 03b6
+    if (Z)
+        AOT_GOTO(0x03b6, L03b6);
+    AOT_GOTO(0x041a, L041a);
+L041a:
+    AOT_BLOCK(0x041a, 3);
+    // 041a: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 041c: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0420: blos 03ee
+    if (C | Z)
+        AOT_GOTO(0x03ee, L03ee);
+    AOT_GOTO(0x0422, L0422);
+L0422:
+    AOT_BLOCK(0x0422, 2);
+    // 0422: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0424: br 0400
+    AOT_GOTO(0x0400, L0400);
+L0426:
+    AOT_BLOCK(0x0426, 4);
+    // 0426: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0428: sub 4c92, r0
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 042c: cmp $200, r0
+    {
+        src = uint16_t(0x0200);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0430: bgt 03f8
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x03f8, L03f8);
+    AOT_GOTO(0x0432, L0432);
+L0432:
+    AOT_BLOCK(0x0432, 3);
+    // 0432: mov r4, 4c92
+    {
+        src = r[4];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0436: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0438: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x043c);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L043c:
+    AOT_BLOCK(0x043c, 4);
+    // 043c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 043e: mov 4008, r0
+    {
+        a = 0x4008;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0442: dec 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0446: blt 0456
+    if (N ^ V)
+        AOT_GOTO(0x0456, L0456);
+    AOT_GOTO(0x0448, L0448);
+L0448:
+    AOT_BLOCK(0x0448, 4);
+    // 0448: mov *4008, r0
+    {
+        a = RD16(0x4008);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 044c: inc *4008
+    {
+        a = RD16(0x4008);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0450: movb $2a, (r0)
+    {
+        src = uint8_t(0x2a);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0454: br 0464
+    AOT_GOTO(0x0464, L0464);
+L0456:
+    AOT_BLOCK(0x0456, 3);
+    // 0456: mov 4008, (sp)
+    {
+        a = 0x4008;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 045a: mov $2a, -(sp)
+    {
+        src = uint16_t(0x002a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 045e: jsr pc, *$2424
+    {
+        a = 0x2424;
+        r[6] -= 2;
+        WR16(r[6], 0x0462);
+    }
+    AOT_GOTO(0x2424, L2424);
+L0462:
+    AOT_BLOCK(0x0462, 1);
+    // 0462: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0464, L0464);
+L0464:
+    AOT_BLOCK(0x0464, 3);
+    // 0464: mov 4008, r0
+    {
+        a = 0x4008;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0468: dec 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 046c: blt 047c
+    if (N ^ V)
+        AOT_GOTO(0x047c, L047c);
+    AOT_GOTO(0x046e, L046e);
+L046e:
+    AOT_BLOCK(0x046e, 4);
+    // 046e: mov *4008, r0
+    {
+        a = RD16(0x4008);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0472: inc *4008
+    {
+        a = RD16(0x4008);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0476: movb $2f, (r0)
+    {
+        src = uint8_t(0x2f);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 047a: br 048a
+    AOT_GOTO(0x048a, L048a);
+L047c:
+    AOT_BLOCK(0x047c, 3);
+    // 047c: mov 4008, (sp)
+    {
+        a = 0x4008;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0480: mov $2f, -(sp)
+    {
+        src = uint16_t(0x002f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0484: jsr pc, *$2424
+    {
+        a = 0x2424;
+        r[6] -= 2;
+        WR16(r[6], 0x0488);
+    }
+    AOT_GOTO(0x2424, L2424);
+L0488:
+    AOT_BLOCK(0x0488, 1);
+    // 0488: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x048a, L048a);
+L048a:
+    AOT_BLOCK(0x048a, 7);
+    // 048a: sub $2, r4
+    {
+        src = uint16_t(0x0002);
+        dst = r[4];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[4] = val16;
+        C = dst < src;
+    }
+    // 048e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0490: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0494: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 0498: movb $2f, (r4)+
+    {
+        src = uint8_t(0x2f);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+    }
+    // 049c: movb $2a, (r4)+
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 04a0: br 0400
+    AOT_GOTO(0x0400, L0400);
+L04a2:
+    AOT_BLOCK(0x04a2, 2);
+    // 04a2: tst 8476
+    {
+        a = 0x8476;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04a6: beq 04ac
+    if (Z)
+        AOT_GOTO(0x04ac, L04ac);
+    AOT_GOTO(0x04a8, L04a8);
+L04a8:
+    AOT_BLOCK(0x04a8, 1);
+    // 04a8: jmp *$02b4
+    {
+        a = 0x02b4;
+    }
+    AOT_GOTO(0x02b4, L02b4);
+L04ac:
+    AOT_BLOCK(0x04ac, 5);
+    // 04ac: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 04ae: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 04b2: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 04b6: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 04ba: jmp *$027e
+    {
+        a = 0x027e;
+    }
+    AOT_GOTO(0x027e, L027e);
+L04be:
+    AOT_BLOCK(0x04be, 3);
+    // 04be: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 04c0: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 04c4: blos 04ca
+    if (C | Z)
+        AOT_GOTO(0x04ca, L04ca);
+    AOT_GOTO(0x04c6, L04c6);
+L04c6:
+    AOT_BLOCK(0x04c6, 1);
+    // 04c6: jmp *$02b4
+    {
+        a = 0x02b4;
+    }
+    AOT_GOTO(0x02b4, L02b4);
+L04ca:
+    AOT_BLOCK(0x04ca, 2);
+    // 04ca: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04cc: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x04d0);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L04d0:
+    AOT_BLOCK(0x04d0, 1);
+    // 04d0: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x04d2, L04d2);
+L04d2:
+    AOT_BLOCK(0x04d2, 2);
+    // 04d2: cmpb $2a, (r4)+
+    {
+        src = uint8_t(0x2a);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 04d6: bne 04be
+    if (!Z)
+        AOT_GOTO(0x04be, L04be);
+    AOT_GOTO(0x04d8, L04d8);
+L04d8:
+    AOT_BLOCK(0x04d8, 2);
+    // 04d8: tst 8476
+    {
+        a = 0x8476;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 04dc: bne 0400
+    if (!Z)
+        AOT_GOTO(0x0400, L0400);
+    AOT_GOTO(0x04de, L04de);
+L04de:
+    AOT_BLOCK(0x04de, 4);
+    // 04de: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 04e0: add $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 04e4: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04e8: jsr pc, 006e
+    {
+        a = 0x006e;
+        r[6] -= 2;
+        WR16(r[6], 0x04ec);
+    }
+    AOT_GOTO(0x006e, L006e);
+L04ec:
+    AOT_BLOCK(0x04ec, 2);
+    // 04ec: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 04f0: br 0400
+    AOT_GOTO(0x0400, L0400);
+L04f2:
+    AOT_BLOCK(0x04f2, 2);
+    // 04f2: movb -1(r4), -8(r5)
+    {
+        a = uint16_t(r[4] + -1);
+        src = RD8(a);
+        b = uint16_t(r[5] + -8);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 04f8: br 051e
+    AOT_GOTO(0x051e, L051e);
+L04fa:
+    AOT_BLOCK(0x04fa, 2);
+    // 04fa: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 04fc: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0500);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L0500:
+    AOT_BLOCK(0x0500, 1);
+    // 0500: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0502, L0502);
+L0502:
+    AOT_BLOCK(0x0502, 2);
+    // 0502: cmpb $a, (r4)+
+    {
+        src = uint8_t(0x0a);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0506: bne 0514
+    if (!Z)
+        AOT_GOTO(0x0514, L0514);
+    AOT_GOTO(0x0508, L0508);
+L0508:
+    AOT_BLOCK(0x0508, 4);
+    // 0508: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 050c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 050e: inc -7bb4(r0)
+    {
+        a = uint16_t(r[0] + -31668);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0512: br 051e
+    AOT_GOTO(0x051e, L051e);
+L0514:
+    AOT_BLOCK(0x0514, 3);
+    // 0514: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 0516: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 051a: blos 04fa
+    if (C | Z)
+        AOT_GOTO(0x04fa, L04fa);
+    AOT_GOTO(0x051c, L051c);
+L051c:
+    AOT_BLOCK(0x051c, 1);
+    // 051c: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x051e, L051e);
+L051e:
+    AOT_BLOCK(0x051e, 3);
+    // 051e: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0520: bitb $10, 4f24(r0)
+    {
+        src = uint8_t(0x10);
+        b = uint16_t(r[0] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0526: beq 051e
+    if (Z)
+        AOT_GOTO(0x051e, L051e);
+    AOT_GOTO(0x0528, L0528);
+L0528:
+    AOT_BLOCK(0x0528, 2);
+    // 0528: cmpb -8(r5), -1(r4)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD8(a);
+        b = uint16_t(r[4] + -1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 052e: bne 0534
+    if (!Z)
+        AOT_GOTO(0x0534, L0534);
+    AOT_GOTO(0x0530, L0530);
+L0530:
+    AOT_BLOCK(0x0530, 1);
+    // 0530: jmp *$02b4
+    {
+        a = 0x02b4;
+    }
+    AOT_GOTO(0x02b4, L02b4);
+L0534:
+    AOT_BLOCK(0x0534, 2);
+    // 0534: cmpb $a, -1(r4)
+    {
+        src = uint8_t(0x0a);
+        b = uint16_t(r[4] + -1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 053a: bne 0542
+    if (!Z)
+        AOT_GOTO(0x0542, L0542);
+    AOT_GOTO(0x053c, L053c);
+L053c:
+    AOT_BLOCK(0x053c, 2);
+    // 053c: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 053e: jmp *$02b4
+    {
+        a = 0x02b4;
+    }
+    AOT_GOTO(0x02b4, L02b4);
+L0542:
+    AOT_BLOCK(0x0542, 2);
+    // 0542: cmpb $5c, -1(r4)
+    {
+        src = uint8_t(0x5c);
+        b = uint16_t(r[4] + -1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0548: beq 0502
+    if (Z)
+        AOT_GOTO(0x0502, L0502);
+    AOT_GOTO(0x054a, L054a);
+L054a:
+    AOT_BLOCK(0x054a, 3);
+    // 054a: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 054c: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0550: bhi 051c
+    if (!(C | Z))
+        AOT_GOTO(0x051c, L051c);
+    AOT_GOTO(0x0552, L0552);
+L0552:
+    AOT_BLOCK(0x0552, 2);
+    // 0552: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0554: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0558);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L0558:
+    AOT_BLOCK(0x0558, 2);
+    // 0558: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 055a: br 051e
+    AOT_GOTO(0x051e, L051e);
+L055c:
+    AOT_BLOCK(0x055c, 5);
+    // 055c: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0560: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0562: inc -7bb4(r0)
+    {
+        a = uint16_t(r[0] + -31668);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0566: cmp $5024, 50a4
+    {
+        src = uint16_t(0x5024);
+        b = 0x50a4;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 056c: bne 0578
+    if (!Z)
+        AOT_GOTO(0x0578, L0578);
+    AOT_GOTO(0x056e, L056e);
+L056e:
+    AOT_BLOCK(0x056e, 2);
+    // 056e: mov $1, 4010
+    {
+        src = uint16_t(0x0001);
+        b = 0x4010;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0574: jmp *$02bc
+    {
+        a = 0x02bc;
+    }
+    AOT_GOTO(0x02bc, L02bc);
+L0578:
+    AOT_BLOCK(0x0578, 1);
+    // 0578: clr 4010
+    {
+        a = 0x4010;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x057c, L057c);
+L057c:
+    AOT_BLOCK(0x057c, 2);
+    // 057c: cmpb $23, (r4)+
+    {
+        src = uint8_t(0x23);
+        b = r[4];
+        r[4] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0580: bne 0586
+    if (!Z)
+        AOT_GOTO(0x0586, L0586);
+    AOT_GOTO(0x0582, L0582);
+L0582:
+    AOT_BLOCK(0x0582, 1);
+    // 0582: jmp *$02bc
+    {
+        a = 0x02bc;
+    }
+    AOT_GOTO(0x02bc, L02bc);
+L0586:
+    AOT_BLOCK(0x0586, 5);
+    // 0586: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 0588: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 058a: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 058e: cmp 4c8e, r0
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0592: blos 0598
+    if (C | Z)
+        AOT_GOTO(0x0598, L0598);
+    AOT_GOTO(0x0594, L0594);
+L0594:
+    AOT_BLOCK(0x0594, 1);
+    // 0594: jmp *$027e
+    {
+        a = 0x027e;
+    }
+    AOT_GOTO(0x027e, L027e);
+L0598:
+    AOT_BLOCK(0x0598, 2);
+    // 0598: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 059a: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x059e);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L059e:
+    AOT_BLOCK(0x059e, 2);
+    // 059e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05a0: br 057c
+    AOT_GOTO(0x057c, L057c);
+L05a2:
+    AOT_BLOCK(0x05a2, 3);
+    // 05a2: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 05a4: bitb $4, 4f24(r0)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[0] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 05aa: bne 05a2
+    if (!Z)
+        AOT_GOTO(0x05a2, L05a2);
+    AOT_GOTO(0x05ac, L05ac);
+L05ac:
+    AOT_BLOCK(0x05ac, 3);
+    // 05ac: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 05ae: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05b2: blos 05b8
+    if (C | Z)
+        AOT_GOTO(0x05b8, L05b8);
+    AOT_GOTO(0x05b4, L05b4);
+L05b4:
+    AOT_BLOCK(0x05b4, 1);
+    // 05b4: jmp *$02b4
+    {
+        a = 0x02b4;
+    }
+    AOT_GOTO(0x02b4, L02b4);
+L05b8:
+    AOT_BLOCK(0x05b8, 2);
+    // 05b8: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05ba: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x05be);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L05be:
+    AOT_BLOCK(0x05be, 2);
+    // 05be: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05c0: br 05a2
+    AOT_GOTO(0x05a2, L05a2);
+L05c2:
+    AOT_BLOCK(0x05c2, 2);
+    // 05c2: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05c6: beq 068e
+    if (Z)
+        AOT_GOTO(0x068e, L068e);
+    AOT_GOTO(0x05c8, L05c8);
+L05c8:
+    AOT_BLOCK(0x05c8, 1);
+    // 05c8: br 069a
+    AOT_GOTO(0x069a, L069a);
+L05ca:
+    AOT_BLOCK(0x05ca, 3);
+    // 05ca: movb (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+    }
+    // 05cc: bitb $1, 4f24(r2)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[2] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 05d2: bne 05fc
+    if (!Z)
+        AOT_GOTO(0x05fc, L05fc);
+    AOT_GOTO(0x05d4, L05d4);
+L05d4:
+    AOT_BLOCK(0x05d4, 3);
+    // 05d4: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 05d6: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 05da: blos 0682
+    if (C | Z)
+        AOT_GOTO(0x0682, L0682);
+    AOT_GOTO(0x05dc, L05dc);
+L05dc:
+    AOT_BLOCK(0x05dc, 4);
+    // 05dc: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 05de: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 05e0: mov 4c92, -(sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05e4: jsr pc, *$11e0
+    {
+        a = 0x11e0;
+        r[6] -= 2;
+        WR16(r[6], 0x05e8);
+    }
+    AOT_GOTO(0x11e0, L11e0);
+L05e8:
+    AOT_BLOCK(0x05e8, 3);
+    // 05e8: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 05ea: tst 4c94
+    {
+        a = 0x4c94;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 05ee: bne 05f4
+    if (!Z)
+        AOT_GOTO(0x05f4, L05f4);
+    AOT_GOTO(0x05f0, L05f0);
+L05f0:
+    AOT_BLOCK(0x05f0, 1);
+    // 05f0: jmp *$02b4
+    {
+        a = 0x02b4;
+    }
+    AOT_GOTO(0x02b4, L02b4);
+L05f4:
+    AOT_BLOCK(0x05f4, 2);
+    // 05f4: mov 4c94, r4
+    {
+        a = 0x4c94;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 05f8: jmp *$027e
+    {
+        a = 0x027e;
+    }
+    AOT_GOTO(0x027e, L027e);
+L05fc:
+    AOT_BLOCK(0x05fc, 2);
+    // 05fc: bitb $2, 4d18(r2)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[2] + 19736);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0602: beq 069a
+    if (Z)
+        AOT_GOTO(0x069a, L069a);
+    AOT_GOTO(0x0604, L0604);
+L0604:
+    AOT_BLOCK(0x0604, 3);
+    // 0604: movb (r4)+, r3
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+    }
+    // 0606: bitb $1, 4f24(r3)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[3] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 060c: beq 05d4
+    if (Z)
+        AOT_GOTO(0x05d4, L05d4);
+    AOT_GOTO(0x060e, L060e);
+L060e:
+    AOT_BLOCK(0x060e, 2);
+    // 060e: bitb $4, 4d18(r3)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[3] + 19736);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0614: beq 069a
+    if (Z)
+        AOT_GOTO(0x069a, L069a);
+    AOT_GOTO(0x0616, L0616);
+L0616:
+    AOT_BLOCK(0x0616, 3);
+    // 0616: movb (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+    }
+    // 0618: bitb $1, 4f24(r2)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[2] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 061e: beq 05d4
+    if (Z)
+        AOT_GOTO(0x05d4, L05d4);
+    AOT_GOTO(0x0620, L0620);
+L0620:
+    AOT_BLOCK(0x0620, 2);
+    // 0620: bitb $8, 4d18(r2)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[2] + 19736);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0626: beq 069a
+    if (Z)
+        AOT_GOTO(0x069a, L069a);
+    AOT_GOTO(0x0628, L0628);
+L0628:
+    AOT_BLOCK(0x0628, 3);
+    // 0628: movb (r4)+, r3
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+    }
+    // 062a: bitb $1, 4f24(r3)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[3] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0630: beq 05d4
+    if (Z)
+        AOT_GOTO(0x05d4, L05d4);
+    AOT_GOTO(0x0632, L0632);
+L0632:
+    AOT_BLOCK(0x0632, 2);
+    // 0632: bitb $10, 4d18(r3)
+    {
+        src = uint8_t(0x10);
+        b = uint16_t(r[3] + 19736);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0638: beq 069a
+    if (Z)
+        AOT_GOTO(0x069a, L069a);
+    AOT_GOTO(0x063a, L063a);
+L063a:
+    AOT_BLOCK(0x063a, 3);
+    // 063a: movb (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+    }
+    // 063c: bitb $1, 4f24(r2)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[2] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0642: beq 05d4
+    if (Z)
+        AOT_GOTO(0x05d4, L05d4);
+    AOT_GOTO(0x0644, L0644);
+L0644:
+    AOT_BLOCK(0x0644, 2);
+    // 0644: bitb $20, 4d18(r2)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[2] + 19736);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 064a: beq 069a
+    if (Z)
+        AOT_GOTO(0x069a, L069a);
+    AOT_GOTO(0x064c, L064c);
+L064c:
+    AOT_BLOCK(0x064c, 3);
+    // 064c: movb (r4)+, r3
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+    }
+    // 064e: bitb $1, 4f24(r3)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[3] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0654: beq 05d4
+    if (Z)
+        AOT_GOTO(0x05d4, L05d4);
+    AOT_GOTO(0x0656, L0656);
+L0656:
+    AOT_BLOCK(0x0656, 2);
+    // 0656: bitb $40, 4d18(r3)
+    {
+        src = uint8_t(0x40);
+        b = uint16_t(r[3] + 19736);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 065c: beq 069a
+    if (Z)
+        AOT_GOTO(0x069a, L069a);
+    AOT_GOTO(0x065e, L065e);
+L065e:
+    AOT_BLOCK(0x065e, 3);
+    // 065e: movb (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+    }
+    // 0660: bitb $1, 4f24(r2)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[2] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0666: beq 05d4
+    if (Z)
+        AOT_GOTO(0x05d4, L05d4);
+    AOT_GOTO(0x0668, L0668);
+L0668:
+    AOT_BLOCK(0x0668, 2);
+    // 0668: bitb $80, 4d18(r2)
+    {
+        src = uint8_t(0x80);
+        b = uint16_t(r[2] + 19736);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 066e: beq 069a
+    if (Z)
+        AOT_GOTO(0x069a, L069a);
+    AOT_GOTO(0x0670, L0670);
+L0670:
+    AOT_BLOCK(0x0670, 3);
+    // 0670: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0672: bitb $1, 4f24(r0)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[0] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0678: bne 0670
+    if (!Z)
+        AOT_GOTO(0x0670, L0670);
+    AOT_GOTO(0x067a, L067a);
+L067a:
+    AOT_BLOCK(0x067a, 3);
+    // 067a: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 067c: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0680: bhi 05dc
+    if (!(C | Z))
+        AOT_GOTO(0x05dc, L05dc);
+    AOT_GOTO(0x0682, L0682);
+L0682:
+    AOT_BLOCK(0x0682, 2);
+    // 0682: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0684: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0688);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L0688:
+    AOT_BLOCK(0x0688, 2);
+    // 0688: mov 4c92, r4
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 068c: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x068e, L068e);
+L068e:
+    AOT_BLOCK(0x068e, 3);
+    // 068e: movb -1(r4), r3
+    {
+        a = uint16_t(r[4] + -1);
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+    }
+    // 0692: bitb $1, 4d18(r3)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[3] + 19736);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0698: bne 05ca
+    if (!Z)
+        AOT_GOTO(0x05ca, L05ca);
+    AOT_GOTO(0x069a, L069a);
+L069a:
+    AOT_BLOCK(0x069a, 3);
+    // 069a: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 069c: bitb $1, 4f24(r0)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[0] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 06a2: bne 069a
+    if (!Z)
+        AOT_GOTO(0x069a, L069a);
+    AOT_GOTO(0x06a4, L06a4);
+L06a4:
+    AOT_BLOCK(0x06a4, 3);
+    // 06a4: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+    }
+    // 06a6: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06aa: blos 06b0
+    if (C | Z)
+        AOT_GOTO(0x06b0, L06b0);
+    AOT_GOTO(0x06ac, L06ac);
+L06ac:
+    AOT_BLOCK(0x06ac, 1);
+    // 06ac: jmp *$02b4
+    {
+        a = 0x02b4;
+    }
+    AOT_GOTO(0x02b4, L02b4);
+L06b0:
+    AOT_BLOCK(0x06b0, 2);
+    // 06b0: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06b2: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x06b6);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L06b6:
+    AOT_BLOCK(0x06b6, 2);
+    // 06b6: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06b8: br 069a
+    AOT_GOTO(0x069a, L069a);
+L06ba:
+    AOT_BLOCK(0x06ba, 3);
+    // 06ba: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x06be;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 06be: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x06c2, L06c2);
+L06c2:
+    AOT_BLOCK(0x06c2, 5);
+    // 06c2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 06c4: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 06c8: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 06cc: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 06ce: jsr pc, *$026a
+    {
+        a = 0x026a;
+        r[6] -= 2;
+        WR16(r[6], 0x06d2);
+    }
+    AOT_GOTO(0x026a, L026a);
+L06d2:
+    AOT_BLOCK(0x06d2, 4);
+    // 06d2: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 06d4: movb *4c92, r0
+    {
+        a = RD16(0x4c92);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 06d8: cmpb $1, 4e24(r0)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[0] + 20004);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 06de: beq 06c2
+    if (Z)
+        AOT_GOTO(0x06c2, L06c2);
+    AOT_GOTO(0x06e0, L06e0);
+L06e0:
+    AOT_BLOCK(0x06e0, 3);
+    // 06e0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 06e2: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L06e6:
+    AOT_BLOCK(0x06e6, 6);
+    // 06e6: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x06ea;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 06ea: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 06ee: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+    }
+    // 06f0: cmp $e, 8396
+    {
+        src = uint16_t(0x000e);
+        b = 0x8396;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 06f6: bgt 073c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x073c, L073c);
+    AOT_GOTO(0x06f8, L06f8);
+L06f8:
+    AOT_BLOCK(0x06f8, 3);
+    // 06f8: mov 83f4, (sp)
+    {
+        a = 0x83f4;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 06fc: mov $4158, -(sp)
+    {
+        src = uint16_t(0x4158);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0700: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x0704);
+    }
+    AOT_GOTO(0x106a, L106a);
+L0704:
+    AOT_BLOCK(0x0704, 2);
+    // 0704: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0706: br 0720
+    AOT_GOTO(0x0720, L0720);
+L0708:
+    AOT_BLOCK(0x0708, 5);
+    // 0708: dec 8398
+    {
+        a = 0x8398;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 070c: mov 8398, r0
+    {
+        a = 0x8398;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0710: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0712: mov -7c4a(r0), r3
+    {
+        a = uint16_t(r[0] + -31818);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0716: br 076c
+    AOT_GOTO(0x076c, L076c);
+L0718:
+    AOT_BLOCK(0x0718, 2);
+    // 0718: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 071a: jsr pc, *$00ba
+    {
+        a = 0x00ba;
+        r[6] -= 2;
+        WR16(r[6], 0x071e);
+    }
+    AOT_GOTO(0x00ba, L00ba);
+L071e:
+    AOT_BLOCK(0x071e, 1);
+    // 071e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0720, L0720);
+L0720:
+    AOT_BLOCK(0x0720, 4);
+    // 0720: mov 4c8e, r0
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0724: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0728: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 072a: jsr pc, 006e
+    {
+        a = 0x006e;
+        r[6] -= 2;
+        WR16(r[6], 0x072e);
+    }
+    AOT_GOTO(0x006e, L006e);
+L072e:
+    AOT_BLOCK(0x072e, 4);
+    // 072e: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0732: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0734: cmp 8396, -7c04(r0)
+    {
+        a = 0x8396;
+        src = RD16(a);
+        b = uint16_t(r[0] + -31748);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 073a: bgt 0718
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0718, L0718);
+    AOT_GOTO(0x073c, L073c);
+L073c:
+    AOT_BLOCK(0x073c, 2);
+    // 073c: tst 8398
+    {
+        a = 0x8398;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0740: bgt 0708
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x0708, L0708);
+    AOT_GOTO(0x0742, L0742);
+L0742:
+    AOT_BLOCK(0x0742, 4);
+    // 0742: mov 4002, r3
+    {
+        a = 0x4002;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0746: add $200, 4002
+    {
+        src = uint16_t(0x0200);
+        b = 0x4002;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 074c: cmp $8396, 4002
+    {
+        src = uint16_t(0x8396);
+        b = 0x4002;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0752: bhi 0764
+    if (!(C | Z))
+        AOT_GOTO(0x0764, L0764);
+    AOT_GOTO(0x0754, L0754);
+L0754:
+    AOT_BLOCK(0x0754, 2);
+    // 0754: mov $416e, (sp)
+    {
+        src = uint16_t(0x416e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0758: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x075c);
+    }
+    AOT_GOTO(0x106a, L106a);
+L075c:
+    AOT_BLOCK(0x075c, 2);
+    // 075c: mov 84cc, (sp)
+    {
+        a = 0x84cc;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0760: jsr pc, *$2712
+    {
+        a = 0x2712;
+        r[6] -= 2;
+        WR16(r[6], 0x0764);
+    }
+    AOT_GOTO(0x2712, L2712);
+L0764:
+    AOT_BLOCK(0x0764, 2);
+    // 0764: clrb *4002
+    {
+        a = RD16(0x4002);
+        WR8(a, 0);
+        C = false;
+    }
+    // 0768: inc 4002
+    {
+        a = 0x4002;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x076c, L076c);
+L076c:
+    AOT_BLOCK(0x076c, 7);
+    // 076c: mov 8396, r0
+    {
+        a = 0x8396;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0770: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0772: mov r3, -7c66(r0)
+    {
+        src = r[3];
+        b = uint16_t(r[0] + -31846);
+        WR16(b, src);
+    }
+    // 0776: mov 4c8e, r2
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 077a: sub $200, r2
+    {
+        src = uint16_t(0x0200);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+    }
+    // 077e: cmp r4, r2
+    {
+        src = r[4];
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0780: blos 0784
+    if (C | Z)
+        AOT_GOTO(0x0784, L0784);
+    AOT_GOTO(0x0782, L0782);
+L0782:
+    AOT_BLOCK(0x0782, 1);
+    // 0782: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0784, L0784);
+L0784:
+    AOT_BLOCK(0x0784, 2);
+    // 0784: movb (r2)+, (r3)+
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0786: bne 0784
+    if (!Z)
+        AOT_GOTO(0x0784, L0784);
+    AOT_GOTO(0x0788, L0788);
+L0788:
+    AOT_BLOCK(0x0788, 2);
+    // 0788: cmp 4c8e, r2
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 078c: bhi 0784
+    if (!(C | Z))
+        AOT_GOTO(0x0784, L0784);
+    AOT_GOTO(0x078e, L078e);
+L078e:
+    AOT_BLOCK(0x078e, 11);
+    // 078e: mov 8396, r0
+    {
+        a = 0x8396;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0792: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0794: inc 8396
+    {
+        a = 0x8396;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0798: mov r3, -7c2e(r0)
+    {
+        src = r[3];
+        b = uint16_t(r[0] + -31790);
+        WR16(b, src);
+    }
+    // 079c: mov 4c8c, r3
+    {
+        a = 0x4c8c;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 07a0: add $200, r3
+    {
+        src = uint16_t(0x0200);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 07a4: mov 4c8e, r2
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 07a8: sub $200, r2
+    {
+        src = uint16_t(0x0200);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+    }
+    // 07ac: mov r3, 4c8e
+    {
+        src = r[3];
+        b = 0x4c8e;
+        WR16(b, src);
+    }
+    // 07b0: cmp r4, r2
+    {
+        src = r[4];
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07b2: blos 07ba
+    if (C | Z)
+        AOT_GOTO(0x07ba, L07ba);
+    AOT_GOTO(0x07b4, L07b4);
+L07b4:
+    AOT_BLOCK(0x07b4, 2);
+    // 07b4: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07b6: br 07ba
+    AOT_GOTO(0x07ba, L07ba);
+L07b8:
+    AOT_BLOCK(0x07b8, 1);
+    // 07b8: movb -(r2), -(r3)
+    {
+        r[2] -= 1;
+        a = r[2];
+        src = RD8(a);
+        r[3] -= 1;
+        b = r[3];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x07ba, L07ba);
+L07ba:
+    AOT_BLOCK(0x07ba, 2);
+    // 07ba: cmp r2, 4c90
+    {
+        src = r[2];
+        b = 0x4c90;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07be: bhi 07b8
+    if (!(C | Z))
+        AOT_GOTO(0x07b8, L07b8);
+    AOT_GOTO(0x07c0, L07c0);
+L07c0:
+    AOT_BLOCK(0x07c0, 2);
+    // 07c0: cmp r3, 4c8a
+    {
+        src = r[3];
+        b = 0x4c8a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 07c4: bhi 07ce
+    if (!(C | Z))
+        AOT_GOTO(0x07ce, L07ce);
+    AOT_GOTO(0x07c6, L07c6);
+L07c6:
+    AOT_BLOCK(0x07c6, 2);
+    // 07c6: mov $4177, (sp)
+    {
+        src = uint16_t(0x4177);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07ca: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x07ce);
+    }
+    AOT_GOTO(0x106a, L106a);
+L07ce:
+    AOT_BLOCK(0x07ce, 10);
+    // 07ce: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 07d0: sub 4c90, r0
+    {
+        a = 0x4c90;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 07d4: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 07d8: add r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 07dc: add r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 07e0: add r0, 83fa
+    {
+        src = r[0];
+        b = 0x83fa;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 07e4: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 07e6: add -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 07ea: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L07ee:
+    AOT_BLOCK(0x07ee, 6);
+    // 07ee: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x07f2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 07f2: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 07f6: sub $208, sp
+    {
+        src = uint16_t(0x0208);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 07fa: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 07fc: jsr pc, *$06ba
+    {
+        a = 0x06ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0800);
+    }
+    AOT_GOTO(0x06ba, L06ba);
+L0800:
+    AOT_BLOCK(0x0800, 7);
+    // 0800: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0802: mov r5, r3
+    {
+        src = r[5];
+        r[3] = src;
+    }
+    // 0804: add $fdf2, r3
+    {
+        src = uint16_t(0xfdf2);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 0808: mov 4c92, r0
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 080c: inc 4c92
+    {
+        a = 0x4c92;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0810: cmpb $3c, (r0)
+    {
+        src = uint8_t(0x3c);
+        b = r[0];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0814: bne 0870
+    if (!Z)
+        AOT_GOTO(0x0870, L0870);
+    AOT_GOTO(0x0816, L0816);
+L0816:
+    AOT_BLOCK(0x0816, 1);
+    // 0816: mov $1, -a(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x081c, L081c);
+L081c:
+    AOT_BLOCK(0x081c, 5);
+    // 081c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 081e: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0822: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 0826: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0828: jsr pc, *$026a
+    {
+        a = 0x026a;
+        r[6] -= 2;
+        WR16(r[6], 0x082c);
+    }
+    AOT_GOTO(0x026a, L026a);
+L082c:
+    AOT_BLOCK(0x082c, 3);
+    // 082c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 082e: cmpb $a, *4c92
+    {
+        src = uint8_t(0x0a);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0834: bne 0858
+    if (!Z)
+        AOT_GOTO(0x0858, L0858);
+    AOT_GOTO(0x0836, L0836);
+L0836:
+    AOT_BLOCK(0x0836, 2);
+    // 0836: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0838: br 0854
+    AOT_GOTO(0x0854, L0854);
+L083a:
+    AOT_BLOCK(0x083a, 2);
+    // 083a: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 083e: br 0848
+    AOT_GOTO(0x0848, L0848);
+L0840:
+    AOT_BLOCK(0x0840, 2);
+    // 0840: movb *4c92, (r3)+
+    {
+        a = RD16(0x4c92);
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 0844: inc 4c92
+    {
+        a = 0x4c92;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0848, L0848);
+L0848:
+    AOT_BLOCK(0x0848, 2);
+    // 0848: cmp r4, 4c92
+    {
+        src = r[4];
+        b = 0x4c92;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 084c: bhi 0840
+    if (!(C | Z))
+        AOT_GOTO(0x0840, L0840);
+    AOT_GOTO(0x084e, L084e);
+L084e:
+    AOT_BLOCK(0x084e, 2);
+    // 084e: cmpb $22, -(r3)
+    {
+        src = uint8_t(0x22);
+        r[3] -= 1;
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0852: bne 088e
+    if (!Z)
+        AOT_GOTO(0x088e, L088e);
+    AOT_GOTO(0x0854, L0854);
+L0854:
+    AOT_BLOCK(0x0854, 2);
+    // 0854: clrb (r3)
+    {
+        a = r[3];
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 0856: br 088e
+    AOT_GOTO(0x088e, L088e);
+L0858:
+    AOT_BLOCK(0x0858, 2);
+    // 0858: cmpb $3e, *4c92
+    {
+        src = uint8_t(0x3e);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 085e: beq 0854
+    if (Z)
+        AOT_GOTO(0x0854, L0854);
+    AOT_GOTO(0x0860, L0860);
+L0860:
+    AOT_BLOCK(0x0860, 2);
+    // 0860: cmp r4, 4c92
+    {
+        src = r[4];
+        b = 0x4c92;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0864: blos 081c
+    if (C | Z)
+        AOT_GOTO(0x081c, L081c);
+    AOT_GOTO(0x0866, L0866);
+L0866:
+    AOT_BLOCK(0x0866, 3);
+    // 0866: movb *4c92, (r3)+
+    {
+        a = RD16(0x4c92);
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 086a: inc 4c92
+    {
+        a = 0x4c92;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 086e: br 0860
+    AOT_GOTO(0x0860, L0860);
+L0870:
+    AOT_BLOCK(0x0870, 3);
+    // 0870: mov 4c92, r0
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0874: cmpb $22, -1(r0)
+    {
+        src = uint8_t(0x22);
+        b = uint16_t(r[0] + -1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 087a: beq 083a
+    if (Z)
+        AOT_GOTO(0x083a, L083a);
+    AOT_GOTO(0x087c, L087c);
+L087c:
+    AOT_BLOCK(0x087c, 3);
+    // 087c: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 087e: mov $4186, -(sp)
+    {
+        src = uint16_t(0x4186);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0882: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x0886);
+    }
+    AOT_GOTO(0x106a, L106a);
+L0886:
+    AOT_BLOCK(0x0886, 2);
+    // 0886: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0888: mov $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x088e, L088e);
+L088e:
+    AOT_BLOCK(0x088e, 1);
+    // 088e: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0892, L0892);
+L0892:
+    AOT_BLOCK(0x0892, 5);
+    // 0892: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0894: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0898: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 089c: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 089e: jsr pc, *$026a
+    {
+        a = 0x026a;
+        r[6] -= 2;
+        WR16(r[6], 0x08a2);
+    }
+    AOT_GOTO(0x026a, L026a);
+L08a2:
+    AOT_BLOCK(0x08a2, 3);
+    // 08a2: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 08a4: cmpb $a, *4c92
+    {
+        src = uint8_t(0x0a);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 08aa: bne 0892
+    if (!Z)
+        AOT_GOTO(0x0892, L0892);
+    AOT_GOTO(0x08ac, L08ac);
+L08ac:
+    AOT_BLOCK(0x08ac, 3);
+    // 08ac: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 08b0: mov r4, 4c92
+    {
+        src = r[4];
+        b = 0x4c92;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08b4: jsr pc, 006e
+    {
+        a = 0x006e;
+        r[6] -= 2;
+        WR16(r[6], 0x08b8);
+    }
+    AOT_GOTO(0x006e, L006e);
+L08b8:
+    AOT_BLOCK(0x08b8, 2);
+    // 08b8: cmp $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08be: bne 08d4
+    if (!Z)
+        AOT_GOTO(0x08d4, L08d4);
+    AOT_GOTO(0x08c0, L08c0);
+L08c0:
+    AOT_BLOCK(0x08c0, 1);
+    // 08c0: jmp *$0a08
+    {
+        a = 0x0a08;
+    }
+    AOT_GOTO(0x0a08, L0a08);
+L08c4:
+    AOT_BLOCK(0x08c4, 2);
+    // 08c4: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 08c6: mov $4199, -(sp)
+    {
+        src = uint16_t(0x4199);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x08ca, L08ca);
+L08ca:
+    AOT_BLOCK(0x08ca, 1);
+    // 08ca: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x08ce);
+    }
+    AOT_GOTO(0x106a, L106a);
+L08ce:
+    AOT_BLOCK(0x08ce, 2);
+    // 08ce: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 08d0: jmp *$0a08
+    {
+        a = 0x0a08;
+    }
+    AOT_GOTO(0x0a08, L0a08);
+L08d4:
+    AOT_BLOCK(0x08d4, 4);
+    // 08d4: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 08d8: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 08da: cmp $a, r0
+    {
+        src = uint16_t(0x000a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08de: ble 08c4
+    if (Z || (N ^ V))
+        AOT_GOTO(0x08c4, L08c4);
+    AOT_GOTO(0x08e0, L08e0);
+L08e0:
+    AOT_BLOCK(0x08e0, 4);
+    // 08e0: mov 4002, r0
+    {
+        a = 0x4002;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 08e4: mov r0, -e(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 08e8: cmp $8196, r0
+    {
+        src = uint16_t(0x8196);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 08ec: bcc 08fe
+    if (!C)
+        AOT_GOTO(0x08fe, L08fe);
+    AOT_GOTO(0x08ee, L08ee);
+L08ee:
+    AOT_BLOCK(0x08ee, 2);
+    // 08ee: mov $41b6, (sp)
+    {
+        src = uint16_t(0x41b6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08f2: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x08f6);
+    }
+    AOT_GOTO(0x106a, L106a);
+L08f6:
+    AOT_BLOCK(0x08f6, 2);
+    // 08f6: mov 84cc, (sp)
+    {
+        a = 0x84cc;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 08fa: jsr pc, *$2712
+    {
+        a = 0x2712;
+        r[6] -= 2;
+        WR16(r[6], 0x08fe);
+    }
+    AOT_GOTO(0x2712, L2712);
+L08fe:
+    AOT_BLOCK(0x08fe, 5);
+    // 08fe: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+    }
+    // 0902: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0906: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 0908: add $8460, r0
+    {
+        src = uint16_t(0x8460);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 090c: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0910, L0910);
+L0910:
+    AOT_BLOCK(0x0910, 2);
+    // 0910: tst *-c(r5)
+    {
+        a = RD16(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0914: beq 0990
+    if (Z)
+        AOT_GOTO(0x0990, L0990);
+    AOT_GOTO(0x0916, L0916);
+L0916:
+    AOT_BLOCK(0x0916, 2);
+    // 0916: cmpb $2f, -20e(r5)
+    {
+        src = uint8_t(0x2f);
+        b = uint16_t(r[5] + -526);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 091c: beq 0926
+    if (Z)
+        AOT_GOTO(0x0926, L0926);
+    AOT_GOTO(0x091e, L091e);
+L091e:
+    AOT_BLOCK(0x091e, 3);
+    // 091e: mov *-c(r5), r0
+    {
+        a = RD16(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0922: tstb (r0)
+    {
+        a = r[0];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0924: bne 0936
+    if (!Z)
+        AOT_GOTO(0x0936, L0936);
+    AOT_GOTO(0x0926, L0926);
+L0926:
+    AOT_BLOCK(0x0926, 4);
+    // 0926: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0928: add $fdf2, (sp)
+    {
+        src = uint16_t(0xfdf2);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 092c: mov -e(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0930: jsr pc, *$29be
+    {
+        a = 0x29be;
+        r[6] -= 2;
+        WR16(r[6], 0x0934);
+    }
+    AOT_GOTO(0x29be, L29be);
+L0934:
+    AOT_BLOCK(0x0934, 1);
+    // 0934: br 0960
+    AOT_GOTO(0x0960, L0960);
+L0936:
+    AOT_BLOCK(0x0936, 3);
+    // 0936: mov *-c(r5), (sp)
+    {
+        a = RD16(r[5] + -12);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 093a: mov -e(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 093e: jsr pc, *$29be
+    {
+        a = 0x29be;
+        r[6] -= 2;
+        WR16(r[6], 0x0942);
+    }
+    AOT_GOTO(0x29be, L29be);
+L0942:
+    AOT_BLOCK(0x0942, 4);
+    // 0942: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0944: mov $41bf, (sp)
+    {
+        src = uint16_t(0x41bf);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0948: mov -e(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 094c: jsr pc, *$297e
+    {
+        a = 0x297e;
+        r[6] -= 2;
+        WR16(r[6], 0x0950);
+    }
+    AOT_GOTO(0x297e, L297e);
+L0950:
+    AOT_BLOCK(0x0950, 5);
+    // 0950: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0952: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0954: add $fdf2, (sp)
+    {
+        src = uint16_t(0xfdf2);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 0958: mov -e(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 095c: jsr pc, *$297e
+    {
+        a = 0x297e;
+        r[6] -= 2;
+        WR16(r[6], 0x0960);
+    }
+    AOT_GOTO(0x297e, L297e);
+L0960:
+    AOT_BLOCK(0x0960, 4);
+    // 0960: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0962: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0964: mov -e(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0968: jsr pc, *$2a5c
+    {
+        a = 0x2a5c;
+        r[6] -= 2;
+        WR16(r[6], 0x096c);
+    }
+    AOT_GOTO(0x2a5c, L2a5c);
+L096c:
+    AOT_BLOCK(0x096c, 3);
+    // 096c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 096e: mov 847a, r1
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 0972: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    AOT_GOTO(0x0974, L0974);
+L0974:
+    AOT_BLOCK(0x0974, 2);
+    // 0974: mov r0, -7bc6(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + -31686);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0978: ble 09a2
+    if (Z || (N ^ V))
+        AOT_GOTO(0x09a2, L09a2);
+    AOT_GOTO(0x097a, L097a);
+L097a:
+    AOT_BLOCK(0x097a, 5);
+    // 097a: mov $1, -8(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0980: inc 847a
+    {
+        a = 0x847a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0984: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0988: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 098a: mov -7bc8(r0), 4006
+    {
+        a = uint16_t(r[0] + -31688);
+        src = RD16(a);
+        b = 0x4006;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0990, L0990);
+L0990:
+    AOT_BLOCK(0x0990, 2);
+    // 0990: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0994: bne 09aa
+    if (!Z)
+        AOT_GOTO(0x09aa, L09aa);
+    AOT_GOTO(0x0996, L0996);
+L0996:
+    AOT_BLOCK(0x0996, 4);
+    // 0996: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0998: add $fdf2, (sp)
+    {
+        src = uint16_t(0xfdf2);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 099c: mov $41c1, -(sp)
+    {
+        src = uint16_t(0x41c1);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09a0: br 08ca
+    AOT_GOTO(0x08ca, L08ca);
+L09a2:
+    AOT_BLOCK(0x09a2, 2);
+    // 09a2: add $2, -c(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 09a8: br 0910
+    AOT_GOTO(0x0910, L0910);
+L09aa:
+    AOT_BLOCK(0x09aa, 7);
+    // 09aa: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 09ae: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 09b0: mov $1, -7bb4(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + -31668);
+        WR16(b, src);
+    }
+    // 09b6: mov -e(r5), r3
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 09ba: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 09be: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 09c0: mov r3, -7bf0(r0)
+    {
+        src = r[3];
+        b = uint16_t(r[0] + -31728);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x09c4, L09c4);
+L09c4:
+    AOT_BLOCK(0x09c4, 2);
+    // 09c4: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 09c6: bne 09c4
+    if (!Z)
+        AOT_GOTO(0x09c4, L09c4);
+    AOT_GOTO(0x09c8, L09c8);
+L09c8:
+    AOT_BLOCK(0x09c8, 3);
+    // 09c8: mov r3, 4002
+    {
+        src = r[3];
+        b = 0x4002;
+        WR16(b, src);
+    }
+    // 09cc: mov -e(r5), (sp)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09d0: jsr pc, *$14ea
+    {
+        a = 0x14ea;
+        r[6] -= 2;
+        WR16(r[6], 0x09d4);
+    }
+    AOT_GOTO(0x14ea, L14ea);
+L09d4:
+    AOT_BLOCK(0x09d4, 2);
+    // 09d4: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09d6: jsr pc, *$14c0
+    {
+        a = 0x14c0;
+        r[6] -= 2;
+        WR16(r[6], 0x09da);
+    }
+    AOT_GOTO(0x14c0, L14c0);
+L09da:
+    AOT_BLOCK(0x09da, 5);
+    // 09da: mov r0, 8460
+    {
+        src = r[0];
+        b = 0x8460;
+        WR16(b, src);
+    }
+    // 09de: mov 847a, r1
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 09e2: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 09e4: mov r0, -7bdc(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + -31708);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09e8: jsr pc, 003c
+    {
+        a = 0x003c;
+        r[6] -= 2;
+        WR16(r[6], 0x09ec);
+    }
+    AOT_GOTO(0x003c, L003c);
+L09ec:
+    AOT_BLOCK(0x09ec, 1);
+    // 09ec: br 09f6
+    AOT_GOTO(0x09f6, L09f6);
+L09ee:
+    AOT_BLOCK(0x09ee, 2);
+    // 09ee: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 09f0: jsr pc, *$06e6
+    {
+        a = 0x06e6;
+        r[6] -= 2;
+        WR16(r[6], 0x09f4);
+    }
+    AOT_GOTO(0x06e6, L06e6);
+L09f4:
+    AOT_BLOCK(0x09f4, 1);
+    // 09f4: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x09f6, L09f6);
+L09f6:
+    AOT_BLOCK(0x09f6, 2);
+    // 09f6: cmp 4c8e, r4
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 09fa: bhi 09ee
+    if (!(C | Z))
+        AOT_GOTO(0x09ee, L09ee);
+    AOT_GOTO(0x09fc, L09fc);
+L09fc:
+    AOT_BLOCK(0x09fc, 1);
+    // 09fc: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a00, L0a00);
+L0a00:
+    AOT_BLOCK(0x0a00, 2);
+    // 0a00: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0a02: mov 8396, -7c04(r0)
+    {
+        a = 0x8396;
+        src = RD16(a);
+        b = uint16_t(r[0] + -31748);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a08, L0a08);
+L0a08:
+    AOT_BLOCK(0x0a08, 3);
+    // 0a08: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0a0a: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a0e:
+    AOT_BLOCK(0x0a0e, 6);
+    // 0a0e: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a12;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 0a12: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0a16: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0a1a: mov 8(r5), r2
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 0a1e: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0a22, L0a22);
+L0a22:
+    AOT_BLOCK(0x0a22, 3);
+    // 0a22: movb (r2), -8(r5)
+    {
+        a = r[2];
+        src = RD8(a);
+        b = uint16_t(r[5] + -8);
+        WR8(b, src);
+    }
+    // 0a26: clrb (r2)
+    {
+        a = r[2];
+        WR8(a, 0);
+        C = false;
+    }
+    // 0a28: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a2a, L0a2a);
+L0a2a:
+    AOT_BLOCK(0x0a2a, 2);
+    // 0a2a: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a2c: jsr pc, *$299c
+    {
+        a = 0x299c;
+        r[6] -= 2;
+        WR16(r[6], 0x0a30);
+    }
+    AOT_GOTO(0x299c, L299c);
+L0a30:
+    AOT_BLOCK(0x0a30, 5);
+    // 0a30: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0a32: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 0a36: movb -8(r5), (r2)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD8(a);
+        b = r[2];
+        WR8(b, src);
+    }
+    // 0a3a: tst -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0a3e: beq 0a46
+    if (Z)
+        AOT_GOTO(0x0a46, L0a46);
+    AOT_GOTO(0x0a40, L0a40);
+L0a40:
+    AOT_BLOCK(0x0a40, 1);
+    // 0a40: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0a42, L0a42);
+L0a42:
+    AOT_BLOCK(0x0a42, 2);
+    // 0a42: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0a46:
+    AOT_BLOCK(0x0a46, 2);
+    // 0a46: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a4a: br 0a42
+    AOT_GOTO(0x0a42, L0a42);
+L0a4c:
+    AOT_BLOCK(0x0a4c, 5);
+    // 0a4c: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0a50;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 0a50: sub $250, sp
+    {
+        src = uint16_t(0x0250);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0a54: cmp $8196, 4002
+    {
+        src = uint16_t(0x8196);
+        b = 0x4002;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0a5a: bcc 0a8a
+    if (!C)
+        AOT_GOTO(0x0a8a, L0a8a);
+    AOT_GOTO(0x0a5c, L0a5c);
+L0a5c:
+    AOT_BLOCK(0x0a5c, 2);
+    // 0a5c: mov $41dc, (sp)
+    {
+        src = uint16_t(0x41dc);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a60: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x0a64);
+    }
+    AOT_GOTO(0x106a, L106a);
+L0a64:
+    AOT_BLOCK(0x0a64, 1);
+    // 0a64: jmp *$0d96
+    {
+        a = 0x0d96;
+    }
+    AOT_GOTO(0x0d96, L0d96);
+L0a68:
+    AOT_BLOCK(0x0a68, 2);
+    // 0a68: mov $41ee, (sp)
+    {
+        src = uint16_t(0x41ee);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a6c: jsr pc, *$10f2
+    {
+        a = 0x10f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0a70);
+    }
+    AOT_GOTO(0x10f2, L10f2);
+L0a70:
+    AOT_BLOCK(0x0a70, 1);
+    // 0a70: br 0a7e
+    AOT_GOTO(0x0a7e, L0a7e);
+L0a72:
+    AOT_BLOCK(0x0a72, 2);
+    // 0a72: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a76: jsr pc, *$06ba
+    {
+        a = 0x06ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0a7a);
+    }
+    AOT_GOTO(0x06ba, L06ba);
+L0a7a:
+    AOT_BLOCK(0x0a7a, 1);
+    // 0a7a: mov r0, 4(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0a7e, L0a7e);
+L0a7e:
+    AOT_BLOCK(0x0a7e, 2);
+    // 0a7e: cmpb $a, *4c92
+    {
+        src = uint8_t(0x0a);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0a84: bne 0a72
+    if (!Z)
+        AOT_GOTO(0x0a72, L0a72);
+    AOT_GOTO(0x0a86, L0a86);
+L0a86:
+    AOT_BLOCK(0x0a86, 1);
+    // 0a86: jmp *$0d96
+    {
+        a = 0x0d96;
+    }
+    AOT_GOTO(0x0d96, L0d96);
+L0a8a:
+    AOT_BLOCK(0x0a8a, 4);
+    // 0a8a: mov 4002, -16(r5)
+    {
+        a = 0x4002;
+        src = RD16(a);
+        b = uint16_t(r[5] + -22);
+        WR16(b, src);
+    }
+    // 0a90: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0a94: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0a98: jsr pc, *$06ba
+    {
+        a = 0x06ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0a9c);
+    }
+    AOT_GOTO(0x06ba, L06ba);
+L0a9c:
+    AOT_BLOCK(0x0a9c, 5);
+    // 0a9c: mov r0, 4(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 4);
+        WR16(b, src);
+    }
+    // 0aa0: mov 4c92, r4
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0aa4: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0aa6: cmpb $2, 4e24(r0)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[0] + 20004);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0aac: bne 0a68
+    if (!Z)
+        AOT_GOTO(0x0a68, L0a68);
+    AOT_GOTO(0x0aae, L0aae);
+L0aae:
+    AOT_BLOCK(0x0aae, 4);
+    // 0aae: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ab2: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0ab6: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ab8: jsr pc, *$11e0
+    {
+        a = 0x11e0;
+        r[6] -= 2;
+        WR16(r[6], 0x0abc);
+    }
+    AOT_GOTO(0x11e0, L11e0);
+L0abc:
+    AOT_BLOCK(0x0abc, 4);
+    // 0abc: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0abe: mov r0, -12(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 0ac2: mov 2(r0), -14(r5)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -20);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ac8: beq 0ad0
+    if (Z)
+        AOT_GOTO(0x0ad0, L0ad0);
+    AOT_GOTO(0x0aca, L0aca);
+L0aca:
+    AOT_BLOCK(0x0aca, 1);
+    // 0aca: mov -16(r5), 4002
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        b = 0x4002;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0ad0, L0ad0);
+L0ad0:
+    AOT_BLOCK(0x0ad0, 3);
+    // 0ad0: mov $1, -c(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0ad6: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ad8: br 0afa
+    AOT_GOTO(0x0afa, L0afa);
+L0ada:
+    AOT_BLOCK(0x0ada, 9);
+    // 0ada: movb (r2)+, r0
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0adc: mov r0, -e(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 0ae0: bisb -c(r5), 4d18(r0)
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD8(a);
+        b = uint16_t(r[0] + 19736);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 0ae6: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0aea: add r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0aec: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0af0: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 0af4: cmp 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0af8: beq 0afa
+    if (Z)
+        AOT_GOTO(0x0afa, L0afa);
+    AOT_GOTO(0x0afa, L0afa);
+L0afa:
+    AOT_BLOCK(0x0afa, 2);
+    // 0afa: cmp 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0afe: bhi 0ada
+    if (!(C | Z))
+        AOT_GOTO(0x0ada, L0ada);
+    AOT_GOTO(0x0b00, L0b00);
+L0b00:
+    AOT_BLOCK(0x0b00, 6);
+    // 0b00: clr -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        WR16(a, 0);
+        C = false;
+    }
+    // 0b04: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b08: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0b0c: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 0b10: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b14: jsr pc, *$026a
+    {
+        a = 0x026a;
+        r[6] -= 2;
+        WR16(r[6], 0x0b18);
+    }
+    AOT_GOTO(0x026a, L026a);
+L0b18:
+    AOT_BLOCK(0x0b18, 4);
+    // 0b18: mov r0, 4(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 4);
+        WR16(b, src);
+    }
+    // 0b1c: mov 4c92, r4
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0b20: cmpb $28, (r4)
+    {
+        src = uint8_t(0x28);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b24: bne 0be6
+    if (!Z)
+        AOT_GOTO(0x0be6, L0be6);
+    AOT_GOTO(0x0b26, L0b26);
+L0b26:
+    AOT_BLOCK(0x0b26, 5);
+    // 0b26: mov r5, r2
+    {
+        src = r[5];
+        r[2] = src;
+    }
+    // 0b28: add $fdac, r2
+    {
+        src = uint16_t(0xfdac);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 0b2c: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0b2e: add $ffac, r0
+    {
+        src = uint16_t(0xffac);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 0b32: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0b36, L0b36);
+L0b36:
+    AOT_BLOCK(0x0b36, 2);
+    // 0b36: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b3a: jsr pc, *$06ba
+    {
+        a = 0x06ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0b3e);
+    }
+    AOT_GOTO(0x06ba, L06ba);
+L0b3e:
+    AOT_BLOCK(0x0b3e, 4);
+    // 0b3e: mov r0, 4(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 4);
+        WR16(b, src);
+    }
+    // 0b42: mov 4c92, r4
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0b46: cmpb $a, (r4)
+    {
+        src = uint8_t(0x0a);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b4a: bne 0b74
+    if (!Z)
+        AOT_GOTO(0x0b74, L0b74);
+    AOT_GOTO(0x0b4c, L0b4c);
+L0b4c:
+    AOT_BLOCK(0x0b4c, 7);
+    // 0b4c: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0b50: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0b52: dec -7bb4(r0)
+    {
+        a = uint16_t(r[0] + -31668);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0b56: dec 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0b5a: mov *-12(r5), (sp)
+    {
+        a = RD16(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b5e: mov $4201, -(sp)
+    {
+        src = uint16_t(0x4201);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b62: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x0b66);
+    }
+    AOT_GOTO(0x106a, L106a);
+L0b66:
+    AOT_BLOCK(0x0b66, 1);
+    // 0b66: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0b68, L0b68);
+L0b68:
+    AOT_BLOCK(0x0b68, 2);
+    // 0b68: tst -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0b6c: bne 0bfa
+    if (!Z)
+        AOT_GOTO(0x0bfa, L0bfa);
+    AOT_GOTO(0x0b6e, L0b6e);
+L0b6e:
+    AOT_BLOCK(0x0b6e, 2);
+    // 0b6e: dec -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0b72: br 0bfa
+    AOT_GOTO(0x0bfa, L0bfa);
+L0b74:
+    AOT_BLOCK(0x0b74, 2);
+    // 0b74: cmpb $29, (r4)
+    {
+        src = uint8_t(0x29);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b78: beq 0b68
+    if (Z)
+        AOT_GOTO(0x0b68, L0b68);
+    AOT_GOTO(0x0b7a, L0b7a);
+L0b7a:
+    AOT_BLOCK(0x0b7a, 2);
+    // 0b7a: cmpb $2c, (r4)
+    {
+        src = uint8_t(0x2c);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b7e: beq 0b36
+    if (Z)
+        AOT_GOTO(0x0b36, L0b36);
+    AOT_GOTO(0x0b80, L0b80);
+L0b80:
+    AOT_BLOCK(0x0b80, 3);
+    // 0b80: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0b82: cmpb $2, 4e24(r0)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[0] + 20004);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0b88: beq 0bbe
+    if (Z)
+        AOT_GOTO(0x0bbe, L0bbe);
+    AOT_GOTO(0x0b8a, L0b8a);
+L0b8a:
+    AOT_BLOCK(0x0b8a, 6);
+    // 0b8a: movb *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0b8e: mov r0, -e(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 0b92: clrb *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        WR8(a, 0);
+        C = false;
+    }
+    // 0b96: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0b98: mov $420f, -(sp)
+    {
+        src = uint16_t(0x420f);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0b9c: br 0bb0
+    AOT_GOTO(0x0bb0, L0bb0);
+L0b9e:
+    AOT_BLOCK(0x0b9e, 5);
+    // 0b9e: movb *4(r5), r0
+    {
+        a = RD16(r[5] + 4);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0ba2: mov r0, -e(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 0ba6: clrb *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        WR8(a, 0);
+        C = false;
+    }
+    // 0baa: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0bac: mov $421e, -(sp)
+    {
+        src = uint16_t(0x421e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bb0, L0bb0);
+L0bb0:
+    AOT_BLOCK(0x0bb0, 1);
+    // 0bb0: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x0bb4);
+    }
+    AOT_GOTO(0x106a, L106a);
+L0bb4:
+    AOT_BLOCK(0x0bb4, 3);
+    // 0bb4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 0bb6: movb -e(r5), *4(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD8(a);
+        b = RD16(r[5] + 4);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0bbc: br 0b36
+    AOT_GOTO(0x0b36, L0b36);
+L0bbe:
+    AOT_BLOCK(0x0bbe, 4);
+    // 0bbe: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0bc0: add $ffea, r0
+    {
+        src = uint16_t(0xffea);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0bc4: cmp -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bc8: bcc 0b9e
+    if (!C)
+        AOT_GOTO(0x0b9e, L0b9e);
+    AOT_GOTO(0x0bca, L0bca);
+L0bca:
+    AOT_BLOCK(0x0bca, 3);
+    // 0bca: mov r2, *-8(r5)
+    {
+        src = r[2];
+        b = RD16(r[5] + -8);
+        WR16(b, src);
+    }
+    // 0bce: add $2, -8(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 0bd4: br 0bd8
+    AOT_GOTO(0x0bd8, L0bd8);
+L0bd6:
+    AOT_BLOCK(0x0bd6, 1);
+    // 0bd6: movb (r4)+, (r2)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[2];
+        r[2] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0bd8, L0bd8);
+L0bd8:
+    AOT_BLOCK(0x0bd8, 2);
+    // 0bd8: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0bdc: bhi 0bd6
+    if (!(C | Z))
+        AOT_GOTO(0x0bd6, L0bd6);
+    AOT_GOTO(0x0bde, L0bde);
+L0bde:
+    AOT_BLOCK(0x0bde, 3);
+    // 0bde: clrb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        WR8(a, 0);
+        C = false;
+    }
+    // 0be0: inc -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0be4: br 0b36
+    AOT_GOTO(0x0b36, L0b36);
+L0be6:
+    AOT_BLOCK(0x0be6, 2);
+    // 0be6: cmpb $a, (r4)
+    {
+        src = uint8_t(0x0a);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0bea: bne 0bfa
+    if (!Z)
+        AOT_GOTO(0x0bfa, L0bfa);
+    AOT_GOTO(0x0bec, L0bec);
+L0bec:
+    AOT_BLOCK(0x0bec, 4);
+    // 0bec: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0bf0: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0bf2: dec -7bb4(r0)
+    {
+        a = uint16_t(r[0] + -31668);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0bf6: dec 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0bfa, L0bfa);
+L0bfa:
+    AOT_BLOCK(0x0bfa, 2);
+    // 0bfa: mov 4002, r3
+    {
+        a = 0x4002;
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 0bfe: mov r3, -16(r5)
+    {
+        src = r[3];
+        b = uint16_t(r[5] + -22);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c02, L0c02);
+L0c02:
+    AOT_BLOCK(0x0c02, 5);
+    // 0c02: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c06: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0c0a: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 0c0e: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c12: jsr pc, *$026a
+    {
+        a = 0x026a;
+        r[6] -= 2;
+        WR16(r[6], 0x0c16);
+    }
+    AOT_GOTO(0x026a, L026a);
+L0c16:
+    AOT_BLOCK(0x0c16, 4);
+    // 0c16: mov r0, 4(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + 4);
+        WR16(b, src);
+    }
+    // 0c1a: mov 4c92, r4
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0c1e: cmpb $5c, (r4)
+    {
+        src = uint8_t(0x5c);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c22: bne 0c2c
+    if (!Z)
+        AOT_GOTO(0x0c2c, L0c2c);
+    AOT_GOTO(0x0c24, L0c24);
+L0c24:
+    AOT_BLOCK(0x0c24, 2);
+    // 0c24: cmpb $a, 1(r4)
+    {
+        src = uint8_t(0x0a);
+        b = uint16_t(r[4] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c2a: beq 0c02
+    if (Z)
+        AOT_GOTO(0x0c02, L0c02);
+    AOT_GOTO(0x0c2c, L0c2c);
+L0c2c:
+    AOT_BLOCK(0x0c2c, 2);
+    // 0c2c: cmpb $a, (r4)
+    {
+        src = uint8_t(0x0a);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c30: bne 0c36
+    if (!Z)
+        AOT_GOTO(0x0c36, L0c36);
+    AOT_GOTO(0x0c32, L0c32);
+L0c32:
+    AOT_BLOCK(0x0c32, 1);
+    // 0c32: jmp *$0d38
+    {
+        a = 0x0d38;
+    }
+    AOT_GOTO(0x0d38, L0d38);
+L0c36:
+    AOT_BLOCK(0x0c36, 2);
+    // 0c36: tst -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c3a: beq 0c94
+    if (Z)
+        AOT_GOTO(0x0c94, L0c94);
+    AOT_GOTO(0x0c3c, L0c3c);
+L0c3c:
+    AOT_BLOCK(0x0c3c, 3);
+    // 0c3c: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0c3e: cmpb $2, 4e24(r0)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[0] + 20004);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0c44: bne 0c9e
+    if (!Z)
+        AOT_GOTO(0x0c9e, L0c9e);
+    AOT_GOTO(0x0c46, L0c46);
+L0c46:
+    AOT_BLOCK(0x0c46, 1);
+    // 0c46: mov -8(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c4c, L0c4c);
+L0c4c:
+    AOT_BLOCK(0x0c4c, 5);
+    // 0c4c: sub $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[5] + -10);
+        WR16(b, val16);
+    }
+    // 0c52: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0c54: add $ffac, r0
+    {
+        src = uint16_t(0xffac);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0c58: cmp -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c5c: bcs 0c94
+    if (C)
+        AOT_GOTO(0x0c94, L0c94);
+    AOT_GOTO(0x0c5e, L0c5e);
+L0c5e:
+    AOT_BLOCK(0x0c5e, 4);
+    // 0c5e: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c62: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0c64: mov *-a(r5), -(sp)
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0c68: jsr pc, *$0a0e
+    {
+        a = 0x0a0e;
+        r[6] -= 2;
+        WR16(r[6], 0x0c6c);
+    }
+    AOT_GOTO(0x0a0e, L0a0e);
+L0c6c:
+    AOT_BLOCK(0x0c6c, 3);
+    // 0c6c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0c6e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0c70: beq 0c4c
+    if (Z)
+        AOT_GOTO(0x0c4c, L0c4c);
+    AOT_GOTO(0x0c72, L0c72);
+L0c72:
+    AOT_BLOCK(0x0c72, 12);
+    // 0c72: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0c76: mov r5, r1
+    {
+        src = r[5];
+        r[1] = src;
+    }
+    // 0c78: add $ffac, r1
+    {
+        src = uint16_t(0xffac);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0c7c: sub r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 0c7e: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0c80: bic r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0c82: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+    }
+    // 0c84: div $2, r0
+    {
+        src = int16_t(uint16_t(0x0002));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0c88: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 0c8a: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 0c8c: movb $fe, (r3)+
+    {
+        src = uint8_t(0xfe);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 0c90: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0c94, L0c94);
+L0c94:
+    AOT_BLOCK(0x0c94, 2);
+    // 0c94: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0c98: blos 0c02
+    if (C | Z)
+        AOT_GOTO(0x0c02, L0c02);
+    AOT_GOTO(0x0c9a, L0c9a);
+L0c9a:
+    AOT_BLOCK(0x0c9a, 2);
+    // 0c9a: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0c9c: br 0c94
+    AOT_GOTO(0x0c94, L0c94);
+L0c9e:
+    AOT_BLOCK(0x0c9e, 2);
+    // 0c9e: cmpb $22, (r4)
+    {
+        src = uint8_t(0x22);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0ca2: beq 0caa
+    if (Z)
+        AOT_GOTO(0x0caa, L0caa);
+    AOT_GOTO(0x0ca4, L0ca4);
+L0ca4:
+    AOT_BLOCK(0x0ca4, 2);
+    // 0ca4: cmpb $27, (r4)
+    {
+        src = uint8_t(0x27);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0ca8: bne 0c94
+    if (!Z)
+        AOT_GOTO(0x0c94, L0c94);
+    AOT_GOTO(0x0caa, L0caa);
+L0caa:
+    AOT_BLOCK(0x0caa, 2);
+    // 0caa: movb (r4), -256(r5)
+    {
+        a = r[4];
+        src = RD8(a);
+        b = uint16_t(r[5] + -598);
+        WR8(b, src);
+    }
+    // 0cae: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cb0, L0cb0);
+L0cb0:
+    AOT_BLOCK(0x0cb0, 2);
+    // 0cb0: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cb4: blos 0c94
+    if (C | Z)
+        AOT_GOTO(0x0c94, L0c94);
+    AOT_GOTO(0x0cb6, L0cb6);
+L0cb6:
+    AOT_BLOCK(0x0cb6, 2);
+    // 0cb6: cmpb -256(r5), (r4)
+    {
+        a = uint16_t(r[5] + -598);
+        src = RD8(a);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0cba: bne 0cca
+    if (!Z)
+        AOT_GOTO(0x0cca, L0cca);
+    AOT_GOTO(0x0cbc, L0cbc);
+L0cbc:
+    AOT_BLOCK(0x0cbc, 1);
+    // 0cbc: br 0c94
+    AOT_GOTO(0x0c94, L0c94);
+L0cbe:
+    AOT_BLOCK(0x0cbe, 3);
+    // 0cbe: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0cc0: bitb $1, 4f24(r0)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[0] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0cc6: bne 0cd0
+    if (!Z)
+        AOT_GOTO(0x0cd0, L0cd0);
+    AOT_GOTO(0x0cc8, L0cc8);
+L0cc8:
+    AOT_BLOCK(0x0cc8, 1);
+    // 0cc8: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cca, L0cca);
+L0cca:
+    AOT_BLOCK(0x0cca, 2);
+    // 0cca: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cce: bhi 0cbe
+    if (!(C | Z))
+        AOT_GOTO(0x0cbe, L0cbe);
+    AOT_GOTO(0x0cd0, L0cd0);
+L0cd0:
+    AOT_BLOCK(0x0cd0, 2);
+    // 0cd0: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0cd2: br 0ce0
+    AOT_GOTO(0x0ce0, L0ce0);
+L0cd4:
+    AOT_BLOCK(0x0cd4, 3);
+    // 0cd4: movb (r2), r0
+    {
+        a = r[2];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 0cd6: bitb $1, 4f24(r0)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[0] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 0cdc: beq 0ce6
+    if (Z)
+        AOT_GOTO(0x0ce6, L0ce6);
+    AOT_GOTO(0x0cde, L0cde);
+L0cde:
+    AOT_BLOCK(0x0cde, 1);
+    // 0cde: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0ce0, L0ce0);
+L0ce0:
+    AOT_BLOCK(0x0ce0, 2);
+    // 0ce0: cmp 4(r5), r2
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ce4: bhi 0cd4
+    if (!(C | Z))
+        AOT_GOTO(0x0cd4, L0cd4);
+    AOT_GOTO(0x0ce6, L0ce6);
+L0ce6:
+    AOT_BLOCK(0x0ce6, 1);
+    // 0ce6: mov -8(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0cec, L0cec);
+L0cec:
+    AOT_BLOCK(0x0cec, 5);
+    // 0cec: sub $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[5] + -10);
+        WR16(b, val16);
+    }
+    // 0cf2: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 0cf4: add $ffac, r0
+    {
+        src = uint16_t(0xffac);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 0cf8: cmp -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0cfc: bcs 0d30
+    if (C)
+        AOT_GOTO(0x0d30, L0d30);
+    AOT_GOTO(0x0cfe, L0cfe);
+L0cfe:
+    AOT_BLOCK(0x0cfe, 4);
+    // 0cfe: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d00: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d02: mov *-a(r5), -(sp)
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d06: jsr pc, *$0a0e
+    {
+        a = 0x0a0e;
+        r[6] -= 2;
+        WR16(r[6], 0x0d0a);
+    }
+    AOT_GOTO(0x0a0e, L0a0e);
+L0d0a:
+    AOT_BLOCK(0x0d0a, 1);
+    // 0d0a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0d0c, L0d0c);
+L0d0c:
+    AOT_BLOCK(0x0d0c, 2);
+    // 0d0c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d0e: beq 0cec
+    if (Z)
+        AOT_GOTO(0x0cec, L0cec);
+    AOT_GOTO(0x0d10, L0d10);
+L0d10:
+    AOT_BLOCK(0x0d10, 12);
+    // 0d10: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d14: mov r5, r1
+    {
+        src = r[5];
+        r[1] = src;
+    }
+    // 0d16: add $ffac, r1
+    {
+        src = uint16_t(0xffac);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 0d1a: sub r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 0d1c: mov r0, r1
+    {
+        src = r[0];
+        r[1] = src;
+    }
+    // 0d1e: bic r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 0d20: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+    }
+    // 0d22: div $2, r0
+    {
+        src = int16_t(uint16_t(0x0002));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 0d26: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 0d28: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 0d2a: movb $fe, (r3)+
+    {
+        src = uint8_t(0xfe);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 0d2e: mov r2, r4
+    {
+        src = r[2];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d30, L0d30);
+L0d30:
+    AOT_BLOCK(0x0d30, 2);
+    // 0d30: cmp r2, r4
+    {
+        src = r[2];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0d32: blos 0cb0
+    if (C | Z)
+        AOT_GOTO(0x0cb0, L0cb0);
+    AOT_GOTO(0x0d34, L0d34);
+L0d34:
+    AOT_BLOCK(0x0d34, 2);
+    // 0d34: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0d36: br 0d30
+    AOT_GOTO(0x0d30, L0d30);
+L0d38:
+    AOT_BLOCK(0x0d38, 4);
+    // 0d38: movb -10(r5), (r3)+
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 0d3c: clrb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        WR8(a, 0);
+        C = false;
+    }
+    // 0d3e: mov -14(r5), r2
+    {
+        a = uint16_t(r[5] + -20);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d42: beq 0d7e
+    if (Z)
+        AOT_GOTO(0x0d7e, L0d7e);
+    AOT_GOTO(0x0d44, L0d44);
+L0d44:
+    AOT_BLOCK(0x0d44, 1);
+    // 0d44: dec r2
+    {
+        val = int(int16_t(r[2])) - 1;
+        r[2] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x0d46, L0d46);
+L0d46:
+    AOT_BLOCK(0x0d46, 2);
+    // 0d46: tstb -(r2)
+    {
+        r[2] -= 1;
+        a = r[2];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d48: bne 0d46
+    if (!Z)
+        AOT_GOTO(0x0d46, L0d46);
+    AOT_GOTO(0x0d4a, L0d4a);
+L0d4a:
+    AOT_BLOCK(0x0d4a, 4);
+    // 0d4a: mov -16(r5), (sp)
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d4e: inc r2
+    {
+        val = int(int16_t(r[2])) + 1;
+        r[2] = val;
+    }
+    // 0d50: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d52: jsr pc, *$299c
+    {
+        a = 0x299c;
+        r[6] -= 2;
+        WR16(r[6], 0x0d56);
+    }
+    AOT_GOTO(0x299c, L299c);
+L0d56:
+    AOT_BLOCK(0x0d56, 3);
+    // 0d56: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0d58: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0d5a: beq 0d9e
+    if (Z)
+        AOT_GOTO(0x0d9e, L0d9e);
+    AOT_GOTO(0x0d5c, L0d5c);
+L0d5c:
+    AOT_BLOCK(0x0d5c, 6);
+    // 0d5c: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d60: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0d62: dec -7bb4(r0)
+    {
+        a = uint16_t(r[0] + -31668);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0d66: mov *-12(r5), (sp)
+    {
+        a = RD16(r[5] + -18);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0d6a: mov $4233, -(sp)
+    {
+        src = uint16_t(0x4233);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0d6e: jsr pc, *$10f2
+    {
+        a = 0x10f2;
+        r[6] -= 2;
+        WR16(r[6], 0x0d72);
+    }
+    AOT_GOTO(0x10f2, L10f2);
+L0d72:
+    AOT_BLOCK(0x0d72, 4);
+    // 0d72: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 0d74: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d78: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 0d7a: inc -7bb4(r0)
+    {
+        a = uint16_t(r[0] + -31668);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0d7e, L0d7e);
+L0d7e:
+    AOT_BLOCK(0x0d7e, 4);
+    // 0d7e: mov -12(r5), r0
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d82: mov r3, r1
+    {
+        src = r[3];
+        r[1] = src;
+    }
+    // 0d84: dec r1
+    {
+        val = int(int16_t(r[1])) - 1;
+        r[1] = val;
+    }
+    // 0d86: mov r1, 2(r0)
+    {
+        src = r[1];
+        b = uint16_t(r[0] + 2);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d8a, L0d8a);
+L0d8a:
+    AOT_BLOCK(0x0d8a, 3);
+    // 0d8a: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0d8e: mov r4, 4c92
+    {
+        src = r[4];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0d92: mov r3, 4002
+    {
+        src = r[3];
+        b = 0x4002;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0d96, L0d96);
+L0d96:
+    AOT_BLOCK(0x0d96, 3);
+    // 0d96: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 0d9a: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L0d9e:
+    AOT_BLOCK(0x0d9e, 2);
+    // 0d9e: mov -16(r5), r3
+    {
+        a = uint16_t(r[5] + -22);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0da2: br 0d8a
+    AOT_GOTO(0x0d8a, L0d8a);
+L0da4:
+    AOT_BLOCK(0x0da4, 3);
+    // 0da4: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0da8;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 0da8: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0dac, L0dac);
+L0dac:
+    AOT_BLOCK(0x0dac, 3);
+    // 0dac: mov $4f24, 50a4
+    {
+        src = uint16_t(0x4f24);
+        b = 0x50a4;
+        WR16(b, src);
+    }
+    // 0db2: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0db4: jsr pc, *$026a
+    {
+        a = 0x026a;
+        r[6] -= 2;
+        WR16(r[6], 0x0db8);
+    }
+    AOT_GOTO(0x026a, L026a);
+L0db8:
+    AOT_BLOCK(0x0db8, 3);
+    // 0db8: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0dba: cmpb $a, *4c92
+    {
+        src = uint8_t(0x0a);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0dc0: bne 0dc6
+    if (!Z)
+        AOT_GOTO(0x0dc6, L0dc6);
+    AOT_GOTO(0x0dc2, L0dc2);
+L0dc2:
+    AOT_BLOCK(0x0dc2, 1);
+    // 0dc2: inc 4c92
+    {
+        a = 0x4c92;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0dc6, L0dc6);
+L0dc6:
+    AOT_BLOCK(0x0dc6, 1);
+    // 0dc6: jsr pc, 006e
+    {
+        a = 0x006e;
+        r[6] -= 2;
+        WR16(r[6], 0x0dca);
+    }
+    AOT_GOTO(0x006e, L006e);
+L0dca:
+    AOT_BLOCK(0x0dca, 3);
+    // 0dca: mov $5024, 50a4
+    {
+        src = uint16_t(0x5024);
+        b = 0x50a4;
+        WR16(b, src);
+    }
+    // 0dd0: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0dd2: jsr pc, *$06ba
+    {
+        a = 0x06ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0dd6);
+    }
+    AOT_GOTO(0x06ba, L06ba);
+L0dd6:
+    AOT_BLOCK(0x0dd6, 9);
+    // 0dd6: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0dd8: dec 4c92
+    {
+        a = 0x4c92;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0ddc: movb $23, *4c92
+    {
+        src = uint8_t(0x23);
+        b = RD16(0x4c92);
+        WR8(b, src);
+    }
+    // 0de2: mov 4c92, 4c90
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 0de8: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0dec: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0dee: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0df0: mov 4c92, -(sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0df4: jsr pc, *$11e0
+    {
+        a = 0x11e0;
+        r[6] -= 2;
+        WR16(r[6], 0x0df8);
+    }
+    AOT_GOTO(0x11e0, L11e0);
+L0df8:
+    AOT_BLOCK(0x0df8, 5);
+    // 0df8: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0dfa: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0dfc: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0e00: cmp 8b10, r3
+    {
+        a = 0x8b10;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e04: bne 0e2c
+    if (!Z)
+        AOT_GOTO(0x0e2c, L0e2c);
+    AOT_GOTO(0x0e06, L0e06);
+L0e06:
+    AOT_BLOCK(0x0e06, 2);
+    // 0e06: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e0a: beq 0e10
+    if (Z)
+        AOT_GOTO(0x0e10, L0e10);
+    AOT_GOTO(0x0e0c, L0e0c);
+L0e0c:
+    AOT_BLOCK(0x0e0c, 1);
+    // 0e0c: jmp *$0fba
+    {
+        a = 0x0fba;
+    }
+    AOT_GOTO(0x0fba, L0fba);
+L0e10:
+    AOT_BLOCK(0x0e10, 2);
+    // 0e10: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e12: jsr pc, *$0a4c
+    {
+        a = 0x0a4c;
+        r[6] -= 2;
+        WR16(r[6], 0x0e16);
+    }
+    AOT_GOTO(0x0a4c, L0a4c);
+L0e16:
+    AOT_BLOCK(0x0e16, 1);
+    // 0e16: br 0e28
+    AOT_GOTO(0x0e28, L0e28);
+L0e18:
+    AOT_BLOCK(0x0e18, 2);
+    // 0e18: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e1c: beq 0e22
+    if (Z)
+        AOT_GOTO(0x0e22, L0e22);
+    AOT_GOTO(0x0e1e, L0e1e);
+L0e1e:
+    AOT_BLOCK(0x0e1e, 1);
+    // 0e1e: jmp *$0fba
+    {
+        a = 0x0fba;
+    }
+    AOT_GOTO(0x0fba, L0fba);
+L0e22:
+    AOT_BLOCK(0x0e22, 2);
+    // 0e22: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e24: jsr pc, *$07ee
+    {
+        a = 0x07ee;
+        r[6] -= 2;
+        WR16(r[6], 0x0e28);
+    }
+    AOT_GOTO(0x07ee, L07ee);
+L0e28:
+    AOT_BLOCK(0x0e28, 2);
+    // 0e28: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e2a: br 0dac
+    AOT_GOTO(0x0dac, L0dac);
+L0e2c:
+    AOT_BLOCK(0x0e2c, 2);
+    // 0e2c: cmp 8b14, r3
+    {
+        a = 0x8b14;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e30: beq 0e18
+    if (Z)
+        AOT_GOTO(0x0e18, L0e18);
+    AOT_GOTO(0x0e32, L0e32);
+L0e32:
+    AOT_BLOCK(0x0e32, 2);
+    // 0e32: cmp 8b1e, r3
+    {
+        a = 0x8b1e;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0e36: bne 0ea0
+    if (!Z)
+        AOT_GOTO(0x0ea0, L0ea0);
+    AOT_GOTO(0x0e38, L0e38);
+L0e38:
+    AOT_BLOCK(0x0e38, 3);
+    // 0e38: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0e3c: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e3e: jsr pc, *$06ba
+    {
+        a = 0x06ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0e42);
+    }
+    AOT_GOTO(0x06ba, L06ba);
+L0e42:
+    AOT_BLOCK(0x0e42, 5);
+    // 0e42: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0e44: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0e46: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e48: mov 4c92, -(sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e4c: jsr pc, *$11e0
+    {
+        a = 0x11e0;
+        r[6] -= 2;
+        WR16(r[6], 0x0e50);
+    }
+    AOT_GOTO(0x11e0, L11e0);
+L0e50:
+    AOT_BLOCK(0x0e50, 5);
+    // 0e50: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0e52: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0e54: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0e58: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e5c: bne 0e64
+    if (!Z)
+        AOT_GOTO(0x0e64, L0e64);
+    AOT_GOTO(0x0e5e, L0e5e);
+L0e5e:
+    AOT_BLOCK(0x0e5e, 2);
+    // 0e5e: tst 2(r3)
+    {
+        a = uint16_t(r[3] + 2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e62: beq 0e98
+    if (Z)
+        AOT_GOTO(0x0e98, L0e98);
+    AOT_GOTO(0x0e64, L0e64);
+L0e64:
+    AOT_BLOCK(0x0e64, 2);
+    // 0e64: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0e68: jmp *$0fba
+    {
+        a = 0x0fba;
+    }
+    AOT_GOTO(0x0fba, L0fba);
+L0e6c:
+    AOT_BLOCK(0x0e6c, 3);
+    // 0e6c: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0e70: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e72: jsr pc, *$06ba
+    {
+        a = 0x06ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0e76);
+    }
+    AOT_GOTO(0x06ba, L06ba);
+L0e76:
+    AOT_BLOCK(0x0e76, 5);
+    // 0e76: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0e78: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0e7a: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0e7c: mov 4c92, -(sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0e80: jsr pc, *$11e0
+    {
+        a = 0x11e0;
+        r[6] -= 2;
+        WR16(r[6], 0x0e84);
+    }
+    AOT_GOTO(0x11e0, L11e0);
+L0e84:
+    AOT_BLOCK(0x0e84, 5);
+    // 0e84: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 0e86: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 0e88: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0e8c: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e90: bne 0e64
+    if (!Z)
+        AOT_GOTO(0x0e64, L0e64);
+    AOT_GOTO(0x0e92, L0e92);
+L0e92:
+    AOT_BLOCK(0x0e92, 2);
+    // 0e92: tst 2(r3)
+    {
+        a = uint16_t(r[3] + 2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0e96: beq 0e64
+    if (Z)
+        AOT_GOTO(0x0e64, L0e64);
+    AOT_GOTO(0x0e98, L0e98);
+L0e98:
+    AOT_BLOCK(0x0e98, 2);
+    // 0e98: inc 8b2a
+    {
+        a = 0x8b2a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0e9c: jmp *$0fba
+    {
+        a = 0x0fba;
+    }
+    AOT_GOTO(0x0fba, L0fba);
+L0ea0:
+    AOT_BLOCK(0x0ea0, 2);
+    // 0ea0: cmp 8b1c, r3
+    {
+        a = 0x8b1c;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ea4: beq 0e6c
+    if (Z)
+        AOT_GOTO(0x0e6c, L0e6c);
+    AOT_GOTO(0x0ea6, L0ea6);
+L0ea6:
+    AOT_BLOCK(0x0ea6, 2);
+    // 0ea6: cmp 8b1a, r3
+    {
+        a = 0x8b1a;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0eaa: bne 0edc
+    if (!Z)
+        AOT_GOTO(0x0edc, L0edc);
+    AOT_GOTO(0x0eac, L0eac);
+L0eac:
+    AOT_BLOCK(0x0eac, 2);
+    // 0eac: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0eb0: beq 0ec4
+    if (Z)
+        AOT_GOTO(0x0ec4, L0ec4);
+    AOT_GOTO(0x0eb2, L0eb2);
+L0eb2:
+    AOT_BLOCK(0x0eb2, 2);
+    // 0eb2: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0eb6: beq 0ebc
+    if (Z)
+        AOT_GOTO(0x0ebc, L0ebc);
+    AOT_GOTO(0x0eb8, L0eb8);
+L0eb8:
+    AOT_BLOCK(0x0eb8, 1);
+    // 0eb8: jmp *$0fba
+    {
+        a = 0x0fba;
+    }
+    AOT_GOTO(0x0fba, L0fba);
+L0ebc:
+    AOT_BLOCK(0x0ebc, 1);
+    // 0ebc: jsr pc, 003c
+    {
+        a = 0x003c;
+        r[6] -= 2;
+        WR16(r[6], 0x0ec0);
+    }
+    AOT_GOTO(0x003c, L003c);
+L0ec0:
+    AOT_BLOCK(0x0ec0, 1);
+    // 0ec0: jmp *$0fba
+    {
+        a = 0x0fba;
+    }
+    AOT_GOTO(0x0fba, L0fba);
+L0ec4:
+    AOT_BLOCK(0x0ec4, 2);
+    // 0ec4: tst 8b2a
+    {
+        a = 0x8b2a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ec8: beq 0ed2
+    if (Z)
+        AOT_GOTO(0x0ed2, L0ed2);
+    AOT_GOTO(0x0eca, L0eca);
+L0eca:
+    AOT_BLOCK(0x0eca, 2);
+    // 0eca: dec 8b2a
+    {
+        a = 0x8b2a;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0ece: jmp *$0fba
+    {
+        a = 0x0fba;
+    }
+    AOT_GOTO(0x0fba, L0fba);
+L0ed2:
+    AOT_BLOCK(0x0ed2, 3);
+    // 0ed2: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0ed4: mov $4240, -(sp)
+    {
+        src = uint16_t(0x4240);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0ed8: jmp *$0fb4
+    {
+        a = 0x0fb4;
+    }
+    AOT_GOTO(0x0fb4, L0fb4);
+L0edc:
+    AOT_BLOCK(0x0edc, 2);
+    // 0edc: cmp 8b18, r3
+    {
+        a = 0x8b18;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0ee0: bne 0f08
+    if (!Z)
+        AOT_GOTO(0x0f08, L0f08);
+    AOT_GOTO(0x0ee2, L0ee2);
+L0ee2:
+    AOT_BLOCK(0x0ee2, 2);
+    // 0ee2: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ee6: beq 0ef4
+    if (Z)
+        AOT_GOTO(0x0ef4, L0ef4);
+    AOT_GOTO(0x0ee8, L0ee8);
+L0ee8:
+    AOT_BLOCK(0x0ee8, 2);
+    // 0ee8: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0eec: bne 0e64
+    if (!Z)
+        AOT_GOTO(0x0e64, L0e64);
+    AOT_GOTO(0x0eee, L0eee);
+L0eee:
+    AOT_BLOCK(0x0eee, 2);
+    // 0eee: inc 8b2a
+    {
+        a = 0x8b2a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0ef2: br 0ebc
+    AOT_GOTO(0x0ebc, L0ebc);
+L0ef4:
+    AOT_BLOCK(0x0ef4, 2);
+    // 0ef4: tst 8b2a
+    {
+        a = 0x8b2a;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0ef8: beq 0f00
+    if (Z)
+        AOT_GOTO(0x0f00, L0f00);
+    AOT_GOTO(0x0efa, L0efa);
+L0efa:
+    AOT_BLOCK(0x0efa, 2);
+    // 0efa: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0efe: br 0eca
+    AOT_GOTO(0x0eca, L0eca);
+L0f00:
+    AOT_BLOCK(0x0f00, 3);
+    // 0f00: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0f02: mov $424e, -(sp)
+    {
+        src = uint16_t(0x424e);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f06: br 0fb4
+    AOT_GOTO(0x0fb4, L0fb4);
+L0f08:
+    AOT_BLOCK(0x0f08, 2);
+    // 0f08: cmp 8b12, r3
+    {
+        a = 0x8b12;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f0c: bne 0f36
+    if (!Z)
+        AOT_GOTO(0x0f36, L0f36);
+    AOT_GOTO(0x0f0e, L0f0e);
+L0f0e:
+    AOT_BLOCK(0x0f0e, 2);
+    // 0f0e: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f12: bne 0fba
+    if (!Z)
+        AOT_GOTO(0x0fba, L0fba);
+    AOT_GOTO(0x0f14, L0f14);
+L0f14:
+    AOT_BLOCK(0x0f14, 3);
+    // 0f14: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0f18: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f1a: jsr pc, *$06ba
+    {
+        a = 0x06ba;
+        r[6] -= 2;
+        WR16(r[6], 0x0f1e);
+    }
+    AOT_GOTO(0x06ba, L06ba);
+L0f1e:
+    AOT_BLOCK(0x0f1e, 5);
+    // 0f1e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 0f20: mov $fe, (sp)
+    {
+        src = uint16_t(0x00fe);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f24: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 0f26: mov 4c92, -(sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f2a: jsr pc, *$11e0
+    {
+        a = 0x11e0;
+        r[6] -= 2;
+        WR16(r[6], 0x0f2e);
+    }
+    AOT_GOTO(0x11e0, L11e0);
+L0f2e:
+    AOT_BLOCK(0x0f2e, 3);
+    // 0f2e: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 0f30: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0f34: br 0fba
+    AOT_GOTO(0x0fba, L0fba);
+L0f36:
+    AOT_BLOCK(0x0f36, 2);
+    // 0f36: cmp 8b16, r3
+    {
+        a = 0x8b16;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f3a: bne 0f5e
+    if (!Z)
+        AOT_GOTO(0x0f5e, L0f5e);
+    AOT_GOTO(0x0f3c, L0f3c);
+L0f3c:
+    AOT_BLOCK(0x0f3c, 3);
+    // 0f3c: mov r4, 4c94
+    {
+        src = r[4];
+        b = 0x4c94;
+        WR16(b, src);
+    }
+    // 0f40: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f44: bne 0f54
+    if (!Z)
+        AOT_GOTO(0x0f54, L0f54);
+    AOT_GOTO(0x0f46, L0f46);
+L0f46:
+    AOT_BLOCK(0x0f46, 1);
+    // 0f46: jsr pc, 1c62
+    {
+        a = 0x1c62;
+        r[6] -= 2;
+        WR16(r[6], 0x0f4a);
+    }
+    AOT_GOTO(0x1c62, L1c62);
+L0f4a:
+    AOT_BLOCK(0x0f4a, 2);
+    // 0f4a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f4c: beq 0f54
+    if (Z)
+        AOT_GOTO(0x0f54, L0f54);
+    AOT_GOTO(0x0f4e, L0f4e);
+L0f4e:
+    AOT_BLOCK(0x0f4e, 2);
+    // 0f4e: inc 8b2a
+    {
+        a = 0x8b2a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0f52: br 0f58
+    AOT_GOTO(0x0f58, L0f58);
+L0f54:
+    AOT_BLOCK(0x0f54, 1);
+    // 0f54: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x0f58, L0f58);
+L0f58:
+    AOT_BLOCK(0x0f58, 2);
+    // 0f58: mov 4c94, r4
+    {
+        a = 0x4c94;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f5c: br 0fba
+    AOT_GOTO(0x0fba, L0fba);
+L0f5e:
+    AOT_BLOCK(0x0f5e, 2);
+    // 0f5e: cmp 8b24, r3
+    {
+        a = 0x8b24;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 0f62: bne 0f9a
+    if (!Z)
+        AOT_GOTO(0x0f9a, L0f9a);
+    AOT_GOTO(0x0f64, L0f64);
+L0f64:
+    AOT_BLOCK(0x0f64, 2);
+    // 0f64: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f68: bne 0fba
+    if (!Z)
+        AOT_GOTO(0x0fba, L0fba);
+    AOT_GOTO(0x0f6a, L0f6a);
+L0f6a:
+    AOT_BLOCK(0x0f6a, 2);
+    // 0f6a: tst 8474
+    {
+        a = 0x8474;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 0f6e: bne 0fba
+    if (!Z)
+        AOT_GOTO(0x0fba, L0fba);
+    AOT_GOTO(0x0f70, L0f70);
+L0f70:
+    AOT_BLOCK(0x0f70, 5);
+    // 0f70: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0f72: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0f76: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 0f7a: dec 4c90
+    {
+        a = 0x4c90;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 0f7e: movb $23, *4c90
+    {
+        src = uint8_t(0x23);
+        b = RD16(0x4c90);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0f84, L0f84);
+L0f84:
+    AOT_BLOCK(0x0f84, 2);
+    // 0f84: cmpb $a, *4c92
+    {
+        src = uint8_t(0x0a);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0f8a: bne 0f90
+    if (!Z)
+        AOT_GOTO(0x0f90, L0f90);
+    AOT_GOTO(0x0f8c, L0f8c);
+L0f8c:
+    AOT_BLOCK(0x0f8c, 1);
+    // 0f8c: jmp *$0dac
+    {
+        a = 0x0dac;
+    }
+    AOT_GOTO(0x0dac, L0dac);
+L0f90:
+    AOT_BLOCK(0x0f90, 2);
+    // 0f90: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f92: jsr pc, *$026a
+    {
+        a = 0x026a;
+        r[6] -= 2;
+        WR16(r[6], 0x0f96);
+    }
+    AOT_GOTO(0x026a, L026a);
+L0f96:
+    AOT_BLOCK(0x0f96, 2);
+    // 0f96: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0f98: br 0f84
+    AOT_GOTO(0x0f84, L0f84);
+L0f9a:
+    AOT_BLOCK(0x0f9a, 3);
+    // 0f9a: inc 4c92
+    {
+        a = 0x4c92;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 0f9e: cmpb $a, *4c92
+    {
+        src = uint8_t(0x0a);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0fa4: bne 0fae
+    if (!Z)
+        AOT_GOTO(0x0fae, L0fae);
+    AOT_GOTO(0x0fa6, L0fa6);
+L0fa6:
+    AOT_BLOCK(0x0fa6, 2);
+    // 0fa6: mov 4c92, 4c90
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        b = 0x4c90;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fac: br 0fba
+    AOT_GOTO(0x0fba, L0fba);
+L0fae:
+    AOT_BLOCK(0x0fae, 2);
+    // 0fae: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 0fb0: mov $425b, -(sp)
+    {
+        src = uint16_t(0x425b);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fb4, L0fb4);
+L0fb4:
+    AOT_BLOCK(0x0fb4, 1);
+    // 0fb4: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x0fb8);
+    }
+    AOT_GOTO(0x106a, L106a);
+L0fb8:
+    AOT_BLOCK(0x0fb8, 1);
+    // 0fb8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x0fba, L0fba);
+L0fba:
+    AOT_BLOCK(0x0fba, 2);
+    // 0fba: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 0fbe: br 0fd2
+    AOT_GOTO(0x0fd2, L0fd2);
+L0fc0:
+    AOT_BLOCK(0x0fc0, 5);
+    // 0fc0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 0fc2: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 0fc6: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 0fca: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 0fcc: jsr pc, *$026a
+    {
+        a = 0x026a;
+        r[6] -= 2;
+        WR16(r[6], 0x0fd0);
+    }
+    AOT_GOTO(0x026a, L026a);
+L0fd0:
+    AOT_BLOCK(0x0fd0, 1);
+    // 0fd0: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x0fd2, L0fd2);
+L0fd2:
+    AOT_BLOCK(0x0fd2, 2);
+    // 0fd2: cmpb $a, *4c92
+    {
+        src = uint8_t(0x0a);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 0fd8: bne 0fc0
+    if (!Z)
+        AOT_GOTO(0x0fc0, L0fc0);
+    AOT_GOTO(0x0fda, L0fda);
+L0fda:
+    AOT_BLOCK(0x0fda, 2);
+    // 0fda: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 0fde: jmp *$0dac
+    {
+        a = 0x0dac;
+    }
+    AOT_GOTO(0x0dac, L0dac);
+L0fe2:
+    AOT_BLOCK(0x0fe2, 6);
+    // 0fe2: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x0fe6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 0fe6: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 0fea: sub $200, sp
+    {
+        src = uint16_t(0x0200);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 0fee: mov r5, r3
+    {
+        src = r[5];
+        r[3] = src;
+    }
+    // 0ff0: add $fdfa, r3
+    {
+        src = uint16_t(0xfdfa);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0ff4, L0ff4);
+L0ff4:
+    AOT_BLOCK(0x0ff4, 2);
+    // 0ff4: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 0ff6: bne 0ff4
+    if (!Z)
+        AOT_GOTO(0x0ff4, L0ff4);
+    AOT_GOTO(0x0ff8, L0ff8);
+L0ff8:
+    AOT_BLOCK(0x0ff8, 2);
+    // 0ff8: mov r5, r3
+    {
+        src = r[5];
+        r[3] = src;
+    }
+    // 0ffa: add $fdfa, r3
+    {
+        src = uint16_t(0xfdfa);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x0ffe, L0ffe);
+L0ffe:
+    AOT_BLOCK(0x0ffe, 3);
+    // 0ffe: movb (r3)+, r0
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1000: bitb $1, 4f24(r0)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[0] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1006: bne 0ffe
+    if (!Z)
+        AOT_GOTO(0x0ffe, L0ffe);
+    AOT_GOTO(0x1008, L1008);
+L1008:
+    AOT_BLOCK(0x1008, 2);
+    // 1008: cmpb $3d, -(r3)
+    {
+        src = uint8_t(0x3d);
+        r[3] -= 1;
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 100c: bne 1018
+    if (!Z)
+        AOT_GOTO(0x1018, L1018);
+    AOT_GOTO(0x100e, L100e);
+L100e:
+    AOT_BLOCK(0x100e, 1);
+    // 100e: movb $20, (r3)+
+    {
+        src = uint8_t(0x20);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1012, L1012);
+L1012:
+    AOT_BLOCK(0x1012, 2);
+    // 1012: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1014: bne 1012
+    if (!Z)
+        AOT_GOTO(0x1012, L1012);
+    AOT_GOTO(0x1016, L1016);
+L1016:
+    AOT_BLOCK(0x1016, 1);
+    // 1016: br 1020
+    AOT_GOTO(0x1020, L1020);
+L1018:
+    AOT_BLOCK(0x1018, 1);
+    // 1018: mov $426d, r4
+    {
+        src = uint16_t(0x426d);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x101c, L101c);
+L101c:
+    AOT_BLOCK(0x101c, 2);
+    // 101c: movb (r4)+, (r3)+
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 101e: bne 101c
+    if (!Z)
+        AOT_GOTO(0x101c, L101c);
+    AOT_GOTO(0x1020, L1020);
+L1020:
+    AOT_BLOCK(0x1020, 6);
+    // 1020: mov r3, 4c8e
+    {
+        src = r[3];
+        b = 0x4c8e;
+        WR16(b, src);
+    }
+    // 1024: movb $a, -(r3)
+    {
+        src = uint8_t(0x0a);
+        r[3] -= 1;
+        b = r[3];
+        WR8(b, src);
+    }
+    // 1028: mov $5024, 50a4
+    {
+        src = uint16_t(0x5024);
+        b = 0x50a4;
+        WR16(b, src);
+    }
+    // 102e: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1030: add $fdfa, (sp)
+    {
+        src = uint16_t(0xfdfa);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1034: jsr pc, *$0a4c
+    {
+        a = 0x0a4c;
+        r[6] -= 2;
+        WR16(r[6], 0x1038);
+    }
+    AOT_GOTO(0x0a4c, L0a4c);
+L1038:
+    AOT_BLOCK(0x1038, 3);
+    // 1038: mov 84ce, r0
+    {
+        a = 0x84ce;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 103c: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1040:
+    AOT_BLOCK(0x1040, 7);
+    // 1040: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1044;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 1044: movb $23, 4c96
+    {
+        src = uint8_t(0x23);
+        b = 0x4c96;
+        WR8(b, src);
+    }
+    // 104a: movb $23, *4002
+    {
+        src = uint8_t(0x23);
+        b = RD16(0x4002);
+        WR8(b, src);
+    }
+    // 1050: inc 4002
+    {
+        a = 0x4002;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1054: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1058: jsr pc, *$0fe2
+    {
+        a = 0x0fe2;
+        r[6] -= 2;
+        WR16(r[6], 0x105c);
+    }
+    AOT_GOTO(0x0fe2, L0fe2);
+L105c:
+    AOT_BLOCK(0x105c, 6);
+    // 105c: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 105e: dec (r4)
+    {
+        a = r[4];
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 1060: clrb 4c96
+    {
+        a = 0x4c96;
+        WR8(a, 0);
+        C = false;
+    }
+    // 1064: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1066: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L106a:
+    AOT_BLOCK(0x106a, 6);
+    // 106a: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x106e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 106e: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1072: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1074: tstb *-7bf0(r0)
+    {
+        a = RD16(r[0] + -31728);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1078: beq 1092
+    if (Z)
+        AOT_GOTO(0x1092, L1092);
+    AOT_GOTO(0x107a, L107a);
+L107a:
+    AOT_BLOCK(0x107a, 6);
+    // 107a: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 107e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1080: mov -7bf0(r0), (sp)
+    {
+        a = uint16_t(r[0] + -31728);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1084: mov $4270, -(sp)
+    {
+        src = uint16_t(0x4270);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1088: mov $4bca, -(sp)
+    {
+        src = uint16_t(0x4bca);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 108c: jsr pc, *$201c
+    {
+        a = 0x201c;
+        r[6] -= 2;
+        WR16(r[6], 0x1090);
+    }
+    AOT_GOTO(0x201c, L201c);
+L1090:
+    AOT_BLOCK(0x1090, 1);
+    // 1090: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1092, L1092);
+L1092:
+    AOT_BLOCK(0x1092, 6);
+    // 1092: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1096: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1098: mov -7bb4(r0), (sp)
+    {
+        a = uint16_t(r[0] + -31668);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 109c: mov $4275, -(sp)
+    {
+        src = uint16_t(0x4275);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10a0: mov $4bca, -(sp)
+    {
+        src = uint16_t(0x4bca);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10a4: jsr pc, *$201c
+    {
+        a = 0x201c;
+        r[6] -= 2;
+        WR16(r[6], 0x10a8);
+    }
+    AOT_GOTO(0x201c, L201c);
+L10a8:
+    AOT_BLOCK(0x10a8, 6);
+    // 10a8: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 10aa: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10ae: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10b2: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10b6: mov $4bca, -(sp)
+    {
+        src = uint16_t(0x4bca);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10ba: jsr pc, *$201c
+    {
+        a = 0x201c;
+        r[6] -= 2;
+        WR16(r[6], 0x10be);
+    }
+    AOT_GOTO(0x201c, L201c);
+L10be:
+    AOT_BLOCK(0x10be, 4);
+    // 10be: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 10c2: mov $427a, (sp)
+    {
+        src = uint16_t(0x427a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10c6: mov $4bca, -(sp)
+    {
+        src = uint16_t(0x4bca);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10ca: jsr pc, *$201c
+    {
+        a = 0x201c;
+        r[6] -= 2;
+        WR16(r[6], 0x10ce);
+    }
+    AOT_GOTO(0x201c, L201c);
+L10ce:
+    AOT_BLOCK(0x10ce, 4);
+    // 10ce: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 10d0: inc 84cc
+    {
+        a = 0x84cc;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 10d4: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L10d8:
+    AOT_BLOCK(0x10d8, 6);
+    // 10d8: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x10dc;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 10dc: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10e0: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 10e4: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 10e8: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x10ec);
+    }
+    AOT_GOTO(0x106a, L106a);
+L10ec:
+    AOT_BLOCK(0x10ec, 3);
+    // 10ec: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 10ee: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L10f2:
+    AOT_BLOCK(0x10f2, 8);
+    // 10f2: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x10f6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 10f6: tst -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 10f8: mov 84cc, -8(r5)
+    {
+        a = 0x84cc;
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 10fe: mov $ffff, 84cc
+    {
+        src = uint16_t(0xffff);
+        b = 0x84cc;
+        WR16(b, src);
+    }
+    // 1104: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1108: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 110c: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x1110);
+    }
+    AOT_GOTO(0x106a, L106a);
+L1110:
+    AOT_BLOCK(0x1110, 4);
+    // 1110: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1112: mov -8(r5), 84cc
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = 0x84cc;
+        WR16(b, src);
+    }
+    // 1118: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L111c:
+    AOT_BLOCK(0x111c, 8);
+    // 111c: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1120;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 1120: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1124: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1128: clr -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        WR16(a, 0);
+        C = false;
+    }
+    // 112c: movb 4c96, r0
+    {
+        a = 0x4c96;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1130: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1134: br 1140
+    AOT_GOTO(0x1140, L1140);
+L1136:
+    AOT_BLOCK(0x1136, 3);
+    // 1136: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 113a: add r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 113c: add r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1140, L1140);
+L1140:
+    AOT_BLOCK(0x1140, 2);
+    // 1140: movb (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1142: bne 1136
+    if (!Z)
+        AOT_GOTO(0x1136, L1136);
+    AOT_GOTO(0x1144, L1144);
+L1144:
+    AOT_BLOCK(0x1144, 6);
+    // 1144: mov -8(r5), r2
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 1148: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 114a: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 114c: div $190, r0
+    {
+        src = int16_t(uint16_t(0x0190));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1150: mov r1, r2
+    {
+        src = r[1];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1152: bge 1158
+    if (!(N ^ V))
+        AOT_GOTO(0x1158, L1158);
+    AOT_GOTO(0x1154, L1154);
+L1154:
+    AOT_BLOCK(0x1154, 1);
+    // 1154: add $190, r2
+    {
+        src = uint16_t(0x0190);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1158, L1158);
+L1158:
+    AOT_BLOCK(0x1158, 5);
+    // 1158: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 115a: ash $2, r0
+    {
+        src = uint16_t(0x0002) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 115e: add $84d0, r0
+    {
+        src = uint16_t(0x84d0);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1162: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1166: br 11cc
+    AOT_GOTO(0x11cc, L11cc);
+L1168:
+    AOT_BLOCK(0x1168, 1);
+    // 1168: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x116c, L116c);
+L116c:
+    AOT_BLOCK(0x116c, 2);
+    // 116c: cmpb (r4), (r3)+
+    {
+        a = r[4];
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 116e: bne 1198
+    if (!Z)
+        AOT_GOTO(0x1198, L1198);
+    AOT_GOTO(0x1170, L1170);
+L1170:
+    AOT_BLOCK(0x1170, 2);
+    // 1170: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1172: bne 116c
+    if (!Z)
+        AOT_GOTO(0x116c, L116c);
+    AOT_GOTO(0x1174, L1174);
+L1174:
+    AOT_BLOCK(0x1174, 2);
+    // 1174: cmp $fe, 6(r5)
+    {
+        src = uint16_t(0x00fe);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 117a: bne 118c
+    if (!Z)
+        AOT_GOTO(0x118c, L118c);
+    AOT_GOTO(0x117c, L117c);
+L117c:
+    AOT_BLOCK(0x117c, 4);
+    // 117c: mov *-c(r5), r0
+    {
+        a = RD16(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1180: movb $fe, (r0)
+    {
+        src = uint8_t(0xfe);
+        b = r[0];
+        WR8(b, src);
+    }
+    // 1184: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1188: clr 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x118c, L118c);
+L118c:
+    AOT_BLOCK(0x118c, 4);
+    // 118c: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1190: mov r0, 84ce
+    {
+        src = r[0];
+        b = 0x84ce;
+        WR16(b, src);
+    }
+    // 1194: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1198:
+    AOT_BLOCK(0x1198, 3);
+    // 1198: sub $4, -c(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[5] + -12);
+        WR16(b, val16);
+    }
+    // 119e: cmp $84d0, -c(r5)
+    {
+        src = uint16_t(0x84d0);
+        b = uint16_t(r[5] + -12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11a4: blos 11cc
+    if (C | Z)
+        AOT_GOTO(0x11cc, L11cc);
+    AOT_GOTO(0x11a6, L11a6);
+L11a6:
+    AOT_BLOCK(0x11a6, 2);
+    // 11a6: tst -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 11aa: beq 11c2
+    if (Z)
+        AOT_GOTO(0x11c2, L11c2);
+    AOT_GOTO(0x11ac, L11ac);
+L11ac:
+    AOT_BLOCK(0x11ac, 3);
+    // 11ac: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        C = false;
+    }
+    // 11ae: mov $427c, -(sp)
+    {
+        src = uint16_t(0x427c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11b2: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x11b6);
+    }
+    AOT_GOTO(0x106a, L106a);
+L11b6:
+    AOT_BLOCK(0x11b6, 3);
+    // 11b6: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 11b8: mov 84cc, (sp)
+    {
+        a = 0x84cc;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11bc: jsr pc, *$2712
+    {
+        a = 0x2712;
+        r[6] -= 2;
+        WR16(r[6], 0x11c0);
+    }
+    AOT_GOTO(0x2712, L2712);
+L11c0:
+    AOT_BLOCK(0x11c0, 1);
+    // 11c0: br 11cc
+    AOT_GOTO(0x11cc, L11cc);
+L11c2:
+    AOT_BLOCK(0x11c2, 2);
+    // 11c2: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 11c6: mov $8b0c, -c(r5)
+    {
+        src = uint16_t(0x8b0c);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x11cc, L11cc);
+L11cc:
+    AOT_BLOCK(0x11cc, 2);
+    // 11cc: mov *-c(r5), r3
+    {
+        a = RD16(r[5] + -12);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11d0: bne 1168
+    if (!Z)
+        AOT_GOTO(0x1168, L1168);
+    AOT_GOTO(0x11d2, L11d2);
+L11d2:
+    AOT_BLOCK(0x11d2, 2);
+    // 11d2: tst 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 11d6: ble 118c
+    if (Z || (N ^ V))
+        AOT_GOTO(0x118c, L118c);
+    AOT_GOTO(0x11d8, L11d8);
+L11d8:
+    AOT_BLOCK(0x11d8, 2);
+    // 11d8: mov 4(r5), *-c(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = RD16(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 11de: br 118c
+    AOT_GOTO(0x118c, L118c);
+L11e0:
+    AOT_BLOCK(0x11e0, 11);
+    // 11e0: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x11e4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 11e4: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 11e8: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 11ec: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 11f0: movb (r3), -8(r5)
+    {
+        a = r[3];
+        src = RD8(a);
+        b = uint16_t(r[5] + -8);
+        WR8(b, src);
+    }
+    // 11f4: clrb (r3)
+    {
+        a = r[3];
+        WR8(a, 0);
+    }
+    // 11f6: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 11f8: sub r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 11fa: cmp $8, r0
+    {
+        src = uint16_t(0x0008);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 11fe: bge 1208
+    if (!(N ^ V))
+        AOT_GOTO(0x1208, L1208);
+    AOT_GOTO(0x1200, L1200);
+L1200:
+    AOT_BLOCK(0x1200, 3);
+    // 1200: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+    }
+    // 1202: add $8, r2
+    {
+        src = uint16_t(0x0008);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1206: br 120a
+    AOT_GOTO(0x120a, L120a);
+L1208:
+    AOT_BLOCK(0x1208, 1);
+    // 1208: mov r3, r2
+    {
+        src = r[3];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x120a, L120a);
+L120a:
+    AOT_BLOCK(0x120a, 4);
+    // 120a: movb (r2), -a(r5)
+    {
+        a = r[2];
+        src = RD8(a);
+        b = uint16_t(r[5] + -10);
+        WR8(b, src);
+    }
+    // 120e: clrb (r2)
+    {
+        a = r[2];
+        WR8(a, 0);
+    }
+    // 1210: cmp $1, 8(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + 8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1216: bne 1220
+    if (!Z)
+        AOT_GOTO(0x1220, L1220);
+    AOT_GOTO(0x1218, L1218);
+L1218:
+    AOT_BLOCK(0x1218, 2);
+    // 1218: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 121a: jsr pc, *$14ea
+    {
+        a = 0x14ea;
+        r[6] -= 2;
+        WR16(r[6], 0x121e);
+    }
+    AOT_GOTO(0x14ea, L14ea);
+L121e:
+    AOT_BLOCK(0x121e, 1);
+    // 121e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1220, L1220);
+L1220:
+    AOT_BLOCK(0x1220, 3);
+    // 1220: mov 8(r5), (sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1224: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1226: jsr pc, *$111c
+    {
+        a = 0x111c;
+        r[6] -= 2;
+        WR16(r[6], 0x122a);
+    }
+    AOT_GOTO(0x111c, L111c);
+L122a:
+    AOT_BLOCK(0x122a, 7);
+    // 122a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 122c: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 1230: movb -a(r5), (r2)
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD8(a);
+        b = r[2];
+        WR8(b, src);
+    }
+    // 1234: movb -8(r5), (r3)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD8(a);
+        b = r[3];
+        WR8(b, src);
+    }
+    // 1238: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 123c: tst 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1240: beq 1258
+    if (Z)
+        AOT_GOTO(0x1258, L1258);
+    AOT_GOTO(0x1242, L1242);
+L1242:
+    AOT_BLOCK(0x1242, 2);
+    // 1242: tst 8b2c
+    {
+        a = 0x8b2c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1246: bne 1258
+    if (!Z)
+        AOT_GOTO(0x1258, L1258);
+    AOT_GOTO(0x1248, L1248);
+L1248:
+    AOT_BLOCK(0x1248, 3);
+    // 1248: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 124a: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 124c: jsr pc, *$1264
+    {
+        a = 0x1264;
+        r[6] -= 2;
+        WR16(r[6], 0x1250);
+    }
+    AOT_GOTO(0x1264, L1264);
+L1250:
+    AOT_BLOCK(0x1250, 3);
+    // 1250: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1252: mov r0, 4c94
+    {
+        src = r[0];
+        b = 0x4c94;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1256: br 125c
+    AOT_GOTO(0x125c, L125c);
+L1258:
+    AOT_BLOCK(0x1258, 1);
+    // 1258: clr 4c94
+    {
+        a = 0x4c94;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x125c, L125c);
+L125c:
+    AOT_BLOCK(0x125c, 3);
+    // 125c: mov -c(r5), r0
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1260: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1264:
+    AOT_BLOCK(0x1264, 7);
+    // 1264: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1268;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 1268: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 126c: sub $242, sp
+    {
+        src = uint16_t(0x0242);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 1270: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1274: mov 2(r0), r2
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1278: bne 12a2
+    if (!Z)
+        AOT_GOTO(0x12a2, L12a2);
+    AOT_GOTO(0x127a, L127a);
+L127a:
+    AOT_BLOCK(0x127a, 1);
+    // 127a: jmp *$14ba
+    {
+        a = 0x14ba;
+    }
+    AOT_GOTO(0x14ba, L14ba);
+L127e:
+    AOT_BLOCK(0x127e, 3);
+    // 127e: inc 83f6
+    {
+        a = 0x83f6;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1282: cmp $190, 83f6
+    {
+        src = uint16_t(0x0190);
+        b = 0x83f6;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1288: bge 12b2
+    if (!(N ^ V))
+        AOT_GOTO(0x12b2, L12b2);
+    AOT_GOTO(0x128a, L128a);
+L128a:
+    AOT_BLOCK(0x128a, 2);
+    // 128a: tst 8478
+    {
+        a = 0x8478;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 128e: bne 12b2
+    if (!Z)
+        AOT_GOTO(0x12b2, L12b2);
+    AOT_GOTO(0x1290, L1290);
+L1290:
+    AOT_BLOCK(0x1290, 3);
+    // 1290: mov *6(r5), (sp)
+    {
+        a = RD16(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1294: mov $428d, -(sp)
+    {
+        src = uint16_t(0x428d);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1298: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x129c);
+    }
+    AOT_GOTO(0x106a, L106a);
+L129c:
+    AOT_BLOCK(0x129c, 2);
+    // 129c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 129e: jmp *$14ba
+    {
+        a = 0x14ba;
+    }
+    AOT_GOTO(0x14ba, L14ba);
+L12a2:
+    AOT_BLOCK(0x12a2, 4);
+    // 12a2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 12a4: sub 83f8, r0
+    {
+        a = 0x83f8;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 12a8: cmp 83fa, r0
+    {
+        a = 0x83fa;
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12ac: bge 127e
+    if (!(N ^ V))
+        AOT_GOTO(0x127e, L127e);
+    AOT_GOTO(0x12ae, L12ae);
+L12ae:
+    AOT_BLOCK(0x12ae, 1);
+    // 12ae: clr 83f6
+    {
+        a = 0x83f6;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x12b2, L12b2);
+L12b2:
+    AOT_BLOCK(0x12b2, 4);
+    // 12b2: mov r4, 83f8
+    {
+        src = r[4];
+        b = 0x83f8;
+        WR16(b, src);
+    }
+    // 12b6: clr 83fa
+    {
+        a = 0x83fa;
+        WR16(a, 0);
+        C = false;
+    }
+    // 12ba: mov *6(r5), 83f4
+    {
+        a = RD16(r[5] + 6);
+        src = RD16(a);
+        b = 0x83f4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12c0: jsr pc, 006e
+    {
+        a = 0x006e;
+        r[6] -= 2;
+        WR16(r[6], 0x12c4);
+    }
+    AOT_GOTO(0x006e, L006e);
+L12c4:
+    AOT_BLOCK(0x12c4, 2);
+    // 12c4: cmp 8b26, 6(r5)
+    {
+        a = 0x8b26;
+        src = RD16(a);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12ca: bne 12f0
+    if (!Z)
+        AOT_GOTO(0x12f0, L12f0);
+    AOT_GOTO(0x12cc, L12cc);
+L12cc:
+    AOT_BLOCK(0x12cc, 9);
+    // 12cc: mov r5, r2
+    {
+        src = r[5];
+        r[2] = src;
+    }
+    // 12ce: add $fdba, r2
+    {
+        src = uint16_t(0xfdba);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 12d2: clrb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        WR8(a, 0);
+    }
+    // 12d4: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 12d8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 12da: mov -7bb4(r0), (sp)
+    {
+        a = uint16_t(r[0] + -31668);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 12de: mov $42a1, -(sp)
+    {
+        src = uint16_t(0x42a1);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 12e2: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 12e4: jsr pc, *$2078
+    {
+        a = 0x2078;
+        r[6] -= 2;
+        WR16(r[6], 0x12e8);
+    }
+    AOT_GOTO(0x2078, L2078);
+L12e8:
+    AOT_BLOCK(0x12e8, 1);
+    // 12e8: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x12ea, L12ea);
+L12ea:
+    AOT_BLOCK(0x12ea, 2);
+    // 12ea: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 12ec: bne 12ea
+    if (!Z)
+        AOT_GOTO(0x12ea, L12ea);
+    AOT_GOTO(0x12ee, L12ee);
+L12ee:
+    AOT_BLOCK(0x12ee, 1);
+    // 12ee: br 131a
+    AOT_GOTO(0x131a, L131a);
+L12f0:
+    AOT_BLOCK(0x12f0, 2);
+    // 12f0: cmp 8b28, 6(r5)
+    {
+        a = 0x8b28;
+        src = RD16(a);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 12f6: bne 131a
+    if (!Z)
+        AOT_GOTO(0x131a, L131a);
+    AOT_GOTO(0x12f8, L12f8);
+L12f8:
+    AOT_BLOCK(0x12f8, 9);
+    // 12f8: mov r5, r2
+    {
+        src = r[5];
+        r[2] = src;
+    }
+    // 12fa: add $fdba, r2
+    {
+        src = uint16_t(0xfdba);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 12fe: clrb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        WR8(a, 0);
+    }
+    // 1300: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1304: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1306: mov -7bf0(r0), (sp)
+    {
+        a = uint16_t(r[0] + -31728);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 130a: mov $42a4, -(sp)
+    {
+        src = uint16_t(0x42a4);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 130e: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1310: jsr pc, *$2078
+    {
+        a = 0x2078;
+        r[6] -= 2;
+        WR16(r[6], 0x1314);
+    }
+    AOT_GOTO(0x2078, L2078);
+L1314:
+    AOT_BLOCK(0x1314, 1);
+    // 1314: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1316, L1316);
+L1316:
+    AOT_BLOCK(0x1316, 2);
+    // 1316: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1318: bne 1316
+    if (!Z)
+        AOT_GOTO(0x1316, L1316);
+    AOT_GOTO(0x131a, L131a);
+L131a:
+    AOT_BLOCK(0x131a, 4);
+    // 131a: movb -(r2), r0
+    {
+        r[2] -= 1;
+        a = r[2];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 131c: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 1320: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1324: bne 132a
+    if (!Z)
+        AOT_GOTO(0x132a, L132a);
+    AOT_GOTO(0x1326, L1326);
+L1326:
+    AOT_BLOCK(0x1326, 1);
+    // 1326: jmp *$14a0
+    {
+        a = 0x14a0;
+    }
+    AOT_GOTO(0x14a0, L14a0);
+L132a:
+    AOT_BLOCK(0x132a, 7);
+    // 132a: mov r5, r3
+    {
+        src = r[5];
+        r[3] = src;
+    }
+    // 132c: add $fdba, r3
+    {
+        src = uint16_t(0xfdba);
+        dst = r[3];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[3] = val16;
+    }
+    // 1330: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 1332: add $ffba, r0
+    {
+        src = uint16_t(0xffba);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1336: mov r0, -248(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -584);
+        WR16(b, src);
+    }
+    // 133a: cmp $ff, -8(r5)
+    {
+        src = uint16_t(0x00ff);
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1340: bne 1348
+    if (!Z)
+        AOT_GOTO(0x1348, L1348);
+    AOT_GOTO(0x1342, L1342);
+L1342:
+    AOT_BLOCK(0x1342, 1);
+    // 1342: mov $1, -8(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1348, L1348);
+L1348:
+    AOT_BLOCK(0x1348, 3);
+    // 1348: mov $5024, 50a4
+    {
+        src = uint16_t(0x5024);
+        b = 0x50a4;
+        WR16(b, src);
+    }
+    // 134e: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1352: mov $ffff, 83ee
+    {
+        src = uint16_t(0xffff);
+        b = 0x83ee;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1358, L1358);
+L1358:
+    AOT_BLOCK(0x1358, 2);
+    // 1358: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 135a: jsr pc, *$06ba
+    {
+        a = 0x06ba;
+        r[6] -= 2;
+        WR16(r[6], 0x135e);
+    }
+    AOT_GOTO(0x06ba, L06ba);
+L135e:
+    AOT_BLOCK(0x135e, 3);
+    // 135e: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 1360: cmpb $a, *4c92
+    {
+        src = uint8_t(0x0a);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1366: beq 1358
+    if (Z)
+        AOT_GOTO(0x1358, L1358);
+    AOT_GOTO(0x1368, L1368);
+L1368:
+    AOT_BLOCK(0x1368, 2);
+    // 1368: cmpb $28, *4c92
+    {
+        src = uint8_t(0x28);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 136e: bne 1426
+    if (!Z)
+        AOT_GOTO(0x1426, L1426);
+    AOT_GOTO(0x1370, L1370);
+L1370:
+    AOT_BLOCK(0x1370, 7);
+    // 1370: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1374: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1376: mov -7bb4(r0), 83f0
+    {
+        a = uint16_t(r[0] + -31668);
+        src = RD16(a);
+        b = 0x83f0;
+        WR16(b, src);
+    }
+    // 137c: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1380: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1382: mov -7bf0(r0), 83f2
+    {
+        a = uint16_t(r[0] + -31728);
+        src = RD16(a);
+        b = 0x83f2;
+        WR16(b, src);
+    }
+    // 1388: mov $1, 83ee
+    {
+        src = uint16_t(0x0001);
+        b = 0x83ee;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x138e, L138e);
+L138e:
+    AOT_BLOCK(0x138e, 1);
+    // 138e: clrb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1390, L1390);
+L1390:
+    AOT_BLOCK(0x1390, 5);
+    // 1390: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1392: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 1396: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 139a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 139c: jsr pc, *$026a
+    {
+        a = 0x026a;
+        r[6] -= 2;
+        WR16(r[6], 0x13a0);
+    }
+    AOT_GOTO(0x026a, L026a);
+L13a0:
+    AOT_BLOCK(0x13a0, 3);
+    // 13a0: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 13a2: cmpb $28, *4c92
+    {
+        src = uint8_t(0x28);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 13a8: bne 13ae
+    if (!Z)
+        AOT_GOTO(0x13ae, L13ae);
+    AOT_GOTO(0x13aa, L13aa);
+L13aa:
+    AOT_BLOCK(0x13aa, 1);
+    // 13aa: inc 83ee
+    {
+        a = 0x83ee;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x13ae, L13ae);
+L13ae:
+    AOT_BLOCK(0x13ae, 2);
+    // 13ae: cmpb $29, *4c92
+    {
+        src = uint8_t(0x29);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 13b4: bne 13dc
+    if (!Z)
+        AOT_GOTO(0x13dc, L13dc);
+    AOT_GOTO(0x13b6, L13b6);
+L13b6:
+    AOT_BLOCK(0x13b6, 2);
+    // 13b6: dec 83ee
+    {
+        a = 0x83ee;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 13ba: bne 13dc
+    if (!Z)
+        AOT_GOTO(0x13dc, L13dc);
+    AOT_GOTO(0x13bc, L13bc);
+L13bc:
+    AOT_BLOCK(0x13bc, 5);
+    // 13bc: dec -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 13c0: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 13c2: add $fff8, r0
+    {
+        src = uint16_t(0xfff8);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 13c6: cmp -248(r5), r0
+    {
+        a = uint16_t(r[5] + -584);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13ca: bcs 1416
+    if (C)
+        AOT_GOTO(0x1416, L1416);
+    AOT_GOTO(0x13cc, L13cc);
+L13cc:
+    AOT_BLOCK(0x13cc, 3);
+    // 13cc: mov *6(r5), (sp)
+    {
+        a = RD16(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 13d0: mov $410c, -(sp)
+    {
+        src = uint16_t(0x410c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 13d4: jsr pc, *$10f2
+    {
+        a = 0x10f2;
+        r[6] -= 2;
+        WR16(r[6], 0x13d8);
+    }
+    AOT_GOTO(0x10f2, L10f2);
+L13d8:
+    AOT_BLOCK(0x13d8, 2);
+    // 13d8: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 13da: br 1420
+    AOT_GOTO(0x1420, L1420);
+L13dc:
+    AOT_BLOCK(0x13dc, 2);
+    // 13dc: cmp $1, 83ee
+    {
+        src = uint16_t(0x0001);
+        b = 0x83ee;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13e2: bne 13f6
+    if (!Z)
+        AOT_GOTO(0x13f6, L13f6);
+    AOT_GOTO(0x13e4, L13e4);
+L13e4:
+    AOT_BLOCK(0x13e4, 2);
+    // 13e4: cmpb $2c, *4c92
+    {
+        src = uint8_t(0x2c);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 13ea: bne 13f6
+    if (!Z)
+        AOT_GOTO(0x13f6, L13f6);
+    AOT_GOTO(0x13ec, L13ec);
+L13ec:
+    AOT_BLOCK(0x13ec, 1);
+    // 13ec: br 13bc
+    AOT_GOTO(0x13bc, L13bc);
+L13ee:
+    AOT_BLOCK(0x13ee, 2);
+    // 13ee: movb *4c92, (r3)+
+    {
+        a = RD16(0x4c92);
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 13f2: inc 4c92
+    {
+        a = 0x4c92;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x13f6, L13f6);
+L13f6:
+    AOT_BLOCK(0x13f6, 2);
+    // 13f6: cmp r4, 4c92
+    {
+        src = r[4];
+        b = 0x4c92;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 13fa: bhi 13ee
+    if (!(C | Z))
+        AOT_GOTO(0x13ee, L13ee);
+    AOT_GOTO(0x13fc, L13fc);
+L13fc:
+    AOT_BLOCK(0x13fc, 4);
+    // 13fc: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 13fe: add $ffba, r0
+    {
+        src = uint16_t(0xffba);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1402: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1404: blos 1390
+    if (C | Z)
+        AOT_GOTO(0x1390, L1390);
+    AOT_GOTO(0x1406, L1406);
+L1406:
+    AOT_BLOCK(0x1406, 3);
+    // 1406: mov *6(r5), (sp)
+    {
+        a = RD16(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 140a: mov $42a9, -(sp)
+    {
+        src = uint16_t(0x42a9);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 140e: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x1412);
+    }
+    AOT_GOTO(0x106a, L106a);
+L1412:
+    AOT_BLOCK(0x1412, 2);
+    // 1412: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1414: br 1390
+    AOT_GOTO(0x1390, L1390);
+L1416:
+    AOT_BLOCK(0x1416, 2);
+    // 1416: mov r3, *-248(r5)
+    {
+        src = r[3];
+        b = RD16(r[5] + -584);
+        WR16(b, src);
+    }
+    // 141a: add $2, -248(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -584);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1420, L1420);
+L1420:
+    AOT_BLOCK(0x1420, 2);
+    // 1420: tst 83ee
+    {
+        a = 0x83ee;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1424: bne 138e
+    if (!Z)
+        AOT_GOTO(0x138e, L138e);
+    AOT_GOTO(0x1426, L1426);
+L1426:
+    AOT_BLOCK(0x1426, 2);
+    // 1426: tst -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 142a: beq 1448
+    if (Z)
+        AOT_GOTO(0x1448, L1448);
+    AOT_GOTO(0x142c, L142c);
+L142c:
+    AOT_BLOCK(0x142c, 3);
+    // 142c: mov *6(r5), (sp)
+    {
+        a = RD16(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1430: mov $410c, -(sp)
+    {
+        src = uint16_t(0x410c);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1434: jsr pc, *$10f2
+    {
+        a = 0x10f2;
+        r[6] -= 2;
+        WR16(r[6], 0x1438);
+    }
+    AOT_GOTO(0x10f2, L10f2);
+L1438:
+    AOT_BLOCK(0x1438, 2);
+    // 1438: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 143a: br 1448
+    AOT_GOTO(0x1448, L1448);
+L143c:
+    AOT_BLOCK(0x143c, 2);
+    // 143c: mov $42bf, *-248(r5)
+    {
+        src = uint16_t(0x42bf);
+        b = RD16(r[5] + -584);
+        WR16(b, src);
+    }
+    // 1442: add $2, -248(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -584);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1448, L1448);
+L1448:
+    AOT_BLOCK(0x1448, 2);
+    // 1448: dec -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 144c: bge 143c
+    if (!(N ^ V))
+        AOT_GOTO(0x143c, L143c);
+    AOT_GOTO(0x144e, L144e);
+L144e:
+    AOT_BLOCK(0x144e, 3);
+    // 144e: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 1452: mov $4f24, 50a4
+    {
+        src = uint16_t(0x4f24);
+        b = 0x50a4;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1458: br 14a0
+    AOT_GOTO(0x14a0, L14a0);
+L145a:
+    AOT_BLOCK(0x145a, 2);
+    // 145a: cmp r4, 4c8a
+    {
+        src = r[4];
+        b = 0x4c8a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 145e: bhi 1472
+    if (!(C | Z))
+        AOT_GOTO(0x1472, L1472);
+    AOT_GOTO(0x1460, L1460);
+L1460:
+    AOT_BLOCK(0x1460, 5);
+    // 1460: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1462: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 1466: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 146a: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 146c: jsr pc, *$06e6
+    {
+        a = 0x06e6;
+        r[6] -= 2;
+        WR16(r[6], 0x1470);
+    }
+    AOT_GOTO(0x06e6, L06e6);
+L1470:
+    AOT_BLOCK(0x1470, 1);
+    // 1470: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1472, L1472);
+L1472:
+    AOT_BLOCK(0x1472, 2);
+    // 1472: movb (r2), -(r4)
+    {
+        a = r[2];
+        src = RD8(a);
+        r[4] -= 1;
+        b = r[4];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1474: br 14a0
+    AOT_GOTO(0x14a0, L14a0);
+L1476:
+    AOT_BLOCK(0x1476, 5);
+    // 1476: movb -(r2), r0
+    {
+        r[2] -= 1;
+        a = r[2];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1478: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 147a: add r5, r0
+    {
+        src = r[5];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 147c: mov -48(r0), r3
+    {
+        a = uint16_t(r[0] + -72);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1480: br 149c
+    AOT_GOTO(0x149c, L149c);
+L1482:
+    AOT_BLOCK(0x1482, 2);
+    // 1482: cmp r4, 4c8a
+    {
+        src = r[4];
+        b = 0x4c8a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1486: bhi 149a
+    if (!(C | Z))
+        AOT_GOTO(0x149a, L149a);
+    AOT_GOTO(0x1488, L1488);
+L1488:
+    AOT_BLOCK(0x1488, 5);
+    // 1488: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 148a: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 148e: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 1492: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1494: jsr pc, *$06e6
+    {
+        a = 0x06e6;
+        r[6] -= 2;
+        WR16(r[6], 0x1498);
+    }
+    AOT_GOTO(0x06e6, L06e6);
+L1498:
+    AOT_BLOCK(0x1498, 1);
+    // 1498: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x149a, L149a);
+L149a:
+    AOT_BLOCK(0x149a, 1);
+    // 149a: movb (r3), -(r4)
+    {
+        a = r[3];
+        src = RD8(a);
+        r[4] -= 1;
+        b = r[4];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x149c, L149c);
+L149c:
+    AOT_BLOCK(0x149c, 2);
+    // 149c: tstb -(r3)
+    {
+        r[3] -= 1;
+        a = r[3];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 149e: bne 1482
+    if (!Z)
+        AOT_GOTO(0x1482, L1482);
+    AOT_GOTO(0x14a0, L14a0);
+L14a0:
+    AOT_BLOCK(0x14a0, 3);
+    // 14a0: movb -(r2), r0
+    {
+        r[2] -= 1;
+        a = r[2];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 14a2: bitb $20, 4f24(r0)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[0] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 14a8: beq 145a
+    if (Z)
+        AOT_GOTO(0x145a, L145a);
+    AOT_GOTO(0x14aa, L14aa);
+L14aa:
+    AOT_BLOCK(0x14aa, 2);
+    // 14aa: cmpb 4004, (r2)
+    {
+        a = 0x4004;
+        src = RD8(a);
+        b = r[2];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 14ae: beq 1476
+    if (Z)
+        AOT_GOTO(0x1476, L1476);
+    AOT_GOTO(0x14b0, L14b0);
+L14b0:
+    AOT_BLOCK(0x14b0, 3);
+    // 14b0: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 14b2: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 14b6: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14ba, L14ba);
+L14ba:
+    AOT_BLOCK(0x14ba, 3);
+    // 14ba: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 14bc: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L14c0:
+    AOT_BLOCK(0x14c0, 4);
+    // 14c0: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x14c4;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 14c4: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 14c8: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14ca, L14ca);
+L14ca:
+    AOT_BLOCK(0x14ca, 2);
+    // 14ca: tstb (r3)+
+    {
+        a = r[3];
+        r[3] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 14cc: bne 14ca
+    if (!Z)
+        AOT_GOTO(0x14ca, L14ca);
+    AOT_GOTO(0x14ce, L14ce);
+L14ce:
+    AOT_BLOCK(0x14ce, 1);
+    // 14ce: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x14d0, L14d0);
+L14d0:
+    AOT_BLOCK(0x14d0, 2);
+    // 14d0: cmp r4, r3
+    {
+        src = r[4];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14d2: bcc 14da
+    if (!C)
+        AOT_GOTO(0x14da, L14da);
+    AOT_GOTO(0x14d4, L14d4);
+L14d4:
+    AOT_BLOCK(0x14d4, 2);
+    // 14d4: cmpb $2f, -(r3)
+    {
+        src = uint8_t(0x2f);
+        r[3] -= 1;
+        b = r[3];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 14d8: bne 14d0
+    if (!Z)
+        AOT_GOTO(0x14d0, L14d0);
+    AOT_GOTO(0x14da, L14da);
+L14da:
+    AOT_BLOCK(0x14da, 2);
+    // 14da: cmp r4, r3
+    {
+        src = r[4];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 14dc: bne 14e2
+    if (!Z)
+        AOT_GOTO(0x14e2, L14e2);
+    AOT_GOTO(0x14de, L14de);
+L14de:
+    AOT_BLOCK(0x14de, 1);
+    // 14de: movb $2e, (r3)+
+    {
+        src = uint8_t(0x2e);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14e2, L14e2);
+L14e2:
+    AOT_BLOCK(0x14e2, 4);
+    // 14e2: clrb (r3)
+    {
+        a = r[3];
+        WR8(a, 0);
+        C = false;
+    }
+    // 14e4: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 14e6: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L14ea:
+    AOT_BLOCK(0x14ea, 4);
+    // 14ea: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x14ee;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 14ee: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 14f2: mov 4002, r3
+    {
+        a = 0x4002;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x14f6, L14f6);
+L14f6:
+    AOT_BLOCK(0x14f6, 4);
+    // 14f6: mov 4002, r0
+    {
+        a = 0x4002;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 14fa: inc 4002
+    {
+        a = 0x4002;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 14fe: movb (r4)+, (r0)
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        b = r[0];
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1500: bne 14f6
+    if (!Z)
+        AOT_GOTO(0x14f6, L14f6);
+    AOT_GOTO(0x1502, L1502);
+L1502:
+    AOT_BLOCK(0x1502, 3);
+    // 1502: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 1504: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1508:
+    AOT_BLOCK(0x1508, 2);
+    // 1508: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x150c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    AOT_GOTO(0x150c, L150c);
+L150c:
+    AOT_BLOCK(0x150c, 2);
+    // 150c: tstb *4(r5)
+    {
+        a = RD16(r[5] + 4);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1510: beq 152c
+    if (Z)
+        AOT_GOTO(0x152c, L152c);
+    AOT_GOTO(0x1512, L1512);
+L1512:
+    AOT_BLOCK(0x1512, 4);
+    // 1512: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1516: inc 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 151a: cmpb 6(r5), (r0)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD8(a);
+        b = r[0];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 151e: bne 150c
+    if (!Z)
+        AOT_GOTO(0x150c, L150c);
+    AOT_GOTO(0x1520, L1520);
+L1520:
+    AOT_BLOCK(0x1520, 2);
+    // 1520: dec 4(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+    }
+    // 1524: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1528, L1528);
+L1528:
+    AOT_BLOCK(0x1528, 2);
+    // 1528: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L152c:
+    AOT_BLOCK(0x152c, 2);
+    // 152c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 152e: br 1528
+    AOT_GOTO(0x1528, L1528);
+L153c:
+    AOT_BLOCK(0x153c, 6);
+    // 153c: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1540;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 1540: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1544: mov $42bf, r2
+    {
+        src = uint16_t(0x42bf);
+        r[2] = src;
+    }
+    // 1548: clr r4
+    {
+        r[4] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 154a: br 1558
+    AOT_GOTO(0x1558, L1558);
+L154c:
+    AOT_BLOCK(0x154c, 2);
+    // 154c: bisb $7, 4f24(r3)
+    {
+        src = uint8_t(0x07);
+        b = uint16_t(r[3] + 20260);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 1552: movb $2, 4e24(r3)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[3] + 20004);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1558, L1558);
+L1558:
+    AOT_BLOCK(0x1558, 2);
+    // 1558: movb (r2)+, r3
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 155a: bne 154c
+    if (!Z)
+        AOT_GOTO(0x154c, L154c);
+    AOT_GOTO(0x155c, L155c);
+L155c:
+    AOT_BLOCK(0x155c, 2);
+    // 155c: mov $42ff, r2
+    {
+        src = uint16_t(0x42ff);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1560: br 156e
+    AOT_GOTO(0x156e, L156e);
+L1562:
+    AOT_BLOCK(0x1562, 2);
+    // 1562: bisb $6, 4f24(r3)
+    {
+        src = uint8_t(0x06);
+        b = uint16_t(r[3] + 20260);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 1568: movb $3, 4e24(r3)
+    {
+        src = uint8_t(0x03);
+        b = uint16_t(r[3] + 20004);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x156e, L156e);
+L156e:
+    AOT_BLOCK(0x156e, 2);
+    // 156e: movb (r2)+, r3
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1570: bne 1562
+    if (!Z)
+        AOT_GOTO(0x1562, L1562);
+    AOT_GOTO(0x1572, L1572);
+L1572:
+    AOT_BLOCK(0x1572, 2);
+    // 1572: mov $430b, r2
+    {
+        src = uint16_t(0x430b);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1576: br 157e
+    AOT_GOTO(0x157e, L157e);
+L1578:
+    AOT_BLOCK(0x1578, 1);
+    // 1578: bisb $2, 4f24(r3)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[3] + 20260);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x157e, L157e);
+L157e:
+    AOT_BLOCK(0x157e, 2);
+    // 157e: movb (r2)+, r3
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1580: bne 1578
+    if (!Z)
+        AOT_GOTO(0x1578, L1578);
+    AOT_GOTO(0x1582, L1582);
+L1582:
+    AOT_BLOCK(0x1582, 2);
+    // 1582: mov $4311, r2
+    {
+        src = uint16_t(0x4311);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1586: br 158e
+    AOT_GOTO(0x158e, L158e);
+L1588:
+    AOT_BLOCK(0x1588, 1);
+    // 1588: bisb $10, 4f24(r3)
+    {
+        src = uint8_t(0x10);
+        b = uint16_t(r[3] + 20260);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x158e, L158e);
+L158e:
+    AOT_BLOCK(0x158e, 2);
+    // 158e: movb (r2)+, r3
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1590: bne 1588
+    if (!Z)
+        AOT_GOTO(0x1588, L1588);
+    AOT_GOTO(0x1592, L1592);
+L1592:
+    AOT_BLOCK(0x1592, 2);
+    // 1592: mov $4316, r2
+    {
+        src = uint16_t(0x4316);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1596: br 159e
+    AOT_GOTO(0x159e, L159e);
+L1598:
+    AOT_BLOCK(0x1598, 1);
+    // 1598: bisb $8, 4f24(r3)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[3] + 20260);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x159e, L159e);
+L159e:
+    AOT_BLOCK(0x159e, 2);
+    // 159e: movb (r2)+, r3
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 15a0: bne 1598
+    if (!Z)
+        AOT_GOTO(0x1598, L1598);
+    AOT_GOTO(0x15a2, L15a2);
+L15a2:
+    AOT_BLOCK(0x15a2, 5);
+    // 15a2: movb 4004, r0
+    {
+        a = 0x4004;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 15a6: bisb $20, 4f24(r0)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[0] + 20260);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 15ac: bisb $3a, 4f24
+    {
+        src = uint8_t(0x3a);
+        b = 0x4f24;
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 15b2: mov $100, r4
+    {
+        src = uint16_t(0x0100);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15b6: br 15c4
+    AOT_GOTO(0x15c4, L15c4);
+L15b8:
+    AOT_BLOCK(0x15b8, 3);
+    // 15b8: movb 4ea4(r4), r0
+    {
+        a = uint16_t(r[4] + 20132);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 15bc: bis $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 15c0: movb r0, 4fa4(r4)
+    {
+        src = uint8_t(r[0]);
+        b = uint16_t(r[4] + 20388);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15c4, L15c4);
+L15c4:
+    AOT_BLOCK(0x15c4, 2);
+    // 15c4: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 15c6: bge 15b8
+    if (!(N ^ V))
+        AOT_GOTO(0x15b8, L15b8);
+    AOT_GOTO(0x15c8, L15c8);
+L15c8:
+    AOT_BLOCK(0x15c8, 2);
+    // 15c8: mov $4319, r2
+    {
+        src = uint16_t(0x4319);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 15cc: br 15d4
+    AOT_GOTO(0x15d4, L15d4);
+L15ce:
+    AOT_BLOCK(0x15ce, 1);
+    // 15ce: movb $1, 4e24(r3)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[3] + 20004);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15d4, L15d4);
+L15d4:
+    AOT_BLOCK(0x15d4, 2);
+    // 15d4: movb (r2)+, r3
+    {
+        a = r[2];
+        r[2] += 1;
+        src = RD8(a);
+        r[3] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 15d6: bne 15ce
+    if (!Z)
+        AOT_GOTO(0x15ce, L15ce);
+    AOT_GOTO(0x15d8, L15d8);
+L15d8:
+    AOT_BLOCK(0x15d8, 5);
+    // 15d8: clr r0
+    {
+        r[0] = 0;
+    }
+    // 15da: mov r0, 847a
+    {
+        src = r[0];
+        b = 0x847a;
+        WR16(b, src);
+    }
+    // 15de: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 15e0: mov $431f, -7bf0(r0)
+    {
+        src = uint16_t(0x431f);
+        b = uint16_t(r[0] + -31728);
+        WR16(b, src);
+    }
+    // 15e6: mov $1, r4
+    {
+        src = uint16_t(0x0001);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x15ea, L15ea);
+L15ea:
+    AOT_BLOCK(0x15ea, 2);
+    // 15ea: cmp 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 15ee: bgt 15f4
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x15f4, L15f4);
+    AOT_GOTO(0x15f0, L15f0);
+L15f0:
+    AOT_BLOCK(0x15f0, 1);
+    // 15f0: jmp *$17fc
+    {
+        a = 0x17fc;
+    }
+    AOT_GOTO(0x17fc, L17fc);
+L15f4:
+    AOT_BLOCK(0x15f4, 7);
+    // 15f4: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 15f6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 15f8: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 15fc: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 15fe: movb (r0), r0
+    {
+        a = r[0];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1600: cmp r0, $2d
+    {
+        src = r[0];
+        dst = uint16_t(0x002d);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1604: beq 160a
+    if (Z)
+        AOT_GOTO(0x160a, L160a);
+    AOT_GOTO(0x1606, L1606);
+L1606:
+    AOT_BLOCK(0x1606, 1);
+    // 1606: jmp *$171a
+    {
+        a = 0x171a;
+    }
+    AOT_GOTO(0x171a, L171a);
+L160a:
+    AOT_BLOCK(0x160a, 7);
+    // 160a: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 160c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 160e: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1612: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1614: movb 1(r0), r0
+    {
+        a = uint16_t(r[0] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1618: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 161a: beq 16be
+    if (Z)
+        AOT_GOTO(0x16be, L16be);
+    AOT_GOTO(0x161c, L161c);
+L161c:
+    AOT_BLOCK(0x161c, 2);
+    // 161c: cmp r0, $43
+    {
+        src = r[0];
+        dst = uint16_t(0x0043);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1620: beq 1672
+    if (Z)
+        AOT_GOTO(0x1672, L1672);
+    AOT_GOTO(0x1622, L1622);
+L1622:
+    AOT_BLOCK(0x1622, 2);
+    // 1622: cmp r0, $44
+    {
+        src = r[0];
+        dst = uint16_t(0x0044);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1626: beq 1678
+    if (Z)
+        AOT_GOTO(0x1678, L1678);
+    AOT_GOTO(0x1628, L1628);
+L1628:
+    AOT_BLOCK(0x1628, 2);
+    // 1628: cmp r0, $45
+    {
+        src = r[0];
+        dst = uint16_t(0x0045);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 162c: beq 16be
+    if (Z)
+        AOT_GOTO(0x16be, L16be);
+    AOT_GOTO(0x162e, L162e);
+L162e:
+    AOT_BLOCK(0x162e, 2);
+    // 162e: cmp r0, $49
+    {
+        src = r[0];
+        dst = uint16_t(0x0049);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1632: beq 16e4
+    if (Z)
+        AOT_GOTO(0x16e4, L16e4);
+    AOT_GOTO(0x1634, L1634);
+L1634:
+    AOT_BLOCK(0x1634, 2);
+    // 1634: cmp r0, $50
+    {
+        src = r[0];
+        dst = uint16_t(0x0050);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1638: beq 1666
+    if (Z)
+        AOT_GOTO(0x1666, L1666);
+    AOT_GOTO(0x163a, L163a);
+L163a:
+    AOT_BLOCK(0x163a, 2);
+    // 163a: cmp r0, $52
+    {
+        src = r[0];
+        dst = uint16_t(0x0052);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 163e: beq 166c
+    if (Z)
+        AOT_GOTO(0x166c, L166c);
+    AOT_GOTO(0x1640, L1640);
+L1640:
+    AOT_BLOCK(0x1640, 2);
+    // 1640: cmp r0, $55
+    {
+        src = r[0];
+        dst = uint16_t(0x0055);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1644: beq 16c2
+    if (Z)
+        AOT_GOTO(0x16c2, L16c2);
+    AOT_GOTO(0x1646, L1646);
+L1646:
+    AOT_BLOCK(0x1646, 6);
+    // 1646: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1648: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 164a: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 164e: mov (r0), (sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1650: mov $4381, -(sp)
+    {
+        src = uint16_t(0x4381);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1654: br 16b8
+    AOT_GOTO(0x16b8, L16b8);
+L1656:
+    AOT_BLOCK(0x1656, 6);
+    // 1656: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1658: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 165a: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 165e: mov (r0), (sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1660: mov $4320, -(sp)
+    {
+        src = uint16_t(0x4320);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1664: br 16b8
+    AOT_GOTO(0x16b8, L16b8);
+L1666:
+    AOT_BLOCK(0x1666, 2);
+    // 1666: inc 8474
+    {
+        a = 0x8474;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 166a: br 16be
+    AOT_GOTO(0x16be, L16be);
+L166c:
+    AOT_BLOCK(0x166c, 2);
+    // 166c: inc 8478
+    {
+        a = 0x8478;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1670: br 16be
+    AOT_GOTO(0x16be, L16be);
+L1672:
+    AOT_BLOCK(0x1672, 2);
+    // 1672: inc 8476
+    {
+        a = 0x8476;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1676: br 16be
+    AOT_GOTO(0x16be, L16be);
+L1678:
+    AOT_BLOCK(0x1678, 2);
+    // 1678: cmp $84a4, 400c
+    {
+        src = uint16_t(0x84a4);
+        b = 0x400c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 167e: bcs 1656
+    if (C)
+        AOT_GOTO(0x1656, L1656);
+    AOT_GOTO(0x1680, L1680);
+L1680:
+    AOT_BLOCK(0x1680, 6);
+    // 1680: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1682: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1684: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1688: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 168a: tstb 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 168e: beq 16be
+    if (Z)
+        AOT_GOTO(0x16be, L16be);
+    AOT_GOTO(0x1690, L1690);
+L1690:
+    AOT_BLOCK(0x1690, 8);
+    // 1690: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1692: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1694: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1698: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 169a: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 169e: mov r0, *400c
+    {
+        src = r[0];
+        b = RD16(0x400c);
+        WR16(b, src);
+    }
+    // 16a2: add $2, 400c
+    {
+        src = uint16_t(0x0002);
+        b = 0x400c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 16a8: br 16be
+    AOT_GOTO(0x16be, L16be);
+L16aa:
+    AOT_BLOCK(0x16aa, 5);
+    // 16aa: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 16ac: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 16ae: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 16b2: mov (r0), (sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 16b4: mov $4341, -(sp)
+    {
+        src = uint16_t(0x4341);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x16b8, L16b8);
+L16b8:
+    AOT_BLOCK(0x16b8, 1);
+    // 16b8: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x16bc);
+    }
+    AOT_GOTO(0x106a, L106a);
+L16bc:
+    AOT_BLOCK(0x16bc, 1);
+    // 16bc: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x16be, L16be);
+L16be:
+    AOT_BLOCK(0x16be, 2);
+    // 16be: inc r4
+    {
+        val = int(int16_t(r[4])) + 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 16c0: br 15ea
+    AOT_GOTO(0x15ea, L15ea);
+L16c2:
+    AOT_BLOCK(0x16c2, 2);
+    // 16c2: cmp $84cc, 400e
+    {
+        src = uint16_t(0x84cc);
+        b = 0x400e;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 16c8: bcs 16aa
+    if (C)
+        AOT_GOTO(0x16aa, L16aa);
+    AOT_GOTO(0x16ca, L16ca);
+L16ca:
+    AOT_BLOCK(0x16ca, 8);
+    // 16ca: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 16cc: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 16ce: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 16d2: mov (r0), r0
+    {
+        a = r[0];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 16d4: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 16d8: mov r0, *400e
+    {
+        src = r[0];
+        b = RD16(0x400e);
+        WR16(b, src);
+    }
+    // 16dc: add $2, 400e
+    {
+        src = uint16_t(0x0002);
+        b = 0x400e;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 16e2: br 16be
+    AOT_GOTO(0x16be, L16be);
+L16e4:
+    AOT_BLOCK(0x16e4, 2);
+    // 16e4: cmp $8, 400a
+    {
+        src = uint16_t(0x0008);
+        b = 0x400a;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 16ea: bge 16fc
+    if (!(N ^ V))
+        AOT_GOTO(0x16fc, L16fc);
+    AOT_GOTO(0x16ec, L16ec);
+L16ec:
+    AOT_BLOCK(0x16ec, 6);
+    // 16ec: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 16ee: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 16f0: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 16f4: mov (r0), (sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 16f6: mov $4362, -(sp)
+    {
+        src = uint16_t(0x4362);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 16fa: br 16b8
+    AOT_GOTO(0x16b8, L16b8);
+L16fc:
+    AOT_BLOCK(0x16fc, 10);
+    // 16fc: mov 400a, r0
+    {
+        a = 0x400a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1700: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1702: inc 400a
+    {
+        a = 0x400a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1706: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+    }
+    // 1708: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 170a: add 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 170e: mov (r1), r1
+    {
+        a = r[1];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1710: add $2, r1
+    {
+        src = uint16_t(0x0002);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1714: mov r1, -7ba0(r0)
+    {
+        src = r[1];
+        b = uint16_t(r[0] + -31648);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1718: br 16be
+    AOT_GOTO(0x16be, L16be);
+L171a:
+    AOT_BLOCK(0x171a, 2);
+    // 171a: tst 4006
+    {
+        a = 0x4006;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 171e: bne 1790
+    if (!Z)
+        AOT_GOTO(0x1790, L1790);
+    AOT_GOTO(0x1720, L1720);
+L1720:
+    AOT_BLOCK(0x1720, 6);
+    // 1720: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 1722: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1724: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1726: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 172a: mov (r0), -(sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 172c: jsr pc, *$2a5c
+    {
+        a = 0x2a5c;
+        r[6] -= 2;
+        WR16(r[6], 0x1730);
+    }
+    AOT_GOTO(0x2a5c, L2a5c);
+L1730:
+    AOT_BLOCK(0x1730, 3);
+    // 1730: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1732: mov r0, 4006
+    {
+        src = r[0];
+        b = 0x4006;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1736: bge 1754
+    if (!(N ^ V))
+        AOT_GOTO(0x1754, L1754);
+    AOT_GOTO(0x1738, L1738);
+L1738:
+    AOT_BLOCK(0x1738, 6);
+    // 1738: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 173a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 173c: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1740: mov (r0), (sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1742: mov $4391, -(sp)
+    {
+        src = uint16_t(0x4391);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1746: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x174a);
+    }
+    AOT_GOTO(0x106a, L106a);
+L174a:
+    AOT_BLOCK(0x174a, 3);
+    // 174a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 174c: mov $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1750: jsr pc, *$2712
+    {
+        a = 0x2712;
+        r[6] -= 2;
+        WR16(r[6], 0x1754);
+    }
+    AOT_GOTO(0x2712, L2712);
+L1754:
+    AOT_BLOCK(0x1754, 5);
+    // 1754: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 1756: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1758: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 175c: mov (r0), (sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 175e: jsr pc, *$14ea
+    {
+        a = 0x14ea;
+        r[6] -= 2;
+        WR16(r[6], 0x1762);
+    }
+    AOT_GOTO(0x14ea, L14ea);
+L1762:
+    AOT_BLOCK(0x1762, 12);
+    // 1762: mov 847a, r1
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1766: asl r1
+    {
+        src = r[1];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[1] = val;
+    }
+    // 1768: mov r0, -7bf0(r1)
+    {
+        src = r[0];
+        b = uint16_t(r[1] + -31728);
+        WR16(b, src);
+    }
+    // 176c: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1770: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1772: add $8424, r0
+    {
+        src = uint16_t(0x8424);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1776: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1778: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 177a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 177c: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1780: mov (r0), -(sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1782: jsr pc, 14c0
+    {
+        a = 0x14c0;
+        r[6] -= 2;
+        WR16(r[6], 0x1786);
+    }
+    AOT_GOTO(0x14c0, L14c0);
+L1786:
+    AOT_BLOCK(0x1786, 4);
+    // 1786: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1788: mov r0, *(sp)+
+    {
+        src = r[0];
+        b = RD16(r[6]);
+        r[6] += 2;
+        WR16(b, src);
+    }
+    // 178a: mov r0, 8460
+    {
+        src = r[0];
+        b = 0x8460;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 178e: br 16be
+    AOT_GOTO(0x16be, L16be);
+L1790:
+    AOT_BLOCK(0x1790, 2);
+    // 1790: cmp $4bc2, 4008
+    {
+        src = uint16_t(0x4bc2);
+        b = 0x4008;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1796: bne 17ea
+    if (!Z)
+        AOT_GOTO(0x17ea, L17ea);
+    AOT_GOTO(0x1798, L1798);
+L1798:
+    AOT_BLOCK(0x1798, 6);
+    // 1798: mov $43a3, (sp)
+    {
+        src = uint16_t(0x43a3);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 179c: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 179e: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 17a0: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 17a4: mov (r0), -(sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17a6: jsr pc, *$2000
+    {
+        a = 0x2000;
+        r[6] -= 2;
+        WR16(r[6], 0x17aa);
+    }
+    AOT_GOTO(0x2000, L2000);
+L17aa:
+    AOT_BLOCK(0x17aa, 3);
+    // 17aa: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 17ac: mov r0, 4008
+    {
+        src = r[0];
+        b = 0x4008;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17b0: bne 17d2
+    if (!Z)
+        AOT_GOTO(0x17d2, L17d2);
+    AOT_GOTO(0x17b2, L17b2);
+L17b2:
+    AOT_BLOCK(0x17b2, 6);
+    // 17b2: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 17b4: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 17b6: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 17ba: mov (r0), (sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17bc: mov $43a5, -(sp)
+    {
+        src = uint16_t(0x43a5);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17c0: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x17c4);
+    }
+    AOT_GOTO(0x106a, L106a);
+L17c4:
+    AOT_BLOCK(0x17c4, 3);
+    // 17c4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 17c6: mov $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17ca: jsr pc, *$2712
+    {
+        a = 0x2712;
+        r[6] -= 2;
+        WR16(r[6], 0x17ce);
+    }
+    AOT_GOTO(0x2712, L2712);
+L17ce:
+    AOT_BLOCK(0x17ce, 1);
+    // 17ce: jmp *$16be
+    {
+        a = 0x16be;
+    }
+    AOT_GOTO(0x16be, L16be);
+L17d2:
+    AOT_BLOCK(0x17d2, 2);
+    // 17d2: mov $4bc2, (sp)
+    {
+        src = uint16_t(0x4bc2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17d6: jsr pc, *$2576
+    {
+        a = 0x2576;
+        r[6] -= 2;
+        WR16(r[6], 0x17da);
+    }
+    AOT_GOTO(0x2576, L2576);
+L17da:
+    AOT_BLOCK(0x17da, 3);
+    // 17da: mov $8b2e, (sp)
+    {
+        src = uint16_t(0x8b2e);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17de: mov 4008, -(sp)
+    {
+        a = 0x4008;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17e2: jsr pc, *$20ce
+    {
+        a = 0x20ce;
+        r[6] -= 2;
+        WR16(r[6], 0x17e6);
+    }
+    AOT_GOTO(0x20ce, L20ce);
+L17e6:
+    AOT_BLOCK(0x17e6, 1);
+    // 17e6: jmp *$16bc
+    {
+        a = 0x16bc;
+    }
+    AOT_GOTO(0x16bc, L16bc);
+L17ea:
+    AOT_BLOCK(0x17ea, 6);
+    // 17ea: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 17ec: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 17ee: add 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 17f2: mov (r0), (sp)
+    {
+        a = r[0];
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 17f4: mov $43b5, -(sp)
+    {
+        src = uint16_t(0x43b5);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 17f8: jmp *$16b8
+    {
+        a = 0x16b8;
+    }
+    AOT_GOTO(0x16b8, L16b8);
+L17fc:
+    AOT_BLOCK(0x17fc, 14);
+    // 17fc: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1800: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1802: mov 4006, -7bc8(r0)
+    {
+        a = 0x4006;
+        src = RD16(a);
+        b = uint16_t(r[0] + -31688);
+        WR16(b, src);
+    }
+    // 1808: clr 84cc
+    {
+        a = 0x84cc;
+        WR16(a, 0);
+    }
+    // 180c: mov 400a, r0
+    {
+        a = 0x400a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1810: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1812: inc 400a
+    {
+        a = 0x400a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1816: mov $43c8, -7ba0(r0)
+    {
+        src = uint16_t(0x43c8);
+        b = uint16_t(r[0] + -31648);
+        WR16(b, src);
+    }
+    // 181c: mov 400a, r0
+    {
+        a = 0x400a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1820: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1822: inc 400a
+    {
+        a = 0x400a;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1826: clr -7ba0(r0)
+    {
+        a = uint16_t(r[0] + -31648);
+        WR16(a, 0);
+        C = false;
+    }
+    // 182a: mov $43d5, (sp)
+    {
+        src = uint16_t(0x43d5);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 182e: jsr pc, *$1040
+    {
+        a = 0x1040;
+        r[6] -= 2;
+        WR16(r[6], 0x1832);
+    }
+    AOT_GOTO(0x1040, L1040);
+L1832:
+    AOT_BLOCK(0x1832, 3);
+    // 1832: mov r0, 8b10
+    {
+        src = r[0];
+        b = 0x8b10;
+        WR16(b, src);
+    }
+    // 1836: mov $43dc, (sp)
+    {
+        src = uint16_t(0x43dc);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 183a: jsr pc, *$1040
+    {
+        a = 0x1040;
+        r[6] -= 2;
+        WR16(r[6], 0x183e);
+    }
+    AOT_GOTO(0x1040, L1040);
+L183e:
+    AOT_BLOCK(0x183e, 3);
+    // 183e: mov r0, 8b12
+    {
+        src = r[0];
+        b = 0x8b12;
+        WR16(b, src);
+    }
+    // 1842: mov $43e2, (sp)
+    {
+        src = uint16_t(0x43e2);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1846: jsr pc, *$1040
+    {
+        a = 0x1040;
+        r[6] -= 2;
+        WR16(r[6], 0x184a);
+    }
+    AOT_GOTO(0x1040, L1040);
+L184a:
+    AOT_BLOCK(0x184a, 3);
+    // 184a: mov r0, 8b14
+    {
+        src = r[0];
+        b = 0x8b14;
+        WR16(b, src);
+    }
+    // 184e: mov $43ea, (sp)
+    {
+        src = uint16_t(0x43ea);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1852: jsr pc, *$1040
+    {
+        a = 0x1040;
+        r[6] -= 2;
+        WR16(r[6], 0x1856);
+    }
+    AOT_GOTO(0x1040, L1040);
+L1856:
+    AOT_BLOCK(0x1856, 3);
+    // 1856: mov r0, 8b18
+    {
+        src = r[0];
+        b = 0x8b18;
+        WR16(b, src);
+    }
+    // 185a: mov $43ef, (sp)
+    {
+        src = uint16_t(0x43ef);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 185e: jsr pc, *$1040
+    {
+        a = 0x1040;
+        r[6] -= 2;
+        WR16(r[6], 0x1862);
+    }
+    AOT_GOTO(0x1040, L1040);
+L1862:
+    AOT_BLOCK(0x1862, 3);
+    // 1862: mov r0, 8b1a
+    {
+        src = r[0];
+        b = 0x8b1a;
+        WR16(b, src);
+    }
+    // 1866: mov $43f5, (sp)
+    {
+        src = uint16_t(0x43f5);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 186a: jsr pc, *$1040
+    {
+        a = 0x1040;
+        r[6] -= 2;
+        WR16(r[6], 0x186e);
+    }
+    AOT_GOTO(0x1040, L1040);
+L186e:
+    AOT_BLOCK(0x186e, 3);
+    // 186e: mov r0, 8b1c
+    {
+        src = r[0];
+        b = 0x8b1c;
+        WR16(b, src);
+    }
+    // 1872: mov $43fb, (sp)
+    {
+        src = uint16_t(0x43fb);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1876: jsr pc, *$1040
+    {
+        a = 0x1040;
+        r[6] -= 2;
+        WR16(r[6], 0x187a);
+    }
+    AOT_GOTO(0x1040, L1040);
+L187a:
+    AOT_BLOCK(0x187a, 3);
+    // 187a: mov r0, 8b1e
+    {
+        src = r[0];
+        b = 0x8b1e;
+        WR16(b, src);
+    }
+    // 187e: mov $4402, (sp)
+    {
+        src = uint16_t(0x4402);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1882: jsr pc, *$1040
+    {
+        a = 0x1040;
+        r[6] -= 2;
+        WR16(r[6], 0x1886);
+    }
+    AOT_GOTO(0x1040, L1040);
+L1886:
+    AOT_BLOCK(0x1886, 3);
+    // 1886: mov r0, 8b16
+    {
+        src = r[0];
+        b = 0x8b16;
+        WR16(b, src);
+    }
+    // 188a: mov $4405, (sp)
+    {
+        src = uint16_t(0x4405);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 188e: jsr pc, *$1040
+    {
+        a = 0x1040;
+        r[6] -= 2;
+        WR16(r[6], 0x1892);
+    }
+    AOT_GOTO(0x1040, L1040);
+L1892:
+    AOT_BLOCK(0x1892, 3);
+    // 1892: mov r0, 8b24
+    {
+        src = r[0];
+        b = 0x8b24;
+        WR16(b, src);
+    }
+    // 1896: mov $10b, r4
+    {
+        src = uint16_t(0x010b);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 189a: br 18a0
+    AOT_GOTO(0x18a0, L18a0);
+L189c:
+    AOT_BLOCK(0x189c, 1);
+    // 189c: clrb 4c98(r4)
+    {
+        a = uint16_t(r[4] + 19608);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x18a0, L18a0);
+L18a0:
+    AOT_BLOCK(0x18a0, 2);
+    // 18a0: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 18a2: bge 189c
+    if (!(N ^ V))
+        AOT_GOTO(0x189c, L189c);
+    AOT_GOTO(0x18a4, L18a4);
+L18a4:
+    AOT_BLOCK(0x18a4, 2);
+    // 18a4: mov $440a, (sp)
+    {
+        src = uint16_t(0x440a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18a8: jsr pc, *$0fe2
+    {
+        a = 0x0fe2;
+        r[6] -= 2;
+        WR16(r[6], 0x18ac);
+    }
+    AOT_GOTO(0x0fe2, L0fe2);
+L18ac:
+    AOT_BLOCK(0x18ac, 3);
+    // 18ac: mov r0, 8b20
+    {
+        src = r[0];
+        b = 0x8b20;
+        WR16(b, src);
+    }
+    // 18b0: mov $440f, (sp)
+    {
+        src = uint16_t(0x440f);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18b4: jsr pc, *$0fe2
+    {
+        a = 0x0fe2;
+        r[6] -= 2;
+        WR16(r[6], 0x18b8);
+    }
+    AOT_GOTO(0x0fe2, L0fe2);
+L18b8:
+    AOT_BLOCK(0x18b8, 3);
+    // 18b8: mov r0, 8b22
+    {
+        src = r[0];
+        b = 0x8b22;
+        WR16(b, src);
+    }
+    // 18bc: mov $4415, (sp)
+    {
+        src = uint16_t(0x4415);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18c0: jsr pc, *$0fe2
+    {
+        a = 0x0fe2;
+        r[6] -= 2;
+        WR16(r[6], 0x18c4);
+    }
+    AOT_GOTO(0x0fe2, L0fe2);
+L18c4:
+    AOT_BLOCK(0x18c4, 3);
+    // 18c4: mov r0, 8b26
+    {
+        src = r[0];
+        b = 0x8b26;
+        WR16(b, src);
+    }
+    // 18c8: mov $441e, (sp)
+    {
+        src = uint16_t(0x441e);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18cc: jsr pc, *$0fe2
+    {
+        a = 0x0fe2;
+        r[6] -= 2;
+        WR16(r[6], 0x18d0);
+    }
+    AOT_GOTO(0x0fe2, L0fe2);
+L18d0:
+    AOT_BLOCK(0x18d0, 12);
+    // 18d0: mov r0, 8b28
+    {
+        src = r[0];
+        b = 0x8b28;
+        WR16(b, src);
+    }
+    // 18d4: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 18d8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 18da: mov -7bf0(r0), -8(r5)
+    {
+        a = uint16_t(r[0] + -31728);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 18e0: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 18e4: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 18e6: mov $4427, -7bf0(r0)
+    {
+        src = uint16_t(0x4427);
+        b = uint16_t(r[0] + -31728);
+        WR16(b, src);
+    }
+    // 18ec: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 18f0: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 18f2: mov $1, -7bb4(r0)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[0] + -31668);
+        WR16(b, src);
+    }
+    // 18f8: mov $847c, -a(r5)
+    {
+        src = uint16_t(0x847c);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 18fe: br 190e
+    AOT_GOTO(0x190e, L190e);
+L1900:
+    AOT_BLOCK(0x1900, 3);
+    // 1900: mov *-a(r5), (sp)
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1904: add $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 190a: jsr pc, *$0fe2
+    {
+        a = 0x0fe2;
+        r[6] -= 2;
+        WR16(r[6], 0x190e);
+    }
+    AOT_GOTO(0x0fe2, L0fe2);
+L190e:
+    AOT_BLOCK(0x190e, 2);
+    // 190e: cmp 400c, -a(r5)
+    {
+        a = 0x400c;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1914: bhi 1900
+    if (!(C | Z))
+        AOT_GOTO(0x1900, L1900);
+    AOT_GOTO(0x1916, L1916);
+L1916:
+    AOT_BLOCK(0x1916, 2);
+    // 1916: mov $84a4, -a(r5)
+    {
+        src = uint16_t(0x84a4);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 191c: br 1946
+    AOT_GOTO(0x1946, L1946);
+L191e:
+    AOT_BLOCK(0x191e, 3);
+    // 191e: mov $3d, (sp)
+    {
+        src = uint16_t(0x003d);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1922: mov *-a(r5), -(sp)
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1926: jsr pc, *$1508
+    {
+        a = 0x1508;
+        r[6] -= 2;
+        WR16(r[6], 0x192a);
+    }
+    AOT_GOTO(0x1508, L1508);
+L192a:
+    AOT_BLOCK(0x192a, 3);
+    // 192a: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 192c: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 192e: beq 1932
+    if (Z)
+        AOT_GOTO(0x1932, L1932);
+    AOT_GOTO(0x1930, L1930);
+L1930:
+    AOT_BLOCK(0x1930, 1);
+    // 1930: clrb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1932, L1932);
+L1932:
+    AOT_BLOCK(0x1932, 4);
+    // 1932: mov $fe, (sp)
+    {
+        src = uint16_t(0x00fe);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1936: mov *-a(r5), -(sp)
+    {
+        a = RD16(r[5] + -10);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 193a: add $2, -a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1940: jsr pc, *$111c
+    {
+        a = 0x111c;
+        r[6] -= 2;
+        WR16(r[6], 0x1944);
+    }
+    AOT_GOTO(0x111c, L111c);
+L1944:
+    AOT_BLOCK(0x1944, 1);
+    // 1944: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1946, L1946);
+L1946:
+    AOT_BLOCK(0x1946, 2);
+    // 1946: cmp 400e, -a(r5)
+    {
+        a = 0x400e;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 194c: bhi 191e
+    if (!(C | Z))
+        AOT_GOTO(0x191e, L191e);
+    AOT_GOTO(0x194e, L194e);
+L194e:
+    AOT_BLOCK(0x194e, 13);
+    // 194e: mov 847a, r0
+    {
+        a = 0x847a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1952: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1954: mov -8(r5), -7bf0(r0)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = uint16_t(r[0] + -31728);
+        WR16(b, src);
+    }
+    // 195a: mov $50ae, 4c8a
+    {
+        src = uint16_t(0x50ae);
+        b = 0x4c8a;
+        WR16(b, src);
+    }
+    // 1960: mov 4c8a, r0
+    {
+        a = 0x4c8a;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1964: add $200, r0
+    {
+        src = uint16_t(0x0200);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1968: mov r0, 4c8c
+    {
+        src = r[0];
+        b = 0x4c8c;
+        WR16(b, src);
+    }
+    // 196c: add $200, r0
+    {
+        src = uint16_t(0x0200);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1970: mov r0, 4c8e
+    {
+        src = r[0];
+        b = 0x4c8e;
+        WR16(b, src);
+    }
+    // 1974: clr 8b2a
+    {
+        a = 0x8b2a;
+        WR16(a, 0);
+    }
+    // 1978: clr 8b2c
+    {
+        a = 0x8b2c;
+        WR16(a, 0);
+        C = false;
+    }
+    // 197c: mov $1, 844c
+    {
+        src = uint16_t(0x0001);
+        b = 0x844c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1982: jsr pc, 003c
+    {
+        a = 0x003c;
+        r[6] -= 2;
+        WR16(r[6], 0x1986);
+    }
+    AOT_GOTO(0x003c, L003c);
+L1986:
+    AOT_BLOCK(0x1986, 5);
+    // 1986: mov 4c8e, r0
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 198a: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 198e: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 1992: mov 4c8e, (sp)
+    {
+        a = 0x4c8e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1996: jsr pc, *$0da4
+    {
+        a = 0x0da4;
+        r[6] -= 2;
+        WR16(r[6], 0x199a);
+    }
+    AOT_GOTO(0x0da4, L0da4);
+L199a:
+    AOT_BLOCK(0x199a, 3);
+    // 199a: mov 84cc, r0
+    {
+        a = 0x84cc;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 199e: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L19a2:
+    AOT_BLOCK(0x19a2, 3);
+    // 19a2: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x19a6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 19a6: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x19aa, L19aa);
+L19aa:
+    AOT_BLOCK(0x19aa, 2);
+    // 19aa: mov 4c94, (sp)
+    {
+        a = 0x4c94;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19ae: jsr pc, *$06ba
+    {
+        a = 0x06ba;
+        r[6] -= 2;
+        WR16(r[6], 0x19b2);
+    }
+    AOT_GOTO(0x06ba, L06ba);
+L19b2:
+    AOT_BLOCK(0x19b2, 3);
+    // 19b2: mov r0, 4c94
+    {
+        src = r[0];
+        b = 0x4c94;
+        WR16(b, src);
+    }
+    // 19b6: cmpb $a, *4c92
+    {
+        src = uint8_t(0x0a);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 19bc: bne 1a02
+    if (!Z)
+        AOT_GOTO(0x1a02, L1a02);
+    AOT_GOTO(0x19be, L19be);
+L19be:
+    AOT_BLOCK(0x19be, 2);
+    // 19be: mov $102, r0
+    {
+        src = uint16_t(0x0102);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19c2: br 19fe
+    AOT_GOTO(0x19fe, L19fe);
+L19c4:
+    AOT_BLOCK(0x19c4, 3);
+    // 19c4: mov 4c92, (sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 19c8: mov (r2), -(sp)
+    {
+        a = r[2];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 19ca: jsr pc, *$299c
+    {
+        a = 0x299c;
+        r[6] -= 2;
+        WR16(r[6], 0x19ce);
+    }
+    AOT_GOTO(0x299c, L299c);
+L19ce:
+    AOT_BLOCK(0x19ce, 3);
+    // 19ce: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 19d0: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 19d2: bne 1a0e
+    if (!Z)
+        AOT_GOTO(0x1a0e, L1a0e);
+    AOT_GOTO(0x19d4, L19d4);
+L19d4:
+    AOT_BLOCK(0x19d4, 7);
+    // 19d4: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 19d6: sub $4436, r1
+    {
+        src = uint16_t(0x4436);
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        C = dst < src;
+    }
+    // 19da: bic r0, r0
+    {
+        src = r[0];
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 19dc: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+    }
+    // 19de: div $2, r0
+    {
+        src = int16_t(uint16_t(0x0002));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 19e2: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 19e4: mov 4446(r0), -8(r5)
+    {
+        a = uint16_t(r[0] + 17478);
+        src = RD16(a);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x19ea, L19ea);
+L19ea:
+    AOT_BLOCK(0x19ea, 5);
+    // 19ea: movb r4, *4c94
+    {
+        src = uint8_t(r[4]);
+        b = RD16(0x4c94);
+        WR8(b, src);
+    }
+    // 19ee: mov 4c94, r0
+    {
+        a = 0x4c94;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 19f2: mov r0, 4c92
+    {
+        src = r[0];
+        b = 0x4c92;
+        WR16(b, src);
+    }
+    // 19f6: mov r0, 4c90
+    {
+        src = r[0];
+        b = 0x4c90;
+        WR16(b, src);
+    }
+    // 19fa: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x19fe, L19fe);
+L19fe:
+    AOT_BLOCK(0x19fe, 2);
+    // 19fe: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1a02:
+    AOT_BLOCK(0x1a02, 3);
+    // 1a02: movb *4c94, r4
+    {
+        a = RD16(0x4c94);
+        src = RD8(a);
+        r[4] = int16_t(int8_t(src));
+    }
+    // 1a06: clrb *4c94
+    {
+        a = RD16(0x4c94);
+        WR8(a, 0);
+        C = false;
+    }
+    // 1a0a: mov $4446, r2
+    {
+        src = uint16_t(0x4446);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a0e, L1a0e);
+L1a0e:
+    AOT_BLOCK(0x1a0e, 3);
+    // 1a0e: sub $2, r2
+    {
+        src = uint16_t(0x0002);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+    }
+    // 1a12: cmp $4436, r2
+    {
+        src = uint16_t(0x4436);
+        dst = r[2];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1a16: blos 19c4
+    if (C | Z)
+        AOT_GOTO(0x19c4, L19c4);
+    AOT_GOTO(0x1a18, L1a18);
+L1a18:
+    AOT_BLOCK(0x1a18, 1);
+    // 1a18: mov $4a8b, r3
+    {
+        src = uint16_t(0x4a8b);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a1c, L1a1c);
+L1a1c:
+    AOT_BLOCK(0x1a1c, 2);
+    // 1a1c: tstb (r3)
+    {
+        a = r[3];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1a1e: beq 1a2e
+    if (Z)
+        AOT_GOTO(0x1a2e, L1a2e);
+    AOT_GOTO(0x1a20, L1a20);
+L1a20:
+    AOT_BLOCK(0x1a20, 2);
+    // 1a20: cmpb *4c92, (r3)+
+    {
+        a = RD16(0x4c92);
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a24: bne 1a1c
+    if (!Z)
+        AOT_GOTO(0x1a1c, L1a1c);
+    AOT_GOTO(0x1a26, L1a26);
+L1a26:
+    AOT_BLOCK(0x1a26, 3);
+    // 1a26: movb -(r3), r0
+    {
+        r[3] -= 1;
+        a = r[3];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1a28: mov r0, -8(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a2c: br 19ea
+    AOT_GOTO(0x19ea, L19ea);
+L1a2e:
+    AOT_BLOCK(0x1a2e, 2);
+    // 1a2e: cmpb $39, *4c92
+    {
+        src = uint8_t(0x39);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a34: blt 1ae6
+    if (N ^ V)
+        AOT_GOTO(0x1ae6, L1ae6);
+    AOT_GOTO(0x1a36, L1a36);
+L1a36:
+    AOT_BLOCK(0x1a36, 2);
+    // 1a36: cmpb $30, *4c92
+    {
+        src = uint8_t(0x30);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a3c: bgt 1ae6
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1ae6, L1ae6);
+    AOT_GOTO(0x1a3e, L1a3e);
+L1a3e:
+    AOT_BLOCK(0x1a3e, 2);
+    // 1a3e: cmpb $30, *4c92
+    {
+        src = uint8_t(0x30);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a44: bne 1a74
+    if (!Z)
+        AOT_GOTO(0x1a74, L1a74);
+    AOT_GOTO(0x1a46, L1a46);
+L1a46:
+    AOT_BLOCK(0x1a46, 3);
+    // 1a46: mov 4c92, r0
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1a4a: cmpb $78, 1(r0)
+    {
+        src = uint8_t(0x78);
+        b = uint16_t(r[0] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a50: beq 1a5a
+    if (Z)
+        AOT_GOTO(0x1a5a, L1a5a);
+    AOT_GOTO(0x1a52, L1a52);
+L1a52:
+    AOT_BLOCK(0x1a52, 2);
+    // 1a52: cmpb $58, 1(r0)
+    {
+        src = uint8_t(0x58);
+        b = uint16_t(r[0] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1a58: bne 1a68
+    if (!Z)
+        AOT_GOTO(0x1a68, L1a68);
+    AOT_GOTO(0x1a5a, L1a5a);
+L1a5a:
+    AOT_BLOCK(0x1a5a, 4);
+    // 1a5a: mov $10, (sp)
+    {
+        src = uint16_t(0x0010);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a5e: mov 4c92, -(sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a62: add $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1a66: br 1a7c
+    AOT_GOTO(0x1a7c, L1a7c);
+L1a68:
+    AOT_BLOCK(0x1a68, 4);
+    // 1a68: mov $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a6c: mov 4c92, -(sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a70: inc (sp)
+    {
+        a = r[6];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 1a72: br 1a7c
+    AOT_GOTO(0x1a7c, L1a7c);
+L1a74:
+    AOT_BLOCK(0x1a74, 2);
+    // 1a74: mov $a, (sp)
+    {
+        src = uint16_t(0x000a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a78: mov 4c92, -(sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1a7c, L1a7c);
+L1a7c:
+    AOT_BLOCK(0x1a7c, 1);
+    // 1a7c: jsr pc, *$1bb2
+    {
+        a = 0x1bb2;
+        r[6] -= 2;
+        WR16(r[6], 0x1a80);
+    }
+    AOT_GOTO(0x1bb2, L1bb2);
+L1a80:
+    AOT_BLOCK(0x1a80, 2);
+    // 1a80: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1a82: br 1ada
+    AOT_GOTO(0x1ada, L1ada);
+L1a84:
+    AOT_BLOCK(0x1a84, 3);
+    // 1a84: mov $4a9d, (sp)
+    {
+        src = uint16_t(0x4a9d);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1a88: mov 4c92, -(sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1a8c: jsr pc, *$299c
+    {
+        a = 0x299c;
+        r[6] -= 2;
+        WR16(r[6], 0x1a90);
+    }
+    AOT_GOTO(0x299c, L299c);
+L1a90:
+    AOT_BLOCK(0x1a90, 3);
+    // 1a90: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1a92: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1a94: bne 1aa8
+    if (!Z)
+        AOT_GOTO(0x1aa8, L1aa8);
+    AOT_GOTO(0x1a96, L1a96);
+L1a96:
+    AOT_BLOCK(0x1a96, 4);
+    // 1a96: mov $1, 4434
+    {
+        src = uint16_t(0x0001);
+        b = 0x4434;
+        WR16(b, src);
+    }
+    // 1a9c: inc 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1aa0: mov $103, -8(r5)
+    {
+        src = uint16_t(0x0103);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1aa6: br 19ea
+    AOT_GOTO(0x19ea, L19ea);
+L1aa8:
+    AOT_BLOCK(0x1aa8, 3);
+    // 1aa8: mov $ffff, (sp)
+    {
+        src = uint16_t(0xffff);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1aac: mov 4c92, -(sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ab0: jsr pc, *$111c
+    {
+        a = 0x111c;
+        r[6] -= 2;
+        WR16(r[6], 0x1ab4);
+    }
+    AOT_GOTO(0x111c, L111c);
+L1ab4:
+    AOT_BLOCK(0x1ab4, 4);
+    // 1ab4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1ab6: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 1aba: tst 4434
+    {
+        a = 0x4434;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1abe: beq 1ac8
+    if (Z)
+        AOT_GOTO(0x1ac8, L1ac8);
+    AOT_GOTO(0x1ac0, L1ac0);
+L1ac0:
+    AOT_BLOCK(0x1ac0, 2);
+    // 1ac0: clr 4434
+    {
+        a = 0x4434;
+        WR16(a, 0);
+        C = false;
+    }
+    // 1ac4: dec 8b2c
+    {
+        a = 0x8b2c;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x1ac8, L1ac8);
+L1ac8:
+    AOT_BLOCK(0x1ac8, 3);
+    // 1ac8: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1acc: tst 2(r0)
+    {
+        a = uint16_t(r[0] + 2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1ad0: bne 1ad6
+    if (!Z)
+        AOT_GOTO(0x1ad6, L1ad6);
+    AOT_GOTO(0x1ad2, L1ad2);
+L1ad2:
+    AOT_BLOCK(0x1ad2, 2);
+    // 1ad2: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1ad4: br 1ada
+    AOT_GOTO(0x1ada, L1ada);
+L1ad6:
+    AOT_BLOCK(0x1ad6, 1);
+    // 1ad6: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1ada, L1ada);
+L1ada:
+    AOT_BLOCK(0x1ada, 3);
+    // 1ada: mov r0, 8d2e
+    {
+        src = r[0];
+        b = 0x8d2e;
+        WR16(b, src);
+    }
+    // 1ade: mov $101, -8(r5)
+    {
+        src = uint16_t(0x0101);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ae4: br 19ea
+    AOT_GOTO(0x19ea, L19ea);
+L1ae6:
+    AOT_BLOCK(0x1ae6, 3);
+    // 1ae6: movb *4c92, r0
+    {
+        a = RD16(0x4c92);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1aea: bitb $1, 4f24(r0)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[0] + 20260);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 1af0: bne 1a84
+    if (!Z)
+        AOT_GOTO(0x1a84, L1a84);
+    AOT_GOTO(0x1af2, L1af2);
+L1af2:
+    AOT_BLOCK(0x1af2, 2);
+    // 1af2: cmpb $27, *4c92
+    {
+        src = uint8_t(0x27);
+        b = RD16(0x4c92);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1af8: bne 1b80
+    if (!Z)
+        AOT_GOTO(0x1b80, L1b80);
+    AOT_GOTO(0x1afa, L1afa);
+L1afa:
+    AOT_BLOCK(0x1afa, 4);
+    // 1afa: mov $101, -8(r5)
+    {
+        src = uint16_t(0x0101);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 1b00: mov 4c92, r0
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1b04: cmpb $5c, 1(r0)
+    {
+        src = uint8_t(0x5c);
+        b = uint16_t(r[0] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1b0a: bne 1b76
+    if (!Z)
+        AOT_GOTO(0x1b76, L1b76);
+    AOT_GOTO(0x1b0c, L1b0c);
+L1b0c:
+    AOT_BLOCK(0x1b0c, 3);
+    // 1b0c: mov 4c94, r0
+    {
+        a = 0x4c94;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1b10: cmpb $27, -1(r0)
+    {
+        src = uint8_t(0x27);
+        b = uint16_t(r[0] + -1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1b16: bne 1b1c
+    if (!Z)
+        AOT_GOTO(0x1b1c, L1b1c);
+    AOT_GOTO(0x1b18, L1b18);
+L1b18:
+    AOT_BLOCK(0x1b18, 1);
+    // 1b18: clrb -1(r0)
+    {
+        a = uint16_t(r[0] + -1);
+        WR8(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1b1c, L1b1c);
+L1b1c:
+    AOT_BLOCK(0x1b1c, 2);
+    // 1b1c: mov 4456, r3
+    {
+        a = 0x4456;
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b20: br 1b24
+    AOT_GOTO(0x1b24, L1b24);
+L1b22:
+    AOT_BLOCK(0x1b22, 1);
+    // 1b22: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1b24, L1b24);
+L1b24:
+    AOT_BLOCK(0x1b24, 2);
+    // 1b24: tstb (r3)
+    {
+        a = r[3];
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1b26: beq 1b60
+    if (Z)
+        AOT_GOTO(0x1b60, L1b60);
+    AOT_GOTO(0x1b28, L1b28);
+L1b28:
+    AOT_BLOCK(0x1b28, 5);
+    // 1b28: movb (r3)+, r0
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1b2a: mov 4c92, r1
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1b2e: movb 2(r1), r1
+    {
+        a = uint16_t(r[1] + 2);
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 1b32: cmp r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1b34: bne 1b22
+    if (!Z)
+        AOT_GOTO(0x1b22, L1b22);
+    AOT_GOTO(0x1b36, L1b36);
+L1b36:
+    AOT_BLOCK(0x1b36, 2);
+    // 1b36: movb (r3), r0
+    {
+        a = r[3];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1b38: br 1b58
+    AOT_GOTO(0x1b58, L1b58);
+L1b3a:
+    AOT_BLOCK(0x1b3a, 2);
+    // 1b3a: cmpb $30, 2(r0)
+    {
+        src = uint8_t(0x30);
+        b = uint16_t(r[0] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1b40: bgt 1b6c
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1b6c, L1b6c);
+    AOT_GOTO(0x1b42, L1b42);
+L1b42:
+    AOT_BLOCK(0x1b42, 4);
+    // 1b42: mov $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b46: mov 4c92, -(sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b4a: add $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1b4e: jsr pc, *$1bb2
+    {
+        a = 0x1bb2;
+        r[6] -= 2;
+        WR16(r[6], 0x1b52);
+    }
+    AOT_GOTO(0x1bb2, L1bb2);
+L1b52:
+    AOT_BLOCK(0x1b52, 2);
+    // 1b52: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 1b54: movb r0, -c(r5)
+    {
+        src = uint8_t(r[0]);
+        b = uint16_t(r[5] + -12);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1b58, L1b58);
+L1b58:
+    AOT_BLOCK(0x1b58, 2);
+    // 1b58: mov r0, 8d2e
+    {
+        src = r[0];
+        b = 0x8d2e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b5c: jmp *$19ea
+    {
+        a = 0x19ea;
+    }
+    AOT_GOTO(0x19ea, L19ea);
+L1b60:
+    AOT_BLOCK(0x1b60, 3);
+    // 1b60: mov 4c92, r0
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1b64: cmpb $39, 2(r0)
+    {
+        src = uint8_t(0x39);
+        b = uint16_t(r[0] + 2);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 1b6a: bge 1b3a
+    if (!(N ^ V))
+        AOT_GOTO(0x1b3a, L1b3a);
+    AOT_GOTO(0x1b6c, L1b6c);
+L1b6c:
+    AOT_BLOCK(0x1b6c, 3);
+    // 1b6c: mov 4c92, r0
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1b70: movb 2(r0), r0
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1b74: br 1b58
+    AOT_GOTO(0x1b58, L1b58);
+L1b76:
+    AOT_BLOCK(0x1b76, 3);
+    // 1b76: mov 4c92, r0
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1b7a: movb 1(r0), r0
+    {
+        a = uint16_t(r[0] + 1);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1b7e: br 1b58
+    AOT_GOTO(0x1b58, L1b58);
+L1b80:
+    AOT_BLOCK(0x1b80, 3);
+    // 1b80: mov 4c92, (sp)
+    {
+        a = 0x4c92;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1b84: mov $4aa5, -(sp)
+    {
+        src = uint16_t(0x4aa5);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1b88: jsr pc, *$299c
+    {
+        a = 0x299c;
+        r[6] -= 2;
+        WR16(r[6], 0x1b8c);
+    }
+    AOT_GOTO(0x299c, L299c);
+L1b8c:
+    AOT_BLOCK(0x1b8c, 3);
+    // 1b8c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 1b8e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1b90: bne 1b9a
+    if (!Z)
+        AOT_GOTO(0x1b9a, L1b9a);
+    AOT_GOTO(0x1b92, L1b92);
+L1b92:
+    AOT_BLOCK(0x1b92, 2);
+    // 1b92: movb r4, *4c94
+    {
+        src = uint8_t(r[4]);
+        b = RD16(0x4c94);
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 1b96: jmp *$19aa
+    {
+        a = 0x19aa;
+    }
+    AOT_GOTO(0x19aa, L19aa);
+L1b9a:
+    AOT_BLOCK(0x1b9a, 5);
+    // 1b9a: movb r4, *4c94
+    {
+        src = uint8_t(r[4]);
+        b = RD16(0x4c94);
+        WR8(b, src);
+    }
+    // 1b9e: movb *4c92, r0
+    {
+        a = RD16(0x4c92);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1ba2: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1ba4: mov $4aa8, -(sp)
+    {
+        src = uint16_t(0x4aa8);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ba8: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x1bac);
+    }
+    AOT_GOTO(0x106a, L106a);
+L1bac:
+    AOT_BLOCK(0x1bac, 2);
+    // 1bac: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1bae: jmp *$19aa
+    {
+        a = 0x19aa;
+    }
+    AOT_GOTO(0x19aa, L19aa);
+L1bb2:
+    AOT_BLOCK(0x1bb2, 5);
+    // 1bb2: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1bb6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 1bb6: sub $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1bba: clr -8(r5)
+    {
+        a = uint16_t(r[5] + -8);
+        WR16(a, 0);
+        C = false;
+    }
+    // 1bbe: mov 4(r5), -e(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1bc4, L1bc4);
+L1bc4:
+    AOT_BLOCK(0x1bc4, 4);
+    // 1bc4: movb *-e(r5), r0
+    {
+        a = RD16(r[5] + -14);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 1bc8: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 1bcc: mov r0, -a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bd0: beq 1c5a
+    if (Z)
+        AOT_GOTO(0x1c5a, L1c5a);
+    AOT_GOTO(0x1bd2, L1bd2);
+L1bd2:
+    AOT_BLOCK(0x1bd2, 3);
+    // 1bd2: sub $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1bd6: cmp r0, $36
+    {
+        src = r[0];
+        dst = uint16_t(0x0036);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1bda: bhi 1c2a
+    if (!(C | Z))
+        AOT_GOTO(0x1c2a, L1c2a);
+    AOT_GOTO(0x1bdc, L1bdc);
+L1bdc:
+    AOT_BLOCK(0x1bdc, 2);
+    // 1bdc: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 1bde: jmp *4458(r0)
+    {
+        a = RD16(r[0] + 17496);
+    }
+    AOT_JUMP(a);
+L1be2:
+    AOT_BLOCK(0x1be2, 4);
+    // 1be2: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1be6: add $ffd0, r0
+    {
+        src = uint16_t(0xffd0);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1bea: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1bee: br 1c54
+    AOT_GOTO(0x1c54, L1c54);
+L1bf0:
+    AOT_BLOCK(0x1bf0, 5);
+    // 1bf0: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1bf4: mul 6(r5), r1
+    {
+        a = uint16_t(r[5] + 6);
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 1bf8: add -c(r5), r1
+    {
+        a = uint16_t(r[5] + -12);
+        src = RD16(a);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1bfc: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c00: br 1bc4
+    AOT_GOTO(0x1bc4, L1bc4);
+L1c02:
+    AOT_BLOCK(0x1c02, 5);
+    // 1c02: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1c06: add $ff9f, r0
+    {
+        src = uint16_t(0xff9f);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1c0a: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 1c0e: cmp $a, 6(r5)
+    {
+        src = uint16_t(0x000a);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c14: blt 1c54
+    if (N ^ V)
+        AOT_GOTO(0x1c54, L1c54);
+    AOT_GOTO(0x1c16, L1c16);
+L1c16:
+    AOT_BLOCK(0x1c16, 5);
+    // 1c16: mov -a(r5), r0
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1c1a: add $ffbf, r0
+    {
+        src = uint16_t(0xffbf);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1c1e: mov r0, -c(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 1c22: cmp $a, 6(r5)
+    {
+        src = uint16_t(0x000a);
+        b = uint16_t(r[5] + 6);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c28: blt 1c54
+    if (N ^ V)
+        AOT_GOTO(0x1c54, L1c54);
+    AOT_GOTO(0x1c2a, L1c2a);
+L1c2a:
+    AOT_BLOCK(0x1c2a, 3);
+    // 1c2a: mov $ffff, -c(r5)
+    {
+        src = uint16_t(0xffff);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 1c30: cmp $6c, -a(r5)
+    {
+        src = uint16_t(0x006c);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c36: beq 1c40
+    if (Z)
+        AOT_GOTO(0x1c40, L1c40);
+    AOT_GOTO(0x1c38, L1c38);
+L1c38:
+    AOT_BLOCK(0x1c38, 2);
+    // 1c38: cmp $4c, -a(r5)
+    {
+        src = uint16_t(0x004c);
+        b = uint16_t(r[5] + -10);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1c3e: bne 1c46
+    if (!Z)
+        AOT_GOTO(0x1c46, L1c46);
+    AOT_GOTO(0x1c40, L1c40);
+L1c40:
+    AOT_BLOCK(0x1c40, 2);
+    // 1c40: tstb *-e(r5)
+    {
+        a = RD16(r[5] + -14);
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1c44: beq 1c54
+    if (Z)
+        AOT_GOTO(0x1c54, L1c54);
+    AOT_GOTO(0x1c46, L1c46);
+L1c46:
+    AOT_BLOCK(0x1c46, 3);
+    // 1c46: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c4a: mov $4ad0, -(sp)
+    {
+        src = uint16_t(0x4ad0);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c4e: jsr pc, *$106a
+    {
+        a = 0x106a;
+        r[6] -= 2;
+        WR16(r[6], 0x1c52);
+    }
+    AOT_GOTO(0x106a, L106a);
+L1c52:
+    AOT_BLOCK(0x1c52, 1);
+    // 1c52: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1c54, L1c54);
+L1c54:
+    AOT_BLOCK(0x1c54, 2);
+    // 1c54: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1c58: bge 1bf0
+    if (!(N ^ V))
+        AOT_GOTO(0x1bf0, L1bf0);
+    AOT_GOTO(0x1c5a, L1c5a);
+L1c5a:
+    AOT_BLOCK(0x1c5a, 3);
+    // 1c5a: mov -8(r5), r0
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1c5e: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1c62:
+    AOT_BLOCK(0x1c62, 10);
+    // 1c62: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x1c66;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 1c66: sub $136, sp
+    {
+        src = uint16_t(0x0136);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 1c6a: clr r3
+    {
+        r[3] = 0;
+    }
+    // 1c6c: mov $ffff, 4a1e
+    {
+        src = uint16_t(0xffff);
+        b = 0x4a1e;
+        WR16(b, src);
+    }
+    // 1c72: clr 4a20
+    {
+        a = 0x4a20;
+        WR16(a, 0);
+    }
+    // 1c76: clr 4a22
+    {
+        a = 0x4a22;
+        WR16(a, 0);
+    }
+    // 1c7a: mov r5, r2
+    {
+        src = r[5];
+        r[2] = src;
+    }
+    // 1c7c: add $fecc, r2
+    {
+        src = uint16_t(0xfecc);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1c80: mov $8d30, -13a(r5)
+    {
+        src = uint16_t(0x8d30);
+        b = uint16_t(r[5] + -314);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1c86, L1c86);
+L1c86:
+    AOT_BLOCK(0x1c86, 2);
+    // 1c86: tst 4a1c
+    {
+        a = 0x4a1c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1c8a: beq 1c9c
+    if (Z)
+        AOT_GOTO(0x1c9c, L1c9c);
+    AOT_GOTO(0x1c8c, L1c8c);
+L1c8c:
+    AOT_BLOCK(0x1c8c, 4);
+    // 1c8c: mov 4a1e, (sp)
+    {
+        a = 0x4a1e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c90: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1c92: mov $4ae2, -(sp)
+    {
+        src = uint16_t(0x4ae2);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1c96: jsr pc, *$204c
+    {
+        a = 0x204c;
+        r[6] -= 2;
+        WR16(r[6], 0x1c9a);
+    }
+    AOT_GOTO(0x204c, L204c);
+L1c9a:
+    AOT_BLOCK(0x1c9a, 1);
+    // 1c9a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1c9c, L1c9c);
+L1c9c:
+    AOT_BLOCK(0x1c9c, 5);
+    // 1c9c: add $2, r2
+    {
+        src = uint16_t(0x0002);
+        dst = r[2];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[2] = val16;
+    }
+    // 1ca0: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 1ca2: add $fffa, r0
+    {
+        src = uint16_t(0xfffa);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1ca6: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ca8: blos 1cba
+    if (C | Z)
+        AOT_GOTO(0x1cba, L1cba);
+    AOT_GOTO(0x1caa, L1caa);
+L1caa:
+    AOT_BLOCK(0x1caa, 2);
+    // 1caa: mov $4af6, (sp)
+    {
+        src = uint16_t(0x4af6);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1cae: jsr pc, *$10d8
+    {
+        a = 0x10d8;
+        r[6] -= 2;
+        WR16(r[6], 0x1cb2);
+    }
+    AOT_GOTO(0x10d8, L10d8);
+L1cb2:
+    AOT_BLOCK(0x1cb2, 1);
+    // 1cb2: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1cb6, L1cb6);
+L1cb6:
+    AOT_BLOCK(0x1cb6, 2);
+    // 1cb6: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L1cba:
+    AOT_BLOCK(0x1cba, 3);
+    // 1cba: mov r3, (r2)
+    {
+        src = r[3];
+        b = r[2];
+        WR16(b, src);
+    }
+    // 1cbc: add $2, -13a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -314);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 1cc2: mov 8d30, *-13a(r5)
+    {
+        a = 0x8d30;
+        src = RD16(a);
+        b = RD16(r[5] + -314);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1cc8, L1cc8);
+L1cc8:
+    AOT_BLOCK(0x1cc8, 5);
+    // 1cc8: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 1cca: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1ccc: mov 4828(r0), -138(r5)
+    {
+        a = uint16_t(r[0] + 18472);
+        src = RD16(a);
+        b = uint16_t(r[5] + -312);
+        WR16(b, src);
+    }
+    // 1cd2: cmp $fc18, -138(r5)
+    {
+        src = uint16_t(0xfc18);
+        b = uint16_t(r[5] + -312);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1cd8: bge 1d32
+    if (!(N ^ V))
+        AOT_GOTO(0x1d32, L1d32);
+    AOT_GOTO(0x1cda, L1cda);
+L1cda:
+    AOT_BLOCK(0x1cda, 2);
+    // 1cda: tst 4a1e
+    {
+        a = 0x4a1e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1cde: bge 1cee
+    if (!(N ^ V))
+        AOT_GOTO(0x1cee, L1cee);
+    AOT_GOTO(0x1ce0, L1ce0);
+L1ce0:
+    AOT_BLOCK(0x1ce0, 1);
+    // 1ce0: jsr pc, 19a2
+    {
+        a = 0x19a2;
+        r[6] -= 2;
+        WR16(r[6], 0x1ce4);
+    }
+    AOT_GOTO(0x19a2, L19a2);
+L1ce4:
+    AOT_BLOCK(0x1ce4, 2);
+    // 1ce4: mov r0, 4a1e
+    {
+        src = r[0];
+        b = 0x4a1e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ce8: bge 1cee
+    if (!(N ^ V))
+        AOT_GOTO(0x1cee, L1cee);
+    AOT_GOTO(0x1cea, L1cea);
+L1cea:
+    AOT_BLOCK(0x1cea, 1);
+    // 1cea: clr 4a1e
+    {
+        a = 0x4a1e;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1cee, L1cee);
+L1cee:
+    AOT_BLOCK(0x1cee, 2);
+    // 1cee: add 4a1e, -138(r5)
+    {
+        a = 0x4a1e;
+        src = RD16(a);
+        b = uint16_t(r[5] + -312);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1cf4: blt 1d32
+    if (N ^ V)
+        AOT_GOTO(0x1d32, L1d32);
+    AOT_GOTO(0x1cf6, L1cf6);
+L1cf6:
+    AOT_BLOCK(0x1cf6, 2);
+    // 1cf6: cmp $16b, -138(r5)
+    {
+        src = uint16_t(0x016b);
+        b = uint16_t(r[5] + -312);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1cfc: ble 1d32
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1d32, L1d32);
+    AOT_GOTO(0x1cfe, L1cfe);
+L1cfe:
+    AOT_BLOCK(0x1cfe, 7);
+    // 1cfe: mov -138(r5), r0
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1d02: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1d04: mov 4552(r0), r0
+    {
+        a = uint16_t(r[0] + 17746);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1d08: mov r0, -138(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -312);
+        WR16(b, src);
+    }
+    // 1d0c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1d0e: cmp 4a1e, 4924(r0)
+    {
+        a = 0x4a1e;
+        src = RD16(a);
+        b = uint16_t(r[0] + 18724);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d14: bne 1d32
+    if (!Z)
+        AOT_GOTO(0x1d32, L1d32);
+    AOT_GOTO(0x1d16, L1d16);
+L1d16:
+    AOT_BLOCK(0x1d16, 5);
+    // 1d16: mov $ffff, 4a1e
+    {
+        src = uint16_t(0xffff);
+        b = 0x4a1e;
+        WR16(b, src);
+    }
+    // 1d1c: mov 8d2e, 8d30
+    {
+        a = 0x8d2e;
+        src = RD16(a);
+        b = 0x8d30;
+        WR16(b, src);
+    }
+    // 1d22: mov -138(r5), r3
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1d26: tst 4a22
+    {
+        a = 0x4a22;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1d2a: ble 1c86
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1c86, L1c86);
+    AOT_GOTO(0x1d2c, L1d2c);
+L1d2c:
+    AOT_BLOCK(0x1d2c, 2);
+    // 1d2c: dec 4a22
+    {
+        a = 0x4a22;
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 1d30: br 1c86
+    AOT_GOTO(0x1c86, L1c86);
+L1d32:
+    AOT_BLOCK(0x1d32, 6);
+    // 1d32: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 1d34: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1d36: mov 49a0(r0), r0
+    {
+        a = uint16_t(r[0] + 18848);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1d3a: mov r0, -138(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -312);
+        WR16(b, src);
+    }
+    // 1d3e: cmp $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d42: bne 1d9c
+    if (!Z)
+        AOT_GOTO(0x1d9c, L1d9c);
+    AOT_GOTO(0x1d44, L1d44);
+L1d44:
+    AOT_BLOCK(0x1d44, 2);
+    // 1d44: tst 4a1e
+    {
+        a = 0x4a1e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1d48: bge 1d58
+    if (!(N ^ V))
+        AOT_GOTO(0x1d58, L1d58);
+    AOT_GOTO(0x1d4a, L1d4a);
+L1d4a:
+    AOT_BLOCK(0x1d4a, 1);
+    // 1d4a: jsr pc, 19a2
+    {
+        a = 0x19a2;
+        r[6] -= 2;
+        WR16(r[6], 0x1d4e);
+    }
+    AOT_GOTO(0x19a2, L19a2);
+L1d4e:
+    AOT_BLOCK(0x1d4e, 2);
+    // 1d4e: mov r0, 4a1e
+    {
+        src = r[0];
+        b = 0x4a1e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d52: bge 1d58
+    if (!(N ^ V))
+        AOT_GOTO(0x1d58, L1d58);
+    AOT_GOTO(0x1d54, L1d54);
+L1d54:
+    AOT_BLOCK(0x1d54, 1);
+    // 1d54: clr 4a1e
+    {
+        a = 0x4a1e;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1d58, L1d58);
+L1d58:
+    AOT_BLOCK(0x1d58, 2);
+    // 1d58: mov $44c6, -13c(r5)
+    {
+        src = uint16_t(0x44c6);
+        b = uint16_t(r[5] + -316);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d5e: br 1d66
+    AOT_GOTO(0x1d66, L1d66);
+L1d60:
+    AOT_BLOCK(0x1d60, 1);
+    // 1d60: add $4, -13c(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -316);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1d66, L1d66);
+L1d66:
+    AOT_BLOCK(0x1d66, 2);
+    // 1d66: cmp $ffff, *-13c(r5)
+    {
+        src = uint16_t(0xffff);
+        b = RD16(r[5] + -316);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d6c: bne 1d60
+    if (!Z)
+        AOT_GOTO(0x1d60, L1d60);
+    AOT_GOTO(0x1d6e, L1d6e);
+L1d6e:
+    AOT_BLOCK(0x1d6e, 3);
+    // 1d6e: mov -13c(r5), r0
+    {
+        a = uint16_t(r[5] + -316);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1d72: cmp r3, 2(r0)
+    {
+        src = r[3];
+        b = uint16_t(r[0] + 2);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d76: bne 1d60
+    if (!Z)
+        AOT_GOTO(0x1d60, L1d60);
+    AOT_GOTO(0x1d78, L1d78);
+L1d78:
+    AOT_BLOCK(0x1d78, 3);
+    // 1d78: add $4, -13c(r5)
+    {
+        src = uint16_t(0x0004);
+        b = uint16_t(r[5] + -316);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 1d7e: tst *-13c(r5)
+    {
+        a = RD16(r[5] + -316);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1d82: blt 1d8c
+    if (N ^ V)
+        AOT_GOTO(0x1d8c, L1d8c);
+    AOT_GOTO(0x1d84, L1d84);
+L1d84:
+    AOT_BLOCK(0x1d84, 2);
+    // 1d84: cmp 4a1e, *-13c(r5)
+    {
+        a = 0x4a1e;
+        src = RD16(a);
+        b = RD16(r[5] + -316);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1d8a: bne 1d78
+    if (!Z)
+        AOT_GOTO(0x1d78, L1d78);
+    AOT_GOTO(0x1d8c, L1d8c);
+L1d8c:
+    AOT_BLOCK(0x1d8c, 3);
+    // 1d8c: mov -13c(r5), r0
+    {
+        a = uint16_t(r[5] + -316);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1d90: mov 2(r0), -138(r5)
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        b = uint16_t(r[5] + -312);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1d96: bge 1d9c
+    if (!(N ^ V))
+        AOT_GOTO(0x1d9c, L1d9c);
+    AOT_GOTO(0x1d98, L1d98);
+L1d98:
+    AOT_BLOCK(0x1d98, 2);
+    // 1d98: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1d9a: br 1cb6
+    AOT_GOTO(0x1cb6, L1cb6);
+L1d9c:
+    AOT_BLOCK(0x1d9c, 2);
+    // 1d9c: tst -138(r5)
+    {
+        a = uint16_t(r[5] + -312);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1da0: bne 1e5c
+    if (!Z)
+        AOT_GOTO(0x1e5c, L1e5c);
+    AOT_GOTO(0x1da2, L1da2);
+L1da2:
+    AOT_BLOCK(0x1da2, 3);
+    // 1da2: mov 4a22, r0
+    {
+        a = 0x4a22;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1da6: cmp r0, $3
+    {
+        src = r[0];
+        dst = uint16_t(0x0003);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1daa: bhi 1e5c
+    if (!(C | Z))
+        AOT_GOTO(0x1e5c, L1e5c);
+    AOT_GOTO(0x1dac, L1dac);
+L1dac:
+    AOT_BLOCK(0x1dac, 2);
+    // 1dac: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 1dae: jmp *4a24(r0)
+    {
+        a = RD16(r[0] + 18980);
+    }
+    AOT_JUMP(a);
+L1db2:
+    AOT_BLOCK(0x1db2, 2);
+    // 1db2: mov $4b0a, (sp)
+    {
+        src = uint16_t(0x4b0a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1db6: jsr pc, *$10d8
+    {
+        a = 0x10d8;
+        r[6] -= 2;
+        WR16(r[6], 0x1dba);
+    }
+    AOT_GOTO(0x10d8, L10d8);
+L1dba:
+    AOT_BLOCK(0x1dba, 1);
+    // 1dba: inc 4a20
+    {
+        a = 0x4a20;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x1dbe, L1dbe);
+L1dbe:
+    AOT_BLOCK(0x1dbe, 2);
+    // 1dbe: mov $3, 4a22
+    {
+        src = uint16_t(0x0003);
+        b = 0x4a22;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dc4: br 1e26
+    AOT_GOTO(0x1e26, L1e26);
+L1dc6:
+    AOT_BLOCK(0x1dc6, 6);
+    // 1dc6: mov (r2), r0
+    {
+        a = r[2];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1dc8: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1dca: mov 4828(r0), r0
+    {
+        a = uint16_t(r[0] + 18472);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1dce: add $100, r0
+    {
+        src = uint16_t(0x0100);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 1dd2: mov r0, -138(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -312);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1dd6: blt 1dfc
+    if (N ^ V)
+        AOT_GOTO(0x1dfc, L1dfc);
+    AOT_GOTO(0x1dd8, L1dd8);
+L1dd8:
+    AOT_BLOCK(0x1dd8, 2);
+    // 1dd8: cmp $16b, r0
+    {
+        src = uint16_t(0x016b);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ddc: ble 1dfc
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1dfc, L1dfc);
+    AOT_GOTO(0x1dde, L1dde);
+L1dde:
+    AOT_BLOCK(0x1dde, 5);
+    // 1dde: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1de0: mov 4552(r0), r0
+    {
+        a = uint16_t(r[0] + 17746);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1de4: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1de6: cmp $100, 4924(r0)
+    {
+        src = uint16_t(0x0100);
+        b = uint16_t(r[0] + 18724);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1dec: bne 1dfc
+    if (!Z)
+        AOT_GOTO(0x1dfc, L1dfc);
+    AOT_GOTO(0x1dee, L1dee);
+L1dee:
+    AOT_BLOCK(0x1dee, 4);
+    // 1dee: mov -138(r5), r0
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1df2: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1df4: mov 4552(r0), r3
+    {
+        a = uint16_t(r[0] + 17746);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1df8: jmp *$1c86
+    {
+        a = 0x1c86;
+    }
+    AOT_GOTO(0x1c86, L1c86);
+L1dfc:
+    AOT_BLOCK(0x1dfc, 5);
+    // 1dfc: mov (r2), r0
+    {
+        a = r[2];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1dfe: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1e00: mov 4828(r0), -138(r5)
+    {
+        a = uint16_t(r[0] + 18472);
+        src = RD16(a);
+        b = uint16_t(r[5] + -312);
+        WR16(b, src);
+    }
+    // 1e06: tst 4a1c
+    {
+        a = 0x4a1c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1e0a: beq 1e1c
+    if (Z)
+        AOT_GOTO(0x1e1c, L1e1c);
+    AOT_GOTO(0x1e0c, L1e0c);
+L1e0c:
+    AOT_BLOCK(0x1e0c, 4);
+    // 1e0c: mov -2(r2), (sp)
+    {
+        a = uint16_t(r[2] + -2);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e10: mov (r2), -(sp)
+    {
+        a = r[2];
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e12: mov $4b17, -(sp)
+    {
+        src = uint16_t(0x4b17);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e16: jsr pc, *$204c
+    {
+        a = 0x204c;
+        r[6] -= 2;
+        WR16(r[6], 0x1e1a);
+    }
+    AOT_GOTO(0x204c, L204c);
+L1e1a:
+    AOT_BLOCK(0x1e1a, 1);
+    // 1e1a: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1e1c, L1e1c);
+L1e1c:
+    AOT_BLOCK(0x1e1c, 2);
+    // 1e1c: sub $2, r2
+    {
+        src = uint16_t(0x0002);
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+    }
+    // 1e20: sub $2, -13a(r5)
+    {
+        src = uint16_t(0x0002);
+        b = uint16_t(r[5] + -314);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[5] + -314);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    AOT_GOTO(0x1e26, L1e26);
+L1e26:
+    AOT_BLOCK(0x1e26, 4);
+    // 1e26: mov r5, r0
+    {
+        src = r[5];
+        r[0] = src;
+    }
+    // 1e28: add $fece, r0
+    {
+        src = uint16_t(0xfece);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1e2c: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1e2e: bcc 1dc6
+    if (!C)
+        AOT_GOTO(0x1dc6, L1dc6);
+    AOT_GOTO(0x1e30, L1e30);
+L1e30:
+    AOT_BLOCK(0x1e30, 1);
+    // 1e30: jmp *$1cb2
+    {
+        a = 0x1cb2;
+    }
+    AOT_GOTO(0x1cb2, L1cb2);
+L1e34:
+    AOT_BLOCK(0x1e34, 2);
+    // 1e34: tst 4a1c
+    {
+        a = 0x4a1c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1e38: beq 1e48
+    if (Z)
+        AOT_GOTO(0x1e48, L1e48);
+    AOT_GOTO(0x1e3a, L1e3a);
+L1e3a:
+    AOT_BLOCK(0x1e3a, 3);
+    // 1e3a: mov 4a1e, (sp)
+    {
+        a = 0x4a1e;
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e3e: mov $4b42, -(sp)
+    {
+        src = uint16_t(0x4b42);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e42: jsr pc, *$204c
+    {
+        a = 0x204c;
+        r[6] -= 2;
+        WR16(r[6], 0x1e46);
+    }
+    AOT_GOTO(0x204c, L204c);
+L1e46:
+    AOT_BLOCK(0x1e46, 1);
+    // 1e46: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1e48, L1e48);
+L1e48:
+    AOT_BLOCK(0x1e48, 2);
+    // 1e48: tst 4a1e
+    {
+        a = 0x4a1e;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1e4c: bne 1e52
+    if (!Z)
+        AOT_GOTO(0x1e52, L1e52);
+    AOT_GOTO(0x1e4e, L1e4e);
+L1e4e:
+    AOT_BLOCK(0x1e4e, 1);
+    // 1e4e: jmp *$1cb2
+    {
+        a = 0x1cb2;
+    }
+    AOT_GOTO(0x1cb2, L1cb2);
+L1e52:
+    AOT_BLOCK(0x1e52, 2);
+    // 1e52: mov $ffff, 4a1e
+    {
+        src = uint16_t(0xffff);
+        b = 0x4a1e;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e58: jmp *$1cc8
+    {
+        a = 0x1cc8;
+    }
+    AOT_GOTO(0x1cc8, L1cc8);
+L1e5c:
+    AOT_BLOCK(0x1e5c, 2);
+    // 1e5c: tst 4a1c
+    {
+        a = 0x4a1c;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1e60: beq 1e70
+    if (Z)
+        AOT_GOTO(0x1e70, L1e70);
+    AOT_GOTO(0x1e62, L1e62);
+L1e62:
+    AOT_BLOCK(0x1e62, 3);
+    // 1e62: mov -138(r5), (sp)
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 1e66: mov $4b63, -(sp)
+    {
+        src = uint16_t(0x4b63);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1e6a: jsr pc, *$204c
+    {
+        a = 0x204c;
+        r[6] -= 2;
+        WR16(r[6], 0x1e6e);
+    }
+    AOT_GOTO(0x204c, L204c);
+L1e6e:
+    AOT_BLOCK(0x1e6e, 1);
+    // 1e6e: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x1e70, L1e70);
+L1e70:
+    AOT_BLOCK(0x1e70, 25);
+    // 1e70: mov -138(r5), r0
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1e74: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1e76: mov 48e8(r0), r0
+    {
+        a = uint16_t(r[0] + 18664);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1e7a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1e7c: sub r0, r2
+    {
+        src = r[0];
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+    }
+    // 1e7e: mov -13a(r5), r4
+    {
+        a = uint16_t(r[5] + -314);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 1e82: mov -138(r5), r0
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1e86: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1e88: mov 48e8(r0), r0
+    {
+        a = uint16_t(r[0] + 18664);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1e8c: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1e8e: sub r0, -13a(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -314);
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = uint16_t(r[5] + -314);
+        WR16(b, val16);
+    }
+    // 1e92: mov -13a(r5), r0
+    {
+        a = uint16_t(r[5] + -314);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1e96: mov 2(r0), 8d30
+    {
+        a = uint16_t(r[0] + 2);
+        src = RD16(a);
+        b = 0x8d30;
+        WR16(b, src);
+    }
+    // 1e9c: mov -138(r5), -136(r5)
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        b = uint16_t(r[5] + -310);
+        WR16(b, src);
+    }
+    // 1ea2: mov -138(r5), r0
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1ea6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1ea8: mov 48ac(r0), -138(r5)
+    {
+        a = uint16_t(r[0] + 18604);
+        src = RD16(a);
+        b = uint16_t(r[5] + -312);
+        WR16(b, src);
+    }
+    // 1eae: mov -138(r5), r0
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1eb2: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1eb4: mov 48a4(r0), r0
+    {
+        a = uint16_t(r[0] + 18596);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1eb8: add (r2), r0
+    {
+        a = r[2];
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 1eba: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 1ebc: mov r0, -134(r5)
+    {
+        src = r[0];
+        b = uint16_t(r[5] + -308);
+        WR16(b, src);
+    }
+    // 1ec0: cmp $16b, r0
+    {
+        src = uint16_t(0x016b);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ec4: ble 1edc
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1edc, L1edc);
+    AOT_GOTO(0x1ec6, L1ec6);
+L1ec6:
+    AOT_BLOCK(0x1ec6, 8);
+    // 1ec6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1ec8: mov 4552(r0), r3
+    {
+        a = uint16_t(r[0] + 17746);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 1ecc: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 1ece: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1ed0: mov -138(r5), r1
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1ed4: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+    }
+    // 1ed6: cmp r1, 4924(r0)
+    {
+        src = r[1];
+        b = uint16_t(r[0] + 18724);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1eda: beq 1eec
+    if (Z)
+        AOT_GOTO(0x1eec, L1eec);
+    AOT_GOTO(0x1edc, L1edc);
+L1edc:
+    AOT_BLOCK(0x1edc, 5);
+    // 1edc: mov -138(r5), r0
+    {
+        a = uint16_t(r[5] + -312);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1ee0: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 1ee2: mov 48a4(r0), r0
+    {
+        a = uint16_t(r[0] + 18596);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1ee6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 1ee8: mov 4552(r0), r3
+    {
+        a = uint16_t(r[0] + 17746);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x1eec, L1eec);
+L1eec:
+    AOT_BLOCK(0x1eec, 4);
+    // 1eec: mov -136(r5), r0
+    {
+        a = uint16_t(r[5] + -310);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1ef0: sub $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 1ef4: cmp r0, $1c
+    {
+        src = r[0];
+        dst = uint16_t(0x001c);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1ef8: blos 1efe
+    if (C | Z)
+        AOT_GOTO(0x1efe, L1efe);
+    AOT_GOTO(0x1efa, L1efa);
+L1efa:
+    AOT_BLOCK(0x1efa, 1);
+    // 1efa: jmp *$1c86
+    {
+        a = 0x1c86;
+    }
+    AOT_GOTO(0x1c86, L1c86);
+L1efe:
+    AOT_BLOCK(0x1efe, 2);
+    // 1efe: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = (src & 0x8000) != 0;
+        V = (val < 0) != ((src & 0x8000) != 0);
+    }
+    // 1f00: jmp *4a2c(r0)
+    {
+        a = RD16(r[0] + 18988);
+    }
+    AOT_JUMP(a);
+L1f04:
+    AOT_BLOCK(0x1f04, 2);
+    // 1f04: mov -2(r4), r0
+    {
+        a = uint16_t(r[4] + -2);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f08: jmp *$1cb6
+    {
+        a = 0x1cb6;
+    }
+    AOT_GOTO(0x1cb6, L1cb6);
+L1f0c:
+    AOT_BLOCK(0x1f0c, 2);
+    // 1f0c: mov -4(r4), r1
+    {
+        a = uint16_t(r[4] + -4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1f10: mul (r4), r1
+    {
+        a = r[4];
+        src = int16_t(RD16(a));
+        val = int(r[1]) * src;
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val < -0x8000 || val >= 0x8000;
+        V = false;
+    }
+    AOT_GOTO(0x1f12, L1f12);
+L1f12:
+    AOT_BLOCK(0x1f12, 2);
+    // 1f12: mov r1, 8d30
+    {
+        src = r[1];
+        b = 0x8d30;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f16: jmp *$1c86
+    {
+        a = 0x1c86;
+    }
+    AOT_GOTO(0x1c86, L1c86);
+L1f1a:
+    AOT_BLOCK(0x1f1a, 3);
+    // 1f1a: mov -4(r4), r1
+    {
+        a = uint16_t(r[4] + -4);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 1f1e: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 1f20: div (r4), r0
+    {
+        a = r[4];
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    AOT_GOTO(0x1f22, L1f22);
+L1f22:
+    AOT_BLOCK(0x1f22, 2);
+    // 1f22: mov r0, 8d30
+    {
+        src = r[0];
+        b = 0x8d30;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f26: jmp *$1c86
+    {
+        a = 0x1c86;
+    }
+    AOT_GOTO(0x1c86, L1c86);
+L1f2a:
+    AOT_BLOCK(0x1f2a, 4);
+    // 1f2a: mov -4(r4), r1
+    {
+        a = uint16_t(r[4] + -4);
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+    }
+    // 1f2e: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 1f30: div (r4), r0
+    {
+        a = r[4];
+        src = int16_t(RD16(a));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 1f32: br 1f12
+    AOT_GOTO(0x1f12, L1f12);
+L1f34:
+    AOT_BLOCK(0x1f34, 3);
+    // 1f34: mov -4(r4), r0
+    {
+        a = uint16_t(r[4] + -4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1f38: add (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 1f3a: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1f3c:
+    AOT_BLOCK(0x1f3c, 3);
+    // 1f3c: mov -4(r4), r0
+    {
+        a = uint16_t(r[4] + -4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1f40: sub (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 1f42: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1f44:
+    AOT_BLOCK(0x1f44, 3);
+    // 1f44: mov -4(r4), r0
+    {
+        a = uint16_t(r[4] + -4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1f48: ash (r4), r0
+    {
+        a = r[4];
+        src = RD16(a) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1f4a: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1f4c:
+    AOT_BLOCK(0x1f4c, 5);
+    // 1f4c: mov -4(r4), r0
+    {
+        a = uint16_t(r[4] + -4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1f50: mov (r4), r1
+    {
+        a = r[4];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1f52: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 1f54: ash r1, r0
+    {
+        src = r[1] & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 1f56: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1f58:
+    AOT_BLOCK(0x1f58, 2);
+    // 1f58: cmp (r4), -4(r4)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = uint16_t(r[4] + -4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f5c: bgt 1f62
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x1f62, L1f62);
+    AOT_GOTO(0x1f5e, L1f5e);
+L1f5e:
+    AOT_BLOCK(0x1f5e, 2);
+    // 1f5e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 1f60: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1f62:
+    AOT_BLOCK(0x1f62, 2);
+    // 1f62: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1f66: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1f68:
+    AOT_BLOCK(0x1f68, 2);
+    // 1f68: cmp (r4), -4(r4)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = uint16_t(r[4] + -4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f6c: blt 1f62
+    if (N ^ V)
+        AOT_GOTO(0x1f62, L1f62);
+    AOT_GOTO(0x1f6e, L1f6e);
+L1f6e:
+    AOT_BLOCK(0x1f6e, 1);
+    // 1f6e: br 1f5e
+    AOT_GOTO(0x1f5e, L1f5e);
+L1f70:
+    AOT_BLOCK(0x1f70, 2);
+    // 1f70: cmp (r4), -4(r4)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = uint16_t(r[4] + -4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f74: bge 1f62
+    if (!(N ^ V))
+        AOT_GOTO(0x1f62, L1f62);
+    AOT_GOTO(0x1f76, L1f76);
+L1f76:
+    AOT_BLOCK(0x1f76, 1);
+    // 1f76: br 1f5e
+    AOT_GOTO(0x1f5e, L1f5e);
+L1f78:
+    AOT_BLOCK(0x1f78, 2);
+    // 1f78: cmp (r4), -4(r4)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = uint16_t(r[4] + -4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f7c: ble 1f62
+    if (Z || (N ^ V))
+        AOT_GOTO(0x1f62, L1f62);
+    AOT_GOTO(0x1f7e, L1f7e);
+L1f7e:
+    AOT_BLOCK(0x1f7e, 1);
+    // 1f7e: br 1f5e
+    AOT_GOTO(0x1f5e, L1f5e);
+L1f80:
+    AOT_BLOCK(0x1f80, 2);
+    // 1f80: cmp (r4), -4(r4)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = uint16_t(r[4] + -4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f84: beq 1f62
+    if (Z)
+        AOT_GOTO(0x1f62, L1f62);
+    AOT_GOTO(0x1f86, L1f86);
+L1f86:
+    AOT_BLOCK(0x1f86, 1);
+    // 1f86: br 1f5e
+    AOT_GOTO(0x1f5e, L1f5e);
+L1f88:
+    AOT_BLOCK(0x1f88, 2);
+    // 1f88: cmp (r4), -4(r4)
+    {
+        a = r[4];
+        src = RD16(a);
+        b = uint16_t(r[4] + -4);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 1f8c: bne 1f62
+    if (!Z)
+        AOT_GOTO(0x1f62, L1f62);
+    AOT_GOTO(0x1f8e, L1f8e);
+L1f8e:
+    AOT_BLOCK(0x1f8e, 1);
+    // 1f8e: br 1f5e
+    AOT_GOTO(0x1f5e, L1f5e);
+L1f90:
+    AOT_BLOCK(0x1f90, 5);
+    // 1f90: mov -4(r4), r0
+    {
+        a = uint16_t(r[4] + -4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1f94: mov (r4), r1
+    {
+        a = r[4];
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1f96: com r1
+    {
+        val = ~int(r[1]);
+        r[1] = val;
+        C = true;
+    }
+    // 1f98: bic r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1f9a: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1f9c:
+    AOT_BLOCK(0x1f9c, 4);
+    // 1f9c: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1f9e: mov -4(r4), r1
+    {
+        a = uint16_t(r[4] + -4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 1fa2: xor r1, r0
+    {
+        src = r[1];
+        val = src ^ r[0];
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1fa4: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1fa6:
+    AOT_BLOCK(0x1fa6, 3);
+    // 1fa6: mov -4(r4), r0
+    {
+        a = uint16_t(r[4] + -4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1faa: bis (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 1fac: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1fae:
+    AOT_BLOCK(0x1fae, 2);
+    // 1fae: tst -4(r4)
+    {
+        a = uint16_t(r[4] + -4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1fb2: beq 1f5e
+    if (Z)
+        AOT_GOTO(0x1f5e, L1f5e);
+    AOT_GOTO(0x1fb4, L1fb4);
+L1fb4:
+    AOT_BLOCK(0x1fb4, 2);
+    // 1fb4: tst (r4)
+    {
+        a = r[4];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1fb6: bne 1f62
+    if (!Z)
+        AOT_GOTO(0x1f62, L1f62);
+    AOT_GOTO(0x1fb8, L1fb8);
+L1fb8:
+    AOT_BLOCK(0x1fb8, 1);
+    // 1fb8: br 1f5e
+    AOT_GOTO(0x1f5e, L1f5e);
+L1fba:
+    AOT_BLOCK(0x1fba, 2);
+    // 1fba: tst -4(r4)
+    {
+        a = uint16_t(r[4] + -4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1fbe: bne 1f62
+    if (!Z)
+        AOT_GOTO(0x1f62, L1f62);
+    AOT_GOTO(0x1fc0, L1fc0);
+L1fc0:
+    AOT_BLOCK(0x1fc0, 2);
+    // 1fc0: tst (r4)
+    {
+        a = r[4];
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1fc2: bne 1f62
+    if (!Z)
+        AOT_GOTO(0x1f62, L1f62);
+    AOT_GOTO(0x1fc4, L1fc4);
+L1fc4:
+    AOT_BLOCK(0x1fc4, 1);
+    // 1fc4: br 1f5e
+    AOT_GOTO(0x1f5e, L1f5e);
+L1fc6:
+    AOT_BLOCK(0x1fc6, 2);
+    // 1fc6: tst -8(r4)
+    {
+        a = uint16_t(r[4] + -8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1fca: beq 1fd2
+    if (Z)
+        AOT_GOTO(0x1fd2, L1fd2);
+    AOT_GOTO(0x1fcc, L1fcc);
+L1fcc:
+    AOT_BLOCK(0x1fcc, 2);
+    // 1fcc: mov -4(r4), r0
+    {
+        a = uint16_t(r[4] + -4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fd0: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1fd2:
+    AOT_BLOCK(0x1fd2, 2);
+    // 1fd2: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fd4: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1fd6:
+    AOT_BLOCK(0x1fd6, 2);
+    // 1fd6: mov (r4), 8d30
+    {
+        a = r[4];
+        src = RD16(a);
+        b = 0x8d30;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1fda: jmp *$1c86
+    {
+        a = 0x1c86;
+    }
+    AOT_GOTO(0x1c86, L1c86);
+L1fde:
+    AOT_BLOCK(0x1fde, 3);
+    // 1fde: mov -2(r4), r0
+    {
+        a = uint16_t(r[4] + -2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1fe2: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    // 1fe4: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1fe6:
+    AOT_BLOCK(0x1fe6, 2);
+    // 1fe6: tst -2(r4)
+    {
+        a = uint16_t(r[4] + -2);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 1fea: beq 1f62
+    if (Z)
+        AOT_GOTO(0x1f62, L1f62);
+    AOT_GOTO(0x1fec, L1fec);
+L1fec:
+    AOT_BLOCK(0x1fec, 1);
+    // 1fec: br 1f5e
+    AOT_GOTO(0x1f5e, L1f5e);
+L1fee:
+    AOT_BLOCK(0x1fee, 3);
+    // 1fee: mov -2(r4), r0
+    {
+        a = uint16_t(r[4] + -2);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 1ff2: com r0
+    {
+        val = ~int(r[0]);
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = true;
+        V = false;
+    }
+    // 1ff4: br 1f22
+    AOT_GOTO(0x1f22, L1f22);
+L1ff6:
+    AOT_BLOCK(0x1ff6, 2);
+    // 1ff6: mov -2(r4), 8d30
+    {
+        a = uint16_t(r[4] + -2);
+        src = RD16(a);
+        b = 0x8d30;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 1ffc: jmp *$1c86
+    {
+        a = 0x1c86;
+    }
+    AOT_GOTO(0x1c86, L1c86);
+L2000:
+    AOT_BLOCK(0x2000, 3);
+    // 2000: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2004;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 2004: jsr pc, 26ec
+    {
+        a = 0x26ec;
+        r[6] -= 2;
+        WR16(r[6], 0x2008);
+    }
+    AOT_GOTO(0x26ec, L26ec);
+L2008:
+    AOT_BLOCK(0x2008, 4);
+    // 2008: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 200a: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 200e: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2012: jsr pc, *$25d8
+    {
+        a = 0x25d8;
+        r[6] -= 2;
+        WR16(r[6], 0x2016);
+    }
+    AOT_GOTO(0x25d8, L25d8);
+L2016:
+    AOT_BLOCK(0x2016, 3);
+    // 2016: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 2018: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L201c:
+    AOT_BLOCK(0x201c, 7);
+    // 201c: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2020;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 2020: mov 4(r5), (sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2024: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2026: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 202a: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 202e: jsr pc, *$210e
+    {
+        a = 0x210e;
+        r[6] -= 2;
+        WR16(r[6], 0x2032);
+    }
+    AOT_GOTO(0x210e, L210e);
+L2032:
+    AOT_BLOCK(0x2032, 4);
+    // 2032: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 2034: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2038: bitb $20, 6(r0)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[0] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 203e: beq 2048
+    if (Z)
+        AOT_GOTO(0x2048, L2048);
+    AOT_GOTO(0x2040, L2040);
+L2040:
+    AOT_BLOCK(0x2040, 1);
+    // 2040: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2044, L2044);
+L2044:
+    AOT_BLOCK(0x2044, 2);
+    // 2044: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2048:
+    AOT_BLOCK(0x2048, 2);
+    // 2048: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 204a: br 2044
+    AOT_GOTO(0x2044, L2044);
+L204c:
+    AOT_BLOCK(0x204c, 7);
+    // 204c: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2050;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 2050: mov $4bc2, (sp)
+    {
+        src = uint16_t(0x4bc2);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2054: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2056: add $6, (sp)
+    {
+        src = uint16_t(0x0006);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 205a: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 205e: jsr pc, *$210e
+    {
+        a = 0x210e;
+        r[6] -= 2;
+        WR16(r[6], 0x2062);
+    }
+    AOT_GOTO(0x210e, L210e);
+L2062:
+    AOT_BLOCK(0x2062, 1);
+    // 2062: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2064, L2064);
+L2064:
+    AOT_BLOCK(0x2064, 2);
+    // 2064: bitb $20, 4bc8
+    {
+        src = uint8_t(0x20);
+        b = 0x4bc8;
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 206a: beq 2074
+    if (Z)
+        AOT_GOTO(0x2074, L2074);
+    AOT_GOTO(0x206c, L206c);
+L206c:
+    AOT_BLOCK(0x206c, 1);
+    // 206c: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2070, L2070);
+L2070:
+    AOT_BLOCK(0x2070, 2);
+    // 2070: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2074:
+    AOT_BLOCK(0x2074, 2);
+    // 2074: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2076: br 2070
+    AOT_GOTO(0x2070, L2070);
+L2078:
+    AOT_BLOCK(0x2078, 12);
+    // 2078: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x207c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 207c: sub $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 2080: movb $42, -8(r5)
+    {
+        src = uint8_t(0x42);
+        b = uint16_t(r[5] + -8);
+        WR8(b, src);
+    }
+    // 2086: mov 4(r5), -e(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -14);
+        WR16(b, src);
+    }
+    // 208c: mov $7fff, -c(r5)
+    {
+        src = uint16_t(0x7fff);
+        b = uint16_t(r[5] + -12);
+        WR16(b, src);
+    }
+    // 2092: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2094: add $fff2, (sp)
+    {
+        src = uint16_t(0xfff2);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 2098: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 209a: add $8, (sp)
+    {
+        src = uint16_t(0x0008);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 209e: mov 6(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20a2: jsr pc, *$210e
+    {
+        a = 0x210e;
+        r[6] -= 2;
+        WR16(r[6], 0x20a6);
+    }
+    AOT_GOTO(0x210e, L210e);
+L20a6:
+    AOT_BLOCK(0x20a6, 3);
+    // 20a6: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 20a8: dec -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 20ac: blt 20b8
+    if (N ^ V)
+        AOT_GOTO(0x20b8, L20b8);
+    AOT_GOTO(0x20ae, L20ae);
+L20ae:
+    AOT_BLOCK(0x20ae, 3);
+    // 20ae: clrb *-e(r5)
+    {
+        a = RD16(r[5] + -14);
+        WR8(a, 0);
+        C = false;
+    }
+    // 20b2: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 20b6: br 20c6
+    AOT_GOTO(0x20c6, L20c6);
+L20b8:
+    AOT_BLOCK(0x20b8, 4);
+    // 20b8: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 20ba: add $fff2, (sp)
+    {
+        src = uint16_t(0xfff2);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+    }
+    // 20be: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 20c0: jsr pc, *$2424
+    {
+        a = 0x2424;
+        r[6] -= 2;
+        WR16(r[6], 0x20c4);
+    }
+    AOT_GOTO(0x2424, L2424);
+L20c4:
+    AOT_BLOCK(0x20c4, 1);
+    // 20c4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x20c6, L20c6);
+L20c6:
+    AOT_BLOCK(0x20c6, 3);
+    // 20c6: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 20ca: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L20ce:
+    AOT_BLOCK(0x20ce, 5);
+    // 20ce: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x20d2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 20d2: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 20d6: tst 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 20da: beq 20ec
+    if (Z)
+        AOT_GOTO(0x20ec, L20ec);
+    AOT_GOTO(0x20dc, L20dc);
+L20dc:
+    AOT_BLOCK(0x20dc, 2);
+    // 20dc: bitb $8, 6(r4)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 20e2: beq 20ec
+    if (Z)
+        AOT_GOTO(0x20ec, L20ec);
+    AOT_GOTO(0x20e4, L20e4);
+L20e4:
+    AOT_BLOCK(0x20e4, 2);
+    // 20e4: mov 4(r4), (sp)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20e8: jsr pc, *$285a
+    {
+        a = 0x285a;
+        r[6] -= 2;
+        WR16(r[6], 0x20ec);
+    }
+    AOT_GOTO(0x285a, L285a);
+L20ec:
+    AOT_BLOCK(0x20ec, 3);
+    // 20ec: bicb $c, 6(r4)
+    {
+        src = uint8_t(0x0c);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+    }
+    // 20f2: mov 6(r5), 4(r4)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 20f8: bne 2102
+    if (!Z)
+        AOT_GOTO(0x2102, L2102);
+    AOT_GOTO(0x20fa, L20fa);
+L20fa:
+    AOT_BLOCK(0x20fa, 2);
+    // 20fa: bisb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2100: br 2106
+    AOT_GOTO(0x2106, L2106);
+L2102:
+    AOT_BLOCK(0x2102, 1);
+    // 2102: mov 4(r4), (r4)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2106, L2106);
+L2106:
+    AOT_BLOCK(0x2106, 3);
+    // 2106: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        C = false;
+    }
+    // 210a: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L210e:
+    AOT_BLOCK(0x210e, 5);
+    // 210e: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2112;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 2112: sub $8c, sp
+    {
+        src = uint16_t(0x008c);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 2116: mov 4(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 211c: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2120, L2120);
+L2120:
+    AOT_BLOCK(0x2120, 2);
+    // 2120: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 2122: mov -a(r5), r1
+    {
+        a = uint16_t(r[5] + -10);
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2126, L2126);
+L2126:
+    AOT_BLOCK(0x2126, 2);
+    // 2126: movb (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 1;
+        src = RD8(a);
+        r[2] = int16_t(int8_t(src));
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 2128: beq 2134
+    if (Z)
+        AOT_GOTO(0x2134, L2134);
+    AOT_GOTO(0x212a, L212a);
+L212a:
+    AOT_BLOCK(0x212a, 2);
+    // 212a: cmp r2, $25
+    {
+        src = r[2];
+        dst = uint16_t(0x0025);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 212e: beq 2134
+    if (Z)
+        AOT_GOTO(0x2134, L2134);
+    AOT_GOTO(0x2130, L2130);
+L2130:
+    AOT_BLOCK(0x2130, 2);
+    // 2130: movb r2, (r3)+
+    {
+        src = uint8_t(r[2]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 2132: br 2126
+    AOT_GOTO(0x2126, L2126);
+L2134:
+    AOT_BLOCK(0x2134, 2);
+    // 2134: mov r1, -a(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+    }
+    // 2138: cmp r3, sp
+    {
+        src = r[3];
+        dst = r[6];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    AOT_GOTO(0x213a, L213a);
+L213a:
+    AOT_BLOCK(0x213a, 1);
+    // 213a: beq 2152
+    if (Z)
+        AOT_GOTO(0x2152, L2152);
+    AOT_GOTO(0x213c, L213c);
+L213c:
+    AOT_BLOCK(0x213c, 7);
+    // 213c: mov sp, r0
+    {
+        src = r[6];
+        r[0] = src;
+    }
+    // 213e: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2142: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+    }
+    // 2144: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2146: sub r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(dst) - int16_t(src);
+        b = r[6];
+        WR16(b, val16);
+        C = dst < src;
+    }
+    // 2148: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 214a: jsr pc, 2364
+    {
+        a = 0x2364;
+        r[6] -= 2;
+        WR16(r[6], 0x214e);
+    }
+    AOT_GOTO(0x2364, L2364);
+L214e:
+    AOT_BLOCK(0x214e, 1);
+    // 214e: add $8, sp
+    {
+        src = uint16_t(0x0008);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2152, L2152);
+L2152:
+    AOT_BLOCK(0x2152, 2);
+    // 2152: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2154: bne 215a
+    if (!Z)
+        AOT_GOTO(0x215a, L215a);
+    AOT_GOTO(0x2156, L2156);
+L2156:
+    AOT_BLOCK(0x2156, 2);
+    // 2156: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L215a:
+    AOT_BLOCK(0x215a, 6);
+    // 215a: mov sp, r3
+    {
+        src = r[6];
+        r[3] = src;
+    }
+    // 215c: clr -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        WR16(a, 0);
+    }
+    // 2160: clr -10(r5)
+    {
+        a = uint16_t(r[5] + -16);
+        WR16(a, 0);
+    }
+    // 2164: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 216a: cmpb *-a(r5), $2d
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        dst = uint8_t(0x2d);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2170: bne 217a
+    if (!Z)
+        AOT_GOTO(0x217a, L217a);
+    AOT_GOTO(0x2172, L2172);
+L2172:
+    AOT_BLOCK(0x2172, 2);
+    // 2172: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 2176: inc -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x217a, L217a);
+L217a:
+    AOT_BLOCK(0x217a, 2);
+    // 217a: cmpb *-a(r5), $30
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        dst = uint8_t(0x30);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 2180: bne 2188
+    if (!Z)
+        AOT_GOTO(0x2188, L2188);
+    AOT_GOTO(0x2182, L2182);
+L2182:
+    AOT_BLOCK(0x2182, 1);
+    // 2182: mov $30, -12(r5)
+    {
+        src = uint16_t(0x0030);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2188, L2188);
+L2188:
+    AOT_BLOCK(0x2188, 1);
+    // 2188: jsr r3, 2326
+    {
+        a = 0x2326;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x218c;
+    }
+    AOT_GOTO(0x2326, L2326);
+L218c:
+    AOT_BLOCK(0x218c, 4);
+    // 218c: mov r1, -8(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 2190: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+    }
+    // 2194: cmp r0, $2e
+    {
+        src = r[0];
+        dst = uint16_t(0x002e);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2198: bne 21a2
+    if (!Z)
+        AOT_GOTO(0x21a2, L21a2);
+    AOT_GOTO(0x219a, L219a);
+L219a:
+    AOT_BLOCK(0x219a, 1);
+    // 219a: jsr r3, 2326
+    {
+        a = 0x2326;
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[3] = 0x219e;
+    }
+    AOT_GOTO(0x2326, L2326);
+L219e:
+    AOT_BLOCK(0x219e, 1);
+    // 219e: mov r1, -10(r5)
+    {
+        src = r[1];
+        b = uint16_t(r[5] + -16);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x21a2, L21a2);
+L21a2:
+    AOT_BLOCK(0x21a2, 1);
+    // 21a2: mov $4b6e, r1
+    {
+        src = uint16_t(0x4b6e);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x21a6, L21a6);
+L21a6:
+    AOT_BLOCK(0x21a6, 2);
+    // 21a6: mov (r1)+, r2
+    {
+        a = r[1];
+        r[1] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21a8: bne 21b0
+    if (!Z)
+        AOT_GOTO(0x21b0, L21b0);
+    AOT_GOTO(0x21aa, L21aa);
+L21aa:
+    AOT_BLOCK(0x21aa, 2);
+    // 21aa: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 21ac: jmp 22f6
+    {
+        a = 0x22f6;
+    }
+    AOT_GOTO(0x22f6, L22f6);
+L21b0:
+    AOT_BLOCK(0x21b0, 2);
+    // 21b0: cmp r0, (r1)+
+    {
+        src = r[0];
+        b = r[1];
+        r[1] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 21b2: bne 21a6
+    if (!Z)
+        AOT_GOTO(0x21a6, L21a6);
+    AOT_GOTO(0x21b4, L21b4);
+L21b4:
+    AOT_BLOCK(0x21b4, 1);
+    // 21b4: jmp (r2)
+    {
+        a = r[2];
+    }
+    AOT_JUMP(a);
+L21b6:
+    AOT_BLOCK(0x21b6, 3);
+    // 21b6: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 21ba: mov -e(r5), r2
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21be: jsr pc, 235a
+    {
+        a = 0x235a;
+        r[6] -= 2;
+        WR16(r[6], 0x21c2);
+    }
+    AOT_GOTO(0x235a, L235a);
+L21c2:
+    AOT_BLOCK(0x21c2, 1);
+    // 21c2: jmp *$22f6
+    {
+        a = 0x22f6;
+    }
+    AOT_GOTO(0x22f6, L22f6);
+L21c6:
+    AOT_BLOCK(0x21c6, 4);
+    // 21c6: movb *-a(r5), r0
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 21ca: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 21ce: cmp r0, $6f
+    {
+        src = r[0];
+        dst = uint16_t(0x006f);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 21d2: beq 21f0
+    if (Z)
+        AOT_GOTO(0x21f0, L21f0);
+    AOT_GOTO(0x21d4, L21d4);
+L21d4:
+    AOT_BLOCK(0x21d4, 2);
+    // 21d4: cmp r0, $78
+    {
+        src = r[0];
+        dst = uint16_t(0x0078);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 21d8: beq 21fc
+    if (Z)
+        AOT_GOTO(0x21fc, L21fc);
+    AOT_GOTO(0x21da, L21da);
+L21da:
+    AOT_BLOCK(0x21da, 2);
+    // 21da: cmp r0, $64
+    {
+        src = r[0];
+        dst = uint16_t(0x0064);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 21de: beq 2212
+    if (Z)
+        AOT_GOTO(0x2212, L2212);
+    AOT_GOTO(0x21e0, L21e0);
+L21e0:
+    AOT_BLOCK(0x21e0, 2);
+    // 21e0: cmp r0, $75
+    {
+        src = r[0];
+        dst = uint16_t(0x0075);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 21e4: beq 2224
+    if (Z)
+        AOT_GOTO(0x2224, L2224);
+    AOT_GOTO(0x21e6, L21e6);
+L21e6:
+    AOT_BLOCK(0x21e6, 2);
+    // 21e6: dec -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 21ea: br 220e
+    AOT_GOTO(0x220e, L220e);
+L21ec:
+    AOT_BLOCK(0x21ec, 2);
+    // 21ec: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 21ee: br 21f2
+    AOT_GOTO(0x21f2, L21f2);
+L21f0:
+    AOT_BLOCK(0x21f0, 1);
+    // 21f0: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x21f2, L21f2);
+L21f2:
+    AOT_BLOCK(0x21f2, 2);
+    // 21f2: mov $8, r2
+    {
+        src = uint16_t(0x0008);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 21f6: br 2202
+    AOT_GOTO(0x2202, L2202);
+L21f8:
+    AOT_BLOCK(0x21f8, 2);
+    // 21f8: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 21fa: br 21fe
+    AOT_GOTO(0x21fe, L21fe);
+L21fc:
+    AOT_BLOCK(0x21fc, 1);
+    // 21fc: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x21fe, L21fe);
+L21fe:
+    AOT_BLOCK(0x21fe, 1);
+    // 21fe: mov $10, r2
+    {
+        src = uint16_t(0x0010);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2202, L2202);
+L2202:
+    AOT_BLOCK(0x2202, 2);
+    // 2202: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2204: br 222c
+    AOT_GOTO(0x222c, L222c);
+L2206:
+    AOT_BLOCK(0x2206, 3);
+    // 2206: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2208: sxt r0
+    {
+        r[0] = -int(N);
+        Z = !N;
+    }
+    // 220a: bmi 2218
+    if (N)
+        AOT_GOTO(0x2218, L2218);
+    AOT_GOTO(0x220c, L220c);
+L220c:
+    AOT_BLOCK(0x220c, 1);
+    // 220c: br 2228
+    AOT_GOTO(0x2228, L2228);
+L220e:
+    AOT_BLOCK(0x220e, 2);
+    // 220e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2210: br 2226
+    AOT_GOTO(0x2226, L2226);
+L2212:
+    AOT_BLOCK(0x2212, 2);
+    // 2212: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2214: bge 2226
+    if (!(N ^ V))
+        AOT_GOTO(0x2226, L2226);
+    AOT_GOTO(0x2216, L2216);
+L2216:
+    AOT_BLOCK(0x2216, 1);
+    // 2216: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2218, L2218);
+L2218:
+    AOT_BLOCK(0x2218, 5);
+    // 2218: neg r0
+    {
+        val = -int16_t(r[0]);
+        r[0] = val;
+    }
+    // 221a: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        C = val != 0;
+    }
+    // 221c: sbc r0
+    {
+        val = int(int16_t(r[0])) - int(C);
+        r[0] = val;
+        C = C && val == -1;
+    }
+    // 221e: movb $2d, (r3)+
+    {
+        src = uint8_t(0x2d);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 2222: br 2228
+    AOT_GOTO(0x2228, L2228);
+L2224:
+    AOT_BLOCK(0x2224, 1);
+    // 2224: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2226, L2226);
+L2226:
+    AOT_BLOCK(0x2226, 1);
+    // 2226: mov (r4)+, r1
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2228, L2228);
+L2228:
+    AOT_BLOCK(0x2228, 1);
+    // 2228: mov $a, r2
+    {
+        src = uint16_t(0x000a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x222c, L222c);
+L222c:
+    AOT_BLOCK(0x222c, 7);
+    // 222c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 222e: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2230: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 2232: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2236: mov r1, r5
+    {
+        src = r[1];
+        r[5] = src;
+    }
+    // 2238: ashc $0, r4
+    {
+        src = uint16_t(0x0000) & 077;
+        val = int32_t((uint32_t(r[4]) << 16) | r[5]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[4] = uint32_t(val2) >> 16;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[4] = uint32_t(val2) >> 16;
+        r[5] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 223c: beq 2246
+    if (Z)
+        AOT_GOTO(0x2246, L2246);
+    AOT_GOTO(0x223e, L223e);
+L223e:
+    AOT_BLOCK(0x223e, 2);
+    // 223e: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2240: beq 2246
+    if (Z)
+        AOT_GOTO(0x2246, L2246);
+    AOT_GOTO(0x2242, L2242);
+L2242:
+    AOT_BLOCK(0x2242, 1);
+    // 2242: movb $30, (r3)+
+    {
+        src = uint8_t(0x30);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2246, L2246);
+L2246:
+    AOT_BLOCK(0x2246, 1);
+    // 2246: jsr pc, 2250
+    {
+        a = 0x2250;
+        r[6] -= 2;
+        WR16(r[6], 0x224a);
+    }
+    AOT_GOTO(0x2250, L2250);
+L224a:
+    AOT_BLOCK(0x224a, 3);
+    // 224a: mov (sp)+, r4
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 224c: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 224e: br 22f6
+    AOT_GOTO(0x22f6, L22f6);
+L2250:
+    AOT_BLOCK(0x2250, 3);
+    // 2250: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 2252: mov r4, r1
+    {
+        src = r[4];
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2254: beq 225c
+    if (Z)
+        AOT_GOTO(0x225c, L225c);
+    AOT_GOTO(0x2256, L2256);
+L2256:
+    AOT_BLOCK(0x2256, 3);
+    // 2256: div r2, r0
+    {
+        src = int16_t(r[2]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2258: mov r0, r4
+    {
+        src = r[0];
+        r[4] = src;
+    }
+    // 225a: mov r1, r0
+    {
+        src = r[1];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x225c, L225c);
+L225c:
+    AOT_BLOCK(0x225c, 7);
+    // 225c: mov r5, r1
+    {
+        src = r[5];
+        r[1] = src;
+    }
+    // 225e: asl r2
+    {
+        src = r[2];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[2] = val;
+    }
+    // 2260: div r2, r0
+    {
+        src = int16_t(r[2]);
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 2262: asr r2
+    {
+        src = r[2];
+        val = int16_t(src) >> 1;
+        r[2] = val;
+    }
+    // 2264: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2266: cmp r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2268: bgt 226e
+    if (!(Z || (N ^ V)))
+        AOT_GOTO(0x226e, L226e);
+    AOT_GOTO(0x226a, L226a);
+L226a:
+    AOT_BLOCK(0x226a, 2);
+    // 226a: sub r2, r1
+    {
+        src = r[2];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        C = dst < src;
+    }
+    // 226c: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x226e, L226e);
+L226e:
+    AOT_BLOCK(0x226e, 3);
+    // 226e: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2270: mov r0, r5
+    {
+        src = r[0];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2272: bne 2278
+    if (!Z)
+        AOT_GOTO(0x2278, L2278);
+    AOT_GOTO(0x2274, L2274);
+L2274:
+    AOT_BLOCK(0x2274, 2);
+    // 2274: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2276: beq 227c
+    if (Z)
+        AOT_GOTO(0x227c, L227c);
+    AOT_GOTO(0x2278, L2278);
+L2278:
+    AOT_BLOCK(0x2278, 1);
+    // 2278: jsr pc, 2250
+    {
+        a = 0x2250;
+        r[6] -= 2;
+        WR16(r[6], 0x227c);
+    }
+    AOT_GOTO(0x2250, L2250);
+L227c:
+    AOT_BLOCK(0x227c, 4);
+    // 227c: mov (sp)+, r0
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 227e: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2282: cmp r0, $39
+    {
+        src = r[0];
+        dst = uint16_t(0x0039);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2286: ble 228c
+    if (Z || (N ^ V))
+        AOT_GOTO(0x228c, L228c);
+    AOT_GOTO(0x2288, L2288);
+L2288:
+    AOT_BLOCK(0x2288, 1);
+    // 2288: add $27, r0
+    {
+        src = uint16_t(0x0027);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x228c, L228c);
+L228c:
+    AOT_BLOCK(0x228c, 2);
+    // 228c: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 228e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2290:
+    AOT_BLOCK(0x2290, 4);
+    // 2290: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 2296: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2298: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 229c: beq 22f6
+    if (Z)
+        AOT_GOTO(0x22f6, L22f6);
+    AOT_GOTO(0x229e, L229e);
+L229e:
+    AOT_BLOCK(0x229e, 2);
+    // 229e: movb r0, (r3)+
+    {
+        src = uint8_t(r[0]);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 22a0: br 22f6
+    AOT_GOTO(0x22f6, L22f6);
+L22a2:
+    AOT_BLOCK(0x22a2, 5);
+    // 22a2: mov $20, -12(r5)
+    {
+        src = uint16_t(0x0020);
+        b = uint16_t(r[5] + -18);
+        WR16(b, src);
+    }
+    // 22a8: mov -10(r5), r1
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 22ac: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 22ae: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22b0: bne 22ba
+    if (!Z)
+        AOT_GOTO(0x22ba, L22ba);
+    AOT_GOTO(0x22b2, L22b2);
+L22b2:
+    AOT_BLOCK(0x22b2, 3);
+    // 22b2: mov $4bb2, r2
+    {
+        src = uint16_t(0x4bb2);
+        r[2] = src;
+    }
+    // 22b6: mov r2, r3
+    {
+        src = r[2];
+        r[3] = src;
+    }
+    // 22b8: mov r2, (r4)
+    {
+        src = r[2];
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x22ba, L22ba);
+L22ba:
+    AOT_BLOCK(0x22ba, 2);
+    // 22ba: tstb (r2)+
+    {
+        a = r[2];
+        r[2] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 22bc: beq 22c2
+    if (Z)
+        AOT_GOTO(0x22c2, L22c2);
+    AOT_GOTO(0x22be, L22be);
+L22be:
+    AOT_BLOCK(0x22be, 2);
+    // 22be: inc r3
+    {
+        val = int(int16_t(r[3])) + 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 22c0: sob r1, 4
+    {
+        r[1]--;
+    }
+    if (r[1] != 0)
+        AOT_GOTO(0x22ba, L22ba);
+    AOT_GOTO(0x22c2, L22c2);
+L22c2:
+    AOT_BLOCK(0x22c2, 2);
+    // 22c2: mov (r4)+, r2
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22c4: br 22f8
+    AOT_GOTO(0x22f8, L22f8);
+L22c6:
+    AOT_BLOCK(0x22c6, 3);
+    // 22c6: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 22ca: mov -e(r5), r2
+    {
+        a = uint16_t(r[5] + -14);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22ce: jsr pc, 235a
+    {
+        a = 0x235a;
+        r[6] -= 2;
+        WR16(r[6], 0x22d2);
+    }
+    AOT_GOTO(0x235a, L235a);
+L22d2:
+    AOT_BLOCK(0x22d2, 1);
+    // 22d2: br 22f6
+    AOT_GOTO(0x22f6, L22f6);
+L22d4:
+    AOT_BLOCK(0x22d4, 4);
+    // 22d4: mov -10(r5), r0
+    {
+        a = uint16_t(r[5] + -16);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 22d8: inc r0
+    {
+        val = int(int16_t(r[0])) + 1;
+        r[0] = val;
+    }
+    // 22da: tst -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 22de: bne 22e4
+    if (!Z)
+        AOT_GOTO(0x22e4, L22e4);
+    AOT_GOTO(0x22e0, L22e0);
+L22e0:
+    AOT_BLOCK(0x22e0, 1);
+    // 22e0: mov $7, r0
+    {
+        src = uint16_t(0x0007);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x22e4, L22e4);
+L22e4:
+    AOT_BLOCK(0x22e4, 2);
+    // 22e4: mov pc, r2
+    {
+        src = uint16_t(0x22e6);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22e6: jsr pc, 235a
+    {
+        a = 0x235a;
+        r[6] -= 2;
+        WR16(r[6], 0x22ea);
+    }
+    AOT_GOTO(0x235a, L235a);
+L22ea:
+    AOT_BLOCK(0x22ea, 1);
+    // 22ea: br 22f6
+    AOT_GOTO(0x22f6, L22f6);
+L22ec:
+    AOT_BLOCK(0x22ec, 3);
+    // 22ec: mov (r4)+, r4
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 22ee: mov (r4)+, -a(r5)
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        b = uint16_t(r[5] + -10);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 22f2: jmp 2120
+    {
+        a = 0x2120;
+    }
+    AOT_GOTO(0x2120, L2120);
+L22f6:
+    AOT_BLOCK(0x22f6, 1);
+    // 22f6: mov sp, r2
+    {
+        src = r[6];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x22f8, L22f8);
+L22f8:
+    AOT_BLOCK(0x22f8, 4);
+    // 22f8: sub r2, r3
+    {
+        src = r[2];
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+    }
+    // 22fa: mov -8(r5), r1
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 22fe: sub r3, r1
+    {
+        src = r[3];
+        dst = r[1];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 2300: bge 2304
+    if (!(N ^ V))
+        AOT_GOTO(0x2304, L2304);
+    AOT_GOTO(0x2302, L2302);
+L2302:
+    AOT_BLOCK(0x2302, 1);
+    // 2302: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2304, L2304);
+L2304:
+    AOT_BLOCK(0x2304, 2);
+    // 2304: tst -c(r5)
+    {
+        a = uint16_t(r[5] + -12);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2308: bne 230c
+    if (!Z)
+        AOT_GOTO(0x230c, L230c);
+    AOT_GOTO(0x230a, L230a);
+L230a:
+    AOT_BLOCK(0x230a, 1);
+    // 230a: neg r1
+    {
+        val = -int16_t(r[1]);
+        r[1] = val;
+        Z = val == 0;
+        N = val < 0;
+        C = val != 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x230c, L230c);
+L230c:
+    AOT_BLOCK(0x230c, 6);
+    // 230c: mov -12(r5), -(sp)
+    {
+        a = uint16_t(r[5] + -18);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2310: mov 8(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2314: mov r1, -(sp)
+    {
+        src = r[1];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2316: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2318: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 231a: jsr pc, 2364
+    {
+        a = 0x2364;
+        r[6] -= 2;
+        WR16(r[6], 0x231e);
+    }
+    AOT_GOTO(0x2364, L2364);
+L231e:
+    AOT_BLOCK(0x231e, 2);
+    // 231e: add $a, sp
+    {
+        src = uint16_t(0x000a);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2322: jmp 2120
+    {
+        a = 0x2120;
+    }
+    AOT_GOTO(0x2120, L2120);
+L2326:
+    AOT_BLOCK(0x2326, 2);
+    // 2326: clr -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        WR16(a, 0);
+    }
+    // 232a: clr r1
+    {
+        r[1] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x232c, L232c);
+L232c:
+    AOT_BLOCK(0x232c, 5);
+    // 232c: movb *-a(r5), r0
+    {
+        a = RD16(r[5] + -10);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2330: inc -a(r5)
+    {
+        a = uint16_t(r[5] + -10);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 2334: sub $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+    }
+    // 2338: cmp r0, $fffa
+    {
+        src = r[0];
+        dst = uint16_t(0xfffa);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 233c: bne 2342
+    if (!Z)
+        AOT_GOTO(0x2342, L2342);
+    AOT_GOTO(0x233e, L233e);
+L233e:
+    AOT_BLOCK(0x233e, 2);
+    // 233e: mov (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 2;
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2340: br 2348
+    AOT_GOTO(0x2348, L2348);
+L2342:
+    AOT_BLOCK(0x2342, 2);
+    // 2342: cmp r0, $9
+    {
+        src = r[0];
+        dst = uint16_t(0x0009);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2346: bhi 2354
+    if (!(C | Z))
+        AOT_GOTO(0x2354, L2354);
+    AOT_GOTO(0x2348, L2348);
+L2348:
+    AOT_BLOCK(0x2348, 4);
+    // 2348: inc -e(r5)
+    {
+        a = uint16_t(r[5] + -14);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 234c: mul $a, r1
+    {
+        src = int16_t(uint16_t(0x000a));
+        val = int(r[1]) * src;
+        r[1] = val;
+    }
+    // 2350: add r0, r1
+    {
+        src = r[0];
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2352: br 232c
+    AOT_GOTO(0x232c, L232c);
+L2354:
+    AOT_BLOCK(0x2354, 2);
+    // 2354: add $30, r0
+    {
+        src = uint16_t(0x0030);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2358: rts r3
+    {
+        b = r[3];
+        r[3] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L235a:
+    AOT_BLOCK(0x235a, 3);
+    // 235a: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 235e: movb $3f, (r3)+
+    {
+        src = uint8_t(0x3f);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 2362: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2364:
+    AOT_BLOCK(0x2364, 6);
+    // 2364: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2368;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 2368: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 236c: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 2370: mov a(r5), r2
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2374: br 23a8
+    AOT_GOTO(0x23a8, L23a8);
+L2376:
+    AOT_BLOCK(0x2376, 5);
+    // 2376: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2378: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 237a: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 237c: bic $ff00, (sp)
+    {
+        src = uint16_t(0xff00);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2380: jsr pc, *$2424
+    {
+        a = 0x2424;
+        r[6] -= 2;
+        WR16(r[6], 0x2384);
+    }
+    AOT_GOTO(0x2424, L2424);
+L2384:
+    AOT_BLOCK(0x2384, 1);
+    // 2384: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2386, L2386);
+L2386:
+    AOT_BLOCK(0x2386, 1);
+    // 2386: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x2388, L2388);
+L2388:
+    AOT_BLOCK(0x2388, 2);
+    // 2388: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 238c: blt 2398
+    if (N ^ V)
+        AOT_GOTO(0x2398, L2398);
+    AOT_GOTO(0x238e, L238e);
+L238e:
+    AOT_BLOCK(0x238e, 3);
+    // 238e: movb c(r5), *0(r2)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD8(a);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 2394: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 2396: br 23a4
+    AOT_GOTO(0x23a4, L23a4);
+L2398:
+    AOT_BLOCK(0x2398, 3);
+    // 2398: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 239a: mov c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 239e: jsr pc, *$2424
+    {
+        a = 0x2424;
+        r[6] -= 2;
+        WR16(r[6], 0x23a2);
+    }
+    AOT_GOTO(0x2424, L2424);
+L23a2:
+    AOT_BLOCK(0x23a2, 1);
+    // 23a2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x23a4, L23a4);
+L23a4:
+    AOT_BLOCK(0x23a4, 1);
+    // 23a4: inc 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    AOT_GOTO(0x23a8, L23a8);
+L23a8:
+    AOT_BLOCK(0x23a8, 2);
+    // 23a8: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 23ac: bge 23f4
+    if (!(N ^ V))
+        AOT_GOTO(0x23f4, L23f4);
+    AOT_GOTO(0x23ae, L23ae);
+L23ae:
+    AOT_BLOCK(0x23ae, 2);
+    // 23ae: cmpb $2d, (r4)
+    {
+        src = uint8_t(0x2d);
+        b = r[4];
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 23b2: bne 2388
+    if (!Z)
+        AOT_GOTO(0x2388, L2388);
+    AOT_GOTO(0x23b4, L23b4);
+L23b4:
+    AOT_BLOCK(0x23b4, 2);
+    // 23b4: cmp $30, c(r5)
+    {
+        src = uint16_t(0x0030);
+        b = uint16_t(r[5] + 12);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 23ba: bne 2388
+    if (!Z)
+        AOT_GOTO(0x2388, L2388);
+    AOT_GOTO(0x23bc, L23bc);
+L23bc:
+    AOT_BLOCK(0x23bc, 2);
+    // 23bc: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 23c0: blt 2376
+    if (N ^ V)
+        AOT_GOTO(0x2376, L2376);
+    AOT_GOTO(0x23c2, L23c2);
+L23c2:
+    AOT_BLOCK(0x23c2, 5);
+    // 23c2: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 23c4: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 23c8: movb r0, *0(r2)
+    {
+        src = uint8_t(r[0]);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 23cc: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 23ce: br 2386
+    AOT_GOTO(0x2386, L2386);
+L23d0:
+    AOT_BLOCK(0x23d0, 5);
+    // 23d0: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 23d2: bic $ff00, r0
+    {
+        src = uint16_t(0xff00);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 23d6: movb r0, *0(r2)
+    {
+        src = uint8_t(r[0]);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 23da: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 23dc: br 23f4
+    AOT_GOTO(0x23f4, L23f4);
+L23de:
+    AOT_BLOCK(0x23de, 2);
+    // 23de: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 23e2: bge 23d0
+    if (!(N ^ V))
+        AOT_GOTO(0x23d0, L23d0);
+    AOT_GOTO(0x23e4, L23e4);
+L23e4:
+    AOT_BLOCK(0x23e4, 5);
+    // 23e4: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 23e6: movb (r4)+, r0
+    {
+        a = r[4];
+        r[4] += 1;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 23e8: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 23ea: bic $ff00, (sp)
+    {
+        src = uint16_t(0xff00);
+        b = r[6];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 23ee: jsr pc, *$2424
+    {
+        a = 0x2424;
+        r[6] -= 2;
+        WR16(r[6], 0x23f2);
+    }
+    AOT_GOTO(0x2424, L2424);
+L23f2:
+    AOT_BLOCK(0x23f2, 1);
+    // 23f2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x23f4, L23f4);
+L23f4:
+    AOT_BLOCK(0x23f4, 2);
+    // 23f4: dec r3
+    {
+        val = int(int16_t(r[3])) - 1;
+        r[3] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 23f6: bge 23de
+    if (!(N ^ V))
+        AOT_GOTO(0x23de, L23de);
+    AOT_GOTO(0x23f8, L23f8);
+L23f8:
+    AOT_BLOCK(0x23f8, 1);
+    // 23f8: br 241a
+    AOT_GOTO(0x241a, L241a);
+L23fa:
+    AOT_BLOCK(0x23fa, 2);
+    // 23fa: dec 2(r2)
+    {
+        a = uint16_t(r[2] + 2);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    // 23fe: blt 240a
+    if (N ^ V)
+        AOT_GOTO(0x240a, L240a);
+    AOT_GOTO(0x2400, L2400);
+L2400:
+    AOT_BLOCK(0x2400, 3);
+    // 2400: movb c(r5), *0(r2)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD8(a);
+        b = RD16(r[2] + 0);
+        WR8(b, src);
+    }
+    // 2406: inc (r2)
+    {
+        a = r[2];
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == 0x8000;
+    }
+    // 2408: br 2416
+    AOT_GOTO(0x2416, L2416);
+L240a:
+    AOT_BLOCK(0x240a, 3);
+    // 240a: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 240c: mov c(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 12);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2410: jsr pc, *$2424
+    {
+        a = 0x2424;
+        r[6] -= 2;
+        WR16(r[6], 0x2414);
+    }
+    AOT_GOTO(0x2424, L2424);
+L2414:
+    AOT_BLOCK(0x2414, 1);
+    // 2414: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2416, L2416);
+L2416:
+    AOT_BLOCK(0x2416, 1);
+    // 2416: dec 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int(int16_t(RD16(a))) - 1;
+        WR16(a, val);
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x241a, L241a);
+L241a:
+    AOT_BLOCK(0x241a, 2);
+    // 241a: tst 8(r5)
+    {
+        a = uint16_t(r[5] + 8);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 241e: bne 23fa
+    if (!Z)
+        AOT_GOTO(0x23fa, L23fa);
+    AOT_GOTO(0x2420, L2420);
+L2420:
+    AOT_BLOCK(0x2420, 2);
+    // 2420: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2424:
+    AOT_BLOCK(0x2424, 6);
+    // 2424: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2428;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 2428: mov 6(r5), r4
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 242c: sub $4, sp
+    {
+        src = uint16_t(0x0004);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+        C = dst < src;
+    }
+    // 2430: bitb $80, 6(r4)
+    {
+        src = uint8_t(0x80);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2436: beq 2444
+    if (Z)
+        AOT_GOTO(0x2444, L2444);
+    AOT_GOTO(0x2438, L2438);
+L2438:
+    AOT_BLOCK(0x2438, 2);
+    // 2438: bisb $2, 6(r4)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 243e: bicb $10, 6(r4)
+    {
+        src = uint8_t(0x10);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2444, L2444);
+L2444:
+    AOT_BLOCK(0x2444, 2);
+    // 2444: bitb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 244a: beq 2476
+    if (Z)
+        AOT_GOTO(0x2476, L2476);
+    AOT_GOTO(0x244c, L244c);
+L244c:
+    AOT_BLOCK(0x244c, 8);
+    // 244c: movb 4(r5), -a(r5)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = uint16_t(r[5] + -10);
+        WR8(b, src);
+    }
+    // 2452: mov $1, -8(r5)
+    {
+        src = uint16_t(0x0001);
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+    }
+    // 2458: mov -8(r5), (sp)
+    {
+        a = uint16_t(r[5] + -8);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 245c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 245e: add $fff6, (sp)
+    {
+        src = uint16_t(0xfff6);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2462: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2466: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2468: jsr pc, *$2ae6
+    {
+        a = 0x2ae6;
+        r[6] -= 2;
+        WR16(r[6], 0x246c);
+    }
+    AOT_GOTO(0x2ae6, L2ae6);
+L246c:
+    AOT_BLOCK(0x246c, 4);
+    // 246c: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 246e: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+    }
+    // 2470: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2474: br 24ec
+    AOT_GOTO(0x24ec, L24ec);
+L2476:
+    AOT_BLOCK(0x2476, 2);
+    // 2476: mov 4(r4), r3
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 247a: bne 24c2
+    if (!Z)
+        AOT_GOTO(0x24c2, L24c2);
+    AOT_GOTO(0x247c, L247c);
+L247c:
+    AOT_BLOCK(0x247c, 2);
+    // 247c: cmp $4bc2, r4
+    {
+        src = uint16_t(0x4bc2);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2480: bne 24a4
+    if (!Z)
+        AOT_GOTO(0x24a4, L24a4);
+    AOT_GOTO(0x2482, L2482);
+L2482:
+    AOT_BLOCK(0x2482, 3);
+    // 2482: movb 4bc9, r0
+    {
+        a = 0x4bc9;
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2486: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2488: jsr pc, *$2922
+    {
+        a = 0x2922;
+        r[6] -= 2;
+        WR16(r[6], 0x248c);
+    }
+    AOT_GOTO(0x2922, L2922);
+L248c:
+    AOT_BLOCK(0x248c, 2);
+    // 248c: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 248e: beq 2498
+    if (Z)
+        AOT_GOTO(0x2498, L2498);
+    AOT_GOTO(0x2490, L2490);
+L2490:
+    AOT_BLOCK(0x2490, 2);
+    // 2490: bisb $4, 6(r4)
+    {
+        src = uint8_t(0x04);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2496: br 2444
+    AOT_GOTO(0x2444, L2444);
+L2498:
+    AOT_BLOCK(0x2498, 3);
+    // 2498: mov $8b2e, 4(r4)
+    {
+        src = uint16_t(0x8b2e);
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+    }
+    // 249e: mov $8b2e, (r4)
+    {
+        src = uint16_t(0x8b2e);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24a2: br 2444
+    AOT_GOTO(0x2444, L2444);
+L24a4:
+    AOT_BLOCK(0x24a4, 2);
+    // 24a4: mov $200, (sp)
+    {
+        src = uint16_t(0x0200);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24a8: jsr pc, *$2720
+    {
+        a = 0x2720;
+        r[6] -= 2;
+        WR16(r[6], 0x24ac);
+    }
+    AOT_GOTO(0x2720, L2720);
+L24ac:
+    AOT_BLOCK(0x24ac, 3);
+    // 24ac: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 24ae: mov r3, 4(r4)
+    {
+        src = r[3];
+        b = uint16_t(r[4] + 4);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24b2: beq 2490
+    if (Z)
+        AOT_GOTO(0x2490, L2490);
+    AOT_GOTO(0x24b4, L24b4);
+L24b4:
+    AOT_BLOCK(0x24b4, 4);
+    // 24b4: bisb $8, 6(r4)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 24ba: clr r2
+    {
+        r[2] = 0;
+        C = false;
+    }
+    // 24bc: mov r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24c0: br 24e0
+    AOT_GOTO(0x24e0, L24e0);
+L24c2:
+    AOT_BLOCK(0x24c2, 4);
+    // 24c2: mov (r4), r2
+    {
+        a = r[4];
+        src = RD16(a);
+        r[2] = src;
+    }
+    // 24c4: sub r3, r2
+    {
+        src = r[3];
+        dst = r[2];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[2] = val16;
+        C = dst < src;
+    }
+    // 24c6: mov r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24ca: ble 24e0
+    if (Z || (N ^ V))
+        AOT_GOTO(0x24e0, L24e0);
+    AOT_GOTO(0x24cc, L24cc);
+L24cc:
+    AOT_BLOCK(0x24cc, 6);
+    // 24cc: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 24ce: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 24d0: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 24d2: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 24d6: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 24d8: jsr pc, *$2ae6
+    {
+        a = 0x2ae6;
+        r[6] -= 2;
+        WR16(r[6], 0x24dc);
+    }
+    AOT_GOTO(0x2ae6, L2ae6);
+L24dc:
+    AOT_BLOCK(0x24dc, 2);
+    // 24dc: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 24de: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x24e0, L24e0);
+L24e0:
+    AOT_BLOCK(0x24e0, 3);
+    // 24e0: mov $1ff, 2(r4)
+    {
+        src = uint16_t(0x01ff);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 24e6: movb 4(r5), (r3)+
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        WR8(b, src);
+    }
+    // 24ea: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x24ec, L24ec);
+L24ec:
+    AOT_BLOCK(0x24ec, 2);
+    // 24ec: cmp r2, -8(r5)
+    {
+        src = r[2];
+        b = uint16_t(r[5] + -8);
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 24f0: beq 2500
+    if (Z)
+        AOT_GOTO(0x2500, L2500);
+    AOT_GOTO(0x24f2, L24f2);
+L24f2:
+    AOT_BLOCK(0x24f2, 2);
+    // 24f2: bisb $20, 6(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 24f8: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x24fc, L24fc);
+L24fc:
+    AOT_BLOCK(0x24fc, 2);
+    // 24fc: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2500:
+    AOT_BLOCK(0x2500, 2);
+    // 2500: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2504: br 24fc
+    AOT_GOTO(0x24fc, L24fc);
+L2506:
+    AOT_BLOCK(0x2506, 7);
+    // 2506: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x250a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 250a: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 250e: movb 6(r4), r0
+    {
+        a = uint16_t(r[4] + 6);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 2512: bic $fff9, r0
+    {
+        src = uint16_t(0xfff9);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2516: cmp $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 251a: bne 2554
+    if (!Z)
+        AOT_GOTO(0x2554, L2554);
+    AOT_GOTO(0x251c, L251c);
+L251c:
+    AOT_BLOCK(0x251c, 1);
+    // 251c: mov 4(r4), r3
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2520, L2520);
+L2520:
+    AOT_BLOCK(0x2520, 1);
+    // 2520: beq 2554
+    if (Z)
+        AOT_GOTO(0x2554, L2554);
+    AOT_GOTO(0x2522, L2522);
+L2522:
+    AOT_BLOCK(0x2522, 3);
+    // 2522: mov (r4), r0
+    {
+        a = r[4];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2524: sub r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        C = dst < src;
+    }
+    // 2526: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2528, L2528);
+L2528:
+    AOT_BLOCK(0x2528, 1);
+    // 2528: ble 2554
+    if (Z || (N ^ V))
+        AOT_GOTO(0x2554, L2554);
+    AOT_GOTO(0x252a, L252a);
+L252a:
+    AOT_BLOCK(0x252a, 7);
+    // 252a: mov r3, (r4)
+    {
+        src = r[3];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 252c: mov $200, 2(r4)
+    {
+        src = uint16_t(0x0200);
+        b = uint16_t(r[4] + 2);
+        WR16(b, src);
+    }
+    // 2532: mov r2, (sp)
+    {
+        src = r[2];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2534: mov r3, -(sp)
+    {
+        src = r[3];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2536: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 253a: mov r0, -(sp)
+    {
+        src = r[0];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 253c: jsr pc, *$2ae6
+    {
+        a = 0x2ae6;
+        r[6] -= 2;
+        WR16(r[6], 0x2540);
+    }
+    AOT_GOTO(0x2ae6, L2ae6);
+L2540:
+    AOT_BLOCK(0x2540, 3);
+    // 2540: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+    }
+    // 2542: cmp r2, r0
+    {
+        src = r[2];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2544: beq 2554
+    if (Z)
+        AOT_GOTO(0x2554, L2554);
+    AOT_GOTO(0x2546, L2546);
+L2546:
+    AOT_BLOCK(0x2546, 2);
+    // 2546: bisb $20, 6(r4)
+    {
+        src = uint8_t(0x20);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+    }
+    // 254c: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2550, L2550);
+L2550:
+    AOT_BLOCK(0x2550, 2);
+    // 2550: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2554:
+    AOT_BLOCK(0x2554, 2);
+    // 2554: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2556: br 2550
+    AOT_GOTO(0x2550, L2550);
+L2558:
+    AOT_BLOCK(0x2558, 4);
+    // 2558: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x255c;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 255c: mov $4bba, r4
+    {
+        src = uint16_t(0x4bba);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2560: br 256c
+    AOT_GOTO(0x256c, L256c);
+L2562:
+    AOT_BLOCK(0x2562, 2);
+    // 2562: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2564: jsr pc, *$2576
+    {
+        a = 0x2576;
+        r[6] -= 2;
+        WR16(r[6], 0x2568);
+    }
+    AOT_GOTO(0x2576, L2576);
+L2568:
+    AOT_BLOCK(0x2568, 1);
+    // 2568: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x256c, L256c);
+L256c:
+    AOT_BLOCK(0x256c, 2);
+    // 256c: cmp 4c5a, r4
+    {
+        a = 0x4c5a;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2570: bhi 2562
+    if (!(C | Z))
+        AOT_GOTO(0x2562, L2562);
+    AOT_GOTO(0x2572, L2572);
+L2572:
+    AOT_BLOCK(0x2572, 2);
+    // 2572: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2576:
+    AOT_BLOCK(0x2576, 6);
+    // 2576: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x257a;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 257a: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 257e: mov $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        r[3] = src;
+    }
+    // 2582: bitb $83, 6(r4)
+    {
+        src = uint8_t(0x83);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2588: beq 25c8
+    if (Z)
+        AOT_GOTO(0x25c8, L25c8);
+    AOT_GOTO(0x258a, L258a);
+L258a:
+    AOT_BLOCK(0x258a, 2);
+    // 258a: bitb $40, 6(r4)
+    {
+        src = uint8_t(0x40);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2590: bne 25c8
+    if (!Z)
+        AOT_GOTO(0x25c8, L25c8);
+    AOT_GOTO(0x2592, L2592);
+L2592:
+    AOT_BLOCK(0x2592, 2);
+    // 2592: mov r4, (sp)
+    {
+        src = r[4];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2594: jsr pc, *$2506
+    {
+        a = 0x2506;
+        r[6] -= 2;
+        WR16(r[6], 0x2598);
+    }
+    AOT_GOTO(0x2506, L2506);
+L2598:
+    AOT_BLOCK(0x2598, 4);
+    // 2598: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 259a: movb 7(r4), r0
+    {
+        a = uint16_t(r[4] + 7);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 259e: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25a0: jsr pc, *$29d6
+    {
+        a = 0x29d6;
+        r[6] -= 2;
+        WR16(r[6], 0x25a4);
+    }
+    AOT_GOTO(0x29d6, L29d6);
+L25a4:
+    AOT_BLOCK(0x25a4, 2);
+    // 25a4: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 25a6: bge 25ac
+    if (!(N ^ V))
+        AOT_GOTO(0x25ac, L25ac);
+    AOT_GOTO(0x25a8, L25a8);
+L25a8:
+    AOT_BLOCK(0x25a8, 1);
+    // 25a8: mov $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x25ac, L25ac);
+L25ac:
+    AOT_BLOCK(0x25ac, 2);
+    // 25ac: bitb $8, 6(r4)
+    {
+        src = uint8_t(0x08);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 25b2: beq 25bc
+    if (Z)
+        AOT_GOTO(0x25bc, L25bc);
+    AOT_GOTO(0x25b4, L25b4);
+L25b4:
+    AOT_BLOCK(0x25b4, 2);
+    // 25b4: mov 4(r4), (sp)
+    {
+        a = uint16_t(r[4] + 4);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25b8: jsr pc, *$285a
+    {
+        a = 0x285a;
+        r[6] -= 2;
+        WR16(r[6], 0x25bc);
+    }
+    AOT_GOTO(0x285a, L285a);
+L25bc:
+    AOT_BLOCK(0x25bc, 2);
+    // 25bc: bitb $c, 6(r4)
+    {
+        src = uint8_t(0x0c);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 25c2: beq 25c8
+    if (Z)
+        AOT_GOTO(0x25c8, L25c8);
+    AOT_GOTO(0x25c4, L25c4);
+L25c4:
+    AOT_BLOCK(0x25c4, 1);
+    // 25c4: clr 4(r4)
+    {
+        a = uint16_t(r[4] + 4);
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x25c8, L25c8);
+L25c8:
+    AOT_BLOCK(0x25c8, 5);
+    // 25c8: bicb $ff, 6(r4)
+    {
+        src = uint8_t(0xff);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = (~src) & dst;
+        WR8(b, val);
+    }
+    // 25ce: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+        C = false;
+    }
+    // 25d2: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 25d4: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L25d8:
+    AOT_BLOCK(0x25d8, 5);
+    // 25d8: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x25dc;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 25dc: mov 8(r5), r4
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 25e0: tst r4
+    {
+        val = int16_t(r[4]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 25e2: bne 2602
+    if (!Z)
+        AOT_GOTO(0x2602, L2602);
+    AOT_GOTO(0x25e4, L25e4);
+L25e4:
+    AOT_BLOCK(0x25e4, 1);
+    // 25e4: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x25e6, L25e6);
+L25e6:
+    AOT_BLOCK(0x25e6, 2);
+    // 25e6: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L25ea:
+    AOT_BLOCK(0x25ea, 2);
+    // 25ea: cmp r0, $72
+    {
+        src = r[0];
+        dst = uint16_t(0x0072);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 25ee: beq 2668
+    if (Z)
+        AOT_GOTO(0x2668, L2668);
+    AOT_GOTO(0x25f0, L25f0);
+L25f0:
+    AOT_BLOCK(0x25f0, 2);
+    // 25f0: cmp r0, $77
+    {
+        src = r[0];
+        dst = uint16_t(0x0077);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 25f4: bne 25e4
+    if (!Z)
+        AOT_GOTO(0x25e4, L25e4);
+    AOT_GOTO(0x25f6, L25f6);
+L25f6:
+    AOT_BLOCK(0x25f6, 3);
+    // 25f6: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 25f8: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 25fc: jsr pc, *$26b2
+    {
+        a = 0x26b2;
+        r[6] -= 2;
+        WR16(r[6], 0x2600);
+    }
+    AOT_GOTO(0x26b2, L26b2);
+L2600:
+    AOT_BLOCK(0x2600, 1);
+    // 2600: br 267c
+    AOT_GOTO(0x267c, L267c);
+L2602:
+    AOT_BLOCK(0x2602, 3);
+    // 2602: mov 6(r5), r0
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2606: cmpb $2b, 1(r0)
+    {
+        src = uint8_t(0x2b);
+        b = uint16_t(r[0] + 1);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 260c: beq 2612
+    if (Z)
+        AOT_GOTO(0x2612, L2612);
+    AOT_GOTO(0x260e, L260e);
+L260e:
+    AOT_BLOCK(0x260e, 2);
+    // 260e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2610: br 2616
+    AOT_GOTO(0x2616, L2616);
+L2612:
+    AOT_BLOCK(0x2612, 1);
+    // 2612: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2616, L2616);
+L2616:
+    AOT_BLOCK(0x2616, 4);
+    // 2616: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 2618: movb *6(r5), r0
+    {
+        a = RD16(r[5] + 6);
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 261c: cmp r0, $61
+    {
+        src = r[0];
+        dst = uint16_t(0x0061);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2620: bne 25ea
+    if (!Z)
+        AOT_GOTO(0x25ea, L25ea);
+    AOT_GOTO(0x2622, L2622);
+L2622:
+    AOT_BLOCK(0x2622, 2);
+    // 2622: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2624: beq 262c
+    if (Z)
+        AOT_GOTO(0x262c, L262c);
+    AOT_GOTO(0x2626, L2626);
+L2626:
+    AOT_BLOCK(0x2626, 2);
+    // 2626: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 262a: br 2630
+    AOT_GOTO(0x2630, L2630);
+L262c:
+    AOT_BLOCK(0x262c, 1);
+    // 262c: mov $1, (sp)
+    {
+        src = uint16_t(0x0001);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2630, L2630);
+L2630:
+    AOT_BLOCK(0x2630, 2);
+    // 2630: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2634: jsr pc, *$2a5c
+    {
+        a = 0x2a5c;
+        r[6] -= 2;
+        WR16(r[6], 0x2638);
+    }
+    AOT_GOTO(0x2a5c, L2a5c);
+L2638:
+    AOT_BLOCK(0x2638, 3);
+    // 2638: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 263a: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 263c: bge 2654
+    if (!(N ^ V))
+        AOT_GOTO(0x2654, L2654);
+    AOT_GOTO(0x263e, L263e);
+L263e:
+    AOT_BLOCK(0x263e, 2);
+    // 263e: cmp $2, 8e5e
+    {
+        src = uint16_t(0x0002);
+        b = 0x8e5e;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2644: bne 2654
+    if (!Z)
+        AOT_GOTO(0x2654, L2654);
+    AOT_GOTO(0x2646, L2646);
+L2646:
+    AOT_BLOCK(0x2646, 3);
+    // 2646: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2648: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 264c: jsr pc, *$26b2
+    {
+        a = 0x26b2;
+        r[6] -= 2;
+        WR16(r[6], 0x2650);
+    }
+    AOT_GOTO(0x26b2, L26b2);
+L2650:
+    AOT_BLOCK(0x2650, 2);
+    // 2650: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 2652: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2654, L2654);
+L2654:
+    AOT_BLOCK(0x2654, 5);
+    // 2654: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2658: clr -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, 0);
+        N = false;
+        C = false;
+    }
+    // 265a: sxt -(sp)
+    {
+        r[6] -= 2;
+        a = r[6];
+        WR16(a, -int(N));
+    }
+    // 265c: mov r2, -(sp)
+    {
+        src = r[2];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 265e: jsr pc, *$2a30
+    {
+        a = 0x2a30;
+        r[6] -= 2;
+        WR16(r[6], 0x2662);
+    }
+    AOT_GOTO(0x2a30, L2a30);
+L2662:
+    AOT_BLOCK(0x2662, 2);
+    // 2662: add $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[6] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2666: br 2680
+    AOT_GOTO(0x2680, L2680);
+L2668:
+    AOT_BLOCK(0x2668, 2);
+    // 2668: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 266a: beq 2672
+    if (Z)
+        AOT_GOTO(0x2672, L2672);
+    AOT_GOTO(0x266c, L266c);
+L266c:
+    AOT_BLOCK(0x266c, 2);
+    // 266c: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2670: br 2674
+    AOT_GOTO(0x2674, L2674);
+L2672:
+    AOT_BLOCK(0x2672, 1);
+    // 2672: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2674, L2674);
+L2674:
+    AOT_BLOCK(0x2674, 2);
+    // 2674: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2678: jsr pc, *$2a5c
+    {
+        a = 0x2a5c;
+        r[6] -= 2;
+        WR16(r[6], 0x267c);
+    }
+    AOT_GOTO(0x2a5c, L2a5c);
+L267c:
+    AOT_BLOCK(0x267c, 2);
+    // 267c: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 267e: mov r0, r2
+    {
+        src = r[0];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2680, L2680);
+L2680:
+    AOT_BLOCK(0x2680, 2);
+    // 2680: tst r2
+    {
+        val = int16_t(r[2]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 2682: blt 25e4
+    if (N ^ V)
+        AOT_GOTO(0x25e4, L25e4);
+    AOT_GOTO(0x2684, L2684);
+L2684:
+    AOT_BLOCK(0x2684, 4);
+    // 2684: clr 2(r4)
+    {
+        a = uint16_t(r[4] + 2);
+        WR16(a, 0);
+    }
+    // 2688: movb r2, 7(r4)
+    {
+        src = uint8_t(r[2]);
+        b = uint16_t(r[4] + 7);
+        WR8(b, src);
+    }
+    // 268c: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 268e: beq 2698
+    if (Z)
+        AOT_GOTO(0x2698, L2698);
+    AOT_GOTO(0x2690, L2690);
+L2690:
+    AOT_BLOCK(0x2690, 2);
+    // 2690: bisb $80, 6(r4)
+    {
+        src = uint8_t(0x80);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 2696: br 26ae
+    AOT_GOTO(0x26ae, L26ae);
+L2698:
+    AOT_BLOCK(0x2698, 2);
+    // 2698: cmpb $72, *6(r5)
+    {
+        src = uint8_t(0x72);
+        b = RD16(r[5] + 6);
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 269e: bne 26a8
+    if (!Z)
+        AOT_GOTO(0x26a8, L26a8);
+    AOT_GOTO(0x26a0, L26a0);
+L26a0:
+    AOT_BLOCK(0x26a0, 2);
+    // 26a0: bisb $1, 6(r4)
+    {
+        src = uint8_t(0x01);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 26a6: br 26ae
+    AOT_GOTO(0x26ae, L26ae);
+L26a8:
+    AOT_BLOCK(0x26a8, 1);
+    // 26a8: bisb $2, 6(r4)
+    {
+        src = uint8_t(0x02);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src | dst;
+        WR8(b, val);
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x26ae, L26ae);
+L26ae:
+    AOT_BLOCK(0x26ae, 2);
+    // 26ae: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26b0: br 25e6
+    AOT_GOTO(0x25e6, L25e6);
+L26b2:
+    AOT_BLOCK(0x26b2, 6);
+    // 26b2: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x26b6;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 26b6: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 26ba: mov $1b6, (sp)
+    {
+        src = uint16_t(0x01b6);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 26be: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26c0: jsr pc, *$29ec
+    {
+        a = 0x29ec;
+        r[6] -= 2;
+        WR16(r[6], 0x26c4);
+    }
+    AOT_GOTO(0x29ec, L29ec);
+L26c4:
+    AOT_BLOCK(0x26c4, 4);
+    // 26c4: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 26c6: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 26c8: tst 6(r5)
+    {
+        a = uint16_t(r[5] + 6);
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 26cc: beq 26e6
+    if (Z)
+        AOT_GOTO(0x26e6, L26e6);
+    AOT_GOTO(0x26ce, L26ce);
+L26ce:
+    AOT_BLOCK(0x26ce, 2);
+    // 26ce: tst r3
+    {
+        val = int16_t(r[3]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 26d0: blt 26e6
+    if (N ^ V)
+        AOT_GOTO(0x26e6, L26e6);
+    AOT_GOTO(0x26d2, L26d2);
+L26d2:
+    AOT_BLOCK(0x26d2, 2);
+    // 26d2: mov r3, (sp)
+    {
+        src = r[3];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26d4: jsr pc, *$29d6
+    {
+        a = 0x29d6;
+        r[6] -= 2;
+        WR16(r[6], 0x26d8);
+    }
+    AOT_GOTO(0x29d6, L29d6);
+L26d8:
+    AOT_BLOCK(0x26d8, 3);
+    // 26d8: mov $2, (sp)
+    {
+        src = uint16_t(0x0002);
+        b = r[6];
+        WR16(b, src);
+    }
+    // 26dc: mov r4, -(sp)
+    {
+        src = r[4];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26de: jsr pc, *$2a5c
+    {
+        a = 0x2a5c;
+        r[6] -= 2;
+        WR16(r[6], 0x26e2);
+    }
+    AOT_GOTO(0x2a5c, L2a5c);
+L26e2:
+    AOT_BLOCK(0x26e2, 2);
+    // 26e2: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+        C = false;
+    }
+    // 26e4: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x26e6, L26e6);
+L26e6:
+    AOT_BLOCK(0x26e6, 3);
+    // 26e6: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 26e8: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L26ec:
+    AOT_BLOCK(0x26ec, 4);
+    // 26ec: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x26f0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 26f0: mov $4bba, r4
+    {
+        src = uint16_t(0x4bba);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 26f4: br 2706
+    AOT_GOTO(0x2706, L2706);
+L26f6:
+    AOT_BLOCK(0x26f6, 2);
+    // 26f6: cmp 4c5a, r4
+    {
+        a = 0x4c5a;
+        src = RD16(a);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 26fa: bhi 2702
+    if (!(C | Z))
+        AOT_GOTO(0x2702, L2702);
+    AOT_GOTO(0x26fc, L26fc);
+L26fc:
+    AOT_BLOCK(0x26fc, 1);
+    // 26fc: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x26fe, L26fe);
+L26fe:
+    AOT_BLOCK(0x26fe, 2);
+    // 26fe: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2702:
+    AOT_BLOCK(0x2702, 1);
+    // 2702: add $8, r4
+    {
+        src = uint16_t(0x0008);
+        dst = r[4];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[4] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x2706, L2706);
+L2706:
+    AOT_BLOCK(0x2706, 2);
+    // 2706: bitb $83, 6(r4)
+    {
+        src = uint8_t(0x83);
+        b = uint16_t(r[4] + 6);
+        dst = RD8(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x80) != 0;
+        V = false;
+    }
+    // 270c: bne 26f6
+    if (!Z)
+        AOT_GOTO(0x26f6, L26f6);
+    AOT_GOTO(0x270e, L270e);
+L2708:
+    AOT_BLOCK(0x2708, 1);
+    // 2708: rts r3
+    {
+        b = r[3];
+        r[3] = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L270e:
+    AOT_BLOCK(0x270e, 2);
+    // 270e: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2710: br 26fe
+    AOT_GOTO(0x26fe, L26fe);
+L2712:
+    AOT_BLOCK(0x2712, 3);
+    // 2712: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2714: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2716: jsr pc, 2558
+    {
+        a = 0x2558;
+        r[6] -= 2;
+        WR16(r[6], 0x271a);
+    }
+    AOT_GOTO(0x2558, L2558);
+L271a:
+    AOT_BLOCK(0x271a, 1);
+    // 271a: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 271e: sys 1
+    AOT_INTERP(0x271e);
+L2720:
+    AOT_BLOCK(0x2720, 2);
+    // 2720: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2724;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    AOT_GOTO(0x2724, L2724);
+L2722:
+    AOT_BLOCK(0x2722, 1);
+    // 2722: beq 2708
+    if (Z)
+        AOT_GOTO(0x2708, L2708);
+    AOT_GOTO(0x2724, L2724);
+L2724:
+    AOT_BLOCK(0x2724, 1);
+    // 2724: tst 9062
+    {
+        a = 0x9062;
+        val = int16_t(RD16(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2728, L2728);
+L2726:
+    AOT_BLOCK(0x2726, 1);
+    // 2726: add -(r4), *212(r2)
+    {
+        r[4] -= 2;
+        a = r[4];
+        src = RD16(a);
+        b = RD16(r[2] + 530);
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    AOT_GOTO(0x272a, L272a);
+L2728:
+    AOT_BLOCK(0x2728, 1);
+    // 2728: bne 274e
+    if (!Z)
+        AOT_GOTO(0x274e, L274e);
+    AOT_GOTO(0x272a, L272a);
+L272a:
+    AOT_BLOCK(0x272a, 8);
+    // 272a: mov $9064, r0
+    {
+        src = uint16_t(0x9064);
+        r[0] = src;
+    }
+    // 272e: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 2732: mov r0, 9062
+    {
+        src = r[0];
+        b = 0x9062;
+        WR16(b, src);
+    }
+    // 2736: mov $9062, r0
+    {
+        src = uint16_t(0x9062);
+        r[0] = src;
+    }
+    // 273a: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 273e: mov r0, 9064
+    {
+        src = r[0];
+        b = 0x9064;
+        WR16(b, src);
+    }
+    // 2742: mov $9064, 9068
+    {
+        src = uint16_t(0x9064);
+        b = 0x9068;
+        WR16(b, src);
+    }
+    // 2748: mov $9062, 9066
+    {
+        src = uint16_t(0x9062);
+        b = 0x9066;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x274e, L274e);
+L274e:
+    AOT_BLOCK(0x274e, 6);
+    // 274e: mov 4(r5), r1
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[1] = src;
+    }
+    // 2752: add $3, r1
+    {
+        src = uint16_t(0x0003);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+    }
+    // 2756: clr r0
+    {
+        r[0] = 0;
+        C = false;
+    }
+    // 2758: ashc $ffff, r0
+    {
+        src = uint16_t(0xffff) & 077;
+        val = int32_t((uint32_t(r[0]) << 16) | r[1]);
+        if (src == 0) {
+        Z = val == 0;
+        N = val < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int32_t val1 = val << (src - 1), val2 = val1 << 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val < 0) != (val2 < 0);
+        } else {
+        int32_t val1 = val >> (63 - src), val2 = val1 >> 1;
+        r[0] = uint32_t(val2) >> 16;
+        r[1] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val < 0) != (val2 < 0);
+        }
+    }
+    // 275c: mov r1, r2
+    {
+        src = r[1];
+        r[2] = src;
+    }
+    // 275e: mov 9066, r4
+    {
+        a = 0x9066;
+        src = RD16(a);
+        r[4] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2762, L2762);
+L2762:
+    AOT_BLOCK(0x2762, 1);
+    // 2762: clr 906c
+    {
+        a = 0x906c;
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2766, L2766);
+L2766:
+    AOT_BLOCK(0x2766, 2);
+    // 2766: bit $1, (r4)
+    {
+        src = uint16_t(0x0001);
+        b = r[4];
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 276a: beq 2770
+    if (Z)
+        AOT_GOTO(0x2770, L2770);
+    AOT_GOTO(0x276c, L276c);
+L276c:
+    AOT_BLOCK(0x276c, 1);
+    // 276c: br 278c
+    AOT_GOTO(0x278c, L278c);
+L276e:
+    AOT_BLOCK(0x276e, 1);
+    // 276e: mov (r3), (r4)
+    {
+        a = r[3];
+        src = RD16(a);
+        b = r[4];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2770, L2770);
+L2770:
+    AOT_BLOCK(0x2770, 3);
+    // 2770: mov (r4), r3
+    {
+        a = r[4];
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 2772: bit $1, (r3)
+    {
+        src = uint16_t(0x0001);
+        b = r[3];
+        dst = RD16(b);
+        val = src & dst;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    // 2776: beq 276e
+    if (Z)
+        AOT_GOTO(0x276e, L276e);
+    AOT_GOTO(0x2778, L2778);
+L2778:
+    AOT_BLOCK(0x2778, 5);
+    // 2778: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 277a: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 277c: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 277e: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2780: bcs 278c
+    if (C)
+        AOT_GOTO(0x278c, L278c);
+    AOT_GOTO(0x2782, L2782);
+L2782:
+    AOT_BLOCK(0x2782, 5);
+    // 2782: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 2784: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2786: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2788: cmp r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 278a: blos 2830
+    if (C | Z)
+        AOT_GOTO(0x2830, L2830);
+    AOT_GOTO(0x278c, L278c);
+L278c:
+    AOT_BLOCK(0x278c, 5);
+    // 278c: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 278e: mov (r4), r4
+    {
+        a = r[4];
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2790: bic $1, r4
+    {
+        src = uint16_t(0x0001);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+    }
+    // 2794: cmp r3, r4
+    {
+        src = r[3];
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2796: bcs 2766
+    if (C)
+        AOT_GOTO(0x2766, L2766);
+    AOT_GOTO(0x2798, L2798);
+L2798:
+    AOT_BLOCK(0x2798, 2);
+    // 2798: cmp 9068, r3
+    {
+        a = 0x9068;
+        src = RD16(a);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 279c: bne 27a4
+    if (!Z)
+        AOT_GOTO(0x27a4, L27a4);
+    AOT_GOTO(0x279e, L279e);
+L279e:
+    AOT_BLOCK(0x279e, 2);
+    // 279e: cmp $9062, r4
+    {
+        src = uint16_t(0x9062);
+        dst = r[4];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 27a2: beq 27aa
+    if (Z)
+        AOT_GOTO(0x27aa, L27aa);
+    AOT_GOTO(0x27a4, L27a4);
+L27a4:
+    AOT_BLOCK(0x27a4, 1);
+    // 27a4: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x27a6, L27a6);
+L27a6:
+    AOT_BLOCK(0x27a6, 2);
+    // 27a6: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L27aa:
+    AOT_BLOCK(0x27aa, 3);
+    // 27aa: inc 906c
+    {
+        a = 0x906c;
+        val = int(int16_t(RD16(a))) + 1;
+        WR16(a, val);
+    }
+    // 27ae: cmp $1, 906c
+    {
+        src = uint16_t(0x0001);
+        b = 0x906c;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 27b4: bge 2766
+    if (!(N ^ V))
+        AOT_GOTO(0x2766, L2766);
+    AOT_GOTO(0x27b6, L27b6);
+L27b6:
+    AOT_BLOCK(0x27b6, 8);
+    // 27b6: mov r2, r1
+    {
+        src = r[2];
+        r[1] = src;
+    }
+    // 27b8: add $200, r1
+    {
+        src = uint16_t(0x0200);
+        dst = r[1];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[1] = val16;
+        N = val16 < 0;
+    }
+    // 27bc: sxt r0
+    {
+        r[0] = -int(N);
+    }
+    // 27be: div $200, r0
+    {
+        src = int16_t(uint16_t(0x0200));
+        if (src == 0 || abs(int16_t(r[0])) > abs(src)) {
+        Z = false;
+        N = false;
+        C = src == 0;
+        V = true;
+        } else {
+        val = (uint32_t(r[0]) << 16) | r[1];
+        dst = val / src;
+        r[0] = dst;
+        r[1] = val % src;
+        Z = dst == 0;
+        N = dst < 0;
+        C = false;
+        V = false;
+        }
+    }
+    // 27c2: ash $9, r0
+    {
+        src = uint16_t(0x0009) & 077;
+        val16 = r[0];
+        if (src == 0) {
+        Z = val16 == 0;
+        N = val16 < 0;
+        V = false;
+        } else if ((src & 040) == 0) {
+        int16_t val1 = val16 << (src - 1), val2 = val1 << 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = val1 < 0;
+        V = (val16 < 0) != (val2 < 0);
+        } else {
+        int16_t val1 = val16 >> (63 - src), val2 = val1 >> 1;
+        r[0] = val2;
+        Z = val2 == 0;
+        N = val2 < 0;
+        C = (val1 & 1) != 0;
+        V = (val16 < 0) != (val2 < 0);
+        }
+    }
+    // 27c6: mov r0, 906c
+    {
+        src = r[0];
+        b = 0x906c;
+        WR16(b, src);
+    }
+    // 27ca: clr (sp)
+    {
+        a = r[6];
+        WR16(a, 0);
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 27cc: jsr pc, *$2a9c
+    {
+        a = 0x2a9c;
+        r[6] -= 2;
+        WR16(r[6], 0x27d0);
+    }
+    AOT_GOTO(0x2a9c, L2a9c);
+L27d0:
+    AOT_BLOCK(0x27d0, 7);
+    // 27d0: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 27d2: mov 906c, r0
+    {
+        a = 0x906c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 27d6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 27d8: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 27da: add $80, r0
+    {
+        src = uint16_t(0x0080);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 27de: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 27e0: bhi 27a4
+    if (!(C | Z))
+        AOT_GOTO(0x27a4, L27a4);
+    AOT_GOTO(0x27e2, L27e2);
+L27e2:
+    AOT_BLOCK(0x27e2, 4);
+    // 27e2: mov 906c, r0
+    {
+        a = 0x906c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 27e6: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+        C = (src & 0x8000) != 0;
+    }
+    // 27e8: mov r0, (sp)
+    {
+        src = r[0];
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 27ea: jsr pc, *$2a9c
+    {
+        a = 0x2a9c;
+        r[6] -= 2;
+        WR16(r[6], 0x27ee);
+    }
+    AOT_GOTO(0x2a9c, L2a9c);
+L27ee:
+    AOT_BLOCK(0x27ee, 3);
+    // 27ee: mov r0, r3
+    {
+        src = r[0];
+        r[3] = src;
+    }
+    // 27f0: cmp $ffff, r3
+    {
+        src = uint16_t(0xffff);
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 27f4: beq 27a4
+    if (Z)
+        AOT_GOTO(0x27a4, L27a4);
+    AOT_GOTO(0x27f6, L27f6);
+L27f6:
+    AOT_BLOCK(0x27f6, 5);
+    // 27f6: mov r3, *9068
+    {
+        src = r[3];
+        b = RD16(0x9068);
+        WR16(b, src);
+    }
+    // 27fa: mov 9068, r0
+    {
+        a = 0x9068;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 27fe: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2802: cmp r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 2804: beq 2810
+    if (Z)
+        AOT_GOTO(0x2810, L2810);
+    AOT_GOTO(0x2806, L2806);
+L2806:
+    AOT_BLOCK(0x2806, 3);
+    // 2806: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 2808: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 280c: mov r0, *9068
+    {
+        src = r[0];
+        b = RD16(0x9068);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2810, L2810);
+L2810:
+    AOT_BLOCK(0x2810, 10);
+    // 2810: mov 906c, r0
+    {
+        a = 0x906c;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2814: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2816: add r3, r0
+    {
+        src = r[3];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2818: add $fffe, r0
+    {
+        src = uint16_t(0xfffe);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        C = src + dst >= 0x10000;
+    }
+    // 281c: mov r0, (r3)
+    {
+        src = r[0];
+        b = r[3];
+        WR16(b, src);
+    }
+    // 281e: mov r0, 9068
+    {
+        src = r[0];
+        b = 0x9068;
+        WR16(b, src);
+    }
+    // 2822: mov $9062, r0
+    {
+        src = uint16_t(0x9062);
+        r[0] = src;
+    }
+    // 2826: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 282a: mov r0, *9068
+    {
+        src = r[0];
+        b = RD16(0x9068);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 282e: br 2762
+    AOT_GOTO(0x2762, L2762);
+L2830:
+    AOT_BLOCK(0x2830, 6);
+    // 2830: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 2832: asl r0
+    {
+        src = r[0];
+        val = uint16_t((uint32_t(src) << 1) & 0xffff);
+        r[0] = val;
+    }
+    // 2834: add r4, r0
+    {
+        src = r[4];
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+    }
+    // 2836: mov r0, 9066
+    {
+        src = r[0];
+        b = 0x9066;
+        WR16(b, src);
+    }
+    // 283a: cmp r0, r3
+    {
+        src = r[0];
+        dst = r[3];
+        val16 = val = int16_t(src) - int16_t(dst);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src < dst;
+        V = val != val16;
+    }
+    // 283c: bcc 2848
+    if (!C)
+        AOT_GOTO(0x2848, L2848);
+    AOT_GOTO(0x283e, L283e);
+L283e:
+    AOT_BLOCK(0x283e, 2);
+    // 283e: mov *9066, 906a
+    {
+        a = RD16(0x9066);
+        src = RD16(a);
+        b = 0x906a;
+        WR16(b, src);
+    }
+    // 2844: mov (r4), *9066
+    {
+        a = r[4];
+        src = RD16(a);
+        b = RD16(0x9066);
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2848, L2848);
+L2848:
+    AOT_BLOCK(0x2848, 6);
+    // 2848: mov 9066, r0
+    {
+        a = 0x9066;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 284c: bis $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = src | dst;
+        r[0] = val;
+    }
+    // 2850: mov r0, (r4)
+    {
+        src = r[0];
+        b = r[4];
+        WR16(b, src);
+    }
+    // 2852: mov r4, r0
+    {
+        src = r[4];
+        r[0] = src;
+    }
+    // 2854: add $2, r0
+    {
+        src = uint16_t(0x0002);
+        dst = r[0];
+        val16 = val = int16_t(src) + int16_t(dst);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2858: br 27a6
+    AOT_GOTO(0x27a6, L27a6);
+L285a:
+    AOT_BLOCK(0x285a, 11);
+    // 285a: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x285e;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 285e: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2862: mov r4, r3
+    {
+        src = r[4];
+        r[3] = src;
+    }
+    // 2864: sub $2, r3
+    {
+        src = uint16_t(0x0002);
+        dst = r[3];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[3] = val16;
+        C = dst < src;
+    }
+    // 2868: mov r3, 9066
+    {
+        src = r[3];
+        b = 0x9066;
+        WR16(b, src);
+    }
+    // 286c: mov (r3), r0
+    {
+        a = r[3];
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 286e: bic $1, r0
+    {
+        src = uint16_t(0x0001);
+        dst = r[0];
+        val = (~src) & dst;
+        r[0] = val;
+    }
+    // 2872: mov r0, (r3)
+    {
+        src = r[0];
+        b = r[3];
+        WR16(b, src);
+    }
+    // 2874: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L28b4:
+    AOT_BLOCK(0x28b4, 3);
+    // 28b4: mov r3, r0
+    {
+        src = r[3];
+        r[0] = src;
+    }
+    // 28b6: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2920:
+    AOT_BLOCK(0x2920, 1);
+    // 2920: br 28b4
+    AOT_GOTO(0x28b4, L28b4);
+L2922:
+    AOT_BLOCK(0x2922, 7);
+    // 2922: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2926;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 2926: sub $6, sp
+    {
+        src = uint16_t(0x0006);
+        dst = r[6];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[6] = val16;
+    }
+    // 292a: mov r5, (sp)
+    {
+        src = r[5];
+        b = r[6];
+        WR16(b, src);
+    }
+    // 292c: add $fff4, (sp)
+    {
+        src = uint16_t(0xfff4);
+        b = r[6];
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2930: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2934: jsr pc, *$2964
+    {
+        a = 0x2964;
+        r[6] -= 2;
+        WR16(r[6], 0x2938);
+    }
+    AOT_GOTO(0x2964, L2964);
+L2938:
+    AOT_BLOCK(0x2938, 3);
+    // 2938: tst (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        val = int16_t(RD16(a));
+    }
+    // 293a: tst r0
+    {
+        val = int16_t(r[0]);
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 293c: bge 2944
+    if (!(N ^ V))
+        AOT_GOTO(0x2944, L2944);
+    AOT_GOTO(0x293e, L293e);
+L293e:
+    AOT_BLOCK(0x293e, 1);
+    // 293e: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2940, L2940);
+L2940:
+    AOT_BLOCK(0x2940, 2);
+    // 2940: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2944:
+    AOT_BLOCK(0x2944, 2);
+    // 2944: mov $1, r0
+    {
+        src = uint16_t(0x0001);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2948: br 2940
+    AOT_GOTO(0x2940, L2940);
+L2964:
+    AOT_BLOCK(0x2964, 3);
+    // 2964: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2968;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 2968: mov 6(r5), (sp)
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x296c, L296c);
+L296c:
+    AOT_BLOCK(0x296c, 3);
+    // 296c: mov $7408, -(sp)
+    {
+        src = uint16_t(0x7408);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2970: mov 4(r5), -(sp)
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2974: jsr pc, *$2a0a
+    {
+        a = 0x2a0a;
+        r[6] -= 2;
+        WR16(r[6], 0x2978);
+    }
+    AOT_GOTO(0x2a0a, L2a0a);
+L2978:
+    AOT_BLOCK(0x2978, 3);
+    // 2978: cmp (sp)+, (sp)+
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        b = r[6];
+        r[6] += 2;
+        dst = RD16(b);
+        val16 = val = int16_t(src) - int16_t(dst);
+        C = src < dst;
+    }
+    // 297a: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L297e:
+    AOT_BLOCK(0x297e, 5);
+    // 297e: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x2982;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 2982: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 2986: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 298a: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x298c, L298c);
+L298c:
+    AOT_BLOCK(0x298c, 2);
+    // 298c: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 298e: bne 298c
+    if (!Z)
+        AOT_GOTO(0x298c, L298c);
+    AOT_GOTO(0x2990, L2990);
+L2990:
+    AOT_BLOCK(0x2990, 1);
+    // 2990: dec r4
+    {
+        val = int(int16_t(r[4])) - 1;
+        r[4] = val;
+        Z = val == 0;
+        N = val < 0;
+        V = val == -0x8001;
+    }
+    AOT_GOTO(0x2992, L2992);
+L2992:
+    AOT_BLOCK(0x2992, 2);
+    // 2992: movb (r3)+, (r4)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 2994: bne 2992
+    if (!Z)
+        AOT_GOTO(0x2992, L2992);
+    AOT_GOTO(0x2996, L2996);
+L2996:
+    AOT_BLOCK(0x2996, 3);
+    // 2996: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 2998: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L299c:
+    AOT_BLOCK(0x299c, 4);
+    // 299c: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x29a0;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 29a0: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 29a4: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x29a8, L29a8);
+L29a8:
+    AOT_BLOCK(0x29a8, 2);
+    // 29a8: cmpb (r4), (r3)+
+    {
+        a = r[4];
+        src = RD8(a);
+        b = r[3];
+        r[3] += 1;
+        dst = RD8(b);
+        val8 = val = int8_t(src) - int8_t(dst);
+        Z = val8 == 0;
+        N = val8 < 0;
+        C = src < dst;
+        V = val != val8;
+    }
+    // 29aa: bne 29b6
+    if (!Z)
+        AOT_GOTO(0x29b6, L29b6);
+    AOT_GOTO(0x29ac, L29ac);
+L29ac:
+    AOT_BLOCK(0x29ac, 2);
+    // 29ac: tstb (r4)+
+    {
+        a = r[4];
+        r[4] += 1;
+        val = int8_t(RD8(a));
+        Z = val == 0;
+        N = val < 0;
+        C = false;
+        V = false;
+    }
+    // 29ae: bne 29a8
+    if (!Z)
+        AOT_GOTO(0x29a8, L29a8);
+    AOT_GOTO(0x29b0, L29b0);
+L29b0:
+    AOT_BLOCK(0x29b0, 1);
+    // 29b0: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x29b2, L29b2);
+L29b2:
+    AOT_BLOCK(0x29b2, 2);
+    // 29b2: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L29b6:
+    AOT_BLOCK(0x29b6, 4);
+    // 29b6: movb (r4), r0
+    {
+        a = r[4];
+        src = RD8(a);
+        r[0] = int16_t(int8_t(src));
+    }
+    // 29b8: movb -(r3), r1
+    {
+        r[3] -= 1;
+        a = r[3];
+        src = RD8(a);
+        r[1] = int16_t(int8_t(src));
+    }
+    // 29ba: sub r1, r0
+    {
+        src = r[1];
+        dst = r[0];
+        val16 = val = int16_t(dst) - int16_t(src);
+        r[0] = val16;
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = dst < src;
+        V = val != val16;
+    }
+    // 29bc: br 29b2
+    AOT_GOTO(0x29b2, L29b2);
+L29be:
+    AOT_BLOCK(0x29be, 5);
+    // 29be: jsr r5, 2b16
+    {
+        a = 0x2b16;
+        r[6] -= 2;
+        WR16(r[6], r[5]);
+        r[5] = 0x29c2;
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    // 29c2: mov 4(r5), r4
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[4] = src;
+    }
+    // 29c6: mov 6(r5), r3
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        r[3] = src;
+    }
+    // 29ca: mov r4, r2
+    {
+        src = r[4];
+        r[2] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x29cc, L29cc);
+L29cc:
+    AOT_BLOCK(0x29cc, 2);
+    // 29cc: movb (r3)+, (r4)+
+    {
+        a = r[3];
+        r[3] += 1;
+        src = RD8(a);
+        b = r[4];
+        r[4] += 1;
+        WR8(b, src);
+        Z = src == 0;
+        N = int8_t(src) < 0;
+        V = false;
+    }
+    // 29ce: bne 29cc
+    if (!Z)
+        AOT_GOTO(0x29cc, L29cc);
+    AOT_GOTO(0x29d0, L29d0);
+L29d0:
+    AOT_BLOCK(0x29d0, 3);
+    // 29d0: mov r2, r0
+    {
+        src = r[2];
+        r[0] = src;
+    }
+    // 29d2: jmp 2b22
+    {
+        a = 0x2b22;
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L29d6:
+    AOT_BLOCK(0x29d6, 3);
+    // 29d6: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 29d8: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 29da: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 29de: sys 6
+    AOT_INTERP(0x29de);
+L29e0:
+    AOT_BLOCK(0x29e0, 1);
+    // 29e0: bcc 29e6
+    if (!C)
+        AOT_GOTO(0x29e6, L29e6);
+    AOT_GOTO(0x29e2, L29e2);
+L29e2:
+    AOT_BLOCK(0x29e2, 1);
+    // 29e2: jmp 2b08
+    {
+        a = 0x2b08;
+    }
+    AOT_GOTO(0x2b08, L2b08);
+L29e4:
+    AOT_BLOCK(0x29e4, 1);
+    // 29e4: br 2a2a
+    AOT_GOTO(0x2a2a, L2a2a);
+L29e6:
+    AOT_BLOCK(0x29e6, 1);
+    // 29e6: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x29e8, L29e8);
+L29e8:
+    AOT_BLOCK(0x29e8, 2);
+    // 29e8: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 29ea: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L29ec:
+    AOT_BLOCK(0x29ec, 4);
+    // 29ec: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 29ee: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 29f0: mov 4(r5), 4c5e
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x4c5e;
+        WR16(b, src);
+    }
+    // 29f6: mov 6(r5), 4c60
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x4c60;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 29fc: sys 0
+    AOT_INTERP(0x29fc);
+L29fe:
+    AOT_BLOCK(0x29fe, 1);
+    // 29fe: bic -79fe(r1), *(r4)+
+    {
+        a = uint16_t(r[1] + -31230);
+        src = RD16(a);
+        b = RD16(r[4]);
+        r[4] += 2;
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2a02, L2a02);
+L2a00:
+    AOT_BLOCK(0x2a00, 1);
+    // 2a00: bcc 2a06
+    if (!C)
+        AOT_GOTO(0x2a06, L2a06);
+    AOT_GOTO(0x2a02, L2a02);
+L2a02:
+    AOT_BLOCK(0x2a02, 1);
+    // 2a02: jmp 2b08
+    {
+        a = 0x2b08;
+    }
+    AOT_GOTO(0x2b08, L2b08);
+L2a04:
+    AOT_BLOCK(0x2a04, 1);
+    // 2a04: br 2a0a
+    AOT_GOTO(0x2a0a, L2a0a);
+L2a06:
+    AOT_BLOCK(0x2a06, 2);
+    // 2a06: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a08: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2a0a:
+    AOT_BLOCK(0x2a0a, 5);
+    // 2a0a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2a0c: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2a0e: mov 4(r5), 4c64
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x4c64;
+        WR16(b, src);
+    }
+    // 2a14: mov 6(r5), 4c66
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x4c66;
+        WR16(b, src);
+    }
+    // 2a1a: mov 8(r5), 4c68
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x4c68;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a20: sys 0
+    AOT_INTERP(0x2a20);
+L2a22:
+    AOT_BLOCK(0x2a22, 1);
+    // 2a22: bic -79fe(r1), -(r2)
+    {
+        a = uint16_t(r[1] + -31230);
+        src = RD16(a);
+        r[2] -= 2;
+        b = r[2];
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2a26, L2a26);
+L2a24:
+    AOT_BLOCK(0x2a24, 1);
+    // 2a24: bcc 2a2a
+    if (!C)
+        AOT_GOTO(0x2a2a, L2a2a);
+    AOT_GOTO(0x2a26, L2a26);
+L2a26:
+    AOT_BLOCK(0x2a26, 1);
+    // 2a26: jmp 2b08
+    {
+        a = 0x2b08;
+    }
+    AOT_GOTO(0x2b08, L2b08);
+L2a28:
+    AOT_BLOCK(0x2a28, 1);
+    // 2a28: swab *(sp)+
+    {
+        a = RD16(r[6]);
+        r[6] += 2;
+        src = RD16(a);
+        val = ((src & 0xff) << 8) | ((src >> 8) & 0xff);
+        WR16(a, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        C = false;
+        V = false;
+    }
+    AOT_GOTO(0x2a2a, L2a2a);
+L2a2a:
+    AOT_BLOCK(0x2a2a, 3);
+    // 2a2a: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+    }
+    // 2a2c: clr r0
+    {
+        r[0] = 0;
+        Z = true;
+        N = false;
+        C = false;
+        V = false;
+    }
+    // 2a2e: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2a30:
+    AOT_BLOCK(0x2a30, 6);
+    // 2a30: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2a32: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2a34: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2a38: mov 6(r5), 4c6c
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x4c6c;
+        WR16(b, src);
+    }
+    // 2a3e: mov 8(r5), 4c6e
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x4c6e;
+        WR16(b, src);
+    }
+    // 2a44: mov a(r5), 4c70
+    {
+        a = uint16_t(r[5] + 10);
+        src = RD16(a);
+        b = 0x4c70;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a4a: sys 0
+    AOT_INTERP(0x2a4a);
+L2a4c:
+    AOT_BLOCK(0x2a4c, 1);
+    // 2a4c: bic -79fc(r1), *-(r2)
+    {
+        a = uint16_t(r[1] + -31228);
+        src = RD16(a);
+        r[2] -= 2;
+        b = RD16(r[2]);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2a50, L2a50);
+L2a4e:
+    AOT_BLOCK(0x2a4e, 1);
+    // 2a4e: bcc 2a58
+    if (!C)
+        AOT_GOTO(0x2a58, L2a58);
+    AOT_GOTO(0x2a50, L2a50);
+L2a50:
+    AOT_BLOCK(0x2a50, 1);
+    // 2a50: mov $1, r1
+    {
+        src = uint16_t(0x0001);
+        r[1] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    AOT_GOTO(0x2a54, L2a54);
+L2a52:
+    // 2a52: wait
+    AOT_INTERP(0x2a52);
+L2a54:
+    AOT_BLOCK(0x2a54, 1);
+    // 2a54: jmp 2b08
+    {
+        a = 0x2b08;
+    }
+    AOT_GOTO(0x2b08, L2b08);
+L2a58:
+    AOT_BLOCK(0x2a58, 2);
+    // 2a58: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a5a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2a5c:
+    AOT_BLOCK(0x2a5c, 4);
+    // 2a5c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2a5e: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2a60: mov 4(r5), 4c74
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x4c74;
+        WR16(b, src);
+    }
+    // 2a66: mov 6(r5), 4c76
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x4c76;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a6c: sys 0
+    AOT_INTERP(0x2a6c);
+L2a6e:
+    AOT_BLOCK(0x2a6e, 1);
+    // 2a6e: bic -79fe(r1), 77(r2)
+    {
+        a = uint16_t(r[1] + -31230);
+        src = RD16(a);
+        b = uint16_t(r[2] + 119);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2a74, L2a74);
+L2a70:
+    AOT_BLOCK(0x2a70, 1);
+    // 2a70: bcc 2a76
+    if (!C)
+        AOT_GOTO(0x2a76, L2a76);
+    AOT_GOTO(0x2a72, L2a72);
+L2a72:
+    AOT_BLOCK(0x2a72, 1);
+    // 2a72: jmp 2b08
+    {
+        a = 0x2b08;
+    }
+    AOT_GOTO(0x2b08, L2b08);
+L2a74:
+    // 2a74: (undefined)
+    AOT_INTERP(0x2a74);
+L2a76:
+    AOT_BLOCK(0x2a76, 2);
+    // 2a76: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a78: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2a7a:
+    AOT_BLOCK(0x2a7a, 5);
+    // 2a7a: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2a7c: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2a7e: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2a82: mov 6(r5), 4c7a
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x4c7a;
+        WR16(b, src);
+    }
+    // 2a88: mov 8(r5), 4c7c
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x4c7c;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a8e: sys 0
+    AOT_INTERP(0x2a8e);
+L2a90:
+    AOT_BLOCK(0x2a90, 1);
+    // 2a90: bic -79fe(r1), *77(r0)
+    {
+        a = uint16_t(r[1] + -31230);
+        src = RD16(a);
+        b = RD16(r[0] + 119);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2a96, L2a96);
+L2a92:
+    AOT_BLOCK(0x2a92, 1);
+    // 2a92: bcc 2a98
+    if (!C)
+        AOT_GOTO(0x2a98, L2a98);
+    AOT_GOTO(0x2a94, L2a94);
+L2a94:
+    AOT_BLOCK(0x2a94, 1);
+    // 2a94: jmp 2b08
+    {
+        a = 0x2b08;
+    }
+    AOT_GOTO(0x2b08, L2b08);
+L2a96:
+    AOT_BLOCK(0x2a96, 1);
+    // 2a96: jmp 1585(r0)
+    {
+        a = uint16_t(r[0] + 5509);
+    }
+    AOT_JUMP(a);
+L2a98:
+    AOT_BLOCK(0x2a98, 2);
+    // 2a98: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2a9a: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2a9c:
+    AOT_BLOCK(0x2a9c, 4);
+    // 2a9c: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2a9e: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2aa0: mov 4(r5), 4c80
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x4c80;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2aa6: beq 2ab8
+    if (Z)
+        AOT_GOTO(0x2ab8, L2ab8);
+    AOT_GOTO(0x2aa8, L2aa8);
+L2aa8:
+    AOT_BLOCK(0x2aa8, 1);
+    // 2aa8: add 4c82, 4c80
+    {
+        a = 0x4c82;
+        src = RD16(a);
+        b = 0x4c80;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        Z = val16 == 0;
+        N = val16 < 0;
+        C = src + dst >= 0x10000;
+        V = val != val16;
+    }
+    // 2aae: sys 0
+    AOT_INTERP(0x2aae);
+L2ab0:
+    AOT_BLOCK(0x2ab0, 1);
+    // 2ab0: bic -79fe(r1), *77(sp)
+    {
+        a = uint16_t(r[1] + -31230);
+        src = RD16(a);
+        b = RD16(r[6] + 119);
+        dst = RD16(b);
+        val = (~src) & dst;
+        WR16(b, val);
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2ab6, L2ab6);
+L2ab2:
+    AOT_BLOCK(0x2ab2, 1);
+    // 2ab2: bcc 2ab8
+    if (!C)
+        AOT_GOTO(0x2ab8, L2ab8);
+    AOT_GOTO(0x2ab4, L2ab4);
+L2ab4:
+    AOT_BLOCK(0x2ab4, 1);
+    // 2ab4: jmp 2b08
+    {
+        a = 0x2b08;
+    }
+    AOT_GOTO(0x2b08, L2b08);
+L2ab6:
+    AOT_BLOCK(0x2ab6, 1);
+    // 2ab6: jmp (r0)+
+    {
+        a = r[0];
+        r[0] += 2;
+    }
+    AOT_JUMP(a);
+L2ab8:
+    AOT_BLOCK(0x2ab8, 4);
+    // 2ab8: mov 4c82, r0
+    {
+        a = 0x4c82;
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2abc: add 4(r5), 4c82
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        b = 0x4c82;
+        dst = RD16(b);
+        val16 = val = int16_t(src) + int16_t(dst);
+        WR16(b, val16);
+        C = src + dst >= 0x10000;
+    }
+    // 2ac2: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2ac4: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2ae6:
+    AOT_BLOCK(0x2ae6, 5);
+    // 2ae6: mov r5, -(sp)
+    {
+        src = r[5];
+        r[6] -= 2;
+        b = r[6];
+        WR16(b, src);
+    }
+    // 2ae8: mov sp, r5
+    {
+        src = r[6];
+        r[5] = src;
+    }
+    // 2aea: mov 4(r5), r0
+    {
+        a = uint16_t(r[5] + 4);
+        src = RD16(a);
+        r[0] = src;
+    }
+    // 2aee: mov 6(r5), 4c86
+    {
+        a = uint16_t(r[5] + 6);
+        src = RD16(a);
+        b = 0x4c86;
+        WR16(b, src);
+    }
+    // 2af4: mov 8(r5), 4c88
+    {
+        a = uint16_t(r[5] + 8);
+        src = RD16(a);
+        b = 0x4c88;
+        WR16(b, src);
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2afa: sys 0
+    AOT_INTERP(0x2afa);
+L2afc:
+    AOT_BLOCK(0x2afc, 1);
+    // 2afc: bic -79fe(r2), r4
+    {
+        a = uint16_t(r[2] + -31230);
+        src = RD16(a);
+        dst = r[4];
+        val = (~src) & dst;
+        r[4] = val;
+        Z = val == 0;
+        N = (val & 0x8000) != 0;
+        V = false;
+    }
+    AOT_GOTO(0x2b00, L2b00);
+L2afe:
+    AOT_BLOCK(0x2afe, 1);
+    // 2afe: bcc 2b04
+    if (!C)
+        AOT_GOTO(0x2b04, L2b04);
+    AOT_GOTO(0x2b00, L2b00);
+L2b00:
+    AOT_BLOCK(0x2b00, 1);
+    // 2b00: jmp 2b08
+    {
+        a = 0x2b08;
+    }
+    AOT_GOTO(0x2b08, L2b08);
+L2b02:
+    // 2b02: iot
+    AOT_INTERP(0x2b02);
+L2b04:
+    AOT_BLOCK(0x2b04, 2);
+    // 2b04: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b06: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2b08:
+    AOT_BLOCK(0x2b08, 5);
+    // 2b08: mov r0, 8e5e
+    {
+        src = r[0];
+        b = 0x8e5e;
+        WR16(b, src);
+    }
+    // 2b0c: mov $ffff, r0
+    {
+        src = uint16_t(0xffff);
+        r[0] = src;
+    }
+    // 2b10: mov r5, sp
+    {
+        src = r[5];
+        r[6] = src;
+    }
+    // 2b12: mov (sp)+, r5
+    {
+        a = r[6];
+        r[6] += 2;
+        src = RD16(a);
+        r[5] = src;
+        Z = src == 0;
+        N = int16_t(src) < 0;
+        V = false;
+    }
+    // 2b14: rts pc
+    {
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+L2b16:
+    AOT_BLOCK(0x2b16, 1);
+    // csv
+    {
+        r[0] = r[5];
+        r[5] = r[6];
+        r[6] -= 2;
+        WR16(r[6], r[4]);
+        r[6] -= 2;
+        WR16(r[6], r[3]);
+        r[6] -= 2;
+        WR16(r[6], r[2]);
+        Z = r[2] == 0;
+        N = int16_t(r[2]) < 0;
+        V = false;
+        r[6] -= 2;
+        WR16(r[6], 0x2b22);
+    }
+    AOT_JUMP(r[0]);
+L2b22:
+    AOT_BLOCK(0x2b22, 1);
+    // cret
+    {
+        r[2] = r[5] - 6;
+        r[4] = RD16(r[5] - 2);
+        r[3] = RD16(r[5] - 4);
+        r[2] = RD16(r[5] - 6);
+        r[6] = r[5];
+        r[5] = RD16(r[6]);
+        r[6] += 2;
+        Z = r[5] == 0;
+        N = int16_t(r[5]) < 0;
+        V = false;
+        b = RD16(r[6]);
+        r[6] += 2;
+    }
+    AOT_JUMP(b);
+}
+
+AotImage image("v7/lib/cpp", 0x0000, 11072, 0x36e3f37eu, run);
+}
@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""benchmark suite: runs fixed guest workloads under 7run and reports
+wall time, instructions, MIPS, peak RSS and system calls.
+
+usage: python3 bench.py [-n N] [-o out.json] [-b baseline.json]
+           [--7run path] [--v6sys dir] [--m2root dir] [workload ...]
+
+wall time and RSS are the median and maximum of N runs without any
+tracing; instructions and system calls come from one --stats-json run.
+"""
+
+import sys, os, json, shutil, tempfile, time, resource, subprocess
+
+top = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+distrib = os.path.join(top, "distrib")
+
+def hello(root, ver=[]):
+    return lambda d: [ver + ["-r", root, root + "/bin/cc", "-O", "hello.c"]]
+
+# V6 kernel sources (sys/ken, sys/dmr) are not in the tree: --v6sys dir
+def v6kernel(src):
+    def cmds(d):
+        shutil.copytree(src, os.path.join(d, "sys"))
+        ret = []
+        for sub in ["ken", "dmr"]:
+            files = sorted(f for f in os.listdir(os.path.join(src, sub))
+                           if f.endswith(".c"))
+            root = distrib + "/v6root"
+            ret.append(["-r", root, root + "/bin/cc", "-c", "-O"] +
+                       ["sys/%s/%s" % (sub, f) for f in files])
+        return ret
+    return cmds
+
+# MINIX 2.0.4 kernel: --m2root dir (usr/src/kernel and the ACK compiler)
+def m2kernel(root):
+    src = root + "/usr/src/kernel"
+    def cmds(d):
+        shutil.copytree(src, os.path.join(d, "kernel"))
+        files = sorted(f for f in os.listdir(src) if f.endswith(".c"))
+        return [["-r", root, root + "/usr/bin/cc", "-c", "-I/usr/include",
+                 "-D_MINIX", "-D_POSIX_SOURCE"] +
+                ["kernel/" + f for f in files]]
+    return cmds
+
+def tests(d):
+    ret = []
+    for f in ["a.out", "write.out", "write-libc.out", "test.bin",
+              "idiv.bin", "xchg.bin", "write-nasm.bin"]:
+        path = os.path.join(top, "tests", f)
+        if os.path.exists(path): ret.append([path])
+    return ret
+
+def workloads(opts):
+    ret = [
+        ("v6-hello", hello(distrib + "/v6root")),
+        ("v7-hello", hello(distrib + "/v7root", ["-7"])),
+        ("ack-hello", hello(distrib + "/8086v6-ack")),
+        ("tests", tests),
+    ]
+    if opts["v6sys"]: ret.append(("v6-kernel", v6kernel(opts["v6sys"])))
+    if opts["m2root"]: ret.append(("m2-kernel", m2kernel(opts["m2root"])))
+    return ret
+
+def prepare(make):
+    d = tempfile.mkdtemp(prefix="7bench")
+    shutil.copy(os.path.join(top, "trans", "hello.c"), d)
+    return d, make(d)
+
+def run(run7, d, cmds, opts=[]):
+    null = open(os.devnull, "w")
+    for cmd in cmds:
+        subprocess.call([run7] + opts + cmd, cwd=d, stdout=null, stderr=null)
+    null.close()
+
+# wall time and peak RSS of the process tree, measured in a forked child
+def measure(run7, make):
+    r, w = os.pipe()
+    pid = os.fork()
+    if pid == 0:
+        ok = False
+        try:
+            os.close(r)
+            d, cmds = prepare(make)
+            t = time.time()
+            run(run7, d, cmds)
+            t = time.time() - t
+            rss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+            shutil.rmtree(d)
+            os.write(w, json.dumps([t, rss]).encode())
+            ok = bool(cmds)
+        finally:
+            os._exit(0 if ok else 1)
+    os.close(w)
+    data = b""
+    while True:
+        s = os.read(r, 4096)
+        if not s: break
+        data += s
+    os.close(r)
+    _, status = os.waitpid(pid, 0)
+    if status: return None
+    return json.loads(data.decode())
+
+def count(run7, make):
+    d, cmds = prepare(make)
+    stats = os.path.join(d, "stats.json")
+    run(run7, d, cmds, ["--stats-json", stats])
+    insns, syscalls = 0, 0
+    if os.path.exists(stats):
+        for line in open(stats):
+            rec = json.loads(line)
+            insns += rec["instructions"]
+            syscalls += sum(rec["syscalls"].values())
+    shutil.rmtree(d)
+    return insns, syscalls
+
+def bench(opts):
+    results = {}
+    for name, make in workloads(opts):
+        if opts["names"] and name not in opts["names"]: continue
+        times, rss = [], 0
+        for i in range(opts["n"]):
+            m = measure(opts["7run"], make)
+            if m is None: break
+            times.append(m[0])
+            rss = max(rss, m[1])
+        if not times:
+            sys.stderr.write("%s: skipped (no input)\n" % name)
+            continue
+        times.sort()
+        wall = times[len(times) // 2]
+        insns, syscalls = count(opts["7run"], make)
+        results[name] = {
+            "runs": len(times), "wall": round(wall, 4),
+            "min": round(times[0], 4), "max": round(times[-1], 4),
+            "instructions": insns,
+            "mips": round(insns / wall / 1e6, 2) if wall else 0,
+            "maxrss_kb": rss, "syscalls": syscalls,
+        }
+    return results
+
+def report(results, base):
+    head = "%-10s %9s %9s %12s %8s %9s %8s" % (
+        "workload", "wall(s)", "min(s)", "insns", "MIPS", "RSS(KB)", "syscalls")
+    if base: head += " %9s" % "vs base"
+    print(head)
+    for name in sorted(results):
+        r = results[name]
+        line = "%-10s %9.4f %9.4f %12d %8.2f %9d %8d" % (
+            name, r["wall"], r["min"], r["instructions"], r["mips"],
+            r["maxrss_kb"], r["syscalls"])
+        b = base.get(name) if base else None
+        if b and b["wall"]:
+            line += " %+8.1f%%" % ((r["wall"] / b["wall"] - 1) * 100)
+            if b["instructions"] != r["instructions"]:
+                line += " (insns %+d)" % (r["instructions"] - b["instructions"])
+        print(line)
+
+def main(argv):
+    opts = {"n": 5, "out": None, "base": None, "names": [],
+            "7run": os.path.join(top, "7run", "7run"),
+            "v6sys": None, "m2root": None}
+    args = list(argv)
+    keys = {"-n": "n", "-o": "out", "-b": "base", "--7run": "7run",
+            "--v6sys": "v6sys", "--m2root": "m2root"}
+    while args:
+        arg = args.pop(0)
+        if arg in keys and args:
+            opts[keys[arg]] = args.pop(0)
+        elif arg.startswith("-"):
+            sys.stderr.write(__doc__)
+            return 1
+        else:
+            opts["names"].append(arg)
+    opts["n"] = max(1, int(opts["n"]))
+    opts["7run"] = os.path.abspath(opts["7run"])
+    for k in ["v6sys", "m2root"]:
+        if opts[k] and not os.path.isdir(opts[k]):
+            sys.stderr.write("%s: not found: %s\n" % (k, opts[k]))
+            opts[k] = None
+        elif opts[k]:
+            opts[k] = os.path.abspath(opts[k])
+    base = None
+    if opts["base"]:
+        if os.path.exists(opts["base"]):
+            base = json.load(open(opts["base"]))["results"]
+        else:
+            sys.stderr.write("baseline not found: %s\n" % opts["base"])
+    results = bench(opts)
+    report(results, base)
+    if opts["out"]:
+        with open(opts["out"], "w") as f:
+            json.dump({"7run": opts["7run"], "runs": opts["n"],
+                       "results": results}, f, indent=1, sort_keys=True)
+            f.write("\n")
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,1003 @@
+#include "VM.h"
+#include "../Aot.h"
+#include "disasm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <set>
+
+using namespace i8086;
+
+// 7aot: the text as C++ on the state of i8086::VM (see aot.h) with a label
+// for each basic block found by recursive disassembly. indirect jmp, call
+// and ret go through the switch on IP, int (the system calls of
+// Minix2::OS), the instructions run1() does not implement and the code not
+// found at translation are left to the interpreter. the generated code
+// mirrors run1() statement by statement, flags that are overwritten in the
+// same block are not computed.
+
+namespace {
+    enum Flow {
+        CONT, // to the next instruction
+        GOTO, // to target
+        COND, // to target if cond, else to the next instruction
+        JUMP, // to the address in jump
+        INTERP // run1()
+    };
+
+    enum {
+        FO = 1, FS = 2, FZ = 4, FA = 8, FP = 16, FC = 32, FALL = 63
+    };
+
+    struct Insn {
+        Flow flow;
+        int len, count, reads, kills, target, ret;
+        std::string code, flags[6], cond, jump;
+
+        Insn() : flow(CONT), len(1), count(1), reads(0), kills(0), target(-1), ret(-1) {
+        }
+
+        int writes() const {
+            int ret = 0;
+            for (int i = 0; i < 6; i++) {
+                if (!flags[i].empty()) ret |= 1 << i;
+            }
+            return ret;
+        }
+    };
+
+    // an operand of run1(): Reg, Imm or Ptr with the address in a
+    struct Opr {
+        int type;
+        bool w;
+        int value;
+    };
+}
+
+static std::string fmt(const char *f, ...) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, f);
+    vsnprintf(buf, sizeof (buf), f, ap);
+    va_end(ap);
+    return buf;
+}
+
+static std::string indent(const std::string &s) {
+    std::string ret;
+    std::string::size_type p = 0, q;
+    while ((q = s.find('\n', p)) != std::string::npos) {
+        ret += "    " + s.substr(p, q - p + 1);
+        p = q + 1;
+    }
+    return ret;
+}
+
+// Operand::modrm() with the address into a, returns the length
+static int modrm(std::string &s, Opr &o, uint8_t *p, bool w) {
+    static const char *base[] = {
+        "r[3] + r[6]", "r[3] + r[7]", "r[5] + r[6]", "r[5] + r[7]",
+        "r[6]", "r[7]", "r[5]", "r[3]"
+    };
+    uint8_t b = p[1], mod = b >> 6, rm = b & 7;
+    int disp = 0, len = 2;
+    o.w = w;
+    switch (mod) {
+        case 0:
+            if (rm == 6) {
+                o.type = Ptr;
+                o.value = ::read16(p + 2);
+                s += fmt("a = 0x%04x;\n", o.value);
+                return 4;
+            }
+            break;
+        case 1:
+            disp = int8_t(p[2]);
+            len = 3;
+            break;
+        case 2:
+            disp = int16_t(::read16(p + 2));
+            len = 4;
+            break;
+        default:
+            o.type = Reg;
+            o.value = rm;
+            return 2;
+    }
+    o.type = Ptr;
+    o.value = disp;
+    if (!disp) {
+        s += fmt("a = uint16_t(%s);\n", base[rm]);
+    } else {
+        s += fmt("a = uint16_t(%s %c %d);\n", base[rm], disp < 0 ? '-' : '+', abs(disp));
+    }
+    return len;
+}
+
+static int regrm(std::string &s, Opr &o1, Opr &o2, uint8_t *p, bool dir, bool w) {
+    Opr reg = {Reg, w, (p[1] >> 3) & 7};
+    if (dir) {
+        o1 = reg;
+        return modrm(s, o2, p, w);
+    }
+    o2 = reg;
+    return modrm(s, o1, p, w);
+}
+
+static int aimm(Opr &o1, Opr &o2, uint8_t *p) {
+    bool w = p[0] & 1;
+    Opr reg = {Reg, w, 0}, imm = {Imm, w, w ? ::read16(p + 1) : p[1]};
+    o1 = reg;
+    o2 = imm;
+    return 2 + w;
+}
+
+static int getopr(std::string &s, Opr &o1, Opr &o2, uint8_t *p) {
+    if (p[0] & 4) return aimm(o1, o2, p);
+    return regrm(s, o1, o2, p, p[0] & 2, p[0] & 1);
+}
+
+// *opr (sign) or opr.u()
+static std::string get(const Opr &o, bool sign) {
+    switch (o.type) {
+        case Reg:
+            if (o.w) return fmt(sign ? "int16_t(r[%d])" : "r[%d]", o.value);
+            if (o.value < 4) return fmt(sign ? "int8_t(r[%d])" : "uint8_t(r[%d])", o.value);
+            return fmt(sign ? "int8_t(r[%d] >> 8)" : "uint8_t(r[%d] >> 8)", o.value - 4);
+        case Imm:
+            if (o.w) return fmt("%d", sign ? int16_t(o.value) : uint16_t(o.value));
+            return fmt("%d", sign ? int8_t(o.value) : uint8_t(o.value));
+    }
+    if (o.w) return sign ? "int16_t(RD16(a))" : "RD16(a)";
+    return sign ? "int8_t(RD8(a))" : "RD8(a)";
+}
+
+// opr = v
+static std::string set(const Opr &o, const std::string &v) {
+    const char *s = v.c_str();
+    if (o.type != Reg) return fmt(o.w ? "WR16(a, %s);\n" : "WR8(a, %s);\n", s);
+    int n = o.value;
+    if (o.w) return fmt("r[%d] = %s;\n", n, s);
+    if (n < 4) return fmt("r[%d] = (r[%d] & 0xff00) | uint8_t(%s);\n", n, n, s);
+    return fmt("r[%d] = (r[%d] & 0xff) | uint8_t(%s) << 8;\n", n - 4, n - 4, s);
+}
+
+// setf8() or setf16() of v
+static void setf(Insn &in, bool w, const char *v) {
+    const char *t = w ? "int16_t" : "int8_t";
+    in.flags[0] = fmt("%s != %s(%s)", v, t, v);
+    in.flags[1] = fmt("%s(%s) < 0", t, v);
+    in.flags[2] = fmt("%s(%s) == 0", t, v);
+    in.flags[4] = fmt("ptable[uint8_t(%s)]", v);
+}
+
+// setf() in the code, without OF that the shifts overwrite
+static std::string setfcode(bool w, const char *v, bool of) {
+    const char *t = w ? "int16_t" : "int8_t";
+    std::string s;
+    if (of) s += fmt("OF = %s != %s(%s);\n", v, t, v);
+    s += fmt("SF = %s(%s) < 0;\n", t, v);
+    s += fmt("ZF = %s(%s) == 0;\n", t, v);
+    s += fmt("PF = ptable[uint8_t(%s)];\n", v);
+    return s;
+}
+
+// add, or, adc, sbb, and, sub, xor and cmp by the reg field
+static void alu(Insn &in, int op, const Opr &o1, const Opr &o2) {
+    std::string &s = in.code, d = get(o1, true), sr = get(o2, true);
+    const char *u = o1.w ? "uint16_t" : "uint8_t";
+    switch (op) {
+        case 0: // add
+            s += "val = (dst = " + d + ") + (src = " + sr + ");\n";
+            in.flags[3] = "(dst & 15) + (src & 15) > 15";
+            in.flags[5] = fmt("%s(dst) > %s(val)", u, u);
+            break;
+        case 1: // or
+            s += "val = " + d + " | " + sr + ";\n";
+            in.flags[5] = "false";
+            break;
+        case 2: // adc
+            s += "val = (dst = " + d + ") + (src = " + sr + ") + CF;\n";
+            in.flags[3] = "(dst & 15) + (src & 15) + CF > 15";
+            in.flags[5] = fmt("%s(dst) > %s(val) || (CF && !(src + 1))", u, u);
+            in.reads = FC;
+            break;
+        case 3: // sbb
+            s += "val = (dst = " + d + ") - (src = " + sr + ") - CF;\n";
+            in.flags[3] = "(dst & 15) - (src & 15) - CF < 0";
+            in.flags[5] = fmt("%s(dst) < %s(src + CF) || (CF && !(src + 1))", u, u);
+            in.reads = FC;
+            break;
+        case 4: // and
+            s += "val = " + d + " & " + sr + ";\n";
+            in.flags[5] = "false";
+            break;
+        case 5: // sub
+        case 7: // cmp
+            s += "val = (dst = " + d + ") - (src = " + sr + ");\n";
+            in.flags[3] = "(dst & 15) - (src & 15) < 0";
+            in.flags[5] = fmt("%s(dst) < %s(src)", u, u);
+            break;
+        case 6: // xor
+            s += "val = " + d + " ^ " + sr + ";\n";
+            in.flags[5] = "false";
+            break;
+    }
+    setf(in, o1.w, "val");
+    if (op != 7) s += set(o1, "val");
+}
+
+static void test(Insn &in, const Opr &o1, const Opr &o2) {
+    in.code += "val = " + get(o1, true) + " & " + get(o2, true) + ";\n";
+    in.flags[5] = "false";
+    setf(in, o1.w, "val");
+}
+
+// VM::shift() by the count c, cc: its value or -1 for cl
+static bool shift(Insn &in, const Opr &o, int op, const std::string &c, int cc) {
+    std::string &s = in.code, t;
+    bool w = o.w;
+    const char *m = w ? "0x8000" : "0x80", *m1 = w ? "0x10000" : "0x100";
+    const char *mh = w ? "0x4000" : "0x40";
+    switch (op) {
+        case 0: // rol
+            s += "val = " + get(o, false) + ";\n";
+            s += "for (int i = 0; i < " + c + "; ++i)\n";
+            s += fmt("    val = (val << 1) | (CF = val & %s);\n", m);
+            s += fmt("OF = CF ^ bool(val & %s);\n", m);
+            s += set(o, "val");
+            in.kills = cc > 0 ? FO | FC : FO;
+            in.reads = cc > 0 ? 0 : FC;
+            return true;
+        case 1: // ror
+            s += "val = " + get(o, false) + ";\n";
+            s += "for (int i = 0; i < " + c + "; ++i)\n";
+            s += fmt("    val = (val >> 1) | ((CF = val & 1) ? %s : 0);\n", m);
+            s += fmt("OF = CF ^ bool(val & %s);\n", mh);
+            s += set(o, "val");
+            in.kills = cc > 0 ? FO | FC : FO;
+            in.reads = cc > 0 ? 0 : FC;
+            return true;
+        case 2: // rcl
+            s += "val = " + get(o, false) + ";\n";
+            s += "for (int i = 0; i < " + c + "; ++i) {\n";
+            s += "    val = (val << 1) | CF;\n";
+            s += fmt("    CF = val & %s;\n", m1);
+            s += "}\n";
+            s += fmt("OF = CF ^ bool(val & %s);\n", m);
+            s += set(o, "val");
+            in.kills = cc > 0 ? FO | FC : FO;
+            in.reads = FC;
+            return true;
+        case 3: // rcr
+            s += "val = " + get(o, false) + ";\n";
+            s += "for (int i = 0; i < " + c + "; ++i) {\n";
+            s += fmt("    bool f1 = val & 1, f2 = val & %s;\n", m);
+            s += fmt("    val = (val >> 1) | (CF ? %s : 0);\n", m);
+            s += "    OF = CF ^ f2;\n";
+            s += "    CF = f1;\n";
+            s += "}\n";
+            s += set(o, "val");
+            in.kills = cc > 0 ? FO | FC : 0;
+            in.reads = FC;
+            return true;
+        case 4: // shl/sal
+            if (!cc) return true;
+            t = "val = " + get(o, false) + " << " + c + ";\n";
+            t += set(o, "val") + setfcode(w, "val", false);
+            t += fmt("CF = val & %s;\n", m1);
+            t += fmt("OF = CF != bool(val & %s);\n", m);
+            break;
+        case 5: // shr
+            if (!cc) return true;
+            t = "val = " + get(o, false) + " >> (" + c + " - 1);\n";
+            t += set(o, "val >> 1") + setfcode(w, "(val >> 1)", false);
+            t += "CF = val & 1;\n";
+            t += fmt("OF = val & %s;\n", m);
+            break;
+        case 7: // sar
+            if (!cc) return true;
+            t = "val = " + get(o, true) + " >> (" + c + " - 1);\n";
+            t += set(o, "val >> 1") + setfcode(w, "(val >> 1)", false);
+            t += "CF = val & 1;\n";
+            t += "OF = false;\n";
+            break;
+        default:
+            return false;
+    }
+    if (cc > 0) {
+        s += t;
+        in.kills = FO | FS | FZ | FP | FC;
+    } else {
+        s += "if (" + c + " > 0) {\n" + indent(t) + "}\n";
+    }
+    return true;
+}
+
+// the string instructions with the prefix rep (0: none)
+static bool strop(Insn &in, uint8_t b, uint8_t rep) {
+    bool w = b & 1, si = true, di = true, flags = false;
+    const char *rd = w ? "RD16" : "RD8", *wr = w ? "WR16" : "WR8";
+    const char *t = w ? "int16_t" : "int8_t";
+    int d = w ? 2 : 1;
+    std::string s;
+    switch (b & ~1) {
+        case 0xa4: // movs
+            s = fmt("%s(r[7], %s(r[6]));\n", wr, rd);
+            break;
+        case 0xa6: // cmps
+            s = fmt("val = %s(dst = %s(r[6])) - %s(src = %s(r[7]));\n", t, rd, t, rd);
+            flags = true;
+            break;
+        case 0xaa: // stos
+            s = fmt("%s(r[7], r[0]);\n", wr);
+            si = false;
+            break;
+        case 0xac: // lods
+            s = w ? "r[0] = RD16(r[6]);\n" : "r[0] = (r[0] & 0xff00) | RD8(r[6]);\n";
+            di = false;
+            break;
+        case 0xae: // scas
+            s = fmt("val = %s(dst = %s) - %s(src = %s(r[7]));\n",
+                    t, w ? "r[0]" : "uint8_t(r[0])", t, rd);
+            si = false;
+            flags = true;
+            break;
+        default:
+            return false;
+    }
+    if (flags) {
+        s += "AF = (dst & 15) - (src & 15) < 0;\n";
+        s += "CF = dst < src;\n";
+        s += setfcode(w, "val", true);
+    }
+    if (si && di) {
+        s += fmt("if (DF) {\n    r[6] -= %d;\n    r[7] -= %d;\n", d, d);
+        s += fmt("} else {\n    r[6] += %d;\n    r[7] += %d;\n}\n", d, d);
+    } else {
+        int n = si ? 6 : 7;
+        s += fmt("if (DF) r[%d] -= %d;\nelse r[%d] += %d;\n", n, d, n, d);
+    }
+    if (!rep) {
+        in.code = s;
+        if (flags) in.kills = FALL;
+        return true;
+    }
+    const char *cond = "--r[1]";
+    if (flags) cond = rep == 0xf2 ? "--r[1] && !ZF" : "--r[1] && ZF";
+    in.code = "if (r[1]) {\n    do {\n" + indent(indent(s));
+    in.code += fmt("    } while (%s);\n}\n", cond);
+    return true;
+}
+
+static void branch(Insn &in, int target, const char *cond, int reads) {
+    in.flow = cond ? COND : GOTO;
+    if (cond) in.cond = cond;
+    in.target = uint16_t(target);
+    in.reads = reads;
+}
+
+static void push(std::string &s, const std::string &v) {
+    s += "r[4] -= 2;\n";
+    s += "WR16(r[4], " + v + ");\n";
+}
+
+// one instruction of run1(), false: left to the interpreter
+static bool insn(VM *vm, Insn &in, uint16_t pc) {
+    static const char *conds[] = {
+        "OF", "!OF", "CF", "!CF", "ZF", "!ZF", "CF || ZF", "!(CF || ZF)",
+        "SF", "!SF", "PF", "!PF", "SF != OF", "SF == OF",
+        "ZF || SF != OF", "!(ZF || SF != OF)"
+    };
+    static const int creads[] = {
+        FO, FO, FC, FC, FZ, FZ, FC | FZ, FC | FZ,
+        FS, FS, FP, FP, FS | FO, FS | FO, FZ | FS | FO, FZ | FS | FO
+    };
+    uint8_t *p = vm->text + pc;
+    uint8_t b = p[0];
+    std::string &s = in.code;
+    Opr o1, o2;
+    int n = b & 7, next;
+    if (b < 0x40 && n < 6) {
+        in.len = getopr(s, o1, o2, p);
+        alu(in, b >> 3, o1, o2);
+        return true;
+    }
+    switch (b) {
+        case 0x40: // inc reg16
+        case 0x41:
+        case 0x42:
+        case 0x43:
+        case 0x44:
+        case 0x45:
+        case 0x46:
+        case 0x47:
+            s += fmt("val = int16_t(r[%d]) + 1;\nr[%d] = val;\n", n, n);
+            setf(in, true, "val");
+            in.flags[3] = "!(val & 15)";
+            return true;
+        case 0x48: // dec reg16
+        case 0x49:
+        case 0x4a:
+        case 0x4b:
+        case 0x4c:
+        case 0x4d:
+        case 0x4e:
+        case 0x4f:
+            s += fmt("val = int16_t(r[%d]) - 1;\nr[%d] = val;\n", n, n);
+            setf(in, true, "val");
+            in.flags[3] = "(val & 15) == 15";
+            return true;
+        case 0x50: // push reg16
+        case 0x51:
+        case 0x52:
+        case 0x53:
+        case 0x54:
+        case 0x55:
+        case 0x56:
+        case 0x57:
+            push(s, fmt("r[%d]", n));
+            return true;
+        case 0x58: // pop reg16
+        case 0x59:
+        case 0x5a:
+        case 0x5b:
+        case 0x5c:
+        case 0x5d:
+        case 0x5e:
+        case 0x5f:
+            s += fmt("val = RD16(r[4]);\nr[4] += 2;\nr[%d] = val;\n", n);
+            return true;
+        case 0x70: // jcc
+        case 0x71:
+        case 0x72:
+        case 0x73:
+        case 0x74:
+        case 0x75:
+        case 0x76:
+        case 0x77:
+        case 0x78:
+        case 0x79:
+        case 0x7a:
+        case 0x7b:
+        case 0x7c:
+        case 0x7d:
+        case 0x7e:
+        case 0x7f:
+            in.len = 2;
+            branch(in, pc + 2 + int8_t(p[1]), conds[b & 15], creads[b & 15]);
+            return true;
+        case 0x80: // r/m, imm8
+        case 0x81: // r/m, imm16
+        case 0x83: // r/m, imm8 (signed extend to 16bit)
+        {
+            in.len = modrm(s, o1, p, b & 1);
+            Opr imm = {Imm, b == 0x81, b == 0x81 ? ::read16(p + in.len) : p[in.len]};
+            in.len += 1 + imm.w;
+            alu(in, (p[1] >> 3) & 7, o1, imm);
+            return true;
+        }
+        case 0x84: // test r/m, reg
+        case 0x85:
+            in.len = regrm(s, o1, o2, p, RmReg, b & 1);
+            test(in, o1, o2);
+            return true;
+        case 0x86: // xchg r/m, reg
+        case 0x87:
+            in.len = regrm(s, o1, o2, p, RmReg, b & 1);
+            s += "val = " + get(o2, true) + ";\n";
+            s += set(o2, get(o1, true));
+            s += set(o1, "val");
+            return true;
+        case 0x88: // mov
+        case 0x89:
+        case 0x8a:
+        case 0x8b:
+            in.len = regrm(s, o1, o2, p, b & 2, b & 1);
+            s += set(o1, get(o2, false));
+            return true;
+        case 0x8d: // lea reg16, r/m
+            in.len = regrm(s, o1, o2, p, RegRm, 1);
+            if (o2.type != Ptr) return false;
+            s += set(o1, "a");
+            return true;
+        case 0x8f: // pop r/m
+            in.len = modrm(s, o1, p, 1);
+            s += "val = RD16(r[4]);\nr[4] += 2;\n";
+            s += set(o1, "val");
+            return true;
+        case 0x90: // nop
+            return true;
+        case 0x91: // xchg reg, ax
+        case 0x92:
+        case 0x93:
+        case 0x94:
+        case 0x95:
+        case 0x96:
+        case 0x97:
+            s += fmt("val = r[0];\nr[0] = r[%d];\nr[%d] = val;\n", n, n);
+            return true;
+        case 0x98: // cbw
+            s += "r[0] = int16_t(int8_t(r[0]));\n";
+            return true;
+        case 0x99: // cwd
+            s += "r[2] = int16_t(r[0]) < 0 ? 0xffff : 0;\n";
+            return true;
+        case 0x9c: // pushf
+            push(s, "AOT_GETF");
+            in.reads = FALL;
+            return true;
+        case 0x9d: // popf
+            s += "val = RD16(r[4]);\nr[4] += 2;\nAOT_SETF(val);\n";
+            in.kills = FALL;
+            return true;
+        case 0x9e: // sahf
+            s += "val = (AOT_GETF & 0xff00) | (r[0] >> 8);\nAOT_SETF(val);\n";
+            in.reads = in.kills = FALL;
+            return true;
+        case 0x9f: // lahf
+            s += "r[0] = (r[0] & 0xff) | uint8_t(AOT_GETF) << 8;\n";
+            in.reads = FALL;
+            return true;
+        case 0xa0: // mov al, [addr]
+            in.len = 3;
+            s += fmt("r[0] = (r[0] & 0xff00) | RD8(0x%04x);\n", ::read16(p + 1));
+            return true;
+        case 0xa1: // mov ax, [addr]
+            in.len = 3;
+            s += fmt("r[0] = RD16(0x%04x);\n", ::read16(p + 1));
+            return true;
+        case 0xa2: // mov [addr], al
+            in.len = 3;
+            s += fmt("WR8(0x%04x, r[0]);\n", ::read16(p + 1));
+            return true;
+        case 0xa3: // mov [addr], ax
+            in.len = 3;
+            s += fmt("WR16(0x%04x, r[0]);\n", ::read16(p + 1));
+            return true;
+        case 0xa8: // test al, imm8
+        case 0xa9: // test ax, imm16
+            in.len = aimm(o1, o2, p);
+            test(in, o1, o2);
+            return true;
+        case 0xb0: // mov reg8, imm8
+        case 0xb1:
+        case 0xb2:
+        case 0xb3:
+        case 0xb4:
+        case 0xb5:
+        case 0xb6:
+        case 0xb7:
+        {
+            in.len = 2;
+            Opr reg = {Reg, false, n};
+            s += set(reg, fmt("%d", p[1]));
+            return true;
+        }
+        case 0xb8: // mov reg16, imm16
+        case 0xb9:
+        case 0xba:
+        case 0xbb:
+        case 0xbc:
+        case 0xbd:
+        case 0xbe:
+        case 0xbf:
+            in.len = 3;
+            s += fmt("r[%d] = 0x%04x;\n", n, ::read16(p + 1));
+            return true;
+        case 0xc0: // byte r/m, imm8 (80186)
+        case 0xc1: // r/m, imm8 (80186)
+            in.len = modrm(s, o1, p, b & 1) + 1;
+            return shift(in, o1, (p[1] >> 3) & 7, fmt("%d", p[in.len - 1]), p[in.len - 1]);
+        case 0xc2: // ret imm16
+            in.len = 3;
+            s += fmt("b = RD16(r[4]);\nr[4] += 2;\nr[4] += %d;\n", ::read16(p + 1));
+            in.flow = JUMP;
+            in.jump = "b";
+            return true;
+        case 0xc3: // ret
+            s += fmt("if (r[4] == vm.start_sp) AOT_EXIT(0x%04x);\n", pc);
+            s += "b = RD16(r[4]);\nr[4] += 2;\n";
+            in.flow = JUMP;
+            in.jump = "b";
+            return true;
+        case 0xc6: // mov r/m, imm8
+            in.len = modrm(s, o1, p, 0) + 1;
+            s += set(o1, fmt("%d", p[in.len - 1]));
+            return true;
+        case 0xc7: // mov r/m, imm16
+            in.len = modrm(s, o1, p, 1) + 2;
+            s += set(o1, fmt("0x%04x", ::read16(p + in.len - 2)));
+            return true;
+        case 0xc8: // enter imm16, 0 (80186)
+            if (p[3] & 31) return false;
+            in.len = 4;
+            push(s, "r[5]");
+            s += fmt("r[5] = r[4];\nr[4] -= %d;\n", ::read16(p + 1));
+            return true;
+        case 0xc9: // leave (80186)
+            s += "r[4] = r[5];\nval = RD16(r[4]);\nr[4] += 2;\nr[5] = val;\n";
+            return true;
+        case 0xd0: // byte r/m, 1
+        case 0xd1: // r/m, 1
+            in.len = modrm(s, o1, p, b & 1);
+            return shift(in, o1, (p[1] >> 3) & 7, "1", 1);
+        case 0xd2: // byte r/m, cl
+        case 0xd3: // r/m, cl
+            in.len = modrm(s, o1, p, b & 1);
+            return shift(in, o1, (p[1] >> 3) & 7, "uint8_t(r[1])", -1);
+        case 0xd4: // aam
+            if (!p[1]) return false;
+            in.len = 2;
+            s += fmt("src = uint8_t(r[0]);\nval = src %% %d;\n", p[1]);
+            s += fmt("r[0] = uint8_t(src / %d) << 8 | uint8_t(val);\n", p[1]);
+            setf(in, false, "val");
+            return true;
+        case 0xd5: // aad
+            in.len = 2;
+            s += fmt("val = uint8_t(r[0]) + (r[0] >> 8) * %d;\n", p[1]);
+            s += "r[0] = uint8_t(val);\n";
+            setf(in, false, "val");
+            return true;
+        case 0xd7: // xlat
+            s += "r[0] = (r[0] & 0xff00) | mem[r[3] + uint8_t(r[0])];\n";
+            return true;
+        case 0xd8: // esc (8087 FPU)
+        case 0xd9:
+        case 0xda:
+        case 0xdb:
+        case 0xdc:
+        case 0xdd:
+        case 0xde:
+        case 0xdf:
+            in.len = 2;
+            return true;
+        case 0xe0: // loopnz/loopne
+            in.len = 2;
+            s += "r[1]--;\n";
+            branch(in, pc + 2 + int8_t(p[1]), "r[1] > 0 && !ZF", FZ);
+            return true;
+        case 0xe1: // loopz/loope
+            in.len = 2;
+            s += "r[1]--;\n";
+            branch(in, pc + 2 + int8_t(p[1]), "r[1] > 0 && ZF", FZ);
+            return true;
+        case 0xe2: // loop
+            in.len = 2;
+            s += "r[1]--;\n";
+            branch(in, pc + 2 + int8_t(p[1]), "r[1] > 0", 0);
+            return true;
+        case 0xe3: // jcxz
+            in.len = 2;
+            branch(in, pc + 2 + int8_t(p[1]), "r[1] == 0", 0);
+            return true;
+        case 0xe8: // call disp
+            in.len = 3;
+            next = uint16_t(pc + 3);
+            push(s, fmt("0x%04x", next));
+            branch(in, next + ::read16(p + 1), NULL, 0);
+            in.ret = next;
+            return true;
+        case 0xe9: // jmp disp
+            in.len = 3;
+            branch(in, pc + 3 + ::read16(p + 1), NULL, 0);
+            return true;
+        case 0xeb: // jmp short
+            in.len = 2;
+            branch(in, pc + 2 + int8_t(p[1]), NULL, 0);
+            return true;
+        case 0xf2: // repnz/repne
+        case 0xf3: // rep/repz/repe
+            in.len = 2;
+            return strop(in, p[1], b);
+        case 0xf5: // cmc
+            in.flags[5] = "!CF";
+            in.reads = FC;
+            return true;
+        case 0xf6:
+        case 0xf7:
+        {
+            bool w = b & 1;
+            in.len = modrm(s, o1, p, w);
+            switch ((p[1] >> 3) & 7) {
+                case 0: // test r/m, imm
+                {
+                    Opr imm = {Imm, w, w ? ::read16(p + in.len) : p[in.len]};
+                    in.len += 1 + w;
+                    test(in, o1, imm);
+                    return true;
+                }
+                case 2: // not r/m
+                    s += set(o1, "~" + get(o1, true));
+                    return true;
+                case 3: // neg r/m
+                    s += "src = " + get(o1, true) + ";\nval = -src;\n";
+                    in.flags[3] = "(src & 15) != 0";
+                    in.flags[5] = "src != 0";
+                    setf(in, w, "val");
+                    s += set(o1, "val");
+                    return true;
+                case 4: // mul r/m
+                    if (!w) {
+                        s += "r[0] = uint8_t(r[0]) * " + get(o1, false) + ";\n";
+                        in.flags[0] = in.flags[5] = "(r[0] >> 8) != 0";
+                    } else {
+                        s += "u32 = uint32_t(r[0]) * " + get(o1, false) + ";\n";
+                        s += "r[2] = u32 >> 16;\nr[0] = u32;\n";
+                        in.flags[0] = in.flags[5] = "r[2] != 0";
+                    }
+                    return true;
+                case 5: // imul r/m
+                    if (!w) {
+                        s += "r[0] = int8_t(r[0]) * " + get(o1, true) + ";\n";
+                        in.flags[0] = in.flags[5] = "(r[0] >> 8) != 0";
+                    } else {
+                        s += "val = int16_t(r[0]) * " + get(o1, true) + ";\n";
+                        s += "r[2] = val >> 16;\nr[0] = val;\n";
+                        in.flags[0] = in.flags[5] = "r[2] != 0";
+                    }
+                    return true;
+                case 6: // div r/m
+                    if (!w) {
+                        s += "dst = r[0];\nsrc = " + get(o1, false) + ";\n";
+                        s += "r[0] = uint8_t(dst % src) << 8 | uint8_t(dst / src);\n";
+                    } else {
+                        s += "u32 = uint32_t(r[2]) << 16 | r[0];\n";
+                        s += "src = " + get(o1, false) + ";\n";
+                        s += "r[0] = u32 / src;\nr[2] = u32 % src;\n";
+                    }
+                    return true;
+                case 7: // idiv r/m
+                    if (!w) {
+                        s += "val = int16_t(r[0]);\nsrc = " + get(o1, true) + ";\n";
+                        s += "r[0] = uint8_t(val % src) << 8 | uint8_t(val / src);\n";
+                    } else {
+                        s += "i32 = int32_t(uint32_t(r[2]) << 16 | r[0]);\n";
+                        s += "src = " + get(o1, true) + ";\n";
+                        s += "r[0] = i32 / src;\nr[2] = i32 % src;\n";
+                    }
+                    return true;
+            }
+            return false;
+        }
+        case 0xf8: // clc
+            in.flags[5] = "false";
+            return true;
+        case 0xf9: // stc
+            in.flags[5] = "true";
+            return true;
+        case 0xfc: // cld
+            s += "DF = false;\n";
+            return true;
+        case 0xfd: // std
+            s += "DF = true;\n";
+            return true;
+        case 0xfe: // byte r/m
+        case 0xff: // r/m
+        {
+            bool w = b & 1;
+            in.len = modrm(s, o1, p, w);
+            next = uint16_t(pc + in.len);
+            switch ((p[1] >> 3) & 7) {
+                case 0: // inc
+                    s += "val = " + get(o1, true) + " + 1;\n";
+                    setf(in, w, "val");
+                    in.flags[3] = "!(val & 15)";
+                    s += set(o1, "val");
+                    return true;
+                case 1: // dec
+                    s += "val = " + get(o1, true) + " - 1;\n";
+                    setf(in, w, "val");
+                    in.flags[3] = "(val & 15) == 15";
+                    s += set(o1, "val");
+                    return true;
+                case 2: // call
+                    if (!w) return false;
+                    push(s, fmt("0x%04x", next));
+                    s += "b = " + get(o1, false) + ";\n";
+                    in.flow = JUMP;
+                    in.jump = "b";
+                    in.ret = next;
+                    return true;
+                case 4: // jmp
+                    if (!w) return false;
+                    s += "b = " + get(o1, false) + ";\n";
+                    in.flow = JUMP;
+                    in.jump = "b";
+                    return true;
+                case 6: // push
+                    if (!w) return false;
+                    s += "val = " + get(o1, false) + ";\n";
+                    push(s, "val");
+                    return true;
+            }
+            return false;
+        }
+    }
+    return false;
+}
+
+namespace {
+    class Gen {
+        VM *vm;
+        int start, end;
+        std::set<int> seeds, visited;
+        std::vector<int> work;
+
+    public:
+        Gen(VM *vm, int start, int end) : vm(vm), start(start), end(end) {
+        }
+
+        bool code(int pc) {
+            return start <= pc && pc < end;
+        }
+
+        void seed(int pc) {
+            if (code(pc) && seeds.insert(pc).second) work.push_back(pc);
+        }
+
+        // recursive disassembly from the seeds
+        void walk() {
+            while (!work.empty()) {
+                int pc = work.back();
+                work.pop_back();
+                while (code(pc) && visited.insert(pc).second) {
+                    Insn in;
+                    if (!insn(vm, in, pc) || pc + in.len > end) {
+                        // int and the others continue after the interpreter
+                        OpCode op = disasm1(vm->text, pc, end);
+                        if (op.len) seed(pc + op.len);
+                        break;
+                    }
+                    int next = pc + in.len;
+                    if (in.ret >= 0) seed(in.ret);
+                    if (in.flow == CONT) {
+                        pc = next;
+                        continue;
+                    }
+                    if (in.flow == GOTO || in.flow == COND) seed(in.target);
+                    if (in.flow == COND) seed(next);
+                    break;
+                }
+            }
+        }
+
+        // code addresses in the data (function pointers and the tables of
+        // csa and csb) and in mov reg16, imm16, where a linear sweep of the
+        // text has an instruction
+        void pointers() {
+            std::set<int> insns;
+            std::vector<int> imms;
+            for (int pc = start; pc < end;) {
+                OpCode op = disasm1(vm->text, pc, end);
+                insns.insert(pc);
+                if ((vm->text[pc] & 0xf8) == 0xb8 && op.len == 3) {
+                    imms.push_back(::read16(vm->text + pc + 1));
+                }
+                pc += op.len ? op.len : 1;
+            }
+            int doff = vm->data == vm->text ? vm->tsize : 0;
+            for (int i = doff; i < doff + int(vm->dsize) && i < 0xffff; i += 2) {
+                int t = ::read16(vm->data + i);
+                if (insns.count(t)) seed(t);
+            }
+            for (size_t i = 0; i < imms.size(); i++) {
+                if (insns.count(imms[i])) seed(imms[i]);
+            }
+        }
+
+        void flow(FILE *f, int target) {
+            if (seeds.count(target)) {
+                fprintf(f, "    AOT_GOTO(0x%04x, L%04x);\n", target, target);
+            } else {
+                fprintf(f, "    AOT_JUMP(0x%04x);\n", target & 0xffff);
+            }
+        }
+
+        void block(FILE *f, int addr) {
+            std::vector<Insn> ins;
+            std::vector<std::string> dis;
+            int pc = addr, count = 0;
+            while (ins.empty() || (ins.back().flow == CONT && code(pc) && !seeds.count(pc))) {
+                OpCode op = disasm1(vm->text, pc, end);
+                Insn in;
+                if (!insn(vm, in, pc) || pc + in.len > end) {
+                    in = Insn();
+                    in.flow = INTERP;
+                    in.count = 0;
+                    in.reads = FALL;
+                    in.target = pc;
+                }
+                ins.push_back(in);
+                dis.push_back(fmt("%04x: ", pc) + vm->disstr(op));
+                pc += in.len;
+            }
+            // the flags read before they are overwritten
+            int live = FALL;
+            std::vector<int> emit(ins.size());
+            for (int i = ins.size() - 1; i >= 0; i--) {
+                emit[i] = ins[i].writes() & live;
+                live = (live & ~(ins[i].writes() | ins[i].kills)) | ins[i].reads;
+                count += ins[i].count;
+            }
+            fprintf(f, "L%04x:\n", addr);
+            if (count) fprintf(f, "    AOT_BLOCK(0x%04x, %d);\n", addr, count);
+            static const char *fn[] = {"OF", "SF", "ZF", "AF", "PF", "CF"};
+            for (size_t i = 0; i < ins.size(); i++) {
+                const Insn &in = ins[i];
+                fprintf(f, "    // %s\n", dis[i].c_str());
+                if (in.code.empty() && !emit[i]) continue;
+                fprintf(f, "    {\n");
+                std::string::size_type p = 0, q;
+                while ((q = in.code.find('\n', p)) != std::string::npos) {
+                    fprintf(f, "        %s\n", in.code.substr(p, q - p).c_str());
+                    p = q + 1;
+                }
+                for (int j = 0; j < 6; j++) {
+                    if (emit[i] & (1 << j)) {
+                        fprintf(f, "        %s = %s;\n", fn[j], in.flags[j].c_str());
+                    }
+                }
+                fprintf(f, "    }\n");
+            }
+            const Insn &last = ins.back();
+            switch (last.flow) {
+                case CONT:
+                    flow(f, pc);
+                    break;
+                case GOTO:
+                    flow(f, last.target);
+                    break;
+                case COND:
+                    fprintf(f, "    if (%s)\n    ", last.cond.c_str());
+                    flow(f, last.target);
+                    flow(f, pc);
+                    break;
+                case JUMP:
+                    fprintf(f, "    AOT_JUMP(%s);\n", last.jump.c_str());
+                    break;
+                case INTERP:
+                    fprintf(f, "    AOT_INTERP(0x%04x);\n", last.target);
+                    break;
+            }
+        }
+
+        int gen(FILE *f, const std::string &name, int entry) {
+            seed(entry);
+            std::map<int, Symbol>::iterator it;
+            for (it = vm->syms[1].begin(); it != vm->syms[1].end(); ++it) {
+                seed(it->first);
+            }
+            pointers();
+            walk();
+            uint32_t hash = aothash(vm->text + start, end - start);
+            fprintf(f, "// %s translated by 7aot: %d blocks, do not edit\n",
+                    name.c_str(), int(seeds.size()));
+            fprintf(f, "#include \"../i8086/aot.h\"\n\n");
+            fprintf(f, "namespace {\n\n");
+            fprintf(f, "void run(VMBase *base) {\n");
+            fprintf(f, "    AOT_ENTER;\n");
+            fprintf(f, "    goto poll;\n");
+            fprintf(f, "    AOT_RUNTIME\n");
+            fprintf(f, "    switch (vm.IP) {\n");
+            std::set<int>::iterator s;
+            for (s = seeds.begin(); s != seeds.end(); ++s) {
+                fprintf(f, "        case 0x%04x: goto L%04x;\n", *s, *s);
+            }
+            fprintf(f, "    }\n");
+            fprintf(f, "    goto interp;\n");
+            for (s = seeds.begin(); s != seeds.end(); ++s) block(f, *s);
+            fprintf(f, "}\n\n");
+            fprintf(f, "AotImage image(\"%s\", 0x%04x, %d, 0x%08xu, run);\n",
+                    name.c_str(), start, end - start, hash);
+            fprintf(f, "}\n");
+            return seeds.size();
+        }
+    };
+}
+
+// 7aot: the translation of the loaded text [start, end) to f
+int VM::aotgen(FILE *f, const std::string &name, int start, int end) {
+    Gen gen(this, start, end);
+    return gen.gen(f, name, IP);
+}
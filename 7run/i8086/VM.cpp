@@ -1,4 +1,7 @@
 #include "VM.h"
+#include "../UnixBase.h"
+#include "../Lockstep.h"
+#include "../Aot.h"
 #include "disasm.h"
 #include "regs.h"
 #include <stdio.h>
@@ -22,7 +25,7 @@ void VM::debug(uint16_t ip, const OpCode &op) {
             r[0], r[3], r[1], r[2], r[4], r[5], r[6], r[7],
             "-O"[OF], "-S"[SF], "-Z"[ZF], "-C"[CF],
             ip, hexdump(text + ip, op.len).c_str(), op.str().c_str());
-    if (trace >= 3) {
+    if (ctx->trace >= 3) {
         int ad1 = addr(op.opr1);
         int ad2 = addr(op.opr2);
         if (ad1 >= 0) {
@@ -41,19 +44,20 @@ void VM::debug(uint16_t ip, const OpCode &op) {
     fprintf(stderr, "\n");
 }
 
-static bool initialized;
-
-void VM::init() {
-    if (!initialized) {
+// filled before main, not at the first VM: guests may start on any thread
+static struct PTable {
+    PTable() {
         for (int i = 0; i < 256; i++) {
             int n = 0;
             for (int j = 1; j < 256; j += j) {
                 if (i & j) n++;
             }
-            ptable[i] = (n & 1) == 0;
+            VM::ptable[i] = (n & 1) == 0;
         }
-        initialized = true;
     }
+} ptableinit;
+
+void VM::init() {
     uint16_t tmp = 0x1234;
     uint8_t *p = (uint8_t *) r;
     if (*(uint8_t *) & tmp == 0x34) {
@@ -87,6 +91,7 @@ VM::VM(const VM &vm) : VMBase(vm) {
     PF = vm.PF;
     CF = vm.CF;
     start_sp = vm.start_sp;
+    hlemap = vm.hlemap;
 }
 
 VM::~VM() {
@@ -95,6 +100,7 @@ VM::~VM() {
 bool VM::load(const std::string& fn, FILE* f, size_t size) {
     if (!VMBase::load(fn, f, size)) return false;
     IP = 0;
+    hlescan();
     return true;
 }
 
@@ -114,7 +120,97 @@ int VM::addr(const Operand &opr) {
 }
 
 void VM::run2() {
-    while (!hasExited) run1();
+    if (lockstep) {
+        run2lockstep();
+        return;
+    }
+    if (!xtracepath.empty()) {
+        run2trace();
+        return;
+    }
+    if (statsmode || cyclemodel) {
+        run2stats();
+        return;
+    }
+    if (hlemode) {
+        run2hle();
+        return;
+    }
+    if (profcount || ctx->insnbudget != ~uint64_t(0)) {
+        run2prof();
+        return;
+    }
+    // an exec into translated code or up to --snap-at raises sigpending
+    while (!hasExited) {
+        if (aot) {
+            aot->run(this);
+            continue;
+        }
+        if (snappending) {
+            run2snap();
+            continue;
+        }
+        do {
+            run1();
+        } while (!hasExited && !UnixBase::sigpending);
+        if (UnixBase::sigpending) unix->sigcheck();
+    }
+}
+
+// run2() with -P, -G or --budget
+void VM::run2prof() {
+    while (!hasExited) {
+        if (snappending) {
+            run2snap();
+            continue;
+        }
+        run1();
+        if (UnixBase::sigpending) unix->sigcheck();
+        if (profcount && !--profcount) unix->profsample();
+        if (insns == ctx->insnbudget) unix->overbudget();
+    }
+}
+
+uint16_t VM::getpc() {
+    return IP;
+}
+
+// --snap-at: run1() up to the point, then write the snapshot
+void VM::run2snap() {
+    while (!hasExited && snappending) {
+        if (IP == snappc || insns - execinsns == snapinsns) {
+            snappending = false;
+            unix->snapshot();
+            return;
+        }
+        run1();
+        if (UnixBase::sigpending) unix->sigcheck();
+        if (insns == ctx->insnbudget) unix->overbudget();
+    }
+}
+
+// the target of the first call from the entry: main() after crt0
+int VM::findmain() {
+    uint16_t ip = IP;
+    for (int i = 0; i < 64; i++) {
+        // call addr
+        if (text[ip] == 0xe8) return uint16_t(ip + 3 + ::read16(text + ip + 1));
+        // not a C start-up: jmp, ret or int first
+        switch (text[ip]) {
+            case 0xe9: case 0xea: case 0xeb: case 0xc2: case 0xc3: case 0xcd:
+                return -1;
+        }
+        ip += disasm1(text, ip, tsize).len;
+    }
+    return -1;
+}
+
+std::string VM::disline(uint16_t ip) {
+    OpCode op = disasm1(text, ip, tsize);
+    char buf[128];
+    snprintf(buf, sizeof (buf), "%04x:%-12s %s",
+            ip, hexdump(text + ip, op.len).c_str(), disstr(op).c_str());
+    return buf;
 }
 
 void VM::disasm() {
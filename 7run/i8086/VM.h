@@ -4,12 +4,14 @@
 
 namespace i8086 {
     extern const char *header;
+    extern bool hlemode; // --hle
 
     struct VM : public VMBase {
         uint16_t IP, r[8];
         uint8_t * r8[8];
         bool OF, DF, SF, ZF, AF, PF, CF;
         uint16_t start_sp;
+        std::vector<uint8_t> hlemap;
 
         static bool ptable[256];
         void init();
@@ -22,6 +24,24 @@ namespace i8086 {
         virtual void disasm();
         virtual void showHeader();
         virtual void run2();
+        virtual uint16_t getpc();
+        virtual std::string disline(uint16_t pc);
+        virtual int findmain();
+        void run2stats();
+        Stats::Inst *statinst(uint16_t pc);
+        void run2trace();
+        static bool implicit(uint8_t b);
+        void run2lockstep();
+        void run2snap();
+        void run2prof();
+        void hlescan();
+        void hletakeover(const VM &ref, int n);
+        bool runhle();
+        void run2hle();
+        int hletest();
+        int aotgen(FILE *f, const std::string &name, int start, int end);
+        void getstate(uint16_t *st);
+        void setstate(const uint16_t *st);
 
         std::string disstr(const OpCode &op);
         void run1(uint8_t rep = 0);
@@ -47,7 +67,7 @@ namespace i8086 {
             return value;
         }
 
-        inline uint16_t getf() {
+        inline uint16_t getf() const {
             return 0xf002 | (OF << 11) | (DF << 10) | (SF << 7) |
                     (ZF << 6) | (AF << 4) | (PF << 2) | CF;
         }
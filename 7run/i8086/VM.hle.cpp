@@ -0,0 +1,508 @@
+#include "VM.h"
+#include "../UnixBase.h"
+#include "regs.h"
+#include <stdio.h>
+#include <string.h>
+
+using namespace i8086;
+
+bool i8086::hlemode;
+
+// high-level emulation (--hle): hot routines of the ACK libc and libem run
+// natively when IP enters them. a routine is found by its symbol or by the
+// hash of its whole text, so a signature only matches an identical copy.
+// ACK calling convention: arguments on the stack, the result in ax or
+// dx:ax, bx, cx, dx and the flags are scratch, si, di and bp are kept.
+// a native routine returns false to leave an unusual case to the guest.
+
+static inline uint16_t arg(VM *vm, int i) {
+    return vm->read16(vm->SP + 2 + i * 2);
+}
+
+static inline uint32_t arg32(VM *vm, int i) {
+    return arg(vm, i) | uint32_t(arg(vm, i + 1)) << 16;
+}
+
+// ret n
+static inline void ret(VM *vm, int n = 0) {
+    vm->IP = vm->read16(vm->SP);
+    vm->SP += 2 + n;
+}
+
+static inline void ret32(VM *vm, uint32_t v) {
+    vm->AX = v;
+    vm->DX = v >> 16;
+    ret(vm, 8);
+}
+
+static uint16_t strnlen(VM *vm, uint16_t s, uint16_t max) {
+    uint16_t len = 0;
+    while (len < max && vm->read8(s + len)) ++len;
+    return len;
+}
+
+static void copy(VM *vm, uint16_t dst, uint16_t src, uint16_t n) {
+    if (uint16_t(dst - src) < n) {
+        for (uint16_t i = n; i > 0; i--) {
+            vm->write8(dst + i - 1, vm->read8(src + i - 1));
+        }
+    } else {
+        for (uint16_t i = 0; i < n; i++) {
+            vm->write8(dst + i, vm->read8(src + i));
+        }
+    }
+}
+
+// __memmove(dst, src, n): also the tail of memcpy
+static bool hle_memmove(VM *vm) {
+    copy(vm, arg(vm, 0), arg(vm, 1), arg(vm, 2));
+    vm->AX = arg(vm, 0);
+    ret(vm);
+    return true;
+}
+
+// __strncmp(s1, s2), cx: n
+static bool hle_strncmp(VM *vm) {
+    uint16_t s1 = arg(vm, 0), s2 = arg(vm, 1);
+    vm->AX = 0;
+    for (uint16_t i = 0; i < vm->CX; i++) {
+        uint8_t c1 = vm->read8(s1 + i), c2 = vm->read8(s2 + i);
+        if (c1 != c2) {
+            vm->AX = c1 > c2 ? 1 : -1;
+            break;
+        }
+        if (!c1) break;
+    }
+    ret(vm);
+    return true;
+}
+
+// __strnlen(s), cx: max
+static bool hle_strnlen(VM *vm) {
+    vm->AX = strnlen(vm, arg(vm, 0), vm->CX);
+    ret(vm);
+    return true;
+}
+
+// .mli4: dx:ax * 4(sp)
+static bool hle_mli4(VM *vm) {
+    uint32_t v = (vm->AX | uint32_t(vm->DX) << 16) * arg32(vm, 0);
+    vm->AX = v;
+    vm->DX = v >> 16;
+    ret(vm, 4);
+    return true;
+}
+
+// .dvu4, .rmu4, .dvi4, .rmi4: 4(sp) is the divisor, 8(sp) the dividend
+static bool hle_dvu4(VM *vm) {
+    uint32_t d = arg32(vm, 0);
+    if (!d) return false;
+    ret32(vm, arg32(vm, 2) / d);
+    return true;
+}
+
+static bool hle_rmu4(VM *vm) {
+    uint32_t d = arg32(vm, 0);
+    if (!d) return false;
+    ret32(vm, arg32(vm, 2) % d);
+    return true;
+}
+
+static bool hle_dvi4(VM *vm) {
+    int64_t d = int32_t(arg32(vm, 0));
+    if (!d) return false;
+    ret32(vm, uint32_t(int64_t(int32_t(arg32(vm, 2))) / d));
+    return true;
+}
+
+static bool hle_rmi4(VM *vm) {
+    int64_t d = int32_t(arg32(vm, 0));
+    if (!d) return false;
+    ret32(vm, uint32_t(int64_t(int32_t(arg32(vm, 2))) % d));
+    return true;
+}
+
+// .blm: copy cx words from 4(sp) to 2(sp)
+static bool hle_blm(VM *vm) {
+    if (vm->DF) return false;
+    uint16_t dst = arg(vm, 0), src = arg(vm, 1);
+    for (; vm->CX; vm->CX--, dst += 2, src += 2) {
+        vm->write16(dst, vm->read16(src));
+    }
+    ret(vm, 4);
+    return true;
+}
+
+// strlen(s)
+static bool hle_strlen(VM *vm) {
+    vm->AX = strnlen(vm, arg(vm, 0), 0xffff);
+    ret(vm);
+    return true;
+}
+
+// memcpy(dst, src, n): forward like the guest's
+static bool hle_memcpy(VM *vm) {
+    uint16_t dst = arg(vm, 0), src = arg(vm, 1), n = arg(vm, 2);
+    for (uint16_t i = 0; i < n; i++) vm->write8(dst + i, vm->read8(src + i));
+    vm->AX = dst;
+    ret(vm);
+    return true;
+}
+
+// bcopy(src, dst, n)
+static bool hle_bcopy(VM *vm) {
+    copy(vm, arg(vm, 1), arg(vm, 0), arg(vm, 2));
+    vm->AX = arg(vm, 1);
+    ret(vm);
+    return true;
+}
+
+// self-test inputs: reproducible xorshift
+struct Rand {
+    uint32_t x;
+
+    Rand(uint32_t seed) : x(seed * 2654435761u + 1) {
+    }
+
+    uint32_t operator()() {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return x;
+    }
+
+    // varied magnitude and sign
+    uint32_t value() {
+        uint32_t v = (*this)() >> ((*this)() % 32);
+        return (*this)() & 1 ? -v : v;
+    }
+};
+
+// buf: 1 KiB of scratch memory, the stack is set up by the caller
+static void fill(VM *vm, Rand &r, uint16_t buf) {
+    for (int i = 0; i < 1024; i++) vm->write8(buf + i, r());
+}
+
+// a string without the first byte of zero
+static void str(VM *vm, Rand &r, uint16_t s, int len) {
+    for (int i = 0; i < len; i++) vm->write8(s + i, r() % 255 + 1);
+    vm->write8(s + len, 0);
+}
+
+static uint16_t count(Rand &r) {
+    return r() & 3 ? r() % 48 : 0xffff;
+}
+
+static void test_memmove(VM *vm, Rand &r, uint16_t buf) {
+    fill(vm, r, buf);
+    vm->push(r() % 200);
+    vm->push(buf + r() % 256);
+    vm->push(buf + r() % 256);
+}
+
+static void test_strncmp(VM *vm, Rand &r, uint16_t buf) {
+    int len = r() % 40, same = r() % (len + 1);
+    str(vm, r, buf, len);
+    memcpy(vm->data + buf + 512, vm->data + buf, len + 1);
+    if (same < len) vm->write8(buf + 512 + same, r());
+    vm->CX = count(r);
+    vm->push(buf + 512);
+    vm->push(buf);
+}
+
+static void test_strnlen(VM *vm, Rand &r, uint16_t buf) {
+    str(vm, r, buf, r() % 40);
+    vm->CX = count(r);
+    vm->push(buf);
+}
+
+static void test_mli4(VM *vm, Rand &r, uint16_t) {
+    uint32_t v = r.value();
+    vm->push(v >> 16);
+    vm->push(v);
+    v = r.value();
+    vm->AX = v;
+    vm->DX = v >> 16;
+}
+
+static void test_div4(VM *vm, Rand &r, uint16_t) {
+    uint32_t v = r.value(), d = r.value();
+    if (!(r() % 16)) v = 0x80000000;
+    vm->push(v >> 16);
+    vm->push(v);
+    vm->push(d >> 16);
+    vm->push(d);
+}
+
+static void test_blm(VM *vm, Rand &r, uint16_t buf) {
+    fill(vm, r, buf);
+    vm->CX = r() % 64;
+    vm->push(buf + r() % 256);
+    vm->push(buf + r() % 256);
+}
+
+static void test_strlen(VM *vm, Rand &r, uint16_t buf) {
+    str(vm, r, buf, r() % 40);
+    vm->push(buf);
+}
+
+static void test_memcpy(VM *vm, Rand &r, uint16_t buf) {
+    fill(vm, r, buf);
+    vm->push(r() % 200);
+    vm->push(buf + r() % 256);
+    vm->push(buf + 512 + r() % 256);
+}
+
+static void test_bcopy(VM *vm, Rand &r, uint16_t buf) {
+    fill(vm, r, buf);
+    vm->push(r() % 200);
+    vm->push(buf + r() % 256);
+    vm->push(buf + r() % 256);
+}
+
+struct Routine {
+    const char *name, *sig; // sig: the text in hex, NULL: by symbol only
+    int results; // words: ax, dx:ax
+    int args; // words the caller pops, the callee may change them
+    bool (*run)(VM *vm);
+    void (*test)(VM *vm, Rand &r, uint16_t buf);
+};
+
+// the signatures are from the MINIX 2 libc and the ACK libem in distrib
+static const Routine routines[] = {
+    {"__memmove",
+        "5589e556578b7e048b76068b4e0889f829f039c8721dfc83f910720e89f009f8"
+        "a8017506d1e9f2a511c9f2a48b46045f5e5dc3fd01ce4e01cf4ff2a4fcebed",
+        1, 3, hle_memmove, test_memmove},
+    {"__strncmp",
+        "5589e5565731c085c9741b8b76048b7e06fca6750b807cff00740b4975f4eb06"
+        "77032d0200405f5e5dc3",
+        1, 2, hle_strncmp, test_strncmp},
+    {"__strnlen",
+        "5589e5578b7e0430c089ca80f901fcf2ae75014189d029c85f5dc3",
+        1, 1, hle_strnlen, test_strnlen},
+    {".mli4",
+        "89e35289c1f767045a5089d0f767025a01c289c889d1f7670201cac20400",
+        2, 0, hle_mli4, test_mli4},
+    {".dvu4",
+        "565789e68b5c068b440809c0751431d28b4c0a8b440cf7f391f7f389ca5f5ec2"
+        "080089c731db8b440a8b540cb91000d1e0d1d2d1d339df770772093954067604"
+        "e2edebd72b540619fb40e2e3ebcd",
+        2, 0, hle_dvu4, test_div4},
+    {".rmu4",
+        "565789e68b5c068b440809c0751831d28b4c0a8b440cf7f391f7f331db89d089"
+        "da5f5ec2080089c731db8b440a8b540cb91000d1e0d1d2d1d339df7707720939"
+        "54067604e2edebd52b540619fb40e2e3ebcb",
+        2, 0, hle_rmu4, test_div4},
+    {".dvi4",
+        "565789e68b5c068b44089989d739c2753321d27d04f7db742b31d28b4c0a8b44"
+        "0c21c07d08f7d8f7d919d0f7d7f7f391f7f321ff7d07f7d9f7d883d90089ca5f"
+        "5ec208005289c731db21ff7d07f7dff75c0619df8b440a8b540c21d27d09f7da"
+        "f7d819daf754feb91000d1e0d1d2d1d339df770772093954067604e2edeb082b"
+        "540619fb40e2e35feba8",
+        2, 0, hle_dvi4, test_div4},
+    {".rmi4",
+        "565789e68b5c068b44089939c2753721d27d04f7db742f31d28b4c0a8b440c21"
+        "c07d06f7d8f7d919d0f7f391f7f331db837c0c007d07f7dbf7da83db0089d089"
+        "da5f5ec2080089c731db21ff7d07f7dff75c0619df8b440a8b540c21d27d06f7"
+        "daf7d819dab91000d1e0d1d2d1d339df770772093954067604e2edebb32b5406"
+        "19fb40e2e3eba9",
+        2, 0, hle_rmi4, test_div4},
+    {".blm",
+        "89e389f089fa8b7f028b7704f2a589c689d7c20400",
+        0, 0, hle_blm, test_blm},
+    {"_strlen", NULL, 1, 1, hle_strlen, test_strlen},
+    {"_memcpy", NULL, 1, 3, hle_memcpy, test_memcpy},
+    {"_memmove", NULL, 1, 3, hle_memmove, test_memmove},
+    {"_bcopy", NULL, 0, 3, hle_bcopy, test_bcopy},
+};
+
+static const int NROUTINES = sizeof (routines) / sizeof (routines[0]);
+
+static uint32_t fnv(const uint8_t *p, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+struct Signature {
+    uint8_t head[2];
+    size_t len;
+    uint32_t hash;
+};
+
+static std::vector<Signature> signatures;
+static std::vector<int> byhead[256]; // routines by the first byte
+
+// built before main like the parity table
+static struct Signatures {
+    Signatures();
+} sigsinit;
+
+Signatures::Signatures() {
+    signatures.resize(NROUTINES);
+    for (int i = 0; i < NROUTINES; i++) {
+        const char *sig = routines[i].sig;
+        if (!sig) continue;
+        std::vector<uint8_t> bytes;
+        for (; sig[0] && sig[1]; sig += 2) {
+            unsigned b;
+            sscanf(sig, "%2x", &b);
+            bytes.push_back(b);
+        }
+        Signature &s = signatures[i];
+        s.head[0] = bytes[0];
+        s.head[1] = bytes[1];
+        s.len = bytes.size();
+        s.hash = fnv(&bytes[0], s.len);
+        byhead[s.head[0]].push_back(i);
+    }
+}
+
+// after loading an image: hlemap[addr] is the routine at addr + 1
+void VM::hlescan() {
+    hlemap.clear();
+    if (!hlemode) return;
+    hlemap.resize(0x10000);
+    std::map<int, Symbol>::iterator it;
+    for (it = syms[1].begin(); it != syms[1].end(); ++it) {
+        for (int i = 0; i < NROUTINES; i++) {
+            if (it->second.name == routines[i].name) {
+                hlemap[it->first] = i + 1;
+            }
+        }
+    }
+    for (size_t a = 0; a + 1 < tsize; a++) {
+        const std::vector<int> &rs = byhead[text[a]];
+        for (size_t j = 0; j < rs.size(); j++) {
+            const Signature &s = signatures[rs[j]];
+            if (text[a + 1] == s.head[1] && a + s.len <= tsize
+                    && fnv(text + a, s.len) == s.hash) {
+                hlemap[a] = rs[j] + 1;
+            }
+        }
+    }
+    if (ctx->trace) {
+        for (int a = 0; a < 0x10000; a++) {
+            if (hlemap[a]) {
+                fprintf(stderr, "<hle: %s at %04x>\n", routines[hlemap[a] - 1].name, a);
+            }
+        }
+    }
+}
+
+// the native routine at IP, false: none or it declined
+bool VM::runhle() {
+    int n = hlemap.empty() ? 0 : hlemap[IP];
+    if (!n) return false;
+    recent[insns % FLIGHT_PCS] = IP;
+    if (ctx->trace >= 2) {
+        fprintf(stderr, "%04x: hle %s\n", IP, routines[n - 1].name);
+    }
+    if (!routines[n - 1].run(this)) return false;
+    ++insns;
+    return true;
+}
+
+// run2() calling native routines
+void VM::run2hle() {
+    while (!hasExited) {
+        if (!runhle()) run1();
+        if (UnixBase::sigpending) unix->sigcheck();
+        if (profcount && !--profcount) unix->profsample();
+        if (insns == ctx->insnbudget) unix->overbudget();
+    }
+}
+
+// --lockstep: after the native routine n - 1 and its guest code in ref,
+// takes over what the calling convention leaves open: bx, cx, the flags,
+// the unused result words, the arguments and the frame below sp
+void VM::hletakeover(const VM &ref, int n) {
+    const Routine &rt = routines[n - 1];
+    BX = ref.BX;
+    CX = ref.CX;
+    if (rt.results < 2) DX = ref.DX;
+    if (rt.results < 1) AX = ref.AX;
+    setf(ref.getf());
+    for (int i = -256; i < rt.args * 2; i++) {
+        data[uint16_t(SP + i)] = ref.data[uint16_t(SP + i)];
+    }
+}
+
+// runs the routine at addr interpreted and natively from the same state
+static bool selftest(VM *vm, const Routine &rt, uint16_t addr, uint16_t buf,
+        int cases, int *declined) {
+    static const uint16_t RET = 0xfffe, STACK = 0xff00;
+    for (int i = 0; i < cases; i++) {
+        Rand r(i + 1);
+        VM a(*vm);
+        a.materialize();
+        a.unix = vm->unix;
+        a.SP = STACK;
+        rt.test(&a, r, buf);
+        a.push(RET);
+        a.IP = addr;
+        VM b(a);
+        b.materialize();
+        b.unix = vm->unix;
+        if (!rt.run(&b)) {
+            ++*declined;
+            continue;
+        }
+        for (int n = 0; !a.hasExited && a.IP != RET && n < 1000000; n++) {
+            a.run1();
+        }
+        bool ok = a.IP == b.IP && a.SP == b.SP && a.SI == b.SI
+                && a.DI == b.DI && a.BP == b.BP;
+        if (rt.results >= 1) ok = ok && a.AX == b.AX;
+        if (rt.results >= 2) ok = ok && a.DX == b.DX;
+        // the frame of the call may differ: arguments belong to the callee
+        int diff = -1;
+        for (int ad = 0; diff < 0 && ad < 0x10000; ad++) {
+            if (ad >= STACK - 256 && ad < STACK) continue;
+            if (a.data[ad] != b.data[ad]) diff = ad;
+        }
+        if (!ok || diff >= 0) {
+            fprintf(stderr, "%s: case %d: guest ax=%04x dx=%04x sp=%04x,"
+                    " native ax=%04x dx=%04x sp=%04x", rt.name, i,
+                    a.AX, a.DX, a.SP, b.AX, b.DX, b.SP);
+            if (diff >= 0) {
+                fprintf(stderr, ", [%04x]: %02x %02x",
+                        diff, a.data[diff], b.data[diff]);
+            }
+            fprintf(stderr, "\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+// --hle-test: checks each routine found in the image against its guest code
+int VM::hletest() {
+    bool mode = hlemode;
+    hlemode = true;
+    hlescan();
+    hlemode = mode;
+    // scratch memory: anywhere in a separate data segment of the copies
+    uint16_t buf = 0x8000;
+    if (data == text) {
+        buf = (brksize + 15) & ~15;
+        if (buf < brksize || buf > 0xf000) {
+            fprintf(stderr, "no room for the self-test\n");
+            return 1;
+        }
+    }
+    int found = 0, failed = 0;
+    for (int addr = 0; addr < 0x10000; addr++) {
+        if (!hlemap[addr]) continue;
+        const Routine &rt = routines[hlemap[addr] - 1];
+        int declined = 0, cases = 1000;
+        bool ok = selftest(this, rt, addr, buf, cases, &declined);
+        printf("%-10s %04x: %s (%d cases, %d left to the guest)\n",
+                rt.name, addr, ok ? "ok" : "FAILED", cases, declined);
+        ++found;
+        if (!ok) ++failed;
+    }
+    if (!found) printf("no routines found\n");
+    return failed ? 1 : 0;
+}
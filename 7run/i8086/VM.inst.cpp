@@ -182,12 +182,14 @@ inline void VM::shift(Operand *opr, int c, uint8_t *p) {
 }
 
 void VM::run1(uint8_t rep) {
-    if (trace >= 2 && !rep) {
+    if (!rep) recent[insns++ % FLIGHT_PCS] = IP;
+    if (ctx->trace >= 2 && !rep) {
         OpCode op = disasm1(text, IP, tsize);
         debug(IP, op);
     }
     if (SP < brksize) {
         fprintf(stderr, "stack overflow: %04x\n", SP);
+        unix->flightdump();
         hasExited = true;
         return;
     }
@@ -690,6 +692,7 @@ void VM::run1(uint8_t rep) {
         case 0xc2: // ret imm16
             IP = pop();
             SP += ::read16(p + 1);
+            if (callgraph) ret(SP);
             return;
         case 0xc3: // ret
             if (SP == start_sp) {
@@ -697,6 +700,7 @@ void VM::run1(uint8_t rep) {
                 return;
             }
             IP = pop();
+            if (callgraph) ret(SP);
             return;
         case 0xc6: // mov r/m, imm8
             IP += opr1.modrm(p, 0) + 1;
@@ -774,6 +778,7 @@ void VM::run1(uint8_t rep) {
         case 0xe8: // call disp
             push(IP + 3);
             IP += 3 + ::read16(p + 1);
+            if (callgraph) call(IP, SP);
             return;
         case 0xe9: // jmp disp
             IP += 3 + ::read16(p + 1);
@@ -921,6 +926,7 @@ void VM::run1(uint8_t rep) {
                 case 2: // call
                     push(IP);
                     IP = *opr1;
+                    if (callgraph) call(IP, SP);
                     return;
                 case 4: // jmp
                     IP = *opr1;
@@ -931,12 +937,13 @@ void VM::run1(uint8_t rep) {
             }
             break;
     }
-    if (trace < 2) {
+    if (ctx->trace < 2) {
         uint16_t oldip = p - text;
         OpCode op = disasm1(text, oldip, tsize);
         fprintf(stderr, header);
         debug(oldip, op);
     }
     fprintf(stderr, "not implemented\n");
+    unix->flightdump();
     unix->sys_exit(-1);
 }
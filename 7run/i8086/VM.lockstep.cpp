@@ -0,0 +1,82 @@
+#include "VM.h"
+#include "../UnixBase.h"
+#include "../Lockstep.h"
+#include "disasm.h"
+#include "regs.h"
+
+using namespace i8086;
+
+static const char *names[XT_STATE] = {
+    "ax", "cx", "dx", "bx", "sp", "bp", "si", "di", "ip", "flags"
+};
+
+// a native routine (--hle) of the shadow: its number + 1, 0 if none ran
+static int hlestep(VM *alt) {
+    int n = alt->hlemap.empty() ? 0 : alt->hlemap[alt->IP];
+    if (!n) return 0;
+    int t = ctx->trace;
+    ctx->trace = 0;
+    bool ran = alt->runhle();
+    ctx->trace = t;
+    return ran ? n : 0;
+}
+
+// run2() against a shadow VM (--lockstep) with its own memory. with --hle
+// the shadow runs the native routines and the reference their guest code
+void VM::run2lockstep() {
+    VM alt(*this);
+    alt.unix = unix;
+    alt.materialize();
+    Lockstep ls(names);
+    uint16_t st1[XT_STATE], st2[XT_STATE];
+    int hle;
+    while (!hasExited) {
+        if (text[IP] == 0xcd) { // int
+            ls.touchall();
+            getstate(st1);
+            alt.getstate(st2);
+            if (!ls.check(this, &alt, st1, st2)) break;
+            run1();
+            getstate(st1);
+            ls.sync(this, &alt);
+            alt.setstate(st1);
+            alt.hlemap = hlemap; // exec
+        } else if (hlemode && (hle = hlestep(&alt))) {
+            for (int n = 0; n < 1000000 && !hasExited
+                    && (IP != alt.IP || SP != alt.SP); n++) {
+                run1();
+            }
+            alt.hletakeover(*this, hle);
+            ls.touchall();
+            getstate(st1);
+            alt.getstate(st2);
+            if (!ls.check(this, &alt, st1, st2)) break;
+        } else {
+            OpCode op = disasm1(text, IP, tsize);
+            ls.touch(addr(op.opr1));
+            ls.touch(addr(op.opr2));
+            if (implicit(text[IP])) ls.touchall();
+            uint16_t seqpc = IP + op.len;
+            run1();
+            int t = ctx->trace;
+            ctx->trace = 0;
+            alt.run1();
+            ctx->trace = t;
+            ls.touch(SP);
+            if (IP != seqpc || hasExited || alt.hasExited) {
+                getstate(st1);
+                alt.getstate(st2);
+                if (!ls.check(this, &alt, st1, st2)) break;
+            }
+        }
+        if (UnixBase::sigpending) {
+            unix->sigcheck();
+            getstate(st1);
+            ls.sync(this, &alt);
+            alt.setstate(st1);
+        }
+        if (profcount && !--profcount) unix->profsample();
+        if (insns == ctx->insnbudget) unix->overbudget();
+    }
+    if (!hasExited) unix->kill("lockstep divergence", 6);
+}
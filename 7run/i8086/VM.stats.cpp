@@ -0,0 +1,193 @@
+#include "VM.h"
+#include "../UnixBase.h"
+#include "disasm.h"
+#include "regs.h"
+#include <stdio.h>
+
+using namespace i8086;
+
+// run2() with the counters of --stats and --cycles
+void VM::run2stats() {
+    while (!hasExited) {
+        Stats::Inst *in = stats.inst(IP);
+        if (!in) in = statinst(IP);
+        stats.count(in);
+        // exec may free the Inst
+        uint16_t next = IP + in->len, extra = in->extra;
+        uint8_t b = text[IP];
+        uint16_t cx = CX;
+        run1();
+        if (b == 0xf2 || b == 0xf3) {
+            uint16_t n = cx - CX;
+            stats.reps += n;
+            stats.cycles += n * extra;
+        } else if (IP != next) {
+            stats.cycles += extra;
+        }
+        if (UnixBase::sigpending) unix->sigcheck();
+        if (profcount && !--profcount) unix->profsample();
+        if (insns == ctx->insnbudget) unix->overbudget();
+    }
+}
+
+static bool in(const std::string &mne, const char *list) {
+    return (" " + std::string(list) + " ").find(" " + mne + " ") != std::string::npos;
+}
+
+static bool mem(const Operand &opr) {
+    return !opr.empty() && opr.type >= Ptr;
+}
+
+// effective address calculation clocks
+static int ea(const Operand &opr) {
+    if (opr.type == Ptr) return 6;
+    int rm = opr.type - ModRM;
+    int base = rm >= 4 ? 5 : rm == 0 || rm == 3 ? 7 : 8;
+    return opr.value ? base + 4 : base;
+}
+
+// clocks after the 8086 family user's manual (data-dependent times are
+// averaged, shifts by cl count one bit, odd addresses are not penalized).
+// extra: the additional clocks of a taken branch or of each rep iteration
+static int cost(const OpCode &op, uint8_t b, uint8_t prefix, int *extra) {
+    std::string m = op.mne;
+    const Operand &d = op.opr1, &s = op.opr2;
+    int e = mem(d) ? ea(d) : mem(s) ? ea(s) : 0;
+    int c = 2;
+    *extra = 0;
+    if (m == "mov") {
+        if (0xa0 <= b && b <= 0xa3) {
+            c = 10;
+        } else if (mem(d)) {
+            c = (s.type == Imm ? 10 : 9) + e;
+        } else {
+            c = mem(s) ? 8 + e : s.type == Imm ? 4 : 2;
+        }
+    } else if (in(m, "add adc sub sbb and or xor cmp")) {
+        if (mem(d)) {
+            c = (m == "cmp" ? (s.type == Imm ? 10 : 9) : (s.type == Imm ? 17 : 16)) + e;
+        } else {
+            c = mem(s) ? 9 + e : s.type == Imm ? 4 : 3;
+        }
+    } else if (m == "test") {
+        if (e) {
+            c = (s.type == Imm ? 11 : 9) + e;
+        } else {
+            c = s.type != Imm ? 3 : b == 0xa8 || b == 0xa9 ? 4 : 5;
+        }
+    } else if (in(m, "inc dec")) {
+        c = e ? 15 + e : b < 0x50 ? 2 : 3;
+    } else if (in(m, "neg not")) {
+        c = e ? 16 + e : 3;
+    } else if (m == "push") {
+        c = e ? 16 + e : d.type == SReg ? 10 : 11;
+    } else if (m == "pop") {
+        c = e ? 17 + e : 8;
+    } else if (m == "pushf") {
+        c = 10;
+    } else if (m == "popf") {
+        c = 8;
+    } else if (m == "xchg") {
+        c = e ? 17 + e : b >= 0x90 ? 3 : 4;
+    } else if (m == "lea") {
+        c = 2 + e;
+    } else if (in(m, "lds les")) {
+        c = 16 + e;
+    } else if (in(m, "rol ror rcl rcr shl shr sar")) {
+        c = (b <= 0xd1 ? (e ? 15 : 2) : (e ? 20 : 8) + 4) + e;
+    } else if (in(m, "mul imul div idiv")) {
+        static const int c8[] = {74, 89, 85, 107}, c16[] = {128, 141, 153, 175};
+        int i = m == "mul" ? 0 : m == "imul" ? 1 : m == "div" ? 2 : 3;
+        c = (d.w ? c16 : c8)[i] + (e ? 6 + e : 0);
+    } else if (m == "jmp") {
+        c = e ? 18 + e : d.type == Reg ? 11 : 15;
+    } else if (m == "jmpf") {
+        c = e ? 24 + e : 15;
+    } else if (m == "call") {
+        c = e ? 21 + e : d.type == Reg ? 16 : 19;
+    } else if (m == "callf") {
+        c = e ? 37 + e : 28;
+    } else if (m == "ret") {
+        c = d.empty() ? 8 : 12;
+    } else if (m == "retf") {
+        c = d.empty() ? 18 : 17;
+    } else if (m == "iret") {
+        c = 24;
+    } else if (in(m, "int int3")) {
+        c = 51;
+    } else if (m == "into") {
+        c = 4;
+        *extra = 49;
+    } else if (in(m, "jcxz loopz loopnz")) {
+        c = 6;
+        *extra = 12;
+    } else if (m == "loop") {
+        c = 5;
+        *extra = 12;
+    } else if (m[0] == 'j') {
+        c = 4;
+        *extra = 12;
+    } else if (in(m, "movsb movsw cmpsb cmpsw scasb scasw lodsb lodsw stosb stosw")) {
+        static const char *ops[] = {"movs", "cmps", "scas", "lods", "stos"};
+        static const int once[] = {18, 22, 15, 12, 11}, rep[] = {17, 22, 15, 13, 10};
+        int i = 0;
+        while (m.compare(0, 4, ops[i])) i++;
+        if (prefix == 0xf2 || prefix == 0xf3) {
+            c = 9;
+            *extra = rep[i];
+        } else {
+            c = once[i];
+        }
+    } else if (m == "cwd") {
+        c = 5;
+    } else if (in(m, "lahf sahf aaa aas daa das")) {
+        c = 4;
+    } else if (m == "aam") {
+        c = 83;
+    } else if (m == "aad") {
+        c = 60;
+    } else if (m == "xlat") {
+        c = 11;
+    } else if (in(m, "in out")) {
+        c = 10;
+    } else if (in(m, "nop wait")) {
+        c = 3;
+    }
+    // segment override prefix
+    if (prefix == 0x26 || prefix == 0x2e || prefix == 0x36 || prefix == 0x3e) c += 2;
+    return c;
+}
+
+// decode once per address: the key is the opcode byte and the mnemonic
+Stats::Inst *VM::statinst(uint16_t ip) {
+    OpCode op = disasm1(text, ip, tsize);
+    uint8_t *p = text + ip;
+    switch (*p) {
+        case 0x26: case 0x2e: case 0x36: case 0x3e: case 0xf2: case 0xf3:
+            if (op.len > 1) ++p;
+    }
+    char buf[32];
+    snprintf(buf, sizeof (buf), "%02x %s", *p, op.mne);
+    Stats::Inst *in = &stats.insts[ip];
+    in->id = stats.id(op.mne, *p, buf);
+    in->reads = in->writes = 0;
+    in->len = op.len;
+    int extra = 0;
+    in->cycles = cyclemodel ? cost(op, *p, text[ip], &extra) : 0;
+    in->extra = extra;
+    std::string mne = op.mne;
+    if (mne == "lea") return in;
+    if (op.opr1.type >= Ptr) {
+        if (mne == "mov" || mne == "pop") {
+            in->writes = 1;
+        } else if (mne == "cmp" || mne == "test" || mne == "push"
+                || mne == "call" || mne == "jmp" || mne == "mul"
+                || mne == "imul" || mne == "div" || mne == "idiv") {
+            in->reads = 1;
+        } else {
+            in->reads = in->writes = 1;
+        }
+    }
+    if (op.opr2.type >= Ptr) ++in->reads;
+    return in;
+}
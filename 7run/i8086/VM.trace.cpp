@@ -0,0 +1,57 @@
+#include "VM.h"
+#include "../UnixBase.h"
+#include "disasm.h"
+#include "regs.h"
+#include <string.h>
+
+using namespace i8086;
+
+// instructions that write memory not named by their operands
+bool VM::implicit(uint8_t b) {
+    switch (b) {
+        case 0x26: case 0x2e: case 0x36: case 0x3e: // segment
+        case 0xa4: case 0xa5: case 0xaa: case 0xab: // movs, stos
+        case 0xcd: // int
+        case 0xf2: case 0xf3: // rep
+            return true;
+    }
+    return false;
+}
+
+// run2() writing the execution trace (-X)
+void VM::run2trace() {
+    uint16_t st[XT_STATE];
+    while (!hasExited) {
+        if (!xtrace.active()) {
+            getstate(st);
+            xtrace.image(this, XT_I8086, unix->guestpid(), st);
+        }
+        OpCode op = disasm1(text, IP, tsize);
+        int addrs[] = {addr(op.opr1), addr(op.opr2), -1};
+        bool full = implicit(text[IP]);
+        uint16_t seqpc = IP + op.len;
+        run1();
+        addrs[2] = SP;
+        getstate(st);
+        xtrace.step(this, st, seqpc, addrs, 3, full);
+        if (UnixBase::sigpending) {
+            unix->sigcheck();
+            getstate(st);
+            xtrace.async(this, st);
+        }
+        if (profcount && !--profcount) unix->profsample();
+        if (insns == ctx->insnbudget) unix->overbudget();
+    }
+}
+
+void VM::getstate(uint16_t *st) {
+    memcpy(st, r, sizeof (r));
+    st[8] = IP;
+    st[XT_FLAGREG] = getf();
+}
+
+void VM::setstate(const uint16_t *st) {
+    memcpy(r, st, sizeof (r));
+    IP = st[8];
+    setf(st[XT_FLAGREG]);
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include "../Aot.h"
+#include "../UnixBase.h"
+#include "VM.h"
+
+// runtime of the C++ that 7aot translates from 8086 text: registers and
+// flags live in locals, saved to the VM around the interpreter and signals
+
+#define RD8(a) mem[uint16_t(a)]
+#define RD16(a) ::read16(mem + uint16_t(a))
+#define WR8(a, v) (mem[uint16_t(a)] = uint8_t(v))
+#define WR16(a, v) ::write16(mem + uint16_t(a), uint16_t(v))
+
+#define AOT_ENTER \
+    i8086::VM &vm = *static_cast<i8086::VM *>(base); \
+    const AotImage *self = vm.aot; \
+    const bool *ptable = i8086::VM::ptable; \
+    uint8_t *mem = vm.data; \
+    uint16_t r[8]; \
+    bool OF, DF, SF, ZF, AF, PF, CF; \
+    int a, b, src, dst, val; \
+    uint32_t u32; \
+    int32_t i32; \
+    (void) ptable; (void) mem; (void) a; (void) b; (void) src; (void) dst; \
+    (void) val; (void) u32; (void) i32
+
+#define AOT_LOAD \
+    r[0] = vm.r[0]; r[1] = vm.r[1]; r[2] = vm.r[2]; r[3] = vm.r[3]; \
+    r[4] = vm.r[4]; r[5] = vm.r[5]; r[6] = vm.r[6]; r[7] = vm.r[7]; \
+    OF = vm.OF; DF = vm.DF; SF = vm.SF; ZF = vm.ZF; \
+    AF = vm.AF; PF = vm.PF; CF = vm.CF
+
+#define AOT_SAVE \
+    vm.r[0] = r[0]; vm.r[1] = r[1]; vm.r[2] = r[2]; vm.r[3] = r[3]; \
+    vm.r[4] = r[4]; vm.r[5] = r[5]; vm.r[6] = r[6]; vm.r[7] = r[7]; \
+    vm.OF = OF; vm.DF = DF; vm.SF = SF; vm.ZF = ZF; \
+    vm.AF = AF; vm.PF = PF; vm.CF = CF
+
+// getf() and setf() on the locals
+#define AOT_GETF \
+    (0xf002 | (OF << 11) | (DF << 10) | (SF << 7) | \
+    (ZF << 6) | (AF << 4) | (PF << 2) | CF)
+
+#define AOT_SETF(f) \
+    CF = (f) & 0x001; PF = (f) & 0x004; AF = (f) & 0x010; ZF = (f) & 0x040; \
+    SF = (f) & 0x080; DF = (f) & 0x400; OF = (f) & 0x800
+
+// the checks of run1() per block: the stack and the flight recorder
+#define AOT_BLOCK(ip, n) \
+    if (r[4] < vm.brksize) { \
+        vm.IP = ip; \
+        goto interp; \
+    } \
+    vm.recent[vm.insns % FLIGHT_PCS] = ip; \
+    vm.insns += n
+
+#define AOT_GOTO(ip, label) \
+    do { \
+        if (UnixBase::sigpending) { \
+            vm.IP = ip; \
+            goto save; \
+        } \
+        goto label; \
+    } while (0)
+
+#define AOT_JUMP(ip) \
+    do { \
+        vm.IP = ip; \
+        if (UnixBase::sigpending) goto save; \
+        goto dispatch; \
+    } while (0)
+
+#define AOT_INTERP(ip) \
+    do { \
+        vm.IP = ip; \
+        goto interp; \
+    } while (0)
+
+// ret from the entry frame: the end of the program
+#define AOT_EXIT(ip) \
+    do { \
+        vm.IP = ip; \
+        vm.hasExited = true; \
+        goto save; \
+    } while (0)
+
+// the interpreter runs vm.IP until it reaches a translated block
+#define AOT_RUNTIME \
+save: \
+    AOT_SAVE; \
+    goto poll; \
+interp: \
+    AOT_SAVE; \
+    vm.run1(); \
+poll: \
+    if (UnixBase::sigpending) vm.unix->sigcheck(); \
+    if (vm.hasExited || vm.aot != self) return; \
+    mem = vm.data; \
+    AOT_LOAD; \
+dispatch:
@@ -1,24 +1,116 @@
-#include "Minix2/OS.h"
-#include "UnixV6/OSPDP11.h"
-#include "UnixV6/OSi8086.h"
+#include "Guest.h"
+#include "UnixBase.h"
+#include "i8086/VM.h"
+#include "MemFS.h"
+#include "Lockstep.h"
+#include "Aot.h"
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// the guest processes append to the file: it starts empty
+static bool newfile(const std::string &path) {
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f) {
+        fprintf(stderr, "can not open: %s\n", path.c_str());
+        return false;
+    }
+    fclose(f);
+    return true;
+}
 
 int main(int argc, char *argv[]) {
-    bool dis = false, pdp11 = false, i8086 = false;
-    int ver = 6;
+    bool dis = false, pdp11 = false, i8086 = false, hletest = false;
+    int ver = 6, tracelevel = 0;
     std::vector<std::string> args;
+    Guest guest(ctx); // the default context: --memo and --deps read its root
     for (int i = 1; i < argc; i++) {
         std::string arg = argv[i];
         if (arg == "-r") {
             i++;
-            if (i < argc) setroot(argv[i]);
+            if (i < argc) guest.setroot(argv[i]);
         } else if (arg == "-m") {
-            trace = 3;
+            tracelevel = 3;
         } else if (arg == "-v") {
-            trace = 2;
-        } else if (arg == "-s" && trace == 0) {
-            trace = 1;
+            tracelevel = 2;
+        } else if (arg == "-s" && tracelevel == 0) {
+            tracelevel = 1;
+        } else if (arg == "-t") {
+            i++;
+            if (i < argc) memfs_mount(argv[i]);
+        } else if (arg == "-T") {
+            i++;
+            if (i < argc) memfs_limit = size_t(atoi(argv[i])) << 10;
+        } else if (arg == "-P") {
+            i++;
+            if (i < argc) {
+                profpath = argv[i];
+                profcount = profstep;
+            }
+        } else if (arg == "-G") {
+            i++;
+            if (i < argc) {
+                graphpath = argv[i];
+                callgraph = true;
+                profcount = profstep;
+            }
+        } else if (arg == "-I") {
+            i++;
+            if (i < argc && atoi(argv[i]) > 0) profstep = atoi(argv[i]);
+        } else if (arg == "-X") {
+            i++;
+            if (i < argc) xtracepath = argv[i];
+        } else if (arg == "-S") {
+            i++;
+            if (i < argc) {
+                systracepath = argv[i];
+                systrace = true;
+            }
+        } else if (arg == "--count") {
+            insncount = true;
+        } else if (arg == "--cycles") {
+            i++;
+            if (i < argc) cyclemodel = atoi(argv[i]) == 45 ? 45 : 40;
+        } else if (arg == "--budget") {
+            i++;
+            if (i < argc && strtoull(argv[i], NULL, 0)) {
+                guest.setbudget(strtoull(argv[i], NULL, 0));
+            }
+        } else if (arg == "--hle") {
+            i8086::hlemode = true;
+        } else if (arg == "--hle-test") {
+            hletest = true;
+        } else if (arg == "--lockstep") {
+            lockstep = true;
+        } else if (arg == "--no-aot") {
+            aotmode = false;
+        } else if (arg == "--memo") {
+            i++;
+            if (i < argc) memodir = argv[i];
+        } else if (arg == "--deps") {
+            i++;
+            if (i < argc) depspath = argv[i];
+        } else if (arg == "--snap-dir") {
+            i++;
+            if (i < argc) snapdir = argv[i];
+        } else if (arg == "--snap-at") {
+            i++;
+            if (i < argc) snapat = argv[i];
+        } else if (arg == "--timeline") {
+            i++;
+            if (i < argc) {
+                timelinepath = argv[i];
+                timeline = true;
+            }
+        } else if (arg == "--stats" || arg == "--stats-json") {
+            i++;
+            if (i < argc) {
+                statspath = argv[i];
+                statsmode = arg == "--stats" ? 1 : 2;
+            }
+        } else if (arg == "-u") {
+            buffered = false;
         } else if (arg == "-d") {
             dis = true;
         } else if (arg == "-p") {
@@ -45,40 +137,75 @@ int main(int argc, char *argv[]) {
         printf("    -m: verbose mode with memory dump\n");
         printf("    -v: verbose mode (output syscall and disassemble)\n");
         printf("    -s: syscall mode (output syscall)\n");
+        printf("    -u: unbuffered file I/O\n");
+        printf("    -P: append a sampling profile to file (ex. -P 7run.prof)\n");
+        printf("    -G: write collapsed call stacks for flamegraph to file\n");
+        printf("    -I: profile sampling interval in instructions (default: %d)\n",
+                profstep);
+        printf("    -X: write binary execution trace to file (see 7trace)\n");
+        printf("    -S: record system calls in binary to file (see 7sysdump)\n");
+        printf("    --stats file: append instruction statistics to file\n");
+        printf("    --stats-json file: same as --stats in JSON lines\n");
+        printf("    --timeline file: write Chrome trace of the process tree to file\n");
+        printf("    --count: print instructions (and cycles) of each process at exit\n");
+        printf("    --cycles 40|45: count approximate cycles (8086, PDP-11/40 or 11/45)\n");
+        printf("    --budget n: kill a process after n instructions (exit status 137)\n");
+        printf("    --hle: run ACK libc and libem routines natively (8086)\n");
+        printf("    --hle-test: check the native routines found in the program\n");
+        printf("    --lockstep: check the engine against a shadow VM, stop at divergence\n");
+        printf("               (HLE with --hle, not translated code: add --no-aot)\n");
+        printf("    --no-aot: interpret the programs that 7aot translated\n");
+        printf("    --memo dir: replay the outputs of a run with the same image, arguments and inputs\n");
+        printf("    --deps file: write the host files read and written as a make rule (and file.json)\n");
+        printf("    --snap-dir dir: restore snapshots of initialized programs from dir\n");
+        printf("    --snap-at sym|n: write a snapshot at sym (ex. _main) or after n instructions\n");
+        printf("    -t: mount in-memory file system (ex. -t /tmp)\n");
+        printf("    -T: in-memory file system limit in KB (default: %d)\n",
+                int(memfs_limit >> 10));
         return 1;
     }
 
-    uint8_t buf[2];
-    FILE *f = fopen(convpath(args[0]).c_str(), "rb");
-    if (!f) {
-        fprintf(stderr, "can not open: %s\n", args[0].c_str());
-        return 1;
-    }
-    if (fread(buf, 1, 2, f) != 2) {
-        fprintf(stderr, "can not read: %s\n", args[0].c_str());
-        fclose(f);
-        return 1;
+    guest.settrace(tracelevel);
+    if (!dis && !hletest) {
+        if (callgraph && !newfile(graphpath)) return 1;
+        if (systrace && !newfile(systracepath)) return 1;
+        if (lockstep && aotmode && aotlinked()) {
+            fprintf(stderr, "--lockstep does not check translated code: add --no-aot\n");
+            return 1;
+        }
     }
 
-    UnixBase *ub;
-    if (pdp11 || UnixV6::OSPDP11::check(buf)) {
-        ub = new UnixV6::OSPDP11(ver);
-    } else if (i8086 || UnixV6::OSi8086::check(buf)) {
-        ub = new UnixV6::OSi8086();
-    } else {
-        ub = new Minix2::OS();
+    std::vector<std::string> envs;
+    envs.push_back("PATH=/bin:/usr/bin");
+    if ((!memodir.empty() || !depspath.empty()) && !dis && !hletest) {
+        char mode[16];
+        snprintf(mode, sizeof (mode), "%d%d%d", ver, pdp11, i8086);
+        uint64_t key = memo_key(args[0], args, envs, mode);
+        int exitcode = 0;
+        if (!memodir.empty() && memo_replay(key, &exitcode)) return exitcode;
+        if (!memo_begin(key)) return 1;
     }
 
+#ifdef SIGUSR1
+    signal(SIGUSR1, UnixBase::flighthandler);
+#endif
     int exitcode = 0;
-    if (!ub->load(args[0])) {
+    guest.setmode(ver, pdp11, i8086);
+    guest.setargs(args);
+    guest.setenvs(envs);
+    if (timeline) timeline_open();
+    if (!guest.load(args[0])) {
+        if (memo) memo_taint("load");
         exitcode = 1;
     } else if (dis) {
-        ub->disasm();
+        guest.disasm();
+    } else if (hletest) {
+        exitcode = guest.hletest();
     } else {
-        std::vector<std::string> envs;
-        envs.push_back("PATH=/bin:/usr/bin");
-        exitcode = ub->run(args, envs);
+        exitcode = guest.run(); // forked children exit there
     }
-    delete ub;
+    if (timeline) timeline_close(true);
+    if (memolog) memo_end(exitcode);
+    if (callgraph) graphmerge();
     return exitcode;
 }
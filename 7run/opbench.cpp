@@ -0,0 +1,209 @@
+#include "PDP11/VM.h"
+#include "i8086/VM.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+// 7opbench: ns per instruction of tight synthetic loops, run through
+// PDP11::VM::run1() and i8086::VM::run1() without an OS. a loop is the
+// prologue, the body repeated REPEAT times and a jump back to 0.
+
+static const int REPEAT = 64, END = -1;
+
+struct Kernel {
+    bool pdp11;
+    const char *name;
+    int prologue[8], body[12]; // PDP-11: words, 8086: bytes
+    int pinsns, binsns, units; // run1() calls and units per body
+};
+
+static const Kernel kernels[] = {
+    {true, "add r1,r2",
+        {END}, {060102, END}, 0, 1, 1},
+    {true, "mov r1,r2",
+        {END}, {010102, END}, 0, 1, 1},
+    {true, "mov $n,r2",
+        {END}, {012702, 01234, END}, 0, 1, 1},
+    {true, "mov x(r1),r2",
+        {012701, 050000, END}, {016102, 010, END}, 1, 1, 1},
+    {true, "mov (r1)+,(r2)+",
+        {012701, 050000, 012702, 060000, END}, {012122, END}, 2, 1, 1},
+    {true, "movb (r1)+,r2",
+        {012701, 050000, END}, {0112102, END}, 1, 1, 1},
+    {true, "br .+2",
+        {END}, {000400, END}, 0, 1, 1},
+    {true, "sob r1,. (per iteration)",
+        {END}, {012701, 0400, 077101, END}, 0, 257, 256},
+    {true, "clr r0; mov r3,r1; div r2,r0",
+        {012702, 7, 012703, 01750, END}, {005000, 010301, 071002, END}, 2, 3, 1},
+    {false, "add ax,bx",
+        {END}, {0x01, 0xd8, END}, 0, 1, 1},
+    {false, "mov ax,bx",
+        {END}, {0x89, 0xd8, END}, 0, 1, 1},
+    {false, "inc ax",
+        {END}, {0x40, END}, 0, 1, 1},
+    {false, "mov ax,[bx]",
+        {0xbb, 0x00, 0x50, END}, {0x8b, 0x07, END}, 1, 1, 1},
+    {false, "mov ax,[bx+si]",
+        {0xbb, 0x00, 0x50, 0xbe, 0x10, 0x00, END}, {0x8b, 0x00, END}, 2, 1, 1},
+    {false, "mov ax,[bx+8]",
+        {0xbb, 0x00, 0x50, END}, {0x8b, 0x47, 0x08, END}, 1, 1, 1},
+    {false, "mov ax,[bx+si+0x100]",
+        {0xbb, 0x00, 0x50, 0xbe, 0x10, 0x00, END}, {0x8b, 0x80, 0x00, 0x01, END}, 2, 1, 1},
+    {false, "mov ax,[0x5000]",
+        {END}, {0x8b, 0x06, 0x00, 0x50, END}, 0, 1, 1},
+    {false, "mov [bx],ax",
+        {0xbb, 0x00, 0x50, END}, {0x89, 0x07, END}, 1, 1, 1},
+    {false, "push ax; pop ax",
+        {END}, {0x50, 0x58, END}, 0, 2, 2},
+    {false, "jmp short $+2",
+        {END}, {0xeb, 0x00, END}, 0, 1, 1},
+    {false, "rep movsw (per word, cx=64)",
+        {END}, {0xb9, 0x40, 0x00, 0xbe, 0x00, 0x50, 0xbf, 0x00, 0x60, 0xf3, 0xa5, END}, 0, 4, 64},
+    {false, "loop $ (per iteration)",
+        {END}, {0xb9, 0x00, 0x01, 0xe2, 0xfe, END}, 0, 257, 256},
+    {false, "xor dx,dx; mov ax,cx; div bx",
+        {0xbb, 0x07, 0x00, 0xb9, 0xe8, 0x03, END}, {0x31, 0xd2, 0x89, 0xc8, 0xf7, 0xf3, END}, 2, 3, 1},
+};
+
+static void append(std::vector<uint8_t> *code, const int *p, bool words) {
+    for (; *p != END; p++) {
+        code->push_back(*p);
+        if (words) code->push_back(*p >> 8);
+    }
+}
+
+struct Bench {
+    const Kernel &k;
+    PDP11::VM pdp11;
+    i8086::VM i8086;
+    VMBase *vm;
+    int insns, units; // per round
+
+    Bench(const Kernel &k, bool nocache) : k(k) {
+        std::vector<uint8_t> code;
+        append(&code, k.prologue, k.pdp11);
+        for (int i = 0; i < REPEAT; i++) append(&code, k.body, k.pdp11);
+        uint16_t end = code.size();
+        if (k.pdp11) {
+            const int jmp[] = {000137, 0, END}; // jmp @#0
+            append(&code, jmp, true);
+            vm = &pdp11;
+        } else {
+            uint16_t rel = -(end + 3);
+            const int jmp[] = {0xe9, rel & 0xff, rel >> 8, END}; // jmp 0
+            append(&code, jmp, false);
+            vm = &i8086;
+        }
+        vm->text = new uint8_t[0x10000];
+        memset(vm->text, 0, 0x10000);
+        memcpy(vm->text, &code[0], code.size());
+        if (k.pdp11) {
+            vm->data = vm->text;
+            if (!nocache) pdp11.cache.resize(0x10000);
+            pdp11.r[6] = 0xff00;
+        } else {
+            vm->data = new uint8_t[0x10000];
+            memset(vm->data, 0, 0x10000);
+            i8086.r[4] = 0xff00;
+        }
+        vm->tsize = code.size();
+        vm->brksize = 0; // no stack check: there is no OS to report it
+        vm->unix = NULL;
+        insns = k.pinsns + k.binsns * REPEAT + 1;
+        units = k.units * REPEAT;
+    }
+
+    // false if the loop did not come back to 0 (a broken encoding)
+    bool run(int rounds) {
+        if (k.pdp11) {
+            for (int i = 0; i < rounds && !vm->hasExited; i++) {
+                for (int j = 0; j < insns; j++) pdp11.run1();
+            }
+            return pdp11.r[7] == 0 && !vm->hasExited;
+        }
+        for (int i = 0; i < rounds && !vm->hasExited; i++) {
+            for (int j = 0; j < insns; j++) i8086.run1();
+        }
+        return i8086.IP == 0 && !vm->hasExited;
+    }
+};
+
+// two-sided 95% t quantiles for 1..30 degrees of freedom
+static const double tdist[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+};
+
+int main(int argc, char *argv[]) {
+    int samples = 20, arch = 0;
+    double target = 2e6;
+    bool nocache = false;
+    std::vector<std::string> names;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc) {
+            samples = atoi(argv[++i]);
+        } else if (arg == "-u" && i + 1 < argc) {
+            target = atof(argv[++i]);
+        } else if (arg == "-p") {
+            arch = 1;
+        } else if (arg == "-8") {
+            arch = 2;
+        } else if (arg == "-c") {
+            nocache = true;
+        } else if (arg[0] == '-') {
+            printf("usage: %s [-p|-8] [-c] [-n samples] [-u units] [name ...]\n", argv[0]);
+            printf("    -p: PDP-11 only\n");
+            printf("    -8: 8086 only\n");
+            printf("    -c: PDP-11 without the decoded instruction cache\n");
+            printf("    -n: samples per loop (default: 20)\n");
+            printf("    -u: units per sample (default: 2e6)\n");
+            printf("    name: loops whose name contains it\n");
+            return 1;
+        } else {
+            names.push_back(arg);
+        }
+    }
+    if (samples < 2) samples = 2;
+    printf("%-6s %-30s %9s %9s %9s %8s\n",
+            "arch", "loop", "ns/unit", "+-95%", "min", "Munits/s");
+    for (size_t n = 0; n < sizeof (kernels) / sizeof (kernels[0]); n++) {
+        const Kernel &k = kernels[n];
+        if ((arch == 1 && !k.pdp11) || (arch == 2 && k.pdp11)) continue;
+        bool match = names.empty();
+        for (size_t i = 0; i < names.size(); i++) {
+            if (strstr(k.name, names[i].c_str())) match = true;
+        }
+        if (!match) continue;
+        Bench b(k, nocache);
+        int rounds = int(target / b.units);
+        if (rounds < 1) rounds = 1;
+        if (!b.run(rounds)) { // warm up
+            fprintf(stderr, "%s: loop broken\n", k.name);
+            continue;
+        }
+        std::vector<double> ns(samples);
+        double sum = 0, min = 0;
+        for (int i = 0; i < samples; i++) {
+            uint64_t t = nanotime();
+            b.run(rounds);
+            ns[i] = double(nanotime() - t) / (double(rounds) * b.units);
+            sum += ns[i];
+            if (!i || ns[i] < min) min = ns[i];
+        }
+        double mean = sum / samples, var = 0;
+        for (int i = 0; i < samples; i++) {
+            var += (ns[i] - mean) * (ns[i] - mean);
+        }
+        double sd = sqrt(var / (samples - 1));
+        double t = samples - 1 <= 30 ? tdist[samples - 2] : 1.960;
+        printf("%-6s %-30s %9.3f %9.3f %9.3f %8.1f\n",
+                k.pdp11 ? "pdp11" : "8086", k.name, mean,
+                t * sd / sqrt(double(samples)), min, 1e3 / mean);
+    }
+    return 0;
+}
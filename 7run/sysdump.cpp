@@ -0,0 +1,249 @@
+#include "SysTrace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+// 7sysdump: print, filter and aggregate the records of 7run -S
+
+static const char *v6names[] = {
+    "indir", "exit", "fork", "read", "write", "open", "close", "wait",
+    "creat", "link", "unlink", "exec", "chdir", "time", "mknod", "chmod",
+    "chown", "break", "stat", "seek", "getpid", "mount", "umount", "setuid",
+    "getuid", "stime", "ptrace", "alarm", "fstat", "pause", "utime", "stty",
+    "gtty", "access", "nice", "ftime", "sync", "kill", "", "",
+    "", "dup", "pipe", "times", "prof", "", "setgid", "getgid",
+    "signal", "", "", "acct", "phys", "lock", "ioctl", "",
+    "", "", "", "exece", "umask", "chroot",
+};
+
+static const char *minixnames[] = {
+    "", "exit", "fork", "read", "write", "open", "close", "wait",
+    "creat", "link", "unlink", "waitpid", "chdir", "time", "mknod", "chmod",
+    "chown", "brk", "stat", "lseek", "getpid", "mount", "umount", "setuid",
+    "getuid", "stime", "ptrace", "alarm", "fstat", "pause", "utime", "",
+    "", "access", "", "", "sync", "kill", "rename", "mkdir",
+    "rmdir", "dup", "pipe", "times", "", "", "setgid", "getgid",
+    "signal", "", "", "", "", "", "ioctl", "fcntl",
+    "", "", "", "exec", "umask", "chroot", "setsid", "getpgrp",
+    "ksig", "unpause", "", "revive", "task_reply", "", "", "sigaction",
+    "sigsuspend", "sigpending", "sigprocmask", "sigreturn", "reboot", "svrctl",
+};
+
+struct Record : public SysRecord {
+    uint32_t hostpid;
+};
+
+static std::map<std::pair<uint32_t, uint32_t>, std::string> strings;
+static std::vector<Record> records;
+static int pid;
+static std::string call;
+
+static std::string name(const SysRecord &r) {
+    const char **names = v6names;
+    int max = sizeof (v6names) / sizeof (v6names[0]);
+    if (r.os == SYSTRACE_MINIX) {
+        names = minixnames;
+        max = sizeof (minixnames) / sizeof (minixnames[0]);
+    }
+    if (r.num < max && *names[r.num]) return names[r.num];
+    char buf[16];
+    snprintf(buf, sizeof (buf), "sys%d", r.num);
+    return buf;
+}
+
+static std::string path(const Record &r) {
+    if (!r.path) return "";
+    return strings[std::make_pair(r.hostpid, r.path)];
+}
+
+static bool load(const char *file) {
+    FILE *f = fopen(file, "rb");
+    if (!f) {
+        fprintf(stderr, "can not open: %s\n", file);
+        return false;
+    }
+    SysChunk ch;
+    bool ret = true;
+    while (fread(&ch, sizeof (ch), 1, f) == 1) {
+        if (memcmp(ch.magic, "7SYS", 4)) {
+            fprintf(stderr, "%s: broken chunk\n", file);
+            ret = false;
+            break;
+        }
+        std::vector<char> strs(ch.strsize + 1);
+        if (fread(&strs[0], 1, ch.strsize, f) != ch.strsize) break;
+        for (size_t p = 0; p + sizeof (uint32_t) < ch.strsize;) {
+            uint32_t id;
+            memcpy(&id, &strs[p], sizeof (id));
+            p += sizeof (id);
+            std::string s = &strs[p];
+            strings[std::make_pair(ch.hostpid, id)] = s;
+            p += s.size() + 1;
+        }
+        for (uint32_t i = 0; i < ch.nrec; i++) {
+            Record r;
+            if (fread(&r, sizeof (SysRecord), 1, f) != 1) break;
+            r.hostpid = ch.hostpid;
+            records.push_back(r);
+        }
+    }
+    fclose(f);
+    return ret;
+}
+
+static bool bystart(const Record &a, const Record &b) {
+    return a.start < b.start;
+}
+
+static bool match(const Record &r) {
+    if (pid && (int) r.pid != pid) return false;
+    return call.empty() || name(r) == call;
+}
+
+static void list() {
+    uint64_t t0 = records.empty() ? 0 : records[0].start;
+    for (int i = 0; i < (int) records.size(); i++) {
+        const Record &r = records[i];
+        if (!match(r)) continue;
+        printf("%5d %12.3f %10.3f %s(%d, %d, %d, %d) = %d",
+                r.pid, (r.start - t0) / 1000.0, r.time / 1000.0,
+                name(r).c_str(), r.args[0], r.args[1], r.args[2], r.args[3],
+                r.result);
+        if (r.result == -1) printf(" [%s]", strerror(r.err));
+        if (r.path) printf(" \"%s\"", path(r).c_str());
+        printf("\n");
+    }
+}
+
+struct Total {
+    int count, errors;
+    uint64_t time;
+
+    Total() : count(0), errors(0), time(0) {
+    }
+};
+
+template <typename T>
+static bool bytime(const std::pair<uint64_t, T> &a,
+        const std::pair<uint64_t, T> &b) {
+    return a.first != b.first ? a.first > b.first : a.second < b.second;
+}
+
+static void summary() {
+    std::map<std::string, Total> totals;
+    uint64_t all = 0;
+    for (int i = 0; i < (int) records.size(); i++) {
+        const Record &r = records[i];
+        if (!match(r)) continue;
+        Total &t = totals[name(r)];
+        ++t.count;
+        if (r.result == -1) ++t.errors;
+        t.time += r.time;
+        all += r.time;
+    }
+    std::vector<std::pair<uint64_t, std::string> > order;
+    std::map<std::string, Total>::iterator it;
+    for (it = totals.begin(); it != totals.end(); ++it) {
+        order.push_back(std::make_pair(it->second.time, it->first));
+    }
+    std::sort(order.begin(), order.end(), bytime<std::string>);
+    printf("%-12s %8s %7s %12s %10s %6s\n",
+            "syscall", "calls", "errors", "total(ms)", "avg(us)", "%");
+    for (int i = 0; i < (int) order.size(); i++) {
+        const Total &t = totals[order[i].second];
+        printf("%-12s %8d %7d %12.3f %10.3f %5.1f%%\n",
+                order[i].second.c_str(), t.count, t.errors, t.time / 1e6,
+                t.time / 1e3 / t.count, all ? 100.0 * t.time / all : 0.0);
+    }
+}
+
+// bytes per path: descriptors are followed through open/creat, dup and fork
+static void files(int max) {
+    std::map<uint32_t, std::map<int, std::string> > fds;
+    std::map<std::string, uint64_t> rbytes, wbytes;
+    for (int i = 0; i < (int) records.size(); i++) {
+        const Record &r = records[i];
+        std::map<int, std::string> &fd = fds[r.pid];
+        std::string n = name(r);
+        if (r.result == -1) continue;
+        if (n == "open" || n == "creat") {
+            fd[r.result] = path(r);
+        } else if (n == "close") {
+            fd.erase(r.args[0]);
+        } else if (n == "dup") {
+            if (fd.find(r.args[0]) != fd.end()) fd[r.result] = fd[r.args[0]];
+        } else if (n == "fork") {
+            if (r.result > 0) fds[r.result] = fd;
+        } else if ((n == "read" || n == "write") && match(r)) {
+            std::map<int, std::string>::iterator it = fd.find(r.args[0]);
+            std::string p = it != fd.end() ? it->second : "";
+            if (p.empty()) {
+                char buf[16];
+                snprintf(buf, sizeof (buf), "<fd %d>", r.args[0]);
+                p = buf;
+            }
+            (n == "read" ? rbytes : wbytes)[p] += r.result;
+        }
+    }
+    std::map<std::string, uint64_t> bytes = rbytes;
+    std::map<std::string, uint64_t>::iterator it;
+    for (it = wbytes.begin(); it != wbytes.end(); ++it) {
+        bytes[it->first] += it->second;
+    }
+    std::vector<std::pair<uint64_t, std::string> > order;
+    for (it = bytes.begin(); it != bytes.end(); ++it) {
+        order.push_back(std::make_pair(it->second, it->first));
+    }
+    std::sort(order.begin(), order.end(), bytime<std::string>);
+    printf("%12s %12s  %s\n", "read", "written", "file");
+    for (int i = 0; i < (int) order.size() && i < max; i++) {
+        const std::string &p = order[i].second;
+        printf("%12llu %12llu  %s\n",
+                (unsigned long long) rbytes[p], (unsigned long long) wbytes[p],
+                p.c_str());
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int mode = 0, max = 20;
+    std::string file;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-p" && i + 1 < argc) {
+            pid = atoi(argv[++i]);
+        } else if (arg == "-c" && i + 1 < argc) {
+            call = argv[++i];
+        } else if (arg == "-s") {
+            mode = 1;
+        } else if (arg == "-f") {
+            mode = 2;
+        } else if (arg == "-n" && i + 1 < argc) {
+            max = atoi(argv[++i]);
+        } else {
+            file = arg;
+        }
+    }
+    if (file.empty()) {
+        printf("usage: %s [-p pid] [-c syscall] [-s|-f [-n max]] file\n", argv[0]);
+        printf("    -p: only records of the guest pid\n");
+        printf("    -c: only records of the system call (ex. -c read)\n");
+        printf("    -s: summary of calls and time per system call\n");
+        printf("    -f: top files by bytes read and written\n");
+        printf("    -n: number of files shown by -f (default: %d)\n", max);
+        return 1;
+    }
+    if (!load(file.c_str())) return 1;
+    std::stable_sort(records.begin(), records.end(), bystart);
+    switch (mode) {
+        case 0: list();
+            break;
+        case 1: summary();
+            break;
+        case 2: files(max);
+            break;
+    }
+    return 0;
+}
@@ -0,0 +1,216 @@
+#include "XTrace.h"
+#include "PDP11/VM.h"
+#include "PDP11/disasm.h"
+#include "i8086/VM.h"
+#include "i8086/disasm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// 7trace: print an execution trace of 7run -X as 7run -v (or -m) does,
+// by replaying the recorded state through VM::debug()
+
+static FILE *f;
+static PDP11::VM *pdp11;
+static i8086::VM *i8086vm;
+static VMBase *vm;
+static uint64_t insn;
+static uint16_t st[XT_STATE];
+static int pcreg;
+
+static bool get(void *p, size_t len) {
+    return fread(p, 1, len, f) == len;
+}
+
+static uint16_t get16() {
+    uint16_t v = 0;
+    get(&v, sizeof (v));
+    return v;
+}
+
+static void getstate() {
+    get(st, sizeof (st));
+    if (pdp11) {
+        pdp11->setstate(st);
+    } else {
+        i8086vm->setstate(st);
+    }
+}
+
+static void getmem() {
+    int n = get16();
+    for (int i = 0; i < n; i++) {
+        uint16_t addr = get16(), len = get16();
+        get(vm->data + addr, len);
+    }
+}
+
+static void image() {
+    uint8_t hdr[2];
+    get(hdr, sizeof (hdr));
+    get(&insn, sizeof (insn));
+    delete vm;
+    pdp11 = NULL;
+    i8086vm = NULL;
+    if (hdr[0] == XT_PDP11) {
+        vm = pdp11 = new PDP11::VM;
+        pcreg = 7;
+    } else {
+        vm = i8086vm = new i8086::VM;
+        pcreg = 8;
+    }
+    std::string name(get16(), 0);
+    if (!name.empty()) get(&name[0], name.size());
+    uint32_t tsize = 0;
+    get(&tsize, sizeof (tsize));
+    vm->tsize = tsize;
+    vm->text = new uint8_t[0x10000];
+    memset(vm->text, 0, 0x10000);
+    if (hdr[1]) {
+        vm->data = vm->text;
+    } else {
+        get(vm->text, tsize);
+        vm->data = new uint8_t[0x10000];
+    }
+    get(vm->data, 0x10000);
+    uint32_t nsyms = 0;
+    get(&nsyms, sizeof (nsyms));
+    for (uint32_t i = 0; i < nsyms; i++) {
+        Symbol sym;
+        sym.addr = get16();
+        sym.name.resize(get16());
+        if (!sym.name.empty()) get(&sym.name[0], sym.name.size());
+        sym.type = 0;
+        vm->syms[1][sym.addr] = sym;
+    }
+    getstate();
+}
+
+static void mark() {
+    get(&insn, sizeof (insn));
+    getstate();
+    get(vm->data, 0x10000);
+}
+
+// print the instruction at pc if needed, and return its length
+static int debug(uint16_t pc, bool print) {
+    if (pdp11) {
+        PDP11::OpCode op = PDP11::disasm1(vm->text, pc);
+        if (print) pdp11->debug(pc, op);
+        return op.len;
+    }
+    i8086::OpCode op = i8086::disasm1(vm->text, pc, vm->tsize);
+    if (print) i8086vm->debug(pc, op);
+    return op.len;
+}
+
+// position f at the last image and mark not after the instruction
+static void seek(uint64_t start) {
+    uint32_t n;
+    char magic[4];
+    if (fseek(f, -8, SEEK_END) || !get(&n, sizeof (n)) || !get(magic, 4)
+            || memcmp(magic, "7IDX", 4) || fseek(f, -8 - 17 * long(n), SEEK_END)) {
+        fseek(f, 4, SEEK_SET);
+        return;
+    }
+    uint64_t img = 0, mk = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        uint8_t type;
+        uint64_t at, offset;
+        get(&type, 1);
+        get(&at, sizeof (at));
+        get(&offset, sizeof (offset));
+        if (at > start) break;
+        if (type == XT_IMAGE) {
+            img = offset;
+            mk = 0;
+        } else if (type == XT_MARK) {
+            mk = offset;
+        }
+    }
+    if (!img) {
+        fseek(f, 4, SEEK_SET);
+        return;
+    }
+    fseek(f, img + 2, SEEK_SET);
+    image();
+    if (mk) {
+        fseek(f, mk + 2, SEEK_SET);
+        mark();
+    }
+}
+
+int main(int argc, char *argv[]) {
+    uint64_t start = 0, count = 0;
+    std::string file;
+    ctx->trace = 2;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-m") {
+            ctx->trace = 3;
+        } else if (arg == "-s" && i + 1 < argc) {
+            start = strtoull(argv[++i], NULL, 0);
+        } else if (arg == "-n" && i + 1 < argc) {
+            count = strtoull(argv[++i], NULL, 0);
+        } else {
+            file = arg;
+        }
+    }
+    if (file.empty()) {
+        printf("usage: %s [-m] [-s start] [-n count] file\n", argv[0]);
+        printf("    -m: with memory dump (as 7run -m)\n");
+        printf("    -s: start from the instruction index\n");
+        printf("    -n: number of instructions to print\n");
+        return 1;
+    }
+    f = fopen(file.c_str(), "rb");
+    char magic[4];
+    if (!f || !get(magic, 4) || memcmp(magic, "7TRC", 4)) {
+        fprintf(stderr, "can not read: %s\n", file.c_str());
+        return 1;
+    }
+    if (start) seek(start);
+    // VM::debug() writes to stderr
+    fflush(stderr);
+    dup2(fileno(stdout), fileno(stderr));
+    setvbuf(stderr, NULL, _IOFBF, 1 << 16);
+    bool header = false;
+    uint64_t end = count ? start + count : 0;
+    uint16_t mask;
+    while (get(&mask, sizeof (mask))) {
+        if (mask & XT_SPECIAL) {
+            int type = mask & 0xff;
+            if (type == XT_IMAGE) {
+                image();
+            } else if (type == XT_MARK) {
+                mark();
+            } else if (type == XT_ASYNC) {
+                getstate();
+                getmem();
+            } else {
+                break;
+            }
+            continue;
+        }
+        if (!vm || (end && insn >= end)) break;
+        if (insn >= start && !header) {
+            vm->showHeader();
+            header = true;
+        }
+        st[pcreg] += debug(st[pcreg], insn >= start);
+        for (int i = 0; i < XT_STATE; i++) {
+            if (mask & XT_REG(i)) st[i] = get16();
+        }
+        if (pdp11) {
+            pdp11->setstate(st);
+        } else {
+            i8086vm->setstate(st);
+        }
+        if (mask & XT_MEM) getmem();
+        ++insn;
+    }
+    fclose(f);
+    delete vm;
+    return 0;
+}
@@ -1,13 +1,30 @@
 #include "utils.h"
 #include <stdio.h>
 #include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/time.h>
 #include <sys/stat.h>
+#include <map>
 #ifdef WIN32
 #include <limits.h>
 #include <windows.h>
 #endif
 
-std::string rootpath;
+int cachettl = 2;
+
+// host monotonic clock in ns
+uint64_t nanotime() {
+#ifdef WIN32
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return uint64_t(tv.tv_sec) * 1000000000 + uint64_t(tv.tv_usec) * 1000;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return uint64_t(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#endif
+}
 
 std::string readstr(uint8_t *mem, int max) {
     std::string ret;
@@ -54,7 +71,56 @@ std::string hexdump2(uint8_t *mem, int len) {
 void setroot(std::string root) {
     while (endsWith(root, "/"))
         root = root.substr(0, root.size() - 1);
-    rootpath = root;
+    ctx->rootpath = root;
+    clearcache();
+}
+
+// stat() results (including misses) are kept for cachettl seconds
+static StatEntry *lookup(const std::string &path, bool data) {
+    time_t now = time(NULL);
+    ++ctx->lookups;
+    std::map<std::string, StatEntry> &statcache = ctx->statcache;
+    std::map<std::string, StatEntry>::iterator it = statcache.find(path);
+    if (it != statcache.end()) {
+        StatEntry *e = &it->second;
+        if (now - e->time < cachettl && (!data || e->result || e->gen == ctx->statgen)) {
+            ++ctx->hits;
+            return e;
+        }
+    } else if (statcache.size() >= 256) {
+        statcache.clear();
+    }
+    StatEntry *e = &statcache[path];
+    e->time = now;
+    e->gen = ctx->statgen;
+    e->result = stat(path.c_str(), &e->st);
+    e->err = errno;
+    return e;
+}
+
+int cachedstat(const std::string &path, struct stat *st) {
+    StatEntry *e = lookup(path, true);
+    if (e->result) {
+        errno = e->err;
+    } else {
+        *st = e->st;
+    }
+    return e->result;
+}
+
+// files were created or removed
+void clearcache() {
+    ctx->statcache.clear();
+}
+
+// file contents were changed (existence is still valid)
+void clearstat() {
+    ++ctx->statgen;
+}
+
+void showcache() {
+    fprintf(stderr, "<stat cache: %d/%d hits (%d%%)>\n",
+            ctx->hits, ctx->lookups, ctx->lookups ? ctx->hits * 100 / ctx->lookups : 0);
 }
 
 #ifdef WIN32
@@ -75,11 +141,10 @@ std::string convpath(const std::string &path) {
     if (startsWith(path, "/usr/tmp/"))
         return path.substr(4);
 #endif
-    if (!rootpath.empty()) {
+    if (!ctx->rootpath.empty()) {
         if (startsWith(path, "/")) {
-            std::string path2 = rootpath + path;
-            struct stat st;
-            if (!stat(path2.c_str(), &st)) return path2;
+            std::string path2 = ctx->rootpath + path;
+            if (!lookup(path2, false)->result) return path2;
         }
     }
     return path;
@@ -1,8 +1,10 @@
 #pragma once
+#include "Context.h"
 #include <stdint.h>
 #include <string>
+#include <sys/stat.h>
 
-extern std::string rootpath;
+extern int cachettl;
 
 #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
 inline uint16_t read16(uint8_t *mem) {
@@ -52,6 +54,7 @@ inline void write32pdp(uint8_t *mem, uint32_t v) {
 }
 
 std::string readstr(uint8_t *mem, int max);
+uint64_t nanotime();
 
 std::string hex(int v, int len = 0);
 std::string hexdump(uint8_t *mem, int len);
@@ -59,6 +62,10 @@ std::string hexdump2(uint8_t *mem, int len);
 
 void setroot(std::string root);
 std::string convpath(const std::string &path);
+int cachedstat(const std::string &path, struct stat *st);
+void clearcache();
+void clearstat();
+void showcache();
 
 bool startsWith(const std::string &s, const std::string &prefix);
 bool endsWith(const std::string &s, const std::string &suffix);